@@ -0,0 +1,15177 @@
+	.file	"avrtest.c"
+	.text
+	.p2align 4
+	.type	delay_loop, @function
+delay_loop:
+.LFB20:
+	.cfi_startproc
+	movq	%rsi, %r8	# 3	[c=4 l=3]  *movdi_internal/3
+	movq	%rdi, %rdx	# 5	[c=4 l=3]  *movdi_internal/3
+	movl	$1, %esi	# 6	[c=4 l=5]  *movsi_internal/0
+	xorl	%r9d, %r9d	# 234	[c=4 l=3]  *movdi_xor
+	xorl	%ecx, %ecx	# 235	[c=4 l=2]  *movdi_xor
+.L13:
+	movzbl	8(%rdx), %eax	# 16	[c=9 l=4]  *movqi_internal/4
+	cmpb	$65, %al	# 17	[c=4 l=2]  *cmpqi_1/0
+	je	.L2	# 18	[c=13 l=2]  *jcc
+	ja	.L3	# 23	[c=13 l=2]  *jcc
+	cmpb	$14, %al	# 25	[c=4 l=2]  *cmpqi_1/0
+	je	.L4	# 26	[c=13 l=6]  *jcc
+	cmpb	$26, %al	# 28	[c=4 l=2]  *cmpqi_1/0
+	jne	.L33	# 29	[c=13 l=6]  *jcc
+	testl	%ecx, %ecx	# 58	[c=4 l=2]  *cmpsi_ccno_1/0
+	jne	.L7	# 59	[c=13 l=2]  *jcc
+	.p2align 4,,10
+	.p2align 3
+.L31:
+	movzbl	10(%rdx), %r9d	# 61	[c=13 l=5]  *zero_extendqisi2/0
+	movl	$1, %ecx	# 10	[c=4 l=5]  *movsi_internal/0
+.L14:
+	cmpb	$101, %al	# 64	[c=4 l=2]  *cmpqi_1/0
+	movl	%r9d, (%r8)	# 63	[c=4 l=3]  *movsi_internal/1
+	sete	%r9b	# 65	[c=4 l=4]  *setcc_qi
+.L2:
+	movzbl	9(%rdx), %eax	# 115	[c=13 l=4]  zero_extendqidi2/0
+	addl	$1, %esi	# 118	[c=4 l=3]  *addsi_1/0
+	salq	$4, %rax	# 116	[c=4 l=4]  *ashldi3_1/0
+	addq	%rax, %rdx	# 117	[c=4 l=3]  *adddi_1/0
+	cmpl	$17, %esi	# 120	[c=4 l=3]  *cmpsi_1/0
+	jne	.L13	# 121	[c=13 l=2]  *jcc
+	.p2align 4,,10
+	.p2align 3
+.L7:
+	xorl	%ecx, %ecx	# 231	[c=4 l=2]  *movdi_xor
+.L1:
+	movl	%ecx, %eax	# 157	[c=4 l=2]  *movsi_internal/0
+	ret		# 223	[c=0 l=1]  simple_return_internal
+	.p2align 4,,10
+	.p2align 3
+.L3:
+	cmpb	$77, %al	# 38	[c=4 l=2]  *cmpqi_1/0
+	jne	.L34	# 39	[c=13 l=2]  *jcc
+	testb	%r9b, %r9b	# 71	[c=4 l=3]  *cmpqi_ccno_1/0
+	je	.L7	# 72	[c=13 l=2]  *jcc
+	cmpw	$0, 12(%rdx)	# 74	[c=13 l=5]  *cmphi_ccno_1/1
+	jne	.L7	# 75	[c=13 l=2]  *jcc
+	movl	(%r8), %eax	# 232	[c=5 l=3]  *movsi_internal/0
+	movzbl	10(%rdx), %r10d	# 77	[c=13 l=5]  *zero_extendqisi2/0
+	addl	%ecx, %eax	# 233	[c=4 l=2]  *addsi_1/0
+	cmpl	%eax, %r10d	# 80	[c=4 l=3]  *cmpsi_1/0
+	jne	.L7	# 81	[c=13 l=2]  *jcc
+	addl	$1, %ecx	# 83	[c=4 l=3]  *addsi_1/0
+	jmp	.L2	# 238	[c=1 l=2]  jump
+	.p2align 4,,10
+	.p2align 3
+.L34:
+	cmpb	$101, %al	# 41	[c=4 l=2]  *cmpqi_1/0
+	jne	.L7	# 42	[c=13 l=2]  *jcc
+	testl	%ecx, %ecx	# 44	[c=4 l=2]  *cmpsi_ccno_1/0
+	jne	.L7	# 45	[c=13 l=2]  *jcc
+	cmpw	$1, 12(%rdx)	# 150	[c=13 l=5]  *cmphi_1/0
+	jne	.L7	# 151	[c=13 l=2]  *jcc
+	jmp	.L31	# 241	[c=1 l=5]  jump
+	.p2align 4,,10
+	.p2align 3
+.L33:
+	cmpb	$7, %al	# 31	[c=4 l=2]  *cmpqi_1/0
+	jne	.L7	# 32	[c=13 l=2]  *jcc
+	testl	%ecx, %ecx	# 51	[c=4 l=2]  *cmpsi_ccno_1/0
+	jne	.L7	# 52	[c=13 l=2]  *jcc
+	cmpw	$1, 12(%rdx)	# 138	[c=13 l=5]  *cmphi_1/0
+	jne	.L7	# 139	[c=13 l=2]  *jcc
+	movzbl	10(%rdx), %r9d	# 132	[c=13 l=5]  *zero_extendqisi2/0
+	movl	$2, %ecx	# 11	[c=4 l=5]  *movsi_internal/0
+	jmp	.L14	# 243	[c=1 l=5]  jump
+	.p2align 4,,10
+	.p2align 3
+.L4:
+	testl	%ecx, %ecx	# 88	[c=4 l=2]  *cmpsi_ccno_1/0
+	je	.L7	# 89	[c=13 l=6]  *jcc
+	cmpw	$2, 12(%rdx)	# 91	[c=13 l=5]  *cmphi_1/0
+	jne	.L7	# 92	[c=13 l=6]  *jcc
+	movsbq	10(%rdx), %rax	# 94	[c=13 l=5]  extendqidi2
+	addq	$1, %rax	# 95	[c=4 l=4]  *adddi_1/0
+	salq	$4, %rax	# 96	[c=4 l=4]  *ashldi3_1/0
+	addq	%rax, %rdx	# 97	[c=4 l=3]  *adddi_1/0
+	cmpq	%rdx, %rdi	# 98	[c=4 l=3]  *cmpdi_1/0
+	jne	.L7	# 99	[c=13 l=6]  *jcc
+	movzbl	11(%rdi), %eax	# 101	[c=13 l=4]  *zero_extendqisi2/0
+	cmpl	%esi, %eax	# 102	[c=4 l=2]  *cmpsi_1/0
+	jne	.L7	# 103	[c=13 l=6]  *jcc
+	cmpl	$15, (%r8)	# 107	[c=9 l=4]  *cmpsi_1/0
+	jg	.L1	# 108	[c=13 l=6]  *jcc
+	jmp	.L7	# 246	[c=1 l=5]  jump
+	.cfi_endproc
+.LFE20:
+	.size	delay_loop, .-delay_loop
+	.p2align 4
+	.type	host_getchar, @function
+host_getchar:
+.LFB206:
+	.cfi_startproc
+	movq	896(%rdi), %rdi	# 6	[c=9 l=7]  *movdi_internal/3
+	jmp	getc@PLT	# 8	[c=10 l=5]  *sibcall_value
+	.cfi_endproc
+.LFE206:
+	.size	host_getchar, .-host_getchar
+	.p2align 4
+	.type	flash_changed, @function
+flash_changed:
+.LFB88:
+	.cfi_startproc
+	pushq	%rbp	# 63	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rdi, %rbp	# 2	[c=4 l=3]  *movdi_internal/3
+	pushq	%rbx	# 64	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	movl	%edx, %ebx	# 4	[c=4 l=2]  *movsi_internal/0
+	subq	$8, %rsp	# 65	[c=4 l=4]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_def_cfa_offset 32
+	call	redecode_flash@PLT	# 11	[c=10 l=5]  *call_value
+	movl	$510, %edx	# 55	[c=4 l=5]  *movsi_internal/0
+	movl	992(%rbp), %ecx	# 61	[c=9 l=6]  *movsi_internal/0
+	cmpl	%edx, %eax	# 56	[c=4 l=2]  *cmpsi_1/0
+	cmovb	%edx, %eax	# 57	[c=8 l=3]  *movsicc_noc/1
+	shrl	%ebx	# 17	[c=4 l=2]  *lshrsi3_1/0
+	leal	1(%rcx), %edx	# 62	[c=4 l=3]  *leasi
+	movl	120(%rbp), %ecx	# 20	[c=9 l=3]  *movsi_internal/0
+	addl	$2, %ebx	# 18	[c=4 l=3]  *addsi_1/0
+	subl	$510, %eax	# 14	[c=4 l=5]  *addsi_1/0
+	cmpl	%ebx, %edx	# 58	[c=4 l=2]  *cmpsi_1/0
+	cmova	%ebx, %edx	# 59	[c=8 l=3]  *movsicc_noc/1
+	testl	%ecx, %ecx	# 21	[c=4 l=2]  *cmpsi_ccno_1/0
+	je	.L37	# 22	[c=13 l=2]  *jcc
+	movl	116(%rbp), %esi	# 50	[c=9 l=3]  *movsi_internal/0
+	cmpl	%esi, %eax	# 51	[c=4 l=2]  *cmpsi_1/0
+	cmova	%esi, %eax	# 52	[c=8 l=3]  *movsicc_noc/1
+	cmpl	%ecx, %edx	# 53	[c=4 l=2]  *cmpsi_1/0
+	cmovb	%ecx, %edx	# 54	[c=8 l=3]  *movsicc_noc/1
+.L37:
+	movl	%eax, 116(%rbp)	# 29	[c=4 l=3]  *movsi_internal/1
+	movl	584(%rbp), %eax	# 79	[c=9 l=6]  *movsi_internal/0
+	movl	%edx, 120(%rbp)	# 28	[c=4 l=3]  *movsi_internal/1
+	testl	%eax, %eax	# 80	[c=4 l=2]  *cmpsi_ccno_1/0
+	jne	.L43	# 31	[c=13 l=2]  *jcc
+	addq	$8, %rsp	# 68	[c=4 l=4]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx	# 69	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 16
+	popq	%rbp	# 70	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 8
+	ret		# 71	[c=0 l=1]  simple_return_internal
+	.p2align 4,,10
+	.p2align 3
+.L43:
+	.cfi_restore_state
+	addq	$8, %rsp	# 75	[c=4 l=4]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_def_cfa_offset 24
+	movq	%rbp, %rdi	# 33	[c=4 l=3]  *movdi_internal/3
+	popq	%rbx	# 76	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 16
+	popq	%rbp	# 77	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 8
+	jmp	hle_forget@PLT	# 34	[c=0 l=5]  *sibcall
+	.cfi_endproc
+.LFE88:
+	.size	flash_changed, .-flash_changed
+	.p2align 4
+	.type	fuse_stat_cmp, @function
+fuse_stat_cmp:
+.LFB17:
+	.cfi_startproc
+	movq	(%rdi), %rax	# 48	[c=5 l=3]  *movdi_internal/3
+	movq	(%rsi), %rdx	# 50	[c=5 l=3]  *movdi_internal/3
+	shrq	$32, %rax	# 9	[c=4 l=4]  *lshrdi3_1/0
+	shrq	$32, %rdx	# 12	[c=4 l=4]  *lshrdi3_1/0
+	cmpl	%edx, %eax	# 14	[c=4 l=2]  *cmpsi_1/0
+	je	.L45	# 15	[c=13 l=2]  *jcc
+	subl	%edx, %eax	# 17	[c=4 l=2]  *subsi_1/0
+	ret		# 45	[c=0 l=1]  simple_return_internal
+	.p2align 4,,10
+	.p2align 3
+.L45:
+	movq	16(%rdi), %rdx	# 22	[c=9 l=4]  *movdi_internal/3
+	movq	16(%rsi), %rcx	# 23	[c=9 l=4]  *movdi_internal/3
+	movl	$1, %eax	# 5	[c=4 l=5]  *movsi_internal/0
+	cmpq	%rcx, %rdx	# 24	[c=4 l=3]  *cmpdi_1/0
+	jb	.L44	# 25	[c=13 l=2]  *jcc
+	cmpq	%rdx, %rcx	# 27	[c=4 l=3]  *cmpdi_1/0
+	sbbl	%eax, %eax	# 30	[c=8 l=2]  *x86_movsicc_0_m1_neg
+.L44:
+	ret		# 54	[c=0 l=1]  simple_return_internal
+	.cfi_endproc
+.LFE17:
+	.size	fuse_stat_cmp, .-fuse_stat_cmp
+	.p2align 4
+	.type	fuse_window.part.0.constprop.0, @function
+fuse_window.part.0.constprop.0:
+.LFB234:
+	.cfi_startproc
+	movzbl	8(%rsi), %eax	# 21	[c=9 l=4]  *movqi_internal/4
+	movq	%rdi, %rcx	# 2	[c=4 l=3]  *movdi_internal/3
+	movb	%al, (%rdx)	# 22	[c=4 l=2]  *movqi_internal/8
+	cmpb	$25, %al	# 25	[c=4 l=2]  *cmpqi_1/0
+	jbe	.L80	# 26	[c=13 l=6]  *jcc
+	subl	$28, %eax	# 328	[c=4 l=3]  *addsi_1/0
+	cmpb	$60, %al	# 57	[c=4 l=2]  *cmpqi_1/0
+	ja	.L52	# 58	[c=13 l=2]  *jcc
+	movabsq	$2303723150795361347, %r8	# 319	[c=1 l=10]  *movdi_internal/4
+	movl	$1, %edi	# 10	[c=4 l=5]  *movsi_internal/0
+	btq	%rax, %r8	# 317	[c=4 l=4]  *btdi/0
+	jc	.L48	# 318	[c=13 l=6]  *jcc
+.L52:
+	movzbl	9(%rsi), %eax	# 61	[c=13 l=4]  zero_extendqidi2/0
+	salq	$4, %rax	# 62	[c=4 l=4]  *ashldi3_1/0
+	addq	%rax, %rsi	# 63	[c=4 l=3]  *adddi_1/0
+	movl	992(%rcx), %eax	# 64	[c=10 l=6]  *zero_extendsidi2/3
+	salq	$4, %rax	# 65	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rcx), %rax	# 67	[c=13 l=7]  *adddi_1/1
+	cmpq	%rsi, %rax	# 68	[c=4 l=3]  *cmpdi_1/0
+	jb	.L68	# 69	[c=13 l=6]  *jcc
+	cmpb	$0, 11(%rsi)	# 71	[c=13 l=4]  *cmpqi_ccno_1/1
+	je	.L68	# 72	[c=13 l=6]  *jcc
+	movzbl	8(%rsi), %eax	# 74	[c=9 l=4]  *movqi_internal/4
+	movb	%al, 1(%rdx)	# 75	[c=4 l=3]  *movqi_internal/8
+	cmpb	$25, %al	# 78	[c=4 l=2]  *cmpqi_1/0
+	jbe	.L81	# 79	[c=13 l=6]  *jcc
+	subl	$28, %eax	# 327	[c=4 l=3]  *addsi_1/0
+	cmpb	$60, %al	# 110	[c=4 l=2]  *cmpqi_1/0
+	ja	.L58	# 111	[c=13 l=2]  *jcc
+	movabsq	$2303723150795361347, %r8	# 321	[c=1 l=10]  *movdi_internal/4
+	movl	$2, %edi	# 11	[c=4 l=5]  *movsi_internal/0
+	btq	%rax, %r8	# 313	[c=4 l=4]  *btdi/0
+	jc	.L48	# 314	[c=13 l=6]  *jcc
+.L58:
+	movzbl	9(%rsi), %eax	# 114	[c=13 l=4]  zero_extendqidi2/0
+	salq	$4, %rax	# 115	[c=4 l=4]  *ashldi3_1/0
+	addq	%rax, %rsi	# 116	[c=4 l=3]  *adddi_1/0
+	movl	992(%rcx), %eax	# 117	[c=10 l=6]  *zero_extendsidi2/3
+	salq	$4, %rax	# 118	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rcx), %rax	# 120	[c=13 l=7]  *adddi_1/1
+	cmpq	%rsi, %rax	# 121	[c=4 l=3]  *cmpdi_1/0
+	jb	.L72	# 122	[c=13 l=6]  *jcc
+	cmpb	$0, 11(%rsi)	# 124	[c=13 l=4]  *cmpqi_ccno_1/1
+	je	.L72	# 125	[c=13 l=6]  *jcc
+	movzbl	8(%rsi), %eax	# 127	[c=9 l=4]  *movqi_internal/4
+	movb	%al, 2(%rdx)	# 128	[c=4 l=3]  *movqi_internal/8
+	cmpb	$25, %al	# 131	[c=4 l=2]  *cmpqi_1/0
+	jbe	.L82	# 132	[c=13 l=6]  *jcc
+	subl	$28, %eax	# 326	[c=4 l=3]  *addsi_1/0
+	cmpb	$60, %al	# 163	[c=4 l=2]  *cmpqi_1/0
+	ja	.L62	# 164	[c=13 l=2]  *jcc
+	movabsq	$2303723150795361347, %r8	# 323	[c=1 l=10]  *movdi_internal/4
+	movl	$3, %edi	# 8	[c=4 l=5]  *movsi_internal/0
+	btq	%rax, %r8	# 309	[c=4 l=4]  *btdi/0
+	jc	.L48	# 310	[c=13 l=2]  *jcc
+.L62:
+	movzbl	9(%rsi), %eax	# 167	[c=13 l=4]  zero_extendqidi2/0
+	salq	$4, %rax	# 168	[c=4 l=4]  *ashldi3_1/0
+	addq	%rax, %rsi	# 169	[c=4 l=3]  *adddi_1/0
+	movl	992(%rcx), %eax	# 170	[c=10 l=6]  *zero_extendsidi2/3
+	salq	$4, %rax	# 171	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rcx), %rax	# 173	[c=13 l=7]  *adddi_1/1
+	cmpq	%rsi, %rax	# 174	[c=4 l=3]  *cmpdi_1/0
+	jb	.L76	# 175	[c=13 l=6]  *jcc
+	cmpb	$0, 11(%rsi)	# 177	[c=13 l=4]  *cmpqi_ccno_1/1
+	je	.L76	# 178	[c=13 l=6]  *jcc
+	movzbl	8(%rsi), %eax	# 180	[c=9 l=4]  *movqi_internal/4
+	movl	$4, %edi	# 18	[c=4 l=5]  *movsi_internal/0
+	movb	%al, 3(%rdx)	# 181	[c=4 l=3]  *movqi_internal/8
+.L48:
+	movl	%edi, %eax	# 199	[c=4 l=2]  *movsi_internal/0
+	ret		# 331	[c=0 l=1]  simple_return_internal
+	.p2align 4,,10
+	.p2align 3
+.L80:
+	movl	$50651151, %r8d	# 320	[c=4 l=6]  *movdi_internal/2
+	movl	$1, %edi	# 7	[c=4 l=5]  *movsi_internal/0
+	btq	%rax, %r8	# 315	[c=4 l=4]  *btdi/0
+	jnc	.L52	# 316	[c=13 l=6]  *jcc
+	movl	%edi, %eax	# 343	[c=4 l=2]  *movsi_internal/0
+	ret		# 346	[c=0 l=1]  simple_return_internal
+	.p2align 4,,10
+	.p2align 3
+.L82:
+	movl	$50651151, %r8d	# 324	[c=4 l=6]  *movdi_internal/2
+	movl	$3, %edi	# 9	[c=4 l=5]  *movsi_internal/0
+	btq	%rax, %r8	# 307	[c=4 l=4]  *btdi/0
+	jnc	.L62	# 308	[c=13 l=2]  *jcc
+	jmp	.L48	# 362	[c=1 l=2]  jump
+	.p2align 4,,10
+	.p2align 3
+.L81:
+	movl	$50651151, %r8d	# 322	[c=4 l=6]  *movdi_internal/2
+	movl	$2, %edi	# 6	[c=4 l=5]  *movsi_internal/0
+	btq	%rax, %r8	# 311	[c=4 l=4]  *btdi/0
+	jnc	.L58	# 312	[c=13 l=6]  *jcc
+	movl	%edi, %eax	# 351	[c=4 l=2]  *movsi_internal/0
+	ret		# 354	[c=0 l=1]  simple_return_internal
+	.p2align 4,,10
+	.p2align 3
+.L68:
+	movl	$1, %edi	# 16	[c=4 l=5]  *movsi_internal/0
+	jmp	.L48	# 364	[c=1 l=2]  jump
+.L72:
+	movl	$2, %edi	# 17	[c=4 l=5]  *movsi_internal/0
+	jmp	.L48	# 366	[c=1 l=2]  jump
+.L76:
+	movl	$3, %edi	# 15	[c=4 l=5]  *movsi_internal/0
+	jmp	.L48	# 368	[c=1 l=5]  jump
+	.cfi_endproc
+.LFE234:
+	.size	fuse_window.part.0.constprop.0, .-fuse_window.part.0.constprop.0
+	.p2align 4
+	.type	fuse_lookup, @function
+fuse_lookup:
+.LFB14:
+	.cfi_startproc
+	pushq	%r15	# 92	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	xorl	%r15d, %r15d	# 118	[c=4 l=3]  *movdi_xor
+	pushq	%r14	# 93	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13	# 94	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12	# 95	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp	# 96	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx	# 97	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$24, %rsp	# 98	[c=4 l=4]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_def_cfa_offset 80
+	cmpb	$0, 11(%rsi)	# 12	[c=13 l=4]  *cmpqi_ccno_1/1
+	je	.L84	# 13	[c=13 l=2]  *jcc
+	leaq	12(%rsp), %rdx	# 91	[c=4 l=5]  *leadi
+	call	fuse_window.part.0.constprop.0	# 19	[c=10 l=5]  *call_value
+	movl	%eax, %r15d	# 20	[c=4 l=3]  *movsi_internal/0
+.L84:
+	leaq	4+fuse_seq(%rip), %rbx	# 23	[c=1 l=7]  *movdi_internal/4
+	xorl	%ebp, %ebp	# 117	[c=4 l=2]  *movdi_xor
+	movl	$-1, %r13d	# 7	[c=4 l=6]  *movsi_internal/0
+	leaq	12(%rsp), %r14	# 90	[c=4 l=5]  *leadi
+	jmp	.L86	# 125	[c=1 l=2]  jump
+	.p2align 4,,10
+	.p2align 3
+.L93:
+	movslq	%r13d, %rax	# 48	[c=4 l=3]  *extendsidi2_rex64/1
+	leaq	fuse_seq(%rip), %rcx	# 89	[c=1 l=7]  *movdi_internal/4
+	salq	$4, %rax	# 49	[c=4 l=4]  *ashldi3_1/0
+	cmpl	(%rcx,%rax), %r12d	# 76	[c=13 l=4]  *cmpsi_1/1
+	cmovg	%ebp, %r13d	# 77	[c=8 l=4]  *movsicc_noc/1
+	.p2align 4,,10
+	.p2align 3
+.L85:
+	addl	$1, %ebp	# 56	[c=4 l=3]  *addsi_1/0
+	addq	$16, %rbx	# 57	[c=4 l=4]  *adddi_1/0
+	cmpl	$41, %ebp	# 59	[c=4 l=3]  *cmpsi_1/0
+	je	.L92	# 60	[c=13 l=2]  *jcc
+.L86:
+	movl	-4(%rbx), %r12d	# 26	[c=9 l=4]  *movsi_internal/0
+	cmpl	%r15d, %r12d	# 27	[c=4 l=3]  *cmpsi_1/0
+	jg	.L85	# 28	[c=13 l=2]  *jcc
+	movslq	%r12d, %rdx	# 32	[c=4 l=3]  *extendsidi2_rex64/1
+	movq	%r14, %rsi	# 35	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rdi	# 36	[c=4 l=3]  *movdi_internal/3
+	call	memcmp@PLT	# 37	[c=10 l=5]  *call_value
+	testl	%eax, %eax	# 41	[c=4 l=2]  *cmpsi_ccno_1/0
+	jne	.L85	# 42	[c=13 l=2]  *jcc
+	cmpl	$-1, %r13d	# 44	[c=4 l=4]  *cmpsi_1/0
+	jne	.L93	# 45	[c=13 l=2]  *jcc
+	movl	%ebp, %r13d	# 9	[c=4 l=3]  *movsi_internal/0
+	addl	$1, %ebp	# 120	[c=4 l=3]  *addsi_1/0
+	addq	$16, %rbx	# 121	[c=4 l=4]  *adddi_1/0
+	cmpl	$41, %ebp	# 122	[c=4 l=3]  *cmpsi_1/0
+	jne	.L86	# 123	[c=13 l=2]  *jcc
+.L92:
+	addq	$24, %rsp	# 101	[c=4 l=4]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_def_cfa_offset 56
+	movl	%r13d, %eax	# 65	[c=4 l=3]  *movsi_internal/0
+	popq	%rbx	# 102	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 48
+	popq	%rbp	# 103	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 40
+	popq	%r12	# 104	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 32
+	popq	%r13	# 105	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 24
+	popq	%r14	# 106	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 16
+	popq	%r15	# 107	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 8
+	ret		# 108	[c=0 l=1]  simple_return_internal
+	.cfi_endproc
+.LFE14:
+	.size	fuse_lookup, .-fuse_lookup
+	.p2align 4
+	.globl	qprintf
+	.type	qprintf, @function
+qprintf:
+.LFB23:
+	.cfi_startproc
+	subq	$216, %rsp	# 50	[c=4 l=7]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_def_cfa_offset 224
+	movq	%rdx, 48(%rsp)	# 4	[c=4 l=5]  *movdi_internal/5
+	movq	%rcx, 56(%rsp)	# 5	[c=4 l=5]  *movdi_internal/5
+	movq	%r8, 64(%rsp)	# 6	[c=4 l=5]  *movdi_internal/5
+	movq	%r9, 72(%rsp)	# 7	[c=4 l=5]  *movdi_internal/5
+	testb	%al, %al	# 8	[c=4 l=2]  *cmpqi_ccno_1/0
+	je	.L97	# 9	[c=13 l=2]  *jcc
+	movaps	%xmm0, 80(%rsp)	# 10	[c=4 l=5]  movv4sf_internal/3
+	movaps	%xmm1, 96(%rsp)	# 11	[c=4 l=5]  movv4sf_internal/3
+	movaps	%xmm2, 112(%rsp)	# 12	[c=4 l=5]  movv4sf_internal/3
+	movaps	%xmm3, 128(%rsp)	# 13	[c=4 l=8]  movv4sf_internal/3
+	movaps	%xmm4, 144(%rsp)	# 14	[c=4 l=8]  movv4sf_internal/3
+	movaps	%xmm5, 160(%rsp)	# 15	[c=4 l=8]  movv4sf_internal/3
+	movaps	%xmm6, 176(%rsp)	# 16	[c=4 l=8]  movv4sf_internal/3
+	movaps	%xmm7, 192(%rsp)	# 17	[c=4 l=8]  movv4sf_internal/3
+.L97:
+	movl	216(%rdi), %eax	# 58	[c=9 l=6]  *movsi_internal/0
+	testl	%eax, %eax	# 59	[c=4 l=2]  *cmpsi_ccno_1/0
+	je	.L99	# 23	[c=13 l=2]  *jcc
+	addq	$216, %rsp	# 53	[c=4 l=7]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_remember_state
+	.cfi_def_cfa_offset 8
+	ret		# 54	[c=0 l=1]  simple_return_internal
+	.p2align 4,,10
+	.p2align 3
+.L99:
+	.cfi_restore_state
+	leaq	224(%rsp), %rax	# 47	[c=4 l=8]  *leadi
+	movq	904(%rdi), %rdi	# 31	[c=9 l=7]  *movdi_internal/3
+	leaq	8(%rsp), %rdx	# 49	[c=4 l=5]  *leadi
+	movl	$16, 8(%rsp)	# 26	[c=4 l=8]  *movsi_internal/1
+	movq	%rax, 16(%rsp)	# 28	[c=4 l=5]  *movdi_internal/5
+	leaq	32(%rsp), %rax	# 48	[c=4 l=5]  *leadi
+	movl	$48, 12(%rsp)	# 27	[c=4 l=8]  *movsi_internal/1
+	movq	%rax, 24(%rsp)	# 29	[c=4 l=5]  *movdi_internal/5
+	call	vfprintf@PLT	# 35	[c=10 l=5]  *call_value
+	addq	$216, %rsp	# 62	[c=4 l=7]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_def_cfa_offset 8
+	ret		# 63	[c=0 l=1]  simple_return_internal
+	.cfi_endproc
+.LFE23:
+	.size	qprintf, .-qprintf
+	.p2align 4
+	.globl	quit
+	.type	quit, @function
+quit:
+.LFB27:
+	.cfi_startproc
+	subq	$8, %rsp	# 18	[c=4 l=4]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_def_cfa_offset 16
+	movl	%esi, 136(%rdi)	# 7	[c=4 l=6]  *movsi_internal/1
+	movl	$1, %esi	# 9	[c=4 l=5]  *movsi_internal/0
+	movq	128(%rdi), %rdi	# 8	[c=9 l=7]  *movdi_internal/3
+	call	longjmp@PLT	# 11	[c=0 l=5]  *call
+	.cfi_endproc
+.LFE27:
+	.size	quit, .-quit
+	.section	.rodata.str1.1,"aMS",@progbits,1
+.LC0:
+	.string	"ABORTED"
+.LC1:
+	.string	"w"
+.LC2:
+	.string	"%s: cannot write -status=%s\n"
+.LC3:
+	.string	"%d %lu %lu %s\n"
+	.text
+	.p2align 4
+	.type	finish, @function
+finish:
+.LFB28:
+	.cfi_startproc
+	pushq	%r12	# 117	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	pushq	%rbp	# 118	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	movl	%esi, %ebp	# 3	[c=4 l=2]  *movsi_internal/0
+	pushq	%rbx	# 119	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	movl	440(%rdi), %esi	# 132	[c=9 l=6]  *movsi_internal/0
+	movq	%rdi, %rbx	# 2	[c=4 l=3]  *movdi_internal/3
+	testl	%esi, %esi	# 133	[c=4 l=2]  *cmpsi_ccno_1/0
+	jne	.L114	# 10	[c=13 l=2]  *jcc
+.L103:
+	movq	11016(%rbx), %rax	# 62	[c=9 l=7]  *movdi_internal/3
+	testq	%rax, %rax	# 63	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L106	# 64	[c=13 l=2]  *jcc
+	movdqu	40(%rbx), %xmm0	# 114	[c=13 l=5]  movv2di_internal/2
+	movl	76(%rbx), %ecx	# 128	[c=9 l=3]  *movsi_internal/0
+	movl	%ebp, (%rax)	# 66	[c=4 l=2]  *movsi_internal/1
+	leaq	.LC0(%rip), %rdx	# 6	[c=1 l=7]  *movdi_internal/4
+	shufpd	$1, %xmm0, %xmm0	# 70	[c=4 l=5]  sse2_shufpd_v2di/0
+	movups	%xmm0, 8(%rax)	# 71	[c=4 l=4]  movv2di_internal/3
+	testl	%ecx, %ecx	# 129	[c=4 l=2]  *cmpsi_ccno_1/0
+	je	.L115	# 73	[c=13 l=2]  *jcc
+.L107:
+	movq	%rdx, 24(%rax)	# 83	[c=4 l=4]  *movdi_internal/5
+.L106:
+	movl	%ebp, %esi	# 86	[c=4 l=2]  *movsi_internal/0
+	movq	%rbx, %rdi	# 87	[c=4 l=3]  *movdi_internal/3
+	call	quit	# 88	[c=0 l=5]  *call
+.L115:
+	movslq	72(%rbx), %rdx	# 77	[c=13 l=4]  *extendsidi2_rex64/1
+	leaq	exit_status(%rip), %rcx	# 112	[c=1 l=7]  *movdi_internal/4
+	imulq	$24, %rdx, %rdx	# 78	[c=16 l=4]  *muldi3_1/0
+	movq	(%rcx,%rdx), %rdx	# 80	[c=9 l=4]  *movdi_internal/3
+	jmp	.L107	# 136	[c=1 l=2]  jump
+.L114:
+	movq	448(%rdi), %rdi	# 12	[c=9 l=7]  *movdi_internal/3
+	leaq	.LC1(%rip), %rsi	# 13	[c=1 l=7]  *movdi_internal/4
+	call	fopen@PLT	# 16	[c=10 l=5]  *call_value
+	movq	%rax, %r12	# 17	[c=4 l=3]  *movdi_internal/3
+	testq	%rax, %rax	# 19	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L116	# 20	[c=13 l=2]  *jcc
+	cmpl	$0, 76(%rbx)	# 36	[c=13 l=4]  *cmpsi_ccno_1/1
+	leaq	.LC0(%rip), %r9	# 5	[c=1 l=7]  *movdi_internal/4
+	je	.L117	# 37	[c=13 l=2]  *jcc
+.L105:
+	movq	48(%rbx), %rcx	# 48	[c=9 l=4]  *movdi_internal/3
+	movq	40(%rbx), %r8	# 50	[c=9 l=4]  *movdi_internal/3
+	movq	%r12, %rdi	# 55	[c=4 l=3]  *movdi_internal/3
+	movl	%ebp, %edx	# 52	[c=4 l=2]  *movsi_internal/0
+	leaq	.LC3(%rip), %rsi	# 53	[c=1 l=7]  *movdi_internal/4
+	xorl	%eax, %eax	# 130	[c=4 l=2]  *movdi_xor
+	call	fprintf@PLT	# 57	[c=10 l=5]  *call_value
+	movq	%r12, %rdi	# 58	[c=4 l=3]  *movdi_internal/3
+	call	fclose@PLT	# 59	[c=10 l=5]  *call_value
+	jmp	.L103	# 140	[c=1 l=5]  jump
+.L117:
+	movslq	72(%rbx), %rax	# 41	[c=13 l=4]  *extendsidi2_rex64/1
+	leaq	exit_status(%rip), %rdx	# 111	[c=1 l=7]  *movdi_internal/4
+	imulq	$24, %rax, %rax	# 42	[c=16 l=4]  *muldi3_1/0
+	movq	(%rdx,%rax), %r9	# 44	[c=9 l=4]  *movdi_internal/3
+	jmp	.L105	# 142	[c=1 l=2]  jump
+.L116:
+	movq	448(%rbx), %rcx	# 22	[c=9 l=7]  *movdi_internal/3
+	movq	144(%rbx), %rdx	# 23	[c=9 l=7]  *movdi_internal/3
+	leaq	.LC2(%rip), %rsi	# 27	[c=1 l=7]  *movdi_internal/4
+	xorl	%eax, %eax	# 131	[c=4 l=2]  *movdi_xor
+	movq	912(%rbx), %rdi	# 24	[c=9 l=7]  *movdi_internal/3
+	call	fprintf@PLT	# 31	[c=10 l=5]  *call_value
+	jmp	.L103	# 144	[c=1 l=5]  jump
+	.cfi_endproc
+.LFE28:
+	.size	finish, .-finish
+	.p2align 4
+	.globl	set_elf_string_table
+	.type	set_elf_string_table, @function
+set_elf_string_table:
+.LFB57:
+	.cfi_startproc
+	pushq	%rbx	# 26	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	movq	%rdi, %rbx	# 2	[c=4 l=3]  *movdi_internal/3
+	movq	%rsi, 5216(%rdi)	# 9	[c=4 l=7]  *movdi_internal/5
+	movq	%rdx, 5224(%rdi)	# 10	[c=4 l=7]  *movdi_internal/5
+	call	checkpoint_string_table@PLT	# 15	[c=0 l=5]  *call
+	movq	%rbx, %rdi	# 16	[c=4 l=3]  *movdi_internal/3
+	popq	%rbx	# 33	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 8
+	jmp	hle_set_string_table@PLT	# 17	[c=0 l=5]  *sibcall
+	.cfi_endproc
+.LFE57:
+	.size	set_elf_string_table, .-set_elf_string_table
+	.p2align 4
+	.globl	finish_elf_string_table
+	.type	finish_elf_string_table, @function
+finish_elf_string_table:
+.LFB58:
+	.cfi_startproc
+	ret		# 11	[c=0 l=1]  simple_return_internal
+	.cfi_endproc
+.LFE58:
+	.size	finish_elf_string_table, .-finish_elf_string_table
+	.p2align 4
+	.globl	set_elf_function_symbol
+	.type	set_elf_function_symbol, @function
+set_elf_function_symbol:
+.LFB59:
+	.cfi_startproc
+	pushq	%r12	# 32	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	movzbl	%cl, %ecx	# 10	[c=4 l=3]  *zero_extendqisi2/0
+	movq	%rdx, %r12	# 4	[c=4 l=3]  *movdi_internal/3
+	pushq	%rbp	# 33	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	movl	%esi, %ebp	# 3	[c=4 l=2]  *movsi_internal/0
+	pushq	%rbx	# 34	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	movq	%rdi, %rbx	# 2	[c=4 l=3]  *movdi_internal/3
+	call	checkpoint_symbol@PLT	# 15	[c=0 l=5]  *call
+	movq	%r12, %rdx	# 16	[c=4 l=3]  *movdi_internal/3
+	movl	%ebp, %esi	# 17	[c=4 l=2]  *movsi_internal/0
+	movq	%rbx, %rdi	# 18	[c=4 l=3]  *movdi_internal/3
+	call	fork_server_set_function_symbol@PLT	# 19	[c=0 l=5]  *call
+	movq	%r12, %rdx	# 20	[c=4 l=3]  *movdi_internal/3
+	movl	%ebp, %esi	# 21	[c=4 l=2]  *movsi_internal/0
+	movq	%rbx, %rdi	# 22	[c=4 l=3]  *movdi_internal/3
+	popq	%rbx	# 43	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 24
+	popq	%rbp	# 44	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 16
+	popq	%r12	# 45	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 8
+	jmp	hle_set_function_symbol@PLT	# 23	[c=0 l=5]  *sibcall
+	.cfi_endproc
+.LFE59:
+	.size	set_elf_function_symbol, .-set_elf_function_symbol
+	.section	.rodata.str1.8,"aMS",@progbits,1
+	.align 8
+.LC4:
+	.string	"out of memory allocating %u * %u bytes for %s"
+	.text
+	.p2align 4
+	.globl	get_mem
+	.type	get_mem, @function
+get_mem:
+.LFB62:
+	.cfi_startproc
+	pushq	%r13	# 87	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 16
+	.cfi_offset 13, -16
+	movl	%esi, %esi	# 3	[c=1 l=2]  *zero_extendsidi2/3
+	movq	%rdx, %r13	# 4	[c=4 l=3]  *movdi_internal/3
+	pushq	%r12	# 88	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 24
+	.cfi_offset 12, -24
+	movq	%rdi, %r12	# 2	[c=4 l=3]  *movdi_internal/3
+	pushq	%rbp	# 89	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 32
+	.cfi_offset 6, -32
+	movq	%rcx, %rbp	# 5	[c=4 l=3]  *movdi_internal/3
+	pushq	%rbx	# 90	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 40
+	.cfi_offset 3, -40
+	movq	%rsi, %rbx	# 86	[c=4 l=3]  *movdi_internal/3
+	subq	$8, %rsp	# 91	[c=4 l=4]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_def_cfa_offset 48
+	testq	%rdx, %rdx	# 10	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L124	# 11	[c=13 l=2]  *jcc
+	movq	$-33, %rax	# 13	[c=4 l=7]  *movdi_internal/3
+	xorl	%edx, %edx	# 104	[c=4 l=2]  *movdi_xor
+	divq	%r13	# 84	[c=0 l=3]  *udivmoddi4_noext
+	cmpq	%rsi, %rax	# 15	[c=4 l=3]  *cmpdi_1/0
+	jb	.L125	# 16	[c=13 l=2]  *jcc
+.L124:
+	imulq	%r13, %rsi	# 30	[c=16 l=4]  *muldi3_1/2
+	movl	$1, %edi	# 33	[c=4 l=5]  *movdi_internal/2
+	addq	$32, %rsi	# 31	[c=4 l=4]  *adddi_1/0
+	call	calloc@PLT	# 34	[c=10 l=5]  *call_value
+	testq	%rax, %rax	# 38	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L125	# 39	[c=13 l=2]  *jcc
+	movq	984(%r12), %rdx	# 42	[c=9 l=8]  *movdi_internal/3
+	movq	$0, 8(%rax)	# 41	[c=4 l=8]  *movdi_internal/5
+	movq	%rdx, (%rax)	# 43	[c=4 l=3]  *movdi_internal/5
+	testq	%rdx, %rdx	# 44	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L126	# 45	[c=13 l=2]  *jcc
+	movq	%rax, 8(%rdx)	# 47	[c=4 l=4]  *movdi_internal/5
+.L126:
+	movq	%rax, 984(%r12)	# 50	[c=4 l=8]  *movdi_internal/5
+	addq	$8, %rsp	# 94	[c=4 l=4]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	addq	$32, %rax	# 51	[c=4 l=4]  *adddi_1/0
+	popq	%rbx	# 95	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 32
+	popq	%rbp	# 96	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 24
+	popq	%r12	# 97	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 16
+	popq	%r13	# 98	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 8
+	ret		# 99	[c=0 l=1]  simple_return_internal
+.L125:
+	.cfi_restore_state
+	movq	%rbp, %r9	# 18	[c=4 l=3]  *movdi_internal/3
+	movl	%r13d, %r8d	# 19	[c=4 l=3]  *movsi_internal/0
+	movl	%ebx, %ecx	# 20	[c=4 l=2]  *movsi_internal/0
+	movl	$6, %esi	# 23	[c=4 l=5]  *movsi_internal/0
+	leaq	.LC4(%rip), %rdx	# 21	[c=1 l=7]  *movdi_internal/4
+	movq	%r12, %rdi	# 24	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 103	[c=4 l=2]  *movdi_xor
+	call	leave	# 26	[c=0 l=5]  *call
+	.cfi_endproc
+.LFE62:
+	.size	get_mem, .-get_mem
+	.section	.rodata.str1.1
+.LC6:
+	.string	"instructions"
+.LC7:
+	.string	"executed"
+.LC8:
+	.string	"sites"
+.LC9:
+	.string	"superinstruction"
+.LC10:
+	.string	"%-44s %9s %12s  %12s\n"
+.LC12:
+	.string	"%-44s %9u %12lu  %11.2f%%\n"
+.LC13:
+	.string	"-fuse-stats"
+.LC14:
+	.string	"most executed sequence"
+.LC15:
+	.string	"\n%-44s %9s %12s  %12s\n"
+	.text
+	.p2align 4
+	.type	print_fuse_stats, @function
+print_fuse_stats:
+.LFB19:
+	.cfi_startproc
+	pushq	%r15	# 1122	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	xorl	%eax, %eax	# 1166	[c=4 l=2]  *movdi_xor
+	movq	%rdi, %r15	# 2	[c=4 l=3]  *movdi_internal/3
+	movl	$20, %ecx	# 35	[c=4 l=5]  *movdi_internal/2
+	pushq	%r14	# 1123	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13	# 1124	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12	# 1125	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp	# 1126	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx	# 1127	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$664, %rsp	# 1128	[c=4 l=7]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_def_cfa_offset 720
+	leaq	144(%rsp), %r14	# 1117	[c=4 l=8]  *leadi
+	leaq	320(%rsp), %rbp	# 1118	[c=4 l=8]  *leadi
+	movq	%r14, %rdi	# 1032	[c=4 l=3]  *movdi_internal/3
+	rep stosq	# 36	[c=0 l=3]  *rep_stosdi_rex64
+	movl	$41, %ecx	# 41	[c=4 l=5]  *movdi_internal/2
+	movl	$0, (%rdi)	# 37	[c=4 l=6]  *movsi_internal/1
+	movq	%rbp, %rdi	# 1034	[c=4 l=3]  *movdi_internal/3
+	rep stosq	# 42	[c=0 l=3]  *rep_stosdi_rex64
+	movq	10984(%r15), %rax	# 43	[c=9 l=7]  *movdi_internal/3
+	testq	%rax, %rax	# 44	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L137	# 45	[c=13 l=6]  *jcc
+	movl	992(%r15), %ebx	# 47	[c=9 l=7]  *movsi_internal/0
+	movq	1064(%r15), %r11	# 48	[c=9 l=7]  *movdi_internal/3
+	movq	%r15, 32(%rsp)	# 885	[c=4 l=5]  *movdi_internal/5
+	xorl	%r9d, %r9d	# 1165	[c=4 l=3]  *movdi_xor
+	movq	%rbp, 48(%rsp)	# 886	[c=4 l=5]  *movdi_internal/5
+	movl	%ebx, (%rsp)	# 1035	[c=4 l=3]  *movsi_internal/1
+	movq	%r14, 56(%rsp)	# 887	[c=4 l=5]  *movdi_internal/5
+	movq	%rax, 40(%rsp)	# 882	[c=4 l=5]  *movdi_internal/5
+	movq	%r11, %rax	# 883	[c=4 l=3]  *movdi_internal/3
+	movl	%r9d, %r11d	# 884	[c=4 l=3]  *movsi_internal/0
+	movq	%rax, %r9	# 888	[c=4 l=3]  *movdi_internal/3
+	.p2align 4,,10
+	.p2align 3
+.L148:
+	movl	%r11d, %r10d	# 50	[c=1 l=3]  *zero_extendsidi2/3
+	movq	%r10, %rsi	# 1036	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rsi	# 51	[c=4 l=4]  *ashldi3_1/0
+	addq	%r9, %rsi	# 52	[c=4 l=3]  *adddi_1/0
+	cmpb	$0, 11(%rsi)	# 53	[c=13 l=4]  *cmpqi_ccno_1/1
+	je	.L140	# 54	[c=13 l=6]  *jcc
+	movzbl	8(%rsi), %eax	# 60	[c=9 l=4]  *movqi_internal/4
+	cmpb	$25, %al	# 63	[c=4 l=2]  *cmpqi_1/0
+	jbe	.L239	# 64	[c=13 l=6]  *jcc
+	subl	$28, %eax	# 1116	[c=4 l=3]  *addsi_1/0
+	cmpb	$60, %al	# 95	[c=4 l=2]  *cmpqi_1/0
+	ja	.L143	# 96	[c=13 l=2]  *jcc
+	movabsq	$2303723150795361347, %rdi	# 1038	[c=1 l=10]  *movdi_internal/4
+	btq	%rax, %rdi	# 878	[c=4 l=4]  *btdi/0
+	jc	.L140	# 879	[c=13 l=6]  *jcc
+.L143:
+	movq	32(%rsp), %rdi	# 102	[c=9 l=5]  *movdi_internal/3
+	leaq	64(%rsp), %r14	# 99	[c=4 l=5]  *leadi
+	xorl	%r13d, %r13d	# 1164	[c=4 l=3]  *movdi_xor
+	leaq	4+fuse_seq(%rip), %r15	# 105	[c=1 l=7]  *movdi_internal/4
+	movq	%r14, %rdx	# 100	[c=4 l=3]  *movdi_internal/3
+	movl	%r13d, %ebp	# 891	[c=4 l=3]  *movsi_internal/0
+	movl	$-1, %r12d	# 5	[c=4 l=6]  *movsi_internal/0
+	movq	%r15, %r13	# 895	[c=4 l=3]  *movdi_internal/3
+	call	fuse_window.part.0.constprop.0	# 103	[c=10 l=5]  *call_value
+	movq	%r10, 8(%rsp)	# 889	[c=4 l=5]  *movdi_internal/5
+	movl	%r11d, 16(%rsp)	# 890	[c=4 l=5]  *movsi_internal/1
+	movl	%eax, %ebx	# 104	[c=4 l=2]  *movsi_internal/0
+	movq	%r9, 24(%rsp)	# 894	[c=4 l=5]  *movdi_internal/5
+	jmp	.L146	# 1187	[c=1 l=2]  jump
+	.p2align 4,,10
+	.p2align 3
+.L241:
+	movslq	%r12d, %rax	# 130	[c=4 l=3]  *extendsidi2_rex64/1
+	leaq	fuse_seq(%rip), %rdi	# 1039	[c=1 l=7]  *movdi_internal/4
+	salq	$4, %rax	# 131	[c=4 l=4]  *ashldi3_1/0
+	cmpl	(%rdi,%rax), %r15d	# 754	[c=13 l=4]  *cmpsi_1/1
+	cmovg	%ebp, %r12d	# 755	[c=8 l=4]  *movsicc_noc/1
+	.p2align 4,,10
+	.p2align 3
+.L145:
+	addl	$1, %ebp	# 138	[c=4 l=3]  *addsi_1/0
+	addq	$16, %r13	# 139	[c=4 l=4]  *adddi_1/0
+	cmpl	$41, %ebp	# 141	[c=4 l=3]  *cmpsi_1/0
+	je	.L240	# 142	[c=13 l=2]  *jcc
+.L146:
+	movl	-4(%r13), %r15d	# 108	[c=9 l=4]  *movsi_internal/0
+	cmpl	%r15d, %ebx	# 109	[c=4 l=3]  *cmpsi_1/0
+	jl	.L145	# 110	[c=13 l=2]  *jcc
+	movslq	%r15d, %rdx	# 114	[c=4 l=3]  *extendsidi2_rex64/1
+	movq	%r14, %rsi	# 117	[c=4 l=3]  *movdi_internal/3
+	movq	%r13, %rdi	# 118	[c=4 l=3]  *movdi_internal/3
+	call	memcmp@PLT	# 119	[c=10 l=5]  *call_value
+	testl	%eax, %eax	# 123	[c=4 l=2]  *cmpsi_ccno_1/0
+	jne	.L145	# 124	[c=13 l=2]  *jcc
+	cmpl	$-1, %r12d	# 126	[c=4 l=4]  *cmpsi_1/0
+	jne	.L241	# 127	[c=13 l=2]  *jcc
+	movl	%ebp, %r12d	# 7	[c=4 l=3]  *movsi_internal/0
+	addl	$1, %ebp	# 1171	[c=4 l=3]  *addsi_1/0
+	addq	$16, %r13	# 1172	[c=4 l=4]  *adddi_1/0
+	cmpl	$41, %ebp	# 1173	[c=4 l=3]  *cmpsi_1/0
+	jne	.L146	# 1174	[c=13 l=2]  *jcc
+.L240:
+	movq	8(%rsp), %r10	# 897	[c=9 l=5]  *movdi_internal/3
+	movl	16(%rsp), %r11d	# 898	[c=9 l=5]  *movsi_internal/0
+	movq	24(%rsp), %r9	# 900	[c=9 l=5]  *movdi_internal/3
+	cmpl	$-1, %r12d	# 145	[c=4 l=4]  *cmpsi_1/0
+	je	.L140	# 146	[c=13 l=2]  *jcc
+	movq	40(%rsp), %rax	# 1040	[c=9 l=5]  *movdi_internal/3
+	movslq	%r12d, %rsi	# 148	[c=4 l=3]  *extendsidi2_rex64/1
+	addl	$1, 144(%rsp,%rsi,4)	# 155	[c=14 l=8]  *addsi_1/0
+	movq	(%rax,%r10,8), %rax	# 164	[c=10 l=4]  *movdi_internal/3
+	addq	%rax, 320(%rsp,%rsi,8)	# 165	[c=14 l=8]  *adddi_1/0
+.L140:
+	addl	$1, %r11d	# 168	[c=4 l=4]  *addsi_1/0
+	cmpl	%r11d, (%rsp)	# 170	[c=9 l=4]  *cmpsi_1/0
+	jnb	.L148	# 171	[c=13 l=6]  *jcc
+.L245:
+	movq	32(%rsp), %r15	# 901	[c=9 l=5]  *movdi_internal/3
+	leaq	.LC6(%rip), %r9	# 174	[c=1 l=7]  *movdi_internal/4
+	xorl	%eax, %eax	# 1162	[c=4 l=2]  *movdi_xor
+	xorl	%ebx, %ebx	# 1163	[c=4 l=2]  *movdi_xor
+	leaq	.LC7(%rip), %r8	# 175	[c=1 l=7]  *movdi_internal/4
+	leaq	.LC8(%rip), %rcx	# 177	[c=1 l=7]  *movdi_internal/4
+	movq	48(%rsp), %rbp	# 902	[c=9 l=5]  *movdi_internal/3
+	movq	56(%rsp), %r14	# 903	[c=9 l=5]  *movdi_internal/3
+	movq	904(%r15), %rdi	# 173	[c=9 l=7]  *movdi_internal/3
+	leaq	.LC9(%rip), %rdx	# 178	[c=1 l=7]  *movdi_internal/4
+	leaq	.LC10(%rip), %rsi	# 180	[c=1 l=7]  *movdi_internal/4
+	leaq	fuse_seq(%rip), %r13	# 717	[c=1 l=7]  *movdi_internal/4
+	leaq	.LC12(%rip), %r12	# 239	[c=1 l=7]  *movdi_internal/4
+	call	fprintf@PLT	# 184	[c=10 l=5]  *call_value
+	jmp	.L155	# 1191	[c=1 l=2]  jump
+.L243:
+	pxor	%xmm1, %xmm1	# 1246	[c=4 l=4]  movv2df_internal/0
+	cvtsi2sdq	%r8, %xmm1	# 1247	[c=4 l=5]  sse2_cvtsi2sdq/0
+	mulsd	%xmm1, %xmm0	# 215	[c=20 l=4]  *fop_df_comm/1
+	testq	%rax, %rax	# 218	[c=4 l=3]  *cmpdi_ccno_1/0
+	js	.L153	# 219	[c=13 l=6]  *jcc
+.L244:
+	pxor	%xmm1, %xmm1	# 1244	[c=4 l=4]  movv2df_internal/0
+	cvtsi2sdq	%rax, %xmm1	# 1245	[c=4 l=5]  sse2_cvtsi2sdq/0
+.L154:
+	divsd	%xmm1, %xmm0	# 230	[c=68 l=4]  *fop_df_1/2
+.L150:
+	movq	8(%r13), %rdx	# 233	[c=9 l=4]  *movdi_internal/3
+	movq	904(%r15), %rdi	# 234	[c=9 l=7]  *movdi_internal/3
+	movq	%r12, %rsi	# 240	[c=4 l=3]  *movdi_internal/3
+	movl	$1, %eax	# 242	[c=4 l=5]  *movqi_internal/3
+	call	fprintf@PLT	# 243	[c=10 l=5]  *call_value
+.L149:
+	addq	$1, %rbx	# 246	[c=4 l=4]  *adddi_1/0
+	addq	$16, %r13	# 247	[c=4 l=4]  *adddi_1/0
+	cmpq	$41, %rbx	# 249	[c=4 l=4]  *cmpdi_1/0
+	je	.L242	# 250	[c=13 l=6]  *jcc
+.L155:
+	movl	(%r14,%rbx,4), %ecx	# 188	[c=10 l=4]  *movsi_internal/0
+	testl	%ecx, %ecx	# 189	[c=4 l=2]  *cmpsi_ccno_1/0
+	je	.L149	# 190	[c=13 l=2]  *jcc
+	movq	40(%r15), %rax	# 192	[c=9 l=4]  *movdi_internal/3
+	movq	0(%rbp,%rbx,8), %r8	# 194	[c=10 l=5]  *movdi_internal/3
+	pxor	%xmm0, %xmm0	# 786	[c=4 l=4]  *movdf_internal/12
+	testq	%rax, %rax	# 195	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L150	# 196	[c=13 l=2]  *jcc
+	pxor	%xmm0, %xmm0	# 1242	[c=4 l=4]  movv2df_internal/0
+	cvtsi2sdl	0(%r13), %xmm0	# 1243	[c=4 l=6]  sse2_cvtsi2sd/1
+	mulsd	.LC11(%rip), %xmm0	# 200	[c=26 l=8]  *fop_df_comm/1
+	testq	%r8, %r8	# 203	[c=4 l=3]  *cmpdi_ccno_1/0
+	jns	.L243	# 204	[c=13 l=2]  *jcc
+	movq	%r8, %rdx	# 1042	[c=4 l=3]  *movdi_internal/3
+	movq	%r8, %rsi	# 1044	[c=4 l=3]  *movdi_internal/3
+	pxor	%xmm1, %xmm1	# 1240	[c=4 l=4]  movv2df_internal/0
+	shrq	%rdx	# 209	[c=4 l=3]  *lshrdi3_1/0
+	andl	$1, %esi	# 210	[c=4 l=3]  *anddi_1/0
+	orq	%rsi, %rdx	# 211	[c=4 l=3]  *iordi_1/0
+	cvtsi2sdq	%rdx, %xmm1	# 1241	[c=4 l=5]  sse2_cvtsi2sdq/0
+	addsd	%xmm1, %xmm1	# 213	[c=12 l=4]  *fop_df_comm/1
+	mulsd	%xmm1, %xmm0	# 1177	[c=20 l=4]  *fop_df_comm/1
+	testq	%rax, %rax	# 1178	[c=4 l=3]  *cmpdi_ccno_1/0
+	jns	.L244	# 1179	[c=13 l=6]  *jcc
+.L153:
+	movq	%rax, %rdx	# 1046	[c=4 l=3]  *movdi_internal/3
+	andl	$1, %eax	# 225	[c=4 l=3]  *anddi_1/0
+	pxor	%xmm1, %xmm1	# 1238	[c=4 l=4]  movv2df_internal/0
+	shrq	%rdx	# 224	[c=4 l=3]  *lshrdi3_1/0
+	orq	%rax, %rdx	# 226	[c=4 l=3]  *iordi_1/0
+	cvtsi2sdq	%rdx, %xmm1	# 1239	[c=4 l=5]  sse2_cvtsi2sdq/0
+	addsd	%xmm1, %xmm1	# 228	[c=12 l=4]  *fop_df_comm/1
+	jmp	.L154	# 1196	[c=1 l=5]  jump
+.L239:
+	movl	$50651151, %edx	# 880	[c=4 l=5]  *movdi_internal/2
+	btq	%rax, %rdx	# 876	[c=4 l=4]  *btdi/0
+	jnc	.L143	# 877	[c=13 l=6]  *jcc
+	addl	$1, %r11d	# 1182	[c=4 l=4]  *addsi_1/0
+	cmpl	%r11d, (%rsp)	# 1183	[c=9 l=4]  *cmpsi_1/0
+	jnb	.L148	# 1184	[c=13 l=6]  *jcc
+	jmp	.L245	# 1200	[c=1 l=5]  jump
+.L242:
+	movl	992(%r15), %ebx	# 252	[c=9 l=7]  *movsi_internal/0
+	movq	10984(%r15), %rbp	# 253	[c=9 l=7]  *movdi_internal/3
+	xorl	%edx, %edx	# 1160	[c=4 l=2]  *movdi_xor
+	xorl	%eax, %eax	# 1161	[c=4 l=2]  *movdi_xor
+	.p2align 4,,10
+	.p2align 3
+.L156:
+	movl	%eax, %ecx	# 255	[c=1 l=2]  *zero_extendsidi2/3
+	cmpq	$1, 0(%rbp,%rcx,8)	# 874	[c=14 l=6]  *cmpdi_1/0
+	sbbl	$-1, %edx	# 875	[c=4 l=3]  subsi3_carry/0
+	addl	$1, %eax	# 260	[c=4 l=3]  *addsi_1/0
+	cmpl	%eax, %ebx	# 262	[c=4 l=2]  *cmpsi_1/0
+	jnb	.L156	# 263	[c=13 l=2]  *jcc
+	leal	(%rdx,%rdx,2), %eax	# 267	[c=8 l=3]  *leasi
+	addl	%eax, %eax	# 268	[c=4 l=2]  *ashlsi3_1/0
+	cmpl	$16, %eax	# 273	[c=4 l=3]  *cmpsi_1/0
+	jbe	.L191	# 274	[c=13 l=6]  *jcc
+	movl	$16, %edx	# 13	[c=4 l=5]  *movsi_internal/0
+	.p2align 4,,10
+	.p2align 3
+.L158:
+	addl	%edx, %edx	# 276	[c=4 l=2]  *ashlsi3_1/0
+	cmpl	%eax, %edx	# 278	[c=4 l=2]  *cmpsi_1/0
+	jb	.L158	# 279	[c=13 l=2]  *jcc
+	movl	%edx, 8(%rsp)	# 925	[c=4 l=4]  *movsi_internal/1
+	movl	%edx, %esi	# 1104	[c=4 l=2]  *movsi_internal/0
+.L157:
+	movq	%r15, %rdi	# 286	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC13(%rip), %rcx	# 282	[c=1 l=7]  *movdi_internal/4
+	movl	$24, %edx	# 284	[c=4 l=5]  *movdi_internal/2
+	call	get_mem	# 287	[c=10 l=5]  *call_value
+	movq	%rbp, %r9	# 289	[c=4 l=3]  *movdi_internal/3
+	movq	%r15, %rdi	# 931	[c=4 l=3]  *movdi_internal/3
+	movabsq	$-7046029254386353131, %r11	# 341	[c=1 l=10]  *movdi_internal/4
+	movq	%rax, %r14	# 288	[c=4 l=3]  *movdi_internal/3
+	movl	%ebx, %eax	# 290	[c=1 l=2]  *zero_extendsidi2/3
+	xorl	%ebx, %ebx	# 1159	[c=4 l=2]  *movdi_xor
+	addq	$1, %rax	# 291	[c=4 l=4]  *adddi_1/0
+	salq	$4, %rax	# 292	[c=4 l=4]  *ashldi3_1/0
+	movq	%rax, (%rsp)	# 1049	[c=4 l=4]  *movdi_internal/5
+	.p2align 4,,10
+	.p2align 3
+.L160:
+	cmpq	$0, (%r9)	# 295	[c=9 l=4]  *cmpdi_ccno_1/1
+	je	.L162	# 296	[c=13 l=6]  *jcc
+	movq	1064(%rdi), %rsi	# 1157	[c=9 l=7]  *movdi_internal/3
+	addq	%rbx, %rsi	# 1158	[c=4 l=3]  *adddi_1/0
+	cmpb	$0, 11(%rsi)	# 311	[c=13 l=4]  *cmpqi_ccno_1/1
+	je	.L162	# 312	[c=13 l=6]  *jcc
+	leaq	64(%rsp), %r10	# 314	[c=4 l=5]  *leadi
+	movq	%rdi, 16(%rsp)	# 1083	[c=4 l=5]  *movdi_internal/5
+	movq	%r10, %rdx	# 315	[c=4 l=3]  *movdi_internal/3
+	call	fuse_window.part.0.constprop.0	# 318	[c=10 l=5]  *call_value
+	movq	16(%rsp), %rdi	# 1084	[c=9 l=5]  *movdi_internal/3
+	cmpl	$1, %eax	# 322	[c=4 l=3]  *cmpsi_1/0
+	jle	.L162	# 323	[c=13 l=6]  *jcc
+	movl	8(%rsp), %ecx	# 1053	[c=9 l=4]  *movsi_internal/0
+	leaq	66(%rsp), %r8	# 1115	[c=4 l=5]  *leadi
+	leal	1(%rax), %r13d	# 329	[c=5 l=4]  *leadi
+	movl	$2, %r12d	# 16	[c=4 l=6]  *movdi_internal/2
+	leal	-1(%rcx), %ebp	# 1114	[c=4 l=3]  *leasi
+	movl	$16, %ecx	# 17	[c=4 l=5]  *movsi_internal/0
+	.p2align 4,,10
+	.p2align 3
+.L167:
+	movq	%r10, %rax	# 18	[c=4 l=3]  *movdi_internal/3
+	movq	%r12, %rdx	# 19	[c=4 l=3]  *movdi_internal/3
+	.p2align 4,,10
+	.p2align 3
+.L163:
+	movzbl	(%rax), %esi	# 333	[c=9 l=3]  zero_extendqidi2/0
+	salq	$8, %rdx	# 332	[c=4 l=4]  *ashldi3_1/0
+	addq	$1, %rax	# 335	[c=4 l=4]  *adddi_1/0
+	orq	%rsi, %rdx	# 334	[c=4 l=3]  *iordi_1/0
+	cmpq	%rax, %r8	# 337	[c=4 l=3]  *cmpdi_1/0
+	jne	.L163	# 338	[c=13 l=2]  *jcc
+	salq	%cl, %rdx	# 340	[c=4 l=3]  *ashldi3_1/0
+	movq	%rdx, %rax	# 1054	[c=4 l=3]  *movdi_internal/3
+	imulq	%r11, %rax	# 342	[c=16 l=4]  *muldi3_1/2
+	shrq	$32, %rax	# 343	[c=4 l=4]  *lshrdi3_1/0
+	andl	%ebp, %eax	# 345	[c=4 l=2]  *andsi_1/0
+	movl	%eax, %esi	# 346	[c=1 l=2]  *zero_extendsidi2/3
+	leaq	(%rsi,%rsi,2), %rsi	# 349	[c=8 l=4]  *leadi
+	leaq	(%r14,%rsi,8), %r15	# 352	[c=8 l=4]  *leadi
+	movq	(%r15), %rsi	# 353	[c=5 l=3]  *movdi_internal/3
+	testq	%rsi, %rsi	# 356	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L164	# 357	[c=13 l=2]  *jcc
+	cmpq	%rsi, %rdx	# 360	[c=4 l=3]  *cmpdi_1/0
+	jne	.L165	# 361	[c=13 l=2]  *jcc
+	jmp	.L164	# 1203	[c=1 l=2]  jump
+	.p2align 4,,10
+	.p2align 3
+.L246:
+	testq	%rsi, %rsi	# 380	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L164	# 381	[c=13 l=2]  *jcc
+.L165:
+	addl	$1, %eax	# 363	[c=4 l=3]  *addsi_1/0
+	andl	%ebp, %eax	# 364	[c=4 l=2]  *andsi_1/0
+	movl	%eax, %esi	# 365	[c=1 l=2]  *zero_extendsidi2/3
+	leaq	(%rsi,%rsi,2), %rsi	# 368	[c=8 l=4]  *leadi
+	leaq	(%r14,%rsi,8), %r15	# 371	[c=8 l=4]  *leadi
+	movq	(%r15), %rsi	# 372	[c=5 l=3]  *movdi_internal/3
+	cmpq	%rsi, %rdx	# 376	[c=4 l=3]  *cmpdi_1/0
+	jne	.L246	# 377	[c=13 l=2]  *jcc
+.L164:
+	addq	$1, %r12	# 390	[c=4 l=4]  *adddi_1/0
+	movq	%rdx, (%r15)	# 385	[c=4 l=3]  *movdi_internal/5
+	subl	$8, %ecx	# 389	[c=4 l=3]  *addsi_1/0
+	movq	(%r9), %rax	# 387	[c=5 l=3]  *movdi_internal/3
+	addl	$1, 8(%r15)	# 386	[c=13 l=5]  *addsi_1/0
+	addq	$1, %r8	# 391	[c=4 l=4]  *adddi_1/0
+	addq	%rax, 16(%r15)	# 388	[c=13 l=4]  *adddi_1/0
+	cmpq	%r12, %r13	# 393	[c=4 l=3]  *cmpdi_1/0
+	jne	.L167	# 394	[c=13 l=6]  *jcc
+.L162:
+	addq	$8, %r9	# 298	[c=4 l=4]  *adddi_1/0
+	addq	$16, %rbx	# 299	[c=4 l=4]  *adddi_1/0
+	cmpq	%rbx, (%rsp)	# 301	[c=9 l=4]  *cmpdi_1/0
+	jne	.L160	# 302	[c=13 l=6]  *jcc
+	movl	8(%rsp), %eax	# 401	[c=10 l=4]  *zero_extendsidi2/3
+	movq	%rdi, %r15	# 933	[c=4 l=3]  *movdi_internal/3
+	movq	%r14, %r12	# 400	[c=4 l=3]  *movdi_internal/3
+	xorl	%r11d, %r11d	# 1156	[c=4 l=3]  *movdi_xor
+	leaq	(%rax,%rax,2), %rax	# 404	[c=8 l=4]  *leadi
+	leaq	(%r14,%rax,8), %rcx	# 407	[c=8 l=4]  *leadi
+	movq	%r14, %rax	# 20	[c=4 l=3]  *movdi_internal/3
+	.p2align 4,,10
+	.p2align 3
+.L169:
+	cmpq	$0, (%rax)	# 410	[c=9 l=4]  *cmpdi_ccno_1/1
+	je	.L168	# 411	[c=13 l=2]  *jcc
+	movl	%r11d, %edx	# 414	[c=1 l=3]  *zero_extendsidi2/3
+	movdqu	(%rax), %xmm2	# 423	[c=9 l=4]  movv1ti_internal/2
+	addl	$1, %r11d	# 1155	[c=4 l=4]  *addsi_1/0
+	leaq	(%rdx,%rdx,2), %rdx	# 417	[c=8 l=4]  *leadi
+	leaq	(%r14,%rdx,8), %rdx	# 421	[c=8 l=4]  *leadi
+	movups	%xmm2, (%rdx)	# 1057	[c=4 l=3]  movv1ti_internal/3
+	movq	16(%rax), %rsi	# 424	[c=9 l=4]  *movdi_internal/3
+	movq	%rsi, 16(%rdx)	# 425	[c=4 l=4]  *movdi_internal/5
+.L168:
+	addq	$24, %rax	# 428	[c=4 l=4]  *adddi_1/0
+	cmpq	%rcx, %rax	# 430	[c=4 l=3]  *cmpdi_1/0
+	jne	.L169	# 431	[c=13 l=2]  *jcc
+	movl	%r11d, %eax	# 433	[c=1 l=3]  *zero_extendsidi2/3
+	movl	$24, %edx	# 436	[c=4 l=5]  *movdi_internal/2
+	movq	%r14, %rdi	# 438	[c=4 l=3]  *movdi_internal/3
+	movl	%r11d, (%rsp)	# 1085	[c=4 l=4]  *movsi_internal/1
+	movq	%rax, %rsi	# 881	[c=4 l=3]  *movdi_internal/3
+	leaq	fuse_stat_cmp(%rip), %rcx	# 434	[c=1 l=7]  *movdi_internal/4
+	call	qsort@PLT	# 439	[c=0 l=5]  *call
+	movq	904(%r15), %rdi	# 440	[c=9 l=7]  *movdi_internal/3
+	xorl	%eax, %eax	# 1154	[c=4 l=2]  *movdi_xor
+	leaq	.LC6(%rip), %r9	# 441	[c=1 l=7]  *movdi_internal/4
+	leaq	.LC7(%rip), %r8	# 442	[c=1 l=7]  *movdi_internal/4
+	leaq	.LC8(%rip), %rcx	# 444	[c=1 l=7]  *movdi_internal/4
+	leaq	.LC14(%rip), %rdx	# 445	[c=1 l=7]  *movdi_internal/4
+	leaq	.LC15(%rip), %rsi	# 447	[c=1 l=7]  *movdi_internal/4
+	call	fprintf@PLT	# 451	[c=10 l=5]  *call_value
+	movl	(%rsp), %r11d	# 1086	[c=5 l=4]  *movsi_internal/0
+	testl	%r11d, %r11d	# 452	[c=4 l=3]  *cmpsi_ccno_1/0
+	je	.L186	# 453	[c=13 l=6]  *jcc
+	movq	%r15, 24(%rsp)	# 1020	[c=4 l=5]  *movdi_internal/5
+	xorl	%eax, %eax	# 1153	[c=4 l=2]  *movdi_xor
+	leaq	64(%rsp), %rbx	# 724	[c=4 l=5]  *leadi
+	movq	%r12, %r15	# 1021	[c=4 l=3]  *movdi_internal/3
+	movl	$0, (%rsp)	# 24	[c=4 l=7]  *movsi_internal/1
+	leaq	opcode_id(%rip), %r13	# 725	[c=1 l=7]  *movdi_internal/4
+	movq	%r14, 48(%rsp)	# 1017	[c=4 l=5]  *movdi_internal/5
+	movl	%r11d, 40(%rsp)	# 1018	[c=4 l=5]  *movsi_internal/1
+	jmp	.L170	# 1206	[c=1 l=2]  jump
+.L194:
+	movl	%edi, %eax	# 1111	[c=4 l=2]  *movsi_internal/0
+.L175:
+	addl	$1, (%rsp)	# 615	[c=9 l=4]  *addsi_1/0
+	movl	40(%rsp), %edi	# 1080	[c=9 l=4]  *movsi_internal/0
+	addq	$24, %r15	# 616	[c=4 l=4]  *adddi_1/0
+	movl	(%rsp), %ecx	# 1092	[c=5 l=3]  *movsi_internal/0
+	cmpl	%edi, %ecx	# 617	[c=4 l=2]  *cmpsi_1/0
+	je	.L247	# 618	[c=13 l=6]  *jcc
+.L170:
+	movq	(%r15), %rdi	# 1058	[c=5 l=3]  *movdi_internal/3
+	movl	(%rsp), %ecx	# 1087	[c=5 l=3]  *movsi_internal/0
+	shrq	$32, %rdi	# 467	[c=4 l=4]  *lshrdi3_1/0
+	movq	%rdi, 16(%rsp)	# 1089	[c=4 l=5]  *movdi_internal/5
+	movl	%edi, %ebp	# 468	[c=4 l=2]  *movsi_internal/0
+	testl	%ecx, %ecx	# 469	[c=4 l=2]  *cmpsi_ccno_1/0
+	je	.L173	# 470	[c=13 l=2]  *jcc
+	leal	-1(%rcx), %edx	# 473	[c=5 l=3]  *leadi
+	movq	48(%rsp), %rcx	# 1062	[c=9 l=5]  *movdi_internal/3
+	leaq	(%rdx,%rdx,2), %rdx	# 476	[c=8 l=4]  *leadi
+	cmpl	%edi, 4(%rcx,%rdx,8)	# 483	[c=14 l=4]  *cmpsi_1/0
+	jne	.L193	# 484	[c=13 l=6]  *jcc
+.L173:
+	leal	1(%rax), %edi	# 1112	[c=4 l=3]  *leasi
+	movl	%edi, 8(%rsp)	# 1064	[c=4 l=4]  *movsi_internal/1
+	cmpl	$15, %eax	# 490	[c=4 l=3]  *cmpsi_1/0
+	ja	.L194	# 491	[c=13 l=2]  *jcc
+.L174:
+	movl	16(%rsp), %eax	# 1151	[c=9 l=4]  *movsi_internal/0
+	pxor	%xmm0, %xmm0	# 494	[c=4 l=4]  movv1ti_internal/0
+	movq	%rbx, 32(%rsp)	# 781	[c=4 l=5]  *movdi_internal/5
+	xorl	%r14d, %r14d	# 1150	[c=4 l=3]  *movdi_xor
+	movaps	%xmm0, 64(%rsp)	# 812	[c=4 l=5]  movv1ti_internal/3
+	movaps	%xmm0, 80(%rsp)	# 813	[c=4 l=5]  movv1ti_internal/3
+	movaps	%xmm0, 96(%rsp)	# 814	[c=4 l=5]  movv1ti_internal/3
+	movaps	%xmm0, 112(%rsp)	# 815	[c=4 l=5]  movv1ti_internal/3
+	movaps	%xmm0, 128(%rsp)	# 816	[c=4 l=8]  movv1ti_internal/3
+	testl	%eax, %eax	# 1152	[c=4 l=2]  *cmpsi_ccno_1/0
+	jle	.L248	# 502	[c=13 l=6]  *jcc
+	.p2align 4,,10
+	.p2align 3
+.L176:
+	movl	%r14d, %eax	# 1066	[c=4 l=3]  *movsi_internal/0
+	movq	(%r15), %rdx	# 1068	[c=5 l=3]  *movdi_internal/3
+	negl	%eax	# 514	[c=4 l=2]  *negsi_1
+	leal	24(,%rax,8), %ecx	# 517	[c=8 l=7]  *leasi
+	shrq	%cl, %rdx	# 519	[c=4 l=3]  *lshrdi3_1/0
+	movzbl	%dl, %r12d	# 520	[c=4 l=4]  *zero_extendqisi2/0
+	testl	%r14d, %r14d	# 521	[c=4 l=3]  *cmpsi_ccno_1/0
+	jne	.L249	# 522	[c=13 l=2]  *jcc
+	movslq	%r12d, %rdx	# 552	[c=4 l=3]  *extendsidi2_rex64/1
+	movq	%rbx, %rdi	# 556	[c=4 l=3]  *movdi_internal/3
+	movq	0(%r13,%rdx,8), %rsi	# 553	[c=10 l=5]  *movdi_internal/3
+	call	strcat@PLT	# 557	[c=10 l=5]  *call_value
+	cmpl	$1, %ebp	# 558	[c=4 l=3]  *cmpsi_1/0
+	je	.L181	# 559	[c=13 l=2]  *jcc
+	movl	$1, %r14d	# 27	[c=4 l=6]  *movsi_internal/0
+	jmp	.L176	# 1211	[c=1 l=2]  jump
+	.p2align 4,,10
+	.p2align 3
+.L249:
+	movq	%rbx, %rdi	# 525	[c=4 l=3]  *movdi_internal/3
+	addl	$1, %r14d	# 542	[c=4 l=4]  *addsi_1/0
+	call	strlen@PLT	# 526	[c=10 l=5]  *call_value
+	movslq	%r12d, %rdx	# 534	[c=4 l=3]  *extendsidi2_rex64/1
+	movl	$2108192, (%rbx,%rax)	# 532	[c=4 l=7]  *movsi_internal/1
+	movq	0(%r13,%rdx,8), %rsi	# 535	[c=10 l=5]  *movdi_internal/3
+	leaq	3(%rbx,%rax), %rdi	# 538	[c=5 l=5]  *leadi
+	call	strcpy@PLT	# 541	[c=10 l=5]  *call_value
+	cmpl	%ebp, %r14d	# 543	[c=4 l=3]  *cmpsi_1/0
+	jne	.L176	# 544	[c=13 l=2]  *jcc
+.L181:
+	movq	24(%rsp), %rax	# 1065	[c=9 l=5]  *movdi_internal/3
+	movq	16(%r15), %r8	# 505	[c=9 l=4]  *movdi_internal/3
+	pxor	%xmm0, %xmm0	# 28	[c=4 l=4]  *movdf_internal/12
+	movq	40(%rax), %rax	# 504	[c=9 l=4]  *movdi_internal/3
+	testq	%rax, %rax	# 506	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L178	# 507	[c=13 l=2]  *jcc
+	pxor	%xmm0, %xmm0	# 1236	[c=4 l=4]  movv2df_internal/0
+	cvtsi2sdl	16(%rsp), %xmm0	# 1237	[c=4 l=6]  sse2_cvtsi2sd/1
+	mulsd	.LC11(%rip), %xmm0	# 568	[c=26 l=8]  *fop_df_comm/1
+	testq	%r8, %r8	# 571	[c=4 l=3]  *cmpdi_ccno_1/0
+	js	.L182	# 572	[c=13 l=6]  *jcc
+	pxor	%xmm1, %xmm1	# 1234	[c=4 l=4]  movv2df_internal/0
+	cvtsi2sdq	%r8, %xmm1	# 1235	[c=4 l=5]  sse2_cvtsi2sdq/0
+.L183:
+	mulsd	%xmm1, %xmm0	# 583	[c=20 l=4]  *fop_df_comm/1
+	testq	%rax, %rax	# 586	[c=4 l=3]  *cmpdi_ccno_1/0
+	js	.L184	# 587	[c=13 l=6]  *jcc
+	pxor	%xmm1, %xmm1	# 1232	[c=4 l=4]  movv2df_internal/0
+	cvtsi2sdq	%rax, %xmm1	# 1233	[c=4 l=5]  sse2_cvtsi2sdq/0
+.L185:
+	divsd	%xmm1, %xmm0	# 598	[c=68 l=4]  *fop_df_1/2
+.L178:
+	movq	24(%rsp), %rax	# 1076	[c=9 l=5]  *movdi_internal/3
+	movl	8(%r15), %ecx	# 601	[c=9 l=4]  *movsi_internal/0
+	leaq	.LC12(%rip), %rsi	# 609	[c=1 l=7]  *movdi_internal/4
+	movq	32(%rsp), %rdx	# 607	[c=9 l=5]  *movdi_internal/3
+	movq	904(%rax), %rdi	# 603	[c=9 l=7]  *movdi_internal/3
+	movl	$1, %eax	# 611	[c=4 l=5]  *movqi_internal/3
+	call	fprintf@PLT	# 612	[c=10 l=5]  *call_value
+	movl	8(%rsp), %eax	# 30	[c=9 l=4]  *movsi_internal/0
+	jmp	.L175	# 1213	[c=1 l=5]  jump
+.L193:
+	movl	$1, 8(%rsp)	# 25	[c=4 l=8]  *movsi_internal/1
+	jmp	.L174	# 1215	[c=1 l=5]  jump
+.L247:
+	movq	48(%rsp), %r14	# 1023	[c=9 l=5]  *movdi_internal/3
+	movq	24(%rsp), %r15	# 1024	[c=9 l=5]  *movdi_internal/3
+.L186:
+	movq	-24(%r14), %rdx	# 456	[c=9 l=4]  *movdi_internal/3
+	movq	-32(%r14), %rax	# 457	[c=9 l=4]  *movdi_internal/3
+	leaq	-32(%r14), %rdi	# 1113	[c=4 l=4]  *leadi
+	testq	%rdx, %rdx	# 458	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L250	# 459	[c=13 l=2]  *jcc
+	movq	%rax, (%rdx)	# 625	[c=4 l=3]  *movdi_internal/5
+	movq	-32(%r14), %rax	# 726	[c=9 l=4]  *movdi_internal/3
+.L187:
+	testq	%rax, %rax	# 634	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L188	# 635	[c=13 l=2]  *jcc
+	movq	%rdx, 8(%rax)	# 637	[c=4 l=4]  *movdi_internal/5
+.L188:
+	addq	$664, %rsp	# 1142	[c=4 l=7]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx	# 1143	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 48
+	popq	%rbp	# 1144	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 40
+	popq	%r12	# 1145	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 32
+	popq	%r13	# 1146	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 24
+	popq	%r14	# 1147	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 16
+	popq	%r15	# 1148	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 8
+	jmp	free@PLT	# 641	[c=0 l=5]  *sibcall
+.L184:
+	.cfi_restore_state
+	movq	%rax, %rdx	# 1074	[c=4 l=3]  *movdi_internal/3
+	andl	$1, %eax	# 593	[c=4 l=3]  *anddi_1/0
+	pxor	%xmm1, %xmm1	# 1230	[c=4 l=4]  movv2df_internal/0
+	shrq	%rdx	# 592	[c=4 l=3]  *lshrdi3_1/0
+	orq	%rax, %rdx	# 594	[c=4 l=3]  *iordi_1/0
+	cvtsi2sdq	%rdx, %xmm1	# 1231	[c=4 l=5]  sse2_cvtsi2sdq/0
+	addsd	%xmm1, %xmm1	# 596	[c=12 l=4]  *fop_df_comm/1
+	jmp	.L185	# 1218	[c=1 l=5]  jump
+.L182:
+	movq	%r8, %rdx	# 1070	[c=4 l=3]  *movdi_internal/3
+	movq	%r8, %rcx	# 1072	[c=4 l=3]  *movdi_internal/3
+	pxor	%xmm1, %xmm1	# 1228	[c=4 l=4]  movv2df_internal/0
+	shrq	%rdx	# 577	[c=4 l=3]  *lshrdi3_1/0
+	andl	$1, %ecx	# 578	[c=4 l=3]  *anddi_1/0
+	orq	%rcx, %rdx	# 579	[c=4 l=3]  *iordi_1/0
+	cvtsi2sdq	%rdx, %xmm1	# 1229	[c=4 l=5]  sse2_cvtsi2sdq/0
+	addsd	%xmm1, %xmm1	# 581	[c=12 l=4]  *fop_df_comm/1
+	jmp	.L183	# 1220	[c=1 l=5]  jump
+.L248:
+	leaq	64(%rsp), %rax	# 1097	[c=4 l=5]  *leadi
+	movq	%rax, 32(%rsp)	# 723	[c=4 l=5]  *movdi_internal/5
+	jmp	.L181	# 1222	[c=1 l=5]  jump
+.L250:
+	movq	%rax, 984(%r15)	# 630	[c=4 l=7]  *movdi_internal/5
+	jmp	.L187	# 1224	[c=1 l=2]  jump
+.L137:
+	addq	$664, %rsp	# 1131	[c=4 l=7]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx	# 1132	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 48
+	popq	%rbp	# 1133	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 40
+	popq	%r12	# 1134	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 32
+	popq	%r13	# 1135	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 24
+	popq	%r14	# 1136	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 16
+	popq	%r15	# 1137	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 8
+	ret		# 1138	[c=0 l=1]  simple_return_internal
+.L191:
+	.cfi_restore_state
+	movl	$16, 8(%rsp)	# 14	[c=4 l=8]  *movsi_internal/1
+	movl	8(%rsp), %esi	# 1105	[c=9 l=4]  *movsi_internal/0
+	jmp	.L157	# 1226	[c=1 l=5]  jump
+	.cfi_endproc
+.LFE19:
+	.size	print_fuse_stats, .-print_fuse_stats
+	.section	.rodata.str1.1
+.LC17:
+	.string	"-not set-"
+.LC18:
+	.string	"\n"
+	.section	.rodata.str1.8
+	.align 8
+.LC22:
+	.string	"        load: %lu:%02lu.%06lu  = %3lu.%03lu sec  = %6.2f%%,  %10.3f        bytes/ms, 0x%05x = %u bytes\n"
+	.align 8
+.LC23:
+	.string	"      decode: %lu:%02lu.%06lu  = %3lu.%03lu sec  = %6.2f%%,  %10.3f        bytes/ms, 0x%05x = %u bytes\n"
+	.align 8
+.LC24:
+	.string	"     execute: %lu:%02lu.%06lu  = %3lu.%03lu sec  = %6.2f%%,  %10.3f instructions/ms\n"
+	.align 8
+.LC25:
+	.string	" avrtest run: %lu:%02lu.%06lu  = %3lu.%03lu sec  = %6.2f%%,  %10.3f instructions/ms\n"
+	.align 8
+.LC26:
+	.string	" exit status: %s\n      reason: "
+	.section	.rodata.str1.1
+.LC27:
+	.string	"\n     program: %s\n"
+.LC28:
+	.string	" entry point: %06x\n"
+	.section	.rodata.str1.8
+	.align 8
+.LC29:
+	.string	"exit address: %06x\ntotal cycles: %lu\n"
+	.section	.rodata.str1.1
+.LC30:
+	.string	"      asleep: %lu\n"
+.LC31:
+	.string	"total instr.: %lu\n\n"
+.LC32:
+	.string	"\n%s: %s error: "
+	.text
+	.p2align 4
+	.globl	leave
+	.type	leave, @function
+leave:
+.LFB29:
+	.cfi_startproc
+	pushq	%rbp	# 1319	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp	# 1320	[c=4 l=3]  *movdi_internal/3
+	.cfi_def_cfa_register 6
+	pushq	%r15	# 1321	[c=4 l=2]  *pushdi2_rex64/0
+	pushq	%r14	# 1322	[c=4 l=2]  *pushdi2_rex64/0
+	pushq	%r13	# 1323	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_offset 15, -24
+	.cfi_offset 14, -32
+	.cfi_offset 13, -40
+	movq	%rdx, %r13	# 4	[c=4 l=3]  *movdi_internal/3
+	pushq	%r12	# 1324	[c=4 l=2]  *pushdi2_rex64/0
+	pushq	%rbx	# 1325	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_offset 12, -48
+	.cfi_offset 3, -56
+	movq	%rdi, %rbx	# 2	[c=4 l=3]  *movdi_internal/3
+	subq	$312, %rsp	# 1326	[c=4 l=7]  pro_epilogue_adjust_stack_add_di/0
+	movl	%esi, -260(%rbp)	# 3	[c=4 l=6]  *movsi_internal/1
+	movq	%rcx, -200(%rbp)	# 5	[c=4 l=7]  *movdi_internal/5
+	movq	%r8, -192(%rbp)	# 6	[c=4 l=7]  *movdi_internal/5
+	movq	%r9, -184(%rbp)	# 7	[c=4 l=7]  *movdi_internal/5
+	testb	%al, %al	# 8	[c=4 l=2]  *cmpqi_ccno_1/0
+	je	.L331	# 9	[c=13 l=2]  *jcc
+	movaps	%xmm0, -176(%rbp)	# 10	[c=4 l=7]  movv4sf_internal/3
+	movaps	%xmm1, -160(%rbp)	# 11	[c=4 l=7]  movv4sf_internal/3
+	movaps	%xmm2, -144(%rbp)	# 12	[c=4 l=7]  movv4sf_internal/3
+	movaps	%xmm3, -128(%rbp)	# 13	[c=4 l=4]  movv4sf_internal/3
+	movaps	%xmm4, -112(%rbp)	# 14	[c=4 l=4]  movv4sf_internal/3
+	movaps	%xmm5, -96(%rbp)	# 15	[c=4 l=4]  movv4sf_internal/3
+	movaps	%xmm6, -80(%rbp)	# 16	[c=4 l=4]  movv4sf_internal/3
+	movaps	%xmm7, -64(%rbp)	# 17	[c=4 l=4]  movv4sf_internal/3
+.L331:
+	movl	-260(%rbp), %eax	# 1115	[c=9 l=6]  *movsi_internal/0
+	movl	96(%rbx), %edx	# 31	[c=9 l=3]  *movsi_internal/0
+	movl	%eax, 72(%rbx)	# 30	[c=4 l=3]  *movsi_internal/1
+	testl	%edx, %edx	# 32	[c=4 l=2]  *cmpsi_ccno_1/0
+	je	.L254	# 33	[c=13 l=2]  *jcc
+	movq	40(%rbx), %rax	# 1116	[c=9 l=4]  *movdi_internal/3
+	subq	$1, %rax	# 40	[c=4 l=4]  *adddi_1/0
+	subl	$1, %edx	# 1395	[c=4 l=3]  *addsi_4
+	movq	%rax, 40(%rbx)	# 41	[c=4 l=4]  *movdi_internal/5
+	je	.L365	# 44	[c=13 l=6]  *jcc
+.L254:
+	movq	%rbx, %rdi	# 57	[c=4 l=3]  *movdi_internal/3
+	leaq	exit_status(%rip), %r15	# 61	[c=1 l=7]  *movdi_internal/4
+	call	periph_finish@PLT	# 58	[c=0 l=5]  *call
+	movq	%rbx, %rdi	# 59	[c=4 l=3]  *movdi_internal/3
+	call	replay_finish@PLT	# 60	[c=0 l=5]  *call
+	movslq	-260(%rbp), %r12	# 62	[c=13 l=7]  *extendsidi2_rex64/1
+	leaq	.LC18(%rip), %rsi	# 71	[c=1 l=7]  *movdi_internal/4
+	movq	%rbx, %rdi	# 73	[c=4 l=3]  *movdi_internal/3
+	leaq	(%r12,%r12,2), %rax	# 65	[c=8 l=4]  *leadi
+	movl	16(%r15,%rax,8), %r14d	# 70	[c=10 l=5]  *movsi_internal/0
+	xorl	%eax, %eax	# 1392	[c=4 l=2]  *movdi_xor
+	call	qprintf	# 75	[c=0 l=5]  *call
+	movl	232(%rbx), %r11d	# 1393	[c=9 l=7]  *movsi_internal/0
+	testl	%r11d, %r11d	# 1394	[c=4 l=3]  *cmpsi_ccno_1/0
+	je	.L256	# 77	[c=13 l=6]  *jcc
+	testl	%r14d, %r14d	# 79	[c=4 l=3]  *cmpsi_ccno_1/0
+	je	.L257	# 80	[c=13 l=6]  *jcc
+.L364:
+	cmpl	$0, 600(%rbx)	# 82	[c=13 l=7]  *cmpsi_ccno_1/1
+	jne	.L258	# 83	[c=13 l=2]  *jcc
+	cmpl	$0, 584(%rbx)	# 94	[c=13 l=7]  *cmpsi_ccno_1/1
+	je	.L259	# 95	[c=13 l=6]  *jcc
+	cmpl	$0, 488(%rbx)	# 97	[c=13 l=7]  *cmpsi_ccno_1/1
+	je	.L259	# 98	[c=13 l=6]  *jcc
+.L258:
+	cmpl	$0, 216(%rbx)	# 688	[c=13 l=7]  *cmpsi_ccno_1/1
+	je	.L309	# 689	[c=13 l=6]  *jcc
+	movq	904(%rbx), %rdi	# 691	[c=9 l=7]  *movdi_internal/3
+	call	fflush@PLT	# 693	[c=10 l=5]  *call_value
+.L318:
+	leaq	16(%rbp), %rax	# 1228	[c=4 l=4]  *leadi
+	movq	912(%rbx), %r14	# 804	[c=9 l=7]  *movdi_internal/3
+	movl	$24, -256(%rbp)	# 806	[c=4 l=10]  *movsi_internal/1
+	leaq	.LC32(%rip), %rsi	# 818	[c=1 l=7]  *movdi_internal/4
+	movq	%rax, -248(%rbp)	# 808	[c=4 l=7]  *movdi_internal/5
+	leaq	-224(%rbp), %rax	# 1229	[c=4 l=7]  *leadi
+	movq	144(%rbx), %rdx	# 815	[c=9 l=7]  *movdi_internal/3
+	movq	%rax, -240(%rbp)	# 809	[c=4 l=7]  *movdi_internal/5
+	imulq	$24, %r12, %rax	# 812	[c=16 l=4]  *muldi3_1/0
+	movq	%r14, %rdi	# 820	[c=4 l=3]  *movdi_internal/3
+	movl	$48, -252(%rbp)	# 807	[c=4 l=10]  *movsi_internal/1
+	movq	8(%r15,%rax), %rcx	# 816	[c=10 l=5]  *movdi_internal/3
+	xorl	%eax, %eax	# 1352	[c=4 l=2]  *movdi_xor
+	call	fprintf@PLT	# 822	[c=10 l=5]  *call_value
+	leaq	-256(%rbp), %rdx	# 1289	[c=4 l=7]  *leadi
+	movq	%r13, %rsi	# 825	[c=4 l=3]  *movdi_internal/3
+	movq	%r14, %rdi	# 826	[c=4 l=3]  *movdi_internal/3
+	call	vfprintf@PLT	# 827	[c=10 l=5]  *call_value
+	movl	$10, %edi	# 829	[c=4 l=5]  *movsi_internal/0
+	movq	%r14, %rsi	# 828	[c=4 l=3]  *movdi_internal/3
+	call	fputc@PLT	# 830	[c=10 l=5]  *call_value
+	movq	%r14, %rdi	# 831	[c=4 l=3]  *movdi_internal/3
+	call	fflush@PLT	# 832	[c=10 l=5]  *call_value
+.L317:
+	cmpl	$0, -260(%rbp)	# 835	[c=13 l=7]  *cmpsi_ccno_1/1
+	jne	.L324	# 836	[c=13 l=6]  *jcc
+	movl	76(%rbx), %esi	# 838	[c=9 l=3]  *movsi_internal/0
+.L325:
+	movq	%rbx, %rdi	# 852	[c=4 l=3]  *movdi_internal/3
+	call	finish	# 853	[c=0 l=5]  *call
+.L311:
+	cmpl	$0, 600(%rbx)	# 651	[c=13 l=7]  *cmpsi_ccno_1/1
+	jne	.L314	# 652	[c=13 l=6]  *jcc
+.L308:
+	cmpl	$0, 584(%rbx)	# 103	[c=13 l=7]  *cmpsi_ccno_1/1
+	jne	.L260	# 104	[c=13 l=6]  *jcc
+.L259:
+	cmpl	$0, 216(%rbx)	# 698	[c=13 l=7]  *cmpsi_ccno_1/1
+	jne	.L366	# 699	[c=13 l=6]  *jcc
+.L309:
+	leaq	16(%rbp), %rax	# 1225	[c=4 l=4]  *leadi
+	cmpl	$0, 76(%rbx)	# 674	[c=13 l=4]  *cmpsi_ccno_1/1
+	movl	$24, -256(%rbp)	# 670	[c=4 l=10]  *movsi_internal/1
+	leaq	.LC0(%rip), %rdx	# 26	[c=1 l=7]  *movdi_internal/4
+	movq	%rax, -248(%rbp)	# 672	[c=4 l=7]  *movdi_internal/5
+	leaq	-224(%rbp), %rax	# 1226	[c=4 l=7]  *leadi
+	movl	$48, -252(%rbp)	# 671	[c=4 l=10]  *movsi_internal/1
+	movq	%rax, -240(%rbp)	# 673	[c=4 l=7]  *movdi_internal/5
+	jne	.L315	# 675	[c=13 l=2]  *jcc
+	imulq	$24, %r12, %r12	# 707	[c=16 l=4]  *muldi3_1/0
+	movq	(%r15,%r12), %rdx	# 709	[c=9 l=4]  *movdi_internal/3
+.L315:
+	movq	904(%rbx), %rdi	# 712	[c=9 l=7]  *movdi_internal/3
+	leaq	.LC26(%rip), %rsi	# 714	[c=1 l=7]  *movdi_internal/4
+	xorl	%eax, %eax	# 1358	[c=4 l=2]  *movdi_xor
+	call	fprintf@PLT	# 718	[c=10 l=5]  *call_value
+	movq	904(%rbx), %rdi	# 720	[c=9 l=7]  *movdi_internal/3
+	leaq	-256(%rbp), %rdx	# 1291	[c=4 l=7]  *leadi
+	movq	%r13, %rsi	# 722	[c=4 l=3]  *movdi_internal/3
+	call	vfprintf@PLT	# 724	[c=10 l=5]  *call_value
+	movq	80(%rbx), %rdx	# 725	[c=9 l=4]  *movdi_internal/3
+	testq	%rdx, %rdx	# 726	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L367	# 727	[c=13 l=6]  *jcc
+.L320:
+	movq	904(%rbx), %rdi	# 731	[c=9 l=7]  *movdi_internal/3
+	xorl	%eax, %eax	# 1357	[c=4 l=2]  *movdi_xor
+	leaq	.LC27(%rip), %rsi	# 733	[c=1 l=7]  *movdi_internal/4
+	call	fprintf@PLT	# 737	[c=10 l=5]  *call_value
+	testl	%r14d, %r14d	# 738	[c=4 l=3]  *cmpsi_ccno_1/0
+	jne	.L321	# 739	[c=13 l=2]  *jcc
+	movl	8(%rbx), %edx	# 741	[c=9 l=3]  *movsi_internal/0
+	testl	%edx, %edx	# 742	[c=4 l=2]  *cmpsi_ccno_1/0
+	jne	.L368	# 743	[c=13 l=6]  *jcc
+.L322:
+	movl	(%rbx), %eax	# 1227	[c=5 l=2]  *movsi_internal/0
+	movq	48(%rbx), %rcx	# 754	[c=9 l=4]  *movdi_internal/3
+	leaq	.LC29(%rip), %rsi	# 760	[c=1 l=7]  *movdi_internal/4
+	movq	904(%rbx), %rdi	# 757	[c=9 l=7]  *movdi_internal/3
+	leal	(%rax,%rax), %edx	# 1290	[c=12 l=3]  *leasi
+	xorl	%eax, %eax	# 1355	[c=4 l=2]  *movdi_xor
+	call	fprintf@PLT	# 764	[c=10 l=5]  *call_value
+	movq	64(%rbx), %rdx	# 765	[c=9 l=4]  *movdi_internal/3
+	testq	%rdx, %rdx	# 766	[c=4 l=3]  *cmpdi_ccno_1/0
+	jne	.L369	# 767	[c=13 l=6]  *jcc
+.L323:
+	movq	40(%rbx), %rdx	# 778	[c=9 l=4]  *movdi_internal/3
+	movq	904(%rbx), %rdi	# 779	[c=9 l=7]  *movdi_internal/3
+	leaq	.LC31(%rip), %rsi	# 781	[c=1 l=7]  *movdi_internal/4
+	xorl	%eax, %eax	# 1353	[c=4 l=2]  *movdi_xor
+	call	fprintf@PLT	# 785	[c=10 l=5]  *call_value
+.L321:
+	movq	904(%rbx), %rdi	# 788	[c=9 l=7]  *movdi_internal/3
+	call	fflush@PLT	# 790	[c=10 l=5]  *call_value
+	movl	%r14d, %esi	# 791	[c=4 l=3]  *movsi_internal/0
+	movq	%rbx, %rdi	# 792	[c=4 l=3]  *movdi_internal/3
+	call	finish	# 793	[c=0 l=5]  *call
+.L256:
+	cmpl	$0, 536(%rbx)	# 636	[c=13 l=7]  *cmpsi_ccno_1/1
+	je	.L311	# 637	[c=13 l=6]  *jcc
+	testl	%r14d, %r14d	# 640	[c=4 l=3]  *cmpsi_ccno_1/0
+	jne	.L364	# 641	[c=13 l=6]  *jcc
+.L312:
+	movq	%rbx, %rdi	# 607	[c=4 l=3]  *movdi_internal/3
+	call	print_fuse_stats	# 608	[c=0 l=5]  *call
+	cmpl	$0, 600(%rbx)	# 609	[c=13 l=7]  *cmpsi_ccno_1/1
+	je	.L308	# 610	[c=13 l=6]  *jcc
+.L307:
+	movq	%rbx, %rdi	# 627	[c=4 l=3]  *movdi_internal/3
+	call	hle_print_stats@PLT	# 628	[c=0 l=5]  *call
+	cmpl	$0, 216(%rbx)	# 629	[c=13 l=7]  *cmpsi_ccno_1/1
+	je	.L309	# 630	[c=13 l=6]  *jcc
+	movq	904(%rbx), %rdi	# 681	[c=9 l=7]  *movdi_internal/3
+	call	fflush@PLT	# 683	[c=10 l=5]  *call_value
+	jmp	.L317	# 1401	[c=1 l=5]  jump
+.L260:
+	cmpl	$0, 488(%rbx)	# 662	[c=13 l=7]  *cmpsi_ccno_1/1
+	je	.L259	# 663	[c=13 l=6]  *jcc
+.L314:
+	testl	%r14d, %r14d	# 654	[c=4 l=3]  *cmpsi_ccno_1/0
+	jne	.L258	# 655	[c=13 l=6]  *jcc
+	jmp	.L307	# 1404	[c=1 l=2]  jump
+.L324:
+	imulq	$24, %r12, %r12	# 845	[c=16 l=4]  *muldi3_1/0
+	movl	20(%r15,%r12), %esi	# 848	[c=10 l=5]  *movsi_internal/0
+	jmp	.L325	# 1406	[c=1 l=5]  jump
+.L366:
+	movq	904(%rbx), %rdi	# 797	[c=9 l=7]  *movdi_internal/3
+	call	fflush@PLT	# 799	[c=10 l=5]  *call_value
+	testl	%r14d, %r14d	# 800	[c=4 l=3]  *cmpsi_ccno_1/0
+	je	.L317	# 801	[c=13 l=6]  *jcc
+	jmp	.L318	# 1409	[c=1 l=5]  jump
+.L365:
+	movl	(%rbx), %edx	# 46	[c=6 l=2]  *zero_extendsidi2/3
+	salq	$4, %rdx	# 47	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %rdx	# 49	[c=13 l=7]  *adddi_1/1
+	movzbl	11(%rdx), %ecx	# 50	[c=13 l=4]  zero_extendqidi2/0
+	subq	%rcx, %rax	# 51	[c=4 l=3]  *subdi_1/0
+	movq	%rax, 40(%rbx)	# 52	[c=4 l=4]  *movdi_internal/5
+	movzwl	14(%rdx), %eax	# 53	[c=13 l=4]  zero_extendhidi2/0
+	subq	%rax, 48(%rbx)	# 54	[c=13 l=4]  *subdi_1/0
+	jmp	.L254	# 1411	[c=1 l=5]  jump
+.L257:
+	leaq	-256(%rbp), %rdi	# 1318	[c=4 l=7]  *leadi
+	xorl	%esi, %esi	# 1391	[c=4 l=2]  *movdi_xor
+	call	gettimeofday@PLT	# 113	[c=10 l=5]  *call_value
+	movq	-248(%rbp), %rax	# 116	[c=9 l=7]  *movdi_internal/3
+	movq	-256(%rbp), %rcx	# 114	[c=9 l=7]  *movdi_internal/3
+	movq	928(%rbx), %rdx	# 115	[c=9 l=7]  *movdi_internal/3
+	movq	%rax, %rdi	# 1120	[c=4 l=3]  *movdi_internal/3
+	movq	%rcx, %rsi	# 1118	[c=4 l=3]  *movdi_internal/3
+	subq	920(%rbx), %rsi	# 117	[c=13 l=7]  *subdi_1/1
+	subq	%rdx, %rdi	# 118	[c=4 l=3]  *subdi_1/0
+	movq	%rsi, -272(%rbp)	# 1232	[c=4 l=7]  *movdi_internal/5
+	movq	%rdi, -280(%rbp)	# 1231	[c=4 l=7]  *movdi_internal/5
+	cmpq	%rdx, %rax	# 119	[c=4 l=3]  *cmpdi_1/0
+	jnb	.L261	# 120	[c=13 l=2]  *jcc
+	subq	$1, %rsi	# 122	[c=4 l=4]  *adddi_1/0
+	addq	$1000000, %rdi	# 123	[c=4 l=7]  *adddi_1/0
+	movq	%rsi, -272(%rbp)	# 1123	[c=4 l=7]  *movdi_internal/5
+	movq	%rdi, -280(%rbp)	# 1125	[c=4 l=7]  *movdi_internal/5
+.L261:
+	movq	-272(%rbp), %rsi	# 1233	[c=9 l=7]  *movdi_internal/3
+	testq	%rsi, %rsi	# 128	[c=4 l=3]  *cmpdi_ccno_1/0
+	js	.L262	# 129	[c=13 l=6]  *jcc
+	pxor	%xmm2, %xmm2	# 1494	[c=4 l=4]  movv2df_internal/0
+	cvtsi2sdq	%rsi, %xmm2	# 1495	[c=4 l=5]  sse2_cvtsi2sdq/0
+.L263:
+	movsd	.LC19(%rip), %xmm5	# 140	[c=6 l=8]  *movdf_internal/14
+	movq	-280(%rbp), %rdi	# 1235	[c=9 l=7]  *movdi_internal/3
+	mulsd	%xmm5, %xmm2	# 141	[c=20 l=4]  *fop_df_comm/1
+	testq	%rdi, %rdi	# 144	[c=4 l=3]  *cmpdi_ccno_1/0
+	js	.L264	# 145	[c=13 l=6]  *jcc
+	pxor	%xmm0, %xmm0	# 1492	[c=4 l=4]  movv2df_internal/0
+	cvtsi2sdq	%rdi, %xmm0	# 1493	[c=4 l=5]  sse2_cvtsi2sdq/0
+.L265:
+	movsd	.LC20(%rip), %xmm4	# 156	[c=6 l=8]  *movdf_internal/14
+	movq	968(%rbx), %r10	# 159	[c=9 l=7]  *movdi_internal/3
+	movq	%rax, %rsi	# 1138	[c=4 l=3]  *movdi_internal/3
+	movq	976(%rbx), %rdx	# 160	[c=9 l=7]  *movdi_internal/3
+	mulsd	%xmm4, %xmm0	# 157	[c=20 l=4]  *fop_df_comm/1
+	subq	%r10, %rcx	# 161	[c=4 l=3]  *subdi_1/0
+	subq	%rdx, %rsi	# 162	[c=4 l=3]  *subdi_1/0
+	movq	%rcx, -288(%rbp)	# 1238	[c=4 l=7]  *movdi_internal/5
+	movq	%rsi, -296(%rbp)	# 1237	[c=4 l=7]  *movdi_internal/5
+	addsd	%xmm0, %xmm2	# 158	[c=12 l=4]  *fop_df_comm/1
+	cmpq	%rdx, %rax	# 163	[c=4 l=3]  *cmpdi_1/0
+	jnb	.L266	# 164	[c=13 l=2]  *jcc
+	subq	$1, %rcx	# 166	[c=4 l=4]  *adddi_1/0
+	addq	$1000000, %rsi	# 167	[c=4 l=7]  *adddi_1/0
+	movq	%rcx, -288(%rbp)	# 1141	[c=4 l=7]  *movdi_internal/5
+	movq	%rsi, -296(%rbp)	# 1143	[c=4 l=7]  *movdi_internal/5
+.L266:
+	movq	-288(%rbp), %rax	# 1239	[c=9 l=7]  *movdi_internal/3
+	testq	%rax, %rax	# 172	[c=4 l=3]  *cmpdi_ccno_1/0
+	js	.L267	# 173	[c=13 l=6]  *jcc
+	pxor	%xmm1, %xmm1	# 1490	[c=4 l=4]  movv2df_internal/0
+	cvtsi2sdq	%rax, %xmm1	# 1491	[c=4 l=5]  sse2_cvtsi2sdq/0
+.L268:
+	movq	-296(%rbp), %rax	# 1241	[c=9 l=7]  *movdi_internal/3
+	mulsd	%xmm5, %xmm1	# 185	[c=20 l=4]  *fop_df_comm/1
+	testq	%rax, %rax	# 188	[c=4 l=3]  *cmpdi_ccno_1/0
+	js	.L269	# 189	[c=13 l=6]  *jcc
+	pxor	%xmm0, %xmm0	# 1488	[c=4 l=4]  movv2df_internal/0
+	cvtsi2sdq	%rax, %xmm0	# 1489	[c=4 l=5]  sse2_cvtsi2sdq/0
+.L270:
+	mulsd	%xmm4, %xmm0	# 201	[c=20 l=4]  *fop_df_comm/1
+	movq	952(%rbx), %r9	# 203	[c=9 l=7]  *movdi_internal/3
+	movq	960(%rbx), %rax	# 204	[c=9 l=7]  *movdi_internal/3
+	movq	%rdx, %r11	# 1156	[c=4 l=3]  *movdi_internal/3
+	subq	%r9, %r10	# 205	[c=4 l=3]  *subdi_1/0
+	subq	%rax, %r11	# 206	[c=4 l=3]  *subdi_1/0
+	addsd	%xmm0, %xmm1	# 202	[c=12 l=4]  *fop_df_comm/1
+	movsd	%xmm1, -304(%rbp)	# 1155	[c=4 l=8]  *movdf_internal/15
+	cmpq	%rax, %rdx	# 207	[c=4 l=3]  *cmpdi_1/0
+	jnb	.L271	# 208	[c=13 l=2]  *jcc
+	subq	$1, %r10	# 210	[c=4 l=4]  *adddi_1/0
+	addq	$1000000, %r11	# 211	[c=4 l=7]  *adddi_1/0
+.L271:
+	testq	%r10, %r10	# 216	[c=4 l=3]  *cmpdi_ccno_1/0
+	js	.L272	# 217	[c=13 l=6]  *jcc
+	pxor	%xmm3, %xmm3	# 1486	[c=4 l=4]  movv2df_internal/0
+	cvtsi2sdq	%r10, %xmm3	# 1487	[c=4 l=5]  sse2_cvtsi2sdq/0
+.L273:
+	mulsd	%xmm5, %xmm3	# 229	[c=20 l=4]  *fop_df_comm/1
+	testq	%r11, %r11	# 232	[c=4 l=3]  *cmpdi_ccno_1/0
+	js	.L274	# 233	[c=13 l=6]  *jcc
+	pxor	%xmm1, %xmm1	# 1484	[c=4 l=4]  movv2df_internal/0
+	cvtsi2sdq	%r11, %xmm1	# 1485	[c=4 l=5]  sse2_cvtsi2sdq/0
+.L275:
+	mulsd	%xmm4, %xmm1	# 245	[c=20 l=4]  *fop_df_comm/1
+	movq	944(%rbx), %rdx	# 247	[c=9 l=7]  *movdi_internal/3
+	movq	%rax, %r8	# 1166	[c=4 l=3]  *movdi_internal/3
+	subq	936(%rbx), %r9	# 248	[c=13 l=7]  *subdi_1/1
+	subq	%rdx, %r8	# 249	[c=4 l=3]  *subdi_1/0
+	addsd	%xmm1, %xmm3	# 246	[c=12 l=4]  *fop_df_comm/1
+	cmpq	%rdx, %rax	# 250	[c=4 l=3]  *cmpdi_1/0
+	jnb	.L276	# 251	[c=13 l=2]  *jcc
+	subq	$1, %r9	# 253	[c=4 l=4]  *adddi_1/0
+	addq	$1000000, %r8	# 254	[c=4 l=7]  *adddi_1/0
+.L276:
+	testq	%r9, %r9	# 259	[c=4 l=3]  *cmpdi_ccno_1/0
+	js	.L277	# 260	[c=13 l=6]  *jcc
+	pxor	%xmm0, %xmm0	# 1482	[c=4 l=4]  movv2df_internal/0
+	cvtsi2sdq	%r9, %xmm0	# 1483	[c=4 l=5]  sse2_cvtsi2sdq/0
+.L278:
+	mulsd	%xmm5, %xmm0	# 272	[c=20 l=4]  *fop_df_comm/1
+	testq	%r8, %r8	# 275	[c=4 l=3]  *cmpdi_ccno_1/0
+	js	.L279	# 276	[c=13 l=6]  *jcc
+	pxor	%xmm1, %xmm1	# 1480	[c=4 l=4]  movv2df_internal/0
+	cvtsi2sdq	%r8, %xmm1	# 1481	[c=4 l=5]  sse2_cvtsi2sdq/0
+.L280:
+	mulsd	%xmm4, %xmm1	# 288	[c=20 l=4]  *fop_df_comm/1
+	movl	16(%rbx), %esi	# 290	[c=9 l=3]  *movsi_internal/0
+	addsd	%xmm1, %xmm0	# 289	[c=12 l=4]  *fop_df_comm/1
+	comisd	.LC21(%rip), %xmm0	# 292	[c=10 l=8]  *cmpidf/1
+	pxor	%xmm1, %xmm1	# 20	[c=4 l=4]  *movdf_internal/12
+	jbe	.L281	# 293	[c=13 l=2]  *jcc
+	movl	%esi, %eax	# 298	[c=1 l=2]  *zero_extendsidi2/3
+	pxor	%xmm1, %xmm1	# 1478	[c=4 l=4]  movv2df_internal/0
+	cvtsi2sdq	%rax, %xmm1	# 1479	[c=4 l=5]  sse2_cvtsi2sdq/0
+	divsd	%xmm0, %xmm1	# 313	[c=68 l=4]  *fop_df_1/2
+.L281:
+	movl	$1000, %ecx	# 317	[c=4 l=5]  *movdi_internal/2
+	xorl	%edx, %edx	# 1389	[c=4 l=2]  *movdi_xor
+	movq	%r8, %rax	# 1176	[c=4 l=3]  *movdi_internal/3
+	movq	904(%rbx), %rdi	# 326	[c=9 l=7]  *movdi_internal/3
+	divq	%rcx	# 1315	[c=0 l=3]  *udivmoddi4_noext
+	movl	$60, %ecx	# 320	[c=4 l=5]  *movdi_internal/2
+	xorl	%edx, %edx	# 1390	[c=4 l=2]  *movdi_xor
+	movq	%rax, -320(%rbp)	# 1177	[c=4 l=7]  *movdi_internal/5
+	movq	%r9, %rax	# 1178	[c=4 l=3]  *movdi_internal/3
+	divq	%rcx	# 1317	[c=0 l=3]  *udivmoddi4_noext
+	comisd	.LC21(%rip), %xmm2	# 328	[c=10 l=8]  *cmpidf/1
+	movq	%rdx, %rcx	# 1180	[c=4 l=3]  *movdi_internal/3
+	jbe	.L351	# 329	[c=13 l=6]  *jcc
+	movsd	.LC11(%rip), %xmm6	# 334	[c=6 l=8]  *movdf_internal/14
+	movq	%r10, -336(%rbp)	# 1246	[c=4 l=7]  *movdi_internal/5
+	movq	%rax, %rdx	# 346	[c=4 l=3]  *movdi_internal/3
+	movl	$2, %eax	# 350	[c=4 l=5]  *movqi_internal/3
+	movq	%r11, -344(%rbp)	# 1248	[c=4 l=7]  *movdi_internal/5
+	mulsd	%xmm6, %xmm0	# 335	[c=20 l=4]  *fop_df_comm/1
+	movsd	%xmm3, -352(%rbp)	# 1250	[c=4 l=8]  *movdf_internal/15
+	movsd	%xmm2, -328(%rbp)	# 1243	[c=4 l=8]  *movdf_internal/15
+	movsd	%xmm6, -312(%rbp)	# 1245	[c=4 l=8]  *movdf_internal/15
+	pushq	%r10	# 1388	[c=4 l=2]  *pushdi2_rex64/0
+	pushq	%rsi	# 338	[c=4 l=1]  *pushsi2_rex64/0
+	divsd	%xmm2, %xmm0	# 336	[c=68 l=4]  *fop_df_1/2
+	pushq	%rsi	# 339	[c=4 l=1]  *pushsi2_rex64/0
+	leaq	.LC22(%rip), %rsi	# 347	[c=1 l=7]  *movdi_internal/4
+	pushq	-320(%rbp)	# 340	[c=9 l=6]  *pushdi2_rex64/0
+	call	fprintf@PLT	# 351	[c=10 l=5]  *call_value
+	movl	24(%rbx), %eax	# 1183	[c=9 l=3]  *movsi_internal/0
+	movsd	-352(%rbp), %xmm3	# 1251	[c=9 l=8]  *movdf_internal/14
+	addq	$32, %rsp	# 355	[c=4 l=4]  *adddi_1/0
+	movsd	-328(%rbp), %xmm2	# 1244	[c=9 l=8]  *movdf_internal/14
+	movq	-336(%rbp), %r10	# 1247	[c=9 l=7]  *movdi_internal/3
+	leal	1(%rax), %r8d	# 1313	[c=4 l=4]  *leasi
+	subl	20(%rbx), %r8d	# 354	[c=13 l=4]  *subsi_1/1
+	movq	-344(%rbp), %r11	# 1249	[c=9 l=7]  *movdi_internal/3
+	comisd	.LC21(%rip), %xmm3	# 357	[c=10 l=8]  *cmpidf/1
+	jbe	.L370	# 358	[c=13 l=6]  *jcc
+.L287:
+	movl	%r8d, %eax	# 392	[c=1 l=3]  *zero_extendsidi2/3
+	pxor	%xmm1, %xmm1	# 1476	[c=4 l=4]  movv2df_internal/0
+	cvtsi2sdq	%rax, %xmm1	# 1477	[c=4 l=5]  sse2_cvtsi2sdq/0
+	divsd	%xmm3, %xmm1	# 407	[c=68 l=4]  *fop_df_1/2
+.L289:
+	comisd	.LC21(%rip), %xmm2	# 412	[c=10 l=8]  *cmpidf/1
+	movq	904(%rbx), %rdi	# 410	[c=9 l=7]  *movdi_internal/3
+	ja	.L288	# 413	[c=13 l=6]  *jcc
+	movl	$60, %ecx	# 473	[c=4 l=5]  *movdi_internal/2
+	movq	%r10, %rax	# 1199	[c=4 l=3]  *movdi_internal/3
+	xorl	%edx, %edx	# 1377	[c=4 l=2]  *movdi_xor
+	movq	%r10, %r9	# 487	[c=4 l=3]  *movdi_internal/3
+	divq	%rcx	# 1305	[c=0 l=3]  *udivmoddi4_noext
+	movsd	%xmm2, -320(%rbp)	# 1263	[c=4 l=8]  *movdf_internal/15
+	pxor	%xmm0, %xmm0	# 486	[c=4 l=4]  *movdf_internal/12
+	movq	%rax, %rsi	# 1200	[c=4 l=3]  *movdi_internal/3
+	movq	%rdx, %rcx	# 1201	[c=4 l=3]  *movdi_internal/3
+	xorl	%edx, %edx	# 1380	[c=4 l=2]  *movdi_xor
+	pushq	%rax	# 1379	[c=4 l=1]  *pushdi2_rex64/0
+	movq	%r11, %rax	# 1202	[c=4 l=3]  *movdi_internal/3
+	pushq	%r8	# 478	[c=4 l=2]  *pushsi2_rex64/0
+	pushq	%r8	# 479	[c=4 l=2]  *pushsi2_rex64/0
+	movl	$1000, %r8d	# 481	[c=4 l=6]  *movdi_internal/2
+	divq	%r8	# 1307	[c=0 l=3]  *udivmoddi4_noext
+	movq	%rsi, %rdx	# 490	[c=4 l=3]  *movdi_internal/3
+	movq	%r11, %r8	# 488	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC23(%rip), %rsi	# 491	[c=1 l=7]  *movdi_internal/4
+	pushq	%rax	# 483	[c=4 l=1]  *pushdi2_rex64/0
+	movl	$2, %eax	# 494	[c=4 l=5]  *movqi_internal/3
+	call	fprintf@PLT	# 495	[c=10 l=5]  *call_value
+	movsd	-304(%rbp), %xmm7	# 1204	[c=9 l=8]  *movdf_internal/14
+	addq	$32, %rsp	# 497	[c=4 l=4]  *adddi_1/0
+	comisd	.LC21(%rip), %xmm7	# 499	[c=10 l=8]  *cmpidf/1
+	movsd	-320(%rbp), %xmm2	# 1264	[c=9 l=8]  *movdf_internal/14
+	jbe	.L371	# 500	[c=13 l=6]  *jcc
+.L300:
+	movq	40(%rbx), %rax	# 453	[c=9 l=4]  *movdi_internal/3
+	testq	%rax, %rax	# 456	[c=4 l=3]  *cmpdi_ccno_1/0
+	js	.L297	# 457	[c=13 l=6]  *jcc
+	pxor	%xmm1, %xmm1	# 1474	[c=4 l=4]  movv2df_internal/0
+	cvtsi2sdq	%rax, %xmm1	# 1475	[c=4 l=5]  sse2_cvtsi2sdq/0
+.L298:
+	divsd	-304(%rbp), %xmm1	# 468	[c=77 l=8]  *fop_df_1/2
+.L299:
+	comisd	.LC21(%rip), %xmm2	# 505	[c=10 l=8]  *cmpidf/1
+	movq	904(%rbx), %rdi	# 503	[c=9 l=7]  *movdi_internal/3
+	ja	.L295	# 506	[c=13 l=6]  *jcc
+	movq	-288(%rbp), %rax	# 1215	[c=9 l=7]  *movdi_internal/3
+	movl	$60, %ecx	# 557	[c=4 l=5]  *movdi_internal/2
+	xorl	%edx, %edx	# 1365	[c=4 l=2]  *movdi_xor
+	pushq	%r8	# 1367	[c=4 l=2]  *pushdi2_rex64/0
+	movl	$1000, %r8d	# 563	[c=4 l=6]  *movdi_internal/2
+	movq	-288(%rbp), %r9	# 569	[c=9 l=7]  *movdi_internal/3
+	pxor	%xmm0, %xmm0	# 568	[c=4 l=4]  *movdf_internal/12
+	divq	%rcx	# 1297	[c=0 l=3]  *udivmoddi4_noext
+	movq	%rax, %rsi	# 1216	[c=4 l=3]  *movdi_internal/3
+	movq	-296(%rbp), %rax	# 1218	[c=9 l=7]  *movdi_internal/3
+	movq	%rdx, %rcx	# 1217	[c=4 l=3]  *movdi_internal/3
+	xorl	%edx, %edx	# 1368	[c=4 l=2]  *movdi_xor
+	divq	%r8	# 1299	[c=0 l=3]  *udivmoddi4_noext
+	movq	-296(%rbp), %r8	# 570	[c=9 l=7]  *movdi_internal/3
+	movq	%rsi, %rdx	# 572	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC24(%rip), %rsi	# 573	[c=1 l=7]  *movdi_internal/4
+	pushq	%rax	# 565	[c=4 l=1]  *pushdi2_rex64/0
+	movl	$2, %eax	# 576	[c=4 l=5]  *movqi_internal/3
+	call	fprintf@PLT	# 577	[c=10 l=5]  *call_value
+	popq	%r9	# 1369	[c=9 l=2]  *popdi1
+	pxor	%xmm1, %xmm1	# 25	[c=4 l=4]  *movdf_internal/12
+	popq	%r10	# 1370	[c=9 l=2]  *popdi1
+.L305:
+	movq	-272(%rbp), %rax	# 1220	[c=9 l=7]  *movdi_internal/3
+	movl	$60, %ecx	# 582	[c=4 l=5]  *movdi_internal/2
+	xorl	%edx, %edx	# 1359	[c=4 l=2]  *movdi_xor
+	movl	$1000, %r8d	# 589	[c=4 l=6]  *movdi_internal/2
+	movq	904(%rbx), %rdi	# 586	[c=9 l=7]  *movdi_internal/3
+	divq	%rcx	# 1293	[c=0 l=3]  *udivmoddi4_noext
+	movq	%rax, %rsi	# 1221	[c=4 l=3]  *movdi_internal/3
+	pushq	%rax	# 1361	[c=4 l=1]  *pushdi2_rex64/0
+	movq	-280(%rbp), %rax	# 1223	[c=9 l=7]  *movdi_internal/3
+	movq	%rdx, %rcx	# 1222	[c=4 l=3]  *movdi_internal/3
+	xorl	%edx, %edx	# 1362	[c=4 l=2]  *movdi_xor
+	movsd	-312(%rbp), %xmm0	# 593	[c=9 l=8]  *movdf_internal/14
+	movq	-272(%rbp), %r9	# 594	[c=9 l=7]  *movdi_internal/3
+	divq	%r8	# 1295	[c=0 l=3]  *udivmoddi4_noext
+	movq	-280(%rbp), %r8	# 595	[c=9 l=7]  *movdi_internal/3
+	movq	%rsi, %rdx	# 597	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC25(%rip), %rsi	# 598	[c=1 l=7]  *movdi_internal/4
+	pushq	%rax	# 591	[c=4 l=1]  *pushdi2_rex64/0
+	movl	$2, %eax	# 601	[c=4 l=5]  *movqi_internal/3
+	call	fprintf@PLT	# 602	[c=10 l=5]  *call_value
+	cmpl	$0, 536(%rbx)	# 604	[c=13 l=7]  *cmpsi_ccno_1/1
+	popq	%rdx	# 1363	[c=9 l=1]  *popdi1
+	popq	%rcx	# 1364	[c=9 l=1]  *popdi1
+	jne	.L312	# 605	[c=13 l=6]  *jcc
+	cmpl	$0, 600(%rbx)	# 617	[c=13 l=7]  *cmpsi_ccno_1/1
+	jne	.L307	# 618	[c=13 l=6]  *jcc
+	cmpl	$0, 584(%rbx)	# 620	[c=13 l=7]  *cmpsi_ccno_1/1
+	je	.L259	# 621	[c=13 l=6]  *jcc
+	cmpl	$0, 488(%rbx)	# 623	[c=13 l=7]  *cmpsi_ccno_1/1
+	je	.L259	# 624	[c=13 l=6]  *jcc
+	jmp	.L307	# 1416	[c=1 l=5]  jump
+.L369:
+	movq	904(%rbx), %rdi	# 769	[c=9 l=7]  *movdi_internal/3
+	leaq	.LC30(%rip), %rsi	# 771	[c=1 l=7]  *movdi_internal/4
+	xorl	%eax, %eax	# 1354	[c=4 l=2]  *movdi_xor
+	call	fprintf@PLT	# 775	[c=10 l=5]  *call_value
+	jmp	.L323	# 1418	[c=1 l=5]  jump
+.L368:
+	movq	904(%rbx), %rdi	# 745	[c=9 l=7]  *movdi_internal/3
+	leaq	.LC28(%rip), %rsi	# 747	[c=1 l=7]  *movdi_internal/4
+	xorl	%eax, %eax	# 1356	[c=4 l=2]  *movdi_xor
+	call	fprintf@PLT	# 751	[c=10 l=5]  *call_value
+	jmp	.L322	# 1420	[c=1 l=5]  jump
+.L367:
+	leaq	.LC17(%rip), %rdx	# 27	[c=1 l=7]  *movdi_internal/4
+	jmp	.L320	# 1422	[c=1 l=5]  jump
+.L370:
+	movq	904(%rbx), %rdi	# 966	[c=9 l=7]  *movdi_internal/3
+	pxor	%xmm1, %xmm1	# 22	[c=4 l=4]  *movdf_internal/12
+.L288:
+	movl	$60, %ecx	# 422	[c=4 l=5]  *movdi_internal/2
+	movq	%r10, %rax	# 1190	[c=4 l=3]  *movdi_internal/3
+	xorl	%edx, %edx	# 1381	[c=4 l=2]  *movdi_xor
+	movq	%r10, %r9	# 436	[c=4 l=3]  *movdi_internal/3
+	divq	%rcx	# 1309	[c=0 l=3]  *udivmoddi4_noext
+	movsd	%xmm2, -320(%rbp)	# 1261	[c=4 l=8]  *movdf_internal/15
+	mulsd	-312(%rbp), %xmm3	# 420	[c=29 l=8]  *fop_df_comm/1
+	divsd	%xmm2, %xmm3	# 421	[c=68 l=4]  *fop_df_1/2
+	movq	%rax, %rsi	# 1191	[c=4 l=3]  *movdi_internal/3
+	movq	%rdx, %rcx	# 1192	[c=4 l=3]  *movdi_internal/3
+	xorl	%edx, %edx	# 1384	[c=4 l=2]  *movdi_xor
+	pushq	%rax	# 1383	[c=4 l=1]  *pushdi2_rex64/0
+	movq	%r11, %rax	# 1193	[c=4 l=3]  *movdi_internal/3
+	pushq	%r8	# 428	[c=4 l=2]  *pushsi2_rex64/0
+	pushq	%r8	# 429	[c=4 l=2]  *pushsi2_rex64/0
+	movl	$1000, %r8d	# 431	[c=4 l=6]  *movdi_internal/2
+	divq	%r8	# 1311	[c=0 l=3]  *udivmoddi4_noext
+	movq	%rsi, %rdx	# 439	[c=4 l=3]  *movdi_internal/3
+	movq	%r11, %r8	# 437	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC23(%rip), %rsi	# 440	[c=1 l=7]  *movdi_internal/4
+	movapd	%xmm3, %xmm0	# 1189	[c=4 l=4]  *movdf_internal/13
+	pushq	%rax	# 433	[c=4 l=1]  *pushdi2_rex64/0
+	movl	$2, %eax	# 443	[c=4 l=5]  *movqi_internal/3
+	call	fprintf@PLT	# 444	[c=10 l=5]  *call_value
+	movsd	-304(%rbp), %xmm7	# 1195	[c=9 l=8]  *movdf_internal/14
+	addq	$32, %rsp	# 445	[c=4 l=4]  *adddi_1/0
+	comisd	.LC21(%rip), %xmm7	# 447	[c=10 l=8]  *cmpidf/1
+	movsd	-320(%rbp), %xmm2	# 1262	[c=9 l=8]  *movdf_internal/14
+	ja	.L300	# 448	[c=13 l=6]  *jcc
+	movq	904(%rbx), %rdi	# 969	[c=9 l=7]  *movdi_internal/3
+	pxor	%xmm1, %xmm1	# 24	[c=4 l=4]  *movdf_internal/12
+.L295:
+	movq	-288(%rbp), %rax	# 1208	[c=9 l=7]  *movdi_internal/3
+	movl	$60, %ecx	# 515	[c=4 l=5]  *movdi_internal/2
+	xorl	%edx, %edx	# 1373	[c=4 l=2]  *movdi_xor
+	movsd	-304(%rbp), %xmm0	# 1205	[c=9 l=8]  *movdf_internal/14
+	mulsd	-312(%rbp), %xmm0	# 513	[c=29 l=8]  *fop_df_comm/1
+	movsd	%xmm2, -304(%rbp)	# 1267	[c=4 l=8]  *movdf_internal/15
+	movl	$1000, %r8d	# 522	[c=4 l=6]  *movdi_internal/2
+	divq	%rcx	# 1301	[c=0 l=3]  *udivmoddi4_noext
+	divsd	%xmm2, %xmm0	# 514	[c=68 l=4]  *fop_df_1/2
+	movq	%rax, %rsi	# 1209	[c=4 l=3]  *movdi_internal/3
+	pushq	%rax	# 1375	[c=4 l=1]  *pushdi2_rex64/0
+	movq	-296(%rbp), %rax	# 1211	[c=9 l=7]  *movdi_internal/3
+	movq	%rdx, %rcx	# 1210	[c=4 l=3]  *movdi_internal/3
+	xorl	%edx, %edx	# 1376	[c=4 l=2]  *movdi_xor
+	movq	-288(%rbp), %r9	# 527	[c=9 l=7]  *movdi_internal/3
+	divq	%r8	# 1303	[c=0 l=3]  *udivmoddi4_noext
+	movq	-296(%rbp), %r8	# 528	[c=9 l=7]  *movdi_internal/3
+	movq	%rsi, %rdx	# 530	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC24(%rip), %rsi	# 531	[c=1 l=7]  *movdi_internal/4
+	pushq	%rax	# 524	[c=4 l=1]  *pushdi2_rex64/0
+	movl	$2, %eax	# 534	[c=4 l=5]  *movqi_internal/3
+	call	fprintf@PLT	# 535	[c=10 l=5]  *call_value
+	movq	40(%rbx), %rax	# 536	[c=9 l=4]  *movdi_internal/3
+	movsd	-304(%rbp), %xmm2	# 1268	[c=9 l=8]  *movdf_internal/14
+	testq	%rax, %rax	# 539	[c=4 l=3]  *cmpdi_ccno_1/0
+	js	.L303	# 540	[c=13 l=6]  *jcc
+	pxor	%xmm1, %xmm1	# 1472	[c=4 l=4]  movv2df_internal/0
+	cvtsi2sdq	%rax, %xmm1	# 1473	[c=4 l=5]  sse2_cvtsi2sdq/0
+.L304:
+	divsd	%xmm2, %xmm1	# 551	[c=68 l=4]  *fop_df_1/2
+	popq	%r11	# 1371	[c=9 l=2]  *popdi1
+	popq	%rax	# 1372	[c=9 l=1]  *popdi1
+	jmp	.L305	# 1424	[c=1 l=5]  jump
+.L351:
+	movq	%r11, -336(%rbp)	# 1257	[c=4 l=7]  *movdi_internal/5
+	pxor	%xmm0, %xmm0	# 370	[c=4 l=4]  *movdf_internal/12
+	movq	%r10, -328(%rbp)	# 1255	[c=4 l=7]  *movdi_internal/5
+	movsd	%xmm3, -344(%rbp)	# 1259	[c=4 l=8]  *movdf_internal/15
+	movsd	%xmm2, -312(%rbp)	# 1253	[c=4 l=8]  *movdf_internal/15
+	pushq	%rdx	# 1386	[c=4 l=1]  *pushdi2_rex64/0
+	movq	%rax, %rdx	# 374	[c=4 l=3]  *movdi_internal/3
+	movl	$2, %eax	# 378	[c=4 l=5]  *movqi_internal/3
+	pushq	%rsi	# 365	[c=4 l=1]  *pushsi2_rex64/0
+	pushq	%rsi	# 366	[c=4 l=1]  *pushsi2_rex64/0
+	leaq	.LC22(%rip), %rsi	# 375	[c=1 l=7]  *movdi_internal/4
+	pushq	-320(%rbp)	# 367	[c=9 l=6]  *pushdi2_rex64/0
+	call	fprintf@PLT	# 379	[c=10 l=5]  *call_value
+	movl	24(%rbx), %eax	# 1184	[c=9 l=3]  *movsi_internal/0
+	movsd	-344(%rbp), %xmm3	# 1260	[c=9 l=8]  *movdf_internal/14
+	addq	$32, %rsp	# 383	[c=4 l=4]  *adddi_1/0
+	movsd	-312(%rbp), %xmm2	# 1254	[c=9 l=8]  *movdf_internal/14
+	movq	-328(%rbp), %r10	# 1256	[c=9 l=7]  *movdi_internal/3
+	leal	1(%rax), %r8d	# 1312	[c=4 l=4]  *leasi
+	subl	20(%rbx), %r8d	# 382	[c=13 l=4]  *subsi_1/1
+	movq	-336(%rbp), %r11	# 1258	[c=9 l=7]  *movdi_internal/3
+	comisd	.LC21(%rip), %xmm3	# 385	[c=10 l=8]  *cmpidf/1
+	jbe	.L352	# 386	[c=13 l=6]  *jcc
+	movsd	.LC11(%rip), %xmm7	# 967	[c=6 l=8]  *movdf_internal/14
+	movsd	%xmm7, -312(%rbp)	# 1185	[c=4 l=8]  *movdf_internal/15
+	jmp	.L287	# 1426	[c=1 l=5]  jump
+.L274:
+	movq	%r11, %rdx	# 1162	[c=4 l=3]  *movdi_internal/3
+	movq	%r11, %rcx	# 1164	[c=4 l=3]  *movdi_internal/3
+	pxor	%xmm1, %xmm1	# 1470	[c=4 l=4]  movv2df_internal/0
+	shrq	%rdx	# 238	[c=4 l=3]  *lshrdi3_1/0
+	andl	$1, %ecx	# 239	[c=4 l=3]  *anddi_1/0
+	orq	%rcx, %rdx	# 240	[c=4 l=3]  *iordi_1/0
+	cvtsi2sdq	%rdx, %xmm1	# 1471	[c=4 l=5]  sse2_cvtsi2sdq/0
+	addsd	%xmm1, %xmm1	# 242	[c=12 l=4]  *fop_df_comm/1
+	jmp	.L275	# 1428	[c=1 l=5]  jump
+.L272:
+	movq	%r10, %rdx	# 1158	[c=4 l=3]  *movdi_internal/3
+	movq	%r10, %rcx	# 1160	[c=4 l=3]  *movdi_internal/3
+	pxor	%xmm3, %xmm3	# 1468	[c=4 l=4]  movv2df_internal/0
+	shrq	%rdx	# 222	[c=4 l=3]  *lshrdi3_1/0
+	andl	$1, %ecx	# 223	[c=4 l=3]  *anddi_1/0
+	orq	%rcx, %rdx	# 224	[c=4 l=3]  *iordi_1/0
+	cvtsi2sdq	%rdx, %xmm3	# 1469	[c=4 l=5]  sse2_cvtsi2sdq/0
+	addsd	%xmm3, %xmm3	# 226	[c=12 l=4]  *fop_df_comm/1
+	jmp	.L273	# 1430	[c=1 l=5]  jump
+.L269:
+	movq	-296(%rbp), %rcx	# 1242	[c=9 l=7]  *movdi_internal/3
+	pxor	%xmm0, %xmm0	# 1466	[c=4 l=4]  movv2df_internal/0
+	movq	%rcx, %rax	# 1150	[c=4 l=3]  *movdi_internal/3
+	andl	$1, %ecx	# 195	[c=4 l=3]  *anddi_1/0
+	shrq	%rax	# 194	[c=4 l=3]  *lshrdi3_1/0
+	orq	%rcx, %rax	# 196	[c=4 l=3]  *iordi_1/0
+	cvtsi2sdq	%rax, %xmm0	# 1467	[c=4 l=5]  sse2_cvtsi2sdq/0
+	addsd	%xmm0, %xmm0	# 198	[c=12 l=4]  *fop_df_comm/1
+	jmp	.L270	# 1432	[c=1 l=5]  jump
+.L267:
+	movq	-288(%rbp), %rcx	# 1240	[c=9 l=7]  *movdi_internal/3
+	pxor	%xmm1, %xmm1	# 1464	[c=4 l=4]  movv2df_internal/0
+	movq	%rcx, %rax	# 1145	[c=4 l=3]  *movdi_internal/3
+	andl	$1, %ecx	# 179	[c=4 l=3]  *anddi_1/0
+	shrq	%rax	# 178	[c=4 l=3]  *lshrdi3_1/0
+	orq	%rcx, %rax	# 180	[c=4 l=3]  *iordi_1/0
+	cvtsi2sdq	%rax, %xmm1	# 1465	[c=4 l=5]  sse2_cvtsi2sdq/0
+	addsd	%xmm1, %xmm1	# 182	[c=12 l=4]  *fop_df_comm/1
+	jmp	.L268	# 1434	[c=1 l=5]  jump
+.L279:
+	movq	%r8, %rax	# 1172	[c=4 l=3]  *movdi_internal/3
+	movq	%r8, %rdx	# 1174	[c=4 l=3]  *movdi_internal/3
+	pxor	%xmm1, %xmm1	# 1462	[c=4 l=4]  movv2df_internal/0
+	shrq	%rax	# 281	[c=4 l=3]  *lshrdi3_1/0
+	andl	$1, %edx	# 282	[c=4 l=3]  *anddi_1/0
+	orq	%rdx, %rax	# 283	[c=4 l=3]  *iordi_1/0
+	cvtsi2sdq	%rax, %xmm1	# 1463	[c=4 l=5]  sse2_cvtsi2sdq/0
+	addsd	%xmm1, %xmm1	# 285	[c=12 l=4]  *fop_df_comm/1
+	jmp	.L280	# 1436	[c=1 l=5]  jump
+.L277:
+	movq	%r9, %rax	# 1168	[c=4 l=3]  *movdi_internal/3
+	movq	%r9, %rdx	# 1170	[c=4 l=3]  *movdi_internal/3
+	pxor	%xmm0, %xmm0	# 1460	[c=4 l=4]  movv2df_internal/0
+	shrq	%rax	# 265	[c=4 l=3]  *lshrdi3_1/0
+	andl	$1, %edx	# 266	[c=4 l=3]  *anddi_1/0
+	orq	%rdx, %rax	# 267	[c=4 l=3]  *iordi_1/0
+	cvtsi2sdq	%rax, %xmm0	# 1461	[c=4 l=5]  sse2_cvtsi2sdq/0
+	addsd	%xmm0, %xmm0	# 269	[c=12 l=4]  *fop_df_comm/1
+	jmp	.L278	# 1438	[c=1 l=5]  jump
+.L264:
+	movq	-280(%rbp), %rsi	# 1236	[c=9 l=7]  *movdi_internal/3
+	pxor	%xmm0, %xmm0	# 1458	[c=4 l=4]  movv2df_internal/0
+	movq	%rsi, %rdx	# 1132	[c=4 l=3]  *movdi_internal/3
+	andl	$1, %esi	# 151	[c=4 l=3]  *anddi_1/0
+	shrq	%rdx	# 150	[c=4 l=3]  *lshrdi3_1/0
+	orq	%rsi, %rdx	# 152	[c=4 l=3]  *iordi_1/0
+	cvtsi2sdq	%rdx, %xmm0	# 1459	[c=4 l=5]  sse2_cvtsi2sdq/0
+	addsd	%xmm0, %xmm0	# 154	[c=12 l=4]  *fop_df_comm/1
+	jmp	.L265	# 1440	[c=1 l=5]  jump
+.L262:
+	movq	-272(%rbp), %rsi	# 1234	[c=9 l=7]  *movdi_internal/3
+	pxor	%xmm2, %xmm2	# 1456	[c=4 l=4]  movv2df_internal/0
+	movq	%rsi, %rdx	# 1127	[c=4 l=3]  *movdi_internal/3
+	andl	$1, %esi	# 135	[c=4 l=3]  *anddi_1/0
+	shrq	%rdx	# 134	[c=4 l=3]  *lshrdi3_1/0
+	orq	%rsi, %rdx	# 136	[c=4 l=3]  *iordi_1/0
+	cvtsi2sdq	%rdx, %xmm2	# 1457	[c=4 l=5]  sse2_cvtsi2sdq/0
+	addsd	%xmm2, %xmm2	# 138	[c=12 l=4]  *fop_df_comm/1
+	jmp	.L263	# 1442	[c=1 l=5]  jump
+.L371:
+	pxor	%xmm1, %xmm1	# 23	[c=4 l=4]  *movdf_internal/12
+	jmp	.L299	# 1444	[c=1 l=5]  jump
+.L352:
+	movsd	.LC11(%rip), %xmm6	# 968	[c=6 l=8]  *movdf_internal/14
+	pxor	%xmm1, %xmm1	# 21	[c=4 l=4]  *movdf_internal/12
+	movsd	%xmm6, -312(%rbp)	# 1186	[c=4 l=8]  *movdf_internal/15
+	jmp	.L289	# 1446	[c=1 l=5]  jump
+.L297:
+	movq	%rax, %rdx	# 1196	[c=4 l=3]  *movdi_internal/3
+	andl	$1, %eax	# 463	[c=4 l=3]  *anddi_1/0
+	pxor	%xmm1, %xmm1	# 1454	[c=4 l=4]  movv2df_internal/0
+	shrq	%rdx	# 462	[c=4 l=3]  *lshrdi3_1/0
+	orq	%rax, %rdx	# 464	[c=4 l=3]  *iordi_1/0
+	cvtsi2sdq	%rdx, %xmm1	# 1455	[c=4 l=5]  sse2_cvtsi2sdq/0
+	addsd	%xmm1, %xmm1	# 466	[c=12 l=4]  *fop_df_comm/1
+	jmp	.L298	# 1448	[c=1 l=5]  jump
+.L303:
+	movq	%rax, %rdx	# 1213	[c=4 l=3]  *movdi_internal/3
+	andl	$1, %eax	# 546	[c=4 l=3]  *anddi_1/0
+	pxor	%xmm1, %xmm1	# 1452	[c=4 l=4]  movv2df_internal/0
+	shrq	%rdx	# 545	[c=4 l=3]  *lshrdi3_1/0
+	orq	%rax, %rdx	# 547	[c=4 l=3]  *iordi_1/0
+	cvtsi2sdq	%rdx, %xmm1	# 1453	[c=4 l=5]  sse2_cvtsi2sdq/0
+	addsd	%xmm1, %xmm1	# 549	[c=12 l=4]  *fop_df_comm/1
+	jmp	.L304	# 1450	[c=1 l=5]  jump
+	.cfi_endproc
+.LFE29:
+	.size	leave, .-leave
+	.section	.rodata.str1.1
+.LC33:
+	.string	"code must be unreachable"
+	.text
+	.p2align 4
+	.globl	log_cpu_address
+	.type	log_cpu_address, @function
+log_cpu_address:
+.LFB56:
+	.cfi_startproc
+	cmpl	$2, %edx	# 8	[c=4 l=3]  *cmpsi_1/0
+	je	.L373	# 9	[c=13 l=2]  *jcc
+	jg	.L374	# 14	[c=13 l=2]  *jcc
+	testl	%edx, %edx	# 16	[c=4 l=2]  *cmpsi_ccno_1/0
+	je	.L375	# 17	[c=13 l=2]  *jcc
+	cmpl	$1, %edx	# 19	[c=4 l=3]  *cmpsi_1/0
+	jne	.L377	# 20	[c=13 l=2]  *jcc
+	movq	1040(%rdi), %rax	# 123	[c=9 l=7]  *movdi_internal/3
+	movslq	%esi, %rsi	# 40	[c=4 l=3]  *extendsidi2_rex64/1
+	addq	%rsi, %rax	# 124	[c=4 l=3]  *adddi_1/0
+	ret		# 87	[c=0 l=1]  simple_return_internal
+	.p2align 4,,10
+	.p2align 3
+.L374:
+	cmpl	$3, %edx	# 26	[c=4 l=3]  *cmpsi_1/0
+	jne	.L377	# 27	[c=13 l=2]  *jcc
+	movq	1048(%rdi), %rax	# 119	[c=9 l=7]  *movdi_internal/3
+	movslq	%esi, %rsi	# 54	[c=4 l=3]  *extendsidi2_rex64/1
+	addq	%rsi, %rax	# 120	[c=4 l=3]  *adddi_1/0
+	ret		# 107	[c=0 l=1]  simple_return_internal
+	.p2align 4,,10
+	.p2align 3
+.L373:
+	movq	1056(%rdi), %rax	# 121	[c=9 l=7]  *movdi_internal/3
+	movslq	%esi, %rsi	# 47	[c=4 l=3]  *extendsidi2_rex64/1
+	addq	%rsi, %rax	# 122	[c=4 l=3]  *adddi_1/0
+	ret		# 89	[c=0 l=1]  simple_return_internal
+	.p2align 4,,10
+	.p2align 3
+.L375:
+	movslq	%esi, %rsi	# 34	[c=4 l=3]  *extendsidi2_rex64/1
+	leaq	1004(%rdi,%rsi), %rax	# 35	[c=5 l=8]  *leadi
+	ret		# 85	[c=0 l=1]  simple_return_internal
+.L377:
+	pushq	%rax	# 117	[c=4 l=1]  *pushdi2_prologue
+	.cfi_def_cfa_offset 16
+	leaq	.LC33(%rip), %rdx	# 61	[c=1 l=7]  *movdi_internal/4
+	movl	$8, %esi	# 63	[c=4 l=5]  *movsi_internal/0
+	xorl	%eax, %eax	# 118	[c=4 l=2]  *movdi_xor
+	call	leave	# 66	[c=0 l=5]  *call
+	.cfi_endproc
+.LFE56:
+	.size	log_cpu_address, .-log_cpu_address
+	.section	.rodata.str1.8
+	.align 8
+.LC34:
+	.string	"program counter 0x%x out of bounds (0x%x--0x%x)"
+	.text
+	.p2align 4
+	.type	bad_PC, @function
+bad_PC:
+.LFB75:
+	.cfi_startproc
+	subq	$8, %rsp	# 27	[c=4 l=4]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_def_cfa_offset 16
+	movl	24(%rdi), %eax	# 7	[c=9 l=3]  *movsi_internal/0
+	movl	20(%rdi), %r8d	# 12	[c=9 l=4]  *movsi_internal/0
+	leal	(%rsi,%rsi), %ecx	# 26	[c=12 l=3]  *leasi
+	leaq	.LC34(%rip), %rdx	# 14	[c=1 l=7]  *movdi_internal/4
+	movl	$1, %esi	# 16	[c=4 l=5]  *movsi_internal/0
+	leal	-1(%rax), %r9d	# 11	[c=4 l=4]  *leasi
+	xorl	%eax, %eax	# 34	[c=4 l=2]  *movdi_xor
+	call	leave	# 19	[c=0 l=5]  *call
+	.cfi_endproc
+.LFE75:
+	.size	bad_PC, .-bad_PC
+	.section	.rodata.str1.8
+	.align 8
+.LC35:
+	.string	"stack pointer overflow (SP = 0x%04x)"
+	.text
+	.p2align 4
+	.type	stack_overflow, @function
+stack_overflow:
+.LFB71:
+	.cfi_startproc
+	movl	%esi, %ecx	# 3	[c=4 l=2]  *movsi_internal/0
+	subq	$8, %rsp	# 20	[c=4 l=4]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_def_cfa_offset 16
+	leaq	.LC35(%rip), %rdx	# 8	[c=1 l=7]  *movdi_internal/4
+	xorl	%eax, %eax	# 27	[c=4 l=2]  *movdi_xor
+	movl	$1, %esi	# 10	[c=4 l=5]  *movsi_internal/0
+	call	leave	# 13	[c=0 l=5]  *call
+	.cfi_endproc
+.LFE71:
+	.size	stack_overflow, .-stack_overflow
+	.section	.rodata.str1.8
+	.align 8
+.LC36:
+	.string	"access to unmapped RAM address 0x%x (RAMEND = 0x%04x)"
+	.text
+	.p2align 4
+	.type	bad_address, @function
+bad_address:
+.LFB30:
+	.cfi_startproc
+	subq	$8, %rsp	# 22	[c=4 l=4]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_def_cfa_offset 16
+	movl	1000(%rdi), %r8d	# 8	[c=9 l=7]  *movsi_internal/0
+	movl	%esi, %ecx	# 3	[c=4 l=2]  *movsi_internal/0
+	xorl	%eax, %eax	# 29	[c=4 l=2]  *movdi_xor
+	leaq	.LC36(%rip), %rdx	# 10	[c=1 l=7]  *movdi_internal/4
+	movl	$1, %esi	# 12	[c=4 l=5]  *movsi_internal/0
+	call	leave	# 15	[c=0 l=5]  *call
+	.cfi_endproc
+.LFE30:
+	.size	bad_address, .-bad_address
+	.p2align 4
+	.type	data_read_mapped, @function
+data_read_mapped:
+.LFB35:
+	.cfi_startproc
+	movl	%esi, %eax	# 87	[c=4 l=2]  *movsi_internal/0
+	subl	5176(%rdi), %eax	# 8	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rdi), %eax	# 9	[c=13 l=6]  *cmpsi_1/1
+	jb	.L389	# 10	[c=13 l=2]  *jcc
+	movl	%esi, %eax	# 89	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %eax	# 12	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 85	[c=5 l=5]  *andsi_1_zext
+	movzbl	1080(%rdi,%rax), %eax	# 15	[c=10 l=8]  *movqi_internal/4
+	cmpb	$3, %al	# 16	[c=4 l=2]  *cmpqi_1/0
+	je	.L390	# 17	[c=13 l=2]  *jcc
+	cmpb	$4, %al	# 19	[c=4 l=2]  *cmpqi_1/0
+	je	.L391	# 20	[c=13 l=2]  *jcc
+	cmpb	$2, %al	# 22	[c=4 l=2]  *cmpqi_1/0
+	je	.L397	# 23	[c=13 l=2]  *jcc
+.L389:
+	subq	$8, %rsp	# 93	[c=4 l=4]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_def_cfa_offset 16
+	call	bad_address	# 61	[c=0 l=5]  *call
+	.p2align 4,,10
+	.p2align 3
+.L397:
+	.cfi_def_cfa_offset 8
+	movl	992(%rdi), %eax	# 25	[c=9 l=6]  *movsi_internal/0
+	subl	$16384, %esi	# 28	[c=4 l=6]  *addsi_1/0
+	movq	1056(%rdi), %rdx	# 31	[c=9 l=7]  *movdi_internal/3
+	leal	1(%rax,%rax), %eax	# 27	[c=8 l=4]  *leasi
+	andl	%esi, %eax	# 29	[c=4 l=2]  *andsi_1/0
+	cltq	# 30	[c=4 l=2]  *extendsidi2_rex64/0
+	movzbl	(%rdx,%rax), %eax	# 32	[c=13 l=4]  *zero_extendqisi2/0
+	ret		# 77	[c=0 l=1]  simple_return_internal
+	.p2align 4,,10
+	.p2align 3
+.L391:
+	movl	%esi, %eax	# 91	[c=4 l=2]  *movsi_internal/0
+	movq	1072(%rdi), %rdx	# 47	[c=9 l=7]  *movdi_internal/3
+	sarl	$12, %eax	# 44	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 84	[c=5 l=5]  *andsi_1_zext
+	movq	(%rdx,%rax,8), %rdx	# 48	[c=10 l=4]  *movdi_internal/3
+	xorl	%eax, %eax	# 109	[c=4 l=2]  *movdi_xor
+	testq	%rdx, %rdx	# 49	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L388	# 50	[c=13 l=2]  *jcc
+	andl	$4095, %esi	# 83	[c=5 l=6]  *andsi_1_zext
+	movzbl	(%rdx,%rsi), %eax	# 54	[c=13 l=4]  *zero_extendqisi2/0
+	ret		# 81	[c=0 l=1]  simple_return_internal
+	.p2align 4,,10
+	.p2align 3
+.L390:
+	movq	1048(%rdi), %rax	# 38	[c=9 l=7]  *movdi_internal/3
+	movslq	%esi, %rsi	# 37	[c=4 l=3]  *extendsidi2_rex64/1
+	movzbl	-4096(%rax,%rsi), %eax	# 39	[c=14 l=8]  *zero_extendqisi2/0
+	ret		# 79	[c=0 l=1]  simple_return_internal
+	.p2align 4,,10
+	.p2align 3
+.L388:
+	ret		# 100	[c=0 l=1]  simple_return_internal
+	.cfi_endproc
+.LFE35:
+	.size	data_read_mapped, .-data_read_mapped
+	.p2align 4
+	.type	data_read_page, @function
+data_read_page:
+.LFB45:
+	.cfi_startproc
+	movl	%esi, %eax	# 130	[c=4 l=2]  *movsi_internal/0
+	subl	5176(%rdi), %eax	# 8	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rdi), %eax	# 9	[c=13 l=6]  *cmpsi_1/1
+	jb	.L399	# 10	[c=13 l=2]  *jcc
+	movl	%esi, %eax	# 132	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %eax	# 12	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 128	[c=5 l=5]  *andsi_1_zext
+	movzbl	1080(%rdi,%rax), %eax	# 15	[c=10 l=8]  *movqi_internal/4
+	cmpb	$1, %al	# 16	[c=4 l=2]  *cmpqi_1/0
+	je	.L400	# 17	[c=13 l=2]  *jcc
+	cmpb	$2, %al	# 19	[c=4 l=2]  *cmpqi_1/0
+	je	.L401	# 20	[c=13 l=2]  *jcc
+.L399:
+	jmp	data_read_mapped	# 99	[c=10 l=5]  *sibcall_value
+	.p2align 4,,10
+	.p2align 3
+.L401:
+	addq	$1, 48(%rdi)	# 94	[c=13 l=5]  *adddi_1/0
+	jmp	data_read_mapped	# 156	[c=10 l=5]  *sibcall_value
+	.p2align 4,,10
+	.p2align 3
+.L400:
+	cmpl	$63, %esi	# 26	[c=4 l=3]  *cmpsi_1/0
+	je	.L417	# 27	[c=13 l=2]  *jcc
+.L402:
+	cmpl	6564(%rdi), %esi	# 46	[c=13 l=6]  *cmpsi_1/1
+	jnb	.L403	# 47	[c=13 l=2]  *jcc
+	movslq	%esi, %rax	# 49	[c=4 l=3]  *extendsidi2_rex64/1
+	cmpb	$0, 6568(%rdi,%rax)	# 50	[c=14 l=8]  *cmpqi_ccno_1/1
+	je	.L403	# 51	[c=13 l=2]  *jcc
+	cmpl	$1, 96(%rdi)	# 62	[c=13 l=4]  *cmpsi_1/0
+	movq	48(%rdi), %rdx	# 61	[c=9 l=4]  *movdi_internal/3
+	je	.L418	# 63	[c=13 l=2]  *jcc
+.L407:
+	jmp	periph_read@PLT	# 76	[c=10 l=5]  *sibcall_value
+	.p2align 4,,10
+	.p2align 3
+.L403:
+	cmpl	%esi, 1000(%rdi)	# 54	[c=13 l=6]  *cmpsi_1/0
+	jb	.L419	# 55	[c=13 l=2]  *jcc
+	movq	1040(%rdi), %rax	# 88	[c=9 l=7]  *movdi_internal/3
+	movslq	%esi, %rsi	# 87	[c=4 l=3]  *extendsidi2_rex64/1
+	movzbl	(%rax,%rsi), %eax	# 89	[c=13 l=4]  *zero_extendqisi2/0
+	ret		# 141	[c=0 l=1]  simple_return_internal
+	.p2align 4,,10
+	.p2align 3
+.L417:
+	movzbl	100(%rdi), %eax	# 29	[c=9 l=4]  *movqi_internal/4
+	testb	%al, %al	# 30	[c=4 l=2]  *cmpqi_ccno_1/0
+	je	.L402	# 31	[c=13 l=2]  *jcc
+	movq	1040(%rdi), %r8	# 33	[c=9 l=7]  *movdi_internal/3
+	movzbl	%al, %ecx	# 35	[c=4 l=3]  *zero_extendqisi2/0
+	notl	%ecx	# 36	[c=4 l=2]  *one_cmplsi2_1/0
+	movzbl	63(%r8), %edx	# 34	[c=13 l=5]  *zero_extendqisi2/0
+	andl	%ecx, %edx	# 37	[c=4 l=2]  *andsi_1/0
+	movq	104(%rdi), %rcx	# 38	[c=9 l=4]  *movdi_internal/3
+	andb	(%rcx), %al	# 39	[c=9 l=2]  *andqi_1/1
+	movzbl	%al, %eax	# 40	[c=4 l=3]  *zero_extendqisi2/0
+	orl	%edx, %eax	# 41	[c=4 l=2]  *iorsi_1/0
+	movb	%al, 63(%r8)	# 42	[c=4 l=4]  *movqi_internal/8
+	movb	$0, 100(%rdi)	# 43	[c=4 l=4]  *movqi_internal/8
+	jmp	.L402	# 164	[c=1 l=5]  jump
+	.p2align 4,,10
+	.p2align 3
+.L418:
+	movl	(%rdi), %eax	# 65	[c=6 l=2]  *zero_extendsidi2/3
+	salq	$4, %rax	# 67	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rdi), %rax	# 68	[c=13 l=7]  *adddi_1/1
+	movzwl	14(%rax), %eax	# 69	[c=13 l=4]  zero_extendhidi2/0
+	subq	%rax, %rdx	# 70	[c=4 l=3]  *subdi_1/0
+	jmp	.L407	# 166	[c=1 l=5]  jump
+.L419:
+	pushq	%rax	# 154	[c=4 l=1]  *pushdi2_prologue
+	.cfi_def_cfa_offset 16
+	call	bad_address	# 83	[c=0 l=5]  *call
+	.cfi_endproc
+.LFE45:
+	.size	data_read_page, .-data_read_page
+	.section	.rodata.str1.1
+.LC37:
+	.string	"external memory"
+	.text
+	.p2align 4
+	.type	data_write_mapped, @function
+data_write_mapped:
+.LFB36:
+	.cfi_startproc
+	pushq	%r12	# 121	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	movl	%esi, %eax	# 112	[c=4 l=2]  *movsi_internal/0
+	pushq	%rbp	# 122	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	movq	%rdi, %rbp	# 2	[c=4 l=3]  *movdi_internal/3
+	pushq	%rbx	# 123	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	movl	%esi, %ebx	# 3	[c=4 l=2]  *movsi_internal/0
+	subq	$16, %rsp	# 124	[c=4 l=4]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_def_cfa_offset 48
+	subl	5176(%rdi), %eax	# 8	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rdi), %eax	# 9	[c=13 l=6]  *cmpsi_1/1
+	jb	.L421	# 10	[c=13 l=2]  *jcc
+	movl	%esi, %eax	# 114	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %eax	# 12	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 110	[c=5 l=5]  *andsi_1_zext
+	movzbl	1080(%rdi,%rax), %eax	# 15	[c=10 l=8]  *movqi_internal/4
+	cmpb	$3, %al	# 16	[c=4 l=2]  *cmpqi_1/0
+	je	.L422	# 17	[c=13 l=2]  *jcc
+	cmpb	$4, %al	# 19	[c=4 l=2]  *cmpqi_1/0
+	jne	.L421	# 20	[c=13 l=2]  *jcc
+	movl	%esi, %eax	# 116	[c=4 l=2]  *movsi_internal/0
+	movq	1072(%rdi), %rcx	# 38	[c=9 l=7]  *movdi_internal/3
+	sarl	$12, %eax	# 34	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 109	[c=5 l=5]  *andsi_1_zext
+	leaq	(%rcx,%rax,8), %r12	# 39	[c=8 l=4]  *leadi
+	movq	(%r12), %rax	# 40	[c=5 l=4]  *movdi_internal/3
+	testq	%rax, %rax	# 41	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L433	# 42	[c=13 l=2]  *jcc
+.L424:
+	andl	$4095, %ebx	# 108	[c=5 l=6]  *andsi_1_zext
+	movb	%dl, (%rax,%rbx)	# 79	[c=4 l=3]  *movqi_internal/8
+	addq	$16, %rsp	# 127	[c=4 l=4]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_remember_state
+	.cfi_def_cfa_offset 32
+	popq	%rbx	# 128	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 24
+	popq	%rbp	# 129	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 16
+	popq	%r12	# 130	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 8
+	ret		# 131	[c=0 l=1]  simple_return_internal
+	.p2align 4,,10
+	.p2align 3
+.L422:
+	.cfi_restore_state
+	addq	$16, %rsp	# 135	[c=4 l=4]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_remember_state
+	.cfi_def_cfa_offset 32
+	leal	-4096(%rsi), %esi	# 120	[c=4 l=6]  *leasi
+	popq	%rbx	# 136	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 24
+	popq	%rbp	# 137	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 16
+	popq	%r12	# 138	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 8
+	jmp	eeprom_write_mapped@PLT	# 30	[c=0 l=5]  *sibcall
+	.p2align 4,,10
+	.p2align 3
+.L421:
+	.cfi_restore_state
+	movl	%ebx, %esi	# 84	[c=4 l=2]  *movsi_internal/0
+	movq	%rbp, %rdi	# 85	[c=4 l=3]  *movdi_internal/3
+	call	bad_address	# 86	[c=0 l=5]  *call
+	.p2align 4,,10
+	.p2align 3
+.L433:
+	movl	$4128, %esi	# 44	[c=4 l=5]  *movdi_internal/2
+	movl	$1, %edi	# 45	[c=4 l=5]  *movdi_internal/2
+	movl	%edx, 12(%rsp)	# 118	[c=4 l=4]  *movsi_internal/1
+	call	calloc@PLT	# 46	[c=10 l=5]  *call_value
+	movl	12(%rsp), %edx	# 119	[c=9 l=4]  *movsi_internal/0
+	testq	%rax, %rax	# 49	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L434	# 50	[c=13 l=2]  *jcc
+	movq	984(%rbp), %rcx	# 64	[c=9 l=7]  *movdi_internal/3
+	movq	%rcx, (%rax)	# 65	[c=4 l=3]  *movdi_internal/5
+	testq	%rcx, %rcx	# 66	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L426	# 67	[c=13 l=2]  *jcc
+	movq	%rax, 8(%rcx)	# 69	[c=4 l=4]  *movdi_internal/5
+.L426:
+	movq	%rax, 984(%rbp)	# 72	[c=4 l=7]  *movdi_internal/5
+	addq	$32, %rax	# 73	[c=4 l=4]  *adddi_1/0
+	movq	%rax, (%r12)	# 74	[c=4 l=4]  *movdi_internal/5
+	jmp	.L424	# 142	[c=1 l=5]  jump
+.L434:
+	leaq	.LC37(%rip), %r9	# 52	[c=1 l=7]  *movdi_internal/4
+	movl	$1, %r8d	# 53	[c=4 l=6]  *movsi_internal/0
+	movq	%rbp, %rdi	# 58	[c=4 l=3]  *movdi_internal/3
+	movl	$4096, %ecx	# 54	[c=4 l=5]  *movsi_internal/0
+	leaq	.LC4(%rip), %rdx	# 55	[c=1 l=7]  *movdi_internal/4
+	movl	$6, %esi	# 57	[c=4 l=5]  *movsi_internal/0
+	call	leave	# 60	[c=0 l=5]  *call
+	.cfi_endproc
+.LFE36:
+	.size	data_write_mapped, .-data_write_mapped
+	.p2align 4
+	.type	pop_byte, @function
+pop_byte:
+.LFB73:
+	.cfi_startproc
+	pushq	%r15	# 237	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	movl	$62, %eax	# 10	[c=4 l=5]  *movsi_internal/0
+	pushq	%r14	# 238	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13	# 239	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12	# 240	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	movl	$61, %r12d	# 7	[c=4 l=6]  *movsi_internal/0
+	pushq	%rbp	# 241	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx	# 242	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	movq	%rdi, %rbx	# 2	[c=4 l=3]  *movdi_internal/3
+	subq	$8, %rsp	# 243	[c=4 l=4]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_def_cfa_offset 64
+	movl	5176(%rdi), %edx	# 6	[c=9 l=6]  *movsi_internal/0
+	movl	5180(%rdi), %r14d	# 9	[c=9 l=7]  *movsi_internal/0
+	subl	%edx, %eax	# 11	[c=4 l=2]  *subsi_1/0
+	subl	%edx, %r12d	# 8	[c=4 l=3]  *subsi_1/0
+	movl	%eax, %r13d	# 223	[c=4 l=3]  *movsi_internal/0
+	cmpl	%r14d, %r12d	# 12	[c=4 l=3]  *cmpsi_1/0
+	jb	.L436	# 13	[c=13 l=6]  *jcc
+	cmpb	$1, 1081(%rdi)	# 17	[c=13 l=7]  *cmpqi_1/0
+	ja	.L459	# 18	[c=13 l=6]  *jcc
+	movq	1040(%rdi), %rdx	# 177	[c=9 l=7]  *movdi_internal/3
+	movzbl	61(%rdx), %r15d	# 178	[c=13 l=5]  *zero_extendqisi2/0
+	cmpl	%r14d, %eax	# 180	[c=4 l=3]  *cmpsi_1/0
+	jb	.L460	# 181	[c=13 l=6]  *jcc
+.L452:
+	cmpb	$1, 1081(%rbx)	# 32	[c=13 l=7]  *cmpqi_1/0
+	ja	.L461	# 33	[c=13 l=6]  *jcc
+.L451:
+	movzbl	62(%rdx), %ebp	# 150	[c=13 l=4]  *zero_extendqisi2/0
+	sall	$8, %ebp	# 151	[c=4 l=3]  *ashlsi3_1/0
+	orl	%r15d, %ebp	# 152	[c=4 l=3]  *iorsi_1/0
+	addl	$1, %ebp	# 153	[c=4 l=3]  *addsi_1/0
+.L443:
+	movb	%bpl, 61(%rdx)	# 75	[c=4 l=4]  *movqi_internal/8
+.L444:
+	movl	%ebp, %edx	# 226	[c=4 l=2]  *movsi_internal/0
+	movl	$62, %eax	# 79	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%rbx), %eax	# 80	[c=13 l=6]  *subsi_1/1
+	sarl	$8, %edx	# 78	[c=4 l=3]  *ashrsi3_1/0
+	cmpl	5180(%rbx), %eax	# 81	[c=13 l=6]  *cmpsi_1/1
+	jb	.L445	# 82	[c=13 l=2]  *jcc
+	cmpb	$1, 1081(%rbx)	# 86	[c=13 l=7]  *cmpqi_1/0
+	ja	.L462	# 87	[c=13 l=2]  *jcc
+.L445:
+	movq	1040(%rbx), %rax	# 98	[c=9 l=7]  *movdi_internal/3
+	movb	%dl, 62(%rax)	# 99	[c=4 l=3]  *movqi_internal/8
+.L446:
+	movl	%ebp, %eax	# 228	[c=4 l=2]  *movsi_internal/0
+	subl	5176(%rbx), %eax	# 102	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %eax	# 103	[c=13 l=6]  *cmpsi_1/1
+	jb	.L447	# 104	[c=13 l=2]  *jcc
+	movl	%ebp, %eax	# 230	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %eax	# 106	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 220	[c=5 l=5]  *andsi_1_zext
+	cmpb	$0, 1080(%rbx,%rax)	# 109	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L463	# 110	[c=13 l=2]  *jcc
+.L447:
+	movq	1040(%rbx), %rax	# 114	[c=9 l=7]  *movdi_internal/3
+	movslq	%ebp, %rbp	# 113	[c=4 l=3]  *extendsidi2_rex64/1
+	movzbl	(%rax,%rbp), %eax	# 115	[c=13 l=4]  *zero_extendqisi2/0
+	addq	$8, %rsp	# 246	[c=4 l=4]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx	# 247	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 48
+	popq	%rbp	# 248	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 40
+	popq	%r12	# 249	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 32
+	popq	%r13	# 250	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 24
+	popq	%r14	# 251	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 16
+	popq	%r15	# 252	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 8
+	ret		# 253	[c=0 l=1]  simple_return_internal
+	.p2align 4,,10
+	.p2align 3
+.L436:
+	.cfi_restore_state
+	movq	1040(%rdi), %rdx	# 158	[c=9 l=7]  *movdi_internal/3
+	movzbl	61(%rdx), %r15d	# 159	[c=13 l=5]  *zero_extendqisi2/0
+	cmpl	%r14d, %eax	# 161	[c=4 l=3]  *cmpsi_1/0
+	jnb	.L452	# 162	[c=13 l=6]  *jcc
+	jmp	.L451	# 278	[c=1 l=5]  jump
+	.p2align 4,,10
+	.p2align 3
+.L462:
+	movzbl	%dl, %edx	# 89	[c=4 l=3]  *zero_extendqisi2/0
+	movl	$62, %esi	# 91	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 92	[c=4 l=3]  *movdi_internal/3
+	call	data_write_mapped	# 93	[c=0 l=5]  *call
+	jmp	.L446	# 280	[c=1 l=5]  jump
+	.p2align 4,,10
+	.p2align 3
+.L463:
+	addq	$8, %rsp	# 257	[c=4 l=4]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	movl	%ebp, %esi	# 120	[c=4 l=2]  *movsi_internal/0
+	movq	%rbx, %rdi	# 121	[c=4 l=3]  *movdi_internal/3
+	popq	%rbx	# 258	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 48
+	popq	%rbp	# 259	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 40
+	popq	%r12	# 260	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 32
+	popq	%r13	# 261	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 24
+	popq	%r14	# 262	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 16
+	popq	%r15	# 263	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 8
+	jmp	data_read_page	# 122	[c=10 l=5]  *sibcall_value
+	.p2align 4,,10
+	.p2align 3
+.L459:
+	.cfi_restore_state
+	movl	$61, %esi	# 20	[c=4 l=5]  *movsi_internal/0
+	call	data_read_mapped	# 22	[c=10 l=5]  *call_value
+	movl	%eax, %r12d	# 23	[c=4 l=3]  *movsi_internal/0
+	cmpl	%r14d, %r13d	# 24	[c=4 l=3]  *cmpsi_1/0
+	jb	.L464	# 25	[c=13 l=6]  *jcc
+	movl	$62, %esi	# 139	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 140	[c=4 l=3]  *movdi_internal/3
+	call	data_read_mapped	# 141	[c=10 l=5]  *call_value
+	sall	$8, %eax	# 143	[c=4 l=3]  *ashlsi3_1/0
+	movl	%eax, %ebp	# 233	[c=4 l=2]  *movsi_internal/0
+	orl	%r12d, %ebp	# 144	[c=4 l=3]  *iorsi_1/0
+	addl	$1, %ebp	# 145	[c=4 l=3]  *addsi_1/0
+.L458:
+	movzbl	%bpl, %edx	# 61	[c=4 l=4]  *zero_extendqisi2/0
+	movl	$61, %esi	# 65	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 66	[c=4 l=3]  *movdi_internal/3
+	call	data_write_mapped	# 67	[c=0 l=5]  *call
+	jmp	.L444	# 283	[c=1 l=5]  jump
+	.p2align 4,,10
+	.p2align 3
+.L460:
+	movzbl	62(%rdx), %ebp	# 168	[c=13 l=4]  *zero_extendqisi2/0
+	sall	$8, %ebp	# 169	[c=4 l=3]  *ashlsi3_1/0
+	orl	%r15d, %ebp	# 170	[c=4 l=3]  *iorsi_1/0
+	addl	$1, %ebp	# 171	[c=4 l=3]  *addsi_1/0
+.L453:
+	cmpb	$1, 1081(%rbx)	# 58	[c=13 l=7]  *cmpqi_1/0
+	ja	.L458	# 59	[c=13 l=2]  *jcc
+	jmp	.L443	# 286	[c=1 l=5]  jump
+	.p2align 4,,10
+	.p2align 3
+.L461:
+	movl	$62, %esi	# 35	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 36	[c=4 l=3]  *movdi_internal/3
+	call	data_read_mapped	# 37	[c=10 l=5]  *call_value
+	sall	$8, %eax	# 39	[c=4 l=3]  *ashlsi3_1/0
+	movl	%eax, %ebp	# 225	[c=4 l=2]  *movsi_internal/0
+	orl	%r15d, %ebp	# 40	[c=4 l=3]  *iorsi_1/0
+	addl	$1, %ebp	# 41	[c=4 l=3]  *addsi_1/0
+	cmpl	%r14d, %r12d	# 42	[c=4 l=3]  *cmpsi_1/0
+	jnb	.L458	# 43	[c=13 l=2]  *jcc
+	movq	1040(%rbx), %rdx	# 72	[c=9 l=7]  *movdi_internal/3
+	jmp	.L443	# 288	[c=1 l=5]  jump
+	.p2align 4,,10
+	.p2align 3
+.L464:
+	movq	1040(%rbx), %rdx	# 50	[c=9 l=7]  *movdi_internal/3
+	movzbl	62(%rdx), %ebp	# 51	[c=13 l=4]  *zero_extendqisi2/0
+	sall	$8, %ebp	# 52	[c=4 l=3]  *ashlsi3_1/0
+	orl	%eax, %ebp	# 53	[c=4 l=2]  *iorsi_1/0
+	addl	$1, %ebp	# 54	[c=4 l=3]  *addsi_1/0
+	jmp	.L453	# 290	[c=1 l=2]  jump
+	.cfi_endproc
+.LFE73:
+	.size	pop_byte, .-pop_byte
+	.p2align 4
+	.type	data_write_page, @function
+data_write_page:
+.LFB46:
+	.cfi_startproc
+	movl	%esi, %eax	# 118	[c=4 l=2]  *movsi_internal/0
+	subl	5176(%rdi), %eax	# 9	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rdi), %eax	# 10	[c=13 l=6]  *cmpsi_1/1
+	jb	.L466	# 11	[c=13 l=2]  *jcc
+	movl	%esi, %eax	# 120	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %eax	# 13	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 116	[c=5 l=5]  *andsi_1_zext
+	cmpb	$1, 1080(%rdi,%rax)	# 16	[c=14 l=8]  *cmpqi_1/0
+	je	.L467	# 17	[c=13 l=2]  *jcc
+.L466:
+	jmp	data_write_mapped	# 23	[c=0 l=5]  *sibcall
+	.p2align 4,,10
+	.p2align 3
+.L467:
+	cmpl	$63, %esi	# 27	[c=4 l=3]  *cmpsi_1/0
+	je	.L483	# 28	[c=13 l=2]  *jcc
+	cmpl	6564(%rdi), %esi	# 53	[c=13 l=6]  *cmpsi_1/1
+	jnb	.L471	# 54	[c=13 l=2]  *jcc
+	movslq	%esi, %rax	# 56	[c=4 l=3]  *extendsidi2_rex64/1
+	cmpb	$0, 6568(%rdi,%rax)	# 57	[c=14 l=8]  *cmpqi_ccno_1/1
+	je	.L471	# 58	[c=13 l=2]  *jcc
+	cmpl	$1, 96(%rdi)	# 69	[c=13 l=4]  *cmpsi_1/0
+	movq	48(%rdi), %rcx	# 68	[c=9 l=4]  *movdi_internal/3
+	je	.L484	# 70	[c=13 l=2]  *jcc
+.L475:
+	jmp	periph_write@PLT	# 84	[c=0 l=5]  *sibcall
+	.p2align 4,,10
+	.p2align 3
+.L483:
+	movzbl	100(%rdi), %eax	# 30	[c=9 l=4]  *movqi_internal/4
+	testb	%al, %al	# 31	[c=4 l=2]  *cmpqi_ccno_1/0
+	je	.L469	# 32	[c=13 l=2]  *jcc
+	movq	1040(%rdi), %r8	# 34	[c=9 l=7]  *movdi_internal/3
+	movzbl	%al, %esi	# 36	[c=4 l=3]  *zero_extendqisi2/0
+	notl	%esi	# 37	[c=4 l=2]  *one_cmplsi2_1/0
+	movzbl	63(%r8), %ecx	# 35	[c=13 l=5]  *zero_extendqisi2/0
+	andl	%esi, %ecx	# 38	[c=4 l=2]  *andsi_1/0
+	movq	104(%rdi), %rsi	# 39	[c=9 l=4]  *movdi_internal/3
+	andb	(%rsi), %al	# 40	[c=9 l=2]  *andqi_1/1
+	movzbl	%al, %eax	# 41	[c=4 l=3]  *zero_extendqisi2/0
+	orl	%ecx, %eax	# 42	[c=4 l=2]  *iorsi_1/0
+	movb	%al, 63(%r8)	# 43	[c=4 l=4]  *movqi_internal/8
+	movb	$0, 100(%rdi)	# 44	[c=4 l=4]  *movqi_internal/8
+.L469:
+	movq	1040(%rdi), %rax	# 47	[c=9 l=7]  *movdi_internal/3
+	movb	%dl, 63(%rax)	# 48	[c=4 l=3]  *movqi_internal/8
+	ret		# 110	[c=0 l=1]  simple_return_internal
+	.p2align 4,,10
+	.p2align 3
+.L471:
+	cmpl	%esi, 1000(%rdi)	# 61	[c=13 l=6]  *cmpsi_1/0
+	jb	.L485	# 62	[c=13 l=2]  *jcc
+	movq	1040(%rdi), %rax	# 95	[c=9 l=7]  *movdi_internal/3
+	movslq	%esi, %rsi	# 94	[c=4 l=3]  *extendsidi2_rex64/1
+	movb	%dl, (%rax,%rsi)	# 96	[c=4 l=3]  *movqi_internal/8
+	ret		# 129	[c=0 l=1]  simple_return_internal
+.L484:
+	movl	(%rdi), %eax	# 72	[c=6 l=2]  *zero_extendsidi2/3
+	salq	$4, %rax	# 74	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rdi), %rax	# 75	[c=13 l=7]  *adddi_1/1
+	movzwl	14(%rax), %eax	# 76	[c=13 l=4]  zero_extendhidi2/0
+	subq	%rax, %rcx	# 77	[c=4 l=3]  *subdi_1/0
+	jmp	.L475	# 146	[c=1 l=2]  jump
+.L485:
+	pushq	%rax	# 142	[c=4 l=1]  *pushdi2_prologue
+	.cfi_def_cfa_offset 16
+	call	bad_address	# 90	[c=0 l=5]  *call
+	.cfi_endproc
+.LFE46:
+	.size	data_write_page, .-data_write_page
+	.p2align 4
+	.type	do_events, @function
+do_events:
+.LFB215:
+	.cfi_startproc
+	pushq	%r15	# 416	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14	# 417	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13	# 418	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12	# 419	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp	# 420	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx	# 421	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	movq	%rdi, %rbx	# 2	[c=4 l=3]  *movdi_internal/3
+	subq	$8, %rsp	# 422	[c=4 l=4]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_def_cfa_offset 64
+	cmpb	$0, 6040(%rdi)	# 6	[c=13 l=7]  *cmpqi_ccno_1/1
+	jne	.L525	# 7	[c=13 l=6]  *jcc
+.L488:
+	movq	%rbx, %rdi	# 38	[c=4 l=3]  *movdi_internal/3
+	call	events_run@PLT	# 39	[c=0 l=5]  *call
+	movq	1040(%rbx), %rax	# 41	[c=9 l=7]  *movdi_internal/3
+	movzbl	100(%rbx), %ecx	# 40	[c=13 l=4]  *zero_extendqisi2/0
+	movzbl	63(%rax), %eax	# 42	[c=13 l=4]  *zero_extendqisi2/0
+	movl	%ecx, %edx	# 415	[c=4 l=2]  *movsi_internal/0
+	notl	%ecx	# 44	[c=4 l=2]  *one_cmplsi2_1/0
+	andl	%ecx, %eax	# 45	[c=4 l=2]  *andsi_1/0
+	movq	104(%rbx), %rcx	# 46	[c=9 l=4]  *movdi_internal/3
+	andb	(%rcx), %dl	# 47	[c=9 l=2]  *andqi_1/1
+	orl	%edx, %eax	# 49	[c=4 l=2]  *iorsi_1/0
+	testb	$-128, %al	# 413	[c=4 l=2]  *testqi_1_maybe_si/1
+	je	.L490	# 52	[c=13 l=6]  *jcc
+	movq	6024(%rbx), %rax	# 54	[c=9 l=7]  *movdi_internal/3
+	cmpq	%rax, 48(%rbx)	# 55	[c=13 l=4]  *cmpdi_1/0
+	je	.L491	# 56	[c=13 l=6]  *jcc
+	movq	%rbx, %rdi	# 58	[c=4 l=3]  *movdi_internal/3
+	call	irq_take@PLT	# 59	[c=10 l=5]  *call_value
+	movl	%eax, %r13d	# 60	[c=4 l=3]  *movsi_internal/0
+	testl	%eax, %eax	# 63	[c=4 l=2]  *cmpsi_ccno_1/0
+	js	.L490	# 64	[c=13 l=6]  *jcc
+	movl	%eax, %esi	# 71	[c=4 l=2]  *movsi_internal/0
+	movq	%rbx, %rdi	# 72	[c=4 l=3]  *movdi_internal/3
+	call	periph_irq_taken@PLT	# 73	[c=0 l=5]  *call
+	movl	5176(%rbx), %r12d	# 74	[c=9 l=7]  *movsi_internal/0
+	movl	$61, %eax	# 76	[c=4 l=5]  *movsi_internal/0
+	movl	5180(%rbx), %r15d	# 75	[c=9 l=7]  *movsi_internal/0
+	subl	%r12d, %eax	# 77	[c=4 l=3]  *subsi_1/0
+	cmpl	%r15d, %eax	# 78	[c=4 l=3]  *cmpsi_1/0
+	jb	.L493	# 79	[c=13 l=6]  *jcc
+	cmpb	$1, 1081(%rbx)	# 83	[c=13 l=7]  *cmpqi_1/0
+	ja	.L526	# 84	[c=13 l=6]  *jcc
+	movq	1040(%rbx), %rax	# 335	[c=9 l=7]  *movdi_internal/3
+	movzbl	61(%rax), %r14d	# 336	[c=13 l=5]  *zero_extendqisi2/0
+.L497:
+	movzbl	62(%rax), %ebp	# 123	[c=13 l=4]  *zero_extendqisi2/0
+.L498:
+	movl	996(%rbx), %edx	# 129	[c=9 l=6]  *movsi_internal/0
+	movzbl	840(%rbx), %eax	# 131	[c=13 l=7]  *zero_extendqisi2/0
+	sall	$8, %ebp	# 126	[c=4 l=3]  *ashlsi3_1/0
+	orl	%r14d, %ebp	# 127	[c=4 l=3]  *iorsi_1/0
+	leal	1(%rdx,%rax), %eax	# 132	[c=5 l=4]  *leasi
+	cmpl	%eax, %ebp	# 133	[c=4 l=2]  *cmpsi_1/0
+	jb	.L527	# 134	[c=13 l=6]  *jcc
+	movl	%ebp, %eax	# 386	[c=4 l=2]  *movsi_internal/0
+	movl	(%rbx), %edx	# 142	[c=5 l=2]  *movsi_internal/0
+	leal	-1(%rbp), %r14d	# 412	[c=4 l=4]  *leasi
+	subl	%r12d, %eax	# 144	[c=4 l=3]  *subsi_1/0
+	cmpl	%r15d, %eax	# 145	[c=4 l=3]  *cmpsi_1/0
+	jb	.L500	# 146	[c=13 l=2]  *jcc
+	movl	%ebp, %eax	# 388	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %eax	# 148	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 382	[c=5 l=5]  *andsi_1_zext
+	cmpb	$0, 1080(%rbx,%rax)	# 151	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L501	# 152	[c=13 l=6]  *jcc
+.L500:
+	movq	1040(%rbx), %rcx	# 156	[c=9 l=7]  *movdi_internal/3
+	movslq	%ebp, %rax	# 155	[c=4 l=3]  *extendsidi2_rex64/1
+	movb	%dl, (%rcx,%rax)	# 157	[c=4 l=3]  *movqi_internal/8
+.L502:
+	movl	(%rbx), %edx	# 390	[c=5 l=2]  *movsi_internal/0
+	movl	%r14d, %eax	# 392	[c=4 l=3]  *movsi_internal/0
+	leal	-2(%rbp), %r12d	# 411	[c=4 l=4]  *leasi
+	subl	5176(%rbx), %eax	# 171	[c=13 l=6]  *subsi_1/1
+	shrl	$8, %edx	# 169	[c=4 l=3]  *lshrsi3_1/0
+	cmpl	5180(%rbx), %eax	# 172	[c=13 l=6]  *cmpsi_1/1
+	jb	.L503	# 173	[c=13 l=2]  *jcc
+	movl	%r14d, %eax	# 394	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %eax	# 175	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 381	[c=5 l=5]  *andsi_1_zext
+	cmpb	$0, 1080(%rbx,%rax)	# 178	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L504	# 179	[c=13 l=6]  *jcc
+.L503:
+	movq	1040(%rbx), %rax	# 183	[c=9 l=7]  *movdi_internal/3
+	movslq	%r14d, %r14	# 182	[c=4 l=3]  *extendsidi2_rex64/1
+	movb	%dl, (%rax,%r14)	# 184	[c=4 l=4]  *movqi_internal/8
+.L505:
+	cmpb	$0, 840(%rbx)	# 195	[c=13 l=7]  *cmpqi_ccno_1/1
+	je	.L506	# 196	[c=13 l=2]  *jcc
+	movl	(%rbx), %edx	# 396	[c=5 l=2]  *movsi_internal/0
+	movl	%r12d, %eax	# 398	[c=4 l=3]  *movsi_internal/0
+	subl	5176(%rbx), %eax	# 200	[c=13 l=6]  *subsi_1/1
+	shrl	$16, %edx	# 199	[c=4 l=3]  *lshrsi3_1/0
+	cmpl	5180(%rbx), %eax	# 201	[c=13 l=6]  *cmpsi_1/1
+	jb	.L507	# 202	[c=13 l=2]  *jcc
+	movl	%r12d, %eax	# 400	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %eax	# 204	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 380	[c=5 l=5]  *andsi_1_zext
+	cmpb	$0, 1080(%rbx,%rax)	# 207	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L508	# 208	[c=13 l=6]  *jcc
+.L507:
+	movq	1040(%rbx), %rax	# 212	[c=9 l=7]  *movdi_internal/3
+	movslq	%r12d, %r12	# 211	[c=4 l=3]  *extendsidi2_rex64/1
+	movb	%dl, (%rax,%r12)	# 213	[c=4 l=4]  *movqi_internal/8
+.L509:
+	leal	-3(%rbp), %r12d	# 410	[c=4 l=4]  *leasi
+	.p2align 4,,10
+	.p2align 3
+.L506:
+	movl	$61, %eax	# 227	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%rbx), %eax	# 228	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %eax	# 229	[c=13 l=6]  *cmpsi_1/1
+	jb	.L510	# 230	[c=13 l=2]  *jcc
+	cmpb	$1, 1081(%rbx)	# 234	[c=13 l=7]  *cmpqi_1/0
+	ja	.L528	# 235	[c=13 l=6]  *jcc
+.L510:
+	movq	1040(%rbx), %rax	# 246	[c=9 l=7]  *movdi_internal/3
+	movb	%r12b, 61(%rax)	# 247	[c=4 l=4]  *movqi_internal/8
+.L511:
+	movl	$62, %eax	# 251	[c=4 l=5]  *movsi_internal/0
+	sarl	$8, %r12d	# 250	[c=4 l=4]  *ashrsi3_1/0
+	subl	5176(%rbx), %eax	# 252	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %eax	# 253	[c=13 l=6]  *cmpsi_1/1
+	jb	.L512	# 254	[c=13 l=2]  *jcc
+	cmpb	$1, 1081(%rbx)	# 258	[c=13 l=7]  *cmpqi_1/0
+	ja	.L529	# 259	[c=13 l=6]  *jcc
+.L512:
+	movq	1040(%rbx), %rax	# 270	[c=9 l=7]  *movdi_internal/3
+	movb	%r12b, 62(%rax)	# 271	[c=4 l=4]  *movqi_internal/8
+.L513:
+	movq	104(%rbx), %rdx	# 276	[c=9 l=4]  *movdi_internal/3
+	movzbl	100(%rbx), %eax	# 274	[c=13 l=4]  *zero_extendqisi2/0
+	movzbl	840(%rbx), %ecx	# 285	[c=13 l=7]  zero_extendqidi2/0
+	movzbl	(%rdx), %esi	# 447	[c=5 l=3]  *movqi_internal/4
+	leaq	101(%rbx), %rdx	# 409	[c=4 l=4]  *leadi
+	andb	$127, %al	# 405	[c=4 l=2]  *andqi_1_slp/0
+	movl	%r13d, (%rbx)	# 283	[c=4 l=3]  *movsi_internal/1
+	movq	%rdx, 104(%rbx)	# 282	[c=4 l=4]  *movdi_internal/5
+	movq	48(%rbx), %rdx	# 287	[c=9 l=4]  *movdi_internal/3
+	andl	%eax, %esi	# 477	[c=4 l=2]  *andsi_1/0
+	orl	$-128, %eax	# 408	[c=4 l=3]  *iorsi_1/0
+	leaq	4(%rcx,%rdx), %rdx	# 288	[c=5 l=5]  *leadi
+	movb	%sil, 101(%rbx)	# 278	[c=4 l=4]  *movqi_internal/8
+	movb	%al, 100(%rbx)	# 280	[c=4 l=3]  *movqi_internal/8
+	movq	%rdx, 48(%rbx)	# 289	[c=4 l=4]  *movdi_internal/5
+	cmpq	6032(%rbx), %rdx	# 290	[c=13 l=7]  *cmpdi_1/1
+	jb	.L486	# 291	[c=13 l=2]  *jcc
+.L514:
+	movq	1040(%rbx), %rdi	# 312	[c=9 l=7]  *movdi_internal/3
+	movzbl	%al, %ecx	# 314	[c=4 l=3]  *zero_extendqisi2/0
+	andl	%esi, %eax	# 404	[c=4 l=2]  *andsi_1/0
+	notl	%ecx	# 315	[c=4 l=2]  *one_cmplsi2_1/0
+	movzbl	%al, %eax	# 318	[c=4 l=3]  *zero_extendqisi2/0
+	movzbl	63(%rdi), %edx	# 313	[c=13 l=4]  *zero_extendqisi2/0
+	andl	%ecx, %edx	# 316	[c=4 l=2]  *andsi_1/0
+	orl	%edx, %eax	# 319	[c=4 l=2]  *iorsi_1/0
+	movb	%al, 63(%rdi)	# 320	[c=4 l=3]  *movqi_internal/8
+	movb	$0, 100(%rbx)	# 321	[c=4 l=4]  *movqi_internal/8
+	jmp	.L517	# 454	[c=1 l=2]  jump
+	.p2align 4,,10
+	.p2align 3
+.L490:
+	movq	48(%rbx), %rax	# 297	[c=9 l=4]  *movdi_internal/3
+.L491:
+	cmpq	6032(%rbx), %rax	# 301	[c=13 l=7]  *cmpdi_1/1
+	jb	.L486	# 302	[c=13 l=2]  *jcc
+	movzbl	100(%rbx), %eax	# 304	[c=9 l=4]  *movqi_internal/4
+	testb	%al, %al	# 305	[c=4 l=2]  *cmpqi_ccno_1/0
+	jne	.L530	# 306	[c=13 l=6]  *jcc
+.L517:
+	movq	%rbx, %rdi	# 324	[c=4 l=3]  *movdi_internal/3
+	call	checkpoint_begin@PLT	# 325	[c=0 l=5]  *call
+	addq	$8, %rsp	# 436	[c=4 l=4]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	movq	%rbx, %rdi	# 326	[c=4 l=3]  *movdi_internal/3
+	popq	%rbx	# 437	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 48
+	popq	%rbp	# 438	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 40
+	popq	%r12	# 439	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 32
+	popq	%r13	# 440	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 24
+	popq	%r14	# 441	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 16
+	popq	%r15	# 442	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 8
+	jmp	checkpoint_end@PLT	# 327	[c=0 l=5]  *sibcall
+	.p2align 4,,10
+	.p2align 3
+.L486:
+	.cfi_restore_state
+	addq	$8, %rsp	# 425	[c=4 l=4]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx	# 426	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 48
+	popq	%rbp	# 427	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 40
+	popq	%r12	# 428	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 32
+	popq	%r13	# 429	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 24
+	popq	%r14	# 430	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 16
+	popq	%r15	# 431	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 8
+	ret		# 432	[c=0 l=1]  simple_return_internal
+	.p2align 4,,10
+	.p2align 3
+.L525:
+	.cfi_restore_state
+	call	fork_server_poll@PLT	# 14	[c=10 l=5]  *call_value
+	testb	%al, %al	# 17	[c=4 l=2]  *cmpqi_ccno_1/0
+	je	.L488	# 18	[c=13 l=6]  *jcc
+	movl	820(%rbx), %edx	# 20	[c=9 l=6]  *movsi_internal/0
+	movzwl	816(%rbx), %eax	# 27	[c=13 l=7]  *zero_extendhisi2/0
+	movzbl	%dh, %ecx	# 28	[c=4 l=3]  *extzvsi
+	sall	$8, %eax	# 29	[c=4 l=3]  *ashlsi3_1/0
+	movzbl	%dl, %edx	# 31	[c=4 l=3]  *zero_extendqisi2/0
+	orl	%ecx, %eax	# 30	[c=4 l=2]  *iorsi_1/0
+	sall	$8, %eax	# 32	[c=4 l=3]  *ashlsi3_1/0
+	orl	%edx, %eax	# 34	[c=4 l=2]  *iorsi_1/0
+	movl	%eax, 1026(%rbx)	# 35	[c=4 l=6]  *movv4qi_internal/1
+	jmp	.L488	# 457	[c=1 l=5]  jump
+	.p2align 4,,10
+	.p2align 3
+.L493:
+	movq	1040(%rbx), %rax	# 99	[c=9 l=7]  *movdi_internal/3
+	movl	$62, %edx	# 101	[c=4 l=5]  *movsi_internal/0
+	subl	%r12d, %edx	# 102	[c=4 l=3]  *subsi_1/0
+	movzbl	61(%rax), %r14d	# 100	[c=13 l=5]  *zero_extendqisi2/0
+	cmpl	%r15d, %edx	# 103	[c=4 l=3]  *cmpsi_1/0
+	jb	.L497	# 104	[c=13 l=6]  *jcc
+	cmpb	$1, 1081(%rbx)	# 108	[c=13 l=7]  *cmpqi_1/0
+	jbe	.L497	# 109	[c=13 l=6]  *jcc
+.L496:
+	movl	$62, %esi	# 112	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 113	[c=4 l=3]  *movdi_internal/3
+	call	data_read_mapped	# 114	[c=10 l=5]  *call_value
+	movl	%eax, %ebp	# 115	[c=4 l=2]  *movsi_internal/0
+	jmp	.L498	# 459	[c=1 l=5]  jump
+	.p2align 4,,10
+	.p2align 3
+.L530:
+	movq	104(%rbx), %rdx	# 308	[c=9 l=4]  *movdi_internal/3
+	movzbl	(%rdx), %esi	# 309	[c=5 l=3]  *movqi_internal/4
+	jmp	.L514	# 461	[c=1 l=5]  jump
+	.p2align 4,,10
+	.p2align 3
+.L529:
+	movzbl	%r12b, %edx	# 261	[c=4 l=4]  *zero_extendqisi2/0
+	movl	$62, %esi	# 263	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 264	[c=4 l=3]  *movdi_internal/3
+	call	data_write_mapped	# 265	[c=0 l=5]  *call
+	jmp	.L513	# 463	[c=1 l=5]  jump
+	.p2align 4,,10
+	.p2align 3
+.L528:
+	movzbl	%r12b, %edx	# 237	[c=4 l=4]  *zero_extendqisi2/0
+	movl	$61, %esi	# 239	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 240	[c=4 l=3]  *movdi_internal/3
+	call	data_write_mapped	# 241	[c=0 l=5]  *call
+	jmp	.L511	# 465	[c=1 l=5]  jump
+	.p2align 4,,10
+	.p2align 3
+.L501:
+	movl	%ebp, %esi	# 163	[c=4 l=2]  *movsi_internal/0
+	movq	%rbx, %rdi	# 164	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 165	[c=0 l=5]  *call
+	jmp	.L502	# 467	[c=1 l=5]  jump
+	.p2align 4,,10
+	.p2align 3
+.L504:
+	movl	%r14d, %esi	# 190	[c=4 l=3]  *movsi_internal/0
+	movq	%rbx, %rdi	# 191	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 192	[c=0 l=5]  *call
+	jmp	.L505	# 469	[c=1 l=5]  jump
+	.p2align 4,,10
+	.p2align 3
+.L526:
+	movl	$61, %esi	# 86	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 87	[c=4 l=3]  *movdi_internal/3
+	call	data_read_mapped	# 88	[c=10 l=5]  *call_value
+	movl	%eax, %r14d	# 89	[c=4 l=3]  *movsi_internal/0
+	movl	$62, %eax	# 90	[c=4 l=5]  *movsi_internal/0
+	subl	%r12d, %eax	# 91	[c=4 l=3]  *subsi_1/0
+	cmpl	%r15d, %eax	# 92	[c=4 l=3]  *cmpsi_1/0
+	jnb	.L496	# 93	[c=13 l=6]  *jcc
+	movq	1040(%rbx), %rax	# 120	[c=9 l=7]  *movdi_internal/3
+	jmp	.L497	# 471	[c=1 l=5]  jump
+	.p2align 4,,10
+	.p2align 3
+.L508:
+	movl	%r12d, %esi	# 219	[c=4 l=3]  *movsi_internal/0
+	movq	%rbx, %rdi	# 220	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 221	[c=0 l=5]  *call
+	jmp	.L509	# 473	[c=1 l=5]  jump
+.L527:
+	movl	%ebp, %esi	# 136	[c=4 l=2]  *movsi_internal/0
+	movq	%rbx, %rdi	# 137	[c=4 l=3]  *movdi_internal/3
+	call	stack_overflow	# 138	[c=0 l=5]  *call
+	.cfi_endproc
+.LFE215:
+	.size	do_events, .-do_events
+	.section	.rodata.str1.1
+.LC38:
+	.string	"SREG"
+.LC39:
+	.string	"registers"
+.LC40:
+	.string	"RAM"
+.LC41:
+	.string	"costs"
+	.section	.rodata.str1.8
+	.align 8
+.LC42:
+	.string	"avrtest: -jit is not available on this host\n"
+	.section	.rodata.str1.1
+.LC43:
+	.string	"illegal opcode 0x%04x"
+.LC44:
+	.string	"opcode 0x%04x illegal on %s"
+	.section	.rodata.str1.8
+	.align 8
+.LC45:
+	.string	"opcode 0x%04x not yet supported"
+	.section	.rodata.str1.1
+.LC46:
+	.string	"in func_ILLEGAL"
+	.section	.rodata.str1.8
+	.align 8
+.LC47:
+	.string	"opcode 0x%04x has undefined result (%s overlaps R%d)"
+	.section	.rodata.str1.1
+.LC48:
+	.string	"bad IRQ vector %d"
+.LC49:
+	.string	"exit %d function called"
+.LC50:
+	.string	"abort function called"
+	.section	.rodata.str1.8
+	.align 8
+.LC51:
+	.string	"instruction count limit reached"
+	.section	.rodata.str1.1
+.LC52:
+	.string	"illegal tiny register R%d"
+	.section	.rodata.str1.8
+	.align 8
+.LC53:
+	.string	"infinite loop detected (normal exit)"
+	.align 8
+.LC54:
+	.string	"deadlock: sleeping with no wake source"
+	.section	.rodata.str1.1
+.LC55:
+	.string	"-hle"
+	.section	.rodata.str1.8
+	.align 8
+.LC56:
+	.string	"\navrtest: -hle-verify: %s at %06x: %s differ from the emulation, not emulating %s\n"
+	.text
+	.p2align 4
+	.type	execute, @function
+execute:
+.LFB221:
+	.cfi_startproc
+	pushq	%r15	# 16786	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14	# 16787	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13	# 16788	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12	# 16789	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp	# 16790	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx	# 16791	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	movq	%rdi, %rbx	# 2	[c=4 l=3]  *movdi_internal/3
+	subq	$168, %rsp	# 16792	[c=4 l=7]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_def_cfa_offset 224
+	cmpb	$0, 112(%rdi)	# 76	[c=13 l=4]  *cmpqi_ccno_1/1
+	jne	.L761	# 77	[c=13 l=2]  *jcc
+	cmpl	$0, 568(%rdi)	# 79	[c=13 l=7]  *cmpsi_ccno_1/1
+	jne	.L1676	# 80	[c=13 l=6]  *jcc
+.L535:
+	movl	992(%rbx), %eax	# 14966	[c=9 l=6]  *movsi_internal/0
+	cmpl	$0, 536(%rbx)	# 102	[c=13 l=7]  *cmpsi_ccno_1/1
+	leal	1(%rax), %ebp	# 16279	[c=4 l=3]  *leasi
+	jne	.L1677	# 103	[c=13 l=6]  *jcc
+.L537:
+	xorl	%ecx, %ecx	# 18036	[c=4 l=2]  *movsi_xor
+	movb	$1, 112(%rbx)	# 118	[c=4 l=4]  *movqi_internal/8
+	movl	%ecx, 116(%rbx)	# 18037	[c=4 l=3]  *movsi_internal/1
+	movl	%ebp, 120(%rbx)	# 120	[c=4 l=3]  *movsi_internal/1
+.L761:
+	movl	120(%rbx), %edx	# 124	[c=9 l=3]  *movsi_internal/0
+	testl	%edx, %edx	# 125	[c=4 l=2]  *cmpsi_ccno_1/0
+	jne	.L1678	# 126	[c=13 l=6]  *jcc
+.L538:
+	movl	(%rbx), %ebp	# 300	[c=6 l=2]  *zero_extendsidi2/3
+	movq	32(%rbx), %r13	# 298	[c=9 l=4]  *movdi_internal/3
+	movl	$1, 96(%rbx)	# 305	[c=4 l=7]  *movsi_internal/1
+	movq	%rbp, %rdx	# 16534	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbp	# 302	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %rbp	# 304	[c=13 l=7]  *adddi_1/1
+	movzbl	11(%rbp), %r12d	# 306	[c=13 l=5]  zero_extendqidi2/0
+	addq	40(%rbx), %r12	# 307	[c=13 l=4]  *adddi_1/1
+	movzwl	14(%rbp), %eax	# 309	[c=13 l=4]  zero_extendhidi2/0
+	movq	0(%rbp), %r10	# 314	[c=5 l=4]  *movdi_internal/3
+	movq	%r12, 40(%rbx)	# 308	[c=4 l=4]  *movdi_internal/5
+	addq	%rax, 48(%rbx)	# 310	[c=13 l=4]  *adddi_1/0
+	movzbl	9(%rbp), %eax	# 311	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%edx, %eax	# 312	[c=4 l=2]  *addsi_1/0
+	movl	%eax, (%rbx)	# 313	[c=4 l=2]  *movsi_internal/1
+	leaq	-1(%r13), %rax	# 16274	[c=4 l=4]  *leadi
+	movq	%rax, 8(%rsp)	# 14970	[c=4 l=5]  *movdi_internal/5
+	jmp	*%r10	# 16989	[c=4 l=3]  *indirect_jump
+.L1234:
+	movzwl	12(%rbp), %edi	# 10291	[c=13 l=4]  *zero_extendhisi2/0
+	movzbl	10(%rbp), %ecx	# 10293	[c=13 l=4]  zero_extendqidi2/0
+	movl	%edi, %eax	# 16725	[c=4 l=2]  *movsi_internal/0
+	cmpl	$15, %ecx	# 10296	[c=4 l=3]  *cmpsi_1/0
+	jle	.L1679	# 10297	[c=13 l=6]  *jcc
+	movzbl	1004(%rbx,%rcx), %edx	# 10310	[c=14 l=8]  *zero_extendqisi2/0
+	andl	$136, %eax	# 10319	[c=4 l=5]  *andsi_1/0
+	movl	%edx, %esi	# 16726	[c=4 l=2]  *movsi_internal/0
+	subl	%edi, %edx	# 10312	[c=4 l=2]  *subsi_1/0
+	andl	$136, %esi	# 10316	[c=4 l=6]  *andsi_1/0
+	movb	%dl, 1004(%rbx,%rcx)	# 10314	[c=4 l=7]  *movqi_internal/8
+	andl	$511, %edx	# 10323	[c=4 l=6]  *andsi_1/0
+	leal	(%rax,%rsi,2), %eax	# 10320	[c=8 l=3]  *leasi
+	imull	$260, %eax, %eax	# 10321	[c=12 l=6]  *mulsi3_1/1
+	andl	$7680, %eax	# 10322	[c=4 l=5]  *andsi_1/0
+.L1558:
+	orl	%edx, %eax	# 10324	[c=5 l=2]  *iorsi_1_zext
+	movzbl	100(%rbx), %edx	# 10325	[c=9 l=4]  *movqi_internal/4
+	movl	%edx, %ecx	# 15548	[c=4 l=2]  *movsi_internal/0
+	andl	$192, %ecx	# 10328	[c=4 l=6]  *andsi_2/0
+	jne	.L1181	# 10329	[c=13 l=6]  *jcc
+	leaq	flag_update_table_sub8(%rip), %rdx	# 10332	[c=1 l=7]  *movdi_internal/4
+	addq	%rdx, %rax	# 10333	[c=4 l=3]  *adddi_1/0
+	movl	$63, %edx	# 48	[c=4 l=5]  *movqi_internal/3
+.L1247:
+	movq	%rax, 104(%rbx)	# 10672	[c=4 l=4]  *movdi_internal/5
+	movb	%dl, 100(%rbx)	# 10673	[c=4 l=3]  *movqi_internal/8
+.L1541:
+	movl	(%rbx), %ebp	# 8995	[c=6 l=2]  *zero_extendsidi2/3
+	movq	%rbp, %rax	# 16696	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbp	# 8997	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %rbp	# 8999	[c=13 l=7]  *adddi_1/1
+	addl	$1, %eax	# 9000	[c=4 l=3]  *addsi_1/0
+	movl	%eax, (%rbx)	# 9001	[c=4 l=2]  *movsi_internal/1
+.L614:
+	movq	1040(%rbx), %rdx	# 1245	[c=9 l=7]  *movdi_internal/3
+	movzbl	100(%rbx), %ecx	# 1244	[c=13 l=4]  *zero_extendqisi2/0
+	movl	$2, 96(%rbx)	# 1242	[c=4 l=7]  *movsi_internal/1
+	movzbl	10(%rbp), %esi	# 1243	[c=9 l=4]  *movqi_internal/4
+	movzbl	63(%rdx), %edx	# 1246	[c=13 l=4]  *zero_extendqisi2/0
+	movl	%ecx, %eax	# 16553	[c=4 l=2]  *movsi_internal/0
+	notl	%ecx	# 1248	[c=4 l=2]  *one_cmplsi2_1/0
+	andl	%ecx, %edx	# 1249	[c=4 l=2]  *andsi_1/0
+	movq	104(%rbx), %rcx	# 1250	[c=9 l=4]  *movdi_internal/3
+	andb	(%rcx), %al	# 1251	[c=9 l=2]  *andqi_1/1
+	movzbl	%al, %eax	# 1252	[c=4 l=3]  *zero_extendqisi2/0
+	orl	%edx, %eax	# 1253	[c=4 l=2]  *iorsi_1/0
+	movzwl	12(%rbp), %edx	# 1254	[c=13 l=4]  *zero_extendhisi2/0
+	testl	%edx, %eax	# 1256	[c=4 l=2]  *testsi_1/0
+	jne	.L615	# 1257	[c=13 l=2]  *jcc
+	movsbl	%sil, %eax	# 1259	[c=4 l=4]  extendqisi2
+	addq	$1, 48(%rbx)	# 1266	[c=13 l=5]  *adddi_1/0
+	addl	(%rbx), %eax	# 1261	[c=9 l=2]  *addsi_1/1
+	andl	992(%rbx), %eax	# 1264	[c=13 l=6]  *andsi_1/1
+	movl	%eax, (%rbx)	# 1265	[c=4 l=2]  *movsi_internal/1
+.L615:
+	cmpq	%r12, 8(%rsp)	# 1270	[c=13 l=5]  *cmpdi_1/0
+	jb	.L612	# 1271	[c=13 l=6]  *jcc
+	movq	48(%rbx), %rdx	# 1273	[c=9 l=4]  *movdi_internal/3
+	cmpq	56(%rbx), %rdx	# 1274	[c=13 l=4]  *cmpdi_1/1
+	jnb	.L1680	# 1275	[c=13 l=6]  *jcc
+.L616:
+	movl	(%rbx), %ebp	# 1283	[c=6 l=2]  *zero_extendsidi2/3
+	movl	$1, 96(%rbx)	# 1288	[c=4 l=7]  *movsi_internal/1
+	movq	%rbp, %rcx	# 16554	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbp	# 1285	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %rbp	# 1287	[c=13 l=7]  *adddi_1/1
+	movzbl	11(%rbp), %eax	# 1289	[c=13 l=4]  zero_extendqidi2/0
+	addq	%rax, %r12	# 1290	[c=4 l=3]  *adddi_1/0
+	movzwl	14(%rbp), %eax	# 1292	[c=13 l=4]  zero_extendhidi2/0
+	movq	%r12, 40(%rbx)	# 1291	[c=4 l=4]  *movdi_internal/5
+	addq	%rdx, %rax	# 1293	[c=4 l=3]  *adddi_1/0
+	movq	%rax, 48(%rbx)	# 1294	[c=4 l=4]  *movdi_internal/5
+	movzbl	9(%rbp), %eax	# 1295	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%ecx, %eax	# 1296	[c=4 l=2]  *addsi_1/0
+	movl	%eax, (%rbx)	# 1297	[c=4 l=2]  *movsi_internal/1
+	jmp	*0(%rbp)	# 17974	[c=5 l=3]  *indirect_jump
+.L1243:
+	movzbl	10(%rbp), %edx	# 10570	[c=13 l=4]  zero_extendqidi2/0
+	movzwl	12(%rbp), %edi	# 10578	[c=13 l=4]  *zero_extendhisi2/0
+	leal	1(%rdx), %ecx	# 15996	[c=4 l=3]  *leasi
+	movzbl	1004(%rbx,%rdx), %esi	# 10576	[c=14 l=8]  *zero_extendqisi2/0
+	movslq	%ecx, %rcx	# 10572	[c=4 l=3]  *extendsidi2_rex64/1
+	movzbl	1004(%rbx,%rcx), %eax	# 10573	[c=14 l=8]  *zero_extendqisi2/0
+	sall	$8, %eax	# 10574	[c=4 l=3]  *ashlsi3_1/0
+	orl	%esi, %eax	# 10577	[c=4 l=2]  *iorsi_1/0
+	movl	%eax, %esi	# 15568	[c=4 l=2]  *movsi_internal/0
+	shrl	$5, %eax	# 10587	[c=4 l=3]  *lshrsi3_1/0
+	subl	%edi, %esi	# 10579	[c=4 l=2]  *subsi_1/0
+	andl	$1024, %eax	# 10588	[c=4 l=5]  *andsi_1/0
+	movb	%sil, 1004(%rbx,%rdx)	# 10581	[c=4 l=8]  *movqi_internal/8
+	movl	%esi, %edx	# 15570	[c=4 l=2]  *movsi_internal/0
+	sarl	$8, %edx	# 10582	[c=4 l=3]  *ashrsi3_1/0
+	movb	%dl, 1004(%rbx,%rcx)	# 10584	[c=4 l=7]  *movqi_internal/8
+	andl	$511, %edx	# 10589	[c=4 l=6]  *andsi_1/0
+	movq	104(%rbx), %rcx	# 10603	[c=9 l=4]  *movdi_internal/3
+	orl	%edx, %eax	# 10590	[c=4 l=2]  *iorsi_1/0
+	leaq	flag_update_table_sub8(%rip), %rdx	# 14864	[c=1 l=7]  *movdi_internal/4
+	cltq	# 10591	[c=4 l=2]  *extendsidi2_rex64/0
+	movzbl	(%rcx), %edi	# 17628	[c=5 l=3]  *movqi_internal/4
+	movzbl	(%rdx,%rax), %edx	# 10592	[c=13 l=4]  *zero_extendqisi2/0
+	xorl	%eax, %eax	# 17625	[c=4 l=2]  *movsi_xor
+	testw	%si, %si	# 17626	[c=4 l=3]  *cmphi_ccno_1/0
+	setne	%al	# 17627	[c=4 l=3]  *setcc_qi_slp
+	addl	%eax, %eax	# 10597	[c=4 l=2]  *ashlsi3_1/0
+	notl	%eax	# 10598	[c=4 l=2]  *one_cmplsi2_1/0
+	andl	%eax, %edx	# 10599	[c=4 l=2]  *andsi_1/0
+	movzbl	100(%rbx), %eax	# 10600	[c=13 l=4]  *zero_extendqisi2/0
+	andl	$-33, %edx	# 10605	[c=4 l=3]  *andsi_1/0
+	andl	$-32, %eax	# 10601	[c=4 l=3]  *andsi_1/0
+	andl	%eax, %edi	# 18886	[c=4 l=2]  *andsi_1/0
+	orl	$31, %eax	# 16000	[c=4 l=3]  *iorsi_1/0
+	movl	%edi, %ecx	# 15573	[c=4 l=2]  *movqi_internal/1
+	movb	%al, 100(%rbx)	# 10609	[c=4 l=3]  *movqi_internal/8
+	orl	%ecx, %edx	# 15999	[c=4 l=2]  *iorsi_1/0
+	movb	%dl, 101(%rbx)	# 10607	[c=4 l=3]  *movqi_internal/8
+.L1545:
+	leaq	101(%rbx), %rax	# 16080	[c=4 l=4]  *leadi
+	movq	%rax, 104(%rbx)	# 9081	[c=4 l=4]  *movdi_internal/5
+.L1544:
+	movl	(%rbx), %ebp	# 9082	[c=6 l=2]  *zero_extendsidi2/3
+	movq	%rbp, %rax	# 16699	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbp	# 9084	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %rbp	# 9086	[c=13 l=7]  *adddi_1/1
+	addl	$1, %eax	# 9087	[c=4 l=3]  *addsi_1/0
+	movl	%eax, (%rbx)	# 9088	[c=4 l=2]  *movsi_internal/1
+.L617:
+	movq	1040(%rbx), %rdx	# 1306	[c=9 l=7]  *movdi_internal/3
+	movzbl	100(%rbx), %ecx	# 1305	[c=13 l=4]  *zero_extendqisi2/0
+	movl	$2, 96(%rbx)	# 1303	[c=4 l=7]  *movsi_internal/1
+	movzbl	10(%rbp), %esi	# 1304	[c=9 l=4]  *movqi_internal/4
+	movzbl	63(%rdx), %edx	# 1307	[c=13 l=4]  *zero_extendqisi2/0
+	movl	%ecx, %eax	# 16555	[c=4 l=2]  *movsi_internal/0
+	notl	%ecx	# 1309	[c=4 l=2]  *one_cmplsi2_1/0
+	andl	%ecx, %edx	# 1310	[c=4 l=2]  *andsi_1/0
+	movq	104(%rbx), %rcx	# 1311	[c=9 l=4]  *movdi_internal/3
+	andb	(%rcx), %al	# 1312	[c=9 l=2]  *andqi_1/1
+	movzbl	%al, %eax	# 1313	[c=4 l=3]  *zero_extendqisi2/0
+	orl	%edx, %eax	# 1314	[c=4 l=2]  *iorsi_1/0
+	movzwl	12(%rbp), %edx	# 1315	[c=13 l=4]  *zero_extendhisi2/0
+	testl	%edx, %eax	# 1317	[c=4 l=2]  *testsi_1/0
+	jne	.L1681	# 1318	[c=13 l=6]  *jcc
+.L618:
+	leaq	-1(%r13), %rax	# 16244	[c=4 l=4]  *leadi
+	cmpq	%r12, %rax	# 1331	[c=4 l=3]  *cmpdi_1/0
+	jb	.L612	# 1332	[c=13 l=6]  *jcc
+	movq	56(%rbx), %rax	# 15011	[c=9 l=4]  *movdi_internal/3
+	cmpq	%rax, 48(%rbx)	# 1335	[c=13 l=4]  *cmpdi_1/0
+	jnb	.L1682	# 1336	[c=13 l=6]  *jcc
+.L619:
+	movl	(%rbx), %ebp	# 1343	[c=6 l=2]  *zero_extendsidi2/3
+	movl	$1, 96(%rbx)	# 1348	[c=4 l=7]  *movsi_internal/1
+	movq	%rbp, %rdx	# 16556	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbp	# 1345	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %rbp	# 1347	[c=13 l=7]  *adddi_1/1
+	movzbl	11(%rbp), %eax	# 1349	[c=13 l=4]  zero_extendqidi2/0
+	addq	%rax, %r12	# 1350	[c=4 l=3]  *adddi_1/0
+	movzwl	14(%rbp), %eax	# 1352	[c=13 l=4]  zero_extendhidi2/0
+	addq	%rax, 48(%rbx)	# 1353	[c=13 l=4]  *adddi_1/0
+	movq	%r12, 40(%rbx)	# 1351	[c=4 l=4]  *movdi_internal/5
+	movzbl	9(%rbp), %eax	# 1354	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%edx, %eax	# 1355	[c=4 l=2]  *addsi_1/0
+	movl	%eax, (%rbx)	# 1356	[c=4 l=2]  *movsi_internal/1
+	jmp	*0(%rbp)	# 17971	[c=5 l=3]  *indirect_jump
+.L1151:
+	movzbl	10(%rbp), %eax	# 8502	[c=13 l=4]  zero_extendqidi2/0
+	movzwl	12(%rbp), %ecx	# 8501	[c=13 l=4]  zero_extendhidi2/0
+	cmpl	$15, %eax	# 8505	[c=4 l=3]  *cmpsi_1/0
+	jle	.L1683	# 8506	[c=13 l=6]  *jcc
+	movzbl	1004(%rbx,%rax), %eax	# 8519	[c=14 l=8]  *zero_extendqisi2/0
+	movl	%eax, %edx	# 16683	[c=4 l=2]  *movsi_internal/0
+	cmpl	$15, %ecx	# 8523	[c=4 l=3]  *cmpsi_1/0
+	jle	.L1684	# 8524	[c=13 l=6]  *jcc
+	movzbl	1004(%rbx,%rcx), %ecx	# 8537	[c=14 l=8]  *zero_extendqisi2/0
+	andl	$136, %edx	# 8539	[c=4 l=6]  *andsi_1/0
+	movl	%ecx, %esi	# 15403	[c=4 l=2]  *movsi_internal/0
+	subl	%ecx, %eax	# 8545	[c=4 l=2]  *subsi_1/0
+	andl	$136, %esi	# 8542	[c=4 l=6]  *andsi_1/0
+	leal	(%rsi,%rdx,2), %edx	# 8543	[c=8 l=3]  *leasi
+.L1555:
+	imull	$260, %edx, %edx	# 8617	[c=12 l=6]  *mulsi3_1/1
+	andl	$511, %eax	# 8616	[c=4 l=5]  *andsi_1/0
+	andl	$7680, %edx	# 8618	[c=4 l=6]  *andsi_1/0
+	orl	%edx, %eax	# 8619	[c=5 l=2]  *iorsi_1_zext
+	movzbl	100(%rbx), %edx	# 8620	[c=9 l=4]  *movqi_internal/4
+	movl	%edx, %ecx	# 15409	[c=4 l=2]  *movsi_internal/0
+	andl	$192, %ecx	# 8623	[c=4 l=6]  *andsi_2/0
+	jne	.L1158	# 8624	[c=13 l=6]  *jcc
+	leaq	flag_update_table_sub8(%rip), %rdx	# 8627	[c=1 l=7]  *movdi_internal/4
+	addq	%rdx, %rax	# 8628	[c=4 l=3]  *adddi_1/0
+	movl	$63, %edx	# 35	[c=4 l=5]  *movqi_internal/3
+.L1159:
+	movq	%rax, 104(%rbx)	# 8645	[c=4 l=4]  *movdi_internal/5
+	movb	%dl, 100(%rbx)	# 8646	[c=4 l=3]  *movqi_internal/8
+.L1547:
+	movl	(%rbx), %ebp	# 8734	[c=6 l=2]  *zero_extendsidi2/3
+	movq	%rbp, %rax	# 16689	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbp	# 8736	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %rbp	# 8738	[c=13 l=7]  *adddi_1/1
+	addl	$1, %eax	# 8739	[c=4 l=3]  *addsi_1/0
+	movl	%eax, (%rbx)	# 8740	[c=4 l=2]  *movsi_internal/1
+.L662:
+	movzbl	10(%rbp), %eax	# 1903	[c=13 l=4]  zero_extendqidi2/0
+	movzwl	12(%rbp), %ecx	# 1902	[c=13 l=4]  zero_extendhidi2/0
+	cmpl	$15, %eax	# 1906	[c=4 l=3]  *cmpsi_1/0
+	jle	.L1685	# 1907	[c=13 l=6]  *jcc
+	movzbl	1004(%rbx,%rax), %edx	# 1920	[c=14 l=8]  *zero_extendqisi2/0
+	movl	%edx, %r9d	# 16566	[c=4 l=3]  *movsi_internal/0
+	cmpl	$15, %ecx	# 1924	[c=4 l=3]  *cmpsi_1/0
+	jle	.L1686	# 1925	[c=13 l=6]  *jcc
+	movq	104(%rbx), %rax	# 1941	[c=9 l=4]  *movdi_internal/3
+	andl	$136, %r9d	# 1951	[c=4 l=7]  *andsi_1/0
+	movl	(%rbx), %ebp	# 1978	[c=6 l=2]  *zero_extendsidi2/3
+	movzbl	1004(%rbx,%rcx), %r8d	# 1938	[c=14 l=9]  *zero_extendqisi2/0
+	movzbl	100(%rbx), %ecx	# 1939	[c=13 l=4]  *zero_extendqisi2/0
+	movzbl	(%rax), %esi	# 1942	[c=5 l=3]  *movqi_internal/4
+	movq	1040(%rbx), %rax	# 1943	[c=9 l=7]  *movdi_internal/3
+	movl	%ecx, %edi	# 16567	[c=4 l=2]  *movsi_internal/0
+	movl	%ecx, %r10d	# 15054	[c=4 l=3]  *movsi_internal/0
+	subl	%r8d, %edx	# 1960	[c=4 l=3]  *subsi_1/0
+	andl	$-64, %ecx	# 1956	[c=4 l=3]  *andsi_1/0
+	movzbl	63(%rax), %eax	# 1944	[c=13 l=4]  *zero_extendqisi2/0
+	andl	%esi, %edi	# 16222	[c=4 l=2]  *andsi_1/0
+	notl	%r10d	# 1945	[c=4 l=3]  *one_cmplsi2_1/0
+	andl	%ecx, %esi	# 16223	[c=4 l=2]  *andsi_1/0
+	movzbl	%dil, %edi	# 1948	[c=4 l=4]  *zero_extendqisi2/0
+	orl	$63, %ecx	# 16225	[c=4 l=3]  *iorsi_1/0
+	andl	%r10d, %eax	# 1946	[c=4 l=3]  *andsi_1/0
+	movb	%cl, 100(%rbx)	# 1975	[c=4 l=3]  *movqi_internal/8
+	orl	%edi, %eax	# 1949	[c=4 l=2]  *iorsi_1/0
+	movl	%r8d, %edi	# 15056	[c=4 l=3]  *movsi_internal/0
+	andl	$136, %edi	# 1954	[c=4 l=6]  *andsi_1/0
+	movl	%eax, %r8d	# 15058	[c=4 l=3]  *movsi_internal/0
+	orl	$-3, %eax	# 1969	[c=4 l=3]  *iorsi_1/0
+	leal	(%rdi,%r9,2), %edi	# 1955	[c=8 l=4]  *leasi
+	andl	$1, %r8d	# 1961	[c=4 l=4]  *andsi_1/0
+	imull	$260, %edi, %edi	# 1964	[c=12 l=6]  *mulsi3_1/1
+	subl	%r8d, %edx	# 1962	[c=4 l=3]  *subsi_1/0
+	andl	$511, %edx	# 1963	[c=4 l=6]  *andsi_1/0
+	andl	$7680, %edi	# 1965	[c=4 l=6]  *andsi_1/0
+	orl	%edi, %edx	# 1966	[c=5 l=2]  *iorsi_1_zext
+	leaq	flag_update_table_sub8(%rip), %rdi	# 14829	[c=1 l=7]  *movdi_internal/4
+	andb	(%rdi,%rdx), %al	# 1970	[c=13 l=3]  *andqi_1/1
+	movq	%rbp, %rdx	# 16568	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbp	# 1980	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %rbp	# 1982	[c=13 l=7]  *adddi_1/1
+	orl	%esi, %eax	# 16224	[c=4 l=2]  *iorsi_1/0
+	movb	%al, 101(%rbx)	# 1973	[c=4 l=3]  *movqi_internal/8
+	leaq	101(%rbx), %rax	# 16226	[c=4 l=4]  *leadi
+	movq	%rax, 104(%rbx)	# 1977	[c=4 l=4]  *movdi_internal/5
+	movzbl	9(%rbp), %eax	# 1983	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%edx, %eax	# 1984	[c=4 l=2]  *addsi_1/0
+	movl	%eax, (%rbx)	# 1985	[c=4 l=2]  *movsi_internal/1
+	jmp	*0(%rbp)	# 17949	[c=5 l=3]  *indirect_jump
+.L1677:
+	cmpq	$0, 10984(%rbx)	# 105	[c=13 l=8]  *cmpdi_ccno_1/1
+	jne	.L537	# 106	[c=13 l=6]  *jcc
+	leaq	.LC13(%rip), %rcx	# 108	[c=1 l=7]  *movdi_internal/4
+	movl	$8, %edx	# 110	[c=4 l=5]  *movdi_internal/2
+	movl	%ebp, %esi	# 111	[c=4 l=2]  *movsi_internal/0
+	movq	%rbx, %rdi	# 112	[c=4 l=3]  *movdi_internal/3
+	call	get_mem	# 113	[c=10 l=5]  *call_value
+	movq	%rax, 10984(%rbx)	# 115	[c=4 l=7]  *movdi_internal/5
+	jmp	.L537	# 18049	[c=1 l=5]  jump
+.L1681:
+	movsbl	%sil, %eax	# 1320	[c=4 l=4]  extendqisi2
+	addl	(%rbx), %eax	# 1322	[c=9 l=2]  *addsi_1/1
+	andl	992(%rbx), %eax	# 1325	[c=13 l=6]  *andsi_1/1
+	addq	$1, 48(%rbx)	# 1327	[c=13 l=5]  *adddi_1/0
+	movl	%eax, (%rbx)	# 1326	[c=4 l=2]  *movsi_internal/1
+	jmp	.L618	# 18051	[c=1 l=5]  jump
+.L1308:
+	movzbl	10(%rbp), %r14d	# 11719	[c=13 l=5]  zero_extendqidi2/0
+	movzwl	1034(%rbx), %ebp	# 11720	[c=13 l=7]  zero_extendhidi2/0
+	movl	%ebp, %edx	# 15650	[c=4 l=2]  *movsi_internal/0
+	movq	%rbp, %rax	# 16762	[c=4 l=3]  *movdi_internal/3
+	subl	5176(%rbx), %edx	# 11723	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %edx	# 11724	[c=13 l=6]  *cmpsi_1/1
+	jb	.L1309	# 11725	[c=13 l=2]  *jcc
+	movl	%ebp, %edx	# 15652	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %edx	# 11727	[c=4 l=3]  *ashrsi3_1/0
+	movslq	%edx, %rdx	# 11728	[c=4 l=3]  *extendsidi2_rex64/1
+	cmpb	$0, 1080(%rbx,%rdx)	# 11729	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L1310	# 11730	[c=13 l=6]  *jcc
+.L1309:
+	movq	1040(%rbx), %rdx	# 11734	[c=9 l=7]  *movdi_internal/3
+	movzbl	(%rdx,%rax), %eax	# 11735	[c=13 l=4]  *zero_extendqisi2/0
+.L1311:
+	cmpl	$15, %r14d	# 11749	[c=4 l=4]  *cmpsi_1/0
+	jle	.L1687	# 11750	[c=13 l=6]  *jcc
+	movb	%al, 1004(%rbx,%r14)	# 11763	[c=4 l=8]  *movqi_internal/8
+	leal	1(%rbp), %eax	# 15959	[c=4 l=3]  *leasi
+	subq	$1, 48(%rbx)	# 11764	[c=13 l=5]  *adddi_1/0
+	movw	%ax, 1034(%rbx)	# 11766	[c=4 l=7]  *movhi_internal/3
+.L1549:
+	movl	(%rbx), %ebp	# 11924	[c=6 l=2]  *zero_extendsidi2/3
+	movq	%rbp, %rax	# 16768	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbp	# 11926	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %rbp	# 11928	[c=13 l=7]  *adddi_1/1
+	addl	$1, %eax	# 11929	[c=4 l=3]  *addsi_1/0
+	movl	%eax, (%rbx)	# 11930	[c=4 l=2]  *movsi_internal/1
+.L1093:
+	movzbl	10(%rbp), %ecx	# 7601	[c=13 l=4]  zero_extendqidi2/0
+	movzwl	1030(%rbx), %ebp	# 7602	[c=13 l=7]  zero_extendhidi2/0
+	movq	%rbp, %rdx	# 16660	[c=4 l=3]  *movdi_internal/3
+	cmpl	$15, %ecx	# 7606	[c=4 l=3]  *cmpsi_1/0
+	jle	.L1688	# 7607	[c=13 l=6]  *jcc
+	movl	%ebp, %eax	# 15357	[c=4 l=2]  *movsi_internal/0
+	movzbl	1004(%rbx,%rcx), %esi	# 7620	[c=10 l=8]  *movqi_internal/4
+	subl	5176(%rbx), %eax	# 7622	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %eax	# 7623	[c=13 l=6]  *cmpsi_1/1
+	jb	.L1095	# 7624	[c=13 l=2]  *jcc
+	movl	%ebp, %ecx	# 15359	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %ecx	# 7626	[c=4 l=3]  *ashrsi3_1/0
+	movslq	%ecx, %rcx	# 7627	[c=4 l=3]  *extendsidi2_rex64/1
+	cmpb	$0, 1080(%rbx,%rcx)	# 7628	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L1096	# 7629	[c=13 l=6]  *jcc
+.L1095:
+	movq	1040(%rbx), %rax	# 7633	[c=9 l=7]  *movdi_internal/3
+	movb	%sil, (%rax,%rdx)	# 7634	[c=4 l=4]  *movqi_internal/8
+.L1097:
+	leal	1(%rbp), %eax	# 16115	[c=4 l=3]  *leasi
+	movl	(%rbx), %ebp	# 7649	[c=6 l=2]  *zero_extendsidi2/3
+	subq	$1, 48(%rbx)	# 7646	[c=13 l=5]  *adddi_1/0
+	movw	%ax, 1030(%rbx)	# 7648	[c=4 l=7]  *movhi_internal/3
+	movq	%rbp, %rdx	# 16661	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbp	# 7651	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %rbp	# 7653	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%rbp), %eax	# 7654	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%edx, %eax	# 7655	[c=4 l=2]  *addsi_1/0
+	movl	%eax, (%rbx)	# 7656	[c=4 l=2]  *movsi_internal/1
+	jmp	*0(%rbp)	# 17722	[c=5 l=3]  *indirect_jump
+.L1682:
+	xorl	%r14d, %r14d	# 17972	[c=4 l=3]  *movsi_xor
+	movq	%rbx, %rdi	# 1339	[c=4 l=3]  *movdi_internal/3
+	movl	%r14d, 96(%rbx)	# 17973	[c=4 l=4]  *movsi_internal/1
+	call	do_events	# 1340	[c=0 l=5]  *call
+	jmp	.L619	# 18055	[c=1 l=5]  jump
+.L1303:
+	movzbl	10(%rbp), %r14d	# 11660	[c=13 l=5]  zero_extendqidi2/0
+	movzwl	1030(%rbx), %ebp	# 11661	[c=13 l=7]  zero_extendhidi2/0
+	movl	%ebp, %edx	# 15646	[c=4 l=2]  *movsi_internal/0
+	movq	%rbp, %rax	# 16760	[c=4 l=3]  *movdi_internal/3
+	subl	5176(%rbx), %edx	# 11664	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %edx	# 11665	[c=13 l=6]  *cmpsi_1/1
+	jb	.L1304	# 11666	[c=13 l=2]  *jcc
+	movl	%ebp, %edx	# 15648	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %edx	# 11668	[c=4 l=3]  *ashrsi3_1/0
+	movslq	%edx, %rdx	# 11669	[c=4 l=3]  *extendsidi2_rex64/1
+	cmpb	$0, 1080(%rbx,%rdx)	# 11670	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L1305	# 11671	[c=13 l=6]  *jcc
+.L1304:
+	movq	1040(%rbx), %rdx	# 11675	[c=9 l=7]  *movdi_internal/3
+	movzbl	(%rdx,%rax), %eax	# 11676	[c=13 l=4]  *zero_extendqisi2/0
+.L1306:
+	cmpl	$15, %r14d	# 11690	[c=4 l=4]  *cmpsi_1/0
+	jle	.L1689	# 11691	[c=13 l=6]  *jcc
+	movb	%al, 1004(%rbx,%r14)	# 11704	[c=4 l=8]  *movqi_internal/8
+	leal	1(%rbp), %eax	# 15960	[c=4 l=3]  *leasi
+	subq	$1, 48(%rbx)	# 11705	[c=13 l=5]  *adddi_1/0
+	movw	%ax, 1030(%rbx)	# 11707	[c=4 l=7]  *movhi_internal/3
+.L1550:
+	movl	(%rbx), %ebp	# 11826	[c=6 l=2]  *zero_extendsidi2/3
+	movq	%rbp, %rax	# 16765	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbp	# 11828	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %rbp	# 11830	[c=13 l=7]  *adddi_1/1
+	addl	$1, %eax	# 11831	[c=4 l=3]  *addsi_1/0
+	movl	%eax, (%rbx)	# 11832	[c=4 l=2]  *movsi_internal/1
+.L1113:
+	movzbl	10(%rbp), %ecx	# 7841	[c=13 l=4]  zero_extendqidi2/0
+	movzwl	1034(%rbx), %ebp	# 7842	[c=13 l=7]  zero_extendhidi2/0
+	movq	%rbp, %rax	# 16666	[c=4 l=3]  *movdi_internal/3
+	cmpl	$15, %ecx	# 7846	[c=4 l=3]  *cmpsi_1/0
+	jle	.L1690	# 7847	[c=13 l=6]  *jcc
+	movl	%ebp, %edx	# 15373	[c=4 l=2]  *movsi_internal/0
+	movzbl	1004(%rbx,%rcx), %ecx	# 7860	[c=10 l=8]  *movqi_internal/4
+	subl	5176(%rbx), %edx	# 7862	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %edx	# 7863	[c=13 l=6]  *cmpsi_1/1
+	jb	.L1115	# 7864	[c=13 l=2]  *jcc
+	movl	%ebp, %edx	# 15375	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %edx	# 7866	[c=4 l=3]  *ashrsi3_1/0
+	movslq	%edx, %rdx	# 7867	[c=4 l=3]  *extendsidi2_rex64/1
+	cmpb	$0, 1080(%rbx,%rdx)	# 7868	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L1116	# 7869	[c=13 l=6]  *jcc
+.L1115:
+	movq	1040(%rbx), %rdx	# 7873	[c=9 l=7]  *movdi_internal/3
+	movb	%cl, (%rdx,%rax)	# 7874	[c=4 l=3]  *movqi_internal/8
+.L1117:
+	leal	1(%rbp), %eax	# 16113	[c=4 l=3]  *leasi
+	movl	(%rbx), %ebp	# 7889	[c=6 l=2]  *zero_extendsidi2/3
+	subq	$1, 48(%rbx)	# 7886	[c=13 l=5]  *adddi_1/0
+	movw	%ax, 1034(%rbx)	# 7888	[c=4 l=7]  *movhi_internal/3
+	movq	%rbp, %rdx	# 16667	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbp	# 7891	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %rbp	# 7893	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%rbp), %eax	# 7894	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%edx, %eax	# 7895	[c=4 l=2]  *addsi_1/0
+	movl	%eax, (%rbx)	# 7896	[c=4 l=2]  *movsi_internal/1
+	jmp	*0(%rbp)	# 17714	[c=5 l=3]  *indirect_jump
+.L1253:
+	movzbl	10(%rbp), %ecx	# 10827	[c=13 l=4]  zero_extendqidi2/0
+	movzwl	12(%rbp), %edx	# 10826	[c=13 l=4]  zero_extendhidi2/0
+	cmpl	$15, %ecx	# 10830	[c=4 l=3]  *cmpsi_1/0
+	jle	.L1691	# 10831	[c=13 l=6]  *jcc
+	movzbl	1004(%rbx,%rcx), %esi	# 10844	[c=14 l=8]  *zero_extendqisi2/0
+	movl	%esi, %eax	# 16744	[c=4 l=2]  *movsi_internal/0
+	cmpl	$15, %edx	# 10848	[c=4 l=3]  *cmpsi_1/0
+	jle	.L1692	# 10849	[c=13 l=6]  *jcc
+	movzbl	1004(%rbx,%rdx), %edx	# 10862	[c=14 l=8]  *zero_extendqisi2/0
+	andl	$136, %eax	# 10867	[c=4 l=5]  *andsi_1/0
+	leal	(%rsi,%rdx), %edi	# 15983	[c=4 l=3]  *leasi
+	movb	%dil, 1004(%rbx,%rcx)	# 10865	[c=4 l=8]  *movqi_internal/8
+	movl	%edx, %ecx	# 15595	[c=4 l=2]  *movsi_internal/0
+	addl	%esi, %edx	# 10875	[c=4 l=2]  *addsi_1/0
+	andl	$136, %ecx	# 10870	[c=4 l=6]  *andsi_1/0
+	leal	(%rcx,%rax,2), %eax	# 10871	[c=8 l=3]  *leasi
+	imull	$260, %eax, %eax	# 10872	[c=12 l=6]  *mulsi3_1/1
+	andl	$7680, %eax	# 10873	[c=4 l=5]  *andsi_1/0
+	orl	%edx, %eax	# 10876	[c=5 l=2]  *iorsi_1_zext
+	movzbl	100(%rbx), %edx	# 10877	[c=9 l=4]  *movqi_internal/4
+	movl	%edx, %ecx	# 15597	[c=4 l=2]  *movsi_internal/0
+	andl	$192, %ecx	# 10880	[c=4 l=6]  *andsi_2/0
+	jne	.L1256	# 10881	[c=13 l=6]  *jcc
+	leaq	flag_update_table_add8(%rip), %rdx	# 10884	[c=1 l=7]  *movdi_internal/4
+	addq	%rdx, %rax	# 10885	[c=4 l=3]  *adddi_1/0
+	movl	$63, %edx	# 51	[c=4 l=5]  *movqi_internal/3
+.L1257:
+	movl	(%rbx), %ebp	# 10904	[c=6 l=2]  *zero_extendsidi2/3
+	movq	%rax, 104(%rbx)	# 10902	[c=4 l=4]  *movdi_internal/5
+	movb	%dl, 100(%rbx)	# 10903	[c=4 l=3]  *movqi_internal/8
+	movq	%rbp, %rax	# 16745	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbp	# 10906	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %rbp	# 10908	[c=13 l=7]  *adddi_1/1
+	addl	$1, %eax	# 10909	[c=4 l=3]  *addsi_1/0
+	movl	%eax, (%rbx)	# 10910	[c=4 l=2]  *movsi_internal/1
+.L583:
+	movzbl	100(%rbx), %edx	# 630	[c=13 l=4]  *zero_extendqisi2/0
+	movq	1040(%rbx), %rax	# 633	[c=9 l=7]  *movdi_internal/3
+	movq	104(%rbx), %rsi	# 632	[c=9 l=4]  *movdi_internal/3
+	movzbl	10(%rbp), %r10d	# 629	[c=13 l=5]  zero_extendqidi2/0
+	movzbl	63(%rax), %eax	# 634	[c=13 l=4]  *zero_extendqisi2/0
+	movl	%edx, %r9d	# 14979	[c=4 l=3]  *movsi_internal/0
+	movzwl	12(%rbp), %r8d	# 628	[c=13 l=5]  zero_extendhidi2/0
+	movl	%edx, %ecx	# 16537	[c=4 l=2]  *movsi_internal/0
+	notl	%r9d	# 635	[c=4 l=3]  *one_cmplsi2_1/0
+	andl	%r9d, %eax	# 636	[c=4 l=3]  *andsi_1/0
+	movzbl	(%rsi), %r9d	# 18010	[c=5 l=4]  *movqi_internal/4
+	andl	%edx, %r9d	# 18885	[c=4 l=3]  *andsi_1/0
+	orl	%r9d, %eax	# 639	[c=4 l=3]  *iorsi_1/0
+	andl	$1, %eax	# 640	[c=4 l=3]  *andsi_1/0
+	cmpl	$15, %r10d	# 643	[c=4 l=4]  *cmpsi_1/0
+	jle	.L1693	# 644	[c=13 l=6]  *jcc
+	movzbl	1004(%rbx,%r10), %r11d	# 657	[c=14 l=9]  *zero_extendqisi2/0
+	movl	%r11d, %edi	# 16538	[c=4 l=3]  *movsi_internal/0
+	cmpl	$15, %r8d	# 661	[c=4 l=4]  *cmpsi_1/0
+	jle	.L1694	# 662	[c=13 l=6]  *jcc
+	movzbl	1004(%rbx,%r8), %r8d	# 675	[c=14 l=9]  *zero_extendqisi2/0
+	andl	$136, %edi	# 682	[c=4 l=6]  *andsi_1/0
+	movl	%r8d, %r9d	# 16539	[c=4 l=3]  *movsi_internal/0
+	addl	%r11d, %r8d	# 677	[c=4 l=3]  *addsi_1/0
+	addl	%eax, %r8d	# 678	[c=4 l=3]  *addsi_1/0
+	movl	%r9d, %eax	# 14983	[c=4 l=3]  *movsi_internal/0
+	andl	$136, %eax	# 685	[c=4 l=5]  *andsi_1/0
+	movb	%r8b, 1004(%rbx,%r10)	# 680	[c=4 l=8]  *movqi_internal/8
+	leal	(%rax,%rdi,2), %eax	# 686	[c=8 l=3]  *leasi
+	imull	$260, %eax, %eax	# 687	[c=12 l=6]  *mulsi3_1/1
+	andl	$7680, %eax	# 688	[c=4 l=5]  *andsi_1/0
+	orl	%r8d, %eax	# 689	[c=5 l=3]  *iorsi_1_zext
+	andl	$-64, %edx	# 691	[c=4 l=3]  *andsi_2/0
+	jne	.L586	# 692	[c=13 l=6]  *jcc
+	leaq	flag_update_table_add8(%rip), %rdx	# 695	[c=1 l=7]  *movdi_internal/4
+	movl	$63, %ecx	# 4	[c=4 l=5]  *movqi_internal/3
+	addq	%rdx, %rax	# 696	[c=4 l=3]  *adddi_1/0
+.L587:
+	movl	(%rbx), %ebp	# 714	[c=6 l=2]  *zero_extendsidi2/3
+	movq	%rax, 104(%rbx)	# 712	[c=4 l=4]  *movdi_internal/5
+	movb	%cl, 100(%rbx)	# 713	[c=4 l=3]  *movqi_internal/8
+	movq	%rbp, %rdx	# 16540	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbp	# 716	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %rbp	# 718	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%rbp), %eax	# 719	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%edx, %eax	# 720	[c=4 l=2]  *addsi_1/0
+	movl	%eax, (%rbx)	# 721	[c=4 l=2]  *movsi_internal/1
+	jmp	*0(%rbp)	# 18007	[c=5 l=3]  *indirect_jump
+.L1680:
+	xorl	%r15d, %r15d	# 17975	[c=4 l=3]  *movsi_xor
+	movq	%rbx, %rdi	# 1278	[c=4 l=3]  *movdi_internal/3
+	movl	%r15d, 96(%rbx)	# 17976	[c=4 l=4]  *movsi_internal/1
+	call	do_events	# 1279	[c=0 l=5]  *call
+	movq	48(%rbx), %rdx	# 1280	[c=9 l=4]  *movdi_internal/3
+	jmp	.L616	# 18063	[c=1 l=5]  jump
+.L1678:
+	cmpq	$0, 10960(%rbx)	# 128	[c=13 l=8]  *cmpdi_ccno_1/1
+	je	.L539	# 129	[c=13 l=2]  *jcc
+	movl	116(%rbx), %esi	# 131	[c=9 l=3]  *movsi_internal/0
+	movq	%rbx, %rdi	# 134	[c=4 l=3]  *movdi_internal/3
+	call	jit_forget@PLT	# 135	[c=0 l=5]  *call
+.L539:
+	movl	116(%rbx), %r15d	# 138	[c=9 l=4]  *movsi_internal/0
+	leaq	handler.2(%rip), %r14	# 13757	[c=1 l=7]  *movdi_internal/4
+	leaq	.L542(%rip), %r12	# 160	[c=1 l=7]  *movdi_internal/4
+	leaq	.L557(%rip), %r13	# 285	[c=1 l=7]  *movdi_internal/4
+	cmpl	120(%rbx), %r15d	# 139	[c=13 l=4]  *cmpsi_1/1
+	jb	.L540	# 140	[c=13 l=2]  *jcc
+	jmp	.L558	# 18066	[c=1 l=5]  jump
+	.p2align 4,,10
+	.p2align 3
+.L1696:
+	movq	%r12, 0(%rbp)	# 161	[c=4 l=4]  *movdi_internal/5
+.L543:
+	movl	584(%rbx), %eax	# 18030	[c=9 l=6]  *movsi_internal/0
+	testl	%eax, %eax	# 18031	[c=4 l=2]  *cmpsi_ccno_1/0
+	jne	.L1695	# 269	[c=13 l=2]  *jcc
+.L555:
+	addl	$1, %r15d	# 289	[c=4 l=4]  *addsi_1/0
+	cmpl	120(%rbx), %r15d	# 290	[c=13 l=4]  *cmpsi_1/1
+	jnb	.L558	# 291	[c=13 l=6]  *jcc
+.L540:
+	movl	%r15d, %ebp	# 148	[c=1 l=3]  *zero_extendsidi2/3
+	salq	$4, %rbp	# 149	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %rbp	# 151	[c=13 l=7]  *adddi_1/1
+	movzbl	8(%rbp), %eax	# 154	[c=13 l=4]  zero_extendqidi2/0
+	cmpb	$0, 11(%rbp)	# 157	[c=13 l=4]  *cmpqi_ccno_1/1
+	movq	(%r14,%rax,8), %rax	# 155	[c=10 l=4]  *movdi_internal/3
+	movq	%rax, 0(%rbp)	# 156	[c=4 l=4]  *movdi_internal/5
+	je	.L1696	# 158	[c=13 l=2]  *jcc
+	movl	552(%rbx), %edx	# 18034	[c=9 l=6]  *movsi_internal/0
+	testl	%edx, %edx	# 18035	[c=4 l=2]  *cmpsi_ccno_1/0
+	jne	.L1697	# 167	[c=13 l=2]  *jcc
+.L544:
+	cmpq	$0, 10960(%rbx)	# 183	[c=13 l=8]  *cmpdi_ccno_1/1
+	je	.L546	# 184	[c=13 l=2]  *jcc
+	movl	%r15d, %esi	# 186	[c=4 l=3]  *movsi_internal/0
+	movq	%rbx, %rdi	# 187	[c=4 l=3]  *movdi_internal/3
+	call	jit_candidate@PLT	# 188	[c=10 l=5]  *call_value
+	testb	%al, %al	# 190	[c=4 l=2]  *cmpqi_ccno_1/0
+	je	.L546	# 191	[c=13 l=2]  *jcc
+	leaq	.L547(%rip), %rax	# 194	[c=1 l=7]  *movdi_internal/4
+	movq	%rax, 0(%rbp)	# 14968	[c=4 l=4]  *movdi_internal/5
+	jmp	.L543	# 18071	[c=1 l=2]  jump
+	.p2align 4,,10
+	.p2align 3
+.L1695:
+	movl	%r15d, %esi	# 275	[c=4 l=3]  *movsi_internal/0
+	movq	%rbx, %rdi	# 276	[c=4 l=3]  *movdi_internal/3
+	call	hle_routine@PLT	# 277	[c=10 l=5]  *call_value
+	testq	%rax, %rax	# 280	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L555	# 281	[c=13 l=2]  *jcc
+	movq	0(%rbp), %rdx	# 283	[c=5 l=4]  *movdi_internal/3
+	movq	%rdx, 40(%rax)	# 284	[c=4 l=4]  *movdi_internal/5
+	movq	%r13, 0(%rbp)	# 286	[c=4 l=4]  *movdi_internal/5
+	jmp	.L555	# 18073	[c=1 l=5]  jump
+	.p2align 4,,10
+	.p2align 3
+.L546:
+	movl	536(%rbx), %eax	# 18032	[c=9 l=6]  *movsi_internal/0
+	testl	%eax, %eax	# 18033	[c=4 l=2]  *cmpsi_ccno_1/0
+	je	.L548	# 200	[c=13 l=2]  *jcc
+	leaq	.L549(%rip), %rax	# 203	[c=1 l=7]  *movdi_internal/4
+	movq	%rax, 0(%rbp)	# 14969	[c=4 l=4]  *movdi_internal/5
+	jmp	.L543	# 18075	[c=1 l=5]  jump
+.L1697:
+	leaq	108(%rsp), %rsi	# 16278	[c=4 l=5]  *leadi
+	movq	%rbp, %rdi	# 171	[c=4 l=3]  *movdi_internal/3
+	call	delay_loop	# 172	[c=10 l=5]  *call_value
+	testl	%eax, %eax	# 174	[c=4 l=2]  *cmpsi_ccno_1/0
+	je	.L544	# 175	[c=13 l=6]  *jcc
+	leaq	.L545(%rip), %rax	# 178	[c=1 l=7]  *movdi_internal/4
+	movq	%rax, 0(%rbp)	# 14967	[c=4 l=4]  *movdi_internal/5
+	jmp	.L543	# 18077	[c=1 l=5]  jump
+.L548:
+	cmpl	$0, 520(%rbx)	# 208	[c=13 l=7]  *cmpsi_ccno_1/1
+	je	.L543	# 209	[c=13 l=6]  *jcc
+	cmpb	$0, 11(%rbp)	# 211	[c=13 l=4]  *cmpqi_ccno_1/1
+	je	.L543	# 212	[c=13 l=6]  *jcc
+	movzbl	8(%rbp), %ecx	# 214	[c=9 l=4]  *movqi_internal/4
+	cmpb	$25, %cl	# 217	[c=4 l=3]  *cmpqi_1/0
+	jbe	.L1698	# 218	[c=13 l=6]  *jcc
+	subl	$28, %ecx	# 16275	[c=4 l=3]  *addsi_1/0
+	cmpb	$60, %cl	# 249	[c=4 l=3]  *cmpqi_1/0
+	ja	.L552	# 250	[c=13 l=2]  *jcc
+	movabsq	$2303723150795361347, %rax	# 224	[c=1 l=10]  *movdi_internal/4
+	shrq	%cl, %rax	# 225	[c=4 l=3]  *lshrdi3_1/0
+	testb	$1, %al	# 16277	[c=4 l=2]  *testqi_1_maybe_si/1
+	jne	.L543	# 228	[c=13 l=6]  *jcc
+.L552:
+	movq	%rbp, %rsi	# 253	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rdi	# 254	[c=4 l=3]  *movdi_internal/3
+	call	fuse_lookup	# 255	[c=10 l=5]  *call_value
+	testl	%eax, %eax	# 259	[c=4 l=2]  *cmpsi_ccno_1/0
+	js	.L543	# 260	[c=13 l=6]  *jcc
+	cltq	# 263	[c=4 l=2]  *extendsidi2_rex64/0
+	leaq	fused.1(%rip), %rdx	# 14818	[c=1 l=7]  *movdi_internal/4
+	movq	(%rdx,%rax,8), %rax	# 264	[c=10 l=4]  *movdi_internal/3
+	movq	%rax, 0(%rbp)	# 265	[c=4 l=4]  *movdi_internal/5
+	jmp	.L543	# 18080	[c=1 l=5]  jump
+.L558:
+	movq	$0, 116(%rbx)	# 143	[c=4 l=8]  *movv2si_internal/4
+	jmp	.L538	# 18082	[c=1 l=5]  jump
+.L1676:
+	call	jit_init@PLT	# 87	[c=10 l=5]  *call_value
+	testb	%al, %al	# 90	[c=4 l=2]  *cmpqi_ccno_1/0
+	jne	.L535	# 91	[c=13 l=6]  *jcc
+	leaq	.LC42(%rip), %rsi	# 93	[c=1 l=7]  *movdi_internal/4
+	movq	%rbx, %rdi	# 95	[c=4 l=3]  *movdi_internal/3
+	call	qprintf	# 97	[c=0 l=5]  *call
+	jmp	.L535	# 18084	[c=1 l=5]  jump
+.L1286:
+	movzbl	10(%rbp), %ecx	# 11465	[c=13 l=4]  zero_extendqidi2/0
+	cmpl	$15, %ecx	# 11468	[c=4 l=3]  *cmpsi_1/0
+	jle	.L1699	# 11469	[c=13 l=6]  *jcc
+	movl	5176(%rbx), %ebp	# 11483	[c=9 l=6]  *movsi_internal/0
+	movl	$62, %eax	# 11485	[c=4 l=5]  *movsi_internal/0
+	movzbl	1004(%rbx,%rcx), %r14d	# 11482	[c=10 l=9]  *movqi_internal/4
+	movl	5180(%rbx), %r15d	# 11484	[c=9 l=7]  *movsi_internal/0
+	subl	%ebp, %eax	# 11486	[c=4 l=2]  *subsi_1/0
+	movl	%eax, %ecx	# 15641	[c=4 l=2]  *movsi_internal/0
+	movl	$61, %eax	# 11487	[c=4 l=5]  *movsi_internal/0
+	subl	%ebp, %eax	# 11488	[c=4 l=2]  *subsi_1/0
+	cmpl	%r15d, %eax	# 11489	[c=4 l=3]  *cmpsi_1/0
+	jb	.L1288	# 11490	[c=13 l=6]  *jcc
+	cmpb	$1, 1081(%rbx)	# 11494	[c=13 l=7]  *cmpqi_1/0
+	ja	.L1700	# 11495	[c=13 l=6]  *jcc
+	movq	1040(%rbx), %rax	# 13602	[c=9 l=7]  *movdi_internal/3
+	movzbl	61(%rax), %edx	# 13603	[c=13 l=4]  *zero_extendqisi2/0
+.L1290:
+	movzbl	62(%rax), %esi	# 11528	[c=13 l=4]  *zero_extendqisi2/0
+.L1292:
+	sall	$8, %esi	# 11531	[c=4 l=3]  *ashlsi3_1/0
+	orl	%edx, %esi	# 11532	[c=4 l=2]  *iorsi_1/0
+	cmpl	996(%rbx), %esi	# 11534	[c=13 l=6]  *cmpsi_1/1
+	jb	.L1701	# 11535	[c=13 l=6]  *jcc
+	movl	%esi, %edx	# 15642	[c=4 l=2]  *movsi_internal/0
+	leal	-1(%rsi), %eax	# 15961	[c=4 l=3]  *leasi
+	subl	%ebp, %edx	# 11544	[c=4 l=2]  *subsi_1/0
+	cmpl	%r15d, %edx	# 11545	[c=4 l=3]  *cmpsi_1/0
+	jb	.L1294	# 11546	[c=13 l=2]  *jcc
+	movl	%esi, %edx	# 15644	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %edx	# 11548	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %edx	# 14787	[c=5 l=6]  *andsi_1_zext
+	cmpb	$0, 1080(%rbx,%rdx)	# 11551	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L1295	# 11552	[c=13 l=6]  *jcc
+.L1294:
+	movq	1040(%rbx), %rdx	# 11556	[c=9 l=7]  *movdi_internal/3
+	movslq	%esi, %rsi	# 11555	[c=4 l=3]  *extendsidi2_rex64/1
+	movb	%r14b, (%rdx,%rsi)	# 11557	[c=4 l=4]  *movqi_internal/8
+.L1296:
+	movl	$61, %edx	# 11569	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%rbx), %edx	# 11570	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %edx	# 11571	[c=13 l=6]  *cmpsi_1/1
+	jb	.L1297	# 11572	[c=13 l=2]  *jcc
+	cmpb	$1, 1081(%rbx)	# 11576	[c=13 l=7]  *cmpqi_1/0
+	ja	.L1702	# 11577	[c=13 l=6]  *jcc
+.L1297:
+	movq	1040(%rbx), %rdx	# 11588	[c=9 l=7]  *movdi_internal/3
+	movb	%al, 61(%rdx)	# 11589	[c=4 l=3]  *movqi_internal/8
+.L1298:
+	movl	$62, %edx	# 11593	[c=4 l=5]  *movsi_internal/0
+	sarl	$8, %eax	# 11592	[c=4 l=3]  *ashrsi3_1/0
+	subl	5176(%rbx), %edx	# 11594	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %edx	# 11595	[c=13 l=6]  *cmpsi_1/1
+	jb	.L1299	# 11596	[c=13 l=2]  *jcc
+	cmpb	$1, 1081(%rbx)	# 11600	[c=13 l=7]  *cmpqi_1/0
+	ja	.L1703	# 11601	[c=13 l=6]  *jcc
+.L1299:
+	movq	1040(%rbx), %rdx	# 11612	[c=9 l=7]  *movdi_internal/3
+	movb	%al, 62(%rdx)	# 11613	[c=4 l=3]  *movqi_internal/8
+.L1300:
+	movl	(%rbx), %ebp	# 11616	[c=6 l=2]  *zero_extendsidi2/3
+	movq	%rbp, %rax	# 16758	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbp	# 11618	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %rbp	# 11620	[c=13 l=7]  *adddi_1/1
+	addl	$1, %eax	# 11621	[c=4 l=3]  *addsi_1/0
+	movl	%eax, (%rbx)	# 11622	[c=4 l=2]  *movsi_internal/1
+.L913:
+	movzbl	10(%rbp), %ecx	# 5333	[c=13 l=4]  zero_extendqidi2/0
+	cmpl	$15, %ecx	# 5336	[c=4 l=3]  *cmpsi_1/0
+	jle	.L1704	# 5337	[c=13 l=6]  *jcc
+	movl	5176(%rbx), %ebp	# 5351	[c=9 l=6]  *movsi_internal/0
+	movl	$62, %eax	# 5353	[c=4 l=5]  *movsi_internal/0
+	movzbl	1004(%rbx,%rcx), %r14d	# 5350	[c=10 l=9]  *movqi_internal/4
+	movl	5180(%rbx), %r15d	# 5352	[c=9 l=7]  *movsi_internal/0
+	subl	%ebp, %eax	# 5354	[c=4 l=2]  *subsi_1/0
+	movl	%eax, %ecx	# 15215	[c=4 l=2]  *movsi_internal/0
+	movl	$61, %eax	# 5355	[c=4 l=5]  *movsi_internal/0
+	subl	%ebp, %eax	# 5356	[c=4 l=2]  *subsi_1/0
+	cmpl	%r15d, %eax	# 5357	[c=4 l=3]  *cmpsi_1/0
+	jb	.L915	# 5358	[c=13 l=6]  *jcc
+	cmpb	$1, 1081(%rbx)	# 5362	[c=13 l=7]  *cmpqi_1/0
+	ja	.L1705	# 5363	[c=13 l=6]  *jcc
+	movq	1040(%rbx), %rax	# 13578	[c=9 l=7]  *movdi_internal/3
+	movzbl	61(%rax), %edx	# 13579	[c=13 l=4]  *zero_extendqisi2/0
+.L917:
+	movzbl	62(%rax), %esi	# 5396	[c=13 l=4]  *zero_extendqisi2/0
+.L919:
+	sall	$8, %esi	# 5399	[c=4 l=3]  *ashlsi3_1/0
+	orl	%edx, %esi	# 5400	[c=4 l=2]  *iorsi_1/0
+	cmpl	996(%rbx), %esi	# 5402	[c=13 l=6]  *cmpsi_1/1
+	jb	.L1706	# 5403	[c=13 l=6]  *jcc
+	movl	%esi, %edx	# 15216	[c=4 l=2]  *movsi_internal/0
+	leal	-1(%rsi), %eax	# 16152	[c=4 l=3]  *leasi
+	subl	%ebp, %edx	# 5412	[c=4 l=2]  *subsi_1/0
+	cmpl	%r15d, %edx	# 5413	[c=4 l=3]  *cmpsi_1/0
+	jb	.L921	# 5414	[c=13 l=2]  *jcc
+	movl	%esi, %edx	# 15218	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %edx	# 5416	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %edx	# 14801	[c=5 l=6]  *andsi_1_zext
+	cmpb	$0, 1080(%rbx,%rdx)	# 5419	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L922	# 5420	[c=13 l=6]  *jcc
+.L921:
+	movq	1040(%rbx), %rdx	# 5424	[c=9 l=7]  *movdi_internal/3
+	movslq	%esi, %rsi	# 5423	[c=4 l=3]  *extendsidi2_rex64/1
+	movb	%r14b, (%rdx,%rsi)	# 5425	[c=4 l=4]  *movqi_internal/8
+.L923:
+	movl	$61, %edx	# 5437	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%rbx), %edx	# 5438	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %edx	# 5439	[c=13 l=6]  *cmpsi_1/1
+	jb	.L924	# 5440	[c=13 l=2]  *jcc
+	cmpb	$1, 1081(%rbx)	# 5444	[c=13 l=7]  *cmpqi_1/0
+	ja	.L1707	# 5445	[c=13 l=6]  *jcc
+.L924:
+	movq	1040(%rbx), %rdx	# 5456	[c=9 l=7]  *movdi_internal/3
+	movb	%al, 61(%rdx)	# 5457	[c=4 l=3]  *movqi_internal/8
+.L925:
+	movl	$62, %edx	# 5461	[c=4 l=5]  *movsi_internal/0
+	sarl	$8, %eax	# 5460	[c=4 l=3]  *ashrsi3_1/0
+	subl	5176(%rbx), %edx	# 5462	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %edx	# 5463	[c=13 l=6]  *cmpsi_1/1
+	jb	.L926	# 5464	[c=13 l=2]  *jcc
+	cmpb	$1, 1081(%rbx)	# 5468	[c=13 l=7]  *cmpqi_1/0
+	ja	.L1708	# 5469	[c=13 l=6]  *jcc
+.L926:
+	movq	1040(%rbx), %rdx	# 5480	[c=9 l=7]  *movdi_internal/3
+	movb	%al, 62(%rdx)	# 5481	[c=4 l=3]  *movqi_internal/8
+.L927:
+	movl	(%rbx), %ebp	# 5484	[c=6 l=2]  *zero_extendsidi2/3
+	movq	%rbp, %rdx	# 16623	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbp	# 5486	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %rbp	# 5488	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%rbp), %eax	# 5489	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%edx, %eax	# 5490	[c=4 l=2]  *addsi_1/0
+	movl	%eax, (%rbx)	# 5491	[c=4 l=2]  *movsi_internal/1
+	jmp	*0(%rbp)	# 17801	[c=5 l=3]  *indirect_jump
+.L1230:
+	movzwl	12(%rbp), %edi	# 10219	[c=13 l=4]  *zero_extendhisi2/0
+	movzbl	10(%rbp), %ecx	# 10221	[c=13 l=4]  zero_extendqidi2/0
+	movl	%edi, %eax	# 16722	[c=4 l=2]  *movsi_internal/0
+	cmpl	$15, %ecx	# 10224	[c=4 l=3]  *cmpsi_1/0
+	jle	.L1709	# 10225	[c=13 l=6]  *jcc
+	movzbl	1004(%rbx,%rcx), %edx	# 10238	[c=14 l=8]  *zero_extendqisi2/0
+	andl	$136, %eax	# 10247	[c=4 l=5]  *andsi_1/0
+	movl	%edx, %esi	# 16723	[c=4 l=2]  *movsi_internal/0
+	subl	%edi, %edx	# 10240	[c=4 l=2]  *subsi_1/0
+	andl	$136, %esi	# 10244	[c=4 l=6]  *andsi_1/0
+	movb	%dl, 1004(%rbx,%rcx)	# 10242	[c=4 l=7]  *movqi_internal/8
+	andl	$511, %edx	# 10251	[c=4 l=6]  *andsi_1/0
+	leal	(%rax,%rsi,2), %eax	# 10248	[c=8 l=3]  *leasi
+	imull	$260, %eax, %eax	# 10249	[c=12 l=6]  *mulsi3_1/1
+	andl	$7680, %eax	# 10250	[c=4 l=5]  *andsi_1/0
+	orl	%edx, %eax	# 10252	[c=5 l=2]  *iorsi_1_zext
+	movzbl	100(%rbx), %edx	# 10253	[c=9 l=4]  *movqi_internal/4
+	movl	%edx, %ecx	# 15546	[c=4 l=2]  *movsi_internal/0
+	andl	$192, %ecx	# 10256	[c=4 l=6]  *andsi_2/0
+	jne	.L1232	# 10257	[c=13 l=6]  *jcc
+	leaq	flag_update_table_sub8(%rip), %rdx	# 10260	[c=1 l=7]  *movdi_internal/4
+	addq	%rdx, %rax	# 10261	[c=4 l=3]  *adddi_1/0
+	movl	$63, %edx	# 47	[c=4 l=5]  *movqi_internal/3
+.L1233:
+	movl	(%rbx), %ebp	# 10280	[c=6 l=2]  *zero_extendsidi2/3
+	movq	%rax, 104(%rbx)	# 10278	[c=4 l=4]  *movdi_internal/5
+	movb	%dl, 100(%rbx)	# 10279	[c=4 l=3]  *movqi_internal/8
+	movq	%rbp, %rax	# 16724	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbp	# 10282	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %rbp	# 10284	[c=13 l=7]  *adddi_1/1
+	addl	$1, %eax	# 10285	[c=4 l=3]  *addsi_1/0
+	movl	%eax, (%rbx)	# 10286	[c=4 l=2]  *movsi_internal/1
+.L1004:
+	movzbl	100(%rbx), %ecx	# 6435	[c=13 l=4]  *zero_extendqisi2/0
+	movq	1040(%rbx), %r9	# 6434	[c=9 l=7]  *movdi_internal/3
+	movq	104(%rbx), %r10	# 6438	[c=9 l=4]  *movdi_internal/3
+	movzwl	12(%rbp), %r11d	# 6431	[c=13 l=5]  *zero_extendhisi2/0
+	movzbl	10(%rbp), %r14d	# 6433	[c=13 l=5]  zero_extendqidi2/0
+	movzbl	63(%r9), %edx	# 6439	[c=13 l=5]  *zero_extendqisi2/0
+	movl	%ecx, %r8d	# 15285	[c=4 l=3]  *movsi_internal/0
+	movl	%ecx, %edi	# 16635	[c=4 l=2]  *movsi_internal/0
+	movzbl	(%r10), %ebp	# 17772	[c=5 l=4]  *movqi_internal/4
+	notl	%r8d	# 6437	[c=4 l=3]  *one_cmplsi2_1/0
+	movl	%r11d, %esi	# 16634	[c=4 l=3]  *movsi_internal/0
+	andl	%r8d, %edx	# 6440	[c=4 l=3]  *andsi_1/0
+	andl	%ecx, %ebp	# 18884	[c=4 l=2]  *andsi_1/0
+	orl	%ebp, %edx	# 6443	[c=4 l=2]  *iorsi_1/0
+	andl	$1, %edx	# 6444	[c=4 l=3]  *andsi_1/0
+	cmpl	$15, %r14d	# 6447	[c=4 l=4]  *cmpsi_1/0
+	jle	.L1710	# 6448	[c=13 l=6]  *jcc
+	movzbl	1004(%rbx,%r14), %eax	# 6461	[c=14 l=9]  *zero_extendqisi2/0
+	andl	$136, %esi	# 6471	[c=4 l=6]  *andsi_1/0
+	andl	$-64, %ecx	# 6474	[c=4 l=3]  *andsi_1/0
+	movl	%eax, %ebp	# 16636	[c=4 l=2]  *movsi_internal/0
+	subl	%r11d, %eax	# 6463	[c=4 l=3]  *subsi_1/0
+	subl	%edx, %eax	# 6464	[c=4 l=2]  *subsi_1/0
+	movl	%ebp, %edx	# 15289	[c=4 l=2]  *movsi_internal/0
+	andl	$136, %edx	# 6468	[c=4 l=6]  *andsi_1/0
+	movb	%al, 1004(%rbx,%r14)	# 6466	[c=4 l=8]  *movqi_internal/8
+	movl	(%rbx), %ebp	# 6497	[c=6 l=2]  *zero_extendsidi2/3
+	andl	$511, %eax	# 6479	[c=4 l=5]  *andsi_1/0
+	leal	(%rsi,%rdx,2), %edx	# 6472	[c=8 l=3]  *leasi
+	movzbl	(%r10), %esi	# 6473	[c=5 l=4]  *movqi_internal/4
+	imull	$260, %edx, %edx	# 6477	[c=12 l=6]  *mulsi3_1/1
+	andl	%esi, %edi	# 16126	[c=4 l=2]  *andsi_1/0
+	andl	%ecx, %esi	# 16127	[c=4 l=2]  *andsi_1/0
+	orl	$63, %ecx	# 16129	[c=4 l=3]  *iorsi_1/0
+	andl	$7680, %edx	# 6478	[c=4 l=6]  *andsi_1/0
+	orl	%eax, %edx	# 6480	[c=5 l=2]  *iorsi_1_zext
+	movzbl	63(%r9), %eax	# 6483	[c=13 l=5]  *zero_extendqisi2/0
+	movb	%cl, 100(%rbx)	# 6494	[c=4 l=3]  *movqi_internal/8
+	andl	%r8d, %eax	# 6484	[c=4 l=3]  *andsi_1/0
+	orl	%edi, %eax	# 6487	[c=4 l=2]  *iorsi_1/0
+	leaq	flag_update_table_sub8(%rip), %rdi	# 14841	[c=1 l=7]  *movdi_internal/4
+	orl	$-3, %eax	# 6488	[c=4 l=3]  *iorsi_1/0
+	andb	(%rdi,%rdx), %al	# 6489	[c=13 l=3]  *andqi_1/1
+	movq	%rbp, %rdx	# 16637	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbp	# 6499	[c=4 l=4]  *ashldi3_1/0
+	orl	%esi, %eax	# 16128	[c=4 l=2]  *iorsi_1/0
+	addq	1064(%rbx), %rbp	# 6501	[c=13 l=7]  *adddi_1/1
+	movb	%al, 101(%rbx)	# 6492	[c=4 l=3]  *movqi_internal/8
+	leaq	101(%rbx), %rax	# 16130	[c=4 l=4]  *leadi
+	movq	%rax, 104(%rbx)	# 6496	[c=4 l=4]  *movdi_internal/5
+	movzbl	9(%rbp), %eax	# 6502	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%edx, %eax	# 6503	[c=4 l=2]  *addsi_1/0
+	movl	%eax, (%rbx)	# 6504	[c=4 l=2]  *movsi_internal/1
+	jmp	*0(%rbp)	# 17770	[c=5 l=3]  *indirect_jump
+.L1149:
+	movzbl	10(%rbp), %ecx	# 8470	[c=13 l=4]  zero_extendqidi2/0
+	movzwl	12(%rbp), %eax	# 8471	[c=9 l=4]  *movhi_internal/2
+	cmpl	$15, %ecx	# 8475	[c=4 l=3]  *cmpsi_1/0
+	jle	.L1711	# 8476	[c=13 l=6]  *jcc
+	movb	%al, 1004(%rbx,%rcx)	# 8489	[c=4 l=7]  *movqi_internal/8
+	movl	(%rbx), %ebp	# 8490	[c=6 l=2]  *zero_extendsidi2/3
+	movq	%rbp, %rax	# 16682	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbp	# 8492	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %rbp	# 8494	[c=13 l=7]  *adddi_1/1
+	addl	$1, %eax	# 8495	[c=4 l=3]  *addsi_1/0
+	movl	%eax, (%rbx)	# 8496	[c=4 l=2]  *movsi_internal/1
+.L809:
+	movzbl	10(%rbp), %ecx	# 3857	[c=13 l=4]  zero_extendqidi2/0
+	movzwl	12(%rbp), %eax	# 3858	[c=9 l=4]  *movhi_internal/2
+	cmpl	$15, %ecx	# 3862	[c=4 l=3]  *cmpsi_1/0
+	jle	.L1712	# 3863	[c=13 l=6]  *jcc
+	movb	%al, 1004(%rbx,%rcx)	# 3876	[c=4 l=7]  *movqi_internal/8
+	movl	(%rbx), %ebp	# 3877	[c=6 l=2]  *zero_extendsidi2/3
+	movq	%rbp, %rdx	# 16589	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbp	# 3879	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %rbp	# 3881	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%rbp), %eax	# 3882	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%edx, %eax	# 3883	[c=4 l=2]  *addsi_1/0
+	movl	%eax, (%rbx)	# 3884	[c=4 l=2]  *movsi_internal/1
+	jmp	*0(%rbp)	# 17872	[c=5 l=3]  *indirect_jump
+.L1280:
+	movzwl	12(%rbp), %eax	# 11359	[c=13 l=4]  *zero_extendhisi2/0
+	movzbl	10(%rbp), %ecx	# 11360	[c=13 l=4]  *zero_extendqisi2/0
+	cmpl	$15, %eax	# 11363	[c=4 l=3]  *cmpsi_1/0
+	jle	.L1713	# 11364	[c=13 l=6]  *jcc
+	movslq	%eax, %rdx	# 11376	[c=4 l=3]  *extendsidi2_rex64/1
+	movzbl	1004(%rbx,%rdx), %esi	# 11377	[c=10 l=8]  *movqi_internal/4
+	cmpl	$15, %ecx	# 11380	[c=4 l=3]  *cmpsi_1/0
+	jle	.L1714	# 11381	[c=13 l=6]  *jcc
+	addl	$1, %eax	# 11395	[c=4 l=3]  *addsi_1/0
+	movslq	%ecx, %rdx	# 11393	[c=4 l=3]  *extendsidi2_rex64/1
+	cltq	# 11396	[c=4 l=2]  *extendsidi2_rex64/0
+	movb	%sil, 1004(%rbx,%rdx)	# 11394	[c=4 l=8]  *movqi_internal/8
+	movzbl	1004(%rbx,%rax), %edx	# 11397	[c=10 l=8]  *movqi_internal/4
+	leal	1(%rcx), %eax	# 15963	[c=4 l=3]  *leasi
+	cltq	# 11399	[c=4 l=2]  *extendsidi2_rex64/0
+	movb	%dl, 1004(%rbx,%rax)	# 11400	[c=4 l=7]  *movqi_internal/8
+	movl	(%rbx), %ebp	# 11401	[c=6 l=2]  *zero_extendsidi2/3
+	movq	%rbp, %rax	# 16756	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbp	# 11403	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %rbp	# 11405	[c=13 l=7]  *adddi_1/1
+	addl	$1, %eax	# 11406	[c=4 l=3]  *addsi_1/0
+	movl	%eax, (%rbx)	# 11407	[c=4 l=2]  *movsi_internal/1
+.L593:
+	movzbl	10(%rbp), %edx	# 818	[c=13 l=4]  zero_extendqidi2/0
+	leal	1(%rdx), %esi	# 16260	[c=4 l=3]  *leasi
+	movzbl	1004(%rbx,%rdx), %ecx	# 824	[c=14 l=8]  *zero_extendqisi2/0
+	movslq	%esi, %rsi	# 820	[c=4 l=3]  *extendsidi2_rex64/1
+	movzbl	1004(%rbx,%rsi), %eax	# 821	[c=14 l=8]  *zero_extendqisi2/0
+	sall	$8, %eax	# 822	[c=4 l=3]  *ashlsi3_1/0
+	orl	%ecx, %eax	# 825	[c=4 l=2]  *iorsi_1/0
+	movzwl	12(%rbp), %ecx	# 826	[c=13 l=4]  *zero_extendhisi2/0
+	addl	%eax, %ecx	# 827	[c=4 l=2]  *addsi_1/0
+	shrl	$5, %eax	# 835	[c=4 l=3]  *lshrsi3_1/0
+	movb	%cl, 1004(%rbx,%rdx)	# 829	[c=4 l=7]  *movqi_internal/8
+	movl	%ecx, %edx	# 14989	[c=4 l=2]  *movsi_internal/0
+	andl	$1024, %eax	# 836	[c=4 l=5]  *andsi_1/0
+	sarl	$8, %edx	# 830	[c=4 l=3]  *ashrsi3_1/0
+	orl	%edx, %eax	# 837	[c=4 l=2]  *iorsi_1/0
+	movb	%dl, 1004(%rbx,%rsi)	# 832	[c=4 l=7]  *movqi_internal/8
+	leaq	flag_update_table_add8(%rip), %rdx	# 14822	[c=1 l=7]  *movdi_internal/4
+	movl	(%rbx), %ebp	# 859	[c=6 l=2]  *zero_extendsidi2/3
+	cltq	# 838	[c=4 l=2]  *extendsidi2_rex64/0
+	movzbl	(%rdx,%rax), %edx	# 839	[c=13 l=4]  *zero_extendqisi2/0
+	xorl	%eax, %eax	# 17998	[c=4 l=2]  *movsi_xor
+	testw	%cx, %cx	# 17999	[c=4 l=3]  *cmphi_ccno_1/0
+	movq	104(%rbx), %rcx	# 850	[c=9 l=4]  *movdi_internal/3
+	setne	%al	# 18000	[c=4 l=3]  *setcc_qi_slp
+	addl	%eax, %eax	# 844	[c=4 l=2]  *ashlsi3_1/0
+	movzbl	(%rcx), %edi	# 18001	[c=5 l=3]  *movqi_internal/4
+	notl	%eax	# 845	[c=4 l=2]  *one_cmplsi2_1/0
+	andl	%eax, %edx	# 846	[c=4 l=2]  *andsi_1/0
+	movzbl	100(%rbx), %eax	# 847	[c=13 l=4]  *zero_extendqisi2/0
+	andl	$-33, %edx	# 852	[c=4 l=3]  *andsi_1/0
+	andl	$-32, %eax	# 848	[c=4 l=3]  *andsi_1/0
+	andl	%eax, %edi	# 18883	[c=4 l=2]  *andsi_1/0
+	orl	$31, %eax	# 16264	[c=4 l=3]  *iorsi_1/0
+	movl	%edi, %ecx	# 14992	[c=4 l=2]  *movqi_internal/1
+	movb	%al, 100(%rbx)	# 856	[c=4 l=3]  *movqi_internal/8
+	leaq	101(%rbx), %rax	# 16265	[c=4 l=4]  *leadi
+	orl	%ecx, %edx	# 16263	[c=4 l=2]  *iorsi_1/0
+	movq	%rax, 104(%rbx)	# 858	[c=4 l=4]  *movdi_internal/5
+	movb	%dl, 101(%rbx)	# 854	[c=4 l=3]  *movqi_internal/8
+	movq	%rbp, %rdx	# 16543	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbp	# 861	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %rbp	# 863	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%rbp), %eax	# 864	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%edx, %eax	# 865	[c=4 l=2]  *addsi_1/0
+	movl	%eax, (%rbx)	# 866	[c=4 l=2]  *movsi_internal/1
+	jmp	*0(%rbp)	# 18003	[c=5 l=3]  *indirect_jump
+.L1283:
+	movzwl	12(%rbp), %eax	# 11412	[c=13 l=4]  *zero_extendhisi2/0
+	movzbl	10(%rbp), %ecx	# 11413	[c=13 l=4]  *zero_extendqisi2/0
+	cmpl	$15, %eax	# 11416	[c=4 l=3]  *cmpsi_1/0
+	jle	.L1715	# 11417	[c=13 l=6]  *jcc
+	movslq	%eax, %rdx	# 11429	[c=4 l=3]  *extendsidi2_rex64/1
+	movzbl	1004(%rbx,%rdx), %esi	# 11430	[c=10 l=8]  *movqi_internal/4
+	cmpl	$15, %ecx	# 11433	[c=4 l=3]  *cmpsi_1/0
+	jle	.L1716	# 11434	[c=13 l=6]  *jcc
+	addl	$1, %eax	# 11448	[c=4 l=3]  *addsi_1/0
+	movslq	%ecx, %rdx	# 11446	[c=4 l=3]  *extendsidi2_rex64/1
+	cltq	# 11449	[c=4 l=2]  *extendsidi2_rex64/0
+	movb	%sil, 1004(%rbx,%rdx)	# 11447	[c=4 l=8]  *movqi_internal/8
+	movzbl	1004(%rbx,%rax), %edx	# 11450	[c=10 l=8]  *movqi_internal/4
+	leal	1(%rcx), %eax	# 15962	[c=4 l=3]  *leasi
+	cltq	# 11452	[c=4 l=2]  *extendsidi2_rex64/0
+	movb	%dl, 1004(%rbx,%rax)	# 11453	[c=4 l=7]  *movqi_internal/8
+	movl	(%rbx), %ebp	# 11454	[c=6 l=2]  *zero_extendsidi2/3
+	movq	%rbp, %rax	# 16757	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbp	# 11456	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %rbp	# 11458	[c=13 l=7]  *adddi_1/1
+	addl	$1, %eax	# 11459	[c=4 l=3]  *addsi_1/0
+	movl	%eax, (%rbx)	# 11460	[c=4 l=2]  *movsi_internal/1
+.L594:
+	movzbl	10(%rbp), %edx	# 872	[c=13 l=4]  zero_extendqidi2/0
+	movzwl	12(%rbp), %edi	# 880	[c=13 l=4]  *zero_extendhisi2/0
+	leal	1(%rdx), %ecx	# 16254	[c=4 l=3]  *leasi
+	movzbl	1004(%rbx,%rdx), %esi	# 878	[c=14 l=8]  *zero_extendqisi2/0
+	movslq	%ecx, %rcx	# 874	[c=4 l=3]  *extendsidi2_rex64/1
+	movzbl	1004(%rbx,%rcx), %eax	# 875	[c=14 l=8]  *zero_extendqisi2/0
+	sall	$8, %eax	# 876	[c=4 l=3]  *ashlsi3_1/0
+	orl	%esi, %eax	# 879	[c=4 l=2]  *iorsi_1/0
+	movl	%eax, %esi	# 14993	[c=4 l=2]  *movsi_internal/0
+	shrl	$5, %eax	# 889	[c=4 l=3]  *lshrsi3_1/0
+	subl	%edi, %esi	# 881	[c=4 l=2]  *subsi_1/0
+	andl	$1024, %eax	# 890	[c=4 l=5]  *andsi_1/0
+	movb	%sil, 1004(%rbx,%rdx)	# 883	[c=4 l=8]  *movqi_internal/8
+	movl	%esi, %edx	# 14995	[c=4 l=2]  *movsi_internal/0
+	sarl	$8, %edx	# 884	[c=4 l=3]  *ashrsi3_1/0
+	movb	%dl, 1004(%rbx,%rcx)	# 886	[c=4 l=7]  *movqi_internal/8
+	andl	$511, %edx	# 891	[c=4 l=6]  *andsi_1/0
+	movq	104(%rbx), %rcx	# 905	[c=9 l=4]  *movdi_internal/3
+	orl	%edx, %eax	# 892	[c=4 l=2]  *iorsi_1/0
+	leaq	flag_update_table_sub8(%rip), %rdx	# 14823	[c=1 l=7]  *movdi_internal/4
+	movl	(%rbx), %ebp	# 914	[c=6 l=2]  *zero_extendsidi2/3
+	cltq	# 893	[c=4 l=2]  *extendsidi2_rex64/0
+	movzbl	(%rcx), %edi	# 17995	[c=5 l=3]  *movqi_internal/4
+	movzbl	(%rdx,%rax), %edx	# 894	[c=13 l=4]  *zero_extendqisi2/0
+	xorl	%eax, %eax	# 17992	[c=4 l=2]  *movsi_xor
+	testw	%si, %si	# 17993	[c=4 l=3]  *cmphi_ccno_1/0
+	setne	%al	# 17994	[c=4 l=3]  *setcc_qi_slp
+	addl	%eax, %eax	# 899	[c=4 l=2]  *ashlsi3_1/0
+	notl	%eax	# 900	[c=4 l=2]  *one_cmplsi2_1/0
+	andl	%eax, %edx	# 901	[c=4 l=2]  *andsi_1/0
+	movzbl	100(%rbx), %eax	# 902	[c=13 l=4]  *zero_extendqisi2/0
+	andl	$-33, %edx	# 907	[c=4 l=3]  *andsi_1/0
+	andl	$-32, %eax	# 903	[c=4 l=3]  *andsi_1/0
+	andl	%eax, %edi	# 18882	[c=4 l=2]  *andsi_1/0
+	orl	$31, %eax	# 16258	[c=4 l=3]  *iorsi_1/0
+	movl	%edi, %ecx	# 14998	[c=4 l=2]  *movqi_internal/1
+	movb	%al, 100(%rbx)	# 911	[c=4 l=3]  *movqi_internal/8
+	leaq	101(%rbx), %rax	# 16259	[c=4 l=4]  *leadi
+	orl	%ecx, %edx	# 16257	[c=4 l=2]  *iorsi_1/0
+	movq	%rax, 104(%rbx)	# 913	[c=4 l=4]  *movdi_internal/5
+	movb	%dl, 101(%rbx)	# 909	[c=4 l=3]  *movqi_internal/8
+	movq	%rbp, %rdx	# 16544	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbp	# 916	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %rbp	# 918	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%rbp), %eax	# 919	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%edx, %eax	# 920	[c=4 l=2]  *addsi_1/0
+	movl	%eax, (%rbx)	# 921	[c=4 l=2]  *movsi_internal/1
+	jmp	*0(%rbp)	# 17997	[c=5 l=3]  *indirect_jump
+.L1318:
+	movzbl	10(%rbp), %r14d	# 11837	[c=13 l=5]  zero_extendqidi2/0
+	movzwl	1034(%rbx), %ebp	# 11838	[c=13 l=7]  zero_extendhidi2/0
+	movl	%ebp, %edx	# 15658	[c=4 l=2]  *movsi_internal/0
+	movq	%rbp, %rax	# 16766	[c=4 l=3]  *movdi_internal/3
+	subl	5176(%rbx), %edx	# 11841	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %edx	# 11842	[c=13 l=6]  *cmpsi_1/1
+	jb	.L1319	# 11843	[c=13 l=2]  *jcc
+	movl	%ebp, %edx	# 15660	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %edx	# 11845	[c=4 l=3]  *ashrsi3_1/0
+	movslq	%edx, %rdx	# 11846	[c=4 l=3]  *extendsidi2_rex64/1
+	cmpb	$0, 1080(%rbx,%rdx)	# 11847	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L1320	# 11848	[c=13 l=6]  *jcc
+.L1319:
+	movq	1040(%rbx), %rdx	# 11852	[c=9 l=7]  *movdi_internal/3
+	movzbl	(%rdx,%rax), %eax	# 11853	[c=13 l=4]  *zero_extendqisi2/0
+.L1321:
+	cmpl	$15, %r14d	# 11867	[c=4 l=4]  *cmpsi_1/0
+	jle	.L1717	# 11868	[c=13 l=6]  *jcc
+	movb	%al, 1004(%rbx,%r14)	# 11881	[c=4 l=8]  *movqi_internal/8
+	leal	1(%rbp), %eax	# 15957	[c=4 l=3]  *leasi
+	movl	(%rbx), %ebp	# 11885	[c=6 l=2]  *zero_extendsidi2/3
+	movw	%ax, 1034(%rbx)	# 11884	[c=4 l=7]  *movhi_internal/3
+	movq	%rbp, %rax	# 16767	[c=4 l=3]  *movdi_internal/3
+	subq	$1, 48(%rbx)	# 11882	[c=13 l=5]  *adddi_1/0
+	salq	$4, %rbp	# 11887	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %rbp	# 11889	[c=13 l=7]  *adddi_1/1
+	addl	$1, %eax	# 11890	[c=4 l=3]  *addsi_1/0
+	movl	%eax, (%rbx)	# 11891	[c=4 l=2]  *movsi_internal/1
+.L1103:
+	movzbl	10(%rbp), %ecx	# 7721	[c=13 l=4]  zero_extendqidi2/0
+	movzwl	1032(%rbx), %ebp	# 7722	[c=13 l=7]  zero_extendhidi2/0
+	movq	%rbp, %rdx	# 16663	[c=4 l=3]  *movdi_internal/3
+	cmpl	$15, %ecx	# 7726	[c=4 l=3]  *cmpsi_1/0
+	jle	.L1718	# 7727	[c=13 l=6]  *jcc
+	movl	%ebp, %eax	# 15365	[c=4 l=2]  *movsi_internal/0
+	movzbl	1004(%rbx,%rcx), %esi	# 7740	[c=10 l=8]  *movqi_internal/4
+	subl	5176(%rbx), %eax	# 7742	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %eax	# 7743	[c=13 l=6]  *cmpsi_1/1
+	jb	.L1105	# 7744	[c=13 l=2]  *jcc
+	movl	%ebp, %ecx	# 15367	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %ecx	# 7746	[c=4 l=3]  *ashrsi3_1/0
+	movslq	%ecx, %rcx	# 7747	[c=4 l=3]  *extendsidi2_rex64/1
+	cmpb	$0, 1080(%rbx,%rcx)	# 7748	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L1106	# 7749	[c=13 l=6]  *jcc
+.L1105:
+	movq	1040(%rbx), %rax	# 7753	[c=9 l=7]  *movdi_internal/3
+	movb	%sil, (%rax,%rdx)	# 7754	[c=4 l=4]  *movqi_internal/8
+.L1107:
+	leal	1(%rbp), %eax	# 16114	[c=4 l=3]  *leasi
+	movl	(%rbx), %ebp	# 7769	[c=6 l=2]  *zero_extendsidi2/3
+	subq	$1, 48(%rbx)	# 7766	[c=13 l=5]  *adddi_1/0
+	movw	%ax, 1032(%rbx)	# 7768	[c=4 l=7]  *movhi_internal/3
+	movq	%rbp, %rdx	# 16664	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbp	# 7771	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %rbp	# 7773	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%rbp), %eax	# 7774	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%edx, %eax	# 7775	[c=4 l=2]  *addsi_1/0
+	movl	%eax, (%rbx)	# 7776	[c=4 l=2]  *movsi_internal/1
+	jmp	*0(%rbp)	# 17718	[c=5 l=3]  *indirect_jump
+.L1301:
+	movzbl	10(%rbp), %ebp	# 11627	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rbx, %rdi	# 11628	[c=4 l=3]  *movdi_internal/3
+	call	pop_byte	# 11629	[c=10 l=5]  *call_value
+	cmpl	$15, %ebp	# 11634	[c=4 l=3]  *cmpsi_1/0
+	jle	.L1719	# 11635	[c=13 l=6]  *jcc
+	movb	%al, 1004(%rbx,%rbp)	# 11648	[c=4 l=7]  *movqi_internal/8
+	movl	(%rbx), %ebp	# 11649	[c=6 l=2]  *zero_extendsidi2/3
+	movq	%rbp, %rax	# 16759	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbp	# 11651	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %rbp	# 11653	[c=13 l=7]  *adddi_1/1
+	addl	$1, %eax	# 11654	[c=4 l=3]  *addsi_1/0
+	movl	%eax, (%rbx)	# 11655	[c=4 l=2]  *movsi_internal/1
+.L911:
+	movzbl	10(%rbp), %ebp	# 5298	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rbx, %rdi	# 5299	[c=4 l=3]  *movdi_internal/3
+	call	pop_byte	# 5300	[c=10 l=5]  *call_value
+	cmpl	$15, %ebp	# 5305	[c=4 l=3]  *cmpsi_1/0
+	jle	.L1720	# 5306	[c=13 l=6]  *jcc
+	movb	%al, 1004(%rbx,%rbp)	# 5319	[c=4 l=7]  *movqi_internal/8
+	movl	(%rbx), %ebp	# 5320	[c=6 l=2]  *zero_extendsidi2/3
+	movq	%rbp, %rdx	# 16622	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbp	# 5322	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %rbp	# 5324	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%rbp), %eax	# 5325	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%edx, %eax	# 5326	[c=4 l=2]  *addsi_1/0
+	movl	%eax, (%rbx)	# 5327	[c=4 l=2]  *movsi_internal/1
+	jmp	*0(%rbp)	# 17803	[c=5 l=3]  *indirect_jump
+.L1096:
+	movzbl	%sil, %edx	# 7639	[c=4 l=4]  *zero_extendqisi2/0
+	movq	%rbx, %rdi	# 7642	[c=4 l=3]  *movdi_internal/3
+	movl	%ebp, %esi	# 7641	[c=4 l=2]  *movsi_internal/0
+	call	data_write_page	# 7643	[c=0 l=5]  *call
+	jmp	.L1097	# 18108	[c=1 l=5]  jump
+.L1215:
+	movzwl	12(%rbp), %esi	# 9828	[c=13 l=4]  *zero_extendhisi2/0
+	movzbl	10(%rbp), %ecx	# 9830	[c=13 l=4]  zero_extendqidi2/0
+	movl	%esi, %edx	# 16715	[c=4 l=2]  *movsi_internal/0
+	cmpl	$15, %ecx	# 9833	[c=4 l=3]  *cmpsi_1/0
+	jle	.L1721	# 9834	[c=13 l=6]  *jcc
+	movzbl	1004(%rbx,%rcx), %eax	# 9847	[c=14 l=8]  *zero_extendqisi2/0
+	andl	$136, %edx	# 9852	[c=4 l=6]  *andsi_1/0
+	movl	%eax, %ecx	# 15503	[c=4 l=2]  *movsi_internal/0
+	subl	%esi, %eax	# 9855	[c=4 l=2]  *subsi_1/0
+	movzbl	100(%rbx), %esi	# 9860	[c=9 l=4]  *movqi_internal/4
+	andl	$136, %ecx	# 9849	[c=4 l=6]  *andsi_1/0
+	andl	$511, %eax	# 9856	[c=4 l=5]  *andsi_1/0
+	leal	(%rdx,%rcx,2), %edx	# 9853	[c=8 l=3]  *leasi
+	imull	$260, %edx, %edx	# 9857	[c=12 l=6]  *mulsi3_1/1
+	andl	$7680, %edx	# 9858	[c=4 l=6]  *andsi_1/0
+	orl	%edx, %eax	# 9859	[c=5 l=2]  *iorsi_1_zext
+	movl	%esi, %edx	# 15505	[c=4 l=2]  *movsi_internal/0
+	andl	$192, %edx	# 9863	[c=4 l=6]  *andsi_2/0
+	jne	.L1217	# 9864	[c=13 l=6]  *jcc
+	leaq	flag_update_table_sub8(%rip), %rdx	# 9867	[c=1 l=7]  *movdi_internal/4
+	movl	$63, %esi	# 45	[c=4 l=5]  *movqi_internal/3
+	addq	%rdx, %rax	# 9868	[c=4 l=3]  *adddi_1/0
+.L1218:
+	movl	(%rbx), %ecx	# 9888	[c=6 l=2]  *zero_extendsidi2/3
+	movq	1064(%rbx), %rbp	# 9887	[c=9 l=7]  *movdi_internal/3
+	movb	%sil, 100(%rbx)	# 9886	[c=4 l=4]  *movqi_internal/8
+	movq	%rax, 104(%rbx)	# 9885	[c=4 l=4]  *movdi_internal/5
+	movq	%rcx, %r9	# 16716	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rcx	# 9890	[c=4 l=4]  *ashldi3_1/0
+	addq	%rbp, %rcx	# 9891	[c=4 l=3]  *adddi_1/0
+	leal	1(%r9), %r8d	# 16041	[c=5 l=4]  *leadi
+	movl	%r8d, (%rbx)	# 9893	[c=4 l=3]  *movsi_internal/1
+	movzwl	12(%rcx), %edi	# 9894	[c=13 l=4]  zero_extendhidi2/0
+	movzbl	10(%rcx), %ecx	# 9895	[c=13 l=4]  zero_extendqidi2/0
+	cmpl	$15, %ecx	# 9898	[c=4 l=3]  *cmpsi_1/0
+	jle	.L1722	# 9899	[c=13 l=6]  *jcc
+	movzbl	1004(%rbx,%rcx), %ecx	# 9912	[c=14 l=8]  *zero_extendqisi2/0
+	movl	%ecx, %r14d	# 16717	[c=4 l=3]  *movsi_internal/0
+	cmpl	$15, %edi	# 9916	[c=4 l=3]  *cmpsi_1/0
+	jle	.L1723	# 9917	[c=13 l=6]  *jcc
+.L1220:
+	movzbl	(%rax), %r10d	# 9932	[c=5 l=4]  *movqi_internal/4
+	movq	1040(%rbx), %rax	# 9933	[c=9 l=7]  *movdi_internal/3
+	salq	$4, %r8	# 9969	[c=4 l=4]  *ashldi3_1/0
+	addl	$2, %r9d	# 9971	[c=4 l=4]  *addsi_1/0
+	movzbl	1004(%rbx,%rdi), %r11d	# 9930	[c=14 l=9]  *zero_extendqisi2/0
+	movzbl	%sil, %edi	# 9931	[c=4 l=4]  *zero_extendqisi2/0
+	andl	$136, %r14d	# 9941	[c=4 l=7]  *andsi_1/0
+	addq	%r8, %rbp	# 9970	[c=4 l=3]  *adddi_1/0
+	movzbl	63(%rax), %r15d	# 9934	[c=13 l=5]  *zero_extendqisi2/0
+	movl	%edi, %eax	# 15511	[c=4 l=2]  *movsi_internal/0
+	andl	%r10d, %esi	# 16036	[c=4 l=3]  *andsi_1/0
+	andl	$-64, %edi	# 9946	[c=4 l=3]  *andsi_1/0
+	notl	%eax	# 9935	[c=4 l=2]  *one_cmplsi2_1/0
+	movzbl	%sil, %esi	# 9938	[c=4 l=4]  *zero_extendqisi2/0
+	subl	%r11d, %ecx	# 9950	[c=4 l=3]  *subsi_1/0
+	andl	%edi, %r10d	# 16037	[c=4 l=3]  *andsi_1/0
+	andl	%r15d, %eax	# 9936	[c=4 l=3]  *andsi_1/0
+	orl	$63, %edi	# 16039	[c=4 l=3]  *iorsi_1/0
+	movl	%r9d, (%rbx)	# 9972	[c=4 l=3]  *movsi_internal/1
+	orl	%esi, %eax	# 9939	[c=4 l=2]  *iorsi_1/0
+	movl	%r11d, %esi	# 15513	[c=4 l=3]  *movsi_internal/0
+	movb	%dil, 100(%rbx)	# 9965	[c=4 l=4]  *movqi_internal/8
+	andl	$136, %esi	# 9944	[c=4 l=6]  *andsi_1/0
+	movl	%eax, %r11d	# 15515	[c=4 l=3]  *movsi_internal/0
+	orl	$-3, %eax	# 9959	[c=4 l=3]  *iorsi_1/0
+	leal	(%rsi,%r14,2), %esi	# 9945	[c=8 l=4]  *leasi
+	andl	$1, %r11d	# 9951	[c=4 l=4]  *andsi_1/0
+	imull	$260, %esi, %esi	# 9954	[c=12 l=6]  *mulsi3_1/1
+	subl	%r11d, %ecx	# 9952	[c=4 l=3]  *subsi_1/0
+	andl	$511, %ecx	# 9953	[c=4 l=6]  *andsi_1/0
+	andl	$7680, %esi	# 9955	[c=4 l=6]  *andsi_1/0
+	orl	%esi, %ecx	# 9956	[c=5 l=2]  *iorsi_1_zext
+	andb	(%rdx,%rcx), %al	# 9960	[c=13 l=3]  *andqi_1/1
+	orl	%eax, %r10d	# 16038	[c=4 l=3]  *iorsi_1/0
+	leaq	101(%rbx), %rax	# 16040	[c=4 l=4]  *leadi
+	movb	%r10b, 101(%rbx)	# 9963	[c=4 l=4]  *movqi_internal/8
+	movq	%rax, 104(%rbx)	# 9967	[c=4 l=4]  *movdi_internal/5
+	jmp	.L617	# 18113	[c=1 l=5]  jump
+.L1221:
+	movzbl	10(%rbp), %eax	# 9978	[c=13 l=4]  zero_extendqidi2/0
+	movzwl	12(%rbp), %ecx	# 9977	[c=13 l=4]  zero_extendhidi2/0
+	cmpl	$15, %eax	# 9981	[c=4 l=3]  *cmpsi_1/0
+	jle	.L1724	# 9982	[c=13 l=6]  *jcc
+	movzbl	1004(%rbx,%rax), %eax	# 9995	[c=14 l=8]  *zero_extendqisi2/0
+	movl	%eax, %edx	# 16718	[c=4 l=2]  *movsi_internal/0
+	cmpl	$15, %ecx	# 9999	[c=4 l=3]  *cmpsi_1/0
+	jle	.L1725	# 10000	[c=13 l=6]  *jcc
+	movzbl	1004(%rbx,%rcx), %ecx	# 10013	[c=10 l=8]  *movqi_internal/4
+	andl	$136, %edx	# 10015	[c=4 l=6]  *andsi_1/0
+	movl	%ecx, %esi	# 15517	[c=4 l=2]  *movsi_internal/0
+	andl	$136, %esi	# 10018	[c=4 l=6]  *andsi_1/0
+	leal	(%rsi,%rdx,2), %edx	# 10019	[c=8 l=3]  *leasi
+	movzbl	%cl, %esi	# 10020	[c=4 l=3]  *zero_extendqisi2/0
+	subl	%esi, %eax	# 10021	[c=4 l=2]  *subsi_1/0
+	movl	%eax, %ecx	# 15520	[c=4 l=2]  *movsi_internal/0
+	imull	$260, %edx, %eax	# 10023	[c=12 l=6]  *mulsi3_1/1
+	andl	$511, %ecx	# 10022	[c=4 l=6]  *andsi_1/0
+	andl	$7680, %eax	# 10024	[c=4 l=5]  *andsi_1/0
+	orl	%eax, %ecx	# 10025	[c=5 l=2]  *iorsi_1_zext
+	movzbl	100(%rbx), %eax	# 10026	[c=9 l=4]  *movqi_internal/4
+	movl	%eax, %edx	# 15521	[c=4 l=2]  *movsi_internal/0
+	andl	$192, %edx	# 10029	[c=4 l=6]  *andsi_2/0
+	jne	.L1224	# 10030	[c=13 l=6]  *jcc
+	leaq	flag_update_table_sub8(%rip), %rdx	# 10033	[c=1 l=7]  *movdi_internal/4
+	movl	$63, %eax	# 46	[c=4 l=5]  *movqi_internal/3
+	leaq	(%rdx,%rcx), %rdi	# 16035	[c=4 l=4]  *leadi
+.L1225:
+	movl	(%rbx), %ecx	# 10054	[c=6 l=2]  *zero_extendsidi2/3
+	movq	1064(%rbx), %rbp	# 10053	[c=9 l=7]  *movdi_internal/3
+	movb	%al, 100(%rbx)	# 10052	[c=4 l=3]  *movqi_internal/8
+	movq	%rdi, 104(%rbx)	# 10051	[c=4 l=4]  *movdi_internal/5
+	movq	%rcx, %r10	# 16719	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rcx	# 10056	[c=4 l=4]  *ashldi3_1/0
+	addq	%rbp, %rcx	# 10057	[c=4 l=3]  *adddi_1/0
+	leal	1(%r10), %esi	# 16032	[c=5 l=4]  *leadi
+	movl	%esi, (%rbx)	# 10059	[c=4 l=2]  *movsi_internal/1
+	movzwl	12(%rcx), %r8d	# 10060	[c=13 l=5]  zero_extendhidi2/0
+	movzbl	10(%rcx), %ecx	# 10061	[c=13 l=4]  zero_extendqidi2/0
+	cmpl	$15, %ecx	# 10064	[c=4 l=3]  *cmpsi_1/0
+	jle	.L1726	# 10065	[c=13 l=6]  *jcc
+	movzbl	1004(%rbx,%rcx), %ecx	# 10078	[c=14 l=8]  *zero_extendqisi2/0
+	movl	%ecx, 16(%rsp)	# 15527	[c=4 l=4]  *movsi_internal/1
+	movl	%ecx, %r9d	# 16720	[c=4 l=3]  *movsi_internal/0
+	cmpl	$15, %r8d	# 10082	[c=4 l=4]  *cmpsi_1/0
+	jle	.L1727	# 10083	[c=13 l=6]  *jcc
+	movq	1040(%rbx), %r11	# 10097	[c=9 l=7]  *movdi_internal/3
+	movzbl	(%rdi), %edi	# 10099	[c=5 l=3]  *movqi_internal/4
+	movzbl	%al, %ecx	# 10098	[c=4 l=3]  *zero_extendqisi2/0
+	andl	$136, %r9d	# 10107	[c=4 l=7]  *andsi_1/0
+	movzbl	1004(%rbx,%r8), %r8d	# 10096	[c=10 l=9]  *movqi_internal/4
+	movl	%ecx, %r14d	# 15528	[c=4 l=3]  *movsi_internal/0
+	andl	$-64, %ecx	# 10112	[c=4 l=3]  *andsi_1/0
+	salq	$4, %rsi	# 10136	[c=4 l=4]  *ashldi3_1/0
+	movzbl	63(%r11), %r15d	# 10100	[c=13 l=5]  *zero_extendqisi2/0
+	andl	%edi, %eax	# 16026	[c=4 l=2]  *andsi_1/0
+	notl	%r14d	# 10101	[c=4 l=3]  *one_cmplsi2_1/0
+	andl	%ecx, %edi	# 16027	[c=4 l=2]  *andsi_1/0
+	movzbl	%al, %eax	# 10104	[c=4 l=3]  *zero_extendqisi2/0
+	addq	%rbp, %rsi	# 10137	[c=4 l=3]  *adddi_1/0
+	orl	$63, %ecx	# 16029	[c=4 l=3]  *iorsi_1/0
+	andl	%r15d, %r14d	# 10102	[c=4 l=3]  *andsi_1/0
+	movb	%cl, 100(%rbx)	# 10132	[c=4 l=3]  *movqi_internal/8
+	orl	%eax, %r14d	# 10105	[c=4 l=3]  *iorsi_1/0
+	movl	%r8d, %eax	# 15530	[c=4 l=3]  *movsi_internal/0
+	andl	$136, %eax	# 10110	[c=4 l=5]  *andsi_1/0
+	leal	(%rax,%r9,2), %eax	# 10111	[c=8 l=4]  *leasi
+	movzbl	%r8b, %r9d	# 10115	[c=4 l=4]  *zero_extendqisi2/0
+	movl	16(%rsp), %r8d	# 15532	[c=9 l=5]  *movsi_internal/0
+	imull	$260, %eax, %eax	# 10120	[c=12 l=6]  *mulsi3_1/1
+	subl	%r9d, %r8d	# 10116	[c=4 l=3]  *subsi_1/0
+	movl	%r14d, %r9d	# 15534	[c=4 l=3]  *movsi_internal/0
+	andl	$1, %r9d	# 10117	[c=4 l=4]  *andsi_1/0
+	subl	%r9d, %r8d	# 10118	[c=4 l=3]  *subsi_1/0
+	andl	$7680, %eax	# 10121	[c=4 l=5]  *andsi_1/0
+	leal	2(%r10), %r9d	# 16031	[c=5 l=4]  *leadi
+	andl	$511, %r8d	# 10119	[c=4 l=7]  *andsi_1/0
+	movl	%r9d, (%rbx)	# 10139	[c=4 l=3]  *movsi_internal/1
+	orl	%eax, %r8d	# 10122	[c=5 l=3]  *iorsi_1_zext
+	movl	%r14d, %eax	# 15536	[c=4 l=3]  *movsi_internal/0
+	orl	$-3, %eax	# 10125	[c=4 l=3]  *iorsi_1/0
+	andb	(%rdx,%r8), %al	# 10126	[c=13 l=4]  *andqi_1/1
+	orl	%edi, %eax	# 16028	[c=4 l=2]  *iorsi_1/0
+	leaq	101(%rbx), %rdi	# 16030	[c=4 l=4]  *leadi
+	movb	%al, 101(%rbx)	# 10129	[c=4 l=3]  *movqi_internal/8
+	movzwl	12(%rsi), %r8d	# 10140	[c=13 l=5]  zero_extendhidi2/0
+	movq	%rdi, 104(%rbx)	# 10134	[c=4 l=4]  *movdi_internal/5
+	movzbl	10(%rsi), %esi	# 10141	[c=13 l=4]  zero_extendqidi2/0
+	cmpl	$15, %esi	# 10144	[c=4 l=3]  *cmpsi_1/0
+	jle	.L1728	# 10145	[c=13 l=6]  *jcc
+	movzbl	1004(%rbx,%rsi), %edi	# 10158	[c=14 l=8]  *zero_extendqisi2/0
+	movl	%edi, %r15d	# 16721	[c=4 l=3]  *movsi_internal/0
+	cmpl	$15, %r8d	# 10162	[c=4 l=4]  *cmpsi_1/0
+	jle	.L1729	# 10163	[c=13 l=6]  *jcc
+	movzbl	63(%r11), %r11d	# 10178	[c=13 l=5]  *zero_extendqisi2/0
+	andl	$136, %r15d	# 10185	[c=4 l=7]  *andsi_1/0
+	salq	$4, %r9	# 10211	[c=4 l=4]  *ashldi3_1/0
+	addl	$3, %r10d	# 10213	[c=4 l=4]  *addsi_1/0
+	movzbl	1004(%rbx,%r8), %r14d	# 10176	[c=14 l=9]  *zero_extendqisi2/0
+	movzbl	%cl, %r8d	# 10177	[c=4 l=4]  *zero_extendqisi2/0
+	andl	%eax, %ecx	# 16022	[c=4 l=2]  *andsi_1/0
+	movl	%r10d, (%rbx)	# 10214	[c=4 l=3]  *movsi_internal/1
+	movl	%r8d, %esi	# 15538	[c=4 l=3]  *movsi_internal/0
+	movzbl	%cl, %ecx	# 10182	[c=4 l=3]  *zero_extendqisi2/0
+	andl	$-64, %r8d	# 10190	[c=4 l=4]  *andsi_1/0
+	addq	%r9, %rbp	# 10212	[c=4 l=3]  *adddi_1/0
+	notl	%esi	# 10179	[c=4 l=2]  *one_cmplsi2_1/0
+	subl	%r14d, %edi	# 10194	[c=4 l=3]  *subsi_1/0
+	andl	%r8d, %eax	# 16023	[c=4 l=3]  *andsi_1/0
+	orl	$63, %r8d	# 16025	[c=4 l=4]  *iorsi_1/0
+	andl	%r11d, %esi	# 10180	[c=4 l=3]  *andsi_1/0
+	movb	%r8b, 100(%rbx)	# 10209	[c=4 l=4]  *movqi_internal/8
+	orl	%ecx, %esi	# 10183	[c=4 l=2]  *iorsi_1/0
+	movl	%r14d, %ecx	# 15540	[c=4 l=3]  *movsi_internal/0
+	andl	$136, %ecx	# 10188	[c=4 l=6]  *andsi_1/0
+	leal	(%rcx,%r15,2), %r11d	# 10189	[c=8 l=4]  *leasi
+	movl	%edi, %ecx	# 15543	[c=4 l=2]  *movsi_internal/0
+	movl	%esi, %edi	# 15544	[c=4 l=2]  *movsi_internal/0
+	orl	$-3, %esi	# 10203	[c=4 l=3]  *iorsi_1/0
+	imull	$260, %r11d, %r11d	# 10198	[c=12 l=7]  *mulsi3_1/1
+	andl	$1, %edi	# 10195	[c=4 l=3]  *andsi_1/0
+	subl	%edi, %ecx	# 10196	[c=4 l=2]  *subsi_1/0
+	andl	$511, %ecx	# 10197	[c=4 l=6]  *andsi_1/0
+	andl	$7680, %r11d	# 10199	[c=4 l=7]  *andsi_1/0
+	orl	%r11d, %ecx	# 10200	[c=5 l=3]  *iorsi_1_zext
+	andb	(%rdx,%rcx), %sil	# 10204	[c=13 l=4]  *andqi_1/1
+	orl	%esi, %eax	# 16024	[c=4 l=2]  *iorsi_1/0
+	movb	%al, 101(%rbx)	# 10207	[c=4 l=3]  *movqi_internal/8
+	jmp	.L662	# 18121	[c=1 l=5]  jump
+.L1238:
+	movzbl	100(%rbx), %ecx	# 10367	[c=13 l=4]  *zero_extendqisi2/0
+	movq	1040(%rbx), %r9	# 10366	[c=9 l=7]  *movdi_internal/3
+	movq	104(%rbx), %rsi	# 10370	[c=9 l=4]  *movdi_internal/3
+	movzwl	12(%rbp), %r11d	# 10363	[c=13 l=5]  *zero_extendhisi2/0
+	movzbl	10(%rbp), %r14d	# 10365	[c=13 l=5]  zero_extendqidi2/0
+	movzbl	63(%r9), %eax	# 10371	[c=13 l=5]  *zero_extendqisi2/0
+	movl	%ecx, %r8d	# 15550	[c=4 l=3]  *movsi_internal/0
+	movl	%ecx, %edi	# 16729	[c=4 l=2]  *movsi_internal/0
+	movzbl	(%rsi), %ebp	# 17639	[c=5 l=3]  *movqi_internal/4
+	notl	%r8d	# 10369	[c=4 l=3]  *one_cmplsi2_1/0
+	movl	%r11d, %edx	# 16728	[c=4 l=3]  *movsi_internal/0
+	andl	%r8d, %eax	# 10372	[c=4 l=3]  *andsi_1/0
+	andl	%ecx, %ebp	# 18881	[c=4 l=2]  *andsi_1/0
+	orl	%ebp, %eax	# 10375	[c=4 l=2]  *iorsi_1/0
+	andl	$1, %eax	# 10376	[c=4 l=3]  *andsi_1/0
+	movl	%eax, %ebp	# 15555	[c=4 l=2]  *movsi_internal/0
+	cmpl	$15, %r14d	# 10379	[c=4 l=4]  *cmpsi_1/0
+	jle	.L1730	# 10380	[c=13 l=6]  *jcc
+	movzbl	1004(%rbx,%r14), %eax	# 10393	[c=14 l=9]  *zero_extendqisi2/0
+	andl	$136, %edx	# 10403	[c=4 l=6]  *andsi_1/0
+	andl	$-64, %ecx	# 10406	[c=4 l=3]  *andsi_1/0
+	movl	%eax, %r10d	# 16730	[c=4 l=3]  *movsi_internal/0
+	subl	%r11d, %eax	# 10395	[c=4 l=3]  *subsi_1/0
+	andl	$136, %r10d	# 10400	[c=4 l=7]  *andsi_1/0
+	subl	%ebp, %eax	# 10396	[c=4 l=2]  *subsi_1/0
+	leal	(%rdx,%r10,2), %edx	# 10404	[c=8 l=4]  *leasi
+	movb	%al, 1004(%rbx,%r14)	# 10398	[c=4 l=8]  *movqi_internal/8
+	movzbl	(%rsi), %esi	# 10405	[c=5 l=3]  *movqi_internal/4
+	andl	$511, %eax	# 10411	[c=4 l=5]  *andsi_1/0
+	imull	$260, %edx, %edx	# 10409	[c=12 l=6]  *mulsi3_1/1
+	andl	%esi, %edi	# 16013	[c=4 l=2]  *andsi_1/0
+	andl	$7680, %edx	# 10410	[c=4 l=6]  *andsi_1/0
+	orl	%eax, %edx	# 10412	[c=5 l=2]  *iorsi_1_zext
+	movzbl	63(%r9), %eax	# 10415	[c=13 l=5]  *zero_extendqisi2/0
+	andl	%r8d, %eax	# 10416	[c=4 l=3]  *andsi_1/0
+	orl	%edi, %eax	# 10419	[c=4 l=2]  *iorsi_1/0
+	leaq	flag_update_table_sub8(%rip), %rdi	# 14861	[c=1 l=7]  *movdi_internal/4
+	orl	$-3, %eax	# 10420	[c=4 l=3]  *iorsi_1/0
+	andb	(%rdi,%rdx), %al	# 10421	[c=13 l=3]  *andqi_1/1
+.L1543:
+	andl	%ecx, %esi	# 16082	[c=4 l=2]  *andsi_1/0
+	orl	$63, %ecx	# 16084	[c=4 l=3]  *iorsi_1/0
+	orl	%esi, %eax	# 16083	[c=4 l=2]  *iorsi_1/0
+	movb	%cl, 100(%rbx)	# 8992	[c=4 l=3]  *movqi_internal/8
+	movb	%al, 101(%rbx)	# 8990	[c=4 l=3]  *movqi_internal/8
+.L1542:
+	leaq	101(%rbx), %rax	# 16085	[c=4 l=4]  *leadi
+	movq	%rax, 104(%rbx)	# 8994	[c=4 l=4]  *movdi_internal/5
+	jmp	.L1541	# 18124	[c=1 l=5]  jump
+.L1242:
+	movzbl	10(%rbp), %edx	# 10517	[c=13 l=4]  zero_extendqidi2/0
+	movzwl	12(%rbp), %edi	# 10525	[c=13 l=4]  *zero_extendhisi2/0
+	leal	1(%rdx), %ecx	# 16002	[c=4 l=3]  *leasi
+	movzbl	1004(%rbx,%rdx), %esi	# 10523	[c=14 l=8]  *zero_extendqisi2/0
+	movslq	%ecx, %rcx	# 10519	[c=4 l=3]  *extendsidi2_rex64/1
+	movzbl	1004(%rbx,%rcx), %eax	# 10520	[c=14 l=8]  *zero_extendqisi2/0
+	sall	$8, %eax	# 10521	[c=4 l=3]  *ashlsi3_1/0
+	orl	%esi, %eax	# 10524	[c=4 l=2]  *iorsi_1/0
+	movl	%eax, %esi	# 15562	[c=4 l=2]  *movsi_internal/0
+	shrl	$5, %eax	# 10534	[c=4 l=3]  *lshrsi3_1/0
+	subl	%edi, %esi	# 10526	[c=4 l=2]  *subsi_1/0
+	andl	$1024, %eax	# 10535	[c=4 l=5]  *andsi_1/0
+	movb	%sil, 1004(%rbx,%rdx)	# 10528	[c=4 l=8]  *movqi_internal/8
+	movl	%esi, %edx	# 15564	[c=4 l=2]  *movsi_internal/0
+	sarl	$8, %edx	# 10529	[c=4 l=3]  *ashrsi3_1/0
+	movb	%dl, 1004(%rbx,%rcx)	# 10531	[c=4 l=7]  *movqi_internal/8
+	andl	$511, %edx	# 10536	[c=4 l=6]  *andsi_1/0
+	movq	104(%rbx), %rcx	# 10550	[c=9 l=4]  *movdi_internal/3
+	orl	%edx, %eax	# 10537	[c=4 l=2]  *iorsi_1/0
+	leaq	flag_update_table_sub8(%rip), %rdx	# 14863	[c=1 l=7]  *movdi_internal/4
+	cltq	# 10538	[c=4 l=2]  *extendsidi2_rex64/0
+	movzbl	(%rcx), %edi	# 17633	[c=5 l=3]  *movqi_internal/4
+	movzbl	(%rdx,%rax), %edx	# 10539	[c=13 l=4]  *zero_extendqisi2/0
+	xorl	%eax, %eax	# 17630	[c=4 l=2]  *movsi_xor
+	testw	%si, %si	# 17631	[c=4 l=3]  *cmphi_ccno_1/0
+	setne	%al	# 17632	[c=4 l=3]  *setcc_qi_slp
+	addl	%eax, %eax	# 10544	[c=4 l=2]  *ashlsi3_1/0
+	notl	%eax	# 10545	[c=4 l=2]  *one_cmplsi2_1/0
+	andl	%eax, %edx	# 10546	[c=4 l=2]  *andsi_1/0
+	movzbl	100(%rbx), %eax	# 10547	[c=13 l=4]  *zero_extendqisi2/0
+	andl	$-33, %edx	# 10552	[c=4 l=3]  *andsi_1/0
+	andl	$-32, %eax	# 10548	[c=4 l=3]  *andsi_1/0
+	andl	%eax, %edi	# 18880	[c=4 l=2]  *andsi_1/0
+	orl	$31, %eax	# 16006	[c=4 l=3]  *iorsi_1/0
+	movl	%edi, %ecx	# 15567	[c=4 l=2]  *movqi_internal/1
+	movb	%al, 100(%rbx)	# 10556	[c=4 l=3]  *movqi_internal/8
+	orl	%ecx, %edx	# 16005	[c=4 l=2]  *iorsi_1/0
+	movb	%dl, 101(%rbx)	# 10554	[c=4 l=3]  *movqi_internal/8
+	jmp	.L1542	# 18126	[c=1 l=5]  jump
+.L1240:
+	movzbl	100(%rbx), %ecx	# 10444	[c=13 l=4]  *zero_extendqisi2/0
+	movq	1040(%rbx), %r9	# 10443	[c=9 l=7]  *movdi_internal/3
+	movq	104(%rbx), %rsi	# 10447	[c=9 l=4]  *movdi_internal/3
+	movzwl	12(%rbp), %r11d	# 10440	[c=13 l=5]  *zero_extendhisi2/0
+	movzbl	10(%rbp), %r14d	# 10442	[c=13 l=5]  zero_extendqidi2/0
+	movzbl	63(%r9), %eax	# 10448	[c=13 l=5]  *zero_extendqisi2/0
+	movl	%ecx, %r8d	# 15556	[c=4 l=3]  *movsi_internal/0
+	movl	%ecx, %edi	# 16733	[c=4 l=2]  *movsi_internal/0
+	movzbl	(%rsi), %ebp	# 17636	[c=5 l=3]  *movqi_internal/4
+	notl	%r8d	# 10446	[c=4 l=3]  *one_cmplsi2_1/0
+	movl	%r11d, %edx	# 16732	[c=4 l=3]  *movsi_internal/0
+	andl	%r8d, %eax	# 10449	[c=4 l=3]  *andsi_1/0
+	andl	%ecx, %ebp	# 18879	[c=4 l=2]  *andsi_1/0
+	orl	%ebp, %eax	# 10452	[c=4 l=2]  *iorsi_1/0
+	andl	$1, %eax	# 10453	[c=4 l=3]  *andsi_1/0
+	movl	%eax, %ebp	# 15561	[c=4 l=2]  *movsi_internal/0
+	cmpl	$15, %r14d	# 10456	[c=4 l=4]  *cmpsi_1/0
+	jle	.L1731	# 10457	[c=13 l=6]  *jcc
+	movzbl	1004(%rbx,%r14), %eax	# 10470	[c=14 l=9]  *zero_extendqisi2/0
+	andl	$136, %edx	# 10480	[c=4 l=6]  *andsi_1/0
+	andl	$-64, %ecx	# 10483	[c=4 l=3]  *andsi_1/0
+	movl	%eax, %r10d	# 16734	[c=4 l=3]  *movsi_internal/0
+	subl	%r11d, %eax	# 10472	[c=4 l=3]  *subsi_1/0
+	andl	$136, %r10d	# 10477	[c=4 l=7]  *andsi_1/0
+	subl	%ebp, %eax	# 10473	[c=4 l=2]  *subsi_1/0
+	leal	(%rdx,%r10,2), %edx	# 10481	[c=8 l=4]  *leasi
+	movb	%al, 1004(%rbx,%r14)	# 10475	[c=4 l=8]  *movqi_internal/8
+	movzbl	(%rsi), %esi	# 10482	[c=5 l=3]  *movqi_internal/4
+	andl	$511, %eax	# 10488	[c=4 l=5]  *andsi_1/0
+	imull	$260, %edx, %edx	# 10486	[c=12 l=6]  *mulsi3_1/1
+	andl	%esi, %edi	# 16008	[c=4 l=2]  *andsi_1/0
+	andl	$7680, %edx	# 10487	[c=4 l=6]  *andsi_1/0
+	orl	%eax, %edx	# 10489	[c=5 l=2]  *iorsi_1_zext
+	movzbl	63(%r9), %eax	# 10492	[c=13 l=5]  *zero_extendqisi2/0
+	andl	%r8d, %eax	# 10493	[c=4 l=3]  *andsi_1/0
+	orl	%edi, %eax	# 10496	[c=4 l=2]  *iorsi_1/0
+	leaq	flag_update_table_sub8(%rip), %rdi	# 14862	[c=1 l=7]  *movdi_internal/4
+	orl	$-3, %eax	# 10497	[c=4 l=3]  *iorsi_1/0
+	andb	(%rdi,%rdx), %al	# 10498	[c=13 l=3]  *andqi_1/1
+.L1546:
+	andl	%ecx, %esi	# 16077	[c=4 l=2]  *andsi_1/0
+	orl	$63, %ecx	# 16079	[c=4 l=3]  *iorsi_1/0
+	orl	%esi, %eax	# 16078	[c=4 l=2]  *iorsi_1/0
+	movb	%cl, 100(%rbx)	# 9079	[c=4 l=3]  *movqi_internal/8
+	movb	%al, 101(%rbx)	# 9077	[c=4 l=3]  *movqi_internal/8
+	jmp	.L1545	# 18129	[c=1 l=5]  jump
+.L1055:
+	movslq	892(%rbx), %rcx	# 7142	[c=13 l=7]  *extendsidi2_rex64/1
+	leaq	se.0(%rip), %rdx	# 7141	[c=1 l=7]  *movdi_internal/4
+	movq	1040(%rbx), %rsi	# 7139	[c=9 l=7]  *movdi_internal/3
+	movl	$2, 96(%rbx)	# 7138	[c=4 l=7]  *movsi_internal/1
+	movzwl	(%rdx,%rcx,4), %eax	# 7143	[c=14 l=4]  zero_extendhidi2/0
+	movzbl	(%rsi,%rax), %eax	# 7146	[c=9 l=4]  *movqi_internal/4
+	andb	2(%rdx,%rcx,4), %al	# 7147	[c=14 l=4]  *andqi_2_maybe_si/1
+	je	.L1056	# 7149	[c=13 l=2]  *jcc
+	movzbl	100(%rbx), %ecx	# 7152	[c=13 l=4]  *zero_extendqisi2/0
+	movzbl	63(%rsi), %eax	# 7153	[c=13 l=4]  *zero_extendqisi2/0
+	movq	48(%rbx), %rbp	# 7151	[c=9 l=4]  *movdi_internal/3
+	movl	%ecx, %edx	# 16652	[c=4 l=2]  *movsi_internal/0
+	notl	%ecx	# 7155	[c=4 l=2]  *one_cmplsi2_1/0
+	andl	%ecx, %eax	# 7156	[c=4 l=2]  *andsi_1/0
+	movq	104(%rbx), %rcx	# 7157	[c=9 l=4]  *movdi_internal/3
+	andb	(%rcx), %dl	# 7158	[c=9 l=2]  *andqi_1/1
+	orl	%edx, %eax	# 7160	[c=4 l=2]  *iorsi_1/0
+	testb	$-128, %al	# 16117	[c=4 l=2]  *testqi_1_maybe_si/1
+	je	.L1058	# 7163	[c=13 l=6]  *jcc
+	movq	%rbx, %rdi	# 7174	[c=4 l=3]  *movdi_internal/3
+	call	events_sleep@PLT	# 7175	[c=10 l=5]  *call_value
+	testb	%al, %al	# 7178	[c=4 l=2]  *cmpqi_ccno_1/0
+	je	.L1058	# 7179	[c=13 l=6]  *jcc
+	movq	64(%rbx), %rax	# 7182	[c=9 l=4]  *movdi_internal/3
+	addq	48(%rbx), %rax	# 7183	[c=13 l=4]  *adddi_1/1
+	subq	%rbp, %rax	# 7184	[c=4 l=3]  *subdi_1/0
+	movq	%rax, 64(%rbx)	# 7185	[c=4 l=4]  *movdi_internal/5
+.L1056:
+	leaq	-1(%r13), %rax	# 16116	[c=4 l=4]  *leadi
+	cmpq	%r12, %rax	# 7189	[c=4 l=3]  *cmpdi_1/0
+	jb	.L612	# 7190	[c=13 l=6]  *jcc
+	movq	56(%rbx), %rax	# 15331	[c=9 l=4]  *movdi_internal/3
+	cmpq	%rax, 48(%rbx)	# 7193	[c=13 l=4]  *cmpdi_1/0
+	jnb	.L1732	# 7194	[c=13 l=6]  *jcc
+.L1059:
+	movl	(%rbx), %ebp	# 7201	[c=6 l=2]  *zero_extendsidi2/3
+	movl	$1, 96(%rbx)	# 7206	[c=4 l=7]  *movsi_internal/1
+	movq	%rbp, %rdx	# 16653	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbp	# 7203	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %rbp	# 7205	[c=13 l=7]  *adddi_1/1
+	movzbl	11(%rbp), %eax	# 7207	[c=13 l=4]  zero_extendqidi2/0
+	addq	%rax, %r12	# 7208	[c=4 l=3]  *adddi_1/0
+	movzwl	14(%rbp), %eax	# 7210	[c=13 l=4]  zero_extendhidi2/0
+	addq	%rax, 48(%rbx)	# 7211	[c=13 l=4]  *adddi_1/0
+	movq	%r12, 40(%rbx)	# 7209	[c=4 l=4]  *movdi_internal/5
+	movzbl	9(%rbp), %eax	# 7212	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%edx, %eax	# 7213	[c=4 l=2]  *addsi_1/0
+	movl	%eax, (%rbx)	# 7214	[c=4 l=2]  *movsi_internal/1
+	jmp	*0(%rbp)	# 17737	[c=5 l=3]  *indirect_jump
+.L1047:
+	movl	$2, 96(%rbx)	# 7008	[c=4 l=7]  *movsi_internal/1
+	movzbl	10(%rbp), %ecx	# 7010	[c=13 l=4]  zero_extendqidi2/0
+	movzwl	12(%rbp), %eax	# 7009	[c=13 l=4]  *zero_extendhisi2/0
+	cmpl	$15, %ecx	# 7013	[c=4 l=3]  *cmpsi_1/0
+	jle	.L1733	# 7014	[c=13 l=6]  *jcc
+	movzbl	1004(%rbx,%rcx), %edx	# 7027	[c=14 l=8]  *zero_extendqisi2/0
+	testl	%eax, %edx	# 7029	[c=4 l=2]  *testsi_1/0
+	jne	.L1734	# 7030	[c=13 l=6]  *jcc
+.L1049:
+	leaq	-1(%r13), %rax	# 16119	[c=4 l=4]  *leadi
+	cmpq	%r12, %rax	# 7042	[c=4 l=3]  *cmpdi_1/0
+	jb	.L612	# 7043	[c=13 l=6]  *jcc
+	movq	56(%rbx), %rax	# 15328	[c=9 l=4]  *movdi_internal/3
+	cmpq	%rax, 48(%rbx)	# 7046	[c=13 l=4]  *cmpdi_1/0
+	jnb	.L1735	# 7047	[c=13 l=6]  *jcc
+.L1050:
+	movl	(%rbx), %ebp	# 7054	[c=6 l=2]  *zero_extendsidi2/3
+	movl	$1, 96(%rbx)	# 7059	[c=4 l=7]  *movsi_internal/1
+	movq	%rbp, %rdx	# 16650	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbp	# 7056	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %rbp	# 7058	[c=13 l=7]  *adddi_1/1
+	movzbl	11(%rbp), %eax	# 7060	[c=13 l=4]  zero_extendqidi2/0
+	addq	%rax, %r12	# 7061	[c=4 l=3]  *adddi_1/0
+	movzwl	14(%rbp), %eax	# 7063	[c=13 l=4]  zero_extendhidi2/0
+	addq	%rax, 48(%rbx)	# 7064	[c=13 l=4]  *adddi_1/0
+	movq	%r12, 40(%rbx)	# 7062	[c=4 l=4]  *movdi_internal/5
+	movzbl	9(%rbp), %eax	# 7065	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%edx, %eax	# 7066	[c=4 l=2]  *addsi_1/0
+	movl	%eax, (%rbx)	# 7067	[c=4 l=2]  *movsi_internal/1
+	jmp	*0(%rbp)	# 17745	[c=5 l=3]  *indirect_jump
+.L1051:
+	movl	$2, 96(%rbx)	# 7073	[c=4 l=7]  *movsi_internal/1
+	movzbl	10(%rbp), %ecx	# 7075	[c=13 l=4]  zero_extendqidi2/0
+	movzwl	12(%rbp), %eax	# 7074	[c=13 l=4]  *zero_extendhisi2/0
+	cmpl	$15, %ecx	# 7078	[c=4 l=3]  *cmpsi_1/0
+	jle	.L1736	# 7079	[c=13 l=6]  *jcc
+	movzbl	1004(%rbx,%rcx), %edx	# 7092	[c=14 l=8]  *zero_extendqisi2/0
+	testl	%eax, %edx	# 7094	[c=4 l=2]  *testsi_1/0
+	jne	.L1737	# 7095	[c=13 l=6]  *jcc
+.L1053:
+	leaq	-1(%r13), %rax	# 16118	[c=4 l=4]  *leadi
+	cmpq	%r12, %rax	# 7107	[c=4 l=3]  *cmpdi_1/0
+	jb	.L612	# 7108	[c=13 l=6]  *jcc
+	movq	56(%rbx), %rax	# 15330	[c=9 l=4]  *movdi_internal/3
+	cmpq	%rax, 48(%rbx)	# 7111	[c=13 l=4]  *cmpdi_1/0
+	jnb	.L1738	# 7112	[c=13 l=6]  *jcc
+.L1054:
+	movl	(%rbx), %ebp	# 7119	[c=6 l=2]  *zero_extendsidi2/3
+	movl	$1, 96(%rbx)	# 7124	[c=4 l=7]  *movsi_internal/1
+	movq	%rbp, %rdx	# 16651	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbp	# 7121	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %rbp	# 7123	[c=13 l=7]  *adddi_1/1
+	movzbl	11(%rbp), %eax	# 7125	[c=13 l=4]  zero_extendqidi2/0
+	addq	%rax, %r12	# 7126	[c=4 l=3]  *adddi_1/0
+	movzwl	14(%rbp), %eax	# 7128	[c=13 l=4]  zero_extendhidi2/0
+	addq	%rax, 48(%rbx)	# 7129	[c=13 l=4]  *adddi_1/0
+	movq	%r12, 40(%rbx)	# 7127	[c=4 l=4]  *movdi_internal/5
+	movzbl	9(%rbp), %eax	# 7130	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%edx, %eax	# 7131	[c=4 l=2]  *addsi_1/0
+	movl	%eax, (%rbx)	# 7132	[c=4 l=2]  *movsi_internal/1
+	jmp	*0(%rbp)	# 17741	[c=5 l=3]  *indirect_jump
+.L565:
+	movl	$2, 96(%rbx)	# 392	[c=4 l=7]  *movsi_internal/1
+	movzwl	12(%rbp), %ecx	# 393	[c=13 l=4]  *zero_extendhisi2/0
+	movl	$1, %esi	# 406	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 407	[c=4 l=3]  *movdi_internal/3
+	movzbl	10(%rbp), %eax	# 398	[c=13 l=4]  zero_extendqidi2/0
+	leaq	opcodes(%rip), %rdx	# 14819	[c=1 l=7]  *movdi_internal/4
+	movl	%ecx, %r9d	# 14973	[c=4 l=3]  *movsi_internal/0
+	salq	$4, %rax	# 399	[c=4 l=4]  *ashldi3_1/0
+	sarl	$4, %r9d	# 394	[c=4 l=4]  *ashrsi3_1/0
+	movq	(%rdx,%rax), %r8	# 402	[c=9 l=4]  *movdi_internal/3
+	andl	$31, %r9d	# 401	[c=4 l=4]  *andsi_1/0
+	leaq	.LC47(%rip), %rdx	# 404	[c=1 l=7]  *movdi_internal/4
+	xorl	%eax, %eax	# 18025	[c=4 l=2]  *movdi_xor
+	call	leave	# 409	[c=0 l=5]  *call
+.L906:
+	movzbl	10(%rbp), %ecx	# 5241	[c=13 l=4]  zero_extendqidi2/0
+	movzwl	12(%rbp), %eax	# 5240	[c=13 l=4]  zero_extendhidi2/0
+	cmpl	$15, %ecx	# 5244	[c=4 l=3]  *cmpsi_1/0
+	jle	.L1739	# 5245	[c=13 l=6]  *jcc
+	movzwl	%ax, %esi	# 5259	[c=4 l=3]  *zero_extendhisi2/0
+	movzbl	1004(%rbx,%rcx), %ecx	# 5258	[c=10 l=8]  *movqi_internal/4
+	movl	%esi, %edx	# 15210	[c=4 l=2]  *movsi_internal/0
+	subl	5176(%rbx), %edx	# 5260	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %edx	# 5261	[c=13 l=6]  *cmpsi_1/1
+	jb	.L908	# 5262	[c=13 l=2]  *jcc
+	movl	%esi, %edx	# 15212	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %edx	# 5265	[c=4 l=3]  *ashrsi3_1/0
+	movslq	%edx, %rdx	# 5266	[c=4 l=3]  *extendsidi2_rex64/1
+	cmpb	$0, 1080(%rbx,%rdx)	# 5267	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L909	# 5268	[c=13 l=6]  *jcc
+.L908:
+	movq	1040(%rbx), %rdx	# 5272	[c=9 l=7]  *movdi_internal/3
+	movb	%cl, (%rdx,%rax)	# 5273	[c=4 l=3]  *movqi_internal/8
+.L910:
+	movl	(%rbx), %ebp	# 5285	[c=6 l=2]  *zero_extendsidi2/3
+	movq	%rbp, %rdx	# 16621	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbp	# 5287	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %rbp	# 5289	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%rbp), %eax	# 5290	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%edx, %eax	# 5291	[c=4 l=2]  *addsi_1/0
+	movl	%eax, (%rbx)	# 5292	[c=4 l=2]  *movsi_internal/1
+	jmp	*0(%rbp)	# 17805	[c=5 l=3]  *indirect_jump
+.L928:
+	movl	5176(%rbx), %r15d	# 5499	[c=9 l=7]  *movsi_internal/0
+	movl	$61, %eax	# 5501	[c=4 l=5]  *movsi_internal/0
+	movzwl	12(%rbp), %ebp	# 5498	[c=9 l=4]  *movhi_internal/2
+	movl	$2, 96(%rbx)	# 5497	[c=4 l=7]  *movsi_internal/1
+	movl	5180(%rbx), %edx	# 5500	[c=9 l=6]  *movsi_internal/0
+	subl	%r15d, %eax	# 5502	[c=4 l=3]  *subsi_1/0
+	cmpl	%edx, %eax	# 5503	[c=4 l=2]  *cmpsi_1/0
+	jb	.L929	# 5504	[c=13 l=6]  *jcc
+	cmpb	$1, 1081(%rbx)	# 5508	[c=13 l=7]  *cmpqi_1/0
+	ja	.L1740	# 5509	[c=13 l=6]  *jcc
+	movq	1040(%rbx), %rax	# 13584	[c=9 l=7]  *movdi_internal/3
+	movzbl	61(%rax), %ecx	# 13585	[c=13 l=4]  *zero_extendqisi2/0
+.L931:
+	movzbl	62(%rax), %r14d	# 5546	[c=13 l=5]  *zero_extendqisi2/0
+.L933:
+	sall	$8, %r14d	# 5549	[c=4 l=4]  *ashlsi3_1/0
+	movzbl	840(%rbx), %eax	# 5554	[c=13 l=7]  *zero_extendqisi2/0
+	orl	%ecx, %r14d	# 5550	[c=4 l=3]  *iorsi_1/0
+	movl	996(%rbx), %ecx	# 5552	[c=9 l=6]  *movsi_internal/0
+	leal	1(%rcx,%rax), %eax	# 5555	[c=5 l=4]  *leasi
+	cmpl	%eax, %r14d	# 5556	[c=4 l=3]  *cmpsi_1/0
+	jb	.L1741	# 5557	[c=13 l=6]  *jcc
+	movl	%r14d, %ecx	# 15220	[c=4 l=3]  *movsi_internal/0
+	movl	(%rbx), %esi	# 5565	[c=5 l=2]  *movsi_internal/0
+	leal	-1(%r14), %eax	# 16151	[c=4 l=4]  *leasi
+	subl	%r15d, %ecx	# 5567	[c=4 l=3]  *subsi_1/0
+	cmpl	%edx, %ecx	# 5568	[c=4 l=2]  *cmpsi_1/0
+	jb	.L935	# 5569	[c=13 l=2]  *jcc
+	movl	%r14d, %edx	# 15222	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %edx	# 5571	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %edx	# 14800	[c=5 l=6]  *andsi_1_zext
+	cmpb	$0, 1080(%rbx,%rdx)	# 5574	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L936	# 5575	[c=13 l=6]  *jcc
+.L935:
+	movq	1040(%rbx), %rcx	# 5579	[c=9 l=7]  *movdi_internal/3
+	movslq	%r14d, %rdx	# 5578	[c=4 l=3]  *extendsidi2_rex64/1
+	movb	%sil, (%rcx,%rdx)	# 5580	[c=4 l=4]  *movqi_internal/8
+.L937:
+	movl	(%rbx), %edx	# 15224	[c=5 l=2]  *movsi_internal/0
+	movl	%eax, %ecx	# 15226	[c=4 l=2]  *movsi_internal/0
+	leal	-2(%r14), %r15d	# 16150	[c=4 l=4]  *leasi
+	subl	5176(%rbx), %ecx	# 5594	[c=13 l=6]  *subsi_1/1
+	shrl	$8, %edx	# 5592	[c=4 l=3]  *lshrsi3_1/0
+	cmpl	5180(%rbx), %ecx	# 5595	[c=13 l=6]  *cmpsi_1/1
+	jb	.L938	# 5596	[c=13 l=2]  *jcc
+	movl	%eax, %ecx	# 15228	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %ecx	# 5598	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %ecx	# 14799	[c=5 l=6]  *andsi_1_zext
+	cmpb	$0, 1080(%rbx,%rcx)	# 5601	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L939	# 5602	[c=13 l=6]  *jcc
+.L938:
+	movq	1040(%rbx), %rcx	# 5606	[c=9 l=7]  *movdi_internal/3
+	cltq	# 5605	[c=4 l=2]  *extendsidi2_rex64/0
+	movb	%dl, (%rcx,%rax)	# 5607	[c=4 l=3]  *movqi_internal/8
+.L940:
+	cmpb	$0, 840(%rbx)	# 5618	[c=13 l=7]  *cmpqi_ccno_1/1
+	je	.L941	# 5619	[c=13 l=2]  *jcc
+	movl	(%rbx), %edx	# 15230	[c=5 l=2]  *movsi_internal/0
+	movl	%r15d, %eax	# 15232	[c=4 l=3]  *movsi_internal/0
+	subl	$3, %r14d	# 5623	[c=4 l=4]  *addsi_1/0
+	subl	5176(%rbx), %eax	# 5624	[c=13 l=6]  *subsi_1/1
+	shrl	$16, %edx	# 5622	[c=4 l=3]  *lshrsi3_1/0
+	cmpl	5180(%rbx), %eax	# 5625	[c=13 l=6]  *cmpsi_1/1
+	jb	.L942	# 5626	[c=13 l=2]  *jcc
+	movl	%r15d, %eax	# 15234	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %eax	# 5628	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 14798	[c=5 l=5]  *andsi_1_zext
+	cmpb	$0, 1080(%rbx,%rax)	# 5631	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L943	# 5632	[c=13 l=6]  *jcc
+.L942:
+	movq	1040(%rbx), %rcx	# 5636	[c=9 l=7]  *movdi_internal/3
+	movslq	%r15d, %rax	# 5635	[c=4 l=3]  *extendsidi2_rex64/1
+	movb	%dl, (%rcx,%rax)	# 5637	[c=4 l=3]  *movqi_internal/8
+.L944:
+	movl	%r14d, %r15d	# 23	[c=4 l=3]  *movsi_internal/0
+.L941:
+	movl	$61, %eax	# 5652	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%rbx), %eax	# 5653	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %eax	# 5654	[c=13 l=6]  *cmpsi_1/1
+	jb	.L945	# 5655	[c=13 l=2]  *jcc
+	cmpb	$1, 1081(%rbx)	# 5659	[c=13 l=7]  *cmpqi_1/0
+	ja	.L1742	# 5660	[c=13 l=6]  *jcc
+.L945:
+	movq	1040(%rbx), %rax	# 5671	[c=9 l=7]  *movdi_internal/3
+	movb	%r15b, 61(%rax)	# 5672	[c=4 l=4]  *movqi_internal/8
+.L946:
+	movl	%r15d, %eax	# 15236	[c=4 l=3]  *movsi_internal/0
+	movl	$62, %edx	# 5676	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%rbx), %edx	# 5677	[c=13 l=6]  *subsi_1/1
+	sarl	$8, %eax	# 5675	[c=4 l=3]  *ashrsi3_1/0
+	cmpl	5180(%rbx), %edx	# 5678	[c=13 l=6]  *cmpsi_1/1
+	jb	.L947	# 5679	[c=13 l=2]  *jcc
+	cmpb	$1, 1081(%rbx)	# 5683	[c=13 l=7]  *cmpqi_1/0
+	ja	.L1743	# 5684	[c=13 l=6]  *jcc
+.L947:
+	movq	1040(%rbx), %rdx	# 5695	[c=9 l=7]  *movdi_internal/3
+	movb	%al, 62(%rdx)	# 5696	[c=4 l=3]  *movqi_internal/8
+.L948:
+	movswl	%bp, %eax	# 5699	[c=4 l=3]  extendhisi2/1
+	addl	(%rbx), %eax	# 5701	[c=9 l=2]  *addsi_1/1
+	leaq	-1(%r13), %rdx	# 16149	[c=4 l=4]  *leadi
+	andl	992(%rbx), %eax	# 5704	[c=13 l=6]  *andsi_1/1
+	movl	%eax, (%rbx)	# 5705	[c=4 l=2]  *movsi_internal/1
+	movzbl	840(%rbx), %eax	# 5706	[c=13 l=7]  zero_extendqidi2/0
+	addq	48(%rbx), %rax	# 5708	[c=13 l=4]  *adddi_1/1
+	movq	%rax, 48(%rbx)	# 5709	[c=4 l=4]  *movdi_internal/5
+	cmpq	%r12, %rdx	# 5711	[c=4 l=3]  *cmpdi_1/0
+	jb	.L612	# 5712	[c=13 l=6]  *jcc
+	cmpq	56(%rbx), %rax	# 5714	[c=13 l=4]  *cmpdi_1/1
+	jnb	.L1744	# 5715	[c=13 l=6]  *jcc
+.L949:
+	movl	(%rbx), %ebp	# 5722	[c=6 l=2]  *zero_extendsidi2/3
+	movl	$1, 96(%rbx)	# 5727	[c=4 l=7]  *movsi_internal/1
+	movq	%rbp, %rdx	# 16624	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbp	# 5724	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %rbp	# 5726	[c=13 l=7]  *adddi_1/1
+	movzbl	11(%rbp), %eax	# 5728	[c=13 l=4]  zero_extendqidi2/0
+	addq	%rax, %r12	# 5729	[c=4 l=3]  *adddi_1/0
+	movzwl	14(%rbp), %eax	# 5731	[c=13 l=4]  zero_extendhidi2/0
+	addq	%rax, 48(%rbx)	# 5732	[c=13 l=4]  *adddi_1/0
+	movq	%r12, 40(%rbx)	# 5730	[c=4 l=4]  *movdi_internal/5
+	movzbl	9(%rbp), %eax	# 5733	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%edx, %eax	# 5734	[c=4 l=2]  *addsi_1/0
+	movl	%eax, (%rbx)	# 5735	[c=4 l=2]  *movsi_internal/1
+	jmp	*0(%rbp)	# 17798	[c=5 l=3]  *indirect_jump
+.L1021:
+	movl	$2, 96(%rbx)	# 6659	[c=4 l=7]  *movsi_internal/1
+	movzbl	10(%rbp), %esi	# 6661	[c=13 l=4]  zero_extendqidi2/0
+	movzwl	12(%rbp), %r14d	# 6660	[c=13 l=5]  *zero_extendhisi2/0
+	movl	%esi, %edx	# 15305	[c=4 l=2]  *movsi_internal/0
+	movq	%rsi, %rax	# 16642	[c=4 l=3]  *movdi_internal/3
+	subl	5176(%rbx), %edx	# 6663	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %edx	# 6664	[c=13 l=6]  *cmpsi_1/1
+	jb	.L1022	# 6665	[c=13 l=2]  *jcc
+	movl	%esi, %edx	# 15307	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %edx	# 6668	[c=4 l=3]  *ashrsi3_1/0
+	movslq	%edx, %rdx	# 6669	[c=4 l=3]  *extendsidi2_rex64/1
+	cmpb	$0, 1080(%rbx,%rdx)	# 6670	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L1023	# 6671	[c=13 l=6]  *jcc
+.L1022:
+	movq	1040(%rbx), %rdx	# 6675	[c=9 l=7]  *movdi_internal/3
+	movzbl	(%rdx,%rax), %eax	# 6676	[c=13 l=4]  *zero_extendqisi2/0
+.L1024:
+	testl	%eax, %r14d	# 6688	[c=4 l=3]  *testsi_1/0
+	je	.L1745	# 6689	[c=13 l=6]  *jcc
+.L1025:
+	leaq	-1(%r13), %rax	# 16124	[c=4 l=4]  *leadi
+	cmpq	%r12, %rax	# 6701	[c=4 l=3]  *cmpdi_1/0
+	jb	.L612	# 6702	[c=13 l=6]  *jcc
+	movq	56(%rbx), %rax	# 15310	[c=9 l=4]  *movdi_internal/3
+	cmpq	%rax, 48(%rbx)	# 6705	[c=13 l=4]  *cmpdi_1/0
+	jnb	.L1746	# 6706	[c=13 l=6]  *jcc
+.L1026:
+	movl	(%rbx), %ebp	# 6713	[c=6 l=2]  *zero_extendsidi2/3
+	movl	$1, 96(%rbx)	# 6718	[c=4 l=7]  *movsi_internal/1
+	movq	%rbp, %rdx	# 16643	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbp	# 6715	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %rbp	# 6717	[c=13 l=7]  *adddi_1/1
+	movzbl	11(%rbp), %eax	# 6719	[c=13 l=4]  zero_extendqidi2/0
+	addq	%rax, %r12	# 6720	[c=4 l=3]  *adddi_1/0
+	movzwl	14(%rbp), %eax	# 6722	[c=13 l=4]  zero_extendhidi2/0
+	addq	%rax, 48(%rbx)	# 6723	[c=13 l=4]  *adddi_1/0
+	movq	%r12, 40(%rbx)	# 6721	[c=4 l=4]  *movdi_internal/5
+	movzbl	9(%rbp), %eax	# 6724	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%edx, %eax	# 6725	[c=4 l=2]  *addsi_1/0
+	movl	%eax, (%rbx)	# 6726	[c=4 l=2]  *movsi_internal/1
+	jmp	*0(%rbp)	# 17763	[c=5 l=3]  *indirect_jump
+.L1027:
+	movl	$2, 96(%rbx)	# 6732	[c=4 l=7]  *movsi_internal/1
+	movzbl	10(%rbp), %esi	# 6734	[c=13 l=4]  zero_extendqidi2/0
+	movzwl	12(%rbp), %r14d	# 6733	[c=13 l=5]  *zero_extendhisi2/0
+	movl	%esi, %edx	# 15311	[c=4 l=2]  *movsi_internal/0
+	movq	%rsi, %rax	# 16644	[c=4 l=3]  *movdi_internal/3
+	subl	5176(%rbx), %edx	# 6736	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %edx	# 6737	[c=13 l=6]  *cmpsi_1/1
+	jb	.L1028	# 6738	[c=13 l=2]  *jcc
+	movl	%esi, %edx	# 15313	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %edx	# 6741	[c=4 l=3]  *ashrsi3_1/0
+	movslq	%edx, %rdx	# 6742	[c=4 l=3]  *extendsidi2_rex64/1
+	cmpb	$0, 1080(%rbx,%rdx)	# 6743	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L1029	# 6744	[c=13 l=6]  *jcc
+.L1028:
+	movq	1040(%rbx), %rdx	# 6748	[c=9 l=7]  *movdi_internal/3
+	movzbl	(%rdx,%rax), %eax	# 6749	[c=13 l=4]  *zero_extendqisi2/0
+.L1030:
+	testl	%eax, %r14d	# 6761	[c=4 l=3]  *testsi_1/0
+	jne	.L1747	# 6762	[c=13 l=6]  *jcc
+.L1031:
+	leaq	-1(%r13), %rax	# 16123	[c=4 l=4]  *leadi
+	cmpq	%r12, %rax	# 6774	[c=4 l=3]  *cmpdi_1/0
+	jb	.L612	# 6775	[c=13 l=6]  *jcc
+	movq	56(%rbx), %rax	# 15316	[c=9 l=4]  *movdi_internal/3
+	cmpq	%rax, 48(%rbx)	# 6778	[c=13 l=4]  *cmpdi_1/0
+	jnb	.L1748	# 6779	[c=13 l=6]  *jcc
+.L1032:
+	movl	(%rbx), %ebp	# 6786	[c=6 l=2]  *zero_extendsidi2/3
+	movl	$1, 96(%rbx)	# 6791	[c=4 l=7]  *movsi_internal/1
+	movq	%rbp, %rdx	# 16645	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbp	# 6788	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %rbp	# 6790	[c=13 l=7]  *adddi_1/1
+	movzbl	11(%rbp), %eax	# 6792	[c=13 l=4]  zero_extendqidi2/0
+	addq	%rax, %r12	# 6793	[c=4 l=3]  *adddi_1/0
+	movzwl	14(%rbp), %eax	# 6795	[c=13 l=4]  zero_extendhidi2/0
+	addq	%rax, 48(%rbx)	# 6796	[c=13 l=4]  *adddi_1/0
+	movq	%r12, 40(%rbx)	# 6794	[c=4 l=4]  *movdi_internal/5
+	movzbl	9(%rbp), %eax	# 6797	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%edx, %eax	# 6798	[c=4 l=2]  *addsi_1/0
+	movl	%eax, (%rbx)	# 6799	[c=4 l=2]  *movsi_internal/1
+	jmp	*0(%rbp)	# 17760	[c=5 l=3]  *indirect_jump
+.L1033:
+	movl	$2, 96(%rbx)	# 6805	[c=4 l=7]  *movsi_internal/1
+	movzbl	10(%rbp), %esi	# 6807	[c=13 l=4]  zero_extendqidi2/0
+	movzwl	12(%rbp), %r14d	# 6806	[c=13 l=5]  *zero_extendhisi2/0
+	movl	%esi, %edx	# 15317	[c=4 l=2]  *movsi_internal/0
+	movq	%rsi, %rax	# 16646	[c=4 l=3]  *movdi_internal/3
+	subl	5176(%rbx), %edx	# 6809	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %edx	# 6810	[c=13 l=6]  *cmpsi_1/1
+	jb	.L1034	# 6811	[c=13 l=2]  *jcc
+	movl	%esi, %edx	# 15319	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %edx	# 6814	[c=4 l=3]  *ashrsi3_1/0
+	movslq	%edx, %rdx	# 6815	[c=4 l=3]  *extendsidi2_rex64/1
+	cmpb	$0, 1080(%rbx,%rdx)	# 6816	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L1035	# 6817	[c=13 l=6]  *jcc
+.L1034:
+	movq	1040(%rbx), %rdx	# 6821	[c=9 l=7]  *movdi_internal/3
+	movzbl	(%rdx,%rax), %eax	# 6822	[c=13 l=4]  *zero_extendqisi2/0
+.L1036:
+	testl	%eax, %r14d	# 6834	[c=4 l=3]  *testsi_1/0
+	jne	.L1749	# 6835	[c=13 l=6]  *jcc
+.L1037:
+	leaq	-1(%r13), %rax	# 16122	[c=4 l=4]  *leadi
+	cmpq	%r12, %rax	# 6847	[c=4 l=3]  *cmpdi_1/0
+	jb	.L612	# 6848	[c=13 l=6]  *jcc
+	movq	56(%rbx), %rax	# 15322	[c=9 l=4]  *movdi_internal/3
+	cmpq	%rax, 48(%rbx)	# 6851	[c=13 l=4]  *cmpdi_1/0
+	jnb	.L1750	# 6852	[c=13 l=6]  *jcc
+.L1038:
+	movl	(%rbx), %ebp	# 6859	[c=6 l=2]  *zero_extendsidi2/3
+	movl	$1, 96(%rbx)	# 6864	[c=4 l=7]  *movsi_internal/1
+	movq	%rbp, %rdx	# 16647	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbp	# 6861	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %rbp	# 6863	[c=13 l=7]  *adddi_1/1
+	movzbl	11(%rbp), %eax	# 6865	[c=13 l=4]  zero_extendqidi2/0
+	addq	%rax, %r12	# 6866	[c=4 l=3]  *adddi_1/0
+	movzwl	14(%rbp), %eax	# 6868	[c=13 l=4]  zero_extendhidi2/0
+	addq	%rax, 48(%rbx)	# 6869	[c=13 l=4]  *adddi_1/0
+	movq	%r12, 40(%rbx)	# 6867	[c=4 l=4]  *movdi_internal/5
+	movzbl	9(%rbp), %eax	# 6870	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%edx, %eax	# 6871	[c=4 l=2]  *addsi_1/0
+	movl	%eax, (%rbx)	# 6872	[c=4 l=2]  *movsi_internal/1
+	jmp	*0(%rbp)	# 17757	[c=5 l=3]  *indirect_jump
+.L1039:
+	movl	$2, 96(%rbx)	# 6878	[c=4 l=7]  *movsi_internal/1
+	movzbl	10(%rbp), %ecx	# 6880	[c=13 l=4]  zero_extendqidi2/0
+	movzwl	12(%rbp), %eax	# 6879	[c=13 l=4]  *zero_extendhisi2/0
+	cmpl	$15, %ecx	# 6883	[c=4 l=3]  *cmpsi_1/0
+	jle	.L1751	# 6884	[c=13 l=6]  *jcc
+	movzbl	1004(%rbx,%rcx), %edx	# 6897	[c=14 l=8]  *zero_extendqisi2/0
+	testl	%eax, %edx	# 6899	[c=4 l=2]  *testsi_1/0
+	je	.L1752	# 6900	[c=13 l=6]  *jcc
+.L1041:
+	leaq	-1(%r13), %rax	# 16121	[c=4 l=4]  *leadi
+	cmpq	%r12, %rax	# 6912	[c=4 l=3]  *cmpdi_1/0
+	jb	.L612	# 6913	[c=13 l=6]  *jcc
+	movq	56(%rbx), %rax	# 15324	[c=9 l=4]  *movdi_internal/3
+	cmpq	%rax, 48(%rbx)	# 6916	[c=13 l=4]  *cmpdi_1/0
+	jnb	.L1753	# 6917	[c=13 l=6]  *jcc
+.L1042:
+	movl	(%rbx), %ebp	# 6924	[c=6 l=2]  *zero_extendsidi2/3
+	movl	$1, 96(%rbx)	# 6929	[c=4 l=7]  *movsi_internal/1
+	movq	%rbp, %rdx	# 16648	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbp	# 6926	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %rbp	# 6928	[c=13 l=7]  *adddi_1/1
+	movzbl	11(%rbp), %eax	# 6930	[c=13 l=4]  zero_extendqidi2/0
+	addq	%rax, %r12	# 6931	[c=4 l=3]  *adddi_1/0
+	movzwl	14(%rbp), %eax	# 6933	[c=13 l=4]  zero_extendhidi2/0
+	addq	%rax, 48(%rbx)	# 6934	[c=13 l=4]  *adddi_1/0
+	movq	%r12, 40(%rbx)	# 6932	[c=4 l=4]  *movdi_internal/5
+	movzbl	9(%rbp), %eax	# 6935	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%edx, %eax	# 6936	[c=4 l=2]  *addsi_1/0
+	movl	%eax, (%rbx)	# 6937	[c=4 l=2]  *movsi_internal/1
+	jmp	*0(%rbp)	# 17753	[c=5 l=3]  *indirect_jump
+.L1043:
+	movl	$2, 96(%rbx)	# 6943	[c=4 l=7]  *movsi_internal/1
+	movzbl	10(%rbp), %ecx	# 6945	[c=13 l=4]  zero_extendqidi2/0
+	movzwl	12(%rbp), %eax	# 6944	[c=13 l=4]  *zero_extendhisi2/0
+	cmpl	$15, %ecx	# 6948	[c=4 l=3]  *cmpsi_1/0
+	jle	.L1754	# 6949	[c=13 l=6]  *jcc
+	movzbl	1004(%rbx,%rcx), %edx	# 6962	[c=14 l=8]  *zero_extendqisi2/0
+	testl	%eax, %edx	# 6964	[c=4 l=2]  *testsi_1/0
+	je	.L1755	# 6965	[c=13 l=6]  *jcc
+.L1045:
+	leaq	-1(%r13), %rax	# 16120	[c=4 l=4]  *leadi
+	cmpq	%r12, %rax	# 6977	[c=4 l=3]  *cmpdi_1/0
+	jb	.L612	# 6978	[c=13 l=6]  *jcc
+	movq	56(%rbx), %rax	# 15326	[c=9 l=4]  *movdi_internal/3
+	cmpq	%rax, 48(%rbx)	# 6981	[c=13 l=4]  *cmpdi_1/0
+	jnb	.L1756	# 6982	[c=13 l=6]  *jcc
+.L1046:
+	movl	(%rbx), %ebp	# 6989	[c=6 l=2]  *zero_extendsidi2/3
+	movl	$1, 96(%rbx)	# 6994	[c=4 l=7]  *movsi_internal/1
+	movq	%rbp, %rdx	# 16649	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbp	# 6991	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %rbp	# 6993	[c=13 l=7]  *adddi_1/1
+	movzbl	11(%rbp), %eax	# 6995	[c=13 l=4]  zero_extendqidi2/0
+	addq	%rax, %r12	# 6996	[c=4 l=3]  *adddi_1/0
+	movzwl	14(%rbp), %eax	# 6998	[c=13 l=4]  zero_extendhidi2/0
+	addq	%rax, 48(%rbx)	# 6999	[c=13 l=4]  *adddi_1/0
+	movq	%r12, 40(%rbx)	# 6997	[c=4 l=4]  *movdi_internal/5
+	movzbl	9(%rbp), %eax	# 7000	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%edx, %eax	# 7001	[c=4 l=2]  *addsi_1/0
+	movl	%eax, (%rbx)	# 7002	[c=4 l=2]  *movsi_internal/1
+	jmp	*0(%rbp)	# 17749	[c=5 l=3]  *indirect_jump
+.L1244:
+	movzbl	10(%rbp), %ecx	# 10623	[c=13 l=4]  zero_extendqidi2/0
+	cmpl	$15, %ecx	# 10626	[c=4 l=3]  *cmpsi_1/0
+	jle	.L1757	# 10627	[c=13 l=6]  *jcc
+	movzbl	1004(%rbx,%rcx), %edx	# 10640	[c=10 l=8]  *movqi_internal/4
+	leal	-1(%rdx), %eax	# 15994	[c=4 l=3]  *leasi
+	subl	$1, %edx	# 15995	[c=4 l=3]  *addsi_1/0
+	movb	%dl, 1004(%rbx,%rcx)	# 10646	[c=4 l=7]  *movqi_internal/8
+	movzbl	100(%rbx), %edx	# 10647	[c=9 l=4]  *movqi_internal/4
+	movzbl	%al, %eax	# 10643	[c=4 l=3]  zero_extendqidi2/0
+	movl	%edx, %ecx	# 15574	[c=4 l=2]  *movsi_internal/0
+	andl	$225, %ecx	# 10650	[c=4 l=6]  *andsi_2/0
+	jne	.L1246	# 10651	[c=13 l=6]  *jcc
+	leaq	flag_update_table_dec(%rip), %rdx	# 10654	[c=1 l=7]  *movdi_internal/4
+	addq	%rdx, %rax	# 10655	[c=4 l=3]  *adddi_1/0
+	movl	$30, %edx	# 49	[c=4 l=5]  *movqi_internal/3
+	jmp	.L1247	# 18157	[c=1 l=5]  jump
+.L1248:
+	movzwl	12(%rbp), %edi	# 10685	[c=13 l=4]  *zero_extendhisi2/0
+	movzbl	10(%rbp), %ecx	# 10687	[c=13 l=4]  zero_extendqidi2/0
+	movl	%edi, %eax	# 16739	[c=4 l=2]  *movsi_internal/0
+	cmpl	$15, %ecx	# 10690	[c=4 l=3]  *cmpsi_1/0
+	jle	.L1758	# 10691	[c=13 l=6]  *jcc
+	movzbl	1004(%rbx,%rcx), %edx	# 10704	[c=14 l=8]  *zero_extendqisi2/0
+	andl	$136, %eax	# 10713	[c=4 l=5]  *andsi_1/0
+	movl	%edx, %esi	# 16740	[c=4 l=2]  *movsi_internal/0
+	subl	%edi, %edx	# 10706	[c=4 l=2]  *subsi_1/0
+	andl	$136, %esi	# 10710	[c=4 l=6]  *andsi_1/0
+	movb	%dl, 1004(%rbx,%rcx)	# 10708	[c=4 l=7]  *movqi_internal/8
+	movzbl	100(%rbx), %ecx	# 10719	[c=9 l=4]  *movqi_internal/4
+	andl	$511, %edx	# 10717	[c=4 l=6]  *andsi_1/0
+	leal	(%rax,%rsi,2), %eax	# 10714	[c=8 l=3]  *leasi
+	imull	$260, %eax, %eax	# 10715	[c=12 l=6]  *mulsi3_1/1
+	andl	$7680, %eax	# 10716	[c=4 l=5]  *andsi_1/0
+	orl	%edx, %eax	# 10718	[c=5 l=2]  *iorsi_1_zext
+	movl	%ecx, %edx	# 15576	[c=4 l=2]  *movsi_internal/0
+	andl	$192, %edx	# 10722	[c=4 l=6]  *andsi_2/0
+	jne	.L1250	# 10723	[c=13 l=6]  *jcc
+	leaq	flag_update_table_sub8(%rip), %rdx	# 10726	[c=1 l=7]  *movdi_internal/4
+	movl	$63, %ecx	# 50	[c=4 l=5]  *movqi_internal/3
+	addq	%rdx, %rax	# 10727	[c=4 l=3]  *adddi_1/0
+.L1251:
+	movl	(%rbx), %esi	# 10747	[c=6 l=2]  *zero_extendsidi2/3
+	movq	1064(%rbx), %rbp	# 10746	[c=9 l=7]  *movdi_internal/3
+	movb	%cl, 100(%rbx)	# 10745	[c=4 l=3]  *movqi_internal/8
+	movq	1040(%rbx), %r14	# 10756	[c=9 l=7]  *movdi_internal/3
+	movq	%rax, 104(%rbx)	# 10744	[c=4 l=4]  *movdi_internal/5
+	movq	%rsi, %r10	# 16741	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rsi	# 10749	[c=4 l=4]  *ashldi3_1/0
+	addq	%rbp, %rsi	# 10750	[c=4 l=3]  *adddi_1/0
+	leal	1(%r10), %r8d	# 15989	[c=5 l=4]  *leadi
+	movzwl	12(%rsi), %edi	# 10753	[c=13 l=4]  *zero_extendhisi2/0
+	movl	%r8d, (%rbx)	# 10752	[c=4 l=3]  *movsi_internal/1
+	movzbl	10(%rsi), %r9d	# 10755	[c=13 l=5]  zero_extendqidi2/0
+	movl	%edi, %r15d	# 16742	[c=4 l=3]  *movsi_internal/0
+	movzbl	%cl, %edi	# 10757	[c=4 l=3]  *zero_extendqisi2/0
+	movl	%edi, 16(%rsp)	# 15827	[c=4 l=4]  *movsi_internal/1
+	notl	%edi	# 10758	[c=4 l=2]  *one_cmplsi2_1/0
+	movl	%edi, %esi	# 15585	[c=4 l=2]  *movsi_internal/0
+	movl	%edi, 24(%rsp)	# 15826	[c=4 l=4]  *movsi_internal/1
+	movzbl	63(%r14), %edi	# 10759	[c=13 l=5]  *zero_extendqisi2/0
+	andl	%esi, %edi	# 10760	[c=4 l=2]  *andsi_1/0
+	movzbl	(%rax), %esi	# 17619	[c=5 l=3]  *movqi_internal/4
+	andl	%ecx, %esi	# 18878	[c=4 l=2]  *andsi_1/0
+	orl	%esi, %edi	# 10763	[c=4 l=2]  *iorsi_1/0
+	andl	$1, %edi	# 10764	[c=4 l=3]  *andsi_1/0
+	movl	%edi, 32(%rsp)	# 15903	[c=4 l=4]  *movsi_internal/1
+	cmpl	$15, %r9d	# 10767	[c=4 l=4]  *cmpsi_1/0
+	jle	.L1759	# 10768	[c=13 l=6]  *jcc
+	movzwl	%r15w, %edi	# 15907	[c=4 l=4]  *zero_extendhisi2/0
+	andl	$136, %r15d	# 10791	[c=4 l=7]  *andsi_1/0
+	salq	$4, %r8	# 10818	[c=4 l=4]  *ashldi3_1/0
+	addl	$2, %r10d	# 10820	[c=4 l=4]  *addsi_1/0
+	movzbl	1004(%rbx,%r9), %esi	# 10781	[c=14 l=9]  *zero_extendqisi2/0
+	addq	%r8, %rbp	# 10819	[c=4 l=3]  *adddi_1/0
+	movl	%esi, %r11d	# 16743	[c=4 l=3]  *movsi_internal/0
+	subl	%edi, %esi	# 10783	[c=4 l=2]  *subsi_1/0
+	movl	32(%rsp), %edi	# 15901	[c=9 l=4]  *movsi_internal/0
+	andl	$136, %r11d	# 10788	[c=4 l=7]  *andsi_1/0
+	subl	%edi, %esi	# 10784	[c=4 l=2]  *subsi_1/0
+	leal	(%r15,%r11,2), %edi	# 10792	[c=8 l=4]  *leasi
+	movl	24(%rsp), %r11d	# 15592	[c=9 l=5]  *movsi_internal/0
+	imull	$260, %edi, %edi	# 10797	[c=12 l=6]  *mulsi3_1/1
+	movb	%sil, 1004(%rbx,%r9)	# 10786	[c=4 l=8]  *movqi_internal/8
+	andl	$511, %esi	# 10799	[c=4 l=6]  *andsi_1/0
+	movzbl	(%rax), %eax	# 10793	[c=5 l=3]  *movqi_internal/4
+	movl	16(%rsp), %r9d	# 15590	[c=9 l=5]  *movsi_internal/0
+	andl	%eax, %ecx	# 15984	[c=4 l=2]  *andsi_1/0
+	andl	$7680, %edi	# 10798	[c=4 l=6]  *andsi_1/0
+	andl	$-64, %r9d	# 10794	[c=4 l=4]  *andsi_1/0
+	orl	%esi, %edi	# 10800	[c=4 l=2]  *iorsi_1/0
+	andl	%r9d, %eax	# 15985	[c=4 l=3]  *andsi_1/0
+	orl	$63, %r9d	# 15987	[c=4 l=4]  *iorsi_1/0
+	movl	%edi, %esi	# 10801	[c=1 l=2]  *zero_extendsidi2/3
+	movzbl	63(%r14), %edi	# 10803	[c=13 l=5]  *zero_extendqisi2/0
+	movb	%r9b, 100(%rbx)	# 10814	[c=4 l=4]  *movqi_internal/8
+	movl	%r10d, (%rbx)	# 10821	[c=4 l=3]  *movsi_internal/1
+	andl	%r11d, %edi	# 10804	[c=4 l=3]  *andsi_1/0
+	orl	%edi, %ecx	# 10807	[c=4 l=2]  *iorsi_1/0
+	movzbl	(%rdx,%rsi), %edi	# 17616	[c=9 l=4]  *movqi_internal/4
+	orl	$-3, %ecx	# 10808	[c=4 l=3]  *iorsi_1/0
+	andl	%ecx, %edi	# 18877	[c=4 l=2]  *andsi_1/0
+	movl	%edi, %edx	# 15594	[c=4 l=2]  *movqi_internal/1
+	orl	%edx, %eax	# 15986	[c=4 l=2]  *iorsi_1/0
+	movb	%al, 101(%rbx)	# 10812	[c=4 l=3]  *movqi_internal/8
+	leaq	101(%rbx), %rax	# 15988	[c=4 l=4]  *leadi
+	movq	%rax, 104(%rbx)	# 10816	[c=4 l=4]  *movdi_internal/5
+	jmp	.L614	# 18161	[c=1 l=5]  jump
+.L1258:
+	movzbl	10(%rbp), %ecx	# 10916	[c=13 l=4]  zero_extendqidi2/0
+	movzwl	12(%rbp), %edx	# 10915	[c=13 l=4]  zero_extendhidi2/0
+	cmpl	$15, %ecx	# 10919	[c=4 l=3]  *cmpsi_1/0
+	jle	.L1760	# 10920	[c=13 l=6]  *jcc
+	movzbl	1004(%rbx,%rcx), %esi	# 10933	[c=14 l=8]  *zero_extendqisi2/0
+	movl	%esi, %eax	# 16746	[c=4 l=2]  *movsi_internal/0
+	cmpl	$15, %edx	# 10937	[c=4 l=3]  *cmpsi_1/0
+	jle	.L1761	# 10938	[c=13 l=6]  *jcc
+	movzbl	1004(%rbx,%rdx), %edx	# 10951	[c=14 l=8]  *zero_extendqisi2/0
+	andl	$136, %eax	# 10956	[c=4 l=5]  *andsi_1/0
+	leal	(%rsi,%rdx), %edi	# 15980	[c=4 l=3]  *leasi
+	movb	%dil, 1004(%rbx,%rcx)	# 10954	[c=4 l=8]  *movqi_internal/8
+	movl	%edx, %ecx	# 15599	[c=4 l=2]  *movsi_internal/0
+	addl	%esi, %edx	# 10964	[c=4 l=2]  *addsi_1/0
+	andl	$136, %ecx	# 10959	[c=4 l=6]  *andsi_1/0
+	leal	(%rcx,%rax,2), %eax	# 10960	[c=8 l=3]  *leasi
+	imull	$260, %eax, %eax	# 10961	[c=12 l=6]  *mulsi3_1/1
+	andl	$7680, %eax	# 10962	[c=4 l=5]  *andsi_1/0
+	orl	%edx, %eax	# 10965	[c=5 l=2]  *iorsi_1_zext
+	movzbl	100(%rbx), %edx	# 10966	[c=9 l=4]  *movqi_internal/4
+	movl	%edx, %ecx	# 15601	[c=4 l=2]  *movsi_internal/0
+	andl	$192, %ecx	# 10969	[c=4 l=6]  *andsi_2/0
+	jne	.L1261	# 10970	[c=13 l=6]  *jcc
+	leaq	flag_update_table_add8(%rip), %rcx	# 10973	[c=1 l=7]  *movdi_internal/4
+	movl	$63, %edx	# 52	[c=4 l=5]  *movqi_internal/3
+	addq	%rcx, %rax	# 10974	[c=4 l=3]  *adddi_1/0
+.L1262:
+	movl	(%rbx), %r8d	# 10994	[c=6 l=3]  *zero_extendsidi2/3
+	movq	1064(%rbx), %rbp	# 10993	[c=9 l=7]  *movdi_internal/3
+	movb	%dl, 100(%rbx)	# 10992	[c=4 l=3]  *movqi_internal/8
+	movq	1040(%rbx), %r11	# 11003	[c=9 l=7]  *movdi_internal/3
+	movq	%rax, 104(%rbx)	# 10991	[c=4 l=4]  *movdi_internal/5
+	movq	%r8, %r10	# 16747	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r8	# 10996	[c=4 l=4]  *ashldi3_1/0
+	addq	%rbp, %r8	# 10997	[c=4 l=3]  *adddi_1/0
+	leal	1(%r10), %esi	# 15977	[c=5 l=4]  *leadi
+	movl	%esi, (%rbx)	# 10999	[c=4 l=2]  *movsi_internal/1
+	movzwl	12(%r8), %edi	# 11000	[c=13 l=5]  zero_extendhidi2/0
+	movzbl	10(%r8), %r9d	# 11001	[c=13 l=5]  zero_extendqidi2/0
+	movzbl	%dl, %r8d	# 11002	[c=4 l=4]  *zero_extendqisi2/0
+	movzbl	63(%r11), %r11d	# 11004	[c=13 l=5]  *zero_extendqisi2/0
+	movl	%r8d, %r14d	# 15607	[c=4 l=3]  *movsi_internal/0
+	notl	%r14d	# 11005	[c=4 l=3]  *one_cmplsi2_1/0
+	andl	%r14d, %r11d	# 11006	[c=4 l=3]  *andsi_1/0
+	movzbl	(%rax), %r14d	# 17608	[c=5 l=4]  *movqi_internal/4
+	andl	%edx, %r14d	# 18876	[c=4 l=3]  *andsi_1/0
+	orl	%r14d, %r11d	# 11009	[c=4 l=3]  *iorsi_1/0
+	andl	$1, %r11d	# 11010	[c=4 l=4]  *andsi_1/0
+	movl	%r11d, 16(%rsp)	# 15612	[c=4 l=5]  *movsi_internal/1
+	cmpl	$15, %r9d	# 11013	[c=4 l=4]  *cmpsi_1/0
+	jle	.L1762	# 11014	[c=13 l=6]  *jcc
+	movzbl	1004(%rbx,%r9), %r15d	# 11027	[c=14 l=9]  *zero_extendqisi2/0
+	movl	%r15d, %r14d	# 16748	[c=4 l=3]  *movsi_internal/0
+	cmpl	$15, %edi	# 11031	[c=4 l=3]  *cmpsi_1/0
+	jle	.L1763	# 11032	[c=13 l=6]  *jcc
+	movzbl	1004(%rbx,%rdi), %edi	# 11045	[c=14 l=8]  *zero_extendqisi2/0
+	andl	$136, %r14d	# 11052	[c=4 l=7]  *andsi_1/0
+	movl	%edi, %r11d	# 16749	[c=4 l=3]  *movsi_internal/0
+	addl	%r15d, %edi	# 11047	[c=4 l=3]  *addsi_1/0
+	movl	16(%rsp), %r15d	# 15613	[c=9 l=5]  *movsi_internal/0
+	andl	$136, %r11d	# 11055	[c=4 l=7]  *andsi_1/0
+	addl	%edi, %r15d	# 11048	[c=4 l=3]  *addsi_1/0
+	leal	(%r11,%r14,2), %edi	# 11056	[c=8 l=4]  *leasi
+	imull	$260, %edi, %edi	# 11057	[c=12 l=6]  *mulsi3_1/1
+	movb	%r15b, 1004(%rbx,%r9)	# 11050	[c=4 l=8]  *movqi_internal/8
+	andl	$7680, %edi	# 11058	[c=4 l=6]  *andsi_1/0
+	orl	%r15d, %edi	# 11059	[c=5 l=3]  *iorsi_1_zext
+	andl	$-64, %r8d	# 11061	[c=4 l=4]  *andsi_2/0
+	jne	.L1265	# 11062	[c=13 l=6]  *jcc
+	movl	%edi, %eax	# 11064	[c=1 l=2]  *zero_extendsidi2/3
+	movl	$63, %edx	# 53	[c=4 l=5]  *movqi_internal/3
+	addq	%rcx, %rax	# 11066	[c=4 l=3]  *adddi_1/0
+.L1266:
+	salq	$4, %rsi	# 11085	[c=4 l=4]  *ashldi3_1/0
+	addl	$2, %r10d	# 11087	[c=4 l=4]  *addsi_1/0
+	movq	%rax, 104(%rbx)	# 11082	[c=4 l=4]  *movdi_internal/5
+	movb	%dl, 100(%rbx)	# 11083	[c=4 l=3]  *movqi_internal/8
+	addq	%rsi, %rbp	# 11086	[c=4 l=3]  *adddi_1/0
+	movl	%r10d, (%rbx)	# 11088	[c=4 l=3]  *movsi_internal/1
+	jmp	.L583	# 18167	[c=1 l=5]  jump
+.L1267:
+	movzbl	10(%rbp), %ecx	# 11094	[c=13 l=4]  zero_extendqidi2/0
+	movzwl	12(%rbp), %eax	# 11093	[c=13 l=4]  zero_extendhidi2/0
+	cmpl	$15, %ecx	# 11097	[c=4 l=3]  *cmpsi_1/0
+	jle	.L1764	# 11098	[c=13 l=6]  *jcc
+	movzbl	1004(%rbx,%rcx), %esi	# 11111	[c=14 l=8]  *zero_extendqisi2/0
+	movl	%esi, %edx	# 16750	[c=4 l=2]  *movsi_internal/0
+	cmpl	$15, %eax	# 11115	[c=4 l=3]  *cmpsi_1/0
+	jle	.L1765	# 11116	[c=13 l=6]  *jcc
+	movzbl	1004(%rbx,%rax), %eax	# 11129	[c=14 l=8]  *zero_extendqisi2/0
+	andl	$136, %edx	# 11134	[c=4 l=6]  *andsi_1/0
+	leal	(%rsi,%rax), %edi	# 15974	[c=4 l=3]  *leasi
+	movb	%dil, 1004(%rbx,%rcx)	# 11132	[c=4 l=8]  *movqi_internal/8
+	movl	%eax, %ecx	# 15615	[c=4 l=2]  *movsi_internal/0
+	addl	%esi, %eax	# 11142	[c=4 l=2]  *addsi_1/0
+	andl	$136, %ecx	# 11137	[c=4 l=6]  *andsi_1/0
+	leal	(%rcx,%rdx,2), %edx	# 11138	[c=8 l=3]  *leasi
+	imull	$260, %edx, %edx	# 11139	[c=12 l=6]  *mulsi3_1/1
+	andl	$7680, %edx	# 11140	[c=4 l=6]  *andsi_1/0
+	orl	%eax, %edx	# 11143	[c=5 l=2]  *iorsi_1_zext
+	movzbl	100(%rbx), %eax	# 11144	[c=9 l=4]  *movqi_internal/4
+	movl	%eax, %ecx	# 15617	[c=4 l=2]  *movsi_internal/0
+	andl	$192, %ecx	# 11147	[c=4 l=6]  *andsi_2/0
+	jne	.L1270	# 11148	[c=13 l=6]  *jcc
+	leaq	flag_update_table_add8(%rip), %rcx	# 11151	[c=1 l=7]  *movdi_internal/4
+	movl	$63, %eax	# 54	[c=4 l=5]  *movqi_internal/3
+	addq	%rcx, %rdx	# 11152	[c=4 l=3]  *adddi_1/0
+.L1271:
+	movl	(%rbx), %r9d	# 11172	[c=6 l=3]  *zero_extendsidi2/3
+	movq	1064(%rbx), %r15	# 11171	[c=9 l=7]  *movdi_internal/3
+	movb	%al, 100(%rbx)	# 11170	[c=4 l=3]  *movqi_internal/8
+	movq	1040(%rbx), %r14	# 11180	[c=9 l=7]  *movdi_internal/3
+	movq	%rdx, 104(%rbx)	# 11169	[c=4 l=4]  *movdi_internal/5
+	movq	%r9, %rdi	# 16751	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r9	# 11174	[c=4 l=4]  *ashldi3_1/0
+	addq	%r15, %r9	# 11175	[c=4 l=3]  *adddi_1/0
+	leal	1(%rdi), %esi	# 15971	[c=4 l=3]  *leasi
+	movl	%esi, (%rbx)	# 11177	[c=4 l=2]  *movsi_internal/1
+	movzwl	12(%r9), %r8d	# 11178	[c=13 l=5]  zero_extendhidi2/0
+	movzbl	10(%r9), %r10d	# 11179	[c=13 l=5]  zero_extendqidi2/0
+	movzbl	%al, %r9d	# 11181	[c=4 l=4]  *zero_extendqisi2/0
+	movzbl	63(%r14), %ebp	# 11182	[c=13 l=5]  *zero_extendqisi2/0
+	movl	%esi, 16(%rsp)	# 15905	[c=4 l=4]  *movsi_internal/1
+	movl	%r9d, %r11d	# 15623	[c=4 l=3]  *movsi_internal/0
+	notl	%r11d	# 11183	[c=4 l=3]  *one_cmplsi2_1/0
+	andl	%ebp, %r11d	# 11184	[c=4 l=3]  *andsi_1/0
+	movzbl	(%rdx), %ebp	# 17600	[c=5 l=3]  *movqi_internal/4
+	andl	%eax, %ebp	# 18875	[c=4 l=2]  *andsi_1/0
+	orl	%ebp, %r11d	# 11187	[c=4 l=3]  *iorsi_1/0
+	andl	$1, %r11d	# 11188	[c=4 l=4]  *andsi_1/0
+	movl	%r11d, 24(%rsp)	# 15628	[c=4 l=5]  *movsi_internal/1
+	cmpl	$15, %r10d	# 11191	[c=4 l=4]  *cmpsi_1/0
+	jle	.L1766	# 11192	[c=13 l=6]  *jcc
+	movzbl	1004(%rbx,%r10), %r11d	# 11205	[c=14 l=9]  *zero_extendqisi2/0
+	movl	%r11d, %ebp	# 16752	[c=4 l=3]  *movsi_internal/0
+	cmpl	$15, %r8d	# 11209	[c=4 l=4]  *cmpsi_1/0
+	jle	.L1767	# 11210	[c=13 l=6]  *jcc
+	movzbl	1004(%rbx,%r8), %r8d	# 11223	[c=14 l=9]  *zero_extendqisi2/0
+	movl	24(%rsp), %esi	# 15631	[c=9 l=4]  *movsi_internal/0
+	movl	%r8d, %r11d	# 16753	[c=4 l=3]  *movsi_internal/0
+	addl	%ebp, %r8d	# 11225	[c=4 l=3]  *addsi_1/0
+	andl	$136, %ebp	# 11230	[c=4 l=6]  *andsi_1/0
+	addl	%esi, %r8d	# 11226	[c=4 l=3]  *addsi_1/0
+	andl	$136, %r11d	# 11233	[c=4 l=7]  *andsi_1/0
+	movb	%r8b, 1004(%rbx,%r10)	# 11228	[c=4 l=8]  *movqi_internal/8
+	leal	(%r11,%rbp,2), %r10d	# 11234	[c=8 l=4]  *leasi
+	imull	$260, %r10d, %r10d	# 11235	[c=12 l=7]  *mulsi3_1/1
+	andl	$7680, %r10d	# 11236	[c=4 l=7]  *andsi_1/0
+	orl	%r10d, %r8d	# 11237	[c=5 l=3]  *iorsi_1_zext
+	andl	$-64, %r9d	# 11239	[c=4 l=4]  *andsi_2/0
+	jne	.L1274	# 11240	[c=13 l=6]  *jcc
+	movl	%r8d, %edx	# 11242	[c=1 l=3]  *zero_extendsidi2/3
+	movl	$63, %eax	# 55	[c=4 l=5]  *movqi_internal/3
+	addq	%rcx, %rdx	# 11244	[c=4 l=3]  *adddi_1/0
+.L1275:
+	movl	16(%rsp), %esi	# 11262	[c=10 l=4]  *zero_extendsidi2/3
+	movb	%al, 100(%rbx)	# 11261	[c=4 l=3]  *movqi_internal/8
+	movq	%rdx, 104(%rbx)	# 11260	[c=4 l=4]  *movdi_internal/5
+	salq	$4, %rsi	# 11263	[c=4 l=4]  *ashldi3_1/0
+	leaq	(%r15,%rsi), %r9	# 15967	[c=4 l=4]  *leadi
+	leal	2(%rdi), %esi	# 15968	[c=5 l=3]  *leadi
+	movl	%esi, (%rbx)	# 11266	[c=4 l=2]  *movsi_internal/1
+	movzwl	12(%r9), %r8d	# 11267	[c=13 l=5]  zero_extendhidi2/0
+	movzbl	10(%r9), %r10d	# 11268	[c=13 l=5]  zero_extendqidi2/0
+	movzbl	%al, %r9d	# 11269	[c=4 l=4]  *zero_extendqisi2/0
+	movzbl	63(%r14), %r11d	# 11270	[c=13 l=5]  *zero_extendqisi2/0
+	movl	%r9d, %ebp	# 15632	[c=4 l=3]  *movsi_internal/0
+	notl	%ebp	# 11271	[c=4 l=2]  *one_cmplsi2_1/0
+	andl	%ebp, %r11d	# 11272	[c=4 l=3]  *andsi_1/0
+	movzbl	(%rdx), %ebp	# 17596	[c=5 l=3]  *movqi_internal/4
+	andl	%eax, %ebp	# 18874	[c=4 l=2]  *andsi_1/0
+	orl	%ebp, %r11d	# 11275	[c=4 l=3]  *iorsi_1/0
+	andl	$1, %r11d	# 11276	[c=4 l=4]  *andsi_1/0
+	movl	%r11d, 16(%rsp)	# 15637	[c=4 l=5]  *movsi_internal/1
+	cmpl	$15, %r10d	# 11279	[c=4 l=4]  *cmpsi_1/0
+	jle	.L1768	# 11280	[c=13 l=6]  *jcc
+	movzbl	1004(%rbx,%r10), %ebp	# 11293	[c=14 l=9]  *zero_extendqisi2/0
+	movl	%ebp, %r11d	# 16754	[c=4 l=3]  *movsi_internal/0
+	cmpl	$15, %r8d	# 11297	[c=4 l=4]  *cmpsi_1/0
+	jle	.L1769	# 11298	[c=13 l=6]  *jcc
+	movzbl	1004(%rbx,%r8), %r8d	# 11311	[c=14 l=9]  *zero_extendqisi2/0
+	andl	$136, %r11d	# 11318	[c=4 l=7]  *andsi_1/0
+	movl	%r8d, %r14d	# 16755	[c=4 l=3]  *movsi_internal/0
+	addl	%ebp, %r8d	# 11313	[c=4 l=3]  *addsi_1/0
+	movl	16(%rsp), %ebp	# 15638	[c=9 l=4]  *movsi_internal/0
+	andl	$136, %r14d	# 11321	[c=4 l=7]  *andsi_1/0
+	addl	%r8d, %ebp	# 11314	[c=4 l=3]  *addsi_1/0
+	leal	(%r14,%r11,2), %r8d	# 11322	[c=8 l=4]  *leasi
+	imull	$260, %r8d, %r8d	# 11323	[c=12 l=7]  *mulsi3_1/1
+	movb	%bpl, 1004(%rbx,%r10)	# 11316	[c=4 l=8]  *movqi_internal/8
+	andl	$7680, %r8d	# 11324	[c=4 l=7]  *andsi_1/0
+	orl	%ebp, %r8d	# 11325	[c=5 l=3]  *iorsi_1_zext
+	andl	$-64, %r9d	# 11327	[c=4 l=4]  *andsi_2/0
+	jne	.L1278	# 11328	[c=13 l=6]  *jcc
+	addq	%r8, %rcx	# 11332	[c=4 l=3]  *adddi_1/0
+	movl	$63, %eax	# 56	[c=4 l=5]  *movqi_internal/3
+.L1279:
+	salq	$4, %rsi	# 11351	[c=4 l=4]  *ashldi3_1/0
+	addl	$3, %edi	# 11353	[c=4 l=3]  *addsi_1/0
+	movq	%rcx, 104(%rbx)	# 11348	[c=4 l=4]  *movdi_internal/5
+	movb	%al, 100(%rbx)	# 11349	[c=4 l=3]  *movqi_internal/8
+	leaq	(%r15,%rsi), %rbp	# 15964	[c=4 l=4]  *leadi
+	movl	%edi, (%rbx)	# 11354	[c=4 l=2]  *movsi_internal/1
+	jmp	.L583	# 18175	[c=1 l=5]  jump
+.L1313:
+	movzbl	10(%rbp), %r14d	# 11778	[c=13 l=5]  zero_extendqidi2/0
+	movzwl	1032(%rbx), %ebp	# 11779	[c=13 l=7]  zero_extendhidi2/0
+	movl	%ebp, %edx	# 15654	[c=4 l=2]  *movsi_internal/0
+	movq	%rbp, %rax	# 16764	[c=4 l=3]  *movdi_internal/3
+	subl	5176(%rbx), %edx	# 11782	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %edx	# 11783	[c=13 l=6]  *cmpsi_1/1
+	jb	.L1314	# 11784	[c=13 l=2]  *jcc
+	movl	%ebp, %edx	# 15656	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %edx	# 11786	[c=4 l=3]  *ashrsi3_1/0
+	movslq	%edx, %rdx	# 11787	[c=4 l=3]  *extendsidi2_rex64/1
+	cmpb	$0, 1080(%rbx,%rdx)	# 11788	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L1315	# 11789	[c=13 l=6]  *jcc
+.L1314:
+	movq	1040(%rbx), %rdx	# 11793	[c=9 l=7]  *movdi_internal/3
+	movzbl	(%rdx,%rax), %eax	# 11794	[c=13 l=4]  *zero_extendqisi2/0
+.L1316:
+	cmpl	$15, %r14d	# 11808	[c=4 l=4]  *cmpsi_1/0
+	jle	.L1770	# 11809	[c=13 l=6]  *jcc
+	movb	%al, 1004(%rbx,%r14)	# 11822	[c=4 l=8]  *movqi_internal/8
+	leal	1(%rbp), %eax	# 15958	[c=4 l=3]  *leasi
+	subq	$1, 48(%rbx)	# 11823	[c=13 l=5]  *adddi_1/0
+	movw	%ax, 1032(%rbx)	# 11825	[c=4 l=7]  *movhi_internal/3
+	jmp	.L1550	# 18178	[c=1 l=5]  jump
+.L1323:
+	movl	992(%rbx), %eax	# 11898	[c=9 l=6]  *movsi_internal/0
+	movzwl	1034(%rbx), %edx	# 11897	[c=13 l=7]  *zero_extendhisi2/0
+	movq	1056(%rbx), %rsi	# 11903	[c=9 l=7]  *movdi_internal/3
+	movzbl	10(%rbp), %ecx	# 11896	[c=13 l=4]  zero_extendqidi2/0
+	leal	1(%rax,%rax), %eax	# 11900	[c=8 l=4]  *leasi
+	andl	%edx, %eax	# 11901	[c=4 l=2]  *andsi_1/0
+	cltq	# 11902	[c=4 l=2]  *extendsidi2_rex64/0
+	movzbl	(%rsi,%rax), %eax	# 11904	[c=9 l=4]  *movqi_internal/4
+	cmpl	$15, %ecx	# 11907	[c=4 l=3]  *cmpsi_1/0
+	jle	.L1771	# 11908	[c=13 l=6]  *jcc
+	addl	$1, %edx	# 11922	[c=4 l=3]  *addsi_1/0
+	movb	%al, 1004(%rbx,%rcx)	# 11921	[c=4 l=7]  *movqi_internal/8
+	movw	%dx, 1034(%rbx)	# 11923	[c=4 l=7]  *movhi_internal/3
+	jmp	.L1549	# 18181	[c=1 l=5]  jump
+.L1325:
+	movl	$59, %eax	# 11937	[c=4 l=5]  *movsi_internal/0
+	movzbl	10(%rbp), %ebp	# 11935	[c=13 l=4]  zero_extendqidi2/0
+	movzwl	1034(%rbx), %r14d	# 11936	[c=13 l=8]  *zero_extendhisi2/0
+	subl	5176(%rbx), %eax	# 11938	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %eax	# 11939	[c=13 l=6]  *cmpsi_1/1
+	jb	.L1326	# 11940	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%rbx)	# 11942	[c=13 l=7]  *cmpqi_ccno_1/1
+	jne	.L1327	# 11943	[c=13 l=6]  *jcc
+.L1326:
+	movq	1040(%rbx), %rax	# 11946	[c=9 l=7]  *movdi_internal/3
+	movzbl	59(%rax), %eax	# 11947	[c=13 l=4]  *zero_extendqisi2/0
+.L1328:
+	movl	992(%rbx), %edx	# 11960	[c=9 l=6]  *movsi_internal/0
+	sall	$16, %eax	# 11958	[c=4 l=3]  *ashlsi3_1/0
+	movq	1056(%rbx), %rcx	# 11965	[c=9 l=7]  *movdi_internal/3
+	orl	%r14d, %eax	# 11959	[c=4 l=3]  *iorsi_1/0
+	leal	1(%rdx,%rdx), %edx	# 11962	[c=8 l=4]  *leasi
+	andl	%eax, %edx	# 11963	[c=4 l=2]  *andsi_1/0
+	movslq	%edx, %rdx	# 11964	[c=4 l=3]  *extendsidi2_rex64/1
+	movzbl	(%rcx,%rdx), %edx	# 11966	[c=9 l=4]  *movqi_internal/4
+	cmpl	$15, %ebp	# 11969	[c=4 l=3]  *cmpsi_1/0
+	jle	.L1772	# 11970	[c=13 l=6]  *jcc
+	movb	%dl, 1004(%rbx,%rbp)	# 11983	[c=4 l=7]  *movqi_internal/8
+	leal	1(%rax), %edx	# 15956	[c=4 l=3]  *leasi
+	movl	$59, %eax	# 11987	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%rbx), %eax	# 11988	[c=13 l=6]  *subsi_1/1
+	movw	%dx, 1034(%rbx)	# 11985	[c=4 l=7]  *movhi_internal/3
+	sarl	$16, %edx	# 11986	[c=4 l=3]  *ashrsi3_1/0
+	cmpl	5180(%rbx), %eax	# 11989	[c=13 l=6]  *cmpsi_1/1
+	jb	.L1330	# 11990	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%rbx)	# 11992	[c=13 l=7]  *cmpqi_ccno_1/1
+	jne	.L1331	# 11993	[c=13 l=6]  *jcc
+.L1330:
+	movq	1040(%rbx), %rax	# 11996	[c=9 l=7]  *movdi_internal/3
+	movb	%dl, 59(%rax)	# 11997	[c=4 l=3]  *movqi_internal/8
+	jmp	.L1549	# 18184	[c=1 l=5]  jump
+.L1333:
+	movl	992(%rbx), %eax	# 12021	[c=9 l=6]  *movsi_internal/0
+	movzwl	1034(%rbx), %edx	# 12020	[c=13 l=7]  *zero_extendhisi2/0
+	movq	1056(%rbx), %rsi	# 12026	[c=9 l=7]  *movdi_internal/3
+	movzbl	10(%rbp), %ecx	# 12019	[c=13 l=4]  zero_extendqidi2/0
+	leal	1(%rax,%rax), %eax	# 12023	[c=8 l=4]  *leasi
+	andl	%edx, %eax	# 12024	[c=4 l=2]  *andsi_1/0
+	cltq	# 12025	[c=4 l=2]  *extendsidi2_rex64/0
+	movzbl	(%rsi,%rax), %eax	# 12027	[c=9 l=4]  *movqi_internal/4
+	cmpl	$15, %ecx	# 12030	[c=4 l=3]  *cmpsi_1/0
+	jle	.L1773	# 12031	[c=13 l=6]  *jcc
+	movb	%al, 1004(%rbx,%rcx)	# 12044	[c=4 l=7]  *movqi_internal/8
+	movl	(%rbx), %eax	# 12047	[c=6 l=2]  *zero_extendsidi2/3
+	addl	$1, %edx	# 12045	[c=4 l=3]  *addsi_1/0
+	movw	%dx, 1034(%rbx)	# 12046	[c=4 l=7]  *movhi_internal/3
+	movzwl	1030(%rbx), %ebp	# 12055	[c=13 l=7]  zero_extendhidi2/0
+	movq	%rax, %rdx	# 16770	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rax	# 12049	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %rax	# 12051	[c=13 l=7]  *adddi_1/1
+	addl	$1, %edx	# 12052	[c=4 l=3]  *addsi_1/0
+	movl	%edx, (%rbx)	# 12053	[c=4 l=2]  *movsi_internal/1
+	movzbl	10(%rax), %ecx	# 12054	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rbp, %rdx	# 16771	[c=4 l=3]  *movdi_internal/3
+	cmpl	$15, %ecx	# 12059	[c=4 l=3]  *cmpsi_1/0
+	jle	.L1774	# 12060	[c=13 l=6]  *jcc
+	movl	%ebp, %eax	# 15662	[c=4 l=2]  *movsi_internal/0
+	movzbl	1004(%rbx,%rcx), %ecx	# 12073	[c=10 l=8]  *movqi_internal/4
+	subl	5176(%rbx), %eax	# 12075	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %eax	# 12076	[c=13 l=6]  *cmpsi_1/1
+	jb	.L1336	# 12077	[c=13 l=2]  *jcc
+	movl	%ebp, %eax	# 15664	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %eax	# 12079	[c=4 l=3]  *ashrsi3_1/0
+	cltq	# 12080	[c=4 l=2]  *extendsidi2_rex64/0
+	cmpb	$0, 1080(%rbx,%rax)	# 12081	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L1337	# 12082	[c=13 l=6]  *jcc
+.L1336:
+	movq	1040(%rbx), %rax	# 12086	[c=9 l=7]  *movdi_internal/3
+	movb	%cl, (%rax,%rdx)	# 12087	[c=4 l=3]  *movqi_internal/8
+.L1338:
+	leal	1(%rbp), %eax	# 15954	[c=4 l=3]  *leasi
+	movq	1064(%rbx), %rbp	# 12102	[c=9 l=7]  *movdi_internal/3
+	subq	$1, 48(%rbx)	# 12099	[c=13 l=5]  *adddi_1/0
+	movw	%ax, 1030(%rbx)	# 12101	[c=4 l=7]  *movhi_internal/3
+	movl	(%rbx), %eax	# 12103	[c=6 l=2]  *zero_extendsidi2/3
+	movq	%rax, %rcx	# 16772	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rax	# 12105	[c=4 l=4]  *ashldi3_1/0
+	addq	%rbp, %rax	# 12106	[c=4 l=3]  *adddi_1/0
+	leal	1(%rcx), %edx	# 15955	[c=5 l=3]  *leadi
+	movzwl	12(%rax), %edi	# 12109	[c=13 l=4]  *zero_extendhisi2/0
+	movl	%edx, (%rbx)	# 12108	[c=4 l=2]  *movsi_internal/1
+	movzbl	10(%rax), %eax	# 12111	[c=13 l=4]  zero_extendqidi2/0
+	movl	%edi, %esi	# 16773	[c=4 l=2]  *movsi_internal/0
+	cmpl	$15, %eax	# 12114	[c=4 l=3]  *cmpsi_1/0
+	jle	.L1775	# 12115	[c=13 l=6]  *jcc
+.L1354:
+	movzbl	1004(%rbx,%rax), %eax	# 12331	[c=14 l=8]  *zero_extendqisi2/0
+	andl	$136, %esi	# 12336	[c=4 l=6]  *andsi_1/0
+	movl	%eax, %r8d	# 15674	[c=4 l=3]  *movsi_internal/0
+	subl	%edi, %eax	# 12339	[c=4 l=2]  *subsi_1/0
+	andl	$136, %r8d	# 12333	[c=4 l=7]  *andsi_1/0
+	andl	$511, %eax	# 12340	[c=4 l=5]  *andsi_1/0
+	leal	(%rsi,%r8,2), %esi	# 12337	[c=8 l=4]  *leasi
+	imull	$260, %esi, %esi	# 12341	[c=12 l=6]  *mulsi3_1/1
+	andl	$7680, %esi	# 12342	[c=4 l=6]  *andsi_1/0
+	orl	%esi, %eax	# 12343	[c=5 l=2]  *iorsi_1_zext
+	movzbl	100(%rbx), %esi	# 12344	[c=9 l=4]  *movqi_internal/4
+	movl	%esi, %edi	# 15676	[c=4 l=2]  *movsi_internal/0
+	andl	$192, %edi	# 12347	[c=4 l=6]  *andsi_2/0
+	jne	.L1355	# 12348	[c=13 l=6]  *jcc
+	leaq	flag_update_table_sub8(%rip), %rsi	# 12351	[c=1 l=7]  *movdi_internal/4
+	addq	%rsi, %rax	# 12352	[c=4 l=3]  *adddi_1/0
+	movl	$63, %esi	# 58	[c=4 l=5]  *movqi_internal/3
+.L1356:
+	salq	$4, %rdx	# 12372	[c=4 l=4]  *ashldi3_1/0
+	addl	$2, %ecx	# 12374	[c=4 l=3]  *addsi_1/0
+	movq	%rax, 104(%rbx)	# 12369	[c=4 l=4]  *movdi_internal/5
+	movb	%sil, 100(%rbx)	# 12370	[c=4 l=4]  *movqi_internal/8
+	addq	%rdx, %rbp	# 12373	[c=4 l=3]  *adddi_1/0
+	movl	%ecx, (%rbx)	# 12375	[c=4 l=2]  *movsi_internal/1
+	jmp	.L662	# 18189	[c=1 l=5]  jump
+.L1342:
+	movl	$59, %eax	# 12179	[c=4 l=5]  *movsi_internal/0
+	movzbl	10(%rbp), %ebp	# 12177	[c=13 l=4]  zero_extendqidi2/0
+	movzwl	1034(%rbx), %r14d	# 12178	[c=13 l=8]  *zero_extendhisi2/0
+	subl	5176(%rbx), %eax	# 12180	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %eax	# 12181	[c=13 l=6]  *cmpsi_1/1
+	jb	.L1343	# 12182	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%rbx)	# 12184	[c=13 l=7]  *cmpqi_ccno_1/1
+	jne	.L1344	# 12185	[c=13 l=6]  *jcc
+.L1343:
+	movq	1040(%rbx), %rax	# 12188	[c=9 l=7]  *movdi_internal/3
+	movzbl	59(%rax), %eax	# 12189	[c=13 l=4]  *zero_extendqisi2/0
+.L1345:
+	movl	992(%rbx), %edx	# 12202	[c=9 l=6]  *movsi_internal/0
+	sall	$16, %eax	# 12200	[c=4 l=3]  *ashlsi3_1/0
+	movq	1056(%rbx), %rcx	# 12207	[c=9 l=7]  *movdi_internal/3
+	orl	%r14d, %eax	# 12201	[c=4 l=3]  *iorsi_1/0
+	leal	1(%rdx,%rdx), %edx	# 12204	[c=8 l=4]  *leasi
+	andl	%eax, %edx	# 12205	[c=4 l=2]  *andsi_1/0
+	movslq	%edx, %rdx	# 12206	[c=4 l=3]  *extendsidi2_rex64/1
+	movzbl	(%rcx,%rdx), %edx	# 12208	[c=9 l=4]  *movqi_internal/4
+	cmpl	$15, %ebp	# 12211	[c=4 l=3]  *cmpsi_1/0
+	jle	.L1776	# 12212	[c=13 l=6]  *jcc
+	movb	%dl, 1004(%rbx,%rbp)	# 12225	[c=4 l=7]  *movqi_internal/8
+	leal	1(%rax), %edx	# 15951	[c=4 l=3]  *leasi
+	movl	$59, %eax	# 12229	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%rbx), %eax	# 12230	[c=13 l=6]  *subsi_1/1
+	movw	%dx, 1034(%rbx)	# 12227	[c=4 l=7]  *movhi_internal/3
+	sarl	$16, %edx	# 12228	[c=4 l=3]  *ashrsi3_1/0
+	cmpl	5180(%rbx), %eax	# 12231	[c=13 l=6]  *cmpsi_1/1
+	jb	.L1347	# 12232	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%rbx)	# 12234	[c=13 l=7]  *cmpqi_ccno_1/1
+	jne	.L1348	# 12235	[c=13 l=6]  *jcc
+.L1347:
+	movq	1040(%rbx), %rax	# 12238	[c=9 l=7]  *movdi_internal/3
+	movb	%dl, 59(%rax)	# 12239	[c=4 l=3]  *movqi_internal/8
+.L1349:
+	movl	(%rbx), %eax	# 12250	[c=6 l=2]  *zero_extendsidi2/3
+	movzwl	1030(%rbx), %ebp	# 12258	[c=13 l=7]  zero_extendhidi2/0
+	movq	%rax, %rdx	# 16774	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rax	# 12252	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %rax	# 12254	[c=13 l=7]  *adddi_1/1
+	addl	$1, %edx	# 12255	[c=4 l=3]  *addsi_1/0
+	movl	%edx, (%rbx)	# 12256	[c=4 l=2]  *movsi_internal/1
+	movzbl	10(%rax), %ecx	# 12257	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rbp, %rdx	# 16775	[c=4 l=3]  *movdi_internal/3
+	cmpl	$15, %ecx	# 12262	[c=4 l=3]  *cmpsi_1/0
+	jle	.L1777	# 12263	[c=13 l=6]  *jcc
+	movl	%ebp, %eax	# 15670	[c=4 l=2]  *movsi_internal/0
+	movzbl	1004(%rbx,%rcx), %ecx	# 12276	[c=10 l=8]  *movqi_internal/4
+	subl	5176(%rbx), %eax	# 12278	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %eax	# 12279	[c=13 l=6]  *cmpsi_1/1
+	jb	.L1351	# 12280	[c=13 l=2]  *jcc
+	movl	%ebp, %eax	# 15672	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %eax	# 12282	[c=4 l=3]  *ashrsi3_1/0
+	cltq	# 12283	[c=4 l=2]  *extendsidi2_rex64/0
+	cmpb	$0, 1080(%rbx,%rax)	# 12284	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L1352	# 12285	[c=13 l=6]  *jcc
+.L1351:
+	movq	1040(%rbx), %rax	# 12289	[c=9 l=7]  *movdi_internal/3
+	movb	%cl, (%rax,%rdx)	# 12290	[c=4 l=3]  *movqi_internal/8
+.L1353:
+	leal	1(%rbp), %eax	# 15949	[c=4 l=3]  *leasi
+	movq	1064(%rbx), %rbp	# 12305	[c=9 l=7]  *movdi_internal/3
+	subq	$1, 48(%rbx)	# 12302	[c=13 l=5]  *adddi_1/0
+	movw	%ax, 1030(%rbx)	# 12304	[c=4 l=7]  *movhi_internal/3
+	movl	(%rbx), %eax	# 12306	[c=6 l=2]  *zero_extendsidi2/3
+	movq	%rax, %rcx	# 16776	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rax	# 12308	[c=4 l=4]  *ashldi3_1/0
+	addq	%rbp, %rax	# 12309	[c=4 l=3]  *adddi_1/0
+	leal	1(%rcx), %edx	# 15950	[c=5 l=3]  *leadi
+	movzwl	12(%rax), %edi	# 12312	[c=13 l=4]  *zero_extendhisi2/0
+	movl	%edx, (%rbx)	# 12311	[c=4 l=2]  *movsi_internal/1
+	movzbl	10(%rax), %eax	# 12314	[c=13 l=4]  zero_extendqidi2/0
+	movl	%edi, %esi	# 16777	[c=4 l=2]  *movsi_internal/0
+	cmpl	$15, %eax	# 12317	[c=4 l=3]  *cmpsi_1/0
+	jg	.L1354	# 12318	[c=13 l=6]  *jcc
+	movl	%eax, %ecx	# 12320	[c=4 l=2]  *movsi_internal/0
+	leaq	.LC52(%rip), %rdx	# 12321	[c=1 l=7]  *movdi_internal/4
+	movq	%rbx, %rdi	# 12324	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 17576	[c=4 l=2]  *movdi_xor
+	movl	$1, %esi	# 12323	[c=4 l=5]  *movsi_internal/0
+	call	leave	# 12326	[c=0 l=5]  *call
+.L542:
+	movl	(%rbx), %eax	# 8443	[c=6 l=2]  *zero_extendsidi2/3
+	leaq	opcodes(%rip), %rsi	# 14847	[c=1 l=7]  *movdi_internal/4
+	leaq	handler.2(%rip), %r14	# 8463	[c=1 l=7]  *movdi_internal/4
+	salq	$4, %rax	# 8444	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %rax	# 8446	[c=13 l=7]  *adddi_1/1
+	movzbl	11(%rax), %edx	# 8448	[c=13 l=4]  zero_extendqidi2/0
+	movzwl	14(%rax), %eax	# 8459	[c=13 l=4]  *zero_extendhisi2/0
+	leaq	1(%r12,%rdx), %r12	# 8450	[c=5 l=5]  *leadi
+	movq	%r12, 40(%rbx)	# 8451	[c=4 l=4]  *movdi_internal/5
+	movzbl	8(%rbp), %ecx	# 8454	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rcx, %rdx	# 15401	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 8455	[c=4 l=4]  *ashldi3_1/0
+	movswl	10(%rsi,%rdx), %edx	# 8458	[c=14 l=5]  extendhisi2/1
+	addl	%edx, %eax	# 8460	[c=4 l=2]  *addsi_1/0
+	cltq	# 8461	[c=4 l=2]  *extendsidi2_rex64/0
+	addq	%rax, 48(%rbx)	# 8462	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r14,%rcx,8)	# 17691	[c=10 l=4]  *indirect_jump
+.L1156:
+	movzwl	12(%rbp), %esi	# 8588	[c=13 l=4]  *zero_extendhisi2/0
+	movzbl	10(%rbp), %ecx	# 8590	[c=13 l=4]  zero_extendqidi2/0
+	movl	%esi, %edx	# 16685	[c=4 l=2]  *movsi_internal/0
+	cmpl	$15, %ecx	# 8593	[c=4 l=3]  *cmpsi_1/0
+	jle	.L1778	# 8594	[c=13 l=6]  *jcc
+	movzbl	1004(%rbx,%rcx), %eax	# 8607	[c=14 l=8]  *zero_extendqisi2/0
+	andl	$136, %edx	# 8612	[c=4 l=6]  *andsi_1/0
+	movl	%eax, %ecx	# 15407	[c=4 l=2]  *movsi_internal/0
+	subl	%esi, %eax	# 8615	[c=4 l=2]  *subsi_1/0
+	andl	$136, %ecx	# 8609	[c=4 l=6]  *andsi_1/0
+	leal	(%rdx,%rcx,2), %edx	# 8613	[c=8 l=3]  *leasi
+	jmp	.L1555	# 18194	[c=1 l=5]  jump
+.L1160:
+	movzbl	10(%rbp), %eax	# 8659	[c=13 l=4]  zero_extendqidi2/0
+	movzwl	12(%rbp), %ecx	# 8658	[c=13 l=4]  zero_extendhidi2/0
+	cmpl	$15, %eax	# 8662	[c=4 l=3]  *cmpsi_1/0
+	jle	.L1779	# 8663	[c=13 l=6]  *jcc
+	movzbl	1004(%rbx,%rax), %eax	# 8676	[c=14 l=8]  *zero_extendqisi2/0
+	movl	%eax, %edi	# 16687	[c=4 l=2]  *movsi_internal/0
+	cmpl	$15, %ecx	# 8680	[c=4 l=3]  *cmpsi_1/0
+	jle	.L1780	# 8681	[c=13 l=6]  *jcc
+	movq	104(%rbx), %rdx	# 8697	[c=9 l=4]  *movdi_internal/3
+	movzbl	100(%rbx), %r9d	# 8695	[c=13 l=5]  *zero_extendqisi2/0
+	andl	$136, %edi	# 8707	[c=4 l=6]  *andsi_1/0
+	movzbl	1004(%rbx,%rcx), %r8d	# 8694	[c=14 l=9]  *zero_extendqisi2/0
+	movzbl	(%rdx), %esi	# 8698	[c=5 l=3]  *movqi_internal/4
+	movq	1040(%rbx), %rdx	# 8699	[c=9 l=7]  *movdi_internal/3
+	movl	%r9d, %ecx	# 16688	[c=4 l=3]  *movsi_internal/0
+	movl	%r9d, %r10d	# 15411	[c=4 l=3]  *movsi_internal/0
+	notl	%r10d	# 8701	[c=4 l=3]  *one_cmplsi2_1/0
+	subl	%r8d, %eax	# 8716	[c=4 l=3]  *subsi_1/0
+	movzbl	63(%rdx), %edx	# 8700	[c=13 l=4]  *zero_extendqisi2/0
+	andl	%esi, %ecx	# 16090	[c=4 l=2]  *andsi_1/0
+	movzbl	%cl, %ecx	# 8704	[c=4 l=3]  *zero_extendqisi2/0
+	andl	%r10d, %edx	# 8702	[c=4 l=3]  *andsi_1/0
+	orl	%ecx, %edx	# 8705	[c=4 l=2]  *iorsi_1/0
+	movl	%r8d, %ecx	# 15413	[c=4 l=3]  *movsi_internal/0
+	andl	$136, %ecx	# 8710	[c=4 l=6]  *andsi_1/0
+	movl	%edx, %r8d	# 15417	[c=4 l=3]  *movsi_internal/0
+	orl	$-3, %edx	# 8725	[c=4 l=3]  *iorsi_1/0
+	leal	(%rcx,%rdi,2), %edi	# 8711	[c=8 l=3]  *leasi
+	andl	$1, %r8d	# 8717	[c=4 l=4]  *andsi_1/0
+	movl	%r9d, %ecx	# 15415	[c=4 l=3]  *movsi_internal/0
+	imull	$260, %edi, %edi	# 8720	[c=12 l=6]  *mulsi3_1/1
+	subl	%r8d, %eax	# 8718	[c=4 l=3]  *subsi_1/0
+	andl	$-64, %ecx	# 8712	[c=4 l=3]  *andsi_1/0
+	andl	$511, %eax	# 8719	[c=4 l=5]  *andsi_1/0
+	andl	%ecx, %esi	# 16091	[c=4 l=2]  *andsi_1/0
+	orl	$63, %ecx	# 16093	[c=4 l=3]  *iorsi_1/0
+	movb	%cl, 100(%rbx)	# 8731	[c=4 l=3]  *movqi_internal/8
+	andl	$7680, %edi	# 8721	[c=4 l=6]  *andsi_1/0
+	orl	%edi, %eax	# 8722	[c=5 l=2]  *iorsi_1_zext
+	leaq	flag_update_table_sub8(%rip), %rdi	# 14850	[c=1 l=7]  *movdi_internal/4
+	andb	(%rdi,%rax), %dl	# 8726	[c=13 l=3]  *andqi_1/1
+	movl	%edx, %eax	# 15420	[c=4 l=2]  *movqi_internal/0
+	orl	%esi, %eax	# 16092	[c=4 l=2]  *iorsi_1/0
+	movb	%al, 101(%rbx)	# 8729	[c=4 l=3]  *movqi_internal/8
+	leaq	101(%rbx), %rax	# 16094	[c=4 l=4]  *leadi
+	movq	%rax, 104(%rbx)	# 8733	[c=4 l=4]  *movdi_internal/5
+	jmp	.L1547	# 18198	[c=1 l=5]  jump
+.L1163:
+	movzbl	10(%rbp), %eax	# 8746	[c=13 l=4]  zero_extendqidi2/0
+	movzwl	12(%rbp), %ecx	# 8745	[c=13 l=4]  zero_extendhidi2/0
+	cmpl	$15, %eax	# 8749	[c=4 l=3]  *cmpsi_1/0
+	jle	.L1781	# 8750	[c=13 l=6]  *jcc
+	movzbl	1004(%rbx,%rax), %eax	# 8763	[c=14 l=8]  *zero_extendqisi2/0
+	movl	%eax, %edx	# 16690	[c=4 l=2]  *movsi_internal/0
+	cmpl	$15, %ecx	# 8767	[c=4 l=3]  *cmpsi_1/0
+	jle	.L1782	# 8768	[c=13 l=6]  *jcc
+	movzbl	1004(%rbx,%rcx), %ecx	# 8781	[c=14 l=8]  *zero_extendqisi2/0
+	andl	$136, %edx	# 8783	[c=4 l=6]  *andsi_1/0
+	movl	%ecx, %esi	# 15421	[c=4 l=2]  *movsi_internal/0
+	subl	%ecx, %eax	# 8789	[c=4 l=2]  *subsi_1/0
+	andl	$136, %esi	# 8786	[c=4 l=6]  *andsi_1/0
+	andl	$511, %eax	# 8790	[c=4 l=5]  *andsi_1/0
+	leal	(%rsi,%rdx,2), %edx	# 8787	[c=8 l=3]  *leasi
+	imull	$260, %edx, %edx	# 8791	[c=12 l=6]  *mulsi3_1/1
+	andl	$7680, %edx	# 8792	[c=4 l=6]  *andsi_1/0
+	jmp	.L1558	# 18202	[c=1 l=5]  jump
+.L1168:
+	movzbl	10(%rbp), %eax	# 8833	[c=13 l=4]  zero_extendqidi2/0
+	movzwl	12(%rbp), %ecx	# 8832	[c=13 l=4]  zero_extendhidi2/0
+	cmpl	$15, %eax	# 8836	[c=4 l=3]  *cmpsi_1/0
+	jle	.L1783	# 8837	[c=13 l=6]  *jcc
+	movzbl	1004(%rbx,%rax), %eax	# 8850	[c=14 l=8]  *zero_extendqisi2/0
+	movl	%eax, %edx	# 16692	[c=4 l=2]  *movsi_internal/0
+	cmpl	$15, %ecx	# 8854	[c=4 l=3]  *cmpsi_1/0
+	jle	.L1784	# 8855	[c=13 l=6]  *jcc
+	movzbl	1004(%rbx,%rcx), %ecx	# 8868	[c=14 l=8]  *zero_extendqisi2/0
+	andl	$136, %edx	# 8870	[c=4 l=6]  *andsi_1/0
+	movl	%ecx, %esi	# 15425	[c=4 l=2]  *movsi_internal/0
+	subl	%ecx, %eax	# 8876	[c=4 l=2]  *subsi_1/0
+	andl	$136, %esi	# 8873	[c=4 l=6]  *andsi_1/0
+	leal	(%rsi,%rdx,2), %edx	# 8874	[c=8 l=3]  *leasi
+.L1561:
+	imull	$260, %edx, %edx	# 9192	[c=12 l=6]  *mulsi3_1/1
+	andl	$511, %eax	# 9191	[c=4 l=5]  *andsi_1/0
+	andl	$7680, %edx	# 9193	[c=4 l=6]  *andsi_1/0
+	orl	%edx, %eax	# 9194	[c=5 l=2]  *iorsi_1_zext
+	movzbl	100(%rbx), %edx	# 9195	[c=9 l=4]  *movqi_internal/4
+	movl	%edx, %ecx	# 15455	[c=4 l=2]  *movsi_internal/0
+	andl	$192, %ecx	# 9198	[c=4 l=6]  *andsi_2/0
+	jne	.L1185	# 9199	[c=13 l=6]  *jcc
+	leaq	flag_update_table_sub8(%rip), %rdx	# 9202	[c=1 l=7]  *movdi_internal/4
+	addq	%rdx, %rax	# 9203	[c=4 l=3]  *adddi_1/0
+	movl	$63, %edx	# 39	[c=4 l=5]  *movqi_internal/3
+.L1194:
+	movq	%rax, 104(%rbx)	# 9334	[c=4 l=4]  *movdi_internal/5
+	movb	%dl, 100(%rbx)	# 9335	[c=4 l=3]  *movqi_internal/8
+	jmp	.L1544	# 18206	[c=1 l=5]  jump
+.L1173:
+	movzbl	10(%rbp), %eax	# 8920	[c=13 l=4]  zero_extendqidi2/0
+	movzwl	12(%rbp), %ecx	# 8919	[c=13 l=4]  zero_extendhidi2/0
+	cmpl	$15, %eax	# 8923	[c=4 l=3]  *cmpsi_1/0
+	jle	.L1785	# 8924	[c=13 l=6]  *jcc
+	movzbl	1004(%rbx,%rax), %eax	# 8937	[c=14 l=8]  *zero_extendqisi2/0
+	movl	%eax, %edi	# 16694	[c=4 l=2]  *movsi_internal/0
+	cmpl	$15, %ecx	# 8941	[c=4 l=3]  *cmpsi_1/0
+	jle	.L1786	# 8942	[c=13 l=6]  *jcc
+	movq	104(%rbx), %rdx	# 8958	[c=9 l=4]  *movdi_internal/3
+	movzbl	100(%rbx), %r9d	# 8956	[c=13 l=5]  *zero_extendqisi2/0
+	andl	$136, %edi	# 8968	[c=4 l=6]  *andsi_1/0
+	movzbl	1004(%rbx,%rcx), %r8d	# 8955	[c=14 l=9]  *zero_extendqisi2/0
+	movzbl	(%rdx), %esi	# 8959	[c=5 l=3]  *movqi_internal/4
+	movq	1040(%rbx), %rdx	# 8960	[c=9 l=7]  *movdi_internal/3
+	movl	%r9d, %ecx	# 16695	[c=4 l=3]  *movsi_internal/0
+	movl	%r9d, %r10d	# 15429	[c=4 l=3]  *movsi_internal/0
+	notl	%r10d	# 8962	[c=4 l=3]  *one_cmplsi2_1/0
+	subl	%r8d, %eax	# 8977	[c=4 l=3]  *subsi_1/0
+	movzbl	63(%rdx), %edx	# 8961	[c=13 l=4]  *zero_extendqisi2/0
+	andl	%esi, %ecx	# 16081	[c=4 l=2]  *andsi_1/0
+	movzbl	%cl, %ecx	# 8965	[c=4 l=3]  *zero_extendqisi2/0
+	andl	%r10d, %edx	# 8963	[c=4 l=3]  *andsi_1/0
+	orl	%ecx, %edx	# 8966	[c=4 l=2]  *iorsi_1/0
+	movl	%r8d, %ecx	# 15431	[c=4 l=3]  *movsi_internal/0
+	andl	$136, %ecx	# 8971	[c=4 l=6]  *andsi_1/0
+	movl	%edx, %r8d	# 15435	[c=4 l=3]  *movsi_internal/0
+	orl	$-3, %edx	# 8986	[c=4 l=3]  *iorsi_1/0
+	leal	(%rcx,%rdi,2), %edi	# 8972	[c=8 l=3]  *leasi
+	andl	$1, %r8d	# 8978	[c=4 l=4]  *andsi_1/0
+	movl	%r9d, %ecx	# 15433	[c=4 l=3]  *movsi_internal/0
+	imull	$260, %edi, %edi	# 8981	[c=12 l=6]  *mulsi3_1/1
+	subl	%r8d, %eax	# 8979	[c=4 l=3]  *subsi_1/0
+	andl	$-64, %ecx	# 8973	[c=4 l=3]  *andsi_1/0
+	andl	$511, %eax	# 8980	[c=4 l=5]  *andsi_1/0
+	andl	$7680, %edi	# 8982	[c=4 l=6]  *andsi_1/0
+	orl	%edi, %eax	# 8983	[c=5 l=2]  *iorsi_1_zext
+	leaq	flag_update_table_sub8(%rip), %rdi	# 14853	[c=1 l=7]  *movdi_internal/4
+	andb	(%rdi,%rax), %dl	# 8987	[c=13 l=3]  *andqi_1/1
+	movl	%edx, %eax	# 15438	[c=4 l=2]  *movqi_internal/0
+	jmp	.L1543	# 18210	[c=1 l=5]  jump
+.L547:
+	movq	%rbp, %r14	# 15706	[c=4 l=3]  *movdi_internal/3
+	subq	1064(%rbx), %r14	# 12710	[c=13 l=7]  *subdi_1/1
+	movq	%rbx, %rdi	# 12715	[c=4 l=3]  *movdi_internal/3
+	sarq	$4, %r14	# 12711	[c=4 l=4]  *ashrdi3_1/0
+	movl	%r14d, %esi	# 12714	[c=4 l=3]  *movsi_internal/0
+	movl	%r14d, %r15d	# 12713	[c=4 l=3]  *movsi_internal/0
+	call	jit_hot@PLT	# 12716	[c=10 l=5]  *call_value
+	testb	%al, %al	# 12718	[c=4 l=2]  *cmpqi_ccno_1/0
+	jne	.L1378	# 12719	[c=13 l=6]  *jcc
+	movzbl	8(%rbp), %eax	# 12723	[c=13 l=4]  zero_extendqidi2/0
+	leaq	handler.2(%rip), %r14	# 12721	[c=1 l=7]  *movdi_internal/4
+	jmp	*(%r14,%rax,8)	# 17560	[c=10 l=4]  *indirect_jump
+.L532:
+	movzbl	100(%rbx), %eax	# 12758	[c=9 l=4]  *movqi_internal/4
+	testb	%al, %al	# 12759	[c=4 l=2]  *cmpqi_ccno_1/0
+	je	.L1380	# 12760	[c=13 l=2]  *jcc
+	movq	1040(%rbx), %rsi	# 12762	[c=9 l=7]  *movdi_internal/3
+	movzbl	%al, %ecx	# 12764	[c=4 l=3]  *zero_extendqisi2/0
+	notl	%ecx	# 12765	[c=4 l=2]  *one_cmplsi2_1/0
+	movzbl	63(%rsi), %edx	# 12763	[c=13 l=4]  *zero_extendqisi2/0
+	andl	%ecx, %edx	# 12766	[c=4 l=2]  *andsi_1/0
+	movq	104(%rbx), %rcx	# 12767	[c=9 l=4]  *movdi_internal/3
+	andb	(%rcx), %al	# 12768	[c=9 l=2]  *andqi_1/1
+	movzbl	%al, %eax	# 12769	[c=4 l=3]  *zero_extendqisi2/0
+	orl	%edx, %eax	# 12770	[c=4 l=2]  *iorsi_1/0
+	movb	%al, 63(%rsi)	# 12771	[c=4 l=3]  *movqi_internal/8
+	movb	$0, 100(%rbx)	# 12772	[c=4 l=4]  *movqi_internal/8
+.L1380:
+	movq	1040(%rbx), %rax	# 15710	[c=9 l=7]  *movdi_internal/3
+	subq	1064(%rbx), %rbp	# 12780	[c=13 l=7]  *subdi_1/1
+	leaq	8(%rbx), %rdx	# 15922	[c=4 l=4]  *leadi
+	leaq	1004(%rbx), %rdi	# 15924	[c=4 l=7]  *leadi
+	sarq	$4, %rbp	# 12781	[c=4 l=4]  *ashrdi3_1/0
+	leaq	63(%rax), %rsi	# 15923	[c=4 l=4]  *leadi
+	movq	10960(%rbx), %rax	# 12779	[c=9 l=7]  *movdi_internal/3
+	movq	8(%rax), %rax	# 12782	[c=9 l=4]  *movdi_internal/3
+	call	*(%rax,%rbp,8)	# 12787	[c=19 l=3]  *call_value
+	movq	40(%rbx), %r14	# 12790	[c=9 l=4]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 12789	[c=4 l=2]  *movsi_internal/1
+	testq	%r13, %r13	# 12793	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L1446	# 12794	[c=13 l=2]  *jcc
+	cmpq	%r13, %r14	# 12797	[c=4 l=3]  *cmpdi_1/0
+	jnb	.L612	# 12798	[c=13 l=6]  *jcc
+.L1446:
+	movq	56(%rbx), %rax	# 15711	[c=9 l=4]  *movdi_internal/3
+	cmpq	%rax, 48(%rbx)	# 12802	[c=13 l=4]  *cmpdi_1/0
+	jnb	.L1787	# 12803	[c=13 l=6]  *jcc
+.L1382:
+	movl	(%rbx), %ebp	# 12810	[c=6 l=2]  *zero_extendsidi2/3
+	movl	$1, 96(%rbx)	# 12815	[c=4 l=7]  *movsi_internal/1
+	movq	%rbp, %rdx	# 16782	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbp	# 12812	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %rbp	# 12814	[c=13 l=7]  *adddi_1/1
+	movzbl	11(%rbp), %r12d	# 12816	[c=13 l=5]  zero_extendqidi2/0
+	movzwl	14(%rbp), %eax	# 12819	[c=13 l=4]  zero_extendhidi2/0
+	addq	%rax, 48(%rbx)	# 12820	[c=13 l=4]  *adddi_1/0
+	addq	%r14, %r12	# 12817	[c=4 l=3]  *adddi_1/0
+	movq	%r12, 40(%rbx)	# 12818	[c=4 l=4]  *movdi_internal/5
+	movzbl	9(%rbp), %eax	# 12821	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%edx, %eax	# 12822	[c=4 l=2]  *addsi_1/0
+	movl	%eax, (%rbx)	# 12823	[c=4 l=2]  *movsi_internal/1
+	jmp	*0(%rbp)	# 17557	[c=5 l=3]  *indirect_jump
+.L557:
+	movq	%rbp, %rsi	# 15712	[c=4 l=3]  *movdi_internal/3
+	subq	1064(%rbx), %rsi	# 12829	[c=13 l=7]  *subdi_1/1
+	movq	%rbx, %rdi	# 12833	[c=4 l=3]  *movdi_internal/3
+	sarq	$4, %rsi	# 12830	[c=4 l=4]  *ashrdi3_1/0
+	leaq	1004(%rbx), %r15	# 15921	[c=4 l=7]  *leadi
+	call	hle_routine@PLT	# 12834	[c=10 l=5]  *call_value
+	movq	1040(%rbx), %rdx	# 12839	[c=9 l=7]  *movdi_internal/3
+	movzbl	100(%rbx), %ecx	# 12841	[c=13 l=4]  *zero_extendqisi2/0
+	movq	%rbx, 112(%rsp)	# 12836	[c=4 l=5]  *movdi_internal/5
+	movq	%rax, %r14	# 12835	[c=4 l=3]  *movdi_internal/3
+	movq	%r15, 120(%rsp)	# 12838	[c=4 l=5]  *movdi_internal/5
+	movq	%rdx, 128(%rsp)	# 12840	[c=4 l=8]  *movdi_internal/5
+	movzbl	63(%rdx), %edx	# 12842	[c=13 l=4]  *zero_extendqisi2/0
+	movl	%ecx, %eax	# 16783	[c=4 l=2]  *movsi_internal/0
+	notl	%ecx	# 12844	[c=4 l=2]  *one_cmplsi2_1/0
+	andl	%ecx, %edx	# 12845	[c=4 l=2]  *andsi_1/0
+	movq	104(%rbx), %rcx	# 12846	[c=9 l=4]  *movdi_internal/3
+	andb	(%rcx), %al	# 12847	[c=9 l=2]  *andqi_1/1
+	xorl	%ecx, %ecx	# 17555	[c=4 l=2]  *movdi_xor
+	movl	$-1, 152(%rsp)	# 12855	[c=4 l=11]  *movsi_internal/1
+	movzbl	%al, %eax	# 12848	[c=4 l=3]  *zero_extendqisi2/0
+	movq	%rcx, 140(%rsp)	# 17556	[c=4 l=8]  *movdi_internal/5
+	orl	%edx, %eax	# 12849	[c=4 l=2]  *iorsi_1/0
+	movb	%al, 136(%rsp)	# 12850	[c=4 l=7]  *movqi_internal/8
+	movq	%rbp, %rax	# 15714	[c=4 l=3]  *movdi_internal/3
+	subq	1064(%rbx), %rax	# 12852	[c=13 l=7]  *subdi_1/1
+	sarq	$4, %rax	# 12853	[c=4 l=4]  *ashrdi3_1/0
+	movl	%eax, 148(%rsp)	# 12854	[c=4 l=7]  *movsi_internal/1
+	movq	10976(%rbx), %rax	# 12856	[c=9 l=7]  *movdi_internal/3
+	testq	%rax, %rax	# 12857	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L1383	# 12858	[c=13 l=6]  *jcc
+	cmpq	$0, (%rax)	# 12860	[c=9 l=4]  *cmpdi_ccno_1/1
+	je	.L1383	# 12861	[c=13 l=6]  *jcc
+.L1384:
+	jmp	*40(%r14)	# 17554	[c=9 l=4]  *indirect_jump
+.L1423:
+	movl	5176(%rbx), %edx	# 13374	[c=9 l=6]  *movsi_internal/0
+	movq	10976(%rbx), %rcx	# 13372	[c=9 l=7]  *movdi_internal/3
+	movl	$61, %eax	# 13376	[c=4 l=5]  *movsi_internal/0
+	movl	5180(%rbx), %r15d	# 13375	[c=9 l=7]  *movsi_internal/0
+	subl	%edx, %eax	# 13377	[c=4 l=2]  *subsi_1/0
+	movq	16(%rcx), %r10	# 13373	[c=9 l=4]  *movdi_internal/3
+	cmpl	%r15d, %eax	# 13378	[c=4 l=3]  *cmpsi_1/0
+	jb	.L1424	# 13379	[c=13 l=6]  *jcc
+	cmpb	$1, 1081(%rbx)	# 13383	[c=13 l=7]  *cmpqi_1/0
+	ja	.L1788	# 13384	[c=13 l=6]  *jcc
+	movq	1040(%rbx), %rax	# 13620	[c=9 l=7]  *movdi_internal/3
+	movzbl	61(%rax), %r14d	# 13621	[c=13 l=5]  *zero_extendqisi2/0
+.L1426:
+	movzbl	62(%rax), %eax	# 13421	[c=13 l=4]  *zero_extendqisi2/0
+.L1428:
+	sall	$8, %eax	# 13424	[c=4 l=3]  *ashlsi3_1/0
+	orl	%r14d, %eax	# 13425	[c=4 l=3]  *iorsi_1/0
+	cmpl	%eax, 24(%rcx)	# 13426	[c=13 l=3]  *cmpsi_1/0
+	je	.L1789	# 13427	[c=13 l=6]  *jcc
+.L559:
+	jmp	*%r10	# 320	[c=4 l=3]  *indirect_jump
+.L549:
+	movq	10984(%rbx), %rdx	# 12585	[c=9 l=7]  *movdi_internal/3
+	movq	%rbp, %rax	# 15696	[c=4 l=3]  *movdi_internal/3
+	subq	1064(%rbx), %rax	# 12582	[c=13 l=7]  *subdi_1/1
+	leaq	handler.2(%rip), %r14	# 12588	[c=1 l=7]  *movdi_internal/4
+	sarq	$4, %rax	# 12583	[c=4 l=4]  *ashrdi3_1/0
+	addq	$1, (%rdx,%rax,8)	# 12587	[c=14 l=5]  *adddi_1/0
+	movzbl	8(%rbp), %eax	# 12590	[c=13 l=4]  zero_extendqidi2/0
+	jmp	*(%r14,%rax,8)	# 17571	[c=10 l=4]  *indirect_jump
+.L545:
+	leaq	92(%rsp), %rsi	# 15936	[c=4 l=5]  *leadi
+	movq	%rbp, %rdi	# 12598	[c=4 l=3]  *movdi_internal/3
+	call	delay_loop	# 12599	[c=10 l=5]  *call_value
+	movl	%eax, %edx	# 15698	[c=4 l=2]  *movsi_internal/0
+	movl	%eax, %esi	# 12600	[c=4 l=2]  *movsi_internal/0
+	subl	$1, %edx	# 12604	[c=4 l=3]  *addsi_2/0
+	js	.L1367	# 12605	[c=13 l=6]  *jcc
+	movl	92(%rsp), %eax	# 17568	[c=9 l=4]  *movsi_internal/0
+	xorl	%ecx, %ecx	# 17570	[c=4 l=2]  *movdi_xor
+	addl	%edx, %eax	# 17569	[c=4 l=2]  *addsi_1/0
+	cltq	# 12609	[c=4 l=2]  *extendsidi2_rex64/0
+	addq	%rbx, %rax	# 12610	[c=4 l=3]  *adddi_1/0
+.L1368:
+	movzbl	1004(%rax), %edi	# 12613	[c=13 l=7]  zero_extendqidi2/0
+	salq	$8, %rcx	# 12612	[c=4 l=4]  *ashldi3_1/0
+	subl	$1, %edx	# 12615	[c=4 l=3]  *addsi_1/0
+	subq	$1, %rax	# 12616	[c=4 l=4]  *adddi_1/0
+	orq	%rdi, %rcx	# 12614	[c=4 l=3]  *iordi_1/0
+	cmpl	$-1, %edx	# 12618	[c=4 l=3]  *cmpsi_1/0
+	jne	.L1368	# 12619	[c=13 l=2]  *jcc
+	leaq	-1(%rcx), %rdi	# 15935	[c=4 l=4]  *leadi
+	testq	%rcx, %rcx	# 12621	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L1367	# 12622	[c=13 l=6]  *jcc
+.L1370:
+	movzbl	11(%rbp), %r8d	# 12636	[c=13 l=5]  zero_extendqidi2/0
+	testq	%r13, %r13	# 12637	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L1371	# 12638	[c=13 l=2]  *jcc
+	xorl	%eax, %eax	# 17566	[c=4 l=2]  *movdi_xor
+	cmpq	%r13, %r12	# 12640	[c=4 l=3]  *cmpdi_1/0
+	jnb	.L1372	# 12641	[c=13 l=2]  *jcc
+	leaq	-1(%r13), %rax	# 15931	[c=4 l=4]  *leadi
+	xorl	%edx, %edx	# 17565	[c=4 l=2]  *movdi_xor
+	subq	%r12, %rax	# 12644	[c=4 l=3]  *subdi_1/0
+	divq	%r8	# 15933	[c=0 l=3]  *udivmoddi4_noext
+	addq	$1, %rax	# 12646	[c=4 l=4]  *adddi_1/0
+.L1372:
+	cmpq	%rax, %rdi	# 14785	[c=4 l=3]  *cmpdi_1/0
+	cmova	%rax, %rdi	# 14786	[c=8 l=4]  *movdicc_noc/1
+.L1371:
+	movzwl	14(%rbp), %edx	# 12655	[c=13 l=4]  zero_extendhidi2/0
+	movq	56(%rbx), %rax	# 12653	[c=9 l=4]  *movdi_internal/3
+	movq	48(%rbx), %r9	# 12652	[c=9 l=4]  *movdi_internal/3
+	leaq	1(%rdx), %r10	# 12656	[c=4 l=4]  *leadi
+	cmpq	$-1, %rax	# 12657	[c=4 l=4]  *cmpdi_1/0
+	je	.L1373	# 12658	[c=13 l=2]  *jcc
+	leaq	1(%r9), %r11	# 15930	[c=4 l=4]  *leadi
+	xorl	%edx, %edx	# 17564	[c=4 l=2]  *movdi_xor
+	cmpq	%rax, %r11	# 12661	[c=4 l=3]  *cmpdi_1/0
+	jb	.L1790	# 12662	[c=13 l=6]  *jcc
+.L1374:
+	cmpq	%rdx, %rdi	# 14783	[c=4 l=3]  *cmpdi_1/0
+	cmova	%rdx, %rdi	# 14784	[c=8 l=4]  *movdicc_noc/1
+.L1373:
+	subq	%rdi, %rcx	# 12673	[c=4 l=3]  *subdi_1/0
+	movq	%rcx, %rdx	# 15703	[c=4 l=3]  *movdi_internal/3
+	testl	%esi, %esi	# 12676	[c=4 l=2]  *cmpsi_ccno_1/0
+	jle	.L1377	# 12677	[c=13 l=2]  *jcc
+	movslq	92(%rsp), %r11	# 13768	[c=13 l=5]  *extendsidi2_rex64/1
+	xorl	%eax, %eax	# 17561	[c=4 l=2]  *movdi_xor
+	addq	%rbx, %r11	# 12696	[c=4 l=3]  *adddi_1/0
+.L1376:
+	leal	0(,%rax,8), %ecx	# 15925	[c=12 l=7]  *leasi
+	movq	%rdx, %r15	# 15704	[c=4 l=3]  *movdi_internal/3
+	shrq	%cl, %r15	# 12698	[c=4 l=3]  *lshrdi3_1/0
+	movb	%r15b, 1004(%r11,%rax)	# 12699	[c=4 l=8]  *movqi_internal/8
+	addq	$1, %rax	# 12700	[c=4 l=4]  *adddi_1/0
+	cmpl	%eax, %esi	# 12702	[c=4 l=2]  *cmpsi_1/0
+	jg	.L1376	# 12703	[c=13 l=2]  *jcc
+.L1377:
+	imulq	%rdi, %r8	# 12679	[c=16 l=4]  *muldi3_1/2
+	leaq	handler.2(%rip), %r14	# 12685	[c=1 l=7]  *movdi_internal/4
+	imulq	%r10, %rdi	# 12682	[c=16 l=4]  *muldi3_1/2
+	addq	%r8, %r12	# 12680	[c=4 l=3]  *adddi_1/0
+	leaq	(%rdi,%r9), %rax	# 15926	[c=4 l=4]  *leadi
+	movq	%r12, 40(%rbx)	# 12681	[c=4 l=4]  *movdi_internal/5
+	movq	%rax, 48(%rbx)	# 12684	[c=4 l=4]  *movdi_internal/5
+	movzbl	8(%rbp), %eax	# 12687	[c=13 l=4]  zero_extendqidi2/0
+	jmp	*(%r14,%rax,8)	# 17562	[c=10 l=4]  *indirect_jump
+.L1357:
+	movzbl	10(%rbp), %ecx	# 12380	[c=13 l=4]  zero_extendqidi2/0
+	movzwl	1030(%rbx), %ebp	# 12381	[c=13 l=7]  zero_extendhidi2/0
+	movq	%rbp, %rdx	# 16778	[c=4 l=3]  *movdi_internal/3
+	cmpl	$15, %ecx	# 12385	[c=4 l=3]  *cmpsi_1/0
+	jle	.L1791	# 12386	[c=13 l=6]  *jcc
+	movl	%ebp, %eax	# 15678	[c=4 l=2]  *movsi_internal/0
+	movzbl	1004(%rbx,%rcx), %ecx	# 12399	[c=10 l=8]  *movqi_internal/4
+	subl	5176(%rbx), %eax	# 12401	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %eax	# 12402	[c=13 l=6]  *cmpsi_1/1
+	jb	.L1359	# 12403	[c=13 l=2]  *jcc
+	movl	%ebp, %eax	# 15680	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %eax	# 12405	[c=4 l=3]  *ashrsi3_1/0
+	cltq	# 12406	[c=4 l=2]  *extendsidi2_rex64/0
+	cmpb	$0, 1080(%rbx,%rax)	# 12407	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L1360	# 12408	[c=13 l=6]  *jcc
+.L1359:
+	movq	1040(%rbx), %rax	# 12412	[c=9 l=7]  *movdi_internal/3
+	movb	%cl, (%rax,%rdx)	# 12413	[c=4 l=3]  *movqi_internal/8
+.L1361:
+	leal	1(%rbp), %eax	# 15945	[c=4 l=3]  *leasi
+	movq	1064(%rbx), %rbp	# 12428	[c=9 l=7]  *movdi_internal/3
+	subq	$1, 48(%rbx)	# 12425	[c=13 l=5]  *adddi_1/0
+	movw	%ax, 1030(%rbx)	# 12427	[c=4 l=7]  *movhi_internal/3
+	movl	(%rbx), %eax	# 12429	[c=6 l=2]  *zero_extendsidi2/3
+	movq	%rax, %r8	# 16779	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rax	# 12431	[c=4 l=4]  *ashldi3_1/0
+	addq	%rbp, %rax	# 12432	[c=4 l=3]  *adddi_1/0
+	leal	1(%r8), %ecx	# 15946	[c=5 l=4]  *leadi
+	movzwl	12(%rax), %esi	# 12435	[c=13 l=4]  *zero_extendhisi2/0
+	movl	%ecx, (%rbx)	# 12434	[c=4 l=2]  *movsi_internal/1
+	movzbl	10(%rax), %eax	# 12437	[c=13 l=4]  zero_extendqidi2/0
+	movl	%esi, %edx	# 16780	[c=4 l=2]  *movsi_internal/0
+	cmpl	$15, %eax	# 12440	[c=4 l=3]  *cmpsi_1/0
+	jle	.L1792	# 12441	[c=13 l=6]  *jcc
+	movzbl	1004(%rbx,%rax), %eax	# 12454	[c=14 l=8]  *zero_extendqisi2/0
+	andl	$136, %edx	# 12459	[c=4 l=6]  *andsi_1/0
+	movl	%eax, %edi	# 15682	[c=4 l=2]  *movsi_internal/0
+	subl	%esi, %eax	# 12462	[c=4 l=2]  *subsi_1/0
+	movzbl	100(%rbx), %esi	# 12467	[c=9 l=4]  *movqi_internal/4
+	andl	$136, %edi	# 12456	[c=4 l=6]  *andsi_1/0
+	andl	$511, %eax	# 12463	[c=4 l=5]  *andsi_1/0
+	leal	(%rdx,%rdi,2), %edx	# 12460	[c=8 l=3]  *leasi
+	imull	$260, %edx, %edx	# 12464	[c=12 l=6]  *mulsi3_1/1
+	andl	$7680, %edx	# 12465	[c=4 l=6]  *andsi_1/0
+	orl	%edx, %eax	# 12466	[c=5 l=2]  *iorsi_1_zext
+	movl	%esi, %edx	# 15684	[c=4 l=2]  *movsi_internal/0
+	andl	$192, %edx	# 12470	[c=4 l=6]  *andsi_2/0
+	jne	.L1363	# 12471	[c=13 l=6]  *jcc
+	leaq	flag_update_table_sub8(%rip), %rdx	# 12474	[c=1 l=7]  *movdi_internal/4
+	movl	$63, %esi	# 59	[c=4 l=5]  *movqi_internal/3
+	addq	%rdx, %rax	# 12475	[c=4 l=3]  *adddi_1/0
+.L1364:
+	salq	$4, %rcx	# 12495	[c=4 l=4]  *ashldi3_1/0
+	leal	2(%r8), %r9d	# 15942	[c=5 l=4]  *leadi
+	movb	%sil, 100(%rbx)	# 12493	[c=4 l=4]  *movqi_internal/8
+	addq	%rbp, %rcx	# 12496	[c=4 l=3]  *adddi_1/0
+	movq	%rax, 104(%rbx)	# 12492	[c=4 l=4]  *movdi_internal/5
+	movl	%r9d, (%rbx)	# 12498	[c=4 l=3]  *movsi_internal/1
+	movzwl	12(%rcx), %edi	# 12499	[c=13 l=4]  zero_extendhidi2/0
+	movzbl	10(%rcx), %ecx	# 12500	[c=13 l=4]  zero_extendqidi2/0
+	cmpl	$15, %ecx	# 12503	[c=4 l=3]  *cmpsi_1/0
+	jle	.L1793	# 12504	[c=13 l=6]  *jcc
+	movzbl	1004(%rbx,%rcx), %ecx	# 12517	[c=14 l=8]  *zero_extendqisi2/0
+	movl	%ecx, %r14d	# 16781	[c=4 l=3]  *movsi_internal/0
+	cmpl	$15, %edi	# 12521	[c=4 l=3]  *cmpsi_1/0
+	jle	.L1794	# 12522	[c=13 l=6]  *jcc
+	movzbl	(%rax), %r10d	# 12537	[c=5 l=4]  *movqi_internal/4
+	movq	1040(%rbx), %rax	# 12538	[c=9 l=7]  *movdi_internal/3
+	salq	$4, %r9	# 12574	[c=4 l=4]  *ashldi3_1/0
+	addl	$3, %r8d	# 12576	[c=4 l=4]  *addsi_1/0
+	movzbl	1004(%rbx,%rdi), %r11d	# 12535	[c=14 l=9]  *zero_extendqisi2/0
+	movzbl	%sil, %edi	# 12536	[c=4 l=4]  *zero_extendqisi2/0
+	andl	$136, %r14d	# 12546	[c=4 l=7]  *andsi_1/0
+	addq	%r9, %rbp	# 12575	[c=4 l=3]  *adddi_1/0
+	movzbl	63(%rax), %r15d	# 12539	[c=13 l=5]  *zero_extendqisi2/0
+	movl	%edi, %eax	# 15690	[c=4 l=2]  *movsi_internal/0
+	andl	%r10d, %esi	# 15937	[c=4 l=3]  *andsi_1/0
+	andl	$-64, %edi	# 12551	[c=4 l=3]  *andsi_1/0
+	notl	%eax	# 12540	[c=4 l=2]  *one_cmplsi2_1/0
+	movzbl	%sil, %esi	# 12543	[c=4 l=4]  *zero_extendqisi2/0
+	subl	%r11d, %ecx	# 12555	[c=4 l=3]  *subsi_1/0
+	andl	%edi, %r10d	# 15938	[c=4 l=3]  *andsi_1/0
+	andl	%r15d, %eax	# 12541	[c=4 l=3]  *andsi_1/0
+	orl	$63, %edi	# 15940	[c=4 l=3]  *iorsi_1/0
+	movl	%r8d, (%rbx)	# 12577	[c=4 l=3]  *movsi_internal/1
+	orl	%esi, %eax	# 12544	[c=4 l=2]  *iorsi_1/0
+	movl	%r11d, %esi	# 15692	[c=4 l=3]  *movsi_internal/0
+	movb	%dil, 100(%rbx)	# 12570	[c=4 l=4]  *movqi_internal/8
+	andl	$136, %esi	# 12549	[c=4 l=6]  *andsi_1/0
+	movl	%eax, %r11d	# 15694	[c=4 l=3]  *movsi_internal/0
+	orl	$-3, %eax	# 12564	[c=4 l=3]  *iorsi_1/0
+	leal	(%rsi,%r14,2), %esi	# 12550	[c=8 l=4]  *leasi
+	andl	$1, %r11d	# 12556	[c=4 l=4]  *andsi_1/0
+	imull	$260, %esi, %esi	# 12559	[c=12 l=6]  *mulsi3_1/1
+	subl	%r11d, %ecx	# 12557	[c=4 l=3]  *subsi_1/0
+	andl	$511, %ecx	# 12558	[c=4 l=6]  *andsi_1/0
+	andl	$7680, %esi	# 12560	[c=4 l=6]  *andsi_1/0
+	orl	%esi, %ecx	# 12561	[c=5 l=2]  *iorsi_1_zext
+	andb	(%rdx,%rcx), %al	# 12565	[c=13 l=3]  *andqi_1/1
+	orl	%eax, %r10d	# 15939	[c=4 l=3]  *iorsi_1/0
+	leaq	101(%rbx), %rax	# 15941	[c=4 l=4]  *leadi
+	movb	%r10b, 101(%rbx)	# 12568	[c=4 l=4]  *movqi_internal/8
+	movq	%rax, 104(%rbx)	# 12572	[c=4 l=4]  *movdi_internal/5
+	jmp	.L614	# 18220	[c=1 l=5]  jump
+.L883:
+	movzbl	10(%rbp), %eax	# 4810	[c=13 l=4]  zero_extendqidi2/0
+	movzwl	12(%rbp), %ecx	# 4809	[c=13 l=4]  zero_extendhidi2/0
+	cmpl	$15, %eax	# 4813	[c=4 l=3]  *cmpsi_1/0
+	jle	.L1795	# 4814	[c=13 l=6]  *jcc
+	movzbl	1004(%rbx,%rax), %eax	# 4827	[c=14 l=8]  *zero_extendqisi2/0
+	cmpl	$15, %ecx	# 4830	[c=4 l=3]  *cmpsi_1/0
+	jle	.L1796	# 4831	[c=13 l=6]  *jcc
+	movzbl	1004(%rbx,%rcx), %ecx	# 4844	[c=14 l=8]  *zero_extendqisi2/0
+	movl	(%rbx), %ebp	# 4865	[c=6 l=2]  *zero_extendsidi2/3
+	imull	%eax, %ecx	# 4845	[c=12 l=3]  *mulsi3_1/2
+	movzbl	100(%rbx), %eax	# 4846	[c=13 l=4]  *zero_extendqisi2/0
+	andl	$-4, %eax	# 4847	[c=4 l=3]  *andsi_1/0
+	cmpl	$1, %ecx	# 4851	[c=4 l=3]  *cmpsi_1/0
+	movl	%ecx, %esi	# 15192	[c=4 l=2]  *movsi_internal/0
+	sbbl	%edx, %edx	# 4852	[c=8 l=2]  *x86_movsicc_0_m1_neg
+	sarl	$15, %esi	# 4854	[c=4 l=3]  *ashrsi3_1/0
+	andl	$2, %edx	# 4853	[c=4 l=3]  *andsi_1/0
+	orl	%esi, %edx	# 4855	[c=4 l=2]  *iorsi_1/0
+	movq	104(%rbx), %rsi	# 4856	[c=9 l=4]  *movdi_internal/3
+	movzbl	(%rsi), %edi	# 17831	[c=5 l=3]  *movqi_internal/4
+	movw	%cx, 1004(%rbx)	# 4864	[c=4 l=7]  *movhi_internal/3
+	andl	%eax, %edi	# 18873	[c=4 l=2]  *andsi_1/0
+	orl	$3, %eax	# 16170	[c=4 l=3]  *iorsi_1/0
+	movl	%edi, %esi	# 15195	[c=4 l=2]  *movqi_internal/1
+	movb	%al, 100(%rbx)	# 4861	[c=4 l=3]  *movqi_internal/8
+	leaq	101(%rbx), %rax	# 16171	[c=4 l=4]  *leadi
+	orl	%esi, %edx	# 16169	[c=4 l=2]  *iorsi_1/0
+	movq	%rax, 104(%rbx)	# 4863	[c=4 l=4]  *movdi_internal/5
+	movb	%dl, 101(%rbx)	# 4859	[c=4 l=3]  *movqi_internal/8
+	movq	%rbp, %rdx	# 16613	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbp	# 4867	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %rbp	# 4869	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%rbp), %eax	# 4870	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%edx, %eax	# 4871	[c=4 l=2]  *addsi_1/0
+	movl	%eax, (%rbx)	# 4872	[c=4 l=2]  *movsi_internal/1
+	jmp	*0(%rbp)	# 17833	[c=5 l=3]  *indirect_jump
+.L886:
+	movzbl	10(%rbp), %eax	# 4879	[c=13 l=4]  zero_extendqidi2/0
+	movzwl	12(%rbp), %ecx	# 4878	[c=13 l=4]  zero_extendhidi2/0
+	cmpl	$15, %eax	# 4882	[c=4 l=3]  *cmpsi_1/0
+	jle	.L1797	# 4883	[c=13 l=6]  *jcc
+	movsbl	1004(%rbx,%rax), %eax	# 4896	[c=14 l=8]  extendqisi2
+	cmpl	$15, %ecx	# 4899	[c=4 l=3]  *cmpsi_1/0
+	jle	.L1798	# 4900	[c=13 l=6]  *jcc
+	movsbl	1004(%rbx,%rcx), %ecx	# 4913	[c=14 l=8]  extendqisi2
+	xorl	%edx, %edx	# 17823	[c=4 l=2]  *movsi_xor
+	movl	(%rbx), %ebp	# 4935	[c=6 l=2]  *zero_extendsidi2/3
+	imull	%eax, %ecx	# 4914	[c=12 l=3]  *mulsi3_1/2
+	movzbl	100(%rbx), %eax	# 4916	[c=13 l=4]  *zero_extendqisi2/0
+	andl	$-4, %eax	# 4917	[c=4 l=3]  *andsi_1/0
+	movl	%ecx, %esi	# 15196	[c=4 l=2]  *movsi_internal/0
+	andl	$65535, %esi	# 17824	[c=4 l=6]  *andsi_2/0
+	sete	%dl	# 17825	[c=4 l=3]  *setcc_qi_slp
+	sarl	$15, %esi	# 4924	[c=4 l=3]  *ashrsi3_1/0
+	addl	%edx, %edx	# 4923	[c=4 l=2]  *ashlsi3_1/0
+	orl	%esi, %edx	# 4925	[c=4 l=2]  *iorsi_1/0
+	movq	104(%rbx), %rsi	# 4926	[c=9 l=4]  *movdi_internal/3
+	movzbl	(%rsi), %edi	# 17826	[c=5 l=3]  *movqi_internal/4
+	movw	%cx, 1004(%rbx)	# 4934	[c=4 l=7]  *movhi_internal/3
+	andl	%eax, %edi	# 18872	[c=4 l=2]  *andsi_1/0
+	orl	$3, %eax	# 16167	[c=4 l=3]  *iorsi_1/0
+	movl	%edi, %esi	# 15199	[c=4 l=2]  *movqi_internal/1
+	movb	%al, 100(%rbx)	# 4931	[c=4 l=3]  *movqi_internal/8
+	leaq	101(%rbx), %rax	# 16168	[c=4 l=4]  *leadi
+	orl	%esi, %edx	# 16166	[c=4 l=2]  *iorsi_1/0
+	movq	%rax, 104(%rbx)	# 4933	[c=4 l=4]  *movdi_internal/5
+	movb	%dl, 101(%rbx)	# 4929	[c=4 l=3]  *movqi_internal/8
+	movq	%rbp, %rdx	# 16614	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbp	# 4937	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %rbp	# 4939	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%rbp), %eax	# 4940	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%edx, %eax	# 4941	[c=4 l=2]  *addsi_1/0
+	movl	%eax, (%rbx)	# 4942	[c=4 l=2]  *movsi_internal/1
+	jmp	*0(%rbp)	# 17828	[c=5 l=3]  *indirect_jump
+.L889:
+	movzbl	10(%rbp), %eax	# 4949	[c=13 l=4]  zero_extendqidi2/0
+	movzwl	12(%rbp), %ecx	# 4948	[c=13 l=4]  zero_extendhidi2/0
+	cmpl	$15, %eax	# 4952	[c=4 l=3]  *cmpsi_1/0
+	jle	.L1799	# 4953	[c=13 l=6]  *jcc
+	movsbl	1004(%rbx,%rax), %eax	# 4966	[c=14 l=8]  extendqisi2
+	cmpl	$15, %ecx	# 4969	[c=4 l=3]  *cmpsi_1/0
+	jle	.L1800	# 4970	[c=13 l=6]  *jcc
+	movzbl	1004(%rbx,%rcx), %ecx	# 4983	[c=14 l=8]  *zero_extendqisi2/0
+	xorl	%edx, %edx	# 17815	[c=4 l=2]  *movsi_xor
+	movl	(%rbx), %ebp	# 5005	[c=6 l=2]  *zero_extendsidi2/3
+	imull	%eax, %ecx	# 4984	[c=12 l=3]  *mulsi3_1/2
+	movzbl	100(%rbx), %eax	# 4986	[c=13 l=4]  *zero_extendqisi2/0
+	andl	$-4, %eax	# 4987	[c=4 l=3]  *andsi_1/0
+	movl	%ecx, %esi	# 15200	[c=4 l=2]  *movsi_internal/0
+	andl	$65535, %esi	# 17816	[c=4 l=6]  *andsi_2/0
+	sete	%dl	# 17817	[c=4 l=3]  *setcc_qi_slp
+	sarl	$15, %esi	# 4994	[c=4 l=3]  *ashrsi3_1/0
+	addl	%edx, %edx	# 4993	[c=4 l=2]  *ashlsi3_1/0
+	orl	%esi, %edx	# 4995	[c=4 l=2]  *iorsi_1/0
+	movq	104(%rbx), %rsi	# 4996	[c=9 l=4]  *movdi_internal/3
+	movzbl	(%rsi), %edi	# 17818	[c=5 l=3]  *movqi_internal/4
+	movw	%cx, 1004(%rbx)	# 5004	[c=4 l=7]  *movhi_internal/3
+	andl	%eax, %edi	# 18871	[c=4 l=2]  *andsi_1/0
+	orl	$3, %eax	# 16162	[c=4 l=3]  *iorsi_1/0
+	movl	%edi, %esi	# 15203	[c=4 l=2]  *movqi_internal/1
+	movb	%al, 100(%rbx)	# 5001	[c=4 l=3]  *movqi_internal/8
+	leaq	101(%rbx), %rax	# 16163	[c=4 l=4]  *leadi
+	orl	%esi, %edx	# 16161	[c=4 l=2]  *iorsi_1/0
+	movq	%rax, 104(%rbx)	# 5003	[c=4 l=4]  *movdi_internal/5
+	movb	%dl, 101(%rbx)	# 4999	[c=4 l=3]  *movqi_internal/8
+	movq	%rbp, %rdx	# 16615	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbp	# 5007	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %rbp	# 5009	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%rbp), %eax	# 5010	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%edx, %eax	# 5011	[c=4 l=2]  *addsi_1/0
+	movl	%eax, (%rbx)	# 5012	[c=4 l=2]  *movsi_internal/1
+	jmp	*0(%rbp)	# 17820	[c=5 l=3]  *indirect_jump
+.L725:
+	movl	$59, %eax	# 2768	[c=4 l=5]  *movsi_internal/0
+	movzbl	10(%rbp), %ebp	# 2766	[c=13 l=4]  zero_extendqidi2/0
+	movzwl	1034(%rbx), %r14d	# 2767	[c=13 l=8]  *zero_extendhisi2/0
+	subl	5176(%rbx), %eax	# 2769	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %eax	# 2770	[c=13 l=6]  *cmpsi_1/1
+	jb	.L726	# 2771	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%rbx)	# 2773	[c=13 l=7]  *cmpqi_ccno_1/1
+	jne	.L727	# 2774	[c=13 l=6]  *jcc
+.L726:
+	movq	1040(%rbx), %rax	# 2777	[c=9 l=7]  *movdi_internal/3
+	movzbl	59(%rax), %eax	# 2778	[c=13 l=4]  *zero_extendqisi2/0
+.L728:
+	movl	992(%rbx), %edx	# 2791	[c=9 l=6]  *movsi_internal/0
+	sall	$16, %eax	# 2789	[c=4 l=3]  *ashlsi3_1/0
+	movq	1056(%rbx), %rcx	# 2796	[c=9 l=7]  *movdi_internal/3
+	orl	%r14d, %eax	# 2790	[c=4 l=3]  *iorsi_1/0
+	leal	1(%rdx,%rdx), %edx	# 2793	[c=8 l=4]  *leasi
+	andl	%eax, %edx	# 2794	[c=4 l=2]  *andsi_1/0
+	movslq	%edx, %rdx	# 2795	[c=4 l=3]  *extendsidi2_rex64/1
+	movzbl	(%rcx,%rdx), %edx	# 2797	[c=9 l=4]  *movqi_internal/4
+	cmpl	$15, %ebp	# 2800	[c=4 l=3]  *cmpsi_1/0
+	jle	.L1801	# 2801	[c=13 l=6]  *jcc
+	movb	%dl, 1004(%rbx,%rbp)	# 2814	[c=4 l=7]  *movqi_internal/8
+	leal	1(%rax), %edx	# 16209	[c=4 l=3]  *leasi
+	movl	$59, %eax	# 2818	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%rbx), %eax	# 2819	[c=13 l=6]  *subsi_1/1
+	movw	%dx, 1034(%rbx)	# 2816	[c=4 l=7]  *movhi_internal/3
+	sarl	$16, %edx	# 2817	[c=4 l=3]  *ashrsi3_1/0
+	cmpl	5180(%rbx), %eax	# 2820	[c=13 l=6]  *cmpsi_1/1
+	jb	.L730	# 2821	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%rbx)	# 2823	[c=13 l=7]  *cmpqi_ccno_1/1
+	jne	.L731	# 2824	[c=13 l=6]  *jcc
+.L730:
+	movq	1040(%rbx), %rax	# 2827	[c=9 l=7]  *movdi_internal/3
+	movb	%dl, 59(%rax)	# 2828	[c=4 l=3]  *movqi_internal/8
+.L732:
+	movl	(%rbx), %ebp	# 2839	[c=6 l=2]  *zero_extendsidi2/3
+	movq	%rbp, %rdx	# 16577	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbp	# 2841	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %rbp	# 2843	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%rbp), %eax	# 2844	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%edx, %eax	# 2845	[c=4 l=2]  *addsi_1/0
+	movl	%eax, (%rbx)	# 2846	[c=4 l=2]  *movsi_internal/1
+	jmp	*0(%rbp)	# 17920	[c=5 l=3]  *indirect_jump
+.L733:
+	movzbl	10(%rbp), %ecx	# 2853	[c=13 l=4]  zero_extendqidi2/0
+	movzwl	12(%rbp), %edx	# 2852	[c=13 l=4]  zero_extendhidi2/0
+	cmpl	$15, %ecx	# 2856	[c=4 l=3]  *cmpsi_1/0
+	jle	.L1802	# 2857	[c=13 l=6]  *jcc
+	movzbl	1004(%rbx,%rcx), %eax	# 2870	[c=10 l=8]  *movqi_internal/4
+	cmpl	$15, %edx	# 2873	[c=4 l=3]  *cmpsi_1/0
+	jle	.L1803	# 2874	[c=13 l=6]  *jcc
+	xorb	1004(%rbx,%rdx), %al	# 2887	[c=14 l=7]  *xorqi_1/1
+	movb	%al, 1004(%rbx,%rcx)	# 2889	[c=4 l=7]  *movqi_internal/8
+	movzbl	100(%rbx), %edx	# 2890	[c=9 l=4]  *movqi_internal/4
+	movl	%edx, %ecx	# 15093	[c=4 l=2]  *movsi_internal/0
+	andl	$225, %ecx	# 2893	[c=4 l=6]  *andsi_2/0
+	jne	.L736	# 2894	[c=13 l=6]  *jcc
+	leaq	flag_update_table_logical(%rip), %rdx	# 2897	[c=1 l=7]  *movdi_internal/4
+	movzbl	%al, %eax	# 2896	[c=4 l=3]  zero_extendqidi2/0
+	addq	%rdx, %rax	# 2898	[c=4 l=3]  *adddi_1/0
+	movl	$30, %edx	# 15	[c=4 l=5]  *movqi_internal/3
+.L737:
+	movl	(%rbx), %ebp	# 2918	[c=6 l=2]  *zero_extendsidi2/3
+	movb	%dl, 100(%rbx)	# 2917	[c=4 l=3]  *movqi_internal/8
+	movq	%rax, 104(%rbx)	# 2916	[c=4 l=4]  *movdi_internal/5
+	movq	%rbp, %rdx	# 16578	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbp	# 2920	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %rbp	# 2922	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%rbp), %eax	# 2923	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%edx, %eax	# 2924	[c=4 l=2]  *addsi_1/0
+	movl	%eax, (%rbx)	# 2925	[c=4 l=2]  *movsi_internal/1
+	jmp	*0(%rbp)	# 17917	[c=5 l=3]  *indirect_jump
+.L738:
+	movl	$2, 96(%rbx)	# 2931	[c=4 l=7]  *movsi_internal/1
+	movzwl	1034(%rbx), %r15d	# 2932	[c=13 l=8]  *zero_extendhisi2/0
+	cmpl	$65536, 880(%rbx)	# 2935	[c=13 l=10]  *cmpsi_1/0
+	jbe	.L739	# 2936	[c=13 l=2]  *jcc
+	movl	$59, %eax	# 2938	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%rbx), %eax	# 2939	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %eax	# 2940	[c=13 l=6]  *cmpsi_1/1
+	jb	.L740	# 2941	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%rbx)	# 2943	[c=13 l=7]  *cmpqi_ccno_1/1
+	jne	.L741	# 2944	[c=13 l=6]  *jcc
+.L740:
+	movq	1040(%rbx), %rax	# 2947	[c=9 l=7]  *movdi_internal/3
+	movzbl	59(%rax), %eax	# 2948	[c=13 l=4]  *zero_extendqisi2/0
+.L742:
+	sall	$16, %eax	# 2959	[c=4 l=3]  *ashlsi3_1/0
+	orl	%eax, %r15d	# 2960	[c=4 l=3]  *iorsi_1/0
+.L739:
+	movslq	6048(%rbx), %rsi	# 2966	[c=13 l=7]  *extendsidi2_rex64/1
+	movl	6044(%rbx), %ebp	# 2963	[c=9 l=6]  *movsi_internal/0
+	movl	992(%rbx), %r8d	# 2964	[c=9 l=7]  *movsi_internal/0
+	movq	1056(%rbx), %rcx	# 2965	[c=9 l=7]  *movdi_internal/3
+	movl	%esi, %eax	# 15095	[c=4 l=2]  *movsi_internal/0
+	subl	5176(%rbx), %eax	# 2967	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %eax	# 2968	[c=13 l=6]  *cmpsi_1/1
+	jb	.L743	# 2969	[c=13 l=2]  *jcc
+	movl	%esi, %eax	# 15097	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %eax	# 2971	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 14809	[c=5 l=5]  *andsi_1_zext
+	cmpb	$0, 1080(%rbx,%rax)	# 2974	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L744	# 2975	[c=13 l=6]  *jcc
+.L743:
+	movq	1040(%rbx), %rdx	# 2979	[c=9 l=7]  *movdi_internal/3
+	movslq	%esi, %rax	# 2978	[c=4 l=3]  *extendsidi2_rex64/1
+	movzbl	(%rdx,%rax), %r14d	# 2980	[c=13 l=5]  *zero_extendqisi2/0
+.L745:
+	movl	%r14d, %edx	# 15099	[c=4 l=3]  *movsi_internal/0
+	movl	%esi, %eax	# 15101	[c=4 l=2]  *movsi_internal/0
+	subl	5176(%rbx), %eax	# 2993	[c=13 l=6]  *subsi_1/1
+	andl	$-64, %edx	# 2991	[c=4 l=3]  *andsi_1/0
+	cmpl	5180(%rbx), %eax	# 2994	[c=13 l=6]  *cmpsi_1/1
+	jb	.L746	# 2995	[c=13 l=2]  *jcc
+	movl	%esi, %eax	# 15103	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %eax	# 2997	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 14808	[c=5 l=5]  *andsi_1_zext
+	cmpb	$0, 1080(%rbx,%rax)	# 3000	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L747	# 3001	[c=13 l=6]  *jcc
+.L746:
+	movq	1040(%rbx), %rax	# 3005	[c=9 l=7]  *movdi_internal/3
+	movb	%dl, (%rax,%rsi)	# 3006	[c=4 l=3]  *movqi_internal/8
+.L748:
+	andl	$63, %r14d	# 3017	[c=4 l=4]  *andsi_1/0
+	leal	-1(%r14), %eax	# 16206	[c=5 l=4]  *leadi
+	cmpl	$4, %eax	# 3021	[c=4 l=3]  *cmpsi_1/0
+	ja	.L749	# 3022	[c=13 l=2]  *jcc
+	movl	%ebp, %edx	# 15105	[c=4 l=2]  *movsi_internal/0
+	leal	1(%r8,%r8), %r14d	# 3025	[c=8 l=5]  *leasi
+	negl	%edx	# 3026	[c=4 l=2]  *negsi_1
+	andl	%edx, %r14d	# 3027	[c=4 l=3]  *andsi_1/0
+	leaq	CSWTCH.175(%rip), %rdx	# 14833	[c=1 l=7]  *movdi_internal/4
+	andl	%r15d, %r14d	# 3028	[c=4 l=3]  *andsi_1/0
+	movl	(%rdx,%rax,4), %eax	# 3033	[c=10 l=3]  *movsi_internal/0
+	movl	%r14d, %edi	# 3029	[c=1 l=3]  *zero_extendsidi2/3
+	addq	%rcx, %rdi	# 3030	[c=4 l=3]  *adddi_1/0
+	movl	%ebp, %ecx	# 13761	[c=1 l=2]  *zero_extendsidi2/3
+	cmpl	$3, %eax	# 3034	[c=4 l=3]  *cmpsi_1/0
+	je	.L750	# 3035	[c=13 l=6]  *jcc
+	jg	.L751	# 3040	[c=13 l=6]  *jcc
+	cmpl	$1, %eax	# 3042	[c=4 l=3]  *cmpsi_1/0
+	je	.L752	# 3043	[c=13 l=6]  *jcc
+	movl	%ebp, %edx	# 3070	[c=1 l=2]  *zero_extendsidi2/3
+	movl	$255, %esi	# 3072	[c=4 l=5]  *movsi_internal/0
+	cmpl	$2, %eax	# 3045	[c=4 l=3]  *cmpsi_1/0
+	jne	.L749	# 3046	[c=13 l=2]  *jcc
+.L1548:
+	call	memset@PLT	# 3112	[c=10 l=5]  *call_value
+	leal	0(%rbp,%r14), %edx	# 16203	[c=4 l=5]  *leasi
+	movl	%r14d, %esi	# 3115	[c=4 l=3]  *movsi_internal/0
+	movq	%rbx, %rdi	# 3116	[c=4 l=3]  *movdi_internal/3
+	call	flash_changed	# 3117	[c=0 l=5]  *call
+.L749:
+	addl	$2, %r15d	# 3120	[c=4 l=4]  *addsi_1/0
+	cmpl	$65536, 880(%rbx)	# 3124	[c=13 l=10]  *cmpsi_1/0
+	movw	%r15w, 1034(%rbx)	# 3121	[c=4 l=8]  *movhi_internal/3
+	ja	.L1804	# 3125	[c=13 l=6]  *jcc
+.L757:
+	leaq	-1(%r13), %rax	# 16202	[c=4 l=4]  *leadi
+	cmpq	%r12, %rax	# 3150	[c=4 l=3]  *cmpdi_1/0
+	jb	.L612	# 3151	[c=13 l=6]  *jcc
+	movq	56(%rbx), %rax	# 15107	[c=9 l=4]  *movdi_internal/3
+	cmpq	%rax, 48(%rbx)	# 3154	[c=13 l=4]  *cmpdi_1/0
+	jnb	.L1805	# 3155	[c=13 l=6]  *jcc
+.L760:
+	cmpl	$0, 120(%rbx)	# 3163	[c=13 l=4]  *cmpsi_ccno_1/1
+	jne	.L761	# 3164	[c=13 l=6]  *jcc
+	movl	(%rbx), %ebp	# 3166	[c=6 l=2]  *zero_extendsidi2/3
+	movl	$1, 96(%rbx)	# 3171	[c=4 l=7]  *movsi_internal/1
+	movq	%rbp, %rdx	# 16579	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbp	# 3168	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %rbp	# 3170	[c=13 l=7]  *adddi_1/1
+	movzbl	11(%rbp), %eax	# 3172	[c=13 l=4]  zero_extendqidi2/0
+	addq	%rax, %r12	# 3173	[c=4 l=3]  *adddi_1/0
+	movzwl	14(%rbp), %eax	# 3175	[c=13 l=4]  zero_extendhidi2/0
+	addq	%rax, 48(%rbx)	# 3176	[c=13 l=4]  *adddi_1/0
+	movq	%r12, 40(%rbx)	# 3174	[c=4 l=4]  *movdi_internal/5
+	movzbl	9(%rbp), %eax	# 3177	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%edx, %eax	# 3178	[c=4 l=2]  *addsi_1/0
+	movl	%eax, (%rbx)	# 3179	[c=4 l=2]  *movsi_internal/1
+	jmp	*0(%rbp)	# 17911	[c=5 l=3]  *indirect_jump
+.L762:
+	movzbl	10(%rbp), %eax	# 3186	[c=13 l=4]  zero_extendqidi2/0
+	movzwl	12(%rbp), %ecx	# 3185	[c=13 l=4]  zero_extendhidi2/0
+	cmpl	$15, %eax	# 3189	[c=4 l=3]  *cmpsi_1/0
+	jle	.L1806	# 3190	[c=13 l=6]  *jcc
+	movzbl	1004(%rbx,%rax), %edx	# 3203	[c=14 l=8]  *zero_extendqisi2/0
+	cmpl	$15, %ecx	# 3206	[c=4 l=3]  *cmpsi_1/0
+	jle	.L1807	# 3207	[c=13 l=6]  *jcc
+	movzbl	1004(%rbx,%rcx), %eax	# 3220	[c=14 l=8]  *zero_extendqisi2/0
+	xorl	%ecx, %ecx	# 17903	[c=4 l=2]  *movsi_xor
+	movl	(%rbx), %ebp	# 3242	[c=6 l=2]  *zero_extendsidi2/3
+	imull	%edx, %eax	# 3221	[c=12 l=3]  *mulsi3_1/2
+	movzbl	100(%rbx), %edx	# 3223	[c=13 l=4]  *zero_extendqisi2/0
+	andl	$-4, %edx	# 3224	[c=4 l=3]  *andsi_1/0
+	movl	%eax, %esi	# 15108	[c=4 l=2]  *movsi_internal/0
+	addl	%esi, %esi	# 17904	[c=4 l=2]  *ashlsi3_cmp
+	sete	%cl	# 17905	[c=4 l=3]  *setcc_qi_slp
+	sarl	$15, %eax	# 3231	[c=4 l=3]  *ashrsi3_1/0
+	addl	%ecx, %ecx	# 3230	[c=4 l=2]  *ashlsi3_1/0
+	orl	%ecx, %eax	# 3232	[c=4 l=2]  *iorsi_1/0
+	movq	104(%rbx), %rcx	# 3233	[c=9 l=4]  *movdi_internal/3
+	movzbl	(%rcx), %edi	# 17906	[c=5 l=3]  *movqi_internal/4
+	movw	%si, 1004(%rbx)	# 3241	[c=4 l=7]  *movhi_internal/3
+	andl	%edx, %edi	# 18870	[c=4 l=2]  *andsi_1/0
+	orl	$3, %edx	# 16200	[c=4 l=3]  *iorsi_1/0
+	movl	%edi, %ecx	# 15111	[c=4 l=2]  *movqi_internal/1
+	movb	%dl, 100(%rbx)	# 3238	[c=4 l=3]  *movqi_internal/8
+	movq	%rbp, %rdx	# 16580	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbp	# 3244	[c=4 l=4]  *ashldi3_1/0
+	orl	%ecx, %eax	# 16199	[c=4 l=2]  *iorsi_1/0
+	addq	1064(%rbx), %rbp	# 3246	[c=13 l=7]  *adddi_1/1
+	movb	%al, 101(%rbx)	# 3236	[c=4 l=3]  *movqi_internal/8
+	leaq	101(%rbx), %rax	# 16201	[c=4 l=4]  *leadi
+	movq	%rax, 104(%rbx)	# 3240	[c=4 l=4]  *movdi_internal/5
+	movzbl	9(%rbp), %eax	# 3247	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%edx, %eax	# 3248	[c=4 l=2]  *addsi_1/0
+	movl	%eax, (%rbx)	# 3249	[c=4 l=2]  *movsi_internal/1
+	jmp	*0(%rbp)	# 17908	[c=5 l=3]  *indirect_jump
+.L765:
+	movzbl	10(%rbp), %eax	# 3256	[c=13 l=4]  zero_extendqidi2/0
+	movzwl	12(%rbp), %ecx	# 3255	[c=13 l=4]  zero_extendhidi2/0
+	cmpl	$15, %eax	# 3259	[c=4 l=3]  *cmpsi_1/0
+	jle	.L1808	# 3260	[c=13 l=6]  *jcc
+	movsbl	1004(%rbx,%rax), %edx	# 3273	[c=14 l=8]  extendqisi2
+	cmpl	$15, %ecx	# 3276	[c=4 l=3]  *cmpsi_1/0
+	jle	.L1809	# 3277	[c=13 l=6]  *jcc
+	movsbl	1004(%rbx,%rcx), %eax	# 3290	[c=14 l=8]  extendqisi2
+	xorl	%ecx, %ecx	# 17895	[c=4 l=2]  *movsi_xor
+	movl	(%rbx), %ebp	# 3313	[c=6 l=2]  *zero_extendsidi2/3
+	imull	%edx, %eax	# 3291	[c=12 l=3]  *mulsi3_1/2
+	movzbl	100(%rbx), %edx	# 3294	[c=13 l=4]  *zero_extendqisi2/0
+	andl	$-4, %edx	# 3295	[c=4 l=3]  *andsi_1/0
+	movzwl	%ax, %eax	# 3292	[c=4 l=3]  *zero_extendhisi2/0
+	movl	%eax, %esi	# 15112	[c=4 l=2]  *movsi_internal/0
+	addl	%esi, %esi	# 17896	[c=4 l=2]  *ashlsi3_cmp
+	sete	%cl	# 17897	[c=4 l=3]  *setcc_qi_slp
+	sarl	$15, %eax	# 3302	[c=4 l=3]  *ashrsi3_1/0
+	addl	%ecx, %ecx	# 3301	[c=4 l=2]  *ashlsi3_1/0
+	orl	%ecx, %eax	# 3303	[c=4 l=2]  *iorsi_1/0
+	movq	104(%rbx), %rcx	# 3304	[c=9 l=4]  *movdi_internal/3
+	movzbl	(%rcx), %edi	# 17898	[c=5 l=3]  *movqi_internal/4
+	movw	%si, 1004(%rbx)	# 3312	[c=4 l=7]  *movhi_internal/3
+	andl	%edx, %edi	# 18869	[c=4 l=2]  *andsi_1/0
+	orl	$3, %edx	# 16195	[c=4 l=3]  *iorsi_1/0
+	movl	%edi, %ecx	# 15115	[c=4 l=2]  *movqi_internal/1
+	movb	%dl, 100(%rbx)	# 3309	[c=4 l=3]  *movqi_internal/8
+	movq	%rbp, %rdx	# 16581	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbp	# 3315	[c=4 l=4]  *ashldi3_1/0
+	orl	%ecx, %eax	# 16194	[c=4 l=2]  *iorsi_1/0
+	addq	1064(%rbx), %rbp	# 3317	[c=13 l=7]  *adddi_1/1
+	movb	%al, 101(%rbx)	# 3307	[c=4 l=3]  *movqi_internal/8
+	leaq	101(%rbx), %rax	# 16196	[c=4 l=4]  *leadi
+	movq	%rax, 104(%rbx)	# 3311	[c=4 l=4]  *movdi_internal/5
+	movzbl	9(%rbp), %eax	# 3318	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%edx, %eax	# 3319	[c=4 l=2]  *addsi_1/0
+	movl	%eax, (%rbx)	# 3320	[c=4 l=2]  *movsi_internal/1
+	jmp	*0(%rbp)	# 17900	[c=5 l=3]  *indirect_jump
+.L768:
+	movzbl	10(%rbp), %eax	# 3327	[c=13 l=4]  zero_extendqidi2/0
+	movzwl	12(%rbp), %ecx	# 3326	[c=13 l=4]  zero_extendhidi2/0
+	cmpl	$15, %eax	# 3330	[c=4 l=3]  *cmpsi_1/0
+	jle	.L1810	# 3331	[c=13 l=6]  *jcc
+	movsbl	1004(%rbx,%rax), %edx	# 3344	[c=14 l=8]  extendqisi2
+	cmpl	$15, %ecx	# 3347	[c=4 l=3]  *cmpsi_1/0
+	jle	.L1811	# 3348	[c=13 l=6]  *jcc
+	movzbl	1004(%rbx,%rcx), %eax	# 3361	[c=14 l=8]  *zero_extendqisi2/0
+	xorl	%ecx, %ecx	# 17887	[c=4 l=2]  *movsi_xor
+	movl	(%rbx), %ebp	# 3384	[c=6 l=2]  *zero_extendsidi2/3
+	imull	%edx, %eax	# 3362	[c=12 l=3]  *mulsi3_1/2
+	movzbl	100(%rbx), %edx	# 3365	[c=13 l=4]  *zero_extendqisi2/0
+	andl	$-4, %edx	# 3366	[c=4 l=3]  *andsi_1/0
+	movzwl	%ax, %eax	# 3363	[c=4 l=3]  *zero_extendhisi2/0
+	movl	%eax, %esi	# 15116	[c=4 l=2]  *movsi_internal/0
+	addl	%esi, %esi	# 17888	[c=4 l=2]  *ashlsi3_cmp
+	sete	%cl	# 17889	[c=4 l=3]  *setcc_qi_slp
+	sarl	$15, %eax	# 3373	[c=4 l=3]  *ashrsi3_1/0
+	addl	%ecx, %ecx	# 3372	[c=4 l=2]  *ashlsi3_1/0
+	orl	%ecx, %eax	# 3374	[c=4 l=2]  *iorsi_1/0
+	movq	104(%rbx), %rcx	# 3375	[c=9 l=4]  *movdi_internal/3
+	movzbl	(%rcx), %edi	# 17890	[c=5 l=3]  *movqi_internal/4
+	movw	%si, 1004(%rbx)	# 3383	[c=4 l=7]  *movhi_internal/3
+	andl	%edx, %edi	# 18868	[c=4 l=2]  *andsi_1/0
+	orl	$3, %edx	# 16190	[c=4 l=3]  *iorsi_1/0
+	movl	%edi, %ecx	# 15119	[c=4 l=2]  *movqi_internal/1
+	movb	%dl, 100(%rbx)	# 3380	[c=4 l=3]  *movqi_internal/8
+	movq	%rbp, %rdx	# 16582	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbp	# 3386	[c=4 l=4]  *ashldi3_1/0
+	orl	%ecx, %eax	# 16189	[c=4 l=2]  *iorsi_1/0
+	addq	1064(%rbx), %rbp	# 3388	[c=13 l=7]  *adddi_1/1
+	movb	%al, 101(%rbx)	# 3378	[c=4 l=3]  *movqi_internal/8
+	leaq	101(%rbx), %rax	# 16191	[c=4 l=4]  *leadi
+	movq	%rax, 104(%rbx)	# 3382	[c=4 l=4]  *movdi_internal/5
+	movzbl	9(%rbp), %eax	# 3389	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%edx, %eax	# 3390	[c=4 l=2]  *addsi_1/0
+	movl	%eax, (%rbx)	# 3391	[c=4 l=2]  *movsi_internal/1
+	jmp	*0(%rbp)	# 17892	[c=5 l=3]  *indirect_jump
+.L771:
+	movl	5176(%rbx), %r14d	# 3398	[c=9 l=7]  *movsi_internal/0
+	movl	$61, %eax	# 3400	[c=4 l=5]  *movsi_internal/0
+	movl	5180(%rbx), %r15d	# 3399	[c=9 l=7]  *movsi_internal/0
+	movl	$2, 96(%rbx)	# 3397	[c=4 l=7]  *movsi_internal/1
+	subl	%r14d, %eax	# 3401	[c=4 l=3]  *subsi_1/0
+	cmpl	%r15d, %eax	# 3402	[c=4 l=3]  *cmpsi_1/0
+	jb	.L772	# 3403	[c=13 l=6]  *jcc
+	cmpb	$1, 1081(%rbx)	# 3407	[c=13 l=7]  *cmpqi_1/0
+	ja	.L1812	# 3408	[c=13 l=6]  *jcc
+	movq	1040(%rbx), %rax	# 13572	[c=9 l=7]  *movdi_internal/3
+	movzbl	61(%rax), %edx	# 13573	[c=13 l=4]  *zero_extendqisi2/0
+.L774:
+	movzbl	62(%rax), %ebp	# 3445	[c=13 l=4]  *zero_extendqisi2/0
+.L776:
+	sall	$8, %ebp	# 3448	[c=4 l=3]  *ashlsi3_1/0
+	movzbl	840(%rbx), %eax	# 3453	[c=13 l=7]  *zero_extendqisi2/0
+	orl	%edx, %ebp	# 3449	[c=4 l=2]  *iorsi_1/0
+	movl	996(%rbx), %edx	# 3451	[c=9 l=6]  *movsi_internal/0
+	leal	1(%rdx,%rax), %eax	# 3454	[c=5 l=4]  *leasi
+	cmpl	%eax, %ebp	# 3455	[c=4 l=2]  *cmpsi_1/0
+	jb	.L1813	# 3456	[c=13 l=6]  *jcc
+	movl	%ebp, %edx	# 15120	[c=4 l=2]  *movsi_internal/0
+	movl	(%rbx), %ecx	# 3464	[c=5 l=2]  *movsi_internal/0
+	leal	-1(%rbp), %eax	# 16186	[c=4 l=3]  *leasi
+	subl	%r14d, %edx	# 3466	[c=4 l=3]  *subsi_1/0
+	cmpl	%r15d, %edx	# 3467	[c=4 l=3]  *cmpsi_1/0
+	jb	.L778	# 3468	[c=13 l=2]  *jcc
+	movl	%ebp, %edx	# 15122	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %edx	# 3470	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %edx	# 14807	[c=5 l=6]  *andsi_1_zext
+	cmpb	$0, 1080(%rbx,%rdx)	# 3473	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L779	# 3474	[c=13 l=6]  *jcc
+.L778:
+	movq	1040(%rbx), %rsi	# 3478	[c=9 l=7]  *movdi_internal/3
+	movslq	%ebp, %rdx	# 3477	[c=4 l=3]  *extendsidi2_rex64/1
+	movb	%cl, (%rsi,%rdx)	# 3479	[c=4 l=3]  *movqi_internal/8
+.L780:
+	movl	(%rbx), %edx	# 15124	[c=5 l=2]  *movsi_internal/0
+	movl	%eax, %ecx	# 15126	[c=4 l=2]  *movsi_internal/0
+	leal	-2(%rbp), %r14d	# 16185	[c=4 l=4]  *leasi
+	subl	5176(%rbx), %ecx	# 3493	[c=13 l=6]  *subsi_1/1
+	shrl	$8, %edx	# 3491	[c=4 l=3]  *lshrsi3_1/0
+	cmpl	5180(%rbx), %ecx	# 3494	[c=13 l=6]  *cmpsi_1/1
+	jb	.L781	# 3495	[c=13 l=2]  *jcc
+	movl	%eax, %ecx	# 15128	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %ecx	# 3497	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %ecx	# 14806	[c=5 l=6]  *andsi_1_zext
+	cmpb	$0, 1080(%rbx,%rcx)	# 3500	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L782	# 3501	[c=13 l=6]  *jcc
+.L781:
+	movq	1040(%rbx), %rcx	# 3505	[c=9 l=7]  *movdi_internal/3
+	cltq	# 3504	[c=4 l=2]  *extendsidi2_rex64/0
+	movb	%dl, (%rcx,%rax)	# 3506	[c=4 l=3]  *movqi_internal/8
+.L783:
+	cmpb	$0, 840(%rbx)	# 3517	[c=13 l=7]  *cmpqi_ccno_1/1
+	je	.L784	# 3518	[c=13 l=2]  *jcc
+	movl	(%rbx), %edx	# 15130	[c=5 l=2]  *movsi_internal/0
+	movl	%r14d, %eax	# 15132	[c=4 l=3]  *movsi_internal/0
+	subl	$3, %ebp	# 3522	[c=4 l=3]  *addsi_1/0
+	subl	5176(%rbx), %eax	# 3523	[c=13 l=6]  *subsi_1/1
+	shrl	$16, %edx	# 3521	[c=4 l=3]  *lshrsi3_1/0
+	cmpl	5180(%rbx), %eax	# 3524	[c=13 l=6]  *cmpsi_1/1
+	jb	.L785	# 3525	[c=13 l=2]  *jcc
+	movl	%r14d, %eax	# 15134	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %eax	# 3527	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 14805	[c=5 l=5]  *andsi_1_zext
+	cmpb	$0, 1080(%rbx,%rax)	# 3530	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L786	# 3531	[c=13 l=6]  *jcc
+.L785:
+	movq	1040(%rbx), %rax	# 3535	[c=9 l=7]  *movdi_internal/3
+	movslq	%r14d, %r14	# 3534	[c=4 l=3]  *extendsidi2_rex64/1
+	movb	%dl, (%rax,%r14)	# 3536	[c=4 l=4]  *movqi_internal/8
+.L787:
+	movl	%ebp, %r14d	# 17	[c=4 l=3]  *movsi_internal/0
+.L784:
+	movl	$61, %eax	# 3551	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%rbx), %eax	# 3552	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %eax	# 3553	[c=13 l=6]  *cmpsi_1/1
+	jb	.L788	# 3554	[c=13 l=2]  *jcc
+	cmpb	$1, 1081(%rbx)	# 3558	[c=13 l=7]  *cmpqi_1/0
+	ja	.L1814	# 3559	[c=13 l=6]  *jcc
+.L788:
+	movq	1040(%rbx), %rax	# 3570	[c=9 l=7]  *movdi_internal/3
+	movb	%r14b, 61(%rax)	# 3571	[c=4 l=4]  *movqi_internal/8
+.L789:
+	movl	$62, %eax	# 3575	[c=4 l=5]  *movsi_internal/0
+	sarl	$8, %r14d	# 3574	[c=4 l=4]  *ashrsi3_1/0
+	subl	5176(%rbx), %eax	# 3576	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %eax	# 3577	[c=13 l=6]  *cmpsi_1/1
+	jb	.L790	# 3578	[c=13 l=2]  *jcc
+	cmpb	$1, 1081(%rbx)	# 3582	[c=13 l=7]  *cmpqi_1/0
+	ja	.L1815	# 3583	[c=13 l=6]  *jcc
+.L790:
+	movq	1040(%rbx), %rax	# 3594	[c=9 l=7]  *movdi_internal/3
+	movb	%r14b, 62(%rax)	# 3595	[c=4 l=4]  *movqi_internal/8
+.L791:
+	movzwl	1034(%rbx), %esi	# 3598	[c=13 l=7]  *zero_extendhisi2/0
+	movl	%esi, (%rbx)	# 3599	[c=4 l=2]  *movsi_internal/1
+	cmpl	%esi, 992(%rbx)	# 3600	[c=13 l=6]  *cmpsi_1/0
+	jb	.L1816	# 3601	[c=13 l=6]  *jcc
+	movzbl	840(%rbx), %eax	# 3609	[c=13 l=7]  zero_extendqidi2/0
+	leaq	-1(%r13), %rdx	# 16184	[c=4 l=4]  *leadi
+	addq	48(%rbx), %rax	# 3611	[c=13 l=4]  *adddi_1/1
+	movq	%rax, 48(%rbx)	# 3612	[c=4 l=4]  *movdi_internal/5
+	cmpq	%r12, %rdx	# 3614	[c=4 l=3]  *cmpdi_1/0
+	jb	.L612	# 3615	[c=13 l=6]  *jcc
+	cmpq	56(%rbx), %rax	# 3617	[c=13 l=4]  *cmpdi_1/1
+	jnb	.L1817	# 3618	[c=13 l=6]  *jcc
+.L793:
+	movl	(%rbx), %ebp	# 3625	[c=6 l=2]  *zero_extendsidi2/3
+	movl	$1, 96(%rbx)	# 3630	[c=4 l=7]  *movsi_internal/1
+	movq	%rbp, %rdx	# 16583	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbp	# 3627	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %rbp	# 3629	[c=13 l=7]  *adddi_1/1
+	movzbl	11(%rbp), %eax	# 3631	[c=13 l=4]  zero_extendqidi2/0
+	addq	%rax, %r12	# 3632	[c=4 l=3]  *adddi_1/0
+	movzwl	14(%rbp), %eax	# 3634	[c=13 l=4]  zero_extendhidi2/0
+	addq	%rax, 48(%rbx)	# 3635	[c=13 l=4]  *adddi_1/0
+	movq	%r12, 40(%rbx)	# 3633	[c=4 l=4]  *movdi_internal/5
+	movzbl	9(%rbp), %eax	# 3636	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%edx, %eax	# 3637	[c=4 l=2]  *addsi_1/0
+	movl	%eax, (%rbx)	# 3638	[c=4 l=2]  *movsi_internal/1
+	jmp	*0(%rbp)	# 17884	[c=5 l=3]  *indirect_jump
+.L794:
+	movzwl	1034(%rbx), %esi	# 3645	[c=13 l=7]  *zero_extendhisi2/0
+	movl	$2, 96(%rbx)	# 3644	[c=4 l=7]  *movsi_internal/1
+	movl	%esi, (%rbx)	# 3646	[c=4 l=2]  *movsi_internal/1
+	cmpl	%esi, 992(%rbx)	# 3647	[c=13 l=6]  *cmpsi_1/0
+	jb	.L1818	# 3648	[c=13 l=6]  *jcc
+	leaq	-1(%r13), %rax	# 16183	[c=4 l=4]  *leadi
+	cmpq	%r12, %rax	# 3657	[c=4 l=3]  *cmpdi_1/0
+	jb	.L612	# 3658	[c=13 l=6]  *jcc
+	movq	56(%rbx), %rax	# 15136	[c=9 l=4]  *movdi_internal/3
+	cmpq	%rax, 48(%rbx)	# 3661	[c=13 l=4]  *cmpdi_1/0
+	jnb	.L1819	# 3662	[c=13 l=6]  *jcc
+.L796:
+	movl	(%rbx), %ebp	# 3669	[c=6 l=2]  *zero_extendsidi2/3
+	movl	$1, 96(%rbx)	# 3674	[c=4 l=7]  *movsi_internal/1
+	movq	%rbp, %rdx	# 16584	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbp	# 3671	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %rbp	# 3673	[c=13 l=7]  *adddi_1/1
+	movzbl	11(%rbp), %eax	# 3675	[c=13 l=4]  zero_extendqidi2/0
+	addq	%rax, %r12	# 3676	[c=4 l=3]  *adddi_1/0
+	movzwl	14(%rbp), %eax	# 3678	[c=13 l=4]  zero_extendhidi2/0
+	addq	%rax, 48(%rbx)	# 3679	[c=13 l=4]  *adddi_1/0
+	movq	%r12, 40(%rbx)	# 3677	[c=4 l=4]  *movdi_internal/5
+	movzbl	9(%rbp), %eax	# 3680	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%edx, %eax	# 3681	[c=4 l=2]  *addsi_1/0
+	movl	%eax, (%rbx)	# 3682	[c=4 l=2]  *movsi_internal/1
+	jmp	*0(%rbp)	# 17881	[c=5 l=3]  *indirect_jump
+.L811:
+	movzwl	12(%rbp), %r14d	# 3890	[c=13 l=5]  *zero_extendhisi2/0
+	movzwl	1032(%rbx), %esi	# 3892	[c=13 l=7]  *zero_extendhisi2/0
+	movzbl	10(%rbp), %ebp	# 3891	[c=13 l=4]  zero_extendqidi2/0
+	addl	%r14d, %esi	# 3893	[c=4 l=3]  *addsi_1/0
+	movl	%esi, %eax	# 15144	[c=4 l=2]  *movsi_internal/0
+	subl	5176(%rbx), %eax	# 3894	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %eax	# 3895	[c=13 l=6]  *cmpsi_1/1
+	jb	.L812	# 3896	[c=13 l=2]  *jcc
+	movl	%esi, %eax	# 15146	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %eax	# 3898	[c=4 l=3]  *ashrsi3_1/0
+	cltq	# 3899	[c=4 l=2]  *extendsidi2_rex64/0
+	cmpb	$0, 1080(%rbx,%rax)	# 3900	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L813	# 3901	[c=13 l=6]  *jcc
+.L812:
+	movq	1040(%rbx), %rax	# 3905	[c=9 l=7]  *movdi_internal/3
+	movslq	%esi, %rsi	# 3904	[c=4 l=3]  *extendsidi2_rex64/1
+	movzbl	(%rax,%rsi), %eax	# 3906	[c=13 l=4]  *zero_extendqisi2/0
+.L814:
+	cmpl	$15, %ebp	# 3920	[c=4 l=3]  *cmpsi_1/0
+	jle	.L1820	# 3921	[c=13 l=6]  *jcc
+	movb	%al, 1004(%rbx,%rbp)	# 3934	[c=4 l=7]  *movqi_internal/8
+	testl	%r14d, %r14d	# 3935	[c=4 l=3]  *cmpsi_ccno_1/0
+	jne	.L816	# 3936	[c=13 l=2]  *jcc
+	subq	$1, 48(%rbx)	# 3938	[c=13 l=5]  *adddi_1/0
+.L816:
+	movl	(%rbx), %ebp	# 3941	[c=6 l=2]  *zero_extendsidi2/3
+	movq	%rbp, %rdx	# 16590	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbp	# 3943	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %rbp	# 3945	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%rbp), %eax	# 3946	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%edx, %eax	# 3947	[c=4 l=2]  *addsi_1/0
+	movl	%eax, (%rbx)	# 3948	[c=4 l=2]  *movsi_internal/1
+	jmp	*0(%rbp)	# 17870	[c=5 l=3]  *indirect_jump
+.L817:
+	movzwl	12(%rbp), %r14d	# 3954	[c=13 l=5]  *zero_extendhisi2/0
+	movzwl	1034(%rbx), %esi	# 3956	[c=13 l=7]  *zero_extendhisi2/0
+	movzbl	10(%rbp), %ebp	# 3955	[c=13 l=4]  zero_extendqidi2/0
+	addl	%r14d, %esi	# 3957	[c=4 l=3]  *addsi_1/0
+	movl	%esi, %eax	# 15148	[c=4 l=2]  *movsi_internal/0
+	subl	5176(%rbx), %eax	# 3958	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %eax	# 3959	[c=13 l=6]  *cmpsi_1/1
+	jb	.L818	# 3960	[c=13 l=2]  *jcc
+	movl	%esi, %eax	# 15150	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %eax	# 3962	[c=4 l=3]  *ashrsi3_1/0
+	cltq	# 3963	[c=4 l=2]  *extendsidi2_rex64/0
+	cmpb	$0, 1080(%rbx,%rax)	# 3964	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L819	# 3965	[c=13 l=6]  *jcc
+.L818:
+	movq	1040(%rbx), %rax	# 3969	[c=9 l=7]  *movdi_internal/3
+	movslq	%esi, %rsi	# 3968	[c=4 l=3]  *extendsidi2_rex64/1
+	movzbl	(%rax,%rsi), %eax	# 3970	[c=13 l=4]  *zero_extendqisi2/0
+.L820:
+	cmpl	$15, %ebp	# 3984	[c=4 l=3]  *cmpsi_1/0
+	jle	.L1821	# 3985	[c=13 l=6]  *jcc
+	movb	%al, 1004(%rbx,%rbp)	# 3998	[c=4 l=7]  *movqi_internal/8
+	testl	%r14d, %r14d	# 3999	[c=4 l=3]  *cmpsi_ccno_1/0
+	jne	.L822	# 4000	[c=13 l=2]  *jcc
+	subq	$1, 48(%rbx)	# 4002	[c=13 l=5]  *adddi_1/0
+.L822:
+	movl	(%rbx), %ebp	# 4005	[c=6 l=2]  *zero_extendsidi2/3
+	movq	%rbp, %rdx	# 16591	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbp	# 4007	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %rbp	# 4009	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%rbp), %eax	# 4010	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%edx, %eax	# 4011	[c=4 l=2]  *addsi_1/0
+	movl	%eax, (%rbx)	# 4012	[c=4 l=2]  *movsi_internal/1
+	jmp	*0(%rbp)	# 17868	[c=5 l=3]  *indirect_jump
+.L823:
+	movzwl	12(%rbp), %esi	# 4018	[c=13 l=4]  zero_extendhidi2/0
+	movzbl	10(%rbp), %ebp	# 4019	[c=13 l=4]  zero_extendqidi2/0
+	movl	%esi, %edx	# 15152	[c=4 l=2]  *movsi_internal/0
+	movq	%rsi, %rax	# 16592	[c=4 l=3]  *movdi_internal/3
+	subl	5176(%rbx), %edx	# 4021	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %edx	# 4022	[c=13 l=6]  *cmpsi_1/1
+	jb	.L824	# 4023	[c=13 l=2]  *jcc
+	movl	%esi, %edx	# 15154	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %edx	# 4026	[c=4 l=3]  *ashrsi3_1/0
+	movslq	%edx, %rdx	# 4027	[c=4 l=3]  *extendsidi2_rex64/1
+	cmpb	$0, 1080(%rbx,%rdx)	# 4028	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L825	# 4029	[c=13 l=6]  *jcc
+.L824:
+	movq	1040(%rbx), %rdx	# 4033	[c=9 l=7]  *movdi_internal/3
+	movzbl	(%rdx,%rax), %eax	# 4034	[c=13 l=4]  *zero_extendqisi2/0
+.L826:
+	cmpl	$15, %ebp	# 4048	[c=4 l=3]  *cmpsi_1/0
+	jle	.L1822	# 4049	[c=13 l=6]  *jcc
+	movb	%al, 1004(%rbx,%rbp)	# 4062	[c=4 l=7]  *movqi_internal/8
+	movl	(%rbx), %ebp	# 4063	[c=6 l=2]  *zero_extendsidi2/3
+	movq	%rbp, %rdx	# 16593	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbp	# 4065	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %rbp	# 4067	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%rbp), %eax	# 4068	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%edx, %eax	# 4069	[c=4 l=2]  *addsi_1/0
+	movl	%eax, (%rbx)	# 4070	[c=4 l=2]  *movsi_internal/1
+	jmp	*0(%rbp)	# 17866	[c=5 l=3]  *indirect_jump
+.L828:
+	movzwl	12(%rbp), %esi	# 4076	[c=13 l=4]  zero_extendhidi2/0
+	movzbl	10(%rbp), %ebp	# 4077	[c=13 l=4]  zero_extendqidi2/0
+	movl	%esi, %edx	# 15156	[c=4 l=2]  *movsi_internal/0
+	movq	%rsi, %rax	# 16594	[c=4 l=3]  *movdi_internal/3
+	subl	5176(%rbx), %edx	# 4079	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %edx	# 4080	[c=13 l=6]  *cmpsi_1/1
+	jb	.L829	# 4081	[c=13 l=2]  *jcc
+	movl	%esi, %edx	# 15158	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %edx	# 4084	[c=4 l=3]  *ashrsi3_1/0
+	movslq	%edx, %rdx	# 4085	[c=4 l=3]  *extendsidi2_rex64/1
+	cmpb	$0, 1080(%rbx,%rdx)	# 4086	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L830	# 4087	[c=13 l=6]  *jcc
+.L829:
+	movq	1040(%rbx), %rdx	# 4091	[c=9 l=7]  *movdi_internal/3
+	movzbl	(%rdx,%rax), %eax	# 4092	[c=13 l=4]  *zero_extendqisi2/0
+.L831:
+	cmpl	$15, %ebp	# 4106	[c=4 l=3]  *cmpsi_1/0
+	jle	.L1823	# 4107	[c=13 l=6]  *jcc
+	movb	%al, 1004(%rbx,%rbp)	# 4120	[c=4 l=7]  *movqi_internal/8
+	movl	(%rbx), %ebp	# 4121	[c=6 l=2]  *zero_extendsidi2/3
+	movq	%rbp, %rdx	# 16595	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbp	# 4123	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %rbp	# 4125	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%rbp), %eax	# 4126	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%edx, %eax	# 4127	[c=4 l=2]  *addsi_1/0
+	movl	%eax, (%rbx)	# 4128	[c=4 l=2]  *movsi_internal/1
+	jmp	*0(%rbp)	# 17864	[c=5 l=3]  *indirect_jump
+.L797:
+	movzwl	12(%rbp), %esi	# 3688	[c=13 l=4]  zero_extendhidi2/0
+	movzbl	10(%rbp), %ebp	# 3689	[c=13 l=4]  zero_extendqidi2/0
+	movl	%esi, %edx	# 15137	[c=4 l=2]  *movsi_internal/0
+	movq	%rsi, %rax	# 16585	[c=4 l=3]  *movdi_internal/3
+	subl	5176(%rbx), %edx	# 3691	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %edx	# 3692	[c=13 l=6]  *cmpsi_1/1
+	jb	.L798	# 3693	[c=13 l=2]  *jcc
+	movl	%esi, %edx	# 15139	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %edx	# 3696	[c=4 l=3]  *ashrsi3_1/0
+	movslq	%edx, %rdx	# 3697	[c=4 l=3]  *extendsidi2_rex64/1
+	cmpb	$0, 1080(%rbx,%rdx)	# 3698	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L799	# 3699	[c=13 l=6]  *jcc
+.L798:
+	movq	1040(%rbx), %rdx	# 3703	[c=9 l=7]  *movdi_internal/3
+	movzbl	(%rdx,%rax), %eax	# 3704	[c=13 l=4]  *zero_extendqisi2/0
+.L800:
+	cmpl	$15, %ebp	# 3718	[c=4 l=3]  *cmpsi_1/0
+	jle	.L1824	# 3719	[c=13 l=6]  *jcc
+	movb	%al, 1004(%rbx,%rbp)	# 3732	[c=4 l=7]  *movqi_internal/8
+	movl	(%rbx), %ebp	# 3733	[c=6 l=2]  *zero_extendsidi2/3
+	movq	%rbp, %rdx	# 16586	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbp	# 3735	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %rbp	# 3737	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%rbp), %eax	# 3738	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%edx, %eax	# 3739	[c=4 l=2]  *addsi_1/0
+	movl	%eax, (%rbx)	# 3740	[c=4 l=2]  *movsi_internal/1
+	jmp	*0(%rbp)	# 17879	[c=5 l=3]  *indirect_jump
+.L802:
+	movzbl	10(%rbp), %ecx	# 3746	[c=13 l=4]  zero_extendqidi2/0
+	cmpl	$15, %ecx	# 3749	[c=4 l=3]  *cmpsi_1/0
+	jle	.L1825	# 3750	[c=13 l=6]  *jcc
+	movzbl	1004(%rbx,%rcx), %edx	# 3763	[c=10 l=8]  *movqi_internal/4
+	leal	1(%rdx), %eax	# 16181	[c=4 l=3]  *leasi
+	addl	$1, %edx	# 16182	[c=4 l=3]  *addsi_1/0
+	movb	%dl, 1004(%rbx,%rcx)	# 3769	[c=4 l=7]  *movqi_internal/8
+	movzbl	100(%rbx), %edx	# 3770	[c=9 l=4]  *movqi_internal/4
+	movzbl	%al, %eax	# 3766	[c=4 l=3]  zero_extendqidi2/0
+	movl	%edx, %ecx	# 15141	[c=4 l=2]  *movsi_internal/0
+	andl	$225, %ecx	# 3773	[c=4 l=6]  *andsi_2/0
+	jne	.L804	# 3774	[c=13 l=6]  *jcc
+	leaq	flag_update_table_inc(%rip), %rdx	# 3777	[c=1 l=7]  *movdi_internal/4
+	addq	%rdx, %rax	# 3778	[c=4 l=3]  *adddi_1/0
+	movl	$30, %edx	# 18	[c=4 l=5]  *movqi_internal/3
+.L805:
+	movl	(%rbx), %ebp	# 3797	[c=6 l=2]  *zero_extendsidi2/3
+	movb	%dl, 100(%rbx)	# 3796	[c=4 l=3]  *movqi_internal/8
+	movq	%rax, 104(%rbx)	# 3795	[c=4 l=4]  *movdi_internal/5
+	movq	%rbp, %rdx	# 16587	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbp	# 3799	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %rbp	# 3801	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%rbp), %eax	# 3802	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%edx, %eax	# 3803	[c=4 l=2]  *addsi_1/0
+	movl	%eax, (%rbx)	# 3804	[c=4 l=2]  *movsi_internal/1
+	jmp	*0(%rbp)	# 17877	[c=5 l=3]  *indirect_jump
+.L806:
+	movl	$2, 96(%rbx)	# 3810	[c=4 l=7]  *movsi_internal/1
+	movzbl	10(%rbp), %esi	# 3811	[c=13 l=4]  *zero_extendqisi2/0
+	movzwl	12(%rbp), %eax	# 3813	[c=13 l=4]  *zero_extendhisi2/0
+	sall	$16, %esi	# 3812	[c=4 l=3]  *ashlsi3_1/0
+	orl	%eax, %esi	# 3814	[c=4 l=2]  *iorsi_1/0
+	movl	%esi, (%rbx)	# 3815	[c=4 l=2]  *movsi_internal/1
+	cmpl	%esi, 992(%rbx)	# 3816	[c=13 l=6]  *cmpsi_1/0
+	jb	.L1826	# 3817	[c=13 l=6]  *jcc
+	leaq	-1(%r13), %rax	# 16178	[c=4 l=4]  *leadi
+	cmpq	%r12, %rax	# 3826	[c=4 l=3]  *cmpdi_1/0
+	jb	.L612	# 3827	[c=13 l=6]  *jcc
+	movq	56(%rbx), %rax	# 15143	[c=9 l=4]  *movdi_internal/3
+	cmpq	%rax, 48(%rbx)	# 3830	[c=13 l=4]  *cmpdi_1/0
+	jnb	.L1827	# 3831	[c=13 l=6]  *jcc
+.L808:
+	movl	(%rbx), %ebp	# 3838	[c=6 l=2]  *zero_extendsidi2/3
+	movl	$1, 96(%rbx)	# 3843	[c=4 l=7]  *movsi_internal/1
+	movq	%rbp, %rdx	# 16588	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbp	# 3840	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %rbp	# 3842	[c=13 l=7]  *adddi_1/1
+	movzbl	11(%rbp), %eax	# 3844	[c=13 l=4]  zero_extendqidi2/0
+	addq	%rax, %r12	# 3845	[c=4 l=3]  *adddi_1/0
+	movzwl	14(%rbp), %eax	# 3847	[c=13 l=4]  zero_extendhidi2/0
+	addq	%rax, 48(%rbx)	# 3848	[c=13 l=4]  *adddi_1/0
+	movq	%r12, 40(%rbx)	# 3846	[c=4 l=4]  *movdi_internal/5
+	movzbl	9(%rbp), %eax	# 3849	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%edx, %eax	# 3850	[c=4 l=2]  *addsi_1/0
+	movl	%eax, (%rbx)	# 3851	[c=4 l=2]  *movsi_internal/1
+	jmp	*0(%rbp)	# 17874	[c=5 l=3]  *indirect_jump
+.L588:
+	movzbl	10(%rbp), %ecx	# 728	[c=13 l=4]  zero_extendqidi2/0
+	movzwl	12(%rbp), %edx	# 727	[c=13 l=4]  zero_extendhidi2/0
+	cmpl	$15, %ecx	# 731	[c=4 l=3]  *cmpsi_1/0
+	jle	.L1828	# 732	[c=13 l=6]  *jcc
+	movzbl	1004(%rbx,%rcx), %esi	# 745	[c=14 l=8]  *zero_extendqisi2/0
+	movl	%esi, %eax	# 16541	[c=4 l=2]  *movsi_internal/0
+	cmpl	$15, %edx	# 749	[c=4 l=3]  *cmpsi_1/0
+	jle	.L1829	# 750	[c=13 l=6]  *jcc
+	movzbl	1004(%rbx,%rdx), %edx	# 763	[c=14 l=8]  *zero_extendqisi2/0
+	andl	$136, %eax	# 768	[c=4 l=5]  *andsi_1/0
+	leal	(%rdx,%rsi), %edi	# 16268	[c=4 l=3]  *leasi
+	movb	%dil, 1004(%rbx,%rcx)	# 766	[c=4 l=8]  *movqi_internal/8
+	movl	%edx, %ecx	# 14985	[c=4 l=2]  *movsi_internal/0
+	addl	%esi, %edx	# 776	[c=4 l=2]  *addsi_1/0
+	andl	$136, %ecx	# 771	[c=4 l=6]  *andsi_1/0
+	leal	(%rcx,%rax,2), %eax	# 772	[c=8 l=3]  *leasi
+	imull	$260, %eax, %eax	# 773	[c=12 l=6]  *mulsi3_1/1
+	andl	$7680, %eax	# 774	[c=4 l=5]  *andsi_1/0
+	orl	%edx, %eax	# 777	[c=5 l=2]  *iorsi_1_zext
+	movzbl	100(%rbx), %edx	# 778	[c=9 l=4]  *movqi_internal/4
+	movl	%edx, %ecx	# 14987	[c=4 l=2]  *movsi_internal/0
+	andl	$192, %ecx	# 781	[c=4 l=6]  *andsi_2/0
+	jne	.L591	# 782	[c=13 l=6]  *jcc
+	leaq	flag_update_table_add8(%rip), %rdx	# 785	[c=1 l=7]  *movdi_internal/4
+	addq	%rdx, %rax	# 786	[c=4 l=3]  *adddi_1/0
+	movl	$63, %edx	# 5	[c=4 l=5]  *movqi_internal/3
+.L592:
+	movl	(%rbx), %ebp	# 805	[c=6 l=2]  *zero_extendsidi2/3
+	movb	%dl, 100(%rbx)	# 804	[c=4 l=3]  *movqi_internal/8
+	movq	%rax, 104(%rbx)	# 803	[c=4 l=4]  *movdi_internal/5
+	movq	%rbp, %rdx	# 16542	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbp	# 807	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %rbp	# 809	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%rbp), %eax	# 810	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%edx, %eax	# 811	[c=4 l=2]  *addsi_1/0
+	movl	%eax, (%rbx)	# 812	[c=4 l=2]  *movsi_internal/1
+	jmp	*0(%rbp)	# 18004	[c=5 l=3]  *indirect_jump
+.L950:
+	movl	5176(%rbx), %r15d	# 5742	[c=9 l=7]  *movsi_internal/0
+	movl	$61, %eax	# 5744	[c=4 l=5]  *movsi_internal/0
+	movl	5180(%rbx), %edx	# 5743	[c=9 l=6]  *movsi_internal/0
+	movl	$2, 96(%rbx)	# 5741	[c=4 l=7]  *movsi_internal/1
+	subl	%r15d, %eax	# 5745	[c=4 l=3]  *subsi_1/0
+	cmpl	%edx, %eax	# 5746	[c=4 l=2]  *cmpsi_1/0
+	jb	.L951	# 5747	[c=13 l=6]  *jcc
+	cmpb	$1, 1081(%rbx)	# 5751	[c=13 l=7]  *cmpqi_1/0
+	ja	.L1830	# 5752	[c=13 l=6]  *jcc
+	movq	1040(%rbx), %rax	# 13590	[c=9 l=7]  *movdi_internal/3
+	movzbl	61(%rax), %ebp	# 13591	[c=13 l=4]  *zero_extendqisi2/0
+.L953:
+	movzbl	62(%rax), %eax	# 5789	[c=13 l=4]  *zero_extendqisi2/0
+.L955:
+	sall	$8, %eax	# 5792	[c=4 l=3]  *ashlsi3_1/0
+	xorl	%r14d, %r14d	# 17797	[c=4 l=3]  *movdi_xor
+	orl	%eax, %ebp	# 5793	[c=4 l=2]  *iorsi_1/0
+	cmpb	$0, 840(%rbx)	# 5794	[c=13 l=7]  *cmpqi_ccno_1/1
+	je	.L956	# 5795	[c=13 l=2]  *jcc
+	addl	$1, %ebp	# 5797	[c=4 l=3]  *addsi_1/0
+	movl	%ebp, %eax	# 15238	[c=4 l=2]  *movsi_internal/0
+	subl	%r15d, %eax	# 5798	[c=4 l=3]  *subsi_1/0
+	cmpl	%edx, %eax	# 5799	[c=4 l=2]  *cmpsi_1/0
+	jb	.L957	# 5800	[c=13 l=2]  *jcc
+	movl	%ebp, %eax	# 15240	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %eax	# 5802	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 14797	[c=5 l=5]  *andsi_1_zext
+	cmpb	$0, 1080(%rbx,%rax)	# 5805	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L958	# 5806	[c=13 l=6]  *jcc
+.L957:
+	movq	1040(%rbx), %rdx	# 5810	[c=9 l=7]  *movdi_internal/3
+	movslq	%ebp, %rax	# 5809	[c=4 l=3]  *extendsidi2_rex64/1
+	movzbl	(%rdx,%rax), %r14d	# 5811	[c=13 l=5]  *zero_extendqisi2/0
+.L959:
+	sall	$16, %r14d	# 5822	[c=4 l=4]  *ashlsi3_1/0
+.L956:
+	leal	1(%rbp), %esi	# 16148	[c=4 l=3]  *leasi
+	movl	%esi, %eax	# 15242	[c=4 l=2]  *movsi_internal/0
+	subl	5176(%rbx), %eax	# 5826	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %eax	# 5827	[c=13 l=6]  *cmpsi_1/1
+	jb	.L960	# 5828	[c=13 l=2]  *jcc
+	movl	%esi, %eax	# 15244	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %eax	# 5830	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 14796	[c=5 l=5]  *andsi_1_zext
+	cmpb	$0, 1080(%rbx,%rax)	# 5833	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L961	# 5834	[c=13 l=6]  *jcc
+.L960:
+	movq	1040(%rbx), %rax	# 5838	[c=9 l=7]  *movdi_internal/3
+	movslq	%esi, %rsi	# 5837	[c=4 l=3]  *extendsidi2_rex64/1
+	movzbl	(%rax,%rsi), %eax	# 5839	[c=13 l=4]  *zero_extendqisi2/0
+.L962:
+	sall	$8, %eax	# 5850	[c=4 l=3]  *ashlsi3_1/0
+	addl	$2, %ebp	# 5852	[c=4 l=3]  *addsi_1/0
+	orl	%r14d, %eax	# 5851	[c=4 l=3]  *iorsi_1/0
+	movl	%eax, %r15d	# 15247	[c=4 l=3]  *movsi_internal/0
+	movl	%ebp, %eax	# 15248	[c=4 l=2]  *movsi_internal/0
+	subl	5176(%rbx), %eax	# 5853	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %eax	# 5854	[c=13 l=6]  *cmpsi_1/1
+	jb	.L963	# 5855	[c=13 l=2]  *jcc
+	movl	%ebp, %eax	# 15250	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %eax	# 5857	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 14795	[c=5 l=5]  *andsi_1_zext
+	cmpb	$0, 1080(%rbx,%rax)	# 5860	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L964	# 5861	[c=13 l=6]  *jcc
+.L963:
+	movq	1040(%rbx), %rdx	# 5865	[c=9 l=7]  *movdi_internal/3
+	movslq	%ebp, %rax	# 5864	[c=4 l=3]  *extendsidi2_rex64/1
+	movzbl	(%rdx,%rax), %r14d	# 5866	[c=13 l=5]  *zero_extendqisi2/0
+.L965:
+	orl	%r15d, %r14d	# 5877	[c=4 l=3]  *iorsi_1/0
+	cmpl	%r14d, 992(%rbx)	# 5878	[c=13 l=7]  *cmpsi_1/0
+	jb	.L1831	# 5879	[c=13 l=6]  *jcc
+	movl	$61, %edx	# 5887	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%rbx), %edx	# 5888	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %edx	# 5889	[c=13 l=6]  *cmpsi_1/1
+	jb	.L967	# 5890	[c=13 l=2]  *jcc
+	cmpb	$1, 1081(%rbx)	# 5894	[c=13 l=7]  *cmpqi_1/0
+	ja	.L1832	# 5895	[c=13 l=6]  *jcc
+.L967:
+	movq	1040(%rbx), %rax	# 5906	[c=9 l=7]  *movdi_internal/3
+	movb	%bpl, 61(%rax)	# 5907	[c=4 l=4]  *movqi_internal/8
+.L968:
+	movl	%ebp, %eax	# 15252	[c=4 l=2]  *movsi_internal/0
+	movl	$62, %edx	# 5911	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%rbx), %edx	# 5912	[c=13 l=6]  *subsi_1/1
+	sarl	$8, %eax	# 5910	[c=4 l=3]  *ashrsi3_1/0
+	cmpl	5180(%rbx), %edx	# 5913	[c=13 l=6]  *cmpsi_1/1
+	jb	.L969	# 5914	[c=13 l=2]  *jcc
+	cmpb	$1, 1081(%rbx)	# 5918	[c=13 l=7]  *cmpqi_1/0
+	ja	.L1833	# 5919	[c=13 l=6]  *jcc
+.L969:
+	movq	1040(%rbx), %rdx	# 5930	[c=9 l=7]  *movdi_internal/3
+	movb	%al, 62(%rdx)	# 5931	[c=4 l=3]  *movqi_internal/8
+.L970:
+	movzbl	840(%rbx), %eax	# 5935	[c=13 l=7]  zero_extendqidi2/0
+	leaq	-1(%r13), %rdx	# 16147	[c=4 l=4]  *leadi
+	addq	48(%rbx), %rax	# 5937	[c=13 l=4]  *adddi_1/1
+	movl	%r14d, (%rbx)	# 5934	[c=4 l=3]  *movsi_internal/1
+	movq	%rax, 48(%rbx)	# 5938	[c=4 l=4]  *movdi_internal/5
+	cmpq	%r12, %rdx	# 5940	[c=4 l=3]  *cmpdi_1/0
+	jb	.L612	# 5941	[c=13 l=6]  *jcc
+	cmpq	56(%rbx), %rax	# 5943	[c=13 l=4]  *cmpdi_1/1
+	jnb	.L1834	# 5944	[c=13 l=6]  *jcc
+.L971:
+	movl	(%rbx), %ebp	# 5951	[c=6 l=2]  *zero_extendsidi2/3
+	movl	$1, 96(%rbx)	# 5956	[c=4 l=7]  *movsi_internal/1
+	movq	%rbp, %rdx	# 16625	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbp	# 5953	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %rbp	# 5955	[c=13 l=7]  *adddi_1/1
+	movzbl	11(%rbp), %eax	# 5957	[c=13 l=4]  zero_extendqidi2/0
+	addq	%rax, %r12	# 5958	[c=4 l=3]  *adddi_1/0
+	movzwl	14(%rbp), %eax	# 5960	[c=13 l=4]  zero_extendhidi2/0
+	addq	%rax, 48(%rbx)	# 5961	[c=13 l=4]  *adddi_1/0
+	movq	%r12, 40(%rbx)	# 5959	[c=4 l=4]  *movdi_internal/5
+	movzbl	9(%rbp), %eax	# 5962	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%edx, %eax	# 5963	[c=4 l=2]  *addsi_1/0
+	movl	%eax, (%rbx)	# 5964	[c=4 l=2]  *movsi_internal/1
+	jmp	*0(%rbp)	# 17794	[c=5 l=3]  *indirect_jump
+.L972:
+	movl	5176(%rbx), %r15d	# 5971	[c=9 l=7]  *movsi_internal/0
+	movl	$61, %eax	# 5973	[c=4 l=5]  *movsi_internal/0
+	movl	5180(%rbx), %edx	# 5972	[c=9 l=6]  *movsi_internal/0
+	movl	$2, 96(%rbx)	# 5970	[c=4 l=7]  *movsi_internal/1
+	subl	%r15d, %eax	# 5974	[c=4 l=3]  *subsi_1/0
+	cmpl	%edx, %eax	# 5975	[c=4 l=2]  *cmpsi_1/0
+	jb	.L973	# 5976	[c=13 l=6]  *jcc
+	cmpb	$1, 1081(%rbx)	# 5980	[c=13 l=7]  *cmpqi_1/0
+	ja	.L1835	# 5981	[c=13 l=6]  *jcc
+	movq	1040(%rbx), %rax	# 13596	[c=9 l=7]  *movdi_internal/3
+	movzbl	61(%rax), %ebp	# 13597	[c=13 l=4]  *zero_extendqisi2/0
+.L975:
+	movzbl	62(%rax), %eax	# 6018	[c=13 l=4]  *zero_extendqisi2/0
+.L977:
+	sall	$8, %eax	# 6021	[c=4 l=3]  *ashlsi3_1/0
+	xorl	%r14d, %r14d	# 17793	[c=4 l=3]  *movdi_xor
+	orl	%eax, %ebp	# 6022	[c=4 l=2]  *iorsi_1/0
+	cmpb	$0, 840(%rbx)	# 6023	[c=13 l=7]  *cmpqi_ccno_1/1
+	je	.L978	# 6024	[c=13 l=2]  *jcc
+	addl	$1, %ebp	# 6026	[c=4 l=3]  *addsi_1/0
+	movl	%ebp, %eax	# 15254	[c=4 l=2]  *movsi_internal/0
+	subl	%r15d, %eax	# 6027	[c=4 l=3]  *subsi_1/0
+	cmpl	%edx, %eax	# 6028	[c=4 l=2]  *cmpsi_1/0
+	jb	.L979	# 6029	[c=13 l=2]  *jcc
+	movl	%ebp, %eax	# 15256	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %eax	# 6031	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 14794	[c=5 l=5]  *andsi_1_zext
+	cmpb	$0, 1080(%rbx,%rax)	# 6034	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L980	# 6035	[c=13 l=6]  *jcc
+.L979:
+	movq	1040(%rbx), %rdx	# 6039	[c=9 l=7]  *movdi_internal/3
+	movslq	%ebp, %rax	# 6038	[c=4 l=3]  *extendsidi2_rex64/1
+	movzbl	(%rdx,%rax), %r14d	# 6040	[c=13 l=5]  *zero_extendqisi2/0
+.L981:
+	sall	$16, %r14d	# 6051	[c=4 l=4]  *ashlsi3_1/0
+.L978:
+	leal	1(%rbp), %esi	# 16146	[c=4 l=3]  *leasi
+	movl	%esi, %eax	# 15258	[c=4 l=2]  *movsi_internal/0
+	subl	5176(%rbx), %eax	# 6055	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %eax	# 6056	[c=13 l=6]  *cmpsi_1/1
+	jb	.L982	# 6057	[c=13 l=2]  *jcc
+	movl	%esi, %eax	# 15260	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %eax	# 6059	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 14793	[c=5 l=5]  *andsi_1_zext
+	cmpb	$0, 1080(%rbx,%rax)	# 6062	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L983	# 6063	[c=13 l=6]  *jcc
+.L982:
+	movq	1040(%rbx), %rax	# 6067	[c=9 l=7]  *movdi_internal/3
+	movslq	%esi, %rsi	# 6066	[c=4 l=3]  *extendsidi2_rex64/1
+	movzbl	(%rax,%rsi), %eax	# 6068	[c=13 l=4]  *zero_extendqisi2/0
+.L984:
+	sall	$8, %eax	# 6079	[c=4 l=3]  *ashlsi3_1/0
+	addl	$2, %ebp	# 6081	[c=4 l=3]  *addsi_1/0
+	orl	%r14d, %eax	# 6080	[c=4 l=3]  *iorsi_1/0
+	movl	%eax, %r15d	# 15263	[c=4 l=3]  *movsi_internal/0
+	movl	%ebp, %eax	# 15264	[c=4 l=2]  *movsi_internal/0
+	subl	5176(%rbx), %eax	# 6082	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %eax	# 6083	[c=13 l=6]  *cmpsi_1/1
+	jb	.L985	# 6084	[c=13 l=2]  *jcc
+	movl	%ebp, %eax	# 15266	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %eax	# 6086	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 14792	[c=5 l=5]  *andsi_1_zext
+	cmpb	$0, 1080(%rbx,%rax)	# 6089	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L986	# 6090	[c=13 l=6]  *jcc
+.L985:
+	movq	1040(%rbx), %rdx	# 6094	[c=9 l=7]  *movdi_internal/3
+	movslq	%ebp, %rax	# 6093	[c=4 l=3]  *extendsidi2_rex64/1
+	movzbl	(%rdx,%rax), %r14d	# 6095	[c=13 l=5]  *zero_extendqisi2/0
+.L987:
+	orl	%r15d, %r14d	# 6106	[c=4 l=3]  *iorsi_1/0
+	cmpl	%r14d, 992(%rbx)	# 6107	[c=13 l=7]  *cmpsi_1/0
+	jb	.L1836	# 6108	[c=13 l=6]  *jcc
+	movl	$61, %edx	# 6116	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%rbx), %edx	# 6117	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %edx	# 6118	[c=13 l=6]  *cmpsi_1/1
+	jb	.L989	# 6119	[c=13 l=2]  *jcc
+	cmpb	$1, 1081(%rbx)	# 6123	[c=13 l=7]  *cmpqi_1/0
+	ja	.L1837	# 6124	[c=13 l=6]  *jcc
+.L989:
+	movq	1040(%rbx), %rax	# 6135	[c=9 l=7]  *movdi_internal/3
+	movb	%bpl, 61(%rax)	# 6136	[c=4 l=4]  *movqi_internal/8
+.L990:
+	movl	%ebp, %eax	# 15268	[c=4 l=2]  *movsi_internal/0
+	movl	$62, %edx	# 6140	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%rbx), %edx	# 6141	[c=13 l=6]  *subsi_1/1
+	sarl	$8, %eax	# 6139	[c=4 l=3]  *ashrsi3_1/0
+	cmpl	5180(%rbx), %edx	# 6142	[c=13 l=6]  *cmpsi_1/1
+	jb	.L991	# 6143	[c=13 l=2]  *jcc
+	cmpb	$1, 1081(%rbx)	# 6147	[c=13 l=7]  *cmpqi_1/0
+	ja	.L1838	# 6148	[c=13 l=6]  *jcc
+.L991:
+	movq	1040(%rbx), %rdx	# 6159	[c=9 l=7]  *movdi_internal/3
+	movb	%al, 62(%rdx)	# 6160	[c=4 l=3]  *movqi_internal/8
+.L992:
+	movq	104(%rbx), %rcx	# 6171	[c=9 l=4]  *movdi_internal/3
+	movzbl	100(%rbx), %eax	# 6168	[c=13 l=4]  *zero_extendqisi2/0
+	movl	%r14d, (%rbx)	# 6163	[c=4 l=3]  *movsi_internal/1
+	movzbl	840(%rbx), %edx	# 6164	[c=13 l=7]  zero_extendqidi2/0
+	addq	48(%rbx), %rdx	# 6166	[c=13 l=4]  *adddi_1/1
+	movq	%rdx, 48(%rbx)	# 6167	[c=4 l=4]  *movdi_internal/5
+	movzbl	(%rcx), %edi	# 17791	[c=5 l=3]  *movqi_internal/4
+	andb	$127, %al	# 16139	[c=4 l=2]  *andqi_1_slp/0
+	movq	%rdx, 6024(%rbx)	# 6179	[c=4 l=7]  *movdi_internal/5
+	andl	%eax, %edi	# 18867	[c=4 l=2]  *andsi_1/0
+	orl	$-128, %eax	# 16143	[c=4 l=3]  *iorsi_1/0
+	movb	%al, 100(%rbx)	# 6176	[c=4 l=3]  *movqi_internal/8
+	movl	%edi, %ecx	# 15271	[c=4 l=2]  *movqi_internal/1
+	leaq	101(%rbx), %rax	# 16144	[c=4 l=4]  *leadi
+	movq	%rax, 104(%rbx)	# 6178	[c=4 l=4]  *movdi_internal/5
+	orl	$-128, %ecx	# 16142	[c=4 l=3]  *iorsi_1/0
+	leaq	-1(%r13), %rax	# 16145	[c=4 l=4]  *leadi
+	movb	%cl, 101(%rbx)	# 6174	[c=4 l=3]  *movqi_internal/8
+	cmpq	%r12, %rax	# 6181	[c=4 l=3]  *cmpdi_1/0
+	jb	.L612	# 6182	[c=13 l=6]  *jcc
+	cmpq	56(%rbx), %rdx	# 6184	[c=13 l=4]  *cmpdi_1/1
+	jnb	.L1839	# 6185	[c=13 l=6]  *jcc
+.L993:
+	movl	(%rbx), %ebp	# 6192	[c=6 l=2]  *zero_extendsidi2/3
+	movl	$1, 96(%rbx)	# 6197	[c=4 l=7]  *movsi_internal/1
+	movq	%rbp, %rdx	# 16626	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbp	# 6194	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %rbp	# 6196	[c=13 l=7]  *adddi_1/1
+	movzbl	11(%rbp), %eax	# 6198	[c=13 l=4]  zero_extendqidi2/0
+	addq	%rax, %r12	# 6199	[c=4 l=3]  *adddi_1/0
+	movzwl	14(%rbp), %eax	# 6201	[c=13 l=4]  zero_extendhidi2/0
+	addq	%rax, 48(%rbx)	# 6202	[c=13 l=4]  *adddi_1/0
+	movq	%r12, 40(%rbx)	# 6200	[c=4 l=4]  *movdi_internal/5
+	movzbl	9(%rbp), %eax	# 6203	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%edx, %eax	# 6204	[c=4 l=2]  *addsi_1/0
+	movl	%eax, (%rbx)	# 6205	[c=4 l=2]  *movsi_internal/1
+	jmp	*0(%rbp)	# 17788	[c=5 l=3]  *indirect_jump
+.L994:
+	movswl	12(%rbp), %eax	# 6212	[c=13 l=4]  extendhisi2/1
+	movl	$2, 96(%rbx)	# 6211	[c=4 l=7]  *movsi_internal/1
+	cmpw	$-1, %ax	# 6213	[c=4 l=4]  *cmphi_1/0
+	je	.L1840	# 6214	[c=13 l=6]  *jcc
+	addl	(%rbx), %eax	# 6227	[c=9 l=2]  *addsi_1/1
+	andl	992(%rbx), %eax	# 6230	[c=13 l=6]  *andsi_1/1
+	movl	%eax, (%rbx)	# 6231	[c=4 l=2]  *movsi_internal/1
+	leaq	-1(%r13), %rax	# 16138	[c=4 l=4]  *leadi
+	cmpq	%r12, %rax	# 6233	[c=4 l=3]  *cmpdi_1/0
+	jb	.L612	# 6234	[c=13 l=6]  *jcc
+	movq	56(%rbx), %rax	# 15272	[c=9 l=4]  *movdi_internal/3
+	cmpq	%rax, 48(%rbx)	# 6237	[c=13 l=4]  *cmpdi_1/0
+	jnb	.L1841	# 6238	[c=13 l=6]  *jcc
+.L996:
+	movl	(%rbx), %ebp	# 6245	[c=6 l=2]  *zero_extendsidi2/3
+	movl	$1, 96(%rbx)	# 6250	[c=4 l=7]  *movsi_internal/1
+	movq	%rbp, %rdx	# 16627	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbp	# 6247	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %rbp	# 6249	[c=13 l=7]  *adddi_1/1
+	movzbl	11(%rbp), %eax	# 6251	[c=13 l=4]  zero_extendqidi2/0
+	addq	%rax, %r12	# 6252	[c=4 l=3]  *adddi_1/0
+	movzwl	14(%rbp), %eax	# 6254	[c=13 l=4]  zero_extendhidi2/0
+	addq	%rax, 48(%rbx)	# 6255	[c=13 l=4]  *adddi_1/0
+	movq	%r12, 40(%rbx)	# 6253	[c=4 l=4]  *movdi_internal/5
+	movzbl	9(%rbp), %eax	# 6256	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%edx, %eax	# 6257	[c=4 l=2]  *addsi_1/0
+	movl	%eax, (%rbx)	# 6258	[c=4 l=2]  *movsi_internal/1
+	jmp	*0(%rbp)	# 17783	[c=5 l=3]  *indirect_jump
+.L997:
+	movzbl	100(%rbx), %esi	# 6265	[c=13 l=4]  *zero_extendqisi2/0
+	movq	1040(%rbx), %rax	# 6268	[c=9 l=7]  *movdi_internal/3
+	movq	104(%rbx), %rdi	# 6267	[c=9 l=4]  *movdi_internal/3
+	movzbl	10(%rbp), %r8d	# 6264	[c=13 l=5]  zero_extendqidi2/0
+	movzbl	63(%rax), %eax	# 6269	[c=13 l=4]  *zero_extendqisi2/0
+	movl	%esi, %edx	# 15273	[c=4 l=2]  *movsi_internal/0
+	movl	%esi, %ecx	# 16628	[c=4 l=2]  *movsi_internal/0
+	notl	%edx	# 6270	[c=4 l=2]  *one_cmplsi2_1/0
+	andl	%edx, %eax	# 6271	[c=4 l=2]  *andsi_1/0
+	movzbl	(%rdi), %edx	# 17781	[c=5 l=3]  *movqi_internal/4
+	andl	%esi, %edx	# 18864	[c=4 l=2]  *andsi_1/0
+	movzbl	%dl, %edx	# 6273	[c=4 l=3]  *zero_extendqisi2/0
+	orl	%edx, %eax	# 6274	[c=4 l=2]  *iorsi_1/0
+	sall	$8, %eax	# 6275	[c=4 l=3]  *ashlsi3_1/0
+	andl	$256, %eax	# 6276	[c=4 l=5]  *andsi_1/0
+	cmpl	$15, %r8d	# 6279	[c=4 l=4]  *cmpsi_1/0
+	jle	.L1842	# 6280	[c=13 l=6]  *jcc
+	movzbl	1004(%rbx,%r8), %edx	# 6293	[c=14 l=9]  *zero_extendqisi2/0
+	orl	%edx, %eax	# 6294	[c=4 l=2]  *iorsi_1/0
+	movl	%eax, %edx	# 15277	[c=4 l=2]  *movsi_internal/0
+	sarl	%edx	# 6296	[c=4 l=2]  *ashrsi3_1/0
+	andl	$-32, %esi	# 6299	[c=4 l=3]  *andsi_2/0
+	movb	%dl, 1004(%rbx,%r8)	# 6297	[c=4 l=8]  *movqi_internal/8
+	movl	%esi, %edx	# 15280	[c=4 l=2]  *movsi_internal/0
+	jne	.L999	# 6300	[c=13 l=6]  *jcc
+	cltq	# 6302	[c=4 l=2]  *extendsidi2_rex64/0
+	leaq	flag_update_table_ror8(%rip), %rdx	# 6303	[c=1 l=7]  *movdi_internal/4
+	movl	$31, %ecx	# 26	[c=4 l=5]  *movqi_internal/3
+	addq	%rdx, %rax	# 6304	[c=4 l=3]  *adddi_1/0
+.L1000:
+	movl	(%rbx), %ebp	# 6322	[c=6 l=2]  *zero_extendsidi2/3
+	movq	%rax, 104(%rbx)	# 6320	[c=4 l=4]  *movdi_internal/5
+	movb	%cl, 100(%rbx)	# 6321	[c=4 l=3]  *movqi_internal/8
+	movq	%rbp, %rdx	# 16629	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbp	# 6324	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %rbp	# 6326	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%rbp), %eax	# 6327	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%edx, %eax	# 6328	[c=4 l=2]  *addsi_1/0
+	movl	%eax, (%rbx)	# 6329	[c=4 l=2]  *movsi_internal/1
+	jmp	*0(%rbp)	# 17779	[c=5 l=3]  *indirect_jump
+.L1006:
+	movzwl	12(%rbp), %r15d	# 6510	[c=13 l=5]  *zero_extendhisi2/0
+	movzbl	10(%rbp), %ebp	# 6511	[c=13 l=4]  *zero_extendqisi2/0
+	movl	%ebp, %eax	# 15291	[c=4 l=2]  *movsi_internal/0
+	movl	%ebp, %r14d	# 16638	[c=4 l=3]  *movsi_internal/0
+	subl	5176(%rbx), %eax	# 6514	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %eax	# 6515	[c=13 l=6]  *cmpsi_1/1
+	jb	.L1007	# 6516	[c=13 l=2]  *jcc
+	movl	%ebp, %eax	# 15293	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %eax	# 6518	[c=4 l=3]  *ashrsi3_1/0
+	cltq	# 6519	[c=4 l=2]  *extendsidi2_rex64/0
+	cmpb	$0, 1080(%rbx,%rax)	# 6520	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L1008	# 6521	[c=13 l=6]  *jcc
+.L1007:
+	movq	1040(%rbx), %rdx	# 6525	[c=9 l=7]  *movdi_internal/3
+	movzbl	%r14b, %eax	# 6524	[c=4 l=4]  zero_extendqidi2/0
+	movzbl	(%rdx,%rax), %eax	# 6526	[c=13 l=4]  *zero_extendqisi2/0
+.L1009:
+	cmpl	6564(%rbx), %ebp	# 6537	[c=13 l=6]  *cmpsi_1/1
+	jb	.L1843	# 6538	[c=13 l=6]  *jcc
+.L1010:
+	orl	%eax, %r15d	# 6547	[c=4 l=3]  *iorsi_1/0
+.L1011:
+	movl	%ebp, %eax	# 15295	[c=4 l=2]  *movsi_internal/0
+	subl	5176(%rbx), %eax	# 6550	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %eax	# 6551	[c=13 l=6]  *cmpsi_1/1
+	jb	.L1012	# 6552	[c=13 l=2]  *jcc
+	movl	%ebp, %eax	# 15297	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %eax	# 6554	[c=4 l=3]  *ashrsi3_1/0
+	cltq	# 6555	[c=4 l=2]  *extendsidi2_rex64/0
+	cmpb	$0, 1080(%rbx,%rax)	# 6556	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L1013	# 6557	[c=13 l=6]  *jcc
+.L1012:
+	movq	1040(%rbx), %rdx	# 6561	[c=9 l=7]  *movdi_internal/3
+	movzbl	%r14b, %eax	# 6560	[c=4 l=4]  zero_extendqidi2/0
+	movb	%r15b, (%rdx,%rax)	# 6562	[c=4 l=4]  *movqi_internal/8
+.L1014:
+	movl	(%rbx), %ebp	# 6573	[c=6 l=2]  *zero_extendsidi2/3
+	movq	%rbp, %rdx	# 16639	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbp	# 6575	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %rbp	# 6577	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%rbp), %eax	# 6578	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%edx, %eax	# 6579	[c=4 l=2]  *addsi_1/0
+	movl	%eax, (%rbx)	# 6580	[c=4 l=2]  *movsi_internal/1
+	jmp	*0(%rbp)	# 17769	[c=5 l=3]  *indirect_jump
+.L1015:
+	movl	$2, 96(%rbx)	# 6586	[c=4 l=7]  *movsi_internal/1
+	movzbl	10(%rbp), %esi	# 6588	[c=13 l=4]  zero_extendqidi2/0
+	movzwl	12(%rbp), %r14d	# 6587	[c=13 l=5]  *zero_extendhisi2/0
+	movl	%esi, %edx	# 15299	[c=4 l=2]  *movsi_internal/0
+	movq	%rsi, %rax	# 16640	[c=4 l=3]  *movdi_internal/3
+	subl	5176(%rbx), %edx	# 6590	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %edx	# 6591	[c=13 l=6]  *cmpsi_1/1
+	jb	.L1016	# 6592	[c=13 l=2]  *jcc
+	movl	%esi, %edx	# 15301	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %edx	# 6595	[c=4 l=3]  *ashrsi3_1/0
+	movslq	%edx, %rdx	# 6596	[c=4 l=3]  *extendsidi2_rex64/1
+	cmpb	$0, 1080(%rbx,%rdx)	# 6597	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L1017	# 6598	[c=13 l=6]  *jcc
+.L1016:
+	movq	1040(%rbx), %rdx	# 6602	[c=9 l=7]  *movdi_internal/3
+	movzbl	(%rdx,%rax), %eax	# 6603	[c=13 l=4]  *zero_extendqisi2/0
+.L1018:
+	testl	%eax, %r14d	# 6615	[c=4 l=3]  *testsi_1/0
+	je	.L1844	# 6616	[c=13 l=6]  *jcc
+.L1019:
+	leaq	-1(%r13), %rax	# 16125	[c=4 l=4]  *leadi
+	cmpq	%r12, %rax	# 6628	[c=4 l=3]  *cmpdi_1/0
+	jb	.L612	# 6629	[c=13 l=6]  *jcc
+	movq	56(%rbx), %rax	# 15304	[c=9 l=4]  *movdi_internal/3
+	cmpq	%rax, 48(%rbx)	# 6632	[c=13 l=4]  *cmpdi_1/0
+	jnb	.L1845	# 6633	[c=13 l=6]  *jcc
+.L1020:
+	movl	(%rbx), %ebp	# 6640	[c=6 l=2]  *zero_extendsidi2/3
+	movl	$1, 96(%rbx)	# 6645	[c=4 l=7]  *movsi_internal/1
+	movq	%rbp, %rdx	# 16641	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbp	# 6642	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %rbp	# 6644	[c=13 l=7]  *adddi_1/1
+	movzbl	11(%rbp), %eax	# 6646	[c=13 l=4]  zero_extendqidi2/0
+	addq	%rax, %r12	# 6647	[c=4 l=3]  *adddi_1/0
+	movzwl	14(%rbp), %eax	# 6649	[c=13 l=4]  zero_extendhidi2/0
+	addq	%rax, 48(%rbx)	# 6650	[c=13 l=4]  *adddi_1/0
+	movq	%r12, 40(%rbx)	# 6648	[c=4 l=4]  *movdi_internal/5
+	movzbl	9(%rbp), %eax	# 6651	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%edx, %eax	# 6652	[c=4 l=2]  *addsi_1/0
+	movl	%eax, (%rbx)	# 6653	[c=4 l=2]  *movsi_internal/1
+	jmp	*0(%rbp)	# 17766	[c=5 l=3]  *indirect_jump
+.L1001:
+	movzbl	10(%rbp), %ecx	# 6336	[c=13 l=4]  *zero_extendqisi2/0
+	movzwl	12(%rbp), %edx	# 6335	[c=13 l=4]  zero_extendhidi2/0
+	cmpl	$15, %ecx	# 6339	[c=4 l=3]  *cmpsi_1/0
+	jle	.L1846	# 6340	[c=13 l=6]  *jcc
+	movslq	%ecx, %rsi	# 6352	[c=4 l=3]  *extendsidi2_rex64/1
+	movzbl	1004(%rbx,%rsi), %eax	# 6353	[c=14 l=8]  *zero_extendqisi2/0
+	movl	%eax, %ebp	# 16630	[c=4 l=2]  *movsi_internal/0
+	cmpl	$15, %edx	# 6357	[c=4 l=3]  *cmpsi_1/0
+	jle	.L1847	# 6358	[c=13 l=6]  *jcc
+	movzbl	100(%rbx), %ecx	# 6373	[c=13 l=4]  *zero_extendqisi2/0
+	movzbl	1004(%rbx,%rdx), %edx	# 6371	[c=14 l=8]  *zero_extendqisi2/0
+	andl	$136, %ebp	# 6389	[c=4 l=6]  *andsi_1/0
+	movq	104(%rbx), %r11	# 6376	[c=9 l=4]  *movdi_internal/3
+	movq	1040(%rbx), %r9	# 6372	[c=9 l=7]  *movdi_internal/3
+	movl	%edx, %r10d	# 16632	[c=4 l=3]  *movsi_internal/0
+	movl	%ecx, %r8d	# 15281	[c=4 l=3]  *movsi_internal/0
+	subl	%edx, %eax	# 6378	[c=4 l=2]  *subsi_1/0
+	movl	%ecx, %edi	# 16631	[c=4 l=2]  *movsi_internal/0
+	movzbl	63(%r9), %edx	# 6379	[c=13 l=5]  *zero_extendqisi2/0
+	movzbl	(%r11), %r14d	# 17774	[c=5 l=4]  *movqi_internal/4
+	notl	%r8d	# 6375	[c=4 l=3]  *one_cmplsi2_1/0
+	andl	$136, %r10d	# 6392	[c=4 l=7]  *andsi_1/0
+	andl	%ecx, %r14d	# 18863	[c=4 l=3]  *andsi_1/0
+	andl	%r8d, %edx	# 6380	[c=4 l=3]  *andsi_1/0
+	andl	$-64, %ecx	# 6395	[c=4 l=3]  *andsi_1/0
+	orl	%r14d, %edx	# 6383	[c=4 l=3]  *iorsi_1/0
+	andl	$1, %edx	# 6384	[c=4 l=3]  *andsi_1/0
+	subl	%edx, %eax	# 6385	[c=4 l=2]  *subsi_1/0
+	leal	(%r10,%rbp,2), %edx	# 6393	[c=8 l=4]  *leasi
+	imull	$260, %edx, %edx	# 6398	[c=12 l=6]  *mulsi3_1/1
+	movb	%al, 1004(%rbx,%rsi)	# 6387	[c=4 l=7]  *movqi_internal/8
+	movl	(%rbx), %ebp	# 6418	[c=6 l=2]  *zero_extendsidi2/3
+	andl	$511, %eax	# 6400	[c=4 l=5]  *andsi_1/0
+	movzbl	(%r11), %esi	# 6394	[c=5 l=4]  *movqi_internal/4
+	andl	$7680, %edx	# 6399	[c=4 l=6]  *andsi_1/0
+	andl	%esi, %edi	# 16131	[c=4 l=2]  *andsi_1/0
+	andl	%ecx, %esi	# 16132	[c=4 l=2]  *andsi_1/0
+	orl	$63, %ecx	# 16134	[c=4 l=3]  *iorsi_1/0
+	orl	%eax, %edx	# 6401	[c=5 l=2]  *iorsi_1_zext
+	movzbl	63(%r9), %eax	# 6404	[c=13 l=5]  *zero_extendqisi2/0
+	movb	%cl, 100(%rbx)	# 6415	[c=4 l=3]  *movqi_internal/8
+	andl	%r8d, %eax	# 6405	[c=4 l=3]  *andsi_1/0
+	orl	%edi, %eax	# 6408	[c=4 l=2]  *iorsi_1/0
+	leaq	flag_update_table_sub8(%rip), %rdi	# 14840	[c=1 l=7]  *movdi_internal/4
+	orl	$-3, %eax	# 6409	[c=4 l=3]  *iorsi_1/0
+	andb	(%rdi,%rdx), %al	# 6410	[c=13 l=3]  *andqi_1/1
+	movq	%rbp, %rdx	# 16633	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbp	# 6420	[c=4 l=4]  *ashldi3_1/0
+	orl	%esi, %eax	# 16133	[c=4 l=2]  *iorsi_1/0
+	addq	1064(%rbx), %rbp	# 6422	[c=13 l=7]  *adddi_1/1
+	movb	%al, 101(%rbx)	# 6413	[c=4 l=3]  *movqi_internal/8
+	leaq	101(%rbx), %rax	# 16135	[c=4 l=4]  *leadi
+	movq	%rax, 104(%rbx)	# 6417	[c=4 l=4]  *movdi_internal/5
+	movzbl	9(%rbp), %eax	# 6423	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%edx, %eax	# 6424	[c=4 l=2]  *addsi_1/0
+	movl	%eax, (%rbx)	# 6425	[c=4 l=2]  *movsi_internal/1
+	jmp	*0(%rbp)	# 17776	[c=5 l=3]  *indirect_jump
+.L566:
+	movzbl	100(%rbx), %edx	# 415	[c=13 l=4]  *zero_extendqisi2/0
+	movl	$2, 96(%rbx)	# 413	[c=4 l=7]  *movsi_internal/1
+	movzbl	10(%rbp), %eax	# 414	[c=9 l=4]  *movqi_internal/4
+	testb	%dl, %dl	# 416	[c=4 l=2]  *cmpqi_ccno_1/0
+	jne	.L1848	# 417	[c=13 l=6]  *jcc
+.L567:
+	subl	$26, %eax	# 16273	[c=4 l=3]  *addsi_1/0
+	cmpb	$5, %al	# 435	[c=4 l=2]  *cmpqi_1/0
+	ja	.L568	# 436	[c=13 l=6]  *jcc
+	leaq	.L570(%rip), %rdx	# 438	[c=1 l=7]  *movdi_internal/4
+	movzbl	%al, %eax	# 437	[c=4 l=3]  zero_extendqidi2/0
+	movslq	(%rdx,%rax,4), %rax	# 440	[c=14 l=4]  *extendsidi2_rex64/1
+	addq	%rdx, %rax	# 442	[c=4 l=3]  *adddi_1/0
+	jmp	*%rax	# 443	[c=4 l=2]  *tablejump_1
+	.section	.rodata
+	.align 4
+	.align 4
+.L570:
+	.long	.L575-.L570
+	.long	.L574-.L570
+	.long	.L573-.L570
+	.long	.L572-.L570
+	.long	.L571-.L570
+	.long	.L569-.L570
+	.text
+.L892:
+	movzbl	10(%rbp), %ecx	# 5018	[c=13 l=4]  zero_extendqidi2/0
+	cmpl	$15, %ecx	# 5021	[c=4 l=3]  *cmpsi_1/0
+	jle	.L1849	# 5022	[c=13 l=6]  *jcc
+	movzbl	1004(%rbx,%rcx), %edx	# 5035	[c=14 l=8]  *zero_extendqisi2/0
+	movl	%edx, %eax	# 16616	[c=4 l=2]  *movsi_internal/0
+	negl	%edx	# 5037	[c=4 l=2]  *negsi_1
+	andl	$136, %eax	# 5041	[c=4 l=5]  *andsi_1/0
+	movb	%dl, 1004(%rbx,%rcx)	# 5039	[c=4 l=7]  *movqi_internal/8
+	andl	$511, %edx	# 5044	[c=4 l=6]  *andsi_1/0
+	imull	$260, %eax, %eax	# 5042	[c=12 l=6]  *mulsi3_1/1
+	andl	$7680, %eax	# 5043	[c=4 l=5]  *andsi_1/0
+	orl	%edx, %eax	# 5045	[c=5 l=2]  *iorsi_1_zext
+	movzbl	100(%rbx), %edx	# 5046	[c=9 l=4]  *movqi_internal/4
+	movl	%edx, %ecx	# 15204	[c=4 l=2]  *movsi_internal/0
+	andl	$192, %ecx	# 5049	[c=4 l=6]  *andsi_2/0
+	jne	.L894	# 5050	[c=13 l=6]  *jcc
+	leaq	flag_update_table_sub8(%rip), %rdx	# 5053	[c=1 l=7]  *movdi_internal/4
+	addq	%rdx, %rax	# 5054	[c=4 l=3]  *adddi_1/0
+	movl	$63, %edx	# 20	[c=4 l=5]  *movqi_internal/3
+.L895:
+	movl	(%rbx), %ebp	# 5073	[c=6 l=2]  *zero_extendsidi2/3
+	movb	%dl, 100(%rbx)	# 5072	[c=4 l=3]  *movqi_internal/8
+	movq	%rax, 104(%rbx)	# 5071	[c=4 l=4]  *movdi_internal/5
+	movq	%rbp, %rdx	# 16617	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbp	# 5075	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %rbp	# 5077	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%rbp), %eax	# 5078	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%edx, %eax	# 5079	[c=4 l=2]  *addsi_1/0
+	movl	%eax, (%rbx)	# 5080	[c=4 l=2]  *movsi_internal/1
+	jmp	*0(%rbp)	# 17813	[c=5 l=3]  *indirect_jump
+.L896:
+	movl	(%rbx), %ebp	# 5086	[c=6 l=2]  *zero_extendsidi2/3
+	movq	%rbp, %rdx	# 16618	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbp	# 5088	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %rbp	# 5090	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%rbp), %eax	# 5091	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%edx, %eax	# 5092	[c=4 l=2]  *addsi_1/0
+	movl	%eax, (%rbx)	# 5093	[c=4 l=2]  *movsi_internal/1
+	jmp	*0(%rbp)	# 17812	[c=5 l=3]  *indirect_jump
+.L897:
+	movzbl	10(%rbp), %ecx	# 5100	[c=13 l=4]  zero_extendqidi2/0
+	movzwl	12(%rbp), %edx	# 5099	[c=13 l=4]  zero_extendhidi2/0
+	cmpl	$15, %ecx	# 5103	[c=4 l=3]  *cmpsi_1/0
+	jle	.L1850	# 5104	[c=13 l=6]  *jcc
+	movzbl	1004(%rbx,%rcx), %eax	# 5117	[c=10 l=8]  *movqi_internal/4
+	cmpl	$15, %edx	# 5120	[c=4 l=3]  *cmpsi_1/0
+	jle	.L1851	# 5121	[c=13 l=6]  *jcc
+	orb	1004(%rbx,%rdx), %al	# 5134	[c=14 l=7]  *iorqi_1/1
+	movb	%al, 1004(%rbx,%rcx)	# 5136	[c=4 l=7]  *movqi_internal/8
+	movzbl	100(%rbx), %edx	# 5137	[c=9 l=4]  *movqi_internal/4
+	movl	%edx, %ecx	# 15206	[c=4 l=2]  *movsi_internal/0
+	andl	$225, %ecx	# 5140	[c=4 l=6]  *andsi_2/0
+	jne	.L900	# 5141	[c=13 l=6]  *jcc
+	leaq	flag_update_table_logical(%rip), %rdx	# 5144	[c=1 l=7]  *movdi_internal/4
+	movzbl	%al, %eax	# 5143	[c=4 l=3]  zero_extendqidi2/0
+	addq	%rdx, %rax	# 5145	[c=4 l=3]  *adddi_1/0
+	movl	$30, %edx	# 21	[c=4 l=5]  *movqi_internal/3
+.L901:
+	movl	(%rbx), %ebp	# 5165	[c=6 l=2]  *zero_extendsidi2/3
+	movb	%dl, 100(%rbx)	# 5164	[c=4 l=3]  *movqi_internal/8
+	movq	%rax, 104(%rbx)	# 5163	[c=4 l=4]  *movdi_internal/5
+	movq	%rbp, %rdx	# 16619	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbp	# 5167	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %rbp	# 5169	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%rbp), %eax	# 5170	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%edx, %eax	# 5171	[c=4 l=2]  *addsi_1/0
+	movl	%eax, (%rbx)	# 5172	[c=4 l=2]  *movsi_internal/1
+	jmp	*0(%rbp)	# 17809	[c=5 l=3]  *indirect_jump
+.L902:
+	movzbl	10(%rbp), %ecx	# 5179	[c=13 l=4]  zero_extendqidi2/0
+	movzwl	12(%rbp), %edx	# 5178	[c=13 l=4]  *zero_extendhisi2/0
+	cmpl	$15, %ecx	# 5182	[c=4 l=3]  *cmpsi_1/0
+	jle	.L1852	# 5183	[c=13 l=6]  *jcc
+	movzbl	1004(%rbx,%rcx), %eax	# 5196	[c=14 l=8]  *zero_extendqisi2/0
+	orl	%edx, %eax	# 5197	[c=4 l=2]  *iorsi_1/0
+	movb	%al, 1004(%rbx,%rcx)	# 5199	[c=4 l=7]  *movqi_internal/8
+	movzbl	100(%rbx), %edx	# 5200	[c=9 l=4]  *movqi_internal/4
+	movl	%edx, %ecx	# 15208	[c=4 l=2]  *movsi_internal/0
+	andl	$225, %ecx	# 5203	[c=4 l=6]  *andsi_2/0
+	jne	.L904	# 5204	[c=13 l=6]  *jcc
+	leaq	flag_update_table_logical(%rip), %rdx	# 5207	[c=1 l=7]  *movdi_internal/4
+	cltq	# 5206	[c=4 l=2]  *extendsidi2_rex64/0
+	addq	%rdx, %rax	# 5208	[c=4 l=3]  *adddi_1/0
+	movl	$30, %edx	# 22	[c=4 l=5]  *movqi_internal/3
+.L905:
+	movl	(%rbx), %ebp	# 5227	[c=6 l=2]  *zero_extendsidi2/3
+	movb	%dl, 100(%rbx)	# 5226	[c=4 l=3]  *movqi_internal/8
+	movq	%rax, 104(%rbx)	# 5225	[c=4 l=4]  *movdi_internal/5
+	movq	%rbp, %rdx	# 16620	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbp	# 5229	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %rbp	# 5231	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%rbp), %eax	# 5232	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%edx, %eax	# 5233	[c=4 l=2]  *addsi_1/0
+	movl	%eax, (%rbx)	# 5234	[c=4 l=2]  *movsi_internal/1
+	jmp	*0(%rbp)	# 17807	[c=5 l=3]  *indirect_jump
+.L561:
+	movzwl	12(%rbp), %ecx	# 333	[c=13 l=4]  *zero_extendhisi2/0
+	movl	(%rbx), %eax	# 14971	[c=5 l=2]  *movsi_internal/0
+	movl	$2, 96(%rbx)	# 331	[c=4 l=7]  *movsi_internal/1
+	movzbl	10(%rbp), %edx	# 332	[c=9 l=4]  *movqi_internal/4
+	subl	%ecx, %eax	# 335	[c=4 l=2]  *subsi_1/0
+	movq	1056(%rbx), %rcx	# 339	[c=9 l=7]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 336	[c=4 l=2]  *movsi_internal/1
+	addl	%eax, %eax	# 337	[c=5 l=2]  *ashlsi3_1_zext/0
+	movzwl	(%rcx,%rax), %ecx	# 340	[c=13 l=4]  *zero_extendhisi2/0
+	cmpb	$1, %dl	# 341	[c=4 l=3]  *cmpqi_1/0
+	je	.L562	# 342	[c=13 l=6]  *jcc
+	cmpb	$2, %dl	# 344	[c=4 l=3]  *cmpqi_1/0
+	je	.L563	# 345	[c=13 l=6]  *jcc
+	testb	%dl, %dl	# 347	[c=4 l=2]  *cmpqi_ccno_1/0
+	je	.L1853	# 348	[c=13 l=6]  *jcc
+	leaq	.LC46(%rip), %rdx	# 383	[c=1 l=7]  *movdi_internal/4
+	movl	$8, %esi	# 385	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 386	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 18026	[c=4 l=2]  *movdi_xor
+	call	leave	# 388	[c=0 l=5]  *call
+.L1176:
+	movzbl	10(%rbp), %eax	# 9007	[c=13 l=4]  zero_extendqidi2/0
+	movzwl	12(%rbp), %ecx	# 9006	[c=13 l=4]  zero_extendhidi2/0
+	cmpl	$15, %eax	# 9010	[c=4 l=3]  *cmpsi_1/0
+	jle	.L1854	# 9011	[c=13 l=6]  *jcc
+	movzbl	1004(%rbx,%rax), %eax	# 9024	[c=14 l=8]  *zero_extendqisi2/0
+	movl	%eax, %edi	# 16697	[c=4 l=2]  *movsi_internal/0
+	cmpl	$15, %ecx	# 9028	[c=4 l=3]  *cmpsi_1/0
+	jle	.L1855	# 9029	[c=13 l=6]  *jcc
+	movq	104(%rbx), %rdx	# 9045	[c=9 l=4]  *movdi_internal/3
+	movzbl	100(%rbx), %r9d	# 9043	[c=13 l=5]  *zero_extendqisi2/0
+	andl	$136, %edi	# 9055	[c=4 l=6]  *andsi_1/0
+	movzbl	1004(%rbx,%rcx), %r8d	# 9042	[c=14 l=9]  *zero_extendqisi2/0
+	movzbl	(%rdx), %esi	# 9046	[c=5 l=3]  *movqi_internal/4
+	movq	1040(%rbx), %rdx	# 9047	[c=9 l=7]  *movdi_internal/3
+	movl	%r9d, %ecx	# 16698	[c=4 l=3]  *movsi_internal/0
+	movl	%r9d, %r10d	# 15439	[c=4 l=3]  *movsi_internal/0
+	notl	%r10d	# 9049	[c=4 l=3]  *one_cmplsi2_1/0
+	subl	%r8d, %eax	# 9064	[c=4 l=3]  *subsi_1/0
+	movzbl	63(%rdx), %edx	# 9048	[c=13 l=4]  *zero_extendqisi2/0
+	andl	%esi, %ecx	# 16076	[c=4 l=2]  *andsi_1/0
+	movzbl	%cl, %ecx	# 9052	[c=4 l=3]  *zero_extendqisi2/0
+	andl	%r10d, %edx	# 9050	[c=4 l=3]  *andsi_1/0
+	orl	%ecx, %edx	# 9053	[c=4 l=2]  *iorsi_1/0
+	movl	%r8d, %ecx	# 15441	[c=4 l=3]  *movsi_internal/0
+	andl	$136, %ecx	# 9058	[c=4 l=6]  *andsi_1/0
+	movl	%edx, %r8d	# 15445	[c=4 l=3]  *movsi_internal/0
+	orl	$-3, %edx	# 9073	[c=4 l=3]  *iorsi_1/0
+	leal	(%rcx,%rdi,2), %edi	# 9059	[c=8 l=3]  *leasi
+	andl	$1, %r8d	# 9065	[c=4 l=4]  *andsi_1/0
+	movl	%r9d, %ecx	# 15443	[c=4 l=3]  *movsi_internal/0
+	imull	$260, %edi, %edi	# 9068	[c=12 l=6]  *mulsi3_1/1
+	subl	%r8d, %eax	# 9066	[c=4 l=3]  *subsi_1/0
+	andl	$-64, %ecx	# 9060	[c=4 l=3]  *andsi_1/0
+	andl	$511, %eax	# 9067	[c=4 l=5]  *andsi_1/0
+	andl	$7680, %edi	# 9069	[c=4 l=6]  *andsi_1/0
+	orl	%edi, %eax	# 9070	[c=5 l=2]  *iorsi_1_zext
+	leaq	flag_update_table_sub8(%rip), %rdi	# 14854	[c=1 l=7]  *movdi_internal/4
+	andb	(%rdi,%rax), %dl	# 9074	[c=13 l=3]  *andqi_1/1
+	movl	%edx, %eax	# 15448	[c=4 l=2]  *movqi_internal/0
+	jmp	.L1546	# 18283	[c=1 l=5]  jump
+.L1179:
+	movzwl	12(%rbp), %esi	# 9093	[c=13 l=4]  *zero_extendhisi2/0
+	movzbl	10(%rbp), %ecx	# 9095	[c=13 l=4]  zero_extendqidi2/0
+	movl	%esi, %edx	# 16700	[c=4 l=2]  *movsi_internal/0
+	cmpl	$15, %ecx	# 9098	[c=4 l=3]  *cmpsi_1/0
+	jle	.L1856	# 9099	[c=13 l=6]  *jcc
+	movzbl	1004(%rbx,%rcx), %eax	# 9112	[c=14 l=8]  *zero_extendqisi2/0
+	andl	$136, %edx	# 9117	[c=4 l=6]  *andsi_1/0
+	movl	%eax, %ecx	# 15449	[c=4 l=2]  *movsi_internal/0
+	subl	%esi, %eax	# 9120	[c=4 l=2]  *subsi_1/0
+	andl	$136, %ecx	# 9114	[c=4 l=6]  *andsi_1/0
+	andl	$511, %eax	# 9121	[c=4 l=5]  *andsi_1/0
+	leal	(%rdx,%rcx,2), %edx	# 9118	[c=8 l=3]  *leasi
+	imull	$260, %edx, %edx	# 9122	[c=12 l=6]  *mulsi3_1/1
+	andl	$7680, %edx	# 9123	[c=4 l=6]  *andsi_1/0
+	jmp	.L1558	# 18286	[c=1 l=5]  jump
+.L1183:
+	movzwl	12(%rbp), %esi	# 9163	[c=13 l=4]  *zero_extendhisi2/0
+	movzbl	10(%rbp), %ecx	# 9165	[c=13 l=4]  zero_extendqidi2/0
+	movl	%esi, %edx	# 16702	[c=4 l=2]  *movsi_internal/0
+	cmpl	$15, %ecx	# 9168	[c=4 l=3]  *cmpsi_1/0
+	jle	.L1857	# 9169	[c=13 l=6]  *jcc
+	movzbl	1004(%rbx,%rcx), %eax	# 9182	[c=14 l=8]  *zero_extendqisi2/0
+	andl	$136, %edx	# 9187	[c=4 l=6]  *andsi_1/0
+	movl	%eax, %ecx	# 15453	[c=4 l=2]  *movsi_internal/0
+	subl	%esi, %eax	# 9190	[c=4 l=2]  *subsi_1/0
+	andl	$136, %ecx	# 9184	[c=4 l=6]  *andsi_1/0
+	leal	(%rdx,%rcx,2), %edx	# 9188	[c=8 l=3]  *leasi
+	jmp	.L1561	# 18289	[c=1 l=5]  jump
+.L1187:
+	movzbl	10(%rbp), %ecx	# 9233	[c=13 l=4]  zero_extendqidi2/0
+	cmpl	$15, %ecx	# 9236	[c=4 l=3]  *cmpsi_1/0
+	jle	.L1858	# 9237	[c=13 l=6]  *jcc
+	movzbl	100(%rbx), %edx	# 9251	[c=9 l=4]  *movqi_internal/4
+	movzbl	1004(%rbx,%rcx), %eax	# 9250	[c=14 l=8]  zero_extendqidi2/0
+	movl	%edx, %ecx	# 15457	[c=4 l=2]  *movsi_internal/0
+	andl	$225, %ecx	# 9254	[c=4 l=6]  *andsi_2/0
+	jne	.L1189	# 9255	[c=13 l=6]  *jcc
+	leaq	flag_update_table_logical(%rip), %rdx	# 9258	[c=1 l=7]  *movdi_internal/4
+	addq	%rdx, %rax	# 9259	[c=4 l=3]  *adddi_1/0
+	movl	$30, %edx	# 40	[c=4 l=5]  *movqi_internal/3
+	jmp	.L1247	# 18292	[c=1 l=5]  jump
+.L1191:
+	movzbl	10(%rbp), %ecx	# 9290	[c=13 l=4]  zero_extendqidi2/0
+	cmpl	$15, %ecx	# 9293	[c=4 l=3]  *cmpsi_1/0
+	jle	.L1859	# 9294	[c=13 l=6]  *jcc
+	movzbl	100(%rbx), %edx	# 9308	[c=9 l=4]  *movqi_internal/4
+	movzbl	1004(%rbx,%rcx), %eax	# 9307	[c=14 l=8]  zero_extendqidi2/0
+	movl	%edx, %ecx	# 15459	[c=4 l=2]  *movsi_internal/0
+	andl	$225, %ecx	# 9311	[c=4 l=6]  *andsi_2/0
+	jne	.L1193	# 9312	[c=13 l=6]  *jcc
+	leaq	flag_update_table_logical(%rip), %rdx	# 9315	[c=1 l=7]  *movdi_internal/4
+	addq	%rdx, %rax	# 9316	[c=4 l=3]  *adddi_1/0
+	movl	$30, %edx	# 41	[c=4 l=5]  *movqi_internal/3
+	jmp	.L1194	# 18295	[c=1 l=5]  jump
+.L1195:
+	movzbl	10(%rbp), %eax	# 9348	[c=13 l=4]  zero_extendqidi2/0
+	movzwl	12(%rbp), %ecx	# 9347	[c=13 l=4]  zero_extendhidi2/0
+	cmpl	$15, %eax	# 9351	[c=4 l=3]  *cmpsi_1/0
+	jle	.L1860	# 9352	[c=13 l=6]  *jcc
+	movzbl	1004(%rbx,%rax), %eax	# 9365	[c=14 l=8]  *zero_extendqisi2/0
+	movl	%eax, %edx	# 16706	[c=4 l=2]  *movsi_internal/0
+	cmpl	$15, %ecx	# 9369	[c=4 l=3]  *cmpsi_1/0
+	jle	.L1861	# 9370	[c=13 l=6]  *jcc
+	movzbl	1004(%rbx,%rcx), %ecx	# 9383	[c=14 l=8]  *zero_extendqisi2/0
+	andl	$136, %edx	# 9385	[c=4 l=6]  *andsi_1/0
+	movl	%ecx, %esi	# 15461	[c=4 l=2]  *movsi_internal/0
+	subl	%ecx, %eax	# 9391	[c=4 l=2]  *subsi_1/0
+	andl	$136, %esi	# 9388	[c=4 l=6]  *andsi_1/0
+	andl	$511, %eax	# 9392	[c=4 l=5]  *andsi_1/0
+	leal	(%rsi,%rdx,2), %edx	# 9389	[c=8 l=3]  *leasi
+	movzbl	100(%rbx), %esi	# 9396	[c=9 l=4]  *movqi_internal/4
+	imull	$260, %edx, %edx	# 9393	[c=12 l=6]  *mulsi3_1/1
+	andl	$7680, %edx	# 9394	[c=4 l=6]  *andsi_1/0
+	orl	%edx, %eax	# 9395	[c=5 l=2]  *iorsi_1_zext
+	movl	%esi, %edx	# 15463	[c=4 l=2]  *movsi_internal/0
+	andl	$192, %edx	# 9399	[c=4 l=6]  *andsi_2/0
+	jne	.L1198	# 9400	[c=13 l=6]  *jcc
+	leaq	flag_update_table_sub8(%rip), %rdx	# 9403	[c=1 l=7]  *movdi_internal/4
+	movl	$63, %esi	# 42	[c=4 l=5]  *movqi_internal/3
+	addq	%rdx, %rax	# 9404	[c=4 l=3]  *adddi_1/0
+.L1199:
+	movl	(%rbx), %ecx	# 9424	[c=6 l=2]  *zero_extendsidi2/3
+	movq	1064(%rbx), %rbp	# 9423	[c=9 l=7]  *movdi_internal/3
+	movb	%sil, 100(%rbx)	# 9422	[c=4 l=4]  *movqi_internal/8
+	movq	%rax, 104(%rbx)	# 9421	[c=4 l=4]  *movdi_internal/5
+	movq	%rcx, %r9	# 16707	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rcx	# 9426	[c=4 l=4]  *ashldi3_1/0
+	addq	%rbp, %rcx	# 9427	[c=4 l=3]  *adddi_1/0
+	leal	1(%r9), %r8d	# 16065	[c=5 l=4]  *leadi
+	movl	%r8d, (%rbx)	# 9429	[c=4 l=3]  *movsi_internal/1
+	movzwl	12(%rcx), %edi	# 9430	[c=13 l=4]  zero_extendhidi2/0
+	movzbl	10(%rcx), %ecx	# 9431	[c=13 l=4]  zero_extendqidi2/0
+	cmpl	$15, %ecx	# 9434	[c=4 l=3]  *cmpsi_1/0
+	jle	.L1862	# 9435	[c=13 l=6]  *jcc
+	movzbl	1004(%rbx,%rcx), %ecx	# 9448	[c=14 l=8]  *zero_extendqisi2/0
+	movl	%ecx, %r14d	# 16708	[c=4 l=3]  *movsi_internal/0
+	cmpl	$15, %edi	# 9452	[c=4 l=3]  *cmpsi_1/0
+	jle	.L1863	# 9453	[c=13 l=6]  *jcc
+.L1214:
+	movzbl	(%rax), %r10d	# 9783	[c=5 l=4]  *movqi_internal/4
+	movq	1040(%rbx), %rax	# 9784	[c=9 l=7]  *movdi_internal/3
+	salq	$4, %r8	# 9820	[c=4 l=4]  *ashldi3_1/0
+	addl	$2, %r9d	# 9822	[c=4 l=4]  *addsi_1/0
+	movzbl	1004(%rbx,%rdi), %r11d	# 9781	[c=14 l=9]  *zero_extendqisi2/0
+	movzbl	%sil, %edi	# 9782	[c=4 l=4]  *zero_extendqisi2/0
+	andl	$136, %r14d	# 9792	[c=4 l=7]  *andsi_1/0
+	addq	%r8, %rbp	# 9821	[c=4 l=3]  *adddi_1/0
+	movzbl	63(%rax), %r15d	# 9785	[c=13 l=5]  *zero_extendqisi2/0
+	movl	%edi, %eax	# 15497	[c=4 l=2]  *movsi_internal/0
+	andl	%r10d, %esi	# 16044	[c=4 l=3]  *andsi_1/0
+	andl	$-64, %edi	# 9797	[c=4 l=3]  *andsi_1/0
+	notl	%eax	# 9786	[c=4 l=2]  *one_cmplsi2_1/0
+	movzbl	%sil, %esi	# 9789	[c=4 l=4]  *zero_extendqisi2/0
+	subl	%r11d, %ecx	# 9801	[c=4 l=3]  *subsi_1/0
+	andl	%edi, %r10d	# 16045	[c=4 l=3]  *andsi_1/0
+	andl	%r15d, %eax	# 9787	[c=4 l=3]  *andsi_1/0
+	orl	$63, %edi	# 16047	[c=4 l=3]  *iorsi_1/0
+	movl	%r9d, (%rbx)	# 9823	[c=4 l=3]  *movsi_internal/1
+	orl	%esi, %eax	# 9790	[c=4 l=2]  *iorsi_1/0
+	movl	%r11d, %esi	# 15499	[c=4 l=3]  *movsi_internal/0
+	movb	%dil, 100(%rbx)	# 9816	[c=4 l=4]  *movqi_internal/8
+	andl	$136, %esi	# 9795	[c=4 l=6]  *andsi_1/0
+	movl	%eax, %r11d	# 15501	[c=4 l=3]  *movsi_internal/0
+	orl	$-3, %eax	# 9810	[c=4 l=3]  *iorsi_1/0
+	leal	(%rsi,%r14,2), %esi	# 9796	[c=8 l=4]  *leasi
+	andl	$1, %r11d	# 9802	[c=4 l=4]  *andsi_1/0
+	imull	$260, %esi, %esi	# 9805	[c=12 l=6]  *mulsi3_1/1
+	subl	%r11d, %ecx	# 9803	[c=4 l=3]  *subsi_1/0
+	andl	$511, %ecx	# 9804	[c=4 l=6]  *andsi_1/0
+	andl	$7680, %esi	# 9806	[c=4 l=6]  *andsi_1/0
+	orl	%esi, %ecx	# 9807	[c=5 l=2]  *iorsi_1_zext
+	andb	(%rdx,%rcx), %al	# 9811	[c=13 l=3]  *andqi_1/1
+	orl	%eax, %r10d	# 16046	[c=4 l=3]  *iorsi_1/0
+	leaq	101(%rbx), %rax	# 16048	[c=4 l=4]  *leadi
+	movb	%r10b, 101(%rbx)	# 9814	[c=4 l=4]  *movqi_internal/8
+	movq	%rax, 104(%rbx)	# 9818	[c=4 l=4]  *movdi_internal/5
+	jmp	.L614	# 18301	[c=1 l=5]  jump
+.L1202:
+	movzbl	10(%rbp), %eax	# 9514	[c=13 l=4]  zero_extendqidi2/0
+	movzwl	12(%rbp), %ecx	# 9513	[c=13 l=4]  zero_extendhidi2/0
+	cmpl	$15, %eax	# 9517	[c=4 l=3]  *cmpsi_1/0
+	jle	.L1864	# 9518	[c=13 l=6]  *jcc
+	movzbl	1004(%rbx,%rax), %eax	# 9531	[c=14 l=8]  *zero_extendqisi2/0
+	movl	%eax, %edx	# 16709	[c=4 l=2]  *movsi_internal/0
+	cmpl	$15, %ecx	# 9535	[c=4 l=3]  *cmpsi_1/0
+	jle	.L1865	# 9536	[c=13 l=6]  *jcc
+	movzbl	1004(%rbx,%rcx), %ecx	# 9549	[c=14 l=8]  *zero_extendqisi2/0
+	andl	$136, %edx	# 9551	[c=4 l=6]  *andsi_1/0
+	movl	%ecx, %esi	# 15475	[c=4 l=2]  *movsi_internal/0
+	subl	%ecx, %eax	# 9557	[c=4 l=2]  *subsi_1/0
+	andl	$136, %esi	# 9554	[c=4 l=6]  *andsi_1/0
+	andl	$511, %eax	# 9558	[c=4 l=5]  *andsi_1/0
+	leal	(%rsi,%rdx,2), %edx	# 9555	[c=8 l=3]  *leasi
+	movzbl	100(%rbx), %esi	# 9562	[c=9 l=4]  *movqi_internal/4
+	imull	$260, %edx, %edx	# 9559	[c=12 l=6]  *mulsi3_1/1
+	andl	$7680, %edx	# 9560	[c=4 l=6]  *andsi_1/0
+	orl	%edx, %eax	# 9561	[c=5 l=2]  *iorsi_1_zext
+	movl	%esi, %edx	# 15477	[c=4 l=2]  *movsi_internal/0
+	andl	$192, %edx	# 9565	[c=4 l=6]  *andsi_2/0
+	jne	.L1205	# 9566	[c=13 l=6]  *jcc
+	leaq	flag_update_table_sub8(%rip), %rdx	# 9569	[c=1 l=7]  *movdi_internal/4
+	movl	$63, %esi	# 43	[c=4 l=5]  *movqi_internal/3
+	addq	%rdx, %rax	# 9570	[c=4 l=3]  *adddi_1/0
+.L1206:
+	movl	(%rbx), %ecx	# 9590	[c=6 l=2]  *zero_extendsidi2/3
+	movq	1064(%rbx), %rbp	# 9589	[c=9 l=7]  *movdi_internal/3
+	movb	%sil, 100(%rbx)	# 9588	[c=4 l=4]  *movqi_internal/8
+	movq	%rax, 104(%rbx)	# 9587	[c=4 l=4]  *movdi_internal/5
+	movq	%rcx, %r9	# 16710	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rcx	# 9592	[c=4 l=4]  *ashldi3_1/0
+	addq	%rbp, %rcx	# 9593	[c=4 l=3]  *adddi_1/0
+	leal	1(%r9), %r8d	# 16057	[c=5 l=4]  *leadi
+	movl	%r8d, (%rbx)	# 9595	[c=4 l=3]  *movsi_internal/1
+	movzwl	12(%rcx), %edi	# 9596	[c=13 l=4]  zero_extendhidi2/0
+	movzbl	10(%rcx), %ecx	# 9597	[c=13 l=4]  zero_extendqidi2/0
+	cmpl	$15, %ecx	# 9600	[c=4 l=3]  *cmpsi_1/0
+	jle	.L1866	# 9601	[c=13 l=6]  *jcc
+	movzbl	1004(%rbx,%rcx), %ecx	# 9614	[c=14 l=8]  *zero_extendqisi2/0
+	movl	%ecx, %r14d	# 16711	[c=4 l=3]  *movsi_internal/0
+	cmpl	$15, %edi	# 9618	[c=4 l=3]  *cmpsi_1/0
+	jg	.L1220	# 9619	[c=13 l=6]  *jcc
+	movl	%edi, %ecx	# 9621	[c=4 l=2]  *movsi_internal/0
+	leaq	.LC52(%rip), %rdx	# 9622	[c=1 l=7]  *movdi_internal/4
+	movl	$1, %esi	# 9624	[c=4 l=5]  *movsi_internal/0
+	xorl	%eax, %eax	# 17661	[c=4 l=2]  *movdi_xor
+	movq	%rbx, %rdi	# 9625	[c=4 l=3]  *movdi_internal/3
+	call	leave	# 9627	[c=0 l=5]  *call
+.L1209:
+	movzwl	12(%rbp), %esi	# 9679	[c=13 l=4]  *zero_extendhisi2/0
+	movzbl	10(%rbp), %ecx	# 9681	[c=13 l=4]  zero_extendqidi2/0
+	movl	%esi, %edx	# 16712	[c=4 l=2]  *movsi_internal/0
+	cmpl	$15, %ecx	# 9684	[c=4 l=3]  *cmpsi_1/0
+	jle	.L1867	# 9685	[c=13 l=6]  *jcc
+	movzbl	1004(%rbx,%rcx), %eax	# 9698	[c=14 l=8]  *zero_extendqisi2/0
+	andl	$136, %edx	# 9703	[c=4 l=6]  *andsi_1/0
+	movl	%eax, %ecx	# 15489	[c=4 l=2]  *movsi_internal/0
+	subl	%esi, %eax	# 9706	[c=4 l=2]  *subsi_1/0
+	movzbl	100(%rbx), %esi	# 9711	[c=9 l=4]  *movqi_internal/4
+	andl	$136, %ecx	# 9700	[c=4 l=6]  *andsi_1/0
+	andl	$511, %eax	# 9707	[c=4 l=5]  *andsi_1/0
+	leal	(%rdx,%rcx,2), %edx	# 9704	[c=8 l=3]  *leasi
+	imull	$260, %edx, %edx	# 9708	[c=12 l=6]  *mulsi3_1/1
+	andl	$7680, %edx	# 9709	[c=4 l=6]  *andsi_1/0
+	orl	%edx, %eax	# 9710	[c=5 l=2]  *iorsi_1_zext
+	movl	%esi, %edx	# 15491	[c=4 l=2]  *movsi_internal/0
+	andl	$192, %edx	# 9714	[c=4 l=6]  *andsi_2/0
+	jne	.L1211	# 9715	[c=13 l=6]  *jcc
+	leaq	flag_update_table_sub8(%rip), %rdx	# 9718	[c=1 l=7]  *movdi_internal/4
+	movl	$63, %esi	# 44	[c=4 l=5]  *movqi_internal/3
+	addq	%rdx, %rax	# 9719	[c=4 l=3]  *adddi_1/0
+.L1212:
+	movl	(%rbx), %ecx	# 9739	[c=6 l=2]  *zero_extendsidi2/3
+	movq	1064(%rbx), %rbp	# 9738	[c=9 l=7]  *movdi_internal/3
+	movb	%sil, 100(%rbx)	# 9737	[c=4 l=4]  *movqi_internal/8
+	movq	%rax, 104(%rbx)	# 9736	[c=4 l=4]  *movdi_internal/5
+	movq	%rcx, %r9	# 16713	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rcx	# 9741	[c=4 l=4]  *ashldi3_1/0
+	addq	%rbp, %rcx	# 9742	[c=4 l=3]  *adddi_1/0
+	leal	1(%r9), %r8d	# 16049	[c=5 l=4]  *leadi
+	movl	%r8d, (%rbx)	# 9744	[c=4 l=3]  *movsi_internal/1
+	movzwl	12(%rcx), %edi	# 9745	[c=13 l=4]  zero_extendhidi2/0
+	movzbl	10(%rcx), %ecx	# 9746	[c=13 l=4]  zero_extendqidi2/0
+	cmpl	$15, %ecx	# 9749	[c=4 l=3]  *cmpsi_1/0
+	jle	.L1868	# 9750	[c=13 l=6]  *jcc
+	movzbl	1004(%rbx,%rcx), %ecx	# 9763	[c=14 l=8]  *zero_extendqisi2/0
+	movl	%ecx, %r14d	# 16714	[c=4 l=3]  *movsi_internal/0
+	cmpl	$15, %edi	# 9767	[c=4 l=3]  *cmpsi_1/0
+	jg	.L1214	# 9768	[c=13 l=6]  *jcc
+	movl	%edi, %ecx	# 9770	[c=4 l=2]  *movsi_internal/0
+	leaq	.LC52(%rip), %rdx	# 9771	[c=1 l=7]  *movdi_internal/4
+	movl	$1, %esi	# 9773	[c=4 l=5]  *movsi_internal/0
+	xorl	%eax, %eax	# 17656	[c=4 l=2]  *movdi_xor
+	movq	%rbx, %rdi	# 9774	[c=4 l=3]  *movdi_internal/3
+	call	leave	# 9776	[c=0 l=5]  *call
+.L1130:
+	movzbl	10(%rbp), %ecx	# 8118	[c=13 l=4]  zero_extendqidi2/0
+	cmpl	$15, %ecx	# 8121	[c=4 l=3]  *cmpsi_1/0
+	jle	.L1869	# 8122	[c=13 l=6]  *jcc
+	movb	$0, 1004(%rbx,%rcx)	# 8135	[c=4 l=8]  *movqi_internal/8
+	movzbl	100(%rbx), %eax	# 8136	[c=9 l=4]  *movqi_internal/4
+	leaq	flag_update_table_logical(%rip), %rsi	# 29	[c=1 l=7]  *movdi_internal/4
+	movl	$30, %ecx	# 30	[c=4 l=5]  *movqi_internal/3
+	movl	%eax, %edx	# 15385	[c=4 l=2]  *movsi_internal/0
+	andl	$225, %edx	# 8139	[c=4 l=6]  *andsi_2/0
+	je	.L1132	# 8140	[c=13 l=2]  *jcc
+	movq	104(%rbx), %rcx	# 8142	[c=9 l=4]  *movdi_internal/3
+	orl	$30, %eax	# 16106	[c=4 l=3]  *iorsi_1/0
+	leaq	101(%rbx), %rsi	# 16107	[c=4 l=4]  *leadi
+	andb	(%rcx), %dl	# 8143	[c=9 l=2]  *andqi_1/1
+	movl	%eax, %ecx	# 15388	[c=4 l=2]  *movqi_internal/0
+	orl	$2, %edx	# 16105	[c=4 l=3]  *iorsi_1/0
+	movb	%dl, 101(%rbx)	# 8145	[c=4 l=3]  *movqi_internal/8
+.L1132:
+	movl	(%rbx), %ebp	# 8152	[c=6 l=2]  *zero_extendsidi2/3
+	movq	%rsi, 104(%rbx)	# 8150	[c=4 l=4]  *movdi_internal/5
+	movb	%cl, 100(%rbx)	# 8151	[c=4 l=3]  *movqi_internal/8
+	movq	%rbp, %rdx	# 16675	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbp	# 8154	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %rbp	# 8156	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%rbp), %eax	# 8157	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%edx, %eax	# 8158	[c=4 l=2]  *addsi_1/0
+	movl	%eax, (%rbx)	# 8159	[c=4 l=2]  *movsi_internal/1
+	jmp	*0(%rbp)	# 17704	[c=5 l=3]  *indirect_jump
+.L1133:
+	movzbl	10(%rbp), %ecx	# 8165	[c=13 l=4]  zero_extendqidi2/0
+	cmpl	$15, %ecx	# 8168	[c=4 l=3]  *cmpsi_1/0
+	jle	.L1870	# 8169	[c=13 l=6]  *jcc
+	movzbl	1004(%rbx,%rcx), %edx	# 8182	[c=14 l=8]  *zero_extendqisi2/0
+	movl	%edx, %eax	# 16676	[c=4 l=2]  *movsi_internal/0
+	addl	%edx, %edx	# 8184	[c=4 l=2]  *ashlsi3_1/0
+	andl	$136, %eax	# 8188	[c=4 l=5]  *andsi_1/0
+	movb	%dl, 1004(%rbx,%rcx)	# 8186	[c=4 l=7]  *movqi_internal/8
+	imull	$780, %eax, %eax	# 8189	[c=12 l=6]  *mulsi3_1/1
+	andl	$7680, %eax	# 8190	[c=4 l=5]  *andsi_1/0
+	orl	%edx, %eax	# 8191	[c=5 l=2]  *iorsi_1_zext
+	movzbl	100(%rbx), %edx	# 8192	[c=9 l=4]  *movqi_internal/4
+	movl	%edx, %ecx	# 15389	[c=4 l=2]  *movsi_internal/0
+	andl	$192, %ecx	# 8195	[c=4 l=6]  *andsi_2/0
+	jne	.L1135	# 8196	[c=13 l=6]  *jcc
+	leaq	flag_update_table_add8(%rip), %rdx	# 8199	[c=1 l=7]  *movdi_internal/4
+	addq	%rdx, %rax	# 8200	[c=4 l=3]  *adddi_1/0
+	movl	$63, %edx	# 31	[c=4 l=5]  *movqi_internal/3
+.L1136:
+	movl	(%rbx), %ebp	# 8219	[c=6 l=2]  *zero_extendsidi2/3
+	movb	%dl, 100(%rbx)	# 8218	[c=4 l=3]  *movqi_internal/8
+	movq	%rax, 104(%rbx)	# 8217	[c=4 l=4]  *movdi_internal/5
+	movq	%rbp, %rdx	# 16677	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbp	# 8221	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %rbp	# 8223	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%rbp), %eax	# 8224	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%edx, %eax	# 8225	[c=4 l=2]  *addsi_1/0
+	movl	%eax, (%rbx)	# 8226	[c=4 l=2]  *movsi_internal/1
+	jmp	*0(%rbp)	# 17702	[c=5 l=3]  *indirect_jump
+.L1137:
+	movzbl	100(%rbx), %ecx	# 8233	[c=13 l=4]  *zero_extendqisi2/0
+	movq	1040(%rbx), %rdx	# 8236	[c=9 l=7]  *movdi_internal/3
+	movq	104(%rbx), %rdi	# 8235	[c=9 l=4]  *movdi_internal/3
+	movzbl	10(%rbp), %eax	# 8232	[c=13 l=4]  *zero_extendqisi2/0
+	movzbl	63(%rdx), %edx	# 8237	[c=13 l=4]  *zero_extendqisi2/0
+	movl	%ecx, %r8d	# 15391	[c=4 l=3]  *movsi_internal/0
+	movl	%ecx, %esi	# 16678	[c=4 l=2]  *movsi_internal/0
+	notl	%r8d	# 8238	[c=4 l=3]  *one_cmplsi2_1/0
+	andl	%r8d, %edx	# 8239	[c=4 l=3]  *andsi_1/0
+	movzbl	(%rdi), %r8d	# 17700	[c=5 l=4]  *movqi_internal/4
+	andl	%ecx, %r8d	# 18862	[c=4 l=3]  *andsi_1/0
+	orl	%r8d, %edx	# 8242	[c=4 l=3]  *iorsi_1/0
+	andl	$1, %edx	# 8243	[c=4 l=3]  *andsi_1/0
+	cmpl	$15, %eax	# 8246	[c=4 l=3]  *cmpsi_1/0
+	jle	.L1871	# 8247	[c=13 l=6]  *jcc
+	movslq	%eax, %r8	# 8259	[c=4 l=3]  *extendsidi2_rex64/1
+	movzbl	1004(%rbx,%r8), %r9d	# 8260	[c=14 l=9]  *zero_extendqisi2/0
+	movl	%r9d, %eax	# 16679	[c=4 l=3]  *movsi_internal/0
+	leal	(%rdx,%r9,2), %edx	# 8263	[c=8 l=4]  *leasi
+	andl	$136, %eax	# 8267	[c=4 l=5]  *andsi_1/0
+	movb	%dl, 1004(%rbx,%r8)	# 8265	[c=4 l=8]  *movqi_internal/8
+	imull	$780, %eax, %eax	# 8268	[c=12 l=6]  *mulsi3_1/1
+	andl	$7680, %eax	# 8269	[c=4 l=5]  *andsi_1/0
+	orl	%edx, %eax	# 8270	[c=5 l=2]  *iorsi_1_zext
+	andl	$-64, %ecx	# 8272	[c=4 l=3]  *andsi_2/0
+	jne	.L1139	# 8273	[c=13 l=6]  *jcc
+	leaq	flag_update_table_add8(%rip), %rdx	# 8276	[c=1 l=7]  *movdi_internal/4
+	movl	$63, %esi	# 32	[c=4 l=5]  *movqi_internal/3
+	addq	%rdx, %rax	# 8277	[c=4 l=3]  *adddi_1/0
+.L1140:
+	movl	(%rbx), %ebp	# 8295	[c=6 l=2]  *zero_extendsidi2/3
+	movq	%rax, 104(%rbx)	# 8293	[c=4 l=4]  *movdi_internal/5
+	movb	%sil, 100(%rbx)	# 8294	[c=4 l=4]  *movqi_internal/8
+	movq	%rbp, %rdx	# 16680	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbp	# 8297	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %rbp	# 8299	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%rbp), %eax	# 8300	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%edx, %eax	# 8301	[c=4 l=2]  *addsi_1/0
+	movl	%eax, (%rbx)	# 8302	[c=4 l=2]  *movsi_internal/1
+	jmp	*0(%rbp)	# 17698	[c=5 l=3]  *indirect_jump
+.L1141:
+	movzbl	10(%rbp), %ecx	# 8308	[c=13 l=4]  zero_extendqidi2/0
+	cmpl	$15, %ecx	# 8311	[c=4 l=3]  *cmpsi_1/0
+	jle	.L1872	# 8312	[c=13 l=6]  *jcc
+	movzbl	100(%rbx), %edx	# 8326	[c=9 l=4]  *movqi_internal/4
+	movzbl	1004(%rbx,%rcx), %eax	# 8325	[c=14 l=8]  zero_extendqidi2/0
+	movl	%edx, %ecx	# 15395	[c=4 l=2]  *movsi_internal/0
+	andl	$225, %ecx	# 8329	[c=4 l=6]  *andsi_2/0
+	jne	.L1143	# 8330	[c=13 l=6]  *jcc
+	leaq	flag_update_table_logical(%rip), %rdx	# 8333	[c=1 l=7]  *movdi_internal/4
+	addq	%rdx, %rax	# 8334	[c=4 l=3]  *adddi_1/0
+	movl	$30, %edx	# 33	[c=4 l=5]  *movqi_internal/3
+.L1144:
+	movl	(%rbx), %ebp	# 8354	[c=6 l=2]  *zero_extendsidi2/3
+	movb	%dl, 100(%rbx)	# 8353	[c=4 l=3]  *movqi_internal/8
+	movq	%rax, 104(%rbx)	# 8352	[c=4 l=4]  *movdi_internal/5
+	movq	%rbp, %rdx	# 16681	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbp	# 8356	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %rbp	# 8358	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%rbp), %eax	# 8359	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%edx, %eax	# 8360	[c=4 l=2]  *addsi_1/0
+	movl	%eax, (%rbx)	# 8361	[c=4 l=2]  *movsi_internal/1
+	jmp	*0(%rbp)	# 17696	[c=5 l=3]  *indirect_jump
+.L1145:
+	movl	(%rbx), %eax	# 15397	[c=5 l=2]  *movsi_internal/0
+	movq	1056(%rbx), %rdx	# 8373	[c=9 l=7]  *movdi_internal/3
+	movl	$1, %esi	# 8379	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 8380	[c=4 l=3]  *movdi_internal/3
+	movq	832(%rbx), %r8	# 8375	[c=9 l=7]  *movdi_internal/3
+	subl	$1, %eax	# 8368	[c=4 l=3]  *addsi_1/0
+	movl	%eax, (%rbx)	# 8369	[c=4 l=2]  *movsi_internal/1
+	addl	%eax, %eax	# 8371	[c=5 l=2]  *ashlsi3_1_zext/0
+	movzwl	(%rdx,%rax), %ecx	# 8374	[c=13 l=4]  *zero_extendhisi2/0
+	leaq	.LC44(%rip), %rdx	# 8377	[c=1 l=7]  *movdi_internal/4
+	xorl	%eax, %eax	# 17695	[c=4 l=2]  *movdi_xor
+	call	leave	# 8382	[c=0 l=5]  *call
+.L1146:
+	movl	(%rbx), %eax	# 15398	[c=5 l=2]  *movsi_internal/0
+	movq	1056(%rbx), %rdx	# 8392	[c=9 l=7]  *movdi_internal/3
+	movl	$1, %esi	# 8398	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 8399	[c=4 l=3]  *movdi_internal/3
+	movq	832(%rbx), %r8	# 8394	[c=9 l=7]  *movdi_internal/3
+	subl	$1, %eax	# 8387	[c=4 l=3]  *addsi_1/0
+	movl	%eax, (%rbx)	# 8388	[c=4 l=2]  *movsi_internal/1
+	addl	%eax, %eax	# 8390	[c=5 l=2]  *ashlsi3_1_zext/0
+	movzwl	(%rdx,%rax), %ecx	# 8393	[c=13 l=4]  *zero_extendhisi2/0
+	leaq	.LC44(%rip), %rdx	# 8396	[c=1 l=7]  *movdi_internal/4
+	xorl	%eax, %eax	# 17694	[c=4 l=2]  *movdi_xor
+	call	leave	# 8401	[c=0 l=5]  *call
+.L1147:
+	movl	(%rbx), %eax	# 15399	[c=5 l=2]  *movsi_internal/0
+	movq	1056(%rbx), %rdx	# 8411	[c=9 l=7]  *movdi_internal/3
+	movl	$1, %esi	# 8417	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 8418	[c=4 l=3]  *movdi_internal/3
+	movq	832(%rbx), %r8	# 8413	[c=9 l=7]  *movdi_internal/3
+	subl	$1, %eax	# 8406	[c=4 l=3]  *addsi_1/0
+	movl	%eax, (%rbx)	# 8407	[c=4 l=2]  *movsi_internal/1
+	addl	%eax, %eax	# 8409	[c=5 l=2]  *ashlsi3_1_zext/0
+	movzwl	(%rdx,%rax), %ecx	# 8412	[c=13 l=4]  *zero_extendhisi2/0
+	leaq	.LC44(%rip), %rdx	# 8415	[c=1 l=7]  *movdi_internal/4
+	xorl	%eax, %eax	# 17693	[c=4 l=2]  *movdi_xor
+	call	leave	# 8420	[c=0 l=5]  *call
+.L1148:
+	movl	(%rbx), %eax	# 15400	[c=5 l=2]  *movsi_internal/0
+	movq	1056(%rbx), %rdx	# 8430	[c=9 l=7]  *movdi_internal/3
+	movl	$1, %esi	# 8436	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 8437	[c=4 l=3]  *movdi_internal/3
+	movq	832(%rbx), %r8	# 8432	[c=9 l=7]  *movdi_internal/3
+	subl	$1, %eax	# 8425	[c=4 l=3]  *addsi_1/0
+	movl	%eax, (%rbx)	# 8426	[c=4 l=2]  *movsi_internal/1
+	addl	%eax, %eax	# 8428	[c=5 l=2]  *ashlsi3_1_zext/0
+	movzwl	(%rdx,%rax), %ecx	# 8431	[c=13 l=4]  *zero_extendhisi2/0
+	leaq	.LC44(%rip), %rdx	# 8434	[c=1 l=7]  *movdi_internal/4
+	xorl	%eax, %eax	# 17692	[c=4 l=2]  *movdi_xor
+	call	leave	# 8439	[c=0 l=5]  *call
+.L1118:
+	movzbl	10(%rbp), %ecx	# 7903	[c=13 l=4]  zero_extendqidi2/0
+	movzwl	12(%rbp), %esi	# 7902	[c=13 l=4]  zero_extendhidi2/0
+	cmpl	$15, %ecx	# 7906	[c=4 l=3]  *cmpsi_1/0
+	jle	.L1873	# 7907	[c=13 l=6]  *jcc
+	movzbl	1004(%rbx,%rcx), %eax	# 7920	[c=14 l=8]  *zero_extendqisi2/0
+	movl	%eax, %edx	# 16668	[c=4 l=2]  *movsi_internal/0
+	cmpl	$15, %esi	# 7924	[c=4 l=3]  *cmpsi_1/0
+	jle	.L1874	# 7925	[c=13 l=6]  *jcc
+	movzbl	1004(%rbx,%rsi), %esi	# 7938	[c=14 l=8]  *zero_extendqisi2/0
+	movl	%eax, %edi	# 15377	[c=4 l=2]  *movqi_internal/1
+	andl	$136, %edx	# 7943	[c=4 l=6]  *andsi_1/0
+	subl	%esi, %edi	# 16112	[c=4 l=2]  *subsi_1/0
+	subl	%esi, %eax	# 7949	[c=4 l=2]  *subsi_1/0
+	movb	%dil, 1004(%rbx,%rcx)	# 7941	[c=4 l=8]  *movqi_internal/8
+	movl	%esi, %ecx	# 15379	[c=4 l=2]  *movsi_internal/0
+	andl	$511, %eax	# 7950	[c=4 l=5]  *andsi_1/0
+	andl	$136, %ecx	# 7946	[c=4 l=6]  *andsi_1/0
+	leal	(%rcx,%rdx,2), %edx	# 7947	[c=8 l=3]  *leasi
+	imull	$260, %edx, %edx	# 7951	[c=12 l=6]  *mulsi3_1/1
+	andl	$7680, %edx	# 7952	[c=4 l=6]  *andsi_1/0
+	orl	%edx, %eax	# 7953	[c=5 l=2]  *iorsi_1_zext
+	movzbl	100(%rbx), %edx	# 7954	[c=9 l=4]  *movqi_internal/4
+	movl	%edx, %ecx	# 15381	[c=4 l=2]  *movsi_internal/0
+	andl	$192, %ecx	# 7957	[c=4 l=6]  *andsi_2/0
+	jne	.L1121	# 7958	[c=13 l=6]  *jcc
+	leaq	flag_update_table_sub8(%rip), %rdx	# 7961	[c=1 l=7]  *movdi_internal/4
+	addq	%rdx, %rax	# 7962	[c=4 l=3]  *adddi_1/0
+	movl	$63, %edx	# 27	[c=4 l=5]  *movqi_internal/3
+.L1122:
+	movl	(%rbx), %ebp	# 7981	[c=6 l=2]  *zero_extendsidi2/3
+	movb	%dl, 100(%rbx)	# 7980	[c=4 l=3]  *movqi_internal/8
+	movq	%rax, 104(%rbx)	# 7979	[c=4 l=4]  *movdi_internal/5
+	movq	%rbp, %rdx	# 16669	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbp	# 7983	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %rbp	# 7985	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%rbp), %eax	# 7986	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%edx, %eax	# 7987	[c=4 l=2]  *addsi_1/0
+	movl	%eax, (%rbx)	# 7988	[c=4 l=2]  *movsi_internal/1
+	jmp	*0(%rbp)	# 17711	[c=5 l=3]  *indirect_jump
+.L1123:
+	movzwl	12(%rbp), %edi	# 7994	[c=13 l=4]  *zero_extendhisi2/0
+	movzbl	10(%rbp), %ecx	# 7996	[c=13 l=4]  zero_extendqidi2/0
+	movl	%edi, %eax	# 16670	[c=4 l=2]  *movsi_internal/0
+	cmpl	$15, %ecx	# 7999	[c=4 l=3]  *cmpsi_1/0
+	jle	.L1875	# 8000	[c=13 l=6]  *jcc
+	movzbl	1004(%rbx,%rcx), %edx	# 8013	[c=14 l=8]  *zero_extendqisi2/0
+	andl	$136, %eax	# 8022	[c=4 l=5]  *andsi_1/0
+	movl	%edx, %esi	# 16671	[c=4 l=2]  *movsi_internal/0
+	subl	%edi, %edx	# 8015	[c=4 l=2]  *subsi_1/0
+	andl	$136, %esi	# 8019	[c=4 l=6]  *andsi_1/0
+	movb	%dl, 1004(%rbx,%rcx)	# 8017	[c=4 l=7]  *movqi_internal/8
+	andl	$511, %edx	# 8026	[c=4 l=6]  *andsi_1/0
+	leal	(%rax,%rsi,2), %eax	# 8023	[c=8 l=3]  *leasi
+	imull	$260, %eax, %eax	# 8024	[c=12 l=6]  *mulsi3_1/1
+	andl	$7680, %eax	# 8025	[c=4 l=5]  *andsi_1/0
+	orl	%edx, %eax	# 8027	[c=5 l=2]  *iorsi_1_zext
+	movzbl	100(%rbx), %edx	# 8028	[c=9 l=4]  *movqi_internal/4
+	movl	%edx, %ecx	# 15383	[c=4 l=2]  *movsi_internal/0
+	andl	$192, %ecx	# 8031	[c=4 l=6]  *andsi_2/0
+	jne	.L1125	# 8032	[c=13 l=6]  *jcc
+	leaq	flag_update_table_sub8(%rip), %rdx	# 8035	[c=1 l=7]  *movdi_internal/4
+	addq	%rdx, %rax	# 8036	[c=4 l=3]  *adddi_1/0
+	movl	$63, %edx	# 28	[c=4 l=5]  *movqi_internal/3
+.L1126:
+	movl	(%rbx), %ebp	# 8055	[c=6 l=2]  *zero_extendsidi2/3
+	movb	%dl, 100(%rbx)	# 8054	[c=4 l=3]  *movqi_internal/8
+	movq	%rax, 104(%rbx)	# 8053	[c=4 l=4]  *movdi_internal/5
+	movq	%rbp, %rdx	# 16672	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbp	# 8057	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %rbp	# 8059	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%rbp), %eax	# 8060	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%edx, %eax	# 8061	[c=4 l=2]  *addsi_1/0
+	movl	%eax, (%rbx)	# 8062	[c=4 l=2]  *movsi_internal/1
+	jmp	*0(%rbp)	# 17709	[c=5 l=3]  *indirect_jump
+.L1127:
+	movzbl	10(%rbp), %ecx	# 8068	[c=13 l=4]  zero_extendqidi2/0
+	cmpl	$15, %ecx	# 8071	[c=4 l=3]  *cmpsi_1/0
+	jle	.L1876	# 8072	[c=13 l=6]  *jcc
+	rolb	$4, 1004(%rbx,%rcx)	# 8091	[c=14 l=8]  *rotlqi3_1
+	movl	(%rbx), %ebp	# 8092	[c=6 l=2]  *zero_extendsidi2/3
+	movq	%rbp, %rdx	# 16673	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbp	# 8094	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %rbp	# 8096	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%rbp), %eax	# 8097	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%edx, %eax	# 8098	[c=4 l=2]  *addsi_1/0
+	movl	%eax, (%rbx)	# 8099	[c=4 l=2]  *movsi_internal/1
+	jmp	*0(%rbp)	# 17707	[c=5 l=3]  *indirect_jump
+.L1129:
+	movl	(%rbx), %ebp	# 8105	[c=6 l=2]  *zero_extendsidi2/3
+	movq	%rbp, %rdx	# 16674	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbp	# 8107	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %rbp	# 8109	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%rbp), %eax	# 8110	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%edx, %eax	# 8111	[c=4 l=2]  *addsi_1/0
+	movl	%eax, (%rbx)	# 8112	[c=4 l=2]  *movsi_internal/1
+	jmp	*0(%rbp)	# 17706	[c=5 l=3]  *indirect_jump
+.L1060:
+	movl	(%rbx), %eax	# 15332	[c=5 l=2]  *movsi_internal/0
+	movq	1056(%rbx), %rdx	# 7226	[c=9 l=7]  *movdi_internal/3
+	movl	$8, %esi	# 7232	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 7233	[c=4 l=3]  *movdi_internal/3
+	movl	$2, 96(%rbx)	# 7220	[c=4 l=7]  *movsi_internal/1
+	subl	$1, %eax	# 7222	[c=4 l=3]  *addsi_1/0
+	movl	%eax, (%rbx)	# 7223	[c=4 l=2]  *movsi_internal/1
+	addl	%eax, %eax	# 7224	[c=5 l=2]  *ashlsi3_1_zext/0
+	movzwl	(%rdx,%rax), %ecx	# 7227	[c=13 l=4]  *zero_extendhisi2/0
+	movl	$1, 72(%rbx)	# 7228	[c=4 l=7]  *movsi_internal/1
+	leaq	.LC45(%rip), %rdx	# 7230	[c=1 l=7]  *movdi_internal/4
+	xorl	%eax, %eax	# 17736	[c=4 l=2]  *movdi_xor
+	call	leave	# 7235	[c=0 l=5]  *call
+.L1061:
+	movzbl	10(%rbp), %ecx	# 7240	[c=13 l=4]  zero_extendqidi2/0
+	movzwl	12(%rbp), %r14d	# 7239	[c=13 l=5]  *zero_extendhisi2/0
+	movzwl	1032(%rbx), %esi	# 7241	[c=13 l=7]  *zero_extendhisi2/0
+	cmpl	$15, %ecx	# 7244	[c=4 l=3]  *cmpsi_1/0
+	jle	.L1877	# 7245	[c=13 l=6]  *jcc
+	addl	%r14d, %esi	# 7259	[c=4 l=3]  *addsi_1/0
+	movzbl	1004(%rbx,%rcx), %edx	# 7258	[c=14 l=8]  *zero_extendqisi2/0
+	movl	%esi, %eax	# 15333	[c=4 l=2]  *movsi_internal/0
+	subl	5176(%rbx), %eax	# 7260	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %eax	# 7261	[c=13 l=6]  *cmpsi_1/1
+	jb	.L1063	# 7262	[c=13 l=2]  *jcc
+	movl	%esi, %eax	# 15335	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %eax	# 7264	[c=4 l=3]  *ashrsi3_1/0
+	cltq	# 7265	[c=4 l=2]  *extendsidi2_rex64/0
+	cmpb	$0, 1080(%rbx,%rax)	# 7266	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L1064	# 7267	[c=13 l=6]  *jcc
+.L1063:
+	movq	1040(%rbx), %rax	# 7271	[c=9 l=7]  *movdi_internal/3
+	movslq	%esi, %rsi	# 7270	[c=4 l=3]  *extendsidi2_rex64/1
+	movb	%dl, (%rax,%rsi)	# 7272	[c=4 l=3]  *movqi_internal/8
+.L1065:
+	testl	%r14d, %r14d	# 7284	[c=4 l=3]  *cmpsi_ccno_1/0
+	jne	.L1066	# 7285	[c=13 l=2]  *jcc
+	subq	$1, 48(%rbx)	# 7287	[c=13 l=5]  *adddi_1/0
+.L1066:
+	movl	(%rbx), %ebp	# 7290	[c=6 l=2]  *zero_extendsidi2/3
+	movq	%rbp, %rdx	# 16654	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbp	# 7292	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %rbp	# 7294	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%rbp), %eax	# 7295	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%edx, %eax	# 7296	[c=4 l=2]  *addsi_1/0
+	movl	%eax, (%rbx)	# 7297	[c=4 l=2]  *movsi_internal/1
+	jmp	*0(%rbp)	# 17734	[c=5 l=3]  *indirect_jump
+.L1067:
+	movzbl	10(%rbp), %ecx	# 7304	[c=13 l=4]  zero_extendqidi2/0
+	movzwl	12(%rbp), %r14d	# 7303	[c=13 l=5]  *zero_extendhisi2/0
+	movzwl	1034(%rbx), %esi	# 7305	[c=13 l=7]  *zero_extendhisi2/0
+	cmpl	$15, %ecx	# 7308	[c=4 l=3]  *cmpsi_1/0
+	jle	.L1878	# 7309	[c=13 l=6]  *jcc
+	addl	%r14d, %esi	# 7323	[c=4 l=3]  *addsi_1/0
+	movzbl	1004(%rbx,%rcx), %edx	# 7322	[c=14 l=8]  *zero_extendqisi2/0
+	movl	%esi, %eax	# 15337	[c=4 l=2]  *movsi_internal/0
+	subl	5176(%rbx), %eax	# 7324	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %eax	# 7325	[c=13 l=6]  *cmpsi_1/1
+	jb	.L1069	# 7326	[c=13 l=2]  *jcc
+	movl	%esi, %eax	# 15339	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %eax	# 7328	[c=4 l=3]  *ashrsi3_1/0
+	cltq	# 7329	[c=4 l=2]  *extendsidi2_rex64/0
+	cmpb	$0, 1080(%rbx,%rax)	# 7330	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L1070	# 7331	[c=13 l=6]  *jcc
+.L1069:
+	movq	1040(%rbx), %rax	# 7335	[c=9 l=7]  *movdi_internal/3
+	movslq	%esi, %rsi	# 7334	[c=4 l=3]  *extendsidi2_rex64/1
+	movb	%dl, (%rax,%rsi)	# 7336	[c=4 l=3]  *movqi_internal/8
+.L1071:
+	testl	%r14d, %r14d	# 7348	[c=4 l=3]  *cmpsi_ccno_1/0
+	jne	.L1072	# 7349	[c=13 l=2]  *jcc
+	subq	$1, 48(%rbx)	# 7351	[c=13 l=5]  *adddi_1/0
+.L1072:
+	movl	(%rbx), %ebp	# 7354	[c=6 l=2]  *zero_extendsidi2/3
+	movq	%rbp, %rdx	# 16655	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbp	# 7356	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %rbp	# 7358	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%rbp), %eax	# 7359	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%edx, %eax	# 7360	[c=4 l=2]  *addsi_1/0
+	movl	%eax, (%rbx)	# 7361	[c=4 l=2]  *movsi_internal/1
+	jmp	*0(%rbp)	# 17732	[c=5 l=3]  *indirect_jump
+.L1073:
+	movzbl	10(%rbp), %ecx	# 7368	[c=13 l=4]  zero_extendqidi2/0
+	movzwl	12(%rbp), %eax	# 7367	[c=13 l=4]  zero_extendhidi2/0
+	cmpl	$15, %ecx	# 7371	[c=4 l=3]  *cmpsi_1/0
+	jle	.L1879	# 7372	[c=13 l=6]  *jcc
+	movzwl	%ax, %esi	# 7386	[c=4 l=3]  *zero_extendhisi2/0
+	movzbl	1004(%rbx,%rcx), %ecx	# 7385	[c=10 l=8]  *movqi_internal/4
+	movl	%esi, %edx	# 15341	[c=4 l=2]  *movsi_internal/0
+	subl	5176(%rbx), %edx	# 7387	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %edx	# 7388	[c=13 l=6]  *cmpsi_1/1
+	jb	.L1075	# 7389	[c=13 l=2]  *jcc
+	movl	%esi, %edx	# 15343	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %edx	# 7392	[c=4 l=3]  *ashrsi3_1/0
+	movslq	%edx, %rdx	# 7393	[c=4 l=3]  *extendsidi2_rex64/1
+	cmpb	$0, 1080(%rbx,%rdx)	# 7394	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L1076	# 7395	[c=13 l=6]  *jcc
+.L1075:
+	movq	1040(%rbx), %rdx	# 7399	[c=9 l=7]  *movdi_internal/3
+	movb	%cl, (%rdx,%rax)	# 7400	[c=4 l=3]  *movqi_internal/8
+.L1077:
+	movl	(%rbx), %ebp	# 7412	[c=6 l=2]  *zero_extendsidi2/3
+	movq	%rbp, %rdx	# 16656	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbp	# 7414	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %rbp	# 7416	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%rbp), %eax	# 7417	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%edx, %eax	# 7418	[c=4 l=2]  *addsi_1/0
+	movl	%eax, (%rbx)	# 7419	[c=4 l=2]  *movsi_internal/1
+	jmp	*0(%rbp)	# 17730	[c=5 l=3]  *indirect_jump
+.L611:
+	leaq	-1(%r13), %rax	# 16245	[c=4 l=4]  *leadi
+	cmpq	%r12, %rax	# 1211	[c=4 l=3]  *cmpdi_1/0
+	jb	.L612	# 1212	[c=13 l=6]  *jcc
+	movq	56(%rbx), %rax	# 15009	[c=9 l=4]  *movdi_internal/3
+	cmpq	%rax, 48(%rbx)	# 1215	[c=13 l=4]  *cmpdi_1/0
+	jnb	.L1880	# 1216	[c=13 l=6]  *jcc
+.L613:
+	movl	(%rbx), %ebp	# 1223	[c=6 l=2]  *zero_extendsidi2/3
+	movl	$1, 96(%rbx)	# 1228	[c=4 l=7]  *movsi_internal/1
+	movq	%rbp, %rdx	# 16552	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbp	# 1225	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %rbp	# 1227	[c=13 l=7]  *adddi_1/1
+	movzbl	11(%rbp), %eax	# 1229	[c=13 l=4]  zero_extendqidi2/0
+	addq	%rax, %r12	# 1230	[c=4 l=3]  *adddi_1/0
+	movzwl	14(%rbp), %eax	# 1232	[c=13 l=4]  zero_extendhidi2/0
+	addq	%rax, 48(%rbx)	# 1233	[c=13 l=4]  *adddi_1/0
+	movq	%r12, 40(%rbx)	# 1231	[c=4 l=4]  *movdi_internal/5
+	movzbl	9(%rbp), %eax	# 1234	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%edx, %eax	# 1235	[c=4 l=2]  *addsi_1/0
+	movl	%eax, (%rbx)	# 1236	[c=4 l=2]  *movsi_internal/1
+	jmp	*0(%rbp)	# 17977	[c=5 l=3]  *indirect_jump
+.L620:
+	movzbl	10(%rbp), %eax	# 1362	[c=13 l=4]  *zero_extendqisi2/0
+	movzbl	100(%rbx), %ecx	# 1365	[c=13 l=4]  *zero_extendqisi2/0
+	movl	(%rbx), %ebp	# 1377	[c=6 l=2]  *zero_extendsidi2/3
+	movl	%eax, %edx	# 16557	[c=4 l=2]  *movsi_internal/0
+	notl	%eax	# 1364	[c=4 l=2]  *one_cmplsi2_1/0
+	andl	%ecx, %eax	# 1366	[c=4 l=2]  *andsi_1/0
+	movq	104(%rbx), %rcx	# 1369	[c=9 l=4]  *movdi_internal/3
+	movzbl	(%rcx), %edi	# 17968	[c=5 l=3]  *movqi_internal/4
+	andl	%eax, %edi	# 18861	[c=4 l=2]  *andsi_1/0
+	movl	%edi, %ecx	# 15013	[c=4 l=2]  *movqi_internal/1
+	orl	%edx, %ecx	# 16241	[c=4 l=2]  *iorsi_1/0
+	orl	%eax, %edx	# 16242	[c=4 l=2]  *iorsi_1/0
+	leaq	101(%rbx), %rax	# 16243	[c=4 l=4]  *leadi
+	movb	%dl, 100(%rbx)	# 1374	[c=4 l=3]  *movqi_internal/8
+	movq	%rbp, %rdx	# 16558	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbp	# 1379	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %rbp	# 1381	[c=13 l=7]  *adddi_1/1
+	movb	%cl, 101(%rbx)	# 1372	[c=4 l=3]  *movqi_internal/8
+	movq	%rax, 104(%rbx)	# 1376	[c=4 l=4]  *movdi_internal/5
+	movzbl	9(%rbp), %eax	# 1382	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%edx, %eax	# 1383	[c=4 l=2]  *addsi_1/0
+	movl	%eax, (%rbx)	# 1384	[c=4 l=2]  *movsi_internal/1
+	jmp	*0(%rbp)	# 17970	[c=5 l=3]  *indirect_jump
+.L621:
+	movzbl	10(%rbp), %ecx	# 1391	[c=13 l=4]  zero_extendqidi2/0
+	movzwl	12(%rbp), %edx	# 1390	[c=13 l=4]  *zero_extendhisi2/0
+	cmpl	$15, %ecx	# 1394	[c=4 l=3]  *cmpsi_1/0
+	jle	.L1881	# 1395	[c=13 l=6]  *jcc
+	movzbl	1004(%rbx,%rcx), %ecx	# 1411	[c=14 l=8]  *zero_extendqisi2/0
+	movzbl	100(%rbx), %eax	# 1407	[c=13 l=4]  *zero_extendqisi2/0
+	movl	(%rbx), %ebp	# 1425	[c=6 l=2]  *zero_extendsidi2/3
+	andl	$-65, %eax	# 1408	[c=4 l=3]  *andsi_1/0
+	testl	%edx, %ecx	# 1413	[c=4 l=2]  *testsi_1/0
+	movq	104(%rbx), %rdx	# 1417	[c=9 l=4]  *movdi_internal/3
+	setne	%cl	# 16236	[c=4 l=3]  *setcc_qi
+	movzbl	(%rdx), %edi	# 17964	[c=5 l=3]  *movqi_internal/4
+	movzbl	%cl, %ecx	# 16237	[c=4 l=3]  *zero_extendqisi2/0
+	sall	$6, %ecx	# 1416	[c=4 l=3]  *ashlsi3_1/0
+	andl	%eax, %edi	# 18860	[c=4 l=2]  *andsi_1/0
+	orl	$64, %eax	# 16239	[c=4 l=3]  *iorsi_1/0
+	movl	%edi, %edx	# 15015	[c=4 l=2]  *movqi_internal/1
+	movb	%al, 100(%rbx)	# 1422	[c=4 l=3]  *movqi_internal/8
+	leaq	101(%rbx), %rax	# 16240	[c=4 l=4]  *leadi
+	orl	%ecx, %edx	# 16238	[c=4 l=2]  *iorsi_1/0
+	movq	%rax, 104(%rbx)	# 1424	[c=4 l=4]  *movdi_internal/5
+	movb	%dl, 101(%rbx)	# 1420	[c=4 l=3]  *movqi_internal/8
+	movq	%rbp, %rdx	# 16559	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbp	# 1427	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %rbp	# 1429	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%rbp), %eax	# 1430	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%edx, %eax	# 1431	[c=4 l=2]  *addsi_1/0
+	movl	%eax, (%rbx)	# 1432	[c=4 l=2]  *movsi_internal/1
+	jmp	*0(%rbp)	# 17966	[c=5 l=3]  *indirect_jump
+.L623:
+	movl	5176(%rbx), %edx	# 1441	[c=9 l=6]  *movsi_internal/0
+	movl	$61, %eax	# 1443	[c=4 l=5]  *movsi_internal/0
+	movl	5180(%rbx), %ecx	# 1442	[c=9 l=6]  *movsi_internal/0
+	movl	$2, 96(%rbx)	# 1438	[c=4 l=7]  *movsi_internal/1
+	movzwl	12(%rbp), %r14d	# 1439	[c=13 l=5]  *zero_extendhisi2/0
+	movzbl	10(%rbp), %ebp	# 1440	[c=13 l=4]  *zero_extendqisi2/0
+	subl	%edx, %eax	# 1444	[c=4 l=2]  *subsi_1/0
+	cmpl	%ecx, %eax	# 1445	[c=4 l=2]  *cmpsi_1/0
+	jb	.L624	# 1446	[c=13 l=6]  *jcc
+	cmpb	$1, 1081(%rbx)	# 1450	[c=13 l=7]  *cmpqi_1/0
+	ja	.L1882	# 1451	[c=13 l=6]  *jcc
+	movq	1040(%rbx), %rax	# 13560	[c=9 l=7]  *movdi_internal/3
+	movzbl	61(%rax), %r8d	# 13561	[c=13 l=5]  *zero_extendqisi2/0
+.L626:
+	movzbl	62(%rax), %r15d	# 1488	[c=13 l=5]  *zero_extendqisi2/0
+.L628:
+	movl	996(%rbx), %esi	# 1494	[c=9 l=6]  *movsi_internal/0
+	movzbl	840(%rbx), %eax	# 1496	[c=13 l=7]  *zero_extendqisi2/0
+	sall	$8, %r15d	# 1491	[c=4 l=4]  *ashlsi3_1/0
+	orl	%r8d, %r15d	# 1492	[c=4 l=3]  *iorsi_1/0
+	leal	1(%rsi,%rax), %eax	# 1497	[c=5 l=4]  *leasi
+	cmpl	%eax, %r15d	# 1498	[c=4 l=3]  *cmpsi_1/0
+	jb	.L1883	# 1499	[c=13 l=6]  *jcc
+	movl	%r15d, %eax	# 15016	[c=4 l=3]  *movsi_internal/0
+	movl	(%rbx), %esi	# 1507	[c=5 l=2]  *movsi_internal/0
+	leal	-1(%r15), %r8d	# 16235	[c=4 l=4]  *leasi
+	subl	%edx, %eax	# 1509	[c=4 l=2]  *subsi_1/0
+	cmpl	%ecx, %eax	# 1510	[c=4 l=2]  *cmpsi_1/0
+	jb	.L630	# 1511	[c=13 l=2]  *jcc
+	movl	%r15d, %eax	# 15018	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %eax	# 1513	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 14815	[c=5 l=5]  *andsi_1_zext
+	cmpb	$0, 1080(%rbx,%rax)	# 1516	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L631	# 1517	[c=13 l=6]  *jcc
+.L630:
+	movq	1040(%rbx), %rdx	# 1521	[c=9 l=7]  *movdi_internal/3
+	movslq	%r15d, %rax	# 1520	[c=4 l=3]  *extendsidi2_rex64/1
+	movb	%sil, (%rdx,%rax)	# 1522	[c=4 l=4]  *movqi_internal/8
+.L632:
+	movl	(%rbx), %edx	# 15020	[c=5 l=2]  *movsi_internal/0
+	movl	%r8d, %ecx	# 15022	[c=4 l=3]  *movsi_internal/0
+	leal	-2(%r15), %eax	# 16234	[c=4 l=4]  *leasi
+	subl	5176(%rbx), %ecx	# 1536	[c=13 l=6]  *subsi_1/1
+	shrl	$8, %edx	# 1534	[c=4 l=3]  *lshrsi3_1/0
+	cmpl	5180(%rbx), %ecx	# 1537	[c=13 l=6]  *cmpsi_1/1
+	jb	.L633	# 1538	[c=13 l=2]  *jcc
+	movl	%r8d, %ecx	# 15024	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %ecx	# 1540	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %ecx	# 14814	[c=5 l=6]  *andsi_1_zext
+	cmpb	$0, 1080(%rbx,%rcx)	# 1543	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L634	# 1544	[c=13 l=6]  *jcc
+.L633:
+	movq	1040(%rbx), %rcx	# 1548	[c=9 l=7]  *movdi_internal/3
+	movslq	%r8d, %r8	# 1547	[c=4 l=3]  *extendsidi2_rex64/1
+	movb	%dl, (%rcx,%r8)	# 1549	[c=4 l=4]  *movqi_internal/8
+.L635:
+	cmpb	$0, 840(%rbx)	# 1560	[c=13 l=7]  *cmpqi_ccno_1/1
+	je	.L636	# 1561	[c=13 l=2]  *jcc
+	movl	(%rbx), %edx	# 15026	[c=5 l=2]  *movsi_internal/0
+	movl	%eax, %ecx	# 15028	[c=4 l=2]  *movsi_internal/0
+	subl	$3, %r15d	# 1565	[c=4 l=4]  *addsi_1/0
+	subl	5176(%rbx), %ecx	# 1566	[c=13 l=6]  *subsi_1/1
+	shrl	$16, %edx	# 1564	[c=4 l=3]  *lshrsi3_1/0
+	cmpl	5180(%rbx), %ecx	# 1567	[c=13 l=6]  *cmpsi_1/1
+	jb	.L637	# 1568	[c=13 l=2]  *jcc
+	movl	%eax, %ecx	# 15030	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %ecx	# 1570	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %ecx	# 14813	[c=5 l=6]  *andsi_1_zext
+	cmpb	$0, 1080(%rbx,%rcx)	# 1573	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L638	# 1574	[c=13 l=6]  *jcc
+.L637:
+	movq	1040(%rbx), %rcx	# 1578	[c=9 l=7]  *movdi_internal/3
+	cltq	# 1577	[c=4 l=2]  *extendsidi2_rex64/0
+	movb	%dl, (%rcx,%rax)	# 1579	[c=4 l=3]  *movqi_internal/8
+.L639:
+	movl	%r15d, %eax	# 9	[c=4 l=3]  *movsi_internal/0
+.L636:
+	movl	$61, %edx	# 1594	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%rbx), %edx	# 1595	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %edx	# 1596	[c=13 l=6]  *cmpsi_1/1
+	jb	.L640	# 1597	[c=13 l=2]  *jcc
+	cmpb	$1, 1081(%rbx)	# 1601	[c=13 l=7]  *cmpqi_1/0
+	ja	.L1884	# 1602	[c=13 l=6]  *jcc
+.L640:
+	movq	1040(%rbx), %rdx	# 1613	[c=9 l=7]  *movdi_internal/3
+	movb	%al, 61(%rdx)	# 1614	[c=4 l=3]  *movqi_internal/8
+.L641:
+	movl	$62, %edx	# 1618	[c=4 l=5]  *movsi_internal/0
+	sarl	$8, %eax	# 1617	[c=4 l=3]  *ashrsi3_1/0
+	subl	5176(%rbx), %edx	# 1619	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %edx	# 1620	[c=13 l=6]  *cmpsi_1/1
+	jb	.L642	# 1621	[c=13 l=2]  *jcc
+	cmpb	$1, 1081(%rbx)	# 1625	[c=13 l=7]  *cmpqi_1/0
+	ja	.L1885	# 1626	[c=13 l=6]  *jcc
+.L642:
+	movq	1040(%rbx), %rdx	# 1637	[c=9 l=7]  *movdi_internal/3
+	movb	%al, 62(%rdx)	# 1638	[c=4 l=3]  *movqi_internal/8
+.L643:
+	sall	$16, %ebp	# 1641	[c=4 l=3]  *ashlsi3_1/0
+	orl	%r14d, %ebp	# 1642	[c=4 l=3]  *iorsi_1/0
+	movl	%ebp, (%rbx)	# 1643	[c=4 l=2]  *movsi_internal/1
+	cmpl	%ebp, 992(%rbx)	# 1644	[c=13 l=6]  *cmpsi_1/0
+	jb	.L1886	# 1645	[c=13 l=6]  *jcc
+	movzbl	840(%rbx), %eax	# 1653	[c=13 l=7]  zero_extendqidi2/0
+	leaq	-1(%r13), %rdx	# 16233	[c=4 l=4]  *leadi
+	addq	48(%rbx), %rax	# 1655	[c=13 l=4]  *adddi_1/1
+	movq	%rax, 48(%rbx)	# 1656	[c=4 l=4]  *movdi_internal/5
+	cmpq	%r12, %rdx	# 1658	[c=4 l=3]  *cmpdi_1/0
+	jb	.L612	# 1659	[c=13 l=6]  *jcc
+	cmpq	56(%rbx), %rax	# 1661	[c=13 l=4]  *cmpdi_1/1
+	jnb	.L1887	# 1662	[c=13 l=6]  *jcc
+.L645:
+	movl	(%rbx), %ebp	# 1669	[c=6 l=2]  *zero_extendsidi2/3
+	movl	$1, 96(%rbx)	# 1674	[c=4 l=7]  *movsi_internal/1
+	movq	%rbp, %rdx	# 16560	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbp	# 1671	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %rbp	# 1673	[c=13 l=7]  *adddi_1/1
+	movzbl	11(%rbp), %eax	# 1675	[c=13 l=4]  zero_extendqidi2/0
+	addq	%rax, %r12	# 1676	[c=4 l=3]  *adddi_1/0
+	movzwl	14(%rbp), %eax	# 1678	[c=13 l=4]  zero_extendhidi2/0
+	addq	%rax, 48(%rbx)	# 1679	[c=13 l=4]  *adddi_1/0
+	movq	%r12, 40(%rbx)	# 1677	[c=4 l=4]  *movdi_internal/5
+	movzbl	9(%rbp), %eax	# 1680	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%edx, %eax	# 1681	[c=4 l=2]  *addsi_1/0
+	movl	%eax, (%rbx)	# 1682	[c=4 l=2]  *movsi_internal/1
+	jmp	*0(%rbp)	# 17961	[c=5 l=3]  *indirect_jump
+.L646:
+	movzwl	12(%rbp), %r15d	# 1688	[c=13 l=5]  *zero_extendhisi2/0
+	movzbl	10(%rbp), %ebp	# 1689	[c=13 l=4]  *zero_extendqisi2/0
+	movl	%ebp, %eax	# 15032	[c=4 l=2]  *movsi_internal/0
+	movl	%ebp, %r14d	# 16561	[c=4 l=3]  *movsi_internal/0
+	subl	5176(%rbx), %eax	# 1692	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %eax	# 1693	[c=13 l=6]  *cmpsi_1/1
+	jb	.L647	# 1694	[c=13 l=2]  *jcc
+	movl	%ebp, %eax	# 15034	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %eax	# 1696	[c=4 l=3]  *ashrsi3_1/0
+	cltq	# 1697	[c=4 l=2]  *extendsidi2_rex64/0
+	cmpb	$0, 1080(%rbx,%rax)	# 1698	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L648	# 1699	[c=13 l=6]  *jcc
+.L647:
+	movq	1040(%rbx), %rdx	# 1703	[c=9 l=7]  *movdi_internal/3
+	movzbl	%r14b, %eax	# 1702	[c=4 l=4]  zero_extendqidi2/0
+	movzbl	(%rdx,%rax), %ecx	# 1704	[c=13 l=4]  *zero_extendqisi2/0
+.L649:
+	cmpl	6564(%rbx), %ebp	# 1715	[c=13 l=6]  *cmpsi_1/1
+	jb	.L1888	# 1716	[c=13 l=6]  *jcc
+.L650:
+	movl	%r15d, %eax	# 15036	[c=4 l=3]  *movsi_internal/0
+	notl	%eax	# 1725	[c=4 l=2]  *one_cmplsi2_1/0
+	andl	%ecx, %eax	# 1726	[c=4 l=2]  *andsi_1/0
+	movl	%eax, %edx	# 15039	[c=4 l=2]  *movsi_internal/0
+.L651:
+	movl	%ebp, %eax	# 15040	[c=4 l=2]  *movsi_internal/0
+	subl	5176(%rbx), %eax	# 1729	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %eax	# 1730	[c=13 l=6]  *cmpsi_1/1
+	jb	.L652	# 1731	[c=13 l=2]  *jcc
+	movl	%ebp, %eax	# 15042	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %eax	# 1733	[c=4 l=3]  *ashrsi3_1/0
+	cltq	# 1734	[c=4 l=2]  *extendsidi2_rex64/0
+	cmpb	$0, 1080(%rbx,%rax)	# 1735	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L653	# 1736	[c=13 l=6]  *jcc
+.L652:
+	movq	1040(%rbx), %rcx	# 1740	[c=9 l=7]  *movdi_internal/3
+	movzbl	%r14b, %eax	# 1739	[c=4 l=4]  zero_extendqidi2/0
+	movb	%dl, (%rcx,%rax)	# 1741	[c=4 l=3]  *movqi_internal/8
+.L654:
+	movl	(%rbx), %ebp	# 1752	[c=6 l=2]  *zero_extendsidi2/3
+	movq	%rbp, %rdx	# 16562	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbp	# 1754	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %rbp	# 1756	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%rbp), %eax	# 1757	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%edx, %eax	# 1758	[c=4 l=2]  *addsi_1/0
+	movl	%eax, (%rbx)	# 1759	[c=4 l=2]  *movsi_internal/1
+	jmp	*0(%rbp)	# 17959	[c=5 l=3]  *indirect_jump
+.L655:
+	movzbl	10(%rbp), %ecx	# 1765	[c=13 l=4]  zero_extendqidi2/0
+	cmpl	$15, %ecx	# 1768	[c=4 l=3]  *cmpsi_1/0
+	jle	.L1889	# 1769	[c=13 l=6]  *jcc
+	movzbl	1004(%rbx,%rcx), %edx	# 15044	[c=10 l=8]  *movqi_internal/4
+	leaq	flag_update_table_logical(%rip), %rsi	# 14827	[c=1 l=7]  *movdi_internal/4
+	notl	%edx	# 16229	[c=4 l=2]  *one_cmplsi2_1/0
+	movb	%dl, 1004(%rbx,%rcx)	# 1785	[c=4 l=7]  *movqi_internal/8
+	movq	104(%rbx), %rcx	# 1788	[c=9 l=4]  *movdi_internal/3
+	movzbl	%dl, %edx	# 1792	[c=4 l=3]  zero_extendqidi2/0
+	movzbl	100(%rbx), %eax	# 1786	[c=13 l=4]  *zero_extendqisi2/0
+	movl	(%rbx), %ebp	# 1800	[c=6 l=2]  *zero_extendsidi2/3
+	movzbl	(%rcx), %edi	# 17955	[c=5 l=3]  *movqi_internal/4
+	andl	$-32, %eax	# 1787	[c=4 l=3]  *andsi_1/0
+	andl	%eax, %edi	# 18859	[c=4 l=2]  *andsi_1/0
+	orl	$31, %eax	# 16231	[c=4 l=3]  *iorsi_1/0
+	movl	%edi, %ecx	# 15047	[c=4 l=2]  *movqi_internal/1
+	orb	(%rsi,%rdx), %cl	# 1793	[c=13 l=3]  *iorqi_1/1
+	movb	%al, 100(%rbx)	# 1797	[c=4 l=3]  *movqi_internal/8
+	leaq	101(%rbx), %rax	# 16232	[c=4 l=4]  *leadi
+	movl	%ecx, %edx	# 15049	[c=4 l=2]  *movqi_internal/0
+	movq	%rax, 104(%rbx)	# 1799	[c=4 l=4]  *movdi_internal/5
+	orl	$1, %edx	# 16230	[c=4 l=3]  *iorsi_1/0
+	movb	%dl, 101(%rbx)	# 1795	[c=4 l=3]  *movqi_internal/8
+	movq	%rbp, %rdx	# 16563	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbp	# 1802	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %rbp	# 1804	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%rbp), %eax	# 1805	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%edx, %eax	# 1806	[c=4 l=2]  *addsi_1/0
+	movl	%eax, (%rbx)	# 1807	[c=4 l=2]  *movsi_internal/1
+	jmp	*0(%rbp)	# 17957	[c=5 l=3]  *indirect_jump
+.L657:
+	movzbl	10(%rbp), %eax	# 1814	[c=13 l=4]  zero_extendqidi2/0
+	movzwl	12(%rbp), %ecx	# 1813	[c=13 l=4]  zero_extendhidi2/0
+	cmpl	$15, %eax	# 1817	[c=4 l=3]  *cmpsi_1/0
+	jle	.L1890	# 1818	[c=13 l=6]  *jcc
+	movzbl	1004(%rbx,%rax), %eax	# 1831	[c=14 l=8]  *zero_extendqisi2/0
+	movl	%eax, %edx	# 16564	[c=4 l=2]  *movsi_internal/0
+	cmpl	$15, %ecx	# 1835	[c=4 l=3]  *cmpsi_1/0
+	jle	.L1891	# 1836	[c=13 l=6]  *jcc
+	movzbl	1004(%rbx,%rcx), %ecx	# 1849	[c=14 l=8]  *zero_extendqisi2/0
+	andl	$136, %edx	# 1851	[c=4 l=6]  *andsi_1/0
+	movl	%ecx, %esi	# 15050	[c=4 l=2]  *movsi_internal/0
+	subl	%ecx, %eax	# 1857	[c=4 l=2]  *subsi_1/0
+	andl	$136, %esi	# 1854	[c=4 l=6]  *andsi_1/0
+	andl	$511, %eax	# 1858	[c=4 l=5]  *andsi_1/0
+	leal	(%rsi,%rdx,2), %edx	# 1855	[c=8 l=3]  *leasi
+	imull	$260, %edx, %edx	# 1859	[c=12 l=6]  *mulsi3_1/1
+	andl	$7680, %edx	# 1860	[c=4 l=6]  *andsi_1/0
+	orl	%edx, %eax	# 1861	[c=5 l=2]  *iorsi_1_zext
+	movzbl	100(%rbx), %edx	# 1862	[c=9 l=4]  *movqi_internal/4
+	movl	%edx, %ecx	# 15052	[c=4 l=2]  *movsi_internal/0
+	andl	$192, %ecx	# 1865	[c=4 l=6]  *andsi_2/0
+	jne	.L660	# 1866	[c=13 l=6]  *jcc
+	leaq	flag_update_table_sub8(%rip), %rdx	# 1869	[c=1 l=7]  *movdi_internal/4
+	addq	%rdx, %rax	# 1870	[c=4 l=3]  *adddi_1/0
+	movl	$63, %edx	# 11	[c=4 l=5]  *movqi_internal/3
+.L661:
+	movl	(%rbx), %ebp	# 1889	[c=6 l=2]  *zero_extendsidi2/3
+	movb	%dl, 100(%rbx)	# 1888	[c=4 l=3]  *movqi_internal/8
+	movq	%rax, 104(%rbx)	# 1887	[c=4 l=4]  *movdi_internal/5
+	movq	%rbp, %rdx	# 16565	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbp	# 1891	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %rbp	# 1893	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%rbp), %eax	# 1894	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%edx, %eax	# 1895	[c=4 l=2]  *addsi_1/0
+	movl	%eax, (%rbx)	# 1896	[c=4 l=2]  *movsi_internal/1
+	jmp	*0(%rbp)	# 17952	[c=5 l=3]  *indirect_jump
+.L665:
+	movzwl	12(%rbp), %esi	# 1991	[c=13 l=4]  *zero_extendhisi2/0
+	movzbl	10(%rbp), %ecx	# 1993	[c=13 l=4]  zero_extendqidi2/0
+	movl	%esi, %eax	# 16569	[c=4 l=2]  *movsi_internal/0
+	cmpl	$15, %ecx	# 1996	[c=4 l=3]  *cmpsi_1/0
+	jle	.L1892	# 1997	[c=13 l=6]  *jcc
+	movzbl	1004(%rbx,%rcx), %edx	# 2010	[c=14 l=8]  *zero_extendqisi2/0
+	andl	$136, %eax	# 2015	[c=4 l=5]  *andsi_1/0
+	movl	%edx, %ecx	# 15060	[c=4 l=2]  *movsi_internal/0
+	subl	%esi, %edx	# 2020	[c=4 l=2]  *subsi_1/0
+	andl	$136, %ecx	# 2012	[c=4 l=6]  *andsi_1/0
+	andl	$511, %edx	# 2021	[c=4 l=6]  *andsi_1/0
+	leal	(%rax,%rcx,2), %eax	# 2016	[c=8 l=3]  *leasi
+	imull	$260, %eax, %eax	# 2017	[c=12 l=6]  *mulsi3_1/1
+	andl	$7680, %eax	# 2018	[c=4 l=5]  *andsi_1/0
+	orl	%edx, %eax	# 2022	[c=5 l=2]  *iorsi_1_zext
+	movzbl	100(%rbx), %edx	# 2023	[c=9 l=4]  *movqi_internal/4
+	movl	%edx, %ecx	# 15062	[c=4 l=2]  *movsi_internal/0
+	andl	$192, %ecx	# 2026	[c=4 l=6]  *andsi_2/0
+	jne	.L667	# 2027	[c=13 l=6]  *jcc
+	leaq	flag_update_table_sub8(%rip), %rdx	# 2030	[c=1 l=7]  *movdi_internal/4
+	addq	%rdx, %rax	# 2031	[c=4 l=3]  *adddi_1/0
+	movl	$63, %edx	# 12	[c=4 l=5]  *movqi_internal/3
+.L668:
+	movl	(%rbx), %ebp	# 2050	[c=6 l=2]  *zero_extendsidi2/3
+	movb	%dl, 100(%rbx)	# 2049	[c=4 l=3]  *movqi_internal/8
+	movq	%rax, 104(%rbx)	# 2048	[c=4 l=4]  *movdi_internal/5
+	movq	%rbp, %rdx	# 16570	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbp	# 2052	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %rbp	# 2054	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%rbp), %eax	# 2055	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%edx, %eax	# 2056	[c=4 l=2]  *addsi_1/0
+	movl	%eax, (%rbx)	# 2057	[c=4 l=2]  *movsi_internal/1
+	jmp	*0(%rbp)	# 17947	[c=5 l=3]  *indirect_jump
+.L669:
+	movl	$2, 96(%rbx)	# 2063	[c=4 l=7]  *movsi_internal/1
+	movzbl	10(%rbp), %eax	# 2065	[c=13 l=4]  zero_extendqidi2/0
+	movzwl	12(%rbp), %ecx	# 2064	[c=13 l=4]  zero_extendhidi2/0
+	cmpl	$15, %eax	# 2068	[c=4 l=3]  *cmpsi_1/0
+	jle	.L1893	# 2069	[c=13 l=6]  *jcc
+	movzbl	1004(%rbx,%rax), %eax	# 2082	[c=10 l=8]  *movqi_internal/4
+	cmpl	$15, %ecx	# 2085	[c=4 l=3]  *cmpsi_1/0
+	jle	.L1894	# 2086	[c=13 l=6]  *jcc
+	cmpb	%al, 1004(%rbx,%rcx)	# 2099	[c=14 l=7]  *cmpqi_1/0
+	je	.L1895	# 2100	[c=13 l=6]  *jcc
+.L672:
+	leaq	-1(%r13), %rax	# 16219	[c=4 l=4]  *leadi
+	cmpq	%r12, %rax	# 2112	[c=4 l=3]  *cmpdi_1/0
+	jb	.L612	# 2113	[c=13 l=6]  *jcc
+	movq	56(%rbx), %rax	# 15065	[c=9 l=4]  *movdi_internal/3
+	cmpq	%rax, 48(%rbx)	# 2116	[c=13 l=4]  *cmpdi_1/0
+	jnb	.L1896	# 2117	[c=13 l=6]  *jcc
+.L673:
+	movl	(%rbx), %ebp	# 2124	[c=6 l=2]  *zero_extendsidi2/3
+	movl	$1, 96(%rbx)	# 2129	[c=4 l=7]  *movsi_internal/1
+	movq	%rbp, %rdx	# 16571	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbp	# 2126	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %rbp	# 2128	[c=13 l=7]  *adddi_1/1
+	movzbl	11(%rbp), %eax	# 2130	[c=13 l=4]  zero_extendqidi2/0
+	addq	%rax, %r12	# 2131	[c=4 l=3]  *adddi_1/0
+	movzwl	14(%rbp), %eax	# 2133	[c=13 l=4]  zero_extendhidi2/0
+	addq	%rax, 48(%rbx)	# 2134	[c=13 l=4]  *adddi_1/0
+	movq	%r12, 40(%rbx)	# 2132	[c=4 l=4]  *movdi_internal/5
+	movzbl	9(%rbp), %eax	# 2135	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%edx, %eax	# 2136	[c=4 l=2]  *addsi_1/0
+	movl	%eax, (%rbx)	# 2137	[c=4 l=2]  *movsi_internal/1
+	jmp	*0(%rbp)	# 17942	[c=5 l=3]  *indirect_jump
+.L674:
+	movl	$2, 96(%rbx)	# 2143	[c=4 l=7]  *movsi_internal/1
+	movzbl	10(%rbp), %eax	# 2145	[c=13 l=4]  zero_extendqidi2/0
+	movzwl	12(%rbp), %ecx	# 2144	[c=13 l=4]  zero_extendhidi2/0
+	cmpl	$15, %eax	# 2148	[c=4 l=3]  *cmpsi_1/0
+	jle	.L1897	# 2149	[c=13 l=6]  *jcc
+	movzbl	1004(%rbx,%rax), %eax	# 2162	[c=10 l=8]  *movqi_internal/4
+	cmpl	$15, %ecx	# 2165	[c=4 l=3]  *cmpsi_1/0
+	jle	.L1898	# 2166	[c=13 l=6]  *jcc
+	cmpb	%al, 1004(%rbx,%rcx)	# 2179	[c=14 l=7]  *cmpqi_1/0
+	je	.L1899	# 2180	[c=13 l=6]  *jcc
+.L677:
+	leaq	-1(%r13), %rax	# 16218	[c=4 l=4]  *leadi
+	cmpq	%r12, %rax	# 2192	[c=4 l=3]  *cmpdi_1/0
+	jb	.L612	# 2193	[c=13 l=6]  *jcc
+	movq	56(%rbx), %rax	# 15067	[c=9 l=4]  *movdi_internal/3
+	cmpq	%rax, 48(%rbx)	# 2196	[c=13 l=4]  *cmpdi_1/0
+	jnb	.L1900	# 2197	[c=13 l=6]  *jcc
+.L678:
+	movl	(%rbx), %ebp	# 2204	[c=6 l=2]  *zero_extendsidi2/3
+	movl	$1, 96(%rbx)	# 2209	[c=4 l=7]  *movsi_internal/1
+	movq	%rbp, %rdx	# 16572	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbp	# 2206	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %rbp	# 2208	[c=13 l=7]  *adddi_1/1
+	movzbl	11(%rbp), %eax	# 2210	[c=13 l=4]  zero_extendqidi2/0
+	addq	%rax, %r12	# 2211	[c=4 l=3]  *adddi_1/0
+	movzwl	14(%rbp), %eax	# 2213	[c=13 l=4]  zero_extendhidi2/0
+	addq	%rax, 48(%rbx)	# 2214	[c=13 l=4]  *adddi_1/0
+	movq	%r12, 40(%rbx)	# 2212	[c=4 l=4]  *movdi_internal/5
+	movzbl	9(%rbp), %eax	# 2215	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%edx, %eax	# 2216	[c=4 l=2]  *addsi_1/0
+	movl	%eax, (%rbx)	# 2217	[c=4 l=2]  *movsi_internal/1
+	jmp	*0(%rbp)	# 17937	[c=5 l=3]  *indirect_jump
+.L679:
+	movzbl	10(%rbp), %ecx	# 2223	[c=13 l=4]  zero_extendqidi2/0
+	cmpl	$15, %ecx	# 2226	[c=4 l=3]  *cmpsi_1/0
+	jle	.L1901	# 2227	[c=13 l=6]  *jcc
+	movzbl	1004(%rbx,%rcx), %edx	# 2240	[c=10 l=8]  *movqi_internal/4
+	leal	-1(%rdx), %eax	# 16216	[c=4 l=3]  *leasi
+	subl	$1, %edx	# 16217	[c=4 l=3]  *addsi_1/0
+	movb	%dl, 1004(%rbx,%rcx)	# 2246	[c=4 l=7]  *movqi_internal/8
+	movzbl	100(%rbx), %edx	# 2247	[c=9 l=4]  *movqi_internal/4
+	movzbl	%al, %eax	# 2243	[c=4 l=3]  zero_extendqidi2/0
+	movl	%edx, %ecx	# 15068	[c=4 l=2]  *movsi_internal/0
+	andl	$225, %ecx	# 2250	[c=4 l=6]  *andsi_2/0
+	jne	.L681	# 2251	[c=13 l=6]  *jcc
+	leaq	flag_update_table_dec(%rip), %rdx	# 2254	[c=1 l=7]  *movdi_internal/4
+	addq	%rdx, %rax	# 2255	[c=4 l=3]  *adddi_1/0
+	movl	$30, %edx	# 13	[c=4 l=5]  *movqi_internal/3
+.L682:
+	movl	(%rbx), %ebp	# 2274	[c=6 l=2]  *zero_extendsidi2/3
+	movb	%dl, 100(%rbx)	# 2273	[c=4 l=3]  *movqi_internal/8
+	movq	%rax, 104(%rbx)	# 2272	[c=4 l=4]  *movdi_internal/5
+	movq	%rbp, %rdx	# 16573	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbp	# 2276	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %rbp	# 2278	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%rbp), %eax	# 2279	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%edx, %eax	# 2280	[c=4 l=2]  *addsi_1/0
+	movl	%eax, (%rbx)	# 2281	[c=4 l=2]  *movsi_internal/1
+	jmp	*0(%rbp)	# 17935	[c=5 l=3]  *indirect_jump
+.L683:
+	movl	(%rbx), %eax	# 15070	[c=5 l=2]  *movsi_internal/0
+	movq	1056(%rbx), %rdx	# 2292	[c=9 l=7]  *movdi_internal/3
+	movl	$8, %esi	# 2298	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 2299	[c=4 l=3]  *movdi_internal/3
+	subl	$1, %eax	# 2288	[c=4 l=3]  *addsi_1/0
+	movl	%eax, (%rbx)	# 2289	[c=4 l=2]  *movsi_internal/1
+	addl	%eax, %eax	# 2290	[c=5 l=2]  *ashlsi3_1_zext/0
+	movzwl	(%rdx,%rax), %ecx	# 2293	[c=13 l=4]  *zero_extendhisi2/0
+	movl	$1, 72(%rbx)	# 2294	[c=4 l=7]  *movsi_internal/1
+	leaq	.LC45(%rip), %rdx	# 2296	[c=1 l=7]  *movdi_internal/4
+	xorl	%eax, %eax	# 17934	[c=4 l=2]  *movdi_xor
+	call	leave	# 2301	[c=0 l=5]  *call
+.L684:
+	cmpb	$0, 841(%rbx)	# 2306	[c=13 l=7]  *cmpqi_ccno_1/1
+	movl	$2, 96(%rbx)	# 2305	[c=4 l=7]  *movsi_internal/1
+	je	.L1902	# 2307	[c=13 l=6]  *jcc
+	movl	5176(%rbx), %r14d	# 2328	[c=9 l=7]  *movsi_internal/0
+	movl	$62, %eax	# 2330	[c=4 l=5]  *movsi_internal/0
+	movl	5180(%rbx), %r15d	# 2329	[c=9 l=7]  *movsi_internal/0
+	subl	%r14d, %eax	# 2331	[c=4 l=3]  *subsi_1/0
+	movl	%eax, %ebp	# 15073	[c=4 l=2]  *movsi_internal/0
+	movl	$61, %eax	# 2332	[c=4 l=5]  *movsi_internal/0
+	subl	%r14d, %eax	# 2333	[c=4 l=3]  *subsi_1/0
+	cmpl	%r15d, %eax	# 2334	[c=4 l=3]  *cmpsi_1/0
+	jb	.L686	# 2335	[c=13 l=6]  *jcc
+	cmpb	$1, 1081(%rbx)	# 2339	[c=13 l=7]  *cmpqi_1/0
+	ja	.L1903	# 2340	[c=13 l=6]  *jcc
+	movq	1040(%rbx), %rax	# 13566	[c=9 l=7]  *movdi_internal/3
+	movzbl	61(%rax), %edx	# 13567	[c=13 l=4]  *zero_extendqisi2/0
+.L688:
+	movzbl	62(%rax), %ebp	# 2373	[c=13 l=4]  *zero_extendqisi2/0
+.L690:
+	sall	$8, %ebp	# 2376	[c=4 l=3]  *ashlsi3_1/0
+	movzbl	840(%rbx), %eax	# 2381	[c=13 l=7]  *zero_extendqisi2/0
+	orl	%edx, %ebp	# 2377	[c=4 l=2]  *iorsi_1/0
+	movl	996(%rbx), %edx	# 2379	[c=9 l=6]  *movsi_internal/0
+	leal	1(%rdx,%rax), %eax	# 2382	[c=5 l=4]  *leasi
+	cmpl	%eax, %ebp	# 2383	[c=4 l=2]  *cmpsi_1/0
+	jb	.L1904	# 2384	[c=13 l=6]  *jcc
+	movl	%ebp, %edx	# 15074	[c=4 l=2]  *movsi_internal/0
+	movl	(%rbx), %ecx	# 2392	[c=5 l=2]  *movsi_internal/0
+	leal	-1(%rbp), %eax	# 16213	[c=4 l=3]  *leasi
+	subl	%r14d, %edx	# 2394	[c=4 l=3]  *subsi_1/0
+	cmpl	%r15d, %edx	# 2395	[c=4 l=3]  *cmpsi_1/0
+	jb	.L692	# 2396	[c=13 l=2]  *jcc
+	movl	%ebp, %edx	# 15076	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %edx	# 2398	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %edx	# 14812	[c=5 l=6]  *andsi_1_zext
+	cmpb	$0, 1080(%rbx,%rdx)	# 2401	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L693	# 2402	[c=13 l=6]  *jcc
+.L692:
+	movq	1040(%rbx), %rsi	# 2406	[c=9 l=7]  *movdi_internal/3
+	movslq	%ebp, %rdx	# 2405	[c=4 l=3]  *extendsidi2_rex64/1
+	movb	%cl, (%rsi,%rdx)	# 2407	[c=4 l=3]  *movqi_internal/8
+.L694:
+	movl	(%rbx), %edx	# 15078	[c=5 l=2]  *movsi_internal/0
+	movl	%eax, %ecx	# 15080	[c=4 l=2]  *movsi_internal/0
+	leal	-2(%rbp), %r14d	# 16212	[c=4 l=4]  *leasi
+	subl	5176(%rbx), %ecx	# 2421	[c=13 l=6]  *subsi_1/1
+	shrl	$8, %edx	# 2419	[c=4 l=3]  *lshrsi3_1/0
+	cmpl	5180(%rbx), %ecx	# 2422	[c=13 l=6]  *cmpsi_1/1
+	jb	.L695	# 2423	[c=13 l=2]  *jcc
+	movl	%eax, %ecx	# 15082	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %ecx	# 2425	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %ecx	# 14811	[c=5 l=6]  *andsi_1_zext
+	cmpb	$0, 1080(%rbx,%rcx)	# 2428	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L696	# 2429	[c=13 l=6]  *jcc
+.L695:
+	movq	1040(%rbx), %rcx	# 2433	[c=9 l=7]  *movdi_internal/3
+	cltq	# 2432	[c=4 l=2]  *extendsidi2_rex64/0
+	movb	%dl, (%rcx,%rax)	# 2434	[c=4 l=3]  *movqi_internal/8
+.L697:
+	cmpb	$0, 840(%rbx)	# 2445	[c=13 l=7]  *cmpqi_ccno_1/1
+	je	.L698	# 2446	[c=13 l=2]  *jcc
+	movl	(%rbx), %edx	# 15084	[c=5 l=2]  *movsi_internal/0
+	movl	%r14d, %eax	# 15086	[c=4 l=3]  *movsi_internal/0
+	subl	$3, %ebp	# 2450	[c=4 l=3]  *addsi_1/0
+	subl	5176(%rbx), %eax	# 2451	[c=13 l=6]  *subsi_1/1
+	shrl	$16, %edx	# 2449	[c=4 l=3]  *lshrsi3_1/0
+	cmpl	5180(%rbx), %eax	# 2452	[c=13 l=6]  *cmpsi_1/1
+	jb	.L699	# 2453	[c=13 l=2]  *jcc
+	movl	%r14d, %eax	# 15088	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %eax	# 2455	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 14810	[c=5 l=5]  *andsi_1_zext
+	cmpb	$0, 1080(%rbx,%rax)	# 2458	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L700	# 2459	[c=13 l=6]  *jcc
+.L699:
+	movq	1040(%rbx), %rax	# 2463	[c=9 l=7]  *movdi_internal/3
+	movslq	%r14d, %r14	# 2462	[c=4 l=3]  *extendsidi2_rex64/1
+	movb	%dl, (%rax,%r14)	# 2464	[c=4 l=4]  *movqi_internal/8
+.L701:
+	movl	%ebp, %r14d	# 14	[c=4 l=3]  *movsi_internal/0
+.L698:
+	movl	$61, %eax	# 2479	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%rbx), %eax	# 2480	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %eax	# 2481	[c=13 l=6]  *cmpsi_1/1
+	jb	.L702	# 2482	[c=13 l=2]  *jcc
+	cmpb	$1, 1081(%rbx)	# 2486	[c=13 l=7]  *cmpqi_1/0
+	ja	.L1905	# 2487	[c=13 l=6]  *jcc
+.L702:
+	movq	1040(%rbx), %rax	# 2498	[c=9 l=7]  *movdi_internal/3
+	movb	%r14b, 61(%rax)	# 2499	[c=4 l=4]  *movqi_internal/8
+.L703:
+	movl	$62, %eax	# 2503	[c=4 l=5]  *movsi_internal/0
+	sarl	$8, %r14d	# 2502	[c=4 l=4]  *ashrsi3_1/0
+	subl	5176(%rbx), %eax	# 2504	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %eax	# 2505	[c=13 l=6]  *cmpsi_1/1
+	jb	.L704	# 2506	[c=13 l=2]  *jcc
+	cmpb	$1, 1081(%rbx)	# 2510	[c=13 l=7]  *cmpqi_1/0
+	ja	.L1906	# 2511	[c=13 l=6]  *jcc
+.L704:
+	movq	1040(%rbx), %rax	# 2522	[c=9 l=7]  *movdi_internal/3
+	movb	%r14b, 62(%rax)	# 2523	[c=4 l=4]  *movqi_internal/8
+.L705:
+	movl	$60, %eax	# 2527	[c=4 l=5]  *movsi_internal/0
+	movzwl	1034(%rbx), %ebp	# 2526	[c=13 l=7]  *zero_extendhisi2/0
+	subl	5176(%rbx), %eax	# 2528	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %eax	# 2529	[c=13 l=6]  *cmpsi_1/1
+	jb	.L706	# 2530	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%rbx)	# 2532	[c=13 l=7]  *cmpqi_ccno_1/1
+	jne	.L707	# 2533	[c=13 l=6]  *jcc
+.L706:
+	movq	1040(%rbx), %rax	# 2536	[c=9 l=7]  *movdi_internal/3
+	movzbl	60(%rax), %esi	# 2537	[c=13 l=4]  *zero_extendqisi2/0
+.L708:
+	sall	$16, %esi	# 2548	[c=4 l=3]  *ashlsi3_1/0
+	orl	%ebp, %esi	# 2549	[c=4 l=2]  *iorsi_1/0
+	movl	%esi, (%rbx)	# 2550	[c=4 l=2]  *movsi_internal/1
+	cmpl	%esi, 992(%rbx)	# 2551	[c=13 l=6]  *cmpsi_1/0
+	jb	.L1907	# 2552	[c=13 l=6]  *jcc
+	leaq	-1(%r13), %rax	# 16211	[c=4 l=4]  *leadi
+	cmpq	%r12, %rax	# 2561	[c=4 l=3]  *cmpdi_1/0
+	jb	.L612	# 2562	[c=13 l=6]  *jcc
+	movq	56(%rbx), %rax	# 15090	[c=9 l=4]  *movdi_internal/3
+	cmpq	%rax, 48(%rbx)	# 2565	[c=13 l=4]  *cmpdi_1/0
+	jnb	.L1908	# 2566	[c=13 l=6]  *jcc
+.L710:
+	movl	(%rbx), %ebp	# 2573	[c=6 l=2]  *zero_extendsidi2/3
+	movl	$1, 96(%rbx)	# 2578	[c=4 l=7]  *movsi_internal/1
+	movq	%rbp, %rdx	# 16574	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbp	# 2575	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %rbp	# 2577	[c=13 l=7]  *adddi_1/1
+	movzbl	11(%rbp), %eax	# 2579	[c=13 l=4]  zero_extendqidi2/0
+	addq	%rax, %r12	# 2580	[c=4 l=3]  *adddi_1/0
+	movzwl	14(%rbp), %eax	# 2582	[c=13 l=4]  zero_extendhidi2/0
+	addq	%rax, 48(%rbx)	# 2583	[c=13 l=4]  *adddi_1/0
+	movq	%r12, 40(%rbx)	# 2581	[c=4 l=4]  *movdi_internal/5
+	movzbl	9(%rbp), %eax	# 2584	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%edx, %eax	# 2585	[c=4 l=2]  *addsi_1/0
+	movl	%eax, (%rbx)	# 2586	[c=4 l=2]  *movsi_internal/1
+	jmp	*0(%rbp)	# 17930	[c=5 l=3]  *indirect_jump
+.L711:
+	cmpb	$0, 841(%rbx)	# 2593	[c=13 l=7]  *cmpqi_ccno_1/1
+	movl	$2, 96(%rbx)	# 2592	[c=4 l=7]  *movsi_internal/1
+	je	.L1909	# 2594	[c=13 l=6]  *jcc
+	movl	$60, %eax	# 2616	[c=4 l=5]  *movsi_internal/0
+	movzwl	1034(%rbx), %ebp	# 2615	[c=13 l=7]  *zero_extendhisi2/0
+	subl	5176(%rbx), %eax	# 2617	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %eax	# 2618	[c=13 l=6]  *cmpsi_1/1
+	jb	.L713	# 2619	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%rbx)	# 2621	[c=13 l=7]  *cmpqi_ccno_1/1
+	jne	.L714	# 2622	[c=13 l=6]  *jcc
+.L713:
+	movq	1040(%rbx), %rax	# 2625	[c=9 l=7]  *movdi_internal/3
+	movzbl	60(%rax), %esi	# 2626	[c=13 l=4]  *zero_extendqisi2/0
+.L715:
+	sall	$16, %esi	# 2637	[c=4 l=3]  *ashlsi3_1/0
+	orl	%ebp, %esi	# 2638	[c=4 l=2]  *iorsi_1/0
+	movl	%esi, (%rbx)	# 2639	[c=4 l=2]  *movsi_internal/1
+	cmpl	%esi, 992(%rbx)	# 2640	[c=13 l=6]  *cmpsi_1/0
+	jb	.L1910	# 2641	[c=13 l=6]  *jcc
+	leaq	-1(%r13), %rax	# 16210	[c=4 l=4]  *leadi
+	cmpq	%r12, %rax	# 2650	[c=4 l=3]  *cmpdi_1/0
+	jb	.L612	# 2651	[c=13 l=6]  *jcc
+	movq	56(%rbx), %rax	# 15092	[c=9 l=4]  *movdi_internal/3
+	cmpq	%rax, 48(%rbx)	# 2654	[c=13 l=4]  *cmpdi_1/0
+	jnb	.L1911	# 2655	[c=13 l=6]  *jcc
+.L717:
+	movl	(%rbx), %ebp	# 2662	[c=6 l=2]  *zero_extendsidi2/3
+	movl	$1, 96(%rbx)	# 2667	[c=4 l=7]  *movsi_internal/1
+	movq	%rbp, %rdx	# 16575	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbp	# 2664	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %rbp	# 2666	[c=13 l=7]  *adddi_1/1
+	movzbl	11(%rbp), %eax	# 2668	[c=13 l=4]  zero_extendqidi2/0
+	addq	%rax, %r12	# 2669	[c=4 l=3]  *adddi_1/0
+	movzwl	14(%rbp), %eax	# 2671	[c=13 l=4]  zero_extendhidi2/0
+	addq	%rax, 48(%rbx)	# 2672	[c=13 l=4]  *adddi_1/0
+	movq	%r12, 40(%rbx)	# 2670	[c=4 l=4]  *movdi_internal/5
+	movzbl	9(%rbp), %eax	# 2673	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%edx, %eax	# 2674	[c=4 l=2]  *addsi_1/0
+	movl	%eax, (%rbx)	# 2675	[c=4 l=2]  *movsi_internal/1
+	jmp	*0(%rbp)	# 17926	[c=5 l=3]  *indirect_jump
+.L718:
+	movl	$59, %eax	# 2681	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%rbx), %eax	# 2682	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %eax	# 2683	[c=13 l=6]  *cmpsi_1/1
+	jb	.L719	# 2684	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%rbx)	# 2686	[c=13 l=7]  *cmpqi_ccno_1/1
+	jne	.L1912	# 2687	[c=13 l=6]  *jcc
+.L719:
+	xorl	%ecx, %ecx	# 17924	[c=4 l=2]  *movdi_xor
+	leaq	.LC52(%rip), %rdx	# 2695	[c=1 l=7]  *movdi_internal/4
+	movl	$1, %esi	# 2697	[c=4 l=5]  *movsi_internal/0
+	xorl	%eax, %eax	# 17925	[c=4 l=2]  *movdi_xor
+	movq	%rbx, %rdi	# 2698	[c=4 l=3]  *movdi_internal/3
+	call	leave	# 2700	[c=0 l=5]  *call
+.L720:
+	movl	$59, %eax	# 2706	[c=4 l=5]  *movsi_internal/0
+	movzbl	10(%rbp), %ebp	# 2704	[c=13 l=4]  zero_extendqidi2/0
+	movzwl	1034(%rbx), %r14d	# 2705	[c=13 l=8]  *zero_extendhisi2/0
+	subl	5176(%rbx), %eax	# 2707	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %eax	# 2708	[c=13 l=6]  *cmpsi_1/1
+	jb	.L721	# 2709	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%rbx)	# 2711	[c=13 l=7]  *cmpqi_ccno_1/1
+	jne	.L722	# 2712	[c=13 l=6]  *jcc
+.L721:
+	movq	1040(%rbx), %rax	# 2715	[c=9 l=7]  *movdi_internal/3
+	movzbl	59(%rax), %eax	# 2716	[c=13 l=4]  *zero_extendqisi2/0
+.L723:
+	movl	992(%rbx), %edx	# 2727	[c=9 l=6]  *movsi_internal/0
+	sall	$16, %eax	# 2730	[c=4 l=3]  *ashlsi3_1/0
+	orl	%r14d, %eax	# 2731	[c=4 l=3]  *iorsi_1/0
+	leal	1(%rdx,%rdx), %edx	# 2729	[c=8 l=4]  *leasi
+	andl	%edx, %eax	# 2732	[c=4 l=2]  *andsi_1/0
+	movq	1056(%rbx), %rdx	# 2734	[c=9 l=7]  *movdi_internal/3
+	cltq	# 2733	[c=4 l=2]  *extendsidi2_rex64/0
+	movzbl	(%rdx,%rax), %eax	# 2735	[c=9 l=4]  *movqi_internal/4
+	cmpl	$15, %ebp	# 2738	[c=4 l=3]  *cmpsi_1/0
+	jle	.L1913	# 2739	[c=13 l=6]  *jcc
+	movb	%al, 1004(%rbx,%rbp)	# 2752	[c=4 l=7]  *movqi_internal/8
+	movl	(%rbx), %ebp	# 2753	[c=6 l=2]  *zero_extendsidi2/3
+	movq	%rbp, %rdx	# 16576	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbp	# 2755	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %rbp	# 2757	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%rbp), %eax	# 2758	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%edx, %eax	# 2759	[c=4 l=2]  *addsi_1/0
+	movl	%eax, (%rbx)	# 2760	[c=4 l=2]  *movsi_internal/1
+	jmp	*0(%rbp)	# 17922	[c=5 l=3]  *indirect_jump
+.L560:
+	movl	$2, 96(%rbx)	# 324	[c=4 l=7]  *movsi_internal/1
+	movl	(%rbx), %esi	# 325	[c=5 l=2]  *movsi_internal/0
+	movq	%rbx, %rdi	# 326	[c=4 l=3]  *movdi_internal/3
+	call	bad_PC	# 327	[c=0 l=5]  *call
+.L1088:
+	movzbl	10(%rbp), %ecx	# 7542	[c=13 l=4]  zero_extendqidi2/0
+	movzwl	1030(%rbx), %ebp	# 7543	[c=13 l=7]  *zero_extendhisi2/0
+	subl	$1, %ebp	# 7544	[c=4 l=3]  *addsi_1/0
+	cmpl	$15, %ecx	# 7547	[c=4 l=3]  *cmpsi_1/0
+	jle	.L1914	# 7548	[c=13 l=6]  *jcc
+	movl	%ebp, %eax	# 15353	[c=4 l=2]  *movsi_internal/0
+	movzbl	1004(%rbx,%rcx), %edx	# 7561	[c=14 l=8]  *zero_extendqisi2/0
+	subl	5176(%rbx), %eax	# 7562	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %eax	# 7563	[c=13 l=6]  *cmpsi_1/1
+	jb	.L1090	# 7564	[c=13 l=2]  *jcc
+	movl	%ebp, %eax	# 15355	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %eax	# 7566	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 14790	[c=5 l=5]  *andsi_1_zext
+	cmpb	$0, 1080(%rbx,%rax)	# 7569	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L1091	# 7570	[c=13 l=6]  *jcc
+.L1090:
+	movq	1040(%rbx), %rcx	# 7574	[c=9 l=7]  *movdi_internal/3
+	movslq	%ebp, %rax	# 7573	[c=4 l=3]  *extendsidi2_rex64/1
+	movb	%dl, (%rcx,%rax)	# 7575	[c=4 l=3]  *movqi_internal/8
+.L1092:
+	movw	%bp, 1030(%rbx)	# 7587	[c=4 l=7]  *movhi_internal/3
+	movl	(%rbx), %ebp	# 7588	[c=6 l=2]  *zero_extendsidi2/3
+	movq	%rbp, %rdx	# 16659	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbp	# 7590	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %rbp	# 7592	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%rbp), %eax	# 7593	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%edx, %eax	# 7594	[c=4 l=2]  *addsi_1/0
+	movl	%eax, (%rbx)	# 7595	[c=4 l=2]  *movsi_internal/1
+	jmp	*0(%rbp)	# 17724	[c=5 l=3]  *indirect_jump
+.L1108:
+	movzbl	10(%rbp), %ecx	# 7782	[c=13 l=4]  zero_extendqidi2/0
+	movzwl	1034(%rbx), %ebp	# 7783	[c=13 l=7]  *zero_extendhisi2/0
+	subl	$1, %ebp	# 7784	[c=4 l=3]  *addsi_1/0
+	cmpl	$15, %ecx	# 7787	[c=4 l=3]  *cmpsi_1/0
+	jle	.L1915	# 7788	[c=13 l=6]  *jcc
+	movl	%ebp, %eax	# 15369	[c=4 l=2]  *movsi_internal/0
+	movzbl	1004(%rbx,%rcx), %edx	# 7801	[c=14 l=8]  *zero_extendqisi2/0
+	subl	5176(%rbx), %eax	# 7802	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %eax	# 7803	[c=13 l=6]  *cmpsi_1/1
+	jb	.L1110	# 7804	[c=13 l=2]  *jcc
+	movl	%ebp, %eax	# 15371	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %eax	# 7806	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 14788	[c=5 l=5]  *andsi_1_zext
+	cmpb	$0, 1080(%rbx,%rax)	# 7809	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L1111	# 7810	[c=13 l=6]  *jcc
+.L1110:
+	movq	1040(%rbx), %rcx	# 7814	[c=9 l=7]  *movdi_internal/3
+	movslq	%ebp, %rax	# 7813	[c=4 l=3]  *extendsidi2_rex64/1
+	movb	%dl, (%rcx,%rax)	# 7815	[c=4 l=3]  *movqi_internal/8
+.L1112:
+	movw	%bp, 1034(%rbx)	# 7827	[c=4 l=7]  *movhi_internal/3
+	movl	(%rbx), %ebp	# 7828	[c=6 l=2]  *zero_extendsidi2/3
+	movq	%rbp, %rdx	# 16665	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbp	# 7830	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %rbp	# 7832	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%rbp), %eax	# 7833	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%edx, %eax	# 7834	[c=4 l=2]  *addsi_1/0
+	movl	%eax, (%rbx)	# 7835	[c=4 l=2]  *movsi_internal/1
+	jmp	*0(%rbp)	# 17716	[c=5 l=3]  *indirect_jump
+.L600:
+	movzbl	10(%rbp), %ecx	# 1007	[c=13 l=4]  zero_extendqidi2/0
+	movzwl	12(%rbp), %edx	# 1006	[c=13 l=4]  *zero_extendhisi2/0
+	cmpl	$15, %ecx	# 1010	[c=4 l=3]  *cmpsi_1/0
+	jle	.L1916	# 1011	[c=13 l=6]  *jcc
+	movzbl	1004(%rbx,%rcx), %eax	# 1024	[c=14 l=8]  *zero_extendqisi2/0
+	andl	%edx, %eax	# 1025	[c=4 l=2]  *andsi_1/0
+	movb	%al, 1004(%rbx,%rcx)	# 1027	[c=4 l=7]  *movqi_internal/8
+	movzbl	100(%rbx), %edx	# 1028	[c=9 l=4]  *movqi_internal/4
+	movl	%edx, %ecx	# 15001	[c=4 l=2]  *movsi_internal/0
+	andl	$225, %ecx	# 1031	[c=4 l=6]  *andsi_2/0
+	jne	.L602	# 1032	[c=13 l=6]  *jcc
+	leaq	flag_update_table_logical(%rip), %rdx	# 1035	[c=1 l=7]  *movdi_internal/4
+	cltq	# 1034	[c=4 l=2]  *extendsidi2_rex64/0
+	addq	%rdx, %rax	# 1036	[c=4 l=3]  *adddi_1/0
+	movl	$30, %edx	# 7	[c=4 l=5]  *movqi_internal/3
+.L603:
+	movl	(%rbx), %ebp	# 1055	[c=6 l=2]  *zero_extendsidi2/3
+	movb	%dl, 100(%rbx)	# 1054	[c=4 l=3]  *movqi_internal/8
+	movq	%rax, 104(%rbx)	# 1053	[c=4 l=4]  *movdi_internal/5
+	movq	%rbp, %rdx	# 16546	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbp	# 1057	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %rbp	# 1059	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%rbp), %eax	# 1060	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%edx, %eax	# 1061	[c=4 l=2]  *addsi_1/0
+	movl	%eax, (%rbx)	# 1062	[c=4 l=2]  *movsi_internal/1
+	jmp	*0(%rbp)	# 17987	[c=5 l=3]  *indirect_jump
+.L604:
+	movzbl	10(%rbp), %ecx	# 1068	[c=13 l=4]  zero_extendqidi2/0
+	cmpl	$15, %ecx	# 1071	[c=4 l=3]  *cmpsi_1/0
+	jle	.L1917	# 1072	[c=13 l=6]  *jcc
+	movsbl	1004(%rbx,%rcx), %eax	# 1085	[c=14 l=8]  extendqisi2
+	andl	$511, %eax	# 1086	[c=4 l=5]  *andsi_1/0
+	movl	%eax, %edx	# 15003	[c=4 l=2]  *movsi_internal/0
+	sarl	%edx	# 1088	[c=4 l=2]  *ashrsi3_1/0
+	movb	%dl, 1004(%rbx,%rcx)	# 1089	[c=4 l=7]  *movqi_internal/8
+	movzbl	100(%rbx), %edx	# 1090	[c=9 l=4]  *movqi_internal/4
+	movl	%edx, %ecx	# 15005	[c=4 l=2]  *movsi_internal/0
+	andl	$224, %ecx	# 1093	[c=4 l=6]  *andsi_2/0
+	jne	.L606	# 1094	[c=13 l=6]  *jcc
+	leaq	flag_update_table_ror8(%rip), %rdx	# 1097	[c=1 l=7]  *movdi_internal/4
+	cltq	# 1096	[c=4 l=2]  *extendsidi2_rex64/0
+	addq	%rdx, %rax	# 1098	[c=4 l=3]  *adddi_1/0
+	movl	$31, %edx	# 8	[c=4 l=5]  *movqi_internal/3
+.L607:
+	movl	(%rbx), %ebp	# 1117	[c=6 l=2]  *zero_extendsidi2/3
+	movb	%dl, 100(%rbx)	# 1116	[c=4 l=3]  *movqi_internal/8
+	movq	%rax, 104(%rbx)	# 1115	[c=4 l=4]  *movdi_internal/5
+	movq	%rbp, %rdx	# 16547	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbp	# 1119	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %rbp	# 1121	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%rbp), %eax	# 1122	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%edx, %eax	# 1123	[c=4 l=2]  *addsi_1/0
+	movl	%eax, (%rbx)	# 1124	[c=4 l=2]  *movsi_internal/1
+	jmp	*0(%rbp)	# 17985	[c=5 l=3]  *indirect_jump
+.L608:
+	movzbl	10(%rbp), %ecx	# 1130	[c=13 l=4]  *zero_extendqisi2/0
+	movzbl	100(%rbx), %edx	# 1131	[c=13 l=4]  *zero_extendqisi2/0
+	movl	(%rbx), %ebp	# 1145	[c=6 l=2]  *zero_extendsidi2/3
+	movl	%ecx, %eax	# 16548	[c=4 l=2]  *movsi_internal/0
+	notl	%ecx	# 1133	[c=4 l=2]  *one_cmplsi2_1/0
+	andl	%ecx, %edx	# 1134	[c=4 l=2]  *andsi_1/0
+	movq	104(%rbx), %rcx	# 1136	[c=9 l=4]  *movdi_internal/3
+	orl	%edx, %eax	# 16246	[c=4 l=2]  *iorsi_1/0
+	movzbl	(%rcx), %edi	# 17982	[c=5 l=3]  *movqi_internal/4
+	movb	%al, 100(%rbx)	# 1142	[c=4 l=3]  *movqi_internal/8
+	leaq	101(%rbx), %rax	# 16247	[c=4 l=4]  *leadi
+	movq	%rax, 104(%rbx)	# 1144	[c=4 l=4]  *movdi_internal/5
+	andl	%edx, %edi	# 18858	[c=4 l=2]  *andsi_1/0
+	movq	%rbp, %rdx	# 16549	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbp	# 1147	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %rbp	# 1149	[c=13 l=7]  *adddi_1/1
+	movb	%dil, 101(%rbx)	# 1140	[c=4 l=4]  *movqi_internal/8
+	movzbl	9(%rbp), %eax	# 1150	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%edx, %eax	# 1151	[c=4 l=2]  *addsi_1/0
+	movl	%eax, (%rbx)	# 1152	[c=4 l=2]  *movsi_internal/1
+	jmp	*0(%rbp)	# 17984	[c=5 l=3]  *indirect_jump
+.L609:
+	movzbl	10(%rbp), %ecx	# 1159	[c=13 l=4]  zero_extendqidi2/0
+	movzwl	12(%rbp), %edx	# 1158	[c=13 l=4]  *zero_extendhisi2/0
+	cmpl	$15, %ecx	# 1162	[c=4 l=3]  *cmpsi_1/0
+	jle	.L1918	# 1163	[c=13 l=6]  *jcc
+	movq	1040(%rbx), %rax	# 1180	[c=9 l=7]  *movdi_internal/3
+	movzbl	100(%rbx), %r8d	# 1178	[c=13 l=5]  *zero_extendqisi2/0
+	movzbl	1004(%rbx,%rcx), %edi	# 1176	[c=14 l=8]  *zero_extendqisi2/0
+	movzbl	63(%rax), %eax	# 1181	[c=13 l=4]  *zero_extendqisi2/0
+	movl	%r8d, %esi	# 16550	[c=4 l=3]  *movsi_internal/0
+	notl	%r8d	# 1183	[c=4 l=3]  *one_cmplsi2_1/0
+	orl	%edx, %edi	# 1177	[c=4 l=2]  *iorsi_1/0
+	notl	%edx	# 1192	[c=4 l=2]  *one_cmplsi2_1/0
+	andl	%r8d, %eax	# 1184	[c=4 l=3]  *andsi_1/0
+	movq	104(%rbx), %r8	# 1185	[c=9 l=4]  *movdi_internal/3
+	andb	(%r8), %sil	# 1186	[c=9 l=3]  *andqi_1/1
+	orl	%esi, %eax	# 1188	[c=4 l=2]  *iorsi_1/0
+	sall	$25, %eax	# 1190	[c=4 l=3]  *ashlsi3_1/0
+	sarl	$31, %eax	# 1191	[c=4 l=3]  ashrsi3_cvt/1
+	orl	%edx, %eax	# 1193	[c=4 l=2]  *iorsi_1/0
+	andl	%edi, %eax	# 1194	[c=4 l=2]  *andsi_1/0
+	movb	%al, 1004(%rbx,%rcx)	# 1195	[c=4 l=7]  *movqi_internal/8
+	movl	(%rbx), %ebp	# 1196	[c=6 l=2]  *zero_extendsidi2/3
+	movq	%rbp, %rdx	# 16551	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbp	# 1198	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %rbp	# 1200	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%rbp), %eax	# 1201	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%edx, %eax	# 1202	[c=4 l=2]  *addsi_1/0
+	movl	%eax, (%rbx)	# 1203	[c=4 l=2]  *movsi_internal/1
+	jmp	*0(%rbp)	# 17980	[c=5 l=3]  *indirect_jump
+.L595:
+	movzbl	10(%rbp), %ecx	# 928	[c=13 l=4]  zero_extendqidi2/0
+	movzwl	12(%rbp), %edx	# 927	[c=13 l=4]  zero_extendhidi2/0
+	cmpl	$15, %ecx	# 931	[c=4 l=3]  *cmpsi_1/0
+	jle	.L1919	# 932	[c=13 l=6]  *jcc
+	movzbl	1004(%rbx,%rcx), %eax	# 945	[c=10 l=8]  *movqi_internal/4
+	cmpl	$15, %edx	# 948	[c=4 l=3]  *cmpsi_1/0
+	jle	.L1920	# 949	[c=13 l=6]  *jcc
+	andb	1004(%rbx,%rdx), %al	# 962	[c=14 l=7]  *andqi_1/1
+	movb	%al, 1004(%rbx,%rcx)	# 964	[c=4 l=7]  *movqi_internal/8
+	movzbl	100(%rbx), %edx	# 965	[c=9 l=4]  *movqi_internal/4
+	movl	%edx, %ecx	# 14999	[c=4 l=2]  *movsi_internal/0
+	andl	$225, %ecx	# 968	[c=4 l=6]  *andsi_2/0
+	jne	.L598	# 969	[c=13 l=6]  *jcc
+	leaq	flag_update_table_logical(%rip), %rdx	# 972	[c=1 l=7]  *movdi_internal/4
+	movzbl	%al, %eax	# 971	[c=4 l=3]  zero_extendqidi2/0
+	addq	%rdx, %rax	# 973	[c=4 l=3]  *adddi_1/0
+	movl	$30, %edx	# 6	[c=4 l=5]  *movqi_internal/3
+.L599:
+	movl	(%rbx), %ebp	# 993	[c=6 l=2]  *zero_extendsidi2/3
+	movb	%dl, 100(%rbx)	# 992	[c=4 l=3]  *movqi_internal/8
+	movq	%rax, 104(%rbx)	# 991	[c=4 l=4]  *movdi_internal/5
+	movq	%rbp, %rdx	# 16545	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbp	# 995	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %rbp	# 997	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%rbp), %eax	# 998	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%edx, %eax	# 999	[c=4 l=2]  *addsi_1/0
+	movl	%eax, (%rbx)	# 1000	[c=4 l=2]  *movsi_internal/1
+	jmp	*0(%rbp)	# 17989	[c=5 l=3]  *indirect_jump
+.L1098:
+	movzbl	10(%rbp), %ecx	# 7662	[c=13 l=4]  zero_extendqidi2/0
+	movzwl	1032(%rbx), %ebp	# 7663	[c=13 l=7]  *zero_extendhisi2/0
+	subl	$1, %ebp	# 7664	[c=4 l=3]  *addsi_1/0
+	cmpl	$15, %ecx	# 7667	[c=4 l=3]  *cmpsi_1/0
+	jle	.L1921	# 7668	[c=13 l=6]  *jcc
+	movl	%ebp, %eax	# 15361	[c=4 l=2]  *movsi_internal/0
+	movzbl	1004(%rbx,%rcx), %edx	# 7681	[c=14 l=8]  *zero_extendqisi2/0
+	subl	5176(%rbx), %eax	# 7682	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %eax	# 7683	[c=13 l=6]  *cmpsi_1/1
+	jb	.L1100	# 7684	[c=13 l=2]  *jcc
+	movl	%ebp, %eax	# 15363	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %eax	# 7686	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 14789	[c=5 l=5]  *andsi_1_zext
+	cmpb	$0, 1080(%rbx,%rax)	# 7689	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L1101	# 7690	[c=13 l=6]  *jcc
+.L1100:
+	movq	1040(%rbx), %rcx	# 7694	[c=9 l=7]  *movdi_internal/3
+	movslq	%ebp, %rax	# 7693	[c=4 l=3]  *extendsidi2_rex64/1
+	movb	%dl, (%rcx,%rax)	# 7695	[c=4 l=3]  *movqi_internal/8
+.L1102:
+	movw	%bp, 1032(%rbx)	# 7707	[c=4 l=7]  *movhi_internal/3
+	movl	(%rbx), %ebp	# 7708	[c=6 l=2]  *zero_extendsidi2/3
+	movq	%rbp, %rdx	# 16662	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbp	# 7710	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %rbp	# 7712	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%rbp), %eax	# 7713	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%edx, %eax	# 7714	[c=4 l=2]  *addsi_1/0
+	movl	%eax, (%rbx)	# 7715	[c=4 l=2]  *movsi_internal/1
+	jmp	*0(%rbp)	# 17720	[c=5 l=3]  *indirect_jump
+.L1078:
+	movzbl	10(%rbp), %ecx	# 7426	[c=13 l=4]  zero_extendqidi2/0
+	movzwl	12(%rbp), %eax	# 7425	[c=13 l=4]  zero_extendhidi2/0
+	cmpl	$15, %ecx	# 7429	[c=4 l=3]  *cmpsi_1/0
+	jle	.L1922	# 7430	[c=13 l=6]  *jcc
+	movzwl	%ax, %esi	# 7444	[c=4 l=3]  *zero_extendhisi2/0
+	movzbl	1004(%rbx,%rcx), %ecx	# 7443	[c=10 l=8]  *movqi_internal/4
+	movl	%esi, %edx	# 15345	[c=4 l=2]  *movsi_internal/0
+	subl	5176(%rbx), %edx	# 7445	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %edx	# 7446	[c=13 l=6]  *cmpsi_1/1
+	jb	.L1080	# 7447	[c=13 l=2]  *jcc
+	movl	%esi, %edx	# 15347	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %edx	# 7450	[c=4 l=3]  *ashrsi3_1/0
+	movslq	%edx, %rdx	# 7451	[c=4 l=3]  *extendsidi2_rex64/1
+	cmpb	$0, 1080(%rbx,%rdx)	# 7452	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L1081	# 7453	[c=13 l=6]  *jcc
+.L1080:
+	movq	1040(%rbx), %rdx	# 7457	[c=9 l=7]  *movdi_internal/3
+	movb	%cl, (%rdx,%rax)	# 7458	[c=4 l=3]  *movqi_internal/8
+.L1082:
+	movl	(%rbx), %ebp	# 7470	[c=6 l=2]  *zero_extendsidi2/3
+	movq	%rbp, %rdx	# 16657	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbp	# 7472	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %rbp	# 7474	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%rbp), %eax	# 7475	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%edx, %eax	# 7476	[c=4 l=2]  *addsi_1/0
+	movl	%eax, (%rbx)	# 7477	[c=4 l=2]  *movsi_internal/1
+	jmp	*0(%rbp)	# 17728	[c=5 l=3]  *indirect_jump
+.L1083:
+	movzbl	10(%rbp), %ecx	# 7483	[c=13 l=4]  zero_extendqidi2/0
+	movzwl	1030(%rbx), %eax	# 7484	[c=13 l=7]  zero_extendhidi2/0
+	cmpl	$15, %ecx	# 7487	[c=4 l=3]  *cmpsi_1/0
+	jle	.L1923	# 7488	[c=13 l=6]  *jcc
+	movzwl	%ax, %esi	# 7502	[c=4 l=3]  *zero_extendhisi2/0
+	movzbl	1004(%rbx,%rcx), %ecx	# 7501	[c=10 l=8]  *movqi_internal/4
+	movl	%esi, %edx	# 15349	[c=4 l=2]  *movsi_internal/0
+	subl	5176(%rbx), %edx	# 7503	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %edx	# 7504	[c=13 l=6]  *cmpsi_1/1
+	jb	.L1085	# 7505	[c=13 l=2]  *jcc
+	movl	%esi, %edx	# 15351	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %edx	# 7508	[c=4 l=3]  *ashrsi3_1/0
+	movslq	%edx, %rdx	# 7509	[c=4 l=3]  *extendsidi2_rex64/1
+	cmpb	$0, 1080(%rbx,%rdx)	# 7510	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L1086	# 7511	[c=13 l=6]  *jcc
+.L1085:
+	movq	1040(%rbx), %rdx	# 7515	[c=9 l=7]  *movdi_internal/3
+	movb	%cl, (%rdx,%rax)	# 7516	[c=4 l=3]  *movqi_internal/8
+.L1087:
+	movl	(%rbx), %ebp	# 7529	[c=6 l=2]  *zero_extendsidi2/3
+	subq	$1, 48(%rbx)	# 7528	[c=13 l=5]  *adddi_1/0
+	movq	%rbp, %rdx	# 16658	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbp	# 7531	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %rbp	# 7533	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%rbp), %eax	# 7534	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%edx, %eax	# 7535	[c=4 l=2]  *addsi_1/0
+	movl	%eax, (%rbx)	# 7536	[c=4 l=2]  *movsi_internal/1
+	jmp	*0(%rbp)	# 17726	[c=5 l=3]  *indirect_jump
+.L833:
+	movzwl	1030(%rbx), %esi	# 4135	[c=13 l=7]  zero_extendhidi2/0
+	movzbl	10(%rbp), %ebp	# 4134	[c=13 l=4]  zero_extendqidi2/0
+	movl	%esi, %edx	# 15160	[c=4 l=2]  *movsi_internal/0
+	movq	%rsi, %rax	# 16596	[c=4 l=3]  *movdi_internal/3
+	subl	5176(%rbx), %edx	# 4137	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %edx	# 4138	[c=13 l=6]  *cmpsi_1/1
+	jb	.L834	# 4139	[c=13 l=2]  *jcc
+	movl	%esi, %edx	# 15162	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %edx	# 4142	[c=4 l=3]  *ashrsi3_1/0
+	movslq	%edx, %rdx	# 4143	[c=4 l=3]  *extendsidi2_rex64/1
+	cmpb	$0, 1080(%rbx,%rdx)	# 4144	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L835	# 4145	[c=13 l=6]  *jcc
+.L834:
+	movq	1040(%rbx), %rdx	# 4149	[c=9 l=7]  *movdi_internal/3
+	movzbl	(%rdx,%rax), %eax	# 4150	[c=13 l=4]  *zero_extendqisi2/0
+.L836:
+	cmpl	$15, %ebp	# 4164	[c=4 l=3]  *cmpsi_1/0
+	jle	.L1924	# 4165	[c=13 l=6]  *jcc
+	movb	%al, 1004(%rbx,%rbp)	# 4178	[c=4 l=7]  *movqi_internal/8
+	movl	(%rbx), %ebp	# 4180	[c=6 l=2]  *zero_extendsidi2/3
+	subq	$1, 48(%rbx)	# 4179	[c=13 l=5]  *adddi_1/0
+	movq	%rbp, %rdx	# 16597	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbp	# 4182	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %rbp	# 4184	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%rbp), %eax	# 4185	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%edx, %eax	# 4186	[c=4 l=2]  *addsi_1/0
+	movl	%eax, (%rbx)	# 4187	[c=4 l=2]  *movsi_internal/1
+	jmp	*0(%rbp)	# 17862	[c=5 l=3]  *indirect_jump
+.L838:
+	movzbl	10(%rbp), %r14d	# 4193	[c=13 l=5]  zero_extendqidi2/0
+	movzwl	1030(%rbx), %ebp	# 4194	[c=13 l=7]  *zero_extendhisi2/0
+	subl	$1, %ebp	# 4195	[c=4 l=3]  *addsi_1/0
+	movl	%ebp, %eax	# 15164	[c=4 l=2]  *movsi_internal/0
+	subl	5176(%rbx), %eax	# 4196	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %eax	# 4197	[c=13 l=6]  *cmpsi_1/1
+	jb	.L839	# 4198	[c=13 l=2]  *jcc
+	movl	%ebp, %eax	# 15166	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %eax	# 4200	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 14804	[c=5 l=5]  *andsi_1_zext
+	cmpb	$0, 1080(%rbx,%rax)	# 4203	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L840	# 4204	[c=13 l=6]  *jcc
+.L839:
+	movq	1040(%rbx), %rdx	# 4208	[c=9 l=7]  *movdi_internal/3
+	movslq	%ebp, %rax	# 4207	[c=4 l=3]  *extendsidi2_rex64/1
+	movzbl	(%rdx,%rax), %eax	# 4209	[c=13 l=4]  *zero_extendqisi2/0
+.L841:
+	cmpl	$15, %r14d	# 4223	[c=4 l=4]  *cmpsi_1/0
+	jle	.L1925	# 4224	[c=13 l=6]  *jcc
+	movb	%al, 1004(%rbx,%r14)	# 4237	[c=4 l=8]  *movqi_internal/8
+	movw	%bp, 1030(%rbx)	# 4238	[c=4 l=7]  *movhi_internal/3
+	movl	(%rbx), %ebp	# 4239	[c=6 l=2]  *zero_extendsidi2/3
+	movq	%rbp, %rdx	# 16598	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbp	# 4241	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %rbp	# 4243	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%rbp), %eax	# 4244	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%edx, %eax	# 4245	[c=4 l=2]  *addsi_1/0
+	movl	%eax, (%rbx)	# 4246	[c=4 l=2]  *movsi_internal/1
+	jmp	*0(%rbp)	# 17860	[c=5 l=3]  *indirect_jump
+.L843:
+	movzbl	10(%rbp), %r14d	# 4252	[c=13 l=5]  zero_extendqidi2/0
+	movzwl	1030(%rbx), %ebp	# 4253	[c=13 l=7]  zero_extendhidi2/0
+	movl	%ebp, %edx	# 15168	[c=4 l=2]  *movsi_internal/0
+	movq	%rbp, %rax	# 16599	[c=4 l=3]  *movdi_internal/3
+	subl	5176(%rbx), %edx	# 4256	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %edx	# 4257	[c=13 l=6]  *cmpsi_1/1
+	jb	.L844	# 4258	[c=13 l=2]  *jcc
+	movl	%ebp, %edx	# 15170	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %edx	# 4260	[c=4 l=3]  *ashrsi3_1/0
+	movslq	%edx, %rdx	# 4261	[c=4 l=3]  *extendsidi2_rex64/1
+	cmpb	$0, 1080(%rbx,%rdx)	# 4262	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L845	# 4263	[c=13 l=6]  *jcc
+.L844:
+	movq	1040(%rbx), %rdx	# 4267	[c=9 l=7]  *movdi_internal/3
+	movzbl	(%rdx,%rax), %eax	# 4268	[c=13 l=4]  *zero_extendqisi2/0
+.L846:
+	cmpl	$15, %r14d	# 4282	[c=4 l=4]  *cmpsi_1/0
+	jle	.L1926	# 4283	[c=13 l=6]  *jcc
+	movb	%al, 1004(%rbx,%r14)	# 4296	[c=4 l=8]  *movqi_internal/8
+	leal	1(%rbp), %eax	# 16177	[c=4 l=3]  *leasi
+	movl	(%rbx), %ebp	# 4300	[c=6 l=2]  *zero_extendsidi2/3
+	subq	$1, 48(%rbx)	# 4297	[c=13 l=5]  *adddi_1/0
+	movq	%rbp, %rdx	# 16600	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbp	# 4302	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %rbp	# 4304	[c=13 l=7]  *adddi_1/1
+	movw	%ax, 1030(%rbx)	# 4299	[c=4 l=7]  *movhi_internal/3
+	movzbl	9(%rbp), %eax	# 4305	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%edx, %eax	# 4306	[c=4 l=2]  *addsi_1/0
+	movl	%eax, (%rbx)	# 4307	[c=4 l=2]  *movsi_internal/1
+	jmp	*0(%rbp)	# 17858	[c=5 l=3]  *indirect_jump
+.L848:
+	movzbl	10(%rbp), %r14d	# 4313	[c=13 l=5]  zero_extendqidi2/0
+	movzwl	1032(%rbx), %ebp	# 4314	[c=13 l=7]  *zero_extendhisi2/0
+	subl	$1, %ebp	# 4315	[c=4 l=3]  *addsi_1/0
+	movl	%ebp, %eax	# 15172	[c=4 l=2]  *movsi_internal/0
+	subl	5176(%rbx), %eax	# 4316	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %eax	# 4317	[c=13 l=6]  *cmpsi_1/1
+	jb	.L849	# 4318	[c=13 l=2]  *jcc
+	movl	%ebp, %eax	# 15174	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %eax	# 4320	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 14803	[c=5 l=5]  *andsi_1_zext
+	cmpb	$0, 1080(%rbx,%rax)	# 4323	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L850	# 4324	[c=13 l=6]  *jcc
+.L849:
+	movq	1040(%rbx), %rdx	# 4328	[c=9 l=7]  *movdi_internal/3
+	movslq	%ebp, %rax	# 4327	[c=4 l=3]  *extendsidi2_rex64/1
+	movzbl	(%rdx,%rax), %eax	# 4329	[c=13 l=4]  *zero_extendqisi2/0
+.L851:
+	cmpl	$15, %r14d	# 4343	[c=4 l=4]  *cmpsi_1/0
+	jle	.L1927	# 4344	[c=13 l=6]  *jcc
+	movb	%al, 1004(%rbx,%r14)	# 4357	[c=4 l=8]  *movqi_internal/8
+	movw	%bp, 1032(%rbx)	# 4358	[c=4 l=7]  *movhi_internal/3
+	movl	(%rbx), %ebp	# 4359	[c=6 l=2]  *zero_extendsidi2/3
+	movq	%rbp, %rdx	# 16601	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbp	# 4361	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %rbp	# 4363	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%rbp), %eax	# 4364	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%edx, %eax	# 4365	[c=4 l=2]  *addsi_1/0
+	movl	%eax, (%rbx)	# 4366	[c=4 l=2]  *movsi_internal/1
+	jmp	*0(%rbp)	# 17856	[c=5 l=3]  *indirect_jump
+.L853:
+	movzbl	10(%rbp), %r14d	# 4372	[c=13 l=5]  zero_extendqidi2/0
+	movzwl	1032(%rbx), %ebp	# 4373	[c=13 l=7]  zero_extendhidi2/0
+	movl	%ebp, %edx	# 15176	[c=4 l=2]  *movsi_internal/0
+	movq	%rbp, %rax	# 16602	[c=4 l=3]  *movdi_internal/3
+	subl	5176(%rbx), %edx	# 4376	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %edx	# 4377	[c=13 l=6]  *cmpsi_1/1
+	jb	.L854	# 4378	[c=13 l=2]  *jcc
+	movl	%ebp, %edx	# 15178	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %edx	# 4380	[c=4 l=3]  *ashrsi3_1/0
+	movslq	%edx, %rdx	# 4381	[c=4 l=3]  *extendsidi2_rex64/1
+	cmpb	$0, 1080(%rbx,%rdx)	# 4382	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L855	# 4383	[c=13 l=6]  *jcc
+.L854:
+	movq	1040(%rbx), %rdx	# 4387	[c=9 l=7]  *movdi_internal/3
+	movzbl	(%rdx,%rax), %eax	# 4388	[c=13 l=4]  *zero_extendqisi2/0
+.L856:
+	cmpl	$15, %r14d	# 4402	[c=4 l=4]  *cmpsi_1/0
+	jle	.L1928	# 4403	[c=13 l=6]  *jcc
+	movb	%al, 1004(%rbx,%r14)	# 4416	[c=4 l=8]  *movqi_internal/8
+	leal	1(%rbp), %eax	# 16176	[c=4 l=3]  *leasi
+	movl	(%rbx), %ebp	# 4420	[c=6 l=2]  *zero_extendsidi2/3
+	subq	$1, 48(%rbx)	# 4417	[c=13 l=5]  *adddi_1/0
+	movq	%rbp, %rdx	# 16603	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbp	# 4422	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %rbp	# 4424	[c=13 l=7]  *adddi_1/1
+	movw	%ax, 1032(%rbx)	# 4419	[c=4 l=7]  *movhi_internal/3
+	movzbl	9(%rbp), %eax	# 4425	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%edx, %eax	# 4426	[c=4 l=2]  *addsi_1/0
+	movl	%eax, (%rbx)	# 4427	[c=4 l=2]  *movsi_internal/1
+	jmp	*0(%rbp)	# 17854	[c=5 l=3]  *indirect_jump
+.L858:
+	movzbl	10(%rbp), %r14d	# 4433	[c=13 l=5]  zero_extendqidi2/0
+	movzwl	1034(%rbx), %ebp	# 4434	[c=13 l=7]  *zero_extendhisi2/0
+	subl	$1, %ebp	# 4435	[c=4 l=3]  *addsi_1/0
+	movl	%ebp, %eax	# 15180	[c=4 l=2]  *movsi_internal/0
+	subl	5176(%rbx), %eax	# 4436	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %eax	# 4437	[c=13 l=6]  *cmpsi_1/1
+	jb	.L859	# 4438	[c=13 l=2]  *jcc
+	movl	%ebp, %eax	# 15182	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %eax	# 4440	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 14802	[c=5 l=5]  *andsi_1_zext
+	cmpb	$0, 1080(%rbx,%rax)	# 4443	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L860	# 4444	[c=13 l=6]  *jcc
+.L859:
+	movq	1040(%rbx), %rdx	# 4448	[c=9 l=7]  *movdi_internal/3
+	movslq	%ebp, %rax	# 4447	[c=4 l=3]  *extendsidi2_rex64/1
+	movzbl	(%rdx,%rax), %eax	# 4449	[c=13 l=4]  *zero_extendqisi2/0
+.L861:
+	cmpl	$15, %r14d	# 4463	[c=4 l=4]  *cmpsi_1/0
+	jle	.L1929	# 4464	[c=13 l=6]  *jcc
+	movb	%al, 1004(%rbx,%r14)	# 4477	[c=4 l=8]  *movqi_internal/8
+	movw	%bp, 1034(%rbx)	# 4478	[c=4 l=7]  *movhi_internal/3
+	movl	(%rbx), %ebp	# 4479	[c=6 l=2]  *zero_extendsidi2/3
+	movq	%rbp, %rdx	# 16604	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbp	# 4481	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %rbp	# 4483	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%rbp), %eax	# 4484	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%edx, %eax	# 4485	[c=4 l=2]  *addsi_1/0
+	movl	%eax, (%rbx)	# 4486	[c=4 l=2]  *movsi_internal/1
+	jmp	*0(%rbp)	# 17852	[c=5 l=3]  *indirect_jump
+.L863:
+	movzbl	10(%rbp), %r14d	# 4492	[c=13 l=5]  zero_extendqidi2/0
+	movzwl	1034(%rbx), %ebp	# 4493	[c=13 l=7]  zero_extendhidi2/0
+	movl	%ebp, %edx	# 15184	[c=4 l=2]  *movsi_internal/0
+	movq	%rbp, %rax	# 16605	[c=4 l=3]  *movdi_internal/3
+	subl	5176(%rbx), %edx	# 4496	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %edx	# 4497	[c=13 l=6]  *cmpsi_1/1
+	jb	.L864	# 4498	[c=13 l=2]  *jcc
+	movl	%ebp, %edx	# 15186	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %edx	# 4500	[c=4 l=3]  *ashrsi3_1/0
+	movslq	%edx, %rdx	# 4501	[c=4 l=3]  *extendsidi2_rex64/1
+	cmpb	$0, 1080(%rbx,%rdx)	# 4502	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L865	# 4503	[c=13 l=6]  *jcc
+.L864:
+	movq	1040(%rbx), %rdx	# 4507	[c=9 l=7]  *movdi_internal/3
+	movzbl	(%rdx,%rax), %eax	# 4508	[c=13 l=4]  *zero_extendqisi2/0
+.L866:
+	cmpl	$15, %r14d	# 4522	[c=4 l=4]  *cmpsi_1/0
+	jle	.L1930	# 4523	[c=13 l=6]  *jcc
+	movb	%al, 1004(%rbx,%r14)	# 4536	[c=4 l=8]  *movqi_internal/8
+	leal	1(%rbp), %eax	# 16175	[c=4 l=3]  *leasi
+	movl	(%rbx), %ebp	# 4540	[c=6 l=2]  *zero_extendsidi2/3
+	subq	$1, 48(%rbx)	# 4537	[c=13 l=5]  *adddi_1/0
+	movq	%rbp, %rdx	# 16606	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbp	# 4542	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %rbp	# 4544	[c=13 l=7]  *adddi_1/1
+	movw	%ax, 1034(%rbx)	# 4539	[c=4 l=7]  *movhi_internal/3
+	movzbl	9(%rbp), %eax	# 4545	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%edx, %eax	# 4546	[c=4 l=2]  *addsi_1/0
+	movl	%eax, (%rbx)	# 4547	[c=4 l=2]  *movsi_internal/1
+	jmp	*0(%rbp)	# 17850	[c=5 l=3]  *indirect_jump
+.L868:
+	xorl	%ecx, %ecx	# 17848	[c=4 l=2]  *movdi_xor
+	leaq	.LC52(%rip), %rdx	# 4554	[c=1 l=7]  *movdi_internal/4
+	movl	$1, %esi	# 4556	[c=4 l=5]  *movsi_internal/0
+	xorl	%eax, %eax	# 17849	[c=4 l=2]  *movdi_xor
+	movq	%rbx, %rdi	# 4557	[c=4 l=3]  *movdi_internal/3
+	call	leave	# 4559	[c=0 l=5]  *call
+.L869:
+	movl	992(%rbx), %eax	# 4564	[c=9 l=6]  *movsi_internal/0
+	movq	1056(%rbx), %rdx	# 4570	[c=9 l=7]  *movdi_internal/3
+	movzbl	10(%rbp), %ecx	# 4563	[c=13 l=4]  zero_extendqidi2/0
+	leal	1(%rax,%rax), %eax	# 4566	[c=8 l=4]  *leasi
+	andw	1034(%rbx), %ax	# 4568	[c=13 l=7]  *andhi_1/1
+	movzwl	%ax, %eax	# 4569	[c=4 l=3]  zero_extendhidi2/0
+	movzbl	(%rdx,%rax), %eax	# 4571	[c=9 l=4]  *movqi_internal/4
+	cmpl	$15, %ecx	# 4574	[c=4 l=3]  *cmpsi_1/0
+	jle	.L1931	# 4575	[c=13 l=6]  *jcc
+	movb	%al, 1004(%rbx,%rcx)	# 4588	[c=4 l=7]  *movqi_internal/8
+	movl	(%rbx), %ebp	# 4589	[c=6 l=2]  *zero_extendsidi2/3
+	movq	%rbp, %rdx	# 16607	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbp	# 4591	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %rbp	# 4593	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%rbp), %eax	# 4594	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%edx, %eax	# 4595	[c=4 l=2]  *addsi_1/0
+	movl	%eax, (%rbx)	# 4596	[c=4 l=2]  *movsi_internal/1
+	jmp	*0(%rbp)	# 17846	[c=5 l=3]  *indirect_jump
+.L871:
+	movl	992(%rbx), %eax	# 4604	[c=9 l=6]  *movsi_internal/0
+	movzwl	1034(%rbx), %edx	# 4603	[c=13 l=7]  *zero_extendhisi2/0
+	movq	1056(%rbx), %rsi	# 4609	[c=9 l=7]  *movdi_internal/3
+	movzbl	10(%rbp), %ecx	# 4602	[c=13 l=4]  zero_extendqidi2/0
+	leal	1(%rax,%rax), %eax	# 4606	[c=8 l=4]  *leasi
+	andl	%edx, %eax	# 4607	[c=4 l=2]  *andsi_1/0
+	cltq	# 4608	[c=4 l=2]  *extendsidi2_rex64/0
+	movzbl	(%rsi,%rax), %eax	# 4610	[c=9 l=4]  *movqi_internal/4
+	cmpl	$15, %ecx	# 4613	[c=4 l=3]  *cmpsi_1/0
+	jle	.L1932	# 4614	[c=13 l=6]  *jcc
+	movb	%al, 1004(%rbx,%rcx)	# 4627	[c=4 l=7]  *movqi_internal/8
+	movl	(%rbx), %ebp	# 4630	[c=6 l=2]  *zero_extendsidi2/3
+	addl	$1, %edx	# 4628	[c=4 l=3]  *addsi_1/0
+	movw	%dx, 1034(%rbx)	# 4629	[c=4 l=7]  *movhi_internal/3
+	movq	%rbp, %rdx	# 16608	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbp	# 4632	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %rbp	# 4634	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%rbp), %eax	# 4635	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%edx, %eax	# 4636	[c=4 l=2]  *addsi_1/0
+	movl	%eax, (%rbx)	# 4637	[c=4 l=2]  *movsi_internal/1
+	jmp	*0(%rbp)	# 17844	[c=5 l=3]  *indirect_jump
+.L873:
+	movzbl	10(%rbp), %ecx	# 4643	[c=13 l=4]  zero_extendqidi2/0
+	cmpl	$15, %ecx	# 4646	[c=4 l=3]  *cmpsi_1/0
+	jle	.L1933	# 4647	[c=13 l=6]  *jcc
+	movzbl	1004(%rbx,%rcx), %esi	# 4660	[c=14 l=8]  zero_extendqidi2/0
+	movl	%esi, %edx	# 15188	[c=4 l=2]  *movsi_internal/0
+	movq	%rsi, %rax	# 16609	[c=4 l=3]  *movdi_internal/3
+	sarl	%edx	# 4663	[c=4 l=2]  *ashrsi3_1/0
+	movb	%dl, 1004(%rbx,%rcx)	# 4664	[c=4 l=7]  *movqi_internal/8
+	movzbl	100(%rbx), %edx	# 4665	[c=9 l=4]  *movqi_internal/4
+	movl	%edx, %ecx	# 15190	[c=4 l=2]  *movsi_internal/0
+	andl	$224, %ecx	# 4668	[c=4 l=6]  *andsi_2/0
+	jne	.L875	# 4669	[c=13 l=6]  *jcc
+	leaq	flag_update_table_ror8(%rip), %rdx	# 4672	[c=1 l=7]  *movdi_internal/4
+	addq	%rdx, %rax	# 4673	[c=4 l=3]  *adddi_1/0
+	movl	$31, %edx	# 19	[c=4 l=5]  *movqi_internal/3
+.L876:
+	movl	(%rbx), %ebp	# 4692	[c=6 l=2]  *zero_extendsidi2/3
+	movb	%dl, 100(%rbx)	# 4691	[c=4 l=3]  *movqi_internal/8
+	movq	%rax, 104(%rbx)	# 4690	[c=4 l=4]  *movdi_internal/5
+	movq	%rbp, %rdx	# 16610	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbp	# 4694	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %rbp	# 4696	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%rbp), %eax	# 4697	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%edx, %eax	# 4698	[c=4 l=2]  *addsi_1/0
+	movl	%eax, (%rbx)	# 4699	[c=4 l=2]  *movsi_internal/1
+	jmp	*0(%rbp)	# 17842	[c=5 l=3]  *indirect_jump
+.L877:
+	movzwl	12(%rbp), %eax	# 4705	[c=13 l=4]  zero_extendhidi2/0
+	movzbl	10(%rbp), %ecx	# 4706	[c=13 l=4]  zero_extendqidi2/0
+	cmpl	$15, %eax	# 4709	[c=4 l=3]  *cmpsi_1/0
+	jle	.L1934	# 4710	[c=13 l=6]  *jcc
+	movzbl	1004(%rbx,%rax), %eax	# 4723	[c=10 l=8]  *movqi_internal/4
+	cmpl	$15, %ecx	# 4726	[c=4 l=3]  *cmpsi_1/0
+	jle	.L1935	# 4727	[c=13 l=6]  *jcc
+	movb	%al, 1004(%rbx,%rcx)	# 4740	[c=4 l=7]  *movqi_internal/8
+	movl	(%rbx), %ebp	# 4741	[c=6 l=2]  *zero_extendsidi2/3
+	movq	%rbp, %rdx	# 16611	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbp	# 4743	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %rbp	# 4745	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%rbp), %eax	# 4746	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%edx, %eax	# 4747	[c=4 l=2]  *addsi_1/0
+	movl	%eax, (%rbx)	# 4748	[c=4 l=2]  *movsi_internal/1
+	jmp	*0(%rbp)	# 17839	[c=5 l=3]  *indirect_jump
+.L880:
+	movzwl	12(%rbp), %eax	# 4754	[c=13 l=4]  *zero_extendhisi2/0
+	movzbl	10(%rbp), %ecx	# 4755	[c=13 l=4]  *zero_extendqisi2/0
+	cmpl	$15, %eax	# 4758	[c=4 l=3]  *cmpsi_1/0
+	jle	.L1936	# 4759	[c=13 l=6]  *jcc
+	movslq	%eax, %rdx	# 4771	[c=4 l=3]  *extendsidi2_rex64/1
+	movzbl	1004(%rbx,%rdx), %esi	# 4772	[c=10 l=8]  *movqi_internal/4
+	cmpl	$15, %ecx	# 4775	[c=4 l=3]  *cmpsi_1/0
+	jle	.L1937	# 4776	[c=13 l=6]  *jcc
+	addl	$1, %eax	# 4790	[c=4 l=3]  *addsi_1/0
+	movslq	%ecx, %rdx	# 4788	[c=4 l=3]  *extendsidi2_rex64/1
+	cltq	# 4791	[c=4 l=2]  *extendsidi2_rex64/0
+	movb	%sil, 1004(%rbx,%rdx)	# 4789	[c=4 l=8]  *movqi_internal/8
+	movzbl	1004(%rbx,%rax), %edx	# 4792	[c=10 l=8]  *movqi_internal/4
+	leal	1(%rcx), %eax	# 16172	[c=4 l=3]  *leasi
+	cltq	# 4794	[c=4 l=2]  *extendsidi2_rex64/0
+	movb	%dl, 1004(%rbx,%rax)	# 4795	[c=4 l=7]  *movqi_internal/8
+	movl	(%rbx), %ebp	# 4796	[c=6 l=2]  *zero_extendsidi2/3
+	movq	%rbp, %rdx	# 16612	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbp	# 4798	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %rbp	# 4800	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%rbp), %eax	# 4801	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%edx, %eax	# 4802	[c=4 l=2]  *addsi_1/0
+	movl	%eax, (%rbx)	# 4803	[c=4 l=2]  *movsi_internal/1
+	jmp	*0(%rbp)	# 17836	[c=5 l=3]  *indirect_jump
+.L1698:
+	movl	$50651151, %eax	# 235	[c=4 l=5]  *movdi_internal/2
+	shrq	%cl, %rax	# 236	[c=4 l=3]  *lshrdi3_1/0
+	testb	$1, %al	# 16276	[c=4 l=2]  *testqi_1_maybe_si/1
+	je	.L552	# 239	[c=13 l=6]  *jcc
+	jmp	.L543	# 18378	[c=1 l=5]  jump
+.L586:
+	andb	(%rsi), %dl	# 701	[c=9 l=2]  *andqi_1/1
+	leaq	flag_update_table_add8(%rip), %rsi	# 14820	[c=1 l=7]  *movdi_internal/4
+	orl	$63, %ecx	# 16269	[c=4 l=3]  *iorsi_1/0
+	orb	(%rsi,%rax), %dl	# 706	[c=13 l=3]  *iorqi_1/1
+	leaq	101(%rbx), %rax	# 16270	[c=4 l=4]  *leadi
+	movb	%dl, 101(%rbx)	# 707	[c=4 l=3]  *movqi_internal/8
+	jmp	.L587	# 18380	[c=1 l=5]  jump
+.L1181:
+	movq	104(%rbx), %rsi	# 9138	[c=9 l=4]  *movdi_internal/3
+	orl	$63, %edx	# 16074	[c=4 l=3]  *iorsi_1/0
+	andb	(%rsi), %cl	# 9139	[c=9 l=2]  *andqi_1/1
+	leaq	flag_update_table_sub8(%rip), %rsi	# 14855	[c=1 l=7]  *movdi_internal/4
+	orb	(%rsi,%rax), %cl	# 9144	[c=13 l=3]  *iorqi_1/1
+	leaq	101(%rbx), %rax	# 16075	[c=4 l=4]  *leadi
+	movb	%cl, 101(%rbx)	# 9145	[c=4 l=3]  *movqi_internal/8
+	jmp	.L1247	# 18382	[c=1 l=5]  jump
+.L612:
+	xorl	%eax, %eax	# 18015	[c=4 l=2]  *movsi_xor
+	leaq	.LC51(%rip), %rdx	# 590	[c=1 l=7]  *movdi_internal/4
+	movl	$2, %esi	# 592	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 593	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, 96(%rbx)	# 18016	[c=4 l=3]  *movsi_internal/1
+	xorl	%eax, %eax	# 18017	[c=4 l=2]  *movdi_xor
+	call	leave	# 595	[c=0 l=5]  *call
+.L575:
+	movzbl	1028(%rbx), %ecx	# 449	[c=13 l=7]  *zero_extendqisi2/0
+	movl	1024(%rbx), %esi	# 451	[c=10 l=6]  *zero_extendsidi2/3
+	testb	%cl, %cl	# 454	[c=4 l=2]  *cmpqi_ccno_1/0
+	jle	.L576	# 455	[c=13 l=6]  *jcc
+	cmpl	%ecx, 992(%rbx)	# 458	[c=13 l=6]  *cmpsi_1/0
+	jb	.L576	# 459	[c=13 l=6]  *jcc
+	movq	irq_raise@GOTPCREL(%rip), %rdx	# 478	[c=5 l=7]  *movdi_internal/3
+	addq	48(%rbx), %rsi	# 474	[c=13 l=4]  *adddi_1/1
+	movq	%rbx, %rdi	# 480	[c=4 l=3]  *movdi_internal/3
+	call	event_schedule@PLT	# 481	[c=0 l=5]  *call
+.L568:
+	leaq	-1(%r13), %rax	# 16271	[c=4 l=4]  *leadi
+	cmpq	%r12, %rax	# 586	[c=4 l=3]  *cmpdi_1/0
+	jb	.L612	# 587	[c=13 l=2]  *jcc
+	movq	56(%rbx), %rax	# 14978	[c=9 l=4]  *movdi_internal/3
+	cmpq	%rax, 48(%rbx)	# 600	[c=13 l=4]  *cmpdi_1/0
+	jnb	.L1938	# 601	[c=13 l=6]  *jcc
+.L581:
+	movl	(%rbx), %ebp	# 608	[c=6 l=2]  *zero_extendsidi2/3
+	movl	$1, 96(%rbx)	# 613	[c=4 l=7]  *movsi_internal/1
+	movq	%rbp, %rdx	# 16536	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbp	# 610	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %rbp	# 612	[c=13 l=7]  *adddi_1/1
+	movzbl	11(%rbp), %eax	# 614	[c=13 l=4]  zero_extendqidi2/0
+	addq	%rax, %r12	# 615	[c=4 l=3]  *adddi_1/0
+	movzwl	14(%rbp), %eax	# 617	[c=13 l=4]  zero_extendhidi2/0
+	addq	%rax, 48(%rbx)	# 618	[c=13 l=4]  *adddi_1/0
+	movq	%r12, 40(%rbx)	# 616	[c=4 l=4]  *movdi_internal/5
+	movzbl	9(%rbp), %eax	# 619	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%edx, %eax	# 620	[c=4 l=2]  *addsi_1/0
+	movl	%eax, (%rbx)	# 621	[c=4 l=2]  *movsi_internal/1
+	jmp	*0(%rbp)	# 18012	[c=5 l=3]  *indirect_jump
+.L1355:
+	movq	104(%rbx), %r8	# 12357	[c=9 l=4]  *movdi_internal/3
+	orl	$63, %esi	# 15947	[c=4 l=3]  *iorsi_1/0
+	andb	(%r8), %dil	# 12358	[c=9 l=3]  *andqi_1/1
+	leaq	flag_update_table_sub8(%rip), %r8	# 14868	[c=1 l=7]  *movdi_internal/4
+	orb	(%r8,%rax), %dil	# 12363	[c=13 l=4]  *iorqi_1/1
+	leaq	101(%rbx), %rax	# 15948	[c=4 l=4]  *leadi
+	movb	%dil, 101(%rbx)	# 12364	[c=4 l=4]  *movqi_internal/8
+	jmp	.L1356	# 18385	[c=1 l=5]  jump
+.L1158:
+	movq	104(%rbx), %rsi	# 8633	[c=9 l=4]  *movdi_internal/3
+	orl	$63, %edx	# 16095	[c=4 l=3]  *iorsi_1/0
+	andb	(%rsi), %cl	# 8634	[c=9 l=2]  *andqi_1/1
+	leaq	flag_update_table_sub8(%rip), %rsi	# 14849	[c=1 l=7]  *movdi_internal/4
+	orb	(%rsi,%rax), %cl	# 8639	[c=13 l=3]  *iorqi_1/1
+	leaq	101(%rbx), %rax	# 16096	[c=4 l=4]  *leadi
+	movb	%cl, 101(%rbx)	# 8640	[c=4 l=3]  *movqi_internal/8
+	jmp	.L1159	# 18387	[c=1 l=5]  jump
+.L1185:
+	movq	104(%rbx), %rsi	# 9208	[c=9 l=4]  *movdi_internal/3
+	orl	$63, %edx	# 16072	[c=4 l=3]  *iorsi_1/0
+	andb	(%rsi), %cl	# 9209	[c=9 l=2]  *andqi_1/1
+	leaq	flag_update_table_sub8(%rip), %rsi	# 14856	[c=1 l=7]  *movdi_internal/4
+	orb	(%rsi,%rax), %cl	# 9214	[c=13 l=3]  *iorqi_1/1
+	leaq	101(%rbx), %rax	# 16073	[c=4 l=4]  *leadi
+	movb	%cl, 101(%rbx)	# 9215	[c=4 l=3]  *movqi_internal/8
+	jmp	.L1194	# 18389	[c=1 l=5]  jump
+.L915:
+	movq	1040(%rbx), %rax	# 5376	[c=9 l=7]  *movdi_internal/3
+	movzbl	61(%rax), %edx	# 5377	[c=13 l=4]  *zero_extendqisi2/0
+	cmpl	%r15d, %ecx	# 5378	[c=4 l=3]  *cmpsi_1/0
+	jb	.L917	# 5379	[c=13 l=6]  *jcc
+	cmpb	$1, 1081(%rbx)	# 5383	[c=13 l=7]  *cmpqi_1/0
+	jbe	.L917	# 5384	[c=13 l=6]  *jcc
+.L918:
+	movl	$62, %esi	# 5387	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 5388	[c=4 l=3]  *movdi_internal/3
+	movl	%edx, 16(%rsp)	# 15804	[c=4 l=4]  *movsi_internal/1
+	call	data_read_mapped	# 5389	[c=10 l=5]  *call_value
+	movl	16(%rsp), %edx	# 15805	[c=9 l=4]  *movsi_internal/0
+	movl	%eax, %esi	# 5390	[c=4 l=2]  *movsi_internal/0
+	jmp	.L919	# 18391	[c=1 l=5]  jump
+.L1116:
+	movzbl	%cl, %edx	# 7879	[c=4 l=3]  *zero_extendqisi2/0
+	movl	%ebp, %esi	# 7881	[c=4 l=2]  *movsi_internal/0
+	movq	%rbx, %rdi	# 7882	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 7883	[c=0 l=5]  *call
+	jmp	.L1117	# 18393	[c=1 l=5]  jump
+.L1804:
+	movl	$59, %eax	# 3128	[c=4 l=5]  *movsi_internal/0
+	sarl	$16, %r15d	# 3127	[c=4 l=4]  *ashrsi3_1/0
+	subl	5176(%rbx), %eax	# 3129	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %eax	# 3130	[c=13 l=6]  *cmpsi_1/1
+	jb	.L758	# 3131	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%rbx)	# 3133	[c=13 l=7]  *cmpqi_ccno_1/1
+	jne	.L759	# 3134	[c=13 l=6]  *jcc
+.L758:
+	movq	1040(%rbx), %rax	# 3137	[c=9 l=7]  *movdi_internal/3
+	movb	%r15b, 59(%rax)	# 3138	[c=4 l=4]  *movqi_internal/8
+	jmp	.L757	# 18395	[c=1 l=5]  jump
+.L1848:
+	movq	104(%rbx), %rcx	# 420	[c=9 l=4]  *movdi_internal/3
+	movq	1040(%rbx), %rsi	# 419	[c=9 l=7]  *movdi_internal/3
+	movzbl	(%rcx), %edi	# 18023	[c=5 l=3]  *movqi_internal/4
+	andl	%edx, %edi	# 18857	[c=4 l=2]  *andsi_1/0
+	notl	%edx	# 424	[c=4 l=2]  *one_cmplsi2_1/0
+	movzbl	%dil, %ecx	# 14976	[c=4 l=4]  *zero_extendqisi2/0
+	movzbl	63(%rsi), %edi	# 425	[c=13 l=4]  *zero_extendqisi2/0
+	andl	%edi, %edx	# 426	[c=4 l=2]  *andsi_1/0
+	orl	%ecx, %edx	# 427	[c=4 l=2]  *iorsi_1/0
+	movb	%dl, 63(%rsi)	# 428	[c=4 l=3]  *movqi_internal/8
+	movb	$0, 100(%rbx)	# 429	[c=4 l=4]  *movqi_internal/8
+	jmp	.L567	# 18397	[c=1 l=5]  jump
+.L1844:
+	movl	(%rbx), %eax	# 15303	[c=5 l=2]  *movsi_internal/0
+	addq	$1, 48(%rbx)	# 6624	[c=13 l=5]  *adddi_1/0
+	addl	$1, %eax	# 6619	[c=4 l=3]  *addsi_1/0
+	andl	992(%rbx), %eax	# 6622	[c=13 l=6]  *andsi_1/1
+	movl	%eax, (%rbx)	# 6623	[c=4 l=2]  *movsi_internal/1
+	jmp	.L1019	# 18399	[c=1 l=5]  jump
+.L1843:
+	movslq	%ebp, %rdx	# 6540	[c=4 l=3]  *extendsidi2_rex64/1
+	cmpb	$0, 6568(%rbx,%rdx)	# 6543	[c=14 l=8]  *cmpqi_ccno_1/1
+	js	.L1011	# 6544	[c=13 l=6]  *jcc
+	jmp	.L1010	# 18402	[c=1 l=5]  jump
+.L1755:
+	movl	(%rbx), %eax	# 15325	[c=5 l=2]  *movsi_internal/0
+	addq	$2, 48(%rbx)	# 6973	[c=13 l=5]  *adddi_1/0
+	addl	$2, %eax	# 6968	[c=4 l=3]  *addsi_1/0
+	andl	992(%rbx), %eax	# 6971	[c=13 l=6]  *andsi_1/1
+	movl	%eax, (%rbx)	# 6972	[c=4 l=2]  *movsi_internal/1
+	jmp	.L1045	# 18404	[c=1 l=5]  jump
+.L1752:
+	movl	(%rbx), %eax	# 15323	[c=5 l=2]  *movsi_internal/0
+	addq	$1, 48(%rbx)	# 6908	[c=13 l=5]  *adddi_1/0
+	addl	$1, %eax	# 6903	[c=4 l=3]  *addsi_1/0
+	andl	992(%rbx), %eax	# 6906	[c=13 l=6]  *andsi_1/1
+	movl	%eax, (%rbx)	# 6907	[c=4 l=2]  *movsi_internal/1
+	jmp	.L1041	# 18406	[c=1 l=5]  jump
+.L1749:
+	movl	(%rbx), %eax	# 15321	[c=5 l=2]  *movsi_internal/0
+	addq	$2, 48(%rbx)	# 6843	[c=13 l=5]  *adddi_1/0
+	addl	$2, %eax	# 6838	[c=4 l=3]  *addsi_1/0
+	andl	992(%rbx), %eax	# 6841	[c=13 l=6]  *andsi_1/1
+	movl	%eax, (%rbx)	# 6842	[c=4 l=2]  *movsi_internal/1
+	jmp	.L1037	# 18408	[c=1 l=5]  jump
+.L1747:
+	movl	(%rbx), %eax	# 15315	[c=5 l=2]  *movsi_internal/0
+	addq	$1, 48(%rbx)	# 6770	[c=13 l=5]  *adddi_1/0
+	addl	$1, %eax	# 6765	[c=4 l=3]  *addsi_1/0
+	andl	992(%rbx), %eax	# 6768	[c=13 l=6]  *andsi_1/1
+	movl	%eax, (%rbx)	# 6769	[c=4 l=2]  *movsi_internal/1
+	jmp	.L1031	# 18410	[c=1 l=5]  jump
+.L1745:
+	movl	(%rbx), %eax	# 15309	[c=5 l=2]  *movsi_internal/0
+	addq	$2, 48(%rbx)	# 6697	[c=13 l=5]  *adddi_1/0
+	addl	$2, %eax	# 6692	[c=4 l=3]  *addsi_1/0
+	andl	992(%rbx), %eax	# 6695	[c=13 l=6]  *andsi_1/1
+	movl	%eax, (%rbx)	# 6696	[c=4 l=2]  *movsi_internal/1
+	jmp	.L1025	# 18412	[c=1 l=5]  jump
+.L1737:
+	movl	(%rbx), %eax	# 15329	[c=5 l=2]  *movsi_internal/0
+	addq	$2, 48(%rbx)	# 7103	[c=13 l=5]  *adddi_1/0
+	addl	$2, %eax	# 7098	[c=4 l=3]  *addsi_1/0
+	andl	992(%rbx), %eax	# 7101	[c=13 l=6]  *andsi_1/1
+	movl	%eax, (%rbx)	# 7102	[c=4 l=2]  *movsi_internal/1
+	jmp	.L1053	# 18414	[c=1 l=5]  jump
+.L1734:
+	movl	(%rbx), %eax	# 15327	[c=5 l=2]  *movsi_internal/0
+	addq	$1, 48(%rbx)	# 7038	[c=13 l=5]  *adddi_1/0
+	addl	$1, %eax	# 7033	[c=4 l=3]  *addsi_1/0
+	andl	992(%rbx), %eax	# 7036	[c=13 l=6]  *andsi_1/1
+	movl	%eax, (%rbx)	# 7037	[c=4 l=2]  *movsi_internal/1
+	jmp	.L1049	# 18416	[c=1 l=5]  jump
+.L1899:
+	movl	(%rbx), %eax	# 15066	[c=5 l=2]  *movsi_internal/0
+	addq	$2, 48(%rbx)	# 2188	[c=13 l=5]  *adddi_1/0
+	addl	$2, %eax	# 2183	[c=4 l=3]  *addsi_1/0
+	andl	992(%rbx), %eax	# 2186	[c=13 l=6]  *andsi_1/1
+	movl	%eax, (%rbx)	# 2187	[c=4 l=2]  *movsi_internal/1
+	jmp	.L677	# 18418	[c=1 l=5]  jump
+.L1895:
+	movl	(%rbx), %eax	# 15064	[c=5 l=2]  *movsi_internal/0
+	addq	$1, 48(%rbx)	# 2108	[c=13 l=5]  *adddi_1/0
+	addl	$1, %eax	# 2103	[c=4 l=3]  *addsi_1/0
+	andl	992(%rbx), %eax	# 2106	[c=13 l=6]  *andsi_1/1
+	movl	%eax, (%rbx)	# 2107	[c=4 l=2]  *movsi_internal/1
+	jmp	.L672	# 18420	[c=1 l=5]  jump
+.L1888:
+	movslq	%ebp, %rax	# 1718	[c=4 l=3]  *extendsidi2_rex64/1
+	xorl	%edx, %edx	# 17960	[c=4 l=2]  *movdi_xor
+	cmpb	$0, 6568(%rbx,%rax)	# 1721	[c=14 l=8]  *cmpqi_ccno_1/1
+	js	.L651	# 1722	[c=13 l=6]  *jcc
+	jmp	.L650	# 18423	[c=1 l=5]  jump
+.L1367:
+	leal	0(,%rsi,8), %ecx	# 15934	[c=12 l=7]  *leasi
+	movl	$1, %edi	# 12626	[c=4 l=5]  *movdi_internal/2
+	salq	%cl, %rdi	# 12627	[c=4 l=3]  *ashldi3_1/0
+	xorl	%ecx, %ecx	# 17567	[c=4 l=2]  *movdi_xor
+	subq	$1, %rdi	# 12628	[c=4 l=4]  *adddi_1/0
+	jmp	.L1370	# 18425	[c=1 l=5]  jump
+.L1790:
+	subq	$2, %rax	# 12664	[c=4 l=4]  *adddi_1/0
+	xorl	%edx, %edx	# 17563	[c=4 l=2]  *movdi_xor
+	subq	%r9, %rax	# 12665	[c=4 l=3]  *subdi_1/0
+	divq	%r10	# 15928	[c=0 l=3]  *udivmoddi4_noext
+	leaq	1(%rax), %rdx	# 15929	[c=4 l=4]  *leadi
+	jmp	.L1374	# 18427	[c=1 l=5]  jump
+.L1023:
+	movq	%rbx, %rdi	# 6682	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 6683	[c=10 l=5]  *call_value
+	jmp	.L1024	# 18429	[c=1 l=5]  jump
+.L1008:
+	movl	%ebp, %esi	# 6531	[c=4 l=2]  *movsi_internal/0
+	movq	%rbx, %rdi	# 6532	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 6533	[c=10 l=5]  *call_value
+	jmp	.L1009	# 18431	[c=1 l=5]  jump
+.L1029:
+	movq	%rbx, %rdi	# 6755	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 6756	[c=10 l=5]  *call_value
+	jmp	.L1030	# 18433	[c=1 l=5]  jump
+.L747:
+	movq	%rbx, %rdi	# 3013	[c=4 l=3]  *movdi_internal/3
+	movq	%rcx, 24(%rsp)	# 15793	[c=4 l=5]  *movdi_internal/5
+	movl	%r8d, 16(%rsp)	# 15791	[c=4 l=5]  *movsi_internal/1
+	call	data_write_page	# 3014	[c=0 l=5]  *call
+	movq	24(%rsp), %rcx	# 15794	[c=9 l=5]  *movdi_internal/3
+	movl	16(%rsp), %r8d	# 15792	[c=9 l=5]  *movsi_internal/0
+	jmp	.L748	# 18435	[c=1 l=5]  jump
+.L1360:
+	movzbl	%cl, %edx	# 12418	[c=4 l=3]  *zero_extendqisi2/0
+	movl	%ebp, %esi	# 12420	[c=4 l=2]  *movsi_internal/0
+	movq	%rbx, %rdi	# 12421	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 12422	[c=0 l=5]  *call
+	jmp	.L1361	# 18437	[c=1 l=5]  jump
+.L731:
+	movl	$59, %esi	# 2834	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 2835	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 2836	[c=0 l=5]  *call
+	jmp	.L732	# 18439	[c=1 l=5]  jump
+.L727:
+	movl	$59, %esi	# 2783	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 2784	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 2785	[c=10 l=5]  *call_value
+	jmp	.L728	# 18441	[c=1 l=5]  jump
+.L825:
+	movq	%rbx, %rdi	# 4040	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 4041	[c=10 l=5]  *call_value
+	jmp	.L826	# 18443	[c=1 l=5]  jump
+.L813:
+	movq	%rbx, %rdi	# 3912	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 3913	[c=10 l=5]  *call_value
+	jmp	.L814	# 18445	[c=1 l=5]  jump
+.L819:
+	movq	%rbx, %rdi	# 3976	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 3977	[c=10 l=5]  *call_value
+	jmp	.L820	# 18447	[c=1 l=5]  jump
+.L799:
+	movq	%rbx, %rdi	# 3710	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 3711	[c=10 l=5]  *call_value
+	jmp	.L800	# 18449	[c=1 l=5]  jump
+.L830:
+	movq	%rbx, %rdi	# 4098	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 4099	[c=10 l=5]  *call_value
+	jmp	.L831	# 18451	[c=1 l=5]  jump
+.L1352:
+	movzbl	%cl, %edx	# 12295	[c=4 l=3]  *zero_extendqisi2/0
+	movl	%ebp, %esi	# 12297	[c=4 l=2]  *movsi_internal/0
+	movq	%rbx, %rdi	# 12298	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 12299	[c=0 l=5]  *call
+	jmp	.L1353	# 18453	[c=1 l=5]  jump
+.L1348:
+	movl	$59, %esi	# 12245	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 12246	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 12247	[c=0 l=5]  *call
+	jmp	.L1349	# 18455	[c=1 l=5]  jump
+.L1344:
+	movl	$59, %esi	# 12194	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 12195	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 12196	[c=10 l=5]  *call_value
+	jmp	.L1345	# 18457	[c=1 l=5]  jump
+.L1337:
+	movzbl	%cl, %edx	# 12092	[c=4 l=3]  *zero_extendqisi2/0
+	movl	%ebp, %esi	# 12094	[c=4 l=2]  *movsi_internal/0
+	movq	%rbx, %rdi	# 12095	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 12096	[c=0 l=5]  *call
+	jmp	.L1338	# 18459	[c=1 l=5]  jump
+.L1331:
+	movl	$59, %esi	# 12003	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 12004	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 12005	[c=0 l=5]  *call
+	jmp	.L1549	# 18461	[c=1 l=5]  jump
+.L1327:
+	movl	$59, %esi	# 11952	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 11953	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 11954	[c=10 l=5]  *call_value
+	jmp	.L1328	# 18463	[c=1 l=5]  jump
+.L1320:
+	movl	%ebp, %esi	# 11858	[c=4 l=2]  *movsi_internal/0
+	movq	%rbx, %rdi	# 11859	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 11860	[c=10 l=5]  *call_value
+	jmp	.L1321	# 18465	[c=1 l=5]  jump
+.L1315:
+	movl	%ebp, %esi	# 11799	[c=4 l=2]  *movsi_internal/0
+	movq	%rbx, %rdi	# 11800	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 11801	[c=10 l=5]  *call_value
+	jmp	.L1316	# 18467	[c=1 l=5]  jump
+.L1310:
+	movl	%ebp, %esi	# 11740	[c=4 l=2]  *movsi_internal/0
+	movq	%rbx, %rdi	# 11741	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 11742	[c=10 l=5]  *call_value
+	jmp	.L1311	# 18469	[c=1 l=5]  jump
+.L1305:
+	movl	%ebp, %esi	# 11681	[c=4 l=2]  *movsi_internal/0
+	movq	%rbx, %rdi	# 11682	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 11683	[c=10 l=5]  *call_value
+	jmp	.L1306	# 18471	[c=1 l=5]  jump
+.L1035:
+	movq	%rbx, %rdi	# 6828	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 6829	[c=10 l=5]  *call_value
+	jmp	.L1036	# 18473	[c=1 l=5]  jump
+.L1017:
+	movq	%rbx, %rdi	# 6609	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 6610	[c=10 l=5]  *call_value
+	jmp	.L1018	# 18475	[c=1 l=5]  jump
+.L1013:
+	movl	%r15d, %edx	# 6567	[c=4 l=3]  *movsi_internal/0
+	movl	%ebp, %esi	# 6568	[c=4 l=2]  *movsi_internal/0
+	movq	%rbx, %rdi	# 6569	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 6570	[c=0 l=5]  *call
+	jmp	.L1014	# 18477	[c=1 l=5]  jump
+.L744:
+	movq	%rbx, %rdi	# 2986	[c=4 l=3]  *movdi_internal/3
+	movq	%rcx, 24(%rsp)	# 15789	[c=4 l=5]  *movdi_internal/5
+	movl	%r8d, 16(%rsp)	# 15787	[c=4 l=5]  *movsi_internal/1
+	call	data_read_page	# 2987	[c=10 l=5]  *call_value
+	movq	24(%rsp), %rcx	# 15790	[c=9 l=5]  *movdi_internal/3
+	movl	16(%rsp), %r8d	# 15788	[c=9 l=5]  *movsi_internal/0
+	movslq	6048(%rbx), %rsi	# 13760	[c=13 l=7]  *extendsidi2_rex64/1
+	movl	%eax, %r14d	# 2988	[c=4 l=3]  *movsi_internal/0
+	jmp	.L745	# 18479	[c=1 l=5]  jump
+.L1938:
+	xorl	%eax, %eax	# 18013	[c=4 l=2]  *movsi_xor
+	movq	%rbx, %rdi	# 604	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, 96(%rbx)	# 18014	[c=4 l=3]  *movsi_internal/1
+	call	do_events	# 605	[c=0 l=5]  *call
+	jmp	.L581	# 18481	[c=1 l=5]  jump
+.L865:
+	movl	%ebp, %esi	# 4513	[c=4 l=2]  *movsi_internal/0
+	movq	%rbx, %rdi	# 4514	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 4515	[c=10 l=5]  *call_value
+	jmp	.L866	# 18483	[c=1 l=5]  jump
+.L860:
+	movl	%ebp, %esi	# 4454	[c=4 l=2]  *movsi_internal/0
+	movq	%rbx, %rdi	# 4455	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 4456	[c=10 l=5]  *call_value
+	jmp	.L861	# 18485	[c=1 l=5]  jump
+.L855:
+	movl	%ebp, %esi	# 4393	[c=4 l=2]  *movsi_internal/0
+	movq	%rbx, %rdi	# 4394	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 4395	[c=10 l=5]  *call_value
+	jmp	.L856	# 18487	[c=1 l=5]  jump
+.L850:
+	movl	%ebp, %esi	# 4334	[c=4 l=2]  *movsi_internal/0
+	movq	%rbx, %rdi	# 4335	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 4336	[c=10 l=5]  *call_value
+	jmp	.L851	# 18489	[c=1 l=5]  jump
+.L845:
+	movl	%ebp, %esi	# 4273	[c=4 l=2]  *movsi_internal/0
+	movq	%rbx, %rdi	# 4274	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 4275	[c=10 l=5]  *call_value
+	jmp	.L846	# 18491	[c=1 l=5]  jump
+.L840:
+	movl	%ebp, %esi	# 4214	[c=4 l=2]  *movsi_internal/0
+	movq	%rbx, %rdi	# 4215	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 4216	[c=10 l=5]  *call_value
+	jmp	.L841	# 18493	[c=1 l=5]  jump
+.L835:
+	movq	%rbx, %rdi	# 4156	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 4157	[c=10 l=5]  *call_value
+	jmp	.L836	# 18495	[c=1 l=5]  jump
+.L1086:
+	movzbl	%cl, %edx	# 7521	[c=4 l=3]  *zero_extendqisi2/0
+	movq	%rbx, %rdi	# 7524	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 7525	[c=0 l=5]  *call
+	jmp	.L1087	# 18497	[c=1 l=5]  jump
+.L1081:
+	movzbl	%cl, %edx	# 7463	[c=4 l=3]  *zero_extendqisi2/0
+	movq	%rbx, %rdi	# 7466	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 7467	[c=0 l=5]  *call
+	jmp	.L1082	# 18499	[c=1 l=5]  jump
+.L1101:
+	movl	%ebp, %esi	# 7702	[c=4 l=2]  *movsi_internal/0
+	movq	%rbx, %rdi	# 7703	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 7704	[c=0 l=5]  *call
+	jmp	.L1102	# 18501	[c=1 l=5]  jump
+.L653:
+	movl	%ebp, %esi	# 1747	[c=4 l=2]  *movsi_internal/0
+	movq	%rbx, %rdi	# 1748	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 1749	[c=0 l=5]  *call
+	jmp	.L654	# 18503	[c=1 l=5]  jump
+.L1070:
+	movq	%rbx, %rdi	# 7344	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 7345	[c=0 l=5]  *call
+	jmp	.L1071	# 18505	[c=1 l=5]  jump
+.L1076:
+	movzbl	%cl, %edx	# 7405	[c=4 l=3]  *zero_extendqisi2/0
+	movq	%rbx, %rdi	# 7408	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 7409	[c=0 l=5]  *call
+	jmp	.L1077	# 18507	[c=1 l=5]  jump
+.L909:
+	movzbl	%cl, %edx	# 5278	[c=4 l=3]  *zero_extendqisi2/0
+	movq	%rbx, %rdi	# 5281	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 5282	[c=0 l=5]  *call
+	jmp	.L910	# 18509	[c=1 l=5]  jump
+.L1064:
+	movq	%rbx, %rdi	# 7280	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 7281	[c=0 l=5]  *call
+	jmp	.L1065	# 18511	[c=1 l=5]  jump
+.L648:
+	movl	%ebp, %esi	# 1709	[c=4 l=2]  *movsi_internal/0
+	movq	%rbx, %rdi	# 1710	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 1711	[c=10 l=5]  *call_value
+	movl	%eax, %ecx	# 1712	[c=4 l=2]  *movsi_internal/0
+	jmp	.L649	# 18513	[c=1 l=5]  jump
+.L1111:
+	movl	%ebp, %esi	# 7822	[c=4 l=2]  *movsi_internal/0
+	movq	%rbx, %rdi	# 7823	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 7824	[c=0 l=5]  *call
+	jmp	.L1112	# 18515	[c=1 l=5]  jump
+.L1091:
+	movl	%ebp, %esi	# 7582	[c=4 l=2]  *movsi_internal/0
+	movq	%rbx, %rdi	# 7583	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 7584	[c=0 l=5]  *call
+	jmp	.L1092	# 18517	[c=1 l=5]  jump
+.L722:
+	movl	$59, %esi	# 2721	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 2722	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 2723	[c=10 l=5]  *call_value
+	jmp	.L723	# 18519	[c=1 l=5]  jump
+.L1912:
+	movl	$59, %esi	# 2689	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 2690	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 2691	[c=10 l=5]  *call_value
+	jmp	.L719	# 18521	[c=1 l=5]  jump
+.L714:
+	movl	$60, %esi	# 2631	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 2632	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 2633	[c=10 l=5]  *call_value
+	movl	%eax, %esi	# 2634	[c=4 l=2]  *movsi_internal/0
+	jmp	.L715	# 18523	[c=1 l=5]  jump
+.L1383:
+	cmpb	$0, 48(%r14)	# 12869	[c=13 l=5]  *cmpqi_ccno_1/1
+	jne	.L1384	# 12870	[c=13 l=6]  *jcc
+	leaq	112(%rsp), %rax	# 15920	[c=4 l=5]  *leadi
+	movq	%rax, 24(%rsp)	# 15838	[c=4 l=5]  *movdi_internal/5
+	movq	%rax, %rdi	# 12874	[c=4 l=3]  *movdi_internal/3
+	call	*8(%r14)	# 12875	[c=18 l=4]  *call_value
+	testb	%al, %al	# 12877	[c=4 l=2]  *cmpqi_ccno_1/0
+	je	.L1384	# 12878	[c=13 l=6]  *jcc
+	cmpl	$0, 600(%rbx)	# 12880	[c=13 l=7]  *cmpsi_ccno_1/1
+	jne	.L1385	# 12881	[c=13 l=6]  *jcc
+	movq	24(%rsp), %rsi	# 12888	[c=9 l=5]  *movdi_internal/3
+	leaq	100(%rsp), %rcx	# 15918	[c=4 l=5]  *leadi
+	leaq	96(%rsp), %rdx	# 15919	[c=4 l=5]  *leadi
+	movq	%r14, %rdi	# 12889	[c=4 l=3]  *movdi_internal/3
+	call	hle_cost@PLT	# 12890	[c=10 l=5]  *call_value
+	testb	%al, %al	# 12892	[c=4 l=2]  *cmpqi_ccno_1/0
+	je	.L1385	# 12893	[c=13 l=6]  *jcc
+	testq	%r13, %r13	# 12895	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L1386	# 12896	[c=13 l=2]  *jcc
+	movl	96(%rsp), %eax	# 12898	[c=10 l=4]  *zero_extendsidi2/3
+	movzbl	11(%rbp), %edx	# 12900	[c=13 l=4]  zero_extendqidi2/0
+	addq	%r12, %rax	# 12899	[c=4 l=3]  *adddi_1/0
+	subq	%rdx, %rax	# 12901	[c=4 l=3]  *subdi_1/0
+	cmpq	%r13, %rax	# 12902	[c=4 l=3]  *cmpdi_1/0
+	jnb	.L1385	# 12903	[c=13 l=6]  *jcc
+.L1386:
+	movzwl	14(%rbp), %edx	# 12909	[c=13 l=4]  zero_extendhidi2/0
+	movl	100(%rsp), %eax	# 12906	[c=10 l=4]  *zero_extendsidi2/3
+	addq	48(%rbx), %rax	# 12908	[c=13 l=4]  *adddi_1/1
+	subq	%rdx, %rax	# 12910	[c=4 l=3]  *subdi_1/0
+	cmpq	56(%rbx), %rax	# 12911	[c=13 l=4]  *cmpdi_1/1
+	jnb	.L1385	# 12912	[c=13 l=6]  *jcc
+	movq	24(%rsp), %rdi	# 12916	[c=9 l=5]  *movdi_internal/3
+	call	*16(%r14)	# 12917	[c=0 l=4]  *call
+	movq	1040(%rbx), %rax	# 12919	[c=9 l=7]  *movdi_internal/3
+	addl	$1, 108(%r14)	# 12918	[c=13 l=5]  *addsi_1/0
+	movzbl	136(%rsp), %edx	# 12920	[c=9 l=8]  *movqi_internal/4
+	movl	96(%rsp), %r14d	# 12923	[c=10 l=5]  *zero_extendsidi2/3
+	movb	%dl, 63(%rax)	# 12921	[c=4 l=3]  *movqi_internal/8
+	addq	%r12, %r14	# 12924	[c=4 l=3]  *adddi_1/0
+	movl	152(%rsp), %r12d	# 12935	[c=9 l=8]  *movsi_internal/0
+	movb	$0, 100(%rbx)	# 12922	[c=4 l=4]  *movqi_internal/8
+	movzbl	11(%rbp), %eax	# 12925	[c=13 l=4]  zero_extendqidi2/0
+	movzwl	14(%rbp), %edx	# 12931	[c=13 l=4]  zero_extendhidi2/0
+	movl	$2, 96(%rbx)	# 12934	[c=4 l=7]  *movsi_internal/1
+	subq	%rax, %r14	# 12926	[c=4 l=3]  *subdi_1/0
+	movl	100(%rsp), %eax	# 12928	[c=10 l=4]  *zero_extendsidi2/3
+	movq	%r14, 16(%rsp)	# 15840	[c=4 l=5]  *movdi_internal/5
+	subq	%rdx, %rax	# 12932	[c=4 l=3]  *subdi_1/0
+	movq	%r14, 40(%rbx)	# 12927	[c=4 l=4]  *movdi_internal/5
+	addq	%rax, 48(%rbx)	# 12933	[c=13 l=4]  *adddi_1/0
+	cmpl	$-1, %r12d	# 12936	[c=4 l=4]  *cmpsi_1/0
+	je	.L1939	# 12937	[c=13 l=6]  *jcc
+.L1387:
+	movl	%r12d, (%rbx)	# 13131	[c=4 l=3]  *movsi_internal/1
+	movq	56(%rbx), %rax	# 15736	[c=9 l=4]  *movdi_internal/3
+	cmpq	%rax, 48(%rbx)	# 13133	[c=13 l=4]  *cmpdi_1/0
+	jnb	.L1940	# 13134	[c=13 l=6]  *jcc
+.L1408:
+	movl	(%rbx), %ebp	# 13141	[c=6 l=2]  *zero_extendsidi2/3
+	movq	16(%rsp), %rax	# 15737	[c=9 l=5]  *movdi_internal/3
+	movl	$1, 96(%rbx)	# 13146	[c=4 l=7]  *movsi_internal/1
+	movq	%rbp, %rdx	# 16784	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbp	# 13143	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %rbp	# 13145	[c=13 l=7]  *adddi_1/1
+	movzbl	11(%rbp), %r12d	# 13147	[c=13 l=5]  zero_extendqidi2/0
+	addq	%rax, %r12	# 13148	[c=4 l=3]  *adddi_1/0
+	movzwl	14(%rbp), %eax	# 13150	[c=13 l=4]  zero_extendhidi2/0
+	addq	%rax, 48(%rbx)	# 13151	[c=13 l=4]  *adddi_1/0
+	movq	%r12, 40(%rbx)	# 13149	[c=4 l=4]  *movdi_internal/5
+	movzbl	9(%rbp), %eax	# 13152	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%edx, %eax	# 13153	[c=4 l=2]  *addsi_1/0
+	movl	%eax, (%rbx)	# 13154	[c=4 l=2]  *movsi_internal/1
+	jmp	*0(%rbp)	# 17550	[c=5 l=3]  *indirect_jump
+.L1830:
+	movl	$61, %esi	# 5754	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 5755	[c=4 l=3]  *movdi_internal/3
+	movl	%edx, 16(%rsp)	# 15818	[c=4 l=4]  *movsi_internal/1
+	call	data_read_mapped	# 5756	[c=10 l=5]  *call_value
+	movl	16(%rsp), %edx	# 15819	[c=9 l=4]  *movsi_internal/0
+	movl	%eax, %ebp	# 5757	[c=4 l=2]  *movsi_internal/0
+	movl	$62, %eax	# 5758	[c=4 l=5]  *movsi_internal/0
+	subl	%r15d, %eax	# 5759	[c=4 l=3]  *subsi_1/0
+	cmpl	%edx, %eax	# 5760	[c=4 l=2]  *cmpsi_1/0
+	jb	.L1941	# 5761	[c=13 l=6]  *jcc
+.L954:
+	movl	$62, %esi	# 5780	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 5781	[c=4 l=3]  *movdi_internal/3
+	movl	%edx, 16(%rsp)	# 15820	[c=4 l=4]  *movsi_internal/1
+	call	data_read_mapped	# 5782	[c=10 l=5]  *call_value
+	movl	16(%rsp), %edx	# 15821	[c=9 l=4]  *movsi_internal/0
+	jmp	.L955	# 18528	[c=1 l=5]  jump
+.L1740:
+	movl	$61, %esi	# 5511	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 5512	[c=4 l=3]  *movdi_internal/3
+	movl	%edx, 16(%rsp)	# 15810	[c=4 l=4]  *movsi_internal/1
+	call	data_read_mapped	# 5513	[c=10 l=5]  *call_value
+	movl	16(%rsp), %edx	# 15811	[c=9 l=4]  *movsi_internal/0
+	movl	%eax, %ecx	# 5514	[c=4 l=2]  *movsi_internal/0
+	movl	$62, %eax	# 5515	[c=4 l=5]  *movsi_internal/0
+	subl	%r15d, %eax	# 5516	[c=4 l=3]  *subsi_1/0
+	cmpl	%edx, %eax	# 5517	[c=4 l=2]  *cmpsi_1/0
+	jb	.L1942	# 5518	[c=13 l=6]  *jcc
+.L932:
+	movl	$62, %esi	# 5537	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 5538	[c=4 l=3]  *movdi_internal/3
+	movl	%edx, 24(%rsp)	# 15814	[c=4 l=4]  *movsi_internal/1
+	movl	%ecx, 16(%rsp)	# 15812	[c=4 l=4]  *movsi_internal/1
+	call	data_read_mapped	# 5539	[c=10 l=5]  *call_value
+	movl	16(%rsp), %ecx	# 15813	[c=9 l=4]  *movsi_internal/0
+	movl	24(%rsp), %edx	# 15815	[c=9 l=4]  *movsi_internal/0
+	movl	%eax, %r14d	# 5540	[c=4 l=3]  *movsi_internal/0
+	jmp	.L933	# 18531	[c=1 l=5]  jump
+.L1812:
+	movl	$61, %esi	# 3410	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 3411	[c=4 l=3]  *movdi_internal/3
+	call	data_read_mapped	# 3412	[c=10 l=5]  *call_value
+	movl	%eax, %edx	# 3413	[c=4 l=2]  *movsi_internal/0
+	movl	$62, %eax	# 3414	[c=4 l=5]  *movsi_internal/0
+	subl	%r14d, %eax	# 3415	[c=4 l=3]  *subsi_1/0
+	cmpl	%r15d, %eax	# 3416	[c=4 l=3]  *cmpsi_1/0
+	jb	.L1943	# 3417	[c=13 l=6]  *jcc
+.L775:
+	movl	$62, %esi	# 3436	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 3437	[c=4 l=3]  *movdi_internal/3
+	movl	%edx, 16(%rsp)	# 15798	[c=4 l=4]  *movsi_internal/1
+	call	data_read_mapped	# 3438	[c=10 l=5]  *call_value
+	movl	16(%rsp), %edx	# 15799	[c=9 l=4]  *movsi_internal/0
+	movl	%eax, %ebp	# 3439	[c=4 l=2]  *movsi_internal/0
+	jmp	.L776	# 18534	[c=1 l=5]  jump
+.L1788:
+	movl	$61, %esi	# 13386	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 13387	[c=4 l=3]  *movdi_internal/3
+	movl	%edx, 32(%rsp)	# 15869	[c=4 l=4]  *movsi_internal/1
+	movq	%rcx, 24(%rsp)	# 15867	[c=4 l=5]  *movdi_internal/5
+	movq	%r10, 16(%rsp)	# 15865	[c=4 l=5]  *movdi_internal/5
+	call	data_read_mapped	# 13388	[c=10 l=5]  *call_value
+	movl	32(%rsp), %edx	# 15870	[c=9 l=4]  *movsi_internal/0
+	movq	16(%rsp), %r10	# 15866	[c=9 l=5]  *movdi_internal/3
+	movl	%eax, %r14d	# 13389	[c=4 l=3]  *movsi_internal/0
+	movl	$62, %eax	# 13390	[c=4 l=5]  *movsi_internal/0
+	movq	24(%rsp), %rcx	# 15868	[c=9 l=5]  *movdi_internal/3
+	subl	%edx, %eax	# 13391	[c=4 l=2]  *subsi_1/0
+	cmpl	%r15d, %eax	# 13392	[c=4 l=3]  *cmpsi_1/0
+	jb	.L1944	# 13393	[c=13 l=6]  *jcc
+.L1427:
+	movl	$62, %esi	# 13412	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 13413	[c=4 l=3]  *movdi_internal/3
+	movq	%rcx, 24(%rsp)	# 15873	[c=4 l=5]  *movdi_internal/5
+	movq	%r10, 16(%rsp)	# 15871	[c=4 l=5]  *movdi_internal/5
+	call	data_read_mapped	# 13414	[c=10 l=5]  *call_value
+	movq	16(%rsp), %r10	# 15872	[c=9 l=5]  *movdi_internal/3
+	movq	24(%rsp), %rcx	# 15874	[c=9 l=5]  *movdi_internal/3
+	jmp	.L1428	# 18537	[c=1 l=5]  jump
+.L1903:
+	movl	$61, %esi	# 2342	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 2343	[c=4 l=3]  *movdi_internal/3
+	call	data_read_mapped	# 2344	[c=10 l=5]  *call_value
+	movl	%eax, %edx	# 2345	[c=4 l=2]  *movsi_internal/0
+	cmpl	%r15d, %ebp	# 2346	[c=4 l=3]  *cmpsi_1/0
+	jb	.L1945	# 2347	[c=13 l=6]  *jcc
+.L689:
+	movl	$62, %esi	# 2364	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 2365	[c=4 l=3]  *movdi_internal/3
+	movl	%edx, 16(%rsp)	# 15783	[c=4 l=4]  *movsi_internal/1
+	call	data_read_mapped	# 2366	[c=10 l=5]  *call_value
+	movl	16(%rsp), %edx	# 15784	[c=9 l=4]  *movsi_internal/0
+	movl	%eax, %ebp	# 2367	[c=4 l=2]  *movsi_internal/0
+	jmp	.L690	# 18540	[c=1 l=5]  jump
+.L1835:
+	movl	$61, %esi	# 5983	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 5984	[c=4 l=3]  *movdi_internal/3
+	movl	%edx, 16(%rsp)	# 15822	[c=4 l=4]  *movsi_internal/1
+	call	data_read_mapped	# 5985	[c=10 l=5]  *call_value
+	movl	16(%rsp), %edx	# 15823	[c=9 l=4]  *movsi_internal/0
+	movl	%eax, %ebp	# 5986	[c=4 l=2]  *movsi_internal/0
+	movl	$62, %eax	# 5987	[c=4 l=5]  *movsi_internal/0
+	subl	%r15d, %eax	# 5988	[c=4 l=3]  *subsi_1/0
+	cmpl	%edx, %eax	# 5989	[c=4 l=2]  *cmpsi_1/0
+	jb	.L1946	# 5990	[c=13 l=6]  *jcc
+.L976:
+	movl	$62, %esi	# 6009	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 6010	[c=4 l=3]  *movdi_internal/3
+	movl	%edx, 16(%rsp)	# 15824	[c=4 l=4]  *movsi_internal/1
+	call	data_read_mapped	# 6011	[c=10 l=5]  *call_value
+	movl	16(%rsp), %edx	# 15825	[c=9 l=4]  *movsi_internal/0
+	jmp	.L977	# 18543	[c=1 l=5]  jump
+.L1882:
+	movl	$61, %esi	# 1453	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 1454	[c=4 l=3]  *movdi_internal/3
+	movl	%ecx, 24(%rsp)	# 15769	[c=4 l=4]  *movsi_internal/1
+	movl	%edx, 16(%rsp)	# 15767	[c=4 l=4]  *movsi_internal/1
+	call	data_read_mapped	# 1455	[c=10 l=5]  *call_value
+	movl	16(%rsp), %edx	# 15768	[c=9 l=4]  *movsi_internal/0
+	movl	24(%rsp), %ecx	# 15770	[c=9 l=4]  *movsi_internal/0
+	movl	%eax, %r8d	# 1456	[c=4 l=3]  *movsi_internal/0
+	movl	$62, %eax	# 1457	[c=4 l=5]  *movsi_internal/0
+	subl	%edx, %eax	# 1458	[c=4 l=2]  *subsi_1/0
+	cmpl	%ecx, %eax	# 1459	[c=4 l=2]  *cmpsi_1/0
+	jb	.L1947	# 1460	[c=13 l=6]  *jcc
+.L627:
+	movl	$62, %esi	# 1479	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 1480	[c=4 l=3]  *movdi_internal/3
+	movl	%ecx, 32(%rsp)	# 15775	[c=4 l=4]  *movsi_internal/1
+	movl	%r8d, 24(%rsp)	# 15773	[c=4 l=5]  *movsi_internal/1
+	movl	%edx, 16(%rsp)	# 15771	[c=4 l=4]  *movsi_internal/1
+	call	data_read_mapped	# 1481	[c=10 l=5]  *call_value
+	movl	16(%rsp), %edx	# 15772	[c=9 l=4]  *movsi_internal/0
+	movl	24(%rsp), %r8d	# 15774	[c=9 l=5]  *movsi_internal/0
+	movl	32(%rsp), %ecx	# 15776	[c=9 l=4]  *movsi_internal/0
+	movl	%eax, %r15d	# 1482	[c=4 l=3]  *movsi_internal/0
+	jmp	.L628	# 18546	[c=1 l=5]  jump
+.L1700:
+	movl	$61, %esi	# 11497	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 11498	[c=4 l=3]  *movdi_internal/3
+	movl	%ecx, 16(%rsp)	# 15828	[c=4 l=4]  *movsi_internal/1
+	call	data_read_mapped	# 11499	[c=10 l=5]  *call_value
+	movl	16(%rsp), %ecx	# 15829	[c=9 l=4]  *movsi_internal/0
+	movl	%eax, %edx	# 11500	[c=4 l=2]  *movsi_internal/0
+	cmpl	%r15d, %ecx	# 11501	[c=4 l=3]  *cmpsi_1/0
+	jb	.L1948	# 11502	[c=13 l=6]  *jcc
+.L1291:
+	movl	$62, %esi	# 11519	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 11520	[c=4 l=3]  *movdi_internal/3
+	movl	%edx, 16(%rsp)	# 15830	[c=4 l=4]  *movsi_internal/1
+	call	data_read_mapped	# 11521	[c=10 l=5]  *call_value
+	movl	16(%rsp), %edx	# 15831	[c=9 l=4]  *movsi_internal/0
+	movl	%eax, %esi	# 11522	[c=4 l=2]  *movsi_internal/0
+	jmp	.L1292	# 18549	[c=1 l=5]  jump
+.L571:
+	movswl	1028(%rbx), %ecx	# 564	[c=13 l=7]  extendhisi2/1
+	xorl	%esi, %esi	# 18019	[c=4 l=2]  *movdi_xor
+	movq	%rbx, %rdi	# 570	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 18020	[c=4 l=2]  *movdi_xor
+	leaq	.LC49(%rip), %rdx	# 567	[c=1 l=7]  *movdi_internal/4
+	movl	%ecx, 76(%rbx)	# 565	[c=4 l=3]  *movsi_internal/1
+	call	leave	# 572	[c=0 l=5]  *call
+.L569:
+	leaq	.LC50(%rip), %rdx	# 576	[c=1 l=7]  *movdi_internal/4
+	movl	$1, %esi	# 578	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 579	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 18018	[c=4 l=2]  *movdi_xor
+	call	leave	# 581	[c=0 l=5]  *call
+.L572:
+	cmpl	$0, 264(%rbx)	# 552	[c=13 l=7]  *cmpsi_ccno_1/1
+	je	.L568	# 553	[c=13 l=6]  *jcc
+	movq	904(%rbx), %rsi	# 555	[c=9 l=7]  *movdi_internal/3
+	movsbl	1028(%rbx), %edi	# 556	[c=13 l=7]  extendqisi2
+	call	putc@PLT	# 559	[c=10 l=5]  *call_value
+	jmp	.L568	# 18551	[c=1 l=5]  jump
+.L573:
+	cmpl	$0, 248(%rbx)	# 524	[c=13 l=7]  *cmpsi_ccno_1/1
+	je	.L568	# 525	[c=13 l=6]  *jcc
+	movq	40(%rbx), %rax	# 14977	[c=9 l=4]  *movdi_internal/3
+	cmpl	$1, 96(%rbx)	# 529	[c=13 l=4]  *cmpsi_1/0
+	leaq	-1(%rax), %rdx	# 16272	[c=4 l=4]  *leadi
+	je	.L1949	# 530	[c=13 l=6]  *jcc
+.L579:
+	leaq	host_getchar(%rip), %rcx	# 540	[c=1 l=7]  *movdi_internal/4
+	xorl	%esi, %esi	# 18021	[c=4 l=2]  *movdi_xor
+	movq	%rbx, %rdi	# 544	[c=4 l=3]  *movdi_internal/3
+	call	replay_input@PLT	# 545	[c=10 l=5]  *call_value
+	movw	%ax, 1028(%rbx)	# 547	[c=4 l=7]  *movhi_internal/3
+	jmp	.L568	# 18554	[c=1 l=5]  jump
+.L574:
+	cmpl	$0, 504(%rbx)	# 486	[c=13 l=7]  *cmpsi_ccno_1/1
+	jne	.L578	# 487	[c=13 l=6]  *jcc
+	movl	$0, 1024(%rbx)	# 490	[c=4 l=10]  *movv4qi_internal/1
+	movw	$0, 1028(%rbx)	# 492	[c=4 l=9]  *movv2qi_internal/3
+	jmp	.L568	# 18556	[c=1 l=5]  jump
+.L1708:
+	movzbl	%al, %edx	# 5471	[c=4 l=3]  *zero_extendqisi2/0
+	movl	$62, %esi	# 5473	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 5474	[c=4 l=3]  *movdi_internal/3
+	call	data_write_mapped	# 5475	[c=0 l=5]  *call
+	jmp	.L927	# 18558	[c=1 l=5]  jump
+.L1707:
+	movzbl	%al, %edx	# 5447	[c=4 l=3]  *zero_extendqisi2/0
+	movl	$61, %esi	# 5449	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 5450	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, 16(%rsp)	# 15808	[c=4 l=4]  *movsi_internal/1
+	call	data_write_mapped	# 5451	[c=0 l=5]  *call
+	movl	16(%rsp), %eax	# 15809	[c=9 l=4]  *movsi_internal/0
+	jmp	.L925	# 18560	[c=1 l=5]  jump
+.L751:
+	cmpl	$4, %eax	# 3052	[c=4 l=3]  *cmpsi_1/0
+	jne	.L749	# 3053	[c=13 l=6]  *jcc
+	movl	%ebp, %ecx	# 3085	[c=1 l=2]  *zero_extendsidi2/3
+	movl	$255, %esi	# 3087	[c=4 l=5]  *movsi_internal/0
+	movq	%rcx, %rdx	# 3086	[c=4 l=3]  *movdi_internal/3
+	movq	%rcx, 16(%rsp)	# 15796	[c=4 l=5]  *movdi_internal/5
+	call	memset@PLT	# 3089	[c=10 l=5]  *call_value
+	movq	16(%rsp), %rcx	# 15797	[c=9 l=5]  *movdi_internal/3
+	movq	%rax, %rdi	# 15795	[c=4 l=3]  *movdi_internal/3
+.L750:
+	leaq	6052(%rbx), %r8	# 16204	[c=4 l=7]  *leadi
+	xorl	%eax, %eax	# 17914	[c=4 l=2]  *movdi_xor
+	jmp	.L755	# 18562	[c=1 l=2]  jump
+.L756:
+	movzbl	6052(%rbx,%rax), %edx	# 3093	[c=10 l=8]  *movqi_internal/4
+	andb	%dl, (%rdi,%rax)	# 3094	[c=13 l=3]  *andqi_1/0
+	addq	$1, %rax	# 3095	[c=4 l=4]  *adddi_1/0
+.L755:
+	cmpl	%ebp, %eax	# 3104	[c=4 l=2]  *cmpsi_1/0
+	jb	.L756	# 3105	[c=13 l=2]  *jcc
+	movq	%rcx, %rdx	# 3109	[c=4 l=3]  *movdi_internal/3
+	movl	$255, %esi	# 3110	[c=4 l=5]  *movsi_internal/0
+	movq	%r8, %rdi	# 3111	[c=4 l=3]  *movdi_internal/3
+	jmp	.L1548	# 18564	[c=1 l=5]  jump
+.L1106:
+	movzbl	%sil, %edx	# 7759	[c=4 l=4]  *zero_extendqisi2/0
+	movq	%rbx, %rdi	# 7762	[c=4 l=3]  *movdi_internal/3
+	movl	%ebp, %esi	# 7761	[c=4 l=2]  *movsi_internal/0
+	call	data_write_page	# 7763	[c=0 l=5]  *call
+	jmp	.L1107	# 18566	[c=1 l=5]  jump
+.L922:
+	movzbl	%r14b, %edx	# 5430	[c=4 l=4]  *zero_extendqisi2/0
+	movq	%rbx, %rdi	# 5433	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, 16(%rsp)	# 15806	[c=4 l=4]  *movsi_internal/1
+	call	data_write_page	# 5434	[c=0 l=5]  *call
+	movl	16(%rsp), %eax	# 15807	[c=9 l=4]  *movsi_internal/0
+	jmp	.L923	# 18568	[c=1 l=5]  jump
+.L1705:
+	movl	$61, %esi	# 5365	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 5366	[c=4 l=3]  *movdi_internal/3
+	movl	%ecx, 16(%rsp)	# 15802	[c=4 l=4]  *movsi_internal/1
+	call	data_read_mapped	# 5367	[c=10 l=5]  *call_value
+	movl	16(%rsp), %ecx	# 15803	[c=9 l=4]  *movsi_internal/0
+	movl	%eax, %edx	# 5368	[c=4 l=2]  *movsi_internal/0
+	cmpl	%r15d, %ecx	# 5369	[c=4 l=3]  *cmpsi_1/0
+	jnb	.L918	# 5370	[c=13 l=6]  *jcc
+	movq	1040(%rbx), %rax	# 13763	[c=9 l=7]  *movdi_internal/3
+	jmp	.L917	# 18570	[c=1 l=5]  jump
+.L904:
+	movq	104(%rbx), %rsi	# 5213	[c=9 l=4]  *movdi_internal/3
+	cltq	# 5216	[c=4 l=2]  *extendsidi2_rex64/0
+	orl	$30, %edx	# 16153	[c=4 l=3]  *iorsi_1/0
+	andb	(%rsi), %cl	# 5214	[c=9 l=2]  *andqi_1/1
+	leaq	flag_update_table_logical(%rip), %rsi	# 14838	[c=1 l=7]  *movdi_internal/4
+	orb	(%rsi,%rax), %cl	# 5219	[c=13 l=3]  *iorqi_1/1
+	leaq	101(%rbx), %rax	# 16154	[c=4 l=4]  *leadi
+	movb	%cl, 101(%rbx)	# 5220	[c=4 l=3]  *movqi_internal/8
+	jmp	.L905	# 18572	[c=1 l=5]  jump
+.L900:
+	movq	104(%rbx), %rsi	# 5150	[c=9 l=4]  *movdi_internal/3
+	movzbl	%al, %eax	# 5154	[c=4 l=3]  zero_extendqidi2/0
+	orl	$30, %edx	# 16155	[c=4 l=3]  *iorsi_1/0
+	andb	(%rsi), %cl	# 5151	[c=9 l=2]  *andqi_1/1
+	leaq	flag_update_table_logical(%rip), %rsi	# 14837	[c=1 l=7]  *movdi_internal/4
+	orb	(%rsi,%rax), %cl	# 5157	[c=13 l=3]  *iorqi_1/1
+	leaq	101(%rbx), %rax	# 16156	[c=4 l=4]  *leadi
+	movb	%cl, 101(%rbx)	# 5158	[c=4 l=3]  *movqi_internal/8
+	jmp	.L901	# 18574	[c=1 l=5]  jump
+.L736:
+	movq	104(%rbx), %rsi	# 2903	[c=9 l=4]  *movdi_internal/3
+	movzbl	%al, %eax	# 2907	[c=4 l=3]  zero_extendqidi2/0
+	orl	$30, %edx	# 16207	[c=4 l=3]  *iorsi_1/0
+	andb	(%rsi), %cl	# 2904	[c=9 l=2]  *andqi_1/1
+	leaq	flag_update_table_logical(%rip), %rsi	# 14832	[c=1 l=7]  *movdi_internal/4
+	orb	(%rsi,%rax), %cl	# 2910	[c=13 l=3]  *iorqi_1/1
+	leaq	101(%rbx), %rax	# 16208	[c=4 l=4]  *leadi
+	movb	%cl, 101(%rbx)	# 2911	[c=4 l=3]  *movqi_internal/8
+	jmp	.L737	# 18576	[c=1 l=5]  jump
+.L999:
+	cltq	# 6311	[c=4 l=2]  *extendsidi2_rex64/0
+	leaq	flag_update_table_ror8(%rip), %rsi	# 14839	[c=1 l=7]  *movdi_internal/4
+	andb	(%rdi), %dl	# 6309	[c=9 l=2]  *andqi_1/1
+	orl	$31, %ecx	# 16136	[c=4 l=3]  *iorsi_1/0
+	orb	(%rsi,%rax), %dl	# 6314	[c=13 l=3]  *iorqi_1/1
+	leaq	101(%rbx), %rax	# 16137	[c=4 l=4]  *leadi
+	movb	%dl, 101(%rbx)	# 6315	[c=4 l=3]  *movqi_internal/8
+	jmp	.L1000	# 18578	[c=1 l=5]  jump
+.L951:
+	movq	1040(%rbx), %rax	# 5767	[c=9 l=7]  *movdi_internal/3
+	movl	$62, %ecx	# 5769	[c=4 l=5]  *movsi_internal/0
+	subl	%r15d, %ecx	# 5770	[c=4 l=3]  *subsi_1/0
+	movzbl	61(%rax), %ebp	# 5768	[c=13 l=4]  *zero_extendqisi2/0
+	cmpl	%edx, %ecx	# 5771	[c=4 l=2]  *cmpsi_1/0
+	jb	.L953	# 5772	[c=13 l=6]  *jcc
+	cmpb	$1, 1081(%rbx)	# 5776	[c=13 l=7]  *cmpqi_1/0
+	jbe	.L953	# 5777	[c=13 l=6]  *jcc
+	jmp	.L954	# 18581	[c=1 l=5]  jump
+.L1250:
+	movq	104(%rbx), %rsi	# 10732	[c=9 l=4]  *movdi_internal/3
+	orl	$63, %ecx	# 15990	[c=4 l=3]  *iorsi_1/0
+	movzbl	(%rsi), %edi	# 17621	[c=5 l=3]  *movqi_internal/4
+	andl	%edx, %edi	# 18856	[c=4 l=2]  *andsi_1/0
+	leaq	flag_update_table_sub8(%rip), %rdx	# 10734	[c=1 l=7]  *movdi_internal/4
+	movl	%edi, %esi	# 15579	[c=4 l=2]  *movqi_internal/1
+	orb	(%rdx,%rax), %sil	# 10738	[c=13 l=4]  *iorqi_1/1
+	leaq	101(%rbx), %rax	# 15991	[c=4 l=4]  *leadi
+	movb	%sil, 101(%rbx)	# 10739	[c=4 l=4]  *movqi_internal/8
+	jmp	.L1251	# 18583	[c=1 l=5]  jump
+.L1246:
+	movq	104(%rbx), %rsi	# 10660	[c=9 l=4]  *movdi_internal/3
+	orl	$30, %edx	# 15992	[c=4 l=3]  *iorsi_1/0
+	andb	(%rsi), %cl	# 10661	[c=9 l=2]  *andqi_1/1
+	leaq	flag_update_table_dec(%rip), %rsi	# 14865	[c=1 l=7]  *movdi_internal/4
+	orb	(%rsi,%rax), %cl	# 10666	[c=13 l=3]  *iorqi_1/1
+	leaq	101(%rbx), %rax	# 15993	[c=4 l=4]  *leadi
+	movb	%cl, 101(%rbx)	# 10667	[c=4 l=3]  *movqi_internal/8
+	jmp	.L1247	# 18585	[c=1 l=5]  jump
+.L1205:
+	movq	104(%rbx), %rcx	# 9575	[c=9 l=4]  *movdi_internal/3
+	orl	$63, %esi	# 16058	[c=4 l=3]  *iorsi_1/0
+	movzbl	(%rcx), %edi	# 17663	[c=5 l=3]  *movqi_internal/4
+	andl	%edx, %edi	# 18855	[c=4 l=2]  *andsi_1/0
+	leaq	flag_update_table_sub8(%rip), %rdx	# 9577	[c=1 l=7]  *movdi_internal/4
+	movl	%edi, %ecx	# 15480	[c=4 l=2]  *movqi_internal/1
+	orb	(%rdx,%rax), %cl	# 9581	[c=13 l=3]  *iorqi_1/1
+	leaq	101(%rbx), %rax	# 16059	[c=4 l=4]  *leadi
+	movb	%cl, 101(%rbx)	# 9582	[c=4 l=3]  *movqi_internal/8
+	jmp	.L1206	# 18587	[c=1 l=5]  jump
+.L1198:
+	movq	104(%rbx), %rcx	# 9409	[c=9 l=4]  *movdi_internal/3
+	orl	$63, %esi	# 16066	[c=4 l=3]  *iorsi_1/0
+	movzbl	(%rcx), %edi	# 17669	[c=5 l=3]  *movqi_internal/4
+	andl	%edx, %edi	# 18854	[c=4 l=2]  *andsi_1/0
+	leaq	flag_update_table_sub8(%rip), %rdx	# 9411	[c=1 l=7]  *movdi_internal/4
+	movl	%edi, %ecx	# 15466	[c=4 l=2]  *movqi_internal/1
+	orb	(%rdx,%rax), %cl	# 9415	[c=13 l=3]  *iorqi_1/1
+	leaq	101(%rbx), %rax	# 16067	[c=4 l=4]  *leadi
+	movb	%cl, 101(%rbx)	# 9416	[c=4 l=3]  *movqi_internal/8
+	jmp	.L1199	# 18589	[c=1 l=5]  jump
+.L1193:
+	movq	104(%rbx), %rsi	# 9321	[c=9 l=4]  *movdi_internal/3
+	orl	$30, %edx	# 16068	[c=4 l=3]  *iorsi_1/0
+	andb	(%rsi), %cl	# 9322	[c=9 l=2]  *andqi_1/1
+	leaq	flag_update_table_logical(%rip), %rsi	# 14858	[c=1 l=7]  *movdi_internal/4
+	orb	(%rsi,%rax), %cl	# 9328	[c=13 l=3]  *iorqi_1/1
+	leaq	101(%rbx), %rax	# 16069	[c=4 l=4]  *leadi
+	movb	%cl, 101(%rbx)	# 9329	[c=4 l=3]  *movqi_internal/8
+	jmp	.L1194	# 18591	[c=1 l=5]  jump
+.L1189:
+	movq	104(%rbx), %rsi	# 9264	[c=9 l=4]  *movdi_internal/3
+	orl	$30, %edx	# 16070	[c=4 l=3]  *iorsi_1/0
+	andb	(%rsi), %cl	# 9265	[c=9 l=2]  *andqi_1/1
+	leaq	flag_update_table_logical(%rip), %rsi	# 14857	[c=1 l=7]  *movdi_internal/4
+	orb	(%rsi,%rax), %cl	# 9271	[c=13 l=3]  *iorqi_1/1
+	leaq	101(%rbx), %rax	# 16071	[c=4 l=4]  *leadi
+	movb	%cl, 101(%rbx)	# 9272	[c=4 l=3]  *movqi_internal/8
+	jmp	.L1247	# 18593	[c=1 l=5]  jump
+.L1363:
+	movq	104(%rbx), %rdi	# 12480	[c=9 l=4]  *movdi_internal/3
+	orl	$63, %esi	# 15943	[c=4 l=3]  *iorsi_1/0
+	andb	(%rdi), %dl	# 12481	[c=9 l=2]  *andqi_1/1
+	movl	%edx, %edi	# 15687	[c=4 l=2]  *movqi_internal/1
+	leaq	flag_update_table_sub8(%rip), %rdx	# 12482	[c=1 l=7]  *movdi_internal/4
+	orb	(%rdx,%rax), %dil	# 12486	[c=13 l=4]  *iorqi_1/1
+	leaq	101(%rbx), %rax	# 15944	[c=4 l=4]  *leadi
+	movb	%dil, 101(%rbx)	# 12487	[c=4 l=4]  *movqi_internal/8
+	jmp	.L1364	# 18595	[c=1 l=5]  jump
+.L1424:
+	movq	1040(%rbx), %rax	# 13399	[c=9 l=7]  *movdi_internal/3
+	movl	$62, %esi	# 13401	[c=4 l=5]  *movsi_internal/0
+	subl	%edx, %esi	# 13402	[c=4 l=2]  *subsi_1/0
+	movzbl	61(%rax), %r14d	# 13400	[c=13 l=5]  *zero_extendqisi2/0
+	cmpl	%r15d, %esi	# 13403	[c=4 l=3]  *cmpsi_1/0
+	jb	.L1426	# 13404	[c=13 l=6]  *jcc
+	cmpb	$1, 1081(%rbx)	# 13408	[c=13 l=7]  *cmpqi_1/0
+	jbe	.L1426	# 13409	[c=13 l=6]  *jcc
+	jmp	.L1427	# 18598	[c=1 l=5]  jump
+.L1217:
+	movq	104(%rbx), %rcx	# 9873	[c=9 l=4]  *movdi_internal/3
+	orl	$63, %esi	# 16042	[c=4 l=3]  *iorsi_1/0
+	movzbl	(%rcx), %edi	# 17653	[c=5 l=3]  *movqi_internal/4
+	andl	%edx, %edi	# 18853	[c=4 l=2]  *andsi_1/0
+	leaq	flag_update_table_sub8(%rip), %rdx	# 9875	[c=1 l=7]  *movdi_internal/4
+	movl	%edi, %ecx	# 15508	[c=4 l=2]  *movqi_internal/1
+	orb	(%rdx,%rax), %cl	# 9879	[c=13 l=3]  *iorqi_1/1
+	leaq	101(%rbx), %rax	# 16043	[c=4 l=4]  *leadi
+	movb	%cl, 101(%rbx)	# 9880	[c=4 l=3]  *movqi_internal/8
+	jmp	.L1218	# 18600	[c=1 l=5]  jump
+.L804:
+	movq	104(%rbx), %rsi	# 3783	[c=9 l=4]  *movdi_internal/3
+	orl	$30, %edx	# 16179	[c=4 l=3]  *iorsi_1/0
+	andb	(%rsi), %cl	# 3784	[c=9 l=2]  *andqi_1/1
+	leaq	flag_update_table_inc(%rip), %rsi	# 14834	[c=1 l=7]  *movdi_internal/4
+	orb	(%rsi,%rax), %cl	# 3789	[c=13 l=3]  *iorqi_1/1
+	leaq	101(%rbx), %rax	# 16180	[c=4 l=4]  *leadi
+	movb	%cl, 101(%rbx)	# 3790	[c=4 l=3]  *movqi_internal/8
+	jmp	.L805	# 18602	[c=1 l=5]  jump
+.L591:
+	movq	104(%rbx), %rsi	# 791	[c=9 l=4]  *movdi_internal/3
+	orl	$63, %edx	# 16266	[c=4 l=3]  *iorsi_1/0
+	andb	(%rsi), %cl	# 792	[c=9 l=2]  *andqi_1/1
+	leaq	flag_update_table_add8(%rip), %rsi	# 14821	[c=1 l=7]  *movdi_internal/4
+	orb	(%rsi,%rax), %cl	# 797	[c=13 l=3]  *iorqi_1/1
+	leaq	101(%rbx), %rax	# 16267	[c=4 l=4]  *leadi
+	movb	%cl, 101(%rbx)	# 798	[c=4 l=3]  *movqi_internal/8
+	jmp	.L592	# 18604	[c=1 l=5]  jump
+.L772:
+	movq	1040(%rbx), %rax	# 3423	[c=9 l=7]  *movdi_internal/3
+	movl	$62, %ecx	# 3425	[c=4 l=5]  *movsi_internal/0
+	subl	%r14d, %ecx	# 3426	[c=4 l=3]  *subsi_1/0
+	movzbl	61(%rax), %edx	# 3424	[c=13 l=4]  *zero_extendqisi2/0
+	cmpl	%r15d, %ecx	# 3427	[c=4 l=3]  *cmpsi_1/0
+	jb	.L774	# 3428	[c=13 l=6]  *jcc
+	cmpb	$1, 1081(%rbx)	# 3432	[c=13 l=7]  *cmpqi_1/0
+	jbe	.L774	# 3433	[c=13 l=6]  *jcc
+	jmp	.L775	# 18607	[c=1 l=5]  jump
+.L1288:
+	movq	1040(%rbx), %rax	# 11508	[c=9 l=7]  *movdi_internal/3
+	movzbl	61(%rax), %edx	# 11509	[c=13 l=4]  *zero_extendqisi2/0
+	cmpl	%r15d, %ecx	# 11510	[c=4 l=3]  *cmpsi_1/0
+	jb	.L1290	# 11511	[c=13 l=6]  *jcc
+	cmpb	$1, 1081(%rbx)	# 11515	[c=13 l=7]  *cmpqi_1/0
+	jbe	.L1290	# 11516	[c=13 l=6]  *jcc
+	jmp	.L1291	# 18610	[c=1 l=5]  jump
+.L1278:
+	andb	(%rdx), %r9b	# 11337	[c=9 l=3]  *andqi_1/1
+	orb	(%rcx,%r8), %r9b	# 11342	[c=13 l=4]  *iorqi_1/1
+	leaq	101(%rbx), %rcx	# 15966	[c=4 l=4]  *leadi
+	orl	$63, %eax	# 15965	[c=4 l=3]  *iorsi_1/0
+	movb	%r9b, 101(%rbx)	# 11343	[c=4 l=4]  *movqi_internal/8
+	jmp	.L1279	# 18612	[c=1 l=5]  jump
+.L1274:
+	andb	(%rdx), %r9b	# 11249	[c=9 l=3]  *andqi_1/1
+	orb	(%rcx,%r8), %r9b	# 11254	[c=13 l=4]  *iorqi_1/1
+	leaq	101(%rbx), %rdx	# 15970	[c=4 l=4]  *leadi
+	orl	$63, %eax	# 15969	[c=4 l=3]  *iorsi_1/0
+	movb	%r9b, 101(%rbx)	# 11255	[c=4 l=4]  *movqi_internal/8
+	jmp	.L1275	# 18614	[c=1 l=5]  jump
+.L1270:
+	movq	104(%rbx), %rsi	# 11157	[c=9 l=4]  *movdi_internal/3
+	orl	$63, %eax	# 15972	[c=4 l=3]  *iorsi_1/0
+	movzbl	(%rsi), %edi	# 17602	[c=5 l=3]  *movqi_internal/4
+	andl	%ecx, %edi	# 18852	[c=4 l=2]  *andsi_1/0
+	leaq	flag_update_table_add8(%rip), %rcx	# 11159	[c=1 l=7]  *movdi_internal/4
+	movl	%edi, %esi	# 15620	[c=4 l=2]  *movqi_internal/1
+	orb	(%rcx,%rdx), %sil	# 11163	[c=13 l=4]  *iorqi_1/1
+	leaq	101(%rbx), %rdx	# 15973	[c=4 l=4]  *leadi
+	movb	%sil, 101(%rbx)	# 11164	[c=4 l=4]  *movqi_internal/8
+	jmp	.L1271	# 18616	[c=1 l=5]  jump
+.L1265:
+	andb	(%rax), %r8b	# 11071	[c=9 l=3]  *andqi_1/1
+	orb	(%rcx,%rdi), %r8b	# 11076	[c=13 l=4]  *iorqi_1/1
+	leaq	101(%rbx), %rax	# 15976	[c=4 l=4]  *leadi
+	orl	$63, %edx	# 15975	[c=4 l=3]  *iorsi_1/0
+	movb	%r8b, 101(%rbx)	# 11077	[c=4 l=4]  *movqi_internal/8
+	jmp	.L1266	# 18618	[c=1 l=5]  jump
+.L1261:
+	movq	104(%rbx), %rsi	# 10979	[c=9 l=4]  *movdi_internal/3
+	orl	$63, %edx	# 15978	[c=4 l=3]  *iorsi_1/0
+	movzbl	(%rsi), %edi	# 17610	[c=5 l=3]  *movqi_internal/4
+	andl	%ecx, %edi	# 18851	[c=4 l=2]  *andsi_1/0
+	leaq	flag_update_table_add8(%rip), %rcx	# 10981	[c=1 l=7]  *movdi_internal/4
+	movl	%edi, %esi	# 15604	[c=4 l=2]  *movqi_internal/1
+	orb	(%rcx,%rax), %sil	# 10985	[c=13 l=4]  *iorqi_1/1
+	leaq	101(%rbx), %rax	# 15979	[c=4 l=4]  *leadi
+	movb	%sil, 101(%rbx)	# 10986	[c=4 l=4]  *movqi_internal/8
+	jmp	.L1262	# 18620	[c=1 l=5]  jump
+.L1256:
+	movq	104(%rbx), %rsi	# 10890	[c=9 l=4]  *movdi_internal/3
+	orl	$63, %edx	# 15981	[c=4 l=3]  *iorsi_1/0
+	andb	(%rsi), %cl	# 10891	[c=9 l=2]  *andqi_1/1
+	leaq	flag_update_table_add8(%rip), %rsi	# 14866	[c=1 l=7]  *movdi_internal/4
+	orb	(%rsi,%rax), %cl	# 10896	[c=13 l=3]  *iorqi_1/1
+	leaq	101(%rbx), %rax	# 15982	[c=4 l=4]  *leadi
+	movb	%cl, 101(%rbx)	# 10897	[c=4 l=3]  *movqi_internal/8
+	jmp	.L1257	# 18622	[c=1 l=5]  jump
+.L973:
+	movq	1040(%rbx), %rax	# 5996	[c=9 l=7]  *movdi_internal/3
+	movl	$62, %ecx	# 5998	[c=4 l=5]  *movsi_internal/0
+	subl	%r15d, %ecx	# 5999	[c=4 l=3]  *subsi_1/0
+	movzbl	61(%rax), %ebp	# 5997	[c=13 l=4]  *zero_extendqisi2/0
+	cmpl	%edx, %ecx	# 6000	[c=4 l=2]  *cmpsi_1/0
+	jb	.L975	# 6001	[c=13 l=6]  *jcc
+	cmpb	$1, 1081(%rbx)	# 6005	[c=13 l=7]  *cmpqi_1/0
+	jbe	.L975	# 6006	[c=13 l=6]  *jcc
+	jmp	.L976	# 18625	[c=1 l=5]  jump
+.L894:
+	movq	104(%rbx), %rsi	# 5059	[c=9 l=4]  *movdi_internal/3
+	orl	$63, %edx	# 16157	[c=4 l=3]  *iorsi_1/0
+	andb	(%rsi), %cl	# 5060	[c=9 l=2]  *andqi_1/1
+	leaq	flag_update_table_sub8(%rip), %rsi	# 14836	[c=1 l=7]  *movdi_internal/4
+	orb	(%rsi,%rax), %cl	# 5065	[c=13 l=3]  *iorqi_1/1
+	leaq	101(%rbx), %rax	# 16158	[c=4 l=4]  *leadi
+	movb	%cl, 101(%rbx)	# 5066	[c=4 l=3]  *movqi_internal/8
+	jmp	.L895	# 18627	[c=1 l=5]  jump
+.L1211:
+	movq	104(%rbx), %rcx	# 9724	[c=9 l=4]  *movdi_internal/3
+	orl	$63, %esi	# 16050	[c=4 l=3]  *iorsi_1/0
+	movzbl	(%rcx), %edi	# 17658	[c=5 l=3]  *movqi_internal/4
+	andl	%edx, %edi	# 18850	[c=4 l=2]  *andsi_1/0
+	leaq	flag_update_table_sub8(%rip), %rdx	# 9726	[c=1 l=7]  *movdi_internal/4
+	movl	%edi, %ecx	# 15494	[c=4 l=2]  *movqi_internal/1
+	orb	(%rdx,%rax), %cl	# 9730	[c=13 l=3]  *iorqi_1/1
+	leaq	101(%rbx), %rax	# 16051	[c=4 l=4]  *leadi
+	movb	%cl, 101(%rbx)	# 9731	[c=4 l=3]  *movqi_internal/8
+	jmp	.L1212	# 18629	[c=1 l=5]  jump
+.L1232:
+	movq	104(%rbx), %rsi	# 10266	[c=9 l=4]  *movdi_internal/3
+	orl	$63, %edx	# 16020	[c=4 l=3]  *iorsi_1/0
+	andb	(%rsi), %cl	# 10267	[c=9 l=2]  *andqi_1/1
+	leaq	flag_update_table_sub8(%rip), %rsi	# 14859	[c=1 l=7]  *movdi_internal/4
+	orb	(%rsi,%rax), %cl	# 10272	[c=13 l=3]  *iorqi_1/1
+	leaq	101(%rbx), %rax	# 16021	[c=4 l=4]  *leadi
+	movb	%cl, 101(%rbx)	# 10273	[c=4 l=3]  *movqi_internal/8
+	jmp	.L1233	# 18631	[c=1 l=5]  jump
+.L1224:
+	movq	104(%rbx), %rsi	# 10039	[c=9 l=4]  *movdi_internal/3
+	orl	$63, %eax	# 16033	[c=4 l=3]  *iorsi_1/0
+	movzbl	(%rsi), %edi	# 17647	[c=5 l=3]  *movqi_internal/4
+	andl	%edx, %edi	# 18849	[c=4 l=2]  *andsi_1/0
+	leaq	flag_update_table_sub8(%rip), %rdx	# 10041	[c=1 l=7]  *movdi_internal/4
+	movl	%edi, %esi	# 15524	[c=4 l=2]  *movqi_internal/1
+	orb	(%rdx,%rcx), %sil	# 10045	[c=13 l=4]  *iorqi_1/1
+	leaq	101(%rbx), %rdi	# 16034	[c=4 l=4]  *leadi
+	movb	%sil, 101(%rbx)	# 10046	[c=4 l=4]  *movqi_internal/8
+	jmp	.L1225	# 18633	[c=1 l=5]  jump
+.L875:
+	movq	104(%rbx), %rax	# 4678	[c=9 l=4]  *movdi_internal/3
+	movslq	%esi, %rsi	# 4681	[c=4 l=3]  *extendsidi2_rex64/1
+	orl	$31, %edx	# 16173	[c=4 l=3]  *iorsi_1/0
+	andb	(%rax), %cl	# 4679	[c=9 l=2]  *andqi_1/1
+	leaq	flag_update_table_ror8(%rip), %rax	# 14835	[c=1 l=7]  *movdi_internal/4
+	orb	(%rax,%rsi), %cl	# 4684	[c=13 l=3]  *iorqi_1/1
+	leaq	101(%rbx), %rax	# 16174	[c=4 l=4]  *leadi
+	movb	%cl, 101(%rbx)	# 4685	[c=4 l=3]  *movqi_internal/8
+	jmp	.L876	# 18635	[c=1 l=5]  jump
+.L1378:
+	movq	10960(%rbx), %rax	# 12731	[c=9 l=7]  *movdi_internal/3
+	movl	%r14d, %edx	# 12729	[c=1 l=3]  *zero_extendsidi2/3
+	movl	%r15d, %esi	# 12734	[c=4 l=3]  *movsi_internal/0
+	movq	%rbx, %rdi	# 12735	[c=4 l=3]  *movdi_internal/3
+	movq	%rdx, 16(%rsp)	# 15836	[c=4 l=5]  *movdi_internal/5
+	movq	8(%rax), %rax	# 12732	[c=9 l=4]  *movdi_internal/3
+	leaq	(%rax,%rdx,8), %r14	# 12733	[c=8 l=4]  *leadi
+	call	jit_compile@PLT	# 12736	[c=10 l=5]  *call_value
+	movq	16(%rsp), %rdx	# 15837	[c=9 l=5]  *movdi_internal/3
+	leaq	.L532(%rip), %r10	# 65	[c=1 l=7]  *movdi_internal/4
+	movq	%rax, (%r14)	# 12738	[c=4 l=3]  *movdi_internal/5
+	movq	10960(%rbx), %rax	# 12739	[c=9 l=7]  *movdi_internal/3
+	movq	8(%rax), %rax	# 12740	[c=9 l=4]  *movdi_internal/3
+	cmpq	$0, (%rax,%rdx,8)	# 12741	[c=14 l=5]  *cmpdi_ccno_1/1
+	je	.L1950	# 12742	[c=13 l=6]  *jcc
+.L1379:
+	movq	%rdx, %rax	# 15708	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rax	# 12751	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %rax	# 12752	[c=13 l=7]  *adddi_1/1
+	movq	%r10, (%rax)	# 12753	[c=4 l=3]  *movdi_internal/5
+	jmp	*%r10	# 17011	[c=4 l=3]  *indirect_jump
+.L1125:
+	movq	104(%rbx), %rsi	# 8041	[c=9 l=4]  *movdi_internal/3
+	orl	$63, %edx	# 16108	[c=4 l=3]  *iorsi_1/0
+	andb	(%rsi), %cl	# 8042	[c=9 l=2]  *andqi_1/1
+	leaq	flag_update_table_sub8(%rip), %rsi	# 14843	[c=1 l=7]  *movdi_internal/4
+	orb	(%rsi,%rax), %cl	# 8047	[c=13 l=3]  *iorqi_1/1
+	leaq	101(%rbx), %rax	# 16109	[c=4 l=4]  *leadi
+	movb	%cl, 101(%rbx)	# 8048	[c=4 l=3]  *movqi_internal/8
+	jmp	.L1126	# 18638	[c=1 l=5]  jump
+.L598:
+	movq	104(%rbx), %rsi	# 978	[c=9 l=4]  *movdi_internal/3
+	movzbl	%al, %eax	# 982	[c=4 l=3]  zero_extendqidi2/0
+	orl	$30, %edx	# 16252	[c=4 l=3]  *iorsi_1/0
+	andb	(%rsi), %cl	# 979	[c=9 l=2]  *andqi_1/1
+	leaq	flag_update_table_logical(%rip), %rsi	# 14824	[c=1 l=7]  *movdi_internal/4
+	orb	(%rsi,%rax), %cl	# 985	[c=13 l=3]  *iorqi_1/1
+	leaq	101(%rbx), %rax	# 16253	[c=4 l=4]  *leadi
+	movb	%cl, 101(%rbx)	# 986	[c=4 l=3]  *movqi_internal/8
+	jmp	.L599	# 18640	[c=1 l=5]  jump
+.L1143:
+	movq	104(%rbx), %rsi	# 8339	[c=9 l=4]  *movdi_internal/3
+	orl	$30, %edx	# 16099	[c=4 l=3]  *iorsi_1/0
+	andb	(%rsi), %cl	# 8340	[c=9 l=2]  *andqi_1/1
+	leaq	flag_update_table_logical(%rip), %rsi	# 14846	[c=1 l=7]  *movdi_internal/4
+	orb	(%rsi,%rax), %cl	# 8346	[c=13 l=3]  *iorqi_1/1
+	leaq	101(%rbx), %rax	# 16100	[c=4 l=4]  *leadi
+	movb	%cl, 101(%rbx)	# 8347	[c=4 l=3]  *movqi_internal/8
+	jmp	.L1144	# 18642	[c=1 l=5]  jump
+.L1139:
+	leaq	flag_update_table_add8(%rip), %rdx	# 14845	[c=1 l=7]  *movdi_internal/4
+	andb	(%rdi), %cl	# 8282	[c=9 l=2]  *andqi_1/1
+	orl	$63, %esi	# 16101	[c=4 l=3]  *iorsi_1/0
+	orb	(%rdx,%rax), %cl	# 8287	[c=13 l=3]  *iorqi_1/1
+	leaq	101(%rbx), %rax	# 16102	[c=4 l=4]  *leadi
+	movb	%cl, 101(%rbx)	# 8288	[c=4 l=3]  *movqi_internal/8
+	jmp	.L1140	# 18644	[c=1 l=5]  jump
+.L1135:
+	movq	104(%rbx), %rsi	# 8205	[c=9 l=4]  *movdi_internal/3
+	orl	$63, %edx	# 16103	[c=4 l=3]  *iorsi_1/0
+	andb	(%rsi), %cl	# 8206	[c=9 l=2]  *andqi_1/1
+	leaq	flag_update_table_add8(%rip), %rsi	# 14844	[c=1 l=7]  *movdi_internal/4
+	orb	(%rsi,%rax), %cl	# 8211	[c=13 l=3]  *iorqi_1/1
+	leaq	101(%rbx), %rax	# 16104	[c=4 l=4]  *leadi
+	movb	%cl, 101(%rbx)	# 8212	[c=4 l=3]  *movqi_internal/8
+	jmp	.L1136	# 18646	[c=1 l=5]  jump
+.L929:
+	movq	1040(%rbx), %rax	# 5524	[c=9 l=7]  *movdi_internal/3
+	movl	$62, %esi	# 5526	[c=4 l=5]  *movsi_internal/0
+	subl	%r15d, %esi	# 5527	[c=4 l=3]  *subsi_1/0
+	movzbl	61(%rax), %ecx	# 5525	[c=13 l=4]  *zero_extendqisi2/0
+	cmpl	%edx, %esi	# 5528	[c=4 l=2]  *cmpsi_1/0
+	jb	.L931	# 5529	[c=13 l=6]  *jcc
+	cmpb	$1, 1081(%rbx)	# 5533	[c=13 l=7]  *cmpqi_1/0
+	jbe	.L931	# 5534	[c=13 l=6]  *jcc
+	jmp	.L932	# 18649	[c=1 l=5]  jump
+.L660:
+	movq	104(%rbx), %rsi	# 1875	[c=9 l=4]  *movdi_internal/3
+	orl	$63, %edx	# 16227	[c=4 l=3]  *iorsi_1/0
+	andb	(%rsi), %cl	# 1876	[c=9 l=2]  *andqi_1/1
+	leaq	flag_update_table_sub8(%rip), %rsi	# 14828	[c=1 l=7]  *movdi_internal/4
+	orb	(%rsi,%rax), %cl	# 1881	[c=13 l=3]  *iorqi_1/1
+	leaq	101(%rbx), %rax	# 16228	[c=4 l=4]  *leadi
+	movb	%cl, 101(%rbx)	# 1882	[c=4 l=3]  *movqi_internal/8
+	jmp	.L661	# 18651	[c=1 l=5]  jump
+.L624:
+	movq	1040(%rbx), %rax	# 1466	[c=9 l=7]  *movdi_internal/3
+	movl	$62, %esi	# 1468	[c=4 l=5]  *movsi_internal/0
+	subl	%edx, %esi	# 1469	[c=4 l=2]  *subsi_1/0
+	movzbl	61(%rax), %r8d	# 1467	[c=13 l=5]  *zero_extendqisi2/0
+	cmpl	%ecx, %esi	# 1470	[c=4 l=2]  *cmpsi_1/0
+	jb	.L626	# 1471	[c=13 l=6]  *jcc
+	cmpb	$1, 1081(%rbx)	# 1475	[c=13 l=7]  *cmpqi_1/0
+	jbe	.L626	# 1476	[c=13 l=6]  *jcc
+	jmp	.L627	# 18654	[c=1 l=5]  jump
+.L667:
+	movq	104(%rbx), %rsi	# 2036	[c=9 l=4]  *movdi_internal/3
+	orl	$63, %edx	# 16220	[c=4 l=3]  *iorsi_1/0
+	andb	(%rsi), %cl	# 2037	[c=9 l=2]  *andqi_1/1
+	leaq	flag_update_table_sub8(%rip), %rsi	# 14830	[c=1 l=7]  *movdi_internal/4
+	orb	(%rsi,%rax), %cl	# 2042	[c=13 l=3]  *iorqi_1/1
+	leaq	101(%rbx), %rax	# 16221	[c=4 l=4]  *leadi
+	movb	%cl, 101(%rbx)	# 2043	[c=4 l=3]  *movqi_internal/8
+	jmp	.L668	# 18656	[c=1 l=5]  jump
+.L681:
+	movq	104(%rbx), %rsi	# 2260	[c=9 l=4]  *movdi_internal/3
+	orl	$30, %edx	# 16214	[c=4 l=3]  *iorsi_1/0
+	andb	(%rsi), %cl	# 2261	[c=9 l=2]  *andqi_1/1
+	leaq	flag_update_table_dec(%rip), %rsi	# 14831	[c=1 l=7]  *movdi_internal/4
+	orb	(%rsi,%rax), %cl	# 2266	[c=13 l=3]  *iorqi_1/1
+	leaq	101(%rbx), %rax	# 16215	[c=4 l=4]  *leadi
+	movb	%cl, 101(%rbx)	# 2267	[c=4 l=3]  *movqi_internal/8
+	jmp	.L682	# 18658	[c=1 l=5]  jump
+.L686:
+	movq	1040(%rbx), %rax	# 2353	[c=9 l=7]  *movdi_internal/3
+	movzbl	61(%rax), %edx	# 2354	[c=13 l=4]  *zero_extendqisi2/0
+	cmpl	%r15d, %ebp	# 2355	[c=4 l=3]  *cmpsi_1/0
+	jb	.L688	# 2356	[c=13 l=6]  *jcc
+	cmpb	$1, 1081(%rbx)	# 2360	[c=13 l=7]  *cmpqi_1/0
+	jbe	.L688	# 2361	[c=13 l=6]  *jcc
+	jmp	.L689	# 18661	[c=1 l=5]  jump
+.L606:
+	movq	104(%rbx), %rsi	# 1103	[c=9 l=4]  *movdi_internal/3
+	cltq	# 1106	[c=4 l=2]  *extendsidi2_rex64/0
+	orl	$31, %edx	# 16248	[c=4 l=3]  *iorsi_1/0
+	andb	(%rsi), %cl	# 1104	[c=9 l=2]  *andqi_1/1
+	leaq	flag_update_table_ror8(%rip), %rsi	# 14826	[c=1 l=7]  *movdi_internal/4
+	orb	(%rsi,%rax), %cl	# 1109	[c=13 l=3]  *iorqi_1/1
+	leaq	101(%rbx), %rax	# 16249	[c=4 l=4]  *leadi
+	movb	%cl, 101(%rbx)	# 1110	[c=4 l=3]  *movqi_internal/8
+	jmp	.L607	# 18663	[c=1 l=5]  jump
+.L602:
+	movq	104(%rbx), %rsi	# 1041	[c=9 l=4]  *movdi_internal/3
+	cltq	# 1044	[c=4 l=2]  *extendsidi2_rex64/0
+	orl	$30, %edx	# 16250	[c=4 l=3]  *iorsi_1/0
+	andb	(%rsi), %cl	# 1042	[c=9 l=2]  *andqi_1/1
+	leaq	flag_update_table_logical(%rip), %rsi	# 14825	[c=1 l=7]  *movdi_internal/4
+	orb	(%rsi,%rax), %cl	# 1047	[c=13 l=3]  *iorqi_1/1
+	leaq	101(%rbx), %rax	# 16251	[c=4 l=4]  *leadi
+	movb	%cl, 101(%rbx)	# 1048	[c=4 l=3]  *movqi_internal/8
+	jmp	.L603	# 18665	[c=1 l=5]  jump
+.L1121:
+	movq	104(%rbx), %rsi	# 7967	[c=9 l=4]  *movdi_internal/3
+	orl	$63, %edx	# 16110	[c=4 l=3]  *iorsi_1/0
+	andb	(%rsi), %cl	# 7968	[c=9 l=2]  *andqi_1/1
+	leaq	flag_update_table_sub8(%rip), %rsi	# 14842	[c=1 l=7]  *movdi_internal/4
+	orb	(%rsi,%rax), %cl	# 7973	[c=13 l=3]  *iorqi_1/1
+	leaq	101(%rbx), %rax	# 16111	[c=4 l=4]  *leadi
+	movb	%cl, 101(%rbx)	# 7974	[c=4 l=3]  *movqi_internal/8
+	jmp	.L1122	# 18667	[c=1 l=5]  jump
+.L1834:
+	xorl	%eax, %eax	# 17795	[c=4 l=2]  *movsi_xor
+	movq	%rbx, %rdi	# 5947	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, 96(%rbx)	# 17796	[c=4 l=3]  *movsi_internal/1
+	call	do_events	# 5948	[c=0 l=5]  *call
+	jmp	.L971	# 18669	[c=1 l=5]  jump
+.L1911:
+	xorl	%r8d, %r8d	# 17927	[c=4 l=3]  *movsi_xor
+	movq	%rbx, %rdi	# 2658	[c=4 l=3]  *movdi_internal/3
+	movl	%r8d, 96(%rbx)	# 17928	[c=4 l=4]  *movsi_internal/1
+	call	do_events	# 2659	[c=0 l=5]  *call
+	jmp	.L717	# 18671	[c=1 l=5]  jump
+.L1732:
+	xorl	%edi, %edi	# 17738	[c=4 l=2]  *movsi_xor
+	movl	%edi, 96(%rbx)	# 17739	[c=4 l=3]  *movsi_internal/1
+	movq	%rbx, %rdi	# 7197	[c=4 l=3]  *movdi_internal/3
+	call	do_events	# 7198	[c=0 l=5]  *call
+	jmp	.L1059	# 18673	[c=1 l=5]  jump
+.L1839:
+	xorl	%eax, %eax	# 17789	[c=4 l=2]  *movsi_xor
+	movq	%rbx, %rdi	# 6188	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, 96(%rbx)	# 17790	[c=4 l=3]  *movsi_internal/1
+	call	do_events	# 6189	[c=0 l=5]  *call
+	jmp	.L993	# 18675	[c=1 l=5]  jump
+.L1880:
+	xorl	%eax, %eax	# 17978	[c=4 l=2]  *movsi_xor
+	movq	%rbx, %rdi	# 1219	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, 96(%rbx)	# 17979	[c=4 l=3]  *movsi_internal/1
+	call	do_events	# 1220	[c=0 l=5]  *call
+	jmp	.L613	# 18677	[c=1 l=5]  jump
+.L1735:
+	xorl	%r9d, %r9d	# 17746	[c=4 l=3]  *movsi_xor
+	movq	%rbx, %rdi	# 7050	[c=4 l=3]  *movdi_internal/3
+	movl	%r9d, 96(%rbx)	# 17747	[c=4 l=4]  *movsi_internal/1
+	call	do_events	# 7051	[c=0 l=5]  *call
+	jmp	.L1050	# 18679	[c=1 l=5]  jump
+.L1900:
+	xorl	%r10d, %r10d	# 17938	[c=4 l=3]  *movsi_xor
+	movq	%rbx, %rdi	# 2200	[c=4 l=3]  *movdi_internal/3
+	movl	%r10d, 96(%rbx)	# 17939	[c=4 l=4]  *movsi_internal/1
+	call	do_events	# 2201	[c=0 l=5]  *call
+	jmp	.L678	# 18681	[c=1 l=5]  jump
+.L1896:
+	xorl	%r11d, %r11d	# 17943	[c=4 l=3]  *movsi_xor
+	movq	%rbx, %rdi	# 2120	[c=4 l=3]  *movdi_internal/3
+	movl	%r11d, 96(%rbx)	# 17944	[c=4 l=4]  *movsi_internal/1
+	call	do_events	# 2121	[c=0 l=5]  *call
+	jmp	.L673	# 18683	[c=1 l=5]  jump
+.L1738:
+	xorl	%r8d, %r8d	# 17742	[c=4 l=3]  *movsi_xor
+	movq	%rbx, %rdi	# 7115	[c=4 l=3]  *movdi_internal/3
+	movl	%r8d, 96(%rbx)	# 17743	[c=4 l=4]  *movsi_internal/1
+	call	do_events	# 7116	[c=0 l=5]  *call
+	jmp	.L1054	# 18685	[c=1 l=5]  jump
+.L1787:
+	xorl	%esi, %esi	# 17558	[c=4 l=2]  *movsi_xor
+	movq	%rbx, %rdi	# 12806	[c=4 l=3]  *movdi_internal/3
+	movl	%esi, 96(%rbx)	# 17559	[c=4 l=3]  *movsi_internal/1
+	call	do_events	# 12807	[c=0 l=5]  *call
+	jmp	.L1382	# 18687	[c=1 l=5]  jump
+.L1805:
+	xorl	%edi, %edi	# 17912	[c=4 l=2]  *movsi_xor
+	movl	%edi, 96(%rbx)	# 17913	[c=4 l=3]  *movsi_internal/1
+	movq	%rbx, %rdi	# 3158	[c=4 l=3]  *movdi_internal/3
+	call	do_events	# 3159	[c=0 l=5]  *call
+	jmp	.L760	# 18689	[c=1 l=5]  jump
+.L1841:
+	xorl	%eax, %eax	# 17784	[c=4 l=2]  *movsi_xor
+	movq	%rbx, %rdi	# 6241	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, 96(%rbx)	# 17785	[c=4 l=3]  *movsi_internal/1
+	call	do_events	# 6242	[c=0 l=5]  *call
+	jmp	.L996	# 18691	[c=1 l=5]  jump
+.L1887:
+	xorl	%ebp, %ebp	# 17962	[c=4 l=2]  *movsi_xor
+	movq	%rbx, %rdi	# 1665	[c=4 l=3]  *movdi_internal/3
+	movl	%ebp, 96(%rbx)	# 17963	[c=4 l=3]  *movsi_internal/1
+	call	do_events	# 1666	[c=0 l=5]  *call
+	jmp	.L645	# 18693	[c=1 l=5]  jump
+.L1819:
+	xorl	%ecx, %ecx	# 17882	[c=4 l=2]  *movsi_xor
+	movq	%rbx, %rdi	# 3665	[c=4 l=3]  *movdi_internal/3
+	movl	%ecx, 96(%rbx)	# 17883	[c=4 l=3]  *movsi_internal/1
+	call	do_events	# 3666	[c=0 l=5]  *call
+	jmp	.L796	# 18695	[c=1 l=5]  jump
+.L1756:
+	xorl	%r10d, %r10d	# 17750	[c=4 l=3]  *movsi_xor
+	movq	%rbx, %rdi	# 6985	[c=4 l=3]  *movdi_internal/3
+	movl	%r10d, 96(%rbx)	# 17751	[c=4 l=4]  *movsi_internal/1
+	call	do_events	# 6986	[c=0 l=5]  *call
+	jmp	.L1046	# 18697	[c=1 l=5]  jump
+.L1753:
+	xorl	%r11d, %r11d	# 17754	[c=4 l=3]  *movsi_xor
+	movq	%rbx, %rdi	# 6920	[c=4 l=3]  *movdi_internal/3
+	movl	%r11d, 96(%rbx)	# 17755	[c=4 l=4]  *movsi_internal/1
+	call	do_events	# 6921	[c=0 l=5]  *call
+	jmp	.L1042	# 18699	[c=1 l=5]  jump
+.L1750:
+	xorl	%ebp, %ebp	# 17758	[c=4 l=2]  *movsi_xor
+	movq	%rbx, %rdi	# 6855	[c=4 l=3]  *movdi_internal/3
+	movl	%ebp, 96(%rbx)	# 17759	[c=4 l=3]  *movsi_internal/1
+	call	do_events	# 6856	[c=0 l=5]  *call
+	jmp	.L1038	# 18701	[c=1 l=5]  jump
+.L1908:
+	xorl	%r9d, %r9d	# 17931	[c=4 l=3]  *movsi_xor
+	movq	%rbx, %rdi	# 2569	[c=4 l=3]  *movdi_internal/3
+	movl	%r9d, 96(%rbx)	# 17932	[c=4 l=4]  *movsi_internal/1
+	call	do_events	# 2570	[c=0 l=5]  *call
+	jmp	.L710	# 18703	[c=1 l=5]  jump
+.L1827:
+	xorl	%edx, %edx	# 17875	[c=4 l=2]  *movsi_xor
+	movq	%rbx, %rdi	# 3834	[c=4 l=3]  *movdi_internal/3
+	movl	%edx, 96(%rbx)	# 17876	[c=4 l=3]  *movsi_internal/1
+	call	do_events	# 3835	[c=0 l=5]  *call
+	jmp	.L808	# 18705	[c=1 l=5]  jump
+.L1817:
+	xorl	%esi, %esi	# 17885	[c=4 l=2]  *movsi_xor
+	movq	%rbx, %rdi	# 3621	[c=4 l=3]  *movdi_internal/3
+	movl	%esi, 96(%rbx)	# 17886	[c=4 l=3]  *movsi_internal/1
+	call	do_events	# 3622	[c=0 l=5]  *call
+	jmp	.L793	# 18707	[c=1 l=5]  jump
+.L1744:
+	xorl	%eax, %eax	# 17799	[c=4 l=2]  *movsi_xor
+	movq	%rbx, %rdi	# 5718	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, 96(%rbx)	# 17800	[c=4 l=3]  *movsi_internal/1
+	call	do_events	# 5719	[c=0 l=5]  *call
+	jmp	.L949	# 18709	[c=1 l=5]  jump
+.L1746:
+	xorl	%r15d, %r15d	# 17764	[c=4 l=3]  *movsi_xor
+	movq	%rbx, %rdi	# 6709	[c=4 l=3]  *movdi_internal/3
+	movl	%r15d, 96(%rbx)	# 17765	[c=4 l=4]  *movsi_internal/1
+	call	do_events	# 6710	[c=0 l=5]  *call
+	jmp	.L1026	# 18711	[c=1 l=5]  jump
+.L1845:
+	xorl	%eax, %eax	# 17767	[c=4 l=2]  *movsi_xor
+	movq	%rbx, %rdi	# 6636	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, 96(%rbx)	# 17768	[c=4 l=3]  *movsi_internal/1
+	call	do_events	# 6637	[c=0 l=5]  *call
+	jmp	.L1020	# 18713	[c=1 l=5]  jump
+.L1748:
+	xorl	%r14d, %r14d	# 17761	[c=4 l=3]  *movsi_xor
+	movq	%rbx, %rdi	# 6782	[c=4 l=3]  *movdi_internal/3
+	movl	%r14d, 96(%rbx)	# 17762	[c=4 l=4]  *movsi_internal/1
+	call	do_events	# 6783	[c=0 l=5]  *call
+	jmp	.L1032	# 18715	[c=1 l=5]  jump
+.L1702:
+	movzbl	%al, %edx	# 11579	[c=4 l=3]  *zero_extendqisi2/0
+	movl	$61, %esi	# 11581	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 11582	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, 16(%rsp)	# 15834	[c=4 l=4]  *movsi_internal/1
+	call	data_write_mapped	# 11583	[c=0 l=5]  *call
+	movl	16(%rsp), %eax	# 15835	[c=9 l=4]  *movsi_internal/0
+	jmp	.L1298	# 18717	[c=1 l=5]  jump
+.L1703:
+	movzbl	%al, %edx	# 11603	[c=4 l=3]  *zero_extendqisi2/0
+	movl	$62, %esi	# 11605	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 11606	[c=4 l=3]  *movdi_internal/3
+	call	data_write_mapped	# 11607	[c=0 l=5]  *call
+	jmp	.L1300	# 18719	[c=1 l=5]  jump
+.L1742:
+	movzbl	%r15b, %edx	# 5662	[c=4 l=4]  *zero_extendqisi2/0
+	movl	$61, %esi	# 5664	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 5665	[c=4 l=3]  *movdi_internal/3
+	call	data_write_mapped	# 5666	[c=0 l=5]  *call
+	jmp	.L946	# 18721	[c=1 l=5]  jump
+.L1743:
+	movzbl	%al, %edx	# 5686	[c=4 l=3]  *zero_extendqisi2/0
+	movl	$62, %esi	# 5688	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 5689	[c=4 l=3]  *movdi_internal/3
+	call	data_write_mapped	# 5690	[c=0 l=5]  *call
+	jmp	.L948	# 18723	[c=1 l=5]  jump
+.L1814:
+	movzbl	%r14b, %edx	# 3561	[c=4 l=4]  *zero_extendqisi2/0
+	movl	$61, %esi	# 3563	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 3564	[c=4 l=3]  *movdi_internal/3
+	call	data_write_mapped	# 3565	[c=0 l=5]  *call
+	jmp	.L789	# 18725	[c=1 l=5]  jump
+.L1815:
+	movzbl	%r14b, %edx	# 3585	[c=4 l=4]  *zero_extendqisi2/0
+	movl	$62, %esi	# 3587	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 3588	[c=4 l=3]  *movdi_internal/3
+	call	data_write_mapped	# 3589	[c=0 l=5]  *call
+	jmp	.L791	# 18727	[c=1 l=5]  jump
+.L1832:
+	movzbl	%bpl, %edx	# 5897	[c=4 l=4]  *zero_extendqisi2/0
+	movl	$61, %esi	# 5899	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 5900	[c=4 l=3]  *movdi_internal/3
+	call	data_write_mapped	# 5901	[c=0 l=5]  *call
+	jmp	.L968	# 18729	[c=1 l=5]  jump
+.L1833:
+	movzbl	%al, %edx	# 5921	[c=4 l=3]  *zero_extendqisi2/0
+	movl	$62, %esi	# 5923	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 5924	[c=4 l=3]  *movdi_internal/3
+	call	data_write_mapped	# 5925	[c=0 l=5]  *call
+	jmp	.L970	# 18731	[c=1 l=5]  jump
+.L1884:
+	movzbl	%al, %edx	# 1604	[c=4 l=3]  *zero_extendqisi2/0
+	movl	$61, %esi	# 1606	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 1607	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, 16(%rsp)	# 15781	[c=4 l=4]  *movsi_internal/1
+	call	data_write_mapped	# 1608	[c=0 l=5]  *call
+	movl	16(%rsp), %eax	# 15782	[c=9 l=4]  *movsi_internal/0
+	jmp	.L641	# 18733	[c=1 l=5]  jump
+.L1837:
+	movzbl	%bpl, %edx	# 6126	[c=4 l=4]  *zero_extendqisi2/0
+	movl	$61, %esi	# 6128	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 6129	[c=4 l=3]  *movdi_internal/3
+	call	data_write_mapped	# 6130	[c=0 l=5]  *call
+	jmp	.L990	# 18735	[c=1 l=5]  jump
+.L1838:
+	movzbl	%al, %edx	# 6150	[c=4 l=3]  *zero_extendqisi2/0
+	movl	$62, %esi	# 6152	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 6153	[c=4 l=3]  *movdi_internal/3
+	call	data_write_mapped	# 6154	[c=0 l=5]  *call
+	jmp	.L992	# 18737	[c=1 l=5]  jump
+.L1885:
+	movzbl	%al, %edx	# 1628	[c=4 l=3]  *zero_extendqisi2/0
+	movl	$62, %esi	# 1630	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 1631	[c=4 l=3]  *movdi_internal/3
+	call	data_write_mapped	# 1632	[c=0 l=5]  *call
+	jmp	.L643	# 18739	[c=1 l=5]  jump
+.L1905:
+	movzbl	%r14b, %edx	# 2489	[c=4 l=4]  *zero_extendqisi2/0
+	movl	$61, %esi	# 2491	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 2492	[c=4 l=3]  *movdi_internal/3
+	call	data_write_mapped	# 2493	[c=0 l=5]  *call
+	jmp	.L703	# 18741	[c=1 l=5]  jump
+.L1906:
+	movzbl	%r14b, %edx	# 2513	[c=4 l=4]  *zero_extendqisi2/0
+	movl	$62, %esi	# 2515	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 2516	[c=4 l=3]  *movdi_internal/3
+	call	data_write_mapped	# 2517	[c=0 l=5]  *call
+	jmp	.L705	# 18743	[c=1 l=5]  jump
+.L1853:
+	leaq	.LC43(%rip), %rdx	# 351	[c=1 l=7]  *movdi_internal/4
+	movl	$1, %esi	# 353	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 354	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 18029	[c=4 l=2]  *movdi_xor
+	call	leave	# 356	[c=0 l=5]  *call
+.L563:
+	movl	$1, 72(%rbx)	# 372	[c=4 l=7]  *movsi_internal/1
+	leaq	.LC45(%rip), %rdx	# 374	[c=1 l=7]  *movdi_internal/4
+	movq	%rbx, %rdi	# 377	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 18027	[c=4 l=2]  *movdi_xor
+	movl	$8, %esi	# 376	[c=4 l=5]  *movsi_internal/0
+	call	leave	# 379	[c=0 l=5]  *call
+.L562:
+	movq	832(%rbx), %r8	# 361	[c=9 l=7]  *movdi_internal/3
+	leaq	.LC44(%rip), %rdx	# 363	[c=1 l=7]  *movdi_internal/4
+	movq	%rbx, %rdi	# 366	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 18028	[c=4 l=2]  *movdi_xor
+	movl	$1, %esi	# 365	[c=4 l=5]  *movsi_internal/0
+	call	leave	# 368	[c=0 l=5]  *call
+.L693:
+	movl	%ecx, %edx	# 2412	[c=4 l=2]  *movsi_internal/0
+	movl	%ebp, %esi	# 2413	[c=4 l=2]  *movsi_internal/0
+	movq	%rbx, %rdi	# 2414	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, 16(%rsp)	# 15785	[c=4 l=4]  *movsi_internal/1
+	call	data_write_page	# 2415	[c=0 l=5]  *call
+	movl	16(%rsp), %eax	# 15786	[c=9 l=4]  *movsi_internal/0
+	jmp	.L694	# 18745	[c=1 l=5]  jump
+.L696:
+	movl	%eax, %esi	# 2440	[c=4 l=2]  *movsi_internal/0
+	movq	%rbx, %rdi	# 2441	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 2442	[c=0 l=5]  *call
+	jmp	.L697	# 18747	[c=1 l=5]  jump
+.L707:
+	movl	$60, %esi	# 2542	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 2543	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 2544	[c=10 l=5]  *call_value
+	movl	%eax, %esi	# 2545	[c=4 l=2]  *movsi_internal/0
+	jmp	.L708	# 18749	[c=1 l=5]  jump
+.L631:
+	movl	%esi, %edx	# 1527	[c=4 l=2]  *movsi_internal/0
+	movq	%rbx, %rdi	# 1529	[c=4 l=3]  *movdi_internal/3
+	movl	%r15d, %esi	# 1528	[c=4 l=3]  *movsi_internal/0
+	movl	%r8d, 16(%rsp)	# 15777	[c=4 l=5]  *movsi_internal/1
+	call	data_write_page	# 1530	[c=0 l=5]  *call
+	movl	16(%rsp), %r8d	# 15778	[c=9 l=5]  *movsi_internal/0
+	jmp	.L632	# 18751	[c=1 l=5]  jump
+.L634:
+	movl	%r8d, %esi	# 1555	[c=4 l=3]  *movsi_internal/0
+	movq	%rbx, %rdi	# 1556	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, 16(%rsp)	# 15779	[c=4 l=4]  *movsi_internal/1
+	call	data_write_page	# 1557	[c=0 l=5]  *call
+	movl	16(%rsp), %eax	# 15780	[c=9 l=4]  *movsi_internal/0
+	jmp	.L635	# 18753	[c=1 l=5]  jump
+.L782:
+	movl	%eax, %esi	# 3512	[c=4 l=2]  *movsi_internal/0
+	movq	%rbx, %rdi	# 3513	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 3514	[c=0 l=5]  *call
+	jmp	.L783	# 18755	[c=1 l=5]  jump
+.L986:
+	movl	%ebp, %esi	# 6100	[c=4 l=2]  *movsi_internal/0
+	movq	%rbx, %rdi	# 6101	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 6102	[c=10 l=5]  *call_value
+	movl	%eax, %r14d	# 6103	[c=4 l=3]  *movsi_internal/0
+	jmp	.L987	# 18757	[c=1 l=5]  jump
+.L983:
+	movq	%rbx, %rdi	# 6074	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 6075	[c=10 l=5]  *call_value
+	jmp	.L984	# 18759	[c=1 l=5]  jump
+.L961:
+	movq	%rbx, %rdi	# 5845	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 5846	[c=10 l=5]  *call_value
+	jmp	.L962	# 18761	[c=1 l=5]  jump
+.L964:
+	movl	%ebp, %esi	# 5871	[c=4 l=2]  *movsi_internal/0
+	movq	%rbx, %rdi	# 5872	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 5873	[c=10 l=5]  *call_value
+	movl	%eax, %r14d	# 5874	[c=4 l=3]  *movsi_internal/0
+	jmp	.L965	# 18763	[c=1 l=5]  jump
+.L1295:
+	movzbl	%r14b, %edx	# 11562	[c=4 l=4]  *zero_extendqisi2/0
+	movq	%rbx, %rdi	# 11565	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, 16(%rsp)	# 15832	[c=4 l=4]  *movsi_internal/1
+	call	data_write_page	# 11566	[c=0 l=5]  *call
+	movl	16(%rsp), %eax	# 15833	[c=9 l=4]  *movsi_internal/0
+	jmp	.L1296	# 18765	[c=1 l=5]  jump
+.L779:
+	movl	%ecx, %edx	# 3484	[c=4 l=2]  *movsi_internal/0
+	movl	%ebp, %esi	# 3485	[c=4 l=2]  *movsi_internal/0
+	movq	%rbx, %rdi	# 3486	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, 16(%rsp)	# 15800	[c=4 l=4]  *movsi_internal/1
+	call	data_write_page	# 3487	[c=0 l=5]  *call
+	movl	16(%rsp), %eax	# 15801	[c=9 l=4]  *movsi_internal/0
+	jmp	.L780	# 18767	[c=1 l=5]  jump
+.L936:
+	movl	%esi, %edx	# 5585	[c=4 l=2]  *movsi_internal/0
+	movq	%rbx, %rdi	# 5587	[c=4 l=3]  *movdi_internal/3
+	movl	%r14d, %esi	# 5586	[c=4 l=3]  *movsi_internal/0
+	movl	%eax, 16(%rsp)	# 15816	[c=4 l=4]  *movsi_internal/1
+	call	data_write_page	# 5588	[c=0 l=5]  *call
+	movl	16(%rsp), %eax	# 15817	[c=9 l=4]  *movsi_internal/0
+	jmp	.L937	# 18769	[c=1 l=5]  jump
+.L939:
+	movl	%eax, %esi	# 5613	[c=4 l=2]  *movsi_internal/0
+	movq	%rbx, %rdi	# 5614	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 5615	[c=0 l=5]  *call
+	jmp	.L940	# 18771	[c=1 l=5]  jump
+.L1789:
+	movl	8(%rcx), %eax	# 13429	[c=10 l=3]  *zero_extendsidi2/3
+	movq	(%rcx), %r14	# 13436	[c=5 l=3]  *movdi_internal/3
+	leaq	.LC38(%rip), %r8	# 70	[c=1 l=7]  *movdi_internal/4
+	movq	1040(%rbx), %rdx	# 13444	[c=9 l=7]  *movdi_internal/3
+	movq	32(%rcx), %r15	# 13438	[c=9 l=4]  *movdi_internal/3
+	salq	$4, %rax	# 13431	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %rax	# 13432	[c=13 l=7]  *adddi_1/1
+	movq	%r10, (%rax)	# 13433	[c=4 l=3]  *movdi_internal/5
+	movzbl	11(%rbp), %eax	# 13434	[c=9 l=4]  *movqi_internal/4
+	movb	%al, 16(%rsp)	# 15753	[c=4 l=4]  *movqi_internal/8
+	movzwl	14(%rbp), %eax	# 13435	[c=9 l=4]  *movhi_internal/2
+	movw	%ax, 24(%rsp)	# 15754	[c=4 l=5]  *movhi_internal/3
+	movq	40(%rbx), %rax	# 13437	[c=9 l=4]  *movdi_internal/3
+	movq	%rax, 32(%rsp)	# 15755	[c=4 l=5]  *movdi_internal/5
+	movq	48(%rbx), %rax	# 13439	[c=9 l=4]  *movdi_internal/3
+	movq	%rax, 40(%rsp)	# 15756	[c=4 l=5]  *movdi_internal/5
+	movq	40(%rcx), %rax	# 13440	[c=9 l=4]  *movdi_internal/3
+	movq	%rax, 48(%rsp)	# 15757	[c=4 l=5]  *movdi_internal/5
+	xorl	%eax, %eax	# 17543	[c=4 l=2]  *movdi_xor
+	movq	%rax, (%rcx)	# 17544	[c=4 l=3]  *movdi_internal/5
+	movq	96(%rcx), %rax	# 13443	[c=9 l=4]  *movdi_internal/3
+	addl	$1, 112(%r14)	# 13442	[c=13 l=5]  *addsi_1/0
+	movzbl	63(%rdx), %edx	# 13445	[c=9 l=4]  *movqi_internal/4
+	movb	%dl, 63(%rax)	# 13446	[c=4 l=3]  *movqi_internal/8
+	movq	1040(%rbx), %r9	# 13447	[c=9 l=7]  *movdi_internal/3
+	movzbl	100(%rbx), %esi	# 13448	[c=13 l=4]  *zero_extendqisi2/0
+	movzbl	63(%r9), %edx	# 13449	[c=13 l=5]  *zero_extendqisi2/0
+	movl	%esi, %eax	# 16785	[c=4 l=2]  *movsi_internal/0
+	notl	%esi	# 13451	[c=4 l=2]  *one_cmplsi2_1/0
+	andl	%esi, %edx	# 13452	[c=4 l=2]  *andsi_1/0
+	movq	104(%rbx), %rsi	# 13453	[c=9 l=4]  *movdi_internal/3
+	andb	(%rsi), %al	# 13454	[c=9 l=2]  *andqi_1/1
+	movzbl	%al, %eax	# 13455	[c=4 l=3]  *zero_extendqisi2/0
+	orl	%edx, %eax	# 13456	[c=4 l=2]  *iorsi_1/0
+	movzbl	72(%rcx), %edx	# 13457	[c=13 l=4]  *zero_extendqisi2/0
+	cmpl	%edx, %eax	# 13458	[c=4 l=2]  *cmpsi_1/0
+	je	.L1951	# 13459	[c=13 l=6]  *jcc
+.L1429:
+	cmpl	$0, 600(%rbx)	# 13538	[c=13 l=7]  *cmpsi_ccno_1/1
+	movb	$1, 48(%r14)	# 13536	[c=4 l=5]  *movqi_internal/8
+	je	.L559	# 13539	[c=13 l=6]  *jcc
+	movq	(%r14), %rdx	# 13541	[c=5 l=3]  *movdi_internal/3
+	movl	36(%r14), %ecx	# 13542	[c=9 l=4]  *movsi_internal/0
+	leaq	.LC56(%rip), %rsi	# 13549	[c=1 l=7]  *movdi_internal/4
+	xorl	%eax, %eax	# 17540	[c=4 l=2]  *movdi_xor
+	movq	904(%rbx), %rdi	# 13544	[c=9 l=7]  *movdi_internal/3
+	movq	%r10, 16(%rsp)	# 15893	[c=4 l=5]  *movdi_internal/5
+	addl	%ecx, %ecx	# 13543	[c=4 l=2]  *ashlsi3_1/0
+	movq	%rdx, %r9	# 13545	[c=4 l=3]  *movdi_internal/3
+	call	fprintf@PLT	# 13553	[c=10 l=5]  *call_value
+	jmp	*16(%rsp)	# 17541	[c=9 l=4]  *indirect_jump
+.L958:
+	movl	%ebp, %esi	# 5816	[c=4 l=2]  *movsi_internal/0
+	movq	%rbx, %rdi	# 5817	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 5818	[c=10 l=5]  *call_value
+	movl	%eax, %r14d	# 5819	[c=4 l=3]  *movsi_internal/0
+	jmp	.L959	# 18774	[c=1 l=5]  jump
+.L700:
+	movl	%r14d, %esi	# 2471	[c=4 l=3]  *movsi_internal/0
+	movq	%rbx, %rdi	# 2472	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 2473	[c=0 l=5]  *call
+	jmp	.L701	# 18776	[c=1 l=5]  jump
+.L1385:
+	movl	5176(%rbx), %edx	# 13160	[c=9 l=6]  *movsi_internal/0
+	movl	$61, %eax	# 13164	[c=4 l=5]  *movsi_internal/0
+	movl	$62, %ecx	# 13162	[c=4 l=5]  *movsi_internal/0
+	movl	5180(%rbx), %r8d	# 13161	[c=9 l=7]  *movsi_internal/0
+	subl	%edx, %eax	# 13165	[c=4 l=2]  *subsi_1/0
+	subl	%edx, %ecx	# 13163	[c=4 l=2]  *subsi_1/0
+	cmpl	%r8d, %eax	# 13166	[c=4 l=3]  *cmpsi_1/0
+	jb	.L1409	# 13167	[c=13 l=6]  *jcc
+	cmpb	$1, 1081(%rbx)	# 13171	[c=13 l=7]  *cmpqi_1/0
+	ja	.L1952	# 13172	[c=13 l=6]  *jcc
+	movq	1040(%rbx), %rax	# 13614	[c=9 l=7]  *movdi_internal/3
+	movzbl	61(%rax), %r9d	# 13615	[c=13 l=5]  *zero_extendqisi2/0
+.L1411:
+	movzbl	62(%rax), %eax	# 13205	[c=13 l=4]  *zero_extendqisi2/0
+.L1413:
+	sall	$8, %eax	# 13208	[c=4 l=3]  *ashlsi3_1/0
+	movl	152(%rsp), %r11d	# 13212	[c=9 l=8]  *movsi_internal/0
+	orl	%eax, %r9d	# 13209	[c=4 l=3]  *iorsi_1/0
+	movzbl	840(%rbx), %eax	# 13210	[c=13 l=7]  *zero_extendqisi2/0
+	addl	$2, %eax	# 13211	[c=4 l=3]  *addsi_1/0
+	movl	%eax, 16(%rsp)	# 15738	[c=4 l=4]  *movsi_internal/1
+	cmpl	$-1, %r11d	# 13213	[c=4 l=4]  *cmpsi_1/0
+	je	.L1953	# 13214	[c=13 l=6]  *jcc
+.L1414:
+	cmpq	$0, 10976(%rbx)	# 13236	[c=13 l=8]  *cmpdi_ccno_1/1
+	je	.L1954	# 13237	[c=13 l=6]  *jcc
+.L1417:
+	movq	10976(%rbx), %r8	# 13297	[c=9 l=7]  *movdi_internal/3
+	movl	1000(%rbx), %eax	# 13299	[c=9 l=6]  *movsi_internal/0
+	movl	%r9d, 48(%rsp)	# 15863	[c=4 l=5]  *movsi_internal/1
+	movq	1040(%rbx), %rsi	# 13302	[c=9 l=7]  *movdi_internal/3
+	movl	%r11d, 40(%rsp)	# 15861	[c=4 l=5]  *movsi_internal/1
+	movq	96(%r8), %rdi	# 13298	[c=9 l=4]  *movdi_internal/3
+	leal	1(%rax), %edx	# 13301	[c=5 l=3]  *leadi
+	movq	%r8, 32(%rsp)	# 15859	[c=4 l=5]  *movdi_internal/5
+	call	memcpy@PLT	# 13309	[c=10 l=5]  *call_value
+	movq	32(%rsp), %r8	# 15860	[c=9 l=5]  *movdi_internal/3
+	movq	24(%rsp), %rsi	# 15744	[c=9 l=5]  *movdi_internal/3
+	movl	$12, %ecx	# 13319	[c=4 l=5]  *movdi_internal/2
+	movdqu	1004(%rbx), %xmm2	# 13314	[c=13 l=8]  movv1ti_internal/2
+	leaq	48(%r8), %rdx	# 15915	[c=4 l=4]  *leadi
+	leaq	104(%r8), %rax	# 15914	[c=4 l=4]  *leadi
+	movq	%r8, 24(%rsp)	# 15857	[c=4 l=5]  *movdi_internal/5
+	movups	%xmm2, 104(%r8)	# 15741	[c=4 l=5]  movv1ti_internal/3
+	movdqu	16(%r15), %xmm3	# 13316	[c=13 l=6]  movv1ti_internal/2
+	movq	%rdx, %rdi	# 15743	[c=4 l=3]  *movdi_internal/3
+	movups	%xmm3, 120(%r8)	# 15742	[c=4 l=5]  movv1ti_internal/3
+	cmpq	1040(%rbx), %r15	# 13909	[c=13 l=7]  *cmpdi_1/1
+	rep movsl	# 13320	[c=0 l=2]  *rep_movsi
+	movq	96(%r8), %rcx	# 13321	[c=9 l=4]  *movdi_internal/3
+	movq	%rdx, %rdi	# 13331	[c=4 l=3]  *movdi_internal/3
+	cmove	%rcx, %rax	# 13910	[c=8 l=4]  *movdicc_noc/1
+	movq	%rcx, 64(%r8)	# 13322	[c=4 l=4]  *movdi_internal/5
+	movq	%rax, 56(%r8)	# 13328	[c=4 l=4]  *movdi_internal/5
+	call	*16(%r14)	# 13332	[c=0 l=4]  *call
+	movq	24(%rsp), %r8	# 15858	[c=9 l=5]  *movdi_internal/3
+	movl	40(%rsp), %r11d	# 15862	[c=9 l=5]  *movsi_internal/0
+	cmpl	$-1, 152(%rsp)	# 13333	[c=13 l=8]  *cmpsi_1/0
+	movl	48(%rsp), %r9d	# 15864	[c=9 l=5]  *movsi_internal/0
+	jne	.L1422	# 13334	[c=13 l=2]  *jcc
+	movl	16(%rsp), %eax	# 15745	[c=9 l=4]  *movsi_internal/0
+	addl	%eax, %r9d	# 13336	[c=4 l=3]  *addsi_1/0
+	movq	96(%r8), %rax	# 13337	[c=9 l=4]  *movdi_internal/3
+	movl	%r9d, %ecx	# 15747	[c=4 l=3]  *movsi_internal/0
+	movb	%r9b, 61(%rax)	# 13338	[c=4 l=4]  *movqi_internal/8
+	movq	96(%r8), %rax	# 13339	[c=9 l=4]  *movdi_internal/3
+	movb	%ch, 62(%rax)	# 17547	[c=4 l=3]  *extzvqi_mem_rex64
+.L1422:
+	movq	1064(%rbx), %rdx	# 13346	[c=9 l=7]  *movdi_internal/3
+	movl	%r11d, %eax	# 13347	[c=1 l=3]  *zero_extendsidi2/3
+	movq	%r14, (%r8)	# 13344	[c=4 l=3]  *movdi_internal/5
+	leaq	.L1423(%rip), %rdi	# 13364	[c=1 l=7]  *movdi_internal/4
+	salq	$4, %rax	# 13348	[c=4 l=4]  *ashldi3_1/0
+	movl	%r11d, 8(%r8)	# 13345	[c=4 l=4]  *movsi_internal/1
+	movdqu	40(%rbx), %xmm0	# 15750	[c=13 l=5]  movv2di_internal/2
+	movq	(%rdx,%rax), %rax	# 13350	[c=9 l=4]  *movdi_internal/3
+	movl	%r9d, 24(%r8)	# 13352	[c=4 l=4]  *movsi_internal/1
+	movq	%rax, 16(%r8)	# 13351	[c=4 l=4]  *movdi_internal/5
+	movzbl	11(%rbp), %eax	# 13354	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %xmm1	# 15748	[c=4 l=5]  *movdi_internal/20
+	movzwl	14(%rbp), %eax	# 13355	[c=13 l=4]  zero_extendhidi2/0
+	movq	%rax, %xmm4	# 15749	[c=4 l=5]  *movdi_internal/20
+	movq	10976(%rbx), %rax	# 13359	[c=9 l=7]  *movdi_internal/3
+	punpcklqdq	%xmm4, %xmm1	# 13356	[c=4 l=4]  vec_concatv2di/4
+	movl	8(%rax), %eax	# 13360	[c=10 l=3]  *zero_extendsidi2/3
+	psubq	%xmm1, %xmm0	# 13357	[c=4 l=4]  *subv2di3/0
+	movups	%xmm0, 32(%r8)	# 13358	[c=4 l=5]  movv2di_internal/3
+	salq	$4, %rax	# 13361	[c=4 l=4]  *ashldi3_1/0
+	movq	%rdi, (%rdx,%rax)	# 15752	[c=4 l=4]  *movdi_internal/5
+	jmp	*40(%r14)	# 17546	[c=9 l=4]  *indirect_jump
+.L943:
+	movl	%r15d, %esi	# 5644	[c=4 l=3]  *movsi_internal/0
+	movq	%rbx, %rdi	# 5645	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 5646	[c=0 l=5]  *call
+	jmp	.L944	# 18781	[c=1 l=5]  jump
+.L786:
+	movl	%r14d, %esi	# 3543	[c=4 l=3]  *movsi_internal/0
+	movq	%rbx, %rdi	# 3544	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 3545	[c=0 l=5]  *call
+	jmp	.L787	# 18783	[c=1 l=5]  jump
+.L980:
+	movl	%ebp, %esi	# 6045	[c=4 l=2]  *movsi_internal/0
+	movq	%rbx, %rdi	# 6046	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 6047	[c=10 l=5]  *call_value
+	movl	%eax, %r14d	# 6048	[c=4 l=3]  *movsi_internal/0
+	jmp	.L981	# 18785	[c=1 l=5]  jump
+.L638:
+	movl	%eax, %esi	# 1586	[c=4 l=2]  *movsi_internal/0
+	movq	%rbx, %rdi	# 1587	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 1588	[c=0 l=5]  *call
+	jmp	.L639	# 18787	[c=1 l=5]  jump
+.L741:
+	movl	$59, %esi	# 2953	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 2954	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 2955	[c=10 l=5]  *call_value
+	jmp	.L742	# 18789	[c=1 l=5]  jump
+.L759:
+	movl	%r15d, %edx	# 3143	[c=4 l=3]  *movsi_internal/0
+	movl	$59, %esi	# 3144	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 3145	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 3146	[c=0 l=5]  *call
+	jmp	.L757	# 18791	[c=1 l=5]  jump
+.L1950:
+	movzbl	8(%rbp), %eax	# 12746	[c=13 l=4]  zero_extendqidi2/0
+	leaq	handler.2(%rip), %r14	# 12744	[c=1 l=7]  *movdi_internal/4
+	movq	(%r14,%rax,8), %r10	# 12747	[c=10 l=4]  *movdi_internal/3
+	jmp	.L1379	# 18793	[c=1 l=5]  jump
+.L1951:
+	movq	56(%rcx), %rsi	# 13463	[c=9 l=4]  *movdi_internal/3
+	movl	$32, %edx	# 13465	[c=4 l=5]  *movdi_internal/2
+	movq	%r10, 64(%rsp)	# 15881	[c=4 l=5]  *movdi_internal/5
+	leaq	1004(%rbx), %rdi	# 15913	[c=4 l=7]  *leadi
+	movq	%r9, 72(%rsp)	# 15883	[c=4 l=5]  *movdi_internal/5
+	movq	%rcx, 56(%rsp)	# 15879	[c=4 l=5]  *movdi_internal/5
+	call	memcmp@PLT	# 13468	[c=10 l=5]  *call_value
+	movq	64(%rsp), %r10	# 15882	[c=9 l=5]  *movdi_internal/3
+	testl	%eax, %eax	# 13472	[c=4 l=2]  *cmpsi_ccno_1/0
+	jne	.L1444	# 13473	[c=13 l=6]  *jcc
+	movq	56(%rsp), %rcx	# 15880	[c=9 l=5]  *movdi_internal/3
+	movl	1000(%rbx), %eax	# 13479	[c=9 l=6]  *movsi_internal/0
+	movq	72(%rsp), %rdi	# 17542	[c=9 l=5]  *movdi_internal/3
+	movq	96(%rcx), %rsi	# 13482	[c=9 l=4]  *movdi_internal/3
+	leal	1(%rax), %edx	# 13481	[c=5 l=3]  *leadi
+	call	memcmp@PLT	# 13486	[c=10 l=5]  *call_value
+	movq	56(%rsp), %rcx	# 15876	[c=9 l=5]  *movdi_internal/3
+	movq	64(%rsp), %r10	# 15878	[c=9 l=5]  *movdi_internal/3
+	leaq	.LC40(%rip), %r8	# 72	[c=1 l=7]  *movdi_internal/4
+	testl	%eax, %eax	# 13490	[c=4 l=2]  *cmpsi_ccno_1/0
+	jne	.L1429	# 13491	[c=13 l=6]  *jcc
+	movl	32(%rsp), %edx	# 15758	[c=9 l=4]  *movsi_internal/0
+	movzbl	16(%rsp), %eax	# 13494	[c=13 l=5]  *zero_extendqisi2/0
+	leaq	48(%rcx), %rsi	# 15910	[c=4 l=4]  *leadi
+	movq	%r14, %rdi	# 13505	[c=4 l=3]  *movdi_internal/3
+	movl	40(%rsp), %r8d	# 15763	[c=9 l=5]  *movsi_internal/0
+	leaq	108(%rsp), %rcx	# 15911	[c=4 l=5]  *leadi
+	movq	%r10, 56(%rsp)	# 15889	[c=4 l=5]  *movdi_internal/5
+	subl	%r15d, %edx	# 13493	[c=4 l=3]  *subsi_1/0
+	movq	%rsi, 16(%rsp)	# 15885	[c=4 l=5]  *movdi_internal/5
+	subl	%eax, %edx	# 13495	[c=4 l=2]  *subsi_1/0
+	movl	48(%rsp), %eax	# 15765	[c=9 l=4]  *movsi_internal/0
+	movl	%edx, %r15d	# 15762	[c=4 l=3]  *movsi_internal/0
+	leaq	104(%rsp), %rdx	# 15912	[c=4 l=5]  *leadi
+	subl	%eax, %r8d	# 13496	[c=4 l=3]  *subsi_1/0
+	movzwl	24(%rsp), %eax	# 13497	[c=13 l=5]  *zero_extendhisi2/0
+	subl	%eax, %r8d	# 13498	[c=4 l=3]  *subsi_1/0
+	movl	%r8d, 24(%rsp)	# 15887	[c=4 l=5]  *movsi_internal/1
+	call	hle_cost@PLT	# 13506	[c=10 l=5]  *call_value
+	movq	16(%rsp), %rsi	# 15886	[c=9 l=5]  *movdi_internal/3
+	movl	24(%rsp), %r8d	# 15888	[c=9 l=5]  *movsi_internal/0
+	testb	%al, %al	# 13508	[c=4 l=2]  *cmpqi_ccno_1/0
+	movq	56(%rsp), %r10	# 15890	[c=9 l=5]  *movdi_internal/3
+	je	.L1430	# 13509	[c=13 l=6]  *jcc
+	cmpl	104(%rsp), %r15d	# 13511	[c=13 l=5]  *cmpsi_1/1
+	je	.L1431	# 13512	[c=13 l=6]  *jcc
+.L1432:
+	leaq	.LC41(%rip), %r8	# 73	[c=1 l=7]  *movdi_internal/4
+	jmp	.L1429	# 18795	[c=1 l=5]  jump
+.L1945:
+	movq	1040(%rbx), %rax	# 13759	[c=9 l=7]  *movdi_internal/3
+	jmp	.L688	# 18797	[c=1 l=5]  jump
+.L1944:
+	movq	1040(%rbx), %rax	# 13772	[c=9 l=7]  *movdi_internal/3
+	jmp	.L1426	# 18799	[c=1 l=5]  jump
+.L1946:
+	movq	1040(%rbx), %rax	# 13766	[c=9 l=7]  *movdi_internal/3
+	jmp	.L975	# 18801	[c=1 l=5]  jump
+.L1948:
+	movq	1040(%rbx), %rax	# 13767	[c=9 l=7]  *movdi_internal/3
+	jmp	.L1290	# 18803	[c=1 l=5]  jump
+.L1943:
+	movq	1040(%rbx), %rax	# 13762	[c=9 l=7]  *movdi_internal/3
+	jmp	.L774	# 18805	[c=1 l=5]  jump
+.L1947:
+	movq	1040(%rbx), %rax	# 13758	[c=9 l=7]  *movdi_internal/3
+	jmp	.L626	# 18807	[c=1 l=5]  jump
+.L1941:
+	movq	1040(%rbx), %rax	# 13765	[c=9 l=7]  *movdi_internal/3
+	jmp	.L953	# 18809	[c=1 l=5]  jump
+.L1942:
+	movq	1040(%rbx), %rax	# 13764	[c=9 l=7]  *movdi_internal/3
+	jmp	.L931	# 18811	[c=1 l=5]  jump
+.L578:
+	movzwl	1028(%rbx), %ebp	# 497	[c=13 l=7]  *zero_extendhisi2/0
+	movq	%rbx, %rdi	# 499	[c=4 l=3]  *movdi_internal/3
+	movl	%ebp, %esi	# 498	[c=4 l=2]  *movsi_internal/0
+	call	put_argv@PLT	# 500	[c=0 l=5]  *call
+	movl	820(%rbx), %edx	# 504	[c=9 l=6]  *movsi_internal/0
+	movzwl	816(%rbx), %eax	# 511	[c=13 l=7]  *zero_extendhisi2/0
+	movl	%ebp, 824(%rbx)	# 501	[c=4 l=6]  *movsi_internal/1
+	movw	$0, 1024(%rbx)	# 503	[c=4 l=9]  *movv2qi_internal/3
+	movzbl	%dh, %ecx	# 512	[c=4 l=3]  *extzvsi
+	sall	$8, %eax	# 513	[c=4 l=3]  *ashlsi3_1/0
+	movzbl	%dl, %edx	# 515	[c=4 l=3]  *zero_extendqisi2/0
+	orl	%ecx, %eax	# 514	[c=4 l=2]  *iorsi_1/0
+	sall	$8, %eax	# 516	[c=4 l=3]  *ashlsi3_1/0
+	orl	%edx, %eax	# 518	[c=4 l=2]  *iorsi_1/0
+	movl	%eax, 1026(%rbx)	# 519	[c=4 l=6]  *movv4qi_internal/1
+	jmp	.L568	# 18813	[c=1 l=5]  jump
+.L1444:
+	leaq	.LC39(%rip), %r8	# 71	[c=1 l=7]  *movdi_internal/4
+	jmp	.L1429	# 18815	[c=1 l=5]  jump
+.L1409:
+	movq	1040(%rbx), %rax	# 13185	[c=9 l=7]  *movdi_internal/3
+	movzbl	61(%rax), %r9d	# 13186	[c=13 l=5]  *zero_extendqisi2/0
+	cmpl	%r8d, %ecx	# 13187	[c=4 l=3]  *cmpsi_1/0
+	jb	.L1411	# 13188	[c=13 l=6]  *jcc
+	cmpb	$1, 1081(%rbx)	# 13192	[c=13 l=7]  *cmpqi_1/0
+	jbe	.L1411	# 13193	[c=13 l=6]  *jcc
+.L1412:
+	movl	$62, %esi	# 13196	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 13197	[c=4 l=3]  *movdi_internal/3
+	movl	%r9d, 16(%rsp)	# 15845	[c=4 l=5]  *movsi_internal/1
+	call	data_read_mapped	# 13198	[c=10 l=5]  *call_value
+	movl	16(%rsp), %r9d	# 15846	[c=9 l=5]  *movsi_internal/0
+	jmp	.L1413	# 18817	[c=1 l=5]  jump
+.L1953:
+	addl	%r9d, %eax	# 13216	[c=4 l=3]  *addsi_1/2
+	cmpl	%eax, 1000(%rbx)	# 13217	[c=13 l=6]  *cmpsi_1/0
+	jb	.L1415	# 13218	[c=13 l=2]  *jcc
+	movslq	%r9d, %rdx	# 13771	[c=4 l=3]  *extendsidi2_rex64/1
+	movl	$1, %eax	# 67	[c=4 l=5]  *movdi_internal/2
+	xorl	%r11d, %r11d	# 17549	[c=4 l=3]  *movdi_xor
+	addq	1040(%rbx), %rdx	# 13224	[c=13 l=7]  *adddi_1/1
+.L1416:
+	movzbl	(%rdx,%rax), %ecx	# 13225	[c=13 l=4]  *zero_extendqisi2/0
+	sall	$8, %r11d	# 13222	[c=4 l=4]  *ashlsi3_1/0
+	addq	$1, %rax	# 13227	[c=4 l=4]  *adddi_1/0
+	orl	%ecx, %r11d	# 13226	[c=4 l=3]  *iorsi_1/0
+	cmpl	%eax, 16(%rsp)	# 13229	[c=13 l=4]  *cmpsi_1/0
+	jge	.L1416	# 13230	[c=13 l=2]  *jcc
+	cmpl	%r11d, 992(%rbx)	# 13232	[c=13 l=7]  *cmpsi_1/0
+	jnb	.L1414	# 13233	[c=13 l=6]  *jcc
+.L1415:
+	jmp	*40(%r14)	# 17545	[c=9 l=4]  *indirect_jump
+.L1952:
+	movl	$61, %esi	# 13174	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 13175	[c=4 l=3]  *movdi_internal/3
+	movl	%ecx, 32(%rsp)	# 15843	[c=4 l=4]  *movsi_internal/1
+	movl	%r8d, 16(%rsp)	# 15841	[c=4 l=5]  *movsi_internal/1
+	call	data_read_mapped	# 13176	[c=10 l=5]  *call_value
+	movl	16(%rsp), %r8d	# 15842	[c=9 l=5]  *movsi_internal/0
+	movl	32(%rsp), %ecx	# 15844	[c=9 l=4]  *movsi_internal/0
+	movl	%eax, %r9d	# 13177	[c=4 l=3]  *movsi_internal/0
+	cmpl	%r8d, %ecx	# 13178	[c=4 l=3]  *cmpsi_1/0
+	jnb	.L1412	# 13179	[c=13 l=6]  *jcc
+	movq	1040(%rbx), %rax	# 13770	[c=9 l=7]  *movdi_internal/3
+	jmp	.L1411	# 18819	[c=1 l=5]  jump
+.L1949:
+	movl	(%rbx), %eax	# 532	[c=6 l=2]  *zero_extendsidi2/3
+	salq	$4, %rax	# 534	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %rax	# 535	[c=13 l=7]  *adddi_1/1
+	movzbl	11(%rax), %eax	# 536	[c=13 l=4]  zero_extendqidi2/0
+	subq	%rax, %rdx	# 537	[c=4 l=3]  *subdi_1/0
+	jmp	.L579	# 18821	[c=1 l=5]  jump
+.L1954:
+	movl	$168, %esi	# 13239	[c=4 l=5]  *movdi_internal/2
+	movl	$1, %edi	# 13240	[c=4 l=5]  *movdi_internal/2
+	movl	%r9d, 40(%rsp)	# 15849	[c=4 l=5]  *movsi_internal/1
+	movl	%r11d, 32(%rsp)	# 15847	[c=4 l=5]  *movsi_internal/1
+	call	calloc@PLT	# 13241	[c=10 l=5]  *call_value
+	movl	32(%rsp), %r11d	# 15848	[c=9 l=5]  *movsi_internal/0
+	movl	40(%rsp), %r9d	# 15850	[c=9 l=5]  *movsi_internal/0
+	testq	%rax, %rax	# 13244	[c=4 l=3]  *cmpdi_ccno_1/0
+	movq	%rax, %rdx	# 13242	[c=4 l=3]  *movdi_internal/3
+	je	.L1955	# 13245	[c=13 l=2]  *jcc
+	movq	984(%rbx), %rax	# 13259	[c=9 l=7]  *movdi_internal/3
+	movq	%rax, (%rdx)	# 13260	[c=4 l=3]  *movdi_internal/5
+	testq	%rax, %rax	# 13261	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L1419	# 13262	[c=13 l=2]  *jcc
+	movq	%rdx, 8(%rax)	# 13264	[c=4 l=4]  *movdi_internal/5
+.L1419:
+	leaq	32(%rdx), %rax	# 15916	[c=4 l=4]  *leadi
+	movl	$65568, %esi	# 13270	[c=4 l=5]  *movdi_internal/2
+	movl	$1, %edi	# 13271	[c=4 l=5]  *movdi_internal/2
+	movq	%rdx, 984(%rbx)	# 13267	[c=4 l=7]  *movdi_internal/5
+	movq	%rax, 10976(%rbx)	# 13269	[c=4 l=7]  *movdi_internal/5
+	movl	%r9d, 48(%rsp)	# 15855	[c=4 l=5]  *movsi_internal/1
+	movl	%r11d, 40(%rsp)	# 15853	[c=4 l=5]  *movsi_internal/1
+	movq	%rdx, 32(%rsp)	# 15851	[c=4 l=5]  *movdi_internal/5
+	call	calloc@PLT	# 13272	[c=10 l=5]  *call_value
+	movq	32(%rsp), %rdx	# 15852	[c=9 l=5]  *movdi_internal/3
+	movl	40(%rsp), %r11d	# 15854	[c=9 l=5]  *movsi_internal/0
+	testq	%rax, %rax	# 13275	[c=4 l=3]  *cmpdi_ccno_1/0
+	movl	48(%rsp), %r9d	# 15856	[c=9 l=5]  *movsi_internal/0
+	je	.L1956	# 13276	[c=13 l=2]  *jcc
+	movq	%rdx, (%rax)	# 13290	[c=4 l=3]  *movdi_internal/5
+	movq	%rax, 8(%rdx)	# 13291	[c=4 l=4]  *movdi_internal/5
+	movq	%rax, 984(%rbx)	# 13292	[c=4 l=7]  *movdi_internal/5
+	addq	$32, %rax	# 13293	[c=4 l=4]  *adddi_1/0
+	movq	%rax, 128(%rdx)	# 13294	[c=4 l=7]  *movdi_internal/5
+	jmp	.L1417	# 18825	[c=1 l=5]  jump
+.L1955:
+	movl	$136, %r8d	# 13248	[c=4 l=6]  *movsi_internal/0
+	movl	$1, %ecx	# 13249	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 13253	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 17548	[c=4 l=2]  *movdi_xor
+	leaq	.LC55(%rip), %r9	# 13247	[c=1 l=7]  *movdi_internal/4
+	leaq	.LC4(%rip), %rdx	# 13250	[c=1 l=7]  *movdi_internal/4
+	movl	$6, %esi	# 13252	[c=4 l=5]  *movsi_internal/0
+	call	leave	# 13255	[c=0 l=5]  *call
+.L1878:
+	leaq	.LC52(%rip), %rdx	# 7312	[c=1 l=7]  *movdi_internal/4
+	movl	$1, %esi	# 7314	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 7315	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 17733	[c=4 l=2]  *movdi_xor
+	call	leave	# 7317	[c=0 l=5]  *call
+.L1829:
+	movl	%edx, %ecx	# 752	[c=4 l=2]  *movsi_internal/0
+	movl	$1, %esi	# 755	[c=4 l=5]  *movsi_internal/0
+	leaq	.LC52(%rip), %rdx	# 753	[c=1 l=7]  *movdi_internal/4
+	xorl	%eax, %eax	# 18005	[c=4 l=2]  *movdi_xor
+	movq	%rbx, %rdi	# 756	[c=4 l=3]  *movdi_internal/3
+	call	leave	# 758	[c=0 l=5]  *call
+.L1741:
+	movl	%r14d, %esi	# 5559	[c=4 l=3]  *movsi_internal/0
+	movq	%rbx, %rdi	# 5560	[c=4 l=3]  *movdi_internal/3
+	call	stack_overflow	# 5561	[c=0 l=5]  *call
+.L1956:
+	leaq	.LC55(%rip), %r9	# 13278	[c=1 l=7]  *movdi_internal/4
+	movl	$1, %r8d	# 13279	[c=4 l=6]  *movsi_internal/0
+	movq	%rbx, %rdi	# 13284	[c=4 l=3]  *movdi_internal/3
+	movl	$65536, %ecx	# 13280	[c=4 l=5]  *movsi_internal/0
+	leaq	.LC4(%rip), %rdx	# 13281	[c=1 l=7]  *movdi_internal/4
+	movl	$6, %esi	# 13283	[c=4 l=5]  *movsi_internal/0
+	call	leave	# 13286	[c=0 l=5]  *call
+.L1842:
+	movl	%r8d, %ecx	# 6282	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC52(%rip), %rdx	# 6283	[c=1 l=7]  *movdi_internal/4
+	movq	%rbx, %rdi	# 6286	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 17780	[c=4 l=2]  *movdi_xor
+	movl	$1, %esi	# 6285	[c=4 l=5]  *movsi_internal/0
+	call	leave	# 6288	[c=0 l=5]  *call
+.L1431:
+	cmpl	108(%rsp), %r8d	# 13519	[c=13 l=5]  *cmpsi_1/1
+	jne	.L1432	# 13520	[c=13 l=6]  *jcc
+.L1430:
+	movl	%r8d, %ecx	# 13523	[c=4 l=3]  *movsi_internal/0
+	movl	%r15d, %edx	# 13524	[c=4 l=3]  *movsi_internal/0
+	movq	%r14, %rdi	# 13526	[c=4 l=3]  *movdi_internal/3
+	movq	%r10, 16(%rsp)	# 15891	[c=4 l=5]  *movdi_internal/5
+	call	hle_learn@PLT	# 13527	[c=10 l=5]  *call_value
+	movq	16(%rsp), %r10	# 15892	[c=9 l=5]  *movdi_internal/3
+	testb	%al, %al	# 13529	[c=4 l=2]  *cmpqi_ccno_1/0
+	je	.L1432	# 13530	[c=13 l=6]  *jcc
+	jmp	*%r10	# 16966	[c=4 l=3]  *indirect_jump
+.L1854:
+	movl	%eax, %ecx	# 9013	[c=4 l=2]  *movsi_internal/0
+	leaq	.LC52(%rip), %rdx	# 9014	[c=1 l=7]  *movdi_internal/4
+	movq	%rbx, %rdi	# 9017	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 17678	[c=4 l=2]  *movdi_xor
+	movl	$1, %esi	# 9016	[c=4 l=5]  *movsi_internal/0
+	call	leave	# 9019	[c=0 l=5]  *call
+.L1820:
+	movl	%ebp, %ecx	# 3923	[c=4 l=2]  *movsi_internal/0
+	leaq	.LC52(%rip), %rdx	# 3924	[c=1 l=7]  *movdi_internal/4
+	movl	$1, %esi	# 3926	[c=4 l=5]  *movsi_internal/0
+	xorl	%eax, %eax	# 17871	[c=4 l=2]  *movdi_xor
+	movq	%rbx, %rdi	# 3927	[c=4 l=3]  *movdi_internal/3
+	call	leave	# 3929	[c=0 l=5]  *call
+.L1757:
+	leaq	.LC52(%rip), %rdx	# 10630	[c=1 l=7]  *movdi_internal/4
+	movl	$1, %esi	# 10632	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 10633	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 17624	[c=4 l=2]  *movdi_xor
+	call	leave	# 10635	[c=0 l=5]  *call
+.L1759:
+	movl	%r9d, %ecx	# 10770	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC52(%rip), %rdx	# 10771	[c=1 l=7]  *movdi_internal/4
+	movq	%rbx, %rdi	# 10774	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 17618	[c=4 l=2]  *movdi_xor
+	movl	$1, %esi	# 10773	[c=4 l=5]  *movsi_internal/0
+	call	leave	# 10776	[c=0 l=5]  *call
+.L1758:
+	leaq	.LC52(%rip), %rdx	# 10694	[c=1 l=7]  *movdi_internal/4
+	movl	$1, %esi	# 10696	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 10697	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 17623	[c=4 l=2]  *movdi_xor
+	call	leave	# 10699	[c=0 l=5]  *call
+.L1719:
+	movl	%ebp, %ecx	# 11637	[c=4 l=2]  *movsi_internal/0
+	leaq	.LC52(%rip), %rdx	# 11638	[c=1 l=7]  *movdi_internal/4
+	movl	$1, %esi	# 11640	[c=4 l=5]  *movsi_internal/0
+	xorl	%eax, %eax	# 17588	[c=4 l=2]  *movdi_xor
+	movq	%rbx, %rdi	# 11641	[c=4 l=3]  *movdi_internal/3
+	call	leave	# 11643	[c=0 l=5]  *call
+.L1751:
+	leaq	.LC52(%rip), %rdx	# 6887	[c=1 l=7]  *movdi_internal/4
+	movl	$1, %esi	# 6889	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 6890	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 17756	[c=4 l=2]  *movdi_xor
+	call	leave	# 6892	[c=0 l=5]  *call
+.L1851:
+	movl	%edx, %ecx	# 5123	[c=4 l=2]  *movsi_internal/0
+	movl	$1, %esi	# 5126	[c=4 l=5]  *movsi_internal/0
+	leaq	.LC52(%rip), %rdx	# 5124	[c=1 l=7]  *movdi_internal/4
+	xorl	%eax, %eax	# 17810	[c=4 l=2]  *movdi_xor
+	movq	%rbx, %rdi	# 5127	[c=4 l=3]  *movdi_internal/3
+	call	leave	# 5129	[c=0 l=5]  *call
+.L1803:
+	movl	%edx, %ecx	# 2876	[c=4 l=2]  *movsi_internal/0
+	movl	$1, %esi	# 2879	[c=4 l=5]  *movsi_internal/0
+	leaq	.LC52(%rip), %rdx	# 2877	[c=1 l=7]  *movdi_internal/4
+	xorl	%eax, %eax	# 17918	[c=4 l=2]  *movdi_xor
+	movq	%rbx, %rdi	# 2880	[c=4 l=3]  *movdi_internal/3
+	call	leave	# 2882	[c=0 l=5]  *call
+.L1701:
+	movq	%rbx, %rdi	# 11538	[c=4 l=3]  *movdi_internal/3
+	call	stack_overflow	# 11539	[c=0 l=5]  *call
+.L1813:
+	movl	%ebp, %esi	# 3458	[c=4 l=2]  *movsi_internal/0
+	movq	%rbx, %rdi	# 3459	[c=4 l=3]  *movdi_internal/3
+	call	stack_overflow	# 3460	[c=0 l=5]  *call
+.L1818:
+	movq	%rbx, %rdi	# 3651	[c=4 l=3]  *movdi_internal/3
+	call	bad_PC	# 3652	[c=0 l=5]  *call
+.L1904:
+	movl	%ebp, %esi	# 2386	[c=4 l=2]  *movsi_internal/0
+	movq	%rbx, %rdi	# 2387	[c=4 l=3]  *movdi_internal/3
+	call	stack_overflow	# 2388	[c=0 l=5]  *call
+.L1892:
+	leaq	.LC52(%rip), %rdx	# 2000	[c=1 l=7]  *movdi_internal/4
+	movl	$1, %esi	# 2002	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 2003	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 17948	[c=4 l=2]  *movdi_xor
+	call	leave	# 2005	[c=0 l=5]  *call
+.L1849:
+	leaq	.LC52(%rip), %rdx	# 5025	[c=1 l=7]  *movdi_internal/4
+	movl	$1, %esi	# 5027	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 5028	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 17814	[c=4 l=2]  *movdi_xor
+	call	leave	# 5030	[c=0 l=5]  *call
+.L1730:
+	movl	%r14d, %ecx	# 10382	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC52(%rip), %rdx	# 10383	[c=1 l=7]  *movdi_internal/4
+	movq	%rbx, %rdi	# 10386	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 17638	[c=4 l=2]  *movdi_xor
+	movl	$1, %esi	# 10385	[c=4 l=5]  *movsi_internal/0
+	call	leave	# 10388	[c=0 l=5]  *call
+.L1679:
+	leaq	.LC52(%rip), %rdx	# 10300	[c=1 l=7]  *movdi_internal/4
+	movl	$1, %esi	# 10302	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 10303	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 17641	[c=4 l=2]  *movdi_xor
+	call	leave	# 10305	[c=0 l=5]  *call
+.L1910:
+	movq	%rbx, %rdi	# 2644	[c=4 l=3]  *movdi_internal/3
+	call	bad_PC	# 2645	[c=0 l=5]  *call
+.L1733:
+	leaq	.LC52(%rip), %rdx	# 7017	[c=1 l=7]  *movdi_internal/4
+	movl	$1, %esi	# 7019	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 7020	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 17748	[c=4 l=2]  *movdi_xor
+	call	leave	# 7022	[c=0 l=5]  *call
+.L1058:
+	leaq	.LC54(%rip), %rdx	# 7165	[c=1 l=7]  *movdi_internal/4
+	movl	$4, %esi	# 7167	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 7168	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 17740	[c=4 l=2]  *movdi_xor
+	call	leave	# 7170	[c=0 l=5]  *call
+.L1731:
+	movl	%r14d, %ecx	# 10459	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC52(%rip), %rdx	# 10460	[c=1 l=7]  *movdi_internal/4
+	movq	%rbx, %rdi	# 10463	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 17635	[c=4 l=2]  *movdi_xor
+	movl	$1, %esi	# 10462	[c=4 l=5]  *movsi_internal/0
+	call	leave	# 10465	[c=0 l=5]  *call
+.L1709:
+	leaq	.LC52(%rip), %rdx	# 10228	[c=1 l=7]  *movdi_internal/4
+	movl	$1, %esi	# 10230	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 10231	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 17642	[c=4 l=2]  *movdi_xor
+	call	leave	# 10233	[c=0 l=5]  *call
+.L1725:
+	leaq	.LC52(%rip), %rdx	# 10003	[c=1 l=7]  *movdi_internal/4
+	movl	$1, %esi	# 10005	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 10006	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 17649	[c=4 l=2]  *movdi_xor
+	call	leave	# 10008	[c=0 l=5]  *call
+.L1724:
+	movl	%eax, %ecx	# 9984	[c=4 l=2]  *movsi_internal/0
+	leaq	.LC52(%rip), %rdx	# 9985	[c=1 l=7]  *movdi_internal/4
+	movq	%rbx, %rdi	# 9988	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 17650	[c=4 l=2]  *movdi_xor
+	movl	$1, %esi	# 9987	[c=4 l=5]  *movsi_internal/0
+	call	leave	# 9990	[c=0 l=5]  *call
+.L1723:
+	movl	%edi, %ecx	# 9919	[c=4 l=2]  *movsi_internal/0
+	leaq	.LC52(%rip), %rdx	# 9920	[c=1 l=7]  *movdi_internal/4
+	movl	$1, %esi	# 9922	[c=4 l=5]  *movsi_internal/0
+	xorl	%eax, %eax	# 17651	[c=4 l=2]  *movdi_xor
+	movq	%rbx, %rdi	# 9923	[c=4 l=3]  *movdi_internal/3
+	call	leave	# 9925	[c=0 l=5]  *call
+.L1729:
+	movl	%r8d, %ecx	# 10165	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC52(%rip), %rdx	# 10166	[c=1 l=7]  *movdi_internal/4
+	movq	%rbx, %rdi	# 10169	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 17643	[c=4 l=2]  *movdi_xor
+	movl	$1, %esi	# 10168	[c=4 l=5]  *movsi_internal/0
+	call	leave	# 10171	[c=0 l=5]  *call
+.L1728:
+	movl	%esi, %ecx	# 10147	[c=4 l=2]  *movsi_internal/0
+	leaq	.LC52(%rip), %rdx	# 10148	[c=1 l=7]  *movdi_internal/4
+	movl	$1, %esi	# 10150	[c=4 l=5]  *movsi_internal/0
+	xorl	%eax, %eax	# 17644	[c=4 l=2]  *movdi_xor
+	movq	%rbx, %rdi	# 10151	[c=4 l=3]  *movdi_internal/3
+	call	leave	# 10153	[c=0 l=5]  *call
+.L1727:
+	movl	%r8d, %ecx	# 10085	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC52(%rip), %rdx	# 10086	[c=1 l=7]  *movdi_internal/4
+	movq	%rbx, %rdi	# 10089	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 17645	[c=4 l=2]  *movdi_xor
+	movl	$1, %esi	# 10088	[c=4 l=5]  *movsi_internal/0
+	call	leave	# 10091	[c=0 l=5]  *call
+.L1726:
+	leaq	.LC52(%rip), %rdx	# 10068	[c=1 l=7]  *movdi_internal/4
+	movl	$1, %esi	# 10070	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 10071	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 17646	[c=4 l=2]  *movdi_xor
+	call	leave	# 10073	[c=0 l=5]  *call
+.L1894:
+	leaq	.LC52(%rip), %rdx	# 2089	[c=1 l=7]  *movdi_internal/4
+	movl	$1, %esi	# 2091	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 2092	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 17945	[c=4 l=2]  *movdi_xor
+	call	leave	# 2094	[c=0 l=5]  *call
+.L1893:
+	movl	%eax, %ecx	# 2071	[c=4 l=2]  *movsi_internal/0
+	leaq	.LC52(%rip), %rdx	# 2072	[c=1 l=7]  *movdi_internal/4
+	movq	%rbx, %rdi	# 2075	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 17946	[c=4 l=2]  *movdi_xor
+	movl	$1, %esi	# 2074	[c=4 l=5]  *movsi_internal/0
+	call	leave	# 2077	[c=0 l=5]  *call
+.L1816:
+	movq	%rbx, %rdi	# 3604	[c=4 l=3]  *movdi_internal/3
+	call	bad_PC	# 3605	[c=0 l=5]  *call
+.L1685:
+	movl	%eax, %ecx	# 1909	[c=4 l=2]  *movsi_internal/0
+	leaq	.LC52(%rip), %rdx	# 1910	[c=1 l=7]  *movdi_internal/4
+	movq	%rbx, %rdi	# 1913	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 17951	[c=4 l=2]  *movdi_xor
+	movl	$1, %esi	# 1912	[c=4 l=5]  *movsi_internal/0
+	call	leave	# 1915	[c=0 l=5]  *call
+.L1704:
+	leaq	.LC52(%rip), %rdx	# 5340	[c=1 l=7]  *movdi_internal/4
+	movl	$1, %esi	# 5342	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 5343	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 17802	[c=4 l=2]  *movdi_xor
+	call	leave	# 5345	[c=0 l=5]  *call
+.L1694:
+	movl	%r8d, %ecx	# 664	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC52(%rip), %rdx	# 665	[c=1 l=7]  *movdi_internal/4
+	movq	%rbx, %rdi	# 668	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 18008	[c=4 l=2]  *movdi_xor
+	movl	$1, %esi	# 667	[c=4 l=5]  *movsi_internal/0
+	call	leave	# 670	[c=0 l=5]  *call
+.L1688:
+	leaq	.LC52(%rip), %rdx	# 7610	[c=1 l=7]  *movdi_internal/4
+	movl	$1, %esi	# 7612	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 7613	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 17723	[c=4 l=2]  *movdi_xor
+	call	leave	# 7615	[c=0 l=5]  *call
+.L1690:
+	leaq	.LC52(%rip), %rdx	# 7850	[c=1 l=7]  *movdi_internal/4
+	movl	$1, %esi	# 7852	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 7853	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 17715	[c=4 l=2]  *movdi_xor
+	call	leave	# 7855	[c=0 l=5]  *call
+.L1933:
+	leaq	.LC52(%rip), %rdx	# 4650	[c=1 l=7]  *movdi_internal/4
+	movl	$1, %esi	# 4652	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 4653	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 17843	[c=4 l=2]  *movdi_xor
+	call	leave	# 4655	[c=0 l=5]  *call
+.L1932:
+	leaq	.LC52(%rip), %rdx	# 4617	[c=1 l=7]  *movdi_internal/4
+	movl	$1, %esi	# 4619	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 4620	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 17845	[c=4 l=2]  *movdi_xor
+	call	leave	# 4622	[c=0 l=5]  *call
+.L1920:
+	movl	%edx, %ecx	# 951	[c=4 l=2]  *movsi_internal/0
+	movl	$1, %esi	# 954	[c=4 l=5]  *movsi_internal/0
+	leaq	.LC52(%rip), %rdx	# 952	[c=1 l=7]  *movdi_internal/4
+	xorl	%eax, %eax	# 17990	[c=4 l=2]  *movdi_xor
+	movq	%rbx, %rdi	# 955	[c=4 l=3]  *movdi_internal/3
+	call	leave	# 957	[c=0 l=5]  *call
+.L1919:
+	leaq	.LC52(%rip), %rdx	# 935	[c=1 l=7]  *movdi_internal/4
+	movl	$1, %esi	# 937	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 938	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 17991	[c=4 l=2]  *movdi_xor
+	call	leave	# 940	[c=0 l=5]  *call
+.L1923:
+	leaq	.LC52(%rip), %rdx	# 7491	[c=1 l=7]  *movdi_internal/4
+	movl	$1, %esi	# 7493	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 7494	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 17727	[c=4 l=2]  *movdi_xor
+	call	leave	# 7496	[c=0 l=5]  *call
+.L1922:
+	leaq	.LC52(%rip), %rdx	# 7433	[c=1 l=7]  *movdi_internal/4
+	movl	$1, %esi	# 7435	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 7436	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 17729	[c=4 l=2]  *movdi_xor
+	call	leave	# 7438	[c=0 l=5]  *call
+.L1925:
+	movl	%r14d, %ecx	# 4226	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC52(%rip), %rdx	# 4227	[c=1 l=7]  *movdi_internal/4
+	movq	%rbx, %rdi	# 4230	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 17861	[c=4 l=2]  *movdi_xor
+	movl	$1, %esi	# 4229	[c=4 l=5]  *movsi_internal/0
+	call	leave	# 4232	[c=0 l=5]  *call
+.L1924:
+	movl	%ebp, %ecx	# 4167	[c=4 l=2]  *movsi_internal/0
+	leaq	.LC52(%rip), %rdx	# 4168	[c=1 l=7]  *movdi_internal/4
+	movl	$1, %esi	# 4170	[c=4 l=5]  *movsi_internal/0
+	xorl	%eax, %eax	# 17863	[c=4 l=2]  *movdi_xor
+	movq	%rbx, %rdi	# 4171	[c=4 l=3]  *movdi_internal/3
+	call	leave	# 4173	[c=0 l=5]  *call
+.L1736:
+	leaq	.LC52(%rip), %rdx	# 7082	[c=1 l=7]  *movdi_internal/4
+	movl	$1, %esi	# 7084	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 7085	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 17744	[c=4 l=2]  *movdi_xor
+	call	leave	# 7087	[c=0 l=5]  *call
+.L1739:
+	leaq	.LC52(%rip), %rdx	# 5248	[c=1 l=7]  *movdi_internal/4
+	movl	$1, %esi	# 5250	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 5251	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 17806	[c=4 l=2]  *movdi_xor
+	call	leave	# 5253	[c=0 l=5]  *call
+.L1871:
+	movl	%eax, %ecx	# 8249	[c=4 l=2]  *movsi_internal/0
+	leaq	.LC52(%rip), %rdx	# 8250	[c=1 l=7]  *movdi_internal/4
+	movq	%rbx, %rdi	# 8253	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 17699	[c=4 l=2]  *movdi_xor
+	movl	$1, %esi	# 8252	[c=4 l=5]  *movsi_internal/0
+	call	leave	# 8255	[c=0 l=5]  *call
+.L1870:
+	leaq	.LC52(%rip), %rdx	# 8172	[c=1 l=7]  *movdi_internal/4
+	movl	$1, %esi	# 8174	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 8175	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 17703	[c=4 l=2]  *movdi_xor
+	call	leave	# 8177	[c=0 l=5]  *call
+.L1879:
+	leaq	.LC52(%rip), %rdx	# 7375	[c=1 l=7]  *movdi_internal/4
+	movl	$1, %esi	# 7377	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 7378	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 17731	[c=4 l=2]  *movdi_xor
+	call	leave	# 7380	[c=0 l=5]  *call
+.L1891:
+	leaq	.LC52(%rip), %rdx	# 1839	[c=1 l=7]  *movdi_internal/4
+	movl	$1, %esi	# 1841	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 1842	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 17953	[c=4 l=2]  *movdi_xor
+	call	leave	# 1844	[c=0 l=5]  *call
+.L1890:
+	movl	%eax, %ecx	# 1820	[c=4 l=2]  *movsi_internal/0
+	leaq	.LC52(%rip), %rdx	# 1821	[c=1 l=7]  *movdi_internal/4
+	movq	%rbx, %rdi	# 1824	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 17954	[c=4 l=2]  *movdi_xor
+	movl	$1, %esi	# 1823	[c=4 l=5]  *movsi_internal/0
+	call	leave	# 1826	[c=0 l=5]  *call
+.L1889:
+	leaq	.LC52(%rip), %rdx	# 1772	[c=1 l=7]  *movdi_internal/4
+	movl	$1, %esi	# 1774	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 1775	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 17958	[c=4 l=2]  *movdi_xor
+	call	leave	# 1777	[c=0 l=5]  *call
+.L1921:
+	leaq	.LC52(%rip), %rdx	# 7671	[c=1 l=7]  *movdi_internal/4
+	movl	$1, %esi	# 7673	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 7674	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 17721	[c=4 l=2]  *movdi_xor
+	call	leave	# 7676	[c=0 l=5]  *call
+.L1872:
+	leaq	.LC52(%rip), %rdx	# 8315	[c=1 l=7]  *movdi_internal/4
+	movl	$1, %esi	# 8317	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 8318	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 17697	[c=4 l=2]  *movdi_xor
+	call	leave	# 8320	[c=0 l=5]  *call
+.L1874:
+	movl	%esi, %ecx	# 7927	[c=4 l=2]  *movsi_internal/0
+	leaq	.LC52(%rip), %rdx	# 7928	[c=1 l=7]  *movdi_internal/4
+	movl	$1, %esi	# 7930	[c=4 l=5]  *movsi_internal/0
+	xorl	%eax, %eax	# 17712	[c=4 l=2]  *movdi_xor
+	movq	%rbx, %rdi	# 7931	[c=4 l=3]  *movdi_internal/3
+	call	leave	# 7933	[c=0 l=5]  *call
+.L1873:
+	leaq	.LC52(%rip), %rdx	# 7910	[c=1 l=7]  *movdi_internal/4
+	movl	$1, %esi	# 7912	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 7913	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 17713	[c=4 l=2]  *movdi_xor
+	call	leave	# 7915	[c=0 l=5]  *call
+.L1929:
+	movl	%r14d, %ecx	# 4466	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC52(%rip), %rdx	# 4467	[c=1 l=7]  *movdi_internal/4
+	movq	%rbx, %rdi	# 4470	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 17853	[c=4 l=2]  *movdi_xor
+	movl	$1, %esi	# 4469	[c=4 l=5]  *movsi_internal/0
+	call	leave	# 4472	[c=0 l=5]  *call
+.L1928:
+	movl	%r14d, %ecx	# 4405	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC52(%rip), %rdx	# 4406	[c=1 l=7]  *movdi_internal/4
+	movq	%rbx, %rdi	# 4409	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 17855	[c=4 l=2]  *movdi_xor
+	movl	$1, %esi	# 4408	[c=4 l=5]  *movsi_internal/0
+	call	leave	# 4411	[c=0 l=5]  *call
+.L1927:
+	movl	%r14d, %ecx	# 4346	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC52(%rip), %rdx	# 4347	[c=1 l=7]  *movdi_internal/4
+	movq	%rbx, %rdi	# 4350	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 17857	[c=4 l=2]  *movdi_xor
+	movl	$1, %esi	# 4349	[c=4 l=5]  *movsi_internal/0
+	call	leave	# 4352	[c=0 l=5]  *call
+.L1926:
+	movl	%r14d, %ecx	# 4285	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC52(%rip), %rdx	# 4286	[c=1 l=7]  *movdi_internal/4
+	movq	%rbx, %rdi	# 4289	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 17859	[c=4 l=2]  *movdi_xor
+	movl	$1, %esi	# 4288	[c=4 l=5]  *movsi_internal/0
+	call	leave	# 4291	[c=0 l=5]  *call
+.L1687:
+	movl	%r14d, %ecx	# 11752	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC52(%rip), %rdx	# 11753	[c=1 l=7]  *movdi_internal/4
+	movq	%rbx, %rdi	# 11756	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 17586	[c=4 l=2]  *movdi_xor
+	movl	$1, %esi	# 11755	[c=4 l=5]  *movsi_internal/0
+	call	leave	# 11758	[c=0 l=5]  *call
+.L1689:
+	movl	%r14d, %ecx	# 11693	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC52(%rip), %rdx	# 11694	[c=1 l=7]  *movdi_internal/4
+	movq	%rbx, %rdi	# 11697	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 17587	[c=4 l=2]  *movdi_xor
+	movl	$1, %esi	# 11696	[c=4 l=5]  *movsi_internal/0
+	call	leave	# 11699	[c=0 l=5]  *call
+.L1721:
+	leaq	.LC52(%rip), %rdx	# 9837	[c=1 l=7]  *movdi_internal/4
+	movl	$1, %esi	# 9839	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 9840	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 17655	[c=4 l=2]  *movdi_xor
+	call	leave	# 9842	[c=0 l=5]  *call
+.L1831:
+	movl	%r14d, %esi	# 5881	[c=4 l=3]  *movsi_internal/0
+	movq	%rbx, %rdi	# 5882	[c=4 l=3]  *movdi_internal/3
+	call	bad_PC	# 5883	[c=0 l=5]  *call
+.L1811:
+	leaq	.LC52(%rip), %rdx	# 3351	[c=1 l=7]  *movdi_internal/4
+	movl	$1, %esi	# 3353	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 3354	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 17893	[c=4 l=2]  *movdi_xor
+	call	leave	# 3356	[c=0 l=5]  *call
+.L1810:
+	movl	%eax, %ecx	# 3333	[c=4 l=2]  *movsi_internal/0
+	leaq	.LC52(%rip), %rdx	# 3334	[c=1 l=7]  *movdi_internal/4
+	movq	%rbx, %rdi	# 3337	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 17894	[c=4 l=2]  *movdi_xor
+	movl	$1, %esi	# 3336	[c=4 l=5]  *movsi_internal/0
+	call	leave	# 3339	[c=0 l=5]  *call
+.L1809:
+	leaq	.LC52(%rip), %rdx	# 3280	[c=1 l=7]  *movdi_internal/4
+	movl	$1, %esi	# 3282	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 3283	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 17901	[c=4 l=2]  *movdi_xor
+	call	leave	# 3285	[c=0 l=5]  *call
+.L1808:
+	movl	%eax, %ecx	# 3262	[c=4 l=2]  *movsi_internal/0
+	leaq	.LC52(%rip), %rdx	# 3263	[c=1 l=7]  *movdi_internal/4
+	movq	%rbx, %rdi	# 3266	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 17902	[c=4 l=2]  *movdi_xor
+	movl	$1, %esi	# 3265	[c=4 l=5]  *movsi_internal/0
+	call	leave	# 3268	[c=0 l=5]  *call
+.L1909:
+	movl	(%rbx), %eax	# 15091	[c=5 l=2]  *movsi_internal/0
+	movq	1056(%rbx), %rdx	# 2602	[c=9 l=7]  *movdi_internal/3
+	movl	$1, %esi	# 2608	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 2609	[c=4 l=3]  *movdi_internal/3
+	movq	832(%rbx), %r8	# 2604	[c=9 l=7]  *movdi_internal/3
+	subl	$1, %eax	# 2597	[c=4 l=3]  *addsi_1/0
+	movl	%eax, (%rbx)	# 2598	[c=4 l=2]  *movsi_internal/1
+	addl	%eax, %eax	# 2600	[c=5 l=2]  *ashlsi3_1_zext/0
+	movzwl	(%rdx,%rax), %ecx	# 2603	[c=13 l=4]  *zero_extendhisi2/0
+	leaq	.LC44(%rip), %rdx	# 2606	[c=1 l=7]  *movdi_internal/4
+	xorl	%eax, %eax	# 17929	[c=4 l=2]  *movdi_xor
+	call	leave	# 2611	[c=0 l=5]  *call
+.L1876:
+	leaq	.LC52(%rip), %rdx	# 8075	[c=1 l=7]  *movdi_internal/4
+	movl	$1, %esi	# 8077	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 8078	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 17708	[c=4 l=2]  *movdi_xor
+	call	leave	# 8080	[c=0 l=5]  *call
+.L1918:
+	leaq	.LC52(%rip), %rdx	# 1166	[c=1 l=7]  *movdi_internal/4
+	movl	$1, %esi	# 1168	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 1169	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 17981	[c=4 l=2]  *movdi_xor
+	call	leave	# 1171	[c=0 l=5]  *call
+.L1917:
+	leaq	.LC52(%rip), %rdx	# 1075	[c=1 l=7]  *movdi_internal/4
+	movl	$1, %esi	# 1077	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 1078	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 17986	[c=4 l=2]  *movdi_xor
+	call	leave	# 1080	[c=0 l=5]  *call
+.L1875:
+	leaq	.LC52(%rip), %rdx	# 8003	[c=1 l=7]  *movdi_internal/4
+	movl	$1, %esi	# 8005	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 8006	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 17710	[c=4 l=2]  *movdi_xor
+	call	leave	# 8008	[c=0 l=5]  *call
+.L1877:
+	leaq	.LC52(%rip), %rdx	# 7248	[c=1 l=7]  *movdi_internal/4
+	movl	$1, %esi	# 7250	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 7251	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 17735	[c=4 l=2]  *movdi_xor
+	call	leave	# 7253	[c=0 l=5]  *call
+.L1916:
+	leaq	.LC52(%rip), %rdx	# 1014	[c=1 l=7]  *movdi_internal/4
+	movl	$1, %esi	# 1016	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 1017	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 17988	[c=4 l=2]  *movdi_xor
+	call	leave	# 1019	[c=0 l=5]  *call
+.L1915:
+	leaq	.LC52(%rip), %rdx	# 7791	[c=1 l=7]  *movdi_internal/4
+	movl	$1, %esi	# 7793	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 7794	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 17717	[c=4 l=2]  *movdi_xor
+	call	leave	# 7796	[c=0 l=5]  *call
+.L1699:
+	leaq	.LC52(%rip), %rdx	# 11472	[c=1 l=7]  *movdi_internal/4
+	movl	$1, %esi	# 11474	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 11475	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 17589	[c=4 l=2]  *movdi_xor
+	call	leave	# 11477	[c=0 l=5]  *call
+.L1769:
+	movl	%r8d, %ecx	# 11300	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC52(%rip), %rdx	# 11301	[c=1 l=7]  *movdi_internal/4
+	movq	%rbx, %rdi	# 11304	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 17594	[c=4 l=2]  *movdi_xor
+	movl	$1, %esi	# 11303	[c=4 l=5]  *movsi_internal/0
+	call	leave	# 11306	[c=0 l=5]  *call
+.L1940:
+	xorl	%edx, %edx	# 17551	[c=4 l=2]  *movsi_xor
+	movq	%rbx, %rdi	# 13137	[c=4 l=3]  *movdi_internal/3
+	movl	%edx, 96(%rbx)	# 17552	[c=4 l=3]  *movsi_internal/1
+	call	do_events	# 13138	[c=0 l=5]  *call
+	jmp	.L1408	# 18827	[c=1 l=5]  jump
+.L1939:
+	movl	5176(%rbx), %r14d	# 12939	[c=9 l=7]  *movsi_internal/0
+	movl	$61, %eax	# 12943	[c=4 l=5]  *movsi_internal/0
+	movl	5180(%rbx), %r12d	# 12940	[c=9 l=7]  *movsi_internal/0
+	movl	$62, %r15d	# 12941	[c=4 l=6]  *movsi_internal/0
+	subl	%r14d, %eax	# 12944	[c=4 l=3]  *subsi_1/0
+	subl	%r14d, %r15d	# 12942	[c=4 l=3]  *subsi_1/0
+	cmpl	%r12d, %eax	# 12945	[c=4 l=3]  *cmpsi_1/0
+	jb	.L1388	# 12946	[c=13 l=6]  *jcc
+	cmpb	$1, 1081(%rbx)	# 12950	[c=13 l=7]  *cmpqi_1/0
+	ja	.L1957	# 12951	[c=13 l=6]  *jcc
+	movq	1040(%rbx), %rax	# 13608	[c=9 l=7]  *movdi_internal/3
+	movzbl	61(%rax), %ebp	# 13609	[c=13 l=4]  *zero_extendqisi2/0
+.L1390:
+	movzbl	62(%rax), %eax	# 12984	[c=13 l=4]  *zero_extendqisi2/0
+.L1392:
+	sall	$8, %eax	# 12987	[c=4 l=3]  *ashlsi3_1/0
+	xorl	%r15d, %r15d	# 17553	[c=4 l=3]  *movdi_xor
+	orl	%eax, %ebp	# 12988	[c=4 l=2]  *iorsi_1/0
+	cmpb	$0, 840(%rbx)	# 12989	[c=13 l=7]  *cmpqi_ccno_1/1
+	je	.L1393	# 12990	[c=13 l=2]  *jcc
+	addl	$1, %ebp	# 12992	[c=4 l=3]  *addsi_1/0
+	movl	%ebp, %eax	# 15720	[c=4 l=2]  *movsi_internal/0
+	subl	%r14d, %eax	# 12993	[c=4 l=3]  *subsi_1/0
+	cmpl	%r12d, %eax	# 12994	[c=4 l=3]  *cmpsi_1/0
+	jb	.L1394	# 12995	[c=13 l=2]  *jcc
+	movl	%ebp, %eax	# 15722	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %eax	# 12997	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 14782	[c=5 l=5]  *andsi_1_zext
+	cmpb	$0, 1080(%rbx,%rax)	# 13000	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L1395	# 13001	[c=13 l=6]  *jcc
+.L1394:
+	movq	1040(%rbx), %rdx	# 13005	[c=9 l=7]  *movdi_internal/3
+	movslq	%ebp, %rax	# 13004	[c=4 l=3]  *extendsidi2_rex64/1
+	movzbl	(%rdx,%rax), %r15d	# 13006	[c=13 l=5]  *zero_extendqisi2/0
+.L1396:
+	sall	$16, %r15d	# 13017	[c=4 l=4]  *ashlsi3_1/0
+.L1393:
+	leal	1(%rbp), %esi	# 15917	[c=4 l=3]  *leasi
+	movl	%esi, %eax	# 15724	[c=4 l=2]  *movsi_internal/0
+	subl	5176(%rbx), %eax	# 13021	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %eax	# 13022	[c=13 l=6]  *cmpsi_1/1
+	jb	.L1397	# 13023	[c=13 l=2]  *jcc
+	movl	%esi, %eax	# 15726	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %eax	# 13025	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 14781	[c=5 l=5]  *andsi_1_zext
+	cmpb	$0, 1080(%rbx,%rax)	# 13028	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L1398	# 13029	[c=13 l=6]  *jcc
+.L1397:
+	movq	1040(%rbx), %rax	# 13033	[c=9 l=7]  *movdi_internal/3
+	movslq	%esi, %rsi	# 13032	[c=4 l=3]  *extendsidi2_rex64/1
+	movzbl	(%rax,%rsi), %eax	# 13034	[c=13 l=4]  *zero_extendqisi2/0
+.L1399:
+	sall	$8, %eax	# 13045	[c=4 l=3]  *ashlsi3_1/0
+	addl	$2, %ebp	# 13047	[c=4 l=3]  *addsi_1/0
+	orl	%r15d, %eax	# 13046	[c=4 l=3]  *iorsi_1/0
+	movl	%eax, %r12d	# 15729	[c=4 l=3]  *movsi_internal/0
+	movl	%ebp, %eax	# 15730	[c=4 l=2]  *movsi_internal/0
+	subl	5176(%rbx), %eax	# 13048	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %eax	# 13049	[c=13 l=6]  *cmpsi_1/1
+	jb	.L1400	# 13050	[c=13 l=2]  *jcc
+	movl	%ebp, %eax	# 15732	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %eax	# 13052	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 14780	[c=5 l=5]  *andsi_1_zext
+	cmpb	$0, 1080(%rbx,%rax)	# 13055	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L1401	# 13056	[c=13 l=2]  *jcc
+.L1400:
+	movq	1040(%rbx), %rdx	# 13060	[c=9 l=7]  *movdi_internal/3
+	movslq	%ebp, %rax	# 13059	[c=4 l=3]  *extendsidi2_rex64/1
+	movzbl	(%rdx,%rax), %eax	# 13061	[c=13 l=4]  *zero_extendqisi2/0
+.L1402:
+	orl	%eax, %r12d	# 13072	[c=4 l=3]  *iorsi_1/0
+	cmpl	%r12d, 992(%rbx)	# 13073	[c=13 l=7]  *cmpsi_1/0
+	jb	.L1958	# 13074	[c=13 l=2]  *jcc
+	movl	$61, %eax	# 13082	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%rbx), %eax	# 13083	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %eax	# 13084	[c=13 l=6]  *cmpsi_1/1
+	jb	.L1404	# 13085	[c=13 l=2]  *jcc
+	cmpb	$1, 1081(%rbx)	# 13089	[c=13 l=7]  *cmpqi_1/0
+	ja	.L1959	# 13090	[c=13 l=2]  *jcc
+.L1404:
+	movq	1040(%rbx), %rax	# 13101	[c=9 l=7]  *movdi_internal/3
+	movb	%bpl, 61(%rax)	# 13102	[c=4 l=4]  *movqi_internal/8
+.L1405:
+	movl	%ebp, %eax	# 15734	[c=4 l=2]  *movsi_internal/0
+	movl	$62, %edx	# 13106	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%rbx), %edx	# 13107	[c=13 l=6]  *subsi_1/1
+	sarl	$8, %eax	# 13105	[c=4 l=3]  *ashrsi3_1/0
+	cmpl	5180(%rbx), %edx	# 13108	[c=13 l=6]  *cmpsi_1/1
+	jb	.L1406	# 13109	[c=13 l=2]  *jcc
+	cmpb	$1, 1081(%rbx)	# 13113	[c=13 l=7]  *cmpqi_1/0
+	ja	.L1960	# 13114	[c=13 l=2]  *jcc
+.L1406:
+	movq	1040(%rbx), %rdx	# 13125	[c=9 l=7]  *movdi_internal/3
+	movb	%al, 62(%rdx)	# 13126	[c=4 l=3]  *movqi_internal/8
+	jmp	.L1387	# 18833	[c=1 l=5]  jump
+.L1401:
+	movl	%ebp, %esi	# 13066	[c=4 l=2]  *movsi_internal/0
+	movq	%rbx, %rdi	# 13067	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 13068	[c=10 l=5]  *call_value
+	jmp	.L1402	# 18835	[c=1 l=2]  jump
+.L1959:
+	movzbl	%bpl, %edx	# 13092	[c=4 l=4]  *zero_extendqisi2/0
+	movl	$61, %esi	# 13094	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 13095	[c=4 l=3]  *movdi_internal/3
+	call	data_write_mapped	# 13096	[c=0 l=5]  *call
+	jmp	.L1405	# 18837	[c=1 l=2]  jump
+.L1958:
+	movl	%r12d, %esi	# 13076	[c=4 l=3]  *movsi_internal/0
+	movq	%rbx, %rdi	# 13077	[c=4 l=3]  *movdi_internal/3
+	call	bad_PC	# 13078	[c=0 l=5]  *call
+.L1960:
+	movzbl	%al, %edx	# 13116	[c=4 l=3]  *zero_extendqisi2/0
+	movl	$62, %esi	# 13118	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 13119	[c=4 l=3]  *movdi_internal/3
+	call	data_write_mapped	# 13120	[c=0 l=5]  *call
+	jmp	.L1387	# 18839	[c=1 l=5]  jump
+.L1722:
+	leaq	.LC52(%rip), %rdx	# 9902	[c=1 l=7]  *movdi_internal/4
+	movl	$1, %esi	# 9904	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 9905	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 17652	[c=4 l=2]  *movdi_xor
+	call	leave	# 9907	[c=0 l=5]  *call
+.L1826:
+	movq	%rbx, %rdi	# 3820	[c=4 l=3]  *movdi_internal/3
+	call	bad_PC	# 3821	[c=0 l=5]  *call
+.L1825:
+	leaq	.LC52(%rip), %rdx	# 3753	[c=1 l=7]  *movdi_internal/4
+	movl	$1, %esi	# 3755	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 3756	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 17878	[c=4 l=2]  *movdi_xor
+	call	leave	# 3758	[c=0 l=5]  *call
+.L1824:
+	movl	%ebp, %ecx	# 3721	[c=4 l=2]  *movsi_internal/0
+	leaq	.LC52(%rip), %rdx	# 3722	[c=1 l=7]  *movdi_internal/4
+	movl	$1, %esi	# 3724	[c=4 l=5]  *movsi_internal/0
+	xorl	%eax, %eax	# 17880	[c=4 l=2]  *movdi_xor
+	movq	%rbx, %rdi	# 3725	[c=4 l=3]  *movdi_internal/3
+	call	leave	# 3727	[c=0 l=5]  *call
+.L1858:
+	leaq	.LC52(%rip), %rdx	# 9240	[c=1 l=7]  *movdi_internal/4
+	movl	$1, %esi	# 9242	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 9243	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 17674	[c=4 l=2]  *movdi_xor
+	call	leave	# 9245	[c=0 l=5]  *call
+.L1857:
+	leaq	.LC52(%rip), %rdx	# 9172	[c=1 l=7]  *movdi_internal/4
+	movl	$1, %esi	# 9174	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 9175	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 17675	[c=4 l=2]  *movdi_xor
+	call	leave	# 9177	[c=0 l=5]  *call
+.L1856:
+	leaq	.LC52(%rip), %rdx	# 9102	[c=1 l=7]  *movdi_internal/4
+	movl	$1, %esi	# 9104	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 9105	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 17676	[c=4 l=2]  *movdi_xor
+	call	leave	# 9107	[c=0 l=5]  *call
+.L1855:
+	leaq	.LC52(%rip), %rdx	# 9032	[c=1 l=7]  *movdi_internal/4
+	movl	$1, %esi	# 9034	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 9035	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 17677	[c=4 l=2]  *movdi_xor
+	call	leave	# 9037	[c=0 l=5]  *call
+.L1907:
+	movq	%rbx, %rdi	# 2555	[c=4 l=3]  *movdi_internal/3
+	call	bad_PC	# 2556	[c=0 l=5]  *call
+.L1828:
+	leaq	.LC52(%rip), %rdx	# 735	[c=1 l=7]  *movdi_internal/4
+	movl	$1, %esi	# 737	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 738	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 18006	[c=4 l=2]  *movdi_xor
+	call	leave	# 740	[c=0 l=5]  *call
+.L1821:
+	movl	%ebp, %ecx	# 3987	[c=4 l=2]  *movsi_internal/0
+	leaq	.LC52(%rip), %rdx	# 3988	[c=1 l=7]  *movdi_internal/4
+	movl	$1, %esi	# 3990	[c=4 l=5]  *movsi_internal/0
+	xorl	%eax, %eax	# 17869	[c=4 l=2]  *movdi_xor
+	movq	%rbx, %rdi	# 3991	[c=4 l=3]  *movdi_internal/3
+	call	leave	# 3993	[c=0 l=5]  *call
+.L1823:
+	movl	%ebp, %ecx	# 4109	[c=4 l=2]  *movsi_internal/0
+	leaq	.LC52(%rip), %rdx	# 4110	[c=1 l=7]  *movdi_internal/4
+	movl	$1, %esi	# 4112	[c=4 l=5]  *movsi_internal/0
+	xorl	%eax, %eax	# 17865	[c=4 l=2]  *movdi_xor
+	movq	%rbx, %rdi	# 4113	[c=4 l=3]  *movdi_internal/3
+	call	leave	# 4115	[c=0 l=5]  *call
+.L1388:
+	movq	1040(%rbx), %rax	# 12964	[c=9 l=7]  *movdi_internal/3
+	movzbl	61(%rax), %ebp	# 12965	[c=13 l=4]  *zero_extendqisi2/0
+	cmpl	%r12d, %r15d	# 12966	[c=4 l=3]  *cmpsi_1/0
+	jb	.L1390	# 12967	[c=13 l=6]  *jcc
+	cmpb	$1, 1081(%rbx)	# 12971	[c=13 l=7]  *cmpqi_1/0
+	jbe	.L1390	# 12972	[c=13 l=6]  *jcc
+.L1391:
+	movl	$62, %esi	# 12975	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 12976	[c=4 l=3]  *movdi_internal/3
+	call	data_read_mapped	# 12977	[c=10 l=5]  *call_value
+	jmp	.L1392	# 18841	[c=1 l=5]  jump
+.L1395:
+	movl	%ebp, %esi	# 13011	[c=4 l=2]  *movsi_internal/0
+	movq	%rbx, %rdi	# 13012	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 13013	[c=10 l=5]  *call_value
+	movl	%eax, %r15d	# 13014	[c=4 l=3]  *movsi_internal/0
+	jmp	.L1396	# 18843	[c=1 l=5]  jump
+.L1957:
+	movl	$61, %esi	# 12953	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 12954	[c=4 l=3]  *movdi_internal/3
+	call	data_read_mapped	# 12955	[c=10 l=5]  *call_value
+	movl	%eax, %ebp	# 12956	[c=4 l=2]  *movsi_internal/0
+	cmpl	%r12d, %r15d	# 12957	[c=4 l=3]  *cmpsi_1/0
+	jnb	.L1391	# 12958	[c=13 l=2]  *jcc
+	movq	1040(%rbx), %rax	# 13769	[c=9 l=7]  *movdi_internal/3
+	jmp	.L1390	# 18845	[c=1 l=5]  jump
+.L1398:
+	movq	%rbx, %rdi	# 13040	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 13041	[c=10 l=5]  *call_value
+	jmp	.L1399	# 18847	[c=1 l=5]  jump
+.L1760:
+	leaq	.LC52(%rip), %rdx	# 10923	[c=1 l=7]  *movdi_internal/4
+	movl	$1, %esi	# 10925	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 10926	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 17613	[c=4 l=2]  *movdi_xor
+	call	leave	# 10928	[c=0 l=5]  *call
+.L1881:
+	leaq	.LC52(%rip), %rdx	# 1398	[c=1 l=7]  *movdi_internal/4
+	movl	$1, %esi	# 1400	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 1401	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 17967	[c=4 l=2]  *movdi_xor
+	call	leave	# 1403	[c=0 l=5]  *call
+.L1898:
+	leaq	.LC52(%rip), %rdx	# 2169	[c=1 l=7]  *movdi_internal/4
+	movl	$1, %esi	# 2171	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 2172	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 17940	[c=4 l=2]  *movdi_xor
+	call	leave	# 2174	[c=0 l=5]  *call
+.L1897:
+	movl	%eax, %ecx	# 2151	[c=4 l=2]  *movsi_internal/0
+	leaq	.LC52(%rip), %rdx	# 2152	[c=1 l=7]  *movdi_internal/4
+	movq	%rbx, %rdi	# 2155	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 17941	[c=4 l=2]  *movdi_xor
+	movl	$1, %esi	# 2154	[c=4 l=5]  *movsi_internal/0
+	call	leave	# 2157	[c=0 l=5]  *call
+.L1802:
+	leaq	.LC52(%rip), %rdx	# 2860	[c=1 l=7]  *movdi_internal/4
+	movl	$1, %esi	# 2862	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 2863	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 17919	[c=4 l=2]  *movdi_xor
+	call	leave	# 2865	[c=0 l=5]  *call
+.L1801:
+	movl	%ebp, %ecx	# 2803	[c=4 l=2]  *movsi_internal/0
+	leaq	.LC52(%rip), %rdx	# 2804	[c=1 l=7]  *movdi_internal/4
+	movl	$1, %esi	# 2806	[c=4 l=5]  *movsi_internal/0
+	xorl	%eax, %eax	# 17921	[c=4 l=2]  *movdi_xor
+	movq	%rbx, %rdi	# 2807	[c=4 l=3]  *movdi_internal/3
+	call	leave	# 2809	[c=0 l=5]  *call
+.L1800:
+	leaq	.LC52(%rip), %rdx	# 4973	[c=1 l=7]  *movdi_internal/4
+	movl	$1, %esi	# 4975	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 4976	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 17821	[c=4 l=2]  *movdi_xor
+	call	leave	# 4978	[c=0 l=5]  *call
+.L1799:
+	movl	%eax, %ecx	# 4955	[c=4 l=2]  *movsi_internal/0
+	leaq	.LC52(%rip), %rdx	# 4956	[c=1 l=7]  *movdi_internal/4
+	movq	%rbx, %rdi	# 4959	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 17822	[c=4 l=2]  *movdi_xor
+	movl	$1, %esi	# 4958	[c=4 l=5]  *movsi_internal/0
+	call	leave	# 4961	[c=0 l=5]  *call
+.L1754:
+	leaq	.LC52(%rip), %rdx	# 6952	[c=1 l=7]  *movdi_internal/4
+	movl	$1, %esi	# 6954	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 6955	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 17752	[c=4 l=2]  *movdi_xor
+	call	leave	# 6957	[c=0 l=5]  *call
+.L1720:
+	movl	%ebp, %ecx	# 5308	[c=4 l=2]  *movsi_internal/0
+	leaq	.LC52(%rip), %rdx	# 5309	[c=1 l=7]  *movdi_internal/4
+	movl	$1, %esi	# 5311	[c=4 l=5]  *movsi_internal/0
+	xorl	%eax, %eax	# 17804	[c=4 l=2]  *movdi_xor
+	movq	%rbx, %rdi	# 5312	[c=4 l=3]  *movdi_internal/3
+	call	leave	# 5314	[c=0 l=5]  *call
+.L1710:
+	movl	%r14d, %ecx	# 6450	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC52(%rip), %rdx	# 6451	[c=1 l=7]  *movdi_internal/4
+	movq	%rbx, %rdi	# 6454	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 17771	[c=4 l=2]  *movdi_xor
+	movl	$1, %esi	# 6453	[c=4 l=5]  *movsi_internal/0
+	call	leave	# 6456	[c=0 l=5]  *call
+.L576:
+	leaq	.LC48(%rip), %rdx	# 463	[c=1 l=7]  *movdi_internal/4
+	movl	$1, %esi	# 465	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 466	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 18022	[c=4 l=2]  *movdi_xor
+	call	leave	# 468	[c=0 l=5]  *call
+.L1718:
+	leaq	.LC52(%rip), %rdx	# 7730	[c=1 l=7]  *movdi_internal/4
+	movl	$1, %esi	# 7732	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 7733	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 17719	[c=4 l=2]  *movdi_xor
+	call	leave	# 7735	[c=0 l=5]  *call
+.L1712:
+	leaq	.LC52(%rip), %rdx	# 3866	[c=1 l=7]  *movdi_internal/4
+	movl	$1, %esi	# 3868	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 3869	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 17873	[c=4 l=2]  *movdi_xor
+	call	leave	# 3871	[c=0 l=5]  *call
+.L1869:
+	leaq	.LC52(%rip), %rdx	# 8125	[c=1 l=7]  *movdi_internal/4
+	movl	$1, %esi	# 8127	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 8128	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 17705	[c=4 l=2]  *movdi_xor
+	call	leave	# 8130	[c=0 l=5]  *call
+.L1840:
+	leaq	.LC53(%rip), %rdx	# 6216	[c=1 l=7]  *movdi_internal/4
+	xorl	%esi, %esi	# 17786	[c=4 l=2]  *movdi_xor
+	movq	%rbx, %rdi	# 6219	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 17787	[c=4 l=2]  *movdi_xor
+	call	leave	# 6221	[c=0 l=5]  *call
+.L1886:
+	movl	%ebp, %esi	# 1647	[c=4 l=2]  *movsi_internal/0
+	movq	%rbx, %rdi	# 1648	[c=4 l=3]  *movdi_internal/3
+	call	bad_PC	# 1649	[c=0 l=5]  *call
+.L1693:
+	movl	%r10d, %ecx	# 646	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC52(%rip), %rdx	# 647	[c=1 l=7]  *movdi_internal/4
+	movq	%rbx, %rdi	# 650	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 18009	[c=4 l=2]  *movdi_xor
+	movl	$1, %esi	# 649	[c=4 l=5]  *movsi_internal/0
+	call	leave	# 652	[c=0 l=5]  *call
+.L1686:
+	leaq	.LC52(%rip), %rdx	# 1928	[c=1 l=7]  *movdi_internal/4
+	movl	$1, %esi	# 1930	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 1931	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 17950	[c=4 l=2]  *movdi_xor
+	call	leave	# 1933	[c=0 l=5]  *call
+.L1706:
+	movq	%rbx, %rdi	# 5406	[c=4 l=3]  *movdi_internal/3
+	call	stack_overflow	# 5407	[c=0 l=5]  *call
+.L1852:
+	leaq	.LC52(%rip), %rdx	# 5186	[c=1 l=7]  *movdi_internal/4
+	movl	$1, %esi	# 5188	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 5189	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 17808	[c=4 l=2]  *movdi_xor
+	call	leave	# 5191	[c=0 l=5]  *call
+.L1847:
+	movl	%edx, %ecx	# 6360	[c=4 l=2]  *movsi_internal/0
+	movl	$1, %esi	# 6363	[c=4 l=5]  *movsi_internal/0
+	leaq	.LC52(%rip), %rdx	# 6361	[c=1 l=7]  *movdi_internal/4
+	xorl	%eax, %eax	# 17777	[c=4 l=2]  *movdi_xor
+	movq	%rbx, %rdi	# 6364	[c=4 l=3]  *movdi_internal/3
+	call	leave	# 6366	[c=0 l=5]  *call
+.L1846:
+	leaq	.LC52(%rip), %rdx	# 6343	[c=1 l=7]  *movdi_internal/4
+	movl	$1, %esi	# 6345	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 6346	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 17778	[c=4 l=2]  *movdi_xor
+	call	leave	# 6348	[c=0 l=5]  *call
+.L1860:
+	movl	%eax, %ecx	# 9354	[c=4 l=2]  *movsi_internal/0
+	leaq	.LC52(%rip), %rdx	# 9355	[c=1 l=7]  *movdi_internal/4
+	movq	%rbx, %rdi	# 9358	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 17672	[c=4 l=2]  *movdi_xor
+	movl	$1, %esi	# 9357	[c=4 l=5]  *movsi_internal/0
+	call	leave	# 9360	[c=0 l=5]  *call
+.L1859:
+	leaq	.LC52(%rip), %rdx	# 9297	[c=1 l=7]  *movdi_internal/4
+	movl	$1, %esi	# 9299	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 9300	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 17673	[c=4 l=2]  *movdi_xor
+	call	leave	# 9302	[c=0 l=5]  *call
+.L1794:
+	movl	%edi, %ecx	# 12524	[c=4 l=2]  *movsi_internal/0
+	leaq	.LC52(%rip), %rdx	# 12525	[c=1 l=7]  *movdi_internal/4
+	movl	$1, %esi	# 12527	[c=4 l=5]  *movsi_internal/0
+	xorl	%eax, %eax	# 17572	[c=4 l=2]  *movdi_xor
+	movq	%rbx, %rdi	# 12528	[c=4 l=3]  *movdi_internal/3
+	call	leave	# 12530	[c=0 l=5]  *call
+.L1793:
+	leaq	.LC52(%rip), %rdx	# 12507	[c=1 l=7]  *movdi_internal/4
+	movl	$1, %esi	# 12509	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 12510	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 17573	[c=4 l=2]  *movdi_xor
+	call	leave	# 12512	[c=0 l=5]  *call
+.L1798:
+	leaq	.LC52(%rip), %rdx	# 4903	[c=1 l=7]  *movdi_internal/4
+	movl	$1, %esi	# 4905	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 4906	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 17829	[c=4 l=2]  *movdi_xor
+	call	leave	# 4908	[c=0 l=5]  *call
+.L1797:
+	movl	%eax, %ecx	# 4885	[c=4 l=2]  *movsi_internal/0
+	leaq	.LC52(%rip), %rdx	# 4886	[c=1 l=7]  *movdi_internal/4
+	movq	%rbx, %rdi	# 4889	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 17830	[c=4 l=2]  *movdi_xor
+	movl	$1, %esi	# 4888	[c=4 l=5]  *movsi_internal/0
+	call	leave	# 4891	[c=0 l=5]  *call
+.L1796:
+	leaq	.LC52(%rip), %rdx	# 4834	[c=1 l=7]  *movdi_internal/4
+	movl	$1, %esi	# 4836	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 4837	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 17834	[c=4 l=2]  *movdi_xor
+	call	leave	# 4839	[c=0 l=5]  *call
+.L1795:
+	movl	%eax, %ecx	# 4816	[c=4 l=2]  *movsi_internal/0
+	leaq	.LC52(%rip), %rdx	# 4817	[c=1 l=7]  *movdi_internal/4
+	movq	%rbx, %rdi	# 4820	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 17835	[c=4 l=2]  *movdi_xor
+	movl	$1, %esi	# 4819	[c=4 l=5]  *movsi_internal/0
+	call	leave	# 4822	[c=0 l=5]  *call
+.L1792:
+	movl	%eax, %ecx	# 12443	[c=4 l=2]  *movsi_internal/0
+	leaq	.LC52(%rip), %rdx	# 12444	[c=1 l=7]  *movdi_internal/4
+	movq	%rbx, %rdi	# 12447	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 17574	[c=4 l=2]  *movdi_xor
+	movl	$1, %esi	# 12446	[c=4 l=5]  *movsi_internal/0
+	call	leave	# 12449	[c=0 l=5]  *call
+.L1791:
+	leaq	.LC52(%rip), %rdx	# 12389	[c=1 l=7]  *movdi_internal/4
+	movl	$1, %esi	# 12391	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 12392	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 17575	[c=4 l=2]  *movdi_xor
+	call	leave	# 12394	[c=0 l=5]  *call
+.L1931:
+	leaq	.LC52(%rip), %rdx	# 4578	[c=1 l=7]  *movdi_internal/4
+	movl	$1, %esi	# 4580	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 4581	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 17847	[c=4 l=2]  *movdi_xor
+	call	leave	# 4583	[c=0 l=5]  *call
+.L1930:
+	movl	%r14d, %ecx	# 4525	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC52(%rip), %rdx	# 4526	[c=1 l=7]  *movdi_internal/4
+	movq	%rbx, %rdi	# 4529	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 17851	[c=4 l=2]  *movdi_xor
+	movl	$1, %esi	# 4528	[c=4 l=5]  *movsi_internal/0
+	call	leave	# 4531	[c=0 l=5]  *call
+.L1883:
+	movl	%r15d, %esi	# 1501	[c=4 l=3]  *movsi_internal/0
+	movq	%rbx, %rdi	# 1502	[c=4 l=3]  *movdi_internal/3
+	call	stack_overflow	# 1503	[c=0 l=5]  *call
+.L1836:
+	movl	%r14d, %esi	# 6110	[c=4 l=3]  *movsi_internal/0
+	movq	%rbx, %rdi	# 6111	[c=4 l=3]  *movdi_internal/3
+	call	bad_PC	# 6112	[c=0 l=5]  *call
+.L1807:
+	leaq	.LC52(%rip), %rdx	# 3210	[c=1 l=7]  *movdi_internal/4
+	movl	$1, %esi	# 3212	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 3213	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 17909	[c=4 l=2]  *movdi_xor
+	call	leave	# 3215	[c=0 l=5]  *call
+.L1806:
+	movl	%eax, %ecx	# 3192	[c=4 l=2]  *movsi_internal/0
+	leaq	.LC52(%rip), %rdx	# 3193	[c=1 l=7]  *movdi_internal/4
+	movq	%rbx, %rdi	# 3196	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 17910	[c=4 l=2]  *movdi_xor
+	movl	$1, %esi	# 3195	[c=4 l=5]  *movsi_internal/0
+	call	leave	# 3198	[c=0 l=5]  *call
+.L1850:
+	leaq	.LC52(%rip), %rdx	# 5107	[c=1 l=7]  *movdi_internal/4
+	movl	$1, %esi	# 5109	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 5110	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 17811	[c=4 l=2]  *movdi_xor
+	call	leave	# 5112	[c=0 l=5]  *call
+.L1868:
+	leaq	.LC52(%rip), %rdx	# 9753	[c=1 l=7]  *movdi_internal/4
+	movl	$1, %esi	# 9755	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 9756	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 17657	[c=4 l=2]  *movdi_xor
+	call	leave	# 9758	[c=0 l=5]  *call
+.L1867:
+	leaq	.LC52(%rip), %rdx	# 9688	[c=1 l=7]  *movdi_internal/4
+	movl	$1, %esi	# 9690	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 9691	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 17660	[c=4 l=2]  *movdi_xor
+	call	leave	# 9693	[c=0 l=5]  *call
+.L752:
+	xorl	%ecx, %ecx	# 17915	[c=4 l=2]  *movdi_xor
+	leaq	.LC52(%rip), %rdx	# 3060	[c=1 l=7]  *movdi_internal/4
+	movl	$1, %esi	# 3062	[c=4 l=5]  *movsi_internal/0
+	xorl	%eax, %eax	# 17916	[c=4 l=2]  *movdi_xor
+	movq	%rbx, %rdi	# 3063	[c=4 l=3]  *movdi_internal/3
+	call	leave	# 3065	[c=0 l=5]  *call
+.L1937:
+	leaq	.LC52(%rip), %rdx	# 4779	[c=1 l=7]  *movdi_internal/4
+	movl	$1, %esi	# 4781	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 4782	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 17837	[c=4 l=2]  *movdi_xor
+	call	leave	# 4784	[c=0 l=5]  *call
+.L1936:
+	movl	%eax, %ecx	# 4761	[c=4 l=2]  *movsi_internal/0
+	leaq	.LC52(%rip), %rdx	# 4762	[c=1 l=7]  *movdi_internal/4
+	movq	%rbx, %rdi	# 4765	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 17838	[c=4 l=2]  *movdi_xor
+	movl	$1, %esi	# 4764	[c=4 l=5]  *movsi_internal/0
+	call	leave	# 4767	[c=0 l=5]  *call
+.L1935:
+	leaq	.LC52(%rip), %rdx	# 4730	[c=1 l=7]  *movdi_internal/4
+	movl	$1, %esi	# 4732	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 4733	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 17840	[c=4 l=2]  *movdi_xor
+	call	leave	# 4735	[c=0 l=5]  *call
+.L1914:
+	leaq	.LC52(%rip), %rdx	# 7551	[c=1 l=7]  *movdi_internal/4
+	movl	$1, %esi	# 7553	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 7554	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 17725	[c=4 l=2]  *movdi_xor
+	call	leave	# 7556	[c=0 l=5]  *call
+.L1913:
+	movl	%ebp, %ecx	# 2741	[c=4 l=2]  *movsi_internal/0
+	leaq	.LC52(%rip), %rdx	# 2742	[c=1 l=7]  *movdi_internal/4
+	movl	$1, %esi	# 2744	[c=4 l=5]  *movsi_internal/0
+	xorl	%eax, %eax	# 17923	[c=4 l=2]  *movdi_xor
+	movq	%rbx, %rdi	# 2745	[c=4 l=3]  *movdi_internal/3
+	call	leave	# 2747	[c=0 l=5]  *call
+.L1901:
+	leaq	.LC52(%rip), %rdx	# 2230	[c=1 l=7]  *movdi_internal/4
+	movl	$1, %esi	# 2232	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 2233	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 17936	[c=4 l=2]  *movdi_xor
+	call	leave	# 2235	[c=0 l=5]  *call
+.L1902:
+	movl	(%rbx), %eax	# 15071	[c=5 l=2]  *movsi_internal/0
+	movq	1056(%rbx), %rdx	# 2315	[c=9 l=7]  *movdi_internal/3
+	movl	$1, %esi	# 2321	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 2322	[c=4 l=3]  *movdi_internal/3
+	movq	832(%rbx), %r8	# 2317	[c=9 l=7]  *movdi_internal/3
+	subl	$1, %eax	# 2310	[c=4 l=3]  *addsi_1/0
+	movl	%eax, (%rbx)	# 2311	[c=4 l=2]  *movsi_internal/1
+	addl	%eax, %eax	# 2313	[c=5 l=2]  *ashlsi3_1_zext/0
+	movzwl	(%rdx,%rax), %ecx	# 2316	[c=13 l=4]  *zero_extendhisi2/0
+	leaq	.LC44(%rip), %rdx	# 2319	[c=1 l=7]  *movdi_internal/4
+	xorl	%eax, %eax	# 17933	[c=4 l=2]  *movdi_xor
+	call	leave	# 2324	[c=0 l=5]  *call
+.L1934:
+	movl	%eax, %ecx	# 4712	[c=4 l=2]  *movsi_internal/0
+	leaq	.LC52(%rip), %rdx	# 4713	[c=1 l=7]  *movdi_internal/4
+	movq	%rbx, %rdi	# 4716	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 17841	[c=4 l=2]  *movdi_xor
+	movl	$1, %esi	# 4715	[c=4 l=5]  *movsi_internal/0
+	call	leave	# 4718	[c=0 l=5]  *call
+.L1786:
+	leaq	.LC52(%rip), %rdx	# 8945	[c=1 l=7]  *movdi_internal/4
+	movl	$1, %esi	# 8947	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 8948	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 17679	[c=4 l=2]  *movdi_xor
+	call	leave	# 8950	[c=0 l=5]  *call
+.L1785:
+	movl	%eax, %ecx	# 8926	[c=4 l=2]  *movsi_internal/0
+	leaq	.LC52(%rip), %rdx	# 8927	[c=1 l=7]  *movdi_internal/4
+	movq	%rbx, %rdi	# 8930	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 17680	[c=4 l=2]  *movdi_xor
+	movl	$1, %esi	# 8929	[c=4 l=5]  *movsi_internal/0
+	call	leave	# 8932	[c=0 l=5]  *call
+.L1784:
+	leaq	.LC52(%rip), %rdx	# 8858	[c=1 l=7]  *movdi_internal/4
+	movl	$1, %esi	# 8860	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 8861	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 17681	[c=4 l=2]  *movdi_xor
+	call	leave	# 8863	[c=0 l=5]  *call
+.L1783:
+	movl	%eax, %ecx	# 8839	[c=4 l=2]  *movsi_internal/0
+	leaq	.LC52(%rip), %rdx	# 8840	[c=1 l=7]  *movdi_internal/4
+	movq	%rbx, %rdi	# 8843	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 17682	[c=4 l=2]  *movdi_xor
+	movl	$1, %esi	# 8842	[c=4 l=5]  *movsi_internal/0
+	call	leave	# 8845	[c=0 l=5]  *call
+.L1782:
+	leaq	.LC52(%rip), %rdx	# 8771	[c=1 l=7]  *movdi_internal/4
+	movl	$1, %esi	# 8773	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 8774	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 17683	[c=4 l=2]  *movdi_xor
+	call	leave	# 8776	[c=0 l=5]  *call
+.L1781:
+	movl	%eax, %ecx	# 8752	[c=4 l=2]  *movsi_internal/0
+	leaq	.LC52(%rip), %rdx	# 8753	[c=1 l=7]  *movdi_internal/4
+	movq	%rbx, %rdi	# 8756	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 17684	[c=4 l=2]  *movdi_xor
+	movl	$1, %esi	# 8755	[c=4 l=5]  *movsi_internal/0
+	call	leave	# 8758	[c=0 l=5]  *call
+.L1780:
+	leaq	.LC52(%rip), %rdx	# 8684	[c=1 l=7]  *movdi_internal/4
+	movl	$1, %esi	# 8686	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 8687	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 17685	[c=4 l=2]  *movdi_xor
+	call	leave	# 8689	[c=0 l=5]  *call
+.L1779:
+	movl	%eax, %ecx	# 8665	[c=4 l=2]  *movsi_internal/0
+	leaq	.LC52(%rip), %rdx	# 8666	[c=1 l=7]  *movdi_internal/4
+	movq	%rbx, %rdi	# 8669	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 17686	[c=4 l=2]  *movdi_xor
+	movl	$1, %esi	# 8668	[c=4 l=5]  *movsi_internal/0
+	call	leave	# 8671	[c=0 l=5]  *call
+.L1778:
+	leaq	.LC52(%rip), %rdx	# 8597	[c=1 l=7]  *movdi_internal/4
+	movl	$1, %esi	# 8599	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 8600	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 17687	[c=4 l=2]  *movdi_xor
+	call	leave	# 8602	[c=0 l=5]  *call
+.L1684:
+	leaq	.LC52(%rip), %rdx	# 8527	[c=1 l=7]  *movdi_internal/4
+	movl	$1, %esi	# 8529	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 8530	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 17688	[c=4 l=2]  *movdi_xor
+	call	leave	# 8532	[c=0 l=5]  *call
+.L1683:
+	movl	%eax, %ecx	# 8508	[c=4 l=2]  *movsi_internal/0
+	leaq	.LC52(%rip), %rdx	# 8509	[c=1 l=7]  *movdi_internal/4
+	movq	%rbx, %rdi	# 8512	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 17689	[c=4 l=2]  *movdi_xor
+	movl	$1, %esi	# 8511	[c=4 l=5]  *movsi_internal/0
+	call	leave	# 8514	[c=0 l=5]  *call
+.L1822:
+	movl	%ebp, %ecx	# 4051	[c=4 l=2]  *movsi_internal/0
+	leaq	.LC52(%rip), %rdx	# 4052	[c=1 l=7]  *movdi_internal/4
+	movl	$1, %esi	# 4054	[c=4 l=5]  *movsi_internal/0
+	xorl	%eax, %eax	# 17867	[c=4 l=2]  *movdi_xor
+	movq	%rbx, %rdi	# 4055	[c=4 l=3]  *movdi_internal/3
+	call	leave	# 4057	[c=0 l=5]  *call
+.L1777:
+	leaq	.LC52(%rip), %rdx	# 12266	[c=1 l=7]  *movdi_internal/4
+	movl	$1, %esi	# 12268	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 12269	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 17577	[c=4 l=2]  *movdi_xor
+	call	leave	# 12271	[c=0 l=5]  *call
+.L1711:
+	leaq	.LC52(%rip), %rdx	# 8479	[c=1 l=7]  *movdi_internal/4
+	movl	$1, %esi	# 8481	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 8482	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 17690	[c=4 l=2]  *movdi_xor
+	call	leave	# 8484	[c=0 l=5]  *call
+.L1768:
+	movl	%r10d, %ecx	# 11282	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC52(%rip), %rdx	# 11283	[c=1 l=7]  *movdi_internal/4
+	movq	%rbx, %rdi	# 11286	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 17595	[c=4 l=2]  *movdi_xor
+	movl	$1, %esi	# 11285	[c=4 l=5]  *movsi_internal/0
+	call	leave	# 11288	[c=0 l=5]  *call
+.L1765:
+	movl	%eax, %ecx	# 11118	[c=4 l=2]  *movsi_internal/0
+	leaq	.LC52(%rip), %rdx	# 11119	[c=1 l=7]  *movdi_internal/4
+	movq	%rbx, %rdi	# 11122	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 17604	[c=4 l=2]  *movdi_xor
+	movl	$1, %esi	# 11121	[c=4 l=5]  *movsi_internal/0
+	call	leave	# 11124	[c=0 l=5]  *call
+.L1767:
+	movl	%r8d, %ecx	# 11212	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC52(%rip), %rdx	# 11213	[c=1 l=7]  *movdi_internal/4
+	movq	%rbx, %rdi	# 11216	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 17598	[c=4 l=2]  *movdi_xor
+	movl	$1, %esi	# 11215	[c=4 l=5]  *movsi_internal/0
+	call	leave	# 11218	[c=0 l=5]  *call
+.L1766:
+	movl	%r10d, %ecx	# 11194	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC52(%rip), %rdx	# 11195	[c=1 l=7]  *movdi_internal/4
+	movq	%rbx, %rdi	# 11198	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 17599	[c=4 l=2]  *movdi_xor
+	movl	$1, %esi	# 11197	[c=4 l=5]  *movsi_internal/0
+	call	leave	# 11200	[c=0 l=5]  *call
+.L1763:
+	movl	%edi, %ecx	# 11034	[c=4 l=2]  *movsi_internal/0
+	leaq	.LC52(%rip), %rdx	# 11035	[c=1 l=7]  *movdi_internal/4
+	movl	$1, %esi	# 11037	[c=4 l=5]  *movsi_internal/0
+	xorl	%eax, %eax	# 17606	[c=4 l=2]  *movdi_xor
+	movq	%rbx, %rdi	# 11038	[c=4 l=3]  *movdi_internal/3
+	call	leave	# 11040	[c=0 l=5]  *call
+.L1762:
+	movl	%r9d, %ecx	# 11016	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC52(%rip), %rdx	# 11017	[c=1 l=7]  *movdi_internal/4
+	movq	%rbx, %rdi	# 11020	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 17607	[c=4 l=2]  *movdi_xor
+	movl	$1, %esi	# 11019	[c=4 l=5]  *movsi_internal/0
+	call	leave	# 11022	[c=0 l=5]  *call
+.L1764:
+	leaq	.LC52(%rip), %rdx	# 11101	[c=1 l=7]  *movdi_internal/4
+	movl	$1, %esi	# 11103	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 11104	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 17605	[c=4 l=2]  *movdi_xor
+	call	leave	# 11106	[c=0 l=5]  *call
+.L1761:
+	movl	%edx, %ecx	# 10940	[c=4 l=2]  *movsi_internal/0
+	movl	$1, %esi	# 10943	[c=4 l=5]  *movsi_internal/0
+	leaq	.LC52(%rip), %rdx	# 10941	[c=1 l=7]  *movdi_internal/4
+	xorl	%eax, %eax	# 17612	[c=4 l=2]  *movdi_xor
+	movq	%rbx, %rdi	# 10944	[c=4 l=3]  *movdi_internal/3
+	call	leave	# 10946	[c=0 l=5]  *call
+.L1716:
+	leaq	.LC52(%rip), %rdx	# 11437	[c=1 l=7]  *movdi_internal/4
+	movl	$1, %esi	# 11439	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 11440	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 17590	[c=4 l=2]  *movdi_xor
+	call	leave	# 11442	[c=0 l=5]  *call
+.L1715:
+	movl	%eax, %ecx	# 11419	[c=4 l=2]  *movsi_internal/0
+	leaq	.LC52(%rip), %rdx	# 11420	[c=1 l=7]  *movdi_internal/4
+	movq	%rbx, %rdi	# 11423	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 17591	[c=4 l=2]  *movdi_xor
+	movl	$1, %esi	# 11422	[c=4 l=5]  *movsi_internal/0
+	call	leave	# 11425	[c=0 l=5]  *call
+.L1714:
+	leaq	.LC52(%rip), %rdx	# 11384	[c=1 l=7]  *movdi_internal/4
+	movl	$1, %esi	# 11386	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 11387	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 17592	[c=4 l=2]  *movdi_xor
+	call	leave	# 11389	[c=0 l=5]  *call
+.L1713:
+	movl	%eax, %ecx	# 11366	[c=4 l=2]  *movsi_internal/0
+	leaq	.LC52(%rip), %rdx	# 11367	[c=1 l=7]  *movdi_internal/4
+	movq	%rbx, %rdi	# 11370	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 17593	[c=4 l=2]  *movdi_xor
+	movl	$1, %esi	# 11369	[c=4 l=5]  *movsi_internal/0
+	call	leave	# 11372	[c=0 l=5]  *call
+.L1866:
+	leaq	.LC52(%rip), %rdx	# 9604	[c=1 l=7]  *movdi_internal/4
+	movl	$1, %esi	# 9606	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 9607	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 17662	[c=4 l=2]  *movdi_xor
+	call	leave	# 9609	[c=0 l=5]  *call
+.L1861:
+	leaq	.LC52(%rip), %rdx	# 9373	[c=1 l=7]  *movdi_internal/4
+	movl	$1, %esi	# 9375	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 9376	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 17671	[c=4 l=2]  *movdi_xor
+	call	leave	# 9378	[c=0 l=5]  *call
+.L1863:
+	movl	%edi, %ecx	# 9455	[c=4 l=2]  *movsi_internal/0
+	leaq	.LC52(%rip), %rdx	# 9456	[c=1 l=7]  *movdi_internal/4
+	movl	$1, %esi	# 9458	[c=4 l=5]  *movsi_internal/0
+	xorl	%eax, %eax	# 17667	[c=4 l=2]  *movdi_xor
+	movq	%rbx, %rdi	# 9459	[c=4 l=3]  *movdi_internal/3
+	call	leave	# 9461	[c=0 l=5]  *call
+.L1862:
+	leaq	.LC52(%rip), %rdx	# 9438	[c=1 l=7]  *movdi_internal/4
+	movl	$1, %esi	# 9440	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 9441	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 17668	[c=4 l=2]  *movdi_xor
+	call	leave	# 9443	[c=0 l=5]  *call
+.L1692:
+	movl	%edx, %ecx	# 10851	[c=4 l=2]  *movsi_internal/0
+	movl	$1, %esi	# 10854	[c=4 l=5]  *movsi_internal/0
+	leaq	.LC52(%rip), %rdx	# 10852	[c=1 l=7]  *movdi_internal/4
+	xorl	%eax, %eax	# 17614	[c=4 l=2]  *movdi_xor
+	movq	%rbx, %rdi	# 10855	[c=4 l=3]  *movdi_internal/3
+	call	leave	# 10857	[c=0 l=5]  *call
+.L1691:
+	leaq	.LC52(%rip), %rdx	# 10834	[c=1 l=7]  *movdi_internal/4
+	movl	$1, %esi	# 10836	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 10837	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 17615	[c=4 l=2]  *movdi_xor
+	call	leave	# 10839	[c=0 l=5]  *call
+.L1865:
+	leaq	.LC52(%rip), %rdx	# 9539	[c=1 l=7]  *movdi_internal/4
+	movl	$1, %esi	# 9541	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 9542	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 17665	[c=4 l=2]  *movdi_xor
+	call	leave	# 9544	[c=0 l=5]  *call
+.L1864:
+	movl	%eax, %ecx	# 9520	[c=4 l=2]  *movsi_internal/0
+	leaq	.LC52(%rip), %rdx	# 9521	[c=1 l=7]  *movdi_internal/4
+	movq	%rbx, %rdi	# 9524	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 17666	[c=4 l=2]  *movdi_xor
+	movl	$1, %esi	# 9523	[c=4 l=5]  *movsi_internal/0
+	call	leave	# 9526	[c=0 l=5]  *call
+.L1774:
+	leaq	.LC52(%rip), %rdx	# 12063	[c=1 l=7]  *movdi_internal/4
+	movl	$1, %esi	# 12065	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 12066	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 17580	[c=4 l=2]  *movdi_xor
+	call	leave	# 12068	[c=0 l=5]  *call
+.L1773:
+	leaq	.LC52(%rip), %rdx	# 12034	[c=1 l=7]  *movdi_internal/4
+	movl	$1, %esi	# 12036	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 12037	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 17581	[c=4 l=2]  *movdi_xor
+	call	leave	# 12039	[c=0 l=5]  *call
+.L1776:
+	movl	%ebp, %ecx	# 12214	[c=4 l=2]  *movsi_internal/0
+	leaq	.LC52(%rip), %rdx	# 12215	[c=1 l=7]  *movdi_internal/4
+	movl	$1, %esi	# 12217	[c=4 l=5]  *movsi_internal/0
+	xorl	%eax, %eax	# 17578	[c=4 l=2]  *movdi_xor
+	movq	%rbx, %rdi	# 12218	[c=4 l=3]  *movdi_internal/3
+	call	leave	# 12220	[c=0 l=5]  *call
+.L1775:
+	movl	%eax, %ecx	# 12117	[c=4 l=2]  *movsi_internal/0
+	leaq	.LC52(%rip), %rdx	# 12118	[c=1 l=7]  *movdi_internal/4
+	movq	%rbx, %rdi	# 12121	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 17579	[c=4 l=2]  *movdi_xor
+	movl	$1, %esi	# 12120	[c=4 l=5]  *movsi_internal/0
+	call	leave	# 12123	[c=0 l=5]  *call
+.L1771:
+	leaq	.LC52(%rip), %rdx	# 11911	[c=1 l=7]  *movdi_internal/4
+	movl	$1, %esi	# 11913	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 11914	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 17583	[c=4 l=2]  *movdi_xor
+	call	leave	# 11916	[c=0 l=5]  *call
+.L1717:
+	movl	%r14d, %ecx	# 11870	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC52(%rip), %rdx	# 11871	[c=1 l=7]  *movdi_internal/4
+	movq	%rbx, %rdi	# 11874	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 17584	[c=4 l=2]  *movdi_xor
+	movl	$1, %esi	# 11873	[c=4 l=5]  *movsi_internal/0
+	call	leave	# 11876	[c=0 l=5]  *call
+.L1772:
+	movl	%ebp, %ecx	# 11972	[c=4 l=2]  *movsi_internal/0
+	leaq	.LC52(%rip), %rdx	# 11973	[c=1 l=7]  *movdi_internal/4
+	movl	$1, %esi	# 11975	[c=4 l=5]  *movsi_internal/0
+	xorl	%eax, %eax	# 17582	[c=4 l=2]  *movdi_xor
+	movq	%rbx, %rdi	# 11976	[c=4 l=3]  *movdi_internal/3
+	call	leave	# 11978	[c=0 l=5]  *call
+.L1770:
+	movl	%r14d, %ecx	# 11811	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC52(%rip), %rdx	# 11812	[c=1 l=7]  *movdi_internal/4
+	movq	%rbx, %rdi	# 11815	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 17585	[c=4 l=2]  *movdi_xor
+	movl	$1, %esi	# 11814	[c=4 l=5]  *movsi_internal/0
+	call	leave	# 11817	[c=0 l=5]  *call
+	.cfi_endproc
+.LFE221:
+	.size	execute, .-execute
+	.section	.rodata.str1.1
+.LC57:
+	.string	"flash"
+.LC58:
+	.string	"EEPROM"
+.LC59:
+	.string	"decoded flash"
+.LC60:
+	.string	"atmega64"
+.LC61:
+	.string	"atmega128"
+	.section	.rodata.str1.8
+	.align 8
+.LC62:
+	.string	"entry point 0x%x is outside the flash of %s"
+	.text
+	.p2align 4
+	.type	run_context, @function
+run_context:
+.LFB226:
+	.cfi_startproc
+	pushq	%r13	# 824	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 16
+	.cfi_offset 13, -16
+	pushq	%r12	# 825	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 24
+	.cfi_offset 12, -24
+	pushq	%rbp	# 826	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 32
+	.cfi_offset 6, -32
+	pushq	%rbx	# 827	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 40
+	.cfi_offset 3, -40
+	subq	$248, %rsp	# 828	[c=4 l=7]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_def_cfa_offset 288
+	movq	%rdi, (%rsp)	# 2	[c=4 l=4]  *movdi_internal/5
+	leaq	32(%rsp), %rdi	# 22	[c=4 l=5]  *leadi
+	movl	%esi, 12(%rsp)	# 3	[c=4 l=4]  *movsi_internal/1
+	movq	%rdx, 16(%rsp)	# 4	[c=4 l=5]  *movdi_internal/5
+	call	_setjmp@PLT	# 24	[c=10 l=5]  *call_value
+	testl	%eax, %eax	# 31	[c=4 l=2]  *cmpsi_ccno_1/0
+	je	.L2021	# 32	[c=13 l=6]  *jcc
+	movq	(%rsp), %rbx	# 782	[c=5 l=4]  *movdi_internal/3
+	movq	$0, 128(%rbx)	# 481	[c=4 l=11]  *movdi_internal/5
+	movq	%rbx, %rdi	# 482	[c=4 l=3]  *movdi_internal/3
+	call	eeprom_finish@PLT	# 483	[c=0 l=5]  *call
+	movq	%rbx, %rdi	# 485	[c=4 l=3]  *movdi_internal/3
+	call	jit_free@PLT	# 486	[c=0 l=5]  *call
+	movq	984(%rbx), %rdi	# 488	[c=9 l=7]  *movdi_internal/3
+	testq	%rdi, %rdi	# 489	[c=4 l=3]  *cmpdi_ccno_1/0
+	jne	.L1997	# 490	[c=13 l=2]  *jcc
+	jmp	.L2003	# 884	[c=1 l=2]  jump
+	.p2align 4,,10
+	.p2align 3
+.L2022:
+	movq	%rax, (%rdx)	# 512	[c=4 l=3]  *movdi_internal/5
+.L2000:
+	testq	%rax, %rax	# 520	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L2001	# 521	[c=13 l=2]  *jcc
+	movq	%rdx, 8(%rax)	# 523	[c=4 l=4]  *movdi_internal/5
+.L2001:
+	call	free@PLT	# 536	[c=0 l=5]  *call
+	movq	(%rsp), %rax	# 750	[c=5 l=4]  *movdi_internal/3
+	movq	984(%rax), %rdi	# 537	[c=9 l=7]  *movdi_internal/3
+	testq	%rdi, %rdi	# 538	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L2003	# 539	[c=13 l=2]  *jcc
+.L1997:
+	movq	16(%rdi), %rax	# 497	[c=9 l=4]  *movdi_internal/3
+	testq	%rax, %rax	# 498	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L1998	# 499	[c=13 l=2]  *jcc
+	movq	%rax, %rdi	# 501	[c=4 l=3]  *movdi_internal/3
+	call	fclose@PLT	# 502	[c=10 l=5]  *call_value
+	movq	(%rsp), %rax	# 747	[c=5 l=4]  *movdi_internal/3
+	movq	984(%rax), %rdi	# 504	[c=9 l=7]  *movdi_internal/3
+.L1998:
+	movq	8(%rdi), %rdx	# 507	[c=9 l=4]  *movdi_internal/3
+	movq	(%rdi), %rax	# 508	[c=5 l=3]  *movdi_internal/3
+	testq	%rdx, %rdx	# 509	[c=4 l=3]  *cmpdi_ccno_1/0
+	jne	.L2022	# 510	[c=13 l=2]  *jcc
+	movq	(%rsp), %rcx	# 748	[c=5 l=4]  *movdi_internal/3
+	movq	%rax, 984(%rcx)	# 517	[c=4 l=7]  *movdi_internal/5
+	jmp	.L2000	# 887	[c=1 l=2]  jump
+	.p2align 4,,10
+	.p2align 3
+.L2003:
+	movq	(%rsp), %rax	# 746	[c=5 l=4]  *movdi_internal/3
+	movl	136(%rax), %eax	# 492	[c=9 l=6]  *movsi_internal/0
+	addq	$248, %rsp	# 831	[c=4 l=7]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	popq	%rbx	# 832	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 32
+	popq	%rbp	# 833	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 24
+	popq	%r12	# 834	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 16
+	popq	%r13	# 835	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 8
+	ret		# 836	[c=0 l=1]  simple_return_internal
+.L2021:
+	.cfi_restore_state
+	movq	(%rsp), %rbx	# 754	[c=5 l=4]  *movdi_internal/3
+	leaq	32(%rsp), %rax	# 34	[c=4 l=5]  *leadi
+	xorl	%esi, %esi	# 881	[c=4 l=2]  *movdi_xor
+	movl	$1, %r13d	# 6	[c=4 l=6]  *movsi_internal/0
+	movq	%rax, 128(%rbx)	# 35	[c=4 l=7]  *movdi_internal/5
+	leaq	920(%rbx), %rdi	# 815	[c=4 l=7]  *leadi
+	call	gettimeofday@PLT	# 39	[c=10 l=5]  *call_value
+	movq	16(%rsp), %rdx	# 40	[c=9 l=5]  *movdi_internal/3
+	movl	12(%rsp), %esi	# 41	[c=9 l=4]  *movsi_internal/0
+	movq	%rbx, %rdi	# 42	[c=4 l=3]  *movdi_internal/3
+	call	parse_args@PLT	# 43	[c=0 l=5]  *call
+	movq	%rbx, %rdi	# 45	[c=4 l=3]  *movdi_internal/3
+	call	replay_open@PLT	# 46	[c=0 l=5]  *call
+	movl	880(%rbx), %eax	# 48	[c=9 l=6]  *movsi_internal/0
+.L1964:
+	movl	%r13d, %r12d	# 50	[c=4 l=3]  *movsi_internal/0
+	addl	%r13d, %r13d	# 51	[c=4 l=3]  *ashlsi3_1/0
+	cmpl	%eax, %r13d	# 53	[c=4 l=3]  *cmpsi_1/0
+	jb	.L1964	# 54	[c=13 l=2]  *jcc
+	leal	-1(%r12), %eax	# 813	[c=4 l=5]  *leasi
+	movl	$1, %edi	# 66	[c=4 l=5]  *movdi_internal/2
+	movd	%eax, %xmm0	# 687	[c=4 l=4]  *movsi_internal/13
+	movq	(%rsp), %rax	# 757	[c=5 l=4]  *movdi_internal/3
+	movl	872(%rax), %esi	# 57	[c=9 l=6]  *movsi_internal/0
+	movl	876(%rax), %ecx	# 60	[c=9 l=6]  *movsi_internal/0
+	movd	%esi, %xmm1	# 690	[c=4 l=4]  *movsi_internal/13
+	movl	%ecx, 1000(%rax)	# 61	[c=4 l=6]  *movsi_internal/1
+	movl	%esi, 24(%rsp)	# 689	[c=4 l=4]  *movsi_internal/1
+	punpckldq	%xmm1, %xmm0	# 58	[c=4 l=4]  *vec_concatv2si/0
+	leal	1(%rcx), %esi	# 814	[c=5 l=3]  *leadi
+	movq	%xmm0, 992(%rax)	# 59	[c=4 l=9]  *movv2si_internal/14
+	movq	%rsi, %rbx	# 820	[c=4 l=3]  *movdi_internal/3
+	addq	$32, %rsi	# 64	[c=4 l=4]  *adddi_1/0
+	call	calloc@PLT	# 67	[c=10 l=5]  *call_value
+	movq	%rax, %rbp	# 68	[c=4 l=3]  *movdi_internal/3
+	testq	%rax, %rax	# 70	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L2023	# 71	[c=13 l=6]  *jcc
+	xorl	%esi, %esi	# 879	[c=4 l=2]  *movdi_xor
+	movq	%rsi, 8(%rax)	# 880	[c=4 l=4]  *movdi_internal/5
+	movq	(%rsp), %rax	# 694	[c=5 l=4]  *movdi_internal/3
+	movq	984(%rax), %rax	# 86	[c=9 l=7]  *movdi_internal/3
+	movq	%rax, 0(%rbp)	# 87	[c=4 l=4]  *movdi_internal/5
+	testq	%rax, %rax	# 88	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L1966	# 89	[c=13 l=2]  *jcc
+	movq	%rbp, 8(%rax)	# 91	[c=4 l=4]  *movdi_internal/5
+.L1966:
+	movq	(%rsp), %rsi	# 758	[c=5 l=4]  *movdi_internal/3
+	leaq	32(%rbp), %rax	# 812	[c=4 l=4]  *leadi
+	movl	$1, %edi	# 101	[c=4 l=5]  *movdi_internal/2
+	movq	%rbp, 984(%rsi)	# 94	[c=4 l=7]  *movdi_internal/5
+	movq	%rax, 1040(%rsi)	# 96	[c=4 l=7]  *movdi_internal/5
+	leal	2(%r13), %esi	# 919	[c=5 l=4]  *leadi
+	movq	%rsi, %r13	# 821	[c=4 l=3]  *movdi_internal/3
+	addq	$32, %rsi	# 99	[c=4 l=4]  *adddi_1/0
+	call	calloc@PLT	# 102	[c=10 l=5]  *call_value
+	movq	%rax, %rbx	# 103	[c=4 l=3]  *movdi_internal/3
+	testq	%rax, %rax	# 105	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L2024	# 106	[c=13 l=6]  *jcc
+	movq	(%rsp), %rsi	# 760	[c=5 l=4]  *movdi_internal/3
+	xorl	%ecx, %ecx	# 876	[c=4 l=2]  *movdi_xor
+	movq	%rbp, (%rax)	# 121	[c=4 l=3]  *movdi_internal/5
+	movl	$1, %edi	# 131	[c=4 l=5]  *movdi_internal/2
+	movq	%rcx, 8(%rax)	# 877	[c=4 l=4]  *movdi_internal/5
+	movl	884(%rsi), %ecx	# 126	[c=9 l=6]  *movsi_internal/0
+	movq	%rax, 8(%rbp)	# 122	[c=4 l=4]  *movdi_internal/5
+	movq	%rax, 984(%rsi)	# 123	[c=4 l=7]  *movdi_internal/5
+	leaq	32(%rax), %rax	# 811	[c=4 l=4]  *leadi
+	movq	%rax, 1056(%rsi)	# 125	[c=4 l=7]  *movdi_internal/5
+	testl	%ecx, %ecx	# 679	[c=4 l=2]  *cmpsi_ccno_1/0
+	movl	$1, %eax	# 682	[c=4 l=5]  *movsi_internal/0
+	cmovne	%ecx, %eax	# 680	[c=8 l=3]  *movsicc_noc/0
+	movl	%eax, %esi	# 701	[c=1 l=2]  *zero_extendsidi2/3
+	movq	%rsi, %r13	# 822	[c=4 l=3]  *movdi_internal/3
+	addq	$32, %rsi	# 129	[c=4 l=4]  *adddi_1/0
+	call	calloc@PLT	# 132	[c=10 l=5]  *call_value
+	leaq	.LC58(%rip), %r9	# 138	[c=1 l=7]  *movdi_internal/4
+	movq	%rax, %rbp	# 133	[c=4 l=3]  *movdi_internal/3
+	testq	%rax, %rax	# 135	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L2020	# 136	[c=13 l=6]  *jcc
+	movq	(%rsp), %rsi	# 761	[c=5 l=4]  *movdi_internal/3
+	xorl	%edx, %edx	# 874	[c=4 l=2]  *movdi_xor
+	movq	%rbx, (%rax)	# 151	[c=4 l=3]  *movdi_internal/5
+	movl	$1, %edi	# 160	[c=4 l=5]  *movdi_internal/2
+	movq	%rdx, 8(%rax)	# 875	[c=4 l=4]  *movdi_internal/5
+	movq	%rax, 8(%rbx)	# 152	[c=4 l=4]  *movdi_internal/5
+	movq	%rax, 984(%rsi)	# 153	[c=4 l=7]  *movdi_internal/5
+	leaq	32(%rax), %rax	# 810	[c=4 l=4]  *leadi
+	movq	%rax, 1048(%rsi)	# 155	[c=4 l=7]  *movdi_internal/5
+	movl	%r12d, %esi	# 156	[c=1 l=3]  *zero_extendsidi2/3
+	salq	$4, %rsi	# 157	[c=4 l=4]  *ashldi3_1/0
+	addq	$32, %rsi	# 158	[c=4 l=4]  *adddi_1/0
+	call	calloc@PLT	# 161	[c=10 l=5]  *call_value
+	movq	%rax, %rbx	# 162	[c=4 l=3]  *movdi_internal/3
+	testq	%rax, %rax	# 164	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L2025	# 165	[c=13 l=6]  *jcc
+	movq	(%rsp), %rsi	# 763	[c=5 l=4]  *movdi_internal/3
+	xorl	%eax, %eax	# 872	[c=4 l=2]  *movdi_xor
+	movq	%rbp, (%rbx)	# 180	[c=4 l=3]  *movdi_internal/5
+	movq	%rax, 8(%rbx)	# 873	[c=4 l=4]  *movdi_internal/5
+	leaq	32(%rbx), %rax	# 809	[c=4 l=4]  *leadi
+	cmpb	$0, 844(%rsi)	# 185	[c=13 l=7]  *cmpqi_ccno_1/1
+	movq	%rbx, 8(%rbp)	# 181	[c=4 l=4]  *movdi_internal/5
+	movq	%rbx, 984(%rsi)	# 182	[c=4 l=7]  *movdi_internal/5
+	movq	%rax, 1064(%rsi)	# 184	[c=4 l=7]  *movdi_internal/5
+	jne	.L2026	# 186	[c=13 l=6]  *jcc
+.L1970:
+	movq	(%rsp), %rbx	# 765	[c=5 l=4]  *movdi_internal/3
+	movq	%rbx, %rdi	# 215	[c=4 l=3]  *movdi_internal/3
+	call	periph_init@PLT	# 216	[c=0 l=5]  *call
+	leaq	1080(%rbx), %rdi	# 808	[c=4 l=7]  *leadi
+	xorl	%edx, %edx	# 871	[c=4 l=2]  *movdi_xor
+	movl	$31, %eax	# 8	[c=4 l=5]  *movsi_internal/0
+	movq	%rdi, %rcx	# 219	[c=4 l=3]  *movdi_internal/3
+.L1979:
+	movq	(%rsp), %rsi	# 710	[c=5 l=4]  *movdi_internal/3
+	movl	1000(%rsi), %r8d	# 221	[c=9 l=7]  *movsi_internal/0
+	xorl	%esi, %esi	# 870	[c=4 l=2]  *movdi_xor
+	cmpl	%eax, %r8d	# 222	[c=4 l=3]  *cmpsi_1/0
+	jnb	.L1972	# 223	[c=13 l=2]  *jcc
+	cmpl	%edx, %r8d	# 586	[c=4 l=3]  *cmpsi_1/0
+	sbbl	%esi, %esi	# 587	[c=8 l=2]  *x86_movsicc_0_m1
+	andl	$4, %esi	# 806	[c=4 l=3]  *andsi_1/0
+	addl	$1, %esi	# 807	[c=4 l=3]  *addsi_1/0
+.L1972:
+	movb	%sil, (%rcx)	# 231	[c=4 l=3]  *movqi_internal/8
+	movq	%rcx, %r8	# 230	[c=4 l=3]  *movdi_internal/3
+	cmpl	$16383, %edx	# 236	[c=4 l=6]  *cmpsi_1/0
+	jbe	.L1973	# 237	[c=13 l=2]  *jcc
+	cmpl	$32767, %eax	# 242	[c=4 l=5]  *cmpsi_1/0
+	ja	.L1973	# 243	[c=13 l=2]  *jcc
+	movq	(%rsp), %rsi	# 711	[c=5 l=4]  *movdi_internal/3
+	movb	$2, (%rcx)	# 245	[c=4 l=3]  *movqi_internal/8
+	cmpb	$0, 844(%rsi)	# 246	[c=13 l=7]  *cmpqi_ccno_1/1
+	je	.L2018	# 247	[c=13 l=2]  *jcc
+	cmpl	%edx, 1000(%rsi)	# 265	[c=13 l=6]  *cmpsi_1/0
+	jnb	.L2018	# 266	[c=13 l=2]  *jcc
+	movb	$4, (%rcx)	# 268	[c=4 l=3]  *movqi_internal/8
+	addl	$32, %eax	# 269	[c=4 l=3]  *addsi_1/0
+	addl	$32, %edx	# 270	[c=4 l=3]  *addsi_1/0
+	addq	$1, %rcx	# 271	[c=4 l=4]  *adddi_1/0
+	jmp	.L1979	# 893	[c=1 l=2]  jump
+.L1973:
+	movq	(%rsp), %rsi	# 766	[c=5 l=4]  *movdi_internal/3
+	cmpb	$0, 844(%rsi)	# 277	[c=13 l=7]  *cmpqi_ccno_1/1
+	je	.L1978	# 278	[c=13 l=2]  *jcc
+	cmpl	%edx, 1000(%rsi)	# 282	[c=13 l=6]  *cmpsi_1/0
+	jnb	.L1978	# 283	[c=13 l=2]  *jcc
+	cmpl	$65535, %eax	# 288	[c=4 l=5]  *cmpsi_1/0
+	ja	.L1978	# 289	[c=13 l=2]  *jcc
+	movb	$4, (%r8)	# 291	[c=4 l=4]  *movqi_internal/8
+.L2018:
+	addl	$32, %eax	# 292	[c=4 l=3]  *addsi_1/0
+	addl	$32, %edx	# 293	[c=4 l=3]  *addsi_1/0
+	addq	$1, %rcx	# 294	[c=4 l=4]  *adddi_1/0
+	jmp	.L1979	# 895	[c=1 l=5]  jump
+.L1978:
+	addl	$32, %eax	# 255	[c=4 l=3]  *addsi_1/0
+	addl	$32, %edx	# 256	[c=4 l=3]  *addsi_1/0
+	addq	$1, %rcx	# 257	[c=4 l=4]  *adddi_1/0
+	cmpl	$131103, %eax	# 258	[c=4 l=5]  *cmpsi_1/0
+	jne	.L1979	# 259	[c=13 l=6]  *jcc
+	movq	(%rsp), %rax	# 715	[c=5 l=4]  *movdi_internal/3
+	movb	$1, 1081(%rax)	# 302	[c=4 l=7]  *movqi_internal/8
+	xorl	%eax, %eax	# 869	[c=4 l=2]  *movdi_xor
+	jmp	.L1980	# 897	[c=1 l=2]  jump
+.L1982:
+	movq	(%rsp), %rsi	# 716	[c=5 l=4]  *movdi_internal/3
+	cmpb	$0, 6568(%rsi,%rax)	# 306	[c=14 l=8]  *cmpqi_ccno_1/1
+	je	.L1981	# 307	[c=13 l=2]  *jcc
+	shrl	$5, %edx	# 309	[c=5 l=3]  *lshrsi3_1_zext/0
+	movb	$1, (%rdi,%rdx)	# 311	[c=4 l=4]  *movqi_internal/8
+.L1981:
+	addq	$1, %rax	# 314	[c=4 l=4]  *adddi_1/0
+.L1980:
+	movq	(%rsp), %rsi	# 717	[c=5 l=4]  *movdi_internal/3
+	movl	%eax, %edx	# 317	[c=4 l=2]  *movsi_internal/0
+	cmpl	6564(%rsi), %eax	# 319	[c=13 l=6]  *cmpsi_1/1
+	jb	.L1982	# 320	[c=13 l=2]  *jcc
+	movl	1000(%rsi), %eax	# 322	[c=9 l=6]  *movsi_internal/0
+	movl	%eax, 28(%rsp)	# 719	[c=4 l=4]  *movsi_internal/1
+	addl	$1, %eax	# 323	[c=4 l=3]  *addsi_1/0
+	movl	%eax, %edx	# 721	[c=4 l=2]  *movsi_internal/0
+	shrl	$5, %edx	# 324	[c=4 l=3]  *lshrsi3_1/0
+	jmp	.L1984	# 899	[c=1 l=2]  jump
+.L2027:
+	leal	-1(%rdx), %esi	# 805	[c=5 l=3]  *leadi
+	cmpb	$0, (%rdi,%rsi)	# 332	[c=13 l=4]  *cmpqi_ccno_1/1
+	movq	%rsi, %rcx	# 823	[c=4 l=3]  *movdi_internal/3
+	jne	.L1983	# 333	[c=13 l=2]  *jcc
+	movl	%ecx, %edx	# 13	[c=4 l=2]  *movsi_internal/0
+.L1984:
+	testl	%edx, %edx	# 326	[c=4 l=2]  *cmpsi_ccno_1/0
+	jne	.L2027	# 327	[c=13 l=2]  *jcc
+.L1983:
+	movq	(%rsp), %rsi	# 768	[c=5 l=4]  *movdi_internal/3
+	sall	$5, %edx	# 336	[c=4 l=3]  *ashlsi3_1/0
+	andl	$-32, %eax	# 338	[c=4 l=3]  *andsi_1/0
+	subl	%edx, %eax	# 339	[c=4 l=2]  *subsi_1/0
+	movl	%edx, 5176(%rsi)	# 337	[c=4 l=6]  *movsi_internal/1
+	movl	880(%rsi), %edx	# 341	[c=9 l=6]  *movsi_internal/0
+	movl	%eax, 5180(%rsi)	# 340	[c=4 l=6]  *movsi_internal/1
+	movl	$64, %eax	# 14	[c=4 l=5]  *movsi_internal/0
+	cmpl	$8192, %edx	# 344	[c=4 l=6]  *cmpsi_1/0
+	jbe	.L1985	# 345	[c=13 l=2]  *jcc
+	cmpl	$32769, %edx	# 606	[c=4 l=6]  *cmpsi_1/0
+	sbbl	%eax, %eax	# 607	[c=8 l=2]  *x86_movsicc_0_m1
+	andl	$-128, %eax	# 608	[c=4 l=3]  *andsi_1/0
+	addl	$256, %eax	# 609	[c=4 l=5]  *addsi_1/0
+.L1985:
+	movq	(%rsp), %rsi	# 769	[c=5 l=4]  *movdi_internal/3
+	movl	%eax, 6044(%rsi)	# 354	[c=4 l=6]  *movsi_internal/1
+	movq	856(%rsi), %rbx	# 355	[c=9 l=7]  *movdi_internal/3
+	leaq	.LC60(%rip), %rsi	# 357	[c=1 l=7]  *movdi_internal/4
+	movq	%rbx, %rdi	# 359	[c=4 l=3]  *movdi_internal/3
+	call	strcmp@PLT	# 360	[c=10 l=5]  *call_value
+	movl	%eax, %edx	# 637	[c=4 l=2]  *movsi_internal/0
+	movl	$104, %eax	# 18	[c=4 l=5]  *movsi_internal/0
+	testl	%edx, %edx	# 362	[c=4 l=2]  *cmpsi_ccno_1/0
+	je	.L1986	# 363	[c=13 l=2]  *jcc
+	leaq	.LC61(%rip), %rsi	# 366	[c=1 l=7]  *movdi_internal/4
+	movq	%rbx, %rdi	# 368	[c=4 l=3]  *movdi_internal/3
+	call	strcmp@PLT	# 369	[c=10 l=5]  *call_value
+	cmpl	$1, %eax	# 620	[c=4 l=3]  *cmpsi_1/0
+	sbbl	%eax, %eax	# 621	[c=8 l=2]  *x86_movsicc_0_m1
+	andl	$49, %eax	# 622	[c=4 l=3]  *andsi_1/0
+	addl	$55, %eax	# 623	[c=4 l=3]  *addsi_1/0
+.L1986:
+	movq	(%rsp), %rsi	# 775	[c=5 l=4]  *movdi_internal/3
+	leaq	6060(%rsi), %rdi	# 804	[c=4 l=7]  *leadi
+	movl	%eax, 6048(%rsi)	# 376	[c=4 l=6]  *movsi_internal/1
+	movl	%esi, %eax	# 732	[c=4 l=2]  *movsi_internal/0
+	movq	$-1, 6052(%rsi)	# 382	[c=4 l=11]  *movdi_internal/5
+	andq	$-8, %rdi	# 388	[c=4 l=4]  *anddi_1/1
+	movq	$-1, 6556(%rsi)	# 386	[c=4 l=11]  *movdi_internal/5
+	subl	%edi, %eax	# 389	[c=4 l=2]  *subsi_1/0
+	leal	6564(%rax), %ecx	# 390	[c=4 l=6]  *leasi
+	orq	$-1, %rax	# 868	[c=4 l=4]  *movdi_or
+	shrl	$3, %ecx	# 392	[c=5 l=3]  *lshrsi3_1_zext/0
+	rep stosq	# 394	[c=0 l=3]  *rep_stosdi_rex64
+	movl	(%rsi), %eax	# 395	[c=5 l=2]  *movsi_internal/0
+	cmpl	%eax, 992(%rsi)	# 396	[c=13 l=6]  *cmpsi_1/0
+	jb	.L2028	# 397	[c=13 l=6]  *jcc
+	movq	(%rsp), %rax	# 736	[c=5 l=4]  *movdi_internal/3
+	cmpl	$0, 232(%rax)	# 411	[c=13 l=7]  *cmpsi_ccno_1/1
+	jne	.L2029	# 412	[c=13 l=6]  *jcc
+.L1988:
+	movq	(%rsp), %rbx	# 776	[c=5 l=4]  *movdi_internal/3
+	movq	%rbx, %rdi	# 420	[c=4 l=3]  *movdi_internal/3
+	call	checkpoint_open@PLT	# 421	[c=0 l=5]  *call
+	cmpl	$0, 424(%rbx)	# 423	[c=13 l=7]  *cmpsi_ccno_1/1
+	jne	.L1991	# 424	[c=13 l=2]  *jcc
+	movq	(%rsp), %rdi	# 432	[c=5 l=4]  *movdi_internal/3
+	call	load_to_flash@PLT	# 433	[c=0 l=5]  *call
+.L1991:
+	movq	(%rsp), %rbx	# 778	[c=5 l=4]  *movdi_internal/3
+	movq	%rbx, %rdi	# 426	[c=4 l=3]  *movdi_internal/3
+	call	eeprom_open@PLT	# 427	[c=0 l=5]  *call
+	movq	%rbx, %rdi	# 439	[c=4 l=3]  *movdi_internal/3
+	call	checkpoint_resume@PLT	# 440	[c=0 l=5]  *call
+	cmpl	$0, 232(%rbx)	# 442	[c=13 l=7]  *cmpsi_ccno_1/1
+	jne	.L2030	# 443	[c=13 l=2]  *jcc
+.L1992:
+	movq	(%rsp), %rax	# 741	[c=5 l=4]  *movdi_internal/3
+	cmpl	$0, 424(%rax)	# 451	[c=13 l=7]  *cmpsi_ccno_1/1
+	jne	.L1995	# 452	[c=13 l=2]  *jcc
+	movq	(%rsp), %rdi	# 460	[c=5 l=4]  *movdi_internal/3
+	call	decode_flash@PLT	# 461	[c=0 l=5]  *call
+.L1995:
+	movq	(%rsp), %rbx	# 779	[c=5 l=4]  *movdi_internal/3
+	movq	%rbx, %rdi	# 454	[c=4 l=3]  *movdi_internal/3
+	call	fork_server_open@PLT	# 455	[c=0 l=5]  *call
+	cmpl	$0, 232(%rbx)	# 467	[c=13 l=7]  *cmpsi_ccno_1/1
+	jne	.L2031	# 468	[c=13 l=6]  *jcc
+.L1996:
+	movq	(%rsp), %rdi	# 476	[c=5 l=4]  *movdi_internal/3
+	call	execute	# 477	[c=0 l=5]  *call
+.L2026:
+	movl	$32800, %esi	# 188	[c=4 l=5]  *movdi_internal/2
+	movl	$1, %edi	# 189	[c=4 l=5]  *movdi_internal/2
+	call	calloc@PLT	# 190	[c=10 l=5]  *call_value
+	testq	%rax, %rax	# 193	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L2032	# 194	[c=13 l=6]  *jcc
+	movq	(%rsp), %rsi	# 764	[c=5 l=4]  *movdi_internal/3
+	movq	%rbx, (%rax)	# 208	[c=4 l=3]  *movdi_internal/5
+	movq	%rax, 8(%rbx)	# 209	[c=4 l=4]  *movdi_internal/5
+	movq	%rax, 984(%rsi)	# 210	[c=4 l=7]  *movdi_internal/5
+	addq	$32, %rax	# 211	[c=4 l=4]  *adddi_1/0
+	movq	%rax, 1072(%rsi)	# 212	[c=4 l=7]  *movdi_internal/5
+	jmp	.L1970	# 907	[c=1 l=5]  jump
+.L2030:
+	movq	(%rsp), %rax	# 740	[c=5 l=4]  *movdi_internal/3
+	xorl	%esi, %esi	# 865	[c=4 l=2]  *movdi_xor
+	leaq	952(%rax), %rdi	# 801	[c=4 l=7]  *leadi
+	call	gettimeofday@PLT	# 448	[c=10 l=5]  *call_value
+	jmp	.L1992	# 909	[c=1 l=5]  jump
+.L2025:
+	leaq	.LC59(%rip), %r9	# 167	[c=1 l=7]  *movdi_internal/4
+	movl	$16, %r8d	# 168	[c=4 l=6]  *movsi_internal/0
+	movl	%r12d, %ecx	# 169	[c=4 l=3]  *movsi_internal/0
+.L2019:
+	movq	(%rsp), %rdi	# 114	[c=5 l=4]  *movdi_internal/3
+	leaq	.LC4(%rip), %rdx	# 111	[c=1 l=7]  *movdi_internal/4
+	movl	$6, %esi	# 113	[c=4 l=5]  *movsi_internal/0
+	xorl	%eax, %eax	# 878	[c=4 l=2]  *movdi_xor
+	call	leave	# 116	[c=0 l=5]  *call
+.L2024:
+	leaq	.LC57(%rip), %r9	# 108	[c=1 l=7]  *movdi_internal/4
+.L2020:
+	movl	$1, %r8d	# 109	[c=4 l=6]  *movsi_internal/0
+	movl	%r13d, %ecx	# 110	[c=4 l=3]  *movsi_internal/0
+	jmp	.L2019	# 911	[c=1 l=2]  jump
+.L2023:
+	leaq	.LC40(%rip), %r9	# 73	[c=1 l=7]  *movdi_internal/4
+	movl	$1, %r8d	# 74	[c=4 l=6]  *movsi_internal/0
+	movl	%ebx, %ecx	# 75	[c=4 l=2]  *movsi_internal/0
+	jmp	.L2019	# 913	[c=1 l=2]  jump
+.L2028:
+	movq	(%rsp), %rdi	# 405	[c=5 l=4]  *movdi_internal/3
+	leal	(%rax,%rax), %ecx	# 803	[c=12 l=3]  *leasi
+	movq	%rbx, %r8	# 400	[c=4 l=3]  *movdi_internal/3
+	movl	$5, %esi	# 404	[c=4 l=5]  *movsi_internal/0
+	leaq	.LC62(%rip), %rdx	# 402	[c=1 l=7]  *movdi_internal/4
+	xorl	%eax, %eax	# 867	[c=4 l=2]  *movdi_xor
+	call	leave	# 407	[c=0 l=5]  *call
+.L2032:
+	movq	(%rsp), %rdi	# 202	[c=5 l=4]  *movdi_internal/3
+	movl	$8, %r8d	# 197	[c=4 l=6]  *movsi_internal/0
+	leaq	.LC37(%rip), %r9	# 196	[c=1 l=7]  *movdi_internal/4
+	movl	$4096, %ecx	# 198	[c=4 l=5]  *movsi_internal/0
+	leaq	.LC4(%rip), %rdx	# 199	[c=1 l=7]  *movdi_internal/4
+	movl	$6, %esi	# 201	[c=4 l=5]  *movsi_internal/0
+	call	leave	# 204	[c=0 l=5]  *call
+.L2029:
+	leaq	936(%rax), %rdi	# 802	[c=4 l=7]  *leadi
+	xorl	%esi, %esi	# 866	[c=4 l=2]  *movdi_xor
+	call	gettimeofday@PLT	# 417	[c=10 l=5]  *call_value
+	jmp	.L1988	# 915	[c=1 l=5]  jump
+.L2031:
+	movq	(%rsp), %rax	# 743	[c=5 l=4]  *movdi_internal/3
+	xorl	%esi, %esi	# 864	[c=4 l=2]  *movdi_xor
+	leaq	968(%rax), %rdi	# 800	[c=4 l=7]  *leadi
+	call	gettimeofday@PLT	# 473	[c=10 l=5]  *call_value
+	jmp	.L1996	# 917	[c=1 l=5]  jump
+	.cfi_endproc
+.LFE226:
+	.size	run_context, .-run_context
+	.p2align 4
+	.globl	put_mem
+	.type	put_mem, @function
+put_mem:
+.LFB63:
+	.cfi_startproc
+	testq	%rsi, %rsi	# 7	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L2033	# 8	[c=13 l=2]  *jcc
+	movq	-24(%rsi), %rdx	# 11	[c=9 l=4]  *movdi_internal/3
+	movq	-32(%rsi), %rax	# 12	[c=9 l=4]  *movdi_internal/3
+	leaq	-32(%rsi), %rcx	# 48	[c=4 l=4]  *leadi
+	testq	%rdx, %rdx	# 13	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L2035	# 14	[c=13 l=2]  *jcc
+	movq	%rax, (%rdx)	# 16	[c=4 l=3]  *movdi_internal/5
+.L2036:
+	testq	%rax, %rax	# 24	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L2037	# 25	[c=13 l=2]  *jcc
+	movq	%rdx, 8(%rax)	# 27	[c=4 l=4]  *movdi_internal/5
+.L2037:
+	movq	%rcx, %rdi	# 30	[c=4 l=3]  *movdi_internal/3
+	jmp	free@PLT	# 31	[c=0 l=5]  *sibcall
+	.p2align 4,,10
+	.p2align 3
+.L2033:
+	ret		# 51	[c=0 l=1]  simple_return_internal
+	.p2align 4,,10
+	.p2align 3
+.L2035:
+	movq	%rax, 984(%rdi)	# 21	[c=4 l=7]  *movdi_internal/5
+	jmp	.L2036	# 53	[c=1 l=2]  jump
+	.cfi_endproc
+.LFE63:
+	.size	put_mem, .-put_mem
+	.section	.rodata.str1.1
+.LC63:
+	.string	"out of memory opening %s"
+	.text
+	.p2align 4
+	.globl	get_file
+	.type	get_file, @function
+get_file:
+.LFB64:
+	.cfi_startproc
+	pushq	%r12	# 73	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	movq	%rsi, %r12	# 3	[c=4 l=3]  *movdi_internal/3
+	movq	%rdx, %rsi	# 4	[c=4 l=3]  *movdi_internal/3
+	pushq	%rbp	# 74	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	movq	%rdi, %rbp	# 2	[c=4 l=3]  *movdi_internal/3
+	movq	%r12, %rdi	# 9	[c=4 l=3]  *movdi_internal/3
+	pushq	%rbx	# 75	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	call	fopen@PLT	# 10	[c=10 l=5]  *call_value
+	movq	%rax, %rbx	# 11	[c=4 l=3]  *movdi_internal/3
+	testq	%rax, %rax	# 13	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L2041	# 14	[c=13 l=2]  *jcc
+	movl	$32, %esi	# 16	[c=4 l=5]  *movdi_internal/2
+	movl	$1, %edi	# 17	[c=4 l=5]  *movdi_internal/2
+	call	calloc@PLT	# 18	[c=10 l=5]  *call_value
+	testq	%rax, %rax	# 21	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L2052	# 22	[c=13 l=2]  *jcc
+	movq	984(%rbp), %rdx	# 38	[c=9 l=7]  *movdi_internal/3
+	movq	%rbx, 16(%rax)	# 36	[c=4 l=4]  *movdi_internal/5
+	movq	$0, 8(%rax)	# 37	[c=4 l=8]  *movdi_internal/5
+	movq	%rdx, (%rax)	# 39	[c=4 l=3]  *movdi_internal/5
+	testq	%rdx, %rdx	# 40	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L2044	# 41	[c=13 l=2]  *jcc
+	movq	%rax, 8(%rdx)	# 43	[c=4 l=4]  *movdi_internal/5
+.L2044:
+	movq	%rax, 984(%rbp)	# 46	[c=4 l=7]  *movdi_internal/5
+.L2041:
+	movq	%rbx, %rax	# 52	[c=4 l=3]  *movdi_internal/3
+	popq	%rbx	# 78	[c=9 l=1]  *popdi1
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbp	# 79	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 16
+	popq	%r12	# 80	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 8
+	ret		# 81	[c=0 l=1]  simple_return_internal
+.L2052:
+	.cfi_restore_state
+	movq	%rbx, %rdi	# 24	[c=4 l=3]  *movdi_internal/3
+	call	fclose@PLT	# 25	[c=10 l=5]  *call_value
+	movq	%r12, %rcx	# 26	[c=4 l=3]  *movdi_internal/3
+	movl	$6, %esi	# 29	[c=4 l=5]  *movsi_internal/0
+	movq	%rbp, %rdi	# 30	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC63(%rip), %rdx	# 27	[c=1 l=7]  *movdi_internal/4
+	xorl	%eax, %eax	# 85	[c=4 l=2]  *movdi_xor
+	call	leave	# 32	[c=0 l=5]  *call
+	.cfi_endproc
+.LFE64:
+	.size	get_file, .-get_file
+	.p2align 4
+	.globl	put_file
+	.type	put_file, @function
+put_file:
+.LFB65:
+	.cfi_startproc
+	pushq	%rbx	# 79	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	movq	984(%rdi), %rax	# 7	[c=9 l=7]  *movdi_internal/3
+	movq	%rsi, %rbx	# 3	[c=4 l=3]  *movdi_internal/3
+	testq	%rax, %rax	# 8	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L2054	# 9	[c=13 l=2]  *jcc
+	movq	%rdi, %rcx	# 85	[c=4 l=3]  *movdi_internal/3
+	jmp	.L2059	# 90	[c=1 l=2]  jump
+	.p2align 4,,10
+	.p2align 3
+.L2055:
+	testq	%rax, %rax	# 42	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L2054	# 43	[c=13 l=2]  *jcc
+.L2059:
+	movq	16(%rax), %rdx	# 11	[c=9 l=4]  *movdi_internal/3
+	movq	%rax, %rdi	# 12	[c=4 l=3]  *movdi_internal/3
+	movq	(%rax), %rax	# 13	[c=5 l=3]  *movdi_internal/3
+	cmpq	%rbx, %rdx	# 14	[c=4 l=3]  *cmpdi_1/0
+	jne	.L2055	# 15	[c=13 l=2]  *jcc
+	movq	8(%rdi), %rdx	# 17	[c=9 l=4]  *movdi_internal/3
+	testq	%rdx, %rdx	# 18	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L2056	# 19	[c=13 l=2]  *jcc
+	movq	%rax, (%rdx)	# 21	[c=4 l=3]  *movdi_internal/5
+.L2057:
+	testq	%rax, %rax	# 29	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L2058	# 30	[c=13 l=2]  *jcc
+	movq	%rdx, 8(%rax)	# 32	[c=4 l=4]  *movdi_internal/5
+.L2058:
+	call	free@PLT	# 36	[c=0 l=5]  *call
+.L2054:
+	movq	%rbx, %rdi	# 46	[c=4 l=3]  *movdi_internal/3
+	popq	%rbx	# 88	[c=9 l=1]  *popdi1
+	.cfi_remember_state
+	.cfi_def_cfa_offset 8
+	jmp	fclose@PLT	# 47	[c=10 l=5]  *sibcall_value
+	.p2align 4,,10
+	.p2align 3
+.L2056:
+	.cfi_restore_state
+	movq	%rax, 984(%rcx)	# 26	[c=4 l=7]  *movdi_internal/5
+	jmp	.L2057	# 92	[c=1 l=2]  jump
+	.cfi_endproc
+.LFE65:
+	.size	put_file, .-put_file
+	.p2align 4
+	.globl	write_checkpoint
+	.type	write_checkpoint, @function
+write_checkpoint:
+.LFB213:
+	.cfi_startproc
+	pushq	%rbx	# 15	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	movq	%rdi, %rbx	# 2	[c=4 l=3]  *movdi_internal/3
+	call	checkpoint_begin@PLT	# 7	[c=0 l=5]  *call
+	movq	%rbx, %rdi	# 8	[c=4 l=3]  *movdi_internal/3
+	popq	%rbx	# 22	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 8
+	jmp	checkpoint_end@PLT	# 9	[c=0 l=5]  *sibcall
+	.cfi_endproc
+.LFE213:
+	.size	write_checkpoint, .-write_checkpoint
+	.section	.text.startup,"ax",@progbits
+	.p2align 4
+	.globl	main
+	.type	main, @function
+main:
+.LFB227:
+	.cfi_startproc
+	pushq	%r13	# 53	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 16
+	.cfi_offset 13, -16
+	movl	$11112, %edx	# 15	[c=4 l=5]  *movdi_internal/2
+	pushq	%r12	# 54	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 24
+	.cfi_offset 12, -24
+	movq	%rsi, %r12	# 3	[c=4 l=3]  *movdi_internal/3
+	xorl	%esi, %esi	# 74	[c=4 l=2]  *movdi_xor
+	pushq	%rbp	# 55	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 32
+	.cfi_offset 6, -32
+	movl	%edi, %ebp	# 2	[c=4 l=2]  *movsi_internal/0
+	pushq	%rbx	# 56	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 40
+	.cfi_offset 3, -40
+	leaq	cx.3(%rip), %rbx	# 12	[c=1 l=7]  *movdi_internal/4
+	movq	%rbx, %rdi	# 17	[c=4 l=3]  *movdi_internal/3
+	subq	$24, %rsp	# 57	[c=4 l=4]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_def_cfa_offset 64
+	movq	stderr(%rip), %r13	# 7	[c=6 l=7]  *movdi_internal/3
+	movq	stdin(%rip), %xmm0	# 48	[c=6 l=9]  *movdi_internal/14
+	movhps	stdout(%rip), %xmm0	# 10	[c=4 l=7]  vec_concatv2di/7
+	movaps	%xmm0, (%rsp)	# 51	[c=4 l=4]  movv2di_internal/3
+	call	memset@PLT	# 18	[c=10 l=5]  *call_value
+	movdqa	(%rsp), %xmm0	# 52	[c=9 l=5]  movv2di_internal/2
+	leaq	100(%rbx), %rax	# 23	[c=4 l=4]  *leadi
+	movq	%rbx, %rdi	# 31	[c=4 l=3]  *movdi_internal/3
+	movq	%r13, 912+cx.3(%rip)	# 29	[c=4 l=7]  *movdi_internal/5
+	movq	%rax, 104+cx.3(%rip)	# 50	[c=4 l=7]  *movdi_internal/5
+	movl	$-1, 10896+cx.3(%rip)	# 25	[c=4 l=10]  *movsi_internal/1
+	movaps	%xmm0, 896+cx.3(%rip)	# 27	[c=4 l=7]  movv2di_internal/3
+	call	events_init@PLT	# 32	[c=0 l=5]  *call
+	addq	$24, %rsp	# 68	[c=4 l=4]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_def_cfa_offset 40
+	movq	%r12, %rdx	# 33	[c=4 l=3]  *movdi_internal/3
+	movl	%ebp, %esi	# 34	[c=4 l=2]  *movsi_internal/0
+	movq	%rbx, %rdi	# 36	[c=4 l=3]  *movdi_internal/3
+	popq	%rbx	# 69	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 32
+	popq	%rbp	# 70	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 24
+	popq	%r12	# 71	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 16
+	popq	%r13	# 72	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 8
+	jmp	run_context	# 37	[c=10 l=5]  *sibcall_value
+	.cfi_endproc
+.LFE227:
+	.size	main, .-main
+	.section	.rodata.str1.1
+.LC64:
+	.string	"%s: out of memory\n"
+	.text
+	.p2align 4
+	.globl	job_main
+	.type	job_main, @function
+job_main:
+.LFB228:
+	.cfi_startproc
+	pushq	%r15	# 70	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	movq	%rdx, %r15	# 4	[c=4 l=3]  *movdi_internal/3
+	pushq	%r14	# 71	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	movq	%rcx, %r14	# 5	[c=4 l=3]  *movdi_internal/3
+	pushq	%r13	# 72	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	movq	%r9, %r13	# 7	[c=4 l=3]  *movdi_internal/3
+	pushq	%r12	# 73	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	movq	%r8, %r12	# 6	[c=4 l=3]  *movdi_internal/3
+	pushq	%rbp	# 74	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	movq	%rsi, %rbp	# 3	[c=4 l=3]  *movdi_internal/3
+	movl	$1, %esi	# 12	[c=4 l=5]  *movdi_internal/2
+	pushq	%rbx	# 75	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$24, %rsp	# 76	[c=4 l=4]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_def_cfa_offset 80
+	movl	%edi, 12(%rsp)	# 2	[c=4 l=4]  *movsi_internal/1
+	movl	$11112, %edi	# 13	[c=4 l=5]  *movdi_internal/2
+	call	calloc@PLT	# 14	[c=10 l=5]  *call_value
+	testq	%rax, %rax	# 17	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L2076	# 18	[c=13 l=2]  *jcc
+	movq	%rax, %rbx	# 87	[c=4 l=3]  *movdi_internal/3
+	leaq	100(%rax), %rax	# 69	[c=4 l=4]  *leadi
+	movl	$0, 0(%r13)	# 30	[c=4 l=8]  *movsi_internal/1
+	pxor	%xmm0, %xmm0	# 31	[c=4 l=4]  movv2di_internal/0
+	movq	%rax, 104(%rbx)	# 35	[c=4 l=4]  *movdi_internal/5
+	movq	%rbx, %rdi	# 40	[c=4 l=3]  *movdi_internal/3
+	movq	$0, 24(%r13)	# 33	[c=4 l=8]  *movdi_internal/5
+	movl	$-1, 10896(%rbx)	# 36	[c=4 l=10]  *movsi_internal/1
+	movq	%r15, 896(%rbx)	# 37	[c=4 l=7]  *movdi_internal/5
+	movq	%r14, 904(%rbx)	# 38	[c=4 l=7]  *movdi_internal/5
+	movq	%r12, 912(%rbx)	# 39	[c=4 l=7]  *movdi_internal/5
+	movups	%xmm0, 8(%r13)	# 32	[c=4 l=5]  movv2di_internal/3
+	call	events_init@PLT	# 41	[c=0 l=5]  *call
+	movl	12(%rsp), %esi	# 44	[c=9 l=4]  *movsi_internal/0
+	movq	%rbp, %rdx	# 43	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rdi	# 45	[c=4 l=3]  *movdi_internal/3
+	movq	%r13, 11016(%rbx)	# 42	[c=4 l=7]  *movdi_internal/5
+	call	run_context	# 46	[c=10 l=5]  *call_value
+	movq	%rbx, %rdi	# 48	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, %ebp	# 47	[c=4 l=2]  *movsi_internal/0
+	call	free@PLT	# 49	[c=0 l=5]  *call
+.L2072:
+	addq	$24, %rsp	# 79	[c=4 l=4]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	movl	%ebp, %eax	# 55	[c=4 l=2]  *movsi_internal/0
+	popq	%rbx	# 80	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 48
+	popq	%rbp	# 81	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 40
+	popq	%r12	# 82	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 32
+	popq	%r13	# 83	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 24
+	popq	%r14	# 84	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 16
+	popq	%r15	# 85	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 8
+	ret		# 86	[c=0 l=1]  simple_return_internal
+.L2076:
+	.cfi_restore_state
+	movq	0(%rbp), %rdx	# 20	[c=5 l=4]  *movdi_internal/3
+	leaq	.LC64(%rip), %rsi	# 21	[c=1 l=7]  *movdi_internal/4
+	movq	%r12, %rdi	# 23	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 91	[c=4 l=2]  *movdi_xor
+	movl	$20, %ebp	# 9	[c=4 l=5]  *movsi_internal/0
+	call	fprintf@PLT	# 25	[c=10 l=5]  *call_value
+	jmp	.L2072	# 93	[c=1 l=2]  jump
+	.cfi_endproc
+.LFE228:
+	.size	job_main, .-job_main
+	.section	.rodata
+	.align 16
+	.type	CSWTCH.175, @object
+	.size	CSWTCH.175, 20
+CSWTCH.175:
+	.long	1
+	.long	0
+	.long	2
+	.long	0
+	.long	3
+	.align 16
+	.type	se.0, @object
+	.size	se.0, 24
+se.0:
+	.value	83
+	.byte	1
+	.zero	1
+	.value	85
+	.byte	32
+	.zero	1
+	.value	85
+	.byte	64
+	.zero	1
+	.value	85
+	.byte	-128
+	.zero	1
+	.value	58
+	.byte	1
+	.zero	1
+	.value	72
+	.byte	1
+	.zero	1
+	.section	.data.rel.ro.local,"aw"
+	.align 32
+	.type	fused.1, @object
+	.size	fused.1, 328
+fused.1:
+	.quad	.L1149
+	.quad	.L1151
+	.quad	.L1156
+	.quad	.L1160
+	.quad	.L1163
+	.quad	.L1168
+	.quad	.L1173
+	.quad	.L1176
+	.quad	.L1179
+	.quad	.L1183
+	.quad	.L1187
+	.quad	.L1191
+	.quad	.L1195
+	.quad	.L1202
+	.quad	.L1209
+	.quad	.L1215
+	.quad	.L1221
+	.quad	.L1230
+	.quad	.L1234
+	.quad	.L1238
+	.quad	.L1240
+	.quad	.L1242
+	.quad	.L1243
+	.quad	.L1244
+	.quad	.L1248
+	.quad	.L1253
+	.quad	.L1258
+	.quad	.L1267
+	.quad	.L1280
+	.quad	.L1283
+	.quad	.L1286
+	.quad	.L1301
+	.quad	.L1303
+	.quad	.L1308
+	.quad	.L1313
+	.quad	.L1318
+	.quad	.L1323
+	.quad	.L1325
+	.quad	.L1333
+	.quad	.L1342
+	.quad	.L1357
+	.align 32
+	.type	handler.2, @object
+	.size	handler.2, 896
+handler.2:
+	.quad	.L560
+	.quad	.L561
+	.quad	.L565
+	.quad	.L566
+	.quad	.L583
+	.quad	.L588
+	.quad	.L593
+	.quad	.L594
+	.quad	.L595
+	.quad	.L600
+	.quad	.L604
+	.quad	.L608
+	.quad	.L609
+	.quad	.L611
+	.quad	.L614
+	.quad	.L617
+	.quad	.L620
+	.quad	.L621
+	.quad	.L623
+	.quad	.L646
+	.quad	.L655
+	.quad	.L657
+	.quad	.L662
+	.quad	.L665
+	.quad	.L669
+	.quad	.L674
+	.quad	.L679
+	.quad	.L683
+	.quad	.L684
+	.quad	.L711
+	.quad	.L718
+	.quad	.L720
+	.quad	.L725
+	.quad	.L733
+	.quad	.L738
+	.quad	.L762
+	.quad	.L765
+	.quad	.L768
+	.quad	.L771
+	.quad	.L794
+	.quad	.L797
+	.quad	.L802
+	.quad	.L806
+	.quad	.L809
+	.quad	.L811
+	.quad	.L817
+	.quad	.L823
+	.quad	.L828
+	.quad	.L833
+	.quad	.L838
+	.quad	.L843
+	.quad	.L848
+	.quad	.L853
+	.quad	.L858
+	.quad	.L863
+	.quad	.L868
+	.quad	.L869
+	.quad	.L871
+	.quad	.L873
+	.quad	.L877
+	.quad	.L880
+	.quad	.L883
+	.quad	.L886
+	.quad	.L889
+	.quad	.L892
+	.quad	.L896
+	.quad	.L897
+	.quad	.L902
+	.quad	.L906
+	.quad	.L911
+	.quad	.L913
+	.quad	.L928
+	.quad	.L950
+	.quad	.L972
+	.quad	.L994
+	.quad	.L997
+	.quad	.L1001
+	.quad	.L1004
+	.quad	.L1006
+	.quad	.L1015
+	.quad	.L1021
+	.quad	.L1027
+	.quad	.L1033
+	.quad	.L1039
+	.quad	.L1043
+	.quad	.L1047
+	.quad	.L1051
+	.quad	.L1055
+	.quad	.L1060
+	.quad	.L1061
+	.quad	.L1067
+	.quad	.L1073
+	.quad	.L1078
+	.quad	.L1083
+	.quad	.L1088
+	.quad	.L1093
+	.quad	.L1098
+	.quad	.L1103
+	.quad	.L1108
+	.quad	.L1113
+	.quad	.L1118
+	.quad	.L1123
+	.quad	.L1127
+	.quad	.L1129
+	.quad	.L1130
+	.quad	.L1133
+	.quad	.L1137
+	.quad	.L1141
+	.quad	.L1145
+	.quad	.L1146
+	.quad	.L1147
+	.quad	.L1148
+	.local	cx.3
+	.comm	cx.3,11112,32
+	.globl	opcodes
+	.section	.rodata.str1.1
+.LC65:
+	.string	"bad PC"
+.LC66:
+	.string	"ILLEGAL"
+.LC67:
+	.string	""
+.LC68:
+	.string	"*** SYSCALL"
+.LC69:
+	.string	"ADC"
+.LC70:
+	.string	"ADD"
+.LC71:
+	.string	"ADIW"
+.LC72:
+	.string	"SBIW"
+.LC73:
+	.string	"AND"
+.LC74:
+	.string	"ANDI"
+.LC75:
+	.string	"ASR"
+.LC76:
+	.string	"CL*"
+.LC77:
+	.string	"BLD.*"
+.LC78:
+	.string	"BREAK"
+.LC79:
+	.string	"BR*C"
+.LC80:
+	.string	"BR*S"
+.LC81:
+	.string	"SE*"
+.LC82:
+	.string	"BST.*"
+.LC83:
+	.string	"CALL"
+.LC84:
+	.string	"CBI.*"
+.LC85:
+	.string	"COM"
+.LC86:
+	.string	"CP"
+.LC87:
+	.string	"CPC"
+.LC88:
+	.string	"CPI"
+.LC89:
+	.string	"CPSE"
+.LC90:
+	.string	"DEC"
+.LC91:
+	.string	"DES"
+.LC92:
+	.string	"EICALL"
+.LC93:
+	.string	"EIJMP"
+.LC94:
+	.string	"ELPM"
+.LC95:
+	.string	"ELPM Z"
+.LC96:
+	.string	"ELPM Z+"
+.LC97:
+	.string	"EOR"
+.LC98:
+	.string	"ESPM"
+.LC99:
+	.string	"FMUL"
+.LC100:
+	.string	"FMULS"
+.LC101:
+	.string	"FMULSU"
+.LC102:
+	.string	"ICALL"
+.LC103:
+	.string	"IJMP"
+.LC104:
+	.string	"IN"
+.LC105:
+	.string	"INC"
+.LC106:
+	.string	"JMP"
+.LC107:
+	.string	"LDI"
+.LC108:
+	.string	"LDD Y+q"
+.LC109:
+	.string	"LDD Z+q"
+.LC110:
+	.string	"LDS"
+.LC111:
+	.string	"LD X"
+.LC112:
+	.string	"LD -X"
+.LC113:
+	.string	"LD X+"
+.LC114:
+	.string	"LD -Y"
+.LC115:
+	.string	"LD Y+"
+.LC116:
+	.string	"LD -Z"
+.LC117:
+	.string	"LD Z+"
+.LC118:
+	.string	"LPM"
+.LC119:
+	.string	"LPM Z"
+.LC120:
+	.string	"LPM Z+"
+.LC121:
+	.string	"LSR"
+.LC122:
+	.string	"MOV"
+.LC123:
+	.string	"MOVW"
+.LC124:
+	.string	"MUL"
+.LC125:
+	.string	"MULS"
+.LC126:
+	.string	"MULSU"
+.LC127:
+	.string	"NEG"
+.LC128:
+	.string	"NOP"
+.LC129:
+	.string	"OR"
+.LC130:
+	.string	"ORI"
+.LC131:
+	.string	"OUT"
+.LC132:
+	.string	"POP"
+.LC133:
+	.string	"PUSH"
+.LC134:
+	.string	"RCALL"
+.LC135:
+	.string	"RET"
+.LC136:
+	.string	"RETI"
+.LC137:
+	.string	"RJMP"
+.LC138:
+	.string	"ROR"
+.LC139:
+	.string	"SBC"
+.LC140:
+	.string	"SBCI"
+.LC141:
+	.string	"SBI.*"
+.LC142:
+	.string	"SBIC.*"
+.LC143:
+	.string	"SBIS.*"
+.LC144:
+	.string	"SBRC.*"
+.LC145:
+	.string	"SBRS.*"
+.LC146:
+	.string	"SLEEP"
+.LC147:
+	.string	"SPM"
+.LC148:
+	.string	"STD Y+q"
+.LC149:
+	.string	"STD Z+q"
+.LC150:
+	.string	"STS"
+.LC151:
+	.string	"ST X"
+.LC152:
+	.string	"ST -X"
+.LC153:
+	.string	"ST X+"
+.LC154:
+	.string	"ST -Y"
+.LC155:
+	.string	"ST Y+"
+.LC156:
+	.string	"ST -Z"
+.LC157:
+	.string	"ST Z+"
+.LC158:
+	.string	"SUB"
+.LC159:
+	.string	"SUBI"
+.LC160:
+	.string	"SWAP"
+.LC161:
+	.string	"WDR"
+.LC162:
+	.string	"CLR"
+.LC163:
+	.string	"LSL"
+.LC164:
+	.string	"ROL"
+.LC165:
+	.string	"TST"
+.LC166:
+	.string	"XCH"
+.LC167:
+	.string	"LAS"
+.LC168:
+	.string	"LAC"
+.LC169:
+	.string	"LAT"
+	.section	.data.rel.ro.local
+	.align 32
+	.type	opcodes, @object
+	.size	opcodes, 1792
+opcodes:
+	.quad	.LC65
+	.value	0
+	.value	0
+	.zero	4
+	.quad	.LC66
+	.value	0
+	.value	0
+	.zero	4
+	.quad	.LC67
+	.value	0
+	.value	0
+	.zero	4
+	.quad	.LC68
+	.value	2
+	.value	0
+	.zero	4
+	.quad	.LC69
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC70
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC71
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC72
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC73
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC74
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC75
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC76
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC77
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC78
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC79
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC80
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC81
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC82
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC83
+	.value	2
+	.value	4
+	.zero	4
+	.quad	.LC84
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC85
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC86
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC87
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC88
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC89
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC89
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC90
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC91
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC92
+	.value	1
+	.value	4
+	.zero	4
+	.quad	.LC93
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC94
+	.value	1
+	.value	3
+	.zero	4
+	.quad	.LC95
+	.value	1
+	.value	3
+	.zero	4
+	.quad	.LC96
+	.value	1
+	.value	3
+	.zero	4
+	.quad	.LC97
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC98
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC99
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC100
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC101
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC102
+	.value	1
+	.value	3
+	.zero	4
+	.quad	.LC103
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC104
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC105
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC106
+	.value	2
+	.value	3
+	.zero	4
+	.quad	.LC107
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC108
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC109
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC110
+	.value	2
+	.value	2
+	.zero	4
+	.quad	.LC110
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC111
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC112
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC113
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC114
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC115
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC116
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC117
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC118
+	.value	1
+	.value	3
+	.zero	4
+	.quad	.LC119
+	.value	1
+	.value	3
+	.zero	4
+	.quad	.LC120
+	.value	1
+	.value	3
+	.zero	4
+	.quad	.LC121
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC122
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC123
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC124
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC125
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC126
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC127
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC128
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC129
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC130
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC131
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC132
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC133
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC134
+	.value	1
+	.value	3
+	.zero	4
+	.quad	.LC135
+	.value	1
+	.value	4
+	.zero	4
+	.quad	.LC136
+	.value	1
+	.value	4
+	.zero	4
+	.quad	.LC137
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC138
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC139
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC140
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC141
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC142
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC142
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC143
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC143
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC144
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC144
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC145
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC145
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC146
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC147
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC148
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC149
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC150
+	.value	2
+	.value	2
+	.zero	4
+	.quad	.LC150
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC151
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC152
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC153
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC154
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC155
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC156
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC157
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC158
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC159
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC160
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC161
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC162
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC163
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC164
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC165
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC166
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC167
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC168
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC169
+	.value	1
+	.value	1
+	.zero	4
+	.globl	named_sfr
+	.section	.rodata.str1.1
+.LC170:
+	.string	"SPL"
+.LC171:
+	.string	"SPH"
+.LC172:
+	.string	"RAMPZ"
+.LC173:
+	.string	"RAMPY"
+.LC174:
+	.string	"RAMPX"
+.LC175:
+	.string	"RAMPD"
+.LC176:
+	.string	"EIND"
+	.section	.data.rel.ro.local
+	.align 32
+	.type	named_sfr, @object
+	.size	named_sfr, 192
+named_sfr:
+	.long	61
+	.zero	4
+	.quad	.LC170
+	.long	0
+	.zero	4
+	.long	62
+	.zero	4
+	.quad	.LC171
+	.long	0
+	.zero	4
+	.long	59
+	.zero	4
+	.quad	.LC172
+	.long	0
+	.zero	4
+	.long	58
+	.zero	4
+	.quad	.LC173
+	.long	1
+	.zero	4
+	.long	57
+	.zero	4
+	.quad	.LC174
+	.long	1
+	.zero	4
+	.long	56
+	.zero	4
+	.quad	.LC175
+	.long	1
+	.zero	4
+	.long	60
+	.zero	4
+	.quad	.LC176
+	.long	2
+	.zero	4
+	.long	0
+	.zero	4
+	.quad	0
+	.long	0
+	.zero	4
+	.globl	addr_SPL
+	.section	.rodata
+	.align 4
+	.type	addr_SPL, @object
+	.size	addr_SPL, 4
+addr_SPL:
+	.long	61
+	.globl	addr_SREG
+	.align 4
+	.type	addr_SREG, @object
+	.size	addr_SREG, 4
+addr_SREG:
+	.long	63
+	.section	.rodata.str1.1
+.LC177:
+	.string	"EXIT"
+.LC178:
+	.string	"TIMEOUT"
+.LC179:
+	.string	"usage"
+.LC180:
+	.string	"memory"
+.LC181:
+	.string	"file i/o"
+.LC182:
+	.string	"FATAL ABORTED"
+.LC183:
+	.string	"fatal"
+	.section	.data.rel.ro.local
+	.align 32
+	.type	exit_status, @object
+	.size	exit_status, 216
+exit_status:
+	.quad	.LC177
+	.quad	0
+	.long	0
+	.long	-1
+	.quad	.LC0
+	.quad	0
+	.long	0
+	.long	1
+	.quad	.LC178
+	.quad	0
+	.long	0
+	.long	10
+	.quad	.LC0
+	.quad	0
+	.long	0
+	.long	11
+	.quad	.LC0
+	.quad	0
+	.long	0
+	.long	12
+	.quad	.LC0
+	.quad	.LC179
+	.long	1
+	.long	21
+	.quad	.LC0
+	.quad	.LC180
+	.long	1
+	.long	20
+	.quad	.LC0
+	.quad	.LC181
+	.long	1
+	.long	22
+	.quad	.LC182
+	.quad	.LC183
+	.long	1
+	.long	42
+	.section	.rodata.str1.1
+.LC184:
+	.string	"BAD_PC"
+.LC185:
+	.string	"UNDEF"
+.LC186:
+	.string	"SYSCALL"
+.LC187:
+	.string	"BCLR"
+.LC188:
+	.string	"BLD"
+.LC189:
+	.string	"BRBC"
+.LC190:
+	.string	"BRBS"
+.LC191:
+	.string	"BSET"
+.LC192:
+	.string	"BST"
+.LC193:
+	.string	"CBI"
+.LC194:
+	.string	"CPSE2"
+.LC195:
+	.string	"ELPM_Z"
+.LC196:
+	.string	"ELPM_Z_incr"
+.LC197:
+	.string	"LDD_Y"
+.LC198:
+	.string	"LDD_Z"
+.LC199:
+	.string	"LDS1"
+.LC200:
+	.string	"LD_X"
+.LC201:
+	.string	"LD_X_decr"
+.LC202:
+	.string	"LD_X_incr"
+.LC203:
+	.string	"LD_Y_decr"
+.LC204:
+	.string	"LD_Y_incr"
+.LC205:
+	.string	"LD_Z_decr"
+.LC206:
+	.string	"LD_Z_incr"
+.LC207:
+	.string	"LPM_Z"
+.LC208:
+	.string	"LPM_Z_incr"
+.LC209:
+	.string	"SBI"
+.LC210:
+	.string	"SBIC"
+.LC211:
+	.string	"SBIC2"
+.LC212:
+	.string	"SBIS"
+.LC213:
+	.string	"SBIS2"
+.LC214:
+	.string	"SBRC"
+.LC215:
+	.string	"SBRC2"
+.LC216:
+	.string	"SBRS"
+.LC217:
+	.string	"SBRS2"
+.LC218:
+	.string	"STD_Y"
+.LC219:
+	.string	"STD_Z"
+.LC220:
+	.string	"STS1"
+.LC221:
+	.string	"ST_X"
+.LC222:
+	.string	"ST_X_decr"
+.LC223:
+	.string	"ST_X_incr"
+.LC224:
+	.string	"ST_Y_decr"
+.LC225:
+	.string	"ST_Y_incr"
+.LC226:
+	.string	"ST_Z_decr"
+.LC227:
+	.string	"ST_Z_incr"
+	.section	.data.rel.ro.local
+	.align 32
+	.type	opcode_id, @object
+	.size	opcode_id, 896
+opcode_id:
+	.quad	.LC184
+	.quad	.LC66
+	.quad	.LC185
+	.quad	.LC186
+	.quad	.LC69
+	.quad	.LC70
+	.quad	.LC71
+	.quad	.LC72
+	.quad	.LC73
+	.quad	.LC74
+	.quad	.LC75
+	.quad	.LC187
+	.quad	.LC188
+	.quad	.LC78
+	.quad	.LC189
+	.quad	.LC190
+	.quad	.LC191
+	.quad	.LC192
+	.quad	.LC83
+	.quad	.LC193
+	.quad	.LC85
+	.quad	.LC86
+	.quad	.LC87
+	.quad	.LC88
+	.quad	.LC89
+	.quad	.LC194
+	.quad	.LC90
+	.quad	.LC91
+	.quad	.LC92
+	.quad	.LC93
+	.quad	.LC94
+	.quad	.LC195
+	.quad	.LC196
+	.quad	.LC97
+	.quad	.LC98
+	.quad	.LC99
+	.quad	.LC100
+	.quad	.LC101
+	.quad	.LC102
+	.quad	.LC103
+	.quad	.LC104
+	.quad	.LC105
+	.quad	.LC106
+	.quad	.LC107
+	.quad	.LC197
+	.quad	.LC198
+	.quad	.LC110
+	.quad	.LC199
+	.quad	.LC200
+	.quad	.LC201
+	.quad	.LC202
+	.quad	.LC203
+	.quad	.LC204
+	.quad	.LC205
+	.quad	.LC206
+	.quad	.LC118
+	.quad	.LC207
+	.quad	.LC208
+	.quad	.LC121
+	.quad	.LC122
+	.quad	.LC123
+	.quad	.LC124
+	.quad	.LC125
+	.quad	.LC126
+	.quad	.LC127
+	.quad	.LC128
+	.quad	.LC129
+	.quad	.LC130
+	.quad	.LC131
+	.quad	.LC132
+	.quad	.LC133
+	.quad	.LC134
+	.quad	.LC135
+	.quad	.LC136
+	.quad	.LC137
+	.quad	.LC138
+	.quad	.LC139
+	.quad	.LC140
+	.quad	.LC209
+	.quad	.LC210
+	.quad	.LC211
+	.quad	.LC212
+	.quad	.LC213
+	.quad	.LC214
+	.quad	.LC215
+	.quad	.LC216
+	.quad	.LC217
+	.quad	.LC146
+	.quad	.LC147
+	.quad	.LC218
+	.quad	.LC219
+	.quad	.LC150
+	.quad	.LC220
+	.quad	.LC221
+	.quad	.LC222
+	.quad	.LC223
+	.quad	.LC224
+	.quad	.LC225
+	.quad	.LC226
+	.quad	.LC227
+	.quad	.LC158
+	.quad	.LC159
+	.quad	.LC160
+	.quad	.LC161
+	.quad	.LC162
+	.quad	.LC163
+	.quad	.LC164
+	.quad	.LC165
+	.quad	.LC166
+	.quad	.LC167
+	.quad	.LC168
+	.quad	.LC169
+	.section	.rodata.str1.1
+.LC228:
+	.string	"LDI + LDI"
+.LC229:
+	.string	"CP + CPC"
+.LC230:
+	.string	"CPI + CPC"
+.LC231:
+	.string	"CPC + CPC"
+.LC232:
+	.string	"CP + BRBC"
+.LC233:
+	.string	"CP + BRBS"
+.LC234:
+	.string	"CPC + BRBC"
+.LC235:
+	.string	"CPC + BRBS"
+.LC236:
+	.string	"CPI + BRBC"
+.LC237:
+	.string	"CPI + BRBS"
+.LC238:
+	.string	"TST + BRBC"
+.LC239:
+	.string	"TST + BRBS"
+.LC240:
+	.string	"CP + CPC + BRBC"
+.LC241:
+	.string	"CP + CPC + BRBS"
+.LC242:
+	.string	"CPI + CPC + BRBC"
+.LC243:
+	.string	"CPI + CPC + BRBS"
+.LC244:
+	.string	"CP + CPC + CPC + CPC"
+.LC245:
+	.string	"SUBI + SBCI"
+.LC246:
+	.string	"SUBI + BRBC"
+.LC247:
+	.string	"SBCI + BRBC"
+.LC248:
+	.string	"SBCI + BRBS"
+.LC249:
+	.string	"SBIW + BRBC"
+.LC250:
+	.string	"SBIW + BRBS"
+.LC251:
+	.string	"DEC + BRBC"
+.LC252:
+	.string	"SUBI + SBCI + BRBC"
+.LC253:
+	.string	"ADD + ADC"
+.LC254:
+	.string	"ADD + ADC + ADC"
+.LC255:
+	.string	"ADD + ADC + ADC + ADC"
+.LC256:
+	.string	"MOVW + ADIW"
+.LC257:
+	.string	"MOVW + SBIW"
+.LC258:
+	.string	"PUSH + PUSH"
+.LC259:
+	.string	"POP + POP"
+.LC260:
+	.string	"LD_X_incr + ST_Z_incr"
+.LC261:
+	.string	"LD_Z_incr + ST_X_incr"
+.LC262:
+	.string	"LD_Y_incr + ST_Z_incr"
+.LC263:
+	.string	"LD_Z_incr + ST_Y_incr"
+.LC264:
+	.string	"LPM_Z_incr + ST_X_incr"
+.LC265:
+	.string	"ELPM_Z_incr + ST_X_incr"
+	.section	.rodata.str1.8
+	.align 8
+.LC266:
+	.string	"LPM_Z_incr + ST_X_incr + CPI + CPC"
+	.align 8
+.LC267:
+	.string	"ELPM_Z_incr + ST_X_incr + CPI + CPC"
+	.section	.rodata.str1.1
+.LC268:
+	.string	"ST_X_incr + CPI + CPC + BRBC"
+	.section	.data.rel.ro.local
+	.align 32
+	.type	fuse_seq, @object
+	.size	fuse_seq, 656
+fuse_seq:
+	.long	2
+	.string	"++"
+	.zero	1
+	.quad	.LC228
+	.long	2
+	.string	"\025\026"
+	.zero	1
+	.quad	.LC229
+	.long	2
+	.string	"\027\026"
+	.zero	1
+	.quad	.LC230
+	.long	2
+	.string	"\026\026"
+	.zero	1
+	.quad	.LC231
+	.long	2
+	.string	"\025\016"
+	.zero	1
+	.quad	.LC232
+	.long	2
+	.string	"\025\017"
+	.zero	1
+	.quad	.LC233
+	.long	2
+	.string	"\026\016"
+	.zero	1
+	.quad	.LC234
+	.long	2
+	.string	"\026\017"
+	.zero	1
+	.quad	.LC235
+	.long	2
+	.string	"\027\016"
+	.zero	1
+	.quad	.LC236
+	.long	2
+	.string	"\027\017"
+	.zero	1
+	.quad	.LC237
+	.long	2
+	.string	"k\016"
+	.zero	1
+	.quad	.LC238
+	.long	2
+	.string	"k\017"
+	.zero	1
+	.quad	.LC239
+	.long	3
+	.string	"\025\026\016"
+	.quad	.LC240
+	.long	3
+	.string	"\025\026\017"
+	.quad	.LC241
+	.long	3
+	.string	"\027\026\016"
+	.quad	.LC242
+	.long	3
+	.string	"\027\026\017"
+	.quad	.LC243
+	.long	4
+	.ascii	"\025\026\026\026"
+	.quad	.LC244
+	.long	2
+	.string	"eM"
+	.zero	1
+	.quad	.LC245
+	.long	2
+	.string	"e\016"
+	.zero	1
+	.quad	.LC246
+	.long	2
+	.string	"M\016"
+	.zero	1
+	.quad	.LC247
+	.long	2
+	.string	"M\017"
+	.zero	1
+	.quad	.LC248
+	.long	2
+	.string	"\007\016"
+	.zero	1
+	.quad	.LC249
+	.long	2
+	.string	"\007\017"
+	.zero	1
+	.quad	.LC250
+	.long	2
+	.string	"\032\016"
+	.zero	1
+	.quad	.LC251
+	.long	3
+	.string	"eM\016"
+	.quad	.LC252
+	.long	2
+	.string	"\005\004"
+	.zero	1
+	.quad	.LC253
+	.long	3
+	.string	"\005\004\004"
+	.quad	.LC254
+	.long	4
+	.ascii	"\005\004\004\004"
+	.quad	.LC255
+	.long	2
+	.string	"<\006"
+	.zero	1
+	.quad	.LC256
+	.long	2
+	.string	"<\007"
+	.zero	1
+	.quad	.LC257
+	.long	2
+	.string	"FF"
+	.zero	1
+	.quad	.LC258
+	.long	2
+	.string	"EE"
+	.zero	1
+	.quad	.LC259
+	.long	2
+	.string	"2c"
+	.zero	1
+	.quad	.LC260
+	.long	2
+	.string	"6_"
+	.zero	1
+	.quad	.LC261
+	.long	2
+	.string	"4c"
+	.zero	1
+	.quad	.LC262
+	.long	2
+	.string	"6a"
+	.zero	1
+	.quad	.LC263
+	.long	2
+	.string	"9_"
+	.zero	1
+	.quad	.LC264
+	.long	2
+	.string	" _"
+	.zero	1
+	.quad	.LC265
+	.long	4
+	.ascii	"9_\027\026"
+	.quad	.LC266
+	.long	4
+	.ascii	" _\027\026"
+	.quad	.LC267
+	.long	4
+	.ascii	"_\027\026\016"
+	.quad	.LC268
+	.globl	invalid_opcode
+	.section	.rodata
+	.align 4
+	.type	invalid_opcode, @object
+	.size	invalid_opcode, 4
+invalid_opcode:
+	.long	65535
+	.globl	io_base
+	.align 4
+	.type	io_base, @object
+	.size	io_base, 4
+io_base:
+	.zero	4
+	.globl	is_avrtest_log
+	.type	is_avrtest_log, @object
+	.size	is_avrtest_log, 1
+is_avrtest_log:
+	.zero	1
+	.globl	is_tiny
+	.type	is_tiny, @object
+	.size	is_tiny, 1
+is_tiny:
+	.byte	1
+	.globl	is_xmega
+	.type	is_xmega, @object
+	.size	is_xmega, 1
+is_xmega:
+	.zero	1
+	.align 32
+	.type	flag_update_table_logical, @object
+	.size	flag_update_table_logical, 256
+flag_update_table_logical:
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.ascii	"\024\024\024\024\024\024\024\024\024\024\024\024\024\024\024"
+	.ascii	"\024\024\024\024\024\024\024\024\024\024\024\024\024\024\024"
+	.ascii	"\024\024\024\024\024\024\024\024\024\024\024\024\024\024\024"
+	.ascii	"\024\024\024\024\024\024\024\024\024\024\024\024\024\024\024"
+	.ascii	"\024\024\024\024\024\024\024\024\024\024\024\024\024\024\024"
+	.ascii	"\024\024\024\024\024\024\024\024\024\024\024\024\024\024\024"
+	.ascii	"\024\024\024\024\024\024\024\024\024\024\024\024\024\024\024"
+	.ascii	"\024\024\024\024\024\024\024\024\024\024\024\024\024\024\024"
+	.ascii	"\024\024\024\024\024\024\024\024"
+	.section	.rodata.cst8,"aM",@progbits,8
+	.align 8
+.LC11:
+	.long	0
+	.long	1079574528
+	.align 8
+.LC19:
+	.long	0
+	.long	1083129856
+	.align 8
+.LC20:
+	.long	-755914244
+	.long	1062232653
+	.align 8
+.LC21:
+	.long	1202590843
+	.long	1065646817
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
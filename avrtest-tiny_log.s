@@ -0,0 +1,15296 @@
+	.file	"avrtest.c"
+	.text
+	.p2align 4
+	.type	host_getchar, @function
+host_getchar:
+.LFB198:
+	.cfi_startproc
+	movq	896(%rdi), %rdi	# 6	[c=9 l=7]  *movdi_internal/3
+	jmp	getc@PLT	# 8	[c=10 l=5]  *sibcall_value
+	.cfi_endproc
+.LFE198:
+	.size	host_getchar, .-host_getchar
+	.p2align 4
+	.type	flash_changed, @function
+flash_changed:
+.LFB80:
+	.cfi_startproc
+	pushq	%rbp	# 64	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rdi, %rbp	# 2	[c=4 l=3]  *movdi_internal/3
+	pushq	%rbx	# 65	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	movl	%edx, %ebx	# 4	[c=4 l=2]  *movsi_internal/0
+	subq	$8, %rsp	# 66	[c=4 l=4]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_def_cfa_offset 32
+	call	redecode_flash@PLT	# 11	[c=10 l=5]  *call_value
+	movl	$510, %edx	# 56	[c=4 l=5]  *movsi_internal/0
+	movl	992(%rbp), %ecx	# 62	[c=9 l=6]  *movsi_internal/0
+	cmpl	%edx, %eax	# 57	[c=4 l=2]  *cmpsi_1/0
+	cmovb	%edx, %eax	# 58	[c=8 l=3]  *movsicc_noc/1
+	shrl	%ebx	# 17	[c=4 l=2]  *lshrsi3_1/0
+	leal	1(%rcx), %edx	# 63	[c=4 l=3]  *leasi
+	movl	120(%rbp), %ecx	# 20	[c=9 l=3]  *movsi_internal/0
+	addl	$2, %ebx	# 18	[c=4 l=3]  *addsi_1/0
+	subl	$510, %eax	# 14	[c=4 l=5]  *addsi_1/0
+	cmpl	%ebx, %edx	# 59	[c=4 l=2]  *cmpsi_1/0
+	cmova	%ebx, %edx	# 60	[c=8 l=3]  *movsicc_noc/1
+	testl	%ecx, %ecx	# 21	[c=4 l=2]  *cmpsi_ccno_1/0
+	je	.L4	# 22	[c=13 l=2]  *jcc
+	movl	116(%rbp), %esi	# 51	[c=9 l=3]  *movsi_internal/0
+	cmpl	%esi, %eax	# 52	[c=4 l=2]  *cmpsi_1/0
+	cmova	%esi, %eax	# 53	[c=8 l=3]  *movsicc_noc/1
+	cmpl	%ecx, %edx	# 54	[c=4 l=2]  *cmpsi_1/0
+	cmovb	%ecx, %edx	# 55	[c=8 l=3]  *movsicc_noc/1
+.L4:
+	movl	%eax, 116(%rbp)	# 29	[c=4 l=3]  *movsi_internal/1
+	movl	584(%rbp), %eax	# 80	[c=9 l=6]  *movsi_internal/0
+	movl	%edx, 120(%rbp)	# 28	[c=4 l=3]  *movsi_internal/1
+	testl	%eax, %eax	# 81	[c=4 l=2]  *cmpsi_ccno_1/0
+	jne	.L10	# 31	[c=13 l=2]  *jcc
+	addq	$8, %rsp	# 69	[c=4 l=4]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx	# 70	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 16
+	popq	%rbp	# 71	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 8
+	ret		# 72	[c=0 l=1]  simple_return_internal
+	.p2align 4,,10
+	.p2align 3
+.L10:
+	.cfi_restore_state
+	addq	$8, %rsp	# 76	[c=4 l=4]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_def_cfa_offset 24
+	movq	%rbp, %rdi	# 33	[c=4 l=3]  *movdi_internal/3
+	popq	%rbx	# 77	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 16
+	popq	%rbp	# 78	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 8
+	jmp	hle_forget@PLT	# 34	[c=0 l=5]  *sibcall
+	.cfi_endproc
+.LFE80:
+	.size	flash_changed, .-flash_changed
+	.p2align 4
+	.globl	qprintf
+	.type	qprintf, @function
+qprintf:
+.LFB15:
+	.cfi_startproc
+	subq	$216, %rsp	# 50	[c=4 l=7]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_def_cfa_offset 224
+	movq	%rdx, 48(%rsp)	# 4	[c=4 l=5]  *movdi_internal/5
+	movq	%rcx, 56(%rsp)	# 5	[c=4 l=5]  *movdi_internal/5
+	movq	%r8, 64(%rsp)	# 6	[c=4 l=5]  *movdi_internal/5
+	movq	%r9, 72(%rsp)	# 7	[c=4 l=5]  *movdi_internal/5
+	testb	%al, %al	# 8	[c=4 l=2]  *cmpqi_ccno_1/0
+	je	.L14	# 9	[c=13 l=2]  *jcc
+	movaps	%xmm0, 80(%rsp)	# 10	[c=4 l=5]  movv4sf_internal/3
+	movaps	%xmm1, 96(%rsp)	# 11	[c=4 l=5]  movv4sf_internal/3
+	movaps	%xmm2, 112(%rsp)	# 12	[c=4 l=5]  movv4sf_internal/3
+	movaps	%xmm3, 128(%rsp)	# 13	[c=4 l=8]  movv4sf_internal/3
+	movaps	%xmm4, 144(%rsp)	# 14	[c=4 l=8]  movv4sf_internal/3
+	movaps	%xmm5, 160(%rsp)	# 15	[c=4 l=8]  movv4sf_internal/3
+	movaps	%xmm6, 176(%rsp)	# 16	[c=4 l=8]  movv4sf_internal/3
+	movaps	%xmm7, 192(%rsp)	# 17	[c=4 l=8]  movv4sf_internal/3
+.L14:
+	movl	216(%rdi), %eax	# 58	[c=9 l=6]  *movsi_internal/0
+	testl	%eax, %eax	# 59	[c=4 l=2]  *cmpsi_ccno_1/0
+	je	.L16	# 23	[c=13 l=2]  *jcc
+	addq	$216, %rsp	# 53	[c=4 l=7]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_remember_state
+	.cfi_def_cfa_offset 8
+	ret		# 54	[c=0 l=1]  simple_return_internal
+	.p2align 4,,10
+	.p2align 3
+.L16:
+	.cfi_restore_state
+	leaq	224(%rsp), %rax	# 47	[c=4 l=8]  *leadi
+	movq	904(%rdi), %rdi	# 31	[c=9 l=7]  *movdi_internal/3
+	leaq	8(%rsp), %rdx	# 49	[c=4 l=5]  *leadi
+	movl	$16, 8(%rsp)	# 26	[c=4 l=8]  *movsi_internal/1
+	movq	%rax, 16(%rsp)	# 28	[c=4 l=5]  *movdi_internal/5
+	leaq	32(%rsp), %rax	# 48	[c=4 l=5]  *leadi
+	movl	$48, 12(%rsp)	# 27	[c=4 l=8]  *movsi_internal/1
+	movq	%rax, 24(%rsp)	# 29	[c=4 l=5]  *movdi_internal/5
+	call	vfprintf@PLT	# 35	[c=10 l=5]  *call_value
+	addq	$216, %rsp	# 62	[c=4 l=7]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_def_cfa_offset 8
+	ret		# 63	[c=0 l=1]  simple_return_internal
+	.cfi_endproc
+.LFE15:
+	.size	qprintf, .-qprintf
+	.p2align 4
+	.globl	quit
+	.type	quit, @function
+quit:
+.LFB19:
+	.cfi_startproc
+	subq	$8, %rsp	# 18	[c=4 l=4]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_def_cfa_offset 16
+	movl	%esi, 136(%rdi)	# 7	[c=4 l=6]  *movsi_internal/1
+	movl	$1, %esi	# 9	[c=4 l=5]  *movsi_internal/0
+	movq	128(%rdi), %rdi	# 8	[c=9 l=7]  *movdi_internal/3
+	call	longjmp@PLT	# 11	[c=0 l=5]  *call
+	.cfi_endproc
+.LFE19:
+	.size	quit, .-quit
+	.section	.rodata.str1.1,"aMS",@progbits,1
+.LC0:
+	.string	"ABORTED"
+.LC1:
+	.string	"w"
+.LC2:
+	.string	"%s: cannot write -status=%s\n"
+.LC3:
+	.string	"%d %lu %lu %s\n"
+	.text
+	.p2align 4
+	.type	finish, @function
+finish:
+.LFB20:
+	.cfi_startproc
+	pushq	%r12	# 117	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	pushq	%rbp	# 118	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	movl	%esi, %ebp	# 3	[c=4 l=2]  *movsi_internal/0
+	pushq	%rbx	# 119	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	movl	440(%rdi), %esi	# 132	[c=9 l=6]  *movsi_internal/0
+	movq	%rdi, %rbx	# 2	[c=4 l=3]  *movdi_internal/3
+	testl	%esi, %esi	# 133	[c=4 l=2]  *cmpsi_ccno_1/0
+	jne	.L31	# 10	[c=13 l=2]  *jcc
+.L20:
+	movq	11016(%rbx), %rax	# 62	[c=9 l=7]  *movdi_internal/3
+	testq	%rax, %rax	# 63	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L23	# 64	[c=13 l=2]  *jcc
+	movdqu	40(%rbx), %xmm0	# 114	[c=13 l=5]  movv2di_internal/2
+	movl	76(%rbx), %ecx	# 128	[c=9 l=3]  *movsi_internal/0
+	movl	%ebp, (%rax)	# 66	[c=4 l=2]  *movsi_internal/1
+	leaq	.LC0(%rip), %rdx	# 6	[c=1 l=7]  *movdi_internal/4
+	shufpd	$1, %xmm0, %xmm0	# 70	[c=4 l=5]  sse2_shufpd_v2di/0
+	movups	%xmm0, 8(%rax)	# 71	[c=4 l=4]  movv2di_internal/3
+	testl	%ecx, %ecx	# 129	[c=4 l=2]  *cmpsi_ccno_1/0
+	je	.L32	# 73	[c=13 l=2]  *jcc
+.L24:
+	movq	%rdx, 24(%rax)	# 83	[c=4 l=4]  *movdi_internal/5
+.L23:
+	movl	%ebp, %esi	# 86	[c=4 l=2]  *movsi_internal/0
+	movq	%rbx, %rdi	# 87	[c=4 l=3]  *movdi_internal/3
+	call	quit	# 88	[c=0 l=5]  *call
+.L32:
+	movslq	72(%rbx), %rdx	# 77	[c=13 l=4]  *extendsidi2_rex64/1
+	leaq	exit_status(%rip), %rcx	# 112	[c=1 l=7]  *movdi_internal/4
+	imulq	$24, %rdx, %rdx	# 78	[c=16 l=4]  *muldi3_1/0
+	movq	(%rcx,%rdx), %rdx	# 80	[c=9 l=4]  *movdi_internal/3
+	jmp	.L24	# 136	[c=1 l=2]  jump
+.L31:
+	movq	448(%rdi), %rdi	# 12	[c=9 l=7]  *movdi_internal/3
+	leaq	.LC1(%rip), %rsi	# 13	[c=1 l=7]  *movdi_internal/4
+	call	fopen@PLT	# 16	[c=10 l=5]  *call_value
+	movq	%rax, %r12	# 17	[c=4 l=3]  *movdi_internal/3
+	testq	%rax, %rax	# 19	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L33	# 20	[c=13 l=2]  *jcc
+	cmpl	$0, 76(%rbx)	# 36	[c=13 l=4]  *cmpsi_ccno_1/1
+	leaq	.LC0(%rip), %r9	# 5	[c=1 l=7]  *movdi_internal/4
+	je	.L34	# 37	[c=13 l=2]  *jcc
+.L22:
+	movq	48(%rbx), %rcx	# 48	[c=9 l=4]  *movdi_internal/3
+	movq	40(%rbx), %r8	# 50	[c=9 l=4]  *movdi_internal/3
+	movq	%r12, %rdi	# 55	[c=4 l=3]  *movdi_internal/3
+	movl	%ebp, %edx	# 52	[c=4 l=2]  *movsi_internal/0
+	leaq	.LC3(%rip), %rsi	# 53	[c=1 l=7]  *movdi_internal/4
+	xorl	%eax, %eax	# 130	[c=4 l=2]  *movdi_xor
+	call	fprintf@PLT	# 57	[c=10 l=5]  *call_value
+	movq	%r12, %rdi	# 58	[c=4 l=3]  *movdi_internal/3
+	call	fclose@PLT	# 59	[c=10 l=5]  *call_value
+	jmp	.L20	# 140	[c=1 l=5]  jump
+.L34:
+	movslq	72(%rbx), %rax	# 41	[c=13 l=4]  *extendsidi2_rex64/1
+	leaq	exit_status(%rip), %rdx	# 111	[c=1 l=7]  *movdi_internal/4
+	imulq	$24, %rax, %rax	# 42	[c=16 l=4]  *muldi3_1/0
+	movq	(%rdx,%rax), %r9	# 44	[c=9 l=4]  *movdi_internal/3
+	jmp	.L22	# 142	[c=1 l=2]  jump
+.L33:
+	movq	448(%rbx), %rcx	# 22	[c=9 l=7]  *movdi_internal/3
+	movq	144(%rbx), %rdx	# 23	[c=9 l=7]  *movdi_internal/3
+	leaq	.LC2(%rip), %rsi	# 27	[c=1 l=7]  *movdi_internal/4
+	xorl	%eax, %eax	# 131	[c=4 l=2]  *movdi_xor
+	movq	912(%rbx), %rdi	# 24	[c=9 l=7]  *movdi_internal/3
+	call	fprintf@PLT	# 31	[c=10 l=5]  *call_value
+	jmp	.L20	# 144	[c=1 l=5]  jump
+	.cfi_endproc
+.LFE20:
+	.size	finish, .-finish
+	.section	.rodata.str1.1
+.LC5:
+	.string	"-not set-"
+.LC6:
+	.string	"\n"
+	.section	.rodata.str1.8,"aMS",@progbits,1
+	.align 8
+.LC11:
+	.string	"        load: %lu:%02lu.%06lu  = %3lu.%03lu sec  = %6.2f%%,  %10.3f        bytes/ms, 0x%05x = %u bytes\n"
+	.align 8
+.LC12:
+	.string	"      decode: %lu:%02lu.%06lu  = %3lu.%03lu sec  = %6.2f%%,  %10.3f        bytes/ms, 0x%05x = %u bytes\n"
+	.align 8
+.LC13:
+	.string	"     execute: %lu:%02lu.%06lu  = %3lu.%03lu sec  = %6.2f%%,  %10.3f instructions/ms\n"
+	.align 8
+.LC14:
+	.string	" avrtest run: %lu:%02lu.%06lu  = %3lu.%03lu sec  = %6.2f%%,  %10.3f instructions/ms\n"
+	.align 8
+.LC15:
+	.string	" exit status: %s\n      reason: "
+	.section	.rodata.str1.1
+.LC16:
+	.string	"\n     program: %s\n"
+.LC17:
+	.string	" entry point: %06x\n"
+	.section	.rodata.str1.8
+	.align 8
+.LC18:
+	.string	"exit address: %06x\ntotal cycles: %lu\n"
+	.section	.rodata.str1.1
+.LC19:
+	.string	"      asleep: %lu\n"
+.LC20:
+	.string	"total instr.: %lu\n\n"
+.LC21:
+	.string	"\n%s: %s error: "
+	.text
+	.p2align 4
+	.globl	leave
+	.type	leave, @function
+leave:
+.LFB21:
+	.cfi_startproc
+	pushq	%rbp	# 1208	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp	# 1209	[c=4 l=3]  *movdi_internal/3
+	.cfi_def_cfa_register 6
+	pushq	%r15	# 1210	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_offset 15, -24
+	movq	%rdi, %r15	# 2	[c=4 l=3]  *movdi_internal/3
+	pushq	%r14	# 1211	[c=4 l=2]  *pushdi2_rex64/0
+	pushq	%r13	# 1212	[c=4 l=2]  *pushdi2_rex64/0
+	pushq	%r12	# 1213	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_offset 14, -32
+	.cfi_offset 13, -40
+	.cfi_offset 12, -48
+	movq	%rdx, %r12	# 4	[c=4 l=3]  *movdi_internal/3
+	pushq	%rbx	# 1214	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_offset 3, -56
+	movl	%esi, %ebx	# 3	[c=4 l=2]  *movsi_internal/0
+	subq	$328, %rsp	# 1215	[c=4 l=7]  pro_epilogue_adjust_stack_add_di/0
+	movq	%rcx, -200(%rbp)	# 5	[c=4 l=7]  *movdi_internal/5
+	movq	%r8, -192(%rbp)	# 6	[c=4 l=7]  *movdi_internal/5
+	movq	%r9, -184(%rbp)	# 7	[c=4 l=7]  *movdi_internal/5
+	testb	%al, %al	# 8	[c=4 l=2]  *cmpqi_ccno_1/0
+	je	.L103	# 9	[c=13 l=2]  *jcc
+	movaps	%xmm0, -176(%rbp)	# 10	[c=4 l=7]  movv4sf_internal/3
+	movaps	%xmm1, -160(%rbp)	# 11	[c=4 l=7]  movv4sf_internal/3
+	movaps	%xmm2, -144(%rbp)	# 12	[c=4 l=7]  movv4sf_internal/3
+	movaps	%xmm3, -128(%rbp)	# 13	[c=4 l=4]  movv4sf_internal/3
+	movaps	%xmm4, -112(%rbp)	# 14	[c=4 l=4]  movv4sf_internal/3
+	movaps	%xmm5, -96(%rbp)	# 15	[c=4 l=4]  movv4sf_internal/3
+	movaps	%xmm6, -80(%rbp)	# 16	[c=4 l=4]  movv4sf_internal/3
+	movaps	%xmm7, -64(%rbp)	# 17	[c=4 l=4]  movv4sf_internal/3
+.L103:
+	movl	96(%r15), %edx	# 31	[c=9 l=4]  *movsi_internal/0
+	movl	%ebx, 72(%r15)	# 30	[c=4 l=4]  *movsi_internal/1
+	testl	%edx, %edx	# 32	[c=4 l=2]  *cmpsi_ccno_1/0
+	je	.L38	# 33	[c=13 l=2]  *jcc
+	movq	40(%r15), %rax	# 994	[c=9 l=4]  *movdi_internal/3
+	subq	$1, %rax	# 40	[c=4 l=4]  *adddi_1/0
+	subl	$1, %edx	# 1276	[c=4 l=3]  *addsi_4
+	movq	%rax, 40(%r15)	# 41	[c=4 l=4]  *movdi_internal/5
+	je	.L124	# 44	[c=13 l=6]  *jcc
+.L38:
+	movq	%r15, %rdi	# 57	[c=4 l=3]  *movdi_internal/3
+	leaq	exit_status(%rip), %r14	# 61	[c=1 l=7]  *movdi_internal/4
+	call	periph_finish@PLT	# 58	[c=0 l=5]  *call
+	movq	%r15, %rdi	# 59	[c=4 l=3]  *movdi_internal/3
+	call	replay_finish@PLT	# 60	[c=0 l=5]  *call
+	movslq	%ebx, %rax	# 62	[c=4 l=3]  *extendsidi2_rex64/1
+	movq	%rax, -264(%rbp)	# 1121	[c=4 l=7]  *movdi_internal/5
+	leaq	(%rax,%rax,2), %rax	# 65	[c=8 l=4]  *leadi
+	movl	16(%r14,%rax,8), %r13d	# 70	[c=10 l=5]  *movsi_internal/0
+	testl	%r13d, %r13d	# 71	[c=4 l=3]  *cmpsi_ccno_1/0
+	je	.L40	# 72	[c=13 l=6]  *jcc
+	xorl	%eax, %eax	# 1273	[c=4 l=2]  *movdi_xor
+	leaq	.LC6(%rip), %rsi	# 74	[c=1 l=7]  *movdi_internal/4
+	movq	%r15, %rdi	# 76	[c=4 l=3]  *movdi_internal/3
+	call	qprintf	# 78	[c=0 l=5]  *call
+	movl	216(%r15), %r11d	# 1274	[c=9 l=7]  *movsi_internal/0
+	leaq	-256(%rbp), %rax	# 875	[c=4 l=7]  *leadi
+	movq	%rax, -272(%rbp)	# 997	[c=4 l=7]  *movdi_internal/5
+	testl	%r11d, %r11d	# 1275	[c=4 l=3]  *cmpsi_ccno_1/0
+	jne	.L125	# 80	[c=13 l=6]  *jcc
+.L41:
+	leaq	16(%rbp), %rax	# 1108	[c=4 l=4]  *leadi
+	cmpl	$0, 76(%r15)	# 606	[c=13 l=5]  *cmpsi_ccno_1/1
+	movl	$24, -256(%rbp)	# 602	[c=4 l=10]  *movsi_internal/1
+	leaq	.LC0(%rip), %rdx	# 26	[c=1 l=7]  *movdi_internal/4
+	movq	%rax, -248(%rbp)	# 604	[c=4 l=7]  *movdi_internal/5
+	leaq	-224(%rbp), %rax	# 1109	[c=4 l=7]  *leadi
+	movl	$48, -252(%rbp)	# 603	[c=4 l=10]  *movsi_internal/1
+	movq	%rax, -240(%rbp)	# 605	[c=4 l=7]  *movdi_internal/5
+	je	.L126	# 607	[c=13 l=6]  *jcc
+.L90:
+	movq	904(%r15), %rdi	# 616	[c=9 l=7]  *movdi_internal/3
+	leaq	.LC15(%rip), %rsi	# 618	[c=1 l=7]  *movdi_internal/4
+	xorl	%eax, %eax	# 1237	[c=4 l=2]  *movdi_xor
+	call	fprintf@PLT	# 622	[c=10 l=5]  *call_value
+	movq	-272(%rbp), %rdx	# 625	[c=9 l=7]  *movdi_internal/3
+	movq	904(%r15), %rdi	# 624	[c=9 l=7]  *movdi_internal/3
+	movq	%r12, %rsi	# 626	[c=4 l=3]  *movdi_internal/3
+	call	vfprintf@PLT	# 628	[c=10 l=5]  *call_value
+	movq	80(%r15), %rdx	# 629	[c=9 l=4]  *movdi_internal/3
+	testq	%rdx, %rdx	# 630	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L127	# 631	[c=13 l=6]  *jcc
+.L91:
+	movq	904(%r15), %rdi	# 635	[c=9 l=7]  *movdi_internal/3
+	xorl	%eax, %eax	# 1236	[c=4 l=2]  *movdi_xor
+	leaq	.LC16(%rip), %rsi	# 637	[c=1 l=7]  *movdi_internal/4
+	call	fprintf@PLT	# 641	[c=10 l=5]  *call_value
+	testl	%r13d, %r13d	# 642	[c=4 l=3]  *cmpsi_ccno_1/0
+	jne	.L92	# 643	[c=13 l=2]  *jcc
+	movl	8(%r15), %edx	# 645	[c=9 l=4]  *movsi_internal/0
+	testl	%edx, %edx	# 646	[c=4 l=2]  *cmpsi_ccno_1/0
+	jne	.L128	# 647	[c=13 l=6]  *jcc
+.L93:
+	movl	(%r15), %eax	# 1113	[c=5 l=3]  *movsi_internal/0
+	movq	48(%r15), %rcx	# 658	[c=9 l=4]  *movdi_internal/3
+	leaq	.LC18(%rip), %rsi	# 664	[c=1 l=7]  *movdi_internal/4
+	movq	904(%r15), %rdi	# 661	[c=9 l=7]  *movdi_internal/3
+	leal	(%rax,%rax), %edx	# 1180	[c=12 l=3]  *leasi
+	xorl	%eax, %eax	# 1234	[c=4 l=2]  *movdi_xor
+	call	fprintf@PLT	# 668	[c=10 l=5]  *call_value
+	movq	64(%r15), %rdx	# 669	[c=9 l=4]  *movdi_internal/3
+	testq	%rdx, %rdx	# 670	[c=4 l=3]  *cmpdi_ccno_1/0
+	jne	.L129	# 671	[c=13 l=6]  *jcc
+.L94:
+	movq	40(%r15), %rdx	# 682	[c=9 l=4]  *movdi_internal/3
+	movq	904(%r15), %rdi	# 683	[c=9 l=7]  *movdi_internal/3
+	leaq	.LC20(%rip), %rsi	# 685	[c=1 l=7]  *movdi_internal/4
+	xorl	%eax, %eax	# 1232	[c=4 l=2]  *movdi_xor
+	call	fprintf@PLT	# 689	[c=10 l=5]  *call_value
+.L92:
+	movq	904(%r15), %rdi	# 692	[c=9 l=7]  *movdi_internal/3
+	call	fflush@PLT	# 694	[c=10 l=5]  *call_value
+	movl	%r13d, %esi	# 695	[c=4 l=3]  *movsi_internal/0
+	movq	%r15, %rdi	# 696	[c=4 l=3]  *movdi_internal/3
+	call	finish	# 697	[c=0 l=5]  *call
+.L126:
+	imulq	$24, -264(%rbp), %rax	# 611	[c=25 l=8]  *muldi3_1/0
+	movq	(%r14,%rax), %rdx	# 613	[c=9 l=4]  *movdi_internal/3
+	jmp	.L90	# 1283	[c=1 l=5]  jump
+.L40:
+	xorl	%esi, %esi	# 1271	[c=4 l=2]  *movdi_xor
+	movq	%r15, %rdi	# 87	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 88	[c=0 l=5]  *call
+	xorl	%eax, %eax	# 1272	[c=4 l=2]  *movdi_xor
+	leaq	.LC6(%rip), %rsi	# 89	[c=1 l=7]  *movdi_internal/4
+	movq	%r15, %rdi	# 91	[c=4 l=3]  *movdi_internal/3
+	call	qprintf	# 93	[c=0 l=5]  *call
+	cmpl	$0, 232(%r15)	# 94	[c=13 l=8]  *cmpsi_ccno_1/1
+	je	.L43	# 95	[c=13 l=6]  *jcc
+	leaq	-256(%rbp), %rax	# 1207	[c=4 l=7]  *leadi
+	xorl	%esi, %esi	# 1270	[c=4 l=2]  *movdi_xor
+	movq	%rax, %rdi	# 99	[c=4 l=3]  *movdi_internal/3
+	movq	%rax, -272(%rbp)	# 1124	[c=4 l=7]  *movdi_internal/5
+	call	gettimeofday@PLT	# 100	[c=10 l=5]  *call_value
+	movq	-248(%rbp), %rax	# 103	[c=9 l=7]  *movdi_internal/3
+	movq	-256(%rbp), %rsi	# 101	[c=9 l=7]  *movdi_internal/3
+	movq	928(%r15), %rdx	# 102	[c=9 l=7]  *movdi_internal/3
+	movq	%rax, %rdi	# 1001	[c=4 l=3]  *movdi_internal/3
+	movq	%rsi, %rcx	# 999	[c=4 l=3]  *movdi_internal/3
+	subq	920(%r15), %rcx	# 104	[c=13 l=7]  *subdi_1/1
+	subq	%rdx, %rdi	# 105	[c=4 l=3]  *subdi_1/0
+	movq	%rcx, -280(%rbp)	# 1123	[c=4 l=7]  *movdi_internal/5
+	movq	%rdi, -288(%rbp)	# 1122	[c=4 l=7]  *movdi_internal/5
+	cmpq	%rdx, %rax	# 106	[c=4 l=3]  *cmpdi_1/0
+	jnb	.L44	# 107	[c=13 l=2]  *jcc
+	subq	$1, %rcx	# 109	[c=4 l=4]  *adddi_1/0
+	addq	$1000000, %rdi	# 110	[c=4 l=7]  *adddi_1/0
+	movq	%rcx, -280(%rbp)	# 1004	[c=4 l=7]  *movdi_internal/5
+	movq	%rdi, -288(%rbp)	# 1006	[c=4 l=7]  *movdi_internal/5
+.L44:
+	movq	-280(%rbp), %rcx	# 1125	[c=9 l=7]  *movdi_internal/3
+	testq	%rcx, %rcx	# 115	[c=4 l=3]  *cmpdi_ccno_1/0
+	js	.L45	# 116	[c=13 l=6]  *jcc
+	pxor	%xmm2, %xmm2	# 1375	[c=4 l=4]  movv2df_internal/0
+	cvtsi2sdq	%rcx, %xmm2	# 1376	[c=4 l=5]  sse2_cvtsi2sdq/0
+.L46:
+	movsd	.LC7(%rip), %xmm5	# 127	[c=6 l=8]  *movdf_internal/14
+	movq	-288(%rbp), %rcx	# 1127	[c=9 l=7]  *movdi_internal/3
+	mulsd	%xmm5, %xmm2	# 128	[c=20 l=4]  *fop_df_comm/1
+	testq	%rcx, %rcx	# 131	[c=4 l=3]  *cmpdi_ccno_1/0
+	js	.L47	# 132	[c=13 l=6]  *jcc
+	pxor	%xmm0, %xmm0	# 1373	[c=4 l=4]  movv2df_internal/0
+	cvtsi2sdq	%rcx, %xmm0	# 1374	[c=4 l=5]  sse2_cvtsi2sdq/0
+.L48:
+	movsd	.LC8(%rip), %xmm4	# 143	[c=6 l=8]  *movdf_internal/14
+	movq	968(%r15), %rcx	# 146	[c=9 l=7]  *movdi_internal/3
+	movq	%rax, %rdi	# 1019	[c=4 l=3]  *movdi_internal/3
+	movq	976(%r15), %rdx	# 147	[c=9 l=7]  *movdi_internal/3
+	mulsd	%xmm4, %xmm0	# 144	[c=20 l=4]  *fop_df_comm/1
+	subq	%rcx, %rsi	# 148	[c=4 l=3]  *subdi_1/0
+	subq	%rdx, %rdi	# 149	[c=4 l=3]  *subdi_1/0
+	movq	%rsi, -296(%rbp)	# 1130	[c=4 l=7]  *movdi_internal/5
+	movq	%rdi, -304(%rbp)	# 1129	[c=4 l=7]  *movdi_internal/5
+	addsd	%xmm0, %xmm2	# 145	[c=12 l=4]  *fop_df_comm/1
+	cmpq	%rdx, %rax	# 150	[c=4 l=3]  *cmpdi_1/0
+	jnb	.L49	# 151	[c=13 l=2]  *jcc
+	subq	$1, %rsi	# 153	[c=4 l=4]  *adddi_1/0
+	addq	$1000000, %rdi	# 154	[c=4 l=7]  *adddi_1/0
+	movq	%rsi, -296(%rbp)	# 1022	[c=4 l=7]  *movdi_internal/5
+	movq	%rdi, -304(%rbp)	# 1024	[c=4 l=7]  *movdi_internal/5
+.L49:
+	movq	-296(%rbp), %rax	# 1131	[c=9 l=7]  *movdi_internal/3
+	testq	%rax, %rax	# 159	[c=4 l=3]  *cmpdi_ccno_1/0
+	js	.L50	# 160	[c=13 l=6]  *jcc
+	pxor	%xmm1, %xmm1	# 1371	[c=4 l=4]  movv2df_internal/0
+	cvtsi2sdq	%rax, %xmm1	# 1372	[c=4 l=5]  sse2_cvtsi2sdq/0
+.L51:
+	movq	-304(%rbp), %rax	# 1133	[c=9 l=7]  *movdi_internal/3
+	mulsd	%xmm5, %xmm1	# 172	[c=20 l=4]  *fop_df_comm/1
+	testq	%rax, %rax	# 175	[c=4 l=3]  *cmpdi_ccno_1/0
+	js	.L52	# 176	[c=13 l=6]  *jcc
+	pxor	%xmm0, %xmm0	# 1369	[c=4 l=4]  movv2df_internal/0
+	cvtsi2sdq	%rax, %xmm0	# 1370	[c=4 l=5]  sse2_cvtsi2sdq/0
+.L53:
+	mulsd	%xmm4, %xmm0	# 188	[c=20 l=4]  *fop_df_comm/1
+	movq	952(%r15), %r9	# 190	[c=9 l=7]  *movdi_internal/3
+	movq	960(%r15), %rax	# 191	[c=9 l=7]  *movdi_internal/3
+	movq	%rdx, %r10	# 1039	[c=4 l=3]  *movdi_internal/3
+	subq	%r9, %rcx	# 192	[c=4 l=3]  *subdi_1/0
+	subq	%rax, %r10	# 193	[c=4 l=3]  *subdi_1/0
+	movq	%rcx, %r11	# 1038	[c=4 l=3]  *movdi_internal/3
+	addsd	%xmm0, %xmm1	# 189	[c=12 l=4]  *fop_df_comm/1
+	movsd	%xmm1, -312(%rbp)	# 1036	[c=4 l=8]  *movdf_internal/15
+	cmpq	%rax, %rdx	# 194	[c=4 l=3]  *cmpdi_1/0
+	jnb	.L54	# 195	[c=13 l=2]  *jcc
+	subq	$1, %r11	# 197	[c=4 l=4]  *adddi_1/0
+	addq	$1000000, %r10	# 198	[c=4 l=7]  *adddi_1/0
+.L54:
+	testq	%r11, %r11	# 203	[c=4 l=3]  *cmpdi_ccno_1/0
+	js	.L55	# 204	[c=13 l=6]  *jcc
+	pxor	%xmm3, %xmm3	# 1367	[c=4 l=4]  movv2df_internal/0
+	cvtsi2sdq	%r11, %xmm3	# 1368	[c=4 l=5]  sse2_cvtsi2sdq/0
+.L56:
+	mulsd	%xmm5, %xmm3	# 216	[c=20 l=4]  *fop_df_comm/1
+	testq	%r10, %r10	# 219	[c=4 l=3]  *cmpdi_ccno_1/0
+	js	.L57	# 220	[c=13 l=6]  *jcc
+	pxor	%xmm1, %xmm1	# 1365	[c=4 l=4]  movv2df_internal/0
+	cvtsi2sdq	%r10, %xmm1	# 1366	[c=4 l=5]  sse2_cvtsi2sdq/0
+.L58:
+	mulsd	%xmm4, %xmm1	# 232	[c=20 l=4]  *fop_df_comm/1
+	movq	944(%r15), %rdx	# 234	[c=9 l=7]  *movdi_internal/3
+	movq	%rax, %r8	# 1049	[c=4 l=3]  *movdi_internal/3
+	subq	936(%r15), %r9	# 235	[c=13 l=7]  *subdi_1/1
+	subq	%rdx, %r8	# 236	[c=4 l=3]  *subdi_1/0
+	addsd	%xmm1, %xmm3	# 233	[c=12 l=4]  *fop_df_comm/1
+	cmpq	%rdx, %rax	# 237	[c=4 l=3]  *cmpdi_1/0
+	jnb	.L59	# 238	[c=13 l=2]  *jcc
+	subq	$1, %r9	# 240	[c=4 l=4]  *adddi_1/0
+	addq	$1000000, %r8	# 241	[c=4 l=7]  *adddi_1/0
+.L59:
+	testq	%r9, %r9	# 246	[c=4 l=3]  *cmpdi_ccno_1/0
+	js	.L60	# 247	[c=13 l=6]  *jcc
+	pxor	%xmm0, %xmm0	# 1363	[c=4 l=4]  movv2df_internal/0
+	cvtsi2sdq	%r9, %xmm0	# 1364	[c=4 l=5]  sse2_cvtsi2sdq/0
+.L61:
+	mulsd	%xmm5, %xmm0	# 259	[c=20 l=4]  *fop_df_comm/1
+	testq	%r8, %r8	# 262	[c=4 l=3]  *cmpdi_ccno_1/0
+	js	.L62	# 263	[c=13 l=6]  *jcc
+	pxor	%xmm1, %xmm1	# 1361	[c=4 l=4]  movv2df_internal/0
+	cvtsi2sdq	%r8, %xmm1	# 1362	[c=4 l=5]  sse2_cvtsi2sdq/0
+.L63:
+	mulsd	%xmm4, %xmm1	# 275	[c=20 l=4]  *fop_df_comm/1
+	movl	16(%r15), %esi	# 277	[c=9 l=4]  *movsi_internal/0
+	addsd	%xmm1, %xmm0	# 276	[c=12 l=4]  *fop_df_comm/1
+	comisd	.LC9(%rip), %xmm0	# 279	[c=10 l=8]  *cmpidf/1
+	pxor	%xmm1, %xmm1	# 20	[c=4 l=4]  *movdf_internal/12
+	jbe	.L64	# 280	[c=13 l=2]  *jcc
+	movl	%esi, %eax	# 285	[c=1 l=2]  *zero_extendsidi2/3
+	pxor	%xmm1, %xmm1	# 1359	[c=4 l=4]  movv2df_internal/0
+	cvtsi2sdq	%rax, %xmm1	# 1360	[c=4 l=5]  sse2_cvtsi2sdq/0
+	divsd	%xmm0, %xmm1	# 300	[c=68 l=4]  *fop_df_1/2
+.L64:
+	movl	$1000, %ecx	# 304	[c=4 l=5]  *movdi_internal/2
+	xorl	%edx, %edx	# 1268	[c=4 l=2]  *movdi_xor
+	movq	%r8, %rax	# 1059	[c=4 l=3]  *movdi_internal/3
+	movq	904(%r15), %rdi	# 313	[c=9 l=7]  *movdi_internal/3
+	divq	%rcx	# 1204	[c=0 l=3]  *udivmoddi4_noext
+	movl	$60, %ecx	# 307	[c=4 l=5]  *movdi_internal/2
+	xorl	%edx, %edx	# 1269	[c=4 l=2]  *movdi_xor
+	movq	%rax, -328(%rbp)	# 1060	[c=4 l=7]  *movdi_internal/5
+	movq	%r9, %rax	# 1061	[c=4 l=3]  *movdi_internal/3
+	divq	%rcx	# 1206	[c=0 l=3]  *udivmoddi4_noext
+	comisd	.LC9(%rip), %xmm2	# 315	[c=10 l=8]  *cmpidf/1
+	movq	%rdx, %rcx	# 1063	[c=4 l=3]  *movdi_internal/3
+	jbe	.L117	# 316	[c=13 l=6]  *jcc
+	movsd	.LC10(%rip), %xmm6	# 321	[c=6 l=8]  *movdf_internal/14
+	movq	%r10, -352(%rbp)	# 1140	[c=4 l=7]  *movdi_internal/5
+	movq	%rax, %rdx	# 333	[c=4 l=3]  *movdi_internal/3
+	movl	$2, %eax	# 337	[c=4 l=5]  *movqi_internal/3
+	movq	%r11, -344(%rbp)	# 1138	[c=4 l=7]  *movdi_internal/5
+	mulsd	%xmm6, %xmm0	# 322	[c=20 l=4]  *fop_df_comm/1
+	movsd	%xmm3, -360(%rbp)	# 1142	[c=4 l=8]  *movdf_internal/15
+	movsd	%xmm2, -336(%rbp)	# 1135	[c=4 l=8]  *movdf_internal/15
+	movsd	%xmm6, -320(%rbp)	# 1137	[c=4 l=8]  *movdf_internal/15
+	pushq	%r10	# 1267	[c=4 l=2]  *pushdi2_rex64/0
+	pushq	%rsi	# 325	[c=4 l=1]  *pushsi2_rex64/0
+	divsd	%xmm2, %xmm0	# 323	[c=68 l=4]  *fop_df_1/2
+	pushq	%rsi	# 326	[c=4 l=1]  *pushsi2_rex64/0
+	leaq	.LC11(%rip), %rsi	# 334	[c=1 l=7]  *movdi_internal/4
+	pushq	-328(%rbp)	# 327	[c=9 l=6]  *pushdi2_rex64/0
+	call	fprintf@PLT	# 338	[c=10 l=5]  *call_value
+	movl	24(%r15), %eax	# 1066	[c=9 l=4]  *movsi_internal/0
+	movsd	-360(%rbp), %xmm3	# 1143	[c=9 l=8]  *movdf_internal/14
+	addq	$32, %rsp	# 342	[c=4 l=4]  *adddi_1/0
+	movsd	-336(%rbp), %xmm2	# 1136	[c=9 l=8]  *movdf_internal/14
+	movq	-344(%rbp), %r11	# 1139	[c=9 l=7]  *movdi_internal/3
+	leal	1(%rax), %r8d	# 1202	[c=4 l=4]  *leasi
+	subl	20(%r15), %r8d	# 341	[c=13 l=4]  *subsi_1/1
+	movq	-352(%rbp), %r10	# 1141	[c=9 l=7]  *movdi_internal/3
+	comisd	.LC9(%rip), %xmm3	# 344	[c=10 l=8]  *cmpidf/1
+	jbe	.L130	# 345	[c=13 l=6]  *jcc
+.L70:
+	movl	%r8d, %eax	# 379	[c=1 l=3]  *zero_extendsidi2/3
+	pxor	%xmm1, %xmm1	# 1357	[c=4 l=4]  movv2df_internal/0
+	cvtsi2sdq	%rax, %xmm1	# 1358	[c=4 l=5]  sse2_cvtsi2sdq/0
+	divsd	%xmm3, %xmm1	# 394	[c=68 l=4]  *fop_df_1/2
+.L72:
+	comisd	.LC9(%rip), %xmm2	# 399	[c=10 l=8]  *cmpidf/1
+	movq	904(%r15), %rdi	# 397	[c=9 l=7]  *movdi_internal/3
+	ja	.L71	# 400	[c=13 l=6]  *jcc
+	movl	$60, %ecx	# 460	[c=4 l=5]  *movdi_internal/2
+	movq	%r11, %rax	# 1082	[c=4 l=3]  *movdi_internal/3
+	xorl	%edx, %edx	# 1256	[c=4 l=2]  *movdi_xor
+	movq	%r11, %r9	# 474	[c=4 l=3]  *movdi_internal/3
+	divq	%rcx	# 1194	[c=0 l=3]  *udivmoddi4_noext
+	movsd	%xmm2, -328(%rbp)	# 1155	[c=4 l=8]  *movdf_internal/15
+	pxor	%xmm0, %xmm0	# 473	[c=4 l=4]  *movdf_internal/12
+	movq	%rax, %rsi	# 1083	[c=4 l=3]  *movdi_internal/3
+	movq	%rdx, %rcx	# 1084	[c=4 l=3]  *movdi_internal/3
+	xorl	%edx, %edx	# 1259	[c=4 l=2]  *movdi_xor
+	pushq	%rax	# 1258	[c=4 l=1]  *pushdi2_rex64/0
+	movq	%r10, %rax	# 1085	[c=4 l=3]  *movdi_internal/3
+	pushq	%r8	# 465	[c=4 l=2]  *pushsi2_rex64/0
+	pushq	%r8	# 466	[c=4 l=2]  *pushsi2_rex64/0
+	movl	$1000, %r8d	# 468	[c=4 l=6]  *movdi_internal/2
+	divq	%r8	# 1196	[c=0 l=3]  *udivmoddi4_noext
+	movq	%rsi, %rdx	# 477	[c=4 l=3]  *movdi_internal/3
+	movq	%r10, %r8	# 475	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC12(%rip), %rsi	# 478	[c=1 l=7]  *movdi_internal/4
+	pushq	%rax	# 470	[c=4 l=1]  *pushdi2_rex64/0
+	movl	$2, %eax	# 481	[c=4 l=5]  *movqi_internal/3
+	call	fprintf@PLT	# 482	[c=10 l=5]  *call_value
+	movsd	-312(%rbp), %xmm7	# 1087	[c=9 l=8]  *movdf_internal/14
+	addq	$32, %rsp	# 484	[c=4 l=4]  *adddi_1/0
+	comisd	.LC9(%rip), %xmm7	# 486	[c=10 l=8]  *cmpidf/1
+	movsd	-328(%rbp), %xmm2	# 1156	[c=9 l=8]  *movdf_internal/14
+	jbe	.L131	# 487	[c=13 l=6]  *jcc
+.L83:
+	movq	40(%r15), %rax	# 440	[c=9 l=4]  *movdi_internal/3
+	testq	%rax, %rax	# 443	[c=4 l=3]  *cmpdi_ccno_1/0
+	js	.L80	# 444	[c=13 l=6]  *jcc
+	pxor	%xmm1, %xmm1	# 1355	[c=4 l=4]  movv2df_internal/0
+	cvtsi2sdq	%rax, %xmm1	# 1356	[c=4 l=5]  sse2_cvtsi2sdq/0
+.L81:
+	divsd	-312(%rbp), %xmm1	# 455	[c=77 l=8]  *fop_df_1/2
+.L82:
+	comisd	.LC9(%rip), %xmm2	# 492	[c=10 l=8]  *cmpidf/1
+	movq	904(%r15), %rdi	# 490	[c=9 l=7]  *movdi_internal/3
+	ja	.L78	# 493	[c=13 l=6]  *jcc
+	movq	-296(%rbp), %rax	# 1098	[c=9 l=7]  *movdi_internal/3
+	movl	$60, %ecx	# 544	[c=4 l=5]  *movdi_internal/2
+	xorl	%edx, %edx	# 1244	[c=4 l=2]  *movdi_xor
+	pushq	%r8	# 1246	[c=4 l=2]  *pushdi2_rex64/0
+	movl	$1000, %r8d	# 550	[c=4 l=6]  *movdi_internal/2
+	movq	-296(%rbp), %r9	# 556	[c=9 l=7]  *movdi_internal/3
+	pxor	%xmm0, %xmm0	# 555	[c=4 l=4]  *movdf_internal/12
+	divq	%rcx	# 1186	[c=0 l=3]  *udivmoddi4_noext
+	movq	%rax, %rsi	# 1099	[c=4 l=3]  *movdi_internal/3
+	movq	-304(%rbp), %rax	# 1101	[c=9 l=7]  *movdi_internal/3
+	movq	%rdx, %rcx	# 1100	[c=4 l=3]  *movdi_internal/3
+	xorl	%edx, %edx	# 1247	[c=4 l=2]  *movdi_xor
+	divq	%r8	# 1188	[c=0 l=3]  *udivmoddi4_noext
+	movq	-304(%rbp), %r8	# 557	[c=9 l=7]  *movdi_internal/3
+	movq	%rsi, %rdx	# 559	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC13(%rip), %rsi	# 560	[c=1 l=7]  *movdi_internal/4
+	pushq	%rax	# 552	[c=4 l=1]  *pushdi2_rex64/0
+	movl	$2, %eax	# 563	[c=4 l=5]  *movqi_internal/3
+	call	fprintf@PLT	# 564	[c=10 l=5]  *call_value
+	popq	%r9	# 1248	[c=9 l=2]  *popdi1
+	pxor	%xmm1, %xmm1	# 25	[c=4 l=4]  *movdf_internal/12
+	popq	%r10	# 1249	[c=9 l=2]  *popdi1
+.L88:
+	movq	-280(%rbp), %rax	# 1103	[c=9 l=7]  *movdi_internal/3
+	movl	$60, %ecx	# 569	[c=4 l=5]  *movdi_internal/2
+	xorl	%edx, %edx	# 1238	[c=4 l=2]  *movdi_xor
+	movl	$1000, %r8d	# 576	[c=4 l=6]  *movdi_internal/2
+	movq	904(%r15), %rdi	# 573	[c=9 l=7]  *movdi_internal/3
+	divq	%rcx	# 1182	[c=0 l=3]  *udivmoddi4_noext
+	movq	%rax, %rsi	# 1104	[c=4 l=3]  *movdi_internal/3
+	pushq	%rax	# 1240	[c=4 l=1]  *pushdi2_rex64/0
+	movq	-288(%rbp), %rax	# 1106	[c=9 l=7]  *movdi_internal/3
+	movq	%rdx, %rcx	# 1105	[c=4 l=3]  *movdi_internal/3
+	xorl	%edx, %edx	# 1241	[c=4 l=2]  *movdi_xor
+	movsd	-320(%rbp), %xmm0	# 580	[c=9 l=8]  *movdf_internal/14
+	movq	-280(%rbp), %r9	# 581	[c=9 l=7]  *movdi_internal/3
+	divq	%r8	# 1184	[c=0 l=3]  *udivmoddi4_noext
+	movq	-288(%rbp), %r8	# 582	[c=9 l=7]  *movdi_internal/3
+	movq	%rsi, %rdx	# 584	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC14(%rip), %rsi	# 585	[c=1 l=7]  *movdi_internal/4
+	pushq	%rax	# 578	[c=4 l=1]  *pushdi2_rex64/0
+	movl	$2, %eax	# 588	[c=4 l=5]  *movqi_internal/3
+	call	fprintf@PLT	# 589	[c=10 l=5]  *call_value
+	cmpl	$0, 216(%r15)	# 591	[c=13 l=8]  *cmpsi_ccno_1/1
+	popq	%rdx	# 1242	[c=9 l=1]  *popdi1
+	popq	%rcx	# 1243	[c=9 l=1]  *popdi1
+	je	.L41	# 592	[c=13 l=6]  *jcc
+	jmp	.L122	# 1288	[c=1 l=2]  jump
+.L124:
+	movl	(%r15), %edx	# 46	[c=6 l=3]  *zero_extendsidi2/3
+	salq	$4, %rdx	# 47	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r15), %rdx	# 49	[c=13 l=7]  *adddi_1/1
+	movzbl	11(%rdx), %ecx	# 50	[c=13 l=4]  zero_extendqidi2/0
+	subq	%rcx, %rax	# 51	[c=4 l=3]  *subdi_1/0
+	movq	%rax, 40(%r15)	# 52	[c=4 l=4]  *movdi_internal/5
+	movzwl	14(%rdx), %eax	# 53	[c=13 l=4]  zero_extendhidi2/0
+	subq	%rax, 48(%r15)	# 54	[c=13 l=4]  *subdi_1/0
+	jmp	.L38	# 1290	[c=1 l=5]  jump
+.L43:
+	cmpl	$0, 216(%r15)	# 765	[c=13 l=8]  *cmpsi_ccno_1/1
+	je	.L132	# 766	[c=13 l=6]  *jcc
+.L122:
+	movq	904(%r15), %rdi	# 758	[c=9 l=7]  *movdi_internal/3
+	call	fflush@PLT	# 760	[c=10 l=5]  *call_value
+.L89:
+	testl	%ebx, %ebx	# 701	[c=4 l=2]  *cmpsi_ccno_1/0
+	jne	.L95	# 702	[c=13 l=2]  *jcc
+	movl	76(%r15), %esi	# 704	[c=9 l=4]  *movsi_internal/0
+.L96:
+	movq	%r15, %rdi	# 718	[c=4 l=3]  *movdi_internal/3
+	call	finish	# 719	[c=0 l=5]  *call
+.L127:
+	leaq	.LC5(%rip), %rdx	# 27	[c=1 l=7]  *movdi_internal/4
+	jmp	.L91	# 1293	[c=1 l=5]  jump
+.L129:
+	movq	904(%r15), %rdi	# 673	[c=9 l=7]  *movdi_internal/3
+	leaq	.LC19(%rip), %rsi	# 675	[c=1 l=7]  *movdi_internal/4
+	xorl	%eax, %eax	# 1233	[c=4 l=2]  *movdi_xor
+	call	fprintf@PLT	# 679	[c=10 l=5]  *call_value
+	jmp	.L94	# 1295	[c=1 l=5]  jump
+.L128:
+	movq	904(%r15), %rdi	# 649	[c=9 l=7]  *movdi_internal/3
+	leaq	.LC17(%rip), %rsi	# 651	[c=1 l=7]  *movdi_internal/4
+	xorl	%eax, %eax	# 1235	[c=4 l=2]  *movdi_xor
+	call	fprintf@PLT	# 655	[c=10 l=5]  *call_value
+	jmp	.L93	# 1297	[c=1 l=5]  jump
+.L95:
+	imulq	$24, -264(%rbp), %rax	# 711	[c=25 l=8]  *muldi3_1/0
+	movl	20(%r14,%rax), %esi	# 714	[c=10 l=5]  *movsi_internal/0
+	jmp	.L96	# 1299	[c=1 l=2]  jump
+.L125:
+	movq	904(%r15), %rdi	# 723	[c=9 l=7]  *movdi_internal/3
+	call	fflush@PLT	# 725	[c=10 l=5]  *call_value
+	leaq	16(%rbp), %rax	# 1117	[c=4 l=4]  *leadi
+	movq	912(%r15), %r13	# 726	[c=9 l=7]  *movdi_internal/3
+	movl	$24, -256(%rbp)	# 728	[c=4 l=10]  *movsi_internal/1
+	movq	%rax, -248(%rbp)	# 730	[c=4 l=7]  *movdi_internal/5
+	leaq	-224(%rbp), %rax	# 1118	[c=4 l=7]  *leadi
+	movq	144(%r15), %rdx	# 737	[c=9 l=7]  *movdi_internal/3
+	leaq	.LC21(%rip), %rsi	# 740	[c=1 l=7]  *movdi_internal/4
+	movq	%rax, -240(%rbp)	# 731	[c=4 l=7]  *movdi_internal/5
+	imulq	$24, -264(%rbp), %rax	# 734	[c=25 l=8]  *muldi3_1/0
+	movq	%r13, %rdi	# 742	[c=4 l=3]  *movdi_internal/3
+	movl	$48, -252(%rbp)	# 729	[c=4 l=10]  *movsi_internal/1
+	movq	8(%r14,%rax), %rcx	# 738	[c=10 l=5]  *movdi_internal/3
+	xorl	%eax, %eax	# 1231	[c=4 l=2]  *movdi_xor
+	call	fprintf@PLT	# 744	[c=10 l=5]  *call_value
+	movq	-272(%rbp), %rdx	# 746	[c=9 l=7]  *movdi_internal/3
+	movq	%r12, %rsi	# 747	[c=4 l=3]  *movdi_internal/3
+	movq	%r13, %rdi	# 748	[c=4 l=3]  *movdi_internal/3
+	call	vfprintf@PLT	# 749	[c=10 l=5]  *call_value
+	movq	%r13, %rsi	# 750	[c=4 l=3]  *movdi_internal/3
+	movl	$10, %edi	# 751	[c=4 l=5]  *movsi_internal/0
+	call	fputc@PLT	# 752	[c=10 l=5]  *call_value
+	movq	%r13, %rdi	# 753	[c=4 l=3]  *movdi_internal/3
+	call	fflush@PLT	# 754	[c=10 l=5]  *call_value
+	jmp	.L89	# 1301	[c=1 l=5]  jump
+.L130:
+	movq	904(%r15), %rdi	# 876	[c=9 l=7]  *movdi_internal/3
+	pxor	%xmm1, %xmm1	# 22	[c=4 l=4]  *movdf_internal/12
+.L71:
+	movl	$60, %ecx	# 409	[c=4 l=5]  *movdi_internal/2
+	movq	%r11, %rax	# 1073	[c=4 l=3]  *movdi_internal/3
+	xorl	%edx, %edx	# 1260	[c=4 l=2]  *movdi_xor
+	movq	%r11, %r9	# 423	[c=4 l=3]  *movdi_internal/3
+	divq	%rcx	# 1198	[c=0 l=3]  *udivmoddi4_noext
+	movsd	%xmm2, -328(%rbp)	# 1153	[c=4 l=8]  *movdf_internal/15
+	mulsd	-320(%rbp), %xmm3	# 407	[c=29 l=8]  *fop_df_comm/1
+	divsd	%xmm2, %xmm3	# 408	[c=68 l=4]  *fop_df_1/2
+	movq	%rax, %rsi	# 1074	[c=4 l=3]  *movdi_internal/3
+	movq	%rdx, %rcx	# 1075	[c=4 l=3]  *movdi_internal/3
+	xorl	%edx, %edx	# 1263	[c=4 l=2]  *movdi_xor
+	pushq	%rax	# 1262	[c=4 l=1]  *pushdi2_rex64/0
+	movq	%r10, %rax	# 1076	[c=4 l=3]  *movdi_internal/3
+	pushq	%r8	# 415	[c=4 l=2]  *pushsi2_rex64/0
+	pushq	%r8	# 416	[c=4 l=2]  *pushsi2_rex64/0
+	movl	$1000, %r8d	# 418	[c=4 l=6]  *movdi_internal/2
+	divq	%r8	# 1200	[c=0 l=3]  *udivmoddi4_noext
+	movq	%rsi, %rdx	# 426	[c=4 l=3]  *movdi_internal/3
+	movq	%r10, %r8	# 424	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC12(%rip), %rsi	# 427	[c=1 l=7]  *movdi_internal/4
+	movapd	%xmm3, %xmm0	# 1072	[c=4 l=4]  *movdf_internal/13
+	pushq	%rax	# 420	[c=4 l=1]  *pushdi2_rex64/0
+	movl	$2, %eax	# 430	[c=4 l=5]  *movqi_internal/3
+	call	fprintf@PLT	# 431	[c=10 l=5]  *call_value
+	movsd	-312(%rbp), %xmm7	# 1078	[c=9 l=8]  *movdf_internal/14
+	addq	$32, %rsp	# 432	[c=4 l=4]  *adddi_1/0
+	comisd	.LC9(%rip), %xmm7	# 434	[c=10 l=8]  *cmpidf/1
+	movsd	-328(%rbp), %xmm2	# 1154	[c=9 l=8]  *movdf_internal/14
+	ja	.L83	# 435	[c=13 l=6]  *jcc
+	movq	904(%r15), %rdi	# 879	[c=9 l=7]  *movdi_internal/3
+	pxor	%xmm1, %xmm1	# 24	[c=4 l=4]  *movdf_internal/12
+.L78:
+	movq	-296(%rbp), %rax	# 1091	[c=9 l=7]  *movdi_internal/3
+	movl	$60, %ecx	# 502	[c=4 l=5]  *movdi_internal/2
+	xorl	%edx, %edx	# 1252	[c=4 l=2]  *movdi_xor
+	movsd	-312(%rbp), %xmm0	# 1088	[c=9 l=8]  *movdf_internal/14
+	mulsd	-320(%rbp), %xmm0	# 500	[c=29 l=8]  *fop_df_comm/1
+	movsd	%xmm2, -312(%rbp)	# 1159	[c=4 l=8]  *movdf_internal/15
+	movl	$1000, %r8d	# 509	[c=4 l=6]  *movdi_internal/2
+	divq	%rcx	# 1190	[c=0 l=3]  *udivmoddi4_noext
+	divsd	%xmm2, %xmm0	# 501	[c=68 l=4]  *fop_df_1/2
+	movq	%rax, %rsi	# 1092	[c=4 l=3]  *movdi_internal/3
+	pushq	%rax	# 1254	[c=4 l=1]  *pushdi2_rex64/0
+	movq	-304(%rbp), %rax	# 1094	[c=9 l=7]  *movdi_internal/3
+	movq	%rdx, %rcx	# 1093	[c=4 l=3]  *movdi_internal/3
+	xorl	%edx, %edx	# 1255	[c=4 l=2]  *movdi_xor
+	movq	-296(%rbp), %r9	# 514	[c=9 l=7]  *movdi_internal/3
+	divq	%r8	# 1192	[c=0 l=3]  *udivmoddi4_noext
+	movq	-304(%rbp), %r8	# 515	[c=9 l=7]  *movdi_internal/3
+	movq	%rsi, %rdx	# 517	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC13(%rip), %rsi	# 518	[c=1 l=7]  *movdi_internal/4
+	pushq	%rax	# 511	[c=4 l=1]  *pushdi2_rex64/0
+	movl	$2, %eax	# 521	[c=4 l=5]  *movqi_internal/3
+	call	fprintf@PLT	# 522	[c=10 l=5]  *call_value
+	movq	40(%r15), %rax	# 523	[c=9 l=4]  *movdi_internal/3
+	movsd	-312(%rbp), %xmm2	# 1160	[c=9 l=8]  *movdf_internal/14
+	testq	%rax, %rax	# 526	[c=4 l=3]  *cmpdi_ccno_1/0
+	js	.L86	# 527	[c=13 l=6]  *jcc
+	pxor	%xmm1, %xmm1	# 1353	[c=4 l=4]  movv2df_internal/0
+	cvtsi2sdq	%rax, %xmm1	# 1354	[c=4 l=5]  sse2_cvtsi2sdq/0
+.L87:
+	divsd	%xmm2, %xmm1	# 538	[c=68 l=4]  *fop_df_1/2
+	popq	%r11	# 1250	[c=9 l=2]  *popdi1
+	popq	%rax	# 1251	[c=9 l=1]  *popdi1
+	jmp	.L88	# 1303	[c=1 l=5]  jump
+.L117:
+	movq	%r10, -344(%rbp)	# 1149	[c=4 l=7]  *movdi_internal/5
+	pxor	%xmm0, %xmm0	# 357	[c=4 l=4]  *movdf_internal/12
+	movq	%r11, -336(%rbp)	# 1147	[c=4 l=7]  *movdi_internal/5
+	movsd	%xmm3, -352(%rbp)	# 1151	[c=4 l=8]  *movdf_internal/15
+	movsd	%xmm2, -320(%rbp)	# 1145	[c=4 l=8]  *movdf_internal/15
+	pushq	%rdx	# 1265	[c=4 l=1]  *pushdi2_rex64/0
+	movq	%rax, %rdx	# 361	[c=4 l=3]  *movdi_internal/3
+	movl	$2, %eax	# 365	[c=4 l=5]  *movqi_internal/3
+	pushq	%rsi	# 352	[c=4 l=1]  *pushsi2_rex64/0
+	pushq	%rsi	# 353	[c=4 l=1]  *pushsi2_rex64/0
+	leaq	.LC11(%rip), %rsi	# 362	[c=1 l=7]  *movdi_internal/4
+	pushq	-328(%rbp)	# 354	[c=9 l=6]  *pushdi2_rex64/0
+	call	fprintf@PLT	# 366	[c=10 l=5]  *call_value
+	movl	24(%r15), %eax	# 1067	[c=9 l=4]  *movsi_internal/0
+	movsd	-352(%rbp), %xmm3	# 1152	[c=9 l=8]  *movdf_internal/14
+	addq	$32, %rsp	# 370	[c=4 l=4]  *adddi_1/0
+	movsd	-320(%rbp), %xmm2	# 1146	[c=9 l=8]  *movdf_internal/14
+	movq	-336(%rbp), %r11	# 1148	[c=9 l=7]  *movdi_internal/3
+	leal	1(%rax), %r8d	# 1201	[c=4 l=4]  *leasi
+	subl	20(%r15), %r8d	# 369	[c=13 l=4]  *subsi_1/1
+	movq	-344(%rbp), %r10	# 1150	[c=9 l=7]  *movdi_internal/3
+	comisd	.LC9(%rip), %xmm3	# 372	[c=10 l=8]  *cmpidf/1
+	jbe	.L118	# 373	[c=13 l=6]  *jcc
+	movsd	.LC10(%rip), %xmm7	# 877	[c=6 l=8]  *movdf_internal/14
+	movsd	%xmm7, -320(%rbp)	# 1068	[c=4 l=8]  *movdf_internal/15
+	jmp	.L70	# 1305	[c=1 l=5]  jump
+.L50:
+	movq	-296(%rbp), %rsi	# 1132	[c=9 l=7]  *movdi_internal/3
+	pxor	%xmm1, %xmm1	# 1351	[c=4 l=4]  movv2df_internal/0
+	movq	%rsi, %rax	# 1026	[c=4 l=3]  *movdi_internal/3
+	andl	$1, %esi	# 166	[c=4 l=3]  *anddi_1/0
+	shrq	%rax	# 165	[c=4 l=3]  *lshrdi3_1/0
+	orq	%rsi, %rax	# 167	[c=4 l=3]  *iordi_1/0
+	cvtsi2sdq	%rax, %xmm1	# 1352	[c=4 l=5]  sse2_cvtsi2sdq/0
+	addsd	%xmm1, %xmm1	# 169	[c=12 l=4]  *fop_df_comm/1
+	jmp	.L51	# 1307	[c=1 l=5]  jump
+.L47:
+	movq	-288(%rbp), %rcx	# 1128	[c=9 l=7]  *movdi_internal/3
+	pxor	%xmm0, %xmm0	# 1349	[c=4 l=4]  movv2df_internal/0
+	movq	%rcx, %rdx	# 1013	[c=4 l=3]  *movdi_internal/3
+	andl	$1, %ecx	# 138	[c=4 l=3]  *anddi_1/0
+	shrq	%rdx	# 137	[c=4 l=3]  *lshrdi3_1/0
+	orq	%rcx, %rdx	# 139	[c=4 l=3]  *iordi_1/0
+	cvtsi2sdq	%rdx, %xmm0	# 1350	[c=4 l=5]  sse2_cvtsi2sdq/0
+	addsd	%xmm0, %xmm0	# 141	[c=12 l=4]  *fop_df_comm/1
+	jmp	.L48	# 1309	[c=1 l=5]  jump
+.L45:
+	movq	-280(%rbp), %rcx	# 1126	[c=9 l=7]  *movdi_internal/3
+	pxor	%xmm2, %xmm2	# 1347	[c=4 l=4]  movv2df_internal/0
+	movq	%rcx, %rdx	# 1008	[c=4 l=3]  *movdi_internal/3
+	andl	$1, %ecx	# 122	[c=4 l=3]  *anddi_1/0
+	shrq	%rdx	# 121	[c=4 l=3]  *lshrdi3_1/0
+	orq	%rcx, %rdx	# 123	[c=4 l=3]  *iordi_1/0
+	cvtsi2sdq	%rdx, %xmm2	# 1348	[c=4 l=5]  sse2_cvtsi2sdq/0
+	addsd	%xmm2, %xmm2	# 125	[c=12 l=4]  *fop_df_comm/1
+	jmp	.L46	# 1311	[c=1 l=5]  jump
+.L62:
+	movq	%r8, %rax	# 1055	[c=4 l=3]  *movdi_internal/3
+	movq	%r8, %rdx	# 1057	[c=4 l=3]  *movdi_internal/3
+	pxor	%xmm1, %xmm1	# 1345	[c=4 l=4]  movv2df_internal/0
+	shrq	%rax	# 268	[c=4 l=3]  *lshrdi3_1/0
+	andl	$1, %edx	# 269	[c=4 l=3]  *anddi_1/0
+	orq	%rdx, %rax	# 270	[c=4 l=3]  *iordi_1/0
+	cvtsi2sdq	%rax, %xmm1	# 1346	[c=4 l=5]  sse2_cvtsi2sdq/0
+	addsd	%xmm1, %xmm1	# 272	[c=12 l=4]  *fop_df_comm/1
+	jmp	.L63	# 1313	[c=1 l=5]  jump
+.L60:
+	movq	%r9, %rax	# 1051	[c=4 l=3]  *movdi_internal/3
+	movq	%r9, %rdx	# 1053	[c=4 l=3]  *movdi_internal/3
+	pxor	%xmm0, %xmm0	# 1343	[c=4 l=4]  movv2df_internal/0
+	shrq	%rax	# 252	[c=4 l=3]  *lshrdi3_1/0
+	andl	$1, %edx	# 253	[c=4 l=3]  *anddi_1/0
+	orq	%rdx, %rax	# 254	[c=4 l=3]  *iordi_1/0
+	cvtsi2sdq	%rax, %xmm0	# 1344	[c=4 l=5]  sse2_cvtsi2sdq/0
+	addsd	%xmm0, %xmm0	# 256	[c=12 l=4]  *fop_df_comm/1
+	jmp	.L61	# 1315	[c=1 l=5]  jump
+.L57:
+	movq	%r10, %rdx	# 1045	[c=4 l=3]  *movdi_internal/3
+	movq	%r10, %rcx	# 1047	[c=4 l=3]  *movdi_internal/3
+	pxor	%xmm1, %xmm1	# 1341	[c=4 l=4]  movv2df_internal/0
+	shrq	%rdx	# 225	[c=4 l=3]  *lshrdi3_1/0
+	andl	$1, %ecx	# 226	[c=4 l=3]  *anddi_1/0
+	orq	%rcx, %rdx	# 227	[c=4 l=3]  *iordi_1/0
+	cvtsi2sdq	%rdx, %xmm1	# 1342	[c=4 l=5]  sse2_cvtsi2sdq/0
+	addsd	%xmm1, %xmm1	# 229	[c=12 l=4]  *fop_df_comm/1
+	jmp	.L58	# 1317	[c=1 l=5]  jump
+.L55:
+	movq	%r11, %rdx	# 1041	[c=4 l=3]  *movdi_internal/3
+	movq	%r11, %rcx	# 1043	[c=4 l=3]  *movdi_internal/3
+	pxor	%xmm3, %xmm3	# 1339	[c=4 l=4]  movv2df_internal/0
+	shrq	%rdx	# 209	[c=4 l=3]  *lshrdi3_1/0
+	andl	$1, %ecx	# 210	[c=4 l=3]  *anddi_1/0
+	orq	%rcx, %rdx	# 211	[c=4 l=3]  *iordi_1/0
+	cvtsi2sdq	%rdx, %xmm3	# 1340	[c=4 l=5]  sse2_cvtsi2sdq/0
+	addsd	%xmm3, %xmm3	# 213	[c=12 l=4]  *fop_df_comm/1
+	jmp	.L56	# 1319	[c=1 l=5]  jump
+.L52:
+	movq	-304(%rbp), %rsi	# 1134	[c=9 l=7]  *movdi_internal/3
+	pxor	%xmm0, %xmm0	# 1337	[c=4 l=4]  movv2df_internal/0
+	movq	%rsi, %rax	# 1031	[c=4 l=3]  *movdi_internal/3
+	andl	$1, %esi	# 182	[c=4 l=3]  *anddi_1/0
+	shrq	%rax	# 181	[c=4 l=3]  *lshrdi3_1/0
+	orq	%rsi, %rax	# 183	[c=4 l=3]  *iordi_1/0
+	cvtsi2sdq	%rax, %xmm0	# 1338	[c=4 l=5]  sse2_cvtsi2sdq/0
+	addsd	%xmm0, %xmm0	# 185	[c=12 l=4]  *fop_df_comm/1
+	jmp	.L53	# 1321	[c=1 l=5]  jump
+.L131:
+	pxor	%xmm1, %xmm1	# 23	[c=4 l=4]  *movdf_internal/12
+	jmp	.L82	# 1323	[c=1 l=5]  jump
+.L118:
+	movsd	.LC10(%rip), %xmm6	# 878	[c=6 l=8]  *movdf_internal/14
+	pxor	%xmm1, %xmm1	# 21	[c=4 l=4]  *movdf_internal/12
+	movsd	%xmm6, -320(%rbp)	# 1069	[c=4 l=8]  *movdf_internal/15
+	jmp	.L72	# 1325	[c=1 l=5]  jump
+.L80:
+	movq	%rax, %rdx	# 1079	[c=4 l=3]  *movdi_internal/3
+	andl	$1, %eax	# 450	[c=4 l=3]  *anddi_1/0
+	pxor	%xmm1, %xmm1	# 1335	[c=4 l=4]  movv2df_internal/0
+	shrq	%rdx	# 449	[c=4 l=3]  *lshrdi3_1/0
+	orq	%rax, %rdx	# 451	[c=4 l=3]  *iordi_1/0
+	cvtsi2sdq	%rdx, %xmm1	# 1336	[c=4 l=5]  sse2_cvtsi2sdq/0
+	addsd	%xmm1, %xmm1	# 453	[c=12 l=4]  *fop_df_comm/1
+	jmp	.L81	# 1327	[c=1 l=5]  jump
+.L86:
+	movq	%rax, %rdx	# 1096	[c=4 l=3]  *movdi_internal/3
+	andl	$1, %eax	# 533	[c=4 l=3]  *anddi_1/0
+	pxor	%xmm1, %xmm1	# 1333	[c=4 l=4]  movv2df_internal/0
+	shrq	%rdx	# 532	[c=4 l=3]  *lshrdi3_1/0
+	orq	%rax, %rdx	# 534	[c=4 l=3]  *iordi_1/0
+	cvtsi2sdq	%rdx, %xmm1	# 1334	[c=4 l=5]  sse2_cvtsi2sdq/0
+	addsd	%xmm1, %xmm1	# 536	[c=12 l=4]  *fop_df_comm/1
+	jmp	.L87	# 1329	[c=1 l=5]  jump
+.L132:
+	leaq	-256(%rbp), %rax	# 880	[c=4 l=7]  *leadi
+	movq	%rax, -272(%rbp)	# 1120	[c=4 l=7]  *movdi_internal/5
+	jmp	.L41	# 1331	[c=1 l=5]  jump
+	.cfi_endproc
+.LFE21:
+	.size	leave, .-leave
+	.section	.rodata.str1.8
+	.align 8
+.LC22:
+	.string	"program counter 0x%x out of bounds (0x%x--0x%x)"
+	.text
+	.p2align 4
+	.type	bad_PC, @function
+bad_PC:
+.LFB67:
+	.cfi_startproc
+	subq	$8, %rsp	# 27	[c=4 l=4]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_def_cfa_offset 16
+	movl	24(%rdi), %eax	# 7	[c=9 l=3]  *movsi_internal/0
+	movl	20(%rdi), %r8d	# 12	[c=9 l=4]  *movsi_internal/0
+	leal	(%rsi,%rsi), %ecx	# 26	[c=12 l=3]  *leasi
+	leaq	.LC22(%rip), %rdx	# 14	[c=1 l=7]  *movdi_internal/4
+	movl	$1, %esi	# 16	[c=4 l=5]  *movsi_internal/0
+	leal	-1(%rax), %r9d	# 11	[c=4 l=4]  *leasi
+	xorl	%eax, %eax	# 34	[c=4 l=2]  *movdi_xor
+	call	leave	# 19	[c=0 l=5]  *call
+	.cfi_endproc
+.LFE67:
+	.size	bad_PC, .-bad_PC
+	.section	.rodata.str1.8
+	.align 8
+.LC23:
+	.string	"access to unmapped RAM address 0x%x (RAMEND = 0x%04x)"
+	.text
+	.p2align 4
+	.type	bad_address, @function
+bad_address:
+.LFB22:
+	.cfi_startproc
+	subq	$8, %rsp	# 22	[c=4 l=4]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_def_cfa_offset 16
+	movl	1000(%rdi), %r8d	# 8	[c=9 l=7]  *movsi_internal/0
+	movl	%esi, %ecx	# 3	[c=4 l=2]  *movsi_internal/0
+	xorl	%eax, %eax	# 29	[c=4 l=2]  *movdi_xor
+	leaq	.LC23(%rip), %rdx	# 10	[c=1 l=7]  *movdi_internal/4
+	movl	$1, %esi	# 12	[c=4 l=5]  *movsi_internal/0
+	call	leave	# 15	[c=0 l=5]  *call
+	.cfi_endproc
+.LFE22:
+	.size	bad_address, .-bad_address
+	.p2align 4
+	.type	data_read_mapped, @function
+data_read_mapped:
+.LFB27:
+	.cfi_startproc
+	movl	%esi, %eax	# 87	[c=4 l=2]  *movsi_internal/0
+	subl	5176(%rdi), %eax	# 8	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rdi), %eax	# 9	[c=13 l=6]  *cmpsi_1/1
+	jb	.L138	# 10	[c=13 l=2]  *jcc
+	movl	%esi, %eax	# 89	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %eax	# 12	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 85	[c=5 l=5]  *andsi_1_zext
+	movzbl	1080(%rdi,%rax), %eax	# 15	[c=10 l=8]  *movqi_internal/4
+	cmpb	$3, %al	# 16	[c=4 l=2]  *cmpqi_1/0
+	je	.L139	# 17	[c=13 l=2]  *jcc
+	cmpb	$4, %al	# 19	[c=4 l=2]  *cmpqi_1/0
+	je	.L140	# 20	[c=13 l=2]  *jcc
+	cmpb	$2, %al	# 22	[c=4 l=2]  *cmpqi_1/0
+	je	.L146	# 23	[c=13 l=2]  *jcc
+.L138:
+	subq	$8, %rsp	# 93	[c=4 l=4]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_def_cfa_offset 16
+	call	bad_address	# 61	[c=0 l=5]  *call
+	.p2align 4,,10
+	.p2align 3
+.L146:
+	.cfi_def_cfa_offset 8
+	movl	992(%rdi), %eax	# 25	[c=9 l=6]  *movsi_internal/0
+	subl	$16384, %esi	# 28	[c=4 l=6]  *addsi_1/0
+	movq	1056(%rdi), %rdx	# 31	[c=9 l=7]  *movdi_internal/3
+	leal	1(%rax,%rax), %eax	# 27	[c=8 l=4]  *leasi
+	andl	%esi, %eax	# 29	[c=4 l=2]  *andsi_1/0
+	cltq	# 30	[c=4 l=2]  *extendsidi2_rex64/0
+	movzbl	(%rdx,%rax), %eax	# 32	[c=13 l=4]  *zero_extendqisi2/0
+	ret		# 77	[c=0 l=1]  simple_return_internal
+	.p2align 4,,10
+	.p2align 3
+.L140:
+	movl	%esi, %eax	# 91	[c=4 l=2]  *movsi_internal/0
+	movq	1072(%rdi), %rdx	# 47	[c=9 l=7]  *movdi_internal/3
+	sarl	$12, %eax	# 44	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 84	[c=5 l=5]  *andsi_1_zext
+	movq	(%rdx,%rax,8), %rdx	# 48	[c=10 l=4]  *movdi_internal/3
+	xorl	%eax, %eax	# 109	[c=4 l=2]  *movdi_xor
+	testq	%rdx, %rdx	# 49	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L137	# 50	[c=13 l=2]  *jcc
+	andl	$4095, %esi	# 83	[c=5 l=6]  *andsi_1_zext
+	movzbl	(%rdx,%rsi), %eax	# 54	[c=13 l=4]  *zero_extendqisi2/0
+	ret		# 81	[c=0 l=1]  simple_return_internal
+	.p2align 4,,10
+	.p2align 3
+.L139:
+	movq	1048(%rdi), %rax	# 38	[c=9 l=7]  *movdi_internal/3
+	movslq	%esi, %rsi	# 37	[c=4 l=3]  *extendsidi2_rex64/1
+	movzbl	-4096(%rax,%rsi), %eax	# 39	[c=14 l=8]  *zero_extendqisi2/0
+	ret		# 79	[c=0 l=1]  simple_return_internal
+	.p2align 4,,10
+	.p2align 3
+.L137:
+	ret		# 100	[c=0 l=1]  simple_return_internal
+	.cfi_endproc
+.LFE27:
+	.size	data_read_mapped, .-data_read_mapped
+	.section	.rodata.str1.1
+.LC24:
+	.string	"{F:%04x} "
+	.text
+	.p2align 4
+	.type	data_read_page, @function
+data_read_page:
+.LFB37:
+	.cfi_startproc
+	pushq	%rbx	# 107	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	movslq	%esi, %rbx	# 3	[c=4 l=3]  *extendsidi2_rex64/1
+	movl	%ebx, %eax	# 100	[c=4 l=2]  *movsi_internal/0
+	subq	$16, %rsp	# 108	[c=4 l=4]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_def_cfa_offset 32
+	subl	5176(%rdi), %eax	# 8	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rdi), %eax	# 9	[c=13 l=6]  *cmpsi_1/1
+	jb	.L148	# 10	[c=13 l=2]  *jcc
+	movl	%ebx, %eax	# 102	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %eax	# 12	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 98	[c=5 l=5]  *andsi_1_zext
+	movzbl	1080(%rdi,%rax), %eax	# 15	[c=10 l=8]  *movqi_internal/4
+	cmpb	$1, %al	# 16	[c=4 l=2]  *cmpqi_1/0
+	je	.L149	# 17	[c=13 l=2]  *jcc
+	cmpb	$2, %al	# 19	[c=4 l=2]  *cmpqi_1/0
+	je	.L150	# 20	[c=13 l=2]  *jcc
+.L148:
+	addq	$16, %rsp	# 117	[c=4 l=4]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_remember_state
+	.cfi_def_cfa_offset 16
+	movl	%ebx, %esi	# 73	[c=4 l=2]  *movsi_internal/0
+	popq	%rbx	# 118	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 8
+	jmp	data_read_mapped	# 75	[c=10 l=5]  *sibcall_value
+	.p2align 4,,10
+	.p2align 3
+.L150:
+	.cfi_restore_state
+	leal	-16384(%rbx), %edx	# 106	[c=4 l=6]  *leasi
+	leaq	.LC24(%rip), %rsi	# 65	[c=1 l=7]  *movdi_internal/4
+	xorl	%eax, %eax	# 123	[c=4 l=2]  *movdi_xor
+	movq	%rdi, 8(%rsp)	# 104	[c=4 l=5]  *movdi_internal/5
+	call	log_append@PLT	# 69	[c=0 l=5]  *call
+	movq	8(%rsp), %rdi	# 105	[c=9 l=5]  *movdi_internal/3
+	movl	%ebx, %esi	# 125	[c=4 l=2]  *movsi_internal/0
+	addq	$1, 48(%rdi)	# 70	[c=13 l=5]  *adddi_1/0
+	addq	$16, %rsp	# 127	[c=4 l=4]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_remember_state
+	.cfi_def_cfa_offset 16
+	popq	%rbx	# 128	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 8
+	jmp	data_read_mapped	# 129	[c=10 l=5]  *sibcall_value
+	.p2align 4,,10
+	.p2align 3
+.L149:
+	.cfi_restore_state
+	cmpl	6564(%rdi), %ebx	# 26	[c=13 l=6]  *cmpsi_1/1
+	jnb	.L151	# 27	[c=13 l=2]  *jcc
+	movslq	%ebx, %rax	# 29	[c=4 l=3]  *extendsidi2_rex64/1
+	cmpb	$0, 6568(%rdi,%rax)	# 30	[c=14 l=8]  *cmpqi_ccno_1/1
+	je	.L151	# 31	[c=13 l=2]  *jcc
+	movq	48(%rdi), %rdx	# 41	[c=9 l=4]  *movdi_internal/3
+	addq	$16, %rsp	# 120	[c=4 l=4]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_remember_state
+	.cfi_def_cfa_offset 16
+	movl	%ebx, %esi	# 43	[c=4 l=2]  *movsi_internal/0
+	popq	%rbx	# 121	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 8
+	jmp	periph_read@PLT	# 45	[c=10 l=5]  *sibcall_value
+	.p2align 4,,10
+	.p2align 3
+.L151:
+	.cfi_restore_state
+	cmpl	%ebx, 1000(%rdi)	# 34	[c=13 l=6]  *cmpsi_1/0
+	jb	.L159	# 35	[c=13 l=2]  *jcc
+	movq	1040(%rdi), %rax	# 57	[c=9 l=7]  *movdi_internal/3
+	movzbl	(%rax,%rbx), %eax	# 58	[c=13 l=4]  *zero_extendqisi2/0
+	addq	$16, %rsp	# 111	[c=4 l=4]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_remember_state
+	.cfi_def_cfa_offset 16
+	popq	%rbx	# 112	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 8
+	ret		# 113	[c=0 l=1]  simple_return_internal
+.L159:
+	.cfi_restore_state
+	movl	%ebx, %esi	# 50	[c=4 l=2]  *movsi_internal/0
+	call	bad_address	# 52	[c=0 l=5]  *call
+	.cfi_endproc
+.LFE37:
+	.size	data_read_page, .-data_read_page
+	.section	.rodata.str1.8
+	.align 8
+.LC25:
+	.string	"stack pointer overflow (SP = 0x%04x)"
+	.text
+	.p2align 4
+	.type	stack_overflow, @function
+stack_overflow:
+.LFB63:
+	.cfi_startproc
+	movl	%esi, %ecx	# 3	[c=4 l=2]  *movsi_internal/0
+	subq	$8, %rsp	# 20	[c=4 l=4]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_def_cfa_offset 16
+	leaq	.LC25(%rip), %rdx	# 8	[c=1 l=7]  *movdi_internal/4
+	xorl	%eax, %eax	# 27	[c=4 l=2]  *movdi_xor
+	movl	$1, %esi	# 10	[c=4 l=5]  *movsi_internal/0
+	call	leave	# 13	[c=0 l=5]  *call
+	.cfi_endproc
+.LFE63:
+	.size	stack_overflow, .-stack_overflow
+	.section	.rodata.str1.1
+.LC26:
+	.string	"external memory"
+	.section	.rodata.str1.8
+	.align 8
+.LC27:
+	.string	"out of memory allocating %u * %u bytes for %s"
+	.text
+	.p2align 4
+	.type	data_write_mapped, @function
+data_write_mapped:
+.LFB28:
+	.cfi_startproc
+	pushq	%r12	# 121	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	movl	%esi, %eax	# 112	[c=4 l=2]  *movsi_internal/0
+	pushq	%rbp	# 122	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	movq	%rdi, %rbp	# 2	[c=4 l=3]  *movdi_internal/3
+	pushq	%rbx	# 123	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	movl	%esi, %ebx	# 3	[c=4 l=2]  *movsi_internal/0
+	subq	$16, %rsp	# 124	[c=4 l=4]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_def_cfa_offset 48
+	subl	5176(%rdi), %eax	# 8	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rdi), %eax	# 9	[c=13 l=6]  *cmpsi_1/1
+	jb	.L163	# 10	[c=13 l=2]  *jcc
+	movl	%esi, %eax	# 114	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %eax	# 12	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 110	[c=5 l=5]  *andsi_1_zext
+	movzbl	1080(%rdi,%rax), %eax	# 15	[c=10 l=8]  *movqi_internal/4
+	cmpb	$3, %al	# 16	[c=4 l=2]  *cmpqi_1/0
+	je	.L164	# 17	[c=13 l=2]  *jcc
+	cmpb	$4, %al	# 19	[c=4 l=2]  *cmpqi_1/0
+	jne	.L163	# 20	[c=13 l=2]  *jcc
+	movl	%esi, %eax	# 116	[c=4 l=2]  *movsi_internal/0
+	movq	1072(%rdi), %rcx	# 38	[c=9 l=7]  *movdi_internal/3
+	sarl	$12, %eax	# 34	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 109	[c=5 l=5]  *andsi_1_zext
+	leaq	(%rcx,%rax,8), %r12	# 39	[c=8 l=4]  *leadi
+	movq	(%r12), %rax	# 40	[c=5 l=4]  *movdi_internal/3
+	testq	%rax, %rax	# 41	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L175	# 42	[c=13 l=2]  *jcc
+.L166:
+	andl	$4095, %ebx	# 108	[c=5 l=6]  *andsi_1_zext
+	movb	%dl, (%rax,%rbx)	# 79	[c=4 l=3]  *movqi_internal/8
+	addq	$16, %rsp	# 127	[c=4 l=4]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_remember_state
+	.cfi_def_cfa_offset 32
+	popq	%rbx	# 128	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 24
+	popq	%rbp	# 129	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 16
+	popq	%r12	# 130	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 8
+	ret		# 131	[c=0 l=1]  simple_return_internal
+	.p2align 4,,10
+	.p2align 3
+.L164:
+	.cfi_restore_state
+	addq	$16, %rsp	# 135	[c=4 l=4]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_remember_state
+	.cfi_def_cfa_offset 32
+	leal	-4096(%rsi), %esi	# 120	[c=4 l=6]  *leasi
+	popq	%rbx	# 136	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 24
+	popq	%rbp	# 137	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 16
+	popq	%r12	# 138	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 8
+	jmp	eeprom_write_mapped@PLT	# 30	[c=0 l=5]  *sibcall
+	.p2align 4,,10
+	.p2align 3
+.L163:
+	.cfi_restore_state
+	movl	%ebx, %esi	# 84	[c=4 l=2]  *movsi_internal/0
+	movq	%rbp, %rdi	# 85	[c=4 l=3]  *movdi_internal/3
+	call	bad_address	# 86	[c=0 l=5]  *call
+	.p2align 4,,10
+	.p2align 3
+.L175:
+	movl	$4128, %esi	# 44	[c=4 l=5]  *movdi_internal/2
+	movl	$1, %edi	# 45	[c=4 l=5]  *movdi_internal/2
+	movl	%edx, 12(%rsp)	# 118	[c=4 l=4]  *movsi_internal/1
+	call	calloc@PLT	# 46	[c=10 l=5]  *call_value
+	movl	12(%rsp), %edx	# 119	[c=9 l=4]  *movsi_internal/0
+	testq	%rax, %rax	# 49	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L176	# 50	[c=13 l=2]  *jcc
+	movq	984(%rbp), %rcx	# 64	[c=9 l=7]  *movdi_internal/3
+	movq	%rcx, (%rax)	# 65	[c=4 l=3]  *movdi_internal/5
+	testq	%rcx, %rcx	# 66	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L168	# 67	[c=13 l=2]  *jcc
+	movq	%rax, 8(%rcx)	# 69	[c=4 l=4]  *movdi_internal/5
+.L168:
+	movq	%rax, 984(%rbp)	# 72	[c=4 l=7]  *movdi_internal/5
+	addq	$32, %rax	# 73	[c=4 l=4]  *adddi_1/0
+	movq	%rax, (%r12)	# 74	[c=4 l=4]  *movdi_internal/5
+	jmp	.L166	# 142	[c=1 l=5]  jump
+.L176:
+	leaq	.LC26(%rip), %r9	# 52	[c=1 l=7]  *movdi_internal/4
+	movl	$1, %r8d	# 53	[c=4 l=6]  *movsi_internal/0
+	movq	%rbp, %rdi	# 58	[c=4 l=3]  *movdi_internal/3
+	movl	$4096, %ecx	# 54	[c=4 l=5]  *movsi_internal/0
+	leaq	.LC27(%rip), %rdx	# 55	[c=1 l=7]  *movdi_internal/4
+	movl	$6, %esi	# 57	[c=4 l=5]  *movsi_internal/0
+	call	leave	# 60	[c=0 l=5]  *call
+	.cfi_endproc
+.LFE28:
+	.size	data_write_mapped, .-data_write_mapped
+	.p2align 4
+	.type	data_write_page, @function
+data_write_page:
+.LFB38:
+	.cfi_startproc
+	movl	%esi, %eax	# 84	[c=4 l=2]  *movsi_internal/0
+	subl	5176(%rdi), %eax	# 9	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rdi), %eax	# 10	[c=13 l=6]  *cmpsi_1/1
+	jb	.L178	# 11	[c=13 l=2]  *jcc
+	movl	%esi, %eax	# 86	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %eax	# 13	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 82	[c=5 l=5]  *andsi_1_zext
+	cmpb	$1, 1080(%rdi,%rax)	# 16	[c=14 l=8]  *cmpqi_1/0
+	je	.L179	# 17	[c=13 l=2]  *jcc
+.L178:
+	jmp	data_write_mapped	# 23	[c=0 l=5]  *sibcall
+	.p2align 4,,10
+	.p2align 3
+.L179:
+	cmpl	$63, %esi	# 27	[c=4 l=3]  *cmpsi_1/0
+	je	.L190	# 28	[c=13 l=2]  *jcc
+	cmpl	6564(%rdi), %esi	# 36	[c=13 l=6]  *cmpsi_1/1
+	jnb	.L182	# 37	[c=13 l=2]  *jcc
+	movslq	%esi, %rax	# 39	[c=4 l=3]  *extendsidi2_rex64/1
+	cmpb	$0, 6568(%rdi,%rax)	# 40	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L183	# 41	[c=13 l=2]  *jcc
+.L182:
+	cmpl	%esi, 1000(%rdi)	# 44	[c=13 l=6]  *cmpsi_1/0
+	jb	.L191	# 45	[c=13 l=2]  *jcc
+	movq	1040(%rdi), %rax	# 67	[c=9 l=7]  *movdi_internal/3
+	movslq	%esi, %rsi	# 66	[c=4 l=3]  *extendsidi2_rex64/1
+	movb	%dl, (%rax,%rsi)	# 68	[c=4 l=3]  *movqi_internal/8
+	ret		# 95	[c=0 l=1]  simple_return_internal
+	.p2align 4,,10
+	.p2align 3
+.L190:
+	movq	1040(%rdi), %rax	# 30	[c=9 l=7]  *movdi_internal/3
+	movb	%dl, 63(%rax)	# 31	[c=4 l=3]  *movqi_internal/8
+	ret		# 76	[c=0 l=1]  simple_return_internal
+	.p2align 4,,10
+	.p2align 3
+.L183:
+	movq	48(%rdi), %rcx	# 51	[c=9 l=4]  *movdi_internal/3
+	jmp	periph_write@PLT	# 56	[c=0 l=5]  *sibcall
+.L191:
+	pushq	%rax	# 108	[c=4 l=1]  *pushdi2_prologue
+	.cfi_def_cfa_offset 16
+	call	bad_address	# 62	[c=0 l=5]  *call
+	.cfi_endproc
+.LFE38:
+	.size	data_write_page, .-data_write_page
+	.section	.rodata.str1.1
+.LC28:
+	.string	"(SREG)<-'%s' "
+.LC29:
+	.string	"(%s)<-%02x "
+.LC30:
+	.string	"(%s)->%04x "
+.LC31:
+	.string	"(%s)<-%04x "
+.LC32:
+	.string	"(SREG)->'%s' "
+	.text
+	.p2align 4
+	.type	do_events, @function
+do_events:
+.LFB207:
+	.cfi_startproc
+	pushq	%r15	# 556	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14	# 557	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13	# 558	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12	# 559	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp	# 560	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx	# 561	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	movq	%rdi, %rbx	# 2	[c=4 l=3]  *movdi_internal/3
+	subq	$24, %rsp	# 562	[c=4 l=4]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_def_cfa_offset 80
+	cmpb	$0, 6040(%rdi)	# 12	[c=13 l=7]  *cmpqi_ccno_1/1
+	jne	.L239	# 13	[c=13 l=6]  *jcc
+.L194:
+	movq	%rbx, %rdi	# 44	[c=4 l=3]  *movdi_internal/3
+	call	events_run@PLT	# 45	[c=0 l=5]  *call
+	movq	1040(%rbx), %rax	# 46	[c=9 l=7]  *movdi_internal/3
+	cmpb	$0, 63(%rax)	# 49	[c=13 l=4]  *cmpqi_ccno_1/1
+	jns	.L238	# 50	[c=13 l=6]  *jcc
+	movq	6024(%rbx), %rax	# 57	[c=9 l=7]  *movdi_internal/3
+	cmpq	%rax, 48(%rbx)	# 58	[c=13 l=4]  *cmpdi_1/0
+	je	.L197	# 59	[c=13 l=6]  *jcc
+	movq	%rbx, %rdi	# 61	[c=4 l=3]  *movdi_internal/3
+	call	irq_take@PLT	# 62	[c=10 l=5]  *call_value
+	movl	%eax, %r12d	# 63	[c=4 l=3]  *movsi_internal/0
+	testl	%eax, %eax	# 66	[c=4 l=2]  *cmpsi_ccno_1/0
+	js	.L238	# 67	[c=13 l=6]  *jcc
+	movl	%eax, %esi	# 74	[c=4 l=2]  *movsi_internal/0
+	movq	%rbx, %rdi	# 75	[c=4 l=3]  *movdi_internal/3
+	call	periph_irq_taken@PLT	# 76	[c=0 l=5]  *call
+	movl	%r12d, %esi	# 77	[c=4 l=3]  *movsi_internal/0
+	movq	%rbx, %rdi	# 78	[c=4 l=3]  *movdi_internal/3
+	call	log_add_irq@PLT	# 79	[c=0 l=5]  *call
+	movl	$61, %eax	# 82	[c=4 l=5]  *movsi_internal/0
+	movl	5176(%rbx), %r13d	# 80	[c=9 l=7]  *movsi_internal/0
+	movl	5180(%rbx), %ebp	# 81	[c=9 l=6]  *movsi_internal/0
+	subl	%r13d, %eax	# 83	[c=4 l=3]  *subsi_1/0
+	cmpl	%ebp, %eax	# 84	[c=4 l=2]  *cmpsi_1/0
+	jb	.L199	# 85	[c=13 l=6]  *jcc
+	cmpb	$1, 1081(%rbx)	# 89	[c=13 l=7]  *cmpqi_1/0
+	ja	.L240	# 90	[c=13 l=6]  *jcc
+	movq	1040(%rbx), %rax	# 418	[c=9 l=7]  *movdi_internal/3
+	movzbl	61(%rax), %r14d	# 419	[c=13 l=5]  *zero_extendqisi2/0
+.L203:
+	movzbl	62(%rax), %ebp	# 129	[c=13 l=4]  *zero_extendqisi2/0
+.L204:
+	sall	$8, %ebp	# 132	[c=4 l=3]  *ashlsi3_1/0
+	movl	$61, %edx	# 135	[c=4 l=5]  *movsi_internal/0
+	leaq	.LC30(%rip), %rsi	# 136	[c=1 l=7]  *movdi_internal/4
+	movq	%rbx, %rdi	# 138	[c=4 l=3]  *movdi_internal/3
+	orl	%r14d, %ebp	# 133	[c=4 l=3]  *iorsi_1/0
+	movl	%ebp, %ecx	# 134	[c=4 l=2]  *movsi_internal/0
+	call	log_add_data_mov@PLT	# 139	[c=0 l=5]  *call
+	movl	996(%rbx), %edx	# 141	[c=9 l=6]  *movsi_internal/0
+	movzbl	840(%rbx), %eax	# 143	[c=13 l=7]  *zero_extendqisi2/0
+	leal	1(%rdx,%rax), %eax	# 144	[c=5 l=4]  *leasi
+	cmpl	%eax, %ebp	# 145	[c=4 l=2]  *cmpsi_1/0
+	jb	.L241	# 146	[c=13 l=6]  *jcc
+	cmpl	$63, %ebp	# 476	[c=4 l=3]  *cmpsi_1/0
+	movl	(%rbx), %r13d	# 154	[c=5 l=3]  *movsi_internal/0
+	leaq	.LC28(%rip), %r14	# 4	[c=1 l=7]  *movdi_internal/4
+	movl	%ebp, %edx	# 163	[c=4 l=2]  *movsi_internal/0
+	leaq	.LC29(%rip), %rsi	# 524	[c=1 l=7]  *movdi_internal/4
+	movq	%rbx, %rdi	# 165	[c=4 l=3]  *movdi_internal/3
+	leal	-1(%rbp), %r15d	# 553	[c=4 l=4]  *leasi
+	cmove	%r14, %rsi	# 477	[c=8 l=4]  *movdicc_noc/0
+	movzbl	%r13b, %ecx	# 156	[c=4 l=4]  *zero_extendqisi2/0
+	call	log_add_data_mov@PLT	# 166	[c=0 l=5]  *call
+	movl	%ebp, %edx	# 527	[c=4 l=2]  *movsi_internal/0
+	subl	5176(%rbx), %edx	# 167	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %edx	# 168	[c=13 l=6]  *cmpsi_1/1
+	jb	.L207	# 169	[c=13 l=2]  *jcc
+	movl	%ebp, %edx	# 529	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %edx	# 171	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %edx	# 519	[c=5 l=6]  *andsi_1_zext
+	cmpb	$0, 1080(%rbx,%rdx)	# 174	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L208	# 175	[c=13 l=6]  *jcc
+.L207:
+	movq	1040(%rbx), %rcx	# 179	[c=9 l=7]  *movdi_internal/3
+	movslq	%ebp, %rdx	# 178	[c=4 l=3]  *extendsidi2_rex64/1
+	movb	%r13b, (%rcx,%rdx)	# 180	[c=4 l=4]  *movqi_internal/8
+.L209:
+	movl	(%rbx), %ecx	# 191	[c=5 l=2]  *movsi_internal/0
+	leaq	.LC29(%rip), %rdx	# 521	[c=1 l=7]  *movdi_internal/4
+	movq	%rbx, %rdi	# 203	[c=4 l=3]  *movdi_internal/3
+	leal	-2(%rbp), %r13d	# 552	[c=4 l=4]  *leasi
+	leaq	.LC28(%rip), %rsi	# 520	[c=1 l=7]  *movdi_internal/4
+	movl	%ecx, %eax	# 531	[c=4 l=2]  *movsi_internal/0
+	movzbl	%ch, %ecx	# 194	[c=4 l=3]  *extzvsi
+	shrl	$8, %eax	# 192	[c=4 l=3]  *lshrsi3_1/0
+	cmpl	$63, %r15d	# 449	[c=4 l=4]  *cmpsi_1/0
+	cmovne	%rdx, %rsi	# 450	[c=8 l=4]  *movdicc_noc/1
+	movl	%r15d, %edx	# 201	[c=4 l=3]  *movsi_internal/0
+	movl	%eax, 12(%rsp)	# 532	[c=4 l=4]  *movsi_internal/1
+	call	log_add_data_mov@PLT	# 204	[c=0 l=5]  *call
+	movl	%r15d, %edx	# 533	[c=4 l=3]  *movsi_internal/0
+	subl	5176(%rbx), %edx	# 205	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %edx	# 206	[c=13 l=6]  *cmpsi_1/1
+	jb	.L211	# 207	[c=13 l=2]  *jcc
+	movl	%r15d, %edx	# 535	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %edx	# 209	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %edx	# 518	[c=5 l=6]  *andsi_1_zext
+	cmpb	$0, 1080(%rbx,%rdx)	# 212	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L212	# 213	[c=13 l=6]  *jcc
+.L211:
+	movq	1040(%rbx), %rdx	# 217	[c=9 l=7]  *movdi_internal/3
+	movzbl	12(%rsp), %ecx	# 537	[c=9 l=5]  *movqi_internal/4
+	movslq	%r15d, %rax	# 216	[c=4 l=3]  *extendsidi2_rex64/1
+	movb	%cl, (%rdx,%rax)	# 218	[c=4 l=3]  *movqi_internal/8
+.L213:
+	cmpb	$0, 840(%rbx)	# 229	[c=13 l=7]  *cmpqi_ccno_1/1
+	je	.L214	# 230	[c=13 l=2]  *jcc
+	movl	(%rbx), %r15d	# 538	[c=5 l=3]  *movsi_internal/0
+	leaq	.LC29(%rip), %rax	# 523	[c=1 l=7]  *movdi_internal/4
+	movl	%r13d, %edx	# 241	[c=4 l=3]  *movsi_internal/0
+	movq	%rbx, %rdi	# 243	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC28(%rip), %rsi	# 522	[c=1 l=7]  *movdi_internal/4
+	shrl	$16, %r15d	# 233	[c=4 l=4]  *lshrsi3_1/0
+	cmpl	$63, %r13d	# 453	[c=4 l=4]  *cmpsi_1/0
+	cmovne	%rax, %rsi	# 454	[c=8 l=4]  *movdicc_noc/1
+	movzbl	%r15b, %ecx	# 234	[c=4 l=4]  *zero_extendqisi2/0
+	call	log_add_data_mov@PLT	# 244	[c=0 l=5]  *call
+	movl	%r13d, %eax	# 540	[c=4 l=3]  *movsi_internal/0
+	subl	5176(%rbx), %eax	# 245	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %eax	# 246	[c=13 l=6]  *cmpsi_1/1
+	jb	.L216	# 247	[c=13 l=2]  *jcc
+	movl	%r13d, %eax	# 542	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %eax	# 249	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 517	[c=5 l=5]  *andsi_1_zext
+	cmpb	$0, 1080(%rbx,%rax)	# 252	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L217	# 253	[c=13 l=6]  *jcc
+.L216:
+	movq	1040(%rbx), %rax	# 257	[c=9 l=7]  *movdi_internal/3
+	movslq	%r13d, %r13	# 256	[c=4 l=3]  *extendsidi2_rex64/1
+	movb	%r15b, (%rax,%r13)	# 258	[c=4 l=4]  *movqi_internal/8
+.L218:
+	leal	-3(%rbp), %r13d	# 551	[c=4 l=4]  *leasi
+	.p2align 4,,10
+	.p2align 3
+.L214:
+	movzwl	%r13w, %ebp	# 272	[c=4 l=4]  *zero_extendhisi2/0
+	movl	$61, %edx	# 274	[c=4 l=5]  *movsi_internal/0
+	leaq	.LC31(%rip), %rsi	# 275	[c=1 l=7]  *movdi_internal/4
+	movq	%rbx, %rdi	# 277	[c=4 l=3]  *movdi_internal/3
+	movl	%ebp, %ecx	# 273	[c=4 l=2]  *movsi_internal/0
+	call	log_add_data_mov@PLT	# 278	[c=0 l=5]  *call
+	movl	$61, %eax	# 279	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%rbx), %eax	# 280	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %eax	# 281	[c=13 l=6]  *cmpsi_1/1
+	jb	.L219	# 282	[c=13 l=2]  *jcc
+	cmpb	$1, 1081(%rbx)	# 286	[c=13 l=7]  *cmpqi_1/0
+	ja	.L242	# 287	[c=13 l=6]  *jcc
+.L219:
+	movq	1040(%rbx), %rax	# 298	[c=9 l=7]  *movdi_internal/3
+	movb	%r13b, 61(%rax)	# 299	[c=4 l=4]  *movqi_internal/8
+.L220:
+	movl	$62, %eax	# 303	[c=4 l=5]  *movsi_internal/0
+	sarl	$8, %ebp	# 302	[c=4 l=3]  *ashrsi3_1/0
+	subl	5176(%rbx), %eax	# 304	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %eax	# 305	[c=13 l=6]  *cmpsi_1/1
+	jb	.L221	# 306	[c=13 l=2]  *jcc
+	cmpb	$1, 1081(%rbx)	# 310	[c=13 l=7]  *cmpqi_1/0
+	ja	.L243	# 311	[c=13 l=6]  *jcc
+.L221:
+	movq	1040(%rbx), %rax	# 321	[c=9 l=7]  *movdi_internal/3
+	movb	%bpl, 62(%rax)	# 322	[c=4 l=4]  *movqi_internal/8
+.L222:
+	movl	$63, %eax	# 325	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%rbx), %eax	# 326	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %eax	# 327	[c=13 l=6]  *cmpsi_1/1
+	jb	.L223	# 328	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%rbx)	# 330	[c=13 l=7]  *cmpqi_ccno_1/1
+	jne	.L224	# 331	[c=13 l=6]  *jcc
+.L223:
+	movq	1040(%rbx), %rax	# 334	[c=9 l=7]  *movdi_internal/3
+	movzbl	63(%rax), %ebp	# 335	[c=13 l=4]  *zero_extendqisi2/0
+.L225:
+	movl	%ebp, %ecx	# 346	[c=4 l=2]  *movsi_internal/0
+	movl	$63, %edx	# 347	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 350	[c=4 l=3]  *movdi_internal/3
+	movl	%ebp, %r13d	# 544	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC32(%rip), %rsi	# 348	[c=1 l=7]  *movdi_internal/4
+	andb	$127, %r13b	# 548	[c=4 l=4]  *andqi_1_slp/0
+	call	log_add_data_mov@PLT	# 351	[c=0 l=5]  *call
+	movl	%ebp, %ecx	# 546	[c=4 l=2]  *movsi_internal/0
+	movl	$63, %edx	# 355	[c=4 l=5]  *movsi_internal/0
+	movq	%r14, %rsi	# 357	[c=4 l=3]  *movdi_internal/3
+	andl	$127, %ecx	# 353	[c=4 l=3]  *andsi_1/0
+	movq	%rbx, %rdi	# 358	[c=4 l=3]  *movdi_internal/3
+	call	log_add_data_mov@PLT	# 359	[c=0 l=5]  *call
+	movl	$63, %eax	# 360	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%rbx), %eax	# 361	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %eax	# 362	[c=13 l=6]  *cmpsi_1/1
+	jb	.L229	# 363	[c=13 l=2]  *jcc
+	movzbl	1081(%rbx), %eax	# 365	[c=9 l=7]  *movqi_internal/4
+	testb	%al, %al	# 366	[c=4 l=2]  *cmpqi_ccno_1/0
+	jne	.L227	# 367	[c=13 l=6]  *jcc
+.L229:
+	movq	1040(%rbx), %rax	# 387	[c=9 l=7]  *movdi_internal/3
+	movb	%r13b, 63(%rax)	# 388	[c=4 l=4]  *movqi_internal/8
+.L228:
+	movzbl	840(%rbx), %eax	# 393	[c=13 l=7]  zero_extendqidi2/0
+	movl	%r12d, (%rbx)	# 391	[c=4 l=3]  *movsi_internal/1
+	movq	%rbx, %rdi	# 396	[c=4 l=3]  *movdi_internal/3
+	addq	$4, %rax	# 596	[c=4 l=4]  *adddi_1/0
+	addq	%rax, 48(%rbx)	# 395	[c=13 l=4]  *adddi_1/0
+	call	log_dump_irq@PLT	# 397	[c=0 l=5]  *call
+.L238:
+	movq	48(%rbx), %rax	# 398	[c=9 l=4]  *movdi_internal/3
+.L197:
+	cmpq	6032(%rbx), %rax	# 401	[c=13 l=7]  *cmpdi_1/1
+	jnb	.L244	# 402	[c=13 l=2]  *jcc
+	addq	$24, %rsp	# 565	[c=4 l=4]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx	# 566	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 48
+	popq	%rbp	# 567	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 40
+	popq	%r12	# 568	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 32
+	popq	%r13	# 569	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 24
+	popq	%r14	# 570	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 16
+	popq	%r15	# 571	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 8
+	ret		# 572	[c=0 l=1]  simple_return_internal
+	.p2align 4,,10
+	.p2align 3
+.L239:
+	.cfi_restore_state
+	call	fork_server_poll@PLT	# 20	[c=10 l=5]  *call_value
+	testb	%al, %al	# 23	[c=4 l=2]  *cmpqi_ccno_1/0
+	je	.L194	# 24	[c=13 l=6]  *jcc
+	movl	820(%rbx), %edx	# 26	[c=9 l=6]  *movsi_internal/0
+	movzwl	816(%rbx), %eax	# 33	[c=13 l=7]  *zero_extendhisi2/0
+	movzbl	%dh, %ecx	# 34	[c=4 l=3]  *extzvsi
+	sall	$8, %eax	# 35	[c=4 l=3]  *ashlsi3_1/0
+	movzbl	%dl, %edx	# 37	[c=4 l=3]  *zero_extendqisi2/0
+	orl	%ecx, %eax	# 36	[c=4 l=2]  *iorsi_1/0
+	sall	$8, %eax	# 38	[c=4 l=3]  *ashlsi3_1/0
+	orl	%edx, %eax	# 40	[c=4 l=2]  *iorsi_1/0
+	movl	%eax, 1026(%rbx)	# 41	[c=4 l=6]  *movv4qi_internal/1
+	jmp	.L194	# 603	[c=1 l=5]  jump
+	.p2align 4,,10
+	.p2align 3
+.L244:
+	movq	%rbx, %rdi	# 404	[c=4 l=3]  *movdi_internal/3
+	call	checkpoint_begin@PLT	# 405	[c=0 l=5]  *call
+	movq	%rbx, %rdi	# 407	[c=4 l=3]  *movdi_internal/3
+	xorl	%esi, %esi	# 595	[c=4 l=2]  *movdi_xor
+	call	log_checkpoint@PLT	# 408	[c=0 l=5]  *call
+	addq	$24, %rsp	# 576	[c=4 l=4]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	movq	%rbx, %rdi	# 409	[c=4 l=3]  *movdi_internal/3
+	popq	%rbx	# 577	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 48
+	popq	%rbp	# 578	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 40
+	popq	%r12	# 579	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 32
+	popq	%r13	# 580	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 24
+	popq	%r14	# 581	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 16
+	popq	%r15	# 582	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 8
+	jmp	checkpoint_end@PLT	# 410	[c=0 l=5]  *sibcall
+	.p2align 4,,10
+	.p2align 3
+.L199:
+	.cfi_restore_state
+	movq	1040(%rbx), %rax	# 105	[c=9 l=7]  *movdi_internal/3
+	movl	$62, %edx	# 107	[c=4 l=5]  *movsi_internal/0
+	subl	%r13d, %edx	# 108	[c=4 l=3]  *subsi_1/0
+	movzbl	61(%rax), %r14d	# 106	[c=13 l=5]  *zero_extendqisi2/0
+	cmpl	%ebp, %edx	# 109	[c=4 l=2]  *cmpsi_1/0
+	jb	.L203	# 110	[c=13 l=6]  *jcc
+	cmpb	$1, 1081(%rbx)	# 114	[c=13 l=7]  *cmpqi_1/0
+	jbe	.L203	# 115	[c=13 l=6]  *jcc
+.L202:
+	movl	$62, %esi	# 118	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 119	[c=4 l=3]  *movdi_internal/3
+	call	data_read_mapped	# 120	[c=10 l=5]  *call_value
+	movl	%eax, %ebp	# 121	[c=4 l=2]  *movsi_internal/0
+	jmp	.L204	# 605	[c=1 l=5]  jump
+	.p2align 4,,10
+	.p2align 3
+.L242:
+	movzbl	%r13b, %edx	# 289	[c=4 l=4]  *zero_extendqisi2/0
+	movl	$61, %esi	# 291	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 292	[c=4 l=3]  *movdi_internal/3
+	call	data_write_mapped	# 293	[c=0 l=5]  *call
+	jmp	.L220	# 607	[c=1 l=5]  jump
+	.p2align 4,,10
+	.p2align 3
+.L243:
+	movl	%ebp, %edx	# 313	[c=4 l=2]  *movsi_internal/0
+	movl	$62, %esi	# 314	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 315	[c=4 l=3]  *movdi_internal/3
+	call	data_write_mapped	# 316	[c=0 l=5]  *call
+	jmp	.L222	# 609	[c=1 l=5]  jump
+	.p2align 4,,10
+	.p2align 3
+.L217:
+	movl	%r15d, %edx	# 263	[c=4 l=3]  *movsi_internal/0
+	movl	%r13d, %esi	# 264	[c=4 l=3]  *movsi_internal/0
+	movq	%rbx, %rdi	# 265	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 266	[c=0 l=5]  *call
+	jmp	.L218	# 611	[c=1 l=5]  jump
+	.p2align 4,,10
+	.p2align 3
+.L212:
+	movl	12(%rsp), %edx	# 223	[c=9 l=4]  *movsi_internal/0
+	movl	%r15d, %esi	# 224	[c=4 l=3]  *movsi_internal/0
+	movq	%rbx, %rdi	# 225	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 226	[c=0 l=5]  *call
+	jmp	.L213	# 613	[c=1 l=5]  jump
+	.p2align 4,,10
+	.p2align 3
+.L208:
+	movl	%r13d, %edx	# 185	[c=4 l=3]  *movsi_internal/0
+	movl	%ebp, %esi	# 186	[c=4 l=2]  *movsi_internal/0
+	movq	%rbx, %rdi	# 187	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 188	[c=0 l=5]  *call
+	jmp	.L209	# 615	[c=1 l=5]  jump
+	.p2align 4,,10
+	.p2align 3
+.L224:
+	movl	$63, %esi	# 340	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 341	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 342	[c=10 l=5]  *call_value
+	movl	%eax, %ebp	# 343	[c=4 l=2]  *movsi_internal/0
+	jmp	.L225	# 617	[c=1 l=5]  jump
+	.p2align 4,,10
+	.p2align 3
+.L240:
+	movl	$61, %esi	# 92	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 93	[c=4 l=3]  *movdi_internal/3
+	call	data_read_mapped	# 94	[c=10 l=5]  *call_value
+	movl	%eax, %r14d	# 95	[c=4 l=3]  *movsi_internal/0
+	movl	$62, %eax	# 96	[c=4 l=5]  *movsi_internal/0
+	subl	%r13d, %eax	# 97	[c=4 l=3]  *subsi_1/0
+	cmpl	%ebp, %eax	# 98	[c=4 l=2]  *cmpsi_1/0
+	jnb	.L202	# 99	[c=13 l=6]  *jcc
+	movq	1040(%rbx), %rax	# 126	[c=9 l=7]  *movdi_internal/3
+	jmp	.L203	# 619	[c=1 l=5]  jump
+	.p2align 4,,10
+	.p2align 3
+.L227:
+	cmpb	$1, %al	# 376	[c=4 l=2]  *cmpqi_1/0
+	je	.L229	# 377	[c=13 l=6]  *jcc
+	movl	%r13d, %edx	# 379	[c=4 l=3]  *movsi_internal/0
+	movl	$63, %esi	# 380	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 381	[c=4 l=3]  *movdi_internal/3
+	call	data_write_mapped	# 382	[c=0 l=5]  *call
+	jmp	.L228	# 621	[c=1 l=5]  jump
+.L241:
+	movl	%ebp, %esi	# 148	[c=4 l=2]  *movsi_internal/0
+	movq	%rbx, %rdi	# 149	[c=4 l=3]  *movdi_internal/3
+	call	stack_overflow	# 150	[c=0 l=5]  *call
+	.cfi_endproc
+.LFE207:
+	.size	do_events, .-do_events
+	.section	.rodata.str1.1
+.LC33:
+	.string	"(%s)->%02x "
+.LC34:
+	.string	".word 0x%04x"
+.LC35:
+	.string	"illegal opcode 0x%04x"
+.LC36:
+	.string	"opcode 0x%04x illegal on %s"
+	.section	.rodata.str1.8
+	.align 8
+.LC37:
+	.string	"opcode 0x%04x not yet supported"
+	.section	.rodata.str1.1
+.LC38:
+	.string	"in func_ILLEGAL"
+	.section	.rodata.str1.8
+	.align 8
+.LC39:
+	.string	"%-7s .word 0x%04x: undefined operand combination: %s overlaps R%d"
+	.align 8
+.LC40:
+	.string	"opcode 0x%04x has undefined result (%s overlaps R%d)"
+	.section	.rodata.str1.1
+.LC41:
+	.string	"#%d: "
+.LC42:
+	.string	"not implemented "
+.LC43:
+	.string	"(R%d)->%02x "
+.LC44:
+	.string	"(R%d)->%04x "
+.LC45:
+	.string	"IRQ %d in %u cycles"
+.LC46:
+	.string	"bad IRQ vector %d"
+.LC47:
+	.string	"-no-args "
+.LC48:
+	.string	"(R%d)<-%04x "
+.LC50:
+	.string	"-args ... "
+.LC51:
+	.string	"stdin "
+.LC52:
+	.string	"-no-stdin"
+.LC53:
+	.string	"stdout "
+.LC54:
+	.string	"-no-stdout"
+.LC55:
+	.string	"exit %d: "
+.LC56:
+	.string	"exit %d function called"
+.LC57:
+	.string	"abort"
+.LC58:
+	.string	"abort function called"
+	.section	.rodata.str1.8
+	.align 8
+.LC59:
+	.string	"instruction count limit reached"
+	.section	.rodata.str1.1
+.LC60:
+	.string	"illegal tiny register R%d"
+.LC61:
+	.string	"(R%d)<-%02x "
+.LC62:
+	.string	"(###)->%02x "
+.LC63:
+	.string	"{erase %05x} "
+.LC64:
+	.string	"{write %05x} "
+	.section	.rodata.str1.8
+	.align 8
+.LC65:
+	.string	"infinite loop detected (normal exit)"
+	.align 8
+.LC66:
+	.string	"deadlock: sleeping with no wake source"
+	.section	.rodata.str1.1
+.LC67:
+	.string	"slept %lu cycles "
+	.text
+	.p2align 4
+	.type	execute, @function
+execute:
+.LFB211:
+	.cfi_startproc
+	pushq	%r15	# 18630	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14	# 18631	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13	# 18632	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	movq	%rdi, %r13	# 2	[c=4 l=3]  *movdi_internal/3
+	pushq	%r12	# 18633	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp	# 18634	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx	# 18635	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$56, %rsp	# 18636	[c=4 l=4]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_def_cfa_offset 112
+	movq	32(%rdi), %rax	# 122	[c=9 l=4]  *movdi_internal/3
+	movq	%rax, (%rsp)	# 16708	[c=4 l=4]  *movdi_internal/5
+	call	log_is_idle@PLT	# 124	[c=10 l=5]  *call_value
+	testb	%al, %al	# 126	[c=4 l=2]  *cmpqi_ccno_1/0
+	jne	.L1388	# 127	[c=13 l=2]  *jcc
+.L246:
+	movl	0(%r13), %ebx	# 138	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 143	[c=4 l=3]  *movdi_internal/3
+	leaq	opcodes(%rip), %rbp	# 148	[c=1 l=7]  *movdi_internal/4
+	leaq	handler.1(%rip), %r12	# 155	[c=1 l=7]  *movdi_internal/4
+	salq	$4, %rbx	# 139	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 141	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 142	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 144	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 145	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 146	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 149	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 16709	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 150	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 153	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 154	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 19644	[c=10 l=4]  *indirect_jump
+.L1388:
+	movb	$1, 11032(%r13)	# 129	[c=4 l=8]  *movqi_internal/8
+	movzbl	11037(%r13), %esi	# 130	[c=13 l=8]  *zero_extendqisi2/0
+	movq	%r13, %rdi	# 132	[c=4 l=3]  *movdi_internal/3
+	call	execute_lean@PLT	# 133	[c=0 l=5]  *call
+	movq	%r13, %rdi	# 134	[c=4 l=3]  *movdi_internal/3
+	call	perf_lean_resume@PLT	# 135	[c=0 l=5]  *call
+	jmp	.L246	# 19646	[c=1 l=2]  jump
+.L1113:
+	movl	0(%r13), %eax	# 17670	[c=5 l=4]  *movsi_internal/0
+	movq	1056(%r13), %rdx	# 14370	[c=9 l=7]  *movdi_internal/3
+	leaq	.LC34(%rip), %rsi	# 14373	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 14375	[c=4 l=3]  *movdi_internal/3
+	subl	$1, %eax	# 14366	[c=4 l=3]  *addsi_1/0
+	movl	%eax, 0(%r13)	# 14367	[c=4 l=4]  *movsi_internal/1
+	addl	%eax, %eax	# 14368	[c=5 l=2]  *ashlsi3_1_zext/0
+	movzwl	(%rdx,%rax), %ebx	# 14371	[c=13 l=4]  *zero_extendhisi2/0
+	xorl	%eax, %eax	# 19164	[c=4 l=2]  *movdi_xor
+	movl	%ebx, %edx	# 14372	[c=4 l=2]  *movsi_internal/0
+	call	log_append@PLT	# 14377	[c=0 l=5]  *call
+	movq	832(%r13), %r8	# 14379	[c=9 l=7]  *movdi_internal/3
+	movl	%ebx, %ecx	# 14380	[c=4 l=2]  *movsi_internal/0
+	xorl	%eax, %eax	# 19165	[c=4 l=2]  *movdi_xor
+	leaq	.LC36(%rip), %rdx	# 14381	[c=1 l=7]  *movdi_internal/4
+	movl	$1, %esi	# 14383	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 14384	[c=4 l=3]  *movdi_internal/3
+	call	leave	# 14386	[c=0 l=5]  *call
+.L248:
+	movl	0(%r13), %esi	# 162	[c=5 l=4]  *movsi_internal/0
+	movq	%r13, %rdi	# 163	[c=4 l=3]  *movdi_internal/3
+	call	bad_PC	# 164	[c=0 l=5]  *call
+.L249:
+	movzwl	12(%rbx), %edx	# 174	[c=13 l=4]  *zero_extendhisi2/0
+	movl	0(%r13), %eax	# 16711	[c=5 l=4]  *movsi_internal/0
+	movq	%r13, %rdi	# 185	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC34(%rip), %rsi	# 183	[c=1 l=7]  *movdi_internal/4
+	movzbl	10(%rbx), %ebp	# 173	[c=9 l=4]  *movqi_internal/4
+	subl	%edx, %eax	# 176	[c=4 l=2]  *subsi_1/0
+	movq	1056(%r13), %rdx	# 180	[c=9 l=7]  *movdi_internal/3
+	movl	%eax, 0(%r13)	# 177	[c=4 l=4]  *movsi_internal/1
+	addl	%eax, %eax	# 178	[c=5 l=2]  *ashlsi3_1_zext/0
+	movzwl	(%rdx,%rax), %ebx	# 181	[c=13 l=4]  *zero_extendhisi2/0
+	xorl	%eax, %eax	# 19643	[c=4 l=2]  *movdi_xor
+	movl	%ebx, %edx	# 182	[c=4 l=2]  *movsi_internal/0
+	call	log_append@PLT	# 187	[c=0 l=5]  *call
+	cmpb	$1, %bpl	# 188	[c=4 l=4]  *cmpqi_1/0
+	je	.L250	# 189	[c=13 l=6]  *jcc
+	cmpb	$2, %bpl	# 191	[c=4 l=4]  *cmpqi_1/0
+	je	.L251	# 192	[c=13 l=6]  *jcc
+	testb	%bpl, %bpl	# 194	[c=4 l=3]  *cmpqi_ccno_1/0
+	je	.L1389	# 195	[c=13 l=6]  *jcc
+	leaq	.LC38(%rip), %rdx	# 233	[c=1 l=7]  *movdi_internal/4
+	movl	$8, %esi	# 235	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 236	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 19638	[c=4 l=2]  *movdi_xor
+	call	leave	# 238	[c=0 l=5]  *call
+.L253:
+	movzbl	10(%rbx), %eax	# 247	[c=13 l=4]  zero_extendqidi2/0
+	movzwl	12(%rbx), %r14d	# 242	[c=13 l=5]  *zero_extendhisi2/0
+	salq	$4, %rax	# 248	[c=4 l=4]  *ashldi3_1/0
+	movl	%r14d, %r12d	# 16713	[c=4 l=3]  *movsi_internal/0
+	movq	0(%rbp,%rax), %rbx	# 250	[c=9 l=5]  *movdi_internal/3
+	sarl	$4, %r12d	# 243	[c=4 l=4]  *ashrsi3_1/0
+	andl	$31, %r12d	# 244	[c=4 l=4]  *andsi_1/0
+	movq	%rbx, %rdi	# 251	[c=4 l=3]  *movdi_internal/3
+	call	strlen@PLT	# 252	[c=10 l=5]  *call_value
+	movl	%r12d, %r9d	# 258	[c=4 l=3]  *movsi_internal/0
+	movl	%r14d, %ecx	# 260	[c=4 l=3]  *movsi_internal/0
+	movq	%rbx, %rdx	# 261	[c=4 l=3]  *movdi_internal/3
+	leaq	-2(%rbx,%rax), %r8	# 259	[c=5 l=5]  *leadi
+	leaq	.LC39(%rip), %rsi	# 262	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 264	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 19636	[c=4 l=2]  *movdi_xor
+	call	log_append@PLT	# 266	[c=0 l=5]  *call
+	movl	%r12d, %r9d	# 267	[c=4 l=3]  *movsi_internal/0
+	movq	%rbx, %r8	# 268	[c=4 l=3]  *movdi_internal/3
+	movl	%r14d, %ecx	# 269	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC40(%rip), %rdx	# 270	[c=1 l=7]  *movdi_internal/4
+	movl	$1, %esi	# 272	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 273	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 19637	[c=4 l=2]  *movdi_xor
+	call	leave	# 275	[c=0 l=5]  *call
+.L254:
+	movzbl	10(%rbx), %r14d	# 279	[c=13 l=5]  zero_extendqidi2/0
+	xorl	%eax, %eax	# 19635	[c=4 l=2]  *movdi_xor
+	leaq	.LC41(%rip), %rsi	# 282	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 284	[c=4 l=3]  *movdi_internal/3
+	movl	%r14d, %edx	# 281	[c=4 l=3]  *movsi_internal/0
+	call	log_append@PLT	# 286	[c=0 l=5]  *call
+	cmpb	$31, %r14b	# 289	[c=4 l=4]  *cmpqi_1/0
+	ja	.L255	# 290	[c=13 l=6]  *jcc
+	leaq	.L257(%rip), %rdx	# 292	[c=1 l=7]  *movdi_internal/4
+	movslq	(%rdx,%r14,4), %rax	# 294	[c=14 l=4]  *extendsidi2_rex64/1
+	addq	%rdx, %rax	# 296	[c=4 l=3]  *adddi_1/0
+	jmp	*%rax	# 297	[c=4 l=2]  *tablejump_1
+	.section	.rodata
+	.align 4
+	.align 4
+.L257:
+	.long	.L263-.L257
+	.long	.L263-.L257
+	.long	.L263-.L257
+	.long	.L263-.L257
+	.long	.L263-.L257
+	.long	.L263-.L257
+	.long	.L263-.L257
+	.long	.L263-.L257
+	.long	.L255-.L257
+	.long	.L255-.L257
+	.long	.L255-.L257
+	.long	.L255-.L257
+	.long	.L255-.L257
+	.long	.L255-.L257
+	.long	.L255-.L257
+	.long	.L255-.L257
+	.long	.L255-.L257
+	.long	.L255-.L257
+	.long	.L255-.L257
+	.long	.L255-.L257
+	.long	.L255-.L257
+	.long	.L255-.L257
+	.long	.L255-.L257
+	.long	.L255-.L257
+	.long	.L255-.L257
+	.long	.L255-.L257
+	.long	.L262-.L257
+	.long	.L261-.L257
+	.long	.L260-.L257
+	.long	.L259-.L257
+	.long	.L258-.L257
+	.long	.L256-.L257
+	.text
+.L274:
+	movq	1040(%r13), %rax	# 663	[c=9 l=7]  *movdi_internal/3
+	movzbl	10(%rbx), %r14d	# 662	[c=13 l=5]  zero_extendqidi2/0
+	leaq	.LC43(%rip), %rsi	# 671	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 673	[c=4 l=3]  *movdi_internal/3
+	movzwl	12(%rbx), %r15d	# 661	[c=13 l=5]  *zero_extendhisi2/0
+	movzbl	63(%rax), %eax	# 664	[c=9 l=4]  *movqi_internal/4
+	movl	%r14d, %edx	# 670	[c=4 l=3]  *movsi_internal/0
+	movl	%r14d, 8(%rsp)	# 17679	[c=4 l=5]  *movsi_internal/1
+	movzbl	1004(%r13,%r14), %ecx	# 668	[c=14 l=9]  *zero_extendqisi2/0
+	andl	$1, %eax	# 666	[c=4 l=3]  *andsi_1/0
+	movl	%eax, 16(%rsp)	# 16721	[c=4 l=4]  *movsi_internal/1
+	xorl	%eax, %eax	# 19602	[c=4 l=2]  *movdi_xor
+	call	log_append@PLT	# 675	[c=0 l=5]  *call
+	movl	8(%rsp), %r9d	# 17680	[c=9 l=5]  *movsi_internal/0
+	leaq	.LC43(%rip), %rsi	# 17678	[c=1 l=7]  *movdi_internal/4
+	cmpl	$15, %r9d	# 678	[c=4 l=4]  *cmpsi_1/0
+	jle	.L1390	# 679	[c=13 l=6]  *jcc
+	movslq	%r15d, %r8	# 694	[c=4 l=3]  *extendsidi2_rex64/1
+	movl	%r15d, %edx	# 697	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 700	[c=4 l=3]  *movdi_internal/3
+	movl	%r9d, 40(%rsp)	# 17684	[c=4 l=5]  *movsi_internal/1
+	movzbl	1004(%r13,%r14), %eax	# 692	[c=14 l=9]  *zero_extendqisi2/0
+	movq	%r8, 32(%rsp)	# 17681	[c=4 l=5]  *movdi_internal/5
+	movzbl	1004(%r13,%r8), %ecx	# 695	[c=14 l=9]  *zero_extendqisi2/0
+	movb	%al, 24(%rsp)	# 17683	[c=4 l=4]  *movqi_internal/8
+	movl	%eax, 8(%rsp)	# 16723	[c=4 l=4]  *movsi_internal/1
+	xorl	%eax, %eax	# 19600	[c=4 l=2]  *movdi_xor
+	call	log_append@PLT	# 702	[c=0 l=5]  *call
+	cmpl	$15, %r15d	# 705	[c=4 l=4]  *cmpsi_1/0
+	movq	32(%rsp), %r8	# 17682	[c=9 l=5]  *movdi_internal/3
+	movl	40(%rsp), %r9d	# 17685	[c=9 l=5]  *movsi_internal/0
+	jle	.L1391	# 706	[c=13 l=6]  *jcc
+	movzbl	1004(%r13,%r8), %r15d	# 719	[c=14 l=9]  *zero_extendqisi2/0
+	movl	8(%rsp), %eax	# 16725	[c=9 l=4]  *movsi_internal/0
+	movl	%r9d, %edx	# 725	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 728	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC61(%rip), %rsi	# 726	[c=1 l=7]  *movdi_internal/4
+	movb	%r15b, 32(%rsp)	# 17686	[c=4 l=5]  *movqi_internal/8
+	addl	%eax, %r15d	# 721	[c=4 l=3]  *addsi_1/0
+	movl	16(%rsp), %eax	# 16726	[c=9 l=4]  *movsi_internal/0
+	addl	%eax, %r15d	# 722	[c=4 l=3]  *addsi_1/0
+	xorl	%eax, %eax	# 19598	[c=4 l=2]  *movdi_xor
+	movzbl	%r15b, %ecx	# 723	[c=4 l=4]  *zero_extendqisi2/0
+	call	log_append@PLT	# 730	[c=0 l=5]  *call
+	movzbl	32(%rsp), %r8d	# 17687	[c=9 l=6]  *movqi_internal/4
+	movl	24(%rsp), %edx	# 16727	[c=9 l=4]  *movsi_internal/0
+	movb	%r15b, 1004(%r13,%r14)	# 732	[c=4 l=8]  *movqi_internal/8
+	movl	%r8d, %eax	# 16729	[c=4 l=3]  *movsi_internal/0
+	andl	$136, %edx	# 734	[c=4 l=6]  *andsi_1/0
+	andl	$136, %eax	# 737	[c=4 l=5]  *andsi_1/0
+	leal	(%rax,%rdx,2), %r14d	# 738	[c=8 l=4]  *leasi
+	movl	$63, %eax	# 742	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 743	[c=13 l=7]  *subsi_1/1
+	imull	$260, %r14d, %r14d	# 739	[c=12 l=7]  *mulsi3_1/1
+	andl	$7680, %r14d	# 740	[c=4 l=7]  *andsi_1/0
+	orl	%r15d, %r14d	# 741	[c=5 l=3]  *iorsi_1_zext
+	cmpl	5180(%r13), %eax	# 744	[c=13 l=7]  *cmpsi_1/1
+	jb	.L277	# 745	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%r13)	# 747	[c=13 l=8]  *cmpqi_ccno_1/1
+	jne	.L278	# 748	[c=13 l=6]  *jcc
+.L277:
+	movq	1040(%r13), %rax	# 751	[c=9 l=7]  *movdi_internal/3
+	movzbl	63(%rax), %r15d	# 752	[c=13 l=5]  *zero_extendqisi2/0
+.L279:
+	movl	%r15d, %ecx	# 763	[c=4 l=3]  *movsi_internal/0
+	movl	$63, %edx	# 764	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 767	[c=4 l=3]  *movdi_internal/3
+	andl	$-64, %r15d	# 769	[c=4 l=4]  *andsi_1/0
+	leaq	.LC32(%rip), %rsi	# 765	[c=1 l=7]  *movdi_internal/4
+	call	log_add_data_mov@PLT	# 768	[c=0 l=5]  *call
+	leaq	flag_update_table_add8(%rip), %rax	# 16537	[c=1 l=7]  *movdi_internal/4
+	movl	$63, %edx	# 776	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 779	[c=4 l=3]  *movdi_internal/3
+	movzbl	(%rax,%r14), %eax	# 772	[c=13 l=5]  *zero_extendqisi2/0
+	leaq	.LC28(%rip), %rsi	# 777	[c=1 l=7]  *movdi_internal/4
+	orl	%eax, %r15d	# 773	[c=4 l=3]  *iorsi_1/0
+	movzbl	%r15b, %ecx	# 774	[c=4 l=4]  *zero_extendqisi2/0
+	call	log_add_data_mov@PLT	# 780	[c=0 l=5]  *call
+	movl	$63, %eax	# 781	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 782	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 783	[c=13 l=7]  *cmpsi_1/1
+	jb	.L280	# 784	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%r13)	# 786	[c=13 l=8]  *cmpqi_ccno_1/1
+	jne	.L281	# 787	[c=13 l=6]  *jcc
+.L280:
+	movq	1040(%r13), %rax	# 790	[c=9 l=7]  *movdi_internal/3
+	movb	%r15b, 63(%rax)	# 791	[c=4 l=4]  *movqi_internal/8
+.L282:
+	movq	%r13, %rdi	# 803	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 802	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 804	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 16731	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 16732	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 806	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18354	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 807	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 810	[c=4 l=3]  *cmpdi_1/0
+	jb	.L283	# 811	[c=13 l=6]  *jcc
+	movl	0(%r13), %ebx	# 813	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 818	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 814	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 816	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 817	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 819	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 820	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 821	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 824	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 16733	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 825	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 828	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 829	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 19597	[c=10 l=4]  *indirect_jump
+.L284:
+	movzbl	10(%rbx), %r14d	# 838	[c=13 l=5]  zero_extendqidi2/0
+	xorl	%eax, %eax	# 19596	[c=4 l=2]  *movdi_xor
+	movq	%r13, %rdi	# 845	[c=4 l=3]  *movdi_internal/3
+	movzwl	12(%rbx), %r15d	# 837	[c=13 l=5]  *zero_extendhisi2/0
+	leaq	.LC43(%rip), %rsi	# 843	[c=1 l=7]  *movdi_internal/4
+	movzbl	1004(%r13,%r14), %ecx	# 840	[c=14 l=9]  *zero_extendqisi2/0
+	movl	%r14d, %edx	# 842	[c=4 l=3]  *movsi_internal/0
+	movl	%r14d, 8(%rsp)	# 17690	[c=4 l=5]  *movsi_internal/1
+	call	log_append@PLT	# 847	[c=0 l=5]  *call
+	movl	8(%rsp), %r8d	# 17691	[c=9 l=5]  *movsi_internal/0
+	leaq	.LC43(%rip), %rsi	# 17689	[c=1 l=7]  *movdi_internal/4
+	cmpl	$15, %r8d	# 850	[c=4 l=4]  *cmpsi_1/0
+	jle	.L1392	# 851	[c=13 l=6]  *jcc
+	movslq	%r15d, %r9	# 866	[c=4 l=3]  *extendsidi2_rex64/1
+	movl	%r15d, %edx	# 869	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 872	[c=4 l=3]  *movdi_internal/3
+	movl	%r8d, 32(%rsp)	# 17695	[c=4 l=5]  *movsi_internal/1
+	movzbl	1004(%r13,%r14), %eax	# 864	[c=14 l=9]  *zero_extendqisi2/0
+	movq	%r9, 24(%rsp)	# 17692	[c=4 l=5]  *movdi_internal/5
+	movzbl	1004(%r13,%r9), %ecx	# 867	[c=14 l=9]  *zero_extendqisi2/0
+	movb	%al, 8(%rsp)	# 17694	[c=4 l=4]  *movqi_internal/8
+	movl	%eax, 16(%rsp)	# 16736	[c=4 l=4]  *movsi_internal/1
+	xorl	%eax, %eax	# 19594	[c=4 l=2]  *movdi_xor
+	call	log_append@PLT	# 874	[c=0 l=5]  *call
+	cmpl	$15, %r15d	# 877	[c=4 l=4]  *cmpsi_1/0
+	movq	24(%rsp), %r9	# 17693	[c=9 l=5]  *movdi_internal/3
+	movl	32(%rsp), %r8d	# 17696	[c=9 l=5]  *movsi_internal/0
+	jle	.L1393	# 878	[c=13 l=6]  *jcc
+	movl	16(%rsp), %eax	# 16738	[c=9 l=4]  *movsi_internal/0
+	movl	%r8d, %edx	# 897	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 900	[c=4 l=3]  *movdi_internal/3
+	movzbl	1004(%r13,%r9), %r9d	# 891	[c=14 l=9]  *zero_extendqisi2/0
+	leaq	.LC61(%rip), %rsi	# 898	[c=1 l=7]  *movdi_internal/4
+	movl	%r9d, %r15d	# 18539	[c=4 l=3]  *movsi_internal/0
+	addl	%eax, %r9d	# 893	[c=4 l=3]  *addsi_1/0
+	movzbl	8(%rsp), %eax	# 16739	[c=9 l=5]  *movqi_internal/4
+	movzbl	%r9b, %ecx	# 895	[c=4 l=4]  *zero_extendqisi2/0
+	movl	%r9d, 16(%rsp)	# 17697	[c=4 l=5]  *movsi_internal/1
+	leal	(%rax,%r15), %r11d	# 18353	[c=4 l=4]  *leasi
+	xorl	%eax, %eax	# 19592	[c=4 l=2]  *movdi_xor
+	andl	$136, %r15d	# 909	[c=4 l=7]  *andsi_1/0
+	movb	%r11b, 24(%rsp)	# 17699	[c=4 l=5]  *movqi_internal/8
+	call	log_append@PLT	# 902	[c=0 l=5]  *call
+	movl	8(%rsp), %eax	# 16740	[c=9 l=4]  *movsi_internal/0
+	movl	16(%rsp), %r9d	# 17698	[c=9 l=5]  *movsi_internal/0
+	movzbl	24(%rsp), %r11d	# 17700	[c=9 l=6]  *movqi_internal/4
+	andl	$136, %eax	# 906	[c=4 l=5]  *andsi_1/0
+	leal	(%r15,%rax,2), %eax	# 910	[c=8 l=4]  *leasi
+	movb	%r11b, 1004(%r13,%r14)	# 904	[c=4 l=8]  *movqi_internal/8
+	imull	$260, %eax, %eax	# 911	[c=12 l=6]  *mulsi3_1/1
+	andl	$7680, %eax	# 912	[c=4 l=5]  *andsi_1/0
+	orl	%r9d, %eax	# 913	[c=4 l=3]  *iorsi_1/0
+	movl	%eax, %r14d	# 16743	[c=4 l=3]  *movsi_internal/0
+	movl	$63, %eax	# 914	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 915	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 916	[c=13 l=7]  *cmpsi_1/1
+	jb	.L287	# 917	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%r13)	# 919	[c=13 l=8]  *cmpqi_ccno_1/1
+	jne	.L288	# 920	[c=13 l=6]  *jcc
+.L287:
+	movq	1040(%r13), %rax	# 923	[c=9 l=7]  *movdi_internal/3
+	movzbl	63(%rax), %r15d	# 924	[c=13 l=5]  *zero_extendqisi2/0
+.L289:
+	movl	%r15d, %ecx	# 935	[c=4 l=3]  *movsi_internal/0
+	movl	$63, %edx	# 936	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 939	[c=4 l=3]  *movdi_internal/3
+	andl	$-64, %r15d	# 944	[c=4 l=4]  *andsi_1/0
+	leaq	.LC32(%rip), %rsi	# 937	[c=1 l=7]  *movdi_internal/4
+	call	log_add_data_mov@PLT	# 940	[c=0 l=5]  *call
+	movl	%r14d, %eax	# 942	[c=1 l=3]  *zero_extendsidi2/3
+	leaq	flag_update_table_add8(%rip), %rdx	# 16538	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 951	[c=4 l=3]  *movdi_internal/3
+	movzbl	(%rdx,%rax), %r14d	# 943	[c=13 l=5]  *zero_extendqisi2/0
+	leaq	.LC28(%rip), %rsi	# 949	[c=1 l=7]  *movdi_internal/4
+	movl	$63, %edx	# 948	[c=4 l=5]  *movsi_internal/0
+	orl	%r15d, %r14d	# 945	[c=4 l=3]  *iorsi_1/0
+	movzbl	%r14b, %ecx	# 946	[c=4 l=4]  *zero_extendqisi2/0
+	call	log_add_data_mov@PLT	# 952	[c=0 l=5]  *call
+	movl	$63, %eax	# 953	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 954	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 955	[c=13 l=7]  *cmpsi_1/1
+	jb	.L290	# 956	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%r13)	# 958	[c=13 l=8]  *cmpqi_ccno_1/1
+	jne	.L291	# 959	[c=13 l=6]  *jcc
+.L290:
+	movq	1040(%r13), %rax	# 962	[c=9 l=7]  *movdi_internal/3
+	movb	%r14b, 63(%rax)	# 963	[c=4 l=4]  *movqi_internal/8
+.L292:
+	movq	%r13, %rdi	# 975	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 974	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 976	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 16744	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 16745	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 978	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18352	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 979	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 981	[c=4 l=3]  *cmpdi_1/0
+	jb	.L283	# 982	[c=13 l=6]  *jcc
+	movl	0(%r13), %ebx	# 984	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 989	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 985	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 987	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 988	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 990	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 991	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 992	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 995	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 16746	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 996	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 999	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 1000	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 19591	[c=10 l=4]  *indirect_jump
+.L293:
+	movzwl	12(%rbx), %r15d	# 1008	[c=13 l=5]  *zero_extendhisi2/0
+	movzbl	10(%rbx), %r9d	# 1009	[c=13 l=5]  *zero_extendqisi2/0
+	xorl	%eax, %eax	# 19584	[c=4 l=2]  *movdi_xor
+	movq	%r13, %rdi	# 1013	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC62(%rip), %rsi	# 1011	[c=1 l=7]  *movdi_internal/4
+	movl	%r15d, %edx	# 1010	[c=4 l=3]  *movsi_internal/0
+	movl	%r9d, 8(%rsp)	# 17710	[c=4 l=5]  *movsi_internal/1
+	call	log_append@PLT	# 1015	[c=0 l=5]  *call
+	movslq	8(%rsp), %r11	# 17711	[c=13 l=5]  *extendsidi2_rex64/1
+	leaq	.LC44(%rip), %rsi	# 1025	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 1027	[c=4 l=3]  *movdi_internal/3
+	leal	1(%r11), %r8d	# 18349	[c=4 l=4]  *leasi
+	movl	%r11d, %edx	# 1024	[c=4 l=3]  *movsi_internal/0
+	movq	%r11, 24(%rsp)	# 17706	[c=4 l=5]  *movdi_internal/5
+	movzbl	1004(%r13,%r11), %eax	# 1021	[c=14 l=9]  *zero_extendqisi2/0
+	movslq	%r8d, %r8	# 1017	[c=4 l=3]  *extendsidi2_rex64/1
+	movl	%r11d, 16(%rsp)	# 17704	[c=4 l=5]  *movsi_internal/1
+	movzbl	1004(%r13,%r8), %r14d	# 1018	[c=14 l=9]  *zero_extendqisi2/0
+	movq	%r8, 32(%rsp)	# 17708	[c=4 l=5]  *movdi_internal/5
+	sall	$8, %r14d	# 1019	[c=4 l=4]  *ashlsi3_1/0
+	orl	%eax, %r14d	# 1022	[c=4 l=3]  *iorsi_1/0
+	xorl	%eax, %eax	# 19585	[c=4 l=2]  *movdi_xor
+	movl	%r14d, %ecx	# 1023	[c=4 l=3]  *movsi_internal/0
+	addl	%r14d, %r15d	# 1030	[c=4 l=3]  *addsi_1/0
+	call	log_append@PLT	# 1029	[c=0 l=5]  *call
+	movl	16(%rsp), %edx	# 19586	[c=9 l=4]  *movsi_internal/0
+	movzwl	%r15w, %ecx	# 1031	[c=4 l=4]  *zero_extendhisi2/0
+	xorl	%eax, %eax	# 19587	[c=4 l=2]  *movdi_xor
+	leaq	.LC48(%rip), %rsi	# 1034	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 1036	[c=4 l=3]  *movdi_internal/3
+	movl	%ecx, 8(%rsp)	# 17702	[c=4 l=4]  *movsi_internal/1
+	call	log_append@PLT	# 1038	[c=0 l=5]  *call
+	movq	24(%rsp), %r11	# 17707	[c=9 l=5]  *movdi_internal/3
+	movl	%r14d, %eax	# 16748	[c=4 l=3]  *movsi_internal/0
+	movl	8(%rsp), %ecx	# 17703	[c=9 l=4]  *movsi_internal/0
+	shrl	$5, %eax	# 1046	[c=4 l=3]  *lshrsi3_1/0
+	movq	32(%rsp), %r8	# 17709	[c=9 l=5]  *movdi_internal/3
+	leaq	flag_update_table_add8(%rip), %rdx	# 16539	[c=1 l=7]  *movdi_internal/4
+	movb	%r15b, 1004(%r13,%r11)	# 1040	[c=4 l=8]  *movqi_internal/8
+	andl	$1024, %eax	# 1047	[c=4 l=5]  *andsi_1/0
+	sarl	$8, %r15d	# 1041	[c=4 l=4]  *ashrsi3_1/0
+	orl	%r15d, %eax	# 1048	[c=4 l=3]  *iorsi_1/0
+	movb	%r15b, 1004(%r13,%r8)	# 1043	[c=4 l=8]  *movqi_internal/8
+	cltq	# 1049	[c=4 l=2]  *extendsidi2_rex64/0
+	movzbl	(%rdx,%rax), %r15d	# 1050	[c=13 l=5]  *zero_extendqisi2/0
+	xorl	%eax, %eax	# 19588	[c=4 l=2]  *movsi_xor
+	testl	%ecx, %ecx	# 19589	[c=4 l=2]  *cmpsi_ccno_1/0
+	setne	%al	# 19590	[c=4 l=3]  *setcc_qi_slp
+	addl	%eax, %eax	# 1054	[c=4 l=2]  *ashlsi3_1/0
+	notl	%eax	# 1055	[c=4 l=2]  *one_cmplsi2_1/0
+	andl	%eax, %r15d	# 1056	[c=4 l=3]  *andsi_1/0
+	movl	$63, %eax	# 1058	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 1059	[c=13 l=7]  *subsi_1/1
+	andl	$-33, %r15d	# 1057	[c=4 l=4]  *andsi_1/0
+	cmpl	5180(%r13), %eax	# 1060	[c=13 l=7]  *cmpsi_1/1
+	jb	.L294	# 1061	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%r13)	# 1063	[c=13 l=8]  *cmpqi_ccno_1/1
+	jne	.L295	# 1064	[c=13 l=6]  *jcc
+.L294:
+	movq	1040(%r13), %rax	# 1067	[c=9 l=7]  *movdi_internal/3
+	movzbl	63(%rax), %r14d	# 1068	[c=13 l=5]  *zero_extendqisi2/0
+.L296:
+	movl	%r14d, %ecx	# 1079	[c=4 l=3]  *movsi_internal/0
+	andl	$-32, %r14d	# 1085	[c=4 l=4]  *andsi_1/0
+	movl	$63, %edx	# 1080	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 1083	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC32(%rip), %rsi	# 1081	[c=1 l=7]  *movdi_internal/4
+	orl	%r15d, %r14d	# 1086	[c=4 l=3]  *iorsi_1/0
+	call	log_add_data_mov@PLT	# 1084	[c=0 l=5]  *call
+	movzbl	%r14b, %ecx	# 1087	[c=4 l=4]  *zero_extendqisi2/0
+	movl	$63, %edx	# 1089	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 1092	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC28(%rip), %rsi	# 1090	[c=1 l=7]  *movdi_internal/4
+	call	log_add_data_mov@PLT	# 1093	[c=0 l=5]  *call
+	movl	$63, %eax	# 1094	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 1095	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 1096	[c=13 l=7]  *cmpsi_1/1
+	jb	.L297	# 1097	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%r13)	# 1099	[c=13 l=8]  *cmpqi_ccno_1/1
+	jne	.L298	# 1100	[c=13 l=6]  *jcc
+.L297:
+	movq	1040(%r13), %rax	# 1103	[c=9 l=7]  *movdi_internal/3
+	movb	%r14b, 63(%rax)	# 1104	[c=4 l=4]  *movqi_internal/8
+.L299:
+	movq	%r13, %rdi	# 1116	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 1115	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 1117	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 16750	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 16751	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 1119	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18348	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 1120	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 1122	[c=4 l=3]  *cmpdi_1/0
+	jb	.L283	# 1123	[c=13 l=6]  *jcc
+	movl	0(%r13), %ebx	# 1125	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 1130	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 1126	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 1128	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 1129	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 1131	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 1132	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 1133	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 1136	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 16752	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 1137	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 1140	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 1141	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 19583	[c=10 l=4]  *indirect_jump
+.L300:
+	movzwl	12(%rbx), %r9d	# 1149	[c=13 l=5]  *zero_extendhisi2/0
+	movzbl	10(%rbx), %r15d	# 1150	[c=13 l=5]  *zero_extendqisi2/0
+	xorl	%eax, %eax	# 19577	[c=4 l=2]  *movdi_xor
+	movq	%r13, %rdi	# 1154	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC62(%rip), %rsi	# 1152	[c=1 l=7]  *movdi_internal/4
+	movl	%r9d, %edx	# 1151	[c=4 l=3]  *movsi_internal/0
+	movl	%r9d, 8(%rsp)	# 17720	[c=4 l=5]  *movsi_internal/1
+	call	log_append@PLT	# 1156	[c=0 l=5]  *call
+	leal	1(%r15), %r8d	# 18345	[c=4 l=4]  *leasi
+	movslq	%r15d, %r11	# 1161	[c=4 l=3]  *extendsidi2_rex64/1
+	movl	%r15d, %edx	# 1165	[c=4 l=3]  *movsi_internal/0
+	movslq	%r8d, %r8	# 1158	[c=4 l=3]  *extendsidi2_rex64/1
+	leaq	.LC44(%rip), %rsi	# 1166	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 1168	[c=4 l=3]  *movdi_internal/3
+	movq	%r11, 24(%rsp)	# 17716	[c=4 l=5]  *movdi_internal/5
+	movzbl	1004(%r13,%r8), %r14d	# 1159	[c=14 l=9]  *zero_extendqisi2/0
+	movq	%r8, 32(%rsp)	# 17718	[c=4 l=5]  *movdi_internal/5
+	movzbl	1004(%r13,%r11), %eax	# 1162	[c=14 l=9]  *zero_extendqisi2/0
+	sall	$8, %r14d	# 1160	[c=4 l=4]  *ashlsi3_1/0
+	orl	%eax, %r14d	# 1163	[c=4 l=3]  *iorsi_1/0
+	xorl	%eax, %eax	# 19578	[c=4 l=2]  *movdi_xor
+	movl	%r14d, %ecx	# 1164	[c=4 l=3]  *movsi_internal/0
+	call	log_append@PLT	# 1170	[c=0 l=5]  *call
+	movl	8(%rsp), %r9d	# 17721	[c=9 l=5]  *movsi_internal/0
+	movl	%r14d, %r10d	# 16754	[c=4 l=3]  *movsi_internal/0
+	movl	%r15d, %edx	# 1174	[c=4 l=3]  *movsi_internal/0
+	xorl	%eax, %eax	# 19579	[c=4 l=2]  *movdi_xor
+	leaq	.LC48(%rip), %rsi	# 1175	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 1177	[c=4 l=3]  *movdi_internal/3
+	subl	%r9d, %r10d	# 1171	[c=4 l=3]  *subsi_1/0
+	movzwl	%r10w, %ecx	# 1172	[c=4 l=4]  *zero_extendhisi2/0
+	movl	%r10d, 16(%rsp)	# 17714	[c=4 l=5]  *movsi_internal/1
+	movl	%ecx, 8(%rsp)	# 17712	[c=4 l=4]  *movsi_internal/1
+	call	log_append@PLT	# 1179	[c=0 l=5]  *call
+	movl	16(%rsp), %r10d	# 17715	[c=9 l=5]  *movsi_internal/0
+	movl	%r14d, %eax	# 16758	[c=4 l=3]  *movsi_internal/0
+	movl	8(%rsp), %ecx	# 17713	[c=9 l=4]  *movsi_internal/0
+	movq	24(%rsp), %r11	# 17717	[c=9 l=5]  *movdi_internal/3
+	shrl	$5, %eax	# 1187	[c=4 l=3]  *lshrsi3_1/0
+	movq	32(%rsp), %r8	# 17719	[c=9 l=5]  *movdi_internal/3
+	leaq	flag_update_table_sub8(%rip), %rdx	# 16540	[c=1 l=7]  *movdi_internal/4
+	andl	$1024, %eax	# 1188	[c=4 l=5]  *andsi_1/0
+	movb	%r10b, 1004(%r13,%r11)	# 1181	[c=4 l=8]  *movqi_internal/8
+	sarl	$8, %r10d	# 1182	[c=4 l=4]  *ashrsi3_1/0
+	movl	%r10d, %r15d	# 16757	[c=4 l=3]  *movsi_internal/0
+	movb	%r10b, 1004(%r13,%r8)	# 1184	[c=4 l=8]  *movqi_internal/8
+	andl	$511, %r15d	# 1189	[c=4 l=7]  *andsi_1/0
+	orl	%r15d, %eax	# 1190	[c=4 l=3]  *iorsi_1/0
+	cltq	# 1191	[c=4 l=2]  *extendsidi2_rex64/0
+	movzbl	(%rdx,%rax), %r15d	# 1192	[c=13 l=5]  *zero_extendqisi2/0
+	xorl	%eax, %eax	# 19580	[c=4 l=2]  *movsi_xor
+	testl	%ecx, %ecx	# 19581	[c=4 l=2]  *cmpsi_ccno_1/0
+	setne	%al	# 19582	[c=4 l=3]  *setcc_qi_slp
+	addl	%eax, %eax	# 1196	[c=4 l=2]  *ashlsi3_1/0
+	notl	%eax	# 1197	[c=4 l=2]  *one_cmplsi2_1/0
+	andl	%eax, %r15d	# 1198	[c=4 l=3]  *andsi_1/0
+	movl	$63, %eax	# 1200	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 1201	[c=13 l=7]  *subsi_1/1
+	andl	$-33, %r15d	# 1199	[c=4 l=4]  *andsi_1/0
+	cmpl	5180(%r13), %eax	# 1202	[c=13 l=7]  *cmpsi_1/1
+	jb	.L301	# 1203	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%r13)	# 1205	[c=13 l=8]  *cmpqi_ccno_1/1
+	jne	.L302	# 1206	[c=13 l=6]  *jcc
+.L301:
+	movq	1040(%r13), %rax	# 1209	[c=9 l=7]  *movdi_internal/3
+	movzbl	63(%rax), %r14d	# 1210	[c=13 l=5]  *zero_extendqisi2/0
+.L303:
+	movl	%r14d, %ecx	# 1221	[c=4 l=3]  *movsi_internal/0
+	andl	$-32, %r14d	# 1227	[c=4 l=4]  *andsi_1/0
+	movl	$63, %edx	# 1222	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 1225	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC32(%rip), %rsi	# 1223	[c=1 l=7]  *movdi_internal/4
+	orl	%r15d, %r14d	# 1228	[c=4 l=3]  *iorsi_1/0
+	call	log_add_data_mov@PLT	# 1226	[c=0 l=5]  *call
+	movzbl	%r14b, %ecx	# 1229	[c=4 l=4]  *zero_extendqisi2/0
+	movl	$63, %edx	# 1231	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 1234	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC28(%rip), %rsi	# 1232	[c=1 l=7]  *movdi_internal/4
+	call	log_add_data_mov@PLT	# 1235	[c=0 l=5]  *call
+	movl	$63, %eax	# 1236	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 1237	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 1238	[c=13 l=7]  *cmpsi_1/1
+	jb	.L304	# 1239	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%r13)	# 1241	[c=13 l=8]  *cmpqi_ccno_1/1
+	jne	.L305	# 1242	[c=13 l=6]  *jcc
+.L304:
+	movq	1040(%r13), %rax	# 1245	[c=9 l=7]  *movdi_internal/3
+	movb	%r14b, 63(%rax)	# 1246	[c=4 l=4]  *movqi_internal/8
+.L306:
+	movq	%r13, %rdi	# 1258	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 1257	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 1259	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 16760	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 16761	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 1261	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18344	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 1262	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 1264	[c=4 l=3]  *cmpdi_1/0
+	jb	.L283	# 1265	[c=13 l=6]  *jcc
+	movl	0(%r13), %ebx	# 1267	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 1272	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 1268	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 1270	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 1271	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 1273	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 1274	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 1275	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 1278	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 16762	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 1279	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 1282	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 1283	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 19576	[c=10 l=4]  *indirect_jump
+.L307:
+	movzbl	10(%rbx), %r15d	# 1292	[c=13 l=5]  zero_extendqidi2/0
+	xorl	%eax, %eax	# 19575	[c=4 l=2]  *movdi_xor
+	movq	%r13, %rdi	# 1299	[c=4 l=3]  *movdi_internal/3
+	movzwl	12(%rbx), %r14d	# 1291	[c=13 l=5]  *zero_extendhisi2/0
+	leaq	.LC43(%rip), %rsi	# 1297	[c=1 l=7]  *movdi_internal/4
+	movzbl	1004(%r13,%r15), %ecx	# 1294	[c=14 l=9]  *zero_extendqisi2/0
+	movl	%r15d, %edx	# 1296	[c=4 l=3]  *movsi_internal/0
+	movl	%r15d, 8(%rsp)	# 17724	[c=4 l=5]  *movsi_internal/1
+	call	log_append@PLT	# 1301	[c=0 l=5]  *call
+	movl	8(%rsp), %r9d	# 17725	[c=9 l=5]  *movsi_internal/0
+	leaq	.LC43(%rip), %rsi	# 17723	[c=1 l=7]  *movdi_internal/4
+	cmpl	$15, %r9d	# 1304	[c=4 l=4]  *cmpsi_1/0
+	jle	.L1394	# 1305	[c=13 l=6]  *jcc
+	movslq	%r14d, %r11	# 1319	[c=4 l=3]  *extendsidi2_rex64/1
+	xorl	%eax, %eax	# 19573	[c=4 l=2]  *movdi_xor
+	movl	%r14d, %edx	# 1322	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 1325	[c=4 l=3]  *movdi_internal/3
+	movzbl	1004(%r13,%r15), %r8d	# 1318	[c=10 l=9]  *movqi_internal/4
+	movl	%r9d, 24(%rsp)	# 17730	[c=4 l=5]  *movsi_internal/1
+	movzbl	1004(%r13,%r11), %ecx	# 1320	[c=14 l=9]  *zero_extendqisi2/0
+	movq	%r11, 8(%rsp)	# 17726	[c=4 l=5]  *movdi_internal/5
+	movb	%r8b, 16(%rsp)	# 17728	[c=4 l=5]  *movqi_internal/8
+	call	log_append@PLT	# 1327	[c=0 l=5]  *call
+	cmpl	$15, %r14d	# 1330	[c=4 l=4]  *cmpsi_1/0
+	movq	8(%rsp), %r11	# 17727	[c=9 l=5]  *movdi_internal/3
+	movzbl	16(%rsp), %r8d	# 17729	[c=9 l=6]  *movqi_internal/4
+	movl	24(%rsp), %r9d	# 17731	[c=9 l=5]  *movsi_internal/0
+	jle	.L1395	# 1331	[c=13 l=6]  *jcc
+	andb	1004(%r13,%r11), %r8b	# 1344	[c=14 l=8]  *andqi_1/1
+	xorl	%eax, %eax	# 19571	[c=4 l=2]  *movdi_xor
+	movl	%r9d, %edx	# 1347	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 1350	[c=4 l=3]  *movdi_internal/3
+	movzbl	%r8b, %r14d	# 1345	[c=4 l=4]  zero_extendqidi2/0
+	leaq	.LC61(%rip), %rsi	# 1348	[c=1 l=7]  *movdi_internal/4
+	movb	%r8b, 8(%rsp)	# 17732	[c=4 l=5]  *movqi_internal/8
+	movl	%r14d, %ecx	# 1346	[c=4 l=3]  *movsi_internal/0
+	call	log_append@PLT	# 1352	[c=0 l=5]  *call
+	movzbl	8(%rsp), %r8d	# 17733	[c=9 l=6]  *movqi_internal/4
+	movl	$63, %eax	# 1355	[c=4 l=5]  *movsi_internal/0
+	movb	%r8b, 1004(%r13,%r15)	# 1354	[c=4 l=8]  *movqi_internal/8
+	subl	5176(%r13), %eax	# 1356	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 1357	[c=13 l=7]  *cmpsi_1/1
+	jb	.L310	# 1358	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%r13)	# 1360	[c=13 l=8]  *cmpqi_ccno_1/1
+	jne	.L311	# 1361	[c=13 l=6]  *jcc
+.L310:
+	movq	1040(%r13), %rax	# 1364	[c=9 l=7]  *movdi_internal/3
+	movzbl	63(%rax), %r15d	# 1365	[c=13 l=5]  *zero_extendqisi2/0
+.L312:
+	movl	%r15d, %ecx	# 1376	[c=4 l=3]  *movsi_internal/0
+	movl	$63, %edx	# 1377	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 1380	[c=4 l=3]  *movdi_internal/3
+	andl	$-31, %r15d	# 1382	[c=4 l=4]  *andsi_1/0
+	leaq	.LC32(%rip), %rsi	# 1378	[c=1 l=7]  *movdi_internal/4
+	call	log_add_data_mov@PLT	# 1381	[c=0 l=5]  *call
+	leaq	flag_update_table_logical(%rip), %rax	# 16541	[c=1 l=7]  *movdi_internal/4
+	movl	$63, %edx	# 1389	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 1392	[c=4 l=3]  *movdi_internal/3
+	movzbl	(%rax,%r14), %eax	# 1385	[c=13 l=5]  *zero_extendqisi2/0
+	leaq	.LC28(%rip), %rsi	# 1390	[c=1 l=7]  *movdi_internal/4
+	orl	%eax, %r15d	# 1386	[c=4 l=3]  *iorsi_1/0
+	movzbl	%r15b, %ecx	# 1387	[c=4 l=4]  *zero_extendqisi2/0
+	call	log_add_data_mov@PLT	# 1393	[c=0 l=5]  *call
+	movl	$63, %eax	# 1394	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 1395	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 1396	[c=13 l=7]  *cmpsi_1/1
+	jb	.L313	# 1397	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%r13)	# 1399	[c=13 l=8]  *cmpqi_ccno_1/1
+	jne	.L314	# 1400	[c=13 l=6]  *jcc
+.L313:
+	movq	1040(%r13), %rax	# 1403	[c=9 l=7]  *movdi_internal/3
+	movb	%r15b, 63(%rax)	# 1404	[c=4 l=4]  *movqi_internal/8
+.L315:
+	movq	%r13, %rdi	# 1416	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 1415	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 1417	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 16764	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 16765	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 1419	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18343	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 1420	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 1422	[c=4 l=3]  *cmpdi_1/0
+	jb	.L283	# 1423	[c=13 l=6]  *jcc
+	movl	0(%r13), %ebx	# 1425	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 1430	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 1426	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 1428	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 1429	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 1431	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 1432	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 1433	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 1436	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 16766	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 1437	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 1440	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 1441	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 19570	[c=10 l=4]  *indirect_jump
+.L316:
+	movzwl	12(%rbx), %r15d	# 1449	[c=13 l=5]  *zero_extendhisi2/0
+	movzbl	10(%rbx), %r14d	# 1450	[c=13 l=5]  *zero_extendqisi2/0
+	xorl	%eax, %eax	# 19568	[c=4 l=2]  *movdi_xor
+	movq	%r13, %rdi	# 1454	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC62(%rip), %rsi	# 1452	[c=1 l=7]  *movdi_internal/4
+	movl	%r15d, %edx	# 1451	[c=4 l=3]  *movsi_internal/0
+	call	log_append@PLT	# 1456	[c=0 l=5]  *call
+	movslq	%r14d, %r8	# 1457	[c=4 l=3]  *extendsidi2_rex64/1
+	xorl	%eax, %eax	# 19569	[c=4 l=2]  *movdi_xor
+	movl	%r14d, %edx	# 1460	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC43(%rip), %rsi	# 1461	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 1463	[c=4 l=3]  *movdi_internal/3
+	movq	%r8, 8(%rsp)	# 17734	[c=4 l=5]  *movdi_internal/5
+	movzbl	1004(%r13,%r8), %ecx	# 1458	[c=14 l=9]  *zero_extendqisi2/0
+	call	log_append@PLT	# 1465	[c=0 l=5]  *call
+	cmpl	$15, %r14d	# 1468	[c=4 l=4]  *cmpsi_1/0
+	movq	8(%rsp), %r8	# 17735	[c=9 l=5]  *movdi_internal/3
+	jle	.L1396	# 1469	[c=13 l=6]  *jcc
+	movzbl	1004(%r13,%r8), %eax	# 1482	[c=14 l=9]  *zero_extendqisi2/0
+	movl	%r14d, %edx	# 1485	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC61(%rip), %rsi	# 1486	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 1488	[c=4 l=3]  *movdi_internal/3
+	movq	%r8, 8(%rsp)	# 17736	[c=4 l=5]  *movdi_internal/5
+	andl	%eax, %r15d	# 1483	[c=4 l=3]  *andsi_1/0
+	xorl	%eax, %eax	# 19566	[c=4 l=2]  *movdi_xor
+	movl	%r15d, %ecx	# 1484	[c=4 l=3]  *movsi_internal/0
+	call	log_append@PLT	# 1490	[c=0 l=5]  *call
+	movq	8(%rsp), %r8	# 17737	[c=9 l=5]  *movdi_internal/3
+	movl	$63, %eax	# 1493	[c=4 l=5]  *movsi_internal/0
+	movb	%r15b, 1004(%r13,%r8)	# 1492	[c=4 l=8]  *movqi_internal/8
+	subl	5176(%r13), %eax	# 1494	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 1495	[c=13 l=7]  *cmpsi_1/1
+	jb	.L318	# 1496	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%r13)	# 1498	[c=13 l=8]  *cmpqi_ccno_1/1
+	jne	.L319	# 1499	[c=13 l=6]  *jcc
+.L318:
+	movq	1040(%r13), %rax	# 1502	[c=9 l=7]  *movdi_internal/3
+	movzbl	63(%rax), %r14d	# 1503	[c=13 l=5]  *zero_extendqisi2/0
+.L320:
+	movl	%r14d, %ecx	# 1514	[c=4 l=3]  *movsi_internal/0
+	movl	$63, %edx	# 1515	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 1518	[c=4 l=3]  *movdi_internal/3
+	movslq	%r15d, %r15	# 1522	[c=4 l=3]  *extendsidi2_rex64/1
+	leaq	.LC32(%rip), %rsi	# 1516	[c=1 l=7]  *movdi_internal/4
+	andl	$-31, %r14d	# 1520	[c=4 l=4]  *andsi_1/0
+	call	log_add_data_mov@PLT	# 1519	[c=0 l=5]  *call
+	leaq	flag_update_table_logical(%rip), %rax	# 16542	[c=1 l=7]  *movdi_internal/4
+	movl	$63, %edx	# 1527	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 1530	[c=4 l=3]  *movdi_internal/3
+	movzbl	(%rax,%r15), %eax	# 1523	[c=13 l=5]  *zero_extendqisi2/0
+	leaq	.LC28(%rip), %rsi	# 1528	[c=1 l=7]  *movdi_internal/4
+	orl	%eax, %r14d	# 1524	[c=4 l=3]  *iorsi_1/0
+	movzbl	%r14b, %ecx	# 1525	[c=4 l=4]  *zero_extendqisi2/0
+	call	log_add_data_mov@PLT	# 1531	[c=0 l=5]  *call
+	movl	$63, %eax	# 1532	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 1533	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 1534	[c=13 l=7]  *cmpsi_1/1
+	jb	.L321	# 1535	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%r13)	# 1537	[c=13 l=8]  *cmpqi_ccno_1/1
+	jne	.L322	# 1538	[c=13 l=6]  *jcc
+.L321:
+	movq	1040(%r13), %rax	# 1541	[c=9 l=7]  *movdi_internal/3
+	movb	%r14b, 63(%rax)	# 1542	[c=4 l=4]  *movqi_internal/8
+.L323:
+	movq	%r13, %rdi	# 1554	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 1553	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 1555	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 16768	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 16769	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 1557	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18342	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 1558	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 1560	[c=4 l=3]  *cmpdi_1/0
+	jb	.L283	# 1561	[c=13 l=6]  *jcc
+	movl	0(%r13), %ebx	# 1563	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 1568	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 1564	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 1566	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 1567	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 1569	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 1570	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 1571	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 1574	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 16770	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 1575	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 1578	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 1579	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 19565	[c=10 l=4]  *indirect_jump
+.L324:
+	movzbl	10(%rbx), %r8d	# 1587	[c=13 l=5]  zero_extendqidi2/0
+	xorl	%eax, %eax	# 19564	[c=4 l=2]  *movdi_xor
+	leaq	.LC43(%rip), %rsi	# 1592	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 1594	[c=4 l=3]  *movdi_internal/3
+	movzbl	1004(%r13,%r8), %ecx	# 1589	[c=14 l=9]  *zero_extendqisi2/0
+	movq	%r8, %r14	# 18542	[c=4 l=3]  *movdi_internal/3
+	movl	%r8d, %edx	# 1591	[c=4 l=3]  *movsi_internal/0
+	movq	%r8, 8(%rsp)	# 17738	[c=4 l=5]  *movdi_internal/5
+	call	log_append@PLT	# 1596	[c=0 l=5]  *call
+	cmpl	$15, %r14d	# 1599	[c=4 l=4]  *cmpsi_1/0
+	movq	8(%rsp), %r8	# 17739	[c=9 l=5]  *movdi_internal/3
+	jle	.L1397	# 1600	[c=13 l=6]  *jcc
+	xorl	%eax, %eax	# 19562	[c=4 l=2]  *movdi_xor
+	movl	%r14d, %edx	# 1617	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC61(%rip), %rsi	# 1618	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 1620	[c=4 l=3]  *movdi_internal/3
+	movsbl	1004(%r13,%r8), %r15d	# 1613	[c=14 l=9]  extendqisi2
+	movq	%r8, 16(%rsp)	# 17742	[c=4 l=5]  *movdi_internal/5
+	andl	$511, %r15d	# 1614	[c=4 l=7]  *andsi_1/0
+	movl	%r15d, %ecx	# 16772	[c=4 l=3]  *movsi_internal/0
+	sarl	%ecx	# 1615	[c=4 l=2]  *ashrsi3_1/0
+	movl	%ecx, 8(%rsp)	# 17740	[c=4 l=4]  *movsi_internal/1
+	call	log_append@PLT	# 1622	[c=0 l=5]  *call
+	movl	8(%rsp), %ecx	# 17741	[c=9 l=4]  *movsi_internal/0
+	movq	16(%rsp), %r8	# 17743	[c=9 l=5]  *movdi_internal/3
+	movl	$63, %eax	# 1625	[c=4 l=5]  *movsi_internal/0
+	movb	%cl, 1004(%r13,%r8)	# 1624	[c=4 l=8]  *movqi_internal/8
+	subl	5176(%r13), %eax	# 1626	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 1627	[c=13 l=7]  *cmpsi_1/1
+	jb	.L326	# 1628	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%r13)	# 1630	[c=13 l=8]  *cmpqi_ccno_1/1
+	jne	.L327	# 1631	[c=13 l=6]  *jcc
+.L326:
+	movq	1040(%r13), %rax	# 1634	[c=9 l=7]  *movdi_internal/3
+	movzbl	63(%rax), %r14d	# 1635	[c=13 l=5]  *zero_extendqisi2/0
+.L328:
+	movl	%r14d, %ecx	# 1646	[c=4 l=3]  *movsi_internal/0
+	movl	$63, %edx	# 1647	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 1650	[c=4 l=3]  *movdi_internal/3
+	movslq	%r15d, %r15	# 1654	[c=4 l=3]  *extendsidi2_rex64/1
+	leaq	.LC32(%rip), %rsi	# 1648	[c=1 l=7]  *movdi_internal/4
+	andl	$-32, %r14d	# 1652	[c=4 l=4]  *andsi_1/0
+	call	log_add_data_mov@PLT	# 1651	[c=0 l=5]  *call
+	leaq	flag_update_table_ror8(%rip), %rax	# 16543	[c=1 l=7]  *movdi_internal/4
+	movl	$63, %edx	# 1659	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 1662	[c=4 l=3]  *movdi_internal/3
+	movzbl	(%rax,%r15), %eax	# 1655	[c=13 l=5]  *zero_extendqisi2/0
+	leaq	.LC28(%rip), %rsi	# 1660	[c=1 l=7]  *movdi_internal/4
+	orl	%eax, %r14d	# 1656	[c=4 l=3]  *iorsi_1/0
+	movzbl	%r14b, %ecx	# 1657	[c=4 l=4]  *zero_extendqisi2/0
+	call	log_add_data_mov@PLT	# 1663	[c=0 l=5]  *call
+	movl	$63, %eax	# 1664	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 1665	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 1666	[c=13 l=7]  *cmpsi_1/1
+	jb	.L329	# 1667	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%r13)	# 1669	[c=13 l=8]  *cmpqi_ccno_1/1
+	jne	.L330	# 1670	[c=13 l=6]  *jcc
+.L329:
+	movq	1040(%r13), %rax	# 1673	[c=9 l=7]  *movdi_internal/3
+	movb	%r14b, 63(%rax)	# 1674	[c=4 l=4]  *movqi_internal/8
+.L331:
+	movq	%r13, %rdi	# 1686	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 1685	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 1687	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 16774	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 16775	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 1689	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18341	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 1690	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 1692	[c=4 l=3]  *cmpdi_1/0
+	jb	.L283	# 1693	[c=13 l=6]  *jcc
+	movl	0(%r13), %ebx	# 1695	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 1700	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 1696	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 1698	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 1699	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 1701	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 1702	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 1703	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 1706	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 16776	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 1707	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 1710	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 1711	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 19561	[c=10 l=4]  *indirect_jump
+.L332:
+	movl	$63, %eax	# 1720	[c=4 l=5]  *movsi_internal/0
+	movzbl	10(%rbx), %r14d	# 1719	[c=13 l=5]  *zero_extendqisi2/0
+	subl	5176(%r13), %eax	# 1721	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 1722	[c=13 l=7]  *cmpsi_1/1
+	jb	.L333	# 1723	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%r13)	# 1725	[c=13 l=8]  *cmpqi_ccno_1/1
+	jne	.L334	# 1726	[c=13 l=6]  *jcc
+.L333:
+	movq	1040(%r13), %rax	# 1729	[c=9 l=7]  *movdi_internal/3
+	movzbl	63(%rax), %r15d	# 1730	[c=13 l=5]  *zero_extendqisi2/0
+.L335:
+	notl	%r14d	# 1747	[c=4 l=3]  *one_cmplsi2_1/0
+	movl	%r15d, %ecx	# 1741	[c=4 l=3]  *movsi_internal/0
+	movl	$63, %edx	# 1742	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 1745	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC32(%rip), %rsi	# 1743	[c=1 l=7]  *movdi_internal/4
+	andl	%r15d, %r14d	# 1748	[c=4 l=3]  *andsi_1/0
+	call	log_add_data_mov@PLT	# 1746	[c=0 l=5]  *call
+	movzbl	%r14b, %ecx	# 1749	[c=4 l=4]  *zero_extendqisi2/0
+	movl	$63, %edx	# 1751	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 1754	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC28(%rip), %rsi	# 1752	[c=1 l=7]  *movdi_internal/4
+	call	log_add_data_mov@PLT	# 1755	[c=0 l=5]  *call
+	movl	$63, %eax	# 1756	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 1757	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 1758	[c=13 l=7]  *cmpsi_1/1
+	jb	.L336	# 1759	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%r13)	# 1761	[c=13 l=8]  *cmpqi_ccno_1/1
+	jne	.L337	# 1762	[c=13 l=6]  *jcc
+.L336:
+	movq	1040(%r13), %rax	# 1765	[c=9 l=7]  *movdi_internal/3
+	movb	%r14b, 63(%rax)	# 1766	[c=4 l=4]  *movqi_internal/8
+.L338:
+	movq	%r13, %rdi	# 1778	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 1777	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 1779	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 16778	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 16779	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 1781	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18340	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 1782	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 1784	[c=4 l=3]  *cmpdi_1/0
+	jb	.L283	# 1785	[c=13 l=6]  *jcc
+	movl	0(%r13), %ebx	# 1787	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 1792	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 1788	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 1790	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 1791	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 1793	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 1794	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 1795	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 1798	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 16780	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 1799	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 1802	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 1803	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 19560	[c=10 l=4]  *indirect_jump
+.L339:
+	movzbl	10(%rbx), %r15d	# 1812	[c=13 l=5]  zero_extendqidi2/0
+	movzwl	12(%rbx), %eax	# 1811	[c=13 l=4]  *zero_extendhisi2/0
+	leaq	.LC43(%rip), %rsi	# 1817	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 1819	[c=4 l=3]  *movdi_internal/3
+	movzbl	1004(%r13,%r15), %ecx	# 1814	[c=14 l=9]  *zero_extendqisi2/0
+	movl	%eax, 8(%rsp)	# 16782	[c=4 l=4]  *movsi_internal/1
+	movl	%r15d, %edx	# 1816	[c=4 l=3]  *movsi_internal/0
+	xorl	%eax, %eax	# 19559	[c=4 l=2]  *movdi_xor
+	movq	%r15, %r14	# 18543	[c=4 l=3]  *movdi_internal/3
+	call	log_append@PLT	# 1821	[c=0 l=5]  *call
+	cmpl	$15, %r15d	# 1824	[c=4 l=4]  *cmpsi_1/0
+	jle	.L1398	# 1825	[c=13 l=6]  *jcc
+	movzbl	1004(%r13,%r15), %eax	# 1838	[c=14 l=9]  *zero_extendqisi2/0
+	movl	8(%rsp), %edi	# 16783	[c=9 l=4]  *movsi_internal/0
+	orl	%eax, %edi	# 1839	[c=4 l=2]  *iorsi_1/0
+	movl	$63, %eax	# 1840	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 1841	[c=13 l=7]  *subsi_1/1
+	movl	%edi, 16(%rsp)	# 16784	[c=4 l=4]  *movsi_internal/1
+	cmpl	5180(%r13), %eax	# 1842	[c=13 l=7]  *cmpsi_1/1
+	jb	.L341	# 1843	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%r13)	# 1845	[c=13 l=8]  *cmpqi_ccno_1/1
+	jne	.L342	# 1846	[c=13 l=6]  *jcc
+.L341:
+	movq	1040(%r13), %rax	# 1849	[c=9 l=7]  *movdi_internal/3
+	movzbl	63(%rax), %r8d	# 1850	[c=13 l=5]  *zero_extendqisi2/0
+.L343:
+	movl	%r8d, %ecx	# 1861	[c=4 l=3]  *movsi_internal/0
+	movl	$63, %edx	# 1862	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 1865	[c=4 l=3]  *movdi_internal/3
+	movl	%r8d, 24(%rsp)	# 17746	[c=4 l=5]  *movsi_internal/1
+	leaq	.LC32(%rip), %rsi	# 1863	[c=1 l=7]  *movdi_internal/4
+	call	log_add_data_mov@PLT	# 1866	[c=0 l=5]  *call
+	movl	24(%rsp), %r8d	# 17747	[c=9 l=5]  *movsi_internal/0
+	movl	%r14d, %edx	# 1875	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 1878	[c=4 l=3]  *movdi_internal/3
+	movl	8(%rsp), %eax	# 16785	[c=9 l=4]  *movsi_internal/0
+	leaq	.LC61(%rip), %rsi	# 1876	[c=1 l=7]  *movdi_internal/4
+	sall	$25, %r8d	# 1868	[c=4 l=4]  *ashlsi3_1/0
+	notl	%eax	# 1870	[c=4 l=2]  *one_cmplsi2_1/0
+	sarl	$31, %r8d	# 1869	[c=4 l=4]  ashrsi3_cvt/1
+	orl	%eax, %r8d	# 1871	[c=4 l=3]  *iorsi_1/0
+	movl	16(%rsp), %eax	# 16787	[c=9 l=4]  *movsi_internal/0
+	andl	%eax, %r8d	# 1872	[c=4 l=3]  *andsi_1/0
+	xorl	%eax, %eax	# 19557	[c=4 l=2]  *movdi_xor
+	movzbl	%r8b, %ecx	# 1873	[c=4 l=4]  *zero_extendqisi2/0
+	movl	%r8d, 8(%rsp)	# 17744	[c=4 l=5]  *movsi_internal/1
+	call	log_append@PLT	# 1880	[c=0 l=5]  *call
+	movl	8(%rsp), %r8d	# 17745	[c=9 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 1884	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 1883	[c=4 l=3]  *movdi_internal/3
+	movb	%r8b, 1004(%r13,%r15)	# 1882	[c=4 l=8]  *movqi_internal/8
+	call	log_dump_line@PLT	# 1885	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 16788	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 16789	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 1887	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18339	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 1888	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 1890	[c=4 l=3]  *cmpdi_1/0
+	jb	.L283	# 1891	[c=13 l=6]  *jcc
+	movl	0(%r13), %ebx	# 1893	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 1898	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 1894	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 1896	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 1897	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 1899	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 1900	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 1901	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 1904	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 16790	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 1905	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 1908	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 1909	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 19556	[c=10 l=4]  *indirect_jump
+.L344:
+	movq	%r13, %rdi	# 1918	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 1917	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 1919	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 16792	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 16793	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 1921	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18338	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 1922	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 1924	[c=4 l=3]  *cmpdi_1/0
+	jb	.L283	# 1925	[c=13 l=6]  *jcc
+	movq	56(%r13), %rax	# 16794	[c=9 l=4]  *movdi_internal/3
+	cmpq	%rax, 48(%r13)	# 1928	[c=13 l=4]  *cmpdi_1/0
+	jnb	.L1399	# 1929	[c=13 l=6]  *jcc
+.L345:
+	movq	%r13, %rdi	# 1935	[c=4 l=3]  *movdi_internal/3
+	call	log_is_idle@PLT	# 1936	[c=10 l=5]  *call_value
+	testb	%al, %al	# 1938	[c=4 l=2]  *cmpqi_ccno_1/0
+	jne	.L1400	# 1939	[c=13 l=6]  *jcc
+.L346:
+	movl	0(%r13), %ebx	# 1950	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 1955	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 1951	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 1953	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 1954	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 1956	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 1957	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 1958	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 1961	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 16795	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 1962	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 1965	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 1966	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 19555	[c=10 l=4]  *indirect_jump
+.L347:
+	movzbl	10(%rbx), %eax	# 1975	[c=9 l=4]  *movqi_internal/4
+	movzwl	12(%rbx), %r14d	# 1974	[c=13 l=5]  *zero_extendhisi2/0
+	movb	%al, 8(%rsp)	# 16797	[c=4 l=4]  *movqi_internal/8
+	movl	$63, %eax	# 1976	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 1977	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 1978	[c=13 l=7]  *cmpsi_1/1
+	jb	.L348	# 1979	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%r13)	# 1981	[c=13 l=8]  *cmpqi_ccno_1/1
+	jne	.L349	# 1982	[c=13 l=6]  *jcc
+.L348:
+	movq	1040(%r13), %rax	# 1985	[c=9 l=7]  *movdi_internal/3
+	movzbl	63(%rax), %r15d	# 1986	[c=13 l=5]  *zero_extendqisi2/0
+.L350:
+	movl	%r15d, %ecx	# 1997	[c=4 l=3]  *movsi_internal/0
+	movl	$63, %edx	# 1998	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 2001	[c=4 l=3]  *movdi_internal/3
+	andl	%r14d, %r15d	# 2003	[c=4 l=3]  *andsi_1/0
+	leaq	.LC32(%rip), %rsi	# 1999	[c=1 l=7]  *movdi_internal/4
+	call	log_add_data_mov@PLT	# 2002	[c=0 l=5]  *call
+	movl	%r15d, %edx	# 2004	[c=4 l=3]  *movsi_internal/0
+	movl	%r14d, %esi	# 2005	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 2006	[c=4 l=3]  *movdi_internal/3
+	call	log_add_flag_read@PLT	# 2007	[c=0 l=5]  *call
+	testl	%r15d, %r15d	# 2008	[c=4 l=3]  *cmpsi_ccno_1/0
+	jne	.L351	# 2009	[c=13 l=2]  *jcc
+	movsbl	8(%rsp), %eax	# 2011	[c=13 l=5]  extendqisi2
+	addq	$1, 48(%r13)	# 2018	[c=13 l=5]  *adddi_1/0
+	addl	0(%r13), %eax	# 2013	[c=9 l=4]  *addsi_1/1
+	andl	992(%r13), %eax	# 2016	[c=13 l=7]  *andsi_1/1
+	movl	%eax, 0(%r13)	# 2017	[c=4 l=4]  *movsi_internal/1
+.L351:
+	movq	%r13, %rdi	# 2022	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 2021	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 2023	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 16799	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 16800	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 2025	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18337	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 2026	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 2028	[c=4 l=3]  *cmpdi_1/0
+	jb	.L283	# 2029	[c=13 l=6]  *jcc
+	movq	56(%r13), %rax	# 16801	[c=9 l=4]  *movdi_internal/3
+	cmpq	%rax, 48(%r13)	# 2032	[c=13 l=4]  *cmpdi_1/0
+	jnb	.L1401	# 2033	[c=13 l=6]  *jcc
+.L352:
+	movq	%r13, %rdi	# 2039	[c=4 l=3]  *movdi_internal/3
+	call	log_is_idle@PLT	# 2040	[c=10 l=5]  *call_value
+	testb	%al, %al	# 2042	[c=4 l=2]  *cmpqi_ccno_1/0
+	jne	.L1402	# 2043	[c=13 l=6]  *jcc
+.L353:
+	movl	0(%r13), %ebx	# 2054	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 2059	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 2055	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 2057	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 2058	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 2060	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 2061	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 2062	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 2065	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 16802	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 2066	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 2069	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 2070	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 19554	[c=10 l=4]  *indirect_jump
+.L354:
+	movzbl	10(%rbx), %eax	# 2079	[c=9 l=4]  *movqi_internal/4
+	movzwl	12(%rbx), %r14d	# 2078	[c=13 l=5]  *zero_extendhisi2/0
+	movb	%al, 8(%rsp)	# 16804	[c=4 l=4]  *movqi_internal/8
+	movl	$63, %eax	# 2080	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 2081	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 2082	[c=13 l=7]  *cmpsi_1/1
+	jb	.L355	# 2083	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%r13)	# 2085	[c=13 l=8]  *cmpqi_ccno_1/1
+	jne	.L356	# 2086	[c=13 l=6]  *jcc
+.L355:
+	movq	1040(%r13), %rax	# 2089	[c=9 l=7]  *movdi_internal/3
+	movzbl	63(%rax), %r15d	# 2090	[c=13 l=5]  *zero_extendqisi2/0
+.L357:
+	movl	%r15d, %ecx	# 2101	[c=4 l=3]  *movsi_internal/0
+	movl	$63, %edx	# 2102	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 2105	[c=4 l=3]  *movdi_internal/3
+	andl	%r14d, %r15d	# 2107	[c=4 l=3]  *andsi_1/0
+	leaq	.LC32(%rip), %rsi	# 2103	[c=1 l=7]  *movdi_internal/4
+	call	log_add_data_mov@PLT	# 2106	[c=0 l=5]  *call
+	movl	%r15d, %edx	# 2108	[c=4 l=3]  *movsi_internal/0
+	movl	%r14d, %esi	# 2109	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 2110	[c=4 l=3]  *movdi_internal/3
+	call	log_add_flag_read@PLT	# 2111	[c=0 l=5]  *call
+	testl	%r15d, %r15d	# 2112	[c=4 l=3]  *cmpsi_ccno_1/0
+	je	.L358	# 2113	[c=13 l=2]  *jcc
+	movsbl	8(%rsp), %eax	# 2115	[c=13 l=5]  extendqisi2
+	addq	$1, 48(%r13)	# 2122	[c=13 l=5]  *adddi_1/0
+	addl	0(%r13), %eax	# 2117	[c=9 l=4]  *addsi_1/1
+	andl	992(%r13), %eax	# 2120	[c=13 l=7]  *andsi_1/1
+	movl	%eax, 0(%r13)	# 2121	[c=4 l=4]  *movsi_internal/1
+.L358:
+	movq	%r13, %rdi	# 2126	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 2125	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 2127	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 16806	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 16807	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 2129	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18336	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 2130	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 2132	[c=4 l=3]  *cmpdi_1/0
+	jb	.L283	# 2133	[c=13 l=6]  *jcc
+	movq	56(%r13), %rax	# 16808	[c=9 l=4]  *movdi_internal/3
+	cmpq	%rax, 48(%r13)	# 2136	[c=13 l=4]  *cmpdi_1/0
+	jnb	.L1403	# 2137	[c=13 l=6]  *jcc
+.L359:
+	movq	%r13, %rdi	# 2143	[c=4 l=3]  *movdi_internal/3
+	call	log_is_idle@PLT	# 2144	[c=10 l=5]  *call_value
+	testb	%al, %al	# 2146	[c=4 l=2]  *cmpqi_ccno_1/0
+	jne	.L1404	# 2147	[c=13 l=6]  *jcc
+.L360:
+	movl	0(%r13), %ebx	# 2158	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 2163	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 2159	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 2161	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 2162	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 2164	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 2165	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 2166	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 2169	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 16809	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 2170	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 2173	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 2174	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 19553	[c=10 l=4]  *indirect_jump
+.L361:
+	movl	$63, %eax	# 2183	[c=4 l=5]  *movsi_internal/0
+	movzbl	10(%rbx), %r15d	# 2182	[c=13 l=5]  *zero_extendqisi2/0
+	subl	5176(%r13), %eax	# 2184	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 2185	[c=13 l=7]  *cmpsi_1/1
+	jb	.L362	# 2186	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%r13)	# 2188	[c=13 l=8]  *cmpqi_ccno_1/1
+	jne	.L363	# 2189	[c=13 l=6]  *jcc
+.L362:
+	movq	1040(%r13), %rax	# 2192	[c=9 l=7]  *movdi_internal/3
+	movzbl	63(%rax), %r14d	# 2193	[c=13 l=5]  *zero_extendqisi2/0
+.L364:
+	movl	%r14d, %ecx	# 2204	[c=4 l=3]  *movsi_internal/0
+	movl	$63, %edx	# 2205	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 2208	[c=4 l=3]  *movdi_internal/3
+	orl	%r15d, %r14d	# 2210	[c=4 l=3]  *iorsi_1/0
+	leaq	.LC32(%rip), %rsi	# 2206	[c=1 l=7]  *movdi_internal/4
+	call	log_add_data_mov@PLT	# 2209	[c=0 l=5]  *call
+	movzbl	%r14b, %ecx	# 2211	[c=4 l=4]  *zero_extendqisi2/0
+	movl	$63, %edx	# 2213	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 2216	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC28(%rip), %rsi	# 2214	[c=1 l=7]  *movdi_internal/4
+	call	log_add_data_mov@PLT	# 2217	[c=0 l=5]  *call
+	movl	$63, %eax	# 2218	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 2219	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 2220	[c=13 l=7]  *cmpsi_1/1
+	jb	.L365	# 2221	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%r13)	# 2223	[c=13 l=8]  *cmpqi_ccno_1/1
+	jne	.L366	# 2224	[c=13 l=6]  *jcc
+.L365:
+	movq	1040(%r13), %rax	# 2227	[c=9 l=7]  *movdi_internal/3
+	movb	%r14b, 63(%rax)	# 2228	[c=4 l=4]  *movqi_internal/8
+.L367:
+	movq	%r13, %rdi	# 2240	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 2239	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 2241	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 16811	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 16812	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 2243	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18335	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 2244	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 2246	[c=4 l=3]  *cmpdi_1/0
+	jb	.L283	# 2247	[c=13 l=6]  *jcc
+	movl	0(%r13), %ebx	# 2249	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 2254	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 2250	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 2252	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 2253	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 2255	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 2256	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 2257	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 2260	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 16813	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 2261	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 2264	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 2265	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 19552	[c=10 l=4]  *indirect_jump
+.L368:
+	movzbl	10(%rbx), %r14d	# 2274	[c=13 l=5]  zero_extendqidi2/0
+	movzwl	12(%rbx), %eax	# 2273	[c=13 l=4]  *zero_extendhisi2/0
+	leaq	.LC43(%rip), %rsi	# 2279	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 2281	[c=4 l=3]  *movdi_internal/3
+	movzbl	1004(%r13,%r14), %ecx	# 2276	[c=14 l=9]  *zero_extendqisi2/0
+	movl	%eax, 8(%rsp)	# 16815	[c=4 l=4]  *movsi_internal/1
+	movl	%r14d, %edx	# 2278	[c=4 l=3]  *movsi_internal/0
+	xorl	%eax, %eax	# 19551	[c=4 l=2]  *movdi_xor
+	call	log_append@PLT	# 2283	[c=0 l=5]  *call
+	cmpl	$15, %r14d	# 2286	[c=4 l=4]  *cmpsi_1/0
+	jle	.L1405	# 2287	[c=13 l=6]  *jcc
+	movzbl	1004(%r13,%r14), %eax	# 2300	[c=14 l=9]  *zero_extendqisi2/0
+	xorl	%r15d, %r15d	# 19547	[c=4 l=3]  *movsi_xor
+	testl	%eax, 8(%rsp)	# 19548	[c=13 l=4]  *testsi_1/0
+	movl	$63, %eax	# 2306	[c=4 l=5]  *movsi_internal/0
+	setne	%r15b	# 19549	[c=4 l=4]  *setcc_qi_slp
+	subl	5176(%r13), %eax	# 2307	[c=13 l=7]  *subsi_1/1
+	sall	$6, %r15d	# 2305	[c=4 l=4]  *ashlsi3_1/0
+	cmpl	5180(%r13), %eax	# 2308	[c=13 l=7]  *cmpsi_1/1
+	jb	.L370	# 2309	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%r13)	# 2311	[c=13 l=8]  *cmpqi_ccno_1/1
+	jne	.L371	# 2312	[c=13 l=6]  *jcc
+.L370:
+	movq	1040(%r13), %rax	# 2315	[c=9 l=7]  *movdi_internal/3
+	movzbl	63(%rax), %r14d	# 2316	[c=13 l=5]  *zero_extendqisi2/0
+.L372:
+	movl	%r14d, %ecx	# 2327	[c=4 l=3]  *movsi_internal/0
+	andl	$-65, %r14d	# 2333	[c=4 l=4]  *andsi_1/0
+	movl	$63, %edx	# 2328	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 2331	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC32(%rip), %rsi	# 2329	[c=1 l=7]  *movdi_internal/4
+	orl	%r15d, %r14d	# 2334	[c=4 l=3]  *iorsi_1/0
+	call	log_add_data_mov@PLT	# 2332	[c=0 l=5]  *call
+	movzbl	%r14b, %ecx	# 2335	[c=4 l=4]  *zero_extendqisi2/0
+	movl	$63, %edx	# 2337	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 2340	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC28(%rip), %rsi	# 2338	[c=1 l=7]  *movdi_internal/4
+	call	log_add_data_mov@PLT	# 2341	[c=0 l=5]  *call
+	movl	$63, %eax	# 2342	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 2343	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 2344	[c=13 l=7]  *cmpsi_1/1
+	jb	.L373	# 2345	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%r13)	# 2347	[c=13 l=8]  *cmpqi_ccno_1/1
+	jne	.L374	# 2348	[c=13 l=6]  *jcc
+.L373:
+	movq	1040(%r13), %rax	# 2351	[c=9 l=7]  *movdi_internal/3
+	movb	%r14b, 63(%rax)	# 2352	[c=4 l=4]  *movqi_internal/8
+.L375:
+	movq	%r13, %rdi	# 2364	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 2363	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 2365	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 16817	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 16818	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 2367	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18332	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 2368	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 2370	[c=4 l=3]  *cmpdi_1/0
+	jb	.L283	# 2371	[c=13 l=6]  *jcc
+	movl	0(%r13), %ebx	# 2373	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 2378	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 2374	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 2376	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 2377	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 2379	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 2380	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 2381	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 2384	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 16819	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 2385	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 2388	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 2389	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 19546	[c=10 l=4]  *indirect_jump
+.L376:
+	movzwl	12(%rbx), %eax	# 2397	[c=13 l=4]  *zero_extendhisi2/0
+	movl	5176(%r13), %ecx	# 2399	[c=9 l=7]  *movsi_internal/0
+	movl	5180(%r13), %r14d	# 2400	[c=9 l=7]  *movsi_internal/0
+	movl	%eax, 8(%rsp)	# 16821	[c=4 l=4]  *movsi_internal/1
+	movzbl	10(%rbx), %eax	# 2398	[c=13 l=4]  *zero_extendqisi2/0
+	movl	%eax, 16(%rsp)	# 16822	[c=4 l=4]  *movsi_internal/1
+	movl	$61, %eax	# 2401	[c=4 l=5]  *movsi_internal/0
+	subl	%ecx, %eax	# 2402	[c=4 l=2]  *subsi_1/0
+	cmpl	%r14d, %eax	# 2403	[c=4 l=3]  *cmpsi_1/0
+	jb	.L377	# 2404	[c=13 l=6]  *jcc
+	cmpb	$1, 1081(%r13)	# 2408	[c=13 l=8]  *cmpqi_1/0
+	ja	.L1406	# 2409	[c=13 l=6]  *jcc
+	movq	1040(%r13), %rax	# 14390	[c=9 l=7]  *movdi_internal/3
+	movzbl	61(%rax), %r15d	# 14391	[c=13 l=5]  *zero_extendqisi2/0
+.L379:
+	movzbl	62(%rax), %r8d	# 2446	[c=13 l=5]  *zero_extendqisi2/0
+.L381:
+	sall	$8, %r8d	# 2449	[c=4 l=4]  *ashlsi3_1/0
+	movl	$61, %edx	# 2452	[c=4 l=5]  *movsi_internal/0
+	leaq	.LC30(%rip), %rsi	# 2453	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 2455	[c=4 l=3]  *movdi_internal/3
+	orl	%r8d, %r15d	# 2450	[c=4 l=3]  *iorsi_1/0
+	movl	%r15d, %ecx	# 2451	[c=4 l=3]  *movsi_internal/0
+	call	log_add_data_mov@PLT	# 2456	[c=0 l=5]  *call
+	movl	996(%r13), %edx	# 2458	[c=9 l=7]  *movsi_internal/0
+	movzbl	840(%r13), %eax	# 2460	[c=13 l=8]  *zero_extendqisi2/0
+	leal	1(%rdx,%rax), %eax	# 2461	[c=5 l=4]  *leasi
+	cmpl	%eax, %r15d	# 2462	[c=4 l=3]  *cmpsi_1/0
+	jb	.L1407	# 2463	[c=13 l=6]  *jcc
+	cmpl	$63, %r15d	# 15089	[c=4 l=4]  *cmpsi_1/0
+	movl	0(%r13), %r14d	# 2471	[c=5 l=4]  *movsi_internal/0
+	leal	-1(%r15), %r9d	# 18331	[c=4 l=4]  *leasi
+	movl	%r15d, %edx	# 2480	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC29(%rip), %rax	# 16565	[c=1 l=7]  *movdi_internal/4
+	leaq	.LC28(%rip), %rsi	# 16564	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 2482	[c=4 l=3]  *movdi_internal/3
+	movl	%r9d, 24(%rsp)	# 17750	[c=4 l=5]  *movsi_internal/1
+	cmovne	%rax, %rsi	# 15090	[c=8 l=4]  *movdicc_noc/1
+	movzbl	%r14b, %ecx	# 2473	[c=4 l=4]  *zero_extendqisi2/0
+	call	log_add_data_mov@PLT	# 2483	[c=0 l=5]  *call
+	movl	%r15d, %eax	# 16823	[c=4 l=3]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 2484	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 2485	[c=13 l=7]  *cmpsi_1/1
+	movl	24(%rsp), %r9d	# 17751	[c=9 l=5]  *movsi_internal/0
+	jb	.L384	# 2486	[c=13 l=2]  *jcc
+	movl	%r15d, %eax	# 16825	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %eax	# 2488	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 16536	[c=5 l=5]  *andsi_1_zext
+	cmpb	$0, 1080(%r13,%rax)	# 2491	[c=14 l=9]  *cmpqi_ccno_1/1
+	jne	.L385	# 2492	[c=13 l=6]  *jcc
+.L384:
+	movq	1040(%r13), %rdx	# 2496	[c=9 l=7]  *movdi_internal/3
+	movslq	%r15d, %rax	# 2495	[c=4 l=3]  *extendsidi2_rex64/1
+	movb	%r14b, (%rdx,%rax)	# 2497	[c=4 l=4]  *movqi_internal/8
+.L386:
+	movl	0(%r13), %ecx	# 2508	[c=5 l=4]  *movsi_internal/0
+	movl	%r9d, %edx	# 2518	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 2520	[c=4 l=3]  *movdi_internal/3
+	movl	%r9d, 32(%rsp)	# 17754	[c=4 l=5]  *movsi_internal/1
+	leaq	.LC28(%rip), %rsi	# 16566	[c=1 l=7]  *movdi_internal/4
+	leal	-2(%r15), %r14d	# 18330	[c=4 l=4]  *leasi
+	movl	%ecx, %eax	# 16827	[c=4 l=2]  *movsi_internal/0
+	movzbl	%ch, %ecx	# 2511	[c=4 l=3]  *extzvsi
+	shrl	$8, %eax	# 2509	[c=4 l=3]  *lshrsi3_1/0
+	cmpl	$63, %r9d	# 15101	[c=4 l=4]  *cmpsi_1/0
+	movl	%eax, 24(%rsp)	# 16828	[c=4 l=4]  *movsi_internal/1
+	leaq	.LC29(%rip), %rax	# 16567	[c=1 l=7]  *movdi_internal/4
+	cmovne	%rax, %rsi	# 15102	[c=8 l=4]  *movdicc_noc/1
+	call	log_add_data_mov@PLT	# 2521	[c=0 l=5]  *call
+	movslq	32(%rsp), %r9	# 17755	[c=13 l=5]  *extendsidi2_rex64/1
+	movl	%r9d, %eax	# 16829	[c=4 l=3]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 2522	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 2523	[c=13 l=7]  *cmpsi_1/1
+	jb	.L388	# 2524	[c=13 l=2]  *jcc
+	movl	%r9d, %eax	# 16831	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %eax	# 2526	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 16535	[c=5 l=5]  *andsi_1_zext
+	cmpb	$0, 1080(%r13,%rax)	# 2529	[c=14 l=9]  *cmpqi_ccno_1/1
+	jne	.L389	# 2530	[c=13 l=6]  *jcc
+.L388:
+	movq	1040(%r13), %rax	# 2534	[c=9 l=7]  *movdi_internal/3
+	movzbl	24(%rsp), %edi	# 16833	[c=9 l=5]  *movqi_internal/4
+	movb	%dil, (%rax,%r9)	# 2535	[c=4 l=4]  *movqi_internal/8
+.L390:
+	cmpb	$0, 840(%r13)	# 2546	[c=13 l=8]  *cmpqi_ccno_1/1
+	je	.L391	# 2547	[c=13 l=2]  *jcc
+	movl	0(%r13), %eax	# 16834	[c=5 l=4]  *movsi_internal/0
+	subl	$3, %r15d	# 2551	[c=4 l=4]  *addsi_1/0
+	movq	%r13, %rdi	# 2561	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC29(%rip), %rdx	# 16569	[c=1 l=7]  *movdi_internal/4
+	leaq	.LC28(%rip), %rsi	# 16568	[c=1 l=7]  *movdi_internal/4
+	shrl	$16, %eax	# 2550	[c=4 l=3]  *lshrsi3_1/0
+	cmpl	$63, %r14d	# 15113	[c=4 l=4]  *cmpsi_1/0
+	cmovne	%rdx, %rsi	# 15114	[c=8 l=4]  *movdicc_noc/1
+	movzbl	%al, %ecx	# 2552	[c=4 l=3]  *zero_extendqisi2/0
+	movl	%r14d, %edx	# 2559	[c=4 l=3]  *movsi_internal/0
+	movl	%eax, 24(%rsp)	# 17756	[c=4 l=4]  *movsi_internal/1
+	call	log_add_data_mov@PLT	# 2562	[c=0 l=5]  *call
+	movl	%r14d, %edx	# 16836	[c=4 l=3]  *movsi_internal/0
+	subl	5176(%r13), %edx	# 2563	[c=13 l=7]  *subsi_1/1
+	movl	24(%rsp), %eax	# 17757	[c=9 l=4]  *movsi_internal/0
+	cmpl	5180(%r13), %edx	# 2564	[c=13 l=7]  *cmpsi_1/1
+	jb	.L393	# 2565	[c=13 l=2]  *jcc
+	movl	%r14d, %edx	# 16838	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %edx	# 2567	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %edx	# 16534	[c=5 l=6]  *andsi_1_zext
+	cmpb	$0, 1080(%r13,%rdx)	# 2570	[c=14 l=9]  *cmpqi_ccno_1/1
+	jne	.L394	# 2571	[c=13 l=6]  *jcc
+.L393:
+	movq	1040(%r13), %rdx	# 2575	[c=9 l=7]  *movdi_internal/3
+	movslq	%r14d, %r14	# 2574	[c=4 l=3]  *extendsidi2_rex64/1
+	movb	%al, (%rdx,%r14)	# 2576	[c=4 l=4]  *movqi_internal/8
+.L395:
+	movl	%r15d, %r14d	# 10	[c=4 l=3]  *movsi_internal/0
+.L391:
+	movzwl	%r14w, %r15d	# 2591	[c=4 l=4]  *zero_extendhisi2/0
+	movl	$61, %edx	# 2593	[c=4 l=5]  *movsi_internal/0
+	leaq	.LC31(%rip), %rsi	# 2594	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 2596	[c=4 l=3]  *movdi_internal/3
+	movl	%r15d, %ecx	# 2592	[c=4 l=3]  *movsi_internal/0
+	call	log_add_data_mov@PLT	# 2597	[c=0 l=5]  *call
+	movl	$61, %edx	# 2598	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r13), %edx	# 2599	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %edx	# 2600	[c=13 l=7]  *cmpsi_1/1
+	jb	.L396	# 2601	[c=13 l=2]  *jcc
+	cmpb	$1, 1081(%r13)	# 2605	[c=13 l=8]  *cmpqi_1/0
+	ja	.L1408	# 2606	[c=13 l=6]  *jcc
+.L396:
+	movq	1040(%r13), %rdx	# 2617	[c=9 l=7]  *movdi_internal/3
+	movb	%r14b, 61(%rdx)	# 2618	[c=4 l=4]  *movqi_internal/8
+.L397:
+	movl	%r15d, %eax	# 16840	[c=4 l=3]  *movsi_internal/0
+	movl	$62, %edx	# 2622	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r13), %edx	# 2623	[c=13 l=7]  *subsi_1/1
+	sarl	$8, %eax	# 2621	[c=4 l=3]  *ashrsi3_1/0
+	cmpl	5180(%r13), %edx	# 2624	[c=13 l=7]  *cmpsi_1/1
+	jb	.L398	# 2625	[c=13 l=2]  *jcc
+	cmpb	$1, 1081(%r13)	# 2629	[c=13 l=8]  *cmpqi_1/0
+	ja	.L1409	# 2630	[c=13 l=6]  *jcc
+.L398:
+	movq	1040(%r13), %rdx	# 2640	[c=9 l=7]  *movdi_internal/3
+	movb	%al, 62(%rdx)	# 2641	[c=4 l=3]  *movqi_internal/8
+.L399:
+	movl	16(%rsp), %esi	# 16842	[c=9 l=4]  *movsi_internal/0
+	movl	8(%rsp), %eax	# 16844	[c=9 l=4]  *movsi_internal/0
+	sall	$16, %esi	# 2644	[c=4 l=3]  *ashlsi3_1/0
+	orl	%eax, %esi	# 2645	[c=4 l=2]  *iorsi_1/0
+	movl	%esi, 0(%r13)	# 2646	[c=4 l=4]  *movsi_internal/1
+	cmpl	%esi, 992(%r13)	# 2647	[c=13 l=7]  *cmpsi_1/0
+	jb	.L1410	# 2648	[c=13 l=6]  *jcc
+	movzbl	840(%r13), %eax	# 2656	[c=13 l=8]  zero_extendqidi2/0
+	addq	%rax, 48(%r13)	# 2657	[c=13 l=4]  *adddi_1/0
+	movq	%r13, %rdi	# 2659	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 2658	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 2660	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 16845	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 16846	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 2662	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18329	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 2663	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 2665	[c=4 l=3]  *cmpdi_1/0
+	jb	.L283	# 2666	[c=13 l=6]  *jcc
+	movq	56(%r13), %rax	# 16847	[c=9 l=4]  *movdi_internal/3
+	cmpq	%rax, 48(%r13)	# 2669	[c=13 l=4]  *cmpdi_1/0
+	jnb	.L1411	# 2670	[c=13 l=6]  *jcc
+.L401:
+	movq	%r13, %rdi	# 2676	[c=4 l=3]  *movdi_internal/3
+	call	log_is_idle@PLT	# 2677	[c=10 l=5]  *call_value
+	testb	%al, %al	# 2679	[c=4 l=2]  *cmpqi_ccno_1/0
+	jne	.L1412	# 2680	[c=13 l=6]  *jcc
+.L402:
+	movl	0(%r13), %ebx	# 2691	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 2696	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 2692	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 2694	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 2695	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 2697	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 2698	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 2699	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 2702	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 16848	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 2703	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 2706	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 2707	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 19545	[c=10 l=4]  *indirect_jump
+.L403:
+	movzwl	12(%rbx), %eax	# 2715	[c=13 l=4]  *zero_extendhisi2/0
+	movzbl	10(%rbx), %r14d	# 2716	[c=13 l=5]  *zero_extendqisi2/0
+	movl	%eax, 16(%rsp)	# 16850	[c=4 l=4]  *movsi_internal/1
+	movl	%r14d, %eax	# 18545	[c=4 l=3]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 2719	[c=13 l=7]  *subsi_1/1
+	movb	%r14b, 8(%rsp)	# 17758	[c=4 l=5]  *movqi_internal/8
+	cmpl	5180(%r13), %eax	# 2720	[c=13 l=7]  *cmpsi_1/1
+	jb	.L404	# 2721	[c=13 l=2]  *jcc
+	movl	%r14d, %eax	# 16855	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %eax	# 2723	[c=4 l=3]  *ashrsi3_1/0
+	cltq	# 2724	[c=4 l=2]  *extendsidi2_rex64/0
+	cmpb	$0, 1080(%r13,%rax)	# 2725	[c=14 l=9]  *cmpqi_ccno_1/1
+	jne	.L405	# 2726	[c=13 l=6]  *jcc
+.L404:
+	movzbl	8(%rsp), %eax	# 2729	[c=13 l=5]  zero_extendqidi2/0
+	movq	1040(%r13), %rdx	# 2730	[c=9 l=7]  *movdi_internal/3
+	movzbl	(%rdx,%rax), %ecx	# 2731	[c=13 l=4]  *zero_extendqisi2/0
+.L406:
+	cmpl	$63, %r14d	# 15125	[c=4 l=4]  *cmpsi_1/0
+	movl	%r14d, %edx	# 2748	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 2750	[c=4 l=3]  *movdi_internal/3
+	movl	%ecx, 24(%rsp)	# 17759	[c=4 l=4]  *movsi_internal/1
+	leaq	.LC33(%rip), %rax	# 16571	[c=1 l=7]  *movdi_internal/4
+	leaq	.LC32(%rip), %rsi	# 16570	[c=1 l=7]  *movdi_internal/4
+	cmovne	%rax, %rsi	# 15126	[c=8 l=4]  *movdicc_noc/1
+	call	log_add_data_mov@PLT	# 2751	[c=0 l=5]  *call
+	cmpl	6564(%r13), %r14d	# 2752	[c=13 l=7]  *cmpsi_1/1
+	movl	24(%rsp), %ecx	# 17760	[c=9 l=4]  *movsi_internal/0
+	jb	.L1413	# 2753	[c=13 l=6]  *jcc
+.L408:
+	movl	16(%rsp), %r15d	# 16858	[c=9 l=5]  *movsi_internal/0
+	notl	%r15d	# 2762	[c=4 l=3]  *one_cmplsi2_1/0
+	andl	%ecx, %r15d	# 2763	[c=4 l=3]  *andsi_1/0
+.L409:
+	cmpl	$63, %r14d	# 15137	[c=4 l=4]  *cmpsi_1/0
+	leaq	.LC29(%rip), %rdx	# 16573	[c=1 l=7]  *movdi_internal/4
+	movzbl	%r15b, %ecx	# 2766	[c=4 l=4]  *zero_extendqisi2/0
+	movq	%r13, %rdi	# 2775	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC28(%rip), %rsi	# 16572	[c=1 l=7]  *movdi_internal/4
+	cmovne	%rdx, %rsi	# 15138	[c=8 l=4]  *movdicc_noc/1
+	movl	%r14d, %edx	# 2773	[c=4 l=3]  *movsi_internal/0
+	call	log_add_data_mov@PLT	# 2776	[c=0 l=5]  *call
+	movl	%r14d, %edx	# 16860	[c=4 l=3]  *movsi_internal/0
+	subl	5176(%r13), %edx	# 2777	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %edx	# 2778	[c=13 l=7]  *cmpsi_1/1
+	jb	.L411	# 2779	[c=13 l=2]  *jcc
+	movl	%r14d, %edx	# 16862	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %edx	# 2781	[c=4 l=3]  *ashrsi3_1/0
+	movslq	%edx, %rdx	# 2782	[c=4 l=3]  *extendsidi2_rex64/1
+	cmpb	$0, 1080(%r13,%rdx)	# 2783	[c=14 l=9]  *cmpqi_ccno_1/1
+	jne	.L412	# 2784	[c=13 l=6]  *jcc
+.L411:
+	movzbl	8(%rsp), %r14d	# 2787	[c=13 l=6]  zero_extendqidi2/0
+	movq	1040(%r13), %rdx	# 2788	[c=9 l=7]  *movdi_internal/3
+	movb	%r15b, (%rdx,%r14)	# 2789	[c=4 l=4]  *movqi_internal/8
+.L413:
+	movq	%r13, %rdi	# 2801	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 2800	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 2802	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 16865	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 16866	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 2804	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18328	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 2805	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 2807	[c=4 l=3]  *cmpdi_1/0
+	jb	.L283	# 2808	[c=13 l=6]  *jcc
+	movl	0(%r13), %ebx	# 2810	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 2815	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 2811	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 2813	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 2814	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 2816	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 2817	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 2818	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 2821	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 16867	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 2822	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 2825	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 2826	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 19543	[c=10 l=4]  *indirect_jump
+.L414:
+	movzbl	10(%rbx), %r15d	# 2834	[c=13 l=5]  zero_extendqidi2/0
+	xorl	%eax, %eax	# 19542	[c=4 l=2]  *movdi_xor
+	leaq	.LC43(%rip), %rsi	# 2839	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 2841	[c=4 l=3]  *movdi_internal/3
+	movzbl	1004(%r13,%r15), %ecx	# 2836	[c=14 l=9]  *zero_extendqisi2/0
+	movl	%r15d, %edx	# 2838	[c=4 l=3]  *movsi_internal/0
+	call	log_append@PLT	# 2843	[c=0 l=5]  *call
+	cmpl	$15, %r15d	# 2846	[c=4 l=4]  *cmpsi_1/0
+	jle	.L1414	# 2847	[c=13 l=6]  *jcc
+	movl	%r15d, %edx	# 2864	[c=4 l=3]  *movsi_internal/0
+	xorl	%eax, %eax	# 19540	[c=4 l=2]  *movdi_xor
+	leaq	.LC61(%rip), %rsi	# 2865	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 2867	[c=4 l=3]  *movdi_internal/3
+	movzbl	1004(%r13,%r15), %r8d	# 16869	[c=10 l=9]  *movqi_internal/4
+	notl	%r8d	# 18326	[c=4 l=3]  *one_cmplsi2_1/0
+	movzbl	%r8b, %ecx	# 2862	[c=4 l=4]  *zero_extendqisi2/0
+	movb	%r8b, 16(%rsp)	# 17763	[c=4 l=5]  *movqi_internal/8
+	movl	%ecx, 8(%rsp)	# 17761	[c=4 l=4]  *movsi_internal/1
+	call	log_append@PLT	# 2869	[c=0 l=5]  *call
+	movzbl	16(%rsp), %r8d	# 17764	[c=9 l=6]  *movqi_internal/4
+	leaq	flag_update_table_logical(%rip), %rax	# 16544	[c=1 l=7]  *movdi_internal/4
+	movb	%r8b, 1004(%r13,%r15)	# 2871	[c=4 l=8]  *movqi_internal/8
+	movslq	8(%rsp), %r15	# 17762	[c=13 l=5]  *extendsidi2_rex64/1
+	movzbl	(%rax,%r15), %r15d	# 2874	[c=9 l=5]  *movqi_internal/4
+	movl	$63, %eax	# 2877	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 2878	[c=13 l=7]  *subsi_1/1
+	orl	$1, %r15d	# 18327	[c=4 l=4]  *iorsi_1/0
+	movzbl	%r15b, %r15d	# 2876	[c=4 l=4]  *zero_extendqisi2/0
+	cmpl	5180(%r13), %eax	# 2879	[c=13 l=7]  *cmpsi_1/1
+	jb	.L416	# 2880	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%r13)	# 2882	[c=13 l=8]  *cmpqi_ccno_1/1
+	jne	.L417	# 2883	[c=13 l=6]  *jcc
+.L416:
+	movq	1040(%r13), %rax	# 2886	[c=9 l=7]  *movdi_internal/3
+	movzbl	63(%rax), %r14d	# 2887	[c=13 l=5]  *zero_extendqisi2/0
+.L418:
+	movl	%r14d, %ecx	# 2898	[c=4 l=3]  *movsi_internal/0
+	andl	$-32, %r14d	# 2904	[c=4 l=4]  *andsi_1/0
+	movl	$63, %edx	# 2899	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 2902	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC32(%rip), %rsi	# 2900	[c=1 l=7]  *movdi_internal/4
+	orl	%r15d, %r14d	# 2905	[c=4 l=3]  *iorsi_1/0
+	call	log_add_data_mov@PLT	# 2903	[c=0 l=5]  *call
+	movzbl	%r14b, %ecx	# 2906	[c=4 l=4]  *zero_extendqisi2/0
+	movl	$63, %edx	# 2908	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 2911	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC28(%rip), %rsi	# 2909	[c=1 l=7]  *movdi_internal/4
+	call	log_add_data_mov@PLT	# 2912	[c=0 l=5]  *call
+	movl	$63, %eax	# 2913	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 2914	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 2915	[c=13 l=7]  *cmpsi_1/1
+	jb	.L419	# 2916	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%r13)	# 2918	[c=13 l=8]  *cmpqi_ccno_1/1
+	jne	.L420	# 2919	[c=13 l=6]  *jcc
+.L419:
+	movq	1040(%r13), %rax	# 2922	[c=9 l=7]  *movdi_internal/3
+	movb	%r14b, 63(%rax)	# 2923	[c=4 l=4]  *movqi_internal/8
+.L421:
+	movq	%r13, %rdi	# 2935	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 2934	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 2936	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 16871	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 16872	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 2938	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18325	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 2939	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 2941	[c=4 l=3]  *cmpdi_1/0
+	jb	.L283	# 2942	[c=13 l=6]  *jcc
+	movl	0(%r13), %ebx	# 2944	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 2949	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 2945	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 2947	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 2948	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 2950	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 2951	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 2952	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 2955	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 16873	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 2956	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 2959	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 2960	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 19539	[c=10 l=4]  *indirect_jump
+.L422:
+	movzbl	10(%rbx), %r8d	# 2969	[c=13 l=5]  zero_extendqidi2/0
+	xorl	%eax, %eax	# 19538	[c=4 l=2]  *movdi_xor
+	movq	%r13, %rdi	# 2976	[c=4 l=3]  *movdi_internal/3
+	movzwl	12(%rbx), %r14d	# 2968	[c=13 l=5]  *zero_extendhisi2/0
+	leaq	.LC43(%rip), %rsi	# 2974	[c=1 l=7]  *movdi_internal/4
+	movzbl	1004(%r13,%r8), %ecx	# 2971	[c=14 l=9]  *zero_extendqisi2/0
+	movq	%r8, %r15	# 18548	[c=4 l=3]  *movdi_internal/3
+	movl	%r8d, %edx	# 2973	[c=4 l=3]  *movsi_internal/0
+	movq	%r8, 8(%rsp)	# 17767	[c=4 l=5]  *movdi_internal/5
+	call	log_append@PLT	# 2978	[c=0 l=5]  *call
+	cmpl	$15, %r15d	# 2981	[c=4 l=4]  *cmpsi_1/0
+	movq	8(%rsp), %r8	# 17768	[c=9 l=5]  *movdi_internal/3
+	leaq	.LC43(%rip), %rsi	# 17766	[c=1 l=7]  *movdi_internal/4
+	jle	.L1415	# 2982	[c=13 l=6]  *jcc
+	movslq	%r14d, %r9	# 2997	[c=4 l=3]  *extendsidi2_rex64/1
+	xorl	%eax, %eax	# 19536	[c=4 l=2]  *movdi_xor
+	movl	%r14d, %edx	# 3000	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 3003	[c=4 l=3]  *movdi_internal/3
+	movzbl	1004(%r13,%r8), %r15d	# 2995	[c=14 l=9]  *zero_extendqisi2/0
+	movq	%r9, 8(%rsp)	# 17769	[c=4 l=5]  *movdi_internal/5
+	movzbl	1004(%r13,%r9), %ecx	# 2998	[c=14 l=9]  *zero_extendqisi2/0
+	movb	%r15b, 16(%rsp)	# 17771	[c=4 l=5]  *movqi_internal/8
+	call	log_append@PLT	# 3005	[c=0 l=5]  *call
+	cmpl	$15, %r14d	# 3008	[c=4 l=4]  *cmpsi_1/0
+	movq	8(%rsp), %r9	# 17770	[c=9 l=5]  *movdi_internal/3
+	movzbl	16(%rsp), %r8d	# 17772	[c=9 l=6]  *movqi_internal/4
+	jle	.L1416	# 3009	[c=13 l=6]  *jcc
+	movzbl	1004(%r13,%r9), %edx	# 3022	[c=14 l=9]  *zero_extendqisi2/0
+	movl	%r8d, %eax	# 16875	[c=4 l=3]  *movsi_internal/0
+	andl	$136, %eax	# 3024	[c=4 l=5]  *andsi_1/0
+	movl	%edx, %ecx	# 16877	[c=4 l=2]  *movsi_internal/0
+	subl	%edx, %r15d	# 3030	[c=4 l=3]  *subsi_1/0
+	andl	$136, %ecx	# 3027	[c=4 l=6]  *andsi_1/0
+	andl	$511, %r15d	# 3031	[c=4 l=7]  *andsi_1/0
+	leal	(%rcx,%rax,2), %eax	# 3028	[c=8 l=3]  *leasi
+	imull	$260, %eax, %eax	# 3032	[c=12 l=6]  *mulsi3_1/1
+	andl	$7680, %eax	# 3033	[c=4 l=5]  *andsi_1/0
+	orl	%eax, %r15d	# 3034	[c=5 l=3]  *iorsi_1_zext
+	movl	$63, %eax	# 3035	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 3036	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 3037	[c=13 l=7]  *cmpsi_1/1
+	jb	.L425	# 3038	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%r13)	# 3040	[c=13 l=8]  *cmpqi_ccno_1/1
+	jne	.L426	# 3041	[c=13 l=6]  *jcc
+.L425:
+	movq	1040(%r13), %rax	# 3044	[c=9 l=7]  *movdi_internal/3
+	movzbl	63(%rax), %r14d	# 3045	[c=13 l=5]  *zero_extendqisi2/0
+.L427:
+	movl	%r14d, %ecx	# 3056	[c=4 l=3]  *movsi_internal/0
+	movl	$63, %edx	# 3057	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 3060	[c=4 l=3]  *movdi_internal/3
+	andl	$-64, %r14d	# 3062	[c=4 l=4]  *andsi_1/0
+	leaq	.LC32(%rip), %rsi	# 3058	[c=1 l=7]  *movdi_internal/4
+	call	log_add_data_mov@PLT	# 3061	[c=0 l=5]  *call
+	leaq	flag_update_table_sub8(%rip), %rax	# 16545	[c=1 l=7]  *movdi_internal/4
+	movl	$63, %edx	# 3069	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 3072	[c=4 l=3]  *movdi_internal/3
+	movzbl	(%rax,%r15), %eax	# 3065	[c=13 l=5]  *zero_extendqisi2/0
+	leaq	.LC28(%rip), %rsi	# 3070	[c=1 l=7]  *movdi_internal/4
+	orl	%eax, %r14d	# 3066	[c=4 l=3]  *iorsi_1/0
+	movzbl	%r14b, %ecx	# 3067	[c=4 l=4]  *zero_extendqisi2/0
+	call	log_add_data_mov@PLT	# 3073	[c=0 l=5]  *call
+	movl	$63, %eax	# 3074	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 3075	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 3076	[c=13 l=7]  *cmpsi_1/1
+	jb	.L428	# 3077	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%r13)	# 3079	[c=13 l=8]  *cmpqi_ccno_1/1
+	jne	.L429	# 3080	[c=13 l=6]  *jcc
+.L428:
+	movq	1040(%r13), %rax	# 3083	[c=9 l=7]  *movdi_internal/3
+	movb	%r14b, 63(%rax)	# 3084	[c=4 l=4]  *movqi_internal/8
+.L430:
+	movq	%r13, %rdi	# 3096	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 3095	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 3097	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 16879	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 16880	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 3099	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18324	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 3100	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 3102	[c=4 l=3]  *cmpdi_1/0
+	jb	.L283	# 3103	[c=13 l=6]  *jcc
+	movl	0(%r13), %ebx	# 3105	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 3110	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 3106	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 3108	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 3109	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 3111	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 3112	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 3113	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 3116	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 16881	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 3117	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 3120	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 3121	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 19534	[c=10 l=4]  *indirect_jump
+.L431:
+	movzbl	10(%rbx), %r8d	# 3130	[c=13 l=5]  zero_extendqidi2/0
+	xorl	%eax, %eax	# 19533	[c=4 l=2]  *movdi_xor
+	movq	%r13, %rdi	# 3137	[c=4 l=3]  *movdi_internal/3
+	movzwl	12(%rbx), %r14d	# 3129	[c=13 l=5]  *zero_extendhisi2/0
+	leaq	.LC43(%rip), %rsi	# 3135	[c=1 l=7]  *movdi_internal/4
+	movzbl	1004(%r13,%r8), %ecx	# 3132	[c=14 l=9]  *zero_extendqisi2/0
+	movq	%r8, %r15	# 18550	[c=4 l=3]  *movdi_internal/3
+	movl	%r8d, %edx	# 3134	[c=4 l=3]  *movsi_internal/0
+	movq	%r8, 8(%rsp)	# 17775	[c=4 l=5]  *movdi_internal/5
+	call	log_append@PLT	# 3139	[c=0 l=5]  *call
+	cmpl	$15, %r15d	# 3142	[c=4 l=4]  *cmpsi_1/0
+	movq	8(%rsp), %r8	# 17776	[c=9 l=5]  *movdi_internal/3
+	leaq	.LC43(%rip), %rsi	# 17774	[c=1 l=7]  *movdi_internal/4
+	jle	.L1417	# 3143	[c=13 l=6]  *jcc
+	movzbl	1004(%r13,%r8), %eax	# 3156	[c=14 l=9]  *zero_extendqisi2/0
+	movslq	%r14d, %r9	# 3158	[c=4 l=3]  *extendsidi2_rex64/1
+	movl	%r14d, %edx	# 3161	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 3164	[c=4 l=3]  *movdi_internal/3
+	movzbl	1004(%r13,%r9), %ecx	# 3159	[c=14 l=9]  *zero_extendqisi2/0
+	movq	%r9, 16(%rsp)	# 17777	[c=4 l=5]  *movdi_internal/5
+	movl	%eax, 8(%rsp)	# 16883	[c=4 l=4]  *movsi_internal/1
+	movl	%eax, %r15d	# 18551	[c=4 l=3]  *movsi_internal/0
+	xorl	%eax, %eax	# 19531	[c=4 l=2]  *movdi_xor
+	call	log_append@PLT	# 3166	[c=0 l=5]  *call
+	cmpl	$15, %r14d	# 3169	[c=4 l=4]  *cmpsi_1/0
+	movq	16(%rsp), %r9	# 17778	[c=9 l=5]  *movdi_internal/3
+	jle	.L1418	# 3170	[c=13 l=6]  *jcc
+	movzbl	1004(%r13,%r9), %edi	# 3183	[c=14 l=9]  *zero_extendqisi2/0
+	movq	1040(%r13), %rdx	# 3184	[c=9 l=7]  *movdi_internal/3
+	movl	%r15d, %ecx	# 16884	[c=4 l=3]  *movsi_internal/0
+	andl	$136, %ecx	# 3187	[c=4 l=6]  *andsi_1/0
+	movl	8(%rsp), %eax	# 16888	[c=9 l=4]  *movsi_internal/0
+	movl	%edi, %esi	# 16886	[c=4 l=2]  *movsi_internal/0
+	movzbl	63(%rdx), %edx	# 3185	[c=9 l=4]  *movqi_internal/4
+	andl	$136, %esi	# 3190	[c=4 l=6]  *andsi_1/0
+	subl	%edi, %eax	# 3195	[c=4 l=2]  *subsi_1/0
+	leal	(%rsi,%rcx,2), %esi	# 3191	[c=8 l=3]  *leasi
+	movl	%edx, %edi	# 16890	[c=4 l=2]  *movsi_internal/0
+	movzbl	%dl, %ecx	# 3192	[c=4 l=3]  *zero_extendqisi2/0
+	orl	$-3, %edx	# 3205	[c=4 l=3]  *iorsi_1/0
+	imull	$260, %esi, %esi	# 3200	[c=12 l=6]  *mulsi3_1/1
+	andl	$1, %edi	# 3197	[c=4 l=3]  *andsi_1/0
+	subl	%edi, %eax	# 3198	[c=4 l=2]  *subsi_1/0
+	andl	$511, %eax	# 3199	[c=4 l=5]  *andsi_1/0
+	andl	$7680, %esi	# 3201	[c=4 l=6]  *andsi_1/0
+	orl	%esi, %eax	# 3202	[c=5 l=2]  *iorsi_1_zext
+	leaq	flag_update_table_sub8(%rip), %rsi	# 16546	[c=1 l=7]  *movdi_internal/4
+	movzbl	(%rsi,%rax), %r14d	# 3204	[c=13 l=5]  *zero_extendqisi2/0
+	movl	$63, %eax	# 3207	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 3208	[c=13 l=7]  *subsi_1/1
+	andl	%edx, %r14d	# 3206	[c=4 l=3]  *andsi_1/0
+	cmpl	5180(%r13), %eax	# 3209	[c=13 l=7]  *cmpsi_1/1
+	jb	.L434	# 3210	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%r13)	# 3212	[c=13 l=8]  *cmpqi_ccno_1/1
+	jne	.L1419	# 3213	[c=13 l=6]  *jcc
+.L434:
+	movl	$63, %edx	# 3222	[c=4 l=5]  *movsi_internal/0
+	leaq	.LC32(%rip), %rsi	# 3223	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 3225	[c=4 l=3]  *movdi_internal/3
+	movl	%ecx, 8(%rsp)	# 17779	[c=4 l=4]  *movsi_internal/1
+	call	log_add_data_mov@PLT	# 3226	[c=0 l=5]  *call
+	movl	8(%rsp), %ecx	# 17780	[c=9 l=4]  *movsi_internal/0
+	movl	$63, %edx	# 3231	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 3234	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC28(%rip), %rsi	# 3232	[c=1 l=7]  *movdi_internal/4
+	andl	$-64, %ecx	# 3227	[c=4 l=3]  *andsi_1/0
+	orl	%ecx, %r14d	# 3228	[c=4 l=3]  *iorsi_1/0
+	movzbl	%r14b, %ecx	# 3229	[c=4 l=4]  *zero_extendqisi2/0
+	call	log_add_data_mov@PLT	# 3235	[c=0 l=5]  *call
+	movl	$63, %eax	# 3236	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 3237	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 3238	[c=13 l=7]  *cmpsi_1/1
+	jb	.L435	# 3239	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%r13)	# 3241	[c=13 l=8]  *cmpqi_ccno_1/1
+	jne	.L436	# 3242	[c=13 l=6]  *jcc
+.L435:
+	movq	1040(%r13), %rax	# 3245	[c=9 l=7]  *movdi_internal/3
+	movb	%r14b, 63(%rax)	# 3246	[c=4 l=4]  *movqi_internal/8
+.L437:
+	movq	%r13, %rdi	# 3258	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 3257	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 3259	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 16892	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 16893	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 3261	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18323	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 3262	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 3264	[c=4 l=3]  *cmpdi_1/0
+	jb	.L283	# 3265	[c=13 l=6]  *jcc
+	movl	0(%r13), %ebx	# 3267	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 3272	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 3268	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 3270	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 3271	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 3273	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 3274	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 3275	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 3278	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 16894	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 3279	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 3282	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 3283	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 19529	[c=10 l=4]  *indirect_jump
+.L438:
+	movzwl	12(%rbx), %r15d	# 3291	[c=13 l=5]  *zero_extendhisi2/0
+	movzbl	10(%rbx), %r14d	# 3293	[c=13 l=5]  *zero_extendqisi2/0
+	xorl	%eax, %eax	# 19527	[c=4 l=2]  *movdi_xor
+	movq	%r13, %rdi	# 3297	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC62(%rip), %rsi	# 3295	[c=1 l=7]  *movdi_internal/4
+	movl	%r15d, %edx	# 3294	[c=4 l=3]  *movsi_internal/0
+	movl	%r15d, 16(%rsp)	# 17783	[c=4 l=5]  *movsi_internal/1
+	call	log_append@PLT	# 3299	[c=0 l=5]  *call
+	movslq	%r14d, %r9	# 3300	[c=4 l=3]  *extendsidi2_rex64/1
+	xorl	%eax, %eax	# 19528	[c=4 l=2]  *movdi_xor
+	movl	%r14d, %edx	# 3303	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC43(%rip), %rsi	# 3304	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 3306	[c=4 l=3]  *movdi_internal/3
+	movq	%r9, 8(%rsp)	# 17781	[c=4 l=5]  *movdi_internal/5
+	movzbl	1004(%r13,%r9), %ecx	# 3301	[c=14 l=9]  *zero_extendqisi2/0
+	call	log_append@PLT	# 3308	[c=0 l=5]  *call
+	cmpl	$15, %r14d	# 3311	[c=4 l=4]  *cmpsi_1/0
+	movq	8(%rsp), %r9	# 17782	[c=9 l=5]  *movdi_internal/3
+	movl	16(%rsp), %r8d	# 17784	[c=9 l=5]  *movsi_internal/0
+	jle	.L1420	# 3312	[c=13 l=6]  *jcc
+	movzbl	1004(%r13,%r9), %r14d	# 3325	[c=14 l=9]  *zero_extendqisi2/0
+	andl	$136, %r8d	# 3330	[c=4 l=7]  *andsi_1/0
+	movl	%r14d, %edx	# 19525	[c=4 l=3]  *movsi_internal/0
+	subl	%r15d, %r14d	# 3333	[c=4 l=3]  *subsi_1/0
+	andl	$136, %edx	# 3327	[c=4 l=6]  *andsi_1/0
+	andl	$511, %r14d	# 3334	[c=4 l=7]  *andsi_1/0
+	leal	(%r8,%rdx,2), %edx	# 3331	[c=8 l=4]  *leasi
+	imull	$260, %edx, %eax	# 3335	[c=12 l=6]  *mulsi3_1/1
+	andl	$7680, %eax	# 3336	[c=4 l=5]  *andsi_1/0
+	orl	%eax, %r14d	# 3337	[c=5 l=3]  *iorsi_1_zext
+	movl	$63, %eax	# 3338	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 3339	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 3340	[c=13 l=7]  *cmpsi_1/1
+	jb	.L440	# 3341	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%r13)	# 3343	[c=13 l=8]  *cmpqi_ccno_1/1
+	jne	.L441	# 3344	[c=13 l=6]  *jcc
+.L440:
+	movq	1040(%r13), %rax	# 3347	[c=9 l=7]  *movdi_internal/3
+	movzbl	63(%rax), %r15d	# 3348	[c=13 l=5]  *zero_extendqisi2/0
+.L442:
+	movl	%r15d, %ecx	# 3359	[c=4 l=3]  *movsi_internal/0
+	movl	$63, %edx	# 3360	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 3363	[c=4 l=3]  *movdi_internal/3
+	andl	$-64, %r15d	# 3365	[c=4 l=4]  *andsi_1/0
+	leaq	.LC32(%rip), %rsi	# 3361	[c=1 l=7]  *movdi_internal/4
+	call	log_add_data_mov@PLT	# 3364	[c=0 l=5]  *call
+	leaq	flag_update_table_sub8(%rip), %rax	# 16547	[c=1 l=7]  *movdi_internal/4
+	movl	$63, %edx	# 3372	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 3375	[c=4 l=3]  *movdi_internal/3
+	movzbl	(%rax,%r14), %eax	# 3368	[c=13 l=5]  *zero_extendqisi2/0
+	leaq	.LC28(%rip), %rsi	# 3373	[c=1 l=7]  *movdi_internal/4
+	orl	%eax, %r15d	# 3369	[c=4 l=3]  *iorsi_1/0
+	movzbl	%r15b, %ecx	# 3370	[c=4 l=4]  *zero_extendqisi2/0
+	call	log_add_data_mov@PLT	# 3376	[c=0 l=5]  *call
+	movl	$63, %eax	# 3377	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 3378	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 3379	[c=13 l=7]  *cmpsi_1/1
+	jb	.L443	# 3380	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%r13)	# 3382	[c=13 l=8]  *cmpqi_ccno_1/1
+	jne	.L444	# 3383	[c=13 l=6]  *jcc
+.L443:
+	movq	1040(%r13), %rax	# 3386	[c=9 l=7]  *movdi_internal/3
+	movb	%r15b, 63(%rax)	# 3387	[c=4 l=4]  *movqi_internal/8
+.L445:
+	movq	%r13, %rdi	# 3399	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 3398	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 3400	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 16898	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 16899	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 3402	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18322	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 3403	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 3405	[c=4 l=3]  *cmpdi_1/0
+	jb	.L283	# 3406	[c=13 l=6]  *jcc
+	movl	0(%r13), %ebx	# 3408	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 3413	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 3409	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 3411	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 3412	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 3414	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 3415	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 3416	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 3419	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 16900	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 3420	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 3423	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 3424	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 19524	[c=10 l=4]  *indirect_jump
+.L446:
+	movzbl	10(%rbx), %r8d	# 3433	[c=13 l=5]  zero_extendqidi2/0
+	xorl	%eax, %eax	# 19523	[c=4 l=2]  *movdi_xor
+	movq	%r13, %rdi	# 3440	[c=4 l=3]  *movdi_internal/3
+	movzwl	12(%rbx), %r14d	# 3432	[c=13 l=5]  *zero_extendhisi2/0
+	leaq	.LC43(%rip), %rsi	# 3438	[c=1 l=7]  *movdi_internal/4
+	movzbl	1004(%r13,%r8), %ecx	# 3435	[c=14 l=9]  *zero_extendqisi2/0
+	movq	%r8, %r15	# 18555	[c=4 l=3]  *movdi_internal/3
+	movl	%r8d, %edx	# 3437	[c=4 l=3]  *movsi_internal/0
+	movq	%r8, 8(%rsp)	# 17787	[c=4 l=5]  *movdi_internal/5
+	call	log_append@PLT	# 3442	[c=0 l=5]  *call
+	cmpl	$15, %r15d	# 3445	[c=4 l=4]  *cmpsi_1/0
+	movq	8(%rsp), %r8	# 17788	[c=9 l=5]  *movdi_internal/3
+	leaq	.LC43(%rip), %rsi	# 17786	[c=1 l=7]  *movdi_internal/4
+	jle	.L1421	# 3446	[c=13 l=6]  *jcc
+	movslq	%r14d, %r15	# 3460	[c=4 l=3]  *extendsidi2_rex64/1
+	xorl	%eax, %eax	# 19521	[c=4 l=2]  *movdi_xor
+	movl	%r14d, %edx	# 3463	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 3466	[c=4 l=3]  *movdi_internal/3
+	movzbl	1004(%r13,%r8), %r8d	# 3459	[c=10 l=9]  *movqi_internal/4
+	movzbl	1004(%r13,%r15), %ecx	# 3461	[c=14 l=9]  *zero_extendqisi2/0
+	movb	%r8b, 8(%rsp)	# 17789	[c=4 l=5]  *movqi_internal/8
+	call	log_append@PLT	# 3468	[c=0 l=5]  *call
+	cmpl	$15, %r14d	# 3471	[c=4 l=4]  *cmpsi_1/0
+	movzbl	8(%rsp), %r8d	# 17790	[c=9 l=6]  *movqi_internal/4
+	jle	.L1422	# 3472	[c=13 l=6]  *jcc
+	cmpb	1004(%r13,%r15), %r8b	# 3485	[c=14 l=8]  *cmpqi_1/1
+	je	.L1423	# 3486	[c=13 l=6]  *jcc
+.L449:
+	movq	%r13, %rdi	# 3498	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 3497	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 3499	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 16903	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 16904	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 3501	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18321	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 3502	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 3504	[c=4 l=3]  *cmpdi_1/0
+	jb	.L283	# 3505	[c=13 l=6]  *jcc
+	movq	56(%r13), %rax	# 16905	[c=9 l=4]  *movdi_internal/3
+	cmpq	%rax, 48(%r13)	# 3508	[c=13 l=4]  *cmpdi_1/0
+	jnb	.L1424	# 3509	[c=13 l=6]  *jcc
+.L450:
+	movq	%r13, %rdi	# 3515	[c=4 l=3]  *movdi_internal/3
+	call	log_is_idle@PLT	# 3516	[c=10 l=5]  *call_value
+	testb	%al, %al	# 3518	[c=4 l=2]  *cmpqi_ccno_1/0
+	jne	.L1425	# 3519	[c=13 l=6]  *jcc
+.L451:
+	movl	0(%r13), %ebx	# 3530	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 3535	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 3531	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 3533	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 3534	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 3536	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 3537	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 3538	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 3541	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 16906	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 3542	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 3545	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 3546	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 19519	[c=10 l=4]  *indirect_jump
+.L452:
+	movzbl	10(%rbx), %r8d	# 3555	[c=13 l=5]  zero_extendqidi2/0
+	xorl	%eax, %eax	# 19518	[c=4 l=2]  *movdi_xor
+	movq	%r13, %rdi	# 3562	[c=4 l=3]  *movdi_internal/3
+	movzwl	12(%rbx), %r14d	# 3554	[c=13 l=5]  *zero_extendhisi2/0
+	leaq	.LC43(%rip), %rsi	# 3560	[c=1 l=7]  *movdi_internal/4
+	movzbl	1004(%r13,%r8), %ecx	# 3557	[c=14 l=9]  *zero_extendqisi2/0
+	movq	%r8, %r15	# 18556	[c=4 l=3]  *movdi_internal/3
+	movl	%r8d, %edx	# 3559	[c=4 l=3]  *movsi_internal/0
+	movq	%r8, 8(%rsp)	# 17793	[c=4 l=5]  *movdi_internal/5
+	call	log_append@PLT	# 3564	[c=0 l=5]  *call
+	cmpl	$15, %r15d	# 3567	[c=4 l=4]  *cmpsi_1/0
+	movq	8(%rsp), %r8	# 17794	[c=9 l=5]  *movdi_internal/3
+	leaq	.LC43(%rip), %rsi	# 17792	[c=1 l=7]  *movdi_internal/4
+	jle	.L1426	# 3568	[c=13 l=6]  *jcc
+	movslq	%r14d, %r15	# 3582	[c=4 l=3]  *extendsidi2_rex64/1
+	xorl	%eax, %eax	# 19516	[c=4 l=2]  *movdi_xor
+	movl	%r14d, %edx	# 3585	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 3588	[c=4 l=3]  *movdi_internal/3
+	movzbl	1004(%r13,%r8), %r8d	# 3581	[c=10 l=9]  *movqi_internal/4
+	movzbl	1004(%r13,%r15), %ecx	# 3583	[c=14 l=9]  *zero_extendqisi2/0
+	movb	%r8b, 8(%rsp)	# 17795	[c=4 l=5]  *movqi_internal/8
+	call	log_append@PLT	# 3590	[c=0 l=5]  *call
+	cmpl	$15, %r14d	# 3593	[c=4 l=4]  *cmpsi_1/0
+	movzbl	8(%rsp), %r8d	# 17796	[c=9 l=6]  *movqi_internal/4
+	jle	.L1427	# 3594	[c=13 l=6]  *jcc
+	cmpb	1004(%r13,%r15), %r8b	# 3607	[c=14 l=8]  *cmpqi_1/1
+	je	.L1428	# 3608	[c=13 l=6]  *jcc
+.L455:
+	movq	%r13, %rdi	# 3620	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 3619	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 3621	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 16909	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 16910	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 3623	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18320	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 3624	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 3626	[c=4 l=3]  *cmpdi_1/0
+	jb	.L283	# 3627	[c=13 l=6]  *jcc
+	movq	56(%r13), %rax	# 16911	[c=9 l=4]  *movdi_internal/3
+	cmpq	%rax, 48(%r13)	# 3630	[c=13 l=4]  *cmpdi_1/0
+	jnb	.L1429	# 3631	[c=13 l=6]  *jcc
+.L456:
+	movq	%r13, %rdi	# 3637	[c=4 l=3]  *movdi_internal/3
+	call	log_is_idle@PLT	# 3638	[c=10 l=5]  *call_value
+	testb	%al, %al	# 3640	[c=4 l=2]  *cmpqi_ccno_1/0
+	jne	.L1430	# 3641	[c=13 l=6]  *jcc
+.L457:
+	movl	0(%r13), %ebx	# 3652	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 3657	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 3653	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 3655	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 3656	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 3658	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 3659	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 3660	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 3663	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 16912	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 3664	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 3667	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 3668	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 19514	[c=10 l=4]  *indirect_jump
+.L458:
+	movzbl	10(%rbx), %r14d	# 3676	[c=13 l=5]  zero_extendqidi2/0
+	leaq	.LC43(%rip), %rsi	# 3681	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 3683	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 19513	[c=4 l=2]  *movdi_xor
+	movzbl	1004(%r13,%r14), %ecx	# 3678	[c=14 l=9]  *zero_extendqisi2/0
+	movq	%r14, %rdx	# 18557	[c=4 l=3]  *movdi_internal/3
+	movl	%r14d, 8(%rsp)	# 17797	[c=4 l=5]  *movsi_internal/1
+	call	log_append@PLT	# 3685	[c=0 l=5]  *call
+	movl	8(%rsp), %edx	# 17798	[c=9 l=4]  *movsi_internal/0
+	cmpl	$15, %edx	# 3688	[c=4 l=3]  *cmpsi_1/0
+	jle	.L1431	# 3689	[c=13 l=6]  *jcc
+	movzbl	1004(%r13,%r14), %eax	# 3702	[c=10 l=9]  *movqi_internal/4
+	leaq	.LC61(%rip), %rsi	# 3710	[c=1 l=7]  *movdi_internal/4
+	leal	-1(%rax), %r15d	# 18319	[c=4 l=4]  *leasi
+	xorl	%eax, %eax	# 19511	[c=4 l=2]  *movdi_xor
+	movzbl	%r15b, %edi	# 3705	[c=4 l=4]  *zero_extendqisi2/0
+	movl	%edi, 8(%rsp)	# 16914	[c=4 l=4]  *movsi_internal/1
+	movl	%edi, %ecx	# 3707	[c=4 l=2]  *movsi_internal/0
+	movq	%r13, %rdi	# 3712	[c=4 l=3]  *movdi_internal/3
+	call	log_append@PLT	# 3714	[c=0 l=5]  *call
+	movb	%r15b, 1004(%r13,%r14)	# 3716	[c=4 l=8]  *movqi_internal/8
+	movl	$63, %eax	# 3717	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 3718	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 3719	[c=13 l=7]  *cmpsi_1/1
+	jb	.L460	# 3720	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%r13)	# 3722	[c=13 l=8]  *cmpqi_ccno_1/1
+	jne	.L461	# 3723	[c=13 l=6]  *jcc
+.L460:
+	movq	1040(%r13), %rax	# 3726	[c=9 l=7]  *movdi_internal/3
+	movzbl	63(%rax), %r14d	# 3727	[c=13 l=5]  *zero_extendqisi2/0
+.L462:
+	movl	%r14d, %ecx	# 3738	[c=4 l=3]  *movsi_internal/0
+	movl	$63, %edx	# 3739	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 3742	[c=4 l=3]  *movdi_internal/3
+	andl	$-31, %r14d	# 3744	[c=4 l=4]  *andsi_1/0
+	leaq	.LC32(%rip), %rsi	# 3740	[c=1 l=7]  *movdi_internal/4
+	call	log_add_data_mov@PLT	# 3743	[c=0 l=5]  *call
+	movslq	8(%rsp), %r15	# 3746	[c=13 l=5]  *extendsidi2_rex64/1
+	movq	%r13, %rdi	# 3754	[c=4 l=3]  *movdi_internal/3
+	leaq	flag_update_table_dec(%rip), %rax	# 16548	[c=1 l=7]  *movdi_internal/4
+	movl	$63, %edx	# 3751	[c=4 l=5]  *movsi_internal/0
+	leaq	.LC28(%rip), %rsi	# 3752	[c=1 l=7]  *movdi_internal/4
+	movzbl	(%rax,%r15), %eax	# 3747	[c=13 l=5]  *zero_extendqisi2/0
+	orl	%eax, %r14d	# 3748	[c=4 l=3]  *iorsi_1/0
+	movzbl	%r14b, %ecx	# 3749	[c=4 l=4]  *zero_extendqisi2/0
+	call	log_add_data_mov@PLT	# 3755	[c=0 l=5]  *call
+	movl	$63, %eax	# 3756	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 3757	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 3758	[c=13 l=7]  *cmpsi_1/1
+	jb	.L463	# 3759	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%r13)	# 3761	[c=13 l=8]  *cmpqi_ccno_1/1
+	jne	.L464	# 3762	[c=13 l=6]  *jcc
+.L463:
+	movq	1040(%r13), %rax	# 3765	[c=9 l=7]  *movdi_internal/3
+	movb	%r14b, 63(%rax)	# 3766	[c=4 l=4]  *movqi_internal/8
+.L465:
+	movq	%r13, %rdi	# 3778	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 3777	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 3779	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 16916	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 16917	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 3781	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18318	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 3782	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 3784	[c=4 l=3]  *cmpdi_1/0
+	jb	.L283	# 3785	[c=13 l=6]  *jcc
+	movl	0(%r13), %ebx	# 3787	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 3792	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 3788	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 3790	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 3791	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 3793	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 3794	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 3795	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 3798	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 16918	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 3799	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 3802	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 3803	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 19510	[c=10 l=4]  *indirect_jump
+.L466:
+	movl	0(%r13), %eax	# 16920	[c=5 l=4]  *movsi_internal/0
+	movq	1056(%r13), %rdx	# 3816	[c=9 l=7]  *movdi_internal/3
+	leaq	.LC34(%rip), %rsi	# 3819	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 3821	[c=4 l=3]  *movdi_internal/3
+	subl	$1, %eax	# 3812	[c=4 l=3]  *addsi_1/0
+	movl	%eax, 0(%r13)	# 3813	[c=4 l=4]  *movsi_internal/1
+	addl	%eax, %eax	# 3814	[c=5 l=2]  *ashlsi3_1_zext/0
+	movzwl	(%rdx,%rax), %ebx	# 3817	[c=13 l=4]  *zero_extendhisi2/0
+	xorl	%eax, %eax	# 19507	[c=4 l=2]  *movdi_xor
+	movl	%ebx, %edx	# 3818	[c=4 l=2]  *movsi_internal/0
+	call	log_append@PLT	# 3823	[c=0 l=5]  *call
+	movl	$1, 72(%r13)	# 3824	[c=4 l=8]  *movsi_internal/1
+	xorl	%esi, %esi	# 19508	[c=4 l=2]  *movdi_xor
+	movq	%r13, %rdi	# 3826	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 3827	[c=0 l=5]  *call
+	movl	%ebx, %ecx	# 3828	[c=4 l=2]  *movsi_internal/0
+	leaq	.LC37(%rip), %rdx	# 3829	[c=1 l=7]  *movdi_internal/4
+	xorl	%eax, %eax	# 19509	[c=4 l=2]  *movdi_xor
+	movl	$8, %esi	# 3831	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 3832	[c=4 l=3]  *movdi_internal/3
+	call	leave	# 3834	[c=0 l=5]  *call
+.L467:
+	cmpb	$0, 841(%r13)	# 3838	[c=13 l=8]  *cmpqi_ccno_1/1
+	je	.L1432	# 3839	[c=13 l=6]  *jcc
+	movl	5176(%r13), %edx	# 3866	[c=9 l=7]  *movsi_internal/0
+	movl	$61, %eax	# 3870	[c=4 l=5]  *movsi_internal/0
+	movl	5180(%r13), %r15d	# 3867	[c=9 l=7]  *movsi_internal/0
+	movl	$62, %r14d	# 3868	[c=4 l=6]  *movsi_internal/0
+	subl	%edx, %eax	# 3871	[c=4 l=2]  *subsi_1/0
+	subl	%edx, %r14d	# 3869	[c=4 l=3]  *subsi_1/0
+	cmpl	%r15d, %eax	# 3872	[c=4 l=3]  *cmpsi_1/0
+	jb	.L469	# 3873	[c=13 l=6]  *jcc
+	cmpb	$1, 1081(%r13)	# 3877	[c=13 l=8]  *cmpqi_1/0
+	ja	.L1433	# 3878	[c=13 l=6]  *jcc
+	movq	1040(%r13), %rax	# 14396	[c=9 l=7]  *movdi_internal/3
+	movzbl	61(%rax), %edx	# 14397	[c=13 l=4]  *zero_extendqisi2/0
+.L471:
+	movzbl	62(%rax), %r8d	# 3911	[c=13 l=5]  *zero_extendqisi2/0
+.L473:
+	sall	$8, %r8d	# 3914	[c=4 l=4]  *ashlsi3_1/0
+	leaq	.LC30(%rip), %rsi	# 3918	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 3920	[c=4 l=3]  *movdi_internal/3
+	orl	%edx, %r8d	# 3915	[c=4 l=3]  *iorsi_1/0
+	movl	$61, %edx	# 3917	[c=4 l=5]  *movsi_internal/0
+	movl	%r8d, %ecx	# 3916	[c=4 l=3]  *movsi_internal/0
+	movl	%r8d, %r15d	# 16923	[c=4 l=3]  *movsi_internal/0
+	call	log_add_data_mov@PLT	# 3921	[c=0 l=5]  *call
+	movl	996(%r13), %edx	# 3923	[c=9 l=7]  *movsi_internal/0
+	movzbl	840(%r13), %eax	# 3925	[c=13 l=8]  *zero_extendqisi2/0
+	leal	1(%rdx,%rax), %eax	# 3926	[c=5 l=4]  *leasi
+	cmpl	%eax, %r15d	# 3927	[c=4 l=3]  *cmpsi_1/0
+	jb	.L1434	# 3928	[c=13 l=6]  *jcc
+	cmpl	$63, %r15d	# 15149	[c=4 l=4]  *cmpsi_1/0
+	movl	0(%r13), %r14d	# 3936	[c=5 l=4]  *movsi_internal/0
+	leal	-1(%r15), %r9d	# 18317	[c=4 l=4]  *leasi
+	movl	%r15d, %edx	# 3945	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC29(%rip), %rax	# 16575	[c=1 l=7]  *movdi_internal/4
+	leaq	.LC28(%rip), %rsi	# 16574	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 3947	[c=4 l=3]  *movdi_internal/3
+	movl	%r9d, 8(%rsp)	# 17801	[c=4 l=5]  *movsi_internal/1
+	cmovne	%rax, %rsi	# 15150	[c=8 l=4]  *movdicc_noc/1
+	movzbl	%r14b, %ecx	# 3938	[c=4 l=4]  *zero_extendqisi2/0
+	call	log_add_data_mov@PLT	# 3948	[c=0 l=5]  *call
+	movl	%r15d, %eax	# 16924	[c=4 l=3]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 3949	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 3950	[c=13 l=7]  *cmpsi_1/1
+	movl	8(%rsp), %r9d	# 17802	[c=9 l=5]  *movsi_internal/0
+	jb	.L476	# 3951	[c=13 l=2]  *jcc
+	movl	%r15d, %eax	# 16926	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %eax	# 3953	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 16533	[c=5 l=5]  *andsi_1_zext
+	cmpb	$0, 1080(%r13,%rax)	# 3956	[c=14 l=9]  *cmpqi_ccno_1/1
+	jne	.L477	# 3957	[c=13 l=6]  *jcc
+.L476:
+	movq	1040(%r13), %rdx	# 3961	[c=9 l=7]  *movdi_internal/3
+	movslq	%r15d, %rax	# 3960	[c=4 l=3]  *extendsidi2_rex64/1
+	movb	%r14b, (%rdx,%rax)	# 3962	[c=4 l=4]  *movqi_internal/8
+.L478:
+	movl	0(%r13), %ecx	# 3973	[c=5 l=4]  *movsi_internal/0
+	movl	%r9d, %edx	# 3983	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 3985	[c=4 l=3]  *movdi_internal/3
+	movl	%r9d, 16(%rsp)	# 17805	[c=4 l=5]  *movsi_internal/1
+	leaq	.LC28(%rip), %rsi	# 16576	[c=1 l=7]  *movdi_internal/4
+	leal	-2(%r15), %r14d	# 18316	[c=4 l=4]  *leasi
+	movl	%ecx, %eax	# 16928	[c=4 l=2]  *movsi_internal/0
+	movzbl	%ch, %ecx	# 3976	[c=4 l=3]  *extzvsi
+	shrl	$8, %eax	# 3974	[c=4 l=3]  *lshrsi3_1/0
+	cmpl	$63, %r9d	# 15161	[c=4 l=4]  *cmpsi_1/0
+	movl	%eax, 8(%rsp)	# 16929	[c=4 l=4]  *movsi_internal/1
+	leaq	.LC29(%rip), %rax	# 16577	[c=1 l=7]  *movdi_internal/4
+	cmovne	%rax, %rsi	# 15162	[c=8 l=4]  *movdicc_noc/1
+	call	log_add_data_mov@PLT	# 3986	[c=0 l=5]  *call
+	movslq	16(%rsp), %r9	# 17806	[c=13 l=5]  *extendsidi2_rex64/1
+	movl	%r9d, %eax	# 16930	[c=4 l=3]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 3987	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 3988	[c=13 l=7]  *cmpsi_1/1
+	jb	.L480	# 3989	[c=13 l=2]  *jcc
+	movl	%r9d, %eax	# 16932	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %eax	# 3991	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 16532	[c=5 l=5]  *andsi_1_zext
+	cmpb	$0, 1080(%r13,%rax)	# 3994	[c=14 l=9]  *cmpqi_ccno_1/1
+	jne	.L481	# 3995	[c=13 l=6]  *jcc
+.L480:
+	movq	1040(%r13), %rax	# 3999	[c=9 l=7]  *movdi_internal/3
+	movzbl	8(%rsp), %edi	# 16934	[c=9 l=5]  *movqi_internal/4
+	movb	%dil, (%rax,%r9)	# 4000	[c=4 l=4]  *movqi_internal/8
+.L482:
+	cmpb	$0, 840(%r13)	# 4011	[c=13 l=8]  *cmpqi_ccno_1/1
+	je	.L483	# 4012	[c=13 l=2]  *jcc
+	movl	0(%r13), %eax	# 16935	[c=5 l=4]  *movsi_internal/0
+	subl	$3, %r15d	# 4016	[c=4 l=4]  *addsi_1/0
+	movq	%r13, %rdi	# 4026	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC29(%rip), %rdx	# 16579	[c=1 l=7]  *movdi_internal/4
+	leaq	.LC28(%rip), %rsi	# 16578	[c=1 l=7]  *movdi_internal/4
+	shrl	$16, %eax	# 4015	[c=4 l=3]  *lshrsi3_1/0
+	cmpl	$63, %r14d	# 15173	[c=4 l=4]  *cmpsi_1/0
+	cmovne	%rdx, %rsi	# 15174	[c=8 l=4]  *movdicc_noc/1
+	movzbl	%al, %ecx	# 4017	[c=4 l=3]  *zero_extendqisi2/0
+	movl	%r14d, %edx	# 4024	[c=4 l=3]  *movsi_internal/0
+	movl	%eax, 8(%rsp)	# 17807	[c=4 l=4]  *movsi_internal/1
+	call	log_add_data_mov@PLT	# 4027	[c=0 l=5]  *call
+	movl	%r14d, %edx	# 16937	[c=4 l=3]  *movsi_internal/0
+	subl	5176(%r13), %edx	# 4028	[c=13 l=7]  *subsi_1/1
+	movl	8(%rsp), %eax	# 17808	[c=9 l=4]  *movsi_internal/0
+	cmpl	5180(%r13), %edx	# 4029	[c=13 l=7]  *cmpsi_1/1
+	jb	.L485	# 4030	[c=13 l=2]  *jcc
+	movl	%r14d, %edx	# 16939	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %edx	# 4032	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %edx	# 16531	[c=5 l=6]  *andsi_1_zext
+	cmpb	$0, 1080(%r13,%rdx)	# 4035	[c=14 l=9]  *cmpqi_ccno_1/1
+	jne	.L486	# 4036	[c=13 l=6]  *jcc
+.L485:
+	movq	1040(%r13), %rdx	# 4040	[c=9 l=7]  *movdi_internal/3
+	movslq	%r14d, %r14	# 4039	[c=4 l=3]  *extendsidi2_rex64/1
+	movb	%al, (%rdx,%r14)	# 4041	[c=4 l=4]  *movqi_internal/8
+.L487:
+	movl	%r15d, %r14d	# 22	[c=4 l=3]  *movsi_internal/0
+.L483:
+	movzwl	%r14w, %r15d	# 4056	[c=4 l=4]  *zero_extendhisi2/0
+	movl	$61, %edx	# 4058	[c=4 l=5]  *movsi_internal/0
+	leaq	.LC31(%rip), %rsi	# 4059	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 4061	[c=4 l=3]  *movdi_internal/3
+	movl	%r15d, %ecx	# 4057	[c=4 l=3]  *movsi_internal/0
+	call	log_add_data_mov@PLT	# 4062	[c=0 l=5]  *call
+	movl	$61, %eax	# 4063	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 4064	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 4065	[c=13 l=7]  *cmpsi_1/1
+	jb	.L488	# 4066	[c=13 l=2]  *jcc
+	cmpb	$1, 1081(%r13)	# 4070	[c=13 l=8]  *cmpqi_1/0
+	ja	.L1435	# 4071	[c=13 l=6]  *jcc
+.L488:
+	movq	1040(%r13), %rax	# 4082	[c=9 l=7]  *movdi_internal/3
+	movb	%r14b, 61(%rax)	# 4083	[c=4 l=4]  *movqi_internal/8
+.L489:
+	movl	$62, %eax	# 4087	[c=4 l=5]  *movsi_internal/0
+	sarl	$8, %r15d	# 4086	[c=4 l=4]  *ashrsi3_1/0
+	subl	5176(%r13), %eax	# 4088	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 4089	[c=13 l=7]  *cmpsi_1/1
+	jb	.L490	# 4090	[c=13 l=2]  *jcc
+	cmpb	$1, 1081(%r13)	# 4094	[c=13 l=8]  *cmpqi_1/0
+	ja	.L1436	# 4095	[c=13 l=6]  *jcc
+.L490:
+	movq	1040(%r13), %rax	# 4105	[c=9 l=7]  *movdi_internal/3
+	movb	%r15b, 62(%rax)	# 4106	[c=4 l=4]  *movqi_internal/8
+.L491:
+	movzwl	1034(%r13), %r14d	# 4109	[c=13 l=8]  *zero_extendhisi2/0
+	xorl	%eax, %eax	# 19504	[c=4 l=2]  *movdi_xor
+	movl	$30, %edx	# 4111	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 4114	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC44(%rip), %rsi	# 4112	[c=1 l=7]  *movdi_internal/4
+	movl	%r14d, %ecx	# 4110	[c=4 l=3]  *movsi_internal/0
+	call	log_append@PLT	# 4116	[c=0 l=5]  *call
+	movl	$60, %eax	# 4117	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 4118	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 4119	[c=13 l=7]  *cmpsi_1/1
+	jb	.L492	# 4120	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%r13)	# 4122	[c=13 l=8]  *cmpqi_ccno_1/1
+	jne	.L493	# 4123	[c=13 l=6]  *jcc
+.L492:
+	movq	1040(%r13), %rax	# 4126	[c=9 l=7]  *movdi_internal/3
+	movzbl	60(%rax), %r15d	# 4127	[c=13 l=5]  *zero_extendqisi2/0
+.L494:
+	leaq	.LC33(%rip), %rsi	# 4140	[c=1 l=7]  *movdi_internal/4
+	movl	%r15d, %ecx	# 4138	[c=4 l=3]  *movsi_internal/0
+	movl	$60, %edx	# 4139	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 4142	[c=4 l=3]  *movdi_internal/3
+	call	log_add_data_mov@PLT	# 4143	[c=0 l=5]  *call
+	movl	%r15d, %esi	# 16941	[c=4 l=3]  *movsi_internal/0
+	sall	$16, %esi	# 4144	[c=4 l=3]  *ashlsi3_1/0
+	orl	%r14d, %esi	# 4145	[c=4 l=3]  *iorsi_1/0
+	movl	%esi, 0(%r13)	# 4146	[c=4 l=4]  *movsi_internal/1
+	cmpl	%esi, 992(%r13)	# 4147	[c=13 l=7]  *cmpsi_1/0
+	jb	.L1437	# 4148	[c=13 l=6]  *jcc
+	movq	%r13, %rdi	# 4157	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 4156	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 4158	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 16943	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 16944	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 4160	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18315	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 4161	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 4163	[c=4 l=3]  *cmpdi_1/0
+	jb	.L283	# 4164	[c=13 l=6]  *jcc
+	movq	56(%r13), %rax	# 16945	[c=9 l=4]  *movdi_internal/3
+	cmpq	%rax, 48(%r13)	# 4167	[c=13 l=4]  *cmpdi_1/0
+	jnb	.L1438	# 4168	[c=13 l=6]  *jcc
+.L496:
+	movq	%r13, %rdi	# 4174	[c=4 l=3]  *movdi_internal/3
+	call	log_is_idle@PLT	# 4175	[c=10 l=5]  *call_value
+	testb	%al, %al	# 4177	[c=4 l=2]  *cmpqi_ccno_1/0
+	jne	.L1439	# 4178	[c=13 l=6]  *jcc
+.L497:
+	movl	0(%r13), %ebx	# 4189	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 4194	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 4190	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 4192	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 4193	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 4195	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 4196	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 4197	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 4200	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 16946	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 4201	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 4204	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 4205	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 19503	[c=10 l=4]  *indirect_jump
+.L498:
+	cmpb	$0, 841(%r13)	# 4213	[c=13 l=8]  *cmpqi_ccno_1/1
+	je	.L1440	# 4214	[c=13 l=6]  *jcc
+	movzwl	1034(%r13), %r14d	# 4241	[c=13 l=8]  *zero_extendhisi2/0
+	xorl	%eax, %eax	# 19500	[c=4 l=2]  *movdi_xor
+	movl	$30, %edx	# 4243	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 4246	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC44(%rip), %rsi	# 4244	[c=1 l=7]  *movdi_internal/4
+	movl	%r14d, %ecx	# 4242	[c=4 l=3]  *movsi_internal/0
+	call	log_append@PLT	# 4248	[c=0 l=5]  *call
+	movl	$60, %eax	# 4249	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 4250	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 4251	[c=13 l=7]  *cmpsi_1/1
+	jb	.L500	# 4252	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%r13)	# 4254	[c=13 l=8]  *cmpqi_ccno_1/1
+	jne	.L501	# 4255	[c=13 l=6]  *jcc
+.L500:
+	movq	1040(%r13), %rax	# 4258	[c=9 l=7]  *movdi_internal/3
+	movzbl	60(%rax), %r15d	# 4259	[c=13 l=5]  *zero_extendqisi2/0
+.L502:
+	leaq	.LC33(%rip), %rsi	# 4272	[c=1 l=7]  *movdi_internal/4
+	movl	%r15d, %ecx	# 4270	[c=4 l=3]  *movsi_internal/0
+	movl	$60, %edx	# 4271	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 4274	[c=4 l=3]  *movdi_internal/3
+	call	log_add_data_mov@PLT	# 4275	[c=0 l=5]  *call
+	movl	%r15d, %esi	# 16949	[c=4 l=3]  *movsi_internal/0
+	sall	$16, %esi	# 4276	[c=4 l=3]  *ashlsi3_1/0
+	orl	%r14d, %esi	# 4277	[c=4 l=3]  *iorsi_1/0
+	movl	%esi, 0(%r13)	# 4278	[c=4 l=4]  *movsi_internal/1
+	cmpl	%esi, 992(%r13)	# 4279	[c=13 l=7]  *cmpsi_1/0
+	jb	.L1441	# 4280	[c=13 l=6]  *jcc
+	movq	%r13, %rdi	# 4289	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 4288	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 4290	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 16951	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 16952	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 4292	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18314	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 4293	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 4295	[c=4 l=3]  *cmpdi_1/0
+	jb	.L283	# 4296	[c=13 l=6]  *jcc
+	movq	56(%r13), %rax	# 16953	[c=9 l=4]  *movdi_internal/3
+	cmpq	%rax, 48(%r13)	# 4299	[c=13 l=4]  *cmpdi_1/0
+	jnb	.L1442	# 4300	[c=13 l=6]  *jcc
+.L504:
+	movq	%r13, %rdi	# 4306	[c=4 l=3]  *movdi_internal/3
+	call	log_is_idle@PLT	# 4307	[c=10 l=5]  *call_value
+	testb	%al, %al	# 4309	[c=4 l=2]  *cmpqi_ccno_1/0
+	jne	.L1443	# 4310	[c=13 l=6]  *jcc
+.L505:
+	movl	0(%r13), %ebx	# 4321	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 4326	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 4322	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 4324	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 4325	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 4327	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 4328	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 4329	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 4332	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 16954	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 4333	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 4336	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 4337	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 19499	[c=10 l=4]  *indirect_jump
+.L506:
+	movzwl	1034(%r13), %ebp	# 4345	[c=13 l=8]  *zero_extendhisi2/0
+	xorl	%eax, %eax	# 19498	[c=4 l=2]  *movdi_xor
+	movl	$30, %edx	# 4347	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 4350	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC44(%rip), %rsi	# 4348	[c=1 l=7]  *movdi_internal/4
+	movl	%ebp, %ecx	# 4346	[c=4 l=2]  *movsi_internal/0
+	call	log_append@PLT	# 4352	[c=0 l=5]  *call
+	movl	$59, %eax	# 4353	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 4354	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 4355	[c=13 l=7]  *cmpsi_1/1
+	jb	.L507	# 4356	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%r13)	# 4358	[c=13 l=8]  *cmpqi_ccno_1/1
+	jne	.L508	# 4359	[c=13 l=6]  *jcc
+.L507:
+	movq	1040(%r13), %rax	# 4362	[c=9 l=7]  *movdi_internal/3
+	movzbl	59(%rax), %ebx	# 4363	[c=13 l=4]  *zero_extendqisi2/0
+.L509:
+	movl	%ebx, %ecx	# 4374	[c=4 l=2]  *movsi_internal/0
+	movl	$59, %edx	# 4375	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 4378	[c=4 l=3]  *movdi_internal/3
+	sall	$16, %ebx	# 4383	[c=4 l=3]  *ashlsi3_1/0
+	leaq	.LC33(%rip), %rsi	# 4376	[c=1 l=7]  *movdi_internal/4
+	orl	%ebp, %ebx	# 4384	[c=4 l=2]  *iorsi_1/0
+	call	log_add_data_mov@PLT	# 4379	[c=0 l=5]  *call
+	movl	992(%r13), %eax	# 4380	[c=9 l=7]  *movsi_internal/0
+	movq	1056(%r13), %rdx	# 4387	[c=9 l=7]  *movdi_internal/3
+	movq	%r13, %rdi	# 4393	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC61(%rip), %rsi	# 4391	[c=1 l=7]  *movdi_internal/4
+	leal	1(%rax,%rax), %eax	# 4382	[c=8 l=4]  *leasi
+	andl	%ebx, %eax	# 4385	[c=4 l=2]  *andsi_1/0
+	cltq	# 4386	[c=4 l=2]  *extendsidi2_rex64/0
+	movzbl	(%rdx,%rax), %ecx	# 4388	[c=13 l=4]  *zero_extendqisi2/0
+	xorl	%edx, %edx	# 19494	[c=4 l=2]  *movdi_xor
+	xorl	%eax, %eax	# 19495	[c=4 l=2]  *movdi_xor
+	call	log_append@PLT	# 4395	[c=0 l=5]  *call
+	xorl	%ecx, %ecx	# 19496	[c=4 l=2]  *movdi_xor
+	leaq	.LC60(%rip), %rdx	# 4397	[c=1 l=7]  *movdi_internal/4
+	xorl	%eax, %eax	# 19497	[c=4 l=2]  *movdi_xor
+	movl	$1, %esi	# 4399	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 4400	[c=4 l=3]  *movdi_internal/3
+	call	leave	# 4402	[c=0 l=5]  *call
+.L510:
+	xorl	%eax, %eax	# 19493	[c=4 l=2]  *movdi_xor
+	movl	$30, %edx	# 4409	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 4412	[c=4 l=3]  *movdi_internal/3
+	movzbl	10(%rbx), %r14d	# 4406	[c=13 l=5]  zero_extendqidi2/0
+	movzwl	1034(%r13), %r15d	# 4407	[c=13 l=8]  *zero_extendhisi2/0
+	leaq	.LC44(%rip), %rsi	# 4410	[c=1 l=7]  *movdi_internal/4
+	movl	%r15d, %ecx	# 4408	[c=4 l=3]  *movsi_internal/0
+	call	log_append@PLT	# 4414	[c=0 l=5]  *call
+	movl	$59, %eax	# 4415	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 4416	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 4417	[c=13 l=7]  *cmpsi_1/1
+	jb	.L511	# 4418	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%r13)	# 4420	[c=13 l=8]  *cmpqi_ccno_1/1
+	jne	.L512	# 4421	[c=13 l=6]  *jcc
+.L511:
+	movq	1040(%r13), %rax	# 4424	[c=9 l=7]  *movdi_internal/3
+	movzbl	59(%rax), %eax	# 4425	[c=13 l=4]  *zero_extendqisi2/0
+.L513:
+	movl	%eax, %ecx	# 4436	[c=4 l=2]  *movsi_internal/0
+	movl	$59, %edx	# 4437	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 4440	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, 8(%rsp)	# 17809	[c=4 l=4]  *movsi_internal/1
+	leaq	.LC33(%rip), %rsi	# 4438	[c=1 l=7]  *movdi_internal/4
+	call	log_add_data_mov@PLT	# 4441	[c=0 l=5]  *call
+	movl	8(%rsp), %eax	# 17810	[c=9 l=4]  *movsi_internal/0
+	movl	992(%r13), %edx	# 4442	[c=9 l=7]  *movsi_internal/0
+	movq	%r13, %rdi	# 4456	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC61(%rip), %rsi	# 4454	[c=1 l=7]  *movdi_internal/4
+	sall	$16, %eax	# 4445	[c=4 l=3]  *ashlsi3_1/0
+	leal	1(%rdx,%rdx), %edx	# 4444	[c=8 l=4]  *leasi
+	orl	%r15d, %eax	# 4446	[c=4 l=3]  *iorsi_1/0
+	andl	%edx, %eax	# 4447	[c=4 l=2]  *andsi_1/0
+	movq	1056(%r13), %rdx	# 4449	[c=9 l=7]  *movdi_internal/3
+	cltq	# 4448	[c=4 l=2]  *extendsidi2_rex64/0
+	movzbl	(%rdx,%rax), %ecx	# 4450	[c=13 l=4]  *zero_extendqisi2/0
+	xorl	%eax, %eax	# 19492	[c=4 l=2]  *movdi_xor
+	movl	%r14d, %edx	# 4453	[c=4 l=3]  *movsi_internal/0
+	movl	%ecx, %r15d	# 18558	[c=4 l=3]  *movsi_internal/0
+	call	log_append@PLT	# 4458	[c=0 l=5]  *call
+	cmpl	$15, %r14d	# 4461	[c=4 l=4]  *cmpsi_1/0
+	jle	.L1444	# 4462	[c=13 l=6]  *jcc
+	movb	%r15b, 1004(%r13,%r14)	# 4475	[c=4 l=8]  *movqi_internal/8
+	movq	%r13, %rdi	# 4477	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 4476	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 4478	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 16956	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 16957	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 4480	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18313	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 4481	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 4483	[c=4 l=3]  *cmpdi_1/0
+	jb	.L283	# 4484	[c=13 l=6]  *jcc
+	movl	0(%r13), %ebx	# 4486	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 4491	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 4487	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 4489	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 4490	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 4492	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 4493	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 4494	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 4497	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 16958	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 4498	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 4501	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 4502	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 19490	[c=10 l=4]  *indirect_jump
+.L515:
+	xorl	%eax, %eax	# 19489	[c=4 l=2]  *movdi_xor
+	movl	$30, %edx	# 4513	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 4516	[c=4 l=3]  *movdi_internal/3
+	movzbl	10(%rbx), %r14d	# 4510	[c=13 l=5]  zero_extendqidi2/0
+	movzwl	1034(%r13), %r15d	# 4511	[c=13 l=8]  *zero_extendhisi2/0
+	leaq	.LC44(%rip), %rsi	# 4514	[c=1 l=7]  *movdi_internal/4
+	movl	%r15d, %ecx	# 4512	[c=4 l=3]  *movsi_internal/0
+	call	log_append@PLT	# 4518	[c=0 l=5]  *call
+	movl	$59, %eax	# 4519	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 4520	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 4521	[c=13 l=7]  *cmpsi_1/1
+	jb	.L516	# 4522	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%r13)	# 4524	[c=13 l=8]  *cmpqi_ccno_1/1
+	jne	.L517	# 4525	[c=13 l=6]  *jcc
+.L516:
+	movq	1040(%r13), %rax	# 4528	[c=9 l=7]  *movdi_internal/3
+	movzbl	59(%rax), %eax	# 4529	[c=13 l=4]  *zero_extendqisi2/0
+.L518:
+	movl	%eax, %ecx	# 4540	[c=4 l=2]  *movsi_internal/0
+	movl	$59, %edx	# 4541	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 4544	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, 8(%rsp)	# 17813	[c=4 l=4]  *movsi_internal/1
+	leaq	.LC33(%rip), %rsi	# 4542	[c=1 l=7]  *movdi_internal/4
+	call	log_add_data_mov@PLT	# 4545	[c=0 l=5]  *call
+	movl	8(%rsp), %eax	# 17814	[c=9 l=4]  *movsi_internal/0
+	movq	1056(%r13), %rdx	# 4553	[c=9 l=7]  *movdi_internal/3
+	movq	%r13, %rdi	# 4560	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC61(%rip), %rsi	# 4558	[c=1 l=7]  *movdi_internal/4
+	sall	$16, %eax	# 4546	[c=4 l=3]  *ashlsi3_1/0
+	orl	%eax, %r15d	# 4547	[c=4 l=3]  *iorsi_1/0
+	movl	992(%r13), %eax	# 4548	[c=9 l=7]  *movsi_internal/0
+	leal	1(%rax,%rax), %eax	# 4550	[c=8 l=4]  *leasi
+	andl	%r15d, %eax	# 4551	[c=4 l=3]  *andsi_1/0
+	cltq	# 4552	[c=4 l=2]  *extendsidi2_rex64/0
+	movzbl	(%rdx,%rax), %ecx	# 4554	[c=13 l=4]  *zero_extendqisi2/0
+	xorl	%eax, %eax	# 19488	[c=4 l=2]  *movdi_xor
+	movl	%r14d, %edx	# 4557	[c=4 l=3]  *movsi_internal/0
+	movb	%cl, 8(%rsp)	# 17811	[c=4 l=4]  *movqi_internal/8
+	call	log_append@PLT	# 4562	[c=0 l=5]  *call
+	cmpl	$15, %r14d	# 4565	[c=4 l=4]  *cmpsi_1/0
+	movzbl	8(%rsp), %r8d	# 17812	[c=9 l=6]  *movqi_internal/4
+	jle	.L1445	# 4566	[c=13 l=6]  *jcc
+	movb	%r8b, 1004(%r13,%r14)	# 4579	[c=4 l=8]  *movqi_internal/8
+	leal	1(%r15), %r14d	# 18312	[c=4 l=4]  *leasi
+	xorl	%eax, %eax	# 19486	[c=4 l=2]  *movdi_xor
+	movq	%r13, %rdi	# 4586	[c=4 l=3]  *movdi_internal/3
+	movzwl	%r14w, %ecx	# 4581	[c=4 l=4]  *zero_extendhisi2/0
+	movl	$30, %edx	# 4583	[c=4 l=5]  *movsi_internal/0
+	leaq	.LC48(%rip), %rsi	# 4584	[c=1 l=7]  *movdi_internal/4
+	call	log_append@PLT	# 4588	[c=0 l=5]  *call
+	movw	%r14w, 1034(%r13)	# 4589	[c=4 l=8]  *movhi_internal/3
+	sarl	$16, %r14d	# 4590	[c=4 l=4]  *ashrsi3_1/0
+	movq	%r13, %rdi	# 4596	[c=4 l=3]  *movdi_internal/3
+	movzbl	%r14b, %ecx	# 4591	[c=4 l=4]  *zero_extendqisi2/0
+	movl	$59, %edx	# 4593	[c=4 l=5]  *movsi_internal/0
+	leaq	.LC29(%rip), %rsi	# 4594	[c=1 l=7]  *movdi_internal/4
+	call	log_add_data_mov@PLT	# 4597	[c=0 l=5]  *call
+	movl	$59, %eax	# 4598	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 4599	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 4600	[c=13 l=7]  *cmpsi_1/1
+	jb	.L520	# 4601	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%r13)	# 4603	[c=13 l=8]  *cmpqi_ccno_1/1
+	jne	.L521	# 4604	[c=13 l=6]  *jcc
+.L520:
+	movq	1040(%r13), %rax	# 4607	[c=9 l=7]  *movdi_internal/3
+	movb	%r14b, 59(%rax)	# 4608	[c=4 l=4]  *movqi_internal/8
+.L522:
+	movq	%r13, %rdi	# 4620	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 4619	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 4621	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 16960	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 16961	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 4623	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18311	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 4624	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 4626	[c=4 l=3]  *cmpdi_1/0
+	jb	.L283	# 4627	[c=13 l=6]  *jcc
+	movl	0(%r13), %ebx	# 4629	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 4634	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 4630	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 4632	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 4633	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 4635	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 4636	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 4637	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 4640	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 16962	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 4641	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 4644	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 4645	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 19485	[c=10 l=4]  *indirect_jump
+.L523:
+	movzbl	10(%rbx), %r15d	# 4654	[c=13 l=5]  zero_extendqidi2/0
+	xorl	%eax, %eax	# 19484	[c=4 l=2]  *movdi_xor
+	movq	%r13, %rdi	# 4661	[c=4 l=3]  *movdi_internal/3
+	movzwl	12(%rbx), %r14d	# 4653	[c=13 l=5]  *zero_extendhisi2/0
+	leaq	.LC43(%rip), %rsi	# 4659	[c=1 l=7]  *movdi_internal/4
+	movzbl	1004(%r13,%r15), %ecx	# 4656	[c=14 l=9]  *zero_extendqisi2/0
+	movl	%r15d, %edx	# 4658	[c=4 l=3]  *movsi_internal/0
+	movl	%r15d, 8(%rsp)	# 17817	[c=4 l=5]  *movsi_internal/1
+	call	log_append@PLT	# 4663	[c=0 l=5]  *call
+	movl	8(%rsp), %r9d	# 17818	[c=9 l=5]  *movsi_internal/0
+	leaq	.LC43(%rip), %rsi	# 17816	[c=1 l=7]  *movdi_internal/4
+	cmpl	$15, %r9d	# 4666	[c=4 l=4]  *cmpsi_1/0
+	jle	.L1446	# 4667	[c=13 l=6]  *jcc
+	movslq	%r14d, %r11	# 4681	[c=4 l=3]  *extendsidi2_rex64/1
+	xorl	%eax, %eax	# 19482	[c=4 l=2]  *movdi_xor
+	movl	%r14d, %edx	# 4684	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 4687	[c=4 l=3]  *movdi_internal/3
+	movzbl	1004(%r13,%r15), %r8d	# 4680	[c=10 l=9]  *movqi_internal/4
+	movl	%r9d, 24(%rsp)	# 17823	[c=4 l=5]  *movsi_internal/1
+	movzbl	1004(%r13,%r11), %ecx	# 4682	[c=14 l=9]  *zero_extendqisi2/0
+	movq	%r11, 8(%rsp)	# 17819	[c=4 l=5]  *movdi_internal/5
+	movb	%r8b, 16(%rsp)	# 17821	[c=4 l=5]  *movqi_internal/8
+	call	log_append@PLT	# 4689	[c=0 l=5]  *call
+	cmpl	$15, %r14d	# 4692	[c=4 l=4]  *cmpsi_1/0
+	movq	8(%rsp), %r11	# 17820	[c=9 l=5]  *movdi_internal/3
+	movzbl	16(%rsp), %r8d	# 17822	[c=9 l=6]  *movqi_internal/4
+	movl	24(%rsp), %r9d	# 17824	[c=9 l=5]  *movsi_internal/0
+	jle	.L1447	# 4693	[c=13 l=6]  *jcc
+	xorb	1004(%r13,%r11), %r8b	# 4706	[c=14 l=8]  *xorqi_1/1
+	xorl	%eax, %eax	# 19480	[c=4 l=2]  *movdi_xor
+	movl	%r9d, %edx	# 4709	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 4712	[c=4 l=3]  *movdi_internal/3
+	movzbl	%r8b, %r14d	# 4707	[c=4 l=4]  zero_extendqidi2/0
+	leaq	.LC61(%rip), %rsi	# 4710	[c=1 l=7]  *movdi_internal/4
+	movb	%r8b, 8(%rsp)	# 17825	[c=4 l=5]  *movqi_internal/8
+	movl	%r14d, %ecx	# 4708	[c=4 l=3]  *movsi_internal/0
+	call	log_append@PLT	# 4714	[c=0 l=5]  *call
+	movzbl	8(%rsp), %r8d	# 17826	[c=9 l=6]  *movqi_internal/4
+	movl	$63, %eax	# 4717	[c=4 l=5]  *movsi_internal/0
+	movb	%r8b, 1004(%r13,%r15)	# 4716	[c=4 l=8]  *movqi_internal/8
+	subl	5176(%r13), %eax	# 4718	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 4719	[c=13 l=7]  *cmpsi_1/1
+	jb	.L526	# 4720	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%r13)	# 4722	[c=13 l=8]  *cmpqi_ccno_1/1
+	jne	.L527	# 4723	[c=13 l=6]  *jcc
+.L526:
+	movq	1040(%r13), %rax	# 4726	[c=9 l=7]  *movdi_internal/3
+	movzbl	63(%rax), %r15d	# 4727	[c=13 l=5]  *zero_extendqisi2/0
+.L528:
+	movl	%r15d, %ecx	# 4738	[c=4 l=3]  *movsi_internal/0
+	movl	$63, %edx	# 4739	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 4742	[c=4 l=3]  *movdi_internal/3
+	andl	$-31, %r15d	# 4744	[c=4 l=4]  *andsi_1/0
+	leaq	.LC32(%rip), %rsi	# 4740	[c=1 l=7]  *movdi_internal/4
+	call	log_add_data_mov@PLT	# 4743	[c=0 l=5]  *call
+	leaq	flag_update_table_logical(%rip), %rax	# 16549	[c=1 l=7]  *movdi_internal/4
+	movl	$63, %edx	# 4751	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 4754	[c=4 l=3]  *movdi_internal/3
+	movzbl	(%rax,%r14), %eax	# 4747	[c=13 l=5]  *zero_extendqisi2/0
+	leaq	.LC28(%rip), %rsi	# 4752	[c=1 l=7]  *movdi_internal/4
+	orl	%eax, %r15d	# 4748	[c=4 l=3]  *iorsi_1/0
+	movzbl	%r15b, %ecx	# 4749	[c=4 l=4]  *zero_extendqisi2/0
+	call	log_add_data_mov@PLT	# 4755	[c=0 l=5]  *call
+	movl	$63, %eax	# 4756	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 4757	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 4758	[c=13 l=7]  *cmpsi_1/1
+	jb	.L529	# 4759	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%r13)	# 4761	[c=13 l=8]  *cmpqi_ccno_1/1
+	jne	.L530	# 4762	[c=13 l=6]  *jcc
+.L529:
+	movq	1040(%r13), %rax	# 4765	[c=9 l=7]  *movdi_internal/3
+	movb	%r15b, 63(%rax)	# 4766	[c=4 l=4]  *movqi_internal/8
+.L531:
+	movq	%r13, %rdi	# 4778	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 4777	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 4779	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 16964	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 16965	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 4781	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18310	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 4782	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 4784	[c=4 l=3]  *cmpdi_1/0
+	jb	.L283	# 4785	[c=13 l=6]  *jcc
+	movl	0(%r13), %ebx	# 4787	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 4792	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 4788	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 4790	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 4791	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 4793	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 4794	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 4795	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 4798	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 16966	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 4799	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 4802	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 4803	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 19479	[c=10 l=4]  *indirect_jump
+.L532:
+	movzwl	1034(%r13), %eax	# 4811	[c=13 l=8]  *zero_extendhisi2/0
+	movl	$30, %edx	# 4813	[c=4 l=5]  *movsi_internal/0
+	leaq	.LC44(%rip), %rsi	# 4814	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 4816	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, 8(%rsp)	# 17827	[c=4 l=4]  *movsi_internal/1
+	movl	%eax, %ecx	# 4812	[c=4 l=2]  *movsi_internal/0
+	xorl	%eax, %eax	# 19478	[c=4 l=2]  *movdi_xor
+	call	log_append@PLT	# 4818	[c=0 l=5]  *call
+	cmpl	$65536, 880(%r13)	# 4821	[c=13 l=11]  *cmpsi_1/0
+	jbe	.L533	# 4822	[c=13 l=2]  *jcc
+	movl	$59, %eax	# 4824	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 4825	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 4826	[c=13 l=7]  *cmpsi_1/1
+	jb	.L534	# 4827	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%r13)	# 4829	[c=13 l=8]  *cmpqi_ccno_1/1
+	jne	.L535	# 4830	[c=13 l=6]  *jcc
+.L534:
+	movq	1040(%r13), %rax	# 4833	[c=9 l=7]  *movdi_internal/3
+	movzbl	59(%rax), %r14d	# 4834	[c=13 l=5]  *zero_extendqisi2/0
+.L536:
+	movl	%r14d, %ecx	# 4845	[c=4 l=3]  *movsi_internal/0
+	movl	$59, %edx	# 4846	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 4849	[c=4 l=3]  *movdi_internal/3
+	sall	$16, %r14d	# 4851	[c=4 l=4]  *ashlsi3_1/0
+	leaq	.LC33(%rip), %rsi	# 4847	[c=1 l=7]  *movdi_internal/4
+	call	log_add_data_mov@PLT	# 4850	[c=0 l=5]  *call
+	orl	%r14d, 8(%rsp)	# 4852	[c=13 l=5]  *iorsi_1/0
+.L533:
+	movl	992(%r13), %eax	# 4856	[c=9 l=7]  *movsi_internal/0
+	movl	6048(%r13), %edx	# 4858	[c=9 l=7]  *movsi_internal/0
+	movl	6044(%r13), %r15d	# 4855	[c=9 l=7]  *movsi_internal/0
+	movl	%eax, 32(%rsp)	# 16971	[c=4 l=4]  *movsi_internal/1
+	movq	1056(%r13), %rax	# 4857	[c=9 l=7]  *movdi_internal/3
+	movq	%rax, 40(%rsp)	# 16972	[c=4 l=5]  *movdi_internal/5
+	movl	%edx, %eax	# 16973	[c=4 l=2]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 4859	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 4860	[c=13 l=7]  *cmpsi_1/1
+	jb	.L537	# 4861	[c=13 l=2]  *jcc
+	movl	%edx, %eax	# 16975	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %eax	# 4863	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 16530	[c=5 l=5]  *andsi_1_zext
+	cmpb	$0, 1080(%r13,%rax)	# 4866	[c=14 l=9]  *cmpqi_ccno_1/1
+	jne	.L538	# 4867	[c=13 l=6]  *jcc
+.L537:
+	movq	1040(%r13), %rcx	# 4871	[c=9 l=7]  *movdi_internal/3
+	movslq	%edx, %rax	# 4870	[c=4 l=3]  *extendsidi2_rex64/1
+	movzbl	(%rcx,%rax), %r14d	# 4872	[c=13 l=5]  *zero_extendqisi2/0
+.L539:
+	cmpl	$63, %edx	# 15185	[c=4 l=3]  *cmpsi_1/0
+	leaq	.LC33(%rip), %rax	# 16581	[c=1 l=7]  *movdi_internal/4
+	movl	%r14d, %ecx	# 4888	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 4891	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC32(%rip), %rsi	# 16580	[c=1 l=7]  *movdi_internal/4
+	cmovne	%rax, %rsi	# 15186	[c=8 l=4]  *movdicc_noc/1
+	call	log_add_data_mov@PLT	# 4892	[c=0 l=5]  *call
+	movl	%r14d, %eax	# 16977	[c=4 l=3]  *movsi_internal/0
+	movl	%r14d, %ecx	# 16979	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 4904	[c=4 l=3]  *movdi_internal/3
+	andl	$-64, %eax	# 4893	[c=4 l=3]  *andsi_1/0
+	andl	$192, %ecx	# 4895	[c=4 l=6]  *andsi_1/0
+	leaq	.LC29(%rip), %rdx	# 16671	[c=1 l=7]  *movdi_internal/4
+	movl	%eax, 16(%rsp)	# 16978	[c=4 l=4]  *movsi_internal/1
+	movl	6048(%r13), %eax	# 4894	[c=9 l=7]  *movsi_internal/0
+	leaq	.LC28(%rip), %rsi	# 16670	[c=1 l=7]  *movdi_internal/4
+	cmpl	$63, %eax	# 15725	[c=4 l=3]  *cmpsi_1/0
+	movl	%eax, 24(%rsp)	# 17830	[c=4 l=4]  *movsi_internal/1
+	cmovne	%rdx, %rsi	# 15726	[c=8 l=4]  *movdicc_noc/1
+	movl	%eax, %edx	# 4902	[c=4 l=2]  *movsi_internal/0
+	call	log_add_data_mov@PLT	# 4905	[c=0 l=5]  *call
+	movslq	24(%rsp), %rax	# 17831	[c=13 l=5]  *extendsidi2_rex64/1
+	movl	%eax, %edx	# 16981	[c=4 l=2]  *movsi_internal/0
+	subl	5176(%r13), %edx	# 4906	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %edx	# 4907	[c=13 l=7]  *cmpsi_1/1
+	jb	.L542	# 4908	[c=13 l=2]  *jcc
+	movl	%eax, %edx	# 16983	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %edx	# 4910	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %edx	# 16529	[c=5 l=6]  *andsi_1_zext
+	cmpb	$0, 1080(%r13,%rdx)	# 4913	[c=14 l=9]  *cmpqi_ccno_1/1
+	jne	.L543	# 4914	[c=13 l=6]  *jcc
+.L542:
+	movq	1040(%r13), %rdx	# 4918	[c=9 l=7]  *movdi_internal/3
+	movzbl	16(%rsp), %edi	# 16985	[c=9 l=5]  *movqi_internal/4
+	movb	%dil, (%rdx,%rax)	# 4919	[c=4 l=4]  *movqi_internal/8
+.L544:
+	andl	$63, %r14d	# 4930	[c=4 l=4]  *andsi_1/0
+	leal	-1(%r14), %eax	# 18309	[c=5 l=4]  *leadi
+	cmpl	$4, %eax	# 4934	[c=4 l=3]  *cmpsi_1/0
+	ja	.L545	# 4935	[c=13 l=6]  *jcc
+	movl	32(%rsp), %ecx	# 16986	[c=9 l=4]  *movsi_internal/0
+	movl	%r15d, %edx	# 16987	[c=4 l=3]  *movsi_internal/0
+	movl	8(%rsp), %edi	# 16989	[c=9 l=4]  *movsi_internal/0
+	negl	%edx	# 4939	[c=4 l=2]  *negsi_1
+	leal	1(%rcx,%rcx), %r14d	# 4938	[c=8 l=5]  *leasi
+	andl	%edx, %r14d	# 4940	[c=4 l=3]  *andsi_1/0
+	leaq	CSWTCH.146(%rip), %rdx	# 16550	[c=1 l=7]  *movdi_internal/4
+	andl	%edi, %r14d	# 4941	[c=4 l=3]  *andsi_1/0
+	movq	40(%rsp), %rdi	# 16990	[c=9 l=5]  *movdi_internal/3
+	movl	(%rdx,%rax,4), %eax	# 4946	[c=10 l=3]  *movsi_internal/0
+	movl	%r14d, %ecx	# 4942	[c=1 l=3]  *zero_extendsidi2/3
+	addq	%rcx, %rdi	# 4943	[c=4 l=3]  *adddi_1/0
+	movq	%rdi, %rcx	# 16991	[c=4 l=3]  *movdi_internal/3
+	cmpl	$3, %eax	# 4947	[c=4 l=3]  *cmpsi_1/0
+	je	.L1448	# 4948	[c=13 l=6]  *jcc
+	jg	.L547	# 4953	[c=13 l=6]  *jcc
+	cmpl	$1, %eax	# 4955	[c=4 l=3]  *cmpsi_1/0
+	je	.L548	# 4956	[c=13 l=6]  *jcc
+	cmpl	$2, %eax	# 4958	[c=4 l=3]  *cmpsi_1/0
+	jne	.L545	# 4959	[c=13 l=2]  *jcc
+	movq	%rdi, 16(%rsp)	# 17832	[c=4 l=5]  *movdi_internal/5
+	movl	%r14d, %edx	# 4990	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC63(%rip), %rsi	# 4991	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 4993	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 19472	[c=4 l=2]  *movdi_xor
+	call	log_append@PLT	# 4995	[c=0 l=5]  *call
+	movq	16(%rsp), %rdi	# 19473	[c=9 l=5]  *movdi_internal/3
+	movl	%r15d, %edx	# 4997	[c=1 l=3]  *zero_extendsidi2/3
+	movl	$255, %esi	# 4999	[c=4 l=5]  *movsi_internal/0
+.L1285:
+	call	memset@PLT	# 5043	[c=10 l=5]  *call_value
+	leal	(%r15,%r14), %edx	# 18306	[c=4 l=4]  *leasi
+	movl	%r14d, %esi	# 5046	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 5047	[c=4 l=3]  *movdi_internal/3
+	call	flash_changed	# 5048	[c=0 l=5]  *call
+.L545:
+	movl	8(%rsp), %r15d	# 16995	[c=9 l=5]  *movsi_internal/0
+	xorl	%eax, %eax	# 19469	[c=4 l=2]  *movdi_xor
+	movl	$30, %edx	# 5054	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 5057	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC48(%rip), %rsi	# 5055	[c=1 l=7]  *movdi_internal/4
+	addl	$2, %r15d	# 5051	[c=4 l=4]  *addsi_1/0
+	movzwl	%r15w, %ecx	# 5052	[c=4 l=4]  *zero_extendhisi2/0
+	call	log_append@PLT	# 5059	[c=0 l=5]  *call
+	movw	%r15w, 1034(%r13)	# 5060	[c=4 l=8]  *movhi_internal/3
+	cmpl	$65536, 880(%r13)	# 5063	[c=13 l=11]  *cmpsi_1/0
+	ja	.L1449	# 5064	[c=13 l=6]  *jcc
+.L553:
+	movq	%r13, %rdi	# 5096	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 5095	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 5097	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 16997	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 16998	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 5099	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18305	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 5100	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 5102	[c=4 l=3]  *cmpdi_1/0
+	jb	.L283	# 5103	[c=13 l=6]  *jcc
+	movq	56(%r13), %rax	# 16999	[c=9 l=4]  *movdi_internal/3
+	cmpq	%rax, 48(%r13)	# 5106	[c=13 l=4]  *cmpdi_1/0
+	jnb	.L1450	# 5107	[c=13 l=6]  *jcc
+.L556:
+	movq	%r13, %rdi	# 5113	[c=4 l=3]  *movdi_internal/3
+	call	log_is_idle@PLT	# 5114	[c=10 l=5]  *call_value
+	testb	%al, %al	# 5116	[c=4 l=2]  *cmpqi_ccno_1/0
+	jne	.L1451	# 5117	[c=13 l=6]  *jcc
+.L557:
+	movl	0(%r13), %ebx	# 5128	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 5133	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 5129	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 5131	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 5132	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 5134	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 5135	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 5136	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 5139	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 17000	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 5140	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 5143	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 5144	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 19468	[c=10 l=4]  *indirect_jump
+.L558:
+	movzbl	10(%rbx), %r8d	# 5153	[c=13 l=5]  zero_extendqidi2/0
+	xorl	%eax, %eax	# 19467	[c=4 l=2]  *movdi_xor
+	movq	%r13, %rdi	# 5160	[c=4 l=3]  *movdi_internal/3
+	movzwl	12(%rbx), %r14d	# 5152	[c=13 l=5]  *zero_extendhisi2/0
+	leaq	.LC43(%rip), %rsi	# 5158	[c=1 l=7]  *movdi_internal/4
+	movzbl	1004(%r13,%r8), %ecx	# 5155	[c=14 l=9]  *zero_extendqisi2/0
+	movq	%r8, %r15	# 18561	[c=4 l=3]  *movdi_internal/3
+	movl	%r8d, %edx	# 5157	[c=4 l=3]  *movsi_internal/0
+	movq	%r8, 8(%rsp)	# 17840	[c=4 l=5]  *movdi_internal/5
+	call	log_append@PLT	# 5162	[c=0 l=5]  *call
+	cmpl	$15, %r15d	# 5165	[c=4 l=4]  *cmpsi_1/0
+	movq	8(%rsp), %r8	# 17841	[c=9 l=5]  *movdi_internal/3
+	leaq	.LC43(%rip), %rsi	# 17839	[c=1 l=7]  *movdi_internal/4
+	jle	.L1452	# 5166	[c=13 l=6]  *jcc
+	movslq	%r14d, %r15	# 5180	[c=4 l=3]  *extendsidi2_rex64/1
+	xorl	%eax, %eax	# 19465	[c=4 l=2]  *movdi_xor
+	movl	%r14d, %edx	# 5183	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 5186	[c=4 l=3]  *movdi_internal/3
+	movzbl	1004(%r13,%r8), %r8d	# 5179	[c=14 l=9]  *zero_extendqisi2/0
+	movzbl	1004(%r13,%r15), %ecx	# 5181	[c=14 l=9]  *zero_extendqisi2/0
+	movl	%r8d, 8(%rsp)	# 17842	[c=4 l=5]  *movsi_internal/1
+	call	log_append@PLT	# 5188	[c=0 l=5]  *call
+	cmpl	$15, %r14d	# 5191	[c=4 l=4]  *cmpsi_1/0
+	movl	8(%rsp), %r8d	# 17843	[c=9 l=5]  *movsi_internal/0
+	jle	.L1453	# 5192	[c=13 l=6]  *jcc
+	movzbl	1004(%r13,%r15), %eax	# 5205	[c=14 l=9]  *zero_extendqisi2/0
+	xorl	%edx, %edx	# 19461	[c=4 l=2]  *movsi_xor
+	imull	%r8d, %eax	# 5206	[c=12 l=4]  *mulsi3_1/2
+	movl	%eax, %r14d	# 17002	[c=4 l=3]  *movsi_internal/0
+	addl	%r14d, %r14d	# 19462	[c=4 l=3]  *ashlsi3_cmp
+	sete	%dl	# 19463	[c=4 l=3]  *setcc_qi_slp
+	sarl	$15, %eax	# 5213	[c=4 l=3]  *ashrsi3_1/0
+	addl	%edx, %edx	# 5212	[c=4 l=2]  *ashlsi3_1/0
+	orl	%eax, %edx	# 5214	[c=4 l=2]  *iorsi_1/0
+	movl	$63, %eax	# 5215	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 5216	[c=13 l=7]  *subsi_1/1
+	movl	%edx, %r15d	# 17005	[c=4 l=3]  *movsi_internal/0
+	cmpl	5180(%r13), %eax	# 5217	[c=13 l=7]  *cmpsi_1/1
+	jb	.L561	# 5218	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%r13)	# 5220	[c=13 l=8]  *cmpqi_ccno_1/1
+	jne	.L562	# 5221	[c=13 l=6]  *jcc
+.L561:
+	movq	1040(%r13), %rax	# 5224	[c=9 l=7]  *movdi_internal/3
+	movzbl	63(%rax), %eax	# 5225	[c=13 l=4]  *zero_extendqisi2/0
+.L563:
+	movl	%eax, %ecx	# 5236	[c=4 l=2]  *movsi_internal/0
+	movl	$63, %edx	# 5237	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 5240	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, 8(%rsp)	# 17844	[c=4 l=4]  *movsi_internal/1
+	leaq	.LC32(%rip), %rsi	# 5238	[c=1 l=7]  *movdi_internal/4
+	call	log_add_data_mov@PLT	# 5241	[c=0 l=5]  *call
+	movl	8(%rsp), %eax	# 17845	[c=9 l=4]  *movsi_internal/0
+	movl	$63, %edx	# 5246	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 5249	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC28(%rip), %rsi	# 5247	[c=1 l=7]  *movdi_internal/4
+	andl	$-4, %eax	# 5242	[c=4 l=3]  *andsi_1/0
+	orl	%eax, %r15d	# 5243	[c=4 l=3]  *iorsi_1/0
+	movzbl	%r15b, %ecx	# 5244	[c=4 l=4]  *zero_extendqisi2/0
+	call	log_add_data_mov@PLT	# 5250	[c=0 l=5]  *call
+	movl	$63, %eax	# 5251	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 5252	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 5253	[c=13 l=7]  *cmpsi_1/1
+	jb	.L564	# 5254	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%r13)	# 5256	[c=13 l=8]  *cmpqi_ccno_1/1
+	jne	.L565	# 5257	[c=13 l=6]  *jcc
+.L564:
+	movq	1040(%r13), %rax	# 5260	[c=9 l=7]  *movdi_internal/3
+	movb	%r15b, 63(%rax)	# 5261	[c=4 l=4]  *movqi_internal/8
+.L566:
+	xorl	%edx, %edx	# 19459	[c=4 l=2]  *movdi_xor
+	xorl	%eax, %eax	# 19460	[c=4 l=2]  *movdi_xor
+	movzwl	%r14w, %ecx	# 5272	[c=4 l=4]  *zero_extendhisi2/0
+	movq	%r13, %rdi	# 5277	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC48(%rip), %rsi	# 5275	[c=1 l=7]  *movdi_internal/4
+	call	log_append@PLT	# 5279	[c=0 l=5]  *call
+	movw	%r14w, 1004(%r13)	# 5280	[c=4 l=8]  *movhi_internal/3
+	movq	%r13, %rdi	# 5282	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 5281	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 5283	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 17006	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 17007	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 5285	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18302	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 5286	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 5288	[c=4 l=3]  *cmpdi_1/0
+	jb	.L283	# 5289	[c=13 l=6]  *jcc
+	movl	0(%r13), %ebx	# 5291	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 5296	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 5292	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 5294	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 5295	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 5297	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 5298	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 5299	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 5302	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 17008	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 5303	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 5306	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 5307	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 19458	[c=10 l=4]  *indirect_jump
+.L567:
+	movzbl	10(%rbx), %r8d	# 5316	[c=13 l=5]  zero_extendqidi2/0
+	xorl	%eax, %eax	# 19457	[c=4 l=2]  *movdi_xor
+	movq	%r13, %rdi	# 5323	[c=4 l=3]  *movdi_internal/3
+	movzwl	12(%rbx), %r14d	# 5315	[c=13 l=5]  *zero_extendhisi2/0
+	leaq	.LC43(%rip), %rsi	# 5321	[c=1 l=7]  *movdi_internal/4
+	movzbl	1004(%r13,%r8), %ecx	# 5318	[c=14 l=9]  *zero_extendqisi2/0
+	movq	%r8, %r15	# 18562	[c=4 l=3]  *movdi_internal/3
+	movl	%r8d, %edx	# 5320	[c=4 l=3]  *movsi_internal/0
+	movq	%r8, 8(%rsp)	# 17848	[c=4 l=5]  *movdi_internal/5
+	call	log_append@PLT	# 5325	[c=0 l=5]  *call
+	cmpl	$15, %r15d	# 5328	[c=4 l=4]  *cmpsi_1/0
+	movq	8(%rsp), %r8	# 17849	[c=9 l=5]  *movdi_internal/3
+	leaq	.LC43(%rip), %rsi	# 17847	[c=1 l=7]  *movdi_internal/4
+	jle	.L1454	# 5329	[c=13 l=6]  *jcc
+	movslq	%r14d, %r15	# 5343	[c=4 l=3]  *extendsidi2_rex64/1
+	xorl	%eax, %eax	# 19455	[c=4 l=2]  *movdi_xor
+	movl	%r14d, %edx	# 5346	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 5349	[c=4 l=3]  *movdi_internal/3
+	movsbl	1004(%r13,%r8), %r8d	# 5342	[c=14 l=9]  extendqisi2
+	movzbl	1004(%r13,%r15), %ecx	# 5344	[c=14 l=9]  *zero_extendqisi2/0
+	movl	%r8d, 8(%rsp)	# 17850	[c=4 l=5]  *movsi_internal/1
+	call	log_append@PLT	# 5351	[c=0 l=5]  *call
+	cmpl	$15, %r14d	# 5354	[c=4 l=4]  *cmpsi_1/0
+	movl	8(%rsp), %r8d	# 17851	[c=9 l=5]  *movsi_internal/0
+	jle	.L1455	# 5355	[c=13 l=6]  *jcc
+	movsbl	1004(%r13,%r15), %eax	# 5368	[c=14 l=9]  extendqisi2
+	xorl	%edx, %edx	# 19451	[c=4 l=2]  *movsi_xor
+	imull	%r8d, %eax	# 5369	[c=12 l=4]  *mulsi3_1/2
+	movzwl	%ax, %eax	# 5370	[c=4 l=3]  *zero_extendhisi2/0
+	movl	%eax, %r14d	# 17010	[c=4 l=3]  *movsi_internal/0
+	addl	%r14d, %r14d	# 19452	[c=4 l=3]  *ashlsi3_cmp
+	sete	%dl	# 19453	[c=4 l=3]  *setcc_qi_slp
+	sarl	$15, %eax	# 5377	[c=4 l=3]  *ashrsi3_1/0
+	addl	%edx, %edx	# 5376	[c=4 l=2]  *ashlsi3_1/0
+	orl	%eax, %edx	# 5378	[c=4 l=2]  *iorsi_1/0
+	movl	$63, %eax	# 5379	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 5380	[c=13 l=7]  *subsi_1/1
+	movl	%edx, %r15d	# 17013	[c=4 l=3]  *movsi_internal/0
+	cmpl	5180(%r13), %eax	# 5381	[c=13 l=7]  *cmpsi_1/1
+	jb	.L570	# 5382	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%r13)	# 5384	[c=13 l=8]  *cmpqi_ccno_1/1
+	jne	.L571	# 5385	[c=13 l=6]  *jcc
+.L570:
+	movq	1040(%r13), %rax	# 5388	[c=9 l=7]  *movdi_internal/3
+	movzbl	63(%rax), %eax	# 5389	[c=13 l=4]  *zero_extendqisi2/0
+.L572:
+	movl	%eax, %ecx	# 5400	[c=4 l=2]  *movsi_internal/0
+	movl	$63, %edx	# 5401	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 5404	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, 8(%rsp)	# 17852	[c=4 l=4]  *movsi_internal/1
+	leaq	.LC32(%rip), %rsi	# 5402	[c=1 l=7]  *movdi_internal/4
+	call	log_add_data_mov@PLT	# 5405	[c=0 l=5]  *call
+	movl	8(%rsp), %eax	# 17853	[c=9 l=4]  *movsi_internal/0
+	movl	$63, %edx	# 5410	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 5413	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC28(%rip), %rsi	# 5411	[c=1 l=7]  *movdi_internal/4
+	andl	$-4, %eax	# 5406	[c=4 l=3]  *andsi_1/0
+	orl	%eax, %r15d	# 5407	[c=4 l=3]  *iorsi_1/0
+	movzbl	%r15b, %ecx	# 5408	[c=4 l=4]  *zero_extendqisi2/0
+	call	log_add_data_mov@PLT	# 5414	[c=0 l=5]  *call
+	movl	$63, %eax	# 5415	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 5416	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 5417	[c=13 l=7]  *cmpsi_1/1
+	jb	.L573	# 5418	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%r13)	# 5420	[c=13 l=8]  *cmpqi_ccno_1/1
+	jne	.L574	# 5421	[c=13 l=6]  *jcc
+.L573:
+	movq	1040(%r13), %rax	# 5424	[c=9 l=7]  *movdi_internal/3
+	movb	%r15b, 63(%rax)	# 5425	[c=4 l=4]  *movqi_internal/8
+.L575:
+	xorl	%edx, %edx	# 19449	[c=4 l=2]  *movdi_xor
+	xorl	%eax, %eax	# 19450	[c=4 l=2]  *movdi_xor
+	movzwl	%r14w, %ecx	# 5436	[c=4 l=4]  *zero_extendhisi2/0
+	movq	%r13, %rdi	# 5441	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC48(%rip), %rsi	# 5439	[c=1 l=7]  *movdi_internal/4
+	call	log_append@PLT	# 5443	[c=0 l=5]  *call
+	movw	%r14w, 1004(%r13)	# 5444	[c=4 l=8]  *movhi_internal/3
+	movq	%r13, %rdi	# 5446	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 5445	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 5447	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 17014	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 17015	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 5449	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18299	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 5450	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 5452	[c=4 l=3]  *cmpdi_1/0
+	jb	.L283	# 5453	[c=13 l=6]  *jcc
+	movl	0(%r13), %ebx	# 5455	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 5460	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 5456	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 5458	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 5459	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 5461	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 5462	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 5463	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 5466	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 17016	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 5467	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 5470	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 5471	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 19448	[c=10 l=4]  *indirect_jump
+.L576:
+	movzbl	10(%rbx), %r8d	# 5480	[c=13 l=5]  zero_extendqidi2/0
+	xorl	%eax, %eax	# 19447	[c=4 l=2]  *movdi_xor
+	movq	%r13, %rdi	# 5487	[c=4 l=3]  *movdi_internal/3
+	movzwl	12(%rbx), %r14d	# 5479	[c=13 l=5]  *zero_extendhisi2/0
+	leaq	.LC43(%rip), %rsi	# 5485	[c=1 l=7]  *movdi_internal/4
+	movzbl	1004(%r13,%r8), %ecx	# 5482	[c=14 l=9]  *zero_extendqisi2/0
+	movq	%r8, %r15	# 18563	[c=4 l=3]  *movdi_internal/3
+	movl	%r8d, %edx	# 5484	[c=4 l=3]  *movsi_internal/0
+	movq	%r8, 8(%rsp)	# 17856	[c=4 l=5]  *movdi_internal/5
+	call	log_append@PLT	# 5489	[c=0 l=5]  *call
+	cmpl	$15, %r15d	# 5492	[c=4 l=4]  *cmpsi_1/0
+	movq	8(%rsp), %r8	# 17857	[c=9 l=5]  *movdi_internal/3
+	leaq	.LC43(%rip), %rsi	# 17855	[c=1 l=7]  *movdi_internal/4
+	jle	.L1456	# 5493	[c=13 l=6]  *jcc
+	movslq	%r14d, %r15	# 5507	[c=4 l=3]  *extendsidi2_rex64/1
+	xorl	%eax, %eax	# 19445	[c=4 l=2]  *movdi_xor
+	movl	%r14d, %edx	# 5510	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 5513	[c=4 l=3]  *movdi_internal/3
+	movsbl	1004(%r13,%r8), %r8d	# 5506	[c=14 l=9]  extendqisi2
+	movzbl	1004(%r13,%r15), %ecx	# 5508	[c=14 l=9]  *zero_extendqisi2/0
+	movl	%r8d, 8(%rsp)	# 17858	[c=4 l=5]  *movsi_internal/1
+	call	log_append@PLT	# 5515	[c=0 l=5]  *call
+	cmpl	$15, %r14d	# 5518	[c=4 l=4]  *cmpsi_1/0
+	movl	8(%rsp), %r8d	# 17859	[c=9 l=5]  *movsi_internal/0
+	jle	.L1457	# 5519	[c=13 l=6]  *jcc
+	movzbl	1004(%r13,%r15), %eax	# 5532	[c=14 l=9]  *zero_extendqisi2/0
+	xorl	%edx, %edx	# 19441	[c=4 l=2]  *movsi_xor
+	imull	%r8d, %eax	# 5533	[c=12 l=4]  *mulsi3_1/2
+	movzwl	%ax, %eax	# 5534	[c=4 l=3]  *zero_extendhisi2/0
+	movl	%eax, %r14d	# 17018	[c=4 l=3]  *movsi_internal/0
+	addl	%r14d, %r14d	# 19442	[c=4 l=3]  *ashlsi3_cmp
+	sete	%dl	# 19443	[c=4 l=3]  *setcc_qi_slp
+	sarl	$15, %eax	# 5541	[c=4 l=3]  *ashrsi3_1/0
+	addl	%edx, %edx	# 5540	[c=4 l=2]  *ashlsi3_1/0
+	orl	%eax, %edx	# 5542	[c=4 l=2]  *iorsi_1/0
+	movl	$63, %eax	# 5543	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 5544	[c=13 l=7]  *subsi_1/1
+	movl	%edx, %r15d	# 17021	[c=4 l=3]  *movsi_internal/0
+	cmpl	5180(%r13), %eax	# 5545	[c=13 l=7]  *cmpsi_1/1
+	jb	.L579	# 5546	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%r13)	# 5548	[c=13 l=8]  *cmpqi_ccno_1/1
+	jne	.L580	# 5549	[c=13 l=6]  *jcc
+.L579:
+	movq	1040(%r13), %rax	# 5552	[c=9 l=7]  *movdi_internal/3
+	movzbl	63(%rax), %eax	# 5553	[c=13 l=4]  *zero_extendqisi2/0
+.L581:
+	movl	%eax, %ecx	# 5564	[c=4 l=2]  *movsi_internal/0
+	movl	$63, %edx	# 5565	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 5568	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, 8(%rsp)	# 17860	[c=4 l=4]  *movsi_internal/1
+	leaq	.LC32(%rip), %rsi	# 5566	[c=1 l=7]  *movdi_internal/4
+	call	log_add_data_mov@PLT	# 5569	[c=0 l=5]  *call
+	movl	8(%rsp), %eax	# 17861	[c=9 l=4]  *movsi_internal/0
+	movl	$63, %edx	# 5574	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 5577	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC28(%rip), %rsi	# 5575	[c=1 l=7]  *movdi_internal/4
+	andl	$-4, %eax	# 5570	[c=4 l=3]  *andsi_1/0
+	orl	%eax, %r15d	# 5571	[c=4 l=3]  *iorsi_1/0
+	movzbl	%r15b, %ecx	# 5572	[c=4 l=4]  *zero_extendqisi2/0
+	call	log_add_data_mov@PLT	# 5578	[c=0 l=5]  *call
+	movl	$63, %eax	# 5579	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 5580	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 5581	[c=13 l=7]  *cmpsi_1/1
+	jb	.L582	# 5582	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%r13)	# 5584	[c=13 l=8]  *cmpqi_ccno_1/1
+	jne	.L583	# 5585	[c=13 l=6]  *jcc
+.L582:
+	movq	1040(%r13), %rax	# 5588	[c=9 l=7]  *movdi_internal/3
+	movb	%r15b, 63(%rax)	# 5589	[c=4 l=4]  *movqi_internal/8
+.L584:
+	xorl	%edx, %edx	# 19439	[c=4 l=2]  *movdi_xor
+	xorl	%eax, %eax	# 19440	[c=4 l=2]  *movdi_xor
+	movzwl	%r14w, %ecx	# 5600	[c=4 l=4]  *zero_extendhisi2/0
+	movq	%r13, %rdi	# 5605	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC48(%rip), %rsi	# 5603	[c=1 l=7]  *movdi_internal/4
+	call	log_append@PLT	# 5607	[c=0 l=5]  *call
+	movw	%r14w, 1004(%r13)	# 5608	[c=4 l=8]  *movhi_internal/3
+	movq	%r13, %rdi	# 5610	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 5609	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 5611	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 17022	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 17023	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 5613	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18296	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 5614	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 5616	[c=4 l=3]  *cmpdi_1/0
+	jb	.L283	# 5617	[c=13 l=6]  *jcc
+	movl	0(%r13), %ebx	# 5619	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 5624	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 5620	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 5622	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 5623	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 5625	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 5626	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 5627	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 5630	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 17024	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 5631	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 5634	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 5635	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 19438	[c=10 l=4]  *indirect_jump
+.L585:
+	movl	5176(%r13), %r15d	# 5643	[c=9 l=7]  *movsi_internal/0
+	movl	$61, %eax	# 5645	[c=4 l=5]  *movsi_internal/0
+	movl	5180(%r13), %r14d	# 5644	[c=9 l=7]  *movsi_internal/0
+	subl	%r15d, %eax	# 5646	[c=4 l=3]  *subsi_1/0
+	cmpl	%r14d, %eax	# 5647	[c=4 l=3]  *cmpsi_1/0
+	jb	.L586	# 5648	[c=13 l=6]  *jcc
+	cmpb	$1, 1081(%r13)	# 5652	[c=13 l=8]  *cmpqi_1/0
+	ja	.L1458	# 5653	[c=13 l=6]  *jcc
+	movq	1040(%r13), %rax	# 14402	[c=9 l=7]  *movdi_internal/3
+	movzbl	61(%rax), %edx	# 14403	[c=13 l=4]  *zero_extendqisi2/0
+.L588:
+	movzbl	62(%rax), %r8d	# 5690	[c=13 l=5]  *zero_extendqisi2/0
+.L590:
+	sall	$8, %r8d	# 5693	[c=4 l=4]  *ashlsi3_1/0
+	leaq	.LC30(%rip), %rsi	# 5697	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 5699	[c=4 l=3]  *movdi_internal/3
+	orl	%edx, %r8d	# 5694	[c=4 l=3]  *iorsi_1/0
+	movl	$61, %edx	# 5696	[c=4 l=5]  *movsi_internal/0
+	movl	%r8d, %ecx	# 5695	[c=4 l=3]  *movsi_internal/0
+	movl	%r8d, %r15d	# 17027	[c=4 l=3]  *movsi_internal/0
+	call	log_add_data_mov@PLT	# 5700	[c=0 l=5]  *call
+	movl	996(%r13), %edx	# 5702	[c=9 l=7]  *movsi_internal/0
+	movzbl	840(%r13), %eax	# 5704	[c=13 l=8]  *zero_extendqisi2/0
+	leal	1(%rdx,%rax), %eax	# 5705	[c=5 l=4]  *leasi
+	cmpl	%eax, %r15d	# 5706	[c=4 l=3]  *cmpsi_1/0
+	jb	.L1459	# 5707	[c=13 l=6]  *jcc
+	cmpl	$63, %r15d	# 15197	[c=4 l=4]  *cmpsi_1/0
+	movl	0(%r13), %r14d	# 5715	[c=5 l=4]  *movsi_internal/0
+	leal	-1(%r15), %r9d	# 18295	[c=4 l=4]  *leasi
+	movl	%r15d, %edx	# 5724	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC29(%rip), %rax	# 16583	[c=1 l=7]  *movdi_internal/4
+	leaq	.LC28(%rip), %rsi	# 16582	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 5726	[c=4 l=3]  *movdi_internal/3
+	movl	%r9d, 8(%rsp)	# 17864	[c=4 l=5]  *movsi_internal/1
+	cmovne	%rax, %rsi	# 15198	[c=8 l=4]  *movdicc_noc/1
+	movzbl	%r14b, %ecx	# 5717	[c=4 l=4]  *zero_extendqisi2/0
+	call	log_add_data_mov@PLT	# 5727	[c=0 l=5]  *call
+	movl	%r15d, %eax	# 17028	[c=4 l=3]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 5728	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 5729	[c=13 l=7]  *cmpsi_1/1
+	movl	8(%rsp), %r9d	# 17865	[c=9 l=5]  *movsi_internal/0
+	jb	.L593	# 5730	[c=13 l=2]  *jcc
+	movl	%r15d, %eax	# 17030	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %eax	# 5732	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 16528	[c=5 l=5]  *andsi_1_zext
+	cmpb	$0, 1080(%r13,%rax)	# 5735	[c=14 l=9]  *cmpqi_ccno_1/1
+	jne	.L594	# 5736	[c=13 l=6]  *jcc
+.L593:
+	movq	1040(%r13), %rdx	# 5740	[c=9 l=7]  *movdi_internal/3
+	movslq	%r15d, %rax	# 5739	[c=4 l=3]  *extendsidi2_rex64/1
+	movb	%r14b, (%rdx,%rax)	# 5741	[c=4 l=4]  *movqi_internal/8
+.L595:
+	movl	0(%r13), %ecx	# 5752	[c=5 l=4]  *movsi_internal/0
+	movl	%r9d, %edx	# 5762	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 5764	[c=4 l=3]  *movdi_internal/3
+	movl	%r9d, 16(%rsp)	# 17868	[c=4 l=5]  *movsi_internal/1
+	leaq	.LC28(%rip), %rsi	# 16584	[c=1 l=7]  *movdi_internal/4
+	leal	-2(%r15), %r14d	# 18294	[c=4 l=4]  *leasi
+	movl	%ecx, %eax	# 17032	[c=4 l=2]  *movsi_internal/0
+	movzbl	%ch, %ecx	# 5755	[c=4 l=3]  *extzvsi
+	shrl	$8, %eax	# 5753	[c=4 l=3]  *lshrsi3_1/0
+	cmpl	$63, %r9d	# 15209	[c=4 l=4]  *cmpsi_1/0
+	movl	%eax, 8(%rsp)	# 17033	[c=4 l=4]  *movsi_internal/1
+	leaq	.LC29(%rip), %rax	# 16585	[c=1 l=7]  *movdi_internal/4
+	cmovne	%rax, %rsi	# 15210	[c=8 l=4]  *movdicc_noc/1
+	call	log_add_data_mov@PLT	# 5765	[c=0 l=5]  *call
+	movslq	16(%rsp), %r9	# 17869	[c=13 l=5]  *extendsidi2_rex64/1
+	movl	%r9d, %eax	# 17034	[c=4 l=3]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 5766	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 5767	[c=13 l=7]  *cmpsi_1/1
+	jb	.L597	# 5768	[c=13 l=2]  *jcc
+	movl	%r9d, %eax	# 17036	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %eax	# 5770	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 16527	[c=5 l=5]  *andsi_1_zext
+	cmpb	$0, 1080(%r13,%rax)	# 5773	[c=14 l=9]  *cmpqi_ccno_1/1
+	jne	.L598	# 5774	[c=13 l=6]  *jcc
+.L597:
+	movq	1040(%r13), %rax	# 5778	[c=9 l=7]  *movdi_internal/3
+	movzbl	8(%rsp), %edi	# 17038	[c=9 l=5]  *movqi_internal/4
+	movb	%dil, (%rax,%r9)	# 5779	[c=4 l=4]  *movqi_internal/8
+.L599:
+	cmpb	$0, 840(%r13)	# 5790	[c=13 l=8]  *cmpqi_ccno_1/1
+	je	.L600	# 5791	[c=13 l=2]  *jcc
+	movl	0(%r13), %eax	# 17039	[c=5 l=4]  *movsi_internal/0
+	subl	$3, %r15d	# 5795	[c=4 l=4]  *addsi_1/0
+	movq	%r13, %rdi	# 5805	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC29(%rip), %rdx	# 16587	[c=1 l=7]  *movdi_internal/4
+	leaq	.LC28(%rip), %rsi	# 16586	[c=1 l=7]  *movdi_internal/4
+	shrl	$16, %eax	# 5794	[c=4 l=3]  *lshrsi3_1/0
+	cmpl	$63, %r14d	# 15221	[c=4 l=4]  *cmpsi_1/0
+	cmovne	%rdx, %rsi	# 15222	[c=8 l=4]  *movdicc_noc/1
+	movzbl	%al, %ecx	# 5796	[c=4 l=3]  *zero_extendqisi2/0
+	movl	%r14d, %edx	# 5803	[c=4 l=3]  *movsi_internal/0
+	movl	%eax, 8(%rsp)	# 17870	[c=4 l=4]  *movsi_internal/1
+	call	log_add_data_mov@PLT	# 5806	[c=0 l=5]  *call
+	movl	%r14d, %edx	# 17041	[c=4 l=3]  *movsi_internal/0
+	subl	5176(%r13), %edx	# 5807	[c=13 l=7]  *subsi_1/1
+	movl	8(%rsp), %eax	# 17871	[c=9 l=4]  *movsi_internal/0
+	cmpl	5180(%r13), %edx	# 5808	[c=13 l=7]  *cmpsi_1/1
+	jb	.L602	# 5809	[c=13 l=2]  *jcc
+	movl	%r14d, %edx	# 17043	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %edx	# 5811	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %edx	# 16526	[c=5 l=6]  *andsi_1_zext
+	cmpb	$0, 1080(%r13,%rdx)	# 5814	[c=14 l=9]  *cmpqi_ccno_1/1
+	jne	.L603	# 5815	[c=13 l=6]  *jcc
+.L602:
+	movq	1040(%r13), %rdx	# 5819	[c=9 l=7]  *movdi_internal/3
+	movslq	%r14d, %r14	# 5818	[c=4 l=3]  *extendsidi2_rex64/1
+	movb	%al, (%rdx,%r14)	# 5820	[c=4 l=4]  *movqi_internal/8
+.L604:
+	movl	%r15d, %r14d	# 34	[c=4 l=3]  *movsi_internal/0
+.L600:
+	movzwl	%r14w, %r15d	# 5835	[c=4 l=4]  *zero_extendhisi2/0
+	movl	$61, %edx	# 5837	[c=4 l=5]  *movsi_internal/0
+	leaq	.LC31(%rip), %rsi	# 5838	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 5840	[c=4 l=3]  *movdi_internal/3
+	movl	%r15d, %ecx	# 5836	[c=4 l=3]  *movsi_internal/0
+	call	log_add_data_mov@PLT	# 5841	[c=0 l=5]  *call
+	movl	$61, %eax	# 5842	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 5843	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 5844	[c=13 l=7]  *cmpsi_1/1
+	jb	.L605	# 5845	[c=13 l=2]  *jcc
+	cmpb	$1, 1081(%r13)	# 5849	[c=13 l=8]  *cmpqi_1/0
+	ja	.L1460	# 5850	[c=13 l=6]  *jcc
+.L605:
+	movq	1040(%r13), %rax	# 5861	[c=9 l=7]  *movdi_internal/3
+	movb	%r14b, 61(%rax)	# 5862	[c=4 l=4]  *movqi_internal/8
+.L606:
+	movl	$62, %eax	# 5866	[c=4 l=5]  *movsi_internal/0
+	sarl	$8, %r15d	# 5865	[c=4 l=4]  *ashrsi3_1/0
+	subl	5176(%r13), %eax	# 5867	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 5868	[c=13 l=7]  *cmpsi_1/1
+	jb	.L607	# 5869	[c=13 l=2]  *jcc
+	cmpb	$1, 1081(%r13)	# 5873	[c=13 l=8]  *cmpqi_1/0
+	ja	.L1461	# 5874	[c=13 l=6]  *jcc
+.L607:
+	movq	1040(%r13), %rax	# 5884	[c=9 l=7]  *movdi_internal/3
+	movb	%r15b, 62(%rax)	# 5885	[c=4 l=4]  *movqi_internal/8
+.L608:
+	movzwl	1034(%r13), %r14d	# 5889	[c=13 l=8]  *zero_extendhisi2/0
+	movl	$30, %edx	# 5891	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 5894	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 19437	[c=4 l=2]  *movdi_xor
+	leaq	.LC44(%rip), %rsi	# 5892	[c=1 l=7]  *movdi_internal/4
+	movl	%r14d, %ecx	# 5890	[c=4 l=3]  *movsi_internal/0
+	call	log_append@PLT	# 5896	[c=0 l=5]  *call
+	movl	%r14d, 0(%r13)	# 5898	[c=4 l=4]  *movsi_internal/1
+	cmpl	%r14d, 992(%r13)	# 5899	[c=13 l=7]  *cmpsi_1/0
+	jb	.L1462	# 5900	[c=13 l=6]  *jcc
+	movzbl	840(%r13), %eax	# 5908	[c=13 l=8]  zero_extendqidi2/0
+	addq	%rax, 48(%r13)	# 5909	[c=13 l=4]  *adddi_1/0
+	movq	%r13, %rdi	# 5911	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 5910	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 5912	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 17045	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 17046	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 5914	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18293	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 5915	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 5917	[c=4 l=3]  *cmpdi_1/0
+	jb	.L283	# 5918	[c=13 l=6]  *jcc
+	movq	56(%r13), %rax	# 17047	[c=9 l=4]  *movdi_internal/3
+	cmpq	%rax, 48(%r13)	# 5921	[c=13 l=4]  *cmpdi_1/0
+	jnb	.L1463	# 5922	[c=13 l=6]  *jcc
+.L610:
+	movq	%r13, %rdi	# 5928	[c=4 l=3]  *movdi_internal/3
+	call	log_is_idle@PLT	# 5929	[c=10 l=5]  *call_value
+	testb	%al, %al	# 5931	[c=4 l=2]  *cmpqi_ccno_1/0
+	jne	.L1464	# 5932	[c=13 l=6]  *jcc
+.L611:
+	movl	0(%r13), %ebx	# 5943	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 5948	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 5944	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 5946	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 5947	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 5949	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 5950	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 5951	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 5954	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 17048	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 5955	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 5958	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 5959	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 19436	[c=10 l=4]  *indirect_jump
+.L612:
+	movzwl	1034(%r13), %r14d	# 5968	[c=13 l=8]  *zero_extendhisi2/0
+	movl	$30, %edx	# 5970	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 5973	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 19435	[c=4 l=2]  *movdi_xor
+	leaq	.LC44(%rip), %rsi	# 5971	[c=1 l=7]  *movdi_internal/4
+	movl	%r14d, %ecx	# 5969	[c=4 l=3]  *movsi_internal/0
+	call	log_append@PLT	# 5975	[c=0 l=5]  *call
+	movl	%r14d, 0(%r13)	# 5977	[c=4 l=4]  *movsi_internal/1
+	cmpl	%r14d, 992(%r13)	# 5978	[c=13 l=7]  *cmpsi_1/0
+	jb	.L1465	# 5979	[c=13 l=6]  *jcc
+	movq	%r13, %rdi	# 5988	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 5987	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 5989	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 17050	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 17051	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 5991	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18292	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 5992	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 5994	[c=4 l=3]  *cmpdi_1/0
+	jb	.L283	# 5995	[c=13 l=6]  *jcc
+	movq	56(%r13), %rax	# 17052	[c=9 l=4]  *movdi_internal/3
+	cmpq	%rax, 48(%r13)	# 5998	[c=13 l=4]  *cmpdi_1/0
+	jnb	.L1466	# 5999	[c=13 l=6]  *jcc
+.L614:
+	movq	%r13, %rdi	# 6005	[c=4 l=3]  *movdi_internal/3
+	call	log_is_idle@PLT	# 6006	[c=10 l=5]  *call_value
+	testb	%al, %al	# 6008	[c=4 l=2]  *cmpqi_ccno_1/0
+	jne	.L1467	# 6009	[c=13 l=6]  *jcc
+.L615:
+	movl	0(%r13), %ebx	# 6020	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 6025	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 6021	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 6023	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 6024	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 6026	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 6027	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 6028	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 6031	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 17053	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 6032	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 6035	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 6036	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 19434	[c=10 l=4]  *indirect_jump
+.L616:
+	movzwl	12(%rbx), %edx	# 6044	[c=13 l=4]  zero_extendhidi2/0
+	movzbl	10(%rbx), %r14d	# 6046	[c=13 l=5]  zero_extendqidi2/0
+	movl	%edx, %ecx	# 17055	[c=4 l=2]  *movsi_internal/0
+	movq	%rdx, %rax	# 18564	[c=4 l=3]  *movdi_internal/3
+	subl	5176(%r13), %ecx	# 6048	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %ecx	# 6049	[c=13 l=7]  *cmpsi_1/1
+	jb	.L617	# 6050	[c=13 l=2]  *jcc
+	movl	%edx, %ecx	# 17057	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %ecx	# 6052	[c=4 l=3]  *ashrsi3_1/0
+	movslq	%ecx, %rcx	# 6053	[c=4 l=3]  *extendsidi2_rex64/1
+	cmpb	$0, 1080(%r13,%rcx)	# 6054	[c=14 l=9]  *cmpqi_ccno_1/1
+	jne	.L618	# 6055	[c=13 l=6]  *jcc
+.L617:
+	movq	1040(%r13), %rcx	# 6059	[c=9 l=7]  *movdi_internal/3
+	movzbl	(%rcx,%rax), %r15d	# 6060	[c=13 l=5]  *zero_extendqisi2/0
+.L619:
+	cmpl	$63, %edx	# 15233	[c=4 l=3]  *cmpsi_1/0
+	leaq	.LC33(%rip), %rax	# 16589	[c=1 l=7]  *movdi_internal/4
+	movl	%r15d, %ecx	# 6076	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 6079	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC32(%rip), %rsi	# 16588	[c=1 l=7]  *movdi_internal/4
+	cmovne	%rax, %rsi	# 15234	[c=8 l=4]  *movdicc_noc/1
+	call	log_add_data_mov@PLT	# 6080	[c=0 l=5]  *call
+	xorl	%eax, %eax	# 19433	[c=4 l=2]  *movdi_xor
+	movzbl	%r15b, %ecx	# 6082	[c=4 l=4]  *zero_extendqisi2/0
+	movl	%r14d, %edx	# 6084	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC61(%rip), %rsi	# 6085	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 6087	[c=4 l=3]  *movdi_internal/3
+	call	log_append@PLT	# 6089	[c=0 l=5]  *call
+	cmpl	$15, %r14d	# 6092	[c=4 l=4]  *cmpsi_1/0
+	jle	.L1468	# 6093	[c=13 l=6]  *jcc
+	movb	%r15b, 1004(%r13,%r14)	# 6106	[c=4 l=8]  *movqi_internal/8
+	movq	%r13, %rdi	# 6108	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 6107	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 6109	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 17059	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 17060	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 6111	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18291	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 6112	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 6114	[c=4 l=3]  *cmpdi_1/0
+	jb	.L283	# 6115	[c=13 l=6]  *jcc
+	movl	0(%r13), %ebx	# 6117	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 6122	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 6118	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 6120	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 6121	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 6123	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 6124	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 6125	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 6128	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 17061	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 6129	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 6132	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 6133	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 19431	[c=10 l=4]  *indirect_jump
+.L622:
+	movzbl	10(%rbx), %r9d	# 6141	[c=13 l=5]  zero_extendqidi2/0
+	xorl	%eax, %eax	# 19430	[c=4 l=2]  *movdi_xor
+	leaq	.LC43(%rip), %rsi	# 6146	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 6148	[c=4 l=3]  *movdi_internal/3
+	movzbl	1004(%r13,%r9), %ecx	# 6143	[c=14 l=9]  *zero_extendqisi2/0
+	movq	%r9, %r14	# 18565	[c=4 l=3]  *movdi_internal/3
+	movl	%r9d, %edx	# 6145	[c=4 l=3]  *movsi_internal/0
+	movq	%r9, 8(%rsp)	# 17874	[c=4 l=5]  *movdi_internal/5
+	call	log_append@PLT	# 6150	[c=0 l=5]  *call
+	cmpl	$15, %r14d	# 6153	[c=4 l=4]  *cmpsi_1/0
+	movq	8(%rsp), %r9	# 17875	[c=9 l=5]  *movdi_internal/3
+	jle	.L1469	# 6154	[c=13 l=6]  *jcc
+	xorl	%eax, %eax	# 19428	[c=4 l=2]  *movdi_xor
+	movl	%r14d, %edx	# 6172	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC61(%rip), %rsi	# 6173	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 6175	[c=4 l=3]  *movdi_internal/3
+	movzbl	1004(%r13,%r9), %r8d	# 6167	[c=10 l=9]  *movqi_internal/4
+	movq	%r9, 16(%rsp)	# 17878	[c=4 l=5]  *movdi_internal/5
+	leal	1(%r8), %r15d	# 18289	[c=4 l=4]  *leasi
+	movb	%r8b, 8(%rsp)	# 17876	[c=4 l=5]  *movqi_internal/8
+	movzbl	%r15b, %r15d	# 6170	[c=4 l=4]  zero_extendqidi2/0
+	movl	%r15d, %ecx	# 6171	[c=4 l=3]  *movsi_internal/0
+	call	log_append@PLT	# 6177	[c=0 l=5]  *call
+	movzbl	8(%rsp), %r8d	# 17877	[c=9 l=6]  *movqi_internal/4
+	movq	16(%rsp), %r9	# 17879	[c=9 l=5]  *movdi_internal/3
+	leal	1(%r8), %eax	# 18290	[c=4 l=4]  *leasi
+	movb	%al, 1004(%r13,%r9)	# 6180	[c=4 l=8]  *movqi_internal/8
+	movl	$63, %eax	# 6181	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 6182	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 6183	[c=13 l=7]  *cmpsi_1/1
+	jb	.L624	# 6184	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%r13)	# 6186	[c=13 l=8]  *cmpqi_ccno_1/1
+	jne	.L625	# 6187	[c=13 l=6]  *jcc
+.L624:
+	movq	1040(%r13), %rax	# 6190	[c=9 l=7]  *movdi_internal/3
+	movzbl	63(%rax), %r14d	# 6191	[c=13 l=5]  *zero_extendqisi2/0
+.L626:
+	movl	%r14d, %ecx	# 6202	[c=4 l=3]  *movsi_internal/0
+	movl	$63, %edx	# 6203	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 6206	[c=4 l=3]  *movdi_internal/3
+	andl	$-31, %r14d	# 6208	[c=4 l=4]  *andsi_1/0
+	leaq	.LC32(%rip), %rsi	# 6204	[c=1 l=7]  *movdi_internal/4
+	call	log_add_data_mov@PLT	# 6207	[c=0 l=5]  *call
+	leaq	flag_update_table_inc(%rip), %rax	# 16551	[c=1 l=7]  *movdi_internal/4
+	movl	$63, %edx	# 6215	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 6218	[c=4 l=3]  *movdi_internal/3
+	movzbl	(%rax,%r15), %eax	# 6211	[c=13 l=5]  *zero_extendqisi2/0
+	leaq	.LC28(%rip), %rsi	# 6216	[c=1 l=7]  *movdi_internal/4
+	orl	%eax, %r14d	# 6212	[c=4 l=3]  *iorsi_1/0
+	movzbl	%r14b, %ecx	# 6213	[c=4 l=4]  *zero_extendqisi2/0
+	call	log_add_data_mov@PLT	# 6219	[c=0 l=5]  *call
+	movl	$63, %eax	# 6220	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 6221	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 6222	[c=13 l=7]  *cmpsi_1/1
+	jb	.L627	# 6223	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%r13)	# 6225	[c=13 l=8]  *cmpqi_ccno_1/1
+	jne	.L628	# 6226	[c=13 l=6]  *jcc
+.L627:
+	movq	1040(%r13), %rax	# 6229	[c=9 l=7]  *movdi_internal/3
+	movb	%r14b, 63(%rax)	# 6230	[c=4 l=4]  *movqi_internal/8
+.L629:
+	movq	%r13, %rdi	# 6242	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 6241	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 6243	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 17063	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 17064	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 6245	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18288	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 6246	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 6248	[c=4 l=3]  *cmpdi_1/0
+	jb	.L283	# 6249	[c=13 l=6]  *jcc
+	movl	0(%r13), %ebx	# 6251	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 6256	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 6252	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 6254	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 6255	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 6257	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 6258	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 6259	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 6262	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 17065	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 6263	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 6266	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 6267	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 19427	[c=10 l=4]  *indirect_jump
+.L630:
+	movzbl	10(%rbx), %esi	# 6275	[c=13 l=4]  *zero_extendqisi2/0
+	movzwl	12(%rbx), %eax	# 6277	[c=13 l=4]  *zero_extendhisi2/0
+	sall	$16, %esi	# 6276	[c=4 l=3]  *ashlsi3_1/0
+	orl	%eax, %esi	# 6278	[c=4 l=2]  *iorsi_1/0
+	movl	%esi, 0(%r13)	# 6279	[c=4 l=4]  *movsi_internal/1
+	cmpl	%esi, 992(%r13)	# 6280	[c=13 l=7]  *cmpsi_1/0
+	jb	.L1470	# 6281	[c=13 l=6]  *jcc
+	movq	%r13, %rdi	# 6290	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 6289	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 6291	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 17067	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 17068	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 6293	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18287	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 6294	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 6296	[c=4 l=3]  *cmpdi_1/0
+	jb	.L283	# 6297	[c=13 l=6]  *jcc
+	movq	56(%r13), %rax	# 17069	[c=9 l=4]  *movdi_internal/3
+	cmpq	%rax, 48(%r13)	# 6300	[c=13 l=4]  *cmpdi_1/0
+	jnb	.L1471	# 6301	[c=13 l=6]  *jcc
+.L632:
+	movq	%r13, %rdi	# 6307	[c=4 l=3]  *movdi_internal/3
+	call	log_is_idle@PLT	# 6308	[c=10 l=5]  *call_value
+	testb	%al, %al	# 6310	[c=4 l=2]  *cmpqi_ccno_1/0
+	jne	.L1472	# 6311	[c=13 l=6]  *jcc
+.L633:
+	movl	0(%r13), %ebx	# 6322	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 6327	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 6323	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 6325	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 6326	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 6328	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 6329	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 6330	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 6333	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 17070	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 6334	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 6337	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 6338	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 19426	[c=10 l=4]  *indirect_jump
+.L634:
+	movzbl	10(%rbx), %r14d	# 6347	[c=13 l=5]  zero_extendqidi2/0
+	movzwl	12(%rbx), %r15d	# 6346	[c=9 l=5]  *movhi_internal/2
+	xorl	%eax, %eax	# 19425	[c=4 l=2]  *movdi_xor
+	movq	%r13, %rdi	# 6355	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC61(%rip), %rsi	# 6353	[c=1 l=7]  *movdi_internal/4
+	movzbl	%r15b, %ecx	# 6350	[c=4 l=4]  *zero_extendqisi2/0
+	movl	%r14d, %edx	# 6352	[c=4 l=3]  *movsi_internal/0
+	call	log_append@PLT	# 6357	[c=0 l=5]  *call
+	cmpl	$15, %r14d	# 6360	[c=4 l=4]  *cmpsi_1/0
+	jle	.L1473	# 6361	[c=13 l=6]  *jcc
+	movb	%r15b, 1004(%r13,%r14)	# 6374	[c=4 l=8]  *movqi_internal/8
+	movq	%r13, %rdi	# 6376	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 6375	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 6377	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 17072	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 17073	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 6379	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18286	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 6380	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 6382	[c=4 l=3]  *cmpdi_1/0
+	jb	.L283	# 6383	[c=13 l=6]  *jcc
+	movl	0(%r13), %ebx	# 6385	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 6390	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 6386	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 6388	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 6389	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 6391	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 6392	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 6393	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 6396	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 17074	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 6397	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 6400	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 6401	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 19423	[c=10 l=4]  *indirect_jump
+.L636:
+	movzwl	12(%rbx), %eax	# 6409	[c=13 l=4]  *zero_extendhisi2/0
+	movl	$28, %edx	# 6413	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 6416	[c=4 l=3]  *movdi_internal/3
+	movzwl	1032(%r13), %r15d	# 6411	[c=13 l=8]  *zero_extendhisi2/0
+	leaq	.LC44(%rip), %rsi	# 6414	[c=1 l=7]  *movdi_internal/4
+	movzbl	10(%rbx), %r14d	# 6410	[c=13 l=5]  zero_extendqidi2/0
+	movl	%eax, 8(%rsp)	# 17076	[c=4 l=4]  *movsi_internal/1
+	movl	%r15d, %ecx	# 6412	[c=4 l=3]  *movsi_internal/0
+	xorl	%eax, %eax	# 19422	[c=4 l=2]  *movdi_xor
+	call	log_append@PLT	# 6418	[c=0 l=5]  *call
+	movl	8(%rsp), %eax	# 17077	[c=9 l=4]  *movsi_internal/0
+	leal	(%rax,%r15), %edx	# 18285	[c=4 l=4]  *leasi
+	movl	%edx, %eax	# 17078	[c=4 l=2]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 6420	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 6421	[c=13 l=7]  *cmpsi_1/1
+	jb	.L637	# 6422	[c=13 l=2]  *jcc
+	movl	%edx, %eax	# 17080	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %eax	# 6424	[c=4 l=3]  *ashrsi3_1/0
+	cltq	# 6425	[c=4 l=2]  *extendsidi2_rex64/0
+	cmpb	$0, 1080(%r13,%rax)	# 6426	[c=14 l=9]  *cmpqi_ccno_1/1
+	jne	.L638	# 6427	[c=13 l=6]  *jcc
+.L637:
+	movq	1040(%r13), %rcx	# 6431	[c=9 l=7]  *movdi_internal/3
+	movslq	%edx, %rax	# 6430	[c=4 l=3]  *extendsidi2_rex64/1
+	movzbl	(%rcx,%rax), %r15d	# 6432	[c=13 l=5]  *zero_extendqisi2/0
+.L639:
+	cmpl	$63, %edx	# 15245	[c=4 l=3]  *cmpsi_1/0
+	leaq	.LC33(%rip), %rax	# 16591	[c=1 l=7]  *movdi_internal/4
+	movl	%r15d, %ecx	# 6448	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 6451	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC32(%rip), %rsi	# 16590	[c=1 l=7]  *movdi_internal/4
+	cmovne	%rax, %rsi	# 15246	[c=8 l=4]  *movdicc_noc/1
+	call	log_add_data_mov@PLT	# 6452	[c=0 l=5]  *call
+	xorl	%eax, %eax	# 19421	[c=4 l=2]  *movdi_xor
+	movzbl	%r15b, %ecx	# 6454	[c=4 l=4]  *zero_extendqisi2/0
+	movl	%r14d, %edx	# 6456	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC61(%rip), %rsi	# 6457	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 6459	[c=4 l=3]  *movdi_internal/3
+	call	log_append@PLT	# 6461	[c=0 l=5]  *call
+	cmpl	$15, %r14d	# 6464	[c=4 l=4]  *cmpsi_1/0
+	jle	.L1474	# 6465	[c=13 l=6]  *jcc
+	cmpl	$0, 8(%rsp)	# 6479	[c=13 l=5]  *cmpsi_ccno_1/1
+	movb	%r15b, 1004(%r13,%r14)	# 6478	[c=4 l=8]  *movqi_internal/8
+	je	.L1475	# 6480	[c=13 l=6]  *jcc
+.L642:
+	movq	%r13, %rdi	# 6486	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 6485	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 6487	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 17083	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 17084	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 6489	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18284	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 6490	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 6492	[c=4 l=3]  *cmpdi_1/0
+	jb	.L283	# 6493	[c=13 l=6]  *jcc
+	movl	0(%r13), %ebx	# 6495	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 6500	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 6496	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 6498	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 6499	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 6501	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 6502	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 6503	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 6506	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 17085	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 6507	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 6510	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 6511	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 19419	[c=10 l=4]  *indirect_jump
+.L643:
+	movzwl	12(%rbx), %eax	# 6519	[c=13 l=4]  *zero_extendhisi2/0
+	movl	$30, %edx	# 6523	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 6526	[c=4 l=3]  *movdi_internal/3
+	movzwl	1034(%r13), %r15d	# 6521	[c=13 l=8]  *zero_extendhisi2/0
+	leaq	.LC44(%rip), %rsi	# 6524	[c=1 l=7]  *movdi_internal/4
+	movzbl	10(%rbx), %r14d	# 6520	[c=13 l=5]  zero_extendqidi2/0
+	movl	%eax, 8(%rsp)	# 17087	[c=4 l=4]  *movsi_internal/1
+	movl	%r15d, %ecx	# 6522	[c=4 l=3]  *movsi_internal/0
+	xorl	%eax, %eax	# 19418	[c=4 l=2]  *movdi_xor
+	call	log_append@PLT	# 6528	[c=0 l=5]  *call
+	movl	8(%rsp), %eax	# 17088	[c=9 l=4]  *movsi_internal/0
+	leal	(%rax,%r15), %edx	# 18283	[c=4 l=4]  *leasi
+	movl	%edx, %eax	# 17089	[c=4 l=2]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 6530	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 6531	[c=13 l=7]  *cmpsi_1/1
+	jb	.L644	# 6532	[c=13 l=2]  *jcc
+	movl	%edx, %eax	# 17091	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %eax	# 6534	[c=4 l=3]  *ashrsi3_1/0
+	cltq	# 6535	[c=4 l=2]  *extendsidi2_rex64/0
+	cmpb	$0, 1080(%r13,%rax)	# 6536	[c=14 l=9]  *cmpqi_ccno_1/1
+	jne	.L645	# 6537	[c=13 l=6]  *jcc
+.L644:
+	movq	1040(%r13), %rcx	# 6541	[c=9 l=7]  *movdi_internal/3
+	movslq	%edx, %rax	# 6540	[c=4 l=3]  *extendsidi2_rex64/1
+	movzbl	(%rcx,%rax), %r15d	# 6542	[c=13 l=5]  *zero_extendqisi2/0
+.L646:
+	cmpl	$63, %edx	# 15257	[c=4 l=3]  *cmpsi_1/0
+	leaq	.LC33(%rip), %rax	# 16593	[c=1 l=7]  *movdi_internal/4
+	movl	%r15d, %ecx	# 6558	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 6561	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC32(%rip), %rsi	# 16592	[c=1 l=7]  *movdi_internal/4
+	cmovne	%rax, %rsi	# 15258	[c=8 l=4]  *movdicc_noc/1
+	call	log_add_data_mov@PLT	# 6562	[c=0 l=5]  *call
+	xorl	%eax, %eax	# 19417	[c=4 l=2]  *movdi_xor
+	movzbl	%r15b, %ecx	# 6564	[c=4 l=4]  *zero_extendqisi2/0
+	movl	%r14d, %edx	# 6566	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC61(%rip), %rsi	# 6567	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 6569	[c=4 l=3]  *movdi_internal/3
+	call	log_append@PLT	# 6571	[c=0 l=5]  *call
+	cmpl	$15, %r14d	# 6574	[c=4 l=4]  *cmpsi_1/0
+	jle	.L1476	# 6575	[c=13 l=6]  *jcc
+	cmpl	$0, 8(%rsp)	# 6589	[c=13 l=5]  *cmpsi_ccno_1/1
+	movb	%r15b, 1004(%r13,%r14)	# 6588	[c=4 l=8]  *movqi_internal/8
+	je	.L1477	# 6590	[c=13 l=6]  *jcc
+.L649:
+	movq	%r13, %rdi	# 6596	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 6595	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 6597	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 17094	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 17095	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 6599	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18282	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 6600	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 6602	[c=4 l=3]  *cmpdi_1/0
+	jb	.L283	# 6603	[c=13 l=6]  *jcc
+	movl	0(%r13), %ebx	# 6605	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 6610	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 6606	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 6608	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 6609	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 6611	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 6612	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 6613	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 6616	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 17096	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 6617	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 6620	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 6621	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 19415	[c=10 l=4]  *indirect_jump
+.L650:
+	movzwl	12(%rbx), %edx	# 6629	[c=13 l=4]  zero_extendhidi2/0
+	movzbl	10(%rbx), %r14d	# 6631	[c=13 l=5]  zero_extendqidi2/0
+	movl	%edx, %ecx	# 17098	[c=4 l=2]  *movsi_internal/0
+	movq	%rdx, %rax	# 18566	[c=4 l=3]  *movdi_internal/3
+	subl	5176(%r13), %ecx	# 6633	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %ecx	# 6634	[c=13 l=7]  *cmpsi_1/1
+	jb	.L651	# 6635	[c=13 l=2]  *jcc
+	movl	%edx, %ecx	# 17100	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %ecx	# 6637	[c=4 l=3]  *ashrsi3_1/0
+	movslq	%ecx, %rcx	# 6638	[c=4 l=3]  *extendsidi2_rex64/1
+	cmpb	$0, 1080(%r13,%rcx)	# 6639	[c=14 l=9]  *cmpqi_ccno_1/1
+	jne	.L652	# 6640	[c=13 l=6]  *jcc
+.L651:
+	movq	1040(%r13), %rcx	# 6644	[c=9 l=7]  *movdi_internal/3
+	movzbl	(%rcx,%rax), %r15d	# 6645	[c=13 l=5]  *zero_extendqisi2/0
+.L653:
+	cmpl	$63, %edx	# 15269	[c=4 l=3]  *cmpsi_1/0
+	leaq	.LC33(%rip), %rax	# 16595	[c=1 l=7]  *movdi_internal/4
+	movl	%r15d, %ecx	# 6661	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 6664	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC32(%rip), %rsi	# 16594	[c=1 l=7]  *movdi_internal/4
+	cmovne	%rax, %rsi	# 15270	[c=8 l=4]  *movdicc_noc/1
+	call	log_add_data_mov@PLT	# 6665	[c=0 l=5]  *call
+	xorl	%eax, %eax	# 19414	[c=4 l=2]  *movdi_xor
+	movzbl	%r15b, %ecx	# 6667	[c=4 l=4]  *zero_extendqisi2/0
+	movl	%r14d, %edx	# 6669	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC61(%rip), %rsi	# 6670	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 6672	[c=4 l=3]  *movdi_internal/3
+	call	log_append@PLT	# 6674	[c=0 l=5]  *call
+	cmpl	$15, %r14d	# 6677	[c=4 l=4]  *cmpsi_1/0
+	jle	.L1478	# 6678	[c=13 l=6]  *jcc
+	movb	%r15b, 1004(%r13,%r14)	# 6691	[c=4 l=8]  *movqi_internal/8
+	movq	%r13, %rdi	# 6693	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 6692	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 6694	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 17102	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 17103	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 6696	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18281	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 6697	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 6699	[c=4 l=3]  *cmpdi_1/0
+	jb	.L283	# 6700	[c=13 l=6]  *jcc
+	movl	0(%r13), %ebx	# 6702	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 6707	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 6703	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 6705	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 6706	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 6708	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 6709	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 6710	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 6713	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 17104	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 6714	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 6717	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 6718	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 19412	[c=10 l=4]  *indirect_jump
+.L656:
+	movzwl	12(%rbx), %edx	# 6726	[c=13 l=4]  zero_extendhidi2/0
+	movzbl	10(%rbx), %r14d	# 6728	[c=13 l=5]  zero_extendqidi2/0
+	movl	%edx, %ecx	# 17106	[c=4 l=2]  *movsi_internal/0
+	movq	%rdx, %rax	# 18567	[c=4 l=3]  *movdi_internal/3
+	subl	5176(%r13), %ecx	# 6730	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %ecx	# 6731	[c=13 l=7]  *cmpsi_1/1
+	jb	.L657	# 6732	[c=13 l=2]  *jcc
+	movl	%edx, %ecx	# 17108	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %ecx	# 6734	[c=4 l=3]  *ashrsi3_1/0
+	movslq	%ecx, %rcx	# 6735	[c=4 l=3]  *extendsidi2_rex64/1
+	cmpb	$0, 1080(%r13,%rcx)	# 6736	[c=14 l=9]  *cmpqi_ccno_1/1
+	jne	.L658	# 6737	[c=13 l=6]  *jcc
+.L657:
+	movq	1040(%r13), %rcx	# 6741	[c=9 l=7]  *movdi_internal/3
+	movzbl	(%rcx,%rax), %r15d	# 6742	[c=13 l=5]  *zero_extendqisi2/0
+.L659:
+	cmpl	$63, %edx	# 15281	[c=4 l=3]  *cmpsi_1/0
+	leaq	.LC33(%rip), %rax	# 16597	[c=1 l=7]  *movdi_internal/4
+	movl	%r15d, %ecx	# 6758	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 6761	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC32(%rip), %rsi	# 16596	[c=1 l=7]  *movdi_internal/4
+	cmovne	%rax, %rsi	# 15282	[c=8 l=4]  *movdicc_noc/1
+	call	log_add_data_mov@PLT	# 6762	[c=0 l=5]  *call
+	xorl	%eax, %eax	# 19411	[c=4 l=2]  *movdi_xor
+	movzbl	%r15b, %ecx	# 6764	[c=4 l=4]  *zero_extendqisi2/0
+	movl	%r14d, %edx	# 6766	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC61(%rip), %rsi	# 6767	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 6769	[c=4 l=3]  *movdi_internal/3
+	call	log_append@PLT	# 6771	[c=0 l=5]  *call
+	cmpl	$15, %r14d	# 6774	[c=4 l=4]  *cmpsi_1/0
+	jle	.L1479	# 6775	[c=13 l=6]  *jcc
+	movb	%r15b, 1004(%r13,%r14)	# 6788	[c=4 l=8]  *movqi_internal/8
+	movq	%r13, %rdi	# 6790	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 6789	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 6791	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 17110	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 17111	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 6793	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18280	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 6794	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 6796	[c=4 l=3]  *cmpdi_1/0
+	jb	.L283	# 6797	[c=13 l=6]  *jcc
+	movl	0(%r13), %ebx	# 6799	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 6804	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 6800	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 6802	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 6803	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 6805	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 6806	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 6807	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 6810	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 17112	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 6811	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 6814	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 6815	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 19409	[c=10 l=4]  *indirect_jump
+.L662:
+	xorl	%eax, %eax	# 19408	[c=4 l=2]  *movdi_xor
+	movl	$26, %edx	# 6827	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 6830	[c=4 l=3]  *movdi_internal/3
+	movzbl	10(%rbx), %r14d	# 6823	[c=13 l=5]  zero_extendqidi2/0
+	movzwl	1030(%r13), %r8d	# 6824	[c=13 l=8]  *zero_extendhisi2/0
+	leaq	.LC44(%rip), %rsi	# 6828	[c=1 l=7]  *movdi_internal/4
+	movl	%r8d, %ecx	# 6826	[c=4 l=3]  *movsi_internal/0
+	movl	%r8d, 8(%rsp)	# 17890	[c=4 l=5]  *movsi_internal/1
+	movl	%r8d, %r15d	# 18568	[c=4 l=3]  *movsi_internal/0
+	call	log_append@PLT	# 6832	[c=0 l=5]  *call
+	movl	8(%rsp), %r8d	# 17891	[c=9 l=5]  *movsi_internal/0
+	movl	%r8d, %eax	# 17114	[c=4 l=3]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 6834	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 6835	[c=13 l=7]  *cmpsi_1/1
+	jb	.L663	# 6836	[c=13 l=2]  *jcc
+	movl	%r8d, %eax	# 17116	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %eax	# 6838	[c=4 l=3]  *ashrsi3_1/0
+	cltq	# 6839	[c=4 l=2]  *extendsidi2_rex64/0
+	cmpb	$0, 1080(%r13,%rax)	# 6840	[c=14 l=9]  *cmpqi_ccno_1/1
+	jne	.L664	# 6841	[c=13 l=6]  *jcc
+.L663:
+	movq	1040(%r13), %rdx	# 6845	[c=9 l=7]  *movdi_internal/3
+	movzwl	%r15w, %eax	# 6844	[c=4 l=4]  zero_extendhidi2/0
+	movzbl	(%rdx,%rax), %r15d	# 6846	[c=13 l=5]  *zero_extendqisi2/0
+.L665:
+	cmpl	$63, %r8d	# 15293	[c=4 l=4]  *cmpsi_1/0
+	movl	%r15d, %ecx	# 6862	[c=4 l=3]  *movsi_internal/0
+	movl	%r8d, %edx	# 6863	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 6865	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC33(%rip), %rax	# 16599	[c=1 l=7]  *movdi_internal/4
+	leaq	.LC32(%rip), %rsi	# 16598	[c=1 l=7]  *movdi_internal/4
+	cmovne	%rax, %rsi	# 15294	[c=8 l=4]  *movdicc_noc/1
+	call	log_add_data_mov@PLT	# 6866	[c=0 l=5]  *call
+	xorl	%eax, %eax	# 19407	[c=4 l=2]  *movdi_xor
+	movzbl	%r15b, %ecx	# 6868	[c=4 l=4]  *zero_extendqisi2/0
+	movl	%r14d, %edx	# 6870	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC61(%rip), %rsi	# 6871	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 6873	[c=4 l=3]  *movdi_internal/3
+	call	log_append@PLT	# 6875	[c=0 l=5]  *call
+	cmpl	$15, %r14d	# 6878	[c=4 l=4]  *cmpsi_1/0
+	jle	.L1480	# 6879	[c=13 l=6]  *jcc
+	movb	%r15b, 1004(%r13,%r14)	# 6892	[c=4 l=8]  *movqi_internal/8
+	movq	%r13, %rdi	# 6895	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 6894	[c=4 l=3]  *movdi_internal/3
+	subq	$1, 48(%r13)	# 6893	[c=13 l=5]  *adddi_1/0
+	call	log_dump_line@PLT	# 6896	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 17118	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 17119	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 6898	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18279	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 6899	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 6901	[c=4 l=3]  *cmpdi_1/0
+	jb	.L283	# 6902	[c=13 l=6]  *jcc
+	movl	0(%r13), %ebx	# 6904	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 6909	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 6905	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 6907	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 6908	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 6910	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 6911	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 6912	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 6915	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 17120	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 6916	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 6919	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 6920	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 19405	[c=10 l=4]  *indirect_jump
+.L668:
+	xorl	%eax, %eax	# 19404	[c=4 l=2]  *movdi_xor
+	movl	$26, %edx	# 6931	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 6934	[c=4 l=3]  *movdi_internal/3
+	movzbl	10(%rbx), %r14d	# 6928	[c=13 l=5]  zero_extendqidi2/0
+	movzwl	1030(%r13), %r15d	# 6929	[c=13 l=8]  *zero_extendhisi2/0
+	leaq	.LC44(%rip), %rsi	# 6932	[c=1 l=7]  *movdi_internal/4
+	movl	%r15d, %ecx	# 6930	[c=4 l=3]  *movsi_internal/0
+	subl	$1, %r15d	# 6937	[c=4 l=4]  *addsi_1/0
+	call	log_append@PLT	# 6936	[c=0 l=5]  *call
+	movl	%r15d, %eax	# 17122	[c=4 l=3]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 6938	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 6939	[c=13 l=7]  *cmpsi_1/1
+	jb	.L669	# 6940	[c=13 l=2]  *jcc
+	movl	%r15d, %eax	# 17124	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %eax	# 6942	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 16525	[c=5 l=5]  *andsi_1_zext
+	cmpb	$0, 1080(%r13,%rax)	# 6945	[c=14 l=9]  *cmpqi_ccno_1/1
+	jne	.L670	# 6946	[c=13 l=6]  *jcc
+.L669:
+	movq	1040(%r13), %rdx	# 6950	[c=9 l=7]  *movdi_internal/3
+	movslq	%r15d, %rax	# 6949	[c=4 l=3]  *extendsidi2_rex64/1
+	movzbl	(%rdx,%rax), %eax	# 6951	[c=13 l=4]  *zero_extendqisi2/0
+	movl	%eax, 8(%rsp)	# 17126	[c=4 l=4]  *movsi_internal/1
+.L671:
+	cmpl	$63, %r15d	# 15305	[c=4 l=4]  *cmpsi_1/0
+	movl	8(%rsp), %ecx	# 6967	[c=9 l=4]  *movsi_internal/0
+	movl	%r15d, %edx	# 6968	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 6970	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC33(%rip), %rax	# 16601	[c=1 l=7]  *movdi_internal/4
+	leaq	.LC32(%rip), %rsi	# 16600	[c=1 l=7]  *movdi_internal/4
+	cmovne	%rax, %rsi	# 15306	[c=8 l=4]  *movdicc_noc/1
+	call	log_add_data_mov@PLT	# 6971	[c=0 l=5]  *call
+	movzbl	8(%rsp), %ecx	# 6973	[c=13 l=5]  *zero_extendqisi2/0
+	xorl	%eax, %eax	# 19403	[c=4 l=2]  *movdi_xor
+	movl	%r14d, %edx	# 6975	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC61(%rip), %rsi	# 6976	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 6978	[c=4 l=3]  *movdi_internal/3
+	call	log_append@PLT	# 6980	[c=0 l=5]  *call
+	cmpl	$15, %r14d	# 6983	[c=4 l=4]  *cmpsi_1/0
+	jle	.L1481	# 6984	[c=13 l=6]  *jcc
+	movzbl	8(%rsp), %eax	# 17127	[c=9 l=5]  *movqi_internal/4
+	movl	$26, %edx	# 7000	[c=4 l=5]  *movsi_internal/0
+	movzwl	%r15w, %ecx	# 6998	[c=4 l=4]  *zero_extendhisi2/0
+	movq	%r13, %rdi	# 7003	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC48(%rip), %rsi	# 7001	[c=1 l=7]  *movdi_internal/4
+	movb	%al, 1004(%r13,%r14)	# 6997	[c=4 l=8]  *movqi_internal/8
+	xorl	%eax, %eax	# 19401	[c=4 l=2]  *movdi_xor
+	call	log_append@PLT	# 7005	[c=0 l=5]  *call
+	movw	%r15w, 1030(%r13)	# 7006	[c=4 l=8]  *movhi_internal/3
+	movq	%r13, %rdi	# 7008	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 7007	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 7009	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 17128	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 17129	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 7011	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18278	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 7012	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 7014	[c=4 l=3]  *cmpdi_1/0
+	jb	.L283	# 7015	[c=13 l=6]  *jcc
+	movl	0(%r13), %ebx	# 7017	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 7022	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 7018	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 7020	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 7021	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 7023	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 7024	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 7025	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 7028	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 17130	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 7029	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 7032	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 7033	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 19400	[c=10 l=4]  *indirect_jump
+.L674:
+	xorl	%eax, %eax	# 19399	[c=4 l=2]  *movdi_xor
+	movl	$26, %edx	# 7045	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 7048	[c=4 l=3]  *movdi_internal/3
+	movzbl	10(%rbx), %r14d	# 7041	[c=13 l=5]  zero_extendqidi2/0
+	movzwl	1030(%r13), %r8d	# 7042	[c=13 l=8]  *zero_extendhisi2/0
+	leaq	.LC44(%rip), %rsi	# 7046	[c=1 l=7]  *movdi_internal/4
+	movl	%r8d, %ecx	# 7044	[c=4 l=3]  *movsi_internal/0
+	movl	%r8d, 8(%rsp)	# 17895	[c=4 l=5]  *movsi_internal/1
+	movl	%r8d, %r15d	# 18569	[c=4 l=3]  *movsi_internal/0
+	call	log_append@PLT	# 7050	[c=0 l=5]  *call
+	movl	8(%rsp), %r8d	# 17896	[c=9 l=5]  *movsi_internal/0
+	movl	%r8d, %eax	# 17132	[c=4 l=3]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 7052	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 7053	[c=13 l=7]  *cmpsi_1/1
+	jb	.L675	# 7054	[c=13 l=2]  *jcc
+	movl	%r8d, %eax	# 17134	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %eax	# 7056	[c=4 l=3]  *ashrsi3_1/0
+	cltq	# 7057	[c=4 l=2]  *extendsidi2_rex64/0
+	cmpb	$0, 1080(%r13,%rax)	# 7058	[c=14 l=9]  *cmpqi_ccno_1/1
+	jne	.L676	# 7059	[c=13 l=6]  *jcc
+.L675:
+	movq	1040(%r13), %rdx	# 7063	[c=9 l=7]  *movdi_internal/3
+	movzwl	%r15w, %eax	# 7062	[c=4 l=4]  zero_extendhidi2/0
+	movzbl	(%rdx,%rax), %r15d	# 7064	[c=13 l=5]  *zero_extendqisi2/0
+.L677:
+	cmpl	$63, %r8d	# 15317	[c=4 l=4]  *cmpsi_1/0
+	movl	%r8d, %edx	# 7081	[c=4 l=3]  *movsi_internal/0
+	movl	%r15d, %ecx	# 7080	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 7083	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC33(%rip), %rax	# 16603	[c=1 l=7]  *movdi_internal/4
+	leaq	.LC32(%rip), %rsi	# 16602	[c=1 l=7]  *movdi_internal/4
+	movl	%r8d, 8(%rsp)	# 17899	[c=4 l=5]  *movsi_internal/1
+	cmovne	%rax, %rsi	# 15318	[c=8 l=4]  *movdicc_noc/1
+	call	log_add_data_mov@PLT	# 7084	[c=0 l=5]  *call
+	xorl	%eax, %eax	# 19398	[c=4 l=2]  *movdi_xor
+	movzbl	%r15b, %ecx	# 7086	[c=4 l=4]  *zero_extendqisi2/0
+	movl	%r14d, %edx	# 7088	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC61(%rip), %rsi	# 7089	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 7091	[c=4 l=3]  *movdi_internal/3
+	call	log_append@PLT	# 7093	[c=0 l=5]  *call
+	cmpl	$15, %r14d	# 7096	[c=4 l=4]  *cmpsi_1/0
+	movl	8(%rsp), %r8d	# 17900	[c=9 l=5]  *movsi_internal/0
+	jle	.L1482	# 7097	[c=13 l=6]  *jcc
+	movb	%r15b, 1004(%r13,%r14)	# 7110	[c=4 l=8]  *movqi_internal/8
+	leal	1(%r8), %r14d	# 18276	[c=4 l=4]  *leasi
+	xorl	%eax, %eax	# 19396	[c=4 l=2]  *movdi_xor
+	movq	%r13, %rdi	# 7118	[c=4 l=3]  *movdi_internal/3
+	subq	$1, 48(%r13)	# 7111	[c=13 l=5]  *adddi_1/0
+	movl	$26, %edx	# 7115	[c=4 l=5]  *movsi_internal/0
+	movzwl	%r14w, %ecx	# 7113	[c=4 l=4]  *zero_extendhisi2/0
+	leaq	.LC48(%rip), %rsi	# 7116	[c=1 l=7]  *movdi_internal/4
+	call	log_append@PLT	# 7120	[c=0 l=5]  *call
+	movw	%r14w, 1030(%r13)	# 7121	[c=4 l=8]  *movhi_internal/3
+	movq	%r13, %rdi	# 7123	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 7122	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 7124	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 17136	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 17137	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 7126	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18277	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 7127	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 7129	[c=4 l=3]  *cmpdi_1/0
+	jb	.L283	# 7130	[c=13 l=6]  *jcc
+	movl	0(%r13), %ebx	# 7132	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 7137	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 7133	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 7135	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 7136	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 7138	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 7139	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 7140	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 7143	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 17138	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 7144	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 7147	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 7148	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 19395	[c=10 l=4]  *indirect_jump
+.L680:
+	xorl	%eax, %eax	# 19394	[c=4 l=2]  *movdi_xor
+	movl	$28, %edx	# 7159	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 7162	[c=4 l=3]  *movdi_internal/3
+	movzbl	10(%rbx), %r14d	# 7156	[c=13 l=5]  zero_extendqidi2/0
+	movzwl	1032(%r13), %r15d	# 7157	[c=13 l=8]  *zero_extendhisi2/0
+	leaq	.LC44(%rip), %rsi	# 7160	[c=1 l=7]  *movdi_internal/4
+	movl	%r15d, %ecx	# 7158	[c=4 l=3]  *movsi_internal/0
+	subl	$1, %r15d	# 7165	[c=4 l=4]  *addsi_1/0
+	call	log_append@PLT	# 7164	[c=0 l=5]  *call
+	movl	%r15d, %eax	# 17140	[c=4 l=3]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 7166	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 7167	[c=13 l=7]  *cmpsi_1/1
+	jb	.L681	# 7168	[c=13 l=2]  *jcc
+	movl	%r15d, %eax	# 17142	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %eax	# 7170	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 16524	[c=5 l=5]  *andsi_1_zext
+	cmpb	$0, 1080(%r13,%rax)	# 7173	[c=14 l=9]  *cmpqi_ccno_1/1
+	jne	.L682	# 7174	[c=13 l=6]  *jcc
+.L681:
+	movq	1040(%r13), %rdx	# 7178	[c=9 l=7]  *movdi_internal/3
+	movslq	%r15d, %rax	# 7177	[c=4 l=3]  *extendsidi2_rex64/1
+	movzbl	(%rdx,%rax), %eax	# 7179	[c=13 l=4]  *zero_extendqisi2/0
+	movl	%eax, 8(%rsp)	# 17144	[c=4 l=4]  *movsi_internal/1
+.L683:
+	cmpl	$63, %r15d	# 15329	[c=4 l=4]  *cmpsi_1/0
+	movl	8(%rsp), %ecx	# 7195	[c=9 l=4]  *movsi_internal/0
+	movl	%r15d, %edx	# 7196	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 7198	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC33(%rip), %rax	# 16605	[c=1 l=7]  *movdi_internal/4
+	leaq	.LC32(%rip), %rsi	# 16604	[c=1 l=7]  *movdi_internal/4
+	cmovne	%rax, %rsi	# 15330	[c=8 l=4]  *movdicc_noc/1
+	call	log_add_data_mov@PLT	# 7199	[c=0 l=5]  *call
+	movzbl	8(%rsp), %ecx	# 7201	[c=13 l=5]  *zero_extendqisi2/0
+	xorl	%eax, %eax	# 19393	[c=4 l=2]  *movdi_xor
+	movl	%r14d, %edx	# 7203	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC61(%rip), %rsi	# 7204	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 7206	[c=4 l=3]  *movdi_internal/3
+	call	log_append@PLT	# 7208	[c=0 l=5]  *call
+	cmpl	$15, %r14d	# 7211	[c=4 l=4]  *cmpsi_1/0
+	jle	.L1483	# 7212	[c=13 l=6]  *jcc
+	movzbl	8(%rsp), %eax	# 17145	[c=9 l=5]  *movqi_internal/4
+	movl	$28, %edx	# 7228	[c=4 l=5]  *movsi_internal/0
+	movzwl	%r15w, %ecx	# 7226	[c=4 l=4]  *zero_extendhisi2/0
+	movq	%r13, %rdi	# 7231	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC48(%rip), %rsi	# 7229	[c=1 l=7]  *movdi_internal/4
+	movb	%al, 1004(%r13,%r14)	# 7225	[c=4 l=8]  *movqi_internal/8
+	xorl	%eax, %eax	# 19391	[c=4 l=2]  *movdi_xor
+	call	log_append@PLT	# 7233	[c=0 l=5]  *call
+	movw	%r15w, 1032(%r13)	# 7234	[c=4 l=8]  *movhi_internal/3
+	movq	%r13, %rdi	# 7236	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 7235	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 7237	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 17146	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 17147	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 7239	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18275	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 7240	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 7242	[c=4 l=3]  *cmpdi_1/0
+	jb	.L283	# 7243	[c=13 l=6]  *jcc
+	movl	0(%r13), %ebx	# 7245	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 7250	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 7246	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 7248	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 7249	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 7251	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 7252	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 7253	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 7256	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 17148	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 7257	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 7260	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 7261	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 19390	[c=10 l=4]  *indirect_jump
+.L686:
+	xorl	%eax, %eax	# 19389	[c=4 l=2]  *movdi_xor
+	movl	$28, %edx	# 7273	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 7276	[c=4 l=3]  *movdi_internal/3
+	movzbl	10(%rbx), %r14d	# 7269	[c=13 l=5]  zero_extendqidi2/0
+	movzwl	1032(%r13), %r8d	# 7270	[c=13 l=8]  *zero_extendhisi2/0
+	leaq	.LC44(%rip), %rsi	# 7274	[c=1 l=7]  *movdi_internal/4
+	movl	%r8d, %ecx	# 7272	[c=4 l=3]  *movsi_internal/0
+	movl	%r8d, 8(%rsp)	# 17902	[c=4 l=5]  *movsi_internal/1
+	movl	%r8d, %r15d	# 18570	[c=4 l=3]  *movsi_internal/0
+	call	log_append@PLT	# 7278	[c=0 l=5]  *call
+	movl	8(%rsp), %r8d	# 17903	[c=9 l=5]  *movsi_internal/0
+	movl	%r8d, %eax	# 17150	[c=4 l=3]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 7280	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 7281	[c=13 l=7]  *cmpsi_1/1
+	jb	.L687	# 7282	[c=13 l=2]  *jcc
+	movl	%r8d, %eax	# 17152	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %eax	# 7284	[c=4 l=3]  *ashrsi3_1/0
+	cltq	# 7285	[c=4 l=2]  *extendsidi2_rex64/0
+	cmpb	$0, 1080(%r13,%rax)	# 7286	[c=14 l=9]  *cmpqi_ccno_1/1
+	jne	.L688	# 7287	[c=13 l=6]  *jcc
+.L687:
+	movq	1040(%r13), %rdx	# 7291	[c=9 l=7]  *movdi_internal/3
+	movzwl	%r15w, %eax	# 7290	[c=4 l=4]  zero_extendhidi2/0
+	movzbl	(%rdx,%rax), %r15d	# 7292	[c=13 l=5]  *zero_extendqisi2/0
+.L689:
+	cmpl	$63, %r8d	# 15341	[c=4 l=4]  *cmpsi_1/0
+	movl	%r8d, %edx	# 7309	[c=4 l=3]  *movsi_internal/0
+	movl	%r15d, %ecx	# 7308	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 7311	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC33(%rip), %rax	# 16607	[c=1 l=7]  *movdi_internal/4
+	leaq	.LC32(%rip), %rsi	# 16606	[c=1 l=7]  *movdi_internal/4
+	movl	%r8d, 8(%rsp)	# 17906	[c=4 l=5]  *movsi_internal/1
+	cmovne	%rax, %rsi	# 15342	[c=8 l=4]  *movdicc_noc/1
+	call	log_add_data_mov@PLT	# 7312	[c=0 l=5]  *call
+	xorl	%eax, %eax	# 19388	[c=4 l=2]  *movdi_xor
+	movzbl	%r15b, %ecx	# 7314	[c=4 l=4]  *zero_extendqisi2/0
+	movl	%r14d, %edx	# 7316	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC61(%rip), %rsi	# 7317	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 7319	[c=4 l=3]  *movdi_internal/3
+	call	log_append@PLT	# 7321	[c=0 l=5]  *call
+	cmpl	$15, %r14d	# 7324	[c=4 l=4]  *cmpsi_1/0
+	movl	8(%rsp), %r8d	# 17907	[c=9 l=5]  *movsi_internal/0
+	jle	.L1484	# 7325	[c=13 l=6]  *jcc
+	movb	%r15b, 1004(%r13,%r14)	# 7338	[c=4 l=8]  *movqi_internal/8
+	leal	1(%r8), %r14d	# 18273	[c=4 l=4]  *leasi
+	xorl	%eax, %eax	# 19386	[c=4 l=2]  *movdi_xor
+	movq	%r13, %rdi	# 7346	[c=4 l=3]  *movdi_internal/3
+	subq	$1, 48(%r13)	# 7339	[c=13 l=5]  *adddi_1/0
+	movl	$28, %edx	# 7343	[c=4 l=5]  *movsi_internal/0
+	movzwl	%r14w, %ecx	# 7341	[c=4 l=4]  *zero_extendhisi2/0
+	leaq	.LC48(%rip), %rsi	# 7344	[c=1 l=7]  *movdi_internal/4
+	call	log_append@PLT	# 7348	[c=0 l=5]  *call
+	movw	%r14w, 1032(%r13)	# 7349	[c=4 l=8]  *movhi_internal/3
+	movq	%r13, %rdi	# 7351	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 7350	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 7352	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 17154	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 17155	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 7354	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18274	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 7355	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 7357	[c=4 l=3]  *cmpdi_1/0
+	jb	.L283	# 7358	[c=13 l=6]  *jcc
+	movl	0(%r13), %ebx	# 7360	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 7365	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 7361	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 7363	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 7364	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 7366	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 7367	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 7368	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 7371	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 17156	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 7372	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 7375	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 7376	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 19385	[c=10 l=4]  *indirect_jump
+.L692:
+	xorl	%eax, %eax	# 19384	[c=4 l=2]  *movdi_xor
+	movl	$30, %edx	# 7387	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 7390	[c=4 l=3]  *movdi_internal/3
+	movzbl	10(%rbx), %r14d	# 7384	[c=13 l=5]  zero_extendqidi2/0
+	movzwl	1034(%r13), %r15d	# 7385	[c=13 l=8]  *zero_extendhisi2/0
+	leaq	.LC44(%rip), %rsi	# 7388	[c=1 l=7]  *movdi_internal/4
+	movl	%r15d, %ecx	# 7386	[c=4 l=3]  *movsi_internal/0
+	subl	$1, %r15d	# 7393	[c=4 l=4]  *addsi_1/0
+	call	log_append@PLT	# 7392	[c=0 l=5]  *call
+	movl	%r15d, %eax	# 17158	[c=4 l=3]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 7394	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 7395	[c=13 l=7]  *cmpsi_1/1
+	jb	.L693	# 7396	[c=13 l=2]  *jcc
+	movl	%r15d, %eax	# 17160	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %eax	# 7398	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 16523	[c=5 l=5]  *andsi_1_zext
+	cmpb	$0, 1080(%r13,%rax)	# 7401	[c=14 l=9]  *cmpqi_ccno_1/1
+	jne	.L694	# 7402	[c=13 l=6]  *jcc
+.L693:
+	movq	1040(%r13), %rdx	# 7406	[c=9 l=7]  *movdi_internal/3
+	movslq	%r15d, %rax	# 7405	[c=4 l=3]  *extendsidi2_rex64/1
+	movzbl	(%rdx,%rax), %eax	# 7407	[c=13 l=4]  *zero_extendqisi2/0
+	movl	%eax, 8(%rsp)	# 17162	[c=4 l=4]  *movsi_internal/1
+.L695:
+	cmpl	$63, %r15d	# 15353	[c=4 l=4]  *cmpsi_1/0
+	movl	8(%rsp), %ecx	# 7423	[c=9 l=4]  *movsi_internal/0
+	movl	%r15d, %edx	# 7424	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 7426	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC33(%rip), %rax	# 16609	[c=1 l=7]  *movdi_internal/4
+	leaq	.LC32(%rip), %rsi	# 16608	[c=1 l=7]  *movdi_internal/4
+	cmovne	%rax, %rsi	# 15354	[c=8 l=4]  *movdicc_noc/1
+	call	log_add_data_mov@PLT	# 7427	[c=0 l=5]  *call
+	movzbl	8(%rsp), %ecx	# 7429	[c=13 l=5]  *zero_extendqisi2/0
+	xorl	%eax, %eax	# 19383	[c=4 l=2]  *movdi_xor
+	movl	%r14d, %edx	# 7431	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC61(%rip), %rsi	# 7432	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 7434	[c=4 l=3]  *movdi_internal/3
+	call	log_append@PLT	# 7436	[c=0 l=5]  *call
+	cmpl	$15, %r14d	# 7439	[c=4 l=4]  *cmpsi_1/0
+	jle	.L1485	# 7440	[c=13 l=6]  *jcc
+	movzbl	8(%rsp), %eax	# 17163	[c=9 l=5]  *movqi_internal/4
+	movl	$30, %edx	# 7456	[c=4 l=5]  *movsi_internal/0
+	movzwl	%r15w, %ecx	# 7454	[c=4 l=4]  *zero_extendhisi2/0
+	movq	%r13, %rdi	# 7459	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC48(%rip), %rsi	# 7457	[c=1 l=7]  *movdi_internal/4
+	movb	%al, 1004(%r13,%r14)	# 7453	[c=4 l=8]  *movqi_internal/8
+	xorl	%eax, %eax	# 19381	[c=4 l=2]  *movdi_xor
+	call	log_append@PLT	# 7461	[c=0 l=5]  *call
+	movw	%r15w, 1034(%r13)	# 7462	[c=4 l=8]  *movhi_internal/3
+	movq	%r13, %rdi	# 7464	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 7463	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 7465	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 17164	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 17165	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 7467	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18272	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 7468	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 7470	[c=4 l=3]  *cmpdi_1/0
+	jb	.L283	# 7471	[c=13 l=6]  *jcc
+	movl	0(%r13), %ebx	# 7473	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 7478	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 7474	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 7476	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 7477	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 7479	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 7480	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 7481	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 7484	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 17166	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 7485	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 7488	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 7489	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 19380	[c=10 l=4]  *indirect_jump
+.L698:
+	xorl	%eax, %eax	# 19379	[c=4 l=2]  *movdi_xor
+	movl	$30, %edx	# 7501	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 7504	[c=4 l=3]  *movdi_internal/3
+	movzbl	10(%rbx), %r14d	# 7497	[c=13 l=5]  zero_extendqidi2/0
+	movzwl	1034(%r13), %r8d	# 7498	[c=13 l=8]  *zero_extendhisi2/0
+	leaq	.LC44(%rip), %rsi	# 7502	[c=1 l=7]  *movdi_internal/4
+	movl	%r8d, %ecx	# 7500	[c=4 l=3]  *movsi_internal/0
+	movl	%r8d, 8(%rsp)	# 17909	[c=4 l=5]  *movsi_internal/1
+	movl	%r8d, %r15d	# 18571	[c=4 l=3]  *movsi_internal/0
+	call	log_append@PLT	# 7506	[c=0 l=5]  *call
+	movl	8(%rsp), %r8d	# 17910	[c=9 l=5]  *movsi_internal/0
+	movl	%r8d, %eax	# 17168	[c=4 l=3]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 7508	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 7509	[c=13 l=7]  *cmpsi_1/1
+	jb	.L699	# 7510	[c=13 l=2]  *jcc
+	movl	%r8d, %eax	# 17170	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %eax	# 7512	[c=4 l=3]  *ashrsi3_1/0
+	cltq	# 7513	[c=4 l=2]  *extendsidi2_rex64/0
+	cmpb	$0, 1080(%r13,%rax)	# 7514	[c=14 l=9]  *cmpqi_ccno_1/1
+	jne	.L700	# 7515	[c=13 l=6]  *jcc
+.L699:
+	movq	1040(%r13), %rdx	# 7519	[c=9 l=7]  *movdi_internal/3
+	movzwl	%r15w, %eax	# 7518	[c=4 l=4]  zero_extendhidi2/0
+	movzbl	(%rdx,%rax), %r15d	# 7520	[c=13 l=5]  *zero_extendqisi2/0
+.L701:
+	cmpl	$63, %r8d	# 15365	[c=4 l=4]  *cmpsi_1/0
+	movl	%r8d, %edx	# 7537	[c=4 l=3]  *movsi_internal/0
+	movl	%r15d, %ecx	# 7536	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 7539	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC33(%rip), %rax	# 16611	[c=1 l=7]  *movdi_internal/4
+	leaq	.LC32(%rip), %rsi	# 16610	[c=1 l=7]  *movdi_internal/4
+	movl	%r8d, 8(%rsp)	# 17913	[c=4 l=5]  *movsi_internal/1
+	cmovne	%rax, %rsi	# 15366	[c=8 l=4]  *movdicc_noc/1
+	call	log_add_data_mov@PLT	# 7540	[c=0 l=5]  *call
+	xorl	%eax, %eax	# 19378	[c=4 l=2]  *movdi_xor
+	movzbl	%r15b, %ecx	# 7542	[c=4 l=4]  *zero_extendqisi2/0
+	movl	%r14d, %edx	# 7544	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC61(%rip), %rsi	# 7545	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 7547	[c=4 l=3]  *movdi_internal/3
+	call	log_append@PLT	# 7549	[c=0 l=5]  *call
+	cmpl	$15, %r14d	# 7552	[c=4 l=4]  *cmpsi_1/0
+	movl	8(%rsp), %r8d	# 17914	[c=9 l=5]  *movsi_internal/0
+	jle	.L1486	# 7553	[c=13 l=6]  *jcc
+	movb	%r15b, 1004(%r13,%r14)	# 7566	[c=4 l=8]  *movqi_internal/8
+	leal	1(%r8), %r14d	# 18270	[c=4 l=4]  *leasi
+	xorl	%eax, %eax	# 19376	[c=4 l=2]  *movdi_xor
+	movq	%r13, %rdi	# 7574	[c=4 l=3]  *movdi_internal/3
+	subq	$1, 48(%r13)	# 7567	[c=13 l=5]  *adddi_1/0
+	movl	$30, %edx	# 7571	[c=4 l=5]  *movsi_internal/0
+	movzwl	%r14w, %ecx	# 7569	[c=4 l=4]  *zero_extendhisi2/0
+	leaq	.LC48(%rip), %rsi	# 7572	[c=1 l=7]  *movdi_internal/4
+	call	log_append@PLT	# 7576	[c=0 l=5]  *call
+	movw	%r14w, 1034(%r13)	# 7577	[c=4 l=8]  *movhi_internal/3
+	movq	%r13, %rdi	# 7579	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 7578	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 7580	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 17172	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 17173	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 7582	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18271	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 7583	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 7585	[c=4 l=3]  *cmpdi_1/0
+	jb	.L283	# 7586	[c=13 l=6]  *jcc
+	movl	0(%r13), %ebx	# 7588	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 7593	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 7589	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 7591	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 7592	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 7594	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 7595	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 7596	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 7599	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 17174	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 7600	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 7603	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 7604	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 19375	[c=10 l=4]  *indirect_jump
+.L704:
+	movzwl	1034(%r13), %ebx	# 7612	[c=13 l=8]  *zero_extendhisi2/0
+	movl	$30, %edx	# 7614	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 7617	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 19370	[c=4 l=2]  *movdi_xor
+	leaq	.LC44(%rip), %rsi	# 7615	[c=1 l=7]  *movdi_internal/4
+	movl	%ebx, %ecx	# 7613	[c=4 l=2]  *movsi_internal/0
+	call	log_append@PLT	# 7619	[c=0 l=5]  *call
+	movl	992(%r13), %eax	# 7620	[c=9 l=7]  *movsi_internal/0
+	movq	1056(%r13), %rdx	# 7625	[c=9 l=7]  *movdi_internal/3
+	movq	%r13, %rdi	# 7631	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC61(%rip), %rsi	# 7629	[c=1 l=7]  *movdi_internal/4
+	leal	1(%rax,%rax), %eax	# 7622	[c=8 l=4]  *leasi
+	andl	%ebx, %eax	# 7623	[c=4 l=2]  *andsi_1/0
+	cltq	# 7624	[c=4 l=2]  *extendsidi2_rex64/0
+	movzbl	(%rdx,%rax), %ecx	# 7626	[c=13 l=4]  *zero_extendqisi2/0
+	xorl	%edx, %edx	# 19371	[c=4 l=2]  *movdi_xor
+	xorl	%eax, %eax	# 19372	[c=4 l=2]  *movdi_xor
+	call	log_append@PLT	# 7633	[c=0 l=5]  *call
+	xorl	%ecx, %ecx	# 19373	[c=4 l=2]  *movdi_xor
+	leaq	.LC60(%rip), %rdx	# 7635	[c=1 l=7]  *movdi_internal/4
+	xorl	%eax, %eax	# 19374	[c=4 l=2]  *movdi_xor
+	movl	$1, %esi	# 7637	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 7638	[c=4 l=3]  *movdi_internal/3
+	call	leave	# 7640	[c=0 l=5]  *call
+.L705:
+	xorl	%eax, %eax	# 19368	[c=4 l=2]  *movdi_xor
+	movl	$30, %edx	# 7647	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 7650	[c=4 l=3]  *movdi_internal/3
+	movzbl	10(%rbx), %r14d	# 7644	[c=13 l=5]  zero_extendqidi2/0
+	movzwl	1034(%r13), %r15d	# 7645	[c=13 l=8]  *zero_extendhisi2/0
+	leaq	.LC44(%rip), %rsi	# 7648	[c=1 l=7]  *movdi_internal/4
+	movl	%r15d, %ecx	# 7646	[c=4 l=3]  *movsi_internal/0
+	call	log_append@PLT	# 7652	[c=0 l=5]  *call
+	movl	992(%r13), %eax	# 7653	[c=9 l=7]  *movsi_internal/0
+	movq	1056(%r13), %rdx	# 7658	[c=9 l=7]  *movdi_internal/3
+	movq	%r13, %rdi	# 7665	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC61(%rip), %rsi	# 7663	[c=1 l=7]  *movdi_internal/4
+	leal	1(%rax,%rax), %eax	# 7655	[c=8 l=4]  *leasi
+	andl	%r15d, %eax	# 7656	[c=4 l=3]  *andsi_1/0
+	cltq	# 7657	[c=4 l=2]  *extendsidi2_rex64/0
+	movzbl	(%rdx,%rax), %ecx	# 7659	[c=13 l=4]  *zero_extendqisi2/0
+	xorl	%eax, %eax	# 19369	[c=4 l=2]  *movdi_xor
+	movl	%r14d, %edx	# 7662	[c=4 l=3]  *movsi_internal/0
+	movl	%ecx, %r15d	# 18572	[c=4 l=3]  *movsi_internal/0
+	call	log_append@PLT	# 7667	[c=0 l=5]  *call
+	cmpl	$15, %r14d	# 7670	[c=4 l=4]  *cmpsi_1/0
+	jle	.L1487	# 7671	[c=13 l=6]  *jcc
+	movb	%r15b, 1004(%r13,%r14)	# 7684	[c=4 l=8]  *movqi_internal/8
+	movq	%r13, %rdi	# 7686	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 7685	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 7687	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 17176	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 17177	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 7689	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18269	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 7690	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 7692	[c=4 l=3]  *cmpdi_1/0
+	jb	.L283	# 7693	[c=13 l=6]  *jcc
+	movl	0(%r13), %ebx	# 7695	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 7700	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 7696	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 7698	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 7699	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 7701	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 7702	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 7703	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 7706	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 17178	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 7707	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 7710	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 7711	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 19366	[c=10 l=4]  *indirect_jump
+.L707:
+	xorl	%eax, %eax	# 19364	[c=4 l=2]  *movdi_xor
+	movl	$30, %edx	# 7722	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 7725	[c=4 l=3]  *movdi_internal/3
+	movzbl	10(%rbx), %r15d	# 7719	[c=13 l=5]  zero_extendqidi2/0
+	movzwl	1034(%r13), %r14d	# 7720	[c=13 l=8]  *zero_extendhisi2/0
+	leaq	.LC44(%rip), %rsi	# 7723	[c=1 l=7]  *movdi_internal/4
+	movl	%r14d, %ecx	# 7721	[c=4 l=3]  *movsi_internal/0
+	call	log_append@PLT	# 7727	[c=0 l=5]  *call
+	movl	992(%r13), %eax	# 7728	[c=9 l=7]  *movsi_internal/0
+	movq	1056(%r13), %rdx	# 7733	[c=9 l=7]  *movdi_internal/3
+	movq	%r13, %rdi	# 7740	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC61(%rip), %rsi	# 7738	[c=1 l=7]  *movdi_internal/4
+	leal	1(%rax,%rax), %eax	# 7730	[c=8 l=4]  *leasi
+	andl	%r14d, %eax	# 7731	[c=4 l=3]  *andsi_1/0
+	cltq	# 7732	[c=4 l=2]  *extendsidi2_rex64/0
+	movzbl	(%rdx,%rax), %ecx	# 7734	[c=13 l=4]  *zero_extendqisi2/0
+	xorl	%eax, %eax	# 19365	[c=4 l=2]  *movdi_xor
+	movl	%r15d, %edx	# 7737	[c=4 l=3]  *movsi_internal/0
+	movb	%cl, 8(%rsp)	# 17915	[c=4 l=4]  *movqi_internal/8
+	call	log_append@PLT	# 7742	[c=0 l=5]  *call
+	cmpl	$15, %r15d	# 7745	[c=4 l=4]  *cmpsi_1/0
+	movzbl	8(%rsp), %r8d	# 17916	[c=9 l=6]  *movqi_internal/4
+	jle	.L1488	# 7746	[c=13 l=6]  *jcc
+	addl	$1, %r14d	# 7760	[c=4 l=4]  *addsi_1/0
+	movl	$30, %edx	# 7763	[c=4 l=5]  *movsi_internal/0
+	xorl	%eax, %eax	# 19362	[c=4 l=2]  *movdi_xor
+	movq	%r13, %rdi	# 7766	[c=4 l=3]  *movdi_internal/3
+	movb	%r8b, 1004(%r13,%r15)	# 7759	[c=4 l=8]  *movqi_internal/8
+	movzwl	%r14w, %ecx	# 7761	[c=4 l=4]  *zero_extendhisi2/0
+	leaq	.LC48(%rip), %rsi	# 7764	[c=1 l=7]  *movdi_internal/4
+	call	log_append@PLT	# 7768	[c=0 l=5]  *call
+	movw	%r14w, 1034(%r13)	# 7769	[c=4 l=8]  *movhi_internal/3
+	movq	%r13, %rdi	# 7771	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 7770	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 7772	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 17180	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 17181	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 7774	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18268	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 7775	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 7777	[c=4 l=3]  *cmpdi_1/0
+	jb	.L283	# 7778	[c=13 l=6]  *jcc
+	movl	0(%r13), %ebx	# 7780	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 7785	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 7781	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 7783	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 7784	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 7786	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 7787	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 7788	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 7791	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 17182	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 7792	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 7795	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 7796	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 19361	[c=10 l=4]  *indirect_jump
+.L709:
+	movzbl	10(%rbx), %r15d	# 7804	[c=13 l=5]  zero_extendqidi2/0
+	xorl	%eax, %eax	# 19360	[c=4 l=2]  *movdi_xor
+	leaq	.LC43(%rip), %rsi	# 7809	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 7811	[c=4 l=3]  *movdi_internal/3
+	movzbl	1004(%r13,%r15), %ecx	# 7806	[c=14 l=9]  *zero_extendqisi2/0
+	movl	%r15d, %edx	# 7808	[c=4 l=3]  *movsi_internal/0
+	call	log_append@PLT	# 7813	[c=0 l=5]  *call
+	cmpl	$15, %r15d	# 7816	[c=4 l=4]  *cmpsi_1/0
+	jle	.L1489	# 7817	[c=13 l=6]  *jcc
+	movzbl	1004(%r13,%r15), %eax	# 7830	[c=14 l=9]  *zero_extendqisi2/0
+	movl	%r15d, %edx	# 7833	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC61(%rip), %rsi	# 7834	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 7836	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, %ecx	# 17185	[c=4 l=2]  *movsi_internal/0
+	movl	%eax, 8(%rsp)	# 17919	[c=4 l=4]  *movsi_internal/1
+	xorl	%eax, %eax	# 19358	[c=4 l=2]  *movdi_xor
+	sarl	%ecx	# 7831	[c=4 l=2]  *ashrsi3_1/0
+	movl	%ecx, 16(%rsp)	# 17917	[c=4 l=4]  *movsi_internal/1
+	call	log_append@PLT	# 7838	[c=0 l=5]  *call
+	movl	16(%rsp), %ecx	# 17918	[c=9 l=4]  *movsi_internal/0
+	movl	$63, %eax	# 7841	[c=4 l=5]  *movsi_internal/0
+	movb	%cl, 1004(%r13,%r15)	# 7840	[c=4 l=8]  *movqi_internal/8
+	subl	5176(%r13), %eax	# 7842	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 7843	[c=13 l=7]  *cmpsi_1/1
+	jb	.L711	# 7844	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%r13)	# 7846	[c=13 l=8]  *cmpqi_ccno_1/1
+	jne	.L712	# 7847	[c=13 l=6]  *jcc
+.L711:
+	movq	1040(%r13), %rax	# 7850	[c=9 l=7]  *movdi_internal/3
+	movzbl	63(%rax), %r14d	# 7851	[c=13 l=5]  *zero_extendqisi2/0
+.L713:
+	movl	%r14d, %ecx	# 7862	[c=4 l=3]  *movsi_internal/0
+	movl	$63, %edx	# 7863	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 7866	[c=4 l=3]  *movdi_internal/3
+	andl	$-32, %r14d	# 7868	[c=4 l=4]  *andsi_1/0
+	leaq	.LC32(%rip), %rsi	# 7864	[c=1 l=7]  *movdi_internal/4
+	call	log_add_data_mov@PLT	# 7867	[c=0 l=5]  *call
+	movslq	8(%rsp), %r15	# 7870	[c=13 l=5]  *extendsidi2_rex64/1
+	movq	%r13, %rdi	# 7878	[c=4 l=3]  *movdi_internal/3
+	leaq	flag_update_table_ror8(%rip), %rax	# 16552	[c=1 l=7]  *movdi_internal/4
+	movl	$63, %edx	# 7875	[c=4 l=5]  *movsi_internal/0
+	leaq	.LC28(%rip), %rsi	# 7876	[c=1 l=7]  *movdi_internal/4
+	movzbl	(%rax,%r15), %eax	# 7871	[c=13 l=5]  *zero_extendqisi2/0
+	orl	%eax, %r14d	# 7872	[c=4 l=3]  *iorsi_1/0
+	movzbl	%r14b, %ecx	# 7873	[c=4 l=4]  *zero_extendqisi2/0
+	call	log_add_data_mov@PLT	# 7879	[c=0 l=5]  *call
+	movl	$63, %eax	# 7880	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 7881	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 7882	[c=13 l=7]  *cmpsi_1/1
+	jb	.L714	# 7883	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%r13)	# 7885	[c=13 l=8]  *cmpqi_ccno_1/1
+	jne	.L715	# 7886	[c=13 l=6]  *jcc
+.L714:
+	movq	1040(%r13), %rax	# 7889	[c=9 l=7]  *movdi_internal/3
+	movb	%r14b, 63(%rax)	# 7890	[c=4 l=4]  *movqi_internal/8
+.L716:
+	movq	%r13, %rdi	# 7902	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 7901	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 7903	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 17188	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 17189	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 7905	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18267	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 7906	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 7908	[c=4 l=3]  *cmpdi_1/0
+	jb	.L283	# 7909	[c=13 l=6]  *jcc
+	movl	0(%r13), %ebx	# 7911	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 7916	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 7912	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 7914	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 7915	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 7917	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 7918	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 7919	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 7922	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 17190	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 7923	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 7926	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 7927	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 19357	[c=10 l=4]  *indirect_jump
+.L717:
+	movzwl	12(%rbx), %r8d	# 7935	[c=13 l=5]  zero_extendhidi2/0
+	xorl	%eax, %eax	# 19356	[c=4 l=2]  *movdi_xor
+	movq	%r13, %rdi	# 7943	[c=4 l=3]  *movdi_internal/3
+	movzbl	10(%rbx), %r14d	# 7936	[c=13 l=5]  zero_extendqidi2/0
+	leaq	.LC43(%rip), %rsi	# 7941	[c=1 l=7]  *movdi_internal/4
+	movzbl	1004(%r13,%r8), %ecx	# 7938	[c=14 l=9]  *zero_extendqisi2/0
+	movq	%r8, %r15	# 18575	[c=4 l=3]  *movdi_internal/3
+	movl	%r8d, %edx	# 7940	[c=4 l=3]  *movsi_internal/0
+	movq	%r8, 8(%rsp)	# 17920	[c=4 l=5]  *movdi_internal/5
+	call	log_append@PLT	# 7945	[c=0 l=5]  *call
+	cmpl	$15, %r15d	# 7948	[c=4 l=4]  *cmpsi_1/0
+	movq	8(%rsp), %r8	# 17921	[c=9 l=5]  *movdi_internal/3
+	jle	.L1490	# 7949	[c=13 l=6]  *jcc
+	xorl	%eax, %eax	# 19354	[c=4 l=2]  *movdi_xor
+	movl	%r14d, %edx	# 7965	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC61(%rip), %rsi	# 7966	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 7968	[c=4 l=3]  *movdi_internal/3
+	movzbl	1004(%r13,%r8), %ecx	# 7962	[c=14 l=9]  *zero_extendqisi2/0
+	movl	%ecx, %r15d	# 18576	[c=4 l=3]  *movsi_internal/0
+	call	log_append@PLT	# 7970	[c=0 l=5]  *call
+	cmpl	$15, %r14d	# 7973	[c=4 l=4]  *cmpsi_1/0
+	jle	.L1491	# 7974	[c=13 l=6]  *jcc
+	movb	%r15b, 1004(%r13,%r14)	# 7987	[c=4 l=8]  *movqi_internal/8
+	movq	%r13, %rdi	# 7989	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 7988	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 7990	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 17192	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 17193	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 7992	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18266	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 7993	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 7995	[c=4 l=3]  *cmpdi_1/0
+	jb	.L283	# 7996	[c=13 l=6]  *jcc
+	movl	0(%r13), %ebx	# 7998	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 8003	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 7999	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 8001	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 8002	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 8004	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 8005	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 8006	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 8009	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 17194	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 8010	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 8013	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 8014	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 19352	[c=10 l=4]  *indirect_jump
+.L720:
+	movzwl	12(%rbx), %edx	# 8022	[c=13 l=4]  *zero_extendhisi2/0
+	movzbl	10(%rbx), %r14d	# 8023	[c=13 l=5]  *zero_extendqisi2/0
+	leaq	.LC44(%rip), %rsi	# 8033	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 8035	[c=4 l=3]  *movdi_internal/3
+	leal	1(%rdx), %eax	# 18263	[c=4 l=3]  *leasi
+	cltq	# 8025	[c=4 l=2]  *extendsidi2_rex64/0
+	movzbl	1004(%r13,%rax), %r15d	# 8026	[c=14 l=9]  *zero_extendqisi2/0
+	movslq	%edx, %rax	# 8028	[c=4 l=3]  *extendsidi2_rex64/1
+	movzbl	1004(%r13,%rax), %eax	# 8029	[c=14 l=9]  *zero_extendqisi2/0
+	sall	$8, %r15d	# 8027	[c=4 l=4]  *ashlsi3_1/0
+	orl	%eax, %r15d	# 8030	[c=4 l=3]  *iorsi_1/0
+	xorl	%eax, %eax	# 19350	[c=4 l=2]  *movdi_xor
+	movl	%r15d, %ecx	# 8031	[c=4 l=3]  *movsi_internal/0
+	call	log_append@PLT	# 8037	[c=0 l=5]  *call
+	movl	%r14d, %edx	# 8039	[c=4 l=3]  *movsi_internal/0
+	movl	%r15d, %ecx	# 8038	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 8042	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC48(%rip), %rsi	# 8040	[c=1 l=7]  *movdi_internal/4
+	xorl	%eax, %eax	# 19351	[c=4 l=2]  *movdi_xor
+	call	log_append@PLT	# 8044	[c=0 l=5]  *call
+	movslq	%r14d, %rax	# 8045	[c=4 l=3]  *extendsidi2_rex64/1
+	movl	%r15d, %ecx	# 17197	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 8052	[c=4 l=3]  *movdi_internal/3
+	movb	%r15b, 1004(%r13,%rax)	# 8046	[c=4 l=8]  *movqi_internal/8
+	leal	1(%r14), %eax	# 18264	[c=4 l=4]  *leasi
+	movzbl	%ch, %ecx	# 8050	[c=4 l=3]  *extzvqi/0
+	movq	%rbx, %rsi	# 8051	[c=4 l=3]  *movdi_internal/3
+	cltq	# 8048	[c=4 l=2]  *extendsidi2_rex64/0
+	movb	%cl, 1004(%r13,%rax)	# 17196	[c=4 l=8]  *movqi_internal/8
+	call	log_dump_line@PLT	# 8053	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 17198	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 17199	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 8055	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18265	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 8056	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 8058	[c=4 l=3]  *cmpdi_1/0
+	jb	.L283	# 8059	[c=13 l=6]  *jcc
+	movl	0(%r13), %ebx	# 8061	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 8066	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 8062	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 8064	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 8065	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 8067	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 8068	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 8069	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 8072	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 17200	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 8073	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 8076	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 8077	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 19349	[c=10 l=4]  *indirect_jump
+.L721:
+	movzbl	10(%rbx), %r8d	# 8086	[c=13 l=5]  zero_extendqidi2/0
+	xorl	%eax, %eax	# 19348	[c=4 l=2]  *movdi_xor
+	movq	%r13, %rdi	# 8093	[c=4 l=3]  *movdi_internal/3
+	movzwl	12(%rbx), %r14d	# 8085	[c=13 l=5]  *zero_extendhisi2/0
+	leaq	.LC43(%rip), %rsi	# 8091	[c=1 l=7]  *movdi_internal/4
+	movzbl	1004(%r13,%r8), %ecx	# 8088	[c=14 l=9]  *zero_extendqisi2/0
+	movq	%r8, %r15	# 18577	[c=4 l=3]  *movdi_internal/3
+	movl	%r8d, %edx	# 8090	[c=4 l=3]  *movsi_internal/0
+	movq	%r8, 8(%rsp)	# 17924	[c=4 l=5]  *movdi_internal/5
+	call	log_append@PLT	# 8095	[c=0 l=5]  *call
+	cmpl	$15, %r15d	# 8098	[c=4 l=4]  *cmpsi_1/0
+	movq	8(%rsp), %r8	# 17925	[c=9 l=5]  *movdi_internal/3
+	leaq	.LC43(%rip), %rsi	# 17923	[c=1 l=7]  *movdi_internal/4
+	jle	.L1492	# 8099	[c=13 l=6]  *jcc
+	movslq	%r14d, %r15	# 8113	[c=4 l=3]  *extendsidi2_rex64/1
+	xorl	%eax, %eax	# 19346	[c=4 l=2]  *movdi_xor
+	movl	%r14d, %edx	# 8116	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 8119	[c=4 l=3]  *movdi_internal/3
+	movzbl	1004(%r13,%r8), %r8d	# 8112	[c=14 l=9]  *zero_extendqisi2/0
+	movzbl	1004(%r13,%r15), %ecx	# 8114	[c=14 l=9]  *zero_extendqisi2/0
+	movl	%r8d, 8(%rsp)	# 17926	[c=4 l=5]  *movsi_internal/1
+	call	log_append@PLT	# 8121	[c=0 l=5]  *call
+	cmpl	$15, %r14d	# 8124	[c=4 l=4]  *cmpsi_1/0
+	movl	8(%rsp), %r8d	# 17927	[c=9 l=5]  *movsi_internal/0
+	jle	.L1493	# 8125	[c=13 l=6]  *jcc
+	movzbl	1004(%r13,%r15), %r14d	# 8138	[c=14 l=9]  *zero_extendqisi2/0
+	imull	%r8d, %r14d	# 8139	[c=12 l=4]  *mulsi3_1/2
+	cmpl	$1, %r14d	# 8142	[c=4 l=4]  *cmpsi_1/0
+	movl	%r14d, %edx	# 17202	[c=4 l=3]  *movsi_internal/0
+	sbbl	%eax, %eax	# 8143	[c=8 l=2]  *x86_movsicc_0_m1_neg
+	sarl	$15, %edx	# 8145	[c=4 l=3]  *ashrsi3_1/0
+	andl	$2, %eax	# 8144	[c=4 l=3]  *andsi_1/0
+	orl	%edx, %eax	# 8146	[c=4 l=2]  *iorsi_1/0
+	movl	%eax, %r15d	# 17205	[c=4 l=3]  *movsi_internal/0
+	movl	$63, %eax	# 8147	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 8148	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 8149	[c=13 l=7]  *cmpsi_1/1
+	jb	.L724	# 8150	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%r13)	# 8152	[c=13 l=8]  *cmpqi_ccno_1/1
+	jne	.L725	# 8153	[c=13 l=6]  *jcc
+.L724:
+	movq	1040(%r13), %rax	# 8156	[c=9 l=7]  *movdi_internal/3
+	movzbl	63(%rax), %eax	# 8157	[c=13 l=4]  *zero_extendqisi2/0
+.L726:
+	movl	%eax, %ecx	# 8168	[c=4 l=2]  *movsi_internal/0
+	movl	$63, %edx	# 8169	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 8172	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, 8(%rsp)	# 17928	[c=4 l=4]  *movsi_internal/1
+	leaq	.LC32(%rip), %rsi	# 8170	[c=1 l=7]  *movdi_internal/4
+	call	log_add_data_mov@PLT	# 8173	[c=0 l=5]  *call
+	movl	8(%rsp), %eax	# 17929	[c=9 l=4]  *movsi_internal/0
+	movl	$63, %edx	# 8178	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 8181	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC28(%rip), %rsi	# 8179	[c=1 l=7]  *movdi_internal/4
+	andl	$-4, %eax	# 8174	[c=4 l=3]  *andsi_1/0
+	orl	%eax, %r15d	# 8175	[c=4 l=3]  *iorsi_1/0
+	movzbl	%r15b, %ecx	# 8176	[c=4 l=4]  *zero_extendqisi2/0
+	call	log_add_data_mov@PLT	# 8182	[c=0 l=5]  *call
+	movl	$63, %eax	# 8183	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 8184	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 8185	[c=13 l=7]  *cmpsi_1/1
+	jb	.L727	# 8186	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%r13)	# 8188	[c=13 l=8]  *cmpqi_ccno_1/1
+	jne	.L728	# 8189	[c=13 l=6]  *jcc
+.L727:
+	movq	1040(%r13), %rax	# 8192	[c=9 l=7]  *movdi_internal/3
+	movb	%r15b, 63(%rax)	# 8193	[c=4 l=4]  *movqi_internal/8
+.L729:
+	xorl	%edx, %edx	# 19343	[c=4 l=2]  *movdi_xor
+	xorl	%eax, %eax	# 19344	[c=4 l=2]  *movdi_xor
+	movl	%r14d, %ecx	# 8204	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 8208	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC48(%rip), %rsi	# 8206	[c=1 l=7]  *movdi_internal/4
+	call	log_append@PLT	# 8210	[c=0 l=5]  *call
+	movw	%r14w, 1004(%r13)	# 8211	[c=4 l=8]  *movhi_internal/3
+	movq	%r13, %rdi	# 8213	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 8212	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 8214	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 17206	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 17207	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 8216	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18262	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 8217	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 8219	[c=4 l=3]  *cmpdi_1/0
+	jb	.L283	# 8220	[c=13 l=6]  *jcc
+	movl	0(%r13), %ebx	# 8222	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 8227	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 8223	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 8225	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 8226	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 8228	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 8229	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 8230	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 8233	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 17208	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 8234	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 8237	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 8238	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 19342	[c=10 l=4]  *indirect_jump
+.L730:
+	movzbl	10(%rbx), %r8d	# 8247	[c=13 l=5]  zero_extendqidi2/0
+	xorl	%eax, %eax	# 19341	[c=4 l=2]  *movdi_xor
+	movq	%r13, %rdi	# 8254	[c=4 l=3]  *movdi_internal/3
+	movzwl	12(%rbx), %r14d	# 8246	[c=13 l=5]  *zero_extendhisi2/0
+	leaq	.LC43(%rip), %rsi	# 8252	[c=1 l=7]  *movdi_internal/4
+	movzbl	1004(%r13,%r8), %ecx	# 8249	[c=14 l=9]  *zero_extendqisi2/0
+	movq	%r8, %r15	# 18578	[c=4 l=3]  *movdi_internal/3
+	movl	%r8d, %edx	# 8251	[c=4 l=3]  *movsi_internal/0
+	movq	%r8, 8(%rsp)	# 17932	[c=4 l=5]  *movdi_internal/5
+	call	log_append@PLT	# 8256	[c=0 l=5]  *call
+	cmpl	$15, %r15d	# 8259	[c=4 l=4]  *cmpsi_1/0
+	movq	8(%rsp), %r8	# 17933	[c=9 l=5]  *movdi_internal/3
+	leaq	.LC43(%rip), %rsi	# 17931	[c=1 l=7]  *movdi_internal/4
+	jle	.L1494	# 8260	[c=13 l=6]  *jcc
+	movslq	%r14d, %r15	# 8274	[c=4 l=3]  *extendsidi2_rex64/1
+	xorl	%eax, %eax	# 19339	[c=4 l=2]  *movdi_xor
+	movl	%r14d, %edx	# 8277	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 8280	[c=4 l=3]  *movdi_internal/3
+	movsbl	1004(%r13,%r8), %r8d	# 8273	[c=14 l=9]  extendqisi2
+	movzbl	1004(%r13,%r15), %ecx	# 8275	[c=14 l=9]  *zero_extendqisi2/0
+	movl	%r8d, 8(%rsp)	# 17934	[c=4 l=5]  *movsi_internal/1
+	call	log_append@PLT	# 8282	[c=0 l=5]  *call
+	cmpl	$15, %r14d	# 8285	[c=4 l=4]  *cmpsi_1/0
+	movl	8(%rsp), %r8d	# 17935	[c=9 l=5]  *movsi_internal/0
+	jle	.L1495	# 8286	[c=13 l=6]  *jcc
+	movsbl	1004(%r13,%r15), %r14d	# 8299	[c=14 l=9]  extendqisi2
+	xorl	%eax, %eax	# 19335	[c=4 l=2]  *movsi_xor
+	imull	%r8d, %r14d	# 8300	[c=12 l=4]  *mulsi3_1/2
+	movl	%r14d, %r15d	# 17210	[c=4 l=3]  *movsi_internal/0
+	andl	$65535, %r15d	# 19336	[c=4 l=7]  *andsi_2/0
+	sete	%al	# 19337	[c=4 l=3]  *setcc_qi_slp
+	movl	%r15d, %edx	# 17212	[c=4 l=3]  *movsi_internal/0
+	addl	%eax, %eax	# 8306	[c=4 l=2]  *ashlsi3_1/0
+	sarl	$15, %edx	# 8307	[c=4 l=3]  *ashrsi3_1/0
+	orl	%edx, %eax	# 8308	[c=4 l=2]  *iorsi_1/0
+	movl	%eax, 8(%rsp)	# 17215	[c=4 l=4]  *movsi_internal/1
+	movl	$63, %eax	# 8309	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 8310	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 8311	[c=13 l=7]  *cmpsi_1/1
+	jb	.L733	# 8312	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%r13)	# 8314	[c=13 l=8]  *cmpqi_ccno_1/1
+	jne	.L734	# 8315	[c=13 l=6]  *jcc
+.L733:
+	movq	1040(%r13), %rax	# 8318	[c=9 l=7]  *movdi_internal/3
+	movzbl	63(%rax), %eax	# 8319	[c=13 l=4]  *zero_extendqisi2/0
+.L735:
+	movl	%eax, %ecx	# 8330	[c=4 l=2]  *movsi_internal/0
+	movl	$63, %edx	# 8331	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 8334	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, 16(%rsp)	# 17938	[c=4 l=4]  *movsi_internal/1
+	leaq	.LC32(%rip), %rsi	# 8332	[c=1 l=7]  *movdi_internal/4
+	call	log_add_data_mov@PLT	# 8335	[c=0 l=5]  *call
+	movl	16(%rsp), %eax	# 17939	[c=9 l=4]  *movsi_internal/0
+	movl	8(%rsp), %edi	# 17216	[c=9 l=4]  *movsi_internal/0
+	movl	$63, %edx	# 8340	[c=4 l=5]  *movsi_internal/0
+	leaq	.LC28(%rip), %rsi	# 8341	[c=1 l=7]  *movdi_internal/4
+	andl	$-4, %eax	# 8336	[c=4 l=3]  *andsi_1/0
+	orl	%edi, %eax	# 8337	[c=4 l=2]  *iorsi_1/0
+	movq	%r13, %rdi	# 8343	[c=4 l=3]  *movdi_internal/3
+	movzbl	%al, %ecx	# 8338	[c=4 l=3]  *zero_extendqisi2/0
+	movl	%eax, 8(%rsp)	# 17936	[c=4 l=4]  *movsi_internal/1
+	call	log_add_data_mov@PLT	# 8344	[c=0 l=5]  *call
+	movl	$63, %edx	# 8345	[c=4 l=5]  *movsi_internal/0
+	movl	8(%rsp), %eax	# 17937	[c=9 l=4]  *movsi_internal/0
+	subl	5176(%r13), %edx	# 8346	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %edx	# 8347	[c=13 l=7]  *cmpsi_1/1
+	jb	.L736	# 8348	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%r13)	# 8350	[c=13 l=8]  *cmpqi_ccno_1/1
+	jne	.L737	# 8351	[c=13 l=6]  *jcc
+.L736:
+	movq	1040(%r13), %rdx	# 8354	[c=9 l=7]  *movdi_internal/3
+	movb	%al, 63(%rdx)	# 8355	[c=4 l=3]  *movqi_internal/8
+.L738:
+	xorl	%edx, %edx	# 19333	[c=4 l=2]  *movdi_xor
+	xorl	%eax, %eax	# 19334	[c=4 l=2]  *movdi_xor
+	movl	%r15d, %ecx	# 8366	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 8370	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC48(%rip), %rsi	# 8368	[c=1 l=7]  *movdi_internal/4
+	call	log_append@PLT	# 8372	[c=0 l=5]  *call
+	movw	%r14w, 1004(%r13)	# 8373	[c=4 l=8]  *movhi_internal/3
+	movq	%r13, %rdi	# 8375	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 8374	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 8376	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 17217	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 17218	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 8378	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18259	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 8379	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 8381	[c=4 l=3]  *cmpdi_1/0
+	jb	.L283	# 8382	[c=13 l=6]  *jcc
+	movl	0(%r13), %ebx	# 8384	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 8389	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 8385	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 8387	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 8388	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 8390	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 8391	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 8392	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 8395	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 17219	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 8396	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 8399	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 8400	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 19332	[c=10 l=4]  *indirect_jump
+.L739:
+	movzbl	10(%rbx), %r8d	# 8409	[c=13 l=5]  zero_extendqidi2/0
+	xorl	%eax, %eax	# 19331	[c=4 l=2]  *movdi_xor
+	movq	%r13, %rdi	# 8416	[c=4 l=3]  *movdi_internal/3
+	movzwl	12(%rbx), %r14d	# 8408	[c=13 l=5]  *zero_extendhisi2/0
+	leaq	.LC43(%rip), %rsi	# 8414	[c=1 l=7]  *movdi_internal/4
+	movzbl	1004(%r13,%r8), %ecx	# 8411	[c=14 l=9]  *zero_extendqisi2/0
+	movq	%r8, %r15	# 18579	[c=4 l=3]  *movdi_internal/3
+	movl	%r8d, %edx	# 8413	[c=4 l=3]  *movsi_internal/0
+	movq	%r8, 8(%rsp)	# 17942	[c=4 l=5]  *movdi_internal/5
+	call	log_append@PLT	# 8418	[c=0 l=5]  *call
+	cmpl	$15, %r15d	# 8421	[c=4 l=4]  *cmpsi_1/0
+	movq	8(%rsp), %r8	# 17943	[c=9 l=5]  *movdi_internal/3
+	leaq	.LC43(%rip), %rsi	# 17941	[c=1 l=7]  *movdi_internal/4
+	jle	.L1496	# 8422	[c=13 l=6]  *jcc
+	movslq	%r14d, %r15	# 8436	[c=4 l=3]  *extendsidi2_rex64/1
+	xorl	%eax, %eax	# 19329	[c=4 l=2]  *movdi_xor
+	movl	%r14d, %edx	# 8439	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 8442	[c=4 l=3]  *movdi_internal/3
+	movsbl	1004(%r13,%r8), %r8d	# 8435	[c=14 l=9]  extendqisi2
+	movzbl	1004(%r13,%r15), %ecx	# 8437	[c=14 l=9]  *zero_extendqisi2/0
+	movl	%r8d, 8(%rsp)	# 17944	[c=4 l=5]  *movsi_internal/1
+	call	log_append@PLT	# 8444	[c=0 l=5]  *call
+	cmpl	$15, %r14d	# 8447	[c=4 l=4]  *cmpsi_1/0
+	movl	8(%rsp), %r8d	# 17945	[c=9 l=5]  *movsi_internal/0
+	jle	.L1497	# 8448	[c=13 l=6]  *jcc
+	movzbl	1004(%r13,%r15), %r14d	# 8461	[c=14 l=9]  *zero_extendqisi2/0
+	xorl	%eax, %eax	# 19325	[c=4 l=2]  *movsi_xor
+	imull	%r8d, %r14d	# 8462	[c=12 l=4]  *mulsi3_1/2
+	movl	%r14d, %r15d	# 17221	[c=4 l=3]  *movsi_internal/0
+	andl	$65535, %r15d	# 19326	[c=4 l=7]  *andsi_2/0
+	sete	%al	# 19327	[c=4 l=3]  *setcc_qi_slp
+	movl	%r15d, %edx	# 17223	[c=4 l=3]  *movsi_internal/0
+	addl	%eax, %eax	# 8468	[c=4 l=2]  *ashlsi3_1/0
+	sarl	$15, %edx	# 8469	[c=4 l=3]  *ashrsi3_1/0
+	orl	%edx, %eax	# 8470	[c=4 l=2]  *iorsi_1/0
+	movl	%eax, 8(%rsp)	# 17226	[c=4 l=4]  *movsi_internal/1
+	movl	$63, %eax	# 8471	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 8472	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 8473	[c=13 l=7]  *cmpsi_1/1
+	jb	.L742	# 8474	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%r13)	# 8476	[c=13 l=8]  *cmpqi_ccno_1/1
+	jne	.L743	# 8477	[c=13 l=6]  *jcc
+.L742:
+	movq	1040(%r13), %rax	# 8480	[c=9 l=7]  *movdi_internal/3
+	movzbl	63(%rax), %eax	# 8481	[c=13 l=4]  *zero_extendqisi2/0
+.L744:
+	movl	%eax, %ecx	# 8492	[c=4 l=2]  *movsi_internal/0
+	movl	$63, %edx	# 8493	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 8496	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, 16(%rsp)	# 17948	[c=4 l=4]  *movsi_internal/1
+	leaq	.LC32(%rip), %rsi	# 8494	[c=1 l=7]  *movdi_internal/4
+	call	log_add_data_mov@PLT	# 8497	[c=0 l=5]  *call
+	movl	16(%rsp), %eax	# 17949	[c=9 l=4]  *movsi_internal/0
+	movl	8(%rsp), %edi	# 17227	[c=9 l=4]  *movsi_internal/0
+	movl	$63, %edx	# 8502	[c=4 l=5]  *movsi_internal/0
+	leaq	.LC28(%rip), %rsi	# 8503	[c=1 l=7]  *movdi_internal/4
+	andl	$-4, %eax	# 8498	[c=4 l=3]  *andsi_1/0
+	orl	%edi, %eax	# 8499	[c=4 l=2]  *iorsi_1/0
+	movq	%r13, %rdi	# 8505	[c=4 l=3]  *movdi_internal/3
+	movzbl	%al, %ecx	# 8500	[c=4 l=3]  *zero_extendqisi2/0
+	movl	%eax, 8(%rsp)	# 17946	[c=4 l=4]  *movsi_internal/1
+	call	log_add_data_mov@PLT	# 8506	[c=0 l=5]  *call
+	movl	$63, %edx	# 8507	[c=4 l=5]  *movsi_internal/0
+	movl	8(%rsp), %eax	# 17947	[c=9 l=4]  *movsi_internal/0
+	subl	5176(%r13), %edx	# 8508	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %edx	# 8509	[c=13 l=7]  *cmpsi_1/1
+	jb	.L745	# 8510	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%r13)	# 8512	[c=13 l=8]  *cmpqi_ccno_1/1
+	jne	.L746	# 8513	[c=13 l=6]  *jcc
+.L745:
+	movq	1040(%r13), %rdx	# 8516	[c=9 l=7]  *movdi_internal/3
+	movb	%al, 63(%rdx)	# 8517	[c=4 l=3]  *movqi_internal/8
+.L747:
+	xorl	%edx, %edx	# 19323	[c=4 l=2]  *movdi_xor
+	xorl	%eax, %eax	# 19324	[c=4 l=2]  *movdi_xor
+	movl	%r15d, %ecx	# 8528	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 8532	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC48(%rip), %rsi	# 8530	[c=1 l=7]  *movdi_internal/4
+	call	log_append@PLT	# 8534	[c=0 l=5]  *call
+	movw	%r14w, 1004(%r13)	# 8535	[c=4 l=8]  *movhi_internal/3
+	movq	%r13, %rdi	# 8537	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 8536	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 8538	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 17228	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 17229	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 8540	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18256	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 8541	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 8543	[c=4 l=3]  *cmpdi_1/0
+	jb	.L283	# 8544	[c=13 l=6]  *jcc
+	movl	0(%r13), %ebx	# 8546	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 8551	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 8547	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 8549	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 8550	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 8552	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 8553	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 8554	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 8557	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 17230	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 8558	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 8561	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 8562	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 19322	[c=10 l=4]  *indirect_jump
+.L748:
+	movzbl	10(%rbx), %r14d	# 8570	[c=13 l=5]  zero_extendqidi2/0
+	leaq	.LC43(%rip), %rsi	# 8575	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 8577	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 19321	[c=4 l=2]  *movdi_xor
+	movzbl	1004(%r13,%r14), %ecx	# 8572	[c=14 l=9]  *zero_extendqisi2/0
+	movq	%r14, %rdx	# 18580	[c=4 l=3]  *movdi_internal/3
+	movl	%r14d, 8(%rsp)	# 17950	[c=4 l=5]  *movsi_internal/1
+	call	log_append@PLT	# 8579	[c=0 l=5]  *call
+	movl	8(%rsp), %edx	# 17951	[c=9 l=4]  *movsi_internal/0
+	cmpl	$15, %edx	# 8582	[c=4 l=3]  *cmpsi_1/0
+	jle	.L1498	# 8583	[c=13 l=6]  *jcc
+	movzbl	1004(%r13,%r14), %eax	# 8596	[c=14 l=9]  *zero_extendqisi2/0
+	leaq	.LC61(%rip), %rsi	# 8602	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 8604	[c=4 l=3]  *movdi_internal/3
+	movb	%al, 8(%rsp)	# 17952	[c=4 l=4]  *movqi_internal/8
+	negl	%eax	# 8598	[c=4 l=2]  *negsi_1
+	movl	%eax, %r15d	# 17233	[c=4 l=3]  *movsi_internal/0
+	movzbl	%al, %ecx	# 8599	[c=4 l=3]  *zero_extendqisi2/0
+	xorl	%eax, %eax	# 19319	[c=4 l=2]  *movdi_xor
+	call	log_append@PLT	# 8606	[c=0 l=5]  *call
+	movzbl	8(%rsp), %r8d	# 17953	[c=9 l=6]  *movqi_internal/4
+	movb	%r15b, 1004(%r13,%r14)	# 8608	[c=4 l=8]  *movqi_internal/8
+	movl	%r15d, %eax	# 17236	[c=4 l=3]  *movsi_internal/0
+	andl	$511, %eax	# 8613	[c=4 l=5]  *andsi_1/0
+	movl	%r8d, %r14d	# 17234	[c=4 l=3]  *movsi_internal/0
+	andl	$136, %r14d	# 8610	[c=4 l=7]  *andsi_1/0
+	imull	$260, %r14d, %r14d	# 8611	[c=12 l=7]  *mulsi3_1/1
+	andl	$7680, %r14d	# 8612	[c=4 l=7]  *andsi_1/0
+	orl	%eax, %r14d	# 8614	[c=5 l=3]  *iorsi_1_zext
+	movl	$63, %eax	# 8615	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 8616	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 8617	[c=13 l=7]  *cmpsi_1/1
+	jb	.L750	# 8618	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%r13)	# 8620	[c=13 l=8]  *cmpqi_ccno_1/1
+	jne	.L751	# 8621	[c=13 l=6]  *jcc
+.L750:
+	movq	1040(%r13), %rax	# 8624	[c=9 l=7]  *movdi_internal/3
+	movzbl	63(%rax), %r15d	# 8625	[c=13 l=5]  *zero_extendqisi2/0
+.L752:
+	movl	%r15d, %ecx	# 8636	[c=4 l=3]  *movsi_internal/0
+	movl	$63, %edx	# 8637	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 8640	[c=4 l=3]  *movdi_internal/3
+	andl	$-64, %r15d	# 8642	[c=4 l=4]  *andsi_1/0
+	leaq	.LC32(%rip), %rsi	# 8638	[c=1 l=7]  *movdi_internal/4
+	call	log_add_data_mov@PLT	# 8641	[c=0 l=5]  *call
+	leaq	flag_update_table_sub8(%rip), %rax	# 16553	[c=1 l=7]  *movdi_internal/4
+	movl	$63, %edx	# 8649	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 8652	[c=4 l=3]  *movdi_internal/3
+	movzbl	(%rax,%r14), %eax	# 8645	[c=13 l=5]  *zero_extendqisi2/0
+	leaq	.LC28(%rip), %rsi	# 8650	[c=1 l=7]  *movdi_internal/4
+	orl	%eax, %r15d	# 8646	[c=4 l=3]  *iorsi_1/0
+	movzbl	%r15b, %ecx	# 8647	[c=4 l=4]  *zero_extendqisi2/0
+	call	log_add_data_mov@PLT	# 8653	[c=0 l=5]  *call
+	movl	$63, %eax	# 8654	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 8655	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 8656	[c=13 l=7]  *cmpsi_1/1
+	jb	.L753	# 8657	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%r13)	# 8659	[c=13 l=8]  *cmpqi_ccno_1/1
+	jne	.L754	# 8660	[c=13 l=6]  *jcc
+.L753:
+	movq	1040(%r13), %rax	# 8663	[c=9 l=7]  *movdi_internal/3
+	movb	%r15b, 63(%rax)	# 8664	[c=4 l=4]  *movqi_internal/8
+.L755:
+	movq	%r13, %rdi	# 8676	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 8675	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 8677	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 17238	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 17239	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 8679	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18255	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 8680	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 8682	[c=4 l=3]  *cmpdi_1/0
+	jb	.L283	# 8683	[c=13 l=6]  *jcc
+	movl	0(%r13), %ebx	# 8685	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 8690	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 8686	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 8688	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 8689	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 8691	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 8692	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 8693	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 8696	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 17240	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 8697	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 8700	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 8701	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 19318	[c=10 l=4]  *indirect_jump
+.L756:
+	movq	%r13, %rdi	# 8710	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 8709	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 8711	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 17242	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 17243	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 8713	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18254	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 8714	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 8716	[c=4 l=3]  *cmpdi_1/0
+	jb	.L283	# 8717	[c=13 l=6]  *jcc
+	movl	0(%r13), %ebx	# 8719	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 8724	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 8720	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 8722	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 8723	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 8725	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 8726	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 8727	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 8730	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 17244	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 8731	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 8734	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 8735	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 19317	[c=10 l=4]  *indirect_jump
+.L757:
+	movzbl	10(%rbx), %r15d	# 8744	[c=13 l=5]  zero_extendqidi2/0
+	xorl	%eax, %eax	# 19316	[c=4 l=2]  *movdi_xor
+	movq	%r13, %rdi	# 8751	[c=4 l=3]  *movdi_internal/3
+	movzwl	12(%rbx), %r14d	# 8743	[c=13 l=5]  *zero_extendhisi2/0
+	leaq	.LC43(%rip), %rsi	# 8749	[c=1 l=7]  *movdi_internal/4
+	movzbl	1004(%r13,%r15), %ecx	# 8746	[c=14 l=9]  *zero_extendqisi2/0
+	movl	%r15d, %edx	# 8748	[c=4 l=3]  *movsi_internal/0
+	movl	%r15d, 8(%rsp)	# 17956	[c=4 l=5]  *movsi_internal/1
+	call	log_append@PLT	# 8753	[c=0 l=5]  *call
+	movl	8(%rsp), %r9d	# 17957	[c=9 l=5]  *movsi_internal/0
+	leaq	.LC43(%rip), %rsi	# 17955	[c=1 l=7]  *movdi_internal/4
+	cmpl	$15, %r9d	# 8756	[c=4 l=4]  *cmpsi_1/0
+	jle	.L1499	# 8757	[c=13 l=6]  *jcc
+	movslq	%r14d, %r11	# 8771	[c=4 l=3]  *extendsidi2_rex64/1
+	xorl	%eax, %eax	# 19314	[c=4 l=2]  *movdi_xor
+	movl	%r14d, %edx	# 8774	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 8777	[c=4 l=3]  *movdi_internal/3
+	movzbl	1004(%r13,%r15), %r8d	# 8770	[c=10 l=9]  *movqi_internal/4
+	movl	%r9d, 24(%rsp)	# 17962	[c=4 l=5]  *movsi_internal/1
+	movzbl	1004(%r13,%r11), %ecx	# 8772	[c=14 l=9]  *zero_extendqisi2/0
+	movq	%r11, 8(%rsp)	# 17958	[c=4 l=5]  *movdi_internal/5
+	movb	%r8b, 16(%rsp)	# 17960	[c=4 l=5]  *movqi_internal/8
+	call	log_append@PLT	# 8779	[c=0 l=5]  *call
+	cmpl	$15, %r14d	# 8782	[c=4 l=4]  *cmpsi_1/0
+	movq	8(%rsp), %r11	# 17959	[c=9 l=5]  *movdi_internal/3
+	movzbl	16(%rsp), %r8d	# 17961	[c=9 l=6]  *movqi_internal/4
+	movl	24(%rsp), %r9d	# 17963	[c=9 l=5]  *movsi_internal/0
+	jle	.L1500	# 8783	[c=13 l=6]  *jcc
+	orb	1004(%r13,%r11), %r8b	# 8796	[c=14 l=8]  *iorqi_1/1
+	xorl	%eax, %eax	# 19312	[c=4 l=2]  *movdi_xor
+	movl	%r9d, %edx	# 8799	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 8802	[c=4 l=3]  *movdi_internal/3
+	movzbl	%r8b, %r14d	# 8797	[c=4 l=4]  zero_extendqidi2/0
+	leaq	.LC61(%rip), %rsi	# 8800	[c=1 l=7]  *movdi_internal/4
+	movb	%r8b, 8(%rsp)	# 17964	[c=4 l=5]  *movqi_internal/8
+	movl	%r14d, %ecx	# 8798	[c=4 l=3]  *movsi_internal/0
+	call	log_append@PLT	# 8804	[c=0 l=5]  *call
+	movzbl	8(%rsp), %r8d	# 17965	[c=9 l=6]  *movqi_internal/4
+	movl	$63, %eax	# 8807	[c=4 l=5]  *movsi_internal/0
+	movb	%r8b, 1004(%r13,%r15)	# 8806	[c=4 l=8]  *movqi_internal/8
+	subl	5176(%r13), %eax	# 8808	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 8809	[c=13 l=7]  *cmpsi_1/1
+	jb	.L760	# 8810	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%r13)	# 8812	[c=13 l=8]  *cmpqi_ccno_1/1
+	jne	.L761	# 8813	[c=13 l=6]  *jcc
+.L760:
+	movq	1040(%r13), %rax	# 8816	[c=9 l=7]  *movdi_internal/3
+	movzbl	63(%rax), %r15d	# 8817	[c=13 l=5]  *zero_extendqisi2/0
+.L762:
+	movl	%r15d, %ecx	# 8828	[c=4 l=3]  *movsi_internal/0
+	movl	$63, %edx	# 8829	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 8832	[c=4 l=3]  *movdi_internal/3
+	andl	$-31, %r15d	# 8834	[c=4 l=4]  *andsi_1/0
+	leaq	.LC32(%rip), %rsi	# 8830	[c=1 l=7]  *movdi_internal/4
+	call	log_add_data_mov@PLT	# 8833	[c=0 l=5]  *call
+	leaq	flag_update_table_logical(%rip), %rax	# 16554	[c=1 l=7]  *movdi_internal/4
+	movl	$63, %edx	# 8841	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 8844	[c=4 l=3]  *movdi_internal/3
+	movzbl	(%rax,%r14), %eax	# 8837	[c=13 l=5]  *zero_extendqisi2/0
+	leaq	.LC28(%rip), %rsi	# 8842	[c=1 l=7]  *movdi_internal/4
+	orl	%eax, %r15d	# 8838	[c=4 l=3]  *iorsi_1/0
+	movzbl	%r15b, %ecx	# 8839	[c=4 l=4]  *zero_extendqisi2/0
+	call	log_add_data_mov@PLT	# 8845	[c=0 l=5]  *call
+	movl	$63, %eax	# 8846	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 8847	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 8848	[c=13 l=7]  *cmpsi_1/1
+	jb	.L763	# 8849	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%r13)	# 8851	[c=13 l=8]  *cmpqi_ccno_1/1
+	jne	.L764	# 8852	[c=13 l=6]  *jcc
+.L763:
+	movq	1040(%r13), %rax	# 8855	[c=9 l=7]  *movdi_internal/3
+	movb	%r15b, 63(%rax)	# 8856	[c=4 l=4]  *movqi_internal/8
+.L765:
+	movq	%r13, %rdi	# 8868	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 8867	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 8869	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 17246	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 17247	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 8871	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18253	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 8872	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 8874	[c=4 l=3]  *cmpdi_1/0
+	jb	.L283	# 8875	[c=13 l=6]  *jcc
+	movl	0(%r13), %ebx	# 8877	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 8882	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 8878	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 8880	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 8881	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 8883	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 8884	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 8885	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 8888	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 17248	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 8889	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 8892	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 8893	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 19311	[c=10 l=4]  *indirect_jump
+.L766:
+	movzwl	12(%rbx), %r15d	# 8901	[c=13 l=5]  *zero_extendhisi2/0
+	movzbl	10(%rbx), %r14d	# 8902	[c=13 l=5]  *zero_extendqisi2/0
+	xorl	%eax, %eax	# 19309	[c=4 l=2]  *movdi_xor
+	movq	%r13, %rdi	# 8906	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC62(%rip), %rsi	# 8904	[c=1 l=7]  *movdi_internal/4
+	movl	%r15d, %edx	# 8903	[c=4 l=3]  *movsi_internal/0
+	call	log_append@PLT	# 8908	[c=0 l=5]  *call
+	movslq	%r14d, %r8	# 8909	[c=4 l=3]  *extendsidi2_rex64/1
+	xorl	%eax, %eax	# 19310	[c=4 l=2]  *movdi_xor
+	movl	%r14d, %edx	# 8912	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC43(%rip), %rsi	# 8913	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 8915	[c=4 l=3]  *movdi_internal/3
+	movq	%r8, 8(%rsp)	# 17966	[c=4 l=5]  *movdi_internal/5
+	movzbl	1004(%r13,%r8), %ecx	# 8910	[c=14 l=9]  *zero_extendqisi2/0
+	call	log_append@PLT	# 8917	[c=0 l=5]  *call
+	cmpl	$15, %r14d	# 8920	[c=4 l=4]  *cmpsi_1/0
+	movq	8(%rsp), %r8	# 17967	[c=9 l=5]  *movdi_internal/3
+	jle	.L1501	# 8921	[c=13 l=6]  *jcc
+	movzbl	1004(%r13,%r8), %eax	# 8934	[c=14 l=9]  *zero_extendqisi2/0
+	movl	%r14d, %edx	# 8938	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC61(%rip), %rsi	# 8939	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 8941	[c=4 l=3]  *movdi_internal/3
+	movq	%r8, 8(%rsp)	# 17968	[c=4 l=5]  *movdi_internal/5
+	orl	%eax, %r15d	# 8935	[c=4 l=3]  *iorsi_1/0
+	xorl	%eax, %eax	# 19307	[c=4 l=2]  *movdi_xor
+	movzbl	%r15b, %ecx	# 8936	[c=4 l=4]  *zero_extendqisi2/0
+	call	log_append@PLT	# 8943	[c=0 l=5]  *call
+	movq	8(%rsp), %r8	# 17969	[c=9 l=5]  *movdi_internal/3
+	movl	$63, %eax	# 8946	[c=4 l=5]  *movsi_internal/0
+	movb	%r15b, 1004(%r13,%r8)	# 8945	[c=4 l=8]  *movqi_internal/8
+	subl	5176(%r13), %eax	# 8947	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 8948	[c=13 l=7]  *cmpsi_1/1
+	jb	.L768	# 8949	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%r13)	# 8951	[c=13 l=8]  *cmpqi_ccno_1/1
+	jne	.L769	# 8952	[c=13 l=6]  *jcc
+.L768:
+	movq	1040(%r13), %rax	# 8955	[c=9 l=7]  *movdi_internal/3
+	movzbl	63(%rax), %r14d	# 8956	[c=13 l=5]  *zero_extendqisi2/0
+.L770:
+	movl	%r14d, %ecx	# 8967	[c=4 l=3]  *movsi_internal/0
+	movl	$63, %edx	# 8968	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 8971	[c=4 l=3]  *movdi_internal/3
+	movslq	%r15d, %r15	# 8975	[c=4 l=3]  *extendsidi2_rex64/1
+	leaq	.LC32(%rip), %rsi	# 8969	[c=1 l=7]  *movdi_internal/4
+	andl	$-31, %r14d	# 8973	[c=4 l=4]  *andsi_1/0
+	call	log_add_data_mov@PLT	# 8972	[c=0 l=5]  *call
+	leaq	flag_update_table_logical(%rip), %rax	# 16555	[c=1 l=7]  *movdi_internal/4
+	movl	$63, %edx	# 8980	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 8983	[c=4 l=3]  *movdi_internal/3
+	movzbl	(%rax,%r15), %eax	# 8976	[c=13 l=5]  *zero_extendqisi2/0
+	leaq	.LC28(%rip), %rsi	# 8981	[c=1 l=7]  *movdi_internal/4
+	orl	%eax, %r14d	# 8977	[c=4 l=3]  *iorsi_1/0
+	movzbl	%r14b, %ecx	# 8978	[c=4 l=4]  *zero_extendqisi2/0
+	call	log_add_data_mov@PLT	# 8984	[c=0 l=5]  *call
+	movl	$63, %eax	# 8985	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 8986	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 8987	[c=13 l=7]  *cmpsi_1/1
+	jb	.L771	# 8988	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%r13)	# 8990	[c=13 l=8]  *cmpqi_ccno_1/1
+	jne	.L772	# 8991	[c=13 l=6]  *jcc
+.L771:
+	movq	1040(%r13), %rax	# 8994	[c=9 l=7]  *movdi_internal/3
+	movb	%r14b, 63(%rax)	# 8995	[c=4 l=4]  *movqi_internal/8
+.L773:
+	movq	%r13, %rdi	# 9007	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 9006	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 9008	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 17250	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 17251	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 9010	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18252	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 9011	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 9013	[c=4 l=3]  *cmpdi_1/0
+	jb	.L283	# 9014	[c=13 l=6]  *jcc
+	movl	0(%r13), %ebx	# 9016	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 9021	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 9017	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 9019	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 9020	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 9022	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 9023	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 9024	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 9027	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 17252	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 9028	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 9031	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 9032	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 19306	[c=10 l=4]  *indirect_jump
+.L774:
+	movzbl	10(%rbx), %r9d	# 9042	[c=13 l=5]  zero_extendqidi2/0
+	movzwl	12(%rbx), %r14d	# 9040	[c=13 l=5]  *zero_extendhisi2/0
+	xorl	%eax, %eax	# 19305	[c=4 l=2]  *movdi_xor
+	movq	%r13, %rdi	# 9049	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC43(%rip), %rsi	# 9047	[c=1 l=7]  *movdi_internal/4
+	movzbl	1004(%r13,%r9), %ecx	# 9044	[c=14 l=9]  *zero_extendqisi2/0
+	movq	%r9, %r15	# 18584	[c=4 l=3]  *movdi_internal/3
+	movl	%r9d, %edx	# 9046	[c=4 l=3]  *movsi_internal/0
+	movq	%r9, 8(%rsp)	# 17970	[c=4 l=5]  *movdi_internal/5
+	movw	%r14w, 16(%rsp)	# 17972	[c=4 l=6]  *movhi_internal/3
+	call	log_append@PLT	# 9051	[c=0 l=5]  *call
+	cmpl	$15, %r15d	# 9054	[c=4 l=4]  *cmpsi_1/0
+	movq	8(%rsp), %r9	# 17971	[c=9 l=5]  *movdi_internal/3
+	jle	.L1502	# 9055	[c=13 l=6]  *jcc
+	cmpl	$63, %r14d	# 15377	[c=4 l=4]  *cmpsi_1/0
+	leaq	.LC29(%rip), %rdx	# 16613	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 9078	[c=4 l=3]  *movdi_internal/3
+	movzbl	1004(%r13,%r9), %ecx	# 9068	[c=14 l=9]  *zero_extendqisi2/0
+	leaq	.LC28(%rip), %rsi	# 16612	[c=1 l=7]  *movdi_internal/4
+	cmovne	%rdx, %rsi	# 15378	[c=8 l=4]  *movdicc_noc/1
+	movl	%r14d, %edx	# 9076	[c=4 l=3]  *movsi_internal/0
+	movl	%ecx, 8(%rsp)	# 17973	[c=4 l=4]  *movsi_internal/1
+	movl	%ecx, %r15d	# 18585	[c=4 l=3]  *movsi_internal/0
+	call	log_add_data_mov@PLT	# 9079	[c=0 l=5]  *call
+	movl	%r14d, %edx	# 17257	[c=4 l=3]  *movsi_internal/0
+	subl	5176(%r13), %edx	# 9081	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %edx	# 9082	[c=13 l=7]  *cmpsi_1/1
+	jb	.L777	# 9083	[c=13 l=2]  *jcc
+	movl	%r14d, %edx	# 17259	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %edx	# 9085	[c=4 l=3]  *ashrsi3_1/0
+	movslq	%edx, %rdx	# 9086	[c=4 l=3]  *extendsidi2_rex64/1
+	cmpb	$0, 1080(%r13,%rdx)	# 9087	[c=14 l=9]  *cmpqi_ccno_1/1
+	jne	.L778	# 9088	[c=13 l=6]  *jcc
+.L777:
+	movzwl	16(%rsp), %r14d	# 9091	[c=13 l=6]  zero_extendhidi2/0
+	movq	1040(%r13), %rdx	# 9092	[c=9 l=7]  *movdi_internal/3
+	movb	%r15b, (%rdx,%r14)	# 9093	[c=4 l=4]  *movqi_internal/8
+.L779:
+	movq	%r13, %rdi	# 9105	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 9104	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 9106	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 17262	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 17263	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 9108	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18251	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 9109	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 9111	[c=4 l=3]  *cmpdi_1/0
+	jb	.L283	# 9112	[c=13 l=6]  *jcc
+	movl	0(%r13), %ebx	# 9114	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 9119	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 9115	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 9117	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 9118	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 9120	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 9121	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 9122	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 9125	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 17264	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 9126	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 9129	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 9130	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 19303	[c=10 l=4]  *indirect_jump
+.L780:
+	movl	5176(%r13), %ecx	# 9139	[c=9 l=7]  *movsi_internal/0
+	movl	$61, %eax	# 9141	[c=4 l=5]  *movsi_internal/0
+	movzbl	10(%rbx), %r14d	# 9138	[c=13 l=5]  zero_extendqidi2/0
+	movl	5180(%r13), %r15d	# 9140	[c=9 l=7]  *movsi_internal/0
+	subl	%ecx, %eax	# 9142	[c=4 l=2]  *subsi_1/0
+	cmpl	%r15d, %eax	# 9143	[c=4 l=3]  *cmpsi_1/0
+	jb	.L781	# 9144	[c=13 l=6]  *jcc
+	cmpb	$1, 1081(%r13)	# 9148	[c=13 l=8]  *cmpqi_1/0
+	ja	.L1503	# 9149	[c=13 l=6]  *jcc
+	movq	1040(%r13), %rax	# 14408	[c=9 l=7]  *movdi_internal/3
+	movzbl	61(%rax), %edx	# 14409	[c=13 l=4]  *zero_extendqisi2/0
+.L783:
+	movzbl	62(%rax), %r15d	# 9186	[c=13 l=5]  *zero_extendqisi2/0
+.L785:
+	sall	$8, %r15d	# 9189	[c=4 l=4]  *ashlsi3_1/0
+	leaq	.LC30(%rip), %rsi	# 9193	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 9195	[c=4 l=3]  *movdi_internal/3
+	orl	%edx, %r15d	# 9190	[c=4 l=3]  *iorsi_1/0
+	movl	$61, %edx	# 9192	[c=4 l=5]  *movsi_internal/0
+	movl	%r15d, %ecx	# 9191	[c=4 l=3]  *movsi_internal/0
+	call	log_add_data_mov@PLT	# 9196	[c=0 l=5]  *call
+	leal	1(%r15), %r8d	# 18250	[c=4 l=4]  *leasi
+	movl	$61, %edx	# 9200	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 9203	[c=4 l=3]  *movdi_internal/3
+	movzwl	%r8w, %r15d	# 9198	[c=4 l=4]  *zero_extendhisi2/0
+	leaq	.LC31(%rip), %rsi	# 9201	[c=1 l=7]  *movdi_internal/4
+	movl	%r8d, 8(%rsp)	# 17980	[c=4 l=5]  *movsi_internal/1
+	movl	%r15d, %ecx	# 9199	[c=4 l=3]  *movsi_internal/0
+	call	log_add_data_mov@PLT	# 9204	[c=0 l=5]  *call
+	movl	$61, %eax	# 9205	[c=4 l=5]  *movsi_internal/0
+	movl	8(%rsp), %r8d	# 17981	[c=9 l=5]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 9206	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 9207	[c=13 l=7]  *cmpsi_1/1
+	jb	.L786	# 9208	[c=13 l=2]  *jcc
+	cmpb	$1, 1081(%r13)	# 9212	[c=13 l=8]  *cmpqi_1/0
+	ja	.L1504	# 9213	[c=13 l=6]  *jcc
+.L786:
+	movq	1040(%r13), %rax	# 9224	[c=9 l=7]  *movdi_internal/3
+	movb	%r8b, 61(%rax)	# 9225	[c=4 l=4]  *movqi_internal/8
+.L787:
+	movl	$62, %eax	# 9229	[c=4 l=5]  *movsi_internal/0
+	sarl	$8, %r15d	# 9228	[c=4 l=4]  *ashrsi3_1/0
+	subl	5176(%r13), %eax	# 9230	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 9231	[c=13 l=7]  *cmpsi_1/1
+	jb	.L788	# 9232	[c=13 l=2]  *jcc
+	cmpb	$1, 1081(%r13)	# 9236	[c=13 l=8]  *cmpqi_1/0
+	ja	.L1505	# 9237	[c=13 l=6]  *jcc
+.L788:
+	movq	1040(%r13), %rax	# 9247	[c=9 l=7]  *movdi_internal/3
+	movb	%r15b, 62(%rax)	# 9248	[c=4 l=4]  *movqi_internal/8
+.L789:
+	movl	%r8d, %eax	# 17266	[c=4 l=3]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 9251	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 9252	[c=13 l=7]  *cmpsi_1/1
+	jb	.L790	# 9253	[c=13 l=2]  *jcc
+	movl	%r8d, %eax	# 17268	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %eax	# 9255	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 16522	[c=5 l=5]  *andsi_1_zext
+	cmpb	$0, 1080(%r13,%rax)	# 9258	[c=14 l=9]  *cmpqi_ccno_1/1
+	jne	.L791	# 9259	[c=13 l=6]  *jcc
+.L790:
+	movq	1040(%r13), %rdx	# 9263	[c=9 l=7]  *movdi_internal/3
+	movslq	%r8d, %rax	# 9262	[c=4 l=3]  *extendsidi2_rex64/1
+	movzbl	(%rdx,%rax), %r15d	# 9264	[c=13 l=5]  *zero_extendqisi2/0
+.L792:
+	cmpl	$63, %r8d	# 15389	[c=4 l=4]  *cmpsi_1/0
+	movl	%r15d, %ecx	# 9280	[c=4 l=3]  *movsi_internal/0
+	movl	%r8d, %edx	# 9281	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 9283	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC33(%rip), %rax	# 16615	[c=1 l=7]  *movdi_internal/4
+	leaq	.LC32(%rip), %rsi	# 16614	[c=1 l=7]  *movdi_internal/4
+	cmovne	%rax, %rsi	# 15390	[c=8 l=4]  *movdicc_noc/1
+	call	log_add_data_mov@PLT	# 9284	[c=0 l=5]  *call
+	xorl	%eax, %eax	# 19302	[c=4 l=2]  *movdi_xor
+	movzbl	%r15b, %ecx	# 9286	[c=4 l=4]  *zero_extendqisi2/0
+	movl	%r14d, %edx	# 9288	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC61(%rip), %rsi	# 9289	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 9291	[c=4 l=3]  *movdi_internal/3
+	call	log_append@PLT	# 9293	[c=0 l=5]  *call
+	cmpl	$15, %r14d	# 9296	[c=4 l=4]  *cmpsi_1/0
+	jle	.L1506	# 9297	[c=13 l=6]  *jcc
+	movb	%r15b, 1004(%r13,%r14)	# 9310	[c=4 l=8]  *movqi_internal/8
+	movq	%r13, %rdi	# 9312	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 9311	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 9313	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 17270	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 17271	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 9315	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18249	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 9316	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 9318	[c=4 l=3]  *cmpdi_1/0
+	jb	.L283	# 9319	[c=13 l=6]  *jcc
+	movl	0(%r13), %ebx	# 9321	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 9326	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 9322	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 9324	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 9325	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 9327	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 9328	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 9329	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 9332	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 17272	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 9333	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 9336	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 9337	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 19300	[c=10 l=4]  *indirect_jump
+.L795:
+	movzbl	10(%rbx), %r15d	# 9345	[c=13 l=5]  zero_extendqidi2/0
+	xorl	%eax, %eax	# 19299	[c=4 l=2]  *movdi_xor
+	leaq	.LC43(%rip), %rsi	# 9350	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 9352	[c=4 l=3]  *movdi_internal/3
+	movzbl	1004(%r13,%r15), %ecx	# 9347	[c=14 l=9]  *zero_extendqisi2/0
+	movl	%r15d, %edx	# 9349	[c=4 l=3]  *movsi_internal/0
+	call	log_append@PLT	# 9354	[c=0 l=5]  *call
+	cmpl	$15, %r15d	# 9357	[c=4 l=4]  *cmpsi_1/0
+	jle	.L1507	# 9358	[c=13 l=6]  *jcc
+	movzbl	1004(%r13,%r15), %eax	# 9371	[c=14 l=9]  *zero_extendqisi2/0
+	movl	5176(%r13), %esi	# 9373	[c=9 l=7]  *movsi_internal/0
+	movl	$62, %edx	# 9375	[c=4 l=5]  *movsi_internal/0
+	movl	5180(%r13), %ecx	# 9374	[c=9 l=7]  *movsi_internal/0
+	movl	%eax, 16(%rsp)	# 17274	[c=4 l=4]  *movsi_internal/1
+	movl	%eax, %r15d	# 18587	[c=4 l=3]  *movsi_internal/0
+	movl	$61, %eax	# 9377	[c=4 l=5]  *movsi_internal/0
+	subl	%esi, %edx	# 9376	[c=4 l=2]  *subsi_1/0
+	subl	%esi, %eax	# 9378	[c=4 l=2]  *subsi_1/0
+	cmpl	%ecx, %eax	# 9379	[c=4 l=2]  *cmpsi_1/0
+	jb	.L797	# 9380	[c=13 l=6]  *jcc
+	cmpb	$1, 1081(%r13)	# 9384	[c=13 l=8]  *cmpqi_1/0
+	ja	.L1508	# 9385	[c=13 l=6]  *jcc
+	movq	1040(%r13), %rax	# 14414	[c=9 l=7]  *movdi_internal/3
+	movzbl	61(%rax), %r14d	# 14415	[c=13 l=5]  *zero_extendqisi2/0
+.L799:
+	movzbl	62(%rax), %eax	# 9418	[c=13 l=4]  *zero_extendqisi2/0
+.L801:
+	sall	$8, %eax	# 9421	[c=4 l=3]  *ashlsi3_1/0
+	movl	$61, %edx	# 9424	[c=4 l=5]  *movsi_internal/0
+	leaq	.LC30(%rip), %rsi	# 9425	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 9427	[c=4 l=3]  *movdi_internal/3
+	orl	%eax, %r14d	# 9422	[c=4 l=3]  *iorsi_1/0
+	movl	%r14d, %ecx	# 9423	[c=4 l=3]  *movsi_internal/0
+	call	log_add_data_mov@PLT	# 9428	[c=0 l=5]  *call
+	cmpl	996(%r13), %r14d	# 9430	[c=13 l=7]  *cmpsi_1/1
+	jb	.L1509	# 9431	[c=13 l=6]  *jcc
+	cmpl	$63, %r14d	# 15401	[c=4 l=4]  *cmpsi_1/0
+	leal	-1(%r14), %eax	# 18248	[c=4 l=4]  *leasi
+	movzbl	%r15b, %ecx	# 18192	[c=4 l=4]  *zero_extendqisi2/0
+	movq	%r13, %rdi	# 9448	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC29(%rip), %rdx	# 16617	[c=1 l=7]  *movdi_internal/4
+	leaq	.LC28(%rip), %rsi	# 16616	[c=1 l=7]  *movdi_internal/4
+	movl	%eax, 8(%rsp)	# 17275	[c=4 l=4]  *movsi_internal/1
+	cmovne	%rdx, %rsi	# 15402	[c=8 l=4]  *movdicc_noc/1
+	movl	%r14d, %edx	# 9446	[c=4 l=3]  *movsi_internal/0
+	call	log_add_data_mov@PLT	# 9449	[c=0 l=5]  *call
+	movl	%r14d, %edx	# 17276	[c=4 l=3]  *movsi_internal/0
+	subl	5176(%r13), %edx	# 9450	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %edx	# 9451	[c=13 l=7]  *cmpsi_1/1
+	jb	.L804	# 9452	[c=13 l=2]  *jcc
+	movl	%r14d, %edx	# 17278	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %edx	# 9454	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %edx	# 16521	[c=5 l=6]  *andsi_1_zext
+	cmpb	$0, 1080(%r13,%rdx)	# 9457	[c=14 l=9]  *cmpqi_ccno_1/1
+	jne	.L805	# 9458	[c=13 l=6]  *jcc
+.L804:
+	movq	1040(%r13), %rdx	# 9462	[c=9 l=7]  *movdi_internal/3
+	movslq	%r14d, %rax	# 9461	[c=4 l=3]  *extendsidi2_rex64/1
+	movb	%r15b, (%rdx,%rax)	# 9463	[c=4 l=4]  *movqi_internal/8
+.L806:
+	movl	8(%rsp), %r14d	# 17990	[c=9 l=5]  *movsi_internal/0
+	movl	$61, %edx	# 9476	[c=4 l=5]  *movsi_internal/0
+	leaq	.LC31(%rip), %rsi	# 9477	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 9479	[c=4 l=3]  *movdi_internal/3
+	movzwl	%r14w, %r15d	# 9474	[c=4 l=4]  *zero_extendhisi2/0
+	movl	%r15d, %ecx	# 9475	[c=4 l=3]  *movsi_internal/0
+	call	log_add_data_mov@PLT	# 9480	[c=0 l=5]  *call
+	movl	$61, %eax	# 9481	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 9482	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 9483	[c=13 l=7]  *cmpsi_1/1
+	jb	.L807	# 9484	[c=13 l=2]  *jcc
+	cmpb	$1, 1081(%r13)	# 9488	[c=13 l=8]  *cmpqi_1/0
+	ja	.L1510	# 9489	[c=13 l=6]  *jcc
+.L807:
+	movq	1040(%r13), %rax	# 9500	[c=9 l=7]  *movdi_internal/3
+	movzbl	8(%rsp), %edi	# 17280	[c=9 l=5]  *movqi_internal/4
+	movb	%dil, 61(%rax)	# 9501	[c=4 l=4]  *movqi_internal/8
+.L808:
+	movl	$62, %eax	# 9505	[c=4 l=5]  *movsi_internal/0
+	sarl	$8, %r15d	# 9504	[c=4 l=4]  *ashrsi3_1/0
+	subl	5176(%r13), %eax	# 9506	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 9507	[c=13 l=7]  *cmpsi_1/1
+	jb	.L809	# 9508	[c=13 l=2]  *jcc
+	cmpb	$1, 1081(%r13)	# 9512	[c=13 l=8]  *cmpqi_1/0
+	ja	.L1511	# 9513	[c=13 l=6]  *jcc
+.L809:
+	movq	1040(%r13), %rax	# 9523	[c=9 l=7]  *movdi_internal/3
+	movb	%r15b, 62(%rax)	# 9524	[c=4 l=4]  *movqi_internal/8
+.L810:
+	movq	%r13, %rdi	# 9528	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 9527	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 9529	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 17281	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 17282	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 9531	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18247	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 9532	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 9534	[c=4 l=3]  *cmpdi_1/0
+	jb	.L283	# 9535	[c=13 l=6]  *jcc
+	movl	0(%r13), %ebx	# 9537	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 9542	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 9538	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 9540	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 9541	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 9543	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 9544	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 9545	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 9548	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 17283	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 9549	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 9552	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 9553	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 19297	[c=10 l=4]  *indirect_jump
+.L811:
+	movzwl	12(%rbx), %eax	# 9561	[c=9 l=4]  *movhi_internal/2
+	movl	5176(%r13), %ecx	# 9562	[c=9 l=7]  *movsi_internal/0
+	movl	5180(%r13), %r14d	# 9563	[c=9 l=7]  *movsi_internal/0
+	movw	%ax, 8(%rsp)	# 17285	[c=4 l=5]  *movhi_internal/3
+	movl	$61, %eax	# 9564	[c=4 l=5]  *movsi_internal/0
+	subl	%ecx, %eax	# 9565	[c=4 l=2]  *subsi_1/0
+	cmpl	%r14d, %eax	# 9566	[c=4 l=3]  *cmpsi_1/0
+	jb	.L812	# 9567	[c=13 l=6]  *jcc
+	cmpb	$1, 1081(%r13)	# 9571	[c=13 l=8]  *cmpqi_1/0
+	ja	.L1512	# 9572	[c=13 l=6]  *jcc
+	movq	1040(%r13), %rax	# 14420	[c=9 l=7]  *movdi_internal/3
+	movzbl	61(%rax), %r15d	# 14421	[c=13 l=5]  *zero_extendqisi2/0
+.L814:
+	movzbl	62(%rax), %eax	# 9609	[c=13 l=4]  *zero_extendqisi2/0
+.L816:
+	sall	$8, %eax	# 9612	[c=4 l=3]  *ashlsi3_1/0
+	movl	$61, %edx	# 9615	[c=4 l=5]  *movsi_internal/0
+	leaq	.LC30(%rip), %rsi	# 9616	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 9618	[c=4 l=3]  *movdi_internal/3
+	orl	%eax, %r15d	# 9613	[c=4 l=3]  *iorsi_1/0
+	movl	%r15d, %ecx	# 9614	[c=4 l=3]  *movsi_internal/0
+	call	log_add_data_mov@PLT	# 9619	[c=0 l=5]  *call
+	movl	996(%r13), %edx	# 9621	[c=9 l=7]  *movsi_internal/0
+	movzbl	840(%r13), %eax	# 9623	[c=13 l=8]  *zero_extendqisi2/0
+	leal	1(%rdx,%rax), %eax	# 9624	[c=5 l=4]  *leasi
+	cmpl	%eax, %r15d	# 9625	[c=4 l=3]  *cmpsi_1/0
+	jb	.L1513	# 9626	[c=13 l=6]  *jcc
+	cmpl	$63, %r15d	# 15413	[c=4 l=4]  *cmpsi_1/0
+	movl	0(%r13), %r14d	# 9634	[c=5 l=4]  *movsi_internal/0
+	leal	-1(%r15), %r9d	# 18246	[c=4 l=4]  *leasi
+	movl	%r15d, %edx	# 9643	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC29(%rip), %rax	# 16619	[c=1 l=7]  *movdi_internal/4
+	leaq	.LC28(%rip), %rsi	# 16618	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 9645	[c=4 l=3]  *movdi_internal/3
+	movl	%r9d, 16(%rsp)	# 17993	[c=4 l=5]  *movsi_internal/1
+	cmovne	%rax, %rsi	# 15414	[c=8 l=4]  *movdicc_noc/1
+	movzbl	%r14b, %ecx	# 9636	[c=4 l=4]  *zero_extendqisi2/0
+	call	log_add_data_mov@PLT	# 9646	[c=0 l=5]  *call
+	movl	%r15d, %eax	# 17286	[c=4 l=3]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 9647	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 9648	[c=13 l=7]  *cmpsi_1/1
+	movl	16(%rsp), %r9d	# 17994	[c=9 l=5]  *movsi_internal/0
+	jb	.L819	# 9649	[c=13 l=2]  *jcc
+	movl	%r15d, %eax	# 17288	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %eax	# 9651	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 16520	[c=5 l=5]  *andsi_1_zext
+	cmpb	$0, 1080(%r13,%rax)	# 9654	[c=14 l=9]  *cmpqi_ccno_1/1
+	jne	.L820	# 9655	[c=13 l=6]  *jcc
+.L819:
+	movq	1040(%r13), %rdx	# 9659	[c=9 l=7]  *movdi_internal/3
+	movslq	%r15d, %rax	# 9658	[c=4 l=3]  *extendsidi2_rex64/1
+	movb	%r14b, (%rdx,%rax)	# 9660	[c=4 l=4]  *movqi_internal/8
+.L821:
+	movl	0(%r13), %ecx	# 9671	[c=5 l=4]  *movsi_internal/0
+	movl	%r9d, %edx	# 9681	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 9683	[c=4 l=3]  *movdi_internal/3
+	movl	%r9d, 24(%rsp)	# 17997	[c=4 l=5]  *movsi_internal/1
+	leaq	.LC28(%rip), %rsi	# 16620	[c=1 l=7]  *movdi_internal/4
+	leal	-2(%r15), %r14d	# 18245	[c=4 l=4]  *leasi
+	movl	%ecx, %eax	# 17290	[c=4 l=2]  *movsi_internal/0
+	movzbl	%ch, %ecx	# 9674	[c=4 l=3]  *extzvsi
+	shrl	$8, %eax	# 9672	[c=4 l=3]  *lshrsi3_1/0
+	cmpl	$63, %r9d	# 15425	[c=4 l=4]  *cmpsi_1/0
+	movl	%eax, 16(%rsp)	# 17291	[c=4 l=4]  *movsi_internal/1
+	leaq	.LC29(%rip), %rax	# 16621	[c=1 l=7]  *movdi_internal/4
+	cmovne	%rax, %rsi	# 15426	[c=8 l=4]  *movdicc_noc/1
+	call	log_add_data_mov@PLT	# 9684	[c=0 l=5]  *call
+	movslq	24(%rsp), %r9	# 17998	[c=13 l=5]  *extendsidi2_rex64/1
+	movl	%r9d, %eax	# 17292	[c=4 l=3]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 9685	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 9686	[c=13 l=7]  *cmpsi_1/1
+	jb	.L823	# 9687	[c=13 l=2]  *jcc
+	movl	%r9d, %eax	# 17294	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %eax	# 9689	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 16519	[c=5 l=5]  *andsi_1_zext
+	cmpb	$0, 1080(%r13,%rax)	# 9692	[c=14 l=9]  *cmpqi_ccno_1/1
+	jne	.L824	# 9693	[c=13 l=6]  *jcc
+.L823:
+	movq	1040(%r13), %rax	# 9697	[c=9 l=7]  *movdi_internal/3
+	movzbl	16(%rsp), %edi	# 17296	[c=9 l=5]  *movqi_internal/4
+	movb	%dil, (%rax,%r9)	# 9698	[c=4 l=4]  *movqi_internal/8
+.L825:
+	cmpb	$0, 840(%r13)	# 9709	[c=13 l=8]  *cmpqi_ccno_1/1
+	je	.L826	# 9710	[c=13 l=2]  *jcc
+	movl	0(%r13), %eax	# 17297	[c=5 l=4]  *movsi_internal/0
+	subl	$3, %r15d	# 9714	[c=4 l=4]  *addsi_1/0
+	movq	%r13, %rdi	# 9724	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC29(%rip), %rdx	# 16623	[c=1 l=7]  *movdi_internal/4
+	leaq	.LC28(%rip), %rsi	# 16622	[c=1 l=7]  *movdi_internal/4
+	shrl	$16, %eax	# 9713	[c=4 l=3]  *lshrsi3_1/0
+	cmpl	$63, %r14d	# 15437	[c=4 l=4]  *cmpsi_1/0
+	cmovne	%rdx, %rsi	# 15438	[c=8 l=4]  *movdicc_noc/1
+	movzbl	%al, %ecx	# 9715	[c=4 l=3]  *zero_extendqisi2/0
+	movl	%r14d, %edx	# 9722	[c=4 l=3]  *movsi_internal/0
+	movl	%eax, 16(%rsp)	# 17999	[c=4 l=4]  *movsi_internal/1
+	call	log_add_data_mov@PLT	# 9725	[c=0 l=5]  *call
+	movl	%r14d, %edx	# 17299	[c=4 l=3]  *movsi_internal/0
+	subl	5176(%r13), %edx	# 9726	[c=13 l=7]  *subsi_1/1
+	movl	16(%rsp), %eax	# 18000	[c=9 l=4]  *movsi_internal/0
+	cmpl	5180(%r13), %edx	# 9727	[c=13 l=7]  *cmpsi_1/1
+	jb	.L828	# 9728	[c=13 l=2]  *jcc
+	movl	%r14d, %edx	# 17301	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %edx	# 9730	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %edx	# 16518	[c=5 l=6]  *andsi_1_zext
+	cmpb	$0, 1080(%r13,%rdx)	# 9733	[c=14 l=9]  *cmpqi_ccno_1/1
+	jne	.L829	# 9734	[c=13 l=6]  *jcc
+.L828:
+	movq	1040(%r13), %rdx	# 9738	[c=9 l=7]  *movdi_internal/3
+	movslq	%r14d, %r14	# 9737	[c=4 l=3]  *extendsidi2_rex64/1
+	movb	%al, (%rdx,%r14)	# 9739	[c=4 l=4]  *movqi_internal/8
+.L830:
+	movl	%r15d, %r14d	# 71	[c=4 l=3]  *movsi_internal/0
+.L826:
+	movzwl	%r14w, %r15d	# 9754	[c=4 l=4]  *zero_extendhisi2/0
+	movl	$61, %edx	# 9756	[c=4 l=5]  *movsi_internal/0
+	leaq	.LC31(%rip), %rsi	# 9757	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 9759	[c=4 l=3]  *movdi_internal/3
+	movl	%r15d, %ecx	# 9755	[c=4 l=3]  *movsi_internal/0
+	call	log_add_data_mov@PLT	# 9760	[c=0 l=5]  *call
+	movl	$61, %edx	# 9761	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r13), %edx	# 9762	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %edx	# 9763	[c=13 l=7]  *cmpsi_1/1
+	jb	.L831	# 9764	[c=13 l=2]  *jcc
+	cmpb	$1, 1081(%r13)	# 9768	[c=13 l=8]  *cmpqi_1/0
+	ja	.L1514	# 9769	[c=13 l=6]  *jcc
+.L831:
+	movq	1040(%r13), %rdx	# 9780	[c=9 l=7]  *movdi_internal/3
+	movb	%r14b, 61(%rdx)	# 9781	[c=4 l=4]  *movqi_internal/8
+.L832:
+	movl	%r15d, %eax	# 17303	[c=4 l=3]  *movsi_internal/0
+	movl	$62, %edx	# 9785	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r13), %edx	# 9786	[c=13 l=7]  *subsi_1/1
+	sarl	$8, %eax	# 9784	[c=4 l=3]  *ashrsi3_1/0
+	cmpl	5180(%r13), %edx	# 9787	[c=13 l=7]  *cmpsi_1/1
+	jb	.L833	# 9788	[c=13 l=2]  *jcc
+	cmpb	$1, 1081(%r13)	# 9792	[c=13 l=8]  *cmpqi_1/0
+	ja	.L1515	# 9793	[c=13 l=6]  *jcc
+.L833:
+	movq	1040(%r13), %rdx	# 9803	[c=9 l=7]  *movdi_internal/3
+	movb	%al, 62(%rdx)	# 9804	[c=4 l=3]  *movqi_internal/8
+.L834:
+	movswl	8(%rsp), %eax	# 9807	[c=13 l=5]  extendhisi2/1
+	addl	0(%r13), %eax	# 9809	[c=9 l=4]  *addsi_1/1
+	movq	%r13, %rdi	# 9817	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 9816	[c=4 l=3]  *movdi_internal/3
+	andl	992(%r13), %eax	# 9812	[c=13 l=7]  *andsi_1/1
+	movl	%eax, 0(%r13)	# 9813	[c=4 l=4]  *movsi_internal/1
+	movzbl	840(%r13), %eax	# 9814	[c=13 l=8]  zero_extendqidi2/0
+	addq	%rax, 48(%r13)	# 9815	[c=13 l=4]  *adddi_1/0
+	call	log_dump_line@PLT	# 9818	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 17306	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 17307	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 9820	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18244	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 9821	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 9823	[c=4 l=3]  *cmpdi_1/0
+	jb	.L283	# 9824	[c=13 l=6]  *jcc
+	movq	56(%r13), %rax	# 17308	[c=9 l=4]  *movdi_internal/3
+	cmpq	%rax, 48(%r13)	# 9827	[c=13 l=4]  *cmpdi_1/0
+	jnb	.L1516	# 9828	[c=13 l=6]  *jcc
+.L835:
+	movq	%r13, %rdi	# 9834	[c=4 l=3]  *movdi_internal/3
+	call	log_is_idle@PLT	# 9835	[c=10 l=5]  *call_value
+	testb	%al, %al	# 9837	[c=4 l=2]  *cmpqi_ccno_1/0
+	jne	.L1517	# 9838	[c=13 l=6]  *jcc
+.L836:
+	movl	0(%r13), %ebx	# 9849	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 9854	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 9850	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 9852	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 9853	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 9855	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 9856	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 9857	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 9860	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 17309	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 9861	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 9864	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 9865	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 19296	[c=10 l=4]  *indirect_jump
+.L837:
+	movl	5176(%r13), %r15d	# 9873	[c=9 l=7]  *movsi_internal/0
+	movl	$61, %eax	# 9875	[c=4 l=5]  *movsi_internal/0
+	movl	5180(%r13), %r14d	# 9874	[c=9 l=7]  *movsi_internal/0
+	subl	%r15d, %eax	# 9876	[c=4 l=3]  *subsi_1/0
+	cmpl	%r14d, %eax	# 9877	[c=4 l=3]  *cmpsi_1/0
+	jb	.L838	# 9878	[c=13 l=6]  *jcc
+	cmpb	$1, 1081(%r13)	# 9882	[c=13 l=8]  *cmpqi_1/0
+	ja	.L1518	# 9883	[c=13 l=6]  *jcc
+	movq	1040(%r13), %rax	# 14426	[c=9 l=7]  *movdi_internal/3
+	movzbl	61(%rax), %edx	# 14427	[c=13 l=4]  *zero_extendqisi2/0
+.L840:
+	movzbl	62(%rax), %eax	# 9920	[c=13 l=4]  *zero_extendqisi2/0
+.L842:
+	sall	$8, %eax	# 9923	[c=4 l=3]  *ashlsi3_1/0
+	leaq	.LC30(%rip), %rsi	# 9927	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 9929	[c=4 l=3]  *movdi_internal/3
+	orl	%edx, %eax	# 9924	[c=4 l=2]  *iorsi_1/0
+	movl	$61, %edx	# 9926	[c=4 l=5]  *movsi_internal/0
+	movl	%eax, %ecx	# 9925	[c=4 l=2]  *movsi_internal/0
+	movl	%eax, %r15d	# 17312	[c=4 l=3]  *movsi_internal/0
+	call	log_add_data_mov@PLT	# 9930	[c=0 l=5]  *call
+	xorl	%r8d, %r8d	# 19295	[c=4 l=3]  *movdi_xor
+	cmpb	$0, 840(%r13)	# 9931	[c=13 l=8]  *cmpqi_ccno_1/1
+	je	.L843	# 9932	[c=13 l=2]  *jcc
+	addl	$1, %r15d	# 9934	[c=4 l=4]  *addsi_1/0
+	movl	%r15d, %eax	# 17313	[c=4 l=3]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 9935	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 9936	[c=13 l=7]  *cmpsi_1/1
+	jb	.L844	# 9937	[c=13 l=2]  *jcc
+	movl	%r15d, %eax	# 17315	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %eax	# 9939	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 16517	[c=5 l=5]  *andsi_1_zext
+	cmpb	$0, 1080(%r13,%rax)	# 9942	[c=14 l=9]  *cmpqi_ccno_1/1
+	jne	.L845	# 9943	[c=13 l=6]  *jcc
+.L844:
+	movq	1040(%r13), %rdx	# 9947	[c=9 l=7]  *movdi_internal/3
+	movslq	%r15d, %rax	# 9946	[c=4 l=3]  *extendsidi2_rex64/1
+	movzbl	(%rdx,%rax), %r14d	# 9948	[c=13 l=5]  *zero_extendqisi2/0
+.L846:
+	cmpl	$63, %r15d	# 15449	[c=4 l=4]  *cmpsi_1/0
+	movl	%r14d, %ecx	# 9964	[c=4 l=3]  *movsi_internal/0
+	movl	%r15d, %edx	# 9965	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 9967	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC33(%rip), %rax	# 16625	[c=1 l=7]  *movdi_internal/4
+	leaq	.LC32(%rip), %rsi	# 16624	[c=1 l=7]  *movdi_internal/4
+	cmovne	%rax, %rsi	# 15450	[c=8 l=4]  *movdicc_noc/1
+	call	log_add_data_mov@PLT	# 9968	[c=0 l=5]  *call
+	movl	%r14d, %r8d	# 17317	[c=4 l=3]  *movsi_internal/0
+	sall	$16, %r8d	# 9969	[c=4 l=4]  *ashlsi3_1/0
+.L843:
+	leal	1(%r15), %edx	# 18243	[c=4 l=4]  *leasi
+	movl	%edx, %eax	# 17319	[c=4 l=2]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 9973	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 9974	[c=13 l=7]  *cmpsi_1/1
+	jb	.L848	# 9975	[c=13 l=2]  *jcc
+	movl	%edx, %eax	# 17321	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %eax	# 9977	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 16516	[c=5 l=5]  *andsi_1_zext
+	cmpb	$0, 1080(%r13,%rax)	# 9980	[c=14 l=9]  *cmpqi_ccno_1/1
+	jne	.L849	# 9981	[c=13 l=6]  *jcc
+.L848:
+	movq	1040(%r13), %rcx	# 9985	[c=9 l=7]  *movdi_internal/3
+	movslq	%edx, %rax	# 9984	[c=4 l=3]  *extendsidi2_rex64/1
+	movzbl	(%rcx,%rax), %r14d	# 9986	[c=13 l=5]  *zero_extendqisi2/0
+.L850:
+	cmpl	$63, %edx	# 15461	[c=4 l=3]  *cmpsi_1/0
+	leaq	.LC33(%rip), %rax	# 16627	[c=1 l=7]  *movdi_internal/4
+	movl	%r14d, %ecx	# 10002	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 10005	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC32(%rip), %rsi	# 16626	[c=1 l=7]  *movdi_internal/4
+	movl	%r8d, 8(%rsp)	# 18007	[c=4 l=5]  *movsi_internal/1
+	cmovne	%rax, %rsi	# 15462	[c=8 l=4]  *movdicc_noc/1
+	sall	$8, %r14d	# 10007	[c=4 l=4]  *ashlsi3_1/0
+	call	log_add_data_mov@PLT	# 10006	[c=0 l=5]  *call
+	movl	8(%rsp), %r8d	# 18008	[c=9 l=5]  *movsi_internal/0
+	orl	%r8d, %r14d	# 10008	[c=4 l=3]  *iorsi_1/0
+	leal	2(%r15), %r8d	# 18242	[c=4 l=4]  *leasi
+	movl	%r8d, %eax	# 17323	[c=4 l=3]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 10010	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 10011	[c=13 l=7]  *cmpsi_1/1
+	jb	.L852	# 10012	[c=13 l=2]  *jcc
+	movl	%r8d, %eax	# 17325	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %eax	# 10014	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 16515	[c=5 l=5]  *andsi_1_zext
+	cmpb	$0, 1080(%r13,%rax)	# 10017	[c=14 l=9]  *cmpqi_ccno_1/1
+	jne	.L853	# 10018	[c=13 l=6]  *jcc
+.L852:
+	movq	1040(%r13), %rdx	# 10022	[c=9 l=7]  *movdi_internal/3
+	movslq	%r8d, %rax	# 10021	[c=4 l=3]  *extendsidi2_rex64/1
+	movzbl	(%rdx,%rax), %r15d	# 10023	[c=13 l=5]  *zero_extendqisi2/0
+.L854:
+	cmpl	$63, %r8d	# 15473	[c=4 l=4]  *cmpsi_1/0
+	movl	%r8d, %edx	# 10040	[c=4 l=3]  *movsi_internal/0
+	movl	%r15d, %ecx	# 10039	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 10042	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC33(%rip), %rax	# 16629	[c=1 l=7]  *movdi_internal/4
+	leaq	.LC32(%rip), %rsi	# 16628	[c=1 l=7]  *movdi_internal/4
+	movl	%r8d, 8(%rsp)	# 18011	[c=4 l=5]  *movsi_internal/1
+	cmovne	%rax, %rsi	# 15474	[c=8 l=4]  *movdicc_noc/1
+	orl	%r15d, %r14d	# 10044	[c=4 l=3]  *iorsi_1/0
+	call	log_add_data_mov@PLT	# 10043	[c=0 l=5]  *call
+	cmpl	%r14d, 992(%r13)	# 10045	[c=13 l=7]  *cmpsi_1/0
+	movl	8(%rsp), %r8d	# 18012	[c=9 l=5]  *movsi_internal/0
+	jb	.L1519	# 10046	[c=13 l=6]  *jcc
+	movzwl	%r8w, %r15d	# 10054	[c=4 l=4]  *zero_extendhisi2/0
+	movl	$61, %edx	# 10056	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 10059	[c=4 l=3]  *movdi_internal/3
+	movl	%r8d, 8(%rsp)	# 18013	[c=4 l=5]  *movsi_internal/1
+	movl	%r15d, %ecx	# 10055	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC31(%rip), %rsi	# 10057	[c=1 l=7]  *movdi_internal/4
+	call	log_add_data_mov@PLT	# 10060	[c=0 l=5]  *call
+	movl	$61, %eax	# 10061	[c=4 l=5]  *movsi_internal/0
+	movl	8(%rsp), %r8d	# 18014	[c=9 l=5]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 10062	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 10063	[c=13 l=7]  *cmpsi_1/1
+	jb	.L857	# 10064	[c=13 l=2]  *jcc
+	cmpb	$1, 1081(%r13)	# 10068	[c=13 l=8]  *cmpqi_1/0
+	ja	.L1520	# 10069	[c=13 l=6]  *jcc
+.L857:
+	movq	1040(%r13), %rax	# 10080	[c=9 l=7]  *movdi_internal/3
+	movb	%r8b, 61(%rax)	# 10081	[c=4 l=4]  *movqi_internal/8
+.L858:
+	movl	$62, %eax	# 10085	[c=4 l=5]  *movsi_internal/0
+	sarl	$8, %r15d	# 10084	[c=4 l=4]  *ashrsi3_1/0
+	subl	5176(%r13), %eax	# 10086	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 10087	[c=13 l=7]  *cmpsi_1/1
+	jb	.L859	# 10088	[c=13 l=2]  *jcc
+	cmpb	$1, 1081(%r13)	# 10092	[c=13 l=8]  *cmpqi_1/0
+	ja	.L1521	# 10093	[c=13 l=6]  *jcc
+.L859:
+	movq	1040(%r13), %rax	# 10103	[c=9 l=7]  *movdi_internal/3
+	movb	%r15b, 62(%rax)	# 10104	[c=4 l=4]  *movqi_internal/8
+.L860:
+	movzbl	840(%r13), %eax	# 10108	[c=13 l=8]  zero_extendqidi2/0
+	addq	%rax, 48(%r13)	# 10109	[c=13 l=4]  *adddi_1/0
+	movq	%r13, %rdi	# 10111	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 10110	[c=4 l=3]  *movdi_internal/3
+	movl	%r14d, 0(%r13)	# 10107	[c=4 l=4]  *movsi_internal/1
+	call	log_dump_line@PLT	# 10112	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 17327	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 17328	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 10114	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18241	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 10115	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 10117	[c=4 l=3]  *cmpdi_1/0
+	jb	.L283	# 10118	[c=13 l=6]  *jcc
+	movq	56(%r13), %rax	# 17329	[c=9 l=4]  *movdi_internal/3
+	cmpq	%rax, 48(%r13)	# 10121	[c=13 l=4]  *cmpdi_1/0
+	jnb	.L1522	# 10122	[c=13 l=6]  *jcc
+.L861:
+	movq	%r13, %rdi	# 10128	[c=4 l=3]  *movdi_internal/3
+	call	log_is_idle@PLT	# 10129	[c=10 l=5]  *call_value
+	testb	%al, %al	# 10131	[c=4 l=2]  *cmpqi_ccno_1/0
+	jne	.L1523	# 10132	[c=13 l=6]  *jcc
+.L862:
+	movl	0(%r13), %ebx	# 10143	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 10148	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 10144	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 10146	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 10147	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 10149	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 10150	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 10151	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 10154	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 17330	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 10155	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 10158	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 10159	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 19294	[c=10 l=4]  *indirect_jump
+.L863:
+	movl	5176(%r13), %r15d	# 10167	[c=9 l=7]  *movsi_internal/0
+	movl	$61, %eax	# 10169	[c=4 l=5]  *movsi_internal/0
+	movl	5180(%r13), %r14d	# 10168	[c=9 l=7]  *movsi_internal/0
+	subl	%r15d, %eax	# 10170	[c=4 l=3]  *subsi_1/0
+	cmpl	%r14d, %eax	# 10171	[c=4 l=3]  *cmpsi_1/0
+	jb	.L864	# 10172	[c=13 l=6]  *jcc
+	cmpb	$1, 1081(%r13)	# 10176	[c=13 l=8]  *cmpqi_1/0
+	ja	.L1524	# 10177	[c=13 l=6]  *jcc
+	movq	1040(%r13), %rax	# 14432	[c=9 l=7]  *movdi_internal/3
+	movzbl	61(%rax), %edx	# 14433	[c=13 l=4]  *zero_extendqisi2/0
+.L866:
+	movzbl	62(%rax), %eax	# 10214	[c=13 l=4]  *zero_extendqisi2/0
+.L868:
+	sall	$8, %eax	# 10217	[c=4 l=3]  *ashlsi3_1/0
+	leaq	.LC30(%rip), %rsi	# 10221	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 10223	[c=4 l=3]  *movdi_internal/3
+	orl	%edx, %eax	# 10218	[c=4 l=2]  *iorsi_1/0
+	movl	$61, %edx	# 10220	[c=4 l=5]  *movsi_internal/0
+	movl	%eax, %ecx	# 10219	[c=4 l=2]  *movsi_internal/0
+	movl	%eax, %r15d	# 17333	[c=4 l=3]  *movsi_internal/0
+	call	log_add_data_mov@PLT	# 10224	[c=0 l=5]  *call
+	xorl	%r8d, %r8d	# 19293	[c=4 l=3]  *movdi_xor
+	cmpb	$0, 840(%r13)	# 10225	[c=13 l=8]  *cmpqi_ccno_1/1
+	je	.L869	# 10226	[c=13 l=2]  *jcc
+	addl	$1, %r15d	# 10228	[c=4 l=4]  *addsi_1/0
+	movl	%r15d, %eax	# 17334	[c=4 l=3]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 10229	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 10230	[c=13 l=7]  *cmpsi_1/1
+	jb	.L870	# 10231	[c=13 l=2]  *jcc
+	movl	%r15d, %eax	# 17336	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %eax	# 10233	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 16514	[c=5 l=5]  *andsi_1_zext
+	cmpb	$0, 1080(%r13,%rax)	# 10236	[c=14 l=9]  *cmpqi_ccno_1/1
+	jne	.L871	# 10237	[c=13 l=6]  *jcc
+.L870:
+	movq	1040(%r13), %rdx	# 10241	[c=9 l=7]  *movdi_internal/3
+	movslq	%r15d, %rax	# 10240	[c=4 l=3]  *extendsidi2_rex64/1
+	movzbl	(%rdx,%rax), %r14d	# 10242	[c=13 l=5]  *zero_extendqisi2/0
+.L872:
+	cmpl	$63, %r15d	# 15485	[c=4 l=4]  *cmpsi_1/0
+	movl	%r14d, %ecx	# 10258	[c=4 l=3]  *movsi_internal/0
+	movl	%r15d, %edx	# 10259	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 10261	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC33(%rip), %rax	# 16631	[c=1 l=7]  *movdi_internal/4
+	leaq	.LC32(%rip), %rsi	# 16630	[c=1 l=7]  *movdi_internal/4
+	cmovne	%rax, %rsi	# 15486	[c=8 l=4]  *movdicc_noc/1
+	call	log_add_data_mov@PLT	# 10262	[c=0 l=5]  *call
+	movl	%r14d, %r8d	# 17338	[c=4 l=3]  *movsi_internal/0
+	sall	$16, %r8d	# 10263	[c=4 l=4]  *ashlsi3_1/0
+.L869:
+	leal	1(%r15), %edx	# 18240	[c=4 l=4]  *leasi
+	movl	%edx, %eax	# 17340	[c=4 l=2]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 10267	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 10268	[c=13 l=7]  *cmpsi_1/1
+	jb	.L874	# 10269	[c=13 l=2]  *jcc
+	movl	%edx, %eax	# 17342	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %eax	# 10271	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 16513	[c=5 l=5]  *andsi_1_zext
+	cmpb	$0, 1080(%r13,%rax)	# 10274	[c=14 l=9]  *cmpqi_ccno_1/1
+	jne	.L875	# 10275	[c=13 l=6]  *jcc
+.L874:
+	movq	1040(%r13), %rcx	# 10279	[c=9 l=7]  *movdi_internal/3
+	movslq	%edx, %rax	# 10278	[c=4 l=3]  *extendsidi2_rex64/1
+	movzbl	(%rcx,%rax), %r14d	# 10280	[c=13 l=5]  *zero_extendqisi2/0
+.L876:
+	cmpl	$63, %edx	# 15497	[c=4 l=3]  *cmpsi_1/0
+	leaq	.LC33(%rip), %rax	# 16633	[c=1 l=7]  *movdi_internal/4
+	movl	%r14d, %ecx	# 10296	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 10299	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC32(%rip), %rsi	# 16632	[c=1 l=7]  *movdi_internal/4
+	movl	%r8d, 8(%rsp)	# 18021	[c=4 l=5]  *movsi_internal/1
+	cmovne	%rax, %rsi	# 15498	[c=8 l=4]  *movdicc_noc/1
+	sall	$8, %r14d	# 10301	[c=4 l=4]  *ashlsi3_1/0
+	call	log_add_data_mov@PLT	# 10300	[c=0 l=5]  *call
+	movl	8(%rsp), %r8d	# 18022	[c=9 l=5]  *movsi_internal/0
+	orl	%r8d, %r14d	# 10302	[c=4 l=3]  *iorsi_1/0
+	leal	2(%r15), %r8d	# 18239	[c=4 l=4]  *leasi
+	movl	%r8d, %eax	# 17344	[c=4 l=3]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 10304	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 10305	[c=13 l=7]  *cmpsi_1/1
+	jb	.L878	# 10306	[c=13 l=2]  *jcc
+	movl	%r8d, %eax	# 17346	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %eax	# 10308	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 16512	[c=5 l=5]  *andsi_1_zext
+	cmpb	$0, 1080(%r13,%rax)	# 10311	[c=14 l=9]  *cmpqi_ccno_1/1
+	jne	.L879	# 10312	[c=13 l=6]  *jcc
+.L878:
+	movq	1040(%r13), %rdx	# 10316	[c=9 l=7]  *movdi_internal/3
+	movslq	%r8d, %rax	# 10315	[c=4 l=3]  *extendsidi2_rex64/1
+	movzbl	(%rdx,%rax), %r15d	# 10317	[c=13 l=5]  *zero_extendqisi2/0
+.L880:
+	cmpl	$63, %r8d	# 15509	[c=4 l=4]  *cmpsi_1/0
+	movl	%r8d, %edx	# 10334	[c=4 l=3]  *movsi_internal/0
+	movl	%r15d, %ecx	# 10333	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 10336	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC33(%rip), %rax	# 16635	[c=1 l=7]  *movdi_internal/4
+	leaq	.LC32(%rip), %rsi	# 16634	[c=1 l=7]  *movdi_internal/4
+	movl	%r8d, 8(%rsp)	# 18025	[c=4 l=5]  *movsi_internal/1
+	cmovne	%rax, %rsi	# 15510	[c=8 l=4]  *movdicc_noc/1
+	orl	%r15d, %r14d	# 10338	[c=4 l=3]  *iorsi_1/0
+	call	log_add_data_mov@PLT	# 10337	[c=0 l=5]  *call
+	cmpl	%r14d, 992(%r13)	# 10339	[c=13 l=7]  *cmpsi_1/0
+	movl	8(%rsp), %r8d	# 18026	[c=9 l=5]  *movsi_internal/0
+	jb	.L1525	# 10340	[c=13 l=6]  *jcc
+	movzwl	%r8w, %r15d	# 10348	[c=4 l=4]  *zero_extendhisi2/0
+	movl	$61, %edx	# 10350	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 10353	[c=4 l=3]  *movdi_internal/3
+	movl	%r8d, 8(%rsp)	# 18027	[c=4 l=5]  *movsi_internal/1
+	movl	%r15d, %ecx	# 10349	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC31(%rip), %rsi	# 10351	[c=1 l=7]  *movdi_internal/4
+	call	log_add_data_mov@PLT	# 10354	[c=0 l=5]  *call
+	movl	$61, %eax	# 10355	[c=4 l=5]  *movsi_internal/0
+	movl	8(%rsp), %r8d	# 18028	[c=9 l=5]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 10356	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 10357	[c=13 l=7]  *cmpsi_1/1
+	jb	.L883	# 10358	[c=13 l=2]  *jcc
+	cmpb	$1, 1081(%r13)	# 10362	[c=13 l=8]  *cmpqi_1/0
+	ja	.L1526	# 10363	[c=13 l=6]  *jcc
+.L883:
+	movq	1040(%r13), %rax	# 10374	[c=9 l=7]  *movdi_internal/3
+	movb	%r8b, 61(%rax)	# 10375	[c=4 l=4]  *movqi_internal/8
+.L884:
+	movl	$62, %eax	# 10379	[c=4 l=5]  *movsi_internal/0
+	sarl	$8, %r15d	# 10378	[c=4 l=4]  *ashrsi3_1/0
+	subl	5176(%r13), %eax	# 10380	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 10381	[c=13 l=7]  *cmpsi_1/1
+	jb	.L885	# 10382	[c=13 l=2]  *jcc
+	cmpb	$1, 1081(%r13)	# 10386	[c=13 l=8]  *cmpqi_1/0
+	ja	.L1527	# 10387	[c=13 l=6]  *jcc
+.L885:
+	movq	1040(%r13), %rax	# 10397	[c=9 l=7]  *movdi_internal/3
+	movb	%r15b, 62(%rax)	# 10398	[c=4 l=4]  *movqi_internal/8
+.L886:
+	movzbl	840(%r13), %eax	# 10402	[c=13 l=8]  zero_extendqidi2/0
+	movl	%r14d, 0(%r13)	# 10401	[c=4 l=4]  *movsi_internal/1
+	addq	%rax, 48(%r13)	# 10403	[c=13 l=4]  *adddi_1/0
+	movl	$63, %eax	# 10404	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 10405	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 10406	[c=13 l=7]  *cmpsi_1/1
+	jb	.L887	# 10407	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%r13)	# 10409	[c=13 l=8]  *cmpqi_ccno_1/1
+	jne	.L888	# 10410	[c=13 l=6]  *jcc
+.L887:
+	movq	1040(%r13), %rax	# 10413	[c=9 l=7]  *movdi_internal/3
+	movzbl	63(%rax), %r15d	# 10414	[c=13 l=5]  *zero_extendqisi2/0
+.L889:
+	movl	%r15d, %ecx	# 10425	[c=4 l=3]  *movsi_internal/0
+	movl	$63, %edx	# 10426	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 10429	[c=4 l=3]  *movdi_internal/3
+	movl	%r15d, %r14d	# 17348	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC32(%rip), %rsi	# 10427	[c=1 l=7]  *movdi_internal/4
+	orb	$-128, %r14b	# 18233	[c=4 l=4]  *iorqi_1_slp/0
+	call	log_add_data_mov@PLT	# 10430	[c=0 l=5]  *call
+	movl	%r15d, %ecx	# 17350	[c=4 l=3]  *movsi_internal/0
+	movl	$63, %edx	# 10436	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 10439	[c=4 l=3]  *movdi_internal/3
+	andl	$127, %ecx	# 10433	[c=4 l=3]  *andsi_1/0
+	leaq	.LC28(%rip), %rsi	# 10437	[c=1 l=7]  *movdi_internal/4
+	orb	$-128, %cl	# 18236	[c=4 l=3]  *iorqi_1_slp/0
+	call	log_add_data_mov@PLT	# 10440	[c=0 l=5]  *call
+	movl	$63, %eax	# 10441	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 10442	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 10443	[c=13 l=7]  *cmpsi_1/1
+	jb	.L890	# 10444	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%r13)	# 10446	[c=13 l=8]  *cmpqi_ccno_1/1
+	jne	.L891	# 10447	[c=13 l=6]  *jcc
+.L890:
+	movq	1040(%r13), %rax	# 10450	[c=9 l=7]  *movdi_internal/3
+	movb	%r14b, 63(%rax)	# 10451	[c=4 l=4]  *movqi_internal/8
+.L892:
+	movq	48(%r13), %rax	# 10462	[c=9 l=4]  *movdi_internal/3
+	movq	%r13, %rdi	# 10465	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 10464	[c=4 l=3]  *movdi_internal/3
+	movq	%rax, 6024(%r13)	# 10463	[c=4 l=7]  *movdi_internal/5
+	call	log_dump_line@PLT	# 10466	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 17352	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 17353	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 10468	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18232	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 10469	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 10471	[c=4 l=3]  *cmpdi_1/0
+	jb	.L283	# 10472	[c=13 l=6]  *jcc
+	movq	56(%r13), %rax	# 17354	[c=9 l=4]  *movdi_internal/3
+	cmpq	%rax, 48(%r13)	# 10475	[c=13 l=4]  *cmpdi_1/0
+	jnb	.L1528	# 10476	[c=13 l=6]  *jcc
+.L893:
+	movq	%r13, %rdi	# 10482	[c=4 l=3]  *movdi_internal/3
+	call	log_is_idle@PLT	# 10483	[c=10 l=5]  *call_value
+	testb	%al, %al	# 10485	[c=4 l=2]  *cmpqi_ccno_1/0
+	jne	.L1529	# 10486	[c=13 l=6]  *jcc
+.L894:
+	movl	0(%r13), %ebx	# 10497	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 10502	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 10498	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 10500	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 10501	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 10503	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 10504	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 10505	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 10508	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 17355	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 10509	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 10512	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 10513	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 19292	[c=10 l=4]  *indirect_jump
+.L895:
+	movswl	12(%rbx), %eax	# 10521	[c=13 l=4]  extendhisi2/1
+	cmpw	$-1, %ax	# 10522	[c=4 l=4]  *cmphi_1/0
+	je	.L1530	# 10523	[c=13 l=6]  *jcc
+	addl	0(%r13), %eax	# 10536	[c=9 l=4]  *addsi_1/1
+	andl	992(%r13), %eax	# 10539	[c=13 l=7]  *andsi_1/1
+	movq	%r13, %rdi	# 10542	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 10541	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, 0(%r13)	# 10540	[c=4 l=4]  *movsi_internal/1
+	call	log_dump_line@PLT	# 10543	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 17357	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 17358	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 10545	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18231	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 10546	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 10548	[c=4 l=3]  *cmpdi_1/0
+	jb	.L283	# 10549	[c=13 l=6]  *jcc
+	movq	56(%r13), %rax	# 17359	[c=9 l=4]  *movdi_internal/3
+	cmpq	%rax, 48(%r13)	# 10552	[c=13 l=4]  *cmpdi_1/0
+	jnb	.L1531	# 10553	[c=13 l=6]  *jcc
+.L897:
+	movq	%r13, %rdi	# 10559	[c=4 l=3]  *movdi_internal/3
+	call	log_is_idle@PLT	# 10560	[c=10 l=5]  *call_value
+	testb	%al, %al	# 10562	[c=4 l=2]  *cmpqi_ccno_1/0
+	jne	.L1532	# 10563	[c=13 l=6]  *jcc
+.L898:
+	movl	0(%r13), %ebx	# 10574	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 10579	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 10575	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 10577	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 10578	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 10580	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 10581	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 10582	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 10585	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 17360	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 10586	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 10589	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 10590	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 19289	[c=10 l=4]  *indirect_jump
+.L899:
+	movq	1040(%r13), %rax	# 10599	[c=9 l=7]  *movdi_internal/3
+	movzbl	10(%rbx), %r8d	# 10598	[c=13 l=5]  zero_extendqidi2/0
+	leaq	.LC43(%rip), %rsi	# 10608	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 10610	[c=4 l=3]  *movdi_internal/3
+	movzbl	63(%rax), %eax	# 10600	[c=9 l=4]  *movqi_internal/4
+	movq	%r8, %rdx	# 18588	[c=4 l=3]  *movdi_internal/3
+	movq	%r8, 16(%rsp)	# 18031	[c=4 l=5]  *movdi_internal/5
+	movzbl	1004(%r13,%r8), %ecx	# 10605	[c=14 l=9]  *zero_extendqisi2/0
+	movl	%r8d, 8(%rsp)	# 18029	[c=4 l=5]  *movsi_internal/1
+	andl	$1, %eax	# 10602	[c=4 l=3]  *andsi_1/0
+	sall	$8, %eax	# 10603	[c=4 l=3]  *ashlsi3_1/0
+	movl	%eax, %r14d	# 17363	[c=4 l=3]  *movsi_internal/0
+	xorl	%eax, %eax	# 19288	[c=4 l=2]  *movdi_xor
+	call	log_append@PLT	# 10612	[c=0 l=5]  *call
+	movl	8(%rsp), %edx	# 18030	[c=9 l=4]  *movsi_internal/0
+	movq	16(%rsp), %r8	# 18032	[c=9 l=5]  *movdi_internal/3
+	cmpl	$15, %edx	# 10615	[c=4 l=3]  *cmpsi_1/0
+	jle	.L1533	# 10616	[c=13 l=6]  *jcc
+	movzbl	1004(%r13,%r8), %r15d	# 10629	[c=14 l=9]  *zero_extendqisi2/0
+	xorl	%eax, %eax	# 19286	[c=4 l=2]  *movdi_xor
+	leaq	.LC61(%rip), %rsi	# 10634	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 10636	[c=4 l=3]  *movdi_internal/3
+	movq	%r8, 8(%rsp)	# 18033	[c=4 l=5]  *movdi_internal/5
+	orl	%r14d, %r15d	# 10630	[c=4 l=3]  *iorsi_1/0
+	movl	%r15d, %r14d	# 17364	[c=4 l=3]  *movsi_internal/0
+	sarl	%r14d	# 10631	[c=4 l=3]  *ashrsi3_1/0
+	movl	%r14d, %ecx	# 10632	[c=4 l=3]  *movsi_internal/0
+	call	log_append@PLT	# 10638	[c=0 l=5]  *call
+	movq	8(%rsp), %r8	# 18034	[c=9 l=5]  *movdi_internal/3
+	movl	$63, %eax	# 10641	[c=4 l=5]  *movsi_internal/0
+	movb	%r14b, 1004(%r13,%r8)	# 10640	[c=4 l=8]  *movqi_internal/8
+	subl	5176(%r13), %eax	# 10642	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 10643	[c=13 l=7]  *cmpsi_1/1
+	jb	.L901	# 10644	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%r13)	# 10646	[c=13 l=8]  *cmpqi_ccno_1/1
+	jne	.L902	# 10647	[c=13 l=6]  *jcc
+.L901:
+	movq	1040(%r13), %rax	# 10650	[c=9 l=7]  *movdi_internal/3
+	movzbl	63(%rax), %r14d	# 10651	[c=13 l=5]  *zero_extendqisi2/0
+.L903:
+	movl	%r14d, %ecx	# 10662	[c=4 l=3]  *movsi_internal/0
+	movl	$63, %edx	# 10663	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 10666	[c=4 l=3]  *movdi_internal/3
+	movslq	%r15d, %r15	# 10670	[c=4 l=3]  *extendsidi2_rex64/1
+	leaq	.LC32(%rip), %rsi	# 10664	[c=1 l=7]  *movdi_internal/4
+	andl	$-32, %r14d	# 10668	[c=4 l=4]  *andsi_1/0
+	call	log_add_data_mov@PLT	# 10667	[c=0 l=5]  *call
+	leaq	flag_update_table_ror8(%rip), %rax	# 16556	[c=1 l=7]  *movdi_internal/4
+	movl	$63, %edx	# 10675	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 10678	[c=4 l=3]  *movdi_internal/3
+	movzbl	(%rax,%r15), %eax	# 10671	[c=13 l=5]  *zero_extendqisi2/0
+	leaq	.LC28(%rip), %rsi	# 10676	[c=1 l=7]  *movdi_internal/4
+	orl	%eax, %r14d	# 10672	[c=4 l=3]  *iorsi_1/0
+	movzbl	%r14b, %ecx	# 10673	[c=4 l=4]  *zero_extendqisi2/0
+	call	log_add_data_mov@PLT	# 10679	[c=0 l=5]  *call
+	movl	$63, %eax	# 10680	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 10681	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 10682	[c=13 l=7]  *cmpsi_1/1
+	jb	.L904	# 10683	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%r13)	# 10685	[c=13 l=8]  *cmpqi_ccno_1/1
+	jne	.L905	# 10686	[c=13 l=6]  *jcc
+.L904:
+	movq	1040(%r13), %rax	# 10689	[c=9 l=7]  *movdi_internal/3
+	movb	%r14b, 63(%rax)	# 10690	[c=4 l=4]  *movqi_internal/8
+.L906:
+	movq	%r13, %rdi	# 10702	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 10701	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 10703	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 17366	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 17367	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 10705	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18230	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 10706	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 10708	[c=4 l=3]  *cmpdi_1/0
+	jb	.L283	# 10709	[c=13 l=6]  *jcc
+	movl	0(%r13), %ebx	# 10711	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 10716	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 10712	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 10714	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 10715	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 10717	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 10718	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 10719	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 10722	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 17368	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 10723	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 10726	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 10727	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 19285	[c=10 l=4]  *indirect_jump
+.L907:
+	movzbl	10(%rbx), %r14d	# 10736	[c=13 l=5]  zero_extendqidi2/0
+	xorl	%eax, %eax	# 19284	[c=4 l=2]  *movdi_xor
+	movq	%r13, %rdi	# 10743	[c=4 l=3]  *movdi_internal/3
+	movzwl	12(%rbx), %r15d	# 10735	[c=13 l=5]  *zero_extendhisi2/0
+	leaq	.LC43(%rip), %rsi	# 10741	[c=1 l=7]  *movdi_internal/4
+	movzbl	1004(%r13,%r14), %ecx	# 10738	[c=14 l=9]  *zero_extendqisi2/0
+	movl	%r14d, %edx	# 10740	[c=4 l=3]  *movsi_internal/0
+	movl	%r14d, 8(%rsp)	# 18037	[c=4 l=5]  *movsi_internal/1
+	call	log_append@PLT	# 10745	[c=0 l=5]  *call
+	movl	8(%rsp), %r9d	# 18038	[c=9 l=5]  *movsi_internal/0
+	leaq	.LC43(%rip), %rsi	# 18036	[c=1 l=7]  *movdi_internal/4
+	cmpl	$15, %r9d	# 10748	[c=4 l=4]  *cmpsi_1/0
+	jle	.L1534	# 10749	[c=13 l=6]  *jcc
+	movslq	%r15d, %r8	# 10764	[c=4 l=3]  *extendsidi2_rex64/1
+	movl	%r15d, %edx	# 10767	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 10770	[c=4 l=3]  *movdi_internal/3
+	movl	%r9d, 32(%rsp)	# 18042	[c=4 l=5]  *movsi_internal/1
+	movzbl	1004(%r13,%r14), %eax	# 10762	[c=14 l=9]  *zero_extendqisi2/0
+	movq	%r8, 24(%rsp)	# 18039	[c=4 l=5]  *movdi_internal/5
+	movzbl	1004(%r13,%r8), %ecx	# 10765	[c=14 l=9]  *zero_extendqisi2/0
+	movb	%al, 8(%rsp)	# 18041	[c=4 l=4]  *movqi_internal/8
+	movl	%eax, 16(%rsp)	# 17371	[c=4 l=4]  *movsi_internal/1
+	xorl	%eax, %eax	# 19282	[c=4 l=2]  *movdi_xor
+	call	log_append@PLT	# 10772	[c=0 l=5]  *call
+	cmpl	$15, %r15d	# 10775	[c=4 l=4]  *cmpsi_1/0
+	movq	24(%rsp), %r8	# 18040	[c=9 l=5]  *movdi_internal/3
+	movl	32(%rsp), %r9d	# 18043	[c=9 l=5]  *movsi_internal/0
+	jle	.L1535	# 10776	[c=13 l=6]  *jcc
+	movzbl	1004(%r13,%r8), %eax	# 10789	[c=14 l=9]  *zero_extendqisi2/0
+	movl	16(%rsp), %r15d	# 17373	[c=9 l=5]  *movsi_internal/0
+	movl	%r9d, %edx	# 10799	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 10802	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC61(%rip), %rsi	# 10800	[c=1 l=7]  *movdi_internal/4
+	movb	%al, 24(%rsp)	# 18044	[c=4 l=4]  *movqi_internal/8
+	subl	%eax, %r15d	# 10791	[c=4 l=3]  *subsi_1/0
+	movq	1040(%r13), %rax	# 10792	[c=9 l=7]  *movdi_internal/3
+	movzbl	63(%rax), %eax	# 10793	[c=9 l=4]  *movqi_internal/4
+	andl	$1, %eax	# 10795	[c=4 l=3]  *andsi_1/0
+	subl	%eax, %r15d	# 10796	[c=4 l=3]  *subsi_1/0
+	xorl	%eax, %eax	# 19280	[c=4 l=2]  *movdi_xor
+	movzbl	%r15b, %ecx	# 10797	[c=4 l=4]  *zero_extendqisi2/0
+	call	log_append@PLT	# 10804	[c=0 l=5]  *call
+	movzbl	24(%rsp), %r8d	# 18045	[c=9 l=6]  *movqi_internal/4
+	movl	8(%rsp), %edx	# 17375	[c=9 l=4]  *movsi_internal/0
+	movb	%r15b, 1004(%r13,%r14)	# 10806	[c=4 l=8]  *movqi_internal/8
+	andl	$511, %r15d	# 10818	[c=4 l=7]  *andsi_1/0
+	movl	%r8d, %eax	# 17377	[c=4 l=3]  *movsi_internal/0
+	andl	$136, %edx	# 10808	[c=4 l=6]  *andsi_1/0
+	andl	$136, %eax	# 10811	[c=4 l=5]  *andsi_1/0
+	leal	(%rax,%rdx,2), %eax	# 10812	[c=8 l=3]  *leasi
+	movq	1040(%r13), %rdx	# 10813	[c=9 l=7]  *movdi_internal/3
+	imull	$260, %eax, %eax	# 10816	[c=12 l=6]  *mulsi3_1/1
+	movzbl	63(%rdx), %ecx	# 10814	[c=13 l=4]  *zero_extendqisi2/0
+	leaq	flag_update_table_sub8(%rip), %rdx	# 16557	[c=1 l=7]  *movdi_internal/4
+	andl	$7680, %eax	# 10817	[c=4 l=5]  *andsi_1/0
+	orl	%r15d, %eax	# 10819	[c=5 l=3]  *iorsi_1_zext
+	movzbl	(%rdx,%rax), %r14d	# 10821	[c=13 l=5]  *zero_extendqisi2/0
+	movl	%ecx, %eax	# 17379	[c=4 l=2]  *movsi_internal/0
+	orl	$-3, %eax	# 10822	[c=4 l=3]  *iorsi_1/0
+	andl	%eax, %r14d	# 10823	[c=4 l=3]  *andsi_1/0
+	movl	$63, %eax	# 10824	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 10825	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 10826	[c=13 l=7]  *cmpsi_1/1
+	jb	.L910	# 10827	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%r13)	# 10829	[c=13 l=8]  *cmpqi_ccno_1/1
+	jne	.L1536	# 10830	[c=13 l=6]  *jcc
+.L910:
+	movl	$63, %edx	# 10839	[c=4 l=5]  *movsi_internal/0
+	leaq	.LC32(%rip), %rsi	# 10840	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 10842	[c=4 l=3]  *movdi_internal/3
+	movl	%ecx, 8(%rsp)	# 18046	[c=4 l=4]  *movsi_internal/1
+	call	log_add_data_mov@PLT	# 10843	[c=0 l=5]  *call
+	movl	8(%rsp), %ecx	# 18047	[c=9 l=4]  *movsi_internal/0
+	movl	$63, %edx	# 10848	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 10851	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC28(%rip), %rsi	# 10849	[c=1 l=7]  *movdi_internal/4
+	andl	$-64, %ecx	# 10844	[c=4 l=3]  *andsi_1/0
+	orl	%ecx, %r14d	# 10845	[c=4 l=3]  *iorsi_1/0
+	movzbl	%r14b, %ecx	# 10846	[c=4 l=4]  *zero_extendqisi2/0
+	call	log_add_data_mov@PLT	# 10852	[c=0 l=5]  *call
+	movl	$63, %eax	# 10853	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 10854	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 10855	[c=13 l=7]  *cmpsi_1/1
+	jb	.L911	# 10856	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%r13)	# 10858	[c=13 l=8]  *cmpqi_ccno_1/1
+	jne	.L912	# 10859	[c=13 l=6]  *jcc
+.L911:
+	movq	1040(%r13), %rax	# 10862	[c=9 l=7]  *movdi_internal/3
+	movb	%r14b, 63(%rax)	# 10863	[c=4 l=4]  *movqi_internal/8
+.L913:
+	movq	%r13, %rdi	# 10875	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 10874	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 10876	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 17381	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 17382	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 10878	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18229	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 10879	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 10881	[c=4 l=3]  *cmpdi_1/0
+	jb	.L283	# 10882	[c=13 l=6]  *jcc
+	movl	0(%r13), %ebx	# 10884	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 10889	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 10885	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 10887	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 10888	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 10890	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 10891	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 10892	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 10895	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 17383	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 10896	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 10899	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 10900	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 19279	[c=10 l=4]  *indirect_jump
+.L914:
+	movzwl	12(%rbx), %r15d	# 10908	[c=13 l=5]  *zero_extendhisi2/0
+	xorl	%eax, %eax	# 19277	[c=4 l=2]  *movdi_xor
+	movq	%r13, %rdi	# 10914	[c=4 l=3]  *movdi_internal/3
+	movzbl	10(%rbx), %r14d	# 10910	[c=13 l=5]  *zero_extendqisi2/0
+	leaq	.LC62(%rip), %rsi	# 10912	[c=1 l=7]  *movdi_internal/4
+	movl	%r15d, %edx	# 10911	[c=4 l=3]  *movsi_internal/0
+	movw	%r15w, 8(%rsp)	# 18050	[c=4 l=6]  *movhi_internal/3
+	call	log_append@PLT	# 10916	[c=0 l=5]  *call
+	movslq	%r14d, %r11	# 10921	[c=4 l=3]  *extendsidi2_rex64/1
+	movl	%r14d, %edx	# 10924	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 10927	[c=4 l=3]  *movdi_internal/3
+	movq	1040(%r13), %rax	# 10917	[c=9 l=7]  *movdi_internal/3
+	leaq	.LC43(%rip), %rsi	# 10925	[c=1 l=7]  *movdi_internal/4
+	movq	%r11, 24(%rsp)	# 18048	[c=4 l=5]  *movdi_internal/5
+	movzbl	1004(%r13,%r11), %ecx	# 10922	[c=14 l=9]  *zero_extendqisi2/0
+	movzbl	63(%rax), %eax	# 10918	[c=9 l=4]  *movqi_internal/4
+	andl	$1, %eax	# 10920	[c=4 l=3]  *andsi_1/0
+	movl	%eax, 16(%rsp)	# 17388	[c=4 l=4]  *movsi_internal/1
+	xorl	%eax, %eax	# 19278	[c=4 l=2]  *movdi_xor
+	call	log_append@PLT	# 10929	[c=0 l=5]  *call
+	cmpl	$15, %r14d	# 10932	[c=4 l=4]  *cmpsi_1/0
+	movq	24(%rsp), %r11	# 18049	[c=9 l=5]  *movdi_internal/3
+	jle	.L1537	# 10933	[c=13 l=6]  *jcc
+	movzbl	1004(%r13,%r11), %eax	# 10946	[c=14 l=9]  *zero_extendqisi2/0
+	movl	16(%rsp), %edi	# 17391	[c=9 l=4]  *movsi_internal/0
+	movl	%r14d, %edx	# 10952	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC61(%rip), %rsi	# 10953	[c=1 l=7]  *movdi_internal/4
+	movq	%r11, 32(%rsp)	# 18053	[c=4 l=5]  *movdi_internal/5
+	movb	%al, 24(%rsp)	# 18051	[c=4 l=4]  *movqi_internal/8
+	subl	%r15d, %eax	# 10948	[c=4 l=3]  *subsi_1/0
+	subl	%edi, %eax	# 10949	[c=4 l=2]  *subsi_1/0
+	movq	%r13, %rdi	# 10955	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, %r15d	# 17390	[c=4 l=3]  *movsi_internal/0
+	movzbl	%al, %ecx	# 10950	[c=4 l=3]  *zero_extendqisi2/0
+	xorl	%eax, %eax	# 19275	[c=4 l=2]  *movdi_xor
+	call	log_append@PLT	# 10957	[c=0 l=5]  *call
+	movzbl	24(%rsp), %r9d	# 18052	[c=9 l=6]  *movqi_internal/4
+	movl	8(%rsp), %r14d	# 17392	[c=9 l=5]  *movsi_internal/0
+	movq	32(%rsp), %r11	# 18054	[c=9 l=5]  *movdi_internal/3
+	andl	$136, %r14d	# 10964	[c=4 l=7]  *andsi_1/0
+	andl	$136, %r9d	# 10961	[c=4 l=7]  *andsi_1/0
+	leal	(%r14,%r9,2), %eax	# 10965	[c=8 l=4]  *leasi
+	movb	%r15b, 1004(%r13,%r11)	# 10959	[c=4 l=8]  *movqi_internal/8
+	movq	1040(%r13), %rdx	# 10966	[c=9 l=7]  *movdi_internal/3
+	andl	$511, %r15d	# 10971	[c=4 l=7]  *andsi_1/0
+	imull	$260, %eax, %eax	# 10969	[c=12 l=6]  *mulsi3_1/1
+	movzbl	63(%rdx), %ecx	# 10967	[c=13 l=4]  *zero_extendqisi2/0
+	leaq	flag_update_table_sub8(%rip), %rdx	# 16558	[c=1 l=7]  *movdi_internal/4
+	andl	$7680, %eax	# 10970	[c=4 l=5]  *andsi_1/0
+	orl	%r15d, %eax	# 10972	[c=5 l=3]  *iorsi_1_zext
+	movzbl	(%rdx,%rax), %r14d	# 10974	[c=13 l=5]  *zero_extendqisi2/0
+	movl	%ecx, %eax	# 17394	[c=4 l=2]  *movsi_internal/0
+	orl	$-3, %eax	# 10975	[c=4 l=3]  *iorsi_1/0
+	andl	%eax, %r14d	# 10976	[c=4 l=3]  *andsi_1/0
+	movl	$63, %eax	# 10977	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 10978	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 10979	[c=13 l=7]  *cmpsi_1/1
+	jb	.L916	# 10980	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%r13)	# 10982	[c=13 l=8]  *cmpqi_ccno_1/1
+	jne	.L1538	# 10983	[c=13 l=6]  *jcc
+.L916:
+	movl	$63, %edx	# 10992	[c=4 l=5]  *movsi_internal/0
+	leaq	.LC32(%rip), %rsi	# 10993	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 10995	[c=4 l=3]  *movdi_internal/3
+	movl	%ecx, 8(%rsp)	# 18055	[c=4 l=4]  *movsi_internal/1
+	call	log_add_data_mov@PLT	# 10996	[c=0 l=5]  *call
+	movl	8(%rsp), %ecx	# 18056	[c=9 l=4]  *movsi_internal/0
+	movl	$63, %edx	# 11001	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 11004	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC28(%rip), %rsi	# 11002	[c=1 l=7]  *movdi_internal/4
+	andl	$-64, %ecx	# 10997	[c=4 l=3]  *andsi_1/0
+	orl	%ecx, %r14d	# 10998	[c=4 l=3]  *iorsi_1/0
+	movzbl	%r14b, %ecx	# 10999	[c=4 l=4]  *zero_extendqisi2/0
+	call	log_add_data_mov@PLT	# 11005	[c=0 l=5]  *call
+	movl	$63, %eax	# 11006	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 11007	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 11008	[c=13 l=7]  *cmpsi_1/1
+	jb	.L917	# 11009	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%r13)	# 11011	[c=13 l=8]  *cmpqi_ccno_1/1
+	jne	.L918	# 11012	[c=13 l=6]  *jcc
+.L917:
+	movq	1040(%r13), %rax	# 11015	[c=9 l=7]  *movdi_internal/3
+	movb	%r14b, 63(%rax)	# 11016	[c=4 l=4]  *movqi_internal/8
+.L919:
+	movq	%r13, %rdi	# 11028	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 11027	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 11029	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 17396	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 17397	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 11031	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18228	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 11032	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 11034	[c=4 l=3]  *cmpdi_1/0
+	jb	.L283	# 11035	[c=13 l=6]  *jcc
+	movl	0(%r13), %ebx	# 11037	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 11042	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 11038	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 11040	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 11041	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 11043	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 11044	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 11045	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 11048	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 17398	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 11049	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 11052	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 11053	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 19274	[c=10 l=4]  *indirect_jump
+.L920:
+	movzbl	10(%rbx), %r15d	# 11062	[c=13 l=5]  *zero_extendqisi2/0
+	movzwl	12(%rbx), %r14d	# 11061	[c=13 l=5]  *zero_extendhisi2/0
+	movl	%r15d, %eax	# 18593	[c=4 l=3]  *movsi_internal/0
+	movb	%r15b, 8(%rsp)	# 18057	[c=4 l=5]  *movqi_internal/8
+	subl	5176(%r13), %eax	# 11065	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 11066	[c=13 l=7]  *cmpsi_1/1
+	jb	.L921	# 11067	[c=13 l=2]  *jcc
+	movl	%r15d, %eax	# 17404	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %eax	# 11069	[c=4 l=3]  *ashrsi3_1/0
+	cltq	# 11070	[c=4 l=2]  *extendsidi2_rex64/0
+	cmpb	$0, 1080(%r13,%rax)	# 11071	[c=14 l=9]  *cmpqi_ccno_1/1
+	jne	.L922	# 11072	[c=13 l=6]  *jcc
+.L921:
+	movzbl	8(%rsp), %eax	# 11075	[c=13 l=5]  zero_extendqidi2/0
+	movq	1040(%r13), %rdx	# 11076	[c=9 l=7]  *movdi_internal/3
+	movzbl	(%rdx,%rax), %eax	# 11077	[c=13 l=4]  *zero_extendqisi2/0
+.L923:
+	cmpl	$63, %r15d	# 15521	[c=4 l=4]  *cmpsi_1/0
+	leaq	.LC33(%rip), %rdx	# 16637	[c=1 l=7]  *movdi_internal/4
+	movl	%eax, %ecx	# 11093	[c=4 l=2]  *movsi_internal/0
+	movq	%r13, %rdi	# 11096	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC32(%rip), %rsi	# 16636	[c=1 l=7]  *movdi_internal/4
+	movl	%eax, 16(%rsp)	# 18058	[c=4 l=4]  *movsi_internal/1
+	cmovne	%rdx, %rsi	# 15522	[c=8 l=4]  *movdicc_noc/1
+	movl	%r15d, %edx	# 11094	[c=4 l=3]  *movsi_internal/0
+	call	log_add_data_mov@PLT	# 11097	[c=0 l=5]  *call
+	cmpl	6564(%r13), %r15d	# 11098	[c=13 l=7]  *cmpsi_1/1
+	movl	16(%rsp), %eax	# 18059	[c=9 l=4]  *movsi_internal/0
+	jb	.L1539	# 11099	[c=13 l=6]  *jcc
+.L925:
+	orl	%eax, %r14d	# 11108	[c=4 l=3]  *iorsi_1/0
+.L926:
+	cmpl	$63, %r15d	# 15533	[c=4 l=4]  *cmpsi_1/0
+	movzbl	%r14b, %ecx	# 11111	[c=4 l=4]  *zero_extendqisi2/0
+	movl	%r15d, %edx	# 11118	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 11120	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC29(%rip), %rax	# 16639	[c=1 l=7]  *movdi_internal/4
+	leaq	.LC28(%rip), %rsi	# 16638	[c=1 l=7]  *movdi_internal/4
+	cmovne	%rax, %rsi	# 15534	[c=8 l=4]  *movdicc_noc/1
+	call	log_add_data_mov@PLT	# 11121	[c=0 l=5]  *call
+	movl	%r15d, %eax	# 17407	[c=4 l=3]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 11122	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 11123	[c=13 l=7]  *cmpsi_1/1
+	jb	.L928	# 11124	[c=13 l=2]  *jcc
+	movl	%r15d, %eax	# 17409	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %eax	# 11126	[c=4 l=3]  *ashrsi3_1/0
+	cltq	# 11127	[c=4 l=2]  *extendsidi2_rex64/0
+	cmpb	$0, 1080(%r13,%rax)	# 11128	[c=14 l=9]  *cmpqi_ccno_1/1
+	jne	.L929	# 11129	[c=13 l=6]  *jcc
+.L928:
+	movzbl	8(%rsp), %eax	# 11132	[c=13 l=5]  zero_extendqidi2/0
+	movq	1040(%r13), %rdx	# 11133	[c=9 l=7]  *movdi_internal/3
+	movb	%r14b, (%rdx,%rax)	# 11134	[c=4 l=4]  *movqi_internal/8
+.L930:
+	movq	%r13, %rdi	# 11146	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 11145	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 11147	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 17412	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 17413	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 11149	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18227	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 11150	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 11152	[c=4 l=3]  *cmpdi_1/0
+	jb	.L283	# 11153	[c=13 l=6]  *jcc
+	movl	0(%r13), %ebx	# 11155	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 11160	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 11156	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 11158	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 11159	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 11161	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 11162	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 11163	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 11166	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 17414	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 11167	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 11170	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 11171	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 19273	[c=10 l=4]  *indirect_jump
+.L931:
+	movzbl	10(%rbx), %edx	# 11180	[c=13 l=4]  zero_extendqidi2/0
+	movzwl	12(%rbx), %r14d	# 11179	[c=13 l=5]  *zero_extendhisi2/0
+	movl	%edx, %ecx	# 17416	[c=4 l=2]  *movsi_internal/0
+	movq	%rdx, %rax	# 18594	[c=4 l=3]  *movdi_internal/3
+	subl	5176(%r13), %ecx	# 11183	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %ecx	# 11184	[c=13 l=7]  *cmpsi_1/1
+	jb	.L932	# 11185	[c=13 l=2]  *jcc
+	movl	%edx, %ecx	# 17418	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %ecx	# 11187	[c=4 l=3]  *ashrsi3_1/0
+	movslq	%ecx, %rcx	# 11188	[c=4 l=3]  *extendsidi2_rex64/1
+	cmpb	$0, 1080(%r13,%rcx)	# 11189	[c=14 l=9]  *cmpqi_ccno_1/1
+	jne	.L933	# 11190	[c=13 l=6]  *jcc
+.L932:
+	movq	1040(%r13), %rcx	# 11194	[c=9 l=7]  *movdi_internal/3
+	movzbl	(%rcx,%rax), %r15d	# 11195	[c=13 l=5]  *zero_extendqisi2/0
+.L934:
+	cmpl	$63, %edx	# 15545	[c=4 l=3]  *cmpsi_1/0
+	leaq	.LC32(%rip), %rsi	# 16640	[c=1 l=7]  *movdi_internal/4
+	movl	%r15d, %ecx	# 11211	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 11214	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC33(%rip), %rax	# 16641	[c=1 l=7]  *movdi_internal/4
+	cmovne	%rax, %rsi	# 15546	[c=8 l=4]  *movdicc_noc/1
+	call	log_add_data_mov@PLT	# 11215	[c=0 l=5]  *call
+	testl	%r15d, %r14d	# 11217	[c=4 l=3]  *testsi_1/0
+	je	.L1540	# 11218	[c=13 l=6]  *jcc
+.L936:
+	movq	%r13, %rdi	# 11230	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 11229	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 11231	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 17421	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 17422	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 11233	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18226	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 11234	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 11236	[c=4 l=3]  *cmpdi_1/0
+	jb	.L283	# 11237	[c=13 l=6]  *jcc
+	movq	56(%r13), %rax	# 17423	[c=9 l=4]  *movdi_internal/3
+	cmpq	%rax, 48(%r13)	# 11240	[c=13 l=4]  *cmpdi_1/0
+	jnb	.L1541	# 11241	[c=13 l=6]  *jcc
+.L937:
+	movq	%r13, %rdi	# 11247	[c=4 l=3]  *movdi_internal/3
+	call	log_is_idle@PLT	# 11248	[c=10 l=5]  *call_value
+	testb	%al, %al	# 11250	[c=4 l=2]  *cmpqi_ccno_1/0
+	jne	.L1542	# 11251	[c=13 l=6]  *jcc
+.L938:
+	movl	0(%r13), %ebx	# 11262	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 11267	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 11263	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 11265	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 11266	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 11268	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 11269	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 11270	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 11273	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 17424	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 11274	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 11277	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 11278	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 19272	[c=10 l=4]  *indirect_jump
+.L939:
+	movzbl	10(%rbx), %edx	# 11287	[c=13 l=4]  zero_extendqidi2/0
+	movzwl	12(%rbx), %r14d	# 11286	[c=13 l=5]  *zero_extendhisi2/0
+	movl	%edx, %ecx	# 17426	[c=4 l=2]  *movsi_internal/0
+	movq	%rdx, %rax	# 18595	[c=4 l=3]  *movdi_internal/3
+	subl	5176(%r13), %ecx	# 11290	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %ecx	# 11291	[c=13 l=7]  *cmpsi_1/1
+	jb	.L940	# 11292	[c=13 l=2]  *jcc
+	movl	%edx, %ecx	# 17428	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %ecx	# 11294	[c=4 l=3]  *ashrsi3_1/0
+	movslq	%ecx, %rcx	# 11295	[c=4 l=3]  *extendsidi2_rex64/1
+	cmpb	$0, 1080(%r13,%rcx)	# 11296	[c=14 l=9]  *cmpqi_ccno_1/1
+	jne	.L941	# 11297	[c=13 l=6]  *jcc
+.L940:
+	movq	1040(%r13), %rcx	# 11301	[c=9 l=7]  *movdi_internal/3
+	movzbl	(%rcx,%rax), %r15d	# 11302	[c=13 l=5]  *zero_extendqisi2/0
+.L942:
+	cmpl	$63, %edx	# 15557	[c=4 l=3]  *cmpsi_1/0
+	leaq	.LC32(%rip), %rsi	# 16642	[c=1 l=7]  *movdi_internal/4
+	movl	%r15d, %ecx	# 11318	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 11321	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC33(%rip), %rax	# 16643	[c=1 l=7]  *movdi_internal/4
+	cmovne	%rax, %rsi	# 15558	[c=8 l=4]  *movdicc_noc/1
+	call	log_add_data_mov@PLT	# 11322	[c=0 l=5]  *call
+	testl	%r15d, %r14d	# 11324	[c=4 l=3]  *testsi_1/0
+	je	.L1543	# 11325	[c=13 l=6]  *jcc
+.L944:
+	movq	%r13, %rdi	# 11337	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 11336	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 11338	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 17431	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 17432	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 11340	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18225	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 11341	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 11343	[c=4 l=3]  *cmpdi_1/0
+	jb	.L283	# 11344	[c=13 l=6]  *jcc
+	movq	56(%r13), %rax	# 17433	[c=9 l=4]  *movdi_internal/3
+	cmpq	%rax, 48(%r13)	# 11347	[c=13 l=4]  *cmpdi_1/0
+	jnb	.L1544	# 11348	[c=13 l=6]  *jcc
+.L945:
+	movq	%r13, %rdi	# 11354	[c=4 l=3]  *movdi_internal/3
+	call	log_is_idle@PLT	# 11355	[c=10 l=5]  *call_value
+	testb	%al, %al	# 11357	[c=4 l=2]  *cmpqi_ccno_1/0
+	jne	.L1545	# 11358	[c=13 l=6]  *jcc
+.L946:
+	movl	0(%r13), %ebx	# 11369	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 11374	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 11370	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 11372	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 11373	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 11375	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 11376	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 11377	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 11380	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 17434	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 11381	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 11384	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 11385	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 19271	[c=10 l=4]  *indirect_jump
+.L947:
+	movzbl	10(%rbx), %edx	# 11394	[c=13 l=4]  zero_extendqidi2/0
+	movzwl	12(%rbx), %r14d	# 11393	[c=13 l=5]  *zero_extendhisi2/0
+	movl	%edx, %ecx	# 17436	[c=4 l=2]  *movsi_internal/0
+	movq	%rdx, %rax	# 18596	[c=4 l=3]  *movdi_internal/3
+	subl	5176(%r13), %ecx	# 11397	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %ecx	# 11398	[c=13 l=7]  *cmpsi_1/1
+	jb	.L948	# 11399	[c=13 l=2]  *jcc
+	movl	%edx, %ecx	# 17438	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %ecx	# 11401	[c=4 l=3]  *ashrsi3_1/0
+	movslq	%ecx, %rcx	# 11402	[c=4 l=3]  *extendsidi2_rex64/1
+	cmpb	$0, 1080(%r13,%rcx)	# 11403	[c=14 l=9]  *cmpqi_ccno_1/1
+	jne	.L949	# 11404	[c=13 l=6]  *jcc
+.L948:
+	movq	1040(%r13), %rcx	# 11408	[c=9 l=7]  *movdi_internal/3
+	movzbl	(%rcx,%rax), %r15d	# 11409	[c=13 l=5]  *zero_extendqisi2/0
+.L950:
+	cmpl	$63, %edx	# 15569	[c=4 l=3]  *cmpsi_1/0
+	leaq	.LC32(%rip), %rsi	# 16644	[c=1 l=7]  *movdi_internal/4
+	movl	%r15d, %ecx	# 11425	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 11428	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC33(%rip), %rax	# 16645	[c=1 l=7]  *movdi_internal/4
+	cmovne	%rax, %rsi	# 15570	[c=8 l=4]  *movdicc_noc/1
+	call	log_add_data_mov@PLT	# 11429	[c=0 l=5]  *call
+	testl	%r15d, %r14d	# 11431	[c=4 l=3]  *testsi_1/0
+	jne	.L1546	# 11432	[c=13 l=6]  *jcc
+.L952:
+	movq	%r13, %rdi	# 11444	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 11443	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 11445	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 17441	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 17442	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 11447	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18224	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 11448	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 11450	[c=4 l=3]  *cmpdi_1/0
+	jb	.L283	# 11451	[c=13 l=6]  *jcc
+	movq	56(%r13), %rax	# 17443	[c=9 l=4]  *movdi_internal/3
+	cmpq	%rax, 48(%r13)	# 11454	[c=13 l=4]  *cmpdi_1/0
+	jnb	.L1547	# 11455	[c=13 l=6]  *jcc
+.L953:
+	movq	%r13, %rdi	# 11461	[c=4 l=3]  *movdi_internal/3
+	call	log_is_idle@PLT	# 11462	[c=10 l=5]  *call_value
+	testb	%al, %al	# 11464	[c=4 l=2]  *cmpqi_ccno_1/0
+	jne	.L1548	# 11465	[c=13 l=6]  *jcc
+.L954:
+	movl	0(%r13), %ebx	# 11476	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 11481	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 11477	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 11479	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 11480	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 11482	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 11483	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 11484	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 11487	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 17444	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 11488	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 11491	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 11492	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 19270	[c=10 l=4]  *indirect_jump
+.L955:
+	movzbl	10(%rbx), %edx	# 11501	[c=13 l=4]  zero_extendqidi2/0
+	movzwl	12(%rbx), %r14d	# 11500	[c=13 l=5]  *zero_extendhisi2/0
+	movl	%edx, %ecx	# 17446	[c=4 l=2]  *movsi_internal/0
+	movq	%rdx, %rax	# 18597	[c=4 l=3]  *movdi_internal/3
+	subl	5176(%r13), %ecx	# 11504	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %ecx	# 11505	[c=13 l=7]  *cmpsi_1/1
+	jb	.L956	# 11506	[c=13 l=2]  *jcc
+	movl	%edx, %ecx	# 17448	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %ecx	# 11508	[c=4 l=3]  *ashrsi3_1/0
+	movslq	%ecx, %rcx	# 11509	[c=4 l=3]  *extendsidi2_rex64/1
+	cmpb	$0, 1080(%r13,%rcx)	# 11510	[c=14 l=9]  *cmpqi_ccno_1/1
+	jne	.L957	# 11511	[c=13 l=6]  *jcc
+.L956:
+	movq	1040(%r13), %rcx	# 11515	[c=9 l=7]  *movdi_internal/3
+	movzbl	(%rcx,%rax), %r15d	# 11516	[c=13 l=5]  *zero_extendqisi2/0
+.L958:
+	cmpl	$63, %edx	# 15581	[c=4 l=3]  *cmpsi_1/0
+	leaq	.LC32(%rip), %rsi	# 16646	[c=1 l=7]  *movdi_internal/4
+	movl	%r15d, %ecx	# 11532	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 11535	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC33(%rip), %rax	# 16647	[c=1 l=7]  *movdi_internal/4
+	cmovne	%rax, %rsi	# 15582	[c=8 l=4]  *movdicc_noc/1
+	call	log_add_data_mov@PLT	# 11536	[c=0 l=5]  *call
+	testl	%r15d, %r14d	# 11538	[c=4 l=3]  *testsi_1/0
+	jne	.L1549	# 11539	[c=13 l=6]  *jcc
+.L960:
+	movq	%r13, %rdi	# 11551	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 11550	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 11552	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 17451	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 17452	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 11554	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18223	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 11555	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 11557	[c=4 l=3]  *cmpdi_1/0
+	jb	.L283	# 11558	[c=13 l=6]  *jcc
+	movq	56(%r13), %rax	# 17453	[c=9 l=4]  *movdi_internal/3
+	cmpq	%rax, 48(%r13)	# 11561	[c=13 l=4]  *cmpdi_1/0
+	jnb	.L1550	# 11562	[c=13 l=6]  *jcc
+.L961:
+	movq	%r13, %rdi	# 11568	[c=4 l=3]  *movdi_internal/3
+	call	log_is_idle@PLT	# 11569	[c=10 l=5]  *call_value
+	testb	%al, %al	# 11571	[c=4 l=2]  *cmpqi_ccno_1/0
+	jne	.L1551	# 11572	[c=13 l=6]  *jcc
+.L962:
+	movl	0(%r13), %ebx	# 11583	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 11588	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 11584	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 11586	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 11587	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 11589	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 11590	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 11591	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 11594	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 17454	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 11595	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 11598	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 11599	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 19269	[c=10 l=4]  *indirect_jump
+.L963:
+	movzbl	10(%rbx), %r14d	# 11608	[c=13 l=5]  zero_extendqidi2/0
+	movzwl	12(%rbx), %eax	# 11607	[c=13 l=4]  *zero_extendhisi2/0
+	leaq	.LC43(%rip), %rsi	# 11613	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 11615	[c=4 l=3]  *movdi_internal/3
+	movzbl	1004(%r13,%r14), %ecx	# 11610	[c=14 l=9]  *zero_extendqisi2/0
+	movl	%eax, 8(%rsp)	# 17456	[c=4 l=4]  *movsi_internal/1
+	movl	%r14d, %edx	# 11612	[c=4 l=3]  *movsi_internal/0
+	xorl	%eax, %eax	# 19268	[c=4 l=2]  *movdi_xor
+	call	log_append@PLT	# 11617	[c=0 l=5]  *call
+	cmpl	$15, %r14d	# 11620	[c=4 l=4]  *cmpsi_1/0
+	jle	.L1552	# 11621	[c=13 l=6]  *jcc
+	movzbl	1004(%r13,%r14), %eax	# 11634	[c=14 l=9]  *zero_extendqisi2/0
+	testl	%eax, 8(%rsp)	# 11636	[c=13 l=4]  *testsi_1/0
+	je	.L1553	# 11637	[c=13 l=6]  *jcc
+.L965:
+	movq	%r13, %rdi	# 11649	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 11648	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 11650	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 17459	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 17460	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 11652	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18222	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 11653	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 11655	[c=4 l=3]  *cmpdi_1/0
+	jb	.L283	# 11656	[c=13 l=6]  *jcc
+	movq	56(%r13), %rax	# 17461	[c=9 l=4]  *movdi_internal/3
+	cmpq	%rax, 48(%r13)	# 11659	[c=13 l=4]  *cmpdi_1/0
+	jnb	.L1554	# 11660	[c=13 l=6]  *jcc
+.L966:
+	movq	%r13, %rdi	# 11666	[c=4 l=3]  *movdi_internal/3
+	call	log_is_idle@PLT	# 11667	[c=10 l=5]  *call_value
+	testb	%al, %al	# 11669	[c=4 l=2]  *cmpqi_ccno_1/0
+	jne	.L1555	# 11670	[c=13 l=6]  *jcc
+.L967:
+	movl	0(%r13), %ebx	# 11681	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 11686	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 11682	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 11684	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 11685	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 11687	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 11688	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 11689	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 11692	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 17462	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 11693	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 11696	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 11697	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 19266	[c=10 l=4]  *indirect_jump
+.L968:
+	movzbl	10(%rbx), %r14d	# 11706	[c=13 l=5]  zero_extendqidi2/0
+	movzwl	12(%rbx), %eax	# 11705	[c=13 l=4]  *zero_extendhisi2/0
+	leaq	.LC43(%rip), %rsi	# 11711	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 11713	[c=4 l=3]  *movdi_internal/3
+	movzbl	1004(%r13,%r14), %ecx	# 11708	[c=14 l=9]  *zero_extendqisi2/0
+	movl	%eax, 8(%rsp)	# 17464	[c=4 l=4]  *movsi_internal/1
+	movl	%r14d, %edx	# 11710	[c=4 l=3]  *movsi_internal/0
+	xorl	%eax, %eax	# 19265	[c=4 l=2]  *movdi_xor
+	call	log_append@PLT	# 11715	[c=0 l=5]  *call
+	cmpl	$15, %r14d	# 11718	[c=4 l=4]  *cmpsi_1/0
+	jle	.L1556	# 11719	[c=13 l=6]  *jcc
+	movzbl	1004(%r13,%r14), %eax	# 11732	[c=14 l=9]  *zero_extendqisi2/0
+	testl	%eax, 8(%rsp)	# 11734	[c=13 l=4]  *testsi_1/0
+	je	.L1557	# 11735	[c=13 l=6]  *jcc
+.L970:
+	movq	%r13, %rdi	# 11747	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 11746	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 11748	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 17467	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 17468	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 11750	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18221	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 11751	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 11753	[c=4 l=3]  *cmpdi_1/0
+	jb	.L283	# 11754	[c=13 l=6]  *jcc
+	movq	56(%r13), %rax	# 17469	[c=9 l=4]  *movdi_internal/3
+	cmpq	%rax, 48(%r13)	# 11757	[c=13 l=4]  *cmpdi_1/0
+	jnb	.L1558	# 11758	[c=13 l=6]  *jcc
+.L971:
+	movq	%r13, %rdi	# 11764	[c=4 l=3]  *movdi_internal/3
+	call	log_is_idle@PLT	# 11765	[c=10 l=5]  *call_value
+	testb	%al, %al	# 11767	[c=4 l=2]  *cmpqi_ccno_1/0
+	jne	.L1559	# 11768	[c=13 l=6]  *jcc
+.L972:
+	movl	0(%r13), %ebx	# 11779	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 11784	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 11780	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 11782	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 11783	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 11785	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 11786	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 11787	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 11790	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 17470	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 11791	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 11794	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 11795	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 19263	[c=10 l=4]  *indirect_jump
+.L973:
+	movzbl	10(%rbx), %r14d	# 11804	[c=13 l=5]  zero_extendqidi2/0
+	movzwl	12(%rbx), %eax	# 11803	[c=13 l=4]  *zero_extendhisi2/0
+	leaq	.LC43(%rip), %rsi	# 11809	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 11811	[c=4 l=3]  *movdi_internal/3
+	movzbl	1004(%r13,%r14), %ecx	# 11806	[c=14 l=9]  *zero_extendqisi2/0
+	movl	%eax, 8(%rsp)	# 17472	[c=4 l=4]  *movsi_internal/1
+	movl	%r14d, %edx	# 11808	[c=4 l=3]  *movsi_internal/0
+	xorl	%eax, %eax	# 19262	[c=4 l=2]  *movdi_xor
+	call	log_append@PLT	# 11813	[c=0 l=5]  *call
+	cmpl	$15, %r14d	# 11816	[c=4 l=4]  *cmpsi_1/0
+	jle	.L1560	# 11817	[c=13 l=6]  *jcc
+	movzbl	1004(%r13,%r14), %eax	# 11830	[c=14 l=9]  *zero_extendqisi2/0
+	testl	%eax, 8(%rsp)	# 11832	[c=13 l=4]  *testsi_1/0
+	jne	.L1561	# 11833	[c=13 l=6]  *jcc
+.L975:
+	movq	%r13, %rdi	# 11845	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 11844	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 11846	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 17475	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 17476	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 11848	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18220	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 11849	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 11851	[c=4 l=3]  *cmpdi_1/0
+	jb	.L283	# 11852	[c=13 l=6]  *jcc
+	movq	56(%r13), %rax	# 17477	[c=9 l=4]  *movdi_internal/3
+	cmpq	%rax, 48(%r13)	# 11855	[c=13 l=4]  *cmpdi_1/0
+	jnb	.L1562	# 11856	[c=13 l=6]  *jcc
+.L976:
+	movq	%r13, %rdi	# 11862	[c=4 l=3]  *movdi_internal/3
+	call	log_is_idle@PLT	# 11863	[c=10 l=5]  *call_value
+	testb	%al, %al	# 11865	[c=4 l=2]  *cmpqi_ccno_1/0
+	jne	.L1563	# 11866	[c=13 l=6]  *jcc
+.L977:
+	movl	0(%r13), %ebx	# 11877	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 11882	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 11878	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 11880	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 11881	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 11883	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 11884	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 11885	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 11888	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 17478	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 11889	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 11892	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 11893	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 19260	[c=10 l=4]  *indirect_jump
+.L978:
+	movzbl	10(%rbx), %r14d	# 11902	[c=13 l=5]  zero_extendqidi2/0
+	movzwl	12(%rbx), %eax	# 11901	[c=13 l=4]  *zero_extendhisi2/0
+	leaq	.LC43(%rip), %rsi	# 11907	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 11909	[c=4 l=3]  *movdi_internal/3
+	movzbl	1004(%r13,%r14), %ecx	# 11904	[c=14 l=9]  *zero_extendqisi2/0
+	movl	%eax, 8(%rsp)	# 17480	[c=4 l=4]  *movsi_internal/1
+	movl	%r14d, %edx	# 11906	[c=4 l=3]  *movsi_internal/0
+	xorl	%eax, %eax	# 19259	[c=4 l=2]  *movdi_xor
+	call	log_append@PLT	# 11911	[c=0 l=5]  *call
+	cmpl	$15, %r14d	# 11914	[c=4 l=4]  *cmpsi_1/0
+	jle	.L1564	# 11915	[c=13 l=6]  *jcc
+	movzbl	1004(%r13,%r14), %eax	# 11928	[c=14 l=9]  *zero_extendqisi2/0
+	testl	%eax, 8(%rsp)	# 11930	[c=13 l=4]  *testsi_1/0
+	jne	.L1565	# 11931	[c=13 l=6]  *jcc
+.L980:
+	movq	%r13, %rdi	# 11943	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 11942	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 11944	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 17483	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 17484	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 11946	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18219	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 11947	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 11949	[c=4 l=3]  *cmpdi_1/0
+	jb	.L283	# 11950	[c=13 l=6]  *jcc
+	movq	56(%r13), %rax	# 17485	[c=9 l=4]  *movdi_internal/3
+	cmpq	%rax, 48(%r13)	# 11953	[c=13 l=4]  *cmpdi_1/0
+	jnb	.L1566	# 11954	[c=13 l=6]  *jcc
+.L981:
+	movq	%r13, %rdi	# 11960	[c=4 l=3]  *movdi_internal/3
+	call	log_is_idle@PLT	# 11961	[c=10 l=5]  *call_value
+	testb	%al, %al	# 11963	[c=4 l=2]  *cmpqi_ccno_1/0
+	jne	.L1567	# 11964	[c=13 l=6]  *jcc
+.L982:
+	movl	0(%r13), %ebx	# 11975	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 11980	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 11976	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 11978	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 11979	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 11981	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 11982	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 11983	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 11986	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 17486	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 11987	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 11990	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 11991	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 19257	[c=10 l=4]  *indirect_jump
+.L983:
+	movslq	892(%r13), %rcx	# 12002	[c=13 l=7]  *extendsidi2_rex64/1
+	leaq	se.0(%rip), %rdx	# 12001	[c=1 l=7]  *movdi_internal/4
+	movq	1040(%r13), %rsi	# 11999	[c=9 l=7]  *movdi_internal/3
+	movzwl	(%rdx,%rcx,4), %eax	# 12003	[c=14 l=4]  zero_extendhidi2/0
+	movzbl	(%rsi,%rax), %eax	# 12006	[c=9 l=4]  *movqi_internal/4
+	andb	2(%rdx,%rcx,4), %al	# 12007	[c=14 l=4]  *andqi_2_maybe_si/1
+	je	.L984	# 12009	[c=13 l=2]  *jcc
+	cmpb	$0, 63(%rsi)	# 12014	[c=13 l=4]  *cmpqi_ccno_1/1
+	movq	48(%r13), %r14	# 12011	[c=9 l=4]  *movdi_internal/3
+	jns	.L986	# 12015	[c=13 l=6]  *jcc
+	movq	%r13, %rdi	# 12026	[c=4 l=3]  *movdi_internal/3
+	call	events_sleep@PLT	# 12027	[c=10 l=5]  *call_value
+	testb	%al, %al	# 12030	[c=4 l=2]  *cmpqi_ccno_1/0
+	je	.L986	# 12031	[c=13 l=6]  *jcc
+	movq	48(%r13), %rdx	# 17488	[c=9 l=4]  *movdi_internal/3
+	leaq	.LC67(%rip), %rsi	# 12037	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 12039	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 19255	[c=4 l=2]  *movdi_xor
+	subq	%r14, %rdx	# 12034	[c=4 l=3]  *subdi_1/0
+	addq	%rdx, 64(%r13)	# 12035	[c=13 l=4]  *adddi_1/0
+	call	log_append@PLT	# 12041	[c=0 l=5]  *call
+.L984:
+	movq	%r13, %rdi	# 12045	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 12044	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 12046	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 17490	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 17491	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 12048	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18218	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 12049	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 12051	[c=4 l=3]  *cmpdi_1/0
+	jb	.L283	# 12052	[c=13 l=6]  *jcc
+	movq	56(%r13), %rax	# 17492	[c=9 l=4]  *movdi_internal/3
+	cmpq	%rax, 48(%r13)	# 12055	[c=13 l=4]  *cmpdi_1/0
+	jnb	.L1568	# 12056	[c=13 l=6]  *jcc
+.L987:
+	movq	%r13, %rdi	# 12062	[c=4 l=3]  *movdi_internal/3
+	call	log_is_idle@PLT	# 12063	[c=10 l=5]  *call_value
+	testb	%al, %al	# 12065	[c=4 l=2]  *cmpqi_ccno_1/0
+	jne	.L1569	# 12066	[c=13 l=6]  *jcc
+.L988:
+	movl	0(%r13), %ebx	# 12077	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 12082	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 12078	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 12080	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 12081	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 12083	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 12084	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 12085	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 12088	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 17493	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 12089	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 12092	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 12093	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 19254	[c=10 l=4]  *indirect_jump
+.L989:
+	movl	0(%r13), %eax	# 17495	[c=5 l=4]  *movsi_internal/0
+	movq	1056(%r13), %rdx	# 12106	[c=9 l=7]  *movdi_internal/3
+	leaq	.LC34(%rip), %rsi	# 12109	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 12111	[c=4 l=3]  *movdi_internal/3
+	subl	$1, %eax	# 12102	[c=4 l=3]  *addsi_1/0
+	movl	%eax, 0(%r13)	# 12103	[c=4 l=4]  *movsi_internal/1
+	addl	%eax, %eax	# 12104	[c=5 l=2]  *ashlsi3_1_zext/0
+	movzwl	(%rdx,%rax), %ebx	# 12107	[c=13 l=4]  *zero_extendhisi2/0
+	xorl	%eax, %eax	# 19251	[c=4 l=2]  *movdi_xor
+	movl	%ebx, %edx	# 12108	[c=4 l=2]  *movsi_internal/0
+	call	log_append@PLT	# 12113	[c=0 l=5]  *call
+	movl	$1, 72(%r13)	# 12114	[c=4 l=8]  *movsi_internal/1
+	xorl	%esi, %esi	# 19252	[c=4 l=2]  *movdi_xor
+	movq	%r13, %rdi	# 12116	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 12117	[c=0 l=5]  *call
+	movl	%ebx, %ecx	# 12118	[c=4 l=2]  *movsi_internal/0
+	leaq	.LC37(%rip), %rdx	# 12119	[c=1 l=7]  *movdi_internal/4
+	xorl	%eax, %eax	# 19253	[c=4 l=2]  *movdi_xor
+	movl	$8, %esi	# 12121	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 12122	[c=4 l=3]  *movdi_internal/3
+	call	leave	# 12124	[c=0 l=5]  *call
+.L990:
+	movzbl	10(%rbx), %r14d	# 12129	[c=13 l=5]  *zero_extendqisi2/0
+	xorl	%eax, %eax	# 19249	[c=4 l=2]  *movdi_xor
+	movl	$28, %edx	# 12132	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 12135	[c=4 l=3]  *movdi_internal/3
+	movzwl	1032(%r13), %r9d	# 12130	[c=13 l=8]  *zero_extendhisi2/0
+	leaq	.LC44(%rip), %rsi	# 12133	[c=1 l=7]  *movdi_internal/4
+	movzwl	12(%rbx), %r15d	# 12128	[c=13 l=5]  *zero_extendhisi2/0
+	movl	%r9d, %ecx	# 12131	[c=4 l=3]  *movsi_internal/0
+	movl	%r9d, 16(%rsp)	# 18070	[c=4 l=5]  *movsi_internal/1
+	call	log_append@PLT	# 12137	[c=0 l=5]  *call
+	movslq	%r14d, %r8	# 12138	[c=4 l=3]  *extendsidi2_rex64/1
+	xorl	%eax, %eax	# 19250	[c=4 l=2]  *movdi_xor
+	movl	%r14d, %edx	# 12141	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC43(%rip), %rsi	# 12142	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 12144	[c=4 l=3]  *movdi_internal/3
+	movq	%r8, 8(%rsp)	# 18068	[c=4 l=5]  *movdi_internal/5
+	movzbl	1004(%r13,%r8), %ecx	# 12139	[c=14 l=9]  *zero_extendqisi2/0
+	call	log_append@PLT	# 12146	[c=0 l=5]  *call
+	cmpl	$15, %r14d	# 12149	[c=4 l=4]  *cmpsi_1/0
+	movq	8(%rsp), %r8	# 18069	[c=9 l=5]  *movdi_internal/3
+	movl	16(%rsp), %r9d	# 18071	[c=9 l=5]  *movsi_internal/0
+	jle	.L1570	# 12150	[c=13 l=6]  *jcc
+	leal	(%r15,%r9), %r14d	# 18217	[c=4 l=4]  *leasi
+	leaq	.LC29(%rip), %rdx	# 16649	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 12174	[c=4 l=3]  *movdi_internal/3
+	movzbl	1004(%r13,%r8), %ecx	# 12163	[c=14 l=9]  *zero_extendqisi2/0
+	cmpl	$63, %r14d	# 15593	[c=4 l=4]  *cmpsi_1/0
+	leaq	.LC28(%rip), %rsi	# 16648	[c=1 l=7]  *movdi_internal/4
+	cmovne	%rdx, %rsi	# 15594	[c=8 l=4]  *movdicc_noc/1
+	movl	%r14d, %edx	# 12172	[c=4 l=3]  *movsi_internal/0
+	movb	%cl, 8(%rsp)	# 18073	[c=4 l=4]  *movqi_internal/8
+	movl	%ecx, 16(%rsp)	# 18072	[c=4 l=4]  *movsi_internal/1
+	call	log_add_data_mov@PLT	# 12175	[c=0 l=5]  *call
+	movl	%r14d, %edx	# 17497	[c=4 l=3]  *movsi_internal/0
+	subl	5176(%r13), %edx	# 12176	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %edx	# 12177	[c=13 l=7]  *cmpsi_1/1
+	movzbl	8(%rsp), %r8d	# 18074	[c=9 l=6]  *movqi_internal/4
+	jb	.L993	# 12178	[c=13 l=2]  *jcc
+	movl	%r14d, %edx	# 17499	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %edx	# 12180	[c=4 l=3]  *ashrsi3_1/0
+	movslq	%edx, %rdx	# 12181	[c=4 l=3]  *extendsidi2_rex64/1
+	cmpb	$0, 1080(%r13,%rdx)	# 12182	[c=14 l=9]  *cmpqi_ccno_1/1
+	jne	.L994	# 12183	[c=13 l=6]  *jcc
+.L993:
+	movq	1040(%r13), %rdx	# 12187	[c=9 l=7]  *movdi_internal/3
+	movslq	%r14d, %rax	# 12186	[c=4 l=3]  *extendsidi2_rex64/1
+	movb	%r8b, (%rdx,%rax)	# 12188	[c=4 l=4]  *movqi_internal/8
+.L995:
+	testl	%r15d, %r15d	# 12199	[c=4 l=3]  *cmpsi_ccno_1/0
+	je	.L1571	# 12200	[c=13 l=6]  *jcc
+.L996:
+	movq	%r13, %rdi	# 12206	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 12205	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 12207	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 17501	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 17502	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 12209	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18216	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 12210	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 12212	[c=4 l=3]  *cmpdi_1/0
+	jb	.L283	# 12213	[c=13 l=6]  *jcc
+	movl	0(%r13), %ebx	# 12215	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 12220	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 12216	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 12218	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 12219	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 12221	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 12222	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 12223	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 12226	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 17503	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 12227	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 12230	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 12231	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 19247	[c=10 l=4]  *indirect_jump
+.L997:
+	movzbl	10(%rbx), %r14d	# 12240	[c=13 l=5]  *zero_extendqisi2/0
+	xorl	%eax, %eax	# 19245	[c=4 l=2]  *movdi_xor
+	movl	$30, %edx	# 12243	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 12246	[c=4 l=3]  *movdi_internal/3
+	movzwl	1034(%r13), %r9d	# 12241	[c=13 l=8]  *zero_extendhisi2/0
+	leaq	.LC44(%rip), %rsi	# 12244	[c=1 l=7]  *movdi_internal/4
+	movzwl	12(%rbx), %r15d	# 12239	[c=13 l=5]  *zero_extendhisi2/0
+	movl	%r9d, %ecx	# 12242	[c=4 l=3]  *movsi_internal/0
+	movl	%r9d, 16(%rsp)	# 18077	[c=4 l=5]  *movsi_internal/1
+	call	log_append@PLT	# 12248	[c=0 l=5]  *call
+	movslq	%r14d, %r8	# 12249	[c=4 l=3]  *extendsidi2_rex64/1
+	xorl	%eax, %eax	# 19246	[c=4 l=2]  *movdi_xor
+	movl	%r14d, %edx	# 12252	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC43(%rip), %rsi	# 12253	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 12255	[c=4 l=3]  *movdi_internal/3
+	movq	%r8, 8(%rsp)	# 18075	[c=4 l=5]  *movdi_internal/5
+	movzbl	1004(%r13,%r8), %ecx	# 12250	[c=14 l=9]  *zero_extendqisi2/0
+	call	log_append@PLT	# 12257	[c=0 l=5]  *call
+	cmpl	$15, %r14d	# 12260	[c=4 l=4]  *cmpsi_1/0
+	movq	8(%rsp), %r8	# 18076	[c=9 l=5]  *movdi_internal/3
+	movl	16(%rsp), %r9d	# 18078	[c=9 l=5]  *movsi_internal/0
+	jle	.L1572	# 12261	[c=13 l=6]  *jcc
+	leal	(%r15,%r9), %r14d	# 18215	[c=4 l=4]  *leasi
+	leaq	.LC29(%rip), %rdx	# 16651	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 12285	[c=4 l=3]  *movdi_internal/3
+	movzbl	1004(%r13,%r8), %ecx	# 12274	[c=14 l=9]  *zero_extendqisi2/0
+	cmpl	$63, %r14d	# 15605	[c=4 l=4]  *cmpsi_1/0
+	leaq	.LC28(%rip), %rsi	# 16650	[c=1 l=7]  *movdi_internal/4
+	cmovne	%rdx, %rsi	# 15606	[c=8 l=4]  *movdicc_noc/1
+	movl	%r14d, %edx	# 12283	[c=4 l=3]  *movsi_internal/0
+	movb	%cl, 8(%rsp)	# 18080	[c=4 l=4]  *movqi_internal/8
+	movl	%ecx, 16(%rsp)	# 18079	[c=4 l=4]  *movsi_internal/1
+	call	log_add_data_mov@PLT	# 12286	[c=0 l=5]  *call
+	movl	%r14d, %edx	# 17506	[c=4 l=3]  *movsi_internal/0
+	subl	5176(%r13), %edx	# 12287	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %edx	# 12288	[c=13 l=7]  *cmpsi_1/1
+	movzbl	8(%rsp), %r8d	# 18081	[c=9 l=6]  *movqi_internal/4
+	jb	.L1000	# 12289	[c=13 l=2]  *jcc
+	movl	%r14d, %edx	# 17508	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %edx	# 12291	[c=4 l=3]  *ashrsi3_1/0
+	movslq	%edx, %rdx	# 12292	[c=4 l=3]  *extendsidi2_rex64/1
+	cmpb	$0, 1080(%r13,%rdx)	# 12293	[c=14 l=9]  *cmpqi_ccno_1/1
+	jne	.L1001	# 12294	[c=13 l=6]  *jcc
+.L1000:
+	movq	1040(%r13), %rdx	# 12298	[c=9 l=7]  *movdi_internal/3
+	movslq	%r14d, %rax	# 12297	[c=4 l=3]  *extendsidi2_rex64/1
+	movb	%r8b, (%rdx,%rax)	# 12299	[c=4 l=4]  *movqi_internal/8
+.L1002:
+	testl	%r15d, %r15d	# 12310	[c=4 l=3]  *cmpsi_ccno_1/0
+	je	.L1573	# 12311	[c=13 l=6]  *jcc
+.L1003:
+	movq	%r13, %rdi	# 12317	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 12316	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 12318	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 17510	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 17511	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 12320	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18214	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 12321	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 12323	[c=4 l=3]  *cmpdi_1/0
+	jb	.L283	# 12324	[c=13 l=6]  *jcc
+	movl	0(%r13), %ebx	# 12326	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 12331	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 12327	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 12329	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 12330	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 12332	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 12333	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 12334	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 12337	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 17512	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 12338	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 12341	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 12342	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 19243	[c=10 l=4]  *indirect_jump
+.L1004:
+	movzbl	10(%rbx), %r9d	# 12352	[c=13 l=5]  zero_extendqidi2/0
+	movzwl	12(%rbx), %r14d	# 12350	[c=13 l=5]  *zero_extendhisi2/0
+	xorl	%eax, %eax	# 19242	[c=4 l=2]  *movdi_xor
+	movq	%r13, %rdi	# 12359	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC43(%rip), %rsi	# 12357	[c=1 l=7]  *movdi_internal/4
+	movzbl	1004(%r13,%r9), %ecx	# 12354	[c=14 l=9]  *zero_extendqisi2/0
+	movq	%r9, %r15	# 18605	[c=4 l=3]  *movdi_internal/3
+	movl	%r9d, %edx	# 12356	[c=4 l=3]  *movsi_internal/0
+	movq	%r9, 8(%rsp)	# 18082	[c=4 l=5]  *movdi_internal/5
+	movw	%r14w, 16(%rsp)	# 18084	[c=4 l=6]  *movhi_internal/3
+	call	log_append@PLT	# 12361	[c=0 l=5]  *call
+	cmpl	$15, %r15d	# 12364	[c=4 l=4]  *cmpsi_1/0
+	movq	8(%rsp), %r9	# 18083	[c=9 l=5]  *movdi_internal/3
+	jle	.L1574	# 12365	[c=13 l=6]  *jcc
+	cmpl	$63, %r14d	# 15617	[c=4 l=4]  *cmpsi_1/0
+	leaq	.LC29(%rip), %rdx	# 16653	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 12388	[c=4 l=3]  *movdi_internal/3
+	movzbl	1004(%r13,%r9), %ecx	# 12378	[c=14 l=9]  *zero_extendqisi2/0
+	leaq	.LC28(%rip), %rsi	# 16652	[c=1 l=7]  *movdi_internal/4
+	cmovne	%rdx, %rsi	# 15618	[c=8 l=4]  *movdicc_noc/1
+	movl	%r14d, %edx	# 12386	[c=4 l=3]  *movsi_internal/0
+	movl	%ecx, 8(%rsp)	# 18085	[c=4 l=4]  *movsi_internal/1
+	movl	%ecx, %r15d	# 18606	[c=4 l=3]  *movsi_internal/0
+	call	log_add_data_mov@PLT	# 12389	[c=0 l=5]  *call
+	movl	%r14d, %edx	# 17517	[c=4 l=3]  *movsi_internal/0
+	subl	5176(%r13), %edx	# 12391	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %edx	# 12392	[c=13 l=7]  *cmpsi_1/1
+	jb	.L1007	# 12393	[c=13 l=2]  *jcc
+	movl	%r14d, %edx	# 17519	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %edx	# 12395	[c=4 l=3]  *ashrsi3_1/0
+	movslq	%edx, %rdx	# 12396	[c=4 l=3]  *extendsidi2_rex64/1
+	cmpb	$0, 1080(%r13,%rdx)	# 12397	[c=14 l=9]  *cmpqi_ccno_1/1
+	jne	.L1008	# 12398	[c=13 l=6]  *jcc
+.L1007:
+	movzwl	16(%rsp), %r14d	# 12401	[c=13 l=6]  zero_extendhidi2/0
+	movq	1040(%r13), %rdx	# 12402	[c=9 l=7]  *movdi_internal/3
+	movb	%r15b, (%rdx,%r14)	# 12403	[c=4 l=4]  *movqi_internal/8
+.L1009:
+	movq	%r13, %rdi	# 12415	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 12414	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 12416	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 17522	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 17523	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 12418	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18213	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 12419	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 12421	[c=4 l=3]  *cmpdi_1/0
+	jb	.L283	# 12422	[c=13 l=6]  *jcc
+	movl	0(%r13), %ebx	# 12424	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 12429	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 12425	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 12427	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 12428	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 12430	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 12431	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 12432	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 12435	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 17524	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 12436	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 12439	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 12440	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 19240	[c=10 l=4]  *indirect_jump
+.L1010:
+	movzbl	10(%rbx), %r9d	# 12450	[c=13 l=5]  zero_extendqidi2/0
+	movzwl	12(%rbx), %r14d	# 12448	[c=13 l=5]  *zero_extendhisi2/0
+	xorl	%eax, %eax	# 19239	[c=4 l=2]  *movdi_xor
+	movq	%r13, %rdi	# 12457	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC43(%rip), %rsi	# 12455	[c=1 l=7]  *movdi_internal/4
+	movzbl	1004(%r13,%r9), %ecx	# 12452	[c=14 l=9]  *zero_extendqisi2/0
+	movq	%r9, %r15	# 18608	[c=4 l=3]  *movdi_internal/3
+	movl	%r9d, %edx	# 12454	[c=4 l=3]  *movsi_internal/0
+	movq	%r9, 8(%rsp)	# 18086	[c=4 l=5]  *movdi_internal/5
+	movw	%r14w, 16(%rsp)	# 18088	[c=4 l=6]  *movhi_internal/3
+	call	log_append@PLT	# 12459	[c=0 l=5]  *call
+	cmpl	$15, %r15d	# 12462	[c=4 l=4]  *cmpsi_1/0
+	movq	8(%rsp), %r9	# 18087	[c=9 l=5]  *movdi_internal/3
+	jle	.L1575	# 12463	[c=13 l=6]  *jcc
+	cmpl	$63, %r14d	# 15629	[c=4 l=4]  *cmpsi_1/0
+	leaq	.LC29(%rip), %rdx	# 16655	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 12486	[c=4 l=3]  *movdi_internal/3
+	movzbl	1004(%r13,%r9), %ecx	# 12476	[c=14 l=9]  *zero_extendqisi2/0
+	leaq	.LC28(%rip), %rsi	# 16654	[c=1 l=7]  *movdi_internal/4
+	cmovne	%rdx, %rsi	# 15630	[c=8 l=4]  *movdicc_noc/1
+	movl	%r14d, %edx	# 12484	[c=4 l=3]  *movsi_internal/0
+	movl	%ecx, 8(%rsp)	# 18089	[c=4 l=4]  *movsi_internal/1
+	movl	%ecx, %r15d	# 18609	[c=4 l=3]  *movsi_internal/0
+	call	log_add_data_mov@PLT	# 12487	[c=0 l=5]  *call
+	movl	%r14d, %edx	# 17529	[c=4 l=3]  *movsi_internal/0
+	subl	5176(%r13), %edx	# 12489	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %edx	# 12490	[c=13 l=7]  *cmpsi_1/1
+	jb	.L1013	# 12491	[c=13 l=2]  *jcc
+	movl	%r14d, %edx	# 17531	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %edx	# 12493	[c=4 l=3]  *ashrsi3_1/0
+	movslq	%edx, %rdx	# 12494	[c=4 l=3]  *extendsidi2_rex64/1
+	cmpb	$0, 1080(%r13,%rdx)	# 12495	[c=14 l=9]  *cmpqi_ccno_1/1
+	jne	.L1014	# 12496	[c=13 l=6]  *jcc
+.L1013:
+	movzwl	16(%rsp), %r14d	# 12499	[c=13 l=6]  zero_extendhidi2/0
+	movq	1040(%r13), %rdx	# 12500	[c=9 l=7]  *movdi_internal/3
+	movb	%r15b, (%rdx,%r14)	# 12501	[c=4 l=4]  *movqi_internal/8
+.L1015:
+	movq	%r13, %rdi	# 12513	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 12512	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 12514	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 17534	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 17535	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 12516	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18212	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 12517	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 12519	[c=4 l=3]  *cmpdi_1/0
+	jb	.L283	# 12520	[c=13 l=6]  *jcc
+	movl	0(%r13), %ebx	# 12522	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 12527	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 12523	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 12525	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 12526	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 12528	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 12529	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 12530	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 12533	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 17536	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 12534	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 12537	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 12538	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 19237	[c=10 l=4]  *indirect_jump
+.L1016:
+	movzbl	10(%rbx), %r14d	# 12546	[c=13 l=5]  *zero_extendqisi2/0
+	xorl	%eax, %eax	# 19235	[c=4 l=2]  *movdi_xor
+	movl	$26, %edx	# 12550	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 12553	[c=4 l=3]  *movdi_internal/3
+	movzwl	1030(%r13), %r15d	# 12547	[c=13 l=8]  *zero_extendhisi2/0
+	leaq	.LC44(%rip), %rsi	# 12551	[c=1 l=7]  *movdi_internal/4
+	movl	%r15d, %ecx	# 12549	[c=4 l=3]  *movsi_internal/0
+	movw	%r15w, 16(%rsp)	# 18092	[c=4 l=6]  *movhi_internal/3
+	call	log_append@PLT	# 12555	[c=0 l=5]  *call
+	movslq	%r14d, %r9	# 12556	[c=4 l=3]  *extendsidi2_rex64/1
+	xorl	%eax, %eax	# 19236	[c=4 l=2]  *movdi_xor
+	movl	%r14d, %edx	# 12559	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC43(%rip), %rsi	# 12560	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 12562	[c=4 l=3]  *movdi_internal/3
+	movq	%r9, 8(%rsp)	# 18090	[c=4 l=5]  *movdi_internal/5
+	movzbl	1004(%r13,%r9), %ecx	# 12557	[c=14 l=9]  *zero_extendqisi2/0
+	call	log_append@PLT	# 12564	[c=0 l=5]  *call
+	cmpl	$15, %r14d	# 12567	[c=4 l=4]  *cmpsi_1/0
+	movq	8(%rsp), %r9	# 18091	[c=9 l=5]  *movdi_internal/3
+	jle	.L1576	# 12568	[c=13 l=6]  *jcc
+	cmpl	$63, %r15d	# 15641	[c=4 l=4]  *cmpsi_1/0
+	leaq	.LC29(%rip), %rdx	# 16657	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 12591	[c=4 l=3]  *movdi_internal/3
+	movzbl	1004(%r13,%r9), %ecx	# 12581	[c=14 l=9]  *zero_extendqisi2/0
+	leaq	.LC28(%rip), %rsi	# 16656	[c=1 l=7]  *movdi_internal/4
+	cmovne	%rdx, %rsi	# 15642	[c=8 l=4]  *movdicc_noc/1
+	movl	%r15d, %edx	# 12589	[c=4 l=3]  *movsi_internal/0
+	movl	%ecx, 8(%rsp)	# 18093	[c=4 l=4]  *movsi_internal/1
+	movl	%ecx, %r14d	# 18611	[c=4 l=3]  *movsi_internal/0
+	call	log_add_data_mov@PLT	# 12592	[c=0 l=5]  *call
+	movl	%r15d, %edx	# 17541	[c=4 l=3]  *movsi_internal/0
+	subl	5176(%r13), %edx	# 12594	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %edx	# 12595	[c=13 l=7]  *cmpsi_1/1
+	jb	.L1019	# 12596	[c=13 l=2]  *jcc
+	movl	%r15d, %edx	# 17543	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %edx	# 12598	[c=4 l=3]  *ashrsi3_1/0
+	movslq	%edx, %rdx	# 12599	[c=4 l=3]  *extendsidi2_rex64/1
+	cmpb	$0, 1080(%r13,%rdx)	# 12600	[c=14 l=9]  *cmpqi_ccno_1/1
+	jne	.L1020	# 12601	[c=13 l=6]  *jcc
+.L1019:
+	movzwl	16(%rsp), %r15d	# 12604	[c=13 l=6]  zero_extendhidi2/0
+	movq	1040(%r13), %rdx	# 12605	[c=9 l=7]  *movdi_internal/3
+	movb	%r14b, (%rdx,%r15)	# 12606	[c=4 l=4]  *movqi_internal/8
+.L1021:
+	subq	$1, 48(%r13)	# 12617	[c=13 l=5]  *adddi_1/0
+	movq	%r13, %rdi	# 12619	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 12618	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 12620	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 17546	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 17547	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 12622	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18211	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 12623	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 12625	[c=4 l=3]  *cmpdi_1/0
+	jb	.L283	# 12626	[c=13 l=6]  *jcc
+	movl	0(%r13), %ebx	# 12628	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 12633	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 12629	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 12631	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 12632	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 12634	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 12635	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 12636	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 12639	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 17548	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 12640	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 12643	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 12644	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 19233	[c=10 l=4]  *indirect_jump
+.L1022:
+	movzbl	10(%rbx), %r14d	# 12652	[c=13 l=5]  *zero_extendqisi2/0
+	xorl	%eax, %eax	# 19231	[c=4 l=2]  *movdi_xor
+	movl	$26, %edx	# 12655	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 12658	[c=4 l=3]  *movdi_internal/3
+	movzwl	1030(%r13), %r15d	# 12653	[c=13 l=8]  *zero_extendhisi2/0
+	leaq	.LC44(%rip), %rsi	# 12656	[c=1 l=7]  *movdi_internal/4
+	movl	%r15d, %ecx	# 12654	[c=4 l=3]  *movsi_internal/0
+	subl	$1, %r15d	# 12661	[c=4 l=4]  *addsi_1/0
+	call	log_append@PLT	# 12660	[c=0 l=5]  *call
+	movslq	%r14d, %r8	# 12662	[c=4 l=3]  *extendsidi2_rex64/1
+	xorl	%eax, %eax	# 19232	[c=4 l=2]  *movdi_xor
+	movl	%r14d, %edx	# 12665	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC43(%rip), %rsi	# 12666	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 12668	[c=4 l=3]  *movdi_internal/3
+	movq	%r8, 8(%rsp)	# 18094	[c=4 l=5]  *movdi_internal/5
+	movzbl	1004(%r13,%r8), %ecx	# 12663	[c=14 l=9]  *zero_extendqisi2/0
+	call	log_append@PLT	# 12670	[c=0 l=5]  *call
+	cmpl	$15, %r14d	# 12673	[c=4 l=4]  *cmpsi_1/0
+	movq	8(%rsp), %r8	# 18095	[c=9 l=5]  *movdi_internal/3
+	jle	.L1577	# 12674	[c=13 l=6]  *jcc
+	cmpl	$63, %r15d	# 15653	[c=4 l=4]  *cmpsi_1/0
+	movl	%r15d, %edx	# 12695	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 12697	[c=4 l=3]  *movdi_internal/3
+	movzbl	1004(%r13,%r8), %ecx	# 12687	[c=14 l=9]  *zero_extendqisi2/0
+	leaq	.LC29(%rip), %rax	# 16659	[c=1 l=7]  *movdi_internal/4
+	leaq	.LC28(%rip), %rsi	# 16658	[c=1 l=7]  *movdi_internal/4
+	cmovne	%rax, %rsi	# 15654	[c=8 l=4]  *movdicc_noc/1
+	movl	%ecx, 8(%rsp)	# 18096	[c=4 l=4]  *movsi_internal/1
+	movl	%ecx, %r14d	# 18612	[c=4 l=3]  *movsi_internal/0
+	call	log_add_data_mov@PLT	# 12698	[c=0 l=5]  *call
+	movl	%r15d, %eax	# 17551	[c=4 l=3]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 12699	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 12700	[c=13 l=7]  *cmpsi_1/1
+	jb	.L1025	# 12701	[c=13 l=2]  *jcc
+	movl	%r15d, %eax	# 17553	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %eax	# 12703	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 16511	[c=5 l=5]  *andsi_1_zext
+	cmpb	$0, 1080(%r13,%rax)	# 12706	[c=14 l=9]  *cmpqi_ccno_1/1
+	jne	.L1026	# 12707	[c=13 l=6]  *jcc
+.L1025:
+	movq	1040(%r13), %rdx	# 12711	[c=9 l=7]  *movdi_internal/3
+	movslq	%r15d, %rax	# 12710	[c=4 l=3]  *extendsidi2_rex64/1
+	movb	%r14b, (%rdx,%rax)	# 12712	[c=4 l=4]  *movqi_internal/8
+.L1027:
+	movl	$26, %edx	# 12725	[c=4 l=5]  *movsi_internal/0
+	xorl	%eax, %eax	# 19229	[c=4 l=2]  *movdi_xor
+	movzwl	%r15w, %ecx	# 12723	[c=4 l=4]  *zero_extendhisi2/0
+	movq	%r13, %rdi	# 12728	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC48(%rip), %rsi	# 12726	[c=1 l=7]  *movdi_internal/4
+	call	log_append@PLT	# 12730	[c=0 l=5]  *call
+	movw	%r15w, 1030(%r13)	# 12731	[c=4 l=8]  *movhi_internal/3
+	movq	%r13, %rdi	# 12733	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 12732	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 12734	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 17555	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 17556	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 12736	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18210	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 12737	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 12739	[c=4 l=3]  *cmpdi_1/0
+	jb	.L283	# 12740	[c=13 l=6]  *jcc
+	movl	0(%r13), %ebx	# 12742	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 12747	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 12743	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 12745	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 12746	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 12748	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 12749	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 12750	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 12753	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 17557	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 12754	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 12757	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 12758	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 19228	[c=10 l=4]  *indirect_jump
+.L1028:
+	movzbl	10(%rbx), %r14d	# 12766	[c=13 l=5]  *zero_extendqisi2/0
+	xorl	%eax, %eax	# 19226	[c=4 l=2]  *movdi_xor
+	movl	$26, %edx	# 12770	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 12773	[c=4 l=3]  *movdi_internal/3
+	movzwl	1030(%r13), %r8d	# 12767	[c=13 l=8]  zero_extendhidi2/0
+	leaq	.LC44(%rip), %rsi	# 12771	[c=1 l=7]  *movdi_internal/4
+	movl	%r8d, %ecx	# 12769	[c=4 l=3]  *movsi_internal/0
+	movl	%r8d, 16(%rsp)	# 18099	[c=4 l=5]  *movsi_internal/1
+	movq	%r8, %r15	# 18613	[c=4 l=3]  *movdi_internal/3
+	call	log_append@PLT	# 12775	[c=0 l=5]  *call
+	movslq	%r14d, %r9	# 12776	[c=4 l=3]  *extendsidi2_rex64/1
+	xorl	%eax, %eax	# 19227	[c=4 l=2]  *movdi_xor
+	movl	%r14d, %edx	# 12779	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC43(%rip), %rsi	# 12780	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 12782	[c=4 l=3]  *movdi_internal/3
+	movq	%r9, 8(%rsp)	# 18097	[c=4 l=5]  *movdi_internal/5
+	movzbl	1004(%r13,%r9), %ecx	# 12777	[c=14 l=9]  *zero_extendqisi2/0
+	call	log_append@PLT	# 12784	[c=0 l=5]  *call
+	cmpl	$15, %r14d	# 12787	[c=4 l=4]  *cmpsi_1/0
+	movq	8(%rsp), %r9	# 18098	[c=9 l=5]  *movdi_internal/3
+	movl	16(%rsp), %r8d	# 18100	[c=9 l=5]  *movsi_internal/0
+	jle	.L1578	# 12788	[c=13 l=6]  *jcc
+	cmpl	$63, %r8d	# 15665	[c=4 l=4]  *cmpsi_1/0
+	leaq	.LC29(%rip), %rdx	# 16661	[c=1 l=7]  *movdi_internal/4
+	leaq	.LC28(%rip), %rsi	# 16660	[c=1 l=7]  *movdi_internal/4
+	movzbl	1004(%r13,%r9), %ecx	# 12801	[c=14 l=9]  *zero_extendqisi2/0
+	cmovne	%rdx, %rsi	# 15666	[c=8 l=4]  *movdicc_noc/1
+	movq	%r13, %rdi	# 12811	[c=4 l=3]  *movdi_internal/3
+	movl	%r8d, %edx	# 12809	[c=4 l=3]  *movsi_internal/0
+	movl	%r8d, 8(%rsp)	# 18101	[c=4 l=5]  *movsi_internal/1
+	movl	%ecx, 16(%rsp)	# 18103	[c=4 l=4]  *movsi_internal/1
+	movl	%ecx, %r14d	# 18614	[c=4 l=3]  *movsi_internal/0
+	call	log_add_data_mov@PLT	# 12812	[c=0 l=5]  *call
+	movl	8(%rsp), %r8d	# 18102	[c=9 l=5]  *movsi_internal/0
+	movl	%r8d, %edx	# 17560	[c=4 l=3]  *movsi_internal/0
+	subl	5176(%r13), %edx	# 12814	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %edx	# 12815	[c=13 l=7]  *cmpsi_1/1
+	jb	.L1031	# 12816	[c=13 l=2]  *jcc
+	movl	%r8d, %edx	# 17562	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %edx	# 12818	[c=4 l=3]  *ashrsi3_1/0
+	movslq	%edx, %rdx	# 12819	[c=4 l=3]  *extendsidi2_rex64/1
+	cmpb	$0, 1080(%r13,%rdx)	# 12820	[c=14 l=9]  *cmpqi_ccno_1/1
+	jne	.L1032	# 12821	[c=13 l=6]  *jcc
+.L1031:
+	movq	1040(%r13), %rdx	# 12825	[c=9 l=7]  *movdi_internal/3
+	movb	%r14b, (%rdx,%r15)	# 12826	[c=4 l=4]  *movqi_internal/8
+.L1033:
+	subq	$1, 48(%r13)	# 12837	[c=13 l=5]  *adddi_1/0
+	leal	1(%r8), %r14d	# 18208	[c=4 l=4]  *leasi
+	movl	$26, %edx	# 12841	[c=4 l=5]  *movsi_internal/0
+	xorl	%eax, %eax	# 19224	[c=4 l=2]  *movdi_xor
+	movzwl	%r14w, %ecx	# 12839	[c=4 l=4]  *zero_extendhisi2/0
+	leaq	.LC48(%rip), %rsi	# 12842	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 12844	[c=4 l=3]  *movdi_internal/3
+	call	log_append@PLT	# 12846	[c=0 l=5]  *call
+	movw	%r14w, 1030(%r13)	# 12847	[c=4 l=8]  *movhi_internal/3
+	movq	%r13, %rdi	# 12849	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 12848	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 12850	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 17564	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 17565	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 12852	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18209	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 12853	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 12855	[c=4 l=3]  *cmpdi_1/0
+	jb	.L283	# 12856	[c=13 l=6]  *jcc
+	movl	0(%r13), %ebx	# 12858	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 12863	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 12859	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 12861	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 12862	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 12864	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 12865	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 12866	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 12869	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 17566	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 12870	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 12873	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 12874	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 19223	[c=10 l=4]  *indirect_jump
+.L1034:
+	movzbl	10(%rbx), %r14d	# 12882	[c=13 l=5]  *zero_extendqisi2/0
+	xorl	%eax, %eax	# 19221	[c=4 l=2]  *movdi_xor
+	movl	$28, %edx	# 12885	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 12888	[c=4 l=3]  *movdi_internal/3
+	movzwl	1032(%r13), %r15d	# 12883	[c=13 l=8]  *zero_extendhisi2/0
+	leaq	.LC44(%rip), %rsi	# 12886	[c=1 l=7]  *movdi_internal/4
+	movl	%r15d, %ecx	# 12884	[c=4 l=3]  *movsi_internal/0
+	subl	$1, %r15d	# 12891	[c=4 l=4]  *addsi_1/0
+	call	log_append@PLT	# 12890	[c=0 l=5]  *call
+	movslq	%r14d, %r8	# 12892	[c=4 l=3]  *extendsidi2_rex64/1
+	xorl	%eax, %eax	# 19222	[c=4 l=2]  *movdi_xor
+	movl	%r14d, %edx	# 12895	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC43(%rip), %rsi	# 12896	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 12898	[c=4 l=3]  *movdi_internal/3
+	movq	%r8, 8(%rsp)	# 18106	[c=4 l=5]  *movdi_internal/5
+	movzbl	1004(%r13,%r8), %ecx	# 12893	[c=14 l=9]  *zero_extendqisi2/0
+	call	log_append@PLT	# 12900	[c=0 l=5]  *call
+	cmpl	$15, %r14d	# 12903	[c=4 l=4]  *cmpsi_1/0
+	movq	8(%rsp), %r8	# 18107	[c=9 l=5]  *movdi_internal/3
+	jle	.L1579	# 12904	[c=13 l=6]  *jcc
+	cmpl	$63, %r15d	# 15677	[c=4 l=4]  *cmpsi_1/0
+	movl	%r15d, %edx	# 12925	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 12927	[c=4 l=3]  *movdi_internal/3
+	movzbl	1004(%r13,%r8), %ecx	# 12917	[c=14 l=9]  *zero_extendqisi2/0
+	leaq	.LC29(%rip), %rax	# 16663	[c=1 l=7]  *movdi_internal/4
+	leaq	.LC28(%rip), %rsi	# 16662	[c=1 l=7]  *movdi_internal/4
+	cmovne	%rax, %rsi	# 15678	[c=8 l=4]  *movdicc_noc/1
+	movl	%ecx, 8(%rsp)	# 18108	[c=4 l=4]  *movsi_internal/1
+	movl	%ecx, %r14d	# 18615	[c=4 l=3]  *movsi_internal/0
+	call	log_add_data_mov@PLT	# 12928	[c=0 l=5]  *call
+	movl	%r15d, %eax	# 17569	[c=4 l=3]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 12929	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 12930	[c=13 l=7]  *cmpsi_1/1
+	jb	.L1037	# 12931	[c=13 l=2]  *jcc
+	movl	%r15d, %eax	# 17571	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %eax	# 12933	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 16510	[c=5 l=5]  *andsi_1_zext
+	cmpb	$0, 1080(%r13,%rax)	# 12936	[c=14 l=9]  *cmpqi_ccno_1/1
+	jne	.L1038	# 12937	[c=13 l=6]  *jcc
+.L1037:
+	movq	1040(%r13), %rdx	# 12941	[c=9 l=7]  *movdi_internal/3
+	movslq	%r15d, %rax	# 12940	[c=4 l=3]  *extendsidi2_rex64/1
+	movb	%r14b, (%rdx,%rax)	# 12942	[c=4 l=4]  *movqi_internal/8
+.L1039:
+	movl	$28, %edx	# 12955	[c=4 l=5]  *movsi_internal/0
+	xorl	%eax, %eax	# 19219	[c=4 l=2]  *movdi_xor
+	movzwl	%r15w, %ecx	# 12953	[c=4 l=4]  *zero_extendhisi2/0
+	movq	%r13, %rdi	# 12958	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC48(%rip), %rsi	# 12956	[c=1 l=7]  *movdi_internal/4
+	call	log_append@PLT	# 12960	[c=0 l=5]  *call
+	movw	%r15w, 1032(%r13)	# 12961	[c=4 l=8]  *movhi_internal/3
+	movq	%r13, %rdi	# 12963	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 12962	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 12964	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 17573	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 17574	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 12966	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18207	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 12967	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 12969	[c=4 l=3]  *cmpdi_1/0
+	jb	.L283	# 12970	[c=13 l=6]  *jcc
+	movl	0(%r13), %ebx	# 12972	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 12977	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 12973	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 12975	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 12976	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 12978	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 12979	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 12980	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 12983	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 17575	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 12984	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 12987	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 12988	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 19218	[c=10 l=4]  *indirect_jump
+.L1040:
+	movzbl	10(%rbx), %r14d	# 12996	[c=13 l=5]  *zero_extendqisi2/0
+	xorl	%eax, %eax	# 19216	[c=4 l=2]  *movdi_xor
+	movl	$28, %edx	# 13000	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 13003	[c=4 l=3]  *movdi_internal/3
+	movzwl	1032(%r13), %r8d	# 12997	[c=13 l=8]  zero_extendhidi2/0
+	leaq	.LC44(%rip), %rsi	# 13001	[c=1 l=7]  *movdi_internal/4
+	movl	%r8d, %ecx	# 12999	[c=4 l=3]  *movsi_internal/0
+	movl	%r8d, 16(%rsp)	# 18111	[c=4 l=5]  *movsi_internal/1
+	movq	%r8, %r15	# 18616	[c=4 l=3]  *movdi_internal/3
+	call	log_append@PLT	# 13005	[c=0 l=5]  *call
+	movslq	%r14d, %r9	# 13006	[c=4 l=3]  *extendsidi2_rex64/1
+	xorl	%eax, %eax	# 19217	[c=4 l=2]  *movdi_xor
+	movl	%r14d, %edx	# 13009	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC43(%rip), %rsi	# 13010	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 13012	[c=4 l=3]  *movdi_internal/3
+	movq	%r9, 8(%rsp)	# 18109	[c=4 l=5]  *movdi_internal/5
+	movzbl	1004(%r13,%r9), %ecx	# 13007	[c=14 l=9]  *zero_extendqisi2/0
+	call	log_append@PLT	# 13014	[c=0 l=5]  *call
+	cmpl	$15, %r14d	# 13017	[c=4 l=4]  *cmpsi_1/0
+	movq	8(%rsp), %r9	# 18110	[c=9 l=5]  *movdi_internal/3
+	movl	16(%rsp), %r8d	# 18112	[c=9 l=5]  *movsi_internal/0
+	jle	.L1580	# 13018	[c=13 l=6]  *jcc
+	cmpl	$63, %r8d	# 15689	[c=4 l=4]  *cmpsi_1/0
+	leaq	.LC29(%rip), %rdx	# 16665	[c=1 l=7]  *movdi_internal/4
+	leaq	.LC28(%rip), %rsi	# 16664	[c=1 l=7]  *movdi_internal/4
+	movzbl	1004(%r13,%r9), %ecx	# 13031	[c=14 l=9]  *zero_extendqisi2/0
+	cmovne	%rdx, %rsi	# 15690	[c=8 l=4]  *movdicc_noc/1
+	movq	%r13, %rdi	# 13041	[c=4 l=3]  *movdi_internal/3
+	movl	%r8d, %edx	# 13039	[c=4 l=3]  *movsi_internal/0
+	movl	%r8d, 8(%rsp)	# 18113	[c=4 l=5]  *movsi_internal/1
+	movl	%ecx, 16(%rsp)	# 18115	[c=4 l=4]  *movsi_internal/1
+	movl	%ecx, %r14d	# 18617	[c=4 l=3]  *movsi_internal/0
+	call	log_add_data_mov@PLT	# 13042	[c=0 l=5]  *call
+	movl	8(%rsp), %r8d	# 18114	[c=9 l=5]  *movsi_internal/0
+	movl	%r8d, %edx	# 17578	[c=4 l=3]  *movsi_internal/0
+	subl	5176(%r13), %edx	# 13044	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %edx	# 13045	[c=13 l=7]  *cmpsi_1/1
+	jb	.L1043	# 13046	[c=13 l=2]  *jcc
+	movl	%r8d, %edx	# 17580	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %edx	# 13048	[c=4 l=3]  *ashrsi3_1/0
+	movslq	%edx, %rdx	# 13049	[c=4 l=3]  *extendsidi2_rex64/1
+	cmpb	$0, 1080(%r13,%rdx)	# 13050	[c=14 l=9]  *cmpqi_ccno_1/1
+	jne	.L1044	# 13051	[c=13 l=6]  *jcc
+.L1043:
+	movq	1040(%r13), %rdx	# 13055	[c=9 l=7]  *movdi_internal/3
+	movb	%r14b, (%rdx,%r15)	# 13056	[c=4 l=4]  *movqi_internal/8
+.L1045:
+	subq	$1, 48(%r13)	# 13067	[c=13 l=5]  *adddi_1/0
+	leal	1(%r8), %r14d	# 18205	[c=4 l=4]  *leasi
+	movl	$28, %edx	# 13071	[c=4 l=5]  *movsi_internal/0
+	xorl	%eax, %eax	# 19214	[c=4 l=2]  *movdi_xor
+	movzwl	%r14w, %ecx	# 13069	[c=4 l=4]  *zero_extendhisi2/0
+	leaq	.LC48(%rip), %rsi	# 13072	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 13074	[c=4 l=3]  *movdi_internal/3
+	call	log_append@PLT	# 13076	[c=0 l=5]  *call
+	movw	%r14w, 1032(%r13)	# 13077	[c=4 l=8]  *movhi_internal/3
+	movq	%r13, %rdi	# 13079	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 13078	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 13080	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 17582	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 17583	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 13082	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18206	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 13083	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 13085	[c=4 l=3]  *cmpdi_1/0
+	jb	.L283	# 13086	[c=13 l=6]  *jcc
+	movl	0(%r13), %ebx	# 13088	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 13093	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 13089	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 13091	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 13092	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 13094	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 13095	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 13096	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 13099	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 17584	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 13100	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 13103	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 13104	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 19213	[c=10 l=4]  *indirect_jump
+.L1046:
+	movzbl	10(%rbx), %r14d	# 13112	[c=13 l=5]  *zero_extendqisi2/0
+	xorl	%eax, %eax	# 19211	[c=4 l=2]  *movdi_xor
+	movl	$30, %edx	# 13115	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 13118	[c=4 l=3]  *movdi_internal/3
+	movzwl	1034(%r13), %r15d	# 13113	[c=13 l=8]  *zero_extendhisi2/0
+	leaq	.LC44(%rip), %rsi	# 13116	[c=1 l=7]  *movdi_internal/4
+	movl	%r15d, %ecx	# 13114	[c=4 l=3]  *movsi_internal/0
+	subl	$1, %r15d	# 13121	[c=4 l=4]  *addsi_1/0
+	call	log_append@PLT	# 13120	[c=0 l=5]  *call
+	movslq	%r14d, %r8	# 13122	[c=4 l=3]  *extendsidi2_rex64/1
+	xorl	%eax, %eax	# 19212	[c=4 l=2]  *movdi_xor
+	movl	%r14d, %edx	# 13125	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC43(%rip), %rsi	# 13126	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 13128	[c=4 l=3]  *movdi_internal/3
+	movq	%r8, 8(%rsp)	# 18118	[c=4 l=5]  *movdi_internal/5
+	movzbl	1004(%r13,%r8), %ecx	# 13123	[c=14 l=9]  *zero_extendqisi2/0
+	call	log_append@PLT	# 13130	[c=0 l=5]  *call
+	cmpl	$15, %r14d	# 13133	[c=4 l=4]  *cmpsi_1/0
+	movq	8(%rsp), %r8	# 18119	[c=9 l=5]  *movdi_internal/3
+	jle	.L1581	# 13134	[c=13 l=6]  *jcc
+	cmpl	$63, %r15d	# 15701	[c=4 l=4]  *cmpsi_1/0
+	movl	%r15d, %edx	# 13155	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 13157	[c=4 l=3]  *movdi_internal/3
+	movzbl	1004(%r13,%r8), %ecx	# 13147	[c=14 l=9]  *zero_extendqisi2/0
+	leaq	.LC29(%rip), %rax	# 16667	[c=1 l=7]  *movdi_internal/4
+	leaq	.LC28(%rip), %rsi	# 16666	[c=1 l=7]  *movdi_internal/4
+	cmovne	%rax, %rsi	# 15702	[c=8 l=4]  *movdicc_noc/1
+	movl	%ecx, 8(%rsp)	# 18120	[c=4 l=4]  *movsi_internal/1
+	movl	%ecx, %r14d	# 18618	[c=4 l=3]  *movsi_internal/0
+	call	log_add_data_mov@PLT	# 13158	[c=0 l=5]  *call
+	movl	%r15d, %eax	# 17587	[c=4 l=3]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 13159	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 13160	[c=13 l=7]  *cmpsi_1/1
+	jb	.L1049	# 13161	[c=13 l=2]  *jcc
+	movl	%r15d, %eax	# 17589	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %eax	# 13163	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 16509	[c=5 l=5]  *andsi_1_zext
+	cmpb	$0, 1080(%r13,%rax)	# 13166	[c=14 l=9]  *cmpqi_ccno_1/1
+	jne	.L1050	# 13167	[c=13 l=6]  *jcc
+.L1049:
+	movq	1040(%r13), %rdx	# 13171	[c=9 l=7]  *movdi_internal/3
+	movslq	%r15d, %rax	# 13170	[c=4 l=3]  *extendsidi2_rex64/1
+	movb	%r14b, (%rdx,%rax)	# 13172	[c=4 l=4]  *movqi_internal/8
+.L1051:
+	movl	$30, %edx	# 13185	[c=4 l=5]  *movsi_internal/0
+	xorl	%eax, %eax	# 19209	[c=4 l=2]  *movdi_xor
+	movzwl	%r15w, %ecx	# 13183	[c=4 l=4]  *zero_extendhisi2/0
+	movq	%r13, %rdi	# 13188	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC48(%rip), %rsi	# 13186	[c=1 l=7]  *movdi_internal/4
+	call	log_append@PLT	# 13190	[c=0 l=5]  *call
+	movw	%r15w, 1034(%r13)	# 13191	[c=4 l=8]  *movhi_internal/3
+	movq	%r13, %rdi	# 13193	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 13192	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 13194	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 17591	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 17592	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 13196	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18204	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 13197	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 13199	[c=4 l=3]  *cmpdi_1/0
+	jb	.L283	# 13200	[c=13 l=6]  *jcc
+	movl	0(%r13), %ebx	# 13202	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 13207	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 13203	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 13205	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 13206	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 13208	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 13209	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 13210	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 13213	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 17593	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 13214	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 13217	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 13218	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 19208	[c=10 l=4]  *indirect_jump
+.L1052:
+	movzbl	10(%rbx), %r14d	# 13226	[c=13 l=5]  *zero_extendqisi2/0
+	xorl	%eax, %eax	# 19206	[c=4 l=2]  *movdi_xor
+	movl	$30, %edx	# 13230	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 13233	[c=4 l=3]  *movdi_internal/3
+	movzwl	1034(%r13), %r8d	# 13227	[c=13 l=8]  zero_extendhidi2/0
+	leaq	.LC44(%rip), %rsi	# 13231	[c=1 l=7]  *movdi_internal/4
+	movl	%r8d, %ecx	# 13229	[c=4 l=3]  *movsi_internal/0
+	movl	%r8d, 16(%rsp)	# 18123	[c=4 l=5]  *movsi_internal/1
+	movq	%r8, %r15	# 18619	[c=4 l=3]  *movdi_internal/3
+	call	log_append@PLT	# 13235	[c=0 l=5]  *call
+	movslq	%r14d, %r9	# 13236	[c=4 l=3]  *extendsidi2_rex64/1
+	xorl	%eax, %eax	# 19207	[c=4 l=2]  *movdi_xor
+	movl	%r14d, %edx	# 13239	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC43(%rip), %rsi	# 13240	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 13242	[c=4 l=3]  *movdi_internal/3
+	movq	%r9, 8(%rsp)	# 18121	[c=4 l=5]  *movdi_internal/5
+	movzbl	1004(%r13,%r9), %ecx	# 13237	[c=14 l=9]  *zero_extendqisi2/0
+	call	log_append@PLT	# 13244	[c=0 l=5]  *call
+	cmpl	$15, %r14d	# 13247	[c=4 l=4]  *cmpsi_1/0
+	movq	8(%rsp), %r9	# 18122	[c=9 l=5]  *movdi_internal/3
+	movl	16(%rsp), %r8d	# 18124	[c=9 l=5]  *movsi_internal/0
+	jle	.L1582	# 13248	[c=13 l=6]  *jcc
+	cmpl	$63, %r8d	# 15713	[c=4 l=4]  *cmpsi_1/0
+	leaq	.LC29(%rip), %rdx	# 16669	[c=1 l=7]  *movdi_internal/4
+	leaq	.LC28(%rip), %rsi	# 16668	[c=1 l=7]  *movdi_internal/4
+	movzbl	1004(%r13,%r9), %ecx	# 13261	[c=14 l=9]  *zero_extendqisi2/0
+	cmovne	%rdx, %rsi	# 15714	[c=8 l=4]  *movdicc_noc/1
+	movq	%r13, %rdi	# 13271	[c=4 l=3]  *movdi_internal/3
+	movl	%r8d, %edx	# 13269	[c=4 l=3]  *movsi_internal/0
+	movl	%r8d, 8(%rsp)	# 18125	[c=4 l=5]  *movsi_internal/1
+	movl	%ecx, 16(%rsp)	# 18127	[c=4 l=4]  *movsi_internal/1
+	movl	%ecx, %r14d	# 18620	[c=4 l=3]  *movsi_internal/0
+	call	log_add_data_mov@PLT	# 13272	[c=0 l=5]  *call
+	movl	8(%rsp), %r8d	# 18126	[c=9 l=5]  *movsi_internal/0
+	movl	%r8d, %edx	# 17596	[c=4 l=3]  *movsi_internal/0
+	subl	5176(%r13), %edx	# 13274	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %edx	# 13275	[c=13 l=7]  *cmpsi_1/1
+	jb	.L1055	# 13276	[c=13 l=2]  *jcc
+	movl	%r8d, %edx	# 17598	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %edx	# 13278	[c=4 l=3]  *ashrsi3_1/0
+	movslq	%edx, %rdx	# 13279	[c=4 l=3]  *extendsidi2_rex64/1
+	cmpb	$0, 1080(%r13,%rdx)	# 13280	[c=14 l=9]  *cmpqi_ccno_1/1
+	jne	.L1056	# 13281	[c=13 l=6]  *jcc
+.L1055:
+	movq	1040(%r13), %rdx	# 13285	[c=9 l=7]  *movdi_internal/3
+	movb	%r14b, (%rdx,%r15)	# 13286	[c=4 l=4]  *movqi_internal/8
+.L1057:
+	subq	$1, 48(%r13)	# 13297	[c=13 l=5]  *adddi_1/0
+	leal	1(%r8), %r14d	# 18202	[c=4 l=4]  *leasi
+	movl	$30, %edx	# 13301	[c=4 l=5]  *movsi_internal/0
+	xorl	%eax, %eax	# 19204	[c=4 l=2]  *movdi_xor
+	movzwl	%r14w, %ecx	# 13299	[c=4 l=4]  *zero_extendhisi2/0
+	leaq	.LC48(%rip), %rsi	# 13302	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 13304	[c=4 l=3]  *movdi_internal/3
+	call	log_append@PLT	# 13306	[c=0 l=5]  *call
+	movw	%r14w, 1034(%r13)	# 13307	[c=4 l=8]  *movhi_internal/3
+	movq	%r13, %rdi	# 13309	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 13308	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 13310	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 17600	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 17601	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 13312	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18203	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 13313	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 13315	[c=4 l=3]  *cmpdi_1/0
+	jb	.L283	# 13316	[c=13 l=6]  *jcc
+	movl	0(%r13), %ebx	# 13318	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 13323	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 13319	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 13321	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 13322	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 13324	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 13325	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 13326	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 13329	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 17602	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 13330	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 13333	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 13334	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 19203	[c=10 l=4]  *indirect_jump
+.L1058:
+	movzbl	10(%rbx), %r15d	# 13343	[c=13 l=5]  zero_extendqidi2/0
+	xorl	%eax, %eax	# 19202	[c=4 l=2]  *movdi_xor
+	movq	%r13, %rdi	# 13350	[c=4 l=3]  *movdi_internal/3
+	movzwl	12(%rbx), %r14d	# 13342	[c=13 l=5]  *zero_extendhisi2/0
+	leaq	.LC43(%rip), %rsi	# 13348	[c=1 l=7]  *movdi_internal/4
+	movzbl	1004(%r13,%r15), %ecx	# 13345	[c=14 l=9]  *zero_extendqisi2/0
+	movl	%r15d, %edx	# 13347	[c=4 l=3]  *movsi_internal/0
+	movl	%r15d, 8(%rsp)	# 18132	[c=4 l=5]  *movsi_internal/1
+	call	log_append@PLT	# 13352	[c=0 l=5]  *call
+	movl	8(%rsp), %r11d	# 18133	[c=9 l=5]  *movsi_internal/0
+	leaq	.LC43(%rip), %rsi	# 18131	[c=1 l=7]  *movdi_internal/4
+	cmpl	$15, %r11d	# 13355	[c=4 l=4]  *cmpsi_1/0
+	jle	.L1583	# 13356	[c=13 l=6]  *jcc
+	movslq	%r14d, %r8	# 13371	[c=4 l=3]  *extendsidi2_rex64/1
+	movl	%r14d, %edx	# 13374	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 13377	[c=4 l=3]  *movdi_internal/3
+	movl	%r11d, 32(%rsp)	# 18137	[c=4 l=5]  *movsi_internal/1
+	movzbl	1004(%r13,%r15), %eax	# 13369	[c=14 l=9]  *zero_extendqisi2/0
+	movq	%r8, 24(%rsp)	# 18134	[c=4 l=5]  *movdi_internal/5
+	movzbl	1004(%r13,%r8), %ecx	# 13372	[c=14 l=9]  *zero_extendqisi2/0
+	movb	%al, 8(%rsp)	# 18136	[c=4 l=4]  *movqi_internal/8
+	movl	%eax, 16(%rsp)	# 17605	[c=4 l=4]  *movsi_internal/1
+	xorl	%eax, %eax	# 19200	[c=4 l=2]  *movdi_xor
+	call	log_append@PLT	# 13379	[c=0 l=5]  *call
+	cmpl	$15, %r14d	# 13382	[c=4 l=4]  *cmpsi_1/0
+	movq	24(%rsp), %r8	# 18135	[c=9 l=5]  *movdi_internal/3
+	movl	32(%rsp), %r11d	# 18138	[c=9 l=5]  *movsi_internal/0
+	jle	.L1584	# 13383	[c=13 l=6]  *jcc
+	movzbl	1004(%r13,%r8), %eax	# 13396	[c=14 l=9]  *zero_extendqisi2/0
+	movl	16(%rsp), %r8d	# 17607	[c=9 l=5]  *movsi_internal/0
+	movl	%r11d, %edx	# 13402	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 13405	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC61(%rip), %rsi	# 13403	[c=1 l=7]  *movdi_internal/4
+	subl	%eax, %r8d	# 13398	[c=4 l=3]  *subsi_1/0
+	movl	%eax, %r14d	# 18622	[c=4 l=3]  *movsi_internal/0
+	movzbl	8(%rsp), %eax	# 17609	[c=9 l=5]  *movqi_internal/4
+	movzbl	%r8b, %ecx	# 13400	[c=4 l=4]  *zero_extendqisi2/0
+	movl	%r8d, 24(%rsp)	# 18139	[c=4 l=5]  *movsi_internal/1
+	subl	%r14d, %eax	# 18201	[c=4 l=3]  *subsi_1/0
+	movb	%al, 16(%rsp)	# 17610	[c=4 l=4]  *movqi_internal/8
+	xorl	%eax, %eax	# 19198	[c=4 l=2]  *movdi_xor
+	call	log_append@PLT	# 13407	[c=0 l=5]  *call
+	movl	8(%rsp), %edx	# 17612	[c=9 l=4]  *movsi_internal/0
+	movl	%r14d, %eax	# 17614	[c=4 l=3]  *movsi_internal/0
+	movl	24(%rsp), %r8d	# 18140	[c=9 l=5]  *movsi_internal/0
+	andl	$136, %eax	# 13414	[c=4 l=5]  *andsi_1/0
+	movzbl	16(%rsp), %edi	# 17611	[c=9 l=5]  *movqi_internal/4
+	andl	$136, %edx	# 13411	[c=4 l=6]  *andsi_1/0
+	andl	$511, %r8d	# 13418	[c=4 l=7]  *andsi_1/0
+	leal	(%rax,%rdx,2), %r14d	# 13415	[c=8 l=4]  *leasi
+	movb	%dil, 1004(%r13,%r15)	# 13409	[c=4 l=8]  *movqi_internal/8
+	movl	$63, %eax	# 13420	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 13421	[c=13 l=7]  *subsi_1/1
+	imull	$260, %r14d, %r14d	# 13416	[c=12 l=7]  *mulsi3_1/1
+	andl	$7680, %r14d	# 13417	[c=4 l=7]  *andsi_1/0
+	orl	%r8d, %r14d	# 13419	[c=5 l=3]  *iorsi_1_zext
+	cmpl	5180(%r13), %eax	# 13422	[c=13 l=7]  *cmpsi_1/1
+	jb	.L1061	# 13423	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%r13)	# 13425	[c=13 l=8]  *cmpqi_ccno_1/1
+	jne	.L1062	# 13426	[c=13 l=6]  *jcc
+.L1061:
+	movq	1040(%r13), %rax	# 13429	[c=9 l=7]  *movdi_internal/3
+	movzbl	63(%rax), %r15d	# 13430	[c=13 l=5]  *zero_extendqisi2/0
+.L1063:
+	movl	%r15d, %ecx	# 13441	[c=4 l=3]  *movsi_internal/0
+	movl	$63, %edx	# 13442	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 13445	[c=4 l=3]  *movdi_internal/3
+	andl	$-64, %r15d	# 13447	[c=4 l=4]  *andsi_1/0
+	leaq	.LC32(%rip), %rsi	# 13443	[c=1 l=7]  *movdi_internal/4
+	call	log_add_data_mov@PLT	# 13446	[c=0 l=5]  *call
+	leaq	flag_update_table_sub8(%rip), %rax	# 16559	[c=1 l=7]  *movdi_internal/4
+	movl	$63, %edx	# 13454	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 13457	[c=4 l=3]  *movdi_internal/3
+	movzbl	(%rax,%r14), %eax	# 13450	[c=13 l=5]  *zero_extendqisi2/0
+	leaq	.LC28(%rip), %rsi	# 13455	[c=1 l=7]  *movdi_internal/4
+	orl	%eax, %r15d	# 13451	[c=4 l=3]  *iorsi_1/0
+	movzbl	%r15b, %ecx	# 13452	[c=4 l=4]  *zero_extendqisi2/0
+	call	log_add_data_mov@PLT	# 13458	[c=0 l=5]  *call
+	movl	$63, %eax	# 13459	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 13460	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 13461	[c=13 l=7]  *cmpsi_1/1
+	jb	.L1064	# 13462	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%r13)	# 13464	[c=13 l=8]  *cmpqi_ccno_1/1
+	jne	.L1065	# 13465	[c=13 l=6]  *jcc
+.L1064:
+	movq	1040(%r13), %rax	# 13468	[c=9 l=7]  *movdi_internal/3
+	movb	%r15b, 63(%rax)	# 13469	[c=4 l=4]  *movqi_internal/8
+.L1066:
+	movq	%r13, %rdi	# 13481	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 13480	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 13482	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 17616	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 17617	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 13484	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18200	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 13485	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 13487	[c=4 l=3]  *cmpdi_1/0
+	jb	.L283	# 13488	[c=13 l=6]  *jcc
+	movl	0(%r13), %ebx	# 13490	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 13495	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 13491	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 13493	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 13494	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 13496	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 13497	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 13498	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 13501	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 17618	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 13502	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 13505	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 13506	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 19197	[c=10 l=4]  *indirect_jump
+.L1067:
+	movzwl	12(%rbx), %r11d	# 13514	[c=13 l=5]  *zero_extendhisi2/0
+	movzbl	10(%rbx), %r15d	# 13516	[c=13 l=5]  *zero_extendqisi2/0
+	xorl	%eax, %eax	# 19195	[c=4 l=2]  *movdi_xor
+	movq	%r13, %rdi	# 13520	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC62(%rip), %rsi	# 13518	[c=1 l=7]  *movdi_internal/4
+	movl	%r11d, %edx	# 13517	[c=4 l=3]  *movsi_internal/0
+	movw	%r11w, 8(%rsp)	# 18147	[c=4 l=6]  *movhi_internal/3
+	movl	%r11d, 24(%rsp)	# 18145	[c=4 l=5]  *movsi_internal/1
+	call	log_append@PLT	# 13522	[c=0 l=5]  *call
+	movslq	%r15d, %r9	# 13523	[c=4 l=3]  *extendsidi2_rex64/1
+	xorl	%eax, %eax	# 19196	[c=4 l=2]  *movdi_xor
+	movl	%r15d, %edx	# 13526	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC43(%rip), %rsi	# 13527	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 13529	[c=4 l=3]  *movdi_internal/3
+	movq	%r9, 16(%rsp)	# 18143	[c=4 l=5]  *movdi_internal/5
+	movzbl	1004(%r13,%r9), %ecx	# 13524	[c=14 l=9]  *zero_extendqisi2/0
+	call	log_append@PLT	# 13531	[c=0 l=5]  *call
+	cmpl	$15, %r15d	# 13534	[c=4 l=4]  *cmpsi_1/0
+	movq	16(%rsp), %r9	# 18144	[c=9 l=5]  *movdi_internal/3
+	movl	24(%rsp), %r11d	# 18146	[c=9 l=5]  *movsi_internal/0
+	jle	.L1585	# 13535	[c=13 l=6]  *jcc
+	movl	%r15d, %edx	# 13553	[c=4 l=3]  *movsi_internal/0
+	xorl	%eax, %eax	# 19193	[c=4 l=2]  *movdi_xor
+	leaq	.LC61(%rip), %rsi	# 13554	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 13556	[c=4 l=3]  *movdi_internal/3
+	movzbl	1004(%r13,%r9), %r14d	# 13548	[c=14 l=9]  *zero_extendqisi2/0
+	movq	%r9, 24(%rsp)	# 18150	[c=4 l=5]  *movdi_internal/5
+	movb	%r14b, 16(%rsp)	# 18148	[c=4 l=5]  *movqi_internal/8
+	subl	%r11d, %r14d	# 13550	[c=4 l=3]  *subsi_1/0
+	movzbl	%r14b, %ecx	# 13551	[c=4 l=4]  *zero_extendqisi2/0
+	call	log_append@PLT	# 13558	[c=0 l=5]  *call
+	movzbl	16(%rsp), %r8d	# 18149	[c=9 l=6]  *movqi_internal/4
+	movl	8(%rsp), %eax	# 17622	[c=9 l=4]  *movsi_internal/0
+	movq	24(%rsp), %r9	# 18151	[c=9 l=5]  *movdi_internal/3
+	andl	$136, %eax	# 13565	[c=4 l=5]  *andsi_1/0
+	andl	$136, %r8d	# 13562	[c=4 l=7]  *andsi_1/0
+	leal	(%rax,%r8,2), %edx	# 13566	[c=8 l=4]  *leasi
+	movl	%r14d, %eax	# 17624	[c=4 l=3]  *movsi_internal/0
+	movb	%r14b, 1004(%r13,%r9)	# 13560	[c=4 l=8]  *movqi_internal/8
+	imull	$260, %edx, %edx	# 13567	[c=12 l=6]  *mulsi3_1/1
+	andl	$511, %eax	# 13569	[c=4 l=5]  *andsi_1/0
+	andl	$7680, %edx	# 13568	[c=4 l=6]  *andsi_1/0
+	orl	%eax, %edx	# 13570	[c=4 l=2]  *iorsi_1/0
+	movl	$63, %eax	# 13571	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 13572	[c=13 l=7]  *subsi_1/1
+	movl	%edx, %r14d	# 17627	[c=1 l=3]  *zero_extendsidi2/3
+	cmpl	5180(%r13), %eax	# 13573	[c=13 l=7]  *cmpsi_1/1
+	jb	.L1069	# 13574	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%r13)	# 13576	[c=13 l=8]  *cmpqi_ccno_1/1
+	jne	.L1070	# 13577	[c=13 l=6]  *jcc
+.L1069:
+	movq	1040(%r13), %rax	# 13580	[c=9 l=7]  *movdi_internal/3
+	movzbl	63(%rax), %r15d	# 13581	[c=13 l=5]  *zero_extendqisi2/0
+.L1071:
+	movl	%r15d, %ecx	# 13592	[c=4 l=3]  *movsi_internal/0
+	movl	$63, %edx	# 13593	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 13596	[c=4 l=3]  *movdi_internal/3
+	andl	$-64, %r15d	# 13598	[c=4 l=4]  *andsi_1/0
+	leaq	.LC32(%rip), %rsi	# 13594	[c=1 l=7]  *movdi_internal/4
+	call	log_add_data_mov@PLT	# 13597	[c=0 l=5]  *call
+	leaq	flag_update_table_sub8(%rip), %rax	# 16560	[c=1 l=7]  *movdi_internal/4
+	movl	$63, %edx	# 13605	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 13608	[c=4 l=3]  *movdi_internal/3
+	movzbl	(%rax,%r14), %eax	# 13601	[c=13 l=5]  *zero_extendqisi2/0
+	leaq	.LC28(%rip), %rsi	# 13606	[c=1 l=7]  *movdi_internal/4
+	orl	%eax, %r15d	# 13602	[c=4 l=3]  *iorsi_1/0
+	movzbl	%r15b, %ecx	# 13603	[c=4 l=4]  *zero_extendqisi2/0
+	call	log_add_data_mov@PLT	# 13609	[c=0 l=5]  *call
+	movl	$63, %eax	# 13610	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 13611	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 13612	[c=13 l=7]  *cmpsi_1/1
+	jb	.L1072	# 13613	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%r13)	# 13615	[c=13 l=8]  *cmpqi_ccno_1/1
+	jne	.L1073	# 13616	[c=13 l=6]  *jcc
+.L1072:
+	movq	1040(%r13), %rax	# 13619	[c=9 l=7]  *movdi_internal/3
+	movb	%r15b, 63(%rax)	# 13620	[c=4 l=4]  *movqi_internal/8
+.L1074:
+	movq	%r13, %rdi	# 13632	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 13631	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 13633	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 17628	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 17629	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 13635	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18199	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 13636	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 13638	[c=4 l=3]  *cmpdi_1/0
+	jb	.L283	# 13639	[c=13 l=6]  *jcc
+	movl	0(%r13), %ebx	# 13641	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 13646	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 13642	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 13644	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 13645	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 13647	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 13648	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 13649	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 13652	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 17630	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 13653	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 13656	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 13657	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 19192	[c=10 l=4]  *indirect_jump
+.L1075:
+	movzbl	10(%rbx), %r15d	# 13665	[c=13 l=5]  zero_extendqidi2/0
+	xorl	%eax, %eax	# 19191	[c=4 l=2]  *movdi_xor
+	leaq	.LC43(%rip), %rsi	# 13670	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 13672	[c=4 l=3]  *movdi_internal/3
+	movzbl	1004(%r13,%r15), %ecx	# 13667	[c=14 l=9]  *zero_extendqisi2/0
+	movl	%r15d, %edx	# 13669	[c=4 l=3]  *movsi_internal/0
+	call	log_append@PLT	# 13674	[c=0 l=5]  *call
+	cmpl	$15, %r15d	# 13677	[c=4 l=4]  *cmpsi_1/0
+	jle	.L1586	# 13678	[c=13 l=6]  *jcc
+	movl	%r15d, %edx	# 13695	[c=4 l=3]  *movsi_internal/0
+	xorl	%eax, %eax	# 19189	[c=4 l=2]  *movdi_xor
+	leaq	.LC61(%rip), %rsi	# 13696	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 13698	[c=4 l=3]  *movdi_internal/3
+	movzbl	1004(%r13,%r15), %r8d	# 17632	[c=10 l=9]  *movqi_internal/4
+	rolb	$4, %r8b	# 13692	[c=4 l=4]  *rotlqi3_1
+	movzbl	%r8b, %ecx	# 13693	[c=4 l=4]  *zero_extendqisi2/0
+	movb	%r8b, 8(%rsp)	# 18152	[c=4 l=5]  *movqi_internal/8
+	call	log_append@PLT	# 13700	[c=0 l=5]  *call
+	movzbl	8(%rsp), %r8d	# 18153	[c=9 l=6]  *movqi_internal/4
+	movq	%r13, %rdi	# 13704	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 13703	[c=4 l=3]  *movdi_internal/3
+	movb	%r8b, 1004(%r13,%r15)	# 13702	[c=4 l=8]  *movqi_internal/8
+	call	log_dump_line@PLT	# 13705	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 17634	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 17635	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 13707	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18198	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 13708	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 13710	[c=4 l=3]  *cmpdi_1/0
+	jb	.L283	# 13711	[c=13 l=6]  *jcc
+	movl	0(%r13), %ebx	# 13713	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 13718	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 13714	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 13716	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 13717	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 13719	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 13720	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 13721	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 13724	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 17636	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 13725	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 13728	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 13729	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 19188	[c=10 l=4]  *indirect_jump
+.L1077:
+	movq	%r13, %rdi	# 13738	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 13737	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 13739	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 17638	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 17639	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 13741	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18197	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 13742	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 13744	[c=4 l=3]  *cmpdi_1/0
+	jb	.L283	# 13745	[c=13 l=6]  *jcc
+	movl	0(%r13), %ebx	# 13747	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 13752	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 13748	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 13750	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 13751	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 13753	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 13754	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 13755	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 13758	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 17640	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 13759	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 13762	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 13763	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 19187	[c=10 l=4]  *indirect_jump
+.L1078:
+	movzbl	10(%rbx), %r14d	# 13771	[c=13 l=5]  zero_extendqidi2/0
+	xorl	%ecx, %ecx	# 19185	[c=4 l=2]  *movdi_xor
+	xorl	%eax, %eax	# 19186	[c=4 l=2]  *movdi_xor
+	leaq	.LC61(%rip), %rsi	# 13774	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 13776	[c=4 l=3]  *movdi_internal/3
+	movl	%r14d, %edx	# 13773	[c=4 l=3]  *movsi_internal/0
+	call	log_append@PLT	# 13778	[c=0 l=5]  *call
+	cmpl	$15, %r14d	# 13781	[c=4 l=4]  *cmpsi_1/0
+	jle	.L1587	# 13782	[c=13 l=6]  *jcc
+	movb	$0, 1004(%r13,%r14)	# 13795	[c=4 l=9]  *movqi_internal/8
+	movl	$63, %eax	# 13796	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 13797	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 13798	[c=13 l=7]  *cmpsi_1/1
+	jb	.L1080	# 13799	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%r13)	# 13801	[c=13 l=8]  *cmpqi_ccno_1/1
+	jne	.L1081	# 13802	[c=13 l=6]  *jcc
+.L1080:
+	movq	1040(%r13), %rax	# 13805	[c=9 l=7]  *movdi_internal/3
+	movzbl	63(%rax), %r15d	# 13806	[c=13 l=5]  *zero_extendqisi2/0
+.L1082:
+	movl	%r15d, %ecx	# 13817	[c=4 l=3]  *movsi_internal/0
+	movl	$63, %edx	# 13818	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 13821	[c=4 l=3]  *movdi_internal/3
+	movl	%r15d, %r14d	# 17642	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC32(%rip), %rsi	# 13819	[c=1 l=7]  *movdi_internal/4
+	andl	$-31, %r14d	# 13823	[c=4 l=4]  *andsi_1/0
+	call	log_add_data_mov@PLT	# 13822	[c=0 l=5]  *call
+	movl	%r15d, %ecx	# 17644	[c=4 l=3]  *movsi_internal/0
+	movl	$63, %edx	# 13828	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 13831	[c=4 l=3]  *movdi_internal/3
+	andl	$225, %ecx	# 13825	[c=4 l=6]  *andsi_1/0
+	leaq	.LC28(%rip), %rsi	# 13829	[c=1 l=7]  *movdi_internal/4
+	orl	$2, %r14d	# 13824	[c=4 l=4]  *iorsi_1/0
+	orl	$2, %ecx	# 13826	[c=4 l=3]  *iorsi_1/0
+	call	log_add_data_mov@PLT	# 13832	[c=0 l=5]  *call
+	movl	$63, %eax	# 13833	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 13834	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 13835	[c=13 l=7]  *cmpsi_1/1
+	jb	.L1083	# 13836	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%r13)	# 13838	[c=13 l=8]  *cmpqi_ccno_1/1
+	jne	.L1084	# 13839	[c=13 l=6]  *jcc
+.L1083:
+	movq	1040(%r13), %rax	# 13842	[c=9 l=7]  *movdi_internal/3
+	movb	%r14b, 63(%rax)	# 13843	[c=4 l=4]  *movqi_internal/8
+.L1085:
+	movq	%r13, %rdi	# 13855	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 13854	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 13856	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 17646	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 17647	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 13858	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18196	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 13859	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 13861	[c=4 l=3]  *cmpdi_1/0
+	jb	.L283	# 13862	[c=13 l=6]  *jcc
+	movl	0(%r13), %ebx	# 13864	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 13869	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 13865	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 13867	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 13868	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 13870	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 13871	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 13872	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 13875	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 17648	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 13876	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 13879	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 13880	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 19183	[c=10 l=4]  *indirect_jump
+.L1086:
+	movzbl	10(%rbx), %r14d	# 13888	[c=13 l=5]  zero_extendqidi2/0
+	leaq	.LC43(%rip), %rsi	# 13893	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 13895	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 19182	[c=4 l=2]  *movdi_xor
+	movzbl	1004(%r13,%r14), %ecx	# 13890	[c=14 l=9]  *zero_extendqisi2/0
+	movq	%r14, %rdx	# 18626	[c=4 l=3]  *movdi_internal/3
+	movl	%r14d, 8(%rsp)	# 18154	[c=4 l=5]  *movsi_internal/1
+	call	log_append@PLT	# 13897	[c=0 l=5]  *call
+	movl	8(%rsp), %edx	# 18155	[c=9 l=4]  *movsi_internal/0
+	cmpl	$15, %edx	# 13900	[c=4 l=3]  *cmpsi_1/0
+	jle	.L1588	# 13901	[c=13 l=6]  *jcc
+	movzbl	1004(%r13,%r14), %r15d	# 13914	[c=14 l=9]  *zero_extendqisi2/0
+	xorl	%eax, %eax	# 19180	[c=4 l=2]  *movdi_xor
+	leaq	.LC61(%rip), %rsi	# 13920	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 13922	[c=4 l=3]  *movdi_internal/3
+	movb	%r15b, 8(%rsp)	# 18156	[c=4 l=5]  *movqi_internal/8
+	addl	%r15d, %r15d	# 13916	[c=4 l=3]  *ashlsi3_1/0
+	movzbl	%r15b, %ecx	# 13917	[c=4 l=4]  *zero_extendqisi2/0
+	call	log_append@PLT	# 13924	[c=0 l=5]  *call
+	movzbl	8(%rsp), %r8d	# 18157	[c=9 l=6]  *movqi_internal/4
+	movl	$63, %eax	# 13932	[c=4 l=5]  *movsi_internal/0
+	movb	%r15b, 1004(%r13,%r14)	# 13926	[c=4 l=8]  *movqi_internal/8
+	subl	5176(%r13), %eax	# 13933	[c=13 l=7]  *subsi_1/1
+	movl	%r8d, %r14d	# 17650	[c=4 l=3]  *movsi_internal/0
+	andl	$136, %r14d	# 13928	[c=4 l=7]  *andsi_1/0
+	imull	$780, %r14d, %r14d	# 13929	[c=12 l=7]  *mulsi3_1/1
+	andl	$7680, %r14d	# 13930	[c=4 l=7]  *andsi_1/0
+	orl	%r15d, %r14d	# 13931	[c=5 l=3]  *iorsi_1_zext
+	cmpl	5180(%r13), %eax	# 13934	[c=13 l=7]  *cmpsi_1/1
+	jb	.L1088	# 13935	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%r13)	# 13937	[c=13 l=8]  *cmpqi_ccno_1/1
+	jne	.L1089	# 13938	[c=13 l=6]  *jcc
+.L1088:
+	movq	1040(%r13), %rax	# 13941	[c=9 l=7]  *movdi_internal/3
+	movzbl	63(%rax), %r15d	# 13942	[c=13 l=5]  *zero_extendqisi2/0
+.L1090:
+	movl	%r15d, %ecx	# 13953	[c=4 l=3]  *movsi_internal/0
+	movl	$63, %edx	# 13954	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 13957	[c=4 l=3]  *movdi_internal/3
+	andl	$-64, %r15d	# 13959	[c=4 l=4]  *andsi_1/0
+	leaq	.LC32(%rip), %rsi	# 13955	[c=1 l=7]  *movdi_internal/4
+	call	log_add_data_mov@PLT	# 13958	[c=0 l=5]  *call
+	leaq	flag_update_table_add8(%rip), %rax	# 16561	[c=1 l=7]  *movdi_internal/4
+	movl	$63, %edx	# 13966	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 13969	[c=4 l=3]  *movdi_internal/3
+	movzbl	(%rax,%r14), %eax	# 13962	[c=13 l=5]  *zero_extendqisi2/0
+	leaq	.LC28(%rip), %rsi	# 13967	[c=1 l=7]  *movdi_internal/4
+	orl	%eax, %r15d	# 13963	[c=4 l=3]  *iorsi_1/0
+	movzbl	%r15b, %ecx	# 13964	[c=4 l=4]  *zero_extendqisi2/0
+	call	log_add_data_mov@PLT	# 13970	[c=0 l=5]  *call
+	movl	$63, %eax	# 13971	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 13972	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 13973	[c=13 l=7]  *cmpsi_1/1
+	jb	.L1091	# 13974	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%r13)	# 13976	[c=13 l=8]  *cmpqi_ccno_1/1
+	jne	.L1092	# 13977	[c=13 l=6]  *jcc
+.L1091:
+	movq	1040(%r13), %rax	# 13980	[c=9 l=7]  *movdi_internal/3
+	movb	%r15b, 63(%rax)	# 13981	[c=4 l=4]  *movqi_internal/8
+.L1093:
+	movq	%r13, %rdi	# 13993	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 13992	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 13994	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 17652	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 17653	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 13996	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18195	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 13997	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 13999	[c=4 l=3]  *cmpdi_1/0
+	jb	.L283	# 14000	[c=13 l=6]  *jcc
+	movl	0(%r13), %ebx	# 14002	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 14007	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 14003	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 14005	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 14006	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 14008	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 14009	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 14010	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 14013	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 17654	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 14014	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 14017	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 14018	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 19179	[c=10 l=4]  *indirect_jump
+.L1094:
+	movq	1040(%r13), %rax	# 14027	[c=9 l=7]  *movdi_internal/3
+	movzbl	10(%rbx), %edx	# 14026	[c=13 l=4]  *zero_extendqisi2/0
+	leaq	.LC43(%rip), %rsi	# 14035	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 14037	[c=4 l=3]  *movdi_internal/3
+	movzbl	63(%rax), %r14d	# 14028	[c=9 l=5]  *movqi_internal/4
+	movl	%edx, 16(%rsp)	# 18158	[c=4 l=4]  *movsi_internal/1
+	movl	%r14d, %eax	# 17656	[c=4 l=3]  *movsi_internal/0
+	movslq	%edx, %r14	# 14031	[c=4 l=3]  *extendsidi2_rex64/1
+	movzbl	1004(%r13,%r14), %ecx	# 14032	[c=14 l=9]  *zero_extendqisi2/0
+	andl	$1, %eax	# 14030	[c=4 l=3]  *andsi_1/0
+	movl	%eax, 8(%rsp)	# 17657	[c=4 l=4]  *movsi_internal/1
+	xorl	%eax, %eax	# 19178	[c=4 l=2]  *movdi_xor
+	call	log_append@PLT	# 14039	[c=0 l=5]  *call
+	movl	16(%rsp), %edx	# 18159	[c=9 l=4]  *movsi_internal/0
+	cmpl	$15, %edx	# 14042	[c=4 l=3]  *cmpsi_1/0
+	jle	.L1589	# 14043	[c=13 l=6]  *jcc
+	movzbl	1004(%r13,%r14), %eax	# 14056	[c=14 l=9]  *zero_extendqisi2/0
+	movl	8(%rsp), %edi	# 17658	[c=9 l=4]  *movsi_internal/0
+	leaq	.LC61(%rip), %rsi	# 14063	[c=1 l=7]  *movdi_internal/4
+	leal	(%rdi,%rax,2), %r8d	# 14059	[c=8 l=4]  *leasi
+	movl	%eax, %r15d	# 18628	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 14065	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 19176	[c=4 l=2]  *movdi_xor
+	movzbl	%r8b, %ecx	# 14060	[c=4 l=4]  *zero_extendqisi2/0
+	movl	%r8d, 8(%rsp)	# 18160	[c=4 l=5]  *movsi_internal/1
+	andl	$136, %r15d	# 14071	[c=4 l=7]  *andsi_1/0
+	call	log_append@PLT	# 14067	[c=0 l=5]  *call
+	movl	8(%rsp), %r8d	# 18161	[c=9 l=5]  *movsi_internal/0
+	movl	$63, %eax	# 14075	[c=4 l=5]  *movsi_internal/0
+	movb	%r8b, 1004(%r13,%r14)	# 14069	[c=4 l=8]  *movqi_internal/8
+	imull	$780, %r15d, %r14d	# 14072	[c=12 l=7]  *mulsi3_1/1
+	subl	5176(%r13), %eax	# 14076	[c=13 l=7]  *subsi_1/1
+	andl	$7680, %r14d	# 14073	[c=4 l=7]  *andsi_1/0
+	orl	%r8d, %r14d	# 14074	[c=5 l=3]  *iorsi_1_zext
+	cmpl	5180(%r13), %eax	# 14077	[c=13 l=7]  *cmpsi_1/1
+	jb	.L1096	# 14078	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%r13)	# 14080	[c=13 l=8]  *cmpqi_ccno_1/1
+	jne	.L1097	# 14081	[c=13 l=6]  *jcc
+.L1096:
+	movq	1040(%r13), %rax	# 14084	[c=9 l=7]  *movdi_internal/3
+	movzbl	63(%rax), %r15d	# 14085	[c=13 l=5]  *zero_extendqisi2/0
+.L1098:
+	movl	%r15d, %ecx	# 14096	[c=4 l=3]  *movsi_internal/0
+	movl	$63, %edx	# 14097	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 14100	[c=4 l=3]  *movdi_internal/3
+	andl	$-64, %r15d	# 14102	[c=4 l=4]  *andsi_1/0
+	leaq	.LC32(%rip), %rsi	# 14098	[c=1 l=7]  *movdi_internal/4
+	call	log_add_data_mov@PLT	# 14101	[c=0 l=5]  *call
+	leaq	flag_update_table_add8(%rip), %rax	# 16562	[c=1 l=7]  *movdi_internal/4
+	movl	$63, %edx	# 14109	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 14112	[c=4 l=3]  *movdi_internal/3
+	movzbl	(%rax,%r14), %eax	# 14105	[c=13 l=5]  *zero_extendqisi2/0
+	leaq	.LC28(%rip), %rsi	# 14110	[c=1 l=7]  *movdi_internal/4
+	orl	%eax, %r15d	# 14106	[c=4 l=3]  *iorsi_1/0
+	movzbl	%r15b, %ecx	# 14107	[c=4 l=4]  *zero_extendqisi2/0
+	call	log_add_data_mov@PLT	# 14113	[c=0 l=5]  *call
+	movl	$63, %eax	# 14114	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 14115	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 14116	[c=13 l=7]  *cmpsi_1/1
+	jb	.L1099	# 14117	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%r13)	# 14119	[c=13 l=8]  *cmpqi_ccno_1/1
+	jne	.L1100	# 14120	[c=13 l=6]  *jcc
+.L1099:
+	movq	1040(%r13), %rax	# 14123	[c=9 l=7]  *movdi_internal/3
+	movb	%r15b, 63(%rax)	# 14124	[c=4 l=4]  *movqi_internal/8
+.L1101:
+	movq	%r13, %rdi	# 14136	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 14135	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 14137	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 17659	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 17660	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 14139	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18194	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 14140	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 14142	[c=4 l=3]  *cmpdi_1/0
+	jb	.L283	# 14143	[c=13 l=6]  *jcc
+	movl	0(%r13), %ebx	# 14145	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 14150	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 14146	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 14148	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 14149	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 14151	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 14152	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 14153	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 14156	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 17661	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 14157	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 14160	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 14161	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 19175	[c=10 l=4]  *indirect_jump
+.L1102:
+	movzbl	10(%rbx), %r15d	# 14169	[c=13 l=5]  zero_extendqidi2/0
+	xorl	%eax, %eax	# 19174	[c=4 l=2]  *movdi_xor
+	leaq	.LC43(%rip), %rsi	# 14174	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 14176	[c=4 l=3]  *movdi_internal/3
+	movzbl	1004(%r13,%r15), %ecx	# 14171	[c=14 l=9]  *zero_extendqisi2/0
+	movl	%r15d, %edx	# 14173	[c=4 l=3]  *movsi_internal/0
+	call	log_append@PLT	# 14178	[c=0 l=5]  *call
+	cmpl	$15, %r15d	# 14181	[c=4 l=4]  *cmpsi_1/0
+	jle	.L1590	# 14182	[c=13 l=6]  *jcc
+	movzbl	1004(%r13,%r15), %r15d	# 14195	[c=14 l=9]  zero_extendqidi2/0
+	movl	$63, %eax	# 14196	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 14197	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 14198	[c=13 l=7]  *cmpsi_1/1
+	jb	.L1104	# 14199	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%r13)	# 14201	[c=13 l=8]  *cmpqi_ccno_1/1
+	jne	.L1105	# 14202	[c=13 l=6]  *jcc
+.L1104:
+	movq	1040(%r13), %rax	# 14205	[c=9 l=7]  *movdi_internal/3
+	movzbl	63(%rax), %r14d	# 14206	[c=13 l=5]  *zero_extendqisi2/0
+.L1106:
+	movl	%r14d, %ecx	# 14217	[c=4 l=3]  *movsi_internal/0
+	movl	$63, %edx	# 14218	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 14221	[c=4 l=3]  *movdi_internal/3
+	andl	$-31, %r14d	# 14223	[c=4 l=4]  *andsi_1/0
+	leaq	.LC32(%rip), %rsi	# 14219	[c=1 l=7]  *movdi_internal/4
+	call	log_add_data_mov@PLT	# 14222	[c=0 l=5]  *call
+	leaq	flag_update_table_logical(%rip), %rax	# 16563	[c=1 l=7]  *movdi_internal/4
+	movl	$63, %edx	# 14230	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 14233	[c=4 l=3]  *movdi_internal/3
+	movzbl	(%rax,%r15), %eax	# 14226	[c=13 l=5]  *zero_extendqisi2/0
+	leaq	.LC28(%rip), %rsi	# 14231	[c=1 l=7]  *movdi_internal/4
+	orl	%eax, %r14d	# 14227	[c=4 l=3]  *iorsi_1/0
+	movzbl	%r14b, %ecx	# 14228	[c=4 l=4]  *zero_extendqisi2/0
+	call	log_add_data_mov@PLT	# 14234	[c=0 l=5]  *call
+	movl	$63, %eax	# 14235	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 14236	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 14237	[c=13 l=7]  *cmpsi_1/1
+	jb	.L1107	# 14238	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%r13)	# 14240	[c=13 l=8]  *cmpqi_ccno_1/1
+	jne	.L1108	# 14241	[c=13 l=6]  *jcc
+.L1107:
+	movq	1040(%r13), %rax	# 14244	[c=9 l=7]  *movdi_internal/3
+	movb	%r14b, 63(%rax)	# 14245	[c=4 l=4]  *movqi_internal/8
+.L1109:
+	movq	%r13, %rdi	# 14257	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 14256	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 14258	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 17663	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 17664	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 14260	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18193	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 14261	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 14263	[c=4 l=3]  *cmpdi_1/0
+	jb	.L283	# 14264	[c=13 l=6]  *jcc
+	movl	0(%r13), %ebx	# 14266	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 14271	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 14267	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 14269	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 14270	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 14272	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 14273	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 14274	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 14277	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 17665	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 14278	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 14281	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 14282	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 19172	[c=10 l=4]  *indirect_jump
+.L1110:
+	movl	0(%r13), %eax	# 17667	[c=5 l=4]  *movsi_internal/0
+	movq	1056(%r13), %rdx	# 14295	[c=9 l=7]  *movdi_internal/3
+	leaq	.LC34(%rip), %rsi	# 14298	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 14300	[c=4 l=3]  *movdi_internal/3
+	subl	$1, %eax	# 14291	[c=4 l=3]  *addsi_1/0
+	movl	%eax, 0(%r13)	# 14292	[c=4 l=4]  *movsi_internal/1
+	addl	%eax, %eax	# 14293	[c=5 l=2]  *ashlsi3_1_zext/0
+	movzwl	(%rdx,%rax), %ebx	# 14296	[c=13 l=4]  *zero_extendhisi2/0
+	xorl	%eax, %eax	# 19170	[c=4 l=2]  *movdi_xor
+	movl	%ebx, %edx	# 14297	[c=4 l=2]  *movsi_internal/0
+	call	log_append@PLT	# 14302	[c=0 l=5]  *call
+	movq	832(%r13), %r8	# 14304	[c=9 l=7]  *movdi_internal/3
+	movl	%ebx, %ecx	# 14305	[c=4 l=2]  *movsi_internal/0
+	xorl	%eax, %eax	# 19171	[c=4 l=2]  *movdi_xor
+	leaq	.LC36(%rip), %rdx	# 14306	[c=1 l=7]  *movdi_internal/4
+	movl	$1, %esi	# 14308	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 14309	[c=4 l=3]  *movdi_internal/3
+	call	leave	# 14311	[c=0 l=5]  *call
+.L1111:
+	movl	0(%r13), %eax	# 17668	[c=5 l=4]  *movsi_internal/0
+	movq	1056(%r13), %rdx	# 14320	[c=9 l=7]  *movdi_internal/3
+	leaq	.LC34(%rip), %rsi	# 14323	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 14325	[c=4 l=3]  *movdi_internal/3
+	subl	$1, %eax	# 14316	[c=4 l=3]  *addsi_1/0
+	movl	%eax, 0(%r13)	# 14317	[c=4 l=4]  *movsi_internal/1
+	addl	%eax, %eax	# 14318	[c=5 l=2]  *ashlsi3_1_zext/0
+	movzwl	(%rdx,%rax), %ebx	# 14321	[c=13 l=4]  *zero_extendhisi2/0
+	xorl	%eax, %eax	# 19168	[c=4 l=2]  *movdi_xor
+	movl	%ebx, %edx	# 14322	[c=4 l=2]  *movsi_internal/0
+	call	log_append@PLT	# 14327	[c=0 l=5]  *call
+	movq	832(%r13), %r8	# 14329	[c=9 l=7]  *movdi_internal/3
+	movl	%ebx, %ecx	# 14330	[c=4 l=2]  *movsi_internal/0
+	xorl	%eax, %eax	# 19169	[c=4 l=2]  *movdi_xor
+	leaq	.LC36(%rip), %rdx	# 14331	[c=1 l=7]  *movdi_internal/4
+	movl	$1, %esi	# 14333	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 14334	[c=4 l=3]  *movdi_internal/3
+	call	leave	# 14336	[c=0 l=5]  *call
+.L1112:
+	movl	0(%r13), %eax	# 17669	[c=5 l=4]  *movsi_internal/0
+	movq	1056(%r13), %rdx	# 14345	[c=9 l=7]  *movdi_internal/3
+	leaq	.LC34(%rip), %rsi	# 14348	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 14350	[c=4 l=3]  *movdi_internal/3
+	subl	$1, %eax	# 14341	[c=4 l=3]  *addsi_1/0
+	movl	%eax, 0(%r13)	# 14342	[c=4 l=4]  *movsi_internal/1
+	addl	%eax, %eax	# 14343	[c=5 l=2]  *ashlsi3_1_zext/0
+	movzwl	(%rdx,%rax), %ebx	# 14346	[c=13 l=4]  *zero_extendhisi2/0
+	xorl	%eax, %eax	# 19166	[c=4 l=2]  *movdi_xor
+	movl	%ebx, %edx	# 14347	[c=4 l=2]  *movsi_internal/0
+	call	log_append@PLT	# 14352	[c=0 l=5]  *call
+	movq	832(%r13), %r8	# 14354	[c=9 l=7]  *movdi_internal/3
+	movl	%ebx, %ecx	# 14355	[c=4 l=2]  *movsi_internal/0
+	xorl	%eax, %eax	# 19167	[c=4 l=2]  *movdi_xor
+	leaq	.LC36(%rip), %rdx	# 14356	[c=1 l=7]  *movdi_internal/4
+	movl	$1, %esi	# 14358	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 14359	[c=4 l=3]  *movdi_internal/3
+	call	leave	# 14361	[c=0 l=5]  *call
+.L283:
+	leaq	.LC59(%rip), %rdx	# 604	[c=1 l=7]  *movdi_internal/4
+	movl	$2, %esi	# 606	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 607	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 19604	[c=4 l=2]  *movdi_xor
+	call	leave	# 609	[c=0 l=5]  *call
+.L1573:
+	subq	$1, 48(%r13)	# 12313	[c=13 l=5]  *adddi_1/0
+	jmp	.L1003	# 19850	[c=1 l=5]  jump
+.L1571:
+	subq	$1, 48(%r13)	# 12202	[c=13 l=5]  *adddi_1/0
+	jmp	.L996	# 19852	[c=1 l=5]  jump
+.L1565:
+	movl	0(%r13), %eax	# 17482	[c=5 l=4]  *movsi_internal/0
+	addq	$2, 48(%r13)	# 11939	[c=13 l=5]  *adddi_1/0
+	addl	$2, %eax	# 11934	[c=4 l=3]  *addsi_1/0
+	andl	992(%r13), %eax	# 11937	[c=13 l=7]  *andsi_1/1
+	movl	%eax, 0(%r13)	# 11938	[c=4 l=4]  *movsi_internal/1
+	jmp	.L980	# 19854	[c=1 l=5]  jump
+.L1561:
+	movl	0(%r13), %eax	# 17474	[c=5 l=4]  *movsi_internal/0
+	addq	$1, 48(%r13)	# 11841	[c=13 l=5]  *adddi_1/0
+	addl	$1, %eax	# 11836	[c=4 l=3]  *addsi_1/0
+	andl	992(%r13), %eax	# 11839	[c=13 l=7]  *andsi_1/1
+	movl	%eax, 0(%r13)	# 11840	[c=4 l=4]  *movsi_internal/1
+	jmp	.L975	# 19856	[c=1 l=5]  jump
+.L1557:
+	movl	0(%r13), %eax	# 17466	[c=5 l=4]  *movsi_internal/0
+	addq	$2, 48(%r13)	# 11743	[c=13 l=5]  *adddi_1/0
+	addl	$2, %eax	# 11738	[c=4 l=3]  *addsi_1/0
+	andl	992(%r13), %eax	# 11741	[c=13 l=7]  *andsi_1/1
+	movl	%eax, 0(%r13)	# 11742	[c=4 l=4]  *movsi_internal/1
+	jmp	.L970	# 19858	[c=1 l=5]  jump
+.L1553:
+	movl	0(%r13), %eax	# 17458	[c=5 l=4]  *movsi_internal/0
+	addq	$1, 48(%r13)	# 11645	[c=13 l=5]  *adddi_1/0
+	addl	$1, %eax	# 11640	[c=4 l=3]  *addsi_1/0
+	andl	992(%r13), %eax	# 11643	[c=13 l=7]  *andsi_1/1
+	movl	%eax, 0(%r13)	# 11644	[c=4 l=4]  *movsi_internal/1
+	jmp	.L965	# 19860	[c=1 l=5]  jump
+.L1549:
+	movl	0(%r13), %eax	# 17450	[c=5 l=4]  *movsi_internal/0
+	addq	$2, 48(%r13)	# 11547	[c=13 l=5]  *adddi_1/0
+	addl	$2, %eax	# 11542	[c=4 l=3]  *addsi_1/0
+	andl	992(%r13), %eax	# 11545	[c=13 l=7]  *andsi_1/1
+	movl	%eax, 0(%r13)	# 11546	[c=4 l=4]  *movsi_internal/1
+	jmp	.L960	# 19862	[c=1 l=5]  jump
+.L1546:
+	movl	0(%r13), %eax	# 17440	[c=5 l=4]  *movsi_internal/0
+	addq	$1, 48(%r13)	# 11440	[c=13 l=5]  *adddi_1/0
+	addl	$1, %eax	# 11435	[c=4 l=3]  *addsi_1/0
+	andl	992(%r13), %eax	# 11438	[c=13 l=7]  *andsi_1/1
+	movl	%eax, 0(%r13)	# 11439	[c=4 l=4]  *movsi_internal/1
+	jmp	.L952	# 19864	[c=1 l=5]  jump
+.L1543:
+	movl	0(%r13), %eax	# 17430	[c=5 l=4]  *movsi_internal/0
+	addq	$2, 48(%r13)	# 11333	[c=13 l=5]  *adddi_1/0
+	addl	$2, %eax	# 11328	[c=4 l=3]  *addsi_1/0
+	andl	992(%r13), %eax	# 11331	[c=13 l=7]  *andsi_1/1
+	movl	%eax, 0(%r13)	# 11332	[c=4 l=4]  *movsi_internal/1
+	jmp	.L944	# 19866	[c=1 l=5]  jump
+.L1540:
+	movl	0(%r13), %eax	# 17420	[c=5 l=4]  *movsi_internal/0
+	addq	$1, 48(%r13)	# 11226	[c=13 l=5]  *adddi_1/0
+	addl	$1, %eax	# 11221	[c=4 l=3]  *addsi_1/0
+	andl	992(%r13), %eax	# 11224	[c=13 l=7]  *andsi_1/1
+	movl	%eax, 0(%r13)	# 11225	[c=4 l=4]  *movsi_internal/1
+	jmp	.L936	# 19868	[c=1 l=5]  jump
+.L1539:
+	movslq	%r15d, %rdx	# 11101	[c=4 l=3]  *extendsidi2_rex64/1
+	cmpb	$0, 6568(%r13,%rdx)	# 11104	[c=14 l=9]  *cmpqi_ccno_1/1
+	js	.L926	# 11105	[c=13 l=6]  *jcc
+	jmp	.L925	# 19871	[c=1 l=5]  jump
+.L1477:
+	subq	$1, 48(%r13)	# 6592	[c=13 l=5]  *adddi_1/0
+	jmp	.L649	# 19873	[c=1 l=5]  jump
+.L1475:
+	subq	$1, 48(%r13)	# 6482	[c=13 l=5]  *adddi_1/0
+	jmp	.L642	# 19875	[c=1 l=5]  jump
+.L1428:
+	movl	0(%r13), %eax	# 16908	[c=5 l=4]  *movsi_internal/0
+	addq	$2, 48(%r13)	# 3616	[c=13 l=5]  *adddi_1/0
+	addl	$2, %eax	# 3611	[c=4 l=3]  *addsi_1/0
+	andl	992(%r13), %eax	# 3614	[c=13 l=7]  *andsi_1/1
+	movl	%eax, 0(%r13)	# 3615	[c=4 l=4]  *movsi_internal/1
+	jmp	.L455	# 19877	[c=1 l=5]  jump
+.L1423:
+	movl	0(%r13), %eax	# 16902	[c=5 l=4]  *movsi_internal/0
+	addq	$1, 48(%r13)	# 3494	[c=13 l=5]  *adddi_1/0
+	addl	$1, %eax	# 3489	[c=4 l=3]  *addsi_1/0
+	andl	992(%r13), %eax	# 3492	[c=13 l=7]  *andsi_1/1
+	movl	%eax, 0(%r13)	# 3493	[c=4 l=4]  *movsi_internal/1
+	jmp	.L449	# 19879	[c=1 l=5]  jump
+.L1413:
+	movslq	%r14d, %rdx	# 2755	[c=4 l=3]  *extendsidi2_rex64/1
+	xorl	%r15d, %r15d	# 19544	[c=4 l=3]  *movdi_xor
+	cmpb	$0, 6568(%r13,%rdx)	# 2758	[c=14 l=9]  *cmpqi_ccno_1/1
+	js	.L409	# 2759	[c=13 l=6]  *jcc
+	jmp	.L408	# 19882	[c=1 l=5]  jump
+.L255:
+	leaq	.LC42(%rip), %rsi	# 303	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 305	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 19634	[c=4 l=2]  *movdi_xor
+	call	log_append@PLT	# 307	[c=0 l=5]  *call
+.L264:
+	movq	%r13, %rdi	# 595	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 594	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 596	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 16715	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 16716	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 598	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18355	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 599	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 601	[c=4 l=3]  *cmpdi_1/0
+	jb	.L283	# 602	[c=13 l=6]  *jcc
+	movq	56(%r13), %rax	# 16717	[c=9 l=4]  *movdi_internal/3
+	cmpq	%rax, 48(%r13)	# 614	[c=13 l=4]  *cmpdi_1/0
+	jnb	.L1591	# 615	[c=13 l=6]  *jcc
+.L271:
+	movq	%r13, %rdi	# 621	[c=4 l=3]  *movdi_internal/3
+	call	log_is_idle@PLT	# 622	[c=10 l=5]  *call_value
+	testb	%al, %al	# 624	[c=4 l=2]  *cmpqi_ccno_1/0
+	jne	.L1592	# 625	[c=13 l=6]  *jcc
+.L272:
+	movl	0(%r13), %ebx	# 636	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 641	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 637	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 639	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 640	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 642	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 643	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 644	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 647	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 16718	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 648	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 651	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 652	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 19603	[c=10 l=4]  *indirect_jump
+.L263:
+	movzwl	1028(%r13), %edx	# 587	[c=13 l=8]  *zero_extendhisi2/0
+	movl	%r14d, %esi	# 589	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 590	[c=4 l=3]  *movdi_internal/3
+	call	do_syscall@PLT	# 591	[c=0 l=5]  *call
+	jmp	.L264	# 19886	[c=1 l=5]  jump
+.L349:
+	movl	$63, %esi	# 1991	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 1992	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 1993	[c=10 l=5]  *call_value
+	movl	%eax, %r15d	# 1994	[c=4 l=3]  *movsi_internal/0
+	jmp	.L350	# 19888	[c=1 l=5]  jump
+.L342:
+	movl	$63, %esi	# 1855	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 1856	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 1857	[c=10 l=5]  *call_value
+	movl	%eax, %r8d	# 1858	[c=4 l=3]  *movsi_internal/0
+	jmp	.L343	# 19890	[c=1 l=5]  jump
+.L337:
+	movl	%r14d, %edx	# 1771	[c=4 l=3]  *movsi_internal/0
+	movl	$63, %esi	# 1772	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 1773	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 1774	[c=0 l=5]  *call
+	jmp	.L338	# 19892	[c=1 l=5]  jump
+.L334:
+	movl	$63, %esi	# 1735	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 1736	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 1737	[c=10 l=5]  *call_value
+	movl	%eax, %r15d	# 1738	[c=4 l=3]  *movsi_internal/0
+	jmp	.L335	# 19894	[c=1 l=5]  jump
+.L330:
+	movl	%r14d, %edx	# 1679	[c=4 l=3]  *movsi_internal/0
+	movl	$63, %esi	# 1680	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 1681	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 1682	[c=0 l=5]  *call
+	jmp	.L331	# 19896	[c=1 l=5]  jump
+.L1108:
+	movl	%r14d, %edx	# 14250	[c=4 l=3]  *movsi_internal/0
+	movl	$63, %esi	# 14251	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 14252	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 14253	[c=0 l=5]  *call
+	jmp	.L1109	# 19898	[c=1 l=5]  jump
+.L1105:
+	movl	$63, %esi	# 14211	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 14212	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 14213	[c=10 l=5]  *call_value
+	movl	%eax, %r14d	# 14214	[c=4 l=3]  *movsi_internal/0
+	jmp	.L1106	# 19900	[c=1 l=5]  jump
+.L1100:
+	movl	%r15d, %edx	# 14129	[c=4 l=3]  *movsi_internal/0
+	movl	$63, %esi	# 14130	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 14131	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 14132	[c=0 l=5]  *call
+	jmp	.L1101	# 19902	[c=1 l=5]  jump
+.L1097:
+	movl	$63, %esi	# 14090	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 14091	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 14092	[c=10 l=5]  *call_value
+	movl	%eax, %r15d	# 14093	[c=4 l=3]  *movsi_internal/0
+	jmp	.L1098	# 19904	[c=1 l=5]  jump
+.L374:
+	movl	%r14d, %edx	# 2357	[c=4 l=3]  *movsi_internal/0
+	movl	$63, %esi	# 2358	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 2359	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 2360	[c=0 l=5]  *call
+	jmp	.L375	# 19906	[c=1 l=5]  jump
+.L371:
+	movl	$63, %esi	# 2321	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 2322	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 2323	[c=10 l=5]  *call_value
+	movl	%eax, %r14d	# 2324	[c=4 l=3]  *movsi_internal/0
+	jmp	.L372	# 19908	[c=1 l=5]  jump
+.L366:
+	movl	%r14d, %edx	# 2233	[c=4 l=3]  *movsi_internal/0
+	movl	$63, %esi	# 2234	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 2235	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 2236	[c=0 l=5]  *call
+	jmp	.L367	# 19910	[c=1 l=5]  jump
+.L363:
+	movl	$63, %esi	# 2198	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 2199	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 2200	[c=10 l=5]  *call_value
+	movl	%eax, %r14d	# 2201	[c=4 l=3]  *movsi_internal/0
+	jmp	.L364	# 19912	[c=1 l=5]  jump
+.L356:
+	movl	$63, %esi	# 2095	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 2096	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 2097	[c=10 l=5]  *call_value
+	movl	%eax, %r15d	# 2098	[c=4 l=3]  *movsi_internal/0
+	jmp	.L357	# 19914	[c=1 l=5]  jump
+.L412:
+	movl	%r15d, %edx	# 2794	[c=4 l=3]  *movsi_internal/0
+	movl	%r14d, %esi	# 2795	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 2796	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 2797	[c=0 l=5]  *call
+	jmp	.L413	# 19916	[c=1 l=5]  jump
+.L417:
+	movl	$63, %esi	# 2892	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 2893	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 2894	[c=10 l=5]  *call_value
+	movl	%eax, %r14d	# 2895	[c=4 l=3]  *movsi_internal/0
+	jmp	.L418	# 19918	[c=1 l=5]  jump
+.L405:
+	movl	%r14d, %esi	# 2736	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 2737	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 2738	[c=10 l=5]  *call_value
+	movl	%eax, %ecx	# 2739	[c=4 l=2]  *movsi_internal/0
+	jmp	.L406	# 19920	[c=1 l=5]  jump
+.L501:
+	movl	$60, %esi	# 4264	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 4265	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 4266	[c=10 l=5]  *call_value
+	movl	%eax, %r15d	# 4267	[c=4 l=3]  *movsi_internal/0
+	jmp	.L502	# 19922	[c=1 l=5]  jump
+.L583:
+	movl	%r15d, %edx	# 5594	[c=4 l=3]  *movsi_internal/0
+	movl	$63, %esi	# 5595	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 5596	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 5597	[c=0 l=5]  *call
+	jmp	.L584	# 19924	[c=1 l=5]  jump
+.L580:
+	movl	$63, %esi	# 5558	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 5559	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 5560	[c=10 l=5]  *call_value
+	jmp	.L581	# 19926	[c=1 l=5]  jump
+.L574:
+	movl	%r15d, %edx	# 5430	[c=4 l=3]  *movsi_internal/0
+	movl	$63, %esi	# 5431	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 5432	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 5433	[c=0 l=5]  *call
+	jmp	.L575	# 19928	[c=1 l=5]  jump
+.L571:
+	movl	$63, %esi	# 5394	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 5395	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 5396	[c=10 l=5]  *call_value
+	jmp	.L572	# 19930	[c=1 l=5]  jump
+.L565:
+	movl	%r15d, %edx	# 5266	[c=4 l=3]  *movsi_internal/0
+	movl	$63, %esi	# 5267	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 5268	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 5269	[c=0 l=5]  *call
+	jmp	.L566	# 19932	[c=1 l=5]  jump
+.L562:
+	movl	$63, %esi	# 5230	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 5231	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 5232	[c=10 l=5]  *call_value
+	jmp	.L563	# 19934	[c=1 l=5]  jump
+.L521:
+	movl	%r14d, %edx	# 4613	[c=4 l=3]  *movsi_internal/0
+	movl	$59, %esi	# 4614	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 4615	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 4616	[c=0 l=5]  *call
+	jmp	.L522	# 19936	[c=1 l=5]  jump
+.L517:
+	movl	$59, %esi	# 4534	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 4535	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 4536	[c=10 l=5]  *call_value
+	jmp	.L518	# 19938	[c=1 l=5]  jump
+.L512:
+	movl	$59, %esi	# 4430	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 4431	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 4432	[c=10 l=5]  *call_value
+	jmp	.L513	# 19940	[c=1 l=5]  jump
+.L508:
+	movl	$59, %esi	# 4368	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 4369	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 4370	[c=10 l=5]  *call_value
+	movl	%eax, %ebx	# 4371	[c=4 l=2]  *movsi_internal/0
+	jmp	.L509	# 19942	[c=1 l=5]  jump
+.L530:
+	movl	%r15d, %edx	# 4771	[c=4 l=3]  *movsi_internal/0
+	movl	$63, %esi	# 4772	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 4773	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 4774	[c=0 l=5]  *call
+	jmp	.L531	# 19944	[c=1 l=5]  jump
+.L527:
+	movl	$63, %esi	# 4732	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 4733	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 4734	[c=10 l=5]  *call_value
+	movl	%eax, %r15d	# 4735	[c=4 l=3]  *movsi_internal/0
+	jmp	.L528	# 19946	[c=1 l=5]  jump
+.L538:
+	movl	%edx, %esi	# 4877	[c=4 l=2]  *movsi_internal/0
+	movq	%r13, %rdi	# 4878	[c=4 l=3]  *movdi_internal/3
+	movl	%edx, 16(%rsp)	# 17828	[c=4 l=4]  *movsi_internal/1
+	call	data_read_page	# 4879	[c=10 l=5]  *call_value
+	movl	16(%rsp), %edx	# 17829	[c=9 l=4]  *movsi_internal/0
+	movl	%eax, %r14d	# 4880	[c=4 l=3]  *movsi_internal/0
+	jmp	.L539	# 19948	[c=1 l=5]  jump
+.L918:
+	movl	%r14d, %edx	# 11021	[c=4 l=3]  *movsi_internal/0
+	movl	$63, %esi	# 11022	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 11023	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 11024	[c=0 l=5]  *call
+	jmp	.L919	# 19950	[c=1 l=5]  jump
+.L1538:
+	movl	$63, %esi	# 10985	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 10986	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 10987	[c=10 l=5]  *call_value
+	movl	%eax, %ecx	# 10988	[c=4 l=2]  *movsi_internal/0
+	jmp	.L916	# 19952	[c=1 l=5]  jump
+.L922:
+	movl	%r15d, %esi	# 11082	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 11083	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 11084	[c=10 l=5]  *call_value
+	jmp	.L923	# 19954	[c=1 l=5]  jump
+.L658:
+	movl	%edx, %esi	# 6747	[c=4 l=2]  *movsi_internal/0
+	movq	%r13, %rdi	# 6748	[c=4 l=3]  *movdi_internal/3
+	movl	%edx, 8(%rsp)	# 17888	[c=4 l=4]  *movsi_internal/1
+	call	data_read_page	# 6749	[c=10 l=5]  *call_value
+	movl	8(%rsp), %edx	# 17889	[c=9 l=4]  *movsi_internal/0
+	movl	%eax, %r15d	# 6750	[c=4 l=3]  *movsi_internal/0
+	jmp	.L659	# 19956	[c=1 l=5]  jump
+.L652:
+	movl	%edx, %esi	# 6650	[c=4 l=2]  *movsi_internal/0
+	movq	%r13, %rdi	# 6651	[c=4 l=3]  *movdi_internal/3
+	movl	%edx, 8(%rsp)	# 17886	[c=4 l=4]  *movsi_internal/1
+	call	data_read_page	# 6652	[c=10 l=5]  *call_value
+	movl	8(%rsp), %edx	# 17887	[c=9 l=4]  *movsi_internal/0
+	movl	%eax, %r15d	# 6653	[c=4 l=3]  *movsi_internal/0
+	jmp	.L653	# 19958	[c=1 l=5]  jump
+.L682:
+	movl	%r15d, %esi	# 7184	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 7185	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 7186	[c=10 l=5]  *call_value
+	movl	%eax, 8(%rsp)	# 7187	[c=4 l=4]  *movsi_internal/1
+	jmp	.L683	# 19960	[c=1 l=5]  jump
+.L676:
+	movl	%r8d, %esi	# 7069	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 7070	[c=4 l=3]  *movdi_internal/3
+	movl	%r8d, 8(%rsp)	# 17897	[c=4 l=5]  *movsi_internal/1
+	call	data_read_page	# 7071	[c=10 l=5]  *call_value
+	movl	8(%rsp), %r8d	# 17898	[c=9 l=5]  *movsi_internal/0
+	movl	%eax, %r15d	# 7072	[c=4 l=3]  *movsi_internal/0
+	jmp	.L677	# 19962	[c=1 l=5]  jump
+.L670:
+	movl	%r15d, %esi	# 6956	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 6957	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 6958	[c=10 l=5]  *call_value
+	movl	%eax, 8(%rsp)	# 6959	[c=4 l=4]  *movsi_internal/1
+	jmp	.L671	# 19964	[c=1 l=5]  jump
+.L664:
+	movl	%r8d, %esi	# 6851	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 6852	[c=4 l=3]  *movdi_internal/3
+	movl	%r8d, 8(%rsp)	# 17892	[c=4 l=5]  *movsi_internal/1
+	call	data_read_page	# 6853	[c=10 l=5]  *call_value
+	movl	8(%rsp), %r8d	# 17893	[c=9 l=5]  *movsi_internal/0
+	movl	%eax, %r15d	# 6854	[c=4 l=3]  *movsi_internal/0
+	jmp	.L665	# 19966	[c=1 l=5]  jump
+.L638:
+	movl	%edx, %esi	# 6437	[c=4 l=2]  *movsi_internal/0
+	movq	%r13, %rdi	# 6438	[c=4 l=3]  *movdi_internal/3
+	movl	%edx, 16(%rsp)	# 17881	[c=4 l=4]  *movsi_internal/1
+	call	data_read_page	# 6439	[c=10 l=5]  *call_value
+	movl	16(%rsp), %edx	# 17882	[c=9 l=4]  *movsi_internal/0
+	movl	%eax, %r15d	# 6440	[c=4 l=3]  *movsi_internal/0
+	jmp	.L639	# 19968	[c=1 l=5]  jump
+.L628:
+	movl	%r14d, %edx	# 6235	[c=4 l=3]  *movsi_internal/0
+	movl	$63, %esi	# 6236	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 6237	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 6238	[c=0 l=5]  *call
+	jmp	.L629	# 19970	[c=1 l=5]  jump
+.L625:
+	movl	$63, %esi	# 6196	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 6197	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 6198	[c=10 l=5]  *call_value
+	movl	%eax, %r14d	# 6199	[c=4 l=3]  *movsi_internal/0
+	jmp	.L626	# 19972	[c=1 l=5]  jump
+.L618:
+	movl	%edx, %esi	# 6065	[c=4 l=2]  *movsi_internal/0
+	movq	%r13, %rdi	# 6066	[c=4 l=3]  *movdi_internal/3
+	movl	%edx, 8(%rsp)	# 17872	[c=4 l=4]  *movsi_internal/1
+	call	data_read_page	# 6067	[c=10 l=5]  *call_value
+	movl	8(%rsp), %edx	# 17873	[c=9 l=4]  *movsi_internal/0
+	movl	%eax, %r15d	# 6068	[c=4 l=3]  *movsi_internal/0
+	jmp	.L619	# 19974	[c=1 l=5]  jump
+.L764:
+	movl	%r15d, %edx	# 8861	[c=4 l=3]  *movsi_internal/0
+	movl	$63, %esi	# 8862	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 8863	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 8864	[c=0 l=5]  *call
+	jmp	.L765	# 19976	[c=1 l=5]  jump
+.L761:
+	movl	$63, %esi	# 8822	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 8823	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 8824	[c=10 l=5]  *call_value
+	movl	%eax, %r15d	# 8825	[c=4 l=3]  *movsi_internal/0
+	jmp	.L762	# 19978	[c=1 l=5]  jump
+.L754:
+	movl	%r15d, %edx	# 8669	[c=4 l=3]  *movsi_internal/0
+	movl	$63, %esi	# 8670	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 8671	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 8672	[c=0 l=5]  *call
+	jmp	.L755	# 19980	[c=1 l=5]  jump
+.L751:
+	movl	$63, %esi	# 8630	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 8631	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 8632	[c=10 l=5]  *call_value
+	movl	%eax, %r15d	# 8633	[c=4 l=3]  *movsi_internal/0
+	jmp	.L752	# 19982	[c=1 l=5]  jump
+.L746:
+	movl	%eax, %edx	# 8522	[c=4 l=2]  *movsi_internal/0
+	movl	$63, %esi	# 8523	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 8524	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 8525	[c=0 l=5]  *call
+	jmp	.L747	# 19984	[c=1 l=5]  jump
+.L743:
+	movl	$63, %esi	# 8486	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 8487	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 8488	[c=10 l=5]  *call_value
+	jmp	.L744	# 19986	[c=1 l=5]  jump
+.L737:
+	movl	%eax, %edx	# 8360	[c=4 l=2]  *movsi_internal/0
+	movl	$63, %esi	# 8361	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 8362	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 8363	[c=0 l=5]  *call
+	jmp	.L738	# 19988	[c=1 l=5]  jump
+.L734:
+	movl	$63, %esi	# 8324	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 8325	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 8326	[c=10 l=5]  *call_value
+	jmp	.L735	# 19990	[c=1 l=5]  jump
+.L728:
+	movl	%r15d, %edx	# 8198	[c=4 l=3]  *movsi_internal/0
+	movl	$63, %esi	# 8199	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 8200	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 8201	[c=0 l=5]  *call
+	jmp	.L729	# 19992	[c=1 l=5]  jump
+.L725:
+	movl	$63, %esi	# 8162	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 8163	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 8164	[c=10 l=5]  *call_value
+	jmp	.L726	# 19994	[c=1 l=5]  jump
+.L715:
+	movl	%r14d, %edx	# 7895	[c=4 l=3]  *movsi_internal/0
+	movl	$63, %esi	# 7896	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 7897	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 7898	[c=0 l=5]  *call
+	jmp	.L716	# 19996	[c=1 l=5]  jump
+.L712:
+	movl	$63, %esi	# 7856	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 7857	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 7858	[c=10 l=5]  *call_value
+	movl	%eax, %r14d	# 7859	[c=4 l=3]  *movsi_internal/0
+	jmp	.L713	# 19998	[c=1 l=5]  jump
+.L700:
+	movl	%r8d, %esi	# 7525	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 7526	[c=4 l=3]  *movdi_internal/3
+	movl	%r8d, 8(%rsp)	# 17911	[c=4 l=5]  *movsi_internal/1
+	call	data_read_page	# 7527	[c=10 l=5]  *call_value
+	movl	8(%rsp), %r8d	# 17912	[c=9 l=5]  *movsi_internal/0
+	movl	%eax, %r15d	# 7528	[c=4 l=3]  *movsi_internal/0
+	jmp	.L701	# 20000	[c=1 l=5]  jump
+.L694:
+	movl	%r15d, %esi	# 7412	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 7413	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 7414	[c=10 l=5]  *call_value
+	movl	%eax, 8(%rsp)	# 7415	[c=4 l=4]  *movsi_internal/1
+	jmp	.L695	# 20002	[c=1 l=5]  jump
+.L688:
+	movl	%r8d, %esi	# 7297	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 7298	[c=4 l=3]  *movdi_internal/3
+	movl	%r8d, 8(%rsp)	# 17904	[c=4 l=5]  *movsi_internal/1
+	call	data_read_page	# 7299	[c=10 l=5]  *call_value
+	movl	8(%rsp), %r8d	# 17905	[c=9 l=5]  *movsi_internal/0
+	movl	%eax, %r15d	# 7300	[c=4 l=3]  *movsi_internal/0
+	jmp	.L689	# 20004	[c=1 l=5]  jump
+.L912:
+	movl	%r14d, %edx	# 10868	[c=4 l=3]  *movsi_internal/0
+	movl	$63, %esi	# 10869	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 10870	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 10871	[c=0 l=5]  *call
+	jmp	.L913	# 20006	[c=1 l=5]  jump
+.L1536:
+	movl	$63, %esi	# 10832	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 10833	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 10834	[c=10 l=5]  *call_value
+	movl	%eax, %ecx	# 10835	[c=4 l=2]  *movsi_internal/0
+	jmp	.L910	# 20008	[c=1 l=5]  jump
+.L905:
+	movl	%r14d, %edx	# 10695	[c=4 l=3]  *movsi_internal/0
+	movl	$63, %esi	# 10696	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 10697	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 10698	[c=0 l=5]  *call
+	jmp	.L906	# 20010	[c=1 l=5]  jump
+.L902:
+	movl	$63, %esi	# 10656	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 10657	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 10658	[c=10 l=5]  *call_value
+	movl	%eax, %r14d	# 10659	[c=4 l=3]  *movsi_internal/0
+	jmp	.L903	# 20012	[c=1 l=5]  jump
+.L772:
+	movl	%r14d, %edx	# 9000	[c=4 l=3]  *movsi_internal/0
+	movl	$63, %esi	# 9001	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 9002	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 9003	[c=0 l=5]  *call
+	jmp	.L773	# 20014	[c=1 l=5]  jump
+.L769:
+	movl	$63, %esi	# 8961	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 8962	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 8963	[c=10 l=5]  *call_value
+	movl	%eax, %r14d	# 8964	[c=4 l=3]  *movsi_internal/0
+	jmp	.L770	# 20016	[c=1 l=5]  jump
+.L778:
+	movl	8(%rsp), %edx	# 9098	[c=9 l=4]  *movsi_internal/0
+	movl	%r14d, %esi	# 9099	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 9100	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 9101	[c=0 l=5]  *call
+	jmp	.L779	# 20018	[c=1 l=5]  jump
+.L933:
+	movl	%edx, %esi	# 11200	[c=4 l=2]  *movsi_internal/0
+	movq	%r13, %rdi	# 11201	[c=4 l=3]  *movdi_internal/3
+	movl	%edx, 8(%rsp)	# 18060	[c=4 l=4]  *movsi_internal/1
+	call	data_read_page	# 11202	[c=10 l=5]  *call_value
+	movl	8(%rsp), %edx	# 18061	[c=9 l=4]  *movsi_internal/0
+	movl	%eax, %r15d	# 11203	[c=4 l=3]  *movsi_internal/0
+	jmp	.L934	# 20020	[c=1 l=5]  jump
+.L929:
+	movl	%r14d, %edx	# 11139	[c=4 l=3]  *movsi_internal/0
+	movl	%r15d, %esi	# 11140	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 11141	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 11142	[c=0 l=5]  *call
+	jmp	.L930	# 20022	[c=1 l=5]  jump
+.L957:
+	movl	%edx, %esi	# 11521	[c=4 l=2]  *movsi_internal/0
+	movq	%r13, %rdi	# 11522	[c=4 l=3]  *movdi_internal/3
+	movl	%edx, 8(%rsp)	# 18066	[c=4 l=4]  *movsi_internal/1
+	call	data_read_page	# 11523	[c=10 l=5]  *call_value
+	movl	8(%rsp), %edx	# 18067	[c=9 l=4]  *movsi_internal/0
+	movl	%eax, %r15d	# 11524	[c=4 l=3]  *movsi_internal/0
+	jmp	.L958	# 20024	[c=1 l=5]  jump
+.L941:
+	movl	%edx, %esi	# 11307	[c=4 l=2]  *movsi_internal/0
+	movq	%r13, %rdi	# 11308	[c=4 l=3]  *movdi_internal/3
+	movl	%edx, 8(%rsp)	# 18062	[c=4 l=4]  *movsi_internal/1
+	call	data_read_page	# 11309	[c=10 l=5]  *call_value
+	movl	8(%rsp), %edx	# 18063	[c=9 l=4]  *movsi_internal/0
+	movl	%eax, %r15d	# 11310	[c=4 l=3]  *movsi_internal/0
+	jmp	.L942	# 20026	[c=1 l=5]  jump
+.L949:
+	movl	%edx, %esi	# 11414	[c=4 l=2]  *movsi_internal/0
+	movq	%r13, %rdi	# 11415	[c=4 l=3]  *movdi_internal/3
+	movl	%edx, 8(%rsp)	# 18064	[c=4 l=4]  *movsi_internal/1
+	call	data_read_page	# 11416	[c=10 l=5]  *call_value
+	movl	8(%rsp), %edx	# 18065	[c=9 l=4]  *movsi_internal/0
+	movl	%eax, %r15d	# 11417	[c=4 l=3]  *movsi_internal/0
+	jmp	.L950	# 20028	[c=1 l=5]  jump
+.L1001:
+	movl	16(%rsp), %edx	# 12304	[c=9 l=4]  *movsi_internal/0
+	movl	%r14d, %esi	# 12305	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 12306	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 12307	[c=0 l=5]  *call
+	jmp	.L1002	# 20030	[c=1 l=5]  jump
+.L994:
+	movl	16(%rsp), %edx	# 12193	[c=9 l=4]  *movsi_internal/0
+	movl	%r14d, %esi	# 12194	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 12195	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 12196	[c=0 l=5]  *call
+	jmp	.L995	# 20032	[c=1 l=5]  jump
+.L645:
+	movl	%edx, %esi	# 6547	[c=4 l=2]  *movsi_internal/0
+	movq	%r13, %rdi	# 6548	[c=4 l=3]  *movdi_internal/3
+	movl	%edx, 16(%rsp)	# 17884	[c=4 l=4]  *movsi_internal/1
+	call	data_read_page	# 6549	[c=10 l=5]  *call_value
+	movl	16(%rsp), %edx	# 17885	[c=9 l=4]  *movsi_internal/0
+	movl	%eax, %r15d	# 6550	[c=4 l=3]  *movsi_internal/0
+	jmp	.L646	# 20034	[c=1 l=5]  jump
+.L543:
+	movl	16(%rsp), %edx	# 4924	[c=9 l=4]  *movsi_internal/0
+	movl	%eax, %esi	# 4925	[c=4 l=2]  *movsi_internal/0
+	movq	%r13, %rdi	# 4926	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 4927	[c=0 l=5]  *call
+	jmp	.L544	# 20036	[c=1 l=5]  jump
+.L444:
+	movl	%r15d, %edx	# 3392	[c=4 l=3]  *movsi_internal/0
+	movl	$63, %esi	# 3393	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 3394	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 3395	[c=0 l=5]  *call
+	jmp	.L445	# 20038	[c=1 l=5]  jump
+.L441:
+	movl	$63, %esi	# 3353	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 3354	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 3355	[c=10 l=5]  *call_value
+	movl	%eax, %r15d	# 3356	[c=4 l=3]  *movsi_internal/0
+	jmp	.L442	# 20040	[c=1 l=5]  jump
+.L436:
+	movl	%r14d, %edx	# 3251	[c=4 l=3]  *movsi_internal/0
+	movl	$63, %esi	# 3252	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 3253	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 3254	[c=0 l=5]  *call
+	jmp	.L437	# 20042	[c=1 l=5]  jump
+.L1419:
+	movl	$63, %esi	# 3215	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 3216	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 3217	[c=10 l=5]  *call_value
+	movl	%eax, %ecx	# 3218	[c=4 l=2]  *movsi_internal/0
+	jmp	.L434	# 20044	[c=1 l=5]  jump
+.L429:
+	movl	%r14d, %edx	# 3089	[c=4 l=3]  *movsi_internal/0
+	movl	$63, %esi	# 3090	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 3091	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 3092	[c=0 l=5]  *call
+	jmp	.L430	# 20046	[c=1 l=5]  jump
+.L426:
+	movl	$63, %esi	# 3050	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 3051	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 3052	[c=10 l=5]  *call_value
+	movl	%eax, %r14d	# 3053	[c=4 l=3]  *movsi_internal/0
+	jmp	.L427	# 20048	[c=1 l=5]  jump
+.L420:
+	movl	%r14d, %edx	# 2928	[c=4 l=3]  *movsi_internal/0
+	movl	$63, %esi	# 2929	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 2930	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 2931	[c=0 l=5]  *call
+	jmp	.L421	# 20050	[c=1 l=5]  jump
+.L461:
+	movl	$63, %esi	# 3732	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 3733	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 3734	[c=10 l=5]  *call_value
+	movl	%eax, %r14d	# 3735	[c=4 l=3]  *movsi_internal/0
+	jmp	.L462	# 20052	[c=1 l=5]  jump
+.L464:
+	movl	%r14d, %edx	# 3771	[c=4 l=3]  *movsi_internal/0
+	movl	$63, %esi	# 3772	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 3773	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 3774	[c=0 l=5]  *call
+	jmp	.L465	# 20054	[c=1 l=5]  jump
+.L1092:
+	movl	%r15d, %edx	# 13986	[c=4 l=3]  *movsi_internal/0
+	movl	$63, %esi	# 13987	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 13988	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 13989	[c=0 l=5]  *call
+	jmp	.L1093	# 20056	[c=1 l=5]  jump
+.L1089:
+	movl	$63, %esi	# 13947	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 13948	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 13949	[c=10 l=5]  *call_value
+	movl	%eax, %r15d	# 13950	[c=4 l=3]  *movsi_internal/0
+	jmp	.L1090	# 20058	[c=1 l=5]  jump
+.L1084:
+	movl	%r14d, %edx	# 13848	[c=4 l=3]  *movsi_internal/0
+	movl	$63, %esi	# 13849	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 13850	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 13851	[c=0 l=5]  *call
+	jmp	.L1085	# 20060	[c=1 l=5]  jump
+.L1081:
+	movl	$63, %esi	# 13811	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 13812	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 13813	[c=10 l=5]  *call_value
+	movl	%eax, %r15d	# 13814	[c=4 l=3]  *movsi_internal/0
+	jmp	.L1082	# 20062	[c=1 l=5]  jump
+.L1073:
+	movl	%r15d, %edx	# 13625	[c=4 l=3]  *movsi_internal/0
+	movl	$63, %esi	# 13626	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 13627	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 13628	[c=0 l=5]  *call
+	jmp	.L1074	# 20064	[c=1 l=5]  jump
+.L1070:
+	movl	$63, %esi	# 13586	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 13587	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 13588	[c=10 l=5]  *call_value
+	movl	%eax, %r15d	# 13589	[c=4 l=3]  *movsi_internal/0
+	jmp	.L1071	# 20066	[c=1 l=5]  jump
+.L1065:
+	movl	%r15d, %edx	# 13474	[c=4 l=3]  *movsi_internal/0
+	movl	$63, %esi	# 13475	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 13476	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 13477	[c=0 l=5]  *call
+	jmp	.L1066	# 20068	[c=1 l=5]  jump
+.L1062:
+	movl	$63, %esi	# 13435	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 13436	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 13437	[c=10 l=5]  *call_value
+	movl	%eax, %r15d	# 13438	[c=4 l=3]  *movsi_internal/0
+	jmp	.L1063	# 20070	[c=1 l=5]  jump
+.L1056:
+	movl	16(%rsp), %edx	# 13291	[c=9 l=4]  *movsi_internal/0
+	movl	%r8d, %esi	# 13292	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 13293	[c=4 l=3]  *movdi_internal/3
+	movl	%r8d, 8(%rsp)	# 18128	[c=4 l=5]  *movsi_internal/1
+	call	data_write_page	# 13294	[c=0 l=5]  *call
+	movl	8(%rsp), %r8d	# 18129	[c=9 l=5]  *movsi_internal/0
+	jmp	.L1057	# 20072	[c=1 l=5]  jump
+.L1050:
+	movl	8(%rsp), %edx	# 13177	[c=9 l=4]  *movsi_internal/0
+	movl	%r15d, %esi	# 13178	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 13179	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 13180	[c=0 l=5]  *call
+	jmp	.L1051	# 20074	[c=1 l=5]  jump
+.L1044:
+	movl	16(%rsp), %edx	# 13061	[c=9 l=4]  *movsi_internal/0
+	movl	%r8d, %esi	# 13062	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 13063	[c=4 l=3]  *movdi_internal/3
+	movl	%r8d, 8(%rsp)	# 18116	[c=4 l=5]  *movsi_internal/1
+	call	data_write_page	# 13064	[c=0 l=5]  *call
+	movl	8(%rsp), %r8d	# 18117	[c=9 l=5]  *movsi_internal/0
+	jmp	.L1045	# 20076	[c=1 l=5]  jump
+.L1038:
+	movl	8(%rsp), %edx	# 12947	[c=9 l=4]  *movsi_internal/0
+	movl	%r15d, %esi	# 12948	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 12949	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 12950	[c=0 l=5]  *call
+	jmp	.L1039	# 20078	[c=1 l=5]  jump
+.L1032:
+	movl	16(%rsp), %edx	# 12831	[c=9 l=4]  *movsi_internal/0
+	movl	%r8d, %esi	# 12832	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 12833	[c=4 l=3]  *movdi_internal/3
+	movl	%r8d, 8(%rsp)	# 18104	[c=4 l=5]  *movsi_internal/1
+	call	data_write_page	# 12834	[c=0 l=5]  *call
+	movl	8(%rsp), %r8d	# 18105	[c=9 l=5]  *movsi_internal/0
+	jmp	.L1033	# 20080	[c=1 l=5]  jump
+.L1026:
+	movl	8(%rsp), %edx	# 12717	[c=9 l=4]  *movsi_internal/0
+	movl	%r15d, %esi	# 12718	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 12719	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 12720	[c=0 l=5]  *call
+	jmp	.L1027	# 20082	[c=1 l=5]  jump
+.L1020:
+	movl	8(%rsp), %edx	# 12611	[c=9 l=4]  *movsi_internal/0
+	movl	%r15d, %esi	# 12612	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 12613	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 12614	[c=0 l=5]  *call
+	jmp	.L1021	# 20084	[c=1 l=5]  jump
+.L1014:
+	movl	8(%rsp), %edx	# 12506	[c=9 l=4]  *movsi_internal/0
+	movl	%r14d, %esi	# 12507	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 12508	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 12509	[c=0 l=5]  *call
+	jmp	.L1015	# 20086	[c=1 l=5]  jump
+.L1008:
+	movl	8(%rsp), %edx	# 12408	[c=9 l=4]  *movsi_internal/0
+	movl	%r14d, %esi	# 12409	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 12410	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 12411	[c=0 l=5]  *call
+	jmp	.L1009	# 20088	[c=1 l=5]  jump
+.L327:
+	movl	$63, %esi	# 1640	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 1641	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 1642	[c=10 l=5]  *call_value
+	movl	%eax, %r14d	# 1643	[c=4 l=3]  *movsi_internal/0
+	jmp	.L328	# 20090	[c=1 l=5]  jump
+.L322:
+	movl	%r14d, %edx	# 1547	[c=4 l=3]  *movsi_internal/0
+	movl	$63, %esi	# 1548	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 1549	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 1550	[c=0 l=5]  *call
+	jmp	.L323	# 20092	[c=1 l=5]  jump
+.L319:
+	movl	$63, %esi	# 1508	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 1509	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 1510	[c=10 l=5]  *call_value
+	movl	%eax, %r14d	# 1511	[c=4 l=3]  *movsi_internal/0
+	jmp	.L320	# 20094	[c=1 l=5]  jump
+.L314:
+	movl	%r15d, %edx	# 1409	[c=4 l=3]  *movsi_internal/0
+	movl	$63, %esi	# 1410	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 1411	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 1412	[c=0 l=5]  *call
+	jmp	.L315	# 20096	[c=1 l=5]  jump
+.L311:
+	movl	$63, %esi	# 1370	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 1371	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 1372	[c=10 l=5]  *call_value
+	movl	%eax, %r15d	# 1373	[c=4 l=3]  *movsi_internal/0
+	jmp	.L312	# 20098	[c=1 l=5]  jump
+.L305:
+	movl	%r14d, %edx	# 1251	[c=4 l=3]  *movsi_internal/0
+	movl	$63, %esi	# 1252	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 1253	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 1254	[c=0 l=5]  *call
+	jmp	.L306	# 20100	[c=1 l=5]  jump
+.L302:
+	movl	$63, %esi	# 1215	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 1216	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 1217	[c=10 l=5]  *call_value
+	movl	%eax, %r14d	# 1218	[c=4 l=3]  *movsi_internal/0
+	jmp	.L303	# 20102	[c=1 l=5]  jump
+.L298:
+	movl	%r14d, %edx	# 1109	[c=4 l=3]  *movsi_internal/0
+	movl	$63, %esi	# 1110	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 1111	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 1112	[c=0 l=5]  *call
+	jmp	.L299	# 20104	[c=1 l=5]  jump
+.L295:
+	movl	$63, %esi	# 1073	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 1074	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 1075	[c=10 l=5]  *call_value
+	movl	%eax, %r14d	# 1076	[c=4 l=3]  *movsi_internal/0
+	jmp	.L296	# 20106	[c=1 l=5]  jump
+.L291:
+	movl	%r14d, %edx	# 968	[c=4 l=3]  *movsi_internal/0
+	movl	$63, %esi	# 969	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 970	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 971	[c=0 l=5]  *call
+	jmp	.L292	# 20108	[c=1 l=5]  jump
+.L288:
+	movl	$63, %esi	# 929	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 930	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 931	[c=10 l=5]  *call_value
+	movl	%eax, %r15d	# 932	[c=4 l=3]  *movsi_internal/0
+	jmp	.L289	# 20110	[c=1 l=5]  jump
+.L281:
+	movl	%r15d, %edx	# 796	[c=4 l=3]  *movsi_internal/0
+	movl	$63, %esi	# 797	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 798	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 799	[c=0 l=5]  *call
+	jmp	.L282	# 20112	[c=1 l=5]  jump
+.L278:
+	movl	$63, %esi	# 757	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 758	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 759	[c=10 l=5]  *call_value
+	movl	%eax, %r15d	# 760	[c=4 l=3]  *movsi_internal/0
+	jmp	.L279	# 20114	[c=1 l=5]  jump
+.L1433:
+	movl	$61, %esi	# 3880	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 3881	[c=4 l=3]  *movdi_internal/3
+	call	data_read_mapped	# 3882	[c=10 l=5]  *call_value
+	movl	%eax, %edx	# 3883	[c=4 l=2]  *movsi_internal/0
+	cmpl	%r15d, %r14d	# 3884	[c=4 l=3]  *cmpsi_1/0
+	jb	.L1593	# 3885	[c=13 l=6]  *jcc
+.L472:
+	movl	$62, %esi	# 3902	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 3903	[c=4 l=3]  *movdi_internal/3
+	movl	%edx, 8(%rsp)	# 17799	[c=4 l=4]  *movsi_internal/1
+	call	data_read_mapped	# 3904	[c=10 l=5]  *call_value
+	movl	8(%rsp), %edx	# 17800	[c=9 l=4]  *movsi_internal/0
+	movl	%eax, %r8d	# 3905	[c=4 l=3]  *movsi_internal/0
+	jmp	.L473	# 20117	[c=1 l=5]  jump
+.L1508:
+	movl	$61, %esi	# 9387	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 9388	[c=4 l=3]  *movdi_internal/3
+	movl	%edx, 24(%rsp)	# 17988	[c=4 l=4]  *movsi_internal/1
+	movl	%ecx, 8(%rsp)	# 17986	[c=4 l=4]  *movsi_internal/1
+	call	data_read_mapped	# 9389	[c=10 l=5]  *call_value
+	movl	8(%rsp), %ecx	# 17987	[c=9 l=4]  *movsi_internal/0
+	movl	24(%rsp), %edx	# 17989	[c=9 l=4]  *movsi_internal/0
+	movl	%eax, %r14d	# 9390	[c=4 l=3]  *movsi_internal/0
+	cmpl	%ecx, %edx	# 9391	[c=4 l=2]  *cmpsi_1/0
+	jb	.L1594	# 9392	[c=13 l=6]  *jcc
+.L800:
+	movl	$62, %esi	# 9409	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 9410	[c=4 l=3]  *movdi_internal/3
+	call	data_read_mapped	# 9411	[c=10 l=5]  *call_value
+	jmp	.L801	# 20120	[c=1 l=5]  jump
+.L1458:
+	movl	$61, %esi	# 5655	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 5656	[c=4 l=3]  *movdi_internal/3
+	call	data_read_mapped	# 5657	[c=10 l=5]  *call_value
+	movl	%eax, %edx	# 5658	[c=4 l=2]  *movsi_internal/0
+	movl	$62, %eax	# 5659	[c=4 l=5]  *movsi_internal/0
+	subl	%r15d, %eax	# 5660	[c=4 l=3]  *subsi_1/0
+	cmpl	%r14d, %eax	# 5661	[c=4 l=3]  *cmpsi_1/0
+	jb	.L1595	# 5662	[c=13 l=6]  *jcc
+.L589:
+	movl	$62, %esi	# 5681	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 5682	[c=4 l=3]  *movdi_internal/3
+	movl	%edx, 8(%rsp)	# 17862	[c=4 l=4]  *movsi_internal/1
+	call	data_read_mapped	# 5683	[c=10 l=5]  *call_value
+	movl	8(%rsp), %edx	# 17863	[c=9 l=4]  *movsi_internal/0
+	movl	%eax, %r8d	# 5684	[c=4 l=3]  *movsi_internal/0
+	jmp	.L590	# 20123	[c=1 l=5]  jump
+.L1406:
+	movl	$61, %esi	# 2411	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 2412	[c=4 l=3]  *movdi_internal/3
+	movl	%ecx, 24(%rsp)	# 17748	[c=4 l=4]  *movsi_internal/1
+	call	data_read_mapped	# 2413	[c=10 l=5]  *call_value
+	movl	24(%rsp), %ecx	# 17749	[c=9 l=4]  *movsi_internal/0
+	movl	%eax, %r15d	# 2414	[c=4 l=3]  *movsi_internal/0
+	movl	$62, %eax	# 2415	[c=4 l=5]  *movsi_internal/0
+	subl	%ecx, %eax	# 2416	[c=4 l=2]  *subsi_1/0
+	cmpl	%r14d, %eax	# 2417	[c=4 l=3]  *cmpsi_1/0
+	jb	.L1596	# 2418	[c=13 l=6]  *jcc
+.L380:
+	movl	$62, %esi	# 2437	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 2438	[c=4 l=3]  *movdi_internal/3
+	call	data_read_mapped	# 2439	[c=10 l=5]  *call_value
+	movl	%eax, %r8d	# 2440	[c=4 l=3]  *movsi_internal/0
+	jmp	.L381	# 20126	[c=1 l=5]  jump
+.L1518:
+	movl	$61, %esi	# 9885	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 9886	[c=4 l=3]  *movdi_internal/3
+	call	data_read_mapped	# 9887	[c=10 l=5]  *call_value
+	movl	%eax, %edx	# 9888	[c=4 l=2]  *movsi_internal/0
+	movl	$62, %eax	# 9889	[c=4 l=5]  *movsi_internal/0
+	subl	%r15d, %eax	# 9890	[c=4 l=3]  *subsi_1/0
+	cmpl	%r14d, %eax	# 9891	[c=4 l=3]  *cmpsi_1/0
+	jb	.L1597	# 9892	[c=13 l=6]  *jcc
+.L841:
+	movl	$62, %esi	# 9911	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 9912	[c=4 l=3]  *movdi_internal/3
+	movl	%edx, 8(%rsp)	# 18001	[c=4 l=4]  *movsi_internal/1
+	call	data_read_mapped	# 9913	[c=10 l=5]  *call_value
+	movl	8(%rsp), %edx	# 18002	[c=9 l=4]  *movsi_internal/0
+	jmp	.L842	# 20129	[c=1 l=5]  jump
+.L1524:
+	movl	$61, %esi	# 10179	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 10180	[c=4 l=3]  *movdi_internal/3
+	call	data_read_mapped	# 10181	[c=10 l=5]  *call_value
+	movl	%eax, %edx	# 10182	[c=4 l=2]  *movsi_internal/0
+	movl	$62, %eax	# 10183	[c=4 l=5]  *movsi_internal/0
+	subl	%r15d, %eax	# 10184	[c=4 l=3]  *subsi_1/0
+	cmpl	%r14d, %eax	# 10185	[c=4 l=3]  *cmpsi_1/0
+	jb	.L1598	# 10186	[c=13 l=6]  *jcc
+.L867:
+	movl	$62, %esi	# 10205	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 10206	[c=4 l=3]  *movdi_internal/3
+	movl	%edx, 8(%rsp)	# 18015	[c=4 l=4]  *movsi_internal/1
+	call	data_read_mapped	# 10207	[c=10 l=5]  *call_value
+	movl	8(%rsp), %edx	# 18016	[c=9 l=4]  *movsi_internal/0
+	jmp	.L868	# 20132	[c=1 l=5]  jump
+.L1512:
+	movl	$61, %esi	# 9574	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 9575	[c=4 l=3]  *movdi_internal/3
+	movl	%ecx, 16(%rsp)	# 17991	[c=4 l=4]  *movsi_internal/1
+	call	data_read_mapped	# 9576	[c=10 l=5]  *call_value
+	movl	16(%rsp), %ecx	# 17992	[c=9 l=4]  *movsi_internal/0
+	movl	%eax, %r15d	# 9577	[c=4 l=3]  *movsi_internal/0
+	movl	$62, %eax	# 9578	[c=4 l=5]  *movsi_internal/0
+	subl	%ecx, %eax	# 9579	[c=4 l=2]  *subsi_1/0
+	cmpl	%r14d, %eax	# 9580	[c=4 l=3]  *cmpsi_1/0
+	jb	.L1599	# 9581	[c=13 l=6]  *jcc
+.L815:
+	movl	$62, %esi	# 9600	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 9601	[c=4 l=3]  *movdi_internal/3
+	call	data_read_mapped	# 9602	[c=10 l=5]  *call_value
+	jmp	.L816	# 20135	[c=1 l=5]  jump
+.L1503:
+	movl	$61, %esi	# 9151	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 9152	[c=4 l=3]  *movdi_internal/3
+	movl	%ecx, 8(%rsp)	# 17974	[c=4 l=4]  *movsi_internal/1
+	call	data_read_mapped	# 9153	[c=10 l=5]  *call_value
+	movl	8(%rsp), %ecx	# 17975	[c=9 l=4]  *movsi_internal/0
+	movl	%eax, %edx	# 9154	[c=4 l=2]  *movsi_internal/0
+	movl	$62, %eax	# 9155	[c=4 l=5]  *movsi_internal/0
+	subl	%ecx, %eax	# 9156	[c=4 l=2]  *subsi_1/0
+	cmpl	%r15d, %eax	# 9157	[c=4 l=3]  *cmpsi_1/0
+	jb	.L1600	# 9158	[c=13 l=6]  *jcc
+.L784:
+	movl	$62, %esi	# 9177	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 9178	[c=4 l=3]  *movdi_internal/3
+	movl	%edx, 8(%rsp)	# 17976	[c=4 l=4]  *movsi_internal/1
+	call	data_read_mapped	# 9179	[c=10 l=5]  *call_value
+	movl	8(%rsp), %edx	# 17977	[c=9 l=4]  *movsi_internal/0
+	movl	%eax, %r15d	# 9180	[c=4 l=3]  *movsi_internal/0
+	jmp	.L785	# 20138	[c=1 l=5]  jump
+.L256:
+	leaq	.LC57(%rip), %rsi	# 573	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 575	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 19605	[c=4 l=2]  *movdi_xor
+	call	log_append@PLT	# 577	[c=0 l=5]  *call
+	movl	$1, %esi	# 580	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 581	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 19606	[c=4 l=2]  *movdi_xor
+	leaq	.LC58(%rip), %rdx	# 578	[c=1 l=7]  *movdi_internal/4
+	call	leave	# 583	[c=0 l=5]  *call
+.L260:
+	cmpl	$0, 248(%r13)	# 472	[c=13 l=8]  *cmpsi_ccno_1/1
+	je	.L268	# 473	[c=13 l=6]  *jcc
+	leaq	.LC51(%rip), %rsi	# 475	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 477	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 19615	[c=4 l=2]  *movdi_xor
+	call	log_append@PLT	# 479	[c=0 l=5]  *call
+	movq	904(%r13), %rdi	# 480	[c=9 l=7]  *movdi_internal/3
+	call	fflush@PLT	# 482	[c=10 l=5]  *call_value
+	movq	40(%r13), %rdx	# 483	[c=9 l=4]  *movdi_internal/3
+	xorl	%esi, %esi	# 19616	[c=4 l=2]  *movdi_xor
+	movq	%r13, %rdi	# 488	[c=4 l=3]  *movdi_internal/3
+	leaq	host_getchar(%rip), %rcx	# 484	[c=1 l=7]  *movdi_internal/4
+	call	replay_input@PLT	# 489	[c=10 l=5]  *call_value
+	movl	$24, %edx	# 493	[c=4 l=5]  *movsi_internal/0
+	leaq	.LC48(%rip), %rsi	# 494	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 496	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, %r14d	# 490	[c=4 l=3]  *movsi_internal/0
+	movzwl	%ax, %ecx	# 491	[c=4 l=3]  *zero_extendhisi2/0
+	xorl	%eax, %eax	# 19617	[c=4 l=2]  *movdi_xor
+	call	log_append@PLT	# 498	[c=0 l=5]  *call
+	movw	%r14w, 1028(%r13)	# 499	[c=4 l=8]  *movhi_internal/3
+	jmp	.L264	# 20140	[c=1 l=5]  jump
+.L261:
+	cmpl	$0, 504(%r13)	# 381	[c=13 l=8]  *cmpsi_ccno_1/1
+	jne	.L267	# 382	[c=13 l=6]  *jcc
+	leaq	.LC48(%rip), %r14	# 391	[c=1 l=7]  *movdi_internal/4
+	leaq	.LC47(%rip), %rsi	# 384	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 386	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 19623	[c=4 l=2]  *movdi_xor
+	call	log_append@PLT	# 388	[c=0 l=5]  *call
+	movl	$1, %ecx	# 389	[c=4 l=5]  *movsi_internal/0
+	movq	%r14, %rsi	# 392	[c=4 l=3]  *movdi_internal/3
+	movq	%r13, %rdi	# 393	[c=4 l=3]  *movdi_internal/3
+	movl	$20, %edx	# 390	[c=4 l=5]  *movsi_internal/0
+	xorl	%eax, %eax	# 19624	[c=4 l=2]  *movdi_xor
+	call	log_append@PLT	# 395	[c=0 l=5]  *call
+	xorl	%ecx, %ecx	# 19625	[c=4 l=2]  *movdi_xor
+	movl	$22, %edx	# 399	[c=4 l=5]  *movsi_internal/0
+	movq	%r14, %rsi	# 401	[c=4 l=3]  *movdi_internal/3
+	movzwl	.LC49(%rip), %eax	# 396	[c=6 l=7]  *movv2qi_internal/2
+	movq	%r13, %rdi	# 402	[c=4 l=3]  *movdi_internal/3
+	movw	%ax, 1024(%r13)	# 397	[c=4 l=8]  *movv2qi_internal/3
+	xorl	%eax, %eax	# 19626	[c=4 l=2]  *movdi_xor
+	call	log_append@PLT	# 404	[c=0 l=5]  *call
+	xorl	%ecx, %ecx	# 19627	[c=4 l=2]  *movdi_xor
+	movl	$24, %edx	# 408	[c=4 l=5]  *movsi_internal/0
+	movq	%r14, %rsi	# 410	[c=4 l=3]  *movdi_internal/3
+	movw	$0, 1026(%r13)	# 406	[c=4 l=10]  *movv2qi_internal/3
+	movq	%r13, %rdi	# 411	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 19628	[c=4 l=2]  *movdi_xor
+	call	log_append@PLT	# 413	[c=0 l=5]  *call
+	movw	$0, 1028(%r13)	# 415	[c=4 l=10]  *movv2qi_internal/3
+	jmp	.L264	# 20142	[c=1 l=5]  jump
+.L258:
+	movswl	1028(%r13), %ebx	# 547	[c=13 l=8]  extendhisi2/1
+	leaq	.LC55(%rip), %rsi	# 549	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 551	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 19607	[c=4 l=2]  *movdi_xor
+	movl	%ebx, %edx	# 548	[c=4 l=2]  *movsi_internal/0
+	call	log_append@PLT	# 553	[c=0 l=5]  *call
+	movl	$24, %edx	# 556	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 559	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 19608	[c=4 l=2]  *movdi_xor
+	movzwl	1028(%r13), %ecx	# 554	[c=13 l=8]  *zero_extendhisi2/0
+	leaq	.LC44(%rip), %rsi	# 557	[c=1 l=7]  *movdi_internal/4
+	call	log_append@PLT	# 561	[c=0 l=5]  *call
+	movl	%ebx, 76(%r13)	# 562	[c=4 l=4]  *movsi_internal/1
+	movl	%ebx, %ecx	# 563	[c=4 l=2]  *movsi_internal/0
+	xorl	%esi, %esi	# 19609	[c=4 l=2]  *movdi_xor
+	leaq	.LC56(%rip), %rdx	# 564	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 567	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 19610	[c=4 l=2]  *movdi_xor
+	call	leave	# 569	[c=0 l=5]  *call
+.L259:
+	cmpl	$0, 264(%r13)	# 513	[c=13 l=8]  *cmpsi_ccno_1/1
+	je	.L269	# 514	[c=13 l=6]  *jcc
+	movq	%r13, %rdi	# 518	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 19612	[c=4 l=2]  *movdi_xor
+	leaq	.LC53(%rip), %rsi	# 516	[c=1 l=7]  *movdi_internal/4
+	call	log_append@PLT	# 520	[c=0 l=5]  *call
+	movq	%r13, %rdi	# 527	[c=4 l=3]  *movdi_internal/3
+	movl	$24, %edx	# 524	[c=4 l=5]  *movsi_internal/0
+	xorl	%eax, %eax	# 19613	[c=4 l=2]  *movdi_xor
+	movzbl	1028(%r13), %ecx	# 522	[c=13 l=8]  *zero_extendqisi2/0
+	movq	904(%r13), %r14	# 521	[c=9 l=7]  *movdi_internal/3
+	leaq	.LC43(%rip), %rsi	# 525	[c=1 l=7]  *movdi_internal/4
+	call	log_append@PLT	# 529	[c=0 l=5]  *call
+	movsbl	1028(%r13), %edi	# 530	[c=13 l=8]  extendqisi2
+	movq	%r14, %rsi	# 531	[c=4 l=3]  *movdi_internal/3
+	call	putc@PLT	# 533	[c=10 l=5]  *call_value
+	jmp	.L264	# 20144	[c=1 l=5]  jump
+.L262:
+	movzbl	1028(%r13), %ecx	# 312	[c=13 l=8]  *zero_extendqisi2/0
+	movl	$24, %edx	# 314	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 317	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 19630	[c=4 l=2]  *movdi_xor
+	leaq	.LC43(%rip), %rsi	# 315	[c=1 l=7]  *movdi_internal/4
+	call	log_append@PLT	# 319	[c=0 l=5]  *call
+	movl	$20, %edx	# 324	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 327	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 19631	[c=4 l=2]  *movdi_xor
+	movzwl	1024(%r13), %r9d	# 322	[c=13 l=8]  *zero_extendhisi2/0
+	movzbl	1028(%r13), %r15d	# 320	[c=13 l=8]  *zero_extendqisi2/0
+	leaq	.LC44(%rip), %rsi	# 325	[c=1 l=7]  *movdi_internal/4
+	movl	%r9d, %ecx	# 323	[c=4 l=3]  *movsi_internal/0
+	movl	%r9d, 8(%rsp)	# 17673	[c=4 l=5]  *movsi_internal/1
+	movb	%r15b, 16(%rsp)	# 17675	[c=4 l=5]  *movqi_internal/8
+	call	log_append@PLT	# 329	[c=0 l=5]  *call
+	movl	$22, %edx	# 332	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 335	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 19632	[c=4 l=2]  *movdi_xor
+	movzwl	1026(%r13), %r14d	# 330	[c=13 l=8]  *zero_extendhisi2/0
+	leaq	.LC44(%rip), %rsi	# 17672	[c=1 l=7]  *movdi_internal/4
+	movl	%r14d, %ecx	# 331	[c=4 l=3]  *movsi_internal/0
+	sall	$16, %r14d	# 338	[c=4 l=4]  *ashlsi3_1/0
+	call	log_append@PLT	# 337	[c=0 l=5]  *call
+	movl	8(%rsp), %r9d	# 17674	[c=9 l=5]  *movsi_internal/0
+	movl	%r15d, %edx	# 341	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 344	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC45(%rip), %rsi	# 342	[c=1 l=7]  *movdi_internal/4
+	xorl	%eax, %eax	# 19633	[c=4 l=2]  *movdi_xor
+	orl	%r9d, %r14d	# 339	[c=4 l=3]  *iorsi_1/0
+	movl	%r14d, %ecx	# 340	[c=4 l=3]  *movsi_internal/0
+	call	log_append@PLT	# 346	[c=0 l=5]  *call
+	movzbl	16(%rsp), %r8d	# 17676	[c=9 l=6]  *movqi_internal/4
+	testb	%r8b, %r8b	# 349	[c=4 l=3]  *cmpqi_ccno_1/0
+	jle	.L265	# 350	[c=13 l=6]  *jcc
+	cmpl	%r15d, 992(%r13)	# 353	[c=13 l=7]  *cmpsi_1/0
+	jb	.L265	# 354	[c=13 l=6]  *jcc
+	movq	irq_raise@GOTPCREL(%rip), %rdx	# 373	[c=5 l=7]  *movdi_internal/3
+	movl	%r14d, %esi	# 367	[c=1 l=3]  *zero_extendsidi2/3
+	movl	%r15d, %ecx	# 370	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 375	[c=4 l=3]  *movdi_internal/3
+	addq	48(%r13), %rsi	# 369	[c=13 l=4]  *adddi_1/1
+	call	event_schedule@PLT	# 376	[c=0 l=5]  *call
+	jmp	.L264	# 20146	[c=1 l=5]  jump
+.L547:
+	cmpl	$4, %eax	# 4965	[c=4 l=3]  *cmpsi_1/0
+	jne	.L545	# 4966	[c=13 l=6]  *jcc
+	movl	%r15d, %eax	# 5012	[c=1 l=3]  *zero_extendsidi2/3
+	movl	$255, %esi	# 5014	[c=4 l=5]  *movsi_internal/0
+	movq	%rax, %rdx	# 5013	[c=4 l=3]  *movdi_internal/3
+	movq	%rax, 32(%rsp)	# 17835	[c=4 l=5]  *movdi_internal/5
+	call	memset@PLT	# 5016	[c=10 l=5]  *call_value
+	movq	%rax, %rcx	# 17834	[c=4 l=3]  *movdi_internal/3
+.L546:
+	leaq	6052(%r13), %rax	# 18307	[c=4 l=7]  *leadi
+	movl	%r14d, %edx	# 5020	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC64(%rip), %rsi	# 5021	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 5023	[c=4 l=3]  *movdi_internal/3
+	movq	%rax, 16(%rsp)	# 16994	[c=4 l=5]  *movdi_internal/5
+	xorl	%eax, %eax	# 19470	[c=4 l=2]  *movdi_xor
+	movq	%rcx, 24(%rsp)	# 17836	[c=4 l=5]  *movdi_internal/5
+	call	log_append@PLT	# 5025	[c=0 l=5]  *call
+	movq	24(%rsp), %rcx	# 17837	[c=9 l=5]  *movdi_internal/3
+	xorl	%eax, %eax	# 19471	[c=4 l=2]  *movdi_xor
+	jmp	.L551	# 20148	[c=1 l=2]  jump
+.L552:
+	movzbl	6052(%r13,%rax), %edx	# 5029	[c=10 l=9]  *movqi_internal/4
+	andb	%dl, (%rcx,%rax)	# 5030	[c=13 l=3]  *andqi_1/0
+	addq	$1, %rax	# 5031	[c=4 l=4]  *adddi_1/0
+.L551:
+	cmpl	%r15d, %eax	# 5035	[c=4 l=3]  *cmpsi_1/0
+	jb	.L552	# 5036	[c=13 l=2]  *jcc
+	movq	32(%rsp), %rdx	# 5040	[c=9 l=5]  *movdi_internal/3
+	movq	16(%rsp), %rdi	# 5042	[c=9 l=5]  *movdi_internal/3
+	movl	$255, %esi	# 5041	[c=4 l=5]  *movsi_internal/0
+	jmp	.L1285	# 20150	[c=1 l=5]  jump
+.L469:
+	movq	1040(%r13), %rax	# 3891	[c=9 l=7]  *movdi_internal/3
+	movzbl	61(%rax), %edx	# 3892	[c=13 l=4]  *zero_extendqisi2/0
+	cmpl	%r15d, %r14d	# 3893	[c=4 l=3]  *cmpsi_1/0
+	jb	.L471	# 3894	[c=13 l=6]  *jcc
+	cmpb	$1, 1081(%r13)	# 3898	[c=13 l=8]  *cmpqi_1/0
+	jbe	.L471	# 3899	[c=13 l=6]  *jcc
+	jmp	.L472	# 20153	[c=1 l=5]  jump
+.L586:
+	movq	1040(%r13), %rax	# 5668	[c=9 l=7]  *movdi_internal/3
+	movl	$62, %ecx	# 5670	[c=4 l=5]  *movsi_internal/0
+	subl	%r15d, %ecx	# 5671	[c=4 l=3]  *subsi_1/0
+	movzbl	61(%rax), %edx	# 5669	[c=13 l=4]  *zero_extendqisi2/0
+	cmpl	%r14d, %ecx	# 5672	[c=4 l=3]  *cmpsi_1/0
+	jb	.L588	# 5673	[c=13 l=6]  *jcc
+	cmpb	$1, 1081(%r13)	# 5677	[c=13 l=8]  *cmpqi_1/0
+	jbe	.L588	# 5678	[c=13 l=6]  *jcc
+	jmp	.L589	# 20156	[c=1 l=5]  jump
+.L377:
+	movq	1040(%r13), %rax	# 2424	[c=9 l=7]  *movdi_internal/3
+	movl	$62, %esi	# 2426	[c=4 l=5]  *movsi_internal/0
+	subl	%ecx, %esi	# 2427	[c=4 l=2]  *subsi_1/0
+	movzbl	61(%rax), %r15d	# 2425	[c=13 l=5]  *zero_extendqisi2/0
+	cmpl	%r14d, %esi	# 2428	[c=4 l=3]  *cmpsi_1/0
+	jb	.L379	# 2429	[c=13 l=6]  *jcc
+	cmpb	$1, 1081(%r13)	# 2433	[c=13 l=8]  *cmpqi_1/0
+	jbe	.L379	# 2434	[c=13 l=6]  *jcc
+	jmp	.L380	# 20159	[c=1 l=5]  jump
+.L781:
+	movq	1040(%r13), %rax	# 9164	[c=9 l=7]  *movdi_internal/3
+	movl	$62, %esi	# 9166	[c=4 l=5]  *movsi_internal/0
+	subl	%ecx, %esi	# 9167	[c=4 l=2]  *subsi_1/0
+	movzbl	61(%rax), %edx	# 9165	[c=13 l=4]  *zero_extendqisi2/0
+	cmpl	%r15d, %esi	# 9168	[c=4 l=3]  *cmpsi_1/0
+	jb	.L783	# 9169	[c=13 l=6]  *jcc
+	cmpb	$1, 1081(%r13)	# 9173	[c=13 l=8]  *cmpqi_1/0
+	jbe	.L783	# 9174	[c=13 l=6]  *jcc
+	jmp	.L784	# 20162	[c=1 l=5]  jump
+.L838:
+	movq	1040(%r13), %rax	# 9898	[c=9 l=7]  *movdi_internal/3
+	movl	$62, %ecx	# 9900	[c=4 l=5]  *movsi_internal/0
+	subl	%r15d, %ecx	# 9901	[c=4 l=3]  *subsi_1/0
+	movzbl	61(%rax), %edx	# 9899	[c=13 l=4]  *zero_extendqisi2/0
+	cmpl	%r14d, %ecx	# 9902	[c=4 l=3]  *cmpsi_1/0
+	jb	.L840	# 9903	[c=13 l=6]  *jcc
+	cmpb	$1, 1081(%r13)	# 9907	[c=13 l=8]  *cmpqi_1/0
+	jbe	.L840	# 9908	[c=13 l=6]  *jcc
+	jmp	.L841	# 20165	[c=1 l=5]  jump
+.L797:
+	movq	1040(%r13), %rax	# 9398	[c=9 l=7]  *movdi_internal/3
+	movzbl	61(%rax), %r14d	# 9399	[c=13 l=5]  *zero_extendqisi2/0
+	cmpl	%ecx, %edx	# 9400	[c=4 l=2]  *cmpsi_1/0
+	jb	.L799	# 9401	[c=13 l=6]  *jcc
+	cmpb	$1, 1081(%r13)	# 9405	[c=13 l=8]  *cmpqi_1/0
+	jbe	.L799	# 9406	[c=13 l=6]  *jcc
+	jmp	.L800	# 20168	[c=1 l=5]  jump
+.L864:
+	movq	1040(%r13), %rax	# 10192	[c=9 l=7]  *movdi_internal/3
+	movl	$62, %ecx	# 10194	[c=4 l=5]  *movsi_internal/0
+	subl	%r15d, %ecx	# 10195	[c=4 l=3]  *subsi_1/0
+	movzbl	61(%rax), %edx	# 10193	[c=13 l=4]  *zero_extendqisi2/0
+	cmpl	%r14d, %ecx	# 10196	[c=4 l=3]  *cmpsi_1/0
+	jb	.L866	# 10197	[c=13 l=6]  *jcc
+	cmpb	$1, 1081(%r13)	# 10201	[c=13 l=8]  *cmpqi_1/0
+	jbe	.L866	# 10202	[c=13 l=6]  *jcc
+	jmp	.L867	# 20171	[c=1 l=5]  jump
+.L812:
+	movq	1040(%r13), %rax	# 9587	[c=9 l=7]  *movdi_internal/3
+	movl	$62, %esi	# 9589	[c=4 l=5]  *movsi_internal/0
+	subl	%ecx, %esi	# 9590	[c=4 l=2]  *subsi_1/0
+	movzbl	61(%rax), %r15d	# 9588	[c=13 l=5]  *zero_extendqisi2/0
+	cmpl	%r14d, %esi	# 9591	[c=4 l=3]  *cmpsi_1/0
+	jb	.L814	# 9592	[c=13 l=6]  *jcc
+	cmpb	$1, 1081(%r13)	# 9596	[c=13 l=8]  *cmpqi_1/0
+	jbe	.L814	# 9597	[c=13 l=6]  *jcc
+	jmp	.L815	# 20174	[c=1 l=5]  jump
+.L1451:
+	movb	$1, 11032(%r13)	# 5119	[c=4 l=8]  *movqi_internal/8
+	movzbl	11037(%r13), %esi	# 5120	[c=13 l=8]  *zero_extendqisi2/0
+	movq	%r13, %rdi	# 5122	[c=4 l=3]  *movdi_internal/3
+	call	execute_lean@PLT	# 5123	[c=0 l=5]  *call
+	movq	%r13, %rdi	# 5124	[c=4 l=3]  *movdi_internal/3
+	call	perf_lean_resume@PLT	# 5125	[c=0 l=5]  *call
+	jmp	.L557	# 20176	[c=1 l=5]  jump
+.L1450:
+	movq	%r13, %rdi	# 5109	[c=4 l=3]  *movdi_internal/3
+	call	do_events	# 5110	[c=0 l=5]  *call
+	jmp	.L556	# 20178	[c=1 l=5]  jump
+.L1449:
+	sarl	$16, %r15d	# 5066	[c=4 l=4]  *ashrsi3_1/0
+	movl	$59, %edx	# 5069	[c=4 l=5]  *movsi_internal/0
+	leaq	.LC29(%rip), %rsi	# 5070	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 5072	[c=4 l=3]  *movdi_internal/3
+	movzbl	%r15b, %ecx	# 5067	[c=4 l=4]  *zero_extendqisi2/0
+	call	log_add_data_mov@PLT	# 5073	[c=0 l=5]  *call
+	movl	$59, %eax	# 5074	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 5075	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 5076	[c=13 l=7]  *cmpsi_1/1
+	jb	.L554	# 5077	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%r13)	# 5079	[c=13 l=8]  *cmpqi_ccno_1/1
+	jne	.L555	# 5080	[c=13 l=6]  *jcc
+.L554:
+	movq	1040(%r13), %rax	# 5083	[c=9 l=7]  *movdi_internal/3
+	movb	%r15b, 59(%rax)	# 5084	[c=4 l=4]  *movqi_internal/8
+	jmp	.L553	# 20180	[c=1 l=5]  jump
+.L1467:
+	movb	$1, 11032(%r13)	# 6011	[c=4 l=8]  *movqi_internal/8
+	movzbl	11037(%r13), %esi	# 6012	[c=13 l=8]  *zero_extendqisi2/0
+	movq	%r13, %rdi	# 6014	[c=4 l=3]  *movdi_internal/3
+	call	execute_lean@PLT	# 6015	[c=0 l=5]  *call
+	movq	%r13, %rdi	# 6016	[c=4 l=3]  *movdi_internal/3
+	call	perf_lean_resume@PLT	# 6017	[c=0 l=5]  *call
+	jmp	.L615	# 20182	[c=1 l=5]  jump
+.L1466:
+	movq	%r13, %rdi	# 6001	[c=4 l=3]  *movdi_internal/3
+	call	do_events	# 6002	[c=0 l=5]  *call
+	jmp	.L614	# 20184	[c=1 l=5]  jump
+.L1529:
+	movb	$1, 11032(%r13)	# 10488	[c=4 l=8]  *movqi_internal/8
+	movzbl	11037(%r13), %esi	# 10489	[c=13 l=8]  *zero_extendqisi2/0
+	movq	%r13, %rdi	# 10491	[c=4 l=3]  *movdi_internal/3
+	call	execute_lean@PLT	# 10492	[c=0 l=5]  *call
+	movq	%r13, %rdi	# 10493	[c=4 l=3]  *movdi_internal/3
+	call	perf_lean_resume@PLT	# 10494	[c=0 l=5]  *call
+	jmp	.L894	# 20186	[c=1 l=5]  jump
+.L1528:
+	movq	%r13, %rdi	# 10478	[c=4 l=3]  *movdi_internal/3
+	call	do_events	# 10479	[c=0 l=5]  *call
+	jmp	.L893	# 20188	[c=1 l=5]  jump
+.L1472:
+	movb	$1, 11032(%r13)	# 6313	[c=4 l=8]  *movqi_internal/8
+	movzbl	11037(%r13), %esi	# 6314	[c=13 l=8]  *zero_extendqisi2/0
+	movq	%r13, %rdi	# 6316	[c=4 l=3]  *movdi_internal/3
+	call	execute_lean@PLT	# 6317	[c=0 l=5]  *call
+	movq	%r13, %rdi	# 6318	[c=4 l=3]  *movdi_internal/3
+	call	perf_lean_resume@PLT	# 6319	[c=0 l=5]  *call
+	jmp	.L633	# 20190	[c=1 l=5]  jump
+.L1412:
+	movb	$1, 11032(%r13)	# 2682	[c=4 l=8]  *movqi_internal/8
+	movzbl	11037(%r13), %esi	# 2683	[c=13 l=8]  *zero_extendqisi2/0
+	movq	%r13, %rdi	# 2685	[c=4 l=3]  *movdi_internal/3
+	call	execute_lean@PLT	# 2686	[c=0 l=5]  *call
+	movq	%r13, %rdi	# 2687	[c=4 l=3]  *movdi_internal/3
+	call	perf_lean_resume@PLT	# 2688	[c=0 l=5]  *call
+	jmp	.L402	# 20192	[c=1 l=5]  jump
+.L1411:
+	movq	%r13, %rdi	# 2672	[c=4 l=3]  *movdi_internal/3
+	call	do_events	# 2673	[c=0 l=5]  *call
+	jmp	.L401	# 20194	[c=1 l=5]  jump
+.L1425:
+	movb	$1, 11032(%r13)	# 3521	[c=4 l=8]  *movqi_internal/8
+	movzbl	11037(%r13), %esi	# 3522	[c=13 l=8]  *zero_extendqisi2/0
+	movq	%r13, %rdi	# 3524	[c=4 l=3]  *movdi_internal/3
+	call	execute_lean@PLT	# 3525	[c=0 l=5]  *call
+	movq	%r13, %rdi	# 3526	[c=4 l=3]  *movdi_internal/3
+	call	perf_lean_resume@PLT	# 3527	[c=0 l=5]  *call
+	jmp	.L451	# 20196	[c=1 l=5]  jump
+.L1558:
+	movq	%r13, %rdi	# 11760	[c=4 l=3]  *movdi_internal/3
+	call	do_events	# 11761	[c=0 l=5]  *call
+	jmp	.L971	# 20198	[c=1 l=5]  jump
+.L1554:
+	movq	%r13, %rdi	# 11662	[c=4 l=3]  *movdi_internal/3
+	call	do_events	# 11663	[c=0 l=5]  *call
+	jmp	.L966	# 20200	[c=1 l=5]  jump
+.L1551:
+	movb	$1, 11032(%r13)	# 11574	[c=4 l=8]  *movqi_internal/8
+	movzbl	11037(%r13), %esi	# 11575	[c=13 l=8]  *zero_extendqisi2/0
+	movq	%r13, %rdi	# 11577	[c=4 l=3]  *movdi_internal/3
+	call	execute_lean@PLT	# 11578	[c=0 l=5]  *call
+	movq	%r13, %rdi	# 11579	[c=4 l=3]  *movdi_internal/3
+	call	perf_lean_resume@PLT	# 11580	[c=0 l=5]  *call
+	jmp	.L962	# 20202	[c=1 l=5]  jump
+.L1548:
+	movb	$1, 11032(%r13)	# 11467	[c=4 l=8]  *movqi_internal/8
+	movzbl	11037(%r13), %esi	# 11468	[c=13 l=8]  *zero_extendqisi2/0
+	movq	%r13, %rdi	# 11470	[c=4 l=3]  *movdi_internal/3
+	call	execute_lean@PLT	# 11471	[c=0 l=5]  *call
+	movq	%r13, %rdi	# 11472	[c=4 l=3]  *movdi_internal/3
+	call	perf_lean_resume@PLT	# 11473	[c=0 l=5]  *call
+	jmp	.L954	# 20204	[c=1 l=5]  jump
+.L1542:
+	movb	$1, 11032(%r13)	# 11253	[c=4 l=8]  *movqi_internal/8
+	movzbl	11037(%r13), %esi	# 11254	[c=13 l=8]  *zero_extendqisi2/0
+	movq	%r13, %rdi	# 11256	[c=4 l=3]  *movdi_internal/3
+	call	execute_lean@PLT	# 11257	[c=0 l=5]  *call
+	movq	%r13, %rdi	# 11258	[c=4 l=3]  *movdi_internal/3
+	call	perf_lean_resume@PLT	# 11259	[c=0 l=5]  *call
+	jmp	.L938	# 20206	[c=1 l=5]  jump
+.L1544:
+	movq	%r13, %rdi	# 11350	[c=4 l=3]  *movdi_internal/3
+	call	do_events	# 11351	[c=0 l=5]  *call
+	jmp	.L945	# 20208	[c=1 l=5]  jump
+.L1541:
+	movq	%r13, %rdi	# 11243	[c=4 l=3]  *movdi_internal/3
+	call	do_events	# 11244	[c=0 l=5]  *call
+	jmp	.L937	# 20210	[c=1 l=5]  jump
+.L1550:
+	movq	%r13, %rdi	# 11564	[c=4 l=3]  *movdi_internal/3
+	call	do_events	# 11565	[c=0 l=5]  *call
+	jmp	.L961	# 20212	[c=1 l=5]  jump
+.L1547:
+	movq	%r13, %rdi	# 11457	[c=4 l=3]  *movdi_internal/3
+	call	do_events	# 11458	[c=0 l=5]  *call
+	jmp	.L953	# 20214	[c=1 l=5]  jump
+.L1545:
+	movb	$1, 11032(%r13)	# 11360	[c=4 l=8]  *movqi_internal/8
+	movzbl	11037(%r13), %esi	# 11361	[c=13 l=8]  *zero_extendqisi2/0
+	movq	%r13, %rdi	# 11363	[c=4 l=3]  *movdi_internal/3
+	call	execute_lean@PLT	# 11364	[c=0 l=5]  *call
+	movq	%r13, %rdi	# 11365	[c=4 l=3]  *movdi_internal/3
+	call	perf_lean_resume@PLT	# 11366	[c=0 l=5]  *call
+	jmp	.L946	# 20216	[c=1 l=5]  jump
+.L1569:
+	movb	$1, 11032(%r13)	# 12068	[c=4 l=8]  *movqi_internal/8
+	movzbl	11037(%r13), %esi	# 12069	[c=13 l=8]  *zero_extendqisi2/0
+	movq	%r13, %rdi	# 12071	[c=4 l=3]  *movdi_internal/3
+	call	execute_lean@PLT	# 12072	[c=0 l=5]  *call
+	movq	%r13, %rdi	# 12073	[c=4 l=3]  *movdi_internal/3
+	call	perf_lean_resume@PLT	# 12074	[c=0 l=5]  *call
+	jmp	.L988	# 20218	[c=1 l=5]  jump
+.L1568:
+	movq	%r13, %rdi	# 12058	[c=4 l=3]  *movdi_internal/3
+	call	do_events	# 12059	[c=0 l=5]  *call
+	jmp	.L987	# 20220	[c=1 l=5]  jump
+.L1567:
+	movb	$1, 11032(%r13)	# 11966	[c=4 l=8]  *movqi_internal/8
+	movzbl	11037(%r13), %esi	# 11967	[c=13 l=8]  *zero_extendqisi2/0
+	movq	%r13, %rdi	# 11969	[c=4 l=3]  *movdi_internal/3
+	call	execute_lean@PLT	# 11970	[c=0 l=5]  *call
+	movq	%r13, %rdi	# 11971	[c=4 l=3]  *movdi_internal/3
+	call	perf_lean_resume@PLT	# 11972	[c=0 l=5]  *call
+	jmp	.L982	# 20222	[c=1 l=5]  jump
+.L1563:
+	movb	$1, 11032(%r13)	# 11868	[c=4 l=8]  *movqi_internal/8
+	movzbl	11037(%r13), %esi	# 11869	[c=13 l=8]  *zero_extendqisi2/0
+	movq	%r13, %rdi	# 11871	[c=4 l=3]  *movdi_internal/3
+	call	execute_lean@PLT	# 11872	[c=0 l=5]  *call
+	movq	%r13, %rdi	# 11873	[c=4 l=3]  *movdi_internal/3
+	call	perf_lean_resume@PLT	# 11874	[c=0 l=5]  *call
+	jmp	.L977	# 20224	[c=1 l=5]  jump
+.L1555:
+	movb	$1, 11032(%r13)	# 11672	[c=4 l=8]  *movqi_internal/8
+	movzbl	11037(%r13), %esi	# 11673	[c=13 l=8]  *zero_extendqisi2/0
+	movq	%r13, %rdi	# 11675	[c=4 l=3]  *movdi_internal/3
+	call	execute_lean@PLT	# 11676	[c=0 l=5]  *call
+	movq	%r13, %rdi	# 11677	[c=4 l=3]  *movdi_internal/3
+	call	perf_lean_resume@PLT	# 11678	[c=0 l=5]  *call
+	jmp	.L967	# 20226	[c=1 l=5]  jump
+.L1566:
+	movq	%r13, %rdi	# 11956	[c=4 l=3]  *movdi_internal/3
+	call	do_events	# 11957	[c=0 l=5]  *call
+	jmp	.L981	# 20228	[c=1 l=5]  jump
+.L1562:
+	movq	%r13, %rdi	# 11858	[c=4 l=3]  *movdi_internal/3
+	call	do_events	# 11859	[c=0 l=5]  *call
+	jmp	.L976	# 20230	[c=1 l=5]  jump
+.L1559:
+	movb	$1, 11032(%r13)	# 11770	[c=4 l=8]  *movqi_internal/8
+	movzbl	11037(%r13), %esi	# 11771	[c=13 l=8]  *zero_extendqisi2/0
+	movq	%r13, %rdi	# 11773	[c=4 l=3]  *movdi_internal/3
+	call	execute_lean@PLT	# 11774	[c=0 l=5]  *call
+	movq	%r13, %rdi	# 11775	[c=4 l=3]  *movdi_internal/3
+	call	perf_lean_resume@PLT	# 11776	[c=0 l=5]  *call
+	jmp	.L972	# 20232	[c=1 l=5]  jump
+.L1471:
+	movq	%r13, %rdi	# 6303	[c=4 l=3]  *movdi_internal/3
+	call	do_events	# 6304	[c=0 l=5]  *call
+	jmp	.L632	# 20234	[c=1 l=5]  jump
+.L1443:
+	movb	$1, 11032(%r13)	# 4312	[c=4 l=8]  *movqi_internal/8
+	movzbl	11037(%r13), %esi	# 4313	[c=13 l=8]  *zero_extendqisi2/0
+	movq	%r13, %rdi	# 4315	[c=4 l=3]  *movdi_internal/3
+	call	execute_lean@PLT	# 4316	[c=0 l=5]  *call
+	movq	%r13, %rdi	# 4317	[c=4 l=3]  *movdi_internal/3
+	call	perf_lean_resume@PLT	# 4318	[c=0 l=5]  *call
+	jmp	.L505	# 20236	[c=1 l=5]  jump
+.L1442:
+	movq	%r13, %rdi	# 4302	[c=4 l=3]  *movdi_internal/3
+	call	do_events	# 4303	[c=0 l=5]  *call
+	jmp	.L504	# 20238	[c=1 l=5]  jump
+.L1532:
+	movb	$1, 11032(%r13)	# 10565	[c=4 l=8]  *movqi_internal/8
+	movzbl	11037(%r13), %esi	# 10566	[c=13 l=8]  *zero_extendqisi2/0
+	movq	%r13, %rdi	# 10568	[c=4 l=3]  *movdi_internal/3
+	call	execute_lean@PLT	# 10569	[c=0 l=5]  *call
+	movq	%r13, %rdi	# 10570	[c=4 l=3]  *movdi_internal/3
+	call	perf_lean_resume@PLT	# 10571	[c=0 l=5]  *call
+	jmp	.L898	# 20240	[c=1 l=5]  jump
+.L1531:
+	movq	%r13, %rdi	# 10555	[c=4 l=3]  *movdi_internal/3
+	call	do_events	# 10556	[c=0 l=5]  *call
+	jmp	.L897	# 20242	[c=1 l=5]  jump
+.L1404:
+	movb	$1, 11032(%r13)	# 2149	[c=4 l=8]  *movqi_internal/8
+	movzbl	11037(%r13), %esi	# 2150	[c=13 l=8]  *zero_extendqisi2/0
+	movq	%r13, %rdi	# 2152	[c=4 l=3]  *movdi_internal/3
+	call	execute_lean@PLT	# 2153	[c=0 l=5]  *call
+	movq	%r13, %rdi	# 2154	[c=4 l=3]  *movdi_internal/3
+	call	perf_lean_resume@PLT	# 2155	[c=0 l=5]  *call
+	jmp	.L360	# 20244	[c=1 l=5]  jump
+.L1403:
+	movq	%r13, %rdi	# 2139	[c=4 l=3]  *movdi_internal/3
+	call	do_events	# 2140	[c=0 l=5]  *call
+	jmp	.L359	# 20246	[c=1 l=5]  jump
+.L1402:
+	movb	$1, 11032(%r13)	# 2045	[c=4 l=8]  *movqi_internal/8
+	movzbl	11037(%r13), %esi	# 2046	[c=13 l=8]  *zero_extendqisi2/0
+	movq	%r13, %rdi	# 2048	[c=4 l=3]  *movdi_internal/3
+	call	execute_lean@PLT	# 2049	[c=0 l=5]  *call
+	movq	%r13, %rdi	# 2050	[c=4 l=3]  *movdi_internal/3
+	call	perf_lean_resume@PLT	# 2051	[c=0 l=5]  *call
+	jmp	.L353	# 20248	[c=1 l=5]  jump
+.L1401:
+	movq	%r13, %rdi	# 2035	[c=4 l=3]  *movdi_internal/3
+	call	do_events	# 2036	[c=0 l=5]  *call
+	jmp	.L352	# 20250	[c=1 l=5]  jump
+.L1400:
+	movb	$1, 11032(%r13)	# 1941	[c=4 l=8]  *movqi_internal/8
+	movzbl	11037(%r13), %esi	# 1942	[c=13 l=8]  *zero_extendqisi2/0
+	movq	%r13, %rdi	# 1944	[c=4 l=3]  *movdi_internal/3
+	call	execute_lean@PLT	# 1945	[c=0 l=5]  *call
+	movq	%r13, %rdi	# 1946	[c=4 l=3]  *movdi_internal/3
+	call	perf_lean_resume@PLT	# 1947	[c=0 l=5]  *call
+	jmp	.L346	# 20252	[c=1 l=5]  jump
+.L1399:
+	movq	%r13, %rdi	# 1931	[c=4 l=3]  *movdi_internal/3
+	call	do_events	# 1932	[c=0 l=5]  *call
+	jmp	.L345	# 20254	[c=1 l=5]  jump
+.L1517:
+	movb	$1, 11032(%r13)	# 9840	[c=4 l=8]  *movqi_internal/8
+	movzbl	11037(%r13), %esi	# 9841	[c=13 l=8]  *zero_extendqisi2/0
+	movq	%r13, %rdi	# 9843	[c=4 l=3]  *movdi_internal/3
+	call	execute_lean@PLT	# 9844	[c=0 l=5]  *call
+	movq	%r13, %rdi	# 9845	[c=4 l=3]  *movdi_internal/3
+	call	perf_lean_resume@PLT	# 9846	[c=0 l=5]  *call
+	jmp	.L836	# 20256	[c=1 l=5]  jump
+.L1516:
+	movq	%r13, %rdi	# 9830	[c=4 l=3]  *movdi_internal/3
+	call	do_events	# 9831	[c=0 l=5]  *call
+	jmp	.L835	# 20258	[c=1 l=5]  jump
+.L1439:
+	movb	$1, 11032(%r13)	# 4180	[c=4 l=8]  *movqi_internal/8
+	movzbl	11037(%r13), %esi	# 4181	[c=13 l=8]  *zero_extendqisi2/0
+	movq	%r13, %rdi	# 4183	[c=4 l=3]  *movdi_internal/3
+	call	execute_lean@PLT	# 4184	[c=0 l=5]  *call
+	movq	%r13, %rdi	# 4185	[c=4 l=3]  *movdi_internal/3
+	call	perf_lean_resume@PLT	# 4186	[c=0 l=5]  *call
+	jmp	.L497	# 20260	[c=1 l=5]  jump
+.L1438:
+	movq	%r13, %rdi	# 4170	[c=4 l=3]  *movdi_internal/3
+	call	do_events	# 4171	[c=0 l=5]  *call
+	jmp	.L496	# 20262	[c=1 l=5]  jump
+.L1424:
+	movq	%r13, %rdi	# 3511	[c=4 l=3]  *movdi_internal/3
+	call	do_events	# 3512	[c=0 l=5]  *call
+	jmp	.L450	# 20264	[c=1 l=5]  jump
+.L1464:
+	movb	$1, 11032(%r13)	# 5934	[c=4 l=8]  *movqi_internal/8
+	movzbl	11037(%r13), %esi	# 5935	[c=13 l=8]  *zero_extendqisi2/0
+	movq	%r13, %rdi	# 5937	[c=4 l=3]  *movdi_internal/3
+	call	execute_lean@PLT	# 5938	[c=0 l=5]  *call
+	movq	%r13, %rdi	# 5939	[c=4 l=3]  *movdi_internal/3
+	call	perf_lean_resume@PLT	# 5940	[c=0 l=5]  *call
+	jmp	.L611	# 20266	[c=1 l=5]  jump
+.L1463:
+	movq	%r13, %rdi	# 5924	[c=4 l=3]  *movdi_internal/3
+	call	do_events	# 5925	[c=0 l=5]  *call
+	jmp	.L610	# 20268	[c=1 l=5]  jump
+.L1523:
+	movb	$1, 11032(%r13)	# 10134	[c=4 l=8]  *movqi_internal/8
+	movzbl	11037(%r13), %esi	# 10135	[c=13 l=8]  *zero_extendqisi2/0
+	movq	%r13, %rdi	# 10137	[c=4 l=3]  *movdi_internal/3
+	call	execute_lean@PLT	# 10138	[c=0 l=5]  *call
+	movq	%r13, %rdi	# 10139	[c=4 l=3]  *movdi_internal/3
+	call	perf_lean_resume@PLT	# 10140	[c=0 l=5]  *call
+	jmp	.L862	# 20270	[c=1 l=5]  jump
+.L1522:
+	movq	%r13, %rdi	# 10124	[c=4 l=3]  *movdi_internal/3
+	call	do_events	# 10125	[c=0 l=5]  *call
+	jmp	.L861	# 20272	[c=1 l=5]  jump
+.L1430:
+	movb	$1, 11032(%r13)	# 3643	[c=4 l=8]  *movqi_internal/8
+	movzbl	11037(%r13), %esi	# 3644	[c=13 l=8]  *zero_extendqisi2/0
+	movq	%r13, %rdi	# 3646	[c=4 l=3]  *movdi_internal/3
+	call	execute_lean@PLT	# 3647	[c=0 l=5]  *call
+	movq	%r13, %rdi	# 3648	[c=4 l=3]  *movdi_internal/3
+	call	perf_lean_resume@PLT	# 3649	[c=0 l=5]  *call
+	jmp	.L457	# 20274	[c=1 l=5]  jump
+.L1429:
+	movq	%r13, %rdi	# 3633	[c=4 l=3]  *movdi_internal/3
+	call	do_events	# 3634	[c=0 l=5]  *call
+	jmp	.L456	# 20276	[c=1 l=5]  jump
+.L1510:
+	movzbl	%r14b, %edx	# 9491	[c=4 l=4]  *zero_extendqisi2/0
+	movl	$61, %esi	# 9493	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 9494	[c=4 l=3]  *movdi_internal/3
+	call	data_write_mapped	# 9495	[c=0 l=5]  *call
+	jmp	.L808	# 20278	[c=1 l=5]  jump
+.L1511:
+	movl	%r15d, %edx	# 9515	[c=4 l=3]  *movsi_internal/0
+	movl	$62, %esi	# 9516	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 9517	[c=4 l=3]  *movdi_internal/3
+	call	data_write_mapped	# 9518	[c=0 l=5]  *call
+	jmp	.L810	# 20280	[c=1 l=5]  jump
+.L1505:
+	movl	%r15d, %edx	# 9239	[c=4 l=3]  *movsi_internal/0
+	movl	$62, %esi	# 9240	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 9241	[c=4 l=3]  *movdi_internal/3
+	movl	%r8d, 8(%rsp)	# 17982	[c=4 l=5]  *movsi_internal/1
+	call	data_write_mapped	# 9242	[c=0 l=5]  *call
+	movl	8(%rsp), %r8d	# 17983	[c=9 l=5]  *movsi_internal/0
+	jmp	.L789	# 20282	[c=1 l=5]  jump
+.L1461:
+	movl	%r15d, %edx	# 5876	[c=4 l=3]  *movsi_internal/0
+	movl	$62, %esi	# 5877	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 5878	[c=4 l=3]  *movdi_internal/3
+	call	data_write_mapped	# 5879	[c=0 l=5]  *call
+	jmp	.L608	# 20284	[c=1 l=5]  jump
+.L1514:
+	movzbl	%r14b, %edx	# 9771	[c=4 l=4]  *zero_extendqisi2/0
+	movl	$61, %esi	# 9773	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 9774	[c=4 l=3]  *movdi_internal/3
+	call	data_write_mapped	# 9775	[c=0 l=5]  *call
+	jmp	.L832	# 20286	[c=1 l=5]  jump
+.L1515:
+	movl	%eax, %edx	# 9795	[c=4 l=2]  *movsi_internal/0
+	movl	$62, %esi	# 9796	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 9797	[c=4 l=3]  *movdi_internal/3
+	call	data_write_mapped	# 9798	[c=0 l=5]  *call
+	jmp	.L834	# 20288	[c=1 l=5]  jump
+.L1520:
+	movzbl	%r8b, %edx	# 10071	[c=4 l=4]  *zero_extendqisi2/0
+	movl	$61, %esi	# 10073	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 10074	[c=4 l=3]  *movdi_internal/3
+	call	data_write_mapped	# 10075	[c=0 l=5]  *call
+	jmp	.L858	# 20290	[c=1 l=5]  jump
+.L1521:
+	movl	%r15d, %edx	# 10095	[c=4 l=3]  *movsi_internal/0
+	movl	$62, %esi	# 10096	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 10097	[c=4 l=3]  *movdi_internal/3
+	call	data_write_mapped	# 10098	[c=0 l=5]  *call
+	jmp	.L860	# 20292	[c=1 l=5]  jump
+.L1504:
+	movzbl	%r8b, %edx	# 9215	[c=4 l=4]  *zero_extendqisi2/0
+	movl	$61, %esi	# 9217	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 9218	[c=4 l=3]  *movdi_internal/3
+	call	data_write_mapped	# 9219	[c=0 l=5]  *call
+	movl	8(%rsp), %r8d	# 17979	[c=9 l=5]  *movsi_internal/0
+	jmp	.L787	# 20294	[c=1 l=5]  jump
+.L1436:
+	movl	%r15d, %edx	# 4097	[c=4 l=3]  *movsi_internal/0
+	movl	$62, %esi	# 4098	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 4099	[c=4 l=3]  *movdi_internal/3
+	call	data_write_mapped	# 4100	[c=0 l=5]  *call
+	jmp	.L491	# 20296	[c=1 l=5]  jump
+.L1435:
+	movzbl	%r14b, %edx	# 4073	[c=4 l=4]  *zero_extendqisi2/0
+	movl	$61, %esi	# 4075	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 4076	[c=4 l=3]  *movdi_internal/3
+	call	data_write_mapped	# 4077	[c=0 l=5]  *call
+	jmp	.L489	# 20298	[c=1 l=5]  jump
+.L1409:
+	movl	%eax, %edx	# 2632	[c=4 l=2]  *movsi_internal/0
+	movl	$62, %esi	# 2633	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 2634	[c=4 l=3]  *movdi_internal/3
+	call	data_write_mapped	# 2635	[c=0 l=5]  *call
+	jmp	.L399	# 20300	[c=1 l=5]  jump
+.L1408:
+	movzbl	%r14b, %edx	# 2608	[c=4 l=4]  *zero_extendqisi2/0
+	movl	$61, %esi	# 2610	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 2611	[c=4 l=3]  *movdi_internal/3
+	call	data_write_mapped	# 2612	[c=0 l=5]  *call
+	jmp	.L397	# 20302	[c=1 l=5]  jump
+.L1460:
+	movzbl	%r14b, %edx	# 5852	[c=4 l=4]  *zero_extendqisi2/0
+	movl	$61, %esi	# 5854	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 5855	[c=4 l=3]  *movdi_internal/3
+	call	data_write_mapped	# 5856	[c=0 l=5]  *call
+	jmp	.L606	# 20304	[c=1 l=5]  jump
+.L1526:
+	movzbl	%r8b, %edx	# 10365	[c=4 l=4]  *zero_extendqisi2/0
+	movl	$61, %esi	# 10367	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 10368	[c=4 l=3]  *movdi_internal/3
+	call	data_write_mapped	# 10369	[c=0 l=5]  *call
+	jmp	.L884	# 20306	[c=1 l=5]  jump
+.L1527:
+	movl	%r15d, %edx	# 10389	[c=4 l=3]  *movsi_internal/0
+	movl	$62, %esi	# 10390	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 10391	[c=4 l=3]  *movdi_internal/3
+	call	data_write_mapped	# 10392	[c=0 l=5]  *call
+	jmp	.L886	# 20308	[c=1 l=5]  jump
+.L251:
+	movl	$1, 72(%r13)	# 219	[c=4 l=8]  *movsi_internal/1
+	xorl	%esi, %esi	# 19639	[c=4 l=2]  *movdi_xor
+	movq	%r13, %rdi	# 221	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 222	[c=0 l=5]  *call
+	movl	%ebx, %ecx	# 223	[c=4 l=2]  *movsi_internal/0
+	leaq	.LC37(%rip), %rdx	# 224	[c=1 l=7]  *movdi_internal/4
+	xorl	%eax, %eax	# 19640	[c=4 l=2]  *movdi_xor
+	movl	$8, %esi	# 226	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 227	[c=4 l=3]  *movdi_internal/3
+	call	leave	# 229	[c=0 l=5]  *call
+.L250:
+	movq	832(%r13), %r8	# 208	[c=9 l=7]  *movdi_internal/3
+	movl	%ebx, %ecx	# 209	[c=4 l=2]  *movsi_internal/0
+	movl	$1, %esi	# 212	[c=4 l=5]  *movsi_internal/0
+	xorl	%eax, %eax	# 19641	[c=4 l=2]  *movdi_xor
+	leaq	.LC36(%rip), %rdx	# 210	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 213	[c=4 l=3]  *movdi_internal/3
+	call	leave	# 215	[c=0 l=5]  *call
+.L1592:
+	movb	$1, 11032(%r13)	# 627	[c=4 l=8]  *movqi_internal/8
+	movzbl	11037(%r13), %esi	# 628	[c=13 l=8]  *zero_extendqisi2/0
+	movq	%r13, %rdi	# 630	[c=4 l=3]  *movdi_internal/3
+	call	execute_lean@PLT	# 631	[c=0 l=5]  *call
+	movq	%r13, %rdi	# 632	[c=4 l=3]  *movdi_internal/3
+	call	perf_lean_resume@PLT	# 633	[c=0 l=5]  *call
+	jmp	.L272	# 20310	[c=1 l=5]  jump
+.L1591:
+	movq	%r13, %rdi	# 617	[c=4 l=3]  *movdi_internal/3
+	call	do_events	# 618	[c=0 l=5]  *call
+	jmp	.L271	# 20312	[c=1 l=5]  jump
+.L1389:
+	movl	%ebx, %ecx	# 197	[c=4 l=2]  *movsi_internal/0
+	leaq	.LC35(%rip), %rdx	# 198	[c=1 l=7]  *movdi_internal/4
+	movl	$1, %esi	# 200	[c=4 l=5]  *movsi_internal/0
+	xorl	%eax, %eax	# 19642	[c=4 l=2]  *movdi_xor
+	movq	%r13, %rdi	# 201	[c=4 l=3]  *movdi_internal/3
+	call	leave	# 203	[c=0 l=5]  *call
+.L791:
+	movl	%r8d, %esi	# 9269	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 9270	[c=4 l=3]  *movdi_internal/3
+	movl	%r8d, 8(%rsp)	# 17984	[c=4 l=5]  *movsi_internal/1
+	call	data_read_page	# 9271	[c=10 l=5]  *call_value
+	movl	8(%rsp), %r8d	# 17985	[c=9 l=5]  *movsi_internal/0
+	movl	%eax, %r15d	# 9272	[c=4 l=3]  *movsi_internal/0
+	jmp	.L792	# 20314	[c=1 l=5]  jump
+.L805:
+	movl	16(%rsp), %edx	# 9468	[c=9 l=4]  *movsi_internal/0
+	movl	%r14d, %esi	# 9469	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 9470	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 9471	[c=0 l=5]  *call
+	jmp	.L806	# 20316	[c=1 l=5]  jump
+.L879:
+	movl	%r8d, %esi	# 10322	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 10323	[c=4 l=3]  *movdi_internal/3
+	movl	%r8d, 8(%rsp)	# 18023	[c=4 l=5]  *movsi_internal/1
+	call	data_read_page	# 10324	[c=10 l=5]  *call_value
+	movl	8(%rsp), %r8d	# 18024	[c=9 l=5]  *movsi_internal/0
+	movl	%eax, %r15d	# 10325	[c=4 l=3]  *movsi_internal/0
+	jmp	.L880	# 20318	[c=1 l=5]  jump
+.L875:
+	movl	%edx, %esi	# 10285	[c=4 l=2]  *movsi_internal/0
+	movq	%r13, %rdi	# 10286	[c=4 l=3]  *movdi_internal/3
+	movl	%r8d, 16(%rsp)	# 18019	[c=4 l=5]  *movsi_internal/1
+	movl	%edx, 8(%rsp)	# 18017	[c=4 l=4]  *movsi_internal/1
+	call	data_read_page	# 10287	[c=10 l=5]  *call_value
+	movl	16(%rsp), %r8d	# 18020	[c=9 l=5]  *movsi_internal/0
+	movl	8(%rsp), %edx	# 18018	[c=9 l=4]  *movsi_internal/0
+	movl	%eax, %r14d	# 10288	[c=4 l=3]  *movsi_internal/0
+	jmp	.L876	# 20320	[c=1 l=5]  jump
+.L888:
+	movl	$63, %esi	# 10419	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 10420	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 10421	[c=10 l=5]  *call_value
+	movl	%eax, %r15d	# 10422	[c=4 l=3]  *movsi_internal/0
+	jmp	.L889	# 20322	[c=1 l=5]  jump
+.L891:
+	movl	%r14d, %edx	# 10456	[c=4 l=3]  *movsi_internal/0
+	movl	$63, %esi	# 10457	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 10458	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 10459	[c=0 l=5]  *call
+	jmp	.L892	# 20324	[c=1 l=5]  jump
+.L824:
+	movl	16(%rsp), %edx	# 9703	[c=9 l=4]  *movsi_internal/0
+	movl	%r9d, %esi	# 9704	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 9705	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 9706	[c=0 l=5]  *call
+	jmp	.L825	# 20326	[c=1 l=5]  jump
+.L820:
+	movl	%r14d, %edx	# 9665	[c=4 l=3]  *movsi_internal/0
+	movl	%r15d, %esi	# 9666	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 9667	[c=4 l=3]  *movdi_internal/3
+	movl	%r9d, 16(%rsp)	# 17995	[c=4 l=5]  *movsi_internal/1
+	call	data_write_page	# 9668	[c=0 l=5]  *call
+	movl	16(%rsp), %r9d	# 17996	[c=9 l=5]  *movsi_internal/0
+	jmp	.L821	# 20328	[c=1 l=5]  jump
+.L385:
+	movl	%r14d, %edx	# 2502	[c=4 l=3]  *movsi_internal/0
+	movl	%r15d, %esi	# 2503	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 2504	[c=4 l=3]  *movdi_internal/3
+	movl	%r9d, 24(%rsp)	# 17752	[c=4 l=5]  *movsi_internal/1
+	call	data_write_page	# 2505	[c=0 l=5]  *call
+	movl	24(%rsp), %r9d	# 17753	[c=9 l=5]  *movsi_internal/0
+	jmp	.L386	# 20330	[c=1 l=5]  jump
+.L598:
+	movl	8(%rsp), %edx	# 5784	[c=9 l=4]  *movsi_internal/0
+	movl	%r9d, %esi	# 5785	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 5786	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 5787	[c=0 l=5]  *call
+	jmp	.L599	# 20332	[c=1 l=5]  jump
+.L594:
+	movl	%r14d, %edx	# 5746	[c=4 l=3]  *movsi_internal/0
+	movl	%r15d, %esi	# 5747	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 5748	[c=4 l=3]  *movdi_internal/3
+	movl	%r9d, 8(%rsp)	# 17866	[c=4 l=5]  *movsi_internal/1
+	call	data_write_page	# 5749	[c=0 l=5]  *call
+	movl	8(%rsp), %r9d	# 17867	[c=9 l=5]  *movsi_internal/0
+	jmp	.L595	# 20334	[c=1 l=5]  jump
+.L477:
+	movl	%r14d, %edx	# 3967	[c=4 l=3]  *movsi_internal/0
+	movl	%r15d, %esi	# 3968	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 3969	[c=4 l=3]  *movdi_internal/3
+	movl	%r9d, 8(%rsp)	# 17803	[c=4 l=5]  *movsi_internal/1
+	call	data_write_page	# 3970	[c=0 l=5]  *call
+	movl	8(%rsp), %r9d	# 17804	[c=9 l=5]  *movsi_internal/0
+	jmp	.L478	# 20336	[c=1 l=5]  jump
+.L389:
+	movl	24(%rsp), %edx	# 2540	[c=9 l=4]  *movsi_internal/0
+	movl	%r9d, %esi	# 2541	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 2542	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 2543	[c=0 l=5]  *call
+	jmp	.L390	# 20338	[c=1 l=5]  jump
+.L853:
+	movl	%r8d, %esi	# 10028	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 10029	[c=4 l=3]  *movdi_internal/3
+	movl	%r8d, 8(%rsp)	# 18009	[c=4 l=5]  *movsi_internal/1
+	call	data_read_page	# 10030	[c=10 l=5]  *call_value
+	movl	8(%rsp), %r8d	# 18010	[c=9 l=5]  *movsi_internal/0
+	movl	%eax, %r15d	# 10031	[c=4 l=3]  *movsi_internal/0
+	jmp	.L854	# 20340	[c=1 l=5]  jump
+.L849:
+	movl	%edx, %esi	# 9991	[c=4 l=2]  *movsi_internal/0
+	movq	%r13, %rdi	# 9992	[c=4 l=3]  *movdi_internal/3
+	movl	%r8d, 16(%rsp)	# 18005	[c=4 l=5]  *movsi_internal/1
+	movl	%edx, 8(%rsp)	# 18003	[c=4 l=4]  *movsi_internal/1
+	call	data_read_page	# 9993	[c=10 l=5]  *call_value
+	movl	16(%rsp), %r8d	# 18006	[c=9 l=5]  *movsi_internal/0
+	movl	8(%rsp), %edx	# 18004	[c=9 l=4]  *movsi_internal/0
+	movl	%eax, %r14d	# 9994	[c=4 l=3]  *movsi_internal/0
+	jmp	.L850	# 20342	[c=1 l=5]  jump
+.L493:
+	movl	$60, %esi	# 4132	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 4133	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 4134	[c=10 l=5]  *call_value
+	movl	%eax, %r15d	# 4135	[c=4 l=3]  *movsi_internal/0
+	jmp	.L494	# 20344	[c=1 l=5]  jump
+.L481:
+	movl	8(%rsp), %edx	# 4005	[c=9 l=4]  *movsi_internal/0
+	movl	%r9d, %esi	# 4006	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 4007	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 4008	[c=0 l=5]  *call
+	jmp	.L482	# 20346	[c=1 l=5]  jump
+.L1448:
+	movl	%r15d, %eax	# 14959	[c=1 l=3]  *zero_extendsidi2/3
+	movq	%rax, 32(%rsp)	# 16992	[c=4 l=5]  *movdi_internal/5
+	jmp	.L546	# 20348	[c=1 l=5]  jump
+.L845:
+	movl	%r15d, %esi	# 9953	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 9954	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 9955	[c=10 l=5]  *call_value
+	movl	%eax, %r14d	# 9956	[c=4 l=3]  *movsi_internal/0
+	jmp	.L846	# 20350	[c=1 l=5]  jump
+.L486:
+	movl	%eax, %edx	# 4047	[c=4 l=2]  *movsi_internal/0
+	movl	%r14d, %esi	# 4048	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 4049	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 4050	[c=0 l=5]  *call
+	jmp	.L487	# 20352	[c=1 l=5]  jump
+.L829:
+	movl	%eax, %edx	# 9745	[c=4 l=2]  *movsi_internal/0
+	movl	%r14d, %esi	# 9746	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 9747	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 9748	[c=0 l=5]  *call
+	jmp	.L830	# 20354	[c=1 l=5]  jump
+.L394:
+	movl	%eax, %edx	# 2582	[c=4 l=2]  *movsi_internal/0
+	movl	%r14d, %esi	# 2583	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 2584	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 2585	[c=0 l=5]  *call
+	jmp	.L395	# 20356	[c=1 l=5]  jump
+.L603:
+	movl	%eax, %edx	# 5826	[c=4 l=2]  *movsi_internal/0
+	movl	%r14d, %esi	# 5827	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 5828	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 5829	[c=0 l=5]  *call
+	jmp	.L604	# 20358	[c=1 l=5]  jump
+.L871:
+	movl	%r15d, %esi	# 10247	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 10248	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 10249	[c=10 l=5]  *call_value
+	movl	%eax, %r14d	# 10250	[c=4 l=3]  *movsi_internal/0
+	jmp	.L872	# 20360	[c=1 l=5]  jump
+.L535:
+	movl	$59, %esi	# 4839	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 4840	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 4841	[c=10 l=5]  *call_value
+	movl	%eax, %r14d	# 4842	[c=4 l=3]  *movsi_internal/0
+	jmp	.L536	# 20362	[c=1 l=5]  jump
+.L555:
+	movl	%r15d, %edx	# 5089	[c=4 l=3]  *movsi_internal/0
+	movl	$59, %esi	# 5090	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 5091	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 5092	[c=0 l=5]  *call
+	jmp	.L553	# 20364	[c=1 l=5]  jump
+.L269:
+	leaq	.LC54(%rip), %rsi	# 538	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 540	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 19611	[c=4 l=2]  *movdi_xor
+	call	log_append@PLT	# 542	[c=0 l=5]  *call
+	jmp	.L264	# 20366	[c=1 l=5]  jump
+.L267:
+	leaq	.LC50(%rip), %rsi	# 420	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 422	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 19618	[c=4 l=2]  *movdi_xor
+	call	log_append@PLT	# 424	[c=0 l=5]  *call
+	movl	$24, %edx	# 427	[c=4 l=5]  *movsi_internal/0
+	xorl	%eax, %eax	# 19619	[c=4 l=2]  *movdi_xor
+	movq	%r13, %rdi	# 430	[c=4 l=3]  *movdi_internal/3
+	movzwl	1028(%r13), %r14d	# 425	[c=13 l=8]  *zero_extendhisi2/0
+	leaq	.LC44(%rip), %rsi	# 428	[c=1 l=7]  *movdi_internal/4
+	movl	%r14d, %ecx	# 426	[c=4 l=3]  *movsi_internal/0
+	call	log_append@PLT	# 432	[c=0 l=5]  *call
+	movl	%r14d, %esi	# 433	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 434	[c=4 l=3]  *movdi_internal/3
+	call	put_argv@PLT	# 435	[c=0 l=5]  *call
+	movl	$1, %ecx	# 437	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 441	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 19620	[c=4 l=2]  *movdi_xor
+	movl	%r14d, 824(%r13)	# 436	[c=4 l=7]  *movsi_internal/1
+	leaq	.LC48(%rip), %r14	# 439	[c=1 l=7]  *movdi_internal/4
+	movl	$20, %edx	# 438	[c=4 l=5]  *movsi_internal/0
+	movq	%r14, %rsi	# 440	[c=4 l=3]  *movdi_internal/3
+	call	log_append@PLT	# 443	[c=0 l=5]  *call
+	movl	$22, %edx	# 450	[c=4 l=5]  *movsi_internal/0
+	movq	%r14, %rsi	# 452	[c=4 l=3]  *movdi_internal/3
+	movq	%r13, %rdi	# 453	[c=4 l=3]  *movdi_internal/3
+	movzwl	.LC49(%rip), %eax	# 444	[c=6 l=7]  *movv2qi_internal/2
+	movzwl	820(%r13), %ecx	# 446	[c=13 l=8]  *zero_extendhisi2/0
+	movw	%ax, 1024(%r13)	# 445	[c=4 l=8]  *movv2qi_internal/3
+	movl	%ecx, %r15d	# 18534	[c=4 l=3]  *movsi_internal/0
+	xorl	%eax, %eax	# 19621	[c=4 l=2]  *movdi_xor
+	call	log_append@PLT	# 455	[c=0 l=5]  *call
+	movl	$24, %edx	# 461	[c=4 l=5]  *movsi_internal/0
+	movq	%r14, %rsi	# 463	[c=4 l=3]  *movdi_internal/3
+	movq	%r13, %rdi	# 464	[c=4 l=3]  *movdi_internal/3
+	movw	%r15w, 1026(%r13)	# 456	[c=4 l=8]  *movhi_internal/3
+	movzwl	816(%r13), %ecx	# 457	[c=13 l=8]  *zero_extendhisi2/0
+	xorl	%eax, %eax	# 19622	[c=4 l=2]  *movdi_xor
+	movl	%ecx, %r15d	# 18535	[c=4 l=3]  *movsi_internal/0
+	call	log_append@PLT	# 466	[c=0 l=5]  *call
+	movw	%r15w, 1028(%r13)	# 467	[c=4 l=8]  *movhi_internal/3
+	jmp	.L264	# 20368	[c=1 l=5]  jump
+.L268:
+	leaq	.LC52(%rip), %rsi	# 504	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 506	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 19614	[c=4 l=2]  *movdi_xor
+	call	log_append@PLT	# 508	[c=0 l=5]  *call
+	jmp	.L264	# 20370	[c=1 l=5]  jump
+.L1595:
+	movq	1040(%r13), %rax	# 14960	[c=9 l=7]  *movdi_internal/3
+	jmp	.L588	# 20372	[c=1 l=5]  jump
+.L1599:
+	movq	1040(%r13), %rax	# 14963	[c=9 l=7]  *movdi_internal/3
+	jmp	.L814	# 20374	[c=1 l=5]  jump
+.L1600:
+	movq	1040(%r13), %rax	# 14961	[c=9 l=7]  *movdi_internal/3
+	jmp	.L783	# 20376	[c=1 l=5]  jump
+.L1597:
+	movq	1040(%r13), %rax	# 14964	[c=9 l=7]  *movdi_internal/3
+	jmp	.L840	# 20378	[c=1 l=5]  jump
+.L1598:
+	movq	1040(%r13), %rax	# 14965	[c=9 l=7]  *movdi_internal/3
+	jmp	.L866	# 20380	[c=1 l=5]  jump
+.L1594:
+	movq	1040(%r13), %rax	# 14962	[c=9 l=7]  *movdi_internal/3
+	jmp	.L799	# 20382	[c=1 l=5]  jump
+.L1596:
+	movq	1040(%r13), %rax	# 14957	[c=9 l=7]  *movdi_internal/3
+	jmp	.L379	# 20384	[c=1 l=5]  jump
+.L1593:
+	movq	1040(%r13), %rax	# 14958	[c=9 l=7]  *movdi_internal/3
+	jmp	.L471	# 20386	[c=1 l=5]  jump
+.L1506:
+	movl	%r14d, %ecx	# 9299	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC60(%rip), %rdx	# 9300	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 9303	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 19301	[c=4 l=2]  *movdi_xor
+	movl	$1, %esi	# 9302	[c=4 l=5]  *movsi_internal/0
+	call	leave	# 9305	[c=0 l=5]  *call
+.L1441:
+	movq	%r13, %rdi	# 4283	[c=4 l=3]  *movdi_internal/3
+	call	bad_PC	# 4284	[c=0 l=5]  *call
+.L1459:
+	movl	%r15d, %esi	# 5709	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 5710	[c=4 l=3]  *movdi_internal/3
+	call	stack_overflow	# 5711	[c=0 l=5]  *call
+.L1513:
+	movl	%r15d, %esi	# 9628	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 9629	[c=4 l=3]  *movdi_internal/3
+	call	stack_overflow	# 9630	[c=0 l=5]  *call
+.L1407:
+	movl	%r15d, %esi	# 2465	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 2466	[c=4 l=3]  *movdi_internal/3
+	call	stack_overflow	# 2467	[c=0 l=5]  *call
+.L1414:
+	movl	%r15d, %ecx	# 2849	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC60(%rip), %rdx	# 2850	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 2853	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 19541	[c=4 l=2]  *movdi_xor
+	movl	$1, %esi	# 2852	[c=4 l=5]  *movsi_internal/0
+	call	leave	# 2855	[c=0 l=5]  *call
+.L1501:
+	movl	%r14d, %ecx	# 8923	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC60(%rip), %rdx	# 8924	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 8927	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 19308	[c=4 l=2]  *movdi_xor
+	movl	$1, %esi	# 8926	[c=4 l=5]  *movsi_internal/0
+	call	leave	# 8929	[c=0 l=5]  *call
+.L1456:
+	movl	%r15d, %ecx	# 5495	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC60(%rip), %rdx	# 5496	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 5499	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 19446	[c=4 l=2]  *movdi_xor
+	movl	$1, %esi	# 5498	[c=4 l=5]  *movsi_internal/0
+	call	leave	# 5501	[c=0 l=5]  *call
+.L1455:
+	movl	%r14d, %ecx	# 5357	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC60(%rip), %rdx	# 5358	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 5361	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 19454	[c=4 l=2]  *movdi_xor
+	movl	$1, %esi	# 5360	[c=4 l=5]  *movsi_internal/0
+	call	leave	# 5363	[c=0 l=5]  *call
+.L1535:
+	movl	%r15d, %ecx	# 10778	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC60(%rip), %rdx	# 10779	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 10782	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 19281	[c=4 l=2]  *movdi_xor
+	movl	$1, %esi	# 10781	[c=4 l=5]  *movsi_internal/0
+	call	leave	# 10784	[c=0 l=5]  *call
+.L1534:
+	movl	%r9d, %ecx	# 10751	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC60(%rip), %rdx	# 10752	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 10755	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 19283	[c=4 l=2]  *movdi_xor
+	movl	$1, %esi	# 10754	[c=4 l=5]  *movsi_internal/0
+	call	leave	# 10757	[c=0 l=5]  *call
+.L1533:
+	movl	%edx, %ecx	# 10618	[c=4 l=2]  *movsi_internal/0
+	movl	$1, %esi	# 10621	[c=4 l=5]  *movsi_internal/0
+	leaq	.LC60(%rip), %rdx	# 10619	[c=1 l=7]  *movdi_internal/4
+	xorl	%eax, %eax	# 19287	[c=4 l=2]  *movdi_xor
+	movq	%r13, %rdi	# 10622	[c=4 l=3]  *movdi_internal/3
+	call	leave	# 10624	[c=0 l=5]  *call
+.L1502:
+	movl	%r15d, %ecx	# 9057	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC60(%rip), %rdx	# 9058	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 9061	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 19304	[c=4 l=2]  *movdi_xor
+	movl	$1, %esi	# 9060	[c=4 l=5]  *movsi_internal/0
+	call	leave	# 9063	[c=0 l=5]  *call
+.L1427:
+	movl	%r14d, %ecx	# 3596	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC60(%rip), %rdx	# 3597	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 3600	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 19515	[c=4 l=2]  *movdi_xor
+	movl	$1, %esi	# 3599	[c=4 l=5]  *movsi_internal/0
+	call	leave	# 3602	[c=0 l=5]  *call
+.L1474:
+	movl	%r14d, %ecx	# 6467	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC60(%rip), %rdx	# 6468	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 6471	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 19420	[c=4 l=2]  *movdi_xor
+	movl	$1, %esi	# 6470	[c=4 l=5]  *movsi_internal/0
+	call	leave	# 6473	[c=0 l=5]  *call
+.L1469:
+	movl	%r14d, %ecx	# 6156	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC60(%rip), %rdx	# 6157	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 6160	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 19429	[c=4 l=2]  *movdi_xor
+	movl	$1, %esi	# 6159	[c=4 l=5]  *movsi_internal/0
+	call	leave	# 6162	[c=0 l=5]  *call
+.L1468:
+	movl	%r14d, %ecx	# 6095	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC60(%rip), %rdx	# 6096	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 6099	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 19432	[c=4 l=2]  *movdi_xor
+	movl	$1, %esi	# 6098	[c=4 l=5]  *movsi_internal/0
+	call	leave	# 6101	[c=0 l=5]  *call
+.L1445:
+	movl	%r14d, %ecx	# 4568	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC60(%rip), %rdx	# 4569	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 4572	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 19487	[c=4 l=2]  *movdi_xor
+	movl	$1, %esi	# 4571	[c=4 l=5]  *movsi_internal/0
+	call	leave	# 4574	[c=0 l=5]  *call
+.L1444:
+	movl	%r14d, %ecx	# 4464	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC60(%rip), %rdx	# 4465	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 4468	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 19491	[c=4 l=2]  *movdi_xor
+	movl	$1, %esi	# 4467	[c=4 l=5]  *movsi_internal/0
+	call	leave	# 4470	[c=0 l=5]  *call
+.L1454:
+	movl	%r15d, %ecx	# 5331	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC60(%rip), %rdx	# 5332	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 5335	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 19456	[c=4 l=2]  *movdi_xor
+	movl	$1, %esi	# 5334	[c=4 l=5]  *movsi_internal/0
+	call	leave	# 5337	[c=0 l=5]  *call
+.L1453:
+	movl	%r14d, %ecx	# 5194	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC60(%rip), %rdx	# 5195	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 5198	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 19464	[c=4 l=2]  *movdi_xor
+	movl	$1, %esi	# 5197	[c=4 l=5]  *movsi_internal/0
+	call	leave	# 5200	[c=0 l=5]  *call
+.L1465:
+	movl	%r14d, %esi	# 5981	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 5982	[c=4 l=3]  *movdi_internal/3
+	call	bad_PC	# 5983	[c=0 l=5]  *call
+.L1473:
+	movl	%r14d, %ecx	# 6363	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC60(%rip), %rdx	# 6364	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 6367	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 19424	[c=4 l=2]  *movdi_xor
+	movl	$1, %esi	# 6366	[c=4 l=5]  *movsi_internal/0
+	call	leave	# 6369	[c=0 l=5]  *call
+.L1481:
+	movl	%r14d, %ecx	# 6986	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC60(%rip), %rdx	# 6987	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 6990	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 19402	[c=4 l=2]  *movdi_xor
+	movl	$1, %esi	# 6989	[c=4 l=5]  *movsi_internal/0
+	call	leave	# 6992	[c=0 l=5]  *call
+.L1480:
+	movl	%r14d, %ecx	# 6881	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC60(%rip), %rdx	# 6882	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 6885	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 19406	[c=4 l=2]  *movdi_xor
+	movl	$1, %esi	# 6884	[c=4 l=5]  *movsi_internal/0
+	call	leave	# 6887	[c=0 l=5]  *call
+.L1483:
+	movl	%r14d, %ecx	# 7214	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC60(%rip), %rdx	# 7215	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 7218	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 19392	[c=4 l=2]  *movdi_xor
+	movl	$1, %esi	# 7217	[c=4 l=5]  *movsi_internal/0
+	call	leave	# 7220	[c=0 l=5]  *call
+.L1482:
+	movl	%r14d, %ecx	# 7099	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC60(%rip), %rdx	# 7100	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 7103	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 19397	[c=4 l=2]  *movdi_xor
+	movl	$1, %esi	# 7102	[c=4 l=5]  *movsi_internal/0
+	call	leave	# 7105	[c=0 l=5]  *call
+.L1479:
+	movl	%r14d, %ecx	# 6777	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC60(%rip), %rdx	# 6778	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 6781	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 19410	[c=4 l=2]  *movdi_xor
+	movl	$1, %esi	# 6780	[c=4 l=5]  *movsi_internal/0
+	call	leave	# 6783	[c=0 l=5]  *call
+.L1478:
+	movl	%r14d, %ecx	# 6680	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC60(%rip), %rdx	# 6681	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 6684	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 19413	[c=4 l=2]  *movdi_xor
+	movl	$1, %esi	# 6683	[c=4 l=5]  *movsi_internal/0
+	call	leave	# 6686	[c=0 l=5]  *call
+.L1588:
+	movl	%edx, %ecx	# 13903	[c=4 l=2]  *movsi_internal/0
+	movl	$1, %esi	# 13906	[c=4 l=5]  *movsi_internal/0
+	leaq	.LC60(%rip), %rdx	# 13904	[c=1 l=7]  *movdi_internal/4
+	xorl	%eax, %eax	# 19181	[c=4 l=2]  *movdi_xor
+	movq	%r13, %rdi	# 13907	[c=4 l=3]  *movdi_internal/3
+	call	leave	# 13909	[c=0 l=5]  *call
+.L1587:
+	movl	%r14d, %ecx	# 13784	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC60(%rip), %rdx	# 13785	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 13788	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 19184	[c=4 l=2]  *movdi_xor
+	movl	$1, %esi	# 13787	[c=4 l=5]  *movsi_internal/0
+	call	leave	# 13790	[c=0 l=5]  *call
+.L1426:
+	movl	%r15d, %ecx	# 3570	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC60(%rip), %rdx	# 3571	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 3574	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 19517	[c=4 l=2]  *movdi_xor
+	movl	$1, %esi	# 3573	[c=4 l=5]  *movsi_internal/0
+	call	leave	# 3576	[c=0 l=5]  *call
+.L1552:
+	movl	%r14d, %ecx	# 11623	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC60(%rip), %rdx	# 11624	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 11627	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 19267	[c=4 l=2]  *movdi_xor
+	movl	$1, %esi	# 11626	[c=4 l=5]  *movsi_internal/0
+	call	leave	# 11629	[c=0 l=5]  *call
+.L1486:
+	movl	%r14d, %ecx	# 7555	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC60(%rip), %rdx	# 7556	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 7559	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 19377	[c=4 l=2]  *movdi_xor
+	movl	$1, %esi	# 7558	[c=4 l=5]  *movsi_internal/0
+	call	leave	# 7561	[c=0 l=5]  *call
+.L1485:
+	movl	%r14d, %ecx	# 7442	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC60(%rip), %rdx	# 7443	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 7446	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 19382	[c=4 l=2]  *movdi_xor
+	movl	$1, %esi	# 7445	[c=4 l=5]  *movsi_internal/0
+	call	leave	# 7448	[c=0 l=5]  *call
+.L1484:
+	movl	%r14d, %ecx	# 7327	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC60(%rip), %rdx	# 7328	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 7331	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 19387	[c=4 l=2]  *movdi_xor
+	movl	$1, %esi	# 7330	[c=4 l=5]  *movsi_internal/0
+	call	leave	# 7333	[c=0 l=5]  *call
+.L1537:
+	movl	%r14d, %ecx	# 10935	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC60(%rip), %rdx	# 10936	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 10939	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 19276	[c=4 l=2]  *movdi_xor
+	movl	$1, %esi	# 10938	[c=4 l=5]  *movsi_internal/0
+	call	leave	# 10941	[c=0 l=5]  *call
+.L1416:
+	movl	%r14d, %ecx	# 3011	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC60(%rip), %rdx	# 3012	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 3015	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 19535	[c=4 l=2]  *movdi_xor
+	movl	$1, %esi	# 3014	[c=4 l=5]  *movsi_internal/0
+	call	leave	# 3017	[c=0 l=5]  *call
+.L1415:
+	movl	%r15d, %ecx	# 2984	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC60(%rip), %rdx	# 2985	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 2988	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 19537	[c=4 l=2]  *movdi_xor
+	movl	$1, %esi	# 2987	[c=4 l=5]  *movsi_internal/0
+	call	leave	# 2990	[c=0 l=5]  *call
+.L1418:
+	movl	%r14d, %ecx	# 3172	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC60(%rip), %rdx	# 3173	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 3176	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 19530	[c=4 l=2]  *movdi_xor
+	movl	$1, %esi	# 3175	[c=4 l=5]  *movsi_internal/0
+	call	leave	# 3178	[c=0 l=5]  *call
+.L1417:
+	movl	%r15d, %ecx	# 3145	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC60(%rip), %rdx	# 3146	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 3149	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 19532	[c=4 l=2]  *movdi_xor
+	movl	$1, %esi	# 3148	[c=4 l=5]  *movsi_internal/0
+	call	leave	# 3151	[c=0 l=5]  *call
+.L1570:
+	movl	%r14d, %ecx	# 12152	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC60(%rip), %rdx	# 12153	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 12156	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 19248	[c=4 l=2]  *movdi_xor
+	movl	$1, %esi	# 12155	[c=4 l=5]  *movsi_internal/0
+	call	leave	# 12158	[c=0 l=5]  *call
+.L1420:
+	movl	%r14d, %ecx	# 3314	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC60(%rip), %rdx	# 3315	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 3318	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 19526	[c=4 l=2]  *movdi_xor
+	movl	$1, %esi	# 3317	[c=4 l=5]  *movsi_internal/0
+	call	leave	# 3320	[c=0 l=5]  *call
+.L1422:
+	movl	%r14d, %ecx	# 3474	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC60(%rip), %rdx	# 3475	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 3478	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 19520	[c=4 l=2]  *movdi_xor
+	movl	$1, %esi	# 3477	[c=4 l=5]  *movsi_internal/0
+	call	leave	# 3480	[c=0 l=5]  *call
+.L1421:
+	movl	%r15d, %ecx	# 3448	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC60(%rip), %rdx	# 3449	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 3452	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 19522	[c=4 l=2]  *movdi_xor
+	movl	$1, %esi	# 3451	[c=4 l=5]  *movsi_internal/0
+	call	leave	# 3454	[c=0 l=5]  *call
+.L1519:
+	movl	%r14d, %esi	# 10048	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 10049	[c=4 l=3]  *movdi_internal/3
+	call	bad_PC	# 10050	[c=0 l=5]  *call
+.L1390:
+	movl	%r9d, %ecx	# 681	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC60(%rip), %rdx	# 682	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 685	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 19601	[c=4 l=2]  *movdi_xor
+	movl	$1, %esi	# 684	[c=4 l=5]  *movsi_internal/0
+	call	leave	# 687	[c=0 l=5]  *call
+.L1431:
+	movl	%edx, %ecx	# 3691	[c=4 l=2]  *movsi_internal/0
+	movl	$1, %esi	# 3694	[c=4 l=5]  *movsi_internal/0
+	leaq	.LC60(%rip), %rdx	# 3692	[c=1 l=7]  *movdi_internal/4
+	xorl	%eax, %eax	# 19512	[c=4 l=2]  *movdi_xor
+	movq	%r13, %rdi	# 3695	[c=4 l=3]  *movdi_internal/3
+	call	leave	# 3697	[c=0 l=5]  *call
+.L1432:
+	movl	0(%r13), %eax	# 16921	[c=5 l=4]  *movsi_internal/0
+	movq	1056(%r13), %rdx	# 3846	[c=9 l=7]  *movdi_internal/3
+	leaq	.LC34(%rip), %rsi	# 3849	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 3851	[c=4 l=3]  *movdi_internal/3
+	subl	$1, %eax	# 3842	[c=4 l=3]  *addsi_1/0
+	movl	%eax, 0(%r13)	# 3843	[c=4 l=4]  *movsi_internal/1
+	addl	%eax, %eax	# 3844	[c=5 l=2]  *ashlsi3_1_zext/0
+	movzwl	(%rdx,%rax), %ebx	# 3847	[c=13 l=4]  *zero_extendhisi2/0
+	xorl	%eax, %eax	# 19505	[c=4 l=2]  *movdi_xor
+	movl	%ebx, %edx	# 3848	[c=4 l=2]  *movsi_internal/0
+	call	log_append@PLT	# 3853	[c=0 l=5]  *call
+	movq	832(%r13), %r8	# 3855	[c=9 l=7]  *movdi_internal/3
+	movl	%ebx, %ecx	# 3856	[c=4 l=2]  *movsi_internal/0
+	xorl	%eax, %eax	# 19506	[c=4 l=2]  *movdi_xor
+	leaq	.LC36(%rip), %rdx	# 3857	[c=1 l=7]  *movdi_internal/4
+	movl	$1, %esi	# 3859	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 3860	[c=4 l=3]  *movdi_internal/3
+	call	leave	# 3862	[c=0 l=5]  *call
+.L1392:
+	movl	%r8d, %ecx	# 853	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC60(%rip), %rdx	# 854	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 857	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 19595	[c=4 l=2]  *movdi_xor
+	movl	$1, %esi	# 856	[c=4 l=5]  *movsi_internal/0
+	call	leave	# 859	[c=0 l=5]  *call
+.L1391:
+	movl	%r15d, %ecx	# 708	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC60(%rip), %rdx	# 709	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 712	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 19599	[c=4 l=2]  *movdi_xor
+	movl	$1, %esi	# 711	[c=4 l=5]  *movsi_internal/0
+	call	leave	# 714	[c=0 l=5]  *call
+.L1394:
+	movl	%r9d, %ecx	# 1307	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC60(%rip), %rdx	# 1308	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 1311	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 19574	[c=4 l=2]  *movdi_xor
+	movl	$1, %esi	# 1310	[c=4 l=5]  *movsi_internal/0
+	call	leave	# 1313	[c=0 l=5]  *call
+.L1393:
+	movl	%r15d, %ecx	# 880	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC60(%rip), %rdx	# 881	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 884	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 19593	[c=4 l=2]  *movdi_xor
+	movl	$1, %esi	# 883	[c=4 l=5]  *movsi_internal/0
+	call	leave	# 886	[c=0 l=5]  *call
+.L1525:
+	movl	%r14d, %esi	# 10342	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 10343	[c=4 l=3]  *movdi_internal/3
+	call	bad_PC	# 10344	[c=0 l=5]  *call
+.L1457:
+	movl	%r14d, %ecx	# 5521	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC60(%rip), %rdx	# 5522	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 5525	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 19444	[c=4 l=2]  *movdi_xor
+	movl	$1, %esi	# 5524	[c=4 l=5]  *movsi_internal/0
+	call	leave	# 5527	[c=0 l=5]  *call
+.L1530:
+	leaq	.LC65(%rip), %rdx	# 10525	[c=1 l=7]  *movdi_internal/4
+	xorl	%esi, %esi	# 19290	[c=4 l=2]  *movdi_xor
+	movq	%r13, %rdi	# 10528	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 19291	[c=4 l=2]  *movdi_xor
+	call	leave	# 10530	[c=0 l=5]  *call
+.L1437:
+	movq	%r13, %rdi	# 4151	[c=4 l=3]  *movdi_internal/3
+	call	bad_PC	# 4152	[c=0 l=5]  *call
+.L1586:
+	movl	%r15d, %ecx	# 13680	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC60(%rip), %rdx	# 13681	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 13684	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 19190	[c=4 l=2]  *movdi_xor
+	movl	$1, %esi	# 13683	[c=4 l=5]  *movsi_internal/0
+	call	leave	# 13686	[c=0 l=5]  *call
+.L1585:
+	movl	%r15d, %ecx	# 13537	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC60(%rip), %rdx	# 13538	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 13541	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 19194	[c=4 l=2]  *movdi_xor
+	movl	$1, %esi	# 13540	[c=4 l=5]  *movsi_internal/0
+	call	leave	# 13543	[c=0 l=5]  *call
+.L1584:
+	movl	%r14d, %ecx	# 13385	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC60(%rip), %rdx	# 13386	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 13389	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 19199	[c=4 l=2]  *movdi_xor
+	movl	$1, %esi	# 13388	[c=4 l=5]  *movsi_internal/0
+	call	leave	# 13391	[c=0 l=5]  *call
+.L1583:
+	movl	%r11d, %ecx	# 13358	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC60(%rip), %rdx	# 13359	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 13362	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 19201	[c=4 l=2]  *movdi_xor
+	movl	$1, %esi	# 13361	[c=4 l=5]  *movsi_internal/0
+	call	leave	# 13364	[c=0 l=5]  *call
+.L1434:
+	movl	%r15d, %esi	# 3930	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 3931	[c=4 l=3]  *movdi_internal/3
+	call	stack_overflow	# 3932	[c=0 l=5]  *call
+.L265:
+	movl	%r15d, %ecx	# 357	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC46(%rip), %rdx	# 358	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 361	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 19629	[c=4 l=2]  *movdi_xor
+	movl	$1, %esi	# 360	[c=4 l=5]  *movsi_internal/0
+	call	leave	# 363	[c=0 l=5]  *call
+.L548:
+	movzbl	1004(%r13), %ecx	# 4972	[c=13 l=8]  *zero_extendqisi2/0
+	xorl	%edx, %edx	# 19474	[c=4 l=2]  *movdi_xor
+	movq	%r13, %rdi	# 4977	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 19475	[c=4 l=2]  *movdi_xor
+	leaq	.LC43(%rip), %rsi	# 4975	[c=1 l=7]  *movdi_internal/4
+	call	log_append@PLT	# 4979	[c=0 l=5]  *call
+	xorl	%ecx, %ecx	# 19476	[c=4 l=2]  *movdi_xor
+	leaq	.LC60(%rip), %rdx	# 4981	[c=1 l=7]  *movdi_internal/4
+	xorl	%eax, %eax	# 19477	[c=4 l=2]  *movdi_xor
+	movl	$1, %esi	# 4983	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 4984	[c=4 l=3]  *movdi_internal/3
+	call	leave	# 4986	[c=0 l=5]  *call
+.L1476:
+	movl	%r14d, %ecx	# 6577	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC60(%rip), %rdx	# 6578	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 6581	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 19416	[c=4 l=2]  *movdi_xor
+	movl	$1, %esi	# 6580	[c=4 l=5]  *movsi_internal/0
+	call	leave	# 6583	[c=0 l=5]  *call
+.L1564:
+	movl	%r14d, %ecx	# 11917	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC60(%rip), %rdx	# 11918	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 11921	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 19258	[c=4 l=2]  *movdi_xor
+	movl	$1, %esi	# 11920	[c=4 l=5]  *movsi_internal/0
+	call	leave	# 11923	[c=0 l=5]  *call
+.L1556:
+	movl	%r14d, %ecx	# 11721	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC60(%rip), %rdx	# 11722	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 11725	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 19264	[c=4 l=2]  *movdi_xor
+	movl	$1, %esi	# 11724	[c=4 l=5]  *movsi_internal/0
+	call	leave	# 11727	[c=0 l=5]  *call
+.L1572:
+	movl	%r14d, %ecx	# 12263	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC60(%rip), %rdx	# 12264	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 12267	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 19244	[c=4 l=2]  *movdi_xor
+	movl	$1, %esi	# 12266	[c=4 l=5]  *movsi_internal/0
+	call	leave	# 12269	[c=0 l=5]  *call
+.L986:
+	leaq	.LC66(%rip), %rdx	# 12017	[c=1 l=7]  *movdi_internal/4
+	movl	$4, %esi	# 12019	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 12020	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 19256	[c=4 l=2]  *movdi_xor
+	call	leave	# 12022	[c=0 l=5]  *call
+.L1560:
+	movl	%r14d, %ecx	# 11819	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC60(%rip), %rdx	# 11820	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 11823	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 19261	[c=4 l=2]  *movdi_xor
+	movl	$1, %esi	# 11822	[c=4 l=5]  *movsi_internal/0
+	call	leave	# 11825	[c=0 l=5]  *call
+.L1470:
+	movq	%r13, %rdi	# 6284	[c=4 l=3]  *movdi_internal/3
+	call	bad_PC	# 6285	[c=0 l=5]  *call
+.L1500:
+	movl	%r14d, %ecx	# 8785	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC60(%rip), %rdx	# 8786	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 8789	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 19313	[c=4 l=2]  *movdi_xor
+	movl	$1, %esi	# 8788	[c=4 l=5]  *movsi_internal/0
+	call	leave	# 8791	[c=0 l=5]  *call
+.L1499:
+	movl	%r9d, %ecx	# 8759	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC60(%rip), %rdx	# 8760	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 8763	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 19315	[c=4 l=2]  *movdi_xor
+	movl	$1, %esi	# 8762	[c=4 l=5]  *movsi_internal/0
+	call	leave	# 8765	[c=0 l=5]  *call
+.L1498:
+	movl	%edx, %ecx	# 8585	[c=4 l=2]  *movsi_internal/0
+	movl	$1, %esi	# 8588	[c=4 l=5]  *movsi_internal/0
+	leaq	.LC60(%rip), %rdx	# 8586	[c=1 l=7]  *movdi_internal/4
+	xorl	%eax, %eax	# 19320	[c=4 l=2]  *movdi_xor
+	movq	%r13, %rdi	# 8589	[c=4 l=3]  *movdi_internal/3
+	call	leave	# 8591	[c=0 l=5]  *call
+.L1497:
+	movl	%r14d, %ecx	# 8450	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC60(%rip), %rdx	# 8451	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 8454	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 19328	[c=4 l=2]  *movdi_xor
+	movl	$1, %esi	# 8453	[c=4 l=5]  *movsi_internal/0
+	call	leave	# 8456	[c=0 l=5]  *call
+.L1496:
+	movl	%r15d, %ecx	# 8424	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC60(%rip), %rdx	# 8425	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 8428	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 19330	[c=4 l=2]  *movdi_xor
+	movl	$1, %esi	# 8427	[c=4 l=5]  *movsi_internal/0
+	call	leave	# 8430	[c=0 l=5]  *call
+.L1495:
+	movl	%r14d, %ecx	# 8288	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC60(%rip), %rdx	# 8289	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 8292	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 19338	[c=4 l=2]  *movdi_xor
+	movl	$1, %esi	# 8291	[c=4 l=5]  *movsi_internal/0
+	call	leave	# 8294	[c=0 l=5]  *call
+.L1507:
+	movl	%r15d, %ecx	# 9360	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC60(%rip), %rdx	# 9361	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 9364	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 19298	[c=4 l=2]  *movdi_xor
+	movl	$1, %esi	# 9363	[c=4 l=5]  *movsi_internal/0
+	call	leave	# 9366	[c=0 l=5]  *call
+.L1452:
+	movl	%r15d, %ecx	# 5168	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC60(%rip), %rdx	# 5169	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 5172	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 19466	[c=4 l=2]  *movdi_xor
+	movl	$1, %esi	# 5171	[c=4 l=5]  *movsi_internal/0
+	call	leave	# 5174	[c=0 l=5]  *call
+.L1440:
+	movl	0(%r13), %eax	# 16948	[c=5 l=4]  *movsi_internal/0
+	movq	1056(%r13), %rdx	# 4221	[c=9 l=7]  *movdi_internal/3
+	leaq	.LC34(%rip), %rsi	# 4224	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 4226	[c=4 l=3]  *movdi_internal/3
+	subl	$1, %eax	# 4217	[c=4 l=3]  *addsi_1/0
+	movl	%eax, 0(%r13)	# 4218	[c=4 l=4]  *movsi_internal/1
+	addl	%eax, %eax	# 4219	[c=5 l=2]  *ashlsi3_1_zext/0
+	movzwl	(%rdx,%rax), %ebx	# 4222	[c=13 l=4]  *zero_extendhisi2/0
+	xorl	%eax, %eax	# 19501	[c=4 l=2]  *movdi_xor
+	movl	%ebx, %edx	# 4223	[c=4 l=2]  *movsi_internal/0
+	call	log_append@PLT	# 4228	[c=0 l=5]  *call
+	movq	832(%r13), %r8	# 4230	[c=9 l=7]  *movdi_internal/3
+	movl	%ebx, %ecx	# 4231	[c=4 l=2]  *movsi_internal/0
+	xorl	%eax, %eax	# 19502	[c=4 l=2]  *movdi_xor
+	leaq	.LC36(%rip), %rdx	# 4232	[c=1 l=7]  *movdi_internal/4
+	movl	$1, %esi	# 4234	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 4235	[c=4 l=3]  *movdi_internal/3
+	call	leave	# 4237	[c=0 l=5]  *call
+.L1410:
+	movq	%r13, %rdi	# 2651	[c=4 l=3]  *movdi_internal/3
+	call	bad_PC	# 2652	[c=0 l=5]  *call
+.L1396:
+	movl	%r14d, %ecx	# 1471	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC60(%rip), %rdx	# 1472	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 1475	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 19567	[c=4 l=2]  *movdi_xor
+	movl	$1, %esi	# 1474	[c=4 l=5]  *movsi_internal/0
+	call	leave	# 1477	[c=0 l=5]  *call
+.L1395:
+	movl	%r14d, %ecx	# 1333	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC60(%rip), %rdx	# 1334	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 1337	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 19572	[c=4 l=2]  *movdi_xor
+	movl	$1, %esi	# 1336	[c=4 l=5]  *movsi_internal/0
+	call	leave	# 1339	[c=0 l=5]  *call
+.L1574:
+	movl	%r15d, %ecx	# 12367	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC60(%rip), %rdx	# 12368	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 12371	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 19241	[c=4 l=2]  *movdi_xor
+	movl	$1, %esi	# 12370	[c=4 l=5]  *movsi_internal/0
+	call	leave	# 12373	[c=0 l=5]  *call
+.L1397:
+	movl	%r14d, %ecx	# 1602	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC60(%rip), %rdx	# 1603	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 1606	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 19563	[c=4 l=2]  *movdi_xor
+	movl	$1, %esi	# 1605	[c=4 l=5]  *movsi_internal/0
+	call	leave	# 1608	[c=0 l=5]  *call
+.L1447:
+	movl	%r14d, %ecx	# 4695	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC60(%rip), %rdx	# 4696	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 4699	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 19481	[c=4 l=2]  *movdi_xor
+	movl	$1, %esi	# 4698	[c=4 l=5]  *movsi_internal/0
+	call	leave	# 4701	[c=0 l=5]  *call
+.L1446:
+	movl	%r9d, %ecx	# 4669	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC60(%rip), %rdx	# 4670	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 4673	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 19483	[c=4 l=2]  *movdi_xor
+	movl	$1, %esi	# 4672	[c=4 l=5]  *movsi_internal/0
+	call	leave	# 4675	[c=0 l=5]  *call
+.L1462:
+	movl	%r14d, %esi	# 5902	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 5903	[c=4 l=3]  *movdi_internal/3
+	call	bad_PC	# 5904	[c=0 l=5]  *call
+.L1509:
+	movl	%r14d, %esi	# 9433	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 9434	[c=4 l=3]  *movdi_internal/3
+	call	stack_overflow	# 9435	[c=0 l=5]  *call
+.L1589:
+	movl	%edx, %ecx	# 14045	[c=4 l=2]  *movsi_internal/0
+	movl	$1, %esi	# 14048	[c=4 l=5]  *movsi_internal/0
+	leaq	.LC60(%rip), %rdx	# 14046	[c=1 l=7]  *movdi_internal/4
+	xorl	%eax, %eax	# 19177	[c=4 l=2]  *movdi_xor
+	movq	%r13, %rdi	# 14049	[c=4 l=3]  *movdi_internal/3
+	call	leave	# 14051	[c=0 l=5]  *call
+.L1405:
+	movl	%r14d, %ecx	# 2289	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC60(%rip), %rdx	# 2290	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 2293	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 19550	[c=4 l=2]  *movdi_xor
+	movl	$1, %esi	# 2292	[c=4 l=5]  *movsi_internal/0
+	call	leave	# 2295	[c=0 l=5]  *call
+.L1398:
+	movl	%r15d, %ecx	# 1827	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC60(%rip), %rdx	# 1828	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 1831	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 19558	[c=4 l=2]  *movdi_xor
+	movl	$1, %esi	# 1830	[c=4 l=5]  *movsi_internal/0
+	call	leave	# 1833	[c=0 l=5]  *call
+.L1590:
+	movl	%r15d, %ecx	# 14184	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC60(%rip), %rdx	# 14185	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 14188	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 19173	[c=4 l=2]  *movdi_xor
+	movl	$1, %esi	# 14187	[c=4 l=5]  *movsi_internal/0
+	call	leave	# 14190	[c=0 l=5]  *call
+.L1494:
+	movl	%r15d, %ecx	# 8262	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC60(%rip), %rdx	# 8263	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 8266	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 19340	[c=4 l=2]  *movdi_xor
+	movl	$1, %esi	# 8265	[c=4 l=5]  *movsi_internal/0
+	call	leave	# 8268	[c=0 l=5]  *call
+.L1493:
+	movl	%r14d, %ecx	# 8127	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC60(%rip), %rdx	# 8128	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 8131	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 19345	[c=4 l=2]  *movdi_xor
+	movl	$1, %esi	# 8130	[c=4 l=5]  *movsi_internal/0
+	call	leave	# 8133	[c=0 l=5]  *call
+.L1492:
+	movl	%r15d, %ecx	# 8101	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC60(%rip), %rdx	# 8102	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 8105	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 19347	[c=4 l=2]  *movdi_xor
+	movl	$1, %esi	# 8104	[c=4 l=5]  *movsi_internal/0
+	call	leave	# 8107	[c=0 l=5]  *call
+.L1491:
+	movl	%r14d, %ecx	# 7976	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC60(%rip), %rdx	# 7977	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 7980	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 19353	[c=4 l=2]  *movdi_xor
+	movl	$1, %esi	# 7979	[c=4 l=5]  *movsi_internal/0
+	call	leave	# 7982	[c=0 l=5]  *call
+.L1490:
+	movl	%r15d, %ecx	# 7951	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC60(%rip), %rdx	# 7952	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 7955	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 19355	[c=4 l=2]  *movdi_xor
+	movl	$1, %esi	# 7954	[c=4 l=5]  *movsi_internal/0
+	call	leave	# 7957	[c=0 l=5]  *call
+.L1489:
+	movl	%r15d, %ecx	# 7819	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC60(%rip), %rdx	# 7820	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 7823	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 19359	[c=4 l=2]  *movdi_xor
+	movl	$1, %esi	# 7822	[c=4 l=5]  *movsi_internal/0
+	call	leave	# 7825	[c=0 l=5]  *call
+.L1488:
+	movl	%r15d, %ecx	# 7748	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC60(%rip), %rdx	# 7749	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 7752	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 19363	[c=4 l=2]  *movdi_xor
+	movl	$1, %esi	# 7751	[c=4 l=5]  *movsi_internal/0
+	call	leave	# 7754	[c=0 l=5]  *call
+.L1487:
+	movl	%r14d, %ecx	# 7673	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC60(%rip), %rdx	# 7674	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 7677	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 19367	[c=4 l=2]  *movdi_xor
+	movl	$1, %esi	# 7676	[c=4 l=5]  *movsi_internal/0
+	call	leave	# 7679	[c=0 l=5]  *call
+.L1578:
+	movl	%r14d, %ecx	# 12790	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC60(%rip), %rdx	# 12791	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 12794	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 19225	[c=4 l=2]  *movdi_xor
+	movl	$1, %esi	# 12793	[c=4 l=5]  *movsi_internal/0
+	call	leave	# 12796	[c=0 l=5]  *call
+.L1577:
+	movl	%r14d, %ecx	# 12676	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC60(%rip), %rdx	# 12677	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 12680	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 19230	[c=4 l=2]  *movdi_xor
+	movl	$1, %esi	# 12679	[c=4 l=5]  *movsi_internal/0
+	call	leave	# 12682	[c=0 l=5]  *call
+.L1576:
+	movl	%r14d, %ecx	# 12570	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC60(%rip), %rdx	# 12571	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 12574	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 19234	[c=4 l=2]  *movdi_xor
+	movl	$1, %esi	# 12573	[c=4 l=5]  *movsi_internal/0
+	call	leave	# 12576	[c=0 l=5]  *call
+.L1575:
+	movl	%r15d, %ecx	# 12465	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC60(%rip), %rdx	# 12466	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 12469	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 19238	[c=4 l=2]  *movdi_xor
+	movl	$1, %esi	# 12468	[c=4 l=5]  *movsi_internal/0
+	call	leave	# 12471	[c=0 l=5]  *call
+.L1582:
+	movl	%r14d, %ecx	# 13250	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC60(%rip), %rdx	# 13251	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 13254	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 19205	[c=4 l=2]  *movdi_xor
+	movl	$1, %esi	# 13253	[c=4 l=5]  *movsi_internal/0
+	call	leave	# 13256	[c=0 l=5]  *call
+.L1581:
+	movl	%r14d, %ecx	# 13136	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC60(%rip), %rdx	# 13137	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 13140	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 19210	[c=4 l=2]  *movdi_xor
+	movl	$1, %esi	# 13139	[c=4 l=5]  *movsi_internal/0
+	call	leave	# 13142	[c=0 l=5]  *call
+.L1580:
+	movl	%r14d, %ecx	# 13020	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC60(%rip), %rdx	# 13021	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 13024	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 19215	[c=4 l=2]  *movdi_xor
+	movl	$1, %esi	# 13023	[c=4 l=5]  *movsi_internal/0
+	call	leave	# 13026	[c=0 l=5]  *call
+.L1579:
+	movl	%r14d, %ecx	# 12906	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC60(%rip), %rdx	# 12907	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 12910	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 19220	[c=4 l=2]  *movdi_xor
+	movl	$1, %esi	# 12909	[c=4 l=5]  *movsi_internal/0
+	call	leave	# 12912	[c=0 l=5]  *call
+	.cfi_endproc
+.LFE211:
+	.size	execute, .-execute
+	.section	.rodata.str1.1
+.LC68:
+	.string	"RAM"
+.LC69:
+	.string	"flash"
+.LC70:
+	.string	"EEPROM"
+.LC71:
+	.string	"decoded flash"
+.LC72:
+	.string	"atmega64"
+.LC73:
+	.string	"atmega128"
+	.section	.rodata.str1.8
+	.align 8
+.LC74:
+	.string	"entry point 0x%x is outside the flash of %s"
+	.text
+	.p2align 4
+	.type	run_context, @function
+run_context:
+.LFB216:
+	.cfi_startproc
+	pushq	%r13	# 848	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 16
+	.cfi_offset 13, -16
+	pushq	%r12	# 849	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 24
+	.cfi_offset 12, -24
+	pushq	%rbp	# 850	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 32
+	.cfi_offset 6, -32
+	pushq	%rbx	# 851	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 40
+	.cfi_offset 3, -40
+	subq	$248, %rsp	# 852	[c=4 l=7]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_def_cfa_offset 288
+	movq	%rdi, (%rsp)	# 2	[c=4 l=4]  *movdi_internal/5
+	leaq	32(%rsp), %rdi	# 22	[c=4 l=5]  *leadi
+	movl	%esi, 12(%rsp)	# 3	[c=4 l=4]  *movsi_internal/1
+	movq	%rdx, 16(%rsp)	# 4	[c=4 l=5]  *movdi_internal/5
+	call	_setjmp@PLT	# 24	[c=10 l=5]  *call_value
+	testl	%eax, %eax	# 31	[c=4 l=2]  *cmpsi_ccno_1/0
+	je	.L1661	# 32	[c=13 l=6]  *jcc
+	movq	(%rsp), %rbx	# 806	[c=5 l=4]  *movdi_internal/3
+	movq	$0, 128(%rbx)	# 500	[c=4 l=11]  *movdi_internal/5
+	movq	%rbx, %rdi	# 501	[c=4 l=3]  *movdi_internal/3
+	call	eeprom_finish@PLT	# 502	[c=0 l=5]  *call
+	movq	984(%rbx), %rdi	# 504	[c=9 l=7]  *movdi_internal/3
+	testq	%rdi, %rdi	# 505	[c=4 l=3]  *cmpdi_ccno_1/0
+	jne	.L1637	# 506	[c=13 l=2]  *jcc
+	jmp	.L1643	# 908	[c=1 l=2]  jump
+	.p2align 4,,10
+	.p2align 3
+.L1662:
+	movq	%rax, (%rdx)	# 528	[c=4 l=3]  *movdi_internal/5
+.L1640:
+	testq	%rax, %rax	# 536	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L1641	# 537	[c=13 l=2]  *jcc
+	movq	%rdx, 8(%rax)	# 539	[c=4 l=4]  *movdi_internal/5
+.L1641:
+	call	free@PLT	# 552	[c=0 l=5]  *call
+	movq	(%rsp), %rax	# 769	[c=5 l=4]  *movdi_internal/3
+	movq	984(%rax), %rdi	# 553	[c=9 l=7]  *movdi_internal/3
+	testq	%rdi, %rdi	# 554	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L1643	# 555	[c=13 l=2]  *jcc
+.L1637:
+	movq	16(%rdi), %rax	# 513	[c=9 l=4]  *movdi_internal/3
+	testq	%rax, %rax	# 514	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L1638	# 515	[c=13 l=2]  *jcc
+	movq	%rax, %rdi	# 517	[c=4 l=3]  *movdi_internal/3
+	call	fclose@PLT	# 518	[c=10 l=5]  *call_value
+	movq	(%rsp), %rax	# 766	[c=5 l=4]  *movdi_internal/3
+	movq	984(%rax), %rdi	# 520	[c=9 l=7]  *movdi_internal/3
+.L1638:
+	movq	8(%rdi), %rdx	# 523	[c=9 l=4]  *movdi_internal/3
+	movq	(%rdi), %rax	# 524	[c=5 l=3]  *movdi_internal/3
+	testq	%rdx, %rdx	# 525	[c=4 l=3]  *cmpdi_ccno_1/0
+	jne	.L1662	# 526	[c=13 l=2]  *jcc
+	movq	(%rsp), %rbx	# 767	[c=5 l=4]  *movdi_internal/3
+	movq	%rax, 984(%rbx)	# 533	[c=4 l=7]  *movdi_internal/5
+	jmp	.L1640	# 911	[c=1 l=2]  jump
+	.p2align 4,,10
+	.p2align 3
+.L1643:
+	movq	(%rsp), %rax	# 765	[c=5 l=4]  *movdi_internal/3
+	movl	136(%rax), %eax	# 508	[c=9 l=6]  *movsi_internal/0
+	addq	$248, %rsp	# 855	[c=4 l=7]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	popq	%rbx	# 856	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 32
+	popq	%rbp	# 857	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 24
+	popq	%r12	# 858	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 16
+	popq	%r13	# 859	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 8
+	ret		# 860	[c=0 l=1]  simple_return_internal
+.L1661:
+	.cfi_restore_state
+	movq	(%rsp), %rbx	# 773	[c=5 l=4]  *movdi_internal/3
+	leaq	32(%rsp), %rax	# 34	[c=4 l=5]  *leadi
+	xorl	%esi, %esi	# 905	[c=4 l=2]  *movdi_xor
+	movl	$1, %r13d	# 6	[c=4 l=6]  *movsi_internal/0
+	movq	%rax, 128(%rbx)	# 35	[c=4 l=7]  *movdi_internal/5
+	leaq	920(%rbx), %rdi	# 839	[c=4 l=7]  *leadi
+	call	gettimeofday@PLT	# 39	[c=10 l=5]  *call_value
+	movq	16(%rsp), %rdx	# 40	[c=9 l=5]  *movdi_internal/3
+	movl	12(%rsp), %esi	# 41	[c=9 l=4]  *movsi_internal/0
+	movq	%rbx, %rdi	# 42	[c=4 l=3]  *movdi_internal/3
+	call	parse_args@PLT	# 43	[c=0 l=5]  *call
+	movq	%rbx, %rdi	# 45	[c=4 l=3]  *movdi_internal/3
+	call	replay_open@PLT	# 46	[c=0 l=5]  *call
+	movl	880(%rbx), %eax	# 48	[c=9 l=6]  *movsi_internal/0
+.L1604:
+	movl	%r13d, %r12d	# 50	[c=4 l=3]  *movsi_internal/0
+	addl	%r13d, %r13d	# 51	[c=4 l=3]  *ashlsi3_1/0
+	cmpl	%eax, %r13d	# 53	[c=4 l=3]  *cmpsi_1/0
+	jb	.L1604	# 54	[c=13 l=2]  *jcc
+	leal	-1(%r12), %eax	# 837	[c=4 l=5]  *leasi
+	movl	$1, %edi	# 66	[c=4 l=5]  *movdi_internal/2
+	movd	%eax, %xmm0	# 704	[c=4 l=4]  *movsi_internal/13
+	movq	(%rsp), %rax	# 776	[c=5 l=4]  *movdi_internal/3
+	movl	872(%rax), %ecx	# 57	[c=9 l=6]  *movsi_internal/0
+	movd	%ecx, %xmm1	# 707	[c=4 l=4]  *movsi_internal/13
+	movl	%ecx, 24(%rsp)	# 706	[c=4 l=4]  *movsi_internal/1
+	movl	876(%rax), %ecx	# 60	[c=9 l=6]  *movsi_internal/0
+	punpckldq	%xmm1, %xmm0	# 58	[c=4 l=4]  *vec_concatv2si/0
+	movl	%ecx, 1000(%rax)	# 61	[c=4 l=6]  *movsi_internal/1
+	leal	1(%rcx), %esi	# 838	[c=5 l=3]  *leadi
+	movq	%xmm0, 992(%rax)	# 59	[c=4 l=9]  *movv2si_internal/14
+	movq	%rsi, %rbx	# 844	[c=4 l=3]  *movdi_internal/3
+	addq	$32, %rsi	# 64	[c=4 l=4]  *adddi_1/0
+	call	calloc@PLT	# 67	[c=10 l=5]  *call_value
+	movq	%rax, %rbp	# 68	[c=4 l=3]  *movdi_internal/3
+	testq	%rax, %rax	# 70	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L1663	# 71	[c=13 l=6]  *jcc
+	xorl	%esi, %esi	# 903	[c=4 l=2]  *movdi_xor
+	movq	%rsi, 8(%rax)	# 904	[c=4 l=4]  *movdi_internal/5
+	movq	(%rsp), %rax	# 711	[c=5 l=4]  *movdi_internal/3
+	movq	984(%rax), %rax	# 86	[c=9 l=7]  *movdi_internal/3
+	movq	%rax, 0(%rbp)	# 87	[c=4 l=4]  *movdi_internal/5
+	testq	%rax, %rax	# 88	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L1606	# 89	[c=13 l=2]  *jcc
+	movq	%rbp, 8(%rax)	# 91	[c=4 l=4]  *movdi_internal/5
+.L1606:
+	movq	(%rsp), %rcx	# 777	[c=5 l=4]  *movdi_internal/3
+	leaq	32(%rbp), %rax	# 836	[c=4 l=4]  *leadi
+	leal	2(%r13), %esi	# 943	[c=5 l=4]  *leadi
+	movl	$1, %edi	# 101	[c=4 l=5]  *movdi_internal/2
+	movq	%rsi, %r13	# 845	[c=4 l=3]  *movdi_internal/3
+	addq	$32, %rsi	# 99	[c=4 l=4]  *adddi_1/0
+	movq	%rbp, 984(%rcx)	# 94	[c=4 l=7]  *movdi_internal/5
+	movq	%rax, 1040(%rcx)	# 96	[c=4 l=7]  *movdi_internal/5
+	call	calloc@PLT	# 102	[c=10 l=5]  *call_value
+	movq	%rax, %rbx	# 103	[c=4 l=3]  *movdi_internal/3
+	testq	%rax, %rax	# 105	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L1664	# 106	[c=13 l=6]  *jcc
+	xorl	%ecx, %ecx	# 900	[c=4 l=2]  *movdi_xor
+	movq	%rbp, (%rax)	# 121	[c=4 l=3]  *movdi_internal/5
+	movl	$1, %edi	# 131	[c=4 l=5]  *movdi_internal/2
+	movq	%rcx, 8(%rax)	# 901	[c=4 l=4]  *movdi_internal/5
+	movq	(%rsp), %rcx	# 779	[c=5 l=4]  *movdi_internal/3
+	movq	%rax, 8(%rbp)	# 122	[c=4 l=4]  *movdi_internal/5
+	movq	%rax, 984(%rcx)	# 123	[c=4 l=7]  *movdi_internal/5
+	leaq	32(%rax), %rax	# 835	[c=4 l=4]  *leadi
+	movq	%rax, 1056(%rcx)	# 125	[c=4 l=7]  *movdi_internal/5
+	movl	884(%rcx), %ecx	# 126	[c=9 l=6]  *movsi_internal/0
+	movl	$1, %eax	# 699	[c=4 l=5]  *movsi_internal/0
+	testl	%ecx, %ecx	# 696	[c=4 l=2]  *cmpsi_ccno_1/0
+	cmovne	%ecx, %eax	# 697	[c=8 l=3]  *movsicc_noc/0
+	movl	%eax, %esi	# 718	[c=1 l=2]  *zero_extendsidi2/3
+	movq	%rsi, %r13	# 846	[c=4 l=3]  *movdi_internal/3
+	addq	$32, %rsi	# 129	[c=4 l=4]  *adddi_1/0
+	call	calloc@PLT	# 132	[c=10 l=5]  *call_value
+	leaq	.LC70(%rip), %r9	# 138	[c=1 l=7]  *movdi_internal/4
+	movq	%rax, %rbp	# 133	[c=4 l=3]  *movdi_internal/3
+	testq	%rax, %rax	# 135	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L1660	# 136	[c=13 l=6]  *jcc
+	movq	(%rsp), %rcx	# 780	[c=5 l=4]  *movdi_internal/3
+	xorl	%edx, %edx	# 898	[c=4 l=2]  *movdi_xor
+	movq	%rbx, (%rax)	# 151	[c=4 l=3]  *movdi_internal/5
+	movl	%r12d, %esi	# 156	[c=1 l=3]  *zero_extendsidi2/3
+	movq	%rdx, 8(%rax)	# 899	[c=4 l=4]  *movdi_internal/5
+	salq	$4, %rsi	# 157	[c=4 l=4]  *ashldi3_1/0
+	movl	$1, %edi	# 160	[c=4 l=5]  *movdi_internal/2
+	movq	%rax, 8(%rbx)	# 152	[c=4 l=4]  *movdi_internal/5
+	addq	$32, %rsi	# 158	[c=4 l=4]  *adddi_1/0
+	movq	%rax, 984(%rcx)	# 153	[c=4 l=7]  *movdi_internal/5
+	leaq	32(%rax), %rax	# 834	[c=4 l=4]  *leadi
+	movq	%rax, 1048(%rcx)	# 155	[c=4 l=7]  *movdi_internal/5
+	call	calloc@PLT	# 161	[c=10 l=5]  *call_value
+	movq	%rax, %rbx	# 162	[c=4 l=3]  *movdi_internal/3
+	testq	%rax, %rax	# 164	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L1665	# 165	[c=13 l=6]  *jcc
+	movq	(%rsp), %rcx	# 782	[c=5 l=4]  *movdi_internal/3
+	xorl	%eax, %eax	# 896	[c=4 l=2]  *movdi_xor
+	movq	%rbp, (%rbx)	# 180	[c=4 l=3]  *movdi_internal/5
+	movq	%rax, 8(%rbx)	# 897	[c=4 l=4]  *movdi_internal/5
+	leaq	32(%rbx), %rax	# 833	[c=4 l=4]  *leadi
+	cmpb	$0, 844(%rcx)	# 185	[c=13 l=7]  *cmpqi_ccno_1/1
+	movq	%rbx, 8(%rbp)	# 181	[c=4 l=4]  *movdi_internal/5
+	movq	%rbx, 984(%rcx)	# 182	[c=4 l=7]  *movdi_internal/5
+	movq	%rax, 1064(%rcx)	# 184	[c=4 l=7]  *movdi_internal/5
+	jne	.L1666	# 186	[c=13 l=6]  *jcc
+.L1610:
+	movq	(%rsp), %rbx	# 784	[c=5 l=4]  *movdi_internal/3
+	movq	%rbx, %rdi	# 215	[c=4 l=3]  *movdi_internal/3
+	call	periph_init@PLT	# 216	[c=0 l=5]  *call
+	leaq	1080(%rbx), %rdi	# 832	[c=4 l=7]  *leadi
+	xorl	%edx, %edx	# 895	[c=4 l=2]  *movdi_xor
+	movl	$31, %eax	# 8	[c=4 l=5]  *movsi_internal/0
+	movq	%rdi, %rcx	# 219	[c=4 l=3]  *movdi_internal/3
+.L1619:
+	movq	(%rsp), %rsi	# 727	[c=5 l=4]  *movdi_internal/3
+	movl	1000(%rsi), %r8d	# 221	[c=9 l=7]  *movsi_internal/0
+	xorl	%esi, %esi	# 894	[c=4 l=2]  *movdi_xor
+	cmpl	%eax, %r8d	# 222	[c=4 l=3]  *cmpsi_1/0
+	jnb	.L1612	# 223	[c=13 l=2]  *jcc
+	cmpl	%edx, %r8d	# 602	[c=4 l=3]  *cmpsi_1/0
+	sbbl	%esi, %esi	# 603	[c=8 l=2]  *x86_movsicc_0_m1
+	andl	$4, %esi	# 830	[c=4 l=3]  *andsi_1/0
+	addl	$1, %esi	# 831	[c=4 l=3]  *addsi_1/0
+.L1612:
+	movb	%sil, (%rcx)	# 231	[c=4 l=3]  *movqi_internal/8
+	movq	%rcx, %r8	# 230	[c=4 l=3]  *movdi_internal/3
+	cmpl	$16383, %edx	# 236	[c=4 l=6]  *cmpsi_1/0
+	jbe	.L1613	# 237	[c=13 l=2]  *jcc
+	cmpl	$32767, %eax	# 242	[c=4 l=5]  *cmpsi_1/0
+	ja	.L1613	# 243	[c=13 l=2]  *jcc
+	movq	(%rsp), %rsi	# 728	[c=5 l=4]  *movdi_internal/3
+	movb	$2, (%rcx)	# 245	[c=4 l=3]  *movqi_internal/8
+	cmpb	$0, 844(%rsi)	# 246	[c=13 l=7]  *cmpqi_ccno_1/1
+	je	.L1658	# 247	[c=13 l=2]  *jcc
+	cmpl	%edx, 1000(%rsi)	# 265	[c=13 l=6]  *cmpsi_1/0
+	jnb	.L1658	# 266	[c=13 l=2]  *jcc
+	movb	$4, (%rcx)	# 268	[c=4 l=3]  *movqi_internal/8
+	addl	$32, %eax	# 269	[c=4 l=3]  *addsi_1/0
+	addl	$32, %edx	# 270	[c=4 l=3]  *addsi_1/0
+	addq	$1, %rcx	# 271	[c=4 l=4]  *adddi_1/0
+	jmp	.L1619	# 917	[c=1 l=2]  jump
+.L1613:
+	movq	(%rsp), %rsi	# 785	[c=5 l=4]  *movdi_internal/3
+	cmpb	$0, 844(%rsi)	# 277	[c=13 l=7]  *cmpqi_ccno_1/1
+	je	.L1618	# 278	[c=13 l=2]  *jcc
+	cmpl	%edx, 1000(%rsi)	# 282	[c=13 l=6]  *cmpsi_1/0
+	jnb	.L1618	# 283	[c=13 l=2]  *jcc
+	cmpl	$65535, %eax	# 288	[c=4 l=5]  *cmpsi_1/0
+	ja	.L1618	# 289	[c=13 l=2]  *jcc
+	movb	$4, (%r8)	# 291	[c=4 l=4]  *movqi_internal/8
+.L1658:
+	addl	$32, %eax	# 292	[c=4 l=3]  *addsi_1/0
+	addl	$32, %edx	# 293	[c=4 l=3]  *addsi_1/0
+	addq	$1, %rcx	# 294	[c=4 l=4]  *adddi_1/0
+	jmp	.L1619	# 919	[c=1 l=5]  jump
+.L1618:
+	addl	$32, %eax	# 255	[c=4 l=3]  *addsi_1/0
+	addl	$32, %edx	# 256	[c=4 l=3]  *addsi_1/0
+	addq	$1, %rcx	# 257	[c=4 l=4]  *adddi_1/0
+	cmpl	$131103, %eax	# 258	[c=4 l=5]  *cmpsi_1/0
+	jne	.L1619	# 259	[c=13 l=6]  *jcc
+	movq	(%rsp), %rax	# 732	[c=5 l=4]  *movdi_internal/3
+	movb	$1, 1081(%rax)	# 302	[c=4 l=7]  *movqi_internal/8
+	xorl	%eax, %eax	# 893	[c=4 l=2]  *movdi_xor
+	jmp	.L1620	# 921	[c=1 l=2]  jump
+.L1622:
+	movq	(%rsp), %rcx	# 733	[c=5 l=4]  *movdi_internal/3
+	cmpb	$0, 6568(%rcx,%rax)	# 306	[c=14 l=8]  *cmpqi_ccno_1/1
+	je	.L1621	# 307	[c=13 l=2]  *jcc
+	shrl	$5, %edx	# 309	[c=5 l=3]  *lshrsi3_1_zext/0
+	movb	$1, (%rdi,%rdx)	# 311	[c=4 l=4]  *movqi_internal/8
+.L1621:
+	addq	$1, %rax	# 314	[c=4 l=4]  *adddi_1/0
+.L1620:
+	movq	(%rsp), %rcx	# 734	[c=5 l=4]  *movdi_internal/3
+	movl	%eax, %edx	# 317	[c=4 l=2]  *movsi_internal/0
+	cmpl	6564(%rcx), %eax	# 319	[c=13 l=6]  *cmpsi_1/1
+	jb	.L1622	# 320	[c=13 l=2]  *jcc
+	movl	1000(%rcx), %eax	# 322	[c=9 l=6]  *movsi_internal/0
+	movl	%eax, 28(%rsp)	# 736	[c=4 l=4]  *movsi_internal/1
+	addl	$1, %eax	# 323	[c=4 l=3]  *addsi_1/0
+	movl	%eax, %edx	# 738	[c=4 l=2]  *movsi_internal/0
+	shrl	$5, %edx	# 324	[c=4 l=3]  *lshrsi3_1/0
+	jmp	.L1624	# 923	[c=1 l=2]  jump
+.L1667:
+	leal	-1(%rdx), %esi	# 829	[c=5 l=3]  *leadi
+	cmpb	$0, (%rdi,%rsi)	# 332	[c=13 l=4]  *cmpqi_ccno_1/1
+	movq	%rsi, %rcx	# 847	[c=4 l=3]  *movdi_internal/3
+	jne	.L1623	# 333	[c=13 l=2]  *jcc
+	movl	%ecx, %edx	# 13	[c=4 l=2]  *movsi_internal/0
+.L1624:
+	testl	%edx, %edx	# 326	[c=4 l=2]  *cmpsi_ccno_1/0
+	jne	.L1667	# 327	[c=13 l=2]  *jcc
+.L1623:
+	movq	(%rsp), %rcx	# 787	[c=5 l=4]  *movdi_internal/3
+	sall	$5, %edx	# 336	[c=4 l=3]  *ashlsi3_1/0
+	andl	$-32, %eax	# 338	[c=4 l=3]  *andsi_1/0
+	subl	%edx, %eax	# 339	[c=4 l=2]  *subsi_1/0
+	movl	%edx, 5176(%rcx)	# 337	[c=4 l=6]  *movsi_internal/1
+	movl	880(%rcx), %edx	# 341	[c=9 l=6]  *movsi_internal/0
+	movl	%eax, 5180(%rcx)	# 340	[c=4 l=6]  *movsi_internal/1
+	movl	$64, %eax	# 14	[c=4 l=5]  *movsi_internal/0
+	cmpl	$8192, %edx	# 344	[c=4 l=6]  *cmpsi_1/0
+	jbe	.L1625	# 345	[c=13 l=2]  *jcc
+	cmpl	$32769, %edx	# 622	[c=4 l=6]  *cmpsi_1/0
+	sbbl	%eax, %eax	# 623	[c=8 l=2]  *x86_movsicc_0_m1
+	andl	$-128, %eax	# 624	[c=4 l=3]  *andsi_1/0
+	addl	$256, %eax	# 625	[c=4 l=5]  *addsi_1/0
+.L1625:
+	movq	(%rsp), %rcx	# 788	[c=5 l=4]  *movdi_internal/3
+	leaq	.LC72(%rip), %rsi	# 357	[c=1 l=7]  *movdi_internal/4
+	movq	856(%rcx), %rbx	# 355	[c=9 l=7]  *movdi_internal/3
+	movl	%eax, 6044(%rcx)	# 354	[c=4 l=6]  *movsi_internal/1
+	movq	%rbx, %rdi	# 359	[c=4 l=3]  *movdi_internal/3
+	call	strcmp@PLT	# 360	[c=10 l=5]  *call_value
+	movl	%eax, %edx	# 653	[c=4 l=2]  *movsi_internal/0
+	movl	$104, %eax	# 18	[c=4 l=5]  *movsi_internal/0
+	testl	%edx, %edx	# 362	[c=4 l=2]  *cmpsi_ccno_1/0
+	je	.L1626	# 363	[c=13 l=2]  *jcc
+	leaq	.LC73(%rip), %rsi	# 366	[c=1 l=7]  *movdi_internal/4
+	movq	%rbx, %rdi	# 368	[c=4 l=3]  *movdi_internal/3
+	call	strcmp@PLT	# 369	[c=10 l=5]  *call_value
+	cmpl	$1, %eax	# 636	[c=4 l=3]  *cmpsi_1/0
+	sbbl	%eax, %eax	# 637	[c=8 l=2]  *x86_movsicc_0_m1
+	andl	$49, %eax	# 638	[c=4 l=3]  *andsi_1/0
+	addl	$55, %eax	# 639	[c=4 l=3]  *addsi_1/0
+.L1626:
+	movq	(%rsp), %rsi	# 794	[c=5 l=4]  *movdi_internal/3
+	leaq	6060(%rsi), %rdi	# 828	[c=4 l=7]  *leadi
+	movl	%eax, 6048(%rsi)	# 376	[c=4 l=6]  *movsi_internal/1
+	movl	%esi, %eax	# 749	[c=4 l=2]  *movsi_internal/0
+	movq	$-1, 6052(%rsi)	# 382	[c=4 l=11]  *movdi_internal/5
+	andq	$-8, %rdi	# 388	[c=4 l=4]  *anddi_1/1
+	movq	$-1, 6556(%rsi)	# 386	[c=4 l=11]  *movdi_internal/5
+	subl	%edi, %eax	# 389	[c=4 l=2]  *subsi_1/0
+	leal	6564(%rax), %ecx	# 390	[c=4 l=6]  *leasi
+	orq	$-1, %rax	# 892	[c=4 l=4]  *movdi_or
+	shrl	$3, %ecx	# 392	[c=5 l=3]  *lshrsi3_1_zext/0
+	rep stosq	# 394	[c=0 l=3]  *rep_stosdi_rex64
+	movl	(%rsi), %eax	# 395	[c=5 l=2]  *movsi_internal/0
+	cmpl	%eax, 992(%rsi)	# 396	[c=13 l=6]  *cmpsi_1/0
+	jb	.L1668	# 397	[c=13 l=6]  *jcc
+	movq	(%rsp), %rbx	# 795	[c=5 l=4]  *movdi_internal/3
+	movq	%rbx, %rdi	# 411	[c=4 l=3]  *movdi_internal/3
+	call	log_open@PLT	# 412	[c=0 l=5]  *call
+	cmpl	$0, 232(%rbx)	# 414	[c=13 l=7]  *cmpsi_ccno_1/1
+	jne	.L1669	# 415	[c=13 l=6]  *jcc
+.L1628:
+	movq	(%rsp), %rbx	# 796	[c=5 l=4]  *movdi_internal/3
+	movq	%rbx, %rdi	# 423	[c=4 l=3]  *movdi_internal/3
+	call	checkpoint_open@PLT	# 424	[c=0 l=5]  *call
+	cmpl	$0, 424(%rbx)	# 426	[c=13 l=7]  *cmpsi_ccno_1/1
+	jne	.L1631	# 427	[c=13 l=2]  *jcc
+	movq	(%rsp), %rdi	# 435	[c=5 l=4]  *movdi_internal/3
+	call	load_to_flash@PLT	# 436	[c=0 l=5]  *call
+.L1631:
+	movq	(%rsp), %rbx	# 798	[c=5 l=4]  *movdi_internal/3
+	movq	%rbx, %rdi	# 429	[c=4 l=3]  *movdi_internal/3
+	call	eeprom_open@PLT	# 430	[c=0 l=5]  *call
+	movq	%rbx, %rdi	# 442	[c=4 l=3]  *movdi_internal/3
+	call	checkpoint_resume@PLT	# 443	[c=0 l=5]  *call
+	cmpl	$0, 232(%rbx)	# 445	[c=13 l=7]  *cmpsi_ccno_1/1
+	jne	.L1670	# 446	[c=13 l=6]  *jcc
+.L1632:
+	movq	(%rsp), %rax	# 758	[c=5 l=4]  *movdi_internal/3
+	cmpl	$0, 424(%rax)	# 454	[c=13 l=7]  *cmpsi_ccno_1/1
+	jne	.L1635	# 455	[c=13 l=2]  *jcc
+	movq	(%rsp), %rdi	# 463	[c=5 l=4]  *movdi_internal/3
+	call	decode_flash@PLT	# 464	[c=0 l=5]  *call
+.L1635:
+	movq	(%rsp), %rbx	# 799	[c=5 l=4]  *movdi_internal/3
+	movq	%rbx, %rdi	# 457	[c=4 l=3]  *movdi_internal/3
+	call	fork_server_open@PLT	# 458	[c=0 l=5]  *call
+	cmpl	$0, 232(%rbx)	# 470	[c=13 l=7]  *cmpsi_ccno_1/1
+	jne	.L1671	# 471	[c=13 l=6]  *jcc
+.L1636:
+	movq	(%rsp), %rbx	# 804	[c=5 l=4]  *movdi_internal/3
+	movq	920(%rbx), %rsi	# 480	[c=9 l=7]  *movdi_internal/3
+	movq	%rbx, %rdi	# 483	[c=4 l=3]  *movdi_internal/3
+	addl	928(%rbx), %esi	# 481	[c=13 l=6]  *addsi_1/1
+	call	replay_seed@PLT	# 484	[c=10 l=5]  *call_value
+	movq	%rbx, %rdi	# 488	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, %esi	# 485	[c=4 l=2]  *movsi_internal/0
+	call	log_init@PLT	# 489	[c=0 l=5]  *call
+	movq	%rbx, %rdi	# 492	[c=4 l=3]  *movdi_internal/3
+	movl	$1, %esi	# 491	[c=4 l=5]  *movsi_internal/0
+	call	log_checkpoint@PLT	# 493	[c=0 l=5]  *call
+	movq	%rbx, %rdi	# 495	[c=4 l=3]  *movdi_internal/3
+	call	execute	# 496	[c=0 l=5]  *call
+.L1666:
+	movl	$32800, %esi	# 188	[c=4 l=5]  *movdi_internal/2
+	movl	$1, %edi	# 189	[c=4 l=5]  *movdi_internal/2
+	call	calloc@PLT	# 190	[c=10 l=5]  *call_value
+	testq	%rax, %rax	# 193	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L1672	# 194	[c=13 l=6]  *jcc
+	movq	(%rsp), %rcx	# 783	[c=5 l=4]  *movdi_internal/3
+	movq	%rbx, (%rax)	# 208	[c=4 l=3]  *movdi_internal/5
+	movq	%rax, 8(%rbx)	# 209	[c=4 l=4]  *movdi_internal/5
+	movq	%rax, 984(%rcx)	# 210	[c=4 l=7]  *movdi_internal/5
+	addq	$32, %rax	# 211	[c=4 l=4]  *adddi_1/0
+	movq	%rax, 1072(%rcx)	# 212	[c=4 l=7]  *movdi_internal/5
+	jmp	.L1610	# 931	[c=1 l=5]  jump
+.L1670:
+	movq	(%rsp), %rax	# 757	[c=5 l=4]  *movdi_internal/3
+	xorl	%esi, %esi	# 889	[c=4 l=2]  *movdi_xor
+	leaq	952(%rax), %rdi	# 825	[c=4 l=7]  *leadi
+	call	gettimeofday@PLT	# 451	[c=10 l=5]  *call_value
+	jmp	.L1632	# 933	[c=1 l=5]  jump
+.L1665:
+	leaq	.LC71(%rip), %r9	# 167	[c=1 l=7]  *movdi_internal/4
+	movl	$16, %r8d	# 168	[c=4 l=6]  *movsi_internal/0
+	movl	%r12d, %ecx	# 169	[c=4 l=3]  *movsi_internal/0
+.L1659:
+	movq	(%rsp), %rdi	# 114	[c=5 l=4]  *movdi_internal/3
+	leaq	.LC27(%rip), %rdx	# 111	[c=1 l=7]  *movdi_internal/4
+	movl	$6, %esi	# 113	[c=4 l=5]  *movsi_internal/0
+	xorl	%eax, %eax	# 902	[c=4 l=2]  *movdi_xor
+	call	leave	# 116	[c=0 l=5]  *call
+.L1664:
+	leaq	.LC69(%rip), %r9	# 108	[c=1 l=7]  *movdi_internal/4
+.L1660:
+	movl	$1, %r8d	# 109	[c=4 l=6]  *movsi_internal/0
+	movl	%r13d, %ecx	# 110	[c=4 l=3]  *movsi_internal/0
+	jmp	.L1659	# 935	[c=1 l=2]  jump
+.L1663:
+	leaq	.LC68(%rip), %r9	# 73	[c=1 l=7]  *movdi_internal/4
+	movl	$1, %r8d	# 74	[c=4 l=6]  *movsi_internal/0
+	movl	%ebx, %ecx	# 75	[c=4 l=2]  *movsi_internal/0
+	jmp	.L1659	# 937	[c=1 l=2]  jump
+.L1668:
+	movq	(%rsp), %rdi	# 405	[c=5 l=4]  *movdi_internal/3
+	leal	(%rax,%rax), %ecx	# 827	[c=12 l=3]  *leasi
+	movq	%rbx, %r8	# 400	[c=4 l=3]  *movdi_internal/3
+	movl	$5, %esi	# 404	[c=4 l=5]  *movsi_internal/0
+	leaq	.LC74(%rip), %rdx	# 402	[c=1 l=7]  *movdi_internal/4
+	xorl	%eax, %eax	# 891	[c=4 l=2]  *movdi_xor
+	call	leave	# 407	[c=0 l=5]  *call
+.L1672:
+	movq	(%rsp), %rdi	# 202	[c=5 l=4]  *movdi_internal/3
+	movl	$8, %r8d	# 197	[c=4 l=6]  *movsi_internal/0
+	leaq	.LC26(%rip), %r9	# 196	[c=1 l=7]  *movdi_internal/4
+	movl	$4096, %ecx	# 198	[c=4 l=5]  *movsi_internal/0
+	leaq	.LC27(%rip), %rdx	# 199	[c=1 l=7]  *movdi_internal/4
+	movl	$6, %esi	# 201	[c=4 l=5]  *movsi_internal/0
+	call	leave	# 204	[c=0 l=5]  *call
+.L1669:
+	movq	(%rsp), %rax	# 754	[c=5 l=4]  *movdi_internal/3
+	xorl	%esi, %esi	# 890	[c=4 l=2]  *movdi_xor
+	leaq	936(%rax), %rdi	# 826	[c=4 l=7]  *leadi
+	call	gettimeofday@PLT	# 420	[c=10 l=5]  *call_value
+	jmp	.L1628	# 939	[c=1 l=5]  jump
+.L1671:
+	movq	(%rsp), %rax	# 760	[c=5 l=4]  *movdi_internal/3
+	xorl	%esi, %esi	# 888	[c=4 l=2]  *movdi_xor
+	leaq	968(%rax), %rdi	# 824	[c=4 l=7]  *leadi
+	call	gettimeofday@PLT	# 476	[c=10 l=5]  *call_value
+	jmp	.L1636	# 941	[c=1 l=5]  jump
+	.cfi_endproc
+.LFE216:
+	.size	run_context, .-run_context
+	.section	.rodata.str1.1
+.LC75:
+	.string	"code must be unreachable"
+	.text
+	.p2align 4
+	.globl	log_cpu_address
+	.type	log_cpu_address, @function
+log_cpu_address:
+.LFB48:
+	.cfi_startproc
+	cmpl	$2, %edx	# 8	[c=4 l=3]  *cmpsi_1/0
+	je	.L1674	# 9	[c=13 l=2]  *jcc
+	jg	.L1675	# 14	[c=13 l=2]  *jcc
+	testl	%edx, %edx	# 16	[c=4 l=2]  *cmpsi_ccno_1/0
+	je	.L1676	# 17	[c=13 l=2]  *jcc
+	cmpl	$1, %edx	# 19	[c=4 l=3]  *cmpsi_1/0
+	jne	.L1678	# 20	[c=13 l=2]  *jcc
+	movq	1040(%rdi), %rax	# 123	[c=9 l=7]  *movdi_internal/3
+	movslq	%esi, %rsi	# 40	[c=4 l=3]  *extendsidi2_rex64/1
+	addq	%rsi, %rax	# 124	[c=4 l=3]  *adddi_1/0
+	ret		# 87	[c=0 l=1]  simple_return_internal
+	.p2align 4,,10
+	.p2align 3
+.L1675:
+	cmpl	$3, %edx	# 26	[c=4 l=3]  *cmpsi_1/0
+	jne	.L1678	# 27	[c=13 l=2]  *jcc
+	movq	1048(%rdi), %rax	# 119	[c=9 l=7]  *movdi_internal/3
+	movslq	%esi, %rsi	# 54	[c=4 l=3]  *extendsidi2_rex64/1
+	addq	%rsi, %rax	# 120	[c=4 l=3]  *adddi_1/0
+	ret		# 107	[c=0 l=1]  simple_return_internal
+	.p2align 4,,10
+	.p2align 3
+.L1674:
+	movq	1056(%rdi), %rax	# 121	[c=9 l=7]  *movdi_internal/3
+	movslq	%esi, %rsi	# 47	[c=4 l=3]  *extendsidi2_rex64/1
+	addq	%rsi, %rax	# 122	[c=4 l=3]  *adddi_1/0
+	ret		# 89	[c=0 l=1]  simple_return_internal
+	.p2align 4,,10
+	.p2align 3
+.L1676:
+	movslq	%esi, %rsi	# 34	[c=4 l=3]  *extendsidi2_rex64/1
+	leaq	1004(%rdi,%rsi), %rax	# 35	[c=5 l=8]  *leadi
+	ret		# 85	[c=0 l=1]  simple_return_internal
+.L1678:
+	pushq	%rax	# 117	[c=4 l=1]  *pushdi2_prologue
+	.cfi_def_cfa_offset 16
+	leaq	.LC75(%rip), %rdx	# 61	[c=1 l=7]  *movdi_internal/4
+	movl	$8, %esi	# 63	[c=4 l=5]  *movsi_internal/0
+	xorl	%eax, %eax	# 118	[c=4 l=2]  *movdi_xor
+	call	leave	# 66	[c=0 l=5]  *call
+	.cfi_endproc
+.LFE48:
+	.size	log_cpu_address, .-log_cpu_address
+	.p2align 4
+	.globl	set_elf_string_table
+	.type	set_elf_string_table, @function
+set_elf_string_table:
+.LFB49:
+	.cfi_startproc
+	pushq	%r13	# 29	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 16
+	.cfi_offset 13, -16
+	movl	%ecx, %r13d	# 5	[c=4 l=3]  *movsi_internal/0
+	pushq	%r12	# 30	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 24
+	.cfi_offset 12, -24
+	movq	%rdx, %r12	# 4	[c=4 l=3]  *movdi_internal/3
+	pushq	%rbp	# 31	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 32
+	.cfi_offset 6, -32
+	movq	%rsi, %rbp	# 3	[c=4 l=3]  *movdi_internal/3
+	pushq	%rbx	# 32	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 40
+	.cfi_offset 3, -40
+	movq	%rdi, %rbx	# 2	[c=4 l=3]  *movdi_internal/3
+	subq	$8, %rsp	# 33	[c=4 l=4]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_def_cfa_offset 48
+	movq	%rsi, 5216(%rdi)	# 9	[c=4 l=7]  *movdi_internal/5
+	movq	%rdx, 5224(%rdi)	# 10	[c=4 l=7]  *movdi_internal/5
+	call	checkpoint_string_table@PLT	# 15	[c=0 l=5]  *call
+	addq	$8, %rsp	# 44	[c=4 l=4]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_def_cfa_offset 40
+	movl	%r13d, %ecx	# 16	[c=4 l=3]  *movsi_internal/0
+	movq	%r12, %rdx	# 17	[c=4 l=3]  *movdi_internal/3
+	movq	%rbp, %rsi	# 18	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rdi	# 19	[c=4 l=3]  *movdi_internal/3
+	popq	%rbx	# 45	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 32
+	popq	%rbp	# 46	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 24
+	popq	%r12	# 47	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 16
+	popq	%r13	# 48	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 8
+	jmp	log_set_string_table@PLT	# 20	[c=0 l=5]  *sibcall
+	.cfi_endproc
+.LFE49:
+	.size	set_elf_string_table, .-set_elf_string_table
+	.p2align 4
+	.globl	finish_elf_string_table
+	.type	finish_elf_string_table, @function
+finish_elf_string_table:
+.LFB50:
+	.cfi_startproc
+	jmp	log_finish_string_table@PLT	# 7	[c=0 l=5]  *sibcall
+	.cfi_endproc
+.LFE50:
+	.size	finish_elf_string_table, .-finish_elf_string_table
+	.p2align 4
+	.globl	set_elf_function_symbol
+	.type	set_elf_function_symbol, @function
+set_elf_function_symbol:
+.LFB51:
+	.cfi_startproc
+	pushq	%r13	# 33	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 16
+	.cfi_offset 13, -16
+	movzbl	%cl, %r13d	# 10	[c=4 l=4]  *zero_extendqisi2/0
+	pushq	%r12	# 34	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 24
+	.cfi_offset 12, -24
+	movl	%r13d, %ecx	# 11	[c=4 l=3]  *movsi_internal/0
+	movq	%rdx, %r12	# 4	[c=4 l=3]  *movdi_internal/3
+	pushq	%rbp	# 35	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 32
+	.cfi_offset 6, -32
+	movl	%esi, %ebp	# 3	[c=4 l=2]  *movsi_internal/0
+	pushq	%rbx	# 36	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 40
+	.cfi_offset 3, -40
+	movq	%rdi, %rbx	# 2	[c=4 l=3]  *movdi_internal/3
+	subq	$8, %rsp	# 37	[c=4 l=4]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_def_cfa_offset 48
+	call	checkpoint_symbol@PLT	# 15	[c=0 l=5]  *call
+	movq	%r12, %rdx	# 17	[c=4 l=3]  *movdi_internal/3
+	movl	%ebp, %esi	# 18	[c=4 l=2]  *movsi_internal/0
+	movq	%rbx, %rdi	# 19	[c=4 l=3]  *movdi_internal/3
+	movl	%r13d, %ecx	# 16	[c=4 l=3]  *movsi_internal/0
+	call	log_set_func_symbol@PLT	# 20	[c=0 l=5]  *call
+	addq	$8, %rsp	# 48	[c=4 l=4]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_def_cfa_offset 40
+	movq	%r12, %rdx	# 21	[c=4 l=3]  *movdi_internal/3
+	movl	%ebp, %esi	# 22	[c=4 l=2]  *movsi_internal/0
+	movq	%rbx, %rdi	# 23	[c=4 l=3]  *movdi_internal/3
+	popq	%rbx	# 49	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 32
+	popq	%rbp	# 50	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 24
+	popq	%r12	# 51	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 16
+	popq	%r13	# 52	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 8
+	jmp	fork_server_set_function_symbol@PLT	# 24	[c=0 l=5]  *sibcall
+	.cfi_endproc
+.LFE51:
+	.size	set_elf_function_symbol, .-set_elf_function_symbol
+	.p2align 4
+	.globl	get_mem
+	.type	get_mem, @function
+get_mem:
+.LFB54:
+	.cfi_startproc
+	pushq	%r13	# 87	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 16
+	.cfi_offset 13, -16
+	movl	%esi, %esi	# 3	[c=1 l=2]  *zero_extendsidi2/3
+	movq	%rdx, %r13	# 4	[c=4 l=3]  *movdi_internal/3
+	pushq	%r12	# 88	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 24
+	.cfi_offset 12, -24
+	movq	%rdi, %r12	# 2	[c=4 l=3]  *movdi_internal/3
+	pushq	%rbp	# 89	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 32
+	.cfi_offset 6, -32
+	movq	%rcx, %rbp	# 5	[c=4 l=3]  *movdi_internal/3
+	pushq	%rbx	# 90	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 40
+	.cfi_offset 3, -40
+	movq	%rsi, %rbx	# 86	[c=4 l=3]  *movdi_internal/3
+	subq	$8, %rsp	# 91	[c=4 l=4]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_def_cfa_offset 48
+	testq	%rdx, %rdx	# 10	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L1689	# 11	[c=13 l=2]  *jcc
+	movq	$-33, %rax	# 13	[c=4 l=7]  *movdi_internal/3
+	xorl	%edx, %edx	# 104	[c=4 l=2]  *movdi_xor
+	divq	%r13	# 84	[c=0 l=3]  *udivmoddi4_noext
+	cmpq	%rsi, %rax	# 15	[c=4 l=3]  *cmpdi_1/0
+	jb	.L1690	# 16	[c=13 l=2]  *jcc
+.L1689:
+	imulq	%r13, %rsi	# 30	[c=16 l=4]  *muldi3_1/2
+	movl	$1, %edi	# 33	[c=4 l=5]  *movdi_internal/2
+	addq	$32, %rsi	# 31	[c=4 l=4]  *adddi_1/0
+	call	calloc@PLT	# 34	[c=10 l=5]  *call_value
+	testq	%rax, %rax	# 38	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L1690	# 39	[c=13 l=2]  *jcc
+	movq	984(%r12), %rdx	# 42	[c=9 l=8]  *movdi_internal/3
+	movq	$0, 8(%rax)	# 41	[c=4 l=8]  *movdi_internal/5
+	movq	%rdx, (%rax)	# 43	[c=4 l=3]  *movdi_internal/5
+	testq	%rdx, %rdx	# 44	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L1691	# 45	[c=13 l=2]  *jcc
+	movq	%rax, 8(%rdx)	# 47	[c=4 l=4]  *movdi_internal/5
+.L1691:
+	movq	%rax, 984(%r12)	# 50	[c=4 l=8]  *movdi_internal/5
+	addq	$8, %rsp	# 94	[c=4 l=4]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	addq	$32, %rax	# 51	[c=4 l=4]  *adddi_1/0
+	popq	%rbx	# 95	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 32
+	popq	%rbp	# 96	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 24
+	popq	%r12	# 97	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 16
+	popq	%r13	# 98	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 8
+	ret		# 99	[c=0 l=1]  simple_return_internal
+.L1690:
+	.cfi_restore_state
+	movq	%rbp, %r9	# 18	[c=4 l=3]  *movdi_internal/3
+	movl	%r13d, %r8d	# 19	[c=4 l=3]  *movsi_internal/0
+	movl	%ebx, %ecx	# 20	[c=4 l=2]  *movsi_internal/0
+	movl	$6, %esi	# 23	[c=4 l=5]  *movsi_internal/0
+	leaq	.LC27(%rip), %rdx	# 21	[c=1 l=7]  *movdi_internal/4
+	movq	%r12, %rdi	# 24	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 103	[c=4 l=2]  *movdi_xor
+	call	leave	# 26	[c=0 l=5]  *call
+	.cfi_endproc
+.LFE54:
+	.size	get_mem, .-get_mem
+	.p2align 4
+	.globl	put_mem
+	.type	put_mem, @function
+put_mem:
+.LFB55:
+	.cfi_startproc
+	testq	%rsi, %rsi	# 7	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L1702	# 8	[c=13 l=2]  *jcc
+	movq	-24(%rsi), %rdx	# 11	[c=9 l=4]  *movdi_internal/3
+	movq	-32(%rsi), %rax	# 12	[c=9 l=4]  *movdi_internal/3
+	leaq	-32(%rsi), %rcx	# 48	[c=4 l=4]  *leadi
+	testq	%rdx, %rdx	# 13	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L1704	# 14	[c=13 l=2]  *jcc
+	movq	%rax, (%rdx)	# 16	[c=4 l=3]  *movdi_internal/5
+.L1705:
+	testq	%rax, %rax	# 24	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L1706	# 25	[c=13 l=2]  *jcc
+	movq	%rdx, 8(%rax)	# 27	[c=4 l=4]  *movdi_internal/5
+.L1706:
+	movq	%rcx, %rdi	# 30	[c=4 l=3]  *movdi_internal/3
+	jmp	free@PLT	# 31	[c=0 l=5]  *sibcall
+	.p2align 4,,10
+	.p2align 3
+.L1702:
+	ret		# 51	[c=0 l=1]  simple_return_internal
+	.p2align 4,,10
+	.p2align 3
+.L1704:
+	movq	%rax, 984(%rdi)	# 21	[c=4 l=7]  *movdi_internal/5
+	jmp	.L1705	# 53	[c=1 l=2]  jump
+	.cfi_endproc
+.LFE55:
+	.size	put_mem, .-put_mem
+	.section	.rodata.str1.1
+.LC76:
+	.string	"out of memory opening %s"
+	.text
+	.p2align 4
+	.globl	get_file
+	.type	get_file, @function
+get_file:
+.LFB56:
+	.cfi_startproc
+	pushq	%r12	# 73	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	movq	%rsi, %r12	# 3	[c=4 l=3]  *movdi_internal/3
+	movq	%rdx, %rsi	# 4	[c=4 l=3]  *movdi_internal/3
+	pushq	%rbp	# 74	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	movq	%rdi, %rbp	# 2	[c=4 l=3]  *movdi_internal/3
+	movq	%r12, %rdi	# 9	[c=4 l=3]  *movdi_internal/3
+	pushq	%rbx	# 75	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	call	fopen@PLT	# 10	[c=10 l=5]  *call_value
+	movq	%rax, %rbx	# 11	[c=4 l=3]  *movdi_internal/3
+	testq	%rax, %rax	# 13	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L1710	# 14	[c=13 l=2]  *jcc
+	movl	$32, %esi	# 16	[c=4 l=5]  *movdi_internal/2
+	movl	$1, %edi	# 17	[c=4 l=5]  *movdi_internal/2
+	call	calloc@PLT	# 18	[c=10 l=5]  *call_value
+	testq	%rax, %rax	# 21	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L1721	# 22	[c=13 l=2]  *jcc
+	movq	984(%rbp), %rdx	# 38	[c=9 l=7]  *movdi_internal/3
+	movq	%rbx, 16(%rax)	# 36	[c=4 l=4]  *movdi_internal/5
+	movq	$0, 8(%rax)	# 37	[c=4 l=8]  *movdi_internal/5
+	movq	%rdx, (%rax)	# 39	[c=4 l=3]  *movdi_internal/5
+	testq	%rdx, %rdx	# 40	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L1713	# 41	[c=13 l=2]  *jcc
+	movq	%rax, 8(%rdx)	# 43	[c=4 l=4]  *movdi_internal/5
+.L1713:
+	movq	%rax, 984(%rbp)	# 46	[c=4 l=7]  *movdi_internal/5
+.L1710:
+	movq	%rbx, %rax	# 52	[c=4 l=3]  *movdi_internal/3
+	popq	%rbx	# 78	[c=9 l=1]  *popdi1
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbp	# 79	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 16
+	popq	%r12	# 80	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 8
+	ret		# 81	[c=0 l=1]  simple_return_internal
+.L1721:
+	.cfi_restore_state
+	movq	%rbx, %rdi	# 24	[c=4 l=3]  *movdi_internal/3
+	call	fclose@PLT	# 25	[c=10 l=5]  *call_value
+	movq	%r12, %rcx	# 26	[c=4 l=3]  *movdi_internal/3
+	movl	$6, %esi	# 29	[c=4 l=5]  *movsi_internal/0
+	movq	%rbp, %rdi	# 30	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC76(%rip), %rdx	# 27	[c=1 l=7]  *movdi_internal/4
+	xorl	%eax, %eax	# 85	[c=4 l=2]  *movdi_xor
+	call	leave	# 32	[c=0 l=5]  *call
+	.cfi_endproc
+.LFE56:
+	.size	get_file, .-get_file
+	.p2align 4
+	.globl	put_file
+	.type	put_file, @function
+put_file:
+.LFB57:
+	.cfi_startproc
+	pushq	%rbx	# 79	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	movq	984(%rdi), %rax	# 7	[c=9 l=7]  *movdi_internal/3
+	movq	%rsi, %rbx	# 3	[c=4 l=3]  *movdi_internal/3
+	testq	%rax, %rax	# 8	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L1723	# 9	[c=13 l=2]  *jcc
+	movq	%rdi, %rcx	# 85	[c=4 l=3]  *movdi_internal/3
+	jmp	.L1728	# 90	[c=1 l=2]  jump
+	.p2align 4,,10
+	.p2align 3
+.L1724:
+	testq	%rax, %rax	# 42	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L1723	# 43	[c=13 l=2]  *jcc
+.L1728:
+	movq	16(%rax), %rdx	# 11	[c=9 l=4]  *movdi_internal/3
+	movq	%rax, %rdi	# 12	[c=4 l=3]  *movdi_internal/3
+	movq	(%rax), %rax	# 13	[c=5 l=3]  *movdi_internal/3
+	cmpq	%rbx, %rdx	# 14	[c=4 l=3]  *cmpdi_1/0
+	jne	.L1724	# 15	[c=13 l=2]  *jcc
+	movq	8(%rdi), %rdx	# 17	[c=9 l=4]  *movdi_internal/3
+	testq	%rdx, %rdx	# 18	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L1725	# 19	[c=13 l=2]  *jcc
+	movq	%rax, (%rdx)	# 21	[c=4 l=3]  *movdi_internal/5
+.L1726:
+	testq	%rax, %rax	# 29	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L1727	# 30	[c=13 l=2]  *jcc
+	movq	%rdx, 8(%rax)	# 32	[c=4 l=4]  *movdi_internal/5
+.L1727:
+	call	free@PLT	# 36	[c=0 l=5]  *call
+.L1723:
+	movq	%rbx, %rdi	# 46	[c=4 l=3]  *movdi_internal/3
+	popq	%rbx	# 88	[c=9 l=1]  *popdi1
+	.cfi_remember_state
+	.cfi_def_cfa_offset 8
+	jmp	fclose@PLT	# 47	[c=10 l=5]  *sibcall_value
+	.p2align 4,,10
+	.p2align 3
+.L1725:
+	.cfi_restore_state
+	movq	%rax, 984(%rcx)	# 26	[c=4 l=7]  *movdi_internal/5
+	jmp	.L1726	# 92	[c=1 l=2]  jump
+	.cfi_endproc
+.LFE57:
+	.size	put_file, .-put_file
+	.p2align 4
+	.globl	write_checkpoint
+	.type	write_checkpoint, @function
+write_checkpoint:
+.LFB205:
+	.cfi_startproc
+	pushq	%rbx	# 18	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	movq	%rdi, %rbx	# 2	[c=4 l=3]  *movdi_internal/3
+	call	checkpoint_begin@PLT	# 7	[c=0 l=5]  *call
+	movq	%rbx, %rdi	# 9	[c=4 l=3]  *movdi_internal/3
+	xorl	%esi, %esi	# 27	[c=4 l=2]  *movdi_xor
+	call	log_checkpoint@PLT	# 10	[c=0 l=5]  *call
+	movq	%rbx, %rdi	# 11	[c=4 l=3]  *movdi_internal/3
+	popq	%rbx	# 25	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 8
+	jmp	checkpoint_end@PLT	# 12	[c=0 l=5]  *sibcall
+	.cfi_endproc
+.LFE205:
+	.size	write_checkpoint, .-write_checkpoint
+	.section	.text.startup,"ax",@progbits
+	.p2align 4
+	.globl	main
+	.type	main, @function
+main:
+.LFB217:
+	.cfi_startproc
+	pushq	%r13	# 53	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 16
+	.cfi_offset 13, -16
+	movl	$11112, %edx	# 15	[c=4 l=5]  *movdi_internal/2
+	pushq	%r12	# 54	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 24
+	.cfi_offset 12, -24
+	movq	%rsi, %r12	# 3	[c=4 l=3]  *movdi_internal/3
+	xorl	%esi, %esi	# 74	[c=4 l=2]  *movdi_xor
+	pushq	%rbp	# 55	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 32
+	.cfi_offset 6, -32
+	movl	%edi, %ebp	# 2	[c=4 l=2]  *movsi_internal/0
+	pushq	%rbx	# 56	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 40
+	.cfi_offset 3, -40
+	leaq	cx.2(%rip), %rbx	# 12	[c=1 l=7]  *movdi_internal/4
+	movq	%rbx, %rdi	# 17	[c=4 l=3]  *movdi_internal/3
+	subq	$24, %rsp	# 57	[c=4 l=4]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_def_cfa_offset 64
+	movq	stderr(%rip), %r13	# 7	[c=6 l=7]  *movdi_internal/3
+	movq	stdin(%rip), %xmm0	# 48	[c=6 l=9]  *movdi_internal/14
+	movhps	stdout(%rip), %xmm0	# 10	[c=4 l=7]  vec_concatv2di/7
+	movaps	%xmm0, (%rsp)	# 51	[c=4 l=4]  movv2di_internal/3
+	call	memset@PLT	# 18	[c=10 l=5]  *call_value
+	movdqa	(%rsp), %xmm0	# 52	[c=9 l=5]  movv2di_internal/2
+	leaq	100(%rbx), %rax	# 23	[c=4 l=4]  *leadi
+	movq	%rbx, %rdi	# 31	[c=4 l=3]  *movdi_internal/3
+	movq	%r13, 912+cx.2(%rip)	# 29	[c=4 l=7]  *movdi_internal/5
+	movq	%rax, 104+cx.2(%rip)	# 50	[c=4 l=7]  *movdi_internal/5
+	movl	$-1, 10896+cx.2(%rip)	# 25	[c=4 l=10]  *movsi_internal/1
+	movaps	%xmm0, 896+cx.2(%rip)	# 27	[c=4 l=7]  movv2di_internal/3
+	call	events_init@PLT	# 32	[c=0 l=5]  *call
+	addq	$24, %rsp	# 68	[c=4 l=4]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_def_cfa_offset 40
+	movq	%r12, %rdx	# 33	[c=4 l=3]  *movdi_internal/3
+	movl	%ebp, %esi	# 34	[c=4 l=2]  *movsi_internal/0
+	movq	%rbx, %rdi	# 36	[c=4 l=3]  *movdi_internal/3
+	popq	%rbx	# 69	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 32
+	popq	%rbp	# 70	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 24
+	popq	%r12	# 71	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 16
+	popq	%r13	# 72	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 8
+	jmp	run_context	# 37	[c=10 l=5]  *sibcall_value
+	.cfi_endproc
+.LFE217:
+	.size	main, .-main
+	.section	.rodata.str1.1
+.LC77:
+	.string	"%s: out of memory\n"
+	.text
+	.p2align 4
+	.globl	job_main
+	.type	job_main, @function
+job_main:
+.LFB218:
+	.cfi_startproc
+	pushq	%r15	# 70	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	movq	%rdx, %r15	# 4	[c=4 l=3]  *movdi_internal/3
+	pushq	%r14	# 71	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	movq	%rcx, %r14	# 5	[c=4 l=3]  *movdi_internal/3
+	pushq	%r13	# 72	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	movq	%r9, %r13	# 7	[c=4 l=3]  *movdi_internal/3
+	pushq	%r12	# 73	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	movq	%r8, %r12	# 6	[c=4 l=3]  *movdi_internal/3
+	pushq	%rbp	# 74	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	movq	%rsi, %rbp	# 3	[c=4 l=3]  *movdi_internal/3
+	movl	$1, %esi	# 12	[c=4 l=5]  *movdi_internal/2
+	pushq	%rbx	# 75	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$24, %rsp	# 76	[c=4 l=4]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_def_cfa_offset 80
+	movl	%edi, 12(%rsp)	# 2	[c=4 l=4]  *movsi_internal/1
+	movl	$11112, %edi	# 13	[c=4 l=5]  *movdi_internal/2
+	call	calloc@PLT	# 14	[c=10 l=5]  *call_value
+	testq	%rax, %rax	# 17	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L1745	# 18	[c=13 l=2]  *jcc
+	movq	%rax, %rbx	# 87	[c=4 l=3]  *movdi_internal/3
+	leaq	100(%rax), %rax	# 69	[c=4 l=4]  *leadi
+	movl	$0, 0(%r13)	# 30	[c=4 l=8]  *movsi_internal/1
+	pxor	%xmm0, %xmm0	# 31	[c=4 l=4]  movv2di_internal/0
+	movq	%rax, 104(%rbx)	# 35	[c=4 l=4]  *movdi_internal/5
+	movq	%rbx, %rdi	# 40	[c=4 l=3]  *movdi_internal/3
+	movq	$0, 24(%r13)	# 33	[c=4 l=8]  *movdi_internal/5
+	movl	$-1, 10896(%rbx)	# 36	[c=4 l=10]  *movsi_internal/1
+	movq	%r15, 896(%rbx)	# 37	[c=4 l=7]  *movdi_internal/5
+	movq	%r14, 904(%rbx)	# 38	[c=4 l=7]  *movdi_internal/5
+	movq	%r12, 912(%rbx)	# 39	[c=4 l=7]  *movdi_internal/5
+	movups	%xmm0, 8(%r13)	# 32	[c=4 l=5]  movv2di_internal/3
+	call	events_init@PLT	# 41	[c=0 l=5]  *call
+	movl	12(%rsp), %esi	# 44	[c=9 l=4]  *movsi_internal/0
+	movq	%rbp, %rdx	# 43	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rdi	# 45	[c=4 l=3]  *movdi_internal/3
+	movq	%r13, 11016(%rbx)	# 42	[c=4 l=7]  *movdi_internal/5
+	call	run_context	# 46	[c=10 l=5]  *call_value
+	movq	%rbx, %rdi	# 48	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, %ebp	# 47	[c=4 l=2]  *movsi_internal/0
+	call	free@PLT	# 49	[c=0 l=5]  *call
+.L1741:
+	addq	$24, %rsp	# 79	[c=4 l=4]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	movl	%ebp, %eax	# 55	[c=4 l=2]  *movsi_internal/0
+	popq	%rbx	# 80	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 48
+	popq	%rbp	# 81	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 40
+	popq	%r12	# 82	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 32
+	popq	%r13	# 83	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 24
+	popq	%r14	# 84	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 16
+	popq	%r15	# 85	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 8
+	ret		# 86	[c=0 l=1]  simple_return_internal
+.L1745:
+	.cfi_restore_state
+	movq	0(%rbp), %rdx	# 20	[c=5 l=4]  *movdi_internal/3
+	leaq	.LC77(%rip), %rsi	# 21	[c=1 l=7]  *movdi_internal/4
+	movq	%r12, %rdi	# 23	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 91	[c=4 l=2]  *movdi_xor
+	movl	$20, %ebp	# 9	[c=4 l=5]  *movsi_internal/0
+	call	fprintf@PLT	# 25	[c=10 l=5]  *call_value
+	jmp	.L1741	# 93	[c=1 l=2]  jump
+	.cfi_endproc
+.LFE218:
+	.size	job_main, .-job_main
+	.section	.rodata
+	.align 16
+	.type	CSWTCH.146, @object
+	.size	CSWTCH.146, 20
+CSWTCH.146:
+	.long	1
+	.long	0
+	.long	2
+	.long	0
+	.long	3
+	.align 16
+	.type	se.0, @object
+	.size	se.0, 24
+se.0:
+	.value	83
+	.byte	1
+	.zero	1
+	.value	85
+	.byte	32
+	.zero	1
+	.value	85
+	.byte	64
+	.zero	1
+	.value	85
+	.byte	-128
+	.zero	1
+	.value	58
+	.byte	1
+	.zero	1
+	.value	72
+	.byte	1
+	.zero	1
+	.section	.data.rel.ro.local,"aw"
+	.align 32
+	.type	handler.1, @object
+	.size	handler.1, 896
+handler.1:
+	.quad	.L248
+	.quad	.L249
+	.quad	.L253
+	.quad	.L254
+	.quad	.L274
+	.quad	.L284
+	.quad	.L293
+	.quad	.L300
+	.quad	.L307
+	.quad	.L316
+	.quad	.L324
+	.quad	.L332
+	.quad	.L339
+	.quad	.L344
+	.quad	.L347
+	.quad	.L354
+	.quad	.L361
+	.quad	.L368
+	.quad	.L376
+	.quad	.L403
+	.quad	.L414
+	.quad	.L422
+	.quad	.L431
+	.quad	.L438
+	.quad	.L446
+	.quad	.L452
+	.quad	.L458
+	.quad	.L466
+	.quad	.L467
+	.quad	.L498
+	.quad	.L506
+	.quad	.L510
+	.quad	.L515
+	.quad	.L523
+	.quad	.L532
+	.quad	.L558
+	.quad	.L567
+	.quad	.L576
+	.quad	.L585
+	.quad	.L612
+	.quad	.L616
+	.quad	.L622
+	.quad	.L630
+	.quad	.L634
+	.quad	.L636
+	.quad	.L643
+	.quad	.L650
+	.quad	.L656
+	.quad	.L662
+	.quad	.L668
+	.quad	.L674
+	.quad	.L680
+	.quad	.L686
+	.quad	.L692
+	.quad	.L698
+	.quad	.L704
+	.quad	.L705
+	.quad	.L707
+	.quad	.L709
+	.quad	.L717
+	.quad	.L720
+	.quad	.L721
+	.quad	.L730
+	.quad	.L739
+	.quad	.L748
+	.quad	.L756
+	.quad	.L757
+	.quad	.L766
+	.quad	.L774
+	.quad	.L780
+	.quad	.L795
+	.quad	.L811
+	.quad	.L837
+	.quad	.L863
+	.quad	.L895
+	.quad	.L899
+	.quad	.L907
+	.quad	.L914
+	.quad	.L920
+	.quad	.L931
+	.quad	.L939
+	.quad	.L947
+	.quad	.L955
+	.quad	.L963
+	.quad	.L968
+	.quad	.L973
+	.quad	.L978
+	.quad	.L983
+	.quad	.L989
+	.quad	.L990
+	.quad	.L997
+	.quad	.L1004
+	.quad	.L1010
+	.quad	.L1016
+	.quad	.L1022
+	.quad	.L1028
+	.quad	.L1034
+	.quad	.L1040
+	.quad	.L1046
+	.quad	.L1052
+	.quad	.L1058
+	.quad	.L1067
+	.quad	.L1075
+	.quad	.L1077
+	.quad	.L1078
+	.quad	.L1086
+	.quad	.L1094
+	.quad	.L1102
+	.quad	.L1110
+	.quad	.L1111
+	.quad	.L1112
+	.quad	.L1113
+	.local	cx.2
+	.comm	cx.2,11112,32
+	.globl	opcodes
+	.section	.rodata.str1.1
+.LC78:
+	.string	"bad PC"
+.LC79:
+	.string	"ILLEGAL"
+.LC80:
+	.string	""
+.LC81:
+	.string	"*** SYSCALL"
+.LC82:
+	.string	"ADC"
+.LC83:
+	.string	"ADD"
+.LC84:
+	.string	"ADIW"
+.LC85:
+	.string	"SBIW"
+.LC86:
+	.string	"AND"
+.LC87:
+	.string	"ANDI"
+.LC88:
+	.string	"ASR"
+.LC89:
+	.string	"CL*"
+.LC90:
+	.string	"BLD.*"
+.LC91:
+	.string	"BREAK"
+.LC92:
+	.string	"BR*C"
+.LC93:
+	.string	"BR*S"
+.LC94:
+	.string	"SE*"
+.LC95:
+	.string	"BST.*"
+.LC96:
+	.string	"CALL"
+.LC97:
+	.string	"CBI.*"
+.LC98:
+	.string	"COM"
+.LC99:
+	.string	"CP"
+.LC100:
+	.string	"CPC"
+.LC101:
+	.string	"CPI"
+.LC102:
+	.string	"CPSE"
+.LC103:
+	.string	"DEC"
+.LC104:
+	.string	"DES"
+.LC105:
+	.string	"EICALL"
+.LC106:
+	.string	"EIJMP"
+.LC107:
+	.string	"ELPM"
+.LC108:
+	.string	"ELPM Z"
+.LC109:
+	.string	"ELPM Z+"
+.LC110:
+	.string	"EOR"
+.LC111:
+	.string	"ESPM"
+.LC112:
+	.string	"FMUL"
+.LC113:
+	.string	"FMULS"
+.LC114:
+	.string	"FMULSU"
+.LC115:
+	.string	"ICALL"
+.LC116:
+	.string	"IJMP"
+.LC117:
+	.string	"IN"
+.LC118:
+	.string	"INC"
+.LC119:
+	.string	"JMP"
+.LC120:
+	.string	"LDI"
+.LC121:
+	.string	"LDD Y+q"
+.LC122:
+	.string	"LDD Z+q"
+.LC123:
+	.string	"LDS"
+.LC124:
+	.string	"LD X"
+.LC125:
+	.string	"LD -X"
+.LC126:
+	.string	"LD X+"
+.LC127:
+	.string	"LD -Y"
+.LC128:
+	.string	"LD Y+"
+.LC129:
+	.string	"LD -Z"
+.LC130:
+	.string	"LD Z+"
+.LC131:
+	.string	"LPM"
+.LC132:
+	.string	"LPM Z"
+.LC133:
+	.string	"LPM Z+"
+.LC134:
+	.string	"LSR"
+.LC135:
+	.string	"MOV"
+.LC136:
+	.string	"MOVW"
+.LC137:
+	.string	"MUL"
+.LC138:
+	.string	"MULS"
+.LC139:
+	.string	"MULSU"
+.LC140:
+	.string	"NEG"
+.LC141:
+	.string	"NOP"
+.LC142:
+	.string	"OR"
+.LC143:
+	.string	"ORI"
+.LC144:
+	.string	"OUT"
+.LC145:
+	.string	"POP"
+.LC146:
+	.string	"PUSH"
+.LC147:
+	.string	"RCALL"
+.LC148:
+	.string	"RET"
+.LC149:
+	.string	"RETI"
+.LC150:
+	.string	"RJMP"
+.LC151:
+	.string	"ROR"
+.LC152:
+	.string	"SBC"
+.LC153:
+	.string	"SBCI"
+.LC154:
+	.string	"SBI.*"
+.LC155:
+	.string	"SBIC.*"
+.LC156:
+	.string	"SBIS.*"
+.LC157:
+	.string	"SBRC.*"
+.LC158:
+	.string	"SBRS.*"
+.LC159:
+	.string	"SLEEP"
+.LC160:
+	.string	"SPM"
+.LC161:
+	.string	"STD Y+q"
+.LC162:
+	.string	"STD Z+q"
+.LC163:
+	.string	"STS"
+.LC164:
+	.string	"ST X"
+.LC165:
+	.string	"ST -X"
+.LC166:
+	.string	"ST X+"
+.LC167:
+	.string	"ST -Y"
+.LC168:
+	.string	"ST Y+"
+.LC169:
+	.string	"ST -Z"
+.LC170:
+	.string	"ST Z+"
+.LC171:
+	.string	"SUB"
+.LC172:
+	.string	"SUBI"
+.LC173:
+	.string	"SWAP"
+.LC174:
+	.string	"WDR"
+.LC175:
+	.string	"CLR"
+.LC176:
+	.string	"LSL"
+.LC177:
+	.string	"ROL"
+.LC178:
+	.string	"TST"
+.LC179:
+	.string	"XCH"
+.LC180:
+	.string	"LAS"
+.LC181:
+	.string	"LAC"
+.LC182:
+	.string	"LAT"
+	.section	.data.rel.ro.local
+	.align 32
+	.type	opcodes, @object
+	.size	opcodes, 1792
+opcodes:
+	.quad	.LC78
+	.value	0
+	.value	0
+	.zero	4
+	.quad	.LC79
+	.value	0
+	.value	0
+	.zero	4
+	.quad	.LC80
+	.value	0
+	.value	0
+	.zero	4
+	.quad	.LC81
+	.value	2
+	.value	0
+	.zero	4
+	.quad	.LC82
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC83
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC84
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC85
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC86
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC87
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC88
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC89
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC90
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC91
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC92
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC93
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC94
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC95
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC96
+	.value	2
+	.value	4
+	.zero	4
+	.quad	.LC97
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC98
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC99
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC100
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC101
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC102
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC102
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC103
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC104
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC105
+	.value	1
+	.value	4
+	.zero	4
+	.quad	.LC106
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC107
+	.value	1
+	.value	3
+	.zero	4
+	.quad	.LC108
+	.value	1
+	.value	3
+	.zero	4
+	.quad	.LC109
+	.value	1
+	.value	3
+	.zero	4
+	.quad	.LC110
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC111
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC112
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC113
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC114
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC115
+	.value	1
+	.value	3
+	.zero	4
+	.quad	.LC116
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC117
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC118
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC119
+	.value	2
+	.value	3
+	.zero	4
+	.quad	.LC120
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC121
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC122
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC123
+	.value	2
+	.value	2
+	.zero	4
+	.quad	.LC123
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC124
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC125
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC126
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC127
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC128
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC129
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC130
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC131
+	.value	1
+	.value	3
+	.zero	4
+	.quad	.LC132
+	.value	1
+	.value	3
+	.zero	4
+	.quad	.LC133
+	.value	1
+	.value	3
+	.zero	4
+	.quad	.LC134
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC135
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC136
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC137
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC138
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC139
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC140
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC141
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC142
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC143
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC144
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC145
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC146
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC147
+	.value	1
+	.value	3
+	.zero	4
+	.quad	.LC148
+	.value	1
+	.value	4
+	.zero	4
+	.quad	.LC149
+	.value	1
+	.value	4
+	.zero	4
+	.quad	.LC150
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC151
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC152
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC153
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC154
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC155
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC155
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC156
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC156
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC157
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC157
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC158
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC158
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC159
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC160
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC161
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC162
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC163
+	.value	2
+	.value	2
+	.zero	4
+	.quad	.LC163
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC164
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC165
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC166
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC167
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC168
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC169
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC170
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC171
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC172
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC173
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC174
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC175
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC176
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC177
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC178
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC179
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC180
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC181
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC182
+	.value	1
+	.value	1
+	.zero	4
+	.globl	named_sfr
+	.section	.rodata.str1.1
+.LC183:
+	.string	"SPL"
+.LC184:
+	.string	"SPH"
+.LC185:
+	.string	"RAMPZ"
+.LC186:
+	.string	"RAMPY"
+.LC187:
+	.string	"RAMPX"
+.LC188:
+	.string	"RAMPD"
+.LC189:
+	.string	"EIND"
+	.section	.data.rel.ro.local
+	.align 32
+	.type	named_sfr, @object
+	.size	named_sfr, 192
+named_sfr:
+	.long	61
+	.zero	4
+	.quad	.LC183
+	.long	0
+	.zero	4
+	.long	62
+	.zero	4
+	.quad	.LC184
+	.long	0
+	.zero	4
+	.long	59
+	.zero	4
+	.quad	.LC185
+	.long	0
+	.zero	4
+	.long	58
+	.zero	4
+	.quad	.LC186
+	.long	1
+	.zero	4
+	.long	57
+	.zero	4
+	.quad	.LC187
+	.long	1
+	.zero	4
+	.long	56
+	.zero	4
+	.quad	.LC188
+	.long	1
+	.zero	4
+	.long	60
+	.zero	4
+	.quad	.LC189
+	.long	2
+	.zero	4
+	.long	0
+	.zero	4
+	.quad	0
+	.long	0
+	.zero	4
+	.globl	addr_SPL
+	.section	.rodata
+	.align 4
+	.type	addr_SPL, @object
+	.size	addr_SPL, 4
+addr_SPL:
+	.long	61
+	.globl	addr_SREG
+	.align 4
+	.type	addr_SREG, @object
+	.size	addr_SREG, 4
+addr_SREG:
+	.long	63
+	.section	.rodata.str1.1
+.LC190:
+	.string	"EXIT"
+.LC191:
+	.string	"TIMEOUT"
+.LC192:
+	.string	"usage"
+.LC193:
+	.string	"memory"
+.LC194:
+	.string	"file i/o"
+.LC195:
+	.string	"FATAL ABORTED"
+.LC196:
+	.string	"fatal"
+	.section	.data.rel.ro.local
+	.align 32
+	.type	exit_status, @object
+	.size	exit_status, 216
+exit_status:
+	.quad	.LC190
+	.quad	0
+	.long	0
+	.long	-1
+	.quad	.LC0
+	.quad	0
+	.long	0
+	.long	1
+	.quad	.LC191
+	.quad	0
+	.long	0
+	.long	10
+	.quad	.LC0
+	.quad	0
+	.long	0
+	.long	11
+	.quad	.LC0
+	.quad	0
+	.long	0
+	.long	12
+	.quad	.LC0
+	.quad	.LC192
+	.long	1
+	.long	21
+	.quad	.LC0
+	.quad	.LC193
+	.long	1
+	.long	20
+	.quad	.LC0
+	.quad	.LC194
+	.long	1
+	.long	22
+	.quad	.LC195
+	.quad	.LC196
+	.long	1
+	.long	42
+	.globl	invalid_opcode
+	.section	.rodata
+	.align 4
+	.type	invalid_opcode, @object
+	.size	invalid_opcode, 4
+invalid_opcode:
+	.long	65535
+	.globl	io_base
+	.align 4
+	.type	io_base, @object
+	.size	io_base, 4
+io_base:
+	.zero	4
+	.globl	is_avrtest_log
+	.type	is_avrtest_log, @object
+	.size	is_avrtest_log, 1
+is_avrtest_log:
+	.byte	1
+	.globl	is_tiny
+	.type	is_tiny, @object
+	.size	is_tiny, 1
+is_tiny:
+	.byte	1
+	.globl	is_xmega
+	.type	is_xmega, @object
+	.size	is_xmega, 1
+is_xmega:
+	.zero	1
+	.align 32
+	.type	flag_update_table_logical, @object
+	.size	flag_update_table_logical, 256
+flag_update_table_logical:
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.ascii	"\024\024\024\024\024\024\024\024\024\024\024\024\024\024\024"
+	.ascii	"\024\024\024\024\024\024\024\024\024\024\024\024\024\024\024"
+	.ascii	"\024\024\024\024\024\024\024\024\024\024\024\024\024\024\024"
+	.ascii	"\024\024\024\024\024\024\024\024\024\024\024\024\024\024\024"
+	.ascii	"\024\024\024\024\024\024\024\024\024\024\024\024\024\024\024"
+	.ascii	"\024\024\024\024\024\024\024\024\024\024\024\024\024\024\024"
+	.ascii	"\024\024\024\024\024\024\024\024\024\024\024\024\024\024\024"
+	.ascii	"\024\024\024\024\024\024\024\024\024\024\024\024\024\024\024"
+	.ascii	"\024\024\024\024\024\024\024\024"
+	.section	.rodata.cst8,"aM",@progbits,8
+	.align 8
+.LC7:
+	.long	0
+	.long	1083129856
+	.align 8
+.LC8:
+	.long	-755914244
+	.long	1062232653
+	.align 8
+.LC9:
+	.long	1202590843
+	.long	1065646817
+	.align 8
+.LC10:
+	.long	0
+	.long	1079574528
+	.section	.rodata.cst2,"aM",@progbits,2
+	.align 2
+.LC49:
+	.byte	1
+	.byte	0
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
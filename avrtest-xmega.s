@@ -0,0 +1,15738 @@
+	.file	"avrtest.c"
+	.text
+	.p2align 4
+	.type	delay_loop, @function
+delay_loop:
+.LFB20:
+	.cfi_startproc
+	movq	%rdi, %r8	# 2	[c=4 l=3]  *movdi_internal/3
+	movq	%rdi, %rdx	# 5	[c=4 l=3]  *movdi_internal/3
+	xorl	%r9d, %r9d	# 229	[c=4 l=3]  *movdi_xor
+	movl	$1, %edi	# 6	[c=4 l=5]  *movsi_internal/0
+	xorl	%ecx, %ecx	# 230	[c=4 l=2]  *movdi_xor
+.L13:
+	movzbl	8(%rdx), %eax	# 16	[c=9 l=4]  *movqi_internal/4
+	cmpb	$65, %al	# 17	[c=4 l=2]  *cmpqi_1/0
+	je	.L2	# 18	[c=13 l=2]  *jcc
+	ja	.L3	# 23	[c=13 l=2]  *jcc
+	cmpb	$14, %al	# 25	[c=4 l=2]  *cmpqi_1/0
+	je	.L4	# 26	[c=13 l=6]  *jcc
+	cmpb	$26, %al	# 28	[c=4 l=2]  *cmpqi_1/0
+	jne	.L33	# 29	[c=13 l=6]  *jcc
+	testl	%ecx, %ecx	# 58	[c=4 l=2]  *cmpsi_ccno_1/0
+	jne	.L7	# 59	[c=13 l=2]  *jcc
+	.p2align 4,,10
+	.p2align 3
+.L31:
+	movzbl	10(%rdx), %r9d	# 61	[c=13 l=5]  *zero_extendqisi2/0
+	movl	$1, %ecx	# 10	[c=4 l=5]  *movsi_internal/0
+.L14:
+	cmpb	$101, %al	# 64	[c=4 l=2]  *cmpqi_1/0
+	movl	%r9d, (%rsi)	# 63	[c=4 l=3]  *movsi_internal/1
+	sete	%r9b	# 65	[c=4 l=4]  *setcc_qi
+.L2:
+	movzbl	9(%rdx), %eax	# 110	[c=13 l=4]  zero_extendqidi2/0
+	addl	$1, %edi	# 113	[c=4 l=3]  *addsi_1/0
+	salq	$4, %rax	# 111	[c=4 l=4]  *ashldi3_1/0
+	addq	%rax, %rdx	# 112	[c=4 l=3]  *adddi_1/0
+	cmpl	$17, %edi	# 115	[c=4 l=3]  *cmpsi_1/0
+	jne	.L13	# 116	[c=13 l=2]  *jcc
+	.p2align 4,,10
+	.p2align 3
+.L7:
+	xorl	%ecx, %ecx	# 226	[c=4 l=2]  *movdi_xor
+.L1:
+	movl	%ecx, %eax	# 152	[c=4 l=2]  *movsi_internal/0
+	ret		# 218	[c=0 l=1]  simple_return_internal
+	.p2align 4,,10
+	.p2align 3
+.L3:
+	cmpb	$77, %al	# 38	[c=4 l=2]  *cmpqi_1/0
+	jne	.L34	# 39	[c=13 l=2]  *jcc
+	testb	%r9b, %r9b	# 71	[c=4 l=3]  *cmpqi_ccno_1/0
+	je	.L7	# 72	[c=13 l=2]  *jcc
+	cmpw	$0, 12(%rdx)	# 74	[c=13 l=5]  *cmphi_ccno_1/1
+	jne	.L7	# 75	[c=13 l=2]  *jcc
+	movl	(%rsi), %eax	# 227	[c=5 l=2]  *movsi_internal/0
+	movzbl	10(%rdx), %r10d	# 77	[c=13 l=5]  *zero_extendqisi2/0
+	addl	%ecx, %eax	# 228	[c=4 l=2]  *addsi_1/0
+	cmpl	%eax, %r10d	# 80	[c=4 l=3]  *cmpsi_1/0
+	jne	.L7	# 81	[c=13 l=2]  *jcc
+	addl	$1, %ecx	# 83	[c=4 l=3]  *addsi_1/0
+	jmp	.L2	# 233	[c=1 l=2]  jump
+	.p2align 4,,10
+	.p2align 3
+.L33:
+	cmpb	$7, %al	# 31	[c=4 l=2]  *cmpqi_1/0
+	jne	.L7	# 32	[c=13 l=2]  *jcc
+	testl	%ecx, %ecx	# 51	[c=4 l=2]  *cmpsi_ccno_1/0
+	jne	.L7	# 52	[c=13 l=2]  *jcc
+	cmpw	$1, 12(%rdx)	# 133	[c=13 l=5]  *cmphi_1/0
+	jne	.L7	# 134	[c=13 l=2]  *jcc
+	movzbl	10(%rdx), %r9d	# 127	[c=13 l=5]  *zero_extendqisi2/0
+	movl	$2, %ecx	# 11	[c=4 l=5]  *movsi_internal/0
+	jmp	.L14	# 235	[c=1 l=5]  jump
+	.p2align 4,,10
+	.p2align 3
+.L34:
+	cmpb	$101, %al	# 41	[c=4 l=2]  *cmpqi_1/0
+	jne	.L7	# 42	[c=13 l=2]  *jcc
+	testl	%ecx, %ecx	# 44	[c=4 l=2]  *cmpsi_ccno_1/0
+	jne	.L7	# 45	[c=13 l=2]  *jcc
+	cmpw	$1, 12(%rdx)	# 145	[c=13 l=5]  *cmphi_1/0
+	jne	.L7	# 146	[c=13 l=2]  *jcc
+	jmp	.L31	# 238	[c=1 l=5]  jump
+	.p2align 4,,10
+	.p2align 3
+.L4:
+	testl	%ecx, %ecx	# 88	[c=4 l=2]  *cmpsi_ccno_1/0
+	je	.L7	# 89	[c=13 l=6]  *jcc
+	cmpw	$2, 12(%rdx)	# 91	[c=13 l=5]  *cmphi_1/0
+	jne	.L7	# 92	[c=13 l=6]  *jcc
+	movsbq	10(%rdx), %rax	# 94	[c=13 l=5]  extendqidi2
+	addq	$1, %rax	# 95	[c=4 l=4]  *adddi_1/0
+	salq	$4, %rax	# 96	[c=4 l=4]  *ashldi3_1/0
+	addq	%rax, %rdx	# 97	[c=4 l=3]  *adddi_1/0
+	cmpq	%rdx, %r8	# 98	[c=4 l=3]  *cmpdi_1/0
+	jne	.L7	# 99	[c=13 l=6]  *jcc
+	movzbl	11(%r8), %eax	# 101	[c=13 l=5]  *zero_extendqisi2/0
+	cmpl	%edi, %eax	# 102	[c=4 l=2]  *cmpsi_1/0
+	je	.L1	# 103	[c=13 l=6]  *jcc
+	jmp	.L7	# 241	[c=1 l=5]  jump
+	.cfi_endproc
+.LFE20:
+	.size	delay_loop, .-delay_loop
+	.p2align 4
+	.type	host_getchar, @function
+host_getchar:
+.LFB208:
+	.cfi_startproc
+	movq	896(%rdi), %rdi	# 6	[c=9 l=7]  *movdi_internal/3
+	jmp	getc@PLT	# 8	[c=10 l=5]  *sibcall_value
+	.cfi_endproc
+.LFE208:
+	.size	host_getchar, .-host_getchar
+	.p2align 4
+	.type	flash_changed, @function
+flash_changed:
+.LFB90:
+	.cfi_startproc
+	pushq	%rbp	# 63	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rdi, %rbp	# 2	[c=4 l=3]  *movdi_internal/3
+	pushq	%rbx	# 64	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	movl	%edx, %ebx	# 4	[c=4 l=2]  *movsi_internal/0
+	subq	$8, %rsp	# 65	[c=4 l=4]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_def_cfa_offset 32
+	call	redecode_flash@PLT	# 11	[c=10 l=5]  *call_value
+	movl	$510, %edx	# 55	[c=4 l=5]  *movsi_internal/0
+	movl	992(%rbp), %ecx	# 61	[c=9 l=6]  *movsi_internal/0
+	cmpl	%edx, %eax	# 56	[c=4 l=2]  *cmpsi_1/0
+	cmovb	%edx, %eax	# 57	[c=8 l=3]  *movsicc_noc/1
+	shrl	%ebx	# 17	[c=4 l=2]  *lshrsi3_1/0
+	leal	1(%rcx), %edx	# 62	[c=4 l=3]  *leasi
+	movl	120(%rbp), %ecx	# 20	[c=9 l=3]  *movsi_internal/0
+	addl	$2, %ebx	# 18	[c=4 l=3]  *addsi_1/0
+	subl	$510, %eax	# 14	[c=4 l=5]  *addsi_1/0
+	cmpl	%ebx, %edx	# 58	[c=4 l=2]  *cmpsi_1/0
+	cmova	%ebx, %edx	# 59	[c=8 l=3]  *movsicc_noc/1
+	testl	%ecx, %ecx	# 21	[c=4 l=2]  *cmpsi_ccno_1/0
+	je	.L37	# 22	[c=13 l=2]  *jcc
+	movl	116(%rbp), %esi	# 50	[c=9 l=3]  *movsi_internal/0
+	cmpl	%esi, %eax	# 51	[c=4 l=2]  *cmpsi_1/0
+	cmova	%esi, %eax	# 52	[c=8 l=3]  *movsicc_noc/1
+	cmpl	%ecx, %edx	# 53	[c=4 l=2]  *cmpsi_1/0
+	cmovb	%ecx, %edx	# 54	[c=8 l=3]  *movsicc_noc/1
+.L37:
+	movl	%eax, 116(%rbp)	# 29	[c=4 l=3]  *movsi_internal/1
+	movl	584(%rbp), %eax	# 79	[c=9 l=6]  *movsi_internal/0
+	movl	%edx, 120(%rbp)	# 28	[c=4 l=3]  *movsi_internal/1
+	testl	%eax, %eax	# 80	[c=4 l=2]  *cmpsi_ccno_1/0
+	jne	.L43	# 31	[c=13 l=2]  *jcc
+	addq	$8, %rsp	# 68	[c=4 l=4]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx	# 69	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 16
+	popq	%rbp	# 70	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 8
+	ret		# 71	[c=0 l=1]  simple_return_internal
+	.p2align 4,,10
+	.p2align 3
+.L43:
+	.cfi_restore_state
+	addq	$8, %rsp	# 75	[c=4 l=4]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_def_cfa_offset 24
+	movq	%rbp, %rdi	# 33	[c=4 l=3]  *movdi_internal/3
+	popq	%rbx	# 76	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 16
+	popq	%rbp	# 77	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 8
+	jmp	hle_forget@PLT	# 34	[c=0 l=5]  *sibcall
+	.cfi_endproc
+.LFE90:
+	.size	flash_changed, .-flash_changed
+	.p2align 4
+	.type	fuse_stat_cmp, @function
+fuse_stat_cmp:
+.LFB17:
+	.cfi_startproc
+	movq	(%rdi), %rax	# 48	[c=5 l=3]  *movdi_internal/3
+	movq	(%rsi), %rdx	# 50	[c=5 l=3]  *movdi_internal/3
+	shrq	$32, %rax	# 9	[c=4 l=4]  *lshrdi3_1/0
+	shrq	$32, %rdx	# 12	[c=4 l=4]  *lshrdi3_1/0
+	cmpl	%edx, %eax	# 14	[c=4 l=2]  *cmpsi_1/0
+	je	.L45	# 15	[c=13 l=2]  *jcc
+	subl	%edx, %eax	# 17	[c=4 l=2]  *subsi_1/0
+	ret		# 45	[c=0 l=1]  simple_return_internal
+	.p2align 4,,10
+	.p2align 3
+.L45:
+	movq	16(%rdi), %rdx	# 22	[c=9 l=4]  *movdi_internal/3
+	movq	16(%rsi), %rcx	# 23	[c=9 l=4]  *movdi_internal/3
+	movl	$1, %eax	# 5	[c=4 l=5]  *movsi_internal/0
+	cmpq	%rcx, %rdx	# 24	[c=4 l=3]  *cmpdi_1/0
+	jb	.L44	# 25	[c=13 l=2]  *jcc
+	cmpq	%rdx, %rcx	# 27	[c=4 l=3]  *cmpdi_1/0
+	sbbl	%eax, %eax	# 30	[c=8 l=2]  *x86_movsicc_0_m1_neg
+.L44:
+	ret		# 54	[c=0 l=1]  simple_return_internal
+	.cfi_endproc
+.LFE17:
+	.size	fuse_stat_cmp, .-fuse_stat_cmp
+	.p2align 4
+	.type	fuse_window.part.0.constprop.0, @function
+fuse_window.part.0.constprop.0:
+.LFB236:
+	.cfi_startproc
+	movzbl	8(%rsi), %eax	# 21	[c=9 l=4]  *movqi_internal/4
+	movq	%rdi, %rcx	# 2	[c=4 l=3]  *movdi_internal/3
+	movb	%al, (%rdx)	# 22	[c=4 l=2]  *movqi_internal/8
+	cmpb	$25, %al	# 25	[c=4 l=2]  *cmpqi_1/0
+	jbe	.L80	# 26	[c=13 l=6]  *jcc
+	subl	$28, %eax	# 328	[c=4 l=3]  *addsi_1/0
+	cmpb	$60, %al	# 57	[c=4 l=2]  *cmpqi_1/0
+	ja	.L52	# 58	[c=13 l=2]  *jcc
+	movabsq	$2303723150795361347, %r8	# 319	[c=1 l=10]  *movdi_internal/4
+	movl	$1, %edi	# 10	[c=4 l=5]  *movsi_internal/0
+	btq	%rax, %r8	# 317	[c=4 l=4]  *btdi/0
+	jc	.L48	# 318	[c=13 l=6]  *jcc
+.L52:
+	movzbl	9(%rsi), %eax	# 61	[c=13 l=4]  zero_extendqidi2/0
+	salq	$4, %rax	# 62	[c=4 l=4]  *ashldi3_1/0
+	addq	%rax, %rsi	# 63	[c=4 l=3]  *adddi_1/0
+	movl	992(%rcx), %eax	# 64	[c=10 l=6]  *zero_extendsidi2/3
+	salq	$4, %rax	# 65	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rcx), %rax	# 67	[c=13 l=7]  *adddi_1/1
+	cmpq	%rsi, %rax	# 68	[c=4 l=3]  *cmpdi_1/0
+	jb	.L68	# 69	[c=13 l=6]  *jcc
+	cmpb	$0, 11(%rsi)	# 71	[c=13 l=4]  *cmpqi_ccno_1/1
+	je	.L68	# 72	[c=13 l=6]  *jcc
+	movzbl	8(%rsi), %eax	# 74	[c=9 l=4]  *movqi_internal/4
+	movb	%al, 1(%rdx)	# 75	[c=4 l=3]  *movqi_internal/8
+	cmpb	$25, %al	# 78	[c=4 l=2]  *cmpqi_1/0
+	jbe	.L81	# 79	[c=13 l=6]  *jcc
+	subl	$28, %eax	# 327	[c=4 l=3]  *addsi_1/0
+	cmpb	$60, %al	# 110	[c=4 l=2]  *cmpqi_1/0
+	ja	.L58	# 111	[c=13 l=2]  *jcc
+	movabsq	$2303723150795361347, %r8	# 321	[c=1 l=10]  *movdi_internal/4
+	movl	$2, %edi	# 11	[c=4 l=5]  *movsi_internal/0
+	btq	%rax, %r8	# 313	[c=4 l=4]  *btdi/0
+	jc	.L48	# 314	[c=13 l=6]  *jcc
+.L58:
+	movzbl	9(%rsi), %eax	# 114	[c=13 l=4]  zero_extendqidi2/0
+	salq	$4, %rax	# 115	[c=4 l=4]  *ashldi3_1/0
+	addq	%rax, %rsi	# 116	[c=4 l=3]  *adddi_1/0
+	movl	992(%rcx), %eax	# 117	[c=10 l=6]  *zero_extendsidi2/3
+	salq	$4, %rax	# 118	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rcx), %rax	# 120	[c=13 l=7]  *adddi_1/1
+	cmpq	%rsi, %rax	# 121	[c=4 l=3]  *cmpdi_1/0
+	jb	.L72	# 122	[c=13 l=6]  *jcc
+	cmpb	$0, 11(%rsi)	# 124	[c=13 l=4]  *cmpqi_ccno_1/1
+	je	.L72	# 125	[c=13 l=6]  *jcc
+	movzbl	8(%rsi), %eax	# 127	[c=9 l=4]  *movqi_internal/4
+	movb	%al, 2(%rdx)	# 128	[c=4 l=3]  *movqi_internal/8
+	cmpb	$25, %al	# 131	[c=4 l=2]  *cmpqi_1/0
+	jbe	.L82	# 132	[c=13 l=6]  *jcc
+	subl	$28, %eax	# 326	[c=4 l=3]  *addsi_1/0
+	cmpb	$60, %al	# 163	[c=4 l=2]  *cmpqi_1/0
+	ja	.L62	# 164	[c=13 l=2]  *jcc
+	movabsq	$2303723150795361347, %r8	# 323	[c=1 l=10]  *movdi_internal/4
+	movl	$3, %edi	# 8	[c=4 l=5]  *movsi_internal/0
+	btq	%rax, %r8	# 309	[c=4 l=4]  *btdi/0
+	jc	.L48	# 310	[c=13 l=2]  *jcc
+.L62:
+	movzbl	9(%rsi), %eax	# 167	[c=13 l=4]  zero_extendqidi2/0
+	salq	$4, %rax	# 168	[c=4 l=4]  *ashldi3_1/0
+	addq	%rax, %rsi	# 169	[c=4 l=3]  *adddi_1/0
+	movl	992(%rcx), %eax	# 170	[c=10 l=6]  *zero_extendsidi2/3
+	salq	$4, %rax	# 171	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rcx), %rax	# 173	[c=13 l=7]  *adddi_1/1
+	cmpq	%rsi, %rax	# 174	[c=4 l=3]  *cmpdi_1/0
+	jb	.L76	# 175	[c=13 l=6]  *jcc
+	cmpb	$0, 11(%rsi)	# 177	[c=13 l=4]  *cmpqi_ccno_1/1
+	je	.L76	# 178	[c=13 l=6]  *jcc
+	movzbl	8(%rsi), %eax	# 180	[c=9 l=4]  *movqi_internal/4
+	movl	$4, %edi	# 18	[c=4 l=5]  *movsi_internal/0
+	movb	%al, 3(%rdx)	# 181	[c=4 l=3]  *movqi_internal/8
+.L48:
+	movl	%edi, %eax	# 199	[c=4 l=2]  *movsi_internal/0
+	ret		# 331	[c=0 l=1]  simple_return_internal
+	.p2align 4,,10
+	.p2align 3
+.L80:
+	movl	$50651151, %r8d	# 320	[c=4 l=6]  *movdi_internal/2
+	movl	$1, %edi	# 7	[c=4 l=5]  *movsi_internal/0
+	btq	%rax, %r8	# 315	[c=4 l=4]  *btdi/0
+	jnc	.L52	# 316	[c=13 l=6]  *jcc
+	movl	%edi, %eax	# 343	[c=4 l=2]  *movsi_internal/0
+	ret		# 346	[c=0 l=1]  simple_return_internal
+	.p2align 4,,10
+	.p2align 3
+.L82:
+	movl	$50651151, %r8d	# 324	[c=4 l=6]  *movdi_internal/2
+	movl	$3, %edi	# 9	[c=4 l=5]  *movsi_internal/0
+	btq	%rax, %r8	# 307	[c=4 l=4]  *btdi/0
+	jnc	.L62	# 308	[c=13 l=2]  *jcc
+	jmp	.L48	# 362	[c=1 l=2]  jump
+	.p2align 4,,10
+	.p2align 3
+.L81:
+	movl	$50651151, %r8d	# 322	[c=4 l=6]  *movdi_internal/2
+	movl	$2, %edi	# 6	[c=4 l=5]  *movsi_internal/0
+	btq	%rax, %r8	# 311	[c=4 l=4]  *btdi/0
+	jnc	.L58	# 312	[c=13 l=6]  *jcc
+	movl	%edi, %eax	# 351	[c=4 l=2]  *movsi_internal/0
+	ret		# 354	[c=0 l=1]  simple_return_internal
+	.p2align 4,,10
+	.p2align 3
+.L68:
+	movl	$1, %edi	# 16	[c=4 l=5]  *movsi_internal/0
+	jmp	.L48	# 364	[c=1 l=2]  jump
+.L72:
+	movl	$2, %edi	# 17	[c=4 l=5]  *movsi_internal/0
+	jmp	.L48	# 366	[c=1 l=2]  jump
+.L76:
+	movl	$3, %edi	# 15	[c=4 l=5]  *movsi_internal/0
+	jmp	.L48	# 368	[c=1 l=5]  jump
+	.cfi_endproc
+.LFE236:
+	.size	fuse_window.part.0.constprop.0, .-fuse_window.part.0.constprop.0
+	.p2align 4
+	.type	fuse_lookup, @function
+fuse_lookup:
+.LFB14:
+	.cfi_startproc
+	pushq	%r15	# 92	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	xorl	%r15d, %r15d	# 118	[c=4 l=3]  *movdi_xor
+	pushq	%r14	# 93	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13	# 94	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12	# 95	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp	# 96	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx	# 97	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$24, %rsp	# 98	[c=4 l=4]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_def_cfa_offset 80
+	cmpb	$0, 11(%rsi)	# 12	[c=13 l=4]  *cmpqi_ccno_1/1
+	je	.L84	# 13	[c=13 l=2]  *jcc
+	leaq	12(%rsp), %rdx	# 91	[c=4 l=5]  *leadi
+	call	fuse_window.part.0.constprop.0	# 19	[c=10 l=5]  *call_value
+	movl	%eax, %r15d	# 20	[c=4 l=3]  *movsi_internal/0
+.L84:
+	leaq	4+fuse_seq(%rip), %rbx	# 23	[c=1 l=7]  *movdi_internal/4
+	xorl	%ebp, %ebp	# 117	[c=4 l=2]  *movdi_xor
+	movl	$-1, %r13d	# 7	[c=4 l=6]  *movsi_internal/0
+	leaq	12(%rsp), %r14	# 90	[c=4 l=5]  *leadi
+	jmp	.L86	# 125	[c=1 l=2]  jump
+	.p2align 4,,10
+	.p2align 3
+.L93:
+	movslq	%r13d, %rax	# 48	[c=4 l=3]  *extendsidi2_rex64/1
+	leaq	fuse_seq(%rip), %rcx	# 89	[c=1 l=7]  *movdi_internal/4
+	salq	$4, %rax	# 49	[c=4 l=4]  *ashldi3_1/0
+	cmpl	(%rcx,%rax), %r12d	# 76	[c=13 l=4]  *cmpsi_1/1
+	cmovg	%ebp, %r13d	# 77	[c=8 l=4]  *movsicc_noc/1
+	.p2align 4,,10
+	.p2align 3
+.L85:
+	addl	$1, %ebp	# 56	[c=4 l=3]  *addsi_1/0
+	addq	$16, %rbx	# 57	[c=4 l=4]  *adddi_1/0
+	cmpl	$41, %ebp	# 59	[c=4 l=3]  *cmpsi_1/0
+	je	.L92	# 60	[c=13 l=2]  *jcc
+.L86:
+	movl	-4(%rbx), %r12d	# 26	[c=9 l=4]  *movsi_internal/0
+	cmpl	%r15d, %r12d	# 27	[c=4 l=3]  *cmpsi_1/0
+	jg	.L85	# 28	[c=13 l=2]  *jcc
+	movslq	%r12d, %rdx	# 32	[c=4 l=3]  *extendsidi2_rex64/1
+	movq	%r14, %rsi	# 35	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rdi	# 36	[c=4 l=3]  *movdi_internal/3
+	call	memcmp@PLT	# 37	[c=10 l=5]  *call_value
+	testl	%eax, %eax	# 41	[c=4 l=2]  *cmpsi_ccno_1/0
+	jne	.L85	# 42	[c=13 l=2]  *jcc
+	cmpl	$-1, %r13d	# 44	[c=4 l=4]  *cmpsi_1/0
+	jne	.L93	# 45	[c=13 l=2]  *jcc
+	movl	%ebp, %r13d	# 9	[c=4 l=3]  *movsi_internal/0
+	addl	$1, %ebp	# 120	[c=4 l=3]  *addsi_1/0
+	addq	$16, %rbx	# 121	[c=4 l=4]  *adddi_1/0
+	cmpl	$41, %ebp	# 122	[c=4 l=3]  *cmpsi_1/0
+	jne	.L86	# 123	[c=13 l=2]  *jcc
+.L92:
+	addq	$24, %rsp	# 101	[c=4 l=4]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_def_cfa_offset 56
+	movl	%r13d, %eax	# 65	[c=4 l=3]  *movsi_internal/0
+	popq	%rbx	# 102	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 48
+	popq	%rbp	# 103	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 40
+	popq	%r12	# 104	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 32
+	popq	%r13	# 105	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 24
+	popq	%r14	# 106	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 16
+	popq	%r15	# 107	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 8
+	ret		# 108	[c=0 l=1]  simple_return_internal
+	.cfi_endproc
+.LFE14:
+	.size	fuse_lookup, .-fuse_lookup
+	.p2align 4
+	.globl	qprintf
+	.type	qprintf, @function
+qprintf:
+.LFB23:
+	.cfi_startproc
+	subq	$216, %rsp	# 50	[c=4 l=7]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_def_cfa_offset 224
+	movq	%rdx, 48(%rsp)	# 4	[c=4 l=5]  *movdi_internal/5
+	movq	%rcx, 56(%rsp)	# 5	[c=4 l=5]  *movdi_internal/5
+	movq	%r8, 64(%rsp)	# 6	[c=4 l=5]  *movdi_internal/5
+	movq	%r9, 72(%rsp)	# 7	[c=4 l=5]  *movdi_internal/5
+	testb	%al, %al	# 8	[c=4 l=2]  *cmpqi_ccno_1/0
+	je	.L97	# 9	[c=13 l=2]  *jcc
+	movaps	%xmm0, 80(%rsp)	# 10	[c=4 l=5]  movv4sf_internal/3
+	movaps	%xmm1, 96(%rsp)	# 11	[c=4 l=5]  movv4sf_internal/3
+	movaps	%xmm2, 112(%rsp)	# 12	[c=4 l=5]  movv4sf_internal/3
+	movaps	%xmm3, 128(%rsp)	# 13	[c=4 l=8]  movv4sf_internal/3
+	movaps	%xmm4, 144(%rsp)	# 14	[c=4 l=8]  movv4sf_internal/3
+	movaps	%xmm5, 160(%rsp)	# 15	[c=4 l=8]  movv4sf_internal/3
+	movaps	%xmm6, 176(%rsp)	# 16	[c=4 l=8]  movv4sf_internal/3
+	movaps	%xmm7, 192(%rsp)	# 17	[c=4 l=8]  movv4sf_internal/3
+.L97:
+	movl	216(%rdi), %eax	# 58	[c=9 l=6]  *movsi_internal/0
+	testl	%eax, %eax	# 59	[c=4 l=2]  *cmpsi_ccno_1/0
+	je	.L99	# 23	[c=13 l=2]  *jcc
+	addq	$216, %rsp	# 53	[c=4 l=7]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_remember_state
+	.cfi_def_cfa_offset 8
+	ret		# 54	[c=0 l=1]  simple_return_internal
+	.p2align 4,,10
+	.p2align 3
+.L99:
+	.cfi_restore_state
+	leaq	224(%rsp), %rax	# 47	[c=4 l=8]  *leadi
+	movq	904(%rdi), %rdi	# 31	[c=9 l=7]  *movdi_internal/3
+	leaq	8(%rsp), %rdx	# 49	[c=4 l=5]  *leadi
+	movl	$16, 8(%rsp)	# 26	[c=4 l=8]  *movsi_internal/1
+	movq	%rax, 16(%rsp)	# 28	[c=4 l=5]  *movdi_internal/5
+	leaq	32(%rsp), %rax	# 48	[c=4 l=5]  *leadi
+	movl	$48, 12(%rsp)	# 27	[c=4 l=8]  *movsi_internal/1
+	movq	%rax, 24(%rsp)	# 29	[c=4 l=5]  *movdi_internal/5
+	call	vfprintf@PLT	# 35	[c=10 l=5]  *call_value
+	addq	$216, %rsp	# 62	[c=4 l=7]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_def_cfa_offset 8
+	ret		# 63	[c=0 l=1]  simple_return_internal
+	.cfi_endproc
+.LFE23:
+	.size	qprintf, .-qprintf
+	.p2align 4
+	.globl	quit
+	.type	quit, @function
+quit:
+.LFB27:
+	.cfi_startproc
+	subq	$8, %rsp	# 18	[c=4 l=4]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_def_cfa_offset 16
+	movl	%esi, 136(%rdi)	# 7	[c=4 l=6]  *movsi_internal/1
+	movl	$1, %esi	# 9	[c=4 l=5]  *movsi_internal/0
+	movq	128(%rdi), %rdi	# 8	[c=9 l=7]  *movdi_internal/3
+	call	longjmp@PLT	# 11	[c=0 l=5]  *call
+	.cfi_endproc
+.LFE27:
+	.size	quit, .-quit
+	.section	.rodata.str1.1,"aMS",@progbits,1
+.LC0:
+	.string	"ABORTED"
+.LC1:
+	.string	"w"
+.LC2:
+	.string	"%s: cannot write -status=%s\n"
+.LC3:
+	.string	"%d %lu %lu %s\n"
+	.text
+	.p2align 4
+	.type	finish, @function
+finish:
+.LFB28:
+	.cfi_startproc
+	pushq	%r12	# 117	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	pushq	%rbp	# 118	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	movl	%esi, %ebp	# 3	[c=4 l=2]  *movsi_internal/0
+	pushq	%rbx	# 119	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	movl	440(%rdi), %esi	# 132	[c=9 l=6]  *movsi_internal/0
+	movq	%rdi, %rbx	# 2	[c=4 l=3]  *movdi_internal/3
+	testl	%esi, %esi	# 133	[c=4 l=2]  *cmpsi_ccno_1/0
+	jne	.L114	# 10	[c=13 l=2]  *jcc
+.L103:
+	movq	11016(%rbx), %rax	# 62	[c=9 l=7]  *movdi_internal/3
+	testq	%rax, %rax	# 63	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L106	# 64	[c=13 l=2]  *jcc
+	movdqu	40(%rbx), %xmm0	# 114	[c=13 l=5]  movv2di_internal/2
+	movl	76(%rbx), %ecx	# 128	[c=9 l=3]  *movsi_internal/0
+	movl	%ebp, (%rax)	# 66	[c=4 l=2]  *movsi_internal/1
+	leaq	.LC0(%rip), %rdx	# 6	[c=1 l=7]  *movdi_internal/4
+	shufpd	$1, %xmm0, %xmm0	# 70	[c=4 l=5]  sse2_shufpd_v2di/0
+	movups	%xmm0, 8(%rax)	# 71	[c=4 l=4]  movv2di_internal/3
+	testl	%ecx, %ecx	# 129	[c=4 l=2]  *cmpsi_ccno_1/0
+	je	.L115	# 73	[c=13 l=2]  *jcc
+.L107:
+	movq	%rdx, 24(%rax)	# 83	[c=4 l=4]  *movdi_internal/5
+.L106:
+	movl	%ebp, %esi	# 86	[c=4 l=2]  *movsi_internal/0
+	movq	%rbx, %rdi	# 87	[c=4 l=3]  *movdi_internal/3
+	call	quit	# 88	[c=0 l=5]  *call
+.L115:
+	movslq	72(%rbx), %rdx	# 77	[c=13 l=4]  *extendsidi2_rex64/1
+	leaq	exit_status(%rip), %rcx	# 112	[c=1 l=7]  *movdi_internal/4
+	imulq	$24, %rdx, %rdx	# 78	[c=16 l=4]  *muldi3_1/0
+	movq	(%rcx,%rdx), %rdx	# 80	[c=9 l=4]  *movdi_internal/3
+	jmp	.L107	# 136	[c=1 l=2]  jump
+.L114:
+	movq	448(%rdi), %rdi	# 12	[c=9 l=7]  *movdi_internal/3
+	leaq	.LC1(%rip), %rsi	# 13	[c=1 l=7]  *movdi_internal/4
+	call	fopen@PLT	# 16	[c=10 l=5]  *call_value
+	movq	%rax, %r12	# 17	[c=4 l=3]  *movdi_internal/3
+	testq	%rax, %rax	# 19	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L116	# 20	[c=13 l=2]  *jcc
+	cmpl	$0, 76(%rbx)	# 36	[c=13 l=4]  *cmpsi_ccno_1/1
+	leaq	.LC0(%rip), %r9	# 5	[c=1 l=7]  *movdi_internal/4
+	je	.L117	# 37	[c=13 l=2]  *jcc
+.L105:
+	movq	48(%rbx), %rcx	# 48	[c=9 l=4]  *movdi_internal/3
+	movq	40(%rbx), %r8	# 50	[c=9 l=4]  *movdi_internal/3
+	movq	%r12, %rdi	# 55	[c=4 l=3]  *movdi_internal/3
+	movl	%ebp, %edx	# 52	[c=4 l=2]  *movsi_internal/0
+	leaq	.LC3(%rip), %rsi	# 53	[c=1 l=7]  *movdi_internal/4
+	xorl	%eax, %eax	# 130	[c=4 l=2]  *movdi_xor
+	call	fprintf@PLT	# 57	[c=10 l=5]  *call_value
+	movq	%r12, %rdi	# 58	[c=4 l=3]  *movdi_internal/3
+	call	fclose@PLT	# 59	[c=10 l=5]  *call_value
+	jmp	.L103	# 140	[c=1 l=5]  jump
+.L117:
+	movslq	72(%rbx), %rax	# 41	[c=13 l=4]  *extendsidi2_rex64/1
+	leaq	exit_status(%rip), %rdx	# 111	[c=1 l=7]  *movdi_internal/4
+	imulq	$24, %rax, %rax	# 42	[c=16 l=4]  *muldi3_1/0
+	movq	(%rdx,%rax), %r9	# 44	[c=9 l=4]  *movdi_internal/3
+	jmp	.L105	# 142	[c=1 l=2]  jump
+.L116:
+	movq	448(%rbx), %rcx	# 22	[c=9 l=7]  *movdi_internal/3
+	movq	144(%rbx), %rdx	# 23	[c=9 l=7]  *movdi_internal/3
+	leaq	.LC2(%rip), %rsi	# 27	[c=1 l=7]  *movdi_internal/4
+	xorl	%eax, %eax	# 131	[c=4 l=2]  *movdi_xor
+	movq	912(%rbx), %rdi	# 24	[c=9 l=7]  *movdi_internal/3
+	call	fprintf@PLT	# 31	[c=10 l=5]  *call_value
+	jmp	.L103	# 144	[c=1 l=5]  jump
+	.cfi_endproc
+.LFE28:
+	.size	finish, .-finish
+	.p2align 4
+	.globl	set_elf_string_table
+	.type	set_elf_string_table, @function
+set_elf_string_table:
+.LFB57:
+	.cfi_startproc
+	pushq	%rbx	# 26	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	movq	%rdi, %rbx	# 2	[c=4 l=3]  *movdi_internal/3
+	movq	%rsi, 5216(%rdi)	# 9	[c=4 l=7]  *movdi_internal/5
+	movq	%rdx, 5224(%rdi)	# 10	[c=4 l=7]  *movdi_internal/5
+	call	checkpoint_string_table@PLT	# 15	[c=0 l=5]  *call
+	movq	%rbx, %rdi	# 16	[c=4 l=3]  *movdi_internal/3
+	popq	%rbx	# 33	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 8
+	jmp	hle_set_string_table@PLT	# 17	[c=0 l=5]  *sibcall
+	.cfi_endproc
+.LFE57:
+	.size	set_elf_string_table, .-set_elf_string_table
+	.p2align 4
+	.globl	finish_elf_string_table
+	.type	finish_elf_string_table, @function
+finish_elf_string_table:
+.LFB58:
+	.cfi_startproc
+	ret		# 11	[c=0 l=1]  simple_return_internal
+	.cfi_endproc
+.LFE58:
+	.size	finish_elf_string_table, .-finish_elf_string_table
+	.p2align 4
+	.globl	set_elf_function_symbol
+	.type	set_elf_function_symbol, @function
+set_elf_function_symbol:
+.LFB59:
+	.cfi_startproc
+	pushq	%r12	# 32	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	movzbl	%cl, %ecx	# 10	[c=4 l=3]  *zero_extendqisi2/0
+	movq	%rdx, %r12	# 4	[c=4 l=3]  *movdi_internal/3
+	pushq	%rbp	# 33	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	movl	%esi, %ebp	# 3	[c=4 l=2]  *movsi_internal/0
+	pushq	%rbx	# 34	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	movq	%rdi, %rbx	# 2	[c=4 l=3]  *movdi_internal/3
+	call	checkpoint_symbol@PLT	# 15	[c=0 l=5]  *call
+	movq	%r12, %rdx	# 16	[c=4 l=3]  *movdi_internal/3
+	movl	%ebp, %esi	# 17	[c=4 l=2]  *movsi_internal/0
+	movq	%rbx, %rdi	# 18	[c=4 l=3]  *movdi_internal/3
+	call	fork_server_set_function_symbol@PLT	# 19	[c=0 l=5]  *call
+	movq	%r12, %rdx	# 20	[c=4 l=3]  *movdi_internal/3
+	movl	%ebp, %esi	# 21	[c=4 l=2]  *movsi_internal/0
+	movq	%rbx, %rdi	# 22	[c=4 l=3]  *movdi_internal/3
+	popq	%rbx	# 43	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 24
+	popq	%rbp	# 44	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 16
+	popq	%r12	# 45	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 8
+	jmp	hle_set_function_symbol@PLT	# 23	[c=0 l=5]  *sibcall
+	.cfi_endproc
+.LFE59:
+	.size	set_elf_function_symbol, .-set_elf_function_symbol
+	.section	.rodata.str1.8,"aMS",@progbits,1
+	.align 8
+.LC4:
+	.string	"out of memory allocating %u * %u bytes for %s"
+	.text
+	.p2align 4
+	.globl	get_mem
+	.type	get_mem, @function
+get_mem:
+.LFB62:
+	.cfi_startproc
+	pushq	%r13	# 87	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 16
+	.cfi_offset 13, -16
+	movl	%esi, %esi	# 3	[c=1 l=2]  *zero_extendsidi2/3
+	movq	%rdx, %r13	# 4	[c=4 l=3]  *movdi_internal/3
+	pushq	%r12	# 88	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 24
+	.cfi_offset 12, -24
+	movq	%rdi, %r12	# 2	[c=4 l=3]  *movdi_internal/3
+	pushq	%rbp	# 89	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 32
+	.cfi_offset 6, -32
+	movq	%rcx, %rbp	# 5	[c=4 l=3]  *movdi_internal/3
+	pushq	%rbx	# 90	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 40
+	.cfi_offset 3, -40
+	movq	%rsi, %rbx	# 86	[c=4 l=3]  *movdi_internal/3
+	subq	$8, %rsp	# 91	[c=4 l=4]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_def_cfa_offset 48
+	testq	%rdx, %rdx	# 10	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L124	# 11	[c=13 l=2]  *jcc
+	movq	$-33, %rax	# 13	[c=4 l=7]  *movdi_internal/3
+	xorl	%edx, %edx	# 104	[c=4 l=2]  *movdi_xor
+	divq	%r13	# 84	[c=0 l=3]  *udivmoddi4_noext
+	cmpq	%rsi, %rax	# 15	[c=4 l=3]  *cmpdi_1/0
+	jb	.L125	# 16	[c=13 l=2]  *jcc
+.L124:
+	imulq	%r13, %rsi	# 30	[c=16 l=4]  *muldi3_1/2
+	movl	$1, %edi	# 33	[c=4 l=5]  *movdi_internal/2
+	addq	$32, %rsi	# 31	[c=4 l=4]  *adddi_1/0
+	call	calloc@PLT	# 34	[c=10 l=5]  *call_value
+	testq	%rax, %rax	# 38	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L125	# 39	[c=13 l=2]  *jcc
+	movq	984(%r12), %rdx	# 42	[c=9 l=8]  *movdi_internal/3
+	movq	$0, 8(%rax)	# 41	[c=4 l=8]  *movdi_internal/5
+	movq	%rdx, (%rax)	# 43	[c=4 l=3]  *movdi_internal/5
+	testq	%rdx, %rdx	# 44	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L126	# 45	[c=13 l=2]  *jcc
+	movq	%rax, 8(%rdx)	# 47	[c=4 l=4]  *movdi_internal/5
+.L126:
+	movq	%rax, 984(%r12)	# 50	[c=4 l=8]  *movdi_internal/5
+	addq	$8, %rsp	# 94	[c=4 l=4]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	addq	$32, %rax	# 51	[c=4 l=4]  *adddi_1/0
+	popq	%rbx	# 95	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 32
+	popq	%rbp	# 96	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 24
+	popq	%r12	# 97	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 16
+	popq	%r13	# 98	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 8
+	ret		# 99	[c=0 l=1]  simple_return_internal
+.L125:
+	.cfi_restore_state
+	movq	%rbp, %r9	# 18	[c=4 l=3]  *movdi_internal/3
+	movl	%r13d, %r8d	# 19	[c=4 l=3]  *movsi_internal/0
+	movl	%ebx, %ecx	# 20	[c=4 l=2]  *movsi_internal/0
+	movl	$6, %esi	# 23	[c=4 l=5]  *movsi_internal/0
+	leaq	.LC4(%rip), %rdx	# 21	[c=1 l=7]  *movdi_internal/4
+	movq	%r12, %rdi	# 24	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 103	[c=4 l=2]  *movdi_xor
+	call	leave	# 26	[c=0 l=5]  *call
+	.cfi_endproc
+.LFE62:
+	.size	get_mem, .-get_mem
+	.section	.rodata.str1.1
+.LC6:
+	.string	"instructions"
+.LC7:
+	.string	"executed"
+.LC8:
+	.string	"sites"
+.LC9:
+	.string	"superinstruction"
+.LC10:
+	.string	"%-44s %9s %12s  %12s\n"
+.LC12:
+	.string	"%-44s %9u %12lu  %11.2f%%\n"
+.LC13:
+	.string	"-fuse-stats"
+.LC14:
+	.string	"most executed sequence"
+.LC15:
+	.string	"\n%-44s %9s %12s  %12s\n"
+	.text
+	.p2align 4
+	.type	print_fuse_stats, @function
+print_fuse_stats:
+.LFB19:
+	.cfi_startproc
+	pushq	%r15	# 1122	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	xorl	%eax, %eax	# 1166	[c=4 l=2]  *movdi_xor
+	movq	%rdi, %r15	# 2	[c=4 l=3]  *movdi_internal/3
+	movl	$20, %ecx	# 35	[c=4 l=5]  *movdi_internal/2
+	pushq	%r14	# 1123	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13	# 1124	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12	# 1125	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp	# 1126	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx	# 1127	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$664, %rsp	# 1128	[c=4 l=7]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_def_cfa_offset 720
+	leaq	144(%rsp), %r14	# 1117	[c=4 l=8]  *leadi
+	leaq	320(%rsp), %rbp	# 1118	[c=4 l=8]  *leadi
+	movq	%r14, %rdi	# 1032	[c=4 l=3]  *movdi_internal/3
+	rep stosq	# 36	[c=0 l=3]  *rep_stosdi_rex64
+	movl	$41, %ecx	# 41	[c=4 l=5]  *movdi_internal/2
+	movl	$0, (%rdi)	# 37	[c=4 l=6]  *movsi_internal/1
+	movq	%rbp, %rdi	# 1034	[c=4 l=3]  *movdi_internal/3
+	rep stosq	# 42	[c=0 l=3]  *rep_stosdi_rex64
+	movq	10984(%r15), %rax	# 43	[c=9 l=7]  *movdi_internal/3
+	testq	%rax, %rax	# 44	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L137	# 45	[c=13 l=6]  *jcc
+	movl	992(%r15), %ebx	# 47	[c=9 l=7]  *movsi_internal/0
+	movq	1064(%r15), %r11	# 48	[c=9 l=7]  *movdi_internal/3
+	movq	%r15, 32(%rsp)	# 885	[c=4 l=5]  *movdi_internal/5
+	xorl	%r9d, %r9d	# 1165	[c=4 l=3]  *movdi_xor
+	movq	%rbp, 48(%rsp)	# 886	[c=4 l=5]  *movdi_internal/5
+	movl	%ebx, (%rsp)	# 1035	[c=4 l=3]  *movsi_internal/1
+	movq	%r14, 56(%rsp)	# 887	[c=4 l=5]  *movdi_internal/5
+	movq	%rax, 40(%rsp)	# 882	[c=4 l=5]  *movdi_internal/5
+	movq	%r11, %rax	# 883	[c=4 l=3]  *movdi_internal/3
+	movl	%r9d, %r11d	# 884	[c=4 l=3]  *movsi_internal/0
+	movq	%rax, %r9	# 888	[c=4 l=3]  *movdi_internal/3
+	.p2align 4,,10
+	.p2align 3
+.L148:
+	movl	%r11d, %r10d	# 50	[c=1 l=3]  *zero_extendsidi2/3
+	movq	%r10, %rsi	# 1036	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rsi	# 51	[c=4 l=4]  *ashldi3_1/0
+	addq	%r9, %rsi	# 52	[c=4 l=3]  *adddi_1/0
+	cmpb	$0, 11(%rsi)	# 53	[c=13 l=4]  *cmpqi_ccno_1/1
+	je	.L140	# 54	[c=13 l=6]  *jcc
+	movzbl	8(%rsi), %eax	# 60	[c=9 l=4]  *movqi_internal/4
+	cmpb	$25, %al	# 63	[c=4 l=2]  *cmpqi_1/0
+	jbe	.L239	# 64	[c=13 l=6]  *jcc
+	subl	$28, %eax	# 1116	[c=4 l=3]  *addsi_1/0
+	cmpb	$60, %al	# 95	[c=4 l=2]  *cmpqi_1/0
+	ja	.L143	# 96	[c=13 l=2]  *jcc
+	movabsq	$2303723150795361347, %rdi	# 1038	[c=1 l=10]  *movdi_internal/4
+	btq	%rax, %rdi	# 878	[c=4 l=4]  *btdi/0
+	jc	.L140	# 879	[c=13 l=6]  *jcc
+.L143:
+	movq	32(%rsp), %rdi	# 102	[c=9 l=5]  *movdi_internal/3
+	leaq	64(%rsp), %r14	# 99	[c=4 l=5]  *leadi
+	xorl	%r13d, %r13d	# 1164	[c=4 l=3]  *movdi_xor
+	leaq	4+fuse_seq(%rip), %r15	# 105	[c=1 l=7]  *movdi_internal/4
+	movq	%r14, %rdx	# 100	[c=4 l=3]  *movdi_internal/3
+	movl	%r13d, %ebp	# 891	[c=4 l=3]  *movsi_internal/0
+	movl	$-1, %r12d	# 5	[c=4 l=6]  *movsi_internal/0
+	movq	%r15, %r13	# 895	[c=4 l=3]  *movdi_internal/3
+	call	fuse_window.part.0.constprop.0	# 103	[c=10 l=5]  *call_value
+	movq	%r10, 8(%rsp)	# 889	[c=4 l=5]  *movdi_internal/5
+	movl	%r11d, 16(%rsp)	# 890	[c=4 l=5]  *movsi_internal/1
+	movl	%eax, %ebx	# 104	[c=4 l=2]  *movsi_internal/0
+	movq	%r9, 24(%rsp)	# 894	[c=4 l=5]  *movdi_internal/5
+	jmp	.L146	# 1187	[c=1 l=2]  jump
+	.p2align 4,,10
+	.p2align 3
+.L241:
+	movslq	%r12d, %rax	# 130	[c=4 l=3]  *extendsidi2_rex64/1
+	leaq	fuse_seq(%rip), %rdi	# 1039	[c=1 l=7]  *movdi_internal/4
+	salq	$4, %rax	# 131	[c=4 l=4]  *ashldi3_1/0
+	cmpl	(%rdi,%rax), %r15d	# 754	[c=13 l=4]  *cmpsi_1/1
+	cmovg	%ebp, %r12d	# 755	[c=8 l=4]  *movsicc_noc/1
+	.p2align 4,,10
+	.p2align 3
+.L145:
+	addl	$1, %ebp	# 138	[c=4 l=3]  *addsi_1/0
+	addq	$16, %r13	# 139	[c=4 l=4]  *adddi_1/0
+	cmpl	$41, %ebp	# 141	[c=4 l=3]  *cmpsi_1/0
+	je	.L240	# 142	[c=13 l=2]  *jcc
+.L146:
+	movl	-4(%r13), %r15d	# 108	[c=9 l=4]  *movsi_internal/0
+	cmpl	%r15d, %ebx	# 109	[c=4 l=3]  *cmpsi_1/0
+	jl	.L145	# 110	[c=13 l=2]  *jcc
+	movslq	%r15d, %rdx	# 114	[c=4 l=3]  *extendsidi2_rex64/1
+	movq	%r14, %rsi	# 117	[c=4 l=3]  *movdi_internal/3
+	movq	%r13, %rdi	# 118	[c=4 l=3]  *movdi_internal/3
+	call	memcmp@PLT	# 119	[c=10 l=5]  *call_value
+	testl	%eax, %eax	# 123	[c=4 l=2]  *cmpsi_ccno_1/0
+	jne	.L145	# 124	[c=13 l=2]  *jcc
+	cmpl	$-1, %r12d	# 126	[c=4 l=4]  *cmpsi_1/0
+	jne	.L241	# 127	[c=13 l=2]  *jcc
+	movl	%ebp, %r12d	# 7	[c=4 l=3]  *movsi_internal/0
+	addl	$1, %ebp	# 1171	[c=4 l=3]  *addsi_1/0
+	addq	$16, %r13	# 1172	[c=4 l=4]  *adddi_1/0
+	cmpl	$41, %ebp	# 1173	[c=4 l=3]  *cmpsi_1/0
+	jne	.L146	# 1174	[c=13 l=2]  *jcc
+.L240:
+	movq	8(%rsp), %r10	# 897	[c=9 l=5]  *movdi_internal/3
+	movl	16(%rsp), %r11d	# 898	[c=9 l=5]  *movsi_internal/0
+	movq	24(%rsp), %r9	# 900	[c=9 l=5]  *movdi_internal/3
+	cmpl	$-1, %r12d	# 145	[c=4 l=4]  *cmpsi_1/0
+	je	.L140	# 146	[c=13 l=2]  *jcc
+	movq	40(%rsp), %rax	# 1040	[c=9 l=5]  *movdi_internal/3
+	movslq	%r12d, %rsi	# 148	[c=4 l=3]  *extendsidi2_rex64/1
+	addl	$1, 144(%rsp,%rsi,4)	# 155	[c=14 l=8]  *addsi_1/0
+	movq	(%rax,%r10,8), %rax	# 164	[c=10 l=4]  *movdi_internal/3
+	addq	%rax, 320(%rsp,%rsi,8)	# 165	[c=14 l=8]  *adddi_1/0
+.L140:
+	addl	$1, %r11d	# 168	[c=4 l=4]  *addsi_1/0
+	cmpl	%r11d, (%rsp)	# 170	[c=9 l=4]  *cmpsi_1/0
+	jnb	.L148	# 171	[c=13 l=6]  *jcc
+.L245:
+	movq	32(%rsp), %r15	# 901	[c=9 l=5]  *movdi_internal/3
+	leaq	.LC6(%rip), %r9	# 174	[c=1 l=7]  *movdi_internal/4
+	xorl	%eax, %eax	# 1162	[c=4 l=2]  *movdi_xor
+	xorl	%ebx, %ebx	# 1163	[c=4 l=2]  *movdi_xor
+	leaq	.LC7(%rip), %r8	# 175	[c=1 l=7]  *movdi_internal/4
+	leaq	.LC8(%rip), %rcx	# 177	[c=1 l=7]  *movdi_internal/4
+	movq	48(%rsp), %rbp	# 902	[c=9 l=5]  *movdi_internal/3
+	movq	56(%rsp), %r14	# 903	[c=9 l=5]  *movdi_internal/3
+	movq	904(%r15), %rdi	# 173	[c=9 l=7]  *movdi_internal/3
+	leaq	.LC9(%rip), %rdx	# 178	[c=1 l=7]  *movdi_internal/4
+	leaq	.LC10(%rip), %rsi	# 180	[c=1 l=7]  *movdi_internal/4
+	leaq	fuse_seq(%rip), %r13	# 717	[c=1 l=7]  *movdi_internal/4
+	leaq	.LC12(%rip), %r12	# 239	[c=1 l=7]  *movdi_internal/4
+	call	fprintf@PLT	# 184	[c=10 l=5]  *call_value
+	jmp	.L155	# 1191	[c=1 l=2]  jump
+.L243:
+	pxor	%xmm1, %xmm1	# 1246	[c=4 l=4]  movv2df_internal/0
+	cvtsi2sdq	%r8, %xmm1	# 1247	[c=4 l=5]  sse2_cvtsi2sdq/0
+	mulsd	%xmm1, %xmm0	# 215	[c=20 l=4]  *fop_df_comm/1
+	testq	%rax, %rax	# 218	[c=4 l=3]  *cmpdi_ccno_1/0
+	js	.L153	# 219	[c=13 l=6]  *jcc
+.L244:
+	pxor	%xmm1, %xmm1	# 1244	[c=4 l=4]  movv2df_internal/0
+	cvtsi2sdq	%rax, %xmm1	# 1245	[c=4 l=5]  sse2_cvtsi2sdq/0
+.L154:
+	divsd	%xmm1, %xmm0	# 230	[c=68 l=4]  *fop_df_1/2
+.L150:
+	movq	8(%r13), %rdx	# 233	[c=9 l=4]  *movdi_internal/3
+	movq	904(%r15), %rdi	# 234	[c=9 l=7]  *movdi_internal/3
+	movq	%r12, %rsi	# 240	[c=4 l=3]  *movdi_internal/3
+	movl	$1, %eax	# 242	[c=4 l=5]  *movqi_internal/3
+	call	fprintf@PLT	# 243	[c=10 l=5]  *call_value
+.L149:
+	addq	$1, %rbx	# 246	[c=4 l=4]  *adddi_1/0
+	addq	$16, %r13	# 247	[c=4 l=4]  *adddi_1/0
+	cmpq	$41, %rbx	# 249	[c=4 l=4]  *cmpdi_1/0
+	je	.L242	# 250	[c=13 l=6]  *jcc
+.L155:
+	movl	(%r14,%rbx,4), %ecx	# 188	[c=10 l=4]  *movsi_internal/0
+	testl	%ecx, %ecx	# 189	[c=4 l=2]  *cmpsi_ccno_1/0
+	je	.L149	# 190	[c=13 l=2]  *jcc
+	movq	40(%r15), %rax	# 192	[c=9 l=4]  *movdi_internal/3
+	movq	0(%rbp,%rbx,8), %r8	# 194	[c=10 l=5]  *movdi_internal/3
+	pxor	%xmm0, %xmm0	# 786	[c=4 l=4]  *movdf_internal/12
+	testq	%rax, %rax	# 195	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L150	# 196	[c=13 l=2]  *jcc
+	pxor	%xmm0, %xmm0	# 1242	[c=4 l=4]  movv2df_internal/0
+	cvtsi2sdl	0(%r13), %xmm0	# 1243	[c=4 l=6]  sse2_cvtsi2sd/1
+	mulsd	.LC11(%rip), %xmm0	# 200	[c=26 l=8]  *fop_df_comm/1
+	testq	%r8, %r8	# 203	[c=4 l=3]  *cmpdi_ccno_1/0
+	jns	.L243	# 204	[c=13 l=2]  *jcc
+	movq	%r8, %rdx	# 1042	[c=4 l=3]  *movdi_internal/3
+	movq	%r8, %rsi	# 1044	[c=4 l=3]  *movdi_internal/3
+	pxor	%xmm1, %xmm1	# 1240	[c=4 l=4]  movv2df_internal/0
+	shrq	%rdx	# 209	[c=4 l=3]  *lshrdi3_1/0
+	andl	$1, %esi	# 210	[c=4 l=3]  *anddi_1/0
+	orq	%rsi, %rdx	# 211	[c=4 l=3]  *iordi_1/0
+	cvtsi2sdq	%rdx, %xmm1	# 1241	[c=4 l=5]  sse2_cvtsi2sdq/0
+	addsd	%xmm1, %xmm1	# 213	[c=12 l=4]  *fop_df_comm/1
+	mulsd	%xmm1, %xmm0	# 1177	[c=20 l=4]  *fop_df_comm/1
+	testq	%rax, %rax	# 1178	[c=4 l=3]  *cmpdi_ccno_1/0
+	jns	.L244	# 1179	[c=13 l=6]  *jcc
+.L153:
+	movq	%rax, %rdx	# 1046	[c=4 l=3]  *movdi_internal/3
+	andl	$1, %eax	# 225	[c=4 l=3]  *anddi_1/0
+	pxor	%xmm1, %xmm1	# 1238	[c=4 l=4]  movv2df_internal/0
+	shrq	%rdx	# 224	[c=4 l=3]  *lshrdi3_1/0
+	orq	%rax, %rdx	# 226	[c=4 l=3]  *iordi_1/0
+	cvtsi2sdq	%rdx, %xmm1	# 1239	[c=4 l=5]  sse2_cvtsi2sdq/0
+	addsd	%xmm1, %xmm1	# 228	[c=12 l=4]  *fop_df_comm/1
+	jmp	.L154	# 1196	[c=1 l=5]  jump
+.L239:
+	movl	$50651151, %edx	# 880	[c=4 l=5]  *movdi_internal/2
+	btq	%rax, %rdx	# 876	[c=4 l=4]  *btdi/0
+	jnc	.L143	# 877	[c=13 l=6]  *jcc
+	addl	$1, %r11d	# 1182	[c=4 l=4]  *addsi_1/0
+	cmpl	%r11d, (%rsp)	# 1183	[c=9 l=4]  *cmpsi_1/0
+	jnb	.L148	# 1184	[c=13 l=6]  *jcc
+	jmp	.L245	# 1200	[c=1 l=5]  jump
+.L242:
+	movl	992(%r15), %ebx	# 252	[c=9 l=7]  *movsi_internal/0
+	movq	10984(%r15), %rbp	# 253	[c=9 l=7]  *movdi_internal/3
+	xorl	%edx, %edx	# 1160	[c=4 l=2]  *movdi_xor
+	xorl	%eax, %eax	# 1161	[c=4 l=2]  *movdi_xor
+	.p2align 4,,10
+	.p2align 3
+.L156:
+	movl	%eax, %ecx	# 255	[c=1 l=2]  *zero_extendsidi2/3
+	cmpq	$1, 0(%rbp,%rcx,8)	# 874	[c=14 l=6]  *cmpdi_1/0
+	sbbl	$-1, %edx	# 875	[c=4 l=3]  subsi3_carry/0
+	addl	$1, %eax	# 260	[c=4 l=3]  *addsi_1/0
+	cmpl	%eax, %ebx	# 262	[c=4 l=2]  *cmpsi_1/0
+	jnb	.L156	# 263	[c=13 l=2]  *jcc
+	leal	(%rdx,%rdx,2), %eax	# 267	[c=8 l=3]  *leasi
+	addl	%eax, %eax	# 268	[c=4 l=2]  *ashlsi3_1/0
+	cmpl	$16, %eax	# 273	[c=4 l=3]  *cmpsi_1/0
+	jbe	.L191	# 274	[c=13 l=6]  *jcc
+	movl	$16, %edx	# 13	[c=4 l=5]  *movsi_internal/0
+	.p2align 4,,10
+	.p2align 3
+.L158:
+	addl	%edx, %edx	# 276	[c=4 l=2]  *ashlsi3_1/0
+	cmpl	%eax, %edx	# 278	[c=4 l=2]  *cmpsi_1/0
+	jb	.L158	# 279	[c=13 l=2]  *jcc
+	movl	%edx, 8(%rsp)	# 925	[c=4 l=4]  *movsi_internal/1
+	movl	%edx, %esi	# 1104	[c=4 l=2]  *movsi_internal/0
+.L157:
+	movq	%r15, %rdi	# 286	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC13(%rip), %rcx	# 282	[c=1 l=7]  *movdi_internal/4
+	movl	$24, %edx	# 284	[c=4 l=5]  *movdi_internal/2
+	call	get_mem	# 287	[c=10 l=5]  *call_value
+	movq	%rbp, %r9	# 289	[c=4 l=3]  *movdi_internal/3
+	movq	%r15, %rdi	# 931	[c=4 l=3]  *movdi_internal/3
+	movabsq	$-7046029254386353131, %r11	# 341	[c=1 l=10]  *movdi_internal/4
+	movq	%rax, %r14	# 288	[c=4 l=3]  *movdi_internal/3
+	movl	%ebx, %eax	# 290	[c=1 l=2]  *zero_extendsidi2/3
+	xorl	%ebx, %ebx	# 1159	[c=4 l=2]  *movdi_xor
+	addq	$1, %rax	# 291	[c=4 l=4]  *adddi_1/0
+	salq	$4, %rax	# 292	[c=4 l=4]  *ashldi3_1/0
+	movq	%rax, (%rsp)	# 1049	[c=4 l=4]  *movdi_internal/5
+	.p2align 4,,10
+	.p2align 3
+.L160:
+	cmpq	$0, (%r9)	# 295	[c=9 l=4]  *cmpdi_ccno_1/1
+	je	.L162	# 296	[c=13 l=6]  *jcc
+	movq	1064(%rdi), %rsi	# 1157	[c=9 l=7]  *movdi_internal/3
+	addq	%rbx, %rsi	# 1158	[c=4 l=3]  *adddi_1/0
+	cmpb	$0, 11(%rsi)	# 311	[c=13 l=4]  *cmpqi_ccno_1/1
+	je	.L162	# 312	[c=13 l=6]  *jcc
+	leaq	64(%rsp), %r10	# 314	[c=4 l=5]  *leadi
+	movq	%rdi, 16(%rsp)	# 1083	[c=4 l=5]  *movdi_internal/5
+	movq	%r10, %rdx	# 315	[c=4 l=3]  *movdi_internal/3
+	call	fuse_window.part.0.constprop.0	# 318	[c=10 l=5]  *call_value
+	movq	16(%rsp), %rdi	# 1084	[c=9 l=5]  *movdi_internal/3
+	cmpl	$1, %eax	# 322	[c=4 l=3]  *cmpsi_1/0
+	jle	.L162	# 323	[c=13 l=6]  *jcc
+	movl	8(%rsp), %ecx	# 1053	[c=9 l=4]  *movsi_internal/0
+	leaq	66(%rsp), %r8	# 1115	[c=4 l=5]  *leadi
+	leal	1(%rax), %r13d	# 329	[c=5 l=4]  *leadi
+	movl	$2, %r12d	# 16	[c=4 l=6]  *movdi_internal/2
+	leal	-1(%rcx), %ebp	# 1114	[c=4 l=3]  *leasi
+	movl	$16, %ecx	# 17	[c=4 l=5]  *movsi_internal/0
+	.p2align 4,,10
+	.p2align 3
+.L167:
+	movq	%r10, %rax	# 18	[c=4 l=3]  *movdi_internal/3
+	movq	%r12, %rdx	# 19	[c=4 l=3]  *movdi_internal/3
+	.p2align 4,,10
+	.p2align 3
+.L163:
+	movzbl	(%rax), %esi	# 333	[c=9 l=3]  zero_extendqidi2/0
+	salq	$8, %rdx	# 332	[c=4 l=4]  *ashldi3_1/0
+	addq	$1, %rax	# 335	[c=4 l=4]  *adddi_1/0
+	orq	%rsi, %rdx	# 334	[c=4 l=3]  *iordi_1/0
+	cmpq	%rax, %r8	# 337	[c=4 l=3]  *cmpdi_1/0
+	jne	.L163	# 338	[c=13 l=2]  *jcc
+	salq	%cl, %rdx	# 340	[c=4 l=3]  *ashldi3_1/0
+	movq	%rdx, %rax	# 1054	[c=4 l=3]  *movdi_internal/3
+	imulq	%r11, %rax	# 342	[c=16 l=4]  *muldi3_1/2
+	shrq	$32, %rax	# 343	[c=4 l=4]  *lshrdi3_1/0
+	andl	%ebp, %eax	# 345	[c=4 l=2]  *andsi_1/0
+	movl	%eax, %esi	# 346	[c=1 l=2]  *zero_extendsidi2/3
+	leaq	(%rsi,%rsi,2), %rsi	# 349	[c=8 l=4]  *leadi
+	leaq	(%r14,%rsi,8), %r15	# 352	[c=8 l=4]  *leadi
+	movq	(%r15), %rsi	# 353	[c=5 l=3]  *movdi_internal/3
+	testq	%rsi, %rsi	# 356	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L164	# 357	[c=13 l=2]  *jcc
+	cmpq	%rsi, %rdx	# 360	[c=4 l=3]  *cmpdi_1/0
+	jne	.L165	# 361	[c=13 l=2]  *jcc
+	jmp	.L164	# 1203	[c=1 l=2]  jump
+	.p2align 4,,10
+	.p2align 3
+.L246:
+	testq	%rsi, %rsi	# 380	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L164	# 381	[c=13 l=2]  *jcc
+.L165:
+	addl	$1, %eax	# 363	[c=4 l=3]  *addsi_1/0
+	andl	%ebp, %eax	# 364	[c=4 l=2]  *andsi_1/0
+	movl	%eax, %esi	# 365	[c=1 l=2]  *zero_extendsidi2/3
+	leaq	(%rsi,%rsi,2), %rsi	# 368	[c=8 l=4]  *leadi
+	leaq	(%r14,%rsi,8), %r15	# 371	[c=8 l=4]  *leadi
+	movq	(%r15), %rsi	# 372	[c=5 l=3]  *movdi_internal/3
+	cmpq	%rsi, %rdx	# 376	[c=4 l=3]  *cmpdi_1/0
+	jne	.L246	# 377	[c=13 l=2]  *jcc
+.L164:
+	addq	$1, %r12	# 390	[c=4 l=4]  *adddi_1/0
+	movq	%rdx, (%r15)	# 385	[c=4 l=3]  *movdi_internal/5
+	subl	$8, %ecx	# 389	[c=4 l=3]  *addsi_1/0
+	movq	(%r9), %rax	# 387	[c=5 l=3]  *movdi_internal/3
+	addl	$1, 8(%r15)	# 386	[c=13 l=5]  *addsi_1/0
+	addq	$1, %r8	# 391	[c=4 l=4]  *adddi_1/0
+	addq	%rax, 16(%r15)	# 388	[c=13 l=4]  *adddi_1/0
+	cmpq	%r12, %r13	# 393	[c=4 l=3]  *cmpdi_1/0
+	jne	.L167	# 394	[c=13 l=6]  *jcc
+.L162:
+	addq	$8, %r9	# 298	[c=4 l=4]  *adddi_1/0
+	addq	$16, %rbx	# 299	[c=4 l=4]  *adddi_1/0
+	cmpq	%rbx, (%rsp)	# 301	[c=9 l=4]  *cmpdi_1/0
+	jne	.L160	# 302	[c=13 l=6]  *jcc
+	movl	8(%rsp), %eax	# 401	[c=10 l=4]  *zero_extendsidi2/3
+	movq	%rdi, %r15	# 933	[c=4 l=3]  *movdi_internal/3
+	movq	%r14, %r12	# 400	[c=4 l=3]  *movdi_internal/3
+	xorl	%r11d, %r11d	# 1156	[c=4 l=3]  *movdi_xor
+	leaq	(%rax,%rax,2), %rax	# 404	[c=8 l=4]  *leadi
+	leaq	(%r14,%rax,8), %rcx	# 407	[c=8 l=4]  *leadi
+	movq	%r14, %rax	# 20	[c=4 l=3]  *movdi_internal/3
+	.p2align 4,,10
+	.p2align 3
+.L169:
+	cmpq	$0, (%rax)	# 410	[c=9 l=4]  *cmpdi_ccno_1/1
+	je	.L168	# 411	[c=13 l=2]  *jcc
+	movl	%r11d, %edx	# 414	[c=1 l=3]  *zero_extendsidi2/3
+	movdqu	(%rax), %xmm2	# 423	[c=9 l=4]  movv1ti_internal/2
+	addl	$1, %r11d	# 1155	[c=4 l=4]  *addsi_1/0
+	leaq	(%rdx,%rdx,2), %rdx	# 417	[c=8 l=4]  *leadi
+	leaq	(%r14,%rdx,8), %rdx	# 421	[c=8 l=4]  *leadi
+	movups	%xmm2, (%rdx)	# 1057	[c=4 l=3]  movv1ti_internal/3
+	movq	16(%rax), %rsi	# 424	[c=9 l=4]  *movdi_internal/3
+	movq	%rsi, 16(%rdx)	# 425	[c=4 l=4]  *movdi_internal/5
+.L168:
+	addq	$24, %rax	# 428	[c=4 l=4]  *adddi_1/0
+	cmpq	%rcx, %rax	# 430	[c=4 l=3]  *cmpdi_1/0
+	jne	.L169	# 431	[c=13 l=2]  *jcc
+	movl	%r11d, %eax	# 433	[c=1 l=3]  *zero_extendsidi2/3
+	movl	$24, %edx	# 436	[c=4 l=5]  *movdi_internal/2
+	movq	%r14, %rdi	# 438	[c=4 l=3]  *movdi_internal/3
+	movl	%r11d, (%rsp)	# 1085	[c=4 l=4]  *movsi_internal/1
+	movq	%rax, %rsi	# 881	[c=4 l=3]  *movdi_internal/3
+	leaq	fuse_stat_cmp(%rip), %rcx	# 434	[c=1 l=7]  *movdi_internal/4
+	call	qsort@PLT	# 439	[c=0 l=5]  *call
+	movq	904(%r15), %rdi	# 440	[c=9 l=7]  *movdi_internal/3
+	xorl	%eax, %eax	# 1154	[c=4 l=2]  *movdi_xor
+	leaq	.LC6(%rip), %r9	# 441	[c=1 l=7]  *movdi_internal/4
+	leaq	.LC7(%rip), %r8	# 442	[c=1 l=7]  *movdi_internal/4
+	leaq	.LC8(%rip), %rcx	# 444	[c=1 l=7]  *movdi_internal/4
+	leaq	.LC14(%rip), %rdx	# 445	[c=1 l=7]  *movdi_internal/4
+	leaq	.LC15(%rip), %rsi	# 447	[c=1 l=7]  *movdi_internal/4
+	call	fprintf@PLT	# 451	[c=10 l=5]  *call_value
+	movl	(%rsp), %r11d	# 1086	[c=5 l=4]  *movsi_internal/0
+	testl	%r11d, %r11d	# 452	[c=4 l=3]  *cmpsi_ccno_1/0
+	je	.L186	# 453	[c=13 l=6]  *jcc
+	movq	%r15, 24(%rsp)	# 1020	[c=4 l=5]  *movdi_internal/5
+	xorl	%eax, %eax	# 1153	[c=4 l=2]  *movdi_xor
+	leaq	64(%rsp), %rbx	# 724	[c=4 l=5]  *leadi
+	movq	%r12, %r15	# 1021	[c=4 l=3]  *movdi_internal/3
+	movl	$0, (%rsp)	# 24	[c=4 l=7]  *movsi_internal/1
+	leaq	opcode_id(%rip), %r13	# 725	[c=1 l=7]  *movdi_internal/4
+	movq	%r14, 48(%rsp)	# 1017	[c=4 l=5]  *movdi_internal/5
+	movl	%r11d, 40(%rsp)	# 1018	[c=4 l=5]  *movsi_internal/1
+	jmp	.L170	# 1206	[c=1 l=2]  jump
+.L194:
+	movl	%edi, %eax	# 1111	[c=4 l=2]  *movsi_internal/0
+.L175:
+	addl	$1, (%rsp)	# 615	[c=9 l=4]  *addsi_1/0
+	movl	40(%rsp), %edi	# 1080	[c=9 l=4]  *movsi_internal/0
+	addq	$24, %r15	# 616	[c=4 l=4]  *adddi_1/0
+	movl	(%rsp), %ecx	# 1092	[c=5 l=3]  *movsi_internal/0
+	cmpl	%edi, %ecx	# 617	[c=4 l=2]  *cmpsi_1/0
+	je	.L247	# 618	[c=13 l=6]  *jcc
+.L170:
+	movq	(%r15), %rdi	# 1058	[c=5 l=3]  *movdi_internal/3
+	movl	(%rsp), %ecx	# 1087	[c=5 l=3]  *movsi_internal/0
+	shrq	$32, %rdi	# 467	[c=4 l=4]  *lshrdi3_1/0
+	movq	%rdi, 16(%rsp)	# 1089	[c=4 l=5]  *movdi_internal/5
+	movl	%edi, %ebp	# 468	[c=4 l=2]  *movsi_internal/0
+	testl	%ecx, %ecx	# 469	[c=4 l=2]  *cmpsi_ccno_1/0
+	je	.L173	# 470	[c=13 l=2]  *jcc
+	leal	-1(%rcx), %edx	# 473	[c=5 l=3]  *leadi
+	movq	48(%rsp), %rcx	# 1062	[c=9 l=5]  *movdi_internal/3
+	leaq	(%rdx,%rdx,2), %rdx	# 476	[c=8 l=4]  *leadi
+	cmpl	%edi, 4(%rcx,%rdx,8)	# 483	[c=14 l=4]  *cmpsi_1/0
+	jne	.L193	# 484	[c=13 l=6]  *jcc
+.L173:
+	leal	1(%rax), %edi	# 1112	[c=4 l=3]  *leasi
+	movl	%edi, 8(%rsp)	# 1064	[c=4 l=4]  *movsi_internal/1
+	cmpl	$15, %eax	# 490	[c=4 l=3]  *cmpsi_1/0
+	ja	.L194	# 491	[c=13 l=2]  *jcc
+.L174:
+	movl	16(%rsp), %eax	# 1151	[c=9 l=4]  *movsi_internal/0
+	pxor	%xmm0, %xmm0	# 494	[c=4 l=4]  movv1ti_internal/0
+	movq	%rbx, 32(%rsp)	# 781	[c=4 l=5]  *movdi_internal/5
+	xorl	%r14d, %r14d	# 1150	[c=4 l=3]  *movdi_xor
+	movaps	%xmm0, 64(%rsp)	# 812	[c=4 l=5]  movv1ti_internal/3
+	movaps	%xmm0, 80(%rsp)	# 813	[c=4 l=5]  movv1ti_internal/3
+	movaps	%xmm0, 96(%rsp)	# 814	[c=4 l=5]  movv1ti_internal/3
+	movaps	%xmm0, 112(%rsp)	# 815	[c=4 l=5]  movv1ti_internal/3
+	movaps	%xmm0, 128(%rsp)	# 816	[c=4 l=8]  movv1ti_internal/3
+	testl	%eax, %eax	# 1152	[c=4 l=2]  *cmpsi_ccno_1/0
+	jle	.L248	# 502	[c=13 l=6]  *jcc
+	.p2align 4,,10
+	.p2align 3
+.L176:
+	movl	%r14d, %eax	# 1066	[c=4 l=3]  *movsi_internal/0
+	movq	(%r15), %rdx	# 1068	[c=5 l=3]  *movdi_internal/3
+	negl	%eax	# 514	[c=4 l=2]  *negsi_1
+	leal	24(,%rax,8), %ecx	# 517	[c=8 l=7]  *leasi
+	shrq	%cl, %rdx	# 519	[c=4 l=3]  *lshrdi3_1/0
+	movzbl	%dl, %r12d	# 520	[c=4 l=4]  *zero_extendqisi2/0
+	testl	%r14d, %r14d	# 521	[c=4 l=3]  *cmpsi_ccno_1/0
+	jne	.L249	# 522	[c=13 l=2]  *jcc
+	movslq	%r12d, %rdx	# 552	[c=4 l=3]  *extendsidi2_rex64/1
+	movq	%rbx, %rdi	# 556	[c=4 l=3]  *movdi_internal/3
+	movq	0(%r13,%rdx,8), %rsi	# 553	[c=10 l=5]  *movdi_internal/3
+	call	strcat@PLT	# 557	[c=10 l=5]  *call_value
+	cmpl	$1, %ebp	# 558	[c=4 l=3]  *cmpsi_1/0
+	je	.L181	# 559	[c=13 l=2]  *jcc
+	movl	$1, %r14d	# 27	[c=4 l=6]  *movsi_internal/0
+	jmp	.L176	# 1211	[c=1 l=2]  jump
+	.p2align 4,,10
+	.p2align 3
+.L249:
+	movq	%rbx, %rdi	# 525	[c=4 l=3]  *movdi_internal/3
+	addl	$1, %r14d	# 542	[c=4 l=4]  *addsi_1/0
+	call	strlen@PLT	# 526	[c=10 l=5]  *call_value
+	movslq	%r12d, %rdx	# 534	[c=4 l=3]  *extendsidi2_rex64/1
+	movl	$2108192, (%rbx,%rax)	# 532	[c=4 l=7]  *movsi_internal/1
+	movq	0(%r13,%rdx,8), %rsi	# 535	[c=10 l=5]  *movdi_internal/3
+	leaq	3(%rbx,%rax), %rdi	# 538	[c=5 l=5]  *leadi
+	call	strcpy@PLT	# 541	[c=10 l=5]  *call_value
+	cmpl	%ebp, %r14d	# 543	[c=4 l=3]  *cmpsi_1/0
+	jne	.L176	# 544	[c=13 l=2]  *jcc
+.L181:
+	movq	24(%rsp), %rax	# 1065	[c=9 l=5]  *movdi_internal/3
+	movq	16(%r15), %r8	# 505	[c=9 l=4]  *movdi_internal/3
+	pxor	%xmm0, %xmm0	# 28	[c=4 l=4]  *movdf_internal/12
+	movq	40(%rax), %rax	# 504	[c=9 l=4]  *movdi_internal/3
+	testq	%rax, %rax	# 506	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L178	# 507	[c=13 l=2]  *jcc
+	pxor	%xmm0, %xmm0	# 1236	[c=4 l=4]  movv2df_internal/0
+	cvtsi2sdl	16(%rsp), %xmm0	# 1237	[c=4 l=6]  sse2_cvtsi2sd/1
+	mulsd	.LC11(%rip), %xmm0	# 568	[c=26 l=8]  *fop_df_comm/1
+	testq	%r8, %r8	# 571	[c=4 l=3]  *cmpdi_ccno_1/0
+	js	.L182	# 572	[c=13 l=6]  *jcc
+	pxor	%xmm1, %xmm1	# 1234	[c=4 l=4]  movv2df_internal/0
+	cvtsi2sdq	%r8, %xmm1	# 1235	[c=4 l=5]  sse2_cvtsi2sdq/0
+.L183:
+	mulsd	%xmm1, %xmm0	# 583	[c=20 l=4]  *fop_df_comm/1
+	testq	%rax, %rax	# 586	[c=4 l=3]  *cmpdi_ccno_1/0
+	js	.L184	# 587	[c=13 l=6]  *jcc
+	pxor	%xmm1, %xmm1	# 1232	[c=4 l=4]  movv2df_internal/0
+	cvtsi2sdq	%rax, %xmm1	# 1233	[c=4 l=5]  sse2_cvtsi2sdq/0
+.L185:
+	divsd	%xmm1, %xmm0	# 598	[c=68 l=4]  *fop_df_1/2
+.L178:
+	movq	24(%rsp), %rax	# 1076	[c=9 l=5]  *movdi_internal/3
+	movl	8(%r15), %ecx	# 601	[c=9 l=4]  *movsi_internal/0
+	leaq	.LC12(%rip), %rsi	# 609	[c=1 l=7]  *movdi_internal/4
+	movq	32(%rsp), %rdx	# 607	[c=9 l=5]  *movdi_internal/3
+	movq	904(%rax), %rdi	# 603	[c=9 l=7]  *movdi_internal/3
+	movl	$1, %eax	# 611	[c=4 l=5]  *movqi_internal/3
+	call	fprintf@PLT	# 612	[c=10 l=5]  *call_value
+	movl	8(%rsp), %eax	# 30	[c=9 l=4]  *movsi_internal/0
+	jmp	.L175	# 1213	[c=1 l=5]  jump
+.L193:
+	movl	$1, 8(%rsp)	# 25	[c=4 l=8]  *movsi_internal/1
+	jmp	.L174	# 1215	[c=1 l=5]  jump
+.L247:
+	movq	48(%rsp), %r14	# 1023	[c=9 l=5]  *movdi_internal/3
+	movq	24(%rsp), %r15	# 1024	[c=9 l=5]  *movdi_internal/3
+.L186:
+	movq	-24(%r14), %rdx	# 456	[c=9 l=4]  *movdi_internal/3
+	movq	-32(%r14), %rax	# 457	[c=9 l=4]  *movdi_internal/3
+	leaq	-32(%r14), %rdi	# 1113	[c=4 l=4]  *leadi
+	testq	%rdx, %rdx	# 458	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L250	# 459	[c=13 l=2]  *jcc
+	movq	%rax, (%rdx)	# 625	[c=4 l=3]  *movdi_internal/5
+	movq	-32(%r14), %rax	# 726	[c=9 l=4]  *movdi_internal/3
+.L187:
+	testq	%rax, %rax	# 634	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L188	# 635	[c=13 l=2]  *jcc
+	movq	%rdx, 8(%rax)	# 637	[c=4 l=4]  *movdi_internal/5
+.L188:
+	addq	$664, %rsp	# 1142	[c=4 l=7]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx	# 1143	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 48
+	popq	%rbp	# 1144	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 40
+	popq	%r12	# 1145	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 32
+	popq	%r13	# 1146	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 24
+	popq	%r14	# 1147	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 16
+	popq	%r15	# 1148	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 8
+	jmp	free@PLT	# 641	[c=0 l=5]  *sibcall
+.L184:
+	.cfi_restore_state
+	movq	%rax, %rdx	# 1074	[c=4 l=3]  *movdi_internal/3
+	andl	$1, %eax	# 593	[c=4 l=3]  *anddi_1/0
+	pxor	%xmm1, %xmm1	# 1230	[c=4 l=4]  movv2df_internal/0
+	shrq	%rdx	# 592	[c=4 l=3]  *lshrdi3_1/0
+	orq	%rax, %rdx	# 594	[c=4 l=3]  *iordi_1/0
+	cvtsi2sdq	%rdx, %xmm1	# 1231	[c=4 l=5]  sse2_cvtsi2sdq/0
+	addsd	%xmm1, %xmm1	# 596	[c=12 l=4]  *fop_df_comm/1
+	jmp	.L185	# 1218	[c=1 l=5]  jump
+.L182:
+	movq	%r8, %rdx	# 1070	[c=4 l=3]  *movdi_internal/3
+	movq	%r8, %rcx	# 1072	[c=4 l=3]  *movdi_internal/3
+	pxor	%xmm1, %xmm1	# 1228	[c=4 l=4]  movv2df_internal/0
+	shrq	%rdx	# 577	[c=4 l=3]  *lshrdi3_1/0
+	andl	$1, %ecx	# 578	[c=4 l=3]  *anddi_1/0
+	orq	%rcx, %rdx	# 579	[c=4 l=3]  *iordi_1/0
+	cvtsi2sdq	%rdx, %xmm1	# 1229	[c=4 l=5]  sse2_cvtsi2sdq/0
+	addsd	%xmm1, %xmm1	# 581	[c=12 l=4]  *fop_df_comm/1
+	jmp	.L183	# 1220	[c=1 l=5]  jump
+.L248:
+	leaq	64(%rsp), %rax	# 1097	[c=4 l=5]  *leadi
+	movq	%rax, 32(%rsp)	# 723	[c=4 l=5]  *movdi_internal/5
+	jmp	.L181	# 1222	[c=1 l=5]  jump
+.L250:
+	movq	%rax, 984(%r15)	# 630	[c=4 l=7]  *movdi_internal/5
+	jmp	.L187	# 1224	[c=1 l=2]  jump
+.L137:
+	addq	$664, %rsp	# 1131	[c=4 l=7]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx	# 1132	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 48
+	popq	%rbp	# 1133	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 40
+	popq	%r12	# 1134	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 32
+	popq	%r13	# 1135	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 24
+	popq	%r14	# 1136	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 16
+	popq	%r15	# 1137	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 8
+	ret		# 1138	[c=0 l=1]  simple_return_internal
+.L191:
+	.cfi_restore_state
+	movl	$16, 8(%rsp)	# 14	[c=4 l=8]  *movsi_internal/1
+	movl	8(%rsp), %esi	# 1105	[c=9 l=4]  *movsi_internal/0
+	jmp	.L157	# 1226	[c=1 l=5]  jump
+	.cfi_endproc
+.LFE19:
+	.size	print_fuse_stats, .-print_fuse_stats
+	.section	.rodata.str1.1
+.LC17:
+	.string	"-not set-"
+.LC18:
+	.string	"\n"
+	.section	.rodata.str1.8
+	.align 8
+.LC22:
+	.string	"        load: %lu:%02lu.%06lu  = %3lu.%03lu sec  = %6.2f%%,  %10.3f        bytes/ms, 0x%05x = %u bytes\n"
+	.align 8
+.LC23:
+	.string	"      decode: %lu:%02lu.%06lu  = %3lu.%03lu sec  = %6.2f%%,  %10.3f        bytes/ms, 0x%05x = %u bytes\n"
+	.align 8
+.LC24:
+	.string	"     execute: %lu:%02lu.%06lu  = %3lu.%03lu sec  = %6.2f%%,  %10.3f instructions/ms\n"
+	.align 8
+.LC25:
+	.string	" avrtest run: %lu:%02lu.%06lu  = %3lu.%03lu sec  = %6.2f%%,  %10.3f instructions/ms\n"
+	.align 8
+.LC26:
+	.string	" exit status: %s\n      reason: "
+	.section	.rodata.str1.1
+.LC27:
+	.string	"\n     program: %s\n"
+.LC28:
+	.string	" entry point: %06x\n"
+	.section	.rodata.str1.8
+	.align 8
+.LC29:
+	.string	"exit address: %06x\ntotal cycles: %lu\n"
+	.section	.rodata.str1.1
+.LC30:
+	.string	"      asleep: %lu\n"
+.LC31:
+	.string	"total instr.: %lu\n\n"
+.LC32:
+	.string	"\n%s: %s error: "
+	.text
+	.p2align 4
+	.globl	leave
+	.type	leave, @function
+leave:
+.LFB29:
+	.cfi_startproc
+	pushq	%rbp	# 1319	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp	# 1320	[c=4 l=3]  *movdi_internal/3
+	.cfi_def_cfa_register 6
+	pushq	%r15	# 1321	[c=4 l=2]  *pushdi2_rex64/0
+	pushq	%r14	# 1322	[c=4 l=2]  *pushdi2_rex64/0
+	pushq	%r13	# 1323	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_offset 15, -24
+	.cfi_offset 14, -32
+	.cfi_offset 13, -40
+	movq	%rdx, %r13	# 4	[c=4 l=3]  *movdi_internal/3
+	pushq	%r12	# 1324	[c=4 l=2]  *pushdi2_rex64/0
+	pushq	%rbx	# 1325	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_offset 12, -48
+	.cfi_offset 3, -56
+	movq	%rdi, %rbx	# 2	[c=4 l=3]  *movdi_internal/3
+	subq	$312, %rsp	# 1326	[c=4 l=7]  pro_epilogue_adjust_stack_add_di/0
+	movl	%esi, -260(%rbp)	# 3	[c=4 l=6]  *movsi_internal/1
+	movq	%rcx, -200(%rbp)	# 5	[c=4 l=7]  *movdi_internal/5
+	movq	%r8, -192(%rbp)	# 6	[c=4 l=7]  *movdi_internal/5
+	movq	%r9, -184(%rbp)	# 7	[c=4 l=7]  *movdi_internal/5
+	testb	%al, %al	# 8	[c=4 l=2]  *cmpqi_ccno_1/0
+	je	.L331	# 9	[c=13 l=2]  *jcc
+	movaps	%xmm0, -176(%rbp)	# 10	[c=4 l=7]  movv4sf_internal/3
+	movaps	%xmm1, -160(%rbp)	# 11	[c=4 l=7]  movv4sf_internal/3
+	movaps	%xmm2, -144(%rbp)	# 12	[c=4 l=7]  movv4sf_internal/3
+	movaps	%xmm3, -128(%rbp)	# 13	[c=4 l=4]  movv4sf_internal/3
+	movaps	%xmm4, -112(%rbp)	# 14	[c=4 l=4]  movv4sf_internal/3
+	movaps	%xmm5, -96(%rbp)	# 15	[c=4 l=4]  movv4sf_internal/3
+	movaps	%xmm6, -80(%rbp)	# 16	[c=4 l=4]  movv4sf_internal/3
+	movaps	%xmm7, -64(%rbp)	# 17	[c=4 l=4]  movv4sf_internal/3
+.L331:
+	movl	-260(%rbp), %eax	# 1115	[c=9 l=6]  *movsi_internal/0
+	movl	96(%rbx), %edx	# 31	[c=9 l=3]  *movsi_internal/0
+	movl	%eax, 72(%rbx)	# 30	[c=4 l=3]  *movsi_internal/1
+	testl	%edx, %edx	# 32	[c=4 l=2]  *cmpsi_ccno_1/0
+	je	.L254	# 33	[c=13 l=2]  *jcc
+	movq	40(%rbx), %rax	# 1116	[c=9 l=4]  *movdi_internal/3
+	subq	$1, %rax	# 40	[c=4 l=4]  *adddi_1/0
+	subl	$1, %edx	# 1395	[c=4 l=3]  *addsi_4
+	movq	%rax, 40(%rbx)	# 41	[c=4 l=4]  *movdi_internal/5
+	je	.L365	# 44	[c=13 l=6]  *jcc
+.L254:
+	movq	%rbx, %rdi	# 57	[c=4 l=3]  *movdi_internal/3
+	leaq	exit_status(%rip), %r15	# 61	[c=1 l=7]  *movdi_internal/4
+	call	periph_finish@PLT	# 58	[c=0 l=5]  *call
+	movq	%rbx, %rdi	# 59	[c=4 l=3]  *movdi_internal/3
+	call	replay_finish@PLT	# 60	[c=0 l=5]  *call
+	movslq	-260(%rbp), %r12	# 62	[c=13 l=7]  *extendsidi2_rex64/1
+	leaq	.LC18(%rip), %rsi	# 71	[c=1 l=7]  *movdi_internal/4
+	movq	%rbx, %rdi	# 73	[c=4 l=3]  *movdi_internal/3
+	leaq	(%r12,%r12,2), %rax	# 65	[c=8 l=4]  *leadi
+	movl	16(%r15,%rax,8), %r14d	# 70	[c=10 l=5]  *movsi_internal/0
+	xorl	%eax, %eax	# 1392	[c=4 l=2]  *movdi_xor
+	call	qprintf	# 75	[c=0 l=5]  *call
+	movl	232(%rbx), %r11d	# 1393	[c=9 l=7]  *movsi_internal/0
+	testl	%r11d, %r11d	# 1394	[c=4 l=3]  *cmpsi_ccno_1/0
+	je	.L256	# 77	[c=13 l=6]  *jcc
+	testl	%r14d, %r14d	# 79	[c=4 l=3]  *cmpsi_ccno_1/0
+	je	.L257	# 80	[c=13 l=6]  *jcc
+.L364:
+	cmpl	$0, 600(%rbx)	# 82	[c=13 l=7]  *cmpsi_ccno_1/1
+	jne	.L258	# 83	[c=13 l=2]  *jcc
+	cmpl	$0, 584(%rbx)	# 94	[c=13 l=7]  *cmpsi_ccno_1/1
+	je	.L259	# 95	[c=13 l=6]  *jcc
+	cmpl	$0, 488(%rbx)	# 97	[c=13 l=7]  *cmpsi_ccno_1/1
+	je	.L259	# 98	[c=13 l=6]  *jcc
+.L258:
+	cmpl	$0, 216(%rbx)	# 688	[c=13 l=7]  *cmpsi_ccno_1/1
+	je	.L309	# 689	[c=13 l=6]  *jcc
+	movq	904(%rbx), %rdi	# 691	[c=9 l=7]  *movdi_internal/3
+	call	fflush@PLT	# 693	[c=10 l=5]  *call_value
+.L318:
+	leaq	16(%rbp), %rax	# 1228	[c=4 l=4]  *leadi
+	movq	912(%rbx), %r14	# 804	[c=9 l=7]  *movdi_internal/3
+	movl	$24, -256(%rbp)	# 806	[c=4 l=10]  *movsi_internal/1
+	leaq	.LC32(%rip), %rsi	# 818	[c=1 l=7]  *movdi_internal/4
+	movq	%rax, -248(%rbp)	# 808	[c=4 l=7]  *movdi_internal/5
+	leaq	-224(%rbp), %rax	# 1229	[c=4 l=7]  *leadi
+	movq	144(%rbx), %rdx	# 815	[c=9 l=7]  *movdi_internal/3
+	movq	%rax, -240(%rbp)	# 809	[c=4 l=7]  *movdi_internal/5
+	imulq	$24, %r12, %rax	# 812	[c=16 l=4]  *muldi3_1/0
+	movq	%r14, %rdi	# 820	[c=4 l=3]  *movdi_internal/3
+	movl	$48, -252(%rbp)	# 807	[c=4 l=10]  *movsi_internal/1
+	movq	8(%r15,%rax), %rcx	# 816	[c=10 l=5]  *movdi_internal/3
+	xorl	%eax, %eax	# 1352	[c=4 l=2]  *movdi_xor
+	call	fprintf@PLT	# 822	[c=10 l=5]  *call_value
+	leaq	-256(%rbp), %rdx	# 1289	[c=4 l=7]  *leadi
+	movq	%r13, %rsi	# 825	[c=4 l=3]  *movdi_internal/3
+	movq	%r14, %rdi	# 826	[c=4 l=3]  *movdi_internal/3
+	call	vfprintf@PLT	# 827	[c=10 l=5]  *call_value
+	movl	$10, %edi	# 829	[c=4 l=5]  *movsi_internal/0
+	movq	%r14, %rsi	# 828	[c=4 l=3]  *movdi_internal/3
+	call	fputc@PLT	# 830	[c=10 l=5]  *call_value
+	movq	%r14, %rdi	# 831	[c=4 l=3]  *movdi_internal/3
+	call	fflush@PLT	# 832	[c=10 l=5]  *call_value
+.L317:
+	cmpl	$0, -260(%rbp)	# 835	[c=13 l=7]  *cmpsi_ccno_1/1
+	jne	.L324	# 836	[c=13 l=6]  *jcc
+	movl	76(%rbx), %esi	# 838	[c=9 l=3]  *movsi_internal/0
+.L325:
+	movq	%rbx, %rdi	# 852	[c=4 l=3]  *movdi_internal/3
+	call	finish	# 853	[c=0 l=5]  *call
+.L311:
+	cmpl	$0, 600(%rbx)	# 651	[c=13 l=7]  *cmpsi_ccno_1/1
+	jne	.L314	# 652	[c=13 l=6]  *jcc
+.L308:
+	cmpl	$0, 584(%rbx)	# 103	[c=13 l=7]  *cmpsi_ccno_1/1
+	jne	.L260	# 104	[c=13 l=6]  *jcc
+.L259:
+	cmpl	$0, 216(%rbx)	# 698	[c=13 l=7]  *cmpsi_ccno_1/1
+	jne	.L366	# 699	[c=13 l=6]  *jcc
+.L309:
+	leaq	16(%rbp), %rax	# 1225	[c=4 l=4]  *leadi
+	cmpl	$0, 76(%rbx)	# 674	[c=13 l=4]  *cmpsi_ccno_1/1
+	movl	$24, -256(%rbp)	# 670	[c=4 l=10]  *movsi_internal/1
+	leaq	.LC0(%rip), %rdx	# 26	[c=1 l=7]  *movdi_internal/4
+	movq	%rax, -248(%rbp)	# 672	[c=4 l=7]  *movdi_internal/5
+	leaq	-224(%rbp), %rax	# 1226	[c=4 l=7]  *leadi
+	movl	$48, -252(%rbp)	# 671	[c=4 l=10]  *movsi_internal/1
+	movq	%rax, -240(%rbp)	# 673	[c=4 l=7]  *movdi_internal/5
+	jne	.L315	# 675	[c=13 l=2]  *jcc
+	imulq	$24, %r12, %r12	# 707	[c=16 l=4]  *muldi3_1/0
+	movq	(%r15,%r12), %rdx	# 709	[c=9 l=4]  *movdi_internal/3
+.L315:
+	movq	904(%rbx), %rdi	# 712	[c=9 l=7]  *movdi_internal/3
+	leaq	.LC26(%rip), %rsi	# 714	[c=1 l=7]  *movdi_internal/4
+	xorl	%eax, %eax	# 1358	[c=4 l=2]  *movdi_xor
+	call	fprintf@PLT	# 718	[c=10 l=5]  *call_value
+	movq	904(%rbx), %rdi	# 720	[c=9 l=7]  *movdi_internal/3
+	leaq	-256(%rbp), %rdx	# 1291	[c=4 l=7]  *leadi
+	movq	%r13, %rsi	# 722	[c=4 l=3]  *movdi_internal/3
+	call	vfprintf@PLT	# 724	[c=10 l=5]  *call_value
+	movq	80(%rbx), %rdx	# 725	[c=9 l=4]  *movdi_internal/3
+	testq	%rdx, %rdx	# 726	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L367	# 727	[c=13 l=6]  *jcc
+.L320:
+	movq	904(%rbx), %rdi	# 731	[c=9 l=7]  *movdi_internal/3
+	xorl	%eax, %eax	# 1357	[c=4 l=2]  *movdi_xor
+	leaq	.LC27(%rip), %rsi	# 733	[c=1 l=7]  *movdi_internal/4
+	call	fprintf@PLT	# 737	[c=10 l=5]  *call_value
+	testl	%r14d, %r14d	# 738	[c=4 l=3]  *cmpsi_ccno_1/0
+	jne	.L321	# 739	[c=13 l=2]  *jcc
+	movl	8(%rbx), %edx	# 741	[c=9 l=3]  *movsi_internal/0
+	testl	%edx, %edx	# 742	[c=4 l=2]  *cmpsi_ccno_1/0
+	jne	.L368	# 743	[c=13 l=6]  *jcc
+.L322:
+	movl	(%rbx), %eax	# 1227	[c=5 l=2]  *movsi_internal/0
+	movq	48(%rbx), %rcx	# 754	[c=9 l=4]  *movdi_internal/3
+	leaq	.LC29(%rip), %rsi	# 760	[c=1 l=7]  *movdi_internal/4
+	movq	904(%rbx), %rdi	# 757	[c=9 l=7]  *movdi_internal/3
+	leal	(%rax,%rax), %edx	# 1290	[c=12 l=3]  *leasi
+	xorl	%eax, %eax	# 1355	[c=4 l=2]  *movdi_xor
+	call	fprintf@PLT	# 764	[c=10 l=5]  *call_value
+	movq	64(%rbx), %rdx	# 765	[c=9 l=4]  *movdi_internal/3
+	testq	%rdx, %rdx	# 766	[c=4 l=3]  *cmpdi_ccno_1/0
+	jne	.L369	# 767	[c=13 l=6]  *jcc
+.L323:
+	movq	40(%rbx), %rdx	# 778	[c=9 l=4]  *movdi_internal/3
+	movq	904(%rbx), %rdi	# 779	[c=9 l=7]  *movdi_internal/3
+	leaq	.LC31(%rip), %rsi	# 781	[c=1 l=7]  *movdi_internal/4
+	xorl	%eax, %eax	# 1353	[c=4 l=2]  *movdi_xor
+	call	fprintf@PLT	# 785	[c=10 l=5]  *call_value
+.L321:
+	movq	904(%rbx), %rdi	# 788	[c=9 l=7]  *movdi_internal/3
+	call	fflush@PLT	# 790	[c=10 l=5]  *call_value
+	movl	%r14d, %esi	# 791	[c=4 l=3]  *movsi_internal/0
+	movq	%rbx, %rdi	# 792	[c=4 l=3]  *movdi_internal/3
+	call	finish	# 793	[c=0 l=5]  *call
+.L256:
+	cmpl	$0, 536(%rbx)	# 636	[c=13 l=7]  *cmpsi_ccno_1/1
+	je	.L311	# 637	[c=13 l=6]  *jcc
+	testl	%r14d, %r14d	# 640	[c=4 l=3]  *cmpsi_ccno_1/0
+	jne	.L364	# 641	[c=13 l=6]  *jcc
+.L312:
+	movq	%rbx, %rdi	# 607	[c=4 l=3]  *movdi_internal/3
+	call	print_fuse_stats	# 608	[c=0 l=5]  *call
+	cmpl	$0, 600(%rbx)	# 609	[c=13 l=7]  *cmpsi_ccno_1/1
+	je	.L308	# 610	[c=13 l=6]  *jcc
+.L307:
+	movq	%rbx, %rdi	# 627	[c=4 l=3]  *movdi_internal/3
+	call	hle_print_stats@PLT	# 628	[c=0 l=5]  *call
+	cmpl	$0, 216(%rbx)	# 629	[c=13 l=7]  *cmpsi_ccno_1/1
+	je	.L309	# 630	[c=13 l=6]  *jcc
+	movq	904(%rbx), %rdi	# 681	[c=9 l=7]  *movdi_internal/3
+	call	fflush@PLT	# 683	[c=10 l=5]  *call_value
+	jmp	.L317	# 1401	[c=1 l=5]  jump
+.L260:
+	cmpl	$0, 488(%rbx)	# 662	[c=13 l=7]  *cmpsi_ccno_1/1
+	je	.L259	# 663	[c=13 l=6]  *jcc
+.L314:
+	testl	%r14d, %r14d	# 654	[c=4 l=3]  *cmpsi_ccno_1/0
+	jne	.L258	# 655	[c=13 l=6]  *jcc
+	jmp	.L307	# 1404	[c=1 l=2]  jump
+.L324:
+	imulq	$24, %r12, %r12	# 845	[c=16 l=4]  *muldi3_1/0
+	movl	20(%r15,%r12), %esi	# 848	[c=10 l=5]  *movsi_internal/0
+	jmp	.L325	# 1406	[c=1 l=5]  jump
+.L366:
+	movq	904(%rbx), %rdi	# 797	[c=9 l=7]  *movdi_internal/3
+	call	fflush@PLT	# 799	[c=10 l=5]  *call_value
+	testl	%r14d, %r14d	# 800	[c=4 l=3]  *cmpsi_ccno_1/0
+	je	.L317	# 801	[c=13 l=6]  *jcc
+	jmp	.L318	# 1409	[c=1 l=5]  jump
+.L365:
+	movl	(%rbx), %edx	# 46	[c=6 l=2]  *zero_extendsidi2/3
+	salq	$4, %rdx	# 47	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %rdx	# 49	[c=13 l=7]  *adddi_1/1
+	movzbl	11(%rdx), %ecx	# 50	[c=13 l=4]  zero_extendqidi2/0
+	subq	%rcx, %rax	# 51	[c=4 l=3]  *subdi_1/0
+	movq	%rax, 40(%rbx)	# 52	[c=4 l=4]  *movdi_internal/5
+	movzwl	14(%rdx), %eax	# 53	[c=13 l=4]  zero_extendhidi2/0
+	subq	%rax, 48(%rbx)	# 54	[c=13 l=4]  *subdi_1/0
+	jmp	.L254	# 1411	[c=1 l=5]  jump
+.L257:
+	leaq	-256(%rbp), %rdi	# 1318	[c=4 l=7]  *leadi
+	xorl	%esi, %esi	# 1391	[c=4 l=2]  *movdi_xor
+	call	gettimeofday@PLT	# 113	[c=10 l=5]  *call_value
+	movq	-248(%rbp), %rax	# 116	[c=9 l=7]  *movdi_internal/3
+	movq	-256(%rbp), %rcx	# 114	[c=9 l=7]  *movdi_internal/3
+	movq	928(%rbx), %rdx	# 115	[c=9 l=7]  *movdi_internal/3
+	movq	%rax, %rdi	# 1120	[c=4 l=3]  *movdi_internal/3
+	movq	%rcx, %rsi	# 1118	[c=4 l=3]  *movdi_internal/3
+	subq	920(%rbx), %rsi	# 117	[c=13 l=7]  *subdi_1/1
+	subq	%rdx, %rdi	# 118	[c=4 l=3]  *subdi_1/0
+	movq	%rsi, -272(%rbp)	# 1232	[c=4 l=7]  *movdi_internal/5
+	movq	%rdi, -280(%rbp)	# 1231	[c=4 l=7]  *movdi_internal/5
+	cmpq	%rdx, %rax	# 119	[c=4 l=3]  *cmpdi_1/0
+	jnb	.L261	# 120	[c=13 l=2]  *jcc
+	subq	$1, %rsi	# 122	[c=4 l=4]  *adddi_1/0
+	addq	$1000000, %rdi	# 123	[c=4 l=7]  *adddi_1/0
+	movq	%rsi, -272(%rbp)	# 1123	[c=4 l=7]  *movdi_internal/5
+	movq	%rdi, -280(%rbp)	# 1125	[c=4 l=7]  *movdi_internal/5
+.L261:
+	movq	-272(%rbp), %rsi	# 1233	[c=9 l=7]  *movdi_internal/3
+	testq	%rsi, %rsi	# 128	[c=4 l=3]  *cmpdi_ccno_1/0
+	js	.L262	# 129	[c=13 l=6]  *jcc
+	pxor	%xmm2, %xmm2	# 1494	[c=4 l=4]  movv2df_internal/0
+	cvtsi2sdq	%rsi, %xmm2	# 1495	[c=4 l=5]  sse2_cvtsi2sdq/0
+.L263:
+	movsd	.LC19(%rip), %xmm5	# 140	[c=6 l=8]  *movdf_internal/14
+	movq	-280(%rbp), %rdi	# 1235	[c=9 l=7]  *movdi_internal/3
+	mulsd	%xmm5, %xmm2	# 141	[c=20 l=4]  *fop_df_comm/1
+	testq	%rdi, %rdi	# 144	[c=4 l=3]  *cmpdi_ccno_1/0
+	js	.L264	# 145	[c=13 l=6]  *jcc
+	pxor	%xmm0, %xmm0	# 1492	[c=4 l=4]  movv2df_internal/0
+	cvtsi2sdq	%rdi, %xmm0	# 1493	[c=4 l=5]  sse2_cvtsi2sdq/0
+.L265:
+	movsd	.LC20(%rip), %xmm4	# 156	[c=6 l=8]  *movdf_internal/14
+	movq	968(%rbx), %r10	# 159	[c=9 l=7]  *movdi_internal/3
+	movq	%rax, %rsi	# 1138	[c=4 l=3]  *movdi_internal/3
+	movq	976(%rbx), %rdx	# 160	[c=9 l=7]  *movdi_internal/3
+	mulsd	%xmm4, %xmm0	# 157	[c=20 l=4]  *fop_df_comm/1
+	subq	%r10, %rcx	# 161	[c=4 l=3]  *subdi_1/0
+	subq	%rdx, %rsi	# 162	[c=4 l=3]  *subdi_1/0
+	movq	%rcx, -288(%rbp)	# 1238	[c=4 l=7]  *movdi_internal/5
+	movq	%rsi, -296(%rbp)	# 1237	[c=4 l=7]  *movdi_internal/5
+	addsd	%xmm0, %xmm2	# 158	[c=12 l=4]  *fop_df_comm/1
+	cmpq	%rdx, %rax	# 163	[c=4 l=3]  *cmpdi_1/0
+	jnb	.L266	# 164	[c=13 l=2]  *jcc
+	subq	$1, %rcx	# 166	[c=4 l=4]  *adddi_1/0
+	addq	$1000000, %rsi	# 167	[c=4 l=7]  *adddi_1/0
+	movq	%rcx, -288(%rbp)	# 1141	[c=4 l=7]  *movdi_internal/5
+	movq	%rsi, -296(%rbp)	# 1143	[c=4 l=7]  *movdi_internal/5
+.L266:
+	movq	-288(%rbp), %rax	# 1239	[c=9 l=7]  *movdi_internal/3
+	testq	%rax, %rax	# 172	[c=4 l=3]  *cmpdi_ccno_1/0
+	js	.L267	# 173	[c=13 l=6]  *jcc
+	pxor	%xmm1, %xmm1	# 1490	[c=4 l=4]  movv2df_internal/0
+	cvtsi2sdq	%rax, %xmm1	# 1491	[c=4 l=5]  sse2_cvtsi2sdq/0
+.L268:
+	movq	-296(%rbp), %rax	# 1241	[c=9 l=7]  *movdi_internal/3
+	mulsd	%xmm5, %xmm1	# 185	[c=20 l=4]  *fop_df_comm/1
+	testq	%rax, %rax	# 188	[c=4 l=3]  *cmpdi_ccno_1/0
+	js	.L269	# 189	[c=13 l=6]  *jcc
+	pxor	%xmm0, %xmm0	# 1488	[c=4 l=4]  movv2df_internal/0
+	cvtsi2sdq	%rax, %xmm0	# 1489	[c=4 l=5]  sse2_cvtsi2sdq/0
+.L270:
+	mulsd	%xmm4, %xmm0	# 201	[c=20 l=4]  *fop_df_comm/1
+	movq	952(%rbx), %r9	# 203	[c=9 l=7]  *movdi_internal/3
+	movq	960(%rbx), %rax	# 204	[c=9 l=7]  *movdi_internal/3
+	movq	%rdx, %r11	# 1156	[c=4 l=3]  *movdi_internal/3
+	subq	%r9, %r10	# 205	[c=4 l=3]  *subdi_1/0
+	subq	%rax, %r11	# 206	[c=4 l=3]  *subdi_1/0
+	addsd	%xmm0, %xmm1	# 202	[c=12 l=4]  *fop_df_comm/1
+	movsd	%xmm1, -304(%rbp)	# 1155	[c=4 l=8]  *movdf_internal/15
+	cmpq	%rax, %rdx	# 207	[c=4 l=3]  *cmpdi_1/0
+	jnb	.L271	# 208	[c=13 l=2]  *jcc
+	subq	$1, %r10	# 210	[c=4 l=4]  *adddi_1/0
+	addq	$1000000, %r11	# 211	[c=4 l=7]  *adddi_1/0
+.L271:
+	testq	%r10, %r10	# 216	[c=4 l=3]  *cmpdi_ccno_1/0
+	js	.L272	# 217	[c=13 l=6]  *jcc
+	pxor	%xmm3, %xmm3	# 1486	[c=4 l=4]  movv2df_internal/0
+	cvtsi2sdq	%r10, %xmm3	# 1487	[c=4 l=5]  sse2_cvtsi2sdq/0
+.L273:
+	mulsd	%xmm5, %xmm3	# 229	[c=20 l=4]  *fop_df_comm/1
+	testq	%r11, %r11	# 232	[c=4 l=3]  *cmpdi_ccno_1/0
+	js	.L274	# 233	[c=13 l=6]  *jcc
+	pxor	%xmm1, %xmm1	# 1484	[c=4 l=4]  movv2df_internal/0
+	cvtsi2sdq	%r11, %xmm1	# 1485	[c=4 l=5]  sse2_cvtsi2sdq/0
+.L275:
+	mulsd	%xmm4, %xmm1	# 245	[c=20 l=4]  *fop_df_comm/1
+	movq	944(%rbx), %rdx	# 247	[c=9 l=7]  *movdi_internal/3
+	movq	%rax, %r8	# 1166	[c=4 l=3]  *movdi_internal/3
+	subq	936(%rbx), %r9	# 248	[c=13 l=7]  *subdi_1/1
+	subq	%rdx, %r8	# 249	[c=4 l=3]  *subdi_1/0
+	addsd	%xmm1, %xmm3	# 246	[c=12 l=4]  *fop_df_comm/1
+	cmpq	%rdx, %rax	# 250	[c=4 l=3]  *cmpdi_1/0
+	jnb	.L276	# 251	[c=13 l=2]  *jcc
+	subq	$1, %r9	# 253	[c=4 l=4]  *adddi_1/0
+	addq	$1000000, %r8	# 254	[c=4 l=7]  *adddi_1/0
+.L276:
+	testq	%r9, %r9	# 259	[c=4 l=3]  *cmpdi_ccno_1/0
+	js	.L277	# 260	[c=13 l=6]  *jcc
+	pxor	%xmm0, %xmm0	# 1482	[c=4 l=4]  movv2df_internal/0
+	cvtsi2sdq	%r9, %xmm0	# 1483	[c=4 l=5]  sse2_cvtsi2sdq/0
+.L278:
+	mulsd	%xmm5, %xmm0	# 272	[c=20 l=4]  *fop_df_comm/1
+	testq	%r8, %r8	# 275	[c=4 l=3]  *cmpdi_ccno_1/0
+	js	.L279	# 276	[c=13 l=6]  *jcc
+	pxor	%xmm1, %xmm1	# 1480	[c=4 l=4]  movv2df_internal/0
+	cvtsi2sdq	%r8, %xmm1	# 1481	[c=4 l=5]  sse2_cvtsi2sdq/0
+.L280:
+	mulsd	%xmm4, %xmm1	# 288	[c=20 l=4]  *fop_df_comm/1
+	movl	16(%rbx), %esi	# 290	[c=9 l=3]  *movsi_internal/0
+	addsd	%xmm1, %xmm0	# 289	[c=12 l=4]  *fop_df_comm/1
+	comisd	.LC21(%rip), %xmm0	# 292	[c=10 l=8]  *cmpidf/1
+	pxor	%xmm1, %xmm1	# 20	[c=4 l=4]  *movdf_internal/12
+	jbe	.L281	# 293	[c=13 l=2]  *jcc
+	movl	%esi, %eax	# 298	[c=1 l=2]  *zero_extendsidi2/3
+	pxor	%xmm1, %xmm1	# 1478	[c=4 l=4]  movv2df_internal/0
+	cvtsi2sdq	%rax, %xmm1	# 1479	[c=4 l=5]  sse2_cvtsi2sdq/0
+	divsd	%xmm0, %xmm1	# 313	[c=68 l=4]  *fop_df_1/2
+.L281:
+	movl	$1000, %ecx	# 317	[c=4 l=5]  *movdi_internal/2
+	xorl	%edx, %edx	# 1389	[c=4 l=2]  *movdi_xor
+	movq	%r8, %rax	# 1176	[c=4 l=3]  *movdi_internal/3
+	movq	904(%rbx), %rdi	# 326	[c=9 l=7]  *movdi_internal/3
+	divq	%rcx	# 1315	[c=0 l=3]  *udivmoddi4_noext
+	movl	$60, %ecx	# 320	[c=4 l=5]  *movdi_internal/2
+	xorl	%edx, %edx	# 1390	[c=4 l=2]  *movdi_xor
+	movq	%rax, -320(%rbp)	# 1177	[c=4 l=7]  *movdi_internal/5
+	movq	%r9, %rax	# 1178	[c=4 l=3]  *movdi_internal/3
+	divq	%rcx	# 1317	[c=0 l=3]  *udivmoddi4_noext
+	comisd	.LC21(%rip), %xmm2	# 328	[c=10 l=8]  *cmpidf/1
+	movq	%rdx, %rcx	# 1180	[c=4 l=3]  *movdi_internal/3
+	jbe	.L351	# 329	[c=13 l=6]  *jcc
+	movsd	.LC11(%rip), %xmm6	# 334	[c=6 l=8]  *movdf_internal/14
+	movq	%r10, -336(%rbp)	# 1246	[c=4 l=7]  *movdi_internal/5
+	movq	%rax, %rdx	# 346	[c=4 l=3]  *movdi_internal/3
+	movl	$2, %eax	# 350	[c=4 l=5]  *movqi_internal/3
+	movq	%r11, -344(%rbp)	# 1248	[c=4 l=7]  *movdi_internal/5
+	mulsd	%xmm6, %xmm0	# 335	[c=20 l=4]  *fop_df_comm/1
+	movsd	%xmm3, -352(%rbp)	# 1250	[c=4 l=8]  *movdf_internal/15
+	movsd	%xmm2, -328(%rbp)	# 1243	[c=4 l=8]  *movdf_internal/15
+	movsd	%xmm6, -312(%rbp)	# 1245	[c=4 l=8]  *movdf_internal/15
+	pushq	%r10	# 1388	[c=4 l=2]  *pushdi2_rex64/0
+	pushq	%rsi	# 338	[c=4 l=1]  *pushsi2_rex64/0
+	divsd	%xmm2, %xmm0	# 336	[c=68 l=4]  *fop_df_1/2
+	pushq	%rsi	# 339	[c=4 l=1]  *pushsi2_rex64/0
+	leaq	.LC22(%rip), %rsi	# 347	[c=1 l=7]  *movdi_internal/4
+	pushq	-320(%rbp)	# 340	[c=9 l=6]  *pushdi2_rex64/0
+	call	fprintf@PLT	# 351	[c=10 l=5]  *call_value
+	movl	24(%rbx), %eax	# 1183	[c=9 l=3]  *movsi_internal/0
+	movsd	-352(%rbp), %xmm3	# 1251	[c=9 l=8]  *movdf_internal/14
+	addq	$32, %rsp	# 355	[c=4 l=4]  *adddi_1/0
+	movsd	-328(%rbp), %xmm2	# 1244	[c=9 l=8]  *movdf_internal/14
+	movq	-336(%rbp), %r10	# 1247	[c=9 l=7]  *movdi_internal/3
+	leal	1(%rax), %r8d	# 1313	[c=4 l=4]  *leasi
+	subl	20(%rbx), %r8d	# 354	[c=13 l=4]  *subsi_1/1
+	movq	-344(%rbp), %r11	# 1249	[c=9 l=7]  *movdi_internal/3
+	comisd	.LC21(%rip), %xmm3	# 357	[c=10 l=8]  *cmpidf/1
+	jbe	.L370	# 358	[c=13 l=6]  *jcc
+.L287:
+	movl	%r8d, %eax	# 392	[c=1 l=3]  *zero_extendsidi2/3
+	pxor	%xmm1, %xmm1	# 1476	[c=4 l=4]  movv2df_internal/0
+	cvtsi2sdq	%rax, %xmm1	# 1477	[c=4 l=5]  sse2_cvtsi2sdq/0
+	divsd	%xmm3, %xmm1	# 407	[c=68 l=4]  *fop_df_1/2
+.L289:
+	comisd	.LC21(%rip), %xmm2	# 412	[c=10 l=8]  *cmpidf/1
+	movq	904(%rbx), %rdi	# 410	[c=9 l=7]  *movdi_internal/3
+	ja	.L288	# 413	[c=13 l=6]  *jcc
+	movl	$60, %ecx	# 473	[c=4 l=5]  *movdi_internal/2
+	movq	%r10, %rax	# 1199	[c=4 l=3]  *movdi_internal/3
+	xorl	%edx, %edx	# 1377	[c=4 l=2]  *movdi_xor
+	movq	%r10, %r9	# 487	[c=4 l=3]  *movdi_internal/3
+	divq	%rcx	# 1305	[c=0 l=3]  *udivmoddi4_noext
+	movsd	%xmm2, -320(%rbp)	# 1263	[c=4 l=8]  *movdf_internal/15
+	pxor	%xmm0, %xmm0	# 486	[c=4 l=4]  *movdf_internal/12
+	movq	%rax, %rsi	# 1200	[c=4 l=3]  *movdi_internal/3
+	movq	%rdx, %rcx	# 1201	[c=4 l=3]  *movdi_internal/3
+	xorl	%edx, %edx	# 1380	[c=4 l=2]  *movdi_xor
+	pushq	%rax	# 1379	[c=4 l=1]  *pushdi2_rex64/0
+	movq	%r11, %rax	# 1202	[c=4 l=3]  *movdi_internal/3
+	pushq	%r8	# 478	[c=4 l=2]  *pushsi2_rex64/0
+	pushq	%r8	# 479	[c=4 l=2]  *pushsi2_rex64/0
+	movl	$1000, %r8d	# 481	[c=4 l=6]  *movdi_internal/2
+	divq	%r8	# 1307	[c=0 l=3]  *udivmoddi4_noext
+	movq	%rsi, %rdx	# 490	[c=4 l=3]  *movdi_internal/3
+	movq	%r11, %r8	# 488	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC23(%rip), %rsi	# 491	[c=1 l=7]  *movdi_internal/4
+	pushq	%rax	# 483	[c=4 l=1]  *pushdi2_rex64/0
+	movl	$2, %eax	# 494	[c=4 l=5]  *movqi_internal/3
+	call	fprintf@PLT	# 495	[c=10 l=5]  *call_value
+	movsd	-304(%rbp), %xmm7	# 1204	[c=9 l=8]  *movdf_internal/14
+	addq	$32, %rsp	# 497	[c=4 l=4]  *adddi_1/0
+	comisd	.LC21(%rip), %xmm7	# 499	[c=10 l=8]  *cmpidf/1
+	movsd	-320(%rbp), %xmm2	# 1264	[c=9 l=8]  *movdf_internal/14
+	jbe	.L371	# 500	[c=13 l=6]  *jcc
+.L300:
+	movq	40(%rbx), %rax	# 453	[c=9 l=4]  *movdi_internal/3
+	testq	%rax, %rax	# 456	[c=4 l=3]  *cmpdi_ccno_1/0
+	js	.L297	# 457	[c=13 l=6]  *jcc
+	pxor	%xmm1, %xmm1	# 1474	[c=4 l=4]  movv2df_internal/0
+	cvtsi2sdq	%rax, %xmm1	# 1475	[c=4 l=5]  sse2_cvtsi2sdq/0
+.L298:
+	divsd	-304(%rbp), %xmm1	# 468	[c=77 l=8]  *fop_df_1/2
+.L299:
+	comisd	.LC21(%rip), %xmm2	# 505	[c=10 l=8]  *cmpidf/1
+	movq	904(%rbx), %rdi	# 503	[c=9 l=7]  *movdi_internal/3
+	ja	.L295	# 506	[c=13 l=6]  *jcc
+	movq	-288(%rbp), %rax	# 1215	[c=9 l=7]  *movdi_internal/3
+	movl	$60, %ecx	# 557	[c=4 l=5]  *movdi_internal/2
+	xorl	%edx, %edx	# 1365	[c=4 l=2]  *movdi_xor
+	pushq	%r8	# 1367	[c=4 l=2]  *pushdi2_rex64/0
+	movl	$1000, %r8d	# 563	[c=4 l=6]  *movdi_internal/2
+	movq	-288(%rbp), %r9	# 569	[c=9 l=7]  *movdi_internal/3
+	pxor	%xmm0, %xmm0	# 568	[c=4 l=4]  *movdf_internal/12
+	divq	%rcx	# 1297	[c=0 l=3]  *udivmoddi4_noext
+	movq	%rax, %rsi	# 1216	[c=4 l=3]  *movdi_internal/3
+	movq	-296(%rbp), %rax	# 1218	[c=9 l=7]  *movdi_internal/3
+	movq	%rdx, %rcx	# 1217	[c=4 l=3]  *movdi_internal/3
+	xorl	%edx, %edx	# 1368	[c=4 l=2]  *movdi_xor
+	divq	%r8	# 1299	[c=0 l=3]  *udivmoddi4_noext
+	movq	-296(%rbp), %r8	# 570	[c=9 l=7]  *movdi_internal/3
+	movq	%rsi, %rdx	# 572	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC24(%rip), %rsi	# 573	[c=1 l=7]  *movdi_internal/4
+	pushq	%rax	# 565	[c=4 l=1]  *pushdi2_rex64/0
+	movl	$2, %eax	# 576	[c=4 l=5]  *movqi_internal/3
+	call	fprintf@PLT	# 577	[c=10 l=5]  *call_value
+	popq	%r9	# 1369	[c=9 l=2]  *popdi1
+	pxor	%xmm1, %xmm1	# 25	[c=4 l=4]  *movdf_internal/12
+	popq	%r10	# 1370	[c=9 l=2]  *popdi1
+.L305:
+	movq	-272(%rbp), %rax	# 1220	[c=9 l=7]  *movdi_internal/3
+	movl	$60, %ecx	# 582	[c=4 l=5]  *movdi_internal/2
+	xorl	%edx, %edx	# 1359	[c=4 l=2]  *movdi_xor
+	movl	$1000, %r8d	# 589	[c=4 l=6]  *movdi_internal/2
+	movq	904(%rbx), %rdi	# 586	[c=9 l=7]  *movdi_internal/3
+	divq	%rcx	# 1293	[c=0 l=3]  *udivmoddi4_noext
+	movq	%rax, %rsi	# 1221	[c=4 l=3]  *movdi_internal/3
+	pushq	%rax	# 1361	[c=4 l=1]  *pushdi2_rex64/0
+	movq	-280(%rbp), %rax	# 1223	[c=9 l=7]  *movdi_internal/3
+	movq	%rdx, %rcx	# 1222	[c=4 l=3]  *movdi_internal/3
+	xorl	%edx, %edx	# 1362	[c=4 l=2]  *movdi_xor
+	movsd	-312(%rbp), %xmm0	# 593	[c=9 l=8]  *movdf_internal/14
+	movq	-272(%rbp), %r9	# 594	[c=9 l=7]  *movdi_internal/3
+	divq	%r8	# 1295	[c=0 l=3]  *udivmoddi4_noext
+	movq	-280(%rbp), %r8	# 595	[c=9 l=7]  *movdi_internal/3
+	movq	%rsi, %rdx	# 597	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC25(%rip), %rsi	# 598	[c=1 l=7]  *movdi_internal/4
+	pushq	%rax	# 591	[c=4 l=1]  *pushdi2_rex64/0
+	movl	$2, %eax	# 601	[c=4 l=5]  *movqi_internal/3
+	call	fprintf@PLT	# 602	[c=10 l=5]  *call_value
+	cmpl	$0, 536(%rbx)	# 604	[c=13 l=7]  *cmpsi_ccno_1/1
+	popq	%rdx	# 1363	[c=9 l=1]  *popdi1
+	popq	%rcx	# 1364	[c=9 l=1]  *popdi1
+	jne	.L312	# 605	[c=13 l=6]  *jcc
+	cmpl	$0, 600(%rbx)	# 617	[c=13 l=7]  *cmpsi_ccno_1/1
+	jne	.L307	# 618	[c=13 l=6]  *jcc
+	cmpl	$0, 584(%rbx)	# 620	[c=13 l=7]  *cmpsi_ccno_1/1
+	je	.L259	# 621	[c=13 l=6]  *jcc
+	cmpl	$0, 488(%rbx)	# 623	[c=13 l=7]  *cmpsi_ccno_1/1
+	je	.L259	# 624	[c=13 l=6]  *jcc
+	jmp	.L307	# 1416	[c=1 l=5]  jump
+.L369:
+	movq	904(%rbx), %rdi	# 769	[c=9 l=7]  *movdi_internal/3
+	leaq	.LC30(%rip), %rsi	# 771	[c=1 l=7]  *movdi_internal/4
+	xorl	%eax, %eax	# 1354	[c=4 l=2]  *movdi_xor
+	call	fprintf@PLT	# 775	[c=10 l=5]  *call_value
+	jmp	.L323	# 1418	[c=1 l=5]  jump
+.L368:
+	movq	904(%rbx), %rdi	# 745	[c=9 l=7]  *movdi_internal/3
+	leaq	.LC28(%rip), %rsi	# 747	[c=1 l=7]  *movdi_internal/4
+	xorl	%eax, %eax	# 1356	[c=4 l=2]  *movdi_xor
+	call	fprintf@PLT	# 751	[c=10 l=5]  *call_value
+	jmp	.L322	# 1420	[c=1 l=5]  jump
+.L367:
+	leaq	.LC17(%rip), %rdx	# 27	[c=1 l=7]  *movdi_internal/4
+	jmp	.L320	# 1422	[c=1 l=5]  jump
+.L370:
+	movq	904(%rbx), %rdi	# 966	[c=9 l=7]  *movdi_internal/3
+	pxor	%xmm1, %xmm1	# 22	[c=4 l=4]  *movdf_internal/12
+.L288:
+	movl	$60, %ecx	# 422	[c=4 l=5]  *movdi_internal/2
+	movq	%r10, %rax	# 1190	[c=4 l=3]  *movdi_internal/3
+	xorl	%edx, %edx	# 1381	[c=4 l=2]  *movdi_xor
+	movq	%r10, %r9	# 436	[c=4 l=3]  *movdi_internal/3
+	divq	%rcx	# 1309	[c=0 l=3]  *udivmoddi4_noext
+	movsd	%xmm2, -320(%rbp)	# 1261	[c=4 l=8]  *movdf_internal/15
+	mulsd	-312(%rbp), %xmm3	# 420	[c=29 l=8]  *fop_df_comm/1
+	divsd	%xmm2, %xmm3	# 421	[c=68 l=4]  *fop_df_1/2
+	movq	%rax, %rsi	# 1191	[c=4 l=3]  *movdi_internal/3
+	movq	%rdx, %rcx	# 1192	[c=4 l=3]  *movdi_internal/3
+	xorl	%edx, %edx	# 1384	[c=4 l=2]  *movdi_xor
+	pushq	%rax	# 1383	[c=4 l=1]  *pushdi2_rex64/0
+	movq	%r11, %rax	# 1193	[c=4 l=3]  *movdi_internal/3
+	pushq	%r8	# 428	[c=4 l=2]  *pushsi2_rex64/0
+	pushq	%r8	# 429	[c=4 l=2]  *pushsi2_rex64/0
+	movl	$1000, %r8d	# 431	[c=4 l=6]  *movdi_internal/2
+	divq	%r8	# 1311	[c=0 l=3]  *udivmoddi4_noext
+	movq	%rsi, %rdx	# 439	[c=4 l=3]  *movdi_internal/3
+	movq	%r11, %r8	# 437	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC23(%rip), %rsi	# 440	[c=1 l=7]  *movdi_internal/4
+	movapd	%xmm3, %xmm0	# 1189	[c=4 l=4]  *movdf_internal/13
+	pushq	%rax	# 433	[c=4 l=1]  *pushdi2_rex64/0
+	movl	$2, %eax	# 443	[c=4 l=5]  *movqi_internal/3
+	call	fprintf@PLT	# 444	[c=10 l=5]  *call_value
+	movsd	-304(%rbp), %xmm7	# 1195	[c=9 l=8]  *movdf_internal/14
+	addq	$32, %rsp	# 445	[c=4 l=4]  *adddi_1/0
+	comisd	.LC21(%rip), %xmm7	# 447	[c=10 l=8]  *cmpidf/1
+	movsd	-320(%rbp), %xmm2	# 1262	[c=9 l=8]  *movdf_internal/14
+	ja	.L300	# 448	[c=13 l=6]  *jcc
+	movq	904(%rbx), %rdi	# 969	[c=9 l=7]  *movdi_internal/3
+	pxor	%xmm1, %xmm1	# 24	[c=4 l=4]  *movdf_internal/12
+.L295:
+	movq	-288(%rbp), %rax	# 1208	[c=9 l=7]  *movdi_internal/3
+	movl	$60, %ecx	# 515	[c=4 l=5]  *movdi_internal/2
+	xorl	%edx, %edx	# 1373	[c=4 l=2]  *movdi_xor
+	movsd	-304(%rbp), %xmm0	# 1205	[c=9 l=8]  *movdf_internal/14
+	mulsd	-312(%rbp), %xmm0	# 513	[c=29 l=8]  *fop_df_comm/1
+	movsd	%xmm2, -304(%rbp)	# 1267	[c=4 l=8]  *movdf_internal/15
+	movl	$1000, %r8d	# 522	[c=4 l=6]  *movdi_internal/2
+	divq	%rcx	# 1301	[c=0 l=3]  *udivmoddi4_noext
+	divsd	%xmm2, %xmm0	# 514	[c=68 l=4]  *fop_df_1/2
+	movq	%rax, %rsi	# 1209	[c=4 l=3]  *movdi_internal/3
+	pushq	%rax	# 1375	[c=4 l=1]  *pushdi2_rex64/0
+	movq	-296(%rbp), %rax	# 1211	[c=9 l=7]  *movdi_internal/3
+	movq	%rdx, %rcx	# 1210	[c=4 l=3]  *movdi_internal/3
+	xorl	%edx, %edx	# 1376	[c=4 l=2]  *movdi_xor
+	movq	-288(%rbp), %r9	# 527	[c=9 l=7]  *movdi_internal/3
+	divq	%r8	# 1303	[c=0 l=3]  *udivmoddi4_noext
+	movq	-296(%rbp), %r8	# 528	[c=9 l=7]  *movdi_internal/3
+	movq	%rsi, %rdx	# 530	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC24(%rip), %rsi	# 531	[c=1 l=7]  *movdi_internal/4
+	pushq	%rax	# 524	[c=4 l=1]  *pushdi2_rex64/0
+	movl	$2, %eax	# 534	[c=4 l=5]  *movqi_internal/3
+	call	fprintf@PLT	# 535	[c=10 l=5]  *call_value
+	movq	40(%rbx), %rax	# 536	[c=9 l=4]  *movdi_internal/3
+	movsd	-304(%rbp), %xmm2	# 1268	[c=9 l=8]  *movdf_internal/14
+	testq	%rax, %rax	# 539	[c=4 l=3]  *cmpdi_ccno_1/0
+	js	.L303	# 540	[c=13 l=6]  *jcc
+	pxor	%xmm1, %xmm1	# 1472	[c=4 l=4]  movv2df_internal/0
+	cvtsi2sdq	%rax, %xmm1	# 1473	[c=4 l=5]  sse2_cvtsi2sdq/0
+.L304:
+	divsd	%xmm2, %xmm1	# 551	[c=68 l=4]  *fop_df_1/2
+	popq	%r11	# 1371	[c=9 l=2]  *popdi1
+	popq	%rax	# 1372	[c=9 l=1]  *popdi1
+	jmp	.L305	# 1424	[c=1 l=5]  jump
+.L351:
+	movq	%r11, -336(%rbp)	# 1257	[c=4 l=7]  *movdi_internal/5
+	pxor	%xmm0, %xmm0	# 370	[c=4 l=4]  *movdf_internal/12
+	movq	%r10, -328(%rbp)	# 1255	[c=4 l=7]  *movdi_internal/5
+	movsd	%xmm3, -344(%rbp)	# 1259	[c=4 l=8]  *movdf_internal/15
+	movsd	%xmm2, -312(%rbp)	# 1253	[c=4 l=8]  *movdf_internal/15
+	pushq	%rdx	# 1386	[c=4 l=1]  *pushdi2_rex64/0
+	movq	%rax, %rdx	# 374	[c=4 l=3]  *movdi_internal/3
+	movl	$2, %eax	# 378	[c=4 l=5]  *movqi_internal/3
+	pushq	%rsi	# 365	[c=4 l=1]  *pushsi2_rex64/0
+	pushq	%rsi	# 366	[c=4 l=1]  *pushsi2_rex64/0
+	leaq	.LC22(%rip), %rsi	# 375	[c=1 l=7]  *movdi_internal/4
+	pushq	-320(%rbp)	# 367	[c=9 l=6]  *pushdi2_rex64/0
+	call	fprintf@PLT	# 379	[c=10 l=5]  *call_value
+	movl	24(%rbx), %eax	# 1184	[c=9 l=3]  *movsi_internal/0
+	movsd	-344(%rbp), %xmm3	# 1260	[c=9 l=8]  *movdf_internal/14
+	addq	$32, %rsp	# 383	[c=4 l=4]  *adddi_1/0
+	movsd	-312(%rbp), %xmm2	# 1254	[c=9 l=8]  *movdf_internal/14
+	movq	-328(%rbp), %r10	# 1256	[c=9 l=7]  *movdi_internal/3
+	leal	1(%rax), %r8d	# 1312	[c=4 l=4]  *leasi
+	subl	20(%rbx), %r8d	# 382	[c=13 l=4]  *subsi_1/1
+	movq	-336(%rbp), %r11	# 1258	[c=9 l=7]  *movdi_internal/3
+	comisd	.LC21(%rip), %xmm3	# 385	[c=10 l=8]  *cmpidf/1
+	jbe	.L352	# 386	[c=13 l=6]  *jcc
+	movsd	.LC11(%rip), %xmm7	# 967	[c=6 l=8]  *movdf_internal/14
+	movsd	%xmm7, -312(%rbp)	# 1185	[c=4 l=8]  *movdf_internal/15
+	jmp	.L287	# 1426	[c=1 l=5]  jump
+.L274:
+	movq	%r11, %rdx	# 1162	[c=4 l=3]  *movdi_internal/3
+	movq	%r11, %rcx	# 1164	[c=4 l=3]  *movdi_internal/3
+	pxor	%xmm1, %xmm1	# 1470	[c=4 l=4]  movv2df_internal/0
+	shrq	%rdx	# 238	[c=4 l=3]  *lshrdi3_1/0
+	andl	$1, %ecx	# 239	[c=4 l=3]  *anddi_1/0
+	orq	%rcx, %rdx	# 240	[c=4 l=3]  *iordi_1/0
+	cvtsi2sdq	%rdx, %xmm1	# 1471	[c=4 l=5]  sse2_cvtsi2sdq/0
+	addsd	%xmm1, %xmm1	# 242	[c=12 l=4]  *fop_df_comm/1
+	jmp	.L275	# 1428	[c=1 l=5]  jump
+.L272:
+	movq	%r10, %rdx	# 1158	[c=4 l=3]  *movdi_internal/3
+	movq	%r10, %rcx	# 1160	[c=4 l=3]  *movdi_internal/3
+	pxor	%xmm3, %xmm3	# 1468	[c=4 l=4]  movv2df_internal/0
+	shrq	%rdx	# 222	[c=4 l=3]  *lshrdi3_1/0
+	andl	$1, %ecx	# 223	[c=4 l=3]  *anddi_1/0
+	orq	%rcx, %rdx	# 224	[c=4 l=3]  *iordi_1/0
+	cvtsi2sdq	%rdx, %xmm3	# 1469	[c=4 l=5]  sse2_cvtsi2sdq/0
+	addsd	%xmm3, %xmm3	# 226	[c=12 l=4]  *fop_df_comm/1
+	jmp	.L273	# 1430	[c=1 l=5]  jump
+.L269:
+	movq	-296(%rbp), %rcx	# 1242	[c=9 l=7]  *movdi_internal/3
+	pxor	%xmm0, %xmm0	# 1466	[c=4 l=4]  movv2df_internal/0
+	movq	%rcx, %rax	# 1150	[c=4 l=3]  *movdi_internal/3
+	andl	$1, %ecx	# 195	[c=4 l=3]  *anddi_1/0
+	shrq	%rax	# 194	[c=4 l=3]  *lshrdi3_1/0
+	orq	%rcx, %rax	# 196	[c=4 l=3]  *iordi_1/0
+	cvtsi2sdq	%rax, %xmm0	# 1467	[c=4 l=5]  sse2_cvtsi2sdq/0
+	addsd	%xmm0, %xmm0	# 198	[c=12 l=4]  *fop_df_comm/1
+	jmp	.L270	# 1432	[c=1 l=5]  jump
+.L267:
+	movq	-288(%rbp), %rcx	# 1240	[c=9 l=7]  *movdi_internal/3
+	pxor	%xmm1, %xmm1	# 1464	[c=4 l=4]  movv2df_internal/0
+	movq	%rcx, %rax	# 1145	[c=4 l=3]  *movdi_internal/3
+	andl	$1, %ecx	# 179	[c=4 l=3]  *anddi_1/0
+	shrq	%rax	# 178	[c=4 l=3]  *lshrdi3_1/0
+	orq	%rcx, %rax	# 180	[c=4 l=3]  *iordi_1/0
+	cvtsi2sdq	%rax, %xmm1	# 1465	[c=4 l=5]  sse2_cvtsi2sdq/0
+	addsd	%xmm1, %xmm1	# 182	[c=12 l=4]  *fop_df_comm/1
+	jmp	.L268	# 1434	[c=1 l=5]  jump
+.L279:
+	movq	%r8, %rax	# 1172	[c=4 l=3]  *movdi_internal/3
+	movq	%r8, %rdx	# 1174	[c=4 l=3]  *movdi_internal/3
+	pxor	%xmm1, %xmm1	# 1462	[c=4 l=4]  movv2df_internal/0
+	shrq	%rax	# 281	[c=4 l=3]  *lshrdi3_1/0
+	andl	$1, %edx	# 282	[c=4 l=3]  *anddi_1/0
+	orq	%rdx, %rax	# 283	[c=4 l=3]  *iordi_1/0
+	cvtsi2sdq	%rax, %xmm1	# 1463	[c=4 l=5]  sse2_cvtsi2sdq/0
+	addsd	%xmm1, %xmm1	# 285	[c=12 l=4]  *fop_df_comm/1
+	jmp	.L280	# 1436	[c=1 l=5]  jump
+.L277:
+	movq	%r9, %rax	# 1168	[c=4 l=3]  *movdi_internal/3
+	movq	%r9, %rdx	# 1170	[c=4 l=3]  *movdi_internal/3
+	pxor	%xmm0, %xmm0	# 1460	[c=4 l=4]  movv2df_internal/0
+	shrq	%rax	# 265	[c=4 l=3]  *lshrdi3_1/0
+	andl	$1, %edx	# 266	[c=4 l=3]  *anddi_1/0
+	orq	%rdx, %rax	# 267	[c=4 l=3]  *iordi_1/0
+	cvtsi2sdq	%rax, %xmm0	# 1461	[c=4 l=5]  sse2_cvtsi2sdq/0
+	addsd	%xmm0, %xmm0	# 269	[c=12 l=4]  *fop_df_comm/1
+	jmp	.L278	# 1438	[c=1 l=5]  jump
+.L264:
+	movq	-280(%rbp), %rsi	# 1236	[c=9 l=7]  *movdi_internal/3
+	pxor	%xmm0, %xmm0	# 1458	[c=4 l=4]  movv2df_internal/0
+	movq	%rsi, %rdx	# 1132	[c=4 l=3]  *movdi_internal/3
+	andl	$1, %esi	# 151	[c=4 l=3]  *anddi_1/0
+	shrq	%rdx	# 150	[c=4 l=3]  *lshrdi3_1/0
+	orq	%rsi, %rdx	# 152	[c=4 l=3]  *iordi_1/0
+	cvtsi2sdq	%rdx, %xmm0	# 1459	[c=4 l=5]  sse2_cvtsi2sdq/0
+	addsd	%xmm0, %xmm0	# 154	[c=12 l=4]  *fop_df_comm/1
+	jmp	.L265	# 1440	[c=1 l=5]  jump
+.L262:
+	movq	-272(%rbp), %rsi	# 1234	[c=9 l=7]  *movdi_internal/3
+	pxor	%xmm2, %xmm2	# 1456	[c=4 l=4]  movv2df_internal/0
+	movq	%rsi, %rdx	# 1127	[c=4 l=3]  *movdi_internal/3
+	andl	$1, %esi	# 135	[c=4 l=3]  *anddi_1/0
+	shrq	%rdx	# 134	[c=4 l=3]  *lshrdi3_1/0
+	orq	%rsi, %rdx	# 136	[c=4 l=3]  *iordi_1/0
+	cvtsi2sdq	%rdx, %xmm2	# 1457	[c=4 l=5]  sse2_cvtsi2sdq/0
+	addsd	%xmm2, %xmm2	# 138	[c=12 l=4]  *fop_df_comm/1
+	jmp	.L263	# 1442	[c=1 l=5]  jump
+.L371:
+	pxor	%xmm1, %xmm1	# 23	[c=4 l=4]  *movdf_internal/12
+	jmp	.L299	# 1444	[c=1 l=5]  jump
+.L352:
+	movsd	.LC11(%rip), %xmm6	# 968	[c=6 l=8]  *movdf_internal/14
+	pxor	%xmm1, %xmm1	# 21	[c=4 l=4]  *movdf_internal/12
+	movsd	%xmm6, -312(%rbp)	# 1186	[c=4 l=8]  *movdf_internal/15
+	jmp	.L289	# 1446	[c=1 l=5]  jump
+.L297:
+	movq	%rax, %rdx	# 1196	[c=4 l=3]  *movdi_internal/3
+	andl	$1, %eax	# 463	[c=4 l=3]  *anddi_1/0
+	pxor	%xmm1, %xmm1	# 1454	[c=4 l=4]  movv2df_internal/0
+	shrq	%rdx	# 462	[c=4 l=3]  *lshrdi3_1/0
+	orq	%rax, %rdx	# 464	[c=4 l=3]  *iordi_1/0
+	cvtsi2sdq	%rdx, %xmm1	# 1455	[c=4 l=5]  sse2_cvtsi2sdq/0
+	addsd	%xmm1, %xmm1	# 466	[c=12 l=4]  *fop_df_comm/1
+	jmp	.L298	# 1448	[c=1 l=5]  jump
+.L303:
+	movq	%rax, %rdx	# 1213	[c=4 l=3]  *movdi_internal/3
+	andl	$1, %eax	# 546	[c=4 l=3]  *anddi_1/0
+	pxor	%xmm1, %xmm1	# 1452	[c=4 l=4]  movv2df_internal/0
+	shrq	%rdx	# 545	[c=4 l=3]  *lshrdi3_1/0
+	orq	%rax, %rdx	# 547	[c=4 l=3]  *iordi_1/0
+	cvtsi2sdq	%rdx, %xmm1	# 1453	[c=4 l=5]  sse2_cvtsi2sdq/0
+	addsd	%xmm1, %xmm1	# 549	[c=12 l=4]  *fop_df_comm/1
+	jmp	.L304	# 1450	[c=1 l=5]  jump
+	.cfi_endproc
+.LFE29:
+	.size	leave, .-leave
+	.section	.rodata.str1.1
+.LC33:
+	.string	"code must be unreachable"
+	.text
+	.p2align 4
+	.globl	log_cpu_address
+	.type	log_cpu_address, @function
+log_cpu_address:
+.LFB56:
+	.cfi_startproc
+	cmpl	$2, %edx	# 8	[c=4 l=3]  *cmpsi_1/0
+	je	.L373	# 9	[c=13 l=2]  *jcc
+	jg	.L374	# 14	[c=13 l=2]  *jcc
+	testl	%edx, %edx	# 16	[c=4 l=2]  *cmpsi_ccno_1/0
+	je	.L375	# 17	[c=13 l=2]  *jcc
+	cmpl	$1, %edx	# 19	[c=4 l=3]  *cmpsi_1/0
+	jne	.L377	# 20	[c=13 l=2]  *jcc
+	movq	1040(%rdi), %rax	# 123	[c=9 l=7]  *movdi_internal/3
+	movslq	%esi, %rsi	# 40	[c=4 l=3]  *extendsidi2_rex64/1
+	addq	%rsi, %rax	# 124	[c=4 l=3]  *adddi_1/0
+	ret		# 87	[c=0 l=1]  simple_return_internal
+	.p2align 4,,10
+	.p2align 3
+.L374:
+	cmpl	$3, %edx	# 26	[c=4 l=3]  *cmpsi_1/0
+	jne	.L377	# 27	[c=13 l=2]  *jcc
+	movq	1048(%rdi), %rax	# 119	[c=9 l=7]  *movdi_internal/3
+	movslq	%esi, %rsi	# 54	[c=4 l=3]  *extendsidi2_rex64/1
+	addq	%rsi, %rax	# 120	[c=4 l=3]  *adddi_1/0
+	ret		# 107	[c=0 l=1]  simple_return_internal
+	.p2align 4,,10
+	.p2align 3
+.L373:
+	movq	1056(%rdi), %rax	# 121	[c=9 l=7]  *movdi_internal/3
+	movslq	%esi, %rsi	# 47	[c=4 l=3]  *extendsidi2_rex64/1
+	addq	%rsi, %rax	# 122	[c=4 l=3]  *adddi_1/0
+	ret		# 89	[c=0 l=1]  simple_return_internal
+	.p2align 4,,10
+	.p2align 3
+.L375:
+	movslq	%esi, %rsi	# 34	[c=4 l=3]  *extendsidi2_rex64/1
+	leaq	1004(%rdi,%rsi), %rax	# 35	[c=5 l=8]  *leadi
+	ret		# 85	[c=0 l=1]  simple_return_internal
+.L377:
+	pushq	%rax	# 117	[c=4 l=1]  *pushdi2_prologue
+	.cfi_def_cfa_offset 16
+	leaq	.LC33(%rip), %rdx	# 61	[c=1 l=7]  *movdi_internal/4
+	movl	$8, %esi	# 63	[c=4 l=5]  *movsi_internal/0
+	xorl	%eax, %eax	# 118	[c=4 l=2]  *movdi_xor
+	call	leave	# 66	[c=0 l=5]  *call
+	.cfi_endproc
+.LFE56:
+	.size	log_cpu_address, .-log_cpu_address
+	.section	.rodata.str1.8
+	.align 8
+.LC34:
+	.string	"program counter 0x%x out of bounds (0x%x--0x%x)"
+	.text
+	.p2align 4
+	.type	bad_PC, @function
+bad_PC:
+.LFB75:
+	.cfi_startproc
+	subq	$8, %rsp	# 27	[c=4 l=4]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_def_cfa_offset 16
+	movl	24(%rdi), %eax	# 7	[c=9 l=3]  *movsi_internal/0
+	movl	20(%rdi), %r8d	# 12	[c=9 l=4]  *movsi_internal/0
+	leal	(%rsi,%rsi), %ecx	# 26	[c=12 l=3]  *leasi
+	leaq	.LC34(%rip), %rdx	# 14	[c=1 l=7]  *movdi_internal/4
+	movl	$1, %esi	# 16	[c=4 l=5]  *movsi_internal/0
+	leal	-1(%rax), %r9d	# 11	[c=4 l=4]  *leasi
+	xorl	%eax, %eax	# 34	[c=4 l=2]  *movdi_xor
+	call	leave	# 19	[c=0 l=5]  *call
+	.cfi_endproc
+.LFE75:
+	.size	bad_PC, .-bad_PC
+	.section	.rodata.str1.8
+	.align 8
+.LC35:
+	.string	"stack pointer overflow (SP = 0x%04x)"
+	.text
+	.p2align 4
+	.type	stack_overflow, @function
+stack_overflow:
+.LFB71:
+	.cfi_startproc
+	movl	%esi, %ecx	# 3	[c=4 l=2]  *movsi_internal/0
+	subq	$8, %rsp	# 20	[c=4 l=4]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_def_cfa_offset 16
+	leaq	.LC35(%rip), %rdx	# 8	[c=1 l=7]  *movdi_internal/4
+	xorl	%eax, %eax	# 27	[c=4 l=2]  *movdi_xor
+	movl	$1, %esi	# 10	[c=4 l=5]  *movsi_internal/0
+	call	leave	# 13	[c=0 l=5]  *call
+	.cfi_endproc
+.LFE71:
+	.size	stack_overflow, .-stack_overflow
+	.section	.rodata.str1.8
+	.align 8
+.LC36:
+	.string	"access to unmapped RAM address 0x%x (RAMEND = 0x%04x)"
+	.text
+	.p2align 4
+	.type	bad_address, @function
+bad_address:
+.LFB30:
+	.cfi_startproc
+	subq	$8, %rsp	# 22	[c=4 l=4]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_def_cfa_offset 16
+	movl	1000(%rdi), %r8d	# 8	[c=9 l=7]  *movsi_internal/0
+	movl	%esi, %ecx	# 3	[c=4 l=2]  *movsi_internal/0
+	xorl	%eax, %eax	# 29	[c=4 l=2]  *movdi_xor
+	leaq	.LC36(%rip), %rdx	# 10	[c=1 l=7]  *movdi_internal/4
+	movl	$1, %esi	# 12	[c=4 l=5]  *movsi_internal/0
+	call	leave	# 15	[c=0 l=5]  *call
+	.cfi_endproc
+.LFE30:
+	.size	bad_address, .-bad_address
+	.p2align 4
+	.type	data_read_mapped, @function
+data_read_mapped:
+.LFB35:
+	.cfi_startproc
+	movl	%esi, %eax	# 87	[c=4 l=2]  *movsi_internal/0
+	subl	5176(%rdi), %eax	# 8	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rdi), %eax	# 9	[c=13 l=6]  *cmpsi_1/1
+	jb	.L389	# 10	[c=13 l=2]  *jcc
+	movl	%esi, %eax	# 89	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %eax	# 12	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 85	[c=5 l=5]  *andsi_1_zext
+	movzbl	1080(%rdi,%rax), %eax	# 15	[c=10 l=8]  *movqi_internal/4
+	cmpb	$3, %al	# 16	[c=4 l=2]  *cmpqi_1/0
+	je	.L390	# 17	[c=13 l=2]  *jcc
+	cmpb	$4, %al	# 19	[c=4 l=2]  *cmpqi_1/0
+	je	.L391	# 20	[c=13 l=2]  *jcc
+	cmpb	$2, %al	# 22	[c=4 l=2]  *cmpqi_1/0
+	je	.L397	# 23	[c=13 l=2]  *jcc
+.L389:
+	subq	$8, %rsp	# 93	[c=4 l=4]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_def_cfa_offset 16
+	call	bad_address	# 61	[c=0 l=5]  *call
+	.p2align 4,,10
+	.p2align 3
+.L397:
+	.cfi_def_cfa_offset 8
+	movl	992(%rdi), %eax	# 25	[c=9 l=6]  *movsi_internal/0
+	subl	$16384, %esi	# 28	[c=4 l=6]  *addsi_1/0
+	movq	1056(%rdi), %rdx	# 31	[c=9 l=7]  *movdi_internal/3
+	leal	1(%rax,%rax), %eax	# 27	[c=8 l=4]  *leasi
+	andl	%esi, %eax	# 29	[c=4 l=2]  *andsi_1/0
+	cltq	# 30	[c=4 l=2]  *extendsidi2_rex64/0
+	movzbl	(%rdx,%rax), %eax	# 32	[c=13 l=4]  *zero_extendqisi2/0
+	ret		# 77	[c=0 l=1]  simple_return_internal
+	.p2align 4,,10
+	.p2align 3
+.L391:
+	movl	%esi, %eax	# 91	[c=4 l=2]  *movsi_internal/0
+	movq	1072(%rdi), %rdx	# 47	[c=9 l=7]  *movdi_internal/3
+	sarl	$12, %eax	# 44	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 84	[c=5 l=5]  *andsi_1_zext
+	movq	(%rdx,%rax,8), %rdx	# 48	[c=10 l=4]  *movdi_internal/3
+	xorl	%eax, %eax	# 109	[c=4 l=2]  *movdi_xor
+	testq	%rdx, %rdx	# 49	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L388	# 50	[c=13 l=2]  *jcc
+	andl	$4095, %esi	# 83	[c=5 l=6]  *andsi_1_zext
+	movzbl	(%rdx,%rsi), %eax	# 54	[c=13 l=4]  *zero_extendqisi2/0
+	ret		# 81	[c=0 l=1]  simple_return_internal
+	.p2align 4,,10
+	.p2align 3
+.L390:
+	movq	1048(%rdi), %rax	# 38	[c=9 l=7]  *movdi_internal/3
+	movslq	%esi, %rsi	# 37	[c=4 l=3]  *extendsidi2_rex64/1
+	movzbl	-4096(%rax,%rsi), %eax	# 39	[c=14 l=8]  *zero_extendqisi2/0
+	ret		# 79	[c=0 l=1]  simple_return_internal
+	.p2align 4,,10
+	.p2align 3
+.L388:
+	ret		# 100	[c=0 l=1]  simple_return_internal
+	.cfi_endproc
+.LFE35:
+	.size	data_read_mapped, .-data_read_mapped
+	.p2align 4
+	.type	data_read_page, @function
+data_read_page:
+.LFB45:
+	.cfi_startproc
+	movl	%esi, %eax	# 130	[c=4 l=2]  *movsi_internal/0
+	subl	5176(%rdi), %eax	# 8	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rdi), %eax	# 9	[c=13 l=6]  *cmpsi_1/1
+	jb	.L399	# 10	[c=13 l=2]  *jcc
+	movl	%esi, %eax	# 132	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %eax	# 12	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 128	[c=5 l=5]  *andsi_1_zext
+	movzbl	1080(%rdi,%rax), %eax	# 15	[c=10 l=8]  *movqi_internal/4
+	cmpb	$1, %al	# 16	[c=4 l=2]  *cmpqi_1/0
+	je	.L400	# 17	[c=13 l=2]  *jcc
+	cmpb	$2, %al	# 19	[c=4 l=2]  *cmpqi_1/0
+	je	.L401	# 20	[c=13 l=2]  *jcc
+.L399:
+	jmp	data_read_mapped	# 99	[c=10 l=5]  *sibcall_value
+	.p2align 4,,10
+	.p2align 3
+.L401:
+	addq	$1, 48(%rdi)	# 94	[c=13 l=5]  *adddi_1/0
+	jmp	data_read_mapped	# 156	[c=10 l=5]  *sibcall_value
+	.p2align 4,,10
+	.p2align 3
+.L400:
+	cmpl	$63, %esi	# 26	[c=4 l=3]  *cmpsi_1/0
+	je	.L417	# 27	[c=13 l=2]  *jcc
+.L402:
+	cmpl	6564(%rdi), %esi	# 46	[c=13 l=6]  *cmpsi_1/1
+	jnb	.L403	# 47	[c=13 l=2]  *jcc
+	movslq	%esi, %rax	# 49	[c=4 l=3]  *extendsidi2_rex64/1
+	cmpb	$0, 6568(%rdi,%rax)	# 50	[c=14 l=8]  *cmpqi_ccno_1/1
+	je	.L403	# 51	[c=13 l=2]  *jcc
+	cmpl	$1, 96(%rdi)	# 62	[c=13 l=4]  *cmpsi_1/0
+	movq	48(%rdi), %rdx	# 61	[c=9 l=4]  *movdi_internal/3
+	je	.L418	# 63	[c=13 l=2]  *jcc
+.L407:
+	jmp	periph_read@PLT	# 76	[c=10 l=5]  *sibcall_value
+	.p2align 4,,10
+	.p2align 3
+.L403:
+	cmpl	%esi, 1000(%rdi)	# 54	[c=13 l=6]  *cmpsi_1/0
+	jb	.L419	# 55	[c=13 l=2]  *jcc
+	movq	1040(%rdi), %rax	# 88	[c=9 l=7]  *movdi_internal/3
+	movslq	%esi, %rsi	# 87	[c=4 l=3]  *extendsidi2_rex64/1
+	movzbl	(%rax,%rsi), %eax	# 89	[c=13 l=4]  *zero_extendqisi2/0
+	ret		# 141	[c=0 l=1]  simple_return_internal
+	.p2align 4,,10
+	.p2align 3
+.L417:
+	movzbl	100(%rdi), %eax	# 29	[c=9 l=4]  *movqi_internal/4
+	testb	%al, %al	# 30	[c=4 l=2]  *cmpqi_ccno_1/0
+	je	.L402	# 31	[c=13 l=2]  *jcc
+	movq	1040(%rdi), %r8	# 33	[c=9 l=7]  *movdi_internal/3
+	movzbl	%al, %ecx	# 35	[c=4 l=3]  *zero_extendqisi2/0
+	notl	%ecx	# 36	[c=4 l=2]  *one_cmplsi2_1/0
+	movzbl	63(%r8), %edx	# 34	[c=13 l=5]  *zero_extendqisi2/0
+	andl	%ecx, %edx	# 37	[c=4 l=2]  *andsi_1/0
+	movq	104(%rdi), %rcx	# 38	[c=9 l=4]  *movdi_internal/3
+	andb	(%rcx), %al	# 39	[c=9 l=2]  *andqi_1/1
+	movzbl	%al, %eax	# 40	[c=4 l=3]  *zero_extendqisi2/0
+	orl	%edx, %eax	# 41	[c=4 l=2]  *iorsi_1/0
+	movb	%al, 63(%r8)	# 42	[c=4 l=4]  *movqi_internal/8
+	movb	$0, 100(%rdi)	# 43	[c=4 l=4]  *movqi_internal/8
+	jmp	.L402	# 164	[c=1 l=5]  jump
+	.p2align 4,,10
+	.p2align 3
+.L418:
+	movl	(%rdi), %eax	# 65	[c=6 l=2]  *zero_extendsidi2/3
+	salq	$4, %rax	# 67	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rdi), %rax	# 68	[c=13 l=7]  *adddi_1/1
+	movzwl	14(%rax), %eax	# 69	[c=13 l=4]  zero_extendhidi2/0
+	subq	%rax, %rdx	# 70	[c=4 l=3]  *subdi_1/0
+	jmp	.L407	# 166	[c=1 l=5]  jump
+.L419:
+	pushq	%rax	# 154	[c=4 l=1]  *pushdi2_prologue
+	.cfi_def_cfa_offset 16
+	call	bad_address	# 83	[c=0 l=5]  *call
+	.cfi_endproc
+.LFE45:
+	.size	data_read_page, .-data_read_page
+	.p2align 4
+	.type	spm_operation, @function
+spm_operation:
+.LFB89:
+	.cfi_startproc
+	movl	$458, %eax	# 7	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%rdi), %eax	# 8	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rdi), %eax	# 9	[c=13 l=6]  *cmpsi_1/1
+	jb	.L421	# 10	[c=13 l=2]  *jcc
+	movzbl	1094(%rdi), %eax	# 12	[c=9 l=7]  *movqi_internal/4
+	testb	%al, %al	# 13	[c=4 l=2]  *cmpqi_ccno_1/0
+	jne	.L440	# 14	[c=13 l=2]  *jcc
+.L421:
+	movq	1040(%rdi), %rax	# 17	[c=9 l=7]  *movdi_internal/3
+	xorl	%edx, %edx	# 174	[c=4 l=2]  *movdi_xor
+	movzbl	458(%rax), %eax	# 18	[c=13 l=7]  *zero_extendqisi2/0
+	subl	$34, %eax	# 143	[c=5 l=3]  addsi_1_zext/0
+	cmpl	$13, %eax	# 145	[c=4 l=3]  *cmpsi_1/0
+	jbe	.L441	# 146	[c=13 l=2]  *jcc
+	movl	%edx, %eax	# 153	[c=4 l=2]  *movsi_internal/0
+	ret		# 164	[c=0 l=1]  simple_return_internal
+	.p2align 4,,10
+	.p2align 3
+.L441:
+	leaq	CSWTCH.178(%rip), %rdx	# 149	[c=1 l=7]  *movdi_internal/4
+	movl	(%rdx,%rax,4), %edx	# 150	[c=10 l=3]  *movsi_internal/0
+	movl	%edx, %eax	# 177	[c=4 l=2]  *movsi_internal/0
+	ret		# 179	[c=0 l=1]  simple_return_internal
+	.p2align 4,,10
+	.p2align 3
+.L440:
+	subq	$8, %rsp	# 135	[c=4 l=4]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_def_cfa_offset 16
+	cmpb	$1, %al	# 23	[c=4 l=2]  *cmpqi_1/0
+	je	.L424	# 24	[c=13 l=2]  *jcc
+	cmpb	$2, %al	# 26	[c=4 l=2]  *cmpqi_1/0
+	jne	.L426	# 27	[c=13 l=2]  *jcc
+	addq	$1, 48(%rdi)	# 84	[c=13 l=5]  *adddi_1/0
+.L426:
+	movl	$458, %esi	# 87	[c=4 l=5]  *movsi_internal/0
+	call	data_read_mapped	# 89	[c=10 l=5]  *call_value
+.L423:
+	subl	$34, %eax	# 93	[c=5 l=3]  addsi_1_zext/0
+	xorl	%edx, %edx	# 175	[c=4 l=2]  *movdi_xor
+	cmpl	$13, %eax	# 96	[c=4 l=3]  *cmpsi_1/0
+	ja	.L420	# 97	[c=13 l=2]  *jcc
+	leaq	CSWTCH.178(%rip), %rdx	# 133	[c=1 l=7]  *movdi_internal/4
+	movl	(%rdx,%rax,4), %edx	# 101	[c=10 l=3]  *movsi_internal/0
+.L420:
+	movl	%edx, %eax	# 107	[c=4 l=2]  *movsi_internal/0
+	addq	$8, %rsp	# 138	[c=4 l=4]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_remember_state
+	.cfi_def_cfa_offset 8
+	ret		# 139	[c=0 l=1]  simple_return_internal
+	.p2align 4,,10
+	.p2align 3
+.L424:
+	.cfi_restore_state
+	cmpl	$458, 6564(%rdi)	# 35	[c=13 l=10]  *cmpsi_1/0
+	jbe	.L427	# 36	[c=13 l=2]  *jcc
+	cmpb	$0, 7026(%rdi)	# 38	[c=13 l=7]  *cmpqi_ccno_1/1
+	je	.L427	# 39	[c=13 l=2]  *jcc
+	cmpl	$1, 96(%rdi)	# 52	[c=13 l=4]  *cmpsi_1/0
+	movq	48(%rdi), %rdx	# 51	[c=9 l=4]  *movdi_internal/3
+	je	.L442	# 53	[c=13 l=2]  *jcc
+.L431:
+	movl	$458, %esi	# 64	[c=4 l=5]  *movsi_internal/0
+	call	periph_read@PLT	# 66	[c=10 l=5]  *call_value
+	jmp	.L423	# 186	[c=1 l=2]  jump
+	.p2align 4,,10
+	.p2align 3
+.L427:
+	cmpl	$457, 1000(%rdi)	# 44	[c=13 l=10]  *cmpsi_1/0
+	jbe	.L443	# 45	[c=13 l=2]  *jcc
+	movq	1040(%rdi), %rax	# 78	[c=9 l=7]  *movdi_internal/3
+	movzbl	458(%rax), %eax	# 79	[c=13 l=7]  *zero_extendqisi2/0
+	jmp	.L423	# 189	[c=1 l=2]  jump
+.L442:
+	movl	(%rdi), %eax	# 55	[c=6 l=2]  *zero_extendsidi2/3
+	salq	$4, %rax	# 57	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rdi), %rax	# 58	[c=13 l=7]  *adddi_1/1
+	movzwl	14(%rax), %eax	# 59	[c=13 l=4]  zero_extendhidi2/0
+	subq	%rax, %rdx	# 60	[c=4 l=3]  *subdi_1/0
+	jmp	.L431	# 191	[c=1 l=2]  jump
+.L443:
+	movl	$458, %esi	# 72	[c=4 l=5]  *movsi_internal/0
+	call	bad_address	# 74	[c=0 l=5]  *call
+	.cfi_endproc
+.LFE89:
+	.size	spm_operation, .-spm_operation
+	.section	.rodata.str1.1
+.LC37:
+	.string	"external memory"
+	.text
+	.p2align 4
+	.type	far_write, @function
+far_write:
+.LFB34:
+	.cfi_startproc
+	pushq	%r13	# 71	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 16
+	.cfi_offset 13, -16
+	movl	%esi, %eax	# 69	[c=4 l=2]  *movsi_internal/0
+	movl	%edx, %r13d	# 4	[c=4 l=3]  *movsi_internal/0
+	pushq	%r12	# 72	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 24
+	.cfi_offset 12, -24
+	sarl	$12, %eax	# 8	[c=4 l=3]  *ashrsi3_1/0
+	pushq	%rbp	# 73	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 32
+	.cfi_offset 6, -32
+	andl	$4095, %eax	# 67	[c=5 l=5]  *andsi_1_zext
+	pushq	%rbx	# 74	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 40
+	.cfi_offset 3, -40
+	movl	%esi, %ebx	# 3	[c=4 l=2]  *movsi_internal/0
+	subq	$8, %rsp	# 75	[c=4 l=4]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_def_cfa_offset 48
+	movq	1072(%rdi), %rcx	# 12	[c=9 l=7]  *movdi_internal/3
+	leaq	(%rcx,%rax,8), %r12	# 13	[c=8 l=4]  *leadi
+	movq	(%r12), %rax	# 14	[c=5 l=4]  *movdi_internal/3
+	testq	%rax, %rax	# 15	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L452	# 16	[c=13 l=2]  *jcc
+.L445:
+	andl	$4095, %ebx	# 66	[c=5 l=6]  *andsi_1_zext
+	movb	%r13b, (%rax,%rbx)	# 53	[c=4 l=4]  *movqi_internal/8
+	addq	$8, %rsp	# 78	[c=4 l=4]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	popq	%rbx	# 79	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 32
+	popq	%rbp	# 80	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 24
+	popq	%r12	# 81	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 16
+	popq	%r13	# 82	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 8
+	ret		# 83	[c=0 l=1]  simple_return_internal
+	.p2align 4,,10
+	.p2align 3
+.L452:
+	.cfi_restore_state
+	movq	%rdi, %rbp	# 84	[c=4 l=3]  *movdi_internal/3
+	movl	$4128, %esi	# 18	[c=4 l=5]  *movdi_internal/2
+	movl	$1, %edi	# 19	[c=4 l=5]  *movdi_internal/2
+	call	calloc@PLT	# 20	[c=10 l=5]  *call_value
+	testq	%rax, %rax	# 23	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L453	# 24	[c=13 l=2]  *jcc
+	movq	984(%rbp), %rcx	# 38	[c=9 l=7]  *movdi_internal/3
+	movq	%rcx, (%rax)	# 39	[c=4 l=3]  *movdi_internal/5
+	testq	%rcx, %rcx	# 40	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L447	# 41	[c=13 l=2]  *jcc
+	movq	%rax, 8(%rcx)	# 43	[c=4 l=4]  *movdi_internal/5
+.L447:
+	movq	%rax, 984(%rbp)	# 46	[c=4 l=7]  *movdi_internal/5
+	addq	$32, %rax	# 47	[c=4 l=4]  *adddi_1/0
+	movq	%rax, (%r12)	# 48	[c=4 l=4]  *movdi_internal/5
+	jmp	.L445	# 90	[c=1 l=2]  jump
+.L453:
+	leaq	.LC37(%rip), %r9	# 26	[c=1 l=7]  *movdi_internal/4
+	movl	$1, %r8d	# 27	[c=4 l=6]  *movsi_internal/0
+	movq	%rbp, %rdi	# 32	[c=4 l=3]  *movdi_internal/3
+	movl	$4096, %ecx	# 28	[c=4 l=5]  *movsi_internal/0
+	leaq	.LC4(%rip), %rdx	# 29	[c=1 l=7]  *movdi_internal/4
+	movl	$6, %esi	# 31	[c=4 l=5]  *movsi_internal/0
+	call	leave	# 34	[c=0 l=5]  *call
+	.cfi_endproc
+.LFE34:
+	.size	far_write, .-far_write
+	.p2align 4
+	.type	data_write_mapped, @function
+data_write_mapped:
+.LFB36:
+	.cfi_startproc
+	pushq	%r12	# 121	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	movl	%esi, %eax	# 112	[c=4 l=2]  *movsi_internal/0
+	pushq	%rbp	# 122	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	movq	%rdi, %rbp	# 2	[c=4 l=3]  *movdi_internal/3
+	pushq	%rbx	# 123	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	movl	%esi, %ebx	# 3	[c=4 l=2]  *movsi_internal/0
+	subq	$16, %rsp	# 124	[c=4 l=4]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_def_cfa_offset 48
+	subl	5176(%rdi), %eax	# 8	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rdi), %eax	# 9	[c=13 l=6]  *cmpsi_1/1
+	jb	.L455	# 10	[c=13 l=2]  *jcc
+	movl	%esi, %eax	# 114	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %eax	# 12	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 110	[c=5 l=5]  *andsi_1_zext
+	movzbl	1080(%rdi,%rax), %eax	# 15	[c=10 l=8]  *movqi_internal/4
+	cmpb	$3, %al	# 16	[c=4 l=2]  *cmpqi_1/0
+	je	.L456	# 17	[c=13 l=2]  *jcc
+	cmpb	$4, %al	# 19	[c=4 l=2]  *cmpqi_1/0
+	jne	.L455	# 20	[c=13 l=2]  *jcc
+	movl	%esi, %eax	# 116	[c=4 l=2]  *movsi_internal/0
+	movq	1072(%rdi), %rcx	# 38	[c=9 l=7]  *movdi_internal/3
+	sarl	$12, %eax	# 34	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 109	[c=5 l=5]  *andsi_1_zext
+	leaq	(%rcx,%rax,8), %r12	# 39	[c=8 l=4]  *leadi
+	movq	(%r12), %rax	# 40	[c=5 l=4]  *movdi_internal/3
+	testq	%rax, %rax	# 41	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L467	# 42	[c=13 l=2]  *jcc
+.L458:
+	andl	$4095, %ebx	# 108	[c=5 l=6]  *andsi_1_zext
+	movb	%dl, (%rax,%rbx)	# 79	[c=4 l=3]  *movqi_internal/8
+	addq	$16, %rsp	# 127	[c=4 l=4]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_remember_state
+	.cfi_def_cfa_offset 32
+	popq	%rbx	# 128	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 24
+	popq	%rbp	# 129	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 16
+	popq	%r12	# 130	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 8
+	ret		# 131	[c=0 l=1]  simple_return_internal
+	.p2align 4,,10
+	.p2align 3
+.L456:
+	.cfi_restore_state
+	addq	$16, %rsp	# 135	[c=4 l=4]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_remember_state
+	.cfi_def_cfa_offset 32
+	leal	-4096(%rsi), %esi	# 120	[c=4 l=6]  *leasi
+	popq	%rbx	# 136	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 24
+	popq	%rbp	# 137	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 16
+	popq	%r12	# 138	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 8
+	jmp	eeprom_write_mapped@PLT	# 30	[c=0 l=5]  *sibcall
+	.p2align 4,,10
+	.p2align 3
+.L455:
+	.cfi_restore_state
+	movl	%ebx, %esi	# 84	[c=4 l=2]  *movsi_internal/0
+	movq	%rbp, %rdi	# 85	[c=4 l=3]  *movdi_internal/3
+	call	bad_address	# 86	[c=0 l=5]  *call
+	.p2align 4,,10
+	.p2align 3
+.L467:
+	movl	$4128, %esi	# 44	[c=4 l=5]  *movdi_internal/2
+	movl	$1, %edi	# 45	[c=4 l=5]  *movdi_internal/2
+	movl	%edx, 12(%rsp)	# 118	[c=4 l=4]  *movsi_internal/1
+	call	calloc@PLT	# 46	[c=10 l=5]  *call_value
+	movl	12(%rsp), %edx	# 119	[c=9 l=4]  *movsi_internal/0
+	testq	%rax, %rax	# 49	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L468	# 50	[c=13 l=2]  *jcc
+	movq	984(%rbp), %rcx	# 64	[c=9 l=7]  *movdi_internal/3
+	movq	%rcx, (%rax)	# 65	[c=4 l=3]  *movdi_internal/5
+	testq	%rcx, %rcx	# 66	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L460	# 67	[c=13 l=2]  *jcc
+	movq	%rax, 8(%rcx)	# 69	[c=4 l=4]  *movdi_internal/5
+.L460:
+	movq	%rax, 984(%rbp)	# 72	[c=4 l=7]  *movdi_internal/5
+	addq	$32, %rax	# 73	[c=4 l=4]  *adddi_1/0
+	movq	%rax, (%r12)	# 74	[c=4 l=4]  *movdi_internal/5
+	jmp	.L458	# 142	[c=1 l=5]  jump
+.L468:
+	leaq	.LC37(%rip), %r9	# 52	[c=1 l=7]  *movdi_internal/4
+	movl	$1, %r8d	# 53	[c=4 l=6]  *movsi_internal/0
+	movq	%rbp, %rdi	# 58	[c=4 l=3]  *movdi_internal/3
+	movl	$4096, %ecx	# 54	[c=4 l=5]  *movsi_internal/0
+	leaq	.LC4(%rip), %rdx	# 55	[c=1 l=7]  *movdi_internal/4
+	movl	$6, %esi	# 57	[c=4 l=5]  *movsi_internal/0
+	call	leave	# 60	[c=0 l=5]  *call
+	.cfi_endproc
+.LFE36:
+	.size	data_write_mapped, .-data_write_mapped
+	.p2align 4
+	.type	pop_byte, @function
+pop_byte:
+.LFB73:
+	.cfi_startproc
+	pushq	%r15	# 237	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	movl	$62, %eax	# 10	[c=4 l=5]  *movsi_internal/0
+	pushq	%r14	# 238	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13	# 239	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12	# 240	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	movl	$61, %r12d	# 7	[c=4 l=6]  *movsi_internal/0
+	pushq	%rbp	# 241	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx	# 242	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	movq	%rdi, %rbx	# 2	[c=4 l=3]  *movdi_internal/3
+	subq	$8, %rsp	# 243	[c=4 l=4]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_def_cfa_offset 64
+	movl	5176(%rdi), %edx	# 6	[c=9 l=6]  *movsi_internal/0
+	movl	5180(%rdi), %r14d	# 9	[c=9 l=7]  *movsi_internal/0
+	subl	%edx, %eax	# 11	[c=4 l=2]  *subsi_1/0
+	subl	%edx, %r12d	# 8	[c=4 l=3]  *subsi_1/0
+	movl	%eax, %r13d	# 223	[c=4 l=3]  *movsi_internal/0
+	cmpl	%r14d, %r12d	# 12	[c=4 l=3]  *cmpsi_1/0
+	jb	.L470	# 13	[c=13 l=6]  *jcc
+	cmpb	$1, 1081(%rdi)	# 17	[c=13 l=7]  *cmpqi_1/0
+	ja	.L493	# 18	[c=13 l=6]  *jcc
+	movq	1040(%rdi), %rdx	# 177	[c=9 l=7]  *movdi_internal/3
+	movzbl	61(%rdx), %r15d	# 178	[c=13 l=5]  *zero_extendqisi2/0
+	cmpl	%r14d, %eax	# 180	[c=4 l=3]  *cmpsi_1/0
+	jb	.L494	# 181	[c=13 l=6]  *jcc
+.L486:
+	cmpb	$1, 1081(%rbx)	# 32	[c=13 l=7]  *cmpqi_1/0
+	ja	.L495	# 33	[c=13 l=6]  *jcc
+.L485:
+	movzbl	62(%rdx), %ebp	# 150	[c=13 l=4]  *zero_extendqisi2/0
+	sall	$8, %ebp	# 151	[c=4 l=3]  *ashlsi3_1/0
+	orl	%r15d, %ebp	# 152	[c=4 l=3]  *iorsi_1/0
+	addl	$1, %ebp	# 153	[c=4 l=3]  *addsi_1/0
+.L477:
+	movb	%bpl, 61(%rdx)	# 75	[c=4 l=4]  *movqi_internal/8
+.L478:
+	movl	%ebp, %edx	# 226	[c=4 l=2]  *movsi_internal/0
+	movl	$62, %eax	# 79	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%rbx), %eax	# 80	[c=13 l=6]  *subsi_1/1
+	sarl	$8, %edx	# 78	[c=4 l=3]  *ashrsi3_1/0
+	cmpl	5180(%rbx), %eax	# 81	[c=13 l=6]  *cmpsi_1/1
+	jb	.L479	# 82	[c=13 l=2]  *jcc
+	cmpb	$1, 1081(%rbx)	# 86	[c=13 l=7]  *cmpqi_1/0
+	ja	.L496	# 87	[c=13 l=2]  *jcc
+.L479:
+	movq	1040(%rbx), %rax	# 98	[c=9 l=7]  *movdi_internal/3
+	movb	%dl, 62(%rax)	# 99	[c=4 l=3]  *movqi_internal/8
+.L480:
+	movl	%ebp, %eax	# 228	[c=4 l=2]  *movsi_internal/0
+	subl	5176(%rbx), %eax	# 102	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %eax	# 103	[c=13 l=6]  *cmpsi_1/1
+	jb	.L481	# 104	[c=13 l=2]  *jcc
+	movl	%ebp, %eax	# 230	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %eax	# 106	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 220	[c=5 l=5]  *andsi_1_zext
+	cmpb	$0, 1080(%rbx,%rax)	# 109	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L497	# 110	[c=13 l=2]  *jcc
+.L481:
+	movq	1040(%rbx), %rax	# 114	[c=9 l=7]  *movdi_internal/3
+	movslq	%ebp, %rbp	# 113	[c=4 l=3]  *extendsidi2_rex64/1
+	movzbl	(%rax,%rbp), %eax	# 115	[c=13 l=4]  *zero_extendqisi2/0
+	addq	$8, %rsp	# 246	[c=4 l=4]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx	# 247	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 48
+	popq	%rbp	# 248	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 40
+	popq	%r12	# 249	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 32
+	popq	%r13	# 250	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 24
+	popq	%r14	# 251	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 16
+	popq	%r15	# 252	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 8
+	ret		# 253	[c=0 l=1]  simple_return_internal
+	.p2align 4,,10
+	.p2align 3
+.L470:
+	.cfi_restore_state
+	movq	1040(%rdi), %rdx	# 158	[c=9 l=7]  *movdi_internal/3
+	movzbl	61(%rdx), %r15d	# 159	[c=13 l=5]  *zero_extendqisi2/0
+	cmpl	%r14d, %eax	# 161	[c=4 l=3]  *cmpsi_1/0
+	jnb	.L486	# 162	[c=13 l=6]  *jcc
+	jmp	.L485	# 278	[c=1 l=5]  jump
+	.p2align 4,,10
+	.p2align 3
+.L496:
+	movzbl	%dl, %edx	# 89	[c=4 l=3]  *zero_extendqisi2/0
+	movl	$62, %esi	# 91	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 92	[c=4 l=3]  *movdi_internal/3
+	call	data_write_mapped	# 93	[c=0 l=5]  *call
+	jmp	.L480	# 280	[c=1 l=5]  jump
+	.p2align 4,,10
+	.p2align 3
+.L497:
+	addq	$8, %rsp	# 257	[c=4 l=4]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	movl	%ebp, %esi	# 120	[c=4 l=2]  *movsi_internal/0
+	movq	%rbx, %rdi	# 121	[c=4 l=3]  *movdi_internal/3
+	popq	%rbx	# 258	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 48
+	popq	%rbp	# 259	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 40
+	popq	%r12	# 260	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 32
+	popq	%r13	# 261	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 24
+	popq	%r14	# 262	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 16
+	popq	%r15	# 263	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 8
+	jmp	data_read_page	# 122	[c=10 l=5]  *sibcall_value
+	.p2align 4,,10
+	.p2align 3
+.L493:
+	.cfi_restore_state
+	movl	$61, %esi	# 20	[c=4 l=5]  *movsi_internal/0
+	call	data_read_mapped	# 22	[c=10 l=5]  *call_value
+	movl	%eax, %r12d	# 23	[c=4 l=3]  *movsi_internal/0
+	cmpl	%r14d, %r13d	# 24	[c=4 l=3]  *cmpsi_1/0
+	jb	.L498	# 25	[c=13 l=6]  *jcc
+	movl	$62, %esi	# 139	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 140	[c=4 l=3]  *movdi_internal/3
+	call	data_read_mapped	# 141	[c=10 l=5]  *call_value
+	sall	$8, %eax	# 143	[c=4 l=3]  *ashlsi3_1/0
+	movl	%eax, %ebp	# 233	[c=4 l=2]  *movsi_internal/0
+	orl	%r12d, %ebp	# 144	[c=4 l=3]  *iorsi_1/0
+	addl	$1, %ebp	# 145	[c=4 l=3]  *addsi_1/0
+.L492:
+	movzbl	%bpl, %edx	# 61	[c=4 l=4]  *zero_extendqisi2/0
+	movl	$61, %esi	# 65	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 66	[c=4 l=3]  *movdi_internal/3
+	call	data_write_mapped	# 67	[c=0 l=5]  *call
+	jmp	.L478	# 283	[c=1 l=5]  jump
+	.p2align 4,,10
+	.p2align 3
+.L494:
+	movzbl	62(%rdx), %ebp	# 168	[c=13 l=4]  *zero_extendqisi2/0
+	sall	$8, %ebp	# 169	[c=4 l=3]  *ashlsi3_1/0
+	orl	%r15d, %ebp	# 170	[c=4 l=3]  *iorsi_1/0
+	addl	$1, %ebp	# 171	[c=4 l=3]  *addsi_1/0
+.L487:
+	cmpb	$1, 1081(%rbx)	# 58	[c=13 l=7]  *cmpqi_1/0
+	ja	.L492	# 59	[c=13 l=2]  *jcc
+	jmp	.L477	# 286	[c=1 l=5]  jump
+	.p2align 4,,10
+	.p2align 3
+.L495:
+	movl	$62, %esi	# 35	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 36	[c=4 l=3]  *movdi_internal/3
+	call	data_read_mapped	# 37	[c=10 l=5]  *call_value
+	sall	$8, %eax	# 39	[c=4 l=3]  *ashlsi3_1/0
+	movl	%eax, %ebp	# 225	[c=4 l=2]  *movsi_internal/0
+	orl	%r15d, %ebp	# 40	[c=4 l=3]  *iorsi_1/0
+	addl	$1, %ebp	# 41	[c=4 l=3]  *addsi_1/0
+	cmpl	%r14d, %r12d	# 42	[c=4 l=3]  *cmpsi_1/0
+	jnb	.L492	# 43	[c=13 l=2]  *jcc
+	movq	1040(%rbx), %rdx	# 72	[c=9 l=7]  *movdi_internal/3
+	jmp	.L477	# 288	[c=1 l=5]  jump
+	.p2align 4,,10
+	.p2align 3
+.L498:
+	movq	1040(%rbx), %rdx	# 50	[c=9 l=7]  *movdi_internal/3
+	movzbl	62(%rdx), %ebp	# 51	[c=13 l=4]  *zero_extendqisi2/0
+	sall	$8, %ebp	# 52	[c=4 l=3]  *ashlsi3_1/0
+	orl	%eax, %ebp	# 53	[c=4 l=2]  *iorsi_1/0
+	addl	$1, %ebp	# 54	[c=4 l=3]  *addsi_1/0
+	jmp	.L487	# 290	[c=1 l=2]  jump
+	.cfi_endproc
+.LFE73:
+	.size	pop_byte, .-pop_byte
+	.p2align 4
+	.type	data_write_page, @function
+data_write_page:
+.LFB46:
+	.cfi_startproc
+	movl	%esi, %eax	# 118	[c=4 l=2]  *movsi_internal/0
+	subl	5176(%rdi), %eax	# 9	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rdi), %eax	# 10	[c=13 l=6]  *cmpsi_1/1
+	jb	.L500	# 11	[c=13 l=2]  *jcc
+	movl	%esi, %eax	# 120	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %eax	# 13	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 116	[c=5 l=5]  *andsi_1_zext
+	cmpb	$1, 1080(%rdi,%rax)	# 16	[c=14 l=8]  *cmpqi_1/0
+	je	.L501	# 17	[c=13 l=2]  *jcc
+.L500:
+	jmp	data_write_mapped	# 23	[c=0 l=5]  *sibcall
+	.p2align 4,,10
+	.p2align 3
+.L501:
+	cmpl	$63, %esi	# 27	[c=4 l=3]  *cmpsi_1/0
+	je	.L517	# 28	[c=13 l=2]  *jcc
+	cmpl	6564(%rdi), %esi	# 53	[c=13 l=6]  *cmpsi_1/1
+	jnb	.L505	# 54	[c=13 l=2]  *jcc
+	movslq	%esi, %rax	# 56	[c=4 l=3]  *extendsidi2_rex64/1
+	cmpb	$0, 6568(%rdi,%rax)	# 57	[c=14 l=8]  *cmpqi_ccno_1/1
+	je	.L505	# 58	[c=13 l=2]  *jcc
+	cmpl	$1, 96(%rdi)	# 69	[c=13 l=4]  *cmpsi_1/0
+	movq	48(%rdi), %rcx	# 68	[c=9 l=4]  *movdi_internal/3
+	je	.L518	# 70	[c=13 l=2]  *jcc
+.L509:
+	jmp	periph_write@PLT	# 84	[c=0 l=5]  *sibcall
+	.p2align 4,,10
+	.p2align 3
+.L517:
+	movzbl	100(%rdi), %eax	# 30	[c=9 l=4]  *movqi_internal/4
+	testb	%al, %al	# 31	[c=4 l=2]  *cmpqi_ccno_1/0
+	je	.L503	# 32	[c=13 l=2]  *jcc
+	movq	1040(%rdi), %r8	# 34	[c=9 l=7]  *movdi_internal/3
+	movzbl	%al, %esi	# 36	[c=4 l=3]  *zero_extendqisi2/0
+	notl	%esi	# 37	[c=4 l=2]  *one_cmplsi2_1/0
+	movzbl	63(%r8), %ecx	# 35	[c=13 l=5]  *zero_extendqisi2/0
+	andl	%esi, %ecx	# 38	[c=4 l=2]  *andsi_1/0
+	movq	104(%rdi), %rsi	# 39	[c=9 l=4]  *movdi_internal/3
+	andb	(%rsi), %al	# 40	[c=9 l=2]  *andqi_1/1
+	movzbl	%al, %eax	# 41	[c=4 l=3]  *zero_extendqisi2/0
+	orl	%ecx, %eax	# 42	[c=4 l=2]  *iorsi_1/0
+	movb	%al, 63(%r8)	# 43	[c=4 l=4]  *movqi_internal/8
+	movb	$0, 100(%rdi)	# 44	[c=4 l=4]  *movqi_internal/8
+.L503:
+	movq	1040(%rdi), %rax	# 47	[c=9 l=7]  *movdi_internal/3
+	movb	%dl, 63(%rax)	# 48	[c=4 l=3]  *movqi_internal/8
+	ret		# 110	[c=0 l=1]  simple_return_internal
+	.p2align 4,,10
+	.p2align 3
+.L505:
+	cmpl	%esi, 1000(%rdi)	# 61	[c=13 l=6]  *cmpsi_1/0
+	jb	.L519	# 62	[c=13 l=2]  *jcc
+	movq	1040(%rdi), %rax	# 95	[c=9 l=7]  *movdi_internal/3
+	movslq	%esi, %rsi	# 94	[c=4 l=3]  *extendsidi2_rex64/1
+	movb	%dl, (%rax,%rsi)	# 96	[c=4 l=3]  *movqi_internal/8
+	ret		# 129	[c=0 l=1]  simple_return_internal
+.L518:
+	movl	(%rdi), %eax	# 72	[c=6 l=2]  *zero_extendsidi2/3
+	salq	$4, %rax	# 74	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rdi), %rax	# 75	[c=13 l=7]  *adddi_1/1
+	movzwl	14(%rax), %eax	# 76	[c=13 l=4]  zero_extendhidi2/0
+	subq	%rax, %rcx	# 77	[c=4 l=3]  *subdi_1/0
+	jmp	.L509	# 146	[c=1 l=2]  jump
+.L519:
+	pushq	%rax	# 142	[c=4 l=1]  *pushdi2_prologue
+	.cfi_def_cfa_offset 16
+	call	bad_address	# 90	[c=0 l=5]  *call
+	.cfi_endproc
+.LFE46:
+	.size	data_write_page, .-data_write_page
+	.p2align 4
+	.type	do_events, @function
+do_events:
+.LFB217:
+	.cfi_startproc
+	pushq	%r15	# 435	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14	# 436	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13	# 437	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12	# 438	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp	# 439	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx	# 440	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	movq	%rdi, %rbx	# 2	[c=4 l=3]  *movdi_internal/3
+	subq	$8, %rsp	# 441	[c=4 l=4]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_def_cfa_offset 64
+	cmpb	$0, 6040(%rdi)	# 6	[c=13 l=7]  *cmpqi_ccno_1/1
+	jne	.L560	# 7	[c=13 l=6]  *jcc
+.L522:
+	movq	%rbx, %rdi	# 38	[c=4 l=3]  *movdi_internal/3
+	call	events_run@PLT	# 39	[c=0 l=5]  *call
+	movq	1040(%rbx), %rax	# 41	[c=9 l=7]  *movdi_internal/3
+	movzbl	100(%rbx), %ecx	# 40	[c=13 l=4]  *zero_extendqisi2/0
+	movzbl	63(%rax), %eax	# 42	[c=13 l=4]  *zero_extendqisi2/0
+	movl	%ecx, %edx	# 434	[c=4 l=2]  *movsi_internal/0
+	notl	%ecx	# 44	[c=4 l=2]  *one_cmplsi2_1/0
+	andl	%ecx, %eax	# 45	[c=4 l=2]  *andsi_1/0
+	movq	104(%rbx), %rcx	# 46	[c=9 l=4]  *movdi_internal/3
+	andb	(%rcx), %dl	# 47	[c=9 l=2]  *andqi_1/1
+	orl	%edx, %eax	# 49	[c=4 l=2]  *iorsi_1/0
+	testb	$-128, %al	# 432	[c=4 l=2]  *testqi_1_maybe_si/1
+	je	.L524	# 52	[c=13 l=6]  *jcc
+	movq	6024(%rbx), %rax	# 54	[c=9 l=7]  *movdi_internal/3
+	cmpq	%rax, 48(%rbx)	# 55	[c=13 l=4]  *cmpdi_1/0
+	je	.L525	# 56	[c=13 l=6]  *jcc
+	movq	%rbx, %rdi	# 58	[c=4 l=3]  *movdi_internal/3
+	call	irq_take@PLT	# 59	[c=10 l=5]  *call_value
+	movl	%eax, %r13d	# 60	[c=4 l=3]  *movsi_internal/0
+	testl	%eax, %eax	# 63	[c=4 l=2]  *cmpsi_ccno_1/0
+	js	.L524	# 64	[c=13 l=6]  *jcc
+	movl	%eax, %esi	# 71	[c=4 l=2]  *movsi_internal/0
+	movq	%rbx, %rdi	# 72	[c=4 l=3]  *movdi_internal/3
+	call	periph_irq_taken@PLT	# 73	[c=0 l=5]  *call
+	movl	5176(%rbx), %r12d	# 74	[c=9 l=7]  *movsi_internal/0
+	movl	$61, %eax	# 76	[c=4 l=5]  *movsi_internal/0
+	movl	5180(%rbx), %r15d	# 75	[c=9 l=7]  *movsi_internal/0
+	subl	%r12d, %eax	# 77	[c=4 l=3]  *subsi_1/0
+	cmpl	%r15d, %eax	# 78	[c=4 l=3]  *cmpsi_1/0
+	jb	.L527	# 79	[c=13 l=6]  *jcc
+	cmpb	$1, 1081(%rbx)	# 83	[c=13 l=7]  *cmpqi_1/0
+	ja	.L561	# 84	[c=13 l=6]  *jcc
+	movq	1040(%rbx), %rax	# 340	[c=9 l=7]  *movdi_internal/3
+	movzbl	61(%rax), %r14d	# 341	[c=13 l=5]  *zero_extendqisi2/0
+.L531:
+	movzbl	62(%rax), %ebp	# 123	[c=13 l=4]  *zero_extendqisi2/0
+.L532:
+	movl	996(%rbx), %edx	# 129	[c=9 l=6]  *movsi_internal/0
+	movzbl	840(%rbx), %eax	# 131	[c=13 l=7]  *zero_extendqisi2/0
+	sall	$8, %ebp	# 126	[c=4 l=3]  *ashlsi3_1/0
+	orl	%r14d, %ebp	# 127	[c=4 l=3]  *iorsi_1/0
+	leal	1(%rdx,%rax), %eax	# 132	[c=5 l=4]  *leasi
+	cmpl	%eax, %ebp	# 133	[c=4 l=2]  *cmpsi_1/0
+	jb	.L562	# 134	[c=13 l=6]  *jcc
+	movl	%ebp, %eax	# 403	[c=4 l=2]  *movsi_internal/0
+	movl	(%rbx), %edx	# 142	[c=5 l=2]  *movsi_internal/0
+	leal	-1(%rbp), %r14d	# 431	[c=4 l=4]  *leasi
+	subl	%r12d, %eax	# 144	[c=4 l=3]  *subsi_1/0
+	cmpl	%r15d, %eax	# 145	[c=4 l=3]  *cmpsi_1/0
+	jb	.L534	# 146	[c=13 l=2]  *jcc
+	movl	%ebp, %eax	# 405	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %eax	# 148	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 399	[c=5 l=5]  *andsi_1_zext
+	cmpb	$0, 1080(%rbx,%rax)	# 151	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L535	# 152	[c=13 l=6]  *jcc
+.L534:
+	movq	1040(%rbx), %rcx	# 156	[c=9 l=7]  *movdi_internal/3
+	movslq	%ebp, %rax	# 155	[c=4 l=3]  *extendsidi2_rex64/1
+	movb	%dl, (%rcx,%rax)	# 157	[c=4 l=3]  *movqi_internal/8
+.L536:
+	movl	(%rbx), %edx	# 407	[c=5 l=2]  *movsi_internal/0
+	movl	%r14d, %eax	# 409	[c=4 l=3]  *movsi_internal/0
+	leal	-2(%rbp), %r12d	# 430	[c=4 l=4]  *leasi
+	subl	5176(%rbx), %eax	# 171	[c=13 l=6]  *subsi_1/1
+	shrl	$8, %edx	# 169	[c=4 l=3]  *lshrsi3_1/0
+	cmpl	5180(%rbx), %eax	# 172	[c=13 l=6]  *cmpsi_1/1
+	jb	.L537	# 173	[c=13 l=2]  *jcc
+	movl	%r14d, %eax	# 411	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %eax	# 175	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 398	[c=5 l=5]  *andsi_1_zext
+	cmpb	$0, 1080(%rbx,%rax)	# 178	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L538	# 179	[c=13 l=6]  *jcc
+.L537:
+	movq	1040(%rbx), %rax	# 183	[c=9 l=7]  *movdi_internal/3
+	movslq	%r14d, %r14	# 182	[c=4 l=3]  *extendsidi2_rex64/1
+	movb	%dl, (%rax,%r14)	# 184	[c=4 l=4]  *movqi_internal/8
+.L539:
+	cmpb	$0, 840(%rbx)	# 195	[c=13 l=7]  *cmpqi_ccno_1/1
+	je	.L540	# 196	[c=13 l=2]  *jcc
+	movl	(%rbx), %edx	# 413	[c=5 l=2]  *movsi_internal/0
+	movl	%r12d, %eax	# 415	[c=4 l=3]  *movsi_internal/0
+	subl	5176(%rbx), %eax	# 200	[c=13 l=6]  *subsi_1/1
+	shrl	$16, %edx	# 199	[c=4 l=3]  *lshrsi3_1/0
+	cmpl	5180(%rbx), %eax	# 201	[c=13 l=6]  *cmpsi_1/1
+	jb	.L541	# 202	[c=13 l=2]  *jcc
+	movl	%r12d, %eax	# 417	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %eax	# 204	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 397	[c=5 l=5]  *andsi_1_zext
+	cmpb	$0, 1080(%rbx,%rax)	# 207	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L542	# 208	[c=13 l=6]  *jcc
+.L541:
+	movq	1040(%rbx), %rax	# 212	[c=9 l=7]  *movdi_internal/3
+	movslq	%r12d, %r12	# 211	[c=4 l=3]  *extendsidi2_rex64/1
+	movb	%dl, (%rax,%r12)	# 213	[c=4 l=4]  *movqi_internal/8
+.L543:
+	leal	-3(%rbp), %r12d	# 429	[c=4 l=4]  *leasi
+	.p2align 4,,10
+	.p2align 3
+.L540:
+	movl	$61, %eax	# 227	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%rbx), %eax	# 228	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %eax	# 229	[c=13 l=6]  *cmpsi_1/1
+	jb	.L544	# 230	[c=13 l=2]  *jcc
+	cmpb	$1, 1081(%rbx)	# 234	[c=13 l=7]  *cmpqi_1/0
+	ja	.L563	# 235	[c=13 l=6]  *jcc
+.L544:
+	movq	1040(%rbx), %rax	# 246	[c=9 l=7]  *movdi_internal/3
+	movb	%r12b, 61(%rax)	# 247	[c=4 l=4]  *movqi_internal/8
+.L545:
+	movl	$62, %eax	# 251	[c=4 l=5]  *movsi_internal/0
+	sarl	$8, %r12d	# 250	[c=4 l=4]  *ashrsi3_1/0
+	subl	5176(%rbx), %eax	# 252	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %eax	# 253	[c=13 l=6]  *cmpsi_1/1
+	jb	.L546	# 254	[c=13 l=2]  *jcc
+	cmpb	$1, 1081(%rbx)	# 258	[c=13 l=7]  *cmpqi_1/0
+	ja	.L564	# 259	[c=13 l=6]  *jcc
+.L546:
+	movq	1040(%rbx), %rax	# 270	[c=9 l=7]  *movdi_internal/3
+	movb	%r12b, 62(%rax)	# 271	[c=4 l=4]  *movqi_internal/8
+.L547:
+	movq	104(%rbx), %rdx	# 276	[c=9 l=4]  *movdi_internal/3
+	movzbl	100(%rbx), %eax	# 274	[c=13 l=4]  *zero_extendqisi2/0
+	movzbl	(%rdx), %esi	# 466	[c=5 l=3]  *movqi_internal/4
+	andb	$127, %al	# 424	[c=4 l=2]  *andqi_1_slp/0
+	leaq	101(%rbx), %rdx	# 428	[c=4 l=4]  *leadi
+	movq	%rdx, 104(%rbx)	# 282	[c=4 l=4]  *movdi_internal/5
+	andl	%eax, %esi	# 496	[c=4 l=2]  *andsi_1/0
+	orl	$-128, %eax	# 427	[c=4 l=3]  *iorsi_1/0
+	cmpl	$8192, 880(%rbx)	# 285	[c=13 l=10]  *cmpsi_1/0
+	movb	%sil, 101(%rbx)	# 278	[c=4 l=4]  *movqi_internal/8
+	movb	%al, 100(%rbx)	# 280	[c=4 l=3]  *movqi_internal/8
+	jbe	.L548	# 286	[c=13 l=2]  *jcc
+	addl	%r13d, %r13d	# 288	[c=4 l=3]  *ashlsi3_1/0
+.L548:
+	movq	48(%rbx), %rdi	# 421	[c=9 l=4]  *movdi_internal/3
+	movl	%r13d, (%rbx)	# 291	[c=4 l=3]  *movsi_internal/1
+	leaq	5(%rdi), %rdx	# 423	[c=4 l=4]  *leadi
+	movq	%rdx, 48(%rbx)	# 294	[c=4 l=4]  *movdi_internal/5
+	cmpq	6032(%rbx), %rdx	# 295	[c=13 l=7]  *cmpdi_1/1
+	jb	.L520	# 296	[c=13 l=2]  *jcc
+.L549:
+	movq	1040(%rbx), %rdi	# 317	[c=9 l=7]  *movdi_internal/3
+	movzbl	%al, %ecx	# 319	[c=4 l=3]  *zero_extendqisi2/0
+	andl	%esi, %eax	# 422	[c=4 l=2]  *andsi_1/0
+	notl	%ecx	# 320	[c=4 l=2]  *one_cmplsi2_1/0
+	movzbl	%al, %eax	# 323	[c=4 l=3]  *zero_extendqisi2/0
+	movzbl	63(%rdi), %edx	# 318	[c=13 l=4]  *zero_extendqisi2/0
+	andl	%ecx, %edx	# 321	[c=4 l=2]  *andsi_1/0
+	orl	%edx, %eax	# 324	[c=4 l=2]  *iorsi_1/0
+	movb	%al, 63(%rdi)	# 325	[c=4 l=3]  *movqi_internal/8
+	movb	$0, 100(%rbx)	# 326	[c=4 l=4]  *movqi_internal/8
+	jmp	.L552	# 473	[c=1 l=2]  jump
+	.p2align 4,,10
+	.p2align 3
+.L524:
+	movq	48(%rbx), %rax	# 302	[c=9 l=4]  *movdi_internal/3
+.L525:
+	cmpq	6032(%rbx), %rax	# 306	[c=13 l=7]  *cmpdi_1/1
+	jb	.L520	# 307	[c=13 l=2]  *jcc
+	movzbl	100(%rbx), %eax	# 309	[c=9 l=4]  *movqi_internal/4
+	testb	%al, %al	# 310	[c=4 l=2]  *cmpqi_ccno_1/0
+	jne	.L565	# 311	[c=13 l=6]  *jcc
+.L552:
+	movq	%rbx, %rdi	# 329	[c=4 l=3]  *movdi_internal/3
+	call	checkpoint_begin@PLT	# 330	[c=0 l=5]  *call
+	addq	$8, %rsp	# 455	[c=4 l=4]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	movq	%rbx, %rdi	# 331	[c=4 l=3]  *movdi_internal/3
+	popq	%rbx	# 456	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 48
+	popq	%rbp	# 457	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 40
+	popq	%r12	# 458	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 32
+	popq	%r13	# 459	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 24
+	popq	%r14	# 460	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 16
+	popq	%r15	# 461	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 8
+	jmp	checkpoint_end@PLT	# 332	[c=0 l=5]  *sibcall
+	.p2align 4,,10
+	.p2align 3
+.L520:
+	.cfi_restore_state
+	addq	$8, %rsp	# 444	[c=4 l=4]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx	# 445	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 48
+	popq	%rbp	# 446	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 40
+	popq	%r12	# 447	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 32
+	popq	%r13	# 448	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 24
+	popq	%r14	# 449	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 16
+	popq	%r15	# 450	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 8
+	ret		# 451	[c=0 l=1]  simple_return_internal
+	.p2align 4,,10
+	.p2align 3
+.L560:
+	.cfi_restore_state
+	call	fork_server_poll@PLT	# 14	[c=10 l=5]  *call_value
+	testb	%al, %al	# 17	[c=4 l=2]  *cmpqi_ccno_1/0
+	je	.L522	# 18	[c=13 l=6]  *jcc
+	movl	820(%rbx), %edx	# 20	[c=9 l=6]  *movsi_internal/0
+	movzwl	816(%rbx), %eax	# 27	[c=13 l=7]  *zero_extendhisi2/0
+	movzbl	%dh, %ecx	# 28	[c=4 l=3]  *extzvsi
+	sall	$8, %eax	# 29	[c=4 l=3]  *ashlsi3_1/0
+	movzbl	%dl, %edx	# 31	[c=4 l=3]  *zero_extendqisi2/0
+	orl	%ecx, %eax	# 30	[c=4 l=2]  *iorsi_1/0
+	sall	$8, %eax	# 32	[c=4 l=3]  *ashlsi3_1/0
+	orl	%edx, %eax	# 34	[c=4 l=2]  *iorsi_1/0
+	movl	%eax, 1026(%rbx)	# 35	[c=4 l=6]  *movv4qi_internal/1
+	jmp	.L522	# 476	[c=1 l=5]  jump
+	.p2align 4,,10
+	.p2align 3
+.L527:
+	movq	1040(%rbx), %rax	# 99	[c=9 l=7]  *movdi_internal/3
+	movl	$62, %edx	# 101	[c=4 l=5]  *movsi_internal/0
+	subl	%r12d, %edx	# 102	[c=4 l=3]  *subsi_1/0
+	movzbl	61(%rax), %r14d	# 100	[c=13 l=5]  *zero_extendqisi2/0
+	cmpl	%r15d, %edx	# 103	[c=4 l=3]  *cmpsi_1/0
+	jb	.L531	# 104	[c=13 l=6]  *jcc
+	cmpb	$1, 1081(%rbx)	# 108	[c=13 l=7]  *cmpqi_1/0
+	jbe	.L531	# 109	[c=13 l=6]  *jcc
+.L530:
+	movl	$62, %esi	# 112	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 113	[c=4 l=3]  *movdi_internal/3
+	call	data_read_mapped	# 114	[c=10 l=5]  *call_value
+	movl	%eax, %ebp	# 115	[c=4 l=2]  *movsi_internal/0
+	jmp	.L532	# 478	[c=1 l=5]  jump
+	.p2align 4,,10
+	.p2align 3
+.L565:
+	movq	104(%rbx), %rdx	# 313	[c=9 l=4]  *movdi_internal/3
+	movzbl	(%rdx), %esi	# 314	[c=5 l=3]  *movqi_internal/4
+	jmp	.L549	# 480	[c=1 l=5]  jump
+	.p2align 4,,10
+	.p2align 3
+.L564:
+	movzbl	%r12b, %edx	# 261	[c=4 l=4]  *zero_extendqisi2/0
+	movl	$62, %esi	# 263	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 264	[c=4 l=3]  *movdi_internal/3
+	call	data_write_mapped	# 265	[c=0 l=5]  *call
+	jmp	.L547	# 482	[c=1 l=5]  jump
+	.p2align 4,,10
+	.p2align 3
+.L563:
+	movzbl	%r12b, %edx	# 237	[c=4 l=4]  *zero_extendqisi2/0
+	movl	$61, %esi	# 239	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 240	[c=4 l=3]  *movdi_internal/3
+	call	data_write_mapped	# 241	[c=0 l=5]  *call
+	jmp	.L545	# 484	[c=1 l=5]  jump
+	.p2align 4,,10
+	.p2align 3
+.L535:
+	movl	%ebp, %esi	# 163	[c=4 l=2]  *movsi_internal/0
+	movq	%rbx, %rdi	# 164	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 165	[c=0 l=5]  *call
+	jmp	.L536	# 486	[c=1 l=5]  jump
+	.p2align 4,,10
+	.p2align 3
+.L538:
+	movl	%r14d, %esi	# 190	[c=4 l=3]  *movsi_internal/0
+	movq	%rbx, %rdi	# 191	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 192	[c=0 l=5]  *call
+	jmp	.L539	# 488	[c=1 l=5]  jump
+	.p2align 4,,10
+	.p2align 3
+.L561:
+	movl	$61, %esi	# 86	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 87	[c=4 l=3]  *movdi_internal/3
+	call	data_read_mapped	# 88	[c=10 l=5]  *call_value
+	movl	%eax, %r14d	# 89	[c=4 l=3]  *movsi_internal/0
+	movl	$62, %eax	# 90	[c=4 l=5]  *movsi_internal/0
+	subl	%r12d, %eax	# 91	[c=4 l=3]  *subsi_1/0
+	cmpl	%r15d, %eax	# 92	[c=4 l=3]  *cmpsi_1/0
+	jnb	.L530	# 93	[c=13 l=6]  *jcc
+	movq	1040(%rbx), %rax	# 120	[c=9 l=7]  *movdi_internal/3
+	jmp	.L531	# 490	[c=1 l=5]  jump
+	.p2align 4,,10
+	.p2align 3
+.L542:
+	movl	%r12d, %esi	# 219	[c=4 l=3]  *movsi_internal/0
+	movq	%rbx, %rdi	# 220	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 221	[c=0 l=5]  *call
+	jmp	.L543	# 492	[c=1 l=5]  jump
+.L562:
+	movl	%ebp, %esi	# 136	[c=4 l=2]  *movsi_internal/0
+	movq	%rbx, %rdi	# 137	[c=4 l=3]  *movdi_internal/3
+	call	stack_overflow	# 138	[c=0 l=5]  *call
+	.cfi_endproc
+.LFE217:
+	.size	do_events, .-do_events
+	.p2align 4
+	.type	ramp_indirect, @function
+ramp_indirect:
+.LFB85:
+	.cfi_startproc
+	pushq	%r15	# 373	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	movl	%ecx, %r15d	# 5	[c=4 l=3]  *movsi_internal/0
+	movslq	%esi, %r10	# 3	[c=4 l=3]  *extendsidi2_rex64/1
+	pushq	%r14	# 374	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13	# 375	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12	# 376	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	movslq	%edx, %r12	# 4	[c=4 l=3]  *extendsidi2_rex64/1
+	movl	%r9d, %edx	# 287	[c=4 l=3]  *movsi_internal/0
+	pushq	%rbp	# 377	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	leal	1(%r12), %ecx	# 368	[c=4 l=5]  *leasi
+	leal	-26(%r12), %r14d	# 367	[c=4 l=5]  *leasi
+	pushq	%rbx	# 378	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	movslq	%ecx, %rcx	# 22	[c=4 l=3]  *extendsidi2_rex64/1
+	sarl	%r14d	# 17	[c=4 l=3]  *ashrsi3_1/0
+	movq	%rdi, %rbx	# 2	[c=4 l=3]  *movdi_internal/3
+	addl	$57, %r14d	# 18	[c=4 l=4]  *addsi_1/0
+	movslq	%r14d, %r11	# 21	[c=4 l=3]  *extendsidi2_rex64/1
+	subq	$56, %rsp	# 379	[c=4 l=4]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_def_cfa_offset 112
+	movzbl	1004(%rdi,%rcx), %ebp	# 23	[c=14 l=8]  *zero_extendqisi2/0
+	movzbl	1004(%rdi,%r12), %esi	# 26	[c=14 l=9]  *zero_extendqisi2/0
+	movq	1040(%rdi), %rax	# 20	[c=9 l=7]  *movdi_internal/3
+	sall	$8, %ebp	# 24	[c=4 l=3]  *ashlsi3_1/0
+	orl	%esi, %ebp	# 27	[c=4 l=2]  *iorsi_1/0
+	movzbl	(%rax,%r11), %esi	# 28	[c=13 l=5]  *zero_extendqisi2/0
+	sall	$16, %esi	# 29	[c=4 l=3]  *ashlsi3_1/0
+	orl	%esi, %ebp	# 30	[c=4 l=2]  *iorsi_1/0
+	xorl	%esi, %esi	# 403	[c=4 l=2]  *movsi_xor
+	cmpl	$-1, %r15d	# 404	[c=4 l=4]  *cmpsi_1/0
+	sete	%sil	# 405	[c=4 l=4]  *setcc_qi_slp
+	movl	%ebp, %r9d	# 310	[c=4 l=3]  *movsi_internal/0
+	subl	%esi, %r9d	# 270	[c=4 l=3]  *subsi_1/0
+	leal	(%r9,%r8), %r13d	# 371	[c=4 l=4]  *leasi
+	movl	%r13d, %esi	# 312	[c=4 l=3]  *movsi_internal/0
+	movl	%r13d, %edi	# 314	[c=4 l=3]  *movsi_internal/0
+	andl	$16777215, %esi	# 38	[c=4 l=6]  *andsi_1/0
+	andl	$16711680, %edi	# 39	[c=4 l=6]  *andsi_1/0
+	testb	%dl, %dl	# 40	[c=4 l=2]  *cmpqi_ccno_1/0
+	je	.L568	# 41	[c=13 l=2]  *jcc
+	movzbl	1004(%rbx,%r10), %edx	# 44	[c=14 l=9]  *zero_extendqisi2/0
+	testl	%edi, %edi	# 45	[c=4 l=2]  *cmpsi_ccno_1/0
+	jne	.L569	# 46	[c=13 l=6]  *jcc
+	movl	%esi, %edi	# 316	[c=4 l=2]  *movsi_internal/0
+	subl	5176(%rbx), %edi	# 48	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %edi	# 49	[c=13 l=6]  *cmpsi_1/1
+	jb	.L570	# 50	[c=13 l=2]  *jcc
+	movl	%esi, %edi	# 318	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %edi	# 52	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %edi	# 308	[c=5 l=6]  *andsi_1_zext
+	cmpb	$0, 1080(%rbx,%rdi)	# 55	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L571	# 56	[c=13 l=6]  *jcc
+.L570:
+	movslq	%esi, %rsi	# 59	[c=4 l=3]  *extendsidi2_rex64/1
+	movb	%dl, (%rax,%rsi)	# 60	[c=4 l=3]  *movqi_internal/8
+	testl	%r15d, %r15d	# 407	[c=4 l=3]  *cmpsi_ccno_1/0
+	jns	.L602	# 408	[c=13 l=2]  *jcc
+	.p2align 4,,10
+	.p2align 3
+.L580:
+	cmpl	$1, %r15d	# 191	[c=4 l=4]  *cmpsi_1/0
+	je	.L583	# 192	[c=13 l=2]  *jcc
+	movl	%r9d, %r13d	# 13	[c=4 l=3]  *movsi_internal/0
+	testl	%r15d, %r15d	# 194	[c=4 l=3]  *cmpsi_ccno_1/0
+	je	.L581	# 195	[c=13 l=2]  *jcc
+	jmp	.L582	# 412	[c=1 l=2]  jump
+	.p2align 4,,10
+	.p2align 3
+.L568:
+	testl	%edi, %edi	# 123	[c=4 l=2]  *cmpsi_ccno_1/0
+	je	.L603	# 124	[c=13 l=6]  *jcc
+	movl	%r13d, %eax	# 327	[c=4 l=3]  *movsi_internal/0
+	movq	1072(%rbx), %rdx	# 155	[c=9 l=7]  *movdi_internal/3
+	sarl	$12, %eax	# 152	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 305	[c=5 l=5]  *andsi_1_zext
+	movq	(%rdx,%rax,8), %rdx	# 156	[c=10 l=4]  *movdi_internal/3
+	xorl	%eax, %eax	# 402	[c=4 l=2]  *movdi_xor
+	testq	%rdx, %rdx	# 157	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L579	# 158	[c=13 l=2]  *jcc
+	movl	%r13d, %eax	# 330	[c=4 l=3]  *movsi_internal/0
+	andl	$4095, %eax	# 304	[c=5 l=5]  *andsi_1_zext
+	movzbl	(%rdx,%rax), %eax	# 162	[c=9 l=4]  *movqi_internal/4
+.L579:
+	movb	%al, 1004(%rbx,%r10)	# 166	[c=4 l=8]  *movqi_internal/8
+.L572:
+	testl	%r15d, %r15d	# 174	[c=4 l=3]  *cmpsi_ccno_1/0
+	js	.L580	# 175	[c=13 l=2]  *jcc
+.L602:
+	testl	%r8d, %r8d	# 178	[c=4 l=3]  *cmpsi_ccno_1/0
+	jne	.L580	# 179	[c=13 l=2]  *jcc
+	subq	$1, 48(%rbx)	# 181	[c=13 l=5]  *adddi_1/0
+	cmpl	$1, %r15d	# 182	[c=4 l=4]  *cmpsi_1/0
+	jne	.L581	# 183	[c=13 l=2]  *jcc
+.L583:
+	leal	1(%r9), %r13d	# 366	[c=4 l=4]  *leasi
+.L582:
+	movl	%r13d, %eax	# 333	[c=4 l=3]  *movsi_internal/0
+	movb	%r13b, 1004(%rbx,%r12)	# 199	[c=4 l=8]  *movqi_internal/8
+	movb	%ah, 1004(%rbx,%rcx)	# 401	[c=4 l=7]  *extzvqi_mem_rex64
+.L581:
+	xorl	%r13d, %ebp	# 205	[c=4 l=3]  *xorsi_1/0
+	cmpl	$65535, %ebp	# 208	[c=4 l=6]  *cmpsi_1/0
+	jbe	.L566	# 209	[c=13 l=2]  *jcc
+	movl	%r14d, %eax	# 334	[c=4 l=3]  *movsi_internal/0
+	sarl	$16, %r13d	# 211	[c=4 l=4]  *ashrsi3_1/0
+	subl	5176(%rbx), %eax	# 212	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %eax	# 213	[c=13 l=6]  *cmpsi_1/1
+	jb	.L585	# 214	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%rbx)	# 216	[c=13 l=7]  *cmpqi_ccno_1/1
+	jne	.L586	# 217	[c=13 l=6]  *jcc
+.L585:
+	movq	1040(%rbx), %rax	# 220	[c=9 l=7]  *movdi_internal/3
+	movb	%r13b, (%rax,%r11)	# 221	[c=4 l=4]  *movqi_internal/8
+.L566:
+	addq	$56, %rsp	# 382	[c=4 l=4]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx	# 383	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 48
+	popq	%rbp	# 384	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 40
+	popq	%r12	# 385	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 32
+	popq	%r13	# 386	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 24
+	popq	%r14	# 387	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 16
+	popq	%r15	# 388	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 8
+	ret		# 389	[c=0 l=1]  simple_return_internal
+	.p2align 4,,10
+	.p2align 3
+.L603:
+	.cfi_restore_state
+	movl	%esi, %edx	# 323	[c=4 l=2]  *movsi_internal/0
+	subl	5176(%rbx), %edx	# 126	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %edx	# 127	[c=13 l=6]  *cmpsi_1/1
+	jb	.L577	# 128	[c=13 l=2]  *jcc
+	movl	%esi, %edx	# 325	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %edx	# 130	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %edx	# 306	[c=5 l=6]  *andsi_1_zext
+	cmpb	$0, 1080(%rbx,%rdx)	# 133	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L578	# 134	[c=13 l=6]  *jcc
+.L577:
+	movslq	%esi, %rsi	# 137	[c=4 l=3]  *extendsidi2_rex64/1
+	movzbl	(%rax,%rsi), %eax	# 138	[c=9 l=4]  *movqi_internal/4
+	jmp	.L579	# 415	[c=1 l=5]  jump
+	.p2align 4,,10
+	.p2align 3
+.L569:
+	movq	1072(%rbx), %rax	# 77	[c=9 l=7]  *movdi_internal/3
+	sarl	$12, %esi	# 74	[c=4 l=3]  *ashrsi3_1/0
+	movslq	%esi, %rsi	# 75	[c=4 l=3]  *extendsidi2_rex64/1
+	leaq	(%rax,%rsi,8), %r10	# 78	[c=8 l=4]  *leadi
+	movq	(%r10), %rax	# 79	[c=5 l=3]  *movdi_internal/3
+	testq	%rax, %rax	# 80	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L604	# 81	[c=13 l=6]  *jcc
+.L573:
+	movl	%r13d, %esi	# 321	[c=4 l=3]  *movsi_internal/0
+	andl	$4095, %esi	# 307	[c=5 l=6]  *andsi_1_zext
+	movb	%dl, (%rax,%rsi)	# 118	[c=4 l=3]  *movqi_internal/8
+	jmp	.L572	# 418	[c=1 l=5]  jump
+	.p2align 4,,10
+	.p2align 3
+.L571:
+	movq	%rbx, %rdi	# 68	[c=4 l=3]  *movdi_internal/3
+	movq	%rcx, 24(%rsp)	# 342	[c=4 l=5]  *movdi_internal/5
+	movl	%r8d, 20(%rsp)	# 340	[c=4 l=5]  *movsi_internal/1
+	movq	%r11, 8(%rsp)	# 338	[c=4 l=5]  *movdi_internal/5
+	movl	%r9d, 16(%rsp)	# 336	[c=4 l=5]  *movsi_internal/1
+	call	data_write_page	# 69	[c=0 l=5]  *call
+	movl	16(%rsp), %r9d	# 337	[c=9 l=5]  *movsi_internal/0
+	movq	8(%rsp), %r11	# 339	[c=9 l=5]  *movdi_internal/3
+	movl	20(%rsp), %r8d	# 341	[c=9 l=5]  *movsi_internal/0
+	movq	24(%rsp), %rcx	# 343	[c=9 l=5]  *movdi_internal/3
+	jmp	.L572	# 420	[c=1 l=5]  jump
+	.p2align 4,,10
+	.p2align 3
+.L586:
+	addq	$56, %rsp	# 393	[c=4 l=4]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	movl	%r13d, %edx	# 226	[c=4 l=3]  *movsi_internal/0
+	movl	%r14d, %esi	# 227	[c=4 l=3]  *movsi_internal/0
+	movq	%rbx, %rdi	# 228	[c=4 l=3]  *movdi_internal/3
+	popq	%rbx	# 394	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 48
+	popq	%rbp	# 395	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 40
+	popq	%r12	# 396	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 32
+	popq	%r13	# 397	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 24
+	popq	%r14	# 398	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 16
+	popq	%r15	# 399	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 8
+	jmp	data_write_page	# 229	[c=0 l=5]  *sibcall
+	.p2align 4,,10
+	.p2align 3
+.L578:
+	.cfi_restore_state
+	movq	%rbx, %rdi	# 144	[c=4 l=3]  *movdi_internal/3
+	movq	%rcx, 32(%rsp)	# 364	[c=4 l=5]  *movdi_internal/5
+	movl	%r8d, 24(%rsp)	# 362	[c=4 l=5]  *movsi_internal/1
+	movl	%r10d, 20(%rsp)	# 360	[c=4 l=5]  *movsi_internal/1
+	movq	%r11, 8(%rsp)	# 358	[c=4 l=5]  *movdi_internal/5
+	movl	%r9d, 16(%rsp)	# 356	[c=4 l=5]  *movsi_internal/1
+	call	data_read_page	# 145	[c=10 l=5]  *call_value
+	movl	16(%rsp), %r9d	# 357	[c=9 l=5]  *movsi_internal/0
+	movq	8(%rsp), %r11	# 359	[c=9 l=5]  *movdi_internal/3
+	movslq	20(%rsp), %r10	# 361	[c=13 l=5]  *extendsidi2_rex64/1
+	movl	24(%rsp), %r8d	# 363	[c=9 l=5]  *movsi_internal/0
+	movq	32(%rsp), %rcx	# 365	[c=9 l=5]  *movdi_internal/3
+	jmp	.L579	# 422	[c=1 l=5]  jump
+	.p2align 4,,10
+	.p2align 3
+.L604:
+	movl	$4128, %esi	# 83	[c=4 l=5]  *movdi_internal/2
+	movl	$1, %edi	# 84	[c=4 l=5]  *movdi_internal/2
+	movq	%rcx, 40(%rsp)	# 354	[c=4 l=5]  *movdi_internal/5
+	movl	%r8d, 32(%rsp)	# 352	[c=4 l=5]  *movsi_internal/1
+	movq	%r10, 24(%rsp)	# 350	[c=4 l=5]  *movdi_internal/5
+	movb	%dl, 20(%rsp)	# 348	[c=4 l=4]  *movqi_internal/8
+	movq	%r11, 8(%rsp)	# 346	[c=4 l=5]  *movdi_internal/5
+	movl	%r9d, 16(%rsp)	# 344	[c=4 l=5]  *movsi_internal/1
+	call	calloc@PLT	# 85	[c=10 l=5]  *call_value
+	movl	16(%rsp), %r9d	# 345	[c=9 l=5]  *movsi_internal/0
+	movq	8(%rsp), %r11	# 347	[c=9 l=5]  *movdi_internal/3
+	testq	%rax, %rax	# 88	[c=4 l=3]  *cmpdi_ccno_1/0
+	movzbl	20(%rsp), %edx	# 349	[c=9 l=5]  *movqi_internal/4
+	movq	24(%rsp), %r10	# 351	[c=9 l=5]  *movdi_internal/3
+	movl	32(%rsp), %r8d	# 353	[c=9 l=5]  *movsi_internal/0
+	movq	40(%rsp), %rcx	# 355	[c=9 l=5]  *movdi_internal/3
+	je	.L605	# 89	[c=13 l=2]  *jcc
+	movq	984(%rbx), %rsi	# 103	[c=9 l=7]  *movdi_internal/3
+	movq	%rsi, (%rax)	# 104	[c=4 l=3]  *movdi_internal/5
+	testq	%rsi, %rsi	# 105	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L575	# 106	[c=13 l=2]  *jcc
+	movq	%rax, 8(%rsi)	# 108	[c=4 l=4]  *movdi_internal/5
+.L575:
+	movq	%rax, 984(%rbx)	# 111	[c=4 l=7]  *movdi_internal/5
+	addq	$32, %rax	# 112	[c=4 l=4]  *adddi_1/0
+	movq	%rax, (%r10)	# 113	[c=4 l=3]  *movdi_internal/5
+	jmp	.L573	# 425	[c=1 l=5]  jump
+.L605:
+	leaq	.LC37(%rip), %r9	# 91	[c=1 l=7]  *movdi_internal/4
+	movl	$1, %r8d	# 92	[c=4 l=6]  *movsi_internal/0
+	movq	%rbx, %rdi	# 97	[c=4 l=3]  *movdi_internal/3
+	movl	$4096, %ecx	# 93	[c=4 l=5]  *movsi_internal/0
+	leaq	.LC4(%rip), %rdx	# 94	[c=1 l=7]  *movdi_internal/4
+	movl	$6, %esi	# 96	[c=4 l=5]  *movsi_internal/0
+	call	leave	# 99	[c=0 l=5]  *call
+	.cfi_endproc
+.LFE85:
+	.size	ramp_indirect, .-ramp_indirect
+	.section	.rodata.str1.1
+.LC38:
+	.string	"SREG"
+.LC39:
+	.string	"registers"
+.LC40:
+	.string	"RAM"
+.LC41:
+	.string	"costs"
+	.section	.rodata.str1.8
+	.align 8
+.LC42:
+	.string	"avrtest: -jit is not available on this host\n"
+	.section	.rodata.str1.1
+.LC43:
+	.string	"illegal opcode 0x%04x"
+.LC44:
+	.string	"opcode 0x%04x illegal on %s"
+	.section	.rodata.str1.8
+	.align 8
+.LC45:
+	.string	"opcode 0x%04x not yet supported"
+	.section	.rodata.str1.1
+.LC46:
+	.string	"in func_ILLEGAL"
+	.section	.rodata.str1.8
+	.align 8
+.LC47:
+	.string	"opcode 0x%04x has undefined result (%s overlaps R%d)"
+	.section	.rodata.str1.1
+.LC48:
+	.string	"bad IRQ vector %d"
+.LC49:
+	.string	"exit %d function called"
+.LC50:
+	.string	"abort function called"
+	.section	.rodata.str1.8
+	.align 8
+.LC51:
+	.string	"instruction count limit reached"
+	.align 8
+.LC52:
+	.string	"infinite loop detected (normal exit)"
+	.align 8
+.LC53:
+	.string	"deadlock: sleeping with no wake source"
+	.section	.rodata.str1.1
+.LC54:
+	.string	"-hle"
+	.section	.rodata.str1.8
+	.align 8
+.LC55:
+	.string	"\navrtest: -hle-verify: %s at %06x: %s differ from the emulation, not emulating %s\n"
+	.text
+	.p2align 4
+	.type	execute, @function
+execute:
+.LFB223:
+	.cfi_startproc
+	pushq	%r15	# 16889	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14	# 16890	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13	# 16891	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12	# 16892	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp	# 16893	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx	# 16894	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	movq	%rdi, %rbx	# 2	[c=4 l=3]  *movdi_internal/3
+	subq	$168, %rsp	# 16895	[c=4 l=7]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_def_cfa_offset 224
+	cmpb	$0, 112(%rdi)	# 86	[c=13 l=4]  *cmpqi_ccno_1/1
+	jne	.L608	# 87	[c=13 l=2]  *jcc
+	cmpl	$0, 568(%rdi)	# 89	[c=13 l=7]  *cmpsi_ccno_1/1
+	jne	.L1726	# 90	[c=13 l=6]  *jcc
+.L610:
+	movl	992(%rbx), %eax	# 13824	[c=9 l=6]  *movsi_internal/0
+	cmpl	$0, 536(%rbx)	# 112	[c=13 l=7]  *cmpsi_ccno_1/1
+	leal	1(%rax), %ebp	# 16415	[c=4 l=3]  *leasi
+	jne	.L1727	# 113	[c=13 l=6]  *jcc
+.L612:
+	xorl	%ecx, %ecx	# 18399	[c=4 l=2]  *movsi_xor
+	movb	$1, 112(%rbx)	# 128	[c=4 l=4]  *movqi_internal/8
+	movl	%ecx, 116(%rbx)	# 18400	[c=4 l=3]  *movsi_internal/1
+	movl	%ebp, 120(%rbx)	# 130	[c=4 l=3]  *movsi_internal/1
+.L608:
+	leaq	flag_update_table_add8(%rip), %r10	# 12272	[c=1 l=7]  *movdi_internal/4
+	leaq	101(%rbx), %r12	# 12275	[c=4 l=4]  *leadi
+	leaq	flag_update_table_sub8(%rip), %r11	# 12276	[c=1 l=7]  *movdi_internal/4
+.L613:
+	movl	120(%rbx), %edx	# 138	[c=9 l=3]  *movsi_internal/0
+	testl	%edx, %edx	# 139	[c=4 l=2]  *cmpsi_ccno_1/0
+	jne	.L1728	# 140	[c=13 l=6]  *jcc
+.L614:
+	movl	(%rbx), %r15d	# 314	[c=6 l=3]  *zero_extendsidi2/3
+	movl	$1, 96(%rbx)	# 319	[c=4 l=7]  *movsi_internal/1
+	movq	%r10, %rcx	# 17196	[c=4 l=3]  *movdi_internal/3
+	movq	32(%rbx), %rdi	# 312	[c=9 l=4]  *movdi_internal/3
+	movq	%r15, %rdx	# 16659	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 316	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 318	[c=13 l=7]  *adddi_1/1
+	movzbl	11(%r15), %ebp	# 320	[c=13 l=5]  zero_extendqidi2/0
+	addq	40(%rbx), %rbp	# 321	[c=13 l=4]  *adddi_1/1
+	movq	%rdi, (%rsp)	# 14945	[c=4 l=4]  *movdi_internal/5
+	movzwl	14(%r15), %eax	# 323	[c=13 l=5]  zero_extendhidi2/0
+	movq	(%r15), %r14	# 328	[c=5 l=3]  *movdi_internal/3
+	movq	%rbp, 40(%rbx)	# 322	[c=4 l=4]  *movdi_internal/5
+	addq	%rax, 48(%rbx)	# 324	[c=13 l=4]  *adddi_1/0
+	movzbl	9(%r15), %eax	# 325	[c=13 l=5]  *zero_extendqisi2/0
+	addl	%edx, %eax	# 326	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 17197	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 327	[c=4 l=2]  *movsi_internal/1
+	leaq	-1(%rdi), %rax	# 16410	[c=4 l=4]  *leadi
+	movq	%rax, 8(%rsp)	# 13829	[c=4 l=5]  *movdi_internal/5
+	movq	%r11, %rax	# 17198	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 17199	[c=4 l=3]  *indirect_jump
+.L1267:
+	movzbl	10(%r15), %esi	# 9233	[c=13 l=5]  zero_extendqidi2/0
+	movzwl	12(%r15), %edi	# 9231	[c=13 l=5]  *zero_extendhisi2/0
+	movzbl	1004(%rbx,%rsi), %eax	# 9234	[c=14 l=8]  *zero_extendqisi2/0
+	movl	%edi, %edx	# 16840	[c=4 l=2]  *movsi_internal/0
+	andl	$136, %edx	# 9244	[c=4 l=6]  *andsi_1/0
+	movl	%eax, %ecx	# 16839	[c=4 l=2]  *movsi_internal/0
+	subl	%edi, %eax	# 9237	[c=4 l=2]  *subsi_1/0
+	andl	$136, %ecx	# 9241	[c=4 l=6]  *andsi_1/0
+	movb	%al, 1004(%rbx,%rsi)	# 9239	[c=4 l=7]  *movqi_internal/8
+	andl	$511, %eax	# 9248	[c=4 l=5]  *andsi_1/0
+	leal	(%rdx,%rcx,2), %edx	# 9245	[c=8 l=3]  *leasi
+	imull	$260, %edx, %edx	# 9246	[c=12 l=6]  *mulsi3_1/1
+	andl	$7680, %edx	# 9247	[c=4 l=6]  *andsi_1/0
+.L1598:
+	movzbl	100(%rbx), %ecx	# 9250	[c=9 l=4]  *movqi_internal/4
+	orl	%eax, %edx	# 9249	[c=5 l=2]  *iorsi_1_zext
+	movl	%ecx, %eax	# 14632	[c=4 l=2]  *movsi_internal/0
+	andl	$192, %eax	# 9253	[c=4 l=5]  *andsi_2/0
+	jne	.L1268	# 9254	[c=13 l=6]  *jcc
+	leaq	flag_update_table_sub8(%rip), %rax	# 9257	[c=1 l=7]  *movdi_internal/4
+	movl	$63, %ecx	# 57	[c=4 l=5]  *movqi_internal/3
+	addq	%rdx, %rax	# 9258	[c=4 l=3]  *adddi_1/0
+.L1269:
+	movq	%rax, 104(%rbx)	# 9275	[c=4 l=4]  *movdi_internal/5
+	movb	%cl, 100(%rbx)	# 9276	[c=4 l=3]  *movqi_internal/8
+.L1565:
+	movl	(%rbx), %r15d	# 8340	[c=6 l=3]  *zero_extendsidi2/3
+	movq	%r15, %rax	# 16824	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 8342	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 8344	[c=13 l=7]  *adddi_1/1
+	addl	$1, %eax	# 8345	[c=4 l=3]  *addsi_1/0
+	movl	%eax, (%rbx)	# 8346	[c=4 l=2]  *movsi_internal/1
+.L682:
+	movq	1040(%rbx), %rdx	# 1132	[c=9 l=7]  *movdi_internal/3
+	movzbl	100(%rbx), %ecx	# 1131	[c=13 l=4]  *zero_extendqisi2/0
+	movl	$2, 96(%rbx)	# 1129	[c=4 l=7]  *movsi_internal/1
+	movsbl	10(%r15), %esi	# 1130	[c=13 l=5]  extendqisi2
+	movzbl	63(%rdx), %edx	# 1133	[c=13 l=4]  *zero_extendqisi2/0
+	movl	%ecx, %eax	# 16676	[c=4 l=2]  *movsi_internal/0
+	notl	%ecx	# 1135	[c=4 l=2]  *one_cmplsi2_1/0
+	andl	%ecx, %edx	# 1136	[c=4 l=2]  *andsi_1/0
+	movq	104(%rbx), %rcx	# 1137	[c=9 l=4]  *movdi_internal/3
+	andb	(%rcx), %al	# 1138	[c=9 l=2]  *andqi_1/1
+	movzbl	%al, %eax	# 1139	[c=4 l=3]  *zero_extendqisi2/0
+	orl	%edx, %eax	# 1140	[c=4 l=2]  *iorsi_1/0
+	movzwl	12(%r15), %edx	# 1141	[c=13 l=5]  *zero_extendhisi2/0
+	testl	%edx, %eax	# 1143	[c=4 l=2]  *testsi_1/0
+	jne	.L683	# 1144	[c=13 l=2]  *jcc
+	addl	(%rbx), %esi	# 1148	[c=9 l=2]  *addsi_1/1
+	addq	$1, 48(%rbx)	# 1153	[c=13 l=5]  *adddi_1/0
+	andl	992(%rbx), %esi	# 1151	[c=13 l=6]  *andsi_1/1
+	movl	%esi, (%rbx)	# 1152	[c=4 l=2]  *movsi_internal/1
+.L683:
+	cmpq	%rbp, 8(%rsp)	# 1157	[c=13 l=5]  *cmpdi_1/0
+	jb	.L680	# 1158	[c=13 l=6]  *jcc
+	movq	48(%rbx), %rdx	# 1160	[c=9 l=4]  *movdi_internal/3
+	cmpq	56(%rbx), %rdx	# 1161	[c=13 l=4]  *cmpdi_1/1
+	jnb	.L1729	# 1162	[c=13 l=6]  *jcc
+.L684:
+	movl	(%rbx), %r15d	# 1170	[c=6 l=3]  *zero_extendsidi2/3
+	movl	$1, 96(%rbx)	# 1175	[c=4 l=7]  *movsi_internal/1
+	movq	%r15, %rcx	# 16677	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 1172	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 1174	[c=13 l=7]  *adddi_1/1
+	movzbl	11(%r15), %eax	# 1176	[c=13 l=5]  zero_extendqidi2/0
+	movq	(%r15), %r14	# 1185	[c=5 l=3]  *movdi_internal/3
+	addq	%rax, %rbp	# 1177	[c=4 l=3]  *adddi_1/0
+	movzwl	14(%r15), %eax	# 1179	[c=13 l=5]  zero_extendhidi2/0
+	movq	%rbp, 40(%rbx)	# 1178	[c=4 l=4]  *movdi_internal/5
+	addq	%rdx, %rax	# 1180	[c=4 l=3]  *adddi_1/0
+	movq	%r12, %rdx	# 18039	[c=4 l=3]  *movdi_internal/3
+	movq	%rax, 48(%rbx)	# 1181	[c=4 l=4]  *movdi_internal/5
+	movzbl	9(%r15), %eax	# 1182	[c=13 l=5]  *zero_extendqisi2/0
+	addl	%ecx, %eax	# 1183	[c=4 l=2]  *addsi_1/0
+	movq	%r10, %rcx	# 18038	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 1184	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 18040	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 18041	[c=4 l=3]  *indirect_jump
+.L1273:
+	movzbl	10(%r15), %eax	# 9465	[c=13 l=5]  zero_extendqidi2/0
+	movzwl	12(%r15), %edi	# 9473	[c=13 l=5]  *zero_extendhisi2/0
+	leal	1(%rax), %esi	# 16145	[c=4 l=3]  *leasi
+	movzbl	1004(%rbx,%rax), %ecx	# 9471	[c=14 l=8]  *zero_extendqisi2/0
+	movslq	%esi, %rsi	# 9467	[c=4 l=3]  *extendsidi2_rex64/1
+	movzbl	1004(%rbx,%rsi), %edx	# 9468	[c=14 l=8]  *zero_extendqisi2/0
+	sall	$8, %edx	# 9469	[c=4 l=3]  *ashlsi3_1/0
+	orl	%ecx, %edx	# 9472	[c=4 l=2]  *iorsi_1/0
+	movl	%edx, %ecx	# 14666	[c=4 l=2]  *movsi_internal/0
+	shrl	$5, %edx	# 9482	[c=4 l=3]  *lshrsi3_1/0
+	subl	%edi, %ecx	# 9474	[c=4 l=2]  *subsi_1/0
+	andl	$1024, %edx	# 9483	[c=4 l=6]  *andsi_1/0
+	movl	%ecx, %edi	# 14668	[c=4 l=2]  *movsi_internal/0
+	movb	%cl, 1004(%rbx,%rax)	# 9476	[c=4 l=7]  *movqi_internal/8
+	leaq	flag_update_table_sub8(%rip), %rax	# 9480	[c=1 l=7]  *movdi_internal/4
+	sarl	$8, %edi	# 9477	[c=4 l=3]  *ashrsi3_1/0
+	movb	%dil, 1004(%rbx,%rsi)	# 9479	[c=4 l=8]  *movqi_internal/8
+	andl	$511, %edi	# 9484	[c=4 l=6]  *andsi_1/0
+	orl	%edi, %edx	# 9485	[c=4 l=2]  *iorsi_1/0
+	movslq	%edx, %rdx	# 9486	[c=4 l=3]  *extendsidi2_rex64/1
+	movzbl	(%rax,%rdx), %edx	# 9487	[c=13 l=4]  *zero_extendqisi2/0
+	xorl	%eax, %eax	# 18190	[c=4 l=2]  *movsi_xor
+	testw	%cx, %cx	# 18191	[c=4 l=3]  *cmphi_ccno_1/0
+	movq	104(%rbx), %rcx	# 9498	[c=9 l=4]  *movdi_internal/3
+	setne	%al	# 18192	[c=4 l=3]  *setcc_qi_slp
+	addl	%eax, %eax	# 9492	[c=4 l=2]  *ashlsi3_1/0
+	movzbl	(%rcx), %edi	# 18193	[c=5 l=3]  *movqi_internal/4
+	notl	%eax	# 9493	[c=4 l=2]  *one_cmplsi2_1/0
+	andl	%eax, %edx	# 9494	[c=4 l=2]  *andsi_1/0
+	movzbl	100(%rbx), %eax	# 9495	[c=13 l=4]  *zero_extendqisi2/0
+	andl	$-33, %edx	# 9500	[c=4 l=3]  *andsi_1/0
+	andl	$-32, %eax	# 9496	[c=4 l=3]  *andsi_1/0
+	andl	%eax, %edi	# 19131	[c=4 l=2]  *andsi_1/0
+	orl	$31, %eax	# 16149	[c=4 l=3]  *iorsi_1/0
+	movl	%edi, %ecx	# 14671	[c=4 l=2]  *movqi_internal/1
+	movb	%al, 100(%rbx)	# 9504	[c=4 l=3]  *movqi_internal/8
+	orl	%ecx, %edx	# 16148	[c=4 l=2]  *iorsi_1/0
+	movb	%dl, 101(%rbx)	# 9502	[c=4 l=3]  *movqi_internal/8
+.L1568:
+	leaq	101(%rbx), %rdx	# 16230	[c=4 l=4]  *leadi
+	movq	%rdx, 104(%rbx)	# 8396	[c=4 l=4]  *movdi_internal/5
+.L1567:
+	movl	(%rbx), %r15d	# 8397	[c=6 l=3]  *zero_extendsidi2/3
+	movq	%r15, %rax	# 16826	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 8399	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 8401	[c=13 l=7]  *adddi_1/1
+	addl	$1, %eax	# 8402	[c=4 l=3]  *addsi_1/0
+	movl	%eax, (%rbx)	# 8403	[c=4 l=2]  *movsi_internal/1
+.L685:
+	movq	1040(%rbx), %rdx	# 1193	[c=9 l=7]  *movdi_internal/3
+	movzbl	100(%rbx), %esi	# 1192	[c=13 l=4]  *zero_extendqisi2/0
+	movl	$2, 96(%rbx)	# 1190	[c=4 l=7]  *movsi_internal/1
+	movsbl	10(%r15), %ecx	# 1191	[c=13 l=5]  extendqisi2
+	movzbl	63(%rdx), %edx	# 1194	[c=13 l=4]  *zero_extendqisi2/0
+	movl	%esi, %eax	# 16678	[c=4 l=2]  *movsi_internal/0
+	notl	%esi	# 1196	[c=4 l=2]  *one_cmplsi2_1/0
+	andl	%esi, %edx	# 1197	[c=4 l=2]  *andsi_1/0
+	movq	104(%rbx), %rsi	# 1198	[c=9 l=4]  *movdi_internal/3
+	andb	(%rsi), %al	# 1199	[c=9 l=2]  *andqi_1/1
+	movzbl	%al, %eax	# 1200	[c=4 l=3]  *zero_extendqisi2/0
+	orl	%edx, %eax	# 1201	[c=4 l=2]  *iorsi_1/0
+	movzwl	12(%r15), %edx	# 1202	[c=13 l=5]  *zero_extendhisi2/0
+	testl	%edx, %eax	# 1204	[c=4 l=2]  *testsi_1/0
+	je	.L686	# 1205	[c=13 l=2]  *jcc
+	addl	(%rbx), %ecx	# 1209	[c=9 l=2]  *addsi_1/1
+	addq	$1, 48(%rbx)	# 1214	[c=13 l=5]  *adddi_1/0
+	andl	992(%rbx), %ecx	# 1212	[c=13 l=6]  *andsi_1/1
+	movl	%ecx, (%rbx)	# 1213	[c=4 l=2]  *movsi_internal/1
+.L686:
+	cmpq	%rbp, 8(%rsp)	# 1218	[c=13 l=5]  *cmpdi_1/0
+	jb	.L680	# 1219	[c=13 l=6]  *jcc
+	movq	48(%rbx), %rdx	# 1221	[c=9 l=4]  *movdi_internal/3
+	cmpq	56(%rbx), %rdx	# 1222	[c=13 l=4]  *cmpdi_1/1
+	jnb	.L1730	# 1223	[c=13 l=6]  *jcc
+.L687:
+	movl	(%rbx), %r15d	# 1231	[c=6 l=3]  *zero_extendsidi2/3
+	movl	$1, 96(%rbx)	# 1236	[c=4 l=7]  *movsi_internal/1
+	movq	%r15, %rcx	# 16679	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 1233	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 1235	[c=13 l=7]  *adddi_1/1
+	movzbl	11(%r15), %eax	# 1237	[c=13 l=5]  zero_extendqidi2/0
+	movq	(%r15), %r14	# 1246	[c=5 l=3]  *movdi_internal/3
+	addq	%rax, %rbp	# 1238	[c=4 l=3]  *adddi_1/0
+	movzwl	14(%r15), %eax	# 1240	[c=13 l=5]  zero_extendhidi2/0
+	movq	%rbp, 40(%rbx)	# 1239	[c=4 l=4]  *movdi_internal/5
+	addq	%rdx, %rax	# 1241	[c=4 l=3]  *adddi_1/0
+	movq	%r12, %rdx	# 18031	[c=4 l=3]  *movdi_internal/3
+	movq	%rax, 48(%rbx)	# 1242	[c=4 l=4]  *movdi_internal/5
+	movzbl	9(%r15), %eax	# 1243	[c=13 l=5]  *zero_extendqisi2/0
+	addl	%ecx, %eax	# 1244	[c=4 l=2]  *addsi_1/0
+	movq	%r10, %rcx	# 18030	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 1245	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 18032	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 18033	[c=4 l=3]  *indirect_jump
+.L1228:
+	movzbl	10(%r15), %eax	# 8124	[c=13 l=5]  zero_extendqidi2/0
+	movq	104(%rbx), %rcx	# 8131	[c=9 l=4]  *movdi_internal/3
+	movzbl	100(%rbx), %esi	# 8129	[c=13 l=4]  *zero_extendqisi2/0
+	movzbl	1004(%rbx,%rax), %edx	# 8125	[c=14 l=8]  *zero_extendqisi2/0
+	movzbl	(%rcx), %edi	# 8132	[c=5 l=3]  *movqi_internal/4
+	movzwl	12(%r15), %eax	# 8127	[c=13 l=5]  zero_extendhidi2/0
+	movq	1040(%rbx), %rcx	# 8133	[c=9 l=7]  *movdi_internal/3
+	movl	%esi, %r8d	# 14437	[c=4 l=3]  *movsi_internal/0
+	notl	%r8d	# 8135	[c=4 l=3]  *one_cmplsi2_1/0
+	movzbl	1004(%rbx,%rax), %r9d	# 8128	[c=14 l=9]  *zero_extendqisi2/0
+	movzbl	63(%rcx), %ecx	# 8134	[c=13 l=4]  *zero_extendqisi2/0
+	movl	%esi, %eax	# 16819	[c=4 l=2]  *movsi_internal/0
+	andl	$-64, %esi	# 8146	[c=4 l=3]  *andsi_1/0
+	andl	%edi, %eax	# 16240	[c=4 l=2]  *andsi_1/0
+	andl	%esi, %edi	# 16241	[c=4 l=2]  *andsi_1/0
+	orl	$63, %esi	# 16243	[c=4 l=3]  *iorsi_1/0
+	andl	%r8d, %ecx	# 8136	[c=4 l=3]  *andsi_1/0
+	movzbl	%al, %eax	# 8138	[c=4 l=3]  *zero_extendqisi2/0
+	movl	%edx, %r8d	# 14439	[c=4 l=3]  *movsi_internal/0
+	subl	%r9d, %edx	# 8151	[c=4 l=3]  *subsi_1/0
+	orl	%eax, %ecx	# 8139	[c=4 l=2]  *iorsi_1/0
+	movl	%r9d, %eax	# 14441	[c=4 l=3]  *movsi_internal/0
+	andl	$136, %r8d	# 8141	[c=4 l=7]  *andsi_1/0
+	movb	%sil, 100(%rbx)	# 8166	[c=4 l=4]  *movqi_internal/8
+	andl	$136, %eax	# 8144	[c=4 l=5]  *andsi_1/0
+	movl	%ecx, %r9d	# 14443	[c=4 l=3]  *movsi_internal/0
+	orl	$-3, %ecx	# 8160	[c=4 l=3]  *iorsi_1/0
+	leal	(%rax,%r8,2), %r8d	# 8145	[c=8 l=4]  *leasi
+	andl	$1, %r9d	# 8152	[c=4 l=4]  *andsi_1/0
+	leaq	flag_update_table_sub8(%rip), %rax	# 8148	[c=1 l=7]  *movdi_internal/4
+	imull	$260, %r8d, %r8d	# 8155	[c=12 l=7]  *mulsi3_1/1
+	subl	%r9d, %edx	# 8153	[c=4 l=3]  *subsi_1/0
+	andl	$511, %edx	# 8154	[c=4 l=6]  *andsi_1/0
+	andl	$7680, %r8d	# 8156	[c=4 l=7]  *andsi_1/0
+	orl	%r8d, %edx	# 8157	[c=5 l=3]  *iorsi_1_zext
+	andb	(%rax,%rdx), %cl	# 8161	[c=13 l=3]  *andqi_1/1
+	leaq	101(%rbx), %rdx	# 16244	[c=4 l=4]  *leadi
+	orl	%ecx, %edi	# 16242	[c=4 l=2]  *iorsi_1/0
+	movq	%rdx, 104(%rbx)	# 8168	[c=4 l=4]  *movdi_internal/5
+	movb	%dil, 101(%rbx)	# 8164	[c=4 l=4]  *movqi_internal/8
+.L1569:
+	movl	(%rbx), %r15d	# 8169	[c=6 l=3]  *zero_extendsidi2/3
+	movq	%r15, %rcx	# 16820	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 8171	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 8173	[c=13 l=7]  *adddi_1/1
+	addl	$1, %ecx	# 8174	[c=4 l=3]  *addsi_1/0
+	movl	%ecx, (%rbx)	# 8175	[c=4 l=2]  *movsi_internal/1
+.L726:
+	movzwl	12(%r15), %esi	# 1735	[c=13 l=5]  zero_extendhidi2/0
+	movzbl	100(%rbx), %edi	# 1737	[c=13 l=4]  *zero_extendqisi2/0
+	movzbl	10(%r15), %ecx	# 1732	[c=13 l=5]  zero_extendqidi2/0
+	movl	(%rbx), %r15d	# 1777	[c=6 l=3]  *zero_extendsidi2/3
+	movzbl	1004(%rbx,%rsi), %r13d	# 1736	[c=14 l=9]  *zero_extendqisi2/0
+	movq	104(%rbx), %rsi	# 1739	[c=9 l=4]  *movdi_internal/3
+	movl	%edi, %r8d	# 16688	[c=4 l=3]  *movsi_internal/0
+	movzbl	1004(%rbx,%rcx), %ecx	# 1733	[c=14 l=8]  *zero_extendqisi2/0
+	movzbl	(%rsi), %r9d	# 1740	[c=5 l=4]  *movqi_internal/4
+	movq	1040(%rbx), %rsi	# 1741	[c=9 l=7]  *movdi_internal/3
+	movzbl	63(%rsi), %r14d	# 1742	[c=13 l=5]  *zero_extendqisi2/0
+	movl	%edi, %esi	# 13927	[c=4 l=2]  *movsi_internal/0
+	andl	%r9d, %r8d	# 16362	[c=4 l=3]  *andsi_1/0
+	andl	$-64, %edi	# 1754	[c=4 l=3]  *andsi_1/0
+	notl	%esi	# 1743	[c=4 l=2]  *one_cmplsi2_1/0
+	movzbl	%r8b, %r8d	# 1746	[c=4 l=4]  *zero_extendqisi2/0
+	andl	%edi, %r9d	# 16363	[c=4 l=3]  *andsi_1/0
+	movq	%rdx, 104(%rbx)	# 1776	[c=4 l=4]  *movdi_internal/5
+	andl	%r14d, %esi	# 1744	[c=4 l=3]  *andsi_1/0
+	movl	%ecx, %r14d	# 13929	[c=4 l=3]  *movsi_internal/0
+	subl	%r13d, %ecx	# 1759	[c=4 l=3]  *subsi_1/0
+	movq	%r15, %rdx	# 16689	[c=4 l=3]  *movdi_internal/3
+	orl	%r8d, %esi	# 1747	[c=4 l=3]  *iorsi_1/0
+	movl	%r13d, %r8d	# 13931	[c=4 l=3]  *movsi_internal/0
+	orl	$63, %edi	# 16365	[c=4 l=3]  *iorsi_1/0
+	salq	$4, %r15	# 1779	[c=4 l=4]  *ashldi3_1/0
+	andl	$136, %r14d	# 1749	[c=4 l=7]  *andsi_1/0
+	movl	%esi, %r13d	# 13933	[c=4 l=3]  *movsi_internal/0
+	orl	$-3, %esi	# 1768	[c=4 l=3]  *iorsi_1/0
+	andl	$136, %r8d	# 1752	[c=4 l=7]  *andsi_1/0
+	leal	(%r8,%r14,2), %r8d	# 1753	[c=8 l=4]  *leasi
+	andl	$1, %r13d	# 1760	[c=4 l=4]  *andsi_1/0
+	addq	1064(%rbx), %r15	# 1781	[c=13 l=7]  *adddi_1/1
+	movb	%dil, 100(%rbx)	# 1774	[c=4 l=4]  *movqi_internal/8
+	imull	$260, %r8d, %r8d	# 1763	[c=12 l=7]  *mulsi3_1/1
+	subl	%r13d, %ecx	# 1761	[c=4 l=3]  *subsi_1/0
+	andl	$511, %ecx	# 1762	[c=4 l=6]  *andsi_1/0
+	andl	$7680, %r8d	# 1764	[c=4 l=7]  *andsi_1/0
+	orl	%r8d, %ecx	# 1765	[c=5 l=3]  *iorsi_1_zext
+	andb	(%rax,%rcx), %sil	# 1769	[c=13 l=4]  *andqi_1/1
+	movq	%r10, %rcx	# 17974	[c=4 l=3]  *movdi_internal/3
+	orl	%esi, %r9d	# 16364	[c=4 l=3]  *iorsi_1/0
+	movb	%r9b, 101(%rbx)	# 1772	[c=4 l=4]  *movqi_internal/8
+	movzbl	9(%r15), %eax	# 1782	[c=13 l=5]  *zero_extendqisi2/0
+	movq	(%r15), %r14	# 1785	[c=5 l=3]  *movdi_internal/3
+	addl	%edx, %eax	# 1783	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 17975	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 1784	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 17976	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 17977	[c=4 l=3]  *indirect_jump
+.L1318:
+	cmpb	$0, 844(%rbx)	# 10301	[c=13 l=7]  *cmpqi_ccno_1/1
+	movzbl	10(%r15), %r13d	# 10300	[c=13 l=5]  *zero_extendqisi2/0
+	jne	.L1731	# 10302	[c=13 l=6]  *jcc
+	movzwl	1034(%rbx), %r14d	# 10315	[c=13 l=8]  zero_extendhidi2/0
+	movl	%r14d, %edx	# 14774	[c=4 l=3]  *movsi_internal/0
+	movq	%r14, %rax	# 16869	[c=4 l=3]  *movdi_internal/3
+	subl	5176(%rbx), %edx	# 10318	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %edx	# 10319	[c=13 l=6]  *cmpsi_1/1
+	jb	.L1321	# 10320	[c=13 l=2]  *jcc
+	movl	%r14d, %edx	# 14776	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %edx	# 10322	[c=4 l=3]  *ashrsi3_1/0
+	movslq	%edx, %rdx	# 10323	[c=4 l=3]  *extendsidi2_rex64/1
+	cmpb	$0, 1080(%rbx,%rdx)	# 10324	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L1322	# 10325	[c=13 l=6]  *jcc
+.L1321:
+	movq	1040(%rbx), %rdx	# 10329	[c=9 l=7]  *movdi_internal/3
+	movzbl	(%rdx,%rax), %edx	# 10330	[c=13 l=4]  *zero_extendqisi2/0
+.L1323:
+	movslq	%r13d, %rax	# 10341	[c=4 l=3]  *extendsidi2_rex64/1
+	movb	%dl, 1004(%rbx,%rax)	# 10342	[c=4 l=7]  *movqi_internal/8
+	leal	1(%r14), %eax	# 16111	[c=4 l=4]  *leasi
+	subq	$1, 48(%rbx)	# 10343	[c=13 l=5]  *adddi_1/0
+.L1572:
+	movw	%ax, 1034(%rbx)	# 10345	[c=4 l=7]  *movhi_internal/3
+.L1343:
+	movl	(%rbx), %r15d	# 10559	[c=6 l=3]  *zero_extendsidi2/3
+	movq	%r15, %rax	# 16876	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 10561	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 10563	[c=13 l=7]  *adddi_1/1
+	addl	$1, %eax	# 10564	[c=4 l=3]  *addsi_1/0
+	movl	%eax, (%rbx)	# 10565	[c=4 l=2]  *movsi_internal/1
+.L1132:
+	cmpb	$0, 844(%rbx)	# 6871	[c=13 l=7]  *cmpqi_ccno_1/1
+	movzbl	10(%r15), %esi	# 6870	[c=13 l=5]  zero_extendqidi2/0
+	jne	.L1732	# 6872	[c=13 l=6]  *jcc
+	movzwl	1030(%rbx), %r13d	# 6885	[c=13 l=8]  zero_extendhidi2/0
+	movzbl	1004(%rbx,%rsi), %ecx	# 6888	[c=10 l=8]  *movqi_internal/4
+	movl	%r13d, %edx	# 14295	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rax	# 16787	[c=4 l=3]  *movdi_internal/3
+	subl	5176(%rbx), %edx	# 6890	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %edx	# 6891	[c=13 l=6]  *cmpsi_1/1
+	jb	.L1135	# 6892	[c=13 l=2]  *jcc
+	movl	%r13d, %edx	# 14297	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %edx	# 6894	[c=4 l=3]  *ashrsi3_1/0
+	movslq	%edx, %rdx	# 6895	[c=4 l=3]  *extendsidi2_rex64/1
+	cmpb	$0, 1080(%rbx,%rdx)	# 6896	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L1136	# 6897	[c=13 l=6]  *jcc
+.L1135:
+	movq	1040(%rbx), %rdx	# 6901	[c=9 l=7]  *movdi_internal/3
+	movb	%cl, (%rdx,%rax)	# 6902	[c=4 l=3]  *movqi_internal/8
+.L1137:
+	addl	$1, %r13d	# 6915	[c=4 l=4]  *addsi_1/0
+	subq	$1, 48(%rbx)	# 6914	[c=13 l=5]  *adddi_1/0
+	movw	%r13w, 1030(%rbx)	# 6916	[c=4 l=8]  *movhi_internal/3
+.L1134:
+	movl	(%rbx), %r15d	# 6919	[c=6 l=3]  *zero_extendsidi2/3
+	movq	%r10, %rcx	# 17398	[c=4 l=3]  *movdi_internal/3
+	movq	%r15, %rdx	# 16788	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 6921	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 6923	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%r15), %eax	# 6924	[c=13 l=5]  *zero_extendqisi2/0
+	movq	(%r15), %r14	# 6927	[c=5 l=3]  *movdi_internal/3
+	addl	%edx, %eax	# 6925	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 17399	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 6926	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 17400	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 17401	[c=4 l=3]  *indirect_jump
+.L1324:
+	cmpb	$0, 844(%rbx)	# 10360	[c=13 l=7]  *cmpqi_ccno_1/1
+	movzbl	10(%r15), %r13d	# 10359	[c=13 l=5]  *zero_extendqisi2/0
+	jne	.L1733	# 10361	[c=13 l=6]  *jcc
+	movzwl	1032(%rbx), %r14d	# 10374	[c=13 l=8]  zero_extendhidi2/0
+	movl	%r14d, %edx	# 14778	[c=4 l=3]  *movsi_internal/0
+	movq	%r14, %rax	# 16871	[c=4 l=3]  *movdi_internal/3
+	subl	5176(%rbx), %edx	# 10377	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %edx	# 10378	[c=13 l=6]  *cmpsi_1/1
+	jb	.L1327	# 10379	[c=13 l=2]  *jcc
+	movl	%r14d, %edx	# 14780	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %edx	# 10381	[c=4 l=3]  *ashrsi3_1/0
+	movslq	%edx, %rdx	# 10382	[c=4 l=3]  *extendsidi2_rex64/1
+	cmpb	$0, 1080(%rbx,%rdx)	# 10383	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L1328	# 10384	[c=13 l=6]  *jcc
+.L1327:
+	movq	1040(%rbx), %rdx	# 10388	[c=9 l=7]  *movdi_internal/3
+	movzbl	(%rdx,%rax), %edx	# 10389	[c=13 l=4]  *zero_extendqisi2/0
+.L1329:
+	movslq	%r13d, %rax	# 10400	[c=4 l=3]  *extendsidi2_rex64/1
+	movb	%dl, 1004(%rbx,%rax)	# 10401	[c=4 l=7]  *movqi_internal/8
+	leal	1(%r14), %eax	# 16110	[c=4 l=4]  *leasi
+	subq	$1, 48(%rbx)	# 10402	[c=13 l=5]  *adddi_1/0
+	movw	%ax, 1032(%rbx)	# 10404	[c=4 l=7]  *movhi_internal/3
+.L1326:
+	movl	(%rbx), %r15d	# 10407	[c=6 l=3]  *zero_extendsidi2/3
+	movq	%r15, %rax	# 16872	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 10409	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 10411	[c=13 l=7]  *adddi_1/1
+	addl	$1, %eax	# 10412	[c=4 l=3]  *addsi_1/0
+	movl	%eax, (%rbx)	# 10413	[c=4 l=2]  *movsi_internal/1
+.L1156:
+	cmpb	$0, 844(%rbx)	# 7115	[c=13 l=7]  *cmpqi_ccno_1/1
+	movzbl	10(%r15), %esi	# 7114	[c=13 l=5]  zero_extendqidi2/0
+	jne	.L1734	# 7116	[c=13 l=6]  *jcc
+	movzwl	1034(%rbx), %r13d	# 7129	[c=13 l=8]  zero_extendhidi2/0
+	movzbl	1004(%rbx,%rsi), %ecx	# 7132	[c=10 l=8]  *movqi_internal/4
+	movl	%r13d, %eax	# 14311	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdx	# 16793	[c=4 l=3]  *movdi_internal/3
+	subl	5176(%rbx), %eax	# 7134	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %eax	# 7135	[c=13 l=6]  *cmpsi_1/1
+	jb	.L1159	# 7136	[c=13 l=2]  *jcc
+	movl	%r13d, %eax	# 14313	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %eax	# 7138	[c=4 l=3]  *ashrsi3_1/0
+	cltq	# 7139	[c=4 l=2]  *extendsidi2_rex64/0
+	cmpb	$0, 1080(%rbx,%rax)	# 7140	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L1160	# 7141	[c=13 l=6]  *jcc
+.L1159:
+	movq	1040(%rbx), %rax	# 7145	[c=9 l=7]  *movdi_internal/3
+	movb	%cl, (%rax,%rdx)	# 7146	[c=4 l=3]  *movqi_internal/8
+.L1161:
+	leal	1(%r13), %eax	# 16269	[c=4 l=4]  *leasi
+	subq	$1, 48(%rbx)	# 7158	[c=13 l=5]  *adddi_1/0
+	movw	%ax, 1034(%rbx)	# 7160	[c=4 l=7]  *movhi_internal/3
+.L1158:
+	movl	(%rbx), %r15d	# 7163	[c=6 l=3]  *zero_extendsidi2/3
+	movq	%r10, %rcx	# 17366	[c=4 l=3]  *movdi_internal/3
+	movq	%r15, %rdx	# 16794	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 7165	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 7167	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%r15), %eax	# 7168	[c=13 l=5]  *zero_extendqisi2/0
+	movq	(%r15), %r14	# 7171	[c=5 l=3]  *movdi_internal/3
+	addl	%edx, %eax	# 7169	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 17367	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 7170	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 17368	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 17369	[c=4 l=3]  *indirect_jump
+.L1288:
+	movzbl	10(%r15), %edx	# 9854	[c=13 l=5]  zero_extendqidi2/0
+	movzwl	12(%r15), %ecx	# 9857	[c=13 l=5]  zero_extendhidi2/0
+	movzbl	1004(%rbx,%rdx), %eax	# 9855	[c=14 l=8]  *zero_extendqisi2/0
+	movzbl	1004(%rbx,%rcx), %ecx	# 9858	[c=14 l=8]  *zero_extendqisi2/0
+	leal	(%rax,%rcx), %esi	# 16122	[c=4 l=3]  *leasi
+	movb	%sil, 1004(%rbx,%rdx)	# 9861	[c=4 l=8]  *movqi_internal/8
+	movl	%eax, %esi	# 14728	[c=4 l=2]  *movsi_internal/0
+	movl	%ecx, %edx	# 14730	[c=4 l=2]  *movsi_internal/0
+	addl	%ecx, %eax	# 9872	[c=4 l=2]  *addsi_1/0
+	andl	$136, %esi	# 9863	[c=4 l=6]  *andsi_1/0
+	andl	$136, %edx	# 9866	[c=4 l=6]  *andsi_1/0
+	leal	(%rdx,%rsi,2), %edx	# 9867	[c=8 l=3]  *leasi
+	imull	$260, %edx, %edx	# 9868	[c=12 l=6]  *mulsi3_1/1
+	andl	$7680, %edx	# 9869	[c=4 l=6]  *andsi_1/0
+	orl	%eax, %edx	# 9873	[c=5 l=2]  *iorsi_1_zext
+	movzbl	100(%rbx), %eax	# 9874	[c=9 l=4]  *movqi_internal/4
+	movl	%eax, %ecx	# 14732	[c=4 l=2]  *movsi_internal/0
+	andl	$192, %ecx	# 9877	[c=4 l=6]  *andsi_2/0
+	jne	.L1289	# 9878	[c=13 l=6]  *jcc
+	leaq	flag_update_table_add8(%rip), %rcx	# 9881	[c=1 l=7]  *movdi_internal/4
+	movl	$63, %eax	# 63	[c=4 l=5]  *movqi_internal/3
+	addq	%rcx, %rdx	# 9882	[c=4 l=3]  *adddi_1/0
+.L1290:
+	movl	(%rbx), %esi	# 9902	[c=6 l=2]  *zero_extendsidi2/3
+	movq	1064(%rbx), %r9	# 9901	[c=9 l=7]  *movdi_internal/3
+	movb	%al, 100(%rbx)	# 9900	[c=4 l=3]  *movqi_internal/8
+	movq	%rdx, 104(%rbx)	# 9899	[c=4 l=4]  *movdi_internal/5
+	movq	1040(%rbx), %r13	# 9909	[c=9 l=7]  *movdi_internal/3
+	movq	%rsi, %rdi	# 16859	[c=4 l=3]  *movdi_internal/3
+	movl	%esi, 24(%rsp)	# 15700	[c=4 l=4]  *movsi_internal/1
+	salq	$4, %rsi	# 9904	[c=4 l=4]  *ashldi3_1/0
+	addq	%r9, %rsi	# 9905	[c=4 l=3]  *adddi_1/0
+	addl	$1, %edi	# 9906	[c=4 l=3]  *addsi_1/0
+	movq	%r13, 40(%rsp)	# 15697	[c=4 l=5]  *movdi_internal/5
+	movl	%edi, (%rbx)	# 9907	[c=4 l=2]  *movsi_internal/1
+	movzbl	10(%rsi), %r14d	# 9911	[c=13 l=5]  zero_extendqidi2/0
+	movzwl	12(%rsi), %esi	# 9914	[c=13 l=4]  zero_extendhidi2/0
+	movzbl	63(%r13), %r13d	# 9916	[c=13 l=5]  *zero_extendqisi2/0
+	movl	%edi, 32(%rsp)	# 15698	[c=4 l=4]  *movsi_internal/1
+	movzbl	%al, %edi	# 9910	[c=4 l=3]  *zero_extendqisi2/0
+	movq	%r9, 16(%rsp)	# 16044	[c=4 l=5]  *movdi_internal/5
+	movzbl	1004(%rbx,%r14), %r9d	# 9912	[c=10 l=9]  *movqi_internal/4
+	movzbl	1004(%rbx,%rsi), %r15d	# 9915	[c=14 l=9]  *zero_extendqisi2/0
+	movl	%edi, %esi	# 14745	[c=4 l=2]  *movsi_internal/0
+	notl	%esi	# 9917	[c=4 l=2]  *one_cmplsi2_1/0
+	andl	%r13d, %esi	# 9918	[c=4 l=3]  *andsi_1/0
+	movzbl	(%rdx), %r13d	# 18179	[c=5 l=4]  *movqi_internal/4
+	movl	%r15d, %r8d	# 16860	[c=4 l=3]  *movsi_internal/0
+	andl	$136, %r8d	# 9933	[c=4 l=7]  *andsi_1/0
+	andl	%eax, %r13d	# 19130	[c=4 l=3]  *andsi_1/0
+	orl	%r13d, %esi	# 9921	[c=4 l=3]  *iorsi_1/0
+	movzbl	%r9b, %r13d	# 9923	[c=4 l=4]  *zero_extendqisi2/0
+	andl	$136, %r9d	# 9930	[c=4 l=7]  *andsi_1/0
+	leal	(%r8,%r9,2), %r8d	# 9934	[c=8 l=4]  *leasi
+	andl	$1, %esi	# 9922	[c=4 l=3]  *andsi_1/0
+	addl	%r15d, %r13d	# 9925	[c=4 l=3]  *addsi_1/0
+	imull	$260, %r8d, %r8d	# 9935	[c=12 l=7]  *mulsi3_1/1
+	addl	%r13d, %esi	# 9926	[c=4 l=3]  *addsi_1/0
+	movb	%sil, 1004(%rbx,%r14)	# 9928	[c=4 l=8]  *movqi_internal/8
+	andl	$7680, %r8d	# 9936	[c=4 l=7]  *andsi_1/0
+	orl	%esi, %r8d	# 9937	[c=5 l=3]  *iorsi_1_zext
+	andl	$-64, %edi	# 9939	[c=4 l=3]  *andsi_2/0
+	jne	.L1291	# 9940	[c=13 l=6]  *jcc
+	leaq	(%rcx,%r8), %rdx	# 16119	[c=4 l=4]  *leadi
+	movl	$63, %eax	# 64	[c=4 l=5]  *movqi_internal/3
+.L1292:
+	movl	32(%rsp), %r8d	# 9962	[c=10 l=5]  *zero_extendsidi2/3
+	movq	16(%rsp), %rdi	# 15987	[c=9 l=5]  *movdi_internal/3
+	movb	%al, 100(%rbx)	# 9961	[c=4 l=3]  *movqi_internal/8
+	movzbl	%al, %esi	# 9968	[c=4 l=3]  *zero_extendqisi2/0
+	movq	40(%rsp), %r15	# 14753	[c=9 l=5]  *movdi_internal/3
+	movq	%rdx, 104(%rbx)	# 9960	[c=4 l=4]  *movdi_internal/5
+	salq	$4, %r8	# 9963	[c=4 l=4]  *ashldi3_1/0
+	movl	%esi, 32(%rsp)	# 15702	[c=4 l=4]  *movsi_internal/1
+	notl	%esi	# 9975	[c=4 l=2]  *one_cmplsi2_1/0
+	addq	%rdi, %r8	# 9964	[c=4 l=3]  *adddi_1/0
+	movl	24(%rsp), %edi	# 14752	[c=9 l=4]  *movsi_internal/0
+	addl	$2, %edi	# 9965	[c=5 l=3]  addsi_1_zext/0
+	movl	%edi, (%rbx)	# 9966	[c=4 l=2]  *movsi_internal/1
+	movzbl	63(%r15), %r13d	# 9974	[c=13 l=5]  *zero_extendqisi2/0
+	movzbl	10(%r8), %r14d	# 9969	[c=13 l=5]  zero_extendqidi2/0
+	movzwl	12(%r8), %r8d	# 9972	[c=13 l=5]  zero_extendhidi2/0
+	andl	%r13d, %esi	# 9976	[c=4 l=3]  *andsi_1/0
+	movzbl	(%rdx), %r13d	# 18177	[c=5 l=4]  *movqi_internal/4
+	movzbl	1004(%rbx,%r14), %r9d	# 9970	[c=10 l=9]  *movqi_internal/4
+	movzbl	1004(%rbx,%r8), %r8d	# 9973	[c=10 l=9]  *movqi_internal/4
+	andl	%eax, %r13d	# 19129	[c=4 l=3]  *andsi_1/0
+	orl	%r13d, %esi	# 9979	[c=4 l=3]  *iorsi_1/0
+	movzbl	%r8b, %r15d	# 9982	[c=4 l=4]  *zero_extendqisi2/0
+	movzbl	%r9b, %r13d	# 9981	[c=4 l=4]  *zero_extendqisi2/0
+	andl	$136, %r8d	# 9991	[c=4 l=7]  *andsi_1/0
+	andl	$136, %r9d	# 9988	[c=4 l=7]  *andsi_1/0
+	andl	$1, %esi	# 9980	[c=4 l=3]  *andsi_1/0
+	addl	%r15d, %r13d	# 9983	[c=4 l=3]  *addsi_1/0
+	leal	(%r8,%r9,2), %r8d	# 9992	[c=8 l=4]  *leasi
+	addl	%r13d, %esi	# 9984	[c=4 l=3]  *addsi_1/0
+	imull	$260, %r8d, %r8d	# 9993	[c=12 l=7]  *mulsi3_1/1
+	movb	%sil, 1004(%rbx,%r14)	# 9986	[c=4 l=8]  *movqi_internal/8
+	andl	$7680, %r8d	# 9994	[c=4 l=7]  *andsi_1/0
+	orl	%esi, %r8d	# 9995	[c=5 l=3]  *iorsi_1_zext
+	movl	32(%rsp), %esi	# 14760	[c=9 l=4]  *movsi_internal/0
+	andl	$-64, %esi	# 9997	[c=4 l=3]  *andsi_2/0
+	jne	.L1293	# 9998	[c=13 l=6]  *jcc
+	leaq	(%rcx,%r8), %rdx	# 16116	[c=4 l=4]  *leadi
+	movl	$63, %eax	# 65	[c=4 l=5]  *movqi_internal/3
+.L1294:
+	movb	%al, 100(%rbx)	# 10019	[c=4 l=3]  *movqi_internal/8
+	movl	24(%rsp), %eax	# 14762	[c=9 l=4]  *movsi_internal/0
+	salq	$4, %rdi	# 10021	[c=4 l=4]  *ashldi3_1/0
+	movq	16(%rsp), %r15	# 15985	[c=9 l=5]  *movdi_internal/3
+	movq	%rdx, 104(%rbx)	# 10018	[c=4 l=4]  *movdi_internal/5
+	addl	$3, %eax	# 10023	[c=4 l=3]  *addsi_1/0
+	movl	%eax, (%rbx)	# 10024	[c=4 l=2]  *movsi_internal/1
+	addq	%rdi, %r15	# 10022	[c=4 l=3]  *adddi_1/0
+.L660:
+	movzwl	12(%r15), %eax	# 657	[c=13 l=5]  zero_extendhidi2/0
+	movzbl	100(%rbx), %esi	# 651	[c=13 l=4]  *zero_extendqisi2/0
+	movzbl	10(%r15), %r13d	# 654	[c=13 l=5]  zero_extendqidi2/0
+	movq	104(%rbx), %r14	# 653	[c=9 l=4]  *movdi_internal/3
+	movzbl	1004(%rbx,%rax), %r15d	# 658	[c=14 l=9]  *zero_extendqisi2/0
+	movq	1040(%rbx), %rax	# 659	[c=9 l=7]  *movdi_internal/3
+	movl	%esi, %edi	# 16662	[c=4 l=2]  *movsi_internal/0
+	movzbl	1004(%rbx,%r13), %r9d	# 655	[c=10 l=9]  *movqi_internal/4
+	movzbl	63(%rax), %edx	# 660	[c=13 l=4]  *zero_extendqisi2/0
+	movl	%esi, %eax	# 13840	[c=4 l=2]  *movsi_internal/0
+	movl	%r15d, %r8d	# 16663	[c=4 l=3]  *movsi_internal/0
+	notl	%eax	# 661	[c=4 l=2]  *one_cmplsi2_1/0
+	andl	$136, %r8d	# 677	[c=4 l=7]  *andsi_1/0
+	andl	%edx, %eax	# 662	[c=4 l=2]  *andsi_1/0
+	movzbl	(%r14), %edx	# 18376	[c=5 l=4]  *movqi_internal/4
+	andl	%esi, %edx	# 19128	[c=4 l=2]  *andsi_1/0
+	orl	%edx, %eax	# 665	[c=4 l=2]  *iorsi_1/0
+	movzbl	%r9b, %edx	# 667	[c=4 l=4]  *zero_extendqisi2/0
+	andl	$136, %r9d	# 674	[c=4 l=7]  *andsi_1/0
+	andl	$1, %eax	# 666	[c=4 l=3]  *andsi_1/0
+	addl	%r15d, %edx	# 669	[c=4 l=3]  *addsi_1/0
+	addl	%eax, %edx	# 670	[c=4 l=2]  *addsi_1/0
+	leal	(%r8,%r9,2), %eax	# 678	[c=8 l=4]  *leasi
+	imull	$260, %eax, %eax	# 679	[c=12 l=6]  *mulsi3_1/1
+	movb	%dl, 1004(%rbx,%r13)	# 672	[c=4 l=8]  *movqi_internal/8
+	andl	$7680, %eax	# 680	[c=4 l=5]  *andsi_1/0
+	orl	%edx, %eax	# 681	[c=5 l=2]  *iorsi_1_zext
+	andl	$-64, %esi	# 683	[c=4 l=3]  *andsi_2/0
+	jne	.L661	# 684	[c=13 l=6]  *jcc
+	addq	%rcx, %rax	# 688	[c=4 l=3]  *adddi_1/0
+	movl	$63, %edi	# 6	[c=4 l=5]  *movqi_internal/3
+.L662:
+	movl	(%rbx), %r15d	# 706	[c=6 l=3]  *zero_extendsidi2/3
+	movb	%dil, 100(%rbx)	# 705	[c=4 l=4]  *movqi_internal/8
+	movq	%r10, %rcx	# 18118	[c=4 l=3]  *movdi_internal/3
+	movq	%rax, 104(%rbx)	# 704	[c=4 l=4]  *movdi_internal/5
+	movq	%r15, %rdx	# 16664	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 708	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 710	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%r15), %eax	# 711	[c=13 l=5]  *zero_extendqisi2/0
+	movq	(%r15), %r14	# 714	[c=5 l=3]  *movdi_internal/3
+	addl	%edx, %eax	# 712	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 18119	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 713	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 18120	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 18121	[c=4 l=3]  *indirect_jump
+	.p2align 4,,10
+	.p2align 3
+.L1729:
+	movl	$0, 96(%rbx)	# 1164	[c=4 l=7]  *movsi_internal/1
+	movq	%rbx, %rdi	# 1165	[c=4 l=3]  *movdi_internal/3
+	call	do_events	# 1166	[c=0 l=5]  *call
+	movq	48(%rbx), %rdx	# 1167	[c=9 l=4]  *movdi_internal/3
+	leaq	flag_update_table_sub8(%rip), %r11	# 14973	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 14971	[c=1 l=7]  *movdi_internal/4
+	jmp	.L684	# 18410	[c=1 l=5]  jump
+.L1730:
+	xorl	%r15d, %r15d	# 18358	[c=4 l=3]  *movsi_xor
+	movq	%rbx, %rdi	# 1226	[c=4 l=3]  *movdi_internal/3
+	movl	%r15d, 96(%rbx)	# 18359	[c=4 l=4]  *movsi_internal/1
+	call	do_events	# 1227	[c=0 l=5]  *call
+	movq	48(%rbx), %rdx	# 1228	[c=9 l=4]  *movdi_internal/3
+	leaq	flag_update_table_sub8(%rip), %r11	# 14977	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 14975	[c=1 l=7]  *movdi_internal/4
+	jmp	.L687	# 18412	[c=1 l=5]  jump
+.L1727:
+	cmpq	$0, 10984(%rbx)	# 115	[c=13 l=8]  *cmpdi_ccno_1/1
+	jne	.L612	# 116	[c=13 l=6]  *jcc
+	leaq	.LC13(%rip), %rcx	# 118	[c=1 l=7]  *movdi_internal/4
+	movl	$8, %edx	# 120	[c=4 l=5]  *movdi_internal/2
+	movl	%ebp, %esi	# 121	[c=4 l=2]  *movsi_internal/0
+	movq	%rbx, %rdi	# 122	[c=4 l=3]  *movdi_internal/3
+	call	get_mem	# 123	[c=10 l=5]  *call_value
+	movq	%rax, 10984(%rbx)	# 125	[c=4 l=7]  *movdi_internal/5
+	jmp	.L612	# 18414	[c=1 l=5]  jump
+.L1296:
+	movzwl	12(%r15), %ecx	# 10052	[c=13 l=5]  zero_extendhidi2/0
+	movzbl	10(%r15), %eax	# 10053	[c=13 l=5]  *zero_extendqisi2/0
+	movq	%rcx, %rdx	# 16863	[c=4 l=3]  *movdi_internal/3
+	movzbl	1004(%rbx,%rcx), %esi	# 10055	[c=10 l=8]  *movqi_internal/4
+	movslq	%eax, %rcx	# 10056	[c=4 l=3]  *extendsidi2_rex64/1
+	addl	$1, %eax	# 10061	[c=4 l=3]  *addsi_1/0
+	addl	$1, %edx	# 10058	[c=4 l=3]  *addsi_1/0
+	cltq	# 10062	[c=4 l=2]  *extendsidi2_rex64/0
+	movslq	%edx, %rdx	# 10059	[c=4 l=3]  *extendsidi2_rex64/1
+	movb	%sil, 1004(%rbx,%rcx)	# 10057	[c=4 l=8]  *movqi_internal/8
+	movzbl	1004(%rbx,%rdx), %edx	# 10060	[c=10 l=8]  *movqi_internal/4
+	movb	%dl, 1004(%rbx,%rax)	# 10063	[c=4 l=7]  *movqi_internal/8
+	movl	(%rbx), %r15d	# 10064	[c=6 l=3]  *zero_extendsidi2/3
+	movq	%r15, %rax	# 16864	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 10066	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 10068	[c=13 l=7]  *adddi_1/1
+	addl	$1, %eax	# 10069	[c=4 l=3]  *addsi_1/0
+	movl	%eax, (%rbx)	# 10070	[c=4 l=2]  *movsi_internal/1
+.L667:
+	movzbl	10(%r15), %eax	# 834	[c=13 l=5]  zero_extendqidi2/0
+	movzwl	12(%r15), %edi	# 842	[c=13 l=5]  *zero_extendhisi2/0
+	leal	1(%rax), %esi	# 16391	[c=4 l=3]  *leasi
+	movzbl	1004(%rbx,%rax), %ecx	# 840	[c=14 l=8]  *zero_extendqisi2/0
+	movslq	%esi, %rsi	# 836	[c=4 l=3]  *extendsidi2_rex64/1
+	movzbl	1004(%rbx,%rsi), %edx	# 837	[c=14 l=8]  *zero_extendqisi2/0
+	sall	$8, %edx	# 838	[c=4 l=3]  *ashlsi3_1/0
+	orl	%ecx, %edx	# 841	[c=4 l=2]  *iorsi_1/0
+	movl	%edx, %ecx	# 13858	[c=4 l=2]  *movsi_internal/0
+	shrl	$5, %edx	# 851	[c=4 l=3]  *lshrsi3_1/0
+	subl	%edi, %ecx	# 843	[c=4 l=2]  *subsi_1/0
+	andl	$1024, %edx	# 852	[c=4 l=6]  *andsi_1/0
+	movl	%ecx, %edi	# 13860	[c=4 l=2]  *movsi_internal/0
+	movb	%cl, 1004(%rbx,%rax)	# 845	[c=4 l=7]  *movqi_internal/8
+	leaq	flag_update_table_sub8(%rip), %rax	# 849	[c=1 l=7]  *movdi_internal/4
+	sarl	$8, %edi	# 846	[c=4 l=3]  *ashrsi3_1/0
+	movb	%dil, 1004(%rbx,%rsi)	# 848	[c=4 l=8]  *movqi_internal/8
+	andl	$511, %edi	# 853	[c=4 l=6]  *andsi_1/0
+	movl	(%rbx), %r15d	# 876	[c=6 l=3]  *zero_extendsidi2/3
+	orl	%edi, %edx	# 854	[c=4 l=2]  *iorsi_1/0
+	movslq	%edx, %rdx	# 855	[c=4 l=3]  *extendsidi2_rex64/1
+	movzbl	(%rax,%rdx), %edx	# 856	[c=13 l=4]  *zero_extendqisi2/0
+	xorl	%eax, %eax	# 18364	[c=4 l=2]  *movsi_xor
+	testw	%cx, %cx	# 18365	[c=4 l=3]  *cmphi_ccno_1/0
+	movq	104(%rbx), %rcx	# 867	[c=9 l=4]  *movdi_internal/3
+	setne	%al	# 18366	[c=4 l=3]  *setcc_qi_slp
+	addl	%eax, %eax	# 861	[c=4 l=2]  *ashlsi3_1/0
+	movzbl	(%rcx), %edi	# 18367	[c=5 l=3]  *movqi_internal/4
+	notl	%eax	# 862	[c=4 l=2]  *one_cmplsi2_1/0
+	andl	%eax, %edx	# 863	[c=4 l=2]  *andsi_1/0
+	movzbl	100(%rbx), %eax	# 864	[c=13 l=4]  *zero_extendqisi2/0
+	andl	$-33, %edx	# 869	[c=4 l=3]  *andsi_1/0
+	andl	$-32, %eax	# 865	[c=4 l=3]  *andsi_1/0
+	andl	%eax, %edi	# 19127	[c=4 l=2]  *andsi_1/0
+	orl	$31, %eax	# 16395	[c=4 l=3]  *iorsi_1/0
+	movl	%edi, %ecx	# 13863	[c=4 l=2]  *movqi_internal/1
+	movb	%al, 100(%rbx)	# 873	[c=4 l=3]  *movqi_internal/8
+	orl	%ecx, %edx	# 16394	[c=4 l=2]  *iorsi_1/0
+	movq	%r10, %rcx	# 18094	[c=4 l=3]  *movdi_internal/3
+	movb	%dl, 101(%rbx)	# 871	[c=4 l=3]  *movqi_internal/8
+	leaq	101(%rbx), %rdx	# 16396	[c=4 l=4]  *leadi
+	movq	%rdx, 104(%rbx)	# 875	[c=4 l=4]  *movdi_internal/5
+	movq	%r15, %rdx	# 16667	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 878	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 880	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%r15), %eax	# 881	[c=13 l=5]  *zero_extendqisi2/0
+	movq	(%r15), %r14	# 884	[c=5 l=3]  *movdi_internal/3
+	addl	%edx, %eax	# 882	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 18095	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 883	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 18096	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 18097	[c=4 l=3]  *indirect_jump
+.L1295:
+	movzwl	12(%r15), %ecx	# 10029	[c=13 l=5]  zero_extendhidi2/0
+	movzbl	10(%r15), %eax	# 10030	[c=13 l=5]  *zero_extendqisi2/0
+	movq	%rcx, %rdx	# 16861	[c=4 l=3]  *movdi_internal/3
+	movzbl	1004(%rbx,%rcx), %esi	# 10032	[c=10 l=8]  *movqi_internal/4
+	movslq	%eax, %rcx	# 10033	[c=4 l=3]  *extendsidi2_rex64/1
+	addl	$1, %eax	# 10038	[c=4 l=3]  *addsi_1/0
+	addl	$1, %edx	# 10035	[c=4 l=3]  *addsi_1/0
+	cltq	# 10039	[c=4 l=2]  *extendsidi2_rex64/0
+	movslq	%edx, %rdx	# 10036	[c=4 l=3]  *extendsidi2_rex64/1
+	movb	%sil, 1004(%rbx,%rcx)	# 10034	[c=4 l=8]  *movqi_internal/8
+	movzbl	1004(%rbx,%rdx), %edx	# 10037	[c=10 l=8]  *movqi_internal/4
+	movb	%dl, 1004(%rbx,%rax)	# 10040	[c=4 l=7]  *movqi_internal/8
+	movl	(%rbx), %r15d	# 10041	[c=6 l=3]  *zero_extendsidi2/3
+	movq	%r15, %rax	# 16862	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 10043	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 10045	[c=13 l=7]  *adddi_1/1
+	addl	$1, %eax	# 10046	[c=4 l=3]  *addsi_1/0
+	movl	%eax, (%rbx)	# 10047	[c=4 l=2]  *movsi_internal/1
+.L666:
+	movzbl	10(%r15), %edx	# 780	[c=13 l=5]  zero_extendqidi2/0
+	leal	1(%rdx), %ecx	# 16397	[c=4 l=3]  *leasi
+	movzbl	1004(%rbx,%rdx), %esi	# 786	[c=14 l=8]  *zero_extendqisi2/0
+	movslq	%ecx, %rcx	# 782	[c=4 l=3]  *extendsidi2_rex64/1
+	movzbl	1004(%rbx,%rcx), %eax	# 783	[c=14 l=8]  *zero_extendqisi2/0
+	sall	$8, %eax	# 784	[c=4 l=3]  *ashlsi3_1/0
+	orl	%esi, %eax	# 787	[c=4 l=2]  *iorsi_1/0
+	movzwl	12(%r15), %esi	# 788	[c=13 l=5]  *zero_extendhisi2/0
+	addl	%eax, %esi	# 789	[c=4 l=2]  *addsi_1/0
+	shrl	$5, %eax	# 797	[c=4 l=3]  *lshrsi3_1/0
+	movb	%sil, 1004(%rbx,%rdx)	# 791	[c=4 l=8]  *movqi_internal/8
+	movl	%esi, %edx	# 13854	[c=4 l=2]  *movsi_internal/0
+	andl	$1024, %eax	# 798	[c=4 l=5]  *andsi_1/0
+	sarl	$8, %edx	# 792	[c=4 l=3]  *ashrsi3_1/0
+	orl	%edx, %eax	# 799	[c=4 l=2]  *iorsi_1/0
+	movb	%dl, 1004(%rbx,%rcx)	# 794	[c=4 l=7]  *movqi_internal/8
+	leaq	flag_update_table_add8(%rip), %rcx	# 795	[c=1 l=7]  *movdi_internal/4
+	movl	(%rbx), %r15d	# 821	[c=6 l=3]  *zero_extendsidi2/3
+	cltq	# 800	[c=4 l=2]  *extendsidi2_rex64/0
+	movzbl	(%rcx,%rax), %edx	# 801	[c=13 l=4]  *zero_extendqisi2/0
+	xorl	%eax, %eax	# 18369	[c=4 l=2]  *movsi_xor
+	testw	%si, %si	# 18370	[c=4 l=3]  *cmphi_ccno_1/0
+	movq	104(%rbx), %rcx	# 812	[c=9 l=4]  *movdi_internal/3
+	setne	%al	# 18371	[c=4 l=3]  *setcc_qi_slp
+	addl	%eax, %eax	# 806	[c=4 l=2]  *ashlsi3_1/0
+	movzbl	(%rcx), %edi	# 18372	[c=5 l=3]  *movqi_internal/4
+	notl	%eax	# 807	[c=4 l=2]  *one_cmplsi2_1/0
+	andl	%eax, %edx	# 808	[c=4 l=2]  *andsi_1/0
+	movzbl	100(%rbx), %eax	# 809	[c=13 l=4]  *zero_extendqisi2/0
+	andl	$-33, %edx	# 814	[c=4 l=3]  *andsi_1/0
+	andl	$-32, %eax	# 810	[c=4 l=3]  *andsi_1/0
+	andl	%eax, %edi	# 19126	[c=4 l=2]  *andsi_1/0
+	orl	$31, %eax	# 16401	[c=4 l=3]  *iorsi_1/0
+	movl	%edi, %ecx	# 13857	[c=4 l=2]  *movqi_internal/1
+	movb	%al, 100(%rbx)	# 818	[c=4 l=3]  *movqi_internal/8
+	orl	%ecx, %edx	# 16400	[c=4 l=2]  *iorsi_1/0
+	movq	%r10, %rcx	# 18102	[c=4 l=3]  *movdi_internal/3
+	movb	%dl, 101(%rbx)	# 816	[c=4 l=3]  *movqi_internal/8
+	leaq	101(%rbx), %rdx	# 16402	[c=4 l=4]  *leadi
+	movq	%rdx, 104(%rbx)	# 820	[c=4 l=4]  *movdi_internal/5
+	movq	%r15, %rdx	# 16666	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 823	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 825	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%r15), %eax	# 826	[c=13 l=5]  *zero_extendqisi2/0
+	movq	(%r15), %r14	# 829	[c=5 l=3]  *movdi_internal/3
+	addl	%edx, %eax	# 827	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 18103	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 828	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 18104	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 18105	[c=4 l=3]  *indirect_jump
+.L1221:
+	movzbl	10(%r15), %eax	# 7997	[c=13 l=5]  zero_extendqidi2/0
+	movzwl	12(%r15), %edx	# 7998	[c=9 l=5]  *movhi_internal/2
+	movb	%dl, 1004(%rbx,%rax)	# 7999	[c=4 l=7]  *movqi_internal/8
+	movl	(%rbx), %r15d	# 8000	[c=6 l=3]  *zero_extendsidi2/3
+	movq	%r15, %rax	# 16816	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 8002	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 8004	[c=13 l=7]  *adddi_1/1
+	addl	$1, %eax	# 8005	[c=4 l=3]  *addsi_1/0
+	movl	%eax, (%rbx)	# 8006	[c=4 l=2]  *movsi_internal/1
+.L849:
+	movzbl	10(%r15), %eax	# 3358	[c=13 l=5]  zero_extendqidi2/0
+	movzwl	12(%r15), %edx	# 3359	[c=9 l=5]  *movhi_internal/2
+	movq	%r10, %rcx	# 17814	[c=4 l=3]  *movdi_internal/3
+	movb	%dl, 1004(%rbx,%rax)	# 3360	[c=4 l=7]  *movqi_internal/8
+	movl	(%rbx), %r15d	# 3361	[c=6 l=3]  *zero_extendsidi2/3
+	movq	%r15, %rdx	# 16710	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 3363	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 3365	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%r15), %eax	# 3366	[c=13 l=5]  *zero_extendqisi2/0
+	movq	(%r15), %r14	# 3369	[c=5 l=3]  *movdi_internal/3
+	addl	%edx, %eax	# 3367	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 17815	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 3368	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 17816	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 17817	[c=4 l=3]  *indirect_jump
+.L1330:
+	cmpb	$0, 844(%rbx)	# 10419	[c=13 l=7]  *cmpqi_ccno_1/1
+	movzbl	10(%r15), %r13d	# 10418	[c=13 l=5]  *zero_extendqisi2/0
+	jne	.L1735	# 10420	[c=13 l=6]  *jcc
+	movzwl	1034(%rbx), %r14d	# 10433	[c=13 l=8]  zero_extendhidi2/0
+	movl	%r14d, %edx	# 14782	[c=4 l=3]  *movsi_internal/0
+	movq	%r14, %rax	# 16873	[c=4 l=3]  *movdi_internal/3
+	subl	5176(%rbx), %edx	# 10436	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %edx	# 10437	[c=13 l=6]  *cmpsi_1/1
+	jb	.L1333	# 10438	[c=13 l=2]  *jcc
+	movl	%r14d, %edx	# 14784	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %edx	# 10440	[c=4 l=3]  *ashrsi3_1/0
+	movslq	%edx, %rdx	# 10441	[c=4 l=3]  *extendsidi2_rex64/1
+	cmpb	$0, 1080(%rbx,%rdx)	# 10442	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L1334	# 10443	[c=13 l=6]  *jcc
+.L1333:
+	movq	1040(%rbx), %rdx	# 10447	[c=9 l=7]  *movdi_internal/3
+	movzbl	(%rdx,%rax), %edx	# 10448	[c=13 l=4]  *zero_extendqisi2/0
+.L1335:
+	movslq	%r13d, %rax	# 10459	[c=4 l=3]  *extendsidi2_rex64/1
+	movb	%dl, 1004(%rbx,%rax)	# 10460	[c=4 l=7]  *movqi_internal/8
+	leal	1(%r14), %eax	# 16109	[c=4 l=4]  *leasi
+	subq	$1, 48(%rbx)	# 10461	[c=13 l=5]  *adddi_1/0
+	movw	%ax, 1034(%rbx)	# 10463	[c=4 l=7]  *movhi_internal/3
+.L1332:
+	movl	(%rbx), %r15d	# 10466	[c=6 l=3]  *zero_extendsidi2/3
+	movq	%r15, %rax	# 16874	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 10468	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 10470	[c=13 l=7]  *adddi_1/1
+	addl	$1, %eax	# 10471	[c=4 l=3]  *addsi_1/0
+	movl	%eax, (%rbx)	# 10472	[c=4 l=2]  *movsi_internal/1
+.L1144:
+	cmpb	$0, 844(%rbx)	# 6993	[c=13 l=7]  *cmpqi_ccno_1/1
+	movzbl	10(%r15), %esi	# 6992	[c=13 l=5]  zero_extendqidi2/0
+	jne	.L1736	# 6994	[c=13 l=6]  *jcc
+	movzwl	1032(%rbx), %r13d	# 7007	[c=13 l=8]  zero_extendhidi2/0
+	movzbl	1004(%rbx,%rsi), %ecx	# 7010	[c=10 l=8]  *movqi_internal/4
+	movl	%r13d, %eax	# 14303	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdx	# 16790	[c=4 l=3]  *movdi_internal/3
+	subl	5176(%rbx), %eax	# 7012	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %eax	# 7013	[c=13 l=6]  *cmpsi_1/1
+	jb	.L1147	# 7014	[c=13 l=2]  *jcc
+	movl	%r13d, %eax	# 14305	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %eax	# 7016	[c=4 l=3]  *ashrsi3_1/0
+	cltq	# 7017	[c=4 l=2]  *extendsidi2_rex64/0
+	cmpb	$0, 1080(%rbx,%rax)	# 7018	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L1148	# 7019	[c=13 l=6]  *jcc
+.L1147:
+	movq	1040(%rbx), %rax	# 7023	[c=9 l=7]  *movdi_internal/3
+	movb	%cl, (%rax,%rdx)	# 7024	[c=4 l=3]  *movqi_internal/8
+.L1149:
+	leal	1(%r13), %eax	# 16270	[c=4 l=4]  *leasi
+	subq	$1, 48(%rbx)	# 7036	[c=13 l=5]  *adddi_1/0
+	movw	%ax, 1032(%rbx)	# 7038	[c=4 l=7]  *movhi_internal/3
+.L1146:
+	movl	(%rbx), %r15d	# 7041	[c=6 l=3]  *zero_extendsidi2/3
+	movq	%r10, %rcx	# 17382	[c=4 l=3]  *movdi_internal/3
+	movq	%r15, %rdx	# 16791	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 7043	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 7045	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%r15), %eax	# 7046	[c=13 l=5]  *zero_extendqisi2/0
+	movq	(%r15), %r14	# 7049	[c=5 l=3]  *movdi_internal/3
+	addl	%edx, %eax	# 7047	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 17383	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 7048	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 17384	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 17385	[c=4 l=3]  *indirect_jump
+.L1264:
+	movzbl	10(%r15), %esi	# 9176	[c=13 l=5]  zero_extendqidi2/0
+	movzwl	12(%r15), %edi	# 9174	[c=13 l=5]  *zero_extendhisi2/0
+	movzbl	1004(%rbx,%rsi), %eax	# 9177	[c=14 l=8]  *zero_extendqisi2/0
+	movl	%edi, %edx	# 16837	[c=4 l=2]  *movsi_internal/0
+	andl	$136, %edx	# 9187	[c=4 l=6]  *andsi_1/0
+	movl	%eax, %ecx	# 16836	[c=4 l=2]  *movsi_internal/0
+	subl	%edi, %eax	# 9180	[c=4 l=2]  *subsi_1/0
+	andl	$136, %ecx	# 9184	[c=4 l=6]  *andsi_1/0
+	movb	%al, 1004(%rbx,%rsi)	# 9182	[c=4 l=7]  *movqi_internal/8
+	andl	$511, %eax	# 9191	[c=4 l=5]  *andsi_1/0
+	leal	(%rdx,%rcx,2), %edx	# 9188	[c=8 l=3]  *leasi
+	movzbl	100(%rbx), %ecx	# 9193	[c=9 l=4]  *movqi_internal/4
+	imull	$260, %edx, %edx	# 9189	[c=12 l=6]  *mulsi3_1/1
+	andl	$7680, %edx	# 9190	[c=4 l=6]  *andsi_1/0
+	orl	%eax, %edx	# 9192	[c=5 l=2]  *iorsi_1_zext
+	movl	%ecx, %eax	# 14624	[c=4 l=2]  *movsi_internal/0
+	andl	$192, %eax	# 9196	[c=4 l=5]  *andsi_2/0
+	jne	.L1265	# 9197	[c=13 l=6]  *jcc
+	leaq	flag_update_table_sub8(%rip), %rax	# 9200	[c=1 l=7]  *movdi_internal/4
+	movl	$63, %esi	# 56	[c=4 l=5]  *movqi_internal/3
+	leaq	(%rax,%rdx), %rcx	# 16171	[c=4 l=4]  *leadi
+	leaq	101(%rbx), %rdx	# 12293	[c=4 l=4]  *leadi
+.L1266:
+	movl	(%rbx), %r15d	# 9220	[c=6 l=3]  *zero_extendsidi2/3
+	movq	%rcx, 104(%rbx)	# 9218	[c=4 l=4]  *movdi_internal/5
+	movb	%sil, 100(%rbx)	# 9219	[c=4 l=4]  *movqi_internal/8
+	movq	%r15, %rcx	# 16838	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 9222	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 9224	[c=13 l=7]  *adddi_1/1
+	addl	$1, %ecx	# 9225	[c=4 l=3]  *addsi_1/0
+	movl	%ecx, (%rbx)	# 9226	[c=4 l=2]  *movsi_internal/1
+.L1031:
+	movzbl	10(%r15), %r14d	# 5610	[c=13 l=5]  zero_extendqidi2/0
+	movzbl	100(%rbx), %esi	# 5606	[c=13 l=4]  *zero_extendqisi2/0
+	movzwl	12(%r15), %r8d	# 5603	[c=9 l=5]  *movhi_internal/2
+	movq	1040(%rbx), %rcx	# 5605	[c=9 l=7]  *movdi_internal/3
+	movzbl	1004(%rbx,%r14), %r15d	# 5611	[c=14 l=9]  *zero_extendqisi2/0
+	movl	%esi, %edi	# 16758	[c=4 l=2]  *movsi_internal/0
+	movq	104(%rbx), %r13	# 5609	[c=9 l=4]  *movdi_internal/3
+	movl	%esi, 32(%rsp)	# 16023	[c=4 l=4]  *movsi_internal/1
+	notl	%esi	# 5608	[c=4 l=2]  *one_cmplsi2_1/0
+	movq	%rcx, 24(%rsp)	# 15429	[c=4 l=5]  *movdi_internal/5
+	movl	%esi, 16(%rsp)	# 14202	[c=4 l=4]  *movsi_internal/1
+	movzwl	%r8w, %esi	# 5613	[c=4 l=4]  *zero_extendhisi2/0
+	movl	%r15d, %r9d	# 16759	[c=4 l=3]  *movsi_internal/0
+	andl	$136, %r8d	# 5628	[c=4 l=7]  *andsi_1/0
+	subl	%esi, %r15d	# 5614	[c=4 l=3]  *subsi_1/0
+	movzbl	63(%rcx), %esi	# 5615	[c=13 l=4]  *zero_extendqisi2/0
+	movl	16(%rsp), %ecx	# 14204	[c=9 l=4]  *movsi_internal/0
+	andl	$136, %r9d	# 5625	[c=4 l=7]  *andsi_1/0
+	andl	%ecx, %esi	# 5616	[c=4 l=2]  *andsi_1/0
+	movzbl	0(%r13), %ecx	# 18257	[c=5 l=5]  *movqi_internal/4
+	andl	%edi, %ecx	# 19125	[c=4 l=2]  *andsi_1/0
+	orl	%ecx, %esi	# 5619	[c=4 l=2]  *iorsi_1/0
+	movl	32(%rsp), %ecx	# 16010	[c=9 l=4]  *movsi_internal/0
+	andl	$1, %esi	# 5620	[c=4 l=3]  *andsi_1/0
+	subl	%esi, %r15d	# 5621	[c=4 l=3]  *subsi_1/0
+	leal	(%r8,%r9,2), %esi	# 5629	[c=8 l=4]  *leasi
+	movq	24(%rsp), %r9	# 14208	[c=9 l=5]  *movdi_internal/3
+	andl	$-64, %ecx	# 5631	[c=4 l=3]  *andsi_1/0
+	imull	$260, %esi, %esi	# 5634	[c=12 l=6]  *mulsi3_1/1
+	movb	%r15b, 1004(%rbx,%r14)	# 5623	[c=4 l=8]  *movqi_internal/8
+	movl	16(%rsp), %r14d	# 14209	[c=9 l=5]  *movsi_internal/0
+	andl	$511, %r15d	# 5636	[c=4 l=7]  *andsi_1/0
+	movzbl	0(%r13), %r8d	# 5630	[c=5 l=5]  *movqi_internal/4
+	movzbl	63(%r9), %r9d	# 5640	[c=13 l=5]  *zero_extendqisi2/0
+	movq	%rdx, 104(%rbx)	# 5653	[c=4 l=4]  *movdi_internal/5
+	andl	%r14d, %r9d	# 5641	[c=4 l=3]  *andsi_1/0
+	andl	%r8d, %edi	# 16276	[c=4 l=3]  *andsi_1/0
+	andl	$7680, %esi	# 5635	[c=4 l=6]  *andsi_1/0
+	andl	%ecx, %r8d	# 16277	[c=4 l=3]  *andsi_1/0
+	orl	%r15d, %esi	# 5637	[c=5 l=3]  *iorsi_1_zext
+	orl	%r9d, %edi	# 5644	[c=4 l=3]  *iorsi_1/0
+	movl	(%rbx), %r15d	# 5654	[c=6 l=3]  *zero_extendsidi2/3
+	orl	$63, %ecx	# 16279	[c=4 l=3]  *iorsi_1/0
+	orl	$-3, %edi	# 5645	[c=4 l=3]  *iorsi_1/0
+	andb	(%rax,%rsi), %dil	# 5646	[c=13 l=4]  *andqi_1/1
+	movb	%cl, 100(%rbx)	# 5651	[c=4 l=3]  *movqi_internal/8
+	movq	%r10, %rcx	# 17542	[c=4 l=3]  *movdi_internal/3
+	movl	%edi, %eax	# 14211	[c=4 l=2]  *movqi_internal/1
+	movq	%r15, %rdx	# 16760	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 5656	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 5658	[c=13 l=7]  *adddi_1/1
+	orl	%eax, %r8d	# 16278	[c=4 l=3]  *iorsi_1/0
+	movb	%r8b, 101(%rbx)	# 5649	[c=4 l=4]  *movqi_internal/8
+	movzbl	9(%r15), %eax	# 5659	[c=13 l=5]  *zero_extendqisi2/0
+	movq	(%r15), %r14	# 5662	[c=5 l=3]  *movdi_internal/3
+	addl	%edx, %eax	# 5660	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 17543	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 5661	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 17544	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 17545	[c=4 l=3]  *indirect_jump
+.L1311:
+	movzbl	10(%r15), %r13d	# 10224	[c=13 l=5]  zero_extendqidi2/0
+	movq	%rbx, %rdi	# 10225	[c=4 l=3]  *movdi_internal/3
+	call	pop_byte	# 10226	[c=10 l=5]  *call_value
+	movb	%al, 1004(%rbx,%r13)	# 10229	[c=4 l=8]  *movqi_internal/8
+	movl	(%rbx), %r15d	# 10230	[c=6 l=3]  *zero_extendsidi2/3
+	movq	%r15, %rax	# 16866	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 10232	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 10234	[c=13 l=7]  *adddi_1/1
+	addl	$1, %eax	# 10235	[c=4 l=3]  *addsi_1/0
+	movl	%eax, (%rbx)	# 10236	[c=4 l=2]  *movsi_internal/1
+.L943:
+	movzbl	10(%r15), %r13d	# 4544	[c=13 l=5]  zero_extendqidi2/0
+	movq	%rbx, %rdi	# 4545	[c=4 l=3]  *movdi_internal/3
+	call	pop_byte	# 4546	[c=10 l=5]  *call_value
+	leaq	flag_update_table_add8(%rip), %r10	# 15281	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_sub8(%rip), %r11	# 15283	[c=1 l=7]  *movdi_internal/4
+	movb	%al, 1004(%rbx,%r13)	# 4549	[c=4 l=8]  *movqi_internal/8
+	movl	(%rbx), %r15d	# 4550	[c=6 l=3]  *zero_extendsidi2/3
+	movq	%r10, %rcx	# 17606	[c=4 l=3]  *movdi_internal/3
+	movq	%r15, %rdx	# 16746	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 4552	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 4554	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%r15), %eax	# 4555	[c=13 l=5]  *zero_extendqisi2/0
+	movq	(%r15), %r14	# 4558	[c=5 l=3]  *movdi_internal/3
+	addl	%edx, %eax	# 4556	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 17607	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 4557	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 17608	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 17609	[c=4 l=3]  *indirect_jump
+.L1297:
+	movzbl	10(%r15), %eax	# 10076	[c=13 l=5]  zero_extendqidi2/0
+	movl	5176(%rbx), %r13d	# 10078	[c=9 l=7]  *movsi_internal/0
+	movl	5180(%rbx), %r14d	# 10079	[c=9 l=7]  *movsi_internal/0
+	movzbl	1004(%rbx,%rax), %edx	# 10077	[c=14 l=8]  *zero_extendqisi2/0
+	movl	$61, %eax	# 10080	[c=4 l=5]  *movsi_internal/0
+	subl	%r13d, %eax	# 10081	[c=4 l=3]  *subsi_1/0
+	cmpl	%r14d, %eax	# 10082	[c=4 l=3]  *cmpsi_1/0
+	jb	.L1298	# 10083	[c=13 l=6]  *jcc
+	cmpb	$1, 1081(%rbx)	# 10087	[c=13 l=7]  *cmpqi_1/0
+	ja	.L1737	# 10088	[c=13 l=6]  *jcc
+	movq	1040(%rbx), %rax	# 12067	[c=9 l=7]  *movdi_internal/3
+	movzbl	61(%rax), %r15d	# 12068	[c=13 l=5]  *zero_extendqisi2/0
+.L1300:
+	movzbl	62(%rax), %eax	# 10125	[c=13 l=4]  *zero_extendqisi2/0
+.L1302:
+	sall	$8, %eax	# 10128	[c=4 l=3]  *ashlsi3_1/0
+	orl	%r15d, %eax	# 10129	[c=4 l=3]  *iorsi_1/0
+	cmpl	996(%rbx), %eax	# 10131	[c=13 l=6]  *cmpsi_1/1
+	jb	.L1738	# 10132	[c=13 l=6]  *jcc
+	movl	%eax, %ecx	# 14764	[c=4 l=2]  *movsi_internal/0
+	leal	-1(%rax), %r15d	# 16113	[c=4 l=4]  *leasi
+	subl	%r13d, %ecx	# 10141	[c=4 l=3]  *subsi_1/0
+	cmpl	%r14d, %ecx	# 10142	[c=4 l=3]  *cmpsi_1/0
+	jb	.L1304	# 10143	[c=13 l=2]  *jcc
+	movl	%eax, %ecx	# 14766	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %ecx	# 10145	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %ecx	# 13641	[c=5 l=6]  *andsi_1_zext
+	cmpb	$0, 1080(%rbx,%rcx)	# 10148	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L1305	# 10149	[c=13 l=6]  *jcc
+.L1304:
+	movq	1040(%rbx), %rcx	# 10153	[c=9 l=7]  *movdi_internal/3
+	cltq	# 10152	[c=4 l=2]  *extendsidi2_rex64/0
+	movb	%dl, (%rcx,%rax)	# 10154	[c=4 l=3]  *movqi_internal/8
+.L1306:
+	movl	$61, %eax	# 10166	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%rbx), %eax	# 10167	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %eax	# 10168	[c=13 l=6]  *cmpsi_1/1
+	jb	.L1307	# 10169	[c=13 l=2]  *jcc
+	cmpb	$1, 1081(%rbx)	# 10173	[c=13 l=7]  *cmpqi_1/0
+	ja	.L1739	# 10174	[c=13 l=6]  *jcc
+.L1307:
+	movq	1040(%rbx), %rax	# 10185	[c=9 l=7]  *movdi_internal/3
+	movb	%r15b, 61(%rax)	# 10186	[c=4 l=4]  *movqi_internal/8
+.L1308:
+	movl	%r15d, %eax	# 14768	[c=4 l=3]  *movsi_internal/0
+	movl	$62, %edx	# 10190	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%rbx), %edx	# 10191	[c=13 l=6]  *subsi_1/1
+	sarl	$8, %eax	# 10189	[c=4 l=3]  *ashrsi3_1/0
+	cmpl	5180(%rbx), %edx	# 10192	[c=13 l=6]  *cmpsi_1/1
+	jb	.L1309	# 10193	[c=13 l=2]  *jcc
+	cmpb	$1, 1081(%rbx)	# 10197	[c=13 l=7]  *cmpqi_1/0
+	ja	.L1740	# 10198	[c=13 l=6]  *jcc
+.L1309:
+	movq	1040(%rbx), %rdx	# 10209	[c=9 l=7]  *movdi_internal/3
+	movb	%al, 62(%rdx)	# 10210	[c=4 l=3]  *movqi_internal/8
+.L1310:
+	movl	(%rbx), %r15d	# 10213	[c=6 l=3]  *zero_extendsidi2/3
+	movq	%r15, %rax	# 16865	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 10215	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 10217	[c=13 l=7]  *adddi_1/1
+	addl	$1, %eax	# 10218	[c=4 l=3]  *addsi_1/0
+	movl	%eax, (%rbx)	# 10219	[c=4 l=2]  *movsi_internal/1
+.L944:
+	movzbl	10(%r15), %eax	# 4564	[c=13 l=5]  zero_extendqidi2/0
+	movl	5176(%rbx), %r13d	# 4566	[c=9 l=7]  *movsi_internal/0
+	movl	5180(%rbx), %r14d	# 4567	[c=9 l=7]  *movsi_internal/0
+	movzbl	1004(%rbx,%rax), %r15d	# 4565	[c=10 l=9]  *movqi_internal/4
+	movl	$61, %eax	# 4568	[c=4 l=5]  *movsi_internal/0
+	subl	%r13d, %eax	# 4569	[c=4 l=3]  *subsi_1/0
+	cmpl	%r14d, %eax	# 4570	[c=4 l=3]  *cmpsi_1/0
+	jb	.L945	# 4571	[c=13 l=6]  *jcc
+	cmpb	$1, 1081(%rbx)	# 4575	[c=13 l=7]  *cmpqi_1/0
+	ja	.L1741	# 4576	[c=13 l=6]  *jcc
+	movq	1040(%rbx), %rax	# 12043	[c=9 l=7]  *movdi_internal/3
+	movzbl	61(%rax), %edx	# 12044	[c=13 l=4]  *zero_extendqisi2/0
+.L947:
+	movzbl	62(%rax), %esi	# 4613	[c=13 l=4]  *zero_extendqisi2/0
+.L949:
+	sall	$8, %esi	# 4616	[c=4 l=3]  *ashlsi3_1/0
+	orl	%edx, %esi	# 4617	[c=4 l=2]  *iorsi_1/0
+	cmpl	996(%rbx), %esi	# 4619	[c=13 l=6]  *cmpsi_1/1
+	jb	.L1586	# 4620	[c=13 l=6]  *jcc
+	movl	%esi, %edx	# 14126	[c=4 l=2]  *movsi_internal/0
+	leal	-1(%rsi), %eax	# 16299	[c=4 l=3]  *leasi
+	subl	%r13d, %edx	# 4629	[c=4 l=3]  *subsi_1/0
+	cmpl	%r14d, %edx	# 4630	[c=4 l=3]  *cmpsi_1/0
+	jb	.L951	# 4631	[c=13 l=2]  *jcc
+	movl	%esi, %edx	# 14128	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %edx	# 4633	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %edx	# 13668	[c=5 l=6]  *andsi_1_zext
+	cmpb	$0, 1080(%rbx,%rdx)	# 4636	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L952	# 4637	[c=13 l=6]  *jcc
+.L951:
+	movq	1040(%rbx), %rdx	# 4641	[c=9 l=7]  *movdi_internal/3
+	movslq	%esi, %rsi	# 4640	[c=4 l=3]  *extendsidi2_rex64/1
+	movb	%r15b, (%rdx,%rsi)	# 4642	[c=4 l=4]  *movqi_internal/8
+.L953:
+	movl	$61, %edx	# 4654	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%rbx), %edx	# 4655	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %edx	# 4656	[c=13 l=6]  *cmpsi_1/1
+	jb	.L954	# 4657	[c=13 l=2]  *jcc
+	cmpb	$1, 1081(%rbx)	# 4661	[c=13 l=7]  *cmpqi_1/0
+	ja	.L1742	# 4662	[c=13 l=6]  *jcc
+.L954:
+	movq	1040(%rbx), %rdx	# 4673	[c=9 l=7]  *movdi_internal/3
+	movb	%al, 61(%rdx)	# 4674	[c=4 l=3]  *movqi_internal/8
+.L955:
+	movl	$62, %edx	# 4678	[c=4 l=5]  *movsi_internal/0
+	sarl	$8, %eax	# 4677	[c=4 l=3]  *ashrsi3_1/0
+	subl	5176(%rbx), %edx	# 4679	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %edx	# 4680	[c=13 l=6]  *cmpsi_1/1
+	jb	.L956	# 4681	[c=13 l=2]  *jcc
+	cmpb	$1, 1081(%rbx)	# 4685	[c=13 l=7]  *cmpqi_1/0
+	ja	.L1743	# 4686	[c=13 l=6]  *jcc
+.L956:
+	movq	1040(%rbx), %rdx	# 4697	[c=9 l=7]  *movdi_internal/3
+	movb	%al, 62(%rdx)	# 4698	[c=4 l=3]  *movqi_internal/8
+.L957:
+	movl	(%rbx), %r15d	# 4701	[c=6 l=3]  *zero_extendsidi2/3
+	movq	%r10, %rcx	# 17598	[c=4 l=3]  *movdi_internal/3
+	movq	%r15, %rdx	# 16747	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 4703	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 4705	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%r15), %eax	# 4706	[c=13 l=5]  *zero_extendqisi2/0
+	movq	(%r15), %r14	# 4709	[c=5 l=3]  *movdi_internal/3
+	addl	%edx, %eax	# 4707	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 17599	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 4708	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 17600	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 17601	[c=4 l=3]  *indirect_jump
+.L1728:
+	cmpq	$0, 10960(%rbx)	# 142	[c=13 l=8]  *cmpdi_ccno_1/1
+	je	.L615	# 143	[c=13 l=2]  *jcc
+	movl	116(%rbx), %esi	# 145	[c=9 l=3]  *movsi_internal/0
+	movq	%rbx, %rdi	# 148	[c=4 l=3]  *movdi_internal/3
+	call	jit_forget@PLT	# 149	[c=0 l=5]  *call
+	leaq	flag_update_table_sub8(%rip), %r11	# 14930	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 14928	[c=1 l=7]  *movdi_internal/4
+.L615:
+	movl	116(%rbx), %r15d	# 152	[c=9 l=4]  *movsi_internal/0
+	leaq	handler.2(%rip), %r14	# 12271	[c=1 l=7]  *movdi_internal/4
+	leaq	.L618(%rip), %rbp	# 174	[c=1 l=7]  *movdi_internal/4
+	leaq	.L633(%rip), %r13	# 299	[c=1 l=7]  *movdi_internal/4
+	cmpl	120(%rbx), %r15d	# 153	[c=13 l=4]  *cmpsi_1/1
+	jnb	.L634	# 154	[c=13 l=6]  *jcc
+	movq	%r12, (%rsp)	# 13731	[c=4 l=4]  *movdi_internal/5
+	movq	%r14, %r12	# 13732	[c=4 l=3]  *movdi_internal/3
+	jmp	.L616	# 18425	[c=1 l=2]  jump
+	.p2align 4,,10
+	.p2align 3
+.L1746:
+	movq	%rbp, (%r14)	# 175	[c=4 l=3]  *movdi_internal/5
+.L619:
+	movl	584(%rbx), %eax	# 18393	[c=9 l=6]  *movsi_internal/0
+	testl	%eax, %eax	# 18394	[c=4 l=2]  *cmpsi_ccno_1/0
+	jne	.L1744	# 283	[c=13 l=2]  *jcc
+.L631:
+	addl	$1, %r15d	# 303	[c=4 l=4]  *addsi_1/0
+	cmpl	120(%rbx), %r15d	# 304	[c=13 l=4]  *cmpsi_1/1
+	jnb	.L1745	# 305	[c=13 l=6]  *jcc
+.L616:
+	movl	%r15d, %r14d	# 162	[c=1 l=3]  *zero_extendsidi2/3
+	salq	$4, %r14	# 163	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r14	# 165	[c=13 l=7]  *adddi_1/1
+	movzbl	8(%r14), %eax	# 168	[c=13 l=5]  zero_extendqidi2/0
+	cmpb	$0, 11(%r14)	# 171	[c=13 l=5]  *cmpqi_ccno_1/1
+	movq	(%r12,%rax,8), %rax	# 169	[c=10 l=4]  *movdi_internal/3
+	movq	%rax, (%r14)	# 170	[c=4 l=3]  *movdi_internal/5
+	je	.L1746	# 172	[c=13 l=2]  *jcc
+	movl	552(%rbx), %edx	# 18397	[c=9 l=6]  *movsi_internal/0
+	testl	%edx, %edx	# 18398	[c=4 l=2]  *cmpsi_ccno_1/0
+	jne	.L1747	# 181	[c=13 l=6]  *jcc
+.L620:
+	cmpq	$0, 10960(%rbx)	# 197	[c=13 l=8]  *cmpdi_ccno_1/1
+	je	.L622	# 198	[c=13 l=2]  *jcc
+	movl	%r15d, %esi	# 200	[c=4 l=3]  *movsi_internal/0
+	movq	%rbx, %rdi	# 201	[c=4 l=3]  *movdi_internal/3
+	call	jit_candidate@PLT	# 202	[c=10 l=5]  *call_value
+	leaq	flag_update_table_add8(%rip), %r10	# 14934	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_sub8(%rip), %r11	# 14936	[c=1 l=7]  *movdi_internal/4
+	testb	%al, %al	# 204	[c=4 l=2]  *cmpqi_ccno_1/0
+	je	.L622	# 205	[c=13 l=2]  *jcc
+	leaq	.L623(%rip), %rax	# 208	[c=1 l=7]  *movdi_internal/4
+	movq	%rax, (%r14)	# 13826	[c=4 l=3]  *movdi_internal/5
+	jmp	.L619	# 18431	[c=1 l=2]  jump
+	.p2align 4,,10
+	.p2align 3
+.L1744:
+	movl	%r15d, %esi	# 289	[c=4 l=3]  *movsi_internal/0
+	movq	%rbx, %rdi	# 290	[c=4 l=3]  *movdi_internal/3
+	call	hle_routine@PLT	# 291	[c=10 l=5]  *call_value
+	leaq	flag_update_table_add8(%rip), %r10	# 14942	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_sub8(%rip), %r11	# 14944	[c=1 l=7]  *movdi_internal/4
+	testq	%rax, %rax	# 294	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L631	# 295	[c=13 l=6]  *jcc
+	movq	(%r14), %rcx	# 297	[c=5 l=3]  *movdi_internal/3
+	movq	%rcx, 40(%rax)	# 298	[c=4 l=4]  *movdi_internal/5
+	movq	%r13, (%r14)	# 300	[c=4 l=3]  *movdi_internal/5
+	jmp	.L631	# 18433	[c=1 l=5]  jump
+	.p2align 4,,10
+	.p2align 3
+.L622:
+	movl	536(%rbx), %eax	# 18395	[c=9 l=6]  *movsi_internal/0
+	testl	%eax, %eax	# 18396	[c=4 l=2]  *cmpsi_ccno_1/0
+	je	.L624	# 214	[c=13 l=2]  *jcc
+	leaq	.L625(%rip), %rax	# 217	[c=1 l=7]  *movdi_internal/4
+	movq	%rax, (%r14)	# 13827	[c=4 l=3]  *movdi_internal/5
+	jmp	.L619	# 18435	[c=1 l=5]  jump
+.L1747:
+	leaq	108(%rsp), %rsi	# 16414	[c=4 l=5]  *leadi
+	movq	%r14, %rdi	# 185	[c=4 l=3]  *movdi_internal/3
+	call	delay_loop	# 186	[c=10 l=5]  *call_value
+	leaq	flag_update_table_add8(%rip), %r10	# 14932	[c=1 l=7]  *movdi_internal/4
+	testl	%eax, %eax	# 188	[c=4 l=2]  *cmpsi_ccno_1/0
+	je	.L620	# 189	[c=13 l=6]  *jcc
+	leaq	.L621(%rip), %rax	# 192	[c=1 l=7]  *movdi_internal/4
+	movq	%rax, (%r14)	# 13825	[c=4 l=3]  *movdi_internal/5
+	jmp	.L619	# 18437	[c=1 l=5]  jump
+.L624:
+	cmpl	$0, 520(%rbx)	# 222	[c=13 l=7]  *cmpsi_ccno_1/1
+	je	.L619	# 223	[c=13 l=6]  *jcc
+	cmpb	$0, 11(%r14)	# 225	[c=13 l=5]  *cmpqi_ccno_1/1
+	je	.L619	# 226	[c=13 l=6]  *jcc
+	movzbl	8(%r14), %ecx	# 228	[c=9 l=5]  *movqi_internal/4
+	cmpb	$25, %cl	# 231	[c=4 l=3]  *cmpqi_1/0
+	jbe	.L1748	# 232	[c=13 l=6]  *jcc
+	subl	$28, %ecx	# 16411	[c=4 l=3]  *addsi_1/0
+	cmpb	$60, %cl	# 263	[c=4 l=3]  *cmpqi_1/0
+	ja	.L628	# 264	[c=13 l=2]  *jcc
+	movabsq	$2303723150795361347, %rax	# 238	[c=1 l=10]  *movdi_internal/4
+	shrq	%cl, %rax	# 239	[c=4 l=3]  *lshrdi3_1/0
+	testb	$1, %al	# 16413	[c=4 l=2]  *testqi_1_maybe_si/1
+	jne	.L619	# 242	[c=13 l=6]  *jcc
+.L628:
+	movq	%r14, %rsi	# 267	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rdi	# 268	[c=4 l=3]  *movdi_internal/3
+	call	fuse_lookup	# 269	[c=10 l=5]  *call_value
+	leaq	flag_update_table_add8(%rip), %r10	# 14938	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_sub8(%rip), %r11	# 14940	[c=1 l=7]  *movdi_internal/4
+	testl	%eax, %eax	# 273	[c=4 l=2]  *cmpsi_ccno_1/0
+	js	.L619	# 274	[c=13 l=6]  *jcc
+	cltq	# 277	[c=4 l=2]  *extendsidi2_rex64/0
+	leaq	fused.1(%rip), %rcx	# 13685	[c=1 l=7]  *movdi_internal/4
+	movq	(%rcx,%rax,8), %rax	# 278	[c=10 l=4]  *movdi_internal/3
+	movq	%rax, (%r14)	# 279	[c=4 l=3]  *movdi_internal/5
+	jmp	.L619	# 18440	[c=1 l=5]  jump
+.L1745:
+	movq	(%rsp), %r12	# 13734	[c=5 l=4]  *movdi_internal/3
+.L634:
+	movq	$0, 116(%rbx)	# 157	[c=4 l=8]  *movv2si_internal/4
+	jmp	.L614	# 18442	[c=1 l=5]  jump
+.L661:
+	andb	(%r14), %sil	# 693	[c=9 l=3]  *andqi_1/1
+	orb	(%rcx,%rax), %sil	# 698	[c=13 l=4]  *iorqi_1/1
+	leaq	101(%rbx), %rax	# 16407	[c=4 l=4]  *leadi
+	orl	$63, %edi	# 16406	[c=4 l=3]  *iorsi_1/0
+	movb	%sil, 101(%rbx)	# 699	[c=4 l=4]  *movqi_internal/8
+	jmp	.L662	# 18444	[c=1 l=5]  jump
+.L1726:
+	call	jit_init@PLT	# 97	[c=10 l=5]  *call_value
+	testb	%al, %al	# 100	[c=4 l=2]  *cmpqi_ccno_1/0
+	jne	.L610	# 101	[c=13 l=6]  *jcc
+	leaq	.LC42(%rip), %rsi	# 103	[c=1 l=7]  *movdi_internal/4
+	movq	%rbx, %rdi	# 105	[c=4 l=3]  *movdi_internal/3
+	call	qprintf	# 107	[c=0 l=5]  *call
+	jmp	.L610	# 18446	[c=1 l=5]  jump
+.L1734:
+	xorl	%r8d, %r8d	# 18221	[c=4 l=3]  *movdi_xor
+	movl	$1, %ecx	# 7120	[c=4 l=5]  *movsi_internal/0
+	movl	$30, %edx	# 7121	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 7123	[c=4 l=3]  *movdi_internal/3
+	movl	$1, %r9d	# 7118	[c=4 l=6]  *movsi_internal/0
+	call	ramp_indirect	# 7124	[c=0 l=5]  *call
+	leaq	flag_update_table_add8(%rip), %r10	# 15609	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_sub8(%rip), %r11	# 15611	[c=1 l=7]  *movdi_internal/4
+	jmp	.L1158	# 18448	[c=1 l=5]  jump
+.L1741:
+	movl	$61, %esi	# 4578	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 4579	[c=4 l=3]  *movdi_internal/3
+	call	data_read_mapped	# 4580	[c=10 l=5]  *call_value
+	leaq	flag_update_table_add8(%rip), %r10	# 15285	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_sub8(%rip), %r11	# 15287	[c=1 l=7]  *movdi_internal/4
+	movl	%eax, %edx	# 4581	[c=4 l=2]  *movsi_internal/0
+	movl	$62, %eax	# 4582	[c=4 l=5]  *movsi_internal/0
+	subl	%r13d, %eax	# 4583	[c=4 l=3]  *subsi_1/0
+	cmpl	%r14d, %eax	# 4584	[c=4 l=3]  *cmpsi_1/0
+	jb	.L1749	# 4585	[c=13 l=6]  *jcc
+.L948:
+	movl	$62, %esi	# 4604	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 4605	[c=4 l=3]  *movdi_internal/3
+	movl	%edx, 16(%rsp)	# 15288	[c=4 l=4]  *movsi_internal/1
+	call	data_read_mapped	# 4606	[c=10 l=5]  *call_value
+	movl	16(%rsp), %edx	# 15289	[c=9 l=4]  *movsi_internal/0
+	leaq	flag_update_table_add8(%rip), %r10	# 15291	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_sub8(%rip), %r11	# 15293	[c=1 l=7]  *movdi_internal/4
+	movl	%eax, %esi	# 4607	[c=4 l=2]  *movsi_internal/0
+	jmp	.L949	# 18451	[c=1 l=5]  jump
+.L1148:
+	movzbl	%cl, %edx	# 7029	[c=4 l=3]  *zero_extendqisi2/0
+	movl	%r13d, %esi	# 7031	[c=4 l=3]  *movsi_internal/0
+	movq	%rbx, %rdi	# 7032	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 7033	[c=0 l=5]  *call
+	leaq	flag_update_table_sub8(%rip), %r11	# 15599	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 15597	[c=1 l=7]  *movdi_internal/4
+	jmp	.L1149	# 18453	[c=1 l=5]  jump
+.L939:
+	movzwl	12(%r15), %esi	# 4501	[c=13 l=5]  zero_extendhidi2/0
+	movzbl	10(%r15), %edx	# 4503	[c=13 l=5]  zero_extendqidi2/0
+	movq	%rsi, %rax	# 16744	[c=4 l=3]  *movdi_internal/3
+	movzbl	1004(%rbx,%rdx), %ecx	# 4504	[c=10 l=8]  *movqi_internal/4
+	movl	%esi, %edx	# 14122	[c=4 l=2]  *movsi_internal/0
+	subl	5176(%rbx), %edx	# 4506	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %edx	# 4507	[c=13 l=6]  *cmpsi_1/1
+	jb	.L940	# 4508	[c=13 l=2]  *jcc
+	movl	%esi, %edx	# 14124	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %edx	# 4511	[c=4 l=3]  *ashrsi3_1/0
+	movslq	%edx, %rdx	# 4512	[c=4 l=3]  *extendsidi2_rex64/1
+	cmpb	$0, 1080(%rbx,%rdx)	# 4513	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L941	# 4514	[c=13 l=6]  *jcc
+.L940:
+	movq	1040(%rbx), %rdx	# 4518	[c=9 l=7]  *movdi_internal/3
+	movb	%cl, (%rdx,%rax)	# 4519	[c=4 l=3]  *movqi_internal/8
+.L942:
+	movl	(%rbx), %r15d	# 4531	[c=6 l=3]  *zero_extendsidi2/3
+	movq	%r10, %rcx	# 17614	[c=4 l=3]  *movdi_internal/3
+	movq	%r15, %rdx	# 16745	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 4533	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 4535	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%r15), %eax	# 4536	[c=13 l=5]  *zero_extendqisi2/0
+	movq	(%r15), %r14	# 4539	[c=5 l=3]  *movdi_internal/3
+	addl	%edx, %eax	# 4537	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 17615	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 4538	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 17616	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 17617	[c=4 l=3]  *indirect_jump
+.L642:
+	movzbl	100(%rbx), %edx	# 429	[c=13 l=4]  *zero_extendqisi2/0
+	movl	$2, 96(%rbx)	# 427	[c=4 l=7]  *movsi_internal/1
+	movzbl	10(%r15), %eax	# 428	[c=9 l=5]  *movqi_internal/4
+	testb	%dl, %dl	# 430	[c=4 l=2]  *cmpqi_ccno_1/0
+	je	.L643	# 431	[c=13 l=2]  *jcc
+	movq	104(%rbx), %rcx	# 434	[c=9 l=4]  *movdi_internal/3
+	movq	1040(%rbx), %rsi	# 433	[c=9 l=7]  *movdi_internal/3
+	movzbl	(%rcx), %edi	# 18388	[c=5 l=3]  *movqi_internal/4
+	andl	%edx, %edi	# 19124	[c=4 l=2]  *andsi_1/0
+	notl	%edx	# 439	[c=4 l=2]  *one_cmplsi2_1/0
+	movzbl	%dil, %ecx	# 13836	[c=4 l=4]  *zero_extendqisi2/0
+	movzbl	63(%rsi), %edi	# 437	[c=13 l=4]  *zero_extendqisi2/0
+	andl	%edi, %edx	# 440	[c=4 l=2]  *andsi_1/0
+	orl	%ecx, %edx	# 441	[c=4 l=2]  *iorsi_1/0
+	movb	%dl, 63(%rsi)	# 442	[c=4 l=3]  *movqi_internal/8
+	movb	$0, 100(%rbx)	# 443	[c=4 l=4]  *movqi_internal/8
+.L643:
+	subl	$26, %eax	# 16409	[c=4 l=3]  *addsi_1/0
+	cmpb	$5, %al	# 449	[c=4 l=2]  *cmpqi_1/0
+	ja	.L644	# 450	[c=13 l=6]  *jcc
+	leaq	.L646(%rip), %rdx	# 452	[c=1 l=7]  *movdi_internal/4
+	movzbl	%al, %eax	# 451	[c=4 l=3]  zero_extendqidi2/0
+	movslq	(%rdx,%rax,4), %rax	# 454	[c=14 l=4]  *extendsidi2_rex64/1
+	addq	%rdx, %rax	# 456	[c=4 l=3]  *adddi_1/0
+	jmp	*%rax	# 457	[c=4 l=2]  *tablejump_1
+	.section	.rodata
+	.align 4
+	.align 4
+.L646:
+	.long	.L651-.L646
+	.long	.L650-.L646
+	.long	.L649-.L646
+	.long	.L648-.L646
+	.long	.L647-.L646
+	.long	.L645-.L646
+	.text
+.L958:
+	movzwl	12(%r15), %r13d	# 4715	[c=9 l=5]  *movhi_internal/2
+	movl	5176(%rbx), %r15d	# 4716	[c=9 l=7]  *movsi_internal/0
+	movl	$61, %eax	# 4718	[c=4 l=5]  *movsi_internal/0
+	movl	$2, 96(%rbx)	# 4714	[c=4 l=7]  *movsi_internal/1
+	movl	5180(%rbx), %edx	# 4717	[c=9 l=6]  *movsi_internal/0
+	subl	%r15d, %eax	# 4719	[c=4 l=3]  *subsi_1/0
+	cmpl	%edx, %eax	# 4720	[c=4 l=2]  *cmpsi_1/0
+	jb	.L959	# 4721	[c=13 l=6]  *jcc
+	cmpb	$1, 1081(%rbx)	# 4725	[c=13 l=7]  *cmpqi_1/0
+	ja	.L1750	# 4726	[c=13 l=6]  *jcc
+	movq	1040(%rbx), %rax	# 12049	[c=9 l=7]  *movdi_internal/3
+	movzbl	61(%rax), %ecx	# 12050	[c=13 l=4]  *zero_extendqisi2/0
+.L961:
+	movzbl	62(%rax), %r14d	# 4763	[c=13 l=5]  *zero_extendqisi2/0
+.L963:
+	sall	$8, %r14d	# 4766	[c=4 l=4]  *ashlsi3_1/0
+	movzbl	840(%rbx), %eax	# 4771	[c=13 l=7]  *zero_extendqisi2/0
+	orl	%ecx, %r14d	# 4767	[c=4 l=3]  *iorsi_1/0
+	movl	996(%rbx), %ecx	# 4769	[c=9 l=6]  *movsi_internal/0
+	leal	1(%rcx,%rax), %eax	# 4772	[c=5 l=4]  *leasi
+	cmpl	%eax, %r14d	# 4773	[c=4 l=3]  *cmpsi_1/0
+	jb	.L1751	# 4774	[c=13 l=6]  *jcc
+	movl	%r14d, %eax	# 14130	[c=4 l=3]  *movsi_internal/0
+	movl	(%rbx), %esi	# 4782	[c=5 l=2]  *movsi_internal/0
+	leal	-1(%r14), %ecx	# 16298	[c=4 l=4]  *leasi
+	subl	%r15d, %eax	# 4784	[c=4 l=3]  *subsi_1/0
+	cmpl	%edx, %eax	# 4785	[c=4 l=2]  *cmpsi_1/0
+	jb	.L965	# 4786	[c=13 l=2]  *jcc
+	movl	%r14d, %eax	# 14132	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %eax	# 4788	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 13667	[c=5 l=5]  *andsi_1_zext
+	cmpb	$0, 1080(%rbx,%rax)	# 4791	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L966	# 4792	[c=13 l=6]  *jcc
+.L965:
+	movq	1040(%rbx), %rdx	# 4796	[c=9 l=7]  *movdi_internal/3
+	movslq	%r14d, %rax	# 4795	[c=4 l=3]  *extendsidi2_rex64/1
+	movb	%sil, (%rdx,%rax)	# 4797	[c=4 l=4]  *movqi_internal/8
+.L967:
+	movl	(%rbx), %edx	# 14134	[c=5 l=2]  *movsi_internal/0
+	movl	%ecx, %eax	# 14136	[c=4 l=2]  *movsi_internal/0
+	leal	-2(%r14), %r15d	# 16297	[c=4 l=4]  *leasi
+	subl	5176(%rbx), %eax	# 4811	[c=13 l=6]  *subsi_1/1
+	shrl	$8, %edx	# 4809	[c=4 l=3]  *lshrsi3_1/0
+	cmpl	5180(%rbx), %eax	# 4812	[c=13 l=6]  *cmpsi_1/1
+	jb	.L968	# 4813	[c=13 l=2]  *jcc
+	movl	%ecx, %eax	# 14138	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %eax	# 4815	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 13666	[c=5 l=5]  *andsi_1_zext
+	cmpb	$0, 1080(%rbx,%rax)	# 4818	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L969	# 4819	[c=13 l=6]  *jcc
+.L968:
+	movq	1040(%rbx), %rax	# 4823	[c=9 l=7]  *movdi_internal/3
+	movslq	%ecx, %rcx	# 4822	[c=4 l=3]  *extendsidi2_rex64/1
+	movb	%dl, (%rax,%rcx)	# 4824	[c=4 l=3]  *movqi_internal/8
+.L970:
+	cmpb	$0, 840(%rbx)	# 4835	[c=13 l=7]  *cmpqi_ccno_1/1
+	je	.L971	# 4836	[c=13 l=2]  *jcc
+	movl	(%rbx), %edx	# 14140	[c=5 l=2]  *movsi_internal/0
+	movl	%r15d, %eax	# 14142	[c=4 l=3]  *movsi_internal/0
+	subl	$3, %r14d	# 4840	[c=4 l=4]  *addsi_1/0
+	subl	5176(%rbx), %eax	# 4841	[c=13 l=6]  *subsi_1/1
+	shrl	$16, %edx	# 4839	[c=4 l=3]  *lshrsi3_1/0
+	cmpl	5180(%rbx), %eax	# 4842	[c=13 l=6]  *cmpsi_1/1
+	jb	.L972	# 4843	[c=13 l=2]  *jcc
+	movl	%r15d, %eax	# 14144	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %eax	# 4845	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 13665	[c=5 l=5]  *andsi_1_zext
+	cmpb	$0, 1080(%rbx,%rax)	# 4848	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L973	# 4849	[c=13 l=6]  *jcc
+.L972:
+	movq	1040(%rbx), %rcx	# 4853	[c=9 l=7]  *movdi_internal/3
+	movslq	%r15d, %rax	# 4852	[c=4 l=3]  *extendsidi2_rex64/1
+	movb	%dl, (%rcx,%rax)	# 4854	[c=4 l=3]  *movqi_internal/8
+.L974:
+	movl	%r14d, %r15d	# 26	[c=4 l=3]  *movsi_internal/0
+.L971:
+	movl	$61, %eax	# 4869	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%rbx), %eax	# 4870	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %eax	# 4871	[c=13 l=6]  *cmpsi_1/1
+	jb	.L975	# 4872	[c=13 l=2]  *jcc
+	cmpb	$1, 1081(%rbx)	# 4876	[c=13 l=7]  *cmpqi_1/0
+	ja	.L1752	# 4877	[c=13 l=6]  *jcc
+.L975:
+	movq	1040(%rbx), %rax	# 4888	[c=9 l=7]  *movdi_internal/3
+	movb	%r15b, 61(%rax)	# 4889	[c=4 l=4]  *movqi_internal/8
+.L976:
+	movl	%r15d, %eax	# 14146	[c=4 l=3]  *movsi_internal/0
+	movl	$62, %edx	# 4893	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%rbx), %edx	# 4894	[c=13 l=6]  *subsi_1/1
+	sarl	$8, %eax	# 4892	[c=4 l=3]  *ashrsi3_1/0
+	cmpl	5180(%rbx), %edx	# 4895	[c=13 l=6]  *cmpsi_1/1
+	jb	.L977	# 4896	[c=13 l=2]  *jcc
+	cmpb	$1, 1081(%rbx)	# 4900	[c=13 l=7]  *cmpqi_1/0
+	ja	.L1753	# 4901	[c=13 l=6]  *jcc
+.L977:
+	movq	1040(%rbx), %rdx	# 4912	[c=9 l=7]  *movdi_internal/3
+	movb	%al, 62(%rdx)	# 4913	[c=4 l=3]  *movqi_internal/8
+.L978:
+	movq	(%rsp), %rdi	# 14148	[c=5 l=4]  *movdi_internal/3
+	movswl	%r13w, %eax	# 4916	[c=4 l=4]  extendhisi2/1
+	addl	(%rbx), %eax	# 4918	[c=9 l=2]  *addsi_1/1
+	andl	992(%rbx), %eax	# 4921	[c=13 l=6]  *andsi_1/1
+	movl	%eax, (%rbx)	# 4922	[c=4 l=2]  *movsi_internal/1
+	leaq	-1(%rdi), %rdx	# 16296	[c=4 l=4]  *leadi
+	movzbl	840(%rbx), %eax	# 4923	[c=13 l=7]  zero_extendqidi2/0
+	addq	48(%rbx), %rax	# 4925	[c=13 l=4]  *adddi_1/1
+	movq	%rax, 48(%rbx)	# 4926	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rbp, %rdx	# 4928	[c=4 l=3]  *cmpdi_1/0
+	jb	.L680	# 4929	[c=13 l=6]  *jcc
+	cmpq	56(%rbx), %rax	# 4931	[c=13 l=4]  *cmpdi_1/1
+	jnb	.L1754	# 4932	[c=13 l=6]  *jcc
+.L979:
+	movl	(%rbx), %r15d	# 4939	[c=6 l=3]  *zero_extendsidi2/3
+	movl	$1, 96(%rbx)	# 4944	[c=4 l=7]  *movsi_internal/1
+	movq	%r10, %rcx	# 17590	[c=4 l=3]  *movdi_internal/3
+	movq	%r15, %rdx	# 16748	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 4941	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 4943	[c=13 l=7]  *adddi_1/1
+	movzbl	11(%r15), %eax	# 4945	[c=13 l=5]  zero_extendqidi2/0
+	movq	(%r15), %r14	# 4953	[c=5 l=3]  *movdi_internal/3
+	addq	%rax, %rbp	# 4946	[c=4 l=3]  *adddi_1/0
+	movzwl	14(%r15), %eax	# 4948	[c=13 l=5]  zero_extendhidi2/0
+	addq	%rax, 48(%rbx)	# 4949	[c=13 l=4]  *adddi_1/0
+	movq	%rbp, 40(%rbx)	# 4947	[c=4 l=4]  *movdi_internal/5
+	movzbl	9(%r15), %eax	# 4950	[c=13 l=5]  *zero_extendqisi2/0
+	addl	%edx, %eax	# 4951	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 17591	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 4952	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 17592	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 17593	[c=4 l=3]  *indirect_jump
+.L690:
+	movl	5176(%rbx), %edx	# 1315	[c=9 l=6]  *movsi_internal/0
+	movl	$61, %eax	# 1317	[c=4 l=5]  *movsi_internal/0
+	movl	5180(%rbx), %ecx	# 1316	[c=9 l=6]  *movsi_internal/0
+	movl	$2, 96(%rbx)	# 1312	[c=4 l=7]  *movsi_internal/1
+	movzwl	12(%r15), %r14d	# 1313	[c=13 l=5]  *zero_extendhisi2/0
+	movzbl	10(%r15), %r13d	# 1314	[c=13 l=5]  *zero_extendqisi2/0
+	subl	%edx, %eax	# 1318	[c=4 l=2]  *subsi_1/0
+	cmpl	%ecx, %eax	# 1319	[c=4 l=2]  *cmpsi_1/0
+	jb	.L691	# 1320	[c=13 l=6]  *jcc
+	cmpb	$1, 1081(%rbx)	# 1324	[c=13 l=7]  *cmpqi_1/0
+	ja	.L1755	# 1325	[c=13 l=6]  *jcc
+	movq	1040(%rbx), %rax	# 12025	[c=9 l=7]  *movdi_internal/3
+	movzbl	61(%rax), %r8d	# 12026	[c=13 l=5]  *zero_extendqisi2/0
+.L693:
+	movzbl	62(%rax), %r15d	# 1362	[c=13 l=5]  *zero_extendqisi2/0
+.L695:
+	movl	996(%rbx), %esi	# 1368	[c=9 l=6]  *movsi_internal/0
+	movzbl	840(%rbx), %eax	# 1370	[c=13 l=7]  *zero_extendqisi2/0
+	sall	$8, %r15d	# 1365	[c=4 l=4]  *ashlsi3_1/0
+	orl	%r8d, %r15d	# 1366	[c=4 l=3]  *iorsi_1/0
+	leal	1(%rsi,%rax), %eax	# 1371	[c=5 l=4]  *leasi
+	cmpl	%eax, %r15d	# 1372	[c=4 l=3]  *cmpsi_1/0
+	jb	.L1582	# 1373	[c=13 l=6]  *jcc
+	movl	%r15d, %eax	# 13882	[c=4 l=3]  *movsi_internal/0
+	movl	(%rbx), %esi	# 1381	[c=5 l=2]  *movsi_internal/0
+	leal	-1(%r15), %r8d	# 16374	[c=4 l=4]  *leasi
+	subl	%edx, %eax	# 1383	[c=4 l=2]  *subsi_1/0
+	cmpl	%ecx, %eax	# 1384	[c=4 l=2]  *cmpsi_1/0
+	jb	.L697	# 1385	[c=13 l=2]  *jcc
+	movl	%r15d, %eax	# 13884	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %eax	# 1387	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 13682	[c=5 l=5]  *andsi_1_zext
+	cmpb	$0, 1080(%rbx,%rax)	# 1390	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L698	# 1391	[c=13 l=6]  *jcc
+.L697:
+	movq	1040(%rbx), %rdx	# 1395	[c=9 l=7]  *movdi_internal/3
+	movslq	%r15d, %rax	# 1394	[c=4 l=3]  *extendsidi2_rex64/1
+	movb	%sil, (%rdx,%rax)	# 1396	[c=4 l=4]  *movqi_internal/8
+.L699:
+	movl	(%rbx), %ecx	# 13886	[c=5 l=2]  *movsi_internal/0
+	movl	%r8d, %edx	# 13888	[c=4 l=3]  *movsi_internal/0
+	leal	-2(%r15), %eax	# 16373	[c=4 l=4]  *leasi
+	subl	5176(%rbx), %edx	# 1410	[c=13 l=6]  *subsi_1/1
+	shrl	$8, %ecx	# 1408	[c=4 l=3]  *lshrsi3_1/0
+	cmpl	5180(%rbx), %edx	# 1411	[c=13 l=6]  *cmpsi_1/1
+	jb	.L700	# 1412	[c=13 l=2]  *jcc
+	movl	%r8d, %edx	# 13890	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %edx	# 1414	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %edx	# 13681	[c=5 l=6]  *andsi_1_zext
+	cmpb	$0, 1080(%rbx,%rdx)	# 1417	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L701	# 1418	[c=13 l=6]  *jcc
+.L700:
+	movq	1040(%rbx), %rdx	# 1422	[c=9 l=7]  *movdi_internal/3
+	movslq	%r8d, %r8	# 1421	[c=4 l=3]  *extendsidi2_rex64/1
+	movb	%cl, (%rdx,%r8)	# 1423	[c=4 l=4]  *movqi_internal/8
+.L702:
+	cmpb	$0, 840(%rbx)	# 1434	[c=13 l=7]  *cmpqi_ccno_1/1
+	je	.L703	# 1435	[c=13 l=2]  *jcc
+	movl	(%rbx), %edx	# 13892	[c=5 l=2]  *movsi_internal/0
+	movl	%eax, %ecx	# 13894	[c=4 l=2]  *movsi_internal/0
+	subl	$3, %r15d	# 1439	[c=4 l=4]  *addsi_1/0
+	subl	5176(%rbx), %ecx	# 1440	[c=13 l=6]  *subsi_1/1
+	shrl	$16, %edx	# 1438	[c=4 l=3]  *lshrsi3_1/0
+	cmpl	5180(%rbx), %ecx	# 1441	[c=13 l=6]  *cmpsi_1/1
+	jb	.L704	# 1442	[c=13 l=2]  *jcc
+	movl	%eax, %ecx	# 13896	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %ecx	# 1444	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %ecx	# 13680	[c=5 l=6]  *andsi_1_zext
+	cmpb	$0, 1080(%rbx,%rcx)	# 1447	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L705	# 1448	[c=13 l=6]  *jcc
+.L704:
+	movq	1040(%rbx), %rcx	# 1452	[c=9 l=7]  *movdi_internal/3
+	cltq	# 1451	[c=4 l=2]  *extendsidi2_rex64/0
+	movb	%dl, (%rcx,%rax)	# 1453	[c=4 l=3]  *movqi_internal/8
+.L706:
+	movl	%r15d, %eax	# 11	[c=4 l=3]  *movsi_internal/0
+.L703:
+	movl	$61, %edx	# 1468	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%rbx), %edx	# 1469	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %edx	# 1470	[c=13 l=6]  *cmpsi_1/1
+	jb	.L707	# 1471	[c=13 l=2]  *jcc
+	cmpb	$1, 1081(%rbx)	# 1475	[c=13 l=7]  *cmpqi_1/0
+	ja	.L1756	# 1476	[c=13 l=6]  *jcc
+.L707:
+	movq	1040(%rbx), %rdx	# 1487	[c=9 l=7]  *movdi_internal/3
+	movb	%al, 61(%rdx)	# 1488	[c=4 l=3]  *movqi_internal/8
+.L708:
+	movl	$62, %edx	# 1492	[c=4 l=5]  *movsi_internal/0
+	sarl	$8, %eax	# 1491	[c=4 l=3]  *ashrsi3_1/0
+	subl	5176(%rbx), %edx	# 1493	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %edx	# 1494	[c=13 l=6]  *cmpsi_1/1
+	jb	.L709	# 1495	[c=13 l=2]  *jcc
+	cmpb	$1, 1081(%rbx)	# 1499	[c=13 l=7]  *cmpqi_1/0
+	ja	.L1757	# 1500	[c=13 l=6]  *jcc
+.L709:
+	movq	1040(%rbx), %rdx	# 1511	[c=9 l=7]  *movdi_internal/3
+	movb	%al, 62(%rdx)	# 1512	[c=4 l=3]  *movqi_internal/8
+.L710:
+	sall	$16, %r13d	# 1515	[c=4 l=4]  *ashlsi3_1/0
+	orl	%r14d, %r13d	# 1516	[c=4 l=3]  *iorsi_1/0
+	movl	%r13d, (%rbx)	# 1517	[c=4 l=3]  *movsi_internal/1
+	cmpl	%r13d, 992(%rbx)	# 1518	[c=13 l=7]  *cmpsi_1/0
+	jb	.L1758	# 1519	[c=13 l=6]  *jcc
+	movq	(%rsp), %rdi	# 13898	[c=5 l=4]  *movdi_internal/3
+	movzbl	840(%rbx), %eax	# 1527	[c=13 l=7]  zero_extendqidi2/0
+	addq	48(%rbx), %rax	# 1529	[c=13 l=4]  *adddi_1/1
+	leaq	-1(%rdi), %rdx	# 16372	[c=4 l=4]  *leadi
+	movq	%rax, 48(%rbx)	# 1530	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rbp, %rdx	# 1532	[c=4 l=3]  *cmpdi_1/0
+	jb	.L680	# 1533	[c=13 l=6]  *jcc
+	cmpq	56(%rbx), %rax	# 1535	[c=13 l=4]  *cmpdi_1/1
+	jnb	.L1759	# 1536	[c=13 l=6]  *jcc
+.L712:
+	movl	(%rbx), %r15d	# 1543	[c=6 l=3]  *zero_extendsidi2/3
+	movl	$1, 96(%rbx)	# 1548	[c=4 l=7]  *movsi_internal/1
+	movq	%r10, %rcx	# 18006	[c=4 l=3]  *movdi_internal/3
+	movq	%r15, %rdx	# 16683	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 1545	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 1547	[c=13 l=7]  *adddi_1/1
+	movzbl	11(%r15), %eax	# 1549	[c=13 l=5]  zero_extendqidi2/0
+	movq	(%r15), %r14	# 1557	[c=5 l=3]  *movdi_internal/3
+	addq	%rax, %rbp	# 1550	[c=4 l=3]  *adddi_1/0
+	movzwl	14(%r15), %eax	# 1552	[c=13 l=5]  zero_extendhidi2/0
+	addq	%rax, 48(%rbx)	# 1553	[c=13 l=4]  *adddi_1/0
+	movq	%rbp, 40(%rbx)	# 1551	[c=4 l=4]  *movdi_internal/5
+	movzbl	9(%r15), %eax	# 1554	[c=13 l=5]  *zero_extendqisi2/0
+	addl	%edx, %eax	# 1555	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 18007	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 1556	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 18008	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 18009	[c=4 l=3]  *indirect_jump
+.L739:
+	movl	(%rbx), %eax	# 13955	[c=5 l=2]  *movsi_internal/0
+	movq	1056(%rbx), %rdx	# 2001	[c=9 l=7]  *movdi_internal/3
+	subl	$1, %eax	# 1997	[c=4 l=3]  *addsi_1/0
+	movl	%eax, (%rbx)	# 1998	[c=4 l=2]  *movsi_internal/1
+	addl	%eax, %eax	# 1999	[c=5 l=2]  *ashlsi3_1_zext/0
+	movzwl	(%rdx,%rax), %ecx	# 2002	[c=13 l=4]  *zero_extendhisi2/0
+.L1580:
+	movl	$1, 72(%rbx)	# 2003	[c=4 l=7]  *movsi_internal/1
+	leaq	.LC45(%rip), %rdx	# 2005	[c=1 l=7]  *movdi_internal/4
+	movq	%rbx, %rdi	# 2008	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 18344	[c=4 l=2]  *movdi_xor
+	movl	$8, %esi	# 2007	[c=4 l=5]  *movsi_internal/0
+	call	leave	# 2010	[c=0 l=5]  *call
+.L727:
+	movzbl	10(%r15), %eax	# 1792	[c=13 l=5]  zero_extendqidi2/0
+	movzwl	12(%r15), %esi	# 1790	[c=9 l=5]  *movhi_internal/2
+	movzbl	1004(%rbx,%rax), %eax	# 1793	[c=10 l=8]  *movqi_internal/4
+	movl	%esi, %edx	# 13937	[c=4 l=2]  *movsi_internal/0
+	andl	$136, %edx	# 1798	[c=4 l=6]  *andsi_1/0
+	movl	%eax, %ecx	# 13935	[c=4 l=2]  *movsi_internal/0
+	andl	$136, %ecx	# 1795	[c=4 l=6]  *andsi_1/0
+	leal	(%rdx,%rcx,2), %ecx	# 1799	[c=8 l=3]  *leasi
+	movzbl	%al, %edx	# 1800	[c=4 l=3]  *zero_extendqisi2/0
+	imull	$260, %ecx, %eax	# 1804	[c=12 l=6]  *mulsi3_1/1
+	subl	%esi, %edx	# 1802	[c=4 l=2]  *subsi_1/0
+	movzbl	100(%rbx), %ecx	# 1807	[c=9 l=4]  *movqi_internal/4
+	andl	$511, %edx	# 1803	[c=4 l=6]  *andsi_1/0
+	andl	$7680, %eax	# 1805	[c=4 l=5]  *andsi_1/0
+	orl	%eax, %edx	# 1806	[c=5 l=2]  *iorsi_1_zext
+	movl	%ecx, %eax	# 13939	[c=4 l=2]  *movsi_internal/0
+	andl	$192, %eax	# 1810	[c=4 l=5]  *andsi_2/0
+	jne	.L728	# 1811	[c=13 l=6]  *jcc
+	leaq	flag_update_table_sub8(%rip), %rax	# 1814	[c=1 l=7]  *movdi_internal/4
+	movl	$63, %ecx	# 14	[c=4 l=5]  *movqi_internal/3
+	addq	%rdx, %rax	# 1815	[c=4 l=3]  *adddi_1/0
+.L729:
+	movl	(%rbx), %r15d	# 1834	[c=6 l=3]  *zero_extendsidi2/3
+	movb	%cl, 100(%rbx)	# 1833	[c=4 l=3]  *movqi_internal/8
+	movq	%r10, %rcx	# 17966	[c=4 l=3]  *movdi_internal/3
+	movq	%rax, 104(%rbx)	# 1832	[c=4 l=4]  *movdi_internal/5
+	movq	%r15, %rdx	# 16690	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 1836	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 1838	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%r15), %eax	# 1839	[c=13 l=5]  *zero_extendqisi2/0
+	movq	(%r15), %r14	# 1842	[c=5 l=3]  *movdi_internal/3
+	addl	%edx, %eax	# 1840	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 17967	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 1841	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 17968	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 17969	[c=4 l=3]  *indirect_jump
+.L730:
+	movl	$2, 96(%rbx)	# 1847	[c=4 l=7]  *movsi_internal/1
+	movzwl	12(%r15), %eax	# 1851	[c=13 l=5]  zero_extendhidi2/0
+	movzbl	10(%r15), %edx	# 1849	[c=13 l=5]  zero_extendqidi2/0
+	movzbl	1004(%rbx,%rax), %eax	# 13945	[c=10 l=8]  *movqi_internal/4
+	cmpb	%al, 1004(%rbx,%rdx)	# 1853	[c=14 l=7]  *cmpqi_1/0
+	jne	.L731	# 1854	[c=13 l=2]  *jcc
+	movl	(%rbx), %eax	# 13946	[c=5 l=2]  *movsi_internal/0
+	addq	$1, 48(%rbx)	# 1862	[c=13 l=5]  *adddi_1/0
+	addl	$1, %eax	# 1857	[c=4 l=3]  *addsi_1/0
+	andl	992(%rbx), %eax	# 1860	[c=13 l=6]  *andsi_1/1
+	movl	%eax, (%rbx)	# 1861	[c=4 l=2]  *movsi_internal/1
+.L731:
+	movq	(%rsp), %rax	# 13947	[c=5 l=4]  *movdi_internal/3
+	subq	$1, %rax	# 1865	[c=4 l=4]  *adddi_1/0
+	cmpq	%rbp, %rax	# 1866	[c=4 l=3]  *cmpdi_1/0
+	jb	.L680	# 1867	[c=13 l=6]  *jcc
+	movq	56(%rbx), %rax	# 13948	[c=9 l=4]  *movdi_internal/3
+	cmpq	%rax, 48(%rbx)	# 1870	[c=13 l=4]  *cmpdi_1/0
+	jnb	.L1760	# 1871	[c=13 l=6]  *jcc
+.L732:
+	movl	(%rbx), %r15d	# 1878	[c=6 l=3]  *zero_extendsidi2/3
+	movl	$1, 96(%rbx)	# 1883	[c=4 l=7]  *movsi_internal/1
+	movq	%r10, %rcx	# 17958	[c=4 l=3]  *movdi_internal/3
+	movq	%r15, %rdx	# 16691	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 1880	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 1882	[c=13 l=7]  *adddi_1/1
+	movzbl	11(%r15), %eax	# 1884	[c=13 l=5]  zero_extendqidi2/0
+	movq	(%r15), %r14	# 1892	[c=5 l=3]  *movdi_internal/3
+	addq	%rax, %rbp	# 1885	[c=4 l=3]  *adddi_1/0
+	movzwl	14(%r15), %eax	# 1887	[c=13 l=5]  zero_extendhidi2/0
+	addq	%rax, 48(%rbx)	# 1888	[c=13 l=4]  *adddi_1/0
+	movq	%rbp, 40(%rbx)	# 1886	[c=4 l=4]  *movdi_internal/5
+	movzbl	9(%r15), %eax	# 1889	[c=13 l=5]  *zero_extendqisi2/0
+	addl	%edx, %eax	# 1890	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 17959	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 1891	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 17960	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 17961	[c=4 l=3]  *indirect_jump
+.L778:
+	movl	$59, %eax	# 2437	[c=4 l=5]  *movsi_internal/0
+	movzbl	10(%r15), %r13d	# 2435	[c=13 l=5]  zero_extendqidi2/0
+	movzwl	1034(%rbx), %r14d	# 2436	[c=13 l=8]  *zero_extendhisi2/0
+	subl	5176(%rbx), %eax	# 2438	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %eax	# 2439	[c=13 l=6]  *cmpsi_1/1
+	jb	.L779	# 2440	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%rbx)	# 2442	[c=13 l=7]  *cmpqi_ccno_1/1
+	jne	.L780	# 2443	[c=13 l=6]  *jcc
+.L779:
+	movq	1040(%rbx), %rax	# 2446	[c=9 l=7]  *movdi_internal/3
+	movzbl	59(%rax), %eax	# 2447	[c=13 l=4]  *zero_extendqisi2/0
+.L781:
+	movl	992(%rbx), %edx	# 2458	[c=9 l=6]  *movsi_internal/0
+	sall	$16, %eax	# 2461	[c=4 l=3]  *ashlsi3_1/0
+	movq	%r10, %rcx	# 17910	[c=4 l=3]  *movdi_internal/3
+	orl	%r14d, %eax	# 2462	[c=4 l=3]  *iorsi_1/0
+	leal	1(%rdx,%rdx), %edx	# 2460	[c=8 l=4]  *leasi
+	andl	%edx, %eax	# 2463	[c=4 l=2]  *andsi_1/0
+	movq	1056(%rbx), %rdx	# 2465	[c=9 l=7]  *movdi_internal/3
+	cltq	# 2464	[c=4 l=2]  *extendsidi2_rex64/0
+	movzbl	(%rdx,%rax), %eax	# 2466	[c=9 l=4]  *movqi_internal/4
+	movb	%al, 1004(%rbx,%r13)	# 2468	[c=4 l=8]  *movqi_internal/8
+	movl	(%rbx), %r15d	# 2469	[c=6 l=3]  *zero_extendsidi2/3
+	movq	%r15, %rdx	# 16697	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 2471	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 2473	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%r15), %eax	# 2474	[c=13 l=5]  *zero_extendqisi2/0
+	movq	(%r15), %r14	# 2477	[c=5 l=3]  *movdi_internal/3
+	addl	%edx, %eax	# 2475	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 17911	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 2476	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 17912	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 17913	[c=4 l=3]  *indirect_jump
+.L722:
+	movzbl	10(%r15), %eax	# 1640	[c=13 l=5]  zero_extendqidi2/0
+	leaq	flag_update_table_logical(%rip), %rsi	# 13690	[c=1 l=7]  *movdi_internal/4
+	movzbl	1004(%rbx,%rax), %edx	# 13911	[c=10 l=8]  *movqi_internal/4
+	notl	%edx	# 16368	[c=4 l=2]  *one_cmplsi2_1/0
+	movb	%dl, 1004(%rbx,%rax)	# 1644	[c=4 l=7]  *movqi_internal/8
+	movq	104(%rbx), %rcx	# 1647	[c=9 l=4]  *movdi_internal/3
+	movzbl	%dl, %edx	# 1651	[c=4 l=3]  zero_extendqidi2/0
+	movzbl	100(%rbx), %eax	# 1645	[c=13 l=4]  *zero_extendqisi2/0
+	movl	(%rbx), %r15d	# 1659	[c=6 l=3]  *zero_extendsidi2/3
+	movzbl	(%rcx), %edi	# 18349	[c=5 l=3]  *movqi_internal/4
+	andl	$-32, %eax	# 1646	[c=4 l=3]  *andsi_1/0
+	andl	%eax, %edi	# 19123	[c=4 l=2]  *andsi_1/0
+	orl	$31, %eax	# 16370	[c=4 l=3]  *iorsi_1/0
+	movl	%edi, %ecx	# 13914	[c=4 l=2]  *movqi_internal/1
+	orb	(%rsi,%rdx), %cl	# 1652	[c=13 l=3]  *iorqi_1/1
+	movb	%al, 100(%rbx)	# 1656	[c=4 l=3]  *movqi_internal/8
+	movl	%ecx, %edx	# 13916	[c=4 l=2]  *movqi_internal/0
+	movq	%r10, %rcx	# 17990	[c=4 l=3]  *movdi_internal/3
+	orl	$1, %edx	# 16369	[c=4 l=3]  *iorsi_1/0
+	movb	%dl, 101(%rbx)	# 1654	[c=4 l=3]  *movqi_internal/8
+	leaq	101(%rbx), %rdx	# 16371	[c=4 l=4]  *leadi
+	movq	%rdx, 104(%rbx)	# 1658	[c=4 l=4]  *movdi_internal/5
+	movq	%r15, %rdx	# 16686	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 1661	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 1663	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%r15), %eax	# 1664	[c=13 l=5]  *zero_extendqisi2/0
+	movq	(%r15), %r14	# 1667	[c=5 l=3]  *movdi_internal/3
+	addl	%edx, %eax	# 1665	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 17991	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 1666	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 17992	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 17993	[c=4 l=3]  *indirect_jump
+.L723:
+	movzwl	12(%r15), %edx	# 1676	[c=13 l=5]  zero_extendhidi2/0
+	movzbl	10(%r15), %eax	# 1673	[c=13 l=5]  zero_extendqidi2/0
+	movzbl	1004(%rbx,%rdx), %esi	# 1677	[c=14 l=8]  *zero_extendqisi2/0
+	movzbl	1004(%rbx,%rax), %eax	# 1674	[c=10 l=8]  *movqi_internal/4
+	movl	%esi, %edx	# 13919	[c=4 l=2]  *movsi_internal/0
+	movl	%eax, %ecx	# 13917	[c=4 l=2]  *movsi_internal/0
+	andl	$136, %edx	# 1682	[c=4 l=6]  *andsi_1/0
+	andl	$136, %ecx	# 1679	[c=4 l=6]  *andsi_1/0
+	leal	(%rdx,%rcx,2), %ecx	# 1683	[c=8 l=3]  *leasi
+	movzbl	%al, %edx	# 1684	[c=4 l=3]  *zero_extendqisi2/0
+	imull	$260, %ecx, %eax	# 1688	[c=12 l=6]  *mulsi3_1/1
+	subl	%esi, %edx	# 1686	[c=4 l=2]  *subsi_1/0
+	movzbl	100(%rbx), %ecx	# 1691	[c=9 l=4]  *movqi_internal/4
+	andl	$511, %edx	# 1687	[c=4 l=6]  *andsi_1/0
+	andl	$7680, %eax	# 1689	[c=4 l=5]  *andsi_1/0
+	orl	%eax, %edx	# 1690	[c=5 l=2]  *iorsi_1_zext
+	movl	%ecx, %eax	# 13921	[c=4 l=2]  *movsi_internal/0
+	andl	$192, %eax	# 1694	[c=4 l=5]  *andsi_2/0
+	jne	.L724	# 1695	[c=13 l=6]  *jcc
+	leaq	flag_update_table_sub8(%rip), %rax	# 1698	[c=1 l=7]  *movdi_internal/4
+	movl	$63, %ecx	# 13	[c=4 l=5]  *movqi_internal/3
+	addq	%rdx, %rax	# 1699	[c=4 l=3]  *adddi_1/0
+.L725:
+	movl	(%rbx), %r15d	# 1718	[c=6 l=3]  *zero_extendsidi2/3
+	movb	%cl, 100(%rbx)	# 1717	[c=4 l=3]  *movqi_internal/8
+	movq	%r10, %rcx	# 17982	[c=4 l=3]  *movdi_internal/3
+	movq	%rax, 104(%rbx)	# 1716	[c=4 l=4]  *movdi_internal/5
+	movq	%r15, %rdx	# 16687	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 1720	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 1722	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%r15), %eax	# 1723	[c=13 l=5]  *zero_extendqisi2/0
+	movq	(%r15), %r14	# 1726	[c=5 l=3]  *movdi_internal/3
+	addl	%edx, %eax	# 1724	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 17983	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 1725	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 17984	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 17985	[c=4 l=3]  *indirect_jump
+.L713:
+	movzbl	10(%r15), %r13d	# 1563	[c=13 l=5]  *zero_extendqisi2/0
+	movzwl	12(%r15), %edx	# 1562	[c=13 l=5]  *zero_extendhisi2/0
+	movl	%r13d, %eax	# 13899	[c=4 l=3]  *movsi_internal/0
+	movl	%r13d, %r14d	# 16684	[c=4 l=3]  *movsi_internal/0
+	subl	5176(%rbx), %eax	# 1566	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %eax	# 1567	[c=13 l=6]  *cmpsi_1/1
+	jb	.L714	# 1568	[c=13 l=2]  *jcc
+	movl	%r13d, %eax	# 13901	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %eax	# 1570	[c=4 l=3]  *ashrsi3_1/0
+	cltq	# 1571	[c=4 l=2]  *extendsidi2_rex64/0
+	cmpb	$0, 1080(%rbx,%rax)	# 1572	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L715	# 1573	[c=13 l=6]  *jcc
+.L714:
+	movq	1040(%rbx), %rcx	# 1577	[c=9 l=7]  *movdi_internal/3
+	movzbl	%r14b, %eax	# 1576	[c=4 l=4]  zero_extendqidi2/0
+	movzbl	(%rcx,%rax), %esi	# 1578	[c=13 l=4]  *zero_extendqisi2/0
+.L716:
+	cmpl	6564(%rbx), %r13d	# 1589	[c=13 l=7]  *cmpsi_1/1
+	jnb	.L717	# 1590	[c=13 l=2]  *jcc
+	movslq	%r13d, %rax	# 1592	[c=4 l=3]  *extendsidi2_rex64/1
+	xorl	%ecx, %ecx	# 18351	[c=4 l=2]  *movdi_xor
+	cmpb	$0, 6568(%rbx,%rax)	# 1595	[c=14 l=8]  *cmpqi_ccno_1/1
+	jns	.L717	# 1596	[c=13 l=2]  *jcc
+.L718:
+	movl	%r13d, %eax	# 13907	[c=4 l=3]  *movsi_internal/0
+	subl	5176(%rbx), %eax	# 1603	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %eax	# 1604	[c=13 l=6]  *cmpsi_1/1
+	jb	.L719	# 1605	[c=13 l=2]  *jcc
+	movl	%r13d, %eax	# 13909	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %eax	# 1607	[c=4 l=3]  *ashrsi3_1/0
+	cltq	# 1608	[c=4 l=2]  *extendsidi2_rex64/0
+	cmpb	$0, 1080(%rbx,%rax)	# 1609	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L720	# 1610	[c=13 l=6]  *jcc
+.L719:
+	movq	1040(%rbx), %rdx	# 1614	[c=9 l=7]  *movdi_internal/3
+	movzbl	%r14b, %eax	# 1613	[c=4 l=4]  zero_extendqidi2/0
+	movb	%cl, (%rdx,%rax)	# 1615	[c=4 l=3]  *movqi_internal/8
+.L721:
+	movl	(%rbx), %r15d	# 1626	[c=6 l=3]  *zero_extendsidi2/3
+	movq	%r10, %rcx	# 17998	[c=4 l=3]  *movdi_internal/3
+	movq	%r15, %rdx	# 16685	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 1628	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 1630	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%r15), %eax	# 1631	[c=13 l=5]  *zero_extendqisi2/0
+	movq	(%r15), %r14	# 1634	[c=5 l=3]  *movdi_internal/3
+	addl	%edx, %eax	# 1632	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 17999	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 1633	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 18000	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 18001	[c=4 l=3]  *indirect_jump
+.L717:
+	movl	%edx, %eax	# 13903	[c=4 l=2]  *movsi_internal/0
+	notl	%eax	# 1599	[c=4 l=2]  *one_cmplsi2_1/0
+	andl	%esi, %eax	# 1600	[c=4 l=2]  *andsi_1/0
+	movl	%eax, %ecx	# 13906	[c=4 l=2]  *movsi_internal/0
+	jmp	.L718	# 18466	[c=1 l=2]  jump
+.L733:
+	movl	$2, 96(%rbx)	# 1897	[c=4 l=7]  *movsi_internal/1
+	movzwl	12(%r15), %eax	# 1901	[c=13 l=5]  zero_extendhidi2/0
+	movzbl	10(%r15), %edx	# 1899	[c=13 l=5]  zero_extendqidi2/0
+	movzbl	1004(%rbx,%rax), %eax	# 13949	[c=10 l=8]  *movqi_internal/4
+	cmpb	%al, 1004(%rbx,%rdx)	# 1903	[c=14 l=7]  *cmpqi_1/0
+	jne	.L734	# 1904	[c=13 l=2]  *jcc
+	movl	(%rbx), %eax	# 13950	[c=5 l=2]  *movsi_internal/0
+	addq	$2, 48(%rbx)	# 1912	[c=13 l=5]  *adddi_1/0
+	addl	$2, %eax	# 1907	[c=4 l=3]  *addsi_1/0
+	andl	992(%rbx), %eax	# 1910	[c=13 l=6]  *andsi_1/1
+	movl	%eax, (%rbx)	# 1911	[c=4 l=2]  *movsi_internal/1
+.L734:
+	movq	(%rsp), %rax	# 13951	[c=5 l=4]  *movdi_internal/3
+	subq	$1, %rax	# 1915	[c=4 l=4]  *adddi_1/0
+	cmpq	%rbp, %rax	# 1916	[c=4 l=3]  *cmpdi_1/0
+	jb	.L680	# 1917	[c=13 l=6]  *jcc
+	movq	56(%rbx), %rax	# 13952	[c=9 l=4]  *movdi_internal/3
+	cmpq	%rax, 48(%rbx)	# 1920	[c=13 l=4]  *cmpdi_1/0
+	jnb	.L1761	# 1921	[c=13 l=6]  *jcc
+.L735:
+	movl	(%rbx), %r15d	# 1928	[c=6 l=3]  *zero_extendsidi2/3
+	movl	$1, 96(%rbx)	# 1933	[c=4 l=7]  *movsi_internal/1
+	movq	%r10, %rcx	# 17950	[c=4 l=3]  *movdi_internal/3
+	movq	%r15, %rdx	# 16692	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 1930	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 1932	[c=13 l=7]  *adddi_1/1
+	movzbl	11(%r15), %eax	# 1934	[c=13 l=5]  zero_extendqidi2/0
+	movq	(%r15), %r14	# 1942	[c=5 l=3]  *movdi_internal/3
+	addq	%rax, %rbp	# 1935	[c=4 l=3]  *adddi_1/0
+	movzwl	14(%r15), %eax	# 1937	[c=13 l=5]  zero_extendhidi2/0
+	addq	%rax, 48(%rbx)	# 1938	[c=13 l=4]  *adddi_1/0
+	movq	%rbp, 40(%rbx)	# 1936	[c=4 l=4]  *movdi_internal/5
+	movzbl	9(%r15), %eax	# 1939	[c=13 l=5]  *zero_extendqisi2/0
+	addl	%edx, %eax	# 1940	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 17951	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 1941	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 17952	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 17953	[c=4 l=3]  *indirect_jump
+.L736:
+	movzbl	10(%r15), %ecx	# 1948	[c=13 l=5]  zero_extendqidi2/0
+	movzbl	1004(%rbx,%rcx), %edx	# 1949	[c=10 l=8]  *movqi_internal/4
+	leal	-1(%rdx), %eax	# 16358	[c=4 l=3]  *leasi
+	subl	$1, %edx	# 16359	[c=4 l=3]  *addsi_1/0
+	movb	%dl, 1004(%rbx,%rcx)	# 1955	[c=4 l=7]  *movqi_internal/8
+	movzbl	100(%rbx), %edx	# 1956	[c=9 l=4]  *movqi_internal/4
+	movzbl	%al, %eax	# 1952	[c=4 l=3]  zero_extendqidi2/0
+	movl	%edx, %ecx	# 13953	[c=4 l=2]  *movsi_internal/0
+	andl	$225, %ecx	# 1959	[c=4 l=6]  *andsi_2/0
+	jne	.L737	# 1960	[c=13 l=6]  *jcc
+	leaq	flag_update_table_dec(%rip), %rdx	# 1963	[c=1 l=7]  *movdi_internal/4
+	addq	%rdx, %rax	# 1964	[c=4 l=3]  *adddi_1/0
+	movl	$30, %edx	# 15	[c=4 l=5]  *movqi_internal/3
+.L738:
+	movl	(%rbx), %r15d	# 1983	[c=6 l=3]  *zero_extendsidi2/3
+	movb	%dl, 100(%rbx)	# 1982	[c=4 l=3]  *movqi_internal/8
+	movq	%r10, %rcx	# 17942	[c=4 l=3]  *movdi_internal/3
+	movq	%rax, 104(%rbx)	# 1981	[c=4 l=4]  *movdi_internal/5
+	movq	%r15, %rdx	# 16693	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 1985	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 1987	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%r15), %eax	# 1988	[c=13 l=5]  *zero_extendqisi2/0
+	movq	(%r15), %r14	# 1991	[c=5 l=3]  *movdi_internal/3
+	addl	%edx, %eax	# 1989	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 17943	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 1990	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 17944	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 17945	[c=4 l=3]  *indirect_jump
+.L767:
+	cmpb	$0, 841(%rbx)	# 2302	[c=13 l=7]  *cmpqi_ccno_1/1
+	movl	$2, 96(%rbx)	# 2301	[c=4 l=7]  *movsi_internal/1
+	je	.L1584	# 2303	[c=13 l=6]  *jcc
+	movl	$60, %eax	# 2325	[c=4 l=5]  *movsi_internal/0
+	movzwl	1034(%rbx), %r13d	# 2324	[c=13 l=8]  *zero_extendhisi2/0
+	subl	5176(%rbx), %eax	# 2326	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %eax	# 2327	[c=13 l=6]  *cmpsi_1/1
+	jb	.L769	# 2328	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%rbx)	# 2330	[c=13 l=7]  *cmpqi_ccno_1/1
+	jne	.L770	# 2331	[c=13 l=6]  *jcc
+.L769:
+	movq	1040(%rbx), %rax	# 2334	[c=9 l=7]  *movdi_internal/3
+	movzbl	60(%rax), %esi	# 2335	[c=13 l=4]  *zero_extendqisi2/0
+.L771:
+	sall	$16, %esi	# 2346	[c=4 l=3]  *ashlsi3_1/0
+	orl	%r13d, %esi	# 2347	[c=4 l=3]  *iorsi_1/0
+	movl	%esi, (%rbx)	# 2348	[c=4 l=2]  *movsi_internal/1
+	cmpl	%esi, 992(%rbx)	# 2349	[c=13 l=6]  *cmpsi_1/0
+	jb	.L1583	# 2350	[c=13 l=6]  *jcc
+	movq	(%rsp), %rax	# 13978	[c=5 l=4]  *movdi_internal/3
+	subq	$1, %rax	# 2358	[c=4 l=4]  *adddi_1/0
+	cmpq	%rbp, %rax	# 2359	[c=4 l=3]  *cmpdi_1/0
+	jb	.L680	# 2360	[c=13 l=6]  *jcc
+	movq	56(%rbx), %rax	# 13979	[c=9 l=4]  *movdi_internal/3
+	cmpq	%rax, 48(%rbx)	# 2363	[c=13 l=4]  *cmpdi_1/0
+	jnb	.L1762	# 2364	[c=13 l=6]  *jcc
+.L773:
+	movl	(%rbx), %r15d	# 2371	[c=6 l=3]  *zero_extendsidi2/3
+	movl	$1, 96(%rbx)	# 2376	[c=4 l=7]  *movsi_internal/1
+	movq	%r10, %rcx	# 17926	[c=4 l=3]  *movdi_internal/3
+	movq	%r15, %rdx	# 16695	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 2373	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 2375	[c=13 l=7]  *adddi_1/1
+	movzbl	11(%r15), %eax	# 2377	[c=13 l=5]  zero_extendqidi2/0
+	movq	(%r15), %r14	# 2385	[c=5 l=3]  *movdi_internal/3
+	addq	%rax, %rbp	# 2378	[c=4 l=3]  *adddi_1/0
+	movzwl	14(%r15), %eax	# 2380	[c=13 l=5]  zero_extendhidi2/0
+	addq	%rax, 48(%rbx)	# 2381	[c=13 l=4]  *adddi_1/0
+	movq	%rbp, 40(%rbx)	# 2379	[c=4 l=4]  *movdi_internal/5
+	movzbl	9(%r15), %eax	# 2382	[c=13 l=5]  *zero_extendqisi2/0
+	addl	%edx, %eax	# 2383	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 17927	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 2384	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 17928	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 17929	[c=4 l=3]  *indirect_jump
+.L637:
+	movzwl	12(%r15), %ecx	# 347	[c=13 l=5]  *zero_extendhisi2/0
+	movl	(%rbx), %eax	# 13831	[c=5 l=2]  *movsi_internal/0
+	movl	$2, 96(%rbx)	# 345	[c=4 l=7]  *movsi_internal/1
+	movzbl	10(%r15), %edx	# 346	[c=9 l=5]  *movqi_internal/4
+	subl	%ecx, %eax	# 349	[c=4 l=2]  *subsi_1/0
+	movq	1056(%rbx), %rcx	# 353	[c=9 l=7]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 350	[c=4 l=2]  *movsi_internal/1
+	addl	%eax, %eax	# 351	[c=5 l=2]  *ashlsi3_1_zext/0
+	movzwl	(%rcx,%rax), %ecx	# 354	[c=13 l=4]  *zero_extendhisi2/0
+	cmpb	$1, %dl	# 355	[c=4 l=3]  *cmpqi_1/0
+	je	.L1579	# 356	[c=13 l=6]  *jcc
+	cmpb	$2, %dl	# 358	[c=4 l=3]  *cmpqi_1/0
+	je	.L1580	# 359	[c=13 l=6]  *jcc
+	testb	%dl, %dl	# 361	[c=4 l=2]  *cmpqi_ccno_1/0
+	je	.L1763	# 362	[c=13 l=6]  *jcc
+	leaq	.LC46(%rip), %rdx	# 397	[c=1 l=7]  *movdi_internal/4
+	movl	$8, %esi	# 399	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 400	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 18391	[c=4 l=2]  *movdi_xor
+	call	leave	# 402	[c=0 l=5]  *call
+.L740:
+	cmpb	$0, 841(%rbx)	# 2015	[c=13 l=7]  *cmpqi_ccno_1/1
+	movl	$2, 96(%rbx)	# 2014	[c=4 l=7]  *movsi_internal/1
+	je	.L1584	# 2016	[c=13 l=6]  *jcc
+	movl	5176(%rbx), %r13d	# 2037	[c=9 l=7]  *movsi_internal/0
+	movl	$61, %eax	# 2041	[c=4 l=5]  *movsi_internal/0
+	movl	$62, %edx	# 2039	[c=4 l=5]  *movsi_internal/0
+	movl	5180(%rbx), %r14d	# 2038	[c=9 l=7]  *movsi_internal/0
+	subl	%r13d, %eax	# 2042	[c=4 l=3]  *subsi_1/0
+	subl	%r13d, %edx	# 2040	[c=4 l=3]  *subsi_1/0
+	cmpl	%r14d, %eax	# 2043	[c=4 l=3]  *cmpsi_1/0
+	jb	.L742	# 2044	[c=13 l=6]  *jcc
+	cmpb	$1, 1081(%rbx)	# 2048	[c=13 l=7]  *cmpqi_1/0
+	ja	.L1764	# 2049	[c=13 l=6]  *jcc
+	movq	1040(%rbx), %rax	# 12031	[c=9 l=7]  *movdi_internal/3
+	movzbl	61(%rax), %r15d	# 12032	[c=13 l=5]  *zero_extendqisi2/0
+.L744:
+	movzbl	62(%rax), %eax	# 2082	[c=13 l=4]  *zero_extendqisi2/0
+.L746:
+	sall	$8, %eax	# 2085	[c=4 l=3]  *ashlsi3_1/0
+	movl	996(%rbx), %edx	# 2088	[c=9 l=6]  *movsi_internal/0
+	orl	%eax, %r15d	# 2086	[c=4 l=3]  *iorsi_1/0
+	movzbl	840(%rbx), %eax	# 2090	[c=13 l=7]  *zero_extendqisi2/0
+	leal	1(%rdx,%rax), %eax	# 2091	[c=5 l=4]  *leasi
+	cmpl	%eax, %r15d	# 2092	[c=4 l=3]  *cmpsi_1/0
+	jb	.L1582	# 2093	[c=13 l=6]  *jcc
+	movl	%r15d, %edx	# 13957	[c=4 l=3]  *movsi_internal/0
+	movl	(%rbx), %ecx	# 2101	[c=5 l=2]  *movsi_internal/0
+	leal	-1(%r15), %eax	# 16355	[c=4 l=4]  *leasi
+	subl	%r13d, %edx	# 2103	[c=4 l=3]  *subsi_1/0
+	cmpl	%r14d, %edx	# 2104	[c=4 l=3]  *cmpsi_1/0
+	jb	.L748	# 2105	[c=13 l=2]  *jcc
+	movl	%r15d, %edx	# 13959	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %edx	# 2107	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %edx	# 13679	[c=5 l=6]  *andsi_1_zext
+	cmpb	$0, 1080(%rbx,%rdx)	# 2110	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L749	# 2111	[c=13 l=6]  *jcc
+.L748:
+	movq	1040(%rbx), %rsi	# 2115	[c=9 l=7]  *movdi_internal/3
+	movslq	%r15d, %rdx	# 2114	[c=4 l=3]  *extendsidi2_rex64/1
+	movb	%cl, (%rsi,%rdx)	# 2116	[c=4 l=3]  *movqi_internal/8
+.L750:
+	movl	(%rbx), %ecx	# 13961	[c=5 l=2]  *movsi_internal/0
+	movl	%eax, %edx	# 13963	[c=4 l=2]  *movsi_internal/0
+	leal	-2(%r15), %r13d	# 16354	[c=4 l=4]  *leasi
+	subl	5176(%rbx), %edx	# 2130	[c=13 l=6]  *subsi_1/1
+	shrl	$8, %ecx	# 2128	[c=4 l=3]  *lshrsi3_1/0
+	cmpl	5180(%rbx), %edx	# 2131	[c=13 l=6]  *cmpsi_1/1
+	jb	.L751	# 2132	[c=13 l=2]  *jcc
+	movl	%eax, %edx	# 13965	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %edx	# 2134	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %edx	# 13678	[c=5 l=6]  *andsi_1_zext
+	cmpb	$0, 1080(%rbx,%rdx)	# 2137	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L752	# 2138	[c=13 l=6]  *jcc
+.L751:
+	movq	1040(%rbx), %rdx	# 2142	[c=9 l=7]  *movdi_internal/3
+	cltq	# 2141	[c=4 l=2]  *extendsidi2_rex64/0
+	movb	%cl, (%rdx,%rax)	# 2143	[c=4 l=3]  *movqi_internal/8
+.L753:
+	cmpb	$0, 840(%rbx)	# 2154	[c=13 l=7]  *cmpqi_ccno_1/1
+	je	.L754	# 2155	[c=13 l=2]  *jcc
+	movl	(%rbx), %edx	# 13967	[c=5 l=2]  *movsi_internal/0
+	movl	%r13d, %eax	# 13969	[c=4 l=3]  *movsi_internal/0
+	subl	$3, %r15d	# 2159	[c=4 l=4]  *addsi_1/0
+	subl	5176(%rbx), %eax	# 2160	[c=13 l=6]  *subsi_1/1
+	shrl	$16, %edx	# 2158	[c=4 l=3]  *lshrsi3_1/0
+	cmpl	5180(%rbx), %eax	# 2161	[c=13 l=6]  *cmpsi_1/1
+	jb	.L755	# 2162	[c=13 l=2]  *jcc
+	movl	%r13d, %ecx	# 13971	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %ecx	# 2164	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %ecx	# 13677	[c=5 l=6]  *andsi_1_zext
+	cmpb	$0, 1080(%rbx,%rcx)	# 2167	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L756	# 2168	[c=13 l=6]  *jcc
+.L755:
+	movq	1040(%rbx), %rcx	# 2172	[c=9 l=7]  *movdi_internal/3
+	movslq	%r13d, %rax	# 2171	[c=4 l=3]  *extendsidi2_rex64/1
+	movb	%dl, (%rcx,%rax)	# 2173	[c=4 l=3]  *movqi_internal/8
+.L757:
+	movl	%r15d, %r13d	# 16	[c=4 l=3]  *movsi_internal/0
+.L754:
+	movl	$61, %edx	# 2188	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%rbx), %edx	# 2189	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %edx	# 2190	[c=13 l=6]  *cmpsi_1/1
+	jb	.L758	# 2191	[c=13 l=2]  *jcc
+	cmpb	$1, 1081(%rbx)	# 2195	[c=13 l=7]  *cmpqi_1/0
+	ja	.L1765	# 2196	[c=13 l=6]  *jcc
+.L758:
+	movq	1040(%rbx), %rax	# 2207	[c=9 l=7]  *movdi_internal/3
+	movb	%r13b, 61(%rax)	# 2208	[c=4 l=4]  *movqi_internal/8
+.L759:
+	movl	%r13d, %eax	# 13973	[c=4 l=3]  *movsi_internal/0
+	movl	$62, %edx	# 2212	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%rbx), %edx	# 2213	[c=13 l=6]  *subsi_1/1
+	sarl	$8, %eax	# 2211	[c=4 l=3]  *ashrsi3_1/0
+	cmpl	5180(%rbx), %edx	# 2214	[c=13 l=6]  *cmpsi_1/1
+	jb	.L760	# 2215	[c=13 l=2]  *jcc
+	cmpb	$1, 1081(%rbx)	# 2219	[c=13 l=7]  *cmpqi_1/0
+	ja	.L1766	# 2220	[c=13 l=6]  *jcc
+.L760:
+	movq	1040(%rbx), %rdx	# 2231	[c=9 l=7]  *movdi_internal/3
+	movb	%al, 62(%rdx)	# 2232	[c=4 l=3]  *movqi_internal/8
+.L761:
+	movl	$60, %eax	# 2236	[c=4 l=5]  *movsi_internal/0
+	movzwl	1034(%rbx), %r13d	# 2235	[c=13 l=8]  *zero_extendhisi2/0
+	subl	5176(%rbx), %eax	# 2237	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %eax	# 2238	[c=13 l=6]  *cmpsi_1/1
+	jb	.L762	# 2239	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%rbx)	# 2241	[c=13 l=7]  *cmpqi_ccno_1/1
+	jne	.L763	# 2242	[c=13 l=6]  *jcc
+.L762:
+	movq	1040(%rbx), %rax	# 2245	[c=9 l=7]  *movdi_internal/3
+	movzbl	60(%rax), %esi	# 2246	[c=13 l=4]  *zero_extendqisi2/0
+.L764:
+	sall	$16, %esi	# 2257	[c=4 l=3]  *ashlsi3_1/0
+	orl	%r13d, %esi	# 2258	[c=4 l=3]  *iorsi_1/0
+	movl	%esi, (%rbx)	# 2259	[c=4 l=2]  *movsi_internal/1
+	cmpl	%esi, 992(%rbx)	# 2260	[c=13 l=6]  *cmpsi_1/0
+	jb	.L1583	# 2261	[c=13 l=6]  *jcc
+	movq	(%rsp), %rax	# 13975	[c=5 l=4]  *movdi_internal/3
+	subq	$1, %rax	# 2269	[c=4 l=4]  *adddi_1/0
+	cmpq	%rbp, %rax	# 2270	[c=4 l=3]  *cmpdi_1/0
+	jb	.L680	# 2271	[c=13 l=6]  *jcc
+	movq	56(%rbx), %rax	# 13976	[c=9 l=4]  *movdi_internal/3
+	cmpq	%rax, 48(%rbx)	# 2274	[c=13 l=4]  *cmpdi_1/0
+	jnb	.L1767	# 2275	[c=13 l=6]  *jcc
+.L766:
+	movl	(%rbx), %r15d	# 2282	[c=6 l=3]  *zero_extendsidi2/3
+	movl	$1, 96(%rbx)	# 2287	[c=4 l=7]  *movsi_internal/1
+	movq	%r10, %rcx	# 17934	[c=4 l=3]  *movdi_internal/3
+	movq	%r15, %rdx	# 16694	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 2284	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 2286	[c=13 l=7]  *adddi_1/1
+	movzbl	11(%r15), %eax	# 2288	[c=13 l=5]  zero_extendqidi2/0
+	movq	(%r15), %r14	# 2296	[c=5 l=3]  *movdi_internal/3
+	addq	%rax, %rbp	# 2289	[c=4 l=3]  *adddi_1/0
+	movzwl	14(%r15), %eax	# 2291	[c=13 l=5]  zero_extendhidi2/0
+	addq	%rax, 48(%rbx)	# 2292	[c=13 l=4]  *adddi_1/0
+	movq	%rbp, 40(%rbx)	# 2290	[c=4 l=4]  *movdi_internal/5
+	movzbl	9(%r15), %eax	# 2293	[c=13 l=5]  *zero_extendqisi2/0
+	addl	%edx, %eax	# 2294	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 17935	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 2295	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 17936	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 17937	[c=4 l=3]  *indirect_jump
+.L636:
+	movl	$2, 96(%rbx)	# 338	[c=4 l=7]  *movsi_internal/1
+	movl	(%rbx), %esi	# 339	[c=5 l=2]  *movsi_internal/0
+	movq	%rbx, %rdi	# 340	[c=4 l=3]  *movdi_internal/3
+	call	bad_PC	# 341	[c=0 l=5]  *call
+.L774:
+	movl	$59, %eax	# 2391	[c=4 l=5]  *movsi_internal/0
+	movzwl	1034(%rbx), %r13d	# 2390	[c=13 l=8]  *zero_extendhisi2/0
+	subl	5176(%rbx), %eax	# 2392	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %eax	# 2393	[c=13 l=6]  *cmpsi_1/1
+	jb	.L775	# 2394	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%rbx)	# 2396	[c=13 l=7]  *cmpqi_ccno_1/1
+	jne	.L776	# 2397	[c=13 l=6]  *jcc
+.L775:
+	movq	1040(%rbx), %rax	# 2400	[c=9 l=7]  *movdi_internal/3
+	movzbl	59(%rax), %eax	# 2401	[c=13 l=4]  *zero_extendqisi2/0
+.L777:
+	movl	992(%rbx), %edx	# 2412	[c=9 l=6]  *movsi_internal/0
+	sall	$16, %eax	# 2415	[c=4 l=3]  *ashlsi3_1/0
+	movl	(%rbx), %r15d	# 2422	[c=6 l=3]  *zero_extendsidi2/3
+	movq	%r10, %rcx	# 17918	[c=4 l=3]  *movdi_internal/3
+	orl	%r13d, %eax	# 2416	[c=4 l=3]  *iorsi_1/0
+	leal	1(%rdx,%rdx), %edx	# 2414	[c=8 l=4]  *leasi
+	andl	%edx, %eax	# 2417	[c=4 l=2]  *andsi_1/0
+	movq	1056(%rbx), %rdx	# 2419	[c=9 l=7]  *movdi_internal/3
+	cltq	# 2418	[c=4 l=2]  *extendsidi2_rex64/0
+	movzbl	(%rdx,%rax), %eax	# 2420	[c=9 l=4]  *movqi_internal/4
+	movq	%r15, %rdx	# 16696	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 2424	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 2426	[c=13 l=7]  *adddi_1/1
+	movb	%al, 1004(%rbx)	# 2421	[c=4 l=6]  *movqi_internal/8
+	movzbl	9(%r15), %eax	# 2427	[c=13 l=5]  *zero_extendqisi2/0
+	movq	(%r15), %r14	# 2430	[c=5 l=3]  *movdi_internal/3
+	addl	%edx, %eax	# 2428	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 17919	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 2429	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 17920	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 17921	[c=4 l=3]  *indirect_jump
+.L641:
+	movl	$2, 96(%rbx)	# 406	[c=4 l=7]  *movsi_internal/1
+	movzwl	12(%r15), %ecx	# 407	[c=13 l=5]  *zero_extendhisi2/0
+	movl	$1, %esi	# 420	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 421	[c=4 l=3]  *movdi_internal/3
+	movzbl	10(%r15), %eax	# 412	[c=13 l=5]  zero_extendqidi2/0
+	leaq	opcodes(%rip), %rdx	# 13686	[c=1 l=7]  *movdi_internal/4
+	movl	%ecx, %r9d	# 13833	[c=4 l=3]  *movsi_internal/0
+	salq	$4, %rax	# 413	[c=4 l=4]  *ashldi3_1/0
+	sarl	$4, %r9d	# 408	[c=4 l=4]  *ashrsi3_1/0
+	movq	(%rdx,%rax), %r8	# 416	[c=9 l=4]  *movdi_internal/3
+	andl	$31, %r9d	# 415	[c=4 l=4]  *andsi_1/0
+	leaq	.LC47(%rip), %rdx	# 418	[c=1 l=7]  *movdi_internal/4
+	xorl	%eax, %eax	# 18390	[c=4 l=2]  *movdi_xor
+	call	leave	# 423	[c=0 l=5]  *call
+.L1270:
+	movzwl	12(%r15), %edx	# 9288	[c=13 l=5]  *zero_extendhisi2/0
+	movzbl	10(%r15), %r15d	# 9295	[c=13 l=5]  zero_extendqidi2/0
+	movzbl	100(%rbx), %eax	# 9291	[c=13 l=4]  *zero_extendqisi2/0
+	movq	1040(%rbx), %r13	# 9290	[c=9 l=7]  *movdi_internal/3
+	movzbl	1004(%rbx,%r15), %esi	# 9296	[c=14 l=9]  *zero_extendqisi2/0
+	movl	%edx, %edi	# 16844	[c=4 l=2]  *movsi_internal/0
+	movq	104(%rbx), %r14	# 9294	[c=9 l=4]  *movdi_internal/3
+	movl	%eax, %r9d	# 14638	[c=4 l=3]  *movsi_internal/0
+	andl	$136, %edi	# 9313	[c=4 l=6]  *andsi_1/0
+	movl	%eax, %ecx	# 16842	[c=4 l=2]  *movsi_internal/0
+	movl	%esi, %r8d	# 16843	[c=4 l=3]  *movsi_internal/0
+	subl	%edx, %esi	# 9299	[c=4 l=2]  *subsi_1/0
+	movzbl	63(%r13), %edx	# 9300	[c=13 l=5]  *zero_extendqisi2/0
+	notl	%r9d	# 9293	[c=4 l=3]  *one_cmplsi2_1/0
+	movl	%esi, 16(%rsp)	# 16057	[c=4 l=4]  *movsi_internal/1
+	andl	$136, %r8d	# 9310	[c=4 l=7]  *andsi_1/0
+	andl	%r9d, %edx	# 9301	[c=4 l=3]  *andsi_1/0
+	movl	%edx, %esi	# 16005	[c=4 l=2]  *movsi_internal/0
+	movzbl	(%r14), %edx	# 18204	[c=5 l=4]  *movqi_internal/4
+	andl	%eax, %edx	# 19121	[c=4 l=2]  *andsi_1/0
+	andl	$-64, %eax	# 9316	[c=4 l=3]  *andsi_1/0
+	orl	%edx, %esi	# 9304	[c=4 l=2]  *iorsi_1/0
+	movl	%esi, %edx	# 16003	[c=4 l=2]  *movsi_internal/0
+	movl	16(%rsp), %esi	# 16054	[c=9 l=4]  *movsi_internal/0
+	andl	$1, %edx	# 9305	[c=4 l=3]  *andsi_1/0
+	subl	%edx, %esi	# 9306	[c=4 l=2]  *subsi_1/0
+	leal	(%rdi,%r8,2), %edx	# 9314	[c=8 l=4]  *leasi
+	movl	%eax, %r8d	# 14644	[c=4 l=3]  *movsi_internal/0
+	imull	$260, %edx, %edx	# 9319	[c=12 l=6]  *mulsi3_1/1
+	movb	%sil, 1004(%rbx,%r15)	# 9308	[c=4 l=8]  *movqi_internal/8
+	andl	$511, %esi	# 9321	[c=4 l=6]  *andsi_1/0
+	movzbl	(%r14), %edi	# 9315	[c=5 l=4]  *movqi_internal/4
+	leaq	flag_update_table_sub8(%rip), %rax	# 9318	[c=1 l=7]  *movdi_internal/4
+	andl	%edi, %ecx	# 16162	[c=4 l=2]  *andsi_1/0
+	andl	%r8d, %edi	# 16163	[c=4 l=3]  *andsi_1/0
+	andl	$7680, %edx	# 9320	[c=4 l=6]  *andsi_1/0
+	orl	%esi, %edx	# 9322	[c=4 l=2]  *iorsi_1/0
+	movl	%edx, %esi	# 9323	[c=1 l=2]  *zero_extendsidi2/3
+	movzbl	63(%r13), %edx	# 9325	[c=13 l=5]  *zero_extendqisi2/0
+	andl	%r9d, %edx	# 9326	[c=4 l=3]  *andsi_1/0
+	orl	%ecx, %edx	# 9329	[c=4 l=2]  *iorsi_1/0
+	movzbl	(%rax,%rsi), %ecx	# 18206	[c=9 l=4]  *movqi_internal/4
+	orl	$-3, %edx	# 9330	[c=4 l=3]  *iorsi_1/0
+	andl	%edx, %ecx	# 19122	[c=4 l=2]  *andsi_1/0
+	movl	%ecx, %eax	# 14646	[c=4 l=2]  *movqi_internal/0
+	orl	%eax, %edi	# 16164	[c=4 l=2]  *iorsi_1/0
+	movl	%r8d, %eax	# 14647	[c=4 l=3]  *movqi_internal/2
+	orl	$63, %eax	# 16165	[c=4 l=3]  *iorsi_1/0
+	movb	%dil, 101(%rbx)	# 9334	[c=4 l=4]  *movqi_internal/8
+	movb	%al, 100(%rbx)	# 9336	[c=4 l=3]  *movqi_internal/8
+.L1566:
+	leaq	101(%rbx), %rdx	# 16235	[c=4 l=4]  *leadi
+	movq	%rdx, 104(%rbx)	# 8339	[c=4 l=4]  *movdi_internal/5
+	jmp	.L1565	# 18475	[c=1 l=5]  jump
+.L888:
+	cmpb	$0, 844(%rbx)	# 3757	[c=13 l=7]  *cmpqi_ccno_1/1
+	movzbl	10(%r15), %r13d	# 3756	[c=13 l=5]  *zero_extendqisi2/0
+	jne	.L1768	# 3758	[c=13 l=6]  *jcc
+	movzwl	1030(%rbx), %r14d	# 3771	[c=13 l=8]  zero_extendhidi2/0
+	movl	%r14d, %edx	# 14064	[c=4 l=3]  *movsi_internal/0
+	movq	%r14, %rax	# 16720	[c=4 l=3]  *movdi_internal/3
+	subl	5176(%rbx), %edx	# 3774	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %edx	# 3775	[c=13 l=6]  *cmpsi_1/1
+	jb	.L891	# 3776	[c=13 l=2]  *jcc
+	movl	%r14d, %edx	# 14066	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %edx	# 3778	[c=4 l=3]  *ashrsi3_1/0
+	movslq	%edx, %rdx	# 3779	[c=4 l=3]  *extendsidi2_rex64/1
+	cmpb	$0, 1080(%rbx,%rdx)	# 3780	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L892	# 3781	[c=13 l=6]  *jcc
+.L891:
+	movq	1040(%rbx), %rdx	# 3785	[c=9 l=7]  *movdi_internal/3
+	movzbl	(%rdx,%rax), %edx	# 3786	[c=13 l=4]  *zero_extendqisi2/0
+.L893:
+	movslq	%r13d, %rax	# 3797	[c=4 l=3]  *extendsidi2_rex64/1
+	movb	%dl, 1004(%rbx,%rax)	# 3798	[c=4 l=7]  *movqi_internal/8
+	leal	1(%r14), %eax	# 16324	[c=4 l=4]  *leasi
+	subq	$1, 48(%rbx)	# 3799	[c=13 l=5]  *adddi_1/0
+	movw	%ax, 1030(%rbx)	# 3801	[c=4 l=7]  *movhi_internal/3
+.L890:
+	movl	(%rbx), %r15d	# 3804	[c=6 l=3]  *zero_extendsidi2/3
+	movq	%r10, %rcx	# 17758	[c=4 l=3]  *movdi_internal/3
+	movq	%r15, %rdx	# 16721	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 3806	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 3808	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%r15), %eax	# 3809	[c=13 l=5]  *zero_extendqisi2/0
+	movq	(%r15), %r14	# 3812	[c=5 l=3]  *movdi_internal/3
+	addl	%edx, %eax	# 3810	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 17759	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 3811	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 17760	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 17761	[c=4 l=3]  *indirect_jump
+.L894:
+	cmpb	$0, 844(%rbx)	# 3818	[c=13 l=7]  *cmpqi_ccno_1/1
+	movzbl	10(%r15), %r13d	# 3817	[c=13 l=5]  *zero_extendqisi2/0
+	jne	.L1769	# 3819	[c=13 l=6]  *jcc
+	movzwl	1032(%rbx), %r14d	# 3832	[c=13 l=8]  *zero_extendhisi2/0
+	subl	$1, %r14d	# 3833	[c=4 l=4]  *addsi_1/0
+	movl	%r14d, %eax	# 14068	[c=4 l=3]  *movsi_internal/0
+	subl	5176(%rbx), %eax	# 3834	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %eax	# 3835	[c=13 l=6]  *cmpsi_1/1
+	jb	.L897	# 3836	[c=13 l=2]  *jcc
+	movl	%r14d, %eax	# 14070	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %eax	# 3838	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 13670	[c=5 l=5]  *andsi_1_zext
+	cmpb	$0, 1080(%rbx,%rax)	# 3841	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L898	# 3842	[c=13 l=6]  *jcc
+.L897:
+	movq	1040(%rbx), %rdx	# 3846	[c=9 l=7]  *movdi_internal/3
+	movslq	%r14d, %rax	# 3845	[c=4 l=3]  *extendsidi2_rex64/1
+	movzbl	(%rdx,%rax), %edx	# 3847	[c=13 l=4]  *zero_extendqisi2/0
+.L899:
+	movslq	%r13d, %rax	# 3858	[c=4 l=3]  *extendsidi2_rex64/1
+	movb	%dl, 1004(%rbx,%rax)	# 3859	[c=4 l=7]  *movqi_internal/8
+	movw	%r14w, 1032(%rbx)	# 3860	[c=4 l=8]  *movhi_internal/3
+.L896:
+	movl	(%rbx), %r15d	# 3863	[c=6 l=3]  *zero_extendsidi2/3
+	movq	%r10, %rcx	# 17750	[c=4 l=3]  *movdi_internal/3
+	movq	%r15, %rdx	# 16722	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 3865	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 3867	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%r15), %eax	# 3868	[c=13 l=5]  *zero_extendqisi2/0
+	movq	(%r15), %r14	# 3871	[c=5 l=3]  *movdi_internal/3
+	addl	%edx, %eax	# 3869	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 17751	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 3870	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 17752	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 17753	[c=4 l=3]  *indirect_jump
+.L900:
+	cmpb	$0, 844(%rbx)	# 3877	[c=13 l=7]  *cmpqi_ccno_1/1
+	movzbl	10(%r15), %r13d	# 3876	[c=13 l=5]  *zero_extendqisi2/0
+	jne	.L1770	# 3878	[c=13 l=6]  *jcc
+	movzwl	1032(%rbx), %r14d	# 3891	[c=13 l=8]  zero_extendhidi2/0
+	movl	%r14d, %edx	# 14072	[c=4 l=3]  *movsi_internal/0
+	movq	%r14, %rax	# 16723	[c=4 l=3]  *movdi_internal/3
+	subl	5176(%rbx), %edx	# 3894	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %edx	# 3895	[c=13 l=6]  *cmpsi_1/1
+	jb	.L903	# 3896	[c=13 l=2]  *jcc
+	movl	%r14d, %edx	# 14074	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %edx	# 3898	[c=4 l=3]  *ashrsi3_1/0
+	movslq	%edx, %rdx	# 3899	[c=4 l=3]  *extendsidi2_rex64/1
+	cmpb	$0, 1080(%rbx,%rdx)	# 3900	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L904	# 3901	[c=13 l=6]  *jcc
+.L903:
+	movq	1040(%rbx), %rdx	# 3905	[c=9 l=7]  *movdi_internal/3
+	movzbl	(%rdx,%rax), %edx	# 3906	[c=13 l=4]  *zero_extendqisi2/0
+.L905:
+	movslq	%r13d, %rax	# 3917	[c=4 l=3]  *extendsidi2_rex64/1
+	movb	%dl, 1004(%rbx,%rax)	# 3918	[c=4 l=7]  *movqi_internal/8
+	leal	1(%r14), %eax	# 16323	[c=4 l=4]  *leasi
+	subq	$1, 48(%rbx)	# 3919	[c=13 l=5]  *adddi_1/0
+	movw	%ax, 1032(%rbx)	# 3921	[c=4 l=7]  *movhi_internal/3
+.L902:
+	movl	(%rbx), %r15d	# 3924	[c=6 l=3]  *zero_extendsidi2/3
+	movq	%r10, %rcx	# 17742	[c=4 l=3]  *movdi_internal/3
+	movq	%r15, %rdx	# 16724	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 3926	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 3928	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%r15), %eax	# 3929	[c=13 l=5]  *zero_extendqisi2/0
+	movq	(%r15), %r14	# 3932	[c=5 l=3]  *movdi_internal/3
+	addl	%edx, %eax	# 3930	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 17743	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 3931	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 17744	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 17745	[c=4 l=3]  *indirect_jump
+.L906:
+	cmpb	$0, 844(%rbx)	# 3938	[c=13 l=7]  *cmpqi_ccno_1/1
+	movzbl	10(%r15), %r13d	# 3937	[c=13 l=5]  *zero_extendqisi2/0
+	jne	.L1771	# 3939	[c=13 l=6]  *jcc
+	movzwl	1034(%rbx), %r14d	# 3952	[c=13 l=8]  *zero_extendhisi2/0
+	subl	$1, %r14d	# 3953	[c=4 l=4]  *addsi_1/0
+	movl	%r14d, %eax	# 14076	[c=4 l=3]  *movsi_internal/0
+	subl	5176(%rbx), %eax	# 3954	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %eax	# 3955	[c=13 l=6]  *cmpsi_1/1
+	jb	.L909	# 3956	[c=13 l=2]  *jcc
+	movl	%r14d, %eax	# 14078	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %eax	# 3958	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 13669	[c=5 l=5]  *andsi_1_zext
+	cmpb	$0, 1080(%rbx,%rax)	# 3961	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L910	# 3962	[c=13 l=6]  *jcc
+.L909:
+	movq	1040(%rbx), %rdx	# 3966	[c=9 l=7]  *movdi_internal/3
+	movslq	%r14d, %rax	# 3965	[c=4 l=3]  *extendsidi2_rex64/1
+	movzbl	(%rdx,%rax), %edx	# 3967	[c=13 l=4]  *zero_extendqisi2/0
+.L911:
+	movslq	%r13d, %rax	# 3978	[c=4 l=3]  *extendsidi2_rex64/1
+	movb	%dl, 1004(%rbx,%rax)	# 3979	[c=4 l=7]  *movqi_internal/8
+	movw	%r14w, 1034(%rbx)	# 3980	[c=4 l=8]  *movhi_internal/3
+.L908:
+	movl	(%rbx), %r15d	# 3983	[c=6 l=3]  *zero_extendsidi2/3
+	movq	%r10, %rcx	# 17734	[c=4 l=3]  *movdi_internal/3
+	movq	%r15, %rdx	# 16725	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 3985	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 3987	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%r15), %eax	# 3988	[c=13 l=5]  *zero_extendqisi2/0
+	movq	(%r15), %r14	# 3991	[c=5 l=3]  *movdi_internal/3
+	addl	%edx, %eax	# 3989	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 17735	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 3990	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 17736	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 17737	[c=4 l=3]  *indirect_jump
+.L912:
+	cmpb	$0, 844(%rbx)	# 3997	[c=13 l=7]  *cmpqi_ccno_1/1
+	movzbl	10(%r15), %r13d	# 3996	[c=13 l=5]  *zero_extendqisi2/0
+	jne	.L1772	# 3998	[c=13 l=6]  *jcc
+	movzwl	1034(%rbx), %r14d	# 4011	[c=13 l=8]  zero_extendhidi2/0
+	movl	%r14d, %edx	# 14080	[c=4 l=3]  *movsi_internal/0
+	movq	%r14, %rax	# 16726	[c=4 l=3]  *movdi_internal/3
+	subl	5176(%rbx), %edx	# 4014	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %edx	# 4015	[c=13 l=6]  *cmpsi_1/1
+	jb	.L915	# 4016	[c=13 l=2]  *jcc
+	movl	%r14d, %edx	# 14082	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %edx	# 4018	[c=4 l=3]  *ashrsi3_1/0
+	movslq	%edx, %rdx	# 4019	[c=4 l=3]  *extendsidi2_rex64/1
+	cmpb	$0, 1080(%rbx,%rdx)	# 4020	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L916	# 4021	[c=13 l=6]  *jcc
+.L915:
+	movq	1040(%rbx), %rdx	# 4025	[c=9 l=7]  *movdi_internal/3
+	movzbl	(%rdx,%rax), %edx	# 4026	[c=13 l=4]  *zero_extendqisi2/0
+.L917:
+	movslq	%r13d, %rax	# 4037	[c=4 l=3]  *extendsidi2_rex64/1
+	movb	%dl, 1004(%rbx,%rax)	# 4038	[c=4 l=7]  *movqi_internal/8
+	leal	1(%r14), %eax	# 16322	[c=4 l=4]  *leasi
+	subq	$1, 48(%rbx)	# 4039	[c=13 l=5]  *adddi_1/0
+	movw	%ax, 1034(%rbx)	# 4041	[c=4 l=7]  *movhi_internal/3
+.L914:
+	movl	(%rbx), %r15d	# 4044	[c=6 l=3]  *zero_extendsidi2/3
+	movq	%r10, %rcx	# 17726	[c=4 l=3]  *movdi_internal/3
+	movq	%r15, %rdx	# 16727	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 4046	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 4048	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%r15), %eax	# 4049	[c=13 l=5]  *zero_extendqisi2/0
+	movq	(%r15), %r14	# 4052	[c=5 l=3]  *movdi_internal/3
+	addl	%edx, %eax	# 4050	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 17727	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 4051	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 17728	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 17729	[c=4 l=3]  *indirect_jump
+.L918:
+	movl	992(%rbx), %eax	# 4057	[c=9 l=6]  *movsi_internal/0
+	movq	1056(%rbx), %rdx	# 4063	[c=9 l=7]  *movdi_internal/3
+	movq	%r10, %rcx	# 17718	[c=4 l=3]  *movdi_internal/3
+	movl	(%rbx), %r15d	# 4066	[c=6 l=3]  *zero_extendsidi2/3
+	leal	1(%rax,%rax), %eax	# 4059	[c=8 l=4]  *leasi
+	andw	1034(%rbx), %ax	# 4061	[c=13 l=7]  *andhi_1/1
+	movzwl	%ax, %eax	# 4062	[c=4 l=3]  zero_extendhidi2/0
+	movzbl	(%rdx,%rax), %eax	# 4064	[c=9 l=4]  *movqi_internal/4
+	movq	%r15, %rdx	# 16728	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 4068	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 4070	[c=13 l=7]  *adddi_1/1
+	movb	%al, 1004(%rbx)	# 4065	[c=4 l=6]  *movqi_internal/8
+	movzbl	9(%r15), %eax	# 4071	[c=13 l=5]  *zero_extendqisi2/0
+	movq	(%r15), %r14	# 4074	[c=5 l=3]  *movdi_internal/3
+	addl	%edx, %eax	# 4072	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 17719	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 4073	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 17720	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 17721	[c=4 l=3]  *indirect_jump
+.L919:
+	movl	992(%rbx), %eax	# 4079	[c=9 l=6]  *movsi_internal/0
+	movq	1056(%rbx), %rdx	# 4085	[c=9 l=7]  *movdi_internal/3
+	movq	%r10, %rcx	# 17710	[c=4 l=3]  *movdi_internal/3
+	leal	1(%rax,%rax), %eax	# 4081	[c=8 l=4]  *leasi
+	andw	1034(%rbx), %ax	# 4083	[c=13 l=7]  *andhi_1/1
+	movzwl	%ax, %eax	# 4084	[c=4 l=3]  zero_extendhidi2/0
+	movzbl	(%rdx,%rax), %edx	# 4086	[c=9 l=4]  *movqi_internal/4
+	movzbl	10(%r15), %eax	# 4088	[c=13 l=5]  zero_extendqidi2/0
+	movb	%dl, 1004(%rbx,%rax)	# 4089	[c=4 l=7]  *movqi_internal/8
+	movl	(%rbx), %r15d	# 4090	[c=6 l=3]  *zero_extendsidi2/3
+	movq	%r15, %rdx	# 16729	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 4092	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 4094	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%r15), %eax	# 4095	[c=13 l=5]  *zero_extendqisi2/0
+	movq	(%r15), %r14	# 4098	[c=5 l=3]  *movdi_internal/3
+	addl	%edx, %eax	# 4096	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 17711	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 4097	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 17712	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 17713	[c=4 l=3]  *indirect_jump
+.L920:
+	movl	992(%rbx), %eax	# 4104	[c=9 l=6]  *movsi_internal/0
+	movzwl	1034(%rbx), %edx	# 4103	[c=13 l=7]  *zero_extendhisi2/0
+	movq	1056(%rbx), %rcx	# 4109	[c=9 l=7]  *movdi_internal/3
+	leal	1(%rax,%rax), %eax	# 4106	[c=8 l=4]  *leasi
+	andl	%edx, %eax	# 4107	[c=4 l=2]  *andsi_1/0
+	cltq	# 4108	[c=4 l=2]  *extendsidi2_rex64/0
+	movzbl	(%rcx,%rax), %ecx	# 4110	[c=9 l=4]  *movqi_internal/4
+	movzbl	10(%r15), %eax	# 4112	[c=13 l=5]  zero_extendqidi2/0
+	movb	%cl, 1004(%rbx,%rax)	# 4113	[c=4 l=7]  *movqi_internal/8
+	movl	(%rbx), %r15d	# 4116	[c=6 l=3]  *zero_extendsidi2/3
+	leal	1(%rdx), %eax	# 16321	[c=4 l=3]  *leasi
+	movq	%r10, %rcx	# 17702	[c=4 l=3]  *movdi_internal/3
+	movw	%ax, 1034(%rbx)	# 4115	[c=4 l=7]  *movhi_internal/3
+	movq	%r15, %rdx	# 16730	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 4118	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 4120	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%r15), %eax	# 4121	[c=13 l=5]  *zero_extendqisi2/0
+	movq	(%r15), %r14	# 4124	[c=5 l=3]  *movdi_internal/3
+	addl	%edx, %eax	# 4122	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 17703	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 4123	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 17704	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 17705	[c=4 l=3]  *indirect_jump
+.L921:
+	movzbl	10(%r15), %edx	# 4130	[c=13 l=5]  zero_extendqidi2/0
+	movzbl	1004(%rbx,%rdx), %ecx	# 4131	[c=14 l=8]  zero_extendqidi2/0
+	movl	%ecx, %esi	# 14084	[c=4 l=2]  *movsi_internal/0
+	movq	%rcx, %rax	# 16731	[c=4 l=3]  *movdi_internal/3
+	sarl	%esi	# 4134	[c=4 l=2]  *ashrsi3_1/0
+	movb	%sil, 1004(%rbx,%rdx)	# 4135	[c=4 l=8]  *movqi_internal/8
+	movzbl	100(%rbx), %edx	# 4136	[c=9 l=4]  *movqi_internal/4
+	movl	%edx, %esi	# 14086	[c=4 l=2]  *movsi_internal/0
+	andl	$224, %esi	# 4139	[c=4 l=6]  *andsi_2/0
+	jne	.L922	# 4140	[c=13 l=6]  *jcc
+	leaq	flag_update_table_ror8(%rip), %rdx	# 4143	[c=1 l=7]  *movdi_internal/4
+	addq	%rdx, %rax	# 4144	[c=4 l=3]  *adddi_1/0
+	movl	$31, %edx	# 22	[c=4 l=5]  *movqi_internal/3
+.L923:
+	movl	(%rbx), %r15d	# 4163	[c=6 l=3]  *zero_extendsidi2/3
+	movb	%dl, 100(%rbx)	# 4162	[c=4 l=3]  *movqi_internal/8
+	movq	%r10, %rcx	# 17694	[c=4 l=3]  *movdi_internal/3
+	movq	%rax, 104(%rbx)	# 4161	[c=4 l=4]  *movdi_internal/5
+	movq	%r15, %rdx	# 16732	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 4165	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 4167	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%r15), %eax	# 4168	[c=13 l=5]  *zero_extendqisi2/0
+	movq	(%r15), %r14	# 4171	[c=5 l=3]  *movdi_internal/3
+	addl	%edx, %eax	# 4169	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 17695	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 4170	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 17696	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 17697	[c=4 l=3]  *indirect_jump
+.L924:
+	movzwl	12(%r15), %eax	# 4177	[c=13 l=5]  zero_extendhidi2/0
+	movq	%r10, %rcx	# 17686	[c=4 l=3]  *movdi_internal/3
+	movzbl	1004(%rbx,%rax), %edx	# 4178	[c=10 l=8]  *movqi_internal/4
+	movzbl	10(%r15), %eax	# 4180	[c=13 l=5]  zero_extendqidi2/0
+	movb	%dl, 1004(%rbx,%rax)	# 4181	[c=4 l=7]  *movqi_internal/8
+	movl	(%rbx), %r15d	# 4182	[c=6 l=3]  *zero_extendsidi2/3
+	movq	%r15, %rdx	# 16733	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 4184	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 4186	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%r15), %eax	# 4187	[c=13 l=5]  *zero_extendqisi2/0
+	movq	(%r15), %r14	# 4190	[c=5 l=3]  *movdi_internal/3
+	addl	%edx, %eax	# 4188	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 17687	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 4189	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 17688	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 17689	[c=4 l=3]  *indirect_jump
+.L1059:
+	movl	$2, 96(%rbx)	# 5962	[c=4 l=7]  *movsi_internal/1
+	movzbl	10(%r15), %esi	# 5964	[c=13 l=5]  zero_extendqidi2/0
+	movzwl	12(%r15), %r13d	# 5963	[c=13 l=5]  *zero_extendhisi2/0
+	movl	%esi, %edx	# 14241	[c=4 l=2]  *movsi_internal/0
+	movq	%rsi, %rax	# 16769	[c=4 l=3]  *movdi_internal/3
+	subl	5176(%rbx), %edx	# 5966	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %edx	# 5967	[c=13 l=6]  *cmpsi_1/1
+	jb	.L1060	# 5968	[c=13 l=2]  *jcc
+	movl	%esi, %edx	# 14243	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %edx	# 5971	[c=4 l=3]  *ashrsi3_1/0
+	movslq	%edx, %rdx	# 5972	[c=4 l=3]  *extendsidi2_rex64/1
+	cmpb	$0, 1080(%rbx,%rdx)	# 5973	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L1061	# 5974	[c=13 l=6]  *jcc
+.L1060:
+	movq	1040(%rbx), %rdx	# 5978	[c=9 l=7]  *movdi_internal/3
+	movzbl	(%rdx,%rax), %eax	# 5979	[c=13 l=4]  *zero_extendqisi2/0
+.L1062:
+	testl	%eax, %r13d	# 5991	[c=4 l=3]  *testsi_1/0
+	je	.L1063	# 5992	[c=13 l=2]  *jcc
+	movl	(%rbx), %eax	# 14245	[c=5 l=2]  *movsi_internal/0
+	addq	$2, 48(%rbx)	# 6000	[c=13 l=5]  *adddi_1/0
+	addl	$2, %eax	# 5995	[c=4 l=3]  *addsi_1/0
+	andl	992(%rbx), %eax	# 5998	[c=13 l=6]  *andsi_1/1
+	movl	%eax, (%rbx)	# 5999	[c=4 l=2]  *movsi_internal/1
+.L1063:
+	movq	(%rsp), %rax	# 14246	[c=5 l=4]  *movdi_internal/3
+	subq	$1, %rax	# 6003	[c=4 l=4]  *adddi_1/0
+	cmpq	%rbp, %rax	# 6004	[c=4 l=3]  *cmpdi_1/0
+	jb	.L680	# 6005	[c=13 l=6]  *jcc
+	movq	56(%rbx), %rax	# 14247	[c=9 l=4]  *movdi_internal/3
+	cmpq	%rax, 48(%rbx)	# 6008	[c=13 l=4]  *cmpdi_1/0
+	jnb	.L1773	# 6009	[c=13 l=6]  *jcc
+.L1064:
+	movl	(%rbx), %r15d	# 6016	[c=6 l=3]  *zero_extendsidi2/3
+	movl	$1, 96(%rbx)	# 6021	[c=4 l=7]  *movsi_internal/1
+	movq	%r10, %rcx	# 17502	[c=4 l=3]  *movdi_internal/3
+	movq	%r15, %rdx	# 16770	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 6018	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 6020	[c=13 l=7]  *adddi_1/1
+	movzbl	11(%r15), %eax	# 6022	[c=13 l=5]  zero_extendqidi2/0
+	movq	(%r15), %r14	# 6030	[c=5 l=3]  *movdi_internal/3
+	addq	%rax, %rbp	# 6023	[c=4 l=3]  *adddi_1/0
+	movzwl	14(%r15), %eax	# 6025	[c=13 l=5]  zero_extendhidi2/0
+	addq	%rax, 48(%rbx)	# 6026	[c=13 l=4]  *adddi_1/0
+	movq	%rbp, 40(%rbx)	# 6024	[c=4 l=4]  *movdi_internal/5
+	movzbl	9(%r15), %eax	# 6027	[c=13 l=5]  *zero_extendqisi2/0
+	addl	%edx, %eax	# 6028	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 17503	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 6029	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 17504	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 17505	[c=4 l=3]  *indirect_jump
+.L1065:
+	movl	$2, 96(%rbx)	# 6035	[c=4 l=7]  *movsi_internal/1
+	movzbl	10(%r15), %eax	# 6037	[c=13 l=5]  zero_extendqidi2/0
+	movzbl	1004(%rbx,%rax), %edx	# 6038	[c=14 l=8]  *zero_extendqisi2/0
+	movzwl	12(%r15), %eax	# 6039	[c=13 l=5]  *zero_extendhisi2/0
+	testl	%eax, %edx	# 6041	[c=4 l=2]  *testsi_1/0
+	jne	.L1066	# 6042	[c=13 l=2]  *jcc
+	movl	(%rbx), %eax	# 14248	[c=5 l=2]  *movsi_internal/0
+	addq	$1, 48(%rbx)	# 6050	[c=13 l=5]  *adddi_1/0
+	addl	$1, %eax	# 6045	[c=4 l=3]  *addsi_1/0
+	andl	992(%rbx), %eax	# 6048	[c=13 l=6]  *andsi_1/1
+	movl	%eax, (%rbx)	# 6049	[c=4 l=2]  *movsi_internal/1
+.L1066:
+	movq	(%rsp), %rax	# 14249	[c=5 l=4]  *movdi_internal/3
+	subq	$1, %rax	# 6053	[c=4 l=4]  *adddi_1/0
+	cmpq	%rbp, %rax	# 6054	[c=4 l=3]  *cmpdi_1/0
+	jb	.L680	# 6055	[c=13 l=6]  *jcc
+	movq	56(%rbx), %rax	# 14250	[c=9 l=4]  *movdi_internal/3
+	cmpq	%rax, 48(%rbx)	# 6058	[c=13 l=4]  *cmpdi_1/0
+	jnb	.L1774	# 6059	[c=13 l=6]  *jcc
+.L1067:
+	movl	(%rbx), %r15d	# 6066	[c=6 l=3]  *zero_extendsidi2/3
+	movl	$1, 96(%rbx)	# 6071	[c=4 l=7]  *movsi_internal/1
+	movq	%r10, %rcx	# 17494	[c=4 l=3]  *movdi_internal/3
+	movq	%r15, %rdx	# 16771	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 6068	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 6070	[c=13 l=7]  *adddi_1/1
+	movzbl	11(%r15), %eax	# 6072	[c=13 l=5]  zero_extendqidi2/0
+	movq	(%r15), %r14	# 6080	[c=5 l=3]  *movdi_internal/3
+	addq	%rax, %rbp	# 6073	[c=4 l=3]  *adddi_1/0
+	movzwl	14(%r15), %eax	# 6075	[c=13 l=5]  zero_extendhidi2/0
+	addq	%rax, 48(%rbx)	# 6076	[c=13 l=4]  *adddi_1/0
+	movq	%rbp, 40(%rbx)	# 6074	[c=4 l=4]  *movdi_internal/5
+	movzbl	9(%r15), %eax	# 6077	[c=13 l=5]  *zero_extendqisi2/0
+	addl	%edx, %eax	# 6078	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 17495	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 6079	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 17496	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 17497	[c=4 l=3]  *indirect_jump
+.L1068:
+	movl	$2, 96(%rbx)	# 6085	[c=4 l=7]  *movsi_internal/1
+	movzbl	10(%r15), %eax	# 6087	[c=13 l=5]  zero_extendqidi2/0
+	movzbl	1004(%rbx,%rax), %edx	# 6088	[c=14 l=8]  *zero_extendqisi2/0
+	movzwl	12(%r15), %eax	# 6089	[c=13 l=5]  *zero_extendhisi2/0
+	testl	%eax, %edx	# 6091	[c=4 l=2]  *testsi_1/0
+	jne	.L1069	# 6092	[c=13 l=2]  *jcc
+	movl	(%rbx), %eax	# 14251	[c=5 l=2]  *movsi_internal/0
+	addq	$2, 48(%rbx)	# 6100	[c=13 l=5]  *adddi_1/0
+	addl	$2, %eax	# 6095	[c=4 l=3]  *addsi_1/0
+	andl	992(%rbx), %eax	# 6098	[c=13 l=6]  *andsi_1/1
+	movl	%eax, (%rbx)	# 6099	[c=4 l=2]  *movsi_internal/1
+.L1069:
+	movq	(%rsp), %rax	# 14252	[c=5 l=4]  *movdi_internal/3
+	subq	$1, %rax	# 6103	[c=4 l=4]  *adddi_1/0
+	cmpq	%rbp, %rax	# 6104	[c=4 l=3]  *cmpdi_1/0
+	jb	.L680	# 6105	[c=13 l=6]  *jcc
+	movq	56(%rbx), %rax	# 14253	[c=9 l=4]  *movdi_internal/3
+	cmpq	%rax, 48(%rbx)	# 6108	[c=13 l=4]  *cmpdi_1/0
+	jnb	.L1775	# 6109	[c=13 l=6]  *jcc
+.L1070:
+	movl	(%rbx), %r15d	# 6116	[c=6 l=3]  *zero_extendsidi2/3
+	movl	$1, 96(%rbx)	# 6121	[c=4 l=7]  *movsi_internal/1
+	movq	%r10, %rcx	# 17486	[c=4 l=3]  *movdi_internal/3
+	movq	%r15, %rdx	# 16772	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 6118	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 6120	[c=13 l=7]  *adddi_1/1
+	movzbl	11(%r15), %eax	# 6122	[c=13 l=5]  zero_extendqidi2/0
+	movq	(%r15), %r14	# 6130	[c=5 l=3]  *movdi_internal/3
+	addq	%rax, %rbp	# 6123	[c=4 l=3]  *adddi_1/0
+	movzwl	14(%r15), %eax	# 6125	[c=13 l=5]  zero_extendhidi2/0
+	addq	%rax, 48(%rbx)	# 6126	[c=13 l=4]  *adddi_1/0
+	movq	%rbp, 40(%rbx)	# 6124	[c=4 l=4]  *movdi_internal/5
+	movzbl	9(%r15), %eax	# 6127	[c=13 l=5]  *zero_extendqisi2/0
+	addl	%edx, %eax	# 6128	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 17487	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 6129	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 17488	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 17489	[c=4 l=3]  *indirect_jump
+.L1071:
+	movl	$2, 96(%rbx)	# 6135	[c=4 l=7]  *movsi_internal/1
+	movzbl	10(%r15), %eax	# 6137	[c=13 l=5]  zero_extendqidi2/0
+	movzbl	1004(%rbx,%rax), %edx	# 6138	[c=14 l=8]  *zero_extendqisi2/0
+	movzwl	12(%r15), %eax	# 6139	[c=13 l=5]  *zero_extendhisi2/0
+	testl	%eax, %edx	# 6141	[c=4 l=2]  *testsi_1/0
+	je	.L1072	# 6142	[c=13 l=2]  *jcc
+	movl	(%rbx), %eax	# 14254	[c=5 l=2]  *movsi_internal/0
+	addq	$1, 48(%rbx)	# 6150	[c=13 l=5]  *adddi_1/0
+	addl	$1, %eax	# 6145	[c=4 l=3]  *addsi_1/0
+	andl	992(%rbx), %eax	# 6148	[c=13 l=6]  *andsi_1/1
+	movl	%eax, (%rbx)	# 6149	[c=4 l=2]  *movsi_internal/1
+.L1072:
+	movq	(%rsp), %rax	# 14255	[c=5 l=4]  *movdi_internal/3
+	subq	$1, %rax	# 6153	[c=4 l=4]  *adddi_1/0
+	cmpq	%rbp, %rax	# 6154	[c=4 l=3]  *cmpdi_1/0
+	jb	.L680	# 6155	[c=13 l=6]  *jcc
+	movq	56(%rbx), %rax	# 14256	[c=9 l=4]  *movdi_internal/3
+	cmpq	%rax, 48(%rbx)	# 6158	[c=13 l=4]  *cmpdi_1/0
+	jnb	.L1776	# 6159	[c=13 l=6]  *jcc
+.L1073:
+	movl	(%rbx), %r15d	# 6166	[c=6 l=3]  *zero_extendsidi2/3
+	movl	$1, 96(%rbx)	# 6171	[c=4 l=7]  *movsi_internal/1
+	movq	%r10, %rcx	# 17478	[c=4 l=3]  *movdi_internal/3
+	movq	%r15, %rdx	# 16773	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 6168	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 6170	[c=13 l=7]  *adddi_1/1
+	movzbl	11(%r15), %eax	# 6172	[c=13 l=5]  zero_extendqidi2/0
+	movq	(%r15), %r14	# 6180	[c=5 l=3]  *movdi_internal/3
+	addq	%rax, %rbp	# 6173	[c=4 l=3]  *adddi_1/0
+	movzwl	14(%r15), %eax	# 6175	[c=13 l=5]  zero_extendhidi2/0
+	addq	%rax, 48(%rbx)	# 6176	[c=13 l=4]  *adddi_1/0
+	movq	%rbp, 40(%rbx)	# 6174	[c=4 l=4]  *movdi_internal/5
+	movzbl	9(%r15), %eax	# 6177	[c=13 l=5]  *zero_extendqisi2/0
+	addl	%edx, %eax	# 6178	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 17479	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 6179	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 17480	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 17481	[c=4 l=3]  *indirect_jump
+.L1074:
+	movl	$2, 96(%rbx)	# 6185	[c=4 l=7]  *movsi_internal/1
+	movzbl	10(%r15), %eax	# 6187	[c=13 l=5]  zero_extendqidi2/0
+	movzbl	1004(%rbx,%rax), %edx	# 6188	[c=14 l=8]  *zero_extendqisi2/0
+	movzwl	12(%r15), %eax	# 6189	[c=13 l=5]  *zero_extendhisi2/0
+	testl	%eax, %edx	# 6191	[c=4 l=2]  *testsi_1/0
+	je	.L1075	# 6192	[c=13 l=2]  *jcc
+	movl	(%rbx), %eax	# 14257	[c=5 l=2]  *movsi_internal/0
+	addq	$2, 48(%rbx)	# 6200	[c=13 l=5]  *adddi_1/0
+	addl	$2, %eax	# 6195	[c=4 l=3]  *addsi_1/0
+	andl	992(%rbx), %eax	# 6198	[c=13 l=6]  *andsi_1/1
+	movl	%eax, (%rbx)	# 6199	[c=4 l=2]  *movsi_internal/1
+.L1075:
+	movq	(%rsp), %rax	# 14258	[c=5 l=4]  *movdi_internal/3
+	subq	$1, %rax	# 6203	[c=4 l=4]  *adddi_1/0
+	cmpq	%rbp, %rax	# 6204	[c=4 l=3]  *cmpdi_1/0
+	jb	.L680	# 6205	[c=13 l=6]  *jcc
+	movq	56(%rbx), %rax	# 14259	[c=9 l=4]  *movdi_internal/3
+	cmpq	%rax, 48(%rbx)	# 6208	[c=13 l=4]  *cmpdi_1/0
+	jnb	.L1777	# 6209	[c=13 l=6]  *jcc
+.L1076:
+	movl	(%rbx), %r15d	# 6216	[c=6 l=3]  *zero_extendsidi2/3
+	movl	$1, 96(%rbx)	# 6221	[c=4 l=7]  *movsi_internal/1
+	movq	%r10, %rcx	# 17470	[c=4 l=3]  *movdi_internal/3
+	movq	%r15, %rdx	# 16774	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 6218	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 6220	[c=13 l=7]  *adddi_1/1
+	movzbl	11(%r15), %eax	# 6222	[c=13 l=5]  zero_extendqidi2/0
+	movq	(%r15), %r14	# 6230	[c=5 l=3]  *movdi_internal/3
+	addq	%rax, %rbp	# 6223	[c=4 l=3]  *adddi_1/0
+	movzwl	14(%r15), %eax	# 6225	[c=13 l=5]  zero_extendhidi2/0
+	addq	%rax, 48(%rbx)	# 6226	[c=13 l=4]  *adddi_1/0
+	movq	%rbp, 40(%rbx)	# 6224	[c=4 l=4]  *movdi_internal/5
+	movzbl	9(%r15), %eax	# 6227	[c=13 l=5]  *zero_extendqisi2/0
+	addl	%edx, %eax	# 6228	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 17471	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 6229	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 17472	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 17473	[c=4 l=3]  *indirect_jump
+.L1336:
+	movl	992(%rbx), %eax	# 10478	[c=9 l=6]  *movsi_internal/0
+	movzwl	1034(%rbx), %edx	# 10477	[c=13 l=7]  *zero_extendhisi2/0
+	movq	1056(%rbx), %rcx	# 10483	[c=9 l=7]  *movdi_internal/3
+	leal	1(%rax,%rax), %eax	# 10480	[c=8 l=4]  *leasi
+	andl	%edx, %eax	# 10481	[c=4 l=2]  *andsi_1/0
+	cltq	# 10482	[c=4 l=2]  *extendsidi2_rex64/0
+	movzbl	(%rcx,%rax), %ecx	# 10484	[c=9 l=4]  *movqi_internal/4
+	movzbl	10(%r15), %eax	# 10486	[c=13 l=5]  zero_extendqidi2/0
+	movb	%cl, 1004(%rbx,%rax)	# 10487	[c=4 l=7]  *movqi_internal/8
+	leal	1(%rdx), %eax	# 16108	[c=4 l=3]  *leasi
+	jmp	.L1572	# 18487	[c=1 l=5]  jump
+.L1337:
+	movl	$59, %eax	# 10503	[c=4 l=5]  *movsi_internal/0
+	movzbl	10(%r15), %r13d	# 10501	[c=13 l=5]  zero_extendqidi2/0
+	movzwl	1034(%rbx), %r14d	# 10502	[c=13 l=8]  *zero_extendhisi2/0
+	subl	5176(%rbx), %eax	# 10504	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %eax	# 10505	[c=13 l=6]  *cmpsi_1/1
+	jb	.L1338	# 10506	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%rbx)	# 10508	[c=13 l=7]  *cmpqi_ccno_1/1
+	jne	.L1339	# 10509	[c=13 l=6]  *jcc
+.L1338:
+	movq	1040(%rbx), %rax	# 10512	[c=9 l=7]  *movdi_internal/3
+	movzbl	59(%rax), %edx	# 10513	[c=13 l=4]  *zero_extendqisi2/0
+.L1340:
+	movl	992(%rbx), %eax	# 10526	[c=9 l=6]  *movsi_internal/0
+	sall	$16, %edx	# 10524	[c=4 l=3]  *ashlsi3_1/0
+	movq	1056(%rbx), %rcx	# 10531	[c=9 l=7]  *movdi_internal/3
+	orl	%r14d, %edx	# 10525	[c=4 l=3]  *iorsi_1/0
+	leal	1(%rax,%rax), %eax	# 10528	[c=8 l=4]  *leasi
+	andl	%edx, %eax	# 10529	[c=4 l=2]  *andsi_1/0
+	addl	$1, %edx	# 10535	[c=4 l=3]  *addsi_1/0
+	cltq	# 10530	[c=4 l=2]  *extendsidi2_rex64/0
+	movzbl	(%rcx,%rax), %eax	# 10532	[c=9 l=4]  *movqi_internal/4
+	movb	%al, 1004(%rbx,%r13)	# 10534	[c=4 l=8]  *movqi_internal/8
+	movl	$59, %eax	# 10538	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%rbx), %eax	# 10539	[c=13 l=6]  *subsi_1/1
+	movw	%dx, 1034(%rbx)	# 10536	[c=4 l=7]  *movhi_internal/3
+	sarl	$16, %edx	# 10537	[c=4 l=3]  *ashrsi3_1/0
+	cmpl	5180(%rbx), %eax	# 10540	[c=13 l=6]  *cmpsi_1/1
+	jb	.L1341	# 10541	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%rbx)	# 10543	[c=13 l=7]  *cmpqi_ccno_1/1
+	jne	.L1342	# 10544	[c=13 l=6]  *jcc
+.L1341:
+	movq	1040(%rbx), %rax	# 10547	[c=9 l=7]  *movdi_internal/3
+	movb	%dl, 59(%rax)	# 10548	[c=4 l=3]  *movqi_internal/8
+	jmp	.L1343	# 18489	[c=1 l=5]  jump
+.L1344:
+	movl	992(%rbx), %eax	# 10571	[c=9 l=6]  *movsi_internal/0
+	movzwl	1034(%rbx), %edx	# 10570	[c=13 l=7]  *zero_extendhisi2/0
+	movq	1056(%rbx), %rcx	# 10576	[c=9 l=7]  *movdi_internal/3
+	leal	1(%rax,%rax), %eax	# 10573	[c=8 l=4]  *leasi
+	andl	%edx, %eax	# 10574	[c=4 l=2]  *andsi_1/0
+	cltq	# 10575	[c=4 l=2]  *extendsidi2_rex64/0
+	movzbl	(%rcx,%rax), %ecx	# 10577	[c=9 l=4]  *movqi_internal/4
+	movzbl	10(%r15), %eax	# 10579	[c=13 l=5]  zero_extendqidi2/0
+	movb	%cl, 1004(%rbx,%rax)	# 10580	[c=4 l=7]  *movqi_internal/8
+	leal	1(%rdx), %eax	# 16107	[c=4 l=3]  *leasi
+	movw	%ax, 1034(%rbx)	# 10582	[c=4 l=7]  *movhi_internal/3
+.L1358:
+	movl	(%rbx), %eax	# 10757	[c=6 l=2]  *zero_extendsidi2/3
+	movq	%rax, %rdx	# 16880	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rax	# 10759	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %rax	# 10761	[c=13 l=7]  *adddi_1/1
+	addl	$1, %edx	# 10762	[c=4 l=3]  *addsi_1/0
+	cmpb	$0, 844(%rbx)	# 10765	[c=13 l=7]  *cmpqi_ccno_1/1
+	movl	%edx, (%rbx)	# 10763	[c=4 l=2]  *movsi_internal/1
+	movzbl	10(%rax), %esi	# 10764	[c=13 l=4]  zero_extendqidi2/0
+	jne	.L1778	# 10766	[c=13 l=6]  *jcc
+	movzwl	1030(%rbx), %r13d	# 10779	[c=13 l=8]  zero_extendhidi2/0
+	movzbl	1004(%rbx,%rsi), %ecx	# 10782	[c=10 l=8]  *movqi_internal/4
+	movl	%r13d, %eax	# 14800	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdx	# 16881	[c=4 l=3]  *movdi_internal/3
+	subl	5176(%rbx), %eax	# 10784	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %eax	# 10785	[c=13 l=6]  *cmpsi_1/1
+	jb	.L1361	# 10786	[c=13 l=2]  *jcc
+	movl	%r13d, %eax	# 14802	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %eax	# 10788	[c=4 l=3]  *ashrsi3_1/0
+	cltq	# 10789	[c=4 l=2]  *extendsidi2_rex64/0
+	cmpb	$0, 1080(%rbx,%rax)	# 10790	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L1362	# 10791	[c=13 l=6]  *jcc
+.L1361:
+	movq	1040(%rbx), %rax	# 10795	[c=9 l=7]  *movdi_internal/3
+	movb	%cl, (%rax,%rdx)	# 10796	[c=4 l=3]  *movqi_internal/8
+.L1363:
+	leal	1(%r13), %eax	# 16101	[c=4 l=4]  *leasi
+	subq	$1, 48(%rbx)	# 10808	[c=13 l=5]  *adddi_1/0
+	movw	%ax, 1030(%rbx)	# 10810	[c=4 l=7]  *movhi_internal/3
+.L1360:
+	movl	(%rbx), %eax	# 10814	[c=6 l=2]  *zero_extendsidi2/3
+	movq	1064(%rbx), %r15	# 10813	[c=9 l=7]  *movdi_internal/3
+	movq	%rax, %rsi	# 16882	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rax	# 10816	[c=4 l=4]  *ashldi3_1/0
+	addq	%r15, %rax	# 10817	[c=4 l=3]  *adddi_1/0
+	leal	1(%rsi), %ecx	# 16100	[c=5 l=3]  *leadi
+	movzwl	12(%rax), %edi	# 10820	[c=9 l=4]  *movhi_internal/2
+	movl	%ecx, (%rbx)	# 10819	[c=4 l=2]  *movsi_internal/1
+	movzbl	10(%rax), %eax	# 10822	[c=13 l=4]  zero_extendqidi2/0
+	movl	%edi, %edx	# 14806	[c=4 l=2]  *movsi_internal/0
+	movzbl	1004(%rbx,%rax), %eax	# 10823	[c=14 l=8]  *zero_extendqisi2/0
+	andl	$136, %edx	# 10828	[c=4 l=6]  *andsi_1/0
+	movl	%eax, %r8d	# 14804	[c=4 l=3]  *movsi_internal/0
+	subl	%edi, %eax	# 10832	[c=4 l=2]  *subsi_1/0
+	movzbl	100(%rbx), %edi	# 10837	[c=9 l=4]  *movqi_internal/4
+	andl	$136, %r8d	# 10825	[c=4 l=7]  *andsi_1/0
+	andl	$511, %eax	# 10833	[c=4 l=5]  *andsi_1/0
+	leal	(%rdx,%r8,2), %edx	# 10829	[c=8 l=4]  *leasi
+	imull	$260, %edx, %edx	# 10834	[c=12 l=6]  *mulsi3_1/1
+	andl	$7680, %edx	# 10835	[c=4 l=6]  *andsi_1/0
+	orl	%eax, %edx	# 10836	[c=5 l=2]  *iorsi_1_zext
+	movl	%edi, %eax	# 14808	[c=4 l=2]  *movsi_internal/0
+	andl	$192, %eax	# 10840	[c=4 l=5]  *andsi_2/0
+	jne	.L1364	# 10841	[c=13 l=6]  *jcc
+	leaq	flag_update_table_sub8(%rip), %rax	# 10844	[c=1 l=7]  *movdi_internal/4
+	movl	$63, %edi	# 67	[c=4 l=5]  *movqi_internal/3
+	leaq	(%rax,%rdx), %r8	# 16099	[c=4 l=4]  *leadi
+	leaq	101(%rbx), %rdx	# 12297	[c=4 l=4]  *leadi
+.L1365:
+	salq	$4, %rcx	# 10865	[c=4 l=4]  *ashldi3_1/0
+	addl	$2, %esi	# 10867	[c=4 l=3]  *addsi_1/0
+	movq	%r8, 104(%rbx)	# 10862	[c=4 l=4]  *movdi_internal/5
+	movb	%dil, 100(%rbx)	# 10863	[c=4 l=4]  *movqi_internal/8
+	addq	%rcx, %r15	# 10866	[c=4 l=3]  *adddi_1/0
+	movl	%esi, (%rbx)	# 10868	[c=4 l=2]  *movsi_internal/1
+	jmp	.L726	# 18492	[c=1 l=5]  jump
+.L1352:
+	movl	$59, %eax	# 10701	[c=4 l=5]  *movsi_internal/0
+	movzbl	10(%r15), %r13d	# 10699	[c=13 l=5]  zero_extendqidi2/0
+	movzwl	1034(%rbx), %r14d	# 10700	[c=13 l=8]  *zero_extendhisi2/0
+	subl	5176(%rbx), %eax	# 10702	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %eax	# 10703	[c=13 l=6]  *cmpsi_1/1
+	jb	.L1353	# 10704	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%rbx)	# 10706	[c=13 l=7]  *cmpqi_ccno_1/1
+	jne	.L1354	# 10707	[c=13 l=6]  *jcc
+.L1353:
+	movq	1040(%rbx), %rax	# 10710	[c=9 l=7]  *movdi_internal/3
+	movzbl	59(%rax), %edx	# 10711	[c=13 l=4]  *zero_extendqisi2/0
+.L1355:
+	movl	992(%rbx), %eax	# 10724	[c=9 l=6]  *movsi_internal/0
+	sall	$16, %edx	# 10722	[c=4 l=3]  *ashlsi3_1/0
+	movq	1056(%rbx), %rcx	# 10729	[c=9 l=7]  *movdi_internal/3
+	orl	%r14d, %edx	# 10723	[c=4 l=3]  *iorsi_1/0
+	leal	1(%rax,%rax), %eax	# 10726	[c=8 l=4]  *leasi
+	andl	%edx, %eax	# 10727	[c=4 l=2]  *andsi_1/0
+	addl	$1, %edx	# 10733	[c=4 l=3]  *addsi_1/0
+	cltq	# 10728	[c=4 l=2]  *extendsidi2_rex64/0
+	movzbl	(%rcx,%rax), %eax	# 10730	[c=9 l=4]  *movqi_internal/4
+	movb	%al, 1004(%rbx,%r13)	# 10732	[c=4 l=8]  *movqi_internal/8
+	movl	$59, %eax	# 10736	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%rbx), %eax	# 10737	[c=13 l=6]  *subsi_1/1
+	movw	%dx, 1034(%rbx)	# 10734	[c=4 l=7]  *movhi_internal/3
+	sarl	$16, %edx	# 10735	[c=4 l=3]  *ashrsi3_1/0
+	cmpl	5180(%rbx), %eax	# 10738	[c=13 l=6]  *cmpsi_1/1
+	jb	.L1356	# 10739	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%rbx)	# 10741	[c=13 l=7]  *cmpqi_ccno_1/1
+	jne	.L1357	# 10742	[c=13 l=6]  *jcc
+.L1356:
+	movq	1040(%rbx), %rax	# 10745	[c=9 l=7]  *movdi_internal/3
+	movb	%dl, 59(%rax)	# 10746	[c=4 l=3]  *movqi_internal/8
+	jmp	.L1358	# 18494	[c=1 l=5]  jump
+.L1366:
+	cmpb	$0, 844(%rbx)	# 10874	[c=13 l=7]  *cmpqi_ccno_1/1
+	movzbl	10(%r15), %esi	# 10873	[c=13 l=5]  zero_extendqidi2/0
+	jne	.L1779	# 10875	[c=13 l=6]  *jcc
+	movzwl	1030(%rbx), %r13d	# 10888	[c=13 l=8]  zero_extendhidi2/0
+	movzbl	1004(%rbx,%rsi), %ecx	# 10891	[c=10 l=8]  *movqi_internal/4
+	movl	%r13d, %eax	# 14814	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdx	# 16883	[c=4 l=3]  *movdi_internal/3
+	subl	5176(%rbx), %eax	# 10893	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %eax	# 10894	[c=13 l=6]  *cmpsi_1/1
+	jb	.L1369	# 10895	[c=13 l=2]  *jcc
+	movl	%r13d, %eax	# 14816	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %eax	# 10897	[c=4 l=3]  *ashrsi3_1/0
+	cltq	# 10898	[c=4 l=2]  *extendsidi2_rex64/0
+	cmpb	$0, 1080(%rbx,%rax)	# 10899	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L1370	# 10900	[c=13 l=6]  *jcc
+.L1369:
+	movq	1040(%rbx), %rax	# 10904	[c=9 l=7]  *movdi_internal/3
+	movb	%cl, (%rax,%rdx)	# 10905	[c=4 l=3]  *movqi_internal/8
+.L1371:
+	leal	1(%r13), %eax	# 16096	[c=4 l=4]  *leasi
+	subq	$1, 48(%rbx)	# 10917	[c=13 l=5]  *adddi_1/0
+	movw	%ax, 1030(%rbx)	# 10919	[c=4 l=7]  *movhi_internal/3
+.L1368:
+	movl	(%rbx), %eax	# 10923	[c=6 l=2]  *zero_extendsidi2/3
+	movq	1064(%rbx), %r15	# 10922	[c=9 l=7]  *movdi_internal/3
+	movq	%rax, %rdi	# 16884	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rax	# 10925	[c=4 l=4]  *ashldi3_1/0
+	addq	%r15, %rax	# 10926	[c=4 l=3]  *adddi_1/0
+	leal	1(%rdi), %esi	# 16094	[c=5 l=3]  *leadi
+	movzwl	12(%rax), %ecx	# 10929	[c=9 l=4]  *movhi_internal/2
+	movl	%esi, (%rbx)	# 10928	[c=4 l=2]  *movsi_internal/1
+	movzbl	10(%rax), %eax	# 10931	[c=13 l=4]  zero_extendqidi2/0
+	movl	%ecx, %edx	# 14820	[c=4 l=2]  *movsi_internal/0
+	movzbl	1004(%rbx,%rax), %eax	# 10932	[c=14 l=8]  *zero_extendqisi2/0
+	andl	$136, %edx	# 10937	[c=4 l=6]  *andsi_1/0
+	movl	%eax, %r8d	# 14818	[c=4 l=3]  *movsi_internal/0
+	subl	%ecx, %eax	# 10941	[c=4 l=2]  *subsi_1/0
+	movzbl	100(%rbx), %ecx	# 10946	[c=9 l=4]  *movqi_internal/4
+	andl	$136, %r8d	# 10934	[c=4 l=7]  *andsi_1/0
+	andl	$511, %eax	# 10942	[c=4 l=5]  *andsi_1/0
+	leal	(%rdx,%r8,2), %edx	# 10938	[c=8 l=4]  *leasi
+	movl	%ecx, %r9d	# 14824	[c=4 l=3]  *movsi_internal/0
+	imull	$260, %edx, %edx	# 10943	[c=12 l=6]  *mulsi3_1/1
+	andl	$7680, %edx	# 10944	[c=4 l=6]  *andsi_1/0
+	orl	%edx, %eax	# 10945	[c=4 l=2]  *iorsi_1/0
+	leaq	101(%rbx), %rdx	# 16095	[c=4 l=4]  *leadi
+	movl	%eax, %r8d	# 14823	[c=1 l=3]  *zero_extendsidi2/3
+	andl	$192, %r9d	# 10950	[c=4 l=7]  *andsi_2/0
+	jne	.L1372	# 10951	[c=13 l=6]  *jcc
+	leaq	flag_update_table_sub8(%rip), %rax	# 10954	[c=1 l=7]  *movdi_internal/4
+	movl	$63, %ecx	# 69	[c=4 l=5]  *movqi_internal/3
+	addq	%rax, %r8	# 10955	[c=4 l=3]  *adddi_1/0
+.L1373:
+	salq	$4, %rsi	# 10974	[c=4 l=4]  *ashldi3_1/0
+	leal	2(%rdi), %r9d	# 16088	[c=4 l=4]  *leasi
+	movb	%cl, 100(%rbx)	# 10972	[c=4 l=3]  *movqi_internal/8
+	movq	1040(%rbx), %r13	# 10986	[c=9 l=7]  *movdi_internal/3
+	addq	%r15, %rsi	# 10975	[c=4 l=3]  *adddi_1/0
+	movq	%r8, 104(%rbx)	# 10971	[c=4 l=4]  *movdi_internal/5
+	addl	$3, %edi	# 11024	[c=4 l=3]  *addsi_1/0
+	movl	%r9d, (%rbx)	# 10977	[c=4 l=3]  *movsi_internal/1
+	movzbl	(%r8), %r8d	# 10985	[c=5 l=4]  *movqi_internal/4
+	movl	%r9d, 24(%rsp)	# 15806	[c=4 l=5]  *movsi_internal/1
+	movzbl	10(%rsi), %r9d	# 10979	[c=13 l=5]  zero_extendqidi2/0
+	movzwl	12(%rsi), %esi	# 10982	[c=13 l=4]  zero_extendhidi2/0
+	movzbl	1004(%rbx,%r9), %r14d	# 10980	[c=10 l=9]  *movqi_internal/4
+	movzbl	1004(%rbx,%rsi), %r9d	# 10983	[c=14 l=9]  *zero_extendqisi2/0
+	movzbl	%cl, %esi	# 10984	[c=4 l=3]  *zero_extendqisi2/0
+	andl	%r8d, %ecx	# 16089	[c=4 l=3]  *andsi_1/0
+	movb	%r14b, 16(%rsp)	# 14828	[c=4 l=5]  *movqi_internal/8
+	movzbl	63(%r13), %r14d	# 10987	[c=13 l=5]  *zero_extendqisi2/0
+	movl	%esi, %r13d	# 14829	[c=4 l=3]  *movsi_internal/0
+	movzbl	%cl, %ecx	# 10991	[c=4 l=3]  *zero_extendqisi2/0
+	notl	%r13d	# 10988	[c=4 l=3]  *one_cmplsi2_1/0
+	andl	$-64, %esi	# 10999	[c=4 l=3]  *andsi_1/0
+	movq	%rdx, 104(%rbx)	# 11020	[c=4 l=4]  *movdi_internal/5
+	andl	%r14d, %r13d	# 10989	[c=4 l=3]  *andsi_1/0
+	andl	%esi, %r8d	# 16090	[c=4 l=3]  *andsi_1/0
+	orl	$63, %esi	# 16092	[c=4 l=3]  *iorsi_1/0
+	movl	%edi, (%rbx)	# 11025	[c=4 l=2]  *movsi_internal/1
+	orl	%ecx, %r13d	# 10992	[c=4 l=3]  *iorsi_1/0
+	movl	16(%rsp), %ecx	# 14833	[c=9 l=4]  *movsi_internal/0
+	movb	%sil, 100(%rbx)	# 11019	[c=4 l=4]  *movqi_internal/8
+	movl	%r13d, %r14d	# 14832	[c=4 l=3]  *movsi_internal/0
+	andl	$136, %ecx	# 10994	[c=4 l=6]  *andsi_1/0
+	movl	%ecx, %r13d	# 14834	[c=4 l=3]  *movsi_internal/0
+	movl	%r9d, %ecx	# 14835	[c=4 l=3]  *movsi_internal/0
+	andl	$136, %ecx	# 10997	[c=4 l=6]  *andsi_1/0
+	leal	(%rcx,%r13,2), %ecx	# 10998	[c=8 l=4]  *leasi
+	movzbl	16(%rsp), %r13d	# 11002	[c=13 l=6]  *zero_extendqisi2/0
+	imull	$260, %ecx, %ecx	# 11008	[c=12 l=6]  *mulsi3_1/1
+	subl	%r9d, %r13d	# 11004	[c=4 l=3]  *subsi_1/0
+	movl	%r14d, %r9d	# 14838	[c=4 l=3]  *movsi_internal/0
+	orl	$-3, %r14d	# 11013	[c=4 l=4]  *iorsi_1/0
+	andl	$1, %r9d	# 11005	[c=4 l=4]  *andsi_1/0
+	subl	%r9d, %r13d	# 11006	[c=4 l=3]  *subsi_1/0
+	andl	$7680, %ecx	# 11009	[c=4 l=6]  *andsi_1/0
+	andl	$511, %r13d	# 11007	[c=4 l=7]  *andsi_1/0
+	orl	%ecx, %r13d	# 11010	[c=4 l=3]  *iorsi_1/0
+	movl	%r13d, %ecx	# 11011	[c=1 l=3]  *zero_extendsidi2/3
+	andb	(%rax,%rcx), %r14b	# 11014	[c=13 l=4]  *andqi_1/1
+	movl	24(%rsp), %eax	# 11021	[c=10 l=4]  *zero_extendsidi2/3
+	orl	%r8d, %r14d	# 16091	[c=4 l=3]  *iorsi_1/0
+	salq	$4, %rax	# 11022	[c=4 l=4]  *ashldi3_1/0
+	movb	%r14b, 101(%rbx)	# 11017	[c=4 l=4]  *movqi_internal/8
+	addq	%rax, %r15	# 11023	[c=4 l=3]  *adddi_1/0
+	jmp	.L682	# 18497	[c=1 l=5]  jump
+.L625:
+	movq	10984(%rbx), %rdx	# 11033	[c=9 l=7]  *movdi_internal/3
+	movq	%r15, %rax	# 14841	[c=4 l=3]  *movdi_internal/3
+	subq	1064(%rbx), %rax	# 11030	[c=13 l=7]  *subdi_1/1
+	movq	%r10, %rcx	# 17254	[c=4 l=3]  *movdi_internal/3
+	sarq	$4, %rax	# 11031	[c=4 l=4]  *ashrdi3_1/0
+	leaq	handler.2(%rip), %r14	# 11036	[c=1 l=7]  *movdi_internal/4
+	addq	$1, (%rdx,%rax,8)	# 11035	[c=14 l=5]  *adddi_1/0
+	movzbl	8(%r15), %eax	# 11038	[c=13 l=5]  zero_extendqidi2/0
+	movq	%r12, %rdx	# 17255	[c=4 l=3]  *movdi_internal/3
+	movq	(%r14,%rax,8), %r14	# 11039	[c=10 l=4]  *movdi_internal/3
+	movq	%r11, %rax	# 17256	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 17257	[c=4 l=3]  *indirect_jump
+.L633:
+	movq	%r15, %rsi	# 14862	[c=4 l=3]  *movdi_internal/3
+	subq	1064(%rbx), %rsi	# 11284	[c=13 l=7]  *subdi_1/1
+	movq	%rbx, %rdi	# 11288	[c=4 l=3]  *movdi_internal/3
+	sarq	$4, %rsi	# 11285	[c=4 l=4]  *ashrdi3_1/0
+	call	hle_routine@PLT	# 11289	[c=10 l=5]  *call_value
+	movq	1040(%rbx), %rdx	# 11294	[c=9 l=7]  *movdi_internal/3
+	movzbl	100(%rbx), %ecx	# 11296	[c=13 l=4]  *zero_extendqisi2/0
+	leaq	1004(%rbx), %r8	# 16073	[c=4 l=7]  *leadi
+	movq	%rax, %r13	# 11290	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, 112(%rsp)	# 11291	[c=4 l=5]  *movdi_internal/5
+	leaq	flag_update_table_add8(%rip), %r10	# 15832	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_sub8(%rip), %r11	# 15834	[c=1 l=7]  *movdi_internal/4
+	movzbl	63(%rdx), %esi	# 11297	[c=13 l=4]  *zero_extendqisi2/0
+	movl	%ecx, %eax	# 16886	[c=4 l=2]  *movsi_internal/0
+	notl	%ecx	# 11299	[c=4 l=2]  *one_cmplsi2_1/0
+	movq	%r8, 120(%rsp)	# 11293	[c=4 l=5]  *movdi_internal/5
+	movq	%rdx, 128(%rsp)	# 11295	[c=4 l=8]  *movdi_internal/5
+	andl	%esi, %ecx	# 11300	[c=4 l=2]  *andsi_1/0
+	movq	104(%rbx), %rsi	# 11301	[c=9 l=4]  *movdi_internal/3
+	andb	(%rsi), %al	# 11302	[c=9 l=2]  *andqi_1/1
+	movl	$-1, 152(%rsp)	# 11310	[c=4 l=11]  *movsi_internal/1
+	movzbl	%al, %eax	# 11303	[c=4 l=3]  *zero_extendqisi2/0
+	orl	%ecx, %eax	# 11304	[c=4 l=2]  *iorsi_1/0
+	xorl	%ecx, %ecx	# 18154	[c=4 l=2]  *movdi_xor
+	movb	%al, 136(%rsp)	# 11305	[c=4 l=7]  *movqi_internal/8
+	movq	%r15, %rax	# 14864	[c=4 l=3]  *movdi_internal/3
+	subq	1064(%rbx), %rax	# 11307	[c=13 l=7]  *subdi_1/1
+	sarq	$4, %rax	# 11308	[c=4 l=4]  *ashrdi3_1/0
+	movq	%rcx, 140(%rsp)	# 18155	[c=4 l=8]  *movdi_internal/5
+	movl	%eax, 148(%rsp)	# 11309	[c=4 l=7]  *movsi_internal/1
+	movq	10976(%rbx), %rax	# 11311	[c=9 l=7]  *movdi_internal/3
+	testq	%rax, %rax	# 11312	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L1390	# 11313	[c=13 l=6]  *jcc
+	cmpq	$0, (%rax)	# 11315	[c=9 l=4]  *cmpdi_ccno_1/1
+	je	.L1390	# 11316	[c=13 l=6]  *jcc
+.L1391:
+	movq	40(%r13), %r14	# 11318	[c=9 l=4]  *movdi_internal/3
+	movq	%r10, %rcx	# 17214	[c=4 l=3]  *movdi_internal/3
+	movq	%r12, %rdx	# 17215	[c=4 l=3]  *movdi_internal/3
+	movq	%r11, %rax	# 17216	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 17217	[c=4 l=3]  *indirect_jump
+.L1431:
+	movl	5176(%rbx), %edx	# 11839	[c=9 l=6]  *movsi_internal/0
+	movq	10976(%rbx), %rcx	# 11837	[c=9 l=7]  *movdi_internal/3
+	movl	$61, %eax	# 11841	[c=4 l=5]  *movsi_internal/0
+	movl	5180(%rbx), %r13d	# 11840	[c=9 l=7]  *movsi_internal/0
+	subl	%edx, %eax	# 11842	[c=4 l=2]  *subsi_1/0
+	movq	16(%rcx), %r14	# 11838	[c=9 l=4]  *movdi_internal/3
+	cmpl	%r13d, %eax	# 11843	[c=4 l=3]  *cmpsi_1/0
+	jb	.L1432	# 11844	[c=13 l=6]  *jcc
+	cmpb	$1, 1081(%rbx)	# 11848	[c=13 l=7]  *cmpqi_1/0
+	ja	.L1780	# 11849	[c=13 l=6]  *jcc
+	movq	1040(%rbx), %rax	# 12085	[c=9 l=7]  *movdi_internal/3
+	movzbl	61(%rax), %r8d	# 12086	[c=13 l=5]  *zero_extendqisi2/0
+.L1434:
+	movzbl	62(%rax), %eax	# 11886	[c=13 l=4]  *zero_extendqisi2/0
+.L1436:
+	sall	$8, %eax	# 11889	[c=4 l=3]  *ashlsi3_1/0
+	orl	%r8d, %eax	# 11890	[c=4 l=3]  *iorsi_1/0
+	cmpl	%eax, 24(%rcx)	# 11891	[c=13 l=3]  *cmpsi_1/0
+	je	.L1781	# 11892	[c=13 l=6]  *jcc
+.L635:
+	movq	%r10, %rcx	# 12621	[c=4 l=3]  *movdi_internal/3
+	movq	%r12, %rdx	# 12622	[c=4 l=3]  *movdi_internal/3
+	movq	%r11, %rax	# 12623	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 334	[c=4 l=3]  *indirect_jump
+.L876:
+	cmpb	$0, 844(%rbx)	# 3639	[c=13 l=7]  *cmpqi_ccno_1/1
+	movzbl	10(%r15), %r13d	# 3638	[c=13 l=5]  *zero_extendqisi2/0
+	jne	.L1782	# 3640	[c=13 l=6]  *jcc
+	movzwl	1030(%rbx), %esi	# 3653	[c=13 l=7]  zero_extendhidi2/0
+	movl	%esi, %edx	# 14056	[c=4 l=2]  *movsi_internal/0
+	movq	%rsi, %rax	# 16717	[c=4 l=3]  *movdi_internal/3
+	subl	5176(%rbx), %edx	# 3655	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %edx	# 3656	[c=13 l=6]  *cmpsi_1/1
+	jb	.L879	# 3657	[c=13 l=2]  *jcc
+	movl	%esi, %edx	# 14058	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %edx	# 3660	[c=4 l=3]  *ashrsi3_1/0
+	movslq	%edx, %rdx	# 3661	[c=4 l=3]  *extendsidi2_rex64/1
+	cmpb	$0, 1080(%rbx,%rdx)	# 3662	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L880	# 3663	[c=13 l=6]  *jcc
+.L879:
+	movq	1040(%rbx), %rdx	# 3667	[c=9 l=7]  *movdi_internal/3
+	movzbl	(%rdx,%rax), %edx	# 3668	[c=13 l=4]  *zero_extendqisi2/0
+.L881:
+	movslq	%r13d, %rax	# 3679	[c=4 l=3]  *extendsidi2_rex64/1
+	movb	%dl, 1004(%rbx,%rax)	# 3680	[c=4 l=7]  *movqi_internal/8
+	subq	$1, 48(%rbx)	# 3681	[c=13 l=5]  *adddi_1/0
+.L878:
+	movl	(%rbx), %r15d	# 3684	[c=6 l=3]  *zero_extendsidi2/3
+	movq	%r10, %rcx	# 17774	[c=4 l=3]  *movdi_internal/3
+	movq	%r15, %rdx	# 16718	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 3686	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 3688	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%r15), %eax	# 3689	[c=13 l=5]  *zero_extendqisi2/0
+	movq	(%r15), %r14	# 3692	[c=5 l=3]  *movdi_internal/3
+	addl	%edx, %eax	# 3690	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 17775	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 3691	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 17776	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 17777	[c=4 l=3]  *indirect_jump
+.L623:
+	movq	%r15, %r13	# 14854	[c=4 l=3]  *movdi_internal/3
+	subq	1064(%rbx), %r13	# 11165	[c=13 l=7]  *subdi_1/1
+	movq	%rbx, %rdi	# 11170	[c=4 l=3]  *movdi_internal/3
+	sarq	$4, %r13	# 11166	[c=4 l=4]  *ashrdi3_1/0
+	movl	%r13d, %esi	# 11169	[c=4 l=3]  *movsi_internal/0
+	movl	%r13d, %r14d	# 11168	[c=4 l=3]  *movsi_internal/0
+	call	jit_hot@PLT	# 11171	[c=10 l=5]  *call_value
+	leaq	flag_update_table_add8(%rip), %r10	# 15813	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_sub8(%rip), %r11	# 15815	[c=1 l=7]  *movdi_internal/4
+	testb	%al, %al	# 11173	[c=4 l=2]  *cmpqi_ccno_1/0
+	jne	.L1385	# 11174	[c=13 l=6]  *jcc
+	movzbl	8(%r15), %eax	# 11178	[c=13 l=5]  zero_extendqidi2/0
+	leaq	handler.2(%rip), %r14	# 11176	[c=1 l=7]  *movdi_internal/4
+	movq	%r10, %rcx	# 17238	[c=4 l=3]  *movdi_internal/3
+	movq	%r12, %rdx	# 17239	[c=4 l=3]  *movdi_internal/3
+	movq	(%r14,%rax,8), %r14	# 11179	[c=10 l=4]  *movdi_internal/3
+	movq	%r11, %rax	# 17240	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 17241	[c=4 l=3]  *indirect_jump
+.L607:
+	movzbl	100(%rbx), %eax	# 11213	[c=9 l=4]  *movqi_internal/4
+	testb	%al, %al	# 11214	[c=4 l=2]  *cmpqi_ccno_1/0
+	je	.L1387	# 11215	[c=13 l=2]  *jcc
+	movq	1040(%rbx), %rsi	# 11217	[c=9 l=7]  *movdi_internal/3
+	movzbl	%al, %ecx	# 11219	[c=4 l=3]  *zero_extendqisi2/0
+	notl	%ecx	# 11220	[c=4 l=2]  *one_cmplsi2_1/0
+	movzbl	63(%rsi), %edx	# 11218	[c=13 l=4]  *zero_extendqisi2/0
+	andl	%ecx, %edx	# 11221	[c=4 l=2]  *andsi_1/0
+	movq	104(%rbx), %rcx	# 11222	[c=9 l=4]  *movdi_internal/3
+	andb	(%rcx), %al	# 11223	[c=9 l=2]  *andqi_1/1
+	movzbl	%al, %eax	# 11224	[c=4 l=3]  *zero_extendqisi2/0
+	orl	%edx, %eax	# 11225	[c=4 l=2]  *iorsi_1/0
+	movb	%al, 63(%rsi)	# 11226	[c=4 l=3]  *movqi_internal/8
+	movb	$0, 100(%rbx)	# 11227	[c=4 l=4]  *movqi_internal/8
+.L1387:
+	movq	1040(%rbx), %rax	# 14858	[c=9 l=7]  *movdi_internal/3
+	subq	1064(%rbx), %r15	# 11235	[c=13 l=7]  *subdi_1/1
+	leaq	8(%rbx), %rdx	# 16074	[c=4 l=4]  *leadi
+	leaq	1004(%rbx), %rdi	# 16076	[c=4 l=7]  *leadi
+	sarq	$4, %r15	# 11236	[c=4 l=4]  *ashrdi3_1/0
+	leaq	63(%rax), %rsi	# 16075	[c=4 l=4]  *leadi
+	movq	10960(%rbx), %rax	# 11234	[c=9 l=7]  *movdi_internal/3
+	movq	8(%rax), %rax	# 11237	[c=9 l=4]  *movdi_internal/3
+	call	*(%rax,%r15,8)	# 11242	[c=19 l=4]  *call_value
+	movq	40(%rbx), %r13	# 11245	[c=9 l=4]  *movdi_internal/3
+	leaq	flag_update_table_add8(%rip), %r10	# 15824	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_sub8(%rip), %r11	# 15826	[c=1 l=7]  *movdi_internal/4
+	movl	%eax, (%rbx)	# 11244	[c=4 l=2]  *movsi_internal/1
+	movq	(%rsp), %rax	# 15822	[c=5 l=4]  *movdi_internal/3
+	testq	%rax, %rax	# 11248	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L1462	# 11249	[c=13 l=2]  *jcc
+	cmpq	%rax, %r13	# 11252	[c=4 l=3]  *cmpdi_1/0
+	jnb	.L680	# 11253	[c=13 l=6]  *jcc
+.L1462:
+	movq	56(%rbx), %rax	# 14861	[c=9 l=4]  *movdi_internal/3
+	cmpq	%rax, 48(%rbx)	# 11257	[c=13 l=4]  *cmpdi_1/0
+	jnb	.L1783	# 11258	[c=13 l=6]  *jcc
+.L1389:
+	movl	(%rbx), %r15d	# 11265	[c=6 l=3]  *zero_extendsidi2/3
+	movl	$1, 96(%rbx)	# 11270	[c=4 l=7]  *movsi_internal/1
+	movq	%r10, %rcx	# 17222	[c=4 l=3]  *movdi_internal/3
+	movq	%r15, %rdx	# 16885	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 11267	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 11269	[c=13 l=7]  *adddi_1/1
+	movzbl	11(%r15), %ebp	# 11271	[c=13 l=5]  zero_extendqidi2/0
+	movzwl	14(%r15), %eax	# 11274	[c=13 l=5]  zero_extendhidi2/0
+	addq	%rax, 48(%rbx)	# 11275	[c=13 l=4]  *adddi_1/0
+	movq	(%r15), %r14	# 11279	[c=5 l=3]  *movdi_internal/3
+	addq	%r13, %rbp	# 11272	[c=4 l=3]  *adddi_1/0
+	movq	%rbp, 40(%rbx)	# 11273	[c=4 l=4]  *movdi_internal/5
+	movzbl	9(%r15), %eax	# 11276	[c=13 l=5]  *zero_extendqisi2/0
+	addl	%edx, %eax	# 11277	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 17223	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 11278	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 17224	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 17225	[c=4 l=3]  *indirect_jump
+.L882:
+	cmpb	$0, 844(%rbx)	# 3698	[c=13 l=7]  *cmpqi_ccno_1/1
+	movzbl	10(%r15), %r13d	# 3697	[c=13 l=5]  *zero_extendqisi2/0
+	jne	.L1784	# 3699	[c=13 l=6]  *jcc
+	movzwl	1030(%rbx), %r14d	# 3712	[c=13 l=8]  *zero_extendhisi2/0
+	subl	$1, %r14d	# 3713	[c=4 l=4]  *addsi_1/0
+	movl	%r14d, %eax	# 14060	[c=4 l=3]  *movsi_internal/0
+	subl	5176(%rbx), %eax	# 3714	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %eax	# 3715	[c=13 l=6]  *cmpsi_1/1
+	jb	.L885	# 3716	[c=13 l=2]  *jcc
+	movl	%r14d, %eax	# 14062	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %eax	# 3718	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 13671	[c=5 l=5]  *andsi_1_zext
+	cmpb	$0, 1080(%rbx,%rax)	# 3721	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L886	# 3722	[c=13 l=6]  *jcc
+.L885:
+	movq	1040(%rbx), %rdx	# 3726	[c=9 l=7]  *movdi_internal/3
+	movslq	%r14d, %rax	# 3725	[c=4 l=3]  *extendsidi2_rex64/1
+	movzbl	(%rdx,%rax), %edx	# 3727	[c=13 l=4]  *zero_extendqisi2/0
+.L887:
+	movslq	%r13d, %rax	# 3738	[c=4 l=3]  *extendsidi2_rex64/1
+	movb	%dl, 1004(%rbx,%rax)	# 3739	[c=4 l=7]  *movqi_internal/8
+	movw	%r14w, 1030(%rbx)	# 3740	[c=4 l=8]  *movhi_internal/3
+.L884:
+	movl	(%rbx), %r15d	# 3743	[c=6 l=3]  *zero_extendsidi2/3
+	movq	%r10, %rcx	# 17766	[c=4 l=3]  *movdi_internal/3
+	movq	%r15, %rdx	# 16719	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 3745	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 3747	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%r15), %eax	# 3748	[c=13 l=5]  *zero_extendqisi2/0
+	movq	(%r15), %r14	# 3751	[c=5 l=3]  *movdi_internal/3
+	addl	%edx, %eax	# 3749	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 17767	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 3750	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 17768	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 17769	[c=4 l=3]  *indirect_jump
+.L621:
+	leaq	92(%rsp), %rsi	# 16087	[c=4 l=5]  *leadi
+	movq	%r15, %rdi	# 11046	[c=4 l=3]  *movdi_internal/3
+	call	delay_loop	# 11047	[c=10 l=5]  *call_value
+	leaq	flag_update_table_add8(%rip), %r10	# 15809	[c=1 l=7]  *movdi_internal/4
+	movl	%eax, %edx	# 14843	[c=4 l=2]  *movsi_internal/0
+	movl	%eax, %esi	# 11048	[c=4 l=2]  *movsi_internal/0
+	subl	$1, %edx	# 11052	[c=4 l=3]  *addsi_2/0
+	js	.L1374	# 11053	[c=13 l=6]  *jcc
+	movl	92(%rsp), %ecx	# 18164	[c=9 l=4]  *movsi_internal/0
+	addl	%edx, %ecx	# 18165	[c=4 l=2]  *addsi_1/0
+	movl	%edx, %edx	# 11063	[c=1 l=2]  *zero_extendsidi2/3
+	movslq	%ecx, %rcx	# 11057	[c=4 l=3]  *extendsidi2_rex64/1
+	leaq	1003(%rbx,%rcx), %rdi	# 11061	[c=5 l=8]  *leadi
+	leaq	1004(%rbx,%rcx), %rax	# 11059	[c=5 l=8]  *leadi
+	xorl	%ecx, %ecx	# 18166	[c=4 l=2]  *movdi_xor
+	subq	%rdx, %rdi	# 11064	[c=4 l=3]  *subdi_1/0
+	.p2align 4,,10
+	.p2align 3
+.L1375:
+	movzbl	(%rax), %edx	# 11067	[c=9 l=3]  zero_extendqidi2/0
+	salq	$8, %rcx	# 11066	[c=4 l=4]  *ashldi3_1/0
+	subq	$1, %rax	# 11069	[c=4 l=4]  *adddi_1/0
+	orq	%rdx, %rcx	# 11068	[c=4 l=3]  *iordi_1/0
+	cmpq	%rdi, %rax	# 11071	[c=4 l=3]  *cmpdi_1/0
+	jne	.L1375	# 11072	[c=13 l=2]  *jcc
+	leaq	-1(%rcx), %rdi	# 16086	[c=4 l=4]  *leadi
+	testq	%rcx, %rcx	# 11074	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L1374	# 11075	[c=13 l=6]  *jcc
+.L1377:
+	movq	(%rsp), %rdx	# 15811	[c=5 l=4]  *movdi_internal/3
+	movzbl	11(%r15), %r8d	# 11089	[c=13 l=5]  zero_extendqidi2/0
+	testq	%rdx, %rdx	# 11090	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L1378	# 11091	[c=13 l=2]  *jcc
+	xorl	%eax, %eax	# 18162	[c=4 l=2]  *movdi_xor
+	cmpq	%rdx, %rbp	# 11093	[c=4 l=3]  *cmpdi_1/0
+	jb	.L1785	# 11094	[c=13 l=6]  *jcc
+.L1379:
+	cmpq	%rax, %rdi	# 13639	[c=4 l=3]  *cmpdi_1/0
+	cmova	%rax, %rdi	# 13640	[c=8 l=4]  *movdicc_noc/1
+.L1378:
+	movzwl	14(%r15), %edx	# 11108	[c=13 l=5]  zero_extendhidi2/0
+	movq	56(%rbx), %rax	# 11106	[c=9 l=4]  *movdi_internal/3
+	movq	48(%rbx), %r9	# 11105	[c=9 l=4]  *movdi_internal/3
+	leaq	1(%rdx), %r13	# 11109	[c=4 l=4]  *leadi
+	cmpq	$-1, %rax	# 11110	[c=4 l=4]  *cmpdi_1/0
+	je	.L1380	# 11111	[c=13 l=2]  *jcc
+	leaq	1(%r9), %r14	# 16081	[c=4 l=4]  *leadi
+	xorl	%edx, %edx	# 18160	[c=4 l=2]  *movdi_xor
+	cmpq	%rax, %r14	# 11114	[c=4 l=3]  *cmpdi_1/0
+	jnb	.L1381	# 11115	[c=13 l=2]  *jcc
+	subq	$2, %rax	# 11117	[c=4 l=4]  *adddi_1/0
+	xorl	%edx, %edx	# 18159	[c=4 l=2]  *movdi_xor
+	subq	%r9, %rax	# 11118	[c=4 l=3]  *subdi_1/0
+	divq	%r13	# 16079	[c=0 l=3]  *udivmoddi4_noext
+	leaq	1(%rax), %rdx	# 16080	[c=4 l=4]  *leadi
+.L1381:
+	cmpq	%rdx, %rdi	# 13637	[c=4 l=3]  *cmpdi_1/0
+	cmova	%rdx, %rdi	# 13638	[c=8 l=4]  *movdicc_noc/1
+.L1380:
+	movq	%rcx, %rax	# 14850	[c=4 l=3]  *movdi_internal/3
+	subq	%rdi, %rax	# 11126	[c=4 l=3]  *subdi_1/0
+	testl	%esi, %esi	# 11129	[c=4 l=2]  *cmpsi_ccno_1/0
+	jle	.L1384	# 11130	[c=13 l=2]  *jcc
+	movslq	92(%rsp), %rdx	# 11147	[c=13 l=5]  *extendsidi2_rex64/1
+	sall	$3, %esi	# 11150	[c=4 l=3]  *ashlsi3_1/0
+	xorl	%ecx, %ecx	# 18158	[c=4 l=2]  *movdi_xor
+	leaq	1004(%rbx,%rdx), %rdx	# 11149	[c=5 l=8]  *leadi
+	.p2align 4,,10
+	.p2align 3
+.L1383:
+	movq	%rax, %r14	# 14852	[c=4 l=3]  *movdi_internal/3
+	addq	$1, %rdx	# 11155	[c=4 l=4]  *adddi_1/0
+	shrq	%cl, %r14	# 11152	[c=4 l=3]  *lshrdi3_1/0
+	addl	$8, %ecx	# 11154	[c=4 l=3]  *addsi_1/0
+	movb	%r14b, -1(%rdx)	# 11153	[c=4 l=4]  *movqi_internal/8
+	cmpl	%esi, %ecx	# 11157	[c=4 l=2]  *cmpsi_1/0
+	jne	.L1383	# 11158	[c=13 l=2]  *jcc
+.L1384:
+	imulq	%rdi, %r8	# 11132	[c=16 l=4]  *muldi3_1/2
+	leaq	handler.2(%rip), %r14	# 11138	[c=1 l=7]  *movdi_internal/4
+	movq	%r10, %rcx	# 17246	[c=4 l=3]  *movdi_internal/3
+	movq	%r12, %rdx	# 17247	[c=4 l=3]  *movdi_internal/3
+	imulq	%r13, %rdi	# 11135	[c=16 l=4]  *muldi3_1/2
+	addq	%r8, %rbp	# 11133	[c=4 l=3]  *adddi_1/0
+	leaq	(%rdi,%r9), %rax	# 16077	[c=4 l=4]  *leadi
+	movq	%rbp, 40(%rbx)	# 11134	[c=4 l=4]  *movdi_internal/5
+	movq	%rax, 48(%rbx)	# 11137	[c=4 l=4]  *movdi_internal/5
+	movzbl	8(%r15), %eax	# 11140	[c=13 l=5]  zero_extendqidi2/0
+	movq	(%r14,%rax,8), %r14	# 11141	[c=10 l=4]  *movdi_internal/3
+	movq	%r11, %rax	# 17248	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 17249	[c=4 l=3]  *indirect_jump
+.L1280:
+	movzbl	10(%r15), %eax	# 9677	[c=13 l=5]  zero_extendqidi2/0
+	movzwl	12(%r15), %ecx	# 9680	[c=13 l=5]  zero_extendhidi2/0
+	movzbl	1004(%rbx,%rax), %edx	# 9678	[c=14 l=8]  *zero_extendqisi2/0
+	movzbl	1004(%rbx,%rcx), %ecx	# 9681	[c=14 l=8]  *zero_extendqisi2/0
+	leal	(%rdx,%rcx), %esi	# 16132	[c=4 l=3]  *leasi
+	movb	%sil, 1004(%rbx,%rax)	# 9684	[c=4 l=8]  *movqi_internal/8
+	movl	%edx, %esi	# 14700	[c=4 l=2]  *movsi_internal/0
+	movl	%ecx, %eax	# 14702	[c=4 l=2]  *movsi_internal/0
+	addl	%ecx, %edx	# 9695	[c=4 l=2]  *addsi_1/0
+	andl	$136, %esi	# 9686	[c=4 l=6]  *andsi_1/0
+	andl	$136, %eax	# 9689	[c=4 l=5]  *andsi_1/0
+	leal	(%rax,%rsi,2), %eax	# 9690	[c=8 l=3]  *leasi
+	imull	$260, %eax, %eax	# 9691	[c=12 l=6]  *mulsi3_1/1
+	andl	$7680, %eax	# 9692	[c=4 l=5]  *andsi_1/0
+	orl	%edx, %eax	# 9696	[c=5 l=2]  *iorsi_1_zext
+	movzbl	100(%rbx), %edx	# 9697	[c=9 l=4]  *movqi_internal/4
+	movl	%edx, %ecx	# 14704	[c=4 l=2]  *movsi_internal/0
+	andl	$192, %ecx	# 9700	[c=4 l=6]  *andsi_2/0
+	jne	.L1281	# 9701	[c=13 l=6]  *jcc
+	leaq	flag_update_table_add8(%rip), %rcx	# 9704	[c=1 l=7]  *movdi_internal/4
+	movl	$63, %edx	# 60	[c=4 l=5]  *movqi_internal/3
+	addq	%rcx, %rax	# 9705	[c=4 l=3]  *adddi_1/0
+.L1282:
+	movl	(%rbx), %r15d	# 9724	[c=6 l=3]  *zero_extendsidi2/3
+	movq	%rax, 104(%rbx)	# 9722	[c=4 l=4]  *movdi_internal/5
+	movb	%dl, 100(%rbx)	# 9723	[c=4 l=3]  *movqi_internal/8
+	movq	%r15, %rax	# 16857	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 9726	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 9728	[c=13 l=7]  *adddi_1/1
+	addl	$1, %eax	# 9729	[c=4 l=3]  *addsi_1/0
+	movl	%eax, (%rbx)	# 9730	[c=4 l=2]  *movsi_internal/1
+	jmp	.L660	# 18505	[c=1 l=5]  jump
+.L1283:
+	movzbl	10(%r15), %eax	# 9736	[c=13 l=5]  zero_extendqidi2/0
+	movzwl	12(%r15), %ecx	# 9739	[c=13 l=5]  zero_extendhidi2/0
+	movzbl	1004(%rbx,%rax), %edx	# 9737	[c=14 l=8]  *zero_extendqisi2/0
+	movzbl	1004(%rbx,%rcx), %ecx	# 9740	[c=14 l=8]  *zero_extendqisi2/0
+	leal	(%rdx,%rcx), %esi	# 16129	[c=4 l=3]  *leasi
+	movb	%sil, 1004(%rbx,%rax)	# 9743	[c=4 l=8]  *movqi_internal/8
+	movl	%edx, %esi	# 14710	[c=4 l=2]  *movsi_internal/0
+	movl	%ecx, %eax	# 14712	[c=4 l=2]  *movsi_internal/0
+	addl	%ecx, %edx	# 9754	[c=4 l=2]  *addsi_1/0
+	andl	$136, %esi	# 9745	[c=4 l=6]  *andsi_1/0
+	andl	$136, %eax	# 9748	[c=4 l=5]  *andsi_1/0
+	leal	(%rax,%rsi,2), %eax	# 9749	[c=8 l=3]  *leasi
+	movzbl	100(%rbx), %esi	# 9756	[c=9 l=4]  *movqi_internal/4
+	imull	$260, %eax, %eax	# 9750	[c=12 l=6]  *mulsi3_1/1
+	andl	$7680, %eax	# 9751	[c=4 l=5]  *andsi_1/0
+	orl	%edx, %eax	# 9755	[c=5 l=2]  *iorsi_1_zext
+	movl	%esi, %edx	# 14714	[c=4 l=2]  *movsi_internal/0
+	andl	$192, %edx	# 9759	[c=4 l=6]  *andsi_2/0
+	jne	.L1284	# 9760	[c=13 l=6]  *jcc
+	leaq	flag_update_table_add8(%rip), %rcx	# 9763	[c=1 l=7]  *movdi_internal/4
+	movl	$63, %esi	# 61	[c=4 l=5]  *movqi_internal/3
+	addq	%rcx, %rax	# 9764	[c=4 l=3]  *adddi_1/0
+.L1285:
+	movl	(%rbx), %r9d	# 9784	[c=6 l=3]  *zero_extendsidi2/3
+	movq	1064(%rbx), %r15	# 9783	[c=9 l=7]  *movdi_internal/3
+	movb	%sil, 100(%rbx)	# 9782	[c=4 l=4]  *movqi_internal/8
+	movzbl	%sil, %edx	# 9791	[c=4 l=4]  *zero_extendqisi2/0
+	movq	1040(%rbx), %r13	# 9797	[c=9 l=7]  *movdi_internal/3
+	movq	%rax, 104(%rbx)	# 9781	[c=4 l=4]  *movdi_internal/5
+	movq	%r9, %r8	# 16858	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r9	# 9786	[c=4 l=4]  *ashldi3_1/0
+	movl	%edx, 24(%rsp)	# 15693	[c=4 l=4]  *movsi_internal/1
+	notl	%edx	# 9799	[c=4 l=2]  *one_cmplsi2_1/0
+	leal	1(%r8), %edi	# 16126	[c=4 l=4]  *leasi
+	addq	%r15, %r9	# 9787	[c=4 l=3]  *adddi_1/0
+	movl	%edi, (%rbx)	# 9789	[c=4 l=2]  *movsi_internal/1
+	movzbl	63(%r13), %r13d	# 9798	[c=13 l=5]  *zero_extendqisi2/0
+	movzbl	10(%r9), %r14d	# 9792	[c=13 l=5]  zero_extendqidi2/0
+	movzwl	12(%r9), %r9d	# 9795	[c=13 l=5]  zero_extendhidi2/0
+	movl	%edi, 16(%rsp)	# 16043	[c=4 l=4]  *movsi_internal/1
+	andl	%r13d, %edx	# 9800	[c=4 l=3]  *andsi_1/0
+	movzbl	(%rax), %r13d	# 18184	[c=5 l=4]  *movqi_internal/4
+	movzbl	1004(%rbx,%r14), %edi	# 18183	[c=10 l=9]  *movqi_internal/4
+	movzbl	1004(%rbx,%r9), %r9d	# 9796	[c=10 l=9]  *movqi_internal/4
+	andl	%esi, %r13d	# 19120	[c=4 l=3]  *andsi_1/0
+	movb	%dil, 32(%rsp)	# 15692	[c=4 l=5]  *movqi_internal/8
+	orl	%r13d, %edx	# 9803	[c=4 l=3]  *iorsi_1/0
+	movzbl	%dil, %r13d	# 14721	[c=4 l=4]  *zero_extendqisi2/0
+	movzbl	%r9b, %edi	# 9806	[c=4 l=4]  *zero_extendqisi2/0
+	addl	%edi, %r13d	# 9807	[c=4 l=3]  *addsi_1/0
+	andl	$1, %edx	# 9804	[c=4 l=3]  *andsi_1/0
+	andl	$136, %r9d	# 9815	[c=4 l=7]  *andsi_1/0
+	addl	%r13d, %edx	# 9808	[c=4 l=3]  *addsi_1/0
+	movl	32(%rsp), %r13d	# 14724	[c=9 l=5]  *movsi_internal/0
+	movb	%dl, 1004(%rbx,%r14)	# 9810	[c=4 l=8]  *movqi_internal/8
+	andl	$136, %r13d	# 9812	[c=4 l=7]  *andsi_1/0
+	leal	(%r9,%r13,2), %r9d	# 9816	[c=8 l=4]  *leasi
+	imull	$260, %r9d, %r9d	# 9817	[c=12 l=7]  *mulsi3_1/1
+	andl	$7680, %r9d	# 9818	[c=4 l=7]  *andsi_1/0
+	orl	%edx, %r9d	# 9819	[c=5 l=3]  *iorsi_1_zext
+	movl	24(%rsp), %edx	# 14726	[c=9 l=4]  *movsi_internal/0
+	andl	$-64, %edx	# 9821	[c=4 l=3]  *andsi_2/0
+	jne	.L1286	# 9822	[c=13 l=6]  *jcc
+	leaq	(%rcx,%r9), %rax	# 16125	[c=4 l=4]  *leadi
+	movl	$63, %esi	# 62	[c=4 l=5]  *movqi_internal/3
+.L1287:
+	movl	16(%rsp), %edi	# 9844	[c=10 l=4]  *zero_extendsidi2/3
+	addl	$2, %r8d	# 9847	[c=4 l=4]  *addsi_1/0
+	movq	%rax, 104(%rbx)	# 9842	[c=4 l=4]  *movdi_internal/5
+	movb	%sil, 100(%rbx)	# 9843	[c=4 l=4]  *movqi_internal/8
+	salq	$4, %rdi	# 9845	[c=4 l=4]  *ashldi3_1/0
+	movl	%r8d, (%rbx)	# 9848	[c=4 l=3]  *movsi_internal/1
+	addq	%rdi, %r15	# 9846	[c=4 l=3]  *adddi_1/0
+	jmp	.L660	# 18507	[c=1 l=5]  jump
+.L1312:
+	cmpb	$0, 844(%rbx)	# 10242	[c=13 l=7]  *cmpqi_ccno_1/1
+	movzbl	10(%r15), %r13d	# 10241	[c=13 l=5]  *zero_extendqisi2/0
+	jne	.L1786	# 10243	[c=13 l=6]  *jcc
+	movzwl	1030(%rbx), %r14d	# 10256	[c=13 l=8]  zero_extendhidi2/0
+	movl	%r14d, %edx	# 14770	[c=4 l=3]  *movsi_internal/0
+	movq	%r14, %rax	# 16867	[c=4 l=3]  *movdi_internal/3
+	subl	5176(%rbx), %edx	# 10259	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %edx	# 10260	[c=13 l=6]  *cmpsi_1/1
+	jb	.L1315	# 10261	[c=13 l=2]  *jcc
+	movl	%r14d, %edx	# 14772	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %edx	# 10263	[c=4 l=3]  *ashrsi3_1/0
+	movslq	%edx, %rdx	# 10264	[c=4 l=3]  *extendsidi2_rex64/1
+	cmpb	$0, 1080(%rbx,%rdx)	# 10265	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L1316	# 10266	[c=13 l=6]  *jcc
+.L1315:
+	movq	1040(%rbx), %rdx	# 10270	[c=9 l=7]  *movdi_internal/3
+	movzbl	(%rdx,%rax), %edx	# 10271	[c=13 l=4]  *zero_extendqisi2/0
+.L1317:
+	movslq	%r13d, %rax	# 10282	[c=4 l=3]  *extendsidi2_rex64/1
+	movb	%dl, 1004(%rbx,%rax)	# 10283	[c=4 l=7]  *movqi_internal/8
+	leal	1(%r14), %eax	# 16112	[c=4 l=4]  *leasi
+	subq	$1, 48(%rbx)	# 10284	[c=13 l=5]  *adddi_1/0
+	movw	%ax, 1030(%rbx)	# 10286	[c=4 l=7]  *movhi_internal/3
+	jmp	.L1326	# 18510	[c=1 l=5]  jump
+.L1272:
+	movzbl	10(%r15), %eax	# 9412	[c=13 l=5]  zero_extendqidi2/0
+	movzwl	12(%r15), %edi	# 9420	[c=13 l=5]  *zero_extendhisi2/0
+	leal	1(%rax), %esi	# 16151	[c=4 l=3]  *leasi
+	movzbl	1004(%rbx,%rax), %ecx	# 9418	[c=14 l=8]  *zero_extendqisi2/0
+	movslq	%esi, %rsi	# 9414	[c=4 l=3]  *extendsidi2_rex64/1
+	movzbl	1004(%rbx,%rsi), %edx	# 9415	[c=14 l=8]  *zero_extendqisi2/0
+	sall	$8, %edx	# 9416	[c=4 l=3]  *ashlsi3_1/0
+	orl	%ecx, %edx	# 9419	[c=4 l=2]  *iorsi_1/0
+	movl	%edx, %ecx	# 14660	[c=4 l=2]  *movsi_internal/0
+	shrl	$5, %edx	# 9429	[c=4 l=3]  *lshrsi3_1/0
+	subl	%edi, %ecx	# 9421	[c=4 l=2]  *subsi_1/0
+	andl	$1024, %edx	# 9430	[c=4 l=6]  *andsi_1/0
+	movl	%ecx, %edi	# 14662	[c=4 l=2]  *movsi_internal/0
+	movb	%cl, 1004(%rbx,%rax)	# 9423	[c=4 l=7]  *movqi_internal/8
+	leaq	flag_update_table_sub8(%rip), %rax	# 9427	[c=1 l=7]  *movdi_internal/4
+	sarl	$8, %edi	# 9424	[c=4 l=3]  *ashrsi3_1/0
+	movb	%dil, 1004(%rbx,%rsi)	# 9426	[c=4 l=8]  *movqi_internal/8
+	andl	$511, %edi	# 9431	[c=4 l=6]  *andsi_1/0
+	orl	%edi, %edx	# 9432	[c=4 l=2]  *iorsi_1/0
+	movslq	%edx, %rdx	# 9433	[c=4 l=3]  *extendsidi2_rex64/1
+	movzbl	(%rax,%rdx), %edx	# 9434	[c=13 l=4]  *zero_extendqisi2/0
+	xorl	%eax, %eax	# 18195	[c=4 l=2]  *movsi_xor
+	testw	%cx, %cx	# 18196	[c=4 l=3]  *cmphi_ccno_1/0
+	movq	104(%rbx), %rcx	# 9445	[c=9 l=4]  *movdi_internal/3
+	setne	%al	# 18197	[c=4 l=3]  *setcc_qi_slp
+	addl	%eax, %eax	# 9439	[c=4 l=2]  *ashlsi3_1/0
+	movzbl	(%rcx), %edi	# 18198	[c=5 l=3]  *movqi_internal/4
+	notl	%eax	# 9440	[c=4 l=2]  *one_cmplsi2_1/0
+	andl	%eax, %edx	# 9441	[c=4 l=2]  *andsi_1/0
+	movzbl	100(%rbx), %eax	# 9442	[c=13 l=4]  *zero_extendqisi2/0
+	andl	$-33, %edx	# 9447	[c=4 l=3]  *andsi_1/0
+	andl	$-32, %eax	# 9443	[c=4 l=3]  *andsi_1/0
+	andl	%eax, %edi	# 19119	[c=4 l=2]  *andsi_1/0
+	orl	$31, %eax	# 16155	[c=4 l=3]  *iorsi_1/0
+	movl	%edi, %ecx	# 14665	[c=4 l=2]  *movqi_internal/1
+	movb	%al, 100(%rbx)	# 9451	[c=4 l=3]  *movqi_internal/8
+	orl	%ecx, %edx	# 16154	[c=4 l=2]  *iorsi_1/0
+	movb	%dl, 101(%rbx)	# 9449	[c=4 l=3]  *movqi_internal/8
+	jmp	.L1566	# 18512	[c=1 l=5]  jump
+.L1274:
+	movzbl	10(%r15), %ecx	# 9519	[c=13 l=5]  zero_extendqidi2/0
+	movzbl	1004(%rbx,%rcx), %edx	# 9520	[c=10 l=8]  *movqi_internal/4
+	leal	-1(%rdx), %eax	# 16143	[c=4 l=3]  *leasi
+	subl	$1, %edx	# 16144	[c=4 l=3]  *addsi_1/0
+	movb	%dl, 1004(%rbx,%rcx)	# 9526	[c=4 l=7]  *movqi_internal/8
+	movzbl	100(%rbx), %edx	# 9527	[c=9 l=4]  *movqi_internal/4
+	movzbl	%al, %eax	# 9523	[c=4 l=3]  zero_extendqidi2/0
+	movl	%edx, %ecx	# 14672	[c=4 l=2]  *movsi_internal/0
+	andl	$225, %ecx	# 9530	[c=4 l=6]  *andsi_2/0
+	jne	.L1275	# 9531	[c=13 l=6]  *jcc
+	leaq	flag_update_table_dec(%rip), %rdx	# 9534	[c=1 l=7]  *movdi_internal/4
+	addq	%rdx, %rax	# 9535	[c=4 l=3]  *adddi_1/0
+	movl	$30, %edx	# 58	[c=4 l=5]  *movqi_internal/3
+.L1276:
+	movq	%rax, 104(%rbx)	# 9552	[c=4 l=4]  *movdi_internal/5
+	movb	%dl, 100(%rbx)	# 9553	[c=4 l=3]  *movqi_internal/8
+	jmp	.L1565	# 18514	[c=1 l=5]  jump
+.L1277:
+	movzbl	10(%r15), %esi	# 9567	[c=13 l=5]  zero_extendqidi2/0
+	movzwl	12(%r15), %edi	# 9565	[c=13 l=5]  *zero_extendhisi2/0
+	movzbl	1004(%rbx,%rsi), %eax	# 9568	[c=14 l=8]  *zero_extendqisi2/0
+	movl	%edi, %edx	# 16854	[c=4 l=2]  *movsi_internal/0
+	andl	$136, %edx	# 9578	[c=4 l=6]  *andsi_1/0
+	movl	%eax, %ecx	# 16853	[c=4 l=2]  *movsi_internal/0
+	subl	%edi, %eax	# 9571	[c=4 l=2]  *subsi_1/0
+	andl	$136, %ecx	# 9575	[c=4 l=6]  *andsi_1/0
+	movb	%al, 1004(%rbx,%rsi)	# 9573	[c=4 l=7]  *movqi_internal/8
+	movzbl	100(%rbx), %esi	# 9584	[c=9 l=4]  *movqi_internal/4
+	andl	$511, %eax	# 9582	[c=4 l=5]  *andsi_1/0
+	leal	(%rdx,%rcx,2), %edx	# 9579	[c=8 l=3]  *leasi
+	imull	$260, %edx, %edx	# 9580	[c=12 l=6]  *mulsi3_1/1
+	andl	$7680, %edx	# 9581	[c=4 l=6]  *andsi_1/0
+	orl	%eax, %edx	# 9583	[c=5 l=2]  *iorsi_1_zext
+	movl	%esi, %eax	# 14674	[c=4 l=2]  *movsi_internal/0
+	andl	$192, %eax	# 9587	[c=4 l=5]  *andsi_2/0
+	jne	.L1278	# 9588	[c=13 l=6]  *jcc
+	leaq	flag_update_table_sub8(%rip), %rax	# 9591	[c=1 l=7]  *movdi_internal/4
+	movl	$63, %esi	# 59	[c=4 l=5]  *movqi_internal/3
+	leaq	(%rax,%rdx), %rcx	# 16140	[c=4 l=4]  *leadi
+	leaq	101(%rbx), %rdx	# 12294	[c=4 l=4]  *leadi
+.L1279:
+	movl	(%rbx), %edi	# 9612	[c=6 l=2]  *zero_extendsidi2/3
+	movq	1064(%rbx), %r9	# 9611	[c=9 l=7]  *movdi_internal/3
+	movb	%sil, 100(%rbx)	# 9610	[c=4 l=4]  *movqi_internal/8
+	movq	%rcx, 104(%rbx)	# 9609	[c=4 l=4]  *movdi_internal/5
+	movq	%rdi, %r8	# 16855	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdi	# 9614	[c=4 l=4]  *ashldi3_1/0
+	movq	%r9, 32(%rsp)	# 15689	[c=4 l=5]  *movdi_internal/5
+	leal	1(%r8), %r14d	# 16133	[c=4 l=4]  *leasi
+	addq	%r9, %rdi	# 9615	[c=4 l=3]  *adddi_1/0
+	movzbl	%sil, %r9d	# 9621	[c=4 l=4]  *zero_extendqisi2/0
+	addl	$2, %r8d	# 9670	[c=4 l=4]  *addsi_1/0
+	movl	%r14d, (%rbx)	# 9617	[c=4 l=3]  *movsi_internal/1
+	movzwl	12(%rdi), %r13d	# 9618	[c=9 l=5]  *movhi_internal/2
+	movl	%r14d, 40(%rsp)	# 15687	[c=4 l=5]  *movsi_internal/1
+	movq	1040(%rbx), %r14	# 9620	[c=9 l=7]  *movdi_internal/3
+	movl	%r9d, 56(%rsp)	# 15684	[c=4 l=5]  *movsi_internal/1
+	movq	%r14, 16(%rsp)	# 15997	[c=4 l=5]  *movdi_internal/5
+	movl	%r9d, %r14d	# 14686	[c=4 l=3]  *movsi_internal/0
+	notl	%r14d	# 9622	[c=4 l=3]  *one_cmplsi2_1/0
+	movw	%r13w, 48(%rsp)	# 15682	[c=4 l=6]  *movhi_internal/3
+	movl	%r14d, 24(%rsp)	# 14687	[c=4 l=5]  *movsi_internal/1
+	movzbl	10(%rdi), %r14d	# 9623	[c=13 l=5]  zero_extendqidi2/0
+	movzwl	%r13w, %edi	# 14688	[c=4 l=4]  *zero_extendhisi2/0
+	movl	24(%rsp), %r13d	# 14689	[c=9 l=5]  *movsi_internal/0
+	movzbl	1004(%rbx,%r14), %r15d	# 9624	[c=14 l=9]  *zero_extendqisi2/0
+	movl	%r15d, %r9d	# 16856	[c=4 l=3]  *movsi_internal/0
+	subl	%edi, %r15d	# 9627	[c=4 l=3]  *subsi_1/0
+	movq	16(%rsp), %rdi	# 15996	[c=9 l=5]  *movdi_internal/3
+	andl	$136, %r9d	# 9638	[c=4 l=7]  *andsi_1/0
+	movzbl	63(%rdi), %edi	# 9628	[c=13 l=4]  *zero_extendqisi2/0
+	andl	%r13d, %edi	# 9629	[c=4 l=3]  *andsi_1/0
+	movzbl	(%rcx), %r13d	# 18188	[c=5 l=4]  *movqi_internal/4
+	andl	%esi, %r13d	# 19118	[c=4 l=3]  *andsi_1/0
+	orl	%r13d, %edi	# 9632	[c=4 l=3]  *iorsi_1/0
+	andl	$1, %edi	# 9633	[c=4 l=3]  *andsi_1/0
+	subl	%edi, %r15d	# 9634	[c=4 l=3]  *subsi_1/0
+	movl	48(%rsp), %edi	# 14693	[c=9 l=4]  *movsi_internal/0
+	movb	%r15b, 1004(%rbx,%r14)	# 9636	[c=4 l=8]  *movqi_internal/8
+	movq	16(%rsp), %r14	# 15995	[c=9 l=5]  *movdi_internal/3
+	andl	$511, %r15d	# 9649	[c=4 l=7]  *andsi_1/0
+	andl	$136, %edi	# 9641	[c=4 l=6]  *andsi_1/0
+	movzbl	(%rcx), %ecx	# 9643	[c=5 l=3]  *movqi_internal/4
+	leal	(%rdi,%r9,2), %edi	# 9642	[c=8 l=4]  *leasi
+	movzbl	63(%r14), %r13d	# 9653	[c=13 l=5]  *zero_extendqisi2/0
+	movl	56(%rsp), %r9d	# 14695	[c=9 l=5]  *movsi_internal/0
+	movq	%rdx, 104(%rbx)	# 9666	[c=4 l=4]  *movdi_internal/5
+	imull	$260, %edi, %edi	# 9647	[c=12 l=6]  *mulsi3_1/1
+	movl	24(%rsp), %r14d	# 14697	[c=9 l=5]  *movsi_internal/0
+	andl	%ecx, %esi	# 16134	[c=4 l=2]  *andsi_1/0
+	andl	$-64, %r9d	# 9644	[c=4 l=4]  *andsi_1/0
+	andl	%r14d, %r13d	# 9654	[c=4 l=3]  *andsi_1/0
+	andl	%r9d, %ecx	# 16135	[c=4 l=3]  *andsi_1/0
+	orl	$63, %r9d	# 16137	[c=4 l=4]  *iorsi_1/0
+	andl	$7680, %edi	# 9648	[c=4 l=6]  *andsi_1/0
+	orl	%esi, %r13d	# 9657	[c=4 l=3]  *iorsi_1/0
+	movb	%r9b, 100(%rbx)	# 9664	[c=4 l=4]  *movqi_internal/8
+	movq	32(%rsp), %r9	# 14699	[c=9 l=5]  *movdi_internal/3
+	orl	%r15d, %edi	# 9650	[c=5 l=3]  *iorsi_1_zext
+	movl	40(%rsp), %r15d	# 9667	[c=10 l=5]  *zero_extendsidi2/3
+	orl	$-3, %r13d	# 9658	[c=4 l=4]  *iorsi_1/0
+	andb	(%rax,%rdi), %r13b	# 9659	[c=13 l=4]  *andqi_1/1
+	orl	%ecx, %r13d	# 16136	[c=4 l=3]  *iorsi_1/0
+	salq	$4, %r15	# 9668	[c=4 l=4]  *ashldi3_1/0
+	movb	%r13b, 101(%rbx)	# 9662	[c=4 l=4]  *movqi_internal/8
+	addq	%r9, %r15	# 9669	[c=4 l=3]  *adddi_1/0
+	movl	%r8d, (%rbx)	# 9671	[c=4 l=3]  *movsi_internal/1
+	jmp	.L682	# 18516	[c=1 l=5]  jump
+.L1271:
+	movzwl	12(%r15), %edx	# 9350	[c=13 l=5]  *zero_extendhisi2/0
+	movzbl	10(%r15), %r15d	# 9357	[c=13 l=5]  zero_extendqidi2/0
+	movzbl	100(%rbx), %eax	# 9353	[c=13 l=4]  *zero_extendqisi2/0
+	movq	1040(%rbx), %r13	# 9352	[c=9 l=7]  *movdi_internal/3
+	movzbl	1004(%rbx,%r15), %esi	# 9358	[c=14 l=9]  *zero_extendqisi2/0
+	movl	%edx, %edi	# 16848	[c=4 l=2]  *movsi_internal/0
+	movq	104(%rbx), %r14	# 9356	[c=9 l=4]  *movdi_internal/3
+	movl	%eax, %r9d	# 14649	[c=4 l=3]  *movsi_internal/0
+	andl	$136, %edi	# 9375	[c=4 l=6]  *andsi_1/0
+	movl	%eax, %ecx	# 16846	[c=4 l=2]  *movsi_internal/0
+	movl	%esi, %r8d	# 16847	[c=4 l=3]  *movsi_internal/0
+	subl	%edx, %esi	# 9361	[c=4 l=2]  *subsi_1/0
+	movzbl	63(%r13), %edx	# 9362	[c=13 l=5]  *zero_extendqisi2/0
+	notl	%r9d	# 9355	[c=4 l=3]  *one_cmplsi2_1/0
+	movl	%esi, 16(%rsp)	# 16053	[c=4 l=4]  *movsi_internal/1
+	andl	$136, %r8d	# 9372	[c=4 l=7]  *andsi_1/0
+	andl	%r9d, %edx	# 9363	[c=4 l=3]  *andsi_1/0
+	movl	%edx, %esi	# 16001	[c=4 l=2]  *movsi_internal/0
+	movzbl	(%r14), %edx	# 18200	[c=5 l=4]  *movqi_internal/4
+	andl	%eax, %edx	# 19116	[c=4 l=2]  *andsi_1/0
+	andl	$-64, %eax	# 9378	[c=4 l=3]  *andsi_1/0
+	orl	%edx, %esi	# 9366	[c=4 l=2]  *iorsi_1/0
+	movl	%esi, %edx	# 15999	[c=4 l=2]  *movsi_internal/0
+	movl	16(%rsp), %esi	# 16050	[c=9 l=4]  *movsi_internal/0
+	andl	$1, %edx	# 9367	[c=4 l=3]  *andsi_1/0
+	subl	%edx, %esi	# 9368	[c=4 l=2]  *subsi_1/0
+	leal	(%rdi,%r8,2), %edx	# 9376	[c=8 l=4]  *leasi
+	movl	%eax, %r8d	# 14655	[c=4 l=3]  *movsi_internal/0
+	imull	$260, %edx, %edx	# 9381	[c=12 l=6]  *mulsi3_1/1
+	movb	%sil, 1004(%rbx,%r15)	# 9370	[c=4 l=8]  *movqi_internal/8
+	andl	$511, %esi	# 9383	[c=4 l=6]  *andsi_1/0
+	movzbl	(%r14), %edi	# 9377	[c=5 l=4]  *movqi_internal/4
+	leaq	flag_update_table_sub8(%rip), %rax	# 9380	[c=1 l=7]  *movdi_internal/4
+	andl	%edi, %ecx	# 16157	[c=4 l=2]  *andsi_1/0
+	andl	%r8d, %edi	# 16158	[c=4 l=3]  *andsi_1/0
+	andl	$7680, %edx	# 9382	[c=4 l=6]  *andsi_1/0
+	orl	%esi, %edx	# 9384	[c=4 l=2]  *iorsi_1/0
+	movl	%edx, %esi	# 9385	[c=1 l=2]  *zero_extendsidi2/3
+	movzbl	63(%r13), %edx	# 9387	[c=13 l=5]  *zero_extendqisi2/0
+	andl	%r9d, %edx	# 9388	[c=4 l=3]  *andsi_1/0
+	orl	%ecx, %edx	# 9391	[c=4 l=2]  *iorsi_1/0
+	movzbl	(%rax,%rsi), %ecx	# 18202	[c=9 l=4]  *movqi_internal/4
+	orl	$-3, %edx	# 9392	[c=4 l=3]  *iorsi_1/0
+	andl	%edx, %ecx	# 19117	[c=4 l=2]  *andsi_1/0
+	movl	%ecx, %eax	# 14657	[c=4 l=2]  *movqi_internal/0
+	orl	%eax, %edi	# 16159	[c=4 l=2]  *iorsi_1/0
+	movl	%r8d, %eax	# 14658	[c=4 l=3]  *movqi_internal/2
+	orl	$63, %eax	# 16160	[c=4 l=3]  *iorsi_1/0
+	movb	%dil, 101(%rbx)	# 9396	[c=4 l=4]  *movqi_internal/8
+	movb	%al, 100(%rbx)	# 9398	[c=4 l=3]  *movqi_internal/8
+	jmp	.L1568	# 18518	[c=1 l=5]  jump
+.L792:
+	movl	$2, 96(%rbx)	# 2602	[c=4 l=7]  *movsi_internal/1
+	movzwl	1034(%rbx), %r14d	# 2603	[c=13 l=8]  *zero_extendhisi2/0
+	cmpl	$65536, 880(%rbx)	# 2606	[c=13 l=10]  *cmpsi_1/0
+	jbe	.L793	# 2607	[c=13 l=2]  *jcc
+	movl	$59, %eax	# 2609	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%rbx), %eax	# 2610	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %eax	# 2611	[c=13 l=6]  *cmpsi_1/1
+	jb	.L794	# 2612	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%rbx)	# 2614	[c=13 l=7]  *cmpqi_ccno_1/1
+	jne	.L795	# 2615	[c=13 l=6]  *jcc
+.L794:
+	movq	1040(%rbx), %rax	# 2618	[c=9 l=7]  *movdi_internal/3
+	movzbl	59(%rax), %eax	# 2619	[c=13 l=4]  *zero_extendqisi2/0
+.L796:
+	sall	$16, %eax	# 2630	[c=4 l=3]  *ashlsi3_1/0
+	orl	%eax, %r14d	# 2631	[c=4 l=3]  *iorsi_1/0
+.L793:
+	movl	6044(%rbx), %ecx	# 2634	[c=9 l=6]  *movsi_internal/0
+	movl	992(%rbx), %eax	# 2636	[c=9 l=6]  *movsi_internal/0
+	movq	%rbx, %rdi	# 2646	[c=4 l=3]  *movdi_internal/3
+	leal	1(%rax,%rax), %r13d	# 2638	[c=8 l=5]  *leasi
+	movl	%ecx, %eax	# 13982	[c=4 l=2]  *movsi_internal/0
+	movl	%ecx, 16(%rsp)	# 15112	[c=4 l=4]  *movsi_internal/1
+	negl	%eax	# 2639	[c=4 l=2]  *negsi_1
+	andl	%eax, %r13d	# 2640	[c=4 l=3]  *andsi_1/0
+	leaq	6052(%rbx), %rax	# 16351	[c=4 l=7]  *leadi
+	andl	%r14d, %r13d	# 2641	[c=4 l=3]  *andsi_1/0
+	movq	%rax, 24(%rsp)	# 13984	[c=4 l=5]  *movdi_internal/5
+	movl	%r13d, %r15d	# 2642	[c=1 l=3]  *zero_extendsidi2/3
+	addq	1056(%rbx), %r15	# 2644	[c=13 l=7]  *adddi_1/1
+	call	spm_operation	# 2647	[c=10 l=5]  *call_value
+	movl	16(%rsp), %ecx	# 15113	[c=9 l=4]  *movsi_internal/0
+	leaq	flag_update_table_add8(%rip), %r10	# 15115	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_sub8(%rip), %r11	# 15117	[c=1 l=7]  *movdi_internal/4
+	cmpl	$3, %eax	# 2649	[c=4 l=3]  *cmpsi_1/0
+	je	.L1787	# 2650	[c=13 l=6]  *jcc
+	jg	.L798	# 2655	[c=13 l=6]  *jcc
+	cmpl	$1, %eax	# 2657	[c=4 l=3]  *cmpsi_1/0
+	je	.L799	# 2658	[c=13 l=6]  *jcc
+	cmpl	$2, %eax	# 2660	[c=4 l=3]  *cmpsi_1/0
+	jne	.L801	# 2661	[c=13 l=2]  *jcc
+	movl	%ecx, 16(%rsp)	# 15118	[c=4 l=4]  *movsi_internal/1
+	movl	%ecx, %edx	# 2688	[c=1 l=2]  *zero_extendsidi2/3
+	movl	$255, %esi	# 2690	[c=4 l=5]  *movsi_internal/0
+	movq	%r15, %rdi	# 2691	[c=4 l=3]  *movdi_internal/3
+.L1570:
+	call	memset@PLT	# 2723	[c=10 l=5]  *call_value
+	movl	16(%rsp), %ecx	# 15133	[c=9 l=4]  *movsi_internal/0
+	movl	%r13d, %esi	# 2726	[c=4 l=3]  *movsi_internal/0
+	movq	%rbx, %rdi	# 2727	[c=4 l=3]  *movdi_internal/3
+	leal	(%rcx,%r13), %edx	# 16348	[c=4 l=4]  *leasi
+	call	flash_changed	# 2728	[c=0 l=5]  *call
+	leaq	flag_update_table_add8(%rip), %r10	# 15135	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_sub8(%rip), %r11	# 15137	[c=1 l=7]  *movdi_internal/4
+.L801:
+	cmpl	$65536, 880(%rbx)	# 2745	[c=13 l=10]  *cmpsi_1/0
+	leal	2(%r14), %r8d	# 16347	[c=4 l=4]  *leasi
+	movw	%r8w, 1034(%rbx)	# 2742	[c=4 l=8]  *movhi_internal/3
+	jbe	.L805	# 2746	[c=13 l=2]  *jcc
+	movl	$59, %eax	# 2749	[c=4 l=5]  *movsi_internal/0
+	sarl	$16, %r8d	# 2748	[c=4 l=4]  *ashrsi3_1/0
+	subl	5176(%rbx), %eax	# 2750	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %eax	# 2751	[c=13 l=6]  *cmpsi_1/1
+	jb	.L806	# 2752	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%rbx)	# 2754	[c=13 l=7]  *cmpqi_ccno_1/1
+	jne	.L807	# 2755	[c=13 l=6]  *jcc
+.L806:
+	movq	1040(%rbx), %rax	# 2758	[c=9 l=7]  *movdi_internal/3
+	movb	%r8b, 59(%rax)	# 2759	[c=4 l=4]  *movqi_internal/8
+.L805:
+	movq	(%rsp), %rax	# 13985	[c=5 l=4]  *movdi_internal/3
+	subq	$1, %rax	# 2770	[c=4 l=4]  *adddi_1/0
+	cmpq	%rbp, %rax	# 2771	[c=4 l=3]  *cmpdi_1/0
+	jb	.L680	# 2772	[c=13 l=6]  *jcc
+	movq	56(%rbx), %rax	# 13986	[c=9 l=4]  *movdi_internal/3
+	cmpq	%rax, 48(%rbx)	# 2775	[c=13 l=4]  *cmpdi_1/0
+	jnb	.L1788	# 2776	[c=13 l=6]  *jcc
+.L808:
+	cmpl	$0, 120(%rbx)	# 2784	[c=13 l=4]  *cmpsi_ccno_1/1
+	jne	.L613	# 2785	[c=13 l=6]  *jcc
+	movl	(%rbx), %r15d	# 2787	[c=6 l=3]  *zero_extendsidi2/3
+	movl	$1, 96(%rbx)	# 2792	[c=4 l=7]  *movsi_internal/1
+	movq	%r10, %rcx	# 17886	[c=4 l=3]  *movdi_internal/3
+	movq	%r15, %rdx	# 16700	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 2789	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 2791	[c=13 l=7]  *adddi_1/1
+	movzbl	11(%r15), %eax	# 2793	[c=13 l=5]  zero_extendqidi2/0
+	movq	(%r15), %r14	# 2801	[c=5 l=3]  *movdi_internal/3
+	addq	%rax, %rbp	# 2794	[c=4 l=3]  *adddi_1/0
+	movzwl	14(%r15), %eax	# 2796	[c=13 l=5]  zero_extendhidi2/0
+	addq	%rax, 48(%rbx)	# 2797	[c=13 l=4]  *adddi_1/0
+	movq	%rbp, 40(%rbx)	# 2795	[c=4 l=4]  *movdi_internal/5
+	movzbl	9(%r15), %eax	# 2798	[c=13 l=5]  *zero_extendqisi2/0
+	addl	%edx, %eax	# 2799	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 17887	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 2800	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 17888	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 17889	[c=4 l=3]  *indirect_jump
+.L810:
+	movzbl	10(%r15), %eax	# 2807	[c=13 l=5]  zero_extendqidi2/0
+	movzwl	12(%r15), %edx	# 2810	[c=13 l=5]  zero_extendhidi2/0
+	movzbl	100(%rbx), %esi	# 2814	[c=13 l=4]  *zero_extendqisi2/0
+	movl	(%rbx), %r15d	# 2833	[c=6 l=3]  *zero_extendsidi2/3
+	movzbl	1004(%rbx,%rdx), %edx	# 2811	[c=14 l=8]  *zero_extendqisi2/0
+	movzbl	1004(%rbx,%rax), %eax	# 2808	[c=14 l=8]  *zero_extendqisi2/0
+	andl	$-4, %esi	# 2815	[c=4 l=3]  *andsi_1/0
+	imull	%edx, %eax	# 2812	[c=12 l=3]  *mulsi3_1/2
+	xorl	%edx, %edx	# 18330	[c=4 l=2]  *movsi_xor
+	movl	%eax, %ecx	# 13987	[c=4 l=2]  *movsi_internal/0
+	addl	%ecx, %ecx	# 18331	[c=4 l=2]  *ashlsi3_cmp
+	sete	%dl	# 18332	[c=4 l=3]  *setcc_qi_slp
+	sarl	$15, %eax	# 2822	[c=4 l=3]  *ashrsi3_1/0
+	addl	%edx, %edx	# 2821	[c=4 l=2]  *ashlsi3_1/0
+	orl	%edx, %eax	# 2823	[c=4 l=2]  *iorsi_1/0
+	movq	104(%rbx), %rdx	# 2824	[c=9 l=4]  *movdi_internal/3
+	movzbl	(%rdx), %edi	# 18333	[c=5 l=3]  *movqi_internal/4
+	movw	%cx, 1004(%rbx)	# 2832	[c=4 l=7]  *movhi_internal/3
+	movq	%r10, %rcx	# 17878	[c=4 l=3]  *movdi_internal/3
+	andl	%esi, %edi	# 19115	[c=4 l=2]  *andsi_1/0
+	movl	%edi, %edx	# 13990	[c=4 l=2]  *movqi_internal/1
+	orl	%edx, %eax	# 16344	[c=4 l=2]  *iorsi_1/0
+	leaq	101(%rbx), %rdx	# 16346	[c=4 l=4]  *leadi
+	movb	%al, 101(%rbx)	# 2827	[c=4 l=3]  *movqi_internal/8
+	movl	%esi, %eax	# 13991	[c=4 l=2]  *movqi_internal/1
+	movq	%rdx, 104(%rbx)	# 2831	[c=4 l=4]  *movdi_internal/5
+	orl	$3, %eax	# 16345	[c=4 l=3]  *iorsi_1/0
+	movq	%r15, %rdx	# 16701	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 2835	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 2837	[c=13 l=7]  *adddi_1/1
+	movb	%al, 100(%rbx)	# 2829	[c=4 l=3]  *movqi_internal/8
+	movzbl	9(%r15), %eax	# 2838	[c=13 l=5]  *zero_extendqisi2/0
+	movq	(%r15), %r14	# 2841	[c=5 l=3]  *movdi_internal/3
+	addl	%edx, %eax	# 2839	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 17879	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 2840	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 17880	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 17881	[c=4 l=3]  *indirect_jump
+.L811:
+	movzbl	10(%r15), %eax	# 2847	[c=13 l=5]  zero_extendqidi2/0
+	movzwl	12(%r15), %edx	# 2850	[c=13 l=5]  zero_extendhidi2/0
+	movzbl	100(%rbx), %esi	# 2855	[c=13 l=4]  *zero_extendqisi2/0
+	movl	(%rbx), %r15d	# 2874	[c=6 l=3]  *zero_extendsidi2/3
+	movsbl	1004(%rbx,%rdx), %edx	# 2851	[c=14 l=8]  extendqisi2
+	movsbl	1004(%rbx,%rax), %eax	# 2848	[c=14 l=8]  extendqisi2
+	andl	$-4, %esi	# 2856	[c=4 l=3]  *andsi_1/0
+	imull	%edx, %eax	# 2852	[c=12 l=3]  *mulsi3_1/2
+	xorl	%edx, %edx	# 18325	[c=4 l=2]  *movsi_xor
+	movzwl	%ax, %eax	# 2853	[c=4 l=3]  *zero_extendhisi2/0
+	movl	%eax, %ecx	# 13993	[c=4 l=2]  *movsi_internal/0
+	addl	%ecx, %ecx	# 18326	[c=4 l=2]  *ashlsi3_cmp
+	sete	%dl	# 18327	[c=4 l=3]  *setcc_qi_slp
+	sarl	$15, %eax	# 2863	[c=4 l=3]  *ashrsi3_1/0
+	addl	%edx, %edx	# 2862	[c=4 l=2]  *ashlsi3_1/0
+	orl	%edx, %eax	# 2864	[c=4 l=2]  *iorsi_1/0
+	movq	104(%rbx), %rdx	# 2865	[c=9 l=4]  *movdi_internal/3
+	movzbl	(%rdx), %edi	# 18328	[c=5 l=3]  *movqi_internal/4
+	movw	%cx, 1004(%rbx)	# 2873	[c=4 l=7]  *movhi_internal/3
+	movq	%r10, %rcx	# 17870	[c=4 l=3]  *movdi_internal/3
+	andl	%esi, %edi	# 19114	[c=4 l=2]  *andsi_1/0
+	movl	%edi, %edx	# 13996	[c=4 l=2]  *movqi_internal/1
+	orl	%edx, %eax	# 16339	[c=4 l=2]  *iorsi_1/0
+	leaq	101(%rbx), %rdx	# 16341	[c=4 l=4]  *leadi
+	movb	%al, 101(%rbx)	# 2868	[c=4 l=3]  *movqi_internal/8
+	movl	%esi, %eax	# 13997	[c=4 l=2]  *movqi_internal/1
+	movq	%rdx, 104(%rbx)	# 2872	[c=4 l=4]  *movdi_internal/5
+	orl	$3, %eax	# 16340	[c=4 l=3]  *iorsi_1/0
+	movq	%r15, %rdx	# 16702	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 2876	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 2878	[c=13 l=7]  *adddi_1/1
+	movb	%al, 100(%rbx)	# 2870	[c=4 l=3]  *movqi_internal/8
+	movzbl	9(%r15), %eax	# 2879	[c=13 l=5]  *zero_extendqisi2/0
+	movq	(%r15), %r14	# 2882	[c=5 l=3]  *movdi_internal/3
+	addl	%edx, %eax	# 2880	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 17871	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 2881	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 17872	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 17873	[c=4 l=3]  *indirect_jump
+.L812:
+	movzbl	10(%r15), %eax	# 2888	[c=13 l=5]  zero_extendqidi2/0
+	movzwl	12(%r15), %edx	# 2891	[c=13 l=5]  zero_extendhidi2/0
+	movzbl	100(%rbx), %esi	# 2896	[c=13 l=4]  *zero_extendqisi2/0
+	movl	(%rbx), %r15d	# 2915	[c=6 l=3]  *zero_extendsidi2/3
+	movzbl	1004(%rbx,%rdx), %edx	# 2892	[c=14 l=8]  *zero_extendqisi2/0
+	movsbl	1004(%rbx,%rax), %eax	# 2889	[c=14 l=8]  extendqisi2
+	andl	$-4, %esi	# 2897	[c=4 l=3]  *andsi_1/0
+	imull	%edx, %eax	# 2893	[c=12 l=3]  *mulsi3_1/2
+	xorl	%edx, %edx	# 18320	[c=4 l=2]  *movsi_xor
+	movzwl	%ax, %eax	# 2894	[c=4 l=3]  *zero_extendhisi2/0
+	movl	%eax, %ecx	# 13999	[c=4 l=2]  *movsi_internal/0
+	addl	%ecx, %ecx	# 18321	[c=4 l=2]  *ashlsi3_cmp
+	sete	%dl	# 18322	[c=4 l=3]  *setcc_qi_slp
+	sarl	$15, %eax	# 2904	[c=4 l=3]  *ashrsi3_1/0
+	addl	%edx, %edx	# 2903	[c=4 l=2]  *ashlsi3_1/0
+	orl	%edx, %eax	# 2905	[c=4 l=2]  *iorsi_1/0
+	movq	104(%rbx), %rdx	# 2906	[c=9 l=4]  *movdi_internal/3
+	movzbl	(%rdx), %edi	# 18323	[c=5 l=3]  *movqi_internal/4
+	movw	%cx, 1004(%rbx)	# 2914	[c=4 l=7]  *movhi_internal/3
+	movq	%r10, %rcx	# 17862	[c=4 l=3]  *movdi_internal/3
+	andl	%esi, %edi	# 19113	[c=4 l=2]  *andsi_1/0
+	movl	%edi, %edx	# 14002	[c=4 l=2]  *movqi_internal/1
+	orl	%edx, %eax	# 16334	[c=4 l=2]  *iorsi_1/0
+	leaq	101(%rbx), %rdx	# 16336	[c=4 l=4]  *leadi
+	movb	%al, 101(%rbx)	# 2909	[c=4 l=3]  *movqi_internal/8
+	movl	%esi, %eax	# 14003	[c=4 l=2]  *movqi_internal/1
+	movq	%rdx, 104(%rbx)	# 2913	[c=4 l=4]  *movdi_internal/5
+	orl	$3, %eax	# 16335	[c=4 l=3]  *iorsi_1/0
+	movq	%r15, %rdx	# 16703	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 2917	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 2919	[c=13 l=7]  *adddi_1/1
+	movb	%al, 100(%rbx)	# 2911	[c=4 l=3]  *movqi_internal/8
+	movzbl	9(%r15), %eax	# 2920	[c=13 l=5]  *zero_extendqisi2/0
+	movq	(%r15), %r14	# 2923	[c=5 l=3]  *movdi_internal/3
+	addl	%edx, %eax	# 2921	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 17863	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 2922	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 17864	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 17865	[c=4 l=3]  *indirect_jump
+.L813:
+	movl	5176(%rbx), %r13d	# 2929	[c=9 l=7]  *movsi_internal/0
+	movl	$61, %eax	# 2931	[c=4 l=5]  *movsi_internal/0
+	movl	5180(%rbx), %r14d	# 2930	[c=9 l=7]  *movsi_internal/0
+	movl	$2, 96(%rbx)	# 2928	[c=4 l=7]  *movsi_internal/1
+	subl	%r13d, %eax	# 2932	[c=4 l=3]  *subsi_1/0
+	cmpl	%r14d, %eax	# 2933	[c=4 l=3]  *cmpsi_1/0
+	jb	.L814	# 2934	[c=13 l=6]  *jcc
+	cmpb	$1, 1081(%rbx)	# 2938	[c=13 l=7]  *cmpqi_1/0
+	ja	.L1789	# 2939	[c=13 l=6]  *jcc
+	movq	1040(%rbx), %rax	# 12037	[c=9 l=7]  *movdi_internal/3
+	movzbl	61(%rax), %r15d	# 12038	[c=13 l=5]  *zero_extendqisi2/0
+.L816:
+	movzbl	62(%rax), %eax	# 2976	[c=13 l=4]  *zero_extendqisi2/0
+.L818:
+	sall	$8, %eax	# 2979	[c=4 l=3]  *ashlsi3_1/0
+	movl	996(%rbx), %edx	# 2982	[c=9 l=6]  *movsi_internal/0
+	orl	%eax, %r15d	# 2980	[c=4 l=3]  *iorsi_1/0
+	movzbl	840(%rbx), %eax	# 2984	[c=13 l=7]  *zero_extendqisi2/0
+	leal	1(%rdx,%rax), %eax	# 2985	[c=5 l=4]  *leasi
+	cmpl	%eax, %r15d	# 2986	[c=4 l=3]  *cmpsi_1/0
+	jb	.L1582	# 2987	[c=13 l=6]  *jcc
+	movl	%r15d, %edx	# 14005	[c=4 l=3]  *movsi_internal/0
+	movl	(%rbx), %ecx	# 2995	[c=5 l=2]  *movsi_internal/0
+	leal	-1(%r15), %eax	# 16331	[c=4 l=4]  *leasi
+	subl	%r13d, %edx	# 2997	[c=4 l=3]  *subsi_1/0
+	cmpl	%r14d, %edx	# 2998	[c=4 l=3]  *cmpsi_1/0
+	jb	.L820	# 2999	[c=13 l=2]  *jcc
+	movl	%r15d, %edx	# 14007	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %edx	# 3001	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %edx	# 13676	[c=5 l=6]  *andsi_1_zext
+	cmpb	$0, 1080(%rbx,%rdx)	# 3004	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L821	# 3005	[c=13 l=6]  *jcc
+.L820:
+	movq	1040(%rbx), %rsi	# 3009	[c=9 l=7]  *movdi_internal/3
+	movslq	%r15d, %rdx	# 3008	[c=4 l=3]  *extendsidi2_rex64/1
+	movb	%cl, (%rsi,%rdx)	# 3010	[c=4 l=3]  *movqi_internal/8
+.L822:
+	movl	(%rbx), %ecx	# 14009	[c=5 l=2]  *movsi_internal/0
+	movl	%eax, %edx	# 14011	[c=4 l=2]  *movsi_internal/0
+	leal	-2(%r15), %r13d	# 16330	[c=4 l=4]  *leasi
+	subl	5176(%rbx), %edx	# 3024	[c=13 l=6]  *subsi_1/1
+	shrl	$8, %ecx	# 3022	[c=4 l=3]  *lshrsi3_1/0
+	cmpl	5180(%rbx), %edx	# 3025	[c=13 l=6]  *cmpsi_1/1
+	jb	.L823	# 3026	[c=13 l=2]  *jcc
+	movl	%eax, %edx	# 14013	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %edx	# 3028	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %edx	# 13675	[c=5 l=6]  *andsi_1_zext
+	cmpb	$0, 1080(%rbx,%rdx)	# 3031	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L824	# 3032	[c=13 l=6]  *jcc
+.L823:
+	movq	1040(%rbx), %rdx	# 3036	[c=9 l=7]  *movdi_internal/3
+	cltq	# 3035	[c=4 l=2]  *extendsidi2_rex64/0
+	movb	%cl, (%rdx,%rax)	# 3037	[c=4 l=3]  *movqi_internal/8
+.L825:
+	cmpb	$0, 840(%rbx)	# 3048	[c=13 l=7]  *cmpqi_ccno_1/1
+	je	.L826	# 3049	[c=13 l=2]  *jcc
+	movl	(%rbx), %edx	# 14015	[c=5 l=2]  *movsi_internal/0
+	movl	%r13d, %eax	# 14017	[c=4 l=3]  *movsi_internal/0
+	subl	$3, %r15d	# 3053	[c=4 l=4]  *addsi_1/0
+	subl	5176(%rbx), %eax	# 3054	[c=13 l=6]  *subsi_1/1
+	shrl	$16, %edx	# 3052	[c=4 l=3]  *lshrsi3_1/0
+	cmpl	5180(%rbx), %eax	# 3055	[c=13 l=6]  *cmpsi_1/1
+	jb	.L827	# 3056	[c=13 l=2]  *jcc
+	movl	%r13d, %ecx	# 14019	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %ecx	# 3058	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %ecx	# 13674	[c=5 l=6]  *andsi_1_zext
+	cmpb	$0, 1080(%rbx,%rcx)	# 3061	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L828	# 3062	[c=13 l=6]  *jcc
+.L827:
+	movq	1040(%rbx), %rcx	# 3066	[c=9 l=7]  *movdi_internal/3
+	movslq	%r13d, %rax	# 3065	[c=4 l=3]  *extendsidi2_rex64/1
+	movb	%dl, (%rcx,%rax)	# 3067	[c=4 l=3]  *movqi_internal/8
+.L829:
+	movl	%r15d, %r13d	# 19	[c=4 l=3]  *movsi_internal/0
+.L826:
+	movl	$61, %edx	# 3082	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%rbx), %edx	# 3083	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %edx	# 3084	[c=13 l=6]  *cmpsi_1/1
+	jb	.L830	# 3085	[c=13 l=2]  *jcc
+	cmpb	$1, 1081(%rbx)	# 3089	[c=13 l=7]  *cmpqi_1/0
+	ja	.L1790	# 3090	[c=13 l=6]  *jcc
+.L830:
+	movq	1040(%rbx), %rax	# 3101	[c=9 l=7]  *movdi_internal/3
+	movb	%r13b, 61(%rax)	# 3102	[c=4 l=4]  *movqi_internal/8
+.L831:
+	movl	%r13d, %eax	# 14021	[c=4 l=3]  *movsi_internal/0
+	movl	$62, %edx	# 3106	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%rbx), %edx	# 3107	[c=13 l=6]  *subsi_1/1
+	sarl	$8, %eax	# 3105	[c=4 l=3]  *ashrsi3_1/0
+	cmpl	5180(%rbx), %edx	# 3108	[c=13 l=6]  *cmpsi_1/1
+	jb	.L832	# 3109	[c=13 l=2]  *jcc
+	cmpb	$1, 1081(%rbx)	# 3113	[c=13 l=7]  *cmpqi_1/0
+	ja	.L1791	# 3114	[c=13 l=6]  *jcc
+.L832:
+	movq	1040(%rbx), %rdx	# 3125	[c=9 l=7]  *movdi_internal/3
+	movb	%al, 62(%rdx)	# 3126	[c=4 l=3]  *movqi_internal/8
+.L833:
+	movzwl	1034(%rbx), %esi	# 3129	[c=13 l=7]  *zero_extendhisi2/0
+	movl	%esi, (%rbx)	# 3130	[c=4 l=2]  *movsi_internal/1
+	cmpl	%esi, 992(%rbx)	# 3131	[c=13 l=6]  *cmpsi_1/0
+	jb	.L1583	# 3132	[c=13 l=6]  *jcc
+	movq	(%rsp), %rdi	# 14023	[c=5 l=4]  *movdi_internal/3
+	movzbl	840(%rbx), %eax	# 3140	[c=13 l=7]  zero_extendqidi2/0
+	addq	48(%rbx), %rax	# 3142	[c=13 l=4]  *adddi_1/1
+	leaq	-1(%rdi), %rdx	# 16329	[c=4 l=4]  *leadi
+	movq	%rax, 48(%rbx)	# 3143	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rbp, %rdx	# 3145	[c=4 l=3]  *cmpdi_1/0
+	jb	.L680	# 3146	[c=13 l=6]  *jcc
+	cmpq	56(%rbx), %rax	# 3148	[c=13 l=4]  *cmpdi_1/1
+	jnb	.L1792	# 3149	[c=13 l=6]  *jcc
+.L835:
+	movl	(%rbx), %r15d	# 3156	[c=6 l=3]  *zero_extendsidi2/3
+	movl	$1, 96(%rbx)	# 3161	[c=4 l=7]  *movsi_internal/1
+	movq	%r10, %rcx	# 17854	[c=4 l=3]  *movdi_internal/3
+	movq	%r15, %rdx	# 16704	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 3158	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 3160	[c=13 l=7]  *adddi_1/1
+	movzbl	11(%r15), %eax	# 3162	[c=13 l=5]  zero_extendqidi2/0
+	movq	(%r15), %r14	# 3170	[c=5 l=3]  *movdi_internal/3
+	addq	%rax, %rbp	# 3163	[c=4 l=3]  *adddi_1/0
+	movzwl	14(%r15), %eax	# 3165	[c=13 l=5]  zero_extendhidi2/0
+	addq	%rax, 48(%rbx)	# 3166	[c=13 l=4]  *adddi_1/0
+	movq	%rbp, 40(%rbx)	# 3164	[c=4 l=4]  *movdi_internal/5
+	movzbl	9(%r15), %eax	# 3167	[c=13 l=5]  *zero_extendqisi2/0
+	addl	%edx, %eax	# 3168	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 17855	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 3169	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 17856	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 17857	[c=4 l=3]  *indirect_jump
+.L836:
+	movzwl	1034(%rbx), %esi	# 3176	[c=13 l=7]  *zero_extendhisi2/0
+	movl	$2, 96(%rbx)	# 3175	[c=4 l=7]  *movsi_internal/1
+	movl	%esi, (%rbx)	# 3177	[c=4 l=2]  *movsi_internal/1
+	cmpl	%esi, 992(%rbx)	# 3178	[c=13 l=6]  *cmpsi_1/0
+	jb	.L1583	# 3179	[c=13 l=6]  *jcc
+	movq	(%rsp), %rax	# 14024	[c=5 l=4]  *movdi_internal/3
+	subq	$1, %rax	# 3187	[c=4 l=4]  *adddi_1/0
+	cmpq	%rbp, %rax	# 3188	[c=4 l=3]  *cmpdi_1/0
+	jb	.L680	# 3189	[c=13 l=6]  *jcc
+	movq	56(%rbx), %rax	# 14025	[c=9 l=4]  *movdi_internal/3
+	cmpq	%rax, 48(%rbx)	# 3192	[c=13 l=4]  *cmpdi_1/0
+	jnb	.L1793	# 3193	[c=13 l=6]  *jcc
+.L838:
+	movl	(%rbx), %r15d	# 3200	[c=6 l=3]  *zero_extendsidi2/3
+	movl	$1, 96(%rbx)	# 3205	[c=4 l=7]  *movsi_internal/1
+	movq	%r10, %rcx	# 17846	[c=4 l=3]  *movdi_internal/3
+	movq	%r15, %rdx	# 16705	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 3202	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 3204	[c=13 l=7]  *adddi_1/1
+	movzbl	11(%r15), %eax	# 3206	[c=13 l=5]  zero_extendqidi2/0
+	movq	(%r15), %r14	# 3214	[c=5 l=3]  *movdi_internal/3
+	addq	%rax, %rbp	# 3207	[c=4 l=3]  *adddi_1/0
+	movzwl	14(%r15), %eax	# 3209	[c=13 l=5]  zero_extendhidi2/0
+	addq	%rax, 48(%rbx)	# 3210	[c=13 l=4]  *adddi_1/0
+	movq	%rbp, 40(%rbx)	# 3208	[c=4 l=4]  *movdi_internal/5
+	movzbl	9(%r15), %eax	# 3211	[c=13 l=5]  *zero_extendqisi2/0
+	addl	%edx, %eax	# 3212	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 17847	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 3213	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 17848	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 17849	[c=4 l=3]  *indirect_jump
+.L933:
+	movzbl	10(%r15), %edx	# 4408	[c=13 l=5]  zero_extendqidi2/0
+	movzwl	12(%r15), %eax	# 4407	[c=13 l=5]  zero_extendhidi2/0
+	movzbl	1004(%rbx,%rax), %eax	# 4409	[c=10 l=8]  *movqi_internal/4
+	orb	1004(%rbx,%rdx), %al	# 4410	[c=14 l=7]  *iorqi_1/1
+	movb	%al, 1004(%rbx,%rdx)	# 4412	[c=4 l=7]  *movqi_internal/8
+	movzbl	100(%rbx), %edx	# 4413	[c=9 l=4]  *movqi_internal/4
+	movl	%edx, %ecx	# 14118	[c=4 l=2]  *movsi_internal/0
+	andl	$225, %ecx	# 4416	[c=4 l=6]  *andsi_2/0
+	jne	.L934	# 4417	[c=13 l=6]  *jcc
+	leaq	flag_update_table_logical(%rip), %rdx	# 4420	[c=1 l=7]  *movdi_internal/4
+	movzbl	%al, %eax	# 4419	[c=4 l=3]  zero_extendqidi2/0
+	addq	%rdx, %rax	# 4421	[c=4 l=3]  *adddi_1/0
+	movl	$30, %edx	# 24	[c=4 l=5]  *movqi_internal/3
+.L935:
+	movl	(%rbx), %r15d	# 4441	[c=6 l=3]  *zero_extendsidi2/3
+	movb	%dl, 100(%rbx)	# 4440	[c=4 l=3]  *movqi_internal/8
+	movq	%r10, %rcx	# 17630	[c=4 l=3]  *movdi_internal/3
+	movq	%rax, 104(%rbx)	# 4439	[c=4 l=4]  *movdi_internal/5
+	movq	%r15, %rdx	# 16742	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 4443	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 4445	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%r15), %eax	# 4446	[c=13 l=5]  *zero_extendqisi2/0
+	movq	(%r15), %r14	# 4449	[c=5 l=3]  *movdi_internal/3
+	addl	%edx, %eax	# 4447	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 17631	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 4448	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 17632	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 17633	[c=4 l=3]  *indirect_jump
+.L1181:
+	movzbl	10(%r15), %r14d	# 7522	[c=13 l=5]  zero_extendqidi2/0
+	cmpb	$0, 844(%rbx)	# 7526	[c=13 l=7]  *cmpqi_ccno_1/1
+	movzwl	1034(%rbx), %r13d	# 7525	[c=13 l=8]  *zero_extendhisi2/0
+	movzbl	1004(%rbx,%r14), %r15d	# 7523	[c=14 l=9]  *zero_extendqisi2/0
+	movl	%r15d, %edx	# 16807	[c=4 l=3]  *movsi_internal/0
+	jne	.L1794	# 7527	[c=13 l=6]  *jcc
+.L1182:
+	movl	%r13d, %eax	# 14353	[c=4 l=3]  *movsi_internal/0
+	subl	5176(%rbx), %eax	# 7539	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %eax	# 7540	[c=13 l=6]  *cmpsi_1/1
+	jb	.L1184	# 7541	[c=13 l=2]  *jcc
+	movl	%r13d, %eax	# 14355	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %eax	# 7543	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 13653	[c=5 l=5]  *andsi_1_zext
+	cmpb	$0, 1080(%rbx,%rax)	# 7546	[c=14 l=8]  *cmpqi_ccno_1/1
+	je	.L1184	# 7547	[c=13 l=2]  *jcc
+	movl	%r13d, %esi	# 7557	[c=4 l=3]  *movsi_internal/0
+	movq	%rbx, %rdi	# 7558	[c=4 l=3]  *movdi_internal/3
+	movb	%dl, 16(%rsp)	# 15616	[c=4 l=4]  *movqi_internal/8
+	call	data_read_page	# 7559	[c=10 l=5]  *call_value
+	movzbl	16(%rsp), %edx	# 15617	[c=9 l=5]  *movqi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 15619	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_sub8(%rip), %r11	# 15621	[c=1 l=7]  *movdi_internal/4
+	jmp	.L1186	# 18528	[c=1 l=2]  jump
+.L1184:
+	movq	1040(%rbx), %rcx	# 7551	[c=9 l=7]  *movdi_internal/3
+	movslq	%r13d, %rax	# 7550	[c=4 l=3]  *extendsidi2_rex64/1
+	movzbl	(%rcx,%rax), %eax	# 7552	[c=9 l=4]  *movqi_internal/4
+.L1186:
+	movb	%al, 1004(%rbx,%r14)	# 7581	[c=4 l=8]  *movqi_internal/8
+	movl	%r13d, %eax	# 14362	[c=4 l=3]  *movsi_internal/0
+	subl	5176(%rbx), %eax	# 7582	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %eax	# 7583	[c=13 l=6]  *cmpsi_1/1
+	jb	.L1188	# 7584	[c=13 l=2]  *jcc
+	movl	%r13d, %eax	# 14364	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %eax	# 7586	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 13651	[c=5 l=5]  *andsi_1_zext
+	cmpb	$0, 1080(%rbx,%rax)	# 7589	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L1189	# 7590	[c=13 l=6]  *jcc
+.L1188:
+	movq	1040(%rbx), %rax	# 7594	[c=9 l=7]  *movdi_internal/3
+	movslq	%r13d, %r13	# 7593	[c=4 l=3]  *extendsidi2_rex64/1
+	movb	%dl, (%rax,%r13)	# 7595	[c=4 l=4]  *movqi_internal/8
+.L1190:
+	movl	(%rbx), %r15d	# 7616	[c=6 l=3]  *zero_extendsidi2/3
+	movq	%r10, %rcx	# 17294	[c=4 l=3]  *movdi_internal/3
+	movq	%r15, %rdx	# 16808	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 7618	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 7620	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%r15), %eax	# 7621	[c=13 l=5]  *zero_extendqisi2/0
+	movq	(%r15), %r14	# 7624	[c=5 l=3]  *movdi_internal/3
+	addl	%edx, %eax	# 7622	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 17295	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 7623	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 17296	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 17297	[c=4 l=3]  *indirect_jump
+.L1102:
+	cmpb	$0, 844(%rbx)	# 6556	[c=13 l=7]  *cmpqi_ccno_1/1
+	movzwl	12(%r15), %r13d	# 6554	[c=13 l=5]  *zero_extendhisi2/0
+	movzbl	10(%r15), %esi	# 6555	[c=13 l=5]  zero_extendqidi2/0
+	jne	.L1795	# 6557	[c=13 l=6]  *jcc
+	movzbl	1004(%rbx,%rsi), %edx	# 6571	[c=14 l=8]  *zero_extendqisi2/0
+	movzwl	1034(%rbx), %esi	# 6572	[c=13 l=7]  *zero_extendhisi2/0
+	addl	%r13d, %esi	# 6573	[c=4 l=3]  *addsi_1/0
+	movl	%esi, %eax	# 14271	[c=4 l=2]  *movsi_internal/0
+	subl	5176(%rbx), %eax	# 6574	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %eax	# 6575	[c=13 l=6]  *cmpsi_1/1
+	jb	.L1105	# 6576	[c=13 l=2]  *jcc
+	movl	%esi, %eax	# 14273	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %eax	# 6578	[c=4 l=3]  *ashrsi3_1/0
+	cltq	# 6579	[c=4 l=2]  *extendsidi2_rex64/0
+	cmpb	$0, 1080(%rbx,%rax)	# 6580	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L1106	# 6581	[c=13 l=6]  *jcc
+.L1105:
+	movq	1040(%rbx), %rax	# 6585	[c=9 l=7]  *movdi_internal/3
+	movslq	%esi, %rsi	# 6584	[c=4 l=3]  *extendsidi2_rex64/1
+	movb	%dl, (%rax,%rsi)	# 6586	[c=4 l=3]  *movqi_internal/8
+.L1107:
+	testl	%r13d, %r13d	# 6598	[c=4 l=3]  *cmpsi_ccno_1/0
+	jne	.L1104	# 6599	[c=13 l=2]  *jcc
+	subq	$1, 48(%rbx)	# 6601	[c=13 l=5]  *adddi_1/0
+.L1104:
+	movl	(%rbx), %r15d	# 6604	[c=6 l=3]  *zero_extendsidi2/3
+	movq	%r10, %rcx	# 17438	[c=4 l=3]  *movdi_internal/3
+	movq	%r15, %rdx	# 16779	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 6606	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 6608	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%r15), %eax	# 6609	[c=13 l=5]  *zero_extendqisi2/0
+	movq	(%r15), %r14	# 6612	[c=5 l=3]  *movdi_internal/3
+	addl	%edx, %eax	# 6610	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 17439	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 6611	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 17440	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 17441	[c=4 l=3]  *indirect_jump
+.L1108:
+	movzwl	12(%r15), %esi	# 6617	[c=13 l=5]  *zero_extendhisi2/0
+	cmpb	$0, 844(%rbx)	# 6620	[c=13 l=7]  *cmpqi_ccno_1/1
+	movzbl	10(%r15), %eax	# 6619	[c=13 l=5]  zero_extendqidi2/0
+	movl	%esi, %ecx	# 16780	[c=4 l=2]  *movsi_internal/0
+	jne	.L1796	# 6621	[c=13 l=6]  *jcc
+	movzbl	1004(%rbx,%rax), %edx	# 6668	[c=14 l=8]  *zero_extendqisi2/0
+	movl	%esi, %eax	# 14279	[c=4 l=2]  *movsi_internal/0
+	subl	5176(%rbx), %eax	# 6670	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %eax	# 6671	[c=13 l=6]  *cmpsi_1/1
+	jb	.L1114	# 6672	[c=13 l=2]  *jcc
+	movl	%esi, %eax	# 14281	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %eax	# 6674	[c=4 l=3]  *ashrsi3_1/0
+	cltq	# 6675	[c=4 l=2]  *extendsidi2_rex64/0
+	cmpb	$0, 1080(%rbx,%rax)	# 6676	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L1115	# 6677	[c=13 l=6]  *jcc
+.L1114:
+	movzwl	%cx, %eax	# 6680	[c=4 l=3]  zero_extendhidi2/0
+	movq	1040(%rbx), %rcx	# 6681	[c=9 l=7]  *movdi_internal/3
+	movb	%dl, (%rcx,%rax)	# 6682	[c=4 l=3]  *movqi_internal/8
+.L1113:
+	movl	(%rbx), %r15d	# 6694	[c=6 l=3]  *zero_extendsidi2/3
+	movq	%r10, %rcx	# 17430	[c=4 l=3]  *movdi_internal/3
+	movq	%r15, %rdx	# 16782	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 6696	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 6698	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%r15), %eax	# 6699	[c=13 l=5]  *zero_extendqisi2/0
+	movq	(%r15), %r14	# 6702	[c=5 l=3]  *movdi_internal/3
+	addl	%edx, %eax	# 6700	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 17431	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 6701	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 17432	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 17433	[c=4 l=3]  *indirect_jump
+.L1116:
+	movzwl	12(%r15), %esi	# 6707	[c=13 l=5]  zero_extendhidi2/0
+	movzbl	10(%r15), %edx	# 6709	[c=13 l=5]  zero_extendqidi2/0
+	movq	%rsi, %rax	# 16783	[c=4 l=3]  *movdi_internal/3
+	movzbl	1004(%rbx,%rdx), %ecx	# 6710	[c=10 l=8]  *movqi_internal/4
+	movl	%esi, %edx	# 14283	[c=4 l=2]  *movsi_internal/0
+	subl	5176(%rbx), %edx	# 6712	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %edx	# 6713	[c=13 l=6]  *cmpsi_1/1
+	jb	.L1117	# 6714	[c=13 l=2]  *jcc
+	movl	%esi, %edx	# 14285	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %edx	# 6717	[c=4 l=3]  *ashrsi3_1/0
+	movslq	%edx, %rdx	# 6718	[c=4 l=3]  *extendsidi2_rex64/1
+	cmpb	$0, 1080(%rbx,%rdx)	# 6719	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L1118	# 6720	[c=13 l=6]  *jcc
+.L1117:
+	movq	1040(%rbx), %rdx	# 6724	[c=9 l=7]  *movdi_internal/3
+	movb	%cl, (%rdx,%rax)	# 6725	[c=4 l=3]  *movqi_internal/8
+.L1119:
+	movl	(%rbx), %r15d	# 6737	[c=6 l=3]  *zero_extendsidi2/3
+	movq	%r10, %rcx	# 17422	[c=4 l=3]  *movdi_internal/3
+	movq	%r15, %rdx	# 16784	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 6739	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 6741	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%r15), %eax	# 6742	[c=13 l=5]  *zero_extendqisi2/0
+	movq	(%r15), %r14	# 6745	[c=5 l=3]  *movdi_internal/3
+	addl	%edx, %eax	# 6743	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 17423	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 6744	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 17424	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 17425	[c=4 l=3]  *indirect_jump
+.L1120:
+	cmpb	$0, 844(%rbx)	# 6751	[c=13 l=7]  *cmpqi_ccno_1/1
+	movzbl	10(%r15), %esi	# 6750	[c=13 l=5]  zero_extendqidi2/0
+	jne	.L1797	# 6752	[c=13 l=6]  *jcc
+	movzwl	1030(%rbx), %eax	# 6765	[c=13 l=7]  zero_extendhidi2/0
+	movzbl	1004(%rbx,%rsi), %ecx	# 6767	[c=10 l=8]  *movqi_internal/4
+	movzwl	%ax, %esi	# 6768	[c=4 l=3]  *zero_extendhisi2/0
+	movl	%esi, %edx	# 14287	[c=4 l=2]  *movsi_internal/0
+	subl	5176(%rbx), %edx	# 6769	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %edx	# 6770	[c=13 l=6]  *cmpsi_1/1
+	jb	.L1123	# 6771	[c=13 l=2]  *jcc
+	movl	%esi, %edx	# 14289	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %edx	# 6774	[c=4 l=3]  *ashrsi3_1/0
+	movslq	%edx, %rdx	# 6775	[c=4 l=3]  *extendsidi2_rex64/1
+	cmpb	$0, 1080(%rbx,%rdx)	# 6776	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L1124	# 6777	[c=13 l=6]  *jcc
+.L1123:
+	movq	1040(%rbx), %rdx	# 6781	[c=9 l=7]  *movdi_internal/3
+	movb	%cl, (%rdx,%rax)	# 6782	[c=4 l=3]  *movqi_internal/8
+.L1125:
+	subq	$1, 48(%rbx)	# 6794	[c=13 l=5]  *adddi_1/0
+.L1122:
+	movl	(%rbx), %r15d	# 6797	[c=6 l=3]  *zero_extendsidi2/3
+	movq	%r10, %rcx	# 17414	[c=4 l=3]  *movdi_internal/3
+	movq	%r15, %rdx	# 16785	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 6799	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 6801	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%r15), %eax	# 6802	[c=13 l=5]  *zero_extendqisi2/0
+	movq	(%r15), %r14	# 6805	[c=5 l=3]  *movdi_internal/3
+	addl	%edx, %eax	# 6803	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 17415	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 6804	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 17416	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 17417	[c=4 l=3]  *indirect_jump
+.L1126:
+	cmpb	$0, 844(%rbx)	# 6811	[c=13 l=7]  *cmpqi_ccno_1/1
+	movzbl	10(%r15), %esi	# 6810	[c=13 l=5]  zero_extendqidi2/0
+	jne	.L1798	# 6812	[c=13 l=6]  *jcc
+	movzwl	1030(%rbx), %r13d	# 6825	[c=13 l=8]  *zero_extendhisi2/0
+	movzbl	1004(%rbx,%rsi), %edx	# 6828	[c=14 l=8]  *zero_extendqisi2/0
+	subl	$1, %r13d	# 6826	[c=4 l=4]  *addsi_1/0
+	movl	%r13d, %eax	# 14291	[c=4 l=3]  *movsi_internal/0
+	subl	5176(%rbx), %eax	# 6829	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %eax	# 6830	[c=13 l=6]  *cmpsi_1/1
+	jb	.L1129	# 6831	[c=13 l=2]  *jcc
+	movl	%r13d, %eax	# 14293	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %eax	# 6833	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 13656	[c=5 l=5]  *andsi_1_zext
+	cmpb	$0, 1080(%rbx,%rax)	# 6836	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L1130	# 6837	[c=13 l=6]  *jcc
+.L1129:
+	movq	1040(%rbx), %rcx	# 6841	[c=9 l=7]  *movdi_internal/3
+	movslq	%r13d, %rax	# 6840	[c=4 l=3]  *extendsidi2_rex64/1
+	movb	%dl, (%rcx,%rax)	# 6842	[c=4 l=3]  *movqi_internal/8
+.L1131:
+	movw	%r13w, 1030(%rbx)	# 6854	[c=4 l=8]  *movhi_internal/3
+.L1128:
+	movl	(%rbx), %r15d	# 6857	[c=6 l=3]  *zero_extendsidi2/3
+	movq	%r10, %rcx	# 17406	[c=4 l=3]  *movdi_internal/3
+	movq	%r15, %rdx	# 16786	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 6859	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 6861	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%r15), %eax	# 6862	[c=13 l=5]  *zero_extendqisi2/0
+	movq	(%r15), %r14	# 6865	[c=5 l=3]  *movdi_internal/3
+	addl	%edx, %eax	# 6863	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 17407	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 6864	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 17408	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 17409	[c=4 l=3]  *indirect_jump
+.L1138:
+	cmpb	$0, 844(%rbx)	# 6933	[c=13 l=7]  *cmpqi_ccno_1/1
+	movzbl	10(%r15), %esi	# 6932	[c=13 l=5]  zero_extendqidi2/0
+	jne	.L1799	# 6934	[c=13 l=6]  *jcc
+	movzwl	1032(%rbx), %r13d	# 6947	[c=13 l=8]  *zero_extendhisi2/0
+	movzbl	1004(%rbx,%rsi), %edx	# 6950	[c=14 l=8]  *zero_extendqisi2/0
+	subl	$1, %r13d	# 6948	[c=4 l=4]  *addsi_1/0
+	movl	%r13d, %eax	# 14299	[c=4 l=3]  *movsi_internal/0
+	subl	5176(%rbx), %eax	# 6951	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %eax	# 6952	[c=13 l=6]  *cmpsi_1/1
+	jb	.L1141	# 6953	[c=13 l=2]  *jcc
+	movl	%r13d, %eax	# 14301	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %eax	# 6955	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 13655	[c=5 l=5]  *andsi_1_zext
+	cmpb	$0, 1080(%rbx,%rax)	# 6958	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L1142	# 6959	[c=13 l=6]  *jcc
+.L1141:
+	movq	1040(%rbx), %rcx	# 6963	[c=9 l=7]  *movdi_internal/3
+	movslq	%r13d, %rax	# 6962	[c=4 l=3]  *extendsidi2_rex64/1
+	movb	%dl, (%rcx,%rax)	# 6964	[c=4 l=3]  *movqi_internal/8
+.L1143:
+	movw	%r13w, 1032(%rbx)	# 6976	[c=4 l=8]  *movhi_internal/3
+.L1140:
+	movl	(%rbx), %r15d	# 6979	[c=6 l=3]  *zero_extendsidi2/3
+	movq	%r10, %rcx	# 17390	[c=4 l=3]  *movdi_internal/3
+	movq	%r15, %rdx	# 16789	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 6981	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 6983	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%r15), %eax	# 6984	[c=13 l=5]  *zero_extendqisi2/0
+	movq	(%r15), %r14	# 6987	[c=5 l=3]  *movdi_internal/3
+	addl	%edx, %eax	# 6985	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 17391	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 6986	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 17392	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 17393	[c=4 l=3]  *indirect_jump
+.L929:
+	movzbl	10(%r15), %edx	# 4340	[c=13 l=5]  zero_extendqidi2/0
+	movzbl	1004(%rbx,%rdx), %ecx	# 4341	[c=14 l=8]  *zero_extendqisi2/0
+	movl	%ecx, %eax	# 16739	[c=4 l=2]  *movsi_internal/0
+	negl	%ecx	# 4343	[c=4 l=2]  *negsi_1
+	andl	$136, %eax	# 4347	[c=4 l=5]  *andsi_1/0
+	movb	%cl, 1004(%rbx,%rdx)	# 4345	[c=4 l=7]  *movqi_internal/8
+	andl	$511, %ecx	# 4350	[c=4 l=6]  *andsi_1/0
+	imull	$260, %eax, %edx	# 4348	[c=12 l=6]  *mulsi3_1/1
+	andl	$7680, %edx	# 4349	[c=4 l=6]  *andsi_1/0
+	orl	%ecx, %edx	# 4351	[c=5 l=2]  *iorsi_1_zext
+	movzbl	100(%rbx), %ecx	# 4352	[c=9 l=4]  *movqi_internal/4
+	movl	%ecx, %eax	# 14112	[c=4 l=2]  *movsi_internal/0
+	andl	$192, %eax	# 4355	[c=4 l=5]  *andsi_2/0
+	jne	.L930	# 4356	[c=13 l=6]  *jcc
+	leaq	flag_update_table_sub8(%rip), %rax	# 4359	[c=1 l=7]  *movdi_internal/4
+	movl	$63, %ecx	# 23	[c=4 l=5]  *movqi_internal/3
+	addq	%rdx, %rax	# 4360	[c=4 l=3]  *adddi_1/0
+.L931:
+	movl	(%rbx), %r15d	# 4379	[c=6 l=3]  *zero_extendsidi2/3
+	movb	%cl, 100(%rbx)	# 4378	[c=4 l=3]  *movqi_internal/8
+	movq	%r10, %rcx	# 17646	[c=4 l=3]  *movdi_internal/3
+	movq	%rax, 104(%rbx)	# 4377	[c=4 l=4]  *movdi_internal/5
+	movq	%r15, %rdx	# 16740	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 4381	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 4383	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%r15), %eax	# 4384	[c=13 l=5]  *zero_extendqisi2/0
+	movq	(%r15), %r14	# 4387	[c=5 l=3]  *movdi_internal/3
+	addl	%edx, %eax	# 4385	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 17647	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 4386	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 17648	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 17649	[c=4 l=3]  *indirect_jump
+.L932:
+	movl	(%rbx), %r15d	# 4392	[c=6 l=3]  *zero_extendsidi2/3
+	movq	%r10, %rcx	# 17638	[c=4 l=3]  *movdi_internal/3
+	movq	%r15, %rdx	# 16741	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 4394	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 4396	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%r15), %eax	# 4397	[c=13 l=5]  *zero_extendqisi2/0
+	movq	(%r15), %r14	# 4400	[c=5 l=3]  *movdi_internal/3
+	addl	%edx, %eax	# 4398	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 17639	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 4399	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 17640	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 17641	[c=4 l=3]  *indirect_jump
+.L1082:
+	movl	$2, 96(%rbx)	# 6317	[c=4 l=7]  *movsi_internal/1
+	movzwl	1034(%rbx), %edx	# 6318	[c=13 l=7]  *zero_extendhisi2/0
+	cmpl	$65536, 880(%rbx)	# 6321	[c=13 l=10]  *cmpsi_1/0
+	jbe	.L1083	# 6322	[c=13 l=2]  *jcc
+	movl	$59, %eax	# 6324	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%rbx), %eax	# 6325	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %eax	# 6326	[c=13 l=6]  *cmpsi_1/1
+	jb	.L1084	# 6327	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%rbx)	# 6329	[c=13 l=7]  *cmpqi_ccno_1/1
+	jne	.L1085	# 6330	[c=13 l=6]  *jcc
+.L1084:
+	movq	1040(%rbx), %rax	# 6333	[c=9 l=7]  *movdi_internal/3
+	movzbl	59(%rax), %eax	# 6334	[c=13 l=4]  *zero_extendqisi2/0
+.L1086:
+	sall	$16, %eax	# 6345	[c=4 l=3]  *ashlsi3_1/0
+	orl	%eax, %edx	# 6346	[c=4 l=2]  *iorsi_1/0
+.L1083:
+	movl	992(%rbx), %eax	# 6351	[c=9 l=6]  *movsi_internal/0
+	movl	6044(%rbx), %r14d	# 6349	[c=9 l=7]  *movsi_internal/0
+	movq	%rbx, %rdi	# 6361	[c=4 l=3]  *movdi_internal/3
+	movl	%edx, 16(%rsp)	# 15504	[c=4 l=4]  *movsi_internal/1
+	leal	1(%rax,%rax), %r13d	# 6353	[c=8 l=5]  *leasi
+	movl	%r14d, %eax	# 14262	[c=4 l=3]  *movsi_internal/0
+	negl	%eax	# 6354	[c=4 l=2]  *negsi_1
+	andl	%eax, %r13d	# 6355	[c=4 l=3]  *andsi_1/0
+	leaq	6052(%rbx), %rax	# 16274	[c=4 l=7]  *leadi
+	andl	%edx, %r13d	# 6356	[c=4 l=3]  *andsi_1/0
+	movq	%rax, 24(%rsp)	# 14264	[c=4 l=5]  *movdi_internal/5
+	movl	%r13d, %r15d	# 6357	[c=1 l=3]  *zero_extendsidi2/3
+	addq	1056(%rbx), %r15	# 6359	[c=13 l=7]  *adddi_1/1
+	call	spm_operation	# 6362	[c=10 l=5]  *call_value
+	movl	16(%rsp), %edx	# 15505	[c=9 l=4]  *movsi_internal/0
+	leaq	flag_update_table_add8(%rip), %r10	# 15507	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_sub8(%rip), %r11	# 15509	[c=1 l=7]  *movdi_internal/4
+	cmpl	$3, %eax	# 6364	[c=4 l=3]  *cmpsi_1/0
+	je	.L1800	# 6365	[c=13 l=6]  *jcc
+	jg	.L1088	# 6370	[c=13 l=6]  *jcc
+	cmpl	$1, %eax	# 6372	[c=4 l=3]  *cmpsi_1/0
+	je	.L1089	# 6373	[c=13 l=6]  *jcc
+	cmpl	$2, %eax	# 6375	[c=4 l=3]  *cmpsi_1/0
+	jne	.L1091	# 6376	[c=13 l=2]  *jcc
+	movl	%r14d, %edx	# 6403	[c=1 l=3]  *zero_extendsidi2/3
+	movl	$255, %esi	# 6405	[c=4 l=5]  *movsi_internal/0
+	movq	%r15, %rdi	# 6406	[c=4 l=3]  *movdi_internal/3
+.L1571:
+	call	memset@PLT	# 6438	[c=10 l=5]  *call_value
+	leal	(%r14,%r13), %edx	# 16271	[c=4 l=4]  *leasi
+	movl	%r13d, %esi	# 6441	[c=4 l=3]  *movsi_internal/0
+	movq	%rbx, %rdi	# 6442	[c=4 l=3]  *movdi_internal/3
+	call	flash_changed	# 6443	[c=0 l=5]  *call
+	leaq	flag_update_table_add8(%rip), %r10	# 15521	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_sub8(%rip), %r11	# 15523	[c=1 l=7]  *movdi_internal/4
+.L1091:
+	movq	(%rsp), %rax	# 14265	[c=5 l=4]  *movdi_internal/3
+	subq	$1, %rax	# 6456	[c=4 l=4]  *adddi_1/0
+	cmpq	%rbp, %rax	# 6457	[c=4 l=3]  *cmpdi_1/0
+	jb	.L680	# 6458	[c=13 l=6]  *jcc
+	movq	56(%rbx), %rax	# 14266	[c=9 l=4]  *movdi_internal/3
+	cmpq	%rax, 48(%rbx)	# 6461	[c=13 l=4]  *cmpdi_1/0
+	jnb	.L1801	# 6462	[c=13 l=6]  *jcc
+.L1095:
+	cmpl	$0, 120(%rbx)	# 6469	[c=13 l=4]  *cmpsi_ccno_1/1
+	jne	.L613	# 6470	[c=13 l=6]  *jcc
+	movl	(%rbx), %r15d	# 6472	[c=6 l=3]  *zero_extendsidi2/3
+	movl	$1, 96(%rbx)	# 6477	[c=4 l=7]  *movsi_internal/1
+	movq	%r10, %rcx	# 17454	[c=4 l=3]  *movdi_internal/3
+	movq	%r15, %rdx	# 16777	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 6474	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 6476	[c=13 l=7]  *adddi_1/1
+	movzbl	11(%r15), %eax	# 6478	[c=13 l=5]  zero_extendqidi2/0
+	movq	(%r15), %r14	# 6486	[c=5 l=3]  *movdi_internal/3
+	addq	%rax, %rbp	# 6479	[c=4 l=3]  *adddi_1/0
+	movzwl	14(%r15), %eax	# 6481	[c=13 l=5]  zero_extendhidi2/0
+	addq	%rax, 48(%rbx)	# 6482	[c=13 l=4]  *adddi_1/0
+	movq	%rbp, 40(%rbx)	# 6480	[c=4 l=4]  *movdi_internal/5
+	movzbl	9(%r15), %eax	# 6483	[c=13 l=5]  *zero_extendqisi2/0
+	addl	%edx, %eax	# 6484	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 17455	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 6485	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 17456	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 17457	[c=4 l=3]  *indirect_jump
+.L1096:
+	cmpb	$0, 844(%rbx)	# 6493	[c=13 l=7]  *cmpqi_ccno_1/1
+	movzwl	12(%r15), %r13d	# 6491	[c=13 l=5]  *zero_extendhisi2/0
+	movzbl	10(%r15), %esi	# 6492	[c=13 l=5]  zero_extendqidi2/0
+	jne	.L1802	# 6494	[c=13 l=6]  *jcc
+	movzbl	1004(%rbx,%rsi), %edx	# 6508	[c=14 l=8]  *zero_extendqisi2/0
+	movzwl	1032(%rbx), %esi	# 6509	[c=13 l=7]  *zero_extendhisi2/0
+	addl	%r13d, %esi	# 6510	[c=4 l=3]  *addsi_1/0
+	movl	%esi, %eax	# 14267	[c=4 l=2]  *movsi_internal/0
+	subl	5176(%rbx), %eax	# 6511	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %eax	# 6512	[c=13 l=6]  *cmpsi_1/1
+	jb	.L1099	# 6513	[c=13 l=2]  *jcc
+	movl	%esi, %eax	# 14269	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %eax	# 6515	[c=4 l=3]  *ashrsi3_1/0
+	cltq	# 6516	[c=4 l=2]  *extendsidi2_rex64/0
+	cmpb	$0, 1080(%rbx,%rax)	# 6517	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L1100	# 6518	[c=13 l=6]  *jcc
+.L1099:
+	movq	1040(%rbx), %rax	# 6522	[c=9 l=7]  *movdi_internal/3
+	movslq	%esi, %rsi	# 6521	[c=4 l=3]  *extendsidi2_rex64/1
+	movb	%dl, (%rax,%rsi)	# 6523	[c=4 l=3]  *movqi_internal/8
+.L1101:
+	testl	%r13d, %r13d	# 6535	[c=4 l=3]  *cmpsi_ccno_1/0
+	jne	.L1098	# 6536	[c=13 l=2]  *jcc
+	subq	$1, 48(%rbx)	# 6538	[c=13 l=5]  *adddi_1/0
+.L1098:
+	movl	(%rbx), %r15d	# 6541	[c=6 l=3]  *zero_extendsidi2/3
+	movq	%r10, %rcx	# 17446	[c=4 l=3]  *movdi_internal/3
+	movq	%r15, %rdx	# 16778	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 6543	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 6545	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%r15), %eax	# 6546	[c=13 l=5]  *zero_extendqisi2/0
+	movq	(%r15), %r14	# 6549	[c=5 l=3]  *movdi_internal/3
+	addl	%edx, %eax	# 6547	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 17447	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 6548	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 17448	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 17449	[c=4 l=3]  *indirect_jump
+.L1077:
+	movslq	892(%rbx), %rcx	# 6239	[c=13 l=7]  *extendsidi2_rex64/1
+	leaq	se.0(%rip), %rdx	# 6238	[c=1 l=7]  *movdi_internal/4
+	movq	1040(%rbx), %rsi	# 6236	[c=9 l=7]  *movdi_internal/3
+	movl	$2, 96(%rbx)	# 6235	[c=4 l=7]  *movsi_internal/1
+	movzwl	(%rdx,%rcx,4), %eax	# 6240	[c=14 l=4]  zero_extendhidi2/0
+	movzbl	(%rsi,%rax), %eax	# 6243	[c=9 l=4]  *movqi_internal/4
+	andb	2(%rdx,%rcx,4), %al	# 6244	[c=14 l=4]  *andqi_2_maybe_si/1
+	je	.L1078	# 6246	[c=13 l=2]  *jcc
+	movzbl	100(%rbx), %ecx	# 6249	[c=13 l=4]  *zero_extendqisi2/0
+	movzbl	63(%rsi), %eax	# 6250	[c=13 l=4]  *zero_extendqisi2/0
+	movq	48(%rbx), %r13	# 6248	[c=9 l=4]  *movdi_internal/3
+	movl	%ecx, %edx	# 16775	[c=4 l=2]  *movsi_internal/0
+	notl	%ecx	# 6252	[c=4 l=2]  *one_cmplsi2_1/0
+	andl	%ecx, %eax	# 6253	[c=4 l=2]  *andsi_1/0
+	movq	104(%rbx), %rcx	# 6254	[c=9 l=4]  *movdi_internal/3
+	andb	(%rcx), %dl	# 6255	[c=9 l=2]  *andqi_1/1
+	orl	%edx, %eax	# 6257	[c=4 l=2]  *iorsi_1/0
+	testb	$-128, %al	# 16275	[c=4 l=2]  *testqi_1_maybe_si/1
+	je	.L1080	# 6260	[c=13 l=6]  *jcc
+	movq	%rbx, %rdi	# 6271	[c=4 l=3]  *movdi_internal/3
+	call	events_sleep@PLT	# 6272	[c=10 l=5]  *call_value
+	testb	%al, %al	# 6275	[c=4 l=2]  *cmpqi_ccno_1/0
+	je	.L1080	# 6276	[c=13 l=6]  *jcc
+	movq	64(%rbx), %rax	# 6279	[c=9 l=4]  *movdi_internal/3
+	addq	48(%rbx), %rax	# 6280	[c=13 l=4]  *adddi_1/1
+	leaq	flag_update_table_sub8(%rip), %r11	# 15493	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 15491	[c=1 l=7]  *movdi_internal/4
+	subq	%r13, %rax	# 6281	[c=4 l=3]  *subdi_1/0
+	movq	%rax, 64(%rbx)	# 6282	[c=4 l=4]  *movdi_internal/5
+.L1078:
+	movq	(%rsp), %rax	# 14260	[c=5 l=4]  *movdi_internal/3
+	subq	$1, %rax	# 6285	[c=4 l=4]  *adddi_1/0
+	cmpq	%rbp, %rax	# 6286	[c=4 l=3]  *cmpdi_1/0
+	jb	.L680	# 6287	[c=13 l=6]  *jcc
+	movq	56(%rbx), %rax	# 14261	[c=9 l=4]  *movdi_internal/3
+	cmpq	%rax, 48(%rbx)	# 6290	[c=13 l=4]  *cmpdi_1/0
+	jnb	.L1803	# 6291	[c=13 l=6]  *jcc
+.L1081:
+	movl	(%rbx), %r15d	# 6298	[c=6 l=3]  *zero_extendsidi2/3
+	movl	$1, 96(%rbx)	# 6303	[c=4 l=7]  *movsi_internal/1
+	movq	%r10, %rcx	# 17462	[c=4 l=3]  *movdi_internal/3
+	movq	%r15, %rdx	# 16776	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 6300	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 6302	[c=13 l=7]  *adddi_1/1
+	movzbl	11(%r15), %eax	# 6304	[c=13 l=5]  zero_extendqidi2/0
+	movq	(%r15), %r14	# 6312	[c=5 l=3]  *movdi_internal/3
+	addq	%rax, %rbp	# 6305	[c=4 l=3]  *adddi_1/0
+	movzwl	14(%r15), %eax	# 6307	[c=13 l=5]  zero_extendhidi2/0
+	addq	%rax, 48(%rbx)	# 6308	[c=13 l=4]  *adddi_1/0
+	movq	%rbp, 40(%rbx)	# 6306	[c=4 l=4]  *movdi_internal/5
+	movzbl	9(%r15), %eax	# 6309	[c=13 l=5]  *zero_extendqisi2/0
+	addl	%edx, %eax	# 6310	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 17463	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 6311	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 17464	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 17465	[c=4 l=3]  *indirect_jump
+.L1024:
+	movswl	12(%r15), %eax	# 5429	[c=13 l=5]  extendhisi2/1
+	movl	$2, 96(%rbx)	# 5428	[c=4 l=7]  *movsi_internal/1
+	cmpw	$-1, %ax	# 5430	[c=4 l=4]  *cmphi_1/0
+	je	.L1804	# 5431	[c=13 l=6]  *jcc
+	addl	(%rbx), %eax	# 5444	[c=9 l=2]  *addsi_1/1
+	andl	992(%rbx), %eax	# 5447	[c=13 l=6]  *andsi_1/1
+	movl	%eax, (%rbx)	# 5448	[c=4 l=2]  *movsi_internal/1
+	movq	(%rsp), %rax	# 14181	[c=5 l=4]  *movdi_internal/3
+	subq	$1, %rax	# 5449	[c=4 l=4]  *adddi_1/0
+	cmpq	%rbp, %rax	# 5450	[c=4 l=3]  *cmpdi_1/0
+	jb	.L680	# 5451	[c=13 l=6]  *jcc
+	movq	56(%rbx), %rax	# 14182	[c=9 l=4]  *movdi_internal/3
+	cmpq	%rax, 48(%rbx)	# 5454	[c=13 l=4]  *cmpdi_1/0
+	jnb	.L1805	# 5455	[c=13 l=6]  *jcc
+.L1026:
+	movl	(%rbx), %r15d	# 5462	[c=6 l=3]  *zero_extendsidi2/3
+	movl	$1, 96(%rbx)	# 5467	[c=4 l=7]  *movsi_internal/1
+	movq	%r10, %rcx	# 17566	[c=4 l=3]  *movdi_internal/3
+	movq	%r15, %rdx	# 16751	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 5464	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 5466	[c=13 l=7]  *adddi_1/1
+	movzbl	11(%r15), %eax	# 5468	[c=13 l=5]  zero_extendqidi2/0
+	movq	(%r15), %r14	# 5476	[c=5 l=3]  *movdi_internal/3
+	addq	%rax, %rbp	# 5469	[c=4 l=3]  *adddi_1/0
+	movzwl	14(%r15), %eax	# 5471	[c=13 l=5]  zero_extendhidi2/0
+	addq	%rax, 48(%rbx)	# 5472	[c=13 l=4]  *adddi_1/0
+	movq	%rbp, 40(%rbx)	# 5470	[c=4 l=4]  *movdi_internal/5
+	movzbl	9(%r15), %eax	# 5473	[c=13 l=5]  *zero_extendqisi2/0
+	addl	%edx, %eax	# 5474	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 17567	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 5475	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 17568	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 17569	[c=4 l=3]  *indirect_jump
+.L927:
+	movzbl	10(%r15), %eax	# 4260	[c=13 l=5]  zero_extendqidi2/0
+	movsbl	1004(%rbx,%rax), %ecx	# 4261	[c=14 l=8]  extendqisi2
+	movzwl	12(%r15), %eax	# 4263	[c=13 l=5]  zero_extendhidi2/0
+	movl	(%rbx), %r15d	# 4286	[c=6 l=3]  *zero_extendsidi2/3
+	movsbl	1004(%rbx,%rax), %eax	# 4264	[c=14 l=8]  extendqisi2
+	imull	%eax, %ecx	# 4265	[c=12 l=3]  *mulsi3_1/2
+	movzbl	100(%rbx), %eax	# 4267	[c=13 l=4]  *zero_extendqisi2/0
+	andl	$-4, %eax	# 4268	[c=4 l=3]  *andsi_1/0
+	movl	%ecx, %esi	# 14098	[c=4 l=2]  *movsi_internal/0
+	movl	%eax, %edx	# 14097	[c=4 l=2]  *movsi_internal/0
+	xorl	%eax, %eax	# 18284	[c=4 l=2]  *movsi_xor
+	andl	$65535, %esi	# 18285	[c=4 l=6]  *andsi_2/0
+	sete	%al	# 18286	[c=4 l=3]  *setcc_qi_slp
+	sarl	$15, %esi	# 4275	[c=4 l=3]  *ashrsi3_1/0
+	addl	%eax, %eax	# 4274	[c=4 l=2]  *ashlsi3_1/0
+	orl	%esi, %eax	# 4276	[c=4 l=2]  *iorsi_1/0
+	movq	104(%rbx), %rsi	# 4277	[c=9 l=4]  *movdi_internal/3
+	movzbl	(%rsi), %edi	# 18287	[c=5 l=3]  *movqi_internal/4
+	movw	%cx, 1004(%rbx)	# 4285	[c=4 l=7]  *movhi_internal/3
+	movq	%r10, %rcx	# 17662	[c=4 l=3]  *movdi_internal/3
+	andl	%edx, %edi	# 19112	[c=4 l=2]  *andsi_1/0
+	movl	%edi, %esi	# 14101	[c=4 l=2]  *movqi_internal/1
+	orl	%esi, %eax	# 16313	[c=4 l=2]  *iorsi_1/0
+	movb	%al, 101(%rbx)	# 4280	[c=4 l=3]  *movqi_internal/8
+	movl	%edx, %eax	# 14102	[c=4 l=2]  *movqi_internal/0
+	leaq	101(%rbx), %rdx	# 16315	[c=4 l=4]  *leadi
+	movq	%rdx, 104(%rbx)	# 4284	[c=4 l=4]  *movdi_internal/5
+	orl	$3, %eax	# 16314	[c=4 l=3]  *iorsi_1/0
+	movq	%r15, %rdx	# 16737	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 4288	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 4290	[c=13 l=7]  *adddi_1/1
+	movb	%al, 100(%rbx)	# 4282	[c=4 l=3]  *movqi_internal/8
+	movzbl	9(%r15), %eax	# 4291	[c=13 l=5]  *zero_extendqisi2/0
+	movq	(%r15), %r14	# 4294	[c=5 l=3]  *movdi_internal/3
+	addl	%edx, %eax	# 4292	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 17663	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 4293	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 17664	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 17665	[c=4 l=3]  *indirect_jump
+.L677:
+	movzbl	10(%r15), %eax	# 1032	[c=13 l=5]  *zero_extendqisi2/0
+	movzbl	100(%rbx), %ecx	# 1035	[c=13 l=4]  *zero_extendqisi2/0
+	movl	(%rbx), %r15d	# 1047	[c=6 l=3]  *zero_extendsidi2/3
+	movl	%eax, %edx	# 16671	[c=4 l=2]  *movsi_internal/0
+	notl	%eax	# 1034	[c=4 l=2]  *one_cmplsi2_1/0
+	andl	%ecx, %eax	# 1036	[c=4 l=2]  *andsi_1/0
+	movq	104(%rbx), %rcx	# 1038	[c=9 l=4]  *movdi_internal/3
+	orl	%eax, %edx	# 16383	[c=4 l=2]  *iorsi_1/0
+	movzbl	(%rcx), %edi	# 18362	[c=5 l=3]  *movqi_internal/4
+	movb	%dl, 100(%rbx)	# 1044	[c=4 l=3]  *movqi_internal/8
+	leaq	101(%rbx), %rdx	# 16384	[c=4 l=4]  *leadi
+	movq	%r10, %rcx	# 18062	[c=4 l=3]  *movdi_internal/3
+	movq	%rdx, 104(%rbx)	# 1046	[c=4 l=4]  *movdi_internal/5
+	movq	%r15, %rdx	# 16672	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 1049	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 1051	[c=13 l=7]  *adddi_1/1
+	andl	%eax, %edi	# 19111	[c=4 l=2]  *andsi_1/0
+	movb	%dil, 101(%rbx)	# 1042	[c=4 l=4]  *movqi_internal/8
+	movzbl	9(%r15), %eax	# 1052	[c=13 l=5]  *zero_extendqisi2/0
+	movq	(%r15), %r14	# 1055	[c=5 l=3]  *movdi_internal/3
+	addl	%edx, %eax	# 1053	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 18063	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 1054	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 18064	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 18065	[c=4 l=3]  *indirect_jump
+.L678:
+	movq	1040(%rbx), %rax	# 1067	[c=9 l=7]  *movdi_internal/3
+	movzbl	100(%rbx), %r8d	# 1065	[c=13 l=5]  *zero_extendqisi2/0
+	movzbl	10(%r15), %ecx	# 1062	[c=13 l=5]  zero_extendqidi2/0
+	movzwl	12(%r15), %edx	# 1060	[c=13 l=5]  *zero_extendhisi2/0
+	movzbl	63(%rax), %eax	# 1068	[c=13 l=4]  *zero_extendqisi2/0
+	movl	%r8d, %edi	# 16673	[c=4 l=3]  *movsi_internal/0
+	notl	%r8d	# 1070	[c=4 l=3]  *one_cmplsi2_1/0
+	movzbl	1004(%rbx,%rcx), %esi	# 1063	[c=14 l=8]  *zero_extendqisi2/0
+	andl	%r8d, %eax	# 1071	[c=4 l=3]  *andsi_1/0
+	movq	104(%rbx), %r8	# 1072	[c=9 l=4]  *movdi_internal/3
+	orl	%edx, %esi	# 1064	[c=4 l=2]  *iorsi_1/0
+	notl	%edx	# 1079	[c=4 l=2]  *one_cmplsi2_1/0
+	andb	(%r8), %dil	# 1073	[c=9 l=3]  *andqi_1/1
+	orl	%edi, %eax	# 1075	[c=4 l=2]  *iorsi_1/0
+	sall	$25, %eax	# 1077	[c=4 l=3]  *ashlsi3_1/0
+	sarl	$31, %eax	# 1078	[c=4 l=3]  ashrsi3_cvt/1
+	orl	%edx, %eax	# 1080	[c=4 l=2]  *iorsi_1/0
+	andl	%esi, %eax	# 1081	[c=4 l=2]  *andsi_1/0
+	movb	%al, 1004(%rbx,%rcx)	# 1082	[c=4 l=7]  *movqi_internal/8
+	movl	(%rbx), %r15d	# 1083	[c=6 l=3]  *zero_extendsidi2/3
+	movq	%r10, %rcx	# 18054	[c=4 l=3]  *movdi_internal/3
+	movq	%r15, %rdx	# 16674	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 1085	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 1087	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%r15), %eax	# 1088	[c=13 l=5]  *zero_extendqisi2/0
+	movq	(%r15), %r14	# 1091	[c=5 l=3]  *movdi_internal/3
+	addl	%edx, %eax	# 1089	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 18055	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 1090	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 18056	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 18057	[c=4 l=3]  *indirect_jump
+.L980:
+	movl	5176(%rbx), %r15d	# 4959	[c=9 l=7]  *movsi_internal/0
+	movl	$61, %eax	# 4961	[c=4 l=5]  *movsi_internal/0
+	movl	5180(%rbx), %edx	# 4960	[c=9 l=6]  *movsi_internal/0
+	movl	$2, 96(%rbx)	# 4958	[c=4 l=7]  *movsi_internal/1
+	subl	%r15d, %eax	# 4962	[c=4 l=3]  *subsi_1/0
+	cmpl	%edx, %eax	# 4963	[c=4 l=2]  *cmpsi_1/0
+	jb	.L981	# 4964	[c=13 l=6]  *jcc
+	cmpb	$1, 1081(%rbx)	# 4968	[c=13 l=7]  *cmpqi_1/0
+	ja	.L1806	# 4969	[c=13 l=6]  *jcc
+	movq	1040(%rbx), %rax	# 12055	[c=9 l=7]  *movdi_internal/3
+	movzbl	61(%rax), %r14d	# 12056	[c=13 l=5]  *zero_extendqisi2/0
+.L983:
+	movzbl	62(%rax), %r13d	# 5006	[c=13 l=5]  *zero_extendqisi2/0
+.L985:
+	sall	$8, %r13d	# 5009	[c=4 l=4]  *ashlsi3_1/0
+	orl	%r14d, %r13d	# 5010	[c=4 l=3]  *iorsi_1/0
+	xorl	%r14d, %r14d	# 18276	[c=4 l=3]  *movdi_xor
+	cmpb	$0, 840(%rbx)	# 5011	[c=13 l=7]  *cmpqi_ccno_1/1
+	je	.L986	# 5012	[c=13 l=2]  *jcc
+	addl	$1, %r13d	# 5014	[c=4 l=4]  *addsi_1/0
+	movl	%r13d, %eax	# 14149	[c=4 l=3]  *movsi_internal/0
+	subl	%r15d, %eax	# 5015	[c=4 l=3]  *subsi_1/0
+	cmpl	%edx, %eax	# 5016	[c=4 l=2]  *cmpsi_1/0
+	jb	.L987	# 5017	[c=13 l=2]  *jcc
+	movl	%r13d, %eax	# 14151	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %eax	# 5019	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 13664	[c=5 l=5]  *andsi_1_zext
+	cmpb	$0, 1080(%rbx,%rax)	# 5022	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L988	# 5023	[c=13 l=6]  *jcc
+.L987:
+	movq	1040(%rbx), %rdx	# 5027	[c=9 l=7]  *movdi_internal/3
+	movslq	%r13d, %rax	# 5026	[c=4 l=3]  *extendsidi2_rex64/1
+	movzbl	(%rdx,%rax), %r14d	# 5028	[c=13 l=5]  *zero_extendqisi2/0
+.L989:
+	sall	$16, %r14d	# 5039	[c=4 l=4]  *ashlsi3_1/0
+.L986:
+	leal	1(%r13), %esi	# 16295	[c=4 l=4]  *leasi
+	movl	%esi, %eax	# 14153	[c=4 l=2]  *movsi_internal/0
+	subl	5176(%rbx), %eax	# 5043	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %eax	# 5044	[c=13 l=6]  *cmpsi_1/1
+	jb	.L990	# 5045	[c=13 l=2]  *jcc
+	movl	%esi, %eax	# 14155	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %eax	# 5047	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 13663	[c=5 l=5]  *andsi_1_zext
+	cmpb	$0, 1080(%rbx,%rax)	# 5050	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L991	# 5051	[c=13 l=6]  *jcc
+.L990:
+	movq	1040(%rbx), %rax	# 5055	[c=9 l=7]  *movdi_internal/3
+	movslq	%esi, %rsi	# 5054	[c=4 l=3]  *extendsidi2_rex64/1
+	movzbl	(%rax,%rsi), %eax	# 5056	[c=13 l=4]  *zero_extendqisi2/0
+.L992:
+	sall	$8, %eax	# 5067	[c=4 l=3]  *ashlsi3_1/0
+	addl	$2, %r13d	# 5069	[c=4 l=4]  *addsi_1/0
+	orl	%r14d, %eax	# 5068	[c=4 l=3]  *iorsi_1/0
+	movl	%eax, %r15d	# 14158	[c=4 l=3]  *movsi_internal/0
+	movl	%r13d, %eax	# 14159	[c=4 l=3]  *movsi_internal/0
+	subl	5176(%rbx), %eax	# 5070	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %eax	# 5071	[c=13 l=6]  *cmpsi_1/1
+	jb	.L993	# 5072	[c=13 l=2]  *jcc
+	movl	%r13d, %eax	# 14161	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %eax	# 5074	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 13662	[c=5 l=5]  *andsi_1_zext
+	cmpb	$0, 1080(%rbx,%rax)	# 5077	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L994	# 5078	[c=13 l=6]  *jcc
+.L993:
+	movq	1040(%rbx), %rdx	# 5082	[c=9 l=7]  *movdi_internal/3
+	movslq	%r13d, %rax	# 5081	[c=4 l=3]  *extendsidi2_rex64/1
+	movzbl	(%rdx,%rax), %r14d	# 5083	[c=13 l=5]  *zero_extendqisi2/0
+.L995:
+	orl	%r15d, %r14d	# 5094	[c=4 l=3]  *iorsi_1/0
+	cmpl	%r14d, 992(%rbx)	# 5095	[c=13 l=7]  *cmpsi_1/0
+	jb	.L1585	# 5096	[c=13 l=6]  *jcc
+	movl	$61, %eax	# 5104	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%rbx), %eax	# 5105	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %eax	# 5106	[c=13 l=6]  *cmpsi_1/1
+	jb	.L997	# 5107	[c=13 l=2]  *jcc
+	cmpb	$1, 1081(%rbx)	# 5111	[c=13 l=7]  *cmpqi_1/0
+	ja	.L1807	# 5112	[c=13 l=6]  *jcc
+.L997:
+	movq	1040(%rbx), %rax	# 5123	[c=9 l=7]  *movdi_internal/3
+	movb	%r13b, 61(%rax)	# 5124	[c=4 l=4]  *movqi_internal/8
+.L998:
+	movl	$62, %eax	# 5128	[c=4 l=5]  *movsi_internal/0
+	sarl	$8, %r13d	# 5127	[c=4 l=4]  *ashrsi3_1/0
+	subl	5176(%rbx), %eax	# 5129	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %eax	# 5130	[c=13 l=6]  *cmpsi_1/1
+	jb	.L999	# 5131	[c=13 l=2]  *jcc
+	cmpb	$1, 1081(%rbx)	# 5135	[c=13 l=7]  *cmpqi_1/0
+	ja	.L1808	# 5136	[c=13 l=6]  *jcc
+.L999:
+	movq	1040(%rbx), %rax	# 5147	[c=9 l=7]  *movdi_internal/3
+	movb	%r13b, 62(%rax)	# 5148	[c=4 l=4]  *movqi_internal/8
+.L1000:
+	movq	(%rsp), %rdi	# 14163	[c=5 l=4]  *movdi_internal/3
+	movzbl	840(%rbx), %eax	# 5152	[c=13 l=7]  zero_extendqidi2/0
+	movl	%r14d, (%rbx)	# 5151	[c=4 l=3]  *movsi_internal/1
+	addq	48(%rbx), %rax	# 5154	[c=13 l=4]  *adddi_1/1
+	leaq	-1(%rdi), %rdx	# 16294	[c=4 l=4]  *leadi
+	movq	%rax, 48(%rbx)	# 5155	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rbp, %rdx	# 5157	[c=4 l=3]  *cmpdi_1/0
+	jb	.L680	# 5158	[c=13 l=6]  *jcc
+	cmpq	56(%rbx), %rax	# 5160	[c=13 l=4]  *cmpdi_1/1
+	jnb	.L1809	# 5161	[c=13 l=6]  *jcc
+.L1001:
+	movl	(%rbx), %r15d	# 5168	[c=6 l=3]  *zero_extendsidi2/3
+	movl	$1, 96(%rbx)	# 5173	[c=4 l=7]  *movsi_internal/1
+	movq	%r10, %rcx	# 17582	[c=4 l=3]  *movdi_internal/3
+	movq	%r15, %rdx	# 16749	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 5170	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 5172	[c=13 l=7]  *adddi_1/1
+	movzbl	11(%r15), %eax	# 5174	[c=13 l=5]  zero_extendqidi2/0
+	movq	(%r15), %r14	# 5182	[c=5 l=3]  *movdi_internal/3
+	addq	%rax, %rbp	# 5175	[c=4 l=3]  *adddi_1/0
+	movzwl	14(%r15), %eax	# 5177	[c=13 l=5]  zero_extendhidi2/0
+	addq	%rax, 48(%rbx)	# 5178	[c=13 l=4]  *adddi_1/0
+	movq	%rbp, 40(%rbx)	# 5176	[c=4 l=4]  *movdi_internal/5
+	movzbl	9(%r15), %eax	# 5179	[c=13 l=5]  *zero_extendqisi2/0
+	addl	%edx, %eax	# 5180	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 17583	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 5181	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 17584	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 17585	[c=4 l=3]  *indirect_jump
+.L1002:
+	movl	5176(%rbx), %r15d	# 5188	[c=9 l=7]  *movsi_internal/0
+	movl	$61, %eax	# 5190	[c=4 l=5]  *movsi_internal/0
+	movl	5180(%rbx), %edx	# 5189	[c=9 l=6]  *movsi_internal/0
+	movl	$2, 96(%rbx)	# 5187	[c=4 l=7]  *movsi_internal/1
+	subl	%r15d, %eax	# 5191	[c=4 l=3]  *subsi_1/0
+	cmpl	%edx, %eax	# 5192	[c=4 l=2]  *cmpsi_1/0
+	jb	.L1003	# 5193	[c=13 l=6]  *jcc
+	cmpb	$1, 1081(%rbx)	# 5197	[c=13 l=7]  *cmpqi_1/0
+	ja	.L1810	# 5198	[c=13 l=6]  *jcc
+	movq	1040(%rbx), %rax	# 12061	[c=9 l=7]  *movdi_internal/3
+	movzbl	61(%rax), %r14d	# 12062	[c=13 l=5]  *zero_extendqisi2/0
+.L1005:
+	movzbl	62(%rax), %r13d	# 5235	[c=13 l=5]  *zero_extendqisi2/0
+.L1007:
+	sall	$8, %r13d	# 5238	[c=4 l=4]  *ashlsi3_1/0
+	orl	%r14d, %r13d	# 5239	[c=4 l=3]  *iorsi_1/0
+	xorl	%r14d, %r14d	# 18273	[c=4 l=3]  *movdi_xor
+	cmpb	$0, 840(%rbx)	# 5240	[c=13 l=7]  *cmpqi_ccno_1/1
+	je	.L1008	# 5241	[c=13 l=2]  *jcc
+	addl	$1, %r13d	# 5243	[c=4 l=4]  *addsi_1/0
+	movl	%r13d, %eax	# 14164	[c=4 l=3]  *movsi_internal/0
+	subl	%r15d, %eax	# 5244	[c=4 l=3]  *subsi_1/0
+	cmpl	%edx, %eax	# 5245	[c=4 l=2]  *cmpsi_1/0
+	jb	.L1009	# 5246	[c=13 l=2]  *jcc
+	movl	%r13d, %eax	# 14166	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %eax	# 5248	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 13661	[c=5 l=5]  *andsi_1_zext
+	cmpb	$0, 1080(%rbx,%rax)	# 5251	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L1010	# 5252	[c=13 l=6]  *jcc
+.L1009:
+	movq	1040(%rbx), %rdx	# 5256	[c=9 l=7]  *movdi_internal/3
+	movslq	%r13d, %rax	# 5255	[c=4 l=3]  *extendsidi2_rex64/1
+	movzbl	(%rdx,%rax), %r14d	# 5257	[c=13 l=5]  *zero_extendqisi2/0
+.L1011:
+	sall	$16, %r14d	# 5268	[c=4 l=4]  *ashlsi3_1/0
+.L1008:
+	leal	1(%r13), %esi	# 16293	[c=4 l=4]  *leasi
+	movl	%esi, %eax	# 14168	[c=4 l=2]  *movsi_internal/0
+	subl	5176(%rbx), %eax	# 5272	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %eax	# 5273	[c=13 l=6]  *cmpsi_1/1
+	jb	.L1012	# 5274	[c=13 l=2]  *jcc
+	movl	%esi, %eax	# 14170	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %eax	# 5276	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 13660	[c=5 l=5]  *andsi_1_zext
+	cmpb	$0, 1080(%rbx,%rax)	# 5279	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L1013	# 5280	[c=13 l=6]  *jcc
+.L1012:
+	movq	1040(%rbx), %rax	# 5284	[c=9 l=7]  *movdi_internal/3
+	movslq	%esi, %rsi	# 5283	[c=4 l=3]  *extendsidi2_rex64/1
+	movzbl	(%rax,%rsi), %eax	# 5285	[c=13 l=4]  *zero_extendqisi2/0
+.L1014:
+	sall	$8, %eax	# 5296	[c=4 l=3]  *ashlsi3_1/0
+	addl	$2, %r13d	# 5298	[c=4 l=4]  *addsi_1/0
+	orl	%r14d, %eax	# 5297	[c=4 l=3]  *iorsi_1/0
+	movl	%eax, %r15d	# 14173	[c=4 l=3]  *movsi_internal/0
+	movl	%r13d, %eax	# 14174	[c=4 l=3]  *movsi_internal/0
+	subl	5176(%rbx), %eax	# 5299	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %eax	# 5300	[c=13 l=6]  *cmpsi_1/1
+	jb	.L1015	# 5301	[c=13 l=2]  *jcc
+	movl	%r13d, %eax	# 14176	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %eax	# 5303	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 13659	[c=5 l=5]  *andsi_1_zext
+	cmpb	$0, 1080(%rbx,%rax)	# 5306	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L1016	# 5307	[c=13 l=6]  *jcc
+.L1015:
+	movq	1040(%rbx), %rdx	# 5311	[c=9 l=7]  *movdi_internal/3
+	movslq	%r13d, %rax	# 5310	[c=4 l=3]  *extendsidi2_rex64/1
+	movzbl	(%rdx,%rax), %r14d	# 5312	[c=13 l=5]  *zero_extendqisi2/0
+.L1017:
+	orl	%r15d, %r14d	# 5323	[c=4 l=3]  *iorsi_1/0
+	cmpl	%r14d, 992(%rbx)	# 5324	[c=13 l=7]  *cmpsi_1/0
+	jb	.L1585	# 5325	[c=13 l=6]  *jcc
+	movl	$61, %eax	# 5333	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%rbx), %eax	# 5334	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %eax	# 5335	[c=13 l=6]  *cmpsi_1/1
+	jb	.L1019	# 5336	[c=13 l=2]  *jcc
+	cmpb	$1, 1081(%rbx)	# 5340	[c=13 l=7]  *cmpqi_1/0
+	ja	.L1811	# 5341	[c=13 l=6]  *jcc
+.L1019:
+	movq	1040(%rbx), %rax	# 5352	[c=9 l=7]  *movdi_internal/3
+	movb	%r13b, 61(%rax)	# 5353	[c=4 l=4]  *movqi_internal/8
+.L1020:
+	movl	$62, %eax	# 5357	[c=4 l=5]  *movsi_internal/0
+	sarl	$8, %r13d	# 5356	[c=4 l=4]  *ashrsi3_1/0
+	subl	5176(%rbx), %eax	# 5358	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %eax	# 5359	[c=13 l=6]  *cmpsi_1/1
+	jb	.L1021	# 5360	[c=13 l=2]  *jcc
+	cmpb	$1, 1081(%rbx)	# 5364	[c=13 l=7]  *cmpqi_1/0
+	ja	.L1812	# 5365	[c=13 l=6]  *jcc
+.L1021:
+	movq	1040(%rbx), %rax	# 5376	[c=9 l=7]  *movdi_internal/3
+	movb	%r13b, 62(%rax)	# 5377	[c=4 l=4]  *movqi_internal/8
+.L1022:
+	movq	104(%rbx), %rdx	# 5388	[c=9 l=4]  *movdi_internal/3
+	movzbl	100(%rbx), %eax	# 5385	[c=13 l=4]  *zero_extendqisi2/0
+	movl	%r14d, (%rbx)	# 5380	[c=4 l=3]  *movsi_internal/1
+	movzbl	840(%rbx), %ecx	# 5381	[c=13 l=7]  zero_extendqidi2/0
+	addq	48(%rbx), %rcx	# 5383	[c=13 l=4]  *adddi_1/1
+	movq	%rcx, 48(%rbx)	# 5384	[c=4 l=4]  *movdi_internal/5
+	movzbl	(%rdx), %edi	# 18271	[c=5 l=3]  *movqi_internal/4
+	andb	$127, %al	# 16287	[c=4 l=2]  *andqi_1_slp/0
+	movq	%rcx, 6024(%rbx)	# 5396	[c=4 l=7]  *movdi_internal/5
+	andl	%eax, %edi	# 19110	[c=4 l=2]  *andsi_1/0
+	orl	$-128, %eax	# 16291	[c=4 l=3]  *iorsi_1/0
+	movb	%al, 100(%rbx)	# 5393	[c=4 l=3]  *movqi_internal/8
+	movl	%edi, %edx	# 14179	[c=4 l=2]  *movqi_internal/1
+	movq	(%rsp), %rax	# 14180	[c=5 l=4]  *movdi_internal/3
+	orl	$-128, %edx	# 16290	[c=4 l=3]  *iorsi_1/0
+	movb	%dl, 101(%rbx)	# 5391	[c=4 l=3]  *movqi_internal/8
+	subq	$1, %rax	# 5397	[c=4 l=4]  *adddi_1/0
+	leaq	101(%rbx), %rdx	# 16292	[c=4 l=4]  *leadi
+	movq	%rdx, 104(%rbx)	# 5395	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rbp, %rax	# 5398	[c=4 l=3]  *cmpdi_1/0
+	jb	.L680	# 5399	[c=13 l=6]  *jcc
+	cmpq	56(%rbx), %rcx	# 5401	[c=13 l=4]  *cmpdi_1/1
+	jnb	.L1813	# 5402	[c=13 l=6]  *jcc
+.L1023:
+	movl	(%rbx), %r15d	# 5409	[c=6 l=3]  *zero_extendsidi2/3
+	movl	$1, 96(%rbx)	# 5414	[c=4 l=7]  *movsi_internal/1
+	movq	%r10, %rcx	# 17574	[c=4 l=3]  *movdi_internal/3
+	movq	%r15, %rdx	# 16750	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 5411	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 5413	[c=13 l=7]  *adddi_1/1
+	movzbl	11(%r15), %eax	# 5415	[c=13 l=5]  zero_extendqidi2/0
+	movq	(%r15), %r14	# 5423	[c=5 l=3]  *movdi_internal/3
+	addq	%rax, %rbp	# 5416	[c=4 l=3]  *adddi_1/0
+	movzwl	14(%r15), %eax	# 5418	[c=13 l=5]  zero_extendhidi2/0
+	addq	%rax, 48(%rbx)	# 5419	[c=13 l=4]  *adddi_1/0
+	movq	%rbp, 40(%rbx)	# 5417	[c=4 l=4]  *movdi_internal/5
+	movzbl	9(%r15), %eax	# 5420	[c=13 l=5]  *zero_extendqisi2/0
+	addl	%edx, %eax	# 5421	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 17575	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 5422	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 17576	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 17577	[c=4 l=3]  *indirect_jump
+.L671:
+	movzbl	10(%r15), %edx	# 940	[c=13 l=5]  zero_extendqidi2/0
+	movzwl	12(%r15), %eax	# 939	[c=13 l=5]  *zero_extendhisi2/0
+	movzbl	1004(%rbx,%rdx), %ecx	# 941	[c=14 l=8]  *zero_extendqisi2/0
+	andl	%ecx, %eax	# 942	[c=4 l=2]  *andsi_1/0
+	movb	%al, 1004(%rbx,%rdx)	# 944	[c=4 l=7]  *movqi_internal/8
+	movzbl	100(%rbx), %edx	# 945	[c=9 l=4]  *movqi_internal/4
+	movl	%edx, %ecx	# 13866	[c=4 l=2]  *movsi_internal/0
+	andl	$225, %ecx	# 948	[c=4 l=6]  *andsi_2/0
+	jne	.L672	# 949	[c=13 l=6]  *jcc
+	leaq	flag_update_table_logical(%rip), %rdx	# 952	[c=1 l=7]  *movdi_internal/4
+	cltq	# 951	[c=4 l=2]  *extendsidi2_rex64/0
+	addq	%rdx, %rax	# 953	[c=4 l=3]  *adddi_1/0
+	movl	$30, %edx	# 9	[c=4 l=5]  *movqi_internal/3
+.L673:
+	movl	(%rbx), %r15d	# 972	[c=6 l=3]  *zero_extendsidi2/3
+	movb	%dl, 100(%rbx)	# 971	[c=4 l=3]  *movqi_internal/8
+	movq	%r10, %rcx	# 18078	[c=4 l=3]  *movdi_internal/3
+	movq	%rax, 104(%rbx)	# 970	[c=4 l=4]  *movdi_internal/5
+	movq	%r15, %rdx	# 16669	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 974	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 976	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%r15), %eax	# 977	[c=13 l=5]  *zero_extendqisi2/0
+	movq	(%r15), %r14	# 980	[c=5 l=3]  *movdi_internal/3
+	addl	%edx, %eax	# 978	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 18079	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 979	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 18080	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 18081	[c=4 l=3]  *indirect_jump
+.L1246:
+	movzbl	100(%rbx), %edx	# 8563	[c=9 l=4]  *movqi_internal/4
+	movzbl	10(%r15), %eax	# 8561	[c=13 l=5]  zero_extendqidi2/0
+	movl	%edx, %ecx	# 14503	[c=4 l=2]  *movsi_internal/0
+	movzbl	1004(%rbx,%rax), %eax	# 8562	[c=14 l=8]  zero_extendqidi2/0
+	andl	$225, %ecx	# 8566	[c=4 l=6]  *andsi_2/0
+	jne	.L1247	# 8567	[c=13 l=6]  *jcc
+	leaq	flag_update_table_logical(%rip), %rdx	# 8570	[c=1 l=7]  *movdi_internal/4
+	addq	%rdx, %rax	# 8571	[c=4 l=3]  *adddi_1/0
+	movl	$30, %edx	# 50	[c=4 l=5]  *movqi_internal/3
+.L1248:
+	movq	%rax, 104(%rbx)	# 8589	[c=4 l=4]  *movdi_internal/5
+	movb	%dl, 100(%rbx)	# 8590	[c=4 l=3]  *movqi_internal/8
+	jmp	.L1567	# 18549	[c=1 l=5]  jump
+.L1030:
+	movzbl	10(%r15), %r14d	# 5538	[c=13 l=5]  zero_extendqidi2/0
+	movzwl	12(%r15), %eax	# 5541	[c=13 l=5]  zero_extendhidi2/0
+	movq	1040(%rbx), %r13	# 5543	[c=9 l=7]  *movdi_internal/3
+	movq	104(%rbx), %r15	# 5547	[c=9 l=4]  *movdi_internal/3
+	movzbl	1004(%rbx,%rax), %edx	# 5542	[c=14 l=8]  *zero_extendqisi2/0
+	movzbl	100(%rbx), %eax	# 5544	[c=13 l=4]  *zero_extendqisi2/0
+	movzbl	1004(%rbx,%r14), %esi	# 5539	[c=14 l=9]  *zero_extendqisi2/0
+	movl	%edx, %edi	# 16756	[c=4 l=2]  *movsi_internal/0
+	movl	%eax, %r9d	# 14189	[c=4 l=3]  *movsi_internal/0
+	movl	%eax, %ecx	# 16754	[c=4 l=2]  *movsi_internal/0
+	movl	%esi, %r8d	# 16755	[c=4 l=3]  *movsi_internal/0
+	subl	%edx, %esi	# 5550	[c=4 l=2]  *subsi_1/0
+	movzbl	63(%r13), %edx	# 5551	[c=13 l=5]  *zero_extendqisi2/0
+	notl	%r9d	# 5546	[c=4 l=3]  *one_cmplsi2_1/0
+	movl	%esi, 16(%rsp)	# 16061	[c=4 l=4]  *movsi_internal/1
+	andl	$136, %r8d	# 5561	[c=4 l=7]  *andsi_1/0
+	andl	$136, %edi	# 5564	[c=4 l=6]  *andsi_1/0
+	andl	%r9d, %edx	# 5552	[c=4 l=3]  *andsi_1/0
+	movl	%edx, %esi	# 16016	[c=4 l=2]  *movsi_internal/0
+	movzbl	(%r15), %edx	# 18259	[c=5 l=4]  *movqi_internal/4
+	andl	%eax, %edx	# 19106	[c=4 l=2]  *andsi_1/0
+	andl	$-64, %eax	# 5567	[c=4 l=3]  *andsi_1/0
+	orl	%edx, %esi	# 5555	[c=4 l=2]  *iorsi_1/0
+	movl	%esi, %edx	# 16014	[c=4 l=2]  *movsi_internal/0
+	movl	16(%rsp), %esi	# 16058	[c=9 l=4]  *movsi_internal/0
+	andl	$1, %edx	# 5556	[c=4 l=3]  *andsi_1/0
+	subl	%edx, %esi	# 5557	[c=4 l=2]  *subsi_1/0
+	leal	(%rdi,%r8,2), %edx	# 5565	[c=8 l=4]  *leasi
+	movl	%eax, %r8d	# 14195	[c=4 l=3]  *movsi_internal/0
+	imull	$260, %edx, %edx	# 5570	[c=12 l=6]  *mulsi3_1/1
+	movb	%sil, 1004(%rbx,%r14)	# 5559	[c=4 l=8]  *movqi_internal/8
+	andl	$511, %esi	# 5572	[c=4 l=6]  *andsi_1/0
+	movzbl	(%r15), %edi	# 5566	[c=5 l=4]  *movqi_internal/4
+	leaq	flag_update_table_sub8(%rip), %rax	# 5569	[c=1 l=7]  *movdi_internal/4
+	movl	(%rbx), %r15d	# 5590	[c=6 l=3]  *zero_extendsidi2/3
+	andl	%edi, %ecx	# 16280	[c=4 l=2]  *andsi_1/0
+	andl	%r8d, %edi	# 16281	[c=4 l=3]  *andsi_1/0
+	andl	$7680, %edx	# 5571	[c=4 l=6]  *andsi_1/0
+	orl	%esi, %edx	# 5573	[c=4 l=2]  *iorsi_1/0
+	movl	%edx, %esi	# 5574	[c=1 l=2]  *zero_extendsidi2/3
+	movzbl	63(%r13), %edx	# 5576	[c=13 l=5]  *zero_extendqisi2/0
+	andl	%r9d, %edx	# 5577	[c=4 l=3]  *andsi_1/0
+	orl	%ecx, %edx	# 5580	[c=4 l=2]  *iorsi_1/0
+	movzbl	(%rax,%rsi), %ecx	# 18261	[c=9 l=4]  *movqi_internal/4
+	orl	$-3, %edx	# 5581	[c=4 l=3]  *iorsi_1/0
+	andl	%edx, %ecx	# 19107	[c=4 l=2]  *andsi_1/0
+	leaq	101(%rbx), %rdx	# 16284	[c=4 l=4]  *leadi
+	movl	%ecx, %eax	# 14197	[c=4 l=2]  *movqi_internal/0
+	movq	%rdx, 104(%rbx)	# 5589	[c=4 l=4]  *movdi_internal/5
+	movq	%r15, %rdx	# 16757	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 5592	[c=4 l=4]  *ashldi3_1/0
+	orl	%eax, %edi	# 16282	[c=4 l=2]  *iorsi_1/0
+	movl	%r8d, %eax	# 14198	[c=4 l=3]  *movqi_internal/2
+	addq	1064(%rbx), %r15	# 5594	[c=13 l=7]  *adddi_1/1
+	movq	%r10, %rcx	# 17550	[c=4 l=3]  *movdi_internal/3
+	orl	$63, %eax	# 16283	[c=4 l=3]  *iorsi_1/0
+	movb	%dil, 101(%rbx)	# 5585	[c=4 l=4]  *movqi_internal/8
+	movb	%al, 100(%rbx)	# 5587	[c=4 l=3]  *movqi_internal/8
+	movzbl	9(%r15), %eax	# 5595	[c=13 l=5]  *zero_extendqisi2/0
+	movq	(%r15), %r14	# 5598	[c=5 l=3]  *movdi_internal/3
+	addl	%edx, %eax	# 5596	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 17551	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 5597	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 17552	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 17553	[c=4 l=3]  *indirect_jump
+.L862:
+	movzwl	12(%r15), %esi	# 3498	[c=13 l=5]  zero_extendhidi2/0
+	cmpb	$0, 844(%rbx)	# 3501	[c=13 l=7]  *cmpqi_ccno_1/1
+	movzbl	10(%r15), %r13d	# 3500	[c=13 l=5]  zero_extendqidi2/0
+	movq	%rsi, %rax	# 16713	[c=4 l=3]  *movdi_internal/3
+	jne	.L1814	# 3502	[c=13 l=6]  *jcc
+	movl	%esi, %edx	# 14048	[c=4 l=2]  *movsi_internal/0
+	subl	5176(%rbx), %edx	# 3555	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %edx	# 3556	[c=13 l=6]  *cmpsi_1/1
+	jb	.L869	# 3557	[c=13 l=2]  *jcc
+	movl	%esi, %edx	# 14050	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %edx	# 3559	[c=4 l=3]  *ashrsi3_1/0
+	movslq	%edx, %rdx	# 3560	[c=4 l=3]  *extendsidi2_rex64/1
+	cmpb	$0, 1080(%rbx,%rdx)	# 3561	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L870	# 3562	[c=13 l=6]  *jcc
+.L869:
+	movq	1040(%rbx), %rdx	# 3566	[c=9 l=7]  *movdi_internal/3
+	movzbl	(%rdx,%rax), %eax	# 3567	[c=13 l=4]  *zero_extendqisi2/0
+.L868:
+	movb	%al, 1004(%rbx,%r13)	# 3582	[c=4 l=8]  *movqi_internal/8
+	movl	(%rbx), %r15d	# 3583	[c=6 l=3]  *zero_extendsidi2/3
+	movq	%r10, %rcx	# 17790	[c=4 l=3]  *movdi_internal/3
+	movq	%r15, %rdx	# 16714	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 3585	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 3587	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%r15), %eax	# 3588	[c=13 l=5]  *zero_extendqisi2/0
+	movq	(%r15), %r14	# 3591	[c=5 l=3]  *movdi_internal/3
+	addl	%edx, %eax	# 3589	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 17791	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 3590	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 17792	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 17793	[c=4 l=3]  *indirect_jump
+.L872:
+	movzwl	12(%r15), %esi	# 3596	[c=13 l=5]  zero_extendhidi2/0
+	movzbl	10(%r15), %r13d	# 3597	[c=13 l=5]  *zero_extendqisi2/0
+	movl	%esi, %edx	# 14052	[c=4 l=2]  *movsi_internal/0
+	movq	%rsi, %rax	# 16715	[c=4 l=3]  *movdi_internal/3
+	subl	5176(%rbx), %edx	# 3599	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %edx	# 3600	[c=13 l=6]  *cmpsi_1/1
+	jb	.L873	# 3601	[c=13 l=2]  *jcc
+	movl	%esi, %edx	# 14054	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %edx	# 3604	[c=4 l=3]  *ashrsi3_1/0
+	movslq	%edx, %rdx	# 3605	[c=4 l=3]  *extendsidi2_rex64/1
+	cmpb	$0, 1080(%rbx,%rdx)	# 3606	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L874	# 3607	[c=13 l=6]  *jcc
+.L873:
+	movq	1040(%rbx), %rdx	# 3611	[c=9 l=7]  *movdi_internal/3
+	movzbl	(%rdx,%rax), %edx	# 3612	[c=13 l=4]  *zero_extendqisi2/0
+.L875:
+	movslq	%r13d, %rax	# 3623	[c=4 l=3]  *extendsidi2_rex64/1
+	movq	%r10, %rcx	# 17782	[c=4 l=3]  *movdi_internal/3
+	movb	%dl, 1004(%rbx,%rax)	# 3624	[c=4 l=7]  *movqi_internal/8
+	movl	(%rbx), %r15d	# 3625	[c=6 l=3]  *zero_extendsidi2/3
+	movq	%r15, %rdx	# 16716	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 3627	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 3629	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%r15), %eax	# 3630	[c=13 l=5]  *zero_extendqisi2/0
+	movq	(%r15), %r14	# 3633	[c=5 l=3]  *movdi_internal/3
+	addl	%edx, %eax	# 3631	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 17783	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 3632	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 17784	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 17785	[c=4 l=3]  *indirect_jump
+.L839:
+	movzwl	12(%r15), %esi	# 3219	[c=13 l=5]  zero_extendhidi2/0
+	movzbl	10(%r15), %r13d	# 3220	[c=13 l=5]  *zero_extendqisi2/0
+	movl	%esi, %edx	# 14026	[c=4 l=2]  *movsi_internal/0
+	movq	%rsi, %rax	# 16706	[c=4 l=3]  *movdi_internal/3
+	subl	5176(%rbx), %edx	# 3222	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %edx	# 3223	[c=13 l=6]  *cmpsi_1/1
+	jb	.L840	# 3224	[c=13 l=2]  *jcc
+	movl	%esi, %edx	# 14028	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %edx	# 3227	[c=4 l=3]  *ashrsi3_1/0
+	movslq	%edx, %rdx	# 3228	[c=4 l=3]  *extendsidi2_rex64/1
+	cmpb	$0, 1080(%rbx,%rdx)	# 3229	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L841	# 3230	[c=13 l=6]  *jcc
+.L840:
+	movq	1040(%rbx), %rdx	# 3234	[c=9 l=7]  *movdi_internal/3
+	movzbl	(%rdx,%rax), %edx	# 3235	[c=13 l=4]  *zero_extendqisi2/0
+.L842:
+	movslq	%r13d, %rax	# 3246	[c=4 l=3]  *extendsidi2_rex64/1
+	movq	%r10, %rcx	# 17838	[c=4 l=3]  *movdi_internal/3
+	movb	%dl, 1004(%rbx,%rax)	# 3247	[c=4 l=7]  *movqi_internal/8
+	movl	(%rbx), %r15d	# 3248	[c=6 l=3]  *zero_extendsidi2/3
+	movq	%r15, %rdx	# 16707	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 3250	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 3252	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%r15), %eax	# 3253	[c=13 l=5]  *zero_extendqisi2/0
+	movq	(%r15), %r14	# 3256	[c=5 l=3]  *movdi_internal/3
+	addl	%edx, %eax	# 3254	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 17839	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 3255	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 17840	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 17841	[c=4 l=3]  *indirect_jump
+.L843:
+	movzbl	10(%r15), %ecx	# 3262	[c=13 l=5]  zero_extendqidi2/0
+	movzbl	1004(%rbx,%rcx), %edx	# 3263	[c=10 l=8]  *movqi_internal/4
+	leal	1(%rdx), %eax	# 16327	[c=4 l=3]  *leasi
+	addl	$1, %edx	# 16328	[c=4 l=3]  *addsi_1/0
+	movb	%dl, 1004(%rbx,%rcx)	# 3269	[c=4 l=7]  *movqi_internal/8
+	movzbl	100(%rbx), %edx	# 3270	[c=9 l=4]  *movqi_internal/4
+	movzbl	%al, %eax	# 3266	[c=4 l=3]  zero_extendqidi2/0
+	movl	%edx, %ecx	# 14030	[c=4 l=2]  *movsi_internal/0
+	andl	$225, %ecx	# 3273	[c=4 l=6]  *andsi_2/0
+	jne	.L844	# 3274	[c=13 l=6]  *jcc
+	leaq	flag_update_table_inc(%rip), %rdx	# 3277	[c=1 l=7]  *movdi_internal/4
+	addq	%rdx, %rax	# 3278	[c=4 l=3]  *adddi_1/0
+	movl	$30, %edx	# 20	[c=4 l=5]  *movqi_internal/3
+.L845:
+	movl	(%rbx), %r15d	# 3297	[c=6 l=3]  *zero_extendsidi2/3
+	movb	%dl, 100(%rbx)	# 3296	[c=4 l=3]  *movqi_internal/8
+	movq	%r10, %rcx	# 17830	[c=4 l=3]  *movdi_internal/3
+	movq	%rax, 104(%rbx)	# 3295	[c=4 l=4]  *movdi_internal/5
+	movq	%r15, %rdx	# 16708	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 3299	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 3301	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%r15), %eax	# 3302	[c=13 l=5]  *zero_extendqisi2/0
+	movq	(%r15), %r14	# 3305	[c=5 l=3]  *movdi_internal/3
+	addl	%edx, %eax	# 3303	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 17831	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 3304	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 17832	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 17833	[c=4 l=3]  *indirect_jump
+.L663:
+	movzbl	10(%r15), %eax	# 720	[c=13 l=5]  zero_extendqidi2/0
+	movzwl	12(%r15), %edx	# 723	[c=13 l=5]  zero_extendhidi2/0
+	movzbl	1004(%rbx,%rax), %ecx	# 721	[c=14 l=8]  *zero_extendqisi2/0
+	movzbl	1004(%rbx,%rdx), %edx	# 724	[c=14 l=8]  *zero_extendqisi2/0
+	leal	(%rcx,%rdx), %esi	# 16405	[c=4 l=3]  *leasi
+	movb	%sil, 1004(%rbx,%rax)	# 727	[c=4 l=8]  *movqi_internal/8
+	movl	%ecx, %esi	# 13844	[c=4 l=2]  *movsi_internal/0
+	movl	%edx, %eax	# 13846	[c=4 l=2]  *movsi_internal/0
+	addl	%ecx, %edx	# 738	[c=4 l=2]  *addsi_1/0
+	andl	$136, %esi	# 729	[c=4 l=6]  *andsi_1/0
+	andl	$136, %eax	# 732	[c=4 l=5]  *andsi_1/0
+	leal	(%rax,%rsi,2), %eax	# 733	[c=8 l=3]  *leasi
+	imull	$260, %eax, %eax	# 734	[c=12 l=6]  *mulsi3_1/1
+	andl	$7680, %eax	# 735	[c=4 l=5]  *andsi_1/0
+	orl	%edx, %eax	# 739	[c=5 l=2]  *iorsi_1_zext
+	movzbl	100(%rbx), %edx	# 740	[c=9 l=4]  *movqi_internal/4
+	movl	%edx, %ecx	# 13848	[c=4 l=2]  *movsi_internal/0
+	andl	$192, %ecx	# 743	[c=4 l=6]  *andsi_2/0
+	jne	.L664	# 744	[c=13 l=6]  *jcc
+	leaq	flag_update_table_add8(%rip), %rcx	# 747	[c=1 l=7]  *movdi_internal/4
+	movl	$63, %edx	# 7	[c=4 l=5]  *movqi_internal/3
+	addq	%rcx, %rax	# 748	[c=4 l=3]  *adddi_1/0
+.L665:
+	movl	(%rbx), %r15d	# 767	[c=6 l=3]  *zero_extendsidi2/3
+	movb	%dl, 100(%rbx)	# 766	[c=4 l=3]  *movqi_internal/8
+	movq	%r10, %rcx	# 18110	[c=4 l=3]  *movdi_internal/3
+	movq	%rax, 104(%rbx)	# 765	[c=4 l=4]  *movdi_internal/5
+	movq	%r15, %rdx	# 16665	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 769	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 771	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%r15), %eax	# 772	[c=13 l=5]  *zero_extendqisi2/0
+	movq	(%r15), %r14	# 775	[c=5 l=3]  *movdi_internal/3
+	addl	%edx, %eax	# 773	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 18111	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 774	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 18112	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 18113	[c=4 l=3]  *indirect_jump
+.L1222:
+	movzbl	10(%r15), %eax	# 8012	[c=13 l=5]  zero_extendqidi2/0
+	movzwl	12(%r15), %edx	# 8015	[c=13 l=5]  zero_extendhidi2/0
+	movzbl	1004(%rbx,%rax), %eax	# 8013	[c=10 l=8]  *movqi_internal/4
+	movzbl	1004(%rbx,%rdx), %esi	# 8016	[c=14 l=8]  *zero_extendqisi2/0
+.L1588:
+	movl	%eax, %ecx	# 14425	[c=4 l=2]  *movsi_internal/0
+	movl	%esi, %edx	# 14427	[c=4 l=2]  *movsi_internal/0
+	andl	$136, %edx	# 8076	[c=4 l=6]  *andsi_1/0
+	andl	$136, %ecx	# 8073	[c=4 l=6]  *andsi_1/0
+	leal	(%rdx,%rcx,2), %ecx	# 8077	[c=8 l=3]  *leasi
+	movzbl	%al, %edx	# 8078	[c=4 l=3]  *zero_extendqisi2/0
+	imull	$260, %ecx, %eax	# 8082	[c=12 l=6]  *mulsi3_1/1
+	subl	%esi, %edx	# 8080	[c=4 l=2]  *subsi_1/0
+	movzbl	100(%rbx), %ecx	# 8085	[c=9 l=4]  *movqi_internal/4
+	andl	$511, %edx	# 8081	[c=4 l=6]  *andsi_1/0
+	andl	$7680, %eax	# 8083	[c=4 l=5]  *andsi_1/0
+	orl	%eax, %edx	# 8084	[c=5 l=2]  *iorsi_1_zext
+	movl	%ecx, %eax	# 14429	[c=4 l=2]  *movsi_internal/0
+	andl	$192, %eax	# 8088	[c=4 l=5]  *andsi_2/0
+	jne	.L1226	# 8089	[c=13 l=6]  *jcc
+	leaq	flag_update_table_sub8(%rip), %rax	# 8092	[c=1 l=7]  *movdi_internal/4
+	movl	$63, %esi	# 44	[c=4 l=5]  *movqi_internal/3
+	leaq	(%rax,%rdx), %rcx	# 16247	[c=4 l=4]  *leadi
+	leaq	101(%rbx), %rdx	# 12287	[c=4 l=4]  *leadi
+.L1227:
+	movq	%rcx, 104(%rbx)	# 8110	[c=4 l=4]  *movdi_internal/5
+	movb	%sil, 100(%rbx)	# 8111	[c=4 l=4]  *movqi_internal/8
+	jmp	.L1569	# 18552	[c=1 l=5]  jump
+.L668:
+	movzbl	10(%r15), %edx	# 892	[c=13 l=5]  zero_extendqidi2/0
+	movzwl	12(%r15), %eax	# 891	[c=13 l=5]  zero_extendhidi2/0
+	movzbl	1004(%rbx,%rax), %eax	# 893	[c=10 l=8]  *movqi_internal/4
+	andb	1004(%rbx,%rdx), %al	# 894	[c=14 l=7]  *andqi_1/1
+	movb	%al, 1004(%rbx,%rdx)	# 896	[c=4 l=7]  *movqi_internal/8
+	movzbl	100(%rbx), %edx	# 897	[c=9 l=4]  *movqi_internal/4
+	movl	%edx, %ecx	# 13864	[c=4 l=2]  *movsi_internal/0
+	andl	$225, %ecx	# 900	[c=4 l=6]  *andsi_2/0
+	jne	.L669	# 901	[c=13 l=6]  *jcc
+	leaq	flag_update_table_logical(%rip), %rdx	# 904	[c=1 l=7]  *movdi_internal/4
+	movzbl	%al, %eax	# 903	[c=4 l=3]  zero_extendqidi2/0
+	addq	%rdx, %rax	# 905	[c=4 l=3]  *adddi_1/0
+	movl	$30, %edx	# 8	[c=4 l=5]  *movqi_internal/3
+.L670:
+	movl	(%rbx), %r15d	# 925	[c=6 l=3]  *zero_extendsidi2/3
+	movb	%dl, 100(%rbx)	# 924	[c=4 l=3]  *movqi_internal/8
+	movq	%r10, %rcx	# 18086	[c=4 l=3]  *movdi_internal/3
+	movq	%rax, 104(%rbx)	# 923	[c=4 l=4]  *movdi_internal/5
+	movq	%r15, %rdx	# 16668	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 927	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 929	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%r15), %eax	# 930	[c=13 l=5]  *zero_extendqisi2/0
+	movq	(%r15), %r14	# 933	[c=5 l=3]  *movdi_internal/3
+	addl	%edx, %eax	# 931	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 18087	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 932	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 18088	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 18089	[c=4 l=3]  *indirect_jump
+.L1225:
+	movzbl	10(%r15), %eax	# 8070	[c=13 l=5]  zero_extendqidi2/0
+	movzwl	12(%r15), %esi	# 8068	[c=9 l=5]  *movhi_internal/2
+	movzbl	1004(%rbx,%rax), %eax	# 8071	[c=10 l=8]  *movqi_internal/4
+	jmp	.L1588	# 18554	[c=1 l=5]  jump
+.L850:
+	cmpb	$0, 844(%rbx)	# 3376	[c=13 l=7]  *cmpqi_ccno_1/1
+	movzwl	12(%r15), %r14d	# 3374	[c=13 l=5]  *zero_extendhisi2/0
+	movzbl	10(%r15), %r13d	# 3375	[c=13 l=5]  zero_extendqidi2/0
+	jne	.L1815	# 3377	[c=13 l=6]  *jcc
+	movzwl	1032(%rbx), %esi	# 3390	[c=13 l=7]  *zero_extendhisi2/0
+	addl	%r14d, %esi	# 3391	[c=4 l=3]  *addsi_1/0
+	movl	%esi, %eax	# 14034	[c=4 l=2]  *movsi_internal/0
+	subl	5176(%rbx), %eax	# 3392	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %eax	# 3393	[c=13 l=6]  *cmpsi_1/1
+	jb	.L853	# 3394	[c=13 l=2]  *jcc
+	movl	%esi, %eax	# 14036	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %eax	# 3396	[c=4 l=3]  *ashrsi3_1/0
+	cltq	# 3397	[c=4 l=2]  *extendsidi2_rex64/0
+	cmpb	$0, 1080(%rbx,%rax)	# 3398	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L854	# 3399	[c=13 l=6]  *jcc
+.L853:
+	movq	1040(%rbx), %rax	# 3403	[c=9 l=7]  *movdi_internal/3
+	movslq	%esi, %rsi	# 3402	[c=4 l=3]  *extendsidi2_rex64/1
+	movzbl	(%rax,%rsi), %eax	# 3404	[c=13 l=4]  *zero_extendqisi2/0
+.L855:
+	movb	%al, 1004(%rbx,%r13)	# 3416	[c=4 l=8]  *movqi_internal/8
+	testl	%r14d, %r14d	# 3417	[c=4 l=3]  *cmpsi_ccno_1/0
+	jne	.L852	# 3418	[c=13 l=2]  *jcc
+	subq	$1, 48(%rbx)	# 3420	[c=13 l=5]  *adddi_1/0
+.L852:
+	movl	(%rbx), %r15d	# 3423	[c=6 l=3]  *zero_extendsidi2/3
+	movq	%r10, %rcx	# 17806	[c=4 l=3]  *movdi_internal/3
+	movq	%r15, %rdx	# 16711	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 3425	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 3427	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%r15), %eax	# 3428	[c=13 l=5]  *zero_extendqisi2/0
+	movq	(%r15), %r14	# 3431	[c=5 l=3]  *movdi_internal/3
+	addl	%edx, %eax	# 3429	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 17807	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 3430	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 17808	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 17809	[c=4 l=3]  *indirect_jump
+.L856:
+	cmpb	$0, 844(%rbx)	# 3438	[c=13 l=7]  *cmpqi_ccno_1/1
+	movzwl	12(%r15), %r14d	# 3436	[c=13 l=5]  *zero_extendhisi2/0
+	movzbl	10(%r15), %r13d	# 3437	[c=13 l=5]  zero_extendqidi2/0
+	jne	.L1816	# 3439	[c=13 l=6]  *jcc
+	movzwl	1034(%rbx), %esi	# 3452	[c=13 l=7]  *zero_extendhisi2/0
+	addl	%r14d, %esi	# 3453	[c=4 l=3]  *addsi_1/0
+	movl	%esi, %eax	# 14038	[c=4 l=2]  *movsi_internal/0
+	subl	5176(%rbx), %eax	# 3454	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %eax	# 3455	[c=13 l=6]  *cmpsi_1/1
+	jb	.L859	# 3456	[c=13 l=2]  *jcc
+	movl	%esi, %eax	# 14040	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %eax	# 3458	[c=4 l=3]  *ashrsi3_1/0
+	cltq	# 3459	[c=4 l=2]  *extendsidi2_rex64/0
+	cmpb	$0, 1080(%rbx,%rax)	# 3460	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L860	# 3461	[c=13 l=6]  *jcc
+.L859:
+	movq	1040(%rbx), %rax	# 3465	[c=9 l=7]  *movdi_internal/3
+	movslq	%esi, %rsi	# 3464	[c=4 l=3]  *extendsidi2_rex64/1
+	movzbl	(%rax,%rsi), %eax	# 3466	[c=13 l=4]  *zero_extendqisi2/0
+.L861:
+	movb	%al, 1004(%rbx,%r13)	# 3478	[c=4 l=8]  *movqi_internal/8
+	testl	%r14d, %r14d	# 3479	[c=4 l=3]  *cmpsi_ccno_1/0
+	jne	.L858	# 3480	[c=13 l=2]  *jcc
+	subq	$1, 48(%rbx)	# 3482	[c=13 l=5]  *adddi_1/0
+.L858:
+	movl	(%rbx), %r15d	# 3485	[c=6 l=3]  *zero_extendsidi2/3
+	movq	%r10, %rcx	# 17798	[c=4 l=3]  *movdi_internal/3
+	movq	%r15, %rdx	# 16712	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 3487	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 3489	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%r15), %eax	# 3490	[c=13 l=5]  *zero_extendqisi2/0
+	movq	(%r15), %r14	# 3493	[c=5 l=3]  *movdi_internal/3
+	addl	%edx, %eax	# 3491	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 17799	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 3492	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 17800	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 17801	[c=4 l=3]  *indirect_jump
+.L925:
+	movzwl	12(%r15), %ecx	# 4195	[c=13 l=5]  zero_extendhidi2/0
+	movzbl	10(%r15), %eax	# 4196	[c=13 l=5]  *zero_extendqisi2/0
+	movq	%rcx, %rdx	# 16734	[c=4 l=3]  *movdi_internal/3
+	movzbl	1004(%rbx,%rcx), %esi	# 4198	[c=10 l=8]  *movqi_internal/4
+	movslq	%eax, %rcx	# 4199	[c=4 l=3]  *extendsidi2_rex64/1
+	addl	$1, %eax	# 4204	[c=4 l=3]  *addsi_1/0
+	addl	$1, %edx	# 4201	[c=4 l=3]  *addsi_1/0
+	cltq	# 4205	[c=4 l=2]  *extendsidi2_rex64/0
+	movslq	%edx, %rdx	# 4202	[c=4 l=3]  *extendsidi2_rex64/1
+	movb	%sil, 1004(%rbx,%rcx)	# 4200	[c=4 l=8]  *movqi_internal/8
+	movq	%r10, %rcx	# 17678	[c=4 l=3]  *movdi_internal/3
+	movzbl	1004(%rbx,%rdx), %edx	# 4203	[c=10 l=8]  *movqi_internal/4
+	movb	%dl, 1004(%rbx,%rax)	# 4206	[c=4 l=7]  *movqi_internal/8
+	movl	(%rbx), %r15d	# 4207	[c=6 l=3]  *zero_extendsidi2/3
+	movq	%r15, %rdx	# 16735	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 4209	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 4211	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%r15), %eax	# 4212	[c=13 l=5]  *zero_extendqisi2/0
+	movq	(%r15), %r14	# 4215	[c=5 l=3]  *movdi_internal/3
+	addl	%edx, %eax	# 4213	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 17679	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 4214	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 17680	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 17681	[c=4 l=3]  *indirect_jump
+.L926:
+	movzbl	10(%r15), %eax	# 4221	[c=13 l=5]  zero_extendqidi2/0
+	movzbl	1004(%rbx,%rax), %ecx	# 4222	[c=14 l=8]  *zero_extendqisi2/0
+	movzwl	12(%r15), %eax	# 4224	[c=13 l=5]  zero_extendhidi2/0
+	movl	(%rbx), %r15d	# 4246	[c=6 l=3]  *zero_extendsidi2/3
+	movzbl	1004(%rbx,%rax), %eax	# 4225	[c=14 l=8]  *zero_extendqisi2/0
+	imull	%eax, %ecx	# 4226	[c=12 l=3]  *mulsi3_1/2
+	movzbl	100(%rbx), %eax	# 4227	[c=13 l=4]  *zero_extendqisi2/0
+	andl	$-4, %eax	# 4228	[c=4 l=3]  *andsi_1/0
+	cmpl	$1, %ecx	# 4232	[c=4 l=3]  *cmpsi_1/0
+	movl	%eax, %esi	# 14089	[c=4 l=2]  *movsi_internal/0
+	movl	%ecx, %edx	# 14090	[c=4 l=2]  *movsi_internal/0
+	sbbl	%eax, %eax	# 4233	[c=8 l=2]  *x86_movsicc_0_m1_neg
+	sarl	$15, %edx	# 4235	[c=4 l=3]  *ashrsi3_1/0
+	andl	$2, %eax	# 4234	[c=4 l=3]  *andsi_1/0
+	orl	%edx, %eax	# 4236	[c=4 l=2]  *iorsi_1/0
+	movq	104(%rbx), %rdx	# 4237	[c=9 l=4]  *movdi_internal/3
+	movzbl	(%rdx), %edi	# 18289	[c=5 l=3]  *movqi_internal/4
+	movw	%cx, 1004(%rbx)	# 4245	[c=4 l=7]  *movhi_internal/3
+	movq	%r10, %rcx	# 17670	[c=4 l=3]  *movdi_internal/3
+	andl	%esi, %edi	# 19105	[c=4 l=2]  *andsi_1/0
+	movl	%edi, %edx	# 14093	[c=4 l=2]  *movqi_internal/1
+	orl	%eax, %edx	# 16316	[c=4 l=2]  *iorsi_1/0
+	movl	%esi, %eax	# 14094	[c=4 l=2]  *movqi_internal/1
+	movb	%dl, 101(%rbx)	# 4240	[c=4 l=3]  *movqi_internal/8
+	leaq	101(%rbx), %rdx	# 16318	[c=4 l=4]  *leadi
+	orl	$3, %eax	# 16317	[c=4 l=3]  *iorsi_1/0
+	movq	%rdx, 104(%rbx)	# 4244	[c=4 l=4]  *movdi_internal/5
+	movq	%r15, %rdx	# 16736	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 4248	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 4250	[c=13 l=7]  *adddi_1/1
+	movb	%al, 100(%rbx)	# 4242	[c=4 l=3]  *movqi_internal/8
+	movzbl	9(%r15), %eax	# 4251	[c=13 l=5]  *zero_extendqisi2/0
+	movq	(%r15), %r14	# 4254	[c=5 l=3]  *movdi_internal/3
+	addl	%edx, %eax	# 4252	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 17671	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 4253	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 17672	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 17673	[c=4 l=3]  *indirect_jump
+.L782:
+	movl	$59, %eax	# 2484	[c=4 l=5]  *movsi_internal/0
+	movzbl	10(%r15), %r13d	# 2482	[c=13 l=5]  zero_extendqidi2/0
+	movzwl	1034(%rbx), %r14d	# 2483	[c=13 l=8]  *zero_extendhisi2/0
+	subl	5176(%rbx), %eax	# 2485	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %eax	# 2486	[c=13 l=6]  *cmpsi_1/1
+	jb	.L783	# 2487	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%rbx)	# 2489	[c=13 l=7]  *cmpqi_ccno_1/1
+	jne	.L784	# 2490	[c=13 l=6]  *jcc
+.L783:
+	movq	1040(%rbx), %rax	# 2493	[c=9 l=7]  *movdi_internal/3
+	movzbl	59(%rax), %edx	# 2494	[c=13 l=4]  *zero_extendqisi2/0
+.L785:
+	movl	992(%rbx), %eax	# 2507	[c=9 l=6]  *movsi_internal/0
+	sall	$16, %edx	# 2505	[c=4 l=3]  *ashlsi3_1/0
+	movq	1056(%rbx), %rcx	# 2512	[c=9 l=7]  *movdi_internal/3
+	orl	%r14d, %edx	# 2506	[c=4 l=3]  *iorsi_1/0
+	leal	1(%rax,%rax), %eax	# 2509	[c=8 l=4]  *leasi
+	andl	%edx, %eax	# 2510	[c=4 l=2]  *andsi_1/0
+	addl	$1, %edx	# 2516	[c=4 l=3]  *addsi_1/0
+	cltq	# 2511	[c=4 l=2]  *extendsidi2_rex64/0
+	movzbl	(%rcx,%rax), %eax	# 2513	[c=9 l=4]  *movqi_internal/4
+	movb	%al, 1004(%rbx,%r13)	# 2515	[c=4 l=8]  *movqi_internal/8
+	movl	$59, %eax	# 2519	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%rbx), %eax	# 2520	[c=13 l=6]  *subsi_1/1
+	movw	%dx, 1034(%rbx)	# 2517	[c=4 l=7]  *movhi_internal/3
+	sarl	$16, %edx	# 2518	[c=4 l=3]  *ashrsi3_1/0
+	cmpl	5180(%rbx), %eax	# 2521	[c=13 l=6]  *cmpsi_1/1
+	jb	.L786	# 2522	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%rbx)	# 2524	[c=13 l=7]  *cmpqi_ccno_1/1
+	jne	.L787	# 2525	[c=13 l=6]  *jcc
+.L786:
+	movq	1040(%rbx), %rax	# 2528	[c=9 l=7]  *movdi_internal/3
+	movb	%dl, 59(%rax)	# 2529	[c=4 l=3]  *movqi_internal/8
+.L788:
+	movl	(%rbx), %r15d	# 2540	[c=6 l=3]  *zero_extendsidi2/3
+	movq	%r10, %rcx	# 17902	[c=4 l=3]  *movdi_internal/3
+	movq	%r15, %rdx	# 16698	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 2542	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 2544	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%r15), %eax	# 2545	[c=13 l=5]  *zero_extendqisi2/0
+	movq	(%r15), %r14	# 2548	[c=5 l=3]  *movdi_internal/3
+	addl	%edx, %eax	# 2546	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 17903	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 2547	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 17904	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 17905	[c=4 l=3]  *indirect_jump
+.L789:
+	movzbl	10(%r15), %edx	# 2556	[c=13 l=5]  zero_extendqidi2/0
+	movzwl	12(%r15), %eax	# 2555	[c=13 l=5]  zero_extendhidi2/0
+	movzbl	1004(%rbx,%rax), %eax	# 2557	[c=10 l=8]  *movqi_internal/4
+	xorb	1004(%rbx,%rdx), %al	# 2558	[c=14 l=7]  *xorqi_1/1
+	movb	%al, 1004(%rbx,%rdx)	# 2560	[c=4 l=7]  *movqi_internal/8
+	movzbl	100(%rbx), %edx	# 2561	[c=9 l=4]  *movqi_internal/4
+	movl	%edx, %ecx	# 13980	[c=4 l=2]  *movsi_internal/0
+	andl	$225, %ecx	# 2564	[c=4 l=6]  *andsi_2/0
+	jne	.L790	# 2565	[c=13 l=6]  *jcc
+	leaq	flag_update_table_logical(%rip), %rdx	# 2568	[c=1 l=7]  *movdi_internal/4
+	movzbl	%al, %eax	# 2567	[c=4 l=3]  zero_extendqidi2/0
+	addq	%rdx, %rax	# 2569	[c=4 l=3]  *adddi_1/0
+	movl	$30, %edx	# 17	[c=4 l=5]  *movqi_internal/3
+.L791:
+	movl	(%rbx), %r15d	# 2589	[c=6 l=3]  *zero_extendsidi2/3
+	movb	%dl, 100(%rbx)	# 2588	[c=4 l=3]  *movqi_internal/8
+	movq	%r10, %rcx	# 17894	[c=4 l=3]  *movdi_internal/3
+	movq	%rax, 104(%rbx)	# 2587	[c=4 l=4]  *movdi_internal/5
+	movq	%r15, %rdx	# 16699	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 2591	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 2593	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%r15), %eax	# 2594	[c=13 l=5]  *zero_extendqisi2/0
+	movq	(%r15), %r14	# 2597	[c=5 l=3]  *movdi_internal/3
+	addl	%edx, %eax	# 2595	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 17895	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 2596	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 17896	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 17897	[c=4 l=3]  *indirect_jump
+.L928:
+	movzbl	10(%r15), %eax	# 4300	[c=13 l=5]  zero_extendqidi2/0
+	movsbl	1004(%rbx,%rax), %ecx	# 4301	[c=14 l=8]  extendqisi2
+	movzwl	12(%r15), %eax	# 4303	[c=13 l=5]  zero_extendhidi2/0
+	movl	(%rbx), %r15d	# 4326	[c=6 l=3]  *zero_extendsidi2/3
+	movzbl	1004(%rbx,%rax), %eax	# 4304	[c=14 l=8]  *zero_extendqisi2/0
+	imull	%eax, %ecx	# 4305	[c=12 l=3]  *mulsi3_1/2
+	movzbl	100(%rbx), %eax	# 4307	[c=13 l=4]  *zero_extendqisi2/0
+	andl	$-4, %eax	# 4308	[c=4 l=3]  *andsi_1/0
+	movl	%ecx, %esi	# 14106	[c=4 l=2]  *movsi_internal/0
+	movl	%eax, %edx	# 14105	[c=4 l=2]  *movsi_internal/0
+	xorl	%eax, %eax	# 18279	[c=4 l=2]  *movsi_xor
+	andl	$65535, %esi	# 18280	[c=4 l=6]  *andsi_2/0
+	sete	%al	# 18281	[c=4 l=3]  *setcc_qi_slp
+	sarl	$15, %esi	# 4315	[c=4 l=3]  *ashrsi3_1/0
+	addl	%eax, %eax	# 4314	[c=4 l=2]  *ashlsi3_1/0
+	orl	%esi, %eax	# 4316	[c=4 l=2]  *iorsi_1/0
+	movq	104(%rbx), %rsi	# 4317	[c=9 l=4]  *movdi_internal/3
+	movzbl	(%rsi), %edi	# 18282	[c=5 l=3]  *movqi_internal/4
+	movw	%cx, 1004(%rbx)	# 4325	[c=4 l=7]  *movhi_internal/3
+	movq	%r10, %rcx	# 17654	[c=4 l=3]  *movdi_internal/3
+	andl	%edx, %edi	# 19104	[c=4 l=2]  *andsi_1/0
+	movl	%edi, %esi	# 14109	[c=4 l=2]  *movqi_internal/1
+	orl	%esi, %eax	# 16308	[c=4 l=2]  *iorsi_1/0
+	movb	%al, 101(%rbx)	# 4320	[c=4 l=3]  *movqi_internal/8
+	movl	%edx, %eax	# 14110	[c=4 l=2]  *movqi_internal/0
+	leaq	101(%rbx), %rdx	# 16310	[c=4 l=4]  *leadi
+	movq	%rdx, 104(%rbx)	# 4324	[c=4 l=4]  *movdi_internal/5
+	orl	$3, %eax	# 16309	[c=4 l=3]  *iorsi_1/0
+	movq	%r15, %rdx	# 16738	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 4328	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 4330	[c=13 l=7]  *adddi_1/1
+	movb	%al, 100(%rbx)	# 4322	[c=4 l=3]  *movqi_internal/8
+	movzbl	9(%r15), %eax	# 4331	[c=13 l=5]  *zero_extendqisi2/0
+	movq	(%r15), %r14	# 4334	[c=5 l=3]  *movdi_internal/3
+	addl	%edx, %eax	# 4332	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 17655	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 4333	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 17656	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 17657	[c=4 l=3]  *indirect_jump
+.L936:
+	movzbl	10(%r15), %edx	# 4456	[c=13 l=5]  zero_extendqidi2/0
+	movzwl	12(%r15), %eax	# 4455	[c=13 l=5]  *zero_extendhisi2/0
+	movzbl	1004(%rbx,%rdx), %ecx	# 4457	[c=14 l=8]  *zero_extendqisi2/0
+	orl	%ecx, %eax	# 4458	[c=4 l=2]  *iorsi_1/0
+	movb	%al, 1004(%rbx,%rdx)	# 4460	[c=4 l=7]  *movqi_internal/8
+	movzbl	100(%rbx), %edx	# 4461	[c=9 l=4]  *movqi_internal/4
+	movl	%edx, %ecx	# 14120	[c=4 l=2]  *movsi_internal/0
+	andl	$225, %ecx	# 4464	[c=4 l=6]  *andsi_2/0
+	jne	.L937	# 4465	[c=13 l=6]  *jcc
+	leaq	flag_update_table_logical(%rip), %rdx	# 4468	[c=1 l=7]  *movdi_internal/4
+	cltq	# 4467	[c=4 l=2]  *extendsidi2_rex64/0
+	addq	%rdx, %rax	# 4469	[c=4 l=3]  *adddi_1/0
+	movl	$30, %edx	# 25	[c=4 l=5]  *movqi_internal/3
+.L938:
+	movl	(%rbx), %r15d	# 4488	[c=6 l=3]  *zero_extendsidi2/3
+	movb	%dl, 100(%rbx)	# 4487	[c=4 l=3]  *movqi_internal/8
+	movq	%r10, %rcx	# 17622	[c=4 l=3]  *movdi_internal/3
+	movq	%rax, 104(%rbx)	# 4486	[c=4 l=4]  *movdi_internal/5
+	movq	%r15, %rdx	# 16743	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 4490	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 4492	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%r15), %eax	# 4493	[c=13 l=5]  *zero_extendqisi2/0
+	movq	(%r15), %r14	# 4496	[c=5 l=3]  *movdi_internal/3
+	addl	%edx, %eax	# 4494	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 17623	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 4495	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 17624	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 17625	[c=4 l=3]  *indirect_jump
+.L674:
+	movzbl	10(%r15), %edx	# 986	[c=13 l=5]  zero_extendqidi2/0
+	movsbl	1004(%rbx,%rdx), %eax	# 987	[c=14 l=8]  extendqisi2
+	andl	$511, %eax	# 988	[c=4 l=5]  *andsi_1/0
+	movl	%eax, %ecx	# 13868	[c=4 l=2]  *movsi_internal/0
+	sarl	%ecx	# 990	[c=4 l=2]  *ashrsi3_1/0
+	movb	%cl, 1004(%rbx,%rdx)	# 991	[c=4 l=7]  *movqi_internal/8
+	movzbl	100(%rbx), %edx	# 992	[c=9 l=4]  *movqi_internal/4
+	movl	%edx, %ecx	# 13870	[c=4 l=2]  *movsi_internal/0
+	andl	$224, %ecx	# 995	[c=4 l=6]  *andsi_2/0
+	jne	.L675	# 996	[c=13 l=6]  *jcc
+	leaq	flag_update_table_ror8(%rip), %rdx	# 999	[c=1 l=7]  *movdi_internal/4
+	cltq	# 998	[c=4 l=2]  *extendsidi2_rex64/0
+	addq	%rdx, %rax	# 1000	[c=4 l=3]  *adddi_1/0
+	movl	$31, %edx	# 10	[c=4 l=5]  *movqi_internal/3
+.L676:
+	movl	(%rbx), %r15d	# 1019	[c=6 l=3]  *zero_extendsidi2/3
+	movb	%dl, 100(%rbx)	# 1018	[c=4 l=3]  *movqi_internal/8
+	movq	%r10, %rcx	# 18070	[c=4 l=3]  *movdi_internal/3
+	movq	%rax, 104(%rbx)	# 1017	[c=4 l=4]  *movdi_internal/5
+	movq	%r15, %rdx	# 16670	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 1021	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 1023	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%r15), %eax	# 1024	[c=13 l=5]  *zero_extendqisi2/0
+	movq	(%r15), %r14	# 1027	[c=5 l=3]  *movdi_internal/3
+	addl	%edx, %eax	# 1025	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 18071	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 1026	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 18072	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 18073	[c=4 l=3]  *indirect_jump
+.L1032:
+	movzbl	10(%r15), %r13d	# 5668	[c=13 l=5]  *zero_extendqisi2/0
+	movzwl	12(%r15), %edx	# 5667	[c=13 l=5]  *zero_extendhisi2/0
+	movl	%r13d, %eax	# 14212	[c=4 l=3]  *movsi_internal/0
+	movl	%r13d, %r14d	# 16761	[c=4 l=3]  *movsi_internal/0
+	subl	5176(%rbx), %eax	# 5671	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %eax	# 5672	[c=13 l=6]  *cmpsi_1/1
+	jb	.L1033	# 5673	[c=13 l=2]  *jcc
+	movl	%r13d, %eax	# 14214	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %eax	# 5675	[c=4 l=3]  *ashrsi3_1/0
+	cltq	# 5676	[c=4 l=2]  *extendsidi2_rex64/0
+	cmpb	$0, 1080(%rbx,%rax)	# 5677	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L1034	# 5678	[c=13 l=6]  *jcc
+.L1033:
+	movq	1040(%rbx), %rcx	# 5682	[c=9 l=7]  *movdi_internal/3
+	movzbl	%r14b, %eax	# 5681	[c=4 l=4]  zero_extendqidi2/0
+	movzbl	(%rcx,%rax), %eax	# 5683	[c=13 l=4]  *zero_extendqisi2/0
+.L1035:
+	cmpl	6564(%rbx), %r13d	# 5694	[c=13 l=7]  *cmpsi_1/1
+	jnb	.L1036	# 5695	[c=13 l=2]  *jcc
+	movslq	%r13d, %rcx	# 5697	[c=4 l=3]  *extendsidi2_rex64/1
+	cmpb	$0, 6568(%rbx,%rcx)	# 5700	[c=14 l=8]  *cmpqi_ccno_1/1
+	jns	.L1036	# 5701	[c=13 l=2]  *jcc
+.L1037:
+	movl	%r13d, %eax	# 14216	[c=4 l=3]  *movsi_internal/0
+	subl	5176(%rbx), %eax	# 5707	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %eax	# 5708	[c=13 l=6]  *cmpsi_1/1
+	jb	.L1038	# 5709	[c=13 l=2]  *jcc
+	movl	%r13d, %eax	# 14218	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %eax	# 5711	[c=4 l=3]  *ashrsi3_1/0
+	cltq	# 5712	[c=4 l=2]  *extendsidi2_rex64/0
+	cmpb	$0, 1080(%rbx,%rax)	# 5713	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L1039	# 5714	[c=13 l=6]  *jcc
+.L1038:
+	movq	1040(%rbx), %rcx	# 5718	[c=9 l=7]  *movdi_internal/3
+	movzbl	%r14b, %eax	# 5717	[c=4 l=4]  zero_extendqidi2/0
+	movb	%dl, (%rcx,%rax)	# 5719	[c=4 l=3]  *movqi_internal/8
+.L1040:
+	movl	(%rbx), %r15d	# 5730	[c=6 l=3]  *zero_extendsidi2/3
+	movq	%r10, %rcx	# 17534	[c=4 l=3]  *movdi_internal/3
+	movq	%r15, %rdx	# 16762	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 5732	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 5734	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%r15), %eax	# 5735	[c=13 l=5]  *zero_extendqisi2/0
+	movq	(%r15), %r14	# 5738	[c=5 l=3]  *movdi_internal/3
+	addl	%edx, %eax	# 5736	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 17535	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 5737	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 17536	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 17537	[c=4 l=3]  *indirect_jump
+.L1036:
+	orl	%eax, %edx	# 5704	[c=4 l=2]  *iorsi_1/0
+	jmp	.L1037	# 18558	[c=1 l=2]  jump
+.L688:
+	movzbl	10(%r15), %eax	# 1251	[c=13 l=5]  *zero_extendqisi2/0
+	movzbl	100(%rbx), %ecx	# 1254	[c=13 l=4]  *zero_extendqisi2/0
+	movl	(%rbx), %r15d	# 1266	[c=6 l=3]  *zero_extendsidi2/3
+	movl	%eax, %edx	# 16680	[c=4 l=2]  *movsi_internal/0
+	notl	%eax	# 1253	[c=4 l=2]  *one_cmplsi2_1/0
+	andl	%ecx, %eax	# 1255	[c=4 l=2]  *andsi_1/0
+	movq	104(%rbx), %rcx	# 1258	[c=9 l=4]  *movdi_internal/3
+	movzbl	(%rcx), %edi	# 18356	[c=5 l=3]  *movqi_internal/4
+	andl	%eax, %edi	# 19103	[c=4 l=2]  *andsi_1/0
+	movl	%edi, %ecx	# 13879	[c=4 l=2]  *movqi_internal/1
+	orl	%edx, %ecx	# 16380	[c=4 l=2]  *iorsi_1/0
+	orl	%eax, %edx	# 16381	[c=4 l=2]  *iorsi_1/0
+	movb	%dl, 100(%rbx)	# 1263	[c=4 l=3]  *movqi_internal/8
+	leaq	101(%rbx), %rdx	# 16382	[c=4 l=4]  *leadi
+	movq	%rdx, 104(%rbx)	# 1265	[c=4 l=4]  *movdi_internal/5
+	movq	%r15, %rdx	# 16681	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 1268	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 1270	[c=13 l=7]  *adddi_1/1
+	movb	%cl, 101(%rbx)	# 1261	[c=4 l=3]  *movqi_internal/8
+	movzbl	9(%r15), %eax	# 1271	[c=13 l=5]  *zero_extendqisi2/0
+	movq	%r10, %rcx	# 18022	[c=4 l=3]  *movdi_internal/3
+	movq	(%r15), %r14	# 1274	[c=5 l=3]  *movdi_internal/3
+	addl	%edx, %eax	# 1272	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 18023	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 1273	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 18024	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 18025	[c=4 l=3]  *indirect_jump
+.L689:
+	movzbl	10(%r15), %edx	# 1283	[c=13 l=5]  zero_extendqidi2/0
+	movzbl	100(%rbx), %eax	# 1279	[c=13 l=4]  *zero_extendqisi2/0
+	movzbl	1004(%rbx,%rdx), %ecx	# 1284	[c=14 l=8]  *zero_extendqisi2/0
+	movzwl	12(%r15), %edx	# 1285	[c=13 l=5]  *zero_extendhisi2/0
+	andl	$-65, %eax	# 1280	[c=4 l=3]  *andsi_1/0
+	movl	(%rbx), %r15d	# 1299	[c=6 l=3]  *zero_extendsidi2/3
+	testl	%edx, %ecx	# 1287	[c=4 l=2]  *testsi_1/0
+	movq	104(%rbx), %rdx	# 1291	[c=9 l=4]  *movdi_internal/3
+	setne	%cl	# 16375	[c=4 l=3]  *setcc_qi
+	movzbl	(%rdx), %edi	# 18354	[c=5 l=3]  *movqi_internal/4
+	movzbl	%cl, %ecx	# 16376	[c=4 l=3]  *zero_extendqisi2/0
+	sall	$6, %ecx	# 1290	[c=4 l=3]  *ashlsi3_1/0
+	andl	%eax, %edi	# 19102	[c=4 l=2]  *andsi_1/0
+	orl	$64, %eax	# 16378	[c=4 l=3]  *iorsi_1/0
+	movl	%edi, %edx	# 13881	[c=4 l=2]  *movqi_internal/1
+	movb	%al, 100(%rbx)	# 1296	[c=4 l=3]  *movqi_internal/8
+	orl	%ecx, %edx	# 16377	[c=4 l=2]  *iorsi_1/0
+	movq	%r10, %rcx	# 18014	[c=4 l=3]  *movdi_internal/3
+	movb	%dl, 101(%rbx)	# 1294	[c=4 l=3]  *movqi_internal/8
+	leaq	101(%rbx), %rdx	# 16379	[c=4 l=4]  *leadi
+	movq	%rdx, 104(%rbx)	# 1298	[c=4 l=4]  *movdi_internal/5
+	movq	%r15, %rdx	# 16682	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 1301	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 1303	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%r15), %eax	# 1304	[c=13 l=5]  *zero_extendqisi2/0
+	movq	(%r15), %r14	# 1307	[c=5 l=3]  *movdi_internal/3
+	addl	%edx, %eax	# 1305	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 18015	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 1306	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 18016	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 18017	[c=4 l=3]  *indirect_jump
+.L679:
+	movq	(%rsp), %rax	# 13874	[c=5 l=4]  *movdi_internal/3
+	subq	$1, %rax	# 1097	[c=4 l=4]  *adddi_1/0
+	cmpq	%rbp, %rax	# 1098	[c=4 l=3]  *cmpdi_1/0
+	jb	.L680	# 1099	[c=13 l=6]  *jcc
+	movq	56(%rbx), %rax	# 13875	[c=9 l=4]  *movdi_internal/3
+	cmpq	%rax, 48(%rbx)	# 1102	[c=13 l=4]  *cmpdi_1/0
+	jnb	.L1817	# 1103	[c=13 l=6]  *jcc
+.L681:
+	movl	(%rbx), %r15d	# 1110	[c=6 l=3]  *zero_extendsidi2/3
+	movl	$1, 96(%rbx)	# 1115	[c=4 l=7]  *movsi_internal/1
+	movq	%r10, %rcx	# 18046	[c=4 l=3]  *movdi_internal/3
+	movq	%r15, %rdx	# 16675	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 1112	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 1114	[c=13 l=7]  *adddi_1/1
+	movzbl	11(%r15), %eax	# 1116	[c=13 l=5]  zero_extendqidi2/0
+	movq	(%r15), %r14	# 1124	[c=5 l=3]  *movdi_internal/3
+	addq	%rax, %rbp	# 1117	[c=4 l=3]  *adddi_1/0
+	movzwl	14(%r15), %eax	# 1119	[c=13 l=5]  zero_extendhidi2/0
+	addq	%rax, 48(%rbx)	# 1120	[c=13 l=4]  *adddi_1/0
+	movq	%rbp, 40(%rbx)	# 1118	[c=4 l=4]  *movdi_internal/5
+	movzbl	9(%r15), %eax	# 1121	[c=13 l=5]  *zero_extendqisi2/0
+	addl	%edx, %eax	# 1122	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 18047	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 1123	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 18048	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 18049	[c=4 l=3]  *indirect_jump
+.L1027:
+	movzbl	100(%rbx), %edx	# 5482	[c=13 l=4]  *zero_extendqisi2/0
+	movq	1040(%rbx), %rax	# 5485	[c=9 l=7]  *movdi_internal/3
+	movq	104(%rbx), %rsi	# 5484	[c=9 l=4]  *movdi_internal/3
+	movzbl	63(%rax), %eax	# 5486	[c=13 l=4]  *zero_extendqisi2/0
+	movl	%edx, %edi	# 14183	[c=4 l=2]  *movsi_internal/0
+	movl	%edx, %ecx	# 16752	[c=4 l=2]  *movsi_internal/0
+	notl	%edi	# 5487	[c=4 l=2]  *one_cmplsi2_1/0
+	andl	%edi, %eax	# 5488	[c=4 l=2]  *andsi_1/0
+	movzbl	(%rsi), %edi	# 18263	[c=5 l=3]  *movqi_internal/4
+	andl	%edx, %edi	# 19101	[c=4 l=2]  *andsi_1/0
+	movzbl	%dil, %edi	# 5490	[c=4 l=4]  *zero_extendqisi2/0
+	orl	%edi, %eax	# 5491	[c=4 l=2]  *iorsi_1/0
+	movzbl	10(%r15), %edi	# 5494	[c=13 l=5]  zero_extendqidi2/0
+	sall	$8, %eax	# 5492	[c=4 l=3]  *ashlsi3_1/0
+	movzbl	1004(%rbx,%rdi), %r8d	# 5495	[c=14 l=9]  *zero_extendqisi2/0
+	andl	$256, %eax	# 5493	[c=4 l=5]  *andsi_1/0
+	orl	%r8d, %eax	# 5496	[c=4 l=3]  *iorsi_1/0
+	movl	%eax, %r8d	# 14187	[c=4 l=3]  *movsi_internal/0
+	sarl	%r8d	# 5498	[c=4 l=3]  *ashrsi3_1/0
+	movb	%r8b, 1004(%rbx,%rdi)	# 5499	[c=4 l=8]  *movqi_internal/8
+	andl	$-32, %edx	# 5501	[c=4 l=3]  *andsi_2/0
+	jne	.L1028	# 5502	[c=13 l=6]  *jcc
+	cltq	# 5504	[c=4 l=2]  *extendsidi2_rex64/0
+	leaq	flag_update_table_ror8(%rip), %rdx	# 5505	[c=1 l=7]  *movdi_internal/4
+	movl	$31, %ecx	# 29	[c=4 l=5]  *movqi_internal/3
+	addq	%rdx, %rax	# 5506	[c=4 l=3]  *adddi_1/0
+.L1029:
+	movl	(%rbx), %r15d	# 5524	[c=6 l=3]  *zero_extendsidi2/3
+	movb	%cl, 100(%rbx)	# 5523	[c=4 l=3]  *movqi_internal/8
+	movq	%r10, %rcx	# 17558	[c=4 l=3]  *movdi_internal/3
+	movq	%rax, 104(%rbx)	# 5522	[c=4 l=4]  *movdi_internal/5
+	movq	%r15, %rdx	# 16753	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 5526	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 5528	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%r15), %eax	# 5529	[c=13 l=5]  *zero_extendqisi2/0
+	movq	(%r15), %r14	# 5532	[c=5 l=3]  *movdi_internal/3
+	addl	%edx, %eax	# 5530	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 17559	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 5531	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 17560	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 17561	[c=4 l=3]  *indirect_jump
+.L1041:
+	movl	$2, 96(%rbx)	# 5743	[c=4 l=7]  *movsi_internal/1
+	movzbl	10(%r15), %esi	# 5745	[c=13 l=5]  zero_extendqidi2/0
+	movzwl	12(%r15), %r13d	# 5744	[c=13 l=5]  *zero_extendhisi2/0
+	movl	%esi, %edx	# 14220	[c=4 l=2]  *movsi_internal/0
+	movq	%rsi, %rax	# 16763	[c=4 l=3]  *movdi_internal/3
+	subl	5176(%rbx), %edx	# 5747	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %edx	# 5748	[c=13 l=6]  *cmpsi_1/1
+	jb	.L1042	# 5749	[c=13 l=2]  *jcc
+	movl	%esi, %edx	# 14222	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %edx	# 5752	[c=4 l=3]  *ashrsi3_1/0
+	movslq	%edx, %rdx	# 5753	[c=4 l=3]  *extendsidi2_rex64/1
+	cmpb	$0, 1080(%rbx,%rdx)	# 5754	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L1043	# 5755	[c=13 l=6]  *jcc
+.L1042:
+	movq	1040(%rbx), %rdx	# 5759	[c=9 l=7]  *movdi_internal/3
+	movzbl	(%rdx,%rax), %eax	# 5760	[c=13 l=4]  *zero_extendqisi2/0
+.L1044:
+	testl	%eax, %r13d	# 5772	[c=4 l=3]  *testsi_1/0
+	jne	.L1045	# 5773	[c=13 l=2]  *jcc
+	movl	(%rbx), %eax	# 14224	[c=5 l=2]  *movsi_internal/0
+	addq	$1, 48(%rbx)	# 5781	[c=13 l=5]  *adddi_1/0
+	addl	$1, %eax	# 5776	[c=4 l=3]  *addsi_1/0
+	andl	992(%rbx), %eax	# 5779	[c=13 l=6]  *andsi_1/1
+	movl	%eax, (%rbx)	# 5780	[c=4 l=2]  *movsi_internal/1
+.L1045:
+	movq	(%rsp), %rax	# 14225	[c=5 l=4]  *movdi_internal/3
+	subq	$1, %rax	# 5784	[c=4 l=4]  *adddi_1/0
+	cmpq	%rbp, %rax	# 5785	[c=4 l=3]  *cmpdi_1/0
+	jb	.L680	# 5786	[c=13 l=6]  *jcc
+	movq	56(%rbx), %rax	# 14226	[c=9 l=4]  *movdi_internal/3
+	cmpq	%rax, 48(%rbx)	# 5789	[c=13 l=4]  *cmpdi_1/0
+	jnb	.L1818	# 5790	[c=13 l=6]  *jcc
+.L1046:
+	movl	(%rbx), %r15d	# 5797	[c=6 l=3]  *zero_extendsidi2/3
+	movl	$1, 96(%rbx)	# 5802	[c=4 l=7]  *movsi_internal/1
+	movq	%r10, %rcx	# 17526	[c=4 l=3]  *movdi_internal/3
+	movq	%r15, %rdx	# 16764	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 5799	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 5801	[c=13 l=7]  *adddi_1/1
+	movzbl	11(%r15), %eax	# 5803	[c=13 l=5]  zero_extendqidi2/0
+	movq	(%r15), %r14	# 5811	[c=5 l=3]  *movdi_internal/3
+	addq	%rax, %rbp	# 5804	[c=4 l=3]  *adddi_1/0
+	movzwl	14(%r15), %eax	# 5806	[c=13 l=5]  zero_extendhidi2/0
+	addq	%rax, 48(%rbx)	# 5807	[c=13 l=4]  *adddi_1/0
+	movq	%rbp, 40(%rbx)	# 5805	[c=4 l=4]  *movdi_internal/5
+	movzbl	9(%r15), %eax	# 5808	[c=13 l=5]  *zero_extendqisi2/0
+	addl	%edx, %eax	# 5809	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 17527	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 5810	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 17528	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 17529	[c=4 l=3]  *indirect_jump
+.L1170:
+	movzbl	10(%r15), %eax	# 7333	[c=13 l=5]  zero_extendqidi2/0
+	leaq	flag_update_table_logical(%rip), %rsi	# 33	[c=1 l=7]  *movdi_internal/4
+	movl	$30, %ecx	# 34	[c=4 l=5]  *movqi_internal/3
+	movb	$0, 1004(%rbx,%rax)	# 7334	[c=4 l=8]  *movqi_internal/8
+	movzbl	100(%rbx), %eax	# 7335	[c=9 l=4]  *movqi_internal/4
+	movl	%eax, %edx	# 14333	[c=4 l=2]  *movsi_internal/0
+	andl	$225, %edx	# 7338	[c=4 l=6]  *andsi_2/0
+	je	.L1171	# 7339	[c=13 l=2]  *jcc
+	movq	104(%rbx), %rcx	# 7341	[c=9 l=4]  *movdi_internal/3
+	orl	$30, %eax	# 16262	[c=4 l=3]  *iorsi_1/0
+	leaq	101(%rbx), %rsi	# 16263	[c=4 l=4]  *leadi
+	andb	(%rcx), %dl	# 7342	[c=9 l=2]  *andqi_1/1
+	movl	%eax, %ecx	# 14336	[c=4 l=2]  *movqi_internal/0
+	orl	$2, %edx	# 16261	[c=4 l=3]  *iorsi_1/0
+	movb	%dl, 101(%rbx)	# 7344	[c=4 l=3]  *movqi_internal/8
+.L1171:
+	movl	(%rbx), %r15d	# 7351	[c=6 l=3]  *zero_extendsidi2/3
+	movb	%cl, 100(%rbx)	# 7350	[c=4 l=3]  *movqi_internal/8
+	movq	%r10, %rcx	# 17326	[c=4 l=3]  *movdi_internal/3
+	movq	%rsi, 104(%rbx)	# 7349	[c=4 l=4]  *movdi_internal/5
+	movq	%r15, %rdx	# 16801	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 7353	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 7355	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%r15), %eax	# 7356	[c=13 l=5]  *zero_extendqisi2/0
+	movq	(%r15), %r14	# 7359	[c=5 l=3]  *movdi_internal/3
+	addl	%edx, %eax	# 7357	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 17327	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 7358	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 17328	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 17329	[c=4 l=3]  *indirect_jump
+.L1236:
+	movzbl	10(%r15), %eax	# 8352	[c=13 l=5]  zero_extendqidi2/0
+	movq	104(%rbx), %rcx	# 8359	[c=9 l=4]  *movdi_internal/3
+	movzbl	100(%rbx), %esi	# 8357	[c=13 l=4]  *zero_extendqisi2/0
+	movzbl	1004(%rbx,%rax), %edx	# 8353	[c=14 l=8]  *zero_extendqisi2/0
+	movzbl	(%rcx), %edi	# 8360	[c=5 l=3]  *movqi_internal/4
+	movzwl	12(%r15), %eax	# 8355	[c=13 l=5]  zero_extendhidi2/0
+	movq	1040(%rbx), %rcx	# 8361	[c=9 l=7]  *movdi_internal/3
+	movl	%esi, %r8d	# 14473	[c=4 l=3]  *movsi_internal/0
+	notl	%r8d	# 8363	[c=4 l=3]  *one_cmplsi2_1/0
+	movzbl	1004(%rbx,%rax), %r9d	# 8356	[c=14 l=9]  *zero_extendqisi2/0
+	movzbl	63(%rcx), %ecx	# 8362	[c=13 l=4]  *zero_extendqisi2/0
+	movl	%esi, %eax	# 16825	[c=4 l=2]  *movsi_internal/0
+	andl	$-64, %esi	# 8374	[c=4 l=3]  *andsi_1/0
+	andl	%edi, %eax	# 16226	[c=4 l=2]  *andsi_1/0
+	andl	%esi, %edi	# 16227	[c=4 l=2]  *andsi_1/0
+	orl	$63, %esi	# 16229	[c=4 l=3]  *iorsi_1/0
+	andl	%r8d, %ecx	# 8364	[c=4 l=3]  *andsi_1/0
+	movzbl	%al, %eax	# 8366	[c=4 l=3]  *zero_extendqisi2/0
+	movl	%edx, %r8d	# 14475	[c=4 l=3]  *movsi_internal/0
+	subl	%r9d, %edx	# 8379	[c=4 l=3]  *subsi_1/0
+	orl	%eax, %ecx	# 8367	[c=4 l=2]  *iorsi_1/0
+	movl	%r9d, %eax	# 14477	[c=4 l=3]  *movsi_internal/0
+	andl	$136, %r8d	# 8369	[c=4 l=7]  *andsi_1/0
+	movb	%sil, 100(%rbx)	# 8394	[c=4 l=4]  *movqi_internal/8
+	andl	$136, %eax	# 8372	[c=4 l=5]  *andsi_1/0
+	movl	%ecx, %r9d	# 14479	[c=4 l=3]  *movsi_internal/0
+	orl	$-3, %ecx	# 8388	[c=4 l=3]  *iorsi_1/0
+	leal	(%rax,%r8,2), %r8d	# 8373	[c=8 l=4]  *leasi
+	andl	$1, %r9d	# 8380	[c=4 l=4]  *andsi_1/0
+	leaq	flag_update_table_sub8(%rip), %rax	# 8376	[c=1 l=7]  *movdi_internal/4
+	imull	$260, %r8d, %r8d	# 8383	[c=12 l=7]  *mulsi3_1/1
+	subl	%r9d, %edx	# 8381	[c=4 l=3]  *subsi_1/0
+	andl	$511, %edx	# 8382	[c=4 l=6]  *andsi_1/0
+	andl	$7680, %r8d	# 8384	[c=4 l=7]  *andsi_1/0
+	orl	%r8d, %edx	# 8385	[c=5 l=3]  *iorsi_1_zext
+	andb	(%rax,%rdx), %cl	# 8389	[c=13 l=3]  *andqi_1/1
+	orl	%ecx, %edi	# 16228	[c=4 l=2]  *iorsi_1/0
+	movb	%dil, 101(%rbx)	# 8392	[c=4 l=4]  *movqi_internal/8
+	jmp	.L1568	# 18562	[c=1 l=5]  jump
+.L1237:
+	movzbl	10(%r15), %eax	# 8410	[c=13 l=5]  zero_extendqidi2/0
+	movzwl	12(%r15), %esi	# 8408	[c=9 l=5]  *movhi_internal/2
+	movzbl	1004(%rbx,%rax), %eax	# 8411	[c=10 l=8]  *movqi_internal/4
+.L1601:
+	movl	%eax, %ecx	# 14481	[c=4 l=2]  *movsi_internal/0
+	movl	%esi, %edx	# 14483	[c=4 l=2]  *movsi_internal/0
+	andl	$136, %edx	# 8416	[c=4 l=6]  *andsi_1/0
+	andl	$136, %ecx	# 8413	[c=4 l=6]  *andsi_1/0
+	leal	(%rdx,%rcx,2), %ecx	# 8417	[c=8 l=3]  *leasi
+	movzbl	%al, %edx	# 8418	[c=4 l=3]  *zero_extendqisi2/0
+	imull	$260, %ecx, %eax	# 8422	[c=12 l=6]  *mulsi3_1/1
+	subl	%esi, %edx	# 8420	[c=4 l=2]  *subsi_1/0
+	andl	$511, %edx	# 8421	[c=4 l=6]  *andsi_1/0
+	andl	$7680, %eax	# 8423	[c=4 l=5]  *andsi_1/0
+	jmp	.L1598	# 18564	[c=1 l=5]  jump
+.L1240:
+	movzbl	10(%r15), %eax	# 8465	[c=13 l=5]  zero_extendqidi2/0
+	movzwl	12(%r15), %esi	# 8463	[c=9 l=5]  *movhi_internal/2
+	movzbl	1004(%rbx,%rax), %eax	# 8466	[c=10 l=8]  *movqi_internal/4
+.L1596:
+	movl	%eax, %ecx	# 14491	[c=4 l=2]  *movsi_internal/0
+	movl	%esi, %edx	# 14493	[c=4 l=2]  *movsi_internal/0
+	andl	$136, %edx	# 8471	[c=4 l=6]  *andsi_1/0
+	andl	$136, %ecx	# 8468	[c=4 l=6]  *andsi_1/0
+	leal	(%rdx,%rcx,2), %ecx	# 8472	[c=8 l=3]  *leasi
+	movzbl	%al, %edx	# 8473	[c=4 l=3]  *zero_extendqisi2/0
+	imull	$260, %ecx, %eax	# 8477	[c=12 l=6]  *mulsi3_1/1
+	subl	%esi, %edx	# 8475	[c=4 l=2]  *subsi_1/0
+	movzbl	100(%rbx), %ecx	# 8480	[c=9 l=4]  *movqi_internal/4
+	andl	$511, %edx	# 8476	[c=4 l=6]  *andsi_1/0
+	andl	$7680, %eax	# 8478	[c=4 l=5]  *andsi_1/0
+	orl	%eax, %edx	# 8479	[c=5 l=2]  *iorsi_1_zext
+	movl	%ecx, %eax	# 14495	[c=4 l=2]  *movsi_internal/0
+	andl	$192, %eax	# 8483	[c=4 l=5]  *andsi_2/0
+	jne	.L1241	# 8484	[c=13 l=6]  *jcc
+	leaq	flag_update_table_sub8(%rip), %rax	# 8487	[c=1 l=7]  *movdi_internal/4
+	movl	$63, %ecx	# 48	[c=4 l=5]  *movqi_internal/3
+	addq	%rdx, %rax	# 8488	[c=4 l=3]  *adddi_1/0
+.L1242:
+	movq	%rax, 104(%rbx)	# 8505	[c=4 l=4]  *movdi_internal/5
+	movb	%cl, 100(%rbx)	# 8506	[c=4 l=3]  *movqi_internal/8
+	jmp	.L1567	# 18566	[c=1 l=5]  jump
+.L1243:
+	movzbl	100(%rbx), %edx	# 8521	[c=9 l=4]  *movqi_internal/4
+	movzbl	10(%r15), %eax	# 8519	[c=13 l=5]  zero_extendqidi2/0
+	movl	%edx, %ecx	# 14501	[c=4 l=2]  *movsi_internal/0
+	movzbl	1004(%rbx,%rax), %eax	# 8520	[c=14 l=8]  zero_extendqidi2/0
+	andl	$225, %ecx	# 8524	[c=4 l=6]  *andsi_2/0
+	jne	.L1244	# 8525	[c=13 l=6]  *jcc
+	leaq	flag_update_table_logical(%rip), %rdx	# 8528	[c=1 l=7]  *movdi_internal/4
+	addq	%rdx, %rax	# 8529	[c=4 l=3]  *adddi_1/0
+	movl	$30, %edx	# 49	[c=4 l=5]  *movqi_internal/3
+	jmp	.L1276	# 18568	[c=1 l=5]  jump
+.L1232:
+	movzbl	10(%r15), %eax	# 8238	[c=13 l=5]  zero_extendqidi2/0
+	movzwl	12(%r15), %edx	# 8241	[c=13 l=5]  zero_extendhidi2/0
+	movzbl	1004(%rbx,%rax), %eax	# 8239	[c=10 l=8]  *movqi_internal/4
+	movzbl	1004(%rbx,%rdx), %esi	# 8242	[c=14 l=8]  *zero_extendqisi2/0
+	jmp	.L1596	# 18570	[c=1 l=5]  jump
+.L618:
+	movl	(%rbx), %eax	# 7969	[c=6 l=2]  *zero_extendsidi2/3
+	leaq	opcodes(%rip), %rsi	# 13699	[c=1 l=7]  *movdi_internal/4
+	leaq	handler.2(%rip), %r14	# 7989	[c=1 l=7]  *movdi_internal/4
+	salq	$4, %rax	# 7970	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %rax	# 7972	[c=13 l=7]  *adddi_1/1
+	movzbl	11(%rax), %edx	# 7974	[c=13 l=4]  zero_extendqidi2/0
+	movzwl	14(%rax), %eax	# 7985	[c=13 l=4]  *zero_extendhisi2/0
+	leaq	1(%rbp,%rdx), %rbp	# 7976	[c=5 l=5]  *leadi
+	movq	%rbp, 40(%rbx)	# 7977	[c=4 l=4]  *movdi_internal/5
+	movzbl	8(%r15), %ecx	# 7980	[c=13 l=5]  zero_extendqidi2/0
+	movq	%rcx, %rdx	# 14411	[c=4 l=3]  *movdi_internal/3
+	movq	(%r14,%rcx,8), %r14	# 7991	[c=10 l=4]  *movdi_internal/3
+	movq	%r10, %rcx	# 17262	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 7981	[c=4 l=4]  *ashldi3_1/0
+	movswl	10(%rsi,%rdx), %edx	# 7984	[c=14 l=5]  extendhisi2/1
+	addl	%edx, %eax	# 7986	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 17263	[c=4 l=3]  *movdi_internal/3
+	cltq	# 7987	[c=4 l=2]  *extendsidi2_rex64/0
+	addq	%rax, 48(%rbx)	# 7988	[c=13 l=4]  *adddi_1/0
+	movq	%r11, %rax	# 17264	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 17265	[c=4 l=3]  *indirect_jump
+.L1168:
+	movzbl	10(%r15), %eax	# 7298	[c=13 l=5]  zero_extendqidi2/0
+	movq	%r10, %rcx	# 17342	[c=4 l=3]  *movdi_internal/3
+	rolb	$4, 1004(%rbx,%rax)	# 7305	[c=14 l=8]  *rotlqi3_1
+	movl	(%rbx), %r15d	# 7306	[c=6 l=3]  *zero_extendsidi2/3
+	movq	%r15, %rdx	# 16799	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 7308	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 7310	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%r15), %eax	# 7311	[c=13 l=5]  *zero_extendqisi2/0
+	movq	(%r15), %r14	# 7314	[c=5 l=3]  *movdi_internal/3
+	addl	%edx, %eax	# 7312	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 17343	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 7313	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 17344	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 17345	[c=4 l=3]  *indirect_jump
+.L1169:
+	movl	(%rbx), %r15d	# 7319	[c=6 l=3]  *zero_extendsidi2/3
+	movq	%r10, %rcx	# 17334	[c=4 l=3]  *movdi_internal/3
+	movq	%r15, %rdx	# 16800	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 7321	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 7323	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%r15), %eax	# 7324	[c=13 l=5]  *zero_extendqisi2/0
+	movq	(%r15), %r14	# 7327	[c=5 l=3]  *movdi_internal/3
+	addl	%edx, %eax	# 7325	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 17335	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 7326	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 17336	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 17337	[c=4 l=3]  *indirect_jump
+.L1201:
+	movzbl	10(%r15), %r14d	# 7743	[c=13 l=5]  zero_extendqidi2/0
+	cmpb	$0, 844(%rbx)	# 7746	[c=13 l=7]  *cmpqi_ccno_1/1
+	movzwl	1034(%rbx), %r13d	# 7745	[c=13 l=8]  *zero_extendhisi2/0
+	movzbl	1004(%rbx,%r14), %edx	# 7744	[c=14 l=9]  *zero_extendqisi2/0
+	jne	.L1819	# 7747	[c=13 l=6]  *jcc
+.L1202:
+	notl	%edx	# 7759	[c=4 l=2]  *one_cmplsi2_1/0
+	movl	%r13d, %eax	# 14381	[c=4 l=3]  *movsi_internal/0
+	subl	5176(%rbx), %eax	# 7760	[c=13 l=6]  *subsi_1/1
+	movl	%edx, %r15d	# 14380	[c=4 l=3]  *movsi_internal/0
+	cmpl	5180(%rbx), %eax	# 7761	[c=13 l=6]  *cmpsi_1/1
+	jb	.L1204	# 7762	[c=13 l=2]  *jcc
+	movl	%r13d, %eax	# 14383	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %eax	# 7764	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 13647	[c=5 l=5]  *andsi_1_zext
+	cmpb	$0, 1080(%rbx,%rax)	# 7767	[c=14 l=8]  *cmpqi_ccno_1/1
+	je	.L1204	# 7768	[c=13 l=2]  *jcc
+	movl	%r13d, %esi	# 7780	[c=4 l=3]  *movsi_internal/0
+	movq	%rbx, %rdi	# 7781	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 7782	[c=10 l=5]  *call_value
+	leaq	flag_update_table_add8(%rip), %r10	# 15643	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_sub8(%rip), %r11	# 15645	[c=1 l=7]  *movdi_internal/4
+	movl	%eax, %ecx	# 7783	[c=4 l=2]  *movsi_internal/0
+	andl	%r15d, %ecx	# 7785	[c=4 l=3]  *andsi_1/0
+	movl	%ecx, %edx	# 14388	[c=4 l=2]  *movsi_internal/0
+	jmp	.L1206	# 18573	[c=1 l=2]  jump
+.L1204:
+	movq	1040(%rbx), %rcx	# 7772	[c=9 l=7]  *movdi_internal/3
+	movslq	%r13d, %rax	# 7771	[c=4 l=3]  *extendsidi2_rex64/1
+	movzbl	(%rcx,%rax), %ecx	# 7773	[c=13 l=4]  *zero_extendqisi2/0
+	movl	%ecx, %eax	# 16811	[c=4 l=2]  *movsi_internal/0
+	andl	%r15d, %ecx	# 7775	[c=4 l=3]  *andsi_1/0
+	movl	%ecx, %edx	# 14386	[c=4 l=2]  *movsi_internal/0
+.L1206:
+	movb	%al, 1004(%rbx,%r14)	# 7808	[c=4 l=8]  *movqi_internal/8
+	movl	%r13d, %eax	# 14394	[c=4 l=3]  *movsi_internal/0
+	subl	5176(%rbx), %eax	# 7809	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %eax	# 7810	[c=13 l=6]  *cmpsi_1/1
+	jb	.L1208	# 7811	[c=13 l=2]  *jcc
+	movl	%r13d, %eax	# 14396	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %eax	# 7813	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 13645	[c=5 l=5]  *andsi_1_zext
+	cmpb	$0, 1080(%rbx,%rax)	# 7816	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L1209	# 7817	[c=13 l=6]  *jcc
+.L1208:
+	movq	1040(%rbx), %rax	# 7821	[c=9 l=7]  *movdi_internal/3
+	movslq	%r13d, %r13	# 7820	[c=4 l=3]  *extendsidi2_rex64/1
+	movb	%dl, (%rax,%r13)	# 7822	[c=4 l=4]  *movqi_internal/8
+.L1210:
+	movl	(%rbx), %r15d	# 7843	[c=6 l=3]  *zero_extendsidi2/3
+	movq	%r10, %rcx	# 17278	[c=4 l=3]  *movdi_internal/3
+	movq	%r15, %rdx	# 16813	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 7845	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 7847	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%r15), %eax	# 7848	[c=13 l=5]  *zero_extendqisi2/0
+	movq	(%r15), %r14	# 7851	[c=5 l=3]  *movdi_internal/3
+	addl	%edx, %eax	# 7849	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 17279	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 7850	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 17280	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 17281	[c=4 l=3]  *indirect_jump
+.L1211:
+	movzbl	10(%r15), %r14d	# 7857	[c=13 l=5]  zero_extendqidi2/0
+	cmpb	$0, 844(%rbx)	# 7861	[c=13 l=7]  *cmpqi_ccno_1/1
+	movzwl	1034(%rbx), %r13d	# 7860	[c=13 l=8]  *zero_extendhisi2/0
+	movzbl	1004(%rbx,%r14), %r15d	# 7858	[c=14 l=9]  *zero_extendqisi2/0
+	movl	%r15d, %eax	# 16814	[c=4 l=3]  *movsi_internal/0
+	jne	.L1820	# 7862	[c=13 l=6]  *jcc
+.L1212:
+	movl	%r13d, %edx	# 14398	[c=4 l=3]  *movsi_internal/0
+	subl	5176(%rbx), %edx	# 7874	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %edx	# 7875	[c=13 l=6]  *cmpsi_1/1
+	jb	.L1214	# 7876	[c=13 l=2]  *jcc
+	movl	%r13d, %edx	# 14400	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %edx	# 7878	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %edx	# 13644	[c=5 l=6]  *andsi_1_zext
+	cmpb	$0, 1080(%rbx,%rdx)	# 7881	[c=14 l=8]  *cmpqi_ccno_1/1
+	je	.L1214	# 7882	[c=13 l=2]  *jcc
+	movl	%r13d, %esi	# 7894	[c=4 l=3]  *movsi_internal/0
+	movq	%rbx, %rdi	# 7895	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 7896	[c=10 l=5]  *call_value
+	leaq	flag_update_table_add8(%rip), %r10	# 15655	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_sub8(%rip), %r11	# 15657	[c=1 l=7]  *movdi_internal/4
+	movl	%eax, %edx	# 7897	[c=4 l=2]  *movsi_internal/0
+	movl	%eax, %ecx	# 7898	[c=4 l=2]  *movqi_internal/0
+	xorl	%r15d, %edx	# 7899	[c=4 l=3]  *xorsi_1/0
+	jmp	.L1216	# 18576	[c=1 l=2]  jump
+.L1214:
+	movq	1040(%rbx), %rcx	# 7886	[c=9 l=7]  *movdi_internal/3
+	movslq	%r13d, %rdx	# 7885	[c=4 l=3]  *extendsidi2_rex64/1
+	movzbl	(%rcx,%rdx), %ecx	# 7887	[c=9 l=4]  *movqi_internal/4
+	xorl	%ecx, %eax	# 16252	[c=4 l=2]  *xorsi_1/0
+	movzbl	%al, %edx	# 7889	[c=4 l=3]  *zero_extendqisi2/0
+.L1216:
+	movb	%cl, 1004(%rbx,%r14)	# 7921	[c=4 l=8]  *movqi_internal/8
+	movl	%r13d, %eax	# 14407	[c=4 l=3]  *movsi_internal/0
+	subl	5176(%rbx), %eax	# 7922	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %eax	# 7923	[c=13 l=6]  *cmpsi_1/1
+	jb	.L1218	# 7924	[c=13 l=2]  *jcc
+	movl	%r13d, %eax	# 14409	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %eax	# 7926	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 13642	[c=5 l=5]  *andsi_1_zext
+	cmpb	$0, 1080(%rbx,%rax)	# 7929	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L1219	# 7930	[c=13 l=6]  *jcc
+.L1218:
+	movq	1040(%rbx), %rax	# 7934	[c=9 l=7]  *movdi_internal/3
+	movslq	%r13d, %r13	# 7933	[c=4 l=3]  *extendsidi2_rex64/1
+	movb	%dl, (%rax,%r13)	# 7935	[c=4 l=4]  *movqi_internal/8
+.L1220:
+	movl	(%rbx), %r15d	# 7956	[c=6 l=3]  *zero_extendsidi2/3
+	movq	%r10, %rcx	# 17270	[c=4 l=3]  *movdi_internal/3
+	movq	%r15, %rdx	# 16815	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 7958	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 7960	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%r15), %eax	# 7961	[c=13 l=5]  *zero_extendqisi2/0
+	movq	(%r15), %r14	# 7964	[c=5 l=3]  *movdi_internal/3
+	addl	%edx, %eax	# 7962	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 17271	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 7963	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 17272	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 17273	[c=4 l=3]  *indirect_jump
+.L1191:
+	movzbl	10(%r15), %r14d	# 7630	[c=13 l=5]  zero_extendqidi2/0
+	cmpb	$0, 844(%rbx)	# 7634	[c=13 l=7]  *cmpqi_ccno_1/1
+	movzwl	1034(%rbx), %r13d	# 7633	[c=13 l=8]  *zero_extendhisi2/0
+	movzbl	1004(%rbx,%r14), %r15d	# 7631	[c=14 l=9]  *zero_extendqisi2/0
+	movl	%r15d, %eax	# 16809	[c=4 l=3]  *movsi_internal/0
+	jne	.L1821	# 7635	[c=13 l=6]  *jcc
+.L1192:
+	movl	%r13d, %edx	# 14366	[c=4 l=3]  *movsi_internal/0
+	subl	5176(%rbx), %edx	# 7647	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %edx	# 7648	[c=13 l=6]  *cmpsi_1/1
+	jb	.L1194	# 7649	[c=13 l=2]  *jcc
+	movl	%r13d, %edx	# 14368	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %edx	# 7651	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %edx	# 13650	[c=5 l=6]  *andsi_1_zext
+	cmpb	$0, 1080(%rbx,%rdx)	# 7654	[c=14 l=8]  *cmpqi_ccno_1/1
+	je	.L1194	# 7655	[c=13 l=2]  *jcc
+	movl	%r13d, %esi	# 7667	[c=4 l=3]  *movsi_internal/0
+	movq	%rbx, %rdi	# 7668	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 7669	[c=10 l=5]  *call_value
+	leaq	flag_update_table_add8(%rip), %r10	# 15631	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_sub8(%rip), %r11	# 15633	[c=1 l=7]  *movdi_internal/4
+	movl	%eax, %edx	# 7670	[c=4 l=2]  *movsi_internal/0
+	movl	%eax, %ecx	# 7671	[c=4 l=2]  *movqi_internal/0
+	orl	%r15d, %edx	# 7672	[c=4 l=3]  *iorsi_1/0
+	jmp	.L1196	# 18579	[c=1 l=2]  jump
+.L1194:
+	movq	1040(%rbx), %rcx	# 7659	[c=9 l=7]  *movdi_internal/3
+	movslq	%r13d, %rdx	# 7658	[c=4 l=3]  *extendsidi2_rex64/1
+	movzbl	(%rcx,%rdx), %ecx	# 7660	[c=9 l=4]  *movqi_internal/4
+	orl	%ecx, %eax	# 16254	[c=4 l=2]  *iorsi_1/0
+	movzbl	%al, %edx	# 7662	[c=4 l=3]  *zero_extendqisi2/0
+.L1196:
+	movb	%cl, 1004(%rbx,%r14)	# 7694	[c=4 l=8]  *movqi_internal/8
+	movl	%r13d, %eax	# 14375	[c=4 l=3]  *movsi_internal/0
+	subl	5176(%rbx), %eax	# 7695	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %eax	# 7696	[c=13 l=6]  *cmpsi_1/1
+	jb	.L1198	# 7697	[c=13 l=2]  *jcc
+	movl	%r13d, %eax	# 14377	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %eax	# 7699	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 13648	[c=5 l=5]  *andsi_1_zext
+	cmpb	$0, 1080(%rbx,%rax)	# 7702	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L1199	# 7703	[c=13 l=6]  *jcc
+.L1198:
+	movq	1040(%rbx), %rax	# 7707	[c=9 l=7]  *movdi_internal/3
+	movslq	%r13d, %r13	# 7706	[c=4 l=3]  *extendsidi2_rex64/1
+	movb	%dl, (%rax,%r13)	# 7708	[c=4 l=4]  *movqi_internal/8
+.L1200:
+	movl	(%rbx), %r15d	# 7729	[c=6 l=3]  *zero_extendsidi2/3
+	movq	%r10, %rcx	# 17286	[c=4 l=3]  *movdi_internal/3
+	movq	%r15, %rdx	# 16810	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 7731	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 7733	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%r15), %eax	# 7734	[c=13 l=5]  *zero_extendqisi2/0
+	movq	(%r15), %r14	# 7737	[c=5 l=3]  *movdi_internal/3
+	addl	%edx, %eax	# 7735	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 17287	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 7736	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 17288	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 17289	[c=4 l=3]  *indirect_jump
+.L1150:
+	cmpb	$0, 844(%rbx)	# 7055	[c=13 l=7]  *cmpqi_ccno_1/1
+	movzbl	10(%r15), %esi	# 7054	[c=13 l=5]  zero_extendqidi2/0
+	jne	.L1822	# 7056	[c=13 l=6]  *jcc
+	movzwl	1034(%rbx), %r13d	# 7069	[c=13 l=8]  *zero_extendhisi2/0
+	movzbl	1004(%rbx,%rsi), %edx	# 7072	[c=14 l=8]  *zero_extendqisi2/0
+	subl	$1, %r13d	# 7070	[c=4 l=4]  *addsi_1/0
+	movl	%r13d, %eax	# 14307	[c=4 l=3]  *movsi_internal/0
+	subl	5176(%rbx), %eax	# 7073	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %eax	# 7074	[c=13 l=6]  *cmpsi_1/1
+	jb	.L1153	# 7075	[c=13 l=2]  *jcc
+	movl	%r13d, %eax	# 14309	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %eax	# 7077	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 13654	[c=5 l=5]  *andsi_1_zext
+	cmpb	$0, 1080(%rbx,%rax)	# 7080	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L1154	# 7081	[c=13 l=6]  *jcc
+.L1153:
+	movq	1040(%rbx), %rcx	# 7085	[c=9 l=7]  *movdi_internal/3
+	movslq	%r13d, %rax	# 7084	[c=4 l=3]  *extendsidi2_rex64/1
+	movb	%dl, (%rcx,%rax)	# 7086	[c=4 l=3]  *movqi_internal/8
+.L1155:
+	movw	%r13w, 1034(%rbx)	# 7098	[c=4 l=8]  *movhi_internal/3
+.L1152:
+	movl	(%rbx), %r15d	# 7101	[c=6 l=3]  *zero_extendsidi2/3
+	movq	%r10, %rcx	# 17374	[c=4 l=3]  *movdi_internal/3
+	movq	%r15, %rdx	# 16792	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 7103	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 7105	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%r15), %eax	# 7106	[c=13 l=5]  *zero_extendqisi2/0
+	movq	(%r15), %r14	# 7109	[c=5 l=3]  *movdi_internal/3
+	addl	%edx, %eax	# 7107	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 17375	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 7108	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 17376	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 17377	[c=4 l=3]  *indirect_jump
+.L846:
+	movl	$2, 96(%rbx)	# 3310	[c=4 l=7]  *movsi_internal/1
+	movzbl	10(%r15), %esi	# 3311	[c=13 l=5]  *zero_extendqisi2/0
+	movzwl	12(%r15), %eax	# 3313	[c=13 l=5]  *zero_extendhisi2/0
+	sall	$16, %esi	# 3312	[c=4 l=3]  *ashlsi3_1/0
+	orl	%eax, %esi	# 3314	[c=4 l=2]  *iorsi_1/0
+	movl	%esi, (%rbx)	# 3315	[c=4 l=2]  *movsi_internal/1
+	cmpl	%esi, 992(%rbx)	# 3316	[c=13 l=6]  *cmpsi_1/0
+	jb	.L1583	# 3317	[c=13 l=6]  *jcc
+	movq	(%rsp), %rax	# 14032	[c=5 l=4]  *movdi_internal/3
+	subq	$1, %rax	# 3325	[c=4 l=4]  *adddi_1/0
+	cmpq	%rbp, %rax	# 3326	[c=4 l=3]  *cmpdi_1/0
+	jb	.L680	# 3327	[c=13 l=6]  *jcc
+	movq	56(%rbx), %rax	# 14033	[c=9 l=4]  *movdi_internal/3
+	cmpq	%rax, 48(%rbx)	# 3330	[c=13 l=4]  *cmpdi_1/0
+	jnb	.L1823	# 3331	[c=13 l=6]  *jcc
+.L848:
+	movl	(%rbx), %r15d	# 3338	[c=6 l=3]  *zero_extendsidi2/3
+	movl	$1, 96(%rbx)	# 3343	[c=4 l=7]  *movsi_internal/1
+	movq	%r10, %rcx	# 17822	[c=4 l=3]  *movdi_internal/3
+	movq	%r15, %rdx	# 16709	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 3340	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 3342	[c=13 l=7]  *adddi_1/1
+	movzbl	11(%r15), %eax	# 3344	[c=13 l=5]  zero_extendqidi2/0
+	movq	(%r15), %r14	# 3352	[c=5 l=3]  *movdi_internal/3
+	addq	%rax, %rbp	# 3345	[c=4 l=3]  *adddi_1/0
+	movzwl	14(%r15), %eax	# 3347	[c=13 l=5]  zero_extendhidi2/0
+	addq	%rax, 48(%rbx)	# 3348	[c=13 l=4]  *adddi_1/0
+	movq	%rbp, 40(%rbx)	# 3346	[c=4 l=4]  *movdi_internal/5
+	movzbl	9(%r15), %eax	# 3349	[c=13 l=5]  *zero_extendqisi2/0
+	addl	%edx, %eax	# 3350	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 17823	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 3351	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 17824	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 17825	[c=4 l=3]  *indirect_jump
+.L1047:
+	movl	$2, 96(%rbx)	# 5816	[c=4 l=7]  *movsi_internal/1
+	movzbl	10(%r15), %esi	# 5818	[c=13 l=5]  zero_extendqidi2/0
+	movzwl	12(%r15), %r13d	# 5817	[c=13 l=5]  *zero_extendhisi2/0
+	movl	%esi, %edx	# 14227	[c=4 l=2]  *movsi_internal/0
+	movq	%rsi, %rax	# 16765	[c=4 l=3]  *movdi_internal/3
+	subl	5176(%rbx), %edx	# 5820	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %edx	# 5821	[c=13 l=6]  *cmpsi_1/1
+	jb	.L1048	# 5822	[c=13 l=2]  *jcc
+	movl	%esi, %edx	# 14229	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %edx	# 5825	[c=4 l=3]  *ashrsi3_1/0
+	movslq	%edx, %rdx	# 5826	[c=4 l=3]  *extendsidi2_rex64/1
+	cmpb	$0, 1080(%rbx,%rdx)	# 5827	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L1049	# 5828	[c=13 l=6]  *jcc
+.L1048:
+	movq	1040(%rbx), %rdx	# 5832	[c=9 l=7]  *movdi_internal/3
+	movzbl	(%rdx,%rax), %eax	# 5833	[c=13 l=4]  *zero_extendqisi2/0
+.L1050:
+	testl	%eax, %r13d	# 5845	[c=4 l=3]  *testsi_1/0
+	jne	.L1051	# 5846	[c=13 l=2]  *jcc
+	movl	(%rbx), %eax	# 14231	[c=5 l=2]  *movsi_internal/0
+	addq	$2, 48(%rbx)	# 5854	[c=13 l=5]  *adddi_1/0
+	addl	$2, %eax	# 5849	[c=4 l=3]  *addsi_1/0
+	andl	992(%rbx), %eax	# 5852	[c=13 l=6]  *andsi_1/1
+	movl	%eax, (%rbx)	# 5853	[c=4 l=2]  *movsi_internal/1
+.L1051:
+	movq	(%rsp), %rax	# 14232	[c=5 l=4]  *movdi_internal/3
+	subq	$1, %rax	# 5857	[c=4 l=4]  *adddi_1/0
+	cmpq	%rbp, %rax	# 5858	[c=4 l=3]  *cmpdi_1/0
+	jb	.L680	# 5859	[c=13 l=6]  *jcc
+	movq	56(%rbx), %rax	# 14233	[c=9 l=4]  *movdi_internal/3
+	cmpq	%rax, 48(%rbx)	# 5862	[c=13 l=4]  *cmpdi_1/0
+	jnb	.L1824	# 5863	[c=13 l=6]  *jcc
+.L1052:
+	movl	(%rbx), %r15d	# 5870	[c=6 l=3]  *zero_extendsidi2/3
+	movl	$1, 96(%rbx)	# 5875	[c=4 l=7]  *movsi_internal/1
+	movq	%r10, %rcx	# 17518	[c=4 l=3]  *movdi_internal/3
+	movq	%r15, %rdx	# 16766	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 5872	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 5874	[c=13 l=7]  *adddi_1/1
+	movzbl	11(%r15), %eax	# 5876	[c=13 l=5]  zero_extendqidi2/0
+	movq	(%r15), %r14	# 5884	[c=5 l=3]  *movdi_internal/3
+	addq	%rax, %rbp	# 5877	[c=4 l=3]  *adddi_1/0
+	movzwl	14(%r15), %eax	# 5879	[c=13 l=5]  zero_extendhidi2/0
+	addq	%rax, 48(%rbx)	# 5880	[c=13 l=4]  *adddi_1/0
+	movq	%rbp, 40(%rbx)	# 5878	[c=4 l=4]  *movdi_internal/5
+	movzbl	9(%r15), %eax	# 5881	[c=13 l=5]  *zero_extendqisi2/0
+	addl	%edx, %eax	# 5882	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 17519	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 5883	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 17520	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 17521	[c=4 l=3]  *indirect_jump
+.L1053:
+	movl	$2, 96(%rbx)	# 5889	[c=4 l=7]  *movsi_internal/1
+	movzbl	10(%r15), %esi	# 5891	[c=13 l=5]  zero_extendqidi2/0
+	movzwl	12(%r15), %r13d	# 5890	[c=13 l=5]  *zero_extendhisi2/0
+	movl	%esi, %edx	# 14234	[c=4 l=2]  *movsi_internal/0
+	movq	%rsi, %rax	# 16767	[c=4 l=3]  *movdi_internal/3
+	subl	5176(%rbx), %edx	# 5893	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %edx	# 5894	[c=13 l=6]  *cmpsi_1/1
+	jb	.L1054	# 5895	[c=13 l=2]  *jcc
+	movl	%esi, %edx	# 14236	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %edx	# 5898	[c=4 l=3]  *ashrsi3_1/0
+	movslq	%edx, %rdx	# 5899	[c=4 l=3]  *extendsidi2_rex64/1
+	cmpb	$0, 1080(%rbx,%rdx)	# 5900	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L1055	# 5901	[c=13 l=6]  *jcc
+.L1054:
+	movq	1040(%rbx), %rdx	# 5905	[c=9 l=7]  *movdi_internal/3
+	movzbl	(%rdx,%rax), %eax	# 5906	[c=13 l=4]  *zero_extendqisi2/0
+.L1056:
+	testl	%eax, %r13d	# 5918	[c=4 l=3]  *testsi_1/0
+	je	.L1057	# 5919	[c=13 l=2]  *jcc
+	movl	(%rbx), %eax	# 14238	[c=5 l=2]  *movsi_internal/0
+	addq	$1, 48(%rbx)	# 5927	[c=13 l=5]  *adddi_1/0
+	addl	$1, %eax	# 5922	[c=4 l=3]  *addsi_1/0
+	andl	992(%rbx), %eax	# 5925	[c=13 l=6]  *andsi_1/1
+	movl	%eax, (%rbx)	# 5926	[c=4 l=2]  *movsi_internal/1
+.L1057:
+	movq	(%rsp), %rax	# 14239	[c=5 l=4]  *movdi_internal/3
+	subq	$1, %rax	# 5930	[c=4 l=4]  *adddi_1/0
+	cmpq	%rbp, %rax	# 5931	[c=4 l=3]  *cmpdi_1/0
+	jb	.L680	# 5932	[c=13 l=6]  *jcc
+	movq	56(%rbx), %rax	# 14240	[c=9 l=4]  *movdi_internal/3
+	cmpq	%rax, 48(%rbx)	# 5935	[c=13 l=4]  *cmpdi_1/0
+	jnb	.L1825	# 5936	[c=13 l=6]  *jcc
+.L1058:
+	movl	(%rbx), %r15d	# 5943	[c=6 l=3]  *zero_extendsidi2/3
+	movl	$1, 96(%rbx)	# 5948	[c=4 l=7]  *movsi_internal/1
+	movq	%r10, %rcx	# 17510	[c=4 l=3]  *movdi_internal/3
+	movq	%r15, %rdx	# 16768	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 5945	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 5947	[c=13 l=7]  *adddi_1/1
+	movzbl	11(%r15), %eax	# 5949	[c=13 l=5]  zero_extendqidi2/0
+	movq	(%r15), %r14	# 5957	[c=5 l=3]  *movdi_internal/3
+	addq	%rax, %rbp	# 5950	[c=4 l=3]  *adddi_1/0
+	movzwl	14(%r15), %eax	# 5952	[c=13 l=5]  zero_extendhidi2/0
+	addq	%rax, 48(%rbx)	# 5953	[c=13 l=4]  *adddi_1/0
+	movq	%rbp, 40(%rbx)	# 5951	[c=4 l=4]  *movdi_internal/5
+	movzbl	9(%r15), %eax	# 5954	[c=13 l=5]  *zero_extendqisi2/0
+	addl	%edx, %eax	# 5955	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 17511	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 5956	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 17512	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 17513	[c=4 l=3]  *indirect_jump
+.L1162:
+	movzbl	10(%r15), %edx	# 7177	[c=13 l=5]  zero_extendqidi2/0
+	movzwl	12(%r15), %ecx	# 7180	[c=13 l=5]  zero_extendhidi2/0
+	movzbl	1004(%rbx,%rdx), %eax	# 7178	[c=10 l=8]  *movqi_internal/4
+	movzbl	1004(%rbx,%rcx), %esi	# 7181	[c=14 l=8]  *zero_extendqisi2/0
+	movl	%eax, %ecx	# 14315	[c=4 l=2]  *movqi_internal/0
+	subl	%esi, %ecx	# 16268	[c=4 l=2]  *subsi_1/0
+	movb	%cl, 1004(%rbx,%rdx)	# 7184	[c=4 l=7]  *movqi_internal/8
+	movl	%eax, %ecx	# 14317	[c=4 l=2]  *movsi_internal/0
+	movl	%esi, %edx	# 14319	[c=4 l=2]  *movsi_internal/0
+	andl	$136, %edx	# 7189	[c=4 l=6]  *andsi_1/0
+	andl	$136, %ecx	# 7186	[c=4 l=6]  *andsi_1/0
+	leal	(%rdx,%rcx,2), %ecx	# 7190	[c=8 l=3]  *leasi
+	movzbl	%al, %edx	# 7191	[c=4 l=3]  *zero_extendqisi2/0
+	imull	$260, %ecx, %eax	# 7195	[c=12 l=6]  *mulsi3_1/1
+	subl	%esi, %edx	# 7193	[c=4 l=2]  *subsi_1/0
+	movzbl	100(%rbx), %ecx	# 7198	[c=9 l=4]  *movqi_internal/4
+	andl	$511, %edx	# 7194	[c=4 l=6]  *andsi_1/0
+	andl	$7680, %eax	# 7196	[c=4 l=5]  *andsi_1/0
+	orl	%eax, %edx	# 7197	[c=5 l=2]  *iorsi_1_zext
+	movl	%ecx, %eax	# 14321	[c=4 l=2]  *movsi_internal/0
+	andl	$192, %eax	# 7201	[c=4 l=5]  *andsi_2/0
+	jne	.L1163	# 7202	[c=13 l=6]  *jcc
+	leaq	flag_update_table_sub8(%rip), %rax	# 7205	[c=1 l=7]  *movdi_internal/4
+	movl	$63, %ecx	# 31	[c=4 l=5]  *movqi_internal/3
+	addq	%rdx, %rax	# 7206	[c=4 l=3]  *adddi_1/0
+.L1164:
+	movl	(%rbx), %r15d	# 7225	[c=6 l=3]  *zero_extendsidi2/3
+	movb	%cl, 100(%rbx)	# 7224	[c=4 l=3]  *movqi_internal/8
+	movq	%r10, %rcx	# 17358	[c=4 l=3]  *movdi_internal/3
+	movq	%rax, 104(%rbx)	# 7223	[c=4 l=4]  *movdi_internal/5
+	movq	%r15, %rdx	# 16795	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 7227	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 7229	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%r15), %eax	# 7230	[c=13 l=5]  *zero_extendqisi2/0
+	movq	(%r15), %r14	# 7233	[c=5 l=3]  *movdi_internal/3
+	addl	%edx, %eax	# 7231	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 17359	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 7232	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 17360	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 17361	[c=4 l=3]  *indirect_jump
+.L1258:
+	movzbl	10(%r15), %eax	# 8920	[c=13 l=5]  zero_extendqidi2/0
+	movzwl	12(%r15), %esi	# 8918	[c=9 l=5]  *movhi_internal/2
+	movzbl	1004(%rbx,%rax), %eax	# 8921	[c=10 l=8]  *movqi_internal/4
+.L1593:
+	movl	%eax, %ecx	# 14568	[c=4 l=2]  *movsi_internal/0
+	movl	%esi, %edx	# 14570	[c=4 l=2]  *movsi_internal/0
+	movzbl	100(%rbx), %edi	# 8935	[c=9 l=4]  *movqi_internal/4
+	andl	$136, %edx	# 8926	[c=4 l=6]  *andsi_1/0
+	andl	$136, %ecx	# 8923	[c=4 l=6]  *andsi_1/0
+	leal	(%rdx,%rcx,2), %ecx	# 8927	[c=8 l=3]  *leasi
+	movzbl	%al, %edx	# 8928	[c=4 l=3]  *zero_extendqisi2/0
+	imull	$260, %ecx, %eax	# 8932	[c=12 l=6]  *mulsi3_1/1
+	subl	%esi, %edx	# 8930	[c=4 l=2]  *subsi_1/0
+	andl	$511, %edx	# 8931	[c=4 l=6]  *andsi_1/0
+	andl	$7680, %eax	# 8933	[c=4 l=5]  *andsi_1/0
+	orl	%eax, %edx	# 8934	[c=5 l=2]  *iorsi_1_zext
+	movl	%edi, %eax	# 14572	[c=4 l=2]  *movsi_internal/0
+	andl	$192, %eax	# 8938	[c=4 l=5]  *andsi_2/0
+	jne	.L1259	# 8939	[c=13 l=6]  *jcc
+	leaq	flag_update_table_sub8(%rip), %rax	# 8942	[c=1 l=7]  *movdi_internal/4
+	movl	$63, %edi	# 54	[c=4 l=5]  *movqi_internal/3
+	leaq	(%rax,%rdx), %rsi	# 16193	[c=4 l=4]  *leadi
+	leaq	101(%rbx), %rdx	# 12291	[c=4 l=4]  *leadi
+.L1260:
+	movl	(%rbx), %r8d	# 8963	[c=6 l=3]  *zero_extendsidi2/3
+	movb	%dil, 100(%rbx)	# 8961	[c=4 l=4]  *movqi_internal/8
+	movq	%rsi, 104(%rbx)	# 8960	[c=4 l=4]  *movdi_internal/5
+	movq	%r8, %r9	# 16834	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r8	# 8965	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r8	# 8966	[c=13 l=7]  *adddi_1/1
+	leal	1(%r9), %ecx	# 16186	[c=4 l=4]  *leasi
+	addl	$2, %r9d	# 9016	[c=4 l=4]  *addsi_1/0
+	movl	%ecx, 16(%rsp)	# 15672	[c=4 l=4]  *movsi_internal/1
+	movl	%ecx, (%rbx)	# 8968	[c=4 l=2]  *movsi_internal/1
+	movzbl	10(%r8), %ecx	# 8970	[c=13 l=5]  zero_extendqidi2/0
+	movzwl	12(%r8), %r8d	# 8973	[c=13 l=5]  zero_extendhidi2/0
+	movzbl	(%rsi), %r13d	# 8976	[c=5 l=4]  *movqi_internal/4
+	movq	1040(%rbx), %rsi	# 8977	[c=9 l=7]  *movdi_internal/3
+	movzbl	1004(%rbx,%rcx), %ecx	# 8971	[c=14 l=8]  *zero_extendqisi2/0
+	movzbl	1004(%rbx,%r8), %r14d	# 8974	[c=14 l=9]  *zero_extendqisi2/0
+	movzbl	%dil, %r8d	# 8975	[c=4 l=4]  *zero_extendqisi2/0
+	andl	%r13d, %edi	# 16187	[c=4 l=3]  *andsi_1/0
+	movzbl	63(%rsi), %r15d	# 8978	[c=13 l=5]  *zero_extendqisi2/0
+	movl	%r8d, %esi	# 14580	[c=4 l=3]  *movsi_internal/0
+	movzbl	%dil, %edi	# 8982	[c=4 l=4]  *zero_extendqisi2/0
+	andl	$-64, %r8d	# 8990	[c=4 l=4]  *andsi_1/0
+	notl	%esi	# 8979	[c=4 l=2]  *one_cmplsi2_1/0
+	andl	%r8d, %r13d	# 16188	[c=4 l=3]  *andsi_1/0
+	orl	$63, %r8d	# 16190	[c=4 l=4]  *iorsi_1/0
+	movq	%rdx, 104(%rbx)	# 9012	[c=4 l=4]  *movdi_internal/5
+	andl	%r15d, %esi	# 8980	[c=4 l=3]  *andsi_1/0
+	movl	%ecx, %r15d	# 14582	[c=4 l=3]  *movsi_internal/0
+	subl	%r14d, %ecx	# 8995	[c=4 l=3]  *subsi_1/0
+	movb	%r8b, 100(%rbx)	# 9010	[c=4 l=4]  *movqi_internal/8
+	orl	%edi, %esi	# 8983	[c=4 l=2]  *iorsi_1/0
+	movl	%r14d, %edi	# 14584	[c=4 l=3]  *movsi_internal/0
+	andl	$136, %r15d	# 8985	[c=4 l=7]  *andsi_1/0
+	movl	%r9d, (%rbx)	# 9017	[c=4 l=3]  *movsi_internal/1
+	andl	$136, %edi	# 8988	[c=4 l=6]  *andsi_1/0
+	movl	%esi, %r14d	# 14586	[c=4 l=3]  *movsi_internal/0
+	orl	$-3, %esi	# 9004	[c=4 l=3]  *iorsi_1/0
+	leal	(%rdi,%r15,2), %edi	# 8989	[c=8 l=4]  *leasi
+	andl	$1, %r14d	# 8996	[c=4 l=4]  *andsi_1/0
+	movl	16(%rsp), %r15d	# 9013	[c=10 l=5]  *zero_extendsidi2/3
+	imull	$260, %edi, %edi	# 8999	[c=12 l=6]  *mulsi3_1/1
+	subl	%r14d, %ecx	# 8997	[c=4 l=3]  *subsi_1/0
+	andl	$511, %ecx	# 8998	[c=4 l=6]  *andsi_1/0
+	salq	$4, %r15	# 9014	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 9015	[c=13 l=7]  *adddi_1/1
+	andl	$7680, %edi	# 9000	[c=4 l=6]  *andsi_1/0
+	orl	%edi, %ecx	# 9001	[c=5 l=2]  *iorsi_1_zext
+	andb	(%rax,%rcx), %sil	# 9005	[c=13 l=4]  *andqi_1/1
+	orl	%r13d, %esi	# 16189	[c=4 l=3]  *iorsi_1/0
+	movb	%sil, 101(%rbx)	# 9008	[c=4 l=4]  *movqi_internal/8
+	jmp	.L685	# 18585	[c=1 l=5]  jump
+.L1172:
+	movzbl	10(%r15), %ecx	# 7365	[c=13 l=5]  zero_extendqidi2/0
+	movzbl	1004(%rbx,%rcx), %edx	# 7366	[c=14 l=8]  *zero_extendqisi2/0
+	movl	%edx, %eax	# 16802	[c=4 l=2]  *movsi_internal/0
+	addl	%edx, %edx	# 7368	[c=4 l=2]  *ashlsi3_1/0
+	andl	$136, %eax	# 7372	[c=4 l=5]  *andsi_1/0
+	movb	%dl, 1004(%rbx,%rcx)	# 7370	[c=4 l=7]  *movqi_internal/8
+	imull	$780, %eax, %eax	# 7373	[c=12 l=6]  *mulsi3_1/1
+	andl	$7680, %eax	# 7374	[c=4 l=5]  *andsi_1/0
+	orl	%edx, %eax	# 7375	[c=5 l=2]  *iorsi_1_zext
+	movzbl	100(%rbx), %edx	# 7376	[c=9 l=4]  *movqi_internal/4
+	movl	%edx, %ecx	# 14337	[c=4 l=2]  *movsi_internal/0
+	andl	$192, %ecx	# 7379	[c=4 l=6]  *andsi_2/0
+	jne	.L1173	# 7380	[c=13 l=6]  *jcc
+	leaq	flag_update_table_add8(%rip), %rcx	# 7383	[c=1 l=7]  *movdi_internal/4
+	movl	$63, %edx	# 35	[c=4 l=5]  *movqi_internal/3
+	addq	%rcx, %rax	# 7384	[c=4 l=3]  *adddi_1/0
+.L1174:
+	movl	(%rbx), %r15d	# 7403	[c=6 l=3]  *zero_extendsidi2/3
+	movb	%dl, 100(%rbx)	# 7402	[c=4 l=3]  *movqi_internal/8
+	movq	%r10, %rcx	# 17318	[c=4 l=3]  *movdi_internal/3
+	movq	%rax, 104(%rbx)	# 7401	[c=4 l=4]  *movdi_internal/5
+	movq	%r15, %rdx	# 16803	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 7405	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 7407	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%r15), %eax	# 7408	[c=13 l=5]  *zero_extendqisi2/0
+	movq	(%r15), %r14	# 7411	[c=5 l=3]  *movdi_internal/3
+	addl	%edx, %eax	# 7409	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 17319	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 7410	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 17320	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 17321	[c=4 l=3]  *indirect_jump
+.L1229:
+	movzbl	10(%r15), %eax	# 8181	[c=13 l=5]  zero_extendqidi2/0
+	movzwl	12(%r15), %edx	# 8184	[c=13 l=5]  zero_extendhidi2/0
+	movzbl	1004(%rbx,%rax), %eax	# 8182	[c=10 l=8]  *movqi_internal/4
+	movzbl	1004(%rbx,%rdx), %esi	# 8185	[c=14 l=8]  *zero_extendqisi2/0
+	jmp	.L1601	# 18587	[c=1 l=5]  jump
+.L1165:
+	movzbl	10(%r15), %esi	# 7240	[c=13 l=5]  zero_extendqidi2/0
+	movzwl	12(%r15), %edi	# 7238	[c=13 l=5]  *zero_extendhisi2/0
+	movzbl	1004(%rbx,%rsi), %eax	# 7241	[c=14 l=8]  *zero_extendqisi2/0
+	movl	%edi, %edx	# 16797	[c=4 l=2]  *movsi_internal/0
+	andl	$136, %edx	# 7251	[c=4 l=6]  *andsi_1/0
+	movl	%eax, %ecx	# 16796	[c=4 l=2]  *movsi_internal/0
+	subl	%edi, %eax	# 7244	[c=4 l=2]  *subsi_1/0
+	andl	$136, %ecx	# 7248	[c=4 l=6]  *andsi_1/0
+	movb	%al, 1004(%rbx,%rsi)	# 7246	[c=4 l=7]  *movqi_internal/8
+	andl	$511, %eax	# 7255	[c=4 l=5]  *andsi_1/0
+	leal	(%rdx,%rcx,2), %edx	# 7252	[c=8 l=3]  *leasi
+	movzbl	100(%rbx), %ecx	# 7257	[c=9 l=4]  *movqi_internal/4
+	imull	$260, %edx, %edx	# 7253	[c=12 l=6]  *mulsi3_1/1
+	andl	$7680, %edx	# 7254	[c=4 l=6]  *andsi_1/0
+	orl	%eax, %edx	# 7256	[c=5 l=2]  *iorsi_1_zext
+	movl	%ecx, %eax	# 14327	[c=4 l=2]  *movsi_internal/0
+	andl	$192, %eax	# 7260	[c=4 l=5]  *andsi_2/0
+	jne	.L1166	# 7261	[c=13 l=6]  *jcc
+	leaq	flag_update_table_sub8(%rip), %rax	# 7264	[c=1 l=7]  *movdi_internal/4
+	movl	$63, %ecx	# 32	[c=4 l=5]  *movqi_internal/3
+	addq	%rdx, %rax	# 7265	[c=4 l=3]  *adddi_1/0
+.L1167:
+	movl	(%rbx), %r15d	# 7284	[c=6 l=3]  *zero_extendsidi2/3
+	movb	%cl, 100(%rbx)	# 7283	[c=4 l=3]  *movqi_internal/8
+	movq	%r10, %rcx	# 17350	[c=4 l=3]  *movdi_internal/3
+	movq	%rax, 104(%rbx)	# 7282	[c=4 l=4]  *movdi_internal/5
+	movq	%r15, %rdx	# 16798	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 7286	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 7288	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%r15), %eax	# 7289	[c=13 l=5]  *zero_extendqisi2/0
+	movq	(%r15), %r14	# 7292	[c=5 l=3]  *movdi_internal/3
+	addl	%edx, %eax	# 7290	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 17351	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 7291	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 17352	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 17353	[c=4 l=3]  *indirect_jump
+.L1252:
+	movzbl	10(%r15), %eax	# 8709	[c=13 l=5]  zero_extendqidi2/0
+	movzwl	12(%r15), %edx	# 8712	[c=13 l=5]  zero_extendhidi2/0
+	movzbl	1004(%rbx,%rax), %eax	# 8710	[c=10 l=8]  *movqi_internal/4
+	movzbl	1004(%rbx,%rdx), %esi	# 8713	[c=14 l=8]  *zero_extendqisi2/0
+	jmp	.L1593	# 18589	[c=1 l=5]  jump
+.L1235:
+	movzbl	10(%r15), %eax	# 8295	[c=13 l=5]  zero_extendqidi2/0
+	movq	104(%rbx), %rcx	# 8302	[c=9 l=4]  *movdi_internal/3
+	movzbl	100(%rbx), %esi	# 8300	[c=13 l=4]  *zero_extendqisi2/0
+	movzbl	1004(%rbx,%rax), %edx	# 8296	[c=14 l=8]  *zero_extendqisi2/0
+	movzbl	(%rcx), %edi	# 8303	[c=5 l=3]  *movqi_internal/4
+	movzwl	12(%r15), %eax	# 8298	[c=13 l=5]  zero_extendhidi2/0
+	movq	1040(%rbx), %rcx	# 8304	[c=9 l=7]  *movdi_internal/3
+	movl	%esi, %r8d	# 14465	[c=4 l=3]  *movsi_internal/0
+	notl	%r8d	# 8306	[c=4 l=3]  *one_cmplsi2_1/0
+	movzbl	1004(%rbx,%rax), %r9d	# 8299	[c=14 l=9]  *zero_extendqisi2/0
+	movzbl	63(%rcx), %ecx	# 8305	[c=13 l=4]  *zero_extendqisi2/0
+	movl	%esi, %eax	# 16823	[c=4 l=2]  *movsi_internal/0
+	andl	$-64, %esi	# 8317	[c=4 l=3]  *andsi_1/0
+	andl	%edi, %eax	# 16231	[c=4 l=2]  *andsi_1/0
+	andl	%esi, %edi	# 16232	[c=4 l=2]  *andsi_1/0
+	orl	$63, %esi	# 16234	[c=4 l=3]  *iorsi_1/0
+	andl	%r8d, %ecx	# 8307	[c=4 l=3]  *andsi_1/0
+	movzbl	%al, %eax	# 8309	[c=4 l=3]  *zero_extendqisi2/0
+	movl	%edx, %r8d	# 14467	[c=4 l=3]  *movsi_internal/0
+	subl	%r9d, %edx	# 8322	[c=4 l=3]  *subsi_1/0
+	orl	%eax, %ecx	# 8310	[c=4 l=2]  *iorsi_1/0
+	movl	%r9d, %eax	# 14469	[c=4 l=3]  *movsi_internal/0
+	andl	$136, %r8d	# 8312	[c=4 l=7]  *andsi_1/0
+	movb	%sil, 100(%rbx)	# 8337	[c=4 l=4]  *movqi_internal/8
+	andl	$136, %eax	# 8315	[c=4 l=5]  *andsi_1/0
+	movl	%ecx, %r9d	# 14471	[c=4 l=3]  *movsi_internal/0
+	orl	$-3, %ecx	# 8331	[c=4 l=3]  *iorsi_1/0
+	leal	(%rax,%r8,2), %r8d	# 8316	[c=8 l=4]  *leasi
+	andl	$1, %r9d	# 8323	[c=4 l=4]  *andsi_1/0
+	leaq	flag_update_table_sub8(%rip), %rax	# 8319	[c=1 l=7]  *movdi_internal/4
+	imull	$260, %r8d, %r8d	# 8326	[c=12 l=7]  *mulsi3_1/1
+	subl	%r9d, %edx	# 8324	[c=4 l=3]  *subsi_1/0
+	andl	$511, %edx	# 8325	[c=4 l=6]  *andsi_1/0
+	andl	$7680, %r8d	# 8327	[c=4 l=7]  *andsi_1/0
+	orl	%r8d, %edx	# 8328	[c=5 l=3]  *iorsi_1_zext
+	andb	(%rax,%rdx), %cl	# 8332	[c=13 l=3]  *andqi_1/1
+	orl	%ecx, %edi	# 16233	[c=4 l=2]  *iorsi_1/0
+	movb	%dil, 101(%rbx)	# 8335	[c=4 l=4]  *movqi_internal/8
+	jmp	.L1566	# 18591	[c=1 l=5]  jump
+.L1175:
+	movzbl	100(%rbx), %ecx	# 7417	[c=13 l=4]  *zero_extendqisi2/0
+	movq	1040(%rbx), %rdi	# 7422	[c=9 l=7]  *movdi_internal/3
+	movq	104(%rbx), %rsi	# 7419	[c=9 l=4]  *movdi_internal/3
+	movzbl	10(%r15), %r8d	# 7420	[c=13 l=5]  zero_extendqidi2/0
+	movzbl	63(%rdi), %edi	# 7423	[c=13 l=4]  *zero_extendqisi2/0
+	movl	%ecx, %r9d	# 14343	[c=4 l=3]  *movsi_internal/0
+	movl	%ecx, %edx	# 16804	[c=4 l=2]  *movsi_internal/0
+	movzbl	1004(%rbx,%r8), %eax	# 7421	[c=10 l=9]  *movqi_internal/4
+	notl	%r9d	# 7424	[c=4 l=3]  *one_cmplsi2_1/0
+	andl	%r9d, %edi	# 7425	[c=4 l=3]  *andsi_1/0
+	movzbl	(%rsi), %r9d	# 18217	[c=5 l=4]  *movqi_internal/4
+	andl	%ecx, %r9d	# 19100	[c=4 l=3]  *andsi_1/0
+	orl	%r9d, %edi	# 7428	[c=4 l=3]  *iorsi_1/0
+	movzbl	%al, %r9d	# 7430	[c=4 l=4]  *zero_extendqisi2/0
+	andl	$136, %eax	# 7436	[c=4 l=5]  *andsi_1/0
+	imull	$780, %eax, %eax	# 7437	[c=12 l=6]  *mulsi3_1/1
+	andl	$1, %edi	# 7429	[c=4 l=3]  *andsi_1/0
+	leal	(%rdi,%r9,2), %edi	# 7432	[c=8 l=4]  *leasi
+	movb	%dil, 1004(%rbx,%r8)	# 7434	[c=4 l=8]  *movqi_internal/8
+	andl	$7680, %eax	# 7438	[c=4 l=5]  *andsi_1/0
+	orl	%edi, %eax	# 7439	[c=5 l=2]  *iorsi_1_zext
+	andl	$-64, %ecx	# 7441	[c=4 l=3]  *andsi_2/0
+	jne	.L1176	# 7442	[c=13 l=6]  *jcc
+	leaq	flag_update_table_add8(%rip), %rcx	# 7445	[c=1 l=7]  *movdi_internal/4
+	movl	$63, %edx	# 36	[c=4 l=5]  *movqi_internal/3
+	addq	%rcx, %rax	# 7446	[c=4 l=3]  *adddi_1/0
+.L1177:
+	movl	(%rbx), %r15d	# 7464	[c=6 l=3]  *zero_extendsidi2/3
+	movb	%dl, 100(%rbx)	# 7463	[c=4 l=3]  *movqi_internal/8
+	movq	%r10, %rcx	# 17310	[c=4 l=3]  *movdi_internal/3
+	movq	%rax, 104(%rbx)	# 7462	[c=4 l=4]  *movdi_internal/5
+	movq	%r15, %rdx	# 16805	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 7466	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 7468	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%r15), %eax	# 7469	[c=13 l=5]  *zero_extendqisi2/0
+	movq	(%r15), %r14	# 7472	[c=5 l=3]  *movdi_internal/3
+	addl	%edx, %eax	# 7470	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 17311	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 7471	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 17312	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 17313	[c=4 l=3]  *indirect_jump
+.L1178:
+	movzbl	100(%rbx), %edx	# 7480	[c=9 l=4]  *movqi_internal/4
+	movzbl	10(%r15), %eax	# 7478	[c=13 l=5]  zero_extendqidi2/0
+	movl	%edx, %ecx	# 14351	[c=4 l=2]  *movsi_internal/0
+	movzbl	1004(%rbx,%rax), %eax	# 7479	[c=14 l=8]  zero_extendqidi2/0
+	andl	$225, %ecx	# 7483	[c=4 l=6]  *andsi_2/0
+	jne	.L1179	# 7484	[c=13 l=6]  *jcc
+	leaq	flag_update_table_logical(%rip), %rdx	# 7487	[c=1 l=7]  *movdi_internal/4
+	addq	%rdx, %rax	# 7488	[c=4 l=3]  *adddi_1/0
+	movl	$30, %edx	# 37	[c=4 l=5]  *movqi_internal/3
+.L1180:
+	movl	(%rbx), %r15d	# 7508	[c=6 l=3]  *zero_extendsidi2/3
+	movb	%dl, 100(%rbx)	# 7507	[c=4 l=3]  *movqi_internal/8
+	movq	%r10, %rcx	# 17302	[c=4 l=3]  *movdi_internal/3
+	movq	%rax, 104(%rbx)	# 7506	[c=4 l=4]  *movdi_internal/5
+	movq	%r15, %rdx	# 16806	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 7510	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 7512	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%r15), %eax	# 7513	[c=13 l=5]  *zero_extendqisi2/0
+	movq	(%r15), %r14	# 7516	[c=5 l=3]  *movdi_internal/3
+	addl	%edx, %eax	# 7514	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 17303	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 7515	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 17304	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 17305	[c=4 l=3]  *indirect_jump
+.L1249:
+	movzbl	10(%r15), %eax	# 8603	[c=13 l=5]  zero_extendqidi2/0
+	movzwl	12(%r15), %edx	# 8606	[c=13 l=5]  zero_extendhidi2/0
+	movzbl	1004(%rbx,%rax), %eax	# 8604	[c=10 l=8]  *movqi_internal/4
+	movzbl	1004(%rbx,%rdx), %esi	# 8607	[c=14 l=8]  *zero_extendqisi2/0
+.L1591:
+	movl	%eax, %ecx	# 14547	[c=4 l=2]  *movsi_internal/0
+	movl	%esi, %edx	# 14549	[c=4 l=2]  *movsi_internal/0
+	movzbl	100(%rbx), %edi	# 8831	[c=9 l=4]  *movqi_internal/4
+	andl	$136, %edx	# 8822	[c=4 l=6]  *andsi_1/0
+	andl	$136, %ecx	# 8819	[c=4 l=6]  *andsi_1/0
+	leal	(%rdx,%rcx,2), %ecx	# 8823	[c=8 l=3]  *leasi
+	movzbl	%al, %edx	# 8824	[c=4 l=3]  *zero_extendqisi2/0
+	imull	$260, %ecx, %eax	# 8828	[c=12 l=6]  *mulsi3_1/1
+	subl	%esi, %edx	# 8826	[c=4 l=2]  *subsi_1/0
+	andl	$511, %edx	# 8827	[c=4 l=6]  *andsi_1/0
+	andl	$7680, %eax	# 8829	[c=4 l=5]  *andsi_1/0
+	orl	%eax, %edx	# 8830	[c=5 l=2]  *iorsi_1_zext
+	movl	%edi, %eax	# 14551	[c=4 l=2]  *movsi_internal/0
+	andl	$192, %eax	# 8834	[c=4 l=5]  *andsi_2/0
+	jne	.L1256	# 8835	[c=13 l=6]  *jcc
+	leaq	flag_update_table_sub8(%rip), %rax	# 8838	[c=1 l=7]  *movdi_internal/4
+	movl	$63, %edi	# 53	[c=4 l=5]  *movqi_internal/3
+	leaq	(%rax,%rdx), %rsi	# 16201	[c=4 l=4]  *leadi
+	leaq	101(%rbx), %rdx	# 12290	[c=4 l=4]  *leadi
+.L1257:
+	movl	(%rbx), %r8d	# 8859	[c=6 l=3]  *zero_extendsidi2/3
+	movb	%dil, 100(%rbx)	# 8857	[c=4 l=4]  *movqi_internal/8
+	movq	%rsi, 104(%rbx)	# 8856	[c=4 l=4]  *movdi_internal/5
+	movq	%r8, %r9	# 16833	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r8	# 8861	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r8	# 8862	[c=13 l=7]  *adddi_1/1
+	leal	1(%r9), %ecx	# 16194	[c=4 l=4]  *leasi
+	addl	$2, %r9d	# 8912	[c=4 l=4]  *addsi_1/0
+	movl	%ecx, 16(%rsp)	# 15670	[c=4 l=4]  *movsi_internal/1
+	movl	%ecx, (%rbx)	# 8864	[c=4 l=2]  *movsi_internal/1
+	movzbl	10(%r8), %ecx	# 8866	[c=13 l=5]  zero_extendqidi2/0
+	movzwl	12(%r8), %r8d	# 8869	[c=13 l=5]  zero_extendhidi2/0
+	movzbl	(%rsi), %r13d	# 8872	[c=5 l=4]  *movqi_internal/4
+	movq	1040(%rbx), %rsi	# 8873	[c=9 l=7]  *movdi_internal/3
+	movzbl	1004(%rbx,%rcx), %ecx	# 8867	[c=14 l=8]  *zero_extendqisi2/0
+	movzbl	1004(%rbx,%r8), %r14d	# 8870	[c=14 l=9]  *zero_extendqisi2/0
+	movzbl	%dil, %r8d	# 8871	[c=4 l=4]  *zero_extendqisi2/0
+	andl	%r13d, %edi	# 16195	[c=4 l=3]  *andsi_1/0
+	movzbl	63(%rsi), %r15d	# 8874	[c=13 l=5]  *zero_extendqisi2/0
+	movl	%r8d, %esi	# 14559	[c=4 l=3]  *movsi_internal/0
+	movzbl	%dil, %edi	# 8878	[c=4 l=4]  *zero_extendqisi2/0
+	andl	$-64, %r8d	# 8886	[c=4 l=4]  *andsi_1/0
+	notl	%esi	# 8875	[c=4 l=2]  *one_cmplsi2_1/0
+	andl	%r8d, %r13d	# 16196	[c=4 l=3]  *andsi_1/0
+	orl	$63, %r8d	# 16198	[c=4 l=4]  *iorsi_1/0
+	movq	%rdx, 104(%rbx)	# 8908	[c=4 l=4]  *movdi_internal/5
+	andl	%r15d, %esi	# 8876	[c=4 l=3]  *andsi_1/0
+	movl	%ecx, %r15d	# 14561	[c=4 l=3]  *movsi_internal/0
+	subl	%r14d, %ecx	# 8891	[c=4 l=3]  *subsi_1/0
+	movb	%r8b, 100(%rbx)	# 8906	[c=4 l=4]  *movqi_internal/8
+	orl	%edi, %esi	# 8879	[c=4 l=2]  *iorsi_1/0
+	movl	%r14d, %edi	# 14563	[c=4 l=3]  *movsi_internal/0
+	andl	$136, %r15d	# 8881	[c=4 l=7]  *andsi_1/0
+	movl	%r9d, (%rbx)	# 8913	[c=4 l=3]  *movsi_internal/1
+	andl	$136, %edi	# 8884	[c=4 l=6]  *andsi_1/0
+	movl	%esi, %r14d	# 14565	[c=4 l=3]  *movsi_internal/0
+	orl	$-3, %esi	# 8900	[c=4 l=3]  *iorsi_1/0
+	leal	(%rdi,%r15,2), %edi	# 8885	[c=8 l=4]  *leasi
+	andl	$1, %r14d	# 8892	[c=4 l=4]  *andsi_1/0
+	movl	16(%rsp), %r15d	# 8909	[c=10 l=5]  *zero_extendsidi2/3
+	imull	$260, %edi, %edi	# 8895	[c=12 l=6]  *mulsi3_1/1
+	subl	%r14d, %ecx	# 8893	[c=4 l=3]  *subsi_1/0
+	andl	$511, %ecx	# 8894	[c=4 l=6]  *andsi_1/0
+	salq	$4, %r15	# 8910	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 8911	[c=13 l=7]  *adddi_1/1
+	andl	$7680, %edi	# 8896	[c=4 l=6]  *andsi_1/0
+	orl	%edi, %ecx	# 8897	[c=5 l=2]  *iorsi_1_zext
+	andb	(%rax,%rcx), %sil	# 8901	[c=13 l=4]  *andqi_1/1
+	orl	%r13d, %esi	# 16197	[c=4 l=3]  *iorsi_1/0
+	movb	%sil, 101(%rbx)	# 8904	[c=4 l=4]  *movqi_internal/8
+	jmp	.L682	# 18593	[c=1 l=5]  jump
+.L1261:
+	movzwl	12(%r15), %edx	# 9026	[c=13 l=5]  zero_extendhidi2/0
+	movzbl	10(%r15), %eax	# 9023	[c=13 l=5]  zero_extendqidi2/0
+	movzbl	1004(%rbx,%rdx), %esi	# 9027	[c=14 l=8]  *zero_extendqisi2/0
+	movzbl	1004(%rbx,%rax), %eax	# 9024	[c=10 l=8]  *movqi_internal/4
+	movl	%esi, %edx	# 14591	[c=4 l=2]  *movsi_internal/0
+	movl	%eax, %ecx	# 14589	[c=4 l=2]  *movsi_internal/0
+	andl	$136, %edx	# 9032	[c=4 l=6]  *andsi_1/0
+	andl	$136, %ecx	# 9029	[c=4 l=6]  *andsi_1/0
+	leal	(%rdx,%rcx,2), %ecx	# 9033	[c=8 l=3]  *leasi
+	movzbl	%al, %edx	# 9034	[c=4 l=3]  *zero_extendqisi2/0
+	imull	$260, %ecx, %eax	# 9038	[c=12 l=6]  *mulsi3_1/1
+	subl	%esi, %edx	# 9036	[c=4 l=2]  *subsi_1/0
+	movzbl	100(%rbx), %ecx	# 9041	[c=9 l=4]  *movqi_internal/4
+	andl	$511, %edx	# 9037	[c=4 l=6]  *andsi_1/0
+	andl	$7680, %eax	# 9039	[c=4 l=5]  *andsi_1/0
+	orl	%eax, %edx	# 9040	[c=5 l=2]  *iorsi_1_zext
+	movl	%ecx, %eax	# 14593	[c=4 l=2]  *movsi_internal/0
+	andl	$192, %eax	# 9044	[c=4 l=5]  *andsi_2/0
+	jne	.L1262	# 9045	[c=13 l=6]  *jcc
+	leaq	flag_update_table_sub8(%rip), %rax	# 9048	[c=1 l=7]  *movdi_internal/4
+	movl	$63, %ecx	# 55	[c=4 l=5]  *movqi_internal/3
+	leaq	(%rax,%rdx), %r8	# 16185	[c=4 l=4]  *leadi
+	leaq	101(%rbx), %rdx	# 12292	[c=4 l=4]  *leadi
+.L1263:
+	movl	(%rbx), %edi	# 9069	[c=6 l=2]  *zero_extendsidi2/3
+	movb	%cl, 100(%rbx)	# 9067	[c=4 l=3]  *movqi_internal/8
+	movq	%r8, 104(%rbx)	# 9066	[c=4 l=4]  *movdi_internal/5
+	movq	1040(%rbx), %r14	# 14602	[c=9 l=7]  *movdi_internal/3
+	movq	%rdi, %rsi	# 16835	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdi	# 9071	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %rdi	# 9072	[c=13 l=7]  *adddi_1/1
+	leal	1(%rsi), %r15d	# 16172	[c=5 l=4]  *leadi
+	movl	%esi, 16(%rsp)	# 15675	[c=4 l=4]  *movsi_internal/1
+	movl	%r15d, (%rbx)	# 9074	[c=4 l=3]  *movsi_internal/1
+	movzbl	10(%rdi), %esi	# 9076	[c=13 l=4]  zero_extendqidi2/0
+	salq	$4, %r15	# 9121	[c=4 l=4]  *ashldi3_1/0
+	movzwl	12(%rdi), %edi	# 9079	[c=13 l=4]  zero_extendhidi2/0
+	movzbl	(%r8), %r8d	# 9083	[c=5 l=4]  *movqi_internal/4
+	movzbl	63(%r14), %r14d	# 9084	[c=13 l=5]  *zero_extendqisi2/0
+	movzbl	1004(%rbx,%rsi), %esi	# 9077	[c=14 l=8]  *zero_extendqisi2/0
+	movzbl	1004(%rbx,%rdi), %r9d	# 9080	[c=14 l=9]  *zero_extendqisi2/0
+	movzbl	%cl, %edi	# 9082	[c=4 l=3]  *zero_extendqisi2/0
+	andl	%r8d, %ecx	# 16173	[c=4 l=3]  *andsi_1/0
+	movq	%rdx, 104(%rbx)	# 9119	[c=4 l=4]  *movdi_internal/5
+	movl	%edi, %r13d	# 14603	[c=4 l=3]  *movsi_internal/0
+	movzbl	%cl, %ecx	# 9088	[c=4 l=3]  *zero_extendqisi2/0
+	andl	$-64, %edi	# 9096	[c=4 l=3]  *andsi_1/0
+	notl	%r13d	# 9085	[c=4 l=3]  *one_cmplsi2_1/0
+	andl	%edi, %r8d	# 16174	[c=4 l=3]  *andsi_1/0
+	orl	$63, %edi	# 16176	[c=4 l=3]  *iorsi_1/0
+	andl	%r14d, %r13d	# 9086	[c=4 l=3]  *andsi_1/0
+	movl	%esi, %r14d	# 14605	[c=4 l=3]  *movsi_internal/0
+	subl	%r9d, %esi	# 9101	[c=4 l=3]  *subsi_1/0
+	movb	%dil, 100(%rbx)	# 9117	[c=4 l=4]  *movqi_internal/8
+	orl	%r13d, %ecx	# 9089	[c=4 l=3]  *iorsi_1/0
+	movl	%r9d, %r13d	# 14607	[c=4 l=3]  *movsi_internal/0
+	andl	$136, %r14d	# 9091	[c=4 l=7]  *andsi_1/0
+	andl	$136, %r13d	# 9094	[c=4 l=7]  *andsi_1/0
+	movl	%ecx, %r9d	# 14609	[c=4 l=3]  *movsi_internal/0
+	orl	$-3, %ecx	# 9110	[c=4 l=3]  *iorsi_1/0
+	leal	0(%r13,%r14,2), %r13d	# 9095	[c=8 l=5]  *leasi
+	andl	$1, %r9d	# 9102	[c=4 l=4]  *andsi_1/0
+	imull	$260, %r13d, %r13d	# 9105	[c=12 l=7]  *mulsi3_1/1
+	subl	%r9d, %esi	# 9103	[c=4 l=3]  *subsi_1/0
+	movzbl	%dil, %r9d	# 9131	[c=4 l=4]  *zero_extendqisi2/0
+	andl	$511, %esi	# 9104	[c=4 l=6]  *andsi_1/0
+	andl	$7680, %r13d	# 9106	[c=4 l=7]  *andsi_1/0
+	orl	%r13d, %esi	# 9107	[c=5 l=3]  *iorsi_1_zext
+	andb	(%rax,%rsi), %cl	# 9111	[c=13 l=3]  *andqi_1/1
+	movl	16(%rsp), %esi	# 14613	[c=9 l=4]  *movsi_internal/0
+	orl	%r8d, %ecx	# 16175	[c=4 l=3]  *iorsi_1/0
+	movq	1064(%rbx), %r8	# 18208	[c=9 l=7]  *movdi_internal/3
+	movb	%cl, 101(%rbx)	# 9114	[c=4 l=3]  *movqi_internal/8
+	andl	%ecx, %edi	# 16178	[c=4 l=2]  *andsi_1/0
+	addq	%r15, %r8	# 18209	[c=4 l=3]  *adddi_1/0
+	leal	2(%rsi), %r15d	# 16177	[c=5 l=4]  *leadi
+	movzbl	%dil, %edi	# 9136	[c=4 l=4]  *zero_extendqisi2/0
+	movl	%r15d, (%rbx)	# 9124	[c=4 l=3]  *movsi_internal/1
+	movzbl	10(%r8), %esi	# 9126	[c=13 l=5]  zero_extendqidi2/0
+	movzwl	12(%r8), %r8d	# 9129	[c=13 l=5]  zero_extendhidi2/0
+	movzbl	1004(%rbx,%rsi), %esi	# 9127	[c=14 l=8]  *zero_extendqisi2/0
+	movzbl	1004(%rbx,%r8), %r13d	# 9130	[c=14 l=9]  *zero_extendqisi2/0
+	movq	1040(%rbx), %r8	# 14614	[c=9 l=7]  *movdi_internal/3
+	movzbl	63(%r8), %r14d	# 9132	[c=13 l=5]  *zero_extendqisi2/0
+	movl	%r9d, %r8d	# 14615	[c=4 l=3]  *movsi_internal/0
+	andl	$-64, %r9d	# 9144	[c=4 l=4]  *andsi_1/0
+	notl	%r8d	# 9133	[c=4 l=3]  *one_cmplsi2_1/0
+	andl	%r14d, %r8d	# 9134	[c=4 l=3]  *andsi_1/0
+	movl	%esi, %r14d	# 14617	[c=4 l=3]  *movsi_internal/0
+	subl	%r13d, %esi	# 9149	[c=4 l=3]  *subsi_1/0
+	orl	%r8d, %edi	# 9137	[c=4 l=3]  *iorsi_1/0
+	movl	%r13d, %r8d	# 14619	[c=4 l=3]  *movsi_internal/0
+	andl	$136, %r14d	# 9139	[c=4 l=7]  *andsi_1/0
+	movl	%edi, %r13d	# 14621	[c=4 l=3]  *movsi_internal/0
+	andl	$136, %r8d	# 9142	[c=4 l=7]  *andsi_1/0
+	andl	$1, %r13d	# 9150	[c=4 l=4]  *andsi_1/0
+	leal	(%r8,%r14,2), %r8d	# 9143	[c=8 l=4]  *leasi
+	subl	%r13d, %esi	# 9151	[c=4 l=3]  *subsi_1/0
+	andl	$511, %esi	# 9152	[c=4 l=6]  *andsi_1/0
+	imull	$260, %r8d, %r8d	# 9153	[c=12 l=7]  *mulsi3_1/1
+	orl	$-3, %edi	# 9158	[c=4 l=3]  *iorsi_1/0
+	andl	%r9d, %ecx	# 16179	[c=4 l=3]  *andsi_1/0
+	orl	$63, %r9d	# 16181	[c=4 l=4]  *iorsi_1/0
+	salq	$4, %r15	# 9166	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 9167	[c=13 l=7]  *adddi_1/1
+	movb	%r9b, 100(%rbx)	# 9164	[c=4 l=4]  *movqi_internal/8
+	andl	$7680, %r8d	# 9154	[c=4 l=7]  *andsi_1/0
+	orl	%r8d, %esi	# 9155	[c=5 l=3]  *iorsi_1_zext
+	andb	(%rax,%rsi), %dil	# 9159	[c=13 l=4]  *andqi_1/1
+	movl	16(%rsp), %esi	# 14623	[c=9 l=4]  *movsi_internal/0
+	orl	%ecx, %edi	# 16180	[c=4 l=2]  *iorsi_1/0
+	leal	3(%rsi), %ecx	# 16182	[c=4 l=3]  *leasi
+	movb	%dil, 101(%rbx)	# 9162	[c=4 l=4]  *movqi_internal/8
+	movl	%ecx, (%rbx)	# 9169	[c=4 l=2]  *movsi_internal/1
+	jmp	.L726	# 18595	[c=1 l=5]  jump
+.L1255:
+	movzbl	10(%r15), %eax	# 8816	[c=13 l=5]  zero_extendqidi2/0
+	movzwl	12(%r15), %esi	# 8814	[c=9 l=5]  *movhi_internal/2
+	movzbl	1004(%rbx,%rax), %eax	# 8817	[c=10 l=8]  *movqi_internal/4
+	jmp	.L1591	# 18597	[c=1 l=5]  jump
+.L1268:
+	movq	104(%rbx), %rsi	# 9263	[c=9 l=4]  *movdi_internal/3
+	orl	$63, %ecx	# 16167	[c=4 l=3]  *iorsi_1/0
+	andb	(%rsi), %al	# 9264	[c=9 l=2]  *andqi_1/1
+	movl	%eax, %esi	# 14635	[c=4 l=2]  *movqi_internal/1
+	leaq	flag_update_table_sub8(%rip), %rax	# 9265	[c=1 l=7]  *movdi_internal/4
+	orb	(%rax,%rdx), %sil	# 9269	[c=13 l=4]  *iorqi_1/1
+	leaq	101(%rbx), %rax	# 16168	[c=4 l=4]  *leadi
+	movb	%sil, 101(%rbx)	# 9270	[c=4 l=4]  *movqi_internal/8
+	jmp	.L1269	# 18599	[c=1 l=5]  jump
+.L798:
+	cmpl	$4, %eax	# 2667	[c=4 l=3]  *cmpsi_1/0
+	jne	.L801	# 2668	[c=13 l=6]  *jcc
+	movl	%ecx, %edx	# 2703	[c=1 l=2]  *zero_extendsidi2/3
+	movl	$255, %esi	# 2705	[c=4 l=5]  *movsi_internal/0
+	movq	%r15, %rdi	# 2706	[c=4 l=3]  *movdi_internal/3
+	movl	%ecx, 32(%rsp)	# 15126	[c=4 l=4]  *movsi_internal/1
+	movq	%rdx, 16(%rsp)	# 15124	[c=4 l=5]  *movdi_internal/5
+	call	memset@PLT	# 2707	[c=10 l=5]  *call_value
+	movq	16(%rsp), %rdx	# 15125	[c=9 l=5]  *movdi_internal/3
+	movl	32(%rsp), %ecx	# 15127	[c=9 l=4]  *movsi_internal/0
+.L797:
+	xorl	%eax, %eax	# 18337	[c=4 l=2]  *movdi_xor
+	testl	%ecx, %ecx	# 2733	[c=4 l=2]  *cmpsi_ccno_1/0
+	je	.L804	# 2734	[c=13 l=2]  *jcc
+.L803:
+	movzbl	6052(%rbx,%rax), %esi	# 2711	[c=10 l=8]  *movqi_internal/4
+	andb	%sil, (%r15,%rax)	# 2712	[c=13 l=4]  *andqi_1/0
+	addq	$1, %rax	# 2713	[c=4 l=4]  *adddi_1/0
+	cmpl	%ecx, %eax	# 2715	[c=4 l=2]  *cmpsi_1/0
+	jb	.L803	# 2716	[c=13 l=2]  *jcc
+.L804:
+	movl	%ecx, 16(%rsp)	# 15132	[c=4 l=4]  *movsi_internal/1
+	movq	24(%rsp), %rdi	# 2722	[c=9 l=5]  *movdi_internal/3
+	movl	$255, %esi	# 2721	[c=4 l=5]  *movsi_internal/0
+	jmp	.L1570	# 18601	[c=1 l=5]  jump
+.L1088:
+	cmpl	$4, %eax	# 6382	[c=4 l=3]  *cmpsi_1/0
+	jne	.L1091	# 6383	[c=13 l=6]  *jcc
+	movl	%r14d, %edx	# 6418	[c=1 l=3]  *zero_extendsidi2/3
+	movl	$255, %esi	# 6420	[c=4 l=5]  *movsi_internal/0
+	movq	%r15, %rdi	# 6421	[c=4 l=3]  *movdi_internal/3
+	movq	%rdx, 16(%rsp)	# 15514	[c=4 l=5]  *movdi_internal/5
+	call	memset@PLT	# 6422	[c=10 l=5]  *call_value
+	movq	16(%rsp), %rdx	# 15515	[c=9 l=5]  *movdi_internal/3
+.L1087:
+	xorl	%eax, %eax	# 18236	[c=4 l=2]  *movdi_xor
+	testl	%r14d, %r14d	# 6448	[c=4 l=3]  *cmpsi_ccno_1/0
+	je	.L1094	# 6449	[c=13 l=2]  *jcc
+.L1093:
+	movzbl	6052(%rbx,%rax), %ecx	# 6426	[c=10 l=8]  *movqi_internal/4
+	andb	%cl, (%r15,%rax)	# 6427	[c=13 l=4]  *andqi_1/0
+	addq	$1, %rax	# 6428	[c=4 l=4]  *adddi_1/0
+	cmpl	%r14d, %eax	# 6430	[c=4 l=3]  *cmpsi_1/0
+	jb	.L1093	# 6431	[c=13 l=2]  *jcc
+.L1094:
+	movq	24(%rsp), %rdi	# 6437	[c=9 l=5]  *movdi_internal/3
+	movl	$255, %esi	# 6436	[c=4 l=5]  *movsi_internal/0
+	jmp	.L1571	# 18603	[c=1 l=5]  jump
+.L680:
+	xorl	%eax, %eax	# 18380	[c=4 l=2]  *movsi_xor
+	leaq	.LC51(%rip), %rdx	# 612	[c=1 l=7]  *movdi_internal/4
+	movl	$2, %esi	# 614	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 615	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, 96(%rbx)	# 18381	[c=4 l=3]  *movsi_internal/1
+	xorl	%eax, %eax	# 18382	[c=4 l=2]  *movdi_xor
+	call	leave	# 617	[c=0 l=5]  *call
+.L1748:
+	movl	$50651151, %eax	# 249	[c=4 l=5]  *movdi_internal/2
+	shrq	%cl, %rax	# 250	[c=4 l=3]  *lshrdi3_1/0
+	testb	$1, %al	# 16412	[c=4 l=2]  *testqi_1_maybe_si/1
+	je	.L628	# 253	[c=13 l=6]  *jcc
+	jmp	.L619	# 18606	[c=1 l=5]  jump
+.L1732:
+	xorl	%r8d, %r8d	# 18227	[c=4 l=3]  *movdi_xor
+	movl	$1, %ecx	# 6876	[c=4 l=5]  *movsi_internal/0
+	movl	$26, %edx	# 6877	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 6879	[c=4 l=3]  *movdi_internal/3
+	movl	$1, %r9d	# 6874	[c=4 l=6]  *movsi_internal/0
+	call	ramp_indirect	# 6880	[c=0 l=5]  *call
+	leaq	flag_update_table_add8(%rip), %r10	# 15577	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_sub8(%rip), %r11	# 15579	[c=1 l=7]  *movdi_internal/4
+	jmp	.L1134	# 18608	[c=1 l=5]  jump
+.L651:
+	movzbl	1028(%rbx), %ecx	# 463	[c=13 l=7]  *zero_extendqisi2/0
+	movl	1024(%rbx), %esi	# 465	[c=10 l=6]  *zero_extendsidi2/3
+	testb	%cl, %cl	# 468	[c=4 l=2]  *cmpqi_ccno_1/0
+	jle	.L652	# 469	[c=13 l=6]  *jcc
+	cmpl	$8193, 880(%rbx)	# 12579	[c=13 l=10]  *cmpsi_1/0
+	sbbl	%eax, %eax	# 12580	[c=8 l=2]  *x86_movsicc_0_m1
+	addl	$2, %eax	# 12581	[c=4 l=3]  *addsi_1/0
+	imull	%ecx, %eax	# 479	[c=12 l=3]  *mulsi3_1/2
+	cmpl	%eax, 992(%rbx)	# 480	[c=13 l=6]  *cmpsi_1/0
+	jb	.L652	# 481	[c=13 l=6]  *jcc
+	movq	irq_raise@GOTPCREL(%rip), %rdx	# 500	[c=5 l=7]  *movdi_internal/3
+	addq	48(%rbx), %rsi	# 496	[c=13 l=4]  *adddi_1/1
+	movq	%rbx, %rdi	# 502	[c=4 l=3]  *movdi_internal/3
+	call	event_schedule@PLT	# 503	[c=0 l=5]  *call
+	leaq	flag_update_table_add8(%rip), %r10	# 14947	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_sub8(%rip), %r11	# 14949	[c=1 l=7]  *movdi_internal/4
+.L644:
+	movq	(%rsp), %rax	# 13838	[c=5 l=4]  *movdi_internal/3
+	subq	$1, %rax	# 607	[c=4 l=4]  *adddi_1/0
+	cmpq	%rbp, %rax	# 608	[c=4 l=3]  *cmpdi_1/0
+	jb	.L680	# 609	[c=13 l=6]  *jcc
+	movq	56(%rbx), %rax	# 13839	[c=9 l=4]  *movdi_internal/3
+	cmpq	%rax, 48(%rbx)	# 622	[c=13 l=4]  *cmpdi_1/0
+	jnb	.L1826	# 623	[c=13 l=6]  *jcc
+.L658:
+	movl	(%rbx), %r15d	# 630	[c=6 l=3]  *zero_extendsidi2/3
+	movl	$1, 96(%rbx)	# 635	[c=4 l=7]  *movsi_internal/1
+	movq	%r10, %rcx	# 18126	[c=4 l=3]  *movdi_internal/3
+	movq	%r15, %rdx	# 16661	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 632	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 634	[c=13 l=7]  *adddi_1/1
+	movzbl	11(%r15), %eax	# 636	[c=13 l=5]  zero_extendqidi2/0
+	movq	(%r15), %r14	# 644	[c=5 l=3]  *movdi_internal/3
+	addq	%rax, %rbp	# 637	[c=4 l=3]  *adddi_1/0
+	movzwl	14(%r15), %eax	# 639	[c=13 l=5]  zero_extendhidi2/0
+	addq	%rax, 48(%rbx)	# 640	[c=13 l=4]  *adddi_1/0
+	movq	%rbp, 40(%rbx)	# 638	[c=4 l=4]  *movdi_internal/5
+	movzbl	9(%r15), %eax	# 641	[c=13 l=5]  *zero_extendqisi2/0
+	addl	%edx, %eax	# 642	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 18127	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 643	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 18128	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 18129	[c=4 l=3]  *indirect_jump
+.L1136:
+	movzbl	%cl, %edx	# 6907	[c=4 l=3]  *zero_extendqisi2/0
+	movl	%r13d, %esi	# 6909	[c=4 l=3]  *movsi_internal/0
+	movq	%rbx, %rdi	# 6910	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 6911	[c=0 l=5]  *call
+	leaq	flag_update_table_sub8(%rip), %r11	# 15583	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 15581	[c=1 l=7]  *movdi_internal/4
+	jmp	.L1137	# 18611	[c=1 l=5]  jump
+.L1364:
+	movq	104(%rbx), %r8	# 10850	[c=9 l=4]  *movdi_internal/3
+	orl	$63, %edi	# 16097	[c=4 l=3]  *iorsi_1/0
+	andb	(%r8), %al	# 10851	[c=9 l=3]  *andqi_1/1
+	movl	%eax, %r8d	# 14811	[c=4 l=3]  *movqi_internal/2
+	leaq	flag_update_table_sub8(%rip), %rax	# 10852	[c=1 l=7]  *movdi_internal/4
+	orb	(%rax,%rdx), %r8b	# 10856	[c=13 l=4]  *iorqi_1/1
+	leaq	101(%rbx), %rdx	# 16098	[c=4 l=4]  *leadi
+	movb	%r8b, 101(%rbx)	# 10857	[c=4 l=4]  *movqi_internal/8
+	movq	%rdx, %r8	# 12372	[c=4 l=3]  *movdi_internal/3
+	jmp	.L1365	# 18613	[c=1 l=5]  jump
+.L1226:
+	movq	104(%rbx), %rsi	# 8098	[c=9 l=4]  *movdi_internal/3
+	andb	(%rsi), %al	# 8099	[c=9 l=2]  *andqi_1/1
+	movl	%eax, %esi	# 14432	[c=4 l=2]  *movqi_internal/1
+	leaq	flag_update_table_sub8(%rip), %rax	# 8100	[c=1 l=7]  *movdi_internal/4
+	orb	(%rax,%rdx), %sil	# 8104	[c=13 l=4]  *iorqi_1/1
+	leaq	101(%rbx), %rdx	# 16246	[c=4 l=4]  *leadi
+	movb	%sil, 101(%rbx)	# 8105	[c=4 l=4]  *movqi_internal/8
+	movl	%ecx, %esi	# 14435	[c=4 l=2]  *movqi_internal/1
+	movq	%rdx, %rcx	# 12375	[c=4 l=3]  *movdi_internal/3
+	orl	$63, %esi	# 16245	[c=4 l=3]  *iorsi_1/0
+	jmp	.L1227	# 18615	[c=1 l=5]  jump
+.L1259:
+	movq	104(%rbx), %rcx	# 8948	[c=9 l=4]  *movdi_internal/3
+	orl	$63, %edi	# 16191	[c=4 l=3]  *iorsi_1/0
+	andb	(%rcx), %al	# 8949	[c=9 l=2]  *andqi_1/1
+	movl	%eax, %ecx	# 14575	[c=4 l=2]  *movqi_internal/0
+	leaq	flag_update_table_sub8(%rip), %rax	# 8950	[c=1 l=7]  *movdi_internal/4
+	orb	(%rax,%rdx), %cl	# 8954	[c=13 l=3]  *iorqi_1/1
+	leaq	101(%rbx), %rdx	# 16192	[c=4 l=4]  *leadi
+	movb	%cl, 101(%rbx)	# 8955	[c=4 l=3]  *movqi_internal/8
+	movq	%rdx, %rsi	# 12367	[c=4 l=3]  *movdi_internal/3
+	jmp	.L1260	# 18617	[c=1 l=5]  jump
+.L1241:
+	movq	104(%rbx), %rsi	# 8493	[c=9 l=4]  *movdi_internal/3
+	orl	$63, %ecx	# 16222	[c=4 l=3]  *iorsi_1/0
+	andb	(%rsi), %al	# 8494	[c=9 l=2]  *andqi_1/1
+	movl	%eax, %esi	# 14498	[c=4 l=2]  *movqi_internal/1
+	leaq	flag_update_table_sub8(%rip), %rax	# 8495	[c=1 l=7]  *movdi_internal/4
+	orb	(%rax,%rdx), %sil	# 8499	[c=13 l=4]  *iorqi_1/1
+	leaq	101(%rbx), %rax	# 16223	[c=4 l=4]  *leadi
+	movb	%sil, 101(%rbx)	# 8500	[c=4 l=4]  *movqi_internal/8
+	jmp	.L1242	# 18619	[c=1 l=5]  jump
+.L1256:
+	movq	104(%rbx), %rcx	# 8844	[c=9 l=4]  *movdi_internal/3
+	orl	$63, %edi	# 16199	[c=4 l=3]  *iorsi_1/0
+	andb	(%rcx), %al	# 8845	[c=9 l=2]  *andqi_1/1
+	movl	%eax, %ecx	# 14554	[c=4 l=2]  *movqi_internal/0
+	leaq	flag_update_table_sub8(%rip), %rax	# 8846	[c=1 l=7]  *movdi_internal/4
+	orb	(%rax,%rdx), %cl	# 8850	[c=13 l=3]  *iorqi_1/1
+	leaq	101(%rbx), %rdx	# 16200	[c=4 l=4]  *leadi
+	movb	%cl, 101(%rbx)	# 8851	[c=4 l=3]  *movqi_internal/8
+	movq	%rdx, %rsi	# 12368	[c=4 l=3]  *movdi_internal/3
+	jmp	.L1257	# 18621	[c=1 l=5]  jump
+.L945:
+	movq	1040(%rbx), %rax	# 4591	[c=9 l=7]  *movdi_internal/3
+	movl	$62, %ecx	# 4593	[c=4 l=5]  *movsi_internal/0
+	subl	%r13d, %ecx	# 4594	[c=4 l=3]  *subsi_1/0
+	movzbl	61(%rax), %edx	# 4592	[c=13 l=4]  *zero_extendqisi2/0
+	cmpl	%r14d, %ecx	# 4595	[c=4 l=3]  *cmpsi_1/0
+	jb	.L947	# 4596	[c=13 l=6]  *jcc
+	cmpb	$1, 1081(%rbx)	# 4600	[c=13 l=7]  *cmpqi_1/0
+	jbe	.L947	# 4601	[c=13 l=6]  *jcc
+	jmp	.L948	# 18624	[c=1 l=5]  jump
+.L1742:
+	movzbl	%al, %edx	# 4664	[c=4 l=3]  *zero_extendqisi2/0
+	movl	$61, %esi	# 4666	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 4667	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, 16(%rsp)	# 15300	[c=4 l=4]  *movsi_internal/1
+	call	data_write_mapped	# 4668	[c=0 l=5]  *call
+	movl	16(%rsp), %eax	# 15301	[c=9 l=4]  *movsi_internal/0
+	leaq	flag_update_table_add8(%rip), %r10	# 15303	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_sub8(%rip), %r11	# 15305	[c=1 l=7]  *movdi_internal/4
+	jmp	.L955	# 18626	[c=1 l=5]  jump
+.L1743:
+	movzbl	%al, %edx	# 4688	[c=4 l=3]  *zero_extendqisi2/0
+	movl	$62, %esi	# 4690	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 4691	[c=4 l=3]  *movdi_internal/3
+	call	data_write_mapped	# 4692	[c=0 l=5]  *call
+	leaq	flag_update_table_add8(%rip), %r10	# 15307	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_sub8(%rip), %r11	# 15309	[c=1 l=7]  *movdi_internal/4
+	jmp	.L957	# 18628	[c=1 l=5]  jump
+.L1160:
+	movzbl	%cl, %edx	# 7151	[c=4 l=3]  *zero_extendqisi2/0
+	movl	%r13d, %esi	# 7153	[c=4 l=3]  *movsi_internal/0
+	movq	%rbx, %rdi	# 7154	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 7155	[c=0 l=5]  *call
+	leaq	flag_update_table_sub8(%rip), %r11	# 15615	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 15613	[c=1 l=7]  *movdi_internal/4
+	jmp	.L1161	# 18630	[c=1 l=5]  jump
+.L1390:
+	cmpb	$0, 48(%r13)	# 11324	[c=13 l=5]  *cmpqi_ccno_1/1
+	jne	.L1391	# 11325	[c=13 l=6]  *jcc
+	cmpb	$0, 844(%rbx)	# 11327	[c=13 l=7]  *cmpqi_ccno_1/1
+	je	.L1392	# 11328	[c=13 l=2]  *jcc
+	movzbl	57(%rdx), %eax	# 11330	[c=9 l=4]  *movqi_internal/4
+	orb	58(%rdx), %al	# 11331	[c=13 l=3]  *iorqi_1/1
+	orb	59(%rdx), %al	# 11333	[c=13 l=3]  *iorqi_3
+	jne	.L1391	# 11334	[c=13 l=6]  *jcc
+.L1392:
+	leaq	112(%rsp), %r14	# 16072	[c=4 l=5]  *leadi
+	movq	%r8, 16(%rsp)	# 15844	[c=4 l=5]  *movdi_internal/5
+	movq	%r14, 32(%rsp)	# 15843	[c=4 l=5]  *movdi_internal/5
+	movq	%r14, %rdi	# 11339	[c=4 l=3]  *movdi_internal/3
+	call	*8(%r13)	# 11340	[c=18 l=4]  *call_value
+	leaq	flag_update_table_add8(%rip), %r10	# 15847	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_sub8(%rip), %r11	# 15849	[c=1 l=7]  *movdi_internal/4
+	testb	%al, %al	# 11342	[c=4 l=2]  *cmpqi_ccno_1/0
+	je	.L1391	# 11343	[c=13 l=6]  *jcc
+	cmpl	$0, 600(%rbx)	# 11345	[c=13 l=7]  *cmpsi_ccno_1/1
+	movq	16(%rsp), %r8	# 15845	[c=9 l=5]  *movdi_internal/3
+	jne	.L1393	# 11346	[c=13 l=6]  *jcc
+	leaq	100(%rsp), %rcx	# 16070	[c=4 l=5]  *leadi
+	leaq	96(%rsp), %rdx	# 16071	[c=4 l=5]  *leadi
+	movq	%r14, %rsi	# 11353	[c=4 l=3]  *movdi_internal/3
+	movq	%r13, %rdi	# 11354	[c=4 l=3]  *movdi_internal/3
+	call	hle_cost@PLT	# 11355	[c=10 l=5]  *call_value
+	movq	16(%rsp), %r8	# 15837	[c=9 l=5]  *movdi_internal/3
+	leaq	flag_update_table_add8(%rip), %r10	# 15839	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_sub8(%rip), %r11	# 15841	[c=1 l=7]  *movdi_internal/4
+	testb	%al, %al	# 11357	[c=4 l=2]  *cmpqi_ccno_1/0
+	je	.L1393	# 11358	[c=13 l=6]  *jcc
+	movq	(%rsp), %rdi	# 15835	[c=5 l=4]  *movdi_internal/3
+	testq	%rdi, %rdi	# 11360	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L1394	# 11361	[c=13 l=2]  *jcc
+	movl	96(%rsp), %eax	# 11363	[c=10 l=4]  *zero_extendsidi2/3
+	movzbl	11(%r15), %edx	# 11365	[c=13 l=5]  zero_extendqidi2/0
+	addq	%rbp, %rax	# 11364	[c=4 l=3]  *adddi_1/0
+	subq	%rdx, %rax	# 11366	[c=4 l=3]  *subdi_1/0
+	cmpq	%rdi, %rax	# 11367	[c=4 l=3]  *cmpdi_1/0
+	jnb	.L1393	# 11368	[c=13 l=6]  *jcc
+.L1394:
+	movzwl	14(%r15), %edx	# 11374	[c=13 l=5]  zero_extendhidi2/0
+	movl	100(%rsp), %eax	# 11371	[c=10 l=4]  *zero_extendsidi2/3
+	addq	48(%rbx), %rax	# 11373	[c=13 l=4]  *adddi_1/1
+	subq	%rdx, %rax	# 11375	[c=4 l=3]  *subdi_1/0
+	cmpq	56(%rbx), %rax	# 11376	[c=13 l=4]  *cmpdi_1/1
+	jnb	.L1393	# 11377	[c=13 l=6]  *jcc
+	movq	32(%rsp), %rdi	# 11381	[c=9 l=5]  *movdi_internal/3
+	call	*16(%r13)	# 11382	[c=0 l=4]  *call
+	movq	1040(%rbx), %rax	# 11384	[c=9 l=7]  *movdi_internal/3
+	addl	$1, 108(%r13)	# 11383	[c=13 l=5]  *addsi_1/0
+	leaq	flag_update_table_add8(%rip), %r10	# 15852	[c=1 l=7]  *movdi_internal/4
+	movzbl	136(%rsp), %edx	# 11385	[c=9 l=8]  *movqi_internal/4
+	movl	96(%rsp), %r13d	# 11388	[c=10 l=5]  *zero_extendsidi2/3
+	leaq	flag_update_table_sub8(%rip), %r11	# 15854	[c=1 l=7]  *movdi_internal/4
+	movb	%dl, 63(%rax)	# 11386	[c=4 l=3]  *movqi_internal/8
+	addq	%rbp, %r13	# 11389	[c=4 l=3]  *adddi_1/0
+	movl	152(%rsp), %ebp	# 11400	[c=9 l=7]  *movsi_internal/0
+	movb	$0, 100(%rbx)	# 11387	[c=4 l=4]  *movqi_internal/8
+	movzbl	11(%r15), %eax	# 11390	[c=13 l=5]  zero_extendqidi2/0
+	movzwl	14(%r15), %edx	# 11396	[c=13 l=5]  zero_extendhidi2/0
+	movl	$2, 96(%rbx)	# 11399	[c=4 l=7]  *movsi_internal/1
+	subq	%rax, %r13	# 11391	[c=4 l=3]  *subdi_1/0
+	movl	100(%rsp), %eax	# 11393	[c=10 l=4]  *zero_extendsidi2/3
+	movq	%r13, 16(%rsp)	# 15850	[c=4 l=5]  *movdi_internal/5
+	subq	%rdx, %rax	# 11397	[c=4 l=3]  *subdi_1/0
+	addq	%rax, 48(%rbx)	# 11398	[c=13 l=4]  *adddi_1/0
+	cmpl	$-1, %ebp	# 11401	[c=4 l=3]  *cmpsi_1/0
+	movq	%r13, 40(%rbx)	# 11392	[c=4 l=4]  *movdi_internal/5
+	je	.L1827	# 11402	[c=13 l=6]  *jcc
+.L1395:
+	movl	%ebp, (%rbx)	# 11596	[c=4 l=2]  *movsi_internal/1
+	movq	56(%rbx), %rax	# 14888	[c=9 l=4]  *movdi_internal/3
+	cmpq	%rax, 48(%rbx)	# 11598	[c=13 l=4]  *cmpdi_1/0
+	jnb	.L1828	# 11599	[c=13 l=6]  *jcc
+.L1416:
+	movl	(%rbx), %r15d	# 11606	[c=6 l=3]  *zero_extendsidi2/3
+	movl	$1, 96(%rbx)	# 11611	[c=4 l=7]  *movsi_internal/1
+	movq	%r10, %rcx	# 17206	[c=4 l=3]  *movdi_internal/3
+	movq	16(%rsp), %rax	# 14889	[c=9 l=5]  *movdi_internal/3
+	movq	%r15, %rdx	# 16887	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 11608	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 11610	[c=13 l=7]  *adddi_1/1
+	movzbl	11(%r15), %ebp	# 11612	[c=13 l=5]  zero_extendqidi2/0
+	movq	(%r15), %r14	# 11620	[c=5 l=3]  *movdi_internal/3
+	addq	%rax, %rbp	# 11613	[c=4 l=3]  *adddi_1/0
+	movzwl	14(%r15), %eax	# 11615	[c=13 l=5]  zero_extendhidi2/0
+	addq	%rax, 48(%rbx)	# 11616	[c=13 l=4]  *adddi_1/0
+	movq	%rbp, 40(%rbx)	# 11614	[c=4 l=4]  *movdi_internal/5
+	movzbl	9(%r15), %eax	# 11617	[c=13 l=5]  *zero_extendqisi2/0
+	addl	%edx, %eax	# 11618	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 17207	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 11619	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 17208	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 17209	[c=4 l=3]  *indirect_jump
+.L1374:
+	leal	0(,%rsi,8), %ecx	# 16085	[c=12 l=7]  *leasi
+	movl	$1, %edi	# 11079	[c=4 l=5]  *movdi_internal/2
+	salq	%cl, %rdi	# 11080	[c=4 l=3]  *ashldi3_1/0
+	xorl	%ecx, %ecx	# 18163	[c=4 l=2]  *movdi_xor
+	subq	$1, %rdi	# 11081	[c=4 l=4]  *adddi_1/0
+	jmp	.L1377	# 18634	[c=1 l=5]  jump
+.L1794:
+	movq	1040(%rbx), %rax	# 7529	[c=9 l=7]  *movdi_internal/3
+	movzbl	59(%rax), %eax	# 7530	[c=13 l=4]  *zero_extendqisi2/0
+	sall	$16, %eax	# 7531	[c=4 l=3]  *ashlsi3_1/0
+	orl	%eax, %r13d	# 7532	[c=4 l=3]  *iorsi_1/0
+	testl	$16711680, %r13d	# 7534	[c=4 l=7]  *testsi_1/2
+	je	.L1182	# 7535	[c=13 l=6]  *jcc
+	movl	%r13d, %eax	# 14357	[c=4 l=3]  *movsi_internal/0
+	movq	1072(%rbx), %rdx	# 7568	[c=9 l=7]  *movdi_internal/3
+	sarl	$12, %eax	# 7566	[c=4 l=3]  *ashrsi3_1/0
+	cltq	# 7567	[c=4 l=2]  *extendsidi2_rex64/0
+	movq	(%rdx,%rax,8), %rax	# 7569	[c=10 l=4]  *movdi_internal/3
+	testq	%rax, %rax	# 7570	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L1451	# 7571	[c=13 l=6]  *jcc
+	movl	%r13d, %edx	# 14360	[c=4 l=3]  *movsi_internal/0
+	andl	$4095, %edx	# 13652	[c=5 l=6]  *andsi_1_zext
+	movzbl	(%rax,%rdx), %eax	# 7575	[c=9 l=4]  *movqi_internal/4
+.L1187:
+	movb	%al, 1004(%rbx,%r14)	# 7609	[c=4 l=8]  *movqi_internal/8
+	movl	%r15d, %edx	# 7610	[c=4 l=3]  *movsi_internal/0
+	movl	%r13d, %esi	# 7611	[c=4 l=3]  *movsi_internal/0
+	movq	%rbx, %rdi	# 7612	[c=4 l=3]  *movdi_internal/3
+	call	far_write	# 7613	[c=0 l=5]  *call
+	leaq	flag_update_table_sub8(%rip), %r11	# 15629	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 15627	[c=1 l=7]  *movdi_internal/4
+	jmp	.L1190	# 18636	[c=1 l=5]  jump
+.L1819:
+	movq	1040(%rbx), %rax	# 7749	[c=9 l=7]  *movdi_internal/3
+	movzbl	59(%rax), %eax	# 7750	[c=13 l=4]  *zero_extendqisi2/0
+	sall	$16, %eax	# 7751	[c=4 l=3]  *ashlsi3_1/0
+	orl	%eax, %r13d	# 7752	[c=4 l=3]  *iorsi_1/0
+	testl	$16711680, %r13d	# 7754	[c=4 l=7]  *testsi_1/2
+	je	.L1202	# 7755	[c=13 l=6]  *jcc
+	movl	%r13d, %eax	# 14389	[c=4 l=3]  *movsi_internal/0
+	movq	1072(%rbx), %rcx	# 7792	[c=9 l=7]  *movdi_internal/3
+	sarl	$12, %eax	# 7790	[c=4 l=3]  *ashrsi3_1/0
+	cltq	# 7791	[c=4 l=2]  *extendsidi2_rex64/0
+	movq	(%rcx,%rax,8), %rax	# 7793	[c=10 l=4]  *movdi_internal/3
+	testq	%rax, %rax	# 7794	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L1453	# 7795	[c=13 l=6]  *jcc
+	movl	%r13d, %ecx	# 14392	[c=4 l=3]  *movsi_internal/0
+	notl	%edx	# 7800	[c=4 l=2]  *one_cmplsi2_1/0
+	andl	$4095, %ecx	# 13646	[c=5 l=6]  *andsi_1_zext
+	movzbl	(%rax,%rcx), %ecx	# 7799	[c=13 l=4]  *zero_extendqisi2/0
+	movl	%ecx, %eax	# 16812	[c=4 l=2]  *movsi_internal/0
+	andl	%ecx, %edx	# 7802	[c=4 l=2]  *andsi_1/0
+.L1207:
+	movb	%al, 1004(%rbx,%r14)	# 7836	[c=4 l=8]  *movqi_internal/8
+	movl	%r13d, %esi	# 7838	[c=4 l=3]  *movsi_internal/0
+	movq	%rbx, %rdi	# 7839	[c=4 l=3]  *movdi_internal/3
+	call	far_write	# 7840	[c=0 l=5]  *call
+	leaq	flag_update_table_sub8(%rip), %r11	# 15653	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 15651	[c=1 l=7]  *movdi_internal/4
+	jmp	.L1210	# 18638	[c=1 l=5]  jump
+.L1820:
+	movq	1040(%rbx), %rdx	# 7864	[c=9 l=7]  *movdi_internal/3
+	movzbl	59(%rdx), %edx	# 7865	[c=13 l=4]  *zero_extendqisi2/0
+	sall	$16, %edx	# 7866	[c=4 l=3]  *ashlsi3_1/0
+	orl	%edx, %r13d	# 7867	[c=4 l=3]  *iorsi_1/0
+	testl	$16711680, %r13d	# 7869	[c=4 l=7]  *testsi_1/2
+	je	.L1212	# 7870	[c=13 l=6]  *jcc
+	movl	%r13d, %edx	# 14402	[c=4 l=3]  *movsi_internal/0
+	movq	1072(%rbx), %rcx	# 7906	[c=9 l=7]  *movdi_internal/3
+	sarl	$12, %edx	# 7904	[c=4 l=3]  *ashrsi3_1/0
+	movslq	%edx, %rdx	# 7905	[c=4 l=3]  *extendsidi2_rex64/1
+	movq	(%rcx,%rdx,8), %rdx	# 7907	[c=10 l=4]  *movdi_internal/3
+	testq	%rdx, %rdx	# 7908	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L1454	# 7909	[c=13 l=6]  *jcc
+	movl	%r13d, %ecx	# 14405	[c=4 l=3]  *movsi_internal/0
+	andl	$4095, %ecx	# 13643	[c=5 l=6]  *andsi_1_zext
+	movzbl	(%rdx,%rcx), %edx	# 7913	[c=9 l=4]  *movqi_internal/4
+	xorl	%edx, %eax	# 16251	[c=4 l=2]  *xorsi_1/0
+	movzbl	%al, %r15d	# 7915	[c=4 l=4]  *zero_extendqisi2/0
+.L1217:
+	movb	%dl, 1004(%rbx,%r14)	# 7949	[c=4 l=8]  *movqi_internal/8
+	movl	%r13d, %esi	# 7951	[c=4 l=3]  *movsi_internal/0
+	movl	%r15d, %edx	# 7950	[c=4 l=3]  *movsi_internal/0
+	movq	%rbx, %rdi	# 7952	[c=4 l=3]  *movdi_internal/3
+	call	far_write	# 7953	[c=0 l=5]  *call
+	leaq	flag_update_table_sub8(%rip), %r11	# 15665	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 15663	[c=1 l=7]  *movdi_internal/4
+	jmp	.L1220	# 18640	[c=1 l=5]  jump
+.L1821:
+	movq	1040(%rbx), %rdx	# 7637	[c=9 l=7]  *movdi_internal/3
+	movzbl	59(%rdx), %edx	# 7638	[c=13 l=4]  *zero_extendqisi2/0
+	sall	$16, %edx	# 7639	[c=4 l=3]  *ashlsi3_1/0
+	orl	%edx, %r13d	# 7640	[c=4 l=3]  *iorsi_1/0
+	testl	$16711680, %r13d	# 7642	[c=4 l=7]  *testsi_1/2
+	je	.L1192	# 7643	[c=13 l=6]  *jcc
+	movl	%r13d, %edx	# 14370	[c=4 l=3]  *movsi_internal/0
+	movq	1072(%rbx), %rcx	# 7679	[c=9 l=7]  *movdi_internal/3
+	sarl	$12, %edx	# 7677	[c=4 l=3]  *ashrsi3_1/0
+	movslq	%edx, %rdx	# 7678	[c=4 l=3]  *extendsidi2_rex64/1
+	movq	(%rcx,%rdx,8), %rdx	# 7680	[c=10 l=4]  *movdi_internal/3
+	testq	%rdx, %rdx	# 7681	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L1452	# 7682	[c=13 l=6]  *jcc
+	movl	%r13d, %ecx	# 14373	[c=4 l=3]  *movsi_internal/0
+	andl	$4095, %ecx	# 13649	[c=5 l=6]  *andsi_1_zext
+	movzbl	(%rdx,%rcx), %edx	# 7686	[c=9 l=4]  *movqi_internal/4
+	orl	%edx, %eax	# 16253	[c=4 l=2]  *iorsi_1/0
+	movzbl	%al, %r15d	# 7688	[c=4 l=4]  *zero_extendqisi2/0
+.L1197:
+	movb	%dl, 1004(%rbx,%r14)	# 7722	[c=4 l=8]  *movqi_internal/8
+	movl	%r13d, %esi	# 7724	[c=4 l=3]  *movsi_internal/0
+	movl	%r15d, %edx	# 7723	[c=4 l=3]  *movsi_internal/0
+	movq	%rbx, %rdi	# 7725	[c=4 l=3]  *movdi_internal/3
+	call	far_write	# 7726	[c=0 l=5]  *call
+	leaq	flag_update_table_sub8(%rip), %r11	# 15641	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 15639	[c=1 l=7]  *movdi_internal/4
+	jmp	.L1200	# 18642	[c=1 l=5]  jump
+.L952:
+	movzbl	%r15b, %edx	# 4647	[c=4 l=4]  *zero_extendqisi2/0
+	movq	%rbx, %rdi	# 4650	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, 16(%rsp)	# 15294	[c=4 l=4]  *movsi_internal/1
+	call	data_write_page	# 4651	[c=0 l=5]  *call
+	movl	16(%rsp), %eax	# 15295	[c=9 l=4]  *movsi_internal/0
+	leaq	flag_update_table_sub8(%rip), %r11	# 15299	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 15297	[c=1 l=7]  *movdi_internal/4
+	jmp	.L953	# 18644	[c=1 l=5]  jump
+.L1736:
+	xorl	%r8d, %r8d	# 18224	[c=4 l=3]  *movdi_xor
+	movl	$1, %ecx	# 6998	[c=4 l=5]  *movsi_internal/0
+	movl	$28, %edx	# 6999	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 7001	[c=4 l=3]  *movdi_internal/3
+	movl	$1, %r9d	# 6996	[c=4 l=6]  *movsi_internal/0
+	call	ramp_indirect	# 7002	[c=0 l=5]  *call
+	leaq	flag_update_table_add8(%rip), %r10	# 15593	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_sub8(%rip), %r11	# 15595	[c=1 l=7]  *movdi_internal/4
+	jmp	.L1146	# 18646	[c=1 l=5]  jump
+.L1778:
+	xorl	%r8d, %r8d	# 18168	[c=4 l=3]  *movdi_xor
+	movl	$1, %ecx	# 10770	[c=4 l=5]  *movsi_internal/0
+	movl	$26, %edx	# 10771	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 10773	[c=4 l=3]  *movdi_internal/3
+	movl	$1, %r9d	# 10768	[c=4 l=6]  *movsi_internal/0
+	call	ramp_indirect	# 10774	[c=0 l=5]  *call
+	leaq	flag_update_table_add8(%rip), %r10	# 15789	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_sub8(%rip), %r11	# 15791	[c=1 l=7]  *movdi_internal/4
+	jmp	.L1360	# 18648	[c=1 l=5]  jump
+.L1362:
+	movzbl	%cl, %edx	# 10801	[c=4 l=3]  *zero_extendqisi2/0
+	movl	%r13d, %esi	# 10803	[c=4 l=3]  *movsi_internal/0
+	movq	%rbx, %rdi	# 10804	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 10805	[c=0 l=5]  *call
+	leaq	flag_update_table_sub8(%rip), %r11	# 15795	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 15793	[c=1 l=7]  *movdi_internal/4
+	jmp	.L1363	# 18650	[c=1 l=5]  jump
+.L934:
+	movq	104(%rbx), %rsi	# 4426	[c=9 l=4]  *movdi_internal/3
+	movzbl	%al, %eax	# 4430	[c=4 l=3]  zero_extendqidi2/0
+	orl	$30, %edx	# 16302	[c=4 l=3]  *iorsi_1/0
+	andb	(%rsi), %cl	# 4427	[c=9 l=2]  *andqi_1/1
+	leaq	flag_update_table_logical(%rip), %rsi	# 13695	[c=1 l=7]  *movdi_internal/4
+	orb	(%rsi,%rax), %cl	# 4433	[c=13 l=3]  *iorqi_1/1
+	leaq	101(%rbx), %rax	# 16303	[c=4 l=4]  *leadi
+	movb	%cl, 101(%rbx)	# 4434	[c=4 l=3]  *movqi_internal/8
+	jmp	.L935	# 18652	[c=1 l=5]  jump
+.L959:
+	movq	1040(%rbx), %rax	# 4741	[c=9 l=7]  *movdi_internal/3
+	movl	$62, %esi	# 4743	[c=4 l=5]  *movsi_internal/0
+	subl	%r15d, %esi	# 4744	[c=4 l=3]  *subsi_1/0
+	movzbl	61(%rax), %ecx	# 4742	[c=13 l=4]  *zero_extendqisi2/0
+	cmpl	%edx, %esi	# 4745	[c=4 l=2]  *cmpsi_1/0
+	jb	.L961	# 4746	[c=13 l=6]  *jcc
+	cmpb	$1, 1081(%rbx)	# 4750	[c=13 l=7]  *cmpqi_1/0
+	jbe	.L961	# 4751	[c=13 l=6]  *jcc
+.L962:
+	movl	$62, %esi	# 4754	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 4755	[c=4 l=3]  *movdi_internal/3
+	movl	%ecx, 24(%rsp)	# 15318	[c=4 l=4]  *movsi_internal/1
+	movl	%edx, 16(%rsp)	# 15316	[c=4 l=4]  *movsi_internal/1
+	call	data_read_mapped	# 4756	[c=10 l=5]  *call_value
+	movl	16(%rsp), %edx	# 15317	[c=9 l=4]  *movsi_internal/0
+	movl	24(%rsp), %ecx	# 15319	[c=9 l=4]  *movsi_internal/0
+	leaq	flag_update_table_add8(%rip), %r10	# 15321	[c=1 l=7]  *movdi_internal/4
+	movl	%eax, %r14d	# 4757	[c=4 l=3]  *movsi_internal/0
+	leaq	flag_update_table_sub8(%rip), %r11	# 15323	[c=1 l=7]  *movdi_internal/4
+	jmp	.L963	# 18654	[c=1 l=5]  jump
+.L1385:
+	movq	10960(%rbx), %rax	# 11186	[c=9 l=7]  *movdi_internal/3
+	movl	%r13d, %r13d	# 11184	[c=1 l=3]  *zero_extendsidi2/3
+	movl	%r14d, %esi	# 11189	[c=4 l=3]  *movsi_internal/0
+	movq	%rbx, %rdi	# 11190	[c=4 l=3]  *movdi_internal/3
+	leaq	.L607(%rip), %r14	# 75	[c=1 l=7]  *movdi_internal/4
+	movq	8(%rax), %rax	# 11187	[c=9 l=4]  *movdi_internal/3
+	leaq	(%rax,%r13,8), %rdx	# 11188	[c=8 l=4]  *leadi
+	movq	%rdx, 16(%rsp)	# 15816	[c=4 l=5]  *movdi_internal/5
+	call	jit_compile@PLT	# 11191	[c=10 l=5]  *call_value
+	movq	16(%rsp), %rdx	# 15817	[c=9 l=5]  *movdi_internal/3
+	leaq	flag_update_table_add8(%rip), %r10	# 15819	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_sub8(%rip), %r11	# 15821	[c=1 l=7]  *movdi_internal/4
+	movq	%rax, (%rdx)	# 11193	[c=4 l=3]  *movdi_internal/5
+	movq	10960(%rbx), %rax	# 11194	[c=9 l=7]  *movdi_internal/3
+	movq	8(%rax), %rax	# 11195	[c=9 l=4]  *movdi_internal/3
+	cmpq	$0, (%rax,%r13,8)	# 11196	[c=14 l=5]  *cmpdi_ccno_1/1
+	je	.L1829	# 11197	[c=13 l=6]  *jcc
+.L1386:
+	movq	%r13, %rax	# 14856	[c=4 l=3]  *movdi_internal/3
+	movq	%r10, %rcx	# 17230	[c=4 l=3]  *movdi_internal/3
+	movq	%r12, %rdx	# 17231	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rax	# 11206	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %rax	# 11207	[c=13 l=7]  *adddi_1/1
+	movq	%r14, (%rax)	# 11208	[c=4 l=3]  *movdi_internal/5
+	movq	%r11, %rax	# 17232	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 17233	[c=4 l=3]  *indirect_jump
+.L1298:
+	movq	1040(%rbx), %rax	# 10103	[c=9 l=7]  *movdi_internal/3
+	movl	$62, %ecx	# 10105	[c=4 l=5]  *movsi_internal/0
+	subl	%r13d, %ecx	# 10106	[c=4 l=3]  *subsi_1/0
+	movzbl	61(%rax), %r15d	# 10104	[c=13 l=5]  *zero_extendqisi2/0
+	cmpl	%r14d, %ecx	# 10107	[c=4 l=3]  *cmpsi_1/0
+	jb	.L1300	# 10108	[c=13 l=6]  *jcc
+	cmpb	$1, 1081(%rbx)	# 10112	[c=13 l=7]  *cmpqi_1/0
+	jbe	.L1300	# 10113	[c=13 l=6]  *jcc
+.L1301:
+	movl	$62, %esi	# 10116	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 10117	[c=4 l=3]  *movdi_internal/3
+	movb	%dl, 16(%rsp)	# 15710	[c=4 l=4]  *movqi_internal/8
+	call	data_read_mapped	# 10118	[c=10 l=5]  *call_value
+	movzbl	16(%rsp), %edx	# 15711	[c=13 l=5]  *zero_extendqisi2/0
+	leaq	flag_update_table_add8(%rip), %r10	# 15713	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_sub8(%rip), %r11	# 15715	[c=1 l=7]  *movdi_internal/4
+	jmp	.L1302	# 18657	[c=1 l=5]  jump
+.L1286:
+	andb	(%rax), %dl	# 9831	[c=9 l=2]  *andqi_1/1
+	orb	(%rcx,%r9), %dl	# 9836	[c=13 l=4]  *iorqi_1/1
+	leaq	101(%rbx), %rax	# 16124	[c=4 l=4]  *leadi
+	orl	$63, %esi	# 16123	[c=4 l=3]  *iorsi_1/0
+	movb	%dl, 101(%rbx)	# 9837	[c=4 l=3]  *movqi_internal/8
+	jmp	.L1287	# 18659	[c=1 l=5]  jump
+.L1284:
+	movq	104(%rbx), %rcx	# 9769	[c=9 l=4]  *movdi_internal/3
+	orl	$63, %esi	# 16127	[c=4 l=3]  *iorsi_1/0
+	andb	(%rcx), %dl	# 9770	[c=9 l=2]  *andqi_1/1
+	leaq	flag_update_table_add8(%rip), %rcx	# 9771	[c=1 l=7]  *movdi_internal/4
+	orb	(%rcx,%rax), %dl	# 9775	[c=13 l=3]  *iorqi_1/1
+	leaq	101(%rbx), %rax	# 16128	[c=4 l=4]  *leadi
+	movb	%dl, 101(%rbx)	# 9776	[c=4 l=3]  *movqi_internal/8
+	jmp	.L1285	# 18661	[c=1 l=5]  jump
+.L1796:
+	movq	1040(%rbx), %rcx	# 6623	[c=9 l=7]  *movdi_internal/3
+	movzbl	1004(%rbx,%rax), %edi	# 6628	[c=14 l=8]  *zero_extendqisi2/0
+	movzbl	56(%rcx), %edx	# 6624	[c=13 l=4]  *zero_extendqisi2/0
+	movl	%edi, %eax	# 16781	[c=4 l=2]  *movsi_internal/0
+	sall	$16, %edx	# 6625	[c=4 l=3]  *ashlsi3_1/0
+	orl	%edx, %esi	# 6626	[c=4 l=2]  *iorsi_1/0
+	testl	%edx, %edx	# 6631	[c=4 l=2]  *cmpsi_ccno_1/0
+	jne	.L1110	# 6632	[c=13 l=6]  *jcc
+	movl	%esi, %edx	# 14275	[c=4 l=2]  *movsi_internal/0
+	subl	5176(%rbx), %edx	# 6634	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %edx	# 6635	[c=13 l=6]  *cmpsi_1/1
+	jb	.L1111	# 6636	[c=13 l=2]  *jcc
+	movl	%esi, %edx	# 14277	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %edx	# 6638	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %edx	# 13657	[c=5 l=6]  *andsi_1_zext
+	cmpb	$0, 1080(%rbx,%rdx)	# 6641	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L1112	# 6642	[c=13 l=6]  *jcc
+.L1111:
+	movslq	%esi, %rsi	# 6645	[c=4 l=3]  *extendsidi2_rex64/1
+	movb	%al, (%rcx,%rsi)	# 6646	[c=4 l=3]  *movqi_internal/8
+	jmp	.L1113	# 18663	[c=1 l=5]  jump
+.L930:
+	movq	104(%rbx), %rsi	# 4365	[c=9 l=4]  *movdi_internal/3
+	orl	$63, %ecx	# 16304	[c=4 l=3]  *iorsi_1/0
+	andb	(%rsi), %al	# 4366	[c=9 l=2]  *andqi_1/1
+	movl	%eax, %esi	# 14115	[c=4 l=2]  *movqi_internal/1
+	leaq	flag_update_table_sub8(%rip), %rax	# 4367	[c=1 l=7]  *movdi_internal/4
+	orb	(%rax,%rdx), %sil	# 4371	[c=13 l=4]  *iorqi_1/1
+	leaq	101(%rbx), %rax	# 16305	[c=4 l=4]  *leadi
+	movb	%sil, 101(%rbx)	# 4372	[c=4 l=4]  *movqi_internal/8
+	jmp	.L931	# 18665	[c=1 l=5]  jump
+.L737:
+	movq	104(%rbx), %rsi	# 1969	[c=9 l=4]  *movdi_internal/3
+	orl	$30, %edx	# 16356	[c=4 l=3]  *iorsi_1/0
+	andb	(%rsi), %cl	# 1970	[c=9 l=2]  *andqi_1/1
+	leaq	flag_update_table_dec(%rip), %rsi	# 13691	[c=1 l=7]  *movdi_internal/4
+	orb	(%rsi,%rax), %cl	# 1975	[c=13 l=3]  *iorqi_1/1
+	leaq	101(%rbx), %rax	# 16357	[c=4 l=4]  *leadi
+	movb	%cl, 101(%rbx)	# 1976	[c=4 l=3]  *movqi_internal/8
+	jmp	.L738	# 18667	[c=1 l=5]  jump
+.L1244:
+	movq	104(%rbx), %rsi	# 8534	[c=9 l=4]  *movdi_internal/3
+	orl	$30, %edx	# 16220	[c=4 l=3]  *iorsi_1/0
+	andb	(%rsi), %cl	# 8535	[c=9 l=2]  *andqi_1/1
+	leaq	flag_update_table_logical(%rip), %rsi	# 13700	[c=1 l=7]  *movdi_internal/4
+	orb	(%rsi,%rax), %cl	# 8541	[c=13 l=3]  *iorqi_1/1
+	leaq	101(%rbx), %rax	# 16221	[c=4 l=4]  *leadi
+	movb	%cl, 101(%rbx)	# 8542	[c=4 l=3]  *movqi_internal/8
+	jmp	.L1276	# 18669	[c=1 l=5]  jump
+.L1176:
+	movzbl	(%rsi), %edi	# 18215	[c=5 l=3]  *movqi_internal/4
+	orl	$63, %edx	# 16257	[c=4 l=3]  *iorsi_1/0
+	andl	%ecx, %edi	# 19099	[c=4 l=2]  *andsi_1/0
+	leaq	flag_update_table_add8(%rip), %rcx	# 7452	[c=1 l=7]  *movdi_internal/4
+	movl	%edi, %esi	# 14348	[c=4 l=2]  *movqi_internal/1
+	orb	(%rcx,%rax), %sil	# 7456	[c=13 l=4]  *iorqi_1/1
+	leaq	101(%rbx), %rax	# 16258	[c=4 l=4]  *leadi
+	movb	%sil, 101(%rbx)	# 7457	[c=4 l=4]  *movqi_internal/8
+	jmp	.L1177	# 18671	[c=1 l=5]  jump
+.L1432:
+	movq	1040(%rbx), %rax	# 11864	[c=9 l=7]  *movdi_internal/3
+	movl	$62, %esi	# 11866	[c=4 l=5]  *movsi_internal/0
+	subl	%edx, %esi	# 11867	[c=4 l=2]  *subsi_1/0
+	movzbl	61(%rax), %r8d	# 11865	[c=13 l=5]  *zero_extendqisi2/0
+	cmpl	%r13d, %esi	# 11868	[c=4 l=3]  *cmpsi_1/0
+	jb	.L1434	# 11869	[c=13 l=6]  *jcc
+	cmpb	$1, 1081(%rbx)	# 11873	[c=13 l=7]  *cmpqi_1/0
+	jbe	.L1434	# 11874	[c=13 l=6]  *jcc
+.L1435:
+	movl	$62, %esi	# 11877	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 11878	[c=4 l=3]  *movdi_internal/3
+	movl	%r8d, 24(%rsp)	# 15940	[c=4 l=5]  *movsi_internal/1
+	movq	%rcx, 16(%rsp)	# 15938	[c=4 l=5]  *movdi_internal/5
+	call	data_read_mapped	# 11879	[c=10 l=5]  *call_value
+	movq	16(%rsp), %rcx	# 15939	[c=9 l=5]  *movdi_internal/3
+	movl	24(%rsp), %r8d	# 15941	[c=9 l=5]  *movsi_internal/0
+	leaq	flag_update_table_add8(%rip), %r10	# 15943	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_sub8(%rip), %r11	# 15945	[c=1 l=7]  *movdi_internal/4
+	jmp	.L1436	# 18673	[c=1 l=5]  jump
+.L672:
+	movq	104(%rbx), %rsi	# 958	[c=9 l=4]  *movdi_internal/3
+	cltq	# 961	[c=4 l=2]  *extendsidi2_rex64/0
+	orl	$30, %edx	# 16387	[c=4 l=3]  *iorsi_1/0
+	andb	(%rsi), %cl	# 959	[c=9 l=2]  *andqi_1/1
+	leaq	flag_update_table_logical(%rip), %rsi	# 13688	[c=1 l=7]  *movdi_internal/4
+	orb	(%rsi,%rax), %cl	# 964	[c=13 l=3]  *iorqi_1/1
+	leaq	101(%rbx), %rax	# 16388	[c=4 l=4]  *leadi
+	movb	%cl, 101(%rbx)	# 965	[c=4 l=3]  *movqi_internal/8
+	jmp	.L673	# 18675	[c=1 l=5]  jump
+.L1179:
+	movq	104(%rbx), %rsi	# 7493	[c=9 l=4]  *movdi_internal/3
+	orl	$30, %edx	# 16255	[c=4 l=3]  *iorsi_1/0
+	andb	(%rsi), %cl	# 7494	[c=9 l=2]  *andqi_1/1
+	leaq	flag_update_table_logical(%rip), %rsi	# 13698	[c=1 l=7]  *movdi_internal/4
+	orb	(%rsi,%rax), %cl	# 7500	[c=13 l=3]  *iorqi_1/1
+	leaq	101(%rbx), %rax	# 16256	[c=4 l=4]  *leadi
+	movb	%cl, 101(%rbx)	# 7501	[c=4 l=3]  *movqi_internal/8
+	jmp	.L1180	# 18677	[c=1 l=5]  jump
+.L1166:
+	movq	104(%rbx), %rsi	# 7270	[c=9 l=4]  *movdi_internal/3
+	orl	$63, %ecx	# 16264	[c=4 l=3]  *iorsi_1/0
+	andb	(%rsi), %al	# 7271	[c=9 l=2]  *andqi_1/1
+	movl	%eax, %esi	# 14330	[c=4 l=2]  *movqi_internal/1
+	leaq	flag_update_table_sub8(%rip), %rax	# 7272	[c=1 l=7]  *movdi_internal/4
+	orb	(%rax,%rdx), %sil	# 7276	[c=13 l=4]  *iorqi_1/1
+	leaq	101(%rbx), %rax	# 16265	[c=4 l=4]  *leadi
+	movb	%sil, 101(%rbx)	# 7277	[c=4 l=4]  *movqi_internal/8
+	jmp	.L1167	# 18679	[c=1 l=5]  jump
+.L1262:
+	movq	104(%rbx), %rsi	# 9054	[c=9 l=4]  *movdi_internal/3
+	orl	$63, %ecx	# 16183	[c=4 l=3]  *iorsi_1/0
+	andb	(%rsi), %al	# 9055	[c=9 l=2]  *andqi_1/1
+	movl	%eax, %esi	# 14596	[c=4 l=2]  *movqi_internal/1
+	leaq	flag_update_table_sub8(%rip), %rax	# 9056	[c=1 l=7]  *movdi_internal/4
+	orb	(%rax,%rdx), %sil	# 9060	[c=13 l=4]  *iorqi_1/1
+	leaq	101(%rbx), %rdx	# 16184	[c=4 l=4]  *leadi
+	movb	%sil, 101(%rbx)	# 9061	[c=4 l=4]  *movqi_internal/8
+	movq	%rdx, %r8	# 12366	[c=4 l=3]  *movdi_internal/3
+	jmp	.L1263	# 18681	[c=1 l=5]  jump
+.L1372:
+	movq	104(%rbx), %rax	# 10960	[c=9 l=4]  *movdi_internal/3
+	orl	$63, %ecx	# 16093	[c=4 l=3]  *iorsi_1/0
+	andb	(%rax), %r9b	# 10961	[c=9 l=3]  *andqi_1/1
+	leaq	flag_update_table_sub8(%rip), %rax	# 10962	[c=1 l=7]  *movdi_internal/4
+	orb	(%rax,%r8), %r9b	# 10966	[c=13 l=4]  *iorqi_1/1
+	movq	%rdx, %r8	# 68	[c=4 l=3]  *movdi_internal/3
+	movb	%r9b, 101(%rbx)	# 10967	[c=4 l=4]  *movqi_internal/8
+	jmp	.L1373	# 18683	[c=1 l=5]  jump
+.L814:
+	movq	1040(%rbx), %rax	# 2954	[c=9 l=7]  *movdi_internal/3
+	movl	$62, %edx	# 2956	[c=4 l=5]  *movsi_internal/0
+	subl	%r13d, %edx	# 2957	[c=4 l=3]  *subsi_1/0
+	movzbl	61(%rax), %r15d	# 2955	[c=13 l=5]  *zero_extendqisi2/0
+	cmpl	%r14d, %edx	# 2958	[c=4 l=3]  *cmpsi_1/0
+	jb	.L816	# 2959	[c=13 l=6]  *jcc
+	cmpb	$1, 1081(%rbx)	# 2963	[c=13 l=7]  *cmpqi_1/0
+	jbe	.L816	# 2964	[c=13 l=6]  *jcc
+.L817:
+	movl	$62, %esi	# 2967	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 2968	[c=4 l=3]  *movdi_internal/3
+	call	data_read_mapped	# 2969	[c=10 l=5]  *call_value
+	leaq	flag_update_table_add8(%rip), %r10	# 15151	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_sub8(%rip), %r11	# 15153	[c=1 l=7]  *movdi_internal/4
+	jmp	.L818	# 18685	[c=1 l=5]  jump
+.L1173:
+	movq	104(%rbx), %rsi	# 7389	[c=9 l=4]  *movdi_internal/3
+	orl	$63, %edx	# 16259	[c=4 l=3]  *iorsi_1/0
+	movzbl	(%rsi), %edi	# 18219	[c=5 l=3]  *movqi_internal/4
+	andl	%ecx, %edi	# 19098	[c=4 l=2]  *andsi_1/0
+	leaq	flag_update_table_add8(%rip), %rcx	# 7391	[c=1 l=7]  *movdi_internal/4
+	movl	%edi, %esi	# 14340	[c=4 l=2]  *movqi_internal/1
+	orb	(%rcx,%rax), %sil	# 7395	[c=13 l=4]  *iorqi_1/1
+	leaq	101(%rbx), %rax	# 16260	[c=4 l=4]  *leadi
+	movb	%sil, 101(%rbx)	# 7396	[c=4 l=4]  *movqi_internal/8
+	jmp	.L1174	# 18687	[c=1 l=5]  jump
+.L1281:
+	movq	104(%rbx), %rsi	# 9710	[c=9 l=4]  *movdi_internal/3
+	orl	$63, %edx	# 16130	[c=4 l=3]  *iorsi_1/0
+	movzbl	(%rsi), %edi	# 18186	[c=5 l=3]  *movqi_internal/4
+	andl	%ecx, %edi	# 19097	[c=4 l=2]  *andsi_1/0
+	leaq	flag_update_table_add8(%rip), %rcx	# 9712	[c=1 l=7]  *movdi_internal/4
+	movl	%edi, %esi	# 14707	[c=4 l=2]  *movqi_internal/1
+	orb	(%rcx,%rax), %sil	# 9716	[c=13 l=4]  *iorqi_1/1
+	leaq	101(%rbx), %rax	# 16131	[c=4 l=4]  *leadi
+	movb	%sil, 101(%rbx)	# 9717	[c=4 l=4]  *movqi_internal/8
+	jmp	.L1282	# 18689	[c=1 l=5]  jump
+.L1293:
+	andb	(%rdx), %sil	# 10007	[c=9 l=3]  *andqi_1/1
+	orb	(%rcx,%r8), %sil	# 10012	[c=13 l=4]  *iorqi_1/1
+	leaq	101(%rbx), %rdx	# 16115	[c=4 l=4]  *leadi
+	orl	$63, %eax	# 16114	[c=4 l=3]  *iorsi_1/0
+	movb	%sil, 101(%rbx)	# 10013	[c=4 l=4]  *movqi_internal/8
+	jmp	.L1294	# 18691	[c=1 l=5]  jump
+.L1291:
+	andb	(%rdx), %dil	# 9949	[c=9 l=3]  *andqi_1/1
+	orb	(%rcx,%r8), %dil	# 9954	[c=13 l=4]  *iorqi_1/1
+	leaq	101(%rbx), %rdx	# 16118	[c=4 l=4]  *leadi
+	orl	$63, %eax	# 16117	[c=4 l=3]  *iorsi_1/0
+	movb	%dil, 101(%rbx)	# 9955	[c=4 l=4]  *movqi_internal/8
+	jmp	.L1292	# 18693	[c=1 l=5]  jump
+.L1289:
+	movq	104(%rbx), %rsi	# 9887	[c=9 l=4]  *movdi_internal/3
+	orl	$63, %eax	# 16120	[c=4 l=3]  *iorsi_1/0
+	movzbl	(%rsi), %edi	# 18181	[c=5 l=3]  *movqi_internal/4
+	andl	%ecx, %edi	# 19096	[c=4 l=2]  *andsi_1/0
+	leaq	flag_update_table_add8(%rip), %rcx	# 9889	[c=1 l=7]  *movdi_internal/4
+	movl	%edi, %esi	# 14735	[c=4 l=2]  *movqi_internal/1
+	orb	(%rcx,%rdx), %sil	# 9893	[c=13 l=4]  *iorqi_1/1
+	leaq	101(%rbx), %rdx	# 16121	[c=4 l=4]  *leadi
+	movb	%sil, 101(%rbx)	# 9894	[c=4 l=4]  *movqi_internal/8
+	jmp	.L1290	# 18695	[c=1 l=5]  jump
+.L691:
+	movq	1040(%rbx), %rax	# 1340	[c=9 l=7]  *movdi_internal/3
+	movl	$62, %esi	# 1342	[c=4 l=5]  *movsi_internal/0
+	subl	%edx, %esi	# 1343	[c=4 l=2]  *subsi_1/0
+	movzbl	61(%rax), %r8d	# 1341	[c=13 l=5]  *zero_extendqisi2/0
+	cmpl	%ecx, %esi	# 1344	[c=4 l=2]  *cmpsi_1/0
+	jb	.L693	# 1345	[c=13 l=6]  *jcc
+	cmpb	$1, 1081(%rbx)	# 1349	[c=13 l=7]  *cmpqi_1/0
+	jbe	.L693	# 1350	[c=13 l=6]  *jcc
+.L694:
+	movl	$62, %esi	# 1353	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 1354	[c=4 l=3]  *movdi_internal/3
+	movl	%r8d, 32(%rsp)	# 14990	[c=4 l=5]  *movsi_internal/1
+	movl	%ecx, 24(%rsp)	# 14988	[c=4 l=4]  *movsi_internal/1
+	movl	%edx, 16(%rsp)	# 14986	[c=4 l=4]  *movsi_internal/1
+	call	data_read_mapped	# 1355	[c=10 l=5]  *call_value
+	movl	16(%rsp), %edx	# 14987	[c=9 l=4]  *movsi_internal/0
+	movl	24(%rsp), %ecx	# 14989	[c=9 l=4]  *movsi_internal/0
+	leaq	flag_update_table_add8(%rip), %r10	# 14993	[c=1 l=7]  *movdi_internal/4
+	movl	32(%rsp), %r8d	# 14991	[c=9 l=5]  *movsi_internal/0
+	movl	%eax, %r15d	# 1356	[c=4 l=3]  *movsi_internal/0
+	leaq	flag_update_table_sub8(%rip), %r11	# 14995	[c=1 l=7]  *movdi_internal/4
+	jmp	.L695	# 18697	[c=1 l=5]  jump
+.L1247:
+	movq	104(%rbx), %rsi	# 8576	[c=9 l=4]  *movdi_internal/3
+	orl	$30, %edx	# 16218	[c=4 l=3]  *iorsi_1/0
+	andb	(%rsi), %cl	# 8577	[c=9 l=2]  *andqi_1/1
+	leaq	flag_update_table_logical(%rip), %rsi	# 13701	[c=1 l=7]  *movdi_internal/4
+	orb	(%rsi,%rax), %cl	# 8583	[c=13 l=3]  *iorqi_1/1
+	leaq	101(%rbx), %rax	# 16219	[c=4 l=4]  *leadi
+	movb	%cl, 101(%rbx)	# 8584	[c=4 l=3]  *movqi_internal/8
+	jmp	.L1248	# 18699	[c=1 l=5]  jump
+.L937:
+	movq	104(%rbx), %rsi	# 4474	[c=9 l=4]  *movdi_internal/3
+	cltq	# 4477	[c=4 l=2]  *extendsidi2_rex64/0
+	orl	$30, %edx	# 16300	[c=4 l=3]  *iorsi_1/0
+	andb	(%rsi), %cl	# 4475	[c=9 l=2]  *andqi_1/1
+	leaq	flag_update_table_logical(%rip), %rsi	# 13696	[c=1 l=7]  *movdi_internal/4
+	orb	(%rsi,%rax), %cl	# 4480	[c=13 l=3]  *iorqi_1/1
+	leaq	101(%rbx), %rax	# 16301	[c=4 l=4]  *leadi
+	movb	%cl, 101(%rbx)	# 4481	[c=4 l=3]  *movqi_internal/8
+	jmp	.L938	# 18701	[c=1 l=5]  jump
+.L675:
+	movq	104(%rbx), %rsi	# 1005	[c=9 l=4]  *movdi_internal/3
+	cltq	# 1008	[c=4 l=2]  *extendsidi2_rex64/0
+	orl	$31, %edx	# 16385	[c=4 l=3]  *iorsi_1/0
+	andb	(%rsi), %cl	# 1006	[c=9 l=2]  *andqi_1/1
+	leaq	flag_update_table_ror8(%rip), %rsi	# 13689	[c=1 l=7]  *movdi_internal/4
+	orb	(%rsi,%rax), %cl	# 1011	[c=13 l=3]  *iorqi_1/1
+	leaq	101(%rbx), %rax	# 16386	[c=4 l=4]  *leadi
+	movb	%cl, 101(%rbx)	# 1012	[c=4 l=3]  *movqi_internal/8
+	jmp	.L676	# 18703	[c=1 l=5]  jump
+.L1028:
+	andb	(%rsi), %dl	# 5511	[c=9 l=2]  *andqi_1/1
+	cltq	# 5513	[c=4 l=2]  *extendsidi2_rex64/0
+	leaq	flag_update_table_ror8(%rip), %rsi	# 13697	[c=1 l=7]  *movdi_internal/4
+	orl	$31, %ecx	# 16285	[c=4 l=3]  *iorsi_1/0
+	orb	(%rsi,%rax), %dl	# 5516	[c=13 l=3]  *iorqi_1/1
+	leaq	101(%rbx), %rax	# 16286	[c=4 l=4]  *leadi
+	movb	%dl, 101(%rbx)	# 5517	[c=4 l=3]  *movqi_internal/8
+	jmp	.L1029	# 18705	[c=1 l=5]  jump
+.L1163:
+	movq	104(%rbx), %rsi	# 7211	[c=9 l=4]  *movdi_internal/3
+	orl	$63, %ecx	# 16266	[c=4 l=3]  *iorsi_1/0
+	andb	(%rsi), %al	# 7212	[c=9 l=2]  *andqi_1/1
+	movl	%eax, %esi	# 14324	[c=4 l=2]  *movqi_internal/1
+	leaq	flag_update_table_sub8(%rip), %rax	# 7213	[c=1 l=7]  *movdi_internal/4
+	orb	(%rax,%rdx), %sil	# 7217	[c=13 l=4]  *iorqi_1/1
+	leaq	101(%rbx), %rax	# 16267	[c=4 l=4]  *leadi
+	movb	%sil, 101(%rbx)	# 7218	[c=4 l=4]  *movqi_internal/8
+	jmp	.L1164	# 18707	[c=1 l=5]  jump
+.L844:
+	movq	104(%rbx), %rsi	# 3283	[c=9 l=4]  *movdi_internal/3
+	orl	$30, %edx	# 16325	[c=4 l=3]  *iorsi_1/0
+	andb	(%rsi), %cl	# 3284	[c=9 l=2]  *andqi_1/1
+	leaq	flag_update_table_inc(%rip), %rsi	# 13693	[c=1 l=7]  *movdi_internal/4
+	orb	(%rsi,%rax), %cl	# 3289	[c=13 l=3]  *iorqi_1/1
+	leaq	101(%rbx), %rax	# 16326	[c=4 l=4]  *leadi
+	movb	%cl, 101(%rbx)	# 3290	[c=4 l=3]  *movqi_internal/8
+	jmp	.L845	# 18709	[c=1 l=5]  jump
+.L664:
+	movq	104(%rbx), %rsi	# 753	[c=9 l=4]  *movdi_internal/3
+	orl	$63, %edx	# 16403	[c=4 l=3]  *iorsi_1/0
+	movzbl	(%rsi), %edi	# 18374	[c=5 l=3]  *movqi_internal/4
+	andl	%ecx, %edi	# 19095	[c=4 l=2]  *andsi_1/0
+	leaq	flag_update_table_add8(%rip), %rcx	# 755	[c=1 l=7]  *movdi_internal/4
+	movl	%edi, %esi	# 13851	[c=4 l=2]  *movqi_internal/1
+	orb	(%rcx,%rax), %sil	# 759	[c=13 l=4]  *iorqi_1/1
+	leaq	101(%rbx), %rax	# 16404	[c=4 l=4]  *leadi
+	movb	%sil, 101(%rbx)	# 760	[c=4 l=4]  *movqi_internal/8
+	jmp	.L665	# 18711	[c=1 l=5]  jump
+.L669:
+	movq	104(%rbx), %rsi	# 910	[c=9 l=4]  *movdi_internal/3
+	movzbl	%al, %eax	# 914	[c=4 l=3]  zero_extendqidi2/0
+	orl	$30, %edx	# 16389	[c=4 l=3]  *iorsi_1/0
+	andb	(%rsi), %cl	# 911	[c=9 l=2]  *andqi_1/1
+	leaq	flag_update_table_logical(%rip), %rsi	# 13687	[c=1 l=7]  *movdi_internal/4
+	orb	(%rsi,%rax), %cl	# 917	[c=13 l=3]  *iorqi_1/1
+	leaq	101(%rbx), %rax	# 16390	[c=4 l=4]  *leadi
+	movb	%cl, 101(%rbx)	# 918	[c=4 l=3]  *movqi_internal/8
+	jmp	.L670	# 18713	[c=1 l=5]  jump
+.L1265:
+	movq	104(%rbx), %rsi	# 9206	[c=9 l=4]  *movdi_internal/3
+	andb	(%rsi), %al	# 9207	[c=9 l=2]  *andqi_1/1
+	movl	%eax, %esi	# 14627	[c=4 l=2]  *movqi_internal/1
+	leaq	flag_update_table_sub8(%rip), %rax	# 9208	[c=1 l=7]  *movdi_internal/4
+	orb	(%rax,%rdx), %sil	# 9212	[c=13 l=4]  *iorqi_1/1
+	leaq	101(%rbx), %rdx	# 16170	[c=4 l=4]  *leadi
+	movb	%sil, 101(%rbx)	# 9213	[c=4 l=4]  *movqi_internal/8
+	movl	%ecx, %esi	# 14630	[c=4 l=2]  *movqi_internal/1
+	movq	%rdx, %rcx	# 12371	[c=4 l=3]  *movdi_internal/3
+	orl	$63, %esi	# 16169	[c=4 l=3]  *iorsi_1/0
+	jmp	.L1266	# 18715	[c=1 l=5]  jump
+.L922:
+	movq	104(%rbx), %rax	# 4149	[c=9 l=4]  *movdi_internal/3
+	movslq	%ecx, %rcx	# 4152	[c=4 l=3]  *extendsidi2_rex64/1
+	orl	$31, %edx	# 16319	[c=4 l=3]  *iorsi_1/0
+	andb	(%rax), %sil	# 4150	[c=9 l=3]  *andqi_1/1
+	leaq	flag_update_table_ror8(%rip), %rax	# 13694	[c=1 l=7]  *movdi_internal/4
+	orb	(%rax,%rcx), %sil	# 4155	[c=13 l=4]  *iorqi_1/1
+	leaq	101(%rbx), %rax	# 16320	[c=4 l=4]  *leadi
+	movb	%sil, 101(%rbx)	# 4156	[c=4 l=4]  *movqi_internal/8
+	jmp	.L923	# 18717	[c=1 l=5]  jump
+.L790:
+	movq	104(%rbx), %rsi	# 2574	[c=9 l=4]  *movdi_internal/3
+	movzbl	%al, %eax	# 2578	[c=4 l=3]  zero_extendqidi2/0
+	orl	$30, %edx	# 16352	[c=4 l=3]  *iorsi_1/0
+	andb	(%rsi), %cl	# 2575	[c=9 l=2]  *andqi_1/1
+	leaq	flag_update_table_logical(%rip), %rsi	# 13692	[c=1 l=7]  *movdi_internal/4
+	orb	(%rsi,%rax), %cl	# 2581	[c=13 l=3]  *iorqi_1/1
+	leaq	101(%rbx), %rax	# 16353	[c=4 l=4]  *leadi
+	movb	%cl, 101(%rbx)	# 2582	[c=4 l=3]  *movqi_internal/8
+	jmp	.L791	# 18719	[c=1 l=5]  jump
+.L724:
+	movq	104(%rbx), %rsi	# 1704	[c=9 l=4]  *movdi_internal/3
+	orl	$63, %ecx	# 16366	[c=4 l=3]  *iorsi_1/0
+	andb	(%rsi), %al	# 1705	[c=9 l=2]  *andqi_1/1
+	movl	%eax, %esi	# 13924	[c=4 l=2]  *movqi_internal/1
+	leaq	flag_update_table_sub8(%rip), %rax	# 1706	[c=1 l=7]  *movdi_internal/4
+	orb	(%rax,%rdx), %sil	# 1710	[c=13 l=4]  *iorqi_1/1
+	leaq	101(%rbx), %rax	# 16367	[c=4 l=4]  *leadi
+	movb	%sil, 101(%rbx)	# 1711	[c=4 l=4]  *movqi_internal/8
+	jmp	.L725	# 18721	[c=1 l=5]  jump
+.L728:
+	movq	104(%rbx), %rsi	# 1820	[c=9 l=4]  *movdi_internal/3
+	orl	$63, %ecx	# 16360	[c=4 l=3]  *iorsi_1/0
+	andb	(%rsi), %al	# 1821	[c=9 l=2]  *andqi_1/1
+	movl	%eax, %esi	# 13942	[c=4 l=2]  *movqi_internal/1
+	leaq	flag_update_table_sub8(%rip), %rax	# 1822	[c=1 l=7]  *movdi_internal/4
+	orb	(%rax,%rdx), %sil	# 1826	[c=13 l=4]  *iorqi_1/1
+	leaq	101(%rbx), %rax	# 16361	[c=4 l=4]  *leadi
+	movb	%sil, 101(%rbx)	# 1827	[c=4 l=4]  *movqi_internal/8
+	jmp	.L729	# 18723	[c=1 l=5]  jump
+.L742:
+	movq	1040(%rbx), %rax	# 2062	[c=9 l=7]  *movdi_internal/3
+	movzbl	61(%rax), %r15d	# 2063	[c=13 l=5]  *zero_extendqisi2/0
+	cmpl	%r14d, %edx	# 2064	[c=4 l=3]  *cmpsi_1/0
+	jb	.L744	# 2065	[c=13 l=6]  *jcc
+	cmpb	$1, 1081(%rbx)	# 2069	[c=13 l=7]  *cmpqi_1/0
+	jbe	.L744	# 2070	[c=13 l=6]  *jcc
+.L745:
+	movl	$62, %esi	# 2073	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 2074	[c=4 l=3]  *movdi_internal/3
+	call	data_read_mapped	# 2075	[c=10 l=5]  *call_value
+	leaq	flag_update_table_add8(%rip), %r10	# 15051	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_sub8(%rip), %r11	# 15053	[c=1 l=7]  *movdi_internal/4
+	jmp	.L746	# 18725	[c=1 l=5]  jump
+.L981:
+	movq	1040(%rbx), %rax	# 4984	[c=9 l=7]  *movdi_internal/3
+	movl	$62, %ecx	# 4986	[c=4 l=5]  *movsi_internal/0
+	subl	%r15d, %ecx	# 4987	[c=4 l=3]  *subsi_1/0
+	movzbl	61(%rax), %r14d	# 4985	[c=13 l=5]  *zero_extendqisi2/0
+	cmpl	%edx, %ecx	# 4988	[c=4 l=2]  *cmpsi_1/0
+	jb	.L983	# 4989	[c=13 l=6]  *jcc
+	cmpb	$1, 1081(%rbx)	# 4993	[c=13 l=7]  *cmpqi_1/0
+	jbe	.L983	# 4994	[c=13 l=6]  *jcc
+.L984:
+	movl	$62, %esi	# 4997	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 4998	[c=4 l=3]  *movdi_internal/3
+	movl	%edx, 16(%rsp)	# 15356	[c=4 l=4]  *movsi_internal/1
+	call	data_read_mapped	# 4999	[c=10 l=5]  *call_value
+	movl	16(%rsp), %edx	# 15357	[c=9 l=4]  *movsi_internal/0
+	leaq	flag_update_table_add8(%rip), %r10	# 15359	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_sub8(%rip), %r11	# 15361	[c=1 l=7]  *movdi_internal/4
+	movl	%eax, %r13d	# 5000	[c=4 l=3]  *movsi_internal/0
+	jmp	.L985	# 18727	[c=1 l=5]  jump
+.L1003:
+	movq	1040(%rbx), %rax	# 5213	[c=9 l=7]  *movdi_internal/3
+	movl	$62, %ecx	# 5215	[c=4 l=5]  *movsi_internal/0
+	subl	%r15d, %ecx	# 5216	[c=4 l=3]  *subsi_1/0
+	movzbl	61(%rax), %r14d	# 5214	[c=13 l=5]  *zero_extendqisi2/0
+	cmpl	%edx, %ecx	# 5217	[c=4 l=2]  *cmpsi_1/0
+	jb	.L1005	# 5218	[c=13 l=6]  *jcc
+	cmpb	$1, 1081(%rbx)	# 5222	[c=13 l=7]  *cmpqi_1/0
+	jbe	.L1005	# 5223	[c=13 l=6]  *jcc
+.L1006:
+	movl	$62, %esi	# 5226	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 5227	[c=4 l=3]  *movdi_internal/3
+	movl	%edx, 16(%rsp)	# 15392	[c=4 l=4]  *movsi_internal/1
+	call	data_read_mapped	# 5228	[c=10 l=5]  *call_value
+	movl	16(%rsp), %edx	# 15393	[c=9 l=4]  *movsi_internal/0
+	leaq	flag_update_table_add8(%rip), %r10	# 15395	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_sub8(%rip), %r11	# 15397	[c=1 l=7]  *movdi_internal/4
+	movl	%eax, %r13d	# 5229	[c=4 l=3]  *movsi_internal/0
+	jmp	.L1007	# 18729	[c=1 l=5]  jump
+.L1278:
+	movq	104(%rbx), %rcx	# 9597	[c=9 l=4]  *movdi_internal/3
+	orl	$63, %esi	# 16138	[c=4 l=3]  *iorsi_1/0
+	andb	(%rcx), %al	# 9598	[c=9 l=2]  *andqi_1/1
+	movl	%eax, %ecx	# 14677	[c=4 l=2]  *movqi_internal/0
+	leaq	flag_update_table_sub8(%rip), %rax	# 9599	[c=1 l=7]  *movdi_internal/4
+	orb	(%rax,%rdx), %cl	# 9603	[c=13 l=3]  *iorqi_1/1
+	leaq	101(%rbx), %rdx	# 16139	[c=4 l=4]  *leadi
+	movb	%cl, 101(%rbx)	# 9604	[c=4 l=3]  *movqi_internal/8
+	movq	%rdx, %rcx	# 12316	[c=4 l=3]  *movdi_internal/3
+	jmp	.L1279	# 18731	[c=1 l=5]  jump
+.L1275:
+	movq	104(%rbx), %rsi	# 9540	[c=9 l=4]  *movdi_internal/3
+	orl	$30, %edx	# 16141	[c=4 l=3]  *iorsi_1/0
+	andb	(%rsi), %cl	# 9541	[c=9 l=2]  *andqi_1/1
+	leaq	flag_update_table_dec(%rip), %rsi	# 13702	[c=1 l=7]  *movdi_internal/4
+	orb	(%rsi,%rax), %cl	# 9546	[c=13 l=3]  *iorqi_1/1
+	leaq	101(%rbx), %rax	# 16142	[c=4 l=4]  *leadi
+	movb	%cl, 101(%rbx)	# 9547	[c=4 l=3]  *movqi_internal/8
+	jmp	.L1276	# 18733	[c=1 l=5]  jump
+.L1814:
+	movq	1040(%rbx), %rdx	# 3504	[c=9 l=7]  *movdi_internal/3
+	movzbl	56(%rdx), %eax	# 3505	[c=13 l=4]  *zero_extendqisi2/0
+	sall	$16, %eax	# 3506	[c=4 l=3]  *ashlsi3_1/0
+	orl	%eax, %esi	# 3507	[c=4 l=2]  *iorsi_1/0
+	testl	%eax, %eax	# 3509	[c=4 l=2]  *cmpsi_ccno_1/0
+	movl	%esi, %eax	# 14042	[c=4 l=2]  *movsi_internal/0
+	je	.L1830	# 3510	[c=13 l=6]  *jcc
+	movq	1072(%rbx), %rdx	# 3539	[c=9 l=7]  *movdi_internal/3
+	sarl	$12, %eax	# 3537	[c=4 l=3]  *ashrsi3_1/0
+	cltq	# 3538	[c=4 l=2]  *extendsidi2_rex64/0
+	movq	(%rdx,%rax,8), %rax	# 3540	[c=10 l=4]  *movdi_internal/3
+	testq	%rax, %rax	# 3541	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L1446	# 3542	[c=13 l=6]  *jcc
+	andl	$4095, %esi	# 13672	[c=5 l=6]  *andsi_1_zext
+	movzbl	(%rax,%rsi), %eax	# 3546	[c=13 l=4]  *zero_extendqisi2/0
+	jmp	.L868	# 18736	[c=1 l=5]  jump
+.L1788:
+	xorl	%r8d, %r8d	# 18335	[c=4 l=3]  *movsi_xor
+	movq	%rbx, %rdi	# 2779	[c=4 l=3]  *movdi_internal/3
+	movl	%r8d, 96(%rbx)	# 18336	[c=4 l=4]  *movsi_internal/1
+	call	do_events	# 2780	[c=0 l=5]  *call
+	leaq	flag_update_table_sub8(%rip), %r11	# 15145	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 15143	[c=1 l=7]  *movdi_internal/4
+	jmp	.L808	# 18738	[c=1 l=5]  jump
+.L1793:
+	xorl	%esi, %esi	# 18316	[c=4 l=2]  *movsi_xor
+	movq	%rbx, %rdi	# 3196	[c=4 l=3]  *movdi_internal/3
+	movl	%esi, 96(%rbx)	# 18317	[c=4 l=3]  *movsi_internal/1
+	call	do_events	# 3197	[c=0 l=5]  *call
+	leaq	flag_update_table_sub8(%rip), %r11	# 15183	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 15181	[c=1 l=7]  *movdi_internal/4
+	jmp	.L838	# 18740	[c=1 l=5]  jump
+.L1803:
+	xorl	%r8d, %r8d	# 18238	[c=4 l=3]  *movsi_xor
+	movq	%rbx, %rdi	# 6294	[c=4 l=3]  *movdi_internal/3
+	movl	%r8d, 96(%rbx)	# 18239	[c=4 l=4]  *movsi_internal/1
+	call	do_events	# 6295	[c=0 l=5]  *call
+	leaq	flag_update_table_sub8(%rip), %r11	# 15497	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 15495	[c=1 l=7]  *movdi_internal/4
+	jmp	.L1081	# 18742	[c=1 l=5]  jump
+.L1817:
+	xorl	%eax, %eax	# 18360	[c=4 l=2]  *movsi_xor
+	movq	%rbx, %rdi	# 1106	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, 96(%rbx)	# 18361	[c=4 l=3]  *movsi_internal/1
+	call	do_events	# 1107	[c=0 l=5]  *call
+	leaq	flag_update_table_sub8(%rip), %r11	# 14969	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 14967	[c=1 l=7]  *movdi_internal/4
+	jmp	.L681	# 18744	[c=1 l=5]  jump
+.L1783:
+	xorl	%esi, %esi	# 18156	[c=4 l=2]  *movsi_xor
+	movq	%rbx, %rdi	# 11261	[c=4 l=3]  *movdi_internal/3
+	movl	%esi, 96(%rbx)	# 18157	[c=4 l=3]  *movsi_internal/1
+	call	do_events	# 11262	[c=0 l=5]  *call
+	leaq	flag_update_table_sub8(%rip), %r11	# 15830	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 15828	[c=1 l=7]  *movdi_internal/4
+	jmp	.L1389	# 18746	[c=1 l=5]  jump
+.L1792:
+	xorl	%edi, %edi	# 18318	[c=4 l=2]  *movsi_xor
+	movl	%edi, 96(%rbx)	# 18319	[c=4 l=3]  *movsi_internal/1
+	movq	%rbx, %rdi	# 3152	[c=4 l=3]  *movdi_internal/3
+	call	do_events	# 3153	[c=0 l=5]  *call
+	leaq	flag_update_table_sub8(%rip), %r11	# 15179	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 15177	[c=1 l=7]  *movdi_internal/4
+	jmp	.L835	# 18748	[c=1 l=5]  jump
+.L1754:
+	xorl	%edx, %edx	# 18277	[c=4 l=2]  *movsi_xor
+	movq	%rbx, %rdi	# 4935	[c=4 l=3]  *movdi_internal/3
+	movl	%edx, 96(%rbx)	# 18278	[c=4 l=3]  *movsi_internal/1
+	call	do_events	# 4936	[c=0 l=5]  *call
+	leaq	flag_update_table_sub8(%rip), %r11	# 15349	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 15347	[c=1 l=7]  *movdi_internal/4
+	jmp	.L979	# 18750	[c=1 l=5]  jump
+.L1813:
+	xorl	%eax, %eax	# 18269	[c=4 l=2]  *movsi_xor
+	movq	%rbx, %rdi	# 5405	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, 96(%rbx)	# 18270	[c=4 l=3]  *movsi_internal/1
+	call	do_events	# 5406	[c=0 l=5]  *call
+	leaq	flag_update_table_sub8(%rip), %r11	# 15421	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 15419	[c=1 l=7]  *movdi_internal/4
+	jmp	.L1023	# 18752	[c=1 l=5]  jump
+.L1805:
+	xorl	%eax, %eax	# 18265	[c=4 l=2]  *movsi_xor
+	movq	%rbx, %rdi	# 5458	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, 96(%rbx)	# 18266	[c=4 l=3]  *movsi_internal/1
+	call	do_events	# 5459	[c=0 l=5]  *call
+	leaq	flag_update_table_sub8(%rip), %r11	# 15425	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 15423	[c=1 l=7]  *movdi_internal/4
+	jmp	.L1026	# 18754	[c=1 l=5]  jump
+.L1761:
+	xorl	%r11d, %r11d	# 18345	[c=4 l=3]  *movsi_xor
+	movq	%rbx, %rdi	# 1924	[c=4 l=3]  *movdi_internal/3
+	movl	%r11d, 96(%rbx)	# 18346	[c=4 l=4]  *movsi_internal/1
+	call	do_events	# 1925	[c=0 l=5]  *call
+	leaq	flag_update_table_sub8(%rip), %r11	# 15043	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 15041	[c=1 l=7]  *movdi_internal/4
+	jmp	.L735	# 18756	[c=1 l=5]  jump
+.L1809:
+	xorl	%eax, %eax	# 18274	[c=4 l=2]  *movsi_xor
+	movq	%rbx, %rdi	# 5164	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, 96(%rbx)	# 18275	[c=4 l=3]  *movsi_internal/1
+	call	do_events	# 5165	[c=0 l=5]  *call
+	leaq	flag_update_table_sub8(%rip), %r11	# 15385	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 15383	[c=1 l=7]  *movdi_internal/4
+	jmp	.L1001	# 18758	[c=1 l=5]  jump
+.L1759:
+	xorl	%r14d, %r14d	# 18352	[c=4 l=3]  *movsi_xor
+	movq	%rbx, %rdi	# 1539	[c=4 l=3]  *movdi_internal/3
+	movl	%r14d, 96(%rbx)	# 18353	[c=4 l=4]  *movsi_internal/1
+	call	do_events	# 1540	[c=0 l=5]  *call
+	leaq	flag_update_table_sub8(%rip), %r11	# 15025	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 15023	[c=1 l=7]  *movdi_internal/4
+	jmp	.L712	# 18760	[c=1 l=5]  jump
+.L1777:
+	xorl	%r9d, %r9d	# 18241	[c=4 l=3]  *movsi_xor
+	movq	%rbx, %rdi	# 6212	[c=4 l=3]  *movdi_internal/3
+	movl	%r9d, 96(%rbx)	# 18242	[c=4 l=4]  *movsi_internal/1
+	call	do_events	# 6213	[c=0 l=5]  *call
+	leaq	flag_update_table_sub8(%rip), %r11	# 15489	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 15487	[c=1 l=7]  *movdi_internal/4
+	jmp	.L1076	# 18762	[c=1 l=5]  jump
+.L1823:
+	xorl	%ecx, %ecx	# 18314	[c=4 l=2]  *movsi_xor
+	movq	%rbx, %rdi	# 3334	[c=4 l=3]  *movdi_internal/3
+	movl	%ecx, 96(%rbx)	# 18315	[c=4 l=3]  *movsi_internal/1
+	call	do_events	# 3335	[c=0 l=5]  *call
+	leaq	flag_update_table_sub8(%rip), %r11	# 15191	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 15189	[c=1 l=7]  *movdi_internal/4
+	jmp	.L848	# 18764	[c=1 l=5]  jump
+.L1824:
+	xorl	%eax, %eax	# 18253	[c=4 l=2]  *movsi_xor
+	movq	%rbx, %rdi	# 5866	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, 96(%rbx)	# 18254	[c=4 l=3]  *movsi_internal/1
+	call	do_events	# 5867	[c=0 l=5]  *call
+	leaq	flag_update_table_sub8(%rip), %r11	# 15457	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 15455	[c=1 l=7]  *movdi_internal/4
+	jmp	.L1052	# 18766	[c=1 l=5]  jump
+.L1773:
+	xorl	%r14d, %r14d	# 18249	[c=4 l=3]  *movsi_xor
+	movq	%rbx, %rdi	# 6012	[c=4 l=3]  *movdi_internal/3
+	movl	%r14d, 96(%rbx)	# 18250	[c=4 l=4]  *movsi_internal/1
+	call	do_events	# 6013	[c=0 l=5]  *call
+	leaq	flag_update_table_sub8(%rip), %r11	# 15473	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 15471	[c=1 l=7]  *movdi_internal/4
+	jmp	.L1064	# 18768	[c=1 l=5]  jump
+.L1818:
+	xorl	%eax, %eax	# 18255	[c=4 l=2]  *movsi_xor
+	movq	%rbx, %rdi	# 5793	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, 96(%rbx)	# 18256	[c=4 l=3]  *movsi_internal/1
+	call	do_events	# 5794	[c=0 l=5]  *call
+	leaq	flag_update_table_sub8(%rip), %r11	# 15449	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 15447	[c=1 l=7]  *movdi_internal/4
+	jmp	.L1046	# 18770	[c=1 l=5]  jump
+.L1774:
+	xorl	%r13d, %r13d	# 18247	[c=4 l=3]  *movsi_xor
+	movq	%rbx, %rdi	# 6062	[c=4 l=3]  *movdi_internal/3
+	movl	%r13d, 96(%rbx)	# 18248	[c=4 l=4]  *movsi_internal/1
+	call	do_events	# 6063	[c=0 l=5]  *call
+	leaq	flag_update_table_sub8(%rip), %r11	# 15477	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 15475	[c=1 l=7]  *movdi_internal/4
+	jmp	.L1067	# 18772	[c=1 l=5]  jump
+.L1775:
+	xorl	%r11d, %r11d	# 18245	[c=4 l=3]  *movsi_xor
+	movq	%rbx, %rdi	# 6112	[c=4 l=3]  *movdi_internal/3
+	movl	%r11d, 96(%rbx)	# 18246	[c=4 l=4]  *movsi_internal/1
+	call	do_events	# 6113	[c=0 l=5]  *call
+	leaq	flag_update_table_sub8(%rip), %r11	# 15481	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 15479	[c=1 l=7]  *movdi_internal/4
+	jmp	.L1070	# 18774	[c=1 l=5]  jump
+.L1762:
+	xorl	%r9d, %r9d	# 18339	[c=4 l=3]  *movsi_xor
+	movq	%rbx, %rdi	# 2367	[c=4 l=3]  *movdi_internal/3
+	movl	%r9d, 96(%rbx)	# 18340	[c=4 l=4]  *movsi_internal/1
+	call	do_events	# 2368	[c=0 l=5]  *call
+	leaq	flag_update_table_sub8(%rip), %r11	# 15091	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 15089	[c=1 l=7]  *movdi_internal/4
+	jmp	.L773	# 18776	[c=1 l=5]  jump
+.L1760:
+	xorl	%r13d, %r13d	# 18347	[c=4 l=3]  *movsi_xor
+	movq	%rbx, %rdi	# 1874	[c=4 l=3]  *movdi_internal/3
+	movl	%r13d, 96(%rbx)	# 18348	[c=4 l=4]  *movsi_internal/1
+	call	do_events	# 1875	[c=0 l=5]  *call
+	leaq	flag_update_table_sub8(%rip), %r11	# 15039	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 15037	[c=1 l=7]  *movdi_internal/4
+	jmp	.L732	# 18778	[c=1 l=5]  jump
+.L1767:
+	xorl	%r10d, %r10d	# 18341	[c=4 l=3]  *movsi_xor
+	movq	%rbx, %rdi	# 2278	[c=4 l=3]  *movdi_internal/3
+	movl	%r10d, 96(%rbx)	# 18342	[c=4 l=4]  *movsi_internal/1
+	call	do_events	# 2279	[c=0 l=5]  *call
+	leaq	flag_update_table_sub8(%rip), %r11	# 15083	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 15081	[c=1 l=7]  *movdi_internal/4
+	jmp	.L766	# 18780	[c=1 l=5]  jump
+.L1825:
+	xorl	%r15d, %r15d	# 18251	[c=4 l=3]  *movsi_xor
+	movq	%rbx, %rdi	# 5939	[c=4 l=3]  *movdi_internal/3
+	movl	%r15d, 96(%rbx)	# 18252	[c=4 l=4]  *movsi_internal/1
+	call	do_events	# 5940	[c=0 l=5]  *call
+	leaq	flag_update_table_sub8(%rip), %r11	# 15465	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 15463	[c=1 l=7]  *movdi_internal/4
+	jmp	.L1058	# 18782	[c=1 l=5]  jump
+.L1801:
+	xorl	%edi, %edi	# 18234	[c=4 l=2]  *movsi_xor
+	movl	%edi, 96(%rbx)	# 18235	[c=4 l=3]  *movsi_internal/1
+	movq	%rbx, %rdi	# 6465	[c=4 l=3]  *movdi_internal/3
+	call	do_events	# 6466	[c=0 l=5]  *call
+	leaq	flag_update_table_sub8(%rip), %r11	# 15527	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 15525	[c=1 l=7]  *movdi_internal/4
+	jmp	.L1095	# 18784	[c=1 l=5]  jump
+.L1776:
+	xorl	%r10d, %r10d	# 18243	[c=4 l=3]  *movsi_xor
+	movq	%rbx, %rdi	# 6162	[c=4 l=3]  *movdi_internal/3
+	movl	%r10d, 96(%rbx)	# 18244	[c=4 l=4]  *movsi_internal/1
+	call	do_events	# 6163	[c=0 l=5]  *call
+	leaq	flag_update_table_sub8(%rip), %r11	# 15485	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 15483	[c=1 l=7]  *movdi_internal/4
+	jmp	.L1073	# 18786	[c=1 l=5]  jump
+.L1765:
+	movzbl	%r13b, %edx	# 2198	[c=4 l=4]  *zero_extendqisi2/0
+	movl	$61, %esi	# 2200	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 2201	[c=4 l=3]  *movdi_internal/3
+	call	data_write_mapped	# 2202	[c=0 l=5]  *call
+	leaq	flag_update_table_add8(%rip), %r10	# 15069	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_sub8(%rip), %r11	# 15071	[c=1 l=7]  *movdi_internal/4
+	jmp	.L759	# 18788	[c=1 l=5]  jump
+.L1766:
+	movzbl	%al, %edx	# 2222	[c=4 l=3]  *zero_extendqisi2/0
+	movl	$62, %esi	# 2224	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 2225	[c=4 l=3]  *movdi_internal/3
+	call	data_write_mapped	# 2226	[c=0 l=5]  *call
+	leaq	flag_update_table_add8(%rip), %r10	# 15073	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_sub8(%rip), %r11	# 15075	[c=1 l=7]  *movdi_internal/4
+	jmp	.L761	# 18790	[c=1 l=5]  jump
+.L1807:
+	movzbl	%r13b, %edx	# 5114	[c=4 l=4]  *zero_extendqisi2/0
+	movl	$61, %esi	# 5116	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 5117	[c=4 l=3]  *movdi_internal/3
+	call	data_write_mapped	# 5118	[c=0 l=5]  *call
+	leaq	flag_update_table_add8(%rip), %r10	# 15375	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_sub8(%rip), %r11	# 15377	[c=1 l=7]  *movdi_internal/4
+	jmp	.L998	# 18792	[c=1 l=5]  jump
+.L1808:
+	movzbl	%r13b, %edx	# 5138	[c=4 l=4]  *zero_extendqisi2/0
+	movl	$62, %esi	# 5140	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 5141	[c=4 l=3]  *movdi_internal/3
+	call	data_write_mapped	# 5142	[c=0 l=5]  *call
+	leaq	flag_update_table_add8(%rip), %r10	# 15379	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_sub8(%rip), %r11	# 15381	[c=1 l=7]  *movdi_internal/4
+	jmp	.L1000	# 18794	[c=1 l=5]  jump
+.L1757:
+	movzbl	%al, %edx	# 1502	[c=4 l=3]  *zero_extendqisi2/0
+	movl	$62, %esi	# 1504	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 1505	[c=4 l=3]  *movdi_internal/3
+	call	data_write_mapped	# 1506	[c=0 l=5]  *call
+	leaq	flag_update_table_add8(%rip), %r10	# 15019	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_sub8(%rip), %r11	# 15021	[c=1 l=7]  *movdi_internal/4
+	jmp	.L710	# 18796	[c=1 l=5]  jump
+.L1790:
+	movzbl	%r13b, %edx	# 3092	[c=4 l=4]  *zero_extendqisi2/0
+	movl	$61, %esi	# 3094	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 3095	[c=4 l=3]  *movdi_internal/3
+	call	data_write_mapped	# 3096	[c=0 l=5]  *call
+	leaq	flag_update_table_add8(%rip), %r10	# 15169	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_sub8(%rip), %r11	# 15171	[c=1 l=7]  *movdi_internal/4
+	jmp	.L831	# 18798	[c=1 l=5]  jump
+.L1739:
+	movzbl	%r15b, %edx	# 10176	[c=4 l=4]  *zero_extendqisi2/0
+	movl	$61, %esi	# 10178	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 10179	[c=4 l=3]  *movdi_internal/3
+	call	data_write_mapped	# 10180	[c=0 l=5]  *call
+	leaq	flag_update_table_add8(%rip), %r10	# 15721	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_sub8(%rip), %r11	# 15723	[c=1 l=7]  *movdi_internal/4
+	jmp	.L1308	# 18800	[c=1 l=5]  jump
+.L1811:
+	movzbl	%r13b, %edx	# 5343	[c=4 l=4]  *zero_extendqisi2/0
+	movl	$61, %esi	# 5345	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 5346	[c=4 l=3]  *movdi_internal/3
+	call	data_write_mapped	# 5347	[c=0 l=5]  *call
+	leaq	flag_update_table_add8(%rip), %r10	# 15411	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_sub8(%rip), %r11	# 15413	[c=1 l=7]  *movdi_internal/4
+	jmp	.L1020	# 18802	[c=1 l=5]  jump
+.L1756:
+	movzbl	%al, %edx	# 1478	[c=4 l=3]  *zero_extendqisi2/0
+	movl	$61, %esi	# 1480	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 1481	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, 16(%rsp)	# 15012	[c=4 l=4]  *movsi_internal/1
+	call	data_write_mapped	# 1482	[c=0 l=5]  *call
+	movl	16(%rsp), %eax	# 15013	[c=9 l=4]  *movsi_internal/0
+	leaq	flag_update_table_add8(%rip), %r10	# 15015	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_sub8(%rip), %r11	# 15017	[c=1 l=7]  *movdi_internal/4
+	jmp	.L708	# 18804	[c=1 l=5]  jump
+.L1752:
+	movzbl	%r15b, %edx	# 4879	[c=4 l=4]  *zero_extendqisi2/0
+	movl	$61, %esi	# 4881	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 4882	[c=4 l=3]  *movdi_internal/3
+	call	data_write_mapped	# 4883	[c=0 l=5]  *call
+	leaq	flag_update_table_add8(%rip), %r10	# 15339	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_sub8(%rip), %r11	# 15341	[c=1 l=7]  *movdi_internal/4
+	jmp	.L976	# 18806	[c=1 l=5]  jump
+.L1753:
+	movzbl	%al, %edx	# 4903	[c=4 l=3]  *zero_extendqisi2/0
+	movl	$62, %esi	# 4905	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 4906	[c=4 l=3]  *movdi_internal/3
+	call	data_write_mapped	# 4907	[c=0 l=5]  *call
+	leaq	flag_update_table_add8(%rip), %r10	# 15343	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_sub8(%rip), %r11	# 15345	[c=1 l=7]  *movdi_internal/4
+	jmp	.L978	# 18808	[c=1 l=5]  jump
+.L1791:
+	movzbl	%al, %edx	# 3116	[c=4 l=3]  *zero_extendqisi2/0
+	movl	$62, %esi	# 3118	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 3119	[c=4 l=3]  *movdi_internal/3
+	call	data_write_mapped	# 3120	[c=0 l=5]  *call
+	leaq	flag_update_table_add8(%rip), %r10	# 15173	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_sub8(%rip), %r11	# 15175	[c=1 l=7]  *movdi_internal/4
+	jmp	.L833	# 18810	[c=1 l=5]  jump
+.L1740:
+	movzbl	%al, %edx	# 10200	[c=4 l=3]  *zero_extendqisi2/0
+	movl	$62, %esi	# 10202	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 10203	[c=4 l=3]  *movdi_internal/3
+	call	data_write_mapped	# 10204	[c=0 l=5]  *call
+	leaq	flag_update_table_add8(%rip), %r10	# 15725	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_sub8(%rip), %r11	# 15727	[c=1 l=7]  *movdi_internal/4
+	jmp	.L1310	# 18812	[c=1 l=5]  jump
+.L1812:
+	movzbl	%r13b, %edx	# 5367	[c=4 l=4]  *zero_extendqisi2/0
+	movl	$62, %esi	# 5369	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 5370	[c=4 l=3]  *movdi_internal/3
+	call	data_write_mapped	# 5371	[c=0 l=5]  *call
+	leaq	flag_update_table_add8(%rip), %r10	# 15415	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_sub8(%rip), %r11	# 15417	[c=1 l=7]  *movdi_internal/4
+	jmp	.L1022	# 18814	[c=1 l=5]  jump
+.L1785:
+	leaq	-1(%rdx), %rax	# 16082	[c=4 l=4]  *leadi
+	xorl	%edx, %edx	# 18161	[c=4 l=2]  *movdi_xor
+	subq	%rbp, %rax	# 11097	[c=4 l=3]  *subdi_1/0
+	divq	%r8	# 16084	[c=0 l=3]  *udivmoddi4_noext
+	addq	$1, %rax	# 11099	[c=4 l=4]  *adddi_1/0
+	jmp	.L1379	# 18816	[c=1 l=5]  jump
+.L647:
+	movswl	1028(%rbx), %ecx	# 586	[c=13 l=7]  extendhisi2/1
+	xorl	%esi, %esi	# 18384	[c=4 l=2]  *movdi_xor
+	movq	%rbx, %rdi	# 592	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 18385	[c=4 l=2]  *movdi_xor
+	leaq	.LC49(%rip), %rdx	# 589	[c=1 l=7]  *movdi_internal/4
+	movl	%ecx, 76(%rbx)	# 587	[c=4 l=3]  *movsi_internal/1
+	call	leave	# 594	[c=0 l=5]  *call
+.L648:
+	cmpl	$0, 264(%rbx)	# 574	[c=13 l=7]  *cmpsi_ccno_1/1
+	je	.L644	# 575	[c=13 l=6]  *jcc
+	movq	904(%rbx), %rsi	# 577	[c=9 l=7]  *movdi_internal/3
+	movsbl	1028(%rbx), %edi	# 578	[c=13 l=7]  extendqisi2
+	call	putc@PLT	# 581	[c=10 l=5]  *call_value
+	leaq	flag_update_table_add8(%rip), %r10	# 14959	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_sub8(%rip), %r11	# 14961	[c=1 l=7]  *movdi_internal/4
+	jmp	.L644	# 18818	[c=1 l=5]  jump
+.L649:
+	cmpl	$0, 248(%rbx)	# 546	[c=13 l=7]  *cmpsi_ccno_1/1
+	je	.L644	# 547	[c=13 l=6]  *jcc
+	movq	40(%rbx), %rax	# 13837	[c=9 l=4]  *movdi_internal/3
+	cmpl	$1, 96(%rbx)	# 551	[c=13 l=4]  *cmpsi_1/0
+	leaq	-1(%rax), %rdx	# 16408	[c=4 l=4]  *leadi
+	je	.L1831	# 552	[c=13 l=6]  *jcc
+.L656:
+	leaq	host_getchar(%rip), %rcx	# 562	[c=1 l=7]  *movdi_internal/4
+	xorl	%esi, %esi	# 18386	[c=4 l=2]  *movdi_xor
+	movq	%rbx, %rdi	# 566	[c=4 l=3]  *movdi_internal/3
+	call	replay_input@PLT	# 567	[c=10 l=5]  *call_value
+	leaq	flag_update_table_add8(%rip), %r10	# 14955	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_sub8(%rip), %r11	# 14957	[c=1 l=7]  *movdi_internal/4
+	movw	%ax, 1028(%rbx)	# 569	[c=4 l=7]  *movhi_internal/3
+	jmp	.L644	# 18821	[c=1 l=5]  jump
+.L650:
+	cmpl	$0, 504(%rbx)	# 508	[c=13 l=7]  *cmpsi_ccno_1/1
+	jne	.L655	# 509	[c=13 l=6]  *jcc
+	movl	$0, 1024(%rbx)	# 512	[c=4 l=10]  *movv4qi_internal/1
+	movw	$0, 1028(%rbx)	# 514	[c=4 l=9]  *movv2qi_internal/3
+	jmp	.L644	# 18823	[c=1 l=5]  jump
+.L645:
+	leaq	.LC50(%rip), %rdx	# 598	[c=1 l=7]  *movdi_internal/4
+	movl	$1, %esi	# 600	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 601	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 18383	[c=4 l=2]  *movdi_xor
+	call	leave	# 603	[c=0 l=5]  *call
+.L1749:
+	movq	1040(%rbx), %rax	# 12281	[c=9 l=7]  *movdi_internal/3
+	jmp	.L947	# 18825	[c=1 l=5]  jump
+.L828:
+	movl	%r13d, %esi	# 3074	[c=4 l=3]  *movsi_internal/0
+	movq	%rbx, %rdi	# 3075	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 3076	[c=0 l=5]  *call
+	leaq	flag_update_table_add8(%rip), %r10	# 15165	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_sub8(%rip), %r11	# 15167	[c=1 l=7]  *movdi_internal/4
+	jmp	.L829	# 18827	[c=1 l=5]  jump
+.L1085:
+	movl	$59, %esi	# 6339	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 6340	[c=4 l=3]  *movdi_internal/3
+	movl	%edx, 16(%rsp)	# 15498	[c=4 l=4]  *movsi_internal/1
+	call	data_read_page	# 6341	[c=10 l=5]  *call_value
+	movl	16(%rsp), %edx	# 15499	[c=9 l=4]  *movsi_internal/0
+	jmp	.L1086	# 18829	[c=1 l=5]  jump
+.L1010:
+	movl	%r13d, %esi	# 5262	[c=4 l=3]  *movsi_internal/0
+	movq	%rbx, %rdi	# 5263	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 5264	[c=10 l=5]  *call_value
+	leaq	flag_update_table_sub8(%rip), %r11	# 15401	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 15399	[c=1 l=7]  *movdi_internal/4
+	movl	%eax, %r14d	# 5265	[c=4 l=3]  *movsi_internal/0
+	jmp	.L1011	# 18831	[c=1 l=5]  jump
+.L988:
+	movl	%r13d, %esi	# 5033	[c=4 l=3]  *movsi_internal/0
+	movq	%rbx, %rdi	# 5034	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 5035	[c=10 l=5]  *call_value
+	leaq	flag_update_table_sub8(%rip), %r11	# 15365	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 15363	[c=1 l=7]  *movdi_internal/4
+	movl	%eax, %r14d	# 5036	[c=4 l=3]  *movsi_internal/0
+	jmp	.L989	# 18833	[c=1 l=5]  jump
+.L807:
+	movl	%r8d, %edx	# 2764	[c=4 l=3]  *movsi_internal/0
+	movl	$59, %esi	# 2765	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 2766	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 2767	[c=0 l=5]  *call
+	leaq	flag_update_table_sub8(%rip), %r11	# 15141	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 15139	[c=1 l=7]  *movdi_internal/4
+	jmp	.L805	# 18835	[c=1 l=5]  jump
+.L795:
+	movl	$59, %esi	# 2624	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 2625	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 2626	[c=10 l=5]  *call_value
+	jmp	.L796	# 18837	[c=1 l=5]  jump
+.L756:
+	movl	%r13d, %esi	# 2180	[c=4 l=3]  *movsi_internal/0
+	movq	%rbx, %rdi	# 2181	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 2182	[c=0 l=5]  *call
+	leaq	flag_update_table_add8(%rip), %r10	# 15065	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_sub8(%rip), %r11	# 15067	[c=1 l=7]  *movdi_internal/4
+	jmp	.L757	# 18839	[c=1 l=5]  jump
+.L705:
+	movl	%eax, %esi	# 1460	[c=4 l=2]  *movsi_internal/0
+	movq	%rbx, %rdi	# 1461	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 1462	[c=0 l=5]  *call
+	leaq	flag_update_table_add8(%rip), %r10	# 15009	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_sub8(%rip), %r11	# 15011	[c=1 l=7]  *movdi_internal/4
+	jmp	.L706	# 18841	[c=1 l=5]  jump
+.L973:
+	movl	%r15d, %esi	# 4861	[c=4 l=3]  *movsi_internal/0
+	movq	%rbx, %rdi	# 4862	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 4863	[c=0 l=5]  *call
+	leaq	flag_update_table_add8(%rip), %r10	# 15335	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_sub8(%rip), %r11	# 15337	[c=1 l=7]  *movdi_internal/4
+	jmp	.L974	# 18843	[c=1 l=5]  jump
+.L1830:
+	subl	5176(%rbx), %eax	# 3512	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %eax	# 3513	[c=13 l=6]  *cmpsi_1/1
+	jb	.L865	# 3514	[c=13 l=2]  *jcc
+	movl	%esi, %eax	# 14044	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %eax	# 3516	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 13673	[c=5 l=5]  *andsi_1_zext
+	cmpb	$0, 1080(%rbx,%rax)	# 3519	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L866	# 3520	[c=13 l=6]  *jcc
+.L865:
+	movslq	%esi, %rsi	# 3523	[c=4 l=3]  *extendsidi2_rex64/1
+	movzbl	(%rdx,%rsi), %eax	# 3524	[c=13 l=4]  *zero_extendqisi2/0
+	jmp	.L868	# 18845	[c=1 l=5]  jump
+.L1110:
+	movl	%edi, %edx	# 6659	[c=4 l=2]  *movsi_internal/0
+	movq	%rbx, %rdi	# 6661	[c=4 l=3]  *movdi_internal/3
+	call	far_write	# 6662	[c=0 l=5]  *call
+	leaq	flag_update_table_add8(%rip), %r10	# 15549	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_sub8(%rip), %r11	# 15551	[c=1 l=7]  *movdi_internal/4
+	jmp	.L1113	# 18847	[c=1 l=5]  jump
+.L1829:
+	movzbl	8(%r15), %eax	# 11201	[c=13 l=5]  zero_extendqidi2/0
+	leaq	handler.2(%rip), %r14	# 11199	[c=1 l=7]  *movdi_internal/4
+	movq	(%r14,%rax,8), %r14	# 11202	[c=10 l=4]  *movdi_internal/3
+	jmp	.L1386	# 18849	[c=1 l=5]  jump
+.L1763:
+	leaq	.LC43(%rip), %rdx	# 365	[c=1 l=7]  *movdi_internal/4
+	movl	$1, %esi	# 367	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 368	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 18392	[c=4 l=2]  *movdi_xor
+	call	leave	# 370	[c=0 l=5]  *call
+.L1584:
+	movl	(%rbx), %eax	# 13956	[c=5 l=2]  *movsi_internal/0
+	movq	1056(%rbx), %rdx	# 2024	[c=9 l=7]  *movdi_internal/3
+	subl	$1, %eax	# 2019	[c=4 l=3]  *addsi_1/0
+	movl	%eax, (%rbx)	# 2020	[c=4 l=2]  *movsi_internal/1
+	addl	%eax, %eax	# 2022	[c=5 l=2]  *ashlsi3_1_zext/0
+	movzwl	(%rdx,%rax), %ecx	# 2025	[c=13 l=4]  *zero_extendhisi2/0
+.L1579:
+	movq	832(%rbx), %r8	# 2026	[c=9 l=7]  *movdi_internal/3
+	leaq	.LC44(%rip), %rdx	# 2028	[c=1 l=7]  *movdi_internal/4
+	movq	%rbx, %rdi	# 2031	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 18343	[c=4 l=2]  *movdi_xor
+	movl	$1, %esi	# 2030	[c=4 l=5]  *movsi_internal/0
+	call	leave	# 2033	[c=0 l=5]  *call
+.L1118:
+	movzbl	%cl, %edx	# 6730	[c=4 l=3]  *zero_extendqisi2/0
+	movq	%rbx, %rdi	# 6733	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 6734	[c=0 l=5]  *call
+	leaq	flag_update_table_sub8(%rip), %r11	# 15559	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 15557	[c=1 l=7]  *movdi_internal/4
+	jmp	.L1119	# 18851	[c=1 l=5]  jump
+.L1016:
+	movl	%r13d, %esi	# 5317	[c=4 l=3]  *movsi_internal/0
+	movq	%rbx, %rdi	# 5318	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 5319	[c=10 l=5]  *call_value
+	leaq	flag_update_table_sub8(%rip), %r11	# 15409	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 15407	[c=1 l=7]  *movdi_internal/4
+	movl	%eax, %r14d	# 5320	[c=4 l=3]  *movsi_internal/0
+	jmp	.L1017	# 18853	[c=1 l=5]  jump
+.L1013:
+	movq	%rbx, %rdi	# 5291	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 5292	[c=10 l=5]  *call_value
+	leaq	flag_update_table_sub8(%rip), %r11	# 15405	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 15403	[c=1 l=7]  *movdi_internal/4
+	jmp	.L1014	# 18855	[c=1 l=5]  jump
+.L841:
+	movq	%rbx, %rdi	# 3241	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 3242	[c=10 l=5]  *call_value
+	leaq	flag_update_table_sub8(%rip), %r11	# 15187	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 15185	[c=1 l=7]  *movdi_internal/4
+	movl	%eax, %edx	# 3243	[c=4 l=2]  *movsi_internal/0
+	jmp	.L842	# 18857	[c=1 l=5]  jump
+.L874:
+	movq	%rbx, %rdi	# 3618	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 3619	[c=10 l=5]  *call_value
+	leaq	flag_update_table_sub8(%rip), %r11	# 15219	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 15217	[c=1 l=7]  *movdi_internal/4
+	movl	%eax, %edx	# 3620	[c=4 l=2]  *movsi_internal/0
+	jmp	.L875	# 18859	[c=1 l=5]  jump
+.L941:
+	movzbl	%cl, %edx	# 4524	[c=4 l=3]  *zero_extendqisi2/0
+	movq	%rbx, %rdi	# 4527	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 4528	[c=0 l=5]  *call
+	leaq	flag_update_table_sub8(%rip), %r11	# 15279	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 15277	[c=1 l=7]  *movdi_internal/4
+	jmp	.L942	# 18861	[c=1 l=5]  jump
+.L994:
+	movl	%r13d, %esi	# 5088	[c=4 l=3]  *movsi_internal/0
+	movq	%rbx, %rdi	# 5089	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 5090	[c=10 l=5]  *call_value
+	leaq	flag_update_table_sub8(%rip), %r11	# 15373	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 15371	[c=1 l=7]  *movdi_internal/4
+	movl	%eax, %r14d	# 5091	[c=4 l=3]  *movsi_internal/0
+	jmp	.L995	# 18863	[c=1 l=5]  jump
+.L991:
+	movq	%rbx, %rdi	# 5062	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 5063	[c=10 l=5]  *call_value
+	leaq	flag_update_table_sub8(%rip), %r11	# 15369	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 15367	[c=1 l=7]  *movdi_internal/4
+	jmp	.L992	# 18865	[c=1 l=5]  jump
+.L824:
+	movl	%ecx, %edx	# 3042	[c=4 l=2]  *movsi_internal/0
+	movl	%eax, %esi	# 3043	[c=4 l=2]  *movsi_internal/0
+	movq	%rbx, %rdi	# 3044	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 3045	[c=0 l=5]  *call
+	leaq	flag_update_table_sub8(%rip), %r11	# 15163	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 15161	[c=1 l=7]  *movdi_internal/4
+	jmp	.L825	# 18867	[c=1 l=5]  jump
+.L821:
+	movl	%ecx, %edx	# 3015	[c=4 l=2]  *movsi_internal/0
+	movl	%r15d, %esi	# 3016	[c=4 l=3]  *movsi_internal/0
+	movq	%rbx, %rdi	# 3017	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, 16(%rsp)	# 15154	[c=4 l=4]  *movsi_internal/1
+	call	data_write_page	# 3018	[c=0 l=5]  *call
+	movl	16(%rsp), %eax	# 15155	[c=9 l=4]  *movsi_internal/0
+	leaq	flag_update_table_sub8(%rip), %r11	# 15159	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 15157	[c=1 l=7]  *movdi_internal/4
+	jmp	.L822	# 18869	[c=1 l=5]  jump
+.L1305:
+	movl	%eax, %esi	# 10161	[c=4 l=2]  *movsi_internal/0
+	movq	%rbx, %rdi	# 10162	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 10163	[c=0 l=5]  *call
+	leaq	flag_update_table_sub8(%rip), %r11	# 15719	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 15717	[c=1 l=7]  *movdi_internal/4
+	jmp	.L1306	# 18871	[c=1 l=5]  jump
+.L1357:
+	movl	$59, %esi	# 10752	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 10753	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 10754	[c=0 l=5]  *call
+	leaq	flag_update_table_sub8(%rip), %r11	# 15787	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 15785	[c=1 l=7]  *movdi_internal/4
+	jmp	.L1358	# 18873	[c=1 l=5]  jump
+.L1354:
+	movl	$59, %esi	# 10716	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 10717	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 10718	[c=10 l=5]  *call_value
+	leaq	flag_update_table_sub8(%rip), %r11	# 15783	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 15781	[c=1 l=7]  *movdi_internal/4
+	movl	%eax, %edx	# 10719	[c=4 l=2]  *movsi_internal/0
+	jmp	.L1355	# 18875	[c=1 l=5]  jump
+.L1342:
+	movl	$59, %esi	# 10554	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 10555	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 10556	[c=0 l=5]  *call
+	leaq	flag_update_table_sub8(%rip), %r11	# 15771	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 15769	[c=1 l=7]  *movdi_internal/4
+	jmp	.L1343	# 18877	[c=1 l=5]  jump
+.L1339:
+	movl	$59, %esi	# 10518	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 10519	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 10520	[c=10 l=5]  *call_value
+	leaq	flag_update_table_sub8(%rip), %r11	# 15767	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 15765	[c=1 l=7]  *movdi_internal/4
+	movl	%eax, %edx	# 10521	[c=4 l=2]  *movsi_internal/0
+	jmp	.L1340	# 18879	[c=1 l=5]  jump
+.L1061:
+	movq	%rbx, %rdi	# 5985	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 5986	[c=10 l=5]  *call_value
+	leaq	flag_update_table_sub8(%rip), %r11	# 15469	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 15467	[c=1 l=7]  *movdi_internal/4
+	jmp	.L1062	# 18881	[c=1 l=5]  jump
+.L752:
+	movl	%ecx, %edx	# 2148	[c=4 l=2]  *movsi_internal/0
+	movl	%eax, %esi	# 2149	[c=4 l=2]  *movsi_internal/0
+	movq	%rbx, %rdi	# 2150	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 2151	[c=0 l=5]  *call
+	leaq	flag_update_table_sub8(%rip), %r11	# 15063	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 15061	[c=1 l=7]  *movdi_internal/4
+	jmp	.L753	# 18883	[c=1 l=5]  jump
+.L749:
+	movl	%ecx, %edx	# 2121	[c=4 l=2]  *movsi_internal/0
+	movl	%r15d, %esi	# 2122	[c=4 l=3]  *movsi_internal/0
+	movq	%rbx, %rdi	# 2123	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, 16(%rsp)	# 15054	[c=4 l=4]  *movsi_internal/1
+	call	data_write_page	# 2124	[c=0 l=5]  *call
+	movl	16(%rsp), %eax	# 15055	[c=9 l=4]  *movsi_internal/0
+	leaq	flag_update_table_sub8(%rip), %r11	# 15059	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 15057	[c=1 l=7]  *movdi_internal/4
+	jmp	.L750	# 18885	[c=1 l=5]  jump
+.L763:
+	movl	$60, %esi	# 2251	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 2252	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 2253	[c=10 l=5]  *call_value
+	leaq	flag_update_table_sub8(%rip), %r11	# 15079	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 15077	[c=1 l=7]  *movdi_internal/4
+	movl	%eax, %esi	# 2254	[c=4 l=2]  *movsi_internal/0
+	jmp	.L764	# 18887	[c=1 l=5]  jump
+.L776:
+	movl	$59, %esi	# 2406	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 2407	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 2408	[c=10 l=5]  *call_value
+	leaq	flag_update_table_sub8(%rip), %r11	# 15095	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 15093	[c=1 l=7]  *movdi_internal/4
+	jmp	.L777	# 18889	[c=1 l=5]  jump
+.L969:
+	movl	%ecx, %esi	# 4830	[c=4 l=2]  *movsi_internal/0
+	movq	%rbx, %rdi	# 4831	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 4832	[c=0 l=5]  *call
+	leaq	flag_update_table_sub8(%rip), %r11	# 15333	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 15331	[c=1 l=7]  *movdi_internal/4
+	jmp	.L970	# 18891	[c=1 l=5]  jump
+.L966:
+	movl	%esi, %edx	# 4802	[c=4 l=2]  *movsi_internal/0
+	movq	%rbx, %rdi	# 4804	[c=4 l=3]  *movdi_internal/3
+	movl	%r14d, %esi	# 4803	[c=4 l=3]  *movsi_internal/0
+	movl	%ecx, 16(%rsp)	# 15324	[c=4 l=4]  *movsi_internal/1
+	call	data_write_page	# 4805	[c=0 l=5]  *call
+	movl	16(%rsp), %ecx	# 15325	[c=9 l=4]  *movsi_internal/0
+	leaq	flag_update_table_sub8(%rip), %r11	# 15329	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 15327	[c=1 l=7]  *movdi_internal/4
+	jmp	.L967	# 18893	[c=1 l=5]  jump
+.L701:
+	movl	%ecx, %edx	# 1428	[c=4 l=2]  *movsi_internal/0
+	movl	%r8d, %esi	# 1429	[c=4 l=3]  *movsi_internal/0
+	movq	%rbx, %rdi	# 1430	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, 16(%rsp)	# 15002	[c=4 l=4]  *movsi_internal/1
+	call	data_write_page	# 1431	[c=0 l=5]  *call
+	movl	16(%rsp), %eax	# 15003	[c=9 l=4]  *movsi_internal/0
+	leaq	flag_update_table_sub8(%rip), %r11	# 15007	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 15005	[c=1 l=7]  *movdi_internal/4
+	jmp	.L702	# 18895	[c=1 l=5]  jump
+.L698:
+	movl	%esi, %edx	# 1401	[c=4 l=2]  *movsi_internal/0
+	movq	%rbx, %rdi	# 1403	[c=4 l=3]  *movdi_internal/3
+	movl	%r15d, %esi	# 1402	[c=4 l=3]  *movsi_internal/0
+	movl	%r8d, 16(%rsp)	# 14996	[c=4 l=5]  *movsi_internal/1
+	call	data_write_page	# 1404	[c=0 l=5]  *call
+	movl	16(%rsp), %r8d	# 14997	[c=9 l=5]  *movsi_internal/0
+	leaq	flag_update_table_sub8(%rip), %r11	# 15001	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 14999	[c=1 l=7]  *movdi_internal/4
+	jmp	.L699	# 18897	[c=1 l=5]  jump
+.L770:
+	movl	$60, %esi	# 2340	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 2341	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 2342	[c=10 l=5]  *call_value
+	leaq	flag_update_table_sub8(%rip), %r11	# 15087	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 15085	[c=1 l=7]  *movdi_internal/4
+	movl	%eax, %esi	# 2343	[c=4 l=2]  *movsi_internal/0
+	jmp	.L771	# 18899	[c=1 l=5]  jump
+.L720:
+	movl	%ecx, %edx	# 1620	[c=4 l=2]  *movsi_internal/0
+	movl	%r13d, %esi	# 1621	[c=4 l=3]  *movsi_internal/0
+	movq	%rbx, %rdi	# 1622	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 1623	[c=0 l=5]  *call
+	leaq	flag_update_table_sub8(%rip), %r11	# 15035	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 15033	[c=1 l=7]  *movdi_internal/4
+	jmp	.L721	# 18901	[c=1 l=5]  jump
+.L715:
+	movl	%r13d, %esi	# 1583	[c=4 l=3]  *movsi_internal/0
+	movq	%rbx, %rdi	# 1584	[c=4 l=3]  *movdi_internal/3
+	movl	%edx, 16(%rsp)	# 15026	[c=4 l=4]  *movsi_internal/1
+	call	data_read_page	# 1585	[c=10 l=5]  *call_value
+	movl	16(%rsp), %edx	# 15027	[c=9 l=4]  *movsi_internal/0
+	leaq	flag_update_table_sub8(%rip), %r11	# 15031	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 15029	[c=1 l=7]  *movdi_internal/4
+	movl	%eax, %esi	# 1586	[c=4 l=2]  *movsi_internal/0
+	jmp	.L716	# 18903	[c=1 l=5]  jump
+.L780:
+	movl	$59, %esi	# 2452	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 2453	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 2454	[c=10 l=5]  *call_value
+	leaq	flag_update_table_sub8(%rip), %r11	# 15099	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 15097	[c=1 l=7]  *movdi_internal/4
+	jmp	.L781	# 18905	[c=1 l=5]  jump
+.L1826:
+	xorl	%eax, %eax	# 18378	[c=4 l=2]  *movsi_xor
+	movq	%rbx, %rdi	# 626	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, 96(%rbx)	# 18379	[c=4 l=3]  *movsi_internal/1
+	call	do_events	# 627	[c=0 l=5]  *call
+	leaq	flag_update_table_sub8(%rip), %r11	# 14965	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 14963	[c=1 l=7]  *movdi_internal/4
+	jmp	.L658	# 18907	[c=1 l=5]  jump
+.L1055:
+	movq	%rbx, %rdi	# 5912	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 5913	[c=10 l=5]  *call_value
+	leaq	flag_update_table_sub8(%rip), %r11	# 15461	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 15459	[c=1 l=7]  *movdi_internal/4
+	jmp	.L1056	# 18909	[c=1 l=5]  jump
+.L1049:
+	movq	%rbx, %rdi	# 5839	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 5840	[c=10 l=5]  *call_value
+	leaq	flag_update_table_sub8(%rip), %r11	# 15453	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 15451	[c=1 l=7]  *movdi_internal/4
+	jmp	.L1050	# 18911	[c=1 l=5]  jump
+.L1043:
+	movq	%rbx, %rdi	# 5766	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 5767	[c=10 l=5]  *call_value
+	leaq	flag_update_table_sub8(%rip), %r11	# 15445	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 15443	[c=1 l=7]  *movdi_internal/4
+	jmp	.L1044	# 18913	[c=1 l=5]  jump
+.L1039:
+	movl	%r13d, %esi	# 5725	[c=4 l=3]  *movsi_internal/0
+	movq	%rbx, %rdi	# 5726	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 5727	[c=0 l=5]  *call
+	leaq	flag_update_table_sub8(%rip), %r11	# 15441	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 15439	[c=1 l=7]  *movdi_internal/4
+	jmp	.L1040	# 18915	[c=1 l=5]  jump
+.L1034:
+	movl	%r13d, %esi	# 5688	[c=4 l=3]  *movsi_internal/0
+	movq	%rbx, %rdi	# 5689	[c=4 l=3]  *movdi_internal/3
+	movl	%edx, 16(%rsp)	# 15432	[c=4 l=4]  *movsi_internal/1
+	call	data_read_page	# 5690	[c=10 l=5]  *call_value
+	movl	16(%rsp), %edx	# 15433	[c=9 l=4]  *movsi_internal/0
+	leaq	flag_update_table_sub8(%rip), %r11	# 15437	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 15435	[c=1 l=7]  *movdi_internal/4
+	jmp	.L1035	# 18917	[c=1 l=5]  jump
+.L787:
+	movl	$59, %esi	# 2535	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 2536	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 2537	[c=0 l=5]  *call
+	leaq	flag_update_table_sub8(%rip), %r11	# 15107	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 15105	[c=1 l=7]  *movdi_internal/4
+	jmp	.L788	# 18919	[c=1 l=5]  jump
+.L784:
+	movl	$59, %esi	# 2499	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 2500	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 2501	[c=10 l=5]  *call_value
+	leaq	flag_update_table_sub8(%rip), %r11	# 15103	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 15101	[c=1 l=7]  *movdi_internal/4
+	movl	%eax, %edx	# 2502	[c=4 l=2]  *movsi_internal/0
+	jmp	.L785	# 18921	[c=1 l=5]  jump
+.L1781:
+	movl	8(%rcx), %eax	# 11894	[c=10 l=3]  *zero_extendsidi2/3
+	movq	(%rcx), %r13	# 11901	[c=5 l=3]  *movdi_internal/3
+	leaq	.LC38(%rip), %r8	# 80	[c=1 l=7]  *movdi_internal/4
+	movq	1040(%rbx), %rdx	# 11909	[c=9 l=7]  *movdi_internal/3
+	salq	$4, %rax	# 11896	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %rax	# 11897	[c=13 l=7]  *adddi_1/1
+	movq	%r14, (%rax)	# 11898	[c=4 l=3]  *movdi_internal/5
+	movzbl	11(%r15), %eax	# 11899	[c=9 l=5]  *movqi_internal/4
+	movb	%al, 16(%rsp)	# 14913	[c=4 l=4]  *movqi_internal/8
+	movzwl	14(%r15), %eax	# 11900	[c=9 l=5]  *movhi_internal/2
+	movw	%ax, 24(%rsp)	# 14914	[c=4 l=5]  *movhi_internal/3
+	movq	40(%rbx), %rax	# 11902	[c=9 l=4]  *movdi_internal/3
+	movq	%rax, 32(%rsp)	# 14915	[c=4 l=5]  *movdi_internal/5
+	movq	32(%rcx), %rax	# 11903	[c=9 l=4]  *movdi_internal/3
+	movq	%rax, 40(%rsp)	# 14916	[c=4 l=5]  *movdi_internal/5
+	movq	48(%rbx), %rax	# 11904	[c=9 l=4]  *movdi_internal/3
+	movq	%rax, 48(%rsp)	# 14917	[c=4 l=5]  *movdi_internal/5
+	movq	40(%rcx), %rax	# 11905	[c=9 l=4]  *movdi_internal/3
+	movq	%rax, 56(%rsp)	# 14918	[c=4 l=5]  *movdi_internal/5
+	xorl	%eax, %eax	# 18146	[c=4 l=2]  *movdi_xor
+	movq	%rax, (%rcx)	# 18147	[c=4 l=3]  *movdi_internal/5
+	movq	96(%rcx), %rax	# 11908	[c=9 l=4]  *movdi_internal/3
+	addl	$1, 112(%r13)	# 11907	[c=13 l=5]  *addsi_1/0
+	movzbl	63(%rdx), %edx	# 11910	[c=9 l=4]  *movqi_internal/4
+	movb	%dl, 63(%rax)	# 11911	[c=4 l=3]  *movqi_internal/8
+	movq	1040(%rbx), %r9	# 11912	[c=9 l=7]  *movdi_internal/3
+	movzbl	100(%rbx), %esi	# 11913	[c=13 l=4]  *zero_extendqisi2/0
+	movzbl	63(%r9), %edx	# 11914	[c=13 l=5]  *zero_extendqisi2/0
+	movl	%esi, %eax	# 16888	[c=4 l=2]  *movsi_internal/0
+	notl	%esi	# 11916	[c=4 l=2]  *one_cmplsi2_1/0
+	andl	%esi, %edx	# 11917	[c=4 l=2]  *andsi_1/0
+	movq	104(%rbx), %rsi	# 11918	[c=9 l=4]  *movdi_internal/3
+	andb	(%rsi), %al	# 11919	[c=9 l=2]  *andqi_1/1
+	movzbl	%al, %eax	# 11920	[c=4 l=3]  *zero_extendqisi2/0
+	orl	%edx, %eax	# 11921	[c=4 l=2]  *iorsi_1/0
+	movzbl	72(%rcx), %edx	# 11922	[c=13 l=4]  *zero_extendqisi2/0
+	cmpl	%edx, %eax	# 11923	[c=4 l=2]  *cmpsi_1/0
+	je	.L1832	# 11924	[c=13 l=6]  *jcc
+.L1437:
+	cmpl	$0, 600(%rbx)	# 12003	[c=13 l=7]  *cmpsi_ccno_1/1
+	movb	$1, 48(%r13)	# 12001	[c=4 l=5]  *movqi_internal/8
+	je	.L635	# 12004	[c=13 l=6]  *jcc
+	movq	0(%r13), %rdx	# 12006	[c=5 l=4]  *movdi_internal/3
+	movl	36(%r13), %ecx	# 12007	[c=9 l=4]  *movsi_internal/0
+	leaq	.LC55(%rip), %rsi	# 12014	[c=1 l=7]  *movdi_internal/4
+	xorl	%eax, %eax	# 18144	[c=4 l=2]  *movdi_xor
+	movq	904(%rbx), %rdi	# 12009	[c=9 l=7]  *movdi_internal/3
+	addl	%ecx, %ecx	# 12008	[c=4 l=2]  *ashlsi3_1/0
+	movq	%rdx, %r9	# 12010	[c=4 l=3]  *movdi_internal/3
+	call	fprintf@PLT	# 12018	[c=10 l=5]  *call_value
+	leaq	flag_update_table_add8(%rip), %r10	# 15975	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_sub8(%rip), %r11	# 15977	[c=1 l=7]  *movdi_internal/4
+	movq	%r12, %rdx	# 17181	[c=4 l=3]  *movdi_internal/3
+	movq	%r10, %rcx	# 17180	[c=4 l=3]  *movdi_internal/3
+	movq	%r11, %rax	# 17182	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 17183	[c=4 l=3]  *indirect_jump
+.L1779:
+	xorl	%r8d, %r8d	# 18167	[c=4 l=3]  *movdi_xor
+	movl	$1, %ecx	# 10879	[c=4 l=5]  *movsi_internal/0
+	movl	$26, %edx	# 10880	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 10882	[c=4 l=3]  *movdi_internal/3
+	movl	$1, %r9d	# 10877	[c=4 l=6]  *movsi_internal/0
+	call	ramp_indirect	# 10883	[c=0 l=5]  *call
+	leaq	flag_update_table_add8(%rip), %r10	# 15797	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_sub8(%rip), %r11	# 15799	[c=1 l=7]  *movdi_internal/4
+	jmp	.L1368	# 18924	[c=1 l=5]  jump
+.L1772:
+	xorl	%r9d, %r9d	# 18291	[c=4 l=3]  *movdi_xor
+	xorl	%r8d, %r8d	# 18292	[c=4 l=3]  *movdi_xor
+	movl	$1, %ecx	# 4002	[c=4 l=5]  *movsi_internal/0
+	movl	$30, %edx	# 4003	[c=4 l=5]  *movsi_internal/0
+	movl	%r13d, %esi	# 4004	[c=4 l=3]  *movsi_internal/0
+	movq	%rbx, %rdi	# 4005	[c=4 l=3]  *movdi_internal/3
+	call	ramp_indirect	# 4006	[c=0 l=5]  *call
+	leaq	flag_update_table_add8(%rip), %r10	# 15269	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_sub8(%rip), %r11	# 15271	[c=1 l=7]  *movdi_internal/4
+	jmp	.L914	# 18926	[c=1 l=5]  jump
+.L1771:
+	xorl	%r9d, %r9d	# 18293	[c=4 l=3]  *movdi_xor
+	xorl	%r8d, %r8d	# 18294	[c=4 l=3]  *movdi_xor
+	orl	$-1, %ecx	# 18295	[c=4 l=3]  *movsi_or
+	movl	$30, %edx	# 3944	[c=4 l=5]  *movsi_internal/0
+	movl	%r13d, %esi	# 3945	[c=4 l=3]  *movsi_internal/0
+	movq	%rbx, %rdi	# 3946	[c=4 l=3]  *movdi_internal/3
+	call	ramp_indirect	# 3947	[c=0 l=5]  *call
+	leaq	flag_update_table_add8(%rip), %r10	# 15261	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_sub8(%rip), %r11	# 15263	[c=1 l=7]  *movdi_internal/4
+	jmp	.L908	# 18928	[c=1 l=5]  jump
+.L1770:
+	xorl	%r9d, %r9d	# 18296	[c=4 l=3]  *movdi_xor
+	xorl	%r8d, %r8d	# 18297	[c=4 l=3]  *movdi_xor
+	movl	$1, %ecx	# 3882	[c=4 l=5]  *movsi_internal/0
+	movl	$28, %edx	# 3883	[c=4 l=5]  *movsi_internal/0
+	movl	%r13d, %esi	# 3884	[c=4 l=3]  *movsi_internal/0
+	movq	%rbx, %rdi	# 3885	[c=4 l=3]  *movdi_internal/3
+	call	ramp_indirect	# 3886	[c=0 l=5]  *call
+	leaq	flag_update_table_add8(%rip), %r10	# 15253	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_sub8(%rip), %r11	# 15255	[c=1 l=7]  *movdi_internal/4
+	jmp	.L902	# 18930	[c=1 l=5]  jump
+.L1769:
+	xorl	%r9d, %r9d	# 18298	[c=4 l=3]  *movdi_xor
+	xorl	%r8d, %r8d	# 18299	[c=4 l=3]  *movdi_xor
+	orl	$-1, %ecx	# 18300	[c=4 l=3]  *movsi_or
+	movl	$28, %edx	# 3824	[c=4 l=5]  *movsi_internal/0
+	movl	%r13d, %esi	# 3825	[c=4 l=3]  *movsi_internal/0
+	movq	%rbx, %rdi	# 3826	[c=4 l=3]  *movdi_internal/3
+	call	ramp_indirect	# 3827	[c=0 l=5]  *call
+	leaq	flag_update_table_add8(%rip), %r10	# 15245	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_sub8(%rip), %r11	# 15247	[c=1 l=7]  *movdi_internal/4
+	jmp	.L896	# 18932	[c=1 l=5]  jump
+.L1816:
+	xorl	%r9d, %r9d	# 18310	[c=4 l=3]  *movdi_xor
+	movl	%r14d, %r8d	# 3442	[c=4 l=3]  *movsi_internal/0
+	xorl	%ecx, %ecx	# 18311	[c=4 l=2]  *movdi_xor
+	movl	$30, %edx	# 3444	[c=4 l=5]  *movsi_internal/0
+	movl	%r13d, %esi	# 3445	[c=4 l=3]  *movsi_internal/0
+	movq	%rbx, %rdi	# 3446	[c=4 l=3]  *movdi_internal/3
+	call	ramp_indirect	# 3447	[c=0 l=5]  *call
+	leaq	flag_update_table_add8(%rip), %r10	# 15201	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_sub8(%rip), %r11	# 15203	[c=1 l=7]  *movdi_internal/4
+	jmp	.L858	# 18934	[c=1 l=5]  jump
+.L1822:
+	movl	$1, %r9d	# 7058	[c=4 l=6]  *movsi_internal/0
+	xorl	%r8d, %r8d	# 18222	[c=4 l=3]  *movdi_xor
+	orl	$-1, %ecx	# 18223	[c=4 l=3]  *movsi_or
+	movq	%rbx, %rdi	# 7063	[c=4 l=3]  *movdi_internal/3
+	movl	$30, %edx	# 7061	[c=4 l=5]  *movsi_internal/0
+	call	ramp_indirect	# 7064	[c=0 l=5]  *call
+	leaq	flag_update_table_add8(%rip), %r10	# 15601	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_sub8(%rip), %r11	# 15603	[c=1 l=7]  *movdi_internal/4
+	jmp	.L1152	# 18936	[c=1 l=5]  jump
+.L1768:
+	xorl	%r9d, %r9d	# 18301	[c=4 l=3]  *movdi_xor
+	xorl	%r8d, %r8d	# 18302	[c=4 l=3]  *movdi_xor
+	movl	$1, %ecx	# 3762	[c=4 l=5]  *movsi_internal/0
+	movl	$26, %edx	# 3763	[c=4 l=5]  *movsi_internal/0
+	movl	%r13d, %esi	# 3764	[c=4 l=3]  *movsi_internal/0
+	movq	%rbx, %rdi	# 3765	[c=4 l=3]  *movdi_internal/3
+	call	ramp_indirect	# 3766	[c=0 l=5]  *call
+	leaq	flag_update_table_add8(%rip), %r10	# 15237	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_sub8(%rip), %r11	# 15239	[c=1 l=7]  *movdi_internal/4
+	jmp	.L890	# 18938	[c=1 l=5]  jump
+.L1731:
+	xorl	%r9d, %r9d	# 18173	[c=4 l=3]  *movdi_xor
+	xorl	%r8d, %r8d	# 18174	[c=4 l=3]  *movdi_xor
+	movl	$1, %ecx	# 10306	[c=4 l=5]  *movsi_internal/0
+	movl	$30, %edx	# 10307	[c=4 l=5]  *movsi_internal/0
+	movl	%r13d, %esi	# 10308	[c=4 l=3]  *movsi_internal/0
+	movq	%rbx, %rdi	# 10309	[c=4 l=3]  *movdi_internal/3
+	call	ramp_indirect	# 10310	[c=0 l=5]  *call
+	leaq	flag_update_table_add8(%rip), %r10	# 15741	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_sub8(%rip), %r11	# 15743	[c=1 l=7]  *movdi_internal/4
+	jmp	.L1343	# 18940	[c=1 l=5]  jump
+.L1735:
+	xorl	%r9d, %r9d	# 18169	[c=4 l=3]  *movdi_xor
+	xorl	%r8d, %r8d	# 18170	[c=4 l=3]  *movdi_xor
+	movl	$1, %ecx	# 10424	[c=4 l=5]  *movsi_internal/0
+	movl	$30, %edx	# 10425	[c=4 l=5]  *movsi_internal/0
+	movl	%r13d, %esi	# 10426	[c=4 l=3]  *movsi_internal/0
+	movq	%rbx, %rdi	# 10427	[c=4 l=3]  *movdi_internal/3
+	call	ramp_indirect	# 10428	[c=0 l=5]  *call
+	leaq	flag_update_table_add8(%rip), %r10	# 15757	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_sub8(%rip), %r11	# 15759	[c=1 l=7]  *movdi_internal/4
+	jmp	.L1332	# 18942	[c=1 l=5]  jump
+.L1733:
+	xorl	%r9d, %r9d	# 18171	[c=4 l=3]  *movdi_xor
+	xorl	%r8d, %r8d	# 18172	[c=4 l=3]  *movdi_xor
+	movl	$1, %ecx	# 10365	[c=4 l=5]  *movsi_internal/0
+	movl	$28, %edx	# 10366	[c=4 l=5]  *movsi_internal/0
+.L1577:
+	movl	%r13d, %esi	# 10367	[c=4 l=3]  *movsi_internal/0
+	movq	%rbx, %rdi	# 10368	[c=4 l=3]  *movdi_internal/3
+	call	ramp_indirect	# 10369	[c=0 l=5]  *call
+	leaq	flag_update_table_add8(%rip), %r10	# 15749	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_sub8(%rip), %r11	# 15751	[c=1 l=7]  *movdi_internal/4
+	jmp	.L1326	# 18944	[c=1 l=5]  jump
+.L1786:
+	xorl	%r9d, %r9d	# 18175	[c=4 l=3]  *movdi_xor
+	xorl	%r8d, %r8d	# 18176	[c=4 l=3]  *movdi_xor
+	movl	$1, %ecx	# 10247	[c=4 l=5]  *movsi_internal/0
+	movl	$26, %edx	# 10248	[c=4 l=5]  *movsi_internal/0
+	jmp	.L1577	# 18946	[c=1 l=2]  jump
+.L1784:
+	xorl	%r9d, %r9d	# 18303	[c=4 l=3]  *movdi_xor
+	xorl	%r8d, %r8d	# 18304	[c=4 l=3]  *movdi_xor
+	orl	$-1, %ecx	# 18305	[c=4 l=3]  *movsi_or
+	movl	$26, %edx	# 3704	[c=4 l=5]  *movsi_internal/0
+	movl	%r13d, %esi	# 3705	[c=4 l=3]  *movsi_internal/0
+	movq	%rbx, %rdi	# 3706	[c=4 l=3]  *movdi_internal/3
+	call	ramp_indirect	# 3707	[c=0 l=5]  *call
+	leaq	flag_update_table_add8(%rip), %r10	# 15229	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_sub8(%rip), %r11	# 15231	[c=1 l=7]  *movdi_internal/4
+	jmp	.L884	# 18948	[c=1 l=5]  jump
+.L1782:
+	xorl	%r9d, %r9d	# 18306	[c=4 l=3]  *movdi_xor
+	xorl	%r8d, %r8d	# 18307	[c=4 l=3]  *movdi_xor
+	xorl	%ecx, %ecx	# 18308	[c=4 l=2]  *movdi_xor
+	movl	$26, %edx	# 3645	[c=4 l=5]  *movsi_internal/0
+	movl	%r13d, %esi	# 3646	[c=4 l=3]  *movsi_internal/0
+	movq	%rbx, %rdi	# 3647	[c=4 l=3]  *movdi_internal/3
+	call	ramp_indirect	# 3648	[c=0 l=5]  *call
+	leaq	flag_update_table_add8(%rip), %r10	# 15221	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_sub8(%rip), %r11	# 15223	[c=1 l=7]  *movdi_internal/4
+	jmp	.L878	# 18950	[c=1 l=5]  jump
+.L1802:
+	movl	$1, %r9d	# 6496	[c=4 l=6]  *movsi_internal/0
+	movl	%r13d, %r8d	# 6497	[c=4 l=3]  *movsi_internal/0
+	xorl	%ecx, %ecx	# 18233	[c=4 l=2]  *movdi_xor
+	movl	$28, %edx	# 6499	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 6501	[c=4 l=3]  *movdi_internal/3
+	call	ramp_indirect	# 6502	[c=0 l=5]  *call
+	leaq	flag_update_table_add8(%rip), %r10	# 15529	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_sub8(%rip), %r11	# 15531	[c=1 l=7]  *movdi_internal/4
+	jmp	.L1098	# 18952	[c=1 l=5]  jump
+.L1799:
+	movl	$1, %r9d	# 6936	[c=4 l=6]  *movsi_internal/0
+	xorl	%r8d, %r8d	# 18225	[c=4 l=3]  *movdi_xor
+	orl	$-1, %ecx	# 18226	[c=4 l=3]  *movsi_or
+	movq	%rbx, %rdi	# 6941	[c=4 l=3]  *movdi_internal/3
+	movl	$28, %edx	# 6939	[c=4 l=5]  *movsi_internal/0
+	call	ramp_indirect	# 6942	[c=0 l=5]  *call
+	leaq	flag_update_table_add8(%rip), %r10	# 15585	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_sub8(%rip), %r11	# 15587	[c=1 l=7]  *movdi_internal/4
+	jmp	.L1140	# 18954	[c=1 l=5]  jump
+.L1798:
+	movl	$1, %r9d	# 6814	[c=4 l=6]  *movsi_internal/0
+	xorl	%r8d, %r8d	# 18228	[c=4 l=3]  *movdi_xor
+	orl	$-1, %ecx	# 18229	[c=4 l=3]  *movsi_or
+	movq	%rbx, %rdi	# 6819	[c=4 l=3]  *movdi_internal/3
+	movl	$26, %edx	# 6817	[c=4 l=5]  *movsi_internal/0
+	call	ramp_indirect	# 6820	[c=0 l=5]  *call
+	leaq	flag_update_table_add8(%rip), %r10	# 15569	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_sub8(%rip), %r11	# 15571	[c=1 l=7]  *movdi_internal/4
+	jmp	.L1128	# 18956	[c=1 l=5]  jump
+.L1797:
+	movl	$1, %r9d	# 6754	[c=4 l=6]  *movsi_internal/0
+	xorl	%r8d, %r8d	# 18230	[c=4 l=3]  *movdi_xor
+	xorl	%ecx, %ecx	# 18231	[c=4 l=2]  *movdi_xor
+	movl	$26, %edx	# 6757	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 6759	[c=4 l=3]  *movdi_internal/3
+	call	ramp_indirect	# 6760	[c=0 l=5]  *call
+	leaq	flag_update_table_add8(%rip), %r10	# 15561	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_sub8(%rip), %r11	# 15563	[c=1 l=7]  *movdi_internal/4
+	jmp	.L1122	# 18958	[c=1 l=5]  jump
+.L1815:
+	xorl	%r9d, %r9d	# 18312	[c=4 l=3]  *movdi_xor
+	movl	%r14d, %r8d	# 3380	[c=4 l=3]  *movsi_internal/0
+	xorl	%ecx, %ecx	# 18313	[c=4 l=2]  *movdi_xor
+	movl	$28, %edx	# 3382	[c=4 l=5]  *movsi_internal/0
+	movl	%r13d, %esi	# 3383	[c=4 l=3]  *movsi_internal/0
+	movq	%rbx, %rdi	# 3384	[c=4 l=3]  *movdi_internal/3
+	call	ramp_indirect	# 3385	[c=0 l=5]  *call
+	leaq	flag_update_table_add8(%rip), %r10	# 15193	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_sub8(%rip), %r11	# 15195	[c=1 l=7]  *movdi_internal/4
+	jmp	.L852	# 18960	[c=1 l=5]  jump
+.L1795:
+	movl	$1, %r9d	# 6559	[c=4 l=6]  *movsi_internal/0
+	movl	%r13d, %r8d	# 6560	[c=4 l=3]  *movsi_internal/0
+	xorl	%ecx, %ecx	# 18232	[c=4 l=2]  *movdi_xor
+	movl	$30, %edx	# 6562	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 6564	[c=4 l=3]  *movdi_internal/3
+	call	ramp_indirect	# 6565	[c=0 l=5]  *call
+	leaq	flag_update_table_add8(%rip), %r10	# 15537	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_sub8(%rip), %r11	# 15539	[c=1 l=7]  *movdi_internal/4
+	jmp	.L1104	# 18962	[c=1 l=5]  jump
+.L1800:
+	movl	%r14d, %edx	# 12285	[c=1 l=3]  *zero_extendsidi2/3
+	jmp	.L1087	# 18964	[c=1 l=5]  jump
+.L1787:
+	movl	%ecx, %edx	# 12279	[c=1 l=2]  *zero_extendsidi2/3
+	jmp	.L797	# 18966	[c=1 l=5]  jump
+.L1089:
+	leal	-2(%r14), %eax	# 16273	[c=4 l=4]  *leasi
+	movzbl	1004(%rbx), %ecx	# 6391	[c=9 l=7]  *movqi_internal/4
+	andl	%edx, %eax	# 6390	[c=4 l=2]  *andsi_1/0
+	movl	%eax, %edx	# 6392	[c=1 l=2]  *zero_extendsidi2/3
+	addl	$1, %eax	# 18237	[c=5 l=3]  addsi_1_zext/0
+	movb	%cl, 6052(%rbx,%rdx)	# 6393	[c=4 l=7]  *movqi_internal/8
+	movzbl	1005(%rbx), %edx	# 6394	[c=9 l=7]  *movqi_internal/4
+	movb	%dl, 6052(%rbx,%rax)	# 6397	[c=4 l=7]  *movqi_internal/8
+	jmp	.L1091	# 18968	[c=1 l=5]  jump
+.L799:
+	leal	-2(%rcx), %eax	# 16350	[c=4 l=3]  *leasi
+	movzbl	1004(%rbx), %ecx	# 2676	[c=9 l=7]  *movqi_internal/4
+	andl	%r14d, %eax	# 2675	[c=4 l=3]  *andsi_1/0
+	movl	%eax, %edx	# 2677	[c=1 l=2]  *zero_extendsidi2/3
+	addl	$1, %eax	# 18338	[c=5 l=3]  addsi_1_zext/0
+	movb	%cl, 6052(%rbx,%rdx)	# 2678	[c=4 l=7]  *movqi_internal/8
+	movzbl	1005(%rbx), %edx	# 2679	[c=9 l=7]  *movqi_internal/4
+	movb	%dl, 6052(%rbx,%rax)	# 2682	[c=4 l=7]  *movqi_internal/8
+	jmp	.L801	# 18970	[c=1 l=5]  jump
+.L1452:
+	xorl	%edx, %edx	# 18213	[c=4 l=2]  *movdi_xor
+	jmp	.L1197	# 18972	[c=1 l=5]  jump
+.L1454:
+	xorl	%edx, %edx	# 18210	[c=4 l=2]  *movdi_xor
+	jmp	.L1217	# 18974	[c=1 l=5]  jump
+.L1453:
+	xorl	%eax, %eax	# 18211	[c=4 l=2]  *movdi_xor
+	xorl	%edx, %edx	# 18212	[c=4 l=2]  *movdi_xor
+	jmp	.L1207	# 18976	[c=1 l=5]  jump
+.L1451:
+	xorl	%eax, %eax	# 18214	[c=4 l=2]  *movdi_xor
+	jmp	.L1187	# 18978	[c=1 l=5]  jump
+.L1750:
+	movl	$61, %esi	# 4728	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 4729	[c=4 l=3]  *movdi_internal/3
+	movl	%edx, 16(%rsp)	# 15310	[c=4 l=4]  *movsi_internal/1
+	call	data_read_mapped	# 4730	[c=10 l=5]  *call_value
+	movl	16(%rsp), %edx	# 15311	[c=9 l=4]  *movsi_internal/0
+	leaq	flag_update_table_add8(%rip), %r10	# 15313	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_sub8(%rip), %r11	# 15315	[c=1 l=7]  *movdi_internal/4
+	movl	%eax, %ecx	# 4731	[c=4 l=2]  *movsi_internal/0
+	movl	$62, %eax	# 4732	[c=4 l=5]  *movsi_internal/0
+	subl	%r15d, %eax	# 4733	[c=4 l=3]  *subsi_1/0
+	cmpl	%edx, %eax	# 4734	[c=4 l=2]  *cmpsi_1/0
+	jnb	.L962	# 4735	[c=13 l=6]  *jcc
+	movq	1040(%rbx), %rax	# 12282	[c=9 l=7]  *movdi_internal/3
+	jmp	.L961	# 18980	[c=1 l=5]  jump
+.L1124:
+	movzbl	%cl, %edx	# 6787	[c=4 l=3]  *zero_extendqisi2/0
+	movq	%rbx, %rdi	# 6790	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 6791	[c=0 l=5]  *call
+	leaq	flag_update_table_sub8(%rip), %r11	# 15567	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 15565	[c=1 l=7]  *movdi_internal/4
+	jmp	.L1125	# 18982	[c=1 l=5]  jump
+.L1106:
+	movq	%rbx, %rdi	# 6594	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 6595	[c=0 l=5]  *call
+	leaq	flag_update_table_sub8(%rip), %r11	# 15543	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 15541	[c=1 l=7]  *movdi_internal/4
+	jmp	.L1107	# 18984	[c=1 l=5]  jump
+.L886:
+	movl	%r14d, %esi	# 3732	[c=4 l=3]  *movsi_internal/0
+	movq	%rbx, %rdi	# 3733	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 3734	[c=10 l=5]  *call_value
+	leaq	flag_update_table_sub8(%rip), %r11	# 15235	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 15233	[c=1 l=7]  *movdi_internal/4
+	movl	%eax, %edx	# 3735	[c=4 l=2]  *movsi_internal/0
+	jmp	.L887	# 18986	[c=1 l=5]  jump
+.L880:
+	movq	%rbx, %rdi	# 3674	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 3675	[c=10 l=5]  *call_value
+	leaq	flag_update_table_sub8(%rip), %r11	# 15227	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 15225	[c=1 l=7]  *movdi_internal/4
+	movl	%eax, %edx	# 3676	[c=4 l=2]  *movsi_internal/0
+	jmp	.L881	# 18988	[c=1 l=5]  jump
+.L1322:
+	movl	%r14d, %esi	# 10335	[c=4 l=3]  *movsi_internal/0
+	movq	%rbx, %rdi	# 10336	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 10337	[c=10 l=5]  *call_value
+	leaq	flag_update_table_sub8(%rip), %r11	# 15747	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 15745	[c=1 l=7]  *movdi_internal/4
+	movl	%eax, %edx	# 10338	[c=4 l=2]  *movsi_internal/0
+	jmp	.L1323	# 18990	[c=1 l=5]  jump
+.L1334:
+	movl	%r14d, %esi	# 10453	[c=4 l=3]  *movsi_internal/0
+	movq	%rbx, %rdi	# 10454	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 10455	[c=10 l=5]  *call_value
+	leaq	flag_update_table_sub8(%rip), %r11	# 15763	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 15761	[c=1 l=7]  *movdi_internal/4
+	movl	%eax, %edx	# 10456	[c=4 l=2]  *movsi_internal/0
+	jmp	.L1335	# 18992	[c=1 l=5]  jump
+.L1328:
+	movl	%r14d, %esi	# 10394	[c=4 l=3]  *movsi_internal/0
+	movq	%rbx, %rdi	# 10395	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 10396	[c=10 l=5]  *call_value
+	leaq	flag_update_table_sub8(%rip), %r11	# 15755	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 15753	[c=1 l=7]  *movdi_internal/4
+	movl	%eax, %edx	# 10397	[c=4 l=2]  *movsi_internal/0
+	jmp	.L1329	# 18994	[c=1 l=5]  jump
+.L1316:
+	movl	%r14d, %esi	# 10276	[c=4 l=3]  *movsi_internal/0
+	movq	%rbx, %rdi	# 10277	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 10278	[c=10 l=5]  *call_value
+	leaq	flag_update_table_sub8(%rip), %r11	# 15739	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 15737	[c=1 l=7]  *movdi_internal/4
+	movl	%eax, %edx	# 10279	[c=4 l=2]  *movsi_internal/0
+	jmp	.L1317	# 18996	[c=1 l=5]  jump
+.L1789:
+	movl	$61, %esi	# 2941	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 2942	[c=4 l=3]  *movdi_internal/3
+	call	data_read_mapped	# 2943	[c=10 l=5]  *call_value
+	leaq	flag_update_table_add8(%rip), %r10	# 15147	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_sub8(%rip), %r11	# 15149	[c=1 l=7]  *movdi_internal/4
+	movl	%eax, %r15d	# 2944	[c=4 l=3]  *movsi_internal/0
+	movl	$62, %eax	# 2945	[c=4 l=5]  *movsi_internal/0
+	subl	%r13d, %eax	# 2946	[c=4 l=3]  *subsi_1/0
+	cmpl	%r14d, %eax	# 2947	[c=4 l=3]  *cmpsi_1/0
+	jnb	.L817	# 2948	[c=13 l=6]  *jcc
+	movq	1040(%rbx), %rax	# 12280	[c=9 l=7]  *movdi_internal/3
+	jmp	.L816	# 18998	[c=1 l=5]  jump
+.L1764:
+	movl	$61, %esi	# 2051	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 2052	[c=4 l=3]  *movdi_internal/3
+	movl	%edx, 16(%rsp)	# 15044	[c=4 l=4]  *movsi_internal/1
+	call	data_read_mapped	# 2053	[c=10 l=5]  *call_value
+	movl	16(%rsp), %edx	# 15045	[c=9 l=4]  *movsi_internal/0
+	leaq	flag_update_table_add8(%rip), %r10	# 15047	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_sub8(%rip), %r11	# 15049	[c=1 l=7]  *movdi_internal/4
+	movl	%eax, %r15d	# 2054	[c=4 l=3]  *movsi_internal/0
+	cmpl	%r14d, %edx	# 2055	[c=4 l=3]  *cmpsi_1/0
+	jnb	.L745	# 2056	[c=13 l=6]  *jcc
+	movq	1040(%rbx), %rax	# 12278	[c=9 l=7]  *movdi_internal/3
+	jmp	.L744	# 19000	[c=1 l=5]  jump
+.L1370:
+	movzbl	%cl, %edx	# 10910	[c=4 l=3]  *zero_extendqisi2/0
+	movl	%r13d, %esi	# 10912	[c=4 l=3]  *movsi_internal/0
+	movq	%rbx, %rdi	# 10913	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 10914	[c=0 l=5]  *call
+	leaq	flag_update_table_sub8(%rip), %r11	# 15803	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 15801	[c=1 l=7]  *movdi_internal/4
+	jmp	.L1371	# 19002	[c=1 l=5]  jump
+.L1142:
+	movl	%r13d, %esi	# 6971	[c=4 l=3]  *movsi_internal/0
+	movq	%rbx, %rdi	# 6972	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 6973	[c=0 l=5]  *call
+	leaq	flag_update_table_sub8(%rip), %r11	# 15591	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 15589	[c=1 l=7]  *movdi_internal/4
+	jmp	.L1143	# 19004	[c=1 l=5]  jump
+.L1810:
+	movl	$61, %esi	# 5200	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 5201	[c=4 l=3]  *movdi_internal/3
+	movl	%edx, 16(%rsp)	# 15386	[c=4 l=4]  *movsi_internal/1
+	call	data_read_mapped	# 5202	[c=10 l=5]  *call_value
+	movl	16(%rsp), %edx	# 15387	[c=9 l=4]  *movsi_internal/0
+	leaq	flag_update_table_add8(%rip), %r10	# 15389	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_sub8(%rip), %r11	# 15391	[c=1 l=7]  *movdi_internal/4
+	movl	%eax, %r14d	# 5203	[c=4 l=3]  *movsi_internal/0
+	movl	$62, %eax	# 5204	[c=4 l=5]  *movsi_internal/0
+	subl	%r15d, %eax	# 5205	[c=4 l=3]  *subsi_1/0
+	cmpl	%edx, %eax	# 5206	[c=4 l=2]  *cmpsi_1/0
+	jnb	.L1006	# 5207	[c=13 l=6]  *jcc
+	movq	1040(%rbx), %rax	# 12284	[c=9 l=7]  *movdi_internal/3
+	jmp	.L1005	# 19006	[c=1 l=5]  jump
+.L916:
+	movl	%r14d, %esi	# 4031	[c=4 l=3]  *movsi_internal/0
+	movq	%rbx, %rdi	# 4032	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 4033	[c=10 l=5]  *call_value
+	leaq	flag_update_table_sub8(%rip), %r11	# 15275	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 15273	[c=1 l=7]  *movdi_internal/4
+	movl	%eax, %edx	# 4034	[c=4 l=2]  *movsi_internal/0
+	jmp	.L917	# 19008	[c=1 l=5]  jump
+.L1130:
+	movl	%r13d, %esi	# 6849	[c=4 l=3]  *movsi_internal/0
+	movq	%rbx, %rdi	# 6850	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 6851	[c=0 l=5]  *call
+	leaq	flag_update_table_sub8(%rip), %r11	# 15575	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 15573	[c=1 l=7]  *movdi_internal/4
+	jmp	.L1131	# 19010	[c=1 l=5]  jump
+.L1154:
+	movl	%r13d, %esi	# 7093	[c=4 l=3]  *movsi_internal/0
+	movq	%rbx, %rdi	# 7094	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 7095	[c=0 l=5]  *call
+	leaq	flag_update_table_sub8(%rip), %r11	# 15607	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 15605	[c=1 l=7]  *movdi_internal/4
+	jmp	.L1155	# 19012	[c=1 l=5]  jump
+.L1737:
+	movl	$61, %esi	# 10090	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 10091	[c=4 l=3]  *movdi_internal/3
+	movb	%dl, 16(%rsp)	# 15704	[c=4 l=4]  *movqi_internal/8
+	call	data_read_mapped	# 10092	[c=10 l=5]  *call_value
+	movzbl	16(%rsp), %edx	# 15705	[c=13 l=5]  *zero_extendqisi2/0
+	leaq	flag_update_table_add8(%rip), %r10	# 15707	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_sub8(%rip), %r11	# 15709	[c=1 l=7]  *movdi_internal/4
+	movl	%eax, %r15d	# 10093	[c=4 l=3]  *movsi_internal/0
+	movl	$62, %eax	# 10094	[c=4 l=5]  *movsi_internal/0
+	subl	%r13d, %eax	# 10095	[c=4 l=3]  *subsi_1/0
+	cmpl	%r14d, %eax	# 10096	[c=4 l=3]  *cmpsi_1/0
+	jnb	.L1301	# 10097	[c=13 l=6]  *jcc
+	movq	1040(%rbx), %rax	# 12295	[c=9 l=7]  *movdi_internal/3
+	jmp	.L1300	# 19014	[c=1 l=5]  jump
+.L1780:
+	movl	$61, %esi	# 11851	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 11852	[c=4 l=3]  *movdi_internal/3
+	movl	%edx, 24(%rsp)	# 15932	[c=4 l=4]  *movsi_internal/1
+	movq	%rcx, 16(%rsp)	# 15930	[c=4 l=5]  *movdi_internal/5
+	call	data_read_mapped	# 11853	[c=10 l=5]  *call_value
+	movl	24(%rsp), %edx	# 15933	[c=9 l=4]  *movsi_internal/0
+	movq	16(%rsp), %rcx	# 15931	[c=9 l=5]  *movdi_internal/3
+	leaq	flag_update_table_add8(%rip), %r10	# 15935	[c=1 l=7]  *movdi_internal/4
+	movl	%eax, %r8d	# 11854	[c=4 l=3]  *movsi_internal/0
+	movl	$62, %eax	# 11855	[c=4 l=5]  *movsi_internal/0
+	leaq	flag_update_table_sub8(%rip), %r11	# 15937	[c=1 l=7]  *movdi_internal/4
+	subl	%edx, %eax	# 11856	[c=4 l=2]  *subsi_1/0
+	cmpl	%r13d, %eax	# 11857	[c=4 l=3]  *cmpsi_1/0
+	jnb	.L1435	# 11858	[c=13 l=6]  *jcc
+	movq	1040(%rbx), %rax	# 12301	[c=9 l=7]  *movdi_internal/3
+	jmp	.L1434	# 19016	[c=1 l=5]  jump
+.L910:
+	movl	%r14d, %esi	# 3972	[c=4 l=3]  *movsi_internal/0
+	movq	%rbx, %rdi	# 3973	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 3974	[c=10 l=5]  *call_value
+	leaq	flag_update_table_sub8(%rip), %r11	# 15267	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 15265	[c=1 l=7]  *movdi_internal/4
+	movl	%eax, %edx	# 3975	[c=4 l=2]  *movsi_internal/0
+	jmp	.L911	# 19018	[c=1 l=5]  jump
+.L904:
+	movl	%r14d, %esi	# 3911	[c=4 l=3]  *movsi_internal/0
+	movq	%rbx, %rdi	# 3912	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 3913	[c=10 l=5]  *call_value
+	leaq	flag_update_table_sub8(%rip), %r11	# 15259	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 15257	[c=1 l=7]  *movdi_internal/4
+	movl	%eax, %edx	# 3914	[c=4 l=2]  *movsi_internal/0
+	jmp	.L905	# 19020	[c=1 l=5]  jump
+.L898:
+	movl	%r14d, %esi	# 3852	[c=4 l=3]  *movsi_internal/0
+	movq	%rbx, %rdi	# 3853	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 3854	[c=10 l=5]  *call_value
+	leaq	flag_update_table_sub8(%rip), %r11	# 15251	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 15249	[c=1 l=7]  *movdi_internal/4
+	movl	%eax, %edx	# 3855	[c=4 l=2]  *movsi_internal/0
+	jmp	.L899	# 19022	[c=1 l=5]  jump
+.L892:
+	movl	%r14d, %esi	# 3791	[c=4 l=3]  *movsi_internal/0
+	movq	%rbx, %rdi	# 3792	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 3793	[c=10 l=5]  *call_value
+	leaq	flag_update_table_sub8(%rip), %r11	# 15243	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 15241	[c=1 l=7]  *movdi_internal/4
+	movl	%eax, %edx	# 3794	[c=4 l=2]  *movsi_internal/0
+	jmp	.L893	# 19024	[c=1 l=5]  jump
+.L854:
+	movq	%rbx, %rdi	# 3410	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 3411	[c=10 l=5]  *call_value
+	leaq	flag_update_table_sub8(%rip), %r11	# 15199	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 15197	[c=1 l=7]  *movdi_internal/4
+	jmp	.L855	# 19026	[c=1 l=5]  jump
+.L860:
+	movq	%rbx, %rdi	# 3472	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 3473	[c=10 l=5]  *call_value
+	leaq	flag_update_table_sub8(%rip), %r11	# 15207	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 15205	[c=1 l=7]  *movdi_internal/4
+	jmp	.L861	# 19028	[c=1 l=5]  jump
+.L1755:
+	movl	$61, %esi	# 1327	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 1328	[c=4 l=3]  *movdi_internal/3
+	movl	%ecx, 24(%rsp)	# 14980	[c=4 l=4]  *movsi_internal/1
+	movl	%edx, 16(%rsp)	# 14978	[c=4 l=4]  *movsi_internal/1
+	call	data_read_mapped	# 1329	[c=10 l=5]  *call_value
+	movl	16(%rsp), %edx	# 14979	[c=9 l=4]  *movsi_internal/0
+	movl	24(%rsp), %ecx	# 14981	[c=9 l=4]  *movsi_internal/0
+	leaq	flag_update_table_add8(%rip), %r10	# 14983	[c=1 l=7]  *movdi_internal/4
+	movl	%eax, %r8d	# 1330	[c=4 l=3]  *movsi_internal/0
+	movl	$62, %eax	# 1331	[c=4 l=5]  *movsi_internal/0
+	leaq	flag_update_table_sub8(%rip), %r11	# 14985	[c=1 l=7]  *movdi_internal/4
+	subl	%edx, %eax	# 1332	[c=4 l=2]  *subsi_1/0
+	cmpl	%ecx, %eax	# 1333	[c=4 l=2]  *cmpsi_1/0
+	jnb	.L694	# 1334	[c=13 l=6]  *jcc
+	movq	1040(%rbx), %rax	# 12277	[c=9 l=7]  *movdi_internal/3
+	jmp	.L693	# 19030	[c=1 l=5]  jump
+.L1806:
+	movl	$61, %esi	# 4971	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 4972	[c=4 l=3]  *movdi_internal/3
+	movl	%edx, 16(%rsp)	# 15350	[c=4 l=4]  *movsi_internal/1
+	call	data_read_mapped	# 4973	[c=10 l=5]  *call_value
+	movl	16(%rsp), %edx	# 15351	[c=9 l=4]  *movsi_internal/0
+	leaq	flag_update_table_add8(%rip), %r10	# 15353	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_sub8(%rip), %r11	# 15355	[c=1 l=7]  *movdi_internal/4
+	movl	%eax, %r14d	# 4974	[c=4 l=3]  *movsi_internal/0
+	movl	$62, %eax	# 4975	[c=4 l=5]  *movsi_internal/0
+	subl	%r15d, %eax	# 4976	[c=4 l=3]  *subsi_1/0
+	cmpl	%edx, %eax	# 4977	[c=4 l=2]  *cmpsi_1/0
+	jnb	.L984	# 4978	[c=13 l=6]  *jcc
+	movq	1040(%rbx), %rax	# 12283	[c=9 l=7]  *movdi_internal/3
+	jmp	.L983	# 19032	[c=1 l=5]  jump
+.L1100:
+	movq	%rbx, %rdi	# 6531	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 6532	[c=0 l=5]  *call
+	leaq	flag_update_table_sub8(%rip), %r11	# 15535	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 15533	[c=1 l=7]  *movdi_internal/4
+	jmp	.L1101	# 19034	[c=1 l=5]  jump
+.L870:
+	movq	%rbx, %rdi	# 3573	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 3574	[c=10 l=5]  *call_value
+	leaq	flag_update_table_sub8(%rip), %r11	# 15215	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 15213	[c=1 l=7]  *movdi_internal/4
+	jmp	.L868	# 19036	[c=1 l=5]  jump
+.L1209:
+	movl	%r13d, %esi	# 7828	[c=4 l=3]  *movsi_internal/0
+	movq	%rbx, %rdi	# 7829	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 7830	[c=0 l=5]  *call
+	leaq	flag_update_table_add8(%rip), %r10	# 15647	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_sub8(%rip), %r11	# 15649	[c=1 l=7]  *movdi_internal/4
+	jmp	.L1210	# 19038	[c=1 l=5]  jump
+.L1199:
+	movl	%r13d, %esi	# 7714	[c=4 l=3]  *movsi_internal/0
+	movq	%rbx, %rdi	# 7715	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 7716	[c=0 l=5]  *call
+	leaq	flag_update_table_add8(%rip), %r10	# 15635	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_sub8(%rip), %r11	# 15637	[c=1 l=7]  *movdi_internal/4
+	jmp	.L1200	# 19040	[c=1 l=5]  jump
+.L1219:
+	movl	%r13d, %esi	# 7941	[c=4 l=3]  *movsi_internal/0
+	movq	%rbx, %rdi	# 7942	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 7943	[c=0 l=5]  *call
+	leaq	flag_update_table_add8(%rip), %r10	# 15659	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_sub8(%rip), %r11	# 15661	[c=1 l=7]  *movdi_internal/4
+	jmp	.L1220	# 19042	[c=1 l=5]  jump
+.L1115:
+	movq	%rbx, %rdi	# 6690	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 6691	[c=0 l=5]  *call
+	leaq	flag_update_table_sub8(%rip), %r11	# 15555	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 15553	[c=1 l=7]  *movdi_internal/4
+	jmp	.L1113	# 19044	[c=1 l=5]  jump
+.L1189:
+	movl	%r15d, %edx	# 7600	[c=4 l=3]  *movsi_internal/0
+	movl	%r13d, %esi	# 7601	[c=4 l=3]  *movsi_internal/0
+	movq	%rbx, %rdi	# 7602	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 7603	[c=0 l=5]  *call
+	leaq	flag_update_table_add8(%rip), %r10	# 15623	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_sub8(%rip), %r11	# 15625	[c=1 l=7]  *movdi_internal/4
+	jmp	.L1190	# 19046	[c=1 l=5]  jump
+.L1393:
+	movl	5176(%rbx), %esi	# 11625	[c=9 l=6]  *movsi_internal/0
+	movl	$61, %eax	# 11629	[c=4 l=5]  *movsi_internal/0
+	movl	5180(%rbx), %ecx	# 11626	[c=9 l=6]  *movsi_internal/0
+	movl	$62, %edx	# 11627	[c=4 l=5]  *movsi_internal/0
+	subl	%esi, %eax	# 11630	[c=4 l=2]  *subsi_1/0
+	subl	%esi, %edx	# 11628	[c=4 l=2]  *subsi_1/0
+	cmpl	%ecx, %eax	# 11631	[c=4 l=2]  *cmpsi_1/0
+	jb	.L1417	# 11632	[c=13 l=6]  *jcc
+	cmpb	$1, 1081(%rbx)	# 11636	[c=13 l=7]  *cmpqi_1/0
+	ja	.L1833	# 11637	[c=13 l=6]  *jcc
+	movq	1040(%rbx), %rax	# 12079	[c=9 l=7]  *movdi_internal/3
+	movzbl	61(%rax), %r14d	# 12080	[c=13 l=5]  *zero_extendqisi2/0
+.L1419:
+	movzbl	62(%rax), %eax	# 11670	[c=13 l=4]  *zero_extendqisi2/0
+.L1421:
+	sall	$8, %eax	# 11673	[c=4 l=3]  *ashlsi3_1/0
+	movl	152(%rsp), %r9d	# 11677	[c=9 l=8]  *movsi_internal/0
+	orl	%r14d, %eax	# 11674	[c=4 l=3]  *iorsi_1/0
+	movl	%eax, 16(%rsp)	# 14891	[c=4 l=4]  *movsi_internal/1
+	movzbl	840(%rbx), %eax	# 11675	[c=13 l=7]  *zero_extendqisi2/0
+	addl	$2, %eax	# 11676	[c=4 l=3]  *addsi_1/0
+	movl	%eax, 24(%rsp)	# 14892	[c=4 l=4]  *movsi_internal/1
+	cmpl	$-1, %r9d	# 11678	[c=4 l=4]  *cmpsi_1/0
+	je	.L1834	# 11679	[c=13 l=6]  *jcc
+.L1422:
+	cmpq	$0, 10976(%rbx)	# 11701	[c=13 l=8]  *cmpdi_ccno_1/1
+	je	.L1835	# 11702	[c=13 l=6]  *jcc
+.L1425:
+	movq	10976(%rbx), %r14	# 11762	[c=9 l=7]  *movdi_internal/3
+	movl	1000(%rbx), %eax	# 11764	[c=9 l=6]  *movsi_internal/0
+	movl	%r9d, 48(%rsp)	# 15922	[c=4 l=5]  *movsi_internal/1
+	movq	1040(%rbx), %rsi	# 11767	[c=9 l=7]  *movdi_internal/3
+	movq	%r8, 40(%rsp)	# 15920	[c=4 l=5]  *movdi_internal/5
+	movq	96(%r14), %rdi	# 11763	[c=9 l=4]  *movdi_internal/3
+	leal	1(%rax), %edx	# 11766	[c=5 l=3]  *leadi
+	call	memcpy@PLT	# 11774	[c=10 l=5]  *call_value
+	movq	40(%rsp), %r8	# 15921	[c=9 l=5]  *movdi_internal/3
+	leaq	48(%r14), %rdx	# 16067	[c=4 l=4]  *leadi
+	movdqu	1004(%rbx), %xmm2	# 11779	[c=13 l=8]  movv1ti_internal/2
+	movq	32(%rsp), %rsi	# 14900	[c=9 l=5]  *movdi_internal/3
+	movq	%rdx, %rdi	# 14899	[c=4 l=3]  *movdi_internal/3
+	movl	$12, %ecx	# 11784	[c=4 l=5]  *movdi_internal/2
+	leaq	104(%r14), %rax	# 16066	[c=4 l=4]  *leadi
+	movups	%xmm2, 104(%r14)	# 14897	[c=4 l=5]  movv1ti_internal/3
+	movdqu	16(%r8), %xmm3	# 11781	[c=13 l=6]  movv1ti_internal/2
+	movups	%xmm3, 120(%r14)	# 14898	[c=4 l=5]  movv1ti_internal/3
+	cmpq	1040(%rbx), %r8	# 12592	[c=13 l=7]  *cmpdi_1/1
+	rep movsl	# 11785	[c=0 l=2]  *rep_movsi
+	movq	96(%r14), %rcx	# 11786	[c=9 l=4]  *movdi_internal/3
+	movq	%rdx, %rdi	# 11796	[c=4 l=3]  *movdi_internal/3
+	cmove	%rcx, %rax	# 12593	[c=8 l=4]  *movdicc_noc/1
+	movq	%rcx, 64(%r14)	# 11787	[c=4 l=4]  *movdi_internal/5
+	movq	%rax, 56(%r14)	# 11793	[c=4 l=4]  *movdi_internal/5
+	call	*16(%r13)	# 11797	[c=0 l=4]  *call
+	movl	48(%rsp), %r9d	# 15923	[c=9 l=5]  *movsi_internal/0
+	cmpl	$-1, 152(%rsp)	# 11798	[c=13 l=8]  *cmpsi_1/0
+	leaq	flag_update_table_add8(%rip), %r10	# 15925	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_sub8(%rip), %r11	# 15927	[c=1 l=7]  *movdi_internal/4
+	jne	.L1430	# 11799	[c=13 l=2]  *jcc
+	movl	24(%rsp), %eax	# 14903	[c=9 l=4]  *movsi_internal/0
+	addl	%eax, 16(%rsp)	# 11801	[c=13 l=4]  *addsi_1/0
+	movq	96(%r14), %rax	# 11802	[c=9 l=4]  *movdi_internal/3
+	movl	16(%rsp), %ecx	# 15981	[c=9 l=4]  *movsi_internal/0
+	movb	%cl, 61(%rax)	# 11803	[c=4 l=3]  *movqi_internal/8
+	movq	96(%r14), %rax	# 11804	[c=9 l=4]  *movdi_internal/3
+	movb	%ch, 62(%rax)	# 18148	[c=4 l=3]  *extzvqi_mem_rex64
+.L1430:
+	movq	1064(%rbx), %rdx	# 11811	[c=9 l=7]  *movdi_internal/3
+	movl	%r9d, %eax	# 11812	[c=1 l=3]  *zero_extendsidi2/3
+	movq	%r13, (%r14)	# 11809	[c=4 l=3]  *movdi_internal/5
+	movq	%r10, %rcx	# 18135	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rax	# 11813	[c=4 l=4]  *ashldi3_1/0
+	movl	%r9d, 8(%r14)	# 11810	[c=4 l=4]  *movsi_internal/1
+	movdqu	40(%rbx), %xmm0	# 14910	[c=13 l=5]  movv2di_internal/2
+	leaq	.L1431(%rip), %rdi	# 11829	[c=1 l=7]  *movdi_internal/4
+	movq	(%rdx,%rax), %rax	# 11815	[c=9 l=4]  *movdi_internal/3
+	movq	%rax, 16(%r14)	# 11816	[c=4 l=4]  *movdi_internal/5
+	movl	16(%rsp), %eax	# 14907	[c=9 l=4]  *movsi_internal/0
+	movl	%eax, 24(%r14)	# 11817	[c=4 l=4]  *movsi_internal/1
+	movzbl	11(%r15), %eax	# 11819	[c=13 l=5]  zero_extendqidi2/0
+	movq	%rax, %xmm1	# 14908	[c=4 l=5]  *movdi_internal/20
+	movzwl	14(%r15), %eax	# 11820	[c=13 l=5]  zero_extendhidi2/0
+	movq	%rax, %xmm4	# 14909	[c=4 l=5]  *movdi_internal/20
+	movq	10976(%rbx), %rax	# 11824	[c=9 l=7]  *movdi_internal/3
+	punpcklqdq	%xmm4, %xmm1	# 11821	[c=4 l=4]  vec_concatv2di/4
+	movl	8(%rax), %eax	# 11825	[c=10 l=3]  *zero_extendsidi2/3
+	psubq	%xmm1, %xmm0	# 11822	[c=4 l=4]  *subv2di3/0
+	movups	%xmm0, 32(%r14)	# 11823	[c=4 l=5]  movv2di_internal/3
+	movq	40(%r13), %r14	# 18134	[c=9 l=4]  *movdi_internal/3
+	salq	$4, %rax	# 11826	[c=4 l=4]  *ashldi3_1/0
+	movq	%rdi, (%rdx,%rax)	# 14912	[c=4 l=4]  *movdi_internal/5
+	movq	%r12, %rdx	# 18136	[c=4 l=3]  *movdi_internal/3
+	movq	%r11, %rax	# 18137	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 18138	[c=4 l=3]  *indirect_jump
+.L1832:
+	movq	56(%rcx), %rsi	# 11928	[c=9 l=4]  *movdi_internal/3
+	movl	$32, %edx	# 11930	[c=4 l=5]  *movdi_internal/2
+	movq	%r9, 72(%rsp)	# 15954	[c=4 l=5]  *movdi_internal/5
+	leaq	1004(%rbx), %rdi	# 16065	[c=4 l=7]  *leadi
+	movq	%rcx, 64(%rsp)	# 15952	[c=4 l=5]  *movdi_internal/5
+	call	memcmp@PLT	# 11933	[c=10 l=5]  *call_value
+	leaq	flag_update_table_add8(%rip), %r10	# 15957	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_sub8(%rip), %r11	# 15959	[c=1 l=7]  *movdi_internal/4
+	testl	%eax, %eax	# 11937	[c=4 l=2]  *cmpsi_ccno_1/0
+	jne	.L1460	# 11938	[c=13 l=6]  *jcc
+	movq	64(%rsp), %rcx	# 15953	[c=9 l=5]  *movdi_internal/3
+	movl	1000(%rbx), %eax	# 11944	[c=9 l=6]  *movsi_internal/0
+	movq	72(%rsp), %rdi	# 18145	[c=9 l=5]  *movdi_internal/3
+	movq	96(%rcx), %rsi	# 11947	[c=9 l=4]  *movdi_internal/3
+	leal	1(%rax), %edx	# 11946	[c=5 l=3]  *leadi
+	call	memcmp@PLT	# 11951	[c=10 l=5]  *call_value
+	movq	64(%rsp), %rcx	# 15947	[c=9 l=5]  *movdi_internal/3
+	leaq	.LC40(%rip), %r8	# 82	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 15949	[c=1 l=7]  *movdi_internal/4
+	testl	%eax, %eax	# 11955	[c=4 l=2]  *cmpsi_ccno_1/0
+	leaq	flag_update_table_sub8(%rip), %r11	# 15951	[c=1 l=7]  *movdi_internal/4
+	jne	.L1437	# 11956	[c=13 l=6]  *jcc
+	movl	32(%rsp), %r8d	# 14919	[c=9 l=5]  *movsi_internal/0
+	movl	40(%rsp), %eax	# 14921	[c=9 l=4]  *movsi_internal/0
+	leaq	48(%rcx), %rsi	# 16062	[c=4 l=4]  *leadi
+	movq	%r13, %rdi	# 11970	[c=4 l=3]  *movdi_internal/3
+	movl	48(%rsp), %r9d	# 14923	[c=9 l=5]  *movsi_internal/0
+	leaq	108(%rsp), %rcx	# 16063	[c=4 l=5]  *leadi
+	leaq	104(%rsp), %rdx	# 16064	[c=4 l=5]  *leadi
+	subl	%eax, %r8d	# 11958	[c=4 l=3]  *subsi_1/0
+	movzbl	16(%rsp), %eax	# 11959	[c=13 l=5]  *zero_extendqisi2/0
+	movq	%rsi, 16(%rsp)	# 15960	[c=4 l=5]  *movdi_internal/5
+	subl	%eax, %r8d	# 11960	[c=4 l=3]  *subsi_1/0
+	movl	56(%rsp), %eax	# 14925	[c=9 l=4]  *movsi_internal/0
+	movl	%r8d, 32(%rsp)	# 15964	[c=4 l=5]  *movsi_internal/1
+	subl	%eax, %r9d	# 11961	[c=4 l=3]  *subsi_1/0
+	movzwl	24(%rsp), %eax	# 11962	[c=13 l=5]  *zero_extendhisi2/0
+	subl	%eax, %r9d	# 11963	[c=4 l=3]  *subsi_1/0
+	movl	%r9d, 24(%rsp)	# 15962	[c=4 l=5]  *movsi_internal/1
+	call	hle_cost@PLT	# 11971	[c=10 l=5]  *call_value
+	movq	16(%rsp), %rsi	# 15961	[c=9 l=5]  *movdi_internal/3
+	movl	24(%rsp), %r9d	# 15963	[c=9 l=5]  *movsi_internal/0
+	leaq	flag_update_table_add8(%rip), %r10	# 15967	[c=1 l=7]  *movdi_internal/4
+	testb	%al, %al	# 11973	[c=4 l=2]  *cmpqi_ccno_1/0
+	movl	32(%rsp), %r8d	# 15965	[c=9 l=5]  *movsi_internal/0
+	leaq	flag_update_table_sub8(%rip), %r11	# 15969	[c=1 l=7]  *movdi_internal/4
+	je	.L1438	# 11974	[c=13 l=6]  *jcc
+	cmpl	104(%rsp), %r8d	# 11976	[c=13 l=5]  *cmpsi_1/1
+	je	.L1439	# 11977	[c=13 l=6]  *jcc
+.L1440:
+	leaq	.LC41(%rip), %r8	# 83	[c=1 l=7]  *movdi_internal/4
+	jmp	.L1437	# 19051	[c=1 l=5]  jump
+.L1446:
+	xorl	%eax, %eax	# 18309	[c=4 l=2]  *movdi_xor
+	jmp	.L868	# 19053	[c=1 l=5]  jump
+.L655:
+	movzwl	1028(%rbx), %r13d	# 519	[c=13 l=8]  *zero_extendhisi2/0
+	movq	%rbx, %rdi	# 521	[c=4 l=3]  *movdi_internal/3
+	movl	%r13d, %esi	# 520	[c=4 l=3]  *movsi_internal/0
+	call	put_argv@PLT	# 522	[c=0 l=5]  *call
+	movl	820(%rbx), %edx	# 526	[c=9 l=6]  *movsi_internal/0
+	movzwl	816(%rbx), %eax	# 533	[c=13 l=7]  *zero_extendhisi2/0
+	movl	%r13d, 824(%rbx)	# 523	[c=4 l=7]  *movsi_internal/1
+	movw	$0, 1024(%rbx)	# 525	[c=4 l=9]  *movv2qi_internal/3
+	leaq	flag_update_table_add8(%rip), %r10	# 14951	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_sub8(%rip), %r11	# 14953	[c=1 l=7]  *movdi_internal/4
+	movzbl	%dh, %ecx	# 534	[c=4 l=3]  *extzvsi
+	sall	$8, %eax	# 535	[c=4 l=3]  *ashlsi3_1/0
+	movzbl	%dl, %edx	# 537	[c=4 l=3]  *zero_extendqisi2/0
+	orl	%ecx, %eax	# 536	[c=4 l=2]  *iorsi_1/0
+	sall	$8, %eax	# 538	[c=4 l=3]  *ashlsi3_1/0
+	orl	%edx, %eax	# 540	[c=4 l=2]  *iorsi_1/0
+	movl	%eax, 1026(%rbx)	# 541	[c=4 l=6]  *movv4qi_internal/1
+	jmp	.L644	# 19055	[c=1 l=5]  jump
+.L1112:
+	movl	%edi, %edx	# 6651	[c=4 l=2]  *movsi_internal/0
+	movq	%rbx, %rdi	# 6653	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 6654	[c=0 l=5]  *call
+	leaq	flag_update_table_add8(%rip), %r10	# 15545	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_sub8(%rip), %r11	# 15547	[c=1 l=7]  *movdi_internal/4
+	jmp	.L1113	# 19057	[c=1 l=5]  jump
+.L866:
+	movq	%rbx, %rdi	# 3530	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 3531	[c=10 l=5]  *call_value
+	leaq	flag_update_table_add8(%rip), %r10	# 15209	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_sub8(%rip), %r11	# 15211	[c=1 l=7]  *movdi_internal/4
+	jmp	.L868	# 19059	[c=1 l=5]  jump
+.L1460:
+	leaq	.LC39(%rip), %r8	# 81	[c=1 l=7]  *movdi_internal/4
+	jmp	.L1437	# 19061	[c=1 l=5]  jump
+.L1417:
+	movq	1040(%rbx), %rax	# 11650	[c=9 l=7]  *movdi_internal/3
+	movzbl	61(%rax), %r14d	# 11651	[c=13 l=5]  *zero_extendqisi2/0
+	cmpl	%ecx, %edx	# 11652	[c=4 l=2]  *cmpsi_1/0
+	jb	.L1419	# 11653	[c=13 l=6]  *jcc
+	cmpb	$1, 1081(%rbx)	# 11657	[c=13 l=7]  *cmpqi_1/0
+	jbe	.L1419	# 11658	[c=13 l=6]  *jcc
+.L1420:
+	movl	$62, %esi	# 11661	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 11662	[c=4 l=3]  *movdi_internal/3
+	movq	%r8, 16(%rsp)	# 15897	[c=4 l=5]  *movdi_internal/5
+	call	data_read_mapped	# 11663	[c=10 l=5]  *call_value
+	movq	16(%rsp), %r8	# 15898	[c=9 l=5]  *movdi_internal/3
+	leaq	flag_update_table_add8(%rip), %r10	# 15900	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_sub8(%rip), %r11	# 15902	[c=1 l=7]  *movdi_internal/4
+	jmp	.L1421	# 19063	[c=1 l=5]  jump
+.L1834:
+	movl	16(%rsp), %edi	# 15903	[c=9 l=4]  *movsi_internal/0
+	addl	%edi, %eax	# 11681	[c=4 l=2]  *addsi_1/2
+	cmpl	%eax, 1000(%rbx)	# 11682	[c=13 l=6]  *cmpsi_1/0
+	jb	.L1423	# 11683	[c=13 l=2]  *jcc
+	movslq	%edi, %rdx	# 12300	[c=4 l=3]  *extendsidi2_rex64/1
+	movl	$1, %eax	# 77	[c=4 l=5]  *movdi_internal/2
+	xorl	%r9d, %r9d	# 18150	[c=4 l=3]  *movdi_xor
+	addq	1040(%rbx), %rdx	# 11689	[c=13 l=7]  *adddi_1/1
+.L1424:
+	movzbl	(%rdx,%rax), %ecx	# 11690	[c=13 l=4]  *zero_extendqisi2/0
+	sall	$8, %r9d	# 11687	[c=4 l=4]  *ashlsi3_1/0
+	addq	$1, %rax	# 11692	[c=4 l=4]  *adddi_1/0
+	orl	%ecx, %r9d	# 11691	[c=4 l=3]  *iorsi_1/0
+	cmpl	%eax, 24(%rsp)	# 11694	[c=13 l=4]  *cmpsi_1/0
+	jge	.L1424	# 11695	[c=13 l=2]  *jcc
+	cmpl	%r9d, 992(%rbx)	# 11697	[c=13 l=7]  *cmpsi_1/0
+	jnb	.L1422	# 11698	[c=13 l=6]  *jcc
+.L1423:
+	movq	40(%r13), %r14	# 11832	[c=9 l=4]  *movdi_internal/3
+	movq	%r10, %rcx	# 17188	[c=4 l=3]  *movdi_internal/3
+	movq	%r12, %rdx	# 17189	[c=4 l=3]  *movdi_internal/3
+	movq	%r11, %rax	# 17190	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 17191	[c=4 l=3]  *indirect_jump
+.L1833:
+	movl	$61, %esi	# 11639	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 11640	[c=4 l=3]  *movdi_internal/3
+	movl	%edx, 40(%rsp)	# 15891	[c=4 l=4]  *movsi_internal/1
+	movl	%ecx, 24(%rsp)	# 15889	[c=4 l=4]  *movsi_internal/1
+	movq	%r8, 16(%rsp)	# 15887	[c=4 l=5]  *movdi_internal/5
+	call	data_read_mapped	# 11641	[c=10 l=5]  *call_value
+	movl	24(%rsp), %ecx	# 15890	[c=9 l=4]  *movsi_internal/0
+	movl	40(%rsp), %edx	# 15892	[c=9 l=4]  *movsi_internal/0
+	leaq	flag_update_table_add8(%rip), %r10	# 15894	[c=1 l=7]  *movdi_internal/4
+	movq	16(%rsp), %r8	# 15888	[c=9 l=5]  *movdi_internal/3
+	movl	%eax, %r14d	# 11642	[c=4 l=3]  *movsi_internal/0
+	leaq	flag_update_table_sub8(%rip), %r11	# 15896	[c=1 l=7]  *movdi_internal/4
+	cmpl	%ecx, %edx	# 11643	[c=4 l=2]  *cmpsi_1/0
+	jnb	.L1420	# 11644	[c=13 l=6]  *jcc
+	movq	1040(%rbx), %rax	# 12299	[c=9 l=7]  *movdi_internal/3
+	jmp	.L1419	# 19065	[c=1 l=5]  jump
+.L1835:
+	movl	$168, %esi	# 11704	[c=4 l=5]  *movdi_internal/2
+	movl	$1, %edi	# 11705	[c=4 l=5]  *movdi_internal/2
+	movl	%r9d, 48(%rsp)	# 15906	[c=4 l=5]  *movsi_internal/1
+	movq	%r8, 40(%rsp)	# 15904	[c=4 l=5]  *movdi_internal/5
+	call	calloc@PLT	# 11706	[c=10 l=5]  *call_value
+	movq	40(%rsp), %r8	# 15905	[c=9 l=5]  *movdi_internal/3
+	movl	48(%rsp), %r9d	# 15907	[c=9 l=5]  *movsi_internal/0
+	testq	%rax, %rax	# 11709	[c=4 l=3]  *cmpdi_ccno_1/0
+	movq	%rax, %r14	# 11707	[c=4 l=3]  *movdi_internal/3
+	je	.L1836	# 11710	[c=13 l=6]  *jcc
+	movq	984(%rbx), %rax	# 11724	[c=9 l=7]  *movdi_internal/3
+	movq	%rax, (%r14)	# 11725	[c=4 l=3]  *movdi_internal/5
+	testq	%rax, %rax	# 11726	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L1427	# 11727	[c=13 l=2]  *jcc
+	movq	%r14, 8(%rax)	# 11729	[c=4 l=4]  *movdi_internal/5
+.L1427:
+	leaq	32(%r14), %rax	# 16068	[c=4 l=4]  *leadi
+	movl	$65568, %esi	# 11735	[c=4 l=5]  *movdi_internal/2
+	movl	$1, %edi	# 11736	[c=4 l=5]  *movdi_internal/2
+	movq	%r14, 984(%rbx)	# 11732	[c=4 l=7]  *movdi_internal/5
+	movq	%rax, 10976(%rbx)	# 11734	[c=4 l=7]  *movdi_internal/5
+	movl	%r9d, 48(%rsp)	# 15914	[c=4 l=5]  *movsi_internal/1
+	movq	%r8, 40(%rsp)	# 15912	[c=4 l=5]  *movdi_internal/5
+	call	calloc@PLT	# 11737	[c=10 l=5]  *call_value
+	movq	40(%rsp), %r8	# 15913	[c=9 l=5]  *movdi_internal/3
+	movl	48(%rsp), %r9d	# 15915	[c=9 l=5]  *movsi_internal/0
+	testq	%rax, %rax	# 11740	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L1837	# 11741	[c=13 l=6]  *jcc
+	movq	%r14, (%rax)	# 11755	[c=4 l=3]  *movdi_internal/5
+	movq	%rax, 8(%r14)	# 11756	[c=4 l=4]  *movdi_internal/5
+	movq	%rax, 984(%rbx)	# 11757	[c=4 l=7]  *movdi_internal/5
+	addq	$32, %rax	# 11758	[c=4 l=4]  *adddi_1/0
+	movq	%rax, 128(%r14)	# 11759	[c=4 l=7]  *movdi_internal/5
+	jmp	.L1425	# 19069	[c=1 l=5]  jump
+.L1831:
+	movl	(%rbx), %eax	# 554	[c=6 l=2]  *zero_extendsidi2/3
+	salq	$4, %rax	# 556	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %rax	# 557	[c=13 l=7]  *adddi_1/1
+	movzbl	11(%rax), %eax	# 558	[c=13 l=4]  zero_extendqidi2/0
+	subq	%rax, %rdx	# 559	[c=4 l=3]  *subdi_1/0
+	jmp	.L656	# 19071	[c=1 l=5]  jump
+.L1836:
+	movl	$136, %r8d	# 11713	[c=4 l=6]  *movsi_internal/0
+	movl	$1, %ecx	# 11714	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 11718	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 18149	[c=4 l=2]  *movdi_xor
+	leaq	.LC54(%rip), %r9	# 11712	[c=1 l=7]  *movdi_internal/4
+	leaq	.LC4(%rip), %rdx	# 11715	[c=1 l=7]  *movdi_internal/4
+	movl	$6, %esi	# 11717	[c=4 l=5]  *movsi_internal/0
+	call	leave	# 11720	[c=0 l=5]  *call
+.L1439:
+	cmpl	108(%rsp), %r9d	# 11984	[c=13 l=5]  *cmpsi_1/1
+	jne	.L1440	# 11985	[c=13 l=6]  *jcc
+.L1438:
+	movl	%r9d, %ecx	# 11988	[c=4 l=3]  *movsi_internal/0
+	movl	%r8d, %edx	# 11989	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 11991	[c=4 l=3]  *movdi_internal/3
+	call	hle_learn@PLT	# 11992	[c=10 l=5]  *call_value
+	leaq	flag_update_table_add8(%rip), %r10	# 15971	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_sub8(%rip), %r11	# 15973	[c=1 l=7]  *movdi_internal/4
+	testb	%al, %al	# 11994	[c=4 l=2]  *cmpqi_ccno_1/0
+	je	.L1440	# 11995	[c=13 l=6]  *jcc
+	movq	%r10, %rcx	# 17172	[c=4 l=3]  *movdi_internal/3
+	movq	%r12, %rdx	# 17173	[c=4 l=3]  *movdi_internal/3
+	movq	%r11, %rax	# 17174	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 17175	[c=4 l=3]  *indirect_jump
+.L1738:
+	movl	%eax, %esi	# 10134	[c=4 l=2]  *movsi_internal/0
+.L1586:
+	movq	%rbx, %rdi	# 10135	[c=4 l=3]  *movdi_internal/3
+	call	stack_overflow	# 10136	[c=0 l=5]  *call
+.L652:
+	leaq	.LC48(%rip), %rdx	# 485	[c=1 l=7]  *movdi_internal/4
+	movl	$1, %esi	# 487	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 488	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 18387	[c=4 l=2]  *movdi_xor
+	call	leave	# 490	[c=0 l=5]  *call
+.L1585:
+	movl	%r14d, %esi	# 5327	[c=4 l=3]  *movsi_internal/0
+	movq	%rbx, %rdi	# 5328	[c=4 l=3]  *movdi_internal/3
+	call	bad_PC	# 5329	[c=0 l=5]  *call
+.L1758:
+	movl	%r13d, %esi	# 1521	[c=4 l=3]  *movsi_internal/0
+	movq	%rbx, %rdi	# 1522	[c=4 l=3]  *movdi_internal/3
+	call	bad_PC	# 1523	[c=0 l=5]  *call
+.L1751:
+	movl	%r14d, %esi	# 4776	[c=4 l=3]  *movsi_internal/0
+	movq	%rbx, %rdi	# 4777	[c=4 l=3]  *movdi_internal/3
+	call	stack_overflow	# 4778	[c=0 l=5]  *call
+.L1804:
+	leaq	.LC52(%rip), %rdx	# 5433	[c=1 l=7]  *movdi_internal/4
+	xorl	%esi, %esi	# 18267	[c=4 l=2]  *movdi_xor
+	movq	%rbx, %rdi	# 5436	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 18268	[c=4 l=2]  *movdi_xor
+	call	leave	# 5438	[c=0 l=5]  *call
+.L1080:
+	leaq	.LC53(%rip), %rdx	# 6262	[c=1 l=7]  *movdi_internal/4
+	movl	$4, %esi	# 6264	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 6265	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 18240	[c=4 l=2]  *movdi_xor
+	call	leave	# 6267	[c=0 l=5]  *call
+.L1828:
+	xorl	%edx, %edx	# 18151	[c=4 l=2]  *movsi_xor
+	movq	%rbx, %rdi	# 11602	[c=4 l=3]  *movdi_internal/3
+	movl	%edx, 96(%rbx)	# 18152	[c=4 l=3]  *movsi_internal/1
+	call	do_events	# 11603	[c=0 l=5]  *call
+	leaq	flag_update_table_sub8(%rip), %r11	# 15886	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 15884	[c=1 l=7]  *movdi_internal/4
+	jmp	.L1416	# 19073	[c=1 l=5]  jump
+.L1827:
+	movl	5176(%rbx), %r13d	# 11404	[c=9 l=7]  *movsi_internal/0
+	movl	$61, %eax	# 11408	[c=4 l=5]  *movsi_internal/0
+	movl	5180(%rbx), %ebp	# 11405	[c=9 l=6]  *movsi_internal/0
+	movl	$62, %r14d	# 11406	[c=4 l=6]  *movsi_internal/0
+	subl	%r13d, %eax	# 11409	[c=4 l=3]  *subsi_1/0
+	subl	%r13d, %r14d	# 11407	[c=4 l=3]  *subsi_1/0
+	cmpl	%ebp, %eax	# 11410	[c=4 l=2]  *cmpsi_1/0
+	jb	.L1396	# 11411	[c=13 l=6]  *jcc
+	cmpb	$1, 1081(%rbx)	# 11415	[c=13 l=7]  *cmpqi_1/0
+	ja	.L1838	# 11416	[c=13 l=6]  *jcc
+	movq	1040(%rbx), %rax	# 12073	[c=9 l=7]  *movdi_internal/3
+	movzbl	61(%rax), %r15d	# 12074	[c=13 l=5]  *zero_extendqisi2/0
+.L1398:
+	movzbl	62(%rax), %eax	# 11449	[c=13 l=4]  *zero_extendqisi2/0
+.L1400:
+	sall	$8, %eax	# 11452	[c=4 l=3]  *ashlsi3_1/0
+	orl	%r15d, %eax	# 11453	[c=4 l=3]  *iorsi_1/0
+	xorl	%r15d, %r15d	# 18153	[c=4 l=3]  *movdi_xor
+	cmpb	$0, 840(%rbx)	# 11454	[c=13 l=7]  *cmpqi_ccno_1/1
+	movl	%eax, %r14d	# 14873	[c=4 l=3]  *movsi_internal/0
+	je	.L1401	# 11455	[c=13 l=2]  *jcc
+	addl	$1, %r14d	# 11457	[c=4 l=4]  *addsi_1/0
+	movl	%r14d, %eax	# 14874	[c=4 l=3]  *movsi_internal/0
+	subl	%r13d, %eax	# 11458	[c=4 l=3]  *subsi_1/0
+	cmpl	%ebp, %eax	# 11459	[c=4 l=2]  *cmpsi_1/0
+	jb	.L1402	# 11460	[c=13 l=2]  *jcc
+	movl	%r14d, %eax	# 14876	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %eax	# 11462	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 13636	[c=5 l=5]  *andsi_1_zext
+	cmpb	$0, 1080(%rbx,%rax)	# 11465	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L1403	# 11466	[c=13 l=6]  *jcc
+.L1402:
+	movq	1040(%rbx), %rdx	# 11470	[c=9 l=7]  *movdi_internal/3
+	movslq	%r14d, %rax	# 11469	[c=4 l=3]  *extendsidi2_rex64/1
+	movzbl	(%rdx,%rax), %r15d	# 11471	[c=13 l=5]  *zero_extendqisi2/0
+.L1404:
+	sall	$16, %r15d	# 11482	[c=4 l=4]  *ashlsi3_1/0
+.L1401:
+	leal	1(%r14), %esi	# 16069	[c=4 l=4]  *leasi
+	movl	%esi, %eax	# 14878	[c=4 l=2]  *movsi_internal/0
+	subl	5176(%rbx), %eax	# 11486	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %eax	# 11487	[c=13 l=6]  *cmpsi_1/1
+	jb	.L1405	# 11488	[c=13 l=2]  *jcc
+	movl	%esi, %eax	# 14880	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %eax	# 11490	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 13635	[c=5 l=5]  *andsi_1_zext
+	cmpb	$0, 1080(%rbx,%rax)	# 11493	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L1406	# 11494	[c=13 l=6]  *jcc
+.L1405:
+	movq	1040(%rbx), %rax	# 11498	[c=9 l=7]  *movdi_internal/3
+	movslq	%esi, %rsi	# 11497	[c=4 l=3]  *extendsidi2_rex64/1
+	movzbl	(%rax,%rsi), %eax	# 11499	[c=13 l=4]  *zero_extendqisi2/0
+.L1407:
+	sall	$8, %eax	# 11510	[c=4 l=3]  *ashlsi3_1/0
+	addl	$2, %r14d	# 11512	[c=4 l=4]  *addsi_1/0
+	orl	%r15d, %eax	# 11511	[c=4 l=3]  *iorsi_1/0
+	movl	%eax, %ebp	# 14883	[c=4 l=2]  *movsi_internal/0
+	movl	%r14d, %eax	# 14884	[c=4 l=3]  *movsi_internal/0
+	subl	5176(%rbx), %eax	# 11513	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %eax	# 11514	[c=13 l=6]  *cmpsi_1/1
+	jb	.L1408	# 11515	[c=13 l=2]  *jcc
+	movl	%r14d, %eax	# 14886	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %eax	# 11517	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 13634	[c=5 l=5]  *andsi_1_zext
+	cmpb	$0, 1080(%rbx,%rax)	# 11520	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L1409	# 11521	[c=13 l=2]  *jcc
+.L1408:
+	movq	1040(%rbx), %rdx	# 11525	[c=9 l=7]  *movdi_internal/3
+	movslq	%r14d, %rax	# 11524	[c=4 l=3]  *extendsidi2_rex64/1
+	movzbl	(%rdx,%rax), %eax	# 11526	[c=13 l=4]  *zero_extendqisi2/0
+.L1410:
+	orl	%eax, %ebp	# 11537	[c=4 l=2]  *iorsi_1/0
+	cmpl	%ebp, 992(%rbx)	# 11538	[c=13 l=6]  *cmpsi_1/0
+	jb	.L1839	# 11539	[c=13 l=6]  *jcc
+	movl	$61, %eax	# 11547	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%rbx), %eax	# 11548	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %eax	# 11549	[c=13 l=6]  *cmpsi_1/1
+	jb	.L1412	# 11550	[c=13 l=2]  *jcc
+	cmpb	$1, 1081(%rbx)	# 11554	[c=13 l=7]  *cmpqi_1/0
+	ja	.L1840	# 11555	[c=13 l=2]  *jcc
+.L1412:
+	movq	1040(%rbx), %rax	# 11566	[c=9 l=7]  *movdi_internal/3
+	movb	%r14b, 61(%rax)	# 11567	[c=4 l=4]  *movqi_internal/8
+.L1413:
+	movl	$62, %eax	# 11571	[c=4 l=5]  *movsi_internal/0
+	sarl	$8, %r14d	# 11570	[c=4 l=4]  *ashrsi3_1/0
+	subl	5176(%rbx), %eax	# 11572	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %eax	# 11573	[c=13 l=6]  *cmpsi_1/1
+	jb	.L1414	# 11574	[c=13 l=2]  *jcc
+	cmpb	$1, 1081(%rbx)	# 11578	[c=13 l=7]  *cmpqi_1/0
+	ja	.L1841	# 11579	[c=13 l=2]  *jcc
+.L1414:
+	movq	1040(%rbx), %rax	# 11590	[c=9 l=7]  *movdi_internal/3
+	movb	%r14b, 62(%rax)	# 11591	[c=4 l=4]  *movqi_internal/8
+	jmp	.L1395	# 19079	[c=1 l=5]  jump
+.L1409:
+	movl	%r14d, %esi	# 11531	[c=4 l=3]  *movsi_internal/0
+	movq	%rbx, %rdi	# 11532	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 11533	[c=10 l=5]  *call_value
+	leaq	flag_update_table_sub8(%rip), %r11	# 15874	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 15872	[c=1 l=7]  *movdi_internal/4
+	jmp	.L1410	# 19081	[c=1 l=2]  jump
+.L1840:
+	movzbl	%r14b, %edx	# 11557	[c=4 l=4]  *zero_extendqisi2/0
+	movl	$61, %esi	# 11559	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 11560	[c=4 l=3]  *movdi_internal/3
+	call	data_write_mapped	# 11561	[c=0 l=5]  *call
+	leaq	flag_update_table_add8(%rip), %r10	# 15876	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_sub8(%rip), %r11	# 15878	[c=1 l=7]  *movdi_internal/4
+	jmp	.L1413	# 19083	[c=1 l=2]  jump
+.L1839:
+	movl	%ebp, %esi	# 11541	[c=4 l=2]  *movsi_internal/0
+.L1583:
+	movq	%rbx, %rdi	# 11542	[c=4 l=3]  *movdi_internal/3
+	call	bad_PC	# 11543	[c=0 l=5]  *call
+.L1841:
+	movzbl	%r14b, %edx	# 11581	[c=4 l=4]  *zero_extendqisi2/0
+	movl	$62, %esi	# 11583	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 11584	[c=4 l=3]  *movdi_internal/3
+	call	data_write_mapped	# 11585	[c=0 l=5]  *call
+	leaq	flag_update_table_add8(%rip), %r10	# 15880	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_sub8(%rip), %r11	# 15882	[c=1 l=7]  *movdi_internal/4
+	jmp	.L1395	# 19085	[c=1 l=5]  jump
+.L1582:
+	movl	%r15d, %esi	# 2989	[c=4 l=3]  *movsi_internal/0
+	movq	%rbx, %rdi	# 2990	[c=4 l=3]  *movdi_internal/3
+	call	stack_overflow	# 2991	[c=0 l=5]  *call
+.L1837:
+	leaq	.LC54(%rip), %r9	# 11743	[c=1 l=7]  *movdi_internal/4
+	movl	$1, %r8d	# 11744	[c=4 l=6]  *movsi_internal/0
+	movq	%rbx, %rdi	# 11749	[c=4 l=3]  *movdi_internal/3
+	movl	$65536, %ecx	# 11745	[c=4 l=5]  *movsi_internal/0
+	leaq	.LC4(%rip), %rdx	# 11746	[c=1 l=7]  *movdi_internal/4
+	movl	$6, %esi	# 11748	[c=4 l=5]  *movsi_internal/0
+	call	leave	# 11751	[c=0 l=5]  *call
+.L1396:
+	movq	1040(%rbx), %rax	# 11429	[c=9 l=7]  *movdi_internal/3
+	movzbl	61(%rax), %r15d	# 11430	[c=13 l=5]  *zero_extendqisi2/0
+	cmpl	%ebp, %r14d	# 11431	[c=4 l=3]  *cmpsi_1/0
+	jb	.L1398	# 11432	[c=13 l=6]  *jcc
+	cmpb	$1, 1081(%rbx)	# 11436	[c=13 l=7]  *cmpqi_1/0
+	jbe	.L1398	# 11437	[c=13 l=6]  *jcc
+.L1399:
+	movl	$62, %esi	# 11440	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 11441	[c=4 l=3]  *movdi_internal/3
+	call	data_read_mapped	# 11442	[c=10 l=5]  *call_value
+	leaq	flag_update_table_add8(%rip), %r10	# 15860	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_sub8(%rip), %r11	# 15862	[c=1 l=7]  *movdi_internal/4
+	jmp	.L1400	# 19087	[c=1 l=5]  jump
+.L1403:
+	movl	%r14d, %esi	# 11476	[c=4 l=3]  *movsi_internal/0
+	movq	%rbx, %rdi	# 11477	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 11478	[c=10 l=5]  *call_value
+	leaq	flag_update_table_sub8(%rip), %r11	# 15866	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 15864	[c=1 l=7]  *movdi_internal/4
+	movl	%eax, %r15d	# 11479	[c=4 l=3]  *movsi_internal/0
+	jmp	.L1404	# 19089	[c=1 l=5]  jump
+.L1838:
+	movl	$61, %esi	# 11418	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 11419	[c=4 l=3]  *movdi_internal/3
+	call	data_read_mapped	# 11420	[c=10 l=5]  *call_value
+	cmpl	%ebp, %r14d	# 11422	[c=4 l=3]  *cmpsi_1/0
+	leaq	flag_update_table_add8(%rip), %r10	# 15856	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_sub8(%rip), %r11	# 15858	[c=1 l=7]  *movdi_internal/4
+	movl	%eax, %r15d	# 11421	[c=4 l=3]  *movsi_internal/0
+	jnb	.L1399	# 11423	[c=13 l=2]  *jcc
+	movq	1040(%rbx), %rax	# 12298	[c=9 l=7]  *movdi_internal/3
+	jmp	.L1398	# 19091	[c=1 l=5]  jump
+.L1406:
+	movq	%rbx, %rdi	# 11505	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 11506	[c=10 l=5]  *call_value
+	leaq	flag_update_table_sub8(%rip), %r11	# 15870	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 15868	[c=1 l=7]  *movdi_internal/4
+	jmp	.L1407	# 19093	[c=1 l=5]  jump
+	.cfi_endproc
+.LFE223:
+	.size	execute, .-execute
+	.section	.rodata.str1.1
+.LC56:
+	.string	"flash"
+.LC57:
+	.string	"EEPROM"
+.LC58:
+	.string	"decoded flash"
+.LC59:
+	.string	"atmega64"
+.LC60:
+	.string	"atmega128"
+	.section	.rodata.str1.8
+	.align 8
+.LC61:
+	.string	"entry point 0x%x is outside the flash of %s"
+	.text
+	.p2align 4
+	.type	run_context, @function
+run_context:
+.LFB228:
+	.cfi_startproc
+	pushq	%r13	# 809	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 16
+	.cfi_offset 13, -16
+	pushq	%r12	# 810	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 24
+	.cfi_offset 12, -24
+	pushq	%rbp	# 811	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 32
+	.cfi_offset 6, -32
+	pushq	%rbx	# 812	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 40
+	.cfi_offset 3, -40
+	subq	$248, %rsp	# 813	[c=4 l=7]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_def_cfa_offset 288
+	movq	%rdi, (%rsp)	# 2	[c=4 l=4]  *movdi_internal/5
+	leaq	32(%rsp), %rdi	# 21	[c=4 l=5]  *leadi
+	movl	%esi, 12(%rsp)	# 3	[c=4 l=4]  *movsi_internal/1
+	movq	%rdx, 16(%rsp)	# 4	[c=4 l=5]  *movdi_internal/5
+	call	_setjmp@PLT	# 23	[c=10 l=5]  *call_value
+	testl	%eax, %eax	# 30	[c=4 l=2]  *cmpsi_ccno_1/0
+	je	.L1902	# 31	[c=13 l=6]  *jcc
+	movq	(%rsp), %rbx	# 767	[c=5 l=4]  *movdi_internal/3
+	movq	$0, 128(%rbx)	# 480	[c=4 l=11]  *movdi_internal/5
+	movq	%rbx, %rdi	# 481	[c=4 l=3]  *movdi_internal/3
+	call	eeprom_finish@PLT	# 482	[c=0 l=5]  *call
+	movq	%rbx, %rdi	# 484	[c=4 l=3]  *movdi_internal/3
+	call	jit_free@PLT	# 485	[c=0 l=5]  *call
+	movq	984(%rbx), %rdi	# 487	[c=9 l=7]  *movdi_internal/3
+	testq	%rdi, %rdi	# 488	[c=4 l=3]  *cmpdi_ccno_1/0
+	jne	.L1881	# 489	[c=13 l=2]  *jcc
+	jmp	.L1887	# 862	[c=1 l=2]  jump
+	.p2align 4,,10
+	.p2align 3
+.L1903:
+	movq	%rax, (%rdx)	# 511	[c=4 l=3]  *movdi_internal/5
+.L1884:
+	testq	%rax, %rax	# 519	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L1885	# 520	[c=13 l=2]  *jcc
+	movq	%rdx, 8(%rax)	# 522	[c=4 l=4]  *movdi_internal/5
+.L1885:
+	call	free@PLT	# 535	[c=0 l=5]  *call
+	movq	(%rsp), %rax	# 733	[c=5 l=4]  *movdi_internal/3
+	movq	984(%rax), %rdi	# 536	[c=9 l=7]  *movdi_internal/3
+	testq	%rdi, %rdi	# 537	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L1887	# 538	[c=13 l=2]  *jcc
+.L1881:
+	movq	16(%rdi), %rax	# 496	[c=9 l=4]  *movdi_internal/3
+	testq	%rax, %rax	# 497	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L1882	# 498	[c=13 l=2]  *jcc
+	movq	%rax, %rdi	# 500	[c=4 l=3]  *movdi_internal/3
+	call	fclose@PLT	# 501	[c=10 l=5]  *call_value
+	movq	(%rsp), %rax	# 730	[c=5 l=4]  *movdi_internal/3
+	movq	984(%rax), %rdi	# 503	[c=9 l=7]  *movdi_internal/3
+.L1882:
+	movq	8(%rdi), %rdx	# 506	[c=9 l=4]  *movdi_internal/3
+	movq	(%rdi), %rax	# 507	[c=5 l=3]  *movdi_internal/3
+	testq	%rdx, %rdx	# 508	[c=4 l=3]  *cmpdi_ccno_1/0
+	jne	.L1903	# 509	[c=13 l=2]  *jcc
+	movq	(%rsp), %rcx	# 731	[c=5 l=4]  *movdi_internal/3
+	movq	%rax, 984(%rcx)	# 516	[c=4 l=7]  *movdi_internal/5
+	jmp	.L1884	# 865	[c=1 l=2]  jump
+	.p2align 4,,10
+	.p2align 3
+.L1887:
+	movq	(%rsp), %rax	# 729	[c=5 l=4]  *movdi_internal/3
+	movl	136(%rax), %eax	# 491	[c=9 l=6]  *movsi_internal/0
+	addq	$248, %rsp	# 816	[c=4 l=7]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	popq	%rbx	# 817	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 32
+	popq	%rbp	# 818	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 24
+	popq	%r12	# 819	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 16
+	popq	%r13	# 820	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 8
+	ret		# 821	[c=0 l=1]  simple_return_internal
+.L1902:
+	.cfi_restore_state
+	movq	(%rsp), %rbx	# 737	[c=5 l=4]  *movdi_internal/3
+	leaq	32(%rsp), %rax	# 33	[c=4 l=5]  *leadi
+	xorl	%esi, %esi	# 859	[c=4 l=2]  *movdi_xor
+	movl	$1, %r13d	# 6	[c=4 l=6]  *movsi_internal/0
+	movq	%rax, 128(%rbx)	# 34	[c=4 l=7]  *movdi_internal/5
+	leaq	920(%rbx), %rdi	# 800	[c=4 l=7]  *leadi
+	call	gettimeofday@PLT	# 38	[c=10 l=5]  *call_value
+	movq	16(%rsp), %rdx	# 39	[c=9 l=5]  *movdi_internal/3
+	movl	12(%rsp), %esi	# 40	[c=9 l=4]  *movsi_internal/0
+	movq	%rbx, %rdi	# 41	[c=4 l=3]  *movdi_internal/3
+	call	parse_args@PLT	# 42	[c=0 l=5]  *call
+	movq	%rbx, %rdi	# 44	[c=4 l=3]  *movdi_internal/3
+	call	replay_open@PLT	# 45	[c=0 l=5]  *call
+	movl	880(%rbx), %eax	# 47	[c=9 l=6]  *movsi_internal/0
+.L1845:
+	movl	%r13d, %r12d	# 49	[c=4 l=3]  *movsi_internal/0
+	addl	%r13d, %r13d	# 50	[c=4 l=3]  *ashlsi3_1/0
+	cmpl	%eax, %r13d	# 52	[c=4 l=3]  *cmpsi_1/0
+	jb	.L1845	# 53	[c=13 l=2]  *jcc
+	leal	-1(%r12), %eax	# 798	[c=4 l=5]  *leasi
+	movl	$1, %edi	# 65	[c=4 l=5]  *movdi_internal/2
+	movd	%eax, %xmm0	# 667	[c=4 l=4]  *movsi_internal/13
+	movq	(%rsp), %rax	# 740	[c=5 l=4]  *movdi_internal/3
+	movl	872(%rax), %esi	# 56	[c=9 l=6]  *movsi_internal/0
+	movl	876(%rax), %ecx	# 59	[c=9 l=6]  *movsi_internal/0
+	movd	%esi, %xmm1	# 670	[c=4 l=4]  *movsi_internal/13
+	movl	%ecx, 1000(%rax)	# 60	[c=4 l=6]  *movsi_internal/1
+	movl	%esi, 24(%rsp)	# 669	[c=4 l=4]  *movsi_internal/1
+	punpckldq	%xmm1, %xmm0	# 57	[c=4 l=4]  *vec_concatv2si/0
+	leal	1(%rcx), %esi	# 799	[c=5 l=3]  *leadi
+	movq	%xmm0, 992(%rax)	# 58	[c=4 l=9]  *movv2si_internal/14
+	movq	%rsi, %rbx	# 805	[c=4 l=3]  *movdi_internal/3
+	addq	$32, %rsi	# 63	[c=4 l=4]  *adddi_1/0
+	call	calloc@PLT	# 66	[c=10 l=5]  *call_value
+	movq	%rax, %rbp	# 67	[c=4 l=3]  *movdi_internal/3
+	testq	%rax, %rax	# 69	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L1904	# 70	[c=13 l=6]  *jcc
+	xorl	%esi, %esi	# 857	[c=4 l=2]  *movdi_xor
+	movq	%rsi, 8(%rax)	# 858	[c=4 l=4]  *movdi_internal/5
+	movq	(%rsp), %rax	# 674	[c=5 l=4]  *movdi_internal/3
+	movq	984(%rax), %rax	# 85	[c=9 l=7]  *movdi_internal/3
+	movq	%rax, 0(%rbp)	# 86	[c=4 l=4]  *movdi_internal/5
+	testq	%rax, %rax	# 87	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L1847	# 88	[c=13 l=2]  *jcc
+	movq	%rbp, 8(%rax)	# 90	[c=4 l=4]  *movdi_internal/5
+.L1847:
+	movq	(%rsp), %rsi	# 741	[c=5 l=4]  *movdi_internal/3
+	leaq	32(%rbp), %rax	# 797	[c=4 l=4]  *leadi
+	movl	$1, %edi	# 100	[c=4 l=5]  *movdi_internal/2
+	movq	%rbp, 984(%rsi)	# 93	[c=4 l=7]  *movdi_internal/5
+	movq	%rax, 1040(%rsi)	# 95	[c=4 l=7]  *movdi_internal/5
+	leal	2(%r13), %esi	# 898	[c=5 l=4]  *leadi
+	movq	%rsi, %r13	# 806	[c=4 l=3]  *movdi_internal/3
+	addq	$32, %rsi	# 98	[c=4 l=4]  *adddi_1/0
+	call	calloc@PLT	# 101	[c=10 l=5]  *call_value
+	movq	%rax, %rbx	# 102	[c=4 l=3]  *movdi_internal/3
+	testq	%rax, %rax	# 104	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L1905	# 105	[c=13 l=6]  *jcc
+	movq	(%rsp), %rsi	# 743	[c=5 l=4]  *movdi_internal/3
+	xorl	%ecx, %ecx	# 854	[c=4 l=2]  *movdi_xor
+	movq	%rbp, (%rax)	# 120	[c=4 l=3]  *movdi_internal/5
+	movl	$1, %edi	# 130	[c=4 l=5]  *movdi_internal/2
+	movq	%rcx, 8(%rax)	# 855	[c=4 l=4]  *movdi_internal/5
+	movl	884(%rsi), %ecx	# 125	[c=9 l=6]  *movsi_internal/0
+	movq	%rax, 8(%rbp)	# 121	[c=4 l=4]  *movdi_internal/5
+	movq	%rax, 984(%rsi)	# 122	[c=4 l=7]  *movdi_internal/5
+	leaq	32(%rax), %rax	# 796	[c=4 l=4]  *leadi
+	movq	%rax, 1056(%rsi)	# 124	[c=4 l=7]  *movdi_internal/5
+	testl	%ecx, %ecx	# 659	[c=4 l=2]  *cmpsi_ccno_1/0
+	movl	$1, %eax	# 662	[c=4 l=5]  *movsi_internal/0
+	cmovne	%ecx, %eax	# 660	[c=8 l=3]  *movsicc_noc/0
+	movl	%eax, %esi	# 681	[c=1 l=2]  *zero_extendsidi2/3
+	movq	%rsi, %r13	# 807	[c=4 l=3]  *movdi_internal/3
+	addq	$32, %rsi	# 128	[c=4 l=4]  *adddi_1/0
+	call	calloc@PLT	# 131	[c=10 l=5]  *call_value
+	leaq	.LC57(%rip), %r9	# 137	[c=1 l=7]  *movdi_internal/4
+	movq	%rax, %rbp	# 132	[c=4 l=3]  *movdi_internal/3
+	testq	%rax, %rax	# 134	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L1901	# 135	[c=13 l=6]  *jcc
+	movq	(%rsp), %rsi	# 744	[c=5 l=4]  *movdi_internal/3
+	xorl	%edx, %edx	# 852	[c=4 l=2]  *movdi_xor
+	movq	%rbx, (%rax)	# 150	[c=4 l=3]  *movdi_internal/5
+	movl	$1, %edi	# 159	[c=4 l=5]  *movdi_internal/2
+	movq	%rdx, 8(%rax)	# 853	[c=4 l=4]  *movdi_internal/5
+	movq	%rax, 8(%rbx)	# 151	[c=4 l=4]  *movdi_internal/5
+	movq	%rax, 984(%rsi)	# 152	[c=4 l=7]  *movdi_internal/5
+	leaq	32(%rax), %rax	# 795	[c=4 l=4]  *leadi
+	movq	%rax, 1048(%rsi)	# 154	[c=4 l=7]  *movdi_internal/5
+	movl	%r12d, %esi	# 155	[c=1 l=3]  *zero_extendsidi2/3
+	salq	$4, %rsi	# 156	[c=4 l=4]  *ashldi3_1/0
+	addq	$32, %rsi	# 157	[c=4 l=4]  *adddi_1/0
+	call	calloc@PLT	# 160	[c=10 l=5]  *call_value
+	movq	%rax, %rbx	# 161	[c=4 l=3]  *movdi_internal/3
+	testq	%rax, %rax	# 163	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L1906	# 164	[c=13 l=6]  *jcc
+	movq	(%rsp), %rsi	# 746	[c=5 l=4]  *movdi_internal/3
+	xorl	%eax, %eax	# 850	[c=4 l=2]  *movdi_xor
+	movq	%rbp, (%rbx)	# 179	[c=4 l=3]  *movdi_internal/5
+	movq	%rax, 8(%rbx)	# 851	[c=4 l=4]  *movdi_internal/5
+	leaq	32(%rbx), %rax	# 794	[c=4 l=4]  *leadi
+	cmpb	$0, 844(%rsi)	# 184	[c=13 l=7]  *cmpqi_ccno_1/1
+	movq	%rbx, 8(%rbp)	# 180	[c=4 l=4]  *movdi_internal/5
+	movq	%rbx, 984(%rsi)	# 181	[c=4 l=7]  *movdi_internal/5
+	movq	%rax, 1064(%rsi)	# 183	[c=4 l=7]  *movdi_internal/5
+	jne	.L1907	# 185	[c=13 l=6]  *jcc
+.L1851:
+	movq	(%rsp), %rbx	# 748	[c=5 l=4]  *movdi_internal/3
+	movq	%rbx, %rdi	# 214	[c=4 l=3]  *movdi_internal/3
+	call	periph_init@PLT	# 215	[c=0 l=5]  *call
+	leaq	1080(%rbx), %rdi	# 793	[c=4 l=7]  *leadi
+	xorl	%ecx, %ecx	# 849	[c=4 l=2]  *movdi_xor
+	movl	$31, %edx	# 8	[c=4 l=5]  *movsi_internal/0
+	movq	%rdi, %rsi	# 218	[c=4 l=3]  *movdi_internal/3
+.L1863:
+	movq	(%rsp), %rax	# 690	[c=5 l=4]  *movdi_internal/3
+	movl	1000(%rax), %r8d	# 220	[c=9 l=7]  *movsi_internal/0
+	xorl	%eax, %eax	# 848	[c=4 l=2]  *movdi_xor
+	cmpl	%edx, %r8d	# 221	[c=4 l=3]  *cmpsi_1/0
+	jnb	.L1853	# 222	[c=13 l=2]  *jcc
+	cmpl	%ecx, %r8d	# 607	[c=4 l=3]  *cmpsi_1/0
+	sbbl	%eax, %eax	# 608	[c=8 l=2]  *x86_movsicc_0_m1
+	andl	$4, %eax	# 791	[c=4 l=3]  *andsi_1/0
+	addl	$1, %eax	# 792	[c=4 l=3]  *addsi_1/0
+.L1853:
+	movb	%al, (%rsi)	# 230	[c=4 l=2]  *movqi_internal/8
+	movq	(%rsp), %rax	# 749	[c=5 l=4]  *movdi_internal/3
+	movq	%rsi, %r8	# 229	[c=4 l=3]  *movdi_internal/3
+	cmpb	$0, 844(%rax)	# 231	[c=13 l=7]  *cmpqi_ccno_1/1
+	je	.L1854	# 232	[c=13 l=2]  *jcc
+	cmpl	%ecx, 1000(%rax)	# 234	[c=13 l=6]  *cmpsi_1/0
+	jnb	.L1854	# 235	[c=13 l=2]  *jcc
+	cmpl	$65535, %edx	# 239	[c=4 l=6]  *cmpsi_1/0
+	ja	.L1908	# 240	[c=13 l=6]  *jcc
+	movb	$4, (%rsi)	# 259	[c=4 l=3]  *movqi_internal/8
+	movl	884(%rax), %eax	# 260	[c=9 l=6]  *movsi_internal/0
+	testl	%eax, %eax	# 261	[c=4 l=2]  *cmpsi_ccno_1/0
+	jne	.L1860	# 262	[c=13 l=2]  *jcc
+	addl	$32, %edx	# 264	[c=4 l=3]  *addsi_1/0
+	addl	$32, %ecx	# 265	[c=4 l=3]  *addsi_1/0
+	addq	$1, %rsi	# 266	[c=4 l=4]  *adddi_1/0
+	jmp	.L1863	# 872	[c=1 l=2]  jump
+.L1854:
+	movq	(%rsp), %rax	# 696	[c=5 l=4]  *movdi_internal/3
+	movl	884(%rax), %eax	# 271	[c=9 l=6]  *movsi_internal/0
+	testl	%eax, %eax	# 272	[c=4 l=2]  *cmpsi_ccno_1/0
+	je	.L1857	# 273	[c=13 l=2]  *jcc
+.L1860:
+	movq	(%rsp), %rbx	# 697	[c=5 l=4]  *movdi_internal/3
+	addl	$4096, %eax	# 276	[c=4 l=5]  *addsi_1/0
+	cmpl	%eax, 996(%rbx)	# 279	[c=13 l=6]  *cmpsi_1/0
+	jb	.L1857	# 280	[c=13 l=2]  *jcc
+	cmpl	$4095, %ecx	# 285	[c=4 l=6]  *cmpsi_1/0
+	ja	.L1858	# 286	[c=13 l=6]  *jcc
+.L1857:
+	addl	$32, %edx	# 295	[c=4 l=3]  *addsi_1/0
+	addl	$32, %ecx	# 296	[c=4 l=3]  *addsi_1/0
+	addq	$1, %rsi	# 297	[c=4 l=4]  *adddi_1/0
+	cmpl	$131103, %edx	# 298	[c=4 l=6]  *cmpsi_1/0
+	jne	.L1863	# 299	[c=13 l=6]  *jcc
+	movq	(%rsp), %rax	# 698	[c=5 l=4]  *movdi_internal/3
+	movb	$1, 1081(%rax)	# 307	[c=4 l=7]  *movqi_internal/8
+	xorl	%eax, %eax	# 847	[c=4 l=2]  *movdi_xor
+	jmp	.L1864	# 874	[c=1 l=2]  jump
+.L1866:
+	movq	(%rsp), %rsi	# 699	[c=5 l=4]  *movdi_internal/3
+	cmpb	$0, 6568(%rsi,%rax)	# 311	[c=14 l=8]  *cmpqi_ccno_1/1
+	je	.L1865	# 312	[c=13 l=2]  *jcc
+	shrl	$5, %edx	# 314	[c=5 l=3]  *lshrsi3_1_zext/0
+	movb	$1, (%rdi,%rdx)	# 316	[c=4 l=4]  *movqi_internal/8
+.L1865:
+	addq	$1, %rax	# 319	[c=4 l=4]  *adddi_1/0
+.L1864:
+	movq	(%rsp), %rsi	# 700	[c=5 l=4]  *movdi_internal/3
+	movl	%eax, %edx	# 322	[c=4 l=2]  *movsi_internal/0
+	cmpl	6564(%rsi), %eax	# 324	[c=13 l=6]  *cmpsi_1/1
+	jb	.L1866	# 325	[c=13 l=2]  *jcc
+	movl	1000(%rsi), %eax	# 327	[c=9 l=6]  *movsi_internal/0
+	movl	%eax, 28(%rsp)	# 702	[c=4 l=4]  *movsi_internal/1
+	addl	$1, %eax	# 328	[c=4 l=3]  *addsi_1/0
+	movl	%eax, %edx	# 704	[c=4 l=2]  *movsi_internal/0
+	shrl	$5, %edx	# 329	[c=4 l=3]  *lshrsi3_1/0
+	jmp	.L1868	# 876	[c=1 l=2]  jump
+.L1909:
+	leal	-1(%rdx), %esi	# 790	[c=5 l=3]  *leadi
+	cmpb	$0, (%rdi,%rsi)	# 337	[c=13 l=4]  *cmpqi_ccno_1/1
+	movq	%rsi, %rcx	# 808	[c=4 l=3]  *movdi_internal/3
+	jne	.L1867	# 338	[c=13 l=2]  *jcc
+	movl	%ecx, %edx	# 13	[c=4 l=2]  *movsi_internal/0
+.L1868:
+	testl	%edx, %edx	# 331	[c=4 l=2]  *cmpsi_ccno_1/0
+	jne	.L1909	# 332	[c=13 l=2]  *jcc
+.L1867:
+	movq	(%rsp), %rsi	# 754	[c=5 l=4]  *movdi_internal/3
+	sall	$5, %edx	# 341	[c=4 l=3]  *ashlsi3_1/0
+	andl	$-32, %eax	# 343	[c=4 l=3]  *andsi_1/0
+	subl	%edx, %eax	# 344	[c=4 l=2]  *subsi_1/0
+	cmpl	$69633, 880(%rsi)	# 588	[c=13 l=10]  *cmpsi_1/0
+	movl	%eax, 5180(%rsi)	# 345	[c=4 l=6]  *movsi_internal/1
+	sbbl	%eax, %eax	# 589	[c=8 l=2]  *x86_movsicc_0_m1
+	movl	%edx, 5176(%rsi)	# 342	[c=4 l=6]  *movsi_internal/1
+	movq	856(%rsi), %rbx	# 354	[c=9 l=7]  *movdi_internal/3
+	xorb	%al, %al	# 846	[c=4 l=2]  *movstrictqi_xor
+	addl	$512, %eax	# 591	[c=4 l=5]  *addsi_1/0
+	movq	%rbx, %rdi	# 358	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, 6044(%rsi)	# 353	[c=4 l=6]  *movsi_internal/1
+	leaq	.LC59(%rip), %rsi	# 356	[c=1 l=7]  *movdi_internal/4
+	call	strcmp@PLT	# 359	[c=10 l=5]  *call_value
+	movl	%eax, %edx	# 624	[c=4 l=2]  *movsi_internal/0
+	movl	$104, %eax	# 17	[c=4 l=5]  *movsi_internal/0
+	testl	%edx, %edx	# 361	[c=4 l=2]  *cmpsi_ccno_1/0
+	je	.L1870	# 362	[c=13 l=2]  *jcc
+	leaq	.LC60(%rip), %rsi	# 365	[c=1 l=7]  *movdi_internal/4
+	movq	%rbx, %rdi	# 367	[c=4 l=3]  *movdi_internal/3
+	call	strcmp@PLT	# 368	[c=10 l=5]  *call_value
+	cmpl	$1, %eax	# 602	[c=4 l=3]  *cmpsi_1/0
+	sbbl	%eax, %eax	# 603	[c=8 l=2]  *x86_movsicc_0_m1
+	andl	$49, %eax	# 604	[c=4 l=3]  *andsi_1/0
+	addl	$55, %eax	# 605	[c=4 l=3]  *addsi_1/0
+.L1870:
+	movq	(%rsp), %rsi	# 760	[c=5 l=4]  *movdi_internal/3
+	leaq	6060(%rsi), %rdi	# 788	[c=4 l=7]  *leadi
+	movl	%eax, 6048(%rsi)	# 375	[c=4 l=6]  *movsi_internal/1
+	movl	%esi, %eax	# 715	[c=4 l=2]  *movsi_internal/0
+	movq	$-1, 6052(%rsi)	# 381	[c=4 l=11]  *movdi_internal/5
+	andq	$-8, %rdi	# 387	[c=4 l=4]  *anddi_1/1
+	movq	$-1, 6556(%rsi)	# 385	[c=4 l=11]  *movdi_internal/5
+	subl	%edi, %eax	# 388	[c=4 l=2]  *subsi_1/0
+	leal	6564(%rax), %ecx	# 389	[c=4 l=6]  *leasi
+	orq	$-1, %rax	# 845	[c=4 l=4]  *movdi_or
+	shrl	$3, %ecx	# 391	[c=5 l=3]  *lshrsi3_1_zext/0
+	rep stosq	# 393	[c=0 l=3]  *rep_stosdi_rex64
+	movl	(%rsi), %eax	# 394	[c=5 l=2]  *movsi_internal/0
+	cmpl	%eax, 992(%rsi)	# 395	[c=13 l=6]  *cmpsi_1/0
+	jb	.L1910	# 396	[c=13 l=6]  *jcc
+	movq	(%rsp), %rax	# 719	[c=5 l=4]  *movdi_internal/3
+	cmpl	$0, 232(%rax)	# 410	[c=13 l=7]  *cmpsi_ccno_1/1
+	jne	.L1911	# 411	[c=13 l=6]  *jcc
+.L1872:
+	movq	(%rsp), %rbx	# 761	[c=5 l=4]  *movdi_internal/3
+	movq	%rbx, %rdi	# 419	[c=4 l=3]  *movdi_internal/3
+	call	checkpoint_open@PLT	# 420	[c=0 l=5]  *call
+	cmpl	$0, 424(%rbx)	# 422	[c=13 l=7]  *cmpsi_ccno_1/1
+	jne	.L1875	# 423	[c=13 l=2]  *jcc
+	movq	(%rsp), %rdi	# 431	[c=5 l=4]  *movdi_internal/3
+	call	load_to_flash@PLT	# 432	[c=0 l=5]  *call
+.L1875:
+	movq	(%rsp), %rbx	# 763	[c=5 l=4]  *movdi_internal/3
+	movq	%rbx, %rdi	# 425	[c=4 l=3]  *movdi_internal/3
+	call	eeprom_open@PLT	# 426	[c=0 l=5]  *call
+	movq	%rbx, %rdi	# 438	[c=4 l=3]  *movdi_internal/3
+	call	checkpoint_resume@PLT	# 439	[c=0 l=5]  *call
+	cmpl	$0, 232(%rbx)	# 441	[c=13 l=7]  *cmpsi_ccno_1/1
+	jne	.L1912	# 442	[c=13 l=2]  *jcc
+.L1876:
+	movq	(%rsp), %rax	# 724	[c=5 l=4]  *movdi_internal/3
+	cmpl	$0, 424(%rax)	# 450	[c=13 l=7]  *cmpsi_ccno_1/1
+	jne	.L1879	# 451	[c=13 l=2]  *jcc
+	movq	(%rsp), %rdi	# 459	[c=5 l=4]  *movdi_internal/3
+	call	decode_flash@PLT	# 460	[c=0 l=5]  *call
+.L1879:
+	movq	(%rsp), %rbx	# 764	[c=5 l=4]  *movdi_internal/3
+	movq	%rbx, %rdi	# 453	[c=4 l=3]  *movdi_internal/3
+	call	fork_server_open@PLT	# 454	[c=0 l=5]  *call
+	cmpl	$0, 232(%rbx)	# 466	[c=13 l=7]  *cmpsi_ccno_1/1
+	jne	.L1913	# 467	[c=13 l=2]  *jcc
+.L1880:
+	movq	(%rsp), %rdi	# 475	[c=5 l=4]  *movdi_internal/3
+	call	execute	# 476	[c=0 l=5]  *call
+.L1907:
+	movl	$32800, %esi	# 187	[c=4 l=5]  *movdi_internal/2
+	movl	$1, %edi	# 188	[c=4 l=5]  *movdi_internal/2
+	call	calloc@PLT	# 189	[c=10 l=5]  *call_value
+	testq	%rax, %rax	# 192	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L1914	# 193	[c=13 l=2]  *jcc
+	movq	(%rsp), %rsi	# 747	[c=5 l=4]  *movdi_internal/3
+	movq	%rbx, (%rax)	# 207	[c=4 l=3]  *movdi_internal/5
+	movq	%rax, 8(%rbx)	# 208	[c=4 l=4]  *movdi_internal/5
+	movq	%rax, 984(%rsi)	# 209	[c=4 l=7]  *movdi_internal/5
+	addq	$32, %rax	# 210	[c=4 l=4]  *adddi_1/0
+	movq	%rax, 1072(%rsi)	# 211	[c=4 l=7]  *movdi_internal/5
+	jmp	.L1851	# 884	[c=1 l=5]  jump
+.L1912:
+	movq	(%rsp), %rax	# 723	[c=5 l=4]  *movdi_internal/3
+	xorl	%esi, %esi	# 842	[c=4 l=2]  *movdi_xor
+	leaq	952(%rax), %rdi	# 785	[c=4 l=7]  *leadi
+	call	gettimeofday@PLT	# 447	[c=10 l=5]  *call_value
+	jmp	.L1876	# 886	[c=1 l=2]  jump
+.L1911:
+	leaq	936(%rax), %rdi	# 786	[c=4 l=7]  *leadi
+	xorl	%esi, %esi	# 843	[c=4 l=2]  *movdi_xor
+	call	gettimeofday@PLT	# 416	[c=10 l=5]  *call_value
+	jmp	.L1872	# 888	[c=1 l=5]  jump
+.L1913:
+	movq	(%rsp), %rax	# 726	[c=5 l=4]  *movdi_internal/3
+	xorl	%esi, %esi	# 841	[c=4 l=2]  *movdi_xor
+	leaq	968(%rax), %rdi	# 784	[c=4 l=7]  *leadi
+	call	gettimeofday@PLT	# 472	[c=10 l=5]  *call_value
+	jmp	.L1880	# 890	[c=1 l=2]  jump
+.L1910:
+	movq	(%rsp), %rdi	# 404	[c=5 l=4]  *movdi_internal/3
+	leal	(%rax,%rax), %ecx	# 787	[c=12 l=3]  *leasi
+	movq	%rbx, %r8	# 399	[c=4 l=3]  *movdi_internal/3
+	movl	$5, %esi	# 403	[c=4 l=5]  *movsi_internal/0
+	leaq	.LC61(%rip), %rdx	# 401	[c=1 l=7]  *movdi_internal/4
+	xorl	%eax, %eax	# 844	[c=4 l=2]  *movdi_xor
+	call	leave	# 406	[c=0 l=5]  *call
+.L1914:
+	movq	(%rsp), %rdi	# 201	[c=5 l=4]  *movdi_internal/3
+	movl	$8, %r8d	# 196	[c=4 l=6]  *movsi_internal/0
+	leaq	.LC37(%rip), %r9	# 195	[c=1 l=7]  *movdi_internal/4
+	movl	$4096, %ecx	# 197	[c=4 l=5]  *movsi_internal/0
+	leaq	.LC4(%rip), %rdx	# 198	[c=1 l=7]  *movdi_internal/4
+	movl	$6, %esi	# 200	[c=4 l=5]  *movsi_internal/0
+	call	leave	# 203	[c=0 l=5]  *call
+.L1908:
+	movq	%rax, %rbx	# 750	[c=4 l=3]  *movdi_internal/3
+	movl	884(%rax), %eax	# 242	[c=9 l=6]  *movsi_internal/0
+	testl	%eax, %eax	# 243	[c=4 l=2]  *cmpsi_ccno_1/0
+	je	.L1857	# 244	[c=13 l=6]  *jcc
+	addl	$4096, %eax	# 250	[c=4 l=5]  *addsi_1/0
+	cmpl	%eax, 996(%rbx)	# 251	[c=13 l=6]  *cmpsi_1/0
+	jb	.L1857	# 252	[c=13 l=6]  *jcc
+.L1858:
+	cmpl	%eax, %edx	# 289	[c=4 l=2]  *cmpsi_1/0
+	jnb	.L1857	# 290	[c=13 l=6]  *jcc
+	movb	$3, (%r8)	# 292	[c=4 l=4]  *movqi_internal/8
+	jmp	.L1857	# 892	[c=1 l=5]  jump
+.L1906:
+	leaq	.LC58(%rip), %r9	# 166	[c=1 l=7]  *movdi_internal/4
+	movl	$16, %r8d	# 167	[c=4 l=6]  *movsi_internal/0
+	movl	%r12d, %ecx	# 168	[c=4 l=3]  *movsi_internal/0
+.L1900:
+	movq	(%rsp), %rdi	# 113	[c=5 l=4]  *movdi_internal/3
+	leaq	.LC4(%rip), %rdx	# 110	[c=1 l=7]  *movdi_internal/4
+	movl	$6, %esi	# 112	[c=4 l=5]  *movsi_internal/0
+	xorl	%eax, %eax	# 856	[c=4 l=2]  *movdi_xor
+	call	leave	# 115	[c=0 l=5]  *call
+.L1905:
+	leaq	.LC56(%rip), %r9	# 107	[c=1 l=7]  *movdi_internal/4
+.L1901:
+	movl	$1, %r8d	# 108	[c=4 l=6]  *movsi_internal/0
+	movl	%r13d, %ecx	# 109	[c=4 l=3]  *movsi_internal/0
+	jmp	.L1900	# 894	[c=1 l=2]  jump
+.L1904:
+	leaq	.LC40(%rip), %r9	# 72	[c=1 l=7]  *movdi_internal/4
+	movl	$1, %r8d	# 73	[c=4 l=6]  *movsi_internal/0
+	movl	%ebx, %ecx	# 74	[c=4 l=2]  *movsi_internal/0
+	jmp	.L1900	# 896	[c=1 l=2]  jump
+	.cfi_endproc
+.LFE228:
+	.size	run_context, .-run_context
+	.p2align 4
+	.globl	put_mem
+	.type	put_mem, @function
+put_mem:
+.LFB63:
+	.cfi_startproc
+	testq	%rsi, %rsi	# 7	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L1915	# 8	[c=13 l=2]  *jcc
+	movq	-24(%rsi), %rdx	# 11	[c=9 l=4]  *movdi_internal/3
+	movq	-32(%rsi), %rax	# 12	[c=9 l=4]  *movdi_internal/3
+	leaq	-32(%rsi), %rcx	# 48	[c=4 l=4]  *leadi
+	testq	%rdx, %rdx	# 13	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L1917	# 14	[c=13 l=2]  *jcc
+	movq	%rax, (%rdx)	# 16	[c=4 l=3]  *movdi_internal/5
+.L1918:
+	testq	%rax, %rax	# 24	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L1919	# 25	[c=13 l=2]  *jcc
+	movq	%rdx, 8(%rax)	# 27	[c=4 l=4]  *movdi_internal/5
+.L1919:
+	movq	%rcx, %rdi	# 30	[c=4 l=3]  *movdi_internal/3
+	jmp	free@PLT	# 31	[c=0 l=5]  *sibcall
+	.p2align 4,,10
+	.p2align 3
+.L1915:
+	ret		# 51	[c=0 l=1]  simple_return_internal
+	.p2align 4,,10
+	.p2align 3
+.L1917:
+	movq	%rax, 984(%rdi)	# 21	[c=4 l=7]  *movdi_internal/5
+	jmp	.L1918	# 53	[c=1 l=2]  jump
+	.cfi_endproc
+.LFE63:
+	.size	put_mem, .-put_mem
+	.section	.rodata.str1.1
+.LC62:
+	.string	"out of memory opening %s"
+	.text
+	.p2align 4
+	.globl	get_file
+	.type	get_file, @function
+get_file:
+.LFB64:
+	.cfi_startproc
+	pushq	%r12	# 73	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	movq	%rsi, %r12	# 3	[c=4 l=3]  *movdi_internal/3
+	movq	%rdx, %rsi	# 4	[c=4 l=3]  *movdi_internal/3
+	pushq	%rbp	# 74	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	movq	%rdi, %rbp	# 2	[c=4 l=3]  *movdi_internal/3
+	movq	%r12, %rdi	# 9	[c=4 l=3]  *movdi_internal/3
+	pushq	%rbx	# 75	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	call	fopen@PLT	# 10	[c=10 l=5]  *call_value
+	movq	%rax, %rbx	# 11	[c=4 l=3]  *movdi_internal/3
+	testq	%rax, %rax	# 13	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L1923	# 14	[c=13 l=2]  *jcc
+	movl	$32, %esi	# 16	[c=4 l=5]  *movdi_internal/2
+	movl	$1, %edi	# 17	[c=4 l=5]  *movdi_internal/2
+	call	calloc@PLT	# 18	[c=10 l=5]  *call_value
+	testq	%rax, %rax	# 21	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L1934	# 22	[c=13 l=2]  *jcc
+	movq	984(%rbp), %rdx	# 38	[c=9 l=7]  *movdi_internal/3
+	movq	%rbx, 16(%rax)	# 36	[c=4 l=4]  *movdi_internal/5
+	movq	$0, 8(%rax)	# 37	[c=4 l=8]  *movdi_internal/5
+	movq	%rdx, (%rax)	# 39	[c=4 l=3]  *movdi_internal/5
+	testq	%rdx, %rdx	# 40	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L1926	# 41	[c=13 l=2]  *jcc
+	movq	%rax, 8(%rdx)	# 43	[c=4 l=4]  *movdi_internal/5
+.L1926:
+	movq	%rax, 984(%rbp)	# 46	[c=4 l=7]  *movdi_internal/5
+.L1923:
+	movq	%rbx, %rax	# 52	[c=4 l=3]  *movdi_internal/3
+	popq	%rbx	# 78	[c=9 l=1]  *popdi1
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbp	# 79	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 16
+	popq	%r12	# 80	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 8
+	ret		# 81	[c=0 l=1]  simple_return_internal
+.L1934:
+	.cfi_restore_state
+	movq	%rbx, %rdi	# 24	[c=4 l=3]  *movdi_internal/3
+	call	fclose@PLT	# 25	[c=10 l=5]  *call_value
+	movq	%r12, %rcx	# 26	[c=4 l=3]  *movdi_internal/3
+	movl	$6, %esi	# 29	[c=4 l=5]  *movsi_internal/0
+	movq	%rbp, %rdi	# 30	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC62(%rip), %rdx	# 27	[c=1 l=7]  *movdi_internal/4
+	xorl	%eax, %eax	# 85	[c=4 l=2]  *movdi_xor
+	call	leave	# 32	[c=0 l=5]  *call
+	.cfi_endproc
+.LFE64:
+	.size	get_file, .-get_file
+	.p2align 4
+	.globl	put_file
+	.type	put_file, @function
+put_file:
+.LFB65:
+	.cfi_startproc
+	pushq	%rbx	# 79	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	movq	984(%rdi), %rax	# 7	[c=9 l=7]  *movdi_internal/3
+	movq	%rsi, %rbx	# 3	[c=4 l=3]  *movdi_internal/3
+	testq	%rax, %rax	# 8	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L1936	# 9	[c=13 l=2]  *jcc
+	movq	%rdi, %rcx	# 85	[c=4 l=3]  *movdi_internal/3
+	jmp	.L1941	# 90	[c=1 l=2]  jump
+	.p2align 4,,10
+	.p2align 3
+.L1937:
+	testq	%rax, %rax	# 42	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L1936	# 43	[c=13 l=2]  *jcc
+.L1941:
+	movq	16(%rax), %rdx	# 11	[c=9 l=4]  *movdi_internal/3
+	movq	%rax, %rdi	# 12	[c=4 l=3]  *movdi_internal/3
+	movq	(%rax), %rax	# 13	[c=5 l=3]  *movdi_internal/3
+	cmpq	%rbx, %rdx	# 14	[c=4 l=3]  *cmpdi_1/0
+	jne	.L1937	# 15	[c=13 l=2]  *jcc
+	movq	8(%rdi), %rdx	# 17	[c=9 l=4]  *movdi_internal/3
+	testq	%rdx, %rdx	# 18	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L1938	# 19	[c=13 l=2]  *jcc
+	movq	%rax, (%rdx)	# 21	[c=4 l=3]  *movdi_internal/5
+.L1939:
+	testq	%rax, %rax	# 29	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L1940	# 30	[c=13 l=2]  *jcc
+	movq	%rdx, 8(%rax)	# 32	[c=4 l=4]  *movdi_internal/5
+.L1940:
+	call	free@PLT	# 36	[c=0 l=5]  *call
+.L1936:
+	movq	%rbx, %rdi	# 46	[c=4 l=3]  *movdi_internal/3
+	popq	%rbx	# 88	[c=9 l=1]  *popdi1
+	.cfi_remember_state
+	.cfi_def_cfa_offset 8
+	jmp	fclose@PLT	# 47	[c=10 l=5]  *sibcall_value
+	.p2align 4,,10
+	.p2align 3
+.L1938:
+	.cfi_restore_state
+	movq	%rax, 984(%rcx)	# 26	[c=4 l=7]  *movdi_internal/5
+	jmp	.L1939	# 92	[c=1 l=2]  jump
+	.cfi_endproc
+.LFE65:
+	.size	put_file, .-put_file
+	.p2align 4
+	.globl	write_checkpoint
+	.type	write_checkpoint, @function
+write_checkpoint:
+.LFB215:
+	.cfi_startproc
+	pushq	%rbx	# 15	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	movq	%rdi, %rbx	# 2	[c=4 l=3]  *movdi_internal/3
+	call	checkpoint_begin@PLT	# 7	[c=0 l=5]  *call
+	movq	%rbx, %rdi	# 8	[c=4 l=3]  *movdi_internal/3
+	popq	%rbx	# 22	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 8
+	jmp	checkpoint_end@PLT	# 9	[c=0 l=5]  *sibcall
+	.cfi_endproc
+.LFE215:
+	.size	write_checkpoint, .-write_checkpoint
+	.section	.text.startup,"ax",@progbits
+	.p2align 4
+	.globl	main
+	.type	main, @function
+main:
+.LFB229:
+	.cfi_startproc
+	pushq	%r13	# 53	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 16
+	.cfi_offset 13, -16
+	movl	$11112, %edx	# 15	[c=4 l=5]  *movdi_internal/2
+	pushq	%r12	# 54	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 24
+	.cfi_offset 12, -24
+	movq	%rsi, %r12	# 3	[c=4 l=3]  *movdi_internal/3
+	xorl	%esi, %esi	# 74	[c=4 l=2]  *movdi_xor
+	pushq	%rbp	# 55	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 32
+	.cfi_offset 6, -32
+	movl	%edi, %ebp	# 2	[c=4 l=2]  *movsi_internal/0
+	pushq	%rbx	# 56	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 40
+	.cfi_offset 3, -40
+	leaq	cx.3(%rip), %rbx	# 12	[c=1 l=7]  *movdi_internal/4
+	movq	%rbx, %rdi	# 17	[c=4 l=3]  *movdi_internal/3
+	subq	$24, %rsp	# 57	[c=4 l=4]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_def_cfa_offset 64
+	movq	stderr(%rip), %r13	# 7	[c=6 l=7]  *movdi_internal/3
+	movq	stdin(%rip), %xmm0	# 48	[c=6 l=9]  *movdi_internal/14
+	movhps	stdout(%rip), %xmm0	# 10	[c=4 l=7]  vec_concatv2di/7
+	movaps	%xmm0, (%rsp)	# 51	[c=4 l=4]  movv2di_internal/3
+	call	memset@PLT	# 18	[c=10 l=5]  *call_value
+	movdqa	(%rsp), %xmm0	# 52	[c=9 l=5]  movv2di_internal/2
+	leaq	100(%rbx), %rax	# 23	[c=4 l=4]  *leadi
+	movq	%rbx, %rdi	# 31	[c=4 l=3]  *movdi_internal/3
+	movq	%r13, 912+cx.3(%rip)	# 29	[c=4 l=7]  *movdi_internal/5
+	movq	%rax, 104+cx.3(%rip)	# 50	[c=4 l=7]  *movdi_internal/5
+	movl	$-1, 10896+cx.3(%rip)	# 25	[c=4 l=10]  *movsi_internal/1
+	movaps	%xmm0, 896+cx.3(%rip)	# 27	[c=4 l=7]  movv2di_internal/3
+	call	events_init@PLT	# 32	[c=0 l=5]  *call
+	addq	$24, %rsp	# 68	[c=4 l=4]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_def_cfa_offset 40
+	movq	%r12, %rdx	# 33	[c=4 l=3]  *movdi_internal/3
+	movl	%ebp, %esi	# 34	[c=4 l=2]  *movsi_internal/0
+	movq	%rbx, %rdi	# 36	[c=4 l=3]  *movdi_internal/3
+	popq	%rbx	# 69	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 32
+	popq	%rbp	# 70	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 24
+	popq	%r12	# 71	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 16
+	popq	%r13	# 72	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 8
+	jmp	run_context	# 37	[c=10 l=5]  *sibcall_value
+	.cfi_endproc
+.LFE229:
+	.size	main, .-main
+	.section	.rodata.str1.1
+.LC63:
+	.string	"%s: out of memory\n"
+	.text
+	.p2align 4
+	.globl	job_main
+	.type	job_main, @function
+job_main:
+.LFB230:
+	.cfi_startproc
+	pushq	%r15	# 70	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	movq	%rdx, %r15	# 4	[c=4 l=3]  *movdi_internal/3
+	pushq	%r14	# 71	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	movq	%rcx, %r14	# 5	[c=4 l=3]  *movdi_internal/3
+	pushq	%r13	# 72	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	movq	%r9, %r13	# 7	[c=4 l=3]  *movdi_internal/3
+	pushq	%r12	# 73	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	movq	%r8, %r12	# 6	[c=4 l=3]  *movdi_internal/3
+	pushq	%rbp	# 74	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	movq	%rsi, %rbp	# 3	[c=4 l=3]  *movdi_internal/3
+	movl	$1, %esi	# 12	[c=4 l=5]  *movdi_internal/2
+	pushq	%rbx	# 75	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$24, %rsp	# 76	[c=4 l=4]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_def_cfa_offset 80
+	movl	%edi, 12(%rsp)	# 2	[c=4 l=4]  *movsi_internal/1
+	movl	$11112, %edi	# 13	[c=4 l=5]  *movdi_internal/2
+	call	calloc@PLT	# 14	[c=10 l=5]  *call_value
+	testq	%rax, %rax	# 17	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L1958	# 18	[c=13 l=2]  *jcc
+	movq	%rax, %rbx	# 87	[c=4 l=3]  *movdi_internal/3
+	leaq	100(%rax), %rax	# 69	[c=4 l=4]  *leadi
+	movl	$0, 0(%r13)	# 30	[c=4 l=8]  *movsi_internal/1
+	pxor	%xmm0, %xmm0	# 31	[c=4 l=4]  movv2di_internal/0
+	movq	%rax, 104(%rbx)	# 35	[c=4 l=4]  *movdi_internal/5
+	movq	%rbx, %rdi	# 40	[c=4 l=3]  *movdi_internal/3
+	movq	$0, 24(%r13)	# 33	[c=4 l=8]  *movdi_internal/5
+	movl	$-1, 10896(%rbx)	# 36	[c=4 l=10]  *movsi_internal/1
+	movq	%r15, 896(%rbx)	# 37	[c=4 l=7]  *movdi_internal/5
+	movq	%r14, 904(%rbx)	# 38	[c=4 l=7]  *movdi_internal/5
+	movq	%r12, 912(%rbx)	# 39	[c=4 l=7]  *movdi_internal/5
+	movups	%xmm0, 8(%r13)	# 32	[c=4 l=5]  movv2di_internal/3
+	call	events_init@PLT	# 41	[c=0 l=5]  *call
+	movl	12(%rsp), %esi	# 44	[c=9 l=4]  *movsi_internal/0
+	movq	%rbp, %rdx	# 43	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rdi	# 45	[c=4 l=3]  *movdi_internal/3
+	movq	%r13, 11016(%rbx)	# 42	[c=4 l=7]  *movdi_internal/5
+	call	run_context	# 46	[c=10 l=5]  *call_value
+	movq	%rbx, %rdi	# 48	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, %ebp	# 47	[c=4 l=2]  *movsi_internal/0
+	call	free@PLT	# 49	[c=0 l=5]  *call
+.L1954:
+	addq	$24, %rsp	# 79	[c=4 l=4]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	movl	%ebp, %eax	# 55	[c=4 l=2]  *movsi_internal/0
+	popq	%rbx	# 80	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 48
+	popq	%rbp	# 81	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 40
+	popq	%r12	# 82	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 32
+	popq	%r13	# 83	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 24
+	popq	%r14	# 84	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 16
+	popq	%r15	# 85	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 8
+	ret		# 86	[c=0 l=1]  simple_return_internal
+.L1958:
+	.cfi_restore_state
+	movq	0(%rbp), %rdx	# 20	[c=5 l=4]  *movdi_internal/3
+	leaq	.LC63(%rip), %rsi	# 21	[c=1 l=7]  *movdi_internal/4
+	movq	%r12, %rdi	# 23	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 91	[c=4 l=2]  *movdi_xor
+	movl	$20, %ebp	# 9	[c=4 l=5]  *movsi_internal/0
+	call	fprintf@PLT	# 25	[c=10 l=5]  *call_value
+	jmp	.L1954	# 93	[c=1 l=2]  jump
+	.cfi_endproc
+.LFE230:
+	.size	job_main, .-job_main
+	.section	.rodata
+	.align 32
+	.type	CSWTCH.178, @object
+	.size	CSWTCH.178, 56
+CSWTCH.178:
+	.long	2
+	.long	1
+	.long	3
+	.long	4
+	.long	0
+	.long	0
+	.long	0
+	.long	0
+	.long	2
+	.long	2
+	.long	3
+	.long	4
+	.long	3
+	.long	4
+	.align 16
+	.type	se.0, @object
+	.size	se.0, 24
+se.0:
+	.value	83
+	.byte	1
+	.zero	1
+	.value	85
+	.byte	32
+	.zero	1
+	.value	85
+	.byte	64
+	.zero	1
+	.value	85
+	.byte	-128
+	.zero	1
+	.value	58
+	.byte	1
+	.zero	1
+	.value	72
+	.byte	1
+	.zero	1
+	.section	.data.rel.ro.local,"aw"
+	.align 32
+	.type	fused.1, @object
+	.size	fused.1, 328
+fused.1:
+	.quad	.L1221
+	.quad	.L1222
+	.quad	.L1225
+	.quad	.L1228
+	.quad	.L1229
+	.quad	.L1232
+	.quad	.L1235
+	.quad	.L1236
+	.quad	.L1237
+	.quad	.L1240
+	.quad	.L1243
+	.quad	.L1246
+	.quad	.L1249
+	.quad	.L1252
+	.quad	.L1255
+	.quad	.L1258
+	.quad	.L1261
+	.quad	.L1264
+	.quad	.L1267
+	.quad	.L1270
+	.quad	.L1271
+	.quad	.L1272
+	.quad	.L1273
+	.quad	.L1274
+	.quad	.L1277
+	.quad	.L1280
+	.quad	.L1283
+	.quad	.L1288
+	.quad	.L1295
+	.quad	.L1296
+	.quad	.L1297
+	.quad	.L1311
+	.quad	.L1312
+	.quad	.L1318
+	.quad	.L1324
+	.quad	.L1330
+	.quad	.L1336
+	.quad	.L1337
+	.quad	.L1344
+	.quad	.L1352
+	.quad	.L1366
+	.align 32
+	.type	handler.2, @object
+	.size	handler.2, 896
+handler.2:
+	.quad	.L636
+	.quad	.L637
+	.quad	.L641
+	.quad	.L642
+	.quad	.L660
+	.quad	.L663
+	.quad	.L666
+	.quad	.L667
+	.quad	.L668
+	.quad	.L671
+	.quad	.L674
+	.quad	.L677
+	.quad	.L678
+	.quad	.L679
+	.quad	.L682
+	.quad	.L685
+	.quad	.L688
+	.quad	.L689
+	.quad	.L690
+	.quad	.L713
+	.quad	.L722
+	.quad	.L723
+	.quad	.L726
+	.quad	.L727
+	.quad	.L730
+	.quad	.L733
+	.quad	.L736
+	.quad	.L739
+	.quad	.L740
+	.quad	.L767
+	.quad	.L774
+	.quad	.L778
+	.quad	.L782
+	.quad	.L789
+	.quad	.L792
+	.quad	.L810
+	.quad	.L811
+	.quad	.L812
+	.quad	.L813
+	.quad	.L836
+	.quad	.L839
+	.quad	.L843
+	.quad	.L846
+	.quad	.L849
+	.quad	.L850
+	.quad	.L856
+	.quad	.L862
+	.quad	.L872
+	.quad	.L876
+	.quad	.L882
+	.quad	.L888
+	.quad	.L894
+	.quad	.L900
+	.quad	.L906
+	.quad	.L912
+	.quad	.L918
+	.quad	.L919
+	.quad	.L920
+	.quad	.L921
+	.quad	.L924
+	.quad	.L925
+	.quad	.L926
+	.quad	.L927
+	.quad	.L928
+	.quad	.L929
+	.quad	.L932
+	.quad	.L933
+	.quad	.L936
+	.quad	.L939
+	.quad	.L943
+	.quad	.L944
+	.quad	.L958
+	.quad	.L980
+	.quad	.L1002
+	.quad	.L1024
+	.quad	.L1027
+	.quad	.L1030
+	.quad	.L1031
+	.quad	.L1032
+	.quad	.L1041
+	.quad	.L1047
+	.quad	.L1053
+	.quad	.L1059
+	.quad	.L1065
+	.quad	.L1068
+	.quad	.L1071
+	.quad	.L1074
+	.quad	.L1077
+	.quad	.L1082
+	.quad	.L1096
+	.quad	.L1102
+	.quad	.L1108
+	.quad	.L1116
+	.quad	.L1120
+	.quad	.L1126
+	.quad	.L1132
+	.quad	.L1138
+	.quad	.L1144
+	.quad	.L1150
+	.quad	.L1156
+	.quad	.L1162
+	.quad	.L1165
+	.quad	.L1168
+	.quad	.L1169
+	.quad	.L1170
+	.quad	.L1172
+	.quad	.L1175
+	.quad	.L1178
+	.quad	.L1181
+	.quad	.L1191
+	.quad	.L1201
+	.quad	.L1211
+	.local	cx.3
+	.comm	cx.3,11112,32
+	.globl	opcodes
+	.section	.rodata.str1.1
+.LC64:
+	.string	"bad PC"
+.LC65:
+	.string	"ILLEGAL"
+.LC66:
+	.string	""
+.LC67:
+	.string	"*** SYSCALL"
+.LC68:
+	.string	"ADC"
+.LC69:
+	.string	"ADD"
+.LC70:
+	.string	"ADIW"
+.LC71:
+	.string	"SBIW"
+.LC72:
+	.string	"AND"
+.LC73:
+	.string	"ANDI"
+.LC74:
+	.string	"ASR"
+.LC75:
+	.string	"CL*"
+.LC76:
+	.string	"BLD.*"
+.LC77:
+	.string	"BREAK"
+.LC78:
+	.string	"BR*C"
+.LC79:
+	.string	"BR*S"
+.LC80:
+	.string	"SE*"
+.LC81:
+	.string	"BST.*"
+.LC82:
+	.string	"CALL"
+.LC83:
+	.string	"CBI.*"
+.LC84:
+	.string	"COM"
+.LC85:
+	.string	"CP"
+.LC86:
+	.string	"CPC"
+.LC87:
+	.string	"CPI"
+.LC88:
+	.string	"CPSE"
+.LC89:
+	.string	"DEC"
+.LC90:
+	.string	"DES"
+.LC91:
+	.string	"EICALL"
+.LC92:
+	.string	"EIJMP"
+.LC93:
+	.string	"ELPM"
+.LC94:
+	.string	"ELPM Z"
+.LC95:
+	.string	"ELPM Z+"
+.LC96:
+	.string	"EOR"
+.LC97:
+	.string	"ESPM"
+.LC98:
+	.string	"FMUL"
+.LC99:
+	.string	"FMULS"
+.LC100:
+	.string	"FMULSU"
+.LC101:
+	.string	"ICALL"
+.LC102:
+	.string	"IJMP"
+.LC103:
+	.string	"IN"
+.LC104:
+	.string	"INC"
+.LC105:
+	.string	"JMP"
+.LC106:
+	.string	"LDI"
+.LC107:
+	.string	"LDD Y+q"
+.LC108:
+	.string	"LDD Z+q"
+.LC109:
+	.string	"LDS"
+.LC110:
+	.string	"LD X"
+.LC111:
+	.string	"LD -X"
+.LC112:
+	.string	"LD X+"
+.LC113:
+	.string	"LD -Y"
+.LC114:
+	.string	"LD Y+"
+.LC115:
+	.string	"LD -Z"
+.LC116:
+	.string	"LD Z+"
+.LC117:
+	.string	"LPM"
+.LC118:
+	.string	"LPM Z"
+.LC119:
+	.string	"LPM Z+"
+.LC120:
+	.string	"LSR"
+.LC121:
+	.string	"MOV"
+.LC122:
+	.string	"MOVW"
+.LC123:
+	.string	"MUL"
+.LC124:
+	.string	"MULS"
+.LC125:
+	.string	"MULSU"
+.LC126:
+	.string	"NEG"
+.LC127:
+	.string	"NOP"
+.LC128:
+	.string	"OR"
+.LC129:
+	.string	"ORI"
+.LC130:
+	.string	"OUT"
+.LC131:
+	.string	"POP"
+.LC132:
+	.string	"PUSH"
+.LC133:
+	.string	"RCALL"
+.LC134:
+	.string	"RET"
+.LC135:
+	.string	"RETI"
+.LC136:
+	.string	"RJMP"
+.LC137:
+	.string	"ROR"
+.LC138:
+	.string	"SBC"
+.LC139:
+	.string	"SBCI"
+.LC140:
+	.string	"SBI.*"
+.LC141:
+	.string	"SBIC.*"
+.LC142:
+	.string	"SBIS.*"
+.LC143:
+	.string	"SBRC.*"
+.LC144:
+	.string	"SBRS.*"
+.LC145:
+	.string	"SLEEP"
+.LC146:
+	.string	"SPM"
+.LC147:
+	.string	"STD Y+q"
+.LC148:
+	.string	"STD Z+q"
+.LC149:
+	.string	"STS"
+.LC150:
+	.string	"ST X"
+.LC151:
+	.string	"ST -X"
+.LC152:
+	.string	"ST X+"
+.LC153:
+	.string	"ST -Y"
+.LC154:
+	.string	"ST Y+"
+.LC155:
+	.string	"ST -Z"
+.LC156:
+	.string	"ST Z+"
+.LC157:
+	.string	"SUB"
+.LC158:
+	.string	"SUBI"
+.LC159:
+	.string	"SWAP"
+.LC160:
+	.string	"WDR"
+.LC161:
+	.string	"CLR"
+.LC162:
+	.string	"LSL"
+.LC163:
+	.string	"ROL"
+.LC164:
+	.string	"TST"
+.LC165:
+	.string	"XCH"
+.LC166:
+	.string	"LAS"
+.LC167:
+	.string	"LAC"
+.LC168:
+	.string	"LAT"
+	.section	.data.rel.ro.local
+	.align 32
+	.type	opcodes, @object
+	.size	opcodes, 1792
+opcodes:
+	.quad	.LC64
+	.value	0
+	.value	0
+	.zero	4
+	.quad	.LC65
+	.value	0
+	.value	0
+	.zero	4
+	.quad	.LC66
+	.value	0
+	.value	0
+	.zero	4
+	.quad	.LC67
+	.value	2
+	.value	0
+	.zero	4
+	.quad	.LC68
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC69
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC70
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC71
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC72
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC73
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC74
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC75
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC76
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC77
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC78
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC79
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC80
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC81
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC82
+	.value	2
+	.value	4
+	.zero	4
+	.quad	.LC83
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC84
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC85
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC86
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC87
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC88
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC88
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC89
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC90
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC91
+	.value	1
+	.value	3
+	.zero	4
+	.quad	.LC92
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC93
+	.value	1
+	.value	3
+	.zero	4
+	.quad	.LC94
+	.value	1
+	.value	3
+	.zero	4
+	.quad	.LC95
+	.value	1
+	.value	3
+	.zero	4
+	.quad	.LC96
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC97
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC98
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC99
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC100
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC101
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC102
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC103
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC104
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC105
+	.value	2
+	.value	3
+	.zero	4
+	.quad	.LC106
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC107
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC108
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC109
+	.value	2
+	.value	3
+	.zero	4
+	.quad	.LC109
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC110
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC111
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC112
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC113
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC114
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC115
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC116
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC117
+	.value	1
+	.value	3
+	.zero	4
+	.quad	.LC118
+	.value	1
+	.value	3
+	.zero	4
+	.quad	.LC119
+	.value	1
+	.value	3
+	.zero	4
+	.quad	.LC120
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC121
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC122
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC123
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC124
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC125
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC126
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC127
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC128
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC129
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC130
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC131
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC132
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC133
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC134
+	.value	1
+	.value	4
+	.zero	4
+	.quad	.LC135
+	.value	1
+	.value	4
+	.zero	4
+	.quad	.LC136
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC137
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC138
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC139
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC140
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC141
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC141
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC142
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC142
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC143
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC143
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC144
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC144
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC145
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC146
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC147
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC148
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC149
+	.value	2
+	.value	2
+	.zero	4
+	.quad	.LC149
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC150
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC151
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC152
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC153
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC154
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC155
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC156
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC157
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC158
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC159
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC160
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC161
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC162
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC163
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC164
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC165
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC166
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC167
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC168
+	.value	1
+	.value	1
+	.zero	4
+	.globl	named_sfr
+	.section	.rodata.str1.1
+.LC169:
+	.string	"SPL"
+.LC170:
+	.string	"SPH"
+.LC171:
+	.string	"RAMPZ"
+.LC172:
+	.string	"RAMPY"
+.LC173:
+	.string	"RAMPX"
+.LC174:
+	.string	"RAMPD"
+.LC175:
+	.string	"EIND"
+	.section	.data.rel.ro.local
+	.align 32
+	.type	named_sfr, @object
+	.size	named_sfr, 192
+named_sfr:
+	.long	61
+	.zero	4
+	.quad	.LC169
+	.long	0
+	.zero	4
+	.long	62
+	.zero	4
+	.quad	.LC170
+	.long	0
+	.zero	4
+	.long	59
+	.zero	4
+	.quad	.LC171
+	.long	0
+	.zero	4
+	.long	58
+	.zero	4
+	.quad	.LC172
+	.long	1
+	.zero	4
+	.long	57
+	.zero	4
+	.quad	.LC173
+	.long	1
+	.zero	4
+	.long	56
+	.zero	4
+	.quad	.LC174
+	.long	1
+	.zero	4
+	.long	60
+	.zero	4
+	.quad	.LC175
+	.long	2
+	.zero	4
+	.long	0
+	.zero	4
+	.quad	0
+	.long	0
+	.zero	4
+	.globl	addr_SPL
+	.section	.rodata
+	.align 4
+	.type	addr_SPL, @object
+	.size	addr_SPL, 4
+addr_SPL:
+	.long	61
+	.globl	addr_SREG
+	.align 4
+	.type	addr_SREG, @object
+	.size	addr_SREG, 4
+addr_SREG:
+	.long	63
+	.section	.rodata.str1.1
+.LC176:
+	.string	"EXIT"
+.LC177:
+	.string	"TIMEOUT"
+.LC178:
+	.string	"usage"
+.LC179:
+	.string	"memory"
+.LC180:
+	.string	"file i/o"
+.LC181:
+	.string	"FATAL ABORTED"
+.LC182:
+	.string	"fatal"
+	.section	.data.rel.ro.local
+	.align 32
+	.type	exit_status, @object
+	.size	exit_status, 216
+exit_status:
+	.quad	.LC176
+	.quad	0
+	.long	0
+	.long	-1
+	.quad	.LC0
+	.quad	0
+	.long	0
+	.long	1
+	.quad	.LC177
+	.quad	0
+	.long	0
+	.long	10
+	.quad	.LC0
+	.quad	0
+	.long	0
+	.long	11
+	.quad	.LC0
+	.quad	0
+	.long	0
+	.long	12
+	.quad	.LC0
+	.quad	.LC178
+	.long	1
+	.long	21
+	.quad	.LC0
+	.quad	.LC179
+	.long	1
+	.long	20
+	.quad	.LC0
+	.quad	.LC180
+	.long	1
+	.long	22
+	.quad	.LC181
+	.quad	.LC182
+	.long	1
+	.long	42
+	.section	.rodata.str1.1
+.LC183:
+	.string	"BAD_PC"
+.LC184:
+	.string	"UNDEF"
+.LC185:
+	.string	"SYSCALL"
+.LC186:
+	.string	"BCLR"
+.LC187:
+	.string	"BLD"
+.LC188:
+	.string	"BRBC"
+.LC189:
+	.string	"BRBS"
+.LC190:
+	.string	"BSET"
+.LC191:
+	.string	"BST"
+.LC192:
+	.string	"CBI"
+.LC193:
+	.string	"CPSE2"
+.LC194:
+	.string	"ELPM_Z"
+.LC195:
+	.string	"ELPM_Z_incr"
+.LC196:
+	.string	"LDD_Y"
+.LC197:
+	.string	"LDD_Z"
+.LC198:
+	.string	"LDS1"
+.LC199:
+	.string	"LD_X"
+.LC200:
+	.string	"LD_X_decr"
+.LC201:
+	.string	"LD_X_incr"
+.LC202:
+	.string	"LD_Y_decr"
+.LC203:
+	.string	"LD_Y_incr"
+.LC204:
+	.string	"LD_Z_decr"
+.LC205:
+	.string	"LD_Z_incr"
+.LC206:
+	.string	"LPM_Z"
+.LC207:
+	.string	"LPM_Z_incr"
+.LC208:
+	.string	"SBI"
+.LC209:
+	.string	"SBIC"
+.LC210:
+	.string	"SBIC2"
+.LC211:
+	.string	"SBIS"
+.LC212:
+	.string	"SBIS2"
+.LC213:
+	.string	"SBRC"
+.LC214:
+	.string	"SBRC2"
+.LC215:
+	.string	"SBRS"
+.LC216:
+	.string	"SBRS2"
+.LC217:
+	.string	"STD_Y"
+.LC218:
+	.string	"STD_Z"
+.LC219:
+	.string	"STS1"
+.LC220:
+	.string	"ST_X"
+.LC221:
+	.string	"ST_X_decr"
+.LC222:
+	.string	"ST_X_incr"
+.LC223:
+	.string	"ST_Y_decr"
+.LC224:
+	.string	"ST_Y_incr"
+.LC225:
+	.string	"ST_Z_decr"
+.LC226:
+	.string	"ST_Z_incr"
+	.section	.data.rel.ro.local
+	.align 32
+	.type	opcode_id, @object
+	.size	opcode_id, 896
+opcode_id:
+	.quad	.LC183
+	.quad	.LC65
+	.quad	.LC184
+	.quad	.LC185
+	.quad	.LC68
+	.quad	.LC69
+	.quad	.LC70
+	.quad	.LC71
+	.quad	.LC72
+	.quad	.LC73
+	.quad	.LC74
+	.quad	.LC186
+	.quad	.LC187
+	.quad	.LC77
+	.quad	.LC188
+	.quad	.LC189
+	.quad	.LC190
+	.quad	.LC191
+	.quad	.LC82
+	.quad	.LC192
+	.quad	.LC84
+	.quad	.LC85
+	.quad	.LC86
+	.quad	.LC87
+	.quad	.LC88
+	.quad	.LC193
+	.quad	.LC89
+	.quad	.LC90
+	.quad	.LC91
+	.quad	.LC92
+	.quad	.LC93
+	.quad	.LC194
+	.quad	.LC195
+	.quad	.LC96
+	.quad	.LC97
+	.quad	.LC98
+	.quad	.LC99
+	.quad	.LC100
+	.quad	.LC101
+	.quad	.LC102
+	.quad	.LC103
+	.quad	.LC104
+	.quad	.LC105
+	.quad	.LC106
+	.quad	.LC196
+	.quad	.LC197
+	.quad	.LC109
+	.quad	.LC198
+	.quad	.LC199
+	.quad	.LC200
+	.quad	.LC201
+	.quad	.LC202
+	.quad	.LC203
+	.quad	.LC204
+	.quad	.LC205
+	.quad	.LC117
+	.quad	.LC206
+	.quad	.LC207
+	.quad	.LC120
+	.quad	.LC121
+	.quad	.LC122
+	.quad	.LC123
+	.quad	.LC124
+	.quad	.LC125
+	.quad	.LC126
+	.quad	.LC127
+	.quad	.LC128
+	.quad	.LC129
+	.quad	.LC130
+	.quad	.LC131
+	.quad	.LC132
+	.quad	.LC133
+	.quad	.LC134
+	.quad	.LC135
+	.quad	.LC136
+	.quad	.LC137
+	.quad	.LC138
+	.quad	.LC139
+	.quad	.LC208
+	.quad	.LC209
+	.quad	.LC210
+	.quad	.LC211
+	.quad	.LC212
+	.quad	.LC213
+	.quad	.LC214
+	.quad	.LC215
+	.quad	.LC216
+	.quad	.LC145
+	.quad	.LC146
+	.quad	.LC217
+	.quad	.LC218
+	.quad	.LC149
+	.quad	.LC219
+	.quad	.LC220
+	.quad	.LC221
+	.quad	.LC222
+	.quad	.LC223
+	.quad	.LC224
+	.quad	.LC225
+	.quad	.LC226
+	.quad	.LC157
+	.quad	.LC158
+	.quad	.LC159
+	.quad	.LC160
+	.quad	.LC161
+	.quad	.LC162
+	.quad	.LC163
+	.quad	.LC164
+	.quad	.LC165
+	.quad	.LC166
+	.quad	.LC167
+	.quad	.LC168
+	.section	.rodata.str1.1
+.LC227:
+	.string	"LDI + LDI"
+.LC228:
+	.string	"CP + CPC"
+.LC229:
+	.string	"CPI + CPC"
+.LC230:
+	.string	"CPC + CPC"
+.LC231:
+	.string	"CP + BRBC"
+.LC232:
+	.string	"CP + BRBS"
+.LC233:
+	.string	"CPC + BRBC"
+.LC234:
+	.string	"CPC + BRBS"
+.LC235:
+	.string	"CPI + BRBC"
+.LC236:
+	.string	"CPI + BRBS"
+.LC237:
+	.string	"TST + BRBC"
+.LC238:
+	.string	"TST + BRBS"
+.LC239:
+	.string	"CP + CPC + BRBC"
+.LC240:
+	.string	"CP + CPC + BRBS"
+.LC241:
+	.string	"CPI + CPC + BRBC"
+.LC242:
+	.string	"CPI + CPC + BRBS"
+.LC243:
+	.string	"CP + CPC + CPC + CPC"
+.LC244:
+	.string	"SUBI + SBCI"
+.LC245:
+	.string	"SUBI + BRBC"
+.LC246:
+	.string	"SBCI + BRBC"
+.LC247:
+	.string	"SBCI + BRBS"
+.LC248:
+	.string	"SBIW + BRBC"
+.LC249:
+	.string	"SBIW + BRBS"
+.LC250:
+	.string	"DEC + BRBC"
+.LC251:
+	.string	"SUBI + SBCI + BRBC"
+.LC252:
+	.string	"ADD + ADC"
+.LC253:
+	.string	"ADD + ADC + ADC"
+.LC254:
+	.string	"ADD + ADC + ADC + ADC"
+.LC255:
+	.string	"MOVW + ADIW"
+.LC256:
+	.string	"MOVW + SBIW"
+.LC257:
+	.string	"PUSH + PUSH"
+.LC258:
+	.string	"POP + POP"
+.LC259:
+	.string	"LD_X_incr + ST_Z_incr"
+.LC260:
+	.string	"LD_Z_incr + ST_X_incr"
+.LC261:
+	.string	"LD_Y_incr + ST_Z_incr"
+.LC262:
+	.string	"LD_Z_incr + ST_Y_incr"
+.LC263:
+	.string	"LPM_Z_incr + ST_X_incr"
+.LC264:
+	.string	"ELPM_Z_incr + ST_X_incr"
+	.section	.rodata.str1.8
+	.align 8
+.LC265:
+	.string	"LPM_Z_incr + ST_X_incr + CPI + CPC"
+	.align 8
+.LC266:
+	.string	"ELPM_Z_incr + ST_X_incr + CPI + CPC"
+	.section	.rodata.str1.1
+.LC267:
+	.string	"ST_X_incr + CPI + CPC + BRBC"
+	.section	.data.rel.ro.local
+	.align 32
+	.type	fuse_seq, @object
+	.size	fuse_seq, 656
+fuse_seq:
+	.long	2
+	.string	"++"
+	.zero	1
+	.quad	.LC227
+	.long	2
+	.string	"\025\026"
+	.zero	1
+	.quad	.LC228
+	.long	2
+	.string	"\027\026"
+	.zero	1
+	.quad	.LC229
+	.long	2
+	.string	"\026\026"
+	.zero	1
+	.quad	.LC230
+	.long	2
+	.string	"\025\016"
+	.zero	1
+	.quad	.LC231
+	.long	2
+	.string	"\025\017"
+	.zero	1
+	.quad	.LC232
+	.long	2
+	.string	"\026\016"
+	.zero	1
+	.quad	.LC233
+	.long	2
+	.string	"\026\017"
+	.zero	1
+	.quad	.LC234
+	.long	2
+	.string	"\027\016"
+	.zero	1
+	.quad	.LC235
+	.long	2
+	.string	"\027\017"
+	.zero	1
+	.quad	.LC236
+	.long	2
+	.string	"k\016"
+	.zero	1
+	.quad	.LC237
+	.long	2
+	.string	"k\017"
+	.zero	1
+	.quad	.LC238
+	.long	3
+	.string	"\025\026\016"
+	.quad	.LC239
+	.long	3
+	.string	"\025\026\017"
+	.quad	.LC240
+	.long	3
+	.string	"\027\026\016"
+	.quad	.LC241
+	.long	3
+	.string	"\027\026\017"
+	.quad	.LC242
+	.long	4
+	.ascii	"\025\026\026\026"
+	.quad	.LC243
+	.long	2
+	.string	"eM"
+	.zero	1
+	.quad	.LC244
+	.long	2
+	.string	"e\016"
+	.zero	1
+	.quad	.LC245
+	.long	2
+	.string	"M\016"
+	.zero	1
+	.quad	.LC246
+	.long	2
+	.string	"M\017"
+	.zero	1
+	.quad	.LC247
+	.long	2
+	.string	"\007\016"
+	.zero	1
+	.quad	.LC248
+	.long	2
+	.string	"\007\017"
+	.zero	1
+	.quad	.LC249
+	.long	2
+	.string	"\032\016"
+	.zero	1
+	.quad	.LC250
+	.long	3
+	.string	"eM\016"
+	.quad	.LC251
+	.long	2
+	.string	"\005\004"
+	.zero	1
+	.quad	.LC252
+	.long	3
+	.string	"\005\004\004"
+	.quad	.LC253
+	.long	4
+	.ascii	"\005\004\004\004"
+	.quad	.LC254
+	.long	2
+	.string	"<\006"
+	.zero	1
+	.quad	.LC255
+	.long	2
+	.string	"<\007"
+	.zero	1
+	.quad	.LC256
+	.long	2
+	.string	"FF"
+	.zero	1
+	.quad	.LC257
+	.long	2
+	.string	"EE"
+	.zero	1
+	.quad	.LC258
+	.long	2
+	.string	"2c"
+	.zero	1
+	.quad	.LC259
+	.long	2
+	.string	"6_"
+	.zero	1
+	.quad	.LC260
+	.long	2
+	.string	"4c"
+	.zero	1
+	.quad	.LC261
+	.long	2
+	.string	"6a"
+	.zero	1
+	.quad	.LC262
+	.long	2
+	.string	"9_"
+	.zero	1
+	.quad	.LC263
+	.long	2
+	.string	" _"
+	.zero	1
+	.quad	.LC264
+	.long	4
+	.ascii	"9_\027\026"
+	.quad	.LC265
+	.long	4
+	.ascii	" _\027\026"
+	.quad	.LC266
+	.long	4
+	.ascii	"_\027\026\016"
+	.quad	.LC267
+	.globl	invalid_opcode
+	.section	.rodata
+	.align 4
+	.type	invalid_opcode, @object
+	.size	invalid_opcode, 4
+invalid_opcode:
+	.long	65535
+	.globl	io_base
+	.align 4
+	.type	io_base, @object
+	.size	io_base, 4
+io_base:
+	.zero	4
+	.globl	is_avrtest_log
+	.type	is_avrtest_log, @object
+	.size	is_avrtest_log, 1
+is_avrtest_log:
+	.zero	1
+	.globl	is_tiny
+	.type	is_tiny, @object
+	.size	is_tiny, 1
+is_tiny:
+	.zero	1
+	.globl	is_xmega
+	.type	is_xmega, @object
+	.size	is_xmega, 1
+is_xmega:
+	.byte	1
+	.align 32
+	.type	flag_update_table_logical, @object
+	.size	flag_update_table_logical, 256
+flag_update_table_logical:
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.ascii	"\024\024\024\024\024\024\024\024\024\024\024\024\024\024\024"
+	.ascii	"\024\024\024\024\024\024\024\024\024\024\024\024\024\024\024"
+	.ascii	"\024\024\024\024\024\024\024\024\024\024\024\024\024\024\024"
+	.ascii	"\024\024\024\024\024\024\024\024\024\024\024\024\024\024\024"
+	.ascii	"\024\024\024\024\024\024\024\024\024\024\024\024\024\024\024"
+	.ascii	"\024\024\024\024\024\024\024\024\024\024\024\024\024\024\024"
+	.ascii	"\024\024\024\024\024\024\024\024\024\024\024\024\024\024\024"
+	.ascii	"\024\024\024\024\024\024\024\024\024\024\024\024\024\024\024"
+	.ascii	"\024\024\024\024\024\024\024\024"
+	.section	.rodata.cst8,"aM",@progbits,8
+	.align 8
+.LC11:
+	.long	0
+	.long	1079574528
+	.align 8
+.LC19:
+	.long	0
+	.long	1083129856
+	.align 8
+.LC20:
+	.long	-755914244
+	.long	1062232653
+	.align 8
+.LC21:
+	.long	1202590843
+	.long	1065646817
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
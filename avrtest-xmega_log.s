@@ -0,0 +1,15944 @@
+	.file	"avrtest.c"
+	.text
+	.p2align 4
+	.type	host_getchar, @function
+host_getchar:
+.LFB200:
+	.cfi_startproc
+	movq	896(%rdi), %rdi	# 6	[c=9 l=7]  *movdi_internal/3
+	jmp	getc@PLT	# 8	[c=10 l=5]  *sibcall_value
+	.cfi_endproc
+.LFE200:
+	.size	host_getchar, .-host_getchar
+	.p2align 4
+	.type	flash_changed, @function
+flash_changed:
+.LFB82:
+	.cfi_startproc
+	pushq	%rbp	# 64	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rdi, %rbp	# 2	[c=4 l=3]  *movdi_internal/3
+	pushq	%rbx	# 65	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	movl	%edx, %ebx	# 4	[c=4 l=2]  *movsi_internal/0
+	subq	$8, %rsp	# 66	[c=4 l=4]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_def_cfa_offset 32
+	call	redecode_flash@PLT	# 11	[c=10 l=5]  *call_value
+	movl	$510, %edx	# 56	[c=4 l=5]  *movsi_internal/0
+	movl	992(%rbp), %ecx	# 62	[c=9 l=6]  *movsi_internal/0
+	cmpl	%edx, %eax	# 57	[c=4 l=2]  *cmpsi_1/0
+	cmovb	%edx, %eax	# 58	[c=8 l=3]  *movsicc_noc/1
+	shrl	%ebx	# 17	[c=4 l=2]  *lshrsi3_1/0
+	leal	1(%rcx), %edx	# 63	[c=4 l=3]  *leasi
+	movl	120(%rbp), %ecx	# 20	[c=9 l=3]  *movsi_internal/0
+	addl	$2, %ebx	# 18	[c=4 l=3]  *addsi_1/0
+	subl	$510, %eax	# 14	[c=4 l=5]  *addsi_1/0
+	cmpl	%ebx, %edx	# 59	[c=4 l=2]  *cmpsi_1/0
+	cmova	%ebx, %edx	# 60	[c=8 l=3]  *movsicc_noc/1
+	testl	%ecx, %ecx	# 21	[c=4 l=2]  *cmpsi_ccno_1/0
+	je	.L4	# 22	[c=13 l=2]  *jcc
+	movl	116(%rbp), %esi	# 51	[c=9 l=3]  *movsi_internal/0
+	cmpl	%esi, %eax	# 52	[c=4 l=2]  *cmpsi_1/0
+	cmova	%esi, %eax	# 53	[c=8 l=3]  *movsicc_noc/1
+	cmpl	%ecx, %edx	# 54	[c=4 l=2]  *cmpsi_1/0
+	cmovb	%ecx, %edx	# 55	[c=8 l=3]  *movsicc_noc/1
+.L4:
+	movl	%eax, 116(%rbp)	# 29	[c=4 l=3]  *movsi_internal/1
+	movl	584(%rbp), %eax	# 80	[c=9 l=6]  *movsi_internal/0
+	movl	%edx, 120(%rbp)	# 28	[c=4 l=3]  *movsi_internal/1
+	testl	%eax, %eax	# 81	[c=4 l=2]  *cmpsi_ccno_1/0
+	jne	.L10	# 31	[c=13 l=2]  *jcc
+	addq	$8, %rsp	# 69	[c=4 l=4]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx	# 70	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 16
+	popq	%rbp	# 71	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 8
+	ret		# 72	[c=0 l=1]  simple_return_internal
+	.p2align 4,,10
+	.p2align 3
+.L10:
+	.cfi_restore_state
+	addq	$8, %rsp	# 76	[c=4 l=4]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_def_cfa_offset 24
+	movq	%rbp, %rdi	# 33	[c=4 l=3]  *movdi_internal/3
+	popq	%rbx	# 77	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 16
+	popq	%rbp	# 78	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 8
+	jmp	hle_forget@PLT	# 34	[c=0 l=5]  *sibcall
+	.cfi_endproc
+.LFE82:
+	.size	flash_changed, .-flash_changed
+	.p2align 4
+	.globl	qprintf
+	.type	qprintf, @function
+qprintf:
+.LFB15:
+	.cfi_startproc
+	subq	$216, %rsp	# 50	[c=4 l=7]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_def_cfa_offset 224
+	movq	%rdx, 48(%rsp)	# 4	[c=4 l=5]  *movdi_internal/5
+	movq	%rcx, 56(%rsp)	# 5	[c=4 l=5]  *movdi_internal/5
+	movq	%r8, 64(%rsp)	# 6	[c=4 l=5]  *movdi_internal/5
+	movq	%r9, 72(%rsp)	# 7	[c=4 l=5]  *movdi_internal/5
+	testb	%al, %al	# 8	[c=4 l=2]  *cmpqi_ccno_1/0
+	je	.L14	# 9	[c=13 l=2]  *jcc
+	movaps	%xmm0, 80(%rsp)	# 10	[c=4 l=5]  movv4sf_internal/3
+	movaps	%xmm1, 96(%rsp)	# 11	[c=4 l=5]  movv4sf_internal/3
+	movaps	%xmm2, 112(%rsp)	# 12	[c=4 l=5]  movv4sf_internal/3
+	movaps	%xmm3, 128(%rsp)	# 13	[c=4 l=8]  movv4sf_internal/3
+	movaps	%xmm4, 144(%rsp)	# 14	[c=4 l=8]  movv4sf_internal/3
+	movaps	%xmm5, 160(%rsp)	# 15	[c=4 l=8]  movv4sf_internal/3
+	movaps	%xmm6, 176(%rsp)	# 16	[c=4 l=8]  movv4sf_internal/3
+	movaps	%xmm7, 192(%rsp)	# 17	[c=4 l=8]  movv4sf_internal/3
+.L14:
+	movl	216(%rdi), %eax	# 58	[c=9 l=6]  *movsi_internal/0
+	testl	%eax, %eax	# 59	[c=4 l=2]  *cmpsi_ccno_1/0
+	je	.L16	# 23	[c=13 l=2]  *jcc
+	addq	$216, %rsp	# 53	[c=4 l=7]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_remember_state
+	.cfi_def_cfa_offset 8
+	ret		# 54	[c=0 l=1]  simple_return_internal
+	.p2align 4,,10
+	.p2align 3
+.L16:
+	.cfi_restore_state
+	leaq	224(%rsp), %rax	# 47	[c=4 l=8]  *leadi
+	movq	904(%rdi), %rdi	# 31	[c=9 l=7]  *movdi_internal/3
+	leaq	8(%rsp), %rdx	# 49	[c=4 l=5]  *leadi
+	movl	$16, 8(%rsp)	# 26	[c=4 l=8]  *movsi_internal/1
+	movq	%rax, 16(%rsp)	# 28	[c=4 l=5]  *movdi_internal/5
+	leaq	32(%rsp), %rax	# 48	[c=4 l=5]  *leadi
+	movl	$48, 12(%rsp)	# 27	[c=4 l=8]  *movsi_internal/1
+	movq	%rax, 24(%rsp)	# 29	[c=4 l=5]  *movdi_internal/5
+	call	vfprintf@PLT	# 35	[c=10 l=5]  *call_value
+	addq	$216, %rsp	# 62	[c=4 l=7]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_def_cfa_offset 8
+	ret		# 63	[c=0 l=1]  simple_return_internal
+	.cfi_endproc
+.LFE15:
+	.size	qprintf, .-qprintf
+	.p2align 4
+	.globl	quit
+	.type	quit, @function
+quit:
+.LFB19:
+	.cfi_startproc
+	subq	$8, %rsp	# 18	[c=4 l=4]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_def_cfa_offset 16
+	movl	%esi, 136(%rdi)	# 7	[c=4 l=6]  *movsi_internal/1
+	movl	$1, %esi	# 9	[c=4 l=5]  *movsi_internal/0
+	movq	128(%rdi), %rdi	# 8	[c=9 l=7]  *movdi_internal/3
+	call	longjmp@PLT	# 11	[c=0 l=5]  *call
+	.cfi_endproc
+.LFE19:
+	.size	quit, .-quit
+	.section	.rodata.str1.1,"aMS",@progbits,1
+.LC0:
+	.string	"ABORTED"
+.LC1:
+	.string	"w"
+.LC2:
+	.string	"%s: cannot write -status=%s\n"
+.LC3:
+	.string	"%d %lu %lu %s\n"
+	.text
+	.p2align 4
+	.type	finish, @function
+finish:
+.LFB20:
+	.cfi_startproc
+	pushq	%r12	# 117	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	pushq	%rbp	# 118	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	movl	%esi, %ebp	# 3	[c=4 l=2]  *movsi_internal/0
+	pushq	%rbx	# 119	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	movl	440(%rdi), %esi	# 132	[c=9 l=6]  *movsi_internal/0
+	movq	%rdi, %rbx	# 2	[c=4 l=3]  *movdi_internal/3
+	testl	%esi, %esi	# 133	[c=4 l=2]  *cmpsi_ccno_1/0
+	jne	.L31	# 10	[c=13 l=2]  *jcc
+.L20:
+	movq	11016(%rbx), %rax	# 62	[c=9 l=7]  *movdi_internal/3
+	testq	%rax, %rax	# 63	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L23	# 64	[c=13 l=2]  *jcc
+	movdqu	40(%rbx), %xmm0	# 114	[c=13 l=5]  movv2di_internal/2
+	movl	76(%rbx), %ecx	# 128	[c=9 l=3]  *movsi_internal/0
+	movl	%ebp, (%rax)	# 66	[c=4 l=2]  *movsi_internal/1
+	leaq	.LC0(%rip), %rdx	# 6	[c=1 l=7]  *movdi_internal/4
+	shufpd	$1, %xmm0, %xmm0	# 70	[c=4 l=5]  sse2_shufpd_v2di/0
+	movups	%xmm0, 8(%rax)	# 71	[c=4 l=4]  movv2di_internal/3
+	testl	%ecx, %ecx	# 129	[c=4 l=2]  *cmpsi_ccno_1/0
+	je	.L32	# 73	[c=13 l=2]  *jcc
+.L24:
+	movq	%rdx, 24(%rax)	# 83	[c=4 l=4]  *movdi_internal/5
+.L23:
+	movl	%ebp, %esi	# 86	[c=4 l=2]  *movsi_internal/0
+	movq	%rbx, %rdi	# 87	[c=4 l=3]  *movdi_internal/3
+	call	quit	# 88	[c=0 l=5]  *call
+.L32:
+	movslq	72(%rbx), %rdx	# 77	[c=13 l=4]  *extendsidi2_rex64/1
+	leaq	exit_status(%rip), %rcx	# 112	[c=1 l=7]  *movdi_internal/4
+	imulq	$24, %rdx, %rdx	# 78	[c=16 l=4]  *muldi3_1/0
+	movq	(%rcx,%rdx), %rdx	# 80	[c=9 l=4]  *movdi_internal/3
+	jmp	.L24	# 136	[c=1 l=2]  jump
+.L31:
+	movq	448(%rdi), %rdi	# 12	[c=9 l=7]  *movdi_internal/3
+	leaq	.LC1(%rip), %rsi	# 13	[c=1 l=7]  *movdi_internal/4
+	call	fopen@PLT	# 16	[c=10 l=5]  *call_value
+	movq	%rax, %r12	# 17	[c=4 l=3]  *movdi_internal/3
+	testq	%rax, %rax	# 19	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L33	# 20	[c=13 l=2]  *jcc
+	cmpl	$0, 76(%rbx)	# 36	[c=13 l=4]  *cmpsi_ccno_1/1
+	leaq	.LC0(%rip), %r9	# 5	[c=1 l=7]  *movdi_internal/4
+	je	.L34	# 37	[c=13 l=2]  *jcc
+.L22:
+	movq	48(%rbx), %rcx	# 48	[c=9 l=4]  *movdi_internal/3
+	movq	40(%rbx), %r8	# 50	[c=9 l=4]  *movdi_internal/3
+	movq	%r12, %rdi	# 55	[c=4 l=3]  *movdi_internal/3
+	movl	%ebp, %edx	# 52	[c=4 l=2]  *movsi_internal/0
+	leaq	.LC3(%rip), %rsi	# 53	[c=1 l=7]  *movdi_internal/4
+	xorl	%eax, %eax	# 130	[c=4 l=2]  *movdi_xor
+	call	fprintf@PLT	# 57	[c=10 l=5]  *call_value
+	movq	%r12, %rdi	# 58	[c=4 l=3]  *movdi_internal/3
+	call	fclose@PLT	# 59	[c=10 l=5]  *call_value
+	jmp	.L20	# 140	[c=1 l=5]  jump
+.L34:
+	movslq	72(%rbx), %rax	# 41	[c=13 l=4]  *extendsidi2_rex64/1
+	leaq	exit_status(%rip), %rdx	# 111	[c=1 l=7]  *movdi_internal/4
+	imulq	$24, %rax, %rax	# 42	[c=16 l=4]  *muldi3_1/0
+	movq	(%rdx,%rax), %r9	# 44	[c=9 l=4]  *movdi_internal/3
+	jmp	.L22	# 142	[c=1 l=2]  jump
+.L33:
+	movq	448(%rbx), %rcx	# 22	[c=9 l=7]  *movdi_internal/3
+	movq	144(%rbx), %rdx	# 23	[c=9 l=7]  *movdi_internal/3
+	leaq	.LC2(%rip), %rsi	# 27	[c=1 l=7]  *movdi_internal/4
+	xorl	%eax, %eax	# 131	[c=4 l=2]  *movdi_xor
+	movq	912(%rbx), %rdi	# 24	[c=9 l=7]  *movdi_internal/3
+	call	fprintf@PLT	# 31	[c=10 l=5]  *call_value
+	jmp	.L20	# 144	[c=1 l=5]  jump
+	.cfi_endproc
+.LFE20:
+	.size	finish, .-finish
+	.section	.rodata.str1.1
+.LC5:
+	.string	"-not set-"
+.LC6:
+	.string	"\n"
+	.section	.rodata.str1.8,"aMS",@progbits,1
+	.align 8
+.LC11:
+	.string	"        load: %lu:%02lu.%06lu  = %3lu.%03lu sec  = %6.2f%%,  %10.3f        bytes/ms, 0x%05x = %u bytes\n"
+	.align 8
+.LC12:
+	.string	"      decode: %lu:%02lu.%06lu  = %3lu.%03lu sec  = %6.2f%%,  %10.3f        bytes/ms, 0x%05x = %u bytes\n"
+	.align 8
+.LC13:
+	.string	"     execute: %lu:%02lu.%06lu  = %3lu.%03lu sec  = %6.2f%%,  %10.3f instructions/ms\n"
+	.align 8
+.LC14:
+	.string	" avrtest run: %lu:%02lu.%06lu  = %3lu.%03lu sec  = %6.2f%%,  %10.3f instructions/ms\n"
+	.align 8
+.LC15:
+	.string	" exit status: %s\n      reason: "
+	.section	.rodata.str1.1
+.LC16:
+	.string	"\n     program: %s\n"
+.LC17:
+	.string	" entry point: %06x\n"
+	.section	.rodata.str1.8
+	.align 8
+.LC18:
+	.string	"exit address: %06x\ntotal cycles: %lu\n"
+	.section	.rodata.str1.1
+.LC19:
+	.string	"      asleep: %lu\n"
+.LC20:
+	.string	"total instr.: %lu\n\n"
+.LC21:
+	.string	"\n%s: %s error: "
+	.text
+	.p2align 4
+	.globl	leave
+	.type	leave, @function
+leave:
+.LFB21:
+	.cfi_startproc
+	pushq	%rbp	# 1208	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp	# 1209	[c=4 l=3]  *movdi_internal/3
+	.cfi_def_cfa_register 6
+	pushq	%r15	# 1210	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_offset 15, -24
+	movq	%rdi, %r15	# 2	[c=4 l=3]  *movdi_internal/3
+	pushq	%r14	# 1211	[c=4 l=2]  *pushdi2_rex64/0
+	pushq	%r13	# 1212	[c=4 l=2]  *pushdi2_rex64/0
+	pushq	%r12	# 1213	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_offset 14, -32
+	.cfi_offset 13, -40
+	.cfi_offset 12, -48
+	movq	%rdx, %r12	# 4	[c=4 l=3]  *movdi_internal/3
+	pushq	%rbx	# 1214	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_offset 3, -56
+	movl	%esi, %ebx	# 3	[c=4 l=2]  *movsi_internal/0
+	subq	$328, %rsp	# 1215	[c=4 l=7]  pro_epilogue_adjust_stack_add_di/0
+	movq	%rcx, -200(%rbp)	# 5	[c=4 l=7]  *movdi_internal/5
+	movq	%r8, -192(%rbp)	# 6	[c=4 l=7]  *movdi_internal/5
+	movq	%r9, -184(%rbp)	# 7	[c=4 l=7]  *movdi_internal/5
+	testb	%al, %al	# 8	[c=4 l=2]  *cmpqi_ccno_1/0
+	je	.L103	# 9	[c=13 l=2]  *jcc
+	movaps	%xmm0, -176(%rbp)	# 10	[c=4 l=7]  movv4sf_internal/3
+	movaps	%xmm1, -160(%rbp)	# 11	[c=4 l=7]  movv4sf_internal/3
+	movaps	%xmm2, -144(%rbp)	# 12	[c=4 l=7]  movv4sf_internal/3
+	movaps	%xmm3, -128(%rbp)	# 13	[c=4 l=4]  movv4sf_internal/3
+	movaps	%xmm4, -112(%rbp)	# 14	[c=4 l=4]  movv4sf_internal/3
+	movaps	%xmm5, -96(%rbp)	# 15	[c=4 l=4]  movv4sf_internal/3
+	movaps	%xmm6, -80(%rbp)	# 16	[c=4 l=4]  movv4sf_internal/3
+	movaps	%xmm7, -64(%rbp)	# 17	[c=4 l=4]  movv4sf_internal/3
+.L103:
+	movl	96(%r15), %edx	# 31	[c=9 l=4]  *movsi_internal/0
+	movl	%ebx, 72(%r15)	# 30	[c=4 l=4]  *movsi_internal/1
+	testl	%edx, %edx	# 32	[c=4 l=2]  *cmpsi_ccno_1/0
+	je	.L38	# 33	[c=13 l=2]  *jcc
+	movq	40(%r15), %rax	# 994	[c=9 l=4]  *movdi_internal/3
+	subq	$1, %rax	# 40	[c=4 l=4]  *adddi_1/0
+	subl	$1, %edx	# 1276	[c=4 l=3]  *addsi_4
+	movq	%rax, 40(%r15)	# 41	[c=4 l=4]  *movdi_internal/5
+	je	.L124	# 44	[c=13 l=6]  *jcc
+.L38:
+	movq	%r15, %rdi	# 57	[c=4 l=3]  *movdi_internal/3
+	leaq	exit_status(%rip), %r14	# 61	[c=1 l=7]  *movdi_internal/4
+	call	periph_finish@PLT	# 58	[c=0 l=5]  *call
+	movq	%r15, %rdi	# 59	[c=4 l=3]  *movdi_internal/3
+	call	replay_finish@PLT	# 60	[c=0 l=5]  *call
+	movslq	%ebx, %rax	# 62	[c=4 l=3]  *extendsidi2_rex64/1
+	movq	%rax, -264(%rbp)	# 1121	[c=4 l=7]  *movdi_internal/5
+	leaq	(%rax,%rax,2), %rax	# 65	[c=8 l=4]  *leadi
+	movl	16(%r14,%rax,8), %r13d	# 70	[c=10 l=5]  *movsi_internal/0
+	testl	%r13d, %r13d	# 71	[c=4 l=3]  *cmpsi_ccno_1/0
+	je	.L40	# 72	[c=13 l=6]  *jcc
+	xorl	%eax, %eax	# 1273	[c=4 l=2]  *movdi_xor
+	leaq	.LC6(%rip), %rsi	# 74	[c=1 l=7]  *movdi_internal/4
+	movq	%r15, %rdi	# 76	[c=4 l=3]  *movdi_internal/3
+	call	qprintf	# 78	[c=0 l=5]  *call
+	movl	216(%r15), %r11d	# 1274	[c=9 l=7]  *movsi_internal/0
+	leaq	-256(%rbp), %rax	# 875	[c=4 l=7]  *leadi
+	movq	%rax, -272(%rbp)	# 997	[c=4 l=7]  *movdi_internal/5
+	testl	%r11d, %r11d	# 1275	[c=4 l=3]  *cmpsi_ccno_1/0
+	jne	.L125	# 80	[c=13 l=6]  *jcc
+.L41:
+	leaq	16(%rbp), %rax	# 1108	[c=4 l=4]  *leadi
+	cmpl	$0, 76(%r15)	# 606	[c=13 l=5]  *cmpsi_ccno_1/1
+	movl	$24, -256(%rbp)	# 602	[c=4 l=10]  *movsi_internal/1
+	leaq	.LC0(%rip), %rdx	# 26	[c=1 l=7]  *movdi_internal/4
+	movq	%rax, -248(%rbp)	# 604	[c=4 l=7]  *movdi_internal/5
+	leaq	-224(%rbp), %rax	# 1109	[c=4 l=7]  *leadi
+	movl	$48, -252(%rbp)	# 603	[c=4 l=10]  *movsi_internal/1
+	movq	%rax, -240(%rbp)	# 605	[c=4 l=7]  *movdi_internal/5
+	je	.L126	# 607	[c=13 l=6]  *jcc
+.L90:
+	movq	904(%r15), %rdi	# 616	[c=9 l=7]  *movdi_internal/3
+	leaq	.LC15(%rip), %rsi	# 618	[c=1 l=7]  *movdi_internal/4
+	xorl	%eax, %eax	# 1237	[c=4 l=2]  *movdi_xor
+	call	fprintf@PLT	# 622	[c=10 l=5]  *call_value
+	movq	-272(%rbp), %rdx	# 625	[c=9 l=7]  *movdi_internal/3
+	movq	904(%r15), %rdi	# 624	[c=9 l=7]  *movdi_internal/3
+	movq	%r12, %rsi	# 626	[c=4 l=3]  *movdi_internal/3
+	call	vfprintf@PLT	# 628	[c=10 l=5]  *call_value
+	movq	80(%r15), %rdx	# 629	[c=9 l=4]  *movdi_internal/3
+	testq	%rdx, %rdx	# 630	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L127	# 631	[c=13 l=6]  *jcc
+.L91:
+	movq	904(%r15), %rdi	# 635	[c=9 l=7]  *movdi_internal/3
+	xorl	%eax, %eax	# 1236	[c=4 l=2]  *movdi_xor
+	leaq	.LC16(%rip), %rsi	# 637	[c=1 l=7]  *movdi_internal/4
+	call	fprintf@PLT	# 641	[c=10 l=5]  *call_value
+	testl	%r13d, %r13d	# 642	[c=4 l=3]  *cmpsi_ccno_1/0
+	jne	.L92	# 643	[c=13 l=2]  *jcc
+	movl	8(%r15), %edx	# 645	[c=9 l=4]  *movsi_internal/0
+	testl	%edx, %edx	# 646	[c=4 l=2]  *cmpsi_ccno_1/0
+	jne	.L128	# 647	[c=13 l=6]  *jcc
+.L93:
+	movl	(%r15), %eax	# 1113	[c=5 l=3]  *movsi_internal/0
+	movq	48(%r15), %rcx	# 658	[c=9 l=4]  *movdi_internal/3
+	leaq	.LC18(%rip), %rsi	# 664	[c=1 l=7]  *movdi_internal/4
+	movq	904(%r15), %rdi	# 661	[c=9 l=7]  *movdi_internal/3
+	leal	(%rax,%rax), %edx	# 1180	[c=12 l=3]  *leasi
+	xorl	%eax, %eax	# 1234	[c=4 l=2]  *movdi_xor
+	call	fprintf@PLT	# 668	[c=10 l=5]  *call_value
+	movq	64(%r15), %rdx	# 669	[c=9 l=4]  *movdi_internal/3
+	testq	%rdx, %rdx	# 670	[c=4 l=3]  *cmpdi_ccno_1/0
+	jne	.L129	# 671	[c=13 l=6]  *jcc
+.L94:
+	movq	40(%r15), %rdx	# 682	[c=9 l=4]  *movdi_internal/3
+	movq	904(%r15), %rdi	# 683	[c=9 l=7]  *movdi_internal/3
+	leaq	.LC20(%rip), %rsi	# 685	[c=1 l=7]  *movdi_internal/4
+	xorl	%eax, %eax	# 1232	[c=4 l=2]  *movdi_xor
+	call	fprintf@PLT	# 689	[c=10 l=5]  *call_value
+.L92:
+	movq	904(%r15), %rdi	# 692	[c=9 l=7]  *movdi_internal/3
+	call	fflush@PLT	# 694	[c=10 l=5]  *call_value
+	movl	%r13d, %esi	# 695	[c=4 l=3]  *movsi_internal/0
+	movq	%r15, %rdi	# 696	[c=4 l=3]  *movdi_internal/3
+	call	finish	# 697	[c=0 l=5]  *call
+.L126:
+	imulq	$24, -264(%rbp), %rax	# 611	[c=25 l=8]  *muldi3_1/0
+	movq	(%r14,%rax), %rdx	# 613	[c=9 l=4]  *movdi_internal/3
+	jmp	.L90	# 1283	[c=1 l=5]  jump
+.L40:
+	xorl	%esi, %esi	# 1271	[c=4 l=2]  *movdi_xor
+	movq	%r15, %rdi	# 87	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 88	[c=0 l=5]  *call
+	xorl	%eax, %eax	# 1272	[c=4 l=2]  *movdi_xor
+	leaq	.LC6(%rip), %rsi	# 89	[c=1 l=7]  *movdi_internal/4
+	movq	%r15, %rdi	# 91	[c=4 l=3]  *movdi_internal/3
+	call	qprintf	# 93	[c=0 l=5]  *call
+	cmpl	$0, 232(%r15)	# 94	[c=13 l=8]  *cmpsi_ccno_1/1
+	je	.L43	# 95	[c=13 l=6]  *jcc
+	leaq	-256(%rbp), %rax	# 1207	[c=4 l=7]  *leadi
+	xorl	%esi, %esi	# 1270	[c=4 l=2]  *movdi_xor
+	movq	%rax, %rdi	# 99	[c=4 l=3]  *movdi_internal/3
+	movq	%rax, -272(%rbp)	# 1124	[c=4 l=7]  *movdi_internal/5
+	call	gettimeofday@PLT	# 100	[c=10 l=5]  *call_value
+	movq	-248(%rbp), %rax	# 103	[c=9 l=7]  *movdi_internal/3
+	movq	-256(%rbp), %rsi	# 101	[c=9 l=7]  *movdi_internal/3
+	movq	928(%r15), %rdx	# 102	[c=9 l=7]  *movdi_internal/3
+	movq	%rax, %rdi	# 1001	[c=4 l=3]  *movdi_internal/3
+	movq	%rsi, %rcx	# 999	[c=4 l=3]  *movdi_internal/3
+	subq	920(%r15), %rcx	# 104	[c=13 l=7]  *subdi_1/1
+	subq	%rdx, %rdi	# 105	[c=4 l=3]  *subdi_1/0
+	movq	%rcx, -280(%rbp)	# 1123	[c=4 l=7]  *movdi_internal/5
+	movq	%rdi, -288(%rbp)	# 1122	[c=4 l=7]  *movdi_internal/5
+	cmpq	%rdx, %rax	# 106	[c=4 l=3]  *cmpdi_1/0
+	jnb	.L44	# 107	[c=13 l=2]  *jcc
+	subq	$1, %rcx	# 109	[c=4 l=4]  *adddi_1/0
+	addq	$1000000, %rdi	# 110	[c=4 l=7]  *adddi_1/0
+	movq	%rcx, -280(%rbp)	# 1004	[c=4 l=7]  *movdi_internal/5
+	movq	%rdi, -288(%rbp)	# 1006	[c=4 l=7]  *movdi_internal/5
+.L44:
+	movq	-280(%rbp), %rcx	# 1125	[c=9 l=7]  *movdi_internal/3
+	testq	%rcx, %rcx	# 115	[c=4 l=3]  *cmpdi_ccno_1/0
+	js	.L45	# 116	[c=13 l=6]  *jcc
+	pxor	%xmm2, %xmm2	# 1375	[c=4 l=4]  movv2df_internal/0
+	cvtsi2sdq	%rcx, %xmm2	# 1376	[c=4 l=5]  sse2_cvtsi2sdq/0
+.L46:
+	movsd	.LC7(%rip), %xmm5	# 127	[c=6 l=8]  *movdf_internal/14
+	movq	-288(%rbp), %rcx	# 1127	[c=9 l=7]  *movdi_internal/3
+	mulsd	%xmm5, %xmm2	# 128	[c=20 l=4]  *fop_df_comm/1
+	testq	%rcx, %rcx	# 131	[c=4 l=3]  *cmpdi_ccno_1/0
+	js	.L47	# 132	[c=13 l=6]  *jcc
+	pxor	%xmm0, %xmm0	# 1373	[c=4 l=4]  movv2df_internal/0
+	cvtsi2sdq	%rcx, %xmm0	# 1374	[c=4 l=5]  sse2_cvtsi2sdq/0
+.L48:
+	movsd	.LC8(%rip), %xmm4	# 143	[c=6 l=8]  *movdf_internal/14
+	movq	968(%r15), %rcx	# 146	[c=9 l=7]  *movdi_internal/3
+	movq	%rax, %rdi	# 1019	[c=4 l=3]  *movdi_internal/3
+	movq	976(%r15), %rdx	# 147	[c=9 l=7]  *movdi_internal/3
+	mulsd	%xmm4, %xmm0	# 144	[c=20 l=4]  *fop_df_comm/1
+	subq	%rcx, %rsi	# 148	[c=4 l=3]  *subdi_1/0
+	subq	%rdx, %rdi	# 149	[c=4 l=3]  *subdi_1/0
+	movq	%rsi, -296(%rbp)	# 1130	[c=4 l=7]  *movdi_internal/5
+	movq	%rdi, -304(%rbp)	# 1129	[c=4 l=7]  *movdi_internal/5
+	addsd	%xmm0, %xmm2	# 145	[c=12 l=4]  *fop_df_comm/1
+	cmpq	%rdx, %rax	# 150	[c=4 l=3]  *cmpdi_1/0
+	jnb	.L49	# 151	[c=13 l=2]  *jcc
+	subq	$1, %rsi	# 153	[c=4 l=4]  *adddi_1/0
+	addq	$1000000, %rdi	# 154	[c=4 l=7]  *adddi_1/0
+	movq	%rsi, -296(%rbp)	# 1022	[c=4 l=7]  *movdi_internal/5
+	movq	%rdi, -304(%rbp)	# 1024	[c=4 l=7]  *movdi_internal/5
+.L49:
+	movq	-296(%rbp), %rax	# 1131	[c=9 l=7]  *movdi_internal/3
+	testq	%rax, %rax	# 159	[c=4 l=3]  *cmpdi_ccno_1/0
+	js	.L50	# 160	[c=13 l=6]  *jcc
+	pxor	%xmm1, %xmm1	# 1371	[c=4 l=4]  movv2df_internal/0
+	cvtsi2sdq	%rax, %xmm1	# 1372	[c=4 l=5]  sse2_cvtsi2sdq/0
+.L51:
+	movq	-304(%rbp), %rax	# 1133	[c=9 l=7]  *movdi_internal/3
+	mulsd	%xmm5, %xmm1	# 172	[c=20 l=4]  *fop_df_comm/1
+	testq	%rax, %rax	# 175	[c=4 l=3]  *cmpdi_ccno_1/0
+	js	.L52	# 176	[c=13 l=6]  *jcc
+	pxor	%xmm0, %xmm0	# 1369	[c=4 l=4]  movv2df_internal/0
+	cvtsi2sdq	%rax, %xmm0	# 1370	[c=4 l=5]  sse2_cvtsi2sdq/0
+.L53:
+	mulsd	%xmm4, %xmm0	# 188	[c=20 l=4]  *fop_df_comm/1
+	movq	952(%r15), %r9	# 190	[c=9 l=7]  *movdi_internal/3
+	movq	960(%r15), %rax	# 191	[c=9 l=7]  *movdi_internal/3
+	movq	%rdx, %r10	# 1039	[c=4 l=3]  *movdi_internal/3
+	subq	%r9, %rcx	# 192	[c=4 l=3]  *subdi_1/0
+	subq	%rax, %r10	# 193	[c=4 l=3]  *subdi_1/0
+	movq	%rcx, %r11	# 1038	[c=4 l=3]  *movdi_internal/3
+	addsd	%xmm0, %xmm1	# 189	[c=12 l=4]  *fop_df_comm/1
+	movsd	%xmm1, -312(%rbp)	# 1036	[c=4 l=8]  *movdf_internal/15
+	cmpq	%rax, %rdx	# 194	[c=4 l=3]  *cmpdi_1/0
+	jnb	.L54	# 195	[c=13 l=2]  *jcc
+	subq	$1, %r11	# 197	[c=4 l=4]  *adddi_1/0
+	addq	$1000000, %r10	# 198	[c=4 l=7]  *adddi_1/0
+.L54:
+	testq	%r11, %r11	# 203	[c=4 l=3]  *cmpdi_ccno_1/0
+	js	.L55	# 204	[c=13 l=6]  *jcc
+	pxor	%xmm3, %xmm3	# 1367	[c=4 l=4]  movv2df_internal/0
+	cvtsi2sdq	%r11, %xmm3	# 1368	[c=4 l=5]  sse2_cvtsi2sdq/0
+.L56:
+	mulsd	%xmm5, %xmm3	# 216	[c=20 l=4]  *fop_df_comm/1
+	testq	%r10, %r10	# 219	[c=4 l=3]  *cmpdi_ccno_1/0
+	js	.L57	# 220	[c=13 l=6]  *jcc
+	pxor	%xmm1, %xmm1	# 1365	[c=4 l=4]  movv2df_internal/0
+	cvtsi2sdq	%r10, %xmm1	# 1366	[c=4 l=5]  sse2_cvtsi2sdq/0
+.L58:
+	mulsd	%xmm4, %xmm1	# 232	[c=20 l=4]  *fop_df_comm/1
+	movq	944(%r15), %rdx	# 234	[c=9 l=7]  *movdi_internal/3
+	movq	%rax, %r8	# 1049	[c=4 l=3]  *movdi_internal/3
+	subq	936(%r15), %r9	# 235	[c=13 l=7]  *subdi_1/1
+	subq	%rdx, %r8	# 236	[c=4 l=3]  *subdi_1/0
+	addsd	%xmm1, %xmm3	# 233	[c=12 l=4]  *fop_df_comm/1
+	cmpq	%rdx, %rax	# 237	[c=4 l=3]  *cmpdi_1/0
+	jnb	.L59	# 238	[c=13 l=2]  *jcc
+	subq	$1, %r9	# 240	[c=4 l=4]  *adddi_1/0
+	addq	$1000000, %r8	# 241	[c=4 l=7]  *adddi_1/0
+.L59:
+	testq	%r9, %r9	# 246	[c=4 l=3]  *cmpdi_ccno_1/0
+	js	.L60	# 247	[c=13 l=6]  *jcc
+	pxor	%xmm0, %xmm0	# 1363	[c=4 l=4]  movv2df_internal/0
+	cvtsi2sdq	%r9, %xmm0	# 1364	[c=4 l=5]  sse2_cvtsi2sdq/0
+.L61:
+	mulsd	%xmm5, %xmm0	# 259	[c=20 l=4]  *fop_df_comm/1
+	testq	%r8, %r8	# 262	[c=4 l=3]  *cmpdi_ccno_1/0
+	js	.L62	# 263	[c=13 l=6]  *jcc
+	pxor	%xmm1, %xmm1	# 1361	[c=4 l=4]  movv2df_internal/0
+	cvtsi2sdq	%r8, %xmm1	# 1362	[c=4 l=5]  sse2_cvtsi2sdq/0
+.L63:
+	mulsd	%xmm4, %xmm1	# 275	[c=20 l=4]  *fop_df_comm/1
+	movl	16(%r15), %esi	# 277	[c=9 l=4]  *movsi_internal/0
+	addsd	%xmm1, %xmm0	# 276	[c=12 l=4]  *fop_df_comm/1
+	comisd	.LC9(%rip), %xmm0	# 279	[c=10 l=8]  *cmpidf/1
+	pxor	%xmm1, %xmm1	# 20	[c=4 l=4]  *movdf_internal/12
+	jbe	.L64	# 280	[c=13 l=2]  *jcc
+	movl	%esi, %eax	# 285	[c=1 l=2]  *zero_extendsidi2/3
+	pxor	%xmm1, %xmm1	# 1359	[c=4 l=4]  movv2df_internal/0
+	cvtsi2sdq	%rax, %xmm1	# 1360	[c=4 l=5]  sse2_cvtsi2sdq/0
+	divsd	%xmm0, %xmm1	# 300	[c=68 l=4]  *fop_df_1/2
+.L64:
+	movl	$1000, %ecx	# 304	[c=4 l=5]  *movdi_internal/2
+	xorl	%edx, %edx	# 1268	[c=4 l=2]  *movdi_xor
+	movq	%r8, %rax	# 1059	[c=4 l=3]  *movdi_internal/3
+	movq	904(%r15), %rdi	# 313	[c=9 l=7]  *movdi_internal/3
+	divq	%rcx	# 1204	[c=0 l=3]  *udivmoddi4_noext
+	movl	$60, %ecx	# 307	[c=4 l=5]  *movdi_internal/2
+	xorl	%edx, %edx	# 1269	[c=4 l=2]  *movdi_xor
+	movq	%rax, -328(%rbp)	# 1060	[c=4 l=7]  *movdi_internal/5
+	movq	%r9, %rax	# 1061	[c=4 l=3]  *movdi_internal/3
+	divq	%rcx	# 1206	[c=0 l=3]  *udivmoddi4_noext
+	comisd	.LC9(%rip), %xmm2	# 315	[c=10 l=8]  *cmpidf/1
+	movq	%rdx, %rcx	# 1063	[c=4 l=3]  *movdi_internal/3
+	jbe	.L117	# 316	[c=13 l=6]  *jcc
+	movsd	.LC10(%rip), %xmm6	# 321	[c=6 l=8]  *movdf_internal/14
+	movq	%r10, -352(%rbp)	# 1140	[c=4 l=7]  *movdi_internal/5
+	movq	%rax, %rdx	# 333	[c=4 l=3]  *movdi_internal/3
+	movl	$2, %eax	# 337	[c=4 l=5]  *movqi_internal/3
+	movq	%r11, -344(%rbp)	# 1138	[c=4 l=7]  *movdi_internal/5
+	mulsd	%xmm6, %xmm0	# 322	[c=20 l=4]  *fop_df_comm/1
+	movsd	%xmm3, -360(%rbp)	# 1142	[c=4 l=8]  *movdf_internal/15
+	movsd	%xmm2, -336(%rbp)	# 1135	[c=4 l=8]  *movdf_internal/15
+	movsd	%xmm6, -320(%rbp)	# 1137	[c=4 l=8]  *movdf_internal/15
+	pushq	%r10	# 1267	[c=4 l=2]  *pushdi2_rex64/0
+	pushq	%rsi	# 325	[c=4 l=1]  *pushsi2_rex64/0
+	divsd	%xmm2, %xmm0	# 323	[c=68 l=4]  *fop_df_1/2
+	pushq	%rsi	# 326	[c=4 l=1]  *pushsi2_rex64/0
+	leaq	.LC11(%rip), %rsi	# 334	[c=1 l=7]  *movdi_internal/4
+	pushq	-328(%rbp)	# 327	[c=9 l=6]  *pushdi2_rex64/0
+	call	fprintf@PLT	# 338	[c=10 l=5]  *call_value
+	movl	24(%r15), %eax	# 1066	[c=9 l=4]  *movsi_internal/0
+	movsd	-360(%rbp), %xmm3	# 1143	[c=9 l=8]  *movdf_internal/14
+	addq	$32, %rsp	# 342	[c=4 l=4]  *adddi_1/0
+	movsd	-336(%rbp), %xmm2	# 1136	[c=9 l=8]  *movdf_internal/14
+	movq	-344(%rbp), %r11	# 1139	[c=9 l=7]  *movdi_internal/3
+	leal	1(%rax), %r8d	# 1202	[c=4 l=4]  *leasi
+	subl	20(%r15), %r8d	# 341	[c=13 l=4]  *subsi_1/1
+	movq	-352(%rbp), %r10	# 1141	[c=9 l=7]  *movdi_internal/3
+	comisd	.LC9(%rip), %xmm3	# 344	[c=10 l=8]  *cmpidf/1
+	jbe	.L130	# 345	[c=13 l=6]  *jcc
+.L70:
+	movl	%r8d, %eax	# 379	[c=1 l=3]  *zero_extendsidi2/3
+	pxor	%xmm1, %xmm1	# 1357	[c=4 l=4]  movv2df_internal/0
+	cvtsi2sdq	%rax, %xmm1	# 1358	[c=4 l=5]  sse2_cvtsi2sdq/0
+	divsd	%xmm3, %xmm1	# 394	[c=68 l=4]  *fop_df_1/2
+.L72:
+	comisd	.LC9(%rip), %xmm2	# 399	[c=10 l=8]  *cmpidf/1
+	movq	904(%r15), %rdi	# 397	[c=9 l=7]  *movdi_internal/3
+	ja	.L71	# 400	[c=13 l=6]  *jcc
+	movl	$60, %ecx	# 460	[c=4 l=5]  *movdi_internal/2
+	movq	%r11, %rax	# 1082	[c=4 l=3]  *movdi_internal/3
+	xorl	%edx, %edx	# 1256	[c=4 l=2]  *movdi_xor
+	movq	%r11, %r9	# 474	[c=4 l=3]  *movdi_internal/3
+	divq	%rcx	# 1194	[c=0 l=3]  *udivmoddi4_noext
+	movsd	%xmm2, -328(%rbp)	# 1155	[c=4 l=8]  *movdf_internal/15
+	pxor	%xmm0, %xmm0	# 473	[c=4 l=4]  *movdf_internal/12
+	movq	%rax, %rsi	# 1083	[c=4 l=3]  *movdi_internal/3
+	movq	%rdx, %rcx	# 1084	[c=4 l=3]  *movdi_internal/3
+	xorl	%edx, %edx	# 1259	[c=4 l=2]  *movdi_xor
+	pushq	%rax	# 1258	[c=4 l=1]  *pushdi2_rex64/0
+	movq	%r10, %rax	# 1085	[c=4 l=3]  *movdi_internal/3
+	pushq	%r8	# 465	[c=4 l=2]  *pushsi2_rex64/0
+	pushq	%r8	# 466	[c=4 l=2]  *pushsi2_rex64/0
+	movl	$1000, %r8d	# 468	[c=4 l=6]  *movdi_internal/2
+	divq	%r8	# 1196	[c=0 l=3]  *udivmoddi4_noext
+	movq	%rsi, %rdx	# 477	[c=4 l=3]  *movdi_internal/3
+	movq	%r10, %r8	# 475	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC12(%rip), %rsi	# 478	[c=1 l=7]  *movdi_internal/4
+	pushq	%rax	# 470	[c=4 l=1]  *pushdi2_rex64/0
+	movl	$2, %eax	# 481	[c=4 l=5]  *movqi_internal/3
+	call	fprintf@PLT	# 482	[c=10 l=5]  *call_value
+	movsd	-312(%rbp), %xmm7	# 1087	[c=9 l=8]  *movdf_internal/14
+	addq	$32, %rsp	# 484	[c=4 l=4]  *adddi_1/0
+	comisd	.LC9(%rip), %xmm7	# 486	[c=10 l=8]  *cmpidf/1
+	movsd	-328(%rbp), %xmm2	# 1156	[c=9 l=8]  *movdf_internal/14
+	jbe	.L131	# 487	[c=13 l=6]  *jcc
+.L83:
+	movq	40(%r15), %rax	# 440	[c=9 l=4]  *movdi_internal/3
+	testq	%rax, %rax	# 443	[c=4 l=3]  *cmpdi_ccno_1/0
+	js	.L80	# 444	[c=13 l=6]  *jcc
+	pxor	%xmm1, %xmm1	# 1355	[c=4 l=4]  movv2df_internal/0
+	cvtsi2sdq	%rax, %xmm1	# 1356	[c=4 l=5]  sse2_cvtsi2sdq/0
+.L81:
+	divsd	-312(%rbp), %xmm1	# 455	[c=77 l=8]  *fop_df_1/2
+.L82:
+	comisd	.LC9(%rip), %xmm2	# 492	[c=10 l=8]  *cmpidf/1
+	movq	904(%r15), %rdi	# 490	[c=9 l=7]  *movdi_internal/3
+	ja	.L78	# 493	[c=13 l=6]  *jcc
+	movq	-296(%rbp), %rax	# 1098	[c=9 l=7]  *movdi_internal/3
+	movl	$60, %ecx	# 544	[c=4 l=5]  *movdi_internal/2
+	xorl	%edx, %edx	# 1244	[c=4 l=2]  *movdi_xor
+	pushq	%r8	# 1246	[c=4 l=2]  *pushdi2_rex64/0
+	movl	$1000, %r8d	# 550	[c=4 l=6]  *movdi_internal/2
+	movq	-296(%rbp), %r9	# 556	[c=9 l=7]  *movdi_internal/3
+	pxor	%xmm0, %xmm0	# 555	[c=4 l=4]  *movdf_internal/12
+	divq	%rcx	# 1186	[c=0 l=3]  *udivmoddi4_noext
+	movq	%rax, %rsi	# 1099	[c=4 l=3]  *movdi_internal/3
+	movq	-304(%rbp), %rax	# 1101	[c=9 l=7]  *movdi_internal/3
+	movq	%rdx, %rcx	# 1100	[c=4 l=3]  *movdi_internal/3
+	xorl	%edx, %edx	# 1247	[c=4 l=2]  *movdi_xor
+	divq	%r8	# 1188	[c=0 l=3]  *udivmoddi4_noext
+	movq	-304(%rbp), %r8	# 557	[c=9 l=7]  *movdi_internal/3
+	movq	%rsi, %rdx	# 559	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC13(%rip), %rsi	# 560	[c=1 l=7]  *movdi_internal/4
+	pushq	%rax	# 552	[c=4 l=1]  *pushdi2_rex64/0
+	movl	$2, %eax	# 563	[c=4 l=5]  *movqi_internal/3
+	call	fprintf@PLT	# 564	[c=10 l=5]  *call_value
+	popq	%r9	# 1248	[c=9 l=2]  *popdi1
+	pxor	%xmm1, %xmm1	# 25	[c=4 l=4]  *movdf_internal/12
+	popq	%r10	# 1249	[c=9 l=2]  *popdi1
+.L88:
+	movq	-280(%rbp), %rax	# 1103	[c=9 l=7]  *movdi_internal/3
+	movl	$60, %ecx	# 569	[c=4 l=5]  *movdi_internal/2
+	xorl	%edx, %edx	# 1238	[c=4 l=2]  *movdi_xor
+	movl	$1000, %r8d	# 576	[c=4 l=6]  *movdi_internal/2
+	movq	904(%r15), %rdi	# 573	[c=9 l=7]  *movdi_internal/3
+	divq	%rcx	# 1182	[c=0 l=3]  *udivmoddi4_noext
+	movq	%rax, %rsi	# 1104	[c=4 l=3]  *movdi_internal/3
+	pushq	%rax	# 1240	[c=4 l=1]  *pushdi2_rex64/0
+	movq	-288(%rbp), %rax	# 1106	[c=9 l=7]  *movdi_internal/3
+	movq	%rdx, %rcx	# 1105	[c=4 l=3]  *movdi_internal/3
+	xorl	%edx, %edx	# 1241	[c=4 l=2]  *movdi_xor
+	movsd	-320(%rbp), %xmm0	# 580	[c=9 l=8]  *movdf_internal/14
+	movq	-280(%rbp), %r9	# 581	[c=9 l=7]  *movdi_internal/3
+	divq	%r8	# 1184	[c=0 l=3]  *udivmoddi4_noext
+	movq	-288(%rbp), %r8	# 582	[c=9 l=7]  *movdi_internal/3
+	movq	%rsi, %rdx	# 584	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC14(%rip), %rsi	# 585	[c=1 l=7]  *movdi_internal/4
+	pushq	%rax	# 578	[c=4 l=1]  *pushdi2_rex64/0
+	movl	$2, %eax	# 588	[c=4 l=5]  *movqi_internal/3
+	call	fprintf@PLT	# 589	[c=10 l=5]  *call_value
+	cmpl	$0, 216(%r15)	# 591	[c=13 l=8]  *cmpsi_ccno_1/1
+	popq	%rdx	# 1242	[c=9 l=1]  *popdi1
+	popq	%rcx	# 1243	[c=9 l=1]  *popdi1
+	je	.L41	# 592	[c=13 l=6]  *jcc
+	jmp	.L122	# 1288	[c=1 l=2]  jump
+.L124:
+	movl	(%r15), %edx	# 46	[c=6 l=3]  *zero_extendsidi2/3
+	salq	$4, %rdx	# 47	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r15), %rdx	# 49	[c=13 l=7]  *adddi_1/1
+	movzbl	11(%rdx), %ecx	# 50	[c=13 l=4]  zero_extendqidi2/0
+	subq	%rcx, %rax	# 51	[c=4 l=3]  *subdi_1/0
+	movq	%rax, 40(%r15)	# 52	[c=4 l=4]  *movdi_internal/5
+	movzwl	14(%rdx), %eax	# 53	[c=13 l=4]  zero_extendhidi2/0
+	subq	%rax, 48(%r15)	# 54	[c=13 l=4]  *subdi_1/0
+	jmp	.L38	# 1290	[c=1 l=5]  jump
+.L43:
+	cmpl	$0, 216(%r15)	# 765	[c=13 l=8]  *cmpsi_ccno_1/1
+	je	.L132	# 766	[c=13 l=6]  *jcc
+.L122:
+	movq	904(%r15), %rdi	# 758	[c=9 l=7]  *movdi_internal/3
+	call	fflush@PLT	# 760	[c=10 l=5]  *call_value
+.L89:
+	testl	%ebx, %ebx	# 701	[c=4 l=2]  *cmpsi_ccno_1/0
+	jne	.L95	# 702	[c=13 l=2]  *jcc
+	movl	76(%r15), %esi	# 704	[c=9 l=4]  *movsi_internal/0
+.L96:
+	movq	%r15, %rdi	# 718	[c=4 l=3]  *movdi_internal/3
+	call	finish	# 719	[c=0 l=5]  *call
+.L127:
+	leaq	.LC5(%rip), %rdx	# 27	[c=1 l=7]  *movdi_internal/4
+	jmp	.L91	# 1293	[c=1 l=5]  jump
+.L129:
+	movq	904(%r15), %rdi	# 673	[c=9 l=7]  *movdi_internal/3
+	leaq	.LC19(%rip), %rsi	# 675	[c=1 l=7]  *movdi_internal/4
+	xorl	%eax, %eax	# 1233	[c=4 l=2]  *movdi_xor
+	call	fprintf@PLT	# 679	[c=10 l=5]  *call_value
+	jmp	.L94	# 1295	[c=1 l=5]  jump
+.L128:
+	movq	904(%r15), %rdi	# 649	[c=9 l=7]  *movdi_internal/3
+	leaq	.LC17(%rip), %rsi	# 651	[c=1 l=7]  *movdi_internal/4
+	xorl	%eax, %eax	# 1235	[c=4 l=2]  *movdi_xor
+	call	fprintf@PLT	# 655	[c=10 l=5]  *call_value
+	jmp	.L93	# 1297	[c=1 l=5]  jump
+.L95:
+	imulq	$24, -264(%rbp), %rax	# 711	[c=25 l=8]  *muldi3_1/0
+	movl	20(%r14,%rax), %esi	# 714	[c=10 l=5]  *movsi_internal/0
+	jmp	.L96	# 1299	[c=1 l=2]  jump
+.L125:
+	movq	904(%r15), %rdi	# 723	[c=9 l=7]  *movdi_internal/3
+	call	fflush@PLT	# 725	[c=10 l=5]  *call_value
+	leaq	16(%rbp), %rax	# 1117	[c=4 l=4]  *leadi
+	movq	912(%r15), %r13	# 726	[c=9 l=7]  *movdi_internal/3
+	movl	$24, -256(%rbp)	# 728	[c=4 l=10]  *movsi_internal/1
+	movq	%rax, -248(%rbp)	# 730	[c=4 l=7]  *movdi_internal/5
+	leaq	-224(%rbp), %rax	# 1118	[c=4 l=7]  *leadi
+	movq	144(%r15), %rdx	# 737	[c=9 l=7]  *movdi_internal/3
+	leaq	.LC21(%rip), %rsi	# 740	[c=1 l=7]  *movdi_internal/4
+	movq	%rax, -240(%rbp)	# 731	[c=4 l=7]  *movdi_internal/5
+	imulq	$24, -264(%rbp), %rax	# 734	[c=25 l=8]  *muldi3_1/0
+	movq	%r13, %rdi	# 742	[c=4 l=3]  *movdi_internal/3
+	movl	$48, -252(%rbp)	# 729	[c=4 l=10]  *movsi_internal/1
+	movq	8(%r14,%rax), %rcx	# 738	[c=10 l=5]  *movdi_internal/3
+	xorl	%eax, %eax	# 1231	[c=4 l=2]  *movdi_xor
+	call	fprintf@PLT	# 744	[c=10 l=5]  *call_value
+	movq	-272(%rbp), %rdx	# 746	[c=9 l=7]  *movdi_internal/3
+	movq	%r12, %rsi	# 747	[c=4 l=3]  *movdi_internal/3
+	movq	%r13, %rdi	# 748	[c=4 l=3]  *movdi_internal/3
+	call	vfprintf@PLT	# 749	[c=10 l=5]  *call_value
+	movq	%r13, %rsi	# 750	[c=4 l=3]  *movdi_internal/3
+	movl	$10, %edi	# 751	[c=4 l=5]  *movsi_internal/0
+	call	fputc@PLT	# 752	[c=10 l=5]  *call_value
+	movq	%r13, %rdi	# 753	[c=4 l=3]  *movdi_internal/3
+	call	fflush@PLT	# 754	[c=10 l=5]  *call_value
+	jmp	.L89	# 1301	[c=1 l=5]  jump
+.L130:
+	movq	904(%r15), %rdi	# 876	[c=9 l=7]  *movdi_internal/3
+	pxor	%xmm1, %xmm1	# 22	[c=4 l=4]  *movdf_internal/12
+.L71:
+	movl	$60, %ecx	# 409	[c=4 l=5]  *movdi_internal/2
+	movq	%r11, %rax	# 1073	[c=4 l=3]  *movdi_internal/3
+	xorl	%edx, %edx	# 1260	[c=4 l=2]  *movdi_xor
+	movq	%r11, %r9	# 423	[c=4 l=3]  *movdi_internal/3
+	divq	%rcx	# 1198	[c=0 l=3]  *udivmoddi4_noext
+	movsd	%xmm2, -328(%rbp)	# 1153	[c=4 l=8]  *movdf_internal/15
+	mulsd	-320(%rbp), %xmm3	# 407	[c=29 l=8]  *fop_df_comm/1
+	divsd	%xmm2, %xmm3	# 408	[c=68 l=4]  *fop_df_1/2
+	movq	%rax, %rsi	# 1074	[c=4 l=3]  *movdi_internal/3
+	movq	%rdx, %rcx	# 1075	[c=4 l=3]  *movdi_internal/3
+	xorl	%edx, %edx	# 1263	[c=4 l=2]  *movdi_xor
+	pushq	%rax	# 1262	[c=4 l=1]  *pushdi2_rex64/0
+	movq	%r10, %rax	# 1076	[c=4 l=3]  *movdi_internal/3
+	pushq	%r8	# 415	[c=4 l=2]  *pushsi2_rex64/0
+	pushq	%r8	# 416	[c=4 l=2]  *pushsi2_rex64/0
+	movl	$1000, %r8d	# 418	[c=4 l=6]  *movdi_internal/2
+	divq	%r8	# 1200	[c=0 l=3]  *udivmoddi4_noext
+	movq	%rsi, %rdx	# 426	[c=4 l=3]  *movdi_internal/3
+	movq	%r10, %r8	# 424	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC12(%rip), %rsi	# 427	[c=1 l=7]  *movdi_internal/4
+	movapd	%xmm3, %xmm0	# 1072	[c=4 l=4]  *movdf_internal/13
+	pushq	%rax	# 420	[c=4 l=1]  *pushdi2_rex64/0
+	movl	$2, %eax	# 430	[c=4 l=5]  *movqi_internal/3
+	call	fprintf@PLT	# 431	[c=10 l=5]  *call_value
+	movsd	-312(%rbp), %xmm7	# 1078	[c=9 l=8]  *movdf_internal/14
+	addq	$32, %rsp	# 432	[c=4 l=4]  *adddi_1/0
+	comisd	.LC9(%rip), %xmm7	# 434	[c=10 l=8]  *cmpidf/1
+	movsd	-328(%rbp), %xmm2	# 1154	[c=9 l=8]  *movdf_internal/14
+	ja	.L83	# 435	[c=13 l=6]  *jcc
+	movq	904(%r15), %rdi	# 879	[c=9 l=7]  *movdi_internal/3
+	pxor	%xmm1, %xmm1	# 24	[c=4 l=4]  *movdf_internal/12
+.L78:
+	movq	-296(%rbp), %rax	# 1091	[c=9 l=7]  *movdi_internal/3
+	movl	$60, %ecx	# 502	[c=4 l=5]  *movdi_internal/2
+	xorl	%edx, %edx	# 1252	[c=4 l=2]  *movdi_xor
+	movsd	-312(%rbp), %xmm0	# 1088	[c=9 l=8]  *movdf_internal/14
+	mulsd	-320(%rbp), %xmm0	# 500	[c=29 l=8]  *fop_df_comm/1
+	movsd	%xmm2, -312(%rbp)	# 1159	[c=4 l=8]  *movdf_internal/15
+	movl	$1000, %r8d	# 509	[c=4 l=6]  *movdi_internal/2
+	divq	%rcx	# 1190	[c=0 l=3]  *udivmoddi4_noext
+	divsd	%xmm2, %xmm0	# 501	[c=68 l=4]  *fop_df_1/2
+	movq	%rax, %rsi	# 1092	[c=4 l=3]  *movdi_internal/3
+	pushq	%rax	# 1254	[c=4 l=1]  *pushdi2_rex64/0
+	movq	-304(%rbp), %rax	# 1094	[c=9 l=7]  *movdi_internal/3
+	movq	%rdx, %rcx	# 1093	[c=4 l=3]  *movdi_internal/3
+	xorl	%edx, %edx	# 1255	[c=4 l=2]  *movdi_xor
+	movq	-296(%rbp), %r9	# 514	[c=9 l=7]  *movdi_internal/3
+	divq	%r8	# 1192	[c=0 l=3]  *udivmoddi4_noext
+	movq	-304(%rbp), %r8	# 515	[c=9 l=7]  *movdi_internal/3
+	movq	%rsi, %rdx	# 517	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC13(%rip), %rsi	# 518	[c=1 l=7]  *movdi_internal/4
+	pushq	%rax	# 511	[c=4 l=1]  *pushdi2_rex64/0
+	movl	$2, %eax	# 521	[c=4 l=5]  *movqi_internal/3
+	call	fprintf@PLT	# 522	[c=10 l=5]  *call_value
+	movq	40(%r15), %rax	# 523	[c=9 l=4]  *movdi_internal/3
+	movsd	-312(%rbp), %xmm2	# 1160	[c=9 l=8]  *movdf_internal/14
+	testq	%rax, %rax	# 526	[c=4 l=3]  *cmpdi_ccno_1/0
+	js	.L86	# 527	[c=13 l=6]  *jcc
+	pxor	%xmm1, %xmm1	# 1353	[c=4 l=4]  movv2df_internal/0
+	cvtsi2sdq	%rax, %xmm1	# 1354	[c=4 l=5]  sse2_cvtsi2sdq/0
+.L87:
+	divsd	%xmm2, %xmm1	# 538	[c=68 l=4]  *fop_df_1/2
+	popq	%r11	# 1250	[c=9 l=2]  *popdi1
+	popq	%rax	# 1251	[c=9 l=1]  *popdi1
+	jmp	.L88	# 1303	[c=1 l=5]  jump
+.L117:
+	movq	%r10, -344(%rbp)	# 1149	[c=4 l=7]  *movdi_internal/5
+	pxor	%xmm0, %xmm0	# 357	[c=4 l=4]  *movdf_internal/12
+	movq	%r11, -336(%rbp)	# 1147	[c=4 l=7]  *movdi_internal/5
+	movsd	%xmm3, -352(%rbp)	# 1151	[c=4 l=8]  *movdf_internal/15
+	movsd	%xmm2, -320(%rbp)	# 1145	[c=4 l=8]  *movdf_internal/15
+	pushq	%rdx	# 1265	[c=4 l=1]  *pushdi2_rex64/0
+	movq	%rax, %rdx	# 361	[c=4 l=3]  *movdi_internal/3
+	movl	$2, %eax	# 365	[c=4 l=5]  *movqi_internal/3
+	pushq	%rsi	# 352	[c=4 l=1]  *pushsi2_rex64/0
+	pushq	%rsi	# 353	[c=4 l=1]  *pushsi2_rex64/0
+	leaq	.LC11(%rip), %rsi	# 362	[c=1 l=7]  *movdi_internal/4
+	pushq	-328(%rbp)	# 354	[c=9 l=6]  *pushdi2_rex64/0
+	call	fprintf@PLT	# 366	[c=10 l=5]  *call_value
+	movl	24(%r15), %eax	# 1067	[c=9 l=4]  *movsi_internal/0
+	movsd	-352(%rbp), %xmm3	# 1152	[c=9 l=8]  *movdf_internal/14
+	addq	$32, %rsp	# 370	[c=4 l=4]  *adddi_1/0
+	movsd	-320(%rbp), %xmm2	# 1146	[c=9 l=8]  *movdf_internal/14
+	movq	-336(%rbp), %r11	# 1148	[c=9 l=7]  *movdi_internal/3
+	leal	1(%rax), %r8d	# 1201	[c=4 l=4]  *leasi
+	subl	20(%r15), %r8d	# 369	[c=13 l=4]  *subsi_1/1
+	movq	-344(%rbp), %r10	# 1150	[c=9 l=7]  *movdi_internal/3
+	comisd	.LC9(%rip), %xmm3	# 372	[c=10 l=8]  *cmpidf/1
+	jbe	.L118	# 373	[c=13 l=6]  *jcc
+	movsd	.LC10(%rip), %xmm7	# 877	[c=6 l=8]  *movdf_internal/14
+	movsd	%xmm7, -320(%rbp)	# 1068	[c=4 l=8]  *movdf_internal/15
+	jmp	.L70	# 1305	[c=1 l=5]  jump
+.L50:
+	movq	-296(%rbp), %rsi	# 1132	[c=9 l=7]  *movdi_internal/3
+	pxor	%xmm1, %xmm1	# 1351	[c=4 l=4]  movv2df_internal/0
+	movq	%rsi, %rax	# 1026	[c=4 l=3]  *movdi_internal/3
+	andl	$1, %esi	# 166	[c=4 l=3]  *anddi_1/0
+	shrq	%rax	# 165	[c=4 l=3]  *lshrdi3_1/0
+	orq	%rsi, %rax	# 167	[c=4 l=3]  *iordi_1/0
+	cvtsi2sdq	%rax, %xmm1	# 1352	[c=4 l=5]  sse2_cvtsi2sdq/0
+	addsd	%xmm1, %xmm1	# 169	[c=12 l=4]  *fop_df_comm/1
+	jmp	.L51	# 1307	[c=1 l=5]  jump
+.L47:
+	movq	-288(%rbp), %rcx	# 1128	[c=9 l=7]  *movdi_internal/3
+	pxor	%xmm0, %xmm0	# 1349	[c=4 l=4]  movv2df_internal/0
+	movq	%rcx, %rdx	# 1013	[c=4 l=3]  *movdi_internal/3
+	andl	$1, %ecx	# 138	[c=4 l=3]  *anddi_1/0
+	shrq	%rdx	# 137	[c=4 l=3]  *lshrdi3_1/0
+	orq	%rcx, %rdx	# 139	[c=4 l=3]  *iordi_1/0
+	cvtsi2sdq	%rdx, %xmm0	# 1350	[c=4 l=5]  sse2_cvtsi2sdq/0
+	addsd	%xmm0, %xmm0	# 141	[c=12 l=4]  *fop_df_comm/1
+	jmp	.L48	# 1309	[c=1 l=5]  jump
+.L45:
+	movq	-280(%rbp), %rcx	# 1126	[c=9 l=7]  *movdi_internal/3
+	pxor	%xmm2, %xmm2	# 1347	[c=4 l=4]  movv2df_internal/0
+	movq	%rcx, %rdx	# 1008	[c=4 l=3]  *movdi_internal/3
+	andl	$1, %ecx	# 122	[c=4 l=3]  *anddi_1/0
+	shrq	%rdx	# 121	[c=4 l=3]  *lshrdi3_1/0
+	orq	%rcx, %rdx	# 123	[c=4 l=3]  *iordi_1/0
+	cvtsi2sdq	%rdx, %xmm2	# 1348	[c=4 l=5]  sse2_cvtsi2sdq/0
+	addsd	%xmm2, %xmm2	# 125	[c=12 l=4]  *fop_df_comm/1
+	jmp	.L46	# 1311	[c=1 l=5]  jump
+.L62:
+	movq	%r8, %rax	# 1055	[c=4 l=3]  *movdi_internal/3
+	movq	%r8, %rdx	# 1057	[c=4 l=3]  *movdi_internal/3
+	pxor	%xmm1, %xmm1	# 1345	[c=4 l=4]  movv2df_internal/0
+	shrq	%rax	# 268	[c=4 l=3]  *lshrdi3_1/0
+	andl	$1, %edx	# 269	[c=4 l=3]  *anddi_1/0
+	orq	%rdx, %rax	# 270	[c=4 l=3]  *iordi_1/0
+	cvtsi2sdq	%rax, %xmm1	# 1346	[c=4 l=5]  sse2_cvtsi2sdq/0
+	addsd	%xmm1, %xmm1	# 272	[c=12 l=4]  *fop_df_comm/1
+	jmp	.L63	# 1313	[c=1 l=5]  jump
+.L60:
+	movq	%r9, %rax	# 1051	[c=4 l=3]  *movdi_internal/3
+	movq	%r9, %rdx	# 1053	[c=4 l=3]  *movdi_internal/3
+	pxor	%xmm0, %xmm0	# 1343	[c=4 l=4]  movv2df_internal/0
+	shrq	%rax	# 252	[c=4 l=3]  *lshrdi3_1/0
+	andl	$1, %edx	# 253	[c=4 l=3]  *anddi_1/0
+	orq	%rdx, %rax	# 254	[c=4 l=3]  *iordi_1/0
+	cvtsi2sdq	%rax, %xmm0	# 1344	[c=4 l=5]  sse2_cvtsi2sdq/0
+	addsd	%xmm0, %xmm0	# 256	[c=12 l=4]  *fop_df_comm/1
+	jmp	.L61	# 1315	[c=1 l=5]  jump
+.L57:
+	movq	%r10, %rdx	# 1045	[c=4 l=3]  *movdi_internal/3
+	movq	%r10, %rcx	# 1047	[c=4 l=3]  *movdi_internal/3
+	pxor	%xmm1, %xmm1	# 1341	[c=4 l=4]  movv2df_internal/0
+	shrq	%rdx	# 225	[c=4 l=3]  *lshrdi3_1/0
+	andl	$1, %ecx	# 226	[c=4 l=3]  *anddi_1/0
+	orq	%rcx, %rdx	# 227	[c=4 l=3]  *iordi_1/0
+	cvtsi2sdq	%rdx, %xmm1	# 1342	[c=4 l=5]  sse2_cvtsi2sdq/0
+	addsd	%xmm1, %xmm1	# 229	[c=12 l=4]  *fop_df_comm/1
+	jmp	.L58	# 1317	[c=1 l=5]  jump
+.L55:
+	movq	%r11, %rdx	# 1041	[c=4 l=3]  *movdi_internal/3
+	movq	%r11, %rcx	# 1043	[c=4 l=3]  *movdi_internal/3
+	pxor	%xmm3, %xmm3	# 1339	[c=4 l=4]  movv2df_internal/0
+	shrq	%rdx	# 209	[c=4 l=3]  *lshrdi3_1/0
+	andl	$1, %ecx	# 210	[c=4 l=3]  *anddi_1/0
+	orq	%rcx, %rdx	# 211	[c=4 l=3]  *iordi_1/0
+	cvtsi2sdq	%rdx, %xmm3	# 1340	[c=4 l=5]  sse2_cvtsi2sdq/0
+	addsd	%xmm3, %xmm3	# 213	[c=12 l=4]  *fop_df_comm/1
+	jmp	.L56	# 1319	[c=1 l=5]  jump
+.L52:
+	movq	-304(%rbp), %rsi	# 1134	[c=9 l=7]  *movdi_internal/3
+	pxor	%xmm0, %xmm0	# 1337	[c=4 l=4]  movv2df_internal/0
+	movq	%rsi, %rax	# 1031	[c=4 l=3]  *movdi_internal/3
+	andl	$1, %esi	# 182	[c=4 l=3]  *anddi_1/0
+	shrq	%rax	# 181	[c=4 l=3]  *lshrdi3_1/0
+	orq	%rsi, %rax	# 183	[c=4 l=3]  *iordi_1/0
+	cvtsi2sdq	%rax, %xmm0	# 1338	[c=4 l=5]  sse2_cvtsi2sdq/0
+	addsd	%xmm0, %xmm0	# 185	[c=12 l=4]  *fop_df_comm/1
+	jmp	.L53	# 1321	[c=1 l=5]  jump
+.L131:
+	pxor	%xmm1, %xmm1	# 23	[c=4 l=4]  *movdf_internal/12
+	jmp	.L82	# 1323	[c=1 l=5]  jump
+.L118:
+	movsd	.LC10(%rip), %xmm6	# 878	[c=6 l=8]  *movdf_internal/14
+	pxor	%xmm1, %xmm1	# 21	[c=4 l=4]  *movdf_internal/12
+	movsd	%xmm6, -320(%rbp)	# 1069	[c=4 l=8]  *movdf_internal/15
+	jmp	.L72	# 1325	[c=1 l=5]  jump
+.L80:
+	movq	%rax, %rdx	# 1079	[c=4 l=3]  *movdi_internal/3
+	andl	$1, %eax	# 450	[c=4 l=3]  *anddi_1/0
+	pxor	%xmm1, %xmm1	# 1335	[c=4 l=4]  movv2df_internal/0
+	shrq	%rdx	# 449	[c=4 l=3]  *lshrdi3_1/0
+	orq	%rax, %rdx	# 451	[c=4 l=3]  *iordi_1/0
+	cvtsi2sdq	%rdx, %xmm1	# 1336	[c=4 l=5]  sse2_cvtsi2sdq/0
+	addsd	%xmm1, %xmm1	# 453	[c=12 l=4]  *fop_df_comm/1
+	jmp	.L81	# 1327	[c=1 l=5]  jump
+.L86:
+	movq	%rax, %rdx	# 1096	[c=4 l=3]  *movdi_internal/3
+	andl	$1, %eax	# 533	[c=4 l=3]  *anddi_1/0
+	pxor	%xmm1, %xmm1	# 1333	[c=4 l=4]  movv2df_internal/0
+	shrq	%rdx	# 532	[c=4 l=3]  *lshrdi3_1/0
+	orq	%rax, %rdx	# 534	[c=4 l=3]  *iordi_1/0
+	cvtsi2sdq	%rdx, %xmm1	# 1334	[c=4 l=5]  sse2_cvtsi2sdq/0
+	addsd	%xmm1, %xmm1	# 536	[c=12 l=4]  *fop_df_comm/1
+	jmp	.L87	# 1329	[c=1 l=5]  jump
+.L132:
+	leaq	-256(%rbp), %rax	# 880	[c=4 l=7]  *leadi
+	movq	%rax, -272(%rbp)	# 1120	[c=4 l=7]  *movdi_internal/5
+	jmp	.L41	# 1331	[c=1 l=5]  jump
+	.cfi_endproc
+.LFE21:
+	.size	leave, .-leave
+	.section	.rodata.str1.8
+	.align 8
+.LC22:
+	.string	"program counter 0x%x out of bounds (0x%x--0x%x)"
+	.text
+	.p2align 4
+	.type	bad_PC, @function
+bad_PC:
+.LFB67:
+	.cfi_startproc
+	subq	$8, %rsp	# 27	[c=4 l=4]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_def_cfa_offset 16
+	movl	24(%rdi), %eax	# 7	[c=9 l=3]  *movsi_internal/0
+	movl	20(%rdi), %r8d	# 12	[c=9 l=4]  *movsi_internal/0
+	leal	(%rsi,%rsi), %ecx	# 26	[c=12 l=3]  *leasi
+	leaq	.LC22(%rip), %rdx	# 14	[c=1 l=7]  *movdi_internal/4
+	movl	$1, %esi	# 16	[c=4 l=5]  *movsi_internal/0
+	leal	-1(%rax), %r9d	# 11	[c=4 l=4]  *leasi
+	xorl	%eax, %eax	# 34	[c=4 l=2]  *movdi_xor
+	call	leave	# 19	[c=0 l=5]  *call
+	.cfi_endproc
+.LFE67:
+	.size	bad_PC, .-bad_PC
+	.section	.rodata.str1.8
+	.align 8
+.LC23:
+	.string	"access to unmapped RAM address 0x%x (RAMEND = 0x%04x)"
+	.text
+	.p2align 4
+	.type	bad_address, @function
+bad_address:
+.LFB22:
+	.cfi_startproc
+	subq	$8, %rsp	# 22	[c=4 l=4]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_def_cfa_offset 16
+	movl	1000(%rdi), %r8d	# 8	[c=9 l=7]  *movsi_internal/0
+	movl	%esi, %ecx	# 3	[c=4 l=2]  *movsi_internal/0
+	xorl	%eax, %eax	# 29	[c=4 l=2]  *movdi_xor
+	leaq	.LC23(%rip), %rdx	# 10	[c=1 l=7]  *movdi_internal/4
+	movl	$1, %esi	# 12	[c=4 l=5]  *movsi_internal/0
+	call	leave	# 15	[c=0 l=5]  *call
+	.cfi_endproc
+.LFE22:
+	.size	bad_address, .-bad_address
+	.p2align 4
+	.type	data_read_mapped, @function
+data_read_mapped:
+.LFB27:
+	.cfi_startproc
+	movl	%esi, %eax	# 87	[c=4 l=2]  *movsi_internal/0
+	subl	5176(%rdi), %eax	# 8	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rdi), %eax	# 9	[c=13 l=6]  *cmpsi_1/1
+	jb	.L138	# 10	[c=13 l=2]  *jcc
+	movl	%esi, %eax	# 89	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %eax	# 12	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 85	[c=5 l=5]  *andsi_1_zext
+	movzbl	1080(%rdi,%rax), %eax	# 15	[c=10 l=8]  *movqi_internal/4
+	cmpb	$3, %al	# 16	[c=4 l=2]  *cmpqi_1/0
+	je	.L139	# 17	[c=13 l=2]  *jcc
+	cmpb	$4, %al	# 19	[c=4 l=2]  *cmpqi_1/0
+	je	.L140	# 20	[c=13 l=2]  *jcc
+	cmpb	$2, %al	# 22	[c=4 l=2]  *cmpqi_1/0
+	je	.L146	# 23	[c=13 l=2]  *jcc
+.L138:
+	subq	$8, %rsp	# 93	[c=4 l=4]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_def_cfa_offset 16
+	call	bad_address	# 61	[c=0 l=5]  *call
+	.p2align 4,,10
+	.p2align 3
+.L146:
+	.cfi_def_cfa_offset 8
+	movl	992(%rdi), %eax	# 25	[c=9 l=6]  *movsi_internal/0
+	subl	$16384, %esi	# 28	[c=4 l=6]  *addsi_1/0
+	movq	1056(%rdi), %rdx	# 31	[c=9 l=7]  *movdi_internal/3
+	leal	1(%rax,%rax), %eax	# 27	[c=8 l=4]  *leasi
+	andl	%esi, %eax	# 29	[c=4 l=2]  *andsi_1/0
+	cltq	# 30	[c=4 l=2]  *extendsidi2_rex64/0
+	movzbl	(%rdx,%rax), %eax	# 32	[c=13 l=4]  *zero_extendqisi2/0
+	ret		# 77	[c=0 l=1]  simple_return_internal
+	.p2align 4,,10
+	.p2align 3
+.L140:
+	movl	%esi, %eax	# 91	[c=4 l=2]  *movsi_internal/0
+	movq	1072(%rdi), %rdx	# 47	[c=9 l=7]  *movdi_internal/3
+	sarl	$12, %eax	# 44	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 84	[c=5 l=5]  *andsi_1_zext
+	movq	(%rdx,%rax,8), %rdx	# 48	[c=10 l=4]  *movdi_internal/3
+	xorl	%eax, %eax	# 109	[c=4 l=2]  *movdi_xor
+	testq	%rdx, %rdx	# 49	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L137	# 50	[c=13 l=2]  *jcc
+	andl	$4095, %esi	# 83	[c=5 l=6]  *andsi_1_zext
+	movzbl	(%rdx,%rsi), %eax	# 54	[c=13 l=4]  *zero_extendqisi2/0
+	ret		# 81	[c=0 l=1]  simple_return_internal
+	.p2align 4,,10
+	.p2align 3
+.L139:
+	movq	1048(%rdi), %rax	# 38	[c=9 l=7]  *movdi_internal/3
+	movslq	%esi, %rsi	# 37	[c=4 l=3]  *extendsidi2_rex64/1
+	movzbl	-4096(%rax,%rsi), %eax	# 39	[c=14 l=8]  *zero_extendqisi2/0
+	ret		# 79	[c=0 l=1]  simple_return_internal
+	.p2align 4,,10
+	.p2align 3
+.L137:
+	ret		# 100	[c=0 l=1]  simple_return_internal
+	.cfi_endproc
+.LFE27:
+	.size	data_read_mapped, .-data_read_mapped
+	.section	.rodata.str1.1
+.LC24:
+	.string	"{F:%04x} "
+	.text
+	.p2align 4
+	.type	data_read_page, @function
+data_read_page:
+.LFB37:
+	.cfi_startproc
+	pushq	%rbx	# 107	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	movslq	%esi, %rbx	# 3	[c=4 l=3]  *extendsidi2_rex64/1
+	movl	%ebx, %eax	# 100	[c=4 l=2]  *movsi_internal/0
+	subq	$16, %rsp	# 108	[c=4 l=4]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_def_cfa_offset 32
+	subl	5176(%rdi), %eax	# 8	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rdi), %eax	# 9	[c=13 l=6]  *cmpsi_1/1
+	jb	.L148	# 10	[c=13 l=2]  *jcc
+	movl	%ebx, %eax	# 102	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %eax	# 12	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 98	[c=5 l=5]  *andsi_1_zext
+	movzbl	1080(%rdi,%rax), %eax	# 15	[c=10 l=8]  *movqi_internal/4
+	cmpb	$1, %al	# 16	[c=4 l=2]  *cmpqi_1/0
+	je	.L149	# 17	[c=13 l=2]  *jcc
+	cmpb	$2, %al	# 19	[c=4 l=2]  *cmpqi_1/0
+	je	.L150	# 20	[c=13 l=2]  *jcc
+.L148:
+	addq	$16, %rsp	# 117	[c=4 l=4]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_remember_state
+	.cfi_def_cfa_offset 16
+	movl	%ebx, %esi	# 73	[c=4 l=2]  *movsi_internal/0
+	popq	%rbx	# 118	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 8
+	jmp	data_read_mapped	# 75	[c=10 l=5]  *sibcall_value
+	.p2align 4,,10
+	.p2align 3
+.L150:
+	.cfi_restore_state
+	leal	-16384(%rbx), %edx	# 106	[c=4 l=6]  *leasi
+	leaq	.LC24(%rip), %rsi	# 65	[c=1 l=7]  *movdi_internal/4
+	xorl	%eax, %eax	# 123	[c=4 l=2]  *movdi_xor
+	movq	%rdi, 8(%rsp)	# 104	[c=4 l=5]  *movdi_internal/5
+	call	log_append@PLT	# 69	[c=0 l=5]  *call
+	movq	8(%rsp), %rdi	# 105	[c=9 l=5]  *movdi_internal/3
+	movl	%ebx, %esi	# 125	[c=4 l=2]  *movsi_internal/0
+	addq	$1, 48(%rdi)	# 70	[c=13 l=5]  *adddi_1/0
+	addq	$16, %rsp	# 127	[c=4 l=4]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_remember_state
+	.cfi_def_cfa_offset 16
+	popq	%rbx	# 128	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 8
+	jmp	data_read_mapped	# 129	[c=10 l=5]  *sibcall_value
+	.p2align 4,,10
+	.p2align 3
+.L149:
+	.cfi_restore_state
+	cmpl	6564(%rdi), %ebx	# 26	[c=13 l=6]  *cmpsi_1/1
+	jnb	.L151	# 27	[c=13 l=2]  *jcc
+	movslq	%ebx, %rax	# 29	[c=4 l=3]  *extendsidi2_rex64/1
+	cmpb	$0, 6568(%rdi,%rax)	# 30	[c=14 l=8]  *cmpqi_ccno_1/1
+	je	.L151	# 31	[c=13 l=2]  *jcc
+	movq	48(%rdi), %rdx	# 41	[c=9 l=4]  *movdi_internal/3
+	addq	$16, %rsp	# 120	[c=4 l=4]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_remember_state
+	.cfi_def_cfa_offset 16
+	movl	%ebx, %esi	# 43	[c=4 l=2]  *movsi_internal/0
+	popq	%rbx	# 121	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 8
+	jmp	periph_read@PLT	# 45	[c=10 l=5]  *sibcall_value
+	.p2align 4,,10
+	.p2align 3
+.L151:
+	.cfi_restore_state
+	cmpl	%ebx, 1000(%rdi)	# 34	[c=13 l=6]  *cmpsi_1/0
+	jb	.L159	# 35	[c=13 l=2]  *jcc
+	movq	1040(%rdi), %rax	# 57	[c=9 l=7]  *movdi_internal/3
+	movzbl	(%rax,%rbx), %eax	# 58	[c=13 l=4]  *zero_extendqisi2/0
+	addq	$16, %rsp	# 111	[c=4 l=4]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_remember_state
+	.cfi_def_cfa_offset 16
+	popq	%rbx	# 112	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 8
+	ret		# 113	[c=0 l=1]  simple_return_internal
+.L159:
+	.cfi_restore_state
+	movl	%ebx, %esi	# 50	[c=4 l=2]  *movsi_internal/0
+	call	bad_address	# 52	[c=0 l=5]  *call
+	.cfi_endproc
+.LFE37:
+	.size	data_read_page, .-data_read_page
+	.section	.rodata.str1.1
+.LC25:
+	.string	"(%s)->%02x "
+	.text
+	.p2align 4
+	.type	spm_operation, @function
+spm_operation:
+.LFB81:
+	.cfi_startproc
+	pushq	%rbx	# 63	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	movl	$458, %eax	# 7	[c=4 l=5]  *movsi_internal/0
+	subq	$16, %rsp	# 64	[c=4 l=4]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_def_cfa_offset 32
+	subl	5176(%rdi), %eax	# 8	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rdi), %eax	# 9	[c=13 l=6]  *cmpsi_1/1
+	jb	.L161	# 10	[c=13 l=2]  *jcc
+	cmpb	$0, 1094(%rdi)	# 12	[c=13 l=7]  *cmpqi_ccno_1/1
+	jne	.L162	# 13	[c=13 l=2]  *jcc
+.L161:
+	movq	1040(%rdi), %rax	# 16	[c=9 l=7]  *movdi_internal/3
+	movzbl	458(%rax), %ebx	# 17	[c=13 l=7]  *zero_extendqisi2/0
+.L163:
+	movl	%ebx, %ecx	# 28	[c=4 l=2]  *movsi_internal/0
+	movl	$458, %edx	# 29	[c=4 l=5]  *movsi_internal/0
+	leaq	.LC25(%rip), %rsi	# 30	[c=1 l=7]  *movdi_internal/4
+	subl	$34, %ebx	# 34	[c=5 l=3]  addsi_1_zext/0
+	call	log_add_data_mov@PLT	# 33	[c=0 l=5]  *call
+	xorl	%eax, %eax	# 73	[c=4 l=2]  *movdi_xor
+	cmpl	$13, %ebx	# 37	[c=4 l=3]  *cmpsi_1/0
+	ja	.L160	# 38	[c=13 l=2]  *jcc
+	leaq	CSWTCH.148(%rip), %rax	# 59	[c=1 l=7]  *movdi_internal/4
+	movl	(%rax,%rbx,4), %eax	# 42	[c=10 l=3]  *movsi_internal/0
+.L160:
+	addq	$16, %rsp	# 67	[c=4 l=4]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_remember_state
+	.cfi_def_cfa_offset 16
+	popq	%rbx	# 68	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 8
+	ret		# 69	[c=0 l=1]  simple_return_internal
+	.p2align 4,,10
+	.p2align 3
+.L162:
+	.cfi_restore_state
+	movl	$458, %esi	# 22	[c=4 l=5]  *movsi_internal/0
+	movq	%rdi, 8(%rsp)	# 61	[c=4 l=5]  *movdi_internal/5
+	call	data_read_page	# 24	[c=10 l=5]  *call_value
+	movq	8(%rsp), %rdi	# 62	[c=9 l=5]  *movdi_internal/3
+	movl	%eax, %ebx	# 25	[c=4 l=2]  *movsi_internal/0
+	jmp	.L163	# 74	[c=1 l=2]  jump
+	.cfi_endproc
+.LFE81:
+	.size	spm_operation, .-spm_operation
+	.section	.rodata.str1.8
+	.align 8
+.LC26:
+	.string	"stack pointer overflow (SP = 0x%04x)"
+	.text
+	.p2align 4
+	.type	stack_overflow, @function
+stack_overflow:
+.LFB63:
+	.cfi_startproc
+	movl	%esi, %ecx	# 3	[c=4 l=2]  *movsi_internal/0
+	subq	$8, %rsp	# 20	[c=4 l=4]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_def_cfa_offset 16
+	leaq	.LC26(%rip), %rdx	# 8	[c=1 l=7]  *movdi_internal/4
+	xorl	%eax, %eax	# 27	[c=4 l=2]  *movdi_xor
+	movl	$1, %esi	# 10	[c=4 l=5]  *movsi_internal/0
+	call	leave	# 13	[c=0 l=5]  *call
+	.cfi_endproc
+.LFE63:
+	.size	stack_overflow, .-stack_overflow
+	.section	.rodata.str1.1
+.LC27:
+	.string	"external memory"
+	.section	.rodata.str1.8
+	.align 8
+.LC28:
+	.string	"out of memory allocating %u * %u bytes for %s"
+	.text
+	.p2align 4
+	.type	far_write, @function
+far_write:
+.LFB26:
+	.cfi_startproc
+	pushq	%r13	# 71	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 16
+	.cfi_offset 13, -16
+	movl	%esi, %eax	# 69	[c=4 l=2]  *movsi_internal/0
+	movl	%edx, %r13d	# 4	[c=4 l=3]  *movsi_internal/0
+	pushq	%r12	# 72	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 24
+	.cfi_offset 12, -24
+	sarl	$12, %eax	# 8	[c=4 l=3]  *ashrsi3_1/0
+	pushq	%rbp	# 73	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 32
+	.cfi_offset 6, -32
+	andl	$4095, %eax	# 67	[c=5 l=5]  *andsi_1_zext
+	pushq	%rbx	# 74	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 40
+	.cfi_offset 3, -40
+	movl	%esi, %ebx	# 3	[c=4 l=2]  *movsi_internal/0
+	subq	$8, %rsp	# 75	[c=4 l=4]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_def_cfa_offset 48
+	movq	1072(%rdi), %rcx	# 12	[c=9 l=7]  *movdi_internal/3
+	leaq	(%rcx,%rax,8), %r12	# 13	[c=8 l=4]  *leadi
+	movq	(%r12), %rax	# 14	[c=5 l=4]  *movdi_internal/3
+	testq	%rax, %rax	# 15	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L177	# 16	[c=13 l=2]  *jcc
+.L170:
+	andl	$4095, %ebx	# 66	[c=5 l=6]  *andsi_1_zext
+	movb	%r13b, (%rax,%rbx)	# 53	[c=4 l=4]  *movqi_internal/8
+	addq	$8, %rsp	# 78	[c=4 l=4]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	popq	%rbx	# 79	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 32
+	popq	%rbp	# 80	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 24
+	popq	%r12	# 81	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 16
+	popq	%r13	# 82	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 8
+	ret		# 83	[c=0 l=1]  simple_return_internal
+	.p2align 4,,10
+	.p2align 3
+.L177:
+	.cfi_restore_state
+	movq	%rdi, %rbp	# 84	[c=4 l=3]  *movdi_internal/3
+	movl	$4128, %esi	# 18	[c=4 l=5]  *movdi_internal/2
+	movl	$1, %edi	# 19	[c=4 l=5]  *movdi_internal/2
+	call	calloc@PLT	# 20	[c=10 l=5]  *call_value
+	testq	%rax, %rax	# 23	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L178	# 24	[c=13 l=2]  *jcc
+	movq	984(%rbp), %rcx	# 38	[c=9 l=7]  *movdi_internal/3
+	movq	%rcx, (%rax)	# 39	[c=4 l=3]  *movdi_internal/5
+	testq	%rcx, %rcx	# 40	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L172	# 41	[c=13 l=2]  *jcc
+	movq	%rax, 8(%rcx)	# 43	[c=4 l=4]  *movdi_internal/5
+.L172:
+	movq	%rax, 984(%rbp)	# 46	[c=4 l=7]  *movdi_internal/5
+	addq	$32, %rax	# 47	[c=4 l=4]  *adddi_1/0
+	movq	%rax, (%r12)	# 48	[c=4 l=4]  *movdi_internal/5
+	jmp	.L170	# 90	[c=1 l=2]  jump
+.L178:
+	leaq	.LC27(%rip), %r9	# 26	[c=1 l=7]  *movdi_internal/4
+	movl	$1, %r8d	# 27	[c=4 l=6]  *movsi_internal/0
+	movq	%rbp, %rdi	# 32	[c=4 l=3]  *movdi_internal/3
+	movl	$4096, %ecx	# 28	[c=4 l=5]  *movsi_internal/0
+	leaq	.LC28(%rip), %rdx	# 29	[c=1 l=7]  *movdi_internal/4
+	movl	$6, %esi	# 31	[c=4 l=5]  *movsi_internal/0
+	call	leave	# 34	[c=0 l=5]  *call
+	.cfi_endproc
+.LFE26:
+	.size	far_write, .-far_write
+	.p2align 4
+	.type	data_write_mapped, @function
+data_write_mapped:
+.LFB28:
+	.cfi_startproc
+	pushq	%r12	# 121	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	movl	%esi, %eax	# 112	[c=4 l=2]  *movsi_internal/0
+	pushq	%rbp	# 122	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	movq	%rdi, %rbp	# 2	[c=4 l=3]  *movdi_internal/3
+	pushq	%rbx	# 123	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	movl	%esi, %ebx	# 3	[c=4 l=2]  *movsi_internal/0
+	subq	$16, %rsp	# 124	[c=4 l=4]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_def_cfa_offset 48
+	subl	5176(%rdi), %eax	# 8	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rdi), %eax	# 9	[c=13 l=6]  *cmpsi_1/1
+	jb	.L180	# 10	[c=13 l=2]  *jcc
+	movl	%esi, %eax	# 114	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %eax	# 12	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 110	[c=5 l=5]  *andsi_1_zext
+	movzbl	1080(%rdi,%rax), %eax	# 15	[c=10 l=8]  *movqi_internal/4
+	cmpb	$3, %al	# 16	[c=4 l=2]  *cmpqi_1/0
+	je	.L181	# 17	[c=13 l=2]  *jcc
+	cmpb	$4, %al	# 19	[c=4 l=2]  *cmpqi_1/0
+	jne	.L180	# 20	[c=13 l=2]  *jcc
+	movl	%esi, %eax	# 116	[c=4 l=2]  *movsi_internal/0
+	movq	1072(%rdi), %rcx	# 38	[c=9 l=7]  *movdi_internal/3
+	sarl	$12, %eax	# 34	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 109	[c=5 l=5]  *andsi_1_zext
+	leaq	(%rcx,%rax,8), %r12	# 39	[c=8 l=4]  *leadi
+	movq	(%r12), %rax	# 40	[c=5 l=4]  *movdi_internal/3
+	testq	%rax, %rax	# 41	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L192	# 42	[c=13 l=2]  *jcc
+.L183:
+	andl	$4095, %ebx	# 108	[c=5 l=6]  *andsi_1_zext
+	movb	%dl, (%rax,%rbx)	# 79	[c=4 l=3]  *movqi_internal/8
+	addq	$16, %rsp	# 127	[c=4 l=4]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_remember_state
+	.cfi_def_cfa_offset 32
+	popq	%rbx	# 128	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 24
+	popq	%rbp	# 129	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 16
+	popq	%r12	# 130	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 8
+	ret		# 131	[c=0 l=1]  simple_return_internal
+	.p2align 4,,10
+	.p2align 3
+.L181:
+	.cfi_restore_state
+	addq	$16, %rsp	# 135	[c=4 l=4]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_remember_state
+	.cfi_def_cfa_offset 32
+	leal	-4096(%rsi), %esi	# 120	[c=4 l=6]  *leasi
+	popq	%rbx	# 136	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 24
+	popq	%rbp	# 137	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 16
+	popq	%r12	# 138	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 8
+	jmp	eeprom_write_mapped@PLT	# 30	[c=0 l=5]  *sibcall
+	.p2align 4,,10
+	.p2align 3
+.L180:
+	.cfi_restore_state
+	movl	%ebx, %esi	# 84	[c=4 l=2]  *movsi_internal/0
+	movq	%rbp, %rdi	# 85	[c=4 l=3]  *movdi_internal/3
+	call	bad_address	# 86	[c=0 l=5]  *call
+	.p2align 4,,10
+	.p2align 3
+.L192:
+	movl	$4128, %esi	# 44	[c=4 l=5]  *movdi_internal/2
+	movl	$1, %edi	# 45	[c=4 l=5]  *movdi_internal/2
+	movl	%edx, 12(%rsp)	# 118	[c=4 l=4]  *movsi_internal/1
+	call	calloc@PLT	# 46	[c=10 l=5]  *call_value
+	movl	12(%rsp), %edx	# 119	[c=9 l=4]  *movsi_internal/0
+	testq	%rax, %rax	# 49	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L193	# 50	[c=13 l=2]  *jcc
+	movq	984(%rbp), %rcx	# 64	[c=9 l=7]  *movdi_internal/3
+	movq	%rcx, (%rax)	# 65	[c=4 l=3]  *movdi_internal/5
+	testq	%rcx, %rcx	# 66	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L185	# 67	[c=13 l=2]  *jcc
+	movq	%rax, 8(%rcx)	# 69	[c=4 l=4]  *movdi_internal/5
+.L185:
+	movq	%rax, 984(%rbp)	# 72	[c=4 l=7]  *movdi_internal/5
+	addq	$32, %rax	# 73	[c=4 l=4]  *adddi_1/0
+	movq	%rax, (%r12)	# 74	[c=4 l=4]  *movdi_internal/5
+	jmp	.L183	# 142	[c=1 l=5]  jump
+.L193:
+	leaq	.LC27(%rip), %r9	# 52	[c=1 l=7]  *movdi_internal/4
+	movl	$1, %r8d	# 53	[c=4 l=6]  *movsi_internal/0
+	movq	%rbp, %rdi	# 58	[c=4 l=3]  *movdi_internal/3
+	movl	$4096, %ecx	# 54	[c=4 l=5]  *movsi_internal/0
+	leaq	.LC28(%rip), %rdx	# 55	[c=1 l=7]  *movdi_internal/4
+	movl	$6, %esi	# 57	[c=4 l=5]  *movsi_internal/0
+	call	leave	# 60	[c=0 l=5]  *call
+	.cfi_endproc
+.LFE28:
+	.size	data_write_mapped, .-data_write_mapped
+	.p2align 4
+	.type	data_write_page, @function
+data_write_page:
+.LFB38:
+	.cfi_startproc
+	movl	%esi, %eax	# 84	[c=4 l=2]  *movsi_internal/0
+	subl	5176(%rdi), %eax	# 9	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rdi), %eax	# 10	[c=13 l=6]  *cmpsi_1/1
+	jb	.L195	# 11	[c=13 l=2]  *jcc
+	movl	%esi, %eax	# 86	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %eax	# 13	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 82	[c=5 l=5]  *andsi_1_zext
+	cmpb	$1, 1080(%rdi,%rax)	# 16	[c=14 l=8]  *cmpqi_1/0
+	je	.L196	# 17	[c=13 l=2]  *jcc
+.L195:
+	jmp	data_write_mapped	# 23	[c=0 l=5]  *sibcall
+	.p2align 4,,10
+	.p2align 3
+.L196:
+	cmpl	$63, %esi	# 27	[c=4 l=3]  *cmpsi_1/0
+	je	.L207	# 28	[c=13 l=2]  *jcc
+	cmpl	6564(%rdi), %esi	# 36	[c=13 l=6]  *cmpsi_1/1
+	jnb	.L199	# 37	[c=13 l=2]  *jcc
+	movslq	%esi, %rax	# 39	[c=4 l=3]  *extendsidi2_rex64/1
+	cmpb	$0, 6568(%rdi,%rax)	# 40	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L200	# 41	[c=13 l=2]  *jcc
+.L199:
+	cmpl	%esi, 1000(%rdi)	# 44	[c=13 l=6]  *cmpsi_1/0
+	jb	.L208	# 45	[c=13 l=2]  *jcc
+	movq	1040(%rdi), %rax	# 67	[c=9 l=7]  *movdi_internal/3
+	movslq	%esi, %rsi	# 66	[c=4 l=3]  *extendsidi2_rex64/1
+	movb	%dl, (%rax,%rsi)	# 68	[c=4 l=3]  *movqi_internal/8
+	ret		# 95	[c=0 l=1]  simple_return_internal
+	.p2align 4,,10
+	.p2align 3
+.L207:
+	movq	1040(%rdi), %rax	# 30	[c=9 l=7]  *movdi_internal/3
+	movb	%dl, 63(%rax)	# 31	[c=4 l=3]  *movqi_internal/8
+	ret		# 76	[c=0 l=1]  simple_return_internal
+	.p2align 4,,10
+	.p2align 3
+.L200:
+	movq	48(%rdi), %rcx	# 51	[c=9 l=4]  *movdi_internal/3
+	jmp	periph_write@PLT	# 56	[c=0 l=5]  *sibcall
+.L208:
+	pushq	%rax	# 108	[c=4 l=1]  *pushdi2_prologue
+	.cfi_def_cfa_offset 16
+	call	bad_address	# 62	[c=0 l=5]  *call
+	.cfi_endproc
+.LFE38:
+	.size	data_write_page, .-data_write_page
+	.section	.rodata.str1.1
+.LC29:
+	.string	"(SREG)<-'%s' "
+.LC30:
+	.string	"(%s)<-%02x "
+.LC31:
+	.string	"(%s)->%04x "
+.LC32:
+	.string	"(%s)<-%04x "
+.LC33:
+	.string	"(SREG)->'%s' "
+	.text
+	.p2align 4
+	.type	do_events, @function
+do_events:
+.LFB209:
+	.cfi_startproc
+	pushq	%r15	# 585	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14	# 586	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13	# 587	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12	# 588	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp	# 589	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx	# 590	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	movq	%rdi, %rbx	# 2	[c=4 l=3]  *movdi_internal/3
+	subq	$24, %rsp	# 591	[c=4 l=4]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_def_cfa_offset 80
+	cmpb	$0, 6040(%rdi)	# 12	[c=13 l=7]  *cmpqi_ccno_1/1
+	jne	.L257	# 13	[c=13 l=6]  *jcc
+.L211:
+	movq	%rbx, %rdi	# 44	[c=4 l=3]  *movdi_internal/3
+	call	events_run@PLT	# 45	[c=0 l=5]  *call
+	movq	1040(%rbx), %rax	# 46	[c=9 l=7]  *movdi_internal/3
+	cmpb	$0, 63(%rax)	# 49	[c=13 l=4]  *cmpqi_ccno_1/1
+	jns	.L256	# 50	[c=13 l=6]  *jcc
+	movq	6024(%rbx), %rax	# 57	[c=9 l=7]  *movdi_internal/3
+	cmpq	%rax, 48(%rbx)	# 58	[c=13 l=4]  *cmpdi_1/0
+	je	.L214	# 59	[c=13 l=6]  *jcc
+	movq	%rbx, %rdi	# 61	[c=4 l=3]  *movdi_internal/3
+	call	irq_take@PLT	# 62	[c=10 l=5]  *call_value
+	movl	%eax, %r12d	# 63	[c=4 l=3]  *movsi_internal/0
+	testl	%eax, %eax	# 66	[c=4 l=2]  *cmpsi_ccno_1/0
+	js	.L256	# 67	[c=13 l=6]  *jcc
+	movl	%eax, %esi	# 74	[c=4 l=2]  *movsi_internal/0
+	movq	%rbx, %rdi	# 75	[c=4 l=3]  *movdi_internal/3
+	call	periph_irq_taken@PLT	# 76	[c=0 l=5]  *call
+	movl	%r12d, %esi	# 77	[c=4 l=3]  *movsi_internal/0
+	movq	%rbx, %rdi	# 78	[c=4 l=3]  *movdi_internal/3
+	call	log_add_irq@PLT	# 79	[c=0 l=5]  *call
+	movl	$61, %eax	# 82	[c=4 l=5]  *movsi_internal/0
+	movl	5176(%rbx), %r13d	# 80	[c=9 l=7]  *movsi_internal/0
+	movl	5180(%rbx), %ebp	# 81	[c=9 l=6]  *movsi_internal/0
+	subl	%r13d, %eax	# 83	[c=4 l=3]  *subsi_1/0
+	cmpl	%ebp, %eax	# 84	[c=4 l=2]  *cmpsi_1/0
+	jb	.L216	# 85	[c=13 l=6]  *jcc
+	cmpb	$1, 1081(%rbx)	# 89	[c=13 l=7]  *cmpqi_1/0
+	ja	.L258	# 90	[c=13 l=6]  *jcc
+	movq	1040(%rbx), %rax	# 423	[c=9 l=7]  *movdi_internal/3
+	movzbl	61(%rax), %r14d	# 424	[c=13 l=5]  *zero_extendqisi2/0
+.L220:
+	movzbl	62(%rax), %ebp	# 129	[c=13 l=4]  *zero_extendqisi2/0
+.L221:
+	sall	$8, %ebp	# 132	[c=4 l=3]  *ashlsi3_1/0
+	movl	$61, %edx	# 135	[c=4 l=5]  *movsi_internal/0
+	leaq	.LC31(%rip), %rsi	# 136	[c=1 l=7]  *movdi_internal/4
+	movq	%rbx, %rdi	# 138	[c=4 l=3]  *movdi_internal/3
+	orl	%r14d, %ebp	# 133	[c=4 l=3]  *iorsi_1/0
+	movl	%ebp, %ecx	# 134	[c=4 l=2]  *movsi_internal/0
+	call	log_add_data_mov@PLT	# 139	[c=0 l=5]  *call
+	movl	996(%rbx), %edx	# 141	[c=9 l=6]  *movsi_internal/0
+	movzbl	840(%rbx), %eax	# 143	[c=13 l=7]  *zero_extendqisi2/0
+	leal	1(%rdx,%rax), %eax	# 144	[c=5 l=4]  *leasi
+	cmpl	%eax, %ebp	# 145	[c=4 l=2]  *cmpsi_1/0
+	jb	.L259	# 146	[c=13 l=6]  *jcc
+	cmpl	$63, %ebp	# 487	[c=4 l=3]  *cmpsi_1/0
+	movl	(%rbx), %r13d	# 154	[c=5 l=3]  *movsi_internal/0
+	leaq	.LC29(%rip), %r14	# 4	[c=1 l=7]  *movdi_internal/4
+	movl	%ebp, %edx	# 163	[c=4 l=2]  *movsi_internal/0
+	leaq	.LC30(%rip), %rsi	# 553	[c=1 l=7]  *movdi_internal/4
+	movq	%rbx, %rdi	# 165	[c=4 l=3]  *movdi_internal/3
+	leal	-1(%rbp), %r15d	# 582	[c=4 l=4]  *leasi
+	cmove	%r14, %rsi	# 488	[c=8 l=4]  *movdicc_noc/0
+	movzbl	%r13b, %ecx	# 156	[c=4 l=4]  *zero_extendqisi2/0
+	call	log_add_data_mov@PLT	# 166	[c=0 l=5]  *call
+	movl	%ebp, %edx	# 556	[c=4 l=2]  *movsi_internal/0
+	subl	5176(%rbx), %edx	# 167	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %edx	# 168	[c=13 l=6]  *cmpsi_1/1
+	jb	.L224	# 169	[c=13 l=2]  *jcc
+	movl	%ebp, %edx	# 558	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %edx	# 171	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %edx	# 548	[c=5 l=6]  *andsi_1_zext
+	cmpb	$0, 1080(%rbx,%rdx)	# 174	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L225	# 175	[c=13 l=6]  *jcc
+.L224:
+	movq	1040(%rbx), %rcx	# 179	[c=9 l=7]  *movdi_internal/3
+	movslq	%ebp, %rdx	# 178	[c=4 l=3]  *extendsidi2_rex64/1
+	movb	%r13b, (%rcx,%rdx)	# 180	[c=4 l=4]  *movqi_internal/8
+.L226:
+	movl	(%rbx), %ecx	# 191	[c=5 l=2]  *movsi_internal/0
+	leaq	.LC30(%rip), %rdx	# 550	[c=1 l=7]  *movdi_internal/4
+	movq	%rbx, %rdi	# 203	[c=4 l=3]  *movdi_internal/3
+	leal	-2(%rbp), %r13d	# 581	[c=4 l=4]  *leasi
+	leaq	.LC29(%rip), %rsi	# 549	[c=1 l=7]  *movdi_internal/4
+	movl	%ecx, %eax	# 560	[c=4 l=2]  *movsi_internal/0
+	movzbl	%ch, %ecx	# 194	[c=4 l=3]  *extzvsi
+	shrl	$8, %eax	# 192	[c=4 l=3]  *lshrsi3_1/0
+	cmpl	$63, %r15d	# 454	[c=4 l=4]  *cmpsi_1/0
+	cmovne	%rdx, %rsi	# 455	[c=8 l=4]  *movdicc_noc/1
+	movl	%r15d, %edx	# 201	[c=4 l=3]  *movsi_internal/0
+	movl	%eax, 12(%rsp)	# 561	[c=4 l=4]  *movsi_internal/1
+	call	log_add_data_mov@PLT	# 204	[c=0 l=5]  *call
+	movl	%r15d, %edx	# 562	[c=4 l=3]  *movsi_internal/0
+	subl	5176(%rbx), %edx	# 205	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %edx	# 206	[c=13 l=6]  *cmpsi_1/1
+	jb	.L228	# 207	[c=13 l=2]  *jcc
+	movl	%r15d, %edx	# 564	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %edx	# 209	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %edx	# 547	[c=5 l=6]  *andsi_1_zext
+	cmpb	$0, 1080(%rbx,%rdx)	# 212	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L229	# 213	[c=13 l=6]  *jcc
+.L228:
+	movq	1040(%rbx), %rdx	# 217	[c=9 l=7]  *movdi_internal/3
+	movzbl	12(%rsp), %ecx	# 566	[c=9 l=5]  *movqi_internal/4
+	movslq	%r15d, %rax	# 216	[c=4 l=3]  *extendsidi2_rex64/1
+	movb	%cl, (%rdx,%rax)	# 218	[c=4 l=3]  *movqi_internal/8
+.L230:
+	cmpb	$0, 840(%rbx)	# 229	[c=13 l=7]  *cmpqi_ccno_1/1
+	je	.L231	# 230	[c=13 l=2]  *jcc
+	movl	(%rbx), %r15d	# 567	[c=5 l=3]  *movsi_internal/0
+	leaq	.LC30(%rip), %rax	# 552	[c=1 l=7]  *movdi_internal/4
+	movl	%r13d, %edx	# 241	[c=4 l=3]  *movsi_internal/0
+	movq	%rbx, %rdi	# 243	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC29(%rip), %rsi	# 551	[c=1 l=7]  *movdi_internal/4
+	shrl	$16, %r15d	# 233	[c=4 l=4]  *lshrsi3_1/0
+	cmpl	$63, %r13d	# 458	[c=4 l=4]  *cmpsi_1/0
+	cmovne	%rax, %rsi	# 459	[c=8 l=4]  *movdicc_noc/1
+	movzbl	%r15b, %ecx	# 234	[c=4 l=4]  *zero_extendqisi2/0
+	call	log_add_data_mov@PLT	# 244	[c=0 l=5]  *call
+	movl	%r13d, %eax	# 569	[c=4 l=3]  *movsi_internal/0
+	subl	5176(%rbx), %eax	# 245	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %eax	# 246	[c=13 l=6]  *cmpsi_1/1
+	jb	.L233	# 247	[c=13 l=2]  *jcc
+	movl	%r13d, %eax	# 571	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %eax	# 249	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 546	[c=5 l=5]  *andsi_1_zext
+	cmpb	$0, 1080(%rbx,%rax)	# 252	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L234	# 253	[c=13 l=6]  *jcc
+.L233:
+	movq	1040(%rbx), %rax	# 257	[c=9 l=7]  *movdi_internal/3
+	movslq	%r13d, %r13	# 256	[c=4 l=3]  *extendsidi2_rex64/1
+	movb	%r15b, (%rax,%r13)	# 258	[c=4 l=4]  *movqi_internal/8
+.L235:
+	leal	-3(%rbp), %r13d	# 580	[c=4 l=4]  *leasi
+	.p2align 4,,10
+	.p2align 3
+.L231:
+	movzwl	%r13w, %ebp	# 272	[c=4 l=4]  *zero_extendhisi2/0
+	movl	$61, %edx	# 274	[c=4 l=5]  *movsi_internal/0
+	leaq	.LC32(%rip), %rsi	# 275	[c=1 l=7]  *movdi_internal/4
+	movq	%rbx, %rdi	# 277	[c=4 l=3]  *movdi_internal/3
+	movl	%ebp, %ecx	# 273	[c=4 l=2]  *movsi_internal/0
+	call	log_add_data_mov@PLT	# 278	[c=0 l=5]  *call
+	movl	$61, %eax	# 279	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%rbx), %eax	# 280	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %eax	# 281	[c=13 l=6]  *cmpsi_1/1
+	jb	.L236	# 282	[c=13 l=2]  *jcc
+	cmpb	$1, 1081(%rbx)	# 286	[c=13 l=7]  *cmpqi_1/0
+	ja	.L260	# 287	[c=13 l=6]  *jcc
+.L236:
+	movq	1040(%rbx), %rax	# 298	[c=9 l=7]  *movdi_internal/3
+	movb	%r13b, 61(%rax)	# 299	[c=4 l=4]  *movqi_internal/8
+.L237:
+	movl	$62, %eax	# 303	[c=4 l=5]  *movsi_internal/0
+	sarl	$8, %ebp	# 302	[c=4 l=3]  *ashrsi3_1/0
+	subl	5176(%rbx), %eax	# 304	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %eax	# 305	[c=13 l=6]  *cmpsi_1/1
+	jb	.L238	# 306	[c=13 l=2]  *jcc
+	cmpb	$1, 1081(%rbx)	# 310	[c=13 l=7]  *cmpqi_1/0
+	ja	.L261	# 311	[c=13 l=6]  *jcc
+.L238:
+	movq	1040(%rbx), %rax	# 321	[c=9 l=7]  *movdi_internal/3
+	movb	%bpl, 62(%rax)	# 322	[c=4 l=4]  *movqi_internal/8
+.L239:
+	movl	$63, %eax	# 325	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%rbx), %eax	# 326	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %eax	# 327	[c=13 l=6]  *cmpsi_1/1
+	jb	.L240	# 328	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%rbx)	# 330	[c=13 l=7]  *cmpqi_ccno_1/1
+	jne	.L241	# 331	[c=13 l=6]  *jcc
+.L240:
+	movq	1040(%rbx), %rax	# 334	[c=9 l=7]  *movdi_internal/3
+	movzbl	63(%rax), %ebp	# 335	[c=13 l=4]  *zero_extendqisi2/0
+.L242:
+	movl	%ebp, %ecx	# 346	[c=4 l=2]  *movsi_internal/0
+	movl	$63, %edx	# 347	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 350	[c=4 l=3]  *movdi_internal/3
+	movl	%ebp, %r13d	# 573	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC33(%rip), %rsi	# 348	[c=1 l=7]  *movdi_internal/4
+	andb	$127, %r13b	# 577	[c=4 l=4]  *andqi_1_slp/0
+	call	log_add_data_mov@PLT	# 351	[c=0 l=5]  *call
+	movl	%ebp, %ecx	# 575	[c=4 l=2]  *movsi_internal/0
+	movl	$63, %edx	# 355	[c=4 l=5]  *movsi_internal/0
+	movq	%r14, %rsi	# 357	[c=4 l=3]  *movdi_internal/3
+	andl	$127, %ecx	# 353	[c=4 l=3]  *andsi_1/0
+	movq	%rbx, %rdi	# 358	[c=4 l=3]  *movdi_internal/3
+	call	log_add_data_mov@PLT	# 359	[c=0 l=5]  *call
+	movl	$63, %eax	# 360	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%rbx), %eax	# 361	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %eax	# 362	[c=13 l=6]  *cmpsi_1/1
+	jb	.L246	# 363	[c=13 l=2]  *jcc
+	movzbl	1081(%rbx), %eax	# 365	[c=9 l=7]  *movqi_internal/4
+	testb	%al, %al	# 366	[c=4 l=2]  *cmpqi_ccno_1/0
+	jne	.L244	# 367	[c=13 l=6]  *jcc
+.L246:
+	movq	1040(%rbx), %rax	# 387	[c=9 l=7]  *movdi_internal/3
+	movb	%r13b, 63(%rax)	# 388	[c=4 l=4]  *movqi_internal/8
+.L245:
+	cmpl	$8192, 880(%rbx)	# 393	[c=13 l=10]  *cmpsi_1/0
+	jbe	.L247	# 394	[c=13 l=2]  *jcc
+	addl	%r12d, %r12d	# 396	[c=4 l=3]  *ashlsi3_1/0
+.L247:
+	addq	$5, 48(%rbx)	# 400	[c=13 l=5]  *adddi_1/0
+	movq	%rbx, %rdi	# 401	[c=4 l=3]  *movdi_internal/3
+	movl	%r12d, (%rbx)	# 399	[c=4 l=3]  *movsi_internal/1
+	call	log_dump_irq@PLT	# 402	[c=0 l=5]  *call
+.L256:
+	movq	48(%rbx), %rax	# 403	[c=9 l=4]  *movdi_internal/3
+.L214:
+	cmpq	6032(%rbx), %rax	# 406	[c=13 l=7]  *cmpdi_1/1
+	jnb	.L262	# 407	[c=13 l=2]  *jcc
+	addq	$24, %rsp	# 594	[c=4 l=4]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx	# 595	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 48
+	popq	%rbp	# 596	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 40
+	popq	%r12	# 597	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 32
+	popq	%r13	# 598	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 24
+	popq	%r14	# 599	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 16
+	popq	%r15	# 600	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 8
+	ret		# 601	[c=0 l=1]  simple_return_internal
+	.p2align 4,,10
+	.p2align 3
+.L257:
+	.cfi_restore_state
+	call	fork_server_poll@PLT	# 20	[c=10 l=5]  *call_value
+	testb	%al, %al	# 23	[c=4 l=2]  *cmpqi_ccno_1/0
+	je	.L211	# 24	[c=13 l=6]  *jcc
+	movl	820(%rbx), %edx	# 26	[c=9 l=6]  *movsi_internal/0
+	movzwl	816(%rbx), %eax	# 33	[c=13 l=7]  *zero_extendhisi2/0
+	movzbl	%dh, %ecx	# 34	[c=4 l=3]  *extzvsi
+	sall	$8, %eax	# 35	[c=4 l=3]  *ashlsi3_1/0
+	movzbl	%dl, %edx	# 37	[c=4 l=3]  *zero_extendqisi2/0
+	orl	%ecx, %eax	# 36	[c=4 l=2]  *iorsi_1/0
+	sall	$8, %eax	# 38	[c=4 l=3]  *ashlsi3_1/0
+	orl	%edx, %eax	# 40	[c=4 l=2]  *iorsi_1/0
+	movl	%eax, 1026(%rbx)	# 41	[c=4 l=6]  *movv4qi_internal/1
+	jmp	.L211	# 631	[c=1 l=5]  jump
+	.p2align 4,,10
+	.p2align 3
+.L262:
+	movq	%rbx, %rdi	# 409	[c=4 l=3]  *movdi_internal/3
+	call	checkpoint_begin@PLT	# 410	[c=0 l=5]  *call
+	movq	%rbx, %rdi	# 412	[c=4 l=3]  *movdi_internal/3
+	xorl	%esi, %esi	# 624	[c=4 l=2]  *movdi_xor
+	call	log_checkpoint@PLT	# 413	[c=0 l=5]  *call
+	addq	$24, %rsp	# 605	[c=4 l=4]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	movq	%rbx, %rdi	# 414	[c=4 l=3]  *movdi_internal/3
+	popq	%rbx	# 606	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 48
+	popq	%rbp	# 607	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 40
+	popq	%r12	# 608	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 32
+	popq	%r13	# 609	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 24
+	popq	%r14	# 610	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 16
+	popq	%r15	# 611	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 8
+	jmp	checkpoint_end@PLT	# 415	[c=0 l=5]  *sibcall
+	.p2align 4,,10
+	.p2align 3
+.L216:
+	.cfi_restore_state
+	movq	1040(%rbx), %rax	# 105	[c=9 l=7]  *movdi_internal/3
+	movl	$62, %edx	# 107	[c=4 l=5]  *movsi_internal/0
+	subl	%r13d, %edx	# 108	[c=4 l=3]  *subsi_1/0
+	movzbl	61(%rax), %r14d	# 106	[c=13 l=5]  *zero_extendqisi2/0
+	cmpl	%ebp, %edx	# 109	[c=4 l=2]  *cmpsi_1/0
+	jb	.L220	# 110	[c=13 l=6]  *jcc
+	cmpb	$1, 1081(%rbx)	# 114	[c=13 l=7]  *cmpqi_1/0
+	jbe	.L220	# 115	[c=13 l=6]  *jcc
+.L219:
+	movl	$62, %esi	# 118	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 119	[c=4 l=3]  *movdi_internal/3
+	call	data_read_mapped	# 120	[c=10 l=5]  *call_value
+	movl	%eax, %ebp	# 121	[c=4 l=2]  *movsi_internal/0
+	jmp	.L221	# 633	[c=1 l=5]  jump
+	.p2align 4,,10
+	.p2align 3
+.L260:
+	movzbl	%r13b, %edx	# 289	[c=4 l=4]  *zero_extendqisi2/0
+	movl	$61, %esi	# 291	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 292	[c=4 l=3]  *movdi_internal/3
+	call	data_write_mapped	# 293	[c=0 l=5]  *call
+	jmp	.L237	# 635	[c=1 l=5]  jump
+	.p2align 4,,10
+	.p2align 3
+.L261:
+	movl	%ebp, %edx	# 313	[c=4 l=2]  *movsi_internal/0
+	movl	$62, %esi	# 314	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 315	[c=4 l=3]  *movdi_internal/3
+	call	data_write_mapped	# 316	[c=0 l=5]  *call
+	jmp	.L239	# 637	[c=1 l=5]  jump
+	.p2align 4,,10
+	.p2align 3
+.L234:
+	movl	%r15d, %edx	# 263	[c=4 l=3]  *movsi_internal/0
+	movl	%r13d, %esi	# 264	[c=4 l=3]  *movsi_internal/0
+	movq	%rbx, %rdi	# 265	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 266	[c=0 l=5]  *call
+	jmp	.L235	# 639	[c=1 l=5]  jump
+	.p2align 4,,10
+	.p2align 3
+.L229:
+	movl	12(%rsp), %edx	# 223	[c=9 l=4]  *movsi_internal/0
+	movl	%r15d, %esi	# 224	[c=4 l=3]  *movsi_internal/0
+	movq	%rbx, %rdi	# 225	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 226	[c=0 l=5]  *call
+	jmp	.L230	# 641	[c=1 l=5]  jump
+	.p2align 4,,10
+	.p2align 3
+.L225:
+	movl	%r13d, %edx	# 185	[c=4 l=3]  *movsi_internal/0
+	movl	%ebp, %esi	# 186	[c=4 l=2]  *movsi_internal/0
+	movq	%rbx, %rdi	# 187	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 188	[c=0 l=5]  *call
+	jmp	.L226	# 643	[c=1 l=5]  jump
+	.p2align 4,,10
+	.p2align 3
+.L241:
+	movl	$63, %esi	# 340	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 341	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 342	[c=10 l=5]  *call_value
+	movl	%eax, %ebp	# 343	[c=4 l=2]  *movsi_internal/0
+	jmp	.L242	# 645	[c=1 l=5]  jump
+	.p2align 4,,10
+	.p2align 3
+.L258:
+	movl	$61, %esi	# 92	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 93	[c=4 l=3]  *movdi_internal/3
+	call	data_read_mapped	# 94	[c=10 l=5]  *call_value
+	movl	%eax, %r14d	# 95	[c=4 l=3]  *movsi_internal/0
+	movl	$62, %eax	# 96	[c=4 l=5]  *movsi_internal/0
+	subl	%r13d, %eax	# 97	[c=4 l=3]  *subsi_1/0
+	cmpl	%ebp, %eax	# 98	[c=4 l=2]  *cmpsi_1/0
+	jnb	.L219	# 99	[c=13 l=6]  *jcc
+	movq	1040(%rbx), %rax	# 126	[c=9 l=7]  *movdi_internal/3
+	jmp	.L220	# 647	[c=1 l=5]  jump
+	.p2align 4,,10
+	.p2align 3
+.L244:
+	cmpb	$1, %al	# 376	[c=4 l=2]  *cmpqi_1/0
+	je	.L246	# 377	[c=13 l=6]  *jcc
+	movl	%r13d, %edx	# 379	[c=4 l=3]  *movsi_internal/0
+	movl	$63, %esi	# 380	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 381	[c=4 l=3]  *movdi_internal/3
+	call	data_write_mapped	# 382	[c=0 l=5]  *call
+	jmp	.L245	# 649	[c=1 l=5]  jump
+.L259:
+	movl	%ebp, %esi	# 148	[c=4 l=2]  *movsi_internal/0
+	movq	%rbx, %rdi	# 149	[c=4 l=3]  *movdi_internal/3
+	call	stack_overflow	# 150	[c=0 l=5]  *call
+	.cfi_endproc
+.LFE209:
+	.size	do_events, .-do_events
+	.section	.rodata.str1.1
+.LC34:
+	.string	"(R%d)->%04x "
+.LC35:
+	.string	"(R%d)->%02x "
+.LC36:
+	.string	"(R%d)<-%02x "
+.LC37:
+	.string	"(R%d)<-%04x "
+	.text
+	.p2align 4
+	.type	ramp_indirect, @function
+ramp_indirect:
+.LFB77:
+	.cfi_startproc
+	pushq	%r15	# 524	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	leal	1(%rdx), %eax	# 512	[c=4 l=3]  *leasi
+	pushq	%r14	# 525	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	cltq	# 26	[c=4 l=2]  *extendsidi2_rex64/0
+	movl	%r9d, %r14d	# 7	[c=4 l=3]  *movsi_internal/0
+	pushq	%r13	# 526	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	movq	%rdi, %r13	# 2	[c=4 l=3]  *movdi_internal/3
+	pushq	%r12	# 527	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	movslq	%esi, %r12	# 3	[c=4 l=3]  *extendsidi2_rex64/1
+	leaq	.LC34(%rip), %rsi	# 34	[c=1 l=7]  *movdi_internal/4
+	pushq	%rbp	# 528	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	movl	%edx, %ebp	# 4	[c=4 l=2]  *movsi_internal/0
+	pushq	%rbx	# 529	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	leal	-26(%rdx), %ebx	# 511	[c=4 l=3]  *leasi
+	sarl	%ebx	# 23	[c=4 l=2]  *ashrsi3_1/0
+	addl	$57, %ebx	# 24	[c=4 l=3]  *addsi_1/0
+	subq	$56, %rsp	# 530	[c=4 l=4]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_def_cfa_offset 112
+	movzbl	1004(%rdi,%rax), %r15d	# 27	[c=14 l=9]  *zero_extendqisi2/0
+	movq	%rax, 32(%rsp)	# 486	[c=4 l=5]  *movdi_internal/5
+	movslq	%edx, %rax	# 29	[c=4 l=3]  *extendsidi2_rex64/1
+	movq	%rax, 24(%rsp)	# 485	[c=4 l=5]  *movdi_internal/5
+	movzbl	1004(%rdi,%rax), %eax	# 30	[c=14 l=8]  *zero_extendqisi2/0
+	sall	$8, %r15d	# 28	[c=4 l=4]  *ashlsi3_1/0
+	movl	%ecx, (%rsp)	# 5	[c=4 l=3]  *movsi_internal/1
+	orl	%eax, %r15d	# 31	[c=4 l=3]  *iorsi_1/0
+	xorl	%eax, %eax	# 559	[c=4 l=2]  *movdi_xor
+	movl	%r8d, 4(%rsp)	# 6	[c=4 l=5]  *movsi_internal/1
+	movl	%r15d, %ecx	# 32	[c=4 l=3]  *movsi_internal/0
+	call	log_append@PLT	# 38	[c=0 l=5]  *call
+	movslq	%ebx, %rax	# 39	[c=4 l=3]  *extendsidi2_rex64/1
+	movq	%r13, %rdi	# 46	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC25(%rip), %rsi	# 44	[c=1 l=7]  *movdi_internal/4
+	movq	%rax, %rdx	# 429	[c=4 l=3]  *movdi_internal/3
+	movq	%rax, 16(%rsp)	# 484	[c=4 l=5]  *movdi_internal/5
+	movq	1040(%r13), %rax	# 40	[c=9 l=7]  *movdi_internal/3
+	movzbl	(%rax,%rdx), %eax	# 41	[c=13 l=4]  *zero_extendqisi2/0
+	movl	%ebx, %edx	# 43	[c=4 l=2]  *movsi_internal/0
+	movl	%eax, %ecx	# 42	[c=4 l=2]  *movsi_internal/0
+	movl	%eax, 8(%rsp)	# 482	[c=4 l=4]  *movsi_internal/1
+	call	log_add_data_mov@PLT	# 47	[c=0 l=5]  *call
+	movl	8(%rsp), %eax	# 483	[c=9 l=4]  *movsi_internal/0
+	sall	$16, %eax	# 48	[c=4 l=3]  *ashlsi3_1/0
+	orl	%r15d, %eax	# 49	[c=4 l=3]  *iorsi_1/0
+	movl	%eax, %edi	# 432	[c=4 l=2]  *movsi_internal/0
+	movl	%eax, 8(%rsp)	# 479	[c=4 l=4]  *movsi_internal/1
+	xorl	%eax, %eax	# 560	[c=4 l=2]  *movsi_xor
+	cmpl	$-1, (%rsp)	# 561	[c=9 l=4]  *cmpsi_1/0
+	sete	%al	# 562	[c=4 l=3]  *setcc_qi_slp
+	subl	%eax, %edi	# 372	[c=4 l=2]  *subsi_1/0
+	movl	4(%rsp), %eax	# 437	[c=9 l=4]  *movsi_internal/0
+	movl	%edi, 12(%rsp)	# 478	[c=4 l=4]  *movsi_internal/1
+	leal	(%rdi,%rax), %r15d	# 515	[c=4 l=4]  *leasi
+	movl	%r15d, %r11d	# 438	[c=4 l=3]  *movsi_internal/0
+	movl	%r15d, %r8d	# 440	[c=4 l=3]  *movsi_internal/0
+	andl	$16777215, %r11d	# 57	[c=4 l=7]  *andsi_1/0
+	andl	$16711680, %r8d	# 58	[c=4 l=7]  *andsi_1/0
+	testb	%r14b, %r14b	# 59	[c=4 l=3]  *cmpqi_ccno_1/0
+	jne	.L304	# 60	[c=13 l=6]  *jcc
+	testl	%r8d, %r8d	# 168	[c=4 l=3]  *cmpsi_ccno_1/0
+	jne	.L274	# 169	[c=13 l=2]  *jcc
+	movl	%r11d, %eax	# 449	[c=4 l=3]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 171	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 172	[c=13 l=7]  *cmpsi_1/1
+	jb	.L275	# 173	[c=13 l=2]  *jcc
+	movl	%r11d, %eax	# 451	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %eax	# 175	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 416	[c=5 l=5]  *andsi_1_zext
+	cmpb	$0, 1080(%r13,%rax)	# 178	[c=14 l=9]  *cmpqi_ccno_1/1
+	jne	.L276	# 179	[c=13 l=6]  *jcc
+.L275:
+	movq	1040(%r13), %rdx	# 183	[c=9 l=7]  *movdi_internal/3
+	movslq	%r11d, %rax	# 182	[c=4 l=3]  *extendsidi2_rex64/1
+	movzbl	(%rdx,%rax), %ecx	# 184	[c=13 l=4]  *zero_extendqisi2/0
+	movl	%ecx, 40(%rsp)	# 13	[c=4 l=4]  *movsi_internal/1
+	movl	%ecx, %r14d	# 522	[c=4 l=3]  *movsi_internal/0
+.L277:
+	cmpl	$63, %r11d	# 379	[c=4 l=4]  *cmpsi_1/0
+	leaq	.LC25(%rip), %rax	# 422	[c=1 l=7]  *movdi_internal/4
+	movl	%r11d, %edx	# 204	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 206	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC33(%rip), %rsi	# 421	[c=1 l=7]  *movdi_internal/4
+	cmovne	%rax, %rsi	# 380	[c=8 l=4]  *movdicc_noc/1
+	call	log_add_data_mov@PLT	# 207	[c=0 l=5]  *call
+	jmp	.L279	# 564	[c=1 l=2]  jump
+	.p2align 4,,10
+	.p2align 3
+.L274:
+	movl	%r15d, %eax	# 454	[c=4 l=3]  *movsi_internal/0
+	movq	1072(%r13), %rdx	# 215	[c=9 l=7]  *movdi_internal/3
+	leaq	.LC25(%rip), %rsi	# 541	[c=1 l=7]  *movdi_internal/4
+	sarl	$12, %eax	# 212	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 415	[c=5 l=5]  *andsi_1_zext
+	movq	(%rdx,%rax,8), %rax	# 216	[c=10 l=4]  *movdi_internal/3
+	testq	%rax, %rax	# 217	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L291	# 218	[c=13 l=6]  *jcc
+	movl	%r15d, %edx	# 457	[c=4 l=3]  *movsi_internal/0
+	andl	$4095, %edx	# 414	[c=5 l=6]  *andsi_1_zext
+	movzbl	(%rax,%rdx), %eax	# 222	[c=13 l=4]  *zero_extendqisi2/0
+	movl	%eax, 40(%rsp)	# 459	[c=4 l=4]  *movsi_internal/1
+	movl	%eax, %r14d	# 523	[c=4 l=3]  *movsi_internal/0
+.L280:
+	movl	40(%rsp), %ecx	# 226	[c=9 l=4]  *movsi_internal/0
+	movl	%r11d, %edx	# 227	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 230	[c=4 l=3]  *movdi_internal/3
+	call	log_add_data_mov@PLT	# 231	[c=0 l=5]  *call
+.L279:
+	movl	40(%rsp), %ecx	# 234	[c=9 l=4]  *movsi_internal/0
+	movl	%r12d, %edx	# 235	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC36(%rip), %rsi	# 236	[c=1 l=7]  *movdi_internal/4
+	xorl	%eax, %eax	# 556	[c=4 l=2]  *movdi_xor
+	movq	%r13, %rdi	# 238	[c=4 l=3]  *movdi_internal/3
+	call	log_append@PLT	# 240	[c=0 l=5]  *call
+	movb	%r14b, 1004(%r13,%r12)	# 242	[c=4 l=8]  *movqi_internal/8
+.L270:
+	movl	(%rsp), %eax	# 499	[c=5 l=3]  *movsi_internal/0
+	testl	%eax, %eax	# 250	[c=4 l=2]  *cmpsi_ccno_1/0
+	js	.L281	# 251	[c=13 l=6]  *jcc
+	movl	4(%rsp), %edx	# 554	[c=9 l=4]  *movsi_internal/0
+	testl	%edx, %edx	# 555	[c=4 l=2]  *cmpsi_ccno_1/0
+	jne	.L281	# 255	[c=13 l=6]  *jcc
+	subq	$1, 48(%r13)	# 257	[c=13 l=5]  *adddi_1/0
+	cmpl	$1, %eax	# 258	[c=4 l=3]  *cmpsi_1/0
+	jne	.L282	# 259	[c=13 l=2]  *jcc
+.L284:
+	movl	12(%rsp), %r15d	# 463	[c=9 l=5]  *movsi_internal/0
+	addl	$1, %r15d	# 261	[c=4 l=4]  *addsi_1/0
+.L283:
+	movzwl	%r15w, %ecx	# 274	[c=4 l=4]  *zero_extendhisi2/0
+	xorl	%eax, %eax	# 553	[c=4 l=2]  *movdi_xor
+	movl	%ebp, %edx	# 276	[c=4 l=2]  *movsi_internal/0
+	movq	%r13, %rdi	# 279	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC37(%rip), %rsi	# 277	[c=1 l=7]  *movdi_internal/4
+	call	log_append@PLT	# 281	[c=0 l=5]  *call
+	movq	24(%rsp), %rax	# 467	[c=9 l=5]  *movdi_internal/3
+	movq	32(%rsp), %rcx	# 468	[c=9 l=5]  *movdi_internal/3
+	movb	%r15b, 1004(%r13,%rax)	# 283	[c=4 l=8]  *movqi_internal/8
+	movl	%r15d, %eax	# 470	[c=4 l=3]  *movsi_internal/0
+	movzbl	%ah, %eax	# 286	[c=4 l=3]  *extzvqi/0
+	movb	%al, 1004(%r13,%rcx)	# 469	[c=4 l=8]  *movqi_internal/8
+.L282:
+	movl	8(%rsp), %eax	# 471	[c=9 l=4]  *movsi_internal/0
+	xorl	%r15d, %eax	# 289	[c=4 l=3]  *xorsi_1/0
+	cmpl	$65535, %eax	# 292	[c=4 l=5]  *cmpsi_1/0
+	jbe	.L263	# 293	[c=13 l=2]  *jcc
+	sarl	$16, %r15d	# 295	[c=4 l=4]  *ashrsi3_1/0
+	movl	%ebx, %edx	# 298	[c=4 l=2]  *movsi_internal/0
+	leaq	.LC30(%rip), %rsi	# 299	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 301	[c=4 l=3]  *movdi_internal/3
+	movzbl	%r15b, %ecx	# 296	[c=4 l=4]  *zero_extendqisi2/0
+	movl	%r15d, %ebp	# 474	[c=4 l=3]  *movsi_internal/0
+	call	log_add_data_mov@PLT	# 302	[c=0 l=5]  *call
+	movl	%ebx, %eax	# 475	[c=4 l=2]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 303	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 304	[c=13 l=7]  *cmpsi_1/1
+	jb	.L286	# 305	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%r13)	# 307	[c=13 l=8]  *cmpqi_ccno_1/1
+	jne	.L287	# 308	[c=13 l=6]  *jcc
+.L286:
+	movq	1040(%r13), %rax	# 311	[c=9 l=7]  *movdi_internal/3
+	movq	16(%rsp), %rbx	# 477	[c=9 l=5]  *movdi_internal/3
+	movb	%bpl, (%rax,%rbx)	# 312	[c=4 l=4]  *movqi_internal/8
+.L263:
+	addq	$56, %rsp	# 533	[c=4 l=4]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx	# 534	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 48
+	popq	%rbp	# 535	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 40
+	popq	%r12	# 536	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 32
+	popq	%r13	# 537	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 24
+	popq	%r14	# 538	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 16
+	popq	%r15	# 539	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 8
+	ret		# 540	[c=0 l=1]  simple_return_internal
+	.p2align 4,,10
+	.p2align 3
+.L281:
+	.cfi_restore_state
+	movl	(%rsp), %eax	# 500	[c=5 l=3]  *movsi_internal/0
+	cmpl	$1, %eax	# 267	[c=4 l=3]  *cmpsi_1/0
+	je	.L284	# 268	[c=13 l=6]  *jcc
+	movl	12(%rsp), %r15d	# 19	[c=9 l=5]  *movsi_internal/0
+	testl	%eax, %eax	# 270	[c=4 l=2]  *cmpsi_ccno_1/0
+	je	.L282	# 271	[c=13 l=6]  *jcc
+	jmp	.L283	# 567	[c=1 l=5]  jump
+	.p2align 4,,10
+	.p2align 3
+.L304:
+	movslq	%r12d, %r14	# 62	[c=4 l=3]  *extendsidi2_rex64/1
+	movl	%r12d, %edx	# 65	[c=4 l=3]  *movsi_internal/0
+	xorl	%eax, %eax	# 558	[c=4 l=2]  *movdi_xor
+	movq	%r13, %rdi	# 68	[c=4 l=3]  *movdi_internal/3
+	movzbl	1004(%r13,%r14), %ecx	# 63	[c=14 l=9]  *zero_extendqisi2/0
+	leaq	.LC35(%rip), %rsi	# 66	[c=1 l=7]  *movdi_internal/4
+	movl	%r8d, 44(%rsp)	# 493	[c=4 l=5]  *movsi_internal/1
+	movl	%r11d, 40(%rsp)	# 491	[c=4 l=5]  *movsi_internal/1
+	call	log_append@PLT	# 70	[c=0 l=5]  *call
+	movl	44(%rsp), %r8d	# 494	[c=9 l=5]  *movsi_internal/0
+	movl	40(%rsp), %r11d	# 492	[c=9 l=5]  *movsi_internal/0
+	movzbl	1004(%r13,%r14), %r14d	# 72	[c=14 l=9]  *zero_extendqisi2/0
+	testl	%r8d, %r8d	# 74	[c=4 l=3]  *cmpsi_ccno_1/0
+	movl	%r14d, %r12d	# 521	[c=4 l=3]  *movsi_internal/0
+	jne	.L266	# 75	[c=13 l=6]  *jcc
+	cmpl	$63, %r11d	# 375	[c=4 l=4]  *cmpsi_1/0
+	movl	%r11d, %edx	# 83	[c=4 l=3]  *movsi_internal/0
+	movl	%r14d, %ecx	# 82	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 85	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC30(%rip), %rax	# 420	[c=1 l=7]  *movdi_internal/4
+	leaq	.LC29(%rip), %rsi	# 419	[c=1 l=7]  *movdi_internal/4
+	cmovne	%rax, %rsi	# 376	[c=8 l=4]  *movdicc_noc/1
+	call	log_add_data_mov@PLT	# 86	[c=0 l=5]  *call
+	movslq	40(%rsp), %r11	# 490	[c=13 l=5]  *extendsidi2_rex64/1
+	movl	%r11d, %eax	# 442	[c=4 l=3]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 87	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 88	[c=13 l=7]  *cmpsi_1/1
+	jb	.L268	# 89	[c=13 l=2]  *jcc
+	movl	%r11d, %eax	# 444	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %eax	# 91	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 418	[c=5 l=5]  *andsi_1_zext
+	cmpb	$0, 1080(%r13,%rax)	# 94	[c=14 l=9]  *cmpqi_ccno_1/1
+	jne	.L269	# 95	[c=13 l=6]  *jcc
+.L268:
+	movq	1040(%r13), %rax	# 99	[c=9 l=7]  *movdi_internal/3
+	movb	%r12b, (%rax,%r11)	# 100	[c=4 l=4]  *movqi_internal/8
+	jmp	.L270	# 569	[c=1 l=5]  jump
+	.p2align 4,,10
+	.p2align 3
+.L276:
+	movl	%r11d, %esi	# 190	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 191	[c=4 l=3]  *movdi_internal/3
+	movl	%r11d, 44(%rsp)	# 497	[c=4 l=5]  *movsi_internal/1
+	call	data_read_page	# 192	[c=10 l=5]  *call_value
+	movl	44(%rsp), %r11d	# 498	[c=9 l=5]  *movsi_internal/0
+	movl	%eax, %ecx	# 193	[c=4 l=2]  *movsi_internal/0
+	movl	%eax, %r14d	# 194	[c=4 l=3]  *movqi_internal/2
+	movzbl	%al, %eax	# 195	[c=4 l=3]  *zero_extendqisi2/0
+	movl	%eax, 40(%rsp)	# 453	[c=4 l=4]  *movsi_internal/1
+	jmp	.L277	# 571	[c=1 l=5]  jump
+	.p2align 4,,10
+	.p2align 3
+.L266:
+	movl	%r14d, %ecx	# 113	[c=4 l=3]  *movsi_internal/0
+	movl	%r11d, %edx	# 114	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC30(%rip), %rsi	# 115	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 117	[c=4 l=3]  *movdi_internal/3
+	movl	%r11d, 40(%rsp)	# 495	[c=4 l=5]  *movsi_internal/1
+	call	log_add_data_mov@PLT	# 118	[c=0 l=5]  *call
+	movl	40(%rsp), %r11d	# 496	[c=9 l=5]  *movsi_internal/0
+	movq	1072(%r13), %rax	# 122	[c=9 l=7]  *movdi_internal/3
+	sarl	$12, %r11d	# 119	[c=4 l=4]  *ashrsi3_1/0
+	movslq	%r11d, %r11	# 120	[c=4 l=3]  *extendsidi2_rex64/1
+	leaq	(%rax,%r11,8), %r14	# 123	[c=8 l=4]  *leadi
+	movq	(%r14), %rax	# 124	[c=5 l=3]  *movdi_internal/3
+	testq	%rax, %rax	# 125	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L305	# 126	[c=13 l=2]  *jcc
+.L271:
+	movl	%r15d, %edx	# 447	[c=4 l=3]  *movsi_internal/0
+	andl	$4095, %edx	# 417	[c=5 l=6]  *andsi_1_zext
+	movb	%r12b, (%rax,%rdx)	# 163	[c=4 l=4]  *movqi_internal/8
+	jmp	.L270	# 574	[c=1 l=5]  jump
+	.p2align 4,,10
+	.p2align 3
+.L287:
+	addq	$56, %rsp	# 545	[c=4 l=4]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	movl	%r15d, %edx	# 317	[c=4 l=3]  *movsi_internal/0
+	movl	%ebx, %esi	# 318	[c=4 l=2]  *movsi_internal/0
+	movq	%r13, %rdi	# 319	[c=4 l=3]  *movdi_internal/3
+	popq	%rbx	# 546	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 48
+	popq	%rbp	# 547	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 40
+	popq	%r12	# 548	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 32
+	popq	%r13	# 549	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 24
+	popq	%r14	# 550	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 16
+	popq	%r15	# 551	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 8
+	jmp	data_write_page	# 320	[c=0 l=5]  *sibcall
+	.p2align 4,,10
+	.p2align 3
+.L291:
+	.cfi_restore_state
+	movl	$0, 40(%rsp)	# 17	[c=4 l=8]  *movsi_internal/1
+	xorl	%r14d, %r14d	# 557	[c=4 l=3]  *movdi_xor
+	jmp	.L280	# 576	[c=1 l=5]  jump
+	.p2align 4,,10
+	.p2align 3
+.L269:
+	movl	%r14d, %edx	# 105	[c=4 l=3]  *movsi_internal/0
+	movl	%r11d, %esi	# 106	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 107	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 108	[c=0 l=5]  *call
+	jmp	.L270	# 578	[c=1 l=5]  jump
+	.p2align 4,,10
+	.p2align 3
+.L305:
+	movl	$4128, %esi	# 128	[c=4 l=5]  *movdi_internal/2
+	movl	$1, %edi	# 129	[c=4 l=5]  *movdi_internal/2
+	call	calloc@PLT	# 130	[c=10 l=5]  *call_value
+	testq	%rax, %rax	# 133	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L306	# 134	[c=13 l=2]  *jcc
+	movq	984(%r13), %rdx	# 148	[c=9 l=7]  *movdi_internal/3
+	movq	%rdx, (%rax)	# 149	[c=4 l=3]  *movdi_internal/5
+	testq	%rdx, %rdx	# 150	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L273	# 151	[c=13 l=2]  *jcc
+	movq	%rax, 8(%rdx)	# 153	[c=4 l=4]  *movdi_internal/5
+.L273:
+	movq	%rax, 984(%r13)	# 156	[c=4 l=7]  *movdi_internal/5
+	addq	$32, %rax	# 157	[c=4 l=4]  *adddi_1/0
+	movq	%rax, (%r14)	# 158	[c=4 l=3]  *movdi_internal/5
+	jmp	.L271	# 581	[c=1 l=5]  jump
+.L306:
+	leaq	.LC27(%rip), %r9	# 136	[c=1 l=7]  *movdi_internal/4
+	movl	$1, %r8d	# 137	[c=4 l=6]  *movsi_internal/0
+	movq	%r13, %rdi	# 142	[c=4 l=3]  *movdi_internal/3
+	movl	$4096, %ecx	# 138	[c=4 l=5]  *movsi_internal/0
+	leaq	.LC28(%rip), %rdx	# 139	[c=1 l=7]  *movdi_internal/4
+	movl	$6, %esi	# 141	[c=4 l=5]  *movsi_internal/0
+	call	leave	# 144	[c=0 l=5]  *call
+	.cfi_endproc
+.LFE77:
+	.size	ramp_indirect, .-ramp_indirect
+	.section	.rodata.str1.1
+.LC38:
+	.string	".word 0x%04x"
+.LC39:
+	.string	"illegal opcode 0x%04x"
+.LC40:
+	.string	"opcode 0x%04x illegal on %s"
+	.section	.rodata.str1.8
+	.align 8
+.LC41:
+	.string	"opcode 0x%04x not yet supported"
+	.section	.rodata.str1.1
+.LC42:
+	.string	"in func_ILLEGAL"
+	.section	.rodata.str1.8
+	.align 8
+.LC43:
+	.string	"%-7s .word 0x%04x: undefined operand combination: %s overlaps R%d"
+	.align 8
+.LC44:
+	.string	"opcode 0x%04x has undefined result (%s overlaps R%d)"
+	.section	.rodata.str1.1
+.LC45:
+	.string	"#%d: "
+.LC46:
+	.string	"not implemented "
+.LC47:
+	.string	"IRQ %d in %u cycles"
+.LC48:
+	.string	"bad IRQ vector %d"
+.LC49:
+	.string	"-no-args "
+.LC51:
+	.string	"-args ... "
+.LC52:
+	.string	"stdin "
+.LC53:
+	.string	"-no-stdin"
+.LC54:
+	.string	"stdout "
+.LC55:
+	.string	"-no-stdout"
+.LC56:
+	.string	"exit %d: "
+.LC57:
+	.string	"exit %d function called"
+.LC58:
+	.string	"abort"
+.LC59:
+	.string	"abort function called"
+	.section	.rodata.str1.8
+	.align 8
+.LC60:
+	.string	"instruction count limit reached"
+	.section	.rodata.str1.1
+.LC61:
+	.string	"(###)->%02x "
+.LC62:
+	.string	"{erase %05x} "
+.LC63:
+	.string	"{write %05x} "
+	.section	.rodata.str1.8
+	.align 8
+.LC64:
+	.string	"infinite loop detected (normal exit)"
+	.align 8
+.LC65:
+	.string	"deadlock: sleeping with no wake source"
+	.section	.rodata.str1.1
+.LC66:
+	.string	"slept %lu cycles "
+	.text
+	.p2align 4
+	.type	execute, @function
+execute:
+.LFB213:
+	.cfi_startproc
+	pushq	%r15	# 19249	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14	# 19250	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13	# 19251	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	movq	%rdi, %r13	# 2	[c=4 l=3]  *movdi_internal/3
+	pushq	%r12	# 19252	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp	# 19253	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx	# 19254	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$56, %rsp	# 19255	[c=4 l=4]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_def_cfa_offset 112
+	movq	32(%rdi), %rax	# 138	[c=9 l=4]  *movdi_internal/3
+	movq	%rax, (%rsp)	# 17078	[c=4 l=4]  *movdi_internal/5
+	call	log_is_idle@PLT	# 140	[c=10 l=5]  *call_value
+	testb	%al, %al	# 142	[c=4 l=2]  *cmpqi_ccno_1/0
+	jne	.L1493	# 143	[c=13 l=2]  *jcc
+.L308:
+	movl	0(%r13), %ebx	# 154	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 159	[c=4 l=3]  *movdi_internal/3
+	leaq	opcodes(%rip), %rbp	# 164	[c=1 l=7]  *movdi_internal/4
+	leaq	handler.1(%rip), %r12	# 171	[c=1 l=7]  *movdi_internal/4
+	salq	$4, %rbx	# 155	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 157	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 158	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 160	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 161	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 162	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 165	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 17079	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 166	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 169	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 170	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 20331	[c=10 l=4]  *indirect_jump
+.L1493:
+	movb	$1, 11032(%r13)	# 145	[c=4 l=8]  *movqi_internal/8
+	movzbl	11037(%r13), %esi	# 146	[c=13 l=8]  *zero_extendqisi2/0
+	movq	%r13, %rdi	# 148	[c=4 l=3]  *movdi_internal/3
+	call	execute_lean@PLT	# 149	[c=0 l=5]  *call
+	movq	%r13, %rdi	# 150	[c=4 l=3]  *movdi_internal/3
+	call	perf_lean_resume@PLT	# 151	[c=0 l=5]  *call
+	jmp	.L308	# 20333	[c=1 l=2]  jump
+.L1171:
+	movzbl	10(%rbx), %r14d	# 14123	[c=13 l=5]  zero_extendqidi2/0
+	xorl	%eax, %eax	# 19888	[c=4 l=2]  *movdi_xor
+	leaq	.LC35(%rip), %rsi	# 14128	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 14130	[c=4 l=3]  *movdi_internal/3
+	movzbl	1004(%r13,%r14), %ecx	# 14125	[c=14 l=9]  *zero_extendqisi2/0
+	movq	%r14, %rdx	# 19248	[c=4 l=3]  *movdi_internal/3
+	movl	%r14d, 8(%rsp)	# 18635	[c=4 l=5]  *movsi_internal/1
+	call	log_append@PLT	# 14132	[c=0 l=5]  *call
+	movzwl	1034(%r13), %r15d	# 14135	[c=13 l=8]  *zero_extendhisi2/0
+	movl	$30, %edx	# 14137	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 14140	[c=4 l=3]  *movdi_internal/3
+	movzbl	1004(%r13,%r14), %eax	# 14134	[c=14 l=9]  *zero_extendqisi2/0
+	leaq	.LC34(%rip), %rsi	# 14138	[c=1 l=7]  *movdi_internal/4
+	movl	%r15d, %ecx	# 14136	[c=4 l=3]  *movsi_internal/0
+	movl	%eax, 16(%rsp)	# 18082	[c=4 l=4]  *movsi_internal/1
+	xorl	%eax, %eax	# 19889	[c=4 l=2]  *movdi_xor
+	call	log_append@PLT	# 14142	[c=0 l=5]  *call
+	cmpb	$0, 844(%r13)	# 14143	[c=13 l=8]  *cmpqi_ccno_1/1
+	jne	.L1494	# 14144	[c=13 l=6]  *jcc
+.L1172:
+	movl	%r15d, %eax	# 18083	[c=4 l=3]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 14162	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 14163	[c=13 l=7]  *cmpsi_1/1
+	jb	.L1174	# 14164	[c=13 l=2]  *jcc
+	movl	%r15d, %eax	# 18085	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %eax	# 14166	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 16853	[c=5 l=5]  *andsi_1_zext
+	cmpb	$0, 1080(%r13,%rax)	# 14169	[c=14 l=9]  *cmpqi_ccno_1/1
+	jne	.L1175	# 14170	[c=13 l=6]  *jcc
+.L1174:
+	movq	1040(%r13), %rdx	# 14174	[c=9 l=7]  *movdi_internal/3
+	movslq	%r15d, %rax	# 14173	[c=4 l=3]  *extendsidi2_rex64/1
+	movzbl	(%rdx,%rax), %r9d	# 14175	[c=13 l=5]  *zero_extendqisi2/0
+.L1176:
+	cmpl	$63, %r15d	# 14186	[c=4 l=4]  *cmpsi_1/0
+	je	.L1495	# 14187	[c=13 l=6]  *jcc
+	movl	%r9d, %ecx	# 14496	[c=4 l=3]  *movsi_internal/0
+	movl	%r15d, %edx	# 14497	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC25(%rip), %rsi	# 14498	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 14500	[c=4 l=3]  *movdi_internal/3
+	movl	%r9d, 24(%rsp)	# 18692	[c=4 l=5]  *movsi_internal/1
+	call	log_add_data_mov@PLT	# 14501	[c=0 l=5]  *call
+	movl	24(%rsp), %r9d	# 18693	[c=9 l=5]  *movsi_internal/0
+	movl	8(%rsp), %edx	# 14505	[c=9 l=4]  *movsi_internal/0
+	xorl	%eax, %eax	# 19877	[c=4 l=2]  *movdi_xor
+	leaq	.LC36(%rip), %rsi	# 14506	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 14508	[c=4 l=3]  *movdi_internal/3
+	movzbl	%r9b, %ecx	# 14503	[c=4 l=4]  *zero_extendqisi2/0
+	movb	%r9b, 32(%rsp)	# 18690	[c=4 l=5]  *movqi_internal/8
+	call	log_append@PLT	# 14510	[c=0 l=5]  *call
+	movl	16(%rsp), %eax	# 18117	[c=9 l=4]  *movsi_internal/0
+	movl	24(%rsp), %r9d	# 18689	[c=9 l=5]  *movsi_internal/0
+	leaq	.LC30(%rip), %rsi	# 135	[c=1 l=7]  *movdi_internal/4
+	movzbl	32(%rsp), %r11d	# 18691	[c=9 l=6]  *movqi_internal/4
+	xorl	%r9d, %eax	# 14511	[c=4 l=3]  *xorsi_1/0
+	movl	%eax, 8(%rsp)	# 18687	[c=4 l=4]  *movsi_internal/1
+	movzbl	%al, %ecx	# 14512	[c=4 l=3]  *zero_extendqisi2/0
+.L1186:
+	movb	%r11b, 1004(%r13,%r14)	# 14235	[c=4 l=8]  *movqi_internal/8
+	movl	%r15d, %edx	# 14237	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 14239	[c=4 l=3]  *movdi_internal/3
+	call	log_add_data_mov@PLT	# 14240	[c=0 l=5]  *call
+	movl	%r15d, %eax	# 18094	[c=4 l=3]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 14241	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 14242	[c=13 l=7]  *cmpsi_1/1
+	jb	.L1181	# 14243	[c=13 l=2]  *jcc
+	movl	%r15d, %eax	# 18096	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %eax	# 14245	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 16851	[c=5 l=5]  *andsi_1_zext
+	cmpb	$0, 1080(%r13,%rax)	# 14248	[c=14 l=9]  *cmpqi_ccno_1/1
+	jne	.L1182	# 14249	[c=13 l=6]  *jcc
+.L1181:
+	movq	1040(%r13), %rax	# 14253	[c=9 l=7]  *movdi_internal/3
+	movzbl	8(%rsp), %edi	# 18098	[c=9 l=5]  *movqi_internal/4
+	movslq	%r15d, %r8	# 14252	[c=4 l=3]  *extendsidi2_rex64/1
+	movb	%dil, (%rax,%r8)	# 14254	[c=4 l=4]  *movqi_internal/8
+.L1180:
+	movq	%r13, %rdi	# 14266	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 14265	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 14267	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 18099	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 18100	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 14269	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18732	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 14270	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 14272	[c=4 l=3]  *cmpdi_1/0
+	jb	.L344	# 14273	[c=13 l=6]  *jcc
+	movl	0(%r13), %ebx	# 14275	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 14280	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 14276	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 14278	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 14279	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 14281	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 14282	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 14283	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 14286	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 18101	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 14287	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 14290	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 14291	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 19885	[c=10 l=4]  *indirect_jump
+.L310:
+	movl	0(%r13), %esi	# 178	[c=5 l=4]  *movsi_internal/0
+	movq	%r13, %rdi	# 179	[c=4 l=3]  *movdi_internal/3
+	call	bad_PC	# 180	[c=0 l=5]  *call
+.L359:
+	movzwl	12(%rbx), %r9d	# 1113	[c=13 l=5]  *zero_extendhisi2/0
+	movzbl	10(%rbx), %r15d	# 1114	[c=13 l=5]  *zero_extendqisi2/0
+	xorl	%eax, %eax	# 20269	[c=4 l=2]  *movdi_xor
+	movq	%r13, %rdi	# 1118	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC61(%rip), %rsi	# 1116	[c=1 l=7]  *movdi_internal/4
+	movl	%r9d, %edx	# 1115	[c=4 l=3]  *movsi_internal/0
+	movl	%r9d, 8(%rsp)	# 18169	[c=4 l=5]  *movsi_internal/1
+	call	log_append@PLT	# 1120	[c=0 l=5]  *call
+	leal	1(%r15), %r8d	# 18892	[c=4 l=4]  *leasi
+	movslq	%r15d, %r11	# 1125	[c=4 l=3]  *extendsidi2_rex64/1
+	movl	%r15d, %edx	# 1129	[c=4 l=3]  *movsi_internal/0
+	movslq	%r8d, %r8	# 1122	[c=4 l=3]  *extendsidi2_rex64/1
+	leaq	.LC34(%rip), %rsi	# 1130	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 1132	[c=4 l=3]  *movdi_internal/3
+	movq	%r11, 24(%rsp)	# 18165	[c=4 l=5]  *movdi_internal/5
+	movzbl	1004(%r13,%r8), %r14d	# 1123	[c=14 l=9]  *zero_extendqisi2/0
+	movq	%r8, 32(%rsp)	# 18167	[c=4 l=5]  *movdi_internal/5
+	movzbl	1004(%r13,%r11), %eax	# 1126	[c=14 l=9]  *zero_extendqisi2/0
+	sall	$8, %r14d	# 1124	[c=4 l=4]  *ashlsi3_1/0
+	orl	%eax, %r14d	# 1127	[c=4 l=3]  *iorsi_1/0
+	xorl	%eax, %eax	# 20270	[c=4 l=2]  *movdi_xor
+	movl	%r14d, %ecx	# 1128	[c=4 l=3]  *movsi_internal/0
+	call	log_append@PLT	# 1134	[c=0 l=5]  *call
+	movl	8(%rsp), %r9d	# 18170	[c=9 l=5]  *movsi_internal/0
+	movl	%r14d, %r10d	# 17111	[c=4 l=3]  *movsi_internal/0
+	movl	%r15d, %edx	# 1138	[c=4 l=3]  *movsi_internal/0
+	xorl	%eax, %eax	# 20271	[c=4 l=2]  *movdi_xor
+	leaq	.LC37(%rip), %rsi	# 1139	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 1141	[c=4 l=3]  *movdi_internal/3
+	subl	%r9d, %r10d	# 1135	[c=4 l=3]  *subsi_1/0
+	movzwl	%r10w, %ecx	# 1136	[c=4 l=4]  *zero_extendhisi2/0
+	movl	%r10d, 16(%rsp)	# 18163	[c=4 l=5]  *movsi_internal/1
+	movl	%ecx, 8(%rsp)	# 18161	[c=4 l=4]  *movsi_internal/1
+	call	log_append@PLT	# 1143	[c=0 l=5]  *call
+	movl	16(%rsp), %r10d	# 18164	[c=9 l=5]  *movsi_internal/0
+	movl	%r14d, %eax	# 17115	[c=4 l=3]  *movsi_internal/0
+	movl	8(%rsp), %ecx	# 18162	[c=9 l=4]  *movsi_internal/0
+	movq	24(%rsp), %r11	# 18166	[c=9 l=5]  *movdi_internal/3
+	shrl	$5, %eax	# 1151	[c=4 l=3]  *lshrsi3_1/0
+	movq	32(%rsp), %r8	# 18168	[c=9 l=5]  *movdi_internal/3
+	leaq	flag_update_table_sub8(%rip), %rdx	# 16895	[c=1 l=7]  *movdi_internal/4
+	andl	$1024, %eax	# 1152	[c=4 l=5]  *andsi_1/0
+	movb	%r10b, 1004(%r13,%r11)	# 1145	[c=4 l=8]  *movqi_internal/8
+	sarl	$8, %r10d	# 1146	[c=4 l=4]  *ashrsi3_1/0
+	movl	%r10d, %r15d	# 17114	[c=4 l=3]  *movsi_internal/0
+	movb	%r10b, 1004(%r13,%r8)	# 1148	[c=4 l=8]  *movqi_internal/8
+	andl	$511, %r15d	# 1153	[c=4 l=7]  *andsi_1/0
+	orl	%r15d, %eax	# 1154	[c=4 l=3]  *iorsi_1/0
+	cltq	# 1155	[c=4 l=2]  *extendsidi2_rex64/0
+	movzbl	(%rdx,%rax), %r15d	# 1156	[c=13 l=5]  *zero_extendqisi2/0
+	xorl	%eax, %eax	# 20272	[c=4 l=2]  *movsi_xor
+	testl	%ecx, %ecx	# 20273	[c=4 l=2]  *cmpsi_ccno_1/0
+	setne	%al	# 20274	[c=4 l=3]  *setcc_qi_slp
+	addl	%eax, %eax	# 1160	[c=4 l=2]  *ashlsi3_1/0
+	notl	%eax	# 1161	[c=4 l=2]  *one_cmplsi2_1/0
+	andl	%eax, %r15d	# 1162	[c=4 l=3]  *andsi_1/0
+	movl	$63, %eax	# 1164	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 1165	[c=13 l=7]  *subsi_1/1
+	andl	$-33, %r15d	# 1163	[c=4 l=4]  *andsi_1/0
+	cmpl	5180(%r13), %eax	# 1166	[c=13 l=7]  *cmpsi_1/1
+	jb	.L360	# 1167	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%r13)	# 1169	[c=13 l=8]  *cmpqi_ccno_1/1
+	jne	.L361	# 1170	[c=13 l=6]  *jcc
+.L360:
+	movq	1040(%r13), %rax	# 1173	[c=9 l=7]  *movdi_internal/3
+	movzbl	63(%rax), %r14d	# 1174	[c=13 l=5]  *zero_extendqisi2/0
+.L362:
+	movl	%r14d, %ecx	# 1185	[c=4 l=3]  *movsi_internal/0
+	andl	$-32, %r14d	# 1191	[c=4 l=4]  *andsi_1/0
+	movl	$63, %edx	# 1186	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 1189	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC33(%rip), %rsi	# 1187	[c=1 l=7]  *movdi_internal/4
+	orl	%r15d, %r14d	# 1192	[c=4 l=3]  *iorsi_1/0
+	call	log_add_data_mov@PLT	# 1190	[c=0 l=5]  *call
+	movzbl	%r14b, %ecx	# 1193	[c=4 l=4]  *zero_extendqisi2/0
+	movl	$63, %edx	# 1195	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 1198	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC29(%rip), %rsi	# 1196	[c=1 l=7]  *movdi_internal/4
+	call	log_add_data_mov@PLT	# 1199	[c=0 l=5]  *call
+	movl	$63, %eax	# 1200	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 1201	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 1202	[c=13 l=7]  *cmpsi_1/1
+	jb	.L363	# 1203	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%r13)	# 1205	[c=13 l=8]  *cmpqi_ccno_1/1
+	jne	.L364	# 1206	[c=13 l=6]  *jcc
+.L363:
+	movq	1040(%r13), %rax	# 1209	[c=9 l=7]  *movdi_internal/3
+	movb	%r14b, 63(%rax)	# 1210	[c=4 l=4]  *movqi_internal/8
+.L365:
+	movq	%r13, %rdi	# 1222	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 1221	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 1223	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 17117	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 17118	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 1225	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18891	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 1226	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 1228	[c=4 l=3]  *cmpdi_1/0
+	jb	.L344	# 1229	[c=13 l=6]  *jcc
+	movl	0(%r13), %ebx	# 1231	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 1236	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 1232	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 1234	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 1235	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 1237	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 1238	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 1239	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 1242	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 17119	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 1243	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 1246	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 1247	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 20268	[c=10 l=4]  *indirect_jump
+.L366:
+	movzbl	10(%rbx), %r8d	# 1256	[c=13 l=5]  zero_extendqidi2/0
+	movzwl	12(%rbx), %r11d	# 1255	[c=13 l=5]  *zero_extendhisi2/0
+	movq	%r13, %rdi	# 1263	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 20264	[c=4 l=2]  *movdi_xor
+	leaq	.LC35(%rip), %rsi	# 1261	[c=1 l=7]  *movdi_internal/4
+	movzbl	1004(%r13,%r8), %ecx	# 1258	[c=14 l=9]  *zero_extendqisi2/0
+	movl	%r8d, %edx	# 1260	[c=4 l=3]  *movsi_internal/0
+	movl	%r11d, 24(%rsp)	# 18179	[c=4 l=5]  *movsi_internal/1
+	movq	%r8, 8(%rsp)	# 18177	[c=4 l=5]  *movdi_internal/5
+	movl	%r8d, 16(%rsp)	# 18175	[c=4 l=5]  *movsi_internal/1
+	call	log_append@PLT	# 1265	[c=0 l=5]  *call
+	movslq	24(%rsp), %r15	# 18180	[c=13 l=5]  *extendsidi2_rex64/1
+	movq	%r13, %rdi	# 1274	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 20265	[c=4 l=2]  *movdi_xor
+	movq	8(%rsp), %r8	# 18178	[c=9 l=5]  *movdi_internal/3
+	leaq	.LC35(%rip), %rsi	# 18174	[c=1 l=7]  *movdi_internal/4
+	movzbl	1004(%r13,%r15), %ecx	# 1269	[c=14 l=9]  *zero_extendqisi2/0
+	movl	%r15d, %edx	# 1271	[c=4 l=3]  *movsi_internal/0
+	movzbl	1004(%r13,%r8), %r14d	# 1267	[c=10 l=9]  *movqi_internal/4
+	call	log_append@PLT	# 1276	[c=0 l=5]  *call
+	movl	16(%rsp), %edx	# 20266	[c=9 l=4]  *movsi_internal/0
+	xorl	%eax, %eax	# 20267	[c=4 l=2]  *movdi_xor
+	movq	%r13, %rdi	# 1284	[c=4 l=3]  *movdi_internal/3
+	andb	1004(%r13,%r15), %r14b	# 1278	[c=14 l=8]  *andqi_1/1
+	leaq	.LC36(%rip), %rsi	# 1282	[c=1 l=7]  *movdi_internal/4
+	movzbl	%r14b, %r15d	# 1279	[c=4 l=4]  zero_extendqidi2/0
+	movl	%r15d, %ecx	# 1280	[c=4 l=3]  *movsi_internal/0
+	call	log_append@PLT	# 1286	[c=0 l=5]  *call
+	movq	8(%rsp), %r8	# 18172	[c=9 l=5]  *movdi_internal/3
+	movl	$63, %eax	# 1289	[c=4 l=5]  *movsi_internal/0
+	movb	%r14b, 1004(%r13,%r8)	# 1288	[c=4 l=8]  *movqi_internal/8
+	subl	5176(%r13), %eax	# 1290	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 1291	[c=13 l=7]  *cmpsi_1/1
+	jb	.L367	# 1292	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%r13)	# 1294	[c=13 l=8]  *cmpqi_ccno_1/1
+	jne	.L368	# 1295	[c=13 l=6]  *jcc
+.L367:
+	movq	1040(%r13), %rax	# 1298	[c=9 l=7]  *movdi_internal/3
+	movzbl	63(%rax), %r14d	# 1299	[c=13 l=5]  *zero_extendqisi2/0
+.L369:
+	movl	%r14d, %ecx	# 1310	[c=4 l=3]  *movsi_internal/0
+	movl	$63, %edx	# 1311	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 1314	[c=4 l=3]  *movdi_internal/3
+	andl	$-31, %r14d	# 1316	[c=4 l=4]  *andsi_1/0
+	leaq	.LC33(%rip), %rsi	# 1312	[c=1 l=7]  *movdi_internal/4
+	call	log_add_data_mov@PLT	# 1315	[c=0 l=5]  *call
+	leaq	flag_update_table_logical(%rip), %rax	# 16896	[c=1 l=7]  *movdi_internal/4
+	movl	$63, %edx	# 1323	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 1326	[c=4 l=3]  *movdi_internal/3
+	movzbl	(%rax,%r15), %eax	# 1319	[c=13 l=5]  *zero_extendqisi2/0
+	leaq	.LC29(%rip), %rsi	# 1324	[c=1 l=7]  *movdi_internal/4
+	orl	%eax, %r14d	# 1320	[c=4 l=3]  *iorsi_1/0
+	movzbl	%r14b, %ecx	# 1321	[c=4 l=4]  *zero_extendqisi2/0
+	call	log_add_data_mov@PLT	# 1327	[c=0 l=5]  *call
+	movl	$63, %eax	# 1328	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 1329	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 1330	[c=13 l=7]  *cmpsi_1/1
+	jb	.L370	# 1331	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%r13)	# 1333	[c=13 l=8]  *cmpqi_ccno_1/1
+	jne	.L371	# 1334	[c=13 l=6]  *jcc
+.L370:
+	movq	1040(%r13), %rax	# 1337	[c=9 l=7]  *movdi_internal/3
+	movb	%r14b, 63(%rax)	# 1338	[c=4 l=4]  *movqi_internal/8
+.L372:
+	movq	%r13, %rdi	# 1350	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 1349	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 1351	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 17121	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 17122	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 1353	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18890	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 1354	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 1356	[c=4 l=3]  *cmpdi_1/0
+	jb	.L344	# 1357	[c=13 l=6]  *jcc
+	movl	0(%r13), %ebx	# 1359	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 1364	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 1360	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 1362	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 1363	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 1365	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 1366	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 1367	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 1370	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 17123	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 1371	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 1374	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 1375	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 20263	[c=10 l=4]  *indirect_jump
+.L373:
+	movzbl	10(%rbx), %eax	# 1384	[c=13 l=4]  *zero_extendqisi2/0
+	movzwl	12(%rbx), %r14d	# 1383	[c=13 l=5]  *zero_extendhisi2/0
+	leaq	.LC61(%rip), %rsi	# 1386	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 1388	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, %r15d	# 17125	[c=4 l=3]  *movsi_internal/0
+	movl	%r14d, %edx	# 1385	[c=4 l=3]  *movsi_internal/0
+	xorl	%eax, %eax	# 20260	[c=4 l=2]  *movdi_xor
+	call	log_append@PLT	# 1390	[c=0 l=5]  *call
+	movslq	%r15d, %r15	# 18182	[c=4 l=3]  *extendsidi2_rex64/1
+	movq	%r13, %rdi	# 1397	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 20261	[c=4 l=2]  *movdi_xor
+	movl	%r15d, %edx	# 1394	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC35(%rip), %rsi	# 1395	[c=1 l=7]  *movdi_internal/4
+	movl	%r15d, 8(%rsp)	# 18181	[c=4 l=5]  *movsi_internal/1
+	movzbl	1004(%r13,%r15), %ecx	# 1392	[c=14 l=9]  *zero_extendqisi2/0
+	call	log_append@PLT	# 1399	[c=0 l=5]  *call
+	movl	8(%rsp), %edx	# 1404	[c=9 l=4]  *movsi_internal/0
+	leaq	.LC36(%rip), %rsi	# 1405	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 1407	[c=4 l=3]  *movdi_internal/3
+	movzbl	1004(%r13,%r15), %eax	# 1401	[c=14 l=9]  *zero_extendqisi2/0
+	andl	%eax, %r14d	# 1402	[c=4 l=3]  *andsi_1/0
+	xorl	%eax, %eax	# 20262	[c=4 l=2]  *movdi_xor
+	movl	%r14d, %ecx	# 1403	[c=4 l=3]  *movsi_internal/0
+	call	log_append@PLT	# 1409	[c=0 l=5]  *call
+	movb	%r14b, 1004(%r13,%r15)	# 1411	[c=4 l=8]  *movqi_internal/8
+	movl	$63, %eax	# 1412	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 1413	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 1414	[c=13 l=7]  *cmpsi_1/1
+	jb	.L374	# 1415	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%r13)	# 1417	[c=13 l=8]  *cmpqi_ccno_1/1
+	jne	.L375	# 1418	[c=13 l=6]  *jcc
+.L374:
+	movq	1040(%r13), %rax	# 1421	[c=9 l=7]  *movdi_internal/3
+	movzbl	63(%rax), %r15d	# 1422	[c=13 l=5]  *zero_extendqisi2/0
+.L376:
+	movl	%r15d, %ecx	# 1433	[c=4 l=3]  *movsi_internal/0
+	movl	$63, %edx	# 1434	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 1437	[c=4 l=3]  *movdi_internal/3
+	movslq	%r14d, %r14	# 1441	[c=4 l=3]  *extendsidi2_rex64/1
+	leaq	.LC33(%rip), %rsi	# 1435	[c=1 l=7]  *movdi_internal/4
+	andl	$-31, %r15d	# 1439	[c=4 l=4]  *andsi_1/0
+	call	log_add_data_mov@PLT	# 1438	[c=0 l=5]  *call
+	leaq	flag_update_table_logical(%rip), %rax	# 16897	[c=1 l=7]  *movdi_internal/4
+	movl	$63, %edx	# 1446	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 1449	[c=4 l=3]  *movdi_internal/3
+	movzbl	(%rax,%r14), %eax	# 1442	[c=13 l=5]  *zero_extendqisi2/0
+	leaq	.LC29(%rip), %rsi	# 1447	[c=1 l=7]  *movdi_internal/4
+	orl	%eax, %r15d	# 1443	[c=4 l=3]  *iorsi_1/0
+	movzbl	%r15b, %ecx	# 1444	[c=4 l=4]  *zero_extendqisi2/0
+	call	log_add_data_mov@PLT	# 1450	[c=0 l=5]  *call
+	movl	$63, %eax	# 1451	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 1452	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 1453	[c=13 l=7]  *cmpsi_1/1
+	jb	.L377	# 1454	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%r13)	# 1456	[c=13 l=8]  *cmpqi_ccno_1/1
+	jne	.L378	# 1457	[c=13 l=6]  *jcc
+.L377:
+	movq	1040(%r13), %rax	# 1460	[c=9 l=7]  *movdi_internal/3
+	movb	%r15b, 63(%rax)	# 1461	[c=4 l=4]  *movqi_internal/8
+.L379:
+	movq	%r13, %rdi	# 1473	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 1472	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 1474	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 17127	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 17128	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 1476	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18889	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 1477	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 1479	[c=4 l=3]  *cmpdi_1/0
+	jb	.L344	# 1480	[c=13 l=6]  *jcc
+	movl	0(%r13), %ebx	# 1482	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 1487	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 1483	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 1485	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 1486	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 1488	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 1489	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 1490	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 1493	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 17129	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 1494	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 1497	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 1498	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 20259	[c=10 l=4]  *indirect_jump
+.L380:
+	movzbl	10(%rbx), %r14d	# 1506	[c=13 l=5]  zero_extendqidi2/0
+	leaq	.LC35(%rip), %rsi	# 1511	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 1513	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 20257	[c=4 l=2]  *movdi_xor
+	movzbl	1004(%r13,%r14), %ecx	# 1508	[c=14 l=9]  *zero_extendqisi2/0
+	movq	%r14, %rdx	# 19137	[c=4 l=3]  *movdi_internal/3
+	movl	%r14d, 16(%rsp)	# 18186	[c=4 l=5]  *movsi_internal/1
+	call	log_append@PLT	# 1515	[c=0 l=5]  *call
+	movl	16(%rsp), %edx	# 18187	[c=9 l=4]  *movsi_internal/0
+	xorl	%eax, %eax	# 20258	[c=4 l=2]  *movdi_xor
+	movq	%r13, %rdi	# 1524	[c=4 l=3]  *movdi_internal/3
+	movsbl	1004(%r13,%r14), %r15d	# 1517	[c=14 l=9]  extendqisi2
+	leaq	.LC36(%rip), %rsi	# 1522	[c=1 l=7]  *movdi_internal/4
+	andl	$511, %r15d	# 1518	[c=4 l=7]  *andsi_1/0
+	movl	%r15d, %ecx	# 17131	[c=4 l=3]  *movsi_internal/0
+	sarl	%ecx	# 1519	[c=4 l=2]  *ashrsi3_1/0
+	movl	%ecx, 8(%rsp)	# 18184	[c=4 l=4]  *movsi_internal/1
+	call	log_append@PLT	# 1526	[c=0 l=5]  *call
+	movl	8(%rsp), %ecx	# 18185	[c=9 l=4]  *movsi_internal/0
+	movl	$63, %eax	# 1529	[c=4 l=5]  *movsi_internal/0
+	movb	%cl, 1004(%r13,%r14)	# 1528	[c=4 l=8]  *movqi_internal/8
+	subl	5176(%r13), %eax	# 1530	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 1531	[c=13 l=7]  *cmpsi_1/1
+	jb	.L381	# 1532	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%r13)	# 1534	[c=13 l=8]  *cmpqi_ccno_1/1
+	jne	.L382	# 1535	[c=13 l=6]  *jcc
+.L381:
+	movq	1040(%r13), %rax	# 1538	[c=9 l=7]  *movdi_internal/3
+	movzbl	63(%rax), %r14d	# 1539	[c=13 l=5]  *zero_extendqisi2/0
+.L383:
+	movl	%r14d, %ecx	# 1550	[c=4 l=3]  *movsi_internal/0
+	movl	$63, %edx	# 1551	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 1554	[c=4 l=3]  *movdi_internal/3
+	movslq	%r15d, %r15	# 1558	[c=4 l=3]  *extendsidi2_rex64/1
+	leaq	.LC33(%rip), %rsi	# 1552	[c=1 l=7]  *movdi_internal/4
+	andl	$-32, %r14d	# 1556	[c=4 l=4]  *andsi_1/0
+	call	log_add_data_mov@PLT	# 1555	[c=0 l=5]  *call
+	leaq	flag_update_table_ror8(%rip), %rax	# 16898	[c=1 l=7]  *movdi_internal/4
+	movl	$63, %edx	# 1563	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 1566	[c=4 l=3]  *movdi_internal/3
+	movzbl	(%rax,%r15), %eax	# 1559	[c=13 l=5]  *zero_extendqisi2/0
+	leaq	.LC29(%rip), %rsi	# 1564	[c=1 l=7]  *movdi_internal/4
+	orl	%eax, %r14d	# 1560	[c=4 l=3]  *iorsi_1/0
+	movzbl	%r14b, %ecx	# 1561	[c=4 l=4]  *zero_extendqisi2/0
+	call	log_add_data_mov@PLT	# 1567	[c=0 l=5]  *call
+	movl	$63, %eax	# 1568	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 1569	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 1570	[c=13 l=7]  *cmpsi_1/1
+	jb	.L384	# 1571	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%r13)	# 1573	[c=13 l=8]  *cmpqi_ccno_1/1
+	jne	.L385	# 1574	[c=13 l=6]  *jcc
+.L384:
+	movq	1040(%r13), %rax	# 1577	[c=9 l=7]  *movdi_internal/3
+	movb	%r14b, 63(%rax)	# 1578	[c=4 l=4]  *movqi_internal/8
+.L386:
+	movq	%r13, %rdi	# 1590	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 1589	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 1591	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 17133	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 17134	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 1593	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18888	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 1594	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 1596	[c=4 l=3]  *cmpdi_1/0
+	jb	.L344	# 1597	[c=13 l=6]  *jcc
+	movl	0(%r13), %ebx	# 1599	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 1604	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 1600	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 1602	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 1603	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 1605	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 1606	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 1607	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 1610	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 17135	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 1611	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 1614	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 1615	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 20256	[c=10 l=4]  *indirect_jump
+.L387:
+	movl	$63, %eax	# 1624	[c=4 l=5]  *movsi_internal/0
+	movzbl	10(%rbx), %r14d	# 1623	[c=13 l=5]  *zero_extendqisi2/0
+	subl	5176(%r13), %eax	# 1625	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 1626	[c=13 l=7]  *cmpsi_1/1
+	jb	.L388	# 1627	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%r13)	# 1629	[c=13 l=8]  *cmpqi_ccno_1/1
+	jne	.L389	# 1630	[c=13 l=6]  *jcc
+.L388:
+	movq	1040(%r13), %rax	# 1633	[c=9 l=7]  *movdi_internal/3
+	movzbl	63(%rax), %r15d	# 1634	[c=13 l=5]  *zero_extendqisi2/0
+.L390:
+	notl	%r14d	# 1651	[c=4 l=3]  *one_cmplsi2_1/0
+	movl	%r15d, %ecx	# 1645	[c=4 l=3]  *movsi_internal/0
+	movl	$63, %edx	# 1646	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 1649	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC33(%rip), %rsi	# 1647	[c=1 l=7]  *movdi_internal/4
+	andl	%r15d, %r14d	# 1652	[c=4 l=3]  *andsi_1/0
+	call	log_add_data_mov@PLT	# 1650	[c=0 l=5]  *call
+	movzbl	%r14b, %ecx	# 1653	[c=4 l=4]  *zero_extendqisi2/0
+	movl	$63, %edx	# 1655	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 1658	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC29(%rip), %rsi	# 1656	[c=1 l=7]  *movdi_internal/4
+	call	log_add_data_mov@PLT	# 1659	[c=0 l=5]  *call
+	movl	$63, %eax	# 1660	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 1661	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 1662	[c=13 l=7]  *cmpsi_1/1
+	jb	.L391	# 1663	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%r13)	# 1665	[c=13 l=8]  *cmpqi_ccno_1/1
+	jne	.L392	# 1666	[c=13 l=6]  *jcc
+.L391:
+	movq	1040(%r13), %rax	# 1669	[c=9 l=7]  *movdi_internal/3
+	movb	%r14b, 63(%rax)	# 1670	[c=4 l=4]  *movqi_internal/8
+.L393:
+	movq	%r13, %rdi	# 1682	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 1681	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 1683	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 17137	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 17138	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 1685	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18887	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 1686	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 1688	[c=4 l=3]  *cmpdi_1/0
+	jb	.L344	# 1689	[c=13 l=6]  *jcc
+	movl	0(%r13), %ebx	# 1691	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 1696	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 1692	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 1694	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 1695	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 1697	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 1698	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 1699	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 1702	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 17139	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 1703	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 1706	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 1707	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 20255	[c=10 l=4]  *indirect_jump
+.L394:
+	movzbl	10(%rbx), %r14d	# 1716	[c=13 l=5]  zero_extendqidi2/0
+	movzwl	12(%rbx), %eax	# 1715	[c=13 l=4]  *zero_extendhisi2/0
+	movq	%r13, %rdi	# 1723	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC35(%rip), %rsi	# 1721	[c=1 l=7]  *movdi_internal/4
+	movzbl	1004(%r13,%r14), %ecx	# 1718	[c=14 l=9]  *zero_extendqisi2/0
+	movl	%eax, 8(%rsp)	# 17141	[c=4 l=4]  *movsi_internal/1
+	movl	%r14d, %edx	# 1720	[c=4 l=3]  *movsi_internal/0
+	xorl	%eax, %eax	# 20254	[c=4 l=2]  *movdi_xor
+	movq	%r14, %r15	# 19138	[c=4 l=3]  *movdi_internal/3
+	call	log_append@PLT	# 1725	[c=0 l=5]  *call
+	movl	8(%rsp), %edi	# 17142	[c=9 l=4]  *movsi_internal/0
+	movzbl	1004(%r13,%r14), %eax	# 1727	[c=14 l=9]  *zero_extendqisi2/0
+	orl	%eax, %edi	# 1728	[c=4 l=2]  *iorsi_1/0
+	movl	$63, %eax	# 1729	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 1730	[c=13 l=7]  *subsi_1/1
+	movl	%edi, 16(%rsp)	# 17143	[c=4 l=4]  *movsi_internal/1
+	cmpl	5180(%r13), %eax	# 1731	[c=13 l=7]  *cmpsi_1/1
+	jb	.L395	# 1732	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%r13)	# 1734	[c=13 l=8]  *cmpqi_ccno_1/1
+	jne	.L396	# 1735	[c=13 l=6]  *jcc
+.L395:
+	movq	1040(%r13), %rax	# 1738	[c=9 l=7]  *movdi_internal/3
+	movzbl	63(%rax), %r8d	# 1739	[c=13 l=5]  *zero_extendqisi2/0
+.L397:
+	movl	%r8d, %ecx	# 1750	[c=4 l=3]  *movsi_internal/0
+	movl	$63, %edx	# 1751	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 1754	[c=4 l=3]  *movdi_internal/3
+	movl	%r8d, 24(%rsp)	# 18191	[c=4 l=5]  *movsi_internal/1
+	leaq	.LC33(%rip), %rsi	# 1752	[c=1 l=7]  *movdi_internal/4
+	call	log_add_data_mov@PLT	# 1755	[c=0 l=5]  *call
+	movl	24(%rsp), %r8d	# 18192	[c=9 l=5]  *movsi_internal/0
+	movl	%r15d, %edx	# 1764	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 1767	[c=4 l=3]  *movdi_internal/3
+	movl	8(%rsp), %eax	# 17144	[c=9 l=4]  *movsi_internal/0
+	leaq	.LC36(%rip), %rsi	# 1765	[c=1 l=7]  *movdi_internal/4
+	sall	$25, %r8d	# 1757	[c=4 l=4]  *ashlsi3_1/0
+	notl	%eax	# 1759	[c=4 l=2]  *one_cmplsi2_1/0
+	sarl	$31, %r8d	# 1758	[c=4 l=4]  ashrsi3_cvt/1
+	orl	%eax, %r8d	# 1760	[c=4 l=3]  *iorsi_1/0
+	movl	16(%rsp), %eax	# 17146	[c=9 l=4]  *movsi_internal/0
+	andl	%eax, %r8d	# 1761	[c=4 l=3]  *andsi_1/0
+	xorl	%eax, %eax	# 20253	[c=4 l=2]  *movdi_xor
+	movzbl	%r8b, %ecx	# 1762	[c=4 l=4]  *zero_extendqisi2/0
+	movl	%r8d, 8(%rsp)	# 18189	[c=4 l=5]  *movsi_internal/1
+	call	log_append@PLT	# 1769	[c=0 l=5]  *call
+	movl	8(%rsp), %r8d	# 18190	[c=9 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 1773	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 1772	[c=4 l=3]  *movdi_internal/3
+	movb	%r8b, 1004(%r13,%r14)	# 1771	[c=4 l=8]  *movqi_internal/8
+	call	log_dump_line@PLT	# 1774	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 17147	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 17148	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 1776	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18886	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 1777	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 1779	[c=4 l=3]  *cmpdi_1/0
+	jb	.L344	# 1780	[c=13 l=6]  *jcc
+	movl	0(%r13), %ebx	# 1782	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 1787	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 1783	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 1785	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 1786	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 1788	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 1789	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 1790	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 1793	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 17149	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 1794	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 1797	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 1798	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 20252	[c=10 l=4]  *indirect_jump
+.L398:
+	movq	%r13, %rdi	# 1807	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 1806	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 1808	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 17151	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 17152	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 1810	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18885	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 1811	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 1813	[c=4 l=3]  *cmpdi_1/0
+	jb	.L344	# 1814	[c=13 l=6]  *jcc
+	movq	56(%r13), %rax	# 17153	[c=9 l=4]  *movdi_internal/3
+	cmpq	%rax, 48(%r13)	# 1817	[c=13 l=4]  *cmpdi_1/0
+	jnb	.L1496	# 1818	[c=13 l=6]  *jcc
+.L399:
+	movq	%r13, %rdi	# 1824	[c=4 l=3]  *movdi_internal/3
+	call	log_is_idle@PLT	# 1825	[c=10 l=5]  *call_value
+	testb	%al, %al	# 1827	[c=4 l=2]  *cmpqi_ccno_1/0
+	jne	.L1497	# 1828	[c=13 l=6]  *jcc
+.L400:
+	movl	0(%r13), %ebx	# 1839	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 1844	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 1840	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 1842	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 1843	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 1845	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 1846	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 1847	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 1850	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 17154	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 1851	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 1854	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 1855	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 20251	[c=10 l=4]  *indirect_jump
+.L401:
+	movzbl	10(%rbx), %eax	# 1864	[c=9 l=4]  *movqi_internal/4
+	movzwl	12(%rbx), %r14d	# 1863	[c=13 l=5]  *zero_extendhisi2/0
+	movb	%al, 8(%rsp)	# 17156	[c=4 l=4]  *movqi_internal/8
+	movl	$63, %eax	# 1865	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 1866	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 1867	[c=13 l=7]  *cmpsi_1/1
+	jb	.L402	# 1868	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%r13)	# 1870	[c=13 l=8]  *cmpqi_ccno_1/1
+	jne	.L403	# 1871	[c=13 l=6]  *jcc
+.L402:
+	movq	1040(%r13), %rax	# 1874	[c=9 l=7]  *movdi_internal/3
+	movzbl	63(%rax), %r15d	# 1875	[c=13 l=5]  *zero_extendqisi2/0
+.L404:
+	movl	%r15d, %ecx	# 1886	[c=4 l=3]  *movsi_internal/0
+	movl	$63, %edx	# 1887	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 1890	[c=4 l=3]  *movdi_internal/3
+	andl	%r14d, %r15d	# 1892	[c=4 l=3]  *andsi_1/0
+	leaq	.LC33(%rip), %rsi	# 1888	[c=1 l=7]  *movdi_internal/4
+	call	log_add_data_mov@PLT	# 1891	[c=0 l=5]  *call
+	movl	%r15d, %edx	# 1893	[c=4 l=3]  *movsi_internal/0
+	movl	%r14d, %esi	# 1894	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 1895	[c=4 l=3]  *movdi_internal/3
+	call	log_add_flag_read@PLT	# 1896	[c=0 l=5]  *call
+	testl	%r15d, %r15d	# 1897	[c=4 l=3]  *cmpsi_ccno_1/0
+	jne	.L405	# 1898	[c=13 l=2]  *jcc
+	movsbl	8(%rsp), %eax	# 1900	[c=13 l=5]  extendqisi2
+	addq	$1, 48(%r13)	# 1907	[c=13 l=5]  *adddi_1/0
+	addl	0(%r13), %eax	# 1902	[c=9 l=4]  *addsi_1/1
+	andl	992(%r13), %eax	# 1905	[c=13 l=7]  *andsi_1/1
+	movl	%eax, 0(%r13)	# 1906	[c=4 l=4]  *movsi_internal/1
+.L405:
+	movq	%r13, %rdi	# 1911	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 1910	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 1912	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 17158	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 17159	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 1914	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18884	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 1915	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 1917	[c=4 l=3]  *cmpdi_1/0
+	jb	.L344	# 1918	[c=13 l=6]  *jcc
+	movq	56(%r13), %rax	# 17160	[c=9 l=4]  *movdi_internal/3
+	cmpq	%rax, 48(%r13)	# 1921	[c=13 l=4]  *cmpdi_1/0
+	jnb	.L1498	# 1922	[c=13 l=6]  *jcc
+.L406:
+	movq	%r13, %rdi	# 1928	[c=4 l=3]  *movdi_internal/3
+	call	log_is_idle@PLT	# 1929	[c=10 l=5]  *call_value
+	testb	%al, %al	# 1931	[c=4 l=2]  *cmpqi_ccno_1/0
+	jne	.L1499	# 1932	[c=13 l=6]  *jcc
+.L407:
+	movl	0(%r13), %ebx	# 1943	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 1948	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 1944	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 1946	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 1947	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 1949	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 1950	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 1951	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 1954	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 17161	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 1955	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 1958	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 1959	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 20250	[c=10 l=4]  *indirect_jump
+.L316:
+	movzbl	10(%rbx), %r14d	# 295	[c=13 l=5]  zero_extendqidi2/0
+	xorl	%eax, %eax	# 20325	[c=4 l=2]  *movdi_xor
+	leaq	.LC45(%rip), %rsi	# 298	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 300	[c=4 l=3]  *movdi_internal/3
+	movl	%r14d, %edx	# 297	[c=4 l=3]  *movsi_internal/0
+	call	log_append@PLT	# 302	[c=0 l=5]  *call
+	cmpb	$31, %r14b	# 305	[c=4 l=4]  *cmpqi_1/0
+	ja	.L317	# 306	[c=13 l=6]  *jcc
+	leaq	.L319(%rip), %rdx	# 308	[c=1 l=7]  *movdi_internal/4
+	movslq	(%rdx,%r14,4), %rax	# 310	[c=14 l=4]  *extendsidi2_rex64/1
+	addq	%rdx, %rax	# 312	[c=4 l=3]  *adddi_1/0
+	jmp	*%rax	# 313	[c=4 l=2]  *tablejump_1
+	.section	.rodata
+	.align 4
+	.align 4
+.L319:
+	.long	.L325-.L319
+	.long	.L325-.L319
+	.long	.L325-.L319
+	.long	.L325-.L319
+	.long	.L325-.L319
+	.long	.L325-.L319
+	.long	.L325-.L319
+	.long	.L325-.L319
+	.long	.L317-.L319
+	.long	.L317-.L319
+	.long	.L317-.L319
+	.long	.L317-.L319
+	.long	.L317-.L319
+	.long	.L317-.L319
+	.long	.L317-.L319
+	.long	.L317-.L319
+	.long	.L317-.L319
+	.long	.L317-.L319
+	.long	.L317-.L319
+	.long	.L317-.L319
+	.long	.L317-.L319
+	.long	.L317-.L319
+	.long	.L317-.L319
+	.long	.L317-.L319
+	.long	.L317-.L319
+	.long	.L317-.L319
+	.long	.L324-.L319
+	.long	.L323-.L319
+	.long	.L322-.L319
+	.long	.L321-.L319
+	.long	.L320-.L319
+	.long	.L318-.L319
+	.text
+.L337:
+	movq	1040(%r13), %rax	# 687	[c=9 l=7]  *movdi_internal/3
+	movzbl	10(%rbx), %r15d	# 686	[c=13 l=5]  zero_extendqidi2/0
+	movq	%r13, %rdi	# 697	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC35(%rip), %rsi	# 695	[c=1 l=7]  *movdi_internal/4
+	movzwl	12(%rbx), %r11d	# 685	[c=13 l=5]  *zero_extendhisi2/0
+	movzbl	63(%rax), %eax	# 688	[c=9 l=4]  *movqi_internal/4
+	movl	%r15d, %edx	# 694	[c=4 l=3]  *movsi_internal/0
+	movl	%r15d, 24(%rsp)	# 18133	[c=4 l=5]  *movsi_internal/1
+	movzbl	1004(%r13,%r15), %ecx	# 692	[c=14 l=9]  *zero_extendqisi2/0
+	movl	%r11d, 16(%rsp)	# 18136	[c=4 l=5]  *movsi_internal/1
+	andl	$1, %eax	# 690	[c=4 l=3]  *andsi_1/0
+	movl	%eax, 8(%rsp)	# 17091	[c=4 l=4]  *movsi_internal/1
+	xorl	%eax, %eax	# 20289	[c=4 l=2]  *movdi_xor
+	call	log_append@PLT	# 699	[c=0 l=5]  *call
+	movslq	16(%rsp), %r9	# 18137	[c=13 l=5]  *extendsidi2_rex64/1
+	movq	%r13, %rdi	# 708	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 20290	[c=4 l=2]  *movdi_xor
+	movzbl	1004(%r13,%r15), %r14d	# 701	[c=10 l=9]  *movqi_internal/4
+	leaq	.LC35(%rip), %rsi	# 18132	[c=1 l=7]  *movdi_internal/4
+	movzbl	1004(%r13,%r9), %ecx	# 703	[c=14 l=9]  *zero_extendqisi2/0
+	movl	%r9d, %edx	# 705	[c=4 l=3]  *movsi_internal/0
+	movq	%r9, 16(%rsp)	# 18129	[c=4 l=5]  *movdi_internal/5
+	call	log_append@PLT	# 710	[c=0 l=5]  *call
+	movzbl	%r14b, %eax	# 714	[c=4 l=4]  *zero_extendqisi2/0
+	movl	24(%rsp), %edx	# 20291	[c=9 l=4]  *movsi_internal/0
+	movq	%r13, %rdi	# 722	[c=4 l=3]  *movdi_internal/3
+	movq	16(%rsp), %r9	# 18130	[c=9 l=5]  *movdi_internal/3
+	leaq	.LC36(%rip), %rsi	# 720	[c=1 l=7]  *movdi_internal/4
+	andl	$136, %r14d	# 728	[c=4 l=7]  *andsi_1/0
+	movzbl	1004(%r13,%r9), %r11d	# 712	[c=14 l=9]  *zero_extendqisi2/0
+	movb	%r11b, 16(%rsp)	# 18127	[c=4 l=5]  *movqi_internal/8
+	addl	%eax, %r11d	# 715	[c=4 l=3]  *addsi_1/0
+	movl	8(%rsp), %eax	# 17092	[c=9 l=4]  *movsi_internal/0
+	addl	%eax, %r11d	# 716	[c=4 l=3]  *addsi_1/0
+	xorl	%eax, %eax	# 20292	[c=4 l=2]  *movdi_xor
+	movzbl	%r11b, %ecx	# 717	[c=4 l=4]  *zero_extendqisi2/0
+	movl	%r11d, 8(%rsp)	# 18125	[c=4 l=5]  *movsi_internal/1
+	call	log_append@PLT	# 724	[c=0 l=5]  *call
+	movzbl	16(%rsp), %r9d	# 18128	[c=9 l=6]  *movqi_internal/4
+	movl	8(%rsp), %r11d	# 18126	[c=9 l=5]  *movsi_internal/0
+	movl	$63, %eax	# 736	[c=4 l=5]  *movsi_internal/0
+	andl	$136, %r9d	# 731	[c=4 l=7]  *andsi_1/0
+	movb	%r11b, 1004(%r13,%r15)	# 726	[c=4 l=8]  *movqi_internal/8
+	subl	5176(%r13), %eax	# 737	[c=13 l=7]  *subsi_1/1
+	leal	(%r9,%r14,2), %r14d	# 732	[c=8 l=4]  *leasi
+	imull	$260, %r14d, %r14d	# 733	[c=12 l=7]  *mulsi3_1/1
+	andl	$7680, %r14d	# 734	[c=4 l=7]  *andsi_1/0
+	orl	%r11d, %r14d	# 735	[c=5 l=3]  *iorsi_1_zext
+	cmpl	5180(%r13), %eax	# 738	[c=13 l=7]  *cmpsi_1/1
+	jb	.L338	# 739	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%r13)	# 741	[c=13 l=8]  *cmpqi_ccno_1/1
+	jne	.L339	# 742	[c=13 l=6]  *jcc
+.L338:
+	movq	1040(%r13), %rax	# 745	[c=9 l=7]  *movdi_internal/3
+	movzbl	63(%rax), %r15d	# 746	[c=13 l=5]  *zero_extendqisi2/0
+.L340:
+	movl	%r15d, %ecx	# 757	[c=4 l=3]  *movsi_internal/0
+	movl	$63, %edx	# 758	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 761	[c=4 l=3]  *movdi_internal/3
+	andl	$-64, %r15d	# 763	[c=4 l=4]  *andsi_1/0
+	leaq	.LC33(%rip), %rsi	# 759	[c=1 l=7]  *movdi_internal/4
+	call	log_add_data_mov@PLT	# 762	[c=0 l=5]  *call
+	leaq	flag_update_table_add8(%rip), %rax	# 16892	[c=1 l=7]  *movdi_internal/4
+	movl	$63, %edx	# 770	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 773	[c=4 l=3]  *movdi_internal/3
+	movzbl	(%rax,%r14), %eax	# 766	[c=13 l=5]  *zero_extendqisi2/0
+	leaq	.LC29(%rip), %rsi	# 771	[c=1 l=7]  *movdi_internal/4
+	orl	%eax, %r15d	# 767	[c=4 l=3]  *iorsi_1/0
+	movzbl	%r15b, %ecx	# 768	[c=4 l=4]  *zero_extendqisi2/0
+	call	log_add_data_mov@PLT	# 774	[c=0 l=5]  *call
+	movl	$63, %eax	# 775	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 776	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 777	[c=13 l=7]  *cmpsi_1/1
+	jb	.L341	# 778	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%r13)	# 780	[c=13 l=8]  *cmpqi_ccno_1/1
+	jne	.L342	# 781	[c=13 l=6]  *jcc
+.L341:
+	movq	1040(%r13), %rax	# 784	[c=9 l=7]  *movdi_internal/3
+	movb	%r15b, 63(%rax)	# 785	[c=4 l=4]  *movqi_internal/8
+.L343:
+	movq	%r13, %rdi	# 797	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 796	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 798	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 17093	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 17094	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 800	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18902	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 801	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 804	[c=4 l=3]  *cmpdi_1/0
+	jb	.L344	# 805	[c=13 l=6]  *jcc
+	movl	0(%r13), %ebx	# 807	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 812	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 808	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 810	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 811	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 813	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 814	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 815	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 818	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 17095	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 819	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 822	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 823	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 20288	[c=10 l=4]  *indirect_jump
+.L311:
+	movzwl	12(%rbx), %edx	# 190	[c=13 l=4]  *zero_extendhisi2/0
+	movl	0(%r13), %eax	# 17081	[c=5 l=4]  *movsi_internal/0
+	movq	%r13, %rdi	# 201	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC38(%rip), %rsi	# 199	[c=1 l=7]  *movdi_internal/4
+	movzbl	10(%rbx), %ebp	# 189	[c=9 l=4]  *movqi_internal/4
+	subl	%edx, %eax	# 192	[c=4 l=2]  *subsi_1/0
+	movq	1056(%r13), %rdx	# 196	[c=9 l=7]  *movdi_internal/3
+	movl	%eax, 0(%r13)	# 193	[c=4 l=4]  *movsi_internal/1
+	addl	%eax, %eax	# 194	[c=5 l=2]  *ashlsi3_1_zext/0
+	movzwl	(%rdx,%rax), %ebx	# 197	[c=13 l=4]  *zero_extendhisi2/0
+	xorl	%eax, %eax	# 20330	[c=4 l=2]  *movdi_xor
+	movl	%ebx, %edx	# 198	[c=4 l=2]  *movsi_internal/0
+	call	log_append@PLT	# 203	[c=0 l=5]  *call
+	cmpb	$1, %bpl	# 204	[c=4 l=4]  *cmpqi_1/0
+	je	.L1377	# 205	[c=13 l=6]  *jcc
+	cmpb	$2, %bpl	# 207	[c=4 l=4]  *cmpqi_1/0
+	je	.L1378	# 208	[c=13 l=6]  *jcc
+	testb	%bpl, %bpl	# 210	[c=4 l=3]  *cmpqi_ccno_1/0
+	je	.L1500	# 211	[c=13 l=6]  *jcc
+	leaq	.LC42(%rip), %rdx	# 249	[c=1 l=7]  *movdi_internal/4
+	movl	$8, %esi	# 251	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 252	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 20328	[c=4 l=2]  *movdi_xor
+	call	leave	# 254	[c=0 l=5]  *call
+.L315:
+	movzbl	10(%rbx), %eax	# 263	[c=13 l=4]  zero_extendqidi2/0
+	movzwl	12(%rbx), %r14d	# 258	[c=13 l=5]  *zero_extendhisi2/0
+	salq	$4, %rax	# 264	[c=4 l=4]  *ashldi3_1/0
+	movl	%r14d, %r12d	# 17083	[c=4 l=3]  *movsi_internal/0
+	movq	0(%rbp,%rax), %rbx	# 266	[c=9 l=5]  *movdi_internal/3
+	sarl	$4, %r12d	# 259	[c=4 l=4]  *ashrsi3_1/0
+	andl	$31, %r12d	# 260	[c=4 l=4]  *andsi_1/0
+	movq	%rbx, %rdi	# 267	[c=4 l=3]  *movdi_internal/3
+	call	strlen@PLT	# 268	[c=10 l=5]  *call_value
+	movl	%r12d, %r9d	# 274	[c=4 l=3]  *movsi_internal/0
+	movl	%r14d, %ecx	# 276	[c=4 l=3]  *movsi_internal/0
+	movq	%rbx, %rdx	# 277	[c=4 l=3]  *movdi_internal/3
+	leaq	-2(%rbx,%rax), %r8	# 275	[c=5 l=5]  *leadi
+	leaq	.LC43(%rip), %rsi	# 278	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 280	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 20326	[c=4 l=2]  *movdi_xor
+	call	log_append@PLT	# 282	[c=0 l=5]  *call
+	movl	%r12d, %r9d	# 283	[c=4 l=3]  *movsi_internal/0
+	movq	%rbx, %r8	# 284	[c=4 l=3]  *movdi_internal/3
+	movl	%r14d, %ecx	# 285	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC44(%rip), %rdx	# 286	[c=1 l=7]  *movdi_internal/4
+	movl	$1, %esi	# 288	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 289	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 20327	[c=4 l=2]  *movdi_xor
+	call	leave	# 291	[c=0 l=5]  *call
+.L345:
+	movzbl	10(%rbx), %r9d	# 832	[c=13 l=5]  zero_extendqidi2/0
+	movzwl	12(%rbx), %r8d	# 831	[c=13 l=5]  *zero_extendhisi2/0
+	movq	%r13, %rdi	# 839	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 20284	[c=4 l=2]  *movdi_xor
+	leaq	.LC35(%rip), %rsi	# 837	[c=1 l=7]  *movdi_internal/4
+	movzbl	1004(%r13,%r9), %ecx	# 834	[c=14 l=9]  *zero_extendqisi2/0
+	movl	%r9d, %edx	# 836	[c=4 l=3]  *movsi_internal/0
+	movl	%r8d, 32(%rsp)	# 18149	[c=4 l=5]  *movsi_internal/1
+	movq	%r9, 8(%rsp)	# 18147	[c=4 l=5]  *movdi_internal/5
+	movl	%r9d, 24(%rsp)	# 18145	[c=4 l=5]  *movsi_internal/1
+	call	log_append@PLT	# 841	[c=0 l=5]  *call
+	movslq	32(%rsp), %r15	# 18150	[c=13 l=5]  *extendsidi2_rex64/1
+	movq	%r13, %rdi	# 850	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 20285	[c=4 l=2]  *movdi_xor
+	movq	8(%rsp), %r9	# 18148	[c=9 l=5]  *movdi_internal/3
+	leaq	.LC35(%rip), %rsi	# 18144	[c=1 l=7]  *movdi_internal/4
+	movzbl	1004(%r13,%r15), %ecx	# 845	[c=14 l=9]  *zero_extendqisi2/0
+	movl	%r15d, %edx	# 847	[c=4 l=3]  *movsi_internal/0
+	movzbl	1004(%r13,%r9), %r14d	# 843	[c=10 l=9]  *movqi_internal/4
+	movq	%r9, 16(%rsp)	# 18141	[c=4 l=5]  *movdi_internal/5
+	call	log_append@PLT	# 852	[c=0 l=5]  *call
+	movl	24(%rsp), %edx	# 20286	[c=9 l=4]  *movsi_internal/0
+	leaq	.LC36(%rip), %rsi	# 862	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 864	[c=4 l=3]  *movdi_internal/3
+	movzbl	1004(%r13,%r15), %r8d	# 854	[c=14 l=9]  *zero_extendqisi2/0
+	movzbl	%r14b, %eax	# 856	[c=4 l=4]  *zero_extendqisi2/0
+	movl	%r8d, %r15d	# 19132	[c=4 l=3]  *movsi_internal/0
+	addl	%eax, %r8d	# 857	[c=4 l=3]  *addsi_1/0
+	xorl	%eax, %eax	# 20287	[c=4 l=2]  *movdi_xor
+	movzbl	%r8b, %ecx	# 859	[c=4 l=4]  *zero_extendqisi2/0
+	movl	%r8d, 8(%rsp)	# 18138	[c=4 l=5]  *movsi_internal/1
+	call	log_append@PLT	# 866	[c=0 l=5]  *call
+	movq	16(%rsp), %r9	# 18142	[c=9 l=5]  *movdi_internal/3
+	leal	(%r15,%r14), %eax	# 18901	[c=4 l=4]  *leasi
+	andl	$136, %r14d	# 870	[c=4 l=7]  *andsi_1/0
+	andl	$136, %r15d	# 873	[c=4 l=7]  *andsi_1/0
+	movl	8(%rsp), %r8d	# 18139	[c=9 l=5]  *movsi_internal/0
+	movb	%al, 1004(%r13,%r9)	# 868	[c=4 l=8]  *movqi_internal/8
+	leal	(%r15,%r14,2), %eax	# 874	[c=8 l=4]  *leasi
+	imull	$260, %eax, %eax	# 875	[c=12 l=6]  *mulsi3_1/1
+	andl	$7680, %eax	# 876	[c=4 l=5]  *andsi_1/0
+	orl	%r8d, %eax	# 877	[c=4 l=3]  *iorsi_1/0
+	movl	%eax, %r14d	# 17100	[c=4 l=3]  *movsi_internal/0
+	movl	$63, %eax	# 878	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 879	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 880	[c=13 l=7]  *cmpsi_1/1
+	jb	.L346	# 881	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%r13)	# 883	[c=13 l=8]  *cmpqi_ccno_1/1
+	jne	.L347	# 884	[c=13 l=6]  *jcc
+.L346:
+	movq	1040(%r13), %rax	# 887	[c=9 l=7]  *movdi_internal/3
+	movzbl	63(%rax), %r15d	# 888	[c=13 l=5]  *zero_extendqisi2/0
+.L348:
+	movl	%r15d, %ecx	# 899	[c=4 l=3]  *movsi_internal/0
+	movl	$63, %edx	# 900	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 903	[c=4 l=3]  *movdi_internal/3
+	andl	$-64, %r15d	# 908	[c=4 l=4]  *andsi_1/0
+	leaq	.LC33(%rip), %rsi	# 901	[c=1 l=7]  *movdi_internal/4
+	call	log_add_data_mov@PLT	# 904	[c=0 l=5]  *call
+	movl	%r14d, %eax	# 906	[c=1 l=3]  *zero_extendsidi2/3
+	leaq	flag_update_table_add8(%rip), %rdx	# 16893	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 915	[c=4 l=3]  *movdi_internal/3
+	movzbl	(%rdx,%rax), %r14d	# 907	[c=13 l=5]  *zero_extendqisi2/0
+	leaq	.LC29(%rip), %rsi	# 913	[c=1 l=7]  *movdi_internal/4
+	movl	$63, %edx	# 912	[c=4 l=5]  *movsi_internal/0
+	orl	%r15d, %r14d	# 909	[c=4 l=3]  *iorsi_1/0
+	movzbl	%r14b, %ecx	# 910	[c=4 l=4]  *zero_extendqisi2/0
+	call	log_add_data_mov@PLT	# 916	[c=0 l=5]  *call
+	movl	$63, %eax	# 917	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 918	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 919	[c=13 l=7]  *cmpsi_1/1
+	jb	.L349	# 920	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%r13)	# 922	[c=13 l=8]  *cmpqi_ccno_1/1
+	jne	.L350	# 923	[c=13 l=6]  *jcc
+.L349:
+	movq	1040(%r13), %rax	# 926	[c=9 l=7]  *movdi_internal/3
+	movb	%r14b, 63(%rax)	# 927	[c=4 l=4]  *movqi_internal/8
+.L351:
+	movq	%r13, %rdi	# 939	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 938	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 940	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 17101	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 17102	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 942	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18899	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 943	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 945	[c=4 l=3]  *cmpdi_1/0
+	jb	.L344	# 946	[c=13 l=6]  *jcc
+	movl	0(%r13), %ebx	# 948	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 953	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 949	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 951	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 952	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 954	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 955	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 956	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 959	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 17103	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 960	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 963	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 964	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 20283	[c=10 l=4]  *indirect_jump
+.L352:
+	movzwl	12(%rbx), %r15d	# 972	[c=13 l=5]  *zero_extendhisi2/0
+	movzbl	10(%rbx), %r9d	# 973	[c=13 l=5]  *zero_extendqisi2/0
+	xorl	%eax, %eax	# 20276	[c=4 l=2]  *movdi_xor
+	movq	%r13, %rdi	# 977	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC61(%rip), %rsi	# 975	[c=1 l=7]  *movdi_internal/4
+	movl	%r15d, %edx	# 974	[c=4 l=3]  *movsi_internal/0
+	movl	%r9d, 8(%rsp)	# 18159	[c=4 l=5]  *movsi_internal/1
+	call	log_append@PLT	# 979	[c=0 l=5]  *call
+	movslq	8(%rsp), %r11	# 18160	[c=13 l=5]  *extendsidi2_rex64/1
+	leaq	.LC34(%rip), %rsi	# 989	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 991	[c=4 l=3]  *movdi_internal/3
+	leal	1(%r11), %r8d	# 18896	[c=4 l=4]  *leasi
+	movl	%r11d, %edx	# 988	[c=4 l=3]  *movsi_internal/0
+	movq	%r11, 24(%rsp)	# 18155	[c=4 l=5]  *movdi_internal/5
+	movzbl	1004(%r13,%r11), %eax	# 985	[c=14 l=9]  *zero_extendqisi2/0
+	movslq	%r8d, %r8	# 981	[c=4 l=3]  *extendsidi2_rex64/1
+	movl	%r11d, 16(%rsp)	# 18153	[c=4 l=5]  *movsi_internal/1
+	movzbl	1004(%r13,%r8), %r14d	# 982	[c=14 l=9]  *zero_extendqisi2/0
+	movq	%r8, 32(%rsp)	# 18157	[c=4 l=5]  *movdi_internal/5
+	sall	$8, %r14d	# 983	[c=4 l=4]  *ashlsi3_1/0
+	orl	%eax, %r14d	# 986	[c=4 l=3]  *iorsi_1/0
+	xorl	%eax, %eax	# 20277	[c=4 l=2]  *movdi_xor
+	movl	%r14d, %ecx	# 987	[c=4 l=3]  *movsi_internal/0
+	addl	%r14d, %r15d	# 994	[c=4 l=3]  *addsi_1/0
+	call	log_append@PLT	# 993	[c=0 l=5]  *call
+	movl	16(%rsp), %edx	# 20278	[c=9 l=4]  *movsi_internal/0
+	movzwl	%r15w, %ecx	# 995	[c=4 l=4]  *zero_extendhisi2/0
+	xorl	%eax, %eax	# 20279	[c=4 l=2]  *movdi_xor
+	leaq	.LC37(%rip), %rsi	# 998	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 1000	[c=4 l=3]  *movdi_internal/3
+	movl	%ecx, 8(%rsp)	# 18151	[c=4 l=4]  *movsi_internal/1
+	call	log_append@PLT	# 1002	[c=0 l=5]  *call
+	movq	24(%rsp), %r11	# 18156	[c=9 l=5]  *movdi_internal/3
+	movl	%r14d, %eax	# 17105	[c=4 l=3]  *movsi_internal/0
+	movl	8(%rsp), %ecx	# 18152	[c=9 l=4]  *movsi_internal/0
+	shrl	$5, %eax	# 1010	[c=4 l=3]  *lshrsi3_1/0
+	movq	32(%rsp), %r8	# 18158	[c=9 l=5]  *movdi_internal/3
+	leaq	flag_update_table_add8(%rip), %rdx	# 16894	[c=1 l=7]  *movdi_internal/4
+	movb	%r15b, 1004(%r13,%r11)	# 1004	[c=4 l=8]  *movqi_internal/8
+	andl	$1024, %eax	# 1011	[c=4 l=5]  *andsi_1/0
+	sarl	$8, %r15d	# 1005	[c=4 l=4]  *ashrsi3_1/0
+	orl	%r15d, %eax	# 1012	[c=4 l=3]  *iorsi_1/0
+	movb	%r15b, 1004(%r13,%r8)	# 1007	[c=4 l=8]  *movqi_internal/8
+	cltq	# 1013	[c=4 l=2]  *extendsidi2_rex64/0
+	movzbl	(%rdx,%rax), %r15d	# 1014	[c=13 l=5]  *zero_extendqisi2/0
+	xorl	%eax, %eax	# 20280	[c=4 l=2]  *movsi_xor
+	testl	%ecx, %ecx	# 20281	[c=4 l=2]  *cmpsi_ccno_1/0
+	setne	%al	# 20282	[c=4 l=3]  *setcc_qi_slp
+	addl	%eax, %eax	# 1018	[c=4 l=2]  *ashlsi3_1/0
+	notl	%eax	# 1019	[c=4 l=2]  *one_cmplsi2_1/0
+	andl	%eax, %r15d	# 1020	[c=4 l=3]  *andsi_1/0
+	movl	$63, %eax	# 1022	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 1023	[c=13 l=7]  *subsi_1/1
+	andl	$-33, %r15d	# 1021	[c=4 l=4]  *andsi_1/0
+	cmpl	5180(%r13), %eax	# 1024	[c=13 l=7]  *cmpsi_1/1
+	jb	.L353	# 1025	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%r13)	# 1027	[c=13 l=8]  *cmpqi_ccno_1/1
+	jne	.L354	# 1028	[c=13 l=6]  *jcc
+.L353:
+	movq	1040(%r13), %rax	# 1031	[c=9 l=7]  *movdi_internal/3
+	movzbl	63(%rax), %r14d	# 1032	[c=13 l=5]  *zero_extendqisi2/0
+.L355:
+	movl	%r14d, %ecx	# 1043	[c=4 l=3]  *movsi_internal/0
+	andl	$-32, %r14d	# 1049	[c=4 l=4]  *andsi_1/0
+	movl	$63, %edx	# 1044	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 1047	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC33(%rip), %rsi	# 1045	[c=1 l=7]  *movdi_internal/4
+	orl	%r15d, %r14d	# 1050	[c=4 l=3]  *iorsi_1/0
+	call	log_add_data_mov@PLT	# 1048	[c=0 l=5]  *call
+	movzbl	%r14b, %ecx	# 1051	[c=4 l=4]  *zero_extendqisi2/0
+	movl	$63, %edx	# 1053	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 1056	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC29(%rip), %rsi	# 1054	[c=1 l=7]  *movdi_internal/4
+	call	log_add_data_mov@PLT	# 1057	[c=0 l=5]  *call
+	movl	$63, %eax	# 1058	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 1059	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 1060	[c=13 l=7]  *cmpsi_1/1
+	jb	.L356	# 1061	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%r13)	# 1063	[c=13 l=8]  *cmpqi_ccno_1/1
+	jne	.L357	# 1064	[c=13 l=6]  *jcc
+.L356:
+	movq	1040(%r13), %rax	# 1067	[c=9 l=7]  *movdi_internal/3
+	movb	%r14b, 63(%rax)	# 1068	[c=4 l=4]  *movqi_internal/8
+.L358:
+	movq	%r13, %rdi	# 1080	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 1079	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 1081	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 17107	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 17108	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 1083	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18895	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 1084	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 1086	[c=4 l=3]  *cmpdi_1/0
+	jb	.L344	# 1087	[c=13 l=6]  *jcc
+	movl	0(%r13), %ebx	# 1089	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 1094	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 1090	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 1092	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 1093	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 1095	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 1096	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 1097	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 1100	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 17109	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 1101	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 1104	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 1105	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 20275	[c=10 l=4]  *indirect_jump
+.L408:
+	movzbl	10(%rbx), %eax	# 1968	[c=9 l=4]  *movqi_internal/4
+	movzwl	12(%rbx), %r14d	# 1967	[c=13 l=5]  *zero_extendhisi2/0
+	movb	%al, 8(%rsp)	# 17163	[c=4 l=4]  *movqi_internal/8
+	movl	$63, %eax	# 1969	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 1970	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 1971	[c=13 l=7]  *cmpsi_1/1
+	jb	.L409	# 1972	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%r13)	# 1974	[c=13 l=8]  *cmpqi_ccno_1/1
+	jne	.L410	# 1975	[c=13 l=6]  *jcc
+.L409:
+	movq	1040(%r13), %rax	# 1978	[c=9 l=7]  *movdi_internal/3
+	movzbl	63(%rax), %r15d	# 1979	[c=13 l=5]  *zero_extendqisi2/0
+.L411:
+	movl	%r15d, %ecx	# 1990	[c=4 l=3]  *movsi_internal/0
+	movl	$63, %edx	# 1991	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 1994	[c=4 l=3]  *movdi_internal/3
+	andl	%r14d, %r15d	# 1996	[c=4 l=3]  *andsi_1/0
+	leaq	.LC33(%rip), %rsi	# 1992	[c=1 l=7]  *movdi_internal/4
+	call	log_add_data_mov@PLT	# 1995	[c=0 l=5]  *call
+	movl	%r15d, %edx	# 1997	[c=4 l=3]  *movsi_internal/0
+	movl	%r14d, %esi	# 1998	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 1999	[c=4 l=3]  *movdi_internal/3
+	call	log_add_flag_read@PLT	# 2000	[c=0 l=5]  *call
+	testl	%r15d, %r15d	# 2001	[c=4 l=3]  *cmpsi_ccno_1/0
+	je	.L412	# 2002	[c=13 l=2]  *jcc
+	movsbl	8(%rsp), %eax	# 2004	[c=13 l=5]  extendqisi2
+	addq	$1, 48(%r13)	# 2011	[c=13 l=5]  *adddi_1/0
+	addl	0(%r13), %eax	# 2006	[c=9 l=4]  *addsi_1/1
+	andl	992(%r13), %eax	# 2009	[c=13 l=7]  *andsi_1/1
+	movl	%eax, 0(%r13)	# 2010	[c=4 l=4]  *movsi_internal/1
+.L412:
+	movq	%r13, %rdi	# 2015	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 2014	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 2016	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 17165	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 17166	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 2018	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18883	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 2019	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 2021	[c=4 l=3]  *cmpdi_1/0
+	jb	.L344	# 2022	[c=13 l=6]  *jcc
+	movq	56(%r13), %rax	# 17167	[c=9 l=4]  *movdi_internal/3
+	cmpq	%rax, 48(%r13)	# 2025	[c=13 l=4]  *cmpdi_1/0
+	jnb	.L1501	# 2026	[c=13 l=6]  *jcc
+.L413:
+	movq	%r13, %rdi	# 2032	[c=4 l=3]  *movdi_internal/3
+	call	log_is_idle@PLT	# 2033	[c=10 l=5]  *call_value
+	testb	%al, %al	# 2035	[c=4 l=2]  *cmpqi_ccno_1/0
+	jne	.L1502	# 2036	[c=13 l=6]  *jcc
+.L414:
+	movl	0(%r13), %ebx	# 2047	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 2052	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 2048	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 2050	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 2051	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 2053	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 2054	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 2055	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 2058	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 17168	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 2059	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 2062	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 2063	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 20249	[c=10 l=4]  *indirect_jump
+.L415:
+	movl	$63, %eax	# 2072	[c=4 l=5]  *movsi_internal/0
+	movzbl	10(%rbx), %r14d	# 2071	[c=13 l=5]  *zero_extendqisi2/0
+	subl	5176(%r13), %eax	# 2073	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 2074	[c=13 l=7]  *cmpsi_1/1
+	jb	.L416	# 2075	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%r13)	# 2077	[c=13 l=8]  *cmpqi_ccno_1/1
+	jne	.L417	# 2078	[c=13 l=6]  *jcc
+.L416:
+	movq	1040(%r13), %rax	# 2081	[c=9 l=7]  *movdi_internal/3
+	movzbl	63(%rax), %r15d	# 2082	[c=13 l=5]  *zero_extendqisi2/0
+.L418:
+	movl	%r15d, %ecx	# 2093	[c=4 l=3]  *movsi_internal/0
+	movl	$63, %edx	# 2094	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 2097	[c=4 l=3]  *movdi_internal/3
+	orl	%r15d, %r14d	# 2099	[c=4 l=3]  *iorsi_1/0
+	leaq	.LC33(%rip), %rsi	# 2095	[c=1 l=7]  *movdi_internal/4
+	call	log_add_data_mov@PLT	# 2098	[c=0 l=5]  *call
+	movzbl	%r14b, %ecx	# 2100	[c=4 l=4]  *zero_extendqisi2/0
+	movl	$63, %edx	# 2102	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 2105	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC29(%rip), %rsi	# 2103	[c=1 l=7]  *movdi_internal/4
+	call	log_add_data_mov@PLT	# 2106	[c=0 l=5]  *call
+	movl	$63, %eax	# 2107	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 2108	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 2109	[c=13 l=7]  *cmpsi_1/1
+	jb	.L419	# 2110	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%r13)	# 2112	[c=13 l=8]  *cmpqi_ccno_1/1
+	jne	.L420	# 2113	[c=13 l=6]  *jcc
+.L419:
+	movq	1040(%r13), %rax	# 2116	[c=9 l=7]  *movdi_internal/3
+	movb	%r14b, 63(%rax)	# 2117	[c=4 l=4]  *movqi_internal/8
+.L421:
+	movq	%r13, %rdi	# 2129	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 2128	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 2130	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 17170	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 17171	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 2132	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18882	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 2133	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 2135	[c=4 l=3]  *cmpdi_1/0
+	jb	.L344	# 2136	[c=13 l=6]  *jcc
+	movl	0(%r13), %ebx	# 2138	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 2143	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 2139	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 2141	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 2142	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 2144	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 2145	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 2146	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 2149	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 17172	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 2150	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 2153	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 2154	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 20248	[c=10 l=4]  *indirect_jump
+.L422:
+	movzbl	10(%rbx), %r15d	# 2163	[c=13 l=5]  zero_extendqidi2/0
+	xorl	%eax, %eax	# 20244	[c=4 l=2]  *movdi_xor
+	movq	%r13, %rdi	# 2170	[c=4 l=3]  *movdi_internal/3
+	movzwl	12(%rbx), %r14d	# 2162	[c=13 l=5]  *zero_extendhisi2/0
+	leaq	.LC35(%rip), %rsi	# 2168	[c=1 l=7]  *movdi_internal/4
+	movzbl	1004(%r13,%r15), %ecx	# 2165	[c=14 l=9]  *zero_extendqisi2/0
+	movq	%r15, %rdx	# 19139	[c=4 l=3]  *movdi_internal/3
+	call	log_append@PLT	# 2172	[c=0 l=5]  *call
+	movzbl	1004(%r13,%r15), %eax	# 2174	[c=14 l=9]  *zero_extendqisi2/0
+	xorl	%r15d, %r15d	# 20245	[c=4 l=3]  *movsi_xor
+	testl	%r14d, %eax	# 20246	[c=4 l=3]  *testsi_1/0
+	movl	$63, %eax	# 2180	[c=4 l=5]  *movsi_internal/0
+	setne	%r15b	# 20247	[c=4 l=4]  *setcc_qi_slp
+	subl	5176(%r13), %eax	# 2181	[c=13 l=7]  *subsi_1/1
+	sall	$6, %r15d	# 2179	[c=4 l=4]  *ashlsi3_1/0
+	cmpl	5180(%r13), %eax	# 2182	[c=13 l=7]  *cmpsi_1/1
+	jb	.L423	# 2183	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%r13)	# 2185	[c=13 l=8]  *cmpqi_ccno_1/1
+	jne	.L424	# 2186	[c=13 l=6]  *jcc
+.L423:
+	movq	1040(%r13), %rax	# 2189	[c=9 l=7]  *movdi_internal/3
+	movzbl	63(%rax), %r14d	# 2190	[c=13 l=5]  *zero_extendqisi2/0
+.L425:
+	movl	%r14d, %ecx	# 2201	[c=4 l=3]  *movsi_internal/0
+	andl	$-65, %r14d	# 2207	[c=4 l=4]  *andsi_1/0
+	movl	$63, %edx	# 2202	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 2205	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC33(%rip), %rsi	# 2203	[c=1 l=7]  *movdi_internal/4
+	orl	%r15d, %r14d	# 2208	[c=4 l=3]  *iorsi_1/0
+	call	log_add_data_mov@PLT	# 2206	[c=0 l=5]  *call
+	movzbl	%r14b, %ecx	# 2209	[c=4 l=4]  *zero_extendqisi2/0
+	movl	$63, %edx	# 2211	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 2214	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC29(%rip), %rsi	# 2212	[c=1 l=7]  *movdi_internal/4
+	call	log_add_data_mov@PLT	# 2215	[c=0 l=5]  *call
+	movl	$63, %eax	# 2216	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 2217	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 2218	[c=13 l=7]  *cmpsi_1/1
+	jb	.L426	# 2219	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%r13)	# 2221	[c=13 l=8]  *cmpqi_ccno_1/1
+	jne	.L427	# 2222	[c=13 l=6]  *jcc
+.L426:
+	movq	1040(%r13), %rax	# 2225	[c=9 l=7]  *movdi_internal/3
+	movb	%r14b, 63(%rax)	# 2226	[c=4 l=4]  *movqi_internal/8
+.L428:
+	movq	%r13, %rdi	# 2238	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 2237	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 2239	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 17174	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 17175	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 2241	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18879	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 2242	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 2244	[c=4 l=3]  *cmpdi_1/0
+	jb	.L344	# 2245	[c=13 l=6]  *jcc
+	movl	0(%r13), %ebx	# 2247	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 2252	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 2248	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 2250	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 2251	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 2253	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 2254	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 2255	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 2258	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 17176	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 2259	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 2262	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 2263	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 20243	[c=10 l=4]  *indirect_jump
+.L429:
+	movzwl	12(%rbx), %eax	# 2271	[c=13 l=4]  *zero_extendhisi2/0
+	movl	5176(%r13), %ecx	# 2273	[c=9 l=7]  *movsi_internal/0
+	movl	5180(%r13), %r14d	# 2274	[c=9 l=7]  *movsi_internal/0
+	movl	%eax, 8(%rsp)	# 17178	[c=4 l=4]  *movsi_internal/1
+	movzbl	10(%rbx), %eax	# 2272	[c=13 l=4]  *zero_extendqisi2/0
+	movl	%eax, 16(%rsp)	# 17179	[c=4 l=4]  *movsi_internal/1
+	movl	$61, %eax	# 2275	[c=4 l=5]  *movsi_internal/0
+	subl	%ecx, %eax	# 2276	[c=4 l=2]  *subsi_1/0
+	cmpl	%r14d, %eax	# 2277	[c=4 l=3]  *cmpsi_1/0
+	jb	.L430	# 2278	[c=13 l=6]  *jcc
+	cmpb	$1, 1081(%r13)	# 2282	[c=13 l=8]  *cmpqi_1/0
+	ja	.L1503	# 2283	[c=13 l=6]  *jcc
+	movq	1040(%r13), %rax	# 14299	[c=9 l=7]  *movdi_internal/3
+	movzbl	61(%rax), %r15d	# 14300	[c=13 l=5]  *zero_extendqisi2/0
+.L432:
+	movzbl	62(%rax), %r8d	# 2320	[c=13 l=5]  *zero_extendqisi2/0
+.L434:
+	sall	$8, %r8d	# 2323	[c=4 l=4]  *ashlsi3_1/0
+	movl	$61, %edx	# 2326	[c=4 l=5]  *movsi_internal/0
+	leaq	.LC31(%rip), %rsi	# 2327	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 2329	[c=4 l=3]  *movdi_internal/3
+	orl	%r8d, %r15d	# 2324	[c=4 l=3]  *iorsi_1/0
+	movl	%r15d, %ecx	# 2325	[c=4 l=3]  *movsi_internal/0
+	call	log_add_data_mov@PLT	# 2330	[c=0 l=5]  *call
+	movl	996(%r13), %edx	# 2332	[c=9 l=7]  *movsi_internal/0
+	movzbl	840(%r13), %eax	# 2334	[c=13 l=8]  *zero_extendqisi2/0
+	leal	1(%rdx,%rax), %eax	# 2335	[c=5 l=4]  *leasi
+	cmpl	%eax, %r15d	# 2336	[c=4 l=3]  *cmpsi_1/0
+	jb	.L1382	# 2337	[c=13 l=6]  *jcc
+	cmpl	$63, %r15d	# 15274	[c=4 l=4]  *cmpsi_1/0
+	movl	0(%r13), %r14d	# 2345	[c=5 l=4]  *movsi_internal/0
+	leal	-1(%r15), %r9d	# 18878	[c=4 l=4]  *leasi
+	movl	%r15d, %edx	# 2354	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC30(%rip), %rax	# 16919	[c=1 l=7]  *movdi_internal/4
+	leaq	.LC29(%rip), %rsi	# 16918	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 2356	[c=4 l=3]  *movdi_internal/3
+	movl	%r9d, 24(%rsp)	# 18195	[c=4 l=5]  *movsi_internal/1
+	cmovne	%rax, %rsi	# 15275	[c=8 l=4]  *movdicc_noc/1
+	movzbl	%r14b, %ecx	# 2347	[c=4 l=4]  *zero_extendqisi2/0
+	call	log_add_data_mov@PLT	# 2357	[c=0 l=5]  *call
+	movl	%r15d, %eax	# 17180	[c=4 l=3]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 2358	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 2359	[c=13 l=7]  *cmpsi_1/1
+	movl	24(%rsp), %r9d	# 18196	[c=9 l=5]  *movsi_internal/0
+	jb	.L437	# 2360	[c=13 l=2]  *jcc
+	movl	%r15d, %eax	# 17182	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %eax	# 2362	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 16891	[c=5 l=5]  *andsi_1_zext
+	cmpb	$0, 1080(%r13,%rax)	# 2365	[c=14 l=9]  *cmpqi_ccno_1/1
+	jne	.L438	# 2366	[c=13 l=6]  *jcc
+.L437:
+	movq	1040(%r13), %rdx	# 2370	[c=9 l=7]  *movdi_internal/3
+	movslq	%r15d, %rax	# 2369	[c=4 l=3]  *extendsidi2_rex64/1
+	movb	%r14b, (%rdx,%rax)	# 2371	[c=4 l=4]  *movqi_internal/8
+.L439:
+	movl	0(%r13), %ecx	# 2382	[c=5 l=4]  *movsi_internal/0
+	movl	%r9d, %edx	# 2392	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 2394	[c=4 l=3]  *movdi_internal/3
+	movl	%r9d, 32(%rsp)	# 18199	[c=4 l=5]  *movsi_internal/1
+	leaq	.LC29(%rip), %rsi	# 16920	[c=1 l=7]  *movdi_internal/4
+	leal	-2(%r15), %r14d	# 18877	[c=4 l=4]  *leasi
+	movl	%ecx, %eax	# 17184	[c=4 l=2]  *movsi_internal/0
+	movzbl	%ch, %ecx	# 2385	[c=4 l=3]  *extzvsi
+	shrl	$8, %eax	# 2383	[c=4 l=3]  *lshrsi3_1/0
+	cmpl	$63, %r9d	# 15286	[c=4 l=4]  *cmpsi_1/0
+	movl	%eax, 24(%rsp)	# 17185	[c=4 l=4]  *movsi_internal/1
+	leaq	.LC30(%rip), %rax	# 16921	[c=1 l=7]  *movdi_internal/4
+	cmovne	%rax, %rsi	# 15287	[c=8 l=4]  *movdicc_noc/1
+	call	log_add_data_mov@PLT	# 2395	[c=0 l=5]  *call
+	movslq	32(%rsp), %r9	# 18200	[c=13 l=5]  *extendsidi2_rex64/1
+	movl	%r9d, %eax	# 17186	[c=4 l=3]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 2396	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 2397	[c=13 l=7]  *cmpsi_1/1
+	jb	.L441	# 2398	[c=13 l=2]  *jcc
+	movl	%r9d, %eax	# 17188	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %eax	# 2400	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 16890	[c=5 l=5]  *andsi_1_zext
+	cmpb	$0, 1080(%r13,%rax)	# 2403	[c=14 l=9]  *cmpqi_ccno_1/1
+	jne	.L442	# 2404	[c=13 l=6]  *jcc
+.L441:
+	movq	1040(%r13), %rax	# 2408	[c=9 l=7]  *movdi_internal/3
+	movzbl	24(%rsp), %edi	# 17190	[c=9 l=5]  *movqi_internal/4
+	movb	%dil, (%rax,%r9)	# 2409	[c=4 l=4]  *movqi_internal/8
+.L443:
+	cmpb	$0, 840(%r13)	# 2420	[c=13 l=8]  *cmpqi_ccno_1/1
+	je	.L444	# 2421	[c=13 l=2]  *jcc
+	movl	0(%r13), %eax	# 17191	[c=5 l=4]  *movsi_internal/0
+	subl	$3, %r15d	# 2425	[c=4 l=4]  *addsi_1/0
+	movq	%r13, %rdi	# 2435	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC30(%rip), %rdx	# 16923	[c=1 l=7]  *movdi_internal/4
+	leaq	.LC29(%rip), %rsi	# 16922	[c=1 l=7]  *movdi_internal/4
+	shrl	$16, %eax	# 2424	[c=4 l=3]  *lshrsi3_1/0
+	cmpl	$63, %r14d	# 15298	[c=4 l=4]  *cmpsi_1/0
+	cmovne	%rdx, %rsi	# 15299	[c=8 l=4]  *movdicc_noc/1
+	movzbl	%al, %ecx	# 2426	[c=4 l=3]  *zero_extendqisi2/0
+	movl	%r14d, %edx	# 2433	[c=4 l=3]  *movsi_internal/0
+	movl	%eax, 24(%rsp)	# 18201	[c=4 l=4]  *movsi_internal/1
+	call	log_add_data_mov@PLT	# 2436	[c=0 l=5]  *call
+	movl	%r14d, %edx	# 17193	[c=4 l=3]  *movsi_internal/0
+	subl	5176(%r13), %edx	# 2437	[c=13 l=7]  *subsi_1/1
+	movl	24(%rsp), %eax	# 18202	[c=9 l=4]  *movsi_internal/0
+	cmpl	5180(%r13), %edx	# 2438	[c=13 l=7]  *cmpsi_1/1
+	jb	.L446	# 2439	[c=13 l=2]  *jcc
+	movl	%r14d, %edx	# 17195	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %edx	# 2441	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %edx	# 16889	[c=5 l=6]  *andsi_1_zext
+	cmpb	$0, 1080(%r13,%rdx)	# 2444	[c=14 l=9]  *cmpqi_ccno_1/1
+	jne	.L447	# 2445	[c=13 l=6]  *jcc
+.L446:
+	movq	1040(%r13), %rdx	# 2449	[c=9 l=7]  *movdi_internal/3
+	movslq	%r14d, %r14	# 2448	[c=4 l=3]  *extendsidi2_rex64/1
+	movb	%al, (%rdx,%r14)	# 2450	[c=4 l=4]  *movqi_internal/8
+.L448:
+	movl	%r15d, %r14d	# 12	[c=4 l=3]  *movsi_internal/0
+.L444:
+	movzwl	%r14w, %r15d	# 2465	[c=4 l=4]  *zero_extendhisi2/0
+	movl	$61, %edx	# 2467	[c=4 l=5]  *movsi_internal/0
+	leaq	.LC32(%rip), %rsi	# 2468	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 2470	[c=4 l=3]  *movdi_internal/3
+	movl	%r15d, %ecx	# 2466	[c=4 l=3]  *movsi_internal/0
+	call	log_add_data_mov@PLT	# 2471	[c=0 l=5]  *call
+	movl	$61, %edx	# 2472	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r13), %edx	# 2473	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %edx	# 2474	[c=13 l=7]  *cmpsi_1/1
+	jb	.L449	# 2475	[c=13 l=2]  *jcc
+	cmpb	$1, 1081(%r13)	# 2479	[c=13 l=8]  *cmpqi_1/0
+	ja	.L1504	# 2480	[c=13 l=6]  *jcc
+.L449:
+	movq	1040(%r13), %rdx	# 2491	[c=9 l=7]  *movdi_internal/3
+	movb	%r14b, 61(%rdx)	# 2492	[c=4 l=4]  *movqi_internal/8
+.L450:
+	movl	%r15d, %eax	# 17197	[c=4 l=3]  *movsi_internal/0
+	movl	$62, %edx	# 2496	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r13), %edx	# 2497	[c=13 l=7]  *subsi_1/1
+	sarl	$8, %eax	# 2495	[c=4 l=3]  *ashrsi3_1/0
+	cmpl	5180(%r13), %edx	# 2498	[c=13 l=7]  *cmpsi_1/1
+	jb	.L451	# 2499	[c=13 l=2]  *jcc
+	cmpb	$1, 1081(%r13)	# 2503	[c=13 l=8]  *cmpqi_1/0
+	ja	.L1505	# 2504	[c=13 l=6]  *jcc
+.L451:
+	movq	1040(%r13), %rdx	# 2514	[c=9 l=7]  *movdi_internal/3
+	movb	%al, 62(%rdx)	# 2515	[c=4 l=3]  *movqi_internal/8
+.L452:
+	movl	16(%rsp), %esi	# 17199	[c=9 l=4]  *movsi_internal/0
+	movl	8(%rsp), %eax	# 17201	[c=9 l=4]  *movsi_internal/0
+	sall	$16, %esi	# 2518	[c=4 l=3]  *ashlsi3_1/0
+	orl	%eax, %esi	# 2519	[c=4 l=2]  *iorsi_1/0
+	movl	%esi, 0(%r13)	# 2520	[c=4 l=4]  *movsi_internal/1
+	cmpl	%esi, 992(%r13)	# 2521	[c=13 l=7]  *cmpsi_1/0
+	jb	.L1380	# 2522	[c=13 l=6]  *jcc
+	movzbl	840(%r13), %eax	# 2530	[c=13 l=8]  zero_extendqidi2/0
+	addq	%rax, 48(%r13)	# 2531	[c=13 l=4]  *adddi_1/0
+	movq	%r13, %rdi	# 2533	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 2532	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 2534	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 17202	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 17203	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 2536	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18876	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 2537	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 2539	[c=4 l=3]  *cmpdi_1/0
+	jb	.L344	# 2540	[c=13 l=6]  *jcc
+	movq	56(%r13), %rax	# 17204	[c=9 l=4]  *movdi_internal/3
+	cmpq	%rax, 48(%r13)	# 2543	[c=13 l=4]  *cmpdi_1/0
+	jnb	.L1506	# 2544	[c=13 l=6]  *jcc
+.L454:
+	movq	%r13, %rdi	# 2550	[c=4 l=3]  *movdi_internal/3
+	call	log_is_idle@PLT	# 2551	[c=10 l=5]  *call_value
+	testb	%al, %al	# 2553	[c=4 l=2]  *cmpqi_ccno_1/0
+	jne	.L1507	# 2554	[c=13 l=6]  *jcc
+.L455:
+	movl	0(%r13), %ebx	# 2565	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 2570	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 2566	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 2568	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 2569	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 2571	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 2572	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 2573	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 2576	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 17205	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 2577	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 2580	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 2581	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 20242	[c=10 l=4]  *indirect_jump
+.L456:
+	movzwl	12(%rbx), %eax	# 2589	[c=13 l=4]  *zero_extendhisi2/0
+	movzbl	10(%rbx), %r14d	# 2590	[c=13 l=5]  *zero_extendqisi2/0
+	movl	%eax, 16(%rsp)	# 17207	[c=4 l=4]  *movsi_internal/1
+	movl	%r14d, %eax	# 19140	[c=4 l=3]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 2593	[c=13 l=7]  *subsi_1/1
+	movb	%r14b, 8(%rsp)	# 18203	[c=4 l=5]  *movqi_internal/8
+	cmpl	5180(%r13), %eax	# 2594	[c=13 l=7]  *cmpsi_1/1
+	jb	.L457	# 2595	[c=13 l=2]  *jcc
+	movl	%r14d, %eax	# 17212	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %eax	# 2597	[c=4 l=3]  *ashrsi3_1/0
+	cltq	# 2598	[c=4 l=2]  *extendsidi2_rex64/0
+	cmpb	$0, 1080(%r13,%rax)	# 2599	[c=14 l=9]  *cmpqi_ccno_1/1
+	jne	.L458	# 2600	[c=13 l=6]  *jcc
+.L457:
+	movzbl	8(%rsp), %eax	# 2603	[c=13 l=5]  zero_extendqidi2/0
+	movq	1040(%r13), %rdx	# 2604	[c=9 l=7]  *movdi_internal/3
+	movzbl	(%rdx,%rax), %ecx	# 2605	[c=13 l=4]  *zero_extendqisi2/0
+.L459:
+	cmpl	$63, %r14d	# 15310	[c=4 l=4]  *cmpsi_1/0
+	movl	%r14d, %edx	# 2622	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 2624	[c=4 l=3]  *movdi_internal/3
+	movl	%ecx, 24(%rsp)	# 18204	[c=4 l=4]  *movsi_internal/1
+	leaq	.LC25(%rip), %rax	# 16925	[c=1 l=7]  *movdi_internal/4
+	leaq	.LC33(%rip), %rsi	# 16924	[c=1 l=7]  *movdi_internal/4
+	cmovne	%rax, %rsi	# 15311	[c=8 l=4]  *movdicc_noc/1
+	call	log_add_data_mov@PLT	# 2625	[c=0 l=5]  *call
+	cmpl	6564(%r13), %r14d	# 2626	[c=13 l=7]  *cmpsi_1/1
+	movl	24(%rsp), %ecx	# 18205	[c=9 l=4]  *movsi_internal/0
+	jnb	.L461	# 2627	[c=13 l=6]  *jcc
+	movslq	%r14d, %rdx	# 2629	[c=4 l=3]  *extendsidi2_rex64/1
+	xorl	%r15d, %r15d	# 20241	[c=4 l=3]  *movdi_xor
+	cmpb	$0, 6568(%r13,%rdx)	# 2632	[c=14 l=9]  *cmpqi_ccno_1/1
+	jns	.L461	# 2633	[c=13 l=6]  *jcc
+.L462:
+	cmpl	$63, %r14d	# 15322	[c=4 l=4]  *cmpsi_1/0
+	leaq	.LC30(%rip), %rdx	# 16927	[c=1 l=7]  *movdi_internal/4
+	movzbl	%r15b, %ecx	# 2640	[c=4 l=4]  *zero_extendqisi2/0
+	movq	%r13, %rdi	# 2649	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC29(%rip), %rsi	# 16926	[c=1 l=7]  *movdi_internal/4
+	cmovne	%rdx, %rsi	# 15323	[c=8 l=4]  *movdicc_noc/1
+	movl	%r14d, %edx	# 2647	[c=4 l=3]  *movsi_internal/0
+	call	log_add_data_mov@PLT	# 2650	[c=0 l=5]  *call
+	movl	%r14d, %edx	# 17217	[c=4 l=3]  *movsi_internal/0
+	subl	5176(%r13), %edx	# 2651	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %edx	# 2652	[c=13 l=7]  *cmpsi_1/1
+	jb	.L464	# 2653	[c=13 l=2]  *jcc
+	movl	%r14d, %edx	# 17219	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %edx	# 2655	[c=4 l=3]  *ashrsi3_1/0
+	movslq	%edx, %rdx	# 2656	[c=4 l=3]  *extendsidi2_rex64/1
+	cmpb	$0, 1080(%r13,%rdx)	# 2657	[c=14 l=9]  *cmpqi_ccno_1/1
+	jne	.L465	# 2658	[c=13 l=6]  *jcc
+.L464:
+	movzbl	8(%rsp), %r14d	# 2661	[c=13 l=6]  zero_extendqidi2/0
+	movq	1040(%r13), %rdx	# 2662	[c=9 l=7]  *movdi_internal/3
+	movb	%r15b, (%rdx,%r14)	# 2663	[c=4 l=4]  *movqi_internal/8
+.L466:
+	movq	%r13, %rdi	# 2675	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 2674	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 2676	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 17222	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 17223	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 2678	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18875	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 2679	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 2681	[c=4 l=3]  *cmpdi_1/0
+	jb	.L344	# 2682	[c=13 l=6]  *jcc
+	movl	0(%r13), %ebx	# 2684	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 2689	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 2685	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 2687	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 2688	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 2690	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 2691	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 2692	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 2695	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 17224	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 2696	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 2699	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 2700	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 20240	[c=10 l=4]  *indirect_jump
+.L461:
+	movl	16(%rsp), %r15d	# 17215	[c=9 l=5]  *movsi_internal/0
+	notl	%r15d	# 2636	[c=4 l=3]  *one_cmplsi2_1/0
+	andl	%ecx, %r15d	# 2637	[c=4 l=3]  *andsi_1/0
+	jmp	.L462	# 20349	[c=1 l=5]  jump
+.L467:
+	movzbl	10(%rbx), %r14d	# 2708	[c=13 l=5]  zero_extendqidi2/0
+	leaq	.LC35(%rip), %rsi	# 2713	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 2715	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 20238	[c=4 l=2]  *movdi_xor
+	movzbl	1004(%r13,%r14), %ecx	# 2710	[c=14 l=9]  *zero_extendqisi2/0
+	movq	%r14, %rdx	# 19141	[c=4 l=3]  *movdi_internal/3
+	movl	%r14d, 16(%rsp)	# 18208	[c=4 l=5]  *movsi_internal/1
+	call	log_append@PLT	# 2717	[c=0 l=5]  *call
+	movl	16(%rsp), %edx	# 18209	[c=9 l=4]  *movsi_internal/0
+	xorl	%eax, %eax	# 20239	[c=4 l=2]  *movdi_xor
+	movq	%r13, %rdi	# 2726	[c=4 l=3]  *movdi_internal/3
+	movzbl	1004(%r13,%r14), %r15d	# 17226	[c=10 l=9]  *movqi_internal/4
+	leaq	.LC36(%rip), %rsi	# 2724	[c=1 l=7]  *movdi_internal/4
+	notl	%r15d	# 18873	[c=4 l=3]  *one_cmplsi2_1/0
+	movzbl	%r15b, %ecx	# 2721	[c=4 l=4]  *zero_extendqisi2/0
+	movl	%ecx, 8(%rsp)	# 18206	[c=4 l=4]  *movsi_internal/1
+	call	log_append@PLT	# 2728	[c=0 l=5]  *call
+	movb	%r15b, 1004(%r13,%r14)	# 2730	[c=4 l=8]  *movqi_internal/8
+	movslq	8(%rsp), %r14	# 18207	[c=13 l=5]  *extendsidi2_rex64/1
+	leaq	flag_update_table_logical(%rip), %rax	# 16899	[c=1 l=7]  *movdi_internal/4
+	movzbl	(%rax,%r14), %r15d	# 2733	[c=9 l=5]  *movqi_internal/4
+	movl	$63, %eax	# 2736	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 2737	[c=13 l=7]  *subsi_1/1
+	orl	$1, %r15d	# 18874	[c=4 l=4]  *iorsi_1/0
+	movzbl	%r15b, %r15d	# 2735	[c=4 l=4]  *zero_extendqisi2/0
+	cmpl	5180(%r13), %eax	# 2738	[c=13 l=7]  *cmpsi_1/1
+	jb	.L468	# 2739	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%r13)	# 2741	[c=13 l=8]  *cmpqi_ccno_1/1
+	jne	.L469	# 2742	[c=13 l=6]  *jcc
+.L468:
+	movq	1040(%r13), %rax	# 2745	[c=9 l=7]  *movdi_internal/3
+	movzbl	63(%rax), %r14d	# 2746	[c=13 l=5]  *zero_extendqisi2/0
+.L470:
+	movl	%r14d, %ecx	# 2757	[c=4 l=3]  *movsi_internal/0
+	andl	$-32, %r14d	# 2763	[c=4 l=4]  *andsi_1/0
+	movl	$63, %edx	# 2758	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 2761	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC33(%rip), %rsi	# 2759	[c=1 l=7]  *movdi_internal/4
+	orl	%r15d, %r14d	# 2764	[c=4 l=3]  *iorsi_1/0
+	call	log_add_data_mov@PLT	# 2762	[c=0 l=5]  *call
+	movzbl	%r14b, %ecx	# 2765	[c=4 l=4]  *zero_extendqisi2/0
+	movl	$63, %edx	# 2767	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 2770	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC29(%rip), %rsi	# 2768	[c=1 l=7]  *movdi_internal/4
+	call	log_add_data_mov@PLT	# 2771	[c=0 l=5]  *call
+	movl	$63, %eax	# 2772	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 2773	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 2774	[c=13 l=7]  *cmpsi_1/1
+	jb	.L471	# 2775	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%r13)	# 2777	[c=13 l=8]  *cmpqi_ccno_1/1
+	jne	.L472	# 2778	[c=13 l=6]  *jcc
+.L471:
+	movq	1040(%r13), %rax	# 2781	[c=9 l=7]  *movdi_internal/3
+	movb	%r14b, 63(%rax)	# 2782	[c=4 l=4]  *movqi_internal/8
+.L473:
+	movq	%r13, %rdi	# 2794	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 2793	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 2795	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 17228	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 17229	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 2797	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18872	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 2798	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 2800	[c=4 l=3]  *cmpdi_1/0
+	jb	.L344	# 2801	[c=13 l=6]  *jcc
+	movl	0(%r13), %ebx	# 2803	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 2808	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 2804	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 2806	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 2807	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 2809	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 2810	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 2811	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 2814	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 17230	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 2815	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 2818	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 2819	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 20237	[c=10 l=4]  *indirect_jump
+.L474:
+	movzbl	10(%rbx), %r14d	# 2828	[c=13 l=5]  zero_extendqidi2/0
+	movzwl	12(%rbx), %r8d	# 2827	[c=13 l=5]  *zero_extendhisi2/0
+	movq	%r13, %rdi	# 2835	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 20235	[c=4 l=2]  *movdi_xor
+	leaq	.LC35(%rip), %rsi	# 2833	[c=1 l=7]  *movdi_internal/4
+	movzbl	1004(%r13,%r14), %ecx	# 2830	[c=14 l=9]  *zero_extendqisi2/0
+	movq	%r14, %rdx	# 19143	[c=4 l=3]  *movdi_internal/3
+	movl	%r8d, 8(%rsp)	# 18212	[c=4 l=5]  *movsi_internal/1
+	call	log_append@PLT	# 2837	[c=0 l=5]  *call
+	movslq	8(%rsp), %r15	# 18213	[c=13 l=5]  *extendsidi2_rex64/1
+	xorl	%eax, %eax	# 20236	[c=4 l=2]  *movdi_xor
+	movq	%r13, %rdi	# 2846	[c=4 l=3]  *movdi_internal/3
+	movzbl	1004(%r13,%r14), %r14d	# 2839	[c=14 l=9]  *zero_extendqisi2/0
+	leaq	.LC35(%rip), %rsi	# 18211	[c=1 l=7]  *movdi_internal/4
+	movzbl	1004(%r13,%r15), %ecx	# 2841	[c=14 l=9]  *zero_extendqisi2/0
+	movl	%r15d, %edx	# 2843	[c=4 l=3]  *movsi_internal/0
+	call	log_append@PLT	# 2848	[c=0 l=5]  *call
+	movl	%r14d, %ecx	# 17232	[c=4 l=3]  *movsi_internal/0
+	movzbl	1004(%r13,%r15), %edx	# 2850	[c=14 l=9]  *zero_extendqisi2/0
+	andl	$136, %ecx	# 2852	[c=4 l=6]  *andsi_1/0
+	movl	%edx, %eax	# 17234	[c=4 l=2]  *movsi_internal/0
+	subl	%edx, %r14d	# 2859	[c=4 l=3]  *subsi_1/0
+	andl	$136, %eax	# 2855	[c=4 l=5]  *andsi_1/0
+	andl	$511, %r14d	# 2860	[c=4 l=7]  *andsi_1/0
+	leal	(%rax,%rcx,2), %eax	# 2856	[c=8 l=3]  *leasi
+	imull	$260, %eax, %eax	# 2861	[c=12 l=6]  *mulsi3_1/1
+	andl	$7680, %eax	# 2862	[c=4 l=5]  *andsi_1/0
+	orl	%eax, %r14d	# 2863	[c=5 l=3]  *iorsi_1_zext
+	movl	$63, %eax	# 2864	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 2865	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 2866	[c=13 l=7]  *cmpsi_1/1
+	jb	.L475	# 2867	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%r13)	# 2869	[c=13 l=8]  *cmpqi_ccno_1/1
+	jne	.L476	# 2870	[c=13 l=6]  *jcc
+.L475:
+	movq	1040(%r13), %rax	# 2873	[c=9 l=7]  *movdi_internal/3
+	movzbl	63(%rax), %r15d	# 2874	[c=13 l=5]  *zero_extendqisi2/0
+.L477:
+	movl	%r15d, %ecx	# 2885	[c=4 l=3]  *movsi_internal/0
+	movl	$63, %edx	# 2886	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 2889	[c=4 l=3]  *movdi_internal/3
+	andl	$-64, %r15d	# 2891	[c=4 l=4]  *andsi_1/0
+	leaq	.LC33(%rip), %rsi	# 2887	[c=1 l=7]  *movdi_internal/4
+	call	log_add_data_mov@PLT	# 2890	[c=0 l=5]  *call
+	leaq	flag_update_table_sub8(%rip), %rax	# 16900	[c=1 l=7]  *movdi_internal/4
+	movl	$63, %edx	# 2898	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 2901	[c=4 l=3]  *movdi_internal/3
+	movzbl	(%rax,%r14), %eax	# 2894	[c=13 l=5]  *zero_extendqisi2/0
+	leaq	.LC29(%rip), %rsi	# 2899	[c=1 l=7]  *movdi_internal/4
+	orl	%eax, %r15d	# 2895	[c=4 l=3]  *iorsi_1/0
+	movzbl	%r15b, %ecx	# 2896	[c=4 l=4]  *zero_extendqisi2/0
+	call	log_add_data_mov@PLT	# 2902	[c=0 l=5]  *call
+	movl	$63, %eax	# 2903	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 2904	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 2905	[c=13 l=7]  *cmpsi_1/1
+	jb	.L478	# 2906	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%r13)	# 2908	[c=13 l=8]  *cmpqi_ccno_1/1
+	jne	.L479	# 2909	[c=13 l=6]  *jcc
+.L478:
+	movq	1040(%r13), %rax	# 2912	[c=9 l=7]  *movdi_internal/3
+	movb	%r15b, 63(%rax)	# 2913	[c=4 l=4]  *movqi_internal/8
+.L480:
+	movq	%r13, %rdi	# 2925	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 2924	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 2926	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 17236	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 17237	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 2928	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18871	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 2929	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 2931	[c=4 l=3]  *cmpdi_1/0
+	jb	.L344	# 2932	[c=13 l=6]  *jcc
+	movl	0(%r13), %ebx	# 2934	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 2939	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 2935	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 2937	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 2938	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 2940	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 2941	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 2942	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 2945	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 17238	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 2946	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 2949	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 2950	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 20234	[c=10 l=4]  *indirect_jump
+.L481:
+	movzbl	10(%rbx), %r14d	# 2959	[c=13 l=5]  zero_extendqidi2/0
+	movzwl	12(%rbx), %r8d	# 2958	[c=13 l=5]  *zero_extendhisi2/0
+	movq	%r13, %rdi	# 2966	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 20232	[c=4 l=2]  *movdi_xor
+	leaq	.LC35(%rip), %rsi	# 2964	[c=1 l=7]  *movdi_internal/4
+	movzbl	1004(%r13,%r14), %ecx	# 2961	[c=14 l=9]  *zero_extendqisi2/0
+	movq	%r14, %rdx	# 19145	[c=4 l=3]  *movdi_internal/3
+	movl	%r8d, 8(%rsp)	# 18216	[c=4 l=5]  *movsi_internal/1
+	call	log_append@PLT	# 2968	[c=0 l=5]  *call
+	movslq	8(%rsp), %r15	# 18217	[c=13 l=5]  *extendsidi2_rex64/1
+	xorl	%eax, %eax	# 20233	[c=4 l=2]  *movdi_xor
+	movq	%r13, %rdi	# 2977	[c=4 l=3]  *movdi_internal/3
+	movzbl	1004(%r13,%r14), %r14d	# 2970	[c=10 l=9]  *movqi_internal/4
+	leaq	.LC35(%rip), %rsi	# 18215	[c=1 l=7]  *movdi_internal/4
+	movzbl	1004(%r13,%r15), %ecx	# 2972	[c=14 l=9]  *zero_extendqisi2/0
+	movl	%r15d, %edx	# 2974	[c=4 l=3]  *movsi_internal/0
+	call	log_append@PLT	# 2979	[c=0 l=5]  *call
+	movq	1040(%r13), %rax	# 2982	[c=9 l=7]  *movdi_internal/3
+	movl	%r14d, %ecx	# 17240	[c=4 l=3]  *movsi_internal/0
+	movzbl	1004(%r13,%r15), %esi	# 2981	[c=14 l=9]  *zero_extendqisi2/0
+	andl	$136, %ecx	# 2985	[c=4 l=6]  *andsi_1/0
+	movzbl	63(%rax), %r15d	# 2983	[c=13 l=5]  *zero_extendqisi2/0
+	movl	%esi, %eax	# 17242	[c=4 l=2]  *movsi_internal/0
+	andl	$136, %eax	# 2988	[c=4 l=5]  *andsi_1/0
+	leal	(%rax,%rcx,2), %ecx	# 2989	[c=8 l=3]  *leasi
+	movzbl	%r14b, %eax	# 2992	[c=4 l=4]  *zero_extendqisi2/0
+	movl	%r15d, %edx	# 19147	[c=4 l=3]  *movsi_internal/0
+	subl	%esi, %eax	# 2994	[c=4 l=2]  *subsi_1/0
+	imull	$260, %ecx, %ecx	# 2999	[c=12 l=6]  *mulsi3_1/1
+	movl	%r15d, %esi	# 17244	[c=4 l=3]  *movsi_internal/0
+	orl	$-3, %edx	# 3004	[c=4 l=3]  *iorsi_1/0
+	andl	$1, %esi	# 2996	[c=4 l=3]  *andsi_1/0
+	subl	%esi, %eax	# 2997	[c=4 l=2]  *subsi_1/0
+	andl	$7680, %ecx	# 3000	[c=4 l=6]  *andsi_1/0
+	andl	$511, %eax	# 2998	[c=4 l=5]  *andsi_1/0
+	orl	%ecx, %eax	# 3001	[c=5 l=2]  *iorsi_1_zext
+	leaq	flag_update_table_sub8(%rip), %rcx	# 16901	[c=1 l=7]  *movdi_internal/4
+	movzbl	(%rcx,%rax), %r14d	# 3003	[c=13 l=5]  *zero_extendqisi2/0
+	movl	$63, %eax	# 3006	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 3007	[c=13 l=7]  *subsi_1/1
+	andl	%edx, %r14d	# 3005	[c=4 l=3]  *andsi_1/0
+	cmpl	5180(%r13), %eax	# 3008	[c=13 l=7]  *cmpsi_1/1
+	jb	.L482	# 3009	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%r13)	# 3011	[c=13 l=8]  *cmpqi_ccno_1/1
+	jne	.L1508	# 3012	[c=13 l=6]  *jcc
+.L482:
+	movl	%r15d, %ecx	# 3020	[c=4 l=3]  *movsi_internal/0
+	andl	$-64, %r15d	# 3026	[c=4 l=4]  *andsi_1/0
+	movl	$63, %edx	# 3021	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 3024	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC33(%rip), %rsi	# 3022	[c=1 l=7]  *movdi_internal/4
+	orl	%r14d, %r15d	# 3027	[c=4 l=3]  *iorsi_1/0
+	call	log_add_data_mov@PLT	# 3025	[c=0 l=5]  *call
+	movzbl	%r15b, %ecx	# 3028	[c=4 l=4]  *zero_extendqisi2/0
+	movl	$63, %edx	# 3030	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 3033	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC29(%rip), %rsi	# 3031	[c=1 l=7]  *movdi_internal/4
+	call	log_add_data_mov@PLT	# 3034	[c=0 l=5]  *call
+	movl	$63, %eax	# 3035	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 3036	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 3037	[c=13 l=7]  *cmpsi_1/1
+	jb	.L483	# 3038	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%r13)	# 3040	[c=13 l=8]  *cmpqi_ccno_1/1
+	jne	.L484	# 3041	[c=13 l=6]  *jcc
+.L483:
+	movq	1040(%r13), %rax	# 3044	[c=9 l=7]  *movdi_internal/3
+	movb	%r15b, 63(%rax)	# 3045	[c=4 l=4]  *movqi_internal/8
+.L485:
+	movq	%r13, %rdi	# 3057	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 3056	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 3058	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 17246	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 17247	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 3060	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18870	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 3061	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 3063	[c=4 l=3]  *cmpdi_1/0
+	jb	.L344	# 3064	[c=13 l=6]  *jcc
+	movl	0(%r13), %ebx	# 3066	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 3071	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 3067	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 3069	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 3070	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 3072	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 3073	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 3074	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 3077	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 17248	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 3078	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 3081	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 3082	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 20231	[c=10 l=4]  *indirect_jump
+.L486:
+	movzwl	12(%rbx), %r15d	# 3090	[c=13 l=5]  *zero_extendhisi2/0
+	movzbl	10(%rbx), %r9d	# 3092	[c=13 l=5]  *zero_extendqisi2/0
+	movq	%r13, %rdi	# 3096	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 20229	[c=4 l=2]  *movdi_xor
+	leaq	.LC61(%rip), %rsi	# 3094	[c=1 l=7]  *movdi_internal/4
+	movl	%r15d, %edx	# 3093	[c=4 l=3]  *movsi_internal/0
+	movl	%r9d, 8(%rsp)	# 18220	[c=4 l=5]  *movsi_internal/1
+	call	log_append@PLT	# 3098	[c=0 l=5]  *call
+	movslq	8(%rsp), %r8	# 18221	[c=13 l=5]  *extendsidi2_rex64/1
+	xorl	%eax, %eax	# 20230	[c=4 l=2]  *movdi_xor
+	movq	%r13, %rdi	# 3105	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC35(%rip), %rsi	# 3103	[c=1 l=7]  *movdi_internal/4
+	movzbl	1004(%r13,%r8), %ecx	# 3100	[c=14 l=9]  *zero_extendqisi2/0
+	movl	%r8d, %edx	# 3102	[c=4 l=3]  *movsi_internal/0
+	movq	%r8, 8(%rsp)	# 18218	[c=4 l=5]  *movdi_internal/5
+	call	log_append@PLT	# 3107	[c=0 l=5]  *call
+	movq	8(%rsp), %r8	# 18219	[c=9 l=5]  *movdi_internal/3
+	movl	%r15d, %edx	# 17252	[c=4 l=3]  *movsi_internal/0
+	andl	$136, %edx	# 3114	[c=4 l=6]  *andsi_1/0
+	movzbl	1004(%r13,%r8), %eax	# 3109	[c=10 l=9]  *movqi_internal/4
+	movl	%eax, %ecx	# 17250	[c=4 l=2]  *movsi_internal/0
+	movzbl	%al, %r14d	# 3116	[c=4 l=4]  *zero_extendqisi2/0
+	andl	$136, %ecx	# 3111	[c=4 l=6]  *andsi_1/0
+	subl	%r15d, %r14d	# 3117	[c=4 l=3]  *subsi_1/0
+	leal	(%rdx,%rcx,2), %edx	# 3115	[c=8 l=3]  *leasi
+	andl	$511, %r14d	# 3118	[c=4 l=7]  *andsi_1/0
+	imull	$260, %edx, %eax	# 3119	[c=12 l=6]  *mulsi3_1/1
+	andl	$7680, %eax	# 3120	[c=4 l=5]  *andsi_1/0
+	orl	%eax, %r14d	# 3121	[c=5 l=3]  *iorsi_1_zext
+	movl	$63, %eax	# 3122	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 3123	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 3124	[c=13 l=7]  *cmpsi_1/1
+	jb	.L487	# 3125	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%r13)	# 3127	[c=13 l=8]  *cmpqi_ccno_1/1
+	jne	.L488	# 3128	[c=13 l=6]  *jcc
+.L487:
+	movq	1040(%r13), %rax	# 3131	[c=9 l=7]  *movdi_internal/3
+	movzbl	63(%rax), %r15d	# 3132	[c=13 l=5]  *zero_extendqisi2/0
+.L489:
+	movl	%r15d, %ecx	# 3143	[c=4 l=3]  *movsi_internal/0
+	movl	$63, %edx	# 3144	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 3147	[c=4 l=3]  *movdi_internal/3
+	andl	$-64, %r15d	# 3149	[c=4 l=4]  *andsi_1/0
+	leaq	.LC33(%rip), %rsi	# 3145	[c=1 l=7]  *movdi_internal/4
+	call	log_add_data_mov@PLT	# 3148	[c=0 l=5]  *call
+	leaq	flag_update_table_sub8(%rip), %rax	# 16902	[c=1 l=7]  *movdi_internal/4
+	movl	$63, %edx	# 3156	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 3159	[c=4 l=3]  *movdi_internal/3
+	movzbl	(%rax,%r14), %eax	# 3152	[c=13 l=5]  *zero_extendqisi2/0
+	leaq	.LC29(%rip), %rsi	# 3157	[c=1 l=7]  *movdi_internal/4
+	orl	%eax, %r15d	# 3153	[c=4 l=3]  *iorsi_1/0
+	movzbl	%r15b, %ecx	# 3154	[c=4 l=4]  *zero_extendqisi2/0
+	call	log_add_data_mov@PLT	# 3160	[c=0 l=5]  *call
+	movl	$63, %eax	# 3161	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 3162	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 3163	[c=13 l=7]  *cmpsi_1/1
+	jb	.L490	# 3164	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%r13)	# 3166	[c=13 l=8]  *cmpqi_ccno_1/1
+	jne	.L491	# 3167	[c=13 l=6]  *jcc
+.L490:
+	movq	1040(%r13), %rax	# 3170	[c=9 l=7]  *movdi_internal/3
+	movb	%r15b, 63(%rax)	# 3171	[c=4 l=4]  *movqi_internal/8
+.L492:
+	movq	%r13, %rdi	# 3183	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 3182	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 3184	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 17254	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 17255	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 3186	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18869	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 3187	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 3189	[c=4 l=3]  *cmpdi_1/0
+	jb	.L344	# 3190	[c=13 l=6]  *jcc
+	movl	0(%r13), %ebx	# 3192	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 3197	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 3193	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 3195	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 3196	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 3198	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 3199	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 3200	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 3203	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 17256	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 3204	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 3207	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 3208	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 20228	[c=10 l=4]  *indirect_jump
+.L493:
+	movzbl	10(%rbx), %r14d	# 3217	[c=13 l=5]  zero_extendqidi2/0
+	movzwl	12(%rbx), %r8d	# 3216	[c=13 l=5]  *zero_extendhisi2/0
+	movq	%r13, %rdi	# 3224	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 20226	[c=4 l=2]  *movdi_xor
+	leaq	.LC35(%rip), %r15	# 3222	[c=1 l=7]  *movdi_internal/4
+	movzbl	1004(%r13,%r14), %ecx	# 3219	[c=14 l=9]  *zero_extendqisi2/0
+	movq	%r14, %rdx	# 19150	[c=4 l=3]  *movdi_internal/3
+	movq	%r15, %rsi	# 3223	[c=4 l=3]  *movdi_internal/3
+	movl	%r8d, 16(%rsp)	# 18224	[c=4 l=5]  *movsi_internal/1
+	call	log_append@PLT	# 3226	[c=0 l=5]  *call
+	movq	%r15, %rsi	# 3234	[c=4 l=3]  *movdi_internal/3
+	movq	%r13, %rdi	# 3235	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 20227	[c=4 l=2]  *movdi_xor
+	movzbl	1004(%r13,%r14), %r9d	# 3228	[c=10 l=9]  *movqi_internal/4
+	movslq	16(%rsp), %r14	# 18225	[c=13 l=5]  *extendsidi2_rex64/1
+	movzbl	1004(%r13,%r14), %ecx	# 3230	[c=14 l=9]  *zero_extendqisi2/0
+	movl	%r14d, %edx	# 3232	[c=4 l=3]  *movsi_internal/0
+	movb	%r9b, 8(%rsp)	# 18222	[c=4 l=5]  *movqi_internal/8
+	call	log_append@PLT	# 3237	[c=0 l=5]  *call
+	movzbl	8(%rsp), %r9d	# 18223	[c=9 l=6]  *movqi_internal/4
+	cmpb	1004(%r13,%r14), %r9b	# 3239	[c=14 l=8]  *cmpqi_1/1
+	jne	.L494	# 3240	[c=13 l=2]  *jcc
+	movl	0(%r13), %eax	# 17258	[c=5 l=4]  *movsi_internal/0
+	addq	$1, 48(%r13)	# 3248	[c=13 l=5]  *adddi_1/0
+	addl	$1, %eax	# 3243	[c=4 l=3]  *addsi_1/0
+	andl	992(%r13), %eax	# 3246	[c=13 l=7]  *andsi_1/1
+	movl	%eax, 0(%r13)	# 3247	[c=4 l=4]  *movsi_internal/1
+.L494:
+	movq	%r13, %rdi	# 3252	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 3251	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 3253	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 17259	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 17260	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 3255	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18868	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 3256	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 3258	[c=4 l=3]  *cmpdi_1/0
+	jb	.L344	# 3259	[c=13 l=6]  *jcc
+	movq	56(%r13), %rax	# 17261	[c=9 l=4]  *movdi_internal/3
+	cmpq	%rax, 48(%r13)	# 3262	[c=13 l=4]  *cmpdi_1/0
+	jnb	.L1509	# 3263	[c=13 l=6]  *jcc
+.L495:
+	movq	%r13, %rdi	# 3269	[c=4 l=3]  *movdi_internal/3
+	call	log_is_idle@PLT	# 3270	[c=10 l=5]  *call_value
+	testb	%al, %al	# 3272	[c=4 l=2]  *cmpqi_ccno_1/0
+	jne	.L1510	# 3273	[c=13 l=6]  *jcc
+.L496:
+	movl	0(%r13), %ebx	# 3284	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 3289	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 3285	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 3287	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 3288	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 3290	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 3291	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 3292	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 3295	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 17262	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 3296	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 3299	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 3300	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 20225	[c=10 l=4]  *indirect_jump
+.L497:
+	movzbl	10(%rbx), %r14d	# 3309	[c=13 l=5]  zero_extendqidi2/0
+	movzwl	12(%rbx), %r8d	# 3308	[c=13 l=5]  *zero_extendhisi2/0
+	movq	%r13, %rdi	# 3316	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 20223	[c=4 l=2]  *movdi_xor
+	leaq	.LC35(%rip), %r15	# 3314	[c=1 l=7]  *movdi_internal/4
+	movzbl	1004(%r13,%r14), %ecx	# 3311	[c=14 l=9]  *zero_extendqisi2/0
+	movq	%r14, %rdx	# 19152	[c=4 l=3]  *movdi_internal/3
+	movq	%r15, %rsi	# 3315	[c=4 l=3]  *movdi_internal/3
+	movl	%r8d, 16(%rsp)	# 18228	[c=4 l=5]  *movsi_internal/1
+	call	log_append@PLT	# 3318	[c=0 l=5]  *call
+	movq	%r15, %rsi	# 3326	[c=4 l=3]  *movdi_internal/3
+	movq	%r13, %rdi	# 3327	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 20224	[c=4 l=2]  *movdi_xor
+	movzbl	1004(%r13,%r14), %r9d	# 3320	[c=10 l=9]  *movqi_internal/4
+	movslq	16(%rsp), %r14	# 18229	[c=13 l=5]  *extendsidi2_rex64/1
+	movzbl	1004(%r13,%r14), %ecx	# 3322	[c=14 l=9]  *zero_extendqisi2/0
+	movl	%r14d, %edx	# 3324	[c=4 l=3]  *movsi_internal/0
+	movb	%r9b, 8(%rsp)	# 18226	[c=4 l=5]  *movqi_internal/8
+	call	log_append@PLT	# 3329	[c=0 l=5]  *call
+	movzbl	8(%rsp), %r9d	# 18227	[c=9 l=6]  *movqi_internal/4
+	cmpb	1004(%r13,%r14), %r9b	# 3331	[c=14 l=8]  *cmpqi_1/1
+	jne	.L498	# 3332	[c=13 l=2]  *jcc
+	movl	0(%r13), %eax	# 17264	[c=5 l=4]  *movsi_internal/0
+	addq	$2, 48(%r13)	# 3340	[c=13 l=5]  *adddi_1/0
+	addl	$2, %eax	# 3335	[c=4 l=3]  *addsi_1/0
+	andl	992(%r13), %eax	# 3338	[c=13 l=7]  *andsi_1/1
+	movl	%eax, 0(%r13)	# 3339	[c=4 l=4]  *movsi_internal/1
+.L498:
+	movq	%r13, %rdi	# 3344	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 3343	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 3345	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 17265	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 17266	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 3347	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18867	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 3348	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 3350	[c=4 l=3]  *cmpdi_1/0
+	jb	.L344	# 3351	[c=13 l=6]  *jcc
+	movq	56(%r13), %rax	# 17267	[c=9 l=4]  *movdi_internal/3
+	cmpq	%rax, 48(%r13)	# 3354	[c=13 l=4]  *cmpdi_1/0
+	jnb	.L1511	# 3355	[c=13 l=6]  *jcc
+.L499:
+	movq	%r13, %rdi	# 3361	[c=4 l=3]  *movdi_internal/3
+	call	log_is_idle@PLT	# 3362	[c=10 l=5]  *call_value
+	testb	%al, %al	# 3364	[c=4 l=2]  *cmpqi_ccno_1/0
+	jne	.L1512	# 3365	[c=13 l=6]  *jcc
+.L500:
+	movl	0(%r13), %ebx	# 3376	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 3381	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 3377	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 3379	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 3380	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 3382	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 3383	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 3384	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 3387	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 17268	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 3388	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 3391	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 3392	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 20222	[c=10 l=4]  *indirect_jump
+.L501:
+	movzbl	10(%rbx), %r14d	# 3400	[c=13 l=5]  zero_extendqidi2/0
+	leaq	.LC35(%rip), %rsi	# 3405	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 3407	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 20220	[c=4 l=2]  *movdi_xor
+	movzbl	1004(%r13,%r14), %ecx	# 3402	[c=14 l=9]  *zero_extendqisi2/0
+	movq	%r14, %rdx	# 19154	[c=4 l=3]  *movdi_internal/3
+	movl	%r14d, 16(%rsp)	# 18230	[c=4 l=5]  *movsi_internal/1
+	call	log_append@PLT	# 3409	[c=0 l=5]  *call
+	movl	16(%rsp), %edx	# 18231	[c=9 l=4]  *movsi_internal/0
+	leaq	.LC36(%rip), %rsi	# 3419	[c=1 l=7]  *movdi_internal/4
+	movzbl	1004(%r13,%r14), %eax	# 3411	[c=10 l=9]  *movqi_internal/4
+	leal	-1(%rax), %r15d	# 18866	[c=4 l=4]  *leasi
+	xorl	%eax, %eax	# 20221	[c=4 l=2]  *movdi_xor
+	movzbl	%r15b, %edi	# 3414	[c=4 l=4]  *zero_extendqisi2/0
+	movl	%edi, 8(%rsp)	# 17270	[c=4 l=4]  *movsi_internal/1
+	movl	%edi, %ecx	# 3416	[c=4 l=2]  *movsi_internal/0
+	movq	%r13, %rdi	# 3421	[c=4 l=3]  *movdi_internal/3
+	call	log_append@PLT	# 3423	[c=0 l=5]  *call
+	movb	%r15b, 1004(%r13,%r14)	# 3425	[c=4 l=8]  *movqi_internal/8
+	movl	$63, %eax	# 3426	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 3427	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 3428	[c=13 l=7]  *cmpsi_1/1
+	jb	.L502	# 3429	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%r13)	# 3431	[c=13 l=8]  *cmpqi_ccno_1/1
+	jne	.L503	# 3432	[c=13 l=6]  *jcc
+.L502:
+	movq	1040(%r13), %rax	# 3435	[c=9 l=7]  *movdi_internal/3
+	movzbl	63(%rax), %r14d	# 3436	[c=13 l=5]  *zero_extendqisi2/0
+.L504:
+	movl	%r14d, %ecx	# 3447	[c=4 l=3]  *movsi_internal/0
+	movl	$63, %edx	# 3448	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 3451	[c=4 l=3]  *movdi_internal/3
+	andl	$-31, %r14d	# 3453	[c=4 l=4]  *andsi_1/0
+	leaq	.LC33(%rip), %rsi	# 3449	[c=1 l=7]  *movdi_internal/4
+	call	log_add_data_mov@PLT	# 3452	[c=0 l=5]  *call
+	movslq	8(%rsp), %r15	# 3455	[c=13 l=5]  *extendsidi2_rex64/1
+	movq	%r13, %rdi	# 3463	[c=4 l=3]  *movdi_internal/3
+	leaq	flag_update_table_dec(%rip), %rax	# 16903	[c=1 l=7]  *movdi_internal/4
+	movl	$63, %edx	# 3460	[c=4 l=5]  *movsi_internal/0
+	leaq	.LC29(%rip), %rsi	# 3461	[c=1 l=7]  *movdi_internal/4
+	movzbl	(%rax,%r15), %eax	# 3456	[c=13 l=5]  *zero_extendqisi2/0
+	orl	%eax, %r14d	# 3457	[c=4 l=3]  *iorsi_1/0
+	movzbl	%r14b, %ecx	# 3458	[c=4 l=4]  *zero_extendqisi2/0
+	call	log_add_data_mov@PLT	# 3464	[c=0 l=5]  *call
+	movl	$63, %eax	# 3465	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 3466	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 3467	[c=13 l=7]  *cmpsi_1/1
+	jb	.L505	# 3468	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%r13)	# 3470	[c=13 l=8]  *cmpqi_ccno_1/1
+	jne	.L506	# 3471	[c=13 l=6]  *jcc
+.L505:
+	movq	1040(%r13), %rax	# 3474	[c=9 l=7]  *movdi_internal/3
+	movb	%r14b, 63(%rax)	# 3475	[c=4 l=4]  *movqi_internal/8
+.L507:
+	movq	%r13, %rdi	# 3487	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 3486	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 3488	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 17272	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 17273	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 3490	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18865	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 3491	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 3493	[c=4 l=3]  *cmpdi_1/0
+	jb	.L344	# 3494	[c=13 l=6]  *jcc
+	movl	0(%r13), %ebx	# 3496	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 3501	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 3497	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 3499	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 3500	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 3502	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 3503	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 3504	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 3507	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 17274	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 3508	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 3511	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 3512	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 20219	[c=10 l=4]  *indirect_jump
+.L508:
+	movl	0(%r13), %eax	# 17276	[c=5 l=4]  *movsi_internal/0
+	movq	1056(%r13), %rdx	# 3525	[c=9 l=7]  *movdi_internal/3
+	leaq	.LC38(%rip), %rsi	# 3528	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 3530	[c=4 l=3]  *movdi_internal/3
+	subl	$1, %eax	# 3521	[c=4 l=3]  *addsi_1/0
+	movl	%eax, 0(%r13)	# 3522	[c=4 l=4]  *movsi_internal/1
+	addl	%eax, %eax	# 3523	[c=5 l=2]  *ashlsi3_1_zext/0
+	movzwl	(%rdx,%rax), %ebx	# 3526	[c=13 l=4]  *zero_extendhisi2/0
+	xorl	%eax, %eax	# 20218	[c=4 l=2]  *movdi_xor
+	movl	%ebx, %edx	# 3527	[c=4 l=2]  *movsi_internal/0
+	call	log_append@PLT	# 3532	[c=0 l=5]  *call
+.L1378:
+	movl	$1, 72(%r13)	# 3533	[c=4 l=8]  *movsi_internal/1
+	xorl	%esi, %esi	# 20216	[c=4 l=2]  *movdi_xor
+	movq	%r13, %rdi	# 3535	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 3536	[c=0 l=5]  *call
+	movl	%ebx, %ecx	# 3537	[c=4 l=2]  *movsi_internal/0
+	leaq	.LC41(%rip), %rdx	# 3538	[c=1 l=7]  *movdi_internal/4
+	xorl	%eax, %eax	# 20217	[c=4 l=2]  *movdi_xor
+	movl	$8, %esi	# 3540	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 3541	[c=4 l=3]  *movdi_internal/3
+	call	leave	# 3543	[c=0 l=5]  *call
+.L509:
+	cmpb	$0, 841(%r13)	# 3547	[c=13 l=8]  *cmpqi_ccno_1/1
+	je	.L1383	# 3548	[c=13 l=6]  *jcc
+	movl	5176(%r13), %edx	# 3575	[c=9 l=7]  *movsi_internal/0
+	movl	$61, %eax	# 3579	[c=4 l=5]  *movsi_internal/0
+	movl	5180(%r13), %r15d	# 3576	[c=9 l=7]  *movsi_internal/0
+	movl	$62, %r14d	# 3577	[c=4 l=6]  *movsi_internal/0
+	subl	%edx, %eax	# 3580	[c=4 l=2]  *subsi_1/0
+	subl	%edx, %r14d	# 3578	[c=4 l=3]  *subsi_1/0
+	cmpl	%r15d, %eax	# 3581	[c=4 l=3]  *cmpsi_1/0
+	jb	.L511	# 3582	[c=13 l=6]  *jcc
+	cmpb	$1, 1081(%r13)	# 3586	[c=13 l=8]  *cmpqi_1/0
+	ja	.L1513	# 3587	[c=13 l=6]  *jcc
+	movq	1040(%r13), %rax	# 14305	[c=9 l=7]  *movdi_internal/3
+	movzbl	61(%rax), %edx	# 14306	[c=13 l=4]  *zero_extendqisi2/0
+.L513:
+	movzbl	62(%rax), %r8d	# 3620	[c=13 l=5]  *zero_extendqisi2/0
+.L515:
+	sall	$8, %r8d	# 3623	[c=4 l=4]  *ashlsi3_1/0
+	leaq	.LC31(%rip), %rsi	# 3627	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 3629	[c=4 l=3]  *movdi_internal/3
+	orl	%edx, %r8d	# 3624	[c=4 l=3]  *iorsi_1/0
+	movl	$61, %edx	# 3626	[c=4 l=5]  *movsi_internal/0
+	movl	%r8d, %ecx	# 3625	[c=4 l=3]  *movsi_internal/0
+	movl	%r8d, %r15d	# 17279	[c=4 l=3]  *movsi_internal/0
+	call	log_add_data_mov@PLT	# 3630	[c=0 l=5]  *call
+	movl	996(%r13), %edx	# 3632	[c=9 l=7]  *movsi_internal/0
+	movzbl	840(%r13), %eax	# 3634	[c=13 l=8]  *zero_extendqisi2/0
+	leal	1(%rdx,%rax), %eax	# 3635	[c=5 l=4]  *leasi
+	cmpl	%eax, %r15d	# 3636	[c=4 l=3]  *cmpsi_1/0
+	jb	.L1382	# 3637	[c=13 l=6]  *jcc
+	cmpl	$63, %r15d	# 15334	[c=4 l=4]  *cmpsi_1/0
+	movl	0(%r13), %r14d	# 3645	[c=5 l=4]  *movsi_internal/0
+	leal	-1(%r15), %r9d	# 18864	[c=4 l=4]  *leasi
+	movl	%r15d, %edx	# 3654	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC30(%rip), %rax	# 16929	[c=1 l=7]  *movdi_internal/4
+	leaq	.LC29(%rip), %rsi	# 16928	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 3656	[c=4 l=3]  *movdi_internal/3
+	movl	%r9d, 8(%rsp)	# 18234	[c=4 l=5]  *movsi_internal/1
+	cmovne	%rax, %rsi	# 15335	[c=8 l=4]  *movdicc_noc/1
+	movzbl	%r14b, %ecx	# 3647	[c=4 l=4]  *zero_extendqisi2/0
+	call	log_add_data_mov@PLT	# 3657	[c=0 l=5]  *call
+	movl	%r15d, %eax	# 17280	[c=4 l=3]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 3658	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 3659	[c=13 l=7]  *cmpsi_1/1
+	movl	8(%rsp), %r9d	# 18235	[c=9 l=5]  *movsi_internal/0
+	jb	.L518	# 3660	[c=13 l=2]  *jcc
+	movl	%r15d, %eax	# 17282	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %eax	# 3662	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 16888	[c=5 l=5]  *andsi_1_zext
+	cmpb	$0, 1080(%r13,%rax)	# 3665	[c=14 l=9]  *cmpqi_ccno_1/1
+	jne	.L519	# 3666	[c=13 l=6]  *jcc
+.L518:
+	movq	1040(%r13), %rdx	# 3670	[c=9 l=7]  *movdi_internal/3
+	movslq	%r15d, %rax	# 3669	[c=4 l=3]  *extendsidi2_rex64/1
+	movb	%r14b, (%rdx,%rax)	# 3671	[c=4 l=4]  *movqi_internal/8
+.L520:
+	movl	0(%r13), %ecx	# 3682	[c=5 l=4]  *movsi_internal/0
+	movl	%r9d, %edx	# 3692	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 3694	[c=4 l=3]  *movdi_internal/3
+	movl	%r9d, 16(%rsp)	# 18238	[c=4 l=5]  *movsi_internal/1
+	leaq	.LC29(%rip), %rsi	# 16930	[c=1 l=7]  *movdi_internal/4
+	leal	-2(%r15), %r14d	# 18863	[c=4 l=4]  *leasi
+	movl	%ecx, %eax	# 17284	[c=4 l=2]  *movsi_internal/0
+	movzbl	%ch, %ecx	# 3685	[c=4 l=3]  *extzvsi
+	shrl	$8, %eax	# 3683	[c=4 l=3]  *lshrsi3_1/0
+	cmpl	$63, %r9d	# 15346	[c=4 l=4]  *cmpsi_1/0
+	movl	%eax, 8(%rsp)	# 17285	[c=4 l=4]  *movsi_internal/1
+	leaq	.LC30(%rip), %rax	# 16931	[c=1 l=7]  *movdi_internal/4
+	cmovne	%rax, %rsi	# 15347	[c=8 l=4]  *movdicc_noc/1
+	call	log_add_data_mov@PLT	# 3695	[c=0 l=5]  *call
+	movslq	16(%rsp), %r9	# 18239	[c=13 l=5]  *extendsidi2_rex64/1
+	movl	%r9d, %eax	# 17286	[c=4 l=3]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 3696	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 3697	[c=13 l=7]  *cmpsi_1/1
+	jb	.L522	# 3698	[c=13 l=2]  *jcc
+	movl	%r9d, %eax	# 17288	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %eax	# 3700	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 16887	[c=5 l=5]  *andsi_1_zext
+	cmpb	$0, 1080(%r13,%rax)	# 3703	[c=14 l=9]  *cmpqi_ccno_1/1
+	jne	.L523	# 3704	[c=13 l=6]  *jcc
+.L522:
+	movq	1040(%r13), %rax	# 3708	[c=9 l=7]  *movdi_internal/3
+	movzbl	8(%rsp), %edi	# 17290	[c=9 l=5]  *movqi_internal/4
+	movb	%dil, (%rax,%r9)	# 3709	[c=4 l=4]  *movqi_internal/8
+.L524:
+	cmpb	$0, 840(%r13)	# 3720	[c=13 l=8]  *cmpqi_ccno_1/1
+	je	.L525	# 3721	[c=13 l=2]  *jcc
+	movl	0(%r13), %eax	# 17291	[c=5 l=4]  *movsi_internal/0
+	subl	$3, %r15d	# 3725	[c=4 l=4]  *addsi_1/0
+	movq	%r13, %rdi	# 3735	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC30(%rip), %rdx	# 16933	[c=1 l=7]  *movdi_internal/4
+	leaq	.LC29(%rip), %rsi	# 16932	[c=1 l=7]  *movdi_internal/4
+	shrl	$16, %eax	# 3724	[c=4 l=3]  *lshrsi3_1/0
+	cmpl	$63, %r14d	# 15358	[c=4 l=4]  *cmpsi_1/0
+	cmovne	%rdx, %rsi	# 15359	[c=8 l=4]  *movdicc_noc/1
+	movzbl	%al, %ecx	# 3726	[c=4 l=3]  *zero_extendqisi2/0
+	movl	%r14d, %edx	# 3733	[c=4 l=3]  *movsi_internal/0
+	movl	%eax, 8(%rsp)	# 18240	[c=4 l=4]  *movsi_internal/1
+	call	log_add_data_mov@PLT	# 3736	[c=0 l=5]  *call
+	movl	%r14d, %edx	# 17293	[c=4 l=3]  *movsi_internal/0
+	subl	5176(%r13), %edx	# 3737	[c=13 l=7]  *subsi_1/1
+	movl	8(%rsp), %eax	# 18241	[c=9 l=4]  *movsi_internal/0
+	cmpl	5180(%r13), %edx	# 3738	[c=13 l=7]  *cmpsi_1/1
+	jb	.L527	# 3739	[c=13 l=2]  *jcc
+	movl	%r14d, %edx	# 17295	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %edx	# 3741	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %edx	# 16886	[c=5 l=6]  *andsi_1_zext
+	cmpb	$0, 1080(%r13,%rdx)	# 3744	[c=14 l=9]  *cmpqi_ccno_1/1
+	jne	.L528	# 3745	[c=13 l=6]  *jcc
+.L527:
+	movq	1040(%r13), %rdx	# 3749	[c=9 l=7]  *movdi_internal/3
+	movslq	%r14d, %r14	# 3748	[c=4 l=3]  *extendsidi2_rex64/1
+	movb	%al, (%rdx,%r14)	# 3750	[c=4 l=4]  *movqi_internal/8
+.L529:
+	movl	%r15d, %r14d	# 24	[c=4 l=3]  *movsi_internal/0
+.L525:
+	movzwl	%r14w, %r15d	# 3765	[c=4 l=4]  *zero_extendhisi2/0
+	movl	$61, %edx	# 3767	[c=4 l=5]  *movsi_internal/0
+	leaq	.LC32(%rip), %rsi	# 3768	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 3770	[c=4 l=3]  *movdi_internal/3
+	movl	%r15d, %ecx	# 3766	[c=4 l=3]  *movsi_internal/0
+	call	log_add_data_mov@PLT	# 3771	[c=0 l=5]  *call
+	movl	$61, %eax	# 3772	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 3773	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 3774	[c=13 l=7]  *cmpsi_1/1
+	jb	.L530	# 3775	[c=13 l=2]  *jcc
+	cmpb	$1, 1081(%r13)	# 3779	[c=13 l=8]  *cmpqi_1/0
+	ja	.L1514	# 3780	[c=13 l=6]  *jcc
+.L530:
+	movq	1040(%r13), %rax	# 3791	[c=9 l=7]  *movdi_internal/3
+	movb	%r14b, 61(%rax)	# 3792	[c=4 l=4]  *movqi_internal/8
+.L531:
+	movl	$62, %eax	# 3796	[c=4 l=5]  *movsi_internal/0
+	sarl	$8, %r15d	# 3795	[c=4 l=4]  *ashrsi3_1/0
+	subl	5176(%r13), %eax	# 3797	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 3798	[c=13 l=7]  *cmpsi_1/1
+	jb	.L532	# 3799	[c=13 l=2]  *jcc
+	cmpb	$1, 1081(%r13)	# 3803	[c=13 l=8]  *cmpqi_1/0
+	ja	.L1515	# 3804	[c=13 l=6]  *jcc
+.L532:
+	movq	1040(%r13), %rax	# 3814	[c=9 l=7]  *movdi_internal/3
+	movb	%r15b, 62(%rax)	# 3815	[c=4 l=4]  *movqi_internal/8
+.L533:
+	movzwl	1034(%r13), %r14d	# 3818	[c=13 l=8]  *zero_extendhisi2/0
+	xorl	%eax, %eax	# 20213	[c=4 l=2]  *movdi_xor
+	movl	$30, %edx	# 3820	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 3823	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC34(%rip), %rsi	# 3821	[c=1 l=7]  *movdi_internal/4
+	movl	%r14d, %ecx	# 3819	[c=4 l=3]  *movsi_internal/0
+	call	log_append@PLT	# 3825	[c=0 l=5]  *call
+	movl	$60, %eax	# 3826	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 3827	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 3828	[c=13 l=7]  *cmpsi_1/1
+	jb	.L534	# 3829	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%r13)	# 3831	[c=13 l=8]  *cmpqi_ccno_1/1
+	jne	.L535	# 3832	[c=13 l=6]  *jcc
+.L534:
+	movq	1040(%r13), %rax	# 3835	[c=9 l=7]  *movdi_internal/3
+	movzbl	60(%rax), %r15d	# 3836	[c=13 l=5]  *zero_extendqisi2/0
+.L536:
+	leaq	.LC25(%rip), %rsi	# 3849	[c=1 l=7]  *movdi_internal/4
+	movl	%r15d, %ecx	# 3847	[c=4 l=3]  *movsi_internal/0
+	movl	$60, %edx	# 3848	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 3851	[c=4 l=3]  *movdi_internal/3
+	call	log_add_data_mov@PLT	# 3852	[c=0 l=5]  *call
+	movl	%r15d, %esi	# 17297	[c=4 l=3]  *movsi_internal/0
+	sall	$16, %esi	# 3853	[c=4 l=3]  *ashlsi3_1/0
+	orl	%r14d, %esi	# 3854	[c=4 l=3]  *iorsi_1/0
+	movl	%esi, 0(%r13)	# 3855	[c=4 l=4]  *movsi_internal/1
+	cmpl	%esi, 992(%r13)	# 3856	[c=13 l=7]  *cmpsi_1/0
+	jb	.L1380	# 3857	[c=13 l=6]  *jcc
+	movq	%r13, %rdi	# 3866	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 3865	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 3867	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 17299	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 17300	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 3869	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18862	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 3870	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 3872	[c=4 l=3]  *cmpdi_1/0
+	jb	.L344	# 3873	[c=13 l=6]  *jcc
+	movq	56(%r13), %rax	# 17301	[c=9 l=4]  *movdi_internal/3
+	cmpq	%rax, 48(%r13)	# 3876	[c=13 l=4]  *cmpdi_1/0
+	jnb	.L1516	# 3877	[c=13 l=6]  *jcc
+.L538:
+	movq	%r13, %rdi	# 3883	[c=4 l=3]  *movdi_internal/3
+	call	log_is_idle@PLT	# 3884	[c=10 l=5]  *call_value
+	testb	%al, %al	# 3886	[c=4 l=2]  *cmpqi_ccno_1/0
+	jne	.L1517	# 3887	[c=13 l=6]  *jcc
+.L539:
+	movl	0(%r13), %ebx	# 3898	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 3903	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 3899	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 3901	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 3902	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 3904	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 3905	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 3906	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 3909	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 17302	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 3910	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 3913	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 3914	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 20212	[c=10 l=4]  *indirect_jump
+.L540:
+	cmpb	$0, 841(%r13)	# 3922	[c=13 l=8]  *cmpqi_ccno_1/1
+	je	.L1383	# 3923	[c=13 l=6]  *jcc
+	movzwl	1034(%r13), %r14d	# 3950	[c=13 l=8]  *zero_extendhisi2/0
+	xorl	%eax, %eax	# 20211	[c=4 l=2]  *movdi_xor
+	movl	$30, %edx	# 3952	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 3955	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC34(%rip), %rsi	# 3953	[c=1 l=7]  *movdi_internal/4
+	movl	%r14d, %ecx	# 3951	[c=4 l=3]  *movsi_internal/0
+	call	log_append@PLT	# 3957	[c=0 l=5]  *call
+	movl	$60, %eax	# 3958	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 3959	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 3960	[c=13 l=7]  *cmpsi_1/1
+	jb	.L542	# 3961	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%r13)	# 3963	[c=13 l=8]  *cmpqi_ccno_1/1
+	jne	.L543	# 3964	[c=13 l=6]  *jcc
+.L542:
+	movq	1040(%r13), %rax	# 3967	[c=9 l=7]  *movdi_internal/3
+	movzbl	60(%rax), %r15d	# 3968	[c=13 l=5]  *zero_extendqisi2/0
+.L544:
+	leaq	.LC25(%rip), %rsi	# 3981	[c=1 l=7]  *movdi_internal/4
+	movl	%r15d, %ecx	# 3979	[c=4 l=3]  *movsi_internal/0
+	movl	$60, %edx	# 3980	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 3983	[c=4 l=3]  *movdi_internal/3
+	call	log_add_data_mov@PLT	# 3984	[c=0 l=5]  *call
+	movl	%r15d, %esi	# 17305	[c=4 l=3]  *movsi_internal/0
+	sall	$16, %esi	# 3985	[c=4 l=3]  *ashlsi3_1/0
+	orl	%r14d, %esi	# 3986	[c=4 l=3]  *iorsi_1/0
+	movl	%esi, 0(%r13)	# 3987	[c=4 l=4]  *movsi_internal/1
+	cmpl	%esi, 992(%r13)	# 3988	[c=13 l=7]  *cmpsi_1/0
+	jb	.L1380	# 3989	[c=13 l=6]  *jcc
+	movq	%r13, %rdi	# 3998	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 3997	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 3999	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 17307	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 17308	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 4001	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18861	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 4002	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 4004	[c=4 l=3]  *cmpdi_1/0
+	jb	.L344	# 4005	[c=13 l=6]  *jcc
+	movq	56(%r13), %rax	# 17309	[c=9 l=4]  *movdi_internal/3
+	cmpq	%rax, 48(%r13)	# 4008	[c=13 l=4]  *cmpdi_1/0
+	jnb	.L1518	# 4009	[c=13 l=6]  *jcc
+.L546:
+	movq	%r13, %rdi	# 4015	[c=4 l=3]  *movdi_internal/3
+	call	log_is_idle@PLT	# 4016	[c=10 l=5]  *call_value
+	testb	%al, %al	# 4018	[c=4 l=2]  *cmpqi_ccno_1/0
+	jne	.L1519	# 4019	[c=13 l=6]  *jcc
+.L547:
+	movl	0(%r13), %ebx	# 4030	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 4035	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 4031	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 4033	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 4034	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 4036	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 4037	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 4038	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 4041	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 17310	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 4042	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 4045	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 4046	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 20210	[c=10 l=4]  *indirect_jump
+.L548:
+	movzwl	1034(%r13), %r14d	# 4054	[c=13 l=8]  *zero_extendhisi2/0
+	xorl	%eax, %eax	# 20209	[c=4 l=2]  *movdi_xor
+	movl	$30, %edx	# 4056	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 4059	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC34(%rip), %rsi	# 4057	[c=1 l=7]  *movdi_internal/4
+	movl	%r14d, %ecx	# 4055	[c=4 l=3]  *movsi_internal/0
+	call	log_append@PLT	# 4061	[c=0 l=5]  *call
+	movl	$59, %eax	# 4062	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 4063	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 4064	[c=13 l=7]  *cmpsi_1/1
+	jb	.L549	# 4065	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%r13)	# 4067	[c=13 l=8]  *cmpqi_ccno_1/1
+	jne	.L550	# 4068	[c=13 l=6]  *jcc
+.L549:
+	movq	1040(%r13), %rax	# 4071	[c=9 l=7]  *movdi_internal/3
+	movzbl	59(%rax), %r15d	# 4072	[c=13 l=5]  *zero_extendqisi2/0
+.L551:
+	movl	%r15d, %ecx	# 4083	[c=4 l=3]  *movsi_internal/0
+	movl	$59, %edx	# 4084	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 4087	[c=4 l=3]  *movdi_internal/3
+	sall	$16, %r15d	# 4092	[c=4 l=4]  *ashlsi3_1/0
+	leaq	.LC25(%rip), %rsi	# 4085	[c=1 l=7]  *movdi_internal/4
+	orl	%r14d, %r15d	# 4093	[c=4 l=3]  *iorsi_1/0
+	call	log_add_data_mov@PLT	# 4088	[c=0 l=5]  *call
+	movl	992(%r13), %eax	# 4089	[c=9 l=7]  *movsi_internal/0
+	movq	1056(%r13), %rdx	# 4096	[c=9 l=7]  *movdi_internal/3
+	movq	%r13, %rdi	# 4103	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC36(%rip), %rsi	# 4101	[c=1 l=7]  *movdi_internal/4
+	leal	1(%rax,%rax), %eax	# 4091	[c=8 l=4]  *leasi
+	andl	%r15d, %eax	# 4094	[c=4 l=3]  *andsi_1/0
+	cltq	# 4095	[c=4 l=2]  *extendsidi2_rex64/0
+	movzbl	(%rdx,%rax), %ecx	# 4097	[c=13 l=4]  *zero_extendqisi2/0
+	xorl	%edx, %edx	# 20207	[c=4 l=2]  *movdi_xor
+	xorl	%eax, %eax	# 20208	[c=4 l=2]  *movdi_xor
+	movl	%ecx, %r14d	# 19155	[c=4 l=3]  *movsi_internal/0
+	call	log_append@PLT	# 4105	[c=0 l=5]  *call
+	movb	%r14b, 1004(%r13)	# 4106	[c=4 l=7]  *movqi_internal/8
+	movq	%r13, %rdi	# 4108	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 4107	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 4109	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 17312	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 17313	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 4111	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18860	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 4112	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 4114	[c=4 l=3]  *cmpdi_1/0
+	jb	.L344	# 4115	[c=13 l=6]  *jcc
+	movl	0(%r13), %ebx	# 4117	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 4122	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 4118	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 4120	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 4121	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 4123	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 4124	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 4125	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 4128	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 17314	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 4129	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 4132	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 4133	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 20206	[c=10 l=4]  *indirect_jump
+.L552:
+	xorl	%eax, %eax	# 20205	[c=4 l=2]  *movdi_xor
+	movl	$30, %edx	# 4144	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 4147	[c=4 l=3]  *movdi_internal/3
+	movzbl	10(%rbx), %r15d	# 4141	[c=13 l=5]  zero_extendqidi2/0
+	movzwl	1034(%r13), %r14d	# 4142	[c=13 l=8]  *zero_extendhisi2/0
+	leaq	.LC34(%rip), %rsi	# 4145	[c=1 l=7]  *movdi_internal/4
+	movl	%r14d, %ecx	# 4143	[c=4 l=3]  *movsi_internal/0
+	call	log_append@PLT	# 4149	[c=0 l=5]  *call
+	movl	$59, %eax	# 4150	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 4151	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 4152	[c=13 l=7]  *cmpsi_1/1
+	jb	.L553	# 4153	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%r13)	# 4155	[c=13 l=8]  *cmpqi_ccno_1/1
+	jne	.L554	# 4156	[c=13 l=6]  *jcc
+.L553:
+	movq	1040(%r13), %rax	# 4159	[c=9 l=7]  *movdi_internal/3
+	movzbl	59(%rax), %eax	# 4160	[c=13 l=4]  *zero_extendqisi2/0
+.L555:
+	movl	%eax, %ecx	# 4171	[c=4 l=2]  *movsi_internal/0
+	movl	$59, %edx	# 4172	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 4175	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, 8(%rsp)	# 18242	[c=4 l=4]  *movsi_internal/1
+	leaq	.LC25(%rip), %rsi	# 4173	[c=1 l=7]  *movdi_internal/4
+	call	log_add_data_mov@PLT	# 4176	[c=0 l=5]  *call
+	movl	8(%rsp), %eax	# 18243	[c=9 l=4]  *movsi_internal/0
+	movl	992(%r13), %edx	# 4177	[c=9 l=7]  *movsi_internal/0
+	movq	%r13, %rdi	# 4191	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC36(%rip), %rsi	# 4189	[c=1 l=7]  *movdi_internal/4
+	sall	$16, %eax	# 4180	[c=4 l=3]  *ashlsi3_1/0
+	leal	1(%rdx,%rdx), %edx	# 4179	[c=8 l=4]  *leasi
+	orl	%r14d, %eax	# 4181	[c=4 l=3]  *iorsi_1/0
+	andl	%edx, %eax	# 4182	[c=4 l=2]  *andsi_1/0
+	movq	1056(%r13), %rdx	# 4184	[c=9 l=7]  *movdi_internal/3
+	cltq	# 4183	[c=4 l=2]  *extendsidi2_rex64/0
+	movzbl	(%rdx,%rax), %ecx	# 4185	[c=13 l=4]  *zero_extendqisi2/0
+	movl	%r15d, %edx	# 4188	[c=4 l=3]  *movsi_internal/0
+	xorl	%eax, %eax	# 20204	[c=4 l=2]  *movdi_xor
+	movl	%ecx, %r14d	# 19156	[c=4 l=3]  *movsi_internal/0
+	call	log_append@PLT	# 4193	[c=0 l=5]  *call
+	movb	%r14b, 1004(%r13,%r15)	# 4195	[c=4 l=8]  *movqi_internal/8
+	movq	%r13, %rdi	# 4197	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 4196	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 4198	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 17316	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 17317	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 4200	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18859	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 4201	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 4203	[c=4 l=3]  *cmpdi_1/0
+	jb	.L344	# 4204	[c=13 l=6]  *jcc
+	movl	0(%r13), %ebx	# 4206	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 4211	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 4207	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 4209	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 4210	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 4212	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 4213	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 4214	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 4217	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 17318	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 4218	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 4221	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 4222	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 20203	[c=10 l=4]  *indirect_jump
+.L556:
+	xorl	%eax, %eax	# 20202	[c=4 l=2]  *movdi_xor
+	movl	$30, %edx	# 4233	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 4236	[c=4 l=3]  *movdi_internal/3
+	movzbl	10(%rbx), %r15d	# 4230	[c=13 l=5]  zero_extendqidi2/0
+	movzwl	1034(%r13), %r14d	# 4231	[c=13 l=8]  *zero_extendhisi2/0
+	leaq	.LC34(%rip), %rsi	# 4234	[c=1 l=7]  *movdi_internal/4
+	movl	%r14d, %ecx	# 4232	[c=4 l=3]  *movsi_internal/0
+	call	log_append@PLT	# 4238	[c=0 l=5]  *call
+	movl	$59, %eax	# 4239	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 4240	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 4241	[c=13 l=7]  *cmpsi_1/1
+	jb	.L557	# 4242	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%r13)	# 4244	[c=13 l=8]  *cmpqi_ccno_1/1
+	jne	.L558	# 4245	[c=13 l=6]  *jcc
+.L557:
+	movq	1040(%r13), %rax	# 4248	[c=9 l=7]  *movdi_internal/3
+	movzbl	59(%rax), %eax	# 4249	[c=13 l=4]  *zero_extendqisi2/0
+.L559:
+	movl	%eax, %ecx	# 4260	[c=4 l=2]  *movsi_internal/0
+	movl	$59, %edx	# 4261	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 4264	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, 8(%rsp)	# 18246	[c=4 l=4]  *movsi_internal/1
+	leaq	.LC25(%rip), %rsi	# 4262	[c=1 l=7]  *movdi_internal/4
+	call	log_add_data_mov@PLT	# 4265	[c=0 l=5]  *call
+	movl	8(%rsp), %eax	# 18247	[c=9 l=4]  *movsi_internal/0
+	movq	1056(%r13), %rdx	# 4273	[c=9 l=7]  *movdi_internal/3
+	movq	%r13, %rdi	# 4280	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC36(%rip), %rsi	# 4278	[c=1 l=7]  *movdi_internal/4
+	sall	$16, %eax	# 4266	[c=4 l=3]  *ashlsi3_1/0
+	orl	%eax, %r14d	# 4267	[c=4 l=3]  *iorsi_1/0
+	movl	992(%r13), %eax	# 4268	[c=9 l=7]  *movsi_internal/0
+	leal	1(%rax,%rax), %eax	# 4270	[c=8 l=4]  *leasi
+	andl	%r14d, %eax	# 4271	[c=4 l=3]  *andsi_1/0
+	addl	$1, %r14d	# 4285	[c=4 l=4]  *addsi_1/0
+	cltq	# 4272	[c=4 l=2]  *extendsidi2_rex64/0
+	movzbl	(%rdx,%rax), %ecx	# 4274	[c=13 l=4]  *zero_extendqisi2/0
+	movl	%r15d, %edx	# 4277	[c=4 l=3]  *movsi_internal/0
+	xorl	%eax, %eax	# 20200	[c=4 l=2]  *movdi_xor
+	movb	%cl, 8(%rsp)	# 18244	[c=4 l=4]  *movqi_internal/8
+	call	log_append@PLT	# 4282	[c=0 l=5]  *call
+	movzbl	8(%rsp), %r8d	# 18245	[c=9 l=6]  *movqi_internal/4
+	xorl	%eax, %eax	# 20201	[c=4 l=2]  *movdi_xor
+	movq	%r13, %rdi	# 4291	[c=4 l=3]  *movdi_internal/3
+	movzwl	%r14w, %ecx	# 4286	[c=4 l=4]  *zero_extendhisi2/0
+	movl	$30, %edx	# 4288	[c=4 l=5]  *movsi_internal/0
+	leaq	.LC37(%rip), %rsi	# 4289	[c=1 l=7]  *movdi_internal/4
+	movb	%r8b, 1004(%r13,%r15)	# 4284	[c=4 l=8]  *movqi_internal/8
+	call	log_append@PLT	# 4293	[c=0 l=5]  *call
+	movw	%r14w, 1034(%r13)	# 4294	[c=4 l=8]  *movhi_internal/3
+	sarl	$16, %r14d	# 4295	[c=4 l=4]  *ashrsi3_1/0
+	movq	%r13, %rdi	# 4301	[c=4 l=3]  *movdi_internal/3
+	movzbl	%r14b, %ecx	# 4296	[c=4 l=4]  *zero_extendqisi2/0
+	movl	$59, %edx	# 4298	[c=4 l=5]  *movsi_internal/0
+	leaq	.LC30(%rip), %rsi	# 4299	[c=1 l=7]  *movdi_internal/4
+	call	log_add_data_mov@PLT	# 4302	[c=0 l=5]  *call
+	movl	$59, %eax	# 4303	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 4304	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 4305	[c=13 l=7]  *cmpsi_1/1
+	jb	.L560	# 4306	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%r13)	# 4308	[c=13 l=8]  *cmpqi_ccno_1/1
+	jne	.L561	# 4309	[c=13 l=6]  *jcc
+.L560:
+	movq	1040(%r13), %rax	# 4312	[c=9 l=7]  *movdi_internal/3
+	movb	%r14b, 59(%rax)	# 4313	[c=4 l=4]  *movqi_internal/8
+.L562:
+	movq	%r13, %rdi	# 4325	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 4324	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 4326	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 17320	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 17321	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 4328	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18858	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 4329	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 4331	[c=4 l=3]  *cmpdi_1/0
+	jb	.L344	# 4332	[c=13 l=6]  *jcc
+	movl	0(%r13), %ebx	# 4334	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 4339	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 4335	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 4337	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 4338	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 4340	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 4341	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 4342	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 4345	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 17322	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 4346	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 4349	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 4350	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 20199	[c=10 l=4]  *indirect_jump
+.L563:
+	movzbl	10(%rbx), %r8d	# 4359	[c=13 l=5]  zero_extendqidi2/0
+	movzwl	12(%rbx), %r11d	# 4358	[c=13 l=5]  *zero_extendhisi2/0
+	movq	%r13, %rdi	# 4366	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 20195	[c=4 l=2]  *movdi_xor
+	leaq	.LC35(%rip), %rsi	# 4364	[c=1 l=7]  *movdi_internal/4
+	movzbl	1004(%r13,%r8), %ecx	# 4361	[c=14 l=9]  *zero_extendqisi2/0
+	movl	%r8d, %edx	# 4363	[c=4 l=3]  *movsi_internal/0
+	movl	%r11d, 24(%rsp)	# 18256	[c=4 l=5]  *movsi_internal/1
+	movq	%r8, 8(%rsp)	# 18254	[c=4 l=5]  *movdi_internal/5
+	movl	%r8d, 16(%rsp)	# 18252	[c=4 l=5]  *movsi_internal/1
+	call	log_append@PLT	# 4368	[c=0 l=5]  *call
+	movslq	24(%rsp), %r15	# 18257	[c=13 l=5]  *extendsidi2_rex64/1
+	movq	%r13, %rdi	# 4377	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 20196	[c=4 l=2]  *movdi_xor
+	movq	8(%rsp), %r8	# 18255	[c=9 l=5]  *movdi_internal/3
+	leaq	.LC35(%rip), %rsi	# 18251	[c=1 l=7]  *movdi_internal/4
+	movzbl	1004(%r13,%r15), %ecx	# 4372	[c=14 l=9]  *zero_extendqisi2/0
+	movl	%r15d, %edx	# 4374	[c=4 l=3]  *movsi_internal/0
+	movzbl	1004(%r13,%r8), %r14d	# 4370	[c=10 l=9]  *movqi_internal/4
+	call	log_append@PLT	# 4379	[c=0 l=5]  *call
+	movl	16(%rsp), %edx	# 20197	[c=9 l=4]  *movsi_internal/0
+	xorl	%eax, %eax	# 20198	[c=4 l=2]  *movdi_xor
+	movq	%r13, %rdi	# 4387	[c=4 l=3]  *movdi_internal/3
+	xorb	1004(%r13,%r15), %r14b	# 4381	[c=14 l=8]  *xorqi_1/1
+	leaq	.LC36(%rip), %rsi	# 4385	[c=1 l=7]  *movdi_internal/4
+	movzbl	%r14b, %r15d	# 4382	[c=4 l=4]  zero_extendqidi2/0
+	movl	%r15d, %ecx	# 4383	[c=4 l=3]  *movsi_internal/0
+	call	log_append@PLT	# 4389	[c=0 l=5]  *call
+	movq	8(%rsp), %r8	# 18249	[c=9 l=5]  *movdi_internal/3
+	movl	$63, %eax	# 4392	[c=4 l=5]  *movsi_internal/0
+	movb	%r14b, 1004(%r13,%r8)	# 4391	[c=4 l=8]  *movqi_internal/8
+	subl	5176(%r13), %eax	# 4393	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 4394	[c=13 l=7]  *cmpsi_1/1
+	jb	.L564	# 4395	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%r13)	# 4397	[c=13 l=8]  *cmpqi_ccno_1/1
+	jne	.L565	# 4398	[c=13 l=6]  *jcc
+.L564:
+	movq	1040(%r13), %rax	# 4401	[c=9 l=7]  *movdi_internal/3
+	movzbl	63(%rax), %r14d	# 4402	[c=13 l=5]  *zero_extendqisi2/0
+.L566:
+	movl	%r14d, %ecx	# 4413	[c=4 l=3]  *movsi_internal/0
+	movl	$63, %edx	# 4414	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 4417	[c=4 l=3]  *movdi_internal/3
+	andl	$-31, %r14d	# 4419	[c=4 l=4]  *andsi_1/0
+	leaq	.LC33(%rip), %rsi	# 4415	[c=1 l=7]  *movdi_internal/4
+	call	log_add_data_mov@PLT	# 4418	[c=0 l=5]  *call
+	leaq	flag_update_table_logical(%rip), %rax	# 16904	[c=1 l=7]  *movdi_internal/4
+	movl	$63, %edx	# 4426	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 4429	[c=4 l=3]  *movdi_internal/3
+	movzbl	(%rax,%r15), %eax	# 4422	[c=13 l=5]  *zero_extendqisi2/0
+	leaq	.LC29(%rip), %rsi	# 4427	[c=1 l=7]  *movdi_internal/4
+	orl	%eax, %r14d	# 4423	[c=4 l=3]  *iorsi_1/0
+	movzbl	%r14b, %ecx	# 4424	[c=4 l=4]  *zero_extendqisi2/0
+	call	log_add_data_mov@PLT	# 4430	[c=0 l=5]  *call
+	movl	$63, %eax	# 4431	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 4432	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 4433	[c=13 l=7]  *cmpsi_1/1
+	jb	.L567	# 4434	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%r13)	# 4436	[c=13 l=8]  *cmpqi_ccno_1/1
+	jne	.L568	# 4437	[c=13 l=6]  *jcc
+.L567:
+	movq	1040(%r13), %rax	# 4440	[c=9 l=7]  *movdi_internal/3
+	movb	%r14b, 63(%rax)	# 4441	[c=4 l=4]  *movqi_internal/8
+.L569:
+	movq	%r13, %rdi	# 4453	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 4452	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 4454	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 17324	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 17325	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 4456	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18857	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 4457	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 4459	[c=4 l=3]  *cmpdi_1/0
+	jb	.L344	# 4460	[c=13 l=6]  *jcc
+	movl	0(%r13), %ebx	# 4462	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 4467	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 4463	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 4465	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 4466	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 4468	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 4469	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 4470	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 4473	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 17326	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 4474	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 4477	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 4478	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 20194	[c=10 l=4]  *indirect_jump
+.L570:
+	movzwl	1034(%r13), %r14d	# 4486	[c=13 l=8]  *zero_extendhisi2/0
+	xorl	%eax, %eax	# 20193	[c=4 l=2]  *movdi_xor
+	movl	$30, %edx	# 4488	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 4491	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC34(%rip), %rsi	# 4489	[c=1 l=7]  *movdi_internal/4
+	movl	%r14d, %ecx	# 4487	[c=4 l=3]  *movsi_internal/0
+	call	log_append@PLT	# 4493	[c=0 l=5]  *call
+	cmpl	$65536, 880(%r13)	# 4496	[c=13 l=11]  *cmpsi_1/0
+	jbe	.L571	# 4497	[c=13 l=2]  *jcc
+	movl	$59, %eax	# 4499	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 4500	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 4501	[c=13 l=7]  *cmpsi_1/1
+	jb	.L572	# 4502	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%r13)	# 4504	[c=13 l=8]  *cmpqi_ccno_1/1
+	jne	.L573	# 4505	[c=13 l=6]  *jcc
+.L572:
+	movq	1040(%r13), %rax	# 4508	[c=9 l=7]  *movdi_internal/3
+	movzbl	59(%rax), %r15d	# 4509	[c=13 l=5]  *zero_extendqisi2/0
+.L574:
+	movl	%r15d, %ecx	# 4520	[c=4 l=3]  *movsi_internal/0
+	movl	$59, %edx	# 4521	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 4524	[c=4 l=3]  *movdi_internal/3
+	sall	$16, %r15d	# 4526	[c=4 l=4]  *ashlsi3_1/0
+	leaq	.LC25(%rip), %rsi	# 4522	[c=1 l=7]  *movdi_internal/4
+	orl	%r15d, %r14d	# 4527	[c=4 l=3]  *iorsi_1/0
+	call	log_add_data_mov@PLT	# 4525	[c=0 l=5]  *call
+.L571:
+	movl	6044(%r13), %r8d	# 4530	[c=9 l=7]  *movsi_internal/0
+	movl	992(%r13), %eax	# 4532	[c=9 l=7]  *movsi_internal/0
+	movq	%r13, %rdi	# 4542	[c=4 l=3]  *movdi_internal/3
+	leal	1(%rax,%rax), %r15d	# 4534	[c=8 l=5]  *leasi
+	movl	%r8d, %eax	# 17328	[c=4 l=3]  *movsi_internal/0
+	movl	%r8d, 16(%rsp)	# 18260	[c=4 l=5]  *movsi_internal/1
+	negl	%eax	# 4535	[c=4 l=2]  *negsi_1
+	andl	%eax, %r15d	# 4536	[c=4 l=3]  *andsi_1/0
+	leaq	6052(%r13), %rax	# 18856	[c=4 l=7]  *leadi
+	andl	%r14d, %r15d	# 4537	[c=4 l=3]  *andsi_1/0
+	movq	%rax, 24(%rsp)	# 17330	[c=4 l=5]  *movdi_internal/5
+	movl	%r15d, %ecx	# 4538	[c=1 l=3]  *zero_extendsidi2/3
+	addq	1056(%r13), %rcx	# 4540	[c=13 l=7]  *adddi_1/1
+	movq	%rcx, 8(%rsp)	# 18258	[c=4 l=5]  *movdi_internal/5
+	call	spm_operation	# 4543	[c=10 l=5]  *call_value
+	movq	8(%rsp), %rcx	# 18259	[c=9 l=5]  *movdi_internal/3
+	movl	16(%rsp), %r8d	# 18261	[c=9 l=5]  *movsi_internal/0
+	cmpl	$3, %eax	# 4545	[c=4 l=3]  *cmpsi_1/0
+	je	.L1520	# 4546	[c=13 l=6]  *jcc
+	jg	.L576	# 4551	[c=13 l=6]  *jcc
+	cmpl	$1, %eax	# 4553	[c=4 l=3]  *cmpsi_1/0
+	je	.L577	# 4554	[c=13 l=6]  *jcc
+	cmpl	$2, %eax	# 4556	[c=4 l=3]  *cmpsi_1/0
+	jne	.L579	# 4557	[c=13 l=2]  *jcc
+	movl	%r15d, %edx	# 4601	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC62(%rip), %rsi	# 4602	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 4604	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 20188	[c=4 l=2]  *movdi_xor
+	movq	%rcx, 16(%rsp)	# 18271	[c=4 l=5]  *movdi_internal/5
+	movl	%r8d, 8(%rsp)	# 18269	[c=4 l=5]  *movsi_internal/1
+	call	log_append@PLT	# 4606	[c=0 l=5]  *call
+	movl	8(%rsp), %edx	# 18270	[c=10 l=4]  *zero_extendsidi2/3
+	movq	16(%rsp), %rdi	# 20189	[c=9 l=5]  *movdi_internal/3
+	movl	$255, %esi	# 4610	[c=4 l=5]  *movsi_internal/0
+.L1374:
+	call	memset@PLT	# 4653	[c=10 l=5]  *call_value
+	movl	8(%rsp), %r8d	# 18282	[c=9 l=5]  *movsi_internal/0
+	movl	%r15d, %esi	# 4656	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 4657	[c=4 l=3]  *movdi_internal/3
+	leal	(%r8,%r15), %edx	# 18852	[c=4 l=4]  *leasi
+	call	flash_changed	# 4658	[c=0 l=5]  *call
+.L579:
+	addl	$2, %r14d	# 4661	[c=4 l=4]  *addsi_1/0
+	xorl	%eax, %eax	# 20185	[c=4 l=2]  *movdi_xor
+	movl	$30, %edx	# 4664	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 4667	[c=4 l=3]  *movdi_internal/3
+	movzwl	%r14w, %ecx	# 4662	[c=4 l=4]  *zero_extendhisi2/0
+	leaq	.LC37(%rip), %rsi	# 4665	[c=1 l=7]  *movdi_internal/4
+	call	log_append@PLT	# 4669	[c=0 l=5]  *call
+	movw	%r14w, 1034(%r13)	# 4670	[c=4 l=8]  *movhi_internal/3
+	cmpl	$65536, 880(%r13)	# 4673	[c=13 l=11]  *cmpsi_1/0
+	ja	.L1521	# 4674	[c=13 l=6]  *jcc
+.L583:
+	movq	%r13, %rdi	# 4706	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 4705	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 4707	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 17335	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 17336	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 4709	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18851	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 4710	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 4712	[c=4 l=3]  *cmpdi_1/0
+	jb	.L344	# 4713	[c=13 l=6]  *jcc
+	movq	56(%r13), %rax	# 17337	[c=9 l=4]  *movdi_internal/3
+	cmpq	%rax, 48(%r13)	# 4716	[c=13 l=4]  *cmpdi_1/0
+	jnb	.L1522	# 4717	[c=13 l=6]  *jcc
+.L586:
+	movq	%r13, %rdi	# 4723	[c=4 l=3]  *movdi_internal/3
+	call	log_is_idle@PLT	# 4724	[c=10 l=5]  *call_value
+	testb	%al, %al	# 4726	[c=4 l=2]  *cmpqi_ccno_1/0
+	jne	.L1523	# 4727	[c=13 l=6]  *jcc
+.L587:
+	movl	0(%r13), %ebx	# 4738	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 4743	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 4739	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 4741	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 4742	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 4744	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 4745	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 4746	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 4749	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 17338	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 4750	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 4753	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 4754	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 20184	[c=10 l=4]  *indirect_jump
+.L588:
+	movzbl	10(%rbx), %r14d	# 4763	[c=13 l=5]  zero_extendqidi2/0
+	movzwl	12(%rbx), %r8d	# 4762	[c=13 l=5]  *zero_extendhisi2/0
+	xorl	%eax, %eax	# 20179	[c=4 l=2]  *movdi_xor
+	movq	%r13, %rdi	# 4770	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC35(%rip), %r15	# 4768	[c=1 l=7]  *movdi_internal/4
+	movzbl	1004(%r13,%r14), %ecx	# 4765	[c=14 l=9]  *zero_extendqisi2/0
+	movq	%r14, %rdx	# 19161	[c=4 l=3]  *movdi_internal/3
+	movq	%r15, %rsi	# 4769	[c=4 l=3]  *movdi_internal/3
+	movl	%r8d, 16(%rsp)	# 18285	[c=4 l=5]  *movsi_internal/1
+	call	log_append@PLT	# 4772	[c=0 l=5]  *call
+	xorl	%eax, %eax	# 20180	[c=4 l=2]  *movdi_xor
+	movq	%r15, %rsi	# 4780	[c=4 l=3]  *movdi_internal/3
+	movq	%r13, %rdi	# 4781	[c=4 l=3]  *movdi_internal/3
+	movzbl	1004(%r13,%r14), %r9d	# 4774	[c=14 l=9]  *zero_extendqisi2/0
+	movslq	16(%rsp), %r14	# 18286	[c=13 l=5]  *extendsidi2_rex64/1
+	movzbl	1004(%r13,%r14), %ecx	# 4776	[c=14 l=9]  *zero_extendqisi2/0
+	movl	%r14d, %edx	# 4778	[c=4 l=3]  *movsi_internal/0
+	movl	%r9d, 8(%rsp)	# 18283	[c=4 l=5]  *movsi_internal/1
+	call	log_append@PLT	# 4783	[c=0 l=5]  *call
+	movl	8(%rsp), %r9d	# 18284	[c=9 l=5]  *movsi_internal/0
+	xorl	%edx, %edx	# 20181	[c=4 l=2]  *movsi_xor
+	movzbl	1004(%r13,%r14), %eax	# 4785	[c=14 l=9]  *zero_extendqisi2/0
+	imull	%r9d, %eax	# 4786	[c=12 l=4]  *mulsi3_1/2
+	movl	%eax, %r14d	# 17340	[c=4 l=3]  *movsi_internal/0
+	addl	%r14d, %r14d	# 20182	[c=4 l=3]  *ashlsi3_cmp
+	sete	%dl	# 20183	[c=4 l=3]  *setcc_qi_slp
+	sarl	$15, %eax	# 4793	[c=4 l=3]  *ashrsi3_1/0
+	addl	%edx, %edx	# 4792	[c=4 l=2]  *ashlsi3_1/0
+	orl	%eax, %edx	# 4794	[c=4 l=2]  *iorsi_1/0
+	movl	$63, %eax	# 4795	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 4796	[c=13 l=7]  *subsi_1/1
+	movl	%edx, %r15d	# 17343	[c=4 l=3]  *movsi_internal/0
+	cmpl	5180(%r13), %eax	# 4797	[c=13 l=7]  *cmpsi_1/1
+	jb	.L589	# 4798	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%r13)	# 4800	[c=13 l=8]  *cmpqi_ccno_1/1
+	jne	.L590	# 4801	[c=13 l=6]  *jcc
+.L589:
+	movq	1040(%r13), %rax	# 4804	[c=9 l=7]  *movdi_internal/3
+	movzbl	63(%rax), %eax	# 4805	[c=13 l=4]  *zero_extendqisi2/0
+.L591:
+	movl	%eax, %ecx	# 4816	[c=4 l=2]  *movsi_internal/0
+	movl	$63, %edx	# 4817	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 4820	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, 8(%rsp)	# 18287	[c=4 l=4]  *movsi_internal/1
+	leaq	.LC33(%rip), %rsi	# 4818	[c=1 l=7]  *movdi_internal/4
+	call	log_add_data_mov@PLT	# 4821	[c=0 l=5]  *call
+	movl	8(%rsp), %eax	# 18288	[c=9 l=4]  *movsi_internal/0
+	movl	$63, %edx	# 4826	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 4829	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC29(%rip), %rsi	# 4827	[c=1 l=7]  *movdi_internal/4
+	andl	$-4, %eax	# 4822	[c=4 l=3]  *andsi_1/0
+	orl	%eax, %r15d	# 4823	[c=4 l=3]  *iorsi_1/0
+	movzbl	%r15b, %ecx	# 4824	[c=4 l=4]  *zero_extendqisi2/0
+	call	log_add_data_mov@PLT	# 4830	[c=0 l=5]  *call
+	movl	$63, %eax	# 4831	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 4832	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 4833	[c=13 l=7]  *cmpsi_1/1
+	jb	.L592	# 4834	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%r13)	# 4836	[c=13 l=8]  *cmpqi_ccno_1/1
+	jne	.L593	# 4837	[c=13 l=6]  *jcc
+.L592:
+	movq	1040(%r13), %rax	# 4840	[c=9 l=7]  *movdi_internal/3
+	movb	%r15b, 63(%rax)	# 4841	[c=4 l=4]  *movqi_internal/8
+.L594:
+	xorl	%edx, %edx	# 20177	[c=4 l=2]  *movdi_xor
+	xorl	%eax, %eax	# 20178	[c=4 l=2]  *movdi_xor
+	movzwl	%r14w, %ecx	# 4852	[c=4 l=4]  *zero_extendhisi2/0
+	movq	%r13, %rdi	# 4857	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC37(%rip), %rsi	# 4855	[c=1 l=7]  *movdi_internal/4
+	call	log_append@PLT	# 4859	[c=0 l=5]  *call
+	movw	%r14w, 1004(%r13)	# 4860	[c=4 l=8]  *movhi_internal/3
+	movq	%r13, %rdi	# 4862	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 4861	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 4863	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 17344	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 17345	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 4865	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18848	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 4866	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 4868	[c=4 l=3]  *cmpdi_1/0
+	jb	.L344	# 4869	[c=13 l=6]  *jcc
+	movl	0(%r13), %ebx	# 4871	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 4876	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 4872	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 4874	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 4875	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 4877	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 4878	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 4879	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 4882	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 17346	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 4883	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 4886	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 4887	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 20176	[c=10 l=4]  *indirect_jump
+.L602:
+	movzbl	10(%rbx), %r14d	# 5030	[c=13 l=5]  zero_extendqidi2/0
+	movzwl	12(%rbx), %r8d	# 5029	[c=13 l=5]  *zero_extendhisi2/0
+	xorl	%eax, %eax	# 20163	[c=4 l=2]  *movdi_xor
+	movq	%r13, %rdi	# 5037	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC35(%rip), %r15	# 5035	[c=1 l=7]  *movdi_internal/4
+	movzbl	1004(%r13,%r14), %ecx	# 5032	[c=14 l=9]  *zero_extendqisi2/0
+	movq	%r14, %rdx	# 19165	[c=4 l=3]  *movdi_internal/3
+	movq	%r15, %rsi	# 5036	[c=4 l=3]  *movdi_internal/3
+	movl	%r8d, 16(%rsp)	# 18297	[c=4 l=5]  *movsi_internal/1
+	call	log_append@PLT	# 5039	[c=0 l=5]  *call
+	xorl	%eax, %eax	# 20164	[c=4 l=2]  *movdi_xor
+	movq	%r15, %rsi	# 5047	[c=4 l=3]  *movdi_internal/3
+	movq	%r13, %rdi	# 5048	[c=4 l=3]  *movdi_internal/3
+	movsbl	1004(%r13,%r14), %r9d	# 5041	[c=14 l=9]  extendqisi2
+	movslq	16(%rsp), %r14	# 18298	[c=13 l=5]  *extendsidi2_rex64/1
+	movzbl	1004(%r13,%r14), %ecx	# 5043	[c=14 l=9]  *zero_extendqisi2/0
+	movl	%r14d, %edx	# 5045	[c=4 l=3]  *movsi_internal/0
+	movl	%r9d, 8(%rsp)	# 18295	[c=4 l=5]  *movsi_internal/1
+	call	log_append@PLT	# 5050	[c=0 l=5]  *call
+	movl	8(%rsp), %r9d	# 18296	[c=9 l=5]  *movsi_internal/0
+	xorl	%edx, %edx	# 20165	[c=4 l=2]  *movsi_xor
+	movzbl	1004(%r13,%r14), %eax	# 5052	[c=14 l=9]  *zero_extendqisi2/0
+	imull	%r9d, %eax	# 5053	[c=12 l=4]  *mulsi3_1/2
+	movzwl	%ax, %eax	# 5054	[c=4 l=3]  *zero_extendhisi2/0
+	movl	%eax, %r14d	# 17356	[c=4 l=3]  *movsi_internal/0
+	addl	%r14d, %r14d	# 20166	[c=4 l=3]  *ashlsi3_cmp
+	sete	%dl	# 20167	[c=4 l=3]  *setcc_qi_slp
+	sarl	$15, %eax	# 5061	[c=4 l=3]  *ashrsi3_1/0
+	addl	%edx, %edx	# 5060	[c=4 l=2]  *ashlsi3_1/0
+	orl	%eax, %edx	# 5062	[c=4 l=2]  *iorsi_1/0
+	movl	$63, %eax	# 5063	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 5064	[c=13 l=7]  *subsi_1/1
+	movl	%edx, %r15d	# 17359	[c=4 l=3]  *movsi_internal/0
+	cmpl	5180(%r13), %eax	# 5065	[c=13 l=7]  *cmpsi_1/1
+	jb	.L603	# 5066	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%r13)	# 5068	[c=13 l=8]  *cmpqi_ccno_1/1
+	jne	.L604	# 5069	[c=13 l=6]  *jcc
+.L603:
+	movq	1040(%r13), %rax	# 5072	[c=9 l=7]  *movdi_internal/3
+	movzbl	63(%rax), %eax	# 5073	[c=13 l=4]  *zero_extendqisi2/0
+.L605:
+	movl	%eax, %ecx	# 5084	[c=4 l=2]  *movsi_internal/0
+	movl	$63, %edx	# 5085	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 5088	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, 8(%rsp)	# 18299	[c=4 l=4]  *movsi_internal/1
+	leaq	.LC33(%rip), %rsi	# 5086	[c=1 l=7]  *movdi_internal/4
+	call	log_add_data_mov@PLT	# 5089	[c=0 l=5]  *call
+	movl	8(%rsp), %eax	# 18300	[c=9 l=4]  *movsi_internal/0
+	movl	$63, %edx	# 5094	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 5097	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC29(%rip), %rsi	# 5095	[c=1 l=7]  *movdi_internal/4
+	andl	$-4, %eax	# 5090	[c=4 l=3]  *andsi_1/0
+	orl	%eax, %r15d	# 5091	[c=4 l=3]  *iorsi_1/0
+	movzbl	%r15b, %ecx	# 5092	[c=4 l=4]  *zero_extendqisi2/0
+	call	log_add_data_mov@PLT	# 5098	[c=0 l=5]  *call
+	movl	$63, %eax	# 5099	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 5100	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 5101	[c=13 l=7]  *cmpsi_1/1
+	jb	.L606	# 5102	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%r13)	# 5104	[c=13 l=8]  *cmpqi_ccno_1/1
+	jne	.L607	# 5105	[c=13 l=6]  *jcc
+.L606:
+	movq	1040(%r13), %rax	# 5108	[c=9 l=7]  *movdi_internal/3
+	movb	%r15b, 63(%rax)	# 5109	[c=4 l=4]  *movqi_internal/8
+.L608:
+	xorl	%edx, %edx	# 20161	[c=4 l=2]  *movdi_xor
+	xorl	%eax, %eax	# 20162	[c=4 l=2]  *movdi_xor
+	movzwl	%r14w, %ecx	# 5120	[c=4 l=4]  *zero_extendhisi2/0
+	movq	%r13, %rdi	# 5125	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC37(%rip), %rsi	# 5123	[c=1 l=7]  *movdi_internal/4
+	call	log_append@PLT	# 5127	[c=0 l=5]  *call
+	movw	%r14w, 1004(%r13)	# 5128	[c=4 l=8]  *movhi_internal/3
+	movq	%r13, %rdi	# 5130	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 5129	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 5131	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 17360	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 17361	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 5133	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18842	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 5134	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 5136	[c=4 l=3]  *cmpdi_1/0
+	jb	.L344	# 5137	[c=13 l=6]  *jcc
+	movl	0(%r13), %ebx	# 5139	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 5144	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 5140	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 5142	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 5143	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 5145	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 5146	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 5147	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 5150	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 17362	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 5151	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 5154	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 5155	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 20160	[c=10 l=4]  *indirect_jump
+.L609:
+	movl	5176(%r13), %r15d	# 5163	[c=9 l=7]  *movsi_internal/0
+	movl	$61, %eax	# 5165	[c=4 l=5]  *movsi_internal/0
+	movl	5180(%r13), %r14d	# 5164	[c=9 l=7]  *movsi_internal/0
+	subl	%r15d, %eax	# 5166	[c=4 l=3]  *subsi_1/0
+	cmpl	%r14d, %eax	# 5167	[c=4 l=3]  *cmpsi_1/0
+	jb	.L610	# 5168	[c=13 l=6]  *jcc
+	cmpb	$1, 1081(%r13)	# 5172	[c=13 l=8]  *cmpqi_1/0
+	ja	.L1524	# 5173	[c=13 l=6]  *jcc
+	movq	1040(%r13), %rax	# 14311	[c=9 l=7]  *movdi_internal/3
+	movzbl	61(%rax), %edx	# 14312	[c=13 l=4]  *zero_extendqisi2/0
+.L612:
+	movzbl	62(%rax), %r8d	# 5210	[c=13 l=5]  *zero_extendqisi2/0
+.L614:
+	sall	$8, %r8d	# 5213	[c=4 l=4]  *ashlsi3_1/0
+	leaq	.LC31(%rip), %rsi	# 5217	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 5219	[c=4 l=3]  *movdi_internal/3
+	orl	%edx, %r8d	# 5214	[c=4 l=3]  *iorsi_1/0
+	movl	$61, %edx	# 5216	[c=4 l=5]  *movsi_internal/0
+	movl	%r8d, %ecx	# 5215	[c=4 l=3]  *movsi_internal/0
+	movl	%r8d, %r15d	# 17365	[c=4 l=3]  *movsi_internal/0
+	call	log_add_data_mov@PLT	# 5220	[c=0 l=5]  *call
+	movl	996(%r13), %edx	# 5222	[c=9 l=7]  *movsi_internal/0
+	movzbl	840(%r13), %eax	# 5224	[c=13 l=8]  *zero_extendqisi2/0
+	leal	1(%rdx,%rax), %eax	# 5225	[c=5 l=4]  *leasi
+	cmpl	%eax, %r15d	# 5226	[c=4 l=3]  *cmpsi_1/0
+	jb	.L1382	# 5227	[c=13 l=6]  *jcc
+	cmpl	$63, %r15d	# 15370	[c=4 l=4]  *cmpsi_1/0
+	movl	0(%r13), %r14d	# 5235	[c=5 l=4]  *movsi_internal/0
+	leal	-1(%r15), %r9d	# 18841	[c=4 l=4]  *leasi
+	movl	%r15d, %edx	# 5244	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC30(%rip), %rax	# 16935	[c=1 l=7]  *movdi_internal/4
+	leaq	.LC29(%rip), %rsi	# 16934	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 5246	[c=4 l=3]  *movdi_internal/3
+	movl	%r9d, 8(%rsp)	# 18303	[c=4 l=5]  *movsi_internal/1
+	cmovne	%rax, %rsi	# 15371	[c=8 l=4]  *movdicc_noc/1
+	movzbl	%r14b, %ecx	# 5237	[c=4 l=4]  *zero_extendqisi2/0
+	call	log_add_data_mov@PLT	# 5247	[c=0 l=5]  *call
+	movl	%r15d, %eax	# 17366	[c=4 l=3]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 5248	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 5249	[c=13 l=7]  *cmpsi_1/1
+	movl	8(%rsp), %r9d	# 18304	[c=9 l=5]  *movsi_internal/0
+	jb	.L617	# 5250	[c=13 l=2]  *jcc
+	movl	%r15d, %eax	# 17368	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %eax	# 5252	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 16885	[c=5 l=5]  *andsi_1_zext
+	cmpb	$0, 1080(%r13,%rax)	# 5255	[c=14 l=9]  *cmpqi_ccno_1/1
+	jne	.L618	# 5256	[c=13 l=6]  *jcc
+.L617:
+	movq	1040(%r13), %rdx	# 5260	[c=9 l=7]  *movdi_internal/3
+	movslq	%r15d, %rax	# 5259	[c=4 l=3]  *extendsidi2_rex64/1
+	movb	%r14b, (%rdx,%rax)	# 5261	[c=4 l=4]  *movqi_internal/8
+.L619:
+	movl	0(%r13), %ecx	# 5272	[c=5 l=4]  *movsi_internal/0
+	movl	%r9d, %edx	# 5282	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 5284	[c=4 l=3]  *movdi_internal/3
+	movl	%r9d, 16(%rsp)	# 18307	[c=4 l=5]  *movsi_internal/1
+	leaq	.LC29(%rip), %rsi	# 16936	[c=1 l=7]  *movdi_internal/4
+	leal	-2(%r15), %r14d	# 18840	[c=4 l=4]  *leasi
+	movl	%ecx, %eax	# 17370	[c=4 l=2]  *movsi_internal/0
+	movzbl	%ch, %ecx	# 5275	[c=4 l=3]  *extzvsi
+	shrl	$8, %eax	# 5273	[c=4 l=3]  *lshrsi3_1/0
+	cmpl	$63, %r9d	# 15382	[c=4 l=4]  *cmpsi_1/0
+	movl	%eax, 8(%rsp)	# 17371	[c=4 l=4]  *movsi_internal/1
+	leaq	.LC30(%rip), %rax	# 16937	[c=1 l=7]  *movdi_internal/4
+	cmovne	%rax, %rsi	# 15383	[c=8 l=4]  *movdicc_noc/1
+	call	log_add_data_mov@PLT	# 5285	[c=0 l=5]  *call
+	movslq	16(%rsp), %r9	# 18308	[c=13 l=5]  *extendsidi2_rex64/1
+	movl	%r9d, %eax	# 17372	[c=4 l=3]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 5286	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 5287	[c=13 l=7]  *cmpsi_1/1
+	jb	.L621	# 5288	[c=13 l=2]  *jcc
+	movl	%r9d, %eax	# 17374	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %eax	# 5290	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 16884	[c=5 l=5]  *andsi_1_zext
+	cmpb	$0, 1080(%r13,%rax)	# 5293	[c=14 l=9]  *cmpqi_ccno_1/1
+	jne	.L622	# 5294	[c=13 l=6]  *jcc
+.L621:
+	movq	1040(%r13), %rax	# 5298	[c=9 l=7]  *movdi_internal/3
+	movzbl	8(%rsp), %edi	# 17376	[c=9 l=5]  *movqi_internal/4
+	movb	%dil, (%rax,%r9)	# 5299	[c=4 l=4]  *movqi_internal/8
+.L623:
+	cmpb	$0, 840(%r13)	# 5310	[c=13 l=8]  *cmpqi_ccno_1/1
+	je	.L624	# 5311	[c=13 l=2]  *jcc
+	movl	0(%r13), %eax	# 17377	[c=5 l=4]  *movsi_internal/0
+	subl	$3, %r15d	# 5315	[c=4 l=4]  *addsi_1/0
+	movq	%r13, %rdi	# 5325	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC30(%rip), %rdx	# 16939	[c=1 l=7]  *movdi_internal/4
+	leaq	.LC29(%rip), %rsi	# 16938	[c=1 l=7]  *movdi_internal/4
+	shrl	$16, %eax	# 5314	[c=4 l=3]  *lshrsi3_1/0
+	cmpl	$63, %r14d	# 15394	[c=4 l=4]  *cmpsi_1/0
+	cmovne	%rdx, %rsi	# 15395	[c=8 l=4]  *movdicc_noc/1
+	movzbl	%al, %ecx	# 5316	[c=4 l=3]  *zero_extendqisi2/0
+	movl	%r14d, %edx	# 5323	[c=4 l=3]  *movsi_internal/0
+	movl	%eax, 8(%rsp)	# 18309	[c=4 l=4]  *movsi_internal/1
+	call	log_add_data_mov@PLT	# 5326	[c=0 l=5]  *call
+	movl	%r14d, %edx	# 17379	[c=4 l=3]  *movsi_internal/0
+	subl	5176(%r13), %edx	# 5327	[c=13 l=7]  *subsi_1/1
+	movl	8(%rsp), %eax	# 18310	[c=9 l=4]  *movsi_internal/0
+	cmpl	5180(%r13), %edx	# 5328	[c=13 l=7]  *cmpsi_1/1
+	jb	.L626	# 5329	[c=13 l=2]  *jcc
+	movl	%r14d, %edx	# 17381	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %edx	# 5331	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %edx	# 16883	[c=5 l=6]  *andsi_1_zext
+	cmpb	$0, 1080(%r13,%rdx)	# 5334	[c=14 l=9]  *cmpqi_ccno_1/1
+	jne	.L627	# 5335	[c=13 l=6]  *jcc
+.L626:
+	movq	1040(%r13), %rdx	# 5339	[c=9 l=7]  *movdi_internal/3
+	movslq	%r14d, %r14	# 5338	[c=4 l=3]  *extendsidi2_rex64/1
+	movb	%al, (%rdx,%r14)	# 5340	[c=4 l=4]  *movqi_internal/8
+.L628:
+	movl	%r15d, %r14d	# 32	[c=4 l=3]  *movsi_internal/0
+.L624:
+	movzwl	%r14w, %r15d	# 5355	[c=4 l=4]  *zero_extendhisi2/0
+	movl	$61, %edx	# 5357	[c=4 l=5]  *movsi_internal/0
+	leaq	.LC32(%rip), %rsi	# 5358	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 5360	[c=4 l=3]  *movdi_internal/3
+	movl	%r15d, %ecx	# 5356	[c=4 l=3]  *movsi_internal/0
+	call	log_add_data_mov@PLT	# 5361	[c=0 l=5]  *call
+	movl	$61, %eax	# 5362	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 5363	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 5364	[c=13 l=7]  *cmpsi_1/1
+	jb	.L629	# 5365	[c=13 l=2]  *jcc
+	cmpb	$1, 1081(%r13)	# 5369	[c=13 l=8]  *cmpqi_1/0
+	ja	.L1525	# 5370	[c=13 l=6]  *jcc
+.L629:
+	movq	1040(%r13), %rax	# 5381	[c=9 l=7]  *movdi_internal/3
+	movb	%r14b, 61(%rax)	# 5382	[c=4 l=4]  *movqi_internal/8
+.L630:
+	movl	$62, %eax	# 5386	[c=4 l=5]  *movsi_internal/0
+	sarl	$8, %r15d	# 5385	[c=4 l=4]  *ashrsi3_1/0
+	subl	5176(%r13), %eax	# 5387	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 5388	[c=13 l=7]  *cmpsi_1/1
+	jb	.L631	# 5389	[c=13 l=2]  *jcc
+	cmpb	$1, 1081(%r13)	# 5393	[c=13 l=8]  *cmpqi_1/0
+	ja	.L1526	# 5394	[c=13 l=6]  *jcc
+.L631:
+	movq	1040(%r13), %rax	# 5404	[c=9 l=7]  *movdi_internal/3
+	movb	%r15b, 62(%rax)	# 5405	[c=4 l=4]  *movqi_internal/8
+.L632:
+	movzwl	1034(%r13), %r14d	# 5409	[c=13 l=8]  *zero_extendhisi2/0
+	movl	$30, %edx	# 5411	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 5414	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 20159	[c=4 l=2]  *movdi_xor
+	leaq	.LC34(%rip), %rsi	# 5412	[c=1 l=7]  *movdi_internal/4
+	movl	%r14d, %ecx	# 5410	[c=4 l=3]  *movsi_internal/0
+	call	log_append@PLT	# 5416	[c=0 l=5]  *call
+	movl	%r14d, 0(%r13)	# 5418	[c=4 l=4]  *movsi_internal/1
+	cmpl	%r14d, 992(%r13)	# 5419	[c=13 l=7]  *cmpsi_1/0
+	jb	.L1381	# 5420	[c=13 l=6]  *jcc
+	movzbl	840(%r13), %eax	# 5428	[c=13 l=8]  zero_extendqidi2/0
+	addq	%rax, 48(%r13)	# 5429	[c=13 l=4]  *adddi_1/0
+	movq	%r13, %rdi	# 5431	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 5430	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 5432	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 17383	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 17384	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 5434	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18839	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 5435	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 5437	[c=4 l=3]  *cmpdi_1/0
+	jb	.L344	# 5438	[c=13 l=6]  *jcc
+	movq	56(%r13), %rax	# 17385	[c=9 l=4]  *movdi_internal/3
+	cmpq	%rax, 48(%r13)	# 5441	[c=13 l=4]  *cmpdi_1/0
+	jnb	.L1527	# 5442	[c=13 l=6]  *jcc
+.L634:
+	movq	%r13, %rdi	# 5448	[c=4 l=3]  *movdi_internal/3
+	call	log_is_idle@PLT	# 5449	[c=10 l=5]  *call_value
+	testb	%al, %al	# 5451	[c=4 l=2]  *cmpqi_ccno_1/0
+	jne	.L1528	# 5452	[c=13 l=6]  *jcc
+.L635:
+	movl	0(%r13), %ebx	# 5463	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 5468	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 5464	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 5466	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 5467	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 5469	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 5470	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 5471	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 5474	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 17386	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 5475	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 5478	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 5479	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 20158	[c=10 l=4]  *indirect_jump
+.L636:
+	movzwl	1034(%r13), %r14d	# 5488	[c=13 l=8]  *zero_extendhisi2/0
+	movl	$30, %edx	# 5490	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 5493	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 20157	[c=4 l=2]  *movdi_xor
+	leaq	.LC34(%rip), %rsi	# 5491	[c=1 l=7]  *movdi_internal/4
+	movl	%r14d, %ecx	# 5489	[c=4 l=3]  *movsi_internal/0
+	call	log_append@PLT	# 5495	[c=0 l=5]  *call
+	movl	%r14d, 0(%r13)	# 5497	[c=4 l=4]  *movsi_internal/1
+	cmpl	%r14d, 992(%r13)	# 5498	[c=13 l=7]  *cmpsi_1/0
+	jb	.L1381	# 5499	[c=13 l=6]  *jcc
+	movq	%r13, %rdi	# 5508	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 5507	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 5509	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 17388	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 17389	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 5511	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18838	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 5512	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 5514	[c=4 l=3]  *cmpdi_1/0
+	jb	.L344	# 5515	[c=13 l=6]  *jcc
+	movq	56(%r13), %rax	# 17390	[c=9 l=4]  *movdi_internal/3
+	cmpq	%rax, 48(%r13)	# 5518	[c=13 l=4]  *cmpdi_1/0
+	jnb	.L1529	# 5519	[c=13 l=6]  *jcc
+.L638:
+	movq	%r13, %rdi	# 5525	[c=4 l=3]  *movdi_internal/3
+	call	log_is_idle@PLT	# 5526	[c=10 l=5]  *call_value
+	testb	%al, %al	# 5528	[c=4 l=2]  *cmpqi_ccno_1/0
+	jne	.L1530	# 5529	[c=13 l=6]  *jcc
+.L639:
+	movl	0(%r13), %ebx	# 5540	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 5545	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 5541	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 5543	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 5544	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 5546	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 5547	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 5548	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 5551	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 17391	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 5552	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 5555	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 5556	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 20156	[c=10 l=4]  *indirect_jump
+.L640:
+	movzwl	12(%rbx), %edx	# 5564	[c=13 l=4]  zero_extendhidi2/0
+	movzbl	10(%rbx), %r15d	# 5566	[c=13 l=5]  zero_extendqidi2/0
+	movl	%edx, %ecx	# 17393	[c=4 l=2]  *movsi_internal/0
+	movq	%rdx, %rax	# 19167	[c=4 l=3]  *movdi_internal/3
+	subl	5176(%r13), %ecx	# 5568	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %ecx	# 5569	[c=13 l=7]  *cmpsi_1/1
+	jb	.L641	# 5570	[c=13 l=2]  *jcc
+	movl	%edx, %ecx	# 17395	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %ecx	# 5572	[c=4 l=3]  *ashrsi3_1/0
+	movslq	%ecx, %rcx	# 5573	[c=4 l=3]  *extendsidi2_rex64/1
+	cmpb	$0, 1080(%r13,%rcx)	# 5574	[c=14 l=9]  *cmpqi_ccno_1/1
+	jne	.L642	# 5575	[c=13 l=6]  *jcc
+.L641:
+	movq	1040(%r13), %rcx	# 5579	[c=9 l=7]  *movdi_internal/3
+	movzbl	(%rcx,%rax), %r14d	# 5580	[c=13 l=5]  *zero_extendqisi2/0
+.L643:
+	cmpl	$63, %edx	# 15406	[c=4 l=3]  *cmpsi_1/0
+	leaq	.LC25(%rip), %rax	# 16941	[c=1 l=7]  *movdi_internal/4
+	movl	%r14d, %ecx	# 5596	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 5599	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC33(%rip), %rsi	# 16940	[c=1 l=7]  *movdi_internal/4
+	cmovne	%rax, %rsi	# 15407	[c=8 l=4]  *movdicc_noc/1
+	call	log_add_data_mov@PLT	# 5600	[c=0 l=5]  *call
+	movl	%r15d, %edx	# 5603	[c=4 l=3]  *movsi_internal/0
+	xorl	%eax, %eax	# 20155	[c=4 l=2]  *movdi_xor
+	movzbl	%r14b, %ecx	# 5601	[c=4 l=4]  *zero_extendqisi2/0
+	leaq	.LC36(%rip), %rsi	# 5604	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 5606	[c=4 l=3]  *movdi_internal/3
+	call	log_append@PLT	# 5608	[c=0 l=5]  *call
+	movb	%r14b, 1004(%r13,%r15)	# 5610	[c=4 l=8]  *movqi_internal/8
+	movq	%r13, %rdi	# 5612	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 5611	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 5613	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 17397	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 17398	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 5615	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18837	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 5616	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 5618	[c=4 l=3]  *cmpdi_1/0
+	jb	.L344	# 5619	[c=13 l=6]  *jcc
+	movl	0(%r13), %ebx	# 5621	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 5626	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 5622	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 5624	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 5625	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 5627	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 5628	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 5629	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 5632	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 17399	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 5633	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 5636	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 5637	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 20154	[c=10 l=4]  *indirect_jump
+.L595:
+	movzbl	10(%rbx), %r14d	# 4896	[c=13 l=5]  zero_extendqidi2/0
+	movzwl	12(%rbx), %r8d	# 4895	[c=13 l=5]  *zero_extendhisi2/0
+	xorl	%eax, %eax	# 20171	[c=4 l=2]  *movdi_xor
+	movq	%r13, %rdi	# 4903	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC35(%rip), %r15	# 4901	[c=1 l=7]  *movdi_internal/4
+	movzbl	1004(%r13,%r14), %ecx	# 4898	[c=14 l=9]  *zero_extendqisi2/0
+	movq	%r14, %rdx	# 19163	[c=4 l=3]  *movdi_internal/3
+	movq	%r15, %rsi	# 4902	[c=4 l=3]  *movdi_internal/3
+	movl	%r8d, 16(%rsp)	# 18291	[c=4 l=5]  *movsi_internal/1
+	call	log_append@PLT	# 4905	[c=0 l=5]  *call
+	xorl	%eax, %eax	# 20172	[c=4 l=2]  *movdi_xor
+	movq	%r15, %rsi	# 4913	[c=4 l=3]  *movdi_internal/3
+	movq	%r13, %rdi	# 4914	[c=4 l=3]  *movdi_internal/3
+	movsbl	1004(%r13,%r14), %r9d	# 4907	[c=14 l=9]  extendqisi2
+	movslq	16(%rsp), %r14	# 18292	[c=13 l=5]  *extendsidi2_rex64/1
+	movzbl	1004(%r13,%r14), %ecx	# 4909	[c=14 l=9]  *zero_extendqisi2/0
+	movl	%r14d, %edx	# 4911	[c=4 l=3]  *movsi_internal/0
+	movl	%r9d, 8(%rsp)	# 18289	[c=4 l=5]  *movsi_internal/1
+	call	log_append@PLT	# 4916	[c=0 l=5]  *call
+	movl	8(%rsp), %r9d	# 18290	[c=9 l=5]  *movsi_internal/0
+	xorl	%edx, %edx	# 20173	[c=4 l=2]  *movsi_xor
+	movsbl	1004(%r13,%r14), %eax	# 4918	[c=14 l=9]  extendqisi2
+	imull	%r9d, %eax	# 4919	[c=12 l=4]  *mulsi3_1/2
+	movzwl	%ax, %eax	# 4920	[c=4 l=3]  *zero_extendhisi2/0
+	movl	%eax, %r14d	# 17348	[c=4 l=3]  *movsi_internal/0
+	addl	%r14d, %r14d	# 20174	[c=4 l=3]  *ashlsi3_cmp
+	sete	%dl	# 20175	[c=4 l=3]  *setcc_qi_slp
+	sarl	$15, %eax	# 4927	[c=4 l=3]  *ashrsi3_1/0
+	addl	%edx, %edx	# 4926	[c=4 l=2]  *ashlsi3_1/0
+	orl	%eax, %edx	# 4928	[c=4 l=2]  *iorsi_1/0
+	movl	$63, %eax	# 4929	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 4930	[c=13 l=7]  *subsi_1/1
+	movl	%edx, %r15d	# 17351	[c=4 l=3]  *movsi_internal/0
+	cmpl	5180(%r13), %eax	# 4931	[c=13 l=7]  *cmpsi_1/1
+	jb	.L596	# 4932	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%r13)	# 4934	[c=13 l=8]  *cmpqi_ccno_1/1
+	jne	.L597	# 4935	[c=13 l=6]  *jcc
+.L596:
+	movq	1040(%r13), %rax	# 4938	[c=9 l=7]  *movdi_internal/3
+	movzbl	63(%rax), %eax	# 4939	[c=13 l=4]  *zero_extendqisi2/0
+.L598:
+	movl	%eax, %ecx	# 4950	[c=4 l=2]  *movsi_internal/0
+	movl	$63, %edx	# 4951	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 4954	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, 8(%rsp)	# 18293	[c=4 l=4]  *movsi_internal/1
+	leaq	.LC33(%rip), %rsi	# 4952	[c=1 l=7]  *movdi_internal/4
+	call	log_add_data_mov@PLT	# 4955	[c=0 l=5]  *call
+	movl	8(%rsp), %eax	# 18294	[c=9 l=4]  *movsi_internal/0
+	movl	$63, %edx	# 4960	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 4963	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC29(%rip), %rsi	# 4961	[c=1 l=7]  *movdi_internal/4
+	andl	$-4, %eax	# 4956	[c=4 l=3]  *andsi_1/0
+	orl	%eax, %r15d	# 4957	[c=4 l=3]  *iorsi_1/0
+	movzbl	%r15b, %ecx	# 4958	[c=4 l=4]  *zero_extendqisi2/0
+	call	log_add_data_mov@PLT	# 4964	[c=0 l=5]  *call
+	movl	$63, %eax	# 4965	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 4966	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 4967	[c=13 l=7]  *cmpsi_1/1
+	jb	.L599	# 4968	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%r13)	# 4970	[c=13 l=8]  *cmpqi_ccno_1/1
+	jne	.L600	# 4971	[c=13 l=6]  *jcc
+.L599:
+	movq	1040(%r13), %rax	# 4974	[c=9 l=7]  *movdi_internal/3
+	movb	%r15b, 63(%rax)	# 4975	[c=4 l=4]  *movqi_internal/8
+.L601:
+	xorl	%edx, %edx	# 20169	[c=4 l=2]  *movdi_xor
+	xorl	%eax, %eax	# 20170	[c=4 l=2]  *movdi_xor
+	movzwl	%r14w, %ecx	# 4986	[c=4 l=4]  *zero_extendhisi2/0
+	movq	%r13, %rdi	# 4991	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC37(%rip), %rsi	# 4989	[c=1 l=7]  *movdi_internal/4
+	call	log_append@PLT	# 4993	[c=0 l=5]  *call
+	movw	%r14w, 1004(%r13)	# 4994	[c=4 l=8]  *movhi_internal/3
+	movq	%r13, %rdi	# 4996	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 4995	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 4997	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 17352	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 17353	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 4999	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18845	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 5000	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 5002	[c=4 l=3]  *cmpdi_1/0
+	jb	.L344	# 5003	[c=13 l=6]  *jcc
+	movl	0(%r13), %ebx	# 5005	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 5010	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 5006	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 5008	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 5009	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 5011	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 5012	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 5013	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 5016	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 17354	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 5017	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 5020	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 5021	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 20168	[c=10 l=4]  *indirect_jump
+.L656:
+	movzwl	12(%rbx), %r15d	# 5835	[c=9 l=5]  *movhi_internal/2
+	movzbl	10(%rbx), %r14d	# 5836	[c=13 l=5]  zero_extendqidi2/0
+	xorl	%eax, %eax	# 20149	[c=4 l=2]  *movdi_xor
+	movq	%r13, %rdi	# 5843	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC36(%rip), %rsi	# 5841	[c=1 l=7]  *movdi_internal/4
+	movl	%r14d, %edx	# 5840	[c=4 l=3]  *movsi_internal/0
+	movzbl	%r15b, %ecx	# 5838	[c=4 l=4]  *zero_extendqisi2/0
+	call	log_append@PLT	# 5845	[c=0 l=5]  *call
+	movb	%r15b, 1004(%r13,%r14)	# 5847	[c=4 l=8]  *movqi_internal/8
+	movq	%r13, %rdi	# 5849	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 5848	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 5850	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 17410	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 17411	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 5852	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18832	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 5853	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 5855	[c=4 l=3]  *cmpdi_1/0
+	jb	.L344	# 5856	[c=13 l=6]  *jcc
+	movl	0(%r13), %ebx	# 5858	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 5863	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 5859	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 5861	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 5862	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 5864	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 5865	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 5866	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 5869	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 17412	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 5870	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 5873	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 5874	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 20148	[c=10 l=4]  *indirect_jump
+.L657:
+	cmpb	$0, 844(%r13)	# 5884	[c=13 l=8]  *cmpqi_ccno_1/1
+	movzwl	12(%rbx), %r8d	# 5882	[c=13 l=5]  *zero_extendhisi2/0
+	movzbl	10(%rbx), %r14d	# 5883	[c=13 l=5]  zero_extendqidi2/0
+	jne	.L1531	# 5885	[c=13 l=6]  *jcc
+	movl	$28, %edx	# 5900	[c=4 l=5]  *movsi_internal/0
+	xorl	%eax, %eax	# 20145	[c=4 l=2]  *movdi_xor
+	movq	%r13, %rdi	# 5903	[c=4 l=3]  *movdi_internal/3
+	movl	%r8d, 8(%rsp)	# 18317	[c=4 l=5]  *movsi_internal/1
+	movzwl	1032(%r13), %r15d	# 5898	[c=13 l=8]  *zero_extendhisi2/0
+	leaq	.LC34(%rip), %rsi	# 5901	[c=1 l=7]  *movdi_internal/4
+	movl	%r15d, %ecx	# 5899	[c=4 l=3]  *movsi_internal/0
+	call	log_append@PLT	# 5905	[c=0 l=5]  *call
+	movl	8(%rsp), %r8d	# 18318	[c=9 l=5]  *movsi_internal/0
+	leal	(%r8,%r15), %edx	# 18831	[c=4 l=4]  *leasi
+	movl	%edx, %eax	# 17414	[c=4 l=2]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 5907	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 5908	[c=13 l=7]  *cmpsi_1/1
+	jb	.L660	# 5909	[c=13 l=2]  *jcc
+	movl	%edx, %eax	# 17416	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %eax	# 5911	[c=4 l=3]  *ashrsi3_1/0
+	cltq	# 5912	[c=4 l=2]  *extendsidi2_rex64/0
+	cmpb	$0, 1080(%r13,%rax)	# 5913	[c=14 l=9]  *cmpqi_ccno_1/1
+	jne	.L661	# 5914	[c=13 l=6]  *jcc
+.L660:
+	movq	1040(%r13), %rcx	# 5918	[c=9 l=7]  *movdi_internal/3
+	movslq	%edx, %rax	# 5917	[c=4 l=3]  *extendsidi2_rex64/1
+	movzbl	(%rcx,%rax), %r15d	# 5919	[c=13 l=5]  *zero_extendqisi2/0
+.L662:
+	cmpl	$63, %edx	# 15418	[c=4 l=3]  *cmpsi_1/0
+	leaq	.LC25(%rip), %rax	# 16943	[c=1 l=7]  *movdi_internal/4
+	movl	%r15d, %ecx	# 5935	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 5938	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC33(%rip), %rsi	# 16942	[c=1 l=7]  *movdi_internal/4
+	movl	%r8d, 8(%rsp)	# 18323	[c=4 l=5]  *movsi_internal/1
+	cmovne	%rax, %rsi	# 15419	[c=8 l=4]  *movdicc_noc/1
+	call	log_add_data_mov@PLT	# 5939	[c=0 l=5]  *call
+	movzbl	%r15b, %ecx	# 5940	[c=4 l=4]  *zero_extendqisi2/0
+	movl	%r14d, %edx	# 5942	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 5945	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC36(%rip), %rsi	# 5943	[c=1 l=7]  *movdi_internal/4
+	xorl	%eax, %eax	# 20144	[c=4 l=2]  *movdi_xor
+	call	log_append@PLT	# 5947	[c=0 l=5]  *call
+	movl	8(%rsp), %r8d	# 18324	[c=9 l=5]  *movsi_internal/0
+	movb	%r15b, 1004(%r13,%r14)	# 5949	[c=4 l=8]  *movqi_internal/8
+	testl	%r8d, %r8d	# 5950	[c=4 l=3]  *cmpsi_ccno_1/0
+	jne	.L659	# 5951	[c=13 l=2]  *jcc
+	subq	$1, 48(%r13)	# 5953	[c=13 l=5]  *adddi_1/0
+.L659:
+	movq	%r13, %rdi	# 5957	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 5956	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 5958	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 17418	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 17419	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 5960	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18830	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 5961	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 5963	[c=4 l=3]  *cmpdi_1/0
+	jb	.L344	# 5964	[c=13 l=6]  *jcc
+	movl	0(%r13), %ebx	# 5966	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 5971	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 5967	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 5969	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 5970	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 5972	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 5973	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 5974	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 5977	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 17420	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 5978	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 5981	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 5982	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 20143	[c=10 l=4]  *indirect_jump
+.L664:
+	cmpb	$0, 844(%r13)	# 5992	[c=13 l=8]  *cmpqi_ccno_1/1
+	movzwl	12(%rbx), %r8d	# 5990	[c=13 l=5]  *zero_extendhisi2/0
+	movzbl	10(%rbx), %r14d	# 5991	[c=13 l=5]  zero_extendqidi2/0
+	jne	.L1532	# 5993	[c=13 l=6]  *jcc
+	movl	$30, %edx	# 6008	[c=4 l=5]  *movsi_internal/0
+	xorl	%eax, %eax	# 20140	[c=4 l=2]  *movdi_xor
+	movq	%r13, %rdi	# 6011	[c=4 l=3]  *movdi_internal/3
+	movl	%r8d, 8(%rsp)	# 18325	[c=4 l=5]  *movsi_internal/1
+	movzwl	1034(%r13), %r15d	# 6006	[c=13 l=8]  *zero_extendhisi2/0
+	leaq	.LC34(%rip), %rsi	# 6009	[c=1 l=7]  *movdi_internal/4
+	movl	%r15d, %ecx	# 6007	[c=4 l=3]  *movsi_internal/0
+	call	log_append@PLT	# 6013	[c=0 l=5]  *call
+	movl	8(%rsp), %r8d	# 18326	[c=9 l=5]  *movsi_internal/0
+	leal	(%r8,%r15), %edx	# 18829	[c=4 l=4]  *leasi
+	movl	%edx, %eax	# 17422	[c=4 l=2]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 6015	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 6016	[c=13 l=7]  *cmpsi_1/1
+	jb	.L667	# 6017	[c=13 l=2]  *jcc
+	movl	%edx, %eax	# 17424	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %eax	# 6019	[c=4 l=3]  *ashrsi3_1/0
+	cltq	# 6020	[c=4 l=2]  *extendsidi2_rex64/0
+	cmpb	$0, 1080(%r13,%rax)	# 6021	[c=14 l=9]  *cmpqi_ccno_1/1
+	jne	.L668	# 6022	[c=13 l=6]  *jcc
+.L667:
+	movq	1040(%r13), %rcx	# 6026	[c=9 l=7]  *movdi_internal/3
+	movslq	%edx, %rax	# 6025	[c=4 l=3]  *extendsidi2_rex64/1
+	movzbl	(%rcx,%rax), %r15d	# 6027	[c=13 l=5]  *zero_extendqisi2/0
+.L669:
+	cmpl	$63, %edx	# 15430	[c=4 l=3]  *cmpsi_1/0
+	leaq	.LC25(%rip), %rax	# 16945	[c=1 l=7]  *movdi_internal/4
+	movl	%r15d, %ecx	# 6043	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 6046	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC33(%rip), %rsi	# 16944	[c=1 l=7]  *movdi_internal/4
+	movl	%r8d, 8(%rsp)	# 18331	[c=4 l=5]  *movsi_internal/1
+	cmovne	%rax, %rsi	# 15431	[c=8 l=4]  *movdicc_noc/1
+	call	log_add_data_mov@PLT	# 6047	[c=0 l=5]  *call
+	movzbl	%r15b, %ecx	# 6048	[c=4 l=4]  *zero_extendqisi2/0
+	movl	%r14d, %edx	# 6050	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 6053	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC36(%rip), %rsi	# 6051	[c=1 l=7]  *movdi_internal/4
+	xorl	%eax, %eax	# 20139	[c=4 l=2]  *movdi_xor
+	call	log_append@PLT	# 6055	[c=0 l=5]  *call
+	movl	8(%rsp), %r8d	# 18332	[c=9 l=5]  *movsi_internal/0
+	movb	%r15b, 1004(%r13,%r14)	# 6057	[c=4 l=8]  *movqi_internal/8
+	testl	%r8d, %r8d	# 6058	[c=4 l=3]  *cmpsi_ccno_1/0
+	jne	.L666	# 6059	[c=13 l=2]  *jcc
+	subq	$1, 48(%r13)	# 6061	[c=13 l=5]  *adddi_1/0
+.L666:
+	movq	%r13, %rdi	# 6065	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 6064	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 6066	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 17426	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 17427	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 6068	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18828	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 6069	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 6071	[c=4 l=3]  *cmpdi_1/0
+	jb	.L344	# 6072	[c=13 l=6]  *jcc
+	movl	0(%r13), %ebx	# 6074	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 6079	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 6075	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 6077	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 6078	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 6080	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 6081	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 6082	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 6085	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 17428	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 6086	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 6089	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 6090	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 20138	[c=10 l=4]  *indirect_jump
+.L671:
+	movzwl	12(%rbx), %r8d	# 6098	[c=13 l=5]  zero_extendhidi2/0
+	cmpb	$0, 844(%r13)	# 6101	[c=13 l=8]  *cmpqi_ccno_1/1
+	movzbl	10(%rbx), %r14d	# 6100	[c=13 l=5]  zero_extendqidi2/0
+	movq	%r8, %rax	# 19169	[c=4 l=3]  *movdi_internal/3
+	jne	.L1533	# 6102	[c=13 l=6]  *jcc
+	movl	%r8d, %edx	# 17441	[c=4 l=3]  *movsi_internal/0
+	subl	5176(%r13), %edx	# 6190	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %edx	# 6191	[c=13 l=7]  *cmpsi_1/1
+	jb	.L681	# 6192	[c=13 l=2]  *jcc
+	movl	%r8d, %edx	# 17443	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %edx	# 6194	[c=4 l=3]  *ashrsi3_1/0
+	movslq	%edx, %rdx	# 6195	[c=4 l=3]  *extendsidi2_rex64/1
+	cmpb	$0, 1080(%r13,%rdx)	# 6196	[c=14 l=9]  *cmpqi_ccno_1/1
+	jne	.L682	# 6197	[c=13 l=6]  *jcc
+.L681:
+	movq	1040(%r13), %rdx	# 6201	[c=9 l=7]  *movdi_internal/3
+	movzbl	(%rdx,%rax), %r15d	# 6202	[c=13 l=5]  *zero_extendqisi2/0
+.L683:
+	cmpl	$63, %r8d	# 15454	[c=4 l=4]  *cmpsi_1/0
+	movl	%r15d, %ecx	# 6218	[c=4 l=3]  *movsi_internal/0
+	movl	%r8d, %edx	# 6219	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 6221	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC33(%rip), %rsi	# 16948	[c=1 l=7]  *movdi_internal/4
+	leaq	.LC25(%rip), %rax	# 16949	[c=1 l=7]  *movdi_internal/4
+	cmovne	%rax, %rsi	# 15455	[c=8 l=4]  *movdicc_noc/1
+	call	log_add_data_mov@PLT	# 6222	[c=0 l=5]  *call
+.L1375:
+	movl	%r14d, %edx	# 6226	[c=4 l=3]  *movsi_internal/0
+	xorl	%eax, %eax	# 20135	[c=4 l=2]  *movdi_xor
+	movzbl	%r15b, %ecx	# 6224	[c=4 l=4]  *zero_extendqisi2/0
+	movq	%r13, %rdi	# 6229	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC36(%rip), %rsi	# 6227	[c=1 l=7]  *movdi_internal/4
+	movb	%r15b, 8(%rsp)	# 18343	[c=4 l=5]  *movqi_internal/8
+	call	log_append@PLT	# 6231	[c=0 l=5]  *call
+	movzbl	8(%rsp), %r8d	# 18344	[c=9 l=6]  *movqi_internal/4
+	movq	%r13, %rdi	# 6237	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 6236	[c=4 l=3]  *movdi_internal/3
+	movb	%r8b, 1004(%r13,%r14)	# 6235	[c=4 l=8]  *movqi_internal/8
+	call	log_dump_line@PLT	# 6238	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 17445	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 17446	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 6240	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18827	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 6241	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 6243	[c=4 l=3]  *cmpdi_1/0
+	jb	.L344	# 6244	[c=13 l=6]  *jcc
+	movl	0(%r13), %ebx	# 6246	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 6251	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 6247	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 6249	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 6250	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 6252	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 6253	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 6254	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 6257	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 17447	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 6258	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 6261	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 6262	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 20134	[c=10 l=4]  *indirect_jump
+.L645:
+	movzbl	10(%rbx), %r14d	# 5645	[c=13 l=5]  zero_extendqidi2/0
+	leaq	.LC35(%rip), %rsi	# 5650	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 5652	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 20152	[c=4 l=2]  *movdi_xor
+	movzbl	1004(%r13,%r14), %ecx	# 5647	[c=14 l=9]  *zero_extendqisi2/0
+	movq	%r14, %rdx	# 19168	[c=4 l=3]  *movdi_internal/3
+	movl	%r14d, 16(%rsp)	# 18315	[c=4 l=5]  *movsi_internal/1
+	call	log_append@PLT	# 5654	[c=0 l=5]  *call
+	movl	16(%rsp), %edx	# 18316	[c=9 l=4]  *movsi_internal/0
+	xorl	%eax, %eax	# 20153	[c=4 l=2]  *movdi_xor
+	movq	%r13, %rdi	# 5664	[c=4 l=3]  *movdi_internal/3
+	movzbl	1004(%r13,%r14), %r8d	# 5656	[c=10 l=9]  *movqi_internal/4
+	leaq	.LC36(%rip), %rsi	# 5662	[c=1 l=7]  *movdi_internal/4
+	leal	1(%r8), %r15d	# 18835	[c=4 l=4]  *leasi
+	movb	%r8b, 8(%rsp)	# 18313	[c=4 l=5]  *movqi_internal/8
+	movzbl	%r15b, %r15d	# 5659	[c=4 l=4]  zero_extendqidi2/0
+	movl	%r15d, %ecx	# 5660	[c=4 l=3]  *movsi_internal/0
+	call	log_append@PLT	# 5666	[c=0 l=5]  *call
+	movzbl	8(%rsp), %r8d	# 18314	[c=9 l=6]  *movqi_internal/4
+	leal	1(%r8), %eax	# 18836	[c=4 l=4]  *leasi
+	movb	%al, 1004(%r13,%r14)	# 5669	[c=4 l=8]  *movqi_internal/8
+	movl	$63, %eax	# 5670	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 5671	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 5672	[c=13 l=7]  *cmpsi_1/1
+	jb	.L646	# 5673	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%r13)	# 5675	[c=13 l=8]  *cmpqi_ccno_1/1
+	jne	.L647	# 5676	[c=13 l=6]  *jcc
+.L646:
+	movq	1040(%r13), %rax	# 5679	[c=9 l=7]  *movdi_internal/3
+	movzbl	63(%rax), %r14d	# 5680	[c=13 l=5]  *zero_extendqisi2/0
+.L648:
+	movl	%r14d, %ecx	# 5691	[c=4 l=3]  *movsi_internal/0
+	movl	$63, %edx	# 5692	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 5695	[c=4 l=3]  *movdi_internal/3
+	andl	$-31, %r14d	# 5697	[c=4 l=4]  *andsi_1/0
+	leaq	.LC33(%rip), %rsi	# 5693	[c=1 l=7]  *movdi_internal/4
+	call	log_add_data_mov@PLT	# 5696	[c=0 l=5]  *call
+	leaq	flag_update_table_inc(%rip), %rax	# 16905	[c=1 l=7]  *movdi_internal/4
+	movl	$63, %edx	# 5704	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 5707	[c=4 l=3]  *movdi_internal/3
+	movzbl	(%rax,%r15), %eax	# 5700	[c=13 l=5]  *zero_extendqisi2/0
+	leaq	.LC29(%rip), %rsi	# 5705	[c=1 l=7]  *movdi_internal/4
+	orl	%eax, %r14d	# 5701	[c=4 l=3]  *iorsi_1/0
+	movzbl	%r14b, %ecx	# 5702	[c=4 l=4]  *zero_extendqisi2/0
+	call	log_add_data_mov@PLT	# 5708	[c=0 l=5]  *call
+	movl	$63, %eax	# 5709	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 5710	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 5711	[c=13 l=7]  *cmpsi_1/1
+	jb	.L649	# 5712	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%r13)	# 5714	[c=13 l=8]  *cmpqi_ccno_1/1
+	jne	.L650	# 5715	[c=13 l=6]  *jcc
+.L649:
+	movq	1040(%r13), %rax	# 5718	[c=9 l=7]  *movdi_internal/3
+	movb	%r14b, 63(%rax)	# 5719	[c=4 l=4]  *movqi_internal/8
+.L651:
+	movq	%r13, %rdi	# 5731	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 5730	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 5732	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 17401	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 17402	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 5734	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18834	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 5735	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 5737	[c=4 l=3]  *cmpdi_1/0
+	jb	.L344	# 5738	[c=13 l=6]  *jcc
+	movl	0(%r13), %ebx	# 5740	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 5745	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 5741	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 5743	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 5744	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 5746	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 5747	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 5748	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 5751	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 17403	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 5752	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 5755	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 5756	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 20151	[c=10 l=4]  *indirect_jump
+.L652:
+	movzbl	10(%rbx), %esi	# 5764	[c=13 l=4]  *zero_extendqisi2/0
+	movzwl	12(%rbx), %eax	# 5766	[c=13 l=4]  *zero_extendhisi2/0
+	sall	$16, %esi	# 5765	[c=4 l=3]  *ashlsi3_1/0
+	orl	%eax, %esi	# 5767	[c=4 l=2]  *iorsi_1/0
+	movl	%esi, 0(%r13)	# 5768	[c=4 l=4]  *movsi_internal/1
+	cmpl	%esi, 992(%r13)	# 5769	[c=13 l=7]  *cmpsi_1/0
+	jb	.L1380	# 5770	[c=13 l=6]  *jcc
+	movq	%r13, %rdi	# 5779	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 5778	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 5780	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 17405	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 17406	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 5782	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18833	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 5783	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 5785	[c=4 l=3]  *cmpdi_1/0
+	jb	.L344	# 5786	[c=13 l=6]  *jcc
+	movq	56(%r13), %rax	# 17407	[c=9 l=4]  *movdi_internal/3
+	cmpq	%rax, 48(%r13)	# 5789	[c=13 l=4]  *cmpdi_1/0
+	jnb	.L1534	# 5790	[c=13 l=6]  *jcc
+.L654:
+	movq	%r13, %rdi	# 5796	[c=4 l=3]  *movdi_internal/3
+	call	log_is_idle@PLT	# 5797	[c=10 l=5]  *call_value
+	testb	%al, %al	# 5799	[c=4 l=2]  *cmpqi_ccno_1/0
+	jne	.L1535	# 5800	[c=13 l=6]  *jcc
+.L655:
+	movl	0(%r13), %ebx	# 5811	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 5816	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 5812	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 5814	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 5815	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 5817	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 5818	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 5819	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 5822	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 17408	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 5823	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 5826	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 5827	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 20150	[c=10 l=4]  *indirect_jump
+.L685:
+	movzwl	12(%rbx), %edx	# 6270	[c=13 l=4]  zero_extendhidi2/0
+	movzbl	10(%rbx), %r15d	# 6272	[c=13 l=5]  zero_extendqidi2/0
+	movl	%edx, %ecx	# 17449	[c=4 l=2]  *movsi_internal/0
+	movq	%rdx, %rax	# 19170	[c=4 l=3]  *movdi_internal/3
+	subl	5176(%r13), %ecx	# 6274	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %ecx	# 6275	[c=13 l=7]  *cmpsi_1/1
+	jb	.L686	# 6276	[c=13 l=2]  *jcc
+	movl	%edx, %ecx	# 17451	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %ecx	# 6278	[c=4 l=3]  *ashrsi3_1/0
+	movslq	%ecx, %rcx	# 6279	[c=4 l=3]  *extendsidi2_rex64/1
+	cmpb	$0, 1080(%r13,%rcx)	# 6280	[c=14 l=9]  *cmpqi_ccno_1/1
+	jne	.L687	# 6281	[c=13 l=6]  *jcc
+.L686:
+	movq	1040(%r13), %rcx	# 6285	[c=9 l=7]  *movdi_internal/3
+	movzbl	(%rcx,%rax), %r14d	# 6286	[c=13 l=5]  *zero_extendqisi2/0
+.L688:
+	cmpl	$63, %edx	# 15466	[c=4 l=3]  *cmpsi_1/0
+	leaq	.LC25(%rip), %rax	# 16951	[c=1 l=7]  *movdi_internal/4
+	movl	%r14d, %ecx	# 6302	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 6305	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC33(%rip), %rsi	# 16950	[c=1 l=7]  *movdi_internal/4
+	cmovne	%rax, %rsi	# 15467	[c=8 l=4]  *movdicc_noc/1
+	call	log_add_data_mov@PLT	# 6306	[c=0 l=5]  *call
+	movl	%r15d, %edx	# 6309	[c=4 l=3]  *movsi_internal/0
+	xorl	%eax, %eax	# 20133	[c=4 l=2]  *movdi_xor
+	movzbl	%r14b, %ecx	# 6307	[c=4 l=4]  *zero_extendqisi2/0
+	leaq	.LC36(%rip), %rsi	# 6310	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 6312	[c=4 l=3]  *movdi_internal/3
+	call	log_append@PLT	# 6314	[c=0 l=5]  *call
+	movb	%r14b, 1004(%r13,%r15)	# 6316	[c=4 l=8]  *movqi_internal/8
+	movq	%r13, %rdi	# 6318	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 6317	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 6319	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 17453	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 17454	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 6321	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18826	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 6322	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 6324	[c=4 l=3]  *cmpdi_1/0
+	jb	.L344	# 6325	[c=13 l=6]  *jcc
+	movl	0(%r13), %ebx	# 6327	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 6332	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 6328	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 6330	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 6331	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 6333	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 6334	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 6335	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 6338	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 17455	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 6339	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 6342	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 6343	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 20132	[c=10 l=4]  *indirect_jump
+.L690:
+	cmpb	$0, 844(%r13)	# 6352	[c=13 l=8]  *cmpqi_ccno_1/1
+	movzbl	10(%rbx), %r14d	# 6351	[c=13 l=5]  zero_extendqidi2/0
+	jne	.L1536	# 6353	[c=13 l=6]  *jcc
+	movzwl	1030(%r13), %r8d	# 6366	[c=13 l=8]  *zero_extendhisi2/0
+	xorl	%eax, %eax	# 20128	[c=4 l=2]  *movdi_xor
+	movl	$26, %edx	# 6369	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 6372	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC34(%rip), %rsi	# 6370	[c=1 l=7]  *movdi_internal/4
+	movl	%r8d, %ecx	# 6368	[c=4 l=3]  *movsi_internal/0
+	movl	%r8d, 8(%rsp)	# 18347	[c=4 l=5]  *movsi_internal/1
+	movl	%r8d, %r15d	# 19171	[c=4 l=3]  *movsi_internal/0
+	call	log_append@PLT	# 6374	[c=0 l=5]  *call
+	movl	8(%rsp), %r8d	# 18348	[c=9 l=5]  *movsi_internal/0
+	movl	%r8d, %eax	# 17457	[c=4 l=3]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 6376	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 6377	[c=13 l=7]  *cmpsi_1/1
+	jb	.L693	# 6378	[c=13 l=2]  *jcc
+	movl	%r8d, %eax	# 17459	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %eax	# 6380	[c=4 l=3]  *ashrsi3_1/0
+	cltq	# 6381	[c=4 l=2]  *extendsidi2_rex64/0
+	cmpb	$0, 1080(%r13,%rax)	# 6382	[c=14 l=9]  *cmpqi_ccno_1/1
+	jne	.L694	# 6383	[c=13 l=6]  *jcc
+.L693:
+	movq	1040(%r13), %rdx	# 6387	[c=9 l=7]  *movdi_internal/3
+	movzwl	%r15w, %eax	# 6386	[c=4 l=4]  zero_extendhidi2/0
+	movzbl	(%rdx,%rax), %r15d	# 6388	[c=13 l=5]  *zero_extendqisi2/0
+.L695:
+	cmpl	$63, %r8d	# 15478	[c=4 l=4]  *cmpsi_1/0
+	movl	%r8d, %edx	# 6405	[c=4 l=3]  *movsi_internal/0
+	movl	%r15d, %ecx	# 6404	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 6407	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC25(%rip), %rax	# 16953	[c=1 l=7]  *movdi_internal/4
+	leaq	.LC33(%rip), %rsi	# 16952	[c=1 l=7]  *movdi_internal/4
+	cmovne	%rax, %rsi	# 15479	[c=8 l=4]  *movdicc_noc/1
+	call	log_add_data_mov@PLT	# 6408	[c=0 l=5]  *call
+	movzbl	%r15b, %ecx	# 6409	[c=4 l=4]  *zero_extendqisi2/0
+	movl	%r14d, %edx	# 6411	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 6414	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC36(%rip), %rsi	# 6412	[c=1 l=7]  *movdi_internal/4
+	xorl	%eax, %eax	# 20127	[c=4 l=2]  *movdi_xor
+	call	log_append@PLT	# 6416	[c=0 l=5]  *call
+	movb	%r15b, 1004(%r13,%r14)	# 6418	[c=4 l=8]  *movqi_internal/8
+	subq	$1, 48(%r13)	# 6419	[c=13 l=5]  *adddi_1/0
+.L692:
+	movq	%r13, %rdi	# 6423	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 6422	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 6424	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 17461	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 17462	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 6426	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18825	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 6427	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 6429	[c=4 l=3]  *cmpdi_1/0
+	jb	.L344	# 6430	[c=13 l=6]  *jcc
+	movl	0(%r13), %ebx	# 6432	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 6437	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 6433	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 6435	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 6436	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 6438	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 6439	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 6440	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 6443	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 17463	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 6444	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 6447	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 6448	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 20126	[c=10 l=4]  *indirect_jump
+.L944:
+	movzbl	10(%rbx), %edx	# 10405	[c=13 l=4]  zero_extendqidi2/0
+	movzwl	12(%rbx), %r14d	# 10404	[c=13 l=5]  *zero_extendhisi2/0
+	movl	%edx, %ecx	# 17759	[c=4 l=2]  *movsi_internal/0
+	movq	%rdx, %rax	# 19205	[c=4 l=3]  *movdi_internal/3
+	subl	5176(%r13), %ecx	# 10408	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %ecx	# 10409	[c=13 l=7]  *cmpsi_1/1
+	jb	.L945	# 10410	[c=13 l=2]  *jcc
+	movl	%edx, %ecx	# 17761	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %ecx	# 10412	[c=4 l=3]  *ashrsi3_1/0
+	movslq	%ecx, %rcx	# 10413	[c=4 l=3]  *extendsidi2_rex64/1
+	cmpb	$0, 1080(%r13,%rcx)	# 10414	[c=14 l=9]  *cmpqi_ccno_1/1
+	jne	.L946	# 10415	[c=13 l=6]  *jcc
+.L945:
+	movq	1040(%r13), %rcx	# 10419	[c=9 l=7]  *movdi_internal/3
+	movzbl	(%rcx,%rax), %r15d	# 10420	[c=13 l=5]  *zero_extendqisi2/0
+.L947:
+	cmpl	$63, %edx	# 15730	[c=4 l=3]  *cmpsi_1/0
+	leaq	.LC33(%rip), %rsi	# 16994	[c=1 l=7]  *movdi_internal/4
+	movl	%r15d, %ecx	# 10436	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 10439	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC25(%rip), %rax	# 16995	[c=1 l=7]  *movdi_internal/4
+	cmovne	%rax, %rsi	# 15731	[c=8 l=4]  *movdicc_noc/1
+	call	log_add_data_mov@PLT	# 10440	[c=0 l=5]  *call
+	testl	%r15d, %r14d	# 10442	[c=4 l=3]  *testsi_1/0
+	jne	.L949	# 10443	[c=13 l=2]  *jcc
+	movl	0(%r13), %eax	# 17763	[c=5 l=4]  *movsi_internal/0
+	addq	$1, 48(%r13)	# 10451	[c=13 l=5]  *adddi_1/0
+	addl	$1, %eax	# 10446	[c=4 l=3]  *addsi_1/0
+	andl	992(%r13), %eax	# 10449	[c=13 l=7]  *andsi_1/1
+	movl	%eax, 0(%r13)	# 10450	[c=4 l=4]  *movsi_internal/1
+.L949:
+	movq	%r13, %rdi	# 10455	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 10454	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 10456	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 17764	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 17765	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 10458	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18772	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 10459	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 10461	[c=4 l=3]  *cmpdi_1/0
+	jb	.L344	# 10462	[c=13 l=6]  *jcc
+	movq	56(%r13), %rax	# 17766	[c=9 l=4]  *movdi_internal/3
+	cmpq	%rax, 48(%r13)	# 10465	[c=13 l=4]  *cmpdi_1/0
+	jnb	.L1537	# 10466	[c=13 l=6]  *jcc
+.L950:
+	movq	%r13, %rdi	# 10472	[c=4 l=3]  *movdi_internal/3
+	call	log_is_idle@PLT	# 10473	[c=10 l=5]  *call_value
+	testb	%al, %al	# 10475	[c=4 l=2]  *cmpqi_ccno_1/0
+	jne	.L1538	# 10476	[c=13 l=6]  *jcc
+.L951:
+	movl	0(%r13), %ebx	# 10487	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 10492	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 10488	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 10490	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 10491	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 10493	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 10494	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 10495	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 10498	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 17767	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 10499	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 10502	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 10503	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 20005	[c=10 l=4]  *indirect_jump
+.L952:
+	movzbl	10(%rbx), %edx	# 10512	[c=13 l=4]  zero_extendqidi2/0
+	movzwl	12(%rbx), %r14d	# 10511	[c=13 l=5]  *zero_extendhisi2/0
+	movl	%edx, %ecx	# 17769	[c=4 l=2]  *movsi_internal/0
+	movq	%rdx, %rax	# 19206	[c=4 l=3]  *movdi_internal/3
+	subl	5176(%r13), %ecx	# 10515	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %ecx	# 10516	[c=13 l=7]  *cmpsi_1/1
+	jb	.L953	# 10517	[c=13 l=2]  *jcc
+	movl	%edx, %ecx	# 17771	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %ecx	# 10519	[c=4 l=3]  *ashrsi3_1/0
+	movslq	%ecx, %rcx	# 10520	[c=4 l=3]  *extendsidi2_rex64/1
+	cmpb	$0, 1080(%r13,%rcx)	# 10521	[c=14 l=9]  *cmpqi_ccno_1/1
+	jne	.L954	# 10522	[c=13 l=6]  *jcc
+.L953:
+	movq	1040(%r13), %rcx	# 10526	[c=9 l=7]  *movdi_internal/3
+	movzbl	(%rcx,%rax), %r15d	# 10527	[c=13 l=5]  *zero_extendqisi2/0
+.L955:
+	cmpl	$63, %edx	# 15742	[c=4 l=3]  *cmpsi_1/0
+	leaq	.LC33(%rip), %rsi	# 16996	[c=1 l=7]  *movdi_internal/4
+	movl	%r15d, %ecx	# 10543	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 10546	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC25(%rip), %rax	# 16997	[c=1 l=7]  *movdi_internal/4
+	cmovne	%rax, %rsi	# 15743	[c=8 l=4]  *movdicc_noc/1
+	call	log_add_data_mov@PLT	# 10547	[c=0 l=5]  *call
+	testl	%r15d, %r14d	# 10549	[c=4 l=3]  *testsi_1/0
+	jne	.L957	# 10550	[c=13 l=2]  *jcc
+	movl	0(%r13), %eax	# 17773	[c=5 l=4]  *movsi_internal/0
+	addq	$2, 48(%r13)	# 10558	[c=13 l=5]  *adddi_1/0
+	addl	$2, %eax	# 10553	[c=4 l=3]  *addsi_1/0
+	andl	992(%r13), %eax	# 10556	[c=13 l=7]  *andsi_1/1
+	movl	%eax, 0(%r13)	# 10557	[c=4 l=4]  *movsi_internal/1
+.L957:
+	movq	%r13, %rdi	# 10562	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 10561	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 10563	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 17774	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 17775	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 10565	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18771	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 10566	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 10568	[c=4 l=3]  *cmpdi_1/0
+	jb	.L344	# 10569	[c=13 l=6]  *jcc
+	movq	56(%r13), %rax	# 17776	[c=9 l=4]  *movdi_internal/3
+	cmpq	%rax, 48(%r13)	# 10572	[c=13 l=4]  *cmpdi_1/0
+	jnb	.L1539	# 10573	[c=13 l=6]  *jcc
+.L958:
+	movq	%r13, %rdi	# 10579	[c=4 l=3]  *movdi_internal/3
+	call	log_is_idle@PLT	# 10580	[c=10 l=5]  *call_value
+	testb	%al, %al	# 10582	[c=4 l=2]  *cmpqi_ccno_1/0
+	jne	.L1540	# 10583	[c=13 l=6]  *jcc
+.L959:
+	movl	0(%r13), %ebx	# 10594	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 10599	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 10595	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 10597	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 10598	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 10600	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 10601	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 10602	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 10605	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 17777	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 10606	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 10609	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 10610	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 20004	[c=10 l=4]  *indirect_jump
+.L960:
+	movzbl	10(%rbx), %edx	# 10619	[c=13 l=4]  zero_extendqidi2/0
+	movzwl	12(%rbx), %r14d	# 10618	[c=13 l=5]  *zero_extendhisi2/0
+	movl	%edx, %ecx	# 17779	[c=4 l=2]  *movsi_internal/0
+	movq	%rdx, %rax	# 19207	[c=4 l=3]  *movdi_internal/3
+	subl	5176(%r13), %ecx	# 10622	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %ecx	# 10623	[c=13 l=7]  *cmpsi_1/1
+	jb	.L961	# 10624	[c=13 l=2]  *jcc
+	movl	%edx, %ecx	# 17781	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %ecx	# 10626	[c=4 l=3]  *ashrsi3_1/0
+	movslq	%ecx, %rcx	# 10627	[c=4 l=3]  *extendsidi2_rex64/1
+	cmpb	$0, 1080(%r13,%rcx)	# 10628	[c=14 l=9]  *cmpqi_ccno_1/1
+	jne	.L962	# 10629	[c=13 l=6]  *jcc
+.L961:
+	movq	1040(%r13), %rcx	# 10633	[c=9 l=7]  *movdi_internal/3
+	movzbl	(%rcx,%rax), %r15d	# 10634	[c=13 l=5]  *zero_extendqisi2/0
+.L963:
+	cmpl	$63, %edx	# 15754	[c=4 l=3]  *cmpsi_1/0
+	leaq	.LC33(%rip), %rsi	# 16998	[c=1 l=7]  *movdi_internal/4
+	movl	%r15d, %ecx	# 10650	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 10653	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC25(%rip), %rax	# 16999	[c=1 l=7]  *movdi_internal/4
+	cmovne	%rax, %rsi	# 15755	[c=8 l=4]  *movdicc_noc/1
+	call	log_add_data_mov@PLT	# 10654	[c=0 l=5]  *call
+	testl	%r15d, %r14d	# 10656	[c=4 l=3]  *testsi_1/0
+	je	.L965	# 10657	[c=13 l=2]  *jcc
+	movl	0(%r13), %eax	# 17783	[c=5 l=4]  *movsi_internal/0
+	addq	$1, 48(%r13)	# 10665	[c=13 l=5]  *adddi_1/0
+	addl	$1, %eax	# 10660	[c=4 l=3]  *addsi_1/0
+	andl	992(%r13), %eax	# 10663	[c=13 l=7]  *andsi_1/1
+	movl	%eax, 0(%r13)	# 10664	[c=4 l=4]  *movsi_internal/1
+.L965:
+	movq	%r13, %rdi	# 10669	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 10668	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 10670	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 17784	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 17785	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 10672	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18770	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 10673	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 10675	[c=4 l=3]  *cmpdi_1/0
+	jb	.L344	# 10676	[c=13 l=6]  *jcc
+	movq	56(%r13), %rax	# 17786	[c=9 l=4]  *movdi_internal/3
+	cmpq	%rax, 48(%r13)	# 10679	[c=13 l=4]  *cmpdi_1/0
+	jnb	.L1541	# 10680	[c=13 l=6]  *jcc
+.L966:
+	movq	%r13, %rdi	# 10686	[c=4 l=3]  *movdi_internal/3
+	call	log_is_idle@PLT	# 10687	[c=10 l=5]  *call_value
+	testb	%al, %al	# 10689	[c=4 l=2]  *cmpqi_ccno_1/0
+	jne	.L1542	# 10690	[c=13 l=6]  *jcc
+.L967:
+	movl	0(%r13), %ebx	# 10701	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 10706	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 10702	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 10704	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 10705	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 10707	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 10708	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 10709	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 10712	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 17787	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 10713	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 10716	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 10717	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 20003	[c=10 l=4]  *indirect_jump
+.L968:
+	movzbl	10(%rbx), %edx	# 10726	[c=13 l=4]  zero_extendqidi2/0
+	movzwl	12(%rbx), %r14d	# 10725	[c=13 l=5]  *zero_extendhisi2/0
+	movl	%edx, %ecx	# 17789	[c=4 l=2]  *movsi_internal/0
+	movq	%rdx, %rax	# 19208	[c=4 l=3]  *movdi_internal/3
+	subl	5176(%r13), %ecx	# 10729	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %ecx	# 10730	[c=13 l=7]  *cmpsi_1/1
+	jb	.L969	# 10731	[c=13 l=2]  *jcc
+	movl	%edx, %ecx	# 17791	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %ecx	# 10733	[c=4 l=3]  *ashrsi3_1/0
+	movslq	%ecx, %rcx	# 10734	[c=4 l=3]  *extendsidi2_rex64/1
+	cmpb	$0, 1080(%r13,%rcx)	# 10735	[c=14 l=9]  *cmpqi_ccno_1/1
+	jne	.L970	# 10736	[c=13 l=6]  *jcc
+.L969:
+	movq	1040(%r13), %rcx	# 10740	[c=9 l=7]  *movdi_internal/3
+	movzbl	(%rcx,%rax), %r15d	# 10741	[c=13 l=5]  *zero_extendqisi2/0
+.L971:
+	cmpl	$63, %edx	# 15766	[c=4 l=3]  *cmpsi_1/0
+	leaq	.LC33(%rip), %rsi	# 17000	[c=1 l=7]  *movdi_internal/4
+	movl	%r15d, %ecx	# 10757	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 10760	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC25(%rip), %rax	# 17001	[c=1 l=7]  *movdi_internal/4
+	cmovne	%rax, %rsi	# 15767	[c=8 l=4]  *movdicc_noc/1
+	call	log_add_data_mov@PLT	# 10761	[c=0 l=5]  *call
+	testl	%r15d, %r14d	# 10763	[c=4 l=3]  *testsi_1/0
+	je	.L973	# 10764	[c=13 l=2]  *jcc
+	movl	0(%r13), %eax	# 17793	[c=5 l=4]  *movsi_internal/0
+	addq	$2, 48(%r13)	# 10772	[c=13 l=5]  *adddi_1/0
+	addl	$2, %eax	# 10767	[c=4 l=3]  *addsi_1/0
+	andl	992(%r13), %eax	# 10770	[c=13 l=7]  *andsi_1/1
+	movl	%eax, 0(%r13)	# 10771	[c=4 l=4]  *movsi_internal/1
+.L973:
+	movq	%r13, %rdi	# 10776	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 10775	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 10777	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 17794	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 17795	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 10779	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18769	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 10780	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 10782	[c=4 l=3]  *cmpdi_1/0
+	jb	.L344	# 10783	[c=13 l=6]  *jcc
+	movq	56(%r13), %rax	# 17796	[c=9 l=4]  *movdi_internal/3
+	cmpq	%rax, 48(%r13)	# 10786	[c=13 l=4]  *cmpdi_1/0
+	jnb	.L1543	# 10787	[c=13 l=6]  *jcc
+.L974:
+	movq	%r13, %rdi	# 10793	[c=4 l=3]  *movdi_internal/3
+	call	log_is_idle@PLT	# 10794	[c=10 l=5]  *call_value
+	testb	%al, %al	# 10796	[c=4 l=2]  *cmpqi_ccno_1/0
+	jne	.L1544	# 10797	[c=13 l=6]  *jcc
+.L975:
+	movl	0(%r13), %ebx	# 10808	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 10813	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 10809	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 10811	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 10812	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 10814	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 10815	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 10816	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 10819	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 17797	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 10820	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 10823	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 10824	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 20002	[c=10 l=4]  *indirect_jump
+.L765:
+	movzbl	10(%rbx), %r14d	# 7828	[c=13 l=5]  zero_extendqidi2/0
+	movzwl	12(%rbx), %r8d	# 7827	[c=13 l=5]  *zero_extendhisi2/0
+	xorl	%eax, %eax	# 20049	[c=4 l=2]  *movdi_xor
+	movq	%r13, %rdi	# 7835	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC35(%rip), %r15	# 7833	[c=1 l=7]  *movdi_internal/4
+	movzbl	1004(%r13,%r14), %ecx	# 7830	[c=14 l=9]  *zero_extendqisi2/0
+	movq	%r14, %rdx	# 19185	[c=4 l=3]  *movdi_internal/3
+	movq	%r15, %rsi	# 7834	[c=4 l=3]  *movdi_internal/3
+	movl	%r8d, 16(%rsp)	# 18396	[c=4 l=5]  *movsi_internal/1
+	call	log_append@PLT	# 7837	[c=0 l=5]  *call
+	xorl	%eax, %eax	# 20050	[c=4 l=2]  *movdi_xor
+	movq	%r15, %rsi	# 7845	[c=4 l=3]  *movdi_internal/3
+	movq	%r13, %rdi	# 7846	[c=4 l=3]  *movdi_internal/3
+	movsbl	1004(%r13,%r14), %r9d	# 7839	[c=14 l=9]  extendqisi2
+	movslq	16(%rsp), %r14	# 18397	[c=13 l=5]  *extendsidi2_rex64/1
+	movzbl	1004(%r13,%r14), %ecx	# 7841	[c=14 l=9]  *zero_extendqisi2/0
+	movl	%r14d, %edx	# 7843	[c=4 l=3]  *movsi_internal/0
+	movl	%r9d, 8(%rsp)	# 18394	[c=4 l=5]  *movsi_internal/1
+	call	log_append@PLT	# 7848	[c=0 l=5]  *call
+	movl	8(%rsp), %r9d	# 18395	[c=9 l=5]  *movsi_internal/0
+	xorl	%eax, %eax	# 20051	[c=4 l=2]  *movsi_xor
+	movzbl	1004(%r13,%r14), %r14d	# 7850	[c=14 l=9]  *zero_extendqisi2/0
+	imull	%r9d, %r14d	# 7851	[c=12 l=4]  *mulsi3_1/2
+	movl	%r14d, %r15d	# 17568	[c=4 l=3]  *movsi_internal/0
+	andl	$65535, %r15d	# 20052	[c=4 l=7]  *andsi_2/0
+	sete	%al	# 20053	[c=4 l=3]  *setcc_qi_slp
+	movl	%r15d, %edx	# 17570	[c=4 l=3]  *movsi_internal/0
+	addl	%eax, %eax	# 7857	[c=4 l=2]  *ashlsi3_1/0
+	sarl	$15, %edx	# 7858	[c=4 l=3]  *ashrsi3_1/0
+	orl	%edx, %eax	# 7859	[c=4 l=2]  *iorsi_1/0
+	movl	%eax, 8(%rsp)	# 17573	[c=4 l=4]  *movsi_internal/1
+	movl	$63, %eax	# 7860	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 7861	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 7862	[c=13 l=7]  *cmpsi_1/1
+	jb	.L766	# 7863	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%r13)	# 7865	[c=13 l=8]  *cmpqi_ccno_1/1
+	jne	.L767	# 7866	[c=13 l=6]  *jcc
+.L766:
+	movq	1040(%r13), %rax	# 7869	[c=9 l=7]  *movdi_internal/3
+	movzbl	63(%rax), %eax	# 7870	[c=13 l=4]  *zero_extendqisi2/0
+.L768:
+	movl	%eax, %ecx	# 7881	[c=4 l=2]  *movsi_internal/0
+	movl	$63, %edx	# 7882	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 7885	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, 16(%rsp)	# 18400	[c=4 l=4]  *movsi_internal/1
+	leaq	.LC33(%rip), %rsi	# 7883	[c=1 l=7]  *movdi_internal/4
+	call	log_add_data_mov@PLT	# 7886	[c=0 l=5]  *call
+	movl	16(%rsp), %eax	# 18401	[c=9 l=4]  *movsi_internal/0
+	movl	8(%rsp), %edi	# 17574	[c=9 l=4]  *movsi_internal/0
+	movl	$63, %edx	# 7891	[c=4 l=5]  *movsi_internal/0
+	leaq	.LC29(%rip), %rsi	# 7892	[c=1 l=7]  *movdi_internal/4
+	andl	$-4, %eax	# 7887	[c=4 l=3]  *andsi_1/0
+	orl	%edi, %eax	# 7888	[c=4 l=2]  *iorsi_1/0
+	movq	%r13, %rdi	# 7894	[c=4 l=3]  *movdi_internal/3
+	movzbl	%al, %ecx	# 7889	[c=4 l=3]  *zero_extendqisi2/0
+	movl	%eax, 8(%rsp)	# 18398	[c=4 l=4]  *movsi_internal/1
+	call	log_add_data_mov@PLT	# 7895	[c=0 l=5]  *call
+	movl	$63, %edx	# 7896	[c=4 l=5]  *movsi_internal/0
+	movl	8(%rsp), %eax	# 18399	[c=9 l=4]  *movsi_internal/0
+	subl	5176(%r13), %edx	# 7897	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %edx	# 7898	[c=13 l=7]  *cmpsi_1/1
+	jb	.L769	# 7899	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%r13)	# 7901	[c=13 l=8]  *cmpqi_ccno_1/1
+	jne	.L770	# 7902	[c=13 l=6]  *jcc
+.L769:
+	movq	1040(%r13), %rdx	# 7905	[c=9 l=7]  *movdi_internal/3
+	movb	%al, 63(%rdx)	# 7906	[c=4 l=3]  *movqi_internal/8
+.L771:
+	xorl	%edx, %edx	# 20047	[c=4 l=2]  *movdi_xor
+	xorl	%eax, %eax	# 20048	[c=4 l=2]  *movdi_xor
+	movl	%r15d, %ecx	# 7917	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 7921	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC37(%rip), %rsi	# 7919	[c=1 l=7]  *movdi_internal/4
+	call	log_append@PLT	# 7923	[c=0 l=5]  *call
+	movw	%r14w, 1004(%r13)	# 7924	[c=4 l=8]  *movhi_internal/3
+	movq	%r13, %rdi	# 7926	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 7925	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 7927	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 17575	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 17576	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 7929	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18801	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 7930	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 7932	[c=4 l=3]  *cmpdi_1/0
+	jb	.L344	# 7933	[c=13 l=6]  *jcc
+	movl	0(%r13), %ebx	# 7935	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 7940	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 7936	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 7938	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 7939	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 7941	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 7942	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 7943	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 7946	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 17577	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 7947	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 7950	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 7951	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 20046	[c=10 l=4]  *indirect_jump
+.L772:
+	movzbl	10(%rbx), %r14d	# 7959	[c=13 l=5]  zero_extendqidi2/0
+	leaq	.LC35(%rip), %rsi	# 7964	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 7966	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 20044	[c=4 l=2]  *movdi_xor
+	movzbl	1004(%r13,%r14), %ecx	# 7961	[c=14 l=9]  *zero_extendqisi2/0
+	movq	%r14, %rdx	# 19187	[c=4 l=3]  *movdi_internal/3
+	movl	%r14d, 16(%rsp)	# 18404	[c=4 l=5]  *movsi_internal/1
+	call	log_append@PLT	# 7968	[c=0 l=5]  *call
+	movl	16(%rsp), %edx	# 18405	[c=9 l=4]  *movsi_internal/0
+	leaq	.LC36(%rip), %rsi	# 7976	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 7978	[c=4 l=3]  *movdi_internal/3
+	movzbl	1004(%r13,%r14), %eax	# 7970	[c=14 l=9]  *zero_extendqisi2/0
+	movb	%al, 8(%rsp)	# 18402	[c=4 l=4]  *movqi_internal/8
+	negl	%eax	# 7972	[c=4 l=2]  *negsi_1
+	movl	%eax, %r15d	# 17580	[c=4 l=3]  *movsi_internal/0
+	movzbl	%al, %ecx	# 7973	[c=4 l=3]  *zero_extendqisi2/0
+	xorl	%eax, %eax	# 20045	[c=4 l=2]  *movdi_xor
+	call	log_append@PLT	# 7980	[c=0 l=5]  *call
+	movzbl	8(%rsp), %r8d	# 18403	[c=9 l=6]  *movqi_internal/4
+	movb	%r15b, 1004(%r13,%r14)	# 7982	[c=4 l=8]  *movqi_internal/8
+	movl	%r15d, %eax	# 17583	[c=4 l=3]  *movsi_internal/0
+	andl	$511, %eax	# 7987	[c=4 l=5]  *andsi_1/0
+	movl	%r8d, %r14d	# 17581	[c=4 l=3]  *movsi_internal/0
+	andl	$136, %r14d	# 7984	[c=4 l=7]  *andsi_1/0
+	imull	$260, %r14d, %r14d	# 7985	[c=12 l=7]  *mulsi3_1/1
+	andl	$7680, %r14d	# 7986	[c=4 l=7]  *andsi_1/0
+	orl	%eax, %r14d	# 7988	[c=5 l=3]  *iorsi_1_zext
+	movl	$63, %eax	# 7989	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 7990	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 7991	[c=13 l=7]  *cmpsi_1/1
+	jb	.L773	# 7992	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%r13)	# 7994	[c=13 l=8]  *cmpqi_ccno_1/1
+	jne	.L774	# 7995	[c=13 l=6]  *jcc
+.L773:
+	movq	1040(%r13), %rax	# 7998	[c=9 l=7]  *movdi_internal/3
+	movzbl	63(%rax), %r15d	# 7999	[c=13 l=5]  *zero_extendqisi2/0
+.L775:
+	movl	%r15d, %ecx	# 8010	[c=4 l=3]  *movsi_internal/0
+	movl	$63, %edx	# 8011	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 8014	[c=4 l=3]  *movdi_internal/3
+	andl	$-64, %r15d	# 8016	[c=4 l=4]  *andsi_1/0
+	leaq	.LC33(%rip), %rsi	# 8012	[c=1 l=7]  *movdi_internal/4
+	call	log_add_data_mov@PLT	# 8015	[c=0 l=5]  *call
+	leaq	flag_update_table_sub8(%rip), %rax	# 16907	[c=1 l=7]  *movdi_internal/4
+	movl	$63, %edx	# 8023	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 8026	[c=4 l=3]  *movdi_internal/3
+	movzbl	(%rax,%r14), %eax	# 8019	[c=13 l=5]  *zero_extendqisi2/0
+	leaq	.LC29(%rip), %rsi	# 8024	[c=1 l=7]  *movdi_internal/4
+	orl	%eax, %r15d	# 8020	[c=4 l=3]  *iorsi_1/0
+	movzbl	%r15b, %ecx	# 8021	[c=4 l=4]  *zero_extendqisi2/0
+	call	log_add_data_mov@PLT	# 8027	[c=0 l=5]  *call
+	movl	$63, %eax	# 8028	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 8029	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 8030	[c=13 l=7]  *cmpsi_1/1
+	jb	.L776	# 8031	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%r13)	# 8033	[c=13 l=8]  *cmpqi_ccno_1/1
+	jne	.L777	# 8034	[c=13 l=6]  *jcc
+.L776:
+	movq	1040(%r13), %rax	# 8037	[c=9 l=7]  *movdi_internal/3
+	movb	%r15b, 63(%rax)	# 8038	[c=4 l=4]  *movqi_internal/8
+.L778:
+	movq	%r13, %rdi	# 8050	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 8049	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 8051	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 17585	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 17586	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 8053	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18800	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 8054	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 8056	[c=4 l=3]  *cmpdi_1/0
+	jb	.L344	# 8057	[c=13 l=6]  *jcc
+	movl	0(%r13), %ebx	# 8059	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 8064	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 8060	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 8062	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 8063	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 8065	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 8066	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 8067	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 8070	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 17587	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 8071	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 8074	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 8075	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 20043	[c=10 l=4]  *indirect_jump
+.L1056:
+	cmpb	$0, 844(%r13)	# 12186	[c=13 l=8]  *cmpqi_ccno_1/1
+	movzbl	10(%rbx), %r15d	# 12185	[c=13 l=5]  *zero_extendqisi2/0
+	jne	.L1545	# 12187	[c=13 l=6]  *jcc
+	movzwl	1030(%r13), %r14d	# 12200	[c=13 l=8]  *zero_extendhisi2/0
+	xorl	%eax, %eax	# 19955	[c=4 l=2]  *movdi_xor
+	movl	$26, %edx	# 12203	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 12206	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC34(%rip), %rsi	# 12204	[c=1 l=7]  *movdi_internal/4
+	movl	%r14d, %ecx	# 12202	[c=4 l=3]  *movsi_internal/0
+	movl	%r14d, 16(%rsp)	# 18554	[c=4 l=5]  *movsi_internal/1
+	call	log_append@PLT	# 12208	[c=0 l=5]  *call
+	movslq	%r15d, %r9	# 12209	[c=4 l=3]  *extendsidi2_rex64/1
+	movl	%r15d, %edx	# 12212	[c=4 l=3]  *movsi_internal/0
+	xorl	%eax, %eax	# 19956	[c=4 l=2]  *movdi_xor
+	leaq	.LC35(%rip), %rsi	# 12213	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 12215	[c=4 l=3]  *movdi_internal/3
+	movq	%r9, 8(%rsp)	# 18552	[c=4 l=5]  *movdi_internal/5
+	movzbl	1004(%r13,%r9), %ecx	# 12210	[c=14 l=9]  *zero_extendqisi2/0
+	call	log_append@PLT	# 12217	[c=0 l=5]  *call
+	movq	8(%rsp), %r9	# 18553	[c=9 l=5]  *movdi_internal/3
+	cmpl	$63, %r14d	# 15862	[c=4 l=4]  *cmpsi_1/0
+	leaq	.LC30(%rip), %rdx	# 17017	[c=1 l=7]  *movdi_internal/4
+	leaq	.LC29(%rip), %rsi	# 17016	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 12229	[c=4 l=3]  *movdi_internal/3
+	movzbl	1004(%r13,%r9), %ecx	# 12219	[c=14 l=9]  *zero_extendqisi2/0
+	cmovne	%rdx, %rsi	# 15863	[c=8 l=4]  *movdicc_noc/1
+	movl	%r14d, %edx	# 12227	[c=4 l=3]  *movsi_internal/0
+	movl	%ecx, 8(%rsp)	# 18551	[c=4 l=4]  *movsi_internal/1
+	movl	%ecx, %r15d	# 19226	[c=4 l=3]  *movsi_internal/0
+	call	log_add_data_mov@PLT	# 12230	[c=0 l=5]  *call
+	movl	%r14d, %edx	# 17907	[c=4 l=3]  *movsi_internal/0
+	subl	5176(%r13), %edx	# 12232	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %edx	# 12233	[c=13 l=7]  *cmpsi_1/1
+	movl	16(%rsp), %r8d	# 18555	[c=9 l=5]  *movsi_internal/0
+	jb	.L1060	# 12234	[c=13 l=2]  *jcc
+	movl	%r14d, %edx	# 17909	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %edx	# 12236	[c=4 l=3]  *ashrsi3_1/0
+	movslq	%edx, %rdx	# 12237	[c=4 l=3]  *extendsidi2_rex64/1
+	cmpb	$0, 1080(%r13,%rdx)	# 12238	[c=14 l=9]  *cmpqi_ccno_1/1
+	jne	.L1061	# 12239	[c=13 l=6]  *jcc
+.L1060:
+	movq	1040(%r13), %rdx	# 12243	[c=9 l=7]  *movdi_internal/3
+	movzwl	%r8w, %r8d	# 12242	[c=4 l=4]  zero_extendhidi2/0
+	movb	%r15b, (%rdx,%r8)	# 12244	[c=4 l=4]  *movqi_internal/8
+.L1062:
+	subq	$1, 48(%r13)	# 12255	[c=13 l=5]  *adddi_1/0
+	addl	$1, %r14d	# 12256	[c=4 l=4]  *addsi_1/0
+	movl	$26, %edx	# 12259	[c=4 l=5]  *movsi_internal/0
+	xorl	%eax, %eax	# 19954	[c=4 l=2]  *movdi_xor
+	movzwl	%r14w, %ecx	# 12257	[c=4 l=4]  *zero_extendhisi2/0
+	leaq	.LC37(%rip), %rsi	# 12260	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 12262	[c=4 l=3]  *movdi_internal/3
+	call	log_append@PLT	# 12264	[c=0 l=5]  *call
+	movw	%r14w, 1030(%r13)	# 12265	[c=4 l=8]  *movhi_internal/3
+.L1058:
+	movq	%r13, %rdi	# 12269	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 12268	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 12270	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 17911	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 17912	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 12272	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18749	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 12273	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 12275	[c=4 l=3]  *cmpdi_1/0
+	jb	.L344	# 12276	[c=13 l=6]  *jcc
+	movl	0(%r13), %ebx	# 12278	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 12283	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 12279	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 12281	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 12282	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 12284	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 12285	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 12286	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 12289	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 17913	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 12290	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 12293	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 12294	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 19953	[c=10 l=4]  *indirect_jump
+.L1063:
+	cmpb	$0, 844(%r13)	# 12303	[c=13 l=8]  *cmpqi_ccno_1/1
+	movzbl	10(%rbx), %r14d	# 12302	[c=13 l=5]  *zero_extendqisi2/0
+	jne	.L1546	# 12304	[c=13 l=6]  *jcc
+	movzwl	1032(%r13), %r15d	# 12317	[c=13 l=8]  *zero_extendhisi2/0
+	xorl	%eax, %eax	# 19949	[c=4 l=2]  *movdi_xor
+	movl	$28, %edx	# 12319	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 12322	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC34(%rip), %rsi	# 12320	[c=1 l=7]  *movdi_internal/4
+	movl	%r15d, %ecx	# 12318	[c=4 l=3]  *movsi_internal/0
+	subl	$1, %r15d	# 12325	[c=4 l=4]  *addsi_1/0
+	call	log_append@PLT	# 12324	[c=0 l=5]  *call
+	movslq	%r14d, %r8	# 12326	[c=4 l=3]  *extendsidi2_rex64/1
+	movl	%r14d, %edx	# 12329	[c=4 l=3]  *movsi_internal/0
+	xorl	%eax, %eax	# 19950	[c=4 l=2]  *movdi_xor
+	leaq	.LC35(%rip), %rsi	# 12330	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 12332	[c=4 l=3]  *movdi_internal/3
+	movq	%r8, 8(%rsp)	# 18557	[c=4 l=5]  *movdi_internal/5
+	movzbl	1004(%r13,%r8), %ecx	# 12327	[c=14 l=9]  *zero_extendqisi2/0
+	call	log_append@PLT	# 12334	[c=0 l=5]  *call
+	movq	8(%rsp), %r8	# 18558	[c=9 l=5]  *movdi_internal/3
+	movl	%r15d, %edx	# 12344	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 12346	[c=4 l=3]  *movdi_internal/3
+	cmpl	$63, %r15d	# 15874	[c=4 l=4]  *cmpsi_1/0
+	leaq	.LC30(%rip), %rax	# 17019	[c=1 l=7]  *movdi_internal/4
+	leaq	.LC29(%rip), %rsi	# 17018	[c=1 l=7]  *movdi_internal/4
+	movzbl	1004(%r13,%r8), %ecx	# 12336	[c=14 l=9]  *zero_extendqisi2/0
+	cmovne	%rax, %rsi	# 15875	[c=8 l=4]  *movdicc_noc/1
+	movl	%ecx, 8(%rsp)	# 18556	[c=4 l=4]  *movsi_internal/1
+	movl	%ecx, %r14d	# 19227	[c=4 l=3]  *movsi_internal/0
+	call	log_add_data_mov@PLT	# 12347	[c=0 l=5]  *call
+	movl	%r15d, %eax	# 17916	[c=4 l=3]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 12348	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 12349	[c=13 l=7]  *cmpsi_1/1
+	jb	.L1067	# 12350	[c=13 l=2]  *jcc
+	movl	%r15d, %eax	# 17918	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %eax	# 12352	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 16864	[c=5 l=5]  *andsi_1_zext
+	cmpb	$0, 1080(%r13,%rax)	# 12355	[c=14 l=9]  *cmpqi_ccno_1/1
+	jne	.L1068	# 12356	[c=13 l=6]  *jcc
+.L1067:
+	movq	1040(%r13), %rdx	# 12360	[c=9 l=7]  *movdi_internal/3
+	movslq	%r15d, %rax	# 12359	[c=4 l=3]  *extendsidi2_rex64/1
+	movb	%r14b, (%rdx,%rax)	# 12361	[c=4 l=4]  *movqi_internal/8
+.L1069:
+	movzwl	%r15w, %ecx	# 12372	[c=4 l=4]  *zero_extendhisi2/0
+	movl	$28, %edx	# 12374	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 12377	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 19948	[c=4 l=2]  *movdi_xor
+	leaq	.LC37(%rip), %rsi	# 12375	[c=1 l=7]  *movdi_internal/4
+	call	log_append@PLT	# 12379	[c=0 l=5]  *call
+	movw	%r15w, 1032(%r13)	# 12380	[c=4 l=8]  *movhi_internal/3
+.L1065:
+	movq	%r13, %rdi	# 12384	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 12383	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 12385	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 17920	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 17921	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 12387	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18748	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 12388	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 12390	[c=4 l=3]  *cmpdi_1/0
+	jb	.L344	# 12391	[c=13 l=6]  *jcc
+	movl	0(%r13), %ebx	# 12393	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 12398	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 12394	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 12396	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 12397	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 12399	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 12400	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 12401	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 12404	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 17922	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 12405	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 12408	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 12409	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 19947	[c=10 l=4]  *indirect_jump
+.L1070:
+	cmpb	$0, 844(%r13)	# 12418	[c=13 l=8]  *cmpqi_ccno_1/1
+	movzbl	10(%rbx), %r15d	# 12417	[c=13 l=5]  *zero_extendqisi2/0
+	jne	.L1547	# 12419	[c=13 l=6]  *jcc
+	movzwl	1032(%r13), %r14d	# 12432	[c=13 l=8]  *zero_extendhisi2/0
+	xorl	%eax, %eax	# 19944	[c=4 l=2]  *movdi_xor
+	movl	$28, %edx	# 12435	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 12438	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC34(%rip), %rsi	# 12436	[c=1 l=7]  *movdi_internal/4
+	movl	%r14d, %ecx	# 12434	[c=4 l=3]  *movsi_internal/0
+	movl	%r14d, 16(%rsp)	# 18562	[c=4 l=5]  *movsi_internal/1
+	call	log_append@PLT	# 12440	[c=0 l=5]  *call
+	movslq	%r15d, %r9	# 12441	[c=4 l=3]  *extendsidi2_rex64/1
+	movl	%r15d, %edx	# 12444	[c=4 l=3]  *movsi_internal/0
+	xorl	%eax, %eax	# 19945	[c=4 l=2]  *movdi_xor
+	leaq	.LC35(%rip), %rsi	# 12445	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 12447	[c=4 l=3]  *movdi_internal/3
+	movq	%r9, 8(%rsp)	# 18560	[c=4 l=5]  *movdi_internal/5
+	movzbl	1004(%r13,%r9), %ecx	# 12442	[c=14 l=9]  *zero_extendqisi2/0
+	call	log_append@PLT	# 12449	[c=0 l=5]  *call
+	movq	8(%rsp), %r9	# 18561	[c=9 l=5]  *movdi_internal/3
+	cmpl	$63, %r14d	# 15886	[c=4 l=4]  *cmpsi_1/0
+	leaq	.LC30(%rip), %rdx	# 17021	[c=1 l=7]  *movdi_internal/4
+	leaq	.LC29(%rip), %rsi	# 17020	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 12461	[c=4 l=3]  *movdi_internal/3
+	movzbl	1004(%r13,%r9), %ecx	# 12451	[c=14 l=9]  *zero_extendqisi2/0
+	cmovne	%rdx, %rsi	# 15887	[c=8 l=4]  *movdicc_noc/1
+	movl	%r14d, %edx	# 12459	[c=4 l=3]  *movsi_internal/0
+	movl	%ecx, 8(%rsp)	# 18559	[c=4 l=4]  *movsi_internal/1
+	movl	%ecx, %r15d	# 19229	[c=4 l=3]  *movsi_internal/0
+	call	log_add_data_mov@PLT	# 12462	[c=0 l=5]  *call
+	movl	%r14d, %edx	# 17925	[c=4 l=3]  *movsi_internal/0
+	subl	5176(%r13), %edx	# 12464	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %edx	# 12465	[c=13 l=7]  *cmpsi_1/1
+	movl	16(%rsp), %r8d	# 18563	[c=9 l=5]  *movsi_internal/0
+	jb	.L1074	# 12466	[c=13 l=2]  *jcc
+	movl	%r14d, %edx	# 17927	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %edx	# 12468	[c=4 l=3]  *ashrsi3_1/0
+	movslq	%edx, %rdx	# 12469	[c=4 l=3]  *extendsidi2_rex64/1
+	cmpb	$0, 1080(%r13,%rdx)	# 12470	[c=14 l=9]  *cmpqi_ccno_1/1
+	jne	.L1075	# 12471	[c=13 l=6]  *jcc
+.L1074:
+	movq	1040(%r13), %rdx	# 12475	[c=9 l=7]  *movdi_internal/3
+	movzwl	%r8w, %r8d	# 12474	[c=4 l=4]  zero_extendhidi2/0
+	movb	%r15b, (%rdx,%r8)	# 12476	[c=4 l=4]  *movqi_internal/8
+.L1076:
+	subq	$1, 48(%r13)	# 12487	[c=13 l=5]  *adddi_1/0
+	addl	$1, %r14d	# 12488	[c=4 l=4]  *addsi_1/0
+	movl	$28, %edx	# 12491	[c=4 l=5]  *movsi_internal/0
+	xorl	%eax, %eax	# 19943	[c=4 l=2]  *movdi_xor
+	movzwl	%r14w, %ecx	# 12489	[c=4 l=4]  *zero_extendhisi2/0
+	leaq	.LC37(%rip), %rsi	# 12492	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 12494	[c=4 l=3]  *movdi_internal/3
+	call	log_append@PLT	# 12496	[c=0 l=5]  *call
+	movw	%r14w, 1032(%r13)	# 12497	[c=4 l=8]  *movhi_internal/3
+.L1072:
+	movq	%r13, %rdi	# 12501	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 12500	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 12502	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 17929	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 17930	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 12504	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18747	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 12505	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 12507	[c=4 l=3]  *cmpdi_1/0
+	jb	.L344	# 12508	[c=13 l=6]  *jcc
+	movl	0(%r13), %ebx	# 12510	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 12515	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 12511	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 12513	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 12514	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 12516	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 12517	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 12518	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 12521	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 17931	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 12522	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 12525	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 12526	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 19942	[c=10 l=4]  *indirect_jump
+.L1077:
+	cmpb	$0, 844(%r13)	# 12535	[c=13 l=8]  *cmpqi_ccno_1/1
+	movzbl	10(%rbx), %r14d	# 12534	[c=13 l=5]  *zero_extendqisi2/0
+	jne	.L1548	# 12536	[c=13 l=6]  *jcc
+	movzwl	1034(%r13), %r15d	# 12549	[c=13 l=8]  *zero_extendhisi2/0
+	xorl	%eax, %eax	# 19938	[c=4 l=2]  *movdi_xor
+	movl	$30, %edx	# 12551	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 12554	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC34(%rip), %rsi	# 12552	[c=1 l=7]  *movdi_internal/4
+	movl	%r15d, %ecx	# 12550	[c=4 l=3]  *movsi_internal/0
+	subl	$1, %r15d	# 12557	[c=4 l=4]  *addsi_1/0
+	call	log_append@PLT	# 12556	[c=0 l=5]  *call
+	movslq	%r14d, %r8	# 12558	[c=4 l=3]  *extendsidi2_rex64/1
+	movl	%r14d, %edx	# 12561	[c=4 l=3]  *movsi_internal/0
+	xorl	%eax, %eax	# 19939	[c=4 l=2]  *movdi_xor
+	leaq	.LC35(%rip), %rsi	# 12562	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 12564	[c=4 l=3]  *movdi_internal/3
+	movq	%r8, 8(%rsp)	# 18565	[c=4 l=5]  *movdi_internal/5
+	movzbl	1004(%r13,%r8), %ecx	# 12559	[c=14 l=9]  *zero_extendqisi2/0
+	call	log_append@PLT	# 12566	[c=0 l=5]  *call
+	movq	8(%rsp), %r8	# 18566	[c=9 l=5]  *movdi_internal/3
+	movl	%r15d, %edx	# 12576	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 12578	[c=4 l=3]  *movdi_internal/3
+	cmpl	$63, %r15d	# 15898	[c=4 l=4]  *cmpsi_1/0
+	leaq	.LC30(%rip), %rax	# 17023	[c=1 l=7]  *movdi_internal/4
+	leaq	.LC29(%rip), %rsi	# 17022	[c=1 l=7]  *movdi_internal/4
+	movzbl	1004(%r13,%r8), %ecx	# 12568	[c=14 l=9]  *zero_extendqisi2/0
+	cmovne	%rax, %rsi	# 15899	[c=8 l=4]  *movdicc_noc/1
+	movl	%ecx, 8(%rsp)	# 18564	[c=4 l=4]  *movsi_internal/1
+	movl	%ecx, %r14d	# 19230	[c=4 l=3]  *movsi_internal/0
+	call	log_add_data_mov@PLT	# 12579	[c=0 l=5]  *call
+	movl	%r15d, %eax	# 17934	[c=4 l=3]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 12580	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 12581	[c=13 l=7]  *cmpsi_1/1
+	jb	.L1081	# 12582	[c=13 l=2]  *jcc
+	movl	%r15d, %eax	# 17936	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %eax	# 12584	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 16863	[c=5 l=5]  *andsi_1_zext
+	cmpb	$0, 1080(%r13,%rax)	# 12587	[c=14 l=9]  *cmpqi_ccno_1/1
+	jne	.L1082	# 12588	[c=13 l=6]  *jcc
+.L1081:
+	movq	1040(%r13), %rdx	# 12592	[c=9 l=7]  *movdi_internal/3
+	movslq	%r15d, %rax	# 12591	[c=4 l=3]  *extendsidi2_rex64/1
+	movb	%r14b, (%rdx,%rax)	# 12593	[c=4 l=4]  *movqi_internal/8
+.L1083:
+	movzwl	%r15w, %ecx	# 12604	[c=4 l=4]  *zero_extendhisi2/0
+	movl	$30, %edx	# 12606	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 12609	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 19937	[c=4 l=2]  *movdi_xor
+	leaq	.LC37(%rip), %rsi	# 12607	[c=1 l=7]  *movdi_internal/4
+	call	log_append@PLT	# 12611	[c=0 l=5]  *call
+	movw	%r15w, 1034(%r13)	# 12612	[c=4 l=8]  *movhi_internal/3
+.L1079:
+	movq	%r13, %rdi	# 12616	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 12615	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 12617	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 17938	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 17939	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 12619	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18746	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 12620	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 12622	[c=4 l=3]  *cmpdi_1/0
+	jb	.L344	# 12623	[c=13 l=6]  *jcc
+	movl	0(%r13), %ebx	# 12625	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 12630	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 12626	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 12628	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 12629	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 12631	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 12632	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 12633	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 12636	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 17940	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 12637	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 12640	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 12641	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 19936	[c=10 l=4]  *indirect_jump
+.L1084:
+	cmpb	$0, 844(%r13)	# 12650	[c=13 l=8]  *cmpqi_ccno_1/1
+	movzbl	10(%rbx), %r15d	# 12649	[c=13 l=5]  *zero_extendqisi2/0
+	jne	.L1549	# 12651	[c=13 l=6]  *jcc
+	movzwl	1034(%r13), %r14d	# 12664	[c=13 l=8]  *zero_extendhisi2/0
+	xorl	%eax, %eax	# 19933	[c=4 l=2]  *movdi_xor
+	movl	$30, %edx	# 12667	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 12670	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC34(%rip), %rsi	# 12668	[c=1 l=7]  *movdi_internal/4
+	movl	%r14d, %ecx	# 12666	[c=4 l=3]  *movsi_internal/0
+	movl	%r14d, 16(%rsp)	# 18570	[c=4 l=5]  *movsi_internal/1
+	call	log_append@PLT	# 12672	[c=0 l=5]  *call
+	movslq	%r15d, %r9	# 12673	[c=4 l=3]  *extendsidi2_rex64/1
+	movl	%r15d, %edx	# 12676	[c=4 l=3]  *movsi_internal/0
+	xorl	%eax, %eax	# 19934	[c=4 l=2]  *movdi_xor
+	leaq	.LC35(%rip), %rsi	# 12677	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 12679	[c=4 l=3]  *movdi_internal/3
+	movq	%r9, 8(%rsp)	# 18568	[c=4 l=5]  *movdi_internal/5
+	movzbl	1004(%r13,%r9), %ecx	# 12674	[c=14 l=9]  *zero_extendqisi2/0
+	call	log_append@PLT	# 12681	[c=0 l=5]  *call
+	movq	8(%rsp), %r9	# 18569	[c=9 l=5]  *movdi_internal/3
+	cmpl	$63, %r14d	# 15910	[c=4 l=4]  *cmpsi_1/0
+	leaq	.LC30(%rip), %rdx	# 17025	[c=1 l=7]  *movdi_internal/4
+	leaq	.LC29(%rip), %rsi	# 17024	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 12693	[c=4 l=3]  *movdi_internal/3
+	movzbl	1004(%r13,%r9), %ecx	# 12683	[c=14 l=9]  *zero_extendqisi2/0
+	cmovne	%rdx, %rsi	# 15911	[c=8 l=4]  *movdicc_noc/1
+	movl	%r14d, %edx	# 12691	[c=4 l=3]  *movsi_internal/0
+	movl	%ecx, 8(%rsp)	# 18567	[c=4 l=4]  *movsi_internal/1
+	movl	%ecx, %r15d	# 19232	[c=4 l=3]  *movsi_internal/0
+	call	log_add_data_mov@PLT	# 12694	[c=0 l=5]  *call
+	movl	%r14d, %edx	# 17943	[c=4 l=3]  *movsi_internal/0
+	subl	5176(%r13), %edx	# 12696	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %edx	# 12697	[c=13 l=7]  *cmpsi_1/1
+	movl	16(%rsp), %r8d	# 18571	[c=9 l=5]  *movsi_internal/0
+	jb	.L1088	# 12698	[c=13 l=2]  *jcc
+	movl	%r14d, %edx	# 17945	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %edx	# 12700	[c=4 l=3]  *ashrsi3_1/0
+	movslq	%edx, %rdx	# 12701	[c=4 l=3]  *extendsidi2_rex64/1
+	cmpb	$0, 1080(%r13,%rdx)	# 12702	[c=14 l=9]  *cmpqi_ccno_1/1
+	jne	.L1089	# 12703	[c=13 l=6]  *jcc
+.L1088:
+	movq	1040(%r13), %rdx	# 12707	[c=9 l=7]  *movdi_internal/3
+	movzwl	%r8w, %r8d	# 12706	[c=4 l=4]  zero_extendhidi2/0
+	movb	%r15b, (%rdx,%r8)	# 12708	[c=4 l=4]  *movqi_internal/8
+.L1090:
+	subq	$1, 48(%r13)	# 12719	[c=13 l=5]  *adddi_1/0
+	addl	$1, %r14d	# 12720	[c=4 l=4]  *addsi_1/0
+	movl	$30, %edx	# 12723	[c=4 l=5]  *movsi_internal/0
+	xorl	%eax, %eax	# 19932	[c=4 l=2]  *movdi_xor
+	movzwl	%r14w, %ecx	# 12721	[c=4 l=4]  *zero_extendhisi2/0
+	leaq	.LC37(%rip), %rsi	# 12724	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 12726	[c=4 l=3]  *movdi_internal/3
+	call	log_append@PLT	# 12728	[c=0 l=5]  *call
+	movw	%r14w, 1034(%r13)	# 12729	[c=4 l=8]  *movhi_internal/3
+.L1086:
+	movq	%r13, %rdi	# 12733	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 12732	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 12734	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 17947	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 17948	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 12736	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18745	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 12737	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 12739	[c=4 l=3]  *cmpdi_1/0
+	jb	.L344	# 12740	[c=13 l=6]  *jcc
+	movl	0(%r13), %ebx	# 12742	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 12747	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 12743	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 12745	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 12746	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 12748	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 12749	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 12750	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 12753	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 17949	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 12754	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 12757	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 12758	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 19931	[c=10 l=4]  *indirect_jump
+.L1091:
+	movzbl	10(%rbx), %r14d	# 12767	[c=13 l=5]  zero_extendqidi2/0
+	movzwl	12(%rbx), %r8d	# 12766	[c=13 l=5]  *zero_extendhisi2/0
+	movq	%r13, %rdi	# 12774	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 19927	[c=4 l=2]  *movdi_xor
+	leaq	.LC35(%rip), %rsi	# 12772	[c=1 l=7]  *movdi_internal/4
+	movzbl	1004(%r13,%r14), %ecx	# 12769	[c=14 l=9]  *zero_extendqisi2/0
+	movl	%r14d, %edx	# 12771	[c=4 l=3]  *movsi_internal/0
+	movl	%r8d, 16(%rsp)	# 18582	[c=4 l=5]  *movsi_internal/1
+	movl	%r14d, 32(%rsp)	# 18580	[c=4 l=5]  *movsi_internal/1
+	call	log_append@PLT	# 12776	[c=0 l=5]  *call
+	movslq	16(%rsp), %r15	# 18583	[c=13 l=5]  *extendsidi2_rex64/1
+	leaq	.LC35(%rip), %rsi	# 18579	[c=1 l=7]  *movdi_internal/4
+	xorl	%eax, %eax	# 19928	[c=4 l=2]  *movdi_xor
+	movzbl	1004(%r13,%r14), %edi	# 12778	[c=10 l=9]  *movqi_internal/4
+	movzbl	1004(%r13,%r15), %ecx	# 12780	[c=14 l=9]  *zero_extendqisi2/0
+	movl	%r15d, %edx	# 12782	[c=4 l=3]  *movsi_internal/0
+	movb	%dil, 8(%rsp)	# 17951	[c=4 l=5]  *movqi_internal/8
+	movq	%r13, %rdi	# 12785	[c=4 l=3]  *movdi_internal/3
+	call	log_append@PLT	# 12787	[c=0 l=5]  *call
+	movl	32(%rsp), %edx	# 19929	[c=9 l=4]  *movsi_internal/0
+	leaq	.LC36(%rip), %rsi	# 12797	[c=1 l=7]  *movdi_internal/4
+	movzbl	1004(%r13,%r15), %eax	# 12789	[c=14 l=9]  *zero_extendqisi2/0
+	movzbl	8(%rsp), %r15d	# 18576	[c=13 l=6]  *zero_extendqisi2/0
+	movl	%eax, %r8d	# 19236	[c=4 l=3]  *movsi_internal/0
+	movl	%r15d, %edi	# 19235	[c=4 l=3]  *movsi_internal/0
+	subl	%eax, %r15d	# 12792	[c=4 l=3]  *subsi_1/0
+	movb	%r8b, 24(%rsp)	# 18573	[c=4 l=5]  *movqi_internal/8
+	movl	%edi, %eax	# 17953	[c=4 l=2]  *movqi_internal/1
+	movzbl	%r15b, %ecx	# 12794	[c=4 l=4]  *zero_extendqisi2/0
+	movq	%r13, %rdi	# 12799	[c=4 l=3]  *movdi_internal/3
+	andl	$511, %r15d	# 12812	[c=4 l=7]  *andsi_1/0
+	subl	%r8d, %eax	# 18744	[c=4 l=3]  *subsi_1/0
+	movb	%al, 16(%rsp)	# 17954	[c=4 l=4]  *movqi_internal/8
+	xorl	%eax, %eax	# 19930	[c=4 l=2]  *movdi_xor
+	call	log_append@PLT	# 12801	[c=0 l=5]  *call
+	movzbl	16(%rsp), %ecx	# 17955	[c=9 l=5]  *movqi_internal/4
+	movzbl	24(%rsp), %r8d	# 18574	[c=9 l=6]  *movqi_internal/4
+	movb	%cl, 1004(%r13,%r14)	# 12803	[c=4 l=8]  *movqi_internal/8
+	movl	8(%rsp), %r14d	# 17956	[c=9 l=5]  *movsi_internal/0
+	andl	$136, %r8d	# 12808	[c=4 l=7]  *andsi_1/0
+	andl	$136, %r14d	# 12805	[c=4 l=7]  *andsi_1/0
+	leal	(%r8,%r14,2), %eax	# 12809	[c=8 l=4]  *leasi
+	imull	$260, %eax, %eax	# 12810	[c=12 l=6]  *mulsi3_1/1
+	andl	$7680, %eax	# 12811	[c=4 l=5]  *andsi_1/0
+	orl	%eax, %r15d	# 12813	[c=5 l=3]  *iorsi_1_zext
+	movl	$63, %eax	# 12814	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 12815	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 12816	[c=13 l=7]  *cmpsi_1/1
+	jb	.L1092	# 12817	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%r13)	# 12819	[c=13 l=8]  *cmpqi_ccno_1/1
+	jne	.L1093	# 12820	[c=13 l=6]  *jcc
+.L1092:
+	movq	1040(%r13), %rax	# 12823	[c=9 l=7]  *movdi_internal/3
+	movzbl	63(%rax), %r14d	# 12824	[c=13 l=5]  *zero_extendqisi2/0
+.L1094:
+	movl	%r14d, %ecx	# 12835	[c=4 l=3]  *movsi_internal/0
+	movl	$63, %edx	# 12836	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 12839	[c=4 l=3]  *movdi_internal/3
+	andl	$-64, %r14d	# 12841	[c=4 l=4]  *andsi_1/0
+	leaq	.LC33(%rip), %rsi	# 12837	[c=1 l=7]  *movdi_internal/4
+	call	log_add_data_mov@PLT	# 12840	[c=0 l=5]  *call
+	leaq	flag_update_table_sub8(%rip), %rax	# 16913	[c=1 l=7]  *movdi_internal/4
+	movl	$63, %edx	# 12848	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 12851	[c=4 l=3]  *movdi_internal/3
+	movzbl	(%rax,%r15), %eax	# 12844	[c=13 l=5]  *zero_extendqisi2/0
+	leaq	.LC29(%rip), %rsi	# 12849	[c=1 l=7]  *movdi_internal/4
+	orl	%eax, %r14d	# 12845	[c=4 l=3]  *iorsi_1/0
+	movzbl	%r14b, %ecx	# 12846	[c=4 l=4]  *zero_extendqisi2/0
+	call	log_add_data_mov@PLT	# 12852	[c=0 l=5]  *call
+	movl	$63, %eax	# 12853	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 12854	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 12855	[c=13 l=7]  *cmpsi_1/1
+	jb	.L1095	# 12856	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%r13)	# 12858	[c=13 l=8]  *cmpqi_ccno_1/1
+	jne	.L1096	# 12859	[c=13 l=6]  *jcc
+.L1095:
+	movq	1040(%r13), %rax	# 12862	[c=9 l=7]  *movdi_internal/3
+	movb	%r14b, 63(%rax)	# 12863	[c=4 l=4]  *movqi_internal/8
+.L1097:
+	movq	%r13, %rdi	# 12875	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 12874	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 12876	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 17958	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 17959	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 12878	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18743	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 12879	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 12881	[c=4 l=3]  *cmpdi_1/0
+	jb	.L344	# 12882	[c=13 l=6]  *jcc
+	movl	0(%r13), %ebx	# 12884	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 12889	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 12885	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 12887	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 12888	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 12890	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 12891	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 12892	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 12895	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 17960	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 12896	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 12899	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 12900	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 19926	[c=10 l=4]  *indirect_jump
+.L1098:
+	movzwl	12(%rbx), %r11d	# 12908	[c=13 l=5]  *zero_extendhisi2/0
+	movzbl	10(%rbx), %r15d	# 12910	[c=13 l=5]  *zero_extendqisi2/0
+	movq	%r13, %rdi	# 12914	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 19922	[c=4 l=2]  *movdi_xor
+	leaq	.LC61(%rip), %rsi	# 12912	[c=1 l=7]  *movdi_internal/4
+	movl	%r11d, %edx	# 12911	[c=4 l=3]  *movsi_internal/0
+	movslq	%r15d, %r14	# 17963	[c=4 l=3]  *extendsidi2_rex64/1
+	movl	%r11d, 32(%rsp)	# 18591	[c=4 l=5]  *movsi_internal/1
+	movl	%r11d, 24(%rsp)	# 18588	[c=4 l=5]  *movsi_internal/1
+	call	log_append@PLT	# 12916	[c=0 l=5]  *call
+	movl	%r15d, %edx	# 12920	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 12923	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 19923	[c=4 l=2]  *movdi_xor
+	movzbl	1004(%r13,%r14), %ecx	# 12918	[c=14 l=9]  *zero_extendqisi2/0
+	leaq	.LC35(%rip), %rsi	# 12921	[c=1 l=7]  *movdi_internal/4
+	movl	%r15d, 8(%rsp)	# 18586	[c=4 l=5]  *movsi_internal/1
+	call	log_append@PLT	# 12925	[c=0 l=5]  *call
+	movl	24(%rsp), %r11d	# 18589	[c=9 l=5]  *movsi_internal/0
+	movl	8(%rsp), %edx	# 12932	[c=9 l=4]  *movsi_internal/0
+	xorl	%eax, %eax	# 19924	[c=4 l=2]  *movdi_xor
+	movzbl	1004(%r13,%r14), %r15d	# 12927	[c=14 l=9]  *zero_extendqisi2/0
+	leaq	.LC36(%rip), %rsi	# 12933	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 12935	[c=4 l=3]  *movdi_internal/3
+	movb	%r15b, 16(%rsp)	# 18584	[c=4 l=5]  *movqi_internal/8
+	subl	%r11d, %r15d	# 12929	[c=4 l=3]  *subsi_1/0
+	movzbl	%r15b, %ecx	# 12930	[c=4 l=4]  *zero_extendqisi2/0
+	call	log_append@PLT	# 12937	[c=0 l=5]  *call
+	movzbl	16(%rsp), %r8d	# 18585	[c=9 l=6]  *movqi_internal/4
+	movl	32(%rsp), %eax	# 19925	[c=9 l=4]  *movsi_internal/0
+	movb	%r15b, 1004(%r13,%r14)	# 12939	[c=4 l=8]  *movqi_internal/8
+	andl	$136, %eax	# 12944	[c=4 l=5]  *andsi_1/0
+	andl	$136, %r8d	# 12941	[c=4 l=7]  *andsi_1/0
+	leal	(%rax,%r8,2), %edx	# 12945	[c=8 l=4]  *leasi
+	movl	%r15d, %eax	# 17966	[c=4 l=3]  *movsi_internal/0
+	imull	$260, %edx, %edx	# 12946	[c=12 l=6]  *mulsi3_1/1
+	andl	$511, %eax	# 12948	[c=4 l=5]  *andsi_1/0
+	andl	$7680, %edx	# 12947	[c=4 l=6]  *andsi_1/0
+	orl	%eax, %edx	# 12949	[c=4 l=2]  *iorsi_1/0
+	movl	$63, %eax	# 12950	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 12951	[c=13 l=7]  *subsi_1/1
+	movl	%edx, %r15d	# 17969	[c=1 l=3]  *zero_extendsidi2/3
+	cmpl	5180(%r13), %eax	# 12952	[c=13 l=7]  *cmpsi_1/1
+	jb	.L1099	# 12953	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%r13)	# 12955	[c=13 l=8]  *cmpqi_ccno_1/1
+	jne	.L1100	# 12956	[c=13 l=6]  *jcc
+.L1099:
+	movq	1040(%r13), %rax	# 12959	[c=9 l=7]  *movdi_internal/3
+	movzbl	63(%rax), %r14d	# 12960	[c=13 l=5]  *zero_extendqisi2/0
+.L1101:
+	movl	%r14d, %ecx	# 12971	[c=4 l=3]  *movsi_internal/0
+	movl	$63, %edx	# 12972	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 12975	[c=4 l=3]  *movdi_internal/3
+	andl	$-64, %r14d	# 12977	[c=4 l=4]  *andsi_1/0
+	leaq	.LC33(%rip), %rsi	# 12973	[c=1 l=7]  *movdi_internal/4
+	call	log_add_data_mov@PLT	# 12976	[c=0 l=5]  *call
+	leaq	flag_update_table_sub8(%rip), %rax	# 16914	[c=1 l=7]  *movdi_internal/4
+	movl	$63, %edx	# 12984	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 12987	[c=4 l=3]  *movdi_internal/3
+	movzbl	(%rax,%r15), %eax	# 12980	[c=13 l=5]  *zero_extendqisi2/0
+	leaq	.LC29(%rip), %rsi	# 12985	[c=1 l=7]  *movdi_internal/4
+	orl	%eax, %r14d	# 12981	[c=4 l=3]  *iorsi_1/0
+	movzbl	%r14b, %ecx	# 12982	[c=4 l=4]  *zero_extendqisi2/0
+	call	log_add_data_mov@PLT	# 12988	[c=0 l=5]  *call
+	movl	$63, %eax	# 12989	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 12990	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 12991	[c=13 l=7]  *cmpsi_1/1
+	jb	.L1102	# 12992	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%r13)	# 12994	[c=13 l=8]  *cmpqi_ccno_1/1
+	jne	.L1103	# 12995	[c=13 l=6]  *jcc
+.L1102:
+	movq	1040(%r13), %rax	# 12998	[c=9 l=7]  *movdi_internal/3
+	movb	%r14b, 63(%rax)	# 12999	[c=4 l=4]  *movqi_internal/8
+.L1104:
+	movq	%r13, %rdi	# 13011	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 13010	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 13012	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 17970	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 17971	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 13014	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18742	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 13015	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 13017	[c=4 l=3]  *cmpdi_1/0
+	jb	.L344	# 13018	[c=13 l=6]  *jcc
+	movl	0(%r13), %ebx	# 13020	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 13025	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 13021	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 13023	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 13024	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 13026	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 13027	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 13028	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 13031	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 17972	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 13032	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 13035	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 13036	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 19921	[c=10 l=4]  *indirect_jump
+.L1105:
+	movzbl	10(%rbx), %r14d	# 13044	[c=13 l=5]  zero_extendqidi2/0
+	leaq	.LC35(%rip), %rsi	# 13049	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 13051	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 19919	[c=4 l=2]  *movdi_xor
+	movzbl	1004(%r13,%r14), %ecx	# 13046	[c=14 l=9]  *zero_extendqisi2/0
+	movl	%r14d, %edx	# 13048	[c=4 l=3]  *movsi_internal/0
+	call	log_append@PLT	# 13053	[c=0 l=5]  *call
+	movl	%r14d, %edx	# 13059	[c=4 l=3]  *movsi_internal/0
+	xorl	%eax, %eax	# 19920	[c=4 l=2]  *movdi_xor
+	movq	%r13, %rdi	# 13062	[c=4 l=3]  *movdi_internal/3
+	movzbl	1004(%r13,%r14), %r8d	# 17974	[c=10 l=9]  *movqi_internal/4
+	leaq	.LC36(%rip), %rsi	# 13060	[c=1 l=7]  *movdi_internal/4
+	rolb	$4, %r8b	# 13056	[c=4 l=4]  *rotlqi3_1
+	movzbl	%r8b, %ecx	# 13057	[c=4 l=4]  *zero_extendqisi2/0
+	movb	%r8b, 8(%rsp)	# 18593	[c=4 l=5]  *movqi_internal/8
+	call	log_append@PLT	# 13064	[c=0 l=5]  *call
+	movzbl	8(%rsp), %r8d	# 18594	[c=9 l=6]  *movqi_internal/4
+	movq	%r13, %rdi	# 13068	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 13067	[c=4 l=3]  *movdi_internal/3
+	movb	%r8b, 1004(%r13,%r14)	# 13066	[c=4 l=8]  *movqi_internal/8
+	call	log_dump_line@PLT	# 13069	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 17976	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 17977	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 13071	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18741	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 13072	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 13074	[c=4 l=3]  *cmpdi_1/0
+	jb	.L344	# 13075	[c=13 l=6]  *jcc
+	movl	0(%r13), %ebx	# 13077	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 13082	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 13078	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 13080	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 13081	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 13083	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 13084	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 13085	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 13088	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 17978	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 13089	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 13092	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 13093	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 19918	[c=10 l=4]  *indirect_jump
+.L1106:
+	movq	%r13, %rdi	# 13102	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 13101	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 13103	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 17980	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 17981	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 13105	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18740	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 13106	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 13108	[c=4 l=3]  *cmpdi_1/0
+	jb	.L344	# 13109	[c=13 l=6]  *jcc
+	movl	0(%r13), %ebx	# 13111	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 13116	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 13112	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 13114	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 13115	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 13117	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 13118	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 13119	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 13122	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 17982	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 13123	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 13126	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 13127	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 19917	[c=10 l=4]  *indirect_jump
+.L1107:
+	movzbl	10(%rbx), %r14d	# 13135	[c=13 l=5]  zero_extendqidi2/0
+	xorl	%eax, %eax	# 19916	[c=4 l=2]  *movdi_xor
+	xorl	%ecx, %ecx	# 19915	[c=4 l=2]  *movdi_xor
+	leaq	.LC36(%rip), %rsi	# 13138	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 13140	[c=4 l=3]  *movdi_internal/3
+	movl	%r14d, %edx	# 13137	[c=4 l=3]  *movsi_internal/0
+	call	log_append@PLT	# 13142	[c=0 l=5]  *call
+	movl	$63, %eax	# 13145	[c=4 l=5]  *movsi_internal/0
+	movb	$0, 1004(%r13,%r14)	# 13144	[c=4 l=9]  *movqi_internal/8
+	subl	5176(%r13), %eax	# 13146	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 13147	[c=13 l=7]  *cmpsi_1/1
+	jb	.L1108	# 13148	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%r13)	# 13150	[c=13 l=8]  *cmpqi_ccno_1/1
+	jne	.L1109	# 13151	[c=13 l=6]  *jcc
+.L1108:
+	movq	1040(%r13), %rax	# 13154	[c=9 l=7]  *movdi_internal/3
+	movzbl	63(%rax), %r15d	# 13155	[c=13 l=5]  *zero_extendqisi2/0
+.L1110:
+	movl	%r15d, %ecx	# 13166	[c=4 l=3]  *movsi_internal/0
+	movl	$63, %edx	# 13167	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 13170	[c=4 l=3]  *movdi_internal/3
+	movl	%r15d, %r14d	# 17984	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC33(%rip), %rsi	# 13168	[c=1 l=7]  *movdi_internal/4
+	andl	$-31, %r14d	# 13172	[c=4 l=4]  *andsi_1/0
+	call	log_add_data_mov@PLT	# 13171	[c=0 l=5]  *call
+	movl	%r15d, %ecx	# 17986	[c=4 l=3]  *movsi_internal/0
+	movl	$63, %edx	# 13177	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 13180	[c=4 l=3]  *movdi_internal/3
+	andl	$225, %ecx	# 13174	[c=4 l=6]  *andsi_1/0
+	leaq	.LC29(%rip), %rsi	# 13178	[c=1 l=7]  *movdi_internal/4
+	orl	$2, %r14d	# 13173	[c=4 l=4]  *iorsi_1/0
+	orl	$2, %ecx	# 13175	[c=4 l=3]  *iorsi_1/0
+	call	log_add_data_mov@PLT	# 13181	[c=0 l=5]  *call
+	movl	$63, %eax	# 13182	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 13183	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 13184	[c=13 l=7]  *cmpsi_1/1
+	jb	.L1111	# 13185	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%r13)	# 13187	[c=13 l=8]  *cmpqi_ccno_1/1
+	jne	.L1112	# 13188	[c=13 l=6]  *jcc
+.L1111:
+	movq	1040(%r13), %rax	# 13191	[c=9 l=7]  *movdi_internal/3
+	movb	%r14b, 63(%rax)	# 13192	[c=4 l=4]  *movqi_internal/8
+.L1113:
+	movq	%r13, %rdi	# 13204	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 13203	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 13205	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 17988	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 17989	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 13207	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18739	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 13208	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 13210	[c=4 l=3]  *cmpdi_1/0
+	jb	.L344	# 13211	[c=13 l=6]  *jcc
+	movl	0(%r13), %ebx	# 13213	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 13218	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 13214	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 13216	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 13217	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 13219	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 13220	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 13221	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 13224	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 17990	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 13225	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 13228	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 13229	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 19914	[c=10 l=4]  *indirect_jump
+.L1114:
+	movzbl	10(%rbx), %r14d	# 13237	[c=13 l=5]  zero_extendqidi2/0
+	leaq	.LC35(%rip), %rsi	# 13242	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 13244	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 19912	[c=4 l=2]  *movdi_xor
+	movzbl	1004(%r13,%r14), %ecx	# 13239	[c=14 l=9]  *zero_extendqisi2/0
+	movq	%r14, %rdx	# 19241	[c=4 l=3]  *movdi_internal/3
+	movl	%r14d, 16(%rsp)	# 18597	[c=4 l=5]  *movsi_internal/1
+	call	log_append@PLT	# 13246	[c=0 l=5]  *call
+	movl	16(%rsp), %edx	# 18598	[c=9 l=4]  *movsi_internal/0
+	xorl	%eax, %eax	# 19913	[c=4 l=2]  *movdi_xor
+	movq	%r13, %rdi	# 13256	[c=4 l=3]  *movdi_internal/3
+	movzbl	1004(%r13,%r14), %r15d	# 13248	[c=14 l=9]  *zero_extendqisi2/0
+	leaq	.LC36(%rip), %rsi	# 13254	[c=1 l=7]  *movdi_internal/4
+	movb	%r15b, 8(%rsp)	# 18595	[c=4 l=5]  *movqi_internal/8
+	addl	%r15d, %r15d	# 13250	[c=4 l=3]  *ashlsi3_1/0
+	movzbl	%r15b, %ecx	# 13251	[c=4 l=4]  *zero_extendqisi2/0
+	call	log_append@PLT	# 13258	[c=0 l=5]  *call
+	movzbl	8(%rsp), %r8d	# 18596	[c=9 l=6]  *movqi_internal/4
+	movl	$63, %eax	# 13266	[c=4 l=5]  *movsi_internal/0
+	movb	%r15b, 1004(%r13,%r14)	# 13260	[c=4 l=8]  *movqi_internal/8
+	subl	5176(%r13), %eax	# 13267	[c=13 l=7]  *subsi_1/1
+	movl	%r8d, %r14d	# 17992	[c=4 l=3]  *movsi_internal/0
+	andl	$136, %r14d	# 13262	[c=4 l=7]  *andsi_1/0
+	imull	$780, %r14d, %r14d	# 13263	[c=12 l=7]  *mulsi3_1/1
+	andl	$7680, %r14d	# 13264	[c=4 l=7]  *andsi_1/0
+	orl	%r15d, %r14d	# 13265	[c=5 l=3]  *iorsi_1_zext
+	cmpl	5180(%r13), %eax	# 13268	[c=13 l=7]  *cmpsi_1/1
+	jb	.L1115	# 13269	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%r13)	# 13271	[c=13 l=8]  *cmpqi_ccno_1/1
+	jne	.L1116	# 13272	[c=13 l=6]  *jcc
+.L1115:
+	movq	1040(%r13), %rax	# 13275	[c=9 l=7]  *movdi_internal/3
+	movzbl	63(%rax), %r15d	# 13276	[c=13 l=5]  *zero_extendqisi2/0
+.L1117:
+	movl	%r15d, %ecx	# 13287	[c=4 l=3]  *movsi_internal/0
+	movl	$63, %edx	# 13288	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 13291	[c=4 l=3]  *movdi_internal/3
+	andl	$-64, %r15d	# 13293	[c=4 l=4]  *andsi_1/0
+	leaq	.LC33(%rip), %rsi	# 13289	[c=1 l=7]  *movdi_internal/4
+	call	log_add_data_mov@PLT	# 13292	[c=0 l=5]  *call
+	leaq	flag_update_table_add8(%rip), %rax	# 16915	[c=1 l=7]  *movdi_internal/4
+	movl	$63, %edx	# 13300	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 13303	[c=4 l=3]  *movdi_internal/3
+	movzbl	(%rax,%r14), %eax	# 13296	[c=13 l=5]  *zero_extendqisi2/0
+	leaq	.LC29(%rip), %rsi	# 13301	[c=1 l=7]  *movdi_internal/4
+	orl	%eax, %r15d	# 13297	[c=4 l=3]  *iorsi_1/0
+	movzbl	%r15b, %ecx	# 13298	[c=4 l=4]  *zero_extendqisi2/0
+	call	log_add_data_mov@PLT	# 13304	[c=0 l=5]  *call
+	movl	$63, %eax	# 13305	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 13306	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 13307	[c=13 l=7]  *cmpsi_1/1
+	jb	.L1118	# 13308	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%r13)	# 13310	[c=13 l=8]  *cmpqi_ccno_1/1
+	jne	.L1119	# 13311	[c=13 l=6]  *jcc
+.L1118:
+	movq	1040(%r13), %rax	# 13314	[c=9 l=7]  *movdi_internal/3
+	movb	%r15b, 63(%rax)	# 13315	[c=4 l=4]  *movqi_internal/8
+.L1120:
+	movq	%r13, %rdi	# 13327	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 13326	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 13328	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 17994	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 17995	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 13330	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18738	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 13331	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 13333	[c=4 l=3]  *cmpdi_1/0
+	jb	.L344	# 13334	[c=13 l=6]  *jcc
+	movl	0(%r13), %ebx	# 13336	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 13341	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 13337	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 13339	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 13340	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 13342	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 13343	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 13344	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 13347	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 17996	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 13348	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 13351	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 13352	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 19911	[c=10 l=4]  *indirect_jump
+.L1121:
+	movq	1040(%r13), %rax	# 13361	[c=9 l=7]  *movdi_internal/3
+	movzbl	10(%rbx), %edx	# 13360	[c=13 l=4]  *zero_extendqisi2/0
+	leaq	.LC35(%rip), %rsi	# 13369	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 13371	[c=4 l=3]  *movdi_internal/3
+	movzbl	63(%rax), %r14d	# 13362	[c=9 l=5]  *movqi_internal/4
+	movl	%edx, 16(%rsp)	# 18601	[c=4 l=4]  *movsi_internal/1
+	movl	%r14d, %eax	# 17998	[c=4 l=3]  *movsi_internal/0
+	movslq	%edx, %r14	# 13365	[c=4 l=3]  *extendsidi2_rex64/1
+	movzbl	1004(%r13,%r14), %ecx	# 13366	[c=14 l=9]  *zero_extendqisi2/0
+	andl	$1, %eax	# 13364	[c=4 l=3]  *andsi_1/0
+	movl	%eax, 8(%rsp)	# 17999	[c=4 l=4]  *movsi_internal/1
+	xorl	%eax, %eax	# 19909	[c=4 l=2]  *movdi_xor
+	call	log_append@PLT	# 13373	[c=0 l=5]  *call
+	movl	8(%rsp), %edi	# 18000	[c=9 l=4]  *movsi_internal/0
+	movl	16(%rsp), %edx	# 18602	[c=9 l=4]  *movsi_internal/0
+	leaq	.LC36(%rip), %rsi	# 13382	[c=1 l=7]  *movdi_internal/4
+	movzbl	1004(%r13,%r14), %eax	# 13375	[c=14 l=9]  *zero_extendqisi2/0
+	leal	(%rdi,%rax,2), %r8d	# 13378	[c=8 l=4]  *leasi
+	movl	%eax, %r15d	# 19243	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 13384	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 19910	[c=4 l=2]  *movdi_xor
+	movzbl	%r8b, %ecx	# 13379	[c=4 l=4]  *zero_extendqisi2/0
+	movl	%r8d, 8(%rsp)	# 18599	[c=4 l=5]  *movsi_internal/1
+	andl	$136, %r15d	# 13390	[c=4 l=7]  *andsi_1/0
+	call	log_append@PLT	# 13386	[c=0 l=5]  *call
+	movl	8(%rsp), %r8d	# 18600	[c=9 l=5]  *movsi_internal/0
+	movl	$63, %eax	# 13394	[c=4 l=5]  *movsi_internal/0
+	movb	%r8b, 1004(%r13,%r14)	# 13388	[c=4 l=8]  *movqi_internal/8
+	imull	$780, %r15d, %r14d	# 13391	[c=12 l=7]  *mulsi3_1/1
+	subl	5176(%r13), %eax	# 13395	[c=13 l=7]  *subsi_1/1
+	andl	$7680, %r14d	# 13392	[c=4 l=7]  *andsi_1/0
+	orl	%r8d, %r14d	# 13393	[c=5 l=3]  *iorsi_1_zext
+	cmpl	5180(%r13), %eax	# 13396	[c=13 l=7]  *cmpsi_1/1
+	jb	.L1122	# 13397	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%r13)	# 13399	[c=13 l=8]  *cmpqi_ccno_1/1
+	jne	.L1123	# 13400	[c=13 l=6]  *jcc
+.L1122:
+	movq	1040(%r13), %rax	# 13403	[c=9 l=7]  *movdi_internal/3
+	movzbl	63(%rax), %r15d	# 13404	[c=13 l=5]  *zero_extendqisi2/0
+.L1124:
+	movl	%r15d, %ecx	# 13415	[c=4 l=3]  *movsi_internal/0
+	movl	$63, %edx	# 13416	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 13419	[c=4 l=3]  *movdi_internal/3
+	andl	$-64, %r15d	# 13421	[c=4 l=4]  *andsi_1/0
+	leaq	.LC33(%rip), %rsi	# 13417	[c=1 l=7]  *movdi_internal/4
+	call	log_add_data_mov@PLT	# 13420	[c=0 l=5]  *call
+	leaq	flag_update_table_add8(%rip), %rax	# 16916	[c=1 l=7]  *movdi_internal/4
+	movl	$63, %edx	# 13428	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 13431	[c=4 l=3]  *movdi_internal/3
+	movzbl	(%rax,%r14), %eax	# 13424	[c=13 l=5]  *zero_extendqisi2/0
+	leaq	.LC29(%rip), %rsi	# 13429	[c=1 l=7]  *movdi_internal/4
+	orl	%eax, %r15d	# 13425	[c=4 l=3]  *iorsi_1/0
+	movzbl	%r15b, %ecx	# 13426	[c=4 l=4]  *zero_extendqisi2/0
+	call	log_add_data_mov@PLT	# 13432	[c=0 l=5]  *call
+	movl	$63, %eax	# 13433	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 13434	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 13435	[c=13 l=7]  *cmpsi_1/1
+	jb	.L1125	# 13436	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%r13)	# 13438	[c=13 l=8]  *cmpqi_ccno_1/1
+	jne	.L1126	# 13439	[c=13 l=6]  *jcc
+.L1125:
+	movq	1040(%r13), %rax	# 13442	[c=9 l=7]  *movdi_internal/3
+	movb	%r15b, 63(%rax)	# 13443	[c=4 l=4]  *movqi_internal/8
+.L1127:
+	movq	%rbx, %rsi	# 13454	[c=4 l=3]  *movdi_internal/3
+	movq	%r13, %rdi	# 13455	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 13456	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 18001	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rcx	# 18002	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 13458	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rcx), %rdx	# 18737	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 13459	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 13461	[c=4 l=3]  *cmpdi_1/0
+	jb	.L344	# 13462	[c=13 l=6]  *jcc
+	movl	0(%r13), %ebx	# 13464	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 13469	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 13465	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 13467	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 13468	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 13470	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 13471	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 13472	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 13475	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 18003	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 13476	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 13479	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 13480	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 19908	[c=10 l=4]  *indirect_jump
+.L1128:
+	movzbl	10(%rbx), %r14d	# 13488	[c=13 l=5]  zero_extendqidi2/0
+	xorl	%eax, %eax	# 19907	[c=4 l=2]  *movdi_xor
+	leaq	.LC35(%rip), %rsi	# 13493	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 13495	[c=4 l=3]  *movdi_internal/3
+	movzbl	1004(%r13,%r14), %ecx	# 13490	[c=14 l=9]  *zero_extendqisi2/0
+	movq	%r14, %rdx	# 19244	[c=4 l=3]  *movdi_internal/3
+	call	log_append@PLT	# 13497	[c=0 l=5]  *call
+	movl	$63, %eax	# 13500	[c=4 l=5]  *movsi_internal/0
+	movzbl	1004(%r13,%r14), %r15d	# 13499	[c=14 l=9]  zero_extendqidi2/0
+	subl	5176(%r13), %eax	# 13501	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 13502	[c=13 l=7]  *cmpsi_1/1
+	jb	.L1129	# 13503	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%r13)	# 13505	[c=13 l=8]  *cmpqi_ccno_1/1
+	jne	.L1130	# 13506	[c=13 l=6]  *jcc
+.L1129:
+	movq	1040(%r13), %rax	# 13509	[c=9 l=7]  *movdi_internal/3
+	movzbl	63(%rax), %r14d	# 13510	[c=13 l=5]  *zero_extendqisi2/0
+.L1131:
+	movl	%r14d, %ecx	# 13521	[c=4 l=3]  *movsi_internal/0
+	movl	$63, %edx	# 13522	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 13525	[c=4 l=3]  *movdi_internal/3
+	andl	$-31, %r14d	# 13527	[c=4 l=4]  *andsi_1/0
+	leaq	.LC33(%rip), %rsi	# 13523	[c=1 l=7]  *movdi_internal/4
+	call	log_add_data_mov@PLT	# 13526	[c=0 l=5]  *call
+	leaq	flag_update_table_logical(%rip), %rax	# 16917	[c=1 l=7]  *movdi_internal/4
+	movl	$63, %edx	# 13534	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 13537	[c=4 l=3]  *movdi_internal/3
+	movzbl	(%rax,%r15), %eax	# 13530	[c=13 l=5]  *zero_extendqisi2/0
+	leaq	.LC29(%rip), %rsi	# 13535	[c=1 l=7]  *movdi_internal/4
+	orl	%eax, %r14d	# 13531	[c=4 l=3]  *iorsi_1/0
+	movzbl	%r14b, %ecx	# 13532	[c=4 l=4]  *zero_extendqisi2/0
+	call	log_add_data_mov@PLT	# 13538	[c=0 l=5]  *call
+	movl	$63, %eax	# 13539	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 13540	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 13541	[c=13 l=7]  *cmpsi_1/1
+	jb	.L1132	# 13542	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%r13)	# 13544	[c=13 l=8]  *cmpqi_ccno_1/1
+	jne	.L1133	# 13545	[c=13 l=6]  *jcc
+.L1132:
+	movq	1040(%r13), %rax	# 13548	[c=9 l=7]  *movdi_internal/3
+	movb	%r14b, 63(%rax)	# 13549	[c=4 l=4]  *movqi_internal/8
+.L1134:
+	movq	%r13, %rdi	# 13561	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 13560	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 13562	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 18005	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 18006	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 13564	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18736	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 13565	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 13567	[c=4 l=3]  *cmpdi_1/0
+	jb	.L344	# 13568	[c=13 l=6]  *jcc
+	movl	0(%r13), %ebx	# 13570	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 13575	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 13571	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 13573	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 13574	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 13576	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 13577	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 13578	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 13581	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 18007	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 13582	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 13585	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 13586	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 19906	[c=10 l=4]  *indirect_jump
+.L1135:
+	movzbl	10(%rbx), %r15d	# 13594	[c=13 l=5]  zero_extendqidi2/0
+	xorl	%eax, %eax	# 19904	[c=4 l=2]  *movdi_xor
+	leaq	.LC35(%rip), %rsi	# 13599	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 13601	[c=4 l=3]  *movdi_internal/3
+	movzbl	1004(%r13,%r15), %ecx	# 13596	[c=14 l=9]  *zero_extendqisi2/0
+	movq	%r15, %rdx	# 19245	[c=4 l=3]  *movdi_internal/3
+	movl	%r15d, 16(%rsp)	# 18606	[c=4 l=5]  *movsi_internal/1
+	call	log_append@PLT	# 13603	[c=0 l=5]  *call
+	movzwl	1034(%r13), %r14d	# 13607	[c=13 l=8]  *zero_extendhisi2/0
+	movl	$30, %edx	# 13609	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 13612	[c=4 l=3]  *movdi_internal/3
+	movzbl	1004(%r13,%r15), %eax	# 13605	[c=14 l=9]  *zero_extendqisi2/0
+	leaq	.LC34(%rip), %rsi	# 13610	[c=1 l=7]  *movdi_internal/4
+	movl	%r14d, %ecx	# 13608	[c=4 l=3]  *movsi_internal/0
+	movb	%al, 24(%rsp)	# 18604	[c=4 l=4]  *movqi_internal/8
+	movl	%eax, 8(%rsp)	# 18012	[c=4 l=4]  *movsi_internal/1
+	xorl	%eax, %eax	# 19905	[c=4 l=2]  *movdi_xor
+	call	log_append@PLT	# 13614	[c=0 l=5]  *call
+	cmpb	$0, 844(%r13)	# 13615	[c=13 l=8]  *cmpqi_ccno_1/1
+	jne	.L1550	# 13616	[c=13 l=6]  *jcc
+.L1136:
+	movl	%r14d, %eax	# 18014	[c=4 l=3]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 13634	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 13635	[c=13 l=7]  *cmpsi_1/1
+	jb	.L1138	# 13636	[c=13 l=2]  *jcc
+	movl	%r14d, %eax	# 18016	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %eax	# 13638	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 16862	[c=5 l=5]  *andsi_1_zext
+	cmpb	$0, 1080(%r13,%rax)	# 13641	[c=14 l=9]  *cmpqi_ccno_1/1
+	jne	.L1139	# 13642	[c=13 l=6]  *jcc
+.L1138:
+	movq	1040(%r13), %rdx	# 13646	[c=9 l=7]  *movdi_internal/3
+	movslq	%r14d, %rax	# 13645	[c=4 l=3]  *extendsidi2_rex64/1
+	movzbl	(%rdx,%rax), %ecx	# 13647	[c=13 l=4]  *zero_extendqisi2/0
+.L1140:
+	cmpl	$63, %r14d	# 13658	[c=4 l=4]  *cmpsi_1/0
+	je	.L1551	# 13659	[c=13 l=6]  *jcc
+	movl	%r14d, %edx	# 14348	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC25(%rip), %rsi	# 14349	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 14351	[c=4 l=3]  *movdi_internal/3
+	movl	%ecx, 32(%rsp)	# 18646	[c=4 l=4]  *movsi_internal/1
+	call	log_add_data_mov@PLT	# 14352	[c=0 l=5]  *call
+	movl	32(%rsp), %ecx	# 18647	[c=9 l=4]  *movsi_internal/0
+	movl	16(%rsp), %edx	# 14356	[c=9 l=4]  *movsi_internal/0
+	movq	%r13, %rdi	# 14359	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC36(%rip), %rsi	# 14357	[c=1 l=7]  *movdi_internal/4
+	xorl	%eax, %eax	# 19884	[c=4 l=2]  *movdi_xor
+	movb	%cl, 32(%rsp)	# 18644	[c=4 l=4]  *movqi_internal/8
+	movzbl	%cl, %ecx	# 14354	[c=4 l=3]  *zero_extendqisi2/0
+	call	log_append@PLT	# 14361	[c=0 l=5]  *call
+	movzbl	32(%rsp), %r9d	# 18645	[c=9 l=6]  *movqi_internal/4
+	leaq	.LC30(%rip), %rsi	# 125	[c=1 l=7]  *movdi_internal/4
+.L1183:
+	movb	%r9b, 1004(%r13,%r15)	# 13706	[c=4 l=8]  *movqi_internal/8
+	movl	8(%rsp), %ecx	# 13707	[c=9 l=4]  *movsi_internal/0
+	movl	%r14d, %edx	# 13708	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 13710	[c=4 l=3]  *movdi_internal/3
+	call	log_add_data_mov@PLT	# 13711	[c=0 l=5]  *call
+	movl	%r14d, %eax	# 18025	[c=4 l=3]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 13712	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 13713	[c=13 l=7]  *cmpsi_1/1
+	jb	.L1145	# 13714	[c=13 l=2]  *jcc
+	movl	%r14d, %eax	# 18027	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %eax	# 13716	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 16860	[c=5 l=5]  *andsi_1_zext
+	cmpb	$0, 1080(%r13,%rax)	# 13719	[c=14 l=9]  *cmpqi_ccno_1/1
+	jne	.L1146	# 13720	[c=13 l=6]  *jcc
+.L1145:
+	movq	1040(%r13), %rax	# 13724	[c=9 l=7]  *movdi_internal/3
+	movzbl	24(%rsp), %edi	# 18029	[c=9 l=5]  *movqi_internal/4
+	movslq	%r14d, %r8	# 13723	[c=4 l=3]  *extendsidi2_rex64/1
+	movb	%dil, (%rax,%r8)	# 13725	[c=4 l=4]  *movqi_internal/8
+.L1144:
+	movq	%rbx, %rsi	# 13736	[c=4 l=3]  *movdi_internal/3
+	movq	%r13, %rdi	# 13737	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 13738	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 18030	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rcx	# 18031	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 13740	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rcx), %rdx	# 18735	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 13741	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 13743	[c=4 l=3]  *cmpdi_1/0
+	jb	.L344	# 13744	[c=13 l=6]  *jcc
+	movl	0(%r13), %ebx	# 13746	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 13751	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 13747	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 13749	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 13750	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 13752	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 13753	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 13754	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 13757	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 18032	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 13758	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 13761	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 13762	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 19900	[c=10 l=4]  *indirect_jump
+.L1147:
+	movzbl	10(%rbx), %r14d	# 13770	[c=13 l=5]  zero_extendqidi2/0
+	xorl	%eax, %eax	# 19898	[c=4 l=2]  *movdi_xor
+	leaq	.LC35(%rip), %rsi	# 13775	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 13777	[c=4 l=3]  *movdi_internal/3
+	movzbl	1004(%r13,%r14), %ecx	# 13772	[c=14 l=9]  *zero_extendqisi2/0
+	movq	%r14, %rdx	# 19246	[c=4 l=3]  *movdi_internal/3
+	movl	%r14d, 8(%rsp)	# 18615	[c=4 l=5]  *movsi_internal/1
+	call	log_append@PLT	# 13779	[c=0 l=5]  *call
+	movzwl	1034(%r13), %r15d	# 13782	[c=13 l=8]  *zero_extendhisi2/0
+	movl	$30, %edx	# 13784	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 13787	[c=4 l=3]  *movdi_internal/3
+	movzbl	1004(%r13,%r14), %eax	# 13781	[c=14 l=9]  *zero_extendqisi2/0
+	leaq	.LC34(%rip), %rsi	# 13785	[c=1 l=7]  *movdi_internal/4
+	movl	%r15d, %ecx	# 13783	[c=4 l=3]  *movsi_internal/0
+	movl	%eax, 16(%rsp)	# 18036	[c=4 l=4]  *movsi_internal/1
+	xorl	%eax, %eax	# 19899	[c=4 l=2]  *movdi_xor
+	call	log_append@PLT	# 13789	[c=0 l=5]  *call
+	cmpb	$0, 844(%r13)	# 13790	[c=13 l=8]  *cmpqi_ccno_1/1
+	jne	.L1552	# 13791	[c=13 l=6]  *jcc
+.L1148:
+	movl	%r15d, %eax	# 18037	[c=4 l=3]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 13809	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 13810	[c=13 l=7]  *cmpsi_1/1
+	jb	.L1150	# 13811	[c=13 l=2]  *jcc
+	movl	%r15d, %eax	# 18039	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %eax	# 13813	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 16859	[c=5 l=5]  *andsi_1_zext
+	cmpb	$0, 1080(%r13,%rax)	# 13816	[c=14 l=9]  *cmpqi_ccno_1/1
+	jne	.L1151	# 13817	[c=13 l=6]  *jcc
+.L1150:
+	movq	1040(%r13), %rdx	# 13821	[c=9 l=7]  *movdi_internal/3
+	movslq	%r15d, %rax	# 13820	[c=4 l=3]  *extendsidi2_rex64/1
+	movzbl	(%rdx,%rax), %r9d	# 13822	[c=13 l=5]  *zero_extendqisi2/0
+.L1152:
+	cmpl	$63, %r15d	# 13833	[c=4 l=4]  *cmpsi_1/0
+	je	.L1553	# 13834	[c=13 l=6]  *jcc
+	movl	%r9d, %ecx	# 14386	[c=4 l=3]  *movsi_internal/0
+	movl	%r15d, %edx	# 14387	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC25(%rip), %rsi	# 14388	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 14390	[c=4 l=3]  *movdi_internal/3
+	movl	%r9d, 24(%rsp)	# 18657	[c=4 l=5]  *movsi_internal/1
+	call	log_add_data_mov@PLT	# 14391	[c=0 l=5]  *call
+	movl	24(%rsp), %r9d	# 18658	[c=9 l=5]  *movsi_internal/0
+	movl	8(%rsp), %edx	# 14395	[c=9 l=4]  *movsi_internal/0
+	xorl	%eax, %eax	# 19882	[c=4 l=2]  *movdi_xor
+	leaq	.LC36(%rip), %rsi	# 14396	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 14398	[c=4 l=3]  *movdi_internal/3
+	movzbl	%r9b, %ecx	# 14393	[c=4 l=4]  *zero_extendqisi2/0
+	movb	%r9b, 32(%rsp)	# 18655	[c=4 l=5]  *movqi_internal/8
+	call	log_append@PLT	# 14400	[c=0 l=5]  *call
+	movl	16(%rsp), %eax	# 18103	[c=9 l=4]  *movsi_internal/0
+	movl	24(%rsp), %r9d	# 18654	[c=9 l=5]  *movsi_internal/0
+	leaq	.LC30(%rip), %rsi	# 128	[c=1 l=7]  *movdi_internal/4
+	movzbl	32(%rsp), %r11d	# 18656	[c=9 l=6]  *movqi_internal/4
+	orl	%r9d, %eax	# 14401	[c=4 l=3]  *iorsi_1/0
+	movl	%eax, 8(%rsp)	# 18652	[c=4 l=4]  *movsi_internal/1
+	movzbl	%al, %ecx	# 14402	[c=4 l=3]  *zero_extendqisi2/0
+.L1184:
+	movb	%r11b, 1004(%r13,%r14)	# 13882	[c=4 l=8]  *movqi_internal/8
+	movl	%r15d, %edx	# 13884	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 13886	[c=4 l=3]  *movdi_internal/3
+	call	log_add_data_mov@PLT	# 13887	[c=0 l=5]  *call
+	movl	%r15d, %eax	# 18048	[c=4 l=3]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 13888	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 13889	[c=13 l=7]  *cmpsi_1/1
+	jb	.L1157	# 13890	[c=13 l=2]  *jcc
+	movl	%r15d, %eax	# 18050	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %eax	# 13892	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 16857	[c=5 l=5]  *andsi_1_zext
+	cmpb	$0, 1080(%r13,%rax)	# 13895	[c=14 l=9]  *cmpqi_ccno_1/1
+	jne	.L1158	# 13896	[c=13 l=6]  *jcc
+.L1157:
+	movq	1040(%r13), %rax	# 13900	[c=9 l=7]  *movdi_internal/3
+	movzbl	8(%rsp), %edi	# 18052	[c=9 l=5]  *movqi_internal/4
+	movslq	%r15d, %r8	# 13899	[c=4 l=3]  *extendsidi2_rex64/1
+	movb	%dil, (%rax,%r8)	# 13901	[c=4 l=4]  *movqi_internal/8
+.L1156:
+	movq	%r13, %rdi	# 13913	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 13912	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 13914	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 18053	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 18054	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 13916	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18734	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 13917	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 13919	[c=4 l=3]  *cmpdi_1/0
+	jb	.L344	# 13920	[c=13 l=6]  *jcc
+	movl	0(%r13), %ebx	# 13922	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 13927	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 13923	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 13925	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 13926	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 13928	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 13929	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 13930	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 13933	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 18055	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 13934	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 13937	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 13938	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 19895	[c=10 l=4]  *indirect_jump
+.L1159:
+	movzbl	10(%rbx), %r14d	# 13946	[c=13 l=5]  zero_extendqidi2/0
+	xorl	%eax, %eax	# 19893	[c=4 l=2]  *movdi_xor
+	leaq	.LC35(%rip), %rsi	# 13951	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 13953	[c=4 l=3]  *movdi_internal/3
+	movzbl	1004(%r13,%r14), %ecx	# 13948	[c=14 l=9]  *zero_extendqisi2/0
+	movq	%r14, %rdx	# 19247	[c=4 l=3]  *movdi_internal/3
+	movl	%r14d, 8(%rsp)	# 18625	[c=4 l=5]  *movsi_internal/1
+	call	log_append@PLT	# 13955	[c=0 l=5]  *call
+	movzwl	1034(%r13), %r15d	# 13958	[c=13 l=8]  *zero_extendhisi2/0
+	movl	$30, %edx	# 13960	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 13963	[c=4 l=3]  *movdi_internal/3
+	movzbl	1004(%r13,%r14), %eax	# 13957	[c=14 l=9]  *zero_extendqisi2/0
+	leaq	.LC34(%rip), %rsi	# 13961	[c=1 l=7]  *movdi_internal/4
+	movl	%r15d, %ecx	# 13959	[c=4 l=3]  *movsi_internal/0
+	movl	%eax, 16(%rsp)	# 18059	[c=4 l=4]  *movsi_internal/1
+	xorl	%eax, %eax	# 19894	[c=4 l=2]  *movdi_xor
+	call	log_append@PLT	# 13965	[c=0 l=5]  *call
+	cmpb	$0, 844(%r13)	# 13966	[c=13 l=8]  *cmpqi_ccno_1/1
+	jne	.L1554	# 13967	[c=13 l=6]  *jcc
+.L1160:
+	movl	%r15d, %eax	# 18060	[c=4 l=3]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 13985	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 13986	[c=13 l=7]  *cmpsi_1/1
+	jb	.L1162	# 13987	[c=13 l=2]  *jcc
+	movl	%r15d, %eax	# 18062	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %eax	# 13989	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 16856	[c=5 l=5]  *andsi_1_zext
+	cmpb	$0, 1080(%r13,%rax)	# 13992	[c=14 l=9]  *cmpqi_ccno_1/1
+	jne	.L1163	# 13993	[c=13 l=6]  *jcc
+.L1162:
+	movq	1040(%r13), %rdx	# 13997	[c=9 l=7]  *movdi_internal/3
+	movslq	%r15d, %rax	# 13996	[c=4 l=3]  *extendsidi2_rex64/1
+	movzbl	(%rdx,%rax), %r9d	# 13998	[c=13 l=5]  *zero_extendqisi2/0
+.L1164:
+	cmpl	$63, %r15d	# 14009	[c=4 l=4]  *cmpsi_1/0
+	je	.L1555	# 14010	[c=13 l=6]  *jcc
+	movl	%r9d, %ecx	# 14452	[c=4 l=3]  *movsi_internal/0
+	movl	%r15d, %edx	# 14453	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC25(%rip), %rsi	# 14454	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 14456	[c=4 l=3]  *movdi_internal/3
+	movl	%r9d, 24(%rsp)	# 18678	[c=4 l=5]  *movsi_internal/1
+	call	log_add_data_mov@PLT	# 14457	[c=0 l=5]  *call
+	movl	24(%rsp), %r9d	# 18679	[c=9 l=5]  *movsi_internal/0
+	movl	8(%rsp), %edx	# 14461	[c=9 l=4]  *movsi_internal/0
+	xorl	%eax, %eax	# 19879	[c=4 l=2]  *movdi_xor
+	leaq	.LC36(%rip), %rsi	# 14462	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 14464	[c=4 l=3]  *movdi_internal/3
+	movzbl	%r9b, %ecx	# 14459	[c=4 l=4]  *zero_extendqisi2/0
+	movb	%r9b, 32(%rsp)	# 18676	[c=4 l=5]  *movqi_internal/8
+	call	log_append@PLT	# 14466	[c=0 l=5]  *call
+	movl	16(%rsp), %eax	# 18111	[c=9 l=4]  *movsi_internal/0
+	movl	24(%rsp), %r9d	# 18675	[c=9 l=5]  *movsi_internal/0
+	leaq	.LC30(%rip), %rsi	# 132	[c=1 l=7]  *movdi_internal/4
+	movzbl	32(%rsp), %r11d	# 18677	[c=9 l=6]  *movqi_internal/4
+	notl	%eax	# 14467	[c=4 l=2]  *one_cmplsi2_1/0
+	andl	%r9d, %eax	# 14468	[c=4 l=3]  *andsi_1/0
+	movl	%eax, 8(%rsp)	# 18673	[c=4 l=4]  *movsi_internal/1
+	movzbl	%al, %ecx	# 14469	[c=4 l=3]  *zero_extendqisi2/0
+.L1185:
+	movb	%r11b, 1004(%r13,%r14)	# 14059	[c=4 l=8]  *movqi_internal/8
+	movl	%r15d, %edx	# 14061	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 14063	[c=4 l=3]  *movdi_internal/3
+	call	log_add_data_mov@PLT	# 14064	[c=0 l=5]  *call
+	movl	%r15d, %eax	# 18071	[c=4 l=3]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 14065	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 14066	[c=13 l=7]  *cmpsi_1/1
+	jb	.L1169	# 14067	[c=13 l=2]  *jcc
+	movl	%r15d, %eax	# 18073	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %eax	# 14069	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 16854	[c=5 l=5]  *andsi_1_zext
+	cmpb	$0, 1080(%r13,%rax)	# 14072	[c=14 l=9]  *cmpqi_ccno_1/1
+	jne	.L1170	# 14073	[c=13 l=6]  *jcc
+.L1169:
+	movq	1040(%r13), %rax	# 14077	[c=9 l=7]  *movdi_internal/3
+	movzbl	8(%rsp), %edi	# 18075	[c=9 l=5]  *movqi_internal/4
+	movslq	%r15d, %r8	# 14076	[c=4 l=3]  *extendsidi2_rex64/1
+	movb	%dil, (%rax,%r8)	# 14078	[c=4 l=4]  *movqi_internal/8
+.L1168:
+	movq	%rbx, %rsi	# 14089	[c=4 l=3]  *movdi_internal/3
+	movq	%r13, %rdi	# 14090	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 14091	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 18076	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rcx	# 18077	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 14093	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rcx), %rdx	# 18733	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 14094	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 14096	[c=4 l=3]  *cmpdi_1/0
+	jb	.L344	# 14097	[c=13 l=6]  *jcc
+	movl	0(%r13), %ebx	# 14099	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 14104	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 14100	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 14102	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 14103	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 14105	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 14106	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 14107	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 14110	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 18078	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 14111	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 14114	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 14115	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 19890	[c=10 l=4]  *indirect_jump
+.L992:
+	movslq	892(%r13), %rcx	# 11167	[c=13 l=7]  *extendsidi2_rex64/1
+	leaq	se.0(%rip), %rdx	# 11166	[c=1 l=7]  *movdi_internal/4
+	movq	1040(%r13), %rsi	# 11164	[c=9 l=7]  *movdi_internal/3
+	movzwl	(%rdx,%rcx,4), %eax	# 11168	[c=14 l=4]  zero_extendhidi2/0
+	movzbl	(%rsi,%rax), %eax	# 11171	[c=9 l=4]  *movqi_internal/4
+	andb	2(%rdx,%rcx,4), %al	# 11172	[c=14 l=4]  *andqi_2_maybe_si/1
+	je	.L993	# 11174	[c=13 l=2]  *jcc
+	cmpb	$0, 63(%rsi)	# 11179	[c=13 l=4]  *cmpqi_ccno_1/1
+	movq	48(%r13), %r14	# 11176	[c=9 l=4]  *movdi_internal/3
+	jns	.L995	# 11180	[c=13 l=6]  *jcc
+	movq	%r13, %rdi	# 11191	[c=4 l=3]  *movdi_internal/3
+	call	events_sleep@PLT	# 11192	[c=10 l=5]  *call_value
+	testb	%al, %al	# 11195	[c=4 l=2]  *cmpqi_ccno_1/0
+	je	.L995	# 11196	[c=13 l=6]  *jcc
+	movq	48(%r13), %rdx	# 17823	[c=9 l=4]  *movdi_internal/3
+	leaq	.LC66(%rip), %rsi	# 11202	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 11204	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 19992	[c=4 l=2]  *movdi_xor
+	subq	%r14, %rdx	# 11199	[c=4 l=3]  *subdi_1/0
+	addq	%rdx, 64(%r13)	# 11200	[c=13 l=4]  *adddi_1/0
+	call	log_append@PLT	# 11206	[c=0 l=5]  *call
+.L993:
+	movq	%r13, %rdi	# 11210	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 11209	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 11211	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 17825	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 17826	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 11213	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18764	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 11214	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 11216	[c=4 l=3]  *cmpdi_1/0
+	jb	.L344	# 11217	[c=13 l=6]  *jcc
+	movq	56(%r13), %rax	# 17827	[c=9 l=4]  *movdi_internal/3
+	cmpq	%rax, 48(%r13)	# 11220	[c=13 l=4]  *cmpdi_1/0
+	jnb	.L1556	# 11221	[c=13 l=6]  *jcc
+.L996:
+	movq	%r13, %rdi	# 11227	[c=4 l=3]  *movdi_internal/3
+	call	log_is_idle@PLT	# 11228	[c=10 l=5]  *call_value
+	testb	%al, %al	# 11230	[c=4 l=2]  *cmpqi_ccno_1/0
+	jne	.L1557	# 11231	[c=13 l=6]  *jcc
+.L997:
+	movl	0(%r13), %ebx	# 11242	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 11247	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 11243	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 11245	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 11246	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 11248	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 11249	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 11250	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 11253	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 17828	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 11254	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 11257	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 11258	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 19991	[c=10 l=4]  *indirect_jump
+.L998:
+	movzwl	1034(%r13), %eax	# 11266	[c=13 l=8]  *zero_extendhisi2/0
+	movl	$30, %edx	# 11268	[c=4 l=5]  *movsi_internal/0
+	leaq	.LC34(%rip), %rsi	# 11269	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 11271	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, 8(%rsp)	# 18507	[c=4 l=4]  *movsi_internal/1
+	movl	%eax, %ecx	# 11267	[c=4 l=2]  *movsi_internal/0
+	xorl	%eax, %eax	# 19990	[c=4 l=2]  *movdi_xor
+	call	log_append@PLT	# 11273	[c=0 l=5]  *call
+	cmpl	$65536, 880(%r13)	# 11276	[c=13 l=11]  *cmpsi_1/0
+	jbe	.L999	# 11277	[c=13 l=2]  *jcc
+	movl	$59, %eax	# 11279	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 11280	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 11281	[c=13 l=7]  *cmpsi_1/1
+	jb	.L1000	# 11282	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%r13)	# 11284	[c=13 l=8]  *cmpqi_ccno_1/1
+	jne	.L1001	# 11285	[c=13 l=6]  *jcc
+.L1000:
+	movq	1040(%r13), %rax	# 11288	[c=9 l=7]  *movdi_internal/3
+	movzbl	59(%rax), %r14d	# 11289	[c=13 l=5]  *zero_extendqisi2/0
+.L1002:
+	movl	%r14d, %ecx	# 11300	[c=4 l=3]  *movsi_internal/0
+	movl	$59, %edx	# 11301	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 11304	[c=4 l=3]  *movdi_internal/3
+	sall	$16, %r14d	# 11306	[c=4 l=4]  *ashlsi3_1/0
+	leaq	.LC25(%rip), %rsi	# 11302	[c=1 l=7]  *movdi_internal/4
+	call	log_add_data_mov@PLT	# 11305	[c=0 l=5]  *call
+	orl	%r14d, 8(%rsp)	# 11307	[c=13 l=5]  *iorsi_1/0
+.L999:
+	movl	992(%r13), %eax	# 11312	[c=9 l=7]  *movsi_internal/0
+	movl	6044(%r13), %r15d	# 11310	[c=9 l=7]  *movsi_internal/0
+	movq	%r13, %rdi	# 11322	[c=4 l=3]  *movdi_internal/3
+	leal	1(%rax,%rax), %r14d	# 11314	[c=8 l=5]  *leasi
+	movl	%r15d, %eax	# 17833	[c=4 l=3]  *movsi_internal/0
+	negl	%eax	# 11315	[c=4 l=2]  *negsi_1
+	andl	%eax, %r14d	# 11316	[c=4 l=3]  *andsi_1/0
+	movl	8(%rsp), %eax	# 17835	[c=9 l=4]  *movsi_internal/0
+	andl	%eax, %r14d	# 11317	[c=4 l=3]  *andsi_1/0
+	leaq	6052(%r13), %rax	# 18763	[c=4 l=7]  *leadi
+	movl	%r14d, %ecx	# 11318	[c=1 l=3]  *zero_extendsidi2/3
+	addq	1056(%r13), %rcx	# 11320	[c=13 l=7]  *adddi_1/1
+	movq	%rax, 24(%rsp)	# 17836	[c=4 l=5]  *movdi_internal/5
+	movq	%rcx, 16(%rsp)	# 18508	[c=4 l=5]  *movdi_internal/5
+	call	spm_operation	# 11323	[c=10 l=5]  *call_value
+	movq	16(%rsp), %rcx	# 18509	[c=9 l=5]  *movdi_internal/3
+	cmpl	$3, %eax	# 11325	[c=4 l=3]  *cmpsi_1/0
+	je	.L1558	# 11326	[c=13 l=6]  *jcc
+	jg	.L1004	# 11331	[c=13 l=6]  *jcc
+	cmpl	$1, %eax	# 11333	[c=4 l=3]  *cmpsi_1/0
+	je	.L1005	# 11334	[c=13 l=6]  *jcc
+	cmpl	$2, %eax	# 11336	[c=4 l=3]  *cmpsi_1/0
+	jne	.L1007	# 11337	[c=13 l=2]  *jcc
+	movl	%r14d, %edx	# 11381	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC62(%rip), %rsi	# 11382	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 11384	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 19985	[c=4 l=2]  *movdi_xor
+	movq	%rcx, 8(%rsp)	# 18513	[c=4 l=5]  *movdi_internal/5
+	call	log_append@PLT	# 11386	[c=0 l=5]  *call
+	movq	8(%rsp), %rdi	# 19986	[c=9 l=5]  *movdi_internal/3
+	movl	%r15d, %edx	# 11388	[c=1 l=3]  *zero_extendsidi2/3
+	movl	$255, %esi	# 11390	[c=4 l=5]  *movsi_internal/0
+.L1376:
+	call	memset@PLT	# 11433	[c=10 l=5]  *call_value
+	leal	(%r15,%r14), %edx	# 18759	[c=4 l=4]  *leasi
+	movl	%r14d, %esi	# 11436	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 11437	[c=4 l=3]  *movdi_internal/3
+	call	flash_changed	# 11438	[c=0 l=5]  *call
+.L1007:
+	movq	%r13, %rdi	# 11442	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 11441	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 11443	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 17843	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 17844	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 11445	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18758	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 11446	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 11448	[c=4 l=3]  *cmpdi_1/0
+	jb	.L344	# 11449	[c=13 l=6]  *jcc
+	movq	56(%r13), %rax	# 17845	[c=9 l=4]  *movdi_internal/3
+	cmpq	%rax, 48(%r13)	# 11452	[c=13 l=4]  *cmpdi_1/0
+	jnb	.L1559	# 11453	[c=13 l=6]  *jcc
+.L1011:
+	movq	%r13, %rdi	# 11459	[c=4 l=3]  *movdi_internal/3
+	call	log_is_idle@PLT	# 11460	[c=10 l=5]  *call_value
+	testb	%al, %al	# 11462	[c=4 l=2]  *cmpqi_ccno_1/0
+	jne	.L1560	# 11463	[c=13 l=6]  *jcc
+.L1012:
+	movl	0(%r13), %ebx	# 11474	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 11479	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 11475	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 11477	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 11478	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 11480	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 11481	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 11482	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 11485	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 17846	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 11486	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 11489	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 11490	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 19982	[c=10 l=4]  *indirect_jump
+.L1013:
+	cmpb	$0, 844(%r13)	# 11500	[c=13 l=8]  *cmpqi_ccno_1/1
+	movzwl	12(%rbx), %r15d	# 11498	[c=13 l=5]  *zero_extendhisi2/0
+	movzbl	10(%rbx), %r14d	# 11499	[c=13 l=5]  *zero_extendqisi2/0
+	jne	.L1561	# 11501	[c=13 l=6]  *jcc
+	movzwl	1032(%r13), %r8d	# 11514	[c=13 l=8]  *zero_extendhisi2/0
+	xorl	%eax, %eax	# 19979	[c=4 l=2]  *movdi_xor
+	movl	$28, %edx	# 11516	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 11519	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC34(%rip), %rsi	# 11517	[c=1 l=7]  *movdi_internal/4
+	movl	%r8d, %ecx	# 11515	[c=4 l=3]  *movsi_internal/0
+	movl	%r8d, 16(%rsp)	# 18524	[c=4 l=5]  *movsi_internal/1
+	call	log_append@PLT	# 11521	[c=0 l=5]  *call
+	movslq	%r14d, %r9	# 11522	[c=4 l=3]  *extendsidi2_rex64/1
+	movl	%r14d, %edx	# 11525	[c=4 l=3]  *movsi_internal/0
+	xorl	%eax, %eax	# 19980	[c=4 l=2]  *movdi_xor
+	leaq	.LC35(%rip), %rsi	# 11526	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 11528	[c=4 l=3]  *movdi_internal/3
+	movq	%r9, 8(%rsp)	# 18522	[c=4 l=5]  *movdi_internal/5
+	movzbl	1004(%r13,%r9), %ecx	# 11523	[c=14 l=9]  *zero_extendqisi2/0
+	call	log_append@PLT	# 11530	[c=0 l=5]  *call
+	movl	16(%rsp), %r8d	# 18525	[c=9 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 11543	[c=4 l=3]  *movdi_internal/3
+	movq	8(%rsp), %r9	# 18523	[c=9 l=5]  *movdi_internal/3
+	leaq	.LC30(%rip), %rdx	# 17003	[c=1 l=7]  *movdi_internal/4
+	leaq	.LC29(%rip), %rsi	# 17002	[c=1 l=7]  *movdi_internal/4
+	movzbl	1004(%r13,%r9), %ecx	# 11532	[c=14 l=9]  *zero_extendqisi2/0
+	leal	(%r15,%r8), %r14d	# 18757	[c=4 l=4]  *leasi
+	cmpl	$63, %r14d	# 15778	[c=4 l=4]  *cmpsi_1/0
+	cmovne	%rdx, %rsi	# 15779	[c=8 l=4]  *movdicc_noc/1
+	movl	%r14d, %edx	# 11541	[c=4 l=3]  *movsi_internal/0
+	movb	%cl, 8(%rsp)	# 18520	[c=4 l=4]  *movqi_internal/8
+	movl	%ecx, 24(%rsp)	# 18519	[c=4 l=4]  *movsi_internal/1
+	call	log_add_data_mov@PLT	# 11544	[c=0 l=5]  *call
+	movl	%r14d, %edx	# 17849	[c=4 l=3]  *movsi_internal/0
+	subl	5176(%r13), %edx	# 11545	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %edx	# 11546	[c=13 l=7]  *cmpsi_1/1
+	movzbl	8(%rsp), %r9d	# 18521	[c=9 l=6]  *movqi_internal/4
+	jb	.L1017	# 11547	[c=13 l=2]  *jcc
+	movl	%r14d, %edx	# 17851	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %edx	# 11549	[c=4 l=3]  *ashrsi3_1/0
+	movslq	%edx, %rdx	# 11550	[c=4 l=3]  *extendsidi2_rex64/1
+	cmpb	$0, 1080(%r13,%rdx)	# 11551	[c=14 l=9]  *cmpqi_ccno_1/1
+	jne	.L1018	# 11552	[c=13 l=6]  *jcc
+.L1017:
+	movq	1040(%r13), %rdx	# 11556	[c=9 l=7]  *movdi_internal/3
+	movslq	%r14d, %rax	# 11555	[c=4 l=3]  *extendsidi2_rex64/1
+	movb	%r9b, (%rdx,%rax)	# 11557	[c=4 l=4]  *movqi_internal/8
+.L1019:
+	testl	%r15d, %r15d	# 11568	[c=4 l=3]  *cmpsi_ccno_1/0
+	jne	.L1015	# 11569	[c=13 l=2]  *jcc
+	subq	$1, 48(%r13)	# 11571	[c=13 l=5]  *adddi_1/0
+.L1015:
+	movq	%r13, %rdi	# 11575	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 11574	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 11576	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 17853	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 17854	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 11578	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18756	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 11579	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 11581	[c=4 l=3]  *cmpdi_1/0
+	jb	.L344	# 11582	[c=13 l=6]  *jcc
+	movl	0(%r13), %ebx	# 11584	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 11589	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 11585	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 11587	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 11588	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 11590	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 11591	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 11592	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 11595	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 17855	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 11596	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 11599	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 11600	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 19978	[c=10 l=4]  *indirect_jump
+.L1020:
+	cmpb	$0, 844(%r13)	# 11610	[c=13 l=8]  *cmpqi_ccno_1/1
+	movzwl	12(%rbx), %r15d	# 11608	[c=13 l=5]  *zero_extendhisi2/0
+	movzbl	10(%rbx), %r14d	# 11609	[c=13 l=5]  *zero_extendqisi2/0
+	jne	.L1562	# 11611	[c=13 l=6]  *jcc
+	movzwl	1034(%r13), %r8d	# 11624	[c=13 l=8]  *zero_extendhisi2/0
+	xorl	%eax, %eax	# 19975	[c=4 l=2]  *movdi_xor
+	movl	$30, %edx	# 11626	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 11629	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC34(%rip), %rsi	# 11627	[c=1 l=7]  *movdi_internal/4
+	movl	%r8d, %ecx	# 11625	[c=4 l=3]  *movsi_internal/0
+	movl	%r8d, 16(%rsp)	# 18531	[c=4 l=5]  *movsi_internal/1
+	call	log_append@PLT	# 11631	[c=0 l=5]  *call
+	movslq	%r14d, %r9	# 11632	[c=4 l=3]  *extendsidi2_rex64/1
+	movl	%r14d, %edx	# 11635	[c=4 l=3]  *movsi_internal/0
+	xorl	%eax, %eax	# 19976	[c=4 l=2]  *movdi_xor
+	leaq	.LC35(%rip), %rsi	# 11636	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 11638	[c=4 l=3]  *movdi_internal/3
+	movq	%r9, 8(%rsp)	# 18529	[c=4 l=5]  *movdi_internal/5
+	movzbl	1004(%r13,%r9), %ecx	# 11633	[c=14 l=9]  *zero_extendqisi2/0
+	call	log_append@PLT	# 11640	[c=0 l=5]  *call
+	movl	16(%rsp), %r8d	# 18532	[c=9 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 11653	[c=4 l=3]  *movdi_internal/3
+	movq	8(%rsp), %r9	# 18530	[c=9 l=5]  *movdi_internal/3
+	leaq	.LC30(%rip), %rdx	# 17005	[c=1 l=7]  *movdi_internal/4
+	leaq	.LC29(%rip), %rsi	# 17004	[c=1 l=7]  *movdi_internal/4
+	movzbl	1004(%r13,%r9), %ecx	# 11642	[c=14 l=9]  *zero_extendqisi2/0
+	leal	(%r15,%r8), %r14d	# 18755	[c=4 l=4]  *leasi
+	cmpl	$63, %r14d	# 15790	[c=4 l=4]  *cmpsi_1/0
+	cmovne	%rdx, %rsi	# 15791	[c=8 l=4]  *movdicc_noc/1
+	movl	%r14d, %edx	# 11651	[c=4 l=3]  *movsi_internal/0
+	movb	%cl, 8(%rsp)	# 18527	[c=4 l=4]  *movqi_internal/8
+	movl	%ecx, 24(%rsp)	# 18526	[c=4 l=4]  *movsi_internal/1
+	call	log_add_data_mov@PLT	# 11654	[c=0 l=5]  *call
+	movl	%r14d, %edx	# 17858	[c=4 l=3]  *movsi_internal/0
+	subl	5176(%r13), %edx	# 11655	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %edx	# 11656	[c=13 l=7]  *cmpsi_1/1
+	movzbl	8(%rsp), %r9d	# 18528	[c=9 l=6]  *movqi_internal/4
+	jb	.L1024	# 11657	[c=13 l=2]  *jcc
+	movl	%r14d, %edx	# 17860	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %edx	# 11659	[c=4 l=3]  *ashrsi3_1/0
+	movslq	%edx, %rdx	# 11660	[c=4 l=3]  *extendsidi2_rex64/1
+	cmpb	$0, 1080(%r13,%rdx)	# 11661	[c=14 l=9]  *cmpqi_ccno_1/1
+	jne	.L1025	# 11662	[c=13 l=6]  *jcc
+.L1024:
+	movq	1040(%r13), %rdx	# 11666	[c=9 l=7]  *movdi_internal/3
+	movslq	%r14d, %rax	# 11665	[c=4 l=3]  *extendsidi2_rex64/1
+	movb	%r9b, (%rdx,%rax)	# 11667	[c=4 l=4]  *movqi_internal/8
+.L1026:
+	testl	%r15d, %r15d	# 11678	[c=4 l=3]  *cmpsi_ccno_1/0
+	jne	.L1022	# 11679	[c=13 l=2]  *jcc
+	subq	$1, 48(%r13)	# 11681	[c=13 l=5]  *adddi_1/0
+.L1022:
+	movq	%r13, %rdi	# 11685	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 11684	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 11686	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 17862	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 17863	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 11688	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18754	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 11689	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 11691	[c=4 l=3]  *cmpdi_1/0
+	jb	.L344	# 11692	[c=13 l=6]  *jcc
+	movl	0(%r13), %ebx	# 11694	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 11699	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 11695	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 11697	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 11698	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 11700	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 11701	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 11702	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 11705	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 17864	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 11706	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 11709	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 11710	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 19974	[c=10 l=4]  *indirect_jump
+.L1027:
+	cmpb	$0, 844(%r13)	# 11721	[c=13 l=8]  *cmpqi_ccno_1/1
+	movzwl	12(%rbx), %r15d	# 11718	[c=13 l=5]  *zero_extendhisi2/0
+	movzbl	10(%rbx), %eax	# 11720	[c=13 l=4]  *zero_extendqisi2/0
+	jne	.L1563	# 11722	[c=13 l=6]  *jcc
+	movslq	%eax, %r14	# 11800	[c=4 l=3]  *extendsidi2_rex64/1
+	movl	%eax, %edx	# 11803	[c=4 l=2]  *movsi_internal/0
+	leaq	.LC35(%rip), %rsi	# 11804	[c=1 l=7]  *movdi_internal/4
+	xorl	%eax, %eax	# 19972	[c=4 l=2]  *movdi_xor
+	movzbl	1004(%r13,%r14), %ecx	# 11801	[c=14 l=9]  *zero_extendqisi2/0
+	movq	%r13, %rdi	# 11806	[c=4 l=3]  *movdi_internal/3
+	movl	%r15d, 8(%rsp)	# 18538	[c=4 l=5]  *movsi_internal/1
+	call	log_append@PLT	# 11808	[c=0 l=5]  *call
+	cmpl	$63, %r15d	# 15814	[c=4 l=4]  *cmpsi_1/0
+	movl	%r15d, %edx	# 11818	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 11820	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC30(%rip), %rax	# 17009	[c=1 l=7]  *movdi_internal/4
+	leaq	.LC29(%rip), %rsi	# 17008	[c=1 l=7]  *movdi_internal/4
+	movzbl	1004(%r13,%r14), %ecx	# 11810	[c=14 l=9]  *zero_extendqisi2/0
+	cmovne	%rax, %rsi	# 15815	[c=8 l=4]  *movdicc_noc/1
+	movl	%ecx, 16(%rsp)	# 18537	[c=4 l=4]  *movsi_internal/1
+	movl	%ecx, %r14d	# 19218	[c=4 l=3]  *movsi_internal/0
+	call	log_add_data_mov@PLT	# 11821	[c=0 l=5]  *call
+	movl	%r15d, %eax	# 17871	[c=4 l=3]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 11823	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 11824	[c=13 l=7]  *cmpsi_1/1
+	movl	8(%rsp), %r8d	# 18539	[c=9 l=5]  *movsi_internal/0
+	jb	.L1035	# 11825	[c=13 l=2]  *jcc
+	movl	%r15d, %eax	# 17873	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %eax	# 11827	[c=4 l=3]  *ashrsi3_1/0
+	cltq	# 11828	[c=4 l=2]  *extendsidi2_rex64/0
+	cmpb	$0, 1080(%r13,%rax)	# 11829	[c=14 l=9]  *cmpqi_ccno_1/1
+	jne	.L1036	# 11830	[c=13 l=6]  *jcc
+.L1035:
+	movq	1040(%r13), %rdx	# 11834	[c=9 l=7]  *movdi_internal/3
+	movzwl	%r8w, %eax	# 11833	[c=4 l=4]  zero_extendhidi2/0
+	movb	%r14b, (%rdx,%rax)	# 11835	[c=4 l=4]  *movqi_internal/8
+.L1033:
+	movq	%r13, %rdi	# 11847	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 11846	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 11848	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 17875	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 17876	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 11850	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18753	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 11851	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 11853	[c=4 l=3]  *cmpdi_1/0
+	jb	.L344	# 11854	[c=13 l=6]  *jcc
+	movl	0(%r13), %ebx	# 11856	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 11861	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 11857	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 11859	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 11860	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 11862	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 11863	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 11864	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 11867	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 17877	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 11868	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 11871	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 11872	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 19971	[c=10 l=4]  *indirect_jump
+.L1037:
+	movzbl	10(%rbx), %r14d	# 11882	[c=13 l=5]  zero_extendqidi2/0
+	movzwl	12(%rbx), %r15d	# 11880	[c=13 l=5]  *zero_extendhisi2/0
+	xorl	%eax, %eax	# 19970	[c=4 l=2]  *movdi_xor
+	movq	%r13, %rdi	# 11889	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC35(%rip), %rsi	# 11887	[c=1 l=7]  *movdi_internal/4
+	movzbl	1004(%r13,%r14), %ecx	# 11884	[c=14 l=9]  *zero_extendqisi2/0
+	movq	%r14, %rdx	# 19220	[c=4 l=3]  *movdi_internal/3
+	movl	%r15d, 8(%rsp)	# 18541	[c=4 l=5]  *movsi_internal/1
+	call	log_append@PLT	# 11891	[c=0 l=5]  *call
+	cmpl	$63, %r15d	# 15826	[c=4 l=4]  *cmpsi_1/0
+	movl	%r15d, %edx	# 11901	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 11903	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC30(%rip), %rax	# 17011	[c=1 l=7]  *movdi_internal/4
+	leaq	.LC29(%rip), %rsi	# 17010	[c=1 l=7]  *movdi_internal/4
+	movzbl	1004(%r13,%r14), %ecx	# 11893	[c=14 l=9]  *zero_extendqisi2/0
+	cmovne	%rax, %rsi	# 15827	[c=8 l=4]  *movdicc_noc/1
+	movl	%ecx, 16(%rsp)	# 18540	[c=4 l=4]  *movsi_internal/1
+	movl	%ecx, %r14d	# 19221	[c=4 l=3]  *movsi_internal/0
+	call	log_add_data_mov@PLT	# 11904	[c=0 l=5]  *call
+	movl	%r15d, %eax	# 17880	[c=4 l=3]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 11906	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 11907	[c=13 l=7]  *cmpsi_1/1
+	movl	8(%rsp), %r8d	# 18542	[c=9 l=5]  *movsi_internal/0
+	jb	.L1039	# 11908	[c=13 l=2]  *jcc
+	movl	%r15d, %eax	# 17882	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %eax	# 11910	[c=4 l=3]  *ashrsi3_1/0
+	cltq	# 11911	[c=4 l=2]  *extendsidi2_rex64/0
+	cmpb	$0, 1080(%r13,%rax)	# 11912	[c=14 l=9]  *cmpqi_ccno_1/1
+	jne	.L1040	# 11913	[c=13 l=6]  *jcc
+.L1039:
+	movq	1040(%r13), %rdx	# 11917	[c=9 l=7]  *movdi_internal/3
+	movzwl	%r8w, %eax	# 11916	[c=4 l=4]  zero_extendhidi2/0
+	movb	%r14b, (%rdx,%rax)	# 11918	[c=4 l=4]  *movqi_internal/8
+.L1041:
+	movq	%r13, %rdi	# 11930	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 11929	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 11931	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 17884	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 17885	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 11933	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18752	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 11934	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 11936	[c=4 l=3]  *cmpdi_1/0
+	jb	.L344	# 11937	[c=13 l=6]  *jcc
+	movl	0(%r13), %ebx	# 11939	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 11944	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 11940	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 11942	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 11943	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 11945	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 11946	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 11947	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 11950	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 17886	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 11951	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 11954	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 11955	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 19969	[c=10 l=4]  *indirect_jump
+.L1042:
+	cmpb	$0, 844(%r13)	# 11964	[c=13 l=8]  *cmpqi_ccno_1/1
+	movzbl	10(%rbx), %r14d	# 11963	[c=13 l=5]  *zero_extendqisi2/0
+	jne	.L1564	# 11965	[c=13 l=6]  *jcc
+	movzwl	1030(%r13), %r15d	# 11978	[c=13 l=8]  *zero_extendhisi2/0
+	xorl	%eax, %eax	# 19965	[c=4 l=2]  *movdi_xor
+	movl	$26, %edx	# 11981	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 11984	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC34(%rip), %rsi	# 11982	[c=1 l=7]  *movdi_internal/4
+	movl	%r15d, %ecx	# 11980	[c=4 l=3]  *movsi_internal/0
+	movl	%r15d, 16(%rsp)	# 18546	[c=4 l=5]  *movsi_internal/1
+	call	log_append@PLT	# 11986	[c=0 l=5]  *call
+	movslq	%r14d, %r9	# 11987	[c=4 l=3]  *extendsidi2_rex64/1
+	movl	%r14d, %edx	# 11990	[c=4 l=3]  *movsi_internal/0
+	xorl	%eax, %eax	# 19966	[c=4 l=2]  *movdi_xor
+	leaq	.LC35(%rip), %rsi	# 11991	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 11993	[c=4 l=3]  *movdi_internal/3
+	movq	%r9, 8(%rsp)	# 18544	[c=4 l=5]  *movdi_internal/5
+	movzbl	1004(%r13,%r9), %ecx	# 11988	[c=14 l=9]  *zero_extendqisi2/0
+	call	log_append@PLT	# 11995	[c=0 l=5]  *call
+	movq	8(%rsp), %r9	# 18545	[c=9 l=5]  *movdi_internal/3
+	cmpl	$63, %r15d	# 15838	[c=4 l=4]  *cmpsi_1/0
+	leaq	.LC30(%rip), %rdx	# 17013	[c=1 l=7]  *movdi_internal/4
+	leaq	.LC29(%rip), %rsi	# 17012	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 12007	[c=4 l=3]  *movdi_internal/3
+	movzbl	1004(%r13,%r9), %ecx	# 11997	[c=14 l=9]  *zero_extendqisi2/0
+	cmovne	%rdx, %rsi	# 15839	[c=8 l=4]  *movdicc_noc/1
+	movl	%r15d, %edx	# 12005	[c=4 l=3]  *movsi_internal/0
+	movl	%ecx, 8(%rsp)	# 18543	[c=4 l=4]  *movsi_internal/1
+	movl	%ecx, %r14d	# 19223	[c=4 l=3]  *movsi_internal/0
+	call	log_add_data_mov@PLT	# 12008	[c=0 l=5]  *call
+	movl	%r15d, %edx	# 17889	[c=4 l=3]  *movsi_internal/0
+	subl	5176(%r13), %edx	# 12010	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %edx	# 12011	[c=13 l=7]  *cmpsi_1/1
+	movl	16(%rsp), %r8d	# 18547	[c=9 l=5]  *movsi_internal/0
+	jb	.L1046	# 12012	[c=13 l=2]  *jcc
+	movl	%r15d, %edx	# 17891	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %edx	# 12014	[c=4 l=3]  *ashrsi3_1/0
+	movslq	%edx, %rdx	# 12015	[c=4 l=3]  *extendsidi2_rex64/1
+	cmpb	$0, 1080(%r13,%rdx)	# 12016	[c=14 l=9]  *cmpqi_ccno_1/1
+	jne	.L1047	# 12017	[c=13 l=6]  *jcc
+.L1046:
+	movq	1040(%r13), %rdx	# 12021	[c=9 l=7]  *movdi_internal/3
+	movzwl	%r8w, %r8d	# 12020	[c=4 l=4]  zero_extendhidi2/0
+	movb	%r14b, (%rdx,%r8)	# 12022	[c=4 l=4]  *movqi_internal/8
+.L1048:
+	subq	$1, 48(%r13)	# 12033	[c=13 l=5]  *adddi_1/0
+.L1044:
+	movq	%r13, %rdi	# 12037	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 12036	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 12038	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 17893	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 17894	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 12040	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18751	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 12041	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 12043	[c=4 l=3]  *cmpdi_1/0
+	jb	.L344	# 12044	[c=13 l=6]  *jcc
+	movl	0(%r13), %ebx	# 12046	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 12051	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 12047	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 12049	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 12050	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 12052	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 12053	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 12054	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 12057	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 17895	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 12058	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 12061	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 12062	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 19964	[c=10 l=4]  *indirect_jump
+.L1049:
+	cmpb	$0, 844(%r13)	# 12071	[c=13 l=8]  *cmpqi_ccno_1/1
+	movzbl	10(%rbx), %r14d	# 12070	[c=13 l=5]  *zero_extendqisi2/0
+	jne	.L1565	# 12072	[c=13 l=6]  *jcc
+	movzwl	1030(%r13), %r15d	# 12085	[c=13 l=8]  *zero_extendhisi2/0
+	xorl	%eax, %eax	# 19960	[c=4 l=2]  *movdi_xor
+	movl	$26, %edx	# 12087	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 12090	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC34(%rip), %rsi	# 12088	[c=1 l=7]  *movdi_internal/4
+	movl	%r15d, %ecx	# 12086	[c=4 l=3]  *movsi_internal/0
+	subl	$1, %r15d	# 12093	[c=4 l=4]  *addsi_1/0
+	call	log_append@PLT	# 12092	[c=0 l=5]  *call
+	movslq	%r14d, %r8	# 12094	[c=4 l=3]  *extendsidi2_rex64/1
+	movl	%r14d, %edx	# 12097	[c=4 l=3]  *movsi_internal/0
+	xorl	%eax, %eax	# 19961	[c=4 l=2]  *movdi_xor
+	leaq	.LC35(%rip), %rsi	# 12098	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 12100	[c=4 l=3]  *movdi_internal/3
+	movq	%r8, 8(%rsp)	# 18549	[c=4 l=5]  *movdi_internal/5
+	movzbl	1004(%r13,%r8), %ecx	# 12095	[c=14 l=9]  *zero_extendqisi2/0
+	call	log_append@PLT	# 12102	[c=0 l=5]  *call
+	movq	8(%rsp), %r8	# 18550	[c=9 l=5]  *movdi_internal/3
+	movl	%r15d, %edx	# 12112	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 12114	[c=4 l=3]  *movdi_internal/3
+	cmpl	$63, %r15d	# 15850	[c=4 l=4]  *cmpsi_1/0
+	leaq	.LC30(%rip), %rax	# 17015	[c=1 l=7]  *movdi_internal/4
+	leaq	.LC29(%rip), %rsi	# 17014	[c=1 l=7]  *movdi_internal/4
+	movzbl	1004(%r13,%r8), %ecx	# 12104	[c=14 l=9]  *zero_extendqisi2/0
+	cmovne	%rax, %rsi	# 15851	[c=8 l=4]  *movdicc_noc/1
+	movl	%ecx, 8(%rsp)	# 18548	[c=4 l=4]  *movsi_internal/1
+	movl	%ecx, %r14d	# 19224	[c=4 l=3]  *movsi_internal/0
+	call	log_add_data_mov@PLT	# 12115	[c=0 l=5]  *call
+	movl	%r15d, %eax	# 17898	[c=4 l=3]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 12116	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 12117	[c=13 l=7]  *cmpsi_1/1
+	jb	.L1053	# 12118	[c=13 l=2]  *jcc
+	movl	%r15d, %eax	# 17900	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %eax	# 12120	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 16865	[c=5 l=5]  *andsi_1_zext
+	cmpb	$0, 1080(%r13,%rax)	# 12123	[c=14 l=9]  *cmpqi_ccno_1/1
+	jne	.L1054	# 12124	[c=13 l=6]  *jcc
+.L1053:
+	movq	1040(%r13), %rdx	# 12128	[c=9 l=7]  *movdi_internal/3
+	movslq	%r15d, %rax	# 12127	[c=4 l=3]  *extendsidi2_rex64/1
+	movb	%r14b, (%rdx,%rax)	# 12129	[c=4 l=4]  *movqi_internal/8
+.L1055:
+	movzwl	%r15w, %ecx	# 12140	[c=4 l=4]  *zero_extendhisi2/0
+	movl	$26, %edx	# 12142	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 12145	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 19959	[c=4 l=2]  *movdi_xor
+	leaq	.LC37(%rip), %rsi	# 12143	[c=1 l=7]  *movdi_internal/4
+	call	log_append@PLT	# 12147	[c=0 l=5]  *call
+	movw	%r15w, 1030(%r13)	# 12148	[c=4 l=8]  *movhi_internal/3
+.L1051:
+	movq	%r13, %rdi	# 12152	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 12151	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 12153	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 17902	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 17903	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 12155	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18750	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 12156	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 12158	[c=4 l=3]  *cmpdi_1/0
+	jb	.L344	# 12159	[c=13 l=6]  *jcc
+	movl	0(%r13), %ebx	# 12161	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 12166	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 12162	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 12164	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 12165	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 12167	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 12168	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 12169	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 12172	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 17904	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 12173	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 12176	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 12177	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 19958	[c=10 l=4]  *indirect_jump
+.L976:
+	movzbl	10(%rbx), %r15d	# 10833	[c=13 l=5]  zero_extendqidi2/0
+	xorl	%eax, %eax	# 20001	[c=4 l=2]  *movdi_xor
+	movq	%r13, %rdi	# 10840	[c=4 l=3]  *movdi_internal/3
+	movzwl	12(%rbx), %r14d	# 10832	[c=13 l=5]  *zero_extendhisi2/0
+	leaq	.LC35(%rip), %rsi	# 10838	[c=1 l=7]  *movdi_internal/4
+	movzbl	1004(%r13,%r15), %ecx	# 10835	[c=14 l=9]  *zero_extendqisi2/0
+	movq	%r15, %rdx	# 19209	[c=4 l=3]  *movdi_internal/3
+	call	log_append@PLT	# 10842	[c=0 l=5]  *call
+	movzbl	1004(%r13,%r15), %eax	# 10844	[c=14 l=9]  *zero_extendqisi2/0
+	testl	%r14d, %eax	# 10846	[c=4 l=3]  *testsi_1/0
+	jne	.L977	# 10847	[c=13 l=2]  *jcc
+	movl	0(%r13), %eax	# 17799	[c=5 l=4]  *movsi_internal/0
+	addq	$1, 48(%r13)	# 10855	[c=13 l=5]  *adddi_1/0
+	addl	$1, %eax	# 10850	[c=4 l=3]  *addsi_1/0
+	andl	992(%r13), %eax	# 10853	[c=13 l=7]  *andsi_1/1
+	movl	%eax, 0(%r13)	# 10854	[c=4 l=4]  *movsi_internal/1
+.L977:
+	movq	%r13, %rdi	# 10859	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 10858	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 10860	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 17800	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 17801	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 10862	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18768	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 10863	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 10865	[c=4 l=3]  *cmpdi_1/0
+	jb	.L344	# 10866	[c=13 l=6]  *jcc
+	movq	56(%r13), %rax	# 17802	[c=9 l=4]  *movdi_internal/3
+	cmpq	%rax, 48(%r13)	# 10869	[c=13 l=4]  *cmpdi_1/0
+	jnb	.L1566	# 10870	[c=13 l=6]  *jcc
+.L978:
+	movq	%r13, %rdi	# 10876	[c=4 l=3]  *movdi_internal/3
+	call	log_is_idle@PLT	# 10877	[c=10 l=5]  *call_value
+	testb	%al, %al	# 10879	[c=4 l=2]  *cmpqi_ccno_1/0
+	jne	.L1567	# 10880	[c=13 l=6]  *jcc
+.L979:
+	movl	0(%r13), %ebx	# 10891	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 10896	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 10892	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 10894	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 10895	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 10897	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 10898	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 10899	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 10902	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 17803	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 10903	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 10906	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 10907	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 20000	[c=10 l=4]  *indirect_jump
+.L980:
+	movzbl	10(%rbx), %r15d	# 10916	[c=13 l=5]  zero_extendqidi2/0
+	xorl	%eax, %eax	# 19999	[c=4 l=2]  *movdi_xor
+	movq	%r13, %rdi	# 10923	[c=4 l=3]  *movdi_internal/3
+	movzwl	12(%rbx), %r14d	# 10915	[c=13 l=5]  *zero_extendhisi2/0
+	leaq	.LC35(%rip), %rsi	# 10921	[c=1 l=7]  *movdi_internal/4
+	movzbl	1004(%r13,%r15), %ecx	# 10918	[c=14 l=9]  *zero_extendqisi2/0
+	movq	%r15, %rdx	# 19210	[c=4 l=3]  *movdi_internal/3
+	call	log_append@PLT	# 10925	[c=0 l=5]  *call
+	movzbl	1004(%r13,%r15), %eax	# 10927	[c=14 l=9]  *zero_extendqisi2/0
+	testl	%r14d, %eax	# 10929	[c=4 l=3]  *testsi_1/0
+	jne	.L981	# 10930	[c=13 l=2]  *jcc
+	movl	0(%r13), %eax	# 17805	[c=5 l=4]  *movsi_internal/0
+	addq	$2, 48(%r13)	# 10938	[c=13 l=5]  *adddi_1/0
+	addl	$2, %eax	# 10933	[c=4 l=3]  *addsi_1/0
+	andl	992(%r13), %eax	# 10936	[c=13 l=7]  *andsi_1/1
+	movl	%eax, 0(%r13)	# 10937	[c=4 l=4]  *movsi_internal/1
+.L981:
+	movq	%r13, %rdi	# 10942	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 10941	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 10943	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 17806	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 17807	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 10945	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18767	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 10946	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 10948	[c=4 l=3]  *cmpdi_1/0
+	jb	.L344	# 10949	[c=13 l=6]  *jcc
+	movq	56(%r13), %rax	# 17808	[c=9 l=4]  *movdi_internal/3
+	cmpq	%rax, 48(%r13)	# 10952	[c=13 l=4]  *cmpdi_1/0
+	jnb	.L1568	# 10953	[c=13 l=6]  *jcc
+.L982:
+	movq	%r13, %rdi	# 10959	[c=4 l=3]  *movdi_internal/3
+	call	log_is_idle@PLT	# 10960	[c=10 l=5]  *call_value
+	testb	%al, %al	# 10962	[c=4 l=2]  *cmpqi_ccno_1/0
+	jne	.L1569	# 10963	[c=13 l=6]  *jcc
+.L983:
+	movl	0(%r13), %ebx	# 10974	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 10979	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 10975	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 10977	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 10978	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 10980	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 10981	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 10982	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 10985	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 17809	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 10986	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 10989	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 10990	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 19998	[c=10 l=4]  *indirect_jump
+.L984:
+	movzbl	10(%rbx), %r15d	# 10999	[c=13 l=5]  zero_extendqidi2/0
+	xorl	%eax, %eax	# 19997	[c=4 l=2]  *movdi_xor
+	movq	%r13, %rdi	# 11006	[c=4 l=3]  *movdi_internal/3
+	movzwl	12(%rbx), %r14d	# 10998	[c=13 l=5]  *zero_extendhisi2/0
+	leaq	.LC35(%rip), %rsi	# 11004	[c=1 l=7]  *movdi_internal/4
+	movzbl	1004(%r13,%r15), %ecx	# 11001	[c=14 l=9]  *zero_extendqisi2/0
+	movq	%r15, %rdx	# 19211	[c=4 l=3]  *movdi_internal/3
+	call	log_append@PLT	# 11008	[c=0 l=5]  *call
+	movzbl	1004(%r13,%r15), %eax	# 11010	[c=14 l=9]  *zero_extendqisi2/0
+	testl	%r14d, %eax	# 11012	[c=4 l=3]  *testsi_1/0
+	je	.L985	# 11013	[c=13 l=2]  *jcc
+	movl	0(%r13), %eax	# 17811	[c=5 l=4]  *movsi_internal/0
+	addq	$1, 48(%r13)	# 11021	[c=13 l=5]  *adddi_1/0
+	addl	$1, %eax	# 11016	[c=4 l=3]  *addsi_1/0
+	andl	992(%r13), %eax	# 11019	[c=13 l=7]  *andsi_1/1
+	movl	%eax, 0(%r13)	# 11020	[c=4 l=4]  *movsi_internal/1
+.L985:
+	movq	%r13, %rdi	# 11025	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 11024	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 11026	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 17812	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 17813	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 11028	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18766	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 11029	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 11031	[c=4 l=3]  *cmpdi_1/0
+	jb	.L344	# 11032	[c=13 l=6]  *jcc
+	movq	56(%r13), %rax	# 17814	[c=9 l=4]  *movdi_internal/3
+	cmpq	%rax, 48(%r13)	# 11035	[c=13 l=4]  *cmpdi_1/0
+	jnb	.L1570	# 11036	[c=13 l=6]  *jcc
+.L986:
+	movq	%r13, %rdi	# 11042	[c=4 l=3]  *movdi_internal/3
+	call	log_is_idle@PLT	# 11043	[c=10 l=5]  *call_value
+	testb	%al, %al	# 11045	[c=4 l=2]  *cmpqi_ccno_1/0
+	jne	.L1571	# 11046	[c=13 l=6]  *jcc
+.L987:
+	movl	0(%r13), %ebx	# 11057	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 11062	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 11058	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 11060	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 11061	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 11063	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 11064	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 11065	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 11068	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 17815	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 11069	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 11072	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 11073	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 19996	[c=10 l=4]  *indirect_jump
+.L988:
+	movzbl	10(%rbx), %r15d	# 11082	[c=13 l=5]  zero_extendqidi2/0
+	xorl	%eax, %eax	# 19995	[c=4 l=2]  *movdi_xor
+	movq	%r13, %rdi	# 11089	[c=4 l=3]  *movdi_internal/3
+	movzwl	12(%rbx), %r14d	# 11081	[c=13 l=5]  *zero_extendhisi2/0
+	leaq	.LC35(%rip), %rsi	# 11087	[c=1 l=7]  *movdi_internal/4
+	movzbl	1004(%r13,%r15), %ecx	# 11084	[c=14 l=9]  *zero_extendqisi2/0
+	movq	%r15, %rdx	# 19212	[c=4 l=3]  *movdi_internal/3
+	call	log_append@PLT	# 11091	[c=0 l=5]  *call
+	movzbl	1004(%r13,%r15), %eax	# 11093	[c=14 l=9]  *zero_extendqisi2/0
+	testl	%r14d, %eax	# 11095	[c=4 l=3]  *testsi_1/0
+	je	.L989	# 11096	[c=13 l=2]  *jcc
+	movl	0(%r13), %eax	# 17817	[c=5 l=4]  *movsi_internal/0
+	addq	$2, 48(%r13)	# 11104	[c=13 l=5]  *adddi_1/0
+	addl	$2, %eax	# 11099	[c=4 l=3]  *addsi_1/0
+	andl	992(%r13), %eax	# 11102	[c=13 l=7]  *andsi_1/1
+	movl	%eax, 0(%r13)	# 11103	[c=4 l=4]  *movsi_internal/1
+.L989:
+	movq	%r13, %rdi	# 11108	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 11107	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 11109	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 17818	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 17819	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 11111	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18765	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 11112	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 11114	[c=4 l=3]  *cmpdi_1/0
+	jb	.L344	# 11115	[c=13 l=6]  *jcc
+	movq	56(%r13), %rax	# 17820	[c=9 l=4]  *movdi_internal/3
+	cmpq	%rax, 48(%r13)	# 11118	[c=13 l=4]  *cmpdi_1/0
+	jnb	.L1572	# 11119	[c=13 l=6]  *jcc
+.L990:
+	movq	%r13, %rdi	# 11125	[c=4 l=3]  *movdi_internal/3
+	call	log_is_idle@PLT	# 11126	[c=10 l=5]  *call_value
+	testb	%al, %al	# 11128	[c=4 l=2]  *cmpqi_ccno_1/0
+	jne	.L1573	# 11129	[c=13 l=6]  *jcc
+.L991:
+	movl	0(%r13), %ebx	# 11140	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 11145	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 11141	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 11143	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 11144	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 11146	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 11147	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 11148	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 11151	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 17821	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 11152	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 11155	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 11156	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 19994	[c=10 l=4]  *indirect_jump
+.L739:
+	movzwl	1034(%r13), %r14d	# 7140	[c=13 l=8]  *zero_extendhisi2/0
+	movl	$30, %edx	# 7142	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 7145	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 20084	[c=4 l=2]  *movdi_xor
+	leaq	.LC34(%rip), %rsi	# 7143	[c=1 l=7]  *movdi_internal/4
+	movl	%r14d, %ecx	# 7141	[c=4 l=3]  *movsi_internal/0
+	call	log_append@PLT	# 7147	[c=0 l=5]  *call
+	movl	992(%r13), %eax	# 7148	[c=9 l=7]  *movsi_internal/0
+	movq	1056(%r13), %rdx	# 7153	[c=9 l=7]  *movdi_internal/3
+	movq	%r13, %rdi	# 7160	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC36(%rip), %rsi	# 7158	[c=1 l=7]  *movdi_internal/4
+	leal	1(%rax,%rax), %eax	# 7150	[c=8 l=4]  *leasi
+	andl	%r14d, %eax	# 7151	[c=4 l=3]  *andsi_1/0
+	cltq	# 7152	[c=4 l=2]  *extendsidi2_rex64/0
+	movzbl	(%rdx,%rax), %ecx	# 7154	[c=13 l=4]  *zero_extendqisi2/0
+	xorl	%edx, %edx	# 20085	[c=4 l=2]  *movdi_xor
+	xorl	%eax, %eax	# 20086	[c=4 l=2]  *movdi_xor
+	movl	%ecx, %r14d	# 19175	[c=4 l=3]  *movsi_internal/0
+	call	log_append@PLT	# 7162	[c=0 l=5]  *call
+	movb	%r14b, 1004(%r13)	# 7163	[c=4 l=7]  *movqi_internal/8
+	movq	%r13, %rdi	# 7165	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 7164	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 7166	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 17519	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 17520	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 7168	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18815	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 7169	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 7171	[c=4 l=3]  *cmpdi_1/0
+	jb	.L344	# 7172	[c=13 l=6]  *jcc
+	movl	0(%r13), %ebx	# 7174	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 7179	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 7175	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 7177	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 7178	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 7180	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 7181	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 7182	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 7185	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 17521	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 7186	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 7189	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 7190	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 20083	[c=10 l=4]  *indirect_jump
+.L740:
+	movl	$30, %edx	# 7201	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 7204	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 20081	[c=4 l=2]  *movdi_xor
+	movzbl	10(%rbx), %r14d	# 7198	[c=13 l=5]  zero_extendqidi2/0
+	movzwl	1034(%r13), %r15d	# 7199	[c=13 l=8]  *zero_extendhisi2/0
+	leaq	.LC34(%rip), %rsi	# 7202	[c=1 l=7]  *movdi_internal/4
+	movl	%r15d, %ecx	# 7200	[c=4 l=3]  *movsi_internal/0
+	call	log_append@PLT	# 7206	[c=0 l=5]  *call
+	movl	992(%r13), %eax	# 7207	[c=9 l=7]  *movsi_internal/0
+	movq	1056(%r13), %rdx	# 7212	[c=9 l=7]  *movdi_internal/3
+	movq	%r13, %rdi	# 7219	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC36(%rip), %rsi	# 7217	[c=1 l=7]  *movdi_internal/4
+	leal	1(%rax,%rax), %eax	# 7209	[c=8 l=4]  *leasi
+	andl	%r15d, %eax	# 7210	[c=4 l=3]  *andsi_1/0
+	cltq	# 7211	[c=4 l=2]  *extendsidi2_rex64/0
+	movzbl	(%rdx,%rax), %ecx	# 7213	[c=13 l=4]  *zero_extendqisi2/0
+	movl	%r14d, %edx	# 7216	[c=4 l=3]  *movsi_internal/0
+	xorl	%eax, %eax	# 20082	[c=4 l=2]  *movdi_xor
+	movl	%ecx, %r15d	# 19176	[c=4 l=3]  *movsi_internal/0
+	call	log_append@PLT	# 7221	[c=0 l=5]  *call
+	movb	%r15b, 1004(%r13,%r14)	# 7223	[c=4 l=8]  *movqi_internal/8
+	movq	%r13, %rdi	# 7225	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 7224	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 7226	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 17523	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 17524	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 7228	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18814	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 7229	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 7231	[c=4 l=3]  *cmpdi_1/0
+	jb	.L344	# 7232	[c=13 l=6]  *jcc
+	movl	0(%r13), %ebx	# 7234	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 7239	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 7235	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 7237	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 7238	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 7240	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 7241	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 7242	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 7245	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 17525	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 7246	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 7249	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 7250	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 20080	[c=10 l=4]  *indirect_jump
+.L828:
+	movzwl	12(%rbx), %eax	# 8846	[c=9 l=4]  *movhi_internal/2
+	movl	5176(%r13), %ecx	# 8847	[c=9 l=7]  *movsi_internal/0
+	movl	5180(%r13), %r14d	# 8848	[c=9 l=7]  *movsi_internal/0
+	movw	%ax, 8(%rsp)	# 17635	[c=4 l=5]  *movhi_internal/3
+	movl	$61, %eax	# 8849	[c=4 l=5]  *movsi_internal/0
+	subl	%ecx, %eax	# 8850	[c=4 l=2]  *subsi_1/0
+	cmpl	%r14d, %eax	# 8851	[c=4 l=3]  *cmpsi_1/0
+	jb	.L829	# 8852	[c=13 l=6]  *jcc
+	cmpb	$1, 1081(%r13)	# 8856	[c=13 l=8]  *cmpqi_1/0
+	ja	.L1574	# 8857	[c=13 l=6]  *jcc
+	movq	1040(%r13), %rax	# 14329	[c=9 l=7]  *movdi_internal/3
+	movzbl	61(%rax), %r15d	# 14330	[c=13 l=5]  *zero_extendqisi2/0
+.L831:
+	movzbl	62(%rax), %eax	# 8894	[c=13 l=4]  *zero_extendqisi2/0
+.L833:
+	sall	$8, %eax	# 8897	[c=4 l=3]  *ashlsi3_1/0
+	movl	$61, %edx	# 8900	[c=4 l=5]  *movsi_internal/0
+	leaq	.LC31(%rip), %rsi	# 8901	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 8903	[c=4 l=3]  *movdi_internal/3
+	orl	%eax, %r15d	# 8898	[c=4 l=3]  *iorsi_1/0
+	movl	%r15d, %ecx	# 8899	[c=4 l=3]  *movsi_internal/0
+	call	log_add_data_mov@PLT	# 8904	[c=0 l=5]  *call
+	movl	996(%r13), %edx	# 8906	[c=9 l=7]  *movsi_internal/0
+	movzbl	840(%r13), %eax	# 8908	[c=13 l=8]  *zero_extendqisi2/0
+	leal	1(%rdx,%rax), %eax	# 8909	[c=5 l=4]  *leasi
+	cmpl	%eax, %r15d	# 8910	[c=4 l=3]  *cmpsi_1/0
+	jb	.L1382	# 8911	[c=13 l=6]  *jcc
+	cmpl	$63, %r15d	# 15598	[c=4 l=4]  *cmpsi_1/0
+	movl	0(%r13), %r14d	# 8919	[c=5 l=4]  *movsi_internal/0
+	leal	-1(%r15), %r9d	# 18792	[c=4 l=4]  *leasi
+	movl	%r15d, %edx	# 8928	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC30(%rip), %rax	# 16973	[c=1 l=7]  *movdi_internal/4
+	leaq	.LC29(%rip), %rsi	# 16972	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 8930	[c=4 l=3]  *movdi_internal/3
+	movl	%r9d, 16(%rsp)	# 18432	[c=4 l=5]  *movsi_internal/1
+	cmovne	%rax, %rsi	# 15599	[c=8 l=4]  *movdicc_noc/1
+	movzbl	%r14b, %ecx	# 8921	[c=4 l=4]  *zero_extendqisi2/0
+	call	log_add_data_mov@PLT	# 8931	[c=0 l=5]  *call
+	movl	%r15d, %eax	# 17636	[c=4 l=3]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 8932	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 8933	[c=13 l=7]  *cmpsi_1/1
+	movl	16(%rsp), %r9d	# 18433	[c=9 l=5]  *movsi_internal/0
+	jb	.L836	# 8934	[c=13 l=2]  *jcc
+	movl	%r15d, %eax	# 17638	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %eax	# 8936	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 16875	[c=5 l=5]  *andsi_1_zext
+	cmpb	$0, 1080(%r13,%rax)	# 8939	[c=14 l=9]  *cmpqi_ccno_1/1
+	jne	.L837	# 8940	[c=13 l=6]  *jcc
+.L836:
+	movq	1040(%r13), %rdx	# 8944	[c=9 l=7]  *movdi_internal/3
+	movslq	%r15d, %rax	# 8943	[c=4 l=3]  *extendsidi2_rex64/1
+	movb	%r14b, (%rdx,%rax)	# 8945	[c=4 l=4]  *movqi_internal/8
+.L838:
+	movl	0(%r13), %ecx	# 8956	[c=5 l=4]  *movsi_internal/0
+	movl	%r9d, %edx	# 8966	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 8968	[c=4 l=3]  *movdi_internal/3
+	movl	%r9d, 24(%rsp)	# 18436	[c=4 l=5]  *movsi_internal/1
+	leaq	.LC29(%rip), %rsi	# 16974	[c=1 l=7]  *movdi_internal/4
+	leal	-2(%r15), %r14d	# 18791	[c=4 l=4]  *leasi
+	movl	%ecx, %eax	# 17640	[c=4 l=2]  *movsi_internal/0
+	movzbl	%ch, %ecx	# 8959	[c=4 l=3]  *extzvsi
+	shrl	$8, %eax	# 8957	[c=4 l=3]  *lshrsi3_1/0
+	cmpl	$63, %r9d	# 15610	[c=4 l=4]  *cmpsi_1/0
+	movl	%eax, 16(%rsp)	# 17641	[c=4 l=4]  *movsi_internal/1
+	leaq	.LC30(%rip), %rax	# 16975	[c=1 l=7]  *movdi_internal/4
+	cmovne	%rax, %rsi	# 15611	[c=8 l=4]  *movdicc_noc/1
+	call	log_add_data_mov@PLT	# 8969	[c=0 l=5]  *call
+	movslq	24(%rsp), %r9	# 18437	[c=13 l=5]  *extendsidi2_rex64/1
+	movl	%r9d, %eax	# 17642	[c=4 l=3]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 8970	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 8971	[c=13 l=7]  *cmpsi_1/1
+	jb	.L840	# 8972	[c=13 l=2]  *jcc
+	movl	%r9d, %eax	# 17644	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %eax	# 8974	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 16874	[c=5 l=5]  *andsi_1_zext
+	cmpb	$0, 1080(%r13,%rax)	# 8977	[c=14 l=9]  *cmpqi_ccno_1/1
+	jne	.L841	# 8978	[c=13 l=6]  *jcc
+.L840:
+	movq	1040(%r13), %rax	# 8982	[c=9 l=7]  *movdi_internal/3
+	movzbl	16(%rsp), %edi	# 17646	[c=9 l=5]  *movqi_internal/4
+	movb	%dil, (%rax,%r9)	# 8983	[c=4 l=4]  *movqi_internal/8
+.L842:
+	cmpb	$0, 840(%r13)	# 8994	[c=13 l=8]  *cmpqi_ccno_1/1
+	je	.L843	# 8995	[c=13 l=2]  *jcc
+	movl	0(%r13), %eax	# 17647	[c=5 l=4]  *movsi_internal/0
+	subl	$3, %r15d	# 8999	[c=4 l=4]  *addsi_1/0
+	movq	%r13, %rdi	# 9009	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC30(%rip), %rdx	# 16977	[c=1 l=7]  *movdi_internal/4
+	leaq	.LC29(%rip), %rsi	# 16976	[c=1 l=7]  *movdi_internal/4
+	shrl	$16, %eax	# 8998	[c=4 l=3]  *lshrsi3_1/0
+	cmpl	$63, %r14d	# 15622	[c=4 l=4]  *cmpsi_1/0
+	cmovne	%rdx, %rsi	# 15623	[c=8 l=4]  *movdicc_noc/1
+	movzbl	%al, %ecx	# 9000	[c=4 l=3]  *zero_extendqisi2/0
+	movl	%r14d, %edx	# 9007	[c=4 l=3]  *movsi_internal/0
+	movl	%eax, 16(%rsp)	# 18438	[c=4 l=4]  *movsi_internal/1
+	call	log_add_data_mov@PLT	# 9010	[c=0 l=5]  *call
+	movl	%r14d, %edx	# 17649	[c=4 l=3]  *movsi_internal/0
+	subl	5176(%r13), %edx	# 9011	[c=13 l=7]  *subsi_1/1
+	movl	16(%rsp), %eax	# 18439	[c=9 l=4]  *movsi_internal/0
+	cmpl	5180(%r13), %edx	# 9012	[c=13 l=7]  *cmpsi_1/1
+	jb	.L845	# 9013	[c=13 l=2]  *jcc
+	movl	%r14d, %edx	# 17651	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %edx	# 9015	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %edx	# 16873	[c=5 l=6]  *andsi_1_zext
+	cmpb	$0, 1080(%r13,%rdx)	# 9018	[c=14 l=9]  *cmpqi_ccno_1/1
+	jne	.L846	# 9019	[c=13 l=6]  *jcc
+.L845:
+	movq	1040(%r13), %rdx	# 9023	[c=9 l=7]  *movdi_internal/3
+	movslq	%r14d, %r14	# 9022	[c=4 l=3]  *extendsidi2_rex64/1
+	movb	%al, (%rdx,%r14)	# 9024	[c=4 l=4]  *movqi_internal/8
+.L847:
+	movl	%r15d, %r14d	# 72	[c=4 l=3]  *movsi_internal/0
+.L843:
+	movzwl	%r14w, %r15d	# 9039	[c=4 l=4]  *zero_extendhisi2/0
+	movl	$61, %edx	# 9041	[c=4 l=5]  *movsi_internal/0
+	leaq	.LC32(%rip), %rsi	# 9042	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 9044	[c=4 l=3]  *movdi_internal/3
+	movl	%r15d, %ecx	# 9040	[c=4 l=3]  *movsi_internal/0
+	call	log_add_data_mov@PLT	# 9045	[c=0 l=5]  *call
+	movl	$61, %edx	# 9046	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r13), %edx	# 9047	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %edx	# 9048	[c=13 l=7]  *cmpsi_1/1
+	jb	.L848	# 9049	[c=13 l=2]  *jcc
+	cmpb	$1, 1081(%r13)	# 9053	[c=13 l=8]  *cmpqi_1/0
+	ja	.L1575	# 9054	[c=13 l=6]  *jcc
+.L848:
+	movq	1040(%r13), %rdx	# 9065	[c=9 l=7]  *movdi_internal/3
+	movb	%r14b, 61(%rdx)	# 9066	[c=4 l=4]  *movqi_internal/8
+.L849:
+	movl	%r15d, %eax	# 17653	[c=4 l=3]  *movsi_internal/0
+	movl	$62, %edx	# 9070	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r13), %edx	# 9071	[c=13 l=7]  *subsi_1/1
+	sarl	$8, %eax	# 9069	[c=4 l=3]  *ashrsi3_1/0
+	cmpl	5180(%r13), %edx	# 9072	[c=13 l=7]  *cmpsi_1/1
+	jb	.L850	# 9073	[c=13 l=2]  *jcc
+	cmpb	$1, 1081(%r13)	# 9077	[c=13 l=8]  *cmpqi_1/0
+	ja	.L1576	# 9078	[c=13 l=6]  *jcc
+.L850:
+	movq	1040(%r13), %rdx	# 9088	[c=9 l=7]  *movdi_internal/3
+	movb	%al, 62(%rdx)	# 9089	[c=4 l=3]  *movqi_internal/8
+.L851:
+	movswl	8(%rsp), %eax	# 9092	[c=13 l=5]  extendhisi2/1
+	addl	0(%r13), %eax	# 9094	[c=9 l=4]  *addsi_1/1
+	movq	%r13, %rdi	# 9102	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 9101	[c=4 l=3]  *movdi_internal/3
+	andl	992(%r13), %eax	# 9097	[c=13 l=7]  *andsi_1/1
+	movl	%eax, 0(%r13)	# 9098	[c=4 l=4]  *movsi_internal/1
+	movzbl	840(%r13), %eax	# 9099	[c=13 l=8]  zero_extendqidi2/0
+	addq	%rax, 48(%r13)	# 9100	[c=13 l=4]  *adddi_1/0
+	call	log_dump_line@PLT	# 9103	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 17656	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 17657	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 9105	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18790	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 9106	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 9108	[c=4 l=3]  *cmpdi_1/0
+	jb	.L344	# 9109	[c=13 l=6]  *jcc
+	movq	56(%r13), %rax	# 17658	[c=9 l=4]  *movdi_internal/3
+	cmpq	%rax, 48(%r13)	# 9112	[c=13 l=4]  *cmpdi_1/0
+	jnb	.L1577	# 9113	[c=13 l=6]  *jcc
+.L852:
+	movq	%r13, %rdi	# 9119	[c=4 l=3]  *movdi_internal/3
+	call	log_is_idle@PLT	# 9120	[c=10 l=5]  *call_value
+	testb	%al, %al	# 9122	[c=4 l=2]  *cmpqi_ccno_1/0
+	jne	.L1578	# 9123	[c=13 l=6]  *jcc
+.L853:
+	movl	0(%r13), %ebx	# 9134	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 9139	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 9135	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 9137	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 9138	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 9140	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 9141	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 9142	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 9145	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 17659	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 9146	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 9149	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 9150	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 20026	[c=10 l=4]  *indirect_jump
+.L854:
+	movl	5176(%r13), %r15d	# 9158	[c=9 l=7]  *movsi_internal/0
+	movl	$61, %eax	# 9160	[c=4 l=5]  *movsi_internal/0
+	movl	5180(%r13), %r14d	# 9159	[c=9 l=7]  *movsi_internal/0
+	subl	%r15d, %eax	# 9161	[c=4 l=3]  *subsi_1/0
+	cmpl	%r14d, %eax	# 9162	[c=4 l=3]  *cmpsi_1/0
+	jb	.L855	# 9163	[c=13 l=6]  *jcc
+	cmpb	$1, 1081(%r13)	# 9167	[c=13 l=8]  *cmpqi_1/0
+	ja	.L1579	# 9168	[c=13 l=6]  *jcc
+	movq	1040(%r13), %rax	# 14335	[c=9 l=7]  *movdi_internal/3
+	movzbl	61(%rax), %edx	# 14336	[c=13 l=4]  *zero_extendqisi2/0
+.L857:
+	movzbl	62(%rax), %eax	# 9205	[c=13 l=4]  *zero_extendqisi2/0
+.L859:
+	sall	$8, %eax	# 9208	[c=4 l=3]  *ashlsi3_1/0
+	leaq	.LC31(%rip), %rsi	# 9212	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 9214	[c=4 l=3]  *movdi_internal/3
+	orl	%edx, %eax	# 9209	[c=4 l=2]  *iorsi_1/0
+	movl	$61, %edx	# 9211	[c=4 l=5]  *movsi_internal/0
+	movl	%eax, %ecx	# 9210	[c=4 l=2]  *movsi_internal/0
+	movl	%eax, %r15d	# 17662	[c=4 l=3]  *movsi_internal/0
+	call	log_add_data_mov@PLT	# 9215	[c=0 l=5]  *call
+	xorl	%r8d, %r8d	# 20025	[c=4 l=3]  *movdi_xor
+	cmpb	$0, 840(%r13)	# 9216	[c=13 l=8]  *cmpqi_ccno_1/1
+	je	.L860	# 9217	[c=13 l=2]  *jcc
+	addl	$1, %r15d	# 9219	[c=4 l=4]  *addsi_1/0
+	movl	%r15d, %eax	# 17663	[c=4 l=3]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 9220	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 9221	[c=13 l=7]  *cmpsi_1/1
+	jb	.L861	# 9222	[c=13 l=2]  *jcc
+	movl	%r15d, %eax	# 17665	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %eax	# 9224	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 16872	[c=5 l=5]  *andsi_1_zext
+	cmpb	$0, 1080(%r13,%rax)	# 9227	[c=14 l=9]  *cmpqi_ccno_1/1
+	jne	.L862	# 9228	[c=13 l=6]  *jcc
+.L861:
+	movq	1040(%r13), %rdx	# 9232	[c=9 l=7]  *movdi_internal/3
+	movslq	%r15d, %rax	# 9231	[c=4 l=3]  *extendsidi2_rex64/1
+	movzbl	(%rdx,%rax), %r14d	# 9233	[c=13 l=5]  *zero_extendqisi2/0
+.L863:
+	cmpl	$63, %r15d	# 15634	[c=4 l=4]  *cmpsi_1/0
+	movl	%r14d, %ecx	# 9249	[c=4 l=3]  *movsi_internal/0
+	movl	%r15d, %edx	# 9250	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 9252	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC25(%rip), %rax	# 16979	[c=1 l=7]  *movdi_internal/4
+	leaq	.LC33(%rip), %rsi	# 16978	[c=1 l=7]  *movdi_internal/4
+	cmovne	%rax, %rsi	# 15635	[c=8 l=4]  *movdicc_noc/1
+	call	log_add_data_mov@PLT	# 9253	[c=0 l=5]  *call
+	movl	%r14d, %r8d	# 17667	[c=4 l=3]  *movsi_internal/0
+	sall	$16, %r8d	# 9254	[c=4 l=4]  *ashlsi3_1/0
+.L860:
+	leal	1(%r15), %edx	# 18789	[c=4 l=4]  *leasi
+	movl	%edx, %eax	# 17669	[c=4 l=2]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 9258	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 9259	[c=13 l=7]  *cmpsi_1/1
+	jb	.L865	# 9260	[c=13 l=2]  *jcc
+	movl	%edx, %eax	# 17671	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %eax	# 9262	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 16871	[c=5 l=5]  *andsi_1_zext
+	cmpb	$0, 1080(%r13,%rax)	# 9265	[c=14 l=9]  *cmpqi_ccno_1/1
+	jne	.L866	# 9266	[c=13 l=6]  *jcc
+.L865:
+	movq	1040(%r13), %rcx	# 9270	[c=9 l=7]  *movdi_internal/3
+	movslq	%edx, %rax	# 9269	[c=4 l=3]  *extendsidi2_rex64/1
+	movzbl	(%rcx,%rax), %r14d	# 9271	[c=13 l=5]  *zero_extendqisi2/0
+.L867:
+	cmpl	$63, %edx	# 15646	[c=4 l=3]  *cmpsi_1/0
+	leaq	.LC25(%rip), %rax	# 16981	[c=1 l=7]  *movdi_internal/4
+	movl	%r14d, %ecx	# 9287	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 9290	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC33(%rip), %rsi	# 16980	[c=1 l=7]  *movdi_internal/4
+	movl	%r8d, 8(%rsp)	# 18446	[c=4 l=5]  *movsi_internal/1
+	cmovne	%rax, %rsi	# 15647	[c=8 l=4]  *movdicc_noc/1
+	sall	$8, %r14d	# 9292	[c=4 l=4]  *ashlsi3_1/0
+	call	log_add_data_mov@PLT	# 9291	[c=0 l=5]  *call
+	movl	8(%rsp), %r8d	# 18447	[c=9 l=5]  *movsi_internal/0
+	orl	%r8d, %r14d	# 9293	[c=4 l=3]  *iorsi_1/0
+	leal	2(%r15), %r8d	# 18788	[c=4 l=4]  *leasi
+	movl	%r8d, %eax	# 17673	[c=4 l=3]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 9295	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 9296	[c=13 l=7]  *cmpsi_1/1
+	jb	.L869	# 9297	[c=13 l=2]  *jcc
+	movl	%r8d, %eax	# 17675	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %eax	# 9299	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 16870	[c=5 l=5]  *andsi_1_zext
+	cmpb	$0, 1080(%r13,%rax)	# 9302	[c=14 l=9]  *cmpqi_ccno_1/1
+	jne	.L870	# 9303	[c=13 l=6]  *jcc
+.L869:
+	movq	1040(%r13), %rdx	# 9307	[c=9 l=7]  *movdi_internal/3
+	movslq	%r8d, %rax	# 9306	[c=4 l=3]  *extendsidi2_rex64/1
+	movzbl	(%rdx,%rax), %r15d	# 9308	[c=13 l=5]  *zero_extendqisi2/0
+.L871:
+	cmpl	$63, %r8d	# 15658	[c=4 l=4]  *cmpsi_1/0
+	movl	%r8d, %edx	# 9325	[c=4 l=3]  *movsi_internal/0
+	movl	%r15d, %ecx	# 9324	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 9327	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC25(%rip), %rax	# 16983	[c=1 l=7]  *movdi_internal/4
+	leaq	.LC33(%rip), %rsi	# 16982	[c=1 l=7]  *movdi_internal/4
+	movl	%r8d, 8(%rsp)	# 18450	[c=4 l=5]  *movsi_internal/1
+	cmovne	%rax, %rsi	# 15659	[c=8 l=4]  *movdicc_noc/1
+	orl	%r15d, %r14d	# 9329	[c=4 l=3]  *iorsi_1/0
+	call	log_add_data_mov@PLT	# 9328	[c=0 l=5]  *call
+	cmpl	%r14d, 992(%r13)	# 9330	[c=13 l=7]  *cmpsi_1/0
+	movl	8(%rsp), %r8d	# 18451	[c=9 l=5]  *movsi_internal/0
+	jb	.L1381	# 9331	[c=13 l=6]  *jcc
+	movzwl	%r8w, %r15d	# 9339	[c=4 l=4]  *zero_extendhisi2/0
+	movl	$61, %edx	# 9341	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 9344	[c=4 l=3]  *movdi_internal/3
+	movl	%r8d, 8(%rsp)	# 18452	[c=4 l=5]  *movsi_internal/1
+	movl	%r15d, %ecx	# 9340	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC32(%rip), %rsi	# 9342	[c=1 l=7]  *movdi_internal/4
+	call	log_add_data_mov@PLT	# 9345	[c=0 l=5]  *call
+	movl	$61, %eax	# 9346	[c=4 l=5]  *movsi_internal/0
+	movl	8(%rsp), %r8d	# 18453	[c=9 l=5]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 9347	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 9348	[c=13 l=7]  *cmpsi_1/1
+	jb	.L874	# 9349	[c=13 l=2]  *jcc
+	cmpb	$1, 1081(%r13)	# 9353	[c=13 l=8]  *cmpqi_1/0
+	ja	.L1580	# 9354	[c=13 l=6]  *jcc
+.L874:
+	movq	1040(%r13), %rax	# 9365	[c=9 l=7]  *movdi_internal/3
+	movb	%r8b, 61(%rax)	# 9366	[c=4 l=4]  *movqi_internal/8
+.L875:
+	movl	$62, %eax	# 9370	[c=4 l=5]  *movsi_internal/0
+	sarl	$8, %r15d	# 9369	[c=4 l=4]  *ashrsi3_1/0
+	subl	5176(%r13), %eax	# 9371	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 9372	[c=13 l=7]  *cmpsi_1/1
+	jb	.L876	# 9373	[c=13 l=2]  *jcc
+	cmpb	$1, 1081(%r13)	# 9377	[c=13 l=8]  *cmpqi_1/0
+	ja	.L1581	# 9378	[c=13 l=6]  *jcc
+.L876:
+	movq	1040(%r13), %rax	# 9388	[c=9 l=7]  *movdi_internal/3
+	movb	%r15b, 62(%rax)	# 9389	[c=4 l=4]  *movqi_internal/8
+.L877:
+	movzbl	840(%r13), %eax	# 9393	[c=13 l=8]  zero_extendqidi2/0
+	addq	%rax, 48(%r13)	# 9394	[c=13 l=4]  *adddi_1/0
+	movq	%r13, %rdi	# 9396	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 9395	[c=4 l=3]  *movdi_internal/3
+	movl	%r14d, 0(%r13)	# 9392	[c=4 l=4]  *movsi_internal/1
+	call	log_dump_line@PLT	# 9397	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 17677	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 17678	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 9399	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18787	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 9400	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 9402	[c=4 l=3]  *cmpdi_1/0
+	jb	.L344	# 9403	[c=13 l=6]  *jcc
+	movq	56(%r13), %rax	# 17679	[c=9 l=4]  *movdi_internal/3
+	cmpq	%rax, 48(%r13)	# 9406	[c=13 l=4]  *cmpdi_1/0
+	jnb	.L1582	# 9407	[c=13 l=6]  *jcc
+.L878:
+	movq	%r13, %rdi	# 9413	[c=4 l=3]  *movdi_internal/3
+	call	log_is_idle@PLT	# 9414	[c=10 l=5]  *call_value
+	testb	%al, %al	# 9416	[c=4 l=2]  *cmpqi_ccno_1/0
+	jne	.L1583	# 9417	[c=13 l=6]  *jcc
+.L879:
+	movl	0(%r13), %ebx	# 9428	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 9433	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 9429	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 9431	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 9432	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 9434	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 9435	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 9436	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 9439	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 17680	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 9440	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 9443	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 9444	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 20024	[c=10 l=4]  *indirect_jump
+.L711:
+	cmpb	$0, 844(%r13)	# 6685	[c=13 l=8]  *cmpqi_ccno_1/1
+	movzbl	10(%rbx), %r14d	# 6684	[c=13 l=5]  zero_extendqidi2/0
+	jne	.L1584	# 6686	[c=13 l=6]  *jcc
+	movzwl	1032(%r13), %r15d	# 6699	[c=13 l=8]  *zero_extendhisi2/0
+	xorl	%eax, %eax	# 20109	[c=4 l=2]  *movdi_xor
+	movl	$28, %edx	# 6701	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 6704	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC34(%rip), %rsi	# 6702	[c=1 l=7]  *movdi_internal/4
+	movl	%r15d, %ecx	# 6700	[c=4 l=3]  *movsi_internal/0
+	subl	$1, %r15d	# 6707	[c=4 l=4]  *addsi_1/0
+	call	log_append@PLT	# 6706	[c=0 l=5]  *call
+	movl	%r15d, %eax	# 17483	[c=4 l=3]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 6708	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 6709	[c=13 l=7]  *cmpsi_1/1
+	jb	.L714	# 6710	[c=13 l=2]  *jcc
+	movl	%r15d, %eax	# 17485	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %eax	# 6712	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 16879	[c=5 l=5]  *andsi_1_zext
+	cmpb	$0, 1080(%r13,%rax)	# 6715	[c=14 l=9]  *cmpqi_ccno_1/1
+	jne	.L715	# 6716	[c=13 l=6]  *jcc
+.L714:
+	movq	1040(%r13), %rdx	# 6720	[c=9 l=7]  *movdi_internal/3
+	movslq	%r15d, %rax	# 6719	[c=4 l=3]  *extendsidi2_rex64/1
+	movzbl	(%rdx,%rax), %eax	# 6721	[c=13 l=4]  *zero_extendqisi2/0
+	movl	%eax, 8(%rsp)	# 17487	[c=4 l=4]  *movsi_internal/1
+.L716:
+	cmpl	$63, %r15d	# 15514	[c=4 l=4]  *cmpsi_1/0
+	movl	8(%rsp), %ecx	# 6737	[c=9 l=4]  *movsi_internal/0
+	movl	%r15d, %edx	# 6738	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 6740	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC25(%rip), %rax	# 16959	[c=1 l=7]  *movdi_internal/4
+	leaq	.LC33(%rip), %rsi	# 16958	[c=1 l=7]  *movdi_internal/4
+	cmovne	%rax, %rsi	# 15515	[c=8 l=4]  *movdicc_noc/1
+	call	log_add_data_mov@PLT	# 6741	[c=0 l=5]  *call
+	movzbl	8(%rsp), %ecx	# 6742	[c=13 l=5]  *zero_extendqisi2/0
+	movl	%r14d, %edx	# 6744	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 6747	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC36(%rip), %rsi	# 6745	[c=1 l=7]  *movdi_internal/4
+	xorl	%eax, %eax	# 20107	[c=4 l=2]  *movdi_xor
+	call	log_append@PLT	# 6749	[c=0 l=5]  *call
+	movzbl	8(%rsp), %eax	# 17488	[c=9 l=5]  *movqi_internal/4
+	movzwl	%r15w, %ecx	# 6752	[c=4 l=4]  *zero_extendhisi2/0
+	movl	$28, %edx	# 6754	[c=4 l=5]  *movsi_internal/0
+	leaq	.LC37(%rip), %rsi	# 6755	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 6757	[c=4 l=3]  *movdi_internal/3
+	movb	%al, 1004(%r13,%r14)	# 6751	[c=4 l=8]  *movqi_internal/8
+	xorl	%eax, %eax	# 20108	[c=4 l=2]  *movdi_xor
+	call	log_append@PLT	# 6759	[c=0 l=5]  *call
+	movw	%r15w, 1032(%r13)	# 6760	[c=4 l=8]  *movhi_internal/3
+.L713:
+	movq	%r13, %rdi	# 6764	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 6763	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 6765	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 17489	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 17490	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 6767	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18821	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 6768	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 6770	[c=4 l=3]  *cmpdi_1/0
+	jb	.L344	# 6771	[c=13 l=6]  *jcc
+	movl	0(%r13), %ebx	# 6773	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 6778	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 6774	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 6776	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 6777	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 6779	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 6780	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 6781	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 6784	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 17491	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 6785	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 6788	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 6789	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 20106	[c=10 l=4]  *indirect_jump
+.L718:
+	cmpb	$0, 844(%r13)	# 6798	[c=13 l=8]  *cmpqi_ccno_1/1
+	movzbl	10(%rbx), %r14d	# 6797	[c=13 l=5]  zero_extendqidi2/0
+	jne	.L1585	# 6799	[c=13 l=6]  *jcc
+	movzwl	1032(%r13), %r8d	# 6812	[c=13 l=8]  *zero_extendhisi2/0
+	xorl	%eax, %eax	# 20103	[c=4 l=2]  *movdi_xor
+	movl	$28, %edx	# 6815	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 6818	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC34(%rip), %rsi	# 6816	[c=1 l=7]  *movdi_internal/4
+	movl	%r8d, %ecx	# 6814	[c=4 l=3]  *movsi_internal/0
+	movl	%r8d, 8(%rsp)	# 18361	[c=4 l=5]  *movsi_internal/1
+	movl	%r8d, %r15d	# 19173	[c=4 l=3]  *movsi_internal/0
+	call	log_append@PLT	# 6820	[c=0 l=5]  *call
+	movl	8(%rsp), %r8d	# 18362	[c=9 l=5]  *movsi_internal/0
+	movl	%r8d, %eax	# 17493	[c=4 l=3]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 6822	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 6823	[c=13 l=7]  *cmpsi_1/1
+	jb	.L721	# 6824	[c=13 l=2]  *jcc
+	movl	%r8d, %eax	# 17495	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %eax	# 6826	[c=4 l=3]  *ashrsi3_1/0
+	cltq	# 6827	[c=4 l=2]  *extendsidi2_rex64/0
+	cmpb	$0, 1080(%r13,%rax)	# 6828	[c=14 l=9]  *cmpqi_ccno_1/1
+	jne	.L722	# 6829	[c=13 l=6]  *jcc
+.L721:
+	movq	1040(%r13), %rdx	# 6833	[c=9 l=7]  *movdi_internal/3
+	movzwl	%r15w, %eax	# 6832	[c=4 l=4]  zero_extendhidi2/0
+	movzbl	(%rdx,%rax), %r15d	# 6834	[c=13 l=5]  *zero_extendqisi2/0
+.L723:
+	cmpl	$63, %r8d	# 15526	[c=4 l=4]  *cmpsi_1/0
+	movl	%r8d, %edx	# 6851	[c=4 l=3]  *movsi_internal/0
+	movl	%r15d, %ecx	# 6850	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 6853	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC25(%rip), %rax	# 16961	[c=1 l=7]  *movdi_internal/4
+	leaq	.LC33(%rip), %rsi	# 16960	[c=1 l=7]  *movdi_internal/4
+	movl	%r8d, 8(%rsp)	# 18365	[c=4 l=5]  *movsi_internal/1
+	cmovne	%rax, %rsi	# 15527	[c=8 l=4]  *movdicc_noc/1
+	call	log_add_data_mov@PLT	# 6854	[c=0 l=5]  *call
+	movl	%r14d, %edx	# 6857	[c=4 l=3]  *movsi_internal/0
+	movzbl	%r15b, %ecx	# 6855	[c=4 l=4]  *zero_extendqisi2/0
+	movq	%r13, %rdi	# 6860	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC36(%rip), %rsi	# 6858	[c=1 l=7]  *movdi_internal/4
+	xorl	%eax, %eax	# 20101	[c=4 l=2]  *movdi_xor
+	call	log_append@PLT	# 6862	[c=0 l=5]  *call
+	movl	8(%rsp), %r8d	# 18366	[c=9 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 6872	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 20102	[c=4 l=2]  *movdi_xor
+	movb	%r15b, 1004(%r13,%r14)	# 6864	[c=4 l=8]  *movqi_internal/8
+	movl	$28, %edx	# 6869	[c=4 l=5]  *movsi_internal/0
+	leaq	.LC37(%rip), %rsi	# 6870	[c=1 l=7]  *movdi_internal/4
+	subq	$1, 48(%r13)	# 6865	[c=13 l=5]  *adddi_1/0
+	leal	1(%r8), %r14d	# 18820	[c=4 l=4]  *leasi
+	movzwl	%r14w, %ecx	# 6867	[c=4 l=4]  *zero_extendhisi2/0
+	call	log_append@PLT	# 6874	[c=0 l=5]  *call
+	movw	%r14w, 1032(%r13)	# 6875	[c=4 l=8]  *movhi_internal/3
+.L720:
+	movq	%r13, %rdi	# 6879	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 6878	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 6880	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 17497	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 17498	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 6882	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18819	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 6883	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 6885	[c=4 l=3]  *cmpdi_1/0
+	jb	.L344	# 6886	[c=13 l=6]  *jcc
+	movl	0(%r13), %ebx	# 6888	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 6893	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 6889	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 6891	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 6892	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 6894	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 6895	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 6896	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 6899	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 17499	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 6900	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 6903	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 6904	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 20100	[c=10 l=4]  *indirect_jump
+.L787:
+	movzbl	10(%rbx), %eax	# 8246	[c=13 l=4]  *zero_extendqisi2/0
+	movzwl	12(%rbx), %r14d	# 8245	[c=13 l=5]  *zero_extendhisi2/0
+	leaq	.LC61(%rip), %rsi	# 8248	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 8250	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, %r15d	# 17597	[c=4 l=3]  *movsi_internal/0
+	movl	%r14d, %edx	# 8247	[c=4 l=3]  *movsi_internal/0
+	xorl	%eax, %eax	# 20034	[c=4 l=2]  *movdi_xor
+	call	log_append@PLT	# 8252	[c=0 l=5]  *call
+	movslq	%r15d, %r15	# 18417	[c=4 l=3]  *extendsidi2_rex64/1
+	movq	%r13, %rdi	# 8259	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 20035	[c=4 l=2]  *movdi_xor
+	movl	%r15d, %edx	# 8256	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC35(%rip), %rsi	# 8257	[c=1 l=7]  *movdi_internal/4
+	movl	%r15d, 8(%rsp)	# 18416	[c=4 l=5]  *movsi_internal/1
+	movzbl	1004(%r13,%r15), %ecx	# 8254	[c=14 l=9]  *zero_extendqisi2/0
+	call	log_append@PLT	# 8261	[c=0 l=5]  *call
+	movl	8(%rsp), %edx	# 8267	[c=9 l=4]  *movsi_internal/0
+	leaq	.LC36(%rip), %rsi	# 8268	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 8270	[c=4 l=3]  *movdi_internal/3
+	movzbl	1004(%r13,%r15), %eax	# 8263	[c=14 l=9]  *zero_extendqisi2/0
+	orl	%eax, %r14d	# 8264	[c=4 l=3]  *iorsi_1/0
+	xorl	%eax, %eax	# 20036	[c=4 l=2]  *movdi_xor
+	movzbl	%r14b, %ecx	# 8265	[c=4 l=4]  *zero_extendqisi2/0
+	call	log_append@PLT	# 8272	[c=0 l=5]  *call
+	movb	%r14b, 1004(%r13,%r15)	# 8274	[c=4 l=8]  *movqi_internal/8
+	movl	$63, %eax	# 8275	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 8276	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 8277	[c=13 l=7]  *cmpsi_1/1
+	jb	.L788	# 8278	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%r13)	# 8280	[c=13 l=8]  *cmpqi_ccno_1/1
+	jne	.L789	# 8281	[c=13 l=6]  *jcc
+.L788:
+	movq	1040(%r13), %rax	# 8284	[c=9 l=7]  *movdi_internal/3
+	movzbl	63(%rax), %r15d	# 8285	[c=13 l=5]  *zero_extendqisi2/0
+.L790:
+	movl	%r15d, %ecx	# 8296	[c=4 l=3]  *movsi_internal/0
+	movl	$63, %edx	# 8297	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 8300	[c=4 l=3]  *movdi_internal/3
+	movslq	%r14d, %r14	# 8304	[c=4 l=3]  *extendsidi2_rex64/1
+	leaq	.LC33(%rip), %rsi	# 8298	[c=1 l=7]  *movdi_internal/4
+	andl	$-31, %r15d	# 8302	[c=4 l=4]  *andsi_1/0
+	call	log_add_data_mov@PLT	# 8301	[c=0 l=5]  *call
+	leaq	flag_update_table_logical(%rip), %rax	# 16909	[c=1 l=7]  *movdi_internal/4
+	movl	$63, %edx	# 8309	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 8312	[c=4 l=3]  *movdi_internal/3
+	movzbl	(%rax,%r14), %eax	# 8305	[c=13 l=5]  *zero_extendqisi2/0
+	leaq	.LC29(%rip), %rsi	# 8310	[c=1 l=7]  *movdi_internal/4
+	orl	%eax, %r15d	# 8306	[c=4 l=3]  *iorsi_1/0
+	movzbl	%r15b, %ecx	# 8307	[c=4 l=4]  *zero_extendqisi2/0
+	call	log_add_data_mov@PLT	# 8313	[c=0 l=5]  *call
+	movl	$63, %eax	# 8314	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 8315	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 8316	[c=13 l=7]  *cmpsi_1/1
+	jb	.L791	# 8317	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%r13)	# 8319	[c=13 l=8]  *cmpqi_ccno_1/1
+	jne	.L792	# 8320	[c=13 l=6]  *jcc
+.L791:
+	movq	1040(%r13), %rax	# 8323	[c=9 l=7]  *movdi_internal/3
+	movb	%r15b, 63(%rax)	# 8324	[c=4 l=4]  *movqi_internal/8
+.L793:
+	movq	%r13, %rdi	# 8336	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 8335	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 8337	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 17599	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 17600	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 8339	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18797	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 8340	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 8342	[c=4 l=3]  *cmpdi_1/0
+	jb	.L344	# 8343	[c=13 l=6]  *jcc
+	movl	0(%r13), %ebx	# 8345	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 8350	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 8346	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 8348	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 8349	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 8351	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 8352	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 8353	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 8356	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 17601	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 8357	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 8360	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 8361	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 20033	[c=10 l=4]  *indirect_jump
+.L794:
+	movzbl	10(%rbx), %r14d	# 8371	[c=13 l=5]  zero_extendqidi2/0
+	movzwl	12(%rbx), %r15d	# 8369	[c=13 l=5]  *zero_extendhisi2/0
+	xorl	%eax, %eax	# 20032	[c=4 l=2]  *movdi_xor
+	movq	%r13, %rdi	# 8378	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC35(%rip), %rsi	# 8376	[c=1 l=7]  *movdi_internal/4
+	movzbl	1004(%r13,%r14), %ecx	# 8373	[c=14 l=9]  *zero_extendqisi2/0
+	movq	%r14, %rdx	# 19193	[c=4 l=3]  *movdi_internal/3
+	movl	%r15d, 8(%rsp)	# 18420	[c=4 l=5]  *movsi_internal/1
+	call	log_append@PLT	# 8380	[c=0 l=5]  *call
+	cmpl	$63, %r15d	# 15562	[c=4 l=4]  *cmpsi_1/0
+	movl	%r15d, %edx	# 8390	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 8392	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC30(%rip), %rax	# 16967	[c=1 l=7]  *movdi_internal/4
+	leaq	.LC29(%rip), %rsi	# 16966	[c=1 l=7]  *movdi_internal/4
+	movzbl	1004(%r13,%r14), %ecx	# 8382	[c=14 l=9]  *zero_extendqisi2/0
+	cmovne	%rax, %rsi	# 15563	[c=8 l=4]  *movdicc_noc/1
+	movl	%ecx, 16(%rsp)	# 18419	[c=4 l=4]  *movsi_internal/1
+	movl	%ecx, %r14d	# 19194	[c=4 l=3]  *movsi_internal/0
+	call	log_add_data_mov@PLT	# 8393	[c=0 l=5]  *call
+	movl	%r15d, %eax	# 17604	[c=4 l=3]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 8395	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 8396	[c=13 l=7]  *cmpsi_1/1
+	movl	8(%rsp), %r8d	# 18421	[c=9 l=5]  *movsi_internal/0
+	jb	.L796	# 8397	[c=13 l=2]  *jcc
+	movl	%r15d, %eax	# 17606	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %eax	# 8399	[c=4 l=3]  *ashrsi3_1/0
+	cltq	# 8400	[c=4 l=2]  *extendsidi2_rex64/0
+	cmpb	$0, 1080(%r13,%rax)	# 8401	[c=14 l=9]  *cmpqi_ccno_1/1
+	jne	.L797	# 8402	[c=13 l=6]  *jcc
+.L796:
+	movq	1040(%r13), %rdx	# 8406	[c=9 l=7]  *movdi_internal/3
+	movzwl	%r8w, %eax	# 8405	[c=4 l=4]  zero_extendhidi2/0
+	movb	%r14b, (%rdx,%rax)	# 8407	[c=4 l=4]  *movqi_internal/8
+.L798:
+	movq	%r13, %rdi	# 8419	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 8418	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 8420	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 17608	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 17609	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 8422	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18796	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 8423	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 8425	[c=4 l=3]  *cmpdi_1/0
+	jb	.L344	# 8426	[c=13 l=6]  *jcc
+	movl	0(%r13), %ebx	# 8428	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 8433	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 8429	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 8431	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 8432	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 8434	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 8435	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 8436	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 8439	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 17610	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 8440	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 8443	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 8444	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 20031	[c=10 l=4]  *indirect_jump
+.L799:
+	movzbl	10(%rbx), %eax	# 8452	[c=13 l=4]  *zero_extendqisi2/0
+	movl	5176(%r13), %r15d	# 8453	[c=9 l=7]  *movsi_internal/0
+	movl	5180(%r13), %r14d	# 8454	[c=9 l=7]  *movsi_internal/0
+	movl	%eax, 8(%rsp)	# 17612	[c=4 l=4]  *movsi_internal/1
+	movl	$61, %eax	# 8455	[c=4 l=5]  *movsi_internal/0
+	subl	%r15d, %eax	# 8456	[c=4 l=3]  *subsi_1/0
+	cmpl	%r14d, %eax	# 8457	[c=4 l=3]  *cmpsi_1/0
+	jb	.L800	# 8458	[c=13 l=6]  *jcc
+	cmpb	$1, 1081(%r13)	# 8462	[c=13 l=8]  *cmpqi_1/0
+	ja	.L1586	# 8463	[c=13 l=6]  *jcc
+	movq	1040(%r13), %rax	# 14317	[c=9 l=7]  *movdi_internal/3
+	movzbl	61(%rax), %edx	# 14318	[c=13 l=4]  *zero_extendqisi2/0
+.L802:
+	movzbl	62(%rax), %r8d	# 8500	[c=13 l=5]  *zero_extendqisi2/0
+.L804:
+	sall	$8, %r8d	# 8503	[c=4 l=4]  *ashlsi3_1/0
+	leaq	.LC31(%rip), %rsi	# 8507	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 8509	[c=4 l=3]  *movdi_internal/3
+	orl	%edx, %r8d	# 8504	[c=4 l=3]  *iorsi_1/0
+	movl	$61, %edx	# 8506	[c=4 l=5]  *movsi_internal/0
+	movl	%r8d, %r15d	# 17614	[c=4 l=3]  *movsi_internal/0
+	movl	%r8d, %ecx	# 8505	[c=4 l=3]  *movsi_internal/0
+	call	log_add_data_mov@PLT	# 8510	[c=0 l=5]  *call
+	addl	$1, %r15d	# 8511	[c=4 l=4]  *addsi_1/0
+	movl	$61, %edx	# 8514	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 8517	[c=4 l=3]  *movdi_internal/3
+	movzwl	%r15w, %r14d	# 8512	[c=4 l=4]  *zero_extendhisi2/0
+	leaq	.LC32(%rip), %rsi	# 8515	[c=1 l=7]  *movdi_internal/4
+	movl	%r14d, %ecx	# 8513	[c=4 l=3]  *movsi_internal/0
+	call	log_add_data_mov@PLT	# 8518	[c=0 l=5]  *call
+	movl	$61, %eax	# 8519	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 8520	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 8521	[c=13 l=7]  *cmpsi_1/1
+	jb	.L805	# 8522	[c=13 l=2]  *jcc
+	cmpb	$1, 1081(%r13)	# 8526	[c=13 l=8]  *cmpqi_1/0
+	ja	.L1587	# 8527	[c=13 l=6]  *jcc
+.L805:
+	movq	1040(%r13), %rax	# 8538	[c=9 l=7]  *movdi_internal/3
+	movb	%r15b, 61(%rax)	# 8539	[c=4 l=4]  *movqi_internal/8
+.L806:
+	movl	$62, %eax	# 8543	[c=4 l=5]  *movsi_internal/0
+	sarl	$8, %r14d	# 8542	[c=4 l=4]  *ashrsi3_1/0
+	subl	5176(%r13), %eax	# 8544	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 8545	[c=13 l=7]  *cmpsi_1/1
+	jb	.L807	# 8546	[c=13 l=2]  *jcc
+	cmpb	$1, 1081(%r13)	# 8550	[c=13 l=8]  *cmpqi_1/0
+	ja	.L1588	# 8551	[c=13 l=6]  *jcc
+.L807:
+	movq	1040(%r13), %rax	# 8561	[c=9 l=7]  *movdi_internal/3
+	movb	%r14b, 62(%rax)	# 8562	[c=4 l=4]  *movqi_internal/8
+.L808:
+	movl	%r15d, %eax	# 17615	[c=4 l=3]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 8565	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 8566	[c=13 l=7]  *cmpsi_1/1
+	jb	.L809	# 8567	[c=13 l=2]  *jcc
+	movl	%r15d, %eax	# 17617	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %eax	# 8569	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 16877	[c=5 l=5]  *andsi_1_zext
+	cmpb	$0, 1080(%r13,%rax)	# 8572	[c=14 l=9]  *cmpqi_ccno_1/1
+	jne	.L810	# 8573	[c=13 l=6]  *jcc
+.L809:
+	movq	1040(%r13), %rdx	# 8577	[c=9 l=7]  *movdi_internal/3
+	movslq	%r15d, %rax	# 8576	[c=4 l=3]  *extendsidi2_rex64/1
+	movzbl	(%rdx,%rax), %r14d	# 8578	[c=13 l=5]  *zero_extendqisi2/0
+.L811:
+	cmpl	$63, %r15d	# 15574	[c=4 l=4]  *cmpsi_1/0
+	movl	%r15d, %edx	# 8595	[c=4 l=3]  *movsi_internal/0
+	movl	%r14d, %ecx	# 8594	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 8597	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC25(%rip), %rax	# 16969	[c=1 l=7]  *movdi_internal/4
+	leaq	.LC33(%rip), %rsi	# 16968	[c=1 l=7]  *movdi_internal/4
+	cmovne	%rax, %rsi	# 15575	[c=8 l=4]  *movdicc_noc/1
+	call	log_add_data_mov@PLT	# 8598	[c=0 l=5]  *call
+	movl	8(%rsp), %r15d	# 18424	[c=9 l=5]  *movsi_internal/0
+	movzbl	%r14b, %ecx	# 8599	[c=4 l=4]  *zero_extendqisi2/0
+	xorl	%eax, %eax	# 20030	[c=4 l=2]  *movdi_xor
+	leaq	.LC36(%rip), %rsi	# 8602	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 8604	[c=4 l=3]  *movdi_internal/3
+	movl	%r15d, %edx	# 8601	[c=4 l=3]  *movsi_internal/0
+	call	log_append@PLT	# 8606	[c=0 l=5]  *call
+	movslq	%r15d, %rax	# 17619	[c=4 l=3]  *extendsidi2_rex64/1
+	movq	%r13, %rdi	# 8610	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 8609	[c=4 l=3]  *movdi_internal/3
+	movb	%r14b, 1004(%r13,%rax)	# 8608	[c=4 l=8]  *movqi_internal/8
+	call	log_dump_line@PLT	# 8611	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 17620	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 17621	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 8613	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18795	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 8614	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 8616	[c=4 l=3]  *cmpdi_1/0
+	jb	.L344	# 8617	[c=13 l=6]  *jcc
+	movl	0(%r13), %ebx	# 8619	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 8624	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 8620	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 8622	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 8623	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 8625	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 8626	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 8627	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 8630	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 17622	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 8631	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 8634	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 8635	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 20029	[c=10 l=4]  *indirect_jump
+.L813:
+	movzbl	10(%rbx), %r14d	# 8643	[c=13 l=5]  zero_extendqidi2/0
+	xorl	%eax, %eax	# 20028	[c=4 l=2]  *movdi_xor
+	leaq	.LC35(%rip), %rsi	# 8648	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 8650	[c=4 l=3]  *movdi_internal/3
+	movzbl	1004(%r13,%r14), %ecx	# 8645	[c=14 l=9]  *zero_extendqisi2/0
+	movq	%r14, %rdx	# 19195	[c=4 l=3]  *movdi_internal/3
+	call	log_append@PLT	# 8652	[c=0 l=5]  *call
+	movl	5176(%r13), %ecx	# 8656	[c=9 l=7]  *movsi_internal/0
+	movzbl	1004(%r13,%r14), %eax	# 8654	[c=14 l=9]  *zero_extendqisi2/0
+	movl	5180(%r13), %edx	# 8657	[c=9 l=7]  *movsi_internal/0
+	movl	%eax, 16(%rsp)	# 17624	[c=4 l=4]  *movsi_internal/1
+	movl	%eax, %r15d	# 19196	[c=4 l=3]  *movsi_internal/0
+	movl	$61, %eax	# 8658	[c=4 l=5]  *movsi_internal/0
+	subl	%ecx, %eax	# 8659	[c=4 l=2]  *subsi_1/0
+	cmpl	%edx, %eax	# 8660	[c=4 l=2]  *cmpsi_1/0
+	jb	.L814	# 8661	[c=13 l=6]  *jcc
+	cmpb	$1, 1081(%r13)	# 8665	[c=13 l=8]  *cmpqi_1/0
+	ja	.L1589	# 8666	[c=13 l=6]  *jcc
+	movq	1040(%r13), %rax	# 14323	[c=9 l=7]  *movdi_internal/3
+	movzbl	61(%rax), %r14d	# 14324	[c=13 l=5]  *zero_extendqisi2/0
+.L816:
+	movzbl	62(%rax), %eax	# 8703	[c=13 l=4]  *zero_extendqisi2/0
+.L818:
+	sall	$8, %eax	# 8706	[c=4 l=3]  *ashlsi3_1/0
+	movl	$61, %edx	# 8709	[c=4 l=5]  *movsi_internal/0
+	leaq	.LC31(%rip), %rsi	# 8710	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 8712	[c=4 l=3]  *movdi_internal/3
+	orl	%eax, %r14d	# 8707	[c=4 l=3]  *iorsi_1/0
+	movl	%r14d, %ecx	# 8708	[c=4 l=3]  *movsi_internal/0
+	call	log_add_data_mov@PLT	# 8713	[c=0 l=5]  *call
+	cmpl	996(%r13), %r14d	# 8715	[c=13 l=7]  *cmpsi_1/1
+	jb	.L1590	# 8716	[c=13 l=6]  *jcc
+	cmpl	$63, %r14d	# 15586	[c=4 l=4]  *cmpsi_1/0
+	leal	-1(%r14), %eax	# 18794	[c=4 l=4]  *leasi
+	movzbl	%r15b, %ecx	# 18731	[c=4 l=4]  *zero_extendqisi2/0
+	movq	%r13, %rdi	# 8733	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC30(%rip), %rdx	# 16971	[c=1 l=7]  *movdi_internal/4
+	leaq	.LC29(%rip), %rsi	# 16970	[c=1 l=7]  *movdi_internal/4
+	movl	%eax, 8(%rsp)	# 17625	[c=4 l=4]  *movsi_internal/1
+	cmovne	%rdx, %rsi	# 15587	[c=8 l=4]  *movdicc_noc/1
+	movl	%r14d, %edx	# 8731	[c=4 l=3]  *movsi_internal/0
+	call	log_add_data_mov@PLT	# 8734	[c=0 l=5]  *call
+	movl	%r14d, %edx	# 17626	[c=4 l=3]  *movsi_internal/0
+	subl	5176(%r13), %edx	# 8735	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %edx	# 8736	[c=13 l=7]  *cmpsi_1/1
+	jb	.L821	# 8737	[c=13 l=2]  *jcc
+	movl	%r14d, %edx	# 17628	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %edx	# 8739	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %edx	# 16876	[c=5 l=6]  *andsi_1_zext
+	cmpb	$0, 1080(%r13,%rdx)	# 8742	[c=14 l=9]  *cmpqi_ccno_1/1
+	jne	.L822	# 8743	[c=13 l=6]  *jcc
+.L821:
+	movq	1040(%r13), %rdx	# 8747	[c=9 l=7]  *movdi_internal/3
+	movslq	%r14d, %rax	# 8746	[c=4 l=3]  *extendsidi2_rex64/1
+	movb	%r15b, (%rdx,%rax)	# 8748	[c=4 l=4]  *movqi_internal/8
+.L823:
+	movl	8(%rsp), %r14d	# 18429	[c=9 l=5]  *movsi_internal/0
+	movl	$61, %edx	# 8761	[c=4 l=5]  *movsi_internal/0
+	leaq	.LC32(%rip), %rsi	# 8762	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 8764	[c=4 l=3]  *movdi_internal/3
+	movzwl	%r14w, %r15d	# 8759	[c=4 l=4]  *zero_extendhisi2/0
+	movl	%r15d, %ecx	# 8760	[c=4 l=3]  *movsi_internal/0
+	call	log_add_data_mov@PLT	# 8765	[c=0 l=5]  *call
+	movl	$61, %eax	# 8766	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 8767	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 8768	[c=13 l=7]  *cmpsi_1/1
+	jb	.L824	# 8769	[c=13 l=2]  *jcc
+	cmpb	$1, 1081(%r13)	# 8773	[c=13 l=8]  *cmpqi_1/0
+	ja	.L1591	# 8774	[c=13 l=6]  *jcc
+.L824:
+	movq	1040(%r13), %rax	# 8785	[c=9 l=7]  *movdi_internal/3
+	movzbl	8(%rsp), %edi	# 17630	[c=9 l=5]  *movqi_internal/4
+	movb	%dil, 61(%rax)	# 8786	[c=4 l=4]  *movqi_internal/8
+.L825:
+	movl	$62, %eax	# 8790	[c=4 l=5]  *movsi_internal/0
+	sarl	$8, %r15d	# 8789	[c=4 l=4]  *ashrsi3_1/0
+	subl	5176(%r13), %eax	# 8791	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 8792	[c=13 l=7]  *cmpsi_1/1
+	jb	.L826	# 8793	[c=13 l=2]  *jcc
+	cmpb	$1, 1081(%r13)	# 8797	[c=13 l=8]  *cmpqi_1/0
+	ja	.L1592	# 8798	[c=13 l=6]  *jcc
+.L826:
+	movq	1040(%r13), %rax	# 8808	[c=9 l=7]  *movdi_internal/3
+	movb	%r15b, 62(%rax)	# 8809	[c=4 l=4]  *movqi_internal/8
+.L827:
+	movq	%r13, %rdi	# 8813	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 8812	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 8814	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 17631	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 17632	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 8816	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18793	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 8817	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 8819	[c=4 l=3]  *cmpdi_1/0
+	jb	.L344	# 8820	[c=13 l=6]  *jcc
+	movl	0(%r13), %ebx	# 8822	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 8827	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 8823	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 8825	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 8826	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 8828	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 8829	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 8830	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 8833	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 17633	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 8834	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 8837	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 8838	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 20027	[c=10 l=4]  *indirect_jump
+.L779:
+	movq	%r13, %rdi	# 8084	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 8083	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 8085	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 17589	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 17590	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 8087	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18799	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 8088	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 8090	[c=4 l=3]  *cmpdi_1/0
+	jb	.L344	# 8091	[c=13 l=6]  *jcc
+	movl	0(%r13), %ebx	# 8093	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 8098	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 8094	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 8096	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 8097	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 8099	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 8100	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 8101	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 8104	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 17591	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 8105	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 8108	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 8109	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 20042	[c=10 l=4]  *indirect_jump
+.L780:
+	movzbl	10(%rbx), %r8d	# 8118	[c=13 l=5]  zero_extendqidi2/0
+	movzwl	12(%rbx), %r11d	# 8117	[c=13 l=5]  *zero_extendhisi2/0
+	movq	%r13, %rdi	# 8125	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 20038	[c=4 l=2]  *movdi_xor
+	leaq	.LC35(%rip), %rsi	# 8123	[c=1 l=7]  *movdi_internal/4
+	movzbl	1004(%r13,%r8), %ecx	# 8120	[c=14 l=9]  *zero_extendqisi2/0
+	movl	%r8d, %edx	# 8122	[c=4 l=3]  *movsi_internal/0
+	movl	%r11d, 24(%rsp)	# 18414	[c=4 l=5]  *movsi_internal/1
+	movq	%r8, 8(%rsp)	# 18412	[c=4 l=5]  *movdi_internal/5
+	movl	%r8d, 16(%rsp)	# 18410	[c=4 l=5]  *movsi_internal/1
+	call	log_append@PLT	# 8127	[c=0 l=5]  *call
+	movslq	24(%rsp), %r15	# 18415	[c=13 l=5]  *extendsidi2_rex64/1
+	movq	%r13, %rdi	# 8136	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 20039	[c=4 l=2]  *movdi_xor
+	movq	8(%rsp), %r8	# 18413	[c=9 l=5]  *movdi_internal/3
+	leaq	.LC35(%rip), %rsi	# 18409	[c=1 l=7]  *movdi_internal/4
+	movzbl	1004(%r13,%r15), %ecx	# 8131	[c=14 l=9]  *zero_extendqisi2/0
+	movl	%r15d, %edx	# 8133	[c=4 l=3]  *movsi_internal/0
+	movzbl	1004(%r13,%r8), %r14d	# 8129	[c=10 l=9]  *movqi_internal/4
+	call	log_append@PLT	# 8138	[c=0 l=5]  *call
+	movl	16(%rsp), %edx	# 20040	[c=9 l=4]  *movsi_internal/0
+	xorl	%eax, %eax	# 20041	[c=4 l=2]  *movdi_xor
+	movq	%r13, %rdi	# 8146	[c=4 l=3]  *movdi_internal/3
+	orb	1004(%r13,%r15), %r14b	# 8140	[c=14 l=8]  *iorqi_1/1
+	leaq	.LC36(%rip), %rsi	# 8144	[c=1 l=7]  *movdi_internal/4
+	movzbl	%r14b, %r15d	# 8141	[c=4 l=4]  zero_extendqidi2/0
+	movl	%r15d, %ecx	# 8142	[c=4 l=3]  *movsi_internal/0
+	call	log_append@PLT	# 8148	[c=0 l=5]  *call
+	movq	8(%rsp), %r8	# 18407	[c=9 l=5]  *movdi_internal/3
+	movl	$63, %eax	# 8151	[c=4 l=5]  *movsi_internal/0
+	movb	%r14b, 1004(%r13,%r8)	# 8150	[c=4 l=8]  *movqi_internal/8
+	subl	5176(%r13), %eax	# 8152	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 8153	[c=13 l=7]  *cmpsi_1/1
+	jb	.L781	# 8154	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%r13)	# 8156	[c=13 l=8]  *cmpqi_ccno_1/1
+	jne	.L782	# 8157	[c=13 l=6]  *jcc
+.L781:
+	movq	1040(%r13), %rax	# 8160	[c=9 l=7]  *movdi_internal/3
+	movzbl	63(%rax), %r14d	# 8161	[c=13 l=5]  *zero_extendqisi2/0
+.L783:
+	movl	%r14d, %ecx	# 8172	[c=4 l=3]  *movsi_internal/0
+	movl	$63, %edx	# 8173	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 8176	[c=4 l=3]  *movdi_internal/3
+	andl	$-31, %r14d	# 8178	[c=4 l=4]  *andsi_1/0
+	leaq	.LC33(%rip), %rsi	# 8174	[c=1 l=7]  *movdi_internal/4
+	call	log_add_data_mov@PLT	# 8177	[c=0 l=5]  *call
+	leaq	flag_update_table_logical(%rip), %rax	# 16908	[c=1 l=7]  *movdi_internal/4
+	movl	$63, %edx	# 8185	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 8188	[c=4 l=3]  *movdi_internal/3
+	movzbl	(%rax,%r15), %eax	# 8181	[c=13 l=5]  *zero_extendqisi2/0
+	leaq	.LC29(%rip), %rsi	# 8186	[c=1 l=7]  *movdi_internal/4
+	orl	%eax, %r14d	# 8182	[c=4 l=3]  *iorsi_1/0
+	movzbl	%r14b, %ecx	# 8183	[c=4 l=4]  *zero_extendqisi2/0
+	call	log_add_data_mov@PLT	# 8189	[c=0 l=5]  *call
+	movl	$63, %eax	# 8190	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 8191	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 8192	[c=13 l=7]  *cmpsi_1/1
+	jb	.L784	# 8193	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%r13)	# 8195	[c=13 l=8]  *cmpqi_ccno_1/1
+	jne	.L785	# 8196	[c=13 l=6]  *jcc
+.L784:
+	movq	1040(%r13), %rax	# 8199	[c=9 l=7]  *movdi_internal/3
+	movb	%r14b, 63(%rax)	# 8200	[c=4 l=4]  *movqi_internal/8
+.L786:
+	movq	%r13, %rdi	# 8212	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 8211	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 8213	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 17593	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 17594	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 8215	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18798	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 8216	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 8218	[c=4 l=3]  *cmpdi_1/0
+	jb	.L344	# 8219	[c=13 l=6]  *jcc
+	movl	0(%r13), %ebx	# 8221	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 8226	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 8222	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 8224	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 8225	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 8227	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 8228	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 8229	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 8232	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 17595	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 8233	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 8236	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 8237	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 20037	[c=10 l=4]  *indirect_jump
+.L916:
+	movzbl	10(%rbx), %r8d	# 9883	[c=13 l=5]  zero_extendqidi2/0
+	movq	1040(%r13), %rax	# 9884	[c=9 l=7]  *movdi_internal/3
+	leaq	.LC35(%rip), %rsi	# 9893	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 9895	[c=4 l=3]  *movdi_internal/3
+	movzbl	63(%rax), %r14d	# 9885	[c=9 l=5]  *movqi_internal/4
+	movq	%r8, %rdx	# 19197	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 20017	[c=4 l=2]  *movdi_xor
+	movq	%r8, 8(%rsp)	# 18472	[c=4 l=5]  *movdi_internal/5
+	movzbl	1004(%r13,%r8), %ecx	# 9890	[c=14 l=9]  *zero_extendqisi2/0
+	movl	%r8d, 16(%rsp)	# 18470	[c=4 l=5]  *movsi_internal/1
+	andl	$1, %r14d	# 9887	[c=4 l=4]  *andsi_1/0
+	call	log_append@PLT	# 9897	[c=0 l=5]  *call
+	movq	8(%rsp), %r8	# 18473	[c=9 l=5]  *movdi_internal/3
+	sall	$8, %r14d	# 9888	[c=4 l=4]  *ashlsi3_1/0
+	xorl	%eax, %eax	# 20018	[c=4 l=2]  *movdi_xor
+	movl	16(%rsp), %edx	# 18471	[c=9 l=4]  *movsi_internal/0
+	leaq	.LC36(%rip), %rsi	# 9904	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 9906	[c=4 l=3]  *movdi_internal/3
+	movzbl	1004(%r13,%r8), %r15d	# 9899	[c=14 l=9]  *zero_extendqisi2/0
+	orl	%r14d, %r15d	# 9900	[c=4 l=3]  *iorsi_1/0
+	movl	%r15d, %r14d	# 17712	[c=4 l=3]  *movsi_internal/0
+	sarl	%r14d	# 9901	[c=4 l=3]  *ashrsi3_1/0
+	movl	%r14d, %ecx	# 9902	[c=4 l=3]  *movsi_internal/0
+	call	log_append@PLT	# 9908	[c=0 l=5]  *call
+	movq	8(%rsp), %r8	# 18469	[c=9 l=5]  *movdi_internal/3
+	movl	$63, %eax	# 9911	[c=4 l=5]  *movsi_internal/0
+	movb	%r14b, 1004(%r13,%r8)	# 9910	[c=4 l=8]  *movqi_internal/8
+	subl	5176(%r13), %eax	# 9912	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 9913	[c=13 l=7]  *cmpsi_1/1
+	jb	.L917	# 9914	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%r13)	# 9916	[c=13 l=8]  *cmpqi_ccno_1/1
+	jne	.L918	# 9917	[c=13 l=6]  *jcc
+.L917:
+	movq	1040(%r13), %rax	# 9920	[c=9 l=7]  *movdi_internal/3
+	movzbl	63(%rax), %r14d	# 9921	[c=13 l=5]  *zero_extendqisi2/0
+.L919:
+	movl	%r14d, %ecx	# 9932	[c=4 l=3]  *movsi_internal/0
+	movl	$63, %edx	# 9933	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 9936	[c=4 l=3]  *movdi_internal/3
+	movslq	%r15d, %r15	# 9940	[c=4 l=3]  *extendsidi2_rex64/1
+	leaq	.LC33(%rip), %rsi	# 9934	[c=1 l=7]  *movdi_internal/4
+	andl	$-32, %r14d	# 9938	[c=4 l=4]  *andsi_1/0
+	call	log_add_data_mov@PLT	# 9937	[c=0 l=5]  *call
+	leaq	flag_update_table_ror8(%rip), %rax	# 16910	[c=1 l=7]  *movdi_internal/4
+	movl	$63, %edx	# 9945	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 9948	[c=4 l=3]  *movdi_internal/3
+	movzbl	(%rax,%r15), %eax	# 9941	[c=13 l=5]  *zero_extendqisi2/0
+	leaq	.LC29(%rip), %rsi	# 9946	[c=1 l=7]  *movdi_internal/4
+	orl	%eax, %r14d	# 9942	[c=4 l=3]  *iorsi_1/0
+	movzbl	%r14b, %ecx	# 9943	[c=4 l=4]  *zero_extendqisi2/0
+	call	log_add_data_mov@PLT	# 9949	[c=0 l=5]  *call
+	movl	$63, %eax	# 9950	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 9951	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 9952	[c=13 l=7]  *cmpsi_1/1
+	jb	.L920	# 9953	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%r13)	# 9955	[c=13 l=8]  *cmpqi_ccno_1/1
+	jne	.L921	# 9956	[c=13 l=6]  *jcc
+.L920:
+	movq	1040(%r13), %rax	# 9959	[c=9 l=7]  *movdi_internal/3
+	movb	%r14b, 63(%rax)	# 9960	[c=4 l=4]  *movqi_internal/8
+.L922:
+	movq	%r13, %rdi	# 9972	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 9971	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 9973	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 17714	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 17715	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 9975	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18776	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 9976	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 9978	[c=4 l=3]  *cmpdi_1/0
+	jb	.L344	# 9979	[c=13 l=6]  *jcc
+	movl	0(%r13), %ebx	# 9981	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 9986	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 9982	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 9984	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 9985	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 9987	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 9988	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 9989	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 9992	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 17716	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 9993	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 9996	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 9997	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 20016	[c=10 l=4]  *indirect_jump
+.L923:
+	movzbl	10(%rbx), %r14d	# 10006	[c=13 l=5]  zero_extendqidi2/0
+	movzwl	12(%rbx), %r8d	# 10005	[c=13 l=5]  *zero_extendhisi2/0
+	movq	%r13, %rdi	# 10013	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 20012	[c=4 l=2]  *movdi_xor
+	leaq	.LC35(%rip), %rsi	# 10011	[c=1 l=7]  *movdi_internal/4
+	movzbl	1004(%r13,%r14), %ecx	# 10008	[c=14 l=9]  *zero_extendqisi2/0
+	movl	%r14d, %edx	# 10010	[c=4 l=3]  *movsi_internal/0
+	movl	%r8d, 16(%rsp)	# 18482	[c=4 l=5]  *movsi_internal/1
+	movl	%r14d, 24(%rsp)	# 18480	[c=4 l=5]  *movsi_internal/1
+	call	log_append@PLT	# 10015	[c=0 l=5]  *call
+	movslq	16(%rsp), %r15	# 18483	[c=13 l=5]  *extendsidi2_rex64/1
+	leaq	.LC35(%rip), %rsi	# 18479	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 10024	[c=4 l=3]  *movdi_internal/3
+	movzbl	1004(%r13,%r14), %eax	# 10017	[c=10 l=9]  *movqi_internal/4
+	movzbl	1004(%r13,%r15), %ecx	# 10019	[c=14 l=9]  *zero_extendqisi2/0
+	movl	%r15d, %edx	# 10021	[c=4 l=3]  *movsi_internal/0
+	movb	%al, 8(%rsp)	# 17718	[c=4 l=4]  *movqi_internal/8
+	xorl	%eax, %eax	# 20013	[c=4 l=2]  *movdi_xor
+	call	log_append@PLT	# 10026	[c=0 l=5]  *call
+	movl	24(%rsp), %edx	# 20014	[c=9 l=4]  *movsi_internal/0
+	leaq	.LC36(%rip), %rsi	# 10040	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 10042	[c=4 l=3]  *movdi_internal/3
+	movzbl	1004(%r13,%r15), %eax	# 10028	[c=14 l=9]  *zero_extendqisi2/0
+	movzbl	8(%rsp), %r15d	# 10029	[c=13 l=6]  *zero_extendqisi2/0
+	movb	%al, 16(%rsp)	# 18474	[c=4 l=4]  *movqi_internal/8
+	subl	%eax, %r15d	# 10031	[c=4 l=3]  *subsi_1/0
+	movq	1040(%r13), %rax	# 10032	[c=9 l=7]  *movdi_internal/3
+	movzbl	63(%rax), %eax	# 10033	[c=9 l=4]  *movqi_internal/4
+	andl	$1, %eax	# 10035	[c=4 l=3]  *andsi_1/0
+	subl	%eax, %r15d	# 10036	[c=4 l=3]  *subsi_1/0
+	xorl	%eax, %eax	# 20015	[c=4 l=2]  *movdi_xor
+	movzbl	%r15b, %ecx	# 10037	[c=4 l=4]  *zero_extendqisi2/0
+	call	log_append@PLT	# 10044	[c=0 l=5]  *call
+	movzbl	16(%rsp), %r8d	# 18475	[c=9 l=6]  *movqi_internal/4
+	movb	%r15b, 1004(%r13,%r14)	# 10046	[c=4 l=8]  *movqi_internal/8
+	andl	$511, %r15d	# 10058	[c=4 l=7]  *andsi_1/0
+	movl	8(%rsp), %r14d	# 17720	[c=9 l=5]  *movsi_internal/0
+	movq	1040(%r13), %rdx	# 10053	[c=9 l=7]  *movdi_internal/3
+	movl	%r8d, %eax	# 17722	[c=4 l=3]  *movsi_internal/0
+	andl	$136, %r14d	# 10048	[c=4 l=7]  *andsi_1/0
+	andl	$136, %eax	# 10051	[c=4 l=5]  *andsi_1/0
+	movzbl	63(%rdx), %ecx	# 10054	[c=13 l=4]  *zero_extendqisi2/0
+	leaq	flag_update_table_sub8(%rip), %rdx	# 16911	[c=1 l=7]  *movdi_internal/4
+	leal	(%rax,%r14,2), %eax	# 10052	[c=8 l=4]  *leasi
+	imull	$260, %eax, %eax	# 10056	[c=12 l=6]  *mulsi3_1/1
+	andl	$7680, %eax	# 10057	[c=4 l=5]  *andsi_1/0
+	orl	%r15d, %eax	# 10059	[c=5 l=3]  *iorsi_1_zext
+	movzbl	(%rdx,%rax), %r14d	# 10061	[c=13 l=5]  *zero_extendqisi2/0
+	movl	%ecx, %eax	# 17724	[c=4 l=2]  *movsi_internal/0
+	orl	$-3, %eax	# 10062	[c=4 l=3]  *iorsi_1/0
+	andl	%eax, %r14d	# 10063	[c=4 l=3]  *andsi_1/0
+	movl	$63, %eax	# 10064	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 10065	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 10066	[c=13 l=7]  *cmpsi_1/1
+	jb	.L924	# 10067	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%r13)	# 10069	[c=13 l=8]  *cmpqi_ccno_1/1
+	jne	.L1593	# 10070	[c=13 l=6]  *jcc
+.L924:
+	movl	$63, %edx	# 10079	[c=4 l=5]  *movsi_internal/0
+	leaq	.LC33(%rip), %rsi	# 10080	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 10082	[c=4 l=3]  *movdi_internal/3
+	movl	%ecx, 8(%rsp)	# 18484	[c=4 l=4]  *movsi_internal/1
+	call	log_add_data_mov@PLT	# 10083	[c=0 l=5]  *call
+	movl	8(%rsp), %ecx	# 18485	[c=9 l=4]  *movsi_internal/0
+	movl	$63, %edx	# 10088	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 10091	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC29(%rip), %rsi	# 10089	[c=1 l=7]  *movdi_internal/4
+	andl	$-64, %ecx	# 10084	[c=4 l=3]  *andsi_1/0
+	orl	%ecx, %r14d	# 10085	[c=4 l=3]  *iorsi_1/0
+	movzbl	%r14b, %ecx	# 10086	[c=4 l=4]  *zero_extendqisi2/0
+	call	log_add_data_mov@PLT	# 10092	[c=0 l=5]  *call
+	movl	$63, %eax	# 10093	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 10094	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 10095	[c=13 l=7]  *cmpsi_1/1
+	jb	.L925	# 10096	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%r13)	# 10098	[c=13 l=8]  *cmpqi_ccno_1/1
+	jne	.L926	# 10099	[c=13 l=6]  *jcc
+.L925:
+	movq	1040(%r13), %rax	# 10102	[c=9 l=7]  *movdi_internal/3
+	movb	%r14b, 63(%rax)	# 10103	[c=4 l=4]  *movqi_internal/8
+.L927:
+	movq	%r13, %rdi	# 10115	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 10114	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 10116	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 17726	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 17727	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 10118	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18775	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 10119	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 10121	[c=4 l=3]  *cmpdi_1/0
+	jb	.L344	# 10122	[c=13 l=6]  *jcc
+	movl	0(%r13), %ebx	# 10124	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 10129	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 10125	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 10127	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 10128	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 10130	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 10131	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 10132	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 10135	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 17728	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 10136	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 10139	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 10140	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 20011	[c=10 l=4]  *indirect_jump
+.L928:
+	movzwl	12(%rbx), %r15d	# 10148	[c=13 l=5]  *zero_extendhisi2/0
+	movq	%r13, %rdi	# 10154	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 20008	[c=4 l=2]  *movdi_xor
+	movzbl	10(%rbx), %r14d	# 10150	[c=13 l=5]  *zero_extendqisi2/0
+	leaq	.LC61(%rip), %rsi	# 10152	[c=1 l=7]  *movdi_internal/4
+	movl	%r15d, %edx	# 10151	[c=4 l=3]  *movsi_internal/0
+	movl	%r15d, 32(%rsp)	# 18492	[c=4 l=5]  *movsi_internal/1
+	movslq	%r14d, %r14	# 18489	[c=4 l=3]  *extendsidi2_rex64/1
+	call	log_append@PLT	# 10156	[c=0 l=5]  *call
+	movl	%r14d, %edx	# 10164	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 10167	[c=4 l=3]  *movdi_internal/3
+	movl	%r14d, 8(%rsp)	# 18488	[c=4 l=5]  *movsi_internal/1
+	movq	1040(%r13), %rax	# 10157	[c=9 l=7]  *movdi_internal/3
+	leaq	.LC35(%rip), %rsi	# 10165	[c=1 l=7]  *movdi_internal/4
+	movzbl	1004(%r13,%r14), %ecx	# 10162	[c=14 l=9]  *zero_extendqisi2/0
+	movzbl	63(%rax), %eax	# 10158	[c=9 l=4]  *movqi_internal/4
+	andl	$1, %eax	# 10160	[c=4 l=3]  *andsi_1/0
+	movl	%eax, 16(%rsp)	# 17732	[c=4 l=4]  *movsi_internal/1
+	xorl	%eax, %eax	# 20009	[c=4 l=2]  *movdi_xor
+	call	log_append@PLT	# 10169	[c=0 l=5]  *call
+	movl	16(%rsp), %edi	# 17736	[c=9 l=4]  *movsi_internal/0
+	movl	8(%rsp), %edx	# 10177	[c=9 l=4]  *movsi_internal/0
+	leaq	.LC36(%rip), %rsi	# 10178	[c=1 l=7]  *movdi_internal/4
+	movzbl	1004(%r13,%r14), %eax	# 10171	[c=14 l=9]  *zero_extendqisi2/0
+	movb	%al, 24(%rsp)	# 18486	[c=4 l=4]  *movqi_internal/8
+	subl	%r15d, %eax	# 10173	[c=4 l=3]  *subsi_1/0
+	movl	%eax, %r15d	# 17734	[c=4 l=3]  *movsi_internal/0
+	xorl	%eax, %eax	# 20010	[c=4 l=2]  *movdi_xor
+	subl	%edi, %r15d	# 10174	[c=4 l=3]  *subsi_1/0
+	movq	%r13, %rdi	# 10180	[c=4 l=3]  *movdi_internal/3
+	movzbl	%r15b, %ecx	# 10175	[c=4 l=4]  *zero_extendqisi2/0
+	call	log_append@PLT	# 10182	[c=0 l=5]  *call
+	movzbl	24(%rsp), %r9d	# 18487	[c=9 l=6]  *movqi_internal/4
+	movl	32(%rsp), %r8d	# 18493	[c=9 l=5]  *movsi_internal/0
+	movb	%r15b, 1004(%r13,%r14)	# 10184	[c=4 l=8]  *movqi_internal/8
+	movq	1040(%r13), %rdx	# 10191	[c=9 l=7]  *movdi_internal/3
+	andl	$511, %r15d	# 10196	[c=4 l=7]  *andsi_1/0
+	andl	$136, %r9d	# 10186	[c=4 l=7]  *andsi_1/0
+	andl	$136, %r8d	# 10189	[c=4 l=7]  *andsi_1/0
+	leal	(%r8,%r9,2), %eax	# 10190	[c=8 l=4]  *leasi
+	movzbl	63(%rdx), %ecx	# 10192	[c=13 l=4]  *zero_extendqisi2/0
+	leaq	flag_update_table_sub8(%rip), %rdx	# 16912	[c=1 l=7]  *movdi_internal/4
+	imull	$260, %eax, %eax	# 10194	[c=12 l=6]  *mulsi3_1/1
+	andl	$7680, %eax	# 10195	[c=4 l=5]  *andsi_1/0
+	orl	%r15d, %eax	# 10197	[c=5 l=3]  *iorsi_1_zext
+	movzbl	(%rdx,%rax), %r14d	# 10199	[c=13 l=5]  *zero_extendqisi2/0
+	movl	%ecx, %eax	# 17737	[c=4 l=2]  *movsi_internal/0
+	orl	$-3, %eax	# 10200	[c=4 l=3]  *iorsi_1/0
+	andl	%eax, %r14d	# 10201	[c=4 l=3]  *andsi_1/0
+	movl	$63, %eax	# 10202	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 10203	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 10204	[c=13 l=7]  *cmpsi_1/1
+	jb	.L929	# 10205	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%r13)	# 10207	[c=13 l=8]  *cmpqi_ccno_1/1
+	jne	.L1594	# 10208	[c=13 l=6]  *jcc
+.L929:
+	movl	$63, %edx	# 10217	[c=4 l=5]  *movsi_internal/0
+	leaq	.LC33(%rip), %rsi	# 10218	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 10220	[c=4 l=3]  *movdi_internal/3
+	movl	%ecx, 8(%rsp)	# 18494	[c=4 l=4]  *movsi_internal/1
+	call	log_add_data_mov@PLT	# 10221	[c=0 l=5]  *call
+	movl	8(%rsp), %ecx	# 18495	[c=9 l=4]  *movsi_internal/0
+	movl	$63, %edx	# 10226	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 10229	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC29(%rip), %rsi	# 10227	[c=1 l=7]  *movdi_internal/4
+	andl	$-64, %ecx	# 10222	[c=4 l=3]  *andsi_1/0
+	orl	%ecx, %r14d	# 10223	[c=4 l=3]  *iorsi_1/0
+	movzbl	%r14b, %ecx	# 10224	[c=4 l=4]  *zero_extendqisi2/0
+	call	log_add_data_mov@PLT	# 10230	[c=0 l=5]  *call
+	movl	$63, %eax	# 10231	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 10232	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 10233	[c=13 l=7]  *cmpsi_1/1
+	jb	.L930	# 10234	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%r13)	# 10236	[c=13 l=8]  *cmpqi_ccno_1/1
+	jne	.L931	# 10237	[c=13 l=6]  *jcc
+.L930:
+	movq	1040(%r13), %rax	# 10240	[c=9 l=7]  *movdi_internal/3
+	movb	%r14b, 63(%rax)	# 10241	[c=4 l=4]  *movqi_internal/8
+.L932:
+	movq	%r13, %rdi	# 10253	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 10252	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 10254	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 17739	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 17740	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 10256	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18774	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 10257	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 10259	[c=4 l=3]  *cmpdi_1/0
+	jb	.L344	# 10260	[c=13 l=6]  *jcc
+	movl	0(%r13), %ebx	# 10262	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 10267	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 10263	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 10265	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 10266	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 10268	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 10269	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 10270	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 10273	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 17741	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 10274	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 10277	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 10278	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 20007	[c=10 l=4]  *indirect_jump
+.L933:
+	movzbl	10(%rbx), %r15d	# 10287	[c=13 l=5]  *zero_extendqisi2/0
+	movzwl	12(%rbx), %r14d	# 10286	[c=13 l=5]  *zero_extendhisi2/0
+	movl	%r15d, %eax	# 19204	[c=4 l=3]  *movsi_internal/0
+	movb	%r15b, 8(%rsp)	# 18496	[c=4 l=5]  *movqi_internal/8
+	subl	5176(%r13), %eax	# 10290	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 10291	[c=13 l=7]  *cmpsi_1/1
+	jb	.L934	# 10292	[c=13 l=2]  *jcc
+	movl	%r15d, %eax	# 17747	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %eax	# 10294	[c=4 l=3]  *ashrsi3_1/0
+	cltq	# 10295	[c=4 l=2]  *extendsidi2_rex64/0
+	cmpb	$0, 1080(%r13,%rax)	# 10296	[c=14 l=9]  *cmpqi_ccno_1/1
+	jne	.L935	# 10297	[c=13 l=6]  *jcc
+.L934:
+	movzbl	8(%rsp), %eax	# 10300	[c=13 l=5]  zero_extendqidi2/0
+	movq	1040(%r13), %rdx	# 10301	[c=9 l=7]  *movdi_internal/3
+	movzbl	(%rdx,%rax), %eax	# 10302	[c=13 l=4]  *zero_extendqisi2/0
+.L936:
+	cmpl	$63, %r15d	# 15706	[c=4 l=4]  *cmpsi_1/0
+	leaq	.LC25(%rip), %rdx	# 16991	[c=1 l=7]  *movdi_internal/4
+	movl	%eax, %ecx	# 10318	[c=4 l=2]  *movsi_internal/0
+	movq	%r13, %rdi	# 10321	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC33(%rip), %rsi	# 16990	[c=1 l=7]  *movdi_internal/4
+	movl	%eax, 16(%rsp)	# 18497	[c=4 l=4]  *movsi_internal/1
+	cmovne	%rdx, %rsi	# 15707	[c=8 l=4]  *movdicc_noc/1
+	movl	%r15d, %edx	# 10319	[c=4 l=3]  *movsi_internal/0
+	call	log_add_data_mov@PLT	# 10322	[c=0 l=5]  *call
+	cmpl	6564(%r13), %r15d	# 10323	[c=13 l=7]  *cmpsi_1/1
+	movl	16(%rsp), %eax	# 18498	[c=9 l=4]  *movsi_internal/0
+	jnb	.L938	# 10324	[c=13 l=6]  *jcc
+	movslq	%r15d, %rdx	# 10326	[c=4 l=3]  *extendsidi2_rex64/1
+	cmpb	$0, 6568(%r13,%rdx)	# 10329	[c=14 l=9]  *cmpqi_ccno_1/1
+	jns	.L938	# 10330	[c=13 l=6]  *jcc
+.L939:
+	cmpl	$63, %r15d	# 15718	[c=4 l=4]  *cmpsi_1/0
+	movzbl	%r14b, %ecx	# 10336	[c=4 l=4]  *zero_extendqisi2/0
+	movl	%r15d, %edx	# 10343	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 10345	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC30(%rip), %rax	# 16993	[c=1 l=7]  *movdi_internal/4
+	leaq	.LC29(%rip), %rsi	# 16992	[c=1 l=7]  *movdi_internal/4
+	cmovne	%rax, %rsi	# 15719	[c=8 l=4]  *movdicc_noc/1
+	call	log_add_data_mov@PLT	# 10346	[c=0 l=5]  *call
+	movl	%r15d, %eax	# 17750	[c=4 l=3]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 10347	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 10348	[c=13 l=7]  *cmpsi_1/1
+	jb	.L941	# 10349	[c=13 l=2]  *jcc
+	movl	%r15d, %eax	# 17752	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %eax	# 10351	[c=4 l=3]  *ashrsi3_1/0
+	cltq	# 10352	[c=4 l=2]  *extendsidi2_rex64/0
+	cmpb	$0, 1080(%r13,%rax)	# 10353	[c=14 l=9]  *cmpqi_ccno_1/1
+	jne	.L942	# 10354	[c=13 l=6]  *jcc
+.L941:
+	movzbl	8(%rsp), %eax	# 10357	[c=13 l=5]  zero_extendqidi2/0
+	movq	1040(%r13), %rdx	# 10358	[c=9 l=7]  *movdi_internal/3
+	movb	%r14b, (%rdx,%rax)	# 10359	[c=4 l=4]  *movqi_internal/8
+.L943:
+	movq	%r13, %rdi	# 10371	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 10370	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 10372	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 17755	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 17756	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 10374	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18773	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 10375	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 10377	[c=4 l=3]  *cmpdi_1/0
+	jb	.L344	# 10378	[c=13 l=6]  *jcc
+	movl	0(%r13), %ebx	# 10380	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 10385	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 10381	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 10383	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 10384	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 10386	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 10387	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 10388	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 10391	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 17757	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 10392	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 10395	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 10396	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 20006	[c=10 l=4]  *indirect_jump
+.L938:
+	orl	%eax, %r14d	# 10333	[c=4 l=3]  *iorsi_1/0
+	jmp	.L939	# 20438	[c=1 l=5]  jump
+.L880:
+	movl	5176(%r13), %r15d	# 9452	[c=9 l=7]  *movsi_internal/0
+	movl	$61, %eax	# 9454	[c=4 l=5]  *movsi_internal/0
+	movl	5180(%r13), %r14d	# 9453	[c=9 l=7]  *movsi_internal/0
+	subl	%r15d, %eax	# 9455	[c=4 l=3]  *subsi_1/0
+	cmpl	%r14d, %eax	# 9456	[c=4 l=3]  *cmpsi_1/0
+	jb	.L881	# 9457	[c=13 l=6]  *jcc
+	cmpb	$1, 1081(%r13)	# 9461	[c=13 l=8]  *cmpqi_1/0
+	ja	.L1595	# 9462	[c=13 l=6]  *jcc
+	movq	1040(%r13), %rax	# 14341	[c=9 l=7]  *movdi_internal/3
+	movzbl	61(%rax), %edx	# 14342	[c=13 l=4]  *zero_extendqisi2/0
+.L883:
+	movzbl	62(%rax), %eax	# 9499	[c=13 l=4]  *zero_extendqisi2/0
+.L885:
+	sall	$8, %eax	# 9502	[c=4 l=3]  *ashlsi3_1/0
+	leaq	.LC31(%rip), %rsi	# 9506	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 9508	[c=4 l=3]  *movdi_internal/3
+	orl	%edx, %eax	# 9503	[c=4 l=2]  *iorsi_1/0
+	movl	$61, %edx	# 9505	[c=4 l=5]  *movsi_internal/0
+	movl	%eax, %ecx	# 9504	[c=4 l=2]  *movsi_internal/0
+	movl	%eax, %r15d	# 17683	[c=4 l=3]  *movsi_internal/0
+	call	log_add_data_mov@PLT	# 9509	[c=0 l=5]  *call
+	xorl	%r8d, %r8d	# 20023	[c=4 l=3]  *movdi_xor
+	cmpb	$0, 840(%r13)	# 9510	[c=13 l=8]  *cmpqi_ccno_1/1
+	je	.L886	# 9511	[c=13 l=2]  *jcc
+	addl	$1, %r15d	# 9513	[c=4 l=4]  *addsi_1/0
+	movl	%r15d, %eax	# 17684	[c=4 l=3]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 9514	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 9515	[c=13 l=7]  *cmpsi_1/1
+	jb	.L887	# 9516	[c=13 l=2]  *jcc
+	movl	%r15d, %eax	# 17686	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %eax	# 9518	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 16869	[c=5 l=5]  *andsi_1_zext
+	cmpb	$0, 1080(%r13,%rax)	# 9521	[c=14 l=9]  *cmpqi_ccno_1/1
+	jne	.L888	# 9522	[c=13 l=6]  *jcc
+.L887:
+	movq	1040(%r13), %rdx	# 9526	[c=9 l=7]  *movdi_internal/3
+	movslq	%r15d, %rax	# 9525	[c=4 l=3]  *extendsidi2_rex64/1
+	movzbl	(%rdx,%rax), %r14d	# 9527	[c=13 l=5]  *zero_extendqisi2/0
+.L889:
+	cmpl	$63, %r15d	# 15670	[c=4 l=4]  *cmpsi_1/0
+	movl	%r14d, %ecx	# 9543	[c=4 l=3]  *movsi_internal/0
+	movl	%r15d, %edx	# 9544	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 9546	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC25(%rip), %rax	# 16985	[c=1 l=7]  *movdi_internal/4
+	leaq	.LC33(%rip), %rsi	# 16984	[c=1 l=7]  *movdi_internal/4
+	cmovne	%rax, %rsi	# 15671	[c=8 l=4]  *movdicc_noc/1
+	call	log_add_data_mov@PLT	# 9547	[c=0 l=5]  *call
+	movl	%r14d, %r8d	# 17688	[c=4 l=3]  *movsi_internal/0
+	sall	$16, %r8d	# 9548	[c=4 l=4]  *ashlsi3_1/0
+.L886:
+	leal	1(%r15), %edx	# 18786	[c=4 l=4]  *leasi
+	movl	%edx, %eax	# 17690	[c=4 l=2]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 9552	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 9553	[c=13 l=7]  *cmpsi_1/1
+	jb	.L891	# 9554	[c=13 l=2]  *jcc
+	movl	%edx, %eax	# 17692	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %eax	# 9556	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 16868	[c=5 l=5]  *andsi_1_zext
+	cmpb	$0, 1080(%r13,%rax)	# 9559	[c=14 l=9]  *cmpqi_ccno_1/1
+	jne	.L892	# 9560	[c=13 l=6]  *jcc
+.L891:
+	movq	1040(%r13), %rcx	# 9564	[c=9 l=7]  *movdi_internal/3
+	movslq	%edx, %rax	# 9563	[c=4 l=3]  *extendsidi2_rex64/1
+	movzbl	(%rcx,%rax), %r14d	# 9565	[c=13 l=5]  *zero_extendqisi2/0
+.L893:
+	cmpl	$63, %edx	# 15682	[c=4 l=3]  *cmpsi_1/0
+	leaq	.LC25(%rip), %rax	# 16987	[c=1 l=7]  *movdi_internal/4
+	movl	%r14d, %ecx	# 9581	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 9584	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC33(%rip), %rsi	# 16986	[c=1 l=7]  *movdi_internal/4
+	movl	%r8d, 8(%rsp)	# 18460	[c=4 l=5]  *movsi_internal/1
+	cmovne	%rax, %rsi	# 15683	[c=8 l=4]  *movdicc_noc/1
+	sall	$8, %r14d	# 9586	[c=4 l=4]  *ashlsi3_1/0
+	call	log_add_data_mov@PLT	# 9585	[c=0 l=5]  *call
+	movl	8(%rsp), %r8d	# 18461	[c=9 l=5]  *movsi_internal/0
+	orl	%r8d, %r14d	# 9587	[c=4 l=3]  *iorsi_1/0
+	leal	2(%r15), %r8d	# 18785	[c=4 l=4]  *leasi
+	movl	%r8d, %eax	# 17694	[c=4 l=3]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 9589	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 9590	[c=13 l=7]  *cmpsi_1/1
+	jb	.L895	# 9591	[c=13 l=2]  *jcc
+	movl	%r8d, %eax	# 17696	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %eax	# 9593	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 16867	[c=5 l=5]  *andsi_1_zext
+	cmpb	$0, 1080(%r13,%rax)	# 9596	[c=14 l=9]  *cmpqi_ccno_1/1
+	jne	.L896	# 9597	[c=13 l=6]  *jcc
+.L895:
+	movq	1040(%r13), %rdx	# 9601	[c=9 l=7]  *movdi_internal/3
+	movslq	%r8d, %rax	# 9600	[c=4 l=3]  *extendsidi2_rex64/1
+	movzbl	(%rdx,%rax), %r15d	# 9602	[c=13 l=5]  *zero_extendqisi2/0
+.L897:
+	cmpl	$63, %r8d	# 15694	[c=4 l=4]  *cmpsi_1/0
+	movl	%r8d, %edx	# 9619	[c=4 l=3]  *movsi_internal/0
+	movl	%r15d, %ecx	# 9618	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 9621	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC25(%rip), %rax	# 16989	[c=1 l=7]  *movdi_internal/4
+	leaq	.LC33(%rip), %rsi	# 16988	[c=1 l=7]  *movdi_internal/4
+	movl	%r8d, 8(%rsp)	# 18464	[c=4 l=5]  *movsi_internal/1
+	cmovne	%rax, %rsi	# 15695	[c=8 l=4]  *movdicc_noc/1
+	orl	%r15d, %r14d	# 9623	[c=4 l=3]  *iorsi_1/0
+	call	log_add_data_mov@PLT	# 9622	[c=0 l=5]  *call
+	cmpl	%r14d, 992(%r13)	# 9624	[c=13 l=7]  *cmpsi_1/0
+	movl	8(%rsp), %r8d	# 18465	[c=9 l=5]  *movsi_internal/0
+	jb	.L1381	# 9625	[c=13 l=6]  *jcc
+	movzwl	%r8w, %r15d	# 9633	[c=4 l=4]  *zero_extendhisi2/0
+	movl	$61, %edx	# 9635	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 9638	[c=4 l=3]  *movdi_internal/3
+	movl	%r8d, 8(%rsp)	# 18466	[c=4 l=5]  *movsi_internal/1
+	movl	%r15d, %ecx	# 9634	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC32(%rip), %rsi	# 9636	[c=1 l=7]  *movdi_internal/4
+	call	log_add_data_mov@PLT	# 9639	[c=0 l=5]  *call
+	movl	$61, %eax	# 9640	[c=4 l=5]  *movsi_internal/0
+	movl	8(%rsp), %r8d	# 18467	[c=9 l=5]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 9641	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 9642	[c=13 l=7]  *cmpsi_1/1
+	jb	.L900	# 9643	[c=13 l=2]  *jcc
+	cmpb	$1, 1081(%r13)	# 9647	[c=13 l=8]  *cmpqi_1/0
+	ja	.L1596	# 9648	[c=13 l=6]  *jcc
+.L900:
+	movq	1040(%r13), %rax	# 9659	[c=9 l=7]  *movdi_internal/3
+	movb	%r8b, 61(%rax)	# 9660	[c=4 l=4]  *movqi_internal/8
+.L901:
+	movl	$62, %eax	# 9664	[c=4 l=5]  *movsi_internal/0
+	sarl	$8, %r15d	# 9663	[c=4 l=4]  *ashrsi3_1/0
+	subl	5176(%r13), %eax	# 9665	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 9666	[c=13 l=7]  *cmpsi_1/1
+	jb	.L902	# 9667	[c=13 l=2]  *jcc
+	cmpb	$1, 1081(%r13)	# 9671	[c=13 l=8]  *cmpqi_1/0
+	ja	.L1597	# 9672	[c=13 l=6]  *jcc
+.L902:
+	movq	1040(%r13), %rax	# 9682	[c=9 l=7]  *movdi_internal/3
+	movb	%r15b, 62(%rax)	# 9683	[c=4 l=4]  *movqi_internal/8
+.L903:
+	movzbl	840(%r13), %eax	# 9687	[c=13 l=8]  zero_extendqidi2/0
+	movl	%r14d, 0(%r13)	# 9686	[c=4 l=4]  *movsi_internal/1
+	addq	%rax, 48(%r13)	# 9688	[c=13 l=4]  *adddi_1/0
+	movl	$63, %eax	# 9689	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 9690	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 9691	[c=13 l=7]  *cmpsi_1/1
+	jb	.L904	# 9692	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%r13)	# 9694	[c=13 l=8]  *cmpqi_ccno_1/1
+	jne	.L905	# 9695	[c=13 l=6]  *jcc
+.L904:
+	movq	1040(%r13), %rax	# 9698	[c=9 l=7]  *movdi_internal/3
+	movzbl	63(%rax), %r15d	# 9699	[c=13 l=5]  *zero_extendqisi2/0
+.L906:
+	movl	%r15d, %ecx	# 9710	[c=4 l=3]  *movsi_internal/0
+	movl	$63, %edx	# 9711	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 9714	[c=4 l=3]  *movdi_internal/3
+	movl	%r15d, %r14d	# 17698	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC33(%rip), %rsi	# 9712	[c=1 l=7]  *movdi_internal/4
+	orb	$-128, %r14b	# 18779	[c=4 l=4]  *iorqi_1_slp/0
+	call	log_add_data_mov@PLT	# 9715	[c=0 l=5]  *call
+	movl	%r15d, %ecx	# 17700	[c=4 l=3]  *movsi_internal/0
+	movl	$63, %edx	# 9721	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 9724	[c=4 l=3]  *movdi_internal/3
+	andl	$127, %ecx	# 9718	[c=4 l=3]  *andsi_1/0
+	leaq	.LC29(%rip), %rsi	# 9722	[c=1 l=7]  *movdi_internal/4
+	orb	$-128, %cl	# 18782	[c=4 l=3]  *iorqi_1_slp/0
+	call	log_add_data_mov@PLT	# 9725	[c=0 l=5]  *call
+	movl	$63, %eax	# 9726	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 9727	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 9728	[c=13 l=7]  *cmpsi_1/1
+	jb	.L907	# 9729	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%r13)	# 9731	[c=13 l=8]  *cmpqi_ccno_1/1
+	jne	.L908	# 9732	[c=13 l=6]  *jcc
+.L907:
+	movq	1040(%r13), %rax	# 9735	[c=9 l=7]  *movdi_internal/3
+	movb	%r14b, 63(%rax)	# 9736	[c=4 l=4]  *movqi_internal/8
+.L909:
+	movq	48(%r13), %rax	# 9747	[c=9 l=4]  *movdi_internal/3
+	movq	%r13, %rdi	# 9750	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 9749	[c=4 l=3]  *movdi_internal/3
+	movq	%rax, 6024(%r13)	# 9748	[c=4 l=7]  *movdi_internal/5
+	call	log_dump_line@PLT	# 9751	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 17702	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 17703	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 9753	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18778	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 9754	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 9756	[c=4 l=3]  *cmpdi_1/0
+	jb	.L344	# 9757	[c=13 l=6]  *jcc
+	movq	56(%r13), %rax	# 17704	[c=9 l=4]  *movdi_internal/3
+	cmpq	%rax, 48(%r13)	# 9760	[c=13 l=4]  *cmpdi_1/0
+	jnb	.L1598	# 9761	[c=13 l=6]  *jcc
+.L910:
+	movq	%r13, %rdi	# 9767	[c=4 l=3]  *movdi_internal/3
+	call	log_is_idle@PLT	# 9768	[c=10 l=5]  *call_value
+	testb	%al, %al	# 9770	[c=4 l=2]  *cmpqi_ccno_1/0
+	jne	.L1599	# 9771	[c=13 l=6]  *jcc
+.L911:
+	movl	0(%r13), %ebx	# 9782	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 9787	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 9783	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 9785	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 9786	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 9788	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 9789	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 9790	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 9793	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 17705	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 9794	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 9797	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 9798	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 20022	[c=10 l=4]  *indirect_jump
+.L912:
+	movswl	12(%rbx), %eax	# 9806	[c=13 l=4]  extendhisi2/1
+	cmpw	$-1, %ax	# 9807	[c=4 l=4]  *cmphi_1/0
+	je	.L1600	# 9808	[c=13 l=6]  *jcc
+	addl	0(%r13), %eax	# 9821	[c=9 l=4]  *addsi_1/1
+	andl	992(%r13), %eax	# 9824	[c=13 l=7]  *andsi_1/1
+	movq	%r13, %rdi	# 9827	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 9826	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, 0(%r13)	# 9825	[c=4 l=4]  *movsi_internal/1
+	call	log_dump_line@PLT	# 9828	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 17707	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 17708	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 9830	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18777	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 9831	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 9833	[c=4 l=3]  *cmpdi_1/0
+	jb	.L344	# 9834	[c=13 l=6]  *jcc
+	movq	56(%r13), %rax	# 17709	[c=9 l=4]  *movdi_internal/3
+	cmpq	%rax, 48(%r13)	# 9837	[c=13 l=4]  *cmpdi_1/0
+	jnb	.L1601	# 9838	[c=13 l=6]  *jcc
+.L914:
+	movq	%r13, %rdi	# 9844	[c=4 l=3]  *movdi_internal/3
+	call	log_is_idle@PLT	# 9845	[c=10 l=5]  *call_value
+	testb	%al, %al	# 9847	[c=4 l=2]  *cmpqi_ccno_1/0
+	jne	.L1602	# 9848	[c=13 l=6]  *jcc
+.L915:
+	movl	0(%r13), %ebx	# 9859	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 9864	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 9860	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 9862	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 9863	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 9865	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 9866	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 9867	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 9870	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 17710	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 9871	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 9874	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 9875	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 20019	[c=10 l=4]  *indirect_jump
+.L749:
+	movzwl	12(%rbx), %r15d	# 7444	[c=13 l=5]  zero_extendhidi2/0
+	movzbl	10(%rbx), %r14d	# 7445	[c=13 l=5]  *zero_extendqisi2/0
+	movq	%r13, %rdi	# 7452	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 20071	[c=4 l=2]  *movdi_xor
+	leaq	.LC35(%rip), %rsi	# 7450	[c=1 l=7]  *movdi_internal/4
+	movzbl	1004(%r13,%r15), %ecx	# 7447	[c=14 l=9]  *zero_extendqisi2/0
+	movq	%r15, %rdx	# 19179	[c=4 l=3]  *movdi_internal/3
+	call	log_append@PLT	# 7454	[c=0 l=5]  *call
+	movl	%r14d, %edx	# 7459	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 7462	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 20072	[c=4 l=2]  *movdi_xor
+	movzbl	1004(%r13,%r15), %ecx	# 7456	[c=14 l=9]  *zero_extendqisi2/0
+	leaq	.LC36(%rip), %rsi	# 7460	[c=1 l=7]  *movdi_internal/4
+	movl	%ecx, %r15d	# 19180	[c=4 l=3]  *movsi_internal/0
+	call	log_append@PLT	# 7464	[c=0 l=5]  *call
+	movslq	%r14d, %rax	# 7465	[c=4 l=3]  *extendsidi2_rex64/1
+	movq	%r13, %rdi	# 7468	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 7467	[c=4 l=3]  *movdi_internal/3
+	movb	%r15b, 1004(%r13,%rax)	# 7466	[c=4 l=8]  *movqi_internal/8
+	call	log_dump_line@PLT	# 7469	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 17539	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 17540	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 7471	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18811	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 7472	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 7474	[c=4 l=3]  *cmpdi_1/0
+	jb	.L344	# 7475	[c=13 l=6]  *jcc
+	movl	0(%r13), %ebx	# 7477	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 7482	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 7478	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 7480	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 7481	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 7483	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 7484	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 7485	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 7488	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 17541	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 7489	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 7492	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 7493	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 20070	[c=10 l=4]  *indirect_jump
+.L750:
+	movzwl	12(%rbx), %edx	# 7501	[c=13 l=4]  *zero_extendhisi2/0
+	movzbl	10(%rbx), %r14d	# 7502	[c=13 l=5]  *zero_extendqisi2/0
+	leaq	.LC34(%rip), %rsi	# 7512	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 7514	[c=4 l=3]  *movdi_internal/3
+	leal	1(%rdx), %eax	# 18808	[c=4 l=3]  *leasi
+	cltq	# 7504	[c=4 l=2]  *extendsidi2_rex64/0
+	movzbl	1004(%r13,%rax), %r15d	# 7505	[c=14 l=9]  *zero_extendqisi2/0
+	movslq	%edx, %rax	# 7507	[c=4 l=3]  *extendsidi2_rex64/1
+	movzbl	1004(%r13,%rax), %eax	# 7508	[c=14 l=9]  *zero_extendqisi2/0
+	sall	$8, %r15d	# 7506	[c=4 l=4]  *ashlsi3_1/0
+	orl	%eax, %r15d	# 7509	[c=4 l=3]  *iorsi_1/0
+	xorl	%eax, %eax	# 20068	[c=4 l=2]  *movdi_xor
+	movl	%r15d, %ecx	# 7510	[c=4 l=3]  *movsi_internal/0
+	call	log_append@PLT	# 7516	[c=0 l=5]  *call
+	movl	%r14d, %edx	# 7518	[c=4 l=3]  *movsi_internal/0
+	movl	%r15d, %ecx	# 7517	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 7521	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC37(%rip), %rsi	# 7519	[c=1 l=7]  *movdi_internal/4
+	xorl	%eax, %eax	# 20069	[c=4 l=2]  *movdi_xor
+	call	log_append@PLT	# 7523	[c=0 l=5]  *call
+	movslq	%r14d, %rax	# 7524	[c=4 l=3]  *extendsidi2_rex64/1
+	movl	%r15d, %ecx	# 17544	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 7531	[c=4 l=3]  *movdi_internal/3
+	movb	%r15b, 1004(%r13,%rax)	# 7525	[c=4 l=8]  *movqi_internal/8
+	leal	1(%r14), %eax	# 18809	[c=4 l=4]  *leasi
+	movzbl	%ch, %ecx	# 7529	[c=4 l=3]  *extzvqi/0
+	movq	%rbx, %rsi	# 7530	[c=4 l=3]  *movdi_internal/3
+	cltq	# 7527	[c=4 l=2]  *extendsidi2_rex64/0
+	movb	%cl, 1004(%r13,%rax)	# 17543	[c=4 l=8]  *movqi_internal/8
+	call	log_dump_line@PLT	# 7532	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 17545	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 17546	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 7534	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18810	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 7535	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 7537	[c=4 l=3]  *cmpdi_1/0
+	jb	.L344	# 7538	[c=13 l=6]  *jcc
+	movl	0(%r13), %ebx	# 7540	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 7545	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 7541	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 7543	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 7544	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 7546	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 7547	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 7548	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 7551	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 17547	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 7552	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 7555	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 7556	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 20067	[c=10 l=4]  *indirect_jump
+.L697:
+	cmpb	$0, 844(%r13)	# 6457	[c=13 l=8]  *cmpqi_ccno_1/1
+	movzbl	10(%rbx), %r14d	# 6456	[c=13 l=5]  zero_extendqidi2/0
+	jne	.L1603	# 6458	[c=13 l=6]  *jcc
+	movzwl	1030(%r13), %r15d	# 6471	[c=13 l=8]  *zero_extendhisi2/0
+	xorl	%eax, %eax	# 20122	[c=4 l=2]  *movdi_xor
+	movl	$26, %edx	# 6473	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 6476	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC34(%rip), %rsi	# 6474	[c=1 l=7]  *movdi_internal/4
+	movl	%r15d, %ecx	# 6472	[c=4 l=3]  *movsi_internal/0
+	subl	$1, %r15d	# 6479	[c=4 l=4]  *addsi_1/0
+	call	log_append@PLT	# 6478	[c=0 l=5]  *call
+	movl	%r15d, %eax	# 17465	[c=4 l=3]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 6480	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 6481	[c=13 l=7]  *cmpsi_1/1
+	jb	.L700	# 6482	[c=13 l=2]  *jcc
+	movl	%r15d, %eax	# 17467	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %eax	# 6484	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 16880	[c=5 l=5]  *andsi_1_zext
+	cmpb	$0, 1080(%r13,%rax)	# 6487	[c=14 l=9]  *cmpqi_ccno_1/1
+	jne	.L701	# 6488	[c=13 l=6]  *jcc
+.L700:
+	movq	1040(%r13), %rdx	# 6492	[c=9 l=7]  *movdi_internal/3
+	movslq	%r15d, %rax	# 6491	[c=4 l=3]  *extendsidi2_rex64/1
+	movzbl	(%rdx,%rax), %eax	# 6493	[c=13 l=4]  *zero_extendqisi2/0
+	movl	%eax, 8(%rsp)	# 17469	[c=4 l=4]  *movsi_internal/1
+.L702:
+	cmpl	$63, %r15d	# 15490	[c=4 l=4]  *cmpsi_1/0
+	movl	8(%rsp), %ecx	# 6509	[c=9 l=4]  *movsi_internal/0
+	movl	%r15d, %edx	# 6510	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 6512	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC25(%rip), %rax	# 16955	[c=1 l=7]  *movdi_internal/4
+	leaq	.LC33(%rip), %rsi	# 16954	[c=1 l=7]  *movdi_internal/4
+	cmovne	%rax, %rsi	# 15491	[c=8 l=4]  *movdicc_noc/1
+	call	log_add_data_mov@PLT	# 6513	[c=0 l=5]  *call
+	movzbl	8(%rsp), %ecx	# 6514	[c=13 l=5]  *zero_extendqisi2/0
+	movl	%r14d, %edx	# 6516	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 6519	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC36(%rip), %rsi	# 6517	[c=1 l=7]  *movdi_internal/4
+	xorl	%eax, %eax	# 20120	[c=4 l=2]  *movdi_xor
+	call	log_append@PLT	# 6521	[c=0 l=5]  *call
+	movzbl	8(%rsp), %eax	# 17470	[c=9 l=5]  *movqi_internal/4
+	movzwl	%r15w, %ecx	# 6524	[c=4 l=4]  *zero_extendhisi2/0
+	movl	$26, %edx	# 6526	[c=4 l=5]  *movsi_internal/0
+	leaq	.LC37(%rip), %rsi	# 6527	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 6529	[c=4 l=3]  *movdi_internal/3
+	movb	%al, 1004(%r13,%r14)	# 6523	[c=4 l=8]  *movqi_internal/8
+	xorl	%eax, %eax	# 20121	[c=4 l=2]  *movdi_xor
+	call	log_append@PLT	# 6531	[c=0 l=5]  *call
+	movw	%r15w, 1030(%r13)	# 6532	[c=4 l=8]  *movhi_internal/3
+.L699:
+	movq	%r13, %rdi	# 6536	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 6535	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 6537	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 17471	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 17472	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 6539	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18824	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 6540	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 6542	[c=4 l=3]  *cmpdi_1/0
+	jb	.L344	# 6543	[c=13 l=6]  *jcc
+	movl	0(%r13), %ebx	# 6545	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 6550	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 6546	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 6548	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 6549	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 6551	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 6552	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 6553	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 6556	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 17473	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 6557	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 6560	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 6561	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 20119	[c=10 l=4]  *indirect_jump
+.L704:
+	cmpb	$0, 844(%r13)	# 6570	[c=13 l=8]  *cmpqi_ccno_1/1
+	movzbl	10(%rbx), %r14d	# 6569	[c=13 l=5]  zero_extendqidi2/0
+	jne	.L1604	# 6571	[c=13 l=6]  *jcc
+	movzwl	1030(%r13), %r8d	# 6584	[c=13 l=8]  *zero_extendhisi2/0
+	xorl	%eax, %eax	# 20116	[c=4 l=2]  *movdi_xor
+	movl	$26, %edx	# 6587	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 6590	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC34(%rip), %rsi	# 6588	[c=1 l=7]  *movdi_internal/4
+	movl	%r8d, %ecx	# 6586	[c=4 l=3]  *movsi_internal/0
+	movl	%r8d, 8(%rsp)	# 18353	[c=4 l=5]  *movsi_internal/1
+	movl	%r8d, %r15d	# 19172	[c=4 l=3]  *movsi_internal/0
+	call	log_append@PLT	# 6592	[c=0 l=5]  *call
+	movl	8(%rsp), %r8d	# 18354	[c=9 l=5]  *movsi_internal/0
+	movl	%r8d, %eax	# 17475	[c=4 l=3]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 6594	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 6595	[c=13 l=7]  *cmpsi_1/1
+	jb	.L707	# 6596	[c=13 l=2]  *jcc
+	movl	%r8d, %eax	# 17477	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %eax	# 6598	[c=4 l=3]  *ashrsi3_1/0
+	cltq	# 6599	[c=4 l=2]  *extendsidi2_rex64/0
+	cmpb	$0, 1080(%r13,%rax)	# 6600	[c=14 l=9]  *cmpqi_ccno_1/1
+	jne	.L708	# 6601	[c=13 l=6]  *jcc
+.L707:
+	movq	1040(%r13), %rdx	# 6605	[c=9 l=7]  *movdi_internal/3
+	movzwl	%r15w, %eax	# 6604	[c=4 l=4]  zero_extendhidi2/0
+	movzbl	(%rdx,%rax), %r15d	# 6606	[c=13 l=5]  *zero_extendqisi2/0
+.L709:
+	cmpl	$63, %r8d	# 15502	[c=4 l=4]  *cmpsi_1/0
+	movl	%r8d, %edx	# 6623	[c=4 l=3]  *movsi_internal/0
+	movl	%r15d, %ecx	# 6622	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 6625	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC25(%rip), %rax	# 16957	[c=1 l=7]  *movdi_internal/4
+	leaq	.LC33(%rip), %rsi	# 16956	[c=1 l=7]  *movdi_internal/4
+	movl	%r8d, 8(%rsp)	# 18357	[c=4 l=5]  *movsi_internal/1
+	cmovne	%rax, %rsi	# 15503	[c=8 l=4]  *movdicc_noc/1
+	call	log_add_data_mov@PLT	# 6626	[c=0 l=5]  *call
+	movl	%r14d, %edx	# 6629	[c=4 l=3]  *movsi_internal/0
+	movzbl	%r15b, %ecx	# 6627	[c=4 l=4]  *zero_extendqisi2/0
+	movq	%r13, %rdi	# 6632	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC36(%rip), %rsi	# 6630	[c=1 l=7]  *movdi_internal/4
+	xorl	%eax, %eax	# 20114	[c=4 l=2]  *movdi_xor
+	call	log_append@PLT	# 6634	[c=0 l=5]  *call
+	movl	8(%rsp), %r8d	# 18358	[c=9 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 6644	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 20115	[c=4 l=2]  *movdi_xor
+	movb	%r15b, 1004(%r13,%r14)	# 6636	[c=4 l=8]  *movqi_internal/8
+	movl	$26, %edx	# 6641	[c=4 l=5]  *movsi_internal/0
+	leaq	.LC37(%rip), %rsi	# 6642	[c=1 l=7]  *movdi_internal/4
+	subq	$1, 48(%r13)	# 6637	[c=13 l=5]  *adddi_1/0
+	leal	1(%r8), %r14d	# 18823	[c=4 l=4]  *leasi
+	movzwl	%r14w, %ecx	# 6639	[c=4 l=4]  *zero_extendhisi2/0
+	call	log_append@PLT	# 6646	[c=0 l=5]  *call
+	movw	%r14w, 1030(%r13)	# 6647	[c=4 l=8]  *movhi_internal/3
+.L706:
+	movq	%r13, %rdi	# 6651	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 6650	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 6652	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 17479	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 17480	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 6654	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18822	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 6655	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 6657	[c=4 l=3]  *cmpdi_1/0
+	jb	.L344	# 6658	[c=13 l=6]  *jcc
+	movl	0(%r13), %ebx	# 6660	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 6665	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 6661	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 6663	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 6664	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 6666	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 6667	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 6668	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 6671	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 17481	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 6672	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 6675	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 6676	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 20113	[c=10 l=4]  *indirect_jump
+.L725:
+	cmpb	$0, 844(%r13)	# 6913	[c=13 l=8]  *cmpqi_ccno_1/1
+	movzbl	10(%rbx), %r14d	# 6912	[c=13 l=5]  zero_extendqidi2/0
+	jne	.L1605	# 6914	[c=13 l=6]  *jcc
+	movzwl	1034(%r13), %r15d	# 6927	[c=13 l=8]  *zero_extendhisi2/0
+	xorl	%eax, %eax	# 20096	[c=4 l=2]  *movdi_xor
+	movl	$30, %edx	# 6929	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 6932	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC34(%rip), %rsi	# 6930	[c=1 l=7]  *movdi_internal/4
+	movl	%r15d, %ecx	# 6928	[c=4 l=3]  *movsi_internal/0
+	subl	$1, %r15d	# 6935	[c=4 l=4]  *addsi_1/0
+	call	log_append@PLT	# 6934	[c=0 l=5]  *call
+	movl	%r15d, %eax	# 17501	[c=4 l=3]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 6936	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 6937	[c=13 l=7]  *cmpsi_1/1
+	jb	.L728	# 6938	[c=13 l=2]  *jcc
+	movl	%r15d, %eax	# 17503	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %eax	# 6940	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 16878	[c=5 l=5]  *andsi_1_zext
+	cmpb	$0, 1080(%r13,%rax)	# 6943	[c=14 l=9]  *cmpqi_ccno_1/1
+	jne	.L729	# 6944	[c=13 l=6]  *jcc
+.L728:
+	movq	1040(%r13), %rdx	# 6948	[c=9 l=7]  *movdi_internal/3
+	movslq	%r15d, %rax	# 6947	[c=4 l=3]  *extendsidi2_rex64/1
+	movzbl	(%rdx,%rax), %eax	# 6949	[c=13 l=4]  *zero_extendqisi2/0
+	movl	%eax, 8(%rsp)	# 17505	[c=4 l=4]  *movsi_internal/1
+.L730:
+	cmpl	$63, %r15d	# 15538	[c=4 l=4]  *cmpsi_1/0
+	movl	8(%rsp), %ecx	# 6965	[c=9 l=4]  *movsi_internal/0
+	movl	%r15d, %edx	# 6966	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 6968	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC25(%rip), %rax	# 16963	[c=1 l=7]  *movdi_internal/4
+	leaq	.LC33(%rip), %rsi	# 16962	[c=1 l=7]  *movdi_internal/4
+	cmovne	%rax, %rsi	# 15539	[c=8 l=4]  *movdicc_noc/1
+	call	log_add_data_mov@PLT	# 6969	[c=0 l=5]  *call
+	movzbl	8(%rsp), %ecx	# 6970	[c=13 l=5]  *zero_extendqisi2/0
+	movl	%r14d, %edx	# 6972	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 6975	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC36(%rip), %rsi	# 6973	[c=1 l=7]  *movdi_internal/4
+	xorl	%eax, %eax	# 20094	[c=4 l=2]  *movdi_xor
+	call	log_append@PLT	# 6977	[c=0 l=5]  *call
+	movzbl	8(%rsp), %eax	# 17506	[c=9 l=5]  *movqi_internal/4
+	movzwl	%r15w, %ecx	# 6980	[c=4 l=4]  *zero_extendhisi2/0
+	movl	$30, %edx	# 6982	[c=4 l=5]  *movsi_internal/0
+	leaq	.LC37(%rip), %rsi	# 6983	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 6985	[c=4 l=3]  *movdi_internal/3
+	movb	%al, 1004(%r13,%r14)	# 6979	[c=4 l=8]  *movqi_internal/8
+	xorl	%eax, %eax	# 20095	[c=4 l=2]  *movdi_xor
+	call	log_append@PLT	# 6987	[c=0 l=5]  *call
+	movw	%r15w, 1034(%r13)	# 6988	[c=4 l=8]  *movhi_internal/3
+.L727:
+	movq	%r13, %rdi	# 6992	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 6991	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 6993	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 17507	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 17508	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 6995	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18818	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 6996	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 6998	[c=4 l=3]  *cmpdi_1/0
+	jb	.L344	# 6999	[c=13 l=6]  *jcc
+	movl	0(%r13), %ebx	# 7001	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 7006	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 7002	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 7004	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 7005	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 7007	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 7008	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 7009	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 7012	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 17509	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 7013	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 7016	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 7017	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 20093	[c=10 l=4]  *indirect_jump
+.L732:
+	cmpb	$0, 844(%r13)	# 7026	[c=13 l=8]  *cmpqi_ccno_1/1
+	movzbl	10(%rbx), %r14d	# 7025	[c=13 l=5]  zero_extendqidi2/0
+	jne	.L1606	# 7027	[c=13 l=6]  *jcc
+	movzwl	1034(%r13), %r8d	# 7040	[c=13 l=8]  *zero_extendhisi2/0
+	xorl	%eax, %eax	# 20090	[c=4 l=2]  *movdi_xor
+	movl	$30, %edx	# 7043	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 7046	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC34(%rip), %rsi	# 7044	[c=1 l=7]  *movdi_internal/4
+	movl	%r8d, %ecx	# 7042	[c=4 l=3]  *movsi_internal/0
+	movl	%r8d, 8(%rsp)	# 18369	[c=4 l=5]  *movsi_internal/1
+	movl	%r8d, %r15d	# 19174	[c=4 l=3]  *movsi_internal/0
+	call	log_append@PLT	# 7048	[c=0 l=5]  *call
+	movl	8(%rsp), %r8d	# 18370	[c=9 l=5]  *movsi_internal/0
+	movl	%r8d, %eax	# 17511	[c=4 l=3]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 7050	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 7051	[c=13 l=7]  *cmpsi_1/1
+	jb	.L735	# 7052	[c=13 l=2]  *jcc
+	movl	%r8d, %eax	# 17513	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %eax	# 7054	[c=4 l=3]  *ashrsi3_1/0
+	cltq	# 7055	[c=4 l=2]  *extendsidi2_rex64/0
+	cmpb	$0, 1080(%r13,%rax)	# 7056	[c=14 l=9]  *cmpqi_ccno_1/1
+	jne	.L736	# 7057	[c=13 l=6]  *jcc
+.L735:
+	movq	1040(%r13), %rdx	# 7061	[c=9 l=7]  *movdi_internal/3
+	movzwl	%r15w, %eax	# 7060	[c=4 l=4]  zero_extendhidi2/0
+	movzbl	(%rdx,%rax), %r15d	# 7062	[c=13 l=5]  *zero_extendqisi2/0
+.L737:
+	cmpl	$63, %r8d	# 15550	[c=4 l=4]  *cmpsi_1/0
+	movl	%r8d, %edx	# 7079	[c=4 l=3]  *movsi_internal/0
+	movl	%r15d, %ecx	# 7078	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 7081	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC25(%rip), %rax	# 16965	[c=1 l=7]  *movdi_internal/4
+	leaq	.LC33(%rip), %rsi	# 16964	[c=1 l=7]  *movdi_internal/4
+	movl	%r8d, 8(%rsp)	# 18373	[c=4 l=5]  *movsi_internal/1
+	cmovne	%rax, %rsi	# 15551	[c=8 l=4]  *movdicc_noc/1
+	call	log_add_data_mov@PLT	# 7082	[c=0 l=5]  *call
+	movl	%r14d, %edx	# 7085	[c=4 l=3]  *movsi_internal/0
+	movzbl	%r15b, %ecx	# 7083	[c=4 l=4]  *zero_extendqisi2/0
+	movq	%r13, %rdi	# 7088	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC36(%rip), %rsi	# 7086	[c=1 l=7]  *movdi_internal/4
+	xorl	%eax, %eax	# 20088	[c=4 l=2]  *movdi_xor
+	call	log_append@PLT	# 7090	[c=0 l=5]  *call
+	movl	8(%rsp), %r8d	# 18374	[c=9 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 7100	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 20089	[c=4 l=2]  *movdi_xor
+	movb	%r15b, 1004(%r13,%r14)	# 7092	[c=4 l=8]  *movqi_internal/8
+	movl	$30, %edx	# 7097	[c=4 l=5]  *movsi_internal/0
+	leaq	.LC37(%rip), %rsi	# 7098	[c=1 l=7]  *movdi_internal/4
+	subq	$1, 48(%r13)	# 7093	[c=13 l=5]  *adddi_1/0
+	leal	1(%r8), %r14d	# 18817	[c=4 l=4]  *leasi
+	movzwl	%r14w, %ecx	# 7095	[c=4 l=4]  *zero_extendhisi2/0
+	call	log_append@PLT	# 7102	[c=0 l=5]  *call
+	movw	%r14w, 1034(%r13)	# 7103	[c=4 l=8]  *movhi_internal/3
+.L734:
+	movq	%r13, %rdi	# 7107	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 7106	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 7108	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 17515	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 17516	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 7110	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18816	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 7111	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 7113	[c=4 l=3]  *cmpdi_1/0
+	jb	.L344	# 7114	[c=13 l=6]  *jcc
+	movl	0(%r13), %ebx	# 7116	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 7121	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 7117	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 7119	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 7120	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 7122	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 7123	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 7124	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 7127	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 17517	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 7128	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 7131	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 7132	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 20087	[c=10 l=4]  *indirect_jump
+.L741:
+	movl	$30, %edx	# 7261	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 7264	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 20077	[c=4 l=2]  *movdi_xor
+	movzbl	10(%rbx), %r15d	# 7258	[c=13 l=5]  zero_extendqidi2/0
+	movzwl	1034(%r13), %r14d	# 7259	[c=13 l=8]  *zero_extendhisi2/0
+	leaq	.LC34(%rip), %rsi	# 7262	[c=1 l=7]  *movdi_internal/4
+	movl	%r14d, %ecx	# 7260	[c=4 l=3]  *movsi_internal/0
+	call	log_append@PLT	# 7266	[c=0 l=5]  *call
+	movl	992(%r13), %eax	# 7267	[c=9 l=7]  *movsi_internal/0
+	movq	1056(%r13), %rdx	# 7272	[c=9 l=7]  *movdi_internal/3
+	movq	%r13, %rdi	# 7279	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC36(%rip), %rsi	# 7277	[c=1 l=7]  *movdi_internal/4
+	leal	1(%rax,%rax), %eax	# 7269	[c=8 l=4]  *leasi
+	andl	%r14d, %eax	# 7270	[c=4 l=3]  *andsi_1/0
+	addl	$1, %r14d	# 7284	[c=4 l=4]  *addsi_1/0
+	cltq	# 7271	[c=4 l=2]  *extendsidi2_rex64/0
+	movzbl	(%rdx,%rax), %ecx	# 7273	[c=13 l=4]  *zero_extendqisi2/0
+	movl	%r15d, %edx	# 7276	[c=4 l=3]  *movsi_internal/0
+	xorl	%eax, %eax	# 20078	[c=4 l=2]  *movdi_xor
+	movb	%cl, 8(%rsp)	# 18375	[c=4 l=4]  *movqi_internal/8
+	call	log_append@PLT	# 7281	[c=0 l=5]  *call
+	movzbl	8(%rsp), %r8d	# 18376	[c=9 l=6]  *movqi_internal/4
+	xorl	%eax, %eax	# 20079	[c=4 l=2]  *movdi_xor
+	movq	%r13, %rdi	# 7290	[c=4 l=3]  *movdi_internal/3
+	movl	$30, %edx	# 7287	[c=4 l=5]  *movsi_internal/0
+	movzwl	%r14w, %ecx	# 7285	[c=4 l=4]  *zero_extendhisi2/0
+	leaq	.LC37(%rip), %rsi	# 7288	[c=1 l=7]  *movdi_internal/4
+	movb	%r8b, 1004(%r13,%r15)	# 7283	[c=4 l=8]  *movqi_internal/8
+	call	log_append@PLT	# 7292	[c=0 l=5]  *call
+	movw	%r14w, 1034(%r13)	# 7293	[c=4 l=8]  *movhi_internal/3
+	movq	%r13, %rdi	# 7295	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 7294	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 7296	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 17527	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 17528	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 7298	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18813	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 7299	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 7301	[c=4 l=3]  *cmpdi_1/0
+	jb	.L344	# 7302	[c=13 l=6]  *jcc
+	movl	0(%r13), %ebx	# 7304	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 7309	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 7305	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 7307	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 7308	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 7310	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 7311	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 7312	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 7315	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 17529	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 7316	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 7319	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 7320	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 20076	[c=10 l=4]  *indirect_jump
+.L742:
+	movzbl	10(%rbx), %r15d	# 7328	[c=13 l=5]  zero_extendqidi2/0
+	leaq	.LC35(%rip), %rsi	# 7333	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 7335	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 20074	[c=4 l=2]  *movdi_xor
+	movzbl	1004(%r13,%r15), %ecx	# 7330	[c=14 l=9]  *zero_extendqisi2/0
+	movl	%r15d, %edx	# 7332	[c=4 l=3]  *movsi_internal/0
+	call	log_append@PLT	# 7337	[c=0 l=5]  *call
+	movl	%r15d, %edx	# 7342	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC36(%rip), %rsi	# 7343	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 7345	[c=4 l=3]  *movdi_internal/3
+	movzbl	1004(%r13,%r15), %eax	# 7339	[c=14 l=9]  *zero_extendqisi2/0
+	movl	%eax, %ecx	# 17532	[c=4 l=2]  *movsi_internal/0
+	movl	%eax, 8(%rsp)	# 18379	[c=4 l=4]  *movsi_internal/1
+	xorl	%eax, %eax	# 20075	[c=4 l=2]  *movdi_xor
+	sarl	%ecx	# 7340	[c=4 l=2]  *ashrsi3_1/0
+	movl	%ecx, 16(%rsp)	# 18377	[c=4 l=4]  *movsi_internal/1
+	call	log_append@PLT	# 7347	[c=0 l=5]  *call
+	movl	16(%rsp), %ecx	# 18378	[c=9 l=4]  *movsi_internal/0
+	movl	$63, %eax	# 7350	[c=4 l=5]  *movsi_internal/0
+	movb	%cl, 1004(%r13,%r15)	# 7349	[c=4 l=8]  *movqi_internal/8
+	subl	5176(%r13), %eax	# 7351	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 7352	[c=13 l=7]  *cmpsi_1/1
+	jb	.L743	# 7353	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%r13)	# 7355	[c=13 l=8]  *cmpqi_ccno_1/1
+	jne	.L744	# 7356	[c=13 l=6]  *jcc
+.L743:
+	movq	1040(%r13), %rax	# 7359	[c=9 l=7]  *movdi_internal/3
+	movzbl	63(%rax), %r14d	# 7360	[c=13 l=5]  *zero_extendqisi2/0
+.L745:
+	movl	%r14d, %ecx	# 7371	[c=4 l=3]  *movsi_internal/0
+	movl	$63, %edx	# 7372	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 7375	[c=4 l=3]  *movdi_internal/3
+	andl	$-32, %r14d	# 7377	[c=4 l=4]  *andsi_1/0
+	leaq	.LC33(%rip), %rsi	# 7373	[c=1 l=7]  *movdi_internal/4
+	call	log_add_data_mov@PLT	# 7376	[c=0 l=5]  *call
+	movslq	8(%rsp), %r15	# 7379	[c=13 l=5]  *extendsidi2_rex64/1
+	movq	%r13, %rdi	# 7387	[c=4 l=3]  *movdi_internal/3
+	leaq	flag_update_table_ror8(%rip), %rax	# 16906	[c=1 l=7]  *movdi_internal/4
+	movl	$63, %edx	# 7384	[c=4 l=5]  *movsi_internal/0
+	leaq	.LC29(%rip), %rsi	# 7385	[c=1 l=7]  *movdi_internal/4
+	movzbl	(%rax,%r15), %eax	# 7380	[c=13 l=5]  *zero_extendqisi2/0
+	orl	%eax, %r14d	# 7381	[c=4 l=3]  *iorsi_1/0
+	movzbl	%r14b, %ecx	# 7382	[c=4 l=4]  *zero_extendqisi2/0
+	call	log_add_data_mov@PLT	# 7388	[c=0 l=5]  *call
+	movl	$63, %eax	# 7389	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 7390	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 7391	[c=13 l=7]  *cmpsi_1/1
+	jb	.L746	# 7392	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%r13)	# 7394	[c=13 l=8]  *cmpqi_ccno_1/1
+	jne	.L747	# 7395	[c=13 l=6]  *jcc
+.L746:
+	movq	1040(%r13), %rax	# 7398	[c=9 l=7]  *movdi_internal/3
+	movb	%r14b, 63(%rax)	# 7399	[c=4 l=4]  *movqi_internal/8
+.L748:
+	movq	%r13, %rdi	# 7411	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 7410	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 7412	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 17535	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 17536	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 7414	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18812	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 7415	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 7417	[c=4 l=3]  *cmpdi_1/0
+	jb	.L344	# 7418	[c=13 l=6]  *jcc
+	movl	0(%r13), %ebx	# 7420	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 7425	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 7421	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 7423	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 7424	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 7426	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 7427	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 7428	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 7431	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 17537	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 7432	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 7435	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 7436	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 20073	[c=10 l=4]  *indirect_jump
+.L751:
+	movzbl	10(%rbx), %r14d	# 7565	[c=13 l=5]  zero_extendqidi2/0
+	movzwl	12(%rbx), %r8d	# 7564	[c=13 l=5]  *zero_extendhisi2/0
+	xorl	%eax, %eax	# 20065	[c=4 l=2]  *movdi_xor
+	movq	%r13, %rdi	# 7572	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC35(%rip), %r15	# 7570	[c=1 l=7]  *movdi_internal/4
+	movzbl	1004(%r13,%r14), %ecx	# 7567	[c=14 l=9]  *zero_extendqisi2/0
+	movq	%r14, %rdx	# 19181	[c=4 l=3]  *movdi_internal/3
+	movq	%r15, %rsi	# 7571	[c=4 l=3]  *movdi_internal/3
+	movl	%r8d, 16(%rsp)	# 18382	[c=4 l=5]  *movsi_internal/1
+	call	log_append@PLT	# 7574	[c=0 l=5]  *call
+	xorl	%eax, %eax	# 20066	[c=4 l=2]  *movdi_xor
+	movq	%r15, %rsi	# 7582	[c=4 l=3]  *movdi_internal/3
+	movq	%r13, %rdi	# 7583	[c=4 l=3]  *movdi_internal/3
+	movzbl	1004(%r13,%r14), %r9d	# 7576	[c=14 l=9]  *zero_extendqisi2/0
+	movslq	16(%rsp), %r14	# 18383	[c=13 l=5]  *extendsidi2_rex64/1
+	movzbl	1004(%r13,%r14), %ecx	# 7578	[c=14 l=9]  *zero_extendqisi2/0
+	movl	%r14d, %edx	# 7580	[c=4 l=3]  *movsi_internal/0
+	movl	%r9d, 8(%rsp)	# 18380	[c=4 l=5]  *movsi_internal/1
+	call	log_append@PLT	# 7585	[c=0 l=5]  *call
+	movl	8(%rsp), %r9d	# 18381	[c=9 l=5]  *movsi_internal/0
+	movzbl	1004(%r13,%r14), %r14d	# 7587	[c=14 l=9]  *zero_extendqisi2/0
+	imull	%r9d, %r14d	# 7588	[c=12 l=4]  *mulsi3_1/2
+	cmpl	$1, %r14d	# 7591	[c=4 l=4]  *cmpsi_1/0
+	movl	%r14d, %edx	# 17549	[c=4 l=3]  *movsi_internal/0
+	sbbl	%eax, %eax	# 7592	[c=8 l=2]  *x86_movsicc_0_m1_neg
+	sarl	$15, %edx	# 7594	[c=4 l=3]  *ashrsi3_1/0
+	andl	$2, %eax	# 7593	[c=4 l=3]  *andsi_1/0
+	orl	%edx, %eax	# 7595	[c=4 l=2]  *iorsi_1/0
+	movl	%eax, %r15d	# 17552	[c=4 l=3]  *movsi_internal/0
+	movl	$63, %eax	# 7596	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 7597	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 7598	[c=13 l=7]  *cmpsi_1/1
+	jb	.L752	# 7599	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%r13)	# 7601	[c=13 l=8]  *cmpqi_ccno_1/1
+	jne	.L753	# 7602	[c=13 l=6]  *jcc
+.L752:
+	movq	1040(%r13), %rax	# 7605	[c=9 l=7]  *movdi_internal/3
+	movzbl	63(%rax), %eax	# 7606	[c=13 l=4]  *zero_extendqisi2/0
+.L754:
+	movl	%eax, %ecx	# 7617	[c=4 l=2]  *movsi_internal/0
+	movl	$63, %edx	# 7618	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 7621	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, 8(%rsp)	# 18384	[c=4 l=4]  *movsi_internal/1
+	leaq	.LC33(%rip), %rsi	# 7619	[c=1 l=7]  *movdi_internal/4
+	call	log_add_data_mov@PLT	# 7622	[c=0 l=5]  *call
+	movl	8(%rsp), %eax	# 18385	[c=9 l=4]  *movsi_internal/0
+	movl	$63, %edx	# 7627	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 7630	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC29(%rip), %rsi	# 7628	[c=1 l=7]  *movdi_internal/4
+	andl	$-4, %eax	# 7623	[c=4 l=3]  *andsi_1/0
+	orl	%eax, %r15d	# 7624	[c=4 l=3]  *iorsi_1/0
+	movzbl	%r15b, %ecx	# 7625	[c=4 l=4]  *zero_extendqisi2/0
+	call	log_add_data_mov@PLT	# 7631	[c=0 l=5]  *call
+	movl	$63, %eax	# 7632	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 7633	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 7634	[c=13 l=7]  *cmpsi_1/1
+	jb	.L755	# 7635	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%r13)	# 7637	[c=13 l=8]  *cmpqi_ccno_1/1
+	jne	.L756	# 7638	[c=13 l=6]  *jcc
+.L755:
+	movq	1040(%r13), %rax	# 7641	[c=9 l=7]  *movdi_internal/3
+	movb	%r15b, 63(%rax)	# 7642	[c=4 l=4]  *movqi_internal/8
+.L757:
+	xorl	%edx, %edx	# 20063	[c=4 l=2]  *movdi_xor
+	xorl	%eax, %eax	# 20064	[c=4 l=2]  *movdi_xor
+	movl	%r14d, %ecx	# 7653	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 7657	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC37(%rip), %rsi	# 7655	[c=1 l=7]  *movdi_internal/4
+	call	log_append@PLT	# 7659	[c=0 l=5]  *call
+	movw	%r14w, 1004(%r13)	# 7660	[c=4 l=8]  *movhi_internal/3
+	movq	%r13, %rdi	# 7662	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 7661	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 7663	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 17553	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 17554	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 7665	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18807	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 7666	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 7668	[c=4 l=3]  *cmpdi_1/0
+	jb	.L344	# 7669	[c=13 l=6]  *jcc
+	movl	0(%r13), %ebx	# 7671	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 7676	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 7672	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 7674	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 7675	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 7677	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 7678	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 7679	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 7682	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 17555	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 7683	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 7686	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 7687	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 20062	[c=10 l=4]  *indirect_jump
+.L758:
+	movzbl	10(%rbx), %r14d	# 7696	[c=13 l=5]  zero_extendqidi2/0
+	movzwl	12(%rbx), %r8d	# 7695	[c=13 l=5]  *zero_extendhisi2/0
+	xorl	%eax, %eax	# 20057	[c=4 l=2]  *movdi_xor
+	movq	%r13, %rdi	# 7703	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC35(%rip), %r15	# 7701	[c=1 l=7]  *movdi_internal/4
+	movzbl	1004(%r13,%r14), %ecx	# 7698	[c=14 l=9]  *zero_extendqisi2/0
+	movq	%r14, %rdx	# 19183	[c=4 l=3]  *movdi_internal/3
+	movq	%r15, %rsi	# 7702	[c=4 l=3]  *movdi_internal/3
+	movl	%r8d, 16(%rsp)	# 18388	[c=4 l=5]  *movsi_internal/1
+	call	log_append@PLT	# 7705	[c=0 l=5]  *call
+	xorl	%eax, %eax	# 20058	[c=4 l=2]  *movdi_xor
+	movq	%r15, %rsi	# 7713	[c=4 l=3]  *movdi_internal/3
+	movq	%r13, %rdi	# 7714	[c=4 l=3]  *movdi_internal/3
+	movsbl	1004(%r13,%r14), %r9d	# 7707	[c=14 l=9]  extendqisi2
+	movslq	16(%rsp), %r14	# 18389	[c=13 l=5]  *extendsidi2_rex64/1
+	movzbl	1004(%r13,%r14), %ecx	# 7709	[c=14 l=9]  *zero_extendqisi2/0
+	movl	%r14d, %edx	# 7711	[c=4 l=3]  *movsi_internal/0
+	movl	%r9d, 8(%rsp)	# 18386	[c=4 l=5]  *movsi_internal/1
+	call	log_append@PLT	# 7716	[c=0 l=5]  *call
+	movl	8(%rsp), %r9d	# 18387	[c=9 l=5]  *movsi_internal/0
+	xorl	%eax, %eax	# 20059	[c=4 l=2]  *movsi_xor
+	movsbl	1004(%r13,%r14), %r14d	# 7718	[c=14 l=9]  extendqisi2
+	imull	%r9d, %r14d	# 7719	[c=12 l=4]  *mulsi3_1/2
+	movl	%r14d, %r15d	# 17557	[c=4 l=3]  *movsi_internal/0
+	andl	$65535, %r15d	# 20060	[c=4 l=7]  *andsi_2/0
+	sete	%al	# 20061	[c=4 l=3]  *setcc_qi_slp
+	movl	%r15d, %edx	# 17559	[c=4 l=3]  *movsi_internal/0
+	addl	%eax, %eax	# 7725	[c=4 l=2]  *ashlsi3_1/0
+	sarl	$15, %edx	# 7726	[c=4 l=3]  *ashrsi3_1/0
+	orl	%edx, %eax	# 7727	[c=4 l=2]  *iorsi_1/0
+	movl	%eax, 8(%rsp)	# 17562	[c=4 l=4]  *movsi_internal/1
+	movl	$63, %eax	# 7728	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 7729	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 7730	[c=13 l=7]  *cmpsi_1/1
+	jb	.L759	# 7731	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%r13)	# 7733	[c=13 l=8]  *cmpqi_ccno_1/1
+	jne	.L760	# 7734	[c=13 l=6]  *jcc
+.L759:
+	movq	1040(%r13), %rax	# 7737	[c=9 l=7]  *movdi_internal/3
+	movzbl	63(%rax), %eax	# 7738	[c=13 l=4]  *zero_extendqisi2/0
+.L761:
+	movl	%eax, %ecx	# 7749	[c=4 l=2]  *movsi_internal/0
+	movl	$63, %edx	# 7750	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 7753	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, 16(%rsp)	# 18392	[c=4 l=4]  *movsi_internal/1
+	leaq	.LC33(%rip), %rsi	# 7751	[c=1 l=7]  *movdi_internal/4
+	call	log_add_data_mov@PLT	# 7754	[c=0 l=5]  *call
+	movl	16(%rsp), %eax	# 18393	[c=9 l=4]  *movsi_internal/0
+	movl	8(%rsp), %edi	# 17563	[c=9 l=4]  *movsi_internal/0
+	movl	$63, %edx	# 7759	[c=4 l=5]  *movsi_internal/0
+	leaq	.LC29(%rip), %rsi	# 7760	[c=1 l=7]  *movdi_internal/4
+	andl	$-4, %eax	# 7755	[c=4 l=3]  *andsi_1/0
+	orl	%edi, %eax	# 7756	[c=4 l=2]  *iorsi_1/0
+	movq	%r13, %rdi	# 7762	[c=4 l=3]  *movdi_internal/3
+	movzbl	%al, %ecx	# 7757	[c=4 l=3]  *zero_extendqisi2/0
+	movl	%eax, 8(%rsp)	# 18390	[c=4 l=4]  *movsi_internal/1
+	call	log_add_data_mov@PLT	# 7763	[c=0 l=5]  *call
+	movl	$63, %edx	# 7764	[c=4 l=5]  *movsi_internal/0
+	movl	8(%rsp), %eax	# 18391	[c=9 l=4]  *movsi_internal/0
+	subl	5176(%r13), %edx	# 7765	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %edx	# 7766	[c=13 l=7]  *cmpsi_1/1
+	jb	.L762	# 7767	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%r13)	# 7769	[c=13 l=8]  *cmpqi_ccno_1/1
+	jne	.L763	# 7770	[c=13 l=6]  *jcc
+.L762:
+	movq	1040(%r13), %rdx	# 7773	[c=9 l=7]  *movdi_internal/3
+	movb	%al, 63(%rdx)	# 7774	[c=4 l=3]  *movqi_internal/8
+.L764:
+	xorl	%edx, %edx	# 20055	[c=4 l=2]  *movdi_xor
+	xorl	%eax, %eax	# 20056	[c=4 l=2]  *movdi_xor
+	movl	%r15d, %ecx	# 7785	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 7789	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC37(%rip), %rsi	# 7787	[c=1 l=7]  *movdi_internal/4
+	call	log_append@PLT	# 7791	[c=0 l=5]  *call
+	movw	%r14w, 1004(%r13)	# 7792	[c=4 l=8]  *movhi_internal/3
+	movq	%r13, %rdi	# 7794	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 7793	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 7795	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 17564	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 17565	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 7797	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18804	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 7798	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 7800	[c=4 l=3]  *cmpdi_1/0
+	jb	.L344	# 7801	[c=13 l=2]  *jcc
+	movl	0(%r13), %ebx	# 7803	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 7808	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 7804	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 7806	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 7807	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 7809	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 7810	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 7811	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 7814	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 17566	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 7815	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 7818	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 7819	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 20054	[c=10 l=4]  *indirect_jump
+.L344:
+	leaq	.LC60(%rip), %rdx	# 628	[c=1 l=7]  *movdi_internal/4
+	movl	$2, %esi	# 630	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 631	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 20294	[c=4 l=2]  *movdi_xor
+	call	leave	# 633	[c=0 l=5]  *call
+.L576:
+	cmpl	$4, %eax	# 4563	[c=4 l=3]  *cmpsi_1/0
+	jne	.L579	# 4564	[c=13 l=6]  *jcc
+	movl	%r8d, %eax	# 4623	[c=1 l=3]  *zero_extendsidi2/3
+	movq	%rcx, %rdi	# 4626	[c=4 l=3]  *movdi_internal/3
+	movl	$255, %esi	# 4625	[c=4 l=5]  *movsi_internal/0
+	movl	%r8d, 8(%rsp)	# 18275	[c=4 l=5]  *movsi_internal/1
+	movq	%rax, %rdx	# 4624	[c=4 l=3]  *movdi_internal/3
+	movq	%rax, 32(%rsp)	# 18274	[c=4 l=5]  *movdi_internal/5
+	call	memset@PLT	# 4627	[c=10 l=5]  *call_value
+	movl	8(%rsp), %r8d	# 18276	[c=9 l=5]  *movsi_internal/0
+	movq	%rax, %rcx	# 18273	[c=4 l=3]  *movdi_internal/3
+.L575:
+	xorl	%eax, %eax	# 20186	[c=4 l=2]  *movdi_xor
+	movl	%r15d, %edx	# 4630	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC63(%rip), %rsi	# 4631	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 4633	[c=4 l=3]  *movdi_internal/3
+	movq	%rcx, 16(%rsp)	# 18279	[c=4 l=5]  *movdi_internal/5
+	movl	%r8d, 8(%rsp)	# 18277	[c=4 l=5]  *movsi_internal/1
+	call	log_append@PLT	# 4635	[c=0 l=5]  *call
+	movl	8(%rsp), %r8d	# 18278	[c=9 l=5]  *movsi_internal/0
+	movq	16(%rsp), %rcx	# 18280	[c=9 l=5]  *movdi_internal/3
+	xorl	%eax, %eax	# 20187	[c=4 l=2]  *movdi_xor
+	jmp	.L581	# 20452	[c=1 l=2]  jump
+.L582:
+	movzbl	6052(%r13,%rax), %edx	# 4639	[c=10 l=9]  *movqi_internal/4
+	andb	%dl, (%rcx,%rax)	# 4640	[c=13 l=3]  *andqi_1/0
+	addq	$1, %rax	# 4641	[c=4 l=4]  *adddi_1/0
+.L581:
+	cmpl	%r8d, %eax	# 4645	[c=4 l=3]  *cmpsi_1/0
+	jb	.L582	# 4646	[c=13 l=2]  *jcc
+	movl	%r8d, 8(%rsp)	# 18281	[c=4 l=5]  *movsi_internal/1
+	movq	32(%rsp), %rdx	# 4650	[c=9 l=5]  *movdi_internal/3
+	movl	$255, %esi	# 4651	[c=4 l=5]  *movsi_internal/0
+	movq	24(%rsp), %rdi	# 4652	[c=9 l=5]  *movdi_internal/3
+	jmp	.L1374	# 20454	[c=1 l=5]  jump
+.L1004:
+	cmpl	$4, %eax	# 11343	[c=4 l=3]  *cmpsi_1/0
+	jne	.L1007	# 11344	[c=13 l=6]  *jcc
+	movl	%r15d, %eax	# 11403	[c=1 l=3]  *zero_extendsidi2/3
+	movq	%rcx, %rdi	# 11406	[c=4 l=3]  *movdi_internal/3
+	movl	$255, %esi	# 11405	[c=4 l=5]  *movsi_internal/0
+	movq	%rax, %rdx	# 11404	[c=4 l=3]  *movdi_internal/3
+	movq	%rax, 16(%rsp)	# 18516	[c=4 l=5]  *movdi_internal/5
+	call	memset@PLT	# 11407	[c=10 l=5]  *call_value
+	movq	%rax, %rcx	# 18515	[c=4 l=3]  *movdi_internal/3
+.L1003:
+	xorl	%eax, %eax	# 19983	[c=4 l=2]  *movdi_xor
+	movl	%r14d, %edx	# 11410	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC63(%rip), %rsi	# 11411	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 11413	[c=4 l=3]  *movdi_internal/3
+	movq	%rcx, 8(%rsp)	# 18517	[c=4 l=5]  *movdi_internal/5
+	call	log_append@PLT	# 11415	[c=0 l=5]  *call
+	movq	8(%rsp), %rcx	# 18518	[c=9 l=5]  *movdi_internal/3
+	xorl	%eax, %eax	# 19984	[c=4 l=2]  *movdi_xor
+	jmp	.L1009	# 20456	[c=1 l=2]  jump
+.L1010:
+	movzbl	6052(%r13,%rax), %edx	# 11419	[c=10 l=9]  *movqi_internal/4
+	andb	%dl, (%rcx,%rax)	# 11420	[c=13 l=3]  *andqi_1/0
+	addq	$1, %rax	# 11421	[c=4 l=4]  *adddi_1/0
+.L1009:
+	cmpl	%r15d, %eax	# 11425	[c=4 l=3]  *cmpsi_1/0
+	jb	.L1010	# 11426	[c=13 l=2]  *jcc
+	movq	16(%rsp), %rdx	# 11430	[c=9 l=5]  *movdi_internal/3
+	movq	24(%rsp), %rdi	# 11432	[c=9 l=5]  *movdi_internal/3
+	movl	$255, %esi	# 11431	[c=4 l=5]  *movsi_internal/0
+	jmp	.L1376	# 20458	[c=1 l=5]  jump
+.L1562:
+	movl	$1, %r9d	# 11613	[c=4 l=6]  *movsi_internal/0
+	movl	%r15d, %r8d	# 11614	[c=4 l=3]  *movsi_internal/0
+	xorl	%ecx, %ecx	# 19977	[c=4 l=2]  *movdi_xor
+	movl	$30, %edx	# 11616	[c=4 l=5]  *movsi_internal/0
+	movl	%r14d, %esi	# 11617	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 11618	[c=4 l=3]  *movdi_internal/3
+	call	ramp_indirect	# 11619	[c=0 l=5]  *call
+	jmp	.L1022	# 20460	[c=1 l=5]  jump
+.L1561:
+	movl	$1, %r9d	# 11503	[c=4 l=6]  *movsi_internal/0
+	movl	%r15d, %r8d	# 11504	[c=4 l=3]  *movsi_internal/0
+	xorl	%ecx, %ecx	# 19981	[c=4 l=2]  *movdi_xor
+	movl	$28, %edx	# 11506	[c=4 l=5]  *movsi_internal/0
+	movl	%r14d, %esi	# 11507	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 11508	[c=4 l=3]  *movdi_internal/3
+	call	ramp_indirect	# 11509	[c=0 l=5]  *call
+	jmp	.L1015	# 20462	[c=1 l=5]  jump
+.L1606:
+	xorl	%r9d, %r9d	# 20091	[c=4 l=3]  *movdi_xor
+	xorl	%r8d, %r8d	# 20092	[c=4 l=3]  *movdi_xor
+	movl	$1, %ecx	# 7031	[c=4 l=5]  *movsi_internal/0
+	movl	$30, %edx	# 7032	[c=4 l=5]  *movsi_internal/0
+	movl	%r14d, %esi	# 7033	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 7034	[c=4 l=3]  *movdi_internal/3
+	call	ramp_indirect	# 7035	[c=0 l=5]  *call
+	jmp	.L734	# 20464	[c=1 l=5]  jump
+.L1605:
+	xorl	%r9d, %r9d	# 20097	[c=4 l=3]  *movdi_xor
+	xorl	%r8d, %r8d	# 20098	[c=4 l=3]  *movdi_xor
+	orl	$-1, %ecx	# 20099	[c=4 l=3]  *movsi_or
+	movl	$30, %edx	# 6919	[c=4 l=5]  *movsi_internal/0
+	movl	%r14d, %esi	# 6920	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 6921	[c=4 l=3]  *movdi_internal/3
+	call	ramp_indirect	# 6922	[c=0 l=5]  *call
+	jmp	.L727	# 20466	[c=1 l=5]  jump
+.L1604:
+	xorl	%r9d, %r9d	# 20117	[c=4 l=3]  *movdi_xor
+	xorl	%r8d, %r8d	# 20118	[c=4 l=3]  *movdi_xor
+	movl	$1, %ecx	# 6575	[c=4 l=5]  *movsi_internal/0
+	movl	$26, %edx	# 6576	[c=4 l=5]  *movsi_internal/0
+	movl	%r14d, %esi	# 6577	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 6578	[c=4 l=3]  *movdi_internal/3
+	call	ramp_indirect	# 6579	[c=0 l=5]  *call
+	jmp	.L706	# 20468	[c=1 l=5]  jump
+.L1603:
+	xorl	%r9d, %r9d	# 20123	[c=4 l=3]  *movdi_xor
+	xorl	%r8d, %r8d	# 20124	[c=4 l=3]  *movdi_xor
+	orl	$-1, %ecx	# 20125	[c=4 l=3]  *movsi_or
+	movl	$26, %edx	# 6463	[c=4 l=5]  *movsi_internal/0
+	movl	%r14d, %esi	# 6464	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 6465	[c=4 l=3]  *movdi_internal/3
+	call	ramp_indirect	# 6466	[c=0 l=5]  *call
+	jmp	.L699	# 20470	[c=1 l=5]  jump
+.L881:
+	movq	1040(%r13), %rax	# 9477	[c=9 l=7]  *movdi_internal/3
+	movl	$62, %ecx	# 9479	[c=4 l=5]  *movsi_internal/0
+	subl	%r15d, %ecx	# 9480	[c=4 l=3]  *subsi_1/0
+	movzbl	61(%rax), %edx	# 9478	[c=13 l=4]  *zero_extendqisi2/0
+	cmpl	%r14d, %ecx	# 9481	[c=4 l=3]  *cmpsi_1/0
+	jb	.L883	# 9482	[c=13 l=6]  *jcc
+	cmpb	$1, 1081(%r13)	# 9486	[c=13 l=8]  *cmpqi_1/0
+	jbe	.L883	# 9487	[c=13 l=6]  *jcc
+.L884:
+	movl	$62, %esi	# 9490	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 9491	[c=4 l=3]  *movdi_internal/3
+	movl	%edx, 8(%rsp)	# 18454	[c=4 l=4]  *movsi_internal/1
+	call	data_read_mapped	# 9492	[c=10 l=5]  *call_value
+	movl	8(%rsp), %edx	# 18455	[c=9 l=4]  *movsi_internal/0
+	jmp	.L885	# 20472	[c=1 l=5]  jump
+.L814:
+	movq	1040(%r13), %rax	# 8681	[c=9 l=7]  *movdi_internal/3
+	movl	$62, %esi	# 8683	[c=4 l=5]  *movsi_internal/0
+	subl	%ecx, %esi	# 8684	[c=4 l=2]  *subsi_1/0
+	movzbl	61(%rax), %r14d	# 8682	[c=13 l=5]  *zero_extendqisi2/0
+	cmpl	%edx, %esi	# 8685	[c=4 l=2]  *cmpsi_1/0
+	jb	.L816	# 8686	[c=13 l=6]  *jcc
+	cmpb	$1, 1081(%r13)	# 8690	[c=13 l=8]  *cmpqi_1/0
+	jbe	.L816	# 8691	[c=13 l=6]  *jcc
+.L817:
+	movl	$62, %esi	# 8694	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 8695	[c=4 l=3]  *movdi_internal/3
+	call	data_read_mapped	# 8696	[c=10 l=5]  *call_value
+	jmp	.L818	# 20474	[c=1 l=5]  jump
+.L800:
+	movq	1040(%r13), %rax	# 8478	[c=9 l=7]  *movdi_internal/3
+	movl	$62, %esi	# 8480	[c=4 l=5]  *movsi_internal/0
+	subl	%r15d, %esi	# 8481	[c=4 l=3]  *subsi_1/0
+	movzbl	61(%rax), %edx	# 8479	[c=13 l=4]  *zero_extendqisi2/0
+	cmpl	%r14d, %esi	# 8482	[c=4 l=3]  *cmpsi_1/0
+	jb	.L802	# 8483	[c=13 l=6]  *jcc
+	cmpb	$1, 1081(%r13)	# 8487	[c=13 l=8]  *cmpqi_1/0
+	jbe	.L802	# 8488	[c=13 l=6]  *jcc
+.L803:
+	movl	$62, %esi	# 8491	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 8492	[c=4 l=3]  *movdi_internal/3
+	movl	%edx, 16(%rsp)	# 18422	[c=4 l=4]  *movsi_internal/1
+	call	data_read_mapped	# 8493	[c=10 l=5]  *call_value
+	movl	16(%rsp), %edx	# 18423	[c=9 l=4]  *movsi_internal/0
+	movl	%eax, %r8d	# 8494	[c=4 l=3]  *movsi_internal/0
+	jmp	.L804	# 20476	[c=1 l=5]  jump
+.L1585:
+	xorl	%r9d, %r9d	# 20104	[c=4 l=3]  *movdi_xor
+	xorl	%r8d, %r8d	# 20105	[c=4 l=3]  *movdi_xor
+	movl	$1, %ecx	# 6803	[c=4 l=5]  *movsi_internal/0
+	movl	$28, %edx	# 6804	[c=4 l=5]  *movsi_internal/0
+	movl	%r14d, %esi	# 6805	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 6806	[c=4 l=3]  *movdi_internal/3
+	call	ramp_indirect	# 6807	[c=0 l=5]  *call
+	jmp	.L720	# 20478	[c=1 l=5]  jump
+.L1584:
+	xorl	%r9d, %r9d	# 20110	[c=4 l=3]  *movdi_xor
+	xorl	%r8d, %r8d	# 20111	[c=4 l=3]  *movdi_xor
+	orl	$-1, %ecx	# 20112	[c=4 l=3]  *movsi_or
+	movl	$28, %edx	# 6691	[c=4 l=5]  *movsi_internal/0
+	movl	%r14d, %esi	# 6692	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 6693	[c=4 l=3]  *movdi_internal/3
+	call	ramp_indirect	# 6694	[c=0 l=5]  *call
+	jmp	.L713	# 20480	[c=1 l=5]  jump
+.L855:
+	movq	1040(%r13), %rax	# 9183	[c=9 l=7]  *movdi_internal/3
+	movl	$62, %ecx	# 9185	[c=4 l=5]  *movsi_internal/0
+	subl	%r15d, %ecx	# 9186	[c=4 l=3]  *subsi_1/0
+	movzbl	61(%rax), %edx	# 9184	[c=13 l=4]  *zero_extendqisi2/0
+	cmpl	%r14d, %ecx	# 9187	[c=4 l=3]  *cmpsi_1/0
+	jb	.L857	# 9188	[c=13 l=6]  *jcc
+	cmpb	$1, 1081(%r13)	# 9192	[c=13 l=8]  *cmpqi_1/0
+	jbe	.L857	# 9193	[c=13 l=6]  *jcc
+.L858:
+	movl	$62, %esi	# 9196	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 9197	[c=4 l=3]  *movdi_internal/3
+	movl	%edx, 8(%rsp)	# 18440	[c=4 l=4]  *movsi_internal/1
+	call	data_read_mapped	# 9198	[c=10 l=5]  *call_value
+	movl	8(%rsp), %edx	# 18441	[c=9 l=4]  *movsi_internal/0
+	jmp	.L859	# 20482	[c=1 l=5]  jump
+.L829:
+	movq	1040(%r13), %rax	# 8872	[c=9 l=7]  *movdi_internal/3
+	movl	$62, %esi	# 8874	[c=4 l=5]  *movsi_internal/0
+	subl	%ecx, %esi	# 8875	[c=4 l=2]  *subsi_1/0
+	movzbl	61(%rax), %r15d	# 8873	[c=13 l=5]  *zero_extendqisi2/0
+	cmpl	%r14d, %esi	# 8876	[c=4 l=3]  *cmpsi_1/0
+	jb	.L831	# 8877	[c=13 l=6]  *jcc
+	cmpb	$1, 1081(%r13)	# 8881	[c=13 l=8]  *cmpqi_1/0
+	jbe	.L831	# 8882	[c=13 l=6]  *jcc
+.L832:
+	movl	$62, %esi	# 8885	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 8886	[c=4 l=3]  *movdi_internal/3
+	call	data_read_mapped	# 8887	[c=10 l=5]  *call_value
+	jmp	.L833	# 20484	[c=1 l=5]  jump
+.L1565:
+	movl	$1, %r9d	# 12074	[c=4 l=6]  *movsi_internal/0
+	xorl	%r8d, %r8d	# 19962	[c=4 l=3]  *movdi_xor
+	orl	$-1, %ecx	# 19963	[c=4 l=3]  *movsi_or
+	movl	%r14d, %esi	# 12078	[c=4 l=3]  *movsi_internal/0
+	movl	$26, %edx	# 12077	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 12079	[c=4 l=3]  *movdi_internal/3
+	call	ramp_indirect	# 12080	[c=0 l=5]  *call
+	jmp	.L1051	# 20486	[c=1 l=5]  jump
+.L1548:
+	movl	$1, %r9d	# 12538	[c=4 l=6]  *movsi_internal/0
+	xorl	%r8d, %r8d	# 19940	[c=4 l=3]  *movdi_xor
+	orl	$-1, %ecx	# 19941	[c=4 l=3]  *movsi_or
+	movl	%r14d, %esi	# 12542	[c=4 l=3]  *movsi_internal/0
+	movl	$30, %edx	# 12541	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 12543	[c=4 l=3]  *movdi_internal/3
+	call	ramp_indirect	# 12544	[c=0 l=5]  *call
+	jmp	.L1079	# 20488	[c=1 l=5]  jump
+.L1547:
+	movl	$1, %r9d	# 12421	[c=4 l=6]  *movsi_internal/0
+	xorl	%r8d, %r8d	# 19946	[c=4 l=3]  *movdi_xor
+	movl	%r15d, %esi	# 12425	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 12426	[c=4 l=3]  *movdi_internal/3
+	movl	$1, %ecx	# 12423	[c=4 l=5]  *movsi_internal/0
+	movl	$28, %edx	# 12424	[c=4 l=5]  *movsi_internal/0
+	call	ramp_indirect	# 12427	[c=0 l=5]  *call
+	jmp	.L1072	# 20490	[c=1 l=5]  jump
+.L1546:
+	movl	$1, %r9d	# 12306	[c=4 l=6]  *movsi_internal/0
+	xorl	%r8d, %r8d	# 19951	[c=4 l=3]  *movdi_xor
+	orl	$-1, %ecx	# 19952	[c=4 l=3]  *movsi_or
+	movl	%r14d, %esi	# 12310	[c=4 l=3]  *movsi_internal/0
+	movl	$28, %edx	# 12309	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 12311	[c=4 l=3]  *movdi_internal/3
+	call	ramp_indirect	# 12312	[c=0 l=5]  *call
+	jmp	.L1065	# 20492	[c=1 l=5]  jump
+.L1545:
+	movl	$1, %r9d	# 12189	[c=4 l=6]  *movsi_internal/0
+	xorl	%r8d, %r8d	# 19957	[c=4 l=3]  *movdi_xor
+	movl	%r15d, %esi	# 12193	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 12194	[c=4 l=3]  *movdi_internal/3
+	movl	$1, %ecx	# 12191	[c=4 l=5]  *movsi_internal/0
+	movl	$26, %edx	# 12192	[c=4 l=5]  *movsi_internal/0
+	call	ramp_indirect	# 12195	[c=0 l=5]  *call
+	jmp	.L1058	# 20494	[c=1 l=5]  jump
+.L1536:
+	xorl	%r9d, %r9d	# 20129	[c=4 l=3]  *movdi_xor
+	xorl	%r8d, %r8d	# 20130	[c=4 l=3]  *movdi_xor
+	xorl	%ecx, %ecx	# 20131	[c=4 l=2]  *movdi_xor
+	movl	$26, %edx	# 6358	[c=4 l=5]  *movsi_internal/0
+	movl	%r14d, %esi	# 6359	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 6360	[c=4 l=3]  *movdi_internal/3
+	call	ramp_indirect	# 6361	[c=0 l=5]  *call
+	jmp	.L692	# 20496	[c=1 l=5]  jump
+.L1532:
+	xorl	%r9d, %r9d	# 20141	[c=4 l=3]  *movdi_xor
+	xorl	%ecx, %ecx	# 20142	[c=4 l=2]  *movdi_xor
+	movl	$30, %edx	# 5998	[c=4 l=5]  *movsi_internal/0
+	movl	%r14d, %esi	# 5999	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 6000	[c=4 l=3]  *movdi_internal/3
+	call	ramp_indirect	# 6001	[c=0 l=5]  *call
+	jmp	.L666	# 20498	[c=1 l=5]  jump
+.L1549:
+	movl	$1, %r9d	# 12653	[c=4 l=6]  *movsi_internal/0
+	xorl	%r8d, %r8d	# 19935	[c=4 l=3]  *movdi_xor
+	movl	%r15d, %esi	# 12657	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 12658	[c=4 l=3]  *movdi_internal/3
+	movl	$1, %ecx	# 12655	[c=4 l=5]  *movsi_internal/0
+	movl	$30, %edx	# 12656	[c=4 l=5]  *movsi_internal/0
+	call	ramp_indirect	# 12659	[c=0 l=5]  *call
+	jmp	.L1086	# 20500	[c=1 l=5]  jump
+.L1564:
+	movl	$1, %r9d	# 11967	[c=4 l=6]  *movsi_internal/0
+	xorl	%r8d, %r8d	# 19967	[c=4 l=3]  *movdi_xor
+	xorl	%ecx, %ecx	# 19968	[c=4 l=2]  *movdi_xor
+	movl	$26, %edx	# 11970	[c=4 l=5]  *movsi_internal/0
+	movl	%r14d, %esi	# 11971	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 11972	[c=4 l=3]  *movdi_internal/3
+	call	ramp_indirect	# 11973	[c=0 l=5]  *call
+	jmp	.L1044	# 20502	[c=1 l=5]  jump
+.L1563:
+	movq	1040(%r13), %rdx	# 11724	[c=9 l=7]  *movdi_internal/3
+	leaq	.LC25(%rip), %rsi	# 11728	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 11730	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, 8(%rsp)	# 18535	[c=4 l=4]  *movsi_internal/1
+	movzbl	56(%rdx), %r14d	# 11725	[c=13 l=5]  *zero_extendqisi2/0
+	movl	$56, %edx	# 11727	[c=4 l=5]  *movsi_internal/0
+	movl	%r14d, %ecx	# 11726	[c=4 l=3]  *movsi_internal/0
+	sall	$16, %r14d	# 11732	[c=4 l=4]  *ashlsi3_1/0
+	call	log_add_data_mov@PLT	# 11731	[c=0 l=5]  *call
+	orl	%r15d, %r14d	# 11733	[c=4 l=3]  *iorsi_1/0
+	movslq	8(%rsp), %r15	# 18536	[c=13 l=5]  *extendsidi2_rex64/1
+	movq	%r13, %rdi	# 11740	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC35(%rip), %rsi	# 11738	[c=1 l=7]  *movdi_internal/4
+	xorl	%eax, %eax	# 19973	[c=4 l=2]  *movdi_xor
+	movzbl	1004(%r13,%r15), %ecx	# 11735	[c=14 l=9]  *zero_extendqisi2/0
+	movl	%r15d, %edx	# 11737	[c=4 l=3]  *movsi_internal/0
+	call	log_append@PLT	# 11742	[c=0 l=5]  *call
+	movzbl	1004(%r13,%r15), %r15d	# 11744	[c=14 l=9]  *zero_extendqisi2/0
+	movb	%r15b, 8(%rsp)	# 18533	[c=4 l=5]  *movqi_internal/8
+	testl	$16711680, %r14d	# 11747	[c=4 l=7]  *testsi_1/2
+	jne	.L1029	# 11748	[c=13 l=6]  *jcc
+	cmpl	$63, %r14d	# 15802	[c=4 l=4]  *cmpsi_1/0
+	leaq	.LC30(%rip), %rdx	# 17007	[c=1 l=7]  *movdi_internal/4
+	movl	%r15d, %ecx	# 11755	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 11758	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC29(%rip), %rsi	# 17006	[c=1 l=7]  *movdi_internal/4
+	cmovne	%rdx, %rsi	# 15803	[c=8 l=4]  *movdicc_noc/1
+	movl	%r14d, %edx	# 11756	[c=4 l=3]  *movsi_internal/0
+	call	log_add_data_mov@PLT	# 11759	[c=0 l=5]  *call
+	movl	%r14d, %edx	# 17866	[c=4 l=3]  *movsi_internal/0
+	subl	5176(%r13), %edx	# 11760	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %edx	# 11761	[c=13 l=7]  *cmpsi_1/1
+	movzbl	8(%rsp), %eax	# 18534	[c=9 l=5]  *movqi_internal/4
+	jb	.L1031	# 11762	[c=13 l=2]  *jcc
+	movl	%r14d, %edx	# 17868	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %edx	# 11764	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %edx	# 16866	[c=5 l=6]  *andsi_1_zext
+	cmpb	$0, 1080(%r13,%rdx)	# 11767	[c=14 l=9]  *cmpqi_ccno_1/1
+	jne	.L1032	# 11768	[c=13 l=6]  *jcc
+.L1031:
+	movq	1040(%r13), %rdx	# 11772	[c=9 l=7]  *movdi_internal/3
+	movslq	%r14d, %r14	# 11771	[c=4 l=3]  *extendsidi2_rex64/1
+	movb	%al, (%rdx,%r14)	# 11773	[c=4 l=4]  *movqi_internal/8
+	jmp	.L1033	# 20504	[c=1 l=5]  jump
+.L511:
+	movq	1040(%r13), %rax	# 3600	[c=9 l=7]  *movdi_internal/3
+	movzbl	61(%rax), %edx	# 3601	[c=13 l=4]  *zero_extendqisi2/0
+	cmpl	%r15d, %r14d	# 3602	[c=4 l=3]  *cmpsi_1/0
+	jb	.L513	# 3603	[c=13 l=6]  *jcc
+	cmpb	$1, 1081(%r13)	# 3607	[c=13 l=8]  *cmpqi_1/0
+	jbe	.L513	# 3608	[c=13 l=6]  *jcc
+.L514:
+	movl	$62, %esi	# 3611	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 3612	[c=4 l=3]  *movdi_internal/3
+	movl	%edx, 8(%rsp)	# 18232	[c=4 l=4]  *movsi_internal/1
+	call	data_read_mapped	# 3613	[c=10 l=5]  *call_value
+	movl	8(%rsp), %edx	# 18233	[c=9 l=4]  *movsi_internal/0
+	movl	%eax, %r8d	# 3614	[c=4 l=3]  *movsi_internal/0
+	jmp	.L515	# 20506	[c=1 l=5]  jump
+.L610:
+	movq	1040(%r13), %rax	# 5188	[c=9 l=7]  *movdi_internal/3
+	movl	$62, %ecx	# 5190	[c=4 l=5]  *movsi_internal/0
+	subl	%r15d, %ecx	# 5191	[c=4 l=3]  *subsi_1/0
+	movzbl	61(%rax), %edx	# 5189	[c=13 l=4]  *zero_extendqisi2/0
+	cmpl	%r14d, %ecx	# 5192	[c=4 l=3]  *cmpsi_1/0
+	jb	.L612	# 5193	[c=13 l=6]  *jcc
+	cmpb	$1, 1081(%r13)	# 5197	[c=13 l=8]  *cmpqi_1/0
+	jbe	.L612	# 5198	[c=13 l=6]  *jcc
+.L613:
+	movl	$62, %esi	# 5201	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 5202	[c=4 l=3]  *movdi_internal/3
+	movl	%edx, 8(%rsp)	# 18301	[c=4 l=4]  *movsi_internal/1
+	call	data_read_mapped	# 5203	[c=10 l=5]  *call_value
+	movl	8(%rsp), %edx	# 18302	[c=9 l=4]  *movsi_internal/0
+	movl	%eax, %r8d	# 5204	[c=4 l=3]  *movsi_internal/0
+	jmp	.L614	# 20508	[c=1 l=5]  jump
+.L1531:
+	xorl	%r9d, %r9d	# 20146	[c=4 l=3]  *movdi_xor
+	xorl	%ecx, %ecx	# 20147	[c=4 l=2]  *movdi_xor
+	movl	$28, %edx	# 5890	[c=4 l=5]  *movsi_internal/0
+	movl	%r14d, %esi	# 5891	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 5892	[c=4 l=3]  *movdi_internal/3
+	call	ramp_indirect	# 5893	[c=0 l=5]  *call
+	jmp	.L659	# 20510	[c=1 l=5]  jump
+.L430:
+	movq	1040(%r13), %rax	# 2298	[c=9 l=7]  *movdi_internal/3
+	movl	$62, %esi	# 2300	[c=4 l=5]  *movsi_internal/0
+	subl	%ecx, %esi	# 2301	[c=4 l=2]  *subsi_1/0
+	movzbl	61(%rax), %r15d	# 2299	[c=13 l=5]  *zero_extendqisi2/0
+	cmpl	%r14d, %esi	# 2302	[c=4 l=3]  *cmpsi_1/0
+	jb	.L432	# 2303	[c=13 l=6]  *jcc
+	cmpb	$1, 1081(%r13)	# 2307	[c=13 l=8]  *cmpqi_1/0
+	jbe	.L432	# 2308	[c=13 l=6]  *jcc
+.L433:
+	movl	$62, %esi	# 2311	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 2312	[c=4 l=3]  *movdi_internal/3
+	call	data_read_mapped	# 2313	[c=10 l=5]  *call_value
+	movl	%eax, %r8d	# 2314	[c=4 l=3]  *movsi_internal/0
+	jmp	.L434	# 20512	[c=1 l=5]  jump
+.L1494:
+	movq	1040(%r13), %rax	# 14146	[c=9 l=7]  *movdi_internal/3
+	leaq	.LC25(%rip), %rsi	# 14150	[c=1 l=7]  *movdi_internal/4
+	movl	$59, %edx	# 14149	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 14152	[c=4 l=3]  *movdi_internal/3
+	movq	%rsi, 24(%rsp)	# 18636	[c=4 l=5]  *movdi_internal/5
+	movzbl	59(%rax), %eax	# 14147	[c=13 l=4]  *zero_extendqisi2/0
+	movl	%eax, %ecx	# 14148	[c=4 l=2]  *movsi_internal/0
+	movl	%eax, 32(%rsp)	# 18638	[c=4 l=4]  *movsi_internal/1
+	call	log_add_data_mov@PLT	# 14153	[c=0 l=5]  *call
+	movl	32(%rsp), %eax	# 18639	[c=9 l=4]  *movsi_internal/0
+	movq	24(%rsp), %rsi	# 18637	[c=9 l=5]  *movdi_internal/3
+	sall	$16, %eax	# 14154	[c=4 l=3]  *ashlsi3_1/0
+	orl	%eax, %r15d	# 14155	[c=4 l=3]  *iorsi_1/0
+	testl	$16711680, %r15d	# 14157	[c=4 l=7]  *testsi_1/2
+	je	.L1172	# 14158	[c=13 l=6]  *jcc
+	movl	%r15d, %eax	# 18087	[c=4 l=3]  *movsi_internal/0
+	movq	1072(%r13), %rdx	# 14195	[c=9 l=7]  *movdi_internal/3
+	sarl	$12, %eax	# 14193	[c=4 l=3]  *ashrsi3_1/0
+	cltq	# 14194	[c=4 l=2]  *extendsidi2_rex64/0
+	movq	(%rdx,%rax,8), %rax	# 14196	[c=10 l=4]  *movdi_internal/3
+	testq	%rax, %rax	# 14197	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L1249	# 14198	[c=13 l=6]  *jcc
+	movl	%r15d, %edx	# 18090	[c=4 l=3]  *movsi_internal/0
+	andl	$4095, %edx	# 16852	[c=5 l=6]  *andsi_1_zext
+	movzbl	(%rax,%rdx), %ecx	# 14202	[c=13 l=4]  *zero_extendqisi2/0
+.L1179:
+	movl	%r15d, %edx	# 14206	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 14209	[c=4 l=3]  *movdi_internal/3
+	movl	%ecx, 24(%rsp)	# 18642	[c=4 l=4]  *movsi_internal/1
+	call	log_add_data_mov@PLT	# 14210	[c=0 l=5]  *call
+	movl	24(%rsp), %ecx	# 18643	[c=9 l=4]  *movsi_internal/0
+	movl	8(%rsp), %edx	# 14212	[c=9 l=4]  *movsi_internal/0
+	movq	%r13, %rdi	# 14215	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 19886	[c=4 l=2]  *movdi_xor
+	leaq	.LC36(%rip), %rsi	# 14213	[c=1 l=7]  *movdi_internal/4
+	call	log_append@PLT	# 14217	[c=0 l=5]  *call
+	movl	24(%rsp), %ecx	# 18641	[c=9 l=4]  *movsi_internal/0
+	movl	%r15d, %edx	# 14222	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 14225	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC30(%rip), %rsi	# 14223	[c=1 l=7]  *movdi_internal/4
+	movb	%cl, 1004(%r13,%r14)	# 14219	[c=4 l=8]  *movqi_internal/8
+	movl	16(%rsp), %r14d	# 18092	[c=9 l=5]  *movsi_internal/0
+	xorl	%ecx, %r14d	# 14220	[c=4 l=3]  *xorsi_1/0
+	movl	%r14d, %ecx	# 14221	[c=4 l=3]  *movsi_internal/0
+	call	log_add_data_mov@PLT	# 14226	[c=0 l=5]  *call
+	movl	%r14d, %edx	# 14227	[c=4 l=3]  *movsi_internal/0
+	movl	%r15d, %esi	# 14228	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 14229	[c=4 l=3]  *movdi_internal/3
+	call	far_write	# 14230	[c=0 l=5]  *call
+	jmp	.L1180	# 20514	[c=1 l=5]  jump
+.L1528:
+	movb	$1, 11032(%r13)	# 5454	[c=4 l=8]  *movqi_internal/8
+	movzbl	11037(%r13), %esi	# 5455	[c=13 l=8]  *zero_extendqisi2/0
+	movq	%r13, %rdi	# 5457	[c=4 l=3]  *movdi_internal/3
+	call	execute_lean@PLT	# 5458	[c=0 l=5]  *call
+	movq	%r13, %rdi	# 5459	[c=4 l=3]  *movdi_internal/3
+	call	perf_lean_resume@PLT	# 5460	[c=0 l=5]  *call
+	jmp	.L635	# 20516	[c=1 l=5]  jump
+.L1527:
+	movq	%r13, %rdi	# 5444	[c=4 l=3]  *movdi_internal/3
+	call	do_events	# 5445	[c=0 l=5]  *call
+	jmp	.L634	# 20518	[c=1 l=5]  jump
+.L1530:
+	movb	$1, 11032(%r13)	# 5531	[c=4 l=8]  *movqi_internal/8
+	movzbl	11037(%r13), %esi	# 5532	[c=13 l=8]  *zero_extendqisi2/0
+	movq	%r13, %rdi	# 5534	[c=4 l=3]  *movdi_internal/3
+	call	execute_lean@PLT	# 5535	[c=0 l=5]  *call
+	movq	%r13, %rdi	# 5536	[c=4 l=3]  *movdi_internal/3
+	call	perf_lean_resume@PLT	# 5537	[c=0 l=5]  *call
+	jmp	.L639	# 20520	[c=1 l=5]  jump
+.L1529:
+	movq	%r13, %rdi	# 5521	[c=4 l=3]  *movdi_internal/3
+	call	do_events	# 5522	[c=0 l=5]  *call
+	jmp	.L638	# 20522	[c=1 l=5]  jump
+.L1522:
+	movq	%r13, %rdi	# 4719	[c=4 l=3]  *movdi_internal/3
+	call	do_events	# 4720	[c=0 l=5]  *call
+	jmp	.L586	# 20524	[c=1 l=5]  jump
+.L1521:
+	sarl	$16, %r14d	# 4676	[c=4 l=4]  *ashrsi3_1/0
+	movl	$59, %edx	# 4679	[c=4 l=5]  *movsi_internal/0
+	leaq	.LC30(%rip), %rsi	# 4680	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 4682	[c=4 l=3]  *movdi_internal/3
+	movzbl	%r14b, %ecx	# 4677	[c=4 l=4]  *zero_extendqisi2/0
+	call	log_add_data_mov@PLT	# 4683	[c=0 l=5]  *call
+	movl	$59, %eax	# 4684	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r13), %eax	# 4685	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 4686	[c=13 l=7]  *cmpsi_1/1
+	jb	.L584	# 4687	[c=13 l=2]  *jcc
+	cmpb	$0, 1081(%r13)	# 4689	[c=13 l=8]  *cmpqi_ccno_1/1
+	jne	.L585	# 4690	[c=13 l=6]  *jcc
+.L584:
+	movq	1040(%r13), %rax	# 4693	[c=9 l=7]  *movdi_internal/3
+	movb	%r14b, 59(%rax)	# 4694	[c=4 l=4]  *movqi_internal/8
+	jmp	.L583	# 20526	[c=1 l=5]  jump
+.L1499:
+	movb	$1, 11032(%r13)	# 1934	[c=4 l=8]  *movqi_internal/8
+	movzbl	11037(%r13), %esi	# 1935	[c=13 l=8]  *zero_extendqisi2/0
+	movq	%r13, %rdi	# 1937	[c=4 l=3]  *movdi_internal/3
+	call	execute_lean@PLT	# 1938	[c=0 l=5]  *call
+	movq	%r13, %rdi	# 1939	[c=4 l=3]  *movdi_internal/3
+	call	perf_lean_resume@PLT	# 1940	[c=0 l=5]  *call
+	jmp	.L407	# 20528	[c=1 l=5]  jump
+.L1498:
+	movq	%r13, %rdi	# 1924	[c=4 l=3]  *movdi_internal/3
+	call	do_events	# 1925	[c=0 l=5]  *call
+	jmp	.L406	# 20530	[c=1 l=5]  jump
+.L1519:
+	movb	$1, 11032(%r13)	# 4021	[c=4 l=8]  *movqi_internal/8
+	movzbl	11037(%r13), %esi	# 4022	[c=13 l=8]  *zero_extendqisi2/0
+	movq	%r13, %rdi	# 4024	[c=4 l=3]  *movdi_internal/3
+	call	execute_lean@PLT	# 4025	[c=0 l=5]  *call
+	movq	%r13, %rdi	# 4026	[c=4 l=3]  *movdi_internal/3
+	call	perf_lean_resume@PLT	# 4027	[c=0 l=5]  *call
+	jmp	.L547	# 20532	[c=1 l=5]  jump
+.L1518:
+	movq	%r13, %rdi	# 4011	[c=4 l=3]  *movdi_internal/3
+	call	do_events	# 4012	[c=0 l=5]  *call
+	jmp	.L546	# 20534	[c=1 l=5]  jump
+.L1523:
+	movb	$1, 11032(%r13)	# 4729	[c=4 l=8]  *movqi_internal/8
+	movzbl	11037(%r13), %esi	# 4730	[c=13 l=8]  *zero_extendqisi2/0
+	movq	%r13, %rdi	# 4732	[c=4 l=3]  *movdi_internal/3
+	call	execute_lean@PLT	# 4733	[c=0 l=5]  *call
+	movq	%r13, %rdi	# 4734	[c=4 l=3]  *movdi_internal/3
+	call	perf_lean_resume@PLT	# 4735	[c=0 l=5]  *call
+	jmp	.L587	# 20536	[c=1 l=5]  jump
+.L1517:
+	movb	$1, 11032(%r13)	# 3889	[c=4 l=8]  *movqi_internal/8
+	movzbl	11037(%r13), %esi	# 3890	[c=13 l=8]  *zero_extendqisi2/0
+	movq	%r13, %rdi	# 3892	[c=4 l=3]  *movdi_internal/3
+	call	execute_lean@PLT	# 3893	[c=0 l=5]  *call
+	movq	%r13, %rdi	# 3894	[c=4 l=3]  *movdi_internal/3
+	call	perf_lean_resume@PLT	# 3895	[c=0 l=5]  *call
+	jmp	.L539	# 20538	[c=1 l=5]  jump
+.L1516:
+	movq	%r13, %rdi	# 3879	[c=4 l=3]  *movdi_internal/3
+	call	do_events	# 3880	[c=0 l=5]  *call
+	jmp	.L538	# 20540	[c=1 l=5]  jump
+.L1510:
+	movb	$1, 11032(%r13)	# 3275	[c=4 l=8]  *movqi_internal/8
+	movzbl	11037(%r13), %esi	# 3276	[c=13 l=8]  *zero_extendqisi2/0
+	movq	%r13, %rdi	# 3278	[c=4 l=3]  *movdi_internal/3
+	call	execute_lean@PLT	# 3279	[c=0 l=5]  *call
+	movq	%r13, %rdi	# 3280	[c=4 l=3]  *movdi_internal/3
+	call	perf_lean_resume@PLT	# 3281	[c=0 l=5]  *call
+	jmp	.L496	# 20542	[c=1 l=5]  jump
+.L1509:
+	movq	%r13, %rdi	# 3265	[c=4 l=3]  *movdi_internal/3
+	call	do_events	# 3266	[c=0 l=5]  *call
+	jmp	.L495	# 20544	[c=1 l=5]  jump
+.L1512:
+	movb	$1, 11032(%r13)	# 3367	[c=4 l=8]  *movqi_internal/8
+	movzbl	11037(%r13), %esi	# 3368	[c=13 l=8]  *zero_extendqisi2/0
+	movq	%r13, %rdi	# 3370	[c=4 l=3]  *movdi_internal/3
+	call	execute_lean@PLT	# 3371	[c=0 l=5]  *call
+	movq	%r13, %rdi	# 3372	[c=4 l=3]  *movdi_internal/3
+	call	perf_lean_resume@PLT	# 3373	[c=0 l=5]  *call
+	jmp	.L500	# 20546	[c=1 l=5]  jump
+.L1511:
+	movq	%r13, %rdi	# 3357	[c=4 l=3]  *movdi_internal/3
+	call	do_events	# 3358	[c=0 l=5]  *call
+	jmp	.L499	# 20548	[c=1 l=5]  jump
+.L1602:
+	movb	$1, 11032(%r13)	# 9850	[c=4 l=8]  *movqi_internal/8
+	movzbl	11037(%r13), %esi	# 9851	[c=13 l=8]  *zero_extendqisi2/0
+	movq	%r13, %rdi	# 9853	[c=4 l=3]  *movdi_internal/3
+	call	execute_lean@PLT	# 9854	[c=0 l=5]  *call
+	movq	%r13, %rdi	# 9855	[c=4 l=3]  *movdi_internal/3
+	call	perf_lean_resume@PLT	# 9856	[c=0 l=5]  *call
+	jmp	.L915	# 20550	[c=1 l=5]  jump
+.L1601:
+	movq	%r13, %rdi	# 9840	[c=4 l=3]  *movdi_internal/3
+	call	do_events	# 9841	[c=0 l=5]  *call
+	jmp	.L914	# 20552	[c=1 l=5]  jump
+.L1497:
+	movb	$1, 11032(%r13)	# 1830	[c=4 l=8]  *movqi_internal/8
+	movzbl	11037(%r13), %esi	# 1831	[c=13 l=8]  *zero_extendqisi2/0
+	movq	%r13, %rdi	# 1833	[c=4 l=3]  *movdi_internal/3
+	call	execute_lean@PLT	# 1834	[c=0 l=5]  *call
+	movq	%r13, %rdi	# 1835	[c=4 l=3]  *movdi_internal/3
+	call	perf_lean_resume@PLT	# 1836	[c=0 l=5]  *call
+	jmp	.L400	# 20554	[c=1 l=5]  jump
+.L1496:
+	movq	%r13, %rdi	# 1820	[c=4 l=3]  *movdi_internal/3
+	call	do_events	# 1821	[c=0 l=5]  *call
+	jmp	.L399	# 20556	[c=1 l=5]  jump
+.L1502:
+	movb	$1, 11032(%r13)	# 2038	[c=4 l=8]  *movqi_internal/8
+	movzbl	11037(%r13), %esi	# 2039	[c=13 l=8]  *zero_extendqisi2/0
+	movq	%r13, %rdi	# 2041	[c=4 l=3]  *movdi_internal/3
+	call	execute_lean@PLT	# 2042	[c=0 l=5]  *call
+	movq	%r13, %rdi	# 2043	[c=4 l=3]  *movdi_internal/3
+	call	perf_lean_resume@PLT	# 2044	[c=0 l=5]  *call
+	jmp	.L414	# 20558	[c=1 l=5]  jump
+.L1501:
+	movq	%r13, %rdi	# 2028	[c=4 l=3]  *movdi_internal/3
+	call	do_events	# 2029	[c=0 l=5]  *call
+	jmp	.L413	# 20560	[c=1 l=5]  jump
+.L1507:
+	movb	$1, 11032(%r13)	# 2556	[c=4 l=8]  *movqi_internal/8
+	movzbl	11037(%r13), %esi	# 2557	[c=13 l=8]  *zero_extendqisi2/0
+	movq	%r13, %rdi	# 2559	[c=4 l=3]  *movdi_internal/3
+	call	execute_lean@PLT	# 2560	[c=0 l=5]  *call
+	movq	%r13, %rdi	# 2561	[c=4 l=3]  *movdi_internal/3
+	call	perf_lean_resume@PLT	# 2562	[c=0 l=5]  *call
+	jmp	.L455	# 20562	[c=1 l=5]  jump
+.L1506:
+	movq	%r13, %rdi	# 2546	[c=4 l=3]  *movdi_internal/3
+	call	do_events	# 2547	[c=0 l=5]  *call
+	jmp	.L454	# 20564	[c=1 l=5]  jump
+.L1540:
+	movb	$1, 11032(%r13)	# 10585	[c=4 l=8]  *movqi_internal/8
+	movzbl	11037(%r13), %esi	# 10586	[c=13 l=8]  *zero_extendqisi2/0
+	movq	%r13, %rdi	# 10588	[c=4 l=3]  *movdi_internal/3
+	call	execute_lean@PLT	# 10589	[c=0 l=5]  *call
+	movq	%r13, %rdi	# 10590	[c=4 l=3]  *movdi_internal/3
+	call	perf_lean_resume@PLT	# 10591	[c=0 l=5]  *call
+	jmp	.L959	# 20566	[c=1 l=5]  jump
+.L1539:
+	movq	%r13, %rdi	# 10575	[c=4 l=3]  *movdi_internal/3
+	call	do_events	# 10576	[c=0 l=5]  *call
+	jmp	.L958	# 20568	[c=1 l=5]  jump
+.L1571:
+	movb	$1, 11032(%r13)	# 11048	[c=4 l=8]  *movqi_internal/8
+	movzbl	11037(%r13), %esi	# 11049	[c=13 l=8]  *zero_extendqisi2/0
+	movq	%r13, %rdi	# 11051	[c=4 l=3]  *movdi_internal/3
+	call	execute_lean@PLT	# 11052	[c=0 l=5]  *call
+	movq	%r13, %rdi	# 11053	[c=4 l=3]  *movdi_internal/3
+	call	perf_lean_resume@PLT	# 11054	[c=0 l=5]  *call
+	jmp	.L987	# 20570	[c=1 l=5]  jump
+.L1570:
+	movq	%r13, %rdi	# 11038	[c=4 l=3]  *movdi_internal/3
+	call	do_events	# 11039	[c=0 l=5]  *call
+	jmp	.L986	# 20572	[c=1 l=5]  jump
+.L1550:
+	movq	1040(%r13), %rax	# 13618	[c=9 l=7]  *movdi_internal/3
+	leaq	.LC25(%rip), %rsi	# 13622	[c=1 l=7]  *movdi_internal/4
+	movl	$59, %edx	# 13621	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 13624	[c=4 l=3]  *movdi_internal/3
+	movq	%rsi, 32(%rsp)	# 18607	[c=4 l=5]  *movdi_internal/5
+	movzbl	59(%rax), %eax	# 13619	[c=13 l=4]  *zero_extendqisi2/0
+	movl	%eax, %ecx	# 13620	[c=4 l=2]  *movsi_internal/0
+	movl	%eax, 44(%rsp)	# 18609	[c=4 l=4]  *movsi_internal/1
+	call	log_add_data_mov@PLT	# 13625	[c=0 l=5]  *call
+	movl	44(%rsp), %eax	# 18610	[c=9 l=4]  *movsi_internal/0
+	movq	32(%rsp), %rsi	# 18608	[c=9 l=5]  *movdi_internal/3
+	sall	$16, %eax	# 13626	[c=4 l=3]  *ashlsi3_1/0
+	orl	%eax, %r14d	# 13627	[c=4 l=3]  *iorsi_1/0
+	testl	$16711680, %r14d	# 13629	[c=4 l=7]  *testsi_1/2
+	je	.L1136	# 13630	[c=13 l=6]  *jcc
+	movl	%r14d, %eax	# 18018	[c=4 l=3]  *movsi_internal/0
+	movq	1072(%r13), %rdx	# 13667	[c=9 l=7]  *movdi_internal/3
+	sarl	$12, %eax	# 13665	[c=4 l=3]  *ashrsi3_1/0
+	cltq	# 13666	[c=4 l=2]  *extendsidi2_rex64/0
+	movq	(%rdx,%rax,8), %rax	# 13668	[c=10 l=4]  *movdi_internal/3
+	testq	%rax, %rax	# 13669	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L1246	# 13670	[c=13 l=6]  *jcc
+	movl	%r14d, %edx	# 18021	[c=4 l=3]  *movsi_internal/0
+	andl	$4095, %edx	# 16861	[c=5 l=6]  *andsi_1_zext
+	movzbl	(%rax,%rdx), %eax	# 13674	[c=13 l=4]  *zero_extendqisi2/0
+	movl	%eax, 24(%rsp)	# 18023	[c=4 l=4]  *movsi_internal/1
+.L1143:
+	movl	24(%rsp), %ecx	# 13677	[c=9 l=4]  *movsi_internal/0
+	movl	%r14d, %edx	# 13678	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 13681	[c=4 l=3]  *movdi_internal/3
+	call	log_add_data_mov@PLT	# 13682	[c=0 l=5]  *call
+	movl	24(%rsp), %ecx	# 13683	[c=9 l=4]  *movsi_internal/0
+	movl	16(%rsp), %edx	# 13684	[c=9 l=4]  *movsi_internal/0
+	movq	%r13, %rdi	# 13687	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 19901	[c=4 l=2]  *movdi_xor
+	leaq	.LC36(%rip), %rsi	# 13685	[c=1 l=7]  *movdi_internal/4
+	call	log_append@PLT	# 13689	[c=0 l=5]  *call
+	movzbl	24(%rsp), %eax	# 18024	[c=9 l=5]  *movqi_internal/4
+	movl	%r14d, %edx	# 13693	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 13696	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC30(%rip), %rsi	# 13694	[c=1 l=7]  *movdi_internal/4
+	movb	%al, 1004(%r13,%r15)	# 13691	[c=4 l=8]  *movqi_internal/8
+	movl	8(%rsp), %r15d	# 18611	[c=9 l=5]  *movsi_internal/0
+	movl	%r15d, %ecx	# 13692	[c=4 l=3]  *movsi_internal/0
+	call	log_add_data_mov@PLT	# 13697	[c=0 l=5]  *call
+	movl	%r15d, %edx	# 13698	[c=4 l=3]  *movsi_internal/0
+	movl	%r14d, %esi	# 13699	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 13700	[c=4 l=3]  *movdi_internal/3
+	call	far_write	# 13701	[c=0 l=5]  *call
+	jmp	.L1144	# 20574	[c=1 l=5]  jump
+.L1554:
+	movq	1040(%r13), %rax	# 13969	[c=9 l=7]  *movdi_internal/3
+	leaq	.LC25(%rip), %rsi	# 13973	[c=1 l=7]  *movdi_internal/4
+	movl	$59, %edx	# 13972	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 13975	[c=4 l=3]  *movdi_internal/3
+	movq	%rsi, 24(%rsp)	# 18626	[c=4 l=5]  *movdi_internal/5
+	movzbl	59(%rax), %eax	# 13970	[c=13 l=4]  *zero_extendqisi2/0
+	movl	%eax, %ecx	# 13971	[c=4 l=2]  *movsi_internal/0
+	movl	%eax, 32(%rsp)	# 18628	[c=4 l=4]  *movsi_internal/1
+	call	log_add_data_mov@PLT	# 13976	[c=0 l=5]  *call
+	movl	32(%rsp), %eax	# 18629	[c=9 l=4]  *movsi_internal/0
+	movq	24(%rsp), %rsi	# 18627	[c=9 l=5]  *movdi_internal/3
+	sall	$16, %eax	# 13977	[c=4 l=3]  *ashlsi3_1/0
+	orl	%eax, %r15d	# 13978	[c=4 l=3]  *iorsi_1/0
+	testl	$16711680, %r15d	# 13980	[c=4 l=7]  *testsi_1/2
+	je	.L1160	# 13981	[c=13 l=6]  *jcc
+	movl	%r15d, %eax	# 18064	[c=4 l=3]  *movsi_internal/0
+	movq	1072(%r13), %rdx	# 14018	[c=9 l=7]  *movdi_internal/3
+	sarl	$12, %eax	# 14016	[c=4 l=3]  *ashrsi3_1/0
+	cltq	# 14017	[c=4 l=2]  *extendsidi2_rex64/0
+	movq	(%rdx,%rax,8), %rax	# 14019	[c=10 l=4]  *movdi_internal/3
+	testq	%rax, %rax	# 14020	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L1248	# 14021	[c=13 l=6]  *jcc
+	movl	%r15d, %edx	# 18067	[c=4 l=3]  *movsi_internal/0
+	andl	$4095, %edx	# 16855	[c=5 l=6]  *andsi_1_zext
+	movzbl	(%rax,%rdx), %ecx	# 14025	[c=13 l=4]  *zero_extendqisi2/0
+.L1167:
+	movl	%r15d, %edx	# 14029	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 14032	[c=4 l=3]  *movdi_internal/3
+	movl	%ecx, 24(%rsp)	# 18632	[c=4 l=4]  *movsi_internal/1
+	call	log_add_data_mov@PLT	# 14033	[c=0 l=5]  *call
+	movl	24(%rsp), %ecx	# 18633	[c=9 l=4]  *movsi_internal/0
+	movl	8(%rsp), %edx	# 14035	[c=9 l=4]  *movsi_internal/0
+	movq	%r13, %rdi	# 14038	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 19891	[c=4 l=2]  *movdi_xor
+	leaq	.LC36(%rip), %rsi	# 14036	[c=1 l=7]  *movdi_internal/4
+	call	log_append@PLT	# 14040	[c=0 l=5]  *call
+	movl	24(%rsp), %ecx	# 18631	[c=9 l=4]  *movsi_internal/0
+	movl	%r15d, %edx	# 14046	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 14049	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC30(%rip), %rsi	# 14047	[c=1 l=7]  *movdi_internal/4
+	movb	%cl, 1004(%r13,%r14)	# 14042	[c=4 l=8]  *movqi_internal/8
+	movl	16(%rsp), %r14d	# 18069	[c=9 l=5]  *movsi_internal/0
+	notl	%r14d	# 14043	[c=4 l=3]  *one_cmplsi2_1/0
+	andl	%ecx, %r14d	# 14044	[c=4 l=3]  *andsi_1/0
+	movl	%r14d, %ecx	# 14045	[c=4 l=3]  *movsi_internal/0
+	call	log_add_data_mov@PLT	# 14050	[c=0 l=5]  *call
+	movl	%r14d, %edx	# 14051	[c=4 l=3]  *movsi_internal/0
+	movl	%r15d, %esi	# 14052	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 14053	[c=4 l=3]  *movdi_internal/3
+	call	far_write	# 14054	[c=0 l=5]  *call
+	jmp	.L1168	# 20576	[c=1 l=5]  jump
+.L1552:
+	movq	1040(%r13), %rax	# 13793	[c=9 l=7]  *movdi_internal/3
+	leaq	.LC25(%rip), %rsi	# 13797	[c=1 l=7]  *movdi_internal/4
+	movl	$59, %edx	# 13796	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 13799	[c=4 l=3]  *movdi_internal/3
+	movq	%rsi, 24(%rsp)	# 18616	[c=4 l=5]  *movdi_internal/5
+	movzbl	59(%rax), %eax	# 13794	[c=13 l=4]  *zero_extendqisi2/0
+	movl	%eax, %ecx	# 13795	[c=4 l=2]  *movsi_internal/0
+	movl	%eax, 32(%rsp)	# 18618	[c=4 l=4]  *movsi_internal/1
+	call	log_add_data_mov@PLT	# 13800	[c=0 l=5]  *call
+	movl	32(%rsp), %eax	# 18619	[c=9 l=4]  *movsi_internal/0
+	movq	24(%rsp), %rsi	# 18617	[c=9 l=5]  *movdi_internal/3
+	sall	$16, %eax	# 13801	[c=4 l=3]  *ashlsi3_1/0
+	orl	%eax, %r15d	# 13802	[c=4 l=3]  *iorsi_1/0
+	testl	$16711680, %r15d	# 13804	[c=4 l=7]  *testsi_1/2
+	je	.L1148	# 13805	[c=13 l=6]  *jcc
+	movl	%r15d, %eax	# 18041	[c=4 l=3]  *movsi_internal/0
+	movq	1072(%r13), %rdx	# 13842	[c=9 l=7]  *movdi_internal/3
+	sarl	$12, %eax	# 13840	[c=4 l=3]  *ashrsi3_1/0
+	cltq	# 13841	[c=4 l=2]  *extendsidi2_rex64/0
+	movq	(%rdx,%rax,8), %rax	# 13843	[c=10 l=4]  *movdi_internal/3
+	testq	%rax, %rax	# 13844	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L1247	# 13845	[c=13 l=6]  *jcc
+	movl	%r15d, %edx	# 18044	[c=4 l=3]  *movsi_internal/0
+	andl	$4095, %edx	# 16858	[c=5 l=6]  *andsi_1_zext
+	movzbl	(%rax,%rdx), %ecx	# 13849	[c=13 l=4]  *zero_extendqisi2/0
+.L1155:
+	movl	%r15d, %edx	# 13853	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 13856	[c=4 l=3]  *movdi_internal/3
+	movl	%ecx, 24(%rsp)	# 18622	[c=4 l=4]  *movsi_internal/1
+	call	log_add_data_mov@PLT	# 13857	[c=0 l=5]  *call
+	movl	24(%rsp), %ecx	# 18623	[c=9 l=4]  *movsi_internal/0
+	movl	8(%rsp), %edx	# 13859	[c=9 l=4]  *movsi_internal/0
+	movq	%r13, %rdi	# 13862	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 19896	[c=4 l=2]  *movdi_xor
+	leaq	.LC36(%rip), %rsi	# 13860	[c=1 l=7]  *movdi_internal/4
+	call	log_append@PLT	# 13864	[c=0 l=5]  *call
+	movl	24(%rsp), %ecx	# 18621	[c=9 l=4]  *movsi_internal/0
+	movl	%r15d, %edx	# 13869	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 13872	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC30(%rip), %rsi	# 13870	[c=1 l=7]  *movdi_internal/4
+	movb	%cl, 1004(%r13,%r14)	# 13866	[c=4 l=8]  *movqi_internal/8
+	movl	16(%rsp), %r14d	# 18046	[c=9 l=5]  *movsi_internal/0
+	orl	%ecx, %r14d	# 13867	[c=4 l=3]  *iorsi_1/0
+	movl	%r14d, %ecx	# 13868	[c=4 l=3]  *movsi_internal/0
+	call	log_add_data_mov@PLT	# 13873	[c=0 l=5]  *call
+	movl	%r14d, %edx	# 13874	[c=4 l=3]  *movsi_internal/0
+	movl	%r15d, %esi	# 13875	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 13876	[c=4 l=3]  *movdi_internal/3
+	call	far_write	# 13877	[c=0 l=5]  *call
+	jmp	.L1156	# 20578	[c=1 l=5]  jump
+.L1542:
+	movb	$1, 11032(%r13)	# 10692	[c=4 l=8]  *movqi_internal/8
+	movzbl	11037(%r13), %esi	# 10693	[c=13 l=8]  *zero_extendqisi2/0
+	movq	%r13, %rdi	# 10695	[c=4 l=3]  *movdi_internal/3
+	call	execute_lean@PLT	# 10696	[c=0 l=5]  *call
+	movq	%r13, %rdi	# 10697	[c=4 l=3]  *movdi_internal/3
+	call	perf_lean_resume@PLT	# 10698	[c=0 l=5]  *call
+	jmp	.L967	# 20580	[c=1 l=5]  jump
+.L1541:
+	movq	%r13, %rdi	# 10682	[c=4 l=3]  *movdi_internal/3
+	call	do_events	# 10683	[c=0 l=5]  *call
+	jmp	.L966	# 20582	[c=1 l=5]  jump
+.L1538:
+	movb	$1, 11032(%r13)	# 10478	[c=4 l=8]  *movqi_internal/8
+	movzbl	11037(%r13), %esi	# 10479	[c=13 l=8]  *zero_extendqisi2/0
+	movq	%r13, %rdi	# 10481	[c=4 l=3]  *movdi_internal/3
+	call	execute_lean@PLT	# 10482	[c=0 l=5]  *call
+	movq	%r13, %rdi	# 10483	[c=4 l=3]  *movdi_internal/3
+	call	perf_lean_resume@PLT	# 10484	[c=0 l=5]  *call
+	jmp	.L951	# 20584	[c=1 l=5]  jump
+.L1537:
+	movq	%r13, %rdi	# 10468	[c=4 l=3]  *movdi_internal/3
+	call	do_events	# 10469	[c=0 l=5]  *call
+	jmp	.L950	# 20586	[c=1 l=5]  jump
+.L1567:
+	movb	$1, 11032(%r13)	# 10882	[c=4 l=8]  *movqi_internal/8
+	movzbl	11037(%r13), %esi	# 10883	[c=13 l=8]  *zero_extendqisi2/0
+	movq	%r13, %rdi	# 10885	[c=4 l=3]  *movdi_internal/3
+	call	execute_lean@PLT	# 10886	[c=0 l=5]  *call
+	movq	%r13, %rdi	# 10887	[c=4 l=3]  *movdi_internal/3
+	call	perf_lean_resume@PLT	# 10888	[c=0 l=5]  *call
+	jmp	.L979	# 20588	[c=1 l=5]  jump
+.L1566:
+	movq	%r13, %rdi	# 10872	[c=4 l=3]  *movdi_internal/3
+	call	do_events	# 10873	[c=0 l=5]  *call
+	jmp	.L978	# 20590	[c=1 l=5]  jump
+.L1569:
+	movb	$1, 11032(%r13)	# 10965	[c=4 l=8]  *movqi_internal/8
+	movzbl	11037(%r13), %esi	# 10966	[c=13 l=8]  *zero_extendqisi2/0
+	movq	%r13, %rdi	# 10968	[c=4 l=3]  *movdi_internal/3
+	call	execute_lean@PLT	# 10969	[c=0 l=5]  *call
+	movq	%r13, %rdi	# 10970	[c=4 l=3]  *movdi_internal/3
+	call	perf_lean_resume@PLT	# 10971	[c=0 l=5]  *call
+	jmp	.L983	# 20592	[c=1 l=5]  jump
+.L1568:
+	movq	%r13, %rdi	# 10955	[c=4 l=3]  *movdi_internal/3
+	call	do_events	# 10956	[c=0 l=5]  *call
+	jmp	.L982	# 20594	[c=1 l=5]  jump
+.L1557:
+	movb	$1, 11032(%r13)	# 11233	[c=4 l=8]  *movqi_internal/8
+	movzbl	11037(%r13), %esi	# 11234	[c=13 l=8]  *zero_extendqisi2/0
+	movq	%r13, %rdi	# 11236	[c=4 l=3]  *movdi_internal/3
+	call	execute_lean@PLT	# 11237	[c=0 l=5]  *call
+	movq	%r13, %rdi	# 11238	[c=4 l=3]  *movdi_internal/3
+	call	perf_lean_resume@PLT	# 11239	[c=0 l=5]  *call
+	jmp	.L997	# 20596	[c=1 l=5]  jump
+.L1556:
+	movq	%r13, %rdi	# 11223	[c=4 l=3]  *movdi_internal/3
+	call	do_events	# 11224	[c=0 l=5]  *call
+	jmp	.L996	# 20598	[c=1 l=5]  jump
+.L1560:
+	movb	$1, 11032(%r13)	# 11465	[c=4 l=8]  *movqi_internal/8
+	movzbl	11037(%r13), %esi	# 11466	[c=13 l=8]  *zero_extendqisi2/0
+	movq	%r13, %rdi	# 11468	[c=4 l=3]  *movdi_internal/3
+	call	execute_lean@PLT	# 11469	[c=0 l=5]  *call
+	movq	%r13, %rdi	# 11470	[c=4 l=3]  *movdi_internal/3
+	call	perf_lean_resume@PLT	# 11471	[c=0 l=5]  *call
+	jmp	.L1012	# 20600	[c=1 l=5]  jump
+.L1559:
+	movq	%r13, %rdi	# 11455	[c=4 l=3]  *movdi_internal/3
+	call	do_events	# 11456	[c=0 l=5]  *call
+	jmp	.L1011	# 20602	[c=1 l=5]  jump
+.L1578:
+	movb	$1, 11032(%r13)	# 9125	[c=4 l=8]  *movqi_internal/8
+	movzbl	11037(%r13), %esi	# 9126	[c=13 l=8]  *zero_extendqisi2/0
+	movq	%r13, %rdi	# 9128	[c=4 l=3]  *movdi_internal/3
+	call	execute_lean@PLT	# 9129	[c=0 l=5]  *call
+	movq	%r13, %rdi	# 9130	[c=4 l=3]  *movdi_internal/3
+	call	perf_lean_resume@PLT	# 9131	[c=0 l=5]  *call
+	jmp	.L853	# 20604	[c=1 l=5]  jump
+.L1577:
+	movq	%r13, %rdi	# 9115	[c=4 l=3]  *movdi_internal/3
+	call	do_events	# 9116	[c=0 l=5]  *call
+	jmp	.L852	# 20606	[c=1 l=5]  jump
+.L1599:
+	movb	$1, 11032(%r13)	# 9773	[c=4 l=8]  *movqi_internal/8
+	movzbl	11037(%r13), %esi	# 9774	[c=13 l=8]  *zero_extendqisi2/0
+	movq	%r13, %rdi	# 9776	[c=4 l=3]  *movdi_internal/3
+	call	execute_lean@PLT	# 9777	[c=0 l=5]  *call
+	movq	%r13, %rdi	# 9778	[c=4 l=3]  *movdi_internal/3
+	call	perf_lean_resume@PLT	# 9779	[c=0 l=5]  *call
+	jmp	.L911	# 20608	[c=1 l=5]  jump
+.L1598:
+	movq	%r13, %rdi	# 9763	[c=4 l=3]  *movdi_internal/3
+	call	do_events	# 9764	[c=0 l=5]  *call
+	jmp	.L910	# 20610	[c=1 l=5]  jump
+.L1573:
+	movb	$1, 11032(%r13)	# 11131	[c=4 l=8]  *movqi_internal/8
+	movzbl	11037(%r13), %esi	# 11132	[c=13 l=8]  *zero_extendqisi2/0
+	movq	%r13, %rdi	# 11134	[c=4 l=3]  *movdi_internal/3
+	call	execute_lean@PLT	# 11135	[c=0 l=5]  *call
+	movq	%r13, %rdi	# 11136	[c=4 l=3]  *movdi_internal/3
+	call	perf_lean_resume@PLT	# 11137	[c=0 l=5]  *call
+	jmp	.L991	# 20612	[c=1 l=5]  jump
+.L1572:
+	movq	%r13, %rdi	# 11121	[c=4 l=3]  *movdi_internal/3
+	call	do_events	# 11122	[c=0 l=5]  *call
+	jmp	.L990	# 20614	[c=1 l=5]  jump
+.L1583:
+	movb	$1, 11032(%r13)	# 9419	[c=4 l=8]  *movqi_internal/8
+	movzbl	11037(%r13), %esi	# 9420	[c=13 l=8]  *zero_extendqisi2/0
+	movq	%r13, %rdi	# 9422	[c=4 l=3]  *movdi_internal/3
+	call	execute_lean@PLT	# 9423	[c=0 l=5]  *call
+	movq	%r13, %rdi	# 9424	[c=4 l=3]  *movdi_internal/3
+	call	perf_lean_resume@PLT	# 9425	[c=0 l=5]  *call
+	jmp	.L879	# 20616	[c=1 l=5]  jump
+.L1582:
+	movq	%r13, %rdi	# 9409	[c=4 l=3]  *movdi_internal/3
+	call	do_events	# 9410	[c=0 l=5]  *call
+	jmp	.L878	# 20618	[c=1 l=5]  jump
+.L1535:
+	movb	$1, 11032(%r13)	# 5802	[c=4 l=8]  *movqi_internal/8
+	movzbl	11037(%r13), %esi	# 5803	[c=13 l=8]  *zero_extendqisi2/0
+	movq	%r13, %rdi	# 5805	[c=4 l=3]  *movdi_internal/3
+	call	execute_lean@PLT	# 5806	[c=0 l=5]  *call
+	movq	%r13, %rdi	# 5807	[c=4 l=3]  *movdi_internal/3
+	call	perf_lean_resume@PLT	# 5808	[c=0 l=5]  *call
+	jmp	.L655	# 20620	[c=1 l=5]  jump
+.L1534:
+	movq	%r13, %rdi	# 5792	[c=4 l=3]  *movdi_internal/3
+	call	do_events	# 5793	[c=0 l=5]  *call
+	jmp	.L654	# 20622	[c=1 l=5]  jump
+.L1544:
+	movb	$1, 11032(%r13)	# 10799	[c=4 l=8]  *movqi_internal/8
+	movzbl	11037(%r13), %esi	# 10800	[c=13 l=8]  *zero_extendqisi2/0
+	movq	%r13, %rdi	# 10802	[c=4 l=3]  *movdi_internal/3
+	call	execute_lean@PLT	# 10803	[c=0 l=5]  *call
+	movq	%r13, %rdi	# 10804	[c=4 l=3]  *movdi_internal/3
+	call	perf_lean_resume@PLT	# 10805	[c=0 l=5]  *call
+	jmp	.L975	# 20624	[c=1 l=5]  jump
+.L1543:
+	movq	%r13, %rdi	# 10789	[c=4 l=3]  *movdi_internal/3
+	call	do_events	# 10790	[c=0 l=5]  *call
+	jmp	.L974	# 20626	[c=1 l=5]  jump
+.L317:
+	leaq	.LC46(%rip), %rsi	# 319	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 321	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 20324	[c=4 l=2]  *movdi_xor
+	call	log_append@PLT	# 323	[c=0 l=5]  *call
+.L326:
+	movq	%r13, %rdi	# 619	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rsi	# 618	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 620	[c=0 l=5]  *call
+	movq	40(%r13), %rax	# 17085	[c=9 l=4]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 17086	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 622	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 18903	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r13)	# 623	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 625	[c=4 l=3]  *cmpdi_1/0
+	jb	.L344	# 626	[c=13 l=6]  *jcc
+	movq	56(%r13), %rax	# 17087	[c=9 l=4]  *movdi_internal/3
+	cmpq	%rax, 48(%r13)	# 638	[c=13 l=4]  *cmpdi_1/0
+	jnb	.L1607	# 639	[c=13 l=6]  *jcc
+.L334:
+	movq	%r13, %rdi	# 645	[c=4 l=3]  *movdi_internal/3
+	call	log_is_idle@PLT	# 646	[c=10 l=5]  *call_value
+	testb	%al, %al	# 648	[c=4 l=2]  *cmpqi_ccno_1/0
+	jne	.L1608	# 649	[c=13 l=6]  *jcc
+.L335:
+	movl	0(%r13), %ebx	# 660	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r13, %rdi	# 665	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rbx	# 661	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r13), %rbx	# 663	[c=13 l=7]  *adddi_1/1
+	movq	%rbx, %rsi	# 664	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 666	[c=0 l=5]  *call
+	movzbl	9(%rbx), %eax	# 667	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, 0(%r13)	# 668	[c=9 l=4]  *addsi_1/0
+	movzbl	8(%rbx), %eax	# 671	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 17088	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 672	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbp,%rdx), %rdx	# 675	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r13)	# 676	[c=13 l=4]  *adddi_1/0
+	jmp	*(%r12,%rax,8)	# 20293	[c=10 l=4]  *indirect_jump
+.L325:
+	movzwl	1028(%r13), %edx	# 611	[c=13 l=8]  *zero_extendhisi2/0
+	movl	%r14d, %esi	# 613	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 614	[c=4 l=3]  *movdi_internal/3
+	call	do_syscall@PLT	# 615	[c=0 l=5]  *call
+	jmp	.L326	# 20630	[c=1 l=5]  jump
+.L1029:
+	movl	%r14d, %edx	# 11787	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 11790	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC30(%rip), %rsi	# 11788	[c=1 l=7]  *movdi_internal/4
+	movl	%r15d, %ecx	# 11786	[c=4 l=3]  *movsi_internal/0
+	call	log_add_data_mov@PLT	# 11791	[c=0 l=5]  *call
+	movl	%r15d, %edx	# 11792	[c=4 l=3]  *movsi_internal/0
+	movl	%r14d, %esi	# 11793	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 11794	[c=4 l=3]  *movdi_internal/3
+	call	far_write	# 11795	[c=0 l=5]  *call
+	jmp	.L1033	# 20632	[c=1 l=5]  jump
+.L888:
+	movl	%r15d, %esi	# 9532	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 9533	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 9534	[c=10 l=5]  *call_value
+	movl	%eax, %r14d	# 9535	[c=4 l=3]  *movsi_internal/0
+	jmp	.L889	# 20634	[c=1 l=5]  jump
+.L1175:
+	movl	%r15d, %esi	# 14180	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 14181	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 14182	[c=10 l=5]  *call_value
+	movl	%eax, %r9d	# 14183	[c=4 l=3]  *movsi_internal/0
+	jmp	.L1176	# 20636	[c=1 l=5]  jump
+.L862:
+	movl	%r15d, %esi	# 9238	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 9239	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 9240	[c=10 l=5]  *call_value
+	movl	%eax, %r14d	# 9241	[c=4 l=3]  *movsi_internal/0
+	jmp	.L863	# 20638	[c=1 l=5]  jump
+.L846:
+	movl	%eax, %edx	# 9030	[c=4 l=2]  *movsi_internal/0
+	movl	%r14d, %esi	# 9031	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 9032	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 9033	[c=0 l=5]  *call
+	jmp	.L847	# 20640	[c=1 l=5]  jump
+.L1001:
+	movl	$59, %esi	# 11294	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 11295	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 11296	[c=10 l=5]  *call_value
+	movl	%eax, %r14d	# 11297	[c=4 l=3]  *movsi_internal/0
+	jmp	.L1002	# 20642	[c=1 l=5]  jump
+.L1163:
+	movl	%r15d, %esi	# 14003	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 14004	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 14005	[c=10 l=5]  *call_value
+	movl	%eax, %r9d	# 14006	[c=4 l=3]  *movsi_internal/0
+	jmp	.L1164	# 20644	[c=1 l=5]  jump
+.L1151:
+	movl	%r15d, %esi	# 13827	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 13828	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 13829	[c=10 l=5]  *call_value
+	movl	%eax, %r9d	# 13830	[c=4 l=3]  *movsi_internal/0
+	jmp	.L1152	# 20646	[c=1 l=5]  jump
+.L1139:
+	movl	%r14d, %esi	# 13652	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 13653	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 13654	[c=10 l=5]  *call_value
+	movl	%eax, %ecx	# 13655	[c=4 l=2]  *movsi_internal/0
+	jmp	.L1140	# 20648	[c=1 l=5]  jump
+.L627:
+	movl	%eax, %edx	# 5346	[c=4 l=2]  *movsi_internal/0
+	movl	%r14d, %esi	# 5347	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 5348	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 5349	[c=0 l=5]  *call
+	jmp	.L628	# 20650	[c=1 l=5]  jump
+.L573:
+	movl	$59, %esi	# 4514	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 4515	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 4516	[c=10 l=5]  *call_value
+	movl	%eax, %r15d	# 4517	[c=4 l=3]  *movsi_internal/0
+	jmp	.L574	# 20652	[c=1 l=5]  jump
+.L528:
+	movl	%eax, %edx	# 3756	[c=4 l=2]  *movsi_internal/0
+	movl	%r14d, %esi	# 3757	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 3758	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 3759	[c=0 l=5]  *call
+	jmp	.L529	# 20654	[c=1 l=5]  jump
+.L447:
+	movl	%eax, %edx	# 2456	[c=4 l=2]  *movsi_internal/0
+	movl	%r14d, %esi	# 2457	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 2458	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 2459	[c=0 l=5]  *call
+	jmp	.L448	# 20656	[c=1 l=5]  jump
+.L318:
+	leaq	.LC58(%rip), %rsi	# 597	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 599	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 20295	[c=4 l=2]  *movdi_xor
+	call	log_append@PLT	# 601	[c=0 l=5]  *call
+	movl	$1, %esi	# 604	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 605	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 20296	[c=4 l=2]  *movdi_xor
+	leaq	.LC59(%rip), %rdx	# 602	[c=1 l=7]  *movdi_internal/4
+	call	leave	# 607	[c=0 l=5]  *call
+.L320:
+	movswl	1028(%r13), %ebx	# 571	[c=13 l=8]  extendhisi2/1
+	leaq	.LC56(%rip), %rsi	# 573	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 575	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 20297	[c=4 l=2]  *movdi_xor
+	movl	%ebx, %edx	# 572	[c=4 l=2]  *movsi_internal/0
+	call	log_append@PLT	# 577	[c=0 l=5]  *call
+	movl	$24, %edx	# 580	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 583	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 20298	[c=4 l=2]  *movdi_xor
+	movzwl	1028(%r13), %ecx	# 578	[c=13 l=8]  *zero_extendhisi2/0
+	leaq	.LC34(%rip), %rsi	# 581	[c=1 l=7]  *movdi_internal/4
+	call	log_append@PLT	# 585	[c=0 l=5]  *call
+	movl	%ebx, 76(%r13)	# 586	[c=4 l=4]  *movsi_internal/1
+	movl	%ebx, %ecx	# 587	[c=4 l=2]  *movsi_internal/0
+	xorl	%esi, %esi	# 20299	[c=4 l=2]  *movdi_xor
+	leaq	.LC57(%rip), %rdx	# 588	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 591	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 20300	[c=4 l=2]  *movdi_xor
+	call	leave	# 593	[c=0 l=5]  *call
+.L321:
+	cmpl	$0, 264(%r13)	# 537	[c=13 l=8]  *cmpsi_ccno_1/1
+	je	.L332	# 538	[c=13 l=6]  *jcc
+	movq	%r13, %rdi	# 542	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 20302	[c=4 l=2]  *movdi_xor
+	leaq	.LC54(%rip), %rsi	# 540	[c=1 l=7]  *movdi_internal/4
+	call	log_append@PLT	# 544	[c=0 l=5]  *call
+	movq	%r13, %rdi	# 551	[c=4 l=3]  *movdi_internal/3
+	movl	$24, %edx	# 548	[c=4 l=5]  *movsi_internal/0
+	xorl	%eax, %eax	# 20303	[c=4 l=2]  *movdi_xor
+	movzbl	1028(%r13), %ecx	# 546	[c=13 l=8]  *zero_extendqisi2/0
+	movq	904(%r13), %r14	# 545	[c=9 l=7]  *movdi_internal/3
+	leaq	.LC35(%rip), %rsi	# 549	[c=1 l=7]  *movdi_internal/4
+	call	log_append@PLT	# 553	[c=0 l=5]  *call
+	movsbl	1028(%r13), %edi	# 554	[c=13 l=8]  extendqisi2
+	movq	%r14, %rsi	# 555	[c=4 l=3]  *movdi_internal/3
+	call	putc@PLT	# 557	[c=10 l=5]  *call_value
+	jmp	.L326	# 20658	[c=1 l=5]  jump
+.L322:
+	cmpl	$0, 248(%r13)	# 496	[c=13 l=8]  *cmpsi_ccno_1/1
+	je	.L331	# 497	[c=13 l=6]  *jcc
+	leaq	.LC52(%rip), %rsi	# 499	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 501	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 20305	[c=4 l=2]  *movdi_xor
+	call	log_append@PLT	# 503	[c=0 l=5]  *call
+	movq	904(%r13), %rdi	# 504	[c=9 l=7]  *movdi_internal/3
+	call	fflush@PLT	# 506	[c=10 l=5]  *call_value
+	movq	40(%r13), %rdx	# 507	[c=9 l=4]  *movdi_internal/3
+	xorl	%esi, %esi	# 20306	[c=4 l=2]  *movdi_xor
+	movq	%r13, %rdi	# 512	[c=4 l=3]  *movdi_internal/3
+	leaq	host_getchar(%rip), %rcx	# 508	[c=1 l=7]  *movdi_internal/4
+	call	replay_input@PLT	# 513	[c=10 l=5]  *call_value
+	movl	$24, %edx	# 517	[c=4 l=5]  *movsi_internal/0
+	leaq	.LC37(%rip), %rsi	# 518	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 520	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, %r14d	# 514	[c=4 l=3]  *movsi_internal/0
+	movzwl	%ax, %ecx	# 515	[c=4 l=3]  *zero_extendhisi2/0
+	xorl	%eax, %eax	# 20307	[c=4 l=2]  *movdi_xor
+	call	log_append@PLT	# 522	[c=0 l=5]  *call
+	movw	%r14w, 1028(%r13)	# 523	[c=4 l=8]  *movhi_internal/3
+	jmp	.L326	# 20660	[c=1 l=5]  jump
+.L323:
+	cmpl	$0, 504(%r13)	# 405	[c=13 l=8]  *cmpsi_ccno_1/1
+	jne	.L330	# 406	[c=13 l=6]  *jcc
+	leaq	.LC37(%rip), %r14	# 415	[c=1 l=7]  *movdi_internal/4
+	leaq	.LC49(%rip), %rsi	# 408	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 410	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 20313	[c=4 l=2]  *movdi_xor
+	call	log_append@PLT	# 412	[c=0 l=5]  *call
+	movl	$1, %ecx	# 413	[c=4 l=5]  *movsi_internal/0
+	movq	%r14, %rsi	# 416	[c=4 l=3]  *movdi_internal/3
+	movq	%r13, %rdi	# 417	[c=4 l=3]  *movdi_internal/3
+	movl	$20, %edx	# 414	[c=4 l=5]  *movsi_internal/0
+	xorl	%eax, %eax	# 20314	[c=4 l=2]  *movdi_xor
+	call	log_append@PLT	# 419	[c=0 l=5]  *call
+	xorl	%ecx, %ecx	# 20315	[c=4 l=2]  *movdi_xor
+	movl	$22, %edx	# 423	[c=4 l=5]  *movsi_internal/0
+	movq	%r14, %rsi	# 425	[c=4 l=3]  *movdi_internal/3
+	movzwl	.LC50(%rip), %eax	# 420	[c=6 l=7]  *movv2qi_internal/2
+	movq	%r13, %rdi	# 426	[c=4 l=3]  *movdi_internal/3
+	movw	%ax, 1024(%r13)	# 421	[c=4 l=8]  *movv2qi_internal/3
+	xorl	%eax, %eax	# 20316	[c=4 l=2]  *movdi_xor
+	call	log_append@PLT	# 428	[c=0 l=5]  *call
+	xorl	%ecx, %ecx	# 20317	[c=4 l=2]  *movdi_xor
+	movl	$24, %edx	# 432	[c=4 l=5]  *movsi_internal/0
+	movq	%r14, %rsi	# 434	[c=4 l=3]  *movdi_internal/3
+	movw	$0, 1026(%r13)	# 430	[c=4 l=10]  *movv2qi_internal/3
+	movq	%r13, %rdi	# 435	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 20318	[c=4 l=2]  *movdi_xor
+	call	log_append@PLT	# 437	[c=0 l=5]  *call
+	movw	$0, 1028(%r13)	# 439	[c=4 l=10]  *movv2qi_internal/3
+	jmp	.L326	# 20662	[c=1 l=5]  jump
+.L324:
+	movzbl	1028(%r13), %ecx	# 328	[c=13 l=8]  *zero_extendqisi2/0
+	movl	$24, %edx	# 330	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 333	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 20320	[c=4 l=2]  *movdi_xor
+	leaq	.LC35(%rip), %rsi	# 331	[c=1 l=7]  *movdi_internal/4
+	call	log_append@PLT	# 335	[c=0 l=5]  *call
+	movl	$20, %edx	# 340	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 343	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 20321	[c=4 l=2]  *movdi_xor
+	movzwl	1024(%r13), %r9d	# 338	[c=13 l=8]  *zero_extendhisi2/0
+	movzbl	1028(%r13), %r15d	# 336	[c=13 l=8]  *zero_extendqisi2/0
+	leaq	.LC34(%rip), %rsi	# 341	[c=1 l=7]  *movdi_internal/4
+	movl	%r9d, %ecx	# 339	[c=4 l=3]  *movsi_internal/0
+	movl	%r9d, 8(%rsp)	# 18121	[c=4 l=5]  *movsi_internal/1
+	movb	%r15b, 16(%rsp)	# 18123	[c=4 l=5]  *movqi_internal/8
+	call	log_append@PLT	# 345	[c=0 l=5]  *call
+	movl	$22, %edx	# 348	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 351	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 20322	[c=4 l=2]  *movdi_xor
+	movzwl	1026(%r13), %r14d	# 346	[c=13 l=8]  *zero_extendhisi2/0
+	leaq	.LC34(%rip), %rsi	# 18120	[c=1 l=7]  *movdi_internal/4
+	movl	%r14d, %ecx	# 347	[c=4 l=3]  *movsi_internal/0
+	sall	$16, %r14d	# 354	[c=4 l=4]  *ashlsi3_1/0
+	call	log_append@PLT	# 353	[c=0 l=5]  *call
+	movl	8(%rsp), %r9d	# 18122	[c=9 l=5]  *movsi_internal/0
+	movl	%r15d, %edx	# 357	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 360	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC47(%rip), %rsi	# 358	[c=1 l=7]  *movdi_internal/4
+	xorl	%eax, %eax	# 20323	[c=4 l=2]  *movdi_xor
+	orl	%r9d, %r14d	# 355	[c=4 l=3]  *iorsi_1/0
+	movl	%r14d, %ecx	# 356	[c=4 l=3]  *movsi_internal/0
+	call	log_append@PLT	# 362	[c=0 l=5]  *call
+	movzbl	16(%rsp), %r8d	# 18124	[c=9 l=6]  *movqi_internal/4
+	testb	%r8b, %r8b	# 365	[c=4 l=3]  *cmpqi_ccno_1/0
+	jle	.L327	# 366	[c=13 l=6]  *jcc
+	cmpl	$8193, 880(%r13)	# 15261	[c=13 l=11]  *cmpsi_1/0
+	sbbl	%eax, %eax	# 15262	[c=8 l=2]  *x86_movsicc_0_m1
+	addl	$2, %eax	# 15263	[c=4 l=3]  *addsi_1/0
+	imull	%r15d, %eax	# 376	[c=12 l=4]  *mulsi3_1/2
+	cmpl	%eax, 992(%r13)	# 377	[c=13 l=7]  *cmpsi_1/0
+	jb	.L327	# 378	[c=13 l=6]  *jcc
+	movq	irq_raise@GOTPCREL(%rip), %rdx	# 397	[c=5 l=7]  *movdi_internal/3
+	movl	%r14d, %esi	# 391	[c=1 l=3]  *zero_extendsidi2/3
+	movl	%r15d, %ecx	# 394	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 399	[c=4 l=3]  *movdi_internal/3
+	addq	48(%r13), %rsi	# 393	[c=13 l=4]  *adddi_1/1
+	call	event_schedule@PLT	# 400	[c=0 l=5]  *call
+	jmp	.L326	# 20664	[c=1 l=5]  jump
+.L1514:
+	movzbl	%r14b, %edx	# 3782	[c=4 l=4]  *zero_extendqisi2/0
+	movl	$61, %esi	# 3784	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 3785	[c=4 l=3]  *movdi_internal/3
+	call	data_write_mapped	# 3786	[c=0 l=5]  *call
+	jmp	.L531	# 20666	[c=1 l=5]  jump
+.L1515:
+	movl	%r15d, %edx	# 3806	[c=4 l=3]  *movsi_internal/0
+	movl	$62, %esi	# 3807	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 3808	[c=4 l=3]  *movdi_internal/3
+	call	data_write_mapped	# 3809	[c=0 l=5]  *call
+	jmp	.L533	# 20668	[c=1 l=5]  jump
+.L1525:
+	movzbl	%r14b, %edx	# 5372	[c=4 l=4]  *zero_extendqisi2/0
+	movl	$61, %esi	# 5374	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 5375	[c=4 l=3]  *movdi_internal/3
+	call	data_write_mapped	# 5376	[c=0 l=5]  *call
+	jmp	.L630	# 20670	[c=1 l=5]  jump
+.L1526:
+	movl	%r15d, %edx	# 5396	[c=4 l=3]  *movsi_internal/0
+	movl	$62, %esi	# 5397	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 5398	[c=4 l=3]  *movdi_internal/3
+	call	data_write_mapped	# 5399	[c=0 l=5]  *call
+	jmp	.L632	# 20672	[c=1 l=5]  jump
+.L1505:
+	movl	%eax, %edx	# 2506	[c=4 l=2]  *movsi_internal/0
+	movl	$62, %esi	# 2507	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 2508	[c=4 l=3]  *movdi_internal/3
+	call	data_write_mapped	# 2509	[c=0 l=5]  *call
+	jmp	.L452	# 20674	[c=1 l=5]  jump
+.L1576:
+	movl	%eax, %edx	# 9080	[c=4 l=2]  *movsi_internal/0
+	movl	$62, %esi	# 9081	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 9082	[c=4 l=3]  *movdi_internal/3
+	call	data_write_mapped	# 9083	[c=0 l=5]  *call
+	jmp	.L851	# 20676	[c=1 l=5]  jump
+.L1575:
+	movzbl	%r14b, %edx	# 9056	[c=4 l=4]  *zero_extendqisi2/0
+	movl	$61, %esi	# 9058	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 9059	[c=4 l=3]  *movdi_internal/3
+	call	data_write_mapped	# 9060	[c=0 l=5]  *call
+	jmp	.L849	# 20678	[c=1 l=5]  jump
+.L1581:
+	movl	%r15d, %edx	# 9380	[c=4 l=3]  *movsi_internal/0
+	movl	$62, %esi	# 9381	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 9382	[c=4 l=3]  *movdi_internal/3
+	call	data_write_mapped	# 9383	[c=0 l=5]  *call
+	jmp	.L877	# 20680	[c=1 l=5]  jump
+.L1580:
+	movzbl	%r8b, %edx	# 9356	[c=4 l=4]  *zero_extendqisi2/0
+	movl	$61, %esi	# 9358	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 9359	[c=4 l=3]  *movdi_internal/3
+	call	data_write_mapped	# 9360	[c=0 l=5]  *call
+	jmp	.L875	# 20682	[c=1 l=5]  jump
+.L1597:
+	movl	%r15d, %edx	# 9674	[c=4 l=3]  *movsi_internal/0
+	movl	$62, %esi	# 9675	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 9676	[c=4 l=3]  *movdi_internal/3
+	call	data_write_mapped	# 9677	[c=0 l=5]  *call
+	jmp	.L903	# 20684	[c=1 l=5]  jump
+.L1596:
+	movzbl	%r8b, %edx	# 9650	[c=4 l=4]  *zero_extendqisi2/0
+	movl	$61, %esi	# 9652	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 9653	[c=4 l=3]  *movdi_internal/3
+	call	data_write_mapped	# 9654	[c=0 l=5]  *call
+	jmp	.L901	# 20686	[c=1 l=5]  jump
+.L1592:
+	movl	%r15d, %edx	# 8800	[c=4 l=3]  *movsi_internal/0
+	movl	$62, %esi	# 8801	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 8802	[c=4 l=3]  *movdi_internal/3
+	call	data_write_mapped	# 8803	[c=0 l=5]  *call
+	jmp	.L827	# 20688	[c=1 l=5]  jump
+.L1591:
+	movzbl	%r14b, %edx	# 8776	[c=4 l=4]  *zero_extendqisi2/0
+	movl	$61, %esi	# 8778	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 8779	[c=4 l=3]  *movdi_internal/3
+	call	data_write_mapped	# 8780	[c=0 l=5]  *call
+	jmp	.L825	# 20690	[c=1 l=5]  jump
+.L1588:
+	movl	%r14d, %edx	# 8553	[c=4 l=3]  *movsi_internal/0
+	movl	$62, %esi	# 8554	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 8555	[c=4 l=3]  *movdi_internal/3
+	call	data_write_mapped	# 8556	[c=0 l=5]  *call
+	jmp	.L808	# 20692	[c=1 l=5]  jump
+.L1587:
+	movzbl	%r15b, %edx	# 8529	[c=4 l=4]  *zero_extendqisi2/0
+	movl	$61, %esi	# 8531	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 8532	[c=4 l=3]  *movdi_internal/3
+	call	data_write_mapped	# 8533	[c=0 l=5]  *call
+	jmp	.L806	# 20694	[c=1 l=5]  jump
+.L1504:
+	movzbl	%r14b, %edx	# 2482	[c=4 l=4]  *zero_extendqisi2/0
+	movl	$61, %esi	# 2484	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 2485	[c=4 l=3]  *movdi_internal/3
+	call	data_write_mapped	# 2486	[c=0 l=5]  *call
+	jmp	.L450	# 20696	[c=1 l=5]  jump
+.L1383:
+	movl	0(%r13), %eax	# 17277	[c=5 l=4]  *movsi_internal/0
+	movq	1056(%r13), %rdx	# 3555	[c=9 l=7]  *movdi_internal/3
+	leaq	.LC38(%rip), %rsi	# 3558	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 3560	[c=4 l=3]  *movdi_internal/3
+	subl	$1, %eax	# 3551	[c=4 l=3]  *addsi_1/0
+	movl	%eax, 0(%r13)	# 3552	[c=4 l=4]  *movsi_internal/1
+	addl	%eax, %eax	# 3553	[c=5 l=2]  *ashlsi3_1_zext/0
+	movzwl	(%rdx,%rax), %ebx	# 3556	[c=13 l=4]  *zero_extendhisi2/0
+	xorl	%eax, %eax	# 20215	[c=4 l=2]  *movdi_xor
+	movl	%ebx, %edx	# 3557	[c=4 l=2]  *movsi_internal/0
+	call	log_append@PLT	# 3562	[c=0 l=5]  *call
+.L1377:
+	movq	832(%r13), %r8	# 3564	[c=9 l=7]  *movdi_internal/3
+	movl	%ebx, %ecx	# 3565	[c=4 l=2]  *movsi_internal/0
+	movl	$1, %esi	# 3568	[c=4 l=5]  *movsi_internal/0
+	xorl	%eax, %eax	# 20214	[c=4 l=2]  *movdi_xor
+	leaq	.LC40(%rip), %rdx	# 3566	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 3569	[c=4 l=3]  *movdi_internal/3
+	call	leave	# 3571	[c=0 l=5]  *call
+.L1608:
+	movb	$1, 11032(%r13)	# 651	[c=4 l=8]  *movqi_internal/8
+	movzbl	11037(%r13), %esi	# 652	[c=13 l=8]  *zero_extendqisi2/0
+	movq	%r13, %rdi	# 654	[c=4 l=3]  *movdi_internal/3
+	call	execute_lean@PLT	# 655	[c=0 l=5]  *call
+	movq	%r13, %rdi	# 656	[c=4 l=3]  *movdi_internal/3
+	call	perf_lean_resume@PLT	# 657	[c=0 l=5]  *call
+	jmp	.L335	# 20698	[c=1 l=5]  jump
+.L1607:
+	movq	%r13, %rdi	# 641	[c=4 l=3]  *movdi_internal/3
+	call	do_events	# 642	[c=0 l=5]  *call
+	jmp	.L334	# 20700	[c=1 l=5]  jump
+.L1500:
+	movl	%ebx, %ecx	# 213	[c=4 l=2]  *movsi_internal/0
+	leaq	.LC39(%rip), %rdx	# 214	[c=1 l=7]  *movdi_internal/4
+	movl	$1, %esi	# 216	[c=4 l=5]  *movsi_internal/0
+	xorl	%eax, %eax	# 20329	[c=4 l=2]  *movdi_xor
+	movq	%r13, %rdi	# 217	[c=4 l=3]  *movdi_internal/3
+	call	leave	# 219	[c=0 l=5]  *call
+.L347:
+	movl	$63, %esi	# 893	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 894	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 895	[c=10 l=5]  *call_value
+	movl	%eax, %r15d	# 896	[c=4 l=3]  *movsi_internal/0
+	jmp	.L348	# 20702	[c=1 l=5]  jump
+.L342:
+	movl	%r15d, %edx	# 790	[c=4 l=3]  *movsi_internal/0
+	movl	$63, %esi	# 791	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 792	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 793	[c=0 l=5]  *call
+	jmp	.L343	# 20704	[c=1 l=5]  jump
+.L339:
+	movl	$63, %esi	# 751	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 752	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 753	[c=10 l=5]  *call_value
+	movl	%eax, %r15d	# 754	[c=4 l=3]  *movsi_internal/0
+	jmp	.L340	# 20706	[c=1 l=5]  jump
+.L410:
+	movl	$63, %esi	# 1984	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 1985	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 1986	[c=10 l=5]  *call_value
+	movl	%eax, %r15d	# 1987	[c=4 l=3]  *movsi_internal/0
+	jmp	.L411	# 20708	[c=1 l=5]  jump
+.L357:
+	movl	%r14d, %edx	# 1073	[c=4 l=3]  *movsi_internal/0
+	movl	$63, %esi	# 1074	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 1075	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 1076	[c=0 l=5]  *call
+	jmp	.L358	# 20710	[c=1 l=5]  jump
+.L354:
+	movl	$63, %esi	# 1037	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 1038	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 1039	[c=10 l=5]  *call_value
+	movl	%eax, %r14d	# 1040	[c=4 l=3]  *movsi_internal/0
+	jmp	.L355	# 20712	[c=1 l=5]  jump
+.L350:
+	movl	%r14d, %edx	# 932	[c=4 l=3]  *movsi_internal/0
+	movl	$63, %esi	# 933	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 934	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 935	[c=0 l=5]  *call
+	jmp	.L351	# 20714	[c=1 l=5]  jump
+.L442:
+	movl	24(%rsp), %edx	# 2414	[c=9 l=4]  *movsi_internal/0
+	movl	%r9d, %esi	# 2415	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 2416	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 2417	[c=0 l=5]  *call
+	jmp	.L443	# 20716	[c=1 l=5]  jump
+.L438:
+	movl	%r14d, %edx	# 2376	[c=4 l=3]  *movsi_internal/0
+	movl	%r15d, %esi	# 2377	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 2378	[c=4 l=3]  *movdi_internal/3
+	movl	%r9d, 24(%rsp)	# 18197	[c=4 l=5]  *movsi_internal/1
+	call	data_write_page	# 2379	[c=0 l=5]  *call
+	movl	24(%rsp), %r9d	# 18198	[c=9 l=5]  *movsi_internal/0
+	jmp	.L439	# 20718	[c=1 l=5]  jump
+.L427:
+	movl	%r14d, %edx	# 2231	[c=4 l=3]  *movsi_internal/0
+	movl	$63, %esi	# 2232	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 2233	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 2234	[c=0 l=5]  *call
+	jmp	.L428	# 20720	[c=1 l=5]  jump
+.L424:
+	movl	$63, %esi	# 2195	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 2196	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 2197	[c=10 l=5]  *call_value
+	movl	%eax, %r14d	# 2198	[c=4 l=3]  *movsi_internal/0
+	jmp	.L425	# 20722	[c=1 l=5]  jump
+.L420:
+	movl	%r14d, %edx	# 2122	[c=4 l=3]  *movsi_internal/0
+	movl	$63, %esi	# 2123	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 2124	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 2125	[c=0 l=5]  *call
+	jmp	.L421	# 20724	[c=1 l=5]  jump
+.L417:
+	movl	$63, %esi	# 2087	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 2088	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 2089	[c=10 l=5]  *call_value
+	movl	%eax, %r15d	# 2090	[c=4 l=3]  *movsi_internal/0
+	jmp	.L418	# 20726	[c=1 l=5]  jump
+.L565:
+	movl	$63, %esi	# 4407	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 4408	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 4409	[c=10 l=5]  *call_value
+	movl	%eax, %r14d	# 4410	[c=4 l=3]  *movsi_internal/0
+	jmp	.L566	# 20728	[c=1 l=5]  jump
+.L561:
+	movl	%r14d, %edx	# 4318	[c=4 l=3]  *movsi_internal/0
+	movl	$59, %esi	# 4319	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 4320	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 4321	[c=0 l=5]  *call
+	jmp	.L562	# 20730	[c=1 l=5]  jump
+.L472:
+	movl	%r14d, %edx	# 2787	[c=4 l=3]  *movsi_internal/0
+	movl	$63, %esi	# 2788	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 2789	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 2790	[c=0 l=5]  *call
+	jmp	.L473	# 20732	[c=1 l=5]  jump
+.L469:
+	movl	$63, %esi	# 2751	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 2752	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 2753	[c=10 l=5]  *call_value
+	movl	%eax, %r14d	# 2754	[c=4 l=3]  *movsi_internal/0
+	jmp	.L470	# 20734	[c=1 l=5]  jump
+.L465:
+	movl	%r15d, %edx	# 2668	[c=4 l=3]  *movsi_internal/0
+	movl	%r14d, %esi	# 2669	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 2670	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 2671	[c=0 l=5]  *call
+	jmp	.L466	# 20736	[c=1 l=5]  jump
+.L458:
+	movl	%r14d, %esi	# 2610	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 2611	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 2612	[c=10 l=5]  *call_value
+	movl	%eax, %ecx	# 2613	[c=4 l=2]  *movsi_internal/0
+	jmp	.L459	# 20738	[c=1 l=5]  jump
+.L506:
+	movl	%r14d, %edx	# 3480	[c=4 l=3]  *movsi_internal/0
+	movl	$63, %esi	# 3481	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 3482	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 3483	[c=0 l=5]  *call
+	jmp	.L507	# 20740	[c=1 l=5]  jump
+.L503:
+	movl	$63, %esi	# 3441	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 3442	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 3443	[c=10 l=5]  *call_value
+	movl	%eax, %r14d	# 3444	[c=4 l=3]  *movsi_internal/0
+	jmp	.L504	# 20742	[c=1 l=5]  jump
+.L491:
+	movl	%r15d, %edx	# 3176	[c=4 l=3]  *movsi_internal/0
+	movl	$63, %esi	# 3177	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 3178	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 3179	[c=0 l=5]  *call
+	jmp	.L492	# 20744	[c=1 l=5]  jump
+.L488:
+	movl	$63, %esi	# 3137	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 3138	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 3139	[c=10 l=5]  *call_value
+	movl	%eax, %r15d	# 3140	[c=4 l=3]  *movsi_internal/0
+	jmp	.L489	# 20746	[c=1 l=5]  jump
+.L484:
+	movl	%r15d, %edx	# 3050	[c=4 l=3]  *movsi_internal/0
+	movl	$63, %esi	# 3051	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 3052	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 3053	[c=0 l=5]  *call
+	jmp	.L485	# 20748	[c=1 l=5]  jump
+.L1508:
+	movl	$63, %esi	# 3014	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 3015	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 3016	[c=10 l=5]  *call_value
+	movl	%eax, %r15d	# 3017	[c=4 l=3]  *movsi_internal/0
+	jmp	.L482	# 20750	[c=1 l=5]  jump
+.L479:
+	movl	%r15d, %edx	# 2918	[c=4 l=3]  *movsi_internal/0
+	movl	$63, %esi	# 2919	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 2920	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 2921	[c=0 l=5]  *call
+	jmp	.L480	# 20752	[c=1 l=5]  jump
+.L476:
+	movl	$63, %esi	# 2879	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 2880	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 2881	[c=10 l=5]  *call_value
+	movl	%eax, %r15d	# 2882	[c=4 l=3]  *movsi_internal/0
+	jmp	.L477	# 20754	[c=1 l=5]  jump
+.L822:
+	movl	16(%rsp), %edx	# 8753	[c=9 l=4]  *movsi_internal/0
+	movl	%r14d, %esi	# 8754	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 8755	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 8756	[c=0 l=5]  *call
+	jmp	.L823	# 20756	[c=1 l=5]  jump
+.L810:
+	movl	%r15d, %esi	# 8583	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 8584	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 8585	[c=10 l=5]  *call_value
+	movl	%eax, %r14d	# 8586	[c=4 l=3]  *movsi_internal/0
+	jmp	.L811	# 20758	[c=1 l=5]  jump
+.L797:
+	movl	16(%rsp), %edx	# 8412	[c=9 l=4]  *movsi_internal/0
+	movl	%r15d, %esi	# 8413	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 8414	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 8415	[c=0 l=5]  *call
+	jmp	.L798	# 20760	[c=1 l=5]  jump
+.L792:
+	movl	%r15d, %edx	# 8329	[c=4 l=3]  *movsi_internal/0
+	movl	$63, %esi	# 8330	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 8331	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 8332	[c=0 l=5]  *call
+	jmp	.L793	# 20762	[c=1 l=5]  jump
+.L789:
+	movl	$63, %esi	# 8290	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 8291	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 8292	[c=10 l=5]  *call_value
+	movl	%eax, %r15d	# 8293	[c=4 l=3]  *movsi_internal/0
+	jmp	.L790	# 20764	[c=1 l=5]  jump
+.L841:
+	movl	16(%rsp), %edx	# 8988	[c=9 l=4]  *movsi_internal/0
+	movl	%r9d, %esi	# 8989	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 8990	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 8991	[c=0 l=5]  *call
+	jmp	.L842	# 20766	[c=1 l=5]  jump
+.L1040:
+	movl	16(%rsp), %edx	# 11923	[c=9 l=4]  *movsi_internal/0
+	movl	%r15d, %esi	# 11924	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 11925	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 11926	[c=0 l=5]  *call
+	jmp	.L1041	# 20768	[c=1 l=5]  jump
+.L600:
+	movl	%r15d, %edx	# 4980	[c=4 l=3]  *movsi_internal/0
+	movl	$63, %esi	# 4981	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 4982	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 4983	[c=0 l=5]  *call
+	jmp	.L601	# 20770	[c=1 l=5]  jump
+.L597:
+	movl	$63, %esi	# 4944	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 4945	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 4946	[c=10 l=5]  *call_value
+	jmp	.L598	# 20772	[c=1 l=5]  jump
+.L642:
+	movl	%edx, %esi	# 5585	[c=4 l=2]  *movsi_internal/0
+	movq	%r13, %rdi	# 5586	[c=4 l=3]  *movdi_internal/3
+	movl	%edx, 8(%rsp)	# 18311	[c=4 l=4]  *movsi_internal/1
+	call	data_read_page	# 5587	[c=10 l=5]  *call_value
+	movl	8(%rsp), %edx	# 18312	[c=9 l=4]  *movsi_internal/0
+	movl	%eax, %r14d	# 5588	[c=4 l=3]  *movsi_internal/0
+	jmp	.L643	# 20774	[c=1 l=5]  jump
+.L870:
+	movl	%r8d, %esi	# 9313	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 9314	[c=4 l=3]  *movdi_internal/3
+	movl	%r8d, 8(%rsp)	# 18448	[c=4 l=5]  *movsi_internal/1
+	call	data_read_page	# 9315	[c=10 l=5]  *call_value
+	movl	8(%rsp), %r8d	# 18449	[c=9 l=5]  *movsi_internal/0
+	movl	%eax, %r15d	# 9316	[c=4 l=3]  *movsi_internal/0
+	jmp	.L871	# 20776	[c=1 l=5]  jump
+.L866:
+	movl	%edx, %esi	# 9276	[c=4 l=2]  *movsi_internal/0
+	movq	%r13, %rdi	# 9277	[c=4 l=3]  *movdi_internal/3
+	movl	%r8d, 16(%rsp)	# 18444	[c=4 l=5]  *movsi_internal/1
+	movl	%edx, 8(%rsp)	# 18442	[c=4 l=4]  *movsi_internal/1
+	call	data_read_page	# 9278	[c=10 l=5]  *call_value
+	movl	16(%rsp), %r8d	# 18445	[c=9 l=5]  *movsi_internal/0
+	movl	8(%rsp), %edx	# 18443	[c=9 l=4]  *movsi_internal/0
+	movl	%eax, %r14d	# 9279	[c=4 l=3]  *movsi_internal/0
+	jmp	.L867	# 20778	[c=1 l=5]  jump
+.L535:
+	movl	$60, %esi	# 3841	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 3842	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 3843	[c=10 l=5]  *call_value
+	movl	%eax, %r15d	# 3844	[c=4 l=3]  *movsi_internal/0
+	jmp	.L536	# 20780	[c=1 l=5]  jump
+.L361:
+	movl	$63, %esi	# 1179	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 1180	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 1181	[c=10 l=5]  *call_value
+	movl	%eax, %r14d	# 1182	[c=4 l=3]  *movsi_internal/0
+	jmp	.L362	# 20782	[c=1 l=5]  jump
+.L837:
+	movl	%r14d, %edx	# 8950	[c=4 l=3]  *movsi_internal/0
+	movl	%r15d, %esi	# 8951	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 8952	[c=4 l=3]  *movdi_internal/3
+	movl	%r9d, 16(%rsp)	# 18434	[c=4 l=5]  *movsi_internal/1
+	call	data_write_page	# 8953	[c=0 l=5]  *call
+	movl	16(%rsp), %r9d	# 18435	[c=9 l=5]  *movsi_internal/0
+	jmp	.L838	# 20784	[c=1 l=5]  jump
+.L1133:
+	movl	%r14d, %edx	# 13554	[c=4 l=3]  *movsi_internal/0
+	movl	$63, %esi	# 13555	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 13556	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 13557	[c=0 l=5]  *call
+	jmp	.L1134	# 20786	[c=1 l=5]  jump
+.L1130:
+	movl	$63, %esi	# 13515	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 13516	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 13517	[c=10 l=5]  *call_value
+	movl	%eax, %r14d	# 13518	[c=4 l=3]  *movsi_internal/0
+	jmp	.L1131	# 20788	[c=1 l=5]  jump
+.L1126:
+	movl	%r15d, %edx	# 13448	[c=4 l=3]  *movsi_internal/0
+	movl	$63, %esi	# 13449	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 13450	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 13451	[c=0 l=5]  *call
+	jmp	.L1127	# 20790	[c=1 l=5]  jump
+.L1123:
+	movl	$63, %esi	# 13409	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 13410	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 13411	[c=10 l=5]  *call_value
+	movl	%eax, %r15d	# 13412	[c=4 l=3]  *movsi_internal/0
+	jmp	.L1124	# 20792	[c=1 l=5]  jump
+.L1119:
+	movl	%r15d, %edx	# 13320	[c=4 l=3]  *movsi_internal/0
+	movl	$63, %esi	# 13321	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 13322	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 13323	[c=0 l=5]  *call
+	jmp	.L1120	# 20794	[c=1 l=5]  jump
+.L1116:
+	movl	$63, %esi	# 13281	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 13282	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 13283	[c=10 l=5]  *call_value
+	movl	%eax, %r15d	# 13284	[c=4 l=3]  *movsi_internal/0
+	jmp	.L1117	# 20796	[c=1 l=5]  jump
+.L1112:
+	movl	%r14d, %edx	# 13197	[c=4 l=3]  *movsi_internal/0
+	movl	$63, %esi	# 13198	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 13199	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 13200	[c=0 l=5]  *call
+	jmp	.L1113	# 20798	[c=1 l=5]  jump
+.L1109:
+	movl	$63, %esi	# 13160	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 13161	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 13162	[c=10 l=5]  *call_value
+	movl	%eax, %r15d	# 13163	[c=4 l=3]  *movsi_internal/0
+	jmp	.L1110	# 20800	[c=1 l=5]  jump
+.L1103:
+	movl	%r14d, %edx	# 13004	[c=4 l=3]  *movsi_internal/0
+	movl	$63, %esi	# 13005	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 13006	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 13007	[c=0 l=5]  *call
+	jmp	.L1104	# 20802	[c=1 l=5]  jump
+.L1100:
+	movl	$63, %esi	# 12965	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 12966	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 12967	[c=10 l=5]  *call_value
+	movl	%eax, %r14d	# 12968	[c=4 l=3]  *movsi_internal/0
+	jmp	.L1101	# 20804	[c=1 l=5]  jump
+.L1096:
+	movl	%r14d, %edx	# 12868	[c=4 l=3]  *movsi_internal/0
+	movl	$63, %esi	# 12869	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 12870	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 12871	[c=0 l=5]  *call
+	jmp	.L1097	# 20806	[c=1 l=5]  jump
+.L1093:
+	movl	$63, %esi	# 12829	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 12830	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 12831	[c=10 l=5]  *call_value
+	movl	%eax, %r14d	# 12832	[c=4 l=3]  *movsi_internal/0
+	jmp	.L1094	# 20808	[c=1 l=5]  jump
+.L777:
+	movl	%r15d, %edx	# 8043	[c=4 l=3]  *movsi_internal/0
+	movl	$63, %esi	# 8044	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 8045	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 8046	[c=0 l=5]  *call
+	jmp	.L778	# 20810	[c=1 l=5]  jump
+.L774:
+	movl	$63, %esi	# 8004	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 8005	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 8006	[c=10 l=5]  *call_value
+	movl	%eax, %r15d	# 8007	[c=4 l=3]  *movsi_internal/0
+	jmp	.L775	# 20812	[c=1 l=5]  jump
+.L770:
+	movl	%eax, %edx	# 7911	[c=4 l=2]  *movsi_internal/0
+	movl	$63, %esi	# 7912	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 7913	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 7914	[c=0 l=5]  *call
+	jmp	.L771	# 20814	[c=1 l=5]  jump
+.L767:
+	movl	$63, %esi	# 7875	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 7876	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 7877	[c=10 l=5]  *call_value
+	jmp	.L768	# 20816	[c=1 l=5]  jump
+.L970:
+	movl	%edx, %esi	# 10746	[c=4 l=2]  *movsi_internal/0
+	movq	%r13, %rdi	# 10747	[c=4 l=3]  *movdi_internal/3
+	movl	%edx, 8(%rsp)	# 18505	[c=4 l=4]  *movsi_internal/1
+	call	data_read_page	# 10748	[c=10 l=5]  *call_value
+	movl	8(%rsp), %edx	# 18506	[c=9 l=4]  *movsi_internal/0
+	movl	%eax, %r15d	# 10749	[c=4 l=3]  *movsi_internal/0
+	jmp	.L971	# 20818	[c=1 l=5]  jump
+.L962:
+	movl	%edx, %esi	# 10639	[c=4 l=2]  *movsi_internal/0
+	movq	%r13, %rdi	# 10640	[c=4 l=3]  *movdi_internal/3
+	movl	%edx, 8(%rsp)	# 18503	[c=4 l=4]  *movsi_internal/1
+	call	data_read_page	# 10641	[c=10 l=5]  *call_value
+	movl	8(%rsp), %edx	# 18504	[c=9 l=4]  *movsi_internal/0
+	movl	%eax, %r15d	# 10642	[c=4 l=3]  *movsi_internal/0
+	jmp	.L963	# 20820	[c=1 l=5]  jump
+.L954:
+	movl	%edx, %esi	# 10532	[c=4 l=2]  *movsi_internal/0
+	movq	%r13, %rdi	# 10533	[c=4 l=3]  *movdi_internal/3
+	movl	%edx, 8(%rsp)	# 18501	[c=4 l=4]  *movsi_internal/1
+	call	data_read_page	# 10534	[c=10 l=5]  *call_value
+	movl	8(%rsp), %edx	# 18502	[c=9 l=4]  *movsi_internal/0
+	movl	%eax, %r15d	# 10535	[c=4 l=3]  *movsi_internal/0
+	jmp	.L955	# 20822	[c=1 l=5]  jump
+.L946:
+	movl	%edx, %esi	# 10425	[c=4 l=2]  *movsi_internal/0
+	movq	%r13, %rdi	# 10426	[c=4 l=3]  *movdi_internal/3
+	movl	%edx, 8(%rsp)	# 18499	[c=4 l=4]  *movsi_internal/1
+	call	data_read_page	# 10427	[c=10 l=5]  *call_value
+	movl	8(%rsp), %edx	# 18500	[c=9 l=4]  *movsi_internal/0
+	movl	%eax, %r15d	# 10428	[c=4 l=3]  *movsi_internal/0
+	jmp	.L947	# 20824	[c=1 l=5]  jump
+.L687:
+	movl	%edx, %esi	# 6291	[c=4 l=2]  *movsi_internal/0
+	movq	%r13, %rdi	# 6292	[c=4 l=3]  *movdi_internal/3
+	movl	%edx, 8(%rsp)	# 18345	[c=4 l=4]  *movsi_internal/1
+	call	data_read_page	# 6293	[c=10 l=5]  *call_value
+	movl	8(%rsp), %edx	# 18346	[c=9 l=4]  *movsi_internal/0
+	movl	%eax, %r14d	# 6294	[c=4 l=3]  *movsi_internal/0
+	jmp	.L688	# 20826	[c=1 l=5]  jump
+.L650:
+	movl	%r14d, %edx	# 5724	[c=4 l=3]  *movsi_internal/0
+	movl	$63, %esi	# 5725	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 5726	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 5727	[c=0 l=5]  *call
+	jmp	.L651	# 20828	[c=1 l=5]  jump
+.L647:
+	movl	$63, %esi	# 5685	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 5686	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 5687	[c=10 l=5]  *call_value
+	movl	%eax, %r14d	# 5688	[c=4 l=3]  *movsi_internal/0
+	jmp	.L648	# 20830	[c=1 l=5]  jump
+.L396:
+	movl	$63, %esi	# 1744	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 1745	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 1746	[c=10 l=5]  *call_value
+	movl	%eax, %r8d	# 1747	[c=4 l=3]  *movsi_internal/0
+	jmp	.L397	# 20832	[c=1 l=5]  jump
+.L392:
+	movl	%r14d, %edx	# 1675	[c=4 l=3]  *movsi_internal/0
+	movl	$63, %esi	# 1676	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 1677	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 1678	[c=0 l=5]  *call
+	jmp	.L393	# 20834	[c=1 l=5]  jump
+.L921:
+	movl	%r14d, %edx	# 9965	[c=4 l=3]  *movsi_internal/0
+	movl	$63, %esi	# 9966	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 9967	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 9968	[c=0 l=5]  *call
+	jmp	.L922	# 20836	[c=1 l=5]  jump
+.L918:
+	movl	$63, %esi	# 9926	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 9927	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 9928	[c=10 l=5]  *call_value
+	movl	%eax, %r14d	# 9929	[c=4 l=3]  *movsi_internal/0
+	jmp	.L919	# 20838	[c=1 l=5]  jump
+.L785:
+	movl	%r14d, %edx	# 8205	[c=4 l=3]  *movsi_internal/0
+	movl	$63, %esi	# 8206	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 8207	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 8208	[c=0 l=5]  *call
+	jmp	.L786	# 20840	[c=1 l=5]  jump
+.L782:
+	movl	$63, %esi	# 8166	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 8167	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 8168	[c=10 l=5]  *call_value
+	movl	%eax, %r14d	# 8169	[c=4 l=3]  *movsi_internal/0
+	jmp	.L783	# 20842	[c=1 l=5]  jump
+.L389:
+	movl	$63, %esi	# 1639	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 1640	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 1641	[c=10 l=5]  *call_value
+	movl	%eax, %r15d	# 1642	[c=4 l=3]  *movsi_internal/0
+	jmp	.L390	# 20844	[c=1 l=5]  jump
+.L385:
+	movl	%r14d, %edx	# 1583	[c=4 l=3]  *movsi_internal/0
+	movl	$63, %esi	# 1584	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 1585	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 1586	[c=0 l=5]  *call
+	jmp	.L386	# 20846	[c=1 l=5]  jump
+.L382:
+	movl	$63, %esi	# 1544	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 1545	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 1546	[c=10 l=5]  *call_value
+	movl	%eax, %r14d	# 1547	[c=4 l=3]  *movsi_internal/0
+	jmp	.L383	# 20848	[c=1 l=5]  jump
+.L378:
+	movl	%r15d, %edx	# 1466	[c=4 l=3]  *movsi_internal/0
+	movl	$63, %esi	# 1467	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 1468	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 1469	[c=0 l=5]  *call
+	jmp	.L379	# 20850	[c=1 l=5]  jump
+.L375:
+	movl	$63, %esi	# 1427	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 1428	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 1429	[c=10 l=5]  *call_value
+	movl	%eax, %r15d	# 1430	[c=4 l=3]  *movsi_internal/0
+	jmp	.L376	# 20852	[c=1 l=5]  jump
+.L371:
+	movl	%r14d, %edx	# 1343	[c=4 l=3]  *movsi_internal/0
+	movl	$63, %esi	# 1344	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 1345	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 1346	[c=0 l=5]  *call
+	jmp	.L372	# 20854	[c=1 l=5]  jump
+.L368:
+	movl	$63, %esi	# 1304	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 1305	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 1306	[c=10 l=5]  *call_value
+	movl	%eax, %r14d	# 1307	[c=4 l=3]  *movsi_internal/0
+	jmp	.L369	# 20856	[c=1 l=5]  jump
+.L364:
+	movl	%r14d, %edx	# 1215	[c=4 l=3]  *movsi_internal/0
+	movl	$63, %esi	# 1216	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 1217	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 1218	[c=0 l=5]  *call
+	jmp	.L365	# 20858	[c=1 l=5]  jump
+.L558:
+	movl	$59, %esi	# 4254	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 4255	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 4256	[c=10 l=5]  *call_value
+	jmp	.L559	# 20860	[c=1 l=5]  jump
+.L554:
+	movl	$59, %esi	# 4165	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 4166	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 4167	[c=10 l=5]  *call_value
+	jmp	.L555	# 20862	[c=1 l=5]  jump
+.L550:
+	movl	$59, %esi	# 4077	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 4078	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 4079	[c=10 l=5]  *call_value
+	movl	%eax, %r15d	# 4080	[c=4 l=3]  *movsi_internal/0
+	jmp	.L551	# 20864	[c=1 l=5]  jump
+.L543:
+	movl	$60, %esi	# 3973	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 3974	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 3975	[c=10 l=5]  *call_value
+	movl	%eax, %r15d	# 3976	[c=4 l=3]  *movsi_internal/0
+	jmp	.L544	# 20866	[c=1 l=5]  jump
+.L763:
+	movl	%eax, %edx	# 7779	[c=4 l=2]  *movsi_internal/0
+	movl	$63, %esi	# 7780	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 7781	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 7782	[c=0 l=5]  *call
+	jmp	.L764	# 20868	[c=1 l=5]  jump
+.L760:
+	movl	$63, %esi	# 7743	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 7744	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 7745	[c=10 l=5]  *call_value
+	jmp	.L761	# 20870	[c=1 l=5]  jump
+.L756:
+	movl	%r15d, %edx	# 7647	[c=4 l=3]  *movsi_internal/0
+	movl	$63, %esi	# 7648	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 7649	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 7650	[c=0 l=5]  *call
+	jmp	.L757	# 20872	[c=1 l=5]  jump
+.L753:
+	movl	$63, %esi	# 7611	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 7612	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 7613	[c=10 l=5]  *call_value
+	jmp	.L754	# 20874	[c=1 l=5]  jump
+.L747:
+	movl	%r14d, %edx	# 7404	[c=4 l=3]  *movsi_internal/0
+	movl	$63, %esi	# 7405	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 7406	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 7407	[c=0 l=5]  *call
+	jmp	.L748	# 20876	[c=1 l=5]  jump
+.L744:
+	movl	$63, %esi	# 7365	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 7366	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 7367	[c=10 l=5]  *call_value
+	movl	%eax, %r14d	# 7368	[c=4 l=3]  *movsi_internal/0
+	jmp	.L745	# 20878	[c=1 l=5]  jump
+.L403:
+	movl	$63, %esi	# 1880	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 1881	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 1882	[c=10 l=5]  *call_value
+	movl	%eax, %r15d	# 1883	[c=4 l=3]  *movsi_internal/0
+	jmp	.L404	# 20880	[c=1 l=5]  jump
+.L568:
+	movl	%r14d, %edx	# 4446	[c=4 l=3]  *movsi_internal/0
+	movl	$63, %esi	# 4447	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 4448	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 4449	[c=0 l=5]  *call
+	jmp	.L569	# 20882	[c=1 l=5]  jump
+.L523:
+	movl	8(%rsp), %edx	# 3714	[c=9 l=4]  *movsi_internal/0
+	movl	%r9d, %esi	# 3715	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 3716	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 3717	[c=0 l=5]  *call
+	jmp	.L524	# 20884	[c=1 l=5]  jump
+.L519:
+	movl	%r14d, %edx	# 3676	[c=4 l=3]  *movsi_internal/0
+	movl	%r15d, %esi	# 3677	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 3678	[c=4 l=3]  *movdi_internal/3
+	movl	%r9d, 8(%rsp)	# 18236	[c=4 l=5]  *movsi_internal/1
+	call	data_write_page	# 3679	[c=0 l=5]  *call
+	movl	8(%rsp), %r9d	# 18237	[c=9 l=5]  *movsi_internal/0
+	jmp	.L520	# 20886	[c=1 l=5]  jump
+.L622:
+	movl	8(%rsp), %edx	# 5304	[c=9 l=4]  *movsi_internal/0
+	movl	%r9d, %esi	# 5305	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 5306	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 5307	[c=0 l=5]  *call
+	jmp	.L623	# 20888	[c=1 l=5]  jump
+.L618:
+	movl	%r14d, %edx	# 5266	[c=4 l=3]  *movsi_internal/0
+	movl	%r15d, %esi	# 5267	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 5268	[c=4 l=3]  *movdi_internal/3
+	movl	%r9d, 8(%rsp)	# 18305	[c=4 l=5]  *movsi_internal/1
+	call	data_write_page	# 5269	[c=0 l=5]  *call
+	movl	8(%rsp), %r9d	# 18306	[c=9 l=5]  *movsi_internal/0
+	jmp	.L619	# 20890	[c=1 l=5]  jump
+.L607:
+	movl	%r15d, %edx	# 5114	[c=4 l=3]  *movsi_internal/0
+	movl	$63, %esi	# 5115	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 5116	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 5117	[c=0 l=5]  *call
+	jmp	.L608	# 20892	[c=1 l=5]  jump
+.L604:
+	movl	$63, %esi	# 5078	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 5079	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 5080	[c=10 l=5]  *call_value
+	jmp	.L605	# 20894	[c=1 l=5]  jump
+.L593:
+	movl	%r15d, %edx	# 4846	[c=4 l=3]  *movsi_internal/0
+	movl	$63, %esi	# 4847	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 4848	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 4849	[c=0 l=5]  *call
+	jmp	.L594	# 20896	[c=1 l=5]  jump
+.L590:
+	movl	$63, %esi	# 4810	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 4811	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 4812	[c=10 l=5]  *call_value
+	jmp	.L591	# 20898	[c=1 l=5]  jump
+.L896:
+	movl	%r8d, %esi	# 9607	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 9608	[c=4 l=3]  *movdi_internal/3
+	movl	%r8d, 8(%rsp)	# 18462	[c=4 l=5]  *movsi_internal/1
+	call	data_read_page	# 9609	[c=10 l=5]  *call_value
+	movl	8(%rsp), %r8d	# 18463	[c=9 l=5]  *movsi_internal/0
+	movl	%eax, %r15d	# 9610	[c=4 l=3]  *movsi_internal/0
+	jmp	.L897	# 20900	[c=1 l=5]  jump
+.L892:
+	movl	%edx, %esi	# 9570	[c=4 l=2]  *movsi_internal/0
+	movq	%r13, %rdi	# 9571	[c=4 l=3]  *movdi_internal/3
+	movl	%r8d, 16(%rsp)	# 18458	[c=4 l=5]  *movsi_internal/1
+	movl	%edx, 8(%rsp)	# 18456	[c=4 l=4]  *movsi_internal/1
+	call	data_read_page	# 9572	[c=10 l=5]  *call_value
+	movl	16(%rsp), %r8d	# 18459	[c=9 l=5]  *movsi_internal/0
+	movl	8(%rsp), %edx	# 18457	[c=9 l=4]  *movsi_internal/0
+	movl	%eax, %r14d	# 9573	[c=4 l=3]  *movsi_internal/0
+	jmp	.L893	# 20902	[c=1 l=5]  jump
+.L908:
+	movl	%r14d, %edx	# 9741	[c=4 l=3]  *movsi_internal/0
+	movl	$63, %esi	# 9742	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 9743	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 9744	[c=0 l=5]  *call
+	jmp	.L909	# 20904	[c=1 l=5]  jump
+.L905:
+	movl	$63, %esi	# 9704	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 9705	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 9706	[c=10 l=5]  *call_value
+	movl	%eax, %r15d	# 9707	[c=4 l=3]  *movsi_internal/0
+	jmp	.L906	# 20906	[c=1 l=5]  jump
+.L942:
+	movl	%r14d, %edx	# 10364	[c=4 l=3]  *movsi_internal/0
+	movl	%r15d, %esi	# 10365	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 10366	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 10367	[c=0 l=5]  *call
+	jmp	.L943	# 20908	[c=1 l=5]  jump
+.L935:
+	movl	%r15d, %esi	# 10307	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 10308	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 10309	[c=10 l=5]  *call_value
+	jmp	.L936	# 20910	[c=1 l=5]  jump
+.L931:
+	movl	%r14d, %edx	# 10246	[c=4 l=3]  *movsi_internal/0
+	movl	$63, %esi	# 10247	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 10248	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 10249	[c=0 l=5]  *call
+	jmp	.L932	# 20912	[c=1 l=5]  jump
+.L1594:
+	movl	$63, %esi	# 10210	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 10211	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 10212	[c=10 l=5]  *call_value
+	movl	%eax, %ecx	# 10213	[c=4 l=2]  *movsi_internal/0
+	jmp	.L929	# 20914	[c=1 l=5]  jump
+.L926:
+	movl	%r14d, %edx	# 10108	[c=4 l=3]  *movsi_internal/0
+	movl	$63, %esi	# 10109	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 10110	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 10111	[c=0 l=5]  *call
+	jmp	.L927	# 20916	[c=1 l=5]  jump
+.L1593:
+	movl	$63, %esi	# 10072	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 10073	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 10074	[c=10 l=5]  *call_value
+	movl	%eax, %ecx	# 10075	[c=4 l=2]  *movsi_internal/0
+	jmp	.L924	# 20918	[c=1 l=5]  jump
+.L1520:
+	movl	%r8d, %eax	# 15100	[c=1 l=3]  *zero_extendsidi2/3
+	movq	%rax, 32(%rsp)	# 17331	[c=4 l=5]  *movdi_internal/5
+	jmp	.L575	# 20920	[c=1 l=5]  jump
+.L1533:
+	movq	1040(%r13), %rax	# 6104	[c=9 l=7]  *movdi_internal/3
+	movl	$56, %edx	# 6107	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 6110	[c=4 l=3]  *movdi_internal/3
+	movl	%r8d, 16(%rsp)	# 18335	[c=4 l=5]  *movsi_internal/1
+	leaq	.LC25(%rip), %rsi	# 6108	[c=1 l=7]  *movdi_internal/4
+	movzbl	56(%rax), %r15d	# 6105	[c=13 l=5]  *zero_extendqisi2/0
+	movq	%rsi, 8(%rsp)	# 18333	[c=4 l=5]  *movdi_internal/5
+	movl	%r15d, %ecx	# 6106	[c=4 l=3]  *movsi_internal/0
+	sall	$16, %r15d	# 6112	[c=4 l=4]  *ashlsi3_1/0
+	call	log_add_data_mov@PLT	# 6111	[c=0 l=5]  *call
+	movl	16(%rsp), %edx	# 20137	[c=9 l=4]  *movsi_internal/0
+	movq	8(%rsp), %rsi	# 18334	[c=9 l=5]  *movdi_internal/3
+	orl	%r15d, %edx	# 6113	[c=4 l=3]  *iorsi_1/0
+	testl	%r15d, %r15d	# 6115	[c=4 l=3]  *cmpsi_ccno_1/0
+	movl	%edx, %eax	# 17432	[c=4 l=2]  *movsi_internal/0
+	jne	.L673	# 6116	[c=13 l=6]  *jcc
+	subl	5176(%r13), %eax	# 6118	[c=13 l=7]  *subsi_1/1
+	cmpl	5180(%r13), %eax	# 6119	[c=13 l=7]  *cmpsi_1/1
+	jb	.L674	# 6120	[c=13 l=2]  *jcc
+	movl	%edx, %eax	# 17434	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %eax	# 6122	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 16882	[c=5 l=5]  *andsi_1_zext
+	cmpb	$0, 1080(%r13,%rax)	# 6125	[c=14 l=9]  *cmpqi_ccno_1/1
+	jne	.L675	# 6126	[c=13 l=6]  *jcc
+.L674:
+	movq	1040(%r13), %rcx	# 6130	[c=9 l=7]  *movdi_internal/3
+	movslq	%edx, %rax	# 6129	[c=4 l=3]  *extendsidi2_rex64/1
+	movzbl	(%rcx,%rax), %r15d	# 6131	[c=13 l=5]  *zero_extendqisi2/0
+.L676:
+	cmpl	$63, %edx	# 15442	[c=4 l=3]  *cmpsi_1/0
+	leaq	.LC25(%rip), %rax	# 16947	[c=1 l=7]  *movdi_internal/4
+	movl	%r15d, %ecx	# 6147	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 6150	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC33(%rip), %rsi	# 16946	[c=1 l=7]  *movdi_internal/4
+	cmovne	%rax, %rsi	# 15443	[c=8 l=4]  *movdicc_noc/1
+	call	log_add_data_mov@PLT	# 6151	[c=0 l=5]  *call
+	jmp	.L1375	# 20922	[c=1 l=5]  jump
+.L1558:
+	movl	%r15d, %eax	# 15107	[c=1 l=3]  *zero_extendsidi2/3
+	movq	%rax, 16(%rsp)	# 17837	[c=4 l=5]  *movdi_internal/5
+	jmp	.L1003	# 20924	[c=1 l=5]  jump
+.L577:
+	subl	$2, %r8d	# 4570	[c=4 l=4]  *addsi_1/0
+	movq	24(%rsp), %rdi	# 17332	[c=9 l=5]  *movdi_internal/3
+	xorl	%edx, %edx	# 20190	[c=4 l=2]  *movdi_xor
+	leaq	.LC35(%rip), %rsi	# 4577	[c=1 l=7]  *movdi_internal/4
+	andl	%r14d, %r8d	# 4571	[c=4 l=3]  *andsi_1/0
+	movzbl	1004(%r13), %ecx	# 4574	[c=13 l=8]  *zero_extendqisi2/0
+	movl	%r8d, %eax	# 4572	[c=1 l=3]  *zero_extendsidi2/3
+	movl	%r8d, 8(%rsp)	# 18265	[c=4 l=5]  *movsi_internal/1
+	leaq	(%rdi,%rax), %r15	# 18854	[c=4 l=4]  *leadi
+	movq	%r13, %rdi	# 4579	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 20191	[c=4 l=2]  *movdi_xor
+	call	log_append@PLT	# 4581	[c=0 l=5]  *call
+	movl	8(%rsp), %r8d	# 18266	[c=9 l=5]  *movsi_internal/0
+	movq	24(%rsp), %rdi	# 17333	[c=9 l=5]  *movdi_internal/3
+	movl	$1, %edx	# 4589	[c=4 l=5]  *movsi_internal/0
+	movzbl	1004(%r13), %eax	# 4582	[c=9 l=8]  *movqi_internal/4
+	leaq	.LC35(%rip), %rsi	# 18263	[c=1 l=7]  *movdi_internal/4
+	movb	%al, (%r15)	# 4583	[c=4 l=3]  *movqi_internal/8
+	leal	1(%r8), %eax	# 4585	[c=5 l=4]  *leadi
+	movzbl	1005(%r13), %ecx	# 4587	[c=13 l=8]  *zero_extendqisi2/0
+	leaq	(%rdi,%rax), %r15	# 18855	[c=4 l=4]  *leadi
+	xorl	%eax, %eax	# 20192	[c=4 l=2]  *movdi_xor
+	movq	%r13, %rdi	# 4592	[c=4 l=3]  *movdi_internal/3
+	call	log_append@PLT	# 4594	[c=0 l=5]  *call
+	movzbl	1005(%r13), %eax	# 4595	[c=9 l=8]  *movqi_internal/4
+	movb	%al, (%r15)	# 4596	[c=4 l=3]  *movqi_internal/8
+	jmp	.L579	# 20926	[c=1 l=5]  jump
+.L1005:
+	leal	-2(%r15), %edx	# 18761	[c=4 l=4]  *leasi
+	movl	8(%rsp), %r15d	# 17838	[c=9 l=5]  *movsi_internal/0
+	movq	24(%rsp), %rdi	# 17840	[c=9 l=5]  *movdi_internal/3
+	leaq	.LC35(%rip), %rsi	# 11357	[c=1 l=7]  *movdi_internal/4
+	movzbl	1004(%r13), %ecx	# 11354	[c=13 l=8]  *zero_extendqisi2/0
+	andl	%edx, %r15d	# 11351	[c=4 l=3]  *andsi_1/0
+	xorl	%edx, %edx	# 19987	[c=4 l=2]  *movdi_xor
+	movl	%r15d, %eax	# 11352	[c=1 l=3]  *zero_extendsidi2/3
+	leaq	(%rdi,%rax), %r14	# 18762	[c=4 l=4]  *leadi
+	movq	%r13, %rdi	# 11359	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 19988	[c=4 l=2]  *movdi_xor
+	call	log_append@PLT	# 11361	[c=0 l=5]  *call
+	movq	24(%rsp), %rdi	# 17841	[c=9 l=5]  *movdi_internal/3
+	movzbl	1004(%r13), %eax	# 11362	[c=9 l=8]  *movqi_internal/4
+	movl	$1, %edx	# 11369	[c=4 l=5]  *movsi_internal/0
+	leaq	.LC35(%rip), %rsi	# 18511	[c=1 l=7]  *movdi_internal/4
+	movb	%al, (%r14)	# 11363	[c=4 l=3]  *movqi_internal/8
+	leal	1(%r15), %r14d	# 11365	[c=5 l=4]  *leadi
+	movzbl	1005(%r13), %ecx	# 11367	[c=13 l=8]  *zero_extendqisi2/0
+	xorl	%eax, %eax	# 19989	[c=4 l=2]  *movdi_xor
+	addq	%rdi, %r14	# 11366	[c=4 l=3]  *adddi_1/0
+	movq	%r13, %rdi	# 11372	[c=4 l=3]  *movdi_internal/3
+	call	log_append@PLT	# 11374	[c=0 l=5]  *call
+	movzbl	1005(%r13), %eax	# 11375	[c=9 l=8]  *movqi_internal/4
+	movb	%al, (%r14)	# 11376	[c=4 l=3]  *movqi_internal/8
+	jmp	.L1007	# 20928	[c=1 l=5]  jump
+.L1586:
+	movl	$61, %esi	# 8465	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 8466	[c=4 l=3]  *movdi_internal/3
+	call	data_read_mapped	# 8467	[c=10 l=5]  *call_value
+	movl	%eax, %edx	# 8468	[c=4 l=2]  *movsi_internal/0
+	movl	$62, %eax	# 8469	[c=4 l=5]  *movsi_internal/0
+	subl	%r15d, %eax	# 8470	[c=4 l=3]  *subsi_1/0
+	cmpl	%r14d, %eax	# 8471	[c=4 l=3]  *cmpsi_1/0
+	jnb	.L803	# 8472	[c=13 l=6]  *jcc
+	movq	1040(%r13), %rax	# 15102	[c=9 l=7]  *movdi_internal/3
+	jmp	.L802	# 20930	[c=1 l=5]  jump
+.L1553:
+	movl	%r9d, %ecx	# 14408	[c=4 l=3]  *movsi_internal/0
+	movl	$63, %edx	# 14409	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 14412	[c=4 l=3]  *movdi_internal/3
+	movl	%r9d, 24(%rsp)	# 18664	[c=4 l=5]  *movsi_internal/1
+	leaq	.LC33(%rip), %rsi	# 14410	[c=1 l=7]  *movdi_internal/4
+	call	log_add_data_mov@PLT	# 14413	[c=0 l=5]  *call
+	movl	24(%rsp), %r9d	# 18665	[c=9 l=5]  *movsi_internal/0
+	movl	8(%rsp), %edx	# 14417	[c=9 l=4]  *movsi_internal/0
+	xorl	%eax, %eax	# 19881	[c=4 l=2]  *movdi_xor
+	leaq	.LC36(%rip), %rsi	# 14418	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 14420	[c=4 l=3]  *movdi_internal/3
+	movzbl	%r9b, %ecx	# 14415	[c=4 l=4]  *zero_extendqisi2/0
+	movb	%r9b, 32(%rsp)	# 18662	[c=4 l=5]  *movqi_internal/8
+	call	log_append@PLT	# 14422	[c=0 l=5]  *call
+	movl	16(%rsp), %eax	# 18105	[c=9 l=4]  *movsi_internal/0
+	movl	24(%rsp), %r9d	# 18661	[c=9 l=5]  *movsi_internal/0
+	leaq	.LC29(%rip), %rsi	# 129	[c=1 l=7]  *movdi_internal/4
+	movzbl	32(%rsp), %r11d	# 18663	[c=9 l=6]  *movqi_internal/4
+	orl	%r9d, %eax	# 14423	[c=4 l=3]  *iorsi_1/0
+	movl	%eax, 8(%rsp)	# 18659	[c=4 l=4]  *movsi_internal/1
+	movzbl	%al, %ecx	# 14424	[c=4 l=3]  *zero_extendqisi2/0
+	jmp	.L1184	# 20932	[c=1 l=5]  jump
+.L1555:
+	movl	%r9d, %ecx	# 14429	[c=4 l=3]  *movsi_internal/0
+	movl	$63, %edx	# 14430	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 14433	[c=4 l=3]  *movdi_internal/3
+	movl	%r9d, 24(%rsp)	# 18671	[c=4 l=5]  *movsi_internal/1
+	leaq	.LC33(%rip), %rsi	# 14431	[c=1 l=7]  *movdi_internal/4
+	call	log_add_data_mov@PLT	# 14434	[c=0 l=5]  *call
+	movl	24(%rsp), %r9d	# 18672	[c=9 l=5]  *movsi_internal/0
+	movl	8(%rsp), %edx	# 14438	[c=9 l=4]  *movsi_internal/0
+	xorl	%eax, %eax	# 19880	[c=4 l=2]  *movdi_xor
+	leaq	.LC36(%rip), %rsi	# 14439	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 14441	[c=4 l=3]  *movdi_internal/3
+	movzbl	%r9b, %ecx	# 14436	[c=4 l=4]  *zero_extendqisi2/0
+	movb	%r9b, 32(%rsp)	# 18669	[c=4 l=5]  *movqi_internal/8
+	call	log_append@PLT	# 14443	[c=0 l=5]  *call
+	movl	16(%rsp), %eax	# 18107	[c=9 l=4]  *movsi_internal/0
+	movl	24(%rsp), %r9d	# 18668	[c=9 l=5]  *movsi_internal/0
+	leaq	.LC29(%rip), %rsi	# 131	[c=1 l=7]  *movdi_internal/4
+	movzbl	32(%rsp), %r11d	# 18670	[c=9 l=6]  *movqi_internal/4
+	notl	%eax	# 14444	[c=4 l=2]  *one_cmplsi2_1/0
+	andl	%r9d, %eax	# 14445	[c=4 l=3]  *andsi_1/0
+	movl	%eax, 8(%rsp)	# 18666	[c=4 l=4]  *movsi_internal/1
+	movzbl	%al, %ecx	# 14446	[c=4 l=3]  *zero_extendqisi2/0
+	jmp	.L1185	# 20934	[c=1 l=5]  jump
+.L1524:
+	movl	$61, %esi	# 5175	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 5176	[c=4 l=3]  *movdi_internal/3
+	call	data_read_mapped	# 5177	[c=10 l=5]  *call_value
+	movl	%eax, %edx	# 5178	[c=4 l=2]  *movsi_internal/0
+	movl	$62, %eax	# 5179	[c=4 l=5]  *movsi_internal/0
+	subl	%r15d, %eax	# 5180	[c=4 l=3]  *subsi_1/0
+	cmpl	%r14d, %eax	# 5181	[c=4 l=3]  *cmpsi_1/0
+	jnb	.L613	# 5182	[c=13 l=6]  *jcc
+	movq	1040(%r13), %rax	# 15101	[c=9 l=7]  *movdi_internal/3
+	jmp	.L612	# 20936	[c=1 l=5]  jump
+.L682:
+	movl	%r8d, %esi	# 6207	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 6208	[c=4 l=3]  *movdi_internal/3
+	movl	%r8d, 8(%rsp)	# 18341	[c=4 l=5]  *movsi_internal/1
+	call	data_read_page	# 6209	[c=10 l=5]  *call_value
+	movl	8(%rsp), %r8d	# 18342	[c=9 l=5]  *movsi_internal/0
+	movl	%eax, %r15d	# 6210	[c=4 l=3]  *movsi_internal/0
+	jmp	.L683	# 20938	[c=1 l=5]  jump
+.L1574:
+	movl	$61, %esi	# 8859	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 8860	[c=4 l=3]  *movdi_internal/3
+	movl	%ecx, 16(%rsp)	# 18430	[c=4 l=4]  *movsi_internal/1
+	call	data_read_mapped	# 8861	[c=10 l=5]  *call_value
+	movl	16(%rsp), %ecx	# 18431	[c=9 l=4]  *movsi_internal/0
+	movl	%eax, %r15d	# 8862	[c=4 l=3]  *movsi_internal/0
+	movl	$62, %eax	# 8863	[c=4 l=5]  *movsi_internal/0
+	subl	%ecx, %eax	# 8864	[c=4 l=2]  *subsi_1/0
+	cmpl	%r14d, %eax	# 8865	[c=4 l=3]  *cmpsi_1/0
+	jnb	.L832	# 8866	[c=13 l=6]  *jcc
+	movq	1040(%r13), %rax	# 15104	[c=9 l=7]  *movdi_internal/3
+	jmp	.L831	# 20940	[c=1 l=5]  jump
+.L1595:
+	movl	$61, %esi	# 9464	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 9465	[c=4 l=3]  *movdi_internal/3
+	call	data_read_mapped	# 9466	[c=10 l=5]  *call_value
+	movl	%eax, %edx	# 9467	[c=4 l=2]  *movsi_internal/0
+	movl	$62, %eax	# 9468	[c=4 l=5]  *movsi_internal/0
+	subl	%r15d, %eax	# 9469	[c=4 l=3]  *subsi_1/0
+	cmpl	%r14d, %eax	# 9470	[c=4 l=3]  *cmpsi_1/0
+	jnb	.L884	# 9471	[c=13 l=6]  *jcc
+	movq	1040(%r13), %rax	# 15106	[c=9 l=7]  *movdi_internal/3
+	jmp	.L883	# 20942	[c=1 l=5]  jump
+.L1513:
+	movl	$61, %esi	# 3589	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 3590	[c=4 l=3]  *movdi_internal/3
+	call	data_read_mapped	# 3591	[c=10 l=5]  *call_value
+	movl	%eax, %edx	# 3592	[c=4 l=2]  *movsi_internal/0
+	cmpl	%r15d, %r14d	# 3593	[c=4 l=3]  *cmpsi_1/0
+	jnb	.L514	# 3594	[c=13 l=6]  *jcc
+	movq	1040(%r13), %rax	# 15099	[c=9 l=7]  *movdi_internal/3
+	jmp	.L513	# 20944	[c=1 l=5]  jump
+.L1589:
+	movl	$61, %esi	# 8668	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 8669	[c=4 l=3]  *movdi_internal/3
+	movl	%edx, 24(%rsp)	# 18427	[c=4 l=4]  *movsi_internal/1
+	movl	%ecx, 8(%rsp)	# 18425	[c=4 l=4]  *movsi_internal/1
+	call	data_read_mapped	# 8670	[c=10 l=5]  *call_value
+	movl	8(%rsp), %ecx	# 18426	[c=9 l=4]  *movsi_internal/0
+	movl	24(%rsp), %edx	# 18428	[c=9 l=4]  *movsi_internal/0
+	movl	%eax, %r14d	# 8671	[c=4 l=3]  *movsi_internal/0
+	movl	$62, %eax	# 8672	[c=4 l=5]  *movsi_internal/0
+	subl	%ecx, %eax	# 8673	[c=4 l=2]  *subsi_1/0
+	cmpl	%edx, %eax	# 8674	[c=4 l=2]  *cmpsi_1/0
+	jnb	.L817	# 8675	[c=13 l=6]  *jcc
+	movq	1040(%r13), %rax	# 15103	[c=9 l=7]  *movdi_internal/3
+	jmp	.L816	# 20946	[c=1 l=5]  jump
+.L1551:
+	movl	$63, %edx	# 14368	[c=4 l=5]  *movsi_internal/0
+	leaq	.LC33(%rip), %rsi	# 14369	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 14371	[c=4 l=3]  *movdi_internal/3
+	movl	%ecx, 32(%rsp)	# 18650	[c=4 l=4]  *movsi_internal/1
+	call	log_add_data_mov@PLT	# 14372	[c=0 l=5]  *call
+	movl	32(%rsp), %ecx	# 18651	[c=9 l=4]  *movsi_internal/0
+	movl	16(%rsp), %edx	# 14376	[c=9 l=4]  *movsi_internal/0
+	movq	%r13, %rdi	# 14379	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC36(%rip), %rsi	# 14377	[c=1 l=7]  *movdi_internal/4
+	xorl	%eax, %eax	# 19883	[c=4 l=2]  *movdi_xor
+	movb	%cl, 32(%rsp)	# 18648	[c=4 l=4]  *movqi_internal/8
+	movzbl	%cl, %ecx	# 14374	[c=4 l=3]  *zero_extendqisi2/0
+	call	log_append@PLT	# 14381	[c=0 l=5]  *call
+	movzbl	32(%rsp), %r9d	# 18649	[c=9 l=6]  *movqi_internal/4
+	leaq	.LC29(%rip), %rsi	# 126	[c=1 l=7]  *movdi_internal/4
+	jmp	.L1183	# 20948	[c=1 l=5]  jump
+.L1495:
+	movl	%r9d, %ecx	# 14474	[c=4 l=3]  *movsi_internal/0
+	movl	$63, %edx	# 14475	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 14478	[c=4 l=3]  *movdi_internal/3
+	movl	%r9d, 24(%rsp)	# 18685	[c=4 l=5]  *movsi_internal/1
+	leaq	.LC33(%rip), %rsi	# 14476	[c=1 l=7]  *movdi_internal/4
+	call	log_add_data_mov@PLT	# 14479	[c=0 l=5]  *call
+	movl	24(%rsp), %r9d	# 18686	[c=9 l=5]  *movsi_internal/0
+	movl	8(%rsp), %edx	# 14483	[c=9 l=4]  *movsi_internal/0
+	xorl	%eax, %eax	# 19878	[c=4 l=2]  *movdi_xor
+	leaq	.LC36(%rip), %rsi	# 14484	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 14486	[c=4 l=3]  *movdi_internal/3
+	movzbl	%r9b, %ecx	# 14481	[c=4 l=4]  *zero_extendqisi2/0
+	movb	%r9b, 32(%rsp)	# 18683	[c=4 l=5]  *movqi_internal/8
+	call	log_append@PLT	# 14488	[c=0 l=5]  *call
+	movl	16(%rsp), %eax	# 18115	[c=9 l=4]  *movsi_internal/0
+	movl	24(%rsp), %r9d	# 18682	[c=9 l=5]  *movsi_internal/0
+	leaq	.LC29(%rip), %rsi	# 134	[c=1 l=7]  *movdi_internal/4
+	movzbl	32(%rsp), %r11d	# 18684	[c=9 l=6]  *movqi_internal/4
+	xorl	%r9d, %eax	# 14489	[c=4 l=3]  *xorsi_1/0
+	movl	%eax, 8(%rsp)	# 18680	[c=4 l=4]  *movsi_internal/1
+	movzbl	%al, %ecx	# 14490	[c=4 l=3]  *zero_extendqisi2/0
+	jmp	.L1186	# 20950	[c=1 l=5]  jump
+.L1579:
+	movl	$61, %esi	# 9170	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 9171	[c=4 l=3]  *movdi_internal/3
+	call	data_read_mapped	# 9172	[c=10 l=5]  *call_value
+	movl	%eax, %edx	# 9173	[c=4 l=2]  *movsi_internal/0
+	movl	$62, %eax	# 9174	[c=4 l=5]  *movsi_internal/0
+	subl	%r15d, %eax	# 9175	[c=4 l=3]  *subsi_1/0
+	cmpl	%r14d, %eax	# 9176	[c=4 l=3]  *cmpsi_1/0
+	jnb	.L858	# 9177	[c=13 l=6]  *jcc
+	movq	1040(%r13), %rax	# 15105	[c=9 l=7]  *movdi_internal/3
+	jmp	.L857	# 20952	[c=1 l=5]  jump
+.L1503:
+	movl	$61, %esi	# 2285	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 2286	[c=4 l=3]  *movdi_internal/3
+	movl	%ecx, 24(%rsp)	# 18193	[c=4 l=4]  *movsi_internal/1
+	call	data_read_mapped	# 2287	[c=10 l=5]  *call_value
+	movl	24(%rsp), %ecx	# 18194	[c=9 l=4]  *movsi_internal/0
+	movl	%eax, %r15d	# 2288	[c=4 l=3]  *movsi_internal/0
+	movl	$62, %eax	# 2289	[c=4 l=5]  *movsi_internal/0
+	subl	%ecx, %eax	# 2290	[c=4 l=2]  *subsi_1/0
+	cmpl	%r14d, %eax	# 2291	[c=4 l=3]  *cmpsi_1/0
+	jnb	.L433	# 2292	[c=13 l=6]  *jcc
+	movq	1040(%r13), %rax	# 15098	[c=9 l=7]  *movdi_internal/3
+	jmp	.L432	# 20954	[c=1 l=5]  jump
+.L1036:
+	movl	16(%rsp), %edx	# 11840	[c=9 l=4]  *movsi_internal/0
+	movl	%r15d, %esi	# 11841	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 11842	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 11843	[c=0 l=5]  *call
+	jmp	.L1033	# 20956	[c=1 l=5]  jump
+.L661:
+	movl	%edx, %esi	# 5924	[c=4 l=2]  *movsi_internal/0
+	movq	%r13, %rdi	# 5925	[c=4 l=3]  *movdi_internal/3
+	movl	%r8d, 16(%rsp)	# 18321	[c=4 l=5]  *movsi_internal/1
+	movl	%edx, 8(%rsp)	# 18319	[c=4 l=4]  *movsi_internal/1
+	call	data_read_page	# 5926	[c=10 l=5]  *call_value
+	movl	16(%rsp), %r8d	# 18322	[c=9 l=5]  *movsi_internal/0
+	movl	8(%rsp), %edx	# 18320	[c=9 l=4]  *movsi_internal/0
+	movl	%eax, %r15d	# 5927	[c=4 l=3]  *movsi_internal/0
+	jmp	.L662	# 20958	[c=1 l=5]  jump
+.L1025:
+	movl	24(%rsp), %edx	# 11672	[c=9 l=4]  *movsi_internal/0
+	movl	%r14d, %esi	# 11673	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 11674	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 11675	[c=0 l=5]  *call
+	jmp	.L1026	# 20960	[c=1 l=5]  jump
+.L1018:
+	movl	24(%rsp), %edx	# 11562	[c=9 l=4]  *movsi_internal/0
+	movl	%r14d, %esi	# 11563	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 11564	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 11565	[c=0 l=5]  *call
+	jmp	.L1019	# 20962	[c=1 l=5]  jump
+.L1170:
+	movl	8(%rsp), %edx	# 14083	[c=9 l=4]  *movsi_internal/0
+	movl	%r15d, %esi	# 14084	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 14085	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 14086	[c=0 l=5]  *call
+	jmp	.L1168	# 20964	[c=1 l=5]  jump
+.L1182:
+	movl	8(%rsp), %edx	# 14259	[c=9 l=4]  *movsi_internal/0
+	movl	%r15d, %esi	# 14260	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 14261	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 14262	[c=0 l=5]  *call
+	jmp	.L1180	# 20966	[c=1 l=5]  jump
+.L722:
+	movl	%r8d, %esi	# 6839	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 6840	[c=4 l=3]  *movdi_internal/3
+	movl	%r8d, 8(%rsp)	# 18363	[c=4 l=5]  *movsi_internal/1
+	call	data_read_page	# 6841	[c=10 l=5]  *call_value
+	movl	8(%rsp), %r8d	# 18364	[c=9 l=5]  *movsi_internal/0
+	movl	%eax, %r15d	# 6842	[c=4 l=3]  *movsi_internal/0
+	jmp	.L723	# 20968	[c=1 l=5]  jump
+.L715:
+	movl	%r15d, %esi	# 6726	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 6727	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 6728	[c=10 l=5]  *call_value
+	movl	%eax, 8(%rsp)	# 6729	[c=4 l=4]  *movsi_internal/1
+	jmp	.L716	# 20970	[c=1 l=5]  jump
+.L701:
+	movl	%r15d, %esi	# 6498	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 6499	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 6500	[c=10 l=5]  *call_value
+	movl	%eax, 8(%rsp)	# 6501	[c=4 l=4]  *movsi_internal/1
+	jmp	.L702	# 20972	[c=1 l=5]  jump
+.L1061:
+	movl	8(%rsp), %edx	# 12249	[c=9 l=4]  *movsi_internal/0
+	movl	%r14d, %esi	# 12250	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 12251	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 12252	[c=0 l=5]  *call
+	jmp	.L1062	# 20974	[c=1 l=5]  jump
+.L1054:
+	movl	8(%rsp), %edx	# 12134	[c=9 l=4]  *movsi_internal/0
+	movl	%r15d, %esi	# 12135	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 12136	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 12137	[c=0 l=5]  *call
+	jmp	.L1055	# 20976	[c=1 l=5]  jump
+.L1047:
+	movl	8(%rsp), %edx	# 12027	[c=9 l=4]  *movsi_internal/0
+	movl	%r15d, %esi	# 12028	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 12029	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 12030	[c=0 l=5]  *call
+	jmp	.L1048	# 20978	[c=1 l=5]  jump
+.L1089:
+	movl	8(%rsp), %edx	# 12713	[c=9 l=4]  *movsi_internal/0
+	movl	%r14d, %esi	# 12714	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 12715	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 12716	[c=0 l=5]  *call
+	jmp	.L1090	# 20980	[c=1 l=5]  jump
+.L1082:
+	movl	8(%rsp), %edx	# 12598	[c=9 l=4]  *movsi_internal/0
+	movl	%r15d, %esi	# 12599	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 12600	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 12601	[c=0 l=5]  *call
+	jmp	.L1083	# 20982	[c=1 l=5]  jump
+.L1075:
+	movl	8(%rsp), %edx	# 12481	[c=9 l=4]  *movsi_internal/0
+	movl	%r14d, %esi	# 12482	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 12483	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 12484	[c=0 l=5]  *call
+	jmp	.L1076	# 20984	[c=1 l=5]  jump
+.L1068:
+	movl	8(%rsp), %edx	# 12366	[c=9 l=4]  *movsi_internal/0
+	movl	%r15d, %esi	# 12367	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 12368	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 12369	[c=0 l=5]  *call
+	jmp	.L1069	# 20986	[c=1 l=5]  jump
+.L668:
+	movl	%edx, %esi	# 6032	[c=4 l=2]  *movsi_internal/0
+	movq	%r13, %rdi	# 6033	[c=4 l=3]  *movdi_internal/3
+	movl	%r8d, 16(%rsp)	# 18329	[c=4 l=5]  *movsi_internal/1
+	movl	%edx, 8(%rsp)	# 18327	[c=4 l=4]  *movsi_internal/1
+	call	data_read_page	# 6034	[c=10 l=5]  *call_value
+	movl	16(%rsp), %r8d	# 18330	[c=9 l=5]  *movsi_internal/0
+	movl	8(%rsp), %edx	# 18328	[c=9 l=4]  *movsi_internal/0
+	movl	%eax, %r15d	# 6035	[c=4 l=3]  *movsi_internal/0
+	jmp	.L669	# 20988	[c=1 l=5]  jump
+.L694:
+	movl	%r8d, %esi	# 6393	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 6394	[c=4 l=3]  *movdi_internal/3
+	movl	%r8d, 8(%rsp)	# 18349	[c=4 l=5]  *movsi_internal/1
+	call	data_read_page	# 6395	[c=10 l=5]  *call_value
+	movl	8(%rsp), %r8d	# 18350	[c=9 l=5]  *movsi_internal/0
+	movl	%eax, %r15d	# 6396	[c=4 l=3]  *movsi_internal/0
+	jmp	.L695	# 20990	[c=1 l=5]  jump
+.L1158:
+	movl	8(%rsp), %edx	# 13906	[c=9 l=4]  *movsi_internal/0
+	movl	%r15d, %esi	# 13907	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 13908	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 13909	[c=0 l=5]  *call
+	jmp	.L1156	# 20992	[c=1 l=5]  jump
+.L1146:
+	movl	8(%rsp), %edx	# 13730	[c=9 l=4]  *movsi_internal/0
+	movl	%r14d, %esi	# 13731	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 13732	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 13733	[c=0 l=5]  *call
+	jmp	.L1144	# 20994	[c=1 l=5]  jump
+.L1247:
+	xorl	%ecx, %ecx	# 19897	[c=4 l=2]  *movdi_xor
+	jmp	.L1155	# 20996	[c=1 l=5]  jump
+.L736:
+	movl	%r8d, %esi	# 7067	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 7068	[c=4 l=3]  *movdi_internal/3
+	movl	%r8d, 8(%rsp)	# 18371	[c=4 l=5]  *movsi_internal/1
+	call	data_read_page	# 7069	[c=10 l=5]  *call_value
+	movl	8(%rsp), %r8d	# 18372	[c=9 l=5]  *movsi_internal/0
+	movl	%eax, %r15d	# 7070	[c=4 l=3]  *movsi_internal/0
+	jmp	.L737	# 20998	[c=1 l=5]  jump
+.L729:
+	movl	%r15d, %esi	# 6954	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 6955	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 6956	[c=10 l=5]  *call_value
+	movl	%eax, 8(%rsp)	# 6957	[c=4 l=4]  *movsi_internal/1
+	jmp	.L730	# 21000	[c=1 l=5]  jump
+.L708:
+	movl	%r8d, %esi	# 6611	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 6612	[c=4 l=3]  *movdi_internal/3
+	movl	%r8d, 8(%rsp)	# 18355	[c=4 l=5]  *movsi_internal/1
+	call	data_read_page	# 6613	[c=10 l=5]  *call_value
+	movl	8(%rsp), %r8d	# 18356	[c=9 l=5]  *movsi_internal/0
+	movl	%eax, %r15d	# 6614	[c=4 l=3]  *movsi_internal/0
+	jmp	.L709	# 21002	[c=1 l=5]  jump
+.L1249:
+	xorl	%ecx, %ecx	# 19887	[c=4 l=2]  *movdi_xor
+	jmp	.L1179	# 21004	[c=1 l=5]  jump
+.L1248:
+	xorl	%ecx, %ecx	# 19892	[c=4 l=2]  *movdi_xor
+	jmp	.L1167	# 21006	[c=1 l=5]  jump
+.L1246:
+	xorl	%eax, %eax	# 19902	[c=4 l=2]  *movsi_xor
+	movl	%eax, 24(%rsp)	# 19903	[c=4 l=4]  *movsi_internal/1
+	jmp	.L1143	# 21008	[c=1 l=5]  jump
+.L673:
+	movq	1072(%r13), %rcx	# 6158	[c=9 l=7]  *movdi_internal/3
+	sarl	$12, %eax	# 6156	[c=4 l=3]  *ashrsi3_1/0
+	cltq	# 6157	[c=4 l=2]  *extendsidi2_rex64/0
+	movq	(%rcx,%rax,8), %rax	# 6159	[c=10 l=4]  *movdi_internal/3
+	testq	%rax, %rax	# 6160	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L1204	# 6161	[c=13 l=6]  *jcc
+	movl	%edx, %ecx	# 17439	[c=4 l=2]  *movsi_internal/0
+	andl	$4095, %ecx	# 16881	[c=5 l=6]  *andsi_1_zext
+	movzbl	(%rax,%rcx), %r15d	# 6165	[c=13 l=5]  *zero_extendqisi2/0
+.L679:
+	movl	%r15d, %ecx	# 6168	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 6172	[c=4 l=3]  *movdi_internal/3
+	call	log_add_data_mov@PLT	# 6173	[c=0 l=5]  *call
+	jmp	.L1375	# 21010	[c=1 l=5]  jump
+.L332:
+	leaq	.LC55(%rip), %rsi	# 562	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 564	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 20301	[c=4 l=2]  *movdi_xor
+	call	log_append@PLT	# 566	[c=0 l=5]  *call
+	jmp	.L326	# 21012	[c=1 l=5]  jump
+.L585:
+	movl	%r14d, %edx	# 4699	[c=4 l=3]  *movsi_internal/0
+	movl	$59, %esi	# 4700	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 4701	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 4702	[c=0 l=5]  *call
+	jmp	.L583	# 21014	[c=1 l=5]  jump
+.L331:
+	leaq	.LC53(%rip), %rsi	# 528	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 530	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 20304	[c=4 l=2]  *movdi_xor
+	call	log_append@PLT	# 532	[c=0 l=5]  *call
+	jmp	.L326	# 21016	[c=1 l=5]  jump
+.L330:
+	leaq	.LC51(%rip), %rsi	# 444	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 446	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 20308	[c=4 l=2]  *movdi_xor
+	call	log_append@PLT	# 448	[c=0 l=5]  *call
+	movl	$24, %edx	# 451	[c=4 l=5]  *movsi_internal/0
+	xorl	%eax, %eax	# 20309	[c=4 l=2]  *movdi_xor
+	movq	%r13, %rdi	# 454	[c=4 l=3]  *movdi_internal/3
+	movzwl	1028(%r13), %r14d	# 449	[c=13 l=8]  *zero_extendhisi2/0
+	leaq	.LC34(%rip), %rsi	# 452	[c=1 l=7]  *movdi_internal/4
+	movl	%r14d, %ecx	# 450	[c=4 l=3]  *movsi_internal/0
+	call	log_append@PLT	# 456	[c=0 l=5]  *call
+	movl	%r14d, %esi	# 457	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 458	[c=4 l=3]  *movdi_internal/3
+	call	put_argv@PLT	# 459	[c=0 l=5]  *call
+	movl	$1, %ecx	# 461	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 465	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 20310	[c=4 l=2]  *movdi_xor
+	movl	%r14d, 824(%r13)	# 460	[c=4 l=7]  *movsi_internal/1
+	leaq	.LC37(%rip), %r14	# 463	[c=1 l=7]  *movdi_internal/4
+	movl	$20, %edx	# 462	[c=4 l=5]  *movsi_internal/0
+	movq	%r14, %rsi	# 464	[c=4 l=3]  *movdi_internal/3
+	call	log_append@PLT	# 467	[c=0 l=5]  *call
+	movl	$22, %edx	# 474	[c=4 l=5]  *movsi_internal/0
+	movq	%r14, %rsi	# 476	[c=4 l=3]  *movdi_internal/3
+	movq	%r13, %rdi	# 477	[c=4 l=3]  *movdi_internal/3
+	movzwl	.LC50(%rip), %eax	# 468	[c=6 l=7]  *movv2qi_internal/2
+	movzwl	820(%r13), %ecx	# 470	[c=13 l=8]  *zero_extendhisi2/0
+	movw	%ax, 1024(%r13)	# 469	[c=4 l=8]  *movv2qi_internal/3
+	movl	%ecx, %r15d	# 19125	[c=4 l=3]  *movsi_internal/0
+	xorl	%eax, %eax	# 20311	[c=4 l=2]  *movdi_xor
+	call	log_append@PLT	# 479	[c=0 l=5]  *call
+	movl	$24, %edx	# 485	[c=4 l=5]  *movsi_internal/0
+	movq	%r14, %rsi	# 487	[c=4 l=3]  *movdi_internal/3
+	movq	%r13, %rdi	# 488	[c=4 l=3]  *movdi_internal/3
+	movw	%r15w, 1026(%r13)	# 480	[c=4 l=8]  *movhi_internal/3
+	movzwl	816(%r13), %ecx	# 481	[c=13 l=8]  *zero_extendhisi2/0
+	xorl	%eax, %eax	# 20312	[c=4 l=2]  *movdi_xor
+	movl	%ecx, %r15d	# 19126	[c=4 l=3]  *movsi_internal/0
+	call	log_append@PLT	# 490	[c=0 l=5]  *call
+	movw	%r15w, 1028(%r13)	# 491	[c=4 l=8]  *movhi_internal/3
+	jmp	.L326	# 21018	[c=1 l=5]  jump
+.L1032:
+	movl	%r15d, %edx	# 11778	[c=4 l=3]  *movsi_internal/0
+	movl	%r14d, %esi	# 11779	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 11780	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 11781	[c=0 l=5]  *call
+	jmp	.L1033	# 21020	[c=1 l=5]  jump
+.L1204:
+	xorl	%r15d, %r15d	# 20136	[c=4 l=3]  *movdi_xor
+	jmp	.L679	# 21022	[c=1 l=5]  jump
+.L675:
+	movl	%edx, %esi	# 6136	[c=4 l=2]  *movsi_internal/0
+	movq	%r13, %rdi	# 6137	[c=4 l=3]  *movdi_internal/3
+	movl	%edx, 8(%rsp)	# 18337	[c=4 l=4]  *movsi_internal/1
+	call	data_read_page	# 6138	[c=10 l=5]  *call_value
+	movl	8(%rsp), %edx	# 18338	[c=9 l=4]  *movsi_internal/0
+	movl	%eax, %r15d	# 6139	[c=4 l=3]  *movsi_internal/0
+	jmp	.L676	# 21024	[c=1 l=5]  jump
+.L1600:
+	leaq	.LC64(%rip), %rdx	# 9810	[c=1 l=7]  *movdi_internal/4
+	xorl	%esi, %esi	# 20020	[c=4 l=2]  *movdi_xor
+	movq	%r13, %rdi	# 9813	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 20021	[c=4 l=2]  *movdi_xor
+	call	leave	# 9815	[c=0 l=5]  *call
+.L327:
+	movl	%r15d, %ecx	# 381	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC48(%rip), %rdx	# 382	[c=1 l=7]  *movdi_internal/4
+	movq	%r13, %rdi	# 385	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 20319	[c=4 l=2]  *movdi_xor
+	movl	$1, %esi	# 384	[c=4 l=5]  *movsi_internal/0
+	call	leave	# 387	[c=0 l=5]  *call
+.L1590:
+	movl	%r14d, %esi	# 8718	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 8719	[c=4 l=3]  *movdi_internal/3
+	call	stack_overflow	# 8720	[c=0 l=5]  *call
+.L995:
+	leaq	.LC65(%rip), %rdx	# 11182	[c=1 l=7]  *movdi_internal/4
+	movl	$4, %esi	# 11184	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rdi	# 11185	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 19993	[c=4 l=2]  *movdi_xor
+	call	leave	# 11187	[c=0 l=5]  *call
+.L1382:
+	movl	%r15d, %esi	# 8913	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 8914	[c=4 l=3]  *movdi_internal/3
+	call	stack_overflow	# 8915	[c=0 l=5]  *call
+.L1381:
+	movl	%r14d, %esi	# 9627	[c=4 l=3]  *movsi_internal/0
+.L1380:
+	movq	%r13, %rdi	# 9628	[c=4 l=3]  *movdi_internal/3
+	call	bad_PC	# 9629	[c=0 l=5]  *call
+	.cfi_endproc
+.LFE213:
+	.size	execute, .-execute
+	.section	.rodata.str1.1
+.LC67:
+	.string	"RAM"
+.LC68:
+	.string	"flash"
+.LC69:
+	.string	"EEPROM"
+.LC70:
+	.string	"decoded flash"
+.LC71:
+	.string	"atmega64"
+.LC72:
+	.string	"atmega128"
+	.section	.rodata.str1.8
+	.align 8
+.LC73:
+	.string	"entry point 0x%x is outside the flash of %s"
+	.text
+	.p2align 4
+	.type	run_context, @function
+run_context:
+.LFB218:
+	.cfi_startproc
+	pushq	%r13	# 833	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 16
+	.cfi_offset 13, -16
+	pushq	%r12	# 834	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 24
+	.cfi_offset 12, -24
+	pushq	%rbp	# 835	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 32
+	.cfi_offset 6, -32
+	pushq	%rbx	# 836	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 40
+	.cfi_offset 3, -40
+	subq	$248, %rsp	# 837	[c=4 l=7]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_def_cfa_offset 288
+	movq	%rdi, (%rsp)	# 2	[c=4 l=4]  *movdi_internal/5
+	leaq	32(%rsp), %rdi	# 21	[c=4 l=5]  *leadi
+	movl	%esi, 12(%rsp)	# 3	[c=4 l=4]  *movsi_internal/1
+	movq	%rdx, 16(%rsp)	# 4	[c=4 l=5]  *movdi_internal/5
+	call	_setjmp@PLT	# 23	[c=10 l=5]  *call_value
+	testl	%eax, %eax	# 30	[c=4 l=2]  *cmpsi_ccno_1/0
+	je	.L1669	# 31	[c=13 l=6]  *jcc
+	movq	(%rsp), %rbx	# 791	[c=5 l=4]  *movdi_internal/3
+	movq	$0, 128(%rbx)	# 499	[c=4 l=11]  *movdi_internal/5
+	movq	%rbx, %rdi	# 500	[c=4 l=3]  *movdi_internal/3
+	call	eeprom_finish@PLT	# 501	[c=0 l=5]  *call
+	movq	984(%rbx), %rdi	# 503	[c=9 l=7]  *movdi_internal/3
+	testq	%rdi, %rdi	# 504	[c=4 l=3]  *cmpdi_ccno_1/0
+	jne	.L1648	# 505	[c=13 l=2]  *jcc
+	jmp	.L1654	# 886	[c=1 l=2]  jump
+	.p2align 4,,10
+	.p2align 3
+.L1670:
+	movq	%rax, (%rdx)	# 527	[c=4 l=3]  *movdi_internal/5
+.L1651:
+	testq	%rax, %rax	# 535	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L1652	# 536	[c=13 l=2]  *jcc
+	movq	%rdx, 8(%rax)	# 538	[c=4 l=4]  *movdi_internal/5
+.L1652:
+	call	free@PLT	# 551	[c=0 l=5]  *call
+	movq	(%rsp), %rax	# 752	[c=5 l=4]  *movdi_internal/3
+	movq	984(%rax), %rdi	# 552	[c=9 l=7]  *movdi_internal/3
+	testq	%rdi, %rdi	# 553	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L1654	# 554	[c=13 l=2]  *jcc
+.L1648:
+	movq	16(%rdi), %rax	# 512	[c=9 l=4]  *movdi_internal/3
+	testq	%rax, %rax	# 513	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L1649	# 514	[c=13 l=2]  *jcc
+	movq	%rax, %rdi	# 516	[c=4 l=3]  *movdi_internal/3
+	call	fclose@PLT	# 517	[c=10 l=5]  *call_value
+	movq	(%rsp), %rax	# 749	[c=5 l=4]  *movdi_internal/3
+	movq	984(%rax), %rdi	# 519	[c=9 l=7]  *movdi_internal/3
+.L1649:
+	movq	8(%rdi), %rdx	# 522	[c=9 l=4]  *movdi_internal/3
+	movq	(%rdi), %rax	# 523	[c=5 l=3]  *movdi_internal/3
+	testq	%rdx, %rdx	# 524	[c=4 l=3]  *cmpdi_ccno_1/0
+	jne	.L1670	# 525	[c=13 l=2]  *jcc
+	movq	(%rsp), %rbx	# 750	[c=5 l=4]  *movdi_internal/3
+	movq	%rax, 984(%rbx)	# 532	[c=4 l=7]  *movdi_internal/5
+	jmp	.L1651	# 889	[c=1 l=2]  jump
+	.p2align 4,,10
+	.p2align 3
+.L1654:
+	movq	(%rsp), %rax	# 748	[c=5 l=4]  *movdi_internal/3
+	movl	136(%rax), %eax	# 507	[c=9 l=6]  *movsi_internal/0
+	addq	$248, %rsp	# 840	[c=4 l=7]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	popq	%rbx	# 841	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 32
+	popq	%rbp	# 842	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 24
+	popq	%r12	# 843	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 16
+	popq	%r13	# 844	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 8
+	ret		# 845	[c=0 l=1]  simple_return_internal
+.L1669:
+	.cfi_restore_state
+	movq	(%rsp), %rbx	# 756	[c=5 l=4]  *movdi_internal/3
+	leaq	32(%rsp), %rax	# 33	[c=4 l=5]  *leadi
+	xorl	%esi, %esi	# 883	[c=4 l=2]  *movdi_xor
+	movl	$1, %r13d	# 6	[c=4 l=6]  *movsi_internal/0
+	movq	%rax, 128(%rbx)	# 34	[c=4 l=7]  *movdi_internal/5
+	leaq	920(%rbx), %rdi	# 824	[c=4 l=7]  *leadi
+	call	gettimeofday@PLT	# 38	[c=10 l=5]  *call_value
+	movq	16(%rsp), %rdx	# 39	[c=9 l=5]  *movdi_internal/3
+	movl	12(%rsp), %esi	# 40	[c=9 l=4]  *movsi_internal/0
+	movq	%rbx, %rdi	# 41	[c=4 l=3]  *movdi_internal/3
+	call	parse_args@PLT	# 42	[c=0 l=5]  *call
+	movq	%rbx, %rdi	# 44	[c=4 l=3]  *movdi_internal/3
+	call	replay_open@PLT	# 45	[c=0 l=5]  *call
+	movl	880(%rbx), %eax	# 47	[c=9 l=6]  *movsi_internal/0
+.L1612:
+	movl	%r13d, %r12d	# 49	[c=4 l=3]  *movsi_internal/0
+	addl	%r13d, %r13d	# 50	[c=4 l=3]  *ashlsi3_1/0
+	cmpl	%eax, %r13d	# 52	[c=4 l=3]  *cmpsi_1/0
+	jb	.L1612	# 53	[c=13 l=2]  *jcc
+	leal	-1(%r12), %eax	# 822	[c=4 l=5]  *leasi
+	movl	$1, %edi	# 65	[c=4 l=5]  *movdi_internal/2
+	movd	%eax, %xmm0	# 684	[c=4 l=4]  *movsi_internal/13
+	movq	(%rsp), %rax	# 759	[c=5 l=4]  *movdi_internal/3
+	movl	872(%rax), %ecx	# 56	[c=9 l=6]  *movsi_internal/0
+	movd	%ecx, %xmm1	# 687	[c=4 l=4]  *movsi_internal/13
+	movl	%ecx, 24(%rsp)	# 686	[c=4 l=4]  *movsi_internal/1
+	movl	876(%rax), %ecx	# 59	[c=9 l=6]  *movsi_internal/0
+	punpckldq	%xmm1, %xmm0	# 57	[c=4 l=4]  *vec_concatv2si/0
+	movl	%ecx, 1000(%rax)	# 60	[c=4 l=6]  *movsi_internal/1
+	leal	1(%rcx), %esi	# 823	[c=5 l=3]  *leadi
+	movq	%xmm0, 992(%rax)	# 58	[c=4 l=9]  *movv2si_internal/14
+	movq	%rsi, %rbx	# 829	[c=4 l=3]  *movdi_internal/3
+	addq	$32, %rsi	# 63	[c=4 l=4]  *adddi_1/0
+	call	calloc@PLT	# 66	[c=10 l=5]  *call_value
+	movq	%rax, %rbp	# 67	[c=4 l=3]  *movdi_internal/3
+	testq	%rax, %rax	# 69	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L1671	# 70	[c=13 l=6]  *jcc
+	xorl	%esi, %esi	# 881	[c=4 l=2]  *movdi_xor
+	movq	%rsi, 8(%rax)	# 882	[c=4 l=4]  *movdi_internal/5
+	movq	(%rsp), %rax	# 691	[c=5 l=4]  *movdi_internal/3
+	movq	984(%rax), %rax	# 85	[c=9 l=7]  *movdi_internal/3
+	movq	%rax, 0(%rbp)	# 86	[c=4 l=4]  *movdi_internal/5
+	testq	%rax, %rax	# 87	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L1614	# 88	[c=13 l=2]  *jcc
+	movq	%rbp, 8(%rax)	# 90	[c=4 l=4]  *movdi_internal/5
+.L1614:
+	movq	(%rsp), %rcx	# 760	[c=5 l=4]  *movdi_internal/3
+	leaq	32(%rbp), %rax	# 821	[c=4 l=4]  *leadi
+	leal	2(%r13), %esi	# 922	[c=5 l=4]  *leadi
+	movl	$1, %edi	# 100	[c=4 l=5]  *movdi_internal/2
+	movq	%rsi, %r13	# 830	[c=4 l=3]  *movdi_internal/3
+	addq	$32, %rsi	# 98	[c=4 l=4]  *adddi_1/0
+	movq	%rbp, 984(%rcx)	# 93	[c=4 l=7]  *movdi_internal/5
+	movq	%rax, 1040(%rcx)	# 95	[c=4 l=7]  *movdi_internal/5
+	call	calloc@PLT	# 101	[c=10 l=5]  *call_value
+	movq	%rax, %rbx	# 102	[c=4 l=3]  *movdi_internal/3
+	testq	%rax, %rax	# 104	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L1672	# 105	[c=13 l=6]  *jcc
+	xorl	%ecx, %ecx	# 878	[c=4 l=2]  *movdi_xor
+	movq	%rbp, (%rax)	# 120	[c=4 l=3]  *movdi_internal/5
+	movl	$1, %edi	# 130	[c=4 l=5]  *movdi_internal/2
+	movq	%rcx, 8(%rax)	# 879	[c=4 l=4]  *movdi_internal/5
+	movq	(%rsp), %rcx	# 762	[c=5 l=4]  *movdi_internal/3
+	movq	%rax, 8(%rbp)	# 121	[c=4 l=4]  *movdi_internal/5
+	movq	%rax, 984(%rcx)	# 122	[c=4 l=7]  *movdi_internal/5
+	leaq	32(%rax), %rax	# 820	[c=4 l=4]  *leadi
+	movq	%rax, 1056(%rcx)	# 124	[c=4 l=7]  *movdi_internal/5
+	movl	884(%rcx), %ecx	# 125	[c=9 l=6]  *movsi_internal/0
+	movl	$1, %eax	# 679	[c=4 l=5]  *movsi_internal/0
+	testl	%ecx, %ecx	# 676	[c=4 l=2]  *cmpsi_ccno_1/0
+	cmovne	%ecx, %eax	# 677	[c=8 l=3]  *movsicc_noc/0
+	movl	%eax, %esi	# 698	[c=1 l=2]  *zero_extendsidi2/3
+	movq	%rsi, %r13	# 831	[c=4 l=3]  *movdi_internal/3
+	addq	$32, %rsi	# 128	[c=4 l=4]  *adddi_1/0
+	call	calloc@PLT	# 131	[c=10 l=5]  *call_value
+	leaq	.LC69(%rip), %r9	# 137	[c=1 l=7]  *movdi_internal/4
+	movq	%rax, %rbp	# 132	[c=4 l=3]  *movdi_internal/3
+	testq	%rax, %rax	# 134	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L1668	# 135	[c=13 l=6]  *jcc
+	movq	(%rsp), %rcx	# 763	[c=5 l=4]  *movdi_internal/3
+	xorl	%edx, %edx	# 876	[c=4 l=2]  *movdi_xor
+	movq	%rbx, (%rax)	# 150	[c=4 l=3]  *movdi_internal/5
+	movl	%r12d, %esi	# 155	[c=1 l=3]  *zero_extendsidi2/3
+	movq	%rdx, 8(%rax)	# 877	[c=4 l=4]  *movdi_internal/5
+	salq	$4, %rsi	# 156	[c=4 l=4]  *ashldi3_1/0
+	movl	$1, %edi	# 159	[c=4 l=5]  *movdi_internal/2
+	movq	%rax, 8(%rbx)	# 151	[c=4 l=4]  *movdi_internal/5
+	addq	$32, %rsi	# 157	[c=4 l=4]  *adddi_1/0
+	movq	%rax, 984(%rcx)	# 152	[c=4 l=7]  *movdi_internal/5
+	leaq	32(%rax), %rax	# 819	[c=4 l=4]  *leadi
+	movq	%rax, 1048(%rcx)	# 154	[c=4 l=7]  *movdi_internal/5
+	call	calloc@PLT	# 160	[c=10 l=5]  *call_value
+	movq	%rax, %rbx	# 161	[c=4 l=3]  *movdi_internal/3
+	testq	%rax, %rax	# 163	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L1673	# 164	[c=13 l=6]  *jcc
+	movq	(%rsp), %rcx	# 765	[c=5 l=4]  *movdi_internal/3
+	xorl	%eax, %eax	# 874	[c=4 l=2]  *movdi_xor
+	movq	%rbp, (%rbx)	# 179	[c=4 l=3]  *movdi_internal/5
+	movq	%rax, 8(%rbx)	# 875	[c=4 l=4]  *movdi_internal/5
+	leaq	32(%rbx), %rax	# 818	[c=4 l=4]  *leadi
+	cmpb	$0, 844(%rcx)	# 184	[c=13 l=7]  *cmpqi_ccno_1/1
+	movq	%rbx, 8(%rbp)	# 180	[c=4 l=4]  *movdi_internal/5
+	movq	%rbx, 984(%rcx)	# 181	[c=4 l=7]  *movdi_internal/5
+	movq	%rax, 1064(%rcx)	# 183	[c=4 l=7]  *movdi_internal/5
+	jne	.L1674	# 185	[c=13 l=6]  *jcc
+.L1618:
+	movq	(%rsp), %rbx	# 767	[c=5 l=4]  *movdi_internal/3
+	movq	%rbx, %rdi	# 214	[c=4 l=3]  *movdi_internal/3
+	call	periph_init@PLT	# 215	[c=0 l=5]  *call
+	leaq	1080(%rbx), %rdi	# 817	[c=4 l=7]  *leadi
+	xorl	%ecx, %ecx	# 873	[c=4 l=2]  *movdi_xor
+	movl	$31, %edx	# 8	[c=4 l=5]  *movsi_internal/0
+	movq	%rdi, %rsi	# 218	[c=4 l=3]  *movdi_internal/3
+.L1630:
+	movq	(%rsp), %rax	# 707	[c=5 l=4]  *movdi_internal/3
+	movl	1000(%rax), %r8d	# 220	[c=9 l=7]  *movsi_internal/0
+	xorl	%eax, %eax	# 872	[c=4 l=2]  *movdi_xor
+	cmpl	%edx, %r8d	# 221	[c=4 l=3]  *cmpsi_1/0
+	jnb	.L1620	# 222	[c=13 l=2]  *jcc
+	cmpl	%ecx, %r8d	# 623	[c=4 l=3]  *cmpsi_1/0
+	sbbl	%eax, %eax	# 624	[c=8 l=2]  *x86_movsicc_0_m1
+	andl	$4, %eax	# 815	[c=4 l=3]  *andsi_1/0
+	addl	$1, %eax	# 816	[c=4 l=3]  *addsi_1/0
+.L1620:
+	movb	%al, (%rsi)	# 230	[c=4 l=2]  *movqi_internal/8
+	movq	(%rsp), %rax	# 768	[c=5 l=4]  *movdi_internal/3
+	movq	%rsi, %r8	# 229	[c=4 l=3]  *movdi_internal/3
+	cmpb	$0, 844(%rax)	# 231	[c=13 l=7]  *cmpqi_ccno_1/1
+	je	.L1621	# 232	[c=13 l=2]  *jcc
+	cmpl	%ecx, 1000(%rax)	# 234	[c=13 l=6]  *cmpsi_1/0
+	jnb	.L1621	# 235	[c=13 l=2]  *jcc
+	cmpl	$65535, %edx	# 239	[c=4 l=6]  *cmpsi_1/0
+	ja	.L1675	# 240	[c=13 l=6]  *jcc
+	movb	$4, (%rsi)	# 259	[c=4 l=3]  *movqi_internal/8
+	movl	884(%rax), %eax	# 260	[c=9 l=6]  *movsi_internal/0
+	testl	%eax, %eax	# 261	[c=4 l=2]  *cmpsi_ccno_1/0
+	jne	.L1627	# 262	[c=13 l=2]  *jcc
+	addl	$32, %edx	# 264	[c=4 l=3]  *addsi_1/0
+	addl	$32, %ecx	# 265	[c=4 l=3]  *addsi_1/0
+	addq	$1, %rsi	# 266	[c=4 l=4]  *adddi_1/0
+	jmp	.L1630	# 896	[c=1 l=2]  jump
+.L1621:
+	movq	(%rsp), %rax	# 713	[c=5 l=4]  *movdi_internal/3
+	movl	884(%rax), %eax	# 271	[c=9 l=6]  *movsi_internal/0
+	testl	%eax, %eax	# 272	[c=4 l=2]  *cmpsi_ccno_1/0
+	je	.L1624	# 273	[c=13 l=2]  *jcc
+.L1627:
+	movq	(%rsp), %rbx	# 714	[c=5 l=4]  *movdi_internal/3
+	addl	$4096, %eax	# 276	[c=4 l=5]  *addsi_1/0
+	cmpl	%eax, 996(%rbx)	# 279	[c=13 l=6]  *cmpsi_1/0
+	jb	.L1624	# 280	[c=13 l=2]  *jcc
+	cmpl	$4095, %ecx	# 285	[c=4 l=6]  *cmpsi_1/0
+	ja	.L1625	# 286	[c=13 l=6]  *jcc
+.L1624:
+	addl	$32, %edx	# 295	[c=4 l=3]  *addsi_1/0
+	addl	$32, %ecx	# 296	[c=4 l=3]  *addsi_1/0
+	addq	$1, %rsi	# 297	[c=4 l=4]  *adddi_1/0
+	cmpl	$131103, %edx	# 298	[c=4 l=6]  *cmpsi_1/0
+	jne	.L1630	# 299	[c=13 l=6]  *jcc
+	movq	(%rsp), %rax	# 715	[c=5 l=4]  *movdi_internal/3
+	movb	$1, 1081(%rax)	# 307	[c=4 l=7]  *movqi_internal/8
+	xorl	%eax, %eax	# 871	[c=4 l=2]  *movdi_xor
+	jmp	.L1631	# 898	[c=1 l=2]  jump
+.L1633:
+	movq	(%rsp), %rcx	# 716	[c=5 l=4]  *movdi_internal/3
+	cmpb	$0, 6568(%rcx,%rax)	# 311	[c=14 l=8]  *cmpqi_ccno_1/1
+	je	.L1632	# 312	[c=13 l=2]  *jcc
+	shrl	$5, %edx	# 314	[c=5 l=3]  *lshrsi3_1_zext/0
+	movb	$1, (%rdi,%rdx)	# 316	[c=4 l=4]  *movqi_internal/8
+.L1632:
+	addq	$1, %rax	# 319	[c=4 l=4]  *adddi_1/0
+.L1631:
+	movq	(%rsp), %rcx	# 717	[c=5 l=4]  *movdi_internal/3
+	movl	%eax, %edx	# 322	[c=4 l=2]  *movsi_internal/0
+	cmpl	6564(%rcx), %eax	# 324	[c=13 l=6]  *cmpsi_1/1
+	jb	.L1633	# 325	[c=13 l=2]  *jcc
+	movl	1000(%rcx), %eax	# 327	[c=9 l=6]  *movsi_internal/0
+	movl	%eax, 28(%rsp)	# 719	[c=4 l=4]  *movsi_internal/1
+	addl	$1, %eax	# 328	[c=4 l=3]  *addsi_1/0
+	movl	%eax, %edx	# 721	[c=4 l=2]  *movsi_internal/0
+	shrl	$5, %edx	# 329	[c=4 l=3]  *lshrsi3_1/0
+	jmp	.L1635	# 900	[c=1 l=2]  jump
+.L1676:
+	leal	-1(%rdx), %esi	# 814	[c=5 l=3]  *leadi
+	cmpb	$0, (%rdi,%rsi)	# 337	[c=13 l=4]  *cmpqi_ccno_1/1
+	movq	%rsi, %rcx	# 832	[c=4 l=3]  *movdi_internal/3
+	jne	.L1634	# 338	[c=13 l=2]  *jcc
+	movl	%ecx, %edx	# 13	[c=4 l=2]  *movsi_internal/0
+.L1635:
+	testl	%edx, %edx	# 331	[c=4 l=2]  *cmpsi_ccno_1/0
+	jne	.L1676	# 332	[c=13 l=2]  *jcc
+.L1634:
+	movq	(%rsp), %rcx	# 773	[c=5 l=4]  *movdi_internal/3
+	sall	$5, %edx	# 341	[c=4 l=3]  *ashlsi3_1/0
+	andl	$-32, %eax	# 343	[c=4 l=3]  *andsi_1/0
+	leaq	.LC71(%rip), %rsi	# 356	[c=1 l=7]  *movdi_internal/4
+	subl	%edx, %eax	# 344	[c=4 l=2]  *subsi_1/0
+	cmpl	$69633, 880(%rcx)	# 604	[c=13 l=10]  *cmpsi_1/0
+	movl	%eax, 5180(%rcx)	# 345	[c=4 l=6]  *movsi_internal/1
+	sbbl	%eax, %eax	# 605	[c=8 l=2]  *x86_movsicc_0_m1
+	movl	%edx, 5176(%rcx)	# 342	[c=4 l=6]  *movsi_internal/1
+	movq	856(%rcx), %rbx	# 354	[c=9 l=7]  *movdi_internal/3
+	xorb	%al, %al	# 870	[c=4 l=2]  *movstrictqi_xor
+	addl	$512, %eax	# 607	[c=4 l=5]  *addsi_1/0
+	movq	%rbx, %rdi	# 358	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, 6044(%rcx)	# 353	[c=4 l=6]  *movsi_internal/1
+	call	strcmp@PLT	# 359	[c=10 l=5]  *call_value
+	movl	%eax, %edx	# 640	[c=4 l=2]  *movsi_internal/0
+	movl	$104, %eax	# 17	[c=4 l=5]  *movsi_internal/0
+	testl	%edx, %edx	# 361	[c=4 l=2]  *cmpsi_ccno_1/0
+	je	.L1637	# 362	[c=13 l=2]  *jcc
+	leaq	.LC72(%rip), %rsi	# 365	[c=1 l=7]  *movdi_internal/4
+	movq	%rbx, %rdi	# 367	[c=4 l=3]  *movdi_internal/3
+	call	strcmp@PLT	# 368	[c=10 l=5]  *call_value
+	cmpl	$1, %eax	# 618	[c=4 l=3]  *cmpsi_1/0
+	sbbl	%eax, %eax	# 619	[c=8 l=2]  *x86_movsicc_0_m1
+	andl	$49, %eax	# 620	[c=4 l=3]  *andsi_1/0
+	addl	$55, %eax	# 621	[c=4 l=3]  *addsi_1/0
+.L1637:
+	movq	(%rsp), %rsi	# 779	[c=5 l=4]  *movdi_internal/3
+	leaq	6060(%rsi), %rdi	# 812	[c=4 l=7]  *leadi
+	movl	%eax, 6048(%rsi)	# 375	[c=4 l=6]  *movsi_internal/1
+	movl	%esi, %eax	# 732	[c=4 l=2]  *movsi_internal/0
+	movq	$-1, 6052(%rsi)	# 381	[c=4 l=11]  *movdi_internal/5
+	andq	$-8, %rdi	# 387	[c=4 l=4]  *anddi_1/1
+	movq	$-1, 6556(%rsi)	# 385	[c=4 l=11]  *movdi_internal/5
+	subl	%edi, %eax	# 388	[c=4 l=2]  *subsi_1/0
+	leal	6564(%rax), %ecx	# 389	[c=4 l=6]  *leasi
+	orq	$-1, %rax	# 869	[c=4 l=4]  *movdi_or
+	shrl	$3, %ecx	# 391	[c=5 l=3]  *lshrsi3_1_zext/0
+	rep stosq	# 393	[c=0 l=3]  *rep_stosdi_rex64
+	movl	(%rsi), %eax	# 394	[c=5 l=2]  *movsi_internal/0
+	cmpl	%eax, 992(%rsi)	# 395	[c=13 l=6]  *cmpsi_1/0
+	jb	.L1677	# 396	[c=13 l=6]  *jcc
+	movq	(%rsp), %rbx	# 780	[c=5 l=4]  *movdi_internal/3
+	movq	%rbx, %rdi	# 410	[c=4 l=3]  *movdi_internal/3
+	call	log_open@PLT	# 411	[c=0 l=5]  *call
+	cmpl	$0, 232(%rbx)	# 413	[c=13 l=7]  *cmpsi_ccno_1/1
+	jne	.L1678	# 414	[c=13 l=6]  *jcc
+.L1639:
+	movq	(%rsp), %rbx	# 781	[c=5 l=4]  *movdi_internal/3
+	movq	%rbx, %rdi	# 422	[c=4 l=3]  *movdi_internal/3
+	call	checkpoint_open@PLT	# 423	[c=0 l=5]  *call
+	cmpl	$0, 424(%rbx)	# 425	[c=13 l=7]  *cmpsi_ccno_1/1
+	jne	.L1642	# 426	[c=13 l=2]  *jcc
+	movq	(%rsp), %rdi	# 434	[c=5 l=4]  *movdi_internal/3
+	call	load_to_flash@PLT	# 435	[c=0 l=5]  *call
+.L1642:
+	movq	(%rsp), %rbx	# 783	[c=5 l=4]  *movdi_internal/3
+	movq	%rbx, %rdi	# 428	[c=4 l=3]  *movdi_internal/3
+	call	eeprom_open@PLT	# 429	[c=0 l=5]  *call
+	movq	%rbx, %rdi	# 441	[c=4 l=3]  *movdi_internal/3
+	call	checkpoint_resume@PLT	# 442	[c=0 l=5]  *call
+	cmpl	$0, 232(%rbx)	# 444	[c=13 l=7]  *cmpsi_ccno_1/1
+	jne	.L1679	# 445	[c=13 l=6]  *jcc
+.L1643:
+	movq	(%rsp), %rax	# 741	[c=5 l=4]  *movdi_internal/3
+	cmpl	$0, 424(%rax)	# 453	[c=13 l=7]  *cmpsi_ccno_1/1
+	jne	.L1646	# 454	[c=13 l=2]  *jcc
+	movq	(%rsp), %rdi	# 462	[c=5 l=4]  *movdi_internal/3
+	call	decode_flash@PLT	# 463	[c=0 l=5]  *call
+.L1646:
+	movq	(%rsp), %rbx	# 784	[c=5 l=4]  *movdi_internal/3
+	movq	%rbx, %rdi	# 456	[c=4 l=3]  *movdi_internal/3
+	call	fork_server_open@PLT	# 457	[c=0 l=5]  *call
+	cmpl	$0, 232(%rbx)	# 469	[c=13 l=7]  *cmpsi_ccno_1/1
+	jne	.L1680	# 470	[c=13 l=6]  *jcc
+.L1647:
+	movq	(%rsp), %rbx	# 789	[c=5 l=4]  *movdi_internal/3
+	movq	920(%rbx), %rsi	# 479	[c=9 l=7]  *movdi_internal/3
+	movq	%rbx, %rdi	# 482	[c=4 l=3]  *movdi_internal/3
+	addl	928(%rbx), %esi	# 480	[c=13 l=6]  *addsi_1/1
+	call	replay_seed@PLT	# 483	[c=10 l=5]  *call_value
+	movq	%rbx, %rdi	# 487	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, %esi	# 484	[c=4 l=2]  *movsi_internal/0
+	call	log_init@PLT	# 488	[c=0 l=5]  *call
+	movq	%rbx, %rdi	# 491	[c=4 l=3]  *movdi_internal/3
+	movl	$1, %esi	# 490	[c=4 l=5]  *movsi_internal/0
+	call	log_checkpoint@PLT	# 492	[c=0 l=5]  *call
+	movq	%rbx, %rdi	# 494	[c=4 l=3]  *movdi_internal/3
+	call	execute	# 495	[c=0 l=5]  *call
+.L1674:
+	movl	$32800, %esi	# 187	[c=4 l=5]  *movdi_internal/2
+	movl	$1, %edi	# 188	[c=4 l=5]  *movdi_internal/2
+	call	calloc@PLT	# 189	[c=10 l=5]  *call_value
+	testq	%rax, %rax	# 192	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L1681	# 193	[c=13 l=6]  *jcc
+	movq	(%rsp), %rcx	# 766	[c=5 l=4]  *movdi_internal/3
+	movq	%rbx, (%rax)	# 207	[c=4 l=3]  *movdi_internal/5
+	movq	%rax, 8(%rbx)	# 208	[c=4 l=4]  *movdi_internal/5
+	movq	%rax, 984(%rcx)	# 209	[c=4 l=7]  *movdi_internal/5
+	addq	$32, %rax	# 210	[c=4 l=4]  *adddi_1/0
+	movq	%rax, 1072(%rcx)	# 211	[c=4 l=7]  *movdi_internal/5
+	jmp	.L1618	# 908	[c=1 l=5]  jump
+.L1679:
+	movq	(%rsp), %rax	# 740	[c=5 l=4]  *movdi_internal/3
+	xorl	%esi, %esi	# 866	[c=4 l=2]  *movdi_xor
+	leaq	952(%rax), %rdi	# 809	[c=4 l=7]  *leadi
+	call	gettimeofday@PLT	# 450	[c=10 l=5]  *call_value
+	jmp	.L1643	# 910	[c=1 l=5]  jump
+.L1678:
+	movq	(%rsp), %rax	# 737	[c=5 l=4]  *movdi_internal/3
+	xorl	%esi, %esi	# 867	[c=4 l=2]  *movdi_xor
+	leaq	936(%rax), %rdi	# 810	[c=4 l=7]  *leadi
+	call	gettimeofday@PLT	# 419	[c=10 l=5]  *call_value
+	jmp	.L1639	# 912	[c=1 l=5]  jump
+.L1680:
+	movq	(%rsp), %rax	# 743	[c=5 l=4]  *movdi_internal/3
+	xorl	%esi, %esi	# 865	[c=4 l=2]  *movdi_xor
+	leaq	968(%rax), %rdi	# 808	[c=4 l=7]  *leadi
+	call	gettimeofday@PLT	# 475	[c=10 l=5]  *call_value
+	jmp	.L1647	# 914	[c=1 l=5]  jump
+.L1677:
+	movq	(%rsp), %rdi	# 404	[c=5 l=4]  *movdi_internal/3
+	leal	(%rax,%rax), %ecx	# 811	[c=12 l=3]  *leasi
+	movq	%rbx, %r8	# 399	[c=4 l=3]  *movdi_internal/3
+	movl	$5, %esi	# 403	[c=4 l=5]  *movsi_internal/0
+	leaq	.LC73(%rip), %rdx	# 401	[c=1 l=7]  *movdi_internal/4
+	xorl	%eax, %eax	# 868	[c=4 l=2]  *movdi_xor
+	call	leave	# 406	[c=0 l=5]  *call
+.L1681:
+	movq	(%rsp), %rdi	# 201	[c=5 l=4]  *movdi_internal/3
+	movl	$8, %r8d	# 196	[c=4 l=6]  *movsi_internal/0
+	leaq	.LC27(%rip), %r9	# 195	[c=1 l=7]  *movdi_internal/4
+	movl	$4096, %ecx	# 197	[c=4 l=5]  *movsi_internal/0
+	leaq	.LC28(%rip), %rdx	# 198	[c=1 l=7]  *movdi_internal/4
+	movl	$6, %esi	# 200	[c=4 l=5]  *movsi_internal/0
+	call	leave	# 203	[c=0 l=5]  *call
+.L1675:
+	movq	%rax, %rbx	# 769	[c=4 l=3]  *movdi_internal/3
+	movl	884(%rax), %eax	# 242	[c=9 l=6]  *movsi_internal/0
+	testl	%eax, %eax	# 243	[c=4 l=2]  *cmpsi_ccno_1/0
+	je	.L1624	# 244	[c=13 l=6]  *jcc
+	addl	$4096, %eax	# 250	[c=4 l=5]  *addsi_1/0
+	cmpl	%eax, 996(%rbx)	# 251	[c=13 l=6]  *cmpsi_1/0
+	jb	.L1624	# 252	[c=13 l=6]  *jcc
+.L1625:
+	cmpl	%eax, %edx	# 289	[c=4 l=2]  *cmpsi_1/0
+	jnb	.L1624	# 290	[c=13 l=6]  *jcc
+	movb	$3, (%r8)	# 292	[c=4 l=4]  *movqi_internal/8
+	jmp	.L1624	# 916	[c=1 l=5]  jump
+.L1673:
+	leaq	.LC70(%rip), %r9	# 166	[c=1 l=7]  *movdi_internal/4
+	movl	$16, %r8d	# 167	[c=4 l=6]  *movsi_internal/0
+	movl	%r12d, %ecx	# 168	[c=4 l=3]  *movsi_internal/0
+.L1667:
+	movq	(%rsp), %rdi	# 113	[c=5 l=4]  *movdi_internal/3
+	leaq	.LC28(%rip), %rdx	# 110	[c=1 l=7]  *movdi_internal/4
+	movl	$6, %esi	# 112	[c=4 l=5]  *movsi_internal/0
+	xorl	%eax, %eax	# 880	[c=4 l=2]  *movdi_xor
+	call	leave	# 115	[c=0 l=5]  *call
+.L1672:
+	leaq	.LC68(%rip), %r9	# 107	[c=1 l=7]  *movdi_internal/4
+.L1668:
+	movl	$1, %r8d	# 108	[c=4 l=6]  *movsi_internal/0
+	movl	%r13d, %ecx	# 109	[c=4 l=3]  *movsi_internal/0
+	jmp	.L1667	# 918	[c=1 l=2]  jump
+.L1671:
+	leaq	.LC67(%rip), %r9	# 72	[c=1 l=7]  *movdi_internal/4
+	movl	$1, %r8d	# 73	[c=4 l=6]  *movsi_internal/0
+	movl	%ebx, %ecx	# 74	[c=4 l=2]  *movsi_internal/0
+	jmp	.L1667	# 920	[c=1 l=2]  jump
+	.cfi_endproc
+.LFE218:
+	.size	run_context, .-run_context
+	.section	.rodata.str1.1
+.LC74:
+	.string	"code must be unreachable"
+	.text
+	.p2align 4
+	.globl	log_cpu_address
+	.type	log_cpu_address, @function
+log_cpu_address:
+.LFB48:
+	.cfi_startproc
+	cmpl	$2, %edx	# 8	[c=4 l=3]  *cmpsi_1/0
+	je	.L1683	# 9	[c=13 l=2]  *jcc
+	jg	.L1684	# 14	[c=13 l=2]  *jcc
+	testl	%edx, %edx	# 16	[c=4 l=2]  *cmpsi_ccno_1/0
+	je	.L1685	# 17	[c=13 l=2]  *jcc
+	cmpl	$1, %edx	# 19	[c=4 l=3]  *cmpsi_1/0
+	jne	.L1687	# 20	[c=13 l=2]  *jcc
+	movq	1040(%rdi), %rax	# 123	[c=9 l=7]  *movdi_internal/3
+	movslq	%esi, %rsi	# 40	[c=4 l=3]  *extendsidi2_rex64/1
+	addq	%rsi, %rax	# 124	[c=4 l=3]  *adddi_1/0
+	ret		# 87	[c=0 l=1]  simple_return_internal
+	.p2align 4,,10
+	.p2align 3
+.L1684:
+	cmpl	$3, %edx	# 26	[c=4 l=3]  *cmpsi_1/0
+	jne	.L1687	# 27	[c=13 l=2]  *jcc
+	movq	1048(%rdi), %rax	# 119	[c=9 l=7]  *movdi_internal/3
+	movslq	%esi, %rsi	# 54	[c=4 l=3]  *extendsidi2_rex64/1
+	addq	%rsi, %rax	# 120	[c=4 l=3]  *adddi_1/0
+	ret		# 107	[c=0 l=1]  simple_return_internal
+	.p2align 4,,10
+	.p2align 3
+.L1683:
+	movq	1056(%rdi), %rax	# 121	[c=9 l=7]  *movdi_internal/3
+	movslq	%esi, %rsi	# 47	[c=4 l=3]  *extendsidi2_rex64/1
+	addq	%rsi, %rax	# 122	[c=4 l=3]  *adddi_1/0
+	ret		# 89	[c=0 l=1]  simple_return_internal
+	.p2align 4,,10
+	.p2align 3
+.L1685:
+	movslq	%esi, %rsi	# 34	[c=4 l=3]  *extendsidi2_rex64/1
+	leaq	1004(%rdi,%rsi), %rax	# 35	[c=5 l=8]  *leadi
+	ret		# 85	[c=0 l=1]  simple_return_internal
+.L1687:
+	pushq	%rax	# 117	[c=4 l=1]  *pushdi2_prologue
+	.cfi_def_cfa_offset 16
+	leaq	.LC74(%rip), %rdx	# 61	[c=1 l=7]  *movdi_internal/4
+	movl	$8, %esi	# 63	[c=4 l=5]  *movsi_internal/0
+	xorl	%eax, %eax	# 118	[c=4 l=2]  *movdi_xor
+	call	leave	# 66	[c=0 l=5]  *call
+	.cfi_endproc
+.LFE48:
+	.size	log_cpu_address, .-log_cpu_address
+	.p2align 4
+	.globl	set_elf_string_table
+	.type	set_elf_string_table, @function
+set_elf_string_table:
+.LFB49:
+	.cfi_startproc
+	pushq	%r13	# 29	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 16
+	.cfi_offset 13, -16
+	movl	%ecx, %r13d	# 5	[c=4 l=3]  *movsi_internal/0
+	pushq	%r12	# 30	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 24
+	.cfi_offset 12, -24
+	movq	%rdx, %r12	# 4	[c=4 l=3]  *movdi_internal/3
+	pushq	%rbp	# 31	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 32
+	.cfi_offset 6, -32
+	movq	%rsi, %rbp	# 3	[c=4 l=3]  *movdi_internal/3
+	pushq	%rbx	# 32	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 40
+	.cfi_offset 3, -40
+	movq	%rdi, %rbx	# 2	[c=4 l=3]  *movdi_internal/3
+	subq	$8, %rsp	# 33	[c=4 l=4]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_def_cfa_offset 48
+	movq	%rsi, 5216(%rdi)	# 9	[c=4 l=7]  *movdi_internal/5
+	movq	%rdx, 5224(%rdi)	# 10	[c=4 l=7]  *movdi_internal/5
+	call	checkpoint_string_table@PLT	# 15	[c=0 l=5]  *call
+	addq	$8, %rsp	# 44	[c=4 l=4]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_def_cfa_offset 40
+	movl	%r13d, %ecx	# 16	[c=4 l=3]  *movsi_internal/0
+	movq	%r12, %rdx	# 17	[c=4 l=3]  *movdi_internal/3
+	movq	%rbp, %rsi	# 18	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rdi	# 19	[c=4 l=3]  *movdi_internal/3
+	popq	%rbx	# 45	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 32
+	popq	%rbp	# 46	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 24
+	popq	%r12	# 47	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 16
+	popq	%r13	# 48	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 8
+	jmp	log_set_string_table@PLT	# 20	[c=0 l=5]  *sibcall
+	.cfi_endproc
+.LFE49:
+	.size	set_elf_string_table, .-set_elf_string_table
+	.p2align 4
+	.globl	finish_elf_string_table
+	.type	finish_elf_string_table, @function
+finish_elf_string_table:
+.LFB50:
+	.cfi_startproc
+	jmp	log_finish_string_table@PLT	# 7	[c=0 l=5]  *sibcall
+	.cfi_endproc
+.LFE50:
+	.size	finish_elf_string_table, .-finish_elf_string_table
+	.p2align 4
+	.globl	set_elf_function_symbol
+	.type	set_elf_function_symbol, @function
+set_elf_function_symbol:
+.LFB51:
+	.cfi_startproc
+	pushq	%r13	# 33	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 16
+	.cfi_offset 13, -16
+	movzbl	%cl, %r13d	# 10	[c=4 l=4]  *zero_extendqisi2/0
+	pushq	%r12	# 34	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 24
+	.cfi_offset 12, -24
+	movl	%r13d, %ecx	# 11	[c=4 l=3]  *movsi_internal/0
+	movq	%rdx, %r12	# 4	[c=4 l=3]  *movdi_internal/3
+	pushq	%rbp	# 35	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 32
+	.cfi_offset 6, -32
+	movl	%esi, %ebp	# 3	[c=4 l=2]  *movsi_internal/0
+	pushq	%rbx	# 36	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 40
+	.cfi_offset 3, -40
+	movq	%rdi, %rbx	# 2	[c=4 l=3]  *movdi_internal/3
+	subq	$8, %rsp	# 37	[c=4 l=4]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_def_cfa_offset 48
+	call	checkpoint_symbol@PLT	# 15	[c=0 l=5]  *call
+	movq	%r12, %rdx	# 17	[c=4 l=3]  *movdi_internal/3
+	movl	%ebp, %esi	# 18	[c=4 l=2]  *movsi_internal/0
+	movq	%rbx, %rdi	# 19	[c=4 l=3]  *movdi_internal/3
+	movl	%r13d, %ecx	# 16	[c=4 l=3]  *movsi_internal/0
+	call	log_set_func_symbol@PLT	# 20	[c=0 l=5]  *call
+	addq	$8, %rsp	# 48	[c=4 l=4]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_def_cfa_offset 40
+	movq	%r12, %rdx	# 21	[c=4 l=3]  *movdi_internal/3
+	movl	%ebp, %esi	# 22	[c=4 l=2]  *movsi_internal/0
+	movq	%rbx, %rdi	# 23	[c=4 l=3]  *movdi_internal/3
+	popq	%rbx	# 49	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 32
+	popq	%rbp	# 50	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 24
+	popq	%r12	# 51	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 16
+	popq	%r13	# 52	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 8
+	jmp	fork_server_set_function_symbol@PLT	# 24	[c=0 l=5]  *sibcall
+	.cfi_endproc
+.LFE51:
+	.size	set_elf_function_symbol, .-set_elf_function_symbol
+	.p2align 4
+	.globl	get_mem
+	.type	get_mem, @function
+get_mem:
+.LFB54:
+	.cfi_startproc
+	pushq	%r13	# 87	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 16
+	.cfi_offset 13, -16
+	movl	%esi, %esi	# 3	[c=1 l=2]  *zero_extendsidi2/3
+	movq	%rdx, %r13	# 4	[c=4 l=3]  *movdi_internal/3
+	pushq	%r12	# 88	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 24
+	.cfi_offset 12, -24
+	movq	%rdi, %r12	# 2	[c=4 l=3]  *movdi_internal/3
+	pushq	%rbp	# 89	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 32
+	.cfi_offset 6, -32
+	movq	%rcx, %rbp	# 5	[c=4 l=3]  *movdi_internal/3
+	pushq	%rbx	# 90	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 40
+	.cfi_offset 3, -40
+	movq	%rsi, %rbx	# 86	[c=4 l=3]  *movdi_internal/3
+	subq	$8, %rsp	# 91	[c=4 l=4]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_def_cfa_offset 48
+	testq	%rdx, %rdx	# 10	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L1698	# 11	[c=13 l=2]  *jcc
+	movq	$-33, %rax	# 13	[c=4 l=7]  *movdi_internal/3
+	xorl	%edx, %edx	# 104	[c=4 l=2]  *movdi_xor
+	divq	%r13	# 84	[c=0 l=3]  *udivmoddi4_noext
+	cmpq	%rsi, %rax	# 15	[c=4 l=3]  *cmpdi_1/0
+	jb	.L1699	# 16	[c=13 l=2]  *jcc
+.L1698:
+	imulq	%r13, %rsi	# 30	[c=16 l=4]  *muldi3_1/2
+	movl	$1, %edi	# 33	[c=4 l=5]  *movdi_internal/2
+	addq	$32, %rsi	# 31	[c=4 l=4]  *adddi_1/0
+	call	calloc@PLT	# 34	[c=10 l=5]  *call_value
+	testq	%rax, %rax	# 38	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L1699	# 39	[c=13 l=2]  *jcc
+	movq	984(%r12), %rdx	# 42	[c=9 l=8]  *movdi_internal/3
+	movq	$0, 8(%rax)	# 41	[c=4 l=8]  *movdi_internal/5
+	movq	%rdx, (%rax)	# 43	[c=4 l=3]  *movdi_internal/5
+	testq	%rdx, %rdx	# 44	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L1700	# 45	[c=13 l=2]  *jcc
+	movq	%rax, 8(%rdx)	# 47	[c=4 l=4]  *movdi_internal/5
+.L1700:
+	movq	%rax, 984(%r12)	# 50	[c=4 l=8]  *movdi_internal/5
+	addq	$8, %rsp	# 94	[c=4 l=4]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	addq	$32, %rax	# 51	[c=4 l=4]  *adddi_1/0
+	popq	%rbx	# 95	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 32
+	popq	%rbp	# 96	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 24
+	popq	%r12	# 97	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 16
+	popq	%r13	# 98	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 8
+	ret		# 99	[c=0 l=1]  simple_return_internal
+.L1699:
+	.cfi_restore_state
+	movq	%rbp, %r9	# 18	[c=4 l=3]  *movdi_internal/3
+	movl	%r13d, %r8d	# 19	[c=4 l=3]  *movsi_internal/0
+	movl	%ebx, %ecx	# 20	[c=4 l=2]  *movsi_internal/0
+	movl	$6, %esi	# 23	[c=4 l=5]  *movsi_internal/0
+	leaq	.LC28(%rip), %rdx	# 21	[c=1 l=7]  *movdi_internal/4
+	movq	%r12, %rdi	# 24	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 103	[c=4 l=2]  *movdi_xor
+	call	leave	# 26	[c=0 l=5]  *call
+	.cfi_endproc
+.LFE54:
+	.size	get_mem, .-get_mem
+	.p2align 4
+	.globl	put_mem
+	.type	put_mem, @function
+put_mem:
+.LFB55:
+	.cfi_startproc
+	testq	%rsi, %rsi	# 7	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L1711	# 8	[c=13 l=2]  *jcc
+	movq	-24(%rsi), %rdx	# 11	[c=9 l=4]  *movdi_internal/3
+	movq	-32(%rsi), %rax	# 12	[c=9 l=4]  *movdi_internal/3
+	leaq	-32(%rsi), %rcx	# 48	[c=4 l=4]  *leadi
+	testq	%rdx, %rdx	# 13	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L1713	# 14	[c=13 l=2]  *jcc
+	movq	%rax, (%rdx)	# 16	[c=4 l=3]  *movdi_internal/5
+.L1714:
+	testq	%rax, %rax	# 24	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L1715	# 25	[c=13 l=2]  *jcc
+	movq	%rdx, 8(%rax)	# 27	[c=4 l=4]  *movdi_internal/5
+.L1715:
+	movq	%rcx, %rdi	# 30	[c=4 l=3]  *movdi_internal/3
+	jmp	free@PLT	# 31	[c=0 l=5]  *sibcall
+	.p2align 4,,10
+	.p2align 3
+.L1711:
+	ret		# 51	[c=0 l=1]  simple_return_internal
+	.p2align 4,,10
+	.p2align 3
+.L1713:
+	movq	%rax, 984(%rdi)	# 21	[c=4 l=7]  *movdi_internal/5
+	jmp	.L1714	# 53	[c=1 l=2]  jump
+	.cfi_endproc
+.LFE55:
+	.size	put_mem, .-put_mem
+	.section	.rodata.str1.1
+.LC75:
+	.string	"out of memory opening %s"
+	.text
+	.p2align 4
+	.globl	get_file
+	.type	get_file, @function
+get_file:
+.LFB56:
+	.cfi_startproc
+	pushq	%r12	# 73	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	movq	%rsi, %r12	# 3	[c=4 l=3]  *movdi_internal/3
+	movq	%rdx, %rsi	# 4	[c=4 l=3]  *movdi_internal/3
+	pushq	%rbp	# 74	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	movq	%rdi, %rbp	# 2	[c=4 l=3]  *movdi_internal/3
+	movq	%r12, %rdi	# 9	[c=4 l=3]  *movdi_internal/3
+	pushq	%rbx	# 75	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	call	fopen@PLT	# 10	[c=10 l=5]  *call_value
+	movq	%rax, %rbx	# 11	[c=4 l=3]  *movdi_internal/3
+	testq	%rax, %rax	# 13	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L1719	# 14	[c=13 l=2]  *jcc
+	movl	$32, %esi	# 16	[c=4 l=5]  *movdi_internal/2
+	movl	$1, %edi	# 17	[c=4 l=5]  *movdi_internal/2
+	call	calloc@PLT	# 18	[c=10 l=5]  *call_value
+	testq	%rax, %rax	# 21	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L1730	# 22	[c=13 l=2]  *jcc
+	movq	984(%rbp), %rdx	# 38	[c=9 l=7]  *movdi_internal/3
+	movq	%rbx, 16(%rax)	# 36	[c=4 l=4]  *movdi_internal/5
+	movq	$0, 8(%rax)	# 37	[c=4 l=8]  *movdi_internal/5
+	movq	%rdx, (%rax)	# 39	[c=4 l=3]  *movdi_internal/5
+	testq	%rdx, %rdx	# 40	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L1722	# 41	[c=13 l=2]  *jcc
+	movq	%rax, 8(%rdx)	# 43	[c=4 l=4]  *movdi_internal/5
+.L1722:
+	movq	%rax, 984(%rbp)	# 46	[c=4 l=7]  *movdi_internal/5
+.L1719:
+	movq	%rbx, %rax	# 52	[c=4 l=3]  *movdi_internal/3
+	popq	%rbx	# 78	[c=9 l=1]  *popdi1
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbp	# 79	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 16
+	popq	%r12	# 80	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 8
+	ret		# 81	[c=0 l=1]  simple_return_internal
+.L1730:
+	.cfi_restore_state
+	movq	%rbx, %rdi	# 24	[c=4 l=3]  *movdi_internal/3
+	call	fclose@PLT	# 25	[c=10 l=5]  *call_value
+	movq	%r12, %rcx	# 26	[c=4 l=3]  *movdi_internal/3
+	movl	$6, %esi	# 29	[c=4 l=5]  *movsi_internal/0
+	movq	%rbp, %rdi	# 30	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC75(%rip), %rdx	# 27	[c=1 l=7]  *movdi_internal/4
+	xorl	%eax, %eax	# 85	[c=4 l=2]  *movdi_xor
+	call	leave	# 32	[c=0 l=5]  *call
+	.cfi_endproc
+.LFE56:
+	.size	get_file, .-get_file
+	.p2align 4
+	.globl	put_file
+	.type	put_file, @function
+put_file:
+.LFB57:
+	.cfi_startproc
+	pushq	%rbx	# 79	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	movq	984(%rdi), %rax	# 7	[c=9 l=7]  *movdi_internal/3
+	movq	%rsi, %rbx	# 3	[c=4 l=3]  *movdi_internal/3
+	testq	%rax, %rax	# 8	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L1732	# 9	[c=13 l=2]  *jcc
+	movq	%rdi, %rcx	# 85	[c=4 l=3]  *movdi_internal/3
+	jmp	.L1737	# 90	[c=1 l=2]  jump
+	.p2align 4,,10
+	.p2align 3
+.L1733:
+	testq	%rax, %rax	# 42	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L1732	# 43	[c=13 l=2]  *jcc
+.L1737:
+	movq	16(%rax), %rdx	# 11	[c=9 l=4]  *movdi_internal/3
+	movq	%rax, %rdi	# 12	[c=4 l=3]  *movdi_internal/3
+	movq	(%rax), %rax	# 13	[c=5 l=3]  *movdi_internal/3
+	cmpq	%rbx, %rdx	# 14	[c=4 l=3]  *cmpdi_1/0
+	jne	.L1733	# 15	[c=13 l=2]  *jcc
+	movq	8(%rdi), %rdx	# 17	[c=9 l=4]  *movdi_internal/3
+	testq	%rdx, %rdx	# 18	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L1734	# 19	[c=13 l=2]  *jcc
+	movq	%rax, (%rdx)	# 21	[c=4 l=3]  *movdi_internal/5
+.L1735:
+	testq	%rax, %rax	# 29	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L1736	# 30	[c=13 l=2]  *jcc
+	movq	%rdx, 8(%rax)	# 32	[c=4 l=4]  *movdi_internal/5
+.L1736:
+	call	free@PLT	# 36	[c=0 l=5]  *call
+.L1732:
+	movq	%rbx, %rdi	# 46	[c=4 l=3]  *movdi_internal/3
+	popq	%rbx	# 88	[c=9 l=1]  *popdi1
+	.cfi_remember_state
+	.cfi_def_cfa_offset 8
+	jmp	fclose@PLT	# 47	[c=10 l=5]  *sibcall_value
+	.p2align 4,,10
+	.p2align 3
+.L1734:
+	.cfi_restore_state
+	movq	%rax, 984(%rcx)	# 26	[c=4 l=7]  *movdi_internal/5
+	jmp	.L1735	# 92	[c=1 l=2]  jump
+	.cfi_endproc
+.LFE57:
+	.size	put_file, .-put_file
+	.p2align 4
+	.globl	write_checkpoint
+	.type	write_checkpoint, @function
+write_checkpoint:
+.LFB207:
+	.cfi_startproc
+	pushq	%rbx	# 18	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	movq	%rdi, %rbx	# 2	[c=4 l=3]  *movdi_internal/3
+	call	checkpoint_begin@PLT	# 7	[c=0 l=5]  *call
+	movq	%rbx, %rdi	# 9	[c=4 l=3]  *movdi_internal/3
+	xorl	%esi, %esi	# 27	[c=4 l=2]  *movdi_xor
+	call	log_checkpoint@PLT	# 10	[c=0 l=5]  *call
+	movq	%rbx, %rdi	# 11	[c=4 l=3]  *movdi_internal/3
+	popq	%rbx	# 25	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 8
+	jmp	checkpoint_end@PLT	# 12	[c=0 l=5]  *sibcall
+	.cfi_endproc
+.LFE207:
+	.size	write_checkpoint, .-write_checkpoint
+	.section	.text.startup,"ax",@progbits
+	.p2align 4
+	.globl	main
+	.type	main, @function
+main:
+.LFB219:
+	.cfi_startproc
+	pushq	%r13	# 53	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 16
+	.cfi_offset 13, -16
+	movl	$11112, %edx	# 15	[c=4 l=5]  *movdi_internal/2
+	pushq	%r12	# 54	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 24
+	.cfi_offset 12, -24
+	movq	%rsi, %r12	# 3	[c=4 l=3]  *movdi_internal/3
+	xorl	%esi, %esi	# 74	[c=4 l=2]  *movdi_xor
+	pushq	%rbp	# 55	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 32
+	.cfi_offset 6, -32
+	movl	%edi, %ebp	# 2	[c=4 l=2]  *movsi_internal/0
+	pushq	%rbx	# 56	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 40
+	.cfi_offset 3, -40
+	leaq	cx.2(%rip), %rbx	# 12	[c=1 l=7]  *movdi_internal/4
+	movq	%rbx, %rdi	# 17	[c=4 l=3]  *movdi_internal/3
+	subq	$24, %rsp	# 57	[c=4 l=4]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_def_cfa_offset 64
+	movq	stderr(%rip), %r13	# 7	[c=6 l=7]  *movdi_internal/3
+	movq	stdin(%rip), %xmm0	# 48	[c=6 l=9]  *movdi_internal/14
+	movhps	stdout(%rip), %xmm0	# 10	[c=4 l=7]  vec_concatv2di/7
+	movaps	%xmm0, (%rsp)	# 51	[c=4 l=4]  movv2di_internal/3
+	call	memset@PLT	# 18	[c=10 l=5]  *call_value
+	movdqa	(%rsp), %xmm0	# 52	[c=9 l=5]  movv2di_internal/2
+	leaq	100(%rbx), %rax	# 23	[c=4 l=4]  *leadi
+	movq	%rbx, %rdi	# 31	[c=4 l=3]  *movdi_internal/3
+	movq	%r13, 912+cx.2(%rip)	# 29	[c=4 l=7]  *movdi_internal/5
+	movq	%rax, 104+cx.2(%rip)	# 50	[c=4 l=7]  *movdi_internal/5
+	movl	$-1, 10896+cx.2(%rip)	# 25	[c=4 l=10]  *movsi_internal/1
+	movaps	%xmm0, 896+cx.2(%rip)	# 27	[c=4 l=7]  movv2di_internal/3
+	call	events_init@PLT	# 32	[c=0 l=5]  *call
+	addq	$24, %rsp	# 68	[c=4 l=4]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_def_cfa_offset 40
+	movq	%r12, %rdx	# 33	[c=4 l=3]  *movdi_internal/3
+	movl	%ebp, %esi	# 34	[c=4 l=2]  *movsi_internal/0
+	movq	%rbx, %rdi	# 36	[c=4 l=3]  *movdi_internal/3
+	popq	%rbx	# 69	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 32
+	popq	%rbp	# 70	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 24
+	popq	%r12	# 71	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 16
+	popq	%r13	# 72	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 8
+	jmp	run_context	# 37	[c=10 l=5]  *sibcall_value
+	.cfi_endproc
+.LFE219:
+	.size	main, .-main
+	.section	.rodata.str1.1
+.LC76:
+	.string	"%s: out of memory\n"
+	.text
+	.p2align 4
+	.globl	job_main
+	.type	job_main, @function
+job_main:
+.LFB220:
+	.cfi_startproc
+	pushq	%r15	# 70	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	movq	%rdx, %r15	# 4	[c=4 l=3]  *movdi_internal/3
+	pushq	%r14	# 71	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	movq	%rcx, %r14	# 5	[c=4 l=3]  *movdi_internal/3
+	pushq	%r13	# 72	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	movq	%r9, %r13	# 7	[c=4 l=3]  *movdi_internal/3
+	pushq	%r12	# 73	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	movq	%r8, %r12	# 6	[c=4 l=3]  *movdi_internal/3
+	pushq	%rbp	# 74	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	movq	%rsi, %rbp	# 3	[c=4 l=3]  *movdi_internal/3
+	movl	$1, %esi	# 12	[c=4 l=5]  *movdi_internal/2
+	pushq	%rbx	# 75	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$24, %rsp	# 76	[c=4 l=4]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_def_cfa_offset 80
+	movl	%edi, 12(%rsp)	# 2	[c=4 l=4]  *movsi_internal/1
+	movl	$11112, %edi	# 13	[c=4 l=5]  *movdi_internal/2
+	call	calloc@PLT	# 14	[c=10 l=5]  *call_value
+	testq	%rax, %rax	# 17	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L1754	# 18	[c=13 l=2]  *jcc
+	movq	%rax, %rbx	# 87	[c=4 l=3]  *movdi_internal/3
+	leaq	100(%rax), %rax	# 69	[c=4 l=4]  *leadi
+	movl	$0, 0(%r13)	# 30	[c=4 l=8]  *movsi_internal/1
+	pxor	%xmm0, %xmm0	# 31	[c=4 l=4]  movv2di_internal/0
+	movq	%rax, 104(%rbx)	# 35	[c=4 l=4]  *movdi_internal/5
+	movq	%rbx, %rdi	# 40	[c=4 l=3]  *movdi_internal/3
+	movq	$0, 24(%r13)	# 33	[c=4 l=8]  *movdi_internal/5
+	movl	$-1, 10896(%rbx)	# 36	[c=4 l=10]  *movsi_internal/1
+	movq	%r15, 896(%rbx)	# 37	[c=4 l=7]  *movdi_internal/5
+	movq	%r14, 904(%rbx)	# 38	[c=4 l=7]  *movdi_internal/5
+	movq	%r12, 912(%rbx)	# 39	[c=4 l=7]  *movdi_internal/5
+	movups	%xmm0, 8(%r13)	# 32	[c=4 l=5]  movv2di_internal/3
+	call	events_init@PLT	# 41	[c=0 l=5]  *call
+	movl	12(%rsp), %esi	# 44	[c=9 l=4]  *movsi_internal/0
+	movq	%rbp, %rdx	# 43	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rdi	# 45	[c=4 l=3]  *movdi_internal/3
+	movq	%r13, 11016(%rbx)	# 42	[c=4 l=7]  *movdi_internal/5
+	call	run_context	# 46	[c=10 l=5]  *call_value
+	movq	%rbx, %rdi	# 48	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, %ebp	# 47	[c=4 l=2]  *movsi_internal/0
+	call	free@PLT	# 49	[c=0 l=5]  *call
+.L1750:
+	addq	$24, %rsp	# 79	[c=4 l=4]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	movl	%ebp, %eax	# 55	[c=4 l=2]  *movsi_internal/0
+	popq	%rbx	# 80	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 48
+	popq	%rbp	# 81	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 40
+	popq	%r12	# 82	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 32
+	popq	%r13	# 83	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 24
+	popq	%r14	# 84	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 16
+	popq	%r15	# 85	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 8
+	ret		# 86	[c=0 l=1]  simple_return_internal
+.L1754:
+	.cfi_restore_state
+	movq	0(%rbp), %rdx	# 20	[c=5 l=4]  *movdi_internal/3
+	leaq	.LC76(%rip), %rsi	# 21	[c=1 l=7]  *movdi_internal/4
+	movq	%r12, %rdi	# 23	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 91	[c=4 l=2]  *movdi_xor
+	movl	$20, %ebp	# 9	[c=4 l=5]  *movsi_internal/0
+	call	fprintf@PLT	# 25	[c=10 l=5]  *call_value
+	jmp	.L1750	# 93	[c=1 l=2]  jump
+	.cfi_endproc
+.LFE220:
+	.size	job_main, .-job_main
+	.section	.rodata
+	.align 32
+	.type	CSWTCH.148, @object
+	.size	CSWTCH.148, 56
+CSWTCH.148:
+	.long	2
+	.long	1
+	.long	3
+	.long	4
+	.long	0
+	.long	0
+	.long	0
+	.long	0
+	.long	2
+	.long	2
+	.long	3
+	.long	4
+	.long	3
+	.long	4
+	.align 16
+	.type	se.0, @object
+	.size	se.0, 24
+se.0:
+	.value	83
+	.byte	1
+	.zero	1
+	.value	85
+	.byte	32
+	.zero	1
+	.value	85
+	.byte	64
+	.zero	1
+	.value	85
+	.byte	-128
+	.zero	1
+	.value	58
+	.byte	1
+	.zero	1
+	.value	72
+	.byte	1
+	.zero	1
+	.section	.data.rel.ro.local,"aw"
+	.align 32
+	.type	handler.1, @object
+	.size	handler.1, 896
+handler.1:
+	.quad	.L310
+	.quad	.L311
+	.quad	.L315
+	.quad	.L316
+	.quad	.L337
+	.quad	.L345
+	.quad	.L352
+	.quad	.L359
+	.quad	.L366
+	.quad	.L373
+	.quad	.L380
+	.quad	.L387
+	.quad	.L394
+	.quad	.L398
+	.quad	.L401
+	.quad	.L408
+	.quad	.L415
+	.quad	.L422
+	.quad	.L429
+	.quad	.L456
+	.quad	.L467
+	.quad	.L474
+	.quad	.L481
+	.quad	.L486
+	.quad	.L493
+	.quad	.L497
+	.quad	.L501
+	.quad	.L508
+	.quad	.L509
+	.quad	.L540
+	.quad	.L548
+	.quad	.L552
+	.quad	.L556
+	.quad	.L563
+	.quad	.L570
+	.quad	.L588
+	.quad	.L595
+	.quad	.L602
+	.quad	.L609
+	.quad	.L636
+	.quad	.L640
+	.quad	.L645
+	.quad	.L652
+	.quad	.L656
+	.quad	.L657
+	.quad	.L664
+	.quad	.L671
+	.quad	.L685
+	.quad	.L690
+	.quad	.L697
+	.quad	.L704
+	.quad	.L711
+	.quad	.L718
+	.quad	.L725
+	.quad	.L732
+	.quad	.L739
+	.quad	.L740
+	.quad	.L741
+	.quad	.L742
+	.quad	.L749
+	.quad	.L750
+	.quad	.L751
+	.quad	.L758
+	.quad	.L765
+	.quad	.L772
+	.quad	.L779
+	.quad	.L780
+	.quad	.L787
+	.quad	.L794
+	.quad	.L799
+	.quad	.L813
+	.quad	.L828
+	.quad	.L854
+	.quad	.L880
+	.quad	.L912
+	.quad	.L916
+	.quad	.L923
+	.quad	.L928
+	.quad	.L933
+	.quad	.L944
+	.quad	.L952
+	.quad	.L960
+	.quad	.L968
+	.quad	.L976
+	.quad	.L980
+	.quad	.L984
+	.quad	.L988
+	.quad	.L992
+	.quad	.L998
+	.quad	.L1013
+	.quad	.L1020
+	.quad	.L1027
+	.quad	.L1037
+	.quad	.L1042
+	.quad	.L1049
+	.quad	.L1056
+	.quad	.L1063
+	.quad	.L1070
+	.quad	.L1077
+	.quad	.L1084
+	.quad	.L1091
+	.quad	.L1098
+	.quad	.L1105
+	.quad	.L1106
+	.quad	.L1107
+	.quad	.L1114
+	.quad	.L1121
+	.quad	.L1128
+	.quad	.L1135
+	.quad	.L1147
+	.quad	.L1159
+	.quad	.L1171
+	.local	cx.2
+	.comm	cx.2,11112,32
+	.globl	opcodes
+	.section	.rodata.str1.1
+.LC77:
+	.string	"bad PC"
+.LC78:
+	.string	"ILLEGAL"
+.LC79:
+	.string	""
+.LC80:
+	.string	"*** SYSCALL"
+.LC81:
+	.string	"ADC"
+.LC82:
+	.string	"ADD"
+.LC83:
+	.string	"ADIW"
+.LC84:
+	.string	"SBIW"
+.LC85:
+	.string	"AND"
+.LC86:
+	.string	"ANDI"
+.LC87:
+	.string	"ASR"
+.LC88:
+	.string	"CL*"
+.LC89:
+	.string	"BLD.*"
+.LC90:
+	.string	"BREAK"
+.LC91:
+	.string	"BR*C"
+.LC92:
+	.string	"BR*S"
+.LC93:
+	.string	"SE*"
+.LC94:
+	.string	"BST.*"
+.LC95:
+	.string	"CALL"
+.LC96:
+	.string	"CBI.*"
+.LC97:
+	.string	"COM"
+.LC98:
+	.string	"CP"
+.LC99:
+	.string	"CPC"
+.LC100:
+	.string	"CPI"
+.LC101:
+	.string	"CPSE"
+.LC102:
+	.string	"DEC"
+.LC103:
+	.string	"DES"
+.LC104:
+	.string	"EICALL"
+.LC105:
+	.string	"EIJMP"
+.LC106:
+	.string	"ELPM"
+.LC107:
+	.string	"ELPM Z"
+.LC108:
+	.string	"ELPM Z+"
+.LC109:
+	.string	"EOR"
+.LC110:
+	.string	"ESPM"
+.LC111:
+	.string	"FMUL"
+.LC112:
+	.string	"FMULS"
+.LC113:
+	.string	"FMULSU"
+.LC114:
+	.string	"ICALL"
+.LC115:
+	.string	"IJMP"
+.LC116:
+	.string	"IN"
+.LC117:
+	.string	"INC"
+.LC118:
+	.string	"JMP"
+.LC119:
+	.string	"LDI"
+.LC120:
+	.string	"LDD Y+q"
+.LC121:
+	.string	"LDD Z+q"
+.LC122:
+	.string	"LDS"
+.LC123:
+	.string	"LD X"
+.LC124:
+	.string	"LD -X"
+.LC125:
+	.string	"LD X+"
+.LC126:
+	.string	"LD -Y"
+.LC127:
+	.string	"LD Y+"
+.LC128:
+	.string	"LD -Z"
+.LC129:
+	.string	"LD Z+"
+.LC130:
+	.string	"LPM"
+.LC131:
+	.string	"LPM Z"
+.LC132:
+	.string	"LPM Z+"
+.LC133:
+	.string	"LSR"
+.LC134:
+	.string	"MOV"
+.LC135:
+	.string	"MOVW"
+.LC136:
+	.string	"MUL"
+.LC137:
+	.string	"MULS"
+.LC138:
+	.string	"MULSU"
+.LC139:
+	.string	"NEG"
+.LC140:
+	.string	"NOP"
+.LC141:
+	.string	"OR"
+.LC142:
+	.string	"ORI"
+.LC143:
+	.string	"OUT"
+.LC144:
+	.string	"POP"
+.LC145:
+	.string	"PUSH"
+.LC146:
+	.string	"RCALL"
+.LC147:
+	.string	"RET"
+.LC148:
+	.string	"RETI"
+.LC149:
+	.string	"RJMP"
+.LC150:
+	.string	"ROR"
+.LC151:
+	.string	"SBC"
+.LC152:
+	.string	"SBCI"
+.LC153:
+	.string	"SBI.*"
+.LC154:
+	.string	"SBIC.*"
+.LC155:
+	.string	"SBIS.*"
+.LC156:
+	.string	"SBRC.*"
+.LC157:
+	.string	"SBRS.*"
+.LC158:
+	.string	"SLEEP"
+.LC159:
+	.string	"SPM"
+.LC160:
+	.string	"STD Y+q"
+.LC161:
+	.string	"STD Z+q"
+.LC162:
+	.string	"STS"
+.LC163:
+	.string	"ST X"
+.LC164:
+	.string	"ST -X"
+.LC165:
+	.string	"ST X+"
+.LC166:
+	.string	"ST -Y"
+.LC167:
+	.string	"ST Y+"
+.LC168:
+	.string	"ST -Z"
+.LC169:
+	.string	"ST Z+"
+.LC170:
+	.string	"SUB"
+.LC171:
+	.string	"SUBI"
+.LC172:
+	.string	"SWAP"
+.LC173:
+	.string	"WDR"
+.LC174:
+	.string	"CLR"
+.LC175:
+	.string	"LSL"
+.LC176:
+	.string	"ROL"
+.LC177:
+	.string	"TST"
+.LC178:
+	.string	"XCH"
+.LC179:
+	.string	"LAS"
+.LC180:
+	.string	"LAC"
+.LC181:
+	.string	"LAT"
+	.section	.data.rel.ro.local
+	.align 32
+	.type	opcodes, @object
+	.size	opcodes, 1792
+opcodes:
+	.quad	.LC77
+	.value	0
+	.value	0
+	.zero	4
+	.quad	.LC78
+	.value	0
+	.value	0
+	.zero	4
+	.quad	.LC79
+	.value	0
+	.value	0
+	.zero	4
+	.quad	.LC80
+	.value	2
+	.value	0
+	.zero	4
+	.quad	.LC81
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC82
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC83
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC84
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC85
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC86
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC87
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC88
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC89
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC90
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC91
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC92
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC93
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC94
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC95
+	.value	2
+	.value	4
+	.zero	4
+	.quad	.LC96
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC97
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC98
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC99
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC100
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC101
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC101
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC102
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC103
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC104
+	.value	1
+	.value	3
+	.zero	4
+	.quad	.LC105
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC106
+	.value	1
+	.value	3
+	.zero	4
+	.quad	.LC107
+	.value	1
+	.value	3
+	.zero	4
+	.quad	.LC108
+	.value	1
+	.value	3
+	.zero	4
+	.quad	.LC109
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC110
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC111
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC112
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC113
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC114
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC115
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC116
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC117
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC118
+	.value	2
+	.value	3
+	.zero	4
+	.quad	.LC119
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC120
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC121
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC122
+	.value	2
+	.value	3
+	.zero	4
+	.quad	.LC122
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC123
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC124
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC125
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC126
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC127
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC128
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC129
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC130
+	.value	1
+	.value	3
+	.zero	4
+	.quad	.LC131
+	.value	1
+	.value	3
+	.zero	4
+	.quad	.LC132
+	.value	1
+	.value	3
+	.zero	4
+	.quad	.LC133
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC134
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC135
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC136
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC137
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC138
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC139
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC140
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC141
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC142
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC143
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC144
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC145
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC146
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC147
+	.value	1
+	.value	4
+	.zero	4
+	.quad	.LC148
+	.value	1
+	.value	4
+	.zero	4
+	.quad	.LC149
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC150
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC151
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC152
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC153
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC154
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC154
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC155
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC155
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC156
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC156
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC157
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC157
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC158
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC159
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC160
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC161
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC162
+	.value	2
+	.value	2
+	.zero	4
+	.quad	.LC162
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC163
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC164
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC165
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC166
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC167
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC168
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC169
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC170
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC171
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC172
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC173
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC174
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC175
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC176
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC177
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC178
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC179
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC180
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC181
+	.value	1
+	.value	1
+	.zero	4
+	.globl	named_sfr
+	.section	.rodata.str1.1
+.LC182:
+	.string	"SPL"
+.LC183:
+	.string	"SPH"
+.LC184:
+	.string	"RAMPZ"
+.LC185:
+	.string	"RAMPY"
+.LC186:
+	.string	"RAMPX"
+.LC187:
+	.string	"RAMPD"
+.LC188:
+	.string	"EIND"
+	.section	.data.rel.ro.local
+	.align 32
+	.type	named_sfr, @object
+	.size	named_sfr, 192
+named_sfr:
+	.long	61
+	.zero	4
+	.quad	.LC182
+	.long	0
+	.zero	4
+	.long	62
+	.zero	4
+	.quad	.LC183
+	.long	0
+	.zero	4
+	.long	59
+	.zero	4
+	.quad	.LC184
+	.long	0
+	.zero	4
+	.long	58
+	.zero	4
+	.quad	.LC185
+	.long	1
+	.zero	4
+	.long	57
+	.zero	4
+	.quad	.LC186
+	.long	1
+	.zero	4
+	.long	56
+	.zero	4
+	.quad	.LC187
+	.long	1
+	.zero	4
+	.long	60
+	.zero	4
+	.quad	.LC188
+	.long	2
+	.zero	4
+	.long	0
+	.zero	4
+	.quad	0
+	.long	0
+	.zero	4
+	.globl	addr_SPL
+	.section	.rodata
+	.align 4
+	.type	addr_SPL, @object
+	.size	addr_SPL, 4
+addr_SPL:
+	.long	61
+	.globl	addr_SREG
+	.align 4
+	.type	addr_SREG, @object
+	.size	addr_SREG, 4
+addr_SREG:
+	.long	63
+	.section	.rodata.str1.1
+.LC189:
+	.string	"EXIT"
+.LC190:
+	.string	"TIMEOUT"
+.LC191:
+	.string	"usage"
+.LC192:
+	.string	"memory"
+.LC193:
+	.string	"file i/o"
+.LC194:
+	.string	"FATAL ABORTED"
+.LC195:
+	.string	"fatal"
+	.section	.data.rel.ro.local
+	.align 32
+	.type	exit_status, @object
+	.size	exit_status, 216
+exit_status:
+	.quad	.LC189
+	.quad	0
+	.long	0
+	.long	-1
+	.quad	.LC0
+	.quad	0
+	.long	0
+	.long	1
+	.quad	.LC190
+	.quad	0
+	.long	0
+	.long	10
+	.quad	.LC0
+	.quad	0
+	.long	0
+	.long	11
+	.quad	.LC0
+	.quad	0
+	.long	0
+	.long	12
+	.quad	.LC0
+	.quad	.LC191
+	.long	1
+	.long	21
+	.quad	.LC0
+	.quad	.LC192
+	.long	1
+	.long	20
+	.quad	.LC0
+	.quad	.LC193
+	.long	1
+	.long	22
+	.quad	.LC194
+	.quad	.LC195
+	.long	1
+	.long	42
+	.globl	invalid_opcode
+	.section	.rodata
+	.align 4
+	.type	invalid_opcode, @object
+	.size	invalid_opcode, 4
+invalid_opcode:
+	.long	65535
+	.globl	io_base
+	.align 4
+	.type	io_base, @object
+	.size	io_base, 4
+io_base:
+	.zero	4
+	.globl	is_avrtest_log
+	.type	is_avrtest_log, @object
+	.size	is_avrtest_log, 1
+is_avrtest_log:
+	.byte	1
+	.globl	is_tiny
+	.type	is_tiny, @object
+	.size	is_tiny, 1
+is_tiny:
+	.zero	1
+	.globl	is_xmega
+	.type	is_xmega, @object
+	.size	is_xmega, 1
+is_xmega:
+	.byte	1
+	.align 32
+	.type	flag_update_table_logical, @object
+	.size	flag_update_table_logical, 256
+flag_update_table_logical:
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.ascii	"\024\024\024\024\024\024\024\024\024\024\024\024\024\024\024"
+	.ascii	"\024\024\024\024\024\024\024\024\024\024\024\024\024\024\024"
+	.ascii	"\024\024\024\024\024\024\024\024\024\024\024\024\024\024\024"
+	.ascii	"\024\024\024\024\024\024\024\024\024\024\024\024\024\024\024"
+	.ascii	"\024\024\024\024\024\024\024\024\024\024\024\024\024\024\024"
+	.ascii	"\024\024\024\024\024\024\024\024\024\024\024\024\024\024\024"
+	.ascii	"\024\024\024\024\024\024\024\024\024\024\024\024\024\024\024"
+	.ascii	"\024\024\024\024\024\024\024\024\024\024\024\024\024\024\024"
+	.ascii	"\024\024\024\024\024\024\024\024"
+	.section	.rodata.cst8,"aM",@progbits,8
+	.align 8
+.LC7:
+	.long	0
+	.long	1083129856
+	.align 8
+.LC8:
+	.long	-755914244
+	.long	1062232653
+	.align 8
+.LC9:
+	.long	1202590843
+	.long	1065646817
+	.align 8
+.LC10:
+	.long	0
+	.long	1079574528
+	.section	.rodata.cst2,"aM",@progbits,2
+	.align 2
+.LC50:
+	.byte	1
+	.byte	0
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
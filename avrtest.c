@@ -23,6 +23,7 @@
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <stddef.h>
 #include <string.h>
 #include <stdint.h>
 #include <inttypes.h>
@@ -33,6 +34,16 @@
 #include "options.h"
 #include "flag-tables.h"
 #include "sreg.h"
+#ifndef AVRTEST_LOG
+#include "jit.h"
+#endif
+#include "hle.h"
+#include "irq.h"
+#include "periph.h"
+#include "replay.h"
+#include "checkpoint.h"
+#include "fork-server.h"
+#include "server.h"
 
 // ---------------------------------------------------------------------------
 // register and port definitions
@@ -42,6 +53,14 @@
 #define SPL     (0x3D + IOBASE)
 #define EIND    (0x3C + IOBASE)
 #define RAMPZ   (0x3B + IOBASE)
+#define RAMPY   (0x3A + IOBASE)
+#define RAMPX   (0x39 + IOBASE)
+#define RAMPD   (0x38 + IOBASE)
+
+// SPM:  The control register of the ATmegas except ATmega64 and
+// ATmega128 which have it at 0x68, and NVM.CMD of the ATxmegas.
+#define SPMCSR  (0x37 + IOBASE)
+#define NVM_CMD 0x1CA
 
 // ----------------------------------------------------------------------------
 // information about program incarnation (avrtest_log, avrtest-xmega, ...)
@@ -53,33 +72,40 @@
 // is_avrtest_log : load-flash.c:load_elf()        load ELF symbols
 // is_xmega :       options.c:parse_args()         legal -mmcu=MCU
 
+// With AVRTEST_LEAN, this file is compiled a second time for avrtest_log,
+// but without AVRTEST_LOG:  The object only provides execute_lean(), the
+// same fast loop as in avrtest.  Everything else comes from the object
+// compiled with AVRTEST_LOG, cf. execute().
+
 #ifdef ISA_XMEGA
 #   define IOBASE  0
 #   define CX 1
-    const bool is_xmega = true;
-    const bool is_tiny  = false;
+#   define IS_XMEGA 1
+#   define IS_TINY  0
 #elif defined (ISA_TINY)
 #   define IOBASE  0
 #   define CX 0
-    const bool is_xmega = false;
-    const bool is_tiny  = true;
+#   define IS_XMEGA 0
+#   define IS_TINY  1
 #else
 #   define IOBASE  0x20
 #   define CX 0
-    const bool is_xmega = false;
-    const bool is_tiny  = false;
+#   define IS_XMEGA 0
+#   define IS_TINY  0
 #endif
 
-#ifdef AVRTEST_LOG
+#if defined AVRTEST_LOG || defined AVRTEST_LEAN
 #define IS_AVRTEST_LOG 1
 #else
 #define IS_AVRTEST_LOG 0
 #endif
 
+#ifndef AVRTEST_LEAN
+const bool is_xmega = IS_XMEGA == 1;
+const bool is_tiny = IS_TINY == 1;
 const bool is_avrtest_log = IS_AVRTEST_LOG == 1;
 const int io_base = IOBASE;
-
-bool have_syscall[32];
+#endif // AVRTEST_LEAN
 
 // ----------------------------------------------------------------------------
 // ports like EXIT_PORT used for application <-> simulator interactions 
@@ -87,37 +113,379 @@ bool have_syscall[32];
 #define IN_AVRTEST
 #include "avrtest.h"
 
+#ifndef AVRTEST_LEAN
 const unsigned invalid_opcode = AVRTEST_INVALID_OPCODE;
-
-
-// ----------------------------------------------------------------------------
-// holds simulator state and program information.
-
-program_t program;
+#endif
 
 
 // ---------------------------------------------------------------------------
-// vars that hold AVR states: PC, RAM and Flash
+// The simulator state lives in a context_t, cf. testavr.h, and all
+// functions get it by pointer.
 
-// Word address of current PC and offset into decoded_flash[].
-unsigned cpu_PC;
+// The register file.  Except for XMEGA and Tiny, the registers are the
+// first 32 bytes of RAM.
 
 #if defined ISA_XMEGA || defined ISA_TINY
-static byte cpu_reg[0x20];
+#define cpu_reg(cx) ((cx)->reg)
 #else
-#define cpu_reg cpu_data
+#define cpu_reg(cx) ((cx)->data)
 #endif /* XMEGA || TINY */
 
-// cpu_data is used to store registers (non-xmega, non-tiny), ioport values
-// and actual SRAM
-static byte cpu_data[MAX_RAM_SIZE];
-static byte cpu_eeprom[MAX_EEPROM_SIZE];
 
-// flash
-static byte cpu_flash[MAX_FLASH_SIZE];
-static decoded_t decoded_flash[MAX_FLASH_SIZE/2];
+// Where execute() is running with respect to basic blocks whose costs
+// have been accounted in advance.  Only used without logging.
+enum
+  {
+    BLOCK_NONE,
+    // Running an instruction of the block other than the last one.
+    BLOCK_BODY,
+    // Running the last instruction of the block.
+    BLOCK_LAST
+  };
 
 
+// ---------------------------------------------------------------------------
+// Superinstructions:  Sequences of instructions from avr-fuse.def that
+// execute() runs without an indirect jump in between.  Only used without
+// logging.
+
+#ifndef AVRTEST_LOG
+
+enum
+  {
+#define AVR_FUSE(ID1, ID2)                              \
+    FUSE_ ## ID1 ## _ ## ID2,
+#define AVR_FUSE3(ID1, ID2, ID3)                        \
+    FUSE_ ## ID1 ## _ ## ID2 ## _ ## ID3,
+#define AVR_FUSE4(ID1, ID2, ID3, ID4)                   \
+    FUSE_ ## ID1 ## _ ## ID2 ## _ ## ID3 ## _ ## ID4,
+#include "avr-fuse.def"
+#undef AVR_FUSE
+#undef AVR_FUSE3
+#undef AVR_FUSE4
+    FUSE_N
+  };
+
+// The longest superinstruction.
+#define FUSE_MAX 4
+
+static const struct
+{
+  int n_insns;
+  byte id[FUSE_MAX];
+  const char *name;
+} fuse_seq[] =
+  {
+#define AVR_FUSE(ID1, ID2)                                      \
+    [FUSE_ ## ID1 ## _ ## ID2] =                                \
+    { 2, { ID_ ## ID1, ID_ ## ID2 }, #ID1 " + " #ID2 },
+#define AVR_FUSE3(ID1, ID2, ID3)                                \
+    [FUSE_ ## ID1 ## _ ## ID2 ## _ ## ID3] =                    \
+    { 3, { ID_ ## ID1, ID_ ## ID2, ID_ ## ID3 },                \
+      #ID1 " + " #ID2 " + " #ID3 },
+#define AVR_FUSE4(ID1, ID2, ID3, ID4)                           \
+    [FUSE_ ## ID1 ## _ ## ID2 ## _ ## ID3 ## _ ## ID4] =        \
+    { 4, { ID_ ## ID1, ID_ ## ID2, ID_ ## ID3, ID_ ## ID4 },    \
+      #ID1 " + " #ID2 " + " #ID3 " + " #ID4 },
+#include "avr-fuse.def"
+#undef AVR_FUSE
+#undef AVR_FUSE3
+#undef AVR_FUSE4
+  };
+
+// Store the IDs of the instructions from D on to ID[], but at most N of
+// them.  They must be part of the same chunk of a basic block as
+// determined by decode_flash(), and only the last one may end the block.
+// Return how many there are.
+
+static int
+fuse_window (const context_t *cx, const decoded_t *d, byte *id, int n)
+{
+  int n_insns = 0;
+
+  if (d->block_insns == 0)
+    return 0;
+
+  for (;;)
+    {
+      id[n_insns++] = d->id;
+      if (n_insns == n
+          || opcode_ends_block (d->id))
+        return n_insns;
+
+      d += d->size;
+      if (d > cx->decoded + cx->pc_mask
+          || d->block_insns == 0)
+        return n_insns;
+    }
+}
+
+static int
+fuse_lookup (const context_t *cx, const decoded_t *d)
+{
+  byte id[FUSE_MAX];
+  int n_insns = fuse_window (cx, d, id, FUSE_MAX);
+  int kind = -1;
+
+  for (int k = 0; k < FUSE_N; k++)
+    if (fuse_seq[k].n_insns <= n_insns
+        && memcmp (fuse_seq[k].id, id, fuse_seq[k].n_insns) == 0
+        && (kind < 0 || fuse_seq[k].n_insns > fuse_seq[kind].n_insns))
+      kind = k;
+
+  return kind;
+}
+
+// Return the FUSE_<ID1>_<ID2>... of the longest superinstruction that
+// starts at D, or -1 if there is none.  Most instructions can't start
+// one, which is found out without a call.
+
+static INLINE int
+fuse_kind (const context_t *cx, const decoded_t *d)
+{
+  if (d->block_insns == 0
+      || opcode_ends_block (d->id))
+    return -1;
+
+  return fuse_lookup (cx, d);
+}
+
+
+#ifndef AVRTEST_LEAN
+
+// The IDs from avr-opcode.def as strings.
+static const char* const opcode_id[] =
+  {
+#define AVR_OPCODE(ID, N_WORDS, N_TICKS, NAME)  \
+    [ID_ ## ID] = #ID,
+#include "avr-opcode.def"
+#undef AVR_OPCODE
+  };
+
+// A sequence of instructions as found by -fuse-stats:  Its length and
+// IDs packed into one key, where it occurs and how often it has run.
+
+typedef struct
+{
+  qword key;
+  dword sites;
+  qword runs;
+} fuse_stat_t;
+
+// How many of the most executed sequences of each length to print.
+#define FUSE_TOP 16
+
+static qword
+fuse_key (const byte *id, int n_insns)
+{
+  qword key = n_insns;
+  for (int i = 0; i < n_insns; i++)
+    key = (key << 8) | id[i];
+  return key;
+}
+
+static int
+fuse_stat_cmp (const void *a, const void *b)
+{
+  const fuse_stat_t *s1 = (const fuse_stat_t*) a;
+  const fuse_stat_t *s2 = (const fuse_stat_t*) b;
+  int n1 = s1->key >> (8 * FUSE_MAX);
+  int n2 = s2->key >> (8 * FUSE_MAX);
+
+  if (n1 != n2)
+    return n1 - n2;
+  return s1->runs < s2->runs ? 1 : s1->runs > s2->runs ? -1 : 0;
+}
+
+// Print the sequences of 2 to FUSE_MAX instructions that have run most
+// often, no matter whether they are in avr-fuse.def.  They are collected
+// in a hash table indexed by their keys.
+
+static void
+print_fuse_candidates (context_t *cx)
+{
+  unsigned n_hot = 0, size = 16;
+  for (unsigned i = 0; i <= cx->pc_mask; i++)
+    n_hot += cx->fuse_runs[i] != 0;
+  while (size < 2 * (FUSE_MAX - 1) * n_hot)
+    size *= 2;
+
+  fuse_stat_t *stat = get_mem (cx, size, sizeof (fuse_stat_t),
+                               "-fuse-stats");
+
+  for (unsigned i = 0; i <= cx->pc_mask; i++)
+    {
+      byte id[FUSE_MAX];
+      int n_insns = cx->fuse_runs[i]
+        ? fuse_window (cx, & cx->decoded[i], id, FUSE_MAX)
+        : 0;
+
+      for (int n = 2; n <= n_insns; n++)
+        {
+          // Padded so that the lengths are in the same bits.
+          qword key = fuse_key (id, n) << (8 * (FUSE_MAX - n));
+          unsigned h = (unsigned) ((key * 0x9e3779b97f4a7c15ull) >> 32);
+          while (stat[h &= size - 1].key && stat[h].key != key)
+            h++;
+          stat[h].key = key;
+          stat[h].sites++;
+          stat[h].runs += cx->fuse_runs[i];
+        }
+    }
+
+  unsigned n_stats = 0;
+  for (unsigned h = 0; h < size; h++)
+    if (stat[h].key)
+      stat[n_stats++] = stat[h];
+  qsort (stat, n_stats, sizeof (fuse_stat_t), fuse_stat_cmp);
+
+  fprintf (cx->out, "\n%-44s %9s %12s  %12s\n", "most executed sequence",
+           "sites", "executed", "instructions");
+
+  for (unsigned j = 0, top = 0; j < n_stats; j++)
+    {
+      int n_insns = stat[j].key >> (8 * FUSE_MAX);
+      if (j > 0 && n_insns != (int) (stat[j - 1].key >> (8 * FUSE_MAX)))
+        top = 0;
+      if (top++ >= FUSE_TOP)
+        continue;
+
+      char name[FUSE_MAX * 20] = "";
+      for (int i = 0; i < n_insns; i++)
+        {
+          int id = (stat[j].key >> (8 * (FUSE_MAX - 1 - i))) & 0xff;
+          if (i)
+            strcat (name, " + ");
+          strcat (name, opcode_id[id]);
+        }
+      fprintf (cx->out, "%-44s %9u %12"PRIu64"  %11.2f%%\n", name,
+               stat[j].sites, stat[j].runs, cx->program.n_insns
+               ? 100. * n_insns * stat[j].runs / cx->program.n_insns
+               : 0.0);
+    }
+
+  put_mem (cx, stat);
+}
+
+static void
+print_fuse_stats (context_t *cx)
+{
+  dword sites[FUSE_N] = { 0 };
+  qword runs[FUSE_N] = { 0 };
+
+  if (!cx->fuse_runs)
+    return;
+
+  for (unsigned i = 0; i <= cx->pc_mask; i++)
+    {
+      int k = fuse_kind (cx, & cx->decoded[i]);
+      if (k >= 0)
+        {
+          sites[k]++;
+          runs[k] += cx->fuse_runs[i];
+        }
+    }
+
+  fprintf (cx->out, "%-44s %9s %12s  %12s\n", "superinstruction", "sites",
+           "executed", "instructions");
+
+  for (int k = 0; k < FUSE_N; k++)
+    if (sites[k])
+      fprintf (cx->out, "%-44s %9u %12"PRIu64"  %11.2f%%\n",
+               fuse_seq[k].name, sites[k], runs[k], cx->program.n_insns
+               ? 100. * fuse_seq[k].n_insns * runs[k] / cx->program.n_insns
+               : 0.0);
+
+  print_fuse_candidates (cx);
+}
+#endif // AVRTEST_LEAN
+
+#endif // AVRTEST_LOG
+
+
+// ---------------------------------------------------------------------------
+// Delay loops:  Countdown loops like the ones from _delay_ms() or
+// __builtin_avr_delay_cycles() do nothing but decrement a counter until
+// it is zero.  execute() runs all rounds but the last one in one go.
+// Only used without logging.
+
+#ifndef AVRTEST_LOG
+
+// Longest delay loop that is recognized, in instructions.
+#define MAX_DELAY_INSNS 16
+
+// Return the size in bytes of the counter if a delay loop starts at D,
+// and 0 otherwise.  Set *REGNO to the counter's low register.
+// A delay loop is a basic block that ends in a BRNE back to D.  Its
+// other instructions are NOPs and exactly one of
+//
+//     DEC  Rn
+//     SBIW Rn, 1
+//     SUBI Rn, 1  followed by  SBCI Rn+1, 0 ... SBCI Rn+k, 0
+//
+// Each round then only depends on the value of the counter, and running
+// K rounds amounts to subtracting K from the counter.
+
+static int
+delay_loop (const decoded_t *d, int *regno)
+{
+  const decoded_t *di = d;
+  int n_bytes = 0;
+  bool sbci_ok = false;
+
+  for (int n_insns = 1; n_insns <= MAX_DELAY_INSNS; n_insns++)
+    {
+      switch (di->id)
+        {
+        default:
+          return 0;
+
+        case ID_NOP:
+          break;
+
+        case ID_DEC:
+        case ID_SBIW:
+        case ID_SUBI:
+          if (n_bytes
+              || (di->id != ID_DEC && di->op2 != 1))
+            return 0;
+          *regno = di->op1;
+          n_bytes = di->id == ID_SBIW ? 2 : 1;
+          sbci_ok = di->id == ID_SUBI;
+          break;
+
+        case ID_SBCI:
+          if (!sbci_ok
+              || di->op2 != 0
+              || di->op1 != *regno + n_bytes)
+            return 0;
+          n_bytes++;
+          break;
+
+        case ID_BRBC:
+          if (!n_bytes
+              || di->op2 != FLAG_Z
+              || di + 1 + (int8_t) di->op1 != d
+              || d->block_insns != n_insns)
+            return 0;
+#ifdef ISA_TINY
+          if (*regno < 16)
+            return 0;
+#endif
+          return n_bytes;
+        }
+
+      di += di->size;
+    }
+
+  return 0;
+}
+
+#endif // AVRTEST_LOG
+
+
+#ifndef AVRTEST_LEAN
+
 // ---------------------------------------------------------------------------
 // Exit stati as used with leave()
 
@@ -142,6 +510,7 @@ static const exit_status_t exit_status[] =
     [LEAVE_ABORTED] = { "ABORTED", NULL, EXIT_SUCCESS, EXIT_FAILURE },
     [LEAVE_TIMEOUT] = { "TIMEOUT", NULL, EXIT_SUCCESS, 10 },
     [LEAVE_FILE]    = { "ABORTED", NULL, EXIT_SUCCESS, 11 },
+    [LEAVE_DEADLOCK] = { "ABORTED", NULL, EXIT_SUCCESS, 12 },
     // Something went badly wrong
     [LEAVE_MEMORY]  = { "ABORTED", "memory",      EXIT_FAILURE, 20 },
     [LEAVE_USAGE]   = { "ABORTED", "usage",       EXIT_FAILURE, 21 },
@@ -151,10 +520,7 @@ static const exit_status_t exit_status[] =
 
 
 // ---------------------------------------------------------------------------
-// vars used with -runtime to measure avrtest performance
-
-static struct timeval t_start, t_decode, t_execute, t_load;
-
+// -runtime:  Measure avrtest performance by the cx->t_* time stamps.
 
 static void
 time_sub (unsigned long *s, unsigned long *us, double *ms,
@@ -177,111 +543,212 @@ time_sub (unsigned long *s, unsigned long *us, double *ms,
 
 
 static void
-print_runtime (void)
+print_runtime (context_t *cx)
 {
-  const program_t *p = &program;
+  const program_t *p = &cx->program;
   struct timeval t_end;
   unsigned long r_sec, e_sec, d_sec, l_sec, r_us, e_us, d_us, l_us;
   double r_ms, e_ms, d_ms, l_ms;
 
   gettimeofday (&t_end, NULL);
-  time_sub (&r_sec, &r_us, &r_ms, &t_end, &t_start);
-  time_sub (&e_sec, &e_us, &e_ms, &t_end, &t_execute);
-  time_sub (&d_sec, &d_us, &d_ms, &t_execute, &t_decode);
-  time_sub (&l_sec, &l_us, &l_ms, &t_decode, &t_load);
+  time_sub (&r_sec, &r_us, &r_ms, &t_end, &cx->t_start);
+  time_sub (&e_sec, &e_us, &e_ms, &t_end, &cx->t_execute);
+  time_sub (&d_sec, &d_us, &d_ms, &cx->t_execute, &cx->t_decode);
+  time_sub (&l_sec, &l_us, &l_ms, &cx->t_decode, &cx->t_load);
 
-  printf ("        load: %lu:%02lu.%06lu  = %3lu.%03lu sec  ="
-          " %6.2f%%,  %10.3f        bytes/ms, 0x%05x = %u bytes\n",
-          l_sec/60, l_sec%60, l_us, l_sec, l_us/1000,
-          r_ms > 0.01 ? 100.*l_ms/r_ms : 0.0,
-          l_ms > 0.01 ? p->n_bytes/l_ms : 0.0, p->n_bytes, p->n_bytes);
+  fprintf (cx->out, "        load: %lu:%02lu.%06lu  = %3lu.%03lu sec  ="
+           " %6.2f%%,  %10.3f        bytes/ms, 0x%05x = %u bytes\n",
+           l_sec/60, l_sec%60, l_us, l_sec, l_us/1000,
+           r_ms > 0.01 ? 100.*l_ms/r_ms : 0.0,
+           l_ms > 0.01 ? p->n_bytes/l_ms : 0.0, p->n_bytes, p->n_bytes);
 
   unsigned n_decoded = p->code_end - p->code_start + 1;
-  printf ("      decode: %lu:%02lu.%06lu  = %3lu.%03lu sec  ="
-          " %6.2f%%,  %10.3f        bytes/ms, 0x%05x = %u bytes\n",
-          d_sec/60, d_sec%60, d_us, d_sec, d_us/1000,
-          r_ms > 0.01 ? 100.*d_ms/r_ms : 0.0,
-          d_ms > 0.01 ? n_decoded/d_ms : 0.0, n_decoded, n_decoded);
+  fprintf (cx->out, "      decode: %lu:%02lu.%06lu  = %3lu.%03lu sec  ="
+           " %6.2f%%,  %10.3f        bytes/ms, 0x%05x = %u bytes\n",
+           d_sec/60, d_sec%60, d_us, d_sec, d_us/1000,
+           r_ms > 0.01 ? 100.*d_ms/r_ms : 0.0,
+           d_ms > 0.01 ? n_decoded/d_ms : 0.0, n_decoded, n_decoded);
 
-  printf ("     execute: %lu:%02lu.%06lu  = %3lu.%03lu sec  ="
-          " %6.2f%%,  %10.3f instructions/ms\n",
-          e_sec/60, e_sec%60, e_us, e_sec, e_us/1000,
-          r_ms > 0.01 ? 100.*e_ms/r_ms : 0.0,
-          e_ms > 0.01 ? p->n_insns/e_ms : 0.0);
+  fprintf (cx->out, "     execute: %lu:%02lu.%06lu  = %3lu.%03lu sec  ="
+           " %6.2f%%,  %10.3f instructions/ms\n",
+           e_sec/60, e_sec%60, e_us, e_sec, e_us/1000,
+           r_ms > 0.01 ? 100.*e_ms/r_ms : 0.0,
+           e_ms > 0.01 ? p->n_insns/e_ms : 0.0);
 
-  printf (" avrtest run: %lu:%02lu.%06lu  = %3lu.%03lu sec  ="
-          " %6.2f%%,  %10.3f instructions/ms\n",
-          r_sec/60, r_sec%60, r_us, r_sec, r_us/1000, 100.,
-          r_ms > 0.01 ? p->n_insns/r_ms : 0.0);
+  fprintf (cx->out, " avrtest run: %lu:%02lu.%06lu  = %3lu.%03lu sec  ="
+           " %6.2f%%,  %10.3f instructions/ms\n",
+           r_sec/60, r_sec%60, r_us, r_sec, r_us/1000, 100.,
+           r_ms > 0.01 ? p->n_insns/r_ms : 0.0);
 }
 
 
 // Skip any output if -q (quiet) is on
-void qprintf (const char *fmt, ...)
+void qprintf (const context_t *cx, const char *fmt, ...)
 {
-  if (!options.do_quiet)
+  if (!cx->options.do_quiet)
     {
       va_list args;
       va_start (args, fmt);
-      vprintf (fmt, args);
+      vfprintf (cx->out, fmt, args);
       va_end (args);
     }
 }
 
 
+// We are leaving from inside a basic block.  Take back the costs of
+// the instructions that did not run so that the totals are the same as
+// if each instruction was accounted on its own:  The current instruction
+// is accounted for its cycles, but not as executed.
+
+static void
+unaccount_block (context_t *cx)
+{
+  cx->program.n_insns--;
+
+  if (cx->in_block == BLOCK_BODY)
+    {
+      // cx->pc is already the address of the next instruction.
+      const decoded_t *d = & cx->decoded[cx->pc];
+      cx->program.n_insns -= d->block_insns;
+      cx->program.n_cycles -= d->block_cycles;
+    }
+}
+
+
+// -status=FILE:  Write the exit value CODE, the cycles, the instructions
+// and the exit status as reported by leave() to FILE as one line.
+
+static void
+write_status (const context_t *cx, int code)
+{
+  const program_t *program = & cx->program;
+  FILE *f = fopen (cx->options.s_status, "w");
+  if (!f)
+    {
+      fprintf (cx->err, "%s: cannot write -status=%s\n", cx->options.self,
+               cx->options.s_status);
+      return;
+    }
+
+  fprintf (f, "%d %" PRIu64 " %" PRIu64 " %s\n", code, program->n_cycles,
+           program->n_insns, program->exit_value
+           ? exit_status[LEAVE_ABORTED].text
+           : exit_status[program->leave_status].text);
+  fclose (f);
+}
+
+// -batch:  Tell the job runner the same as write_status().
+
+static void
+report_job (const context_t *cx, int code)
+{
+  const program_t *program = & cx->program;
+
+  cx->job->code = code;
+  cx->job->cycles = program->n_cycles;
+  cx->job->insns = program->n_insns;
+  cx->job->status = program->exit_value
+    ? exit_status[LEAVE_ABORTED].text
+    : exit_status[program->leave_status].text;
+}
+
+// End the current run with exit value CODE right away, e.g. after
+// -help:  Return to run_context().
+
+void NORETURN
+quit (context_t *cx, int code)
+{
+  cx->exit_code = code;
+  longjmp (*cx->on_leave, 1);
+}
+
+// Finish the current run with exit value CODE as reported by leave().
+
+static NORETURN void
+finish (context_t *cx, int code)
+{
+  if (cx->options.do_status)
+    write_status (cx, code);
+  if (cx->job)
+    report_job (cx, code);
+
+  quit (cx, code);
+}
+
+
 void NOINLINE NORETURN
-leave (int n, const char *reason, ...)
+leave (context_t *cx, int n, const char *reason, ...)
 {
   const exit_status_t *status = & exit_status[n];
   va_list args;
 
-  program.leave_status = n;
+  cx->program.leave_status = n;
+  if (cx->in_block != BLOCK_NONE)
+    unaccount_block (cx);
+  periph_finish (cx);
+  replay_finish (cx);
   // make sure we print the last log line before leaving
   if (EXIT_SUCCESS == status->failure)
-    log_dump_line (NULL);
+    log_dump_line (cx, NULL);
 
-  qprintf ("\n");
+  qprintf (cx, "\n");
 
-  if (options.do_runtime
+  if (cx->options.do_runtime
       && EXIT_SUCCESS == status->failure)
-    print_runtime();
+    print_runtime (cx);
 
-  if (!options.do_quiet)
+#ifndef AVRTEST_LOG
+  if (cx->options.do_fuse_stats
+      && EXIT_SUCCESS == status->failure)
+    print_fuse_stats (cx);
+
+  if ((cx->options.do_hle_verify
+       || (cx->options.do_hle && cx->options.do_verbose))
+      && EXIT_SUCCESS == status->failure)
+    hle_print_stats (cx);
+#endif
+
+  if (!cx->options.do_quiet)
     {
       va_start (args, reason);
 
-      printf (" exit status: %s\n"
-              "      reason: ", program.exit_value
-              ? exit_status[LEAVE_ABORTED].text
-              : status->text);
-      vprintf (reason, args);
-      printf ("\n"
-              "     program: %s\n",
-              program.name ? program.name : "-not set-");
+      fprintf (cx->out, " exit status: %s\n"
+               "      reason: ", cx->program.exit_value
+               ? exit_status[LEAVE_ABORTED].text
+               : status->text);
+      vfprintf (cx->out, reason, args);
+      fprintf (cx->out, "\n"
+               "     program: %s\n",
+               cx->program.name ? cx->program.name : "-not set-");
       if (EXIT_SUCCESS == status->failure)
         {
-          if (program.entry_point != 0)
-            printf (" entry point: %06x\n", program.entry_point);
-          printf ("exit address: %06x\n"
-                  "total cycles: %u\n"
-                  "total instr.: %u\n\n", cpu_PC * 2, program.n_cycles,
-                  program.n_insns);
+          if (cx->program.entry_point != 0)
+            fprintf (cx->out, " entry point: %06x\n",
+                     cx->program.entry_point);
+          fprintf (cx->out, "exit address: %06x\n"
+                   "total cycles: %"PRIu64"\n", cx->pc * 2,
+                   cx->program.n_cycles);
+          if (cx->program.n_sleep_cycles)
+            fprintf (cx->out, "      asleep: %"PRIu64"\n",
+                     cx->program.n_sleep_cycles);
+          fprintf (cx->out, "total instr.: %"PRIu64"\n\n",
+                   cx->program.n_insns);
         }
 
       va_end (args);
-      fflush (stdout);
+      fflush (cx->out);
 
-      exit (status->failure);
+      finish (cx, status->failure);
     }
 
-  fflush (stdout);
+  fflush (cx->out);
 
   if (status->failure != EXIT_SUCCESS)
     {
-      FILE *out = stderr;
+      FILE *out = cx->err;
       va_start (args, reason);
 
-      fprintf (out, "\n%s: %s error: ", options.self, status->kind);
+      fprintf (out, "\n%s: %s error: ", cx->options.self, status->kind);
       vfprintf (out, reason, args);
       fprintf (out, "\n");
       fflush (out);
@@ -289,41 +756,278 @@ leave (int n, const char *reason, ...)
       va_end (args);
     }
 
-  exit (n == LEAVE_EXIT ? program.exit_value : status->quiet_value);
+  finish (cx, n == LEAVE_EXIT ? cx->program.exit_value : status->quiet_value);
 }
 
+#endif // AVRTEST_LEAN
+
 // ----------------------------------------------------------------------------
 //     ioport / ram / flash, read / write entry points
 
-// Lowest level vanilla memory accessors, no logging.
+static NOINLINE NORETURN void
+bad_address (context_t *cx, int address)
+{
+  leave (cx, LEAVE_ABORTED, "access to unmapped RAM address 0x%x (RAMEND = "
+         "0x%04x)", address, cx->ram_end);
+}
+
+static INLINE int
+flash_read_byte (context_t *cx, int address)
+{
+  address &= 2 * cx->pc_mask + 1;
+  // add code here to handle special events
+  return cx->flash[address];
+}
+
+// The data space is mapped in pages of DATA_PAGE_SIZE bytes, and
+// cx->data_page[] tells what each page holds so that the accessors get
+// along with one table lookup for plain RAM.  The table spans 17 bits
+// so that word accesses and LDD beyond 0xffff, and -1 from pre-decrement,
+// still find an unmapped page.  Set up by map_pages().
+
+#define MAPPED_FLASH_START  0x4000
+#define MAPPED_EEPROM_START 0x1000
+
+enum
+  {
+    // Plain memory in cx->data[].
+    PAGE_RAM,
+    // SREG or I/O registers of peripherals from periph.c.
+    PAGE_IO,
+    // Reduced Tiny: flash as seen from LD at 0x4000.
+    PAGE_FLASH,
+    // XMEGA: EEPROM as seen from LD and ST at 0x1000.
+    PAGE_EEPROM,
+    // avrxmega7: External memory above RAMEND, cf. far_read().
+    PAGE_EXTERNAL,
+    // Nothing there, cf. bad_address().
+    PAGE_UNMAPPED
+  };
 
 static INLINE int
-data_read_byte_raw (int address)
+page_of (const context_t *cx, int address)
 {
-  return cpu_data[address];
+  // Most accesses go to the bulk of RAM; tell it without the table.
+  if ((unsigned) address - cx->plain_start < cx->plain_size)
+    return PAGE_RAM;
+  return cx->data_page[(address & DATA_ADDR_MASK) >> DATA_PAGE_SHIFT];
+}
+
+// avrxmega7:  The external memory in the 24-bit data space that RAMPX,
+// RAMPY, RAMPZ and RAMPD reach.  cx->far[] holds a page of FAR_PAGE_SIZE
+// bytes for each page that has been written so far, hence a program only
+// costs the memory it touches.  Pages that have never been written read
+// as 0.  Within the first 64 KiB, the external memory starts above RAMEND.
+
+static int
+far_read (const context_t *cx, int address)
+{
+  address &= FAR_ADDR_MASK;
+  const byte *page = cx->far[address >> FAR_PAGE_SHIFT];
+  return page ? page[address & (FAR_PAGE_SIZE - 1)] : 0;
+}
+
+static void
+far_write (context_t *cx, int address, int value)
+{
+  address &= FAR_ADDR_MASK;
+  byte **page = &cx->far[address >> FAR_PAGE_SHIFT];
+  if (! *page)
+    *page = get_mem (cx, FAR_PAGE_SIZE, sizeof (byte), "external memory");
+  (*page)[address & (FAR_PAGE_SIZE - 1)] = value;
+}
+
+// Accesses to pages that are neither RAM nor I/O.
+
+static NOINLINE int
+data_read_mapped (context_t *cx, int address)
+{
+  switch (page_of (cx, address))
+    {
+    case PAGE_FLASH:
+      return flash_read_byte (cx, address - MAPPED_FLASH_START);
+    case PAGE_EEPROM:
+      return cx->eeprom[address - MAPPED_EEPROM_START];
+    case PAGE_EXTERNAL:
+      return far_read (cx, address);
+    }
+  bad_address (cx, address);
+}
+
+static NOINLINE void
+data_write_mapped (context_t *cx, int address, int value)
+{
+  switch (page_of (cx, address))
+    {
+    case PAGE_EEPROM:
+      eeprom_write_mapped (cx, address - MAPPED_EEPROM_START, value);
+      break;
+    case PAGE_EXTERNAL:
+      far_write (cx, address, value);
+      break;
+    default:
+      bad_address (cx, address);
+    }
+}
+
+// Lowest level vanilla memory accessors, no logging.  I/O registers
+// are accessed as plain memory.
+
+static INLINE int
+data_read_byte_raw (context_t *cx, int address)
+{
+  if (page_of (cx, address) > PAGE_IO)
+    return data_read_mapped (cx, address);
+  return cx->data[address];
 }
 
 static INLINE void
-data_write_byte_raw (int address, int value)
+data_write_byte_raw (context_t *cx, int address, int value)
 {
-  cpu_data[address] = value;
+  if (page_of (cx, address) > PAGE_IO)
+    data_write_mapped (cx, address, value);
+  else
+    cx->data[address] = value;
 }
 
+// ----------------------------------------------------------------------------
+//     lazy flags
+
+// Without logging, instructions don't update SREG right away.  They only
+// record which flags they set and where to find the new values, which is
+// usually an entry of one of the flag_update_table_*[].  Instructions
+// that read flags like branches get them by sreg_value().
+// SREG itself is only updated by sreg_materialize() when SREG is accessed
+// as I/O or memory, when a SYSCALL runs, or when native code from -jit
+// runs.  Most of the time, the flags are overwritten by the next
+// instruction before anything but a branch reads them.
+// An eager update of cx->data[SREG] is a byte store that may alias
+// anything, hence the compiler has to reload the context after it.
+// Compared to eager updates, this is ~20% faster on bigbench and about
+// the same on long (-runtime, best of 7, interleaved).
+
+// The current value of SREG.
+
 static INLINE int
-flash_read_byte (int address)
+sreg_value (context_t *cx)
 {
-  address &= arch.flash_addr_mask;
-  // add code here to handle special events
-  return cpu_flash[address];
+#ifdef AVRTEST_LOG
+  return cx->data[SREG];
+#else
+  return ((cx->data[SREG] & ~cx->lazy_flags)
+          | (*cx->lazy_value & cx->lazy_flags));
+#endif
+}
+
+static INLINE void
+sreg_materialize (context_t *cx)
+{
+#ifndef AVRTEST_LOG
+  if (cx->lazy_flags)
+    {
+      cx->data[SREG] = sreg_value (cx);
+      cx->lazy_flags = 0;
+    }
+#endif
+}
+
+// The cycle count at the end of the current instruction.  Without
+// logging, the costs of a whole basic block are accounted when it is
+// entered, hence take back the ones of the instructions still to come.
+
+static INLINE qword
+cycles_now (context_t *cx)
+{
+#ifndef AVRTEST_LOG
+  if (cx->in_block == BLOCK_BODY)
+    return cx->program.n_cycles - cx->decoded[cx->pc].block_cycles;
+#endif
+  return cx->program.n_cycles;
+}
+
+// The number of instructions retired before the current one, like the
+// INDEX of -record.  With logging, the current instruction is accounted
+// after it ran.  Without, it already is, together with its block.
+
+static INLINE qword
+insns_now (context_t *cx)
+{
+#ifdef AVRTEST_LOG
+  return cx->program.n_insns;
+#else
+  if (cx->in_block == BLOCK_BODY)
+    return cx->program.n_insns - cx->decoded[cx->pc].block_insns - 1;
+  return cx->program.n_insns - 1;
+#endif
+}
+
+// Whether ADDRESS belongs to a peripheral from periph.c, and whether
+// it is a flag register whose bits are cleared by writing ones.
+
+static INLINE bool
+is_periph (const context_t *cx, int address)
+{
+  return (unsigned) address < cx->periph_end && cx->periph_hook[address];
+}
+
+static INLINE bool
+is_periph_w1c (const context_t *cx, int address)
+{
+  return is_periph (cx, address) && (cx->periph_hook[address] & PERIPH_W1C);
+}
+
+// Accesses to pages other than RAM as of instructions:  SREG must be
+// up to date, peripherals see the cycle of the access, and LD from
+// the flash of Reduced Tiny takes one more cycle.
+
+static int
+data_read_page (context_t *cx, int address)
+{
+  switch (page_of (cx, address))
+    {
+    case PAGE_IO:
+      if (address == SREG)
+        sreg_materialize (cx);
+      if (is_periph (cx, address))
+        return periph_read (cx, address, cycles_now (cx));
+      if ((unsigned) address > cx->ram_end)
+        bad_address (cx, address);
+      return cx->data[address];
+    case PAGE_FLASH:
+      log_append (cx, "{F:%04x} ", address - MAPPED_FLASH_START);
+      cx->program.n_cycles++;
+      break;
+    }
+  return data_read_mapped (cx, address);
+}
+
+static void
+data_write_page (context_t *cx, int address, int value)
+{
+  if (page_of (cx, address) != PAGE_IO)
+    data_write_mapped (cx, address, value);
+  else if (address == SREG)
+    {
+      sreg_materialize (cx);
+      cx->data[SREG] = value;
+    }
+  else if (is_periph (cx, address))
+    periph_write (cx, address, value, cycles_now (cx));
+  else if ((unsigned) address > cx->ram_end)
+    bad_address (cx, address);
+  else
+    cx->data[address] = value;
 }
 
 // Memory accessors with logging.
 
 static INLINE int
-data_read_byte (int address)
+data_read_byte (context_t *cx, int address)
 {
-  int ret = cpu_data[address];
-  log_add_data_mov (address == SREG ? "(SREG)->'%s' " : "(%s)->%02x ",
+  int ret = page_of (cx, address) == PAGE_RAM
+    ? cx->data[address]
+    : data_read_page (cx, address);
+  log_add_data_mov (cx, address == SREG ? "(SREG)->'%s' " : "(%s)->%02x ",
                     address, ret);
   return ret;
 }
@@ -331,174 +1035,303 @@ data_read_byte (int address)
 // write a byte to memory / ioport / register
 
 static INLINE void
-data_write_byte (int address, int value)
+data_write_byte (context_t *cx, int address, int value)
 {
-  log_add_data_mov (address == SREG ? "(SREG)<-'%s' " : "(%s)<-%02x ",
+  log_add_data_mov (cx, address == SREG ? "(SREG)<-'%s' " : "(%s)<-%02x ",
                     address, value & 0xff);
-  cpu_data[address] = value;
+  if (page_of (cx, address) == PAGE_RAM)
+    cx->data[address] = value;
+  else
+    data_write_page (cx, address, value);
 }
 
 // get_reg / put_reg are just placeholders for read/write calls where we can
 // be sure that the adress is < 32
 
 static INLINE byte
-get_reg (int regno)
+get_reg (context_t *cx, int regno)
 {
-  log_append ("(R%d)->%02x ", regno, cpu_reg[regno]);
+  log_append (cx, "(R%d)->%02x ", regno, cpu_reg (cx)[regno]);
 #ifdef ISA_TINY
   if (regno < 16)
-    leave (LEAVE_ABORTED, "illegal tiny register R%d", regno);
+    leave (cx, LEAVE_ABORTED, "illegal tiny register R%d", regno);
 #endif
-  return cpu_reg[regno];
+  return cpu_reg (cx)[regno];
 }
 
 static INLINE void
-put_reg (int regno, byte value)
+put_reg (context_t *cx, int regno, byte value)
 {
-  log_append ("(R%d)<-%02x ", regno, value);
+  log_append (cx, "(R%d)<-%02x ", regno, value);
 #ifdef ISA_TINY
   if (regno < 16)
-    leave (LEAVE_ABORTED, "illegal tiny register R%d", regno);
+    leave (cx, LEAVE_ABORTED, "illegal tiny register R%d", regno);
 #endif
-  cpu_reg[regno] = value;
+  cpu_reg (cx)[regno] = value;
 }
 
 static INLINE int
-get_word_reg_raw (int regno)
+get_word_reg_raw (context_t *cx, int regno)
 {
-  return cpu_reg[regno] | (cpu_reg[regno + 1] << 8);
+  return cpu_reg (cx)[regno] | (cpu_reg (cx)[regno + 1] << 8);
 }
 
 static INLINE int
-get_word_reg (int regno)
+get_word_reg (context_t *cx, int regno)
 {
-  int ret = get_word_reg_raw (regno);
-  log_append ("(R%d)->%04x ", regno, ret);
+  int ret = get_word_reg_raw (cx, regno);
+  log_append (cx, "(R%d)->%04x ", regno, ret);
   return ret;
 }
 
 static INLINE void
-put_word_reg (int regno, int value)
+put_word_reg (context_t *cx, int regno, int value)
 {
-  log_append ("(R%d)<-%04x ", regno, value & 0xFFFF);
-  cpu_reg[regno] = value;
-  cpu_reg[regno + 1] = value >> 8;
+  log_append (cx, "(R%d)<-%04x ", regno, value & 0xFFFF);
+  cpu_reg (cx)[regno] = value;
+  cpu_reg (cx)[regno + 1] = value >> 8;
 }
 
 // read a word from memory / ioport / register
 
 static INLINE int
-data_read_word (int address)
+data_read_word (context_t *cx, int address)
 {
-  int ret = (data_read_byte_raw (address)
-             | (data_read_byte_raw (address + 1) << 8));
-  log_add_data_mov ("(%s)->%04x ", address, ret);
+  int ret = (data_read_byte_raw (cx, address)
+             | (data_read_byte_raw (cx, address + 1) << 8));
+  log_add_data_mov (cx, "(%s)->%04x ", address, ret);
   return ret;
 }
 
 // write a word to memory / ioport / register
 
 static INLINE void
-data_write_word (int address, int value)
+data_write_word (context_t *cx, int address, int value)
 {
   value &= 0xffff;
-  log_add_data_mov ("(%s)<-%04x ", address, value);
-  data_write_byte_raw (address, value & 0xFF);
-  data_write_byte_raw (address + 1, value >> 8);
+  log_add_data_mov (cx, "(%s)<-%04x ", address, value);
+  data_write_byte_raw (cx, address, value & 0xFF);
+  data_write_byte_raw (cx, address + 1, value >> 8);
 }
 
+#ifndef AVRTEST_LEAN
+
 // ----------------------------------------------------------------------------
 // extern functions to make logging.c independent of ISA_XMEGA and ISA_TINY
 
 const int addr_SREG = SREG;
-byte* const pSP = cpu_data + SPL;
+const int addr_SPL = SPL;
 
 const sfr_t named_sfr[] =
   {
-    { SPL,   "SPL",   NULL },
-    { SPH,   "SPH",   NULL },
-    { RAMPZ, "RAMPZ", NULL },
-    { EIND,  "EIND",  &arch.has_eind },
-
-    { 0, NULL, NULL }
+    { SPL,   "SPL",   SFR_ALWAYS },
+    { SPH,   "SPH",   SFR_ALWAYS },
+    { RAMPZ, "RAMPZ", SFR_ALWAYS },
+    { RAMPY, "RAMPY", SFR_RAMPD },
+    { RAMPX, "RAMPX", SFR_RAMPD },
+    { RAMPD, "RAMPD", SFR_RAMPD },
+    { EIND,  "EIND",  SFR_EIND },
+
+    { 0, NULL, SFR_ALWAYS }
   };
   
-byte* log_cpu_address (int address, int where)
+byte* log_cpu_address (context_t *cx, int address, int where)
 {
   switch (where)
     {
-    case AR_REG:    return cpu_reg + address;
-    case AR_RAM:    return cpu_data + address;
-    case AR_FLASH:  return cpu_flash + address;
-    case AR_EEPROM: return cpu_eeprom + address;
+    case AR_REG:    return cpu_reg (cx) + address;
+    case AR_RAM:    return cx->data + address;
+    case AR_FLASH:  return cx->flash + address;
+    case AR_EEPROM: return cx->eeprom + address;
     }
-  leave (LEAVE_FATAL, "code must be unreachable");
+  leave (cx, LEAVE_FATAL, "code must be unreachable");
+}
+
+void set_elf_string_table (context_t *cx, char *stab, size_t size,
+                           int n_entries)
+{
+  cx->strtab = stab;
+  cx->strtab_size = size;
+  checkpoint_string_table (cx, stab, size, n_entries);
+  log_set_string_table (cx, stab, size, n_entries);
+#ifndef AVRTEST_LOG
+  hle_set_string_table (cx);
+#endif
+}
+
+void finish_elf_string_table (context_t *cx)
+{
+  log_finish_string_table (cx);
 }
 
-void set_elf_string_table (char *stab, size_t size, int n_entries)
+void set_elf_function_symbol (context_t *cx, int addr, size_t offset,
+                              bool is_func)
 {
-  log_set_string_table (stab, size, n_entries);
+  checkpoint_symbol (cx, addr, offset, is_func);
+  log_set_func_symbol (cx, addr, offset, is_func);
+  fork_server_set_function_symbol (cx, addr, offset);
+#ifndef AVRTEST_LOG
+  hle_set_function_symbol (cx, addr, offset);
+#endif
 }
 
-void finish_elf_string_table (void)
+// What get_mem() and get_file() hand out is kept on the list cx->held
+// until it is handed back by put_mem() resp. put_file(), or else by
+// free_context() when the run ends, no matter how leave() got there.
+
+struct held
+{
+  struct held *next, *prev;
+  // The file from get_file(), or NULL for the memory from get_mem()
+  // which follows in mem[], aligned like from calloc.
+  FILE *file;
+  long double mem[];
+};
+
+static void
+hold (context_t *cx, struct held *h)
 {
-  log_finish_string_table ();
+  h->prev = NULL;
+  h->next = cx->held;
+  if (cx->held)
+    cx->held->prev = h;
+  cx->held = h;
 }
 
-void set_elf_function_symbol (int addr, size_t offset, bool is_func)
+static void
+unhold (context_t *cx, struct held *h)
 {
-  log_set_func_symbol (addr, offset, is_func);
+  if (h->prev)
+    h->prev->next = h->next;
+  else
+    cx->held = h->next;
+  if (h->next)
+    h->next->prev = h->prev;
+  free (h);
 }
 
 // Memory allocation that never fails (never returns NULL).
 
-void* get_mem (unsigned n, size_t size, const char *purpose)
+void* get_mem (context_t *cx, unsigned n, size_t size, const char *purpose)
+{
+  struct held *h = NULL;
+  if (size == 0 || n <= (SIZE_MAX - sizeof (struct held)) / size)
+    h = calloc (1, sizeof (struct held) + n * size);
+  if (h == NULL)
+    leave (cx, LEAVE_MEMORY, "out of memory allocating %u * %u bytes for "
+           "%s", n, (unsigned) size, purpose);
+  hold (cx, h);
+  return h->mem;
+}
+
+// Hand back memory P from get_mem(), if any.
+
+void put_mem (context_t *cx, void *p)
+{
+  if (p)
+    unhold (cx, (struct held*) ((char*) p - offsetof (struct held, mem)));
+}
+
+// Like fopen(), but CX owns the file until put_file().
+
+FILE* get_file (context_t *cx, const char *name, const char *mode)
+{
+  FILE *f = fopen (name, mode);
+  if (!f)
+    return NULL;
+
+  struct held *h = calloc (1, sizeof (struct held));
+  if (h == NULL)
+    {
+      fclose (f);
+      leave (cx, LEAVE_MEMORY, "out of memory opening %s", name);
+    }
+  h->file = f;
+  hold (cx, h);
+  return f;
+}
+
+// Like fclose() for file F from get_file().
+
+int put_file (context_t *cx, FILE *f)
+{
+  for (struct held *h = cx->held; h; h = h->next)
+    if (h->file == f)
+      {
+        unhold (cx, h);
+        break;
+      }
+  return fclose (f);
+}
+
+#endif // AVRTEST_LEAN
+
+
+// ----------------------------------------------------------------------------
+//     flag manipulation functions
+
+// Read SREG for an instruction that uses flags.
+
+static INLINE int
+sreg_read (context_t *cx)
 {
 #ifdef AVRTEST_LOG
-  void *p = calloc (n, size);
-  if (p == NULL)
-    leave (LEAVE_MEMORY, "out of memory allocating %u bytes for %s",
-           (unsigned) (n * size), purpose);
-  return p;
+  return data_read_byte (cx, SREG);
 #else
-  leave (LEAVE_FATAL, "alloc_mem must be unreachable");
-  return NULL;
+  return sreg_value (cx);
 #endif
 }
 
+// Set the flags from FLAGS to the values from *P_VALUES, which is an
+// entry of one of the flag_update_table_*[].  Without logging, this is
+// done lazily.
 
-// ----------------------------------------------------------------------------
-//     flag manipulation functions
+static INLINE void
+update_flags_lazy (context_t *cx, int flags, const byte *p_values)
+{
+#ifdef AVRTEST_LOG
+  int sreg = data_read_byte (cx, SREG);
+  sreg = (sreg & ~flags) | *p_values;
+  data_write_byte (cx, SREG, sreg);
+#else
+  int keep = cx->lazy_flags & ~flags;
+  if (keep)
+    {
+      // Some of the lazy flags survive:  Merge them into a copy.
+      cx->lazy_copy = (*cx->lazy_value & keep) | *p_values;
+      cx->lazy_flags |= flags;
+      cx->lazy_value = & cx->lazy_copy;
+      return;
+    }
+  cx->lazy_flags = flags;
+  cx->lazy_value = p_values;
+#endif
+}
 
 static INLINE void
-update_flags (int flags, int new_values)
+update_flags (context_t *cx, int flags, int new_values)
 {
-  int sreg = data_read_byte (SREG);
+#ifdef AVRTEST_LOG
+  int sreg = data_read_byte (cx, SREG);
   sreg = (sreg & ~flags) | new_values;
-  data_write_byte (SREG, sreg);
+  data_write_byte (cx, SREG, sreg);
+#else
+  // The values are not from a table, hence use a copy.
+  int keep = cx->lazy_flags & ~flags;
+  cx->lazy_copy = (*cx->lazy_value & keep) | new_values;
+  cx->lazy_flags = keep | flags;
+  cx->lazy_value = & cx->lazy_copy;
+#endif
 }
 
 static INLINE int
-get_carry (void)
+get_carry (context_t *cx)
 {
-  return (data_read_byte_raw (SREG) & FLAG_C) != 0;
+  return (sreg_value (cx) & FLAG_C) != 0;
 }
 
 // fast flag update tables to avoid conditional branches on frequently
-// used operations
-static INLINE unsigned
-FUT_ADD_SUB_INDEX (unsigned v1, unsigned v2, unsigned res)
-{
-  /*   ((v1 & 0x08) << 9)
-     | ((v2 & 0x08) << 8)
-     | ((v1 & 0x80) << 3)
-     | ((v2 & 0x80) << 2)
-     | (res & 0x1FF) */
-  unsigned v = 2 * (v1 & 0x88) + (v2 & 0x88);
-  v *= 0x104;
-  return (res & 0x1ff) | (v & 0x1e00);
-}
-
+// used operations, cf. FUT_ADD_SUB_INDEX in testavr.h
 #define FUT_ADDSUB16_INDEX(v1, res)                             \
   (((((v1) >> 8) & 0x80) << 3) | (((res) >> 8) & 0x1FF))
 
@@ -506,263 +1339,489 @@ FUT_ADD_SUB_INDEX (unsigned v1, unsigned v2, unsigned res)
 //     helper functions
 
 static INLINE void
-add_program_cycles (dword cycles)
+add_program_cycles (context_t *cx, qword cycles)
 {
-  program.n_cycles += cycles;
+  cx->program.n_cycles += cycles;
 }
 
 
+// The stack must not grow below RAMSTART of the device.
+
+static NOINLINE NORETURN void
+stack_overflow (context_t *cx, int sp)
+{
+  leave (cx, LEAVE_ABORTED, "stack pointer overflow (SP = 0x%04x)", sp);
+}
+
 static INLINE void
-push_byte (int value)
+push_byte (context_t *cx, int value)
 {
-  int sp = data_read_word (SPL);
-  // temporary hack to disallow growing the stack over the reserved
-  // register area
-  if (sp < 0x40 + IOBASE)
-    leave (LEAVE_ABORTED, "stack pointer overflow (SP = 0x%04x)", sp);
-  data_write_byte (sp--, value);
-  data_write_word (SPL, sp);
+  int sp = data_read_word (cx, SPL);
+  if ((unsigned) sp < cx->ram_start)
+    stack_overflow (cx, sp);
+  data_write_byte (cx, sp--, value);
+  data_write_word (cx, SPL, sp);
 }
 
 static int
-pop_byte(void)
+pop_byte(context_t *cx)
 {
-  int sp = data_read_word (SPL);
-  data_write_word (SPL, ++sp);
-  return data_read_byte (sp);
+  int sp = data_read_word (cx, SPL);
+  data_write_word (cx, SPL, ++sp);
+  return data_read_byte (cx, sp);
 }
 
 static INLINE void
-push_PC (void)
+push_PC (context_t *cx)
 {
-  int sp = data_read_word (SPL);
-  // temporary hack to disallow growing the stack over the reserved
-  // register area
-  if (sp < 0x40 + IOBASE)
-    leave (LEAVE_ABORTED, "stack pointer overflow (SP = 0x%04x)", sp);
-  data_write_byte (sp--, cpu_PC);
-  data_write_byte (sp--, cpu_PC >> 8);
-  if (arch.pc_3bytes)
-    data_write_byte (sp--, cpu_PC >> 16);
-  data_write_word (SPL, sp);
+  int sp = data_read_word (cx, SPL);
+  if ((unsigned) sp < cx->ram_start + 1 + cx->arch.pc_3bytes)
+    stack_overflow (cx, sp);
+  data_write_byte (cx, sp--, cx->pc);
+  data_write_byte (cx, sp--, cx->pc >> 8);
+  if (cx->arch.pc_3bytes)
+    data_write_byte (cx, sp--, cx->pc >> 16);
+  data_write_word (cx, SPL, sp);
 }
 
 static NOINLINE NORETURN void
-bad_PC (unsigned pc)
+bad_PC (context_t *cx, unsigned pc)
 {
-  leave (LEAVE_ABORTED, "program counter 0x%x out of bounds "
-         "(0x%x--0x%x)", 2 * pc, program.code_start, program.code_end - 1);
+  leave (cx, LEAVE_ABORTED, "program counter 0x%x out of bounds "
+         "(0x%x--0x%x)", 2 * pc, cx->program.code_start,
+         cx->program.code_end - 1);
 }
 
 static INLINE void
-pop_PC (void)
+pop_PC (context_t *cx)
 {
   unsigned pc = 0;
-  int sp = data_read_word (SPL);
-  if (arch.pc_3bytes)
-    {
-      pc = data_read_byte (++sp) << 16;
-      if (pc >= MAX_FLASH_SIZE / 2)
-        {
-          pc |= data_read_byte (++sp) << 8;
-          pc |= data_read_byte (++sp);
-          bad_PC (pc);
-        }
-    }
-  pc |= data_read_byte (++sp) << 8;
-  pc |= data_read_byte (++sp);
-  data_write_word (SPL, sp);
-  cpu_PC = pc;
+  int sp = data_read_word (cx, SPL);
+  if (cx->arch.pc_3bytes)
+    pc = data_read_byte (cx, ++sp) << 16;
+  pc |= data_read_byte (cx, ++sp) << 8;
+  pc |= data_read_byte (cx, ++sp);
+  if (pc > cx->pc_mask)
+    bad_PC (cx, pc);
+  data_write_word (cx, SPL, sp);
+  cx->pc = pc;
 }
 
 
 // perform the addition and set the appropriate flags
 static INLINE void
-do_addition_8 (int rd, int rr, int carry)
+do_addition_8 (context_t *cx, int rd, int rr, int carry)
 {
-  int value1 = get_reg (rd);
-  int value2 = get_reg (rr);
+  int value1 = get_reg (cx, rd);
+  int value2 = get_reg (cx, rr);
   int result = value1 + value2 + carry;
-  put_reg (rd, result);
+  put_reg (cx, rd, result);
 
-  int sreg = flag_update_table_add8[FUT_ADD_SUB_INDEX (value1, value2, result)];
-  update_flags (FLAG_H | FLAG_S | FLAG_V | FLAG_N | FLAG_Z | FLAG_C, sreg);
+  const byte *p_sreg
+    = & flag_update_table_add8[FUT_ADD_SUB_INDEX (value1, value2, result)];
+  update_flags_lazy (cx, FLAG_H | FLAG_S | FLAG_V | FLAG_N | FLAG_Z | FLAG_C,
+                     p_sreg);
 }
 
 // perform the left shift and set the appropriate flags
 static INLINE void
-do_shift_8 (int rd, int carry)
+do_shift_8 (context_t *cx, int rd, int carry)
 {
-  int value = get_reg (rd);
+  int value = get_reg (cx, rd);
   int result = value + value + carry;
-  put_reg (rd, result);
+  put_reg (cx, rd, result);
 
-  int sreg = flag_update_table_add8[FUT_ADD_SUB_INDEX (value, value, result)];
-  update_flags (FLAG_H | FLAG_S | FLAG_V | FLAG_N | FLAG_Z | FLAG_C, sreg);
+  const byte *p_sreg
+    = & flag_update_table_add8[FUT_ADD_SUB_INDEX (value, value, result)];
+  update_flags_lazy (cx, FLAG_H | FLAG_S | FLAG_V | FLAG_N | FLAG_Z | FLAG_C,
+                     p_sreg);
 }
 
 // perform the subtraction and set the appropriate flags
 static INLINE void
-do_subtraction_8 (int rd, int value1, int value2, int carry,
+do_subtraction_8 (context_t *cx, int rd, int value1, int value2, int carry,
                   int use_carry, int writeback)
 {
   int result = value1 - value2 - carry;
   if (writeback)
-    put_reg (rd, result);
-  int sreg = flag_update_table_sub8[FUT_ADD_SUB_INDEX (value1, value2, result)];
-  unsigned flag = (data_read_byte_raw (SREG) | ~FLAG_Z) | (use_carry-1);
-  sreg &= flag;
-  update_flags (FLAG_H | FLAG_S | FLAG_V | FLAG_N | FLAG_Z | FLAG_C, sreg);
+    put_reg (cx, rd, result);
+  const byte *p_sreg
+    = & flag_update_table_sub8[FUT_ADD_SUB_INDEX (value1, value2, result)];
+  if (!use_carry)
+    {
+      update_flags_lazy (cx,
+                         FLAG_H | FLAG_S | FLAG_V | FLAG_N | FLAG_Z | FLAG_C,
+                         p_sreg);
+      return;
+    }
+  // Z is sticky:  It can only be cleared, not set.
+  int sreg = *p_sreg & (sreg_value (cx) | ~FLAG_Z);
+  update_flags (cx, FLAG_H | FLAG_S | FLAG_V | FLAG_N | FLAG_Z | FLAG_C, sreg);
 }
 
 static INLINE void
-store_logical_result (int rd, int result)
+store_logical_result (context_t *cx, int rd, int result)
 {
-  put_reg (rd, result);
-  update_flags (FLAG_S | FLAG_V | FLAG_N | FLAG_Z,
-                flag_update_table_logical[result]);
+  put_reg (cx, rd, result);
+  update_flags_lazy (cx, FLAG_S | FLAG_V | FLAG_N | FLAG_Z,
+                     & flag_update_table_logical[result]);
 }
 
-/* 10q0 qq0d dddd 1qqq | LDD */
+// avrxmega7:  Accessors for the 24-bit data space.  The first 64 KiB
+// are the same like for data_read_byte() and data_write_byte().
+
+static INLINE int
+data_read_far (context_t *cx, int address)
+{
+  address &= FAR_ADDR_MASK;
+  if (address <= 0xffff)
+    return data_read_byte (cx, address);
+
+  int ret = far_read (cx, address);
+  log_add_data_mov (cx, "(%s)->%02x ", address, ret);
+  return ret;
+}
 
 static INLINE void
-load_indirect (int rd, int r_addr, int adjust, int offset)
+data_write_far (context_t *cx, int address, int value)
+{
+  address &= FAR_ADDR_MASK;
+  if (address <= 0xffff)
+    data_write_byte (cx, address, value);
+  else
+    {
+      log_add_data_mov (cx, "(%s)<-%02x ", address, value & 0xff);
+      far_write (cx, address, value);
+    }
+}
+
+// Whether RAMPX, RAMPY or RAMPZ extend the pointers, which the routines
+// of -hle don't know about.
+
+static INLINE bool
+ramp_in_use (const context_t *cx)
+{
+#ifdef ISA_XMEGA
+  return cx->arch.has_rampd && (cx->data[RAMPX] | cx->data[RAMPY]
+                                | cx->data[RAMPZ]);
+#else
+  return false;
+#endif
+}
+
+#ifdef ISA_XMEGA
+// avrxmega7:  The high byte of a data address from RAMP register RAMP.
+// The RAMP registers share their page with SREG, hence bypass the slow
+// path of PAGE_IO.
+
+static INLINE int
+ramp_read (context_t *cx, int ramp)
+{
+  int ret = cx->data[ramp];
+  log_add_data_mov (cx, "(%s)->%02x ", ramp, ret);
+  return ret << 16;
+}
+
+// avrxmega7:  LD, LDD, ST and STD like load_indirect() and
+// store_indirect() below, but with RAMPX, RAMPY resp. RAMPZ as the high
+// byte of the pointer.  Pre-decrement and post-increment carry into it.
+
+static NOINLINE void
+ramp_indirect (context_t *cx, int rd, int r_addr, int adjust, int offset,
+               bool store)
 {
-  //TODO: use RAMPx registers to address more than 64kb of RAM
-  int addr = get_word_reg (r_addr);
+  int ramp = RAMPX + (r_addr - REGX) / 2;
+  int addr = get_word_reg (cx, r_addr) | ramp_read (cx, ramp);
+  int old = addr;
 
   if (adjust < 0)
     addr += adjust;
 
-#if !defined ISA_TINY
-  put_reg (rd, data_read_byte (addr + offset));
-#else
-  if (addr & 0x4000)
+  if (store)
+    data_write_far (cx, addr + offset, get_reg (cx, rd));
+  else
+    put_reg (cx, rd, data_read_far (cx, addr + offset));
+
+  if (adjust >= 0 && !offset)
+    add_program_cycles (cx, -1);
+
+  if (adjust > 0)
+    addr += adjust;
+  if (adjust)
+    put_word_reg (cx, r_addr, addr);
+  if ((addr ^ old) & ~0xffff)
+    data_write_byte (cx, ramp, addr >> 16);
+}
+#endif // ISA_XMEGA
+
+/* 10q0 qq0d dddd 1qqq | LDD */
+
+static INLINE void
+load_indirect (context_t *cx, int rd, int r_addr, int adjust, int offset)
+{
+#ifdef ISA_XMEGA
+  if (cx->arch.has_rampd)
     {
-      log_append ("{F:%04x} ", addr - 0x4000);
-      put_reg (rd, flash_read_byte (addr - 0x4000));
-      add_program_cycles (1);
+      ramp_indirect (cx, rd, r_addr, adjust, offset, false);
+      return;
     }
-  else
-    put_reg (rd, data_read_byte (addr));
 #endif
 
+  int addr = get_word_reg (cx, r_addr);
+
+  if (adjust < 0)
+    addr += adjust;
+
+  put_reg (cx, rd, data_read_byte (cx, addr + offset));
+
 #if defined ISA_XMEGA || defined ISA_TINY
   if (adjust >= 0 && !offset)
-    add_program_cycles (-1);
+    add_program_cycles (cx, -1);
 #endif
 
   if (adjust > 0)
     addr += adjust;
   if (adjust)
-    put_word_reg (r_addr, addr);
+    put_word_reg (cx, r_addr, addr);
 }
 
 static INLINE void 
-store_indirect (int rd, int r_addr, int adjust, int offset)
+store_indirect (context_t *cx, int rd, int r_addr, int adjust, int offset)
 {
-  //TODO: use RAMPx registers to address more than 64kb of RAM
-  int addr = get_word_reg (r_addr);
+#ifdef ISA_XMEGA
+  if (cx->arch.has_rampd)
+    {
+      ramp_indirect (cx, rd, r_addr, adjust, offset, true);
+      return;
+    }
+#endif
+
+  int addr = get_word_reg (cx, r_addr);
 
   if (adjust < 0)
     addr += adjust;
 
-  data_write_byte (addr + offset, get_reg (rd));
+  data_write_byte (cx, addr + offset, get_reg (cx, rd));
 
 #if defined ISA_XMEGA || defined ISA_TINY
   if (adjust >= 0 && !offset)
-    add_program_cycles (-1);
+    add_program_cycles (cx, -1);
 #endif
 
   if (adjust > 0)
     addr += adjust;
   if (adjust)
-    put_word_reg (r_addr, addr);
+    put_word_reg (cx, r_addr, addr);
 }
 
 static INLINE void
-load_program_memory (int rd, bool use_RAMPZ, bool incr)
+load_program_memory (context_t *cx, int rd, bool use_RAMPZ, bool incr)
 {
-  int address = get_word_reg (REGZ);
+  int address = get_word_reg (cx, REGZ);
   if (use_RAMPZ)
-    address |= data_read_byte (RAMPZ) << 16;
-  put_reg (rd, flash_read_byte (address));
+    address |= data_read_byte (cx, RAMPZ) << 16;
+  put_reg (cx, rd, flash_read_byte (cx, address));
   if (incr)
     {
       address++;
-      put_word_reg (REGZ, address & 0xFFFF);
+      put_word_reg (cx, REGZ, address & 0xFFFF);
       if (use_RAMPZ)
-        data_write_byte (RAMPZ, address >> 16);
+        data_write_byte (cx, RAMPZ, address >> 16);
+    }
+}
+
+// SPM:  Self-programming of the flash, page by page by means of the
+// temporary page buffer.  The operations take no time.  Like on the
+// device, writing a page can only clear bits of the flash, and it
+// empties the page buffer.
+
+enum
+  {
+    SPM_NONE, SPM_LOAD, SPM_ERASE, SPM_WRITE, SPM_ERASE_WRITE
+  };
+
+// The operation as selected by NVM.CMD or SPMCSR.  The ATmegas clear
+// SPMCSR when the operation is done.
+
+static int
+spm_operation (context_t *cx)
+{
+  if (is_xmega)
+    switch (data_read_byte (cx, NVM_CMD))
+      {
+      case 0x23:
+        return SPM_LOAD;
+      case 0x22: case 0x2A: case 0x2B:
+        return SPM_ERASE;
+      case 0x24: case 0x2C: case 0x2E:
+        return SPM_WRITE;
+      case 0x25: case 0x2D: case 0x2F:
+        return SPM_ERASE_WRITE;
+      default:
+        return SPM_NONE;
+      }
+
+  int csr = data_read_byte (cx, cx->spm_csr);
+  data_write_byte (cx, cx->spm_csr, csr & ~0x3f);
+  switch (csr & 0x3f)
+    {
+    case 0x01:
+      return SPM_LOAD;
+    case 0x03:
+      return SPM_ERASE;
+    case 0x05:
+      return SPM_WRITE;
+    default:
+      // RWWSRE, BLBSET and SIGRD have nothing to do.
+      return SPM_NONE;
+    }
+}
+
+// The flash bytes [LO, HI) have changed.  Decode them again, and have
+// execute() bind the entries whose handlers might have changed.  These
+// are the changed entries and the ones up to a basic block before them,
+// since delay_loop(), fuse_kind() and the JIT look ahead that far.
+
+static void
+flash_changed (context_t *cx, unsigned lo, unsigned hi)
+{
+  unsigned first = redecode_flash (cx, lo, hi);
+  unsigned last = hi / 2 + 2;
+
+  first = first > 2 * MAX_BLOCK_INSNS ? first - 2 * MAX_BLOCK_INSNS : 0;
+  if (last > cx->pc_mask + 1)
+    last = cx->pc_mask + 1;
+
+  if (cx->rebind_hi == 0)
+    {
+      cx->rebind_lo = first;
+      cx->rebind_hi = last;
+    }
+  else
+    {
+      cx->rebind_lo = first < cx->rebind_lo ? first : cx->rebind_lo;
+      cx->rebind_hi = last > cx->rebind_hi ? last : cx->rebind_hi;
+    }
+
+  if (cx->options.do_hle)
+    hle_forget (cx);
+}
+
+static INLINE void
+store_program_memory (context_t *cx, bool incr)
+{
+  int address = get_word_reg (cx, REGZ);
+  if (cx->device.flash_size > 0x10000)
+    address |= data_read_byte (cx, RAMPZ) << 16;
+
+  unsigned page_size = cx->spm_page;
+  unsigned page = (address & (2 * cx->pc_mask + 1)) & -page_size;
+  byte *flash = cx->flash + page;
+  byte *buf = cx->spm_buffer;
+
+  switch (spm_operation (cx))
+    {
+    case SPM_LOAD:
+      buf[address & (page_size - 2)] = get_reg (cx, 0);
+      buf[(address & (page_size - 2)) + 1] = get_reg (cx, 1);
+      break;
+
+    case SPM_ERASE:
+      log_append (cx, "{erase %05x} ", page);
+      memset (flash, 0xff, page_size);
+      flash_changed (cx, page, page + page_size);
+      break;
+
+    case SPM_ERASE_WRITE:
+      memset (flash, 0xff, page_size);
+      // Fallthrough
+    case SPM_WRITE:
+      log_append (cx, "{write %05x} ", page);
+      for (unsigned i = 0; i < page_size; i++)
+        flash[i] &= buf[i];
+      memset (buf, 0xff, page_size);
+      flash_changed (cx, page, page + page_size);
+      break;
+    }
+
+  if (incr)
+    {
+      address += 2;
+      put_word_reg (cx, REGZ, address & 0xFFFF);
+      if (cx->device.flash_size > 0x10000)
+        data_write_byte (cx, RAMPZ, address >> 16);
     }
 }
 
 static INLINE void
-skip_instruction_on_condition (bool condition, int words_to_skip)
+skip_instruction_on_condition (context_t *cx, bool condition,
+                               int words_to_skip)
 {
   if (condition)
     {
-      cpu_PC = (cpu_PC + words_to_skip) & PC_VALID_MASK;
-      add_program_cycles (words_to_skip);
+      cx->pc = (cx->pc + words_to_skip) & cx->pc_mask;
+      add_program_cycles (cx, words_to_skip);
     }
 }
 
 static INLINE void
-branch_on_sreg_condition (int rd, int rr, int flag_value)
+branch_on_sreg_condition (context_t *cx, int rd, int rr, int flag_value)
 {
-  int flag = data_read_byte (SREG) & rr;
-  log_add_flag_read (rr, flag);
+  int flag = sreg_read (cx) & rr;
+  log_add_flag_read (cx, rr, flag);
   if ((flag != 0) == flag_value)
     {
       int8_t delta = rd;
-      cpu_PC = (cpu_PC + delta) & PC_VALID_MASK;
-      add_program_cycles (1);
+      cx->pc = (cx->pc + delta) & cx->pc_mask;
+      add_program_cycles (cx, 1);
     }
 }
 
 static INLINE void
-rotate_right (int rd, int value, int top_bit /* 0 or 0x100 */)
+rotate_right (context_t *cx, int rd, int value, int top_bit /* 0 or 0x100 */)
 {
   value |= top_bit;
-  put_reg (rd, value >> 1);
+  put_reg (cx, rd, value >> 1);
 
-  update_flags (FLAG_S | FLAG_V | FLAG_N | FLAG_Z | FLAG_C,
-                flag_update_table_ror8[value]);
+  update_flags_lazy (cx, FLAG_S | FLAG_V | FLAG_N | FLAG_Z | FLAG_C,
+                     & flag_update_table_ror8[value]);
 }
 
 static INLINE void
-do_multiply (int rd, int rr, bool signed1, bool signed2, int shift)
+do_multiply (context_t *cx, int rd, int rr, bool signed1, bool signed2,
+             int shift)
 {
-  int v1 = signed1 ? ((int8_t) get_reg (rd)) : get_reg (rd);
-  int v2 = signed2 ? ((int8_t) get_reg (rr)) : get_reg (rr);
+  int v1 = signed1 ? ((int8_t) get_reg (cx, rd)) : get_reg (cx, rd);
+  int v2 = signed2 ? ((int8_t) get_reg (cx, rr)) : get_reg (cx, rr);
   int result = (v1 * v2) & 0xFFFF;
 
   int sreg = (result & 0x8000) >> (15 - FLAG_C_BIT);
   result <<= shift;
   sreg |= FLAG_Z & - (result == 0);
-  update_flags (FLAG_Z | FLAG_C, sreg);
-  put_word_reg (0, result);
+  update_flags (cx, FLAG_Z | FLAG_C, sreg);
+  put_word_reg (cx, 0, result);
 }
 
 // handle illegal opcodes
-static OP_FUNC_TYPE func_ILLEGAL (int ill, int size)
+static OP_FUNC_TYPE func_ILLEGAL (context_t *cx, int ill, int size)
 {
-  cpu_PC -= size;
-  byte *f = cpu_flash + 2 * cpu_PC;
+  cx->pc -= size;
+  byte *f = cx->flash + 2 * cx->pc;
   unsigned code = f[0] + (f[1] << 8);
 
-  log_append (".word 0x%04x", code);
+  log_append (cx, ".word 0x%04x", code);
   switch (ill)
     {
-    case IL_ILL:  leave (LEAVE_ABORTED, "illegal opcode 0x%04x", code);
-    case IL_ARCH: leave (LEAVE_ABORTED, "opcode 0x%04x illegal on %s",
-                         code, arch.name);
+    case IL_ILL:  leave (cx, LEAVE_ABORTED, "illegal opcode 0x%04x", code);
+    case IL_ARCH: leave (cx, LEAVE_ABORTED, "opcode 0x%04x illegal on %s",
+                         code, cx->arch.name);
     case IL_TODO:
-      program.leave_status = LEAVE_ABORTED;
-      log_dump_line (NULL);
-      leave (LEAVE_FATAL, "opcode 0x%04x not yet supported", code);
+      cx->program.leave_status = LEAVE_ABORTED;
+      log_dump_line (cx, NULL);
+      leave (cx, LEAVE_FATAL, "opcode 0x%04x not yet supported", code);
     }
 
-  leave (LEAVE_FATAL, "in func_ILLEGAL");
+  leave (cx, LEAVE_FATAL, "in func_ILLEGAL");
 }
 
 // ----------------------------------------------------------------------------
@@ -771,106 +1830,151 @@ static OP_FUNC_TYPE func_ILLEGAL (int ill, int size)
 /* opcodes with no operands */
 
 /* 1001 0101 1001 1000 | BREAK */
-static OP_FUNC_TYPE func_BREAK (int rd, int rr)
+static OP_FUNC_TYPE func_BREAK (context_t *cx, int rd, int rr)
 {
   // FIXME: Acts currently like NOP.  Do helpful feature here
 }
 
 /* 1001 0101 0001 1001 | EICALL */
-static OP_FUNC_TYPE func_EICALL (int rd, int rr)
+static OP_FUNC_TYPE func_EICALL (context_t *cx, int rd, int rr)
 {
-  if (!arch.has_eind)
-    func_ILLEGAL (IL_ARCH, 1);
+  if (!cx->arch.has_eind)
+    func_ILLEGAL (cx, IL_ARCH, 1);
 
-  push_PC();
-  cpu_PC = get_word_reg (REGZ) | (data_read_byte (EIND) << 16);
-  if (cpu_PC >= MAX_FLASH_SIZE / 2)
-    bad_PC (cpu_PC);
+  push_PC(cx);
+  cx->pc = get_word_reg (cx, REGZ) | (data_read_byte (cx, EIND) << 16);
+  if (cx->pc > cx->pc_mask)
+    bad_PC (cx, cx->pc);
 }
 
 /* 1001 0100 0001 1001 | EIJMP */
-static OP_FUNC_TYPE func_EIJMP (int rd, int rr)
+static OP_FUNC_TYPE func_EIJMP (context_t *cx, int rd, int rr)
 {
-  if (!arch.has_eind)
-    func_ILLEGAL (IL_ARCH, 1);
+  if (!cx->arch.has_eind)
+    func_ILLEGAL (cx, IL_ARCH, 1);
 
-  cpu_PC = get_word_reg (REGZ) | (data_read_byte (EIND) << 16);
-  if (cpu_PC >= MAX_FLASH_SIZE / 2)
-    bad_PC (cpu_PC);
+  cx->pc = get_word_reg (cx, REGZ) | (data_read_byte (cx, EIND) << 16);
+  if (cx->pc > cx->pc_mask)
+    bad_PC (cx, cx->pc);
 }
 
 /* 1001 0101 1101 1000 | ELPM */
-static OP_FUNC_TYPE func_ELPM (int rd, int rr)
+static OP_FUNC_TYPE func_ELPM (context_t *cx, int rd, int rr)
 {
-  load_program_memory (0, true, false);
+  load_program_memory (cx, 0, true, false);
 }
 
 /* 1001 0101 1111 1000 | ESPM */
-static OP_FUNC_TYPE func_ESPM (int rd, int rr)
+static OP_FUNC_TYPE func_ESPM (context_t *cx, int rd, int rr)
 {
-  func_ILLEGAL (IL_TODO, 1);
+  store_program_memory (cx, true);
 }
 
 /* 1001 0101 0000 1001 | ICALL */
-static OP_FUNC_TYPE func_ICALL (int rd, int rr)
+static OP_FUNC_TYPE func_ICALL (context_t *cx, int rd, int rr)
 {
-  push_PC();
-  cpu_PC = get_word_reg (REGZ);
-  add_program_cycles (arch.pc_3bytes);
+  push_PC(cx);
+  cx->pc = get_word_reg (cx, REGZ);
+  if (cx->pc > cx->pc_mask)
+    bad_PC (cx, cx->pc);
+  add_program_cycles (cx, cx->arch.pc_3bytes);
 }
 
 /* 1001 0100 0000 1001 | IJMP */
-static OP_FUNC_TYPE func_IJMP (int rd, int rr)
+static OP_FUNC_TYPE func_IJMP (context_t *cx, int rd, int rr)
 {
-  cpu_PC = get_word_reg (REGZ);
+  cx->pc = get_word_reg (cx, REGZ);
+  if (cx->pc > cx->pc_mask)
+    bad_PC (cx, cx->pc);
 }
 
 /* 1001 0101 1100 1000 | LPM */
-static OP_FUNC_TYPE func_LPM (int rd, int rr)
+static OP_FUNC_TYPE func_LPM (context_t *cx, int rd, int rr)
 {
-  load_program_memory (0, false, false);
+  load_program_memory (cx, 0, false, false);
 }
 
 /* 0000 0000 0000 0000 | NOP */
-static OP_FUNC_TYPE func_NOP (int rd, int rr)
+static OP_FUNC_TYPE func_NOP (context_t *cx, int rd, int rr)
 {
 }
 
 /* 1001 0101 0000 1000 | RET */
-static OP_FUNC_TYPE func_RET (int rd, int rr)
+static OP_FUNC_TYPE func_RET (context_t *cx, int rd, int rr)
 {
-  pop_PC();
-  add_program_cycles (arch.pc_3bytes);
+  pop_PC(cx);
+  add_program_cycles (cx, cx->arch.pc_3bytes);
 }
 
 /* 1001 0101 0001 1000 | RETI */
-static OP_FUNC_TYPE func_RETI (int rd, int rr)
+static OP_FUNC_TYPE func_RETI (context_t *cx, int rd, int rr)
+{
+  func_RET (cx, rd, rr);
+  update_flags (cx, FLAG_I, FLAG_I);
+  cx->reti_cycles = cx->program.n_cycles;
+}
+
+// Whether the sleep enable bit of the device is set, cf. avr-device.def.
+
+static bool
+sleep_enabled (const context_t *cx)
 {
-  func_RET (rd, rr);
-  update_flags (FLAG_I, FLAG_I);
+  static const struct
+  {
+    word addr;
+    byte mask;
+  } se[] =
+    {
+      [SE_SMCR]   = { 0x53, 1 << 0 },
+      [SE_MCUCR5] = { 0x55, 1 << 5 },
+      [SE_MCUCR6] = { 0x55, 1 << 6 },
+      [SE_MCUCR7] = { 0x55, 1 << 7 },
+      [SE_TINY]   = { 0x3a, 1 << 0 },
+      [SE_XMEGA]  = { 0x48, 1 << 0 }
+    };
+
+  return cx->data[se[cx->device.se].addr] & se[cx->device.se].mask;
 }
 
 /* 1001 0101 1000 1000 | SLEEP */
-static OP_FUNC_TYPE func_SLEEP (int rd, int rr)
+static OP_FUNC_TYPE func_SLEEP (context_t *cx, int rd, int rr)
 {
-  // we don't have anything to wake us up, so just pretend we wake
-  // up immediately
+  // Like on the device, SLEEP is a NOP while SE is clear.  Else skip the
+  // cycles until an interrupt is pending, which is then served at the
+  // end of this basic block.  Nothing can wake up the core if the I flag
+  // is off, or if no event is scheduled.
+  if (!sleep_enabled (cx))
+    return;
+
+  qword n_cycles = cx->program.n_cycles;
+
+  if (!(sreg_value (cx) & FLAG_I)
+      || !events_sleep (cx))
+    leave (cx, LEAVE_DEADLOCK, "deadlock: sleeping with no wake source");
+
+  n_cycles = cx->program.n_cycles - n_cycles;
+  cx->program.n_sleep_cycles += n_cycles;
+  log_append (cx, "slept %"PRIu64" cycles ", n_cycles);
 }
 
 /* 1001 0101 1110 1000 | SPM */
-static OP_FUNC_TYPE func_SPM (int rd, int rr)
+static OP_FUNC_TYPE func_SPM (context_t *cx, int rd, int rr)
 {
-  func_ILLEGAL (IL_TODO, 1);
+#ifdef ISA_TINY
+  func_ILLEGAL (cx, IL_TODO, 1);
+#else
+  store_program_memory (cx, false);
+#endif
 }
 
 /* 1001 0100 KKKK 1011 | DES */
-static OP_FUNC_TYPE func_DES (int rd, int rr)
+static OP_FUNC_TYPE func_DES (context_t *cx, int rd, int rr)
 {
-  func_ILLEGAL (IL_TODO, 1);
+  func_ILLEGAL (cx, IL_TODO, 1);
 }
 
 /* 1001 0101 1010 1000 | WDR */
-static OP_FUNC_TYPE func_WDR (int rd, int rr)
+static OP_FUNC_TYPE func_WDR (context_t *cx, int rd, int rr)
 {
   // we don't have a watchdog, so do nothing
 }
@@ -878,275 +1982,286 @@ static OP_FUNC_TYPE func_WDR (int rd, int rr)
 
 /* opcodes with two 5-bit register (Rd and Rr) operands */
 /* 0001 11rd dddd rrrr | ADC */
-static OP_FUNC_TYPE func_ADC (int rd, int rr)
+static OP_FUNC_TYPE func_ADC (context_t *cx, int rd, int rr)
 {
-  do_addition_8 (rd, rr, get_carry());
+  do_addition_8 (cx, rd, rr, get_carry(cx));
 }
 
 /* 0001 11rd dddd dddd | ROL */
-static OP_FUNC_TYPE func_ROL (int rd, int rr)
+static OP_FUNC_TYPE func_ROL (context_t *cx, int rd, int rr)
 {
-  do_shift_8 (rd, get_carry());
+  do_shift_8 (cx, rd, get_carry(cx));
 }
 
 /* 0000 11rd dddd rrrr | ADD */
-static OP_FUNC_TYPE func_ADD (int rd, int rr)
+static OP_FUNC_TYPE func_ADD (context_t *cx, int rd, int rr)
 {
-  do_addition_8 (rd, rr, 0);
+  do_addition_8 (cx, rd, rr, 0);
 }
 
 /* 0000 11rd dddd dddd | LSL */
-static OP_FUNC_TYPE func_LSL (int rd, int rr)
+static OP_FUNC_TYPE func_LSL (context_t *cx, int rd, int rr)
 {
-  do_shift_8 (rd, 0);
+  do_shift_8 (cx, rd, 0);
 }
 
 /* 0010 00rd dddd rrrr | AND or TST */
-static OP_FUNC_TYPE func_AND (int rd, int rr)
+static OP_FUNC_TYPE func_AND (context_t *cx, int rd, int rr)
 {
-  int r1 = get_reg (rd);
-  int r2 = get_reg (rr);
+  int r1 = get_reg (cx, rd);
+  int r2 = get_reg (cx, rr);
   int result = r1 & r2;
-  store_logical_result (rd, result);
+  store_logical_result (cx, rd, result);
 }
 
 /* 0010 00rd dddd dddd | TST */
-static OP_FUNC_TYPE func_TST (int rd, int rr)
+static OP_FUNC_TYPE func_TST (context_t *cx, int rd, int rr)
 {
-  int result = get_reg (rd);
-  update_flags (FLAG_S | FLAG_V | FLAG_N | FLAG_Z,
-                flag_update_table_logical[result]);
+  int result = get_reg (cx, rd);
+  update_flags_lazy (cx, FLAG_S | FLAG_V | FLAG_N | FLAG_Z,
+                     & flag_update_table_logical[result]);
 }
 
 /* 0001 01rd dddd rrrr | CP */
-static OP_FUNC_TYPE func_CP (int rd, int rr)
+static OP_FUNC_TYPE func_CP (context_t *cx, int rd, int rr)
 {
-  int r1 = get_reg (rd);
-  int r2 = get_reg (rr);
-  do_subtraction_8 (0, r1, r2, 0, 0, 0);
+  int r1 = get_reg (cx, rd);
+  int r2 = get_reg (cx, rr);
+  do_subtraction_8 (cx, 0, r1, r2, 0, 0, 0);
 }
 
 /* 0000 01rd dddd rrrr | CPC */
-static OP_FUNC_TYPE func_CPC (int rd, int rr)
+static OP_FUNC_TYPE func_CPC (context_t *cx, int rd, int rr)
 {
-  int r1 = get_reg (rd);
-  int r2 = get_reg (rr);
-  do_subtraction_8 (0, r1, r2, get_carry(), 1, 0);
+  int r1 = get_reg (cx, rd);
+  int r2 = get_reg (cx, rr);
+  do_subtraction_8 (cx, 0, r1, r2, get_carry(cx), 1, 0);
 }
 
 /* 0001 00rd dddd rrrr | CPSE skipping 1 word */
-static OP_FUNC_TYPE func_CPSE (int rd, int rr)
+static OP_FUNC_TYPE func_CPSE (context_t *cx, int rd, int rr)
 {
-  int r1 = get_reg (rd);
-  int r2 = get_reg (rr);
-  skip_instruction_on_condition (r1 == r2, 1);
+  int r1 = get_reg (cx, rd);
+  int r2 = get_reg (cx, rr);
+  skip_instruction_on_condition (cx, r1 == r2, 1);
 }
 
 /* 0001 00rd dddd rrrr | CPSE skipping 2 words */
-static OP_FUNC_TYPE func_CPSE2 (int rd, int rr)
+static OP_FUNC_TYPE func_CPSE2 (context_t *cx, int rd, int rr)
 {
-  int r1 = get_reg (rd);
-  int r2 = get_reg (rr);
-  skip_instruction_on_condition (r1 == r2, 2);
+  int r1 = get_reg (cx, rd);
+  int r2 = get_reg (cx, rr);
+  skip_instruction_on_condition (cx, r1 == r2, 2);
 }
 
 /* 0010 01rd dddd rrrr | EOR */
-static OP_FUNC_TYPE func_EOR (int rd, int rr)
+static OP_FUNC_TYPE func_EOR (context_t *cx, int rd, int rr)
 {
-  int r1 = get_reg (rd);
-  int r2 = get_reg (rr);
+  int r1 = get_reg (cx, rd);
+  int r2 = get_reg (cx, rr);
   int result = r1 ^ r2;
-  store_logical_result (rd, result);
+  store_logical_result (cx, rd, result);
 }
 
 /* 0010 01rd dddd rrrr | CLR */
-static OP_FUNC_TYPE func_CLR (int rd, int rr)
+static OP_FUNC_TYPE func_CLR (context_t *cx, int rd, int rr)
 {
-  store_logical_result (rd, 0);
+  store_logical_result (cx, rd, 0);
 }
 
 /* 0010 11rd dddd rrrr | MOV */
-static OP_FUNC_TYPE func_MOV (int rd, int rr)
+static OP_FUNC_TYPE func_MOV (context_t *cx, int rd, int rr)
 {
-  put_reg (rd, get_reg (rr));
+  put_reg (cx, rd, get_reg (cx, rr));
 }
 
 /* 1001 11rd dddd rrrr | MUL */
-static OP_FUNC_TYPE func_MUL (int rd, int rr)
+static OP_FUNC_TYPE func_MUL (context_t *cx, int rd, int rr)
 {
-  do_multiply (rd, rr, false, false, 0);
+  do_multiply (cx, rd, rr, false, false, 0);
 }
 
 /* 0010 10rd dddd rrrr | OR */
-static OP_FUNC_TYPE func_OR (int rd, int rr)
+static OP_FUNC_TYPE func_OR (context_t *cx, int rd, int rr)
 {
-  int r1 = get_reg (rd);
-  int r2 = get_reg (rr);
+  int r1 = get_reg (cx, rd);
+  int r2 = get_reg (cx, rr);
   int result = r1 | r2;
-  store_logical_result (rd, result);
+  store_logical_result (cx, rd, result);
 }
 
 /* 0000 10rd dddd rrrr | SBC */
-static OP_FUNC_TYPE func_SBC (int rd, int rr)
+static OP_FUNC_TYPE func_SBC (context_t *cx, int rd, int rr)
 {
-  int r1 = get_reg (rd);
-  int r2 = get_reg (rr);
-  do_subtraction_8 (rd, r1, r2, get_carry(), 1, 1);
+  int r1 = get_reg (cx, rd);
+  int r2 = get_reg (cx, rr);
+  do_subtraction_8 (cx, rd, r1, r2, get_carry(cx), 1, 1);
 }
 
 /* 0001 10rd dddd rrrr | SUB */
-static OP_FUNC_TYPE func_SUB (int rd, int rr)
+static OP_FUNC_TYPE func_SUB (context_t *cx, int rd, int rr)
 {
-  int r1 = get_reg (rd);
-  int r2 = get_reg (rr);
-  do_subtraction_8 (rd, r1, r2, 0, 0, 1);
+  int r1 = get_reg (cx, rd);
+  int r2 = get_reg (cx, rr);
+  do_subtraction_8 (cx, rd, r1, r2, 0, 0, 1);
 }
 
 
 /* opcode with a single register (Rd) as operand */
 /* 1001 010d dddd 0101 | ASR */
-static OP_FUNC_TYPE func_ASR (int rd, int rr)
+static OP_FUNC_TYPE func_ASR (context_t *cx, int rd, int rr)
 {
-  int value = (int8_t) get_reg (rd);
-  rotate_right (rd, value & 0x1ff, 0);
+  int value = (int8_t) get_reg (cx, rd);
+  rotate_right (cx, rd, value & 0x1ff, 0);
 }
 
 /* 1001 010d dddd 0000 | COM */
-static OP_FUNC_TYPE func_COM (int rd, int rr)
+static OP_FUNC_TYPE func_COM (context_t *cx, int rd, int rr)
 {
-  int result = 0xFF & ~get_reg (rd);
-  put_reg (rd, result);
-  update_flags (FLAG_S | FLAG_V | FLAG_N | FLAG_Z | FLAG_C,
+  int result = 0xFF & ~get_reg (cx, rd);
+  put_reg (cx, rd, result);
+  update_flags (cx, FLAG_S | FLAG_V | FLAG_N | FLAG_Z | FLAG_C,
                 flag_update_table_logical[result] | FLAG_C);
 }
 
 /* 1001 010d dddd 1010 | DEC */
-static OP_FUNC_TYPE func_DEC (int rd, int rr)
+static OP_FUNC_TYPE func_DEC (context_t *cx, int rd, int rr)
 {
-  int result = (get_reg (rd) - 1) & 0xFF;
-  put_reg (rd, result);
-  update_flags (FLAG_S | FLAG_V | FLAG_N | FLAG_Z,
-                flag_update_table_dec[result]);
+  int result = (get_reg (cx, rd) - 1) & 0xFF;
+  put_reg (cx, rd, result);
+  update_flags_lazy (cx, FLAG_S | FLAG_V | FLAG_N | FLAG_Z,
+                     & flag_update_table_dec[result]);
 }
 
 /* 1001 000d dddd 0110 | ELPM */
-static OP_FUNC_TYPE func_ELPM_Z (int rd, int rr)
+static OP_FUNC_TYPE func_ELPM_Z (context_t *cx, int rd, int rr)
 {
-  load_program_memory (rd, true, false);
+  load_program_memory (cx, rd, true, false);
 }
 
 /* 1001 000d dddd 0111 | ELPM */
-static OP_FUNC_TYPE func_ELPM_Z_incr (int rd, int rr)
+static OP_FUNC_TYPE func_ELPM_Z_incr (context_t *cx, int rd, int rr)
 {
-  load_program_memory (rd, true, true);
+  load_program_memory (cx, rd, true, true);
 }
 
 /* 1001 010d dddd 0011 | INC */
-static OP_FUNC_TYPE func_INC (int rd, int rr)
+static OP_FUNC_TYPE func_INC (context_t *cx, int rd, int rr)
 {
-  int result = (get_reg (rd) + 1) & 0xFF;
-  put_reg (rd, result);
-  update_flags (FLAG_S | FLAG_V | FLAG_N | FLAG_Z,
-                flag_update_table_inc[result]);
+  int result = (get_reg (cx, rd) + 1) & 0xFF;
+  put_reg (cx, rd, result);
+  update_flags_lazy (cx, FLAG_S | FLAG_V | FLAG_N | FLAG_Z,
+                     & flag_update_table_inc[result]);
 }
 
 /* 1001 000d dddd 0000 | LDS */
-static OP_FUNC_TYPE func_LDS (int rd, int rr)
+static OP_FUNC_TYPE func_LDS (context_t *cx, int rd, int rr)
 {
-  //TODO:RAMPD
-  put_reg (rd, data_read_byte (rr));
+#ifdef ISA_XMEGA
+  if (cx->arch.has_rampd)
+    {
+      rr |= ramp_read (cx, RAMPD);
+      put_reg (cx, rd, data_read_far (cx, rr));
+      return;
+    }
+#endif
+  put_reg (cx, rd, data_read_byte (cx, rr));
 }
 
 /* 1010 0kkk dddd kkkk | LDS (Tiny) */
-static OP_FUNC_TYPE func_LDS1 (int rd, int rr)
+static OP_FUNC_TYPE func_LDS1 (context_t *cx, int rd, int rr)
 {
-  put_reg (rd, data_read_byte (rr));
+  put_reg (cx, rd, data_read_byte (cx, rr));
 }
 
 /* 1001 000d dddd 1100 | LD */
-static OP_FUNC_TYPE func_LD_X (int rd, int rr)
+static OP_FUNC_TYPE func_LD_X (context_t *cx, int rd, int rr)
 {
-  load_indirect (rd, REGX, 0, 0);
+  load_indirect (cx, rd, REGX, 0, 0);
 }
 
 /* 1001 000d dddd 1110 | LD */
-static OP_FUNC_TYPE func_LD_X_decr (int rd, int rr)
+static OP_FUNC_TYPE func_LD_X_decr (context_t *cx, int rd, int rr)
 {
-  load_indirect (rd, REGX, -1, 0);
+  load_indirect (cx, rd, REGX, -1, 0);
 }
 
 /* 1001 000d dddd 1101 | LD */
-static OP_FUNC_TYPE func_LD_X_incr (int rd, int rr)
+static OP_FUNC_TYPE func_LD_X_incr (context_t *cx, int rd, int rr)
 {
-  load_indirect (rd, REGX, 1, 0);
+  load_indirect (cx, rd, REGX, 1, 0);
 }
 
 /* 1001 000d dddd 1010 | LD */
-static OP_FUNC_TYPE func_LD_Y_decr (int rd, int rr)
+static OP_FUNC_TYPE func_LD_Y_decr (context_t *cx, int rd, int rr)
 {
-  load_indirect (rd, REGY, -1, 0);
+  load_indirect (cx, rd, REGY, -1, 0);
 }
 
 /* 1001 000d dddd 1001 | LD */
-static OP_FUNC_TYPE func_LD_Y_incr (int rd, int rr)
+static OP_FUNC_TYPE func_LD_Y_incr (context_t *cx, int rd, int rr)
 {
-  load_indirect (rd, REGY, 1, 0);
+  load_indirect (cx, rd, REGY, 1, 0);
 }
 
 /* 1001 000d dddd 0010 | LD */
-static OP_FUNC_TYPE func_LD_Z_decr (int rd, int rr)
+static OP_FUNC_TYPE func_LD_Z_decr (context_t *cx, int rd, int rr)
 {
-  load_indirect (rd, REGZ, -1, 0);
+  load_indirect (cx, rd, REGZ, -1, 0);
 }
 
 /* 1001 000d dddd 0010 | LD */
-static OP_FUNC_TYPE func_LD_Z_incr (int rd, int rr)
+static OP_FUNC_TYPE func_LD_Z_incr (context_t *cx, int rd, int rr)
 {
-  load_indirect (rd, REGZ, 1, 0);
+  load_indirect (cx, rd, REGZ, 1, 0);
 }
 
 /* 1001 000d dddd 0100 | LPM Z */
-static OP_FUNC_TYPE func_LPM_Z (int rd, int rr)
+static OP_FUNC_TYPE func_LPM_Z (context_t *cx, int rd, int rr)
 {
-  load_program_memory (rd, false, false);
+  load_program_memory (cx, rd, false, false);
 }
 
 /* 1001 000d dddd 0101 | LPM Z+ */
-static OP_FUNC_TYPE func_LPM_Z_incr (int rd, int rr)
+static OP_FUNC_TYPE func_LPM_Z_incr (context_t *cx, int rd, int rr)
 {
-  load_program_memory (rd, false, true);
+  load_program_memory (cx, rd, false, true);
 }
 
 /* 1001 010d dddd 0110 | LSR */
-static OP_FUNC_TYPE func_LSR (int rd, int rr)
+static OP_FUNC_TYPE func_LSR (context_t *cx, int rd, int rr)
 {
-  rotate_right (rd, get_reg (rd), 0);
+  rotate_right (cx, rd, get_reg (cx, rd), 0);
 }
 
 /* 1001 010d dddd 0001 | NEG */
-static OP_FUNC_TYPE func_NEG (int rd, int rr)
+static OP_FUNC_TYPE func_NEG (context_t *cx, int rd, int rr)
 {
-  do_subtraction_8 (rd, 0, get_reg (rd), 0, 0, 1);
+  do_subtraction_8 (cx, rd, 0, get_reg (cx, rd), 0, 0, 1);
 }
 
 /* 1001 000d dddd 1111 | POP */
-static OP_FUNC_TYPE func_POP (int rd, int rr)
+static OP_FUNC_TYPE func_POP (context_t *cx, int rd, int rr)
 {
-  put_reg (rd, pop_byte());
+  put_reg (cx, rd, pop_byte(cx));
 }
 
 static INLINE void
-xmega_atomic (int regno, int op)
+xmega_atomic (context_t *cx, int regno, int op)
 {
 #ifndef ISA_XMEGA
-  func_ILLEGAL (IL_ARCH, 1);
+  func_ILLEGAL (cx, IL_ARCH, 1);
 #endif
 
-  int mask = get_reg (regno);
-  int address = get_word_reg (REGZ);
-  int val = data_read_byte (address);
+  int mask = get_reg (cx, regno);
+  int address = get_word_reg (cx, REGZ);
+#ifdef ISA_XMEGA
+  if (cx->arch.has_rampd)
+    address |= ramp_read (cx, RAMPZ);
+#endif
+  int val = data_read_far (cx, address);
 
-  put_reg (regno, val);
+  put_reg (cx, regno, val);
 
   switch (op)
     {
@@ -1156,248 +2271,259 @@ xmega_atomic (int regno, int op)
     case ID_LAT: val ^=  mask; break;
     }
 
-  data_write_byte (address, val);
+  data_write_far (cx, address, val);
 }
 
 /* 1001 001d dddd 0100 | XCH */
-static OP_FUNC_TYPE func_XCH (int rd, int rr)
+static OP_FUNC_TYPE func_XCH (context_t *cx, int rd, int rr)
 {
-  xmega_atomic (rd, ID_XCH);
+  xmega_atomic (cx, rd, ID_XCH);
 }
 
 /* 1001 001d dddd 0101 | LAS */
-static OP_FUNC_TYPE func_LAS (int rd, int rr)
+static OP_FUNC_TYPE func_LAS (context_t *cx, int rd, int rr)
 {
-  xmega_atomic (rd, ID_LAS);
+  xmega_atomic (cx, rd, ID_LAS);
 }
 
 /* 1001 001d dddd 0110 | LAC */
-static OP_FUNC_TYPE func_LAC (int rd, int rr)
+static OP_FUNC_TYPE func_LAC (context_t *cx, int rd, int rr)
 {
-  xmega_atomic (rd, ID_LAC);
+  xmega_atomic (cx, rd, ID_LAC);
 }
 
 /* 1001 001d dddd 0111 | LAT */
-static OP_FUNC_TYPE func_LAT (int rd, int rr)
+static OP_FUNC_TYPE func_LAT (context_t *cx, int rd, int rr)
 {
-  xmega_atomic (rd, ID_LAT);
+  xmega_atomic (cx, rd, ID_LAT);
 }
 
 /* 1001 001d dddd 1111 | PUSH */
-static OP_FUNC_TYPE func_PUSH (int rd, int rr)
+static OP_FUNC_TYPE func_PUSH (context_t *cx, int rd, int rr)
 {
-  push_byte (get_reg (rd));
+  push_byte (cx, get_reg (cx, rd));
 }
 
 /* 1001 010d dddd 0111 | ROR */
-static OP_FUNC_TYPE func_ROR (int rd, int rr)
+static OP_FUNC_TYPE func_ROR (context_t *cx, int rd, int rr)
 {
-  rotate_right (rd, get_reg (rd), get_carry() << 8);
+  rotate_right (cx, rd, get_reg (cx, rd), get_carry(cx) << 8);
 }
 
 /* 1001 001d dddd 0000 | STS */
-static OP_FUNC_TYPE func_STS (int rd, int rr)
+static OP_FUNC_TYPE func_STS (context_t *cx, int rd, int rr)
 {
-  //TODO:RAMPD
-  data_write_byte (rr, get_reg (rd));
+#ifdef ISA_XMEGA
+  if (cx->arch.has_rampd)
+    {
+      rr |= ramp_read (cx, RAMPD);
+      data_write_far (cx, rr, get_reg (cx, rd));
+      return;
+    }
+#endif
+  data_write_byte (cx, rr, get_reg (cx, rd));
 }
 
 /* 1010 1kkk dddd kkkk | STS (Tiny) */
-static OP_FUNC_TYPE func_STS1 (int rd, int rr)
+static OP_FUNC_TYPE func_STS1 (context_t *cx, int rd, int rr)
 {
-  data_write_byte (rr, get_reg (rd));
+  data_write_byte (cx, rr, get_reg (cx, rd));
 }
 
 /* 1001 001d dddd 1100 | ST */
-static OP_FUNC_TYPE func_ST_X (int rd, int rr)
+static OP_FUNC_TYPE func_ST_X (context_t *cx, int rd, int rr)
 {
-  store_indirect (rd, REGX, 0, 0);
+  store_indirect (cx, rd, REGX, 0, 0);
 }
 
 /* 1001 001d dddd 1110 | ST */
-static OP_FUNC_TYPE func_ST_X_decr (int rd, int rr)
+static OP_FUNC_TYPE func_ST_X_decr (context_t *cx, int rd, int rr)
 {
-  store_indirect (rd, REGX, -1, 0);
+  store_indirect (cx, rd, REGX, -1, 0);
 }
 
 /* 1001 001d dddd 1101 | ST */
-static OP_FUNC_TYPE func_ST_X_incr (int rd, int rr)
+static OP_FUNC_TYPE func_ST_X_incr (context_t *cx, int rd, int rr)
 {
-  store_indirect (rd, REGX, 1, 0);
+  store_indirect (cx, rd, REGX, 1, 0);
 }
 
 /* 1001 001d dddd 1010 | ST */
-static OP_FUNC_TYPE func_ST_Y_decr (int rd, int rr)
+static OP_FUNC_TYPE func_ST_Y_decr (context_t *cx, int rd, int rr)
 {
-  store_indirect (rd, REGY, -1, 0);
+  store_indirect (cx, rd, REGY, -1, 0);
 }
 
 /* 1001 001d dddd 1001 | ST */
-static OP_FUNC_TYPE func_ST_Y_incr (int rd, int rr)
+static OP_FUNC_TYPE func_ST_Y_incr (context_t *cx, int rd, int rr)
 {
-  store_indirect (rd, REGY, 1, 0);
+  store_indirect (cx, rd, REGY, 1, 0);
 }
 
 /* 1001 001d dddd 0010 | ST */
-static OP_FUNC_TYPE func_ST_Z_decr (int rd, int rr)
+static OP_FUNC_TYPE func_ST_Z_decr (context_t *cx, int rd, int rr)
 {
-  store_indirect (rd, REGZ, -1, 0);
+  store_indirect (cx, rd, REGZ, -1, 0);
 }
 
 /* 1001 001d dddd 0001 | ST */
-static OP_FUNC_TYPE func_ST_Z_incr (int rd, int rr)
+static OP_FUNC_TYPE func_ST_Z_incr (context_t *cx, int rd, int rr)
 {
-  store_indirect (rd, REGZ, 1, 0);
+  store_indirect (cx, rd, REGZ, 1, 0);
 }
 
 /* 1001 010d dddd 0010 | SWAP */
-static OP_FUNC_TYPE func_SWAP (int rd, int rr)
+static OP_FUNC_TYPE func_SWAP (context_t *cx, int rd, int rr)
 {
-  int value = get_reg (rd);
-  put_reg (rd, ((value << 4) & 0xF0) | ((value >> 4) & 0x0F));
+  int value = get_reg (cx, rd);
+  put_reg (cx, rd, ((value << 4) & 0xF0) | ((value >> 4) & 0x0F));
 }
 
 /* opcodes with a register (Rd) and a constant data (K) as operands */
 /* 0111 KKKK dddd KKKK | CBR or ANDI */
-static OP_FUNC_TYPE func_ANDI (int rd, int rr)
+static OP_FUNC_TYPE func_ANDI (context_t *cx, int rd, int rr)
 {
-  log_append ("(###)->%02x ", rr);
-  int result = get_reg (rd) & rr;
-  store_logical_result (rd, result);
+  log_append (cx, "(###)->%02x ", rr);
+  int result = get_reg (cx, rd) & rr;
+  store_logical_result (cx, rd, result);
 }
 
 /* 0011 KKKK dddd KKKK | CPI */
-static OP_FUNC_TYPE func_CPI (int rd, int rr)
+static OP_FUNC_TYPE func_CPI (context_t *cx, int rd, int rr)
 {
-  log_append ("(###)->%02x ", rr);
-  do_subtraction_8 (0, get_reg (rd), rr, 0, 0, 0);
+  log_append (cx, "(###)->%02x ", rr);
+  do_subtraction_8 (cx, 0, get_reg (cx, rd), rr, 0, 0, 0);
 }
 
 /* 1110 KKKK dddd KKKK | LDI or SER */
-static OP_FUNC_TYPE func_LDI (int rd, int rr)
+static OP_FUNC_TYPE func_LDI (context_t *cx, int rd, int rr)
 {
-  put_reg (rd, rr);
+  put_reg (cx, rd, rr);
 }
 
 /* 0110 KKKK dddd KKKK | SBR or ORI */
-static OP_FUNC_TYPE func_ORI (int rd, int rr)
+static OP_FUNC_TYPE func_ORI (context_t *cx, int rd, int rr)
 {
-  log_append ("(###)->%02x ", rr);
-  int result = get_reg (rd) | rr;
-  store_logical_result (rd, result);
+  log_append (cx, "(###)->%02x ", rr);
+  int result = get_reg (cx, rd) | rr;
+  store_logical_result (cx, rd, result);
 }
 
 /* 0100 KKKK dddd KKKK | SBCI */
-static OP_FUNC_TYPE func_SBCI (int rd, int rr)
+static OP_FUNC_TYPE func_SBCI (context_t *cx, int rd, int rr)
 {
-  log_append ("(###)->%02x ", rr);
-  do_subtraction_8 (rd, get_reg (rd), rr, get_carry(), 1, 1);
+  log_append (cx, "(###)->%02x ", rr);
+  do_subtraction_8 (cx, rd, get_reg (cx, rd), rr, get_carry(cx), 1, 1);
 }
 
 /* 0101 KKKK dddd KKKK | SUBI */
-static OP_FUNC_TYPE func_SUBI (int rd, int rr)
+static OP_FUNC_TYPE func_SUBI (context_t *cx, int rd, int rr)
 {
-  log_append ("(###)->%02x ", rr);
-  do_subtraction_8 (rd, get_reg (rd), rr, 0, 0, 1);
+  log_append (cx, "(###)->%02x ", rr);
+  do_subtraction_8 (cx, rd, get_reg (cx, rd), rr, 0, 0, 1);
 }
 
 
 /* opcodes with a register (Rd) and a register bit number (b) as operands */
 /* 1111 100d dddd 0bbb | BLD */
-static OP_FUNC_TYPE func_BLD (int rd, int rr)
+static OP_FUNC_TYPE func_BLD (context_t *cx, int rd, int rr)
 {
-  int value = get_reg (rd) | rr;
-  unsigned flag = (data_read_byte (SREG) >> FLAG_T_BIT) & 1;
+  int value = get_reg (cx, rd) | rr;
+  unsigned flag = (sreg_read (cx) >> FLAG_T_BIT) & 1;
   value &= ~rr | -flag;
-  put_reg (rd, value);
+  put_reg (cx, rd, value);
 }
 
 /* 1111 101d dddd 0bbb | BST */
-static OP_FUNC_TYPE func_BST (int rd, int rr)
+static OP_FUNC_TYPE func_BST (context_t *cx, int rd, int rr)
 {
-  int bit = get_reg (rd) & rr;
-  update_flags (FLAG_T, bit ? FLAG_T : 0);
+  int bit = get_reg (cx, rd) & rr;
+  update_flags (cx, FLAG_T, bit ? FLAG_T : 0);
 }
 
 /* 1111 110d dddd 0bbb | SBRC skipping 1 word */
-static OP_FUNC_TYPE func_SBRC (int rd, int rr)
+static OP_FUNC_TYPE func_SBRC (context_t *cx, int rd, int rr)
 {
-  skip_instruction_on_condition (!(get_reg (rd) & rr), 1);
+  skip_instruction_on_condition (cx, !(get_reg (cx, rd) & rr), 1);
 }
 
 /* 1111 110d dddd 0bbb | SBRC skipping 2 words */
-static OP_FUNC_TYPE func_SBRC2 (int rd, int rr)
+static OP_FUNC_TYPE func_SBRC2 (context_t *cx, int rd, int rr)
 {
-  skip_instruction_on_condition (!(get_reg (rd) & rr), 2);
+  skip_instruction_on_condition (cx, !(get_reg (cx, rd) & rr), 2);
 }
 
 /* 1111 111d dddd 0bbb | SBRS skipping 1 word */
-static OP_FUNC_TYPE func_SBRS (int rd, int rr)
+static OP_FUNC_TYPE func_SBRS (context_t *cx, int rd, int rr)
 {
-  skip_instruction_on_condition (get_reg (rd) & rr, 1);
+  skip_instruction_on_condition (cx, get_reg (cx, rd) & rr, 1);
 }
 
 /* 1111 111d dddd 0bbb | SBRS skipping 2 words */
-static OP_FUNC_TYPE func_SBRS2 (int rd, int rr)
+static OP_FUNC_TYPE func_SBRS2 (context_t *cx, int rd, int rr)
 {
-  skip_instruction_on_condition (get_reg (rd) & rr, 2);
+  skip_instruction_on_condition (cx, get_reg (cx, rd) & rr, 2);
 }
 
 /* opcodes with a relative 7-bit address (k) and a register bit number (b)
    as operands */
 /* 1111 01kk kkkk kbbb | BRBC */
-static OP_FUNC_TYPE func_BRBC (int rd, int rr)
+static OP_FUNC_TYPE func_BRBC (context_t *cx, int rd, int rr)
 {
-  branch_on_sreg_condition (rd, rr, 0);
+  branch_on_sreg_condition (cx, rd, rr, 0);
 }
 
 /* 1111 00kk kkkk kbbb | BRBS */
-static OP_FUNC_TYPE func_BRBS (int rd, int rr)
+static OP_FUNC_TYPE func_BRBS (context_t *cx, int rd, int rr)
 {
-  branch_on_sreg_condition (rd, rr, 1);
+  branch_on_sreg_condition (cx, rd, rr, 1);
 }
 
 
 /* opcodes with a 6-bit address displacement (q) and a register (Rd)
    as operands */
 /* 10q0 qq0d dddd 1qqq | LDD */
-static OP_FUNC_TYPE func_LDD_Y (int rd, int rr)
+static OP_FUNC_TYPE func_LDD_Y (context_t *cx, int rd, int rr)
 {
-  load_indirect (rd, REGY, 0, rr);
+  load_indirect (cx, rd, REGY, 0, rr);
 }
 
 /* 10q0 qq0d dddd 0qqq | LDD */
-static OP_FUNC_TYPE func_LDD_Z (int rd, int rr)
+static OP_FUNC_TYPE func_LDD_Z (context_t *cx, int rd, int rr)
 {
-  load_indirect (rd, REGZ, 0, rr);
+  load_indirect (cx, rd, REGZ, 0, rr);
 }
 
 /* 10q0 qq1d dddd 1qqq | STD */
-static OP_FUNC_TYPE func_STD_Y (int rd, int rr)
+static OP_FUNC_TYPE func_STD_Y (context_t *cx, int rd, int rr)
 {
-  store_indirect (rd, REGY, 0, rr);
+  store_indirect (cx, rd, REGY, 0, rr);
 }
 
 /* 10q0 qq1d dddd 0qqq | STD */
-static OP_FUNC_TYPE func_STD_Z (int rd, int rr)
+static OP_FUNC_TYPE func_STD_Z (context_t *cx, int rd, int rr)
 {
-  store_indirect (rd, REGZ, 0, rr);
+  store_indirect (cx, rd, REGZ, 0, rr);
 }
 
 
 /* opcodes with a absolute 22-bit address (k) operand */
 /* 1001 010k kkkk 110k | JMP */
-static OP_FUNC_TYPE func_JMP (int rd, int rr)
+static OP_FUNC_TYPE func_JMP (context_t *cx, int rd, int rr)
 {
-  cpu_PC = rr | (rd << 16);
+  cx->pc = rr | (rd << 16);
+  if (cx->pc > cx->pc_mask)
+    bad_PC (cx, cx->pc);
 }
 
 /* 1001 010k kkkk 111k | CALL */
-static OP_FUNC_TYPE func_CALL (int rd, int rr)
+static OP_FUNC_TYPE func_CALL (context_t *cx, int rd, int rr)
 {
-  push_PC();
-  cpu_PC = rr | (rd << 16);
-  add_program_cycles (arch.pc_3bytes);
+  push_PC(cx);
+  cx->pc = rr | (rd << 16);
+  if (cx->pc > cx->pc_mask)
+    bad_PC (cx, cx->pc);
+  add_program_cycles (cx, cx->arch.pc_3bytes);
 }
 
 
@@ -1405,245 +2531,353 @@ static OP_FUNC_TYPE func_CALL (int rd, int rr)
 /* BCLR takes place of CL{C,Z,N,V,S,H,T,I} */
 /* BSET takes place of SE{C,Z,N,V,S,H,T,I} */
 /* 1001 0100 1sss 1000 | BCLR */
-static OP_FUNC_TYPE func_BCLR (int rd, int rr)
+static OP_FUNC_TYPE func_BCLR (context_t *cx, int rd, int rr)
 {
-  update_flags (rd, 0);
+  update_flags (cx, rd, 0);
 }
 
 /* 1001 0100 0sss 1000 | BSET */
-static OP_FUNC_TYPE func_BSET (int rd, int rr)
+static OP_FUNC_TYPE func_BSET (context_t *cx, int rd, int rr)
 {
-  update_flags (rd, rd);
+  update_flags (cx, rd, rd);
 }
 
 
 /* opcodes with a 6-bit constant (K) and a register (Rd) as operands */
 /* 1001 0110 KKdd KKKK | ADIW */
-static OP_FUNC_TYPE func_ADIW (int rd, int rr)
+static OP_FUNC_TYPE func_ADIW (context_t *cx, int rd, int rr)
 {
-  log_append ("(###)->%02x ", rr);
-  int svalue = get_word_reg (rd);
+  log_append (cx, "(###)->%02x ", rr);
+  int svalue = get_word_reg (cx, rd);
   int evalue = svalue + rr;
-  put_word_reg (rd, evalue);
+  put_word_reg (cx, rd, evalue);
 
   int sreg = flag_update_table_add8[FUT_ADDSUB16_INDEX (svalue, evalue)];
   sreg &= ~FLAG_H;
   unsigned flag = (evalue & 0xFFFF) != 0;
   sreg &= ~(flag << FLAG_Z_BIT);
 
-  update_flags (FLAG_S | FLAG_V | FLAG_N | FLAG_Z | FLAG_C, sreg);
+  update_flags (cx, FLAG_S | FLAG_V | FLAG_N | FLAG_Z | FLAG_C, sreg);
 }
 
 /* 1001 0111 KKdd KKKK | SBIW */
-static OP_FUNC_TYPE func_SBIW (int rd, int rr)
+static OP_FUNC_TYPE func_SBIW (context_t *cx, int rd, int rr)
 {
-  log_append ("(###)->%02x ", rr);
-  int svalue = get_word_reg (rd);
+  log_append (cx, "(###)->%02x ", rr);
+  int svalue = get_word_reg (cx, rd);
   int evalue = svalue - rr;
-  put_word_reg (rd, evalue);
+  put_word_reg (cx, rd, evalue);
 
   int sreg = flag_update_table_sub8[FUT_ADDSUB16_INDEX (svalue, evalue)];
   sreg &= ~FLAG_H;
   unsigned flag = (evalue & 0xFFFF) != 0;
   sreg &= ~(flag << FLAG_Z_BIT);
 
-  update_flags (FLAG_S | FLAG_V | FLAG_N | FLAG_Z | FLAG_C, sreg);
+  update_flags (cx, FLAG_S | FLAG_V | FLAG_N | FLAG_Z | FLAG_C, sreg);
 }
 
 
 /* opcodes with a 5-bit IO Addr (A) and register bit number (b) as operands */
+/* Like on ATmega328P, CBI and SBI only write the addressed bit of a
+   flag register, hence they do not clear the other flags that are set.  */
+
 /* 1001 1000 AAAA Abbb | CBI */
-static OP_FUNC_TYPE func_CBI (int rd, int rr)
+static OP_FUNC_TYPE func_CBI (context_t *cx, int rd, int rr)
 {
-  data_write_byte (rd, data_read_byte (rd) & ~(rr));
+  int value = data_read_byte (cx, rd);
+  data_write_byte (cx, rd, is_periph_w1c (cx, rd) ? 0 : value & ~(rr));
 }
 
 /* 1001 1010 AAAA Abbb | SBI */
-static OP_FUNC_TYPE func_SBI (int rd, int rr)
+static OP_FUNC_TYPE func_SBI (context_t *cx, int rd, int rr)
 {
-  data_write_byte (rd, data_read_byte (rd) | rr);
+  int value = data_read_byte (cx, rd);
+  data_write_byte (cx, rd, is_periph_w1c (cx, rd) ? rr : value | rr);
 }
 
 /* 1001 1001 AAAA Abbb | SBIC skipping 1 word */
-static OP_FUNC_TYPE func_SBIC (int rd, int rr)
+static OP_FUNC_TYPE func_SBIC (context_t *cx, int rd, int rr)
 {
-  skip_instruction_on_condition (!(data_read_byte (rd) & rr), 1);
+  skip_instruction_on_condition (cx, !(data_read_byte (cx, rd) & rr), 1);
 }
 
 /* 1001 1001 AAAA Abbb | SBIC skipping 2 words */
-static OP_FUNC_TYPE func_SBIC2 (int rd, int rr)
+static OP_FUNC_TYPE func_SBIC2 (context_t *cx, int rd, int rr)
 {
-  skip_instruction_on_condition (!(data_read_byte (rd) & rr), 2);
+  skip_instruction_on_condition (cx, !(data_read_byte (cx, rd) & rr), 2);
 }
 
 /* 1001 1011 AAAA Abbb | SBIS skipping 1 word */
-static OP_FUNC_TYPE func_SBIS (int rd, int rr)
+static OP_FUNC_TYPE func_SBIS (context_t *cx, int rd, int rr)
 {
-  skip_instruction_on_condition (data_read_byte (rd) & rr, 1);
+  skip_instruction_on_condition (cx, data_read_byte (cx, rd) & rr, 1);
 }
 
 /* 1001 1011 AAAA Abbb | SBIS skipping 2 words */
-static OP_FUNC_TYPE func_SBIS2 (int rd, int rr)
+static OP_FUNC_TYPE func_SBIS2 (context_t *cx, int rd, int rr)
 {
-  skip_instruction_on_condition (data_read_byte (rd) & rr, 2);
+  skip_instruction_on_condition (cx, data_read_byte (cx, rd) & rr, 2);
 }
 
 
 /* opcodes with a 6-bit IO Addr (A) and register (Rd) as operands */
 /* 1011 0AAd dddd AAAA | IN */
-static OP_FUNC_TYPE func_IN (int rd, int rr)
+static OP_FUNC_TYPE func_IN (context_t *cx, int rd, int rr)
 {
-  put_reg (rd, data_read_byte (rr));
+  put_reg (cx, rd, data_read_byte (cx, rr));
 }
 
 /* 1011 1AAd dddd AAAA | OUT */
-static OP_FUNC_TYPE func_OUT (int rd, int rr)
+static OP_FUNC_TYPE func_OUT (context_t *cx, int rd, int rr)
 {
-  data_write_byte (rr, get_reg (rd));
+  data_write_byte (cx, rr, get_reg (cx, rd));
 }
 
 
 /* opcodes with a relative 12-bit address (k) operand */
 /* 1100 kkkk kkkk kkkk | RJMP */
-static OP_FUNC_TYPE func_RJMP (int rd, int rr)
+static OP_FUNC_TYPE func_RJMP (context_t *cx, int rd, int rr)
 {
   int delta = (int16_t) rr;
   // special case: endless loop usually means that the program has ended
   if (delta == -1)
-    leave (LEAVE_EXIT, "infinite loop detected (normal exit)");
-  cpu_PC = (cpu_PC + delta) & PC_VALID_MASK;
+    leave (cx, LEAVE_EXIT, "infinite loop detected (normal exit)");
+  cx->pc = (cx->pc + delta) & cx->pc_mask;
 }
 
 /* 1101 kkkk kkkk kkkk | RCALL */
-static OP_FUNC_TYPE func_RCALL (int rd, int rr)
+static OP_FUNC_TYPE func_RCALL (context_t *cx, int rd, int rr)
 {
   int delta = (int16_t) rr;
-  push_PC();
-  cpu_PC = (cpu_PC + delta) & PC_VALID_MASK;
-  add_program_cycles (arch.pc_3bytes);
+  push_PC(cx);
+  cx->pc = (cx->pc + delta) & cx->pc_mask;
+  add_program_cycles (cx, cx->arch.pc_3bytes);
 }
 
 
 /* opcodes with two 4-bit register (Rd and Rr) operands */
 /* 0000 0001 dddd rrrr | MOVW */
-static OP_FUNC_TYPE func_MOVW (int rd, int rr)
+static OP_FUNC_TYPE func_MOVW (context_t *cx, int rd, int rr)
 {
 #ifdef AVRTEST_LOG
-  put_word_reg (rd, get_word_reg (rr));
+  put_word_reg (cx, rd, get_word_reg (cx, rr));
 #else
-  put_reg (rd,     get_reg (rr));
-  put_reg (rd + 1, get_reg (rr + 1));
+  put_reg (cx, rd,     get_reg (cx, rr));
+  put_reg (cx, rd + 1, get_reg (cx, rr + 1));
 #endif
 }
 
 /* 0000 0010 dddd rrrr | MULS */
-static OP_FUNC_TYPE func_MULS (int rd, int rr)
+static OP_FUNC_TYPE func_MULS (context_t *cx, int rd, int rr)
 {
-  do_multiply (rd, rr, true, true, 0);
+  do_multiply (cx, rd, rr, true, true, 0);
 }
 
 /* opcodes with two 3-bit register (Rd and Rr) operands */
 /* 0000 0011 0ddd 0rrr | MULSU */
-static OP_FUNC_TYPE func_MULSU (int rd, int rr)
+static OP_FUNC_TYPE func_MULSU (context_t *cx, int rd, int rr)
 {
-  do_multiply (rd, rr, true, false, 0);
+  do_multiply (cx, rd, rr, true, false, 0);
 }
 
 /* 0000 0011 0ddd 1rrr | FMUL */
-static OP_FUNC_TYPE func_FMUL (int rd, int rr)
+static OP_FUNC_TYPE func_FMUL (context_t *cx, int rd, int rr)
 {
-  do_multiply (rd, rr, false, false, 1);
+  do_multiply (cx, rd, rr, false, false, 1);
 }
 
 /* 0000 0011 1ddd 0rrr | FMULS */
-static OP_FUNC_TYPE func_FMULS (int rd, int rr)
+static OP_FUNC_TYPE func_FMULS (context_t *cx, int rd, int rr)
 {
-  do_multiply (rd, rr, true, true, 1);
+  do_multiply (cx, rd, rr, true, true, 1);
 }
 
 /* 0000 0011 1ddd 1rrr | FMULSU */
-static OP_FUNC_TYPE func_FMULSU (int rd, int rr)
+static OP_FUNC_TYPE func_FMULSU (context_t *cx, int rd, int rr)
 {
-  do_multiply (rd, rr, true, false, 1);
+  do_multiply (cx, rd, rr, true, false, 1);
 }
 
 
-static void sys_argc_argv (void)
+static void sys_argc_argv (context_t *cx)
 {
-  if (!options.do_args)
+  if (!cx->options.do_args)
     {
-      log_append ("-no-args ");
-      put_word_reg (20, IS_AVRTEST_LOG);
-      put_word_reg (22, 0);
-      put_word_reg (24, 0);
+      log_append (cx, "-no-args ");
+      put_word_reg (cx, 20, IS_AVRTEST_LOG);
+      put_word_reg (cx, 22, 0);
+      put_word_reg (cx, 24, 0);
     }
   else
     {
-      log_append ("-args ... ");
-      int addr = get_word_reg (24);
-      put_argv (addr, cpu_data + addr);
-
-      put_word_reg (20, IS_AVRTEST_LOG);
-      put_word_reg (22, args.avr_argv);
-      put_word_reg (24, args.avr_argc);
+      log_append (cx, "-args ... ");
+      int addr = get_word_reg (cx, 24);
+      put_argv (cx, addr);
+      cx->args.avr_args = addr;
+
+      put_word_reg (cx, 20, IS_AVRTEST_LOG);
+      put_word_reg (cx, 22, cx->args.avr_argv);
+      put_word_reg (cx, 24, cx->args.avr_argc);
     }
 }
 
-static void sys_stdin (void)
+// The source of avrtest_getchar for replay_input().
+
+static int
+host_getchar (context_t *cx)
+{
+  return getc (cx->in);
+}
+
+static void sys_stdin (context_t *cx)
 {
-  if (options.do_stdin)
+  if (cx->options.do_stdin)
     {
-      log_append ("stdin ");
+      log_append (cx, "stdin ");
       if (IS_AVRTEST_LOG)
-        fflush (stdout);
-      put_word_reg (24, getchar());
+        fflush (cx->out);
+      put_word_reg (cx, 24, replay_input (cx, REPLAY_GETCHAR,
+                                          insns_now (cx), host_getchar));
     }
   else
-    log_append ("-no-stdin");
+    log_append (cx, "-no-stdin");
 }
 
-static void sys_stdout (void)
+static void sys_stdout (context_t *cx)
 {
-  if (options.do_stdout)
+  if (cx->options.do_stdout)
     {
-      log_append ("stdout ");
-      putchar ((char) get_reg (24));
+      log_append (cx, "stdout ");
+      putc ((char) get_reg (cx, 24), cx->out);
     }
   else
-    log_append ("-no-stdout");
+    log_append (cx, "-no-stdout");
+}
+
+static void sys_exit (context_t *cx)
+{
+  int r24 = (int16_t) get_word_reg_raw (cx, 24);
+
+  log_append (cx, "exit %d: ", r24);
+  get_word_reg (cx, 24);
+  leave (cx, LEAVE_EXIT, "exit %d function called",
+         cx->program.exit_value = r24);
+}
+
+static void sys_abort (context_t *cx)
+{
+  log_append (cx, "abort");
+  leave (cx, LEAVE_ABORTED, "abort function called");
+}
+
+// Word size of an entry of the vector table:  Devices with more than
+// 8 KiB of flash use JMP, the others RJMP.
+
+static int
+irq_vector_words (const context_t *cx)
+{
+  return is_tiny || cx->device.flash_size <= 0x2000 ? 1 : 2;
+}
+
+static void sys_irq (context_t *cx)
+{
+  int vector = get_reg (cx, 24);
+  dword cycles = get_word_reg (cx, 20) | (get_word_reg (cx, 22) << 16);
+  log_append (cx, "IRQ %d in %u cycles", vector, (unsigned) cycles);
+
+  if (vector == 0
+      || vector >= MAX_IRQS
+      || (unsigned) vector * irq_vector_words (cx) > cx->pc_mask)
+    leave (cx, LEAVE_ABORTED, "bad IRQ vector %d", vector);
+
+  event_schedule (cx, cx->program.n_cycles + cycles, irq_raise, vector);
 }
 
-static void sys_exit (void)
+#ifndef AVRTEST_LEAN
+// Write a checkpoint, cf. checkpoint.c.  The lean loop of avrtest_log
+// uses this one so that the sections of avrtest_log are added, too.
+
+void
+write_checkpoint (context_t *cx)
+{
+  checkpoint_begin (cx);
+  log_checkpoint (cx, false);
+  checkpoint_end (cx);
+}
+#else
+extern void write_checkpoint (context_t*);
+#endif // AVRTEST_LEAN
+
+// If the I flag is set, serve the pending interrupt with the highest
+// priority like the hardware does:  Push PC, clear I and jump to its
+// vector.  Not right after RETI, which returns to the interrupted code
+// for at least one instruction.
+
+static void
+do_irq (context_t *cx)
 {
-  int r24 = (int16_t) get_word_reg_raw (24);
+  if (!(sreg_value (cx) & FLAG_I)
+      || cx->program.n_cycles == cx->reti_cycles)
+    return;
+
+  int vector = irq_take (cx);
+  if (vector < 0)
+    return;
 
-  log_append ("exit %d: ", r24);
-  get_word_reg (24);
-  leave (LEAVE_EXIT, "exit %d function called", program.exit_value = r24);
+  periph_irq_taken (cx, vector);
+
+  log_add_irq (cx, vector);
+  push_PC (cx);
+  update_flags (cx, FLAG_I, 0);
+  cx->pc = vector * irq_vector_words (cx);
+  add_program_cycles (cx, is_xmega ? 5 : 4 + cx->arch.pc_3bytes);
+  log_dump_irq (cx);
 }
 
-static void sys_abort (void)
+// The cycle counter has reached program.event_cycles at the end of a
+// basic block:  Run the events that are due and serve a pending
+// interrupt.  Then write a checkpoint if one is due, cf. checkpoint.c.
+// -fork-server polls here until the program reaches the snapshot, and
+// a run that gets new arguments passes them to main in R24 and R22.
+
+static void
+do_events (context_t *cx)
 {
-  log_append ("abort");
-  leave (LEAVE_ABORTED, "abort function called");
+  if (cx->poll
+      && fork_server_poll (cx))
+    {
+      cpu_reg (cx)[22] = cx->args.avr_argv;
+      cpu_reg (cx)[23] = cx->args.avr_argv >> 8;
+      cpu_reg (cx)[24] = cx->args.avr_argc;
+      cpu_reg (cx)[25] = cx->args.avr_argc >> 8;
+    }
+
+  events_run (cx);
+  do_irq (cx);
+
+  if (cx->program.n_cycles >= cx->checkpoint_cycles)
+    {
+      sreg_materialize (cx);
+      write_checkpoint (cx);
+    }
 }
 
 
-static OP_FUNC_TYPE func_BAD_PC (int rd, int rr)
+static OP_FUNC_TYPE func_BAD_PC (context_t *cx, int rd, int rr)
 {
-  bad_PC (cpu_PC);
+  bad_PC (cx, cx->pc);
 }
 
-static OP_FUNC_TYPE func_UNDEF (int id, int opcode1)
+static OP_FUNC_TYPE func_UNDEF (context_t *cx, int id, int opcode1)
 {
   int rd = (opcode1 >> 4) & 0x1F;
   const char *mnemo = opcodes[id].mnemonic;
   const char *s_addr = mnemo + strlen (mnemo) - 2;
 
   (void) s_addr;
-  log_append ("%-7s .word 0x%04x: undefined operand combination: "
+  log_append (cx, "%-7s .word 0x%04x: undefined operand combination: "
               "%s overlaps R%d", mnemo, opcode1, s_addr, rd);
-  leave (LEAVE_ABORTED, "opcode 0x%04x has undefined result "
+  leave (cx, LEAVE_ABORTED, "opcode 0x%04x has undefined result "
          "(%s overlaps R%d)", opcode1, mnemo, rd);
 }
 
@@ -1690,27 +2924,29 @@ static OP_FUNC_TYPE func_UNDEF (int id, int opcode1)
    needed with the syscall approach and make avrtest run faster.  */
 
 // 0001 00rd dddd rrrr 1111 1111 1111 1111 | CPSE r,r $ 0xffff | syscall r
-static OP_FUNC_TYPE func_SYSCALL (int sysno, int rr)
+static OP_FUNC_TYPE func_SYSCALL (context_t *cx, int sysno, int rr)
 {
-  log_append ("#%d: ", sysno);
+  log_append (cx, "#%d: ", sysno);
+  sreg_materialize (cx);
 
   switch (sysno)
     {
     default:
-      log_append ("not implemented ");
+      log_append (cx, "not implemented ");
       return;
 
-    case 27: sys_argc_argv();  break;
-    case 28: sys_stdin();      break;
-    case 29: sys_stdout();     break;
-    case 30: sys_exit();       break;
-    case 31: sys_abort();      break;
+    case 26: sys_irq(cx);        break;
+    case 27: sys_argc_argv(cx);  break;
+    case 28: sys_stdin(cx);      break;
+    case 29: sys_stdout(cx);     break;
+    case 30: sys_exit(cx);       break;
+    case 31: sys_abort(cx);      break;
 
     case 0: case 1: case 2: case 3:  // Logging control
     case 4:                          // Get / reset cycles, insns, rand ...
     case 5: case 6:                  // Performance metering
     case 7:                          // Logging values
-      do_syscall (sysno, get_word_reg_raw (24));
+      do_syscall (cx, sysno, get_word_reg_raw (cx, 24));
       break;
     }
 }
@@ -1719,73 +2955,834 @@ static OP_FUNC_TYPE func_SYSCALL (int sysno, int rr)
 // AVR opcodes
 // depends on CX and thus on ISA_XMEGA, hence this table lives in avrtest.c
 
+#ifndef AVRTEST_LEAN
 const opcode_t opcodes[] =
   {
 #define AVR_OPCODE(ID, N_WORDS, N_TICKS, NAME)            \
-    [ID_ ## ID] = { func_ ## ID, NAME, N_WORDS, N_TICKS },
+    [ID_ ## ID] = { NAME, N_WORDS, N_TICKS },
 #include "avr-opcode.def"
 #undef AVR_OPCODE
   };
+#endif // AVRTEST_LEAN
+
+// ----------------------------------------------------------------------------
+//     -hle: check emulated routines against the interpreter
+
+#ifndef AVRTEST_LOG
+
+// A routine from hle.c that runs in the interpreter while its emulation
+// waits for comparison, cf. hle_call in execute().  Allocated as
+// cx->hle_check when first needed.
+typedef struct hle_check
+{
+  hle_routine_t *r;
+
+  // Where the routine returns or falls through to, the handler that has
+  // been bound there, and the stack pointer after the routine.
+  unsigned ret_pc;
+  const void *ret_handler;
+  int sp;
+
+  // The costs up to the routine's entry.
+  qword n_insns, n_cycles;
+
+  // The result of the emulation, run on copies of RAM and registers.
+  hle_state_t s;
+  byte *data;
+  byte reg[0x20];
+} hle_check_t;
+
+// Routine R starts at D and is about to run in the interpreter.  Run its
+// emulation on a copy of the state S, and remember where the routine
+// will return.  Return false if the return address is not usable.
+
+static bool
+hle_check_start (context_t *cx, hle_routine_t *r, const decoded_t *d,
+                 const hle_state_t *s)
+{
+  int sp = data_read_word (cx, SPL);
+  int n_bytes = cx->arch.pc_3bytes ? 3 : 2;
+  unsigned pc = s->next_pc;
+
+  // Routines from the startup code fall through to NEXT_PC.
+  if (pc == -1U)
+    {
+      if ((unsigned) sp + n_bytes > cx->ram_end)
+        return false;
+      pc = 0;
+      for (int i = 1; i <= n_bytes; i++)
+        pc = (pc << 8) | cx->data[sp + i];
+      if (pc > cx->pc_mask)
+        return false;
+    }
+
+  if (!cx->hle_check)
+    {
+      cx->hle_check = get_mem (cx, 1, sizeof (hle_check_t), "-hle");
+      cx->hle_check->data = get_mem (cx, MAX_RAM_SIZE, 1, "-hle");
+    }
+  hle_check_t *hc = cx->hle_check;
+
+  memcpy (hc->data, cx->data, cx->ram_end + 1);
+  memcpy (hc->reg, cpu_reg (cx), sizeof (hc->reg));
+
+  hc->s = *s;
+  hc->s.data = hc->data;
+  hc->s.reg = cpu_reg (cx) == cx->data
+    ? hc->data
+    : hc->reg;
+  r->run (&hc->s);
+
+  // The emulation does not pop the return address.
+  if (s->next_pc == -1U)
+    {
+      sp += n_bytes;
+      hc->data[SPL] = sp;
+      hc->data[SPH] = sp >> 8;
+    }
+
+  hc->r = r;
+  hc->ret_pc = pc;
+  hc->ret_handler = cx->decoded[pc].handler;
+  hc->sp = sp;
+  hc->n_insns = cx->program.n_insns - d->block_insns;
+  hc->n_cycles = cx->program.n_cycles - d->block_cycles;
+  return true;
+}
+
+// The routine from hle_check_start() returned to D, and the costs of
+// D's block have been accounted.  Compare registers, SREG and RAM to the
+// emulation, and learn the routine's costs.  If anything does not match,
+// don't emulate the routine any more.
+
+static void
+hle_check_finish (context_t *cx, const decoded_t *d)
+{
+  hle_check_t *hc = cx->hle_check;
+  hle_routine_t *r = hc->r;
+  dword insns = cx->program.n_insns - d->block_insns - hc->n_insns;
+  dword cycles = cx->program.n_cycles - d->block_cycles - hc->n_cycles;
+  dword p_insns, p_cycles;
+  const char *what = NULL;
+
+  hc->r = NULL;
+  r->n_interpreted++;
+
+  // SREG might be lazy and is compared on its own.
+  hc->data[SREG] = cx->data[SREG];
+
+  if (sreg_value (cx) != hc->s.sreg)
+    what = "SREG";
+  else if (memcmp (cpu_reg (cx), hc->s.reg, sizeof (hc->reg)))
+    what = "registers";
+  else if (memcmp (cx->data, hc->data, cx->ram_end + 1))
+    what = "RAM";
+  else if (hle_cost (r, &hc->s, &p_insns, &p_cycles)
+           && (p_insns != insns || p_cycles != cycles))
+    what = "costs";
+  else if (!hle_learn (r, &hc->s, insns, cycles))
+    what = "costs";
+
+  if (what)
+    {
+      r->off = true;
+      if (cx->options.do_hle_verify)
+        fprintf (cx->out, "\navrtest: -hle-verify: %s at %06x: %s differ "
+                 "from the emulation, not emulating %s\n", r->name,
+                 2 * r->pc, what, r->name);
+    }
+}
+
+#endif // AVRTEST_LOG
 
 // ----------------------------------------------------------------------------
 //     main execution loop
 
-static INLINE void
-do_step (void)
+/* The main loop uses threaded code:  Each decoded instruction holds the
+   address of the label in execute() that simulates it, together with
+   its size and cycles.  Each such label ends in its own indirect jump
+   to the next instruction so that the host's branch predictor can
+   learn the AVR program's instruction sequences.  The func_<ID> handlers
+   are always inlined.
+
+   Label addresses are only known inside execute(), thus execute() binds
+   decoded[] to its handlers before the first instruction runs.
+
+   Without logging, costs are accounted per basic block:  When a block is
+   entered, the static cycles and the number of instructions up to the end
+   of the block are added as precomputed by decode_flash().  The block then
+   runs without any bookkeeping up to its last instruction as determined
+   by opcode_ends_block(), which checks for -m MAXCOUNT.  Extra cycles like
+   for a taken branch are still added by the instructions themselves.
+   When leaving from inside a block, leave() takes back the costs of the
+   instructions that did not run.
+
+   Also without logging, the sequences of instructions from avr-fuse.def
+   are run as superinstructions:  The first instruction of a sequence is
+   bound to a handler that runs all of them but the last one and then
+   jumps directly to the handler of the last one, cf. fuse_kind().
+
+   Delay loops as recognized by delay_loop() are bound to delay_skip,
+   which runs all of their rounds but the last one at once.
+
+   With -jit, execute() counts how often the regions of jit_candidate()
+   run.  Hot regions are compiled to native code by jit_compile(), and
+   from then on their first instruction is bound to jit_run.
+
+   With -hle, the first instructions of the routines from hle.c are bound
+   to hle_call, which runs the routine natively once its costs are known.
+   Until then, the routine runs in the interpreter, and hle_return checks
+   the result when the routine returns.
+
+   With logging, each instruction is accounted on its own so that logging,
+   performance metering and the call graph see the exact costs.  This
+   loop does not use the handlers from decoded[], which belong to the
+   lean loop:  avrtest_log only runs the instrumented loop while logging,
+   a perf-meter, -graph or -debug-tree need it, cf. log_is_idle().  Else,
+   it runs execute_lean(), which is the loop from above compiled with
+   AVRTEST_LEAN.  The lean loop returns to the instrumented one at the
+   SYSCALLs that might turn on logging or a perf-meter, and the
+   instrumented loop switches back at the end of a basic block.  */
+
+#ifdef AVRTEST_LOG
+
+// Fetch the decoded instruction at cx->pc, account its static costs
+// and jump to its handler.
+
+#define DISPATCH_BLOCK                                \
+  do {                                                \
+      d = & cx->decoded[cx->pc];                      \
+      log_add_instr (cx, d);                          \
+      cx->pc += d->size;                              \
+      add_program_cycles (cx, opcodes[d->id].cycles); \
+      goto *handler[d->id];                           \
+  } while (0)
+
+// Run the lean loop until it returns at a SYSCALL.  Meanwhile, nothing
+// is logged.
+
+#define RUN_LEAN                                        \
+  do {                                                  \
+      cx->log_unused = true;                            \
+      execute_lean (cx, cx->need.call_depth);           \
+      perf_lean_resume (cx);                            \
+  } while (0)
+
+#else
+
+// Fetch the decoded instruction at cx->pc, account the static costs
+// of its basic block and jump to its handler.
+
+#define DISPATCH_BLOCK                                  \
+  do {                                                  \
+      d = & cx->decoded[cx->pc];                        \
+      cx->in_block = BLOCK_BODY;                        \
+      cx->program.n_insns = n_insns += d->block_insns;  \
+      add_program_cycles (cx, d->block_cycles);         \
+      cx->pc += d->size;                                \
+      goto *d->handler;                                 \
+  } while (0)
+
+// Fetch the next instruction of the current basic block and jump to
+// its handler.
+
+#define DISPATCH_NEXT                           \
+  do {                                          \
+      d = & cx->decoded[cx->pc];                \
+      cx->pc += d->size;                        \
+      goto *d->handler;                         \
+  } while (0)
+
+// At the end of a basic block:  Run the events that are due and serve
+// pending interrupts, cf. irq.c.
+
+#define CHECK_EVENTS                                            \
+  do {                                                          \
+      if (cx->program.n_cycles >= cx->program.event_cycles)     \
+        {                                                       \
+          cx->in_block = BLOCK_NONE;                            \
+          do_events (cx);                                       \
+        }                                                       \
+  } while (0)
+
+// avrtest_log:  If CALLS, tell the call graph about the last instruction
+// of each basic block, which is where calls and returns are.
+
+#ifdef AVRTEST_LEAN
+#define LEAN_CALL_DEPTH                         \
+  do {                                          \
+      if (calls)                                \
+        graph_lean_call_depth (cx, d);          \
+  } while (0)
+#else
+#define LEAN_CALL_DEPTH (void) 0
+#endif // AVRTEST_LEAN
+
+#endif // AVRTEST_LOG
+
+#ifdef AVRTEST_LEAN
+void
+execute_lean (context_t *cx, bool calls)
+#else
+static void
+execute (context_t *cx)
+#endif
+{
+  static const void* const handler[] =
+    {
+#define AVR_OPCODE(ID, N_WORDS, N_TICKS, NAME)  \
+      [ID_ ## ID] = __extension__ && L_ ## ID,
+#include "avr-opcode.def"
+#undef AVR_OPCODE
+    };
+
+#ifndef AVRTEST_LOG
+  static const void* const fused[] =
+    {
+#define AVR_FUSE(ID1, ID2)                                              \
+      [FUSE_ ## ID1 ## _ ## ID2] = __extension__ && LF_ ## ID1 ## _ ## ID2,
+#define AVR_FUSE3(ID1, ID2, ID3)                                        \
+      [FUSE_ ## ID1 ## _ ## ID2 ## _ ## ID3] =                          \
+      __extension__ && LF_ ## ID1 ## _ ## ID2 ## _ ## ID3,
+#define AVR_FUSE4(ID1, ID2, ID3, ID4)                                   \
+      [FUSE_ ## ID1 ## _ ## ID2 ## _ ## ID3 ## _ ## ID4] =              \
+      __extension__ && LF_ ## ID1 ## _ ## ID2 ## _ ## ID3 ## _ ## ID4,
+#include "avr-fuse.def"
+#undef AVR_FUSE
+#undef AVR_FUSE3
+#undef AVR_FUSE4
+    };
+#endif // AVRTEST_LOG
+
+#ifndef AVRTEST_LOG
+  // Entries outside [code_start, code_end] are ID_BAD_PC with size 0 and
+  // 0 cycles due to static zero-initialization, so that binding all
+  // entries also catches jumps outside the program.  avrtest_log enters
+  // the lean loop many times, but binds only once, and then only the
+  // entries from flash_changed().
+  if (!cx->bound)
+    {
+      if (cx->options.do_jit && !jit_init (cx))
+        qprintf (cx, "avrtest: -jit is not available on this host\n");
+      if (cx->options.do_fuse_stats && !cx->fuse_runs)
+        cx->fuse_runs = get_mem (cx, cx->pc_mask + 1, sizeof (qword),
+                                 "-fuse-stats");
+      cx->bound = true;
+      cx->rebind_lo = 0;
+      cx->rebind_hi = cx->pc_mask + 1;
+    }
+
+  // Bind all entries, or the ones that SPM has changed.
+ rebind:
+  if (cx->rebind_hi)
+    {
+      if (cx->jit)
+        jit_forget (cx, cx->rebind_lo, cx->rebind_hi);
+
+      for (unsigned i = cx->rebind_lo; i < cx->rebind_hi; i++)
+        {
+          decoded_t *di = & cx->decoded[i];
+          di->handler = handler[di->id];
+          int k, regno;
+#ifdef AVRTEST_LEAN
+          if (di->id == ID_SYSCALL
+              && di->op1 <= 7)
+            di->handler = __extension__ && lean_return;
+          else
+#endif
+          if (di->block_insns == 0)
+            di->handler = __extension__ && block_chunk;
+          else if (cx->options.do_skip_delays
+                   && delay_loop (di, &regno))
+            di->handler = __extension__ && delay_skip;
+          else if (cx->jit && jit_candidate (cx, i))
+            di->handler = __extension__ && jit_profile;
+          else if (cx->options.do_fuse_stats)
+            di->handler = __extension__ && fuse_count;
+          else if (cx->options.do_fuse
+                   && (k = fuse_kind (cx, di)) >= 0)
+            di->handler = fused[k];
+
+          hle_routine_t *r;
+          if (cx->options.do_hle
+              && (r = hle_routine (cx, i)))
+            {
+              r->handler = di->handler;
+              di->handler = __extension__ && hle_call;
+            }
+        }
+      cx->rebind_lo = cx->rebind_hi = 0;
+    }
+#endif // AVRTEST_LOG
+
+  const qword max_insns = cx->program.max_insns;
+  const decoded_t *d;
+#ifndef AVRTEST_LOG
+  // Shadows cx->program.n_insns which is only ever written here.
+  qword n_insns = cx->program.n_insns;
+#endif
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wpedantic"
+
+#ifdef AVRTEST_LOG
+  if (log_is_idle (cx))
+    RUN_LEAN;
+#endif
+
+  DISPATCH_BLOCK;
+
+#ifdef AVRTEST_LOG
+#define AVR_OPCODE(ID, N_WORDS, N_TICKS, NAME)                          \
+  L_ ## ID:                                                             \
+    func_ ## ID (cx, d->op1, d->op2);                                   \
+    log_dump_line (cx, d);                                              \
+    cx->program.n_insns++;                                              \
+    if (max_insns && cx->program.n_insns >= max_insns)                  \
+      leave (cx, LEAVE_TIMEOUT, "instruction count limit reached");     \
+    if (opcode_ends_block (ID_ ## ID)                                   \
+        && cx->program.n_cycles >= cx->program.event_cycles)            \
+      do_events (cx);                                                   \
+    if (opcode_ends_block (ID_ ## ID)                                   \
+        && log_is_idle (cx))                                            \
+      RUN_LEAN;                                                         \
+    DISPATCH_BLOCK;
+#else
+#define AVR_OPCODE(ID, N_WORDS, N_TICKS, NAME)                          \
+  L_ ## ID:                                                             \
+    if (opcode_ends_block (ID_ ## ID))                                  \
+      cx->in_block = BLOCK_LAST;                                        \
+    func_ ## ID (cx, d->op1, d->op2);                                   \
+    if (opcode_ends_block (ID_ ## ID))                                  \
+      {                                                                 \
+        LEAN_CALL_DEPTH;                                                \
+        if (max_insns && n_insns >= max_insns)                          \
+          {                                                             \
+            cx->in_block = BLOCK_NONE;                                  \
+            leave (cx, LEAVE_TIMEOUT,                                   \
+                   "instruction count limit reached");                  \
+          }                                                             \
+        CHECK_EVENTS;                                                   \
+        if ((ID_ ## ID == ID_SPM || ID_ ## ID == ID_ESPM)               \
+            && cx->rebind_hi)                                           \
+          goto rebind;                                                  \
+        DISPATCH_BLOCK;                                                 \
+      }                                                                 \
+    DISPATCH_NEXT;
+#endif // AVRTEST_LOG
+#include "avr-opcode.def"
+#undef AVR_OPCODE
+
+#ifndef AVRTEST_LOG
+  // d starts a chunk of a long basic block, cf. decode_flash().  Account
+  // the costs of the chunk and proceed with the instruction's handler.
+ block_chunk:
+  {
+    const decoded_t *dn = & cx->decoded[cx->pc];
+    cx->program.n_insns = n_insns += 1 + dn->block_insns;
+    add_program_cycles (cx, opcodes[d->id].cycles + dn->block_cycles);
+    goto *handler[d->id];
+  }
+
+  // Superinstructions:  Run all instructions but the last one, then
+  // proceed with the handler of the last one.  As the decoded instructions
+  // are the same as without fusion, jumping into the middle of a sequence
+  // just works.
+#define FUSE_STEP(ID, ID_NEXT)                                          \
+    func_ ## ID (cx, d->op1, d->op2);                                   \
+    d = & cx->decoded[cx->pc];                                          \
+    cx->pc += opcodes[ID_ ## ID_NEXT].size
+#define AVR_FUSE(ID1, ID2)                                              \
+  LF_ ## ID1 ## _ ## ID2:                                               \
+    FUSE_STEP (ID1, ID2);                                               \
+    goto L_ ## ID2;
+#define AVR_FUSE3(ID1, ID2, ID3)                                        \
+  LF_ ## ID1 ## _ ## ID2 ## _ ## ID3:                                   \
+    FUSE_STEP (ID1, ID2);                                               \
+    FUSE_STEP (ID2, ID3);                                               \
+    goto L_ ## ID3;
+#define AVR_FUSE4(ID1, ID2, ID3, ID4)                                   \
+  LF_ ## ID1 ## _ ## ID2 ## _ ## ID3 ## _ ## ID4:                       \
+    FUSE_STEP (ID1, ID2);                                               \
+    FUSE_STEP (ID2, ID3);                                               \
+    FUSE_STEP (ID3, ID4);                                               \
+    goto L_ ## ID4;
+#include "avr-fuse.def"
+#undef AVR_FUSE
+#undef AVR_FUSE3
+#undef AVR_FUSE4
+#undef FUSE_STEP
+
+  // -fuse-stats:  Count how often the instruction has run, then run it
+  // on its own so that all instructions are counted.
+ fuse_count:
+  cx->fuse_runs[d - cx->decoded]++;
+  goto *handler[d->id];
+
+  // d starts a delay loop, and the costs of the current round have
+  // already been accounted.  Account all rounds but the last one, or as
+  // many rounds as can run before -m MAXCOUNT or an event is checked at
+  // the end of a round.  Then run the remaining round as usual.
+ delay_skip:
+  {
+    int regno;
+    int n_bytes = delay_loop (d, &regno);
+    uint64_t count = 0;
+    for (int i = n_bytes - 1; i >= 0; i--)
+      count = (count << 8) | cpu_reg (cx)[regno + i];
+
+    uint64_t skip = (count ? count : (uint64_t) 1 << (8 * n_bytes)) - 1;
+    if (max_insns)
+      {
+        uint64_t n_left = n_insns < max_insns
+          ? (max_insns - n_insns - 1) / d->block_insns + 1
+          : 0;
+        if (skip > n_left)
+          skip = n_left;
+      }
+
+    // Without skipping, the round that ends at or after event_cycles
+    // would run do_events().  A round costs one more cycle than the
+    // block because of the taken branch.
+    qword n_cycles = cx->program.n_cycles;
+    qword event_cycles = cx->program.event_cycles;
+    if (event_cycles != (qword) -1)
+      {
+        uint64_t n_left = event_cycles > n_cycles + 1
+          ? (event_cycles - n_cycles - 2) / (d->block_cycles + 1) + 1
+          : 0;
+        if (skip > n_left)
+          skip = n_left;
+      }
+
+    count -= skip;
+    for (int i = 0; i < n_bytes; i++)
+      cpu_reg (cx)[regno + i] = count >> (8 * i);
+    cx->program.n_insns = n_insns += skip * d->block_insns;
+    add_program_cycles (cx, skip * (d->block_cycles + 1));
+    goto *handler[d->id];
+  }
+
+  // -jit:  d starts a region that might be compiled.  Count its runs and
+  // compile it when it is hot.  If that fails, don't try again.
+ jit_profile:
+  {
+    unsigned pc = d - cx->decoded;
+    if (!jit_hot (cx, pc))
+      goto *handler[d->id];
+    cx->jit->code[pc] = jit_compile (cx, pc);
+    cx->decoded[pc].handler = cx->jit->code[pc]
+      ? __extension__ && jit_run
+      : handler[d->id];
+    goto *cx->decoded[pc].handler;
+  }
+
+  // Run the native code of a region.  The costs of the region's basic
+  // block have already been accounted by DISPATCH_BLOCK.
+ jit_run:
+  sreg_materialize (cx);
+  cx->pc = cx->jit->code[d - cx->decoded] (cpu_reg (cx), cx->data + SREG,
+                                           &cx->program);
+  n_insns = cx->program.n_insns;
+  if (max_insns && n_insns >= max_insns)
+    {
+      cx->in_block = BLOCK_NONE;
+      leave (cx, LEAVE_TIMEOUT, "instruction count limit reached");
+    }
+  CHECK_EVENTS;
+  DISPATCH_BLOCK;
+
+  // -hle:  d starts a routine from hle.c.  If its costs are known, apply
+  // its effects and account the costs of the routine except the ones of
+  // d's block that have already been accounted.  Then return like RET,
+  // or go on where the routine falls through to.  Otherwise, run the
+  // routine in the interpreter and check it against the emulation.
+ hle_call:
+  {
+    hle_routine_t *r = hle_routine (cx, d - cx->decoded);
+    hle_state_t s = { cx, cpu_reg (cx), cx->data, sreg_value (cx), 0, 0,
+                      d - cx->decoded, -1U };
+    dword insns, cycles;
+
+    if ((cx->hle_check && cx->hle_check->r)
+        || r->off || ramp_in_use (cx) || !r->scan (&s))
+      goto *r->handler;
+
+    if (!cx->options.do_hle_verify
+        && hle_cost (r, &s, &insns, &cycles)
+        && (!max_insns || n_insns - d->block_insns + insns < max_insns)
+        && (cx->program.n_cycles - d->block_cycles + cycles
+            < cx->program.event_cycles))
+      {
+        r->run (&s);
+        r->n_native++;
+        cx->data[SREG] = s.sreg;
+        cx->lazy_flags = 0;
+        cx->program.n_insns = n_insns += (qword) insns - d->block_insns;
+        add_program_cycles (cx, (qword) cycles - d->block_cycles);
+        cx->in_block = BLOCK_LAST;
+        if (s.next_pc == -1U)
+          pop_PC (cx);
+        else
+          cx->pc = s.next_pc;
+        CHECK_EVENTS;
+        DISPATCH_BLOCK;
+      }
+
+    if (hle_check_start (cx, r, d, &s))
+      cx->decoded[cx->hle_check->ret_pc].handler
+        = __extension__ && hle_return;
+    goto *r->handler;
+  }
+
+  // -hle:  d is where the routine from hle_check_start() returns to.
+  // It might also be reached otherwise, hence check the stack pointer.
+ hle_return:
+  {
+    const hle_check_t *hc = cx->hle_check;
+    const void *h = hc->ret_handler;
+    if (data_read_word (cx, SPL) == hc->sp)
+      {
+        cx->decoded[hc->ret_pc].handler = h;
+        hle_check_finish (cx, d);
+      }
+    goto *h;
+  }
+#endif // AVRTEST_LOG
+
+#ifdef AVRTEST_LEAN
+  // avrtest_log:  d is a SYSCALL that might turn on logging or a
+  // perf-meter.  Take back its costs and return to the instrumented
+  // loop, which runs it.
+ lean_return:
+  if (d->block_insns != 0)
+    {
+      cx->program.n_insns = n_insns - 1;
+      cx->program.n_cycles -= opcodes[d->id].cycles;
+    }
+  cx->pc -= d->size;
+  cx->in_block = BLOCK_NONE;
+  sreg_materialize (cx);
+  return;
+#endif // AVRTEST_LEAN
+
+#pragma GCC diagnostic pop
+}
+
+#undef DISPATCH_BLOCK
+#undef DISPATCH_NEXT
+#undef CHECK_EVENTS
+#undef RUN_LEAN
+#undef LEAN_CALL_DEPTH
+
+#ifndef AVRTEST_LEAN
+
+// Make CX a fresh context with no program loaded.  The program reads
+// from IN and writes to OUT, and avrtest reports errors to ERR.
+
+static void
+init_context (context_t *cx, FILE *in, FILE *out, FILE *err)
+{
+  memset (cx, 0, sizeof (context_t));
+  cx->lazy_value = & cx->lazy_flags;
+  cx->eeprom_fd = -1;
+  cx->in = in;
+  cx->out = out;
+  cx->err = err;
+  events_init (cx);
+}
+
+
+// The run of CX is over:  Hand back all the memory and files it holds.
+
+static void
+free_context (context_t *cx)
 {
-  // fetch decoded instruction
-  decoded_t d = decoded_flash[cpu_PC];
-  byte id = d.id;
+  eeprom_finish (cx);
+#ifndef AVRTEST_LOG
+  jit_free (cx);
+#endif
 
-  // execute instruction
-  const opcode_t *insn = &opcodes[id];
-  log_add_instr (&d);
-  cpu_PC += insn->size;
-  add_program_cycles (insn->cycles);
-  int op1 = d.op1;
-  int op2 = d.op2;
-  insn->func (op1, op2);
-  log_dump_line (&d);
+  while (cx->held)
+    {
+      if (cx->held->file)
+        fclose (cx->held->file);
+      unhold (cx, cx->held);
+    }
 }
 
-static INLINE void
-execute (void)
+
+// Tag the pages of the data space, cf. page_of().  A page that is
+// only partly RAM takes the slow path of PAGE_IO which checks RAMEND.
+// On avrxmega7, the pages above RAMEND are external memory.
+
+static void
+map_pages (context_t *cx)
 {
-  dword max_insns = program.max_insns;
+  byte *data_page = cx->data_page;
 
-  for (;;)
+  for (unsigned p = 0; p < N_DATA_PAGES; p++)
+    {
+      unsigned lo = p << DATA_PAGE_SHIFT;
+      unsigned hi = lo + DATA_PAGE_SIZE - 1;
+      data_page[p] = hi <= cx->ram_end ? PAGE_RAM
+        : lo <= cx->ram_end ? PAGE_IO
+        : PAGE_UNMAPPED;
+
+      if (is_tiny
+          && lo >= MAPPED_FLASH_START && hi < 2 * MAPPED_FLASH_START)
+        data_page[p] = PAGE_FLASH;
+
+      if (cx->arch.has_rampd && lo > cx->ram_end && hi <= 0xffff)
+        data_page[p] = PAGE_EXTERNAL;
+
+      if (is_xmega
+          && cx->device.eeprom_size
+          && MAPPED_EEPROM_START + cx->device.eeprom_size <= cx->ram_start
+          && lo >= MAPPED_EEPROM_START
+          && hi < MAPPED_EEPROM_START + cx->device.eeprom_size)
+        data_page[p] = PAGE_EEPROM;
+    }
+
+  data_page[SREG >> DATA_PAGE_SHIFT] = PAGE_IO;
+  for (unsigned a = 0; a < cx->periph_end; a++)
+    if (cx->periph_hook[a])
+      data_page[a >> DATA_PAGE_SHIFT] = PAGE_IO;
+
+  // The RAM pages in a row that end with the last full page of RAM.
+  unsigned p = (cx->ram_end + 1) >> DATA_PAGE_SHIFT;
+  while (p > 0 && data_page[p - 1] == PAGE_RAM)
+    p--;
+  cx->plain_start = p << DATA_PAGE_SHIFT;
+  cx->plain_size = ((cx->ram_end + 1) & -DATA_PAGE_SIZE) - cx->plain_start;
+}
+
+
+// Allocate the memories of CX as of the device from -mmcu=.  The
+// flash is rounded up to a power of 2 so that PC can be masked, plus
+// one word that decode_flash() peeks at after the last instruction.
+
+static void
+map_device (context_t *cx)
+{
+  unsigned n_words = 1;
+  while (2 * n_words < cx->device.flash_size)
+    n_words *= 2;
+
+  cx->pc_mask = n_words - 1;
+  cx->ram_start = cx->device.ram_start;
+  cx->ram_end = cx->device.ram_end;
+
+  cx->data = get_mem (cx, cx->ram_end + 1, sizeof (byte), "RAM");
+  cx->flash = get_mem (cx, 2 * n_words + 2, sizeof (byte), "flash");
+  cx->eeprom = get_mem (cx, cx->device.eeprom_size
+                        ? cx->device.eeprom_size : 1, sizeof (byte),
+                        "EEPROM");
+  cx->decoded = get_mem (cx, n_words, sizeof (decoded_t), "decoded flash");
+  if (cx->arch.has_rampd)
+    cx->far = get_mem (cx, N_FAR_PAGES, sizeof (byte*), "external memory");
+  periph_init (cx);
+  map_pages (cx);
+
+  cx->spm_page = is_xmega
+    ? (cx->device.flash_size > 0x11000 ? 512 : 256)
+    : (cx->device.flash_size <= 0x2000 ? 64
+       : cx->device.flash_size <= 0x8000 ? 128 : 256);
+  cx->spm_csr = strcmp (cx->device.name, "atmega64") == 0
+    || strcmp (cx->device.name, "atmega128") == 0 ? 0x68 : SPMCSR;
+  memset (cx->spm_buffer, 0xff, sizeof (cx->spm_buffer));
+
+  if (cx->pc > cx->pc_mask)
+    leave (cx, LEAVE_USAGE, "entry point 0x%x is outside the flash of %s",
+           2 * cx->pc, cx->device.name);
+}
+
+
+// Run the program from the command line ARGC, ARGV in CX as set up by
+// init_context(), until it leaves.  Return the value avrtest exits with,
+// as determined by leave(), after CX has handed back what it holds.
+
+static int
+run_context (context_t *cx, int argc, char *argv[])
+{
+  jmp_buf on_leave;
+
+  if (setjmp (on_leave) == 0)
     {
-      do_step();
+      cx->on_leave = &on_leave;
+      gettimeofday (&cx->t_start, NULL);
+
+      parse_args (cx, argc, argv);
+      replay_open (cx);
+      map_device (cx);
+      log_open (cx);
 
-      program.n_insns++;
-      if (max_insns && program.n_insns >= max_insns)
-        leave (LEAVE_TIMEOUT, "instruction count limit reached");
+      if (cx->options.do_runtime)
+        gettimeofday (&cx->t_load, NULL);
+
+      // -restore= takes the flash and the decoded program from the
+      // checkpoint.
+      checkpoint_open (cx);
+      if (!cx->options.do_restore)
+        load_to_flash (cx);
+      eeprom_open (cx);
+      checkpoint_resume (cx);
+
+      if (cx->options.do_runtime)
+        gettimeofday (&cx->t_decode, NULL);
+
+      if (!cx->options.do_restore)
+        decode_flash (cx);
+      fork_server_open (cx);
+
+      if (cx->options.do_runtime)
+        gettimeofday (&cx->t_execute, NULL);
+
+      log_init (cx, replay_seed (cx, cx->t_start.tv_usec
+                                 + cx->t_start.tv_sec));
+      log_checkpoint (cx, true);
+
+      execute (cx);
     }
+
+  cx->on_leave = NULL;
+  free_context (cx);
+  return cx->exit_code;
 }
 
 // main: as simple as it gets
 int
 main (int argc, char *argv[])
 {
-  gettimeofday (&t_start, NULL);
-
-  parse_args (argc, argv);
+  static context_t cx;
 
-  if (options.do_runtime)
-    gettimeofday (&t_load, NULL);
-
-  load_to_flash (program.name, cpu_flash, cpu_data, cpu_eeprom);
-
-  if (options.do_runtime)
-    gettimeofday (&t_decode, NULL);
+  init_context (&cx, stdin, stdout, stderr);
+  return run_context (&cx, argc, argv);
+}
 
-  decode_flash (decoded_flash, cpu_flash);
+// -batch:  Run one job in the calling thread of the job runner, with IN,
+// OUT and ERR as its stdin, stdout and stderr.  All state of the run is
+// in its own context, hence any number of jobs can run at the same time.
+// Put how the job left in *RESULT and return what main() would return.
 
-  if (options.do_runtime)
-    gettimeofday (&t_execute, NULL);
+int
+job_main (int argc, char *argv[], FILE *in, FILE *out, FILE *err,
+          job_result_t *result)
+{
+  context_t *cx = malloc (sizeof (context_t));
+  if (!cx)
+    {
+      fprintf (err, "%s: out of memory\n", argv[0]);
+      return exit_status[LEAVE_MEMORY].quiet_value;
+    }
 
-  log_init (t_start.tv_usec + t_start.tv_sec);
-  execute();
+  *result = (job_result_t) { 0, 0, 0, NULL };
+  init_context (cx, in, out, err);
+  cx->job = result;
+  int code = run_context (cx, argc, argv);
+  free (cx);
 
-  return EXIT_SUCCESS;
+  return code;
 }
+
+#endif // AVRTEST_LEAN
@@ -31,7 +31,12 @@ enum
     TICKS_RESET_PRAND_CMD  = 1 << 4,
     TICKS_RESET_ALL_CMD = TICKS_RESET_CYCLES_CMD
                           | TICKS_RESET_INSNS_CMD
-                          | TICKS_RESET_PRAND_CMD
+                          | TICKS_RESET_PRAND_CMD,
+
+    /* Return all 64 bits of cycles resp. insns in R18...R25.  */
+    TICKS_GET_64_CMD = 1 << 5,
+    TICKS_GET_CYCLES64_CMD = TICKS_GET_CYCLES_CMD | TICKS_GET_64_CMD,
+    TICKS_GET_INSNS64_CMD  = TICKS_GET_INSNS_CMD  | TICKS_GET_64_CMD
   };
 
 enum
@@ -316,6 +321,7 @@ AVRTEST_DEF_SYSCALL1 (_3, 3, unsigned, 24)
 /* Cycle count, instruction cound, (pseudo) random number */
 AVRTEST_DEF_SYSCALL1   (_4_r, 4, unsigned char, 24)
 AVRTEST_DEF_SYSCALL1_1 (_4_g, 4, unsigned long, 22, unsigned char, 24)
+AVRTEST_DEF_SYSCALL1_1 (_4_g64, 4, unsigned long long, 18, unsigned char, 24)
 
 /* Perf-meter control */
 AVRTEST_DEF_SYSCALL1 (_5, 5, unsigned char, 24)
@@ -342,6 +348,9 @@ AVRTEST_DEF_SYSCALL2 (_7_s16, 7,   signed int,  20, unsigned char, 24)
 AVRTEST_DEF_SYSCALL2 (_7_u32, 7, unsigned long, 20, unsigned char, 24)
 AVRTEST_DEF_SYSCALL2 (_7_s32, 7,   signed long, 20, unsigned char, 24)
 
+/* Raise an interrupt */
+AVRTEST_DEF_SYSCALL2 (_26, 26, unsigned long, 20, unsigned char, 24)
+
 #ifdef __UINT24_MAX__
 AVRTEST_DEF_SYSCALL2 (_7_u24, 7, __uint24, 20, unsigned char, 24)
 AVRTEST_DEF_SYSCALL2 (_7_s24, 7, __int24,  20, unsigned char, 24)
@@ -393,6 +402,18 @@ avrtest_insns (void)
   return avrtest_syscall_4_g (TICKS_GET_INSNS_CMD);
 }
 
+static AT_INLINE unsigned long long
+avrtest_cycles64 (void)
+{
+  return avrtest_syscall_4_g64 (TICKS_GET_CYCLES64_CMD);
+}
+
+static AT_INLINE unsigned long long
+avrtest_insns64 (void)
+{
+  return avrtest_syscall_4_g64 (TICKS_GET_INSNS64_CMD);
+}
+
 static AT_INLINE unsigned long
 avrtest_rand (void)
 {
@@ -429,6 +450,12 @@ avrtest_reset_all (void)
   avrtest_syscall_4_r (TICKS_RESET_ALL_CMD);
 }
 
+static AT_INLINE void
+avrtest_irq (unsigned char _vector, unsigned long _cycles)
+{
+  avrtest_syscall_26 (_cycles, _vector);
+}
+
 #undef AT_INLINE
 
 #endif /* IN_AVRTEST */
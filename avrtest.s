@@ -0,0 +1,14824 @@
+	.file	"avrtest.c"
+	.text
+	.p2align 4
+	.type	delay_loop, @function
+delay_loop:
+.LFB20:
+	.cfi_startproc
+	movq	%rdi, %r8	# 2	[c=4 l=3]  *movdi_internal/3
+	movq	%rdi, %rdx	# 5	[c=4 l=3]  *movdi_internal/3
+	xorl	%r9d, %r9d	# 229	[c=4 l=3]  *movdi_xor
+	movl	$1, %edi	# 6	[c=4 l=5]  *movsi_internal/0
+	xorl	%ecx, %ecx	# 230	[c=4 l=2]  *movdi_xor
+.L13:
+	movzbl	8(%rdx), %eax	# 16	[c=9 l=4]  *movqi_internal/4
+	cmpb	$65, %al	# 17	[c=4 l=2]  *cmpqi_1/0
+	je	.L2	# 18	[c=13 l=2]  *jcc
+	ja	.L3	# 23	[c=13 l=2]  *jcc
+	cmpb	$14, %al	# 25	[c=4 l=2]  *cmpqi_1/0
+	je	.L4	# 26	[c=13 l=6]  *jcc
+	cmpb	$26, %al	# 28	[c=4 l=2]  *cmpqi_1/0
+	jne	.L33	# 29	[c=13 l=6]  *jcc
+	testl	%ecx, %ecx	# 58	[c=4 l=2]  *cmpsi_ccno_1/0
+	jne	.L7	# 59	[c=13 l=2]  *jcc
+	.p2align 4,,10
+	.p2align 3
+.L31:
+	movzbl	10(%rdx), %r9d	# 61	[c=13 l=5]  *zero_extendqisi2/0
+	movl	$1, %ecx	# 10	[c=4 l=5]  *movsi_internal/0
+.L14:
+	cmpb	$101, %al	# 64	[c=4 l=2]  *cmpqi_1/0
+	movl	%r9d, (%rsi)	# 63	[c=4 l=3]  *movsi_internal/1
+	sete	%r9b	# 65	[c=4 l=4]  *setcc_qi
+.L2:
+	movzbl	9(%rdx), %eax	# 110	[c=13 l=4]  zero_extendqidi2/0
+	addl	$1, %edi	# 113	[c=4 l=3]  *addsi_1/0
+	salq	$4, %rax	# 111	[c=4 l=4]  *ashldi3_1/0
+	addq	%rax, %rdx	# 112	[c=4 l=3]  *adddi_1/0
+	cmpl	$17, %edi	# 115	[c=4 l=3]  *cmpsi_1/0
+	jne	.L13	# 116	[c=13 l=2]  *jcc
+	.p2align 4,,10
+	.p2align 3
+.L7:
+	xorl	%ecx, %ecx	# 226	[c=4 l=2]  *movdi_xor
+.L1:
+	movl	%ecx, %eax	# 152	[c=4 l=2]  *movsi_internal/0
+	ret		# 218	[c=0 l=1]  simple_return_internal
+	.p2align 4,,10
+	.p2align 3
+.L3:
+	cmpb	$77, %al	# 38	[c=4 l=2]  *cmpqi_1/0
+	jne	.L34	# 39	[c=13 l=2]  *jcc
+	testb	%r9b, %r9b	# 71	[c=4 l=3]  *cmpqi_ccno_1/0
+	je	.L7	# 72	[c=13 l=2]  *jcc
+	cmpw	$0, 12(%rdx)	# 74	[c=13 l=5]  *cmphi_ccno_1/1
+	jne	.L7	# 75	[c=13 l=2]  *jcc
+	movl	(%rsi), %eax	# 227	[c=5 l=2]  *movsi_internal/0
+	movzbl	10(%rdx), %r10d	# 77	[c=13 l=5]  *zero_extendqisi2/0
+	addl	%ecx, %eax	# 228	[c=4 l=2]  *addsi_1/0
+	cmpl	%eax, %r10d	# 80	[c=4 l=3]  *cmpsi_1/0
+	jne	.L7	# 81	[c=13 l=2]  *jcc
+	addl	$1, %ecx	# 83	[c=4 l=3]  *addsi_1/0
+	jmp	.L2	# 233	[c=1 l=2]  jump
+	.p2align 4,,10
+	.p2align 3
+.L33:
+	cmpb	$7, %al	# 31	[c=4 l=2]  *cmpqi_1/0
+	jne	.L7	# 32	[c=13 l=2]  *jcc
+	testl	%ecx, %ecx	# 51	[c=4 l=2]  *cmpsi_ccno_1/0
+	jne	.L7	# 52	[c=13 l=2]  *jcc
+	cmpw	$1, 12(%rdx)	# 133	[c=13 l=5]  *cmphi_1/0
+	jne	.L7	# 134	[c=13 l=2]  *jcc
+	movzbl	10(%rdx), %r9d	# 127	[c=13 l=5]  *zero_extendqisi2/0
+	movl	$2, %ecx	# 11	[c=4 l=5]  *movsi_internal/0
+	jmp	.L14	# 235	[c=1 l=5]  jump
+	.p2align 4,,10
+	.p2align 3
+.L34:
+	cmpb	$101, %al	# 41	[c=4 l=2]  *cmpqi_1/0
+	jne	.L7	# 42	[c=13 l=2]  *jcc
+	testl	%ecx, %ecx	# 44	[c=4 l=2]  *cmpsi_ccno_1/0
+	jne	.L7	# 45	[c=13 l=2]  *jcc
+	cmpw	$1, 12(%rdx)	# 145	[c=13 l=5]  *cmphi_1/0
+	jne	.L7	# 146	[c=13 l=2]  *jcc
+	jmp	.L31	# 238	[c=1 l=5]  jump
+	.p2align 4,,10
+	.p2align 3
+.L4:
+	testl	%ecx, %ecx	# 88	[c=4 l=2]  *cmpsi_ccno_1/0
+	je	.L7	# 89	[c=13 l=6]  *jcc
+	cmpw	$2, 12(%rdx)	# 91	[c=13 l=5]  *cmphi_1/0
+	jne	.L7	# 92	[c=13 l=6]  *jcc
+	movsbq	10(%rdx), %rax	# 94	[c=13 l=5]  extendqidi2
+	addq	$1, %rax	# 95	[c=4 l=4]  *adddi_1/0
+	salq	$4, %rax	# 96	[c=4 l=4]  *ashldi3_1/0
+	addq	%rax, %rdx	# 97	[c=4 l=3]  *adddi_1/0
+	cmpq	%rdx, %r8	# 98	[c=4 l=3]  *cmpdi_1/0
+	jne	.L7	# 99	[c=13 l=6]  *jcc
+	movzbl	11(%r8), %eax	# 101	[c=13 l=5]  *zero_extendqisi2/0
+	cmpl	%edi, %eax	# 102	[c=4 l=2]  *cmpsi_1/0
+	je	.L1	# 103	[c=13 l=6]  *jcc
+	jmp	.L7	# 241	[c=1 l=5]  jump
+	.cfi_endproc
+.LFE20:
+	.size	delay_loop, .-delay_loop
+	.p2align 4
+	.type	host_getchar, @function
+host_getchar:
+.LFB206:
+	.cfi_startproc
+	movq	896(%rdi), %rdi	# 6	[c=9 l=7]  *movdi_internal/3
+	jmp	getc@PLT	# 8	[c=10 l=5]  *sibcall_value
+	.cfi_endproc
+.LFE206:
+	.size	host_getchar, .-host_getchar
+	.p2align 4
+	.type	flash_changed, @function
+flash_changed:
+.LFB88:
+	.cfi_startproc
+	pushq	%rbp	# 63	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rdi, %rbp	# 2	[c=4 l=3]  *movdi_internal/3
+	pushq	%rbx	# 64	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	movl	%edx, %ebx	# 4	[c=4 l=2]  *movsi_internal/0
+	subq	$8, %rsp	# 65	[c=4 l=4]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_def_cfa_offset 32
+	call	redecode_flash@PLT	# 11	[c=10 l=5]  *call_value
+	movl	$510, %edx	# 55	[c=4 l=5]  *movsi_internal/0
+	movl	992(%rbp), %ecx	# 61	[c=9 l=6]  *movsi_internal/0
+	cmpl	%edx, %eax	# 56	[c=4 l=2]  *cmpsi_1/0
+	cmovb	%edx, %eax	# 57	[c=8 l=3]  *movsicc_noc/1
+	shrl	%ebx	# 17	[c=4 l=2]  *lshrsi3_1/0
+	leal	1(%rcx), %edx	# 62	[c=4 l=3]  *leasi
+	movl	120(%rbp), %ecx	# 20	[c=9 l=3]  *movsi_internal/0
+	addl	$2, %ebx	# 18	[c=4 l=3]  *addsi_1/0
+	subl	$510, %eax	# 14	[c=4 l=5]  *addsi_1/0
+	cmpl	%ebx, %edx	# 58	[c=4 l=2]  *cmpsi_1/0
+	cmova	%ebx, %edx	# 59	[c=8 l=3]  *movsicc_noc/1
+	testl	%ecx, %ecx	# 21	[c=4 l=2]  *cmpsi_ccno_1/0
+	je	.L37	# 22	[c=13 l=2]  *jcc
+	movl	116(%rbp), %esi	# 50	[c=9 l=3]  *movsi_internal/0
+	cmpl	%esi, %eax	# 51	[c=4 l=2]  *cmpsi_1/0
+	cmova	%esi, %eax	# 52	[c=8 l=3]  *movsicc_noc/1
+	cmpl	%ecx, %edx	# 53	[c=4 l=2]  *cmpsi_1/0
+	cmovb	%ecx, %edx	# 54	[c=8 l=3]  *movsicc_noc/1
+.L37:
+	movl	%eax, 116(%rbp)	# 29	[c=4 l=3]  *movsi_internal/1
+	movl	584(%rbp), %eax	# 79	[c=9 l=6]  *movsi_internal/0
+	movl	%edx, 120(%rbp)	# 28	[c=4 l=3]  *movsi_internal/1
+	testl	%eax, %eax	# 80	[c=4 l=2]  *cmpsi_ccno_1/0
+	jne	.L43	# 31	[c=13 l=2]  *jcc
+	addq	$8, %rsp	# 68	[c=4 l=4]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx	# 69	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 16
+	popq	%rbp	# 70	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 8
+	ret		# 71	[c=0 l=1]  simple_return_internal
+	.p2align 4,,10
+	.p2align 3
+.L43:
+	.cfi_restore_state
+	addq	$8, %rsp	# 75	[c=4 l=4]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_def_cfa_offset 24
+	movq	%rbp, %rdi	# 33	[c=4 l=3]  *movdi_internal/3
+	popq	%rbx	# 76	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 16
+	popq	%rbp	# 77	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 8
+	jmp	hle_forget@PLT	# 34	[c=0 l=5]  *sibcall
+	.cfi_endproc
+.LFE88:
+	.size	flash_changed, .-flash_changed
+	.p2align 4
+	.type	fuse_stat_cmp, @function
+fuse_stat_cmp:
+.LFB17:
+	.cfi_startproc
+	movq	(%rdi), %rax	# 48	[c=5 l=3]  *movdi_internal/3
+	movq	(%rsi), %rdx	# 50	[c=5 l=3]  *movdi_internal/3
+	shrq	$32, %rax	# 9	[c=4 l=4]  *lshrdi3_1/0
+	shrq	$32, %rdx	# 12	[c=4 l=4]  *lshrdi3_1/0
+	cmpl	%edx, %eax	# 14	[c=4 l=2]  *cmpsi_1/0
+	je	.L45	# 15	[c=13 l=2]  *jcc
+	subl	%edx, %eax	# 17	[c=4 l=2]  *subsi_1/0
+	ret		# 45	[c=0 l=1]  simple_return_internal
+	.p2align 4,,10
+	.p2align 3
+.L45:
+	movq	16(%rdi), %rdx	# 22	[c=9 l=4]  *movdi_internal/3
+	movq	16(%rsi), %rcx	# 23	[c=9 l=4]  *movdi_internal/3
+	movl	$1, %eax	# 5	[c=4 l=5]  *movsi_internal/0
+	cmpq	%rcx, %rdx	# 24	[c=4 l=3]  *cmpdi_1/0
+	jb	.L44	# 25	[c=13 l=2]  *jcc
+	cmpq	%rdx, %rcx	# 27	[c=4 l=3]  *cmpdi_1/0
+	sbbl	%eax, %eax	# 30	[c=8 l=2]  *x86_movsicc_0_m1_neg
+.L44:
+	ret		# 54	[c=0 l=1]  simple_return_internal
+	.cfi_endproc
+.LFE17:
+	.size	fuse_stat_cmp, .-fuse_stat_cmp
+	.p2align 4
+	.type	fuse_window.part.0.constprop.0, @function
+fuse_window.part.0.constprop.0:
+.LFB234:
+	.cfi_startproc
+	movzbl	8(%rsi), %eax	# 21	[c=9 l=4]  *movqi_internal/4
+	movq	%rdi, %rcx	# 2	[c=4 l=3]  *movdi_internal/3
+	movb	%al, (%rdx)	# 22	[c=4 l=2]  *movqi_internal/8
+	cmpb	$25, %al	# 25	[c=4 l=2]  *cmpqi_1/0
+	jbe	.L80	# 26	[c=13 l=6]  *jcc
+	subl	$28, %eax	# 328	[c=4 l=3]  *addsi_1/0
+	cmpb	$60, %al	# 57	[c=4 l=2]  *cmpqi_1/0
+	ja	.L52	# 58	[c=13 l=2]  *jcc
+	movabsq	$2303723150795361347, %r8	# 319	[c=1 l=10]  *movdi_internal/4
+	movl	$1, %edi	# 10	[c=4 l=5]  *movsi_internal/0
+	btq	%rax, %r8	# 317	[c=4 l=4]  *btdi/0
+	jc	.L48	# 318	[c=13 l=6]  *jcc
+.L52:
+	movzbl	9(%rsi), %eax	# 61	[c=13 l=4]  zero_extendqidi2/0
+	salq	$4, %rax	# 62	[c=4 l=4]  *ashldi3_1/0
+	addq	%rax, %rsi	# 63	[c=4 l=3]  *adddi_1/0
+	movl	992(%rcx), %eax	# 64	[c=10 l=6]  *zero_extendsidi2/3
+	salq	$4, %rax	# 65	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rcx), %rax	# 67	[c=13 l=7]  *adddi_1/1
+	cmpq	%rsi, %rax	# 68	[c=4 l=3]  *cmpdi_1/0
+	jb	.L68	# 69	[c=13 l=6]  *jcc
+	cmpb	$0, 11(%rsi)	# 71	[c=13 l=4]  *cmpqi_ccno_1/1
+	je	.L68	# 72	[c=13 l=6]  *jcc
+	movzbl	8(%rsi), %eax	# 74	[c=9 l=4]  *movqi_internal/4
+	movb	%al, 1(%rdx)	# 75	[c=4 l=3]  *movqi_internal/8
+	cmpb	$25, %al	# 78	[c=4 l=2]  *cmpqi_1/0
+	jbe	.L81	# 79	[c=13 l=6]  *jcc
+	subl	$28, %eax	# 327	[c=4 l=3]  *addsi_1/0
+	cmpb	$60, %al	# 110	[c=4 l=2]  *cmpqi_1/0
+	ja	.L58	# 111	[c=13 l=2]  *jcc
+	movabsq	$2303723150795361347, %r8	# 321	[c=1 l=10]  *movdi_internal/4
+	movl	$2, %edi	# 11	[c=4 l=5]  *movsi_internal/0
+	btq	%rax, %r8	# 313	[c=4 l=4]  *btdi/0
+	jc	.L48	# 314	[c=13 l=6]  *jcc
+.L58:
+	movzbl	9(%rsi), %eax	# 114	[c=13 l=4]  zero_extendqidi2/0
+	salq	$4, %rax	# 115	[c=4 l=4]  *ashldi3_1/0
+	addq	%rax, %rsi	# 116	[c=4 l=3]  *adddi_1/0
+	movl	992(%rcx), %eax	# 117	[c=10 l=6]  *zero_extendsidi2/3
+	salq	$4, %rax	# 118	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rcx), %rax	# 120	[c=13 l=7]  *adddi_1/1
+	cmpq	%rsi, %rax	# 121	[c=4 l=3]  *cmpdi_1/0
+	jb	.L72	# 122	[c=13 l=6]  *jcc
+	cmpb	$0, 11(%rsi)	# 124	[c=13 l=4]  *cmpqi_ccno_1/1
+	je	.L72	# 125	[c=13 l=6]  *jcc
+	movzbl	8(%rsi), %eax	# 127	[c=9 l=4]  *movqi_internal/4
+	movb	%al, 2(%rdx)	# 128	[c=4 l=3]  *movqi_internal/8
+	cmpb	$25, %al	# 131	[c=4 l=2]  *cmpqi_1/0
+	jbe	.L82	# 132	[c=13 l=6]  *jcc
+	subl	$28, %eax	# 326	[c=4 l=3]  *addsi_1/0
+	cmpb	$60, %al	# 163	[c=4 l=2]  *cmpqi_1/0
+	ja	.L62	# 164	[c=13 l=2]  *jcc
+	movabsq	$2303723150795361347, %r8	# 323	[c=1 l=10]  *movdi_internal/4
+	movl	$3, %edi	# 8	[c=4 l=5]  *movsi_internal/0
+	btq	%rax, %r8	# 309	[c=4 l=4]  *btdi/0
+	jc	.L48	# 310	[c=13 l=2]  *jcc
+.L62:
+	movzbl	9(%rsi), %eax	# 167	[c=13 l=4]  zero_extendqidi2/0
+	salq	$4, %rax	# 168	[c=4 l=4]  *ashldi3_1/0
+	addq	%rax, %rsi	# 169	[c=4 l=3]  *adddi_1/0
+	movl	992(%rcx), %eax	# 170	[c=10 l=6]  *zero_extendsidi2/3
+	salq	$4, %rax	# 171	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rcx), %rax	# 173	[c=13 l=7]  *adddi_1/1
+	cmpq	%rsi, %rax	# 174	[c=4 l=3]  *cmpdi_1/0
+	jb	.L76	# 175	[c=13 l=6]  *jcc
+	cmpb	$0, 11(%rsi)	# 177	[c=13 l=4]  *cmpqi_ccno_1/1
+	je	.L76	# 178	[c=13 l=6]  *jcc
+	movzbl	8(%rsi), %eax	# 180	[c=9 l=4]  *movqi_internal/4
+	movl	$4, %edi	# 18	[c=4 l=5]  *movsi_internal/0
+	movb	%al, 3(%rdx)	# 181	[c=4 l=3]  *movqi_internal/8
+.L48:
+	movl	%edi, %eax	# 199	[c=4 l=2]  *movsi_internal/0
+	ret		# 331	[c=0 l=1]  simple_return_internal
+	.p2align 4,,10
+	.p2align 3
+.L80:
+	movl	$50651151, %r8d	# 320	[c=4 l=6]  *movdi_internal/2
+	movl	$1, %edi	# 7	[c=4 l=5]  *movsi_internal/0
+	btq	%rax, %r8	# 315	[c=4 l=4]  *btdi/0
+	jnc	.L52	# 316	[c=13 l=6]  *jcc
+	movl	%edi, %eax	# 343	[c=4 l=2]  *movsi_internal/0
+	ret		# 346	[c=0 l=1]  simple_return_internal
+	.p2align 4,,10
+	.p2align 3
+.L82:
+	movl	$50651151, %r8d	# 324	[c=4 l=6]  *movdi_internal/2
+	movl	$3, %edi	# 9	[c=4 l=5]  *movsi_internal/0
+	btq	%rax, %r8	# 307	[c=4 l=4]  *btdi/0
+	jnc	.L62	# 308	[c=13 l=2]  *jcc
+	jmp	.L48	# 362	[c=1 l=2]  jump
+	.p2align 4,,10
+	.p2align 3
+.L81:
+	movl	$50651151, %r8d	# 322	[c=4 l=6]  *movdi_internal/2
+	movl	$2, %edi	# 6	[c=4 l=5]  *movsi_internal/0
+	btq	%rax, %r8	# 311	[c=4 l=4]  *btdi/0
+	jnc	.L58	# 312	[c=13 l=6]  *jcc
+	movl	%edi, %eax	# 351	[c=4 l=2]  *movsi_internal/0
+	ret		# 354	[c=0 l=1]  simple_return_internal
+	.p2align 4,,10
+	.p2align 3
+.L68:
+	movl	$1, %edi	# 16	[c=4 l=5]  *movsi_internal/0
+	jmp	.L48	# 364	[c=1 l=2]  jump
+.L72:
+	movl	$2, %edi	# 17	[c=4 l=5]  *movsi_internal/0
+	jmp	.L48	# 366	[c=1 l=2]  jump
+.L76:
+	movl	$3, %edi	# 15	[c=4 l=5]  *movsi_internal/0
+	jmp	.L48	# 368	[c=1 l=5]  jump
+	.cfi_endproc
+.LFE234:
+	.size	fuse_window.part.0.constprop.0, .-fuse_window.part.0.constprop.0
+	.p2align 4
+	.type	fuse_lookup, @function
+fuse_lookup:
+.LFB14:
+	.cfi_startproc
+	pushq	%r15	# 92	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	xorl	%r15d, %r15d	# 118	[c=4 l=3]  *movdi_xor
+	pushq	%r14	# 93	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13	# 94	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12	# 95	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp	# 96	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx	# 97	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$24, %rsp	# 98	[c=4 l=4]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_def_cfa_offset 80
+	cmpb	$0, 11(%rsi)	# 12	[c=13 l=4]  *cmpqi_ccno_1/1
+	je	.L84	# 13	[c=13 l=2]  *jcc
+	leaq	12(%rsp), %rdx	# 91	[c=4 l=5]  *leadi
+	call	fuse_window.part.0.constprop.0	# 19	[c=10 l=5]  *call_value
+	movl	%eax, %r15d	# 20	[c=4 l=3]  *movsi_internal/0
+.L84:
+	leaq	4+fuse_seq(%rip), %rbx	# 23	[c=1 l=7]  *movdi_internal/4
+	xorl	%ebp, %ebp	# 117	[c=4 l=2]  *movdi_xor
+	movl	$-1, %r13d	# 7	[c=4 l=6]  *movsi_internal/0
+	leaq	12(%rsp), %r14	# 90	[c=4 l=5]  *leadi
+	jmp	.L86	# 125	[c=1 l=2]  jump
+	.p2align 4,,10
+	.p2align 3
+.L93:
+	movslq	%r13d, %rax	# 48	[c=4 l=3]  *extendsidi2_rex64/1
+	leaq	fuse_seq(%rip), %rcx	# 89	[c=1 l=7]  *movdi_internal/4
+	salq	$4, %rax	# 49	[c=4 l=4]  *ashldi3_1/0
+	cmpl	(%rcx,%rax), %r12d	# 76	[c=13 l=4]  *cmpsi_1/1
+	cmovg	%ebp, %r13d	# 77	[c=8 l=4]  *movsicc_noc/1
+	.p2align 4,,10
+	.p2align 3
+.L85:
+	addl	$1, %ebp	# 56	[c=4 l=3]  *addsi_1/0
+	addq	$16, %rbx	# 57	[c=4 l=4]  *adddi_1/0
+	cmpl	$41, %ebp	# 59	[c=4 l=3]  *cmpsi_1/0
+	je	.L92	# 60	[c=13 l=2]  *jcc
+.L86:
+	movl	-4(%rbx), %r12d	# 26	[c=9 l=4]  *movsi_internal/0
+	cmpl	%r15d, %r12d	# 27	[c=4 l=3]  *cmpsi_1/0
+	jg	.L85	# 28	[c=13 l=2]  *jcc
+	movslq	%r12d, %rdx	# 32	[c=4 l=3]  *extendsidi2_rex64/1
+	movq	%r14, %rsi	# 35	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rdi	# 36	[c=4 l=3]  *movdi_internal/3
+	call	memcmp@PLT	# 37	[c=10 l=5]  *call_value
+	testl	%eax, %eax	# 41	[c=4 l=2]  *cmpsi_ccno_1/0
+	jne	.L85	# 42	[c=13 l=2]  *jcc
+	cmpl	$-1, %r13d	# 44	[c=4 l=4]  *cmpsi_1/0
+	jne	.L93	# 45	[c=13 l=2]  *jcc
+	movl	%ebp, %r13d	# 9	[c=4 l=3]  *movsi_internal/0
+	addl	$1, %ebp	# 120	[c=4 l=3]  *addsi_1/0
+	addq	$16, %rbx	# 121	[c=4 l=4]  *adddi_1/0
+	cmpl	$41, %ebp	# 122	[c=4 l=3]  *cmpsi_1/0
+	jne	.L86	# 123	[c=13 l=2]  *jcc
+.L92:
+	addq	$24, %rsp	# 101	[c=4 l=4]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_def_cfa_offset 56
+	movl	%r13d, %eax	# 65	[c=4 l=3]  *movsi_internal/0
+	popq	%rbx	# 102	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 48
+	popq	%rbp	# 103	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 40
+	popq	%r12	# 104	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 32
+	popq	%r13	# 105	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 24
+	popq	%r14	# 106	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 16
+	popq	%r15	# 107	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 8
+	ret		# 108	[c=0 l=1]  simple_return_internal
+	.cfi_endproc
+.LFE14:
+	.size	fuse_lookup, .-fuse_lookup
+	.p2align 4
+	.globl	qprintf
+	.type	qprintf, @function
+qprintf:
+.LFB23:
+	.cfi_startproc
+	subq	$216, %rsp	# 50	[c=4 l=7]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_def_cfa_offset 224
+	movq	%rdx, 48(%rsp)	# 4	[c=4 l=5]  *movdi_internal/5
+	movq	%rcx, 56(%rsp)	# 5	[c=4 l=5]  *movdi_internal/5
+	movq	%r8, 64(%rsp)	# 6	[c=4 l=5]  *movdi_internal/5
+	movq	%r9, 72(%rsp)	# 7	[c=4 l=5]  *movdi_internal/5
+	testb	%al, %al	# 8	[c=4 l=2]  *cmpqi_ccno_1/0
+	je	.L97	# 9	[c=13 l=2]  *jcc
+	movaps	%xmm0, 80(%rsp)	# 10	[c=4 l=5]  movv4sf_internal/3
+	movaps	%xmm1, 96(%rsp)	# 11	[c=4 l=5]  movv4sf_internal/3
+	movaps	%xmm2, 112(%rsp)	# 12	[c=4 l=5]  movv4sf_internal/3
+	movaps	%xmm3, 128(%rsp)	# 13	[c=4 l=8]  movv4sf_internal/3
+	movaps	%xmm4, 144(%rsp)	# 14	[c=4 l=8]  movv4sf_internal/3
+	movaps	%xmm5, 160(%rsp)	# 15	[c=4 l=8]  movv4sf_internal/3
+	movaps	%xmm6, 176(%rsp)	# 16	[c=4 l=8]  movv4sf_internal/3
+	movaps	%xmm7, 192(%rsp)	# 17	[c=4 l=8]  movv4sf_internal/3
+.L97:
+	movl	216(%rdi), %eax	# 58	[c=9 l=6]  *movsi_internal/0
+	testl	%eax, %eax	# 59	[c=4 l=2]  *cmpsi_ccno_1/0
+	je	.L99	# 23	[c=13 l=2]  *jcc
+	addq	$216, %rsp	# 53	[c=4 l=7]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_remember_state
+	.cfi_def_cfa_offset 8
+	ret		# 54	[c=0 l=1]  simple_return_internal
+	.p2align 4,,10
+	.p2align 3
+.L99:
+	.cfi_restore_state
+	leaq	224(%rsp), %rax	# 47	[c=4 l=8]  *leadi
+	movq	904(%rdi), %rdi	# 31	[c=9 l=7]  *movdi_internal/3
+	leaq	8(%rsp), %rdx	# 49	[c=4 l=5]  *leadi
+	movl	$16, 8(%rsp)	# 26	[c=4 l=8]  *movsi_internal/1
+	movq	%rax, 16(%rsp)	# 28	[c=4 l=5]  *movdi_internal/5
+	leaq	32(%rsp), %rax	# 48	[c=4 l=5]  *leadi
+	movl	$48, 12(%rsp)	# 27	[c=4 l=8]  *movsi_internal/1
+	movq	%rax, 24(%rsp)	# 29	[c=4 l=5]  *movdi_internal/5
+	call	vfprintf@PLT	# 35	[c=10 l=5]  *call_value
+	addq	$216, %rsp	# 62	[c=4 l=7]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_def_cfa_offset 8
+	ret		# 63	[c=0 l=1]  simple_return_internal
+	.cfi_endproc
+.LFE23:
+	.size	qprintf, .-qprintf
+	.p2align 4
+	.globl	quit
+	.type	quit, @function
+quit:
+.LFB27:
+	.cfi_startproc
+	subq	$8, %rsp	# 18	[c=4 l=4]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_def_cfa_offset 16
+	movl	%esi, 136(%rdi)	# 7	[c=4 l=6]  *movsi_internal/1
+	movl	$1, %esi	# 9	[c=4 l=5]  *movsi_internal/0
+	movq	128(%rdi), %rdi	# 8	[c=9 l=7]  *movdi_internal/3
+	call	longjmp@PLT	# 11	[c=0 l=5]  *call
+	.cfi_endproc
+.LFE27:
+	.size	quit, .-quit
+	.section	.rodata.str1.1,"aMS",@progbits,1
+.LC0:
+	.string	"ABORTED"
+.LC1:
+	.string	"w"
+.LC2:
+	.string	"%s: cannot write -status=%s\n"
+.LC3:
+	.string	"%d %lu %lu %s\n"
+	.text
+	.p2align 4
+	.type	finish, @function
+finish:
+.LFB28:
+	.cfi_startproc
+	pushq	%r12	# 117	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	pushq	%rbp	# 118	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	movl	%esi, %ebp	# 3	[c=4 l=2]  *movsi_internal/0
+	pushq	%rbx	# 119	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	movl	440(%rdi), %esi	# 132	[c=9 l=6]  *movsi_internal/0
+	movq	%rdi, %rbx	# 2	[c=4 l=3]  *movdi_internal/3
+	testl	%esi, %esi	# 133	[c=4 l=2]  *cmpsi_ccno_1/0
+	jne	.L114	# 10	[c=13 l=2]  *jcc
+.L103:
+	movq	11016(%rbx), %rax	# 62	[c=9 l=7]  *movdi_internal/3
+	testq	%rax, %rax	# 63	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L106	# 64	[c=13 l=2]  *jcc
+	movdqu	40(%rbx), %xmm0	# 114	[c=13 l=5]  movv2di_internal/2
+	movl	76(%rbx), %ecx	# 128	[c=9 l=3]  *movsi_internal/0
+	movl	%ebp, (%rax)	# 66	[c=4 l=2]  *movsi_internal/1
+	leaq	.LC0(%rip), %rdx	# 6	[c=1 l=7]  *movdi_internal/4
+	shufpd	$1, %xmm0, %xmm0	# 70	[c=4 l=5]  sse2_shufpd_v2di/0
+	movups	%xmm0, 8(%rax)	# 71	[c=4 l=4]  movv2di_internal/3
+	testl	%ecx, %ecx	# 129	[c=4 l=2]  *cmpsi_ccno_1/0
+	je	.L115	# 73	[c=13 l=2]  *jcc
+.L107:
+	movq	%rdx, 24(%rax)	# 83	[c=4 l=4]  *movdi_internal/5
+.L106:
+	movl	%ebp, %esi	# 86	[c=4 l=2]  *movsi_internal/0
+	movq	%rbx, %rdi	# 87	[c=4 l=3]  *movdi_internal/3
+	call	quit	# 88	[c=0 l=5]  *call
+.L115:
+	movslq	72(%rbx), %rdx	# 77	[c=13 l=4]  *extendsidi2_rex64/1
+	leaq	exit_status(%rip), %rcx	# 112	[c=1 l=7]  *movdi_internal/4
+	imulq	$24, %rdx, %rdx	# 78	[c=16 l=4]  *muldi3_1/0
+	movq	(%rcx,%rdx), %rdx	# 80	[c=9 l=4]  *movdi_internal/3
+	jmp	.L107	# 136	[c=1 l=2]  jump
+.L114:
+	movq	448(%rdi), %rdi	# 12	[c=9 l=7]  *movdi_internal/3
+	leaq	.LC1(%rip), %rsi	# 13	[c=1 l=7]  *movdi_internal/4
+	call	fopen@PLT	# 16	[c=10 l=5]  *call_value
+	movq	%rax, %r12	# 17	[c=4 l=3]  *movdi_internal/3
+	testq	%rax, %rax	# 19	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L116	# 20	[c=13 l=2]  *jcc
+	cmpl	$0, 76(%rbx)	# 36	[c=13 l=4]  *cmpsi_ccno_1/1
+	leaq	.LC0(%rip), %r9	# 5	[c=1 l=7]  *movdi_internal/4
+	je	.L117	# 37	[c=13 l=2]  *jcc
+.L105:
+	movq	48(%rbx), %rcx	# 48	[c=9 l=4]  *movdi_internal/3
+	movq	40(%rbx), %r8	# 50	[c=9 l=4]  *movdi_internal/3
+	movq	%r12, %rdi	# 55	[c=4 l=3]  *movdi_internal/3
+	movl	%ebp, %edx	# 52	[c=4 l=2]  *movsi_internal/0
+	leaq	.LC3(%rip), %rsi	# 53	[c=1 l=7]  *movdi_internal/4
+	xorl	%eax, %eax	# 130	[c=4 l=2]  *movdi_xor
+	call	fprintf@PLT	# 57	[c=10 l=5]  *call_value
+	movq	%r12, %rdi	# 58	[c=4 l=3]  *movdi_internal/3
+	call	fclose@PLT	# 59	[c=10 l=5]  *call_value
+	jmp	.L103	# 140	[c=1 l=5]  jump
+.L117:
+	movslq	72(%rbx), %rax	# 41	[c=13 l=4]  *extendsidi2_rex64/1
+	leaq	exit_status(%rip), %rdx	# 111	[c=1 l=7]  *movdi_internal/4
+	imulq	$24, %rax, %rax	# 42	[c=16 l=4]  *muldi3_1/0
+	movq	(%rdx,%rax), %r9	# 44	[c=9 l=4]  *movdi_internal/3
+	jmp	.L105	# 142	[c=1 l=2]  jump
+.L116:
+	movq	448(%rbx), %rcx	# 22	[c=9 l=7]  *movdi_internal/3
+	movq	144(%rbx), %rdx	# 23	[c=9 l=7]  *movdi_internal/3
+	leaq	.LC2(%rip), %rsi	# 27	[c=1 l=7]  *movdi_internal/4
+	xorl	%eax, %eax	# 131	[c=4 l=2]  *movdi_xor
+	movq	912(%rbx), %rdi	# 24	[c=9 l=7]  *movdi_internal/3
+	call	fprintf@PLT	# 31	[c=10 l=5]  *call_value
+	jmp	.L103	# 144	[c=1 l=5]  jump
+	.cfi_endproc
+.LFE28:
+	.size	finish, .-finish
+	.p2align 4
+	.globl	set_elf_string_table
+	.type	set_elf_string_table, @function
+set_elf_string_table:
+.LFB57:
+	.cfi_startproc
+	pushq	%rbx	# 26	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	movq	%rdi, %rbx	# 2	[c=4 l=3]  *movdi_internal/3
+	movq	%rsi, 5216(%rdi)	# 9	[c=4 l=7]  *movdi_internal/5
+	movq	%rdx, 5224(%rdi)	# 10	[c=4 l=7]  *movdi_internal/5
+	call	checkpoint_string_table@PLT	# 15	[c=0 l=5]  *call
+	movq	%rbx, %rdi	# 16	[c=4 l=3]  *movdi_internal/3
+	popq	%rbx	# 33	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 8
+	jmp	hle_set_string_table@PLT	# 17	[c=0 l=5]  *sibcall
+	.cfi_endproc
+.LFE57:
+	.size	set_elf_string_table, .-set_elf_string_table
+	.p2align 4
+	.globl	finish_elf_string_table
+	.type	finish_elf_string_table, @function
+finish_elf_string_table:
+.LFB58:
+	.cfi_startproc
+	ret		# 11	[c=0 l=1]  simple_return_internal
+	.cfi_endproc
+.LFE58:
+	.size	finish_elf_string_table, .-finish_elf_string_table
+	.p2align 4
+	.globl	set_elf_function_symbol
+	.type	set_elf_function_symbol, @function
+set_elf_function_symbol:
+.LFB59:
+	.cfi_startproc
+	pushq	%r12	# 32	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	movzbl	%cl, %ecx	# 10	[c=4 l=3]  *zero_extendqisi2/0
+	movq	%rdx, %r12	# 4	[c=4 l=3]  *movdi_internal/3
+	pushq	%rbp	# 33	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	movl	%esi, %ebp	# 3	[c=4 l=2]  *movsi_internal/0
+	pushq	%rbx	# 34	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	movq	%rdi, %rbx	# 2	[c=4 l=3]  *movdi_internal/3
+	call	checkpoint_symbol@PLT	# 15	[c=0 l=5]  *call
+	movq	%r12, %rdx	# 16	[c=4 l=3]  *movdi_internal/3
+	movl	%ebp, %esi	# 17	[c=4 l=2]  *movsi_internal/0
+	movq	%rbx, %rdi	# 18	[c=4 l=3]  *movdi_internal/3
+	call	fork_server_set_function_symbol@PLT	# 19	[c=0 l=5]  *call
+	movq	%r12, %rdx	# 20	[c=4 l=3]  *movdi_internal/3
+	movl	%ebp, %esi	# 21	[c=4 l=2]  *movsi_internal/0
+	movq	%rbx, %rdi	# 22	[c=4 l=3]  *movdi_internal/3
+	popq	%rbx	# 43	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 24
+	popq	%rbp	# 44	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 16
+	popq	%r12	# 45	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 8
+	jmp	hle_set_function_symbol@PLT	# 23	[c=0 l=5]  *sibcall
+	.cfi_endproc
+.LFE59:
+	.size	set_elf_function_symbol, .-set_elf_function_symbol
+	.section	.rodata.str1.8,"aMS",@progbits,1
+	.align 8
+.LC4:
+	.string	"out of memory allocating %u * %u bytes for %s"
+	.text
+	.p2align 4
+	.globl	get_mem
+	.type	get_mem, @function
+get_mem:
+.LFB62:
+	.cfi_startproc
+	pushq	%r13	# 87	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 16
+	.cfi_offset 13, -16
+	movl	%esi, %esi	# 3	[c=1 l=2]  *zero_extendsidi2/3
+	movq	%rdx, %r13	# 4	[c=4 l=3]  *movdi_internal/3
+	pushq	%r12	# 88	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 24
+	.cfi_offset 12, -24
+	movq	%rdi, %r12	# 2	[c=4 l=3]  *movdi_internal/3
+	pushq	%rbp	# 89	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 32
+	.cfi_offset 6, -32
+	movq	%rcx, %rbp	# 5	[c=4 l=3]  *movdi_internal/3
+	pushq	%rbx	# 90	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 40
+	.cfi_offset 3, -40
+	movq	%rsi, %rbx	# 86	[c=4 l=3]  *movdi_internal/3
+	subq	$8, %rsp	# 91	[c=4 l=4]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_def_cfa_offset 48
+	testq	%rdx, %rdx	# 10	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L124	# 11	[c=13 l=2]  *jcc
+	movq	$-33, %rax	# 13	[c=4 l=7]  *movdi_internal/3
+	xorl	%edx, %edx	# 104	[c=4 l=2]  *movdi_xor
+	divq	%r13	# 84	[c=0 l=3]  *udivmoddi4_noext
+	cmpq	%rsi, %rax	# 15	[c=4 l=3]  *cmpdi_1/0
+	jb	.L125	# 16	[c=13 l=2]  *jcc
+.L124:
+	imulq	%r13, %rsi	# 30	[c=16 l=4]  *muldi3_1/2
+	movl	$1, %edi	# 33	[c=4 l=5]  *movdi_internal/2
+	addq	$32, %rsi	# 31	[c=4 l=4]  *adddi_1/0
+	call	calloc@PLT	# 34	[c=10 l=5]  *call_value
+	testq	%rax, %rax	# 38	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L125	# 39	[c=13 l=2]  *jcc
+	movq	984(%r12), %rdx	# 42	[c=9 l=8]  *movdi_internal/3
+	movq	$0, 8(%rax)	# 41	[c=4 l=8]  *movdi_internal/5
+	movq	%rdx, (%rax)	# 43	[c=4 l=3]  *movdi_internal/5
+	testq	%rdx, %rdx	# 44	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L126	# 45	[c=13 l=2]  *jcc
+	movq	%rax, 8(%rdx)	# 47	[c=4 l=4]  *movdi_internal/5
+.L126:
+	movq	%rax, 984(%r12)	# 50	[c=4 l=8]  *movdi_internal/5
+	addq	$8, %rsp	# 94	[c=4 l=4]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	addq	$32, %rax	# 51	[c=4 l=4]  *adddi_1/0
+	popq	%rbx	# 95	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 32
+	popq	%rbp	# 96	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 24
+	popq	%r12	# 97	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 16
+	popq	%r13	# 98	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 8
+	ret		# 99	[c=0 l=1]  simple_return_internal
+.L125:
+	.cfi_restore_state
+	movq	%rbp, %r9	# 18	[c=4 l=3]  *movdi_internal/3
+	movl	%r13d, %r8d	# 19	[c=4 l=3]  *movsi_internal/0
+	movl	%ebx, %ecx	# 20	[c=4 l=2]  *movsi_internal/0
+	movl	$6, %esi	# 23	[c=4 l=5]  *movsi_internal/0
+	leaq	.LC4(%rip), %rdx	# 21	[c=1 l=7]  *movdi_internal/4
+	movq	%r12, %rdi	# 24	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 103	[c=4 l=2]  *movdi_xor
+	call	leave	# 26	[c=0 l=5]  *call
+	.cfi_endproc
+.LFE62:
+	.size	get_mem, .-get_mem
+	.section	.rodata.str1.1
+.LC6:
+	.string	"instructions"
+.LC7:
+	.string	"executed"
+.LC8:
+	.string	"sites"
+.LC9:
+	.string	"superinstruction"
+.LC10:
+	.string	"%-44s %9s %12s  %12s\n"
+.LC12:
+	.string	"%-44s %9u %12lu  %11.2f%%\n"
+.LC13:
+	.string	"-fuse-stats"
+.LC14:
+	.string	"most executed sequence"
+.LC15:
+	.string	"\n%-44s %9s %12s  %12s\n"
+	.text
+	.p2align 4
+	.type	print_fuse_stats, @function
+print_fuse_stats:
+.LFB19:
+	.cfi_startproc
+	pushq	%r15	# 1122	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	xorl	%eax, %eax	# 1166	[c=4 l=2]  *movdi_xor
+	movq	%rdi, %r15	# 2	[c=4 l=3]  *movdi_internal/3
+	movl	$20, %ecx	# 35	[c=4 l=5]  *movdi_internal/2
+	pushq	%r14	# 1123	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13	# 1124	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12	# 1125	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp	# 1126	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx	# 1127	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$664, %rsp	# 1128	[c=4 l=7]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_def_cfa_offset 720
+	leaq	144(%rsp), %r14	# 1117	[c=4 l=8]  *leadi
+	leaq	320(%rsp), %rbp	# 1118	[c=4 l=8]  *leadi
+	movq	%r14, %rdi	# 1032	[c=4 l=3]  *movdi_internal/3
+	rep stosq	# 36	[c=0 l=3]  *rep_stosdi_rex64
+	movl	$41, %ecx	# 41	[c=4 l=5]  *movdi_internal/2
+	movl	$0, (%rdi)	# 37	[c=4 l=6]  *movsi_internal/1
+	movq	%rbp, %rdi	# 1034	[c=4 l=3]  *movdi_internal/3
+	rep stosq	# 42	[c=0 l=3]  *rep_stosdi_rex64
+	movq	10984(%r15), %rax	# 43	[c=9 l=7]  *movdi_internal/3
+	testq	%rax, %rax	# 44	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L137	# 45	[c=13 l=6]  *jcc
+	movl	992(%r15), %ebx	# 47	[c=9 l=7]  *movsi_internal/0
+	movq	1064(%r15), %r11	# 48	[c=9 l=7]  *movdi_internal/3
+	movq	%r15, 32(%rsp)	# 885	[c=4 l=5]  *movdi_internal/5
+	xorl	%r9d, %r9d	# 1165	[c=4 l=3]  *movdi_xor
+	movq	%rbp, 48(%rsp)	# 886	[c=4 l=5]  *movdi_internal/5
+	movl	%ebx, (%rsp)	# 1035	[c=4 l=3]  *movsi_internal/1
+	movq	%r14, 56(%rsp)	# 887	[c=4 l=5]  *movdi_internal/5
+	movq	%rax, 40(%rsp)	# 882	[c=4 l=5]  *movdi_internal/5
+	movq	%r11, %rax	# 883	[c=4 l=3]  *movdi_internal/3
+	movl	%r9d, %r11d	# 884	[c=4 l=3]  *movsi_internal/0
+	movq	%rax, %r9	# 888	[c=4 l=3]  *movdi_internal/3
+	.p2align 4,,10
+	.p2align 3
+.L148:
+	movl	%r11d, %r10d	# 50	[c=1 l=3]  *zero_extendsidi2/3
+	movq	%r10, %rsi	# 1036	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rsi	# 51	[c=4 l=4]  *ashldi3_1/0
+	addq	%r9, %rsi	# 52	[c=4 l=3]  *adddi_1/0
+	cmpb	$0, 11(%rsi)	# 53	[c=13 l=4]  *cmpqi_ccno_1/1
+	je	.L140	# 54	[c=13 l=6]  *jcc
+	movzbl	8(%rsi), %eax	# 60	[c=9 l=4]  *movqi_internal/4
+	cmpb	$25, %al	# 63	[c=4 l=2]  *cmpqi_1/0
+	jbe	.L239	# 64	[c=13 l=6]  *jcc
+	subl	$28, %eax	# 1116	[c=4 l=3]  *addsi_1/0
+	cmpb	$60, %al	# 95	[c=4 l=2]  *cmpqi_1/0
+	ja	.L143	# 96	[c=13 l=2]  *jcc
+	movabsq	$2303723150795361347, %rdi	# 1038	[c=1 l=10]  *movdi_internal/4
+	btq	%rax, %rdi	# 878	[c=4 l=4]  *btdi/0
+	jc	.L140	# 879	[c=13 l=6]  *jcc
+.L143:
+	movq	32(%rsp), %rdi	# 102	[c=9 l=5]  *movdi_internal/3
+	leaq	64(%rsp), %r14	# 99	[c=4 l=5]  *leadi
+	xorl	%r13d, %r13d	# 1164	[c=4 l=3]  *movdi_xor
+	leaq	4+fuse_seq(%rip), %r15	# 105	[c=1 l=7]  *movdi_internal/4
+	movq	%r14, %rdx	# 100	[c=4 l=3]  *movdi_internal/3
+	movl	%r13d, %ebp	# 891	[c=4 l=3]  *movsi_internal/0
+	movl	$-1, %r12d	# 5	[c=4 l=6]  *movsi_internal/0
+	movq	%r15, %r13	# 895	[c=4 l=3]  *movdi_internal/3
+	call	fuse_window.part.0.constprop.0	# 103	[c=10 l=5]  *call_value
+	movq	%r10, 8(%rsp)	# 889	[c=4 l=5]  *movdi_internal/5
+	movl	%r11d, 16(%rsp)	# 890	[c=4 l=5]  *movsi_internal/1
+	movl	%eax, %ebx	# 104	[c=4 l=2]  *movsi_internal/0
+	movq	%r9, 24(%rsp)	# 894	[c=4 l=5]  *movdi_internal/5
+	jmp	.L146	# 1187	[c=1 l=2]  jump
+	.p2align 4,,10
+	.p2align 3
+.L241:
+	movslq	%r12d, %rax	# 130	[c=4 l=3]  *extendsidi2_rex64/1
+	leaq	fuse_seq(%rip), %rdi	# 1039	[c=1 l=7]  *movdi_internal/4
+	salq	$4, %rax	# 131	[c=4 l=4]  *ashldi3_1/0
+	cmpl	(%rdi,%rax), %r15d	# 754	[c=13 l=4]  *cmpsi_1/1
+	cmovg	%ebp, %r12d	# 755	[c=8 l=4]  *movsicc_noc/1
+	.p2align 4,,10
+	.p2align 3
+.L145:
+	addl	$1, %ebp	# 138	[c=4 l=3]  *addsi_1/0
+	addq	$16, %r13	# 139	[c=4 l=4]  *adddi_1/0
+	cmpl	$41, %ebp	# 141	[c=4 l=3]  *cmpsi_1/0
+	je	.L240	# 142	[c=13 l=2]  *jcc
+.L146:
+	movl	-4(%r13), %r15d	# 108	[c=9 l=4]  *movsi_internal/0
+	cmpl	%r15d, %ebx	# 109	[c=4 l=3]  *cmpsi_1/0
+	jl	.L145	# 110	[c=13 l=2]  *jcc
+	movslq	%r15d, %rdx	# 114	[c=4 l=3]  *extendsidi2_rex64/1
+	movq	%r14, %rsi	# 117	[c=4 l=3]  *movdi_internal/3
+	movq	%r13, %rdi	# 118	[c=4 l=3]  *movdi_internal/3
+	call	memcmp@PLT	# 119	[c=10 l=5]  *call_value
+	testl	%eax, %eax	# 123	[c=4 l=2]  *cmpsi_ccno_1/0
+	jne	.L145	# 124	[c=13 l=2]  *jcc
+	cmpl	$-1, %r12d	# 126	[c=4 l=4]  *cmpsi_1/0
+	jne	.L241	# 127	[c=13 l=2]  *jcc
+	movl	%ebp, %r12d	# 7	[c=4 l=3]  *movsi_internal/0
+	addl	$1, %ebp	# 1171	[c=4 l=3]  *addsi_1/0
+	addq	$16, %r13	# 1172	[c=4 l=4]  *adddi_1/0
+	cmpl	$41, %ebp	# 1173	[c=4 l=3]  *cmpsi_1/0
+	jne	.L146	# 1174	[c=13 l=2]  *jcc
+.L240:
+	movq	8(%rsp), %r10	# 897	[c=9 l=5]  *movdi_internal/3
+	movl	16(%rsp), %r11d	# 898	[c=9 l=5]  *movsi_internal/0
+	movq	24(%rsp), %r9	# 900	[c=9 l=5]  *movdi_internal/3
+	cmpl	$-1, %r12d	# 145	[c=4 l=4]  *cmpsi_1/0
+	je	.L140	# 146	[c=13 l=2]  *jcc
+	movq	40(%rsp), %rax	# 1040	[c=9 l=5]  *movdi_internal/3
+	movslq	%r12d, %rsi	# 148	[c=4 l=3]  *extendsidi2_rex64/1
+	addl	$1, 144(%rsp,%rsi,4)	# 155	[c=14 l=8]  *addsi_1/0
+	movq	(%rax,%r10,8), %rax	# 164	[c=10 l=4]  *movdi_internal/3
+	addq	%rax, 320(%rsp,%rsi,8)	# 165	[c=14 l=8]  *adddi_1/0
+.L140:
+	addl	$1, %r11d	# 168	[c=4 l=4]  *addsi_1/0
+	cmpl	%r11d, (%rsp)	# 170	[c=9 l=4]  *cmpsi_1/0
+	jnb	.L148	# 171	[c=13 l=6]  *jcc
+.L245:
+	movq	32(%rsp), %r15	# 901	[c=9 l=5]  *movdi_internal/3
+	leaq	.LC6(%rip), %r9	# 174	[c=1 l=7]  *movdi_internal/4
+	xorl	%eax, %eax	# 1162	[c=4 l=2]  *movdi_xor
+	xorl	%ebx, %ebx	# 1163	[c=4 l=2]  *movdi_xor
+	leaq	.LC7(%rip), %r8	# 175	[c=1 l=7]  *movdi_internal/4
+	leaq	.LC8(%rip), %rcx	# 177	[c=1 l=7]  *movdi_internal/4
+	movq	48(%rsp), %rbp	# 902	[c=9 l=5]  *movdi_internal/3
+	movq	56(%rsp), %r14	# 903	[c=9 l=5]  *movdi_internal/3
+	movq	904(%r15), %rdi	# 173	[c=9 l=7]  *movdi_internal/3
+	leaq	.LC9(%rip), %rdx	# 178	[c=1 l=7]  *movdi_internal/4
+	leaq	.LC10(%rip), %rsi	# 180	[c=1 l=7]  *movdi_internal/4
+	leaq	fuse_seq(%rip), %r13	# 717	[c=1 l=7]  *movdi_internal/4
+	leaq	.LC12(%rip), %r12	# 239	[c=1 l=7]  *movdi_internal/4
+	call	fprintf@PLT	# 184	[c=10 l=5]  *call_value
+	jmp	.L155	# 1191	[c=1 l=2]  jump
+.L243:
+	pxor	%xmm1, %xmm1	# 1246	[c=4 l=4]  movv2df_internal/0
+	cvtsi2sdq	%r8, %xmm1	# 1247	[c=4 l=5]  sse2_cvtsi2sdq/0
+	mulsd	%xmm1, %xmm0	# 215	[c=20 l=4]  *fop_df_comm/1
+	testq	%rax, %rax	# 218	[c=4 l=3]  *cmpdi_ccno_1/0
+	js	.L153	# 219	[c=13 l=6]  *jcc
+.L244:
+	pxor	%xmm1, %xmm1	# 1244	[c=4 l=4]  movv2df_internal/0
+	cvtsi2sdq	%rax, %xmm1	# 1245	[c=4 l=5]  sse2_cvtsi2sdq/0
+.L154:
+	divsd	%xmm1, %xmm0	# 230	[c=68 l=4]  *fop_df_1/2
+.L150:
+	movq	8(%r13), %rdx	# 233	[c=9 l=4]  *movdi_internal/3
+	movq	904(%r15), %rdi	# 234	[c=9 l=7]  *movdi_internal/3
+	movq	%r12, %rsi	# 240	[c=4 l=3]  *movdi_internal/3
+	movl	$1, %eax	# 242	[c=4 l=5]  *movqi_internal/3
+	call	fprintf@PLT	# 243	[c=10 l=5]  *call_value
+.L149:
+	addq	$1, %rbx	# 246	[c=4 l=4]  *adddi_1/0
+	addq	$16, %r13	# 247	[c=4 l=4]  *adddi_1/0
+	cmpq	$41, %rbx	# 249	[c=4 l=4]  *cmpdi_1/0
+	je	.L242	# 250	[c=13 l=6]  *jcc
+.L155:
+	movl	(%r14,%rbx,4), %ecx	# 188	[c=10 l=4]  *movsi_internal/0
+	testl	%ecx, %ecx	# 189	[c=4 l=2]  *cmpsi_ccno_1/0
+	je	.L149	# 190	[c=13 l=2]  *jcc
+	movq	40(%r15), %rax	# 192	[c=9 l=4]  *movdi_internal/3
+	movq	0(%rbp,%rbx,8), %r8	# 194	[c=10 l=5]  *movdi_internal/3
+	pxor	%xmm0, %xmm0	# 786	[c=4 l=4]  *movdf_internal/12
+	testq	%rax, %rax	# 195	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L150	# 196	[c=13 l=2]  *jcc
+	pxor	%xmm0, %xmm0	# 1242	[c=4 l=4]  movv2df_internal/0
+	cvtsi2sdl	0(%r13), %xmm0	# 1243	[c=4 l=6]  sse2_cvtsi2sd/1
+	mulsd	.LC11(%rip), %xmm0	# 200	[c=26 l=8]  *fop_df_comm/1
+	testq	%r8, %r8	# 203	[c=4 l=3]  *cmpdi_ccno_1/0
+	jns	.L243	# 204	[c=13 l=2]  *jcc
+	movq	%r8, %rdx	# 1042	[c=4 l=3]  *movdi_internal/3
+	movq	%r8, %rsi	# 1044	[c=4 l=3]  *movdi_internal/3
+	pxor	%xmm1, %xmm1	# 1240	[c=4 l=4]  movv2df_internal/0
+	shrq	%rdx	# 209	[c=4 l=3]  *lshrdi3_1/0
+	andl	$1, %esi	# 210	[c=4 l=3]  *anddi_1/0
+	orq	%rsi, %rdx	# 211	[c=4 l=3]  *iordi_1/0
+	cvtsi2sdq	%rdx, %xmm1	# 1241	[c=4 l=5]  sse2_cvtsi2sdq/0
+	addsd	%xmm1, %xmm1	# 213	[c=12 l=4]  *fop_df_comm/1
+	mulsd	%xmm1, %xmm0	# 1177	[c=20 l=4]  *fop_df_comm/1
+	testq	%rax, %rax	# 1178	[c=4 l=3]  *cmpdi_ccno_1/0
+	jns	.L244	# 1179	[c=13 l=6]  *jcc
+.L153:
+	movq	%rax, %rdx	# 1046	[c=4 l=3]  *movdi_internal/3
+	andl	$1, %eax	# 225	[c=4 l=3]  *anddi_1/0
+	pxor	%xmm1, %xmm1	# 1238	[c=4 l=4]  movv2df_internal/0
+	shrq	%rdx	# 224	[c=4 l=3]  *lshrdi3_1/0
+	orq	%rax, %rdx	# 226	[c=4 l=3]  *iordi_1/0
+	cvtsi2sdq	%rdx, %xmm1	# 1239	[c=4 l=5]  sse2_cvtsi2sdq/0
+	addsd	%xmm1, %xmm1	# 228	[c=12 l=4]  *fop_df_comm/1
+	jmp	.L154	# 1196	[c=1 l=5]  jump
+.L239:
+	movl	$50651151, %edx	# 880	[c=4 l=5]  *movdi_internal/2
+	btq	%rax, %rdx	# 876	[c=4 l=4]  *btdi/0
+	jnc	.L143	# 877	[c=13 l=6]  *jcc
+	addl	$1, %r11d	# 1182	[c=4 l=4]  *addsi_1/0
+	cmpl	%r11d, (%rsp)	# 1183	[c=9 l=4]  *cmpsi_1/0
+	jnb	.L148	# 1184	[c=13 l=6]  *jcc
+	jmp	.L245	# 1200	[c=1 l=5]  jump
+.L242:
+	movl	992(%r15), %ebx	# 252	[c=9 l=7]  *movsi_internal/0
+	movq	10984(%r15), %rbp	# 253	[c=9 l=7]  *movdi_internal/3
+	xorl	%edx, %edx	# 1160	[c=4 l=2]  *movdi_xor
+	xorl	%eax, %eax	# 1161	[c=4 l=2]  *movdi_xor
+	.p2align 4,,10
+	.p2align 3
+.L156:
+	movl	%eax, %ecx	# 255	[c=1 l=2]  *zero_extendsidi2/3
+	cmpq	$1, 0(%rbp,%rcx,8)	# 874	[c=14 l=6]  *cmpdi_1/0
+	sbbl	$-1, %edx	# 875	[c=4 l=3]  subsi3_carry/0
+	addl	$1, %eax	# 260	[c=4 l=3]  *addsi_1/0
+	cmpl	%eax, %ebx	# 262	[c=4 l=2]  *cmpsi_1/0
+	jnb	.L156	# 263	[c=13 l=2]  *jcc
+	leal	(%rdx,%rdx,2), %eax	# 267	[c=8 l=3]  *leasi
+	addl	%eax, %eax	# 268	[c=4 l=2]  *ashlsi3_1/0
+	cmpl	$16, %eax	# 273	[c=4 l=3]  *cmpsi_1/0
+	jbe	.L191	# 274	[c=13 l=6]  *jcc
+	movl	$16, %edx	# 13	[c=4 l=5]  *movsi_internal/0
+	.p2align 4,,10
+	.p2align 3
+.L158:
+	addl	%edx, %edx	# 276	[c=4 l=2]  *ashlsi3_1/0
+	cmpl	%eax, %edx	# 278	[c=4 l=2]  *cmpsi_1/0
+	jb	.L158	# 279	[c=13 l=2]  *jcc
+	movl	%edx, 8(%rsp)	# 925	[c=4 l=4]  *movsi_internal/1
+	movl	%edx, %esi	# 1104	[c=4 l=2]  *movsi_internal/0
+.L157:
+	movq	%r15, %rdi	# 286	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC13(%rip), %rcx	# 282	[c=1 l=7]  *movdi_internal/4
+	movl	$24, %edx	# 284	[c=4 l=5]  *movdi_internal/2
+	call	get_mem	# 287	[c=10 l=5]  *call_value
+	movq	%rbp, %r9	# 289	[c=4 l=3]  *movdi_internal/3
+	movq	%r15, %rdi	# 931	[c=4 l=3]  *movdi_internal/3
+	movabsq	$-7046029254386353131, %r11	# 341	[c=1 l=10]  *movdi_internal/4
+	movq	%rax, %r14	# 288	[c=4 l=3]  *movdi_internal/3
+	movl	%ebx, %eax	# 290	[c=1 l=2]  *zero_extendsidi2/3
+	xorl	%ebx, %ebx	# 1159	[c=4 l=2]  *movdi_xor
+	addq	$1, %rax	# 291	[c=4 l=4]  *adddi_1/0
+	salq	$4, %rax	# 292	[c=4 l=4]  *ashldi3_1/0
+	movq	%rax, (%rsp)	# 1049	[c=4 l=4]  *movdi_internal/5
+	.p2align 4,,10
+	.p2align 3
+.L160:
+	cmpq	$0, (%r9)	# 295	[c=9 l=4]  *cmpdi_ccno_1/1
+	je	.L162	# 296	[c=13 l=6]  *jcc
+	movq	1064(%rdi), %rsi	# 1157	[c=9 l=7]  *movdi_internal/3
+	addq	%rbx, %rsi	# 1158	[c=4 l=3]  *adddi_1/0
+	cmpb	$0, 11(%rsi)	# 311	[c=13 l=4]  *cmpqi_ccno_1/1
+	je	.L162	# 312	[c=13 l=6]  *jcc
+	leaq	64(%rsp), %r10	# 314	[c=4 l=5]  *leadi
+	movq	%rdi, 16(%rsp)	# 1083	[c=4 l=5]  *movdi_internal/5
+	movq	%r10, %rdx	# 315	[c=4 l=3]  *movdi_internal/3
+	call	fuse_window.part.0.constprop.0	# 318	[c=10 l=5]  *call_value
+	movq	16(%rsp), %rdi	# 1084	[c=9 l=5]  *movdi_internal/3
+	cmpl	$1, %eax	# 322	[c=4 l=3]  *cmpsi_1/0
+	jle	.L162	# 323	[c=13 l=6]  *jcc
+	movl	8(%rsp), %ecx	# 1053	[c=9 l=4]  *movsi_internal/0
+	leaq	66(%rsp), %r8	# 1115	[c=4 l=5]  *leadi
+	leal	1(%rax), %r13d	# 329	[c=5 l=4]  *leadi
+	movl	$2, %r12d	# 16	[c=4 l=6]  *movdi_internal/2
+	leal	-1(%rcx), %ebp	# 1114	[c=4 l=3]  *leasi
+	movl	$16, %ecx	# 17	[c=4 l=5]  *movsi_internal/0
+	.p2align 4,,10
+	.p2align 3
+.L167:
+	movq	%r10, %rax	# 18	[c=4 l=3]  *movdi_internal/3
+	movq	%r12, %rdx	# 19	[c=4 l=3]  *movdi_internal/3
+	.p2align 4,,10
+	.p2align 3
+.L163:
+	movzbl	(%rax), %esi	# 333	[c=9 l=3]  zero_extendqidi2/0
+	salq	$8, %rdx	# 332	[c=4 l=4]  *ashldi3_1/0
+	addq	$1, %rax	# 335	[c=4 l=4]  *adddi_1/0
+	orq	%rsi, %rdx	# 334	[c=4 l=3]  *iordi_1/0
+	cmpq	%rax, %r8	# 337	[c=4 l=3]  *cmpdi_1/0
+	jne	.L163	# 338	[c=13 l=2]  *jcc
+	salq	%cl, %rdx	# 340	[c=4 l=3]  *ashldi3_1/0
+	movq	%rdx, %rax	# 1054	[c=4 l=3]  *movdi_internal/3
+	imulq	%r11, %rax	# 342	[c=16 l=4]  *muldi3_1/2
+	shrq	$32, %rax	# 343	[c=4 l=4]  *lshrdi3_1/0
+	andl	%ebp, %eax	# 345	[c=4 l=2]  *andsi_1/0
+	movl	%eax, %esi	# 346	[c=1 l=2]  *zero_extendsidi2/3
+	leaq	(%rsi,%rsi,2), %rsi	# 349	[c=8 l=4]  *leadi
+	leaq	(%r14,%rsi,8), %r15	# 352	[c=8 l=4]  *leadi
+	movq	(%r15), %rsi	# 353	[c=5 l=3]  *movdi_internal/3
+	testq	%rsi, %rsi	# 356	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L164	# 357	[c=13 l=2]  *jcc
+	cmpq	%rsi, %rdx	# 360	[c=4 l=3]  *cmpdi_1/0
+	jne	.L165	# 361	[c=13 l=2]  *jcc
+	jmp	.L164	# 1203	[c=1 l=2]  jump
+	.p2align 4,,10
+	.p2align 3
+.L246:
+	testq	%rsi, %rsi	# 380	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L164	# 381	[c=13 l=2]  *jcc
+.L165:
+	addl	$1, %eax	# 363	[c=4 l=3]  *addsi_1/0
+	andl	%ebp, %eax	# 364	[c=4 l=2]  *andsi_1/0
+	movl	%eax, %esi	# 365	[c=1 l=2]  *zero_extendsidi2/3
+	leaq	(%rsi,%rsi,2), %rsi	# 368	[c=8 l=4]  *leadi
+	leaq	(%r14,%rsi,8), %r15	# 371	[c=8 l=4]  *leadi
+	movq	(%r15), %rsi	# 372	[c=5 l=3]  *movdi_internal/3
+	cmpq	%rsi, %rdx	# 376	[c=4 l=3]  *cmpdi_1/0
+	jne	.L246	# 377	[c=13 l=2]  *jcc
+.L164:
+	addq	$1, %r12	# 390	[c=4 l=4]  *adddi_1/0
+	movq	%rdx, (%r15)	# 385	[c=4 l=3]  *movdi_internal/5
+	subl	$8, %ecx	# 389	[c=4 l=3]  *addsi_1/0
+	movq	(%r9), %rax	# 387	[c=5 l=3]  *movdi_internal/3
+	addl	$1, 8(%r15)	# 386	[c=13 l=5]  *addsi_1/0
+	addq	$1, %r8	# 391	[c=4 l=4]  *adddi_1/0
+	addq	%rax, 16(%r15)	# 388	[c=13 l=4]  *adddi_1/0
+	cmpq	%r12, %r13	# 393	[c=4 l=3]  *cmpdi_1/0
+	jne	.L167	# 394	[c=13 l=6]  *jcc
+.L162:
+	addq	$8, %r9	# 298	[c=4 l=4]  *adddi_1/0
+	addq	$16, %rbx	# 299	[c=4 l=4]  *adddi_1/0
+	cmpq	%rbx, (%rsp)	# 301	[c=9 l=4]  *cmpdi_1/0
+	jne	.L160	# 302	[c=13 l=6]  *jcc
+	movl	8(%rsp), %eax	# 401	[c=10 l=4]  *zero_extendsidi2/3
+	movq	%rdi, %r15	# 933	[c=4 l=3]  *movdi_internal/3
+	movq	%r14, %r12	# 400	[c=4 l=3]  *movdi_internal/3
+	xorl	%r11d, %r11d	# 1156	[c=4 l=3]  *movdi_xor
+	leaq	(%rax,%rax,2), %rax	# 404	[c=8 l=4]  *leadi
+	leaq	(%r14,%rax,8), %rcx	# 407	[c=8 l=4]  *leadi
+	movq	%r14, %rax	# 20	[c=4 l=3]  *movdi_internal/3
+	.p2align 4,,10
+	.p2align 3
+.L169:
+	cmpq	$0, (%rax)	# 410	[c=9 l=4]  *cmpdi_ccno_1/1
+	je	.L168	# 411	[c=13 l=2]  *jcc
+	movl	%r11d, %edx	# 414	[c=1 l=3]  *zero_extendsidi2/3
+	movdqu	(%rax), %xmm2	# 423	[c=9 l=4]  movv1ti_internal/2
+	addl	$1, %r11d	# 1155	[c=4 l=4]  *addsi_1/0
+	leaq	(%rdx,%rdx,2), %rdx	# 417	[c=8 l=4]  *leadi
+	leaq	(%r14,%rdx,8), %rdx	# 421	[c=8 l=4]  *leadi
+	movups	%xmm2, (%rdx)	# 1057	[c=4 l=3]  movv1ti_internal/3
+	movq	16(%rax), %rsi	# 424	[c=9 l=4]  *movdi_internal/3
+	movq	%rsi, 16(%rdx)	# 425	[c=4 l=4]  *movdi_internal/5
+.L168:
+	addq	$24, %rax	# 428	[c=4 l=4]  *adddi_1/0
+	cmpq	%rcx, %rax	# 430	[c=4 l=3]  *cmpdi_1/0
+	jne	.L169	# 431	[c=13 l=2]  *jcc
+	movl	%r11d, %eax	# 433	[c=1 l=3]  *zero_extendsidi2/3
+	movl	$24, %edx	# 436	[c=4 l=5]  *movdi_internal/2
+	movq	%r14, %rdi	# 438	[c=4 l=3]  *movdi_internal/3
+	movl	%r11d, (%rsp)	# 1085	[c=4 l=4]  *movsi_internal/1
+	movq	%rax, %rsi	# 881	[c=4 l=3]  *movdi_internal/3
+	leaq	fuse_stat_cmp(%rip), %rcx	# 434	[c=1 l=7]  *movdi_internal/4
+	call	qsort@PLT	# 439	[c=0 l=5]  *call
+	movq	904(%r15), %rdi	# 440	[c=9 l=7]  *movdi_internal/3
+	xorl	%eax, %eax	# 1154	[c=4 l=2]  *movdi_xor
+	leaq	.LC6(%rip), %r9	# 441	[c=1 l=7]  *movdi_internal/4
+	leaq	.LC7(%rip), %r8	# 442	[c=1 l=7]  *movdi_internal/4
+	leaq	.LC8(%rip), %rcx	# 444	[c=1 l=7]  *movdi_internal/4
+	leaq	.LC14(%rip), %rdx	# 445	[c=1 l=7]  *movdi_internal/4
+	leaq	.LC15(%rip), %rsi	# 447	[c=1 l=7]  *movdi_internal/4
+	call	fprintf@PLT	# 451	[c=10 l=5]  *call_value
+	movl	(%rsp), %r11d	# 1086	[c=5 l=4]  *movsi_internal/0
+	testl	%r11d, %r11d	# 452	[c=4 l=3]  *cmpsi_ccno_1/0
+	je	.L186	# 453	[c=13 l=6]  *jcc
+	movq	%r15, 24(%rsp)	# 1020	[c=4 l=5]  *movdi_internal/5
+	xorl	%eax, %eax	# 1153	[c=4 l=2]  *movdi_xor
+	leaq	64(%rsp), %rbx	# 724	[c=4 l=5]  *leadi
+	movq	%r12, %r15	# 1021	[c=4 l=3]  *movdi_internal/3
+	movl	$0, (%rsp)	# 24	[c=4 l=7]  *movsi_internal/1
+	leaq	opcode_id(%rip), %r13	# 725	[c=1 l=7]  *movdi_internal/4
+	movq	%r14, 48(%rsp)	# 1017	[c=4 l=5]  *movdi_internal/5
+	movl	%r11d, 40(%rsp)	# 1018	[c=4 l=5]  *movsi_internal/1
+	jmp	.L170	# 1206	[c=1 l=2]  jump
+.L194:
+	movl	%edi, %eax	# 1111	[c=4 l=2]  *movsi_internal/0
+.L175:
+	addl	$1, (%rsp)	# 615	[c=9 l=4]  *addsi_1/0
+	movl	40(%rsp), %edi	# 1080	[c=9 l=4]  *movsi_internal/0
+	addq	$24, %r15	# 616	[c=4 l=4]  *adddi_1/0
+	movl	(%rsp), %ecx	# 1092	[c=5 l=3]  *movsi_internal/0
+	cmpl	%edi, %ecx	# 617	[c=4 l=2]  *cmpsi_1/0
+	je	.L247	# 618	[c=13 l=6]  *jcc
+.L170:
+	movq	(%r15), %rdi	# 1058	[c=5 l=3]  *movdi_internal/3
+	movl	(%rsp), %ecx	# 1087	[c=5 l=3]  *movsi_internal/0
+	shrq	$32, %rdi	# 467	[c=4 l=4]  *lshrdi3_1/0
+	movq	%rdi, 16(%rsp)	# 1089	[c=4 l=5]  *movdi_internal/5
+	movl	%edi, %ebp	# 468	[c=4 l=2]  *movsi_internal/0
+	testl	%ecx, %ecx	# 469	[c=4 l=2]  *cmpsi_ccno_1/0
+	je	.L173	# 470	[c=13 l=2]  *jcc
+	leal	-1(%rcx), %edx	# 473	[c=5 l=3]  *leadi
+	movq	48(%rsp), %rcx	# 1062	[c=9 l=5]  *movdi_internal/3
+	leaq	(%rdx,%rdx,2), %rdx	# 476	[c=8 l=4]  *leadi
+	cmpl	%edi, 4(%rcx,%rdx,8)	# 483	[c=14 l=4]  *cmpsi_1/0
+	jne	.L193	# 484	[c=13 l=6]  *jcc
+.L173:
+	leal	1(%rax), %edi	# 1112	[c=4 l=3]  *leasi
+	movl	%edi, 8(%rsp)	# 1064	[c=4 l=4]  *movsi_internal/1
+	cmpl	$15, %eax	# 490	[c=4 l=3]  *cmpsi_1/0
+	ja	.L194	# 491	[c=13 l=2]  *jcc
+.L174:
+	movl	16(%rsp), %eax	# 1151	[c=9 l=4]  *movsi_internal/0
+	pxor	%xmm0, %xmm0	# 494	[c=4 l=4]  movv1ti_internal/0
+	movq	%rbx, 32(%rsp)	# 781	[c=4 l=5]  *movdi_internal/5
+	xorl	%r14d, %r14d	# 1150	[c=4 l=3]  *movdi_xor
+	movaps	%xmm0, 64(%rsp)	# 812	[c=4 l=5]  movv1ti_internal/3
+	movaps	%xmm0, 80(%rsp)	# 813	[c=4 l=5]  movv1ti_internal/3
+	movaps	%xmm0, 96(%rsp)	# 814	[c=4 l=5]  movv1ti_internal/3
+	movaps	%xmm0, 112(%rsp)	# 815	[c=4 l=5]  movv1ti_internal/3
+	movaps	%xmm0, 128(%rsp)	# 816	[c=4 l=8]  movv1ti_internal/3
+	testl	%eax, %eax	# 1152	[c=4 l=2]  *cmpsi_ccno_1/0
+	jle	.L248	# 502	[c=13 l=6]  *jcc
+	.p2align 4,,10
+	.p2align 3
+.L176:
+	movl	%r14d, %eax	# 1066	[c=4 l=3]  *movsi_internal/0
+	movq	(%r15), %rdx	# 1068	[c=5 l=3]  *movdi_internal/3
+	negl	%eax	# 514	[c=4 l=2]  *negsi_1
+	leal	24(,%rax,8), %ecx	# 517	[c=8 l=7]  *leasi
+	shrq	%cl, %rdx	# 519	[c=4 l=3]  *lshrdi3_1/0
+	movzbl	%dl, %r12d	# 520	[c=4 l=4]  *zero_extendqisi2/0
+	testl	%r14d, %r14d	# 521	[c=4 l=3]  *cmpsi_ccno_1/0
+	jne	.L249	# 522	[c=13 l=2]  *jcc
+	movslq	%r12d, %rdx	# 552	[c=4 l=3]  *extendsidi2_rex64/1
+	movq	%rbx, %rdi	# 556	[c=4 l=3]  *movdi_internal/3
+	movq	0(%r13,%rdx,8), %rsi	# 553	[c=10 l=5]  *movdi_internal/3
+	call	strcat@PLT	# 557	[c=10 l=5]  *call_value
+	cmpl	$1, %ebp	# 558	[c=4 l=3]  *cmpsi_1/0
+	je	.L181	# 559	[c=13 l=2]  *jcc
+	movl	$1, %r14d	# 27	[c=4 l=6]  *movsi_internal/0
+	jmp	.L176	# 1211	[c=1 l=2]  jump
+	.p2align 4,,10
+	.p2align 3
+.L249:
+	movq	%rbx, %rdi	# 525	[c=4 l=3]  *movdi_internal/3
+	addl	$1, %r14d	# 542	[c=4 l=4]  *addsi_1/0
+	call	strlen@PLT	# 526	[c=10 l=5]  *call_value
+	movslq	%r12d, %rdx	# 534	[c=4 l=3]  *extendsidi2_rex64/1
+	movl	$2108192, (%rbx,%rax)	# 532	[c=4 l=7]  *movsi_internal/1
+	movq	0(%r13,%rdx,8), %rsi	# 535	[c=10 l=5]  *movdi_internal/3
+	leaq	3(%rbx,%rax), %rdi	# 538	[c=5 l=5]  *leadi
+	call	strcpy@PLT	# 541	[c=10 l=5]  *call_value
+	cmpl	%ebp, %r14d	# 543	[c=4 l=3]  *cmpsi_1/0
+	jne	.L176	# 544	[c=13 l=2]  *jcc
+.L181:
+	movq	24(%rsp), %rax	# 1065	[c=9 l=5]  *movdi_internal/3
+	movq	16(%r15), %r8	# 505	[c=9 l=4]  *movdi_internal/3
+	pxor	%xmm0, %xmm0	# 28	[c=4 l=4]  *movdf_internal/12
+	movq	40(%rax), %rax	# 504	[c=9 l=4]  *movdi_internal/3
+	testq	%rax, %rax	# 506	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L178	# 507	[c=13 l=2]  *jcc
+	pxor	%xmm0, %xmm0	# 1236	[c=4 l=4]  movv2df_internal/0
+	cvtsi2sdl	16(%rsp), %xmm0	# 1237	[c=4 l=6]  sse2_cvtsi2sd/1
+	mulsd	.LC11(%rip), %xmm0	# 568	[c=26 l=8]  *fop_df_comm/1
+	testq	%r8, %r8	# 571	[c=4 l=3]  *cmpdi_ccno_1/0
+	js	.L182	# 572	[c=13 l=6]  *jcc
+	pxor	%xmm1, %xmm1	# 1234	[c=4 l=4]  movv2df_internal/0
+	cvtsi2sdq	%r8, %xmm1	# 1235	[c=4 l=5]  sse2_cvtsi2sdq/0
+.L183:
+	mulsd	%xmm1, %xmm0	# 583	[c=20 l=4]  *fop_df_comm/1
+	testq	%rax, %rax	# 586	[c=4 l=3]  *cmpdi_ccno_1/0
+	js	.L184	# 587	[c=13 l=6]  *jcc
+	pxor	%xmm1, %xmm1	# 1232	[c=4 l=4]  movv2df_internal/0
+	cvtsi2sdq	%rax, %xmm1	# 1233	[c=4 l=5]  sse2_cvtsi2sdq/0
+.L185:
+	divsd	%xmm1, %xmm0	# 598	[c=68 l=4]  *fop_df_1/2
+.L178:
+	movq	24(%rsp), %rax	# 1076	[c=9 l=5]  *movdi_internal/3
+	movl	8(%r15), %ecx	# 601	[c=9 l=4]  *movsi_internal/0
+	leaq	.LC12(%rip), %rsi	# 609	[c=1 l=7]  *movdi_internal/4
+	movq	32(%rsp), %rdx	# 607	[c=9 l=5]  *movdi_internal/3
+	movq	904(%rax), %rdi	# 603	[c=9 l=7]  *movdi_internal/3
+	movl	$1, %eax	# 611	[c=4 l=5]  *movqi_internal/3
+	call	fprintf@PLT	# 612	[c=10 l=5]  *call_value
+	movl	8(%rsp), %eax	# 30	[c=9 l=4]  *movsi_internal/0
+	jmp	.L175	# 1213	[c=1 l=5]  jump
+.L193:
+	movl	$1, 8(%rsp)	# 25	[c=4 l=8]  *movsi_internal/1
+	jmp	.L174	# 1215	[c=1 l=5]  jump
+.L247:
+	movq	48(%rsp), %r14	# 1023	[c=9 l=5]  *movdi_internal/3
+	movq	24(%rsp), %r15	# 1024	[c=9 l=5]  *movdi_internal/3
+.L186:
+	movq	-24(%r14), %rdx	# 456	[c=9 l=4]  *movdi_internal/3
+	movq	-32(%r14), %rax	# 457	[c=9 l=4]  *movdi_internal/3
+	leaq	-32(%r14), %rdi	# 1113	[c=4 l=4]  *leadi
+	testq	%rdx, %rdx	# 458	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L250	# 459	[c=13 l=2]  *jcc
+	movq	%rax, (%rdx)	# 625	[c=4 l=3]  *movdi_internal/5
+	movq	-32(%r14), %rax	# 726	[c=9 l=4]  *movdi_internal/3
+.L187:
+	testq	%rax, %rax	# 634	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L188	# 635	[c=13 l=2]  *jcc
+	movq	%rdx, 8(%rax)	# 637	[c=4 l=4]  *movdi_internal/5
+.L188:
+	addq	$664, %rsp	# 1142	[c=4 l=7]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx	# 1143	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 48
+	popq	%rbp	# 1144	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 40
+	popq	%r12	# 1145	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 32
+	popq	%r13	# 1146	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 24
+	popq	%r14	# 1147	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 16
+	popq	%r15	# 1148	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 8
+	jmp	free@PLT	# 641	[c=0 l=5]  *sibcall
+.L184:
+	.cfi_restore_state
+	movq	%rax, %rdx	# 1074	[c=4 l=3]  *movdi_internal/3
+	andl	$1, %eax	# 593	[c=4 l=3]  *anddi_1/0
+	pxor	%xmm1, %xmm1	# 1230	[c=4 l=4]  movv2df_internal/0
+	shrq	%rdx	# 592	[c=4 l=3]  *lshrdi3_1/0
+	orq	%rax, %rdx	# 594	[c=4 l=3]  *iordi_1/0
+	cvtsi2sdq	%rdx, %xmm1	# 1231	[c=4 l=5]  sse2_cvtsi2sdq/0
+	addsd	%xmm1, %xmm1	# 596	[c=12 l=4]  *fop_df_comm/1
+	jmp	.L185	# 1218	[c=1 l=5]  jump
+.L182:
+	movq	%r8, %rdx	# 1070	[c=4 l=3]  *movdi_internal/3
+	movq	%r8, %rcx	# 1072	[c=4 l=3]  *movdi_internal/3
+	pxor	%xmm1, %xmm1	# 1228	[c=4 l=4]  movv2df_internal/0
+	shrq	%rdx	# 577	[c=4 l=3]  *lshrdi3_1/0
+	andl	$1, %ecx	# 578	[c=4 l=3]  *anddi_1/0
+	orq	%rcx, %rdx	# 579	[c=4 l=3]  *iordi_1/0
+	cvtsi2sdq	%rdx, %xmm1	# 1229	[c=4 l=5]  sse2_cvtsi2sdq/0
+	addsd	%xmm1, %xmm1	# 581	[c=12 l=4]  *fop_df_comm/1
+	jmp	.L183	# 1220	[c=1 l=5]  jump
+.L248:
+	leaq	64(%rsp), %rax	# 1097	[c=4 l=5]  *leadi
+	movq	%rax, 32(%rsp)	# 723	[c=4 l=5]  *movdi_internal/5
+	jmp	.L181	# 1222	[c=1 l=5]  jump
+.L250:
+	movq	%rax, 984(%r15)	# 630	[c=4 l=7]  *movdi_internal/5
+	jmp	.L187	# 1224	[c=1 l=2]  jump
+.L137:
+	addq	$664, %rsp	# 1131	[c=4 l=7]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx	# 1132	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 48
+	popq	%rbp	# 1133	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 40
+	popq	%r12	# 1134	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 32
+	popq	%r13	# 1135	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 24
+	popq	%r14	# 1136	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 16
+	popq	%r15	# 1137	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 8
+	ret		# 1138	[c=0 l=1]  simple_return_internal
+.L191:
+	.cfi_restore_state
+	movl	$16, 8(%rsp)	# 14	[c=4 l=8]  *movsi_internal/1
+	movl	8(%rsp), %esi	# 1105	[c=9 l=4]  *movsi_internal/0
+	jmp	.L157	# 1226	[c=1 l=5]  jump
+	.cfi_endproc
+.LFE19:
+	.size	print_fuse_stats, .-print_fuse_stats
+	.section	.rodata.str1.1
+.LC17:
+	.string	"-not set-"
+.LC18:
+	.string	"\n"
+	.section	.rodata.str1.8
+	.align 8
+.LC22:
+	.string	"        load: %lu:%02lu.%06lu  = %3lu.%03lu sec  = %6.2f%%,  %10.3f        bytes/ms, 0x%05x = %u bytes\n"
+	.align 8
+.LC23:
+	.string	"      decode: %lu:%02lu.%06lu  = %3lu.%03lu sec  = %6.2f%%,  %10.3f        bytes/ms, 0x%05x = %u bytes\n"
+	.align 8
+.LC24:
+	.string	"     execute: %lu:%02lu.%06lu  = %3lu.%03lu sec  = %6.2f%%,  %10.3f instructions/ms\n"
+	.align 8
+.LC25:
+	.string	" avrtest run: %lu:%02lu.%06lu  = %3lu.%03lu sec  = %6.2f%%,  %10.3f instructions/ms\n"
+	.align 8
+.LC26:
+	.string	" exit status: %s\n      reason: "
+	.section	.rodata.str1.1
+.LC27:
+	.string	"\n     program: %s\n"
+.LC28:
+	.string	" entry point: %06x\n"
+	.section	.rodata.str1.8
+	.align 8
+.LC29:
+	.string	"exit address: %06x\ntotal cycles: %lu\n"
+	.section	.rodata.str1.1
+.LC30:
+	.string	"      asleep: %lu\n"
+.LC31:
+	.string	"total instr.: %lu\n\n"
+.LC32:
+	.string	"\n%s: %s error: "
+	.text
+	.p2align 4
+	.globl	leave
+	.type	leave, @function
+leave:
+.LFB29:
+	.cfi_startproc
+	pushq	%rbp	# 1319	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp	# 1320	[c=4 l=3]  *movdi_internal/3
+	.cfi_def_cfa_register 6
+	pushq	%r15	# 1321	[c=4 l=2]  *pushdi2_rex64/0
+	pushq	%r14	# 1322	[c=4 l=2]  *pushdi2_rex64/0
+	pushq	%r13	# 1323	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_offset 15, -24
+	.cfi_offset 14, -32
+	.cfi_offset 13, -40
+	movq	%rdx, %r13	# 4	[c=4 l=3]  *movdi_internal/3
+	pushq	%r12	# 1324	[c=4 l=2]  *pushdi2_rex64/0
+	pushq	%rbx	# 1325	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_offset 12, -48
+	.cfi_offset 3, -56
+	movq	%rdi, %rbx	# 2	[c=4 l=3]  *movdi_internal/3
+	subq	$312, %rsp	# 1326	[c=4 l=7]  pro_epilogue_adjust_stack_add_di/0
+	movl	%esi, -260(%rbp)	# 3	[c=4 l=6]  *movsi_internal/1
+	movq	%rcx, -200(%rbp)	# 5	[c=4 l=7]  *movdi_internal/5
+	movq	%r8, -192(%rbp)	# 6	[c=4 l=7]  *movdi_internal/5
+	movq	%r9, -184(%rbp)	# 7	[c=4 l=7]  *movdi_internal/5
+	testb	%al, %al	# 8	[c=4 l=2]  *cmpqi_ccno_1/0
+	je	.L331	# 9	[c=13 l=2]  *jcc
+	movaps	%xmm0, -176(%rbp)	# 10	[c=4 l=7]  movv4sf_internal/3
+	movaps	%xmm1, -160(%rbp)	# 11	[c=4 l=7]  movv4sf_internal/3
+	movaps	%xmm2, -144(%rbp)	# 12	[c=4 l=7]  movv4sf_internal/3
+	movaps	%xmm3, -128(%rbp)	# 13	[c=4 l=4]  movv4sf_internal/3
+	movaps	%xmm4, -112(%rbp)	# 14	[c=4 l=4]  movv4sf_internal/3
+	movaps	%xmm5, -96(%rbp)	# 15	[c=4 l=4]  movv4sf_internal/3
+	movaps	%xmm6, -80(%rbp)	# 16	[c=4 l=4]  movv4sf_internal/3
+	movaps	%xmm7, -64(%rbp)	# 17	[c=4 l=4]  movv4sf_internal/3
+.L331:
+	movl	-260(%rbp), %eax	# 1115	[c=9 l=6]  *movsi_internal/0
+	movl	96(%rbx), %edx	# 31	[c=9 l=3]  *movsi_internal/0
+	movl	%eax, 72(%rbx)	# 30	[c=4 l=3]  *movsi_internal/1
+	testl	%edx, %edx	# 32	[c=4 l=2]  *cmpsi_ccno_1/0
+	je	.L254	# 33	[c=13 l=2]  *jcc
+	movq	40(%rbx), %rax	# 1116	[c=9 l=4]  *movdi_internal/3
+	subq	$1, %rax	# 40	[c=4 l=4]  *adddi_1/0
+	subl	$1, %edx	# 1395	[c=4 l=3]  *addsi_4
+	movq	%rax, 40(%rbx)	# 41	[c=4 l=4]  *movdi_internal/5
+	je	.L365	# 44	[c=13 l=6]  *jcc
+.L254:
+	movq	%rbx, %rdi	# 57	[c=4 l=3]  *movdi_internal/3
+	leaq	exit_status(%rip), %r15	# 61	[c=1 l=7]  *movdi_internal/4
+	call	periph_finish@PLT	# 58	[c=0 l=5]  *call
+	movq	%rbx, %rdi	# 59	[c=4 l=3]  *movdi_internal/3
+	call	replay_finish@PLT	# 60	[c=0 l=5]  *call
+	movslq	-260(%rbp), %r12	# 62	[c=13 l=7]  *extendsidi2_rex64/1
+	leaq	.LC18(%rip), %rsi	# 71	[c=1 l=7]  *movdi_internal/4
+	movq	%rbx, %rdi	# 73	[c=4 l=3]  *movdi_internal/3
+	leaq	(%r12,%r12,2), %rax	# 65	[c=8 l=4]  *leadi
+	movl	16(%r15,%rax,8), %r14d	# 70	[c=10 l=5]  *movsi_internal/0
+	xorl	%eax, %eax	# 1392	[c=4 l=2]  *movdi_xor
+	call	qprintf	# 75	[c=0 l=5]  *call
+	movl	232(%rbx), %r11d	# 1393	[c=9 l=7]  *movsi_internal/0
+	testl	%r11d, %r11d	# 1394	[c=4 l=3]  *cmpsi_ccno_1/0
+	je	.L256	# 77	[c=13 l=6]  *jcc
+	testl	%r14d, %r14d	# 79	[c=4 l=3]  *cmpsi_ccno_1/0
+	je	.L257	# 80	[c=13 l=6]  *jcc
+.L364:
+	cmpl	$0, 600(%rbx)	# 82	[c=13 l=7]  *cmpsi_ccno_1/1
+	jne	.L258	# 83	[c=13 l=2]  *jcc
+	cmpl	$0, 584(%rbx)	# 94	[c=13 l=7]  *cmpsi_ccno_1/1
+	je	.L259	# 95	[c=13 l=6]  *jcc
+	cmpl	$0, 488(%rbx)	# 97	[c=13 l=7]  *cmpsi_ccno_1/1
+	je	.L259	# 98	[c=13 l=6]  *jcc
+.L258:
+	cmpl	$0, 216(%rbx)	# 688	[c=13 l=7]  *cmpsi_ccno_1/1
+	je	.L309	# 689	[c=13 l=6]  *jcc
+	movq	904(%rbx), %rdi	# 691	[c=9 l=7]  *movdi_internal/3
+	call	fflush@PLT	# 693	[c=10 l=5]  *call_value
+.L318:
+	leaq	16(%rbp), %rax	# 1228	[c=4 l=4]  *leadi
+	movq	912(%rbx), %r14	# 804	[c=9 l=7]  *movdi_internal/3
+	movl	$24, -256(%rbp)	# 806	[c=4 l=10]  *movsi_internal/1
+	leaq	.LC32(%rip), %rsi	# 818	[c=1 l=7]  *movdi_internal/4
+	movq	%rax, -248(%rbp)	# 808	[c=4 l=7]  *movdi_internal/5
+	leaq	-224(%rbp), %rax	# 1229	[c=4 l=7]  *leadi
+	movq	144(%rbx), %rdx	# 815	[c=9 l=7]  *movdi_internal/3
+	movq	%rax, -240(%rbp)	# 809	[c=4 l=7]  *movdi_internal/5
+	imulq	$24, %r12, %rax	# 812	[c=16 l=4]  *muldi3_1/0
+	movq	%r14, %rdi	# 820	[c=4 l=3]  *movdi_internal/3
+	movl	$48, -252(%rbp)	# 807	[c=4 l=10]  *movsi_internal/1
+	movq	8(%r15,%rax), %rcx	# 816	[c=10 l=5]  *movdi_internal/3
+	xorl	%eax, %eax	# 1352	[c=4 l=2]  *movdi_xor
+	call	fprintf@PLT	# 822	[c=10 l=5]  *call_value
+	leaq	-256(%rbp), %rdx	# 1289	[c=4 l=7]  *leadi
+	movq	%r13, %rsi	# 825	[c=4 l=3]  *movdi_internal/3
+	movq	%r14, %rdi	# 826	[c=4 l=3]  *movdi_internal/3
+	call	vfprintf@PLT	# 827	[c=10 l=5]  *call_value
+	movl	$10, %edi	# 829	[c=4 l=5]  *movsi_internal/0
+	movq	%r14, %rsi	# 828	[c=4 l=3]  *movdi_internal/3
+	call	fputc@PLT	# 830	[c=10 l=5]  *call_value
+	movq	%r14, %rdi	# 831	[c=4 l=3]  *movdi_internal/3
+	call	fflush@PLT	# 832	[c=10 l=5]  *call_value
+.L317:
+	cmpl	$0, -260(%rbp)	# 835	[c=13 l=7]  *cmpsi_ccno_1/1
+	jne	.L324	# 836	[c=13 l=6]  *jcc
+	movl	76(%rbx), %esi	# 838	[c=9 l=3]  *movsi_internal/0
+.L325:
+	movq	%rbx, %rdi	# 852	[c=4 l=3]  *movdi_internal/3
+	call	finish	# 853	[c=0 l=5]  *call
+.L311:
+	cmpl	$0, 600(%rbx)	# 651	[c=13 l=7]  *cmpsi_ccno_1/1
+	jne	.L314	# 652	[c=13 l=6]  *jcc
+.L308:
+	cmpl	$0, 584(%rbx)	# 103	[c=13 l=7]  *cmpsi_ccno_1/1
+	jne	.L260	# 104	[c=13 l=6]  *jcc
+.L259:
+	cmpl	$0, 216(%rbx)	# 698	[c=13 l=7]  *cmpsi_ccno_1/1
+	jne	.L366	# 699	[c=13 l=6]  *jcc
+.L309:
+	leaq	16(%rbp), %rax	# 1225	[c=4 l=4]  *leadi
+	cmpl	$0, 76(%rbx)	# 674	[c=13 l=4]  *cmpsi_ccno_1/1
+	movl	$24, -256(%rbp)	# 670	[c=4 l=10]  *movsi_internal/1
+	leaq	.LC0(%rip), %rdx	# 26	[c=1 l=7]  *movdi_internal/4
+	movq	%rax, -248(%rbp)	# 672	[c=4 l=7]  *movdi_internal/5
+	leaq	-224(%rbp), %rax	# 1226	[c=4 l=7]  *leadi
+	movl	$48, -252(%rbp)	# 671	[c=4 l=10]  *movsi_internal/1
+	movq	%rax, -240(%rbp)	# 673	[c=4 l=7]  *movdi_internal/5
+	jne	.L315	# 675	[c=13 l=2]  *jcc
+	imulq	$24, %r12, %r12	# 707	[c=16 l=4]  *muldi3_1/0
+	movq	(%r15,%r12), %rdx	# 709	[c=9 l=4]  *movdi_internal/3
+.L315:
+	movq	904(%rbx), %rdi	# 712	[c=9 l=7]  *movdi_internal/3
+	leaq	.LC26(%rip), %rsi	# 714	[c=1 l=7]  *movdi_internal/4
+	xorl	%eax, %eax	# 1358	[c=4 l=2]  *movdi_xor
+	call	fprintf@PLT	# 718	[c=10 l=5]  *call_value
+	movq	904(%rbx), %rdi	# 720	[c=9 l=7]  *movdi_internal/3
+	leaq	-256(%rbp), %rdx	# 1291	[c=4 l=7]  *leadi
+	movq	%r13, %rsi	# 722	[c=4 l=3]  *movdi_internal/3
+	call	vfprintf@PLT	# 724	[c=10 l=5]  *call_value
+	movq	80(%rbx), %rdx	# 725	[c=9 l=4]  *movdi_internal/3
+	testq	%rdx, %rdx	# 726	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L367	# 727	[c=13 l=6]  *jcc
+.L320:
+	movq	904(%rbx), %rdi	# 731	[c=9 l=7]  *movdi_internal/3
+	xorl	%eax, %eax	# 1357	[c=4 l=2]  *movdi_xor
+	leaq	.LC27(%rip), %rsi	# 733	[c=1 l=7]  *movdi_internal/4
+	call	fprintf@PLT	# 737	[c=10 l=5]  *call_value
+	testl	%r14d, %r14d	# 738	[c=4 l=3]  *cmpsi_ccno_1/0
+	jne	.L321	# 739	[c=13 l=2]  *jcc
+	movl	8(%rbx), %edx	# 741	[c=9 l=3]  *movsi_internal/0
+	testl	%edx, %edx	# 742	[c=4 l=2]  *cmpsi_ccno_1/0
+	jne	.L368	# 743	[c=13 l=6]  *jcc
+.L322:
+	movl	(%rbx), %eax	# 1227	[c=5 l=2]  *movsi_internal/0
+	movq	48(%rbx), %rcx	# 754	[c=9 l=4]  *movdi_internal/3
+	leaq	.LC29(%rip), %rsi	# 760	[c=1 l=7]  *movdi_internal/4
+	movq	904(%rbx), %rdi	# 757	[c=9 l=7]  *movdi_internal/3
+	leal	(%rax,%rax), %edx	# 1290	[c=12 l=3]  *leasi
+	xorl	%eax, %eax	# 1355	[c=4 l=2]  *movdi_xor
+	call	fprintf@PLT	# 764	[c=10 l=5]  *call_value
+	movq	64(%rbx), %rdx	# 765	[c=9 l=4]  *movdi_internal/3
+	testq	%rdx, %rdx	# 766	[c=4 l=3]  *cmpdi_ccno_1/0
+	jne	.L369	# 767	[c=13 l=6]  *jcc
+.L323:
+	movq	40(%rbx), %rdx	# 778	[c=9 l=4]  *movdi_internal/3
+	movq	904(%rbx), %rdi	# 779	[c=9 l=7]  *movdi_internal/3
+	leaq	.LC31(%rip), %rsi	# 781	[c=1 l=7]  *movdi_internal/4
+	xorl	%eax, %eax	# 1353	[c=4 l=2]  *movdi_xor
+	call	fprintf@PLT	# 785	[c=10 l=5]  *call_value
+.L321:
+	movq	904(%rbx), %rdi	# 788	[c=9 l=7]  *movdi_internal/3
+	call	fflush@PLT	# 790	[c=10 l=5]  *call_value
+	movl	%r14d, %esi	# 791	[c=4 l=3]  *movsi_internal/0
+	movq	%rbx, %rdi	# 792	[c=4 l=3]  *movdi_internal/3
+	call	finish	# 793	[c=0 l=5]  *call
+.L256:
+	cmpl	$0, 536(%rbx)	# 636	[c=13 l=7]  *cmpsi_ccno_1/1
+	je	.L311	# 637	[c=13 l=6]  *jcc
+	testl	%r14d, %r14d	# 640	[c=4 l=3]  *cmpsi_ccno_1/0
+	jne	.L364	# 641	[c=13 l=6]  *jcc
+.L312:
+	movq	%rbx, %rdi	# 607	[c=4 l=3]  *movdi_internal/3
+	call	print_fuse_stats	# 608	[c=0 l=5]  *call
+	cmpl	$0, 600(%rbx)	# 609	[c=13 l=7]  *cmpsi_ccno_1/1
+	je	.L308	# 610	[c=13 l=6]  *jcc
+.L307:
+	movq	%rbx, %rdi	# 627	[c=4 l=3]  *movdi_internal/3
+	call	hle_print_stats@PLT	# 628	[c=0 l=5]  *call
+	cmpl	$0, 216(%rbx)	# 629	[c=13 l=7]  *cmpsi_ccno_1/1
+	je	.L309	# 630	[c=13 l=6]  *jcc
+	movq	904(%rbx), %rdi	# 681	[c=9 l=7]  *movdi_internal/3
+	call	fflush@PLT	# 683	[c=10 l=5]  *call_value
+	jmp	.L317	# 1401	[c=1 l=5]  jump
+.L260:
+	cmpl	$0, 488(%rbx)	# 662	[c=13 l=7]  *cmpsi_ccno_1/1
+	je	.L259	# 663	[c=13 l=6]  *jcc
+.L314:
+	testl	%r14d, %r14d	# 654	[c=4 l=3]  *cmpsi_ccno_1/0
+	jne	.L258	# 655	[c=13 l=6]  *jcc
+	jmp	.L307	# 1404	[c=1 l=2]  jump
+.L324:
+	imulq	$24, %r12, %r12	# 845	[c=16 l=4]  *muldi3_1/0
+	movl	20(%r15,%r12), %esi	# 848	[c=10 l=5]  *movsi_internal/0
+	jmp	.L325	# 1406	[c=1 l=5]  jump
+.L366:
+	movq	904(%rbx), %rdi	# 797	[c=9 l=7]  *movdi_internal/3
+	call	fflush@PLT	# 799	[c=10 l=5]  *call_value
+	testl	%r14d, %r14d	# 800	[c=4 l=3]  *cmpsi_ccno_1/0
+	je	.L317	# 801	[c=13 l=6]  *jcc
+	jmp	.L318	# 1409	[c=1 l=5]  jump
+.L365:
+	movl	(%rbx), %edx	# 46	[c=6 l=2]  *zero_extendsidi2/3
+	salq	$4, %rdx	# 47	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %rdx	# 49	[c=13 l=7]  *adddi_1/1
+	movzbl	11(%rdx), %ecx	# 50	[c=13 l=4]  zero_extendqidi2/0
+	subq	%rcx, %rax	# 51	[c=4 l=3]  *subdi_1/0
+	movq	%rax, 40(%rbx)	# 52	[c=4 l=4]  *movdi_internal/5
+	movzwl	14(%rdx), %eax	# 53	[c=13 l=4]  zero_extendhidi2/0
+	subq	%rax, 48(%rbx)	# 54	[c=13 l=4]  *subdi_1/0
+	jmp	.L254	# 1411	[c=1 l=5]  jump
+.L257:
+	leaq	-256(%rbp), %rdi	# 1318	[c=4 l=7]  *leadi
+	xorl	%esi, %esi	# 1391	[c=4 l=2]  *movdi_xor
+	call	gettimeofday@PLT	# 113	[c=10 l=5]  *call_value
+	movq	-248(%rbp), %rax	# 116	[c=9 l=7]  *movdi_internal/3
+	movq	-256(%rbp), %rcx	# 114	[c=9 l=7]  *movdi_internal/3
+	movq	928(%rbx), %rdx	# 115	[c=9 l=7]  *movdi_internal/3
+	movq	%rax, %rdi	# 1120	[c=4 l=3]  *movdi_internal/3
+	movq	%rcx, %rsi	# 1118	[c=4 l=3]  *movdi_internal/3
+	subq	920(%rbx), %rsi	# 117	[c=13 l=7]  *subdi_1/1
+	subq	%rdx, %rdi	# 118	[c=4 l=3]  *subdi_1/0
+	movq	%rsi, -272(%rbp)	# 1232	[c=4 l=7]  *movdi_internal/5
+	movq	%rdi, -280(%rbp)	# 1231	[c=4 l=7]  *movdi_internal/5
+	cmpq	%rdx, %rax	# 119	[c=4 l=3]  *cmpdi_1/0
+	jnb	.L261	# 120	[c=13 l=2]  *jcc
+	subq	$1, %rsi	# 122	[c=4 l=4]  *adddi_1/0
+	addq	$1000000, %rdi	# 123	[c=4 l=7]  *adddi_1/0
+	movq	%rsi, -272(%rbp)	# 1123	[c=4 l=7]  *movdi_internal/5
+	movq	%rdi, -280(%rbp)	# 1125	[c=4 l=7]  *movdi_internal/5
+.L261:
+	movq	-272(%rbp), %rsi	# 1233	[c=9 l=7]  *movdi_internal/3
+	testq	%rsi, %rsi	# 128	[c=4 l=3]  *cmpdi_ccno_1/0
+	js	.L262	# 129	[c=13 l=6]  *jcc
+	pxor	%xmm2, %xmm2	# 1494	[c=4 l=4]  movv2df_internal/0
+	cvtsi2sdq	%rsi, %xmm2	# 1495	[c=4 l=5]  sse2_cvtsi2sdq/0
+.L263:
+	movsd	.LC19(%rip), %xmm5	# 140	[c=6 l=8]  *movdf_internal/14
+	movq	-280(%rbp), %rdi	# 1235	[c=9 l=7]  *movdi_internal/3
+	mulsd	%xmm5, %xmm2	# 141	[c=20 l=4]  *fop_df_comm/1
+	testq	%rdi, %rdi	# 144	[c=4 l=3]  *cmpdi_ccno_1/0
+	js	.L264	# 145	[c=13 l=6]  *jcc
+	pxor	%xmm0, %xmm0	# 1492	[c=4 l=4]  movv2df_internal/0
+	cvtsi2sdq	%rdi, %xmm0	# 1493	[c=4 l=5]  sse2_cvtsi2sdq/0
+.L265:
+	movsd	.LC20(%rip), %xmm4	# 156	[c=6 l=8]  *movdf_internal/14
+	movq	968(%rbx), %r10	# 159	[c=9 l=7]  *movdi_internal/3
+	movq	%rax, %rsi	# 1138	[c=4 l=3]  *movdi_internal/3
+	movq	976(%rbx), %rdx	# 160	[c=9 l=7]  *movdi_internal/3
+	mulsd	%xmm4, %xmm0	# 157	[c=20 l=4]  *fop_df_comm/1
+	subq	%r10, %rcx	# 161	[c=4 l=3]  *subdi_1/0
+	subq	%rdx, %rsi	# 162	[c=4 l=3]  *subdi_1/0
+	movq	%rcx, -288(%rbp)	# 1238	[c=4 l=7]  *movdi_internal/5
+	movq	%rsi, -296(%rbp)	# 1237	[c=4 l=7]  *movdi_internal/5
+	addsd	%xmm0, %xmm2	# 158	[c=12 l=4]  *fop_df_comm/1
+	cmpq	%rdx, %rax	# 163	[c=4 l=3]  *cmpdi_1/0
+	jnb	.L266	# 164	[c=13 l=2]  *jcc
+	subq	$1, %rcx	# 166	[c=4 l=4]  *adddi_1/0
+	addq	$1000000, %rsi	# 167	[c=4 l=7]  *adddi_1/0
+	movq	%rcx, -288(%rbp)	# 1141	[c=4 l=7]  *movdi_internal/5
+	movq	%rsi, -296(%rbp)	# 1143	[c=4 l=7]  *movdi_internal/5
+.L266:
+	movq	-288(%rbp), %rax	# 1239	[c=9 l=7]  *movdi_internal/3
+	testq	%rax, %rax	# 172	[c=4 l=3]  *cmpdi_ccno_1/0
+	js	.L267	# 173	[c=13 l=6]  *jcc
+	pxor	%xmm1, %xmm1	# 1490	[c=4 l=4]  movv2df_internal/0
+	cvtsi2sdq	%rax, %xmm1	# 1491	[c=4 l=5]  sse2_cvtsi2sdq/0
+.L268:
+	movq	-296(%rbp), %rax	# 1241	[c=9 l=7]  *movdi_internal/3
+	mulsd	%xmm5, %xmm1	# 185	[c=20 l=4]  *fop_df_comm/1
+	testq	%rax, %rax	# 188	[c=4 l=3]  *cmpdi_ccno_1/0
+	js	.L269	# 189	[c=13 l=6]  *jcc
+	pxor	%xmm0, %xmm0	# 1488	[c=4 l=4]  movv2df_internal/0
+	cvtsi2sdq	%rax, %xmm0	# 1489	[c=4 l=5]  sse2_cvtsi2sdq/0
+.L270:
+	mulsd	%xmm4, %xmm0	# 201	[c=20 l=4]  *fop_df_comm/1
+	movq	952(%rbx), %r9	# 203	[c=9 l=7]  *movdi_internal/3
+	movq	960(%rbx), %rax	# 204	[c=9 l=7]  *movdi_internal/3
+	movq	%rdx, %r11	# 1156	[c=4 l=3]  *movdi_internal/3
+	subq	%r9, %r10	# 205	[c=4 l=3]  *subdi_1/0
+	subq	%rax, %r11	# 206	[c=4 l=3]  *subdi_1/0
+	addsd	%xmm0, %xmm1	# 202	[c=12 l=4]  *fop_df_comm/1
+	movsd	%xmm1, -304(%rbp)	# 1155	[c=4 l=8]  *movdf_internal/15
+	cmpq	%rax, %rdx	# 207	[c=4 l=3]  *cmpdi_1/0
+	jnb	.L271	# 208	[c=13 l=2]  *jcc
+	subq	$1, %r10	# 210	[c=4 l=4]  *adddi_1/0
+	addq	$1000000, %r11	# 211	[c=4 l=7]  *adddi_1/0
+.L271:
+	testq	%r10, %r10	# 216	[c=4 l=3]  *cmpdi_ccno_1/0
+	js	.L272	# 217	[c=13 l=6]  *jcc
+	pxor	%xmm3, %xmm3	# 1486	[c=4 l=4]  movv2df_internal/0
+	cvtsi2sdq	%r10, %xmm3	# 1487	[c=4 l=5]  sse2_cvtsi2sdq/0
+.L273:
+	mulsd	%xmm5, %xmm3	# 229	[c=20 l=4]  *fop_df_comm/1
+	testq	%r11, %r11	# 232	[c=4 l=3]  *cmpdi_ccno_1/0
+	js	.L274	# 233	[c=13 l=6]  *jcc
+	pxor	%xmm1, %xmm1	# 1484	[c=4 l=4]  movv2df_internal/0
+	cvtsi2sdq	%r11, %xmm1	# 1485	[c=4 l=5]  sse2_cvtsi2sdq/0
+.L275:
+	mulsd	%xmm4, %xmm1	# 245	[c=20 l=4]  *fop_df_comm/1
+	movq	944(%rbx), %rdx	# 247	[c=9 l=7]  *movdi_internal/3
+	movq	%rax, %r8	# 1166	[c=4 l=3]  *movdi_internal/3
+	subq	936(%rbx), %r9	# 248	[c=13 l=7]  *subdi_1/1
+	subq	%rdx, %r8	# 249	[c=4 l=3]  *subdi_1/0
+	addsd	%xmm1, %xmm3	# 246	[c=12 l=4]  *fop_df_comm/1
+	cmpq	%rdx, %rax	# 250	[c=4 l=3]  *cmpdi_1/0
+	jnb	.L276	# 251	[c=13 l=2]  *jcc
+	subq	$1, %r9	# 253	[c=4 l=4]  *adddi_1/0
+	addq	$1000000, %r8	# 254	[c=4 l=7]  *adddi_1/0
+.L276:
+	testq	%r9, %r9	# 259	[c=4 l=3]  *cmpdi_ccno_1/0
+	js	.L277	# 260	[c=13 l=6]  *jcc
+	pxor	%xmm0, %xmm0	# 1482	[c=4 l=4]  movv2df_internal/0
+	cvtsi2sdq	%r9, %xmm0	# 1483	[c=4 l=5]  sse2_cvtsi2sdq/0
+.L278:
+	mulsd	%xmm5, %xmm0	# 272	[c=20 l=4]  *fop_df_comm/1
+	testq	%r8, %r8	# 275	[c=4 l=3]  *cmpdi_ccno_1/0
+	js	.L279	# 276	[c=13 l=6]  *jcc
+	pxor	%xmm1, %xmm1	# 1480	[c=4 l=4]  movv2df_internal/0
+	cvtsi2sdq	%r8, %xmm1	# 1481	[c=4 l=5]  sse2_cvtsi2sdq/0
+.L280:
+	mulsd	%xmm4, %xmm1	# 288	[c=20 l=4]  *fop_df_comm/1
+	movl	16(%rbx), %esi	# 290	[c=9 l=3]  *movsi_internal/0
+	addsd	%xmm1, %xmm0	# 289	[c=12 l=4]  *fop_df_comm/1
+	comisd	.LC21(%rip), %xmm0	# 292	[c=10 l=8]  *cmpidf/1
+	pxor	%xmm1, %xmm1	# 20	[c=4 l=4]  *movdf_internal/12
+	jbe	.L281	# 293	[c=13 l=2]  *jcc
+	movl	%esi, %eax	# 298	[c=1 l=2]  *zero_extendsidi2/3
+	pxor	%xmm1, %xmm1	# 1478	[c=4 l=4]  movv2df_internal/0
+	cvtsi2sdq	%rax, %xmm1	# 1479	[c=4 l=5]  sse2_cvtsi2sdq/0
+	divsd	%xmm0, %xmm1	# 313	[c=68 l=4]  *fop_df_1/2
+.L281:
+	movl	$1000, %ecx	# 317	[c=4 l=5]  *movdi_internal/2
+	xorl	%edx, %edx	# 1389	[c=4 l=2]  *movdi_xor
+	movq	%r8, %rax	# 1176	[c=4 l=3]  *movdi_internal/3
+	movq	904(%rbx), %rdi	# 326	[c=9 l=7]  *movdi_internal/3
+	divq	%rcx	# 1315	[c=0 l=3]  *udivmoddi4_noext
+	movl	$60, %ecx	# 320	[c=4 l=5]  *movdi_internal/2
+	xorl	%edx, %edx	# 1390	[c=4 l=2]  *movdi_xor
+	movq	%rax, -320(%rbp)	# 1177	[c=4 l=7]  *movdi_internal/5
+	movq	%r9, %rax	# 1178	[c=4 l=3]  *movdi_internal/3
+	divq	%rcx	# 1317	[c=0 l=3]  *udivmoddi4_noext
+	comisd	.LC21(%rip), %xmm2	# 328	[c=10 l=8]  *cmpidf/1
+	movq	%rdx, %rcx	# 1180	[c=4 l=3]  *movdi_internal/3
+	jbe	.L351	# 329	[c=13 l=6]  *jcc
+	movsd	.LC11(%rip), %xmm6	# 334	[c=6 l=8]  *movdf_internal/14
+	movq	%r10, -336(%rbp)	# 1246	[c=4 l=7]  *movdi_internal/5
+	movq	%rax, %rdx	# 346	[c=4 l=3]  *movdi_internal/3
+	movl	$2, %eax	# 350	[c=4 l=5]  *movqi_internal/3
+	movq	%r11, -344(%rbp)	# 1248	[c=4 l=7]  *movdi_internal/5
+	mulsd	%xmm6, %xmm0	# 335	[c=20 l=4]  *fop_df_comm/1
+	movsd	%xmm3, -352(%rbp)	# 1250	[c=4 l=8]  *movdf_internal/15
+	movsd	%xmm2, -328(%rbp)	# 1243	[c=4 l=8]  *movdf_internal/15
+	movsd	%xmm6, -312(%rbp)	# 1245	[c=4 l=8]  *movdf_internal/15
+	pushq	%r10	# 1388	[c=4 l=2]  *pushdi2_rex64/0
+	pushq	%rsi	# 338	[c=4 l=1]  *pushsi2_rex64/0
+	divsd	%xmm2, %xmm0	# 336	[c=68 l=4]  *fop_df_1/2
+	pushq	%rsi	# 339	[c=4 l=1]  *pushsi2_rex64/0
+	leaq	.LC22(%rip), %rsi	# 347	[c=1 l=7]  *movdi_internal/4
+	pushq	-320(%rbp)	# 340	[c=9 l=6]  *pushdi2_rex64/0
+	call	fprintf@PLT	# 351	[c=10 l=5]  *call_value
+	movl	24(%rbx), %eax	# 1183	[c=9 l=3]  *movsi_internal/0
+	movsd	-352(%rbp), %xmm3	# 1251	[c=9 l=8]  *movdf_internal/14
+	addq	$32, %rsp	# 355	[c=4 l=4]  *adddi_1/0
+	movsd	-328(%rbp), %xmm2	# 1244	[c=9 l=8]  *movdf_internal/14
+	movq	-336(%rbp), %r10	# 1247	[c=9 l=7]  *movdi_internal/3
+	leal	1(%rax), %r8d	# 1313	[c=4 l=4]  *leasi
+	subl	20(%rbx), %r8d	# 354	[c=13 l=4]  *subsi_1/1
+	movq	-344(%rbp), %r11	# 1249	[c=9 l=7]  *movdi_internal/3
+	comisd	.LC21(%rip), %xmm3	# 357	[c=10 l=8]  *cmpidf/1
+	jbe	.L370	# 358	[c=13 l=6]  *jcc
+.L287:
+	movl	%r8d, %eax	# 392	[c=1 l=3]  *zero_extendsidi2/3
+	pxor	%xmm1, %xmm1	# 1476	[c=4 l=4]  movv2df_internal/0
+	cvtsi2sdq	%rax, %xmm1	# 1477	[c=4 l=5]  sse2_cvtsi2sdq/0
+	divsd	%xmm3, %xmm1	# 407	[c=68 l=4]  *fop_df_1/2
+.L289:
+	comisd	.LC21(%rip), %xmm2	# 412	[c=10 l=8]  *cmpidf/1
+	movq	904(%rbx), %rdi	# 410	[c=9 l=7]  *movdi_internal/3
+	ja	.L288	# 413	[c=13 l=6]  *jcc
+	movl	$60, %ecx	# 473	[c=4 l=5]  *movdi_internal/2
+	movq	%r10, %rax	# 1199	[c=4 l=3]  *movdi_internal/3
+	xorl	%edx, %edx	# 1377	[c=4 l=2]  *movdi_xor
+	movq	%r10, %r9	# 487	[c=4 l=3]  *movdi_internal/3
+	divq	%rcx	# 1305	[c=0 l=3]  *udivmoddi4_noext
+	movsd	%xmm2, -320(%rbp)	# 1263	[c=4 l=8]  *movdf_internal/15
+	pxor	%xmm0, %xmm0	# 486	[c=4 l=4]  *movdf_internal/12
+	movq	%rax, %rsi	# 1200	[c=4 l=3]  *movdi_internal/3
+	movq	%rdx, %rcx	# 1201	[c=4 l=3]  *movdi_internal/3
+	xorl	%edx, %edx	# 1380	[c=4 l=2]  *movdi_xor
+	pushq	%rax	# 1379	[c=4 l=1]  *pushdi2_rex64/0
+	movq	%r11, %rax	# 1202	[c=4 l=3]  *movdi_internal/3
+	pushq	%r8	# 478	[c=4 l=2]  *pushsi2_rex64/0
+	pushq	%r8	# 479	[c=4 l=2]  *pushsi2_rex64/0
+	movl	$1000, %r8d	# 481	[c=4 l=6]  *movdi_internal/2
+	divq	%r8	# 1307	[c=0 l=3]  *udivmoddi4_noext
+	movq	%rsi, %rdx	# 490	[c=4 l=3]  *movdi_internal/3
+	movq	%r11, %r8	# 488	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC23(%rip), %rsi	# 491	[c=1 l=7]  *movdi_internal/4
+	pushq	%rax	# 483	[c=4 l=1]  *pushdi2_rex64/0
+	movl	$2, %eax	# 494	[c=4 l=5]  *movqi_internal/3
+	call	fprintf@PLT	# 495	[c=10 l=5]  *call_value
+	movsd	-304(%rbp), %xmm7	# 1204	[c=9 l=8]  *movdf_internal/14
+	addq	$32, %rsp	# 497	[c=4 l=4]  *adddi_1/0
+	comisd	.LC21(%rip), %xmm7	# 499	[c=10 l=8]  *cmpidf/1
+	movsd	-320(%rbp), %xmm2	# 1264	[c=9 l=8]  *movdf_internal/14
+	jbe	.L371	# 500	[c=13 l=6]  *jcc
+.L300:
+	movq	40(%rbx), %rax	# 453	[c=9 l=4]  *movdi_internal/3
+	testq	%rax, %rax	# 456	[c=4 l=3]  *cmpdi_ccno_1/0
+	js	.L297	# 457	[c=13 l=6]  *jcc
+	pxor	%xmm1, %xmm1	# 1474	[c=4 l=4]  movv2df_internal/0
+	cvtsi2sdq	%rax, %xmm1	# 1475	[c=4 l=5]  sse2_cvtsi2sdq/0
+.L298:
+	divsd	-304(%rbp), %xmm1	# 468	[c=77 l=8]  *fop_df_1/2
+.L299:
+	comisd	.LC21(%rip), %xmm2	# 505	[c=10 l=8]  *cmpidf/1
+	movq	904(%rbx), %rdi	# 503	[c=9 l=7]  *movdi_internal/3
+	ja	.L295	# 506	[c=13 l=6]  *jcc
+	movq	-288(%rbp), %rax	# 1215	[c=9 l=7]  *movdi_internal/3
+	movl	$60, %ecx	# 557	[c=4 l=5]  *movdi_internal/2
+	xorl	%edx, %edx	# 1365	[c=4 l=2]  *movdi_xor
+	pushq	%r8	# 1367	[c=4 l=2]  *pushdi2_rex64/0
+	movl	$1000, %r8d	# 563	[c=4 l=6]  *movdi_internal/2
+	movq	-288(%rbp), %r9	# 569	[c=9 l=7]  *movdi_internal/3
+	pxor	%xmm0, %xmm0	# 568	[c=4 l=4]  *movdf_internal/12
+	divq	%rcx	# 1297	[c=0 l=3]  *udivmoddi4_noext
+	movq	%rax, %rsi	# 1216	[c=4 l=3]  *movdi_internal/3
+	movq	-296(%rbp), %rax	# 1218	[c=9 l=7]  *movdi_internal/3
+	movq	%rdx, %rcx	# 1217	[c=4 l=3]  *movdi_internal/3
+	xorl	%edx, %edx	# 1368	[c=4 l=2]  *movdi_xor
+	divq	%r8	# 1299	[c=0 l=3]  *udivmoddi4_noext
+	movq	-296(%rbp), %r8	# 570	[c=9 l=7]  *movdi_internal/3
+	movq	%rsi, %rdx	# 572	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC24(%rip), %rsi	# 573	[c=1 l=7]  *movdi_internal/4
+	pushq	%rax	# 565	[c=4 l=1]  *pushdi2_rex64/0
+	movl	$2, %eax	# 576	[c=4 l=5]  *movqi_internal/3
+	call	fprintf@PLT	# 577	[c=10 l=5]  *call_value
+	popq	%r9	# 1369	[c=9 l=2]  *popdi1
+	pxor	%xmm1, %xmm1	# 25	[c=4 l=4]  *movdf_internal/12
+	popq	%r10	# 1370	[c=9 l=2]  *popdi1
+.L305:
+	movq	-272(%rbp), %rax	# 1220	[c=9 l=7]  *movdi_internal/3
+	movl	$60, %ecx	# 582	[c=4 l=5]  *movdi_internal/2
+	xorl	%edx, %edx	# 1359	[c=4 l=2]  *movdi_xor
+	movl	$1000, %r8d	# 589	[c=4 l=6]  *movdi_internal/2
+	movq	904(%rbx), %rdi	# 586	[c=9 l=7]  *movdi_internal/3
+	divq	%rcx	# 1293	[c=0 l=3]  *udivmoddi4_noext
+	movq	%rax, %rsi	# 1221	[c=4 l=3]  *movdi_internal/3
+	pushq	%rax	# 1361	[c=4 l=1]  *pushdi2_rex64/0
+	movq	-280(%rbp), %rax	# 1223	[c=9 l=7]  *movdi_internal/3
+	movq	%rdx, %rcx	# 1222	[c=4 l=3]  *movdi_internal/3
+	xorl	%edx, %edx	# 1362	[c=4 l=2]  *movdi_xor
+	movsd	-312(%rbp), %xmm0	# 593	[c=9 l=8]  *movdf_internal/14
+	movq	-272(%rbp), %r9	# 594	[c=9 l=7]  *movdi_internal/3
+	divq	%r8	# 1295	[c=0 l=3]  *udivmoddi4_noext
+	movq	-280(%rbp), %r8	# 595	[c=9 l=7]  *movdi_internal/3
+	movq	%rsi, %rdx	# 597	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC25(%rip), %rsi	# 598	[c=1 l=7]  *movdi_internal/4
+	pushq	%rax	# 591	[c=4 l=1]  *pushdi2_rex64/0
+	movl	$2, %eax	# 601	[c=4 l=5]  *movqi_internal/3
+	call	fprintf@PLT	# 602	[c=10 l=5]  *call_value
+	cmpl	$0, 536(%rbx)	# 604	[c=13 l=7]  *cmpsi_ccno_1/1
+	popq	%rdx	# 1363	[c=9 l=1]  *popdi1
+	popq	%rcx	# 1364	[c=9 l=1]  *popdi1
+	jne	.L312	# 605	[c=13 l=6]  *jcc
+	cmpl	$0, 600(%rbx)	# 617	[c=13 l=7]  *cmpsi_ccno_1/1
+	jne	.L307	# 618	[c=13 l=6]  *jcc
+	cmpl	$0, 584(%rbx)	# 620	[c=13 l=7]  *cmpsi_ccno_1/1
+	je	.L259	# 621	[c=13 l=6]  *jcc
+	cmpl	$0, 488(%rbx)	# 623	[c=13 l=7]  *cmpsi_ccno_1/1
+	je	.L259	# 624	[c=13 l=6]  *jcc
+	jmp	.L307	# 1416	[c=1 l=5]  jump
+.L369:
+	movq	904(%rbx), %rdi	# 769	[c=9 l=7]  *movdi_internal/3
+	leaq	.LC30(%rip), %rsi	# 771	[c=1 l=7]  *movdi_internal/4
+	xorl	%eax, %eax	# 1354	[c=4 l=2]  *movdi_xor
+	call	fprintf@PLT	# 775	[c=10 l=5]  *call_value
+	jmp	.L323	# 1418	[c=1 l=5]  jump
+.L368:
+	movq	904(%rbx), %rdi	# 745	[c=9 l=7]  *movdi_internal/3
+	leaq	.LC28(%rip), %rsi	# 747	[c=1 l=7]  *movdi_internal/4
+	xorl	%eax, %eax	# 1356	[c=4 l=2]  *movdi_xor
+	call	fprintf@PLT	# 751	[c=10 l=5]  *call_value
+	jmp	.L322	# 1420	[c=1 l=5]  jump
+.L367:
+	leaq	.LC17(%rip), %rdx	# 27	[c=1 l=7]  *movdi_internal/4
+	jmp	.L320	# 1422	[c=1 l=5]  jump
+.L370:
+	movq	904(%rbx), %rdi	# 966	[c=9 l=7]  *movdi_internal/3
+	pxor	%xmm1, %xmm1	# 22	[c=4 l=4]  *movdf_internal/12
+.L288:
+	movl	$60, %ecx	# 422	[c=4 l=5]  *movdi_internal/2
+	movq	%r10, %rax	# 1190	[c=4 l=3]  *movdi_internal/3
+	xorl	%edx, %edx	# 1381	[c=4 l=2]  *movdi_xor
+	movq	%r10, %r9	# 436	[c=4 l=3]  *movdi_internal/3
+	divq	%rcx	# 1309	[c=0 l=3]  *udivmoddi4_noext
+	movsd	%xmm2, -320(%rbp)	# 1261	[c=4 l=8]  *movdf_internal/15
+	mulsd	-312(%rbp), %xmm3	# 420	[c=29 l=8]  *fop_df_comm/1
+	divsd	%xmm2, %xmm3	# 421	[c=68 l=4]  *fop_df_1/2
+	movq	%rax, %rsi	# 1191	[c=4 l=3]  *movdi_internal/3
+	movq	%rdx, %rcx	# 1192	[c=4 l=3]  *movdi_internal/3
+	xorl	%edx, %edx	# 1384	[c=4 l=2]  *movdi_xor
+	pushq	%rax	# 1383	[c=4 l=1]  *pushdi2_rex64/0
+	movq	%r11, %rax	# 1193	[c=4 l=3]  *movdi_internal/3
+	pushq	%r8	# 428	[c=4 l=2]  *pushsi2_rex64/0
+	pushq	%r8	# 429	[c=4 l=2]  *pushsi2_rex64/0
+	movl	$1000, %r8d	# 431	[c=4 l=6]  *movdi_internal/2
+	divq	%r8	# 1311	[c=0 l=3]  *udivmoddi4_noext
+	movq	%rsi, %rdx	# 439	[c=4 l=3]  *movdi_internal/3
+	movq	%r11, %r8	# 437	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC23(%rip), %rsi	# 440	[c=1 l=7]  *movdi_internal/4
+	movapd	%xmm3, %xmm0	# 1189	[c=4 l=4]  *movdf_internal/13
+	pushq	%rax	# 433	[c=4 l=1]  *pushdi2_rex64/0
+	movl	$2, %eax	# 443	[c=4 l=5]  *movqi_internal/3
+	call	fprintf@PLT	# 444	[c=10 l=5]  *call_value
+	movsd	-304(%rbp), %xmm7	# 1195	[c=9 l=8]  *movdf_internal/14
+	addq	$32, %rsp	# 445	[c=4 l=4]  *adddi_1/0
+	comisd	.LC21(%rip), %xmm7	# 447	[c=10 l=8]  *cmpidf/1
+	movsd	-320(%rbp), %xmm2	# 1262	[c=9 l=8]  *movdf_internal/14
+	ja	.L300	# 448	[c=13 l=6]  *jcc
+	movq	904(%rbx), %rdi	# 969	[c=9 l=7]  *movdi_internal/3
+	pxor	%xmm1, %xmm1	# 24	[c=4 l=4]  *movdf_internal/12
+.L295:
+	movq	-288(%rbp), %rax	# 1208	[c=9 l=7]  *movdi_internal/3
+	movl	$60, %ecx	# 515	[c=4 l=5]  *movdi_internal/2
+	xorl	%edx, %edx	# 1373	[c=4 l=2]  *movdi_xor
+	movsd	-304(%rbp), %xmm0	# 1205	[c=9 l=8]  *movdf_internal/14
+	mulsd	-312(%rbp), %xmm0	# 513	[c=29 l=8]  *fop_df_comm/1
+	movsd	%xmm2, -304(%rbp)	# 1267	[c=4 l=8]  *movdf_internal/15
+	movl	$1000, %r8d	# 522	[c=4 l=6]  *movdi_internal/2
+	divq	%rcx	# 1301	[c=0 l=3]  *udivmoddi4_noext
+	divsd	%xmm2, %xmm0	# 514	[c=68 l=4]  *fop_df_1/2
+	movq	%rax, %rsi	# 1209	[c=4 l=3]  *movdi_internal/3
+	pushq	%rax	# 1375	[c=4 l=1]  *pushdi2_rex64/0
+	movq	-296(%rbp), %rax	# 1211	[c=9 l=7]  *movdi_internal/3
+	movq	%rdx, %rcx	# 1210	[c=4 l=3]  *movdi_internal/3
+	xorl	%edx, %edx	# 1376	[c=4 l=2]  *movdi_xor
+	movq	-288(%rbp), %r9	# 527	[c=9 l=7]  *movdi_internal/3
+	divq	%r8	# 1303	[c=0 l=3]  *udivmoddi4_noext
+	movq	-296(%rbp), %r8	# 528	[c=9 l=7]  *movdi_internal/3
+	movq	%rsi, %rdx	# 530	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC24(%rip), %rsi	# 531	[c=1 l=7]  *movdi_internal/4
+	pushq	%rax	# 524	[c=4 l=1]  *pushdi2_rex64/0
+	movl	$2, %eax	# 534	[c=4 l=5]  *movqi_internal/3
+	call	fprintf@PLT	# 535	[c=10 l=5]  *call_value
+	movq	40(%rbx), %rax	# 536	[c=9 l=4]  *movdi_internal/3
+	movsd	-304(%rbp), %xmm2	# 1268	[c=9 l=8]  *movdf_internal/14
+	testq	%rax, %rax	# 539	[c=4 l=3]  *cmpdi_ccno_1/0
+	js	.L303	# 540	[c=13 l=6]  *jcc
+	pxor	%xmm1, %xmm1	# 1472	[c=4 l=4]  movv2df_internal/0
+	cvtsi2sdq	%rax, %xmm1	# 1473	[c=4 l=5]  sse2_cvtsi2sdq/0
+.L304:
+	divsd	%xmm2, %xmm1	# 551	[c=68 l=4]  *fop_df_1/2
+	popq	%r11	# 1371	[c=9 l=2]  *popdi1
+	popq	%rax	# 1372	[c=9 l=1]  *popdi1
+	jmp	.L305	# 1424	[c=1 l=5]  jump
+.L351:
+	movq	%r11, -336(%rbp)	# 1257	[c=4 l=7]  *movdi_internal/5
+	pxor	%xmm0, %xmm0	# 370	[c=4 l=4]  *movdf_internal/12
+	movq	%r10, -328(%rbp)	# 1255	[c=4 l=7]  *movdi_internal/5
+	movsd	%xmm3, -344(%rbp)	# 1259	[c=4 l=8]  *movdf_internal/15
+	movsd	%xmm2, -312(%rbp)	# 1253	[c=4 l=8]  *movdf_internal/15
+	pushq	%rdx	# 1386	[c=4 l=1]  *pushdi2_rex64/0
+	movq	%rax, %rdx	# 374	[c=4 l=3]  *movdi_internal/3
+	movl	$2, %eax	# 378	[c=4 l=5]  *movqi_internal/3
+	pushq	%rsi	# 365	[c=4 l=1]  *pushsi2_rex64/0
+	pushq	%rsi	# 366	[c=4 l=1]  *pushsi2_rex64/0
+	leaq	.LC22(%rip), %rsi	# 375	[c=1 l=7]  *movdi_internal/4
+	pushq	-320(%rbp)	# 367	[c=9 l=6]  *pushdi2_rex64/0
+	call	fprintf@PLT	# 379	[c=10 l=5]  *call_value
+	movl	24(%rbx), %eax	# 1184	[c=9 l=3]  *movsi_internal/0
+	movsd	-344(%rbp), %xmm3	# 1260	[c=9 l=8]  *movdf_internal/14
+	addq	$32, %rsp	# 383	[c=4 l=4]  *adddi_1/0
+	movsd	-312(%rbp), %xmm2	# 1254	[c=9 l=8]  *movdf_internal/14
+	movq	-328(%rbp), %r10	# 1256	[c=9 l=7]  *movdi_internal/3
+	leal	1(%rax), %r8d	# 1312	[c=4 l=4]  *leasi
+	subl	20(%rbx), %r8d	# 382	[c=13 l=4]  *subsi_1/1
+	movq	-336(%rbp), %r11	# 1258	[c=9 l=7]  *movdi_internal/3
+	comisd	.LC21(%rip), %xmm3	# 385	[c=10 l=8]  *cmpidf/1
+	jbe	.L352	# 386	[c=13 l=6]  *jcc
+	movsd	.LC11(%rip), %xmm7	# 967	[c=6 l=8]  *movdf_internal/14
+	movsd	%xmm7, -312(%rbp)	# 1185	[c=4 l=8]  *movdf_internal/15
+	jmp	.L287	# 1426	[c=1 l=5]  jump
+.L274:
+	movq	%r11, %rdx	# 1162	[c=4 l=3]  *movdi_internal/3
+	movq	%r11, %rcx	# 1164	[c=4 l=3]  *movdi_internal/3
+	pxor	%xmm1, %xmm1	# 1470	[c=4 l=4]  movv2df_internal/0
+	shrq	%rdx	# 238	[c=4 l=3]  *lshrdi3_1/0
+	andl	$1, %ecx	# 239	[c=4 l=3]  *anddi_1/0
+	orq	%rcx, %rdx	# 240	[c=4 l=3]  *iordi_1/0
+	cvtsi2sdq	%rdx, %xmm1	# 1471	[c=4 l=5]  sse2_cvtsi2sdq/0
+	addsd	%xmm1, %xmm1	# 242	[c=12 l=4]  *fop_df_comm/1
+	jmp	.L275	# 1428	[c=1 l=5]  jump
+.L272:
+	movq	%r10, %rdx	# 1158	[c=4 l=3]  *movdi_internal/3
+	movq	%r10, %rcx	# 1160	[c=4 l=3]  *movdi_internal/3
+	pxor	%xmm3, %xmm3	# 1468	[c=4 l=4]  movv2df_internal/0
+	shrq	%rdx	# 222	[c=4 l=3]  *lshrdi3_1/0
+	andl	$1, %ecx	# 223	[c=4 l=3]  *anddi_1/0
+	orq	%rcx, %rdx	# 224	[c=4 l=3]  *iordi_1/0
+	cvtsi2sdq	%rdx, %xmm3	# 1469	[c=4 l=5]  sse2_cvtsi2sdq/0
+	addsd	%xmm3, %xmm3	# 226	[c=12 l=4]  *fop_df_comm/1
+	jmp	.L273	# 1430	[c=1 l=5]  jump
+.L269:
+	movq	-296(%rbp), %rcx	# 1242	[c=9 l=7]  *movdi_internal/3
+	pxor	%xmm0, %xmm0	# 1466	[c=4 l=4]  movv2df_internal/0
+	movq	%rcx, %rax	# 1150	[c=4 l=3]  *movdi_internal/3
+	andl	$1, %ecx	# 195	[c=4 l=3]  *anddi_1/0
+	shrq	%rax	# 194	[c=4 l=3]  *lshrdi3_1/0
+	orq	%rcx, %rax	# 196	[c=4 l=3]  *iordi_1/0
+	cvtsi2sdq	%rax, %xmm0	# 1467	[c=4 l=5]  sse2_cvtsi2sdq/0
+	addsd	%xmm0, %xmm0	# 198	[c=12 l=4]  *fop_df_comm/1
+	jmp	.L270	# 1432	[c=1 l=5]  jump
+.L267:
+	movq	-288(%rbp), %rcx	# 1240	[c=9 l=7]  *movdi_internal/3
+	pxor	%xmm1, %xmm1	# 1464	[c=4 l=4]  movv2df_internal/0
+	movq	%rcx, %rax	# 1145	[c=4 l=3]  *movdi_internal/3
+	andl	$1, %ecx	# 179	[c=4 l=3]  *anddi_1/0
+	shrq	%rax	# 178	[c=4 l=3]  *lshrdi3_1/0
+	orq	%rcx, %rax	# 180	[c=4 l=3]  *iordi_1/0
+	cvtsi2sdq	%rax, %xmm1	# 1465	[c=4 l=5]  sse2_cvtsi2sdq/0
+	addsd	%xmm1, %xmm1	# 182	[c=12 l=4]  *fop_df_comm/1
+	jmp	.L268	# 1434	[c=1 l=5]  jump
+.L279:
+	movq	%r8, %rax	# 1172	[c=4 l=3]  *movdi_internal/3
+	movq	%r8, %rdx	# 1174	[c=4 l=3]  *movdi_internal/3
+	pxor	%xmm1, %xmm1	# 1462	[c=4 l=4]  movv2df_internal/0
+	shrq	%rax	# 281	[c=4 l=3]  *lshrdi3_1/0
+	andl	$1, %edx	# 282	[c=4 l=3]  *anddi_1/0
+	orq	%rdx, %rax	# 283	[c=4 l=3]  *iordi_1/0
+	cvtsi2sdq	%rax, %xmm1	# 1463	[c=4 l=5]  sse2_cvtsi2sdq/0
+	addsd	%xmm1, %xmm1	# 285	[c=12 l=4]  *fop_df_comm/1
+	jmp	.L280	# 1436	[c=1 l=5]  jump
+.L277:
+	movq	%r9, %rax	# 1168	[c=4 l=3]  *movdi_internal/3
+	movq	%r9, %rdx	# 1170	[c=4 l=3]  *movdi_internal/3
+	pxor	%xmm0, %xmm0	# 1460	[c=4 l=4]  movv2df_internal/0
+	shrq	%rax	# 265	[c=4 l=3]  *lshrdi3_1/0
+	andl	$1, %edx	# 266	[c=4 l=3]  *anddi_1/0
+	orq	%rdx, %rax	# 267	[c=4 l=3]  *iordi_1/0
+	cvtsi2sdq	%rax, %xmm0	# 1461	[c=4 l=5]  sse2_cvtsi2sdq/0
+	addsd	%xmm0, %xmm0	# 269	[c=12 l=4]  *fop_df_comm/1
+	jmp	.L278	# 1438	[c=1 l=5]  jump
+.L264:
+	movq	-280(%rbp), %rsi	# 1236	[c=9 l=7]  *movdi_internal/3
+	pxor	%xmm0, %xmm0	# 1458	[c=4 l=4]  movv2df_internal/0
+	movq	%rsi, %rdx	# 1132	[c=4 l=3]  *movdi_internal/3
+	andl	$1, %esi	# 151	[c=4 l=3]  *anddi_1/0
+	shrq	%rdx	# 150	[c=4 l=3]  *lshrdi3_1/0
+	orq	%rsi, %rdx	# 152	[c=4 l=3]  *iordi_1/0
+	cvtsi2sdq	%rdx, %xmm0	# 1459	[c=4 l=5]  sse2_cvtsi2sdq/0
+	addsd	%xmm0, %xmm0	# 154	[c=12 l=4]  *fop_df_comm/1
+	jmp	.L265	# 1440	[c=1 l=5]  jump
+.L262:
+	movq	-272(%rbp), %rsi	# 1234	[c=9 l=7]  *movdi_internal/3
+	pxor	%xmm2, %xmm2	# 1456	[c=4 l=4]  movv2df_internal/0
+	movq	%rsi, %rdx	# 1127	[c=4 l=3]  *movdi_internal/3
+	andl	$1, %esi	# 135	[c=4 l=3]  *anddi_1/0
+	shrq	%rdx	# 134	[c=4 l=3]  *lshrdi3_1/0
+	orq	%rsi, %rdx	# 136	[c=4 l=3]  *iordi_1/0
+	cvtsi2sdq	%rdx, %xmm2	# 1457	[c=4 l=5]  sse2_cvtsi2sdq/0
+	addsd	%xmm2, %xmm2	# 138	[c=12 l=4]  *fop_df_comm/1
+	jmp	.L263	# 1442	[c=1 l=5]  jump
+.L371:
+	pxor	%xmm1, %xmm1	# 23	[c=4 l=4]  *movdf_internal/12
+	jmp	.L299	# 1444	[c=1 l=5]  jump
+.L352:
+	movsd	.LC11(%rip), %xmm6	# 968	[c=6 l=8]  *movdf_internal/14
+	pxor	%xmm1, %xmm1	# 21	[c=4 l=4]  *movdf_internal/12
+	movsd	%xmm6, -312(%rbp)	# 1186	[c=4 l=8]  *movdf_internal/15
+	jmp	.L289	# 1446	[c=1 l=5]  jump
+.L297:
+	movq	%rax, %rdx	# 1196	[c=4 l=3]  *movdi_internal/3
+	andl	$1, %eax	# 463	[c=4 l=3]  *anddi_1/0
+	pxor	%xmm1, %xmm1	# 1454	[c=4 l=4]  movv2df_internal/0
+	shrq	%rdx	# 462	[c=4 l=3]  *lshrdi3_1/0
+	orq	%rax, %rdx	# 464	[c=4 l=3]  *iordi_1/0
+	cvtsi2sdq	%rdx, %xmm1	# 1455	[c=4 l=5]  sse2_cvtsi2sdq/0
+	addsd	%xmm1, %xmm1	# 466	[c=12 l=4]  *fop_df_comm/1
+	jmp	.L298	# 1448	[c=1 l=5]  jump
+.L303:
+	movq	%rax, %rdx	# 1213	[c=4 l=3]  *movdi_internal/3
+	andl	$1, %eax	# 546	[c=4 l=3]  *anddi_1/0
+	pxor	%xmm1, %xmm1	# 1452	[c=4 l=4]  movv2df_internal/0
+	shrq	%rdx	# 545	[c=4 l=3]  *lshrdi3_1/0
+	orq	%rax, %rdx	# 547	[c=4 l=3]  *iordi_1/0
+	cvtsi2sdq	%rdx, %xmm1	# 1453	[c=4 l=5]  sse2_cvtsi2sdq/0
+	addsd	%xmm1, %xmm1	# 549	[c=12 l=4]  *fop_df_comm/1
+	jmp	.L304	# 1450	[c=1 l=5]  jump
+	.cfi_endproc
+.LFE29:
+	.size	leave, .-leave
+	.section	.rodata.str1.1
+.LC33:
+	.string	"code must be unreachable"
+	.text
+	.p2align 4
+	.globl	log_cpu_address
+	.type	log_cpu_address, @function
+log_cpu_address:
+.LFB56:
+	.cfi_startproc
+	cmpl	$2, %edx	# 8	[c=4 l=3]  *cmpsi_1/0
+	je	.L373	# 9	[c=13 l=2]  *jcc
+	jg	.L374	# 14	[c=13 l=2]  *jcc
+	cmpl	$1, %edx	# 18	[c=4 l=3]  *cmpsi_1/0
+	ja	.L375	# 19	[c=13 l=2]  *jcc
+	movq	1040(%rdi), %rax	# 113	[c=9 l=7]  *movdi_internal/3
+	movslq	%esi, %rsi	# 32	[c=4 l=3]  *extendsidi2_rex64/1
+	addq	%rsi, %rax	# 114	[c=4 l=3]  *adddi_1/0
+	ret		# 78	[c=0 l=1]  simple_return_internal
+	.p2align 4,,10
+	.p2align 3
+.L374:
+	cmpl	$3, %edx	# 25	[c=4 l=3]  *cmpsi_1/0
+	jne	.L375	# 26	[c=13 l=2]  *jcc
+	movq	1048(%rdi), %rax	# 109	[c=9 l=7]  *movdi_internal/3
+	movslq	%esi, %rsi	# 46	[c=4 l=3]  *extendsidi2_rex64/1
+	addq	%rsi, %rax	# 110	[c=4 l=3]  *adddi_1/0
+	ret		# 98	[c=0 l=1]  simple_return_internal
+	.p2align 4,,10
+	.p2align 3
+.L373:
+	movq	1056(%rdi), %rax	# 111	[c=9 l=7]  *movdi_internal/3
+	movslq	%esi, %rsi	# 39	[c=4 l=3]  *extendsidi2_rex64/1
+	addq	%rsi, %rax	# 112	[c=4 l=3]  *adddi_1/0
+	ret		# 80	[c=0 l=1]  simple_return_internal
+.L375:
+	pushq	%rax	# 107	[c=4 l=1]  *pushdi2_prologue
+	.cfi_def_cfa_offset 16
+	leaq	.LC33(%rip), %rdx	# 53	[c=1 l=7]  *movdi_internal/4
+	movl	$8, %esi	# 55	[c=4 l=5]  *movsi_internal/0
+	xorl	%eax, %eax	# 108	[c=4 l=2]  *movdi_xor
+	call	leave	# 58	[c=0 l=5]  *call
+	.cfi_endproc
+.LFE56:
+	.size	log_cpu_address, .-log_cpu_address
+	.section	.rodata.str1.8
+	.align 8
+.LC34:
+	.string	"program counter 0x%x out of bounds (0x%x--0x%x)"
+	.text
+	.p2align 4
+	.type	bad_PC, @function
+bad_PC:
+.LFB75:
+	.cfi_startproc
+	subq	$8, %rsp	# 27	[c=4 l=4]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_def_cfa_offset 16
+	movl	24(%rdi), %eax	# 7	[c=9 l=3]  *movsi_internal/0
+	movl	20(%rdi), %r8d	# 12	[c=9 l=4]  *movsi_internal/0
+	leal	(%rsi,%rsi), %ecx	# 26	[c=12 l=3]  *leasi
+	leaq	.LC34(%rip), %rdx	# 14	[c=1 l=7]  *movdi_internal/4
+	movl	$1, %esi	# 16	[c=4 l=5]  *movsi_internal/0
+	leal	-1(%rax), %r9d	# 11	[c=4 l=4]  *leasi
+	xorl	%eax, %eax	# 34	[c=4 l=2]  *movdi_xor
+	call	leave	# 19	[c=0 l=5]  *call
+	.cfi_endproc
+.LFE75:
+	.size	bad_PC, .-bad_PC
+	.section	.rodata.str1.8
+	.align 8
+.LC35:
+	.string	"stack pointer overflow (SP = 0x%04x)"
+	.text
+	.p2align 4
+	.type	stack_overflow, @function
+stack_overflow:
+.LFB71:
+	.cfi_startproc
+	movl	%esi, %ecx	# 3	[c=4 l=2]  *movsi_internal/0
+	subq	$8, %rsp	# 20	[c=4 l=4]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_def_cfa_offset 16
+	leaq	.LC35(%rip), %rdx	# 8	[c=1 l=7]  *movdi_internal/4
+	xorl	%eax, %eax	# 27	[c=4 l=2]  *movdi_xor
+	movl	$1, %esi	# 10	[c=4 l=5]  *movsi_internal/0
+	call	leave	# 13	[c=0 l=5]  *call
+	.cfi_endproc
+.LFE71:
+	.size	stack_overflow, .-stack_overflow
+	.section	.rodata.str1.8
+	.align 8
+.LC36:
+	.string	"access to unmapped RAM address 0x%x (RAMEND = 0x%04x)"
+	.text
+	.p2align 4
+	.type	bad_address, @function
+bad_address:
+.LFB30:
+	.cfi_startproc
+	subq	$8, %rsp	# 22	[c=4 l=4]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_def_cfa_offset 16
+	movl	1000(%rdi), %r8d	# 8	[c=9 l=7]  *movsi_internal/0
+	movl	%esi, %ecx	# 3	[c=4 l=2]  *movsi_internal/0
+	xorl	%eax, %eax	# 29	[c=4 l=2]  *movdi_xor
+	leaq	.LC36(%rip), %rdx	# 10	[c=1 l=7]  *movdi_internal/4
+	movl	$1, %esi	# 12	[c=4 l=5]  *movsi_internal/0
+	call	leave	# 15	[c=0 l=5]  *call
+	.cfi_endproc
+.LFE30:
+	.size	bad_address, .-bad_address
+	.p2align 4
+	.type	data_read_mapped, @function
+data_read_mapped:
+.LFB35:
+	.cfi_startproc
+	movl	%esi, %eax	# 87	[c=4 l=2]  *movsi_internal/0
+	subl	5176(%rdi), %eax	# 8	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rdi), %eax	# 9	[c=13 l=6]  *cmpsi_1/1
+	jb	.L389	# 10	[c=13 l=2]  *jcc
+	movl	%esi, %eax	# 89	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %eax	# 12	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 85	[c=5 l=5]  *andsi_1_zext
+	movzbl	1080(%rdi,%rax), %eax	# 15	[c=10 l=8]  *movqi_internal/4
+	cmpb	$3, %al	# 16	[c=4 l=2]  *cmpqi_1/0
+	je	.L390	# 17	[c=13 l=2]  *jcc
+	cmpb	$4, %al	# 19	[c=4 l=2]  *cmpqi_1/0
+	je	.L391	# 20	[c=13 l=2]  *jcc
+	cmpb	$2, %al	# 22	[c=4 l=2]  *cmpqi_1/0
+	je	.L397	# 23	[c=13 l=2]  *jcc
+.L389:
+	subq	$8, %rsp	# 93	[c=4 l=4]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_def_cfa_offset 16
+	call	bad_address	# 61	[c=0 l=5]  *call
+	.p2align 4,,10
+	.p2align 3
+.L397:
+	.cfi_def_cfa_offset 8
+	movl	992(%rdi), %eax	# 25	[c=9 l=6]  *movsi_internal/0
+	subl	$16384, %esi	# 28	[c=4 l=6]  *addsi_1/0
+	movq	1056(%rdi), %rdx	# 31	[c=9 l=7]  *movdi_internal/3
+	leal	1(%rax,%rax), %eax	# 27	[c=8 l=4]  *leasi
+	andl	%esi, %eax	# 29	[c=4 l=2]  *andsi_1/0
+	cltq	# 30	[c=4 l=2]  *extendsidi2_rex64/0
+	movzbl	(%rdx,%rax), %eax	# 32	[c=13 l=4]  *zero_extendqisi2/0
+	ret		# 77	[c=0 l=1]  simple_return_internal
+	.p2align 4,,10
+	.p2align 3
+.L391:
+	movl	%esi, %eax	# 91	[c=4 l=2]  *movsi_internal/0
+	movq	1072(%rdi), %rdx	# 47	[c=9 l=7]  *movdi_internal/3
+	sarl	$12, %eax	# 44	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 84	[c=5 l=5]  *andsi_1_zext
+	movq	(%rdx,%rax,8), %rdx	# 48	[c=10 l=4]  *movdi_internal/3
+	xorl	%eax, %eax	# 109	[c=4 l=2]  *movdi_xor
+	testq	%rdx, %rdx	# 49	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L388	# 50	[c=13 l=2]  *jcc
+	andl	$4095, %esi	# 83	[c=5 l=6]  *andsi_1_zext
+	movzbl	(%rdx,%rsi), %eax	# 54	[c=13 l=4]  *zero_extendqisi2/0
+	ret		# 81	[c=0 l=1]  simple_return_internal
+	.p2align 4,,10
+	.p2align 3
+.L390:
+	movq	1048(%rdi), %rax	# 38	[c=9 l=7]  *movdi_internal/3
+	movslq	%esi, %rsi	# 37	[c=4 l=3]  *extendsidi2_rex64/1
+	movzbl	-4096(%rax,%rsi), %eax	# 39	[c=14 l=8]  *zero_extendqisi2/0
+	ret		# 79	[c=0 l=1]  simple_return_internal
+	.p2align 4,,10
+	.p2align 3
+.L388:
+	ret		# 100	[c=0 l=1]  simple_return_internal
+	.cfi_endproc
+.LFE35:
+	.size	data_read_mapped, .-data_read_mapped
+	.p2align 4
+	.type	data_read_page, @function
+data_read_page:
+.LFB45:
+	.cfi_startproc
+	movl	%esi, %eax	# 130	[c=4 l=2]  *movsi_internal/0
+	subl	5176(%rdi), %eax	# 8	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rdi), %eax	# 9	[c=13 l=6]  *cmpsi_1/1
+	jb	.L399	# 10	[c=13 l=2]  *jcc
+	movl	%esi, %eax	# 132	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %eax	# 12	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 128	[c=5 l=5]  *andsi_1_zext
+	movzbl	1080(%rdi,%rax), %eax	# 15	[c=10 l=8]  *movqi_internal/4
+	cmpb	$1, %al	# 16	[c=4 l=2]  *cmpqi_1/0
+	je	.L400	# 17	[c=13 l=2]  *jcc
+	cmpb	$2, %al	# 19	[c=4 l=2]  *cmpqi_1/0
+	je	.L401	# 20	[c=13 l=2]  *jcc
+.L399:
+	jmp	data_read_mapped	# 99	[c=10 l=5]  *sibcall_value
+	.p2align 4,,10
+	.p2align 3
+.L401:
+	addq	$1, 48(%rdi)	# 94	[c=13 l=5]  *adddi_1/0
+	jmp	data_read_mapped	# 156	[c=10 l=5]  *sibcall_value
+	.p2align 4,,10
+	.p2align 3
+.L400:
+	cmpl	$95, %esi	# 26	[c=4 l=3]  *cmpsi_1/0
+	je	.L417	# 27	[c=13 l=2]  *jcc
+.L402:
+	cmpl	6564(%rdi), %esi	# 46	[c=13 l=6]  *cmpsi_1/1
+	jnb	.L403	# 47	[c=13 l=2]  *jcc
+	movslq	%esi, %rax	# 49	[c=4 l=3]  *extendsidi2_rex64/1
+	cmpb	$0, 6568(%rdi,%rax)	# 50	[c=14 l=8]  *cmpqi_ccno_1/1
+	je	.L403	# 51	[c=13 l=2]  *jcc
+	cmpl	$1, 96(%rdi)	# 62	[c=13 l=4]  *cmpsi_1/0
+	movq	48(%rdi), %rdx	# 61	[c=9 l=4]  *movdi_internal/3
+	je	.L418	# 63	[c=13 l=2]  *jcc
+.L407:
+	jmp	periph_read@PLT	# 76	[c=10 l=5]  *sibcall_value
+	.p2align 4,,10
+	.p2align 3
+.L403:
+	cmpl	%esi, 1000(%rdi)	# 54	[c=13 l=6]  *cmpsi_1/0
+	jb	.L419	# 55	[c=13 l=2]  *jcc
+	movq	1040(%rdi), %rax	# 88	[c=9 l=7]  *movdi_internal/3
+	movslq	%esi, %rsi	# 87	[c=4 l=3]  *extendsidi2_rex64/1
+	movzbl	(%rax,%rsi), %eax	# 89	[c=13 l=4]  *zero_extendqisi2/0
+	ret		# 141	[c=0 l=1]  simple_return_internal
+	.p2align 4,,10
+	.p2align 3
+.L417:
+	movzbl	100(%rdi), %eax	# 29	[c=9 l=4]  *movqi_internal/4
+	testb	%al, %al	# 30	[c=4 l=2]  *cmpqi_ccno_1/0
+	je	.L402	# 31	[c=13 l=2]  *jcc
+	movq	1040(%rdi), %r8	# 33	[c=9 l=7]  *movdi_internal/3
+	movzbl	%al, %ecx	# 35	[c=4 l=3]  *zero_extendqisi2/0
+	notl	%ecx	# 36	[c=4 l=2]  *one_cmplsi2_1/0
+	movzbl	95(%r8), %edx	# 34	[c=13 l=5]  *zero_extendqisi2/0
+	andl	%ecx, %edx	# 37	[c=4 l=2]  *andsi_1/0
+	movq	104(%rdi), %rcx	# 38	[c=9 l=4]  *movdi_internal/3
+	andb	(%rcx), %al	# 39	[c=9 l=2]  *andqi_1/1
+	movzbl	%al, %eax	# 40	[c=4 l=3]  *zero_extendqisi2/0
+	orl	%edx, %eax	# 41	[c=4 l=2]  *iorsi_1/0
+	movb	%al, 95(%r8)	# 42	[c=4 l=4]  *movqi_internal/8
+	movb	$0, 100(%rdi)	# 43	[c=4 l=4]  *movqi_internal/8
+	jmp	.L402	# 164	[c=1 l=5]  jump
+	.p2align 4,,10
+	.p2align 3
+.L418:
+	movl	(%rdi), %eax	# 65	[c=6 l=2]  *zero_extendsidi2/3
+	salq	$4, %rax	# 67	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rdi), %rax	# 68	[c=13 l=7]  *adddi_1/1
+	movzwl	14(%rax), %eax	# 69	[c=13 l=4]  zero_extendhidi2/0
+	subq	%rax, %rdx	# 70	[c=4 l=3]  *subdi_1/0
+	jmp	.L407	# 166	[c=1 l=5]  jump
+.L419:
+	pushq	%rax	# 154	[c=4 l=1]  *pushdi2_prologue
+	.cfi_def_cfa_offset 16
+	call	bad_address	# 83	[c=0 l=5]  *call
+	.cfi_endproc
+.LFE45:
+	.size	data_read_page, .-data_read_page
+	.section	.rodata.str1.1
+.LC37:
+	.string	"external memory"
+	.text
+	.p2align 4
+	.type	data_write_mapped, @function
+data_write_mapped:
+.LFB36:
+	.cfi_startproc
+	pushq	%r12	# 121	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	movl	%esi, %eax	# 112	[c=4 l=2]  *movsi_internal/0
+	pushq	%rbp	# 122	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	movq	%rdi, %rbp	# 2	[c=4 l=3]  *movdi_internal/3
+	pushq	%rbx	# 123	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	movl	%esi, %ebx	# 3	[c=4 l=2]  *movsi_internal/0
+	subq	$16, %rsp	# 124	[c=4 l=4]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_def_cfa_offset 48
+	subl	5176(%rdi), %eax	# 8	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rdi), %eax	# 9	[c=13 l=6]  *cmpsi_1/1
+	jb	.L421	# 10	[c=13 l=2]  *jcc
+	movl	%esi, %eax	# 114	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %eax	# 12	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 110	[c=5 l=5]  *andsi_1_zext
+	movzbl	1080(%rdi,%rax), %eax	# 15	[c=10 l=8]  *movqi_internal/4
+	cmpb	$3, %al	# 16	[c=4 l=2]  *cmpqi_1/0
+	je	.L422	# 17	[c=13 l=2]  *jcc
+	cmpb	$4, %al	# 19	[c=4 l=2]  *cmpqi_1/0
+	jne	.L421	# 20	[c=13 l=2]  *jcc
+	movl	%esi, %eax	# 116	[c=4 l=2]  *movsi_internal/0
+	movq	1072(%rdi), %rcx	# 38	[c=9 l=7]  *movdi_internal/3
+	sarl	$12, %eax	# 34	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 109	[c=5 l=5]  *andsi_1_zext
+	leaq	(%rcx,%rax,8), %r12	# 39	[c=8 l=4]  *leadi
+	movq	(%r12), %rax	# 40	[c=5 l=4]  *movdi_internal/3
+	testq	%rax, %rax	# 41	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L433	# 42	[c=13 l=2]  *jcc
+.L424:
+	andl	$4095, %ebx	# 108	[c=5 l=6]  *andsi_1_zext
+	movb	%dl, (%rax,%rbx)	# 79	[c=4 l=3]  *movqi_internal/8
+	addq	$16, %rsp	# 127	[c=4 l=4]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_remember_state
+	.cfi_def_cfa_offset 32
+	popq	%rbx	# 128	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 24
+	popq	%rbp	# 129	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 16
+	popq	%r12	# 130	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 8
+	ret		# 131	[c=0 l=1]  simple_return_internal
+	.p2align 4,,10
+	.p2align 3
+.L422:
+	.cfi_restore_state
+	addq	$16, %rsp	# 135	[c=4 l=4]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_remember_state
+	.cfi_def_cfa_offset 32
+	leal	-4096(%rsi), %esi	# 120	[c=4 l=6]  *leasi
+	popq	%rbx	# 136	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 24
+	popq	%rbp	# 137	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 16
+	popq	%r12	# 138	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 8
+	jmp	eeprom_write_mapped@PLT	# 30	[c=0 l=5]  *sibcall
+	.p2align 4,,10
+	.p2align 3
+.L421:
+	.cfi_restore_state
+	movl	%ebx, %esi	# 84	[c=4 l=2]  *movsi_internal/0
+	movq	%rbp, %rdi	# 85	[c=4 l=3]  *movdi_internal/3
+	call	bad_address	# 86	[c=0 l=5]  *call
+	.p2align 4,,10
+	.p2align 3
+.L433:
+	movl	$4128, %esi	# 44	[c=4 l=5]  *movdi_internal/2
+	movl	$1, %edi	# 45	[c=4 l=5]  *movdi_internal/2
+	movl	%edx, 12(%rsp)	# 118	[c=4 l=4]  *movsi_internal/1
+	call	calloc@PLT	# 46	[c=10 l=5]  *call_value
+	movl	12(%rsp), %edx	# 119	[c=9 l=4]  *movsi_internal/0
+	testq	%rax, %rax	# 49	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L434	# 50	[c=13 l=2]  *jcc
+	movq	984(%rbp), %rcx	# 64	[c=9 l=7]  *movdi_internal/3
+	movq	%rcx, (%rax)	# 65	[c=4 l=3]  *movdi_internal/5
+	testq	%rcx, %rcx	# 66	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L426	# 67	[c=13 l=2]  *jcc
+	movq	%rax, 8(%rcx)	# 69	[c=4 l=4]  *movdi_internal/5
+.L426:
+	movq	%rax, 984(%rbp)	# 72	[c=4 l=7]  *movdi_internal/5
+	addq	$32, %rax	# 73	[c=4 l=4]  *adddi_1/0
+	movq	%rax, (%r12)	# 74	[c=4 l=4]  *movdi_internal/5
+	jmp	.L424	# 142	[c=1 l=5]  jump
+.L434:
+	leaq	.LC37(%rip), %r9	# 52	[c=1 l=7]  *movdi_internal/4
+	movl	$1, %r8d	# 53	[c=4 l=6]  *movsi_internal/0
+	movq	%rbp, %rdi	# 58	[c=4 l=3]  *movdi_internal/3
+	movl	$4096, %ecx	# 54	[c=4 l=5]  *movsi_internal/0
+	leaq	.LC4(%rip), %rdx	# 55	[c=1 l=7]  *movdi_internal/4
+	movl	$6, %esi	# 57	[c=4 l=5]  *movsi_internal/0
+	call	leave	# 60	[c=0 l=5]  *call
+	.cfi_endproc
+.LFE36:
+	.size	data_write_mapped, .-data_write_mapped
+	.p2align 4
+	.type	pop_byte, @function
+pop_byte:
+.LFB73:
+	.cfi_startproc
+	pushq	%r15	# 237	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	movl	$94, %eax	# 10	[c=4 l=5]  *movsi_internal/0
+	pushq	%r14	# 238	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13	# 239	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12	# 240	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	movl	$93, %r12d	# 7	[c=4 l=6]  *movsi_internal/0
+	pushq	%rbp	# 241	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx	# 242	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	movq	%rdi, %rbx	# 2	[c=4 l=3]  *movdi_internal/3
+	subq	$8, %rsp	# 243	[c=4 l=4]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_def_cfa_offset 64
+	movl	5176(%rdi), %edx	# 6	[c=9 l=6]  *movsi_internal/0
+	movl	5180(%rdi), %r14d	# 9	[c=9 l=7]  *movsi_internal/0
+	subl	%edx, %eax	# 11	[c=4 l=2]  *subsi_1/0
+	subl	%edx, %r12d	# 8	[c=4 l=3]  *subsi_1/0
+	movl	%eax, %r13d	# 223	[c=4 l=3]  *movsi_internal/0
+	cmpl	%r14d, %r12d	# 12	[c=4 l=3]  *cmpsi_1/0
+	jb	.L436	# 13	[c=13 l=6]  *jcc
+	cmpb	$1, 1082(%rdi)	# 17	[c=13 l=7]  *cmpqi_1/0
+	ja	.L459	# 18	[c=13 l=6]  *jcc
+	movq	1040(%rdi), %rdx	# 177	[c=9 l=7]  *movdi_internal/3
+	movzbl	93(%rdx), %r15d	# 178	[c=13 l=5]  *zero_extendqisi2/0
+	cmpl	%r14d, %eax	# 180	[c=4 l=3]  *cmpsi_1/0
+	jb	.L460	# 181	[c=13 l=6]  *jcc
+.L452:
+	cmpb	$1, 1082(%rbx)	# 32	[c=13 l=7]  *cmpqi_1/0
+	ja	.L461	# 33	[c=13 l=6]  *jcc
+.L451:
+	movzbl	94(%rdx), %ebp	# 150	[c=13 l=4]  *zero_extendqisi2/0
+	sall	$8, %ebp	# 151	[c=4 l=3]  *ashlsi3_1/0
+	orl	%r15d, %ebp	# 152	[c=4 l=3]  *iorsi_1/0
+	addl	$1, %ebp	# 153	[c=4 l=3]  *addsi_1/0
+.L443:
+	movb	%bpl, 93(%rdx)	# 75	[c=4 l=4]  *movqi_internal/8
+.L444:
+	movl	%ebp, %edx	# 226	[c=4 l=2]  *movsi_internal/0
+	movl	$94, %eax	# 79	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%rbx), %eax	# 80	[c=13 l=6]  *subsi_1/1
+	sarl	$8, %edx	# 78	[c=4 l=3]  *ashrsi3_1/0
+	cmpl	5180(%rbx), %eax	# 81	[c=13 l=6]  *cmpsi_1/1
+	jb	.L445	# 82	[c=13 l=2]  *jcc
+	cmpb	$1, 1082(%rbx)	# 86	[c=13 l=7]  *cmpqi_1/0
+	ja	.L462	# 87	[c=13 l=2]  *jcc
+.L445:
+	movq	1040(%rbx), %rax	# 98	[c=9 l=7]  *movdi_internal/3
+	movb	%dl, 94(%rax)	# 99	[c=4 l=3]  *movqi_internal/8
+.L446:
+	movl	%ebp, %eax	# 228	[c=4 l=2]  *movsi_internal/0
+	subl	5176(%rbx), %eax	# 102	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %eax	# 103	[c=13 l=6]  *cmpsi_1/1
+	jb	.L447	# 104	[c=13 l=2]  *jcc
+	movl	%ebp, %eax	# 230	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %eax	# 106	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 220	[c=5 l=5]  *andsi_1_zext
+	cmpb	$0, 1080(%rbx,%rax)	# 109	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L463	# 110	[c=13 l=2]  *jcc
+.L447:
+	movq	1040(%rbx), %rax	# 114	[c=9 l=7]  *movdi_internal/3
+	movslq	%ebp, %rbp	# 113	[c=4 l=3]  *extendsidi2_rex64/1
+	movzbl	(%rax,%rbp), %eax	# 115	[c=13 l=4]  *zero_extendqisi2/0
+	addq	$8, %rsp	# 246	[c=4 l=4]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx	# 247	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 48
+	popq	%rbp	# 248	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 40
+	popq	%r12	# 249	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 32
+	popq	%r13	# 250	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 24
+	popq	%r14	# 251	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 16
+	popq	%r15	# 252	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 8
+	ret		# 253	[c=0 l=1]  simple_return_internal
+	.p2align 4,,10
+	.p2align 3
+.L436:
+	.cfi_restore_state
+	movq	1040(%rdi), %rdx	# 158	[c=9 l=7]  *movdi_internal/3
+	movzbl	93(%rdx), %r15d	# 159	[c=13 l=5]  *zero_extendqisi2/0
+	cmpl	%r14d, %eax	# 161	[c=4 l=3]  *cmpsi_1/0
+	jnb	.L452	# 162	[c=13 l=6]  *jcc
+	jmp	.L451	# 278	[c=1 l=5]  jump
+	.p2align 4,,10
+	.p2align 3
+.L462:
+	movzbl	%dl, %edx	# 89	[c=4 l=3]  *zero_extendqisi2/0
+	movl	$94, %esi	# 91	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 92	[c=4 l=3]  *movdi_internal/3
+	call	data_write_mapped	# 93	[c=0 l=5]  *call
+	jmp	.L446	# 280	[c=1 l=5]  jump
+	.p2align 4,,10
+	.p2align 3
+.L463:
+	addq	$8, %rsp	# 257	[c=4 l=4]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	movl	%ebp, %esi	# 120	[c=4 l=2]  *movsi_internal/0
+	movq	%rbx, %rdi	# 121	[c=4 l=3]  *movdi_internal/3
+	popq	%rbx	# 258	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 48
+	popq	%rbp	# 259	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 40
+	popq	%r12	# 260	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 32
+	popq	%r13	# 261	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 24
+	popq	%r14	# 262	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 16
+	popq	%r15	# 263	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 8
+	jmp	data_read_page	# 122	[c=10 l=5]  *sibcall_value
+	.p2align 4,,10
+	.p2align 3
+.L459:
+	.cfi_restore_state
+	movl	$93, %esi	# 20	[c=4 l=5]  *movsi_internal/0
+	call	data_read_mapped	# 22	[c=10 l=5]  *call_value
+	movl	%eax, %r12d	# 23	[c=4 l=3]  *movsi_internal/0
+	cmpl	%r14d, %r13d	# 24	[c=4 l=3]  *cmpsi_1/0
+	jb	.L464	# 25	[c=13 l=6]  *jcc
+	movl	$94, %esi	# 139	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 140	[c=4 l=3]  *movdi_internal/3
+	call	data_read_mapped	# 141	[c=10 l=5]  *call_value
+	sall	$8, %eax	# 143	[c=4 l=3]  *ashlsi3_1/0
+	movl	%eax, %ebp	# 233	[c=4 l=2]  *movsi_internal/0
+	orl	%r12d, %ebp	# 144	[c=4 l=3]  *iorsi_1/0
+	addl	$1, %ebp	# 145	[c=4 l=3]  *addsi_1/0
+.L458:
+	movzbl	%bpl, %edx	# 61	[c=4 l=4]  *zero_extendqisi2/0
+	movl	$93, %esi	# 65	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 66	[c=4 l=3]  *movdi_internal/3
+	call	data_write_mapped	# 67	[c=0 l=5]  *call
+	jmp	.L444	# 283	[c=1 l=5]  jump
+	.p2align 4,,10
+	.p2align 3
+.L460:
+	movzbl	94(%rdx), %ebp	# 168	[c=13 l=4]  *zero_extendqisi2/0
+	sall	$8, %ebp	# 169	[c=4 l=3]  *ashlsi3_1/0
+	orl	%r15d, %ebp	# 170	[c=4 l=3]  *iorsi_1/0
+	addl	$1, %ebp	# 171	[c=4 l=3]  *addsi_1/0
+.L453:
+	cmpb	$1, 1082(%rbx)	# 58	[c=13 l=7]  *cmpqi_1/0
+	ja	.L458	# 59	[c=13 l=2]  *jcc
+	jmp	.L443	# 286	[c=1 l=5]  jump
+	.p2align 4,,10
+	.p2align 3
+.L461:
+	movl	$94, %esi	# 35	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 36	[c=4 l=3]  *movdi_internal/3
+	call	data_read_mapped	# 37	[c=10 l=5]  *call_value
+	sall	$8, %eax	# 39	[c=4 l=3]  *ashlsi3_1/0
+	movl	%eax, %ebp	# 225	[c=4 l=2]  *movsi_internal/0
+	orl	%r15d, %ebp	# 40	[c=4 l=3]  *iorsi_1/0
+	addl	$1, %ebp	# 41	[c=4 l=3]  *addsi_1/0
+	cmpl	%r14d, %r12d	# 42	[c=4 l=3]  *cmpsi_1/0
+	jnb	.L458	# 43	[c=13 l=2]  *jcc
+	movq	1040(%rbx), %rdx	# 72	[c=9 l=7]  *movdi_internal/3
+	jmp	.L443	# 288	[c=1 l=5]  jump
+	.p2align 4,,10
+	.p2align 3
+.L464:
+	movq	1040(%rbx), %rdx	# 50	[c=9 l=7]  *movdi_internal/3
+	movzbl	94(%rdx), %ebp	# 51	[c=13 l=4]  *zero_extendqisi2/0
+	sall	$8, %ebp	# 52	[c=4 l=3]  *ashlsi3_1/0
+	orl	%eax, %ebp	# 53	[c=4 l=2]  *iorsi_1/0
+	addl	$1, %ebp	# 54	[c=4 l=3]  *addsi_1/0
+	jmp	.L453	# 290	[c=1 l=2]  jump
+	.cfi_endproc
+.LFE73:
+	.size	pop_byte, .-pop_byte
+	.p2align 4
+	.type	data_write_page, @function
+data_write_page:
+.LFB46:
+	.cfi_startproc
+	movl	%esi, %eax	# 118	[c=4 l=2]  *movsi_internal/0
+	subl	5176(%rdi), %eax	# 9	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rdi), %eax	# 10	[c=13 l=6]  *cmpsi_1/1
+	jb	.L466	# 11	[c=13 l=2]  *jcc
+	movl	%esi, %eax	# 120	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %eax	# 13	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 116	[c=5 l=5]  *andsi_1_zext
+	cmpb	$1, 1080(%rdi,%rax)	# 16	[c=14 l=8]  *cmpqi_1/0
+	je	.L467	# 17	[c=13 l=2]  *jcc
+.L466:
+	jmp	data_write_mapped	# 23	[c=0 l=5]  *sibcall
+	.p2align 4,,10
+	.p2align 3
+.L467:
+	cmpl	$95, %esi	# 27	[c=4 l=3]  *cmpsi_1/0
+	je	.L483	# 28	[c=13 l=2]  *jcc
+	cmpl	6564(%rdi), %esi	# 53	[c=13 l=6]  *cmpsi_1/1
+	jnb	.L471	# 54	[c=13 l=2]  *jcc
+	movslq	%esi, %rax	# 56	[c=4 l=3]  *extendsidi2_rex64/1
+	cmpb	$0, 6568(%rdi,%rax)	# 57	[c=14 l=8]  *cmpqi_ccno_1/1
+	je	.L471	# 58	[c=13 l=2]  *jcc
+	cmpl	$1, 96(%rdi)	# 69	[c=13 l=4]  *cmpsi_1/0
+	movq	48(%rdi), %rcx	# 68	[c=9 l=4]  *movdi_internal/3
+	je	.L484	# 70	[c=13 l=2]  *jcc
+.L475:
+	jmp	periph_write@PLT	# 84	[c=0 l=5]  *sibcall
+	.p2align 4,,10
+	.p2align 3
+.L483:
+	movzbl	100(%rdi), %eax	# 30	[c=9 l=4]  *movqi_internal/4
+	testb	%al, %al	# 31	[c=4 l=2]  *cmpqi_ccno_1/0
+	je	.L469	# 32	[c=13 l=2]  *jcc
+	movq	1040(%rdi), %r8	# 34	[c=9 l=7]  *movdi_internal/3
+	movzbl	%al, %esi	# 36	[c=4 l=3]  *zero_extendqisi2/0
+	notl	%esi	# 37	[c=4 l=2]  *one_cmplsi2_1/0
+	movzbl	95(%r8), %ecx	# 35	[c=13 l=5]  *zero_extendqisi2/0
+	andl	%esi, %ecx	# 38	[c=4 l=2]  *andsi_1/0
+	movq	104(%rdi), %rsi	# 39	[c=9 l=4]  *movdi_internal/3
+	andb	(%rsi), %al	# 40	[c=9 l=2]  *andqi_1/1
+	movzbl	%al, %eax	# 41	[c=4 l=3]  *zero_extendqisi2/0
+	orl	%ecx, %eax	# 42	[c=4 l=2]  *iorsi_1/0
+	movb	%al, 95(%r8)	# 43	[c=4 l=4]  *movqi_internal/8
+	movb	$0, 100(%rdi)	# 44	[c=4 l=4]  *movqi_internal/8
+.L469:
+	movq	1040(%rdi), %rax	# 47	[c=9 l=7]  *movdi_internal/3
+	movb	%dl, 95(%rax)	# 48	[c=4 l=3]  *movqi_internal/8
+	ret		# 110	[c=0 l=1]  simple_return_internal
+	.p2align 4,,10
+	.p2align 3
+.L471:
+	cmpl	%esi, 1000(%rdi)	# 61	[c=13 l=6]  *cmpsi_1/0
+	jb	.L485	# 62	[c=13 l=2]  *jcc
+	movq	1040(%rdi), %rax	# 95	[c=9 l=7]  *movdi_internal/3
+	movslq	%esi, %rsi	# 94	[c=4 l=3]  *extendsidi2_rex64/1
+	movb	%dl, (%rax,%rsi)	# 96	[c=4 l=3]  *movqi_internal/8
+	ret		# 129	[c=0 l=1]  simple_return_internal
+.L484:
+	movl	(%rdi), %eax	# 72	[c=6 l=2]  *zero_extendsidi2/3
+	salq	$4, %rax	# 74	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rdi), %rax	# 75	[c=13 l=7]  *adddi_1/1
+	movzwl	14(%rax), %eax	# 76	[c=13 l=4]  zero_extendhidi2/0
+	subq	%rax, %rcx	# 77	[c=4 l=3]  *subdi_1/0
+	jmp	.L475	# 146	[c=1 l=2]  jump
+.L485:
+	pushq	%rax	# 142	[c=4 l=1]  *pushdi2_prologue
+	.cfi_def_cfa_offset 16
+	call	bad_address	# 90	[c=0 l=5]  *call
+	.cfi_endproc
+.LFE46:
+	.size	data_write_page, .-data_write_page
+	.p2align 4
+	.type	spm_operation, @function
+spm_operation:
+.LFB87:
+	.cfi_startproc
+	pushq	%rbp	# 129	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	pushq	%rbx	# 130	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	movq	%rdi, %rbx	# 2	[c=4 l=3]  *movdi_internal/3
+	subq	$8, %rsp	# 131	[c=4 l=4]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_def_cfa_offset 32
+	movl	6048(%rdi), %esi	# 7	[c=9 l=6]  *movsi_internal/0
+	movl	5180(%rdi), %eax	# 9	[c=9 l=6]  *movsi_internal/0
+	movl	%esi, %edx	# 117	[c=4 l=2]  *movsi_internal/0
+	subl	5176(%rdi), %edx	# 8	[c=13 l=6]  *subsi_1/1
+	cmpl	%eax, %edx	# 10	[c=4 l=2]  *cmpsi_1/0
+	jb	.L499	# 11	[c=13 l=6]  *jcc
+	movl	%esi, %ecx	# 121	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %ecx	# 21	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %ecx	# 114	[c=5 l=6]  *andsi_1_zext
+	cmpb	$0, 1080(%rdi,%rcx)	# 24	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L489	# 25	[c=13 l=2]  *jcc
+	movq	1040(%rdi), %rdi	# 28	[c=9 l=7]  *movdi_internal/3
+	movslq	%esi, %rcx	# 27	[c=4 l=3]  *extendsidi2_rex64/1
+	movzbl	(%rdi,%rcx), %ebp	# 29	[c=13 l=4]  *zero_extendqisi2/0
+.L490:
+	movl	%ebp, %r8d	# 125	[c=4 l=3]  *movsi_internal/0
+	andl	$-64, %r8d	# 43	[c=4 l=4]  *andsi_1/0
+	cmpl	%eax, %edx	# 44	[c=4 l=2]  *cmpsi_1/0
+	jb	.L498	# 45	[c=13 l=2]  *jcc
+	movl	%esi, %eax	# 127	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %eax	# 47	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 113	[c=5 l=5]  *andsi_1_zext
+	cmpb	$0, 1080(%rbx,%rax)	# 50	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L491	# 51	[c=13 l=2]  *jcc
+.L498:
+	movq	1040(%rbx), %rdi	# 94	[c=9 l=7]  *movdi_internal/3
+	movslq	%esi, %rcx	# 93	[c=4 l=3]  *extendsidi2_rex64/1
+.L488:
+	movb	%r8b, (%rdi,%rcx)	# 56	[c=4 l=4]  *movqi_internal/8
+.L492:
+	andl	$63, %ebp	# 67	[c=4 l=3]  *andsi_1/0
+	xorl	%eax, %eax	# 145	[c=4 l=2]  *movdi_xor
+	subl	$1, %ebp	# 68	[c=5 l=3]  addsi_1_zext/0
+	cmpl	$4, %ebp	# 71	[c=4 l=3]  *cmpsi_1/0
+	ja	.L486	# 72	[c=13 l=2]  *jcc
+	leaq	CSWTCH.175(%rip), %rax	# 115	[c=1 l=7]  *movdi_internal/4
+	movl	(%rax,%rbp,4), %eax	# 76	[c=10 l=3]  *movsi_internal/0
+.L486:
+	addq	$8, %rsp	# 134	[c=4 l=4]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx	# 135	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 16
+	popq	%rbp	# 136	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 8
+	ret		# 137	[c=0 l=1]  simple_return_internal
+	.p2align 4,,10
+	.p2align 3
+.L489:
+	.cfi_restore_state
+	call	data_read_page	# 36	[c=10 l=5]  *call_value
+	movl	6048(%rbx), %esi	# 38	[c=9 l=6]  *movsi_internal/0
+	movl	%eax, %ebp	# 37	[c=4 l=2]  *movsi_internal/0
+	movl	5180(%rbx), %eax	# 40	[c=9 l=6]  *movsi_internal/0
+	movl	%esi, %edx	# 123	[c=4 l=2]  *movsi_internal/0
+	subl	5176(%rbx), %edx	# 39	[c=13 l=6]  *subsi_1/1
+	jmp	.L490	# 147	[c=1 l=2]  jump
+	.p2align 4,,10
+	.p2align 3
+.L499:
+	movq	1040(%rdi), %rdi	# 14	[c=9 l=7]  *movdi_internal/3
+	movslq	%esi, %rcx	# 13	[c=4 l=3]  *extendsidi2_rex64/1
+	movzbl	(%rdi,%rcx), %ebp	# 15	[c=13 l=4]  *zero_extendqisi2/0
+	movl	%ebp, %r8d	# 119	[c=4 l=3]  *movsi_internal/0
+	andl	$-64, %r8d	# 16	[c=4 l=4]  *andsi_1/0
+	jmp	.L488	# 149	[c=1 l=2]  jump
+	.p2align 4,,10
+	.p2align 3
+.L491:
+	movl	%r8d, %edx	# 61	[c=4 l=3]  *movsi_internal/0
+	movq	%rbx, %rdi	# 63	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 64	[c=0 l=5]  *call
+	jmp	.L492	# 151	[c=1 l=2]  jump
+	.cfi_endproc
+.LFE87:
+	.size	spm_operation, .-spm_operation
+	.p2align 4
+	.type	do_events, @function
+do_events:
+.LFB215:
+	.cfi_startproc
+	pushq	%r15	# 436	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14	# 437	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13	# 438	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12	# 439	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp	# 440	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx	# 441	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	movq	%rdi, %rbx	# 2	[c=4 l=3]  *movdi_internal/3
+	subq	$8, %rsp	# 442	[c=4 l=4]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_def_cfa_offset 64
+	cmpb	$0, 6040(%rdi)	# 6	[c=13 l=7]  *cmpqi_ccno_1/1
+	jne	.L540	# 7	[c=13 l=6]  *jcc
+.L502:
+	movq	%rbx, %rdi	# 36	[c=4 l=3]  *movdi_internal/3
+	call	events_run@PLT	# 37	[c=0 l=5]  *call
+	movq	1040(%rbx), %rax	# 39	[c=9 l=7]  *movdi_internal/3
+	movzbl	100(%rbx), %ecx	# 38	[c=13 l=4]  *zero_extendqisi2/0
+	movzbl	95(%rax), %eax	# 40	[c=13 l=4]  *zero_extendqisi2/0
+	movl	%ecx, %edx	# 435	[c=4 l=2]  *movsi_internal/0
+	notl	%ecx	# 42	[c=4 l=2]  *one_cmplsi2_1/0
+	andl	%ecx, %eax	# 43	[c=4 l=2]  *andsi_1/0
+	movq	104(%rbx), %rcx	# 44	[c=9 l=4]  *movdi_internal/3
+	andb	(%rcx), %dl	# 45	[c=9 l=2]  *andqi_1/1
+	orl	%edx, %eax	# 47	[c=4 l=2]  *iorsi_1/0
+	testb	$-128, %al	# 433	[c=4 l=2]  *testqi_1_maybe_si/1
+	je	.L504	# 50	[c=13 l=6]  *jcc
+	movq	6024(%rbx), %rax	# 52	[c=9 l=7]  *movdi_internal/3
+	cmpq	%rax, 48(%rbx)	# 53	[c=13 l=4]  *cmpdi_1/0
+	je	.L505	# 54	[c=13 l=6]  *jcc
+	movq	%rbx, %rdi	# 56	[c=4 l=3]  *movdi_internal/3
+	call	irq_take@PLT	# 57	[c=10 l=5]  *call_value
+	movl	%eax, %r13d	# 58	[c=4 l=3]  *movsi_internal/0
+	testl	%eax, %eax	# 61	[c=4 l=2]  *cmpsi_ccno_1/0
+	js	.L504	# 62	[c=13 l=6]  *jcc
+	movl	%eax, %esi	# 69	[c=4 l=2]  *movsi_internal/0
+	movq	%rbx, %rdi	# 70	[c=4 l=3]  *movdi_internal/3
+	call	periph_irq_taken@PLT	# 71	[c=0 l=5]  *call
+	movl	5176(%rbx), %r12d	# 72	[c=9 l=7]  *movsi_internal/0
+	movl	$93, %eax	# 74	[c=4 l=5]  *movsi_internal/0
+	movl	5180(%rbx), %r15d	# 73	[c=9 l=7]  *movsi_internal/0
+	subl	%r12d, %eax	# 75	[c=4 l=3]  *subsi_1/0
+	cmpl	%r15d, %eax	# 76	[c=4 l=3]  *cmpsi_1/0
+	jb	.L507	# 77	[c=13 l=6]  *jcc
+	cmpb	$1, 1082(%rbx)	# 81	[c=13 l=7]  *cmpqi_1/0
+	ja	.L541	# 82	[c=13 l=6]  *jcc
+	movq	1040(%rbx), %rax	# 341	[c=9 l=7]  *movdi_internal/3
+	movzbl	93(%rax), %r14d	# 342	[c=13 l=5]  *zero_extendqisi2/0
+.L511:
+	movzbl	94(%rax), %ebp	# 121	[c=13 l=4]  *zero_extendqisi2/0
+.L512:
+	movl	996(%rbx), %edx	# 127	[c=9 l=6]  *movsi_internal/0
+	movzbl	840(%rbx), %eax	# 129	[c=13 l=7]  *zero_extendqisi2/0
+	sall	$8, %ebp	# 124	[c=4 l=3]  *ashlsi3_1/0
+	orl	%r14d, %ebp	# 125	[c=4 l=3]  *iorsi_1/0
+	leal	1(%rdx,%rax), %eax	# 130	[c=5 l=4]  *leasi
+	cmpl	%eax, %ebp	# 131	[c=4 l=2]  *cmpsi_1/0
+	jb	.L542	# 132	[c=13 l=6]  *jcc
+	movl	%ebp, %eax	# 406	[c=4 l=2]  *movsi_internal/0
+	movl	(%rbx), %edx	# 140	[c=5 l=2]  *movsi_internal/0
+	leal	-1(%rbp), %r14d	# 432	[c=4 l=4]  *leasi
+	subl	%r12d, %eax	# 142	[c=4 l=3]  *subsi_1/0
+	cmpl	%r15d, %eax	# 143	[c=4 l=3]  *cmpsi_1/0
+	jb	.L514	# 144	[c=13 l=2]  *jcc
+	movl	%ebp, %eax	# 408	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %eax	# 146	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 400	[c=5 l=5]  *andsi_1_zext
+	cmpb	$0, 1080(%rbx,%rax)	# 149	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L515	# 150	[c=13 l=6]  *jcc
+.L514:
+	movq	1040(%rbx), %rcx	# 154	[c=9 l=7]  *movdi_internal/3
+	movslq	%ebp, %rax	# 153	[c=4 l=3]  *extendsidi2_rex64/1
+	movb	%dl, (%rcx,%rax)	# 155	[c=4 l=3]  *movqi_internal/8
+.L516:
+	movl	(%rbx), %edx	# 410	[c=5 l=2]  *movsi_internal/0
+	movl	%r14d, %eax	# 412	[c=4 l=3]  *movsi_internal/0
+	leal	-2(%rbp), %r12d	# 431	[c=4 l=4]  *leasi
+	subl	5176(%rbx), %eax	# 169	[c=13 l=6]  *subsi_1/1
+	shrl	$8, %edx	# 167	[c=4 l=3]  *lshrsi3_1/0
+	cmpl	5180(%rbx), %eax	# 170	[c=13 l=6]  *cmpsi_1/1
+	jb	.L517	# 171	[c=13 l=2]  *jcc
+	movl	%r14d, %eax	# 414	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %eax	# 173	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 399	[c=5 l=5]  *andsi_1_zext
+	cmpb	$0, 1080(%rbx,%rax)	# 176	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L518	# 177	[c=13 l=6]  *jcc
+.L517:
+	movq	1040(%rbx), %rax	# 181	[c=9 l=7]  *movdi_internal/3
+	movslq	%r14d, %r14	# 180	[c=4 l=3]  *extendsidi2_rex64/1
+	movb	%dl, (%rax,%r14)	# 182	[c=4 l=4]  *movqi_internal/8
+.L519:
+	cmpb	$0, 840(%rbx)	# 193	[c=13 l=7]  *cmpqi_ccno_1/1
+	je	.L520	# 194	[c=13 l=2]  *jcc
+	movl	(%rbx), %edx	# 416	[c=5 l=2]  *movsi_internal/0
+	movl	%r12d, %eax	# 418	[c=4 l=3]  *movsi_internal/0
+	subl	5176(%rbx), %eax	# 198	[c=13 l=6]  *subsi_1/1
+	shrl	$16, %edx	# 197	[c=4 l=3]  *lshrsi3_1/0
+	cmpl	5180(%rbx), %eax	# 199	[c=13 l=6]  *cmpsi_1/1
+	jb	.L521	# 200	[c=13 l=2]  *jcc
+	movl	%r12d, %eax	# 420	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %eax	# 202	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 398	[c=5 l=5]  *andsi_1_zext
+	cmpb	$0, 1080(%rbx,%rax)	# 205	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L522	# 206	[c=13 l=6]  *jcc
+.L521:
+	movq	1040(%rbx), %rax	# 210	[c=9 l=7]  *movdi_internal/3
+	movslq	%r12d, %r12	# 209	[c=4 l=3]  *extendsidi2_rex64/1
+	movb	%dl, (%rax,%r12)	# 211	[c=4 l=4]  *movqi_internal/8
+.L523:
+	leal	-3(%rbp), %r12d	# 430	[c=4 l=4]  *leasi
+	.p2align 4,,10
+	.p2align 3
+.L520:
+	movl	$93, %eax	# 225	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%rbx), %eax	# 226	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %eax	# 227	[c=13 l=6]  *cmpsi_1/1
+	jb	.L524	# 228	[c=13 l=2]  *jcc
+	cmpb	$1, 1082(%rbx)	# 232	[c=13 l=7]  *cmpqi_1/0
+	ja	.L543	# 233	[c=13 l=6]  *jcc
+.L524:
+	movq	1040(%rbx), %rax	# 244	[c=9 l=7]  *movdi_internal/3
+	movb	%r12b, 93(%rax)	# 245	[c=4 l=4]  *movqi_internal/8
+.L525:
+	movl	$94, %eax	# 249	[c=4 l=5]  *movsi_internal/0
+	sarl	$8, %r12d	# 248	[c=4 l=4]  *ashrsi3_1/0
+	subl	5176(%rbx), %eax	# 250	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %eax	# 251	[c=13 l=6]  *cmpsi_1/1
+	jb	.L526	# 252	[c=13 l=2]  *jcc
+	cmpb	$1, 1082(%rbx)	# 256	[c=13 l=7]  *cmpqi_1/0
+	ja	.L544	# 257	[c=13 l=6]  *jcc
+.L526:
+	movq	1040(%rbx), %rax	# 268	[c=9 l=7]  *movdi_internal/3
+	movb	%r12b, 94(%rax)	# 269	[c=4 l=4]  *movqi_internal/8
+.L527:
+	movq	104(%rbx), %rdx	# 274	[c=9 l=4]  *movdi_internal/3
+	movzbl	100(%rbx), %eax	# 272	[c=13 l=4]  *zero_extendqisi2/0
+	movzbl	(%rdx), %esi	# 467	[c=5 l=3]  *movqi_internal/4
+	andb	$127, %al	# 425	[c=4 l=2]  *andqi_1_slp/0
+	leaq	101(%rbx), %rdx	# 429	[c=4 l=4]  *leadi
+	movq	%rdx, 104(%rbx)	# 280	[c=4 l=4]  *movdi_internal/5
+	andl	%eax, %esi	# 499	[c=4 l=2]  *andsi_1/0
+	orl	$-128, %eax	# 428	[c=4 l=3]  *iorsi_1/0
+	cmpl	$8192, 880(%rbx)	# 283	[c=13 l=10]  *cmpsi_1/0
+	movb	%sil, 101(%rbx)	# 276	[c=4 l=4]  *movqi_internal/8
+	movb	%al, 100(%rbx)	# 278	[c=4 l=3]  *movqi_internal/8
+	jbe	.L528	# 284	[c=13 l=2]  *jcc
+	addl	%r13d, %r13d	# 286	[c=4 l=3]  *ashlsi3_1/0
+.L528:
+	movq	48(%rbx), %rdx	# 293	[c=9 l=4]  *movdi_internal/3
+	movzbl	840(%rbx), %ecx	# 291	[c=13 l=7]  zero_extendqidi2/0
+	movl	%r13d, (%rbx)	# 289	[c=4 l=3]  *movsi_internal/1
+	leaq	4(%rcx,%rdx), %rdx	# 294	[c=5 l=5]  *leadi
+	movq	%rdx, 48(%rbx)	# 295	[c=4 l=4]  *movdi_internal/5
+	cmpq	6032(%rbx), %rdx	# 296	[c=13 l=7]  *cmpdi_1/1
+	jb	.L500	# 297	[c=13 l=2]  *jcc
+.L529:
+	movq	1040(%rbx), %rdi	# 318	[c=9 l=7]  *movdi_internal/3
+	movzbl	%al, %ecx	# 320	[c=4 l=3]  *zero_extendqisi2/0
+	andl	%esi, %eax	# 424	[c=4 l=2]  *andsi_1/0
+	notl	%ecx	# 321	[c=4 l=2]  *one_cmplsi2_1/0
+	movzbl	%al, %eax	# 324	[c=4 l=3]  *zero_extendqisi2/0
+	movzbl	95(%rdi), %edx	# 319	[c=13 l=4]  *zero_extendqisi2/0
+	andl	%ecx, %edx	# 322	[c=4 l=2]  *andsi_1/0
+	orl	%edx, %eax	# 325	[c=4 l=2]  *iorsi_1/0
+	movb	%al, 95(%rdi)	# 326	[c=4 l=3]  *movqi_internal/8
+	movb	$0, 100(%rbx)	# 327	[c=4 l=4]  *movqi_internal/8
+	jmp	.L532	# 476	[c=1 l=2]  jump
+	.p2align 4,,10
+	.p2align 3
+.L504:
+	movq	48(%rbx), %rax	# 303	[c=9 l=4]  *movdi_internal/3
+.L505:
+	cmpq	6032(%rbx), %rax	# 307	[c=13 l=7]  *cmpdi_1/1
+	jb	.L500	# 308	[c=13 l=2]  *jcc
+	movzbl	100(%rbx), %eax	# 310	[c=9 l=4]  *movqi_internal/4
+	testb	%al, %al	# 311	[c=4 l=2]  *cmpqi_ccno_1/0
+	jne	.L545	# 312	[c=13 l=6]  *jcc
+.L532:
+	movq	%rbx, %rdi	# 330	[c=4 l=3]  *movdi_internal/3
+	call	checkpoint_begin@PLT	# 331	[c=0 l=5]  *call
+	addq	$8, %rsp	# 456	[c=4 l=4]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	movq	%rbx, %rdi	# 332	[c=4 l=3]  *movdi_internal/3
+	popq	%rbx	# 457	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 48
+	popq	%rbp	# 458	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 40
+	popq	%r12	# 459	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 32
+	popq	%r13	# 460	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 24
+	popq	%r14	# 461	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 16
+	popq	%r15	# 462	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 8
+	jmp	checkpoint_end@PLT	# 333	[c=0 l=5]  *sibcall
+	.p2align 4,,10
+	.p2align 3
+.L500:
+	.cfi_restore_state
+	addq	$8, %rsp	# 445	[c=4 l=4]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx	# 446	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 48
+	popq	%rbp	# 447	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 40
+	popq	%r12	# 448	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 32
+	popq	%r13	# 449	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 24
+	popq	%r14	# 450	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 16
+	popq	%r15	# 451	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 8
+	ret		# 452	[c=0 l=1]  simple_return_internal
+	.p2align 4,,10
+	.p2align 3
+.L540:
+	.cfi_restore_state
+	call	fork_server_poll@PLT	# 14	[c=10 l=5]  *call_value
+	testb	%al, %al	# 17	[c=4 l=2]  *cmpqi_ccno_1/0
+	je	.L502	# 18	[c=13 l=6]  *jcc
+	movq	1040(%rbx), %rax	# 20	[c=9 l=7]  *movdi_internal/3
+	movl	820(%rbx), %edx	# 21	[c=9 l=6]  *movsi_internal/0
+	movb	%dl, 22(%rax)	# 22	[c=4 l=3]  *movqi_internal/8
+	movq	1040(%rbx), %rax	# 23	[c=9 l=7]  *movdi_internal/3
+	movl	820(%rbx), %edx	# 24	[c=9 l=6]  *movsi_internal/0
+	movb	%dh, 23(%rax)	# 469	[c=4 l=3]  *extzvqi_mem_rex64
+	movq	1040(%rbx), %rax	# 27	[c=9 l=7]  *movdi_internal/3
+	movl	816(%rbx), %edx	# 28	[c=9 l=6]  *movsi_internal/0
+	movb	%dl, 24(%rax)	# 29	[c=4 l=3]  *movqi_internal/8
+	movq	1040(%rbx), %rax	# 30	[c=9 l=7]  *movdi_internal/3
+	movl	816(%rbx), %edx	# 31	[c=9 l=6]  *movsi_internal/0
+	movb	%dh, 25(%rax)	# 470	[c=4 l=3]  *extzvqi_mem_rex64
+	jmp	.L502	# 479	[c=1 l=5]  jump
+	.p2align 4,,10
+	.p2align 3
+.L507:
+	movq	1040(%rbx), %rax	# 97	[c=9 l=7]  *movdi_internal/3
+	movl	$94, %edx	# 99	[c=4 l=5]  *movsi_internal/0
+	subl	%r12d, %edx	# 100	[c=4 l=3]  *subsi_1/0
+	movzbl	93(%rax), %r14d	# 98	[c=13 l=5]  *zero_extendqisi2/0
+	cmpl	%r15d, %edx	# 101	[c=4 l=3]  *cmpsi_1/0
+	jb	.L511	# 102	[c=13 l=6]  *jcc
+	cmpb	$1, 1082(%rbx)	# 106	[c=13 l=7]  *cmpqi_1/0
+	jbe	.L511	# 107	[c=13 l=6]  *jcc
+.L510:
+	movl	$94, %esi	# 110	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 111	[c=4 l=3]  *movdi_internal/3
+	call	data_read_mapped	# 112	[c=10 l=5]  *call_value
+	movl	%eax, %ebp	# 113	[c=4 l=2]  *movsi_internal/0
+	jmp	.L512	# 481	[c=1 l=5]  jump
+	.p2align 4,,10
+	.p2align 3
+.L545:
+	movq	104(%rbx), %rdx	# 314	[c=9 l=4]  *movdi_internal/3
+	movzbl	(%rdx), %esi	# 315	[c=5 l=3]  *movqi_internal/4
+	jmp	.L529	# 483	[c=1 l=5]  jump
+	.p2align 4,,10
+	.p2align 3
+.L544:
+	movzbl	%r12b, %edx	# 259	[c=4 l=4]  *zero_extendqisi2/0
+	movl	$94, %esi	# 261	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 262	[c=4 l=3]  *movdi_internal/3
+	call	data_write_mapped	# 263	[c=0 l=5]  *call
+	jmp	.L527	# 485	[c=1 l=5]  jump
+	.p2align 4,,10
+	.p2align 3
+.L543:
+	movzbl	%r12b, %edx	# 235	[c=4 l=4]  *zero_extendqisi2/0
+	movl	$93, %esi	# 237	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 238	[c=4 l=3]  *movdi_internal/3
+	call	data_write_mapped	# 239	[c=0 l=5]  *call
+	jmp	.L525	# 487	[c=1 l=5]  jump
+	.p2align 4,,10
+	.p2align 3
+.L515:
+	movl	%ebp, %esi	# 161	[c=4 l=2]  *movsi_internal/0
+	movq	%rbx, %rdi	# 162	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 163	[c=0 l=5]  *call
+	jmp	.L516	# 489	[c=1 l=5]  jump
+	.p2align 4,,10
+	.p2align 3
+.L518:
+	movl	%r14d, %esi	# 188	[c=4 l=3]  *movsi_internal/0
+	movq	%rbx, %rdi	# 189	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 190	[c=0 l=5]  *call
+	jmp	.L519	# 491	[c=1 l=5]  jump
+	.p2align 4,,10
+	.p2align 3
+.L541:
+	movl	$93, %esi	# 84	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 85	[c=4 l=3]  *movdi_internal/3
+	call	data_read_mapped	# 86	[c=10 l=5]  *call_value
+	movl	%eax, %r14d	# 87	[c=4 l=3]  *movsi_internal/0
+	movl	$94, %eax	# 88	[c=4 l=5]  *movsi_internal/0
+	subl	%r12d, %eax	# 89	[c=4 l=3]  *subsi_1/0
+	cmpl	%r15d, %eax	# 90	[c=4 l=3]  *cmpsi_1/0
+	jnb	.L510	# 91	[c=13 l=6]  *jcc
+	movq	1040(%rbx), %rax	# 118	[c=9 l=7]  *movdi_internal/3
+	jmp	.L511	# 493	[c=1 l=5]  jump
+	.p2align 4,,10
+	.p2align 3
+.L522:
+	movl	%r12d, %esi	# 217	[c=4 l=3]  *movsi_internal/0
+	movq	%rbx, %rdi	# 218	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 219	[c=0 l=5]  *call
+	jmp	.L523	# 495	[c=1 l=5]  jump
+.L542:
+	movl	%ebp, %esi	# 134	[c=4 l=2]  *movsi_internal/0
+	movq	%rbx, %rdi	# 135	[c=4 l=3]  *movdi_internal/3
+	call	stack_overflow	# 136	[c=0 l=5]  *call
+	.cfi_endproc
+.LFE215:
+	.size	do_events, .-do_events
+	.section	.rodata.str1.1
+.LC38:
+	.string	"SREG"
+.LC39:
+	.string	"registers"
+.LC40:
+	.string	"RAM"
+.LC41:
+	.string	"costs"
+	.section	.rodata.str1.8
+	.align 8
+.LC42:
+	.string	"avrtest: -jit is not available on this host\n"
+	.section	.rodata.str1.1
+.LC43:
+	.string	"illegal opcode 0x%04x"
+.LC44:
+	.string	"opcode 0x%04x illegal on %s"
+	.section	.rodata.str1.8
+	.align 8
+.LC45:
+	.string	"opcode 0x%04x not yet supported"
+	.section	.rodata.str1.1
+.LC46:
+	.string	"in func_ILLEGAL"
+	.section	.rodata.str1.8
+	.align 8
+.LC47:
+	.string	"opcode 0x%04x has undefined result (%s overlaps R%d)"
+	.section	.rodata.str1.1
+.LC48:
+	.string	"bad IRQ vector %d"
+.LC49:
+	.string	"exit %d function called"
+.LC50:
+	.string	"abort function called"
+	.section	.rodata.str1.8
+	.align 8
+.LC51:
+	.string	"instruction count limit reached"
+	.align 8
+.LC52:
+	.string	"infinite loop detected (normal exit)"
+	.align 8
+.LC53:
+	.string	"deadlock: sleeping with no wake source"
+	.section	.rodata.str1.1
+.LC54:
+	.string	"-hle"
+	.section	.rodata.str1.8
+	.align 8
+.LC55:
+	.string	"\navrtest: -hle-verify: %s at %06x: %s differ from the emulation, not emulating %s\n"
+	.text
+	.p2align 4
+	.type	execute, @function
+execute:
+.LFB221:
+	.cfi_startproc
+	pushq	%r15	# 15532	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14	# 15533	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13	# 15534	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12	# 15535	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp	# 15536	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx	# 15537	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	movq	%rdi, %rbx	# 2	[c=4 l=3]  *movdi_internal/3
+	subq	$168, %rsp	# 15538	[c=4 l=7]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_def_cfa_offset 224
+	cmpb	$0, 112(%rdi)	# 79	[c=13 l=4]  *cmpqi_ccno_1/1
+	jne	.L548	# 80	[c=13 l=2]  *jcc
+	cmpl	$0, 568(%rdi)	# 82	[c=13 l=7]  *cmpsi_ccno_1/1
+	jne	.L1548	# 83	[c=13 l=6]  *jcc
+.L550:
+	movl	992(%rbx), %eax	# 12840	[c=9 l=6]  *movsi_internal/0
+	cmpl	$0, 536(%rbx)	# 105	[c=13 l=7]  *cmpsi_ccno_1/1
+	leal	1(%rax), %ebp	# 15072	[c=4 l=3]  *leasi
+	je	.L552	# 106	[c=13 l=2]  *jcc
+	cmpq	$0, 10984(%rbx)	# 108	[c=13 l=8]  *cmpdi_ccno_1/1
+	je	.L1549	# 109	[c=13 l=6]  *jcc
+.L552:
+	xorl	%esi, %esi	# 16945	[c=4 l=2]  *movsi_xor
+	movb	$1, 112(%rbx)	# 121	[c=4 l=4]  *movqi_internal/8
+	movl	%esi, 116(%rbx)	# 16946	[c=4 l=3]  *movsi_internal/1
+	movl	%ebp, 120(%rbx)	# 123	[c=4 l=3]  *movsi_internal/1
+.L548:
+	leaq	flag_update_table_add8(%rip), %r10	# 11453	[c=1 l=7]  *movdi_internal/4
+	leaq	101(%rbx), %r12	# 11456	[c=4 l=4]  *leadi
+	leaq	flag_update_table_sub8(%rip), %r11	# 11457	[c=1 l=7]  *movdi_internal/4
+.L553:
+	movl	120(%rbx), %edx	# 131	[c=9 l=3]  *movsi_internal/0
+	testl	%edx, %edx	# 132	[c=4 l=2]  *cmpsi_ccno_1/0
+	jne	.L1550	# 133	[c=13 l=6]  *jcc
+.L554:
+	movl	(%rbx), %r15d	# 307	[c=6 l=3]  *zero_extendsidi2/3
+	movl	$1, 96(%rbx)	# 312	[c=4 l=7]  *movsi_internal/1
+	movq	%r10, %rcx	# 15826	[c=4 l=3]  *movdi_internal/3
+	movq	32(%rbx), %rdi	# 305	[c=9 l=4]  *movdi_internal/3
+	movq	%r15, %rdx	# 15307	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 309	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 311	[c=13 l=7]  *adddi_1/1
+	movzbl	11(%r15), %ebp	# 313	[c=13 l=5]  zero_extendqidi2/0
+	addq	40(%rbx), %rbp	# 314	[c=13 l=4]  *adddi_1/1
+	movq	%rdi, (%rsp)	# 13858	[c=4 l=4]  *movdi_internal/5
+	movzwl	14(%r15), %eax	# 316	[c=13 l=5]  zero_extendhidi2/0
+	movq	(%r15), %r14	# 321	[c=5 l=3]  *movdi_internal/3
+	movq	%rbp, 40(%rbx)	# 315	[c=4 l=4]  *movdi_internal/5
+	addq	%rax, 48(%rbx)	# 317	[c=13 l=4]  *adddi_1/0
+	movzbl	9(%r15), %eax	# 318	[c=13 l=5]  *zero_extendqisi2/0
+	addl	%edx, %eax	# 319	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 15827	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 320	[c=4 l=2]  *movsi_internal/1
+	leaq	-1(%rdi), %rax	# 15067	[c=4 l=4]  *leadi
+	movq	%rax, 8(%rsp)	# 12845	[c=4 l=5]  *movdi_internal/5
+	movq	%r11, %rax	# 15828	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 15829	[c=4 l=3]  *indirect_jump
+.L1125:
+	movzbl	10(%r15), %esi	# 8492	[c=13 l=5]  zero_extendqidi2/0
+	addq	1040(%rbx), %rsi	# 8494	[c=13 l=7]  *adddi_1/1
+	movzwl	12(%r15), %edi	# 8491	[c=13 l=5]  *zero_extendhisi2/0
+	movzbl	(%rsi), %eax	# 8495	[c=9 l=3]  *zero_extendqisi2/0
+	movl	%edi, %edx	# 15478	[c=4 l=2]  *movsi_internal/0
+	movl	%eax, %ecx	# 15477	[c=4 l=2]  *movsi_internal/0
+	subl	%edi, %eax	# 8498	[c=4 l=2]  *subsi_1/0
+	andl	$136, %ecx	# 8501	[c=4 l=6]  *andsi_1/0
+	andl	$136, %edx	# 8504	[c=4 l=6]  *andsi_1/0
+	movb	%al, (%rsi)	# 8499	[c=4 l=2]  *movqi_internal/8
+	andl	$511, %eax	# 8508	[c=4 l=5]  *andsi_1/0
+	leal	(%rdx,%rcx,2), %edx	# 8505	[c=8 l=3]  *leasi
+	imull	$260, %edx, %edx	# 8506	[c=12 l=6]  *mulsi3_1/1
+	andl	$7680, %edx	# 8507	[c=4 l=6]  *andsi_1/0
+.L1428:
+	movzbl	100(%rbx), %ecx	# 8510	[c=9 l=4]  *movqi_internal/4
+	orl	%eax, %edx	# 8509	[c=5 l=2]  *iorsi_1_zext
+	movl	%ecx, %eax	# 13608	[c=4 l=2]  *movsi_internal/0
+	andl	$192, %eax	# 8513	[c=4 l=5]  *andsi_2/0
+	jne	.L1126	# 8514	[c=13 l=6]  *jcc
+	leaq	flag_update_table_sub8(%rip), %rax	# 8517	[c=1 l=7]  *movdi_internal/4
+	movl	$63, %ecx	# 51	[c=4 l=5]  *movqi_internal/3
+	addq	%rdx, %rax	# 8518	[c=4 l=3]  *adddi_1/0
+.L1127:
+	movq	%rax, 104(%rbx)	# 8535	[c=4 l=4]  *movdi_internal/5
+	movb	%cl, 100(%rbx)	# 8536	[c=4 l=3]  *movqi_internal/8
+.L1395:
+	movl	(%rbx), %r15d	# 7622	[c=6 l=3]  *zero_extendsidi2/3
+	movq	%r15, %rax	# 15462	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 7624	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 7626	[c=13 l=7]  *adddi_1/1
+	addl	$1, %eax	# 7627	[c=4 l=3]  *addsi_1/0
+	movl	%eax, (%rbx)	# 7628	[c=4 l=2]  *movsi_internal/1
+.L622:
+	movq	1040(%rbx), %rdx	# 1134	[c=9 l=7]  *movdi_internal/3
+	movzbl	100(%rbx), %esi	# 1133	[c=13 l=4]  *zero_extendqisi2/0
+	movl	$2, 96(%rbx)	# 1131	[c=4 l=7]  *movsi_internal/1
+	movsbl	10(%r15), %ecx	# 1132	[c=13 l=5]  extendqisi2
+	movzbl	95(%rdx), %edx	# 1135	[c=13 l=4]  *zero_extendqisi2/0
+	movl	%esi, %eax	# 15322	[c=4 l=2]  *movsi_internal/0
+	notl	%esi	# 1137	[c=4 l=2]  *one_cmplsi2_1/0
+	andl	%esi, %edx	# 1138	[c=4 l=2]  *andsi_1/0
+	movq	104(%rbx), %rsi	# 1139	[c=9 l=4]  *movdi_internal/3
+	andb	(%rsi), %al	# 1140	[c=9 l=2]  *andqi_1/1
+	movzbl	%al, %eax	# 1141	[c=4 l=3]  *zero_extendqisi2/0
+	orl	%edx, %eax	# 1142	[c=4 l=2]  *iorsi_1/0
+	movzwl	12(%r15), %edx	# 1143	[c=13 l=5]  *zero_extendhisi2/0
+	testl	%edx, %eax	# 1145	[c=4 l=2]  *testsi_1/0
+	jne	.L623	# 1146	[c=13 l=2]  *jcc
+	addl	(%rbx), %ecx	# 1150	[c=9 l=2]  *addsi_1/1
+	addq	$1, 48(%rbx)	# 1155	[c=13 l=5]  *adddi_1/0
+	andl	992(%rbx), %ecx	# 1153	[c=13 l=6]  *andsi_1/1
+	movl	%ecx, (%rbx)	# 1154	[c=4 l=2]  *movsi_internal/1
+.L623:
+	cmpq	%rbp, 8(%rsp)	# 1159	[c=13 l=5]  *cmpdi_1/0
+	jb	.L620	# 1160	[c=13 l=6]  *jcc
+	movq	48(%rbx), %rdx	# 1162	[c=9 l=4]  *movdi_internal/3
+	cmpq	56(%rbx), %rdx	# 1163	[c=13 l=4]  *cmpdi_1/1
+	jnb	.L1551	# 1164	[c=13 l=6]  *jcc
+.L624:
+	movl	(%rbx), %r15d	# 1172	[c=6 l=3]  *zero_extendsidi2/3
+	movl	$1, 96(%rbx)	# 1177	[c=4 l=7]  *movsi_internal/1
+	movq	%r15, %rcx	# 15323	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 1174	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 1176	[c=13 l=7]  *adddi_1/1
+	movzbl	11(%r15), %eax	# 1178	[c=13 l=5]  zero_extendqidi2/0
+	movq	(%r15), %r14	# 1187	[c=5 l=3]  *movdi_internal/3
+	addq	%rax, %rbp	# 1179	[c=4 l=3]  *adddi_1/0
+	movzwl	14(%r15), %eax	# 1181	[c=13 l=5]  zero_extendhidi2/0
+	movq	%rbp, 40(%rbx)	# 1180	[c=4 l=4]  *movdi_internal/5
+	addq	%rdx, %rax	# 1182	[c=4 l=3]  *adddi_1/0
+	movq	%r12, %rdx	# 16637	[c=4 l=3]  *movdi_internal/3
+	movq	%rax, 48(%rbx)	# 1183	[c=4 l=4]  *movdi_internal/5
+	movzbl	9(%r15), %eax	# 1184	[c=13 l=5]  *zero_extendqisi2/0
+	addl	%ecx, %eax	# 1185	[c=4 l=2]  *addsi_1/0
+	movq	%r10, %rcx	# 16636	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 1186	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 16638	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 16639	[c=4 l=3]  *indirect_jump
+.L1129:
+	movq	1040(%rbx), %rax	# 8615	[c=9 l=7]  *movdi_internal/3
+	movzbl	10(%r15), %esi	# 8617	[c=13 l=5]  zero_extendqidi2/0
+	movzwl	12(%r15), %r9d	# 8614	[c=13 l=5]  *zero_extendhisi2/0
+	movzbl	100(%rbx), %edi	# 8616	[c=9 l=4]  *movqi_internal/4
+	addq	%rax, %rsi	# 8618	[c=4 l=3]  *adddi_1/0
+	movzbl	95(%rax), %eax	# 8623	[c=13 l=4]  *zero_extendqisi2/0
+	movzbl	(%rsi), %r8d	# 8619	[c=9 l=4]  *zero_extendqisi2/0
+	movl	%r9d, %edx	# 15485	[c=4 l=3]  *movsi_internal/0
+	andl	$136, %edx	# 8638	[c=4 l=6]  *andsi_1/0
+	movl	%r8d, %ecx	# 15484	[c=4 l=3]  *movsi_internal/0
+	subl	%r9d, %r8d	# 8622	[c=4 l=3]  *subsi_1/0
+	movzbl	%dil, %r9d	# 8624	[c=4 l=4]  *zero_extendqisi2/0
+	notl	%r9d	# 8625	[c=4 l=3]  *one_cmplsi2_1/0
+	andl	$136, %ecx	# 8635	[c=4 l=6]  *andsi_1/0
+	andl	%r9d, %eax	# 8626	[c=4 l=3]  *andsi_1/0
+	movq	104(%rbx), %r9	# 8627	[c=9 l=4]  *movdi_internal/3
+	leal	(%rdx,%rcx,2), %edx	# 8639	[c=8 l=3]  *leasi
+	imull	$260, %edx, %edx	# 8655	[c=12 l=6]  *mulsi3_1/1
+	andb	(%r9), %dil	# 8628	[c=9 l=3]  *andqi_1/1
+	orl	%edi, %eax	# 8630	[c=4 l=2]  *iorsi_1/0
+	andl	$1, %eax	# 8631	[c=4 l=3]  *andsi_1/0
+	andl	$7680, %edx	# 8656	[c=4 l=6]  *andsi_1/0
+	subl	%eax, %r8d	# 8632	[c=4 l=3]  *subsi_1/0
+	movb	%r8b, (%rsi)	# 8633	[c=4 l=3]  *movqi_internal/8
+	movq	104(%rbx), %rcx	# 8642	[c=9 l=4]  *movdi_internal/3
+	andl	$511, %r8d	# 8657	[c=4 l=7]  *andsi_1/0
+	movzbl	100(%rbx), %r9d	# 8640	[c=13 l=5]  *zero_extendqisi2/0
+	orl	%r8d, %edx	# 8658	[c=5 l=3]  *iorsi_1_zext
+	movzbl	(%rcx), %edi	# 8643	[c=5 l=3]  *movqi_internal/4
+	movq	1040(%rbx), %rcx	# 8646	[c=9 l=7]  *movdi_internal/3
+	movl	%r9d, %eax	# 15486	[c=4 l=3]  *movsi_internal/0
+	movl	%r9d, %esi	# 13616	[c=4 l=3]  *movsi_internal/0
+	notl	%r9d	# 8648	[c=4 l=3]  *one_cmplsi2_1/0
+	movzbl	95(%rcx), %ecx	# 8647	[c=13 l=4]  *zero_extendqisi2/0
+	andl	%edi, %eax	# 14817	[c=4 l=2]  *andsi_1/0
+	andl	$192, %esi	# 8644	[c=4 l=6]  *andsi_1/0
+	andl	%esi, %edi	# 14818	[c=4 l=2]  *andsi_1/0
+	andl	%r9d, %ecx	# 8649	[c=4 l=3]  *andsi_1/0
+	orl	%eax, %ecx	# 8652	[c=4 l=2]  *iorsi_1/0
+	leaq	flag_update_table_sub8(%rip), %rax	# 8654	[c=1 l=7]  *movdi_internal/4
+	orl	$-3, %ecx	# 8653	[c=4 l=3]  *iorsi_1/0
+	andb	(%rax,%rdx), %cl	# 8661	[c=13 l=3]  *andqi_1/1
+	orl	%edi, %ecx	# 14819	[c=4 l=2]  *iorsi_1/0
+	movb	%cl, 101(%rbx)	# 8664	[c=4 l=3]  *movqi_internal/8
+.L1402:
+	orl	$63, %esi	# 14888	[c=4 l=3]  *iorsi_1/0
+	movb	%sil, 100(%rbx)	# 7674	[c=4 l=4]  *movqi_internal/8
+.L1401:
+	leaq	101(%rbx), %rdx	# 14889	[c=4 l=4]  *leadi
+	movq	%rdx, 104(%rbx)	# 7676	[c=4 l=4]  *movdi_internal/5
+.L1400:
+	movl	(%rbx), %r15d	# 7677	[c=6 l=3]  *zero_extendsidi2/3
+	movq	%r15, %rax	# 15464	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 7679	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 7681	[c=13 l=7]  *adddi_1/1
+	addl	$1, %eax	# 7682	[c=4 l=3]  *addsi_1/0
+	movl	%eax, (%rbx)	# 7683	[c=4 l=2]  *movsi_internal/1
+.L625:
+	movq	1040(%rbx), %rdx	# 1195	[c=9 l=7]  *movdi_internal/3
+	movzbl	100(%rbx), %esi	# 1194	[c=13 l=4]  *zero_extendqisi2/0
+	movl	$2, 96(%rbx)	# 1192	[c=4 l=7]  *movsi_internal/1
+	movsbl	10(%r15), %ecx	# 1193	[c=13 l=5]  extendqisi2
+	movzbl	95(%rdx), %edx	# 1196	[c=13 l=4]  *zero_extendqisi2/0
+	movl	%esi, %eax	# 15324	[c=4 l=2]  *movsi_internal/0
+	notl	%esi	# 1198	[c=4 l=2]  *one_cmplsi2_1/0
+	andl	%esi, %edx	# 1199	[c=4 l=2]  *andsi_1/0
+	movq	104(%rbx), %rsi	# 1200	[c=9 l=4]  *movdi_internal/3
+	andb	(%rsi), %al	# 1201	[c=9 l=2]  *andqi_1/1
+	movzbl	%al, %eax	# 1202	[c=4 l=3]  *zero_extendqisi2/0
+	orl	%edx, %eax	# 1203	[c=4 l=2]  *iorsi_1/0
+	movzwl	12(%r15), %edx	# 1204	[c=13 l=5]  *zero_extendhisi2/0
+	testl	%edx, %eax	# 1206	[c=4 l=2]  *testsi_1/0
+	je	.L626	# 1207	[c=13 l=2]  *jcc
+	addl	(%rbx), %ecx	# 1211	[c=9 l=2]  *addsi_1/1
+	addq	$1, 48(%rbx)	# 1216	[c=13 l=5]  *adddi_1/0
+	andl	992(%rbx), %ecx	# 1214	[c=13 l=6]  *andsi_1/1
+	movl	%ecx, (%rbx)	# 1215	[c=4 l=2]  *movsi_internal/1
+.L626:
+	movq	(%rsp), %rax	# 12894	[c=5 l=4]  *movdi_internal/3
+	subq	$1, %rax	# 1219	[c=4 l=4]  *adddi_1/0
+	cmpq	%rbp, %rax	# 1220	[c=4 l=3]  *cmpdi_1/0
+	jb	.L620	# 1221	[c=13 l=6]  *jcc
+	movq	56(%rbx), %rax	# 12895	[c=9 l=4]  *movdi_internal/3
+	cmpq	%rax, 48(%rbx)	# 1224	[c=13 l=4]  *cmpdi_1/0
+	jnb	.L1552	# 1225	[c=13 l=6]  *jcc
+.L627:
+	movl	(%rbx), %r15d	# 1232	[c=6 l=3]  *zero_extendsidi2/3
+	movl	$1, 96(%rbx)	# 1237	[c=4 l=7]  *movsi_internal/1
+	movq	%r10, %rcx	# 16628	[c=4 l=3]  *movdi_internal/3
+	movq	%r15, %rdx	# 15325	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 1234	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 1236	[c=13 l=7]  *adddi_1/1
+	movzbl	11(%r15), %eax	# 1238	[c=13 l=5]  zero_extendqidi2/0
+	movq	(%r15), %r14	# 1246	[c=5 l=3]  *movdi_internal/3
+	addq	%rax, %rbp	# 1239	[c=4 l=3]  *adddi_1/0
+	movzwl	14(%r15), %eax	# 1241	[c=13 l=5]  zero_extendhidi2/0
+	addq	%rax, 48(%rbx)	# 1242	[c=13 l=4]  *adddi_1/0
+	movq	%rbp, 40(%rbx)	# 1240	[c=4 l=4]  *movdi_internal/5
+	movzbl	9(%r15), %eax	# 1243	[c=13 l=5]  *zero_extendqisi2/0
+	addl	%edx, %eax	# 1244	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 16629	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 1245	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 16630	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 16631	[c=4 l=3]  *indirect_jump
+.L1080:
+	movq	1040(%rbx), %rdx	# 7300	[c=9 l=7]  *movdi_internal/3
+	movzbl	10(%r15), %eax	# 7301	[c=13 l=5]  zero_extendqidi2/0
+	movzwl	12(%r15), %ecx	# 7303	[c=13 l=5]  zero_extendhidi2/0
+	movzbl	(%rdx,%rax), %eax	# 7302	[c=9 l=4]  *movqi_internal/4
+	movzbl	(%rdx,%rcx), %esi	# 7304	[c=13 l=4]  *zero_extendqisi2/0
+.L1421:
+	movl	%eax, %ecx	# 13390	[c=4 l=2]  *movsi_internal/0
+	movl	%esi, %edx	# 13392	[c=4 l=2]  *movsi_internal/0
+	andl	$136, %edx	# 7364	[c=4 l=6]  *andsi_1/0
+	andl	$136, %ecx	# 7361	[c=4 l=6]  *andsi_1/0
+	leal	(%rdx,%rcx,2), %ecx	# 7365	[c=8 l=3]  *leasi
+	movzbl	%al, %edx	# 7366	[c=4 l=3]  *zero_extendqisi2/0
+	imull	$260, %ecx, %eax	# 7370	[c=12 l=6]  *mulsi3_1/1
+	subl	%esi, %edx	# 7368	[c=4 l=2]  *subsi_1/0
+	movzbl	100(%rbx), %ecx	# 7373	[c=9 l=4]  *movqi_internal/4
+	andl	$511, %edx	# 7369	[c=4 l=6]  *andsi_1/0
+	andl	$7680, %eax	# 7371	[c=4 l=5]  *andsi_1/0
+	orl	%eax, %edx	# 7372	[c=5 l=2]  *iorsi_1_zext
+	movl	%ecx, %eax	# 13394	[c=4 l=2]  *movsi_internal/0
+	andl	$192, %eax	# 7376	[c=4 l=5]  *andsi_2/0
+	jne	.L1084	# 7377	[c=13 l=6]  *jcc
+	leaq	flag_update_table_sub8(%rip), %rax	# 7380	[c=1 l=7]  *movdi_internal/4
+	movl	$63, %esi	# 38	[c=4 l=5]  *movqi_internal/3
+	leaq	(%rax,%rdx), %rcx	# 14906	[c=4 l=4]  *leadi
+	leaq	101(%rbx), %rdx	# 11482	[c=4 l=4]  *leadi
+.L1085:
+	movq	%rcx, 104(%rbx)	# 7398	[c=4 l=4]  *movdi_internal/5
+	movb	%sil, 100(%rbx)	# 7399	[c=4 l=4]  *movqi_internal/8
+.L1404:
+	movl	(%rbx), %r15d	# 7455	[c=6 l=3]  *zero_extendsidi2/3
+	movq	%r15, %rcx	# 15458	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 7457	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 7459	[c=13 l=7]  *adddi_1/1
+	addl	$1, %ecx	# 7460	[c=4 l=3]  *addsi_1/0
+	movl	%ecx, (%rbx)	# 7461	[c=4 l=2]  *movsi_internal/1
+.L666:
+	movzwl	12(%r15), %edi	# 1733	[c=13 l=5]  zero_extendhidi2/0
+	movq	1040(%rbx), %rsi	# 1730	[c=9 l=7]  *movdi_internal/3
+	movq	104(%rbx), %r9	# 1737	[c=9 l=4]  *movdi_internal/3
+	movzbl	10(%r15), %ecx	# 1731	[c=13 l=5]  zero_extendqidi2/0
+	movzbl	(%rsi,%rdi), %r13d	# 1734	[c=13 l=5]  *zero_extendqisi2/0
+	movzbl	100(%rbx), %edi	# 1735	[c=13 l=4]  *zero_extendqisi2/0
+	movzbl	(%r9), %r9d	# 1738	[c=5 l=4]  *movqi_internal/4
+	movzbl	(%rsi,%rcx), %ecx	# 1732	[c=13 l=4]  *zero_extendqisi2/0
+	movzbl	95(%rsi), %r14d	# 1739	[c=13 l=5]  *zero_extendqisi2/0
+	movl	%edi, %r8d	# 15334	[c=4 l=3]  *movsi_internal/0
+	movl	%edi, %esi	# 12947	[c=4 l=2]  *movsi_internal/0
+	movl	(%rbx), %r15d	# 1774	[c=6 l=3]  *zero_extendsidi2/3
+	andl	%r9d, %r8d	# 15018	[c=4 l=3]  *andsi_1/0
+	notl	%esi	# 1740	[c=4 l=2]  *one_cmplsi2_1/0
+	andl	$-64, %edi	# 1751	[c=4 l=3]  *andsi_1/0
+	movq	%rdx, 104(%rbx)	# 1773	[c=4 l=4]  *movdi_internal/5
+	andl	%r14d, %esi	# 1741	[c=4 l=3]  *andsi_1/0
+	movzbl	%r8b, %r8d	# 1743	[c=4 l=4]  *zero_extendqisi2/0
+	movl	%ecx, %r14d	# 12949	[c=4 l=3]  *movsi_internal/0
+	subl	%r13d, %ecx	# 1756	[c=4 l=3]  *subsi_1/0
+	orl	%r8d, %esi	# 1744	[c=4 l=3]  *iorsi_1/0
+	movl	%r13d, %r8d	# 12951	[c=4 l=3]  *movsi_internal/0
+	andl	$136, %r14d	# 1746	[c=4 l=7]  *andsi_1/0
+	andl	%edi, %r9d	# 15019	[c=4 l=3]  *andsi_1/0
+	andl	$136, %r8d	# 1749	[c=4 l=7]  *andsi_1/0
+	movl	%esi, %r13d	# 12953	[c=4 l=3]  *movsi_internal/0
+	orl	$-3, %esi	# 1765	[c=4 l=3]  *iorsi_1/0
+	movq	%r15, %rdx	# 15335	[c=4 l=3]  *movdi_internal/3
+	leal	(%r8,%r14,2), %r8d	# 1750	[c=8 l=4]  *leasi
+	andl	$1, %r13d	# 1757	[c=4 l=4]  *andsi_1/0
+	orl	$63, %edi	# 15021	[c=4 l=3]  *iorsi_1/0
+	salq	$4, %r15	# 1776	[c=4 l=4]  *ashldi3_1/0
+	imull	$260, %r8d, %r8d	# 1760	[c=12 l=7]  *mulsi3_1/1
+	subl	%r13d, %ecx	# 1758	[c=4 l=3]  *subsi_1/0
+	addq	1064(%rbx), %r15	# 1778	[c=13 l=7]  *adddi_1/1
+	movb	%dil, 100(%rbx)	# 1771	[c=4 l=4]  *movqi_internal/8
+	andl	$511, %ecx	# 1759	[c=4 l=6]  *andsi_1/0
+	andl	$7680, %r8d	# 1761	[c=4 l=7]  *andsi_1/0
+	orl	%r8d, %ecx	# 1762	[c=5 l=3]  *iorsi_1_zext
+	andb	(%rax,%rcx), %sil	# 1766	[c=13 l=4]  *andqi_1/1
+	movq	%r10, %rcx	# 16572	[c=4 l=3]  *movdi_internal/3
+	orl	%esi, %r9d	# 15020	[c=4 l=3]  *iorsi_1/0
+	movb	%r9b, 101(%rbx)	# 1769	[c=4 l=4]  *movqi_internal/8
+	movzbl	9(%r15), %eax	# 1779	[c=13 l=5]  *zero_extendqisi2/0
+	movq	(%r15), %r14	# 1782	[c=5 l=3]  *movdi_internal/3
+	addl	%edx, %eax	# 1780	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 16573	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 1781	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 16574	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 16575	[c=4 l=3]  *indirect_jump
+.L1138:
+	movq	1040(%rbx), %rcx	# 8948	[c=9 l=7]  *movdi_internal/3
+	movzbl	10(%r15), %eax	# 8949	[c=13 l=5]  zero_extendqidi2/0
+	movzwl	12(%r15), %esi	# 8952	[c=13 l=5]  zero_extendhidi2/0
+	addq	%rcx, %rax	# 8950	[c=4 l=3]  *adddi_1/0
+	movzbl	(%rax), %edx	# 8951	[c=9 l=3]  *zero_extendqisi2/0
+	movzbl	(%rcx,%rsi), %ecx	# 8953	[c=13 l=4]  *zero_extendqisi2/0
+	leal	(%rdx,%rcx), %esi	# 14793	[c=4 l=3]  *leasi
+	movb	%sil, (%rax)	# 8955	[c=4 l=3]  *movqi_internal/8
+	movl	%edx, %esi	# 13640	[c=4 l=2]  *movsi_internal/0
+	movl	%ecx, %eax	# 13642	[c=4 l=2]  *movsi_internal/0
+	addl	%ecx, %edx	# 8966	[c=4 l=2]  *addsi_1/0
+	andl	$136, %esi	# 8957	[c=4 l=6]  *andsi_1/0
+	andl	$136, %eax	# 8960	[c=4 l=5]  *andsi_1/0
+	leal	(%rax,%rsi,2), %eax	# 8961	[c=8 l=3]  *leasi
+	imull	$260, %eax, %eax	# 8962	[c=12 l=6]  *mulsi3_1/1
+	andl	$7680, %eax	# 8963	[c=4 l=5]  *andsi_1/0
+	orl	%edx, %eax	# 8967	[c=5 l=2]  *iorsi_1_zext
+	movzbl	100(%rbx), %edx	# 8968	[c=9 l=4]  *movqi_internal/4
+	movl	%edx, %ecx	# 13644	[c=4 l=2]  *movsi_internal/0
+	andl	$192, %ecx	# 8971	[c=4 l=6]  *andsi_2/0
+	jne	.L1139	# 8972	[c=13 l=6]  *jcc
+	leaq	flag_update_table_add8(%rip), %rcx	# 8975	[c=1 l=7]  *movdi_internal/4
+	movl	$63, %edx	# 54	[c=4 l=5]  *movqi_internal/3
+	addq	%rcx, %rax	# 8976	[c=4 l=3]  *adddi_1/0
+.L1152:
+	movl	(%rbx), %r15d	# 9297	[c=6 l=3]  *zero_extendsidi2/3
+	movq	%rax, 104(%rbx)	# 9295	[c=4 l=4]  *movdi_internal/5
+	movb	%dl, 100(%rbx)	# 9296	[c=4 l=3]  *movqi_internal/8
+	movq	%r15, %rax	# 15503	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 9299	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 9301	[c=13 l=7]  *adddi_1/1
+	addl	$1, %eax	# 9302	[c=4 l=3]  *addsi_1/0
+	movl	%eax, (%rbx)	# 9303	[c=4 l=2]  *movsi_internal/1
+.L600:
+	movq	1040(%rbx), %r9	# 656	[c=9 l=7]  *movdi_internal/3
+	movzbl	100(%rbx), %r8d	# 657	[c=9 l=5]  *movqi_internal/4
+	movzwl	12(%r15), %eax	# 661	[c=13 l=5]  zero_extendhidi2/0
+	movzbl	10(%r15), %esi	# 658	[c=13 l=5]  zero_extendqidi2/0
+	movzbl	(%r9,%rax), %edi	# 662	[c=9 l=5]  *movqi_internal/4
+	addq	%r9, %rsi	# 659	[c=4 l=3]  *adddi_1/0
+	movzbl	%r8b, %eax	# 663	[c=4 l=4]  *zero_extendqisi2/0
+	movzbl	95(%r9), %r9d	# 665	[c=13 l=5]  *zero_extendqisi2/0
+	notl	%eax	# 664	[c=4 l=2]  *one_cmplsi2_1/0
+	movzbl	(%rsi), %edx	# 660	[c=5 l=3]  *movqi_internal/4
+	andl	%r9d, %eax	# 666	[c=4 l=3]  *andsi_1/0
+	movq	104(%rbx), %r9	# 667	[c=9 l=4]  *movdi_internal/3
+	andb	(%r9), %r8b	# 668	[c=9 l=3]  *andqi_1/1
+	movzbl	%dil, %r9d	# 673	[c=4 l=4]  *zero_extendqisi2/0
+	andl	$136, %edi	# 681	[c=4 l=6]  *andsi_1/0
+	orl	%r8d, %eax	# 670	[c=4 l=3]  *iorsi_1/0
+	movzbl	%dl, %r8d	# 672	[c=4 l=4]  *zero_extendqisi2/0
+	andl	$136, %edx	# 678	[c=4 l=6]  *andsi_1/0
+	leal	(%rdi,%rdx,2), %edx	# 682	[c=8 l=3]  *leasi
+	andl	$1, %eax	# 671	[c=4 l=3]  *andsi_1/0
+	addl	%r9d, %r8d	# 674	[c=4 l=3]  *addsi_1/0
+	imull	$260, %edx, %edx	# 683	[c=12 l=6]  *mulsi3_1/1
+	addl	%r8d, %eax	# 675	[c=4 l=3]  *addsi_1/0
+	movb	%al, (%rsi)	# 676	[c=4 l=2]  *movqi_internal/8
+	andl	$7680, %edx	# 684	[c=4 l=6]  *andsi_1/0
+	orl	%eax, %edx	# 685	[c=5 l=2]  *iorsi_1_zext
+	movzbl	100(%rbx), %eax	# 686	[c=9 l=4]  *movqi_internal/4
+	movl	%eax, %esi	# 12857	[c=4 l=2]  *movsi_internal/0
+	andl	$192, %esi	# 689	[c=4 l=6]  *andsi_2/0
+	jne	.L601	# 690	[c=13 l=6]  *jcc
+	leaq	(%rcx,%rdx), %rax	# 15064	[c=4 l=4]  *leadi
+	movl	$63, %edx	# 6	[c=4 l=5]  *movqi_internal/3
+.L602:
+	movl	(%rbx), %r15d	# 713	[c=6 l=3]  *zero_extendsidi2/3
+	movb	%dl, 100(%rbx)	# 712	[c=4 l=3]  *movqi_internal/8
+	movq	%r10, %rcx	# 16716	[c=4 l=3]  *movdi_internal/3
+	movq	%rax, 104(%rbx)	# 711	[c=4 l=4]  *movdi_internal/5
+	movq	%r15, %rdx	# 15310	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 715	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 717	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%r15), %eax	# 718	[c=13 l=5]  *zero_extendqisi2/0
+	movq	(%r15), %r14	# 721	[c=5 l=3]  *movdi_internal/3
+	addl	%edx, %eax	# 719	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 16717	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 720	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 16718	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 16719	[c=4 l=3]  *indirect_jump
+.L1174:
+	movq	1040(%rbx), %rax	# 9574	[c=9 l=7]  *movdi_internal/3
+	movzbl	10(%r15), %r14d	# 9573	[c=9 l=5]  *movqi_internal/4
+	movzwl	30(%rax), %r13d	# 9575	[c=13 l=5]  zero_extendhidi2/0
+	movl	%r13d, %edx	# 13679	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rcx	# 15512	[c=4 l=3]  *movdi_internal/3
+	subl	5176(%rbx), %edx	# 9578	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %edx	# 9579	[c=13 l=6]  *cmpsi_1/1
+	jb	.L1175	# 9580	[c=13 l=2]  *jcc
+	movl	%r13d, %edx	# 13681	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %edx	# 9582	[c=4 l=3]  *ashrsi3_1/0
+	movslq	%edx, %rdx	# 9583	[c=4 l=3]  *extendsidi2_rex64/1
+	cmpb	$0, 1080(%rbx,%rdx)	# 9584	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L1176	# 9585	[c=13 l=6]  *jcc
+.L1175:
+	movzbl	(%rax,%rcx), %ecx	# 9589	[c=13 l=4]  *zero_extendqisi2/0
+.L1177:
+	movzbl	%r14b, %edx	# 9600	[c=4 l=4]  zero_extendqidi2/0
+	movb	%cl, (%rax,%rdx)	# 9602	[c=4 l=3]  *movqi_internal/8
+	leal	1(%r13), %eax	# 14773	[c=4 l=4]  *leasi
+.L1405:
+	movq	1040(%rbx), %rdx	# 9727	[c=9 l=7]  *movdi_internal/3
+	movb	%al, 30(%rdx)	# 9728	[c=4 l=3]  *movqi_internal/8
+	movq	1040(%rbx), %rdx	# 9729	[c=9 l=7]  *movdi_internal/3
+	movb	%ah, 31(%rdx)	# 16770	[c=4 l=3]  *extzvqi_mem_rex64
+.L1406:
+	movl	(%rbx), %r15d	# 9732	[c=6 l=3]  *zero_extendsidi2/3
+	movq	%r15, %rax	# 15518	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 9734	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 9736	[c=13 l=7]  *adddi_1/1
+	addl	$1, %eax	# 9737	[c=4 l=3]  *addsi_1/0
+	movl	%eax, (%rbx)	# 9738	[c=4 l=2]  *movsi_internal/1
+.L1036:
+	movq	1040(%rbx), %rsi	# 6603	[c=9 l=7]  *movdi_internal/3
+	movzbl	10(%r15), %edx	# 6606	[c=13 l=5]  zero_extendqidi2/0
+	movzwl	26(%rsi), %r13d	# 6604	[c=13 l=5]  zero_extendhidi2/0
+	movzbl	(%rsi,%rdx), %ecx	# 6607	[c=9 l=4]  *movqi_internal/4
+	movq	%r13, %rax	# 15434	[c=4 l=3]  *movdi_internal/3
+	movl	%r13d, %edx	# 13311	[c=4 l=3]  *movsi_internal/0
+	subl	5176(%rbx), %edx	# 6609	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %edx	# 6610	[c=13 l=6]  *cmpsi_1/1
+	jb	.L1037	# 6611	[c=13 l=2]  *jcc
+	movl	%r13d, %edx	# 13313	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %edx	# 6613	[c=4 l=3]  *ashrsi3_1/0
+	movslq	%edx, %rdx	# 6614	[c=4 l=3]  *extendsidi2_rex64/1
+	cmpb	$0, 1080(%rbx,%rdx)	# 6615	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L1038	# 6616	[c=13 l=6]  *jcc
+.L1037:
+	movb	%cl, (%rsi,%rax)	# 6620	[c=4 l=3]  *movqi_internal/8
+.L1039:
+	movq	1040(%rbx), %rdx	# 6633	[c=9 l=7]  *movdi_internal/3
+	leal	1(%r13), %eax	# 14926	[c=4 l=4]  *leasi
+	movq	%r10, %rcx	# 15996	[c=4 l=3]  *movdi_internal/3
+	movb	%al, 26(%rdx)	# 6634	[c=4 l=3]  *movqi_internal/8
+	movq	1040(%rbx), %rdx	# 6635	[c=9 l=7]  *movdi_internal/3
+	movb	%ah, 27(%rdx)	# 16794	[c=4 l=3]  *extzvqi_mem_rex64
+	movl	(%rbx), %r15d	# 6638	[c=6 l=3]  *zero_extendsidi2/3
+	movq	%r15, %rdx	# 15435	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 6640	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 6642	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%r15), %eax	# 6643	[c=13 l=5]  *zero_extendqisi2/0
+	movq	(%r15), %r14	# 6646	[c=5 l=3]  *movdi_internal/3
+	addl	%edx, %eax	# 6644	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 15997	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 6645	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 15998	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 15999	[c=4 l=3]  *indirect_jump
+.L1170:
+	movq	1040(%rbx), %rax	# 9527	[c=9 l=7]  *movdi_internal/3
+	movzbl	10(%r15), %r14d	# 9526	[c=9 l=5]  *movqi_internal/4
+	movzwl	26(%rax), %r13d	# 9528	[c=13 l=5]  zero_extendhidi2/0
+	movl	%r13d, %edx	# 13674	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rcx	# 15510	[c=4 l=3]  *movdi_internal/3
+	subl	5176(%rbx), %edx	# 9531	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %edx	# 9532	[c=13 l=6]  *cmpsi_1/1
+	jb	.L1171	# 9533	[c=13 l=2]  *jcc
+	movl	%r13d, %edx	# 13676	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %edx	# 9535	[c=4 l=3]  *ashrsi3_1/0
+	movslq	%edx, %rdx	# 9536	[c=4 l=3]  *extendsidi2_rex64/1
+	cmpb	$0, 1080(%rbx,%rdx)	# 9537	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L1172	# 9538	[c=13 l=6]  *jcc
+.L1171:
+	movzbl	(%rax,%rcx), %ecx	# 9542	[c=13 l=4]  *zero_extendqisi2/0
+.L1173:
+	movzbl	%r14b, %edx	# 9553	[c=4 l=4]  zero_extendqidi2/0
+	movb	%cl, (%rax,%rdx)	# 9555	[c=4 l=3]  *movqi_internal/8
+	movq	1040(%rbx), %rdx	# 9557	[c=9 l=7]  *movdi_internal/3
+	leal	1(%r13), %eax	# 14774	[c=4 l=4]  *leasi
+	movb	%al, 26(%rdx)	# 9558	[c=4 l=3]  *movqi_internal/8
+	movq	1040(%rbx), %rdx	# 9559	[c=9 l=7]  *movdi_internal/3
+	movb	%ah, 27(%rdx)	# 16773	[c=4 l=3]  *extzvqi_mem_rex64
+.L1407:
+	movl	(%rbx), %r15d	# 9656	[c=6 l=3]  *zero_extendsidi2/3
+	movq	%r15, %rax	# 15515	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 9658	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 9660	[c=13 l=7]  *adddi_1/1
+	addl	$1, %eax	# 9661	[c=4 l=3]  *addsi_1/0
+	movl	%eax, (%rbx)	# 9662	[c=4 l=2]  *movsi_internal/1
+.L1052:
+	movq	1040(%rbx), %rax	# 6793	[c=9 l=7]  *movdi_internal/3
+	movzbl	10(%r15), %ecx	# 6796	[c=13 l=5]  zero_extendqidi2/0
+	movzwl	30(%rax), %r13d	# 6794	[c=13 l=5]  zero_extendhidi2/0
+	movzbl	(%rax,%rcx), %esi	# 6797	[c=9 l=4]  *movqi_internal/4
+	movq	%r13, %rdx	# 15440	[c=4 l=3]  *movdi_internal/3
+	movl	%r13d, %ecx	# 13331	[c=4 l=3]  *movsi_internal/0
+	subl	5176(%rbx), %ecx	# 6799	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %ecx	# 6800	[c=13 l=6]  *cmpsi_1/1
+	jb	.L1053	# 6801	[c=13 l=2]  *jcc
+	movl	%r13d, %ecx	# 13333	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %ecx	# 6803	[c=4 l=3]  *ashrsi3_1/0
+	movslq	%ecx, %rcx	# 6804	[c=4 l=3]  *extendsidi2_rex64/1
+	cmpb	$0, 1080(%rbx,%rcx)	# 6805	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L1054	# 6806	[c=13 l=6]  *jcc
+.L1053:
+	movb	%sil, (%rax,%rdx)	# 6810	[c=4 l=4]  *movqi_internal/8
+.L1055:
+	movq	1040(%rbx), %rdx	# 6823	[c=9 l=7]  *movdi_internal/3
+	leal	1(%r13), %eax	# 14924	[c=4 l=4]  *leasi
+	movq	%r10, %rcx	# 15964	[c=4 l=3]  *movdi_internal/3
+	movb	%al, 30(%rdx)	# 6824	[c=4 l=3]  *movqi_internal/8
+	movq	1040(%rbx), %rdx	# 6825	[c=9 l=7]  *movdi_internal/3
+	movb	%ah, 31(%rdx)	# 16790	[c=4 l=3]  *extzvqi_mem_rex64
+	movl	(%rbx), %r15d	# 6828	[c=6 l=3]  *zero_extendsidi2/3
+	movq	%r15, %rdx	# 15441	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 6830	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 6832	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%r15), %eax	# 6833	[c=13 l=5]  *zero_extendqisi2/0
+	movq	(%r15), %r14	# 6836	[c=5 l=3]  *movdi_internal/3
+	addl	%edx, %eax	# 6834	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 15965	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 6835	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 15966	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 15967	[c=4 l=3]  *indirect_jump
+.L1154:
+	movzwl	12(%r15), %esi	# 9335	[c=13 l=5]  zero_extendhidi2/0
+	movq	1040(%rbx), %rcx	# 9337	[c=9 l=7]  *movdi_internal/3
+	movzbl	10(%r15), %eax	# 9336	[c=9 l=5]  *movqi_internal/4
+	movzbl	(%rcx,%rsi), %edi	# 9339	[c=9 l=4]  *movqi_internal/4
+	movq	%rsi, %rdx	# 15506	[c=4 l=3]  *movdi_internal/3
+	movzbl	%al, %esi	# 9340	[c=4 l=3]  zero_extendqidi2/0
+	movb	%dil, (%rcx,%rsi)	# 9341	[c=4 l=4]  *movqi_internal/8
+	movq	1040(%rbx), %rcx	# 9342	[c=9 l=7]  *movdi_internal/3
+	movzbl	1(%rcx,%rdx), %edx	# 9346	[c=10 l=5]  *movqi_internal/4
+	movb	%dl, 1(%rcx,%rsi)	# 9350	[c=4 l=4]  *movqi_internal/8
+	movl	(%rbx), %r15d	# 9351	[c=6 l=3]  *zero_extendsidi2/3
+	movq	%r15, %rax	# 15507	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 9353	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 9355	[c=13 l=7]  *adddi_1/1
+	addl	$1, %eax	# 9356	[c=4 l=3]  *addsi_1/0
+	movl	%eax, (%rbx)	# 9357	[c=4 l=2]  *movsi_internal/1
+.L607:
+	movzbl	10(%r15), %edi	# 840	[c=13 l=5]  zero_extendqidi2/0
+	movq	1040(%rbx), %rax	# 839	[c=9 l=7]  *movdi_internal/3
+	movzbl	1(%rax,%rdi), %edx	# 843	[c=14 l=5]  *zero_extendqisi2/0
+	leaq	(%rax,%rdi), %rsi	# 15047	[c=4 l=4]  *leadi
+	movzbl	(%rsi), %eax	# 845	[c=9 l=3]  *zero_extendqisi2/0
+	sall	$8, %edx	# 844	[c=4 l=3]  *ashlsi3_1/0
+	orl	%eax, %edx	# 846	[c=4 l=2]  *iorsi_1/0
+	movzwl	12(%r15), %eax	# 847	[c=13 l=5]  *zero_extendhisi2/0
+	movl	%edx, %ecx	# 12875	[c=4 l=2]  *movsi_internal/0
+	shrl	$5, %edx	# 855	[c=4 l=3]  *lshrsi3_1/0
+	subl	%eax, %ecx	# 848	[c=4 l=2]  *subsi_1/0
+	andl	$1024, %edx	# 856	[c=4 l=6]  *andsi_1/0
+	movb	%cl, (%rsi)	# 849	[c=4 l=2]  *movqi_internal/8
+	movl	%ecx, %esi	# 12877	[c=4 l=2]  *movsi_internal/0
+	movq	1040(%rbx), %rax	# 851	[c=9 l=7]  *movdi_internal/3
+	sarl	$8, %esi	# 850	[c=4 l=3]  *ashrsi3_1/0
+	movb	%sil, 1(%rax,%rdi)	# 852	[c=4 l=5]  *movqi_internal/8
+	andl	$511, %esi	# 857	[c=4 l=6]  *andsi_1/0
+	leaq	flag_update_table_sub8(%rip), %rax	# 853	[c=1 l=7]  *movdi_internal/4
+	movl	(%rbx), %r15d	# 880	[c=6 l=3]  *zero_extendsidi2/3
+	orl	%esi, %edx	# 858	[c=4 l=2]  *iorsi_1/0
+	movslq	%edx, %rdx	# 859	[c=4 l=3]  *extendsidi2_rex64/1
+	movzbl	(%rax,%rdx), %edx	# 860	[c=13 l=4]  *zero_extendqisi2/0
+	xorl	%eax, %eax	# 16912	[c=4 l=2]  *movsi_xor
+	testw	%cx, %cx	# 16913	[c=4 l=3]  *cmphi_ccno_1/0
+	movq	104(%rbx), %rcx	# 871	[c=9 l=4]  *movdi_internal/3
+	setne	%al	# 16914	[c=4 l=3]  *setcc_qi_slp
+	addl	%eax, %eax	# 865	[c=4 l=2]  *ashlsi3_1/0
+	movzbl	(%rcx), %edi	# 16915	[c=5 l=3]  *movqi_internal/4
+	notl	%eax	# 866	[c=4 l=2]  *one_cmplsi2_1/0
+	andl	%eax, %edx	# 867	[c=4 l=2]  *andsi_1/0
+	movzbl	100(%rbx), %eax	# 868	[c=13 l=4]  *zero_extendqisi2/0
+	andl	$-33, %edx	# 873	[c=4 l=3]  *andsi_1/0
+	andl	$-32, %eax	# 869	[c=4 l=3]  *andsi_1/0
+	andl	%eax, %edi	# 17549	[c=4 l=2]  *andsi_1/0
+	orl	$31, %eax	# 15051	[c=4 l=3]  *iorsi_1/0
+	movl	%edi, %ecx	# 12880	[c=4 l=2]  *movqi_internal/1
+	movb	%al, 100(%rbx)	# 877	[c=4 l=3]  *movqi_internal/8
+	orl	%ecx, %edx	# 15050	[c=4 l=2]  *iorsi_1/0
+	movq	%r10, %rcx	# 16692	[c=4 l=3]  *movdi_internal/3
+	movb	%dl, 101(%rbx)	# 875	[c=4 l=3]  *movqi_internal/8
+	leaq	101(%rbx), %rdx	# 15052	[c=4 l=4]  *leadi
+	movq	%rdx, 104(%rbx)	# 879	[c=4 l=4]  *movdi_internal/5
+	movq	%r15, %rdx	# 15313	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 882	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 884	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%r15), %eax	# 885	[c=13 l=5]  *zero_extendqisi2/0
+	movq	(%r15), %r14	# 888	[c=5 l=3]  *movdi_internal/3
+	addl	%edx, %eax	# 886	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 16693	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 887	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 16694	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 16695	[c=4 l=3]  *indirect_jump
+.L1153:
+	movzwl	12(%r15), %esi	# 9308	[c=13 l=5]  zero_extendhidi2/0
+	movq	1040(%rbx), %rcx	# 9310	[c=9 l=7]  *movdi_internal/3
+	movzbl	10(%r15), %eax	# 9309	[c=9 l=5]  *movqi_internal/4
+	movzbl	(%rcx,%rsi), %edi	# 9312	[c=9 l=4]  *movqi_internal/4
+	movq	%rsi, %rdx	# 15504	[c=4 l=3]  *movdi_internal/3
+	movzbl	%al, %esi	# 9313	[c=4 l=3]  zero_extendqidi2/0
+	movb	%dil, (%rcx,%rsi)	# 9314	[c=4 l=4]  *movqi_internal/8
+	movq	1040(%rbx), %rcx	# 9315	[c=9 l=7]  *movdi_internal/3
+	movzbl	1(%rcx,%rdx), %edx	# 9319	[c=10 l=5]  *movqi_internal/4
+	movb	%dl, 1(%rcx,%rsi)	# 9323	[c=4 l=4]  *movqi_internal/8
+	movl	(%rbx), %r15d	# 9324	[c=6 l=3]  *zero_extendsidi2/3
+	movq	%r15, %rax	# 15505	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 9326	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 9328	[c=13 l=7]  *adddi_1/1
+	addl	$1, %eax	# 9329	[c=4 l=3]  *addsi_1/0
+	movl	%eax, (%rbx)	# 9330	[c=4 l=2]  *movsi_internal/1
+.L606:
+	movzbl	10(%r15), %ecx	# 787	[c=13 l=5]  zero_extendqidi2/0
+	movq	1040(%rbx), %rax	# 786	[c=9 l=7]  *movdi_internal/3
+	leaq	(%rax,%rcx), %rdx	# 15053	[c=4 l=4]  *leadi
+	movzbl	1(%rax,%rcx), %eax	# 790	[c=14 l=5]  *zero_extendqisi2/0
+	movzbl	(%rdx), %esi	# 792	[c=9 l=3]  *zero_extendqisi2/0
+	sall	$8, %eax	# 791	[c=4 l=3]  *ashlsi3_1/0
+	orl	%esi, %eax	# 793	[c=4 l=2]  *iorsi_1/0
+	movzwl	12(%r15), %esi	# 794	[c=13 l=5]  *zero_extendhisi2/0
+	addl	%eax, %esi	# 795	[c=4 l=2]  *addsi_1/0
+	shrl	$5, %eax	# 802	[c=4 l=3]  *lshrsi3_1/0
+	movb	%sil, (%rdx)	# 796	[c=4 l=3]  *movqi_internal/8
+	movl	%esi, %edx	# 12871	[c=4 l=2]  *movsi_internal/0
+	andl	$1024, %eax	# 803	[c=4 l=5]  *andsi_1/0
+	movq	1040(%rbx), %rdi	# 798	[c=9 l=7]  *movdi_internal/3
+	sarl	$8, %edx	# 797	[c=4 l=3]  *ashrsi3_1/0
+	orl	%edx, %eax	# 804	[c=4 l=2]  *iorsi_1/0
+	movb	%dl, 1(%rdi,%rcx)	# 799	[c=4 l=4]  *movqi_internal/8
+	leaq	flag_update_table_add8(%rip), %rcx	# 800	[c=1 l=7]  *movdi_internal/4
+	movl	(%rbx), %r15d	# 826	[c=6 l=3]  *zero_extendsidi2/3
+	cltq	# 805	[c=4 l=2]  *extendsidi2_rex64/0
+	movzbl	(%rcx,%rax), %edx	# 806	[c=13 l=4]  *zero_extendqisi2/0
+	xorl	%eax, %eax	# 16917	[c=4 l=2]  *movsi_xor
+	testw	%si, %si	# 16918	[c=4 l=3]  *cmphi_ccno_1/0
+	movq	104(%rbx), %rcx	# 817	[c=9 l=4]  *movdi_internal/3
+	setne	%al	# 16919	[c=4 l=3]  *setcc_qi_slp
+	addl	%eax, %eax	# 811	[c=4 l=2]  *ashlsi3_1/0
+	movzbl	(%rcx), %edi	# 16920	[c=5 l=3]  *movqi_internal/4
+	notl	%eax	# 812	[c=4 l=2]  *one_cmplsi2_1/0
+	andl	%eax, %edx	# 813	[c=4 l=2]  *andsi_1/0
+	movzbl	100(%rbx), %eax	# 814	[c=13 l=4]  *zero_extendqisi2/0
+	andl	$-33, %edx	# 819	[c=4 l=3]  *andsi_1/0
+	andl	$-32, %eax	# 815	[c=4 l=3]  *andsi_1/0
+	andl	%eax, %edi	# 17548	[c=4 l=2]  *andsi_1/0
+	orl	$31, %eax	# 15057	[c=4 l=3]  *iorsi_1/0
+	movl	%edi, %ecx	# 12874	[c=4 l=2]  *movqi_internal/1
+	movb	%al, 100(%rbx)	# 823	[c=4 l=3]  *movqi_internal/8
+	orl	%ecx, %edx	# 15056	[c=4 l=2]  *iorsi_1/0
+	movq	%r10, %rcx	# 16700	[c=4 l=3]  *movdi_internal/3
+	movb	%dl, 101(%rbx)	# 821	[c=4 l=3]  *movqi_internal/8
+	leaq	101(%rbx), %rdx	# 15058	[c=4 l=4]  *leadi
+	movq	%rdx, 104(%rbx)	# 825	[c=4 l=4]  *movdi_internal/5
+	movq	%r15, %rdx	# 15312	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 828	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 830	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%r15), %eax	# 831	[c=13 l=5]  *zero_extendqisi2/0
+	movq	(%r15), %r14	# 834	[c=5 l=3]  *movdi_internal/3
+	addl	%edx, %eax	# 832	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 16701	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 833	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 16702	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 16703	[c=4 l=3]  *indirect_jump
+.L1182:
+	movq	1040(%rbx), %rax	# 9668	[c=9 l=7]  *movdi_internal/3
+	movzbl	10(%r15), %r14d	# 9667	[c=9 l=5]  *movqi_internal/4
+	movzwl	30(%rax), %r13d	# 9669	[c=13 l=5]  zero_extendhidi2/0
+	movl	%r13d, %edx	# 13689	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rcx	# 15516	[c=4 l=3]  *movdi_internal/3
+	subl	5176(%rbx), %edx	# 9672	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %edx	# 9673	[c=13 l=6]  *cmpsi_1/1
+	jb	.L1183	# 9674	[c=13 l=2]  *jcc
+	movl	%r13d, %edx	# 13691	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %edx	# 9676	[c=4 l=3]  *ashrsi3_1/0
+	movslq	%edx, %rdx	# 9677	[c=4 l=3]  *extendsidi2_rex64/1
+	cmpb	$0, 1080(%rbx,%rdx)	# 9678	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L1184	# 9679	[c=13 l=6]  *jcc
+.L1183:
+	movzbl	(%rax,%rcx), %ecx	# 9683	[c=13 l=4]  *zero_extendqisi2/0
+.L1185:
+	movzbl	%r14b, %edx	# 9694	[c=4 l=4]  zero_extendqidi2/0
+	movb	%cl, (%rax,%rdx)	# 9696	[c=4 l=3]  *movqi_internal/8
+	movq	1040(%rbx), %rdx	# 9698	[c=9 l=7]  *movdi_internal/3
+	leal	1(%r13), %eax	# 14771	[c=4 l=4]  *leasi
+	movb	%al, 30(%rdx)	# 9699	[c=4 l=3]  *movqi_internal/8
+	movq	1040(%rbx), %rdx	# 9700	[c=9 l=7]  *movdi_internal/3
+	movb	%ah, 31(%rdx)	# 16771	[c=4 l=3]  *extzvqi_mem_rex64
+	movl	(%rbx), %r15d	# 9703	[c=6 l=3]  *zero_extendsidi2/3
+	movq	%r15, %rax	# 15517	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 9705	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 9707	[c=13 l=7]  *adddi_1/1
+	addl	$1, %eax	# 9708	[c=4 l=3]  *addsi_1/0
+	movl	%eax, (%rbx)	# 9709	[c=4 l=2]  *movsi_internal/1
+.L1044:
+	movq	1040(%rbx), %rsi	# 6698	[c=9 l=7]  *movdi_internal/3
+	movzbl	10(%r15), %eax	# 6701	[c=13 l=5]  zero_extendqidi2/0
+	movzwl	28(%rsi), %r13d	# 6699	[c=13 l=5]  zero_extendhidi2/0
+	movzbl	(%rsi,%rax), %ecx	# 6702	[c=9 l=4]  *movqi_internal/4
+	movq	%r13, %rdx	# 15437	[c=4 l=3]  *movdi_internal/3
+	movl	%r13d, %eax	# 13321	[c=4 l=3]  *movsi_internal/0
+	subl	5176(%rbx), %eax	# 6704	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %eax	# 6705	[c=13 l=6]  *cmpsi_1/1
+	jb	.L1045	# 6706	[c=13 l=2]  *jcc
+	movl	%r13d, %eax	# 13323	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %eax	# 6708	[c=4 l=3]  *ashrsi3_1/0
+	cltq	# 6709	[c=4 l=2]  *extendsidi2_rex64/0
+	cmpb	$0, 1080(%rbx,%rax)	# 6710	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L1046	# 6711	[c=13 l=6]  *jcc
+.L1045:
+	movb	%cl, (%rsi,%rdx)	# 6715	[c=4 l=3]  *movqi_internal/8
+.L1047:
+	movq	1040(%rbx), %rdx	# 6728	[c=9 l=7]  *movdi_internal/3
+	leal	1(%r13), %eax	# 14925	[c=4 l=4]  *leasi
+	movq	%r10, %rcx	# 15980	[c=4 l=3]  *movdi_internal/3
+	movb	%al, 28(%rdx)	# 6729	[c=4 l=3]  *movqi_internal/8
+	movq	1040(%rbx), %rdx	# 6730	[c=9 l=7]  *movdi_internal/3
+	movb	%ah, 29(%rdx)	# 16792	[c=4 l=3]  *extzvqi_mem_rex64
+	movl	(%rbx), %r15d	# 6733	[c=6 l=3]  *zero_extendsidi2/3
+	movq	%r15, %rdx	# 15438	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 6735	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 6737	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%r15), %eax	# 6738	[c=13 l=5]  *zero_extendqisi2/0
+	movq	(%r15), %r14	# 6741	[c=5 l=3]  *movdi_internal/3
+	addl	%edx, %eax	# 6739	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 15981	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 6740	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 15982	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 15983	[c=4 l=3]  *indirect_jump
+.L1122:
+	movzbl	10(%r15), %esi	# 8435	[c=13 l=5]  zero_extendqidi2/0
+	addq	1040(%rbx), %rsi	# 8437	[c=13 l=7]  *adddi_1/1
+	movzwl	12(%r15), %edi	# 8434	[c=13 l=5]  *zero_extendhisi2/0
+	movzbl	(%rsi), %eax	# 8438	[c=9 l=3]  *zero_extendqisi2/0
+	movl	%edi, %edx	# 15475	[c=4 l=2]  *movsi_internal/0
+	movl	%eax, %ecx	# 15474	[c=4 l=2]  *movsi_internal/0
+	subl	%edi, %eax	# 8441	[c=4 l=2]  *subsi_1/0
+	andl	$136, %ecx	# 8444	[c=4 l=6]  *andsi_1/0
+	andl	$136, %edx	# 8447	[c=4 l=6]  *andsi_1/0
+	movb	%al, (%rsi)	# 8442	[c=4 l=2]  *movqi_internal/8
+	andl	$511, %eax	# 8451	[c=4 l=5]  *andsi_1/0
+	leal	(%rdx,%rcx,2), %edx	# 8448	[c=8 l=3]  *leasi
+	movzbl	100(%rbx), %ecx	# 8453	[c=9 l=4]  *movqi_internal/4
+	imull	$260, %edx, %edx	# 8449	[c=12 l=6]  *mulsi3_1/1
+	andl	$7680, %edx	# 8450	[c=4 l=6]  *andsi_1/0
+	orl	%eax, %edx	# 8452	[c=5 l=2]  *iorsi_1_zext
+	movl	%ecx, %eax	# 13600	[c=4 l=2]  *movsi_internal/0
+	andl	$192, %eax	# 8456	[c=4 l=5]  *andsi_2/0
+	jne	.L1123	# 8457	[c=13 l=6]  *jcc
+	leaq	flag_update_table_sub8(%rip), %rax	# 8460	[c=1 l=7]  *movdi_internal/4
+	movl	$63, %esi	# 50	[c=4 l=5]  *movqi_internal/3
+	leaq	(%rax,%rdx), %rcx	# 14831	[c=4 l=4]  *leadi
+	leaq	101(%rbx), %rdx	# 11488	[c=4 l=4]  *leadi
+.L1124:
+	movl	(%rbx), %r15d	# 8480	[c=6 l=3]  *zero_extendsidi2/3
+	movq	%rcx, 104(%rbx)	# 8478	[c=4 l=4]  *movdi_internal/5
+	movb	%sil, 100(%rbx)	# 8479	[c=4 l=4]  *movqi_internal/8
+	movq	%r15, %rcx	# 15476	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 8482	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 8484	[c=13 l=7]  *adddi_1/1
+	addl	$1, %ecx	# 8485	[c=4 l=3]  *addsi_1/0
+	movl	%ecx, (%rbx)	# 8486	[c=4 l=2]  *movsi_internal/1
+.L947:
+	movzbl	10(%r15), %r9d	# 5459	[c=13 l=5]  zero_extendqidi2/0
+	movq	1040(%rbx), %rcx	# 5457	[c=9 l=7]  *movdi_internal/3
+	movzwl	12(%r15), %r14d	# 5456	[c=13 l=5]  *zero_extendhisi2/0
+	movzbl	100(%rbx), %r13d	# 5458	[c=9 l=5]  *movqi_internal/4
+	addq	%rcx, %r9	# 5460	[c=4 l=3]  *adddi_1/0
+	movzbl	(%r9), %edi	# 5461	[c=9 l=4]  *zero_extendqisi2/0
+	movl	%r14d, %esi	# 15405	[c=4 l=3]  *movsi_internal/0
+	andl	$136, %esi	# 5480	[c=4 l=6]  *andsi_1/0
+	movl	%edi, %r8d	# 15404	[c=4 l=3]  *movsi_internal/0
+	subl	%r14d, %edi	# 5464	[c=4 l=3]  *subsi_1/0
+	movzbl	95(%rcx), %r14d	# 5465	[c=13 l=5]  *zero_extendqisi2/0
+	movzbl	%r13b, %ecx	# 5466	[c=4 l=4]  *zero_extendqisi2/0
+	notl	%ecx	# 5467	[c=4 l=2]  *one_cmplsi2_1/0
+	andl	$136, %r8d	# 5477	[c=4 l=7]  *andsi_1/0
+	andl	%r14d, %ecx	# 5468	[c=4 l=3]  *andsi_1/0
+	movq	104(%rbx), %r14	# 5469	[c=9 l=4]  *movdi_internal/3
+	leal	(%rsi,%r8,2), %esi	# 5481	[c=8 l=4]  *leasi
+	imull	$260, %esi, %esi	# 5497	[c=12 l=6]  *mulsi3_1/1
+	andb	(%r14), %r13b	# 5470	[c=9 l=3]  *andqi_1/1
+	orl	%r13d, %ecx	# 5472	[c=4 l=3]  *iorsi_1/0
+	andl	$1, %ecx	# 5473	[c=4 l=3]  *andsi_1/0
+	andl	$7680, %esi	# 5498	[c=4 l=6]  *andsi_1/0
+	subl	%ecx, %edi	# 5474	[c=4 l=2]  *subsi_1/0
+	movb	%dil, (%r9)	# 5475	[c=4 l=3]  *movqi_internal/8
+	movq	104(%rbx), %r9	# 5484	[c=9 l=4]  *movdi_internal/3
+	andl	$511, %edi	# 5499	[c=4 l=6]  *andsi_1/0
+	movq	1040(%rbx), %r14	# 5488	[c=9 l=7]  *movdi_internal/3
+	movzbl	100(%rbx), %ecx	# 5482	[c=13 l=4]  *zero_extendqisi2/0
+	orl	%edi, %esi	# 5500	[c=5 l=2]  *iorsi_1_zext
+	movzbl	(%r9), %r13d	# 5485	[c=5 l=4]  *movqi_internal/4
+	movl	(%rbx), %r15d	# 5511	[c=6 l=3]  *zero_extendsidi2/3
+	movzbl	95(%r14), %r14d	# 5489	[c=13 l=5]  *zero_extendqisi2/0
+	movl	%ecx, %r8d	# 15406	[c=4 l=3]  *movsi_internal/0
+	movl	%ecx, %r9d	# 13229	[c=4 l=3]  *movsi_internal/0
+	notl	%ecx	# 5490	[c=4 l=2]  *one_cmplsi2_1/0
+	andl	%r13d, %r8d	# 14932	[c=4 l=3]  *andsi_1/0
+	andl	$192, %r9d	# 5486	[c=4 l=7]  *andsi_1/0
+	movq	%rdx, 104(%rbx)	# 5510	[c=4 l=4]  *movdi_internal/5
+	movq	%r15, %rdx	# 15407	[c=4 l=3]  *movdi_internal/3
+	andl	%r14d, %ecx	# 5491	[c=4 l=3]  *andsi_1/0
+	andl	%r9d, %r13d	# 14933	[c=4 l=3]  *andsi_1/0
+	salq	$4, %r15	# 5513	[c=4 l=4]  *ashldi3_1/0
+	orl	$63, %r9d	# 14935	[c=4 l=4]  *iorsi_1/0
+	orl	%r8d, %ecx	# 5494	[c=4 l=3]  *iorsi_1/0
+	addq	1064(%rbx), %r15	# 5515	[c=13 l=7]  *adddi_1/1
+	movb	%r9b, 100(%rbx)	# 5508	[c=4 l=4]  *movqi_internal/8
+	orl	$-3, %ecx	# 5495	[c=4 l=3]  *iorsi_1/0
+	andb	(%rax,%rsi), %cl	# 5503	[c=13 l=3]  *andqi_1/1
+	orl	%r13d, %ecx	# 14934	[c=4 l=3]  *iorsi_1/0
+	movb	%cl, 101(%rbx)	# 5506	[c=4 l=3]  *movqi_internal/8
+	movzbl	9(%r15), %eax	# 5516	[c=13 l=5]  *zero_extendqisi2/0
+	movq	%r10, %rcx	# 16140	[c=4 l=3]  *movdi_internal/3
+	movq	(%r15), %r14	# 5519	[c=5 l=3]  *movdi_internal/3
+	addl	%edx, %eax	# 5517	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 16141	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 5518	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 16142	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 16143	[c=4 l=3]  *indirect_jump
+.L1169:
+	movq	%rbx, %rdi	# 9509	[c=4 l=3]  *movdi_internal/3
+	movzbl	10(%r15), %r13d	# 9508	[c=13 l=5]  zero_extendqidi2/0
+	call	pop_byte	# 9510	[c=10 l=5]  *call_value
+	movq	1040(%rbx), %rdx	# 9513	[c=9 l=7]  *movdi_internal/3
+	movb	%al, (%rdx,%r13)	# 9514	[c=4 l=4]  *movqi_internal/8
+	movl	(%rbx), %r15d	# 9515	[c=6 l=3]  *zero_extendsidi2/3
+	movq	%r15, %rax	# 15509	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 9517	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 9519	[c=13 l=7]  *adddi_1/1
+	addl	$1, %eax	# 9520	[c=4 l=3]  *addsi_1/0
+	movl	%eax, (%rbx)	# 9521	[c=4 l=2]  *movsi_internal/1
+.L859:
+	movq	%rbx, %rdi	# 4395	[c=4 l=3]  *movdi_internal/3
+	movzbl	10(%r15), %r13d	# 4394	[c=13 l=5]  zero_extendqidi2/0
+	call	pop_byte	# 4396	[c=10 l=5]  *call_value
+	movq	1040(%rbx), %rdx	# 4399	[c=9 l=7]  *movdi_internal/3
+	leaq	flag_update_table_add8(%rip), %r10	# 14158	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_sub8(%rip), %r11	# 14160	[c=1 l=7]  *movdi_internal/4
+	movq	%r10, %rcx	# 16204	[c=4 l=3]  *movdi_internal/3
+	movb	%al, (%rdx,%r13)	# 4400	[c=4 l=4]  *movqi_internal/8
+	movl	(%rbx), %r15d	# 4401	[c=6 l=3]  *zero_extendsidi2/3
+	movq	%r15, %rdx	# 15392	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 4403	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 4405	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%r15), %eax	# 4406	[c=13 l=5]  *zero_extendqisi2/0
+	movq	(%r15), %r14	# 4409	[c=5 l=3]  *movdi_internal/3
+	addl	%edx, %eax	# 4407	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 16205	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 4408	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 16206	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 16207	[c=4 l=3]  *indirect_jump
+.L1079:
+	movzbl	10(%r15), %eax	# 7285	[c=13 l=5]  zero_extendqidi2/0
+	movzwl	12(%r15), %ecx	# 7287	[c=9 l=5]  *movhi_internal/2
+	movq	1040(%rbx), %rdx	# 7286	[c=9 l=7]  *movdi_internal/3
+	movb	%cl, (%rdx,%rax)	# 7288	[c=4 l=3]  *movqi_internal/8
+	movl	(%rbx), %r15d	# 7289	[c=6 l=3]  *zero_extendsidi2/3
+	movq	%r15, %rax	# 15454	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 7291	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 7293	[c=13 l=7]  *adddi_1/1
+	addl	$1, %eax	# 7294	[c=4 l=3]  *addsi_1/0
+	movl	%eax, (%rbx)	# 7295	[c=4 l=2]  *movsi_internal/1
+.L789:
+	movzbl	10(%r15), %eax	# 3371	[c=13 l=5]  zero_extendqidi2/0
+	movzwl	12(%r15), %ecx	# 3373	[c=9 l=5]  *movhi_internal/2
+	movq	1040(%rbx), %rdx	# 3372	[c=9 l=7]  *movdi_internal/3
+	movb	%cl, (%rdx,%rax)	# 3374	[c=4 l=3]  *movqi_internal/8
+	movl	(%rbx), %r15d	# 3375	[c=6 l=3]  *zero_extendsidi2/3
+	movq	%r10, %rcx	# 16412	[c=4 l=3]  *movdi_internal/3
+	movq	%r15, %rdx	# 15356	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 3377	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 3379	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%r15), %eax	# 3380	[c=13 l=5]  *zero_extendqisi2/0
+	movq	(%r15), %r14	# 3383	[c=5 l=3]  *movdi_internal/3
+	addl	%edx, %eax	# 3381	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 16413	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 3382	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 16414	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 16415	[c=4 l=3]  *indirect_jump
+.L1155:
+	movzbl	10(%r15), %eax	# 9363	[c=13 l=5]  zero_extendqidi2/0
+	movq	1040(%rbx), %r13	# 9362	[c=9 l=7]  *movdi_internal/3
+	movl	5176(%rbx), %r14d	# 9365	[c=9 l=7]  *movsi_internal/0
+	movl	5180(%rbx), %r15d	# 9366	[c=9 l=7]  *movsi_internal/0
+	movzbl	0(%r13,%rax), %ecx	# 9364	[c=9 l=6]  *movqi_internal/4
+	movl	$93, %eax	# 9367	[c=4 l=5]  *movsi_internal/0
+	subl	%r14d, %eax	# 9368	[c=4 l=3]  *subsi_1/0
+	cmpl	%r15d, %eax	# 9369	[c=4 l=3]  *cmpsi_1/0
+	jb	.L1156	# 9370	[c=13 l=6]  *jcc
+	cmpb	$1, 1082(%rbx)	# 9374	[c=13 l=7]  *cmpqi_1/0
+	ja	.L1553	# 9375	[c=13 l=6]  *jcc
+	movzbl	93(%r13), %edx	# 11259	[c=13 l=5]  *zero_extendqisi2/0
+.L1158:
+	movzbl	94(%r13), %eax	# 9410	[c=13 l=5]  *zero_extendqisi2/0
+.L1160:
+	sall	$8, %eax	# 9413	[c=4 l=3]  *ashlsi3_1/0
+	orl	%edx, %eax	# 9414	[c=4 l=2]  *iorsi_1/0
+	movslq	%eax, %rsi	# 13669	[c=4 l=3]  *extendsidi2_rex64/1
+	cmpl	996(%rbx), %esi	# 9416	[c=13 l=6]  *cmpsi_1/1
+	jb	.L1554	# 9417	[c=13 l=6]  *jcc
+	movl	%esi, %edx	# 13670	[c=4 l=2]  *movsi_internal/0
+	leal	-1(%rsi), %eax	# 14775	[c=4 l=3]  *leasi
+	subl	%r14d, %edx	# 9426	[c=4 l=3]  *subsi_1/0
+	cmpl	%r15d, %edx	# 9427	[c=4 l=3]  *cmpsi_1/0
+	jb	.L1162	# 9428	[c=13 l=2]  *jcc
+	movl	%esi, %edx	# 13672	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %edx	# 9430	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %edx	# 12696	[c=5 l=6]  *andsi_1_zext
+	cmpb	$0, 1080(%rbx,%rdx)	# 9433	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L1163	# 9434	[c=13 l=6]  *jcc
+.L1162:
+	movb	%cl, 0(%r13,%rsi)	# 9438	[c=4 l=5]  *movqi_internal/8
+.L1164:
+	movl	$93, %edx	# 9450	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%rbx), %edx	# 9451	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %edx	# 9452	[c=13 l=6]  *cmpsi_1/1
+	jb	.L1165	# 9453	[c=13 l=2]  *jcc
+	cmpb	$1, 1082(%rbx)	# 9457	[c=13 l=7]  *cmpqi_1/0
+	ja	.L1555	# 9458	[c=13 l=6]  *jcc
+.L1165:
+	movq	1040(%rbx), %rdx	# 9469	[c=9 l=7]  *movdi_internal/3
+	movb	%al, 93(%rdx)	# 9470	[c=4 l=3]  *movqi_internal/8
+.L1166:
+	movl	$94, %edx	# 9474	[c=4 l=5]  *movsi_internal/0
+	sarl	$8, %eax	# 9473	[c=4 l=3]  *ashrsi3_1/0
+	subl	5176(%rbx), %edx	# 9475	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %edx	# 9476	[c=13 l=6]  *cmpsi_1/1
+	jb	.L1167	# 9477	[c=13 l=2]  *jcc
+	cmpb	$1, 1082(%rbx)	# 9481	[c=13 l=7]  *cmpqi_1/0
+	ja	.L1556	# 9482	[c=13 l=6]  *jcc
+.L1167:
+	movq	1040(%rbx), %rdx	# 9493	[c=9 l=7]  *movdi_internal/3
+	movb	%al, 94(%rdx)	# 9494	[c=4 l=3]  *movqi_internal/8
+.L1168:
+	movl	(%rbx), %r15d	# 9497	[c=6 l=3]  *zero_extendsidi2/3
+	movq	%r15, %rax	# 15508	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 9499	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 9501	[c=13 l=7]  *adddi_1/1
+	addl	$1, %eax	# 9502	[c=4 l=3]  *addsi_1/0
+	movl	%eax, (%rbx)	# 9503	[c=4 l=2]  *movsi_internal/1
+.L860:
+	movzbl	10(%r15), %eax	# 4415	[c=13 l=5]  zero_extendqidi2/0
+	movq	1040(%rbx), %r13	# 4414	[c=9 l=7]  *movdi_internal/3
+	movl	5176(%rbx), %r14d	# 4417	[c=9 l=7]  *movsi_internal/0
+	movl	5180(%rbx), %r15d	# 4418	[c=9 l=7]  *movsi_internal/0
+	movzbl	0(%r13,%rax), %ecx	# 4416	[c=9 l=6]  *movqi_internal/4
+	movl	$93, %eax	# 4419	[c=4 l=5]  *movsi_internal/0
+	subl	%r14d, %eax	# 4420	[c=4 l=3]  *subsi_1/0
+	cmpl	%r15d, %eax	# 4421	[c=4 l=3]  *cmpsi_1/0
+	jb	.L861	# 4422	[c=13 l=6]  *jcc
+	cmpb	$1, 1082(%rbx)	# 4426	[c=13 l=7]  *cmpqi_1/0
+	ja	.L1557	# 4427	[c=13 l=6]  *jcc
+	movzbl	93(%r13), %edx	# 11236	[c=13 l=5]  *zero_extendqisi2/0
+.L863:
+	movzbl	94(%r13), %eax	# 4462	[c=13 l=5]  *zero_extendqisi2/0
+.L865:
+	sall	$8, %eax	# 4465	[c=4 l=3]  *ashlsi3_1/0
+	orl	%edx, %eax	# 4466	[c=4 l=2]  *iorsi_1/0
+	cmpl	996(%rbx), %eax	# 4468	[c=13 l=6]  *cmpsi_1/1
+	jb	.L1419	# 4469	[c=13 l=6]  *jcc
+	movl	%eax, %edx	# 13164	[c=4 l=2]  *movsi_internal/0
+	leal	-1(%rax), %r8d	# 14956	[c=4 l=4]  *leasi
+	subl	%r14d, %edx	# 4478	[c=4 l=3]  *subsi_1/0
+	cmpl	%r15d, %edx	# 4479	[c=4 l=3]  *cmpsi_1/0
+	jb	.L867	# 4480	[c=13 l=2]  *jcc
+	movl	%eax, %edx	# 13166	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %edx	# 4482	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %edx	# 12710	[c=5 l=6]  *andsi_1_zext
+	cmpb	$0, 1080(%rbx,%rdx)	# 4485	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L868	# 4486	[c=13 l=6]  *jcc
+.L867:
+	cltq	# 4489	[c=4 l=2]  *extendsidi2_rex64/0
+	movb	%cl, 0(%r13,%rax)	# 4490	[c=4 l=5]  *movqi_internal/8
+.L869:
+	movl	$93, %eax	# 4502	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%rbx), %eax	# 4503	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %eax	# 4504	[c=13 l=6]  *cmpsi_1/1
+	jb	.L870	# 4505	[c=13 l=2]  *jcc
+	cmpb	$1, 1082(%rbx)	# 4509	[c=13 l=7]  *cmpqi_1/0
+	ja	.L1558	# 4510	[c=13 l=6]  *jcc
+.L870:
+	movq	1040(%rbx), %rax	# 4521	[c=9 l=7]  *movdi_internal/3
+	movb	%r8b, 93(%rax)	# 4522	[c=4 l=4]  *movqi_internal/8
+.L871:
+	movl	%r8d, %eax	# 13168	[c=4 l=3]  *movsi_internal/0
+	movl	$94, %edx	# 4526	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%rbx), %edx	# 4527	[c=13 l=6]  *subsi_1/1
+	sarl	$8, %eax	# 4525	[c=4 l=3]  *ashrsi3_1/0
+	cmpl	5180(%rbx), %edx	# 4528	[c=13 l=6]  *cmpsi_1/1
+	jb	.L872	# 4529	[c=13 l=2]  *jcc
+	cmpb	$1, 1082(%rbx)	# 4533	[c=13 l=7]  *cmpqi_1/0
+	ja	.L1559	# 4534	[c=13 l=6]  *jcc
+.L872:
+	movq	1040(%rbx), %rdx	# 4545	[c=9 l=7]  *movdi_internal/3
+	movb	%al, 94(%rdx)	# 4546	[c=4 l=3]  *movqi_internal/8
+.L873:
+	movl	(%rbx), %r15d	# 4549	[c=6 l=3]  *zero_extendsidi2/3
+	movq	%r10, %rcx	# 16196	[c=4 l=3]  *movdi_internal/3
+	movq	%r15, %rdx	# 15393	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 4551	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 4553	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%r15), %eax	# 4554	[c=13 l=5]  *zero_extendqisi2/0
+	movq	(%r15), %r14	# 4557	[c=5 l=3]  *movdi_internal/3
+	addl	%edx, %eax	# 4555	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 16197	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 4556	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 16198	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 16199	[c=4 l=3]  *indirect_jump
+.L1551:
+	xorl	%eax, %eax	# 16906	[c=4 l=2]  *movsi_xor
+	movq	%rbx, %rdi	# 1167	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, 96(%rbx)	# 16907	[c=4 l=3]  *movsi_internal/1
+	call	do_events	# 1168	[c=0 l=5]  *call
+	movq	48(%rbx), %rdx	# 1169	[c=9 l=4]  *movdi_internal/3
+	leaq	flag_update_table_sub8(%rip), %r11	# 13886	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 13884	[c=1 l=7]  *movdi_internal/4
+	jmp	.L624	# 16959	[c=1 l=5]  jump
+.L1552:
+	xorl	%r15d, %r15d	# 16904	[c=4 l=3]  *movsi_xor
+	movq	%rbx, %rdi	# 1228	[c=4 l=3]  *movdi_internal/3
+	movl	%r15d, 96(%rbx)	# 16905	[c=4 l=4]  *movsi_internal/1
+	call	do_events	# 1229	[c=0 l=5]  *call
+	leaq	flag_update_table_sub8(%rip), %r11	# 13890	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 13888	[c=1 l=7]  *movdi_internal/4
+	jmp	.L627	# 16961	[c=1 l=5]  jump
+.L1550:
+	cmpq	$0, 10960(%rbx)	# 135	[c=13 l=8]  *cmpdi_ccno_1/1
+	je	.L555	# 136	[c=13 l=2]  *jcc
+	movl	116(%rbx), %esi	# 138	[c=9 l=3]  *movsi_internal/0
+	movq	%rbx, %rdi	# 141	[c=4 l=3]  *movdi_internal/3
+	call	jit_forget@PLT	# 142	[c=0 l=5]  *call
+	leaq	flag_update_table_sub8(%rip), %r11	# 13843	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 13841	[c=1 l=7]  *movdi_internal/4
+.L555:
+	movl	116(%rbx), %r15d	# 145	[c=9 l=4]  *movsi_internal/0
+	leaq	handler.2(%rip), %r14	# 11452	[c=1 l=7]  *movdi_internal/4
+	leaq	.L558(%rip), %rbp	# 167	[c=1 l=7]  *movdi_internal/4
+	leaq	.L573(%rip), %r13	# 292	[c=1 l=7]  *movdi_internal/4
+	cmpl	120(%rbx), %r15d	# 146	[c=13 l=4]  *cmpsi_1/1
+	jnb	.L574	# 147	[c=13 l=6]  *jcc
+	movq	%r12, (%rsp)	# 12758	[c=4 l=4]  *movdi_internal/5
+	movq	%r14, %r12	# 12759	[c=4 l=3]  *movdi_internal/3
+	jmp	.L556	# 16963	[c=1 l=2]  jump
+	.p2align 4,,10
+	.p2align 3
+.L1562:
+	movq	%rbp, (%r14)	# 168	[c=4 l=3]  *movdi_internal/5
+.L559:
+	movl	584(%rbx), %eax	# 16939	[c=9 l=6]  *movsi_internal/0
+	testl	%eax, %eax	# 16940	[c=4 l=2]  *cmpsi_ccno_1/0
+	jne	.L1560	# 276	[c=13 l=2]  *jcc
+.L571:
+	addl	$1, %r15d	# 296	[c=4 l=4]  *addsi_1/0
+	cmpl	120(%rbx), %r15d	# 297	[c=13 l=4]  *cmpsi_1/1
+	jnb	.L1561	# 298	[c=13 l=6]  *jcc
+.L556:
+	movl	%r15d, %r14d	# 155	[c=1 l=3]  *zero_extendsidi2/3
+	salq	$4, %r14	# 156	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r14	# 158	[c=13 l=7]  *adddi_1/1
+	movzbl	8(%r14), %eax	# 161	[c=13 l=5]  zero_extendqidi2/0
+	cmpb	$0, 11(%r14)	# 164	[c=13 l=5]  *cmpqi_ccno_1/1
+	movq	(%r12,%rax,8), %rax	# 162	[c=10 l=4]  *movdi_internal/3
+	movq	%rax, (%r14)	# 163	[c=4 l=3]  *movdi_internal/5
+	je	.L1562	# 165	[c=13 l=2]  *jcc
+	movl	552(%rbx), %ecx	# 16943	[c=9 l=6]  *movsi_internal/0
+	testl	%ecx, %ecx	# 16944	[c=4 l=2]  *cmpsi_ccno_1/0
+	jne	.L1563	# 174	[c=13 l=6]  *jcc
+.L560:
+	cmpq	$0, 10960(%rbx)	# 190	[c=13 l=8]  *cmpdi_ccno_1/1
+	je	.L562	# 191	[c=13 l=2]  *jcc
+	movl	%r15d, %esi	# 193	[c=4 l=3]  *movsi_internal/0
+	movq	%rbx, %rdi	# 194	[c=4 l=3]  *movdi_internal/3
+	call	jit_candidate@PLT	# 195	[c=10 l=5]  *call_value
+	leaq	flag_update_table_add8(%rip), %r10	# 13847	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_sub8(%rip), %r11	# 13849	[c=1 l=7]  *movdi_internal/4
+	testb	%al, %al	# 197	[c=4 l=2]  *cmpqi_ccno_1/0
+	je	.L562	# 198	[c=13 l=2]  *jcc
+	leaq	.L563(%rip), %rax	# 201	[c=1 l=7]  *movdi_internal/4
+	movq	%rax, (%r14)	# 12842	[c=4 l=3]  *movdi_internal/5
+	jmp	.L559	# 16969	[c=1 l=2]  jump
+	.p2align 4,,10
+	.p2align 3
+.L1560:
+	movl	%r15d, %esi	# 282	[c=4 l=3]  *movsi_internal/0
+	movq	%rbx, %rdi	# 283	[c=4 l=3]  *movdi_internal/3
+	call	hle_routine@PLT	# 284	[c=10 l=5]  *call_value
+	leaq	flag_update_table_add8(%rip), %r10	# 13855	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_sub8(%rip), %r11	# 13857	[c=1 l=7]  *movdi_internal/4
+	testq	%rax, %rax	# 287	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L571	# 288	[c=13 l=6]  *jcc
+	movq	(%r14), %rcx	# 290	[c=5 l=3]  *movdi_internal/3
+	movq	%rcx, 40(%rax)	# 291	[c=4 l=4]  *movdi_internal/5
+	movq	%r13, (%r14)	# 293	[c=4 l=3]  *movdi_internal/5
+	jmp	.L571	# 16971	[c=1 l=5]  jump
+	.p2align 4,,10
+	.p2align 3
+.L562:
+	movl	536(%rbx), %edx	# 16941	[c=9 l=6]  *movsi_internal/0
+	testl	%edx, %edx	# 16942	[c=4 l=2]  *cmpsi_ccno_1/0
+	je	.L564	# 207	[c=13 l=2]  *jcc
+	leaq	.L565(%rip), %rax	# 210	[c=1 l=7]  *movdi_internal/4
+	movq	%rax, (%r14)	# 12843	[c=4 l=3]  *movdi_internal/5
+	jmp	.L559	# 16973	[c=1 l=5]  jump
+.L1563:
+	leaq	108(%rsp), %rsi	# 15071	[c=4 l=5]  *leadi
+	movq	%r14, %rdi	# 178	[c=4 l=3]  *movdi_internal/3
+	call	delay_loop	# 179	[c=10 l=5]  *call_value
+	leaq	flag_update_table_add8(%rip), %r10	# 13845	[c=1 l=7]  *movdi_internal/4
+	testl	%eax, %eax	# 181	[c=4 l=2]  *cmpsi_ccno_1/0
+	je	.L560	# 182	[c=13 l=6]  *jcc
+	leaq	.L561(%rip), %rax	# 185	[c=1 l=7]  *movdi_internal/4
+	movq	%rax, (%r14)	# 12841	[c=4 l=3]  *movdi_internal/5
+	jmp	.L559	# 16975	[c=1 l=5]  jump
+.L564:
+	cmpl	$0, 520(%rbx)	# 215	[c=13 l=7]  *cmpsi_ccno_1/1
+	je	.L559	# 216	[c=13 l=6]  *jcc
+	cmpb	$0, 11(%r14)	# 218	[c=13 l=5]  *cmpqi_ccno_1/1
+	je	.L559	# 219	[c=13 l=6]  *jcc
+	movzbl	8(%r14), %ecx	# 221	[c=9 l=5]  *movqi_internal/4
+	cmpb	$25, %cl	# 224	[c=4 l=3]  *cmpqi_1/0
+	jbe	.L1564	# 225	[c=13 l=6]  *jcc
+	subl	$28, %ecx	# 15068	[c=4 l=3]  *addsi_1/0
+	cmpb	$60, %cl	# 256	[c=4 l=3]  *cmpqi_1/0
+	ja	.L568	# 257	[c=13 l=2]  *jcc
+	movabsq	$2303723150795361347, %rax	# 231	[c=1 l=10]  *movdi_internal/4
+	shrq	%cl, %rax	# 232	[c=4 l=3]  *lshrdi3_1/0
+	testb	$1, %al	# 15070	[c=4 l=2]  *testqi_1_maybe_si/1
+	jne	.L559	# 235	[c=13 l=6]  *jcc
+.L568:
+	movq	%r14, %rsi	# 260	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rdi	# 261	[c=4 l=3]  *movdi_internal/3
+	call	fuse_lookup	# 262	[c=10 l=5]  *call_value
+	leaq	flag_update_table_add8(%rip), %r10	# 13851	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_sub8(%rip), %r11	# 13853	[c=1 l=7]  *movdi_internal/4
+	testl	%eax, %eax	# 266	[c=4 l=2]  *cmpsi_ccno_1/0
+	js	.L559	# 267	[c=13 l=6]  *jcc
+	cltq	# 270	[c=4 l=2]  *extendsidi2_rex64/0
+	leaq	fused.1(%rip), %rcx	# 12725	[c=1 l=7]  *movdi_internal/4
+	movq	(%rcx,%rax,8), %rax	# 271	[c=10 l=4]  *movdi_internal/3
+	movq	%rax, (%r14)	# 272	[c=4 l=3]  *movdi_internal/5
+	jmp	.L559	# 16978	[c=1 l=5]  jump
+.L1561:
+	movq	(%rsp), %r12	# 12761	[c=5 l=4]  *movdi_internal/3
+.L574:
+	movq	$0, 116(%rbx)	# 150	[c=4 l=8]  *movv2si_internal/4
+	jmp	.L554	# 16980	[c=1 l=5]  jump
+.L1548:
+	call	jit_init@PLT	# 90	[c=10 l=5]  *call_value
+	testb	%al, %al	# 93	[c=4 l=2]  *cmpqi_ccno_1/0
+	jne	.L550	# 94	[c=13 l=6]  *jcc
+	leaq	.LC42(%rip), %rsi	# 96	[c=1 l=7]  *movdi_internal/4
+	movq	%rbx, %rdi	# 98	[c=4 l=3]  *movdi_internal/3
+	call	qprintf	# 100	[c=0 l=5]  *call
+	jmp	.L550	# 16982	[c=1 l=5]  jump
+.L1038:
+	movzbl	%cl, %edx	# 6625	[c=4 l=3]  *zero_extendqisi2/0
+	movl	%r13d, %esi	# 6627	[c=4 l=3]  *movsi_internal/0
+	movq	%rbx, %rdi	# 6628	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 6629	[c=0 l=5]  *call
+	leaq	flag_update_table_sub8(%rip), %r11	# 14432	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 14430	[c=1 l=7]  *movdi_internal/4
+	jmp	.L1039	# 16984	[c=1 l=5]  jump
+.L861:
+	movl	$94, %eax	# 4443	[c=4 l=5]  *movsi_internal/0
+	movzbl	93(%r13), %edx	# 4442	[c=13 l=5]  *zero_extendqisi2/0
+	subl	%r14d, %eax	# 4444	[c=4 l=3]  *subsi_1/0
+	cmpl	%r15d, %eax	# 4445	[c=4 l=3]  *cmpsi_1/0
+	jb	.L863	# 4446	[c=13 l=6]  *jcc
+	cmpb	$1, 1082(%rbx)	# 4450	[c=13 l=7]  *cmpqi_1/0
+	jbe	.L863	# 4451	[c=13 l=6]  *jcc
+.L864:
+	movl	$94, %esi	# 4454	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 4455	[c=4 l=3]  *movdi_internal/3
+	movl	%edx, 24(%rsp)	# 14169	[c=4 l=4]  *movsi_internal/1
+	movb	%cl, 16(%rsp)	# 14167	[c=4 l=4]  *movqi_internal/8
+	call	data_read_mapped	# 4456	[c=10 l=5]  *call_value
+	movzbl	16(%rsp), %ecx	# 14168	[c=9 l=5]  *movqi_internal/4
+	movl	24(%rsp), %edx	# 14170	[c=9 l=4]  *movsi_internal/0
+	leaq	flag_update_table_add8(%rip), %r10	# 14172	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_sub8(%rip), %r11	# 14174	[c=1 l=7]  *movdi_internal/4
+	jmp	.L865	# 16986	[c=1 l=5]  jump
+.L1054:
+	movzbl	%sil, %edx	# 6815	[c=4 l=4]  *zero_extendqisi2/0
+	movq	%rbx, %rdi	# 6818	[c=4 l=3]  *movdi_internal/3
+	movl	%r13d, %esi	# 6817	[c=4 l=3]  *movsi_internal/0
+	call	data_write_page	# 6819	[c=0 l=5]  *call
+	leaq	flag_update_table_sub8(%rip), %r11	# 14452	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 14450	[c=1 l=7]  *movdi_internal/4
+	jmp	.L1055	# 16988	[c=1 l=5]  jump
+.L662:
+	movzbl	10(%r15), %eax	# 1639	[c=13 l=5]  zero_extendqidi2/0
+	addq	1040(%rbx), %rax	# 1641	[c=13 l=7]  *adddi_1/1
+	leaq	flag_update_table_logical(%rip), %rsi	# 12730	[c=1 l=7]  *movdi_internal/4
+	movzbl	(%rax), %edx	# 12931	[c=5 l=3]  *movqi_internal/4
+	notl	%edx	# 15024	[c=4 l=2]  *one_cmplsi2_1/0
+	movb	%dl, (%rax)	# 1644	[c=4 l=2]  *movqi_internal/8
+	movq	104(%rbx), %rcx	# 1647	[c=9 l=4]  *movdi_internal/3
+	movzbl	%dl, %edx	# 1651	[c=4 l=3]  zero_extendqidi2/0
+	movzbl	100(%rbx), %eax	# 1645	[c=13 l=4]  *zero_extendqisi2/0
+	movl	(%rbx), %r15d	# 1659	[c=6 l=3]  *zero_extendsidi2/3
+	movzbl	(%rcx), %edi	# 16895	[c=5 l=3]  *movqi_internal/4
+	andl	$-32, %eax	# 1646	[c=4 l=3]  *andsi_1/0
+	andl	%eax, %edi	# 17547	[c=4 l=2]  *andsi_1/0
+	orl	$31, %eax	# 15026	[c=4 l=3]  *iorsi_1/0
+	movl	%edi, %ecx	# 12934	[c=4 l=2]  *movqi_internal/1
+	orb	(%rsi,%rdx), %cl	# 1652	[c=13 l=3]  *iorqi_1/1
+	movb	%al, 100(%rbx)	# 1656	[c=4 l=3]  *movqi_internal/8
+	movl	%ecx, %edx	# 12936	[c=4 l=2]  *movqi_internal/0
+	movq	%r10, %rcx	# 16588	[c=4 l=3]  *movdi_internal/3
+	orl	$1, %edx	# 15025	[c=4 l=3]  *iorsi_1/0
+	movb	%dl, 101(%rbx)	# 1654	[c=4 l=3]  *movqi_internal/8
+	leaq	101(%rbx), %rdx	# 15027	[c=4 l=4]  *leadi
+	movq	%rdx, 104(%rbx)	# 1658	[c=4 l=4]  *movdi_internal/5
+	movq	%r15, %rdx	# 15332	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 1661	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 1663	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%r15), %eax	# 1664	[c=13 l=5]  *zero_extendqisi2/0
+	movq	(%r15), %r14	# 1667	[c=5 l=3]  *movdi_internal/3
+	addl	%edx, %eax	# 1665	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 16589	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 1666	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 16590	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 16591	[c=4 l=3]  *indirect_jump
+.L663:
+	movq	1040(%rbx), %rdx	# 1672	[c=9 l=7]  *movdi_internal/3
+	movzwl	12(%r15), %ecx	# 1675	[c=13 l=5]  zero_extendhidi2/0
+	movzbl	10(%r15), %eax	# 1673	[c=13 l=5]  zero_extendqidi2/0
+	movzbl	(%rdx,%rcx), %esi	# 1676	[c=13 l=4]  *zero_extendqisi2/0
+	movzbl	(%rdx,%rax), %eax	# 1674	[c=9 l=4]  *movqi_internal/4
+	movl	%esi, %edx	# 12939	[c=4 l=2]  *movsi_internal/0
+	movl	%eax, %ecx	# 12937	[c=4 l=2]  *movsi_internal/0
+	andl	$136, %edx	# 1681	[c=4 l=6]  *andsi_1/0
+	andl	$136, %ecx	# 1678	[c=4 l=6]  *andsi_1/0
+	leal	(%rdx,%rcx,2), %ecx	# 1682	[c=8 l=3]  *leasi
+	movzbl	%al, %edx	# 1683	[c=4 l=3]  *zero_extendqisi2/0
+	imull	$260, %ecx, %eax	# 1687	[c=12 l=6]  *mulsi3_1/1
+	subl	%esi, %edx	# 1685	[c=4 l=2]  *subsi_1/0
+	movzbl	100(%rbx), %ecx	# 1690	[c=9 l=4]  *movqi_internal/4
+	andl	$511, %edx	# 1686	[c=4 l=6]  *andsi_1/0
+	andl	$7680, %eax	# 1688	[c=4 l=5]  *andsi_1/0
+	orl	%eax, %edx	# 1689	[c=5 l=2]  *iorsi_1_zext
+	movl	%ecx, %eax	# 12941	[c=4 l=2]  *movsi_internal/0
+	andl	$192, %eax	# 1693	[c=4 l=5]  *andsi_2/0
+	jne	.L664	# 1694	[c=13 l=6]  *jcc
+	leaq	flag_update_table_sub8(%rip), %rax	# 1697	[c=1 l=7]  *movdi_internal/4
+	movl	$63, %ecx	# 13	[c=4 l=5]  *movqi_internal/3
+	addq	%rdx, %rax	# 1698	[c=4 l=3]  *adddi_1/0
+.L665:
+	movl	(%rbx), %r15d	# 1717	[c=6 l=3]  *zero_extendsidi2/3
+	movb	%cl, 100(%rbx)	# 1716	[c=4 l=3]  *movqi_internal/8
+	movq	%r10, %rcx	# 16580	[c=4 l=3]  *movdi_internal/3
+	movq	%rax, 104(%rbx)	# 1715	[c=4 l=4]  *movdi_internal/5
+	movq	%r15, %rdx	# 15333	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 1719	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 1721	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%r15), %eax	# 1722	[c=13 l=5]  *zero_extendqisi2/0
+	movq	(%r15), %r14	# 1725	[c=5 l=3]  *movdi_internal/3
+	addl	%edx, %eax	# 1723	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 16581	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 1724	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 16582	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 16583	[c=4 l=3]  *indirect_jump
+.L667:
+	movq	1040(%rbx), %rdx	# 1789	[c=9 l=7]  *movdi_internal/3
+	movzbl	10(%r15), %eax	# 1788	[c=13 l=5]  zero_extendqidi2/0
+	movzwl	12(%r15), %esi	# 1787	[c=9 l=5]  *movhi_internal/2
+	movzbl	(%rdx,%rax), %eax	# 1790	[c=9 l=4]  *movqi_internal/4
+	movl	%esi, %edx	# 12957	[c=4 l=2]  *movsi_internal/0
+	movl	%eax, %ecx	# 12955	[c=4 l=2]  *movsi_internal/0
+	andl	$136, %edx	# 1795	[c=4 l=6]  *andsi_1/0
+	andl	$136, %ecx	# 1792	[c=4 l=6]  *andsi_1/0
+	leal	(%rdx,%rcx,2), %ecx	# 1796	[c=8 l=3]  *leasi
+	movzbl	%al, %edx	# 1797	[c=4 l=3]  *zero_extendqisi2/0
+	imull	$260, %ecx, %eax	# 1801	[c=12 l=6]  *mulsi3_1/1
+	subl	%esi, %edx	# 1799	[c=4 l=2]  *subsi_1/0
+	movzbl	100(%rbx), %ecx	# 1804	[c=9 l=4]  *movqi_internal/4
+	andl	$511, %edx	# 1800	[c=4 l=6]  *andsi_1/0
+	andl	$7680, %eax	# 1802	[c=4 l=5]  *andsi_1/0
+	orl	%eax, %edx	# 1803	[c=5 l=2]  *iorsi_1_zext
+	movl	%ecx, %eax	# 12959	[c=4 l=2]  *movsi_internal/0
+	andl	$192, %eax	# 1807	[c=4 l=5]  *andsi_2/0
+	jne	.L668	# 1808	[c=13 l=6]  *jcc
+	leaq	flag_update_table_sub8(%rip), %rax	# 1811	[c=1 l=7]  *movdi_internal/4
+	movl	$63, %ecx	# 14	[c=4 l=5]  *movqi_internal/3
+	addq	%rdx, %rax	# 1812	[c=4 l=3]  *adddi_1/0
+.L669:
+	movl	(%rbx), %r15d	# 1831	[c=6 l=3]  *zero_extendsidi2/3
+	movb	%cl, 100(%rbx)	# 1830	[c=4 l=3]  *movqi_internal/8
+	movq	%r10, %rcx	# 16564	[c=4 l=3]  *movdi_internal/3
+	movq	%rax, 104(%rbx)	# 1829	[c=4 l=4]  *movdi_internal/5
+	movq	%r15, %rdx	# 15336	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 1833	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 1835	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%r15), %eax	# 1836	[c=13 l=5]  *zero_extendqisi2/0
+	movq	(%r15), %r14	# 1839	[c=5 l=3]  *movdi_internal/3
+	addl	%edx, %eax	# 1837	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 16565	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 1838	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 16566	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 16567	[c=4 l=3]  *indirect_jump
+.L670:
+	movl	$2, 96(%rbx)	# 1844	[c=4 l=7]  *movsi_internal/1
+	movq	1040(%rbx), %rax	# 1845	[c=9 l=7]  *movdi_internal/3
+	movzwl	12(%r15), %edx	# 1847	[c=13 l=5]  zero_extendhidi2/0
+	movzbl	10(%r15), %ecx	# 1846	[c=13 l=5]  zero_extendqidi2/0
+	movzbl	(%rax,%rdx), %edi	# 12965	[c=9 l=4]  *movqi_internal/4
+	cmpb	%dil, (%rax,%rcx)	# 1849	[c=13 l=4]  *cmpqi_1/0
+	jne	.L671	# 1850	[c=13 l=2]  *jcc
+	movl	(%rbx), %eax	# 12966	[c=5 l=2]  *movsi_internal/0
+	addq	$1, 48(%rbx)	# 1858	[c=13 l=5]  *adddi_1/0
+	addl	$1, %eax	# 1853	[c=4 l=3]  *addsi_1/0
+	andl	992(%rbx), %eax	# 1856	[c=13 l=6]  *andsi_1/1
+	movl	%eax, (%rbx)	# 1857	[c=4 l=2]  *movsi_internal/1
+.L671:
+	movq	(%rsp), %rax	# 12967	[c=5 l=4]  *movdi_internal/3
+	subq	$1, %rax	# 1861	[c=4 l=4]  *adddi_1/0
+	cmpq	%rbp, %rax	# 1862	[c=4 l=3]  *cmpdi_1/0
+	jb	.L620	# 1863	[c=13 l=6]  *jcc
+	movq	56(%rbx), %rax	# 12968	[c=9 l=4]  *movdi_internal/3
+	cmpq	%rax, 48(%rbx)	# 1866	[c=13 l=4]  *cmpdi_1/0
+	jnb	.L1565	# 1867	[c=13 l=6]  *jcc
+.L672:
+	movl	(%rbx), %r15d	# 1874	[c=6 l=3]  *zero_extendsidi2/3
+	movl	$1, 96(%rbx)	# 1879	[c=4 l=7]  *movsi_internal/1
+	movq	%r10, %rcx	# 16556	[c=4 l=3]  *movdi_internal/3
+	movq	%r15, %rdx	# 15337	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 1876	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 1878	[c=13 l=7]  *adddi_1/1
+	movzbl	11(%r15), %eax	# 1880	[c=13 l=5]  zero_extendqidi2/0
+	movq	(%r15), %r14	# 1888	[c=5 l=3]  *movdi_internal/3
+	addq	%rax, %rbp	# 1881	[c=4 l=3]  *adddi_1/0
+	movzwl	14(%r15), %eax	# 1883	[c=13 l=5]  zero_extendhidi2/0
+	addq	%rax, 48(%rbx)	# 1884	[c=13 l=4]  *adddi_1/0
+	movq	%rbp, 40(%rbx)	# 1882	[c=4 l=4]  *movdi_internal/5
+	movzbl	9(%r15), %eax	# 1885	[c=13 l=5]  *zero_extendqisi2/0
+	addl	%edx, %eax	# 1886	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 16557	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 1887	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 16558	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 16559	[c=4 l=3]  *indirect_jump
+.L673:
+	movl	$2, 96(%rbx)	# 1893	[c=4 l=7]  *movsi_internal/1
+	movq	1040(%rbx), %rax	# 1894	[c=9 l=7]  *movdi_internal/3
+	movzwl	12(%r15), %edx	# 1896	[c=13 l=5]  zero_extendhidi2/0
+	movzbl	10(%r15), %ecx	# 1895	[c=13 l=5]  zero_extendqidi2/0
+	movzbl	(%rax,%rdx), %edi	# 12969	[c=9 l=4]  *movqi_internal/4
+	cmpb	%dil, (%rax,%rcx)	# 1898	[c=13 l=4]  *cmpqi_1/0
+	jne	.L674	# 1899	[c=13 l=2]  *jcc
+	movl	(%rbx), %eax	# 12970	[c=5 l=2]  *movsi_internal/0
+	addq	$2, 48(%rbx)	# 1907	[c=13 l=5]  *adddi_1/0
+	addl	$2, %eax	# 1902	[c=4 l=3]  *addsi_1/0
+	andl	992(%rbx), %eax	# 1905	[c=13 l=6]  *andsi_1/1
+	movl	%eax, (%rbx)	# 1906	[c=4 l=2]  *movsi_internal/1
+.L674:
+	movq	(%rsp), %rax	# 12971	[c=5 l=4]  *movdi_internal/3
+	subq	$1, %rax	# 1910	[c=4 l=4]  *adddi_1/0
+	cmpq	%rbp, %rax	# 1911	[c=4 l=3]  *cmpdi_1/0
+	jb	.L620	# 1912	[c=13 l=6]  *jcc
+	movq	56(%rbx), %rax	# 12972	[c=9 l=4]  *movdi_internal/3
+	cmpq	%rax, 48(%rbx)	# 1915	[c=13 l=4]  *cmpdi_1/0
+	jnb	.L1566	# 1916	[c=13 l=6]  *jcc
+.L675:
+	movl	(%rbx), %r15d	# 1923	[c=6 l=3]  *zero_extendsidi2/3
+	movl	$1, 96(%rbx)	# 1928	[c=4 l=7]  *movsi_internal/1
+	movq	%r10, %rcx	# 16548	[c=4 l=3]  *movdi_internal/3
+	movq	%r15, %rdx	# 15338	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 1925	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 1927	[c=13 l=7]  *adddi_1/1
+	movzbl	11(%r15), %eax	# 1929	[c=13 l=5]  zero_extendqidi2/0
+	movq	(%r15), %r14	# 1937	[c=5 l=3]  *movdi_internal/3
+	addq	%rax, %rbp	# 1930	[c=4 l=3]  *adddi_1/0
+	movzwl	14(%r15), %eax	# 1932	[c=13 l=5]  zero_extendhidi2/0
+	addq	%rax, 48(%rbx)	# 1933	[c=13 l=4]  *adddi_1/0
+	movq	%rbp, 40(%rbx)	# 1931	[c=4 l=4]  *movdi_internal/5
+	movzbl	9(%r15), %eax	# 1934	[c=13 l=5]  *zero_extendqisi2/0
+	addl	%edx, %eax	# 1935	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 16549	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 1936	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 16550	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 16551	[c=4 l=3]  *indirect_jump
+.L676:
+	movzbl	10(%r15), %edx	# 1942	[c=13 l=5]  zero_extendqidi2/0
+	addq	1040(%rbx), %rdx	# 1944	[c=13 l=7]  *adddi_1/1
+	movzbl	(%rdx), %ecx	# 1945	[c=5 l=3]  *movqi_internal/4
+	leal	-1(%rcx), %eax	# 15014	[c=4 l=3]  *leasi
+	subl	$1, %ecx	# 15015	[c=4 l=3]  *addsi_1/0
+	movb	%cl, (%rdx)	# 1950	[c=4 l=2]  *movqi_internal/8
+	movzbl	100(%rbx), %edx	# 1951	[c=9 l=4]  *movqi_internal/4
+	movzbl	%al, %eax	# 1948	[c=4 l=3]  zero_extendqidi2/0
+	movl	%edx, %ecx	# 12973	[c=4 l=2]  *movsi_internal/0
+	andl	$225, %ecx	# 1954	[c=4 l=6]  *andsi_2/0
+	jne	.L677	# 1955	[c=13 l=6]  *jcc
+	leaq	flag_update_table_dec(%rip), %rdx	# 1958	[c=1 l=7]  *movdi_internal/4
+	addq	%rdx, %rax	# 1959	[c=4 l=3]  *adddi_1/0
+	movl	$30, %edx	# 15	[c=4 l=5]  *movqi_internal/3
+.L678:
+	movl	(%rbx), %r15d	# 1978	[c=6 l=3]  *zero_extendsidi2/3
+	movb	%dl, 100(%rbx)	# 1977	[c=4 l=3]  *movqi_internal/8
+	movq	%r10, %rcx	# 16540	[c=4 l=3]  *movdi_internal/3
+	movq	%rax, 104(%rbx)	# 1976	[c=4 l=4]  *movdi_internal/5
+	movq	%r15, %rdx	# 15339	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 1980	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 1982	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%r15), %eax	# 1983	[c=13 l=5]  *zero_extendqisi2/0
+	movq	(%r15), %r14	# 1986	[c=5 l=3]  *movdi_internal/3
+	addl	%edx, %eax	# 1984	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 16541	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 1985	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 16542	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 16543	[c=4 l=3]  *indirect_jump
+.L679:
+	movl	(%rbx), %eax	# 12975	[c=5 l=2]  *movsi_internal/0
+	movq	1056(%rbx), %rdx	# 1996	[c=9 l=7]  *movdi_internal/3
+	subl	$1, %eax	# 1992	[c=4 l=3]  *addsi_1/0
+	movl	%eax, (%rbx)	# 1993	[c=4 l=2]  *movsi_internal/1
+	addl	%eax, %eax	# 1994	[c=5 l=2]  *ashlsi3_1_zext/0
+	movzwl	(%rdx,%rax), %ecx	# 1997	[c=13 l=4]  *zero_extendhisi2/0
+.L1413:
+	movl	$1, 72(%rbx)	# 1998	[c=4 l=7]  *movsi_internal/1
+	leaq	.LC45(%rip), %rdx	# 2000	[c=1 l=7]  *movdi_internal/4
+	movq	%rbx, %rdi	# 2003	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 16890	[c=4 l=2]  *movdi_xor
+	movl	$8, %esi	# 2002	[c=4 l=5]  *movsi_internal/0
+	call	leave	# 2005	[c=0 l=5]  *call
+.L680:
+	cmpb	$0, 841(%rbx)	# 2010	[c=13 l=7]  *cmpqi_ccno_1/1
+	movl	$2, 96(%rbx)	# 2009	[c=4 l=7]  *movsi_internal/1
+	je	.L1417	# 2011	[c=13 l=6]  *jcc
+	movl	5176(%rbx), %r13d	# 2032	[c=9 l=7]  *movsi_internal/0
+	movl	$93, %eax	# 2036	[c=4 l=5]  *movsi_internal/0
+	movl	$94, %edx	# 2034	[c=4 l=5]  *movsi_internal/0
+	movl	5180(%rbx), %r14d	# 2033	[c=9 l=7]  *movsi_internal/0
+	subl	%r13d, %eax	# 2037	[c=4 l=3]  *subsi_1/0
+	subl	%r13d, %edx	# 2035	[c=4 l=3]  *subsi_1/0
+	cmpl	%r14d, %eax	# 2038	[c=4 l=3]  *cmpsi_1/0
+	jb	.L682	# 2039	[c=13 l=6]  *jcc
+	cmpb	$1, 1082(%rbx)	# 2043	[c=13 l=7]  *cmpqi_1/0
+	ja	.L1567	# 2044	[c=13 l=6]  *jcc
+	movq	1040(%rbx), %rax	# 11224	[c=9 l=7]  *movdi_internal/3
+	movzbl	93(%rax), %r15d	# 11225	[c=13 l=5]  *zero_extendqisi2/0
+.L684:
+	movzbl	94(%rax), %eax	# 2077	[c=13 l=4]  *zero_extendqisi2/0
+.L686:
+	sall	$8, %eax	# 2080	[c=4 l=3]  *ashlsi3_1/0
+	movl	996(%rbx), %edx	# 2083	[c=9 l=6]  *movsi_internal/0
+	orl	%eax, %r15d	# 2081	[c=4 l=3]  *iorsi_1/0
+	movzbl	840(%rbx), %eax	# 2085	[c=13 l=7]  *zero_extendqisi2/0
+	leal	1(%rdx,%rax), %eax	# 2086	[c=5 l=4]  *leasi
+	cmpl	%eax, %r15d	# 2087	[c=4 l=3]  *cmpsi_1/0
+	jb	.L1415	# 2088	[c=13 l=6]  *jcc
+	movl	%r15d, %edx	# 12977	[c=4 l=3]  *movsi_internal/0
+	movl	(%rbx), %ecx	# 2096	[c=5 l=2]  *movsi_internal/0
+	leal	-1(%r15), %eax	# 15011	[c=4 l=4]  *leasi
+	subl	%r13d, %edx	# 2098	[c=4 l=3]  *subsi_1/0
+	cmpl	%r14d, %edx	# 2099	[c=4 l=3]  *cmpsi_1/0
+	jb	.L688	# 2100	[c=13 l=2]  *jcc
+	movl	%r15d, %edx	# 12979	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %edx	# 2102	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %edx	# 12719	[c=5 l=6]  *andsi_1_zext
+	cmpb	$0, 1080(%rbx,%rdx)	# 2105	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L689	# 2106	[c=13 l=6]  *jcc
+.L688:
+	movq	1040(%rbx), %rsi	# 2110	[c=9 l=7]  *movdi_internal/3
+	movslq	%r15d, %rdx	# 2109	[c=4 l=3]  *extendsidi2_rex64/1
+	movb	%cl, (%rsi,%rdx)	# 2111	[c=4 l=3]  *movqi_internal/8
+.L690:
+	movl	(%rbx), %ecx	# 12981	[c=5 l=2]  *movsi_internal/0
+	movl	%eax, %edx	# 12983	[c=4 l=2]  *movsi_internal/0
+	leal	-2(%r15), %r13d	# 15010	[c=4 l=4]  *leasi
+	subl	5176(%rbx), %edx	# 2125	[c=13 l=6]  *subsi_1/1
+	shrl	$8, %ecx	# 2123	[c=4 l=3]  *lshrsi3_1/0
+	cmpl	5180(%rbx), %edx	# 2126	[c=13 l=6]  *cmpsi_1/1
+	jb	.L691	# 2127	[c=13 l=2]  *jcc
+	movl	%eax, %edx	# 12985	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %edx	# 2129	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %edx	# 12718	[c=5 l=6]  *andsi_1_zext
+	cmpb	$0, 1080(%rbx,%rdx)	# 2132	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L692	# 2133	[c=13 l=6]  *jcc
+.L691:
+	movq	1040(%rbx), %rdx	# 2137	[c=9 l=7]  *movdi_internal/3
+	cltq	# 2136	[c=4 l=2]  *extendsidi2_rex64/0
+	movb	%cl, (%rdx,%rax)	# 2138	[c=4 l=3]  *movqi_internal/8
+.L693:
+	cmpb	$0, 840(%rbx)	# 2149	[c=13 l=7]  *cmpqi_ccno_1/1
+	je	.L694	# 2150	[c=13 l=2]  *jcc
+	movl	(%rbx), %edx	# 12987	[c=5 l=2]  *movsi_internal/0
+	movl	%r13d, %eax	# 12989	[c=4 l=3]  *movsi_internal/0
+	subl	$3, %r15d	# 2154	[c=4 l=4]  *addsi_1/0
+	subl	5176(%rbx), %eax	# 2155	[c=13 l=6]  *subsi_1/1
+	shrl	$16, %edx	# 2153	[c=4 l=3]  *lshrsi3_1/0
+	cmpl	5180(%rbx), %eax	# 2156	[c=13 l=6]  *cmpsi_1/1
+	jb	.L695	# 2157	[c=13 l=2]  *jcc
+	movl	%r13d, %ecx	# 12991	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %ecx	# 2159	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %ecx	# 12717	[c=5 l=6]  *andsi_1_zext
+	cmpb	$0, 1080(%rbx,%rcx)	# 2162	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L696	# 2163	[c=13 l=6]  *jcc
+.L695:
+	movq	1040(%rbx), %rcx	# 2167	[c=9 l=7]  *movdi_internal/3
+	movslq	%r13d, %rax	# 2166	[c=4 l=3]  *extendsidi2_rex64/1
+	movb	%dl, (%rcx,%rax)	# 2168	[c=4 l=3]  *movqi_internal/8
+.L697:
+	movl	%r15d, %r13d	# 16	[c=4 l=3]  *movsi_internal/0
+.L694:
+	movl	$93, %edx	# 2183	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%rbx), %edx	# 2184	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %edx	# 2185	[c=13 l=6]  *cmpsi_1/1
+	jb	.L698	# 2186	[c=13 l=2]  *jcc
+	cmpb	$1, 1082(%rbx)	# 2190	[c=13 l=7]  *cmpqi_1/0
+	ja	.L1568	# 2191	[c=13 l=6]  *jcc
+.L698:
+	movq	1040(%rbx), %rax	# 2202	[c=9 l=7]  *movdi_internal/3
+	movb	%r13b, 93(%rax)	# 2203	[c=4 l=4]  *movqi_internal/8
+.L699:
+	movl	%r13d, %eax	# 12993	[c=4 l=3]  *movsi_internal/0
+	movl	$94, %edx	# 2207	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%rbx), %edx	# 2208	[c=13 l=6]  *subsi_1/1
+	sarl	$8, %eax	# 2206	[c=4 l=3]  *ashrsi3_1/0
+	cmpl	5180(%rbx), %edx	# 2209	[c=13 l=6]  *cmpsi_1/1
+	jb	.L700	# 2210	[c=13 l=2]  *jcc
+	cmpb	$1, 1082(%rbx)	# 2214	[c=13 l=7]  *cmpqi_1/0
+	ja	.L1569	# 2215	[c=13 l=6]  *jcc
+.L700:
+	movq	1040(%rbx), %rdx	# 2226	[c=9 l=7]  *movdi_internal/3
+	movb	%al, 94(%rdx)	# 2227	[c=4 l=3]  *movqi_internal/8
+.L701:
+	movq	1040(%rbx), %rdx	# 2230	[c=9 l=7]  *movdi_internal/3
+	movl	$92, %eax	# 2232	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%rbx), %eax	# 2233	[c=13 l=6]  *subsi_1/1
+	movzwl	30(%rdx), %r13d	# 2231	[c=13 l=5]  *zero_extendhisi2/0
+	cmpl	5180(%rbx), %eax	# 2234	[c=13 l=6]  *cmpsi_1/1
+	jb	.L702	# 2235	[c=13 l=2]  *jcc
+	cmpb	$0, 1082(%rbx)	# 2237	[c=13 l=7]  *cmpqi_ccno_1/1
+	jne	.L703	# 2238	[c=13 l=6]  *jcc
+.L702:
+	movzbl	92(%rdx), %esi	# 2241	[c=13 l=4]  *zero_extendqisi2/0
+.L704:
+	sall	$16, %esi	# 2252	[c=4 l=3]  *ashlsi3_1/0
+	orl	%r13d, %esi	# 2253	[c=4 l=3]  *iorsi_1/0
+	movl	%esi, (%rbx)	# 2254	[c=4 l=2]  *movsi_internal/1
+	cmpl	%esi, 992(%rbx)	# 2255	[c=13 l=6]  *cmpsi_1/0
+	jb	.L1416	# 2256	[c=13 l=6]  *jcc
+	movq	(%rsp), %rax	# 12995	[c=5 l=4]  *movdi_internal/3
+	subq	$1, %rax	# 2264	[c=4 l=4]  *adddi_1/0
+	cmpq	%rbp, %rax	# 2265	[c=4 l=3]  *cmpdi_1/0
+	jb	.L620	# 2266	[c=13 l=6]  *jcc
+	movq	56(%rbx), %rax	# 12996	[c=9 l=4]  *movdi_internal/3
+	cmpq	%rax, 48(%rbx)	# 2269	[c=13 l=4]  *cmpdi_1/0
+	jnb	.L1570	# 2270	[c=13 l=6]  *jcc
+.L706:
+	movl	(%rbx), %r15d	# 2277	[c=6 l=3]  *zero_extendsidi2/3
+	movl	$1, 96(%rbx)	# 2282	[c=4 l=7]  *movsi_internal/1
+	movq	%r10, %rcx	# 16532	[c=4 l=3]  *movdi_internal/3
+	movq	%r15, %rdx	# 15340	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 2279	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 2281	[c=13 l=7]  *adddi_1/1
+	movzbl	11(%r15), %eax	# 2283	[c=13 l=5]  zero_extendqidi2/0
+	movq	(%r15), %r14	# 2291	[c=5 l=3]  *movdi_internal/3
+	addq	%rax, %rbp	# 2284	[c=4 l=3]  *adddi_1/0
+	movzwl	14(%r15), %eax	# 2286	[c=13 l=5]  zero_extendhidi2/0
+	addq	%rax, 48(%rbx)	# 2287	[c=13 l=4]  *adddi_1/0
+	movq	%rbp, 40(%rbx)	# 2285	[c=4 l=4]  *movdi_internal/5
+	movzbl	9(%r15), %eax	# 2288	[c=13 l=5]  *zero_extendqisi2/0
+	addl	%edx, %eax	# 2289	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 16533	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 2290	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 16534	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 16535	[c=4 l=3]  *indirect_jump
+.L707:
+	cmpb	$0, 841(%rbx)	# 2297	[c=13 l=7]  *cmpqi_ccno_1/1
+	movl	$2, 96(%rbx)	# 2296	[c=4 l=7]  *movsi_internal/1
+	je	.L1417	# 2298	[c=13 l=6]  *jcc
+	movq	1040(%rbx), %rdx	# 2319	[c=9 l=7]  *movdi_internal/3
+	movl	$92, %eax	# 2321	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%rbx), %eax	# 2322	[c=13 l=6]  *subsi_1/1
+	movzwl	30(%rdx), %r13d	# 2320	[c=13 l=5]  *zero_extendhisi2/0
+	cmpl	5180(%rbx), %eax	# 2323	[c=13 l=6]  *cmpsi_1/1
+	jb	.L709	# 2324	[c=13 l=2]  *jcc
+	cmpb	$0, 1082(%rbx)	# 2326	[c=13 l=7]  *cmpqi_ccno_1/1
+	jne	.L710	# 2327	[c=13 l=6]  *jcc
+.L709:
+	movzbl	92(%rdx), %esi	# 2330	[c=13 l=4]  *zero_extendqisi2/0
+.L711:
+	sall	$16, %esi	# 2341	[c=4 l=3]  *ashlsi3_1/0
+	orl	%r13d, %esi	# 2342	[c=4 l=3]  *iorsi_1/0
+	movl	%esi, (%rbx)	# 2343	[c=4 l=2]  *movsi_internal/1
+	cmpl	%esi, 992(%rbx)	# 2344	[c=13 l=6]  *cmpsi_1/0
+	jb	.L1416	# 2345	[c=13 l=6]  *jcc
+	movq	(%rsp), %rax	# 12998	[c=5 l=4]  *movdi_internal/3
+	subq	$1, %rax	# 2353	[c=4 l=4]  *adddi_1/0
+	cmpq	%rbp, %rax	# 2354	[c=4 l=3]  *cmpdi_1/0
+	jb	.L620	# 2355	[c=13 l=6]  *jcc
+	movq	56(%rbx), %rax	# 12999	[c=9 l=4]  *movdi_internal/3
+	cmpq	%rax, 48(%rbx)	# 2358	[c=13 l=4]  *cmpdi_1/0
+	jnb	.L1571	# 2359	[c=13 l=6]  *jcc
+.L713:
+	movl	(%rbx), %r15d	# 2366	[c=6 l=3]  *zero_extendsidi2/3
+	movl	$1, 96(%rbx)	# 2371	[c=4 l=7]  *movsi_internal/1
+	movq	%r10, %rcx	# 16524	[c=4 l=3]  *movdi_internal/3
+	movq	%r15, %rdx	# 15341	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 2368	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 2370	[c=13 l=7]  *adddi_1/1
+	movzbl	11(%r15), %eax	# 2372	[c=13 l=5]  zero_extendqidi2/0
+	movq	(%r15), %r14	# 2380	[c=5 l=3]  *movdi_internal/3
+	addq	%rax, %rbp	# 2373	[c=4 l=3]  *adddi_1/0
+	movzwl	14(%r15), %eax	# 2375	[c=13 l=5]  zero_extendhidi2/0
+	addq	%rax, 48(%rbx)	# 2376	[c=13 l=4]  *adddi_1/0
+	movq	%rbp, 40(%rbx)	# 2374	[c=4 l=4]  *movdi_internal/5
+	movzbl	9(%r15), %eax	# 2377	[c=13 l=5]  *zero_extendqisi2/0
+	addl	%edx, %eax	# 2378	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 16525	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 2379	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 16526	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 16527	[c=4 l=3]  *indirect_jump
+.L752:
+	movzbl	10(%r15), %eax	# 2897	[c=13 l=5]  zero_extendqidi2/0
+	movzwl	12(%r15), %edx	# 2899	[c=13 l=5]  zero_extendhidi2/0
+	movq	1040(%rbx), %rcx	# 2896	[c=9 l=7]  *movdi_internal/3
+	movzbl	100(%rbx), %edi	# 2904	[c=13 l=4]  *zero_extendqisi2/0
+	movzbl	(%rcx,%rdx), %edx	# 2900	[c=13 l=4]  *zero_extendqisi2/0
+	movsbl	(%rcx,%rax), %eax	# 2898	[c=13 l=4]  extendqisi2
+	andl	$-4, %edi	# 2905	[c=4 l=3]  *andsi_1/0
+	imull	%edx, %eax	# 2901	[c=12 l=3]  *mulsi3_1/2
+	xorl	%edx, %edx	# 16861	[c=4 l=2]  *movsi_xor
+	movzwl	%ax, %eax	# 2902	[c=4 l=3]  *zero_extendhisi2/0
+	movl	%eax, %esi	# 13025	[c=4 l=2]  *movsi_internal/0
+	addl	%esi, %esi	# 16862	[c=4 l=2]  *ashlsi3_cmp
+	sete	%dl	# 16863	[c=4 l=3]  *setcc_qi_slp
+	sarl	$15, %eax	# 2912	[c=4 l=3]  *ashrsi3_1/0
+	addl	%edx, %edx	# 2911	[c=4 l=2]  *ashlsi3_1/0
+	orl	%edx, %eax	# 2913	[c=4 l=2]  *iorsi_1/0
+	movq	104(%rbx), %rdx	# 2914	[c=9 l=4]  *movdi_internal/3
+	movzbl	(%rdx), %r9d	# 16864	[c=5 l=4]  *movqi_internal/4
+	andl	%edi, %r9d	# 17546	[c=4 l=3]  *andsi_1/0
+	movl	%r9d, %edx	# 13028	[c=4 l=3]  *movqi_internal/2
+	orl	%edx, %eax	# 14990	[c=4 l=2]  *iorsi_1/0
+	leaq	101(%rbx), %rdx	# 14992	[c=4 l=4]  *leadi
+	movb	%al, 101(%rbx)	# 2917	[c=4 l=3]  *movqi_internal/8
+	movl	%edi, %eax	# 13029	[c=4 l=2]  *movqi_internal/1
+	orl	$3, %eax	# 14991	[c=4 l=3]  *iorsi_1/0
+	movq	%rdx, 104(%rbx)	# 2921	[c=4 l=4]  *movdi_internal/5
+	movb	%al, 100(%rbx)	# 2919	[c=4 l=3]  *movqi_internal/8
+	movb	%sil, (%rcx)	# 2922	[c=4 l=3]  *movqi_internal/8
+	movq	1040(%rbx), %rax	# 2923	[c=9 l=7]  *movdi_internal/3
+	movl	%esi, %ecx	# 13032	[c=4 l=2]  *movsi_internal/0
+	movb	%ch, 1(%rax)	# 16866	[c=4 l=3]  *extzvqi_mem_rex64
+	movl	(%rbx), %r15d	# 2926	[c=6 l=3]  *zero_extendsidi2/3
+	movq	%r10, %rcx	# 16460	[c=4 l=3]  *movdi_internal/3
+	movq	%r15, %rdx	# 15349	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 2928	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 2930	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%r15), %eax	# 2931	[c=13 l=5]  *zero_extendqisi2/0
+	movq	(%r15), %r14	# 2934	[c=5 l=3]  *movdi_internal/3
+	addl	%edx, %eax	# 2932	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 16461	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 2933	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 16462	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 16463	[c=4 l=3]  *indirect_jump
+.L776:
+	movq	1040(%rbx), %rax	# 3188	[c=9 l=7]  *movdi_internal/3
+	movl	$2, 96(%rbx)	# 3187	[c=4 l=7]  *movsi_internal/1
+	movzwl	30(%rax), %esi	# 3189	[c=13 l=4]  *zero_extendhisi2/0
+	movl	%esi, (%rbx)	# 3190	[c=4 l=2]  *movsi_internal/1
+	cmpl	%esi, 992(%rbx)	# 3191	[c=13 l=6]  *cmpsi_1/0
+	jb	.L1416	# 3192	[c=13 l=6]  *jcc
+	movq	(%rsp), %rax	# 13052	[c=5 l=4]  *movdi_internal/3
+	subq	$1, %rax	# 3200	[c=4 l=4]  *adddi_1/0
+	cmpq	%rbp, %rax	# 3201	[c=4 l=3]  *cmpdi_1/0
+	jb	.L620	# 3202	[c=13 l=6]  *jcc
+	movq	56(%rbx), %rax	# 13053	[c=9 l=4]  *movdi_internal/3
+	cmpq	%rax, 48(%rbx)	# 3205	[c=13 l=4]  *cmpdi_1/0
+	jnb	.L1572	# 3206	[c=13 l=6]  *jcc
+.L778:
+	movl	(%rbx), %r15d	# 3213	[c=6 l=3]  *zero_extendsidi2/3
+	movl	$1, 96(%rbx)	# 3218	[c=4 l=7]  *movsi_internal/1
+	movq	%r10, %rcx	# 16444	[c=4 l=3]  *movdi_internal/3
+	movq	%r15, %rdx	# 15351	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 3215	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 3217	[c=13 l=7]  *adddi_1/1
+	movzbl	11(%r15), %eax	# 3219	[c=13 l=5]  zero_extendqidi2/0
+	movq	(%r15), %r14	# 3227	[c=5 l=3]  *movdi_internal/3
+	addq	%rax, %rbp	# 3220	[c=4 l=3]  *adddi_1/0
+	movzwl	14(%r15), %eax	# 3222	[c=13 l=5]  zero_extendhidi2/0
+	addq	%rax, 48(%rbx)	# 3223	[c=13 l=4]  *adddi_1/0
+	movq	%rbp, 40(%rbx)	# 3221	[c=4 l=4]  *movdi_internal/5
+	movzbl	9(%r15), %eax	# 3224	[c=13 l=5]  *zero_extendqisi2/0
+	addl	%edx, %eax	# 3225	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 16445	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 3226	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 16446	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 16447	[c=4 l=3]  *indirect_jump
+.L753:
+	movl	5176(%rbx), %r13d	# 2940	[c=9 l=7]  *movsi_internal/0
+	movl	$93, %eax	# 2942	[c=4 l=5]  *movsi_internal/0
+	movl	5180(%rbx), %r14d	# 2941	[c=9 l=7]  *movsi_internal/0
+	movl	$2, 96(%rbx)	# 2939	[c=4 l=7]  *movsi_internal/1
+	subl	%r13d, %eax	# 2943	[c=4 l=3]  *subsi_1/0
+	cmpl	%r14d, %eax	# 2944	[c=4 l=3]  *cmpsi_1/0
+	jb	.L754	# 2945	[c=13 l=6]  *jcc
+	cmpb	$1, 1082(%rbx)	# 2949	[c=13 l=7]  *cmpqi_1/0
+	ja	.L1573	# 2950	[c=13 l=6]  *jcc
+	movq	1040(%rbx), %rax	# 11230	[c=9 l=7]  *movdi_internal/3
+	movzbl	93(%rax), %r15d	# 11231	[c=13 l=5]  *zero_extendqisi2/0
+.L756:
+	movzbl	94(%rax), %eax	# 2987	[c=13 l=4]  *zero_extendqisi2/0
+.L758:
+	sall	$8, %eax	# 2990	[c=4 l=3]  *ashlsi3_1/0
+	movl	996(%rbx), %edx	# 2993	[c=9 l=6]  *movsi_internal/0
+	orl	%eax, %r15d	# 2991	[c=4 l=3]  *iorsi_1/0
+	movzbl	840(%rbx), %eax	# 2995	[c=13 l=7]  *zero_extendqisi2/0
+	leal	1(%rdx,%rax), %eax	# 2996	[c=5 l=4]  *leasi
+	cmpl	%eax, %r15d	# 2997	[c=4 l=3]  *cmpsi_1/0
+	jb	.L1415	# 2998	[c=13 l=6]  *jcc
+	movl	%r15d, %edx	# 13033	[c=4 l=3]  *movsi_internal/0
+	movl	(%rbx), %ecx	# 3006	[c=5 l=2]  *movsi_internal/0
+	leal	-1(%r15), %eax	# 14987	[c=4 l=4]  *leasi
+	subl	%r13d, %edx	# 3008	[c=4 l=3]  *subsi_1/0
+	cmpl	%r14d, %edx	# 3009	[c=4 l=3]  *cmpsi_1/0
+	jb	.L760	# 3010	[c=13 l=2]  *jcc
+	movl	%r15d, %edx	# 13035	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %edx	# 3012	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %edx	# 12716	[c=5 l=6]  *andsi_1_zext
+	cmpb	$0, 1080(%rbx,%rdx)	# 3015	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L761	# 3016	[c=13 l=6]  *jcc
+.L760:
+	movq	1040(%rbx), %rsi	# 3020	[c=9 l=7]  *movdi_internal/3
+	movslq	%r15d, %rdx	# 3019	[c=4 l=3]  *extendsidi2_rex64/1
+	movb	%cl, (%rsi,%rdx)	# 3021	[c=4 l=3]  *movqi_internal/8
+.L762:
+	movl	(%rbx), %ecx	# 13037	[c=5 l=2]  *movsi_internal/0
+	movl	%eax, %edx	# 13039	[c=4 l=2]  *movsi_internal/0
+	leal	-2(%r15), %r13d	# 14986	[c=4 l=4]  *leasi
+	subl	5176(%rbx), %edx	# 3035	[c=13 l=6]  *subsi_1/1
+	shrl	$8, %ecx	# 3033	[c=4 l=3]  *lshrsi3_1/0
+	cmpl	5180(%rbx), %edx	# 3036	[c=13 l=6]  *cmpsi_1/1
+	jb	.L763	# 3037	[c=13 l=2]  *jcc
+	movl	%eax, %edx	# 13041	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %edx	# 3039	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %edx	# 12715	[c=5 l=6]  *andsi_1_zext
+	cmpb	$0, 1080(%rbx,%rdx)	# 3042	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L764	# 3043	[c=13 l=6]  *jcc
+.L763:
+	movq	1040(%rbx), %rdx	# 3047	[c=9 l=7]  *movdi_internal/3
+	cltq	# 3046	[c=4 l=2]  *extendsidi2_rex64/0
+	movb	%cl, (%rdx,%rax)	# 3048	[c=4 l=3]  *movqi_internal/8
+.L765:
+	cmpb	$0, 840(%rbx)	# 3059	[c=13 l=7]  *cmpqi_ccno_1/1
+	je	.L766	# 3060	[c=13 l=2]  *jcc
+	movl	(%rbx), %edx	# 13043	[c=5 l=2]  *movsi_internal/0
+	movl	%r13d, %eax	# 13045	[c=4 l=3]  *movsi_internal/0
+	subl	$3, %r15d	# 3064	[c=4 l=4]  *addsi_1/0
+	subl	5176(%rbx), %eax	# 3065	[c=13 l=6]  *subsi_1/1
+	shrl	$16, %edx	# 3063	[c=4 l=3]  *lshrsi3_1/0
+	cmpl	5180(%rbx), %eax	# 3066	[c=13 l=6]  *cmpsi_1/1
+	jb	.L767	# 3067	[c=13 l=2]  *jcc
+	movl	%r13d, %ecx	# 13047	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %ecx	# 3069	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %ecx	# 12714	[c=5 l=6]  *andsi_1_zext
+	cmpb	$0, 1080(%rbx,%rcx)	# 3072	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L768	# 3073	[c=13 l=6]  *jcc
+.L767:
+	movq	1040(%rbx), %rcx	# 3077	[c=9 l=7]  *movdi_internal/3
+	movslq	%r13d, %rax	# 3076	[c=4 l=3]  *extendsidi2_rex64/1
+	movb	%dl, (%rcx,%rax)	# 3078	[c=4 l=3]  *movqi_internal/8
+.L769:
+	movl	%r15d, %r13d	# 19	[c=4 l=3]  *movsi_internal/0
+.L766:
+	movl	$93, %edx	# 3093	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%rbx), %edx	# 3094	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %edx	# 3095	[c=13 l=6]  *cmpsi_1/1
+	jb	.L770	# 3096	[c=13 l=2]  *jcc
+	cmpb	$1, 1082(%rbx)	# 3100	[c=13 l=7]  *cmpqi_1/0
+	ja	.L1574	# 3101	[c=13 l=6]  *jcc
+.L770:
+	movq	1040(%rbx), %rax	# 3112	[c=9 l=7]  *movdi_internal/3
+	movb	%r13b, 93(%rax)	# 3113	[c=4 l=4]  *movqi_internal/8
+.L771:
+	movl	%r13d, %eax	# 13049	[c=4 l=3]  *movsi_internal/0
+	movl	$94, %edx	# 3117	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%rbx), %edx	# 3118	[c=13 l=6]  *subsi_1/1
+	sarl	$8, %eax	# 3116	[c=4 l=3]  *ashrsi3_1/0
+	cmpl	5180(%rbx), %edx	# 3119	[c=13 l=6]  *cmpsi_1/1
+	jb	.L772	# 3120	[c=13 l=2]  *jcc
+	cmpb	$1, 1082(%rbx)	# 3124	[c=13 l=7]  *cmpqi_1/0
+	ja	.L1575	# 3125	[c=13 l=6]  *jcc
+.L772:
+	movq	1040(%rbx), %rdx	# 3136	[c=9 l=7]  *movdi_internal/3
+	movb	%al, 94(%rdx)	# 3137	[c=4 l=3]  *movqi_internal/8
+.L773:
+	movq	1040(%rbx), %rax	# 3140	[c=9 l=7]  *movdi_internal/3
+	movzwl	30(%rax), %esi	# 3141	[c=13 l=4]  *zero_extendhisi2/0
+	movl	%esi, (%rbx)	# 3142	[c=4 l=2]  *movsi_internal/1
+	cmpl	%esi, 992(%rbx)	# 3143	[c=13 l=6]  *cmpsi_1/0
+	jb	.L1416	# 3144	[c=13 l=6]  *jcc
+	movq	(%rsp), %rdi	# 13051	[c=5 l=4]  *movdi_internal/3
+	movzbl	840(%rbx), %eax	# 3152	[c=13 l=7]  zero_extendqidi2/0
+	addq	48(%rbx), %rax	# 3154	[c=13 l=4]  *adddi_1/1
+	leaq	-1(%rdi), %rdx	# 14985	[c=4 l=4]  *leadi
+	movq	%rax, 48(%rbx)	# 3155	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rbp, %rdx	# 3157	[c=4 l=3]  *cmpdi_1/0
+	jb	.L620	# 3158	[c=13 l=6]  *jcc
+	cmpq	56(%rbx), %rax	# 3160	[c=13 l=4]  *cmpdi_1/1
+	jnb	.L1576	# 3161	[c=13 l=6]  *jcc
+.L775:
+	movl	(%rbx), %r15d	# 3168	[c=6 l=3]  *zero_extendsidi2/3
+	movl	$1, 96(%rbx)	# 3173	[c=4 l=7]  *movsi_internal/1
+	movq	%r10, %rcx	# 16452	[c=4 l=3]  *movdi_internal/3
+	movq	%r15, %rdx	# 15350	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 3170	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 3172	[c=13 l=7]  *adddi_1/1
+	movzbl	11(%r15), %eax	# 3174	[c=13 l=5]  zero_extendqidi2/0
+	movq	(%r15), %r14	# 3182	[c=5 l=3]  *movdi_internal/3
+	addq	%rax, %rbp	# 3175	[c=4 l=3]  *adddi_1/0
+	movzwl	14(%r15), %eax	# 3177	[c=13 l=5]  zero_extendhidi2/0
+	addq	%rax, 48(%rbx)	# 3178	[c=13 l=4]  *adddi_1/0
+	movq	%rbp, 40(%rbx)	# 3176	[c=4 l=4]  *movdi_internal/5
+	movzbl	9(%r15), %eax	# 3179	[c=13 l=5]  *zero_extendqisi2/0
+	addl	%edx, %eax	# 3180	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 16453	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 3181	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 16454	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 16455	[c=4 l=3]  *indirect_jump
+.L779:
+	movzwl	12(%r15), %esi	# 3232	[c=13 l=5]  *zero_extendhisi2/0
+	movzbl	10(%r15), %r13d	# 3233	[c=9 l=5]  *movqi_internal/4
+	movl	%esi, %edx	# 13054	[c=4 l=2]  *movsi_internal/0
+	movl	%esi, %eax	# 15352	[c=4 l=2]  *movsi_internal/0
+	subl	5176(%rbx), %edx	# 3235	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %edx	# 3236	[c=13 l=6]  *cmpsi_1/1
+	jb	.L780	# 3237	[c=13 l=2]  *jcc
+	movl	%esi, %edx	# 13056	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %edx	# 3240	[c=4 l=3]  *ashrsi3_1/0
+	movslq	%edx, %rdx	# 3241	[c=4 l=3]  *extendsidi2_rex64/1
+	cmpb	$0, 1080(%rbx,%rdx)	# 3242	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L781	# 3243	[c=13 l=6]  *jcc
+.L780:
+	movzwl	%ax, %ecx	# 3246	[c=4 l=3]  zero_extendhidi2/0
+	movq	1040(%rbx), %rax	# 3247	[c=9 l=7]  *movdi_internal/3
+	movzbl	(%rax,%rcx), %ecx	# 3248	[c=13 l=4]  *zero_extendqisi2/0
+.L782:
+	movzbl	%r13b, %edx	# 3259	[c=4 l=4]  zero_extendqidi2/0
+	movb	%cl, (%rax,%rdx)	# 3261	[c=4 l=3]  *movqi_internal/8
+	movl	(%rbx), %r15d	# 3262	[c=6 l=3]  *zero_extendsidi2/3
+	movq	%r10, %rcx	# 16436	[c=4 l=3]  *movdi_internal/3
+	movq	%r15, %rdx	# 15353	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 3264	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 3266	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%r15), %eax	# 3267	[c=13 l=5]  *zero_extendqisi2/0
+	movq	(%r15), %r14	# 3270	[c=5 l=3]  *movdi_internal/3
+	addl	%edx, %eax	# 3268	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 16437	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 3269	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 16438	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 16439	[c=4 l=3]  *indirect_jump
+.L790:
+	movq	1040(%rbx), %rax	# 3389	[c=9 l=7]  *movdi_internal/3
+	movzwl	12(%r15), %esi	# 3390	[c=13 l=5]  *zero_extendhisi2/0
+	movzbl	10(%r15), %r13d	# 3388	[c=13 l=5]  zero_extendqidi2/0
+	movzwl	28(%rax), %edx	# 3391	[c=13 l=4]  *zero_extendhisi2/0
+	addl	%edx, %esi	# 3392	[c=4 l=2]  *addsi_1/0
+	movl	%esi, %edx	# 13062	[c=4 l=2]  *movsi_internal/0
+	subl	5176(%rbx), %edx	# 3393	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %edx	# 3394	[c=13 l=6]  *cmpsi_1/1
+	jb	.L791	# 3395	[c=13 l=2]  *jcc
+	movl	%esi, %edx	# 13064	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %edx	# 3397	[c=4 l=3]  *ashrsi3_1/0
+	movslq	%edx, %rdx	# 3398	[c=4 l=3]  *extendsidi2_rex64/1
+	cmpb	$0, 1080(%rbx,%rdx)	# 3399	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L792	# 3400	[c=13 l=6]  *jcc
+.L791:
+	movslq	%esi, %rsi	# 3403	[c=4 l=3]  *extendsidi2_rex64/1
+	movzbl	(%rax,%rsi), %edx	# 3404	[c=13 l=4]  *zero_extendqisi2/0
+.L793:
+	movb	%dl, (%rax,%r13)	# 3417	[c=4 l=4]  *movqi_internal/8
+	movl	(%rbx), %r15d	# 3418	[c=6 l=3]  *zero_extendsidi2/3
+	movq	%r10, %rcx	# 16404	[c=4 l=3]  *movdi_internal/3
+	movq	%r15, %rdx	# 15357	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 3420	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 3422	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%r15), %eax	# 3423	[c=13 l=5]  *zero_extendqisi2/0
+	movq	(%r15), %r14	# 3426	[c=5 l=3]  *movdi_internal/3
+	addl	%edx, %eax	# 3424	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 16405	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 3425	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 16406	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 16407	[c=4 l=3]  *indirect_jump
+.L794:
+	movq	1040(%rbx), %rax	# 3432	[c=9 l=7]  *movdi_internal/3
+	movzwl	12(%r15), %esi	# 3433	[c=13 l=5]  *zero_extendhisi2/0
+	movzbl	10(%r15), %r13d	# 3431	[c=13 l=5]  zero_extendqidi2/0
+	movzwl	30(%rax), %edx	# 3434	[c=13 l=4]  *zero_extendhisi2/0
+	addl	%edx, %esi	# 3435	[c=4 l=2]  *addsi_1/0
+	movl	%esi, %edx	# 13066	[c=4 l=2]  *movsi_internal/0
+	subl	5176(%rbx), %edx	# 3436	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %edx	# 3437	[c=13 l=6]  *cmpsi_1/1
+	jb	.L795	# 3438	[c=13 l=2]  *jcc
+	movl	%esi, %edx	# 13068	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %edx	# 3440	[c=4 l=3]  *ashrsi3_1/0
+	movslq	%edx, %rdx	# 3441	[c=4 l=3]  *extendsidi2_rex64/1
+	cmpb	$0, 1080(%rbx,%rdx)	# 3442	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L796	# 3443	[c=13 l=6]  *jcc
+.L795:
+	movslq	%esi, %rsi	# 3446	[c=4 l=3]  *extendsidi2_rex64/1
+	movzbl	(%rax,%rsi), %edx	# 3447	[c=13 l=4]  *zero_extendqisi2/0
+.L797:
+	movb	%dl, (%rax,%r13)	# 3460	[c=4 l=4]  *movqi_internal/8
+	movl	(%rbx), %r15d	# 3461	[c=6 l=3]  *zero_extendsidi2/3
+	movq	%r10, %rcx	# 16396	[c=4 l=3]  *movdi_internal/3
+	movq	%r15, %rdx	# 15358	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 3463	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 3465	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%r15), %eax	# 3466	[c=13 l=5]  *zero_extendqisi2/0
+	movq	(%r15), %r14	# 3469	[c=5 l=3]  *movdi_internal/3
+	addl	%edx, %eax	# 3467	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 16397	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 3468	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 16398	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 16399	[c=4 l=3]  *indirect_jump
+.L798:
+	movzwl	12(%r15), %esi	# 3474	[c=13 l=5]  *zero_extendhisi2/0
+	movzbl	10(%r15), %r13d	# 3475	[c=9 l=5]  *movqi_internal/4
+	movl	%esi, %edx	# 13070	[c=4 l=2]  *movsi_internal/0
+	movl	%esi, %eax	# 15359	[c=4 l=2]  *movsi_internal/0
+	subl	5176(%rbx), %edx	# 3477	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %edx	# 3478	[c=13 l=6]  *cmpsi_1/1
+	jb	.L799	# 3479	[c=13 l=2]  *jcc
+	movl	%esi, %edx	# 13072	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %edx	# 3482	[c=4 l=3]  *ashrsi3_1/0
+	movslq	%edx, %rdx	# 3483	[c=4 l=3]  *extendsidi2_rex64/1
+	cmpb	$0, 1080(%rbx,%rdx)	# 3484	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L800	# 3485	[c=13 l=6]  *jcc
+.L799:
+	movzwl	%ax, %ecx	# 3488	[c=4 l=3]  zero_extendhidi2/0
+	movq	1040(%rbx), %rax	# 3489	[c=9 l=7]  *movdi_internal/3
+	movzbl	(%rax,%rcx), %ecx	# 3490	[c=13 l=4]  *zero_extendqisi2/0
+.L801:
+	movzbl	%r13b, %edx	# 3501	[c=4 l=4]  zero_extendqidi2/0
+	movb	%cl, (%rax,%rdx)	# 3503	[c=4 l=3]  *movqi_internal/8
+	movl	(%rbx), %r15d	# 3504	[c=6 l=3]  *zero_extendsidi2/3
+	movq	%r10, %rcx	# 16388	[c=4 l=3]  *movdi_internal/3
+	movq	%r15, %rdx	# 15360	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 3506	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 3508	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%r15), %eax	# 3509	[c=13 l=5]  *zero_extendqisi2/0
+	movq	(%r15), %r14	# 3512	[c=5 l=3]  *movdi_internal/3
+	addl	%edx, %eax	# 3510	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 16389	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 3511	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 16390	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 16391	[c=4 l=3]  *indirect_jump
+.L802:
+	movzwl	12(%r15), %esi	# 3517	[c=13 l=5]  *zero_extendhisi2/0
+	movzbl	10(%r15), %r13d	# 3518	[c=9 l=5]  *movqi_internal/4
+	movl	%esi, %edx	# 13074	[c=4 l=2]  *movsi_internal/0
+	movl	%esi, %eax	# 15361	[c=4 l=2]  *movsi_internal/0
+	subl	5176(%rbx), %edx	# 3520	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %edx	# 3521	[c=13 l=6]  *cmpsi_1/1
+	jb	.L803	# 3522	[c=13 l=2]  *jcc
+	movl	%esi, %edx	# 13076	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %edx	# 3525	[c=4 l=3]  *ashrsi3_1/0
+	movslq	%edx, %rdx	# 3526	[c=4 l=3]  *extendsidi2_rex64/1
+	cmpb	$0, 1080(%rbx,%rdx)	# 3527	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L804	# 3528	[c=13 l=6]  *jcc
+.L803:
+	movzwl	%ax, %ecx	# 3531	[c=4 l=3]  zero_extendhidi2/0
+	movq	1040(%rbx), %rax	# 3532	[c=9 l=7]  *movdi_internal/3
+	movzbl	(%rax,%rcx), %ecx	# 3533	[c=13 l=4]  *zero_extendqisi2/0
+.L805:
+	movzbl	%r13b, %edx	# 3544	[c=4 l=4]  zero_extendqidi2/0
+	movb	%cl, (%rax,%rdx)	# 3546	[c=4 l=3]  *movqi_internal/8
+	movl	(%rbx), %r15d	# 3547	[c=6 l=3]  *zero_extendsidi2/3
+	movq	%r10, %rcx	# 16380	[c=4 l=3]  *movdi_internal/3
+	movq	%r15, %rdx	# 15362	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 3549	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 3551	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%r15), %eax	# 3552	[c=13 l=5]  *zero_extendqisi2/0
+	movq	(%r15), %r14	# 3555	[c=5 l=3]  *movdi_internal/3
+	addl	%edx, %eax	# 3553	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 16381	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 3554	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 16382	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 16383	[c=4 l=3]  *indirect_jump
+.L729:
+	movq	1040(%rbx), %rax	# 2556	[c=9 l=7]  *movdi_internal/3
+	movzbl	10(%r15), %edx	# 2557	[c=13 l=5]  zero_extendqidi2/0
+	movzwl	12(%r15), %ecx	# 2559	[c=13 l=5]  zero_extendhidi2/0
+	addq	%rax, %rdx	# 2558	[c=4 l=3]  *adddi_1/0
+	movzbl	(%rax,%rcx), %eax	# 2560	[c=9 l=4]  *movqi_internal/4
+	xorb	(%rdx), %al	# 2561	[c=9 l=2]  *xorqi_1/1
+	movb	%al, (%rdx)	# 2562	[c=4 l=2]  *movqi_internal/8
+	movzbl	100(%rbx), %edx	# 2563	[c=9 l=4]  *movqi_internal/4
+	movl	%edx, %ecx	# 13001	[c=4 l=2]  *movsi_internal/0
+	andl	$225, %ecx	# 2566	[c=4 l=6]  *andsi_2/0
+	jne	.L730	# 2567	[c=13 l=6]  *jcc
+	leaq	flag_update_table_logical(%rip), %rdx	# 2570	[c=1 l=7]  *movdi_internal/4
+	movzbl	%al, %eax	# 2569	[c=4 l=3]  zero_extendqidi2/0
+	addq	%rdx, %rax	# 2571	[c=4 l=3]  *adddi_1/0
+	movl	$30, %edx	# 17	[c=4 l=5]  *movqi_internal/3
+.L731:
+	movl	(%rbx), %r15d	# 2591	[c=6 l=3]  *zero_extendsidi2/3
+	movb	%dl, 100(%rbx)	# 2590	[c=4 l=3]  *movqi_internal/8
+	movq	%r10, %rcx	# 16492	[c=4 l=3]  *movdi_internal/3
+	movq	%rax, 104(%rbx)	# 2589	[c=4 l=4]  *movdi_internal/5
+	movq	%r15, %rdx	# 15345	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 2593	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 2595	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%r15), %eax	# 2596	[c=13 l=5]  *zero_extendqisi2/0
+	movq	(%r15), %r14	# 2599	[c=5 l=3]  *movdi_internal/3
+	addl	%edx, %eax	# 2597	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 16493	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 2598	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 16494	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 16495	[c=4 l=3]  *indirect_jump
+.L732:
+	movq	1040(%rbx), %rax	# 2605	[c=9 l=7]  *movdi_internal/3
+	movl	$2, 96(%rbx)	# 2604	[c=4 l=7]  *movsi_internal/1
+	cmpl	$65536, 880(%rbx)	# 2609	[c=13 l=10]  *cmpsi_1/0
+	movzwl	30(%rax), %r14d	# 2606	[c=13 l=5]  *zero_extendhisi2/0
+	jbe	.L733	# 2610	[c=13 l=2]  *jcc
+	movl	$91, %edx	# 2612	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%rbx), %edx	# 2613	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %edx	# 2614	[c=13 l=6]  *cmpsi_1/1
+	jb	.L734	# 2615	[c=13 l=2]  *jcc
+	cmpb	$0, 1082(%rbx)	# 2617	[c=13 l=7]  *cmpqi_ccno_1/1
+	jne	.L735	# 2618	[c=13 l=6]  *jcc
+.L734:
+	movzbl	91(%rax), %eax	# 2621	[c=13 l=4]  *zero_extendqisi2/0
+.L736:
+	sall	$16, %eax	# 2632	[c=4 l=3]  *ashlsi3_1/0
+	orl	%eax, %r14d	# 2633	[c=4 l=3]  *iorsi_1/0
+.L733:
+	movl	6044(%rbx), %ecx	# 2636	[c=9 l=6]  *movsi_internal/0
+	movl	992(%rbx), %eax	# 2638	[c=9 l=6]  *movsi_internal/0
+	movq	%rbx, %rdi	# 2648	[c=4 l=3]  *movdi_internal/3
+	leal	1(%rax,%rax), %r13d	# 2640	[c=8 l=5]  *leasi
+	movl	%ecx, %eax	# 13003	[c=4 l=2]  *movsi_internal/0
+	movl	%ecx, 16(%rsp)	# 14023	[c=4 l=4]  *movsi_internal/1
+	negl	%eax	# 2641	[c=4 l=2]  *negsi_1
+	andl	%eax, %r13d	# 2642	[c=4 l=3]  *andsi_1/0
+	leaq	6052(%rbx), %rax	# 15007	[c=4 l=7]  *leadi
+	andl	%r14d, %r13d	# 2643	[c=4 l=3]  *andsi_1/0
+	movq	%rax, 24(%rsp)	# 13005	[c=4 l=5]  *movdi_internal/5
+	movl	%r13d, %r15d	# 2644	[c=1 l=3]  *zero_extendsidi2/3
+	addq	1056(%rbx), %r15	# 2646	[c=13 l=7]  *adddi_1/1
+	call	spm_operation	# 2649	[c=10 l=5]  *call_value
+	movl	16(%rsp), %ecx	# 14024	[c=9 l=4]  *movsi_internal/0
+	leaq	flag_update_table_add8(%rip), %r10	# 14026	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_sub8(%rip), %r11	# 14028	[c=1 l=7]  *movdi_internal/4
+	cmpl	$3, %eax	# 2651	[c=4 l=3]  *cmpsi_1/0
+	je	.L1577	# 2652	[c=13 l=6]  *jcc
+	jg	.L738	# 2657	[c=13 l=6]  *jcc
+	cmpl	$1, %eax	# 2659	[c=4 l=3]  *cmpsi_1/0
+	je	.L739	# 2660	[c=13 l=6]  *jcc
+	cmpl	$2, %eax	# 2662	[c=4 l=3]  *cmpsi_1/0
+	jne	.L741	# 2663	[c=13 l=2]  *jcc
+	movl	%ecx, %edx	# 2692	[c=1 l=2]  *zero_extendsidi2/3
+	movl	$255, %esi	# 2694	[c=4 l=5]  *movsi_internal/0
+	movq	%r15, %rdi	# 2695	[c=4 l=3]  *movdi_internal/3
+	movl	%ecx, 16(%rsp)	# 14029	[c=4 l=4]  *movsi_internal/1
+	call	memset@PLT	# 2696	[c=10 l=5]  *call_value
+	movl	16(%rsp), %ecx	# 14030	[c=9 l=4]  *movsi_internal/0
+	movl	%r13d, %esi	# 2699	[c=4 l=3]  *movsi_internal/0
+	movq	%rbx, %rdi	# 2700	[c=4 l=3]  *movdi_internal/3
+	leal	(%rcx,%r13), %edx	# 15005	[c=4 l=4]  *leasi
+	call	flash_changed	# 2701	[c=0 l=5]  *call
+	leaq	flag_update_table_add8(%rip), %r10	# 14032	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_sub8(%rip), %r11	# 14034	[c=1 l=7]  *movdi_internal/4
+.L741:
+	movq	1040(%rbx), %rdx	# 2743	[c=9 l=7]  *movdi_internal/3
+	leal	2(%r14), %r8d	# 15003	[c=4 l=4]  *leasi
+	movzwl	%r8w, %eax	# 2742	[c=4 l=4]  *zero_extendhisi2/0
+	movb	%al, 30(%rdx)	# 2744	[c=4 l=3]  *movqi_internal/8
+	movq	1040(%rbx), %rdx	# 2745	[c=9 l=7]  *movdi_internal/3
+	movb	%ah, 31(%rdx)	# 16881	[c=4 l=3]  *extzvqi_mem_rex64
+	cmpl	$65536, 880(%rbx)	# 2750	[c=13 l=10]  *cmpsi_1/0
+	jbe	.L745	# 2751	[c=13 l=2]  *jcc
+	movl	$91, %eax	# 2754	[c=4 l=5]  *movsi_internal/0
+	sarl	$16, %r8d	# 2753	[c=4 l=4]  *ashrsi3_1/0
+	subl	5176(%rbx), %eax	# 2755	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %eax	# 2756	[c=13 l=6]  *cmpsi_1/1
+	jb	.L746	# 2757	[c=13 l=2]  *jcc
+	cmpb	$0, 1082(%rbx)	# 2759	[c=13 l=7]  *cmpqi_ccno_1/1
+	jne	.L747	# 2760	[c=13 l=6]  *jcc
+.L746:
+	movq	1040(%rbx), %rax	# 2763	[c=9 l=7]  *movdi_internal/3
+	movb	%r8b, 91(%rax)	# 2764	[c=4 l=4]  *movqi_internal/8
+.L745:
+	movq	(%rsp), %rax	# 13007	[c=5 l=4]  *movdi_internal/3
+	subq	$1, %rax	# 2775	[c=4 l=4]  *adddi_1/0
+	cmpq	%rbp, %rax	# 2776	[c=4 l=3]  *cmpdi_1/0
+	jb	.L620	# 2777	[c=13 l=6]  *jcc
+	movq	56(%rbx), %rax	# 13008	[c=9 l=4]  *movdi_internal/3
+	cmpq	%rax, 48(%rbx)	# 2780	[c=13 l=4]  *cmpdi_1/0
+	jnb	.L1578	# 2781	[c=13 l=6]  *jcc
+.L748:
+	cmpl	$0, 120(%rbx)	# 2789	[c=13 l=4]  *cmpsi_ccno_1/1
+	jne	.L553	# 2790	[c=13 l=6]  *jcc
+	movl	(%rbx), %r15d	# 2792	[c=6 l=3]  *zero_extendsidi2/3
+	movl	$1, 96(%rbx)	# 2797	[c=4 l=7]  *movsi_internal/1
+	movq	%r10, %rcx	# 16484	[c=4 l=3]  *movdi_internal/3
+	movq	%r15, %rdx	# 15346	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 2794	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 2796	[c=13 l=7]  *adddi_1/1
+	movzbl	11(%r15), %eax	# 2798	[c=13 l=5]  zero_extendqidi2/0
+	movq	(%r15), %r14	# 2806	[c=5 l=3]  *movdi_internal/3
+	addq	%rax, %rbp	# 2799	[c=4 l=3]  *adddi_1/0
+	movzwl	14(%r15), %eax	# 2801	[c=13 l=5]  zero_extendhidi2/0
+	addq	%rax, 48(%rbx)	# 2802	[c=13 l=4]  *adddi_1/0
+	movq	%rbp, 40(%rbx)	# 2800	[c=4 l=4]  *movdi_internal/5
+	movzbl	9(%r15), %eax	# 2803	[c=13 l=5]  *zero_extendqisi2/0
+	addl	%edx, %eax	# 2804	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 16485	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 2805	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 16486	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 16487	[c=4 l=3]  *indirect_jump
+.L750:
+	movzbl	10(%r15), %eax	# 2812	[c=13 l=5]  zero_extendqidi2/0
+	movzwl	12(%r15), %edx	# 2814	[c=13 l=5]  zero_extendhidi2/0
+	movq	1040(%rbx), %rcx	# 2811	[c=9 l=7]  *movdi_internal/3
+	movzbl	100(%rbx), %edi	# 2818	[c=13 l=4]  *zero_extendqisi2/0
+	movzbl	(%rcx,%rdx), %edx	# 2815	[c=13 l=4]  *zero_extendqisi2/0
+	movzbl	(%rcx,%rax), %eax	# 2813	[c=13 l=4]  *zero_extendqisi2/0
+	andl	$-4, %edi	# 2819	[c=4 l=3]  *andsi_1/0
+	imull	%edx, %eax	# 2816	[c=12 l=3]  *mulsi3_1/2
+	xorl	%edx, %edx	# 16873	[c=4 l=2]  *movsi_xor
+	movl	%eax, %esi	# 13009	[c=4 l=2]  *movsi_internal/0
+	addl	%esi, %esi	# 16874	[c=4 l=2]  *ashlsi3_cmp
+	sete	%dl	# 16875	[c=4 l=3]  *setcc_qi_slp
+	sarl	$15, %eax	# 2826	[c=4 l=3]  *ashrsi3_1/0
+	addl	%edx, %edx	# 2825	[c=4 l=2]  *ashlsi3_1/0
+	orl	%edx, %eax	# 2827	[c=4 l=2]  *iorsi_1/0
+	movq	104(%rbx), %rdx	# 2828	[c=9 l=4]  *movdi_internal/3
+	movzbl	(%rdx), %r9d	# 16876	[c=5 l=4]  *movqi_internal/4
+	andl	%edi, %r9d	# 17545	[c=4 l=3]  *andsi_1/0
+	movl	%r9d, %edx	# 13012	[c=4 l=3]  *movqi_internal/2
+	orl	%edx, %eax	# 15000	[c=4 l=2]  *iorsi_1/0
+	leaq	101(%rbx), %rdx	# 15002	[c=4 l=4]  *leadi
+	movb	%al, 101(%rbx)	# 2831	[c=4 l=3]  *movqi_internal/8
+	movl	%edi, %eax	# 13013	[c=4 l=2]  *movqi_internal/1
+	orl	$3, %eax	# 15001	[c=4 l=3]  *iorsi_1/0
+	movq	%rdx, 104(%rbx)	# 2835	[c=4 l=4]  *movdi_internal/5
+	movb	%al, 100(%rbx)	# 2833	[c=4 l=3]  *movqi_internal/8
+	movb	%sil, (%rcx)	# 2836	[c=4 l=3]  *movqi_internal/8
+	movq	1040(%rbx), %rax	# 2837	[c=9 l=7]  *movdi_internal/3
+	movl	%esi, %ecx	# 13016	[c=4 l=2]  *movsi_internal/0
+	movb	%ch, 1(%rax)	# 16878	[c=4 l=3]  *extzvqi_mem_rex64
+	movl	(%rbx), %r15d	# 2840	[c=6 l=3]  *zero_extendsidi2/3
+	movq	%r10, %rcx	# 16476	[c=4 l=3]  *movdi_internal/3
+	movq	%r15, %rdx	# 15347	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 2842	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 2844	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%r15), %eax	# 2845	[c=13 l=5]  *zero_extendqisi2/0
+	movq	(%r15), %r14	# 2848	[c=5 l=3]  *movdi_internal/3
+	addl	%edx, %eax	# 2846	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 16477	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 2847	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 16478	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 16479	[c=4 l=3]  *indirect_jump
+.L714:
+	movq	1040(%rbx), %rax	# 2385	[c=9 l=7]  *movdi_internal/3
+	movl	$91, %edx	# 2387	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%rbx), %edx	# 2388	[c=13 l=6]  *subsi_1/1
+	movzwl	30(%rax), %r13d	# 2386	[c=13 l=5]  *zero_extendhisi2/0
+	cmpl	5180(%rbx), %edx	# 2389	[c=13 l=6]  *cmpsi_1/1
+	jb	.L715	# 2390	[c=13 l=2]  *jcc
+	cmpb	$0, 1082(%rbx)	# 2392	[c=13 l=7]  *cmpqi_ccno_1/1
+	jne	.L716	# 2393	[c=13 l=6]  *jcc
+.L715:
+	movzbl	91(%rax), %edx	# 2396	[c=13 l=4]  *zero_extendqisi2/0
+.L717:
+	movl	992(%rbx), %ecx	# 2407	[c=9 l=6]  *movsi_internal/0
+	sall	$16, %edx	# 2410	[c=4 l=3]  *ashlsi3_1/0
+	orl	%r13d, %edx	# 2411	[c=4 l=3]  *iorsi_1/0
+	leal	1(%rcx,%rcx), %ecx	# 2409	[c=8 l=4]  *leasi
+	andl	%ecx, %edx	# 2412	[c=4 l=2]  *andsi_1/0
+	movq	1056(%rbx), %rcx	# 2414	[c=9 l=7]  *movdi_internal/3
+	movslq	%edx, %rdx	# 2413	[c=4 l=3]  *extendsidi2_rex64/1
+	movzbl	(%rcx,%rdx), %edx	# 2415	[c=9 l=4]  *movqi_internal/4
+	movq	%r10, %rcx	# 16516	[c=4 l=3]  *movdi_internal/3
+	movb	%dl, (%rax)	# 2417	[c=4 l=2]  *movqi_internal/8
+	movl	(%rbx), %r15d	# 2418	[c=6 l=3]  *zero_extendsidi2/3
+	movq	%r15, %rdx	# 15342	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 2420	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 2422	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%r15), %eax	# 2423	[c=13 l=5]  *zero_extendqisi2/0
+	movq	(%r15), %r14	# 2426	[c=5 l=3]  *movdi_internal/3
+	addl	%edx, %eax	# 2424	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 16517	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 2425	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 16518	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 16519	[c=4 l=3]  *indirect_jump
+.L722:
+	movq	1040(%rbx), %rax	# 2480	[c=9 l=7]  *movdi_internal/3
+	movl	$91, %edx	# 2482	[c=4 l=5]  *movsi_internal/0
+	movzbl	10(%r15), %r13d	# 2479	[c=13 l=5]  zero_extendqidi2/0
+	subl	5176(%rbx), %edx	# 2483	[c=13 l=6]  *subsi_1/1
+	movzwl	30(%rax), %r14d	# 2481	[c=13 l=5]  *zero_extendhisi2/0
+	cmpl	5180(%rbx), %edx	# 2484	[c=13 l=6]  *cmpsi_1/1
+	jb	.L723	# 2485	[c=13 l=2]  *jcc
+	cmpb	$0, 1082(%rbx)	# 2487	[c=13 l=7]  *cmpqi_ccno_1/1
+	jne	.L724	# 2488	[c=13 l=6]  *jcc
+.L723:
+	movzbl	91(%rax), %edx	# 2491	[c=13 l=4]  *zero_extendqisi2/0
+.L725:
+	movl	992(%rbx), %ecx	# 2504	[c=9 l=6]  *movsi_internal/0
+	sall	$16, %edx	# 2502	[c=4 l=3]  *ashlsi3_1/0
+	movq	1056(%rbx), %rsi	# 2509	[c=9 l=7]  *movdi_internal/3
+	orl	%r14d, %edx	# 2503	[c=4 l=3]  *iorsi_1/0
+	leal	1(%rcx,%rcx), %ecx	# 2506	[c=8 l=4]  *leasi
+	andl	%edx, %ecx	# 2507	[c=4 l=2]  *andsi_1/0
+	addl	$1, %edx	# 2514	[c=4 l=3]  *addsi_1/0
+	movslq	%ecx, %rcx	# 2508	[c=4 l=3]  *extendsidi2_rex64/1
+	movzbl	(%rsi,%rcx), %ecx	# 2510	[c=9 l=4]  *movqi_internal/4
+	movb	%cl, (%rax,%r13)	# 2513	[c=4 l=4]  *movqi_internal/8
+	movq	1040(%rbx), %rcx	# 2516	[c=9 l=7]  *movdi_internal/3
+	movzwl	%dx, %eax	# 2515	[c=4 l=3]  *zero_extendhisi2/0
+	sarl	$16, %edx	# 2521	[c=4 l=3]  *ashrsi3_1/0
+	movb	%al, 30(%rcx)	# 2517	[c=4 l=3]  *movqi_internal/8
+	movq	1040(%rbx), %rcx	# 2518	[c=9 l=7]  *movdi_internal/3
+	movb	%ah, 31(%rcx)	# 16884	[c=4 l=3]  *extzvqi_mem_rex64
+	movl	$91, %eax	# 2522	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%rbx), %eax	# 2523	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %eax	# 2524	[c=13 l=6]  *cmpsi_1/1
+	jb	.L726	# 2525	[c=13 l=2]  *jcc
+	cmpb	$0, 1082(%rbx)	# 2527	[c=13 l=7]  *cmpqi_ccno_1/1
+	jne	.L727	# 2528	[c=13 l=6]  *jcc
+.L726:
+	movq	1040(%rbx), %rax	# 2531	[c=9 l=7]  *movdi_internal/3
+	movb	%dl, 91(%rax)	# 2532	[c=4 l=3]  *movqi_internal/8
+.L728:
+	movl	(%rbx), %r15d	# 2543	[c=6 l=3]  *zero_extendsidi2/3
+	movq	%r10, %rcx	# 16500	[c=4 l=3]  *movdi_internal/3
+	movq	%r15, %rdx	# 15344	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 2545	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 2547	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%r15), %eax	# 2548	[c=13 l=5]  *zero_extendqisi2/0
+	movq	(%r15), %r14	# 2551	[c=5 l=3]  *movdi_internal/3
+	addl	%edx, %eax	# 2549	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 16501	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 2550	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 16502	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 16503	[c=4 l=3]  *indirect_jump
+.L718:
+	movq	1040(%rbx), %rax	# 2432	[c=9 l=7]  *movdi_internal/3
+	movl	$91, %edx	# 2434	[c=4 l=5]  *movsi_internal/0
+	movzbl	10(%r15), %r13d	# 2431	[c=13 l=5]  zero_extendqidi2/0
+	subl	5176(%rbx), %edx	# 2435	[c=13 l=6]  *subsi_1/1
+	movzwl	30(%rax), %r14d	# 2433	[c=13 l=5]  *zero_extendhisi2/0
+	cmpl	5180(%rbx), %edx	# 2436	[c=13 l=6]  *cmpsi_1/1
+	jb	.L719	# 2437	[c=13 l=2]  *jcc
+	cmpb	$0, 1082(%rbx)	# 2439	[c=13 l=7]  *cmpqi_ccno_1/1
+	jne	.L720	# 2440	[c=13 l=6]  *jcc
+.L719:
+	movzbl	91(%rax), %edx	# 2443	[c=13 l=4]  *zero_extendqisi2/0
+.L721:
+	movl	992(%rbx), %ecx	# 2454	[c=9 l=6]  *movsi_internal/0
+	sall	$16, %edx	# 2457	[c=4 l=3]  *ashlsi3_1/0
+	orl	%r14d, %edx	# 2458	[c=4 l=3]  *iorsi_1/0
+	leal	1(%rcx,%rcx), %ecx	# 2456	[c=8 l=4]  *leasi
+	andl	%ecx, %edx	# 2459	[c=4 l=2]  *andsi_1/0
+	movq	1056(%rbx), %rcx	# 2461	[c=9 l=7]  *movdi_internal/3
+	movslq	%edx, %rdx	# 2460	[c=4 l=3]  *extendsidi2_rex64/1
+	movzbl	(%rcx,%rdx), %edx	# 2462	[c=9 l=4]  *movqi_internal/4
+	movq	%r10, %rcx	# 16508	[c=4 l=3]  *movdi_internal/3
+	movb	%dl, (%rax,%r13)	# 2465	[c=4 l=4]  *movqi_internal/8
+	movl	(%rbx), %r15d	# 2466	[c=6 l=3]  *zero_extendsidi2/3
+	movq	%r15, %rdx	# 15343	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 2468	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 2470	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%r15), %eax	# 2471	[c=13 l=5]  *zero_extendqisi2/0
+	movq	(%r15), %r14	# 2474	[c=5 l=3]  *movdi_internal/3
+	addl	%edx, %eax	# 2472	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 16509	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 2473	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 16510	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 16511	[c=4 l=3]  *indirect_jump
+.L751:
+	movzbl	10(%r15), %eax	# 2854	[c=13 l=5]  zero_extendqidi2/0
+	movzwl	12(%r15), %edx	# 2856	[c=13 l=5]  zero_extendhidi2/0
+	movq	1040(%rbx), %rcx	# 2853	[c=9 l=7]  *movdi_internal/3
+	movzbl	100(%rbx), %edi	# 2861	[c=13 l=4]  *zero_extendqisi2/0
+	movsbl	(%rcx,%rdx), %edx	# 2857	[c=13 l=4]  extendqisi2
+	movsbl	(%rcx,%rax), %eax	# 2855	[c=13 l=4]  extendqisi2
+	andl	$-4, %edi	# 2862	[c=4 l=3]  *andsi_1/0
+	imull	%edx, %eax	# 2858	[c=12 l=3]  *mulsi3_1/2
+	xorl	%edx, %edx	# 16867	[c=4 l=2]  *movsi_xor
+	movzwl	%ax, %eax	# 2859	[c=4 l=3]  *zero_extendhisi2/0
+	movl	%eax, %esi	# 13017	[c=4 l=2]  *movsi_internal/0
+	addl	%esi, %esi	# 16868	[c=4 l=2]  *ashlsi3_cmp
+	sete	%dl	# 16869	[c=4 l=3]  *setcc_qi_slp
+	sarl	$15, %eax	# 2869	[c=4 l=3]  *ashrsi3_1/0
+	addl	%edx, %edx	# 2868	[c=4 l=2]  *ashlsi3_1/0
+	orl	%edx, %eax	# 2870	[c=4 l=2]  *iorsi_1/0
+	movq	104(%rbx), %rdx	# 2871	[c=9 l=4]  *movdi_internal/3
+	movzbl	(%rdx), %r9d	# 16870	[c=5 l=4]  *movqi_internal/4
+	andl	%edi, %r9d	# 17544	[c=4 l=3]  *andsi_1/0
+	movl	%r9d, %edx	# 13020	[c=4 l=3]  *movqi_internal/2
+	orl	%edx, %eax	# 14995	[c=4 l=2]  *iorsi_1/0
+	leaq	101(%rbx), %rdx	# 14997	[c=4 l=4]  *leadi
+	movb	%al, 101(%rbx)	# 2874	[c=4 l=3]  *movqi_internal/8
+	movl	%edi, %eax	# 13021	[c=4 l=2]  *movqi_internal/1
+	orl	$3, %eax	# 14996	[c=4 l=3]  *iorsi_1/0
+	movq	%rdx, 104(%rbx)	# 2878	[c=4 l=4]  *movdi_internal/5
+	movb	%al, 100(%rbx)	# 2876	[c=4 l=3]  *movqi_internal/8
+	movb	%sil, (%rcx)	# 2879	[c=4 l=3]  *movqi_internal/8
+	movq	1040(%rbx), %rax	# 2880	[c=9 l=7]  *movdi_internal/3
+	movl	%esi, %ecx	# 13024	[c=4 l=2]  *movsi_internal/0
+	movb	%ch, 1(%rax)	# 16872	[c=4 l=3]  *extzvqi_mem_rex64
+	movl	(%rbx), %r15d	# 2883	[c=6 l=3]  *zero_extendsidi2/3
+	movq	%r10, %rcx	# 16468	[c=4 l=3]  *movdi_internal/3
+	movq	%r15, %rdx	# 15348	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 2885	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 2887	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%r15), %eax	# 2888	[c=13 l=5]  *zero_extendqisi2/0
+	movq	(%r15), %r14	# 2891	[c=5 l=3]  *movdi_internal/3
+	addl	%edx, %eax	# 2889	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 16469	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 2890	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 16470	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 16471	[c=4 l=3]  *indirect_jump
+.L874:
+	movl	5176(%rbx), %r14d	# 4564	[c=9 l=7]  *movsi_internal/0
+	movzwl	12(%r15), %r13d	# 4563	[c=9 l=5]  *movhi_internal/2
+	movl	$93, %eax	# 4566	[c=4 l=5]  *movsi_internal/0
+	movl	$2, 96(%rbx)	# 4562	[c=4 l=7]  *movsi_internal/1
+	movl	5180(%rbx), %r15d	# 4565	[c=9 l=7]  *movsi_internal/0
+	subl	%r14d, %eax	# 4567	[c=4 l=3]  *subsi_1/0
+	cmpl	%r15d, %eax	# 4568	[c=4 l=3]  *cmpsi_1/0
+	jb	.L875	# 4569	[c=13 l=6]  *jcc
+	cmpb	$1, 1082(%rbx)	# 4573	[c=13 l=7]  *cmpqi_1/0
+	ja	.L1579	# 4574	[c=13 l=6]  *jcc
+	movq	1040(%rbx), %rax	# 11241	[c=9 l=7]  *movdi_internal/3
+	movzbl	93(%rax), %edx	# 11242	[c=13 l=4]  *zero_extendqisi2/0
+.L877:
+	movzbl	94(%rax), %eax	# 4611	[c=13 l=4]  *zero_extendqisi2/0
+.L879:
+	sall	$8, %eax	# 4614	[c=4 l=3]  *ashlsi3_1/0
+	movl	996(%rbx), %ecx	# 4617	[c=9 l=6]  *movsi_internal/0
+	orl	%edx, %eax	# 4615	[c=4 l=2]  *iorsi_1/0
+	movzbl	840(%rbx), %edx	# 4619	[c=13 l=7]  *zero_extendqisi2/0
+	leal	1(%rcx,%rdx), %edx	# 4620	[c=5 l=4]  *leasi
+	cmpl	%edx, %eax	# 4621	[c=4 l=2]  *cmpsi_1/0
+	jb	.L1419	# 4622	[c=13 l=6]  *jcc
+	movl	%eax, %edx	# 13170	[c=4 l=2]  *movsi_internal/0
+	movl	(%rbx), %esi	# 4630	[c=5 l=2]  *movsi_internal/0
+	leal	-1(%rax), %ecx	# 14955	[c=4 l=3]  *leasi
+	subl	%r14d, %edx	# 4632	[c=4 l=3]  *subsi_1/0
+	cmpl	%r15d, %edx	# 4633	[c=4 l=3]  *cmpsi_1/0
+	jb	.L881	# 4634	[c=13 l=2]  *jcc
+	movl	%eax, %edx	# 13172	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %edx	# 4636	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %edx	# 12709	[c=5 l=6]  *andsi_1_zext
+	cmpb	$0, 1080(%rbx,%rdx)	# 4639	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L882	# 4640	[c=13 l=6]  *jcc
+.L881:
+	movq	1040(%rbx), %rdi	# 4644	[c=9 l=7]  *movdi_internal/3
+	movslq	%eax, %rdx	# 4643	[c=4 l=3]  *extendsidi2_rex64/1
+	movb	%sil, (%rdi,%rdx)	# 4645	[c=4 l=4]  *movqi_internal/8
+.L883:
+	movl	(%rbx), %esi	# 13174	[c=5 l=2]  *movsi_internal/0
+	movl	%ecx, %edx	# 13176	[c=4 l=2]  *movsi_internal/0
+	leal	-2(%rax), %r14d	# 14954	[c=4 l=4]  *leasi
+	subl	5176(%rbx), %edx	# 4659	[c=13 l=6]  *subsi_1/1
+	shrl	$8, %esi	# 4657	[c=4 l=3]  *lshrsi3_1/0
+	cmpl	5180(%rbx), %edx	# 4660	[c=13 l=6]  *cmpsi_1/1
+	jb	.L884	# 4661	[c=13 l=2]  *jcc
+	movl	%ecx, %edx	# 13178	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %edx	# 4663	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %edx	# 12708	[c=5 l=6]  *andsi_1_zext
+	cmpb	$0, 1080(%rbx,%rdx)	# 4666	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L885	# 4667	[c=13 l=6]  *jcc
+.L884:
+	movq	1040(%rbx), %rdx	# 4671	[c=9 l=7]  *movdi_internal/3
+	movslq	%ecx, %rcx	# 4670	[c=4 l=3]  *extendsidi2_rex64/1
+	movb	%sil, (%rdx,%rcx)	# 4672	[c=4 l=4]  *movqi_internal/8
+.L886:
+	cmpb	$0, 840(%rbx)	# 4683	[c=13 l=7]  *cmpqi_ccno_1/1
+	je	.L887	# 4684	[c=13 l=2]  *jcc
+	movl	(%rbx), %edx	# 13180	[c=5 l=2]  *movsi_internal/0
+	leal	-3(%rax), %r15d	# 14953	[c=4 l=4]  *leasi
+	movl	%r14d, %eax	# 13182	[c=4 l=3]  *movsi_internal/0
+	subl	5176(%rbx), %eax	# 4689	[c=13 l=6]  *subsi_1/1
+	shrl	$16, %edx	# 4687	[c=4 l=3]  *lshrsi3_1/0
+	cmpl	5180(%rbx), %eax	# 4690	[c=13 l=6]  *cmpsi_1/1
+	jb	.L888	# 4691	[c=13 l=2]  *jcc
+	movl	%r14d, %ecx	# 13184	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %ecx	# 4693	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %ecx	# 12707	[c=5 l=6]  *andsi_1_zext
+	cmpb	$0, 1080(%rbx,%rcx)	# 4696	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L889	# 4697	[c=13 l=6]  *jcc
+.L888:
+	movq	1040(%rbx), %rcx	# 4701	[c=9 l=7]  *movdi_internal/3
+	movslq	%r14d, %rax	# 4700	[c=4 l=3]  *extendsidi2_rex64/1
+	movb	%dl, (%rcx,%rax)	# 4702	[c=4 l=3]  *movqi_internal/8
+.L890:
+	movl	%r15d, %r14d	# 25	[c=4 l=3]  *movsi_internal/0
+.L887:
+	movl	$93, %eax	# 4717	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%rbx), %eax	# 4718	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %eax	# 4719	[c=13 l=6]  *cmpsi_1/1
+	jb	.L891	# 4720	[c=13 l=2]  *jcc
+	cmpb	$1, 1082(%rbx)	# 4724	[c=13 l=7]  *cmpqi_1/0
+	ja	.L1580	# 4725	[c=13 l=6]  *jcc
+.L891:
+	movq	1040(%rbx), %rax	# 4736	[c=9 l=7]  *movdi_internal/3
+	movb	%r14b, 93(%rax)	# 4737	[c=4 l=4]  *movqi_internal/8
+.L892:
+	movl	%r14d, %eax	# 13186	[c=4 l=3]  *movsi_internal/0
+	movl	$94, %edx	# 4741	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%rbx), %edx	# 4742	[c=13 l=6]  *subsi_1/1
+	sarl	$8, %eax	# 4740	[c=4 l=3]  *ashrsi3_1/0
+	cmpl	5180(%rbx), %edx	# 4743	[c=13 l=6]  *cmpsi_1/1
+	jb	.L893	# 4744	[c=13 l=2]  *jcc
+	cmpb	$1, 1082(%rbx)	# 4748	[c=13 l=7]  *cmpqi_1/0
+	ja	.L1581	# 4749	[c=13 l=6]  *jcc
+.L893:
+	movq	1040(%rbx), %rdx	# 4760	[c=9 l=7]  *movdi_internal/3
+	movb	%al, 94(%rdx)	# 4761	[c=4 l=3]  *movqi_internal/8
+.L894:
+	movq	(%rsp), %rdi	# 13188	[c=5 l=4]  *movdi_internal/3
+	movswl	%r13w, %eax	# 4764	[c=4 l=4]  extendhisi2/1
+	addl	(%rbx), %eax	# 4766	[c=9 l=2]  *addsi_1/1
+	andl	992(%rbx), %eax	# 4769	[c=13 l=6]  *andsi_1/1
+	movl	%eax, (%rbx)	# 4770	[c=4 l=2]  *movsi_internal/1
+	leaq	-1(%rdi), %rdx	# 14952	[c=4 l=4]  *leadi
+	movzbl	840(%rbx), %eax	# 4771	[c=13 l=7]  zero_extendqidi2/0
+	addq	48(%rbx), %rax	# 4773	[c=13 l=4]  *adddi_1/1
+	movq	%rax, 48(%rbx)	# 4774	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rbp, %rdx	# 4776	[c=4 l=3]  *cmpdi_1/0
+	jb	.L620	# 4777	[c=13 l=6]  *jcc
+	cmpq	56(%rbx), %rax	# 4779	[c=13 l=4]  *cmpdi_1/1
+	jnb	.L1582	# 4780	[c=13 l=6]  *jcc
+.L895:
+	movl	(%rbx), %r15d	# 4787	[c=6 l=3]  *zero_extendsidi2/3
+	movl	$1, 96(%rbx)	# 4792	[c=4 l=7]  *movsi_internal/1
+	movq	%r10, %rcx	# 16188	[c=4 l=3]  *movdi_internal/3
+	movq	%r15, %rdx	# 15394	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 4789	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 4791	[c=13 l=7]  *adddi_1/1
+	movzbl	11(%r15), %eax	# 4793	[c=13 l=5]  zero_extendqidi2/0
+	movq	(%r15), %r14	# 4801	[c=5 l=3]  *movdi_internal/3
+	addq	%rax, %rbp	# 4794	[c=4 l=3]  *adddi_1/0
+	movzwl	14(%r15), %eax	# 4796	[c=13 l=5]  zero_extendhidi2/0
+	addq	%rax, 48(%rbx)	# 4797	[c=13 l=4]  *adddi_1/0
+	movq	%rbp, 40(%rbx)	# 4795	[c=4 l=4]  *movdi_internal/5
+	movzbl	9(%r15), %eax	# 4798	[c=13 l=5]  *zero_extendqisi2/0
+	addl	%edx, %eax	# 4799	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 16189	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 4800	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 16190	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 16191	[c=4 l=3]  *indirect_jump
+.L629:
+	movzbl	10(%r15), %edx	# 1282	[c=13 l=5]  zero_extendqidi2/0
+	movq	1040(%rbx), %rcx	# 1283	[c=9 l=7]  *movdi_internal/3
+	movzbl	100(%rbx), %eax	# 1279	[c=13 l=4]  *zero_extendqisi2/0
+	movzbl	(%rcx,%rdx), %ecx	# 1284	[c=13 l=4]  *zero_extendqisi2/0
+	movzwl	12(%r15), %edx	# 1285	[c=13 l=5]  *zero_extendhisi2/0
+	andl	$-65, %eax	# 1280	[c=4 l=3]  *andsi_1/0
+	movl	(%rbx), %r15d	# 1299	[c=6 l=3]  *zero_extendsidi2/3
+	testl	%edx, %ecx	# 1287	[c=4 l=2]  *testsi_1/0
+	movq	104(%rbx), %rdx	# 1291	[c=9 l=4]  *movdi_internal/3
+	setne	%cl	# 15031	[c=4 l=3]  *setcc_qi
+	movzbl	(%rdx), %edi	# 16900	[c=5 l=3]  *movqi_internal/4
+	movzbl	%cl, %ecx	# 15032	[c=4 l=3]  *zero_extendqisi2/0
+	sall	$6, %ecx	# 1290	[c=4 l=3]  *ashlsi3_1/0
+	andl	%eax, %edi	# 17543	[c=4 l=2]  *andsi_1/0
+	orl	$64, %eax	# 15034	[c=4 l=3]  *iorsi_1/0
+	movl	%edi, %edx	# 12899	[c=4 l=2]  *movqi_internal/1
+	movb	%al, 100(%rbx)	# 1296	[c=4 l=3]  *movqi_internal/8
+	orl	%ecx, %edx	# 15033	[c=4 l=2]  *iorsi_1/0
+	movq	%r10, %rcx	# 16612	[c=4 l=3]  *movdi_internal/3
+	movb	%dl, 101(%rbx)	# 1294	[c=4 l=3]  *movqi_internal/8
+	leaq	101(%rbx), %rdx	# 15035	[c=4 l=4]  *leadi
+	movq	%rdx, 104(%rbx)	# 1298	[c=4 l=4]  *movdi_internal/5
+	movq	%r15, %rdx	# 15328	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 1301	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 1303	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%r15), %eax	# 1304	[c=13 l=5]  *zero_extendqisi2/0
+	movq	(%r15), %r14	# 1307	[c=5 l=3]  *movdi_internal/3
+	addl	%edx, %eax	# 1305	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 16613	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 1306	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 16614	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 16615	[c=4 l=3]  *indirect_jump
+.L844:
+	movzbl	10(%r15), %eax	# 4150	[c=13 l=5]  zero_extendqidi2/0
+	movq	1040(%rbx), %rcx	# 4149	[c=9 l=7]  *movdi_internal/3
+	movsbl	(%rcx,%rax), %edx	# 4151	[c=13 l=4]  extendqisi2
+	movzwl	12(%r15), %eax	# 4152	[c=13 l=5]  zero_extendhidi2/0
+	movzbl	(%rcx,%rax), %eax	# 4153	[c=13 l=4]  *zero_extendqisi2/0
+	imull	%eax, %edx	# 4154	[c=12 l=3]  *mulsi3_1/2
+	movzbl	100(%rbx), %eax	# 4156	[c=13 l=4]  *zero_extendqisi2/0
+	andl	$-4, %eax	# 4157	[c=4 l=3]  *andsi_1/0
+	movl	%edx, %esi	# 13140	[c=4 l=2]  *movsi_internal/0
+	movl	%eax, %edi	# 13139	[c=4 l=2]  *movsi_internal/0
+	xorl	%eax, %eax	# 16833	[c=4 l=2]  *movsi_xor
+	andl	$65535, %esi	# 16834	[c=4 l=6]  *andsi_2/0
+	sete	%al	# 16835	[c=4 l=3]  *setcc_qi_slp
+	movl	%esi, %edx	# 13142	[c=4 l=2]  *movsi_internal/0
+	sarl	$15, %edx	# 4164	[c=4 l=3]  *ashrsi3_1/0
+	addl	%eax, %eax	# 4163	[c=4 l=2]  *ashlsi3_1/0
+	orl	%edx, %eax	# 4165	[c=4 l=2]  *iorsi_1/0
+	movq	104(%rbx), %rdx	# 4166	[c=9 l=4]  *movdi_internal/3
+	movzbl	(%rdx), %r9d	# 16836	[c=5 l=4]  *movqi_internal/4
+	andl	%edi, %r9d	# 17542	[c=4 l=3]  *andsi_1/0
+	movl	%r9d, %edx	# 13145	[c=4 l=3]  *movqi_internal/2
+	orl	%edx, %eax	# 14965	[c=4 l=2]  *iorsi_1/0
+	leaq	101(%rbx), %rdx	# 14967	[c=4 l=4]  *leadi
+	movb	%al, 101(%rbx)	# 4169	[c=4 l=3]  *movqi_internal/8
+	movl	%edi, %eax	# 13146	[c=4 l=2]  *movqi_internal/1
+	orl	$3, %eax	# 14966	[c=4 l=3]  *iorsi_1/0
+	movq	%rdx, 104(%rbx)	# 4173	[c=4 l=4]  *movdi_internal/5
+	movb	%al, 100(%rbx)	# 4171	[c=4 l=3]  *movqi_internal/8
+	movb	%sil, (%rcx)	# 4174	[c=4 l=3]  *movqi_internal/8
+	movq	1040(%rbx), %rax	# 4175	[c=9 l=7]  *movdi_internal/3
+	movl	%esi, %ecx	# 13149	[c=4 l=2]  *movsi_internal/0
+	movb	%ch, 1(%rax)	# 16838	[c=4 l=3]  *extzvqi_mem_rex64
+	movl	(%rbx), %r15d	# 4178	[c=6 l=3]  *zero_extendsidi2/3
+	movq	%r10, %rcx	# 16252	[c=4 l=3]  *movdi_internal/3
+	movq	%r15, %rdx	# 15384	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 4180	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 4182	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%r15), %eax	# 4183	[c=13 l=5]  *zero_extendqisi2/0
+	movq	(%r15), %r14	# 4186	[c=5 l=3]  *movdi_internal/3
+	addl	%edx, %eax	# 4184	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 16253	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 4185	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 16254	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 16255	[c=4 l=3]  *indirect_jump
+.L841:
+	movzwl	12(%r15), %esi	# 4037	[c=13 l=5]  zero_extendhidi2/0
+	movq	1040(%rbx), %rcx	# 4039	[c=9 l=7]  *movdi_internal/3
+	movzbl	10(%r15), %eax	# 4038	[c=9 l=5]  *movqi_internal/4
+	movzbl	(%rcx,%rsi), %edi	# 4041	[c=9 l=4]  *movqi_internal/4
+	movq	%rsi, %rdx	# 15380	[c=4 l=3]  *movdi_internal/3
+	movzbl	%al, %esi	# 4042	[c=4 l=3]  zero_extendqidi2/0
+	movb	%dil, (%rcx,%rsi)	# 4043	[c=4 l=4]  *movqi_internal/8
+	movq	1040(%rbx), %rcx	# 4044	[c=9 l=7]  *movdi_internal/3
+	movzbl	1(%rcx,%rdx), %edx	# 4048	[c=10 l=5]  *movqi_internal/4
+	movb	%dl, 1(%rcx,%rsi)	# 4052	[c=4 l=4]  *movqi_internal/8
+	movl	(%rbx), %r15d	# 4053	[c=6 l=3]  *zero_extendsidi2/3
+	movq	%r10, %rcx	# 16276	[c=4 l=3]  *movdi_internal/3
+	movq	%r15, %rdx	# 15381	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 4055	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 4057	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%r15), %eax	# 4058	[c=13 l=5]  *zero_extendqisi2/0
+	movq	(%r15), %r14	# 4061	[c=5 l=3]  *movdi_internal/3
+	addl	%edx, %eax	# 4059	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 16277	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 4060	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 16278	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 16279	[c=4 l=3]  *indirect_jump
+.L842:
+	movzbl	10(%r15), %eax	# 4067	[c=13 l=5]  zero_extendqidi2/0
+	movq	1040(%rbx), %rsi	# 4066	[c=9 l=7]  *movdi_internal/3
+	movzbl	(%rsi,%rax), %ecx	# 4068	[c=13 l=4]  *zero_extendqisi2/0
+	movzwl	12(%r15), %eax	# 4069	[c=13 l=5]  zero_extendhidi2/0
+	movzbl	(%rsi,%rax), %eax	# 4070	[c=13 l=4]  *zero_extendqisi2/0
+	imull	%eax, %ecx	# 4071	[c=12 l=3]  *mulsi3_1/2
+	movzbl	100(%rbx), %eax	# 4072	[c=13 l=4]  *zero_extendqisi2/0
+	andl	$-4, %eax	# 4073	[c=4 l=3]  *andsi_1/0
+	cmpl	$1, %ecx	# 4077	[c=4 l=3]  *cmpsi_1/0
+	movl	%eax, %edi	# 13118	[c=4 l=2]  *movsi_internal/0
+	movl	%ecx, %edx	# 13119	[c=4 l=2]  *movsi_internal/0
+	sbbl	%eax, %eax	# 4078	[c=8 l=2]  *x86_movsicc_0_m1_neg
+	sarl	$15, %edx	# 4080	[c=4 l=3]  *ashrsi3_1/0
+	andl	$2, %eax	# 4079	[c=4 l=3]  *andsi_1/0
+	orl	%edx, %eax	# 4081	[c=4 l=2]  *iorsi_1/0
+	movq	104(%rbx), %rdx	# 4082	[c=9 l=4]  *movdi_internal/3
+	movzbl	(%rdx), %r9d	# 16845	[c=5 l=4]  *movqi_internal/4
+	andl	%edi, %r9d	# 17541	[c=4 l=3]  *andsi_1/0
+	movl	%r9d, %edx	# 13122	[c=4 l=3]  *movqi_internal/2
+	orl	%eax, %edx	# 14973	[c=4 l=2]  *iorsi_1/0
+	movl	%edi, %eax	# 13123	[c=4 l=2]  *movqi_internal/1
+	movb	%dl, 101(%rbx)	# 4085	[c=4 l=3]  *movqi_internal/8
+	orl	$3, %eax	# 14974	[c=4 l=3]  *iorsi_1/0
+	leaq	101(%rbx), %rdx	# 14975	[c=4 l=4]  *leadi
+	movb	%al, 100(%rbx)	# 4087	[c=4 l=3]  *movqi_internal/8
+	movq	%rdx, 104(%rbx)	# 4089	[c=4 l=4]  *movdi_internal/5
+	movb	%cl, (%rsi)	# 4090	[c=4 l=2]  *movqi_internal/8
+	movq	1040(%rbx), %rax	# 4091	[c=9 l=7]  *movdi_internal/3
+	movb	%ch, 1(%rax)	# 16847	[c=4 l=3]  *extzvqi_mem_rex64
+	movl	(%rbx), %r15d	# 4094	[c=6 l=3]  *zero_extendsidi2/3
+	movq	%r10, %rcx	# 16268	[c=4 l=3]  *movdi_internal/3
+	movq	%r15, %rdx	# 15382	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 4096	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 4098	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%r15), %eax	# 4099	[c=13 l=5]  *zero_extendqisi2/0
+	movq	(%r15), %r14	# 4102	[c=5 l=3]  *movdi_internal/3
+	addl	%edx, %eax	# 4100	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 16269	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 4101	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 16270	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 16271	[c=4 l=3]  *indirect_jump
+.L843:
+	movzbl	10(%r15), %eax	# 4108	[c=13 l=5]  zero_extendqidi2/0
+	movq	1040(%rbx), %rcx	# 4107	[c=9 l=7]  *movdi_internal/3
+	movsbl	(%rcx,%rax), %edx	# 4109	[c=13 l=4]  extendqisi2
+	movzwl	12(%r15), %eax	# 4110	[c=13 l=5]  zero_extendhidi2/0
+	movsbl	(%rcx,%rax), %eax	# 4111	[c=13 l=4]  extendqisi2
+	imull	%eax, %edx	# 4112	[c=12 l=3]  *mulsi3_1/2
+	movzbl	100(%rbx), %eax	# 4114	[c=13 l=4]  *zero_extendqisi2/0
+	andl	$-4, %eax	# 4115	[c=4 l=3]  *andsi_1/0
+	movl	%edx, %esi	# 13128	[c=4 l=2]  *movsi_internal/0
+	movl	%eax, %edi	# 13127	[c=4 l=2]  *movsi_internal/0
+	xorl	%eax, %eax	# 16839	[c=4 l=2]  *movsi_xor
+	andl	$65535, %esi	# 16840	[c=4 l=6]  *andsi_2/0
+	sete	%al	# 16841	[c=4 l=3]  *setcc_qi_slp
+	movl	%esi, %edx	# 13130	[c=4 l=2]  *movsi_internal/0
+	sarl	$15, %edx	# 4122	[c=4 l=3]  *ashrsi3_1/0
+	addl	%eax, %eax	# 4121	[c=4 l=2]  *ashlsi3_1/0
+	orl	%edx, %eax	# 4123	[c=4 l=2]  *iorsi_1/0
+	movq	104(%rbx), %rdx	# 4124	[c=9 l=4]  *movdi_internal/3
+	movzbl	(%rdx), %r9d	# 16842	[c=5 l=4]  *movqi_internal/4
+	andl	%edi, %r9d	# 17540	[c=4 l=3]  *andsi_1/0
+	movl	%r9d, %edx	# 13133	[c=4 l=3]  *movqi_internal/2
+	orl	%edx, %eax	# 14970	[c=4 l=2]  *iorsi_1/0
+	leaq	101(%rbx), %rdx	# 14972	[c=4 l=4]  *leadi
+	movb	%al, 101(%rbx)	# 4127	[c=4 l=3]  *movqi_internal/8
+	movl	%edi, %eax	# 13134	[c=4 l=2]  *movqi_internal/1
+	orl	$3, %eax	# 14971	[c=4 l=3]  *iorsi_1/0
+	movq	%rdx, 104(%rbx)	# 4131	[c=4 l=4]  *movdi_internal/5
+	movb	%al, 100(%rbx)	# 4129	[c=4 l=3]  *movqi_internal/8
+	movb	%sil, (%rcx)	# 4132	[c=4 l=3]  *movqi_internal/8
+	movq	1040(%rbx), %rax	# 4133	[c=9 l=7]  *movdi_internal/3
+	movl	%esi, %ecx	# 13137	[c=4 l=2]  *movsi_internal/0
+	movb	%ch, 1(%rax)	# 16844	[c=4 l=3]  *extzvqi_mem_rex64
+	movl	(%rbx), %r15d	# 4136	[c=6 l=3]  *zero_extendsidi2/3
+	movq	%r10, %rcx	# 16260	[c=4 l=3]  *movdi_internal/3
+	movq	%r15, %rdx	# 15383	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 4138	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 4140	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%r15), %eax	# 4141	[c=13 l=5]  *zero_extendqisi2/0
+	movq	(%r15), %r14	# 4144	[c=5 l=3]  *movdi_internal/3
+	addl	%edx, %eax	# 4142	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 16261	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 4143	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 16262	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 16263	[c=4 l=3]  *indirect_jump
+.L845:
+	movzbl	10(%r15), %edx	# 4191	[c=13 l=5]  zero_extendqidi2/0
+	addq	1040(%rbx), %rdx	# 4193	[c=13 l=7]  *adddi_1/1
+	movzbl	(%rdx), %ecx	# 4194	[c=9 l=3]  *zero_extendqisi2/0
+	movl	%ecx, %eax	# 15385	[c=4 l=2]  *movsi_internal/0
+	negl	%ecx	# 4196	[c=4 l=2]  *negsi_1
+	andl	$136, %eax	# 4199	[c=4 l=5]  *andsi_1/0
+	movb	%cl, (%rdx)	# 4197	[c=4 l=2]  *movqi_internal/8
+	andl	$511, %ecx	# 4202	[c=4 l=6]  *andsi_1/0
+	imull	$260, %eax, %edx	# 4200	[c=12 l=6]  *mulsi3_1/1
+	andl	$7680, %edx	# 4201	[c=4 l=6]  *andsi_1/0
+	orl	%ecx, %edx	# 4203	[c=5 l=2]  *iorsi_1_zext
+	movzbl	100(%rbx), %ecx	# 4204	[c=9 l=4]  *movqi_internal/4
+	movl	%ecx, %eax	# 13150	[c=4 l=2]  *movsi_internal/0
+	andl	$192, %eax	# 4207	[c=4 l=5]  *andsi_2/0
+	jne	.L846	# 4208	[c=13 l=6]  *jcc
+	leaq	flag_update_table_sub8(%rip), %rax	# 4211	[c=1 l=7]  *movdi_internal/4
+	movl	$63, %ecx	# 22	[c=4 l=5]  *movqi_internal/3
+	addq	%rdx, %rax	# 4212	[c=4 l=3]  *adddi_1/0
+.L847:
+	movl	(%rbx), %r15d	# 4231	[c=6 l=3]  *zero_extendsidi2/3
+	movb	%cl, 100(%rbx)	# 4230	[c=4 l=3]  *movqi_internal/8
+	movq	%r10, %rcx	# 16244	[c=4 l=3]  *movdi_internal/3
+	movq	%rax, 104(%rbx)	# 4229	[c=4 l=4]  *movdi_internal/5
+	movq	%r15, %rdx	# 15386	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 4233	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 4235	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%r15), %eax	# 4236	[c=13 l=5]  *zero_extendqisi2/0
+	movq	(%r15), %r14	# 4239	[c=5 l=3]  *movdi_internal/3
+	addl	%edx, %eax	# 4237	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 16245	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 4238	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 16246	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 16247	[c=4 l=3]  *indirect_jump
+.L848:
+	movl	(%rbx), %r15d	# 4244	[c=6 l=3]  *zero_extendsidi2/3
+	movq	%r10, %rcx	# 16236	[c=4 l=3]  *movdi_internal/3
+	movq	%r15, %rdx	# 15387	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 4246	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 4248	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%r15), %eax	# 4249	[c=13 l=5]  *zero_extendqisi2/0
+	movq	(%r15), %r14	# 4252	[c=5 l=3]  *movdi_internal/3
+	addl	%edx, %eax	# 4250	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 16237	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 4251	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 16238	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 16239	[c=4 l=3]  *indirect_jump
+.L849:
+	movq	1040(%rbx), %rax	# 4257	[c=9 l=7]  *movdi_internal/3
+	movzbl	10(%r15), %edx	# 4258	[c=13 l=5]  zero_extendqidi2/0
+	movzwl	12(%r15), %ecx	# 4260	[c=13 l=5]  zero_extendhidi2/0
+	addq	%rax, %rdx	# 4259	[c=4 l=3]  *adddi_1/0
+	movzbl	(%rax,%rcx), %eax	# 4261	[c=9 l=4]  *movqi_internal/4
+	orb	(%rdx), %al	# 4262	[c=9 l=2]  *iorqi_1/1
+	movb	%al, (%rdx)	# 4263	[c=4 l=2]  *movqi_internal/8
+	movzbl	100(%rbx), %edx	# 4264	[c=9 l=4]  *movqi_internal/4
+	movl	%edx, %ecx	# 13156	[c=4 l=2]  *movsi_internal/0
+	andl	$225, %ecx	# 4267	[c=4 l=6]  *andsi_2/0
+	jne	.L850	# 4268	[c=13 l=6]  *jcc
+	leaq	flag_update_table_logical(%rip), %rdx	# 4271	[c=1 l=7]  *movdi_internal/4
+	movzbl	%al, %eax	# 4270	[c=4 l=3]  zero_extendqidi2/0
+	addq	%rdx, %rax	# 4272	[c=4 l=3]  *adddi_1/0
+	movl	$30, %edx	# 23	[c=4 l=5]  *movqi_internal/3
+.L851:
+	movl	(%rbx), %r15d	# 4292	[c=6 l=3]  *zero_extendsidi2/3
+	movb	%dl, 100(%rbx)	# 4291	[c=4 l=3]  *movqi_internal/8
+	movq	%r10, %rcx	# 16228	[c=4 l=3]  *movdi_internal/3
+	movq	%rax, 104(%rbx)	# 4290	[c=4 l=4]  *movdi_internal/5
+	movq	%r15, %rdx	# 15388	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 4294	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 4296	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%r15), %eax	# 4297	[c=13 l=5]  *zero_extendqisi2/0
+	movq	(%r15), %r14	# 4300	[c=5 l=3]  *movdi_internal/3
+	addl	%edx, %eax	# 4298	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 16229	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 4299	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 16230	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 16231	[c=4 l=3]  *indirect_jump
+.L852:
+	movzbl	10(%r15), %edx	# 4305	[c=13 l=5]  zero_extendqidi2/0
+	addq	1040(%rbx), %rdx	# 4307	[c=13 l=7]  *adddi_1/1
+	movzbl	(%rdx), %ecx	# 4309	[c=9 l=3]  *zero_extendqisi2/0
+	movzwl	12(%r15), %eax	# 4308	[c=13 l=5]  *zero_extendhisi2/0
+	orl	%ecx, %eax	# 4310	[c=4 l=2]  *iorsi_1/0
+	movb	%al, (%rdx)	# 4311	[c=4 l=2]  *movqi_internal/8
+	movzbl	100(%rbx), %edx	# 4312	[c=9 l=4]  *movqi_internal/4
+	movl	%edx, %ecx	# 13158	[c=4 l=2]  *movsi_internal/0
+	andl	$225, %ecx	# 4315	[c=4 l=6]  *andsi_2/0
+	jne	.L853	# 4316	[c=13 l=6]  *jcc
+	leaq	flag_update_table_logical(%rip), %rdx	# 4319	[c=1 l=7]  *movdi_internal/4
+	cltq	# 4318	[c=4 l=2]  *extendsidi2_rex64/0
+	addq	%rdx, %rax	# 4320	[c=4 l=3]  *adddi_1/0
+	movl	$30, %edx	# 24	[c=4 l=5]  *movqi_internal/3
+.L854:
+	movl	(%rbx), %r15d	# 4339	[c=6 l=3]  *zero_extendsidi2/3
+	movb	%dl, 100(%rbx)	# 4338	[c=4 l=3]  *movqi_internal/8
+	movq	%r10, %rcx	# 16220	[c=4 l=3]  *movdi_internal/3
+	movq	%rax, 104(%rbx)	# 4337	[c=4 l=4]  *movdi_internal/5
+	movq	%r15, %rdx	# 15389	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 4341	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 4343	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%r15), %eax	# 4344	[c=13 l=5]  *zero_extendqisi2/0
+	movq	(%r15), %r14	# 4347	[c=5 l=3]  *movdi_internal/3
+	addl	%edx, %eax	# 4345	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 16221	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 4346	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 16222	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 16223	[c=4 l=3]  *indirect_jump
+.L896:
+	movl	5176(%rbx), %r15d	# 4807	[c=9 l=7]  *movsi_internal/0
+	movl	$93, %eax	# 4809	[c=4 l=5]  *movsi_internal/0
+	movl	5180(%rbx), %edx	# 4808	[c=9 l=6]  *movsi_internal/0
+	movl	$2, 96(%rbx)	# 4806	[c=4 l=7]  *movsi_internal/1
+	subl	%r15d, %eax	# 4810	[c=4 l=3]  *subsi_1/0
+	cmpl	%edx, %eax	# 4811	[c=4 l=2]  *cmpsi_1/0
+	jb	.L897	# 4812	[c=13 l=6]  *jcc
+	cmpb	$1, 1082(%rbx)	# 4816	[c=13 l=7]  *cmpqi_1/0
+	ja	.L1583	# 4817	[c=13 l=6]  *jcc
+	movq	1040(%rbx), %rax	# 11247	[c=9 l=7]  *movdi_internal/3
+	movzbl	93(%rax), %r14d	# 11248	[c=13 l=5]  *zero_extendqisi2/0
+.L899:
+	movzbl	94(%rax), %r13d	# 4854	[c=13 l=5]  *zero_extendqisi2/0
+.L901:
+	sall	$8, %r13d	# 4857	[c=4 l=4]  *ashlsi3_1/0
+	orl	%r14d, %r13d	# 4858	[c=4 l=3]  *iorsi_1/0
+	xorl	%r14d, %r14d	# 16830	[c=4 l=3]  *movdi_xor
+	cmpb	$0, 840(%rbx)	# 4859	[c=13 l=7]  *cmpqi_ccno_1/1
+	je	.L902	# 4860	[c=13 l=2]  *jcc
+	addl	$1, %r13d	# 4862	[c=4 l=4]  *addsi_1/0
+	movl	%r13d, %eax	# 13189	[c=4 l=3]  *movsi_internal/0
+	subl	%r15d, %eax	# 4863	[c=4 l=3]  *subsi_1/0
+	cmpl	%edx, %eax	# 4864	[c=4 l=2]  *cmpsi_1/0
+	jb	.L903	# 4865	[c=13 l=2]  *jcc
+	movl	%r13d, %eax	# 13191	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %eax	# 4867	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 12706	[c=5 l=5]  *andsi_1_zext
+	cmpb	$0, 1080(%rbx,%rax)	# 4870	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L904	# 4871	[c=13 l=6]  *jcc
+.L903:
+	movq	1040(%rbx), %rdx	# 4875	[c=9 l=7]  *movdi_internal/3
+	movslq	%r13d, %rax	# 4874	[c=4 l=3]  *extendsidi2_rex64/1
+	movzbl	(%rdx,%rax), %r14d	# 4876	[c=13 l=5]  *zero_extendqisi2/0
+.L905:
+	sall	$16, %r14d	# 4887	[c=4 l=4]  *ashlsi3_1/0
+.L902:
+	leal	1(%r13), %esi	# 14951	[c=4 l=4]  *leasi
+	movl	%esi, %eax	# 13193	[c=4 l=2]  *movsi_internal/0
+	subl	5176(%rbx), %eax	# 4891	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %eax	# 4892	[c=13 l=6]  *cmpsi_1/1
+	jb	.L906	# 4893	[c=13 l=2]  *jcc
+	movl	%esi, %eax	# 13195	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %eax	# 4895	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 12705	[c=5 l=5]  *andsi_1_zext
+	cmpb	$0, 1080(%rbx,%rax)	# 4898	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L907	# 4899	[c=13 l=6]  *jcc
+.L906:
+	movq	1040(%rbx), %rax	# 4903	[c=9 l=7]  *movdi_internal/3
+	movslq	%esi, %rsi	# 4902	[c=4 l=3]  *extendsidi2_rex64/1
+	movzbl	(%rax,%rsi), %eax	# 4904	[c=13 l=4]  *zero_extendqisi2/0
+.L908:
+	sall	$8, %eax	# 4915	[c=4 l=3]  *ashlsi3_1/0
+	addl	$2, %r13d	# 4917	[c=4 l=4]  *addsi_1/0
+	orl	%r14d, %eax	# 4916	[c=4 l=3]  *iorsi_1/0
+	movl	%eax, %r15d	# 13198	[c=4 l=3]  *movsi_internal/0
+	movl	%r13d, %eax	# 13199	[c=4 l=3]  *movsi_internal/0
+	subl	5176(%rbx), %eax	# 4918	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %eax	# 4919	[c=13 l=6]  *cmpsi_1/1
+	jb	.L909	# 4920	[c=13 l=2]  *jcc
+	movl	%r13d, %eax	# 13201	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %eax	# 4922	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 12704	[c=5 l=5]  *andsi_1_zext
+	cmpb	$0, 1080(%rbx,%rax)	# 4925	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L910	# 4926	[c=13 l=6]  *jcc
+.L909:
+	movq	1040(%rbx), %rdx	# 4930	[c=9 l=7]  *movdi_internal/3
+	movslq	%r13d, %rax	# 4929	[c=4 l=3]  *extendsidi2_rex64/1
+	movzbl	(%rdx,%rax), %r14d	# 4931	[c=13 l=5]  *zero_extendqisi2/0
+.L911:
+	orl	%r15d, %r14d	# 4942	[c=4 l=3]  *iorsi_1/0
+	cmpl	%r14d, 992(%rbx)	# 4943	[c=13 l=7]  *cmpsi_1/0
+	jb	.L1418	# 4944	[c=13 l=6]  *jcc
+	movl	$93, %eax	# 4952	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%rbx), %eax	# 4953	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %eax	# 4954	[c=13 l=6]  *cmpsi_1/1
+	jb	.L913	# 4955	[c=13 l=2]  *jcc
+	cmpb	$1, 1082(%rbx)	# 4959	[c=13 l=7]  *cmpqi_1/0
+	ja	.L1584	# 4960	[c=13 l=6]  *jcc
+.L913:
+	movq	1040(%rbx), %rax	# 4971	[c=9 l=7]  *movdi_internal/3
+	movb	%r13b, 93(%rax)	# 4972	[c=4 l=4]  *movqi_internal/8
+.L914:
+	movl	$94, %eax	# 4976	[c=4 l=5]  *movsi_internal/0
+	sarl	$8, %r13d	# 4975	[c=4 l=4]  *ashrsi3_1/0
+	subl	5176(%rbx), %eax	# 4977	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %eax	# 4978	[c=13 l=6]  *cmpsi_1/1
+	jb	.L915	# 4979	[c=13 l=2]  *jcc
+	cmpb	$1, 1082(%rbx)	# 4983	[c=13 l=7]  *cmpqi_1/0
+	ja	.L1585	# 4984	[c=13 l=6]  *jcc
+.L915:
+	movq	1040(%rbx), %rax	# 4995	[c=9 l=7]  *movdi_internal/3
+	movb	%r13b, 94(%rax)	# 4996	[c=4 l=4]  *movqi_internal/8
+.L916:
+	movq	(%rsp), %rdi	# 13203	[c=5 l=4]  *movdi_internal/3
+	movzbl	840(%rbx), %eax	# 5000	[c=13 l=7]  zero_extendqidi2/0
+	movl	%r14d, (%rbx)	# 4999	[c=4 l=3]  *movsi_internal/1
+	addq	48(%rbx), %rax	# 5002	[c=13 l=4]  *adddi_1/1
+	leaq	-1(%rdi), %rdx	# 14950	[c=4 l=4]  *leadi
+	movq	%rax, 48(%rbx)	# 5003	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rbp, %rdx	# 5005	[c=4 l=3]  *cmpdi_1/0
+	jb	.L620	# 5006	[c=13 l=6]  *jcc
+	cmpq	56(%rbx), %rax	# 5008	[c=13 l=4]  *cmpdi_1/1
+	jnb	.L1586	# 5009	[c=13 l=6]  *jcc
+.L917:
+	movl	(%rbx), %r15d	# 5016	[c=6 l=3]  *zero_extendsidi2/3
+	movl	$1, 96(%rbx)	# 5021	[c=4 l=7]  *movsi_internal/1
+	movq	%r10, %rcx	# 16180	[c=4 l=3]  *movdi_internal/3
+	movq	%r15, %rdx	# 15395	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 5018	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 5020	[c=13 l=7]  *adddi_1/1
+	movzbl	11(%r15), %eax	# 5022	[c=13 l=5]  zero_extendqidi2/0
+	movq	(%r15), %r14	# 5030	[c=5 l=3]  *movdi_internal/3
+	addq	%rax, %rbp	# 5023	[c=4 l=3]  *adddi_1/0
+	movzwl	14(%r15), %eax	# 5025	[c=13 l=5]  zero_extendhidi2/0
+	addq	%rax, 48(%rbx)	# 5026	[c=13 l=4]  *adddi_1/0
+	movq	%rbp, 40(%rbx)	# 5024	[c=4 l=4]  *movdi_internal/5
+	movzbl	9(%r15), %eax	# 5027	[c=13 l=5]  *zero_extendqisi2/0
+	addl	%edx, %eax	# 5028	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 16181	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 5029	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 16182	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 16183	[c=4 l=3]  *indirect_jump
+.L918:
+	movl	5176(%rbx), %r15d	# 5036	[c=9 l=7]  *movsi_internal/0
+	movl	$93, %eax	# 5038	[c=4 l=5]  *movsi_internal/0
+	movl	5180(%rbx), %edx	# 5037	[c=9 l=6]  *movsi_internal/0
+	movl	$2, 96(%rbx)	# 5035	[c=4 l=7]  *movsi_internal/1
+	subl	%r15d, %eax	# 5039	[c=4 l=3]  *subsi_1/0
+	cmpl	%edx, %eax	# 5040	[c=4 l=2]  *cmpsi_1/0
+	jb	.L919	# 5041	[c=13 l=6]  *jcc
+	cmpb	$1, 1082(%rbx)	# 5045	[c=13 l=7]  *cmpqi_1/0
+	ja	.L1587	# 5046	[c=13 l=6]  *jcc
+	movq	1040(%rbx), %rax	# 11253	[c=9 l=7]  *movdi_internal/3
+	movzbl	93(%rax), %r14d	# 11254	[c=13 l=5]  *zero_extendqisi2/0
+.L921:
+	movzbl	94(%rax), %r13d	# 5083	[c=13 l=5]  *zero_extendqisi2/0
+.L923:
+	sall	$8, %r13d	# 5086	[c=4 l=4]  *ashlsi3_1/0
+	orl	%r14d, %r13d	# 5087	[c=4 l=3]  *iorsi_1/0
+	xorl	%r14d, %r14d	# 16827	[c=4 l=3]  *movdi_xor
+	cmpb	$0, 840(%rbx)	# 5088	[c=13 l=7]  *cmpqi_ccno_1/1
+	je	.L924	# 5089	[c=13 l=2]  *jcc
+	addl	$1, %r13d	# 5091	[c=4 l=4]  *addsi_1/0
+	movl	%r13d, %eax	# 13204	[c=4 l=3]  *movsi_internal/0
+	subl	%r15d, %eax	# 5092	[c=4 l=3]  *subsi_1/0
+	cmpl	%edx, %eax	# 5093	[c=4 l=2]  *cmpsi_1/0
+	jb	.L925	# 5094	[c=13 l=2]  *jcc
+	movl	%r13d, %eax	# 13206	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %eax	# 5096	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 12703	[c=5 l=5]  *andsi_1_zext
+	cmpb	$0, 1080(%rbx,%rax)	# 5099	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L926	# 5100	[c=13 l=6]  *jcc
+.L925:
+	movq	1040(%rbx), %rdx	# 5104	[c=9 l=7]  *movdi_internal/3
+	movslq	%r13d, %rax	# 5103	[c=4 l=3]  *extendsidi2_rex64/1
+	movzbl	(%rdx,%rax), %r14d	# 5105	[c=13 l=5]  *zero_extendqisi2/0
+.L927:
+	sall	$16, %r14d	# 5116	[c=4 l=4]  *ashlsi3_1/0
+.L924:
+	leal	1(%r13), %esi	# 14949	[c=4 l=4]  *leasi
+	movl	%esi, %eax	# 13208	[c=4 l=2]  *movsi_internal/0
+	subl	5176(%rbx), %eax	# 5120	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %eax	# 5121	[c=13 l=6]  *cmpsi_1/1
+	jb	.L928	# 5122	[c=13 l=2]  *jcc
+	movl	%esi, %eax	# 13210	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %eax	# 5124	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 12702	[c=5 l=5]  *andsi_1_zext
+	cmpb	$0, 1080(%rbx,%rax)	# 5127	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L929	# 5128	[c=13 l=6]  *jcc
+.L928:
+	movq	1040(%rbx), %rax	# 5132	[c=9 l=7]  *movdi_internal/3
+	movslq	%esi, %rsi	# 5131	[c=4 l=3]  *extendsidi2_rex64/1
+	movzbl	(%rax,%rsi), %eax	# 5133	[c=13 l=4]  *zero_extendqisi2/0
+.L930:
+	sall	$8, %eax	# 5144	[c=4 l=3]  *ashlsi3_1/0
+	addl	$2, %r13d	# 5146	[c=4 l=4]  *addsi_1/0
+	orl	%r14d, %eax	# 5145	[c=4 l=3]  *iorsi_1/0
+	movl	%eax, %r15d	# 13213	[c=4 l=3]  *movsi_internal/0
+	movl	%r13d, %eax	# 13214	[c=4 l=3]  *movsi_internal/0
+	subl	5176(%rbx), %eax	# 5147	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %eax	# 5148	[c=13 l=6]  *cmpsi_1/1
+	jb	.L931	# 5149	[c=13 l=2]  *jcc
+	movl	%r13d, %eax	# 13216	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %eax	# 5151	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 12701	[c=5 l=5]  *andsi_1_zext
+	cmpb	$0, 1080(%rbx,%rax)	# 5154	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L932	# 5155	[c=13 l=6]  *jcc
+.L931:
+	movq	1040(%rbx), %rdx	# 5159	[c=9 l=7]  *movdi_internal/3
+	movslq	%r13d, %rax	# 5158	[c=4 l=3]  *extendsidi2_rex64/1
+	movzbl	(%rdx,%rax), %r14d	# 5160	[c=13 l=5]  *zero_extendqisi2/0
+.L933:
+	orl	%r15d, %r14d	# 5171	[c=4 l=3]  *iorsi_1/0
+	cmpl	%r14d, 992(%rbx)	# 5172	[c=13 l=7]  *cmpsi_1/0
+	jb	.L1418	# 5173	[c=13 l=6]  *jcc
+	movl	$93, %eax	# 5181	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%rbx), %eax	# 5182	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %eax	# 5183	[c=13 l=6]  *cmpsi_1/1
+	jb	.L935	# 5184	[c=13 l=2]  *jcc
+	cmpb	$1, 1082(%rbx)	# 5188	[c=13 l=7]  *cmpqi_1/0
+	ja	.L1588	# 5189	[c=13 l=6]  *jcc
+.L935:
+	movq	1040(%rbx), %rax	# 5200	[c=9 l=7]  *movdi_internal/3
+	movb	%r13b, 93(%rax)	# 5201	[c=4 l=4]  *movqi_internal/8
+.L936:
+	movl	$94, %eax	# 5205	[c=4 l=5]  *movsi_internal/0
+	sarl	$8, %r13d	# 5204	[c=4 l=4]  *ashrsi3_1/0
+	subl	5176(%rbx), %eax	# 5206	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %eax	# 5207	[c=13 l=6]  *cmpsi_1/1
+	jb	.L937	# 5208	[c=13 l=2]  *jcc
+	cmpb	$1, 1082(%rbx)	# 5212	[c=13 l=7]  *cmpqi_1/0
+	ja	.L1589	# 5213	[c=13 l=6]  *jcc
+.L937:
+	movq	1040(%rbx), %rax	# 5224	[c=9 l=7]  *movdi_internal/3
+	movb	%r13b, 94(%rax)	# 5225	[c=4 l=4]  *movqi_internal/8
+.L938:
+	movq	104(%rbx), %rdx	# 5236	[c=9 l=4]  *movdi_internal/3
+	movzbl	100(%rbx), %eax	# 5233	[c=13 l=4]  *zero_extendqisi2/0
+	movl	%r14d, (%rbx)	# 5228	[c=4 l=3]  *movsi_internal/1
+	movzbl	840(%rbx), %ecx	# 5229	[c=13 l=7]  zero_extendqidi2/0
+	addq	48(%rbx), %rcx	# 5231	[c=13 l=4]  *adddi_1/1
+	movq	%rcx, 48(%rbx)	# 5232	[c=4 l=4]  *movdi_internal/5
+	movzbl	(%rdx), %edi	# 16825	[c=5 l=3]  *movqi_internal/4
+	andb	$127, %al	# 14943	[c=4 l=2]  *andqi_1_slp/0
+	movq	%rcx, 6024(%rbx)	# 5244	[c=4 l=7]  *movdi_internal/5
+	andl	%eax, %edi	# 17539	[c=4 l=2]  *andsi_1/0
+	orl	$-128, %eax	# 14947	[c=4 l=3]  *iorsi_1/0
+	movb	%al, 100(%rbx)	# 5241	[c=4 l=3]  *movqi_internal/8
+	movl	%edi, %edx	# 13219	[c=4 l=2]  *movqi_internal/1
+	movq	(%rsp), %rax	# 13220	[c=5 l=4]  *movdi_internal/3
+	orl	$-128, %edx	# 14946	[c=4 l=3]  *iorsi_1/0
+	movb	%dl, 101(%rbx)	# 5239	[c=4 l=3]  *movqi_internal/8
+	subq	$1, %rax	# 5245	[c=4 l=4]  *adddi_1/0
+	leaq	101(%rbx), %rdx	# 14948	[c=4 l=4]  *leadi
+	movq	%rdx, 104(%rbx)	# 5243	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rbp, %rax	# 5246	[c=4 l=3]  *cmpdi_1/0
+	jb	.L620	# 5247	[c=13 l=6]  *jcc
+	cmpq	56(%rbx), %rcx	# 5249	[c=13 l=4]  *cmpdi_1/1
+	jnb	.L1590	# 5250	[c=13 l=6]  *jcc
+.L939:
+	movl	(%rbx), %r15d	# 5257	[c=6 l=3]  *zero_extendsidi2/3
+	movl	$1, 96(%rbx)	# 5262	[c=4 l=7]  *movsi_internal/1
+	movq	%r10, %rcx	# 16172	[c=4 l=3]  *movdi_internal/3
+	movq	%r15, %rdx	# 15396	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 5259	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 5261	[c=13 l=7]  *adddi_1/1
+	movzbl	11(%r15), %eax	# 5263	[c=13 l=5]  zero_extendqidi2/0
+	movq	(%r15), %r14	# 5271	[c=5 l=3]  *movdi_internal/3
+	addq	%rax, %rbp	# 5264	[c=4 l=3]  *adddi_1/0
+	movzwl	14(%r15), %eax	# 5266	[c=13 l=5]  zero_extendhidi2/0
+	addq	%rax, 48(%rbx)	# 5267	[c=13 l=4]  *adddi_1/0
+	movq	%rbp, 40(%rbx)	# 5265	[c=4 l=4]  *movdi_internal/5
+	movzbl	9(%r15), %eax	# 5268	[c=13 l=5]  *zero_extendqisi2/0
+	addl	%edx, %eax	# 5269	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 16173	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 5270	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 16174	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 16175	[c=4 l=3]  *indirect_jump
+.L940:
+	movswl	12(%r15), %eax	# 5277	[c=13 l=5]  extendhisi2/1
+	movl	$2, 96(%rbx)	# 5276	[c=4 l=7]  *movsi_internal/1
+	cmpw	$-1, %ax	# 5278	[c=4 l=4]  *cmphi_1/0
+	je	.L1591	# 5279	[c=13 l=6]  *jcc
+	addl	(%rbx), %eax	# 5292	[c=9 l=2]  *addsi_1/1
+	andl	992(%rbx), %eax	# 5295	[c=13 l=6]  *andsi_1/1
+	movl	%eax, (%rbx)	# 5296	[c=4 l=2]  *movsi_internal/1
+	movq	(%rsp), %rax	# 13221	[c=5 l=4]  *movdi_internal/3
+	subq	$1, %rax	# 5297	[c=4 l=4]  *adddi_1/0
+	cmpq	%rbp, %rax	# 5298	[c=4 l=3]  *cmpdi_1/0
+	jb	.L620	# 5299	[c=13 l=6]  *jcc
+	movq	56(%rbx), %rax	# 13222	[c=9 l=4]  *movdi_internal/3
+	cmpq	%rax, 48(%rbx)	# 5302	[c=13 l=4]  *cmpdi_1/0
+	jnb	.L1592	# 5303	[c=13 l=6]  *jcc
+.L942:
+	movl	(%rbx), %r15d	# 5310	[c=6 l=3]  *zero_extendsidi2/3
+	movl	$1, 96(%rbx)	# 5315	[c=4 l=7]  *movsi_internal/1
+	movq	%r10, %rcx	# 16164	[c=4 l=3]  *movdi_internal/3
+	movq	%r15, %rdx	# 15397	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 5312	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 5314	[c=13 l=7]  *adddi_1/1
+	movzbl	11(%r15), %eax	# 5316	[c=13 l=5]  zero_extendqidi2/0
+	movq	(%r15), %r14	# 5324	[c=5 l=3]  *movdi_internal/3
+	addq	%rax, %rbp	# 5317	[c=4 l=3]  *adddi_1/0
+	movzwl	14(%r15), %eax	# 5319	[c=13 l=5]  zero_extendhidi2/0
+	addq	%rax, 48(%rbx)	# 5320	[c=13 l=4]  *adddi_1/0
+	movq	%rbp, 40(%rbx)	# 5318	[c=4 l=4]  *movdi_internal/5
+	movzbl	9(%r15), %eax	# 5321	[c=13 l=5]  *zero_extendqisi2/0
+	addl	%edx, %eax	# 5322	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 16165	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 5323	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 16166	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 16167	[c=4 l=3]  *indirect_jump
+.L943:
+	movq	1040(%rbx), %rax	# 5329	[c=9 l=7]  *movdi_internal/3
+	movzbl	10(%r15), %ecx	# 5331	[c=13 l=5]  zero_extendqidi2/0
+	movzbl	100(%rbx), %esi	# 5330	[c=13 l=4]  *zero_extendqisi2/0
+	addq	%rax, %rcx	# 5332	[c=4 l=3]  *adddi_1/0
+	movzbl	95(%rax), %eax	# 5333	[c=13 l=4]  *zero_extendqisi2/0
+	movl	%esi, %edx	# 15398	[c=4 l=2]  *movsi_internal/0
+	notl	%esi	# 5335	[c=4 l=2]  *one_cmplsi2_1/0
+	andl	%esi, %eax	# 5336	[c=4 l=2]  *andsi_1/0
+	movq	104(%rbx), %rsi	# 5337	[c=9 l=4]  *movdi_internal/3
+	andb	(%rsi), %dl	# 5338	[c=9 l=2]  *andqi_1/1
+	movzbl	%dl, %edx	# 5339	[c=4 l=3]  *zero_extendqisi2/0
+	orl	%edx, %eax	# 5340	[c=4 l=2]  *iorsi_1/0
+	movzbl	(%rcx), %edx	# 5343	[c=9 l=3]  *zero_extendqisi2/0
+	sall	$8, %eax	# 5341	[c=4 l=3]  *ashlsi3_1/0
+	andl	$256, %eax	# 5342	[c=4 l=5]  *andsi_1/0
+	orl	%edx, %eax	# 5344	[c=4 l=2]  *iorsi_1/0
+	movl	%eax, %edx	# 13223	[c=4 l=2]  *movsi_internal/0
+	sarl	%edx	# 5345	[c=4 l=2]  *ashrsi3_1/0
+	movb	%dl, (%rcx)	# 5346	[c=4 l=2]  *movqi_internal/8
+	movzbl	100(%rbx), %edx	# 5347	[c=9 l=4]  *movqi_internal/4
+	movl	%edx, %ecx	# 13225	[c=4 l=2]  *movsi_internal/0
+	andl	$224, %ecx	# 5350	[c=4 l=6]  *andsi_2/0
+	jne	.L944	# 5351	[c=13 l=6]  *jcc
+	leaq	flag_update_table_ror8(%rip), %rdx	# 5354	[c=1 l=7]  *movdi_internal/4
+	cltq	# 5353	[c=4 l=2]  *extendsidi2_rex64/0
+	addq	%rdx, %rax	# 5355	[c=4 l=3]  *adddi_1/0
+	movl	$31, %edx	# 28	[c=4 l=5]  *movqi_internal/3
+.L945:
+	movl	(%rbx), %r15d	# 5374	[c=6 l=3]  *zero_extendsidi2/3
+	movb	%dl, 100(%rbx)	# 5373	[c=4 l=3]  *movqi_internal/8
+	movq	%r10, %rcx	# 16156	[c=4 l=3]  *movdi_internal/3
+	movq	%rax, 104(%rbx)	# 5372	[c=4 l=4]  *movdi_internal/5
+	movq	%r15, %rdx	# 15399	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 5376	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 5378	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%r15), %eax	# 5379	[c=13 l=5]  *zero_extendqisi2/0
+	movq	(%r15), %r14	# 5382	[c=5 l=3]  *movdi_internal/3
+	addl	%edx, %eax	# 5380	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 16157	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 5381	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 16158	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 16159	[c=4 l=3]  *indirect_jump
+.L948:
+	movzbl	10(%r15), %r13d	# 5525	[c=13 l=5]  *zero_extendqisi2/0
+	movzwl	12(%r15), %edx	# 5524	[c=13 l=5]  *zero_extendhisi2/0
+	movl	%r13d, %eax	# 13231	[c=4 l=3]  *movsi_internal/0
+	movl	%r13d, %r14d	# 15408	[c=4 l=3]  *movsi_internal/0
+	subl	5176(%rbx), %eax	# 5528	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %eax	# 5529	[c=13 l=6]  *cmpsi_1/1
+	jb	.L949	# 5530	[c=13 l=2]  *jcc
+	movl	%r13d, %eax	# 13233	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %eax	# 5532	[c=4 l=3]  *ashrsi3_1/0
+	cltq	# 5533	[c=4 l=2]  *extendsidi2_rex64/0
+	cmpb	$0, 1080(%rbx,%rax)	# 5534	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L950	# 5535	[c=13 l=6]  *jcc
+.L949:
+	movq	1040(%rbx), %rcx	# 5539	[c=9 l=7]  *movdi_internal/3
+	movzbl	%r14b, %eax	# 5538	[c=4 l=4]  zero_extendqidi2/0
+	movzbl	(%rcx,%rax), %eax	# 5540	[c=13 l=4]  *zero_extendqisi2/0
+.L951:
+	cmpl	6564(%rbx), %r13d	# 5551	[c=13 l=7]  *cmpsi_1/1
+	jnb	.L952	# 5552	[c=13 l=2]  *jcc
+	movslq	%r13d, %rcx	# 5554	[c=4 l=3]  *extendsidi2_rex64/1
+	cmpb	$0, 6568(%rbx,%rcx)	# 5557	[c=14 l=8]  *cmpqi_ccno_1/1
+	jns	.L952	# 5558	[c=13 l=2]  *jcc
+.L953:
+	movl	%r13d, %eax	# 13235	[c=4 l=3]  *movsi_internal/0
+	subl	5176(%rbx), %eax	# 5564	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %eax	# 5565	[c=13 l=6]  *cmpsi_1/1
+	jb	.L954	# 5566	[c=13 l=2]  *jcc
+	movl	%r13d, %eax	# 13237	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %eax	# 5568	[c=4 l=3]  *ashrsi3_1/0
+	cltq	# 5569	[c=4 l=2]  *extendsidi2_rex64/0
+	cmpb	$0, 1080(%rbx,%rax)	# 5570	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L955	# 5571	[c=13 l=6]  *jcc
+.L954:
+	movq	1040(%rbx), %rcx	# 5575	[c=9 l=7]  *movdi_internal/3
+	movzbl	%r14b, %eax	# 5574	[c=4 l=4]  zero_extendqidi2/0
+	movb	%dl, (%rcx,%rax)	# 5576	[c=4 l=3]  *movqi_internal/8
+.L956:
+	movl	(%rbx), %r15d	# 5587	[c=6 l=3]  *zero_extendsidi2/3
+	movq	%r10, %rcx	# 16132	[c=4 l=3]  *movdi_internal/3
+	movq	%r15, %rdx	# 15409	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 5589	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 5591	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%r15), %eax	# 5592	[c=13 l=5]  *zero_extendqisi2/0
+	movq	(%r15), %r14	# 5595	[c=5 l=3]  *movdi_internal/3
+	addl	%edx, %eax	# 5593	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 16133	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 5594	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 16134	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 16135	[c=4 l=3]  *indirect_jump
+.L952:
+	orl	%eax, %edx	# 5561	[c=4 l=2]  *iorsi_1/0
+	jmp	.L953	# 17018	[c=1 l=2]  jump
+.L963:
+	movl	$2, 96(%rbx)	# 5673	[c=4 l=7]  *movsi_internal/1
+	movzbl	10(%r15), %esi	# 5675	[c=13 l=5]  zero_extendqidi2/0
+	movzwl	12(%r15), %r13d	# 5674	[c=13 l=5]  *zero_extendhisi2/0
+	movl	%esi, %edx	# 13246	[c=4 l=2]  *movsi_internal/0
+	movq	%rsi, %rax	# 15412	[c=4 l=3]  *movdi_internal/3
+	subl	5176(%rbx), %edx	# 5677	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %edx	# 5678	[c=13 l=6]  *cmpsi_1/1
+	jb	.L964	# 5679	[c=13 l=2]  *jcc
+	movl	%esi, %edx	# 13248	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %edx	# 5682	[c=4 l=3]  *ashrsi3_1/0
+	movslq	%edx, %rdx	# 5683	[c=4 l=3]  *extendsidi2_rex64/1
+	cmpb	$0, 1080(%rbx,%rdx)	# 5684	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L965	# 5685	[c=13 l=6]  *jcc
+.L964:
+	movq	1040(%rbx), %rdx	# 5689	[c=9 l=7]  *movdi_internal/3
+	movzbl	(%rdx,%rax), %eax	# 5690	[c=13 l=4]  *zero_extendqisi2/0
+.L966:
+	testl	%eax, %r13d	# 5702	[c=4 l=3]  *testsi_1/0
+	jne	.L967	# 5703	[c=13 l=2]  *jcc
+	movl	(%rbx), %eax	# 13250	[c=5 l=2]  *movsi_internal/0
+	addq	$2, 48(%rbx)	# 5711	[c=13 l=5]  *adddi_1/0
+	addl	$2, %eax	# 5706	[c=4 l=3]  *addsi_1/0
+	andl	992(%rbx), %eax	# 5709	[c=13 l=6]  *andsi_1/1
+	movl	%eax, (%rbx)	# 5710	[c=4 l=2]  *movsi_internal/1
+.L967:
+	movq	(%rsp), %rax	# 13251	[c=5 l=4]  *movdi_internal/3
+	subq	$1, %rax	# 5714	[c=4 l=4]  *adddi_1/0
+	cmpq	%rbp, %rax	# 5715	[c=4 l=3]  *cmpdi_1/0
+	jb	.L620	# 5716	[c=13 l=6]  *jcc
+	movq	56(%rbx), %rax	# 13252	[c=9 l=4]  *movdi_internal/3
+	cmpq	%rax, 48(%rbx)	# 5719	[c=13 l=4]  *cmpdi_1/0
+	jnb	.L1593	# 5720	[c=13 l=6]  *jcc
+.L968:
+	movl	(%rbx), %r15d	# 5727	[c=6 l=3]  *zero_extendsidi2/3
+	movl	$1, 96(%rbx)	# 5732	[c=4 l=7]  *movsi_internal/1
+	movq	%r10, %rcx	# 16116	[c=4 l=3]  *movdi_internal/3
+	movq	%r15, %rdx	# 15413	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 5729	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 5731	[c=13 l=7]  *adddi_1/1
+	movzbl	11(%r15), %eax	# 5733	[c=13 l=5]  zero_extendqidi2/0
+	movq	(%r15), %r14	# 5741	[c=5 l=3]  *movdi_internal/3
+	addq	%rax, %rbp	# 5734	[c=4 l=3]  *adddi_1/0
+	movzwl	14(%r15), %eax	# 5736	[c=13 l=5]  zero_extendhidi2/0
+	addq	%rax, 48(%rbx)	# 5737	[c=13 l=4]  *adddi_1/0
+	movq	%rbp, 40(%rbx)	# 5735	[c=4 l=4]  *movdi_internal/5
+	movzbl	9(%r15), %eax	# 5738	[c=13 l=5]  *zero_extendqisi2/0
+	addl	%edx, %eax	# 5739	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 16117	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 5740	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 16118	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 16119	[c=4 l=3]  *indirect_jump
+.L969:
+	movl	$2, 96(%rbx)	# 5746	[c=4 l=7]  *movsi_internal/1
+	movzbl	10(%r15), %esi	# 5748	[c=13 l=5]  zero_extendqidi2/0
+	movzwl	12(%r15), %r13d	# 5747	[c=13 l=5]  *zero_extendhisi2/0
+	movl	%esi, %edx	# 13253	[c=4 l=2]  *movsi_internal/0
+	movq	%rsi, %rax	# 15414	[c=4 l=3]  *movdi_internal/3
+	subl	5176(%rbx), %edx	# 5750	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %edx	# 5751	[c=13 l=6]  *cmpsi_1/1
+	jb	.L970	# 5752	[c=13 l=2]  *jcc
+	movl	%esi, %edx	# 13255	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %edx	# 5755	[c=4 l=3]  *ashrsi3_1/0
+	movslq	%edx, %rdx	# 5756	[c=4 l=3]  *extendsidi2_rex64/1
+	cmpb	$0, 1080(%rbx,%rdx)	# 5757	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L971	# 5758	[c=13 l=6]  *jcc
+.L970:
+	movq	1040(%rbx), %rdx	# 5762	[c=9 l=7]  *movdi_internal/3
+	movzbl	(%rdx,%rax), %eax	# 5763	[c=13 l=4]  *zero_extendqisi2/0
+.L972:
+	testl	%eax, %r13d	# 5775	[c=4 l=3]  *testsi_1/0
+	je	.L973	# 5776	[c=13 l=2]  *jcc
+	movl	(%rbx), %eax	# 13257	[c=5 l=2]  *movsi_internal/0
+	addq	$1, 48(%rbx)	# 5784	[c=13 l=5]  *adddi_1/0
+	addl	$1, %eax	# 5779	[c=4 l=3]  *addsi_1/0
+	andl	992(%rbx), %eax	# 5782	[c=13 l=6]  *andsi_1/1
+	movl	%eax, (%rbx)	# 5783	[c=4 l=2]  *movsi_internal/1
+.L973:
+	movq	(%rsp), %rax	# 13258	[c=5 l=4]  *movdi_internal/3
+	subq	$1, %rax	# 5787	[c=4 l=4]  *adddi_1/0
+	cmpq	%rbp, %rax	# 5788	[c=4 l=3]  *cmpdi_1/0
+	jb	.L620	# 5789	[c=13 l=6]  *jcc
+	movq	56(%rbx), %rax	# 13259	[c=9 l=4]  *movdi_internal/3
+	cmpq	%rax, 48(%rbx)	# 5792	[c=13 l=4]  *cmpdi_1/0
+	jnb	.L1594	# 5793	[c=13 l=6]  *jcc
+.L974:
+	movl	(%rbx), %r15d	# 5800	[c=6 l=3]  *zero_extendsidi2/3
+	movl	$1, 96(%rbx)	# 5805	[c=4 l=7]  *movsi_internal/1
+	movq	%r10, %rcx	# 16108	[c=4 l=3]  *movdi_internal/3
+	movq	%r15, %rdx	# 15415	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 5802	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 5804	[c=13 l=7]  *adddi_1/1
+	movzbl	11(%r15), %eax	# 5806	[c=13 l=5]  zero_extendqidi2/0
+	movq	(%r15), %r14	# 5814	[c=5 l=3]  *movdi_internal/3
+	addq	%rax, %rbp	# 5807	[c=4 l=3]  *adddi_1/0
+	movzwl	14(%r15), %eax	# 5809	[c=13 l=5]  zero_extendhidi2/0
+	addq	%rax, 48(%rbx)	# 5810	[c=13 l=4]  *adddi_1/0
+	movq	%rbp, 40(%rbx)	# 5808	[c=4 l=4]  *movdi_internal/5
+	movzbl	9(%r15), %eax	# 5811	[c=13 l=5]  *zero_extendqisi2/0
+	addl	%edx, %eax	# 5812	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 16109	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 5813	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 16110	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 16111	[c=4 l=3]  *indirect_jump
+.L975:
+	movl	$2, 96(%rbx)	# 5819	[c=4 l=7]  *movsi_internal/1
+	movzbl	10(%r15), %esi	# 5821	[c=13 l=5]  zero_extendqidi2/0
+	movzwl	12(%r15), %r13d	# 5820	[c=13 l=5]  *zero_extendhisi2/0
+	movl	%esi, %edx	# 13260	[c=4 l=2]  *movsi_internal/0
+	movq	%rsi, %rax	# 15416	[c=4 l=3]  *movdi_internal/3
+	subl	5176(%rbx), %edx	# 5823	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %edx	# 5824	[c=13 l=6]  *cmpsi_1/1
+	jb	.L976	# 5825	[c=13 l=2]  *jcc
+	movl	%esi, %edx	# 13262	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %edx	# 5828	[c=4 l=3]  *ashrsi3_1/0
+	movslq	%edx, %rdx	# 5829	[c=4 l=3]  *extendsidi2_rex64/1
+	cmpb	$0, 1080(%rbx,%rdx)	# 5830	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L977	# 5831	[c=13 l=6]  *jcc
+.L976:
+	movq	1040(%rbx), %rdx	# 5835	[c=9 l=7]  *movdi_internal/3
+	movzbl	(%rdx,%rax), %eax	# 5836	[c=13 l=4]  *zero_extendqisi2/0
+.L978:
+	testl	%eax, %r13d	# 5848	[c=4 l=3]  *testsi_1/0
+	je	.L979	# 5849	[c=13 l=2]  *jcc
+	movl	(%rbx), %eax	# 13264	[c=5 l=2]  *movsi_internal/0
+	addq	$2, 48(%rbx)	# 5857	[c=13 l=5]  *adddi_1/0
+	addl	$2, %eax	# 5852	[c=4 l=3]  *addsi_1/0
+	andl	992(%rbx), %eax	# 5855	[c=13 l=6]  *andsi_1/1
+	movl	%eax, (%rbx)	# 5856	[c=4 l=2]  *movsi_internal/1
+.L979:
+	movq	(%rsp), %rax	# 13265	[c=5 l=4]  *movdi_internal/3
+	subq	$1, %rax	# 5860	[c=4 l=4]  *adddi_1/0
+	cmpq	%rbp, %rax	# 5861	[c=4 l=3]  *cmpdi_1/0
+	jb	.L620	# 5862	[c=13 l=6]  *jcc
+	movq	56(%rbx), %rax	# 13266	[c=9 l=4]  *movdi_internal/3
+	cmpq	%rax, 48(%rbx)	# 5865	[c=13 l=4]  *cmpdi_1/0
+	jnb	.L1595	# 5866	[c=13 l=6]  *jcc
+.L980:
+	movl	(%rbx), %r15d	# 5873	[c=6 l=3]  *zero_extendsidi2/3
+	movl	$1, 96(%rbx)	# 5878	[c=4 l=7]  *movsi_internal/1
+	movq	%r10, %rcx	# 16100	[c=4 l=3]  *movdi_internal/3
+	movq	%r15, %rdx	# 15417	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 5875	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 5877	[c=13 l=7]  *adddi_1/1
+	movzbl	11(%r15), %eax	# 5879	[c=13 l=5]  zero_extendqidi2/0
+	movq	(%r15), %r14	# 5887	[c=5 l=3]  *movdi_internal/3
+	addq	%rax, %rbp	# 5880	[c=4 l=3]  *adddi_1/0
+	movzwl	14(%r15), %eax	# 5882	[c=13 l=5]  zero_extendhidi2/0
+	addq	%rax, 48(%rbx)	# 5883	[c=13 l=4]  *adddi_1/0
+	movq	%rbp, 40(%rbx)	# 5881	[c=4 l=4]  *movdi_internal/5
+	movzbl	9(%r15), %eax	# 5884	[c=13 l=5]  *zero_extendqisi2/0
+	addl	%edx, %eax	# 5885	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 16101	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 5886	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 16102	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 16103	[c=4 l=3]  *indirect_jump
+.L822:
+	movq	1040(%rbx), %rax	# 3749	[c=9 l=7]  *movdi_internal/3
+	movzbl	10(%r15), %r14d	# 3748	[c=9 l=5]  *movqi_internal/4
+	movzwl	28(%rax), %r13d	# 3750	[c=13 l=5]  zero_extendhidi2/0
+	movl	%r13d, %edx	# 13097	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rcx	# 15369	[c=4 l=3]  *movdi_internal/3
+	subl	5176(%rbx), %edx	# 3753	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %edx	# 3754	[c=13 l=6]  *cmpsi_1/1
+	jb	.L823	# 3755	[c=13 l=2]  *jcc
+	movl	%r13d, %edx	# 13099	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %edx	# 3757	[c=4 l=3]  *ashrsi3_1/0
+	movslq	%edx, %rdx	# 3758	[c=4 l=3]  *extendsidi2_rex64/1
+	cmpb	$0, 1080(%rbx,%rdx)	# 3759	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L824	# 3760	[c=13 l=6]  *jcc
+.L823:
+	movzbl	(%rax,%rcx), %ecx	# 3764	[c=13 l=4]  *zero_extendqisi2/0
+.L825:
+	movzbl	%r14b, %edx	# 3775	[c=4 l=4]  zero_extendqidi2/0
+	movb	%cl, (%rax,%rdx)	# 3777	[c=4 l=3]  *movqi_internal/8
+	movq	1040(%rbx), %rdx	# 3779	[c=9 l=7]  *movdi_internal/3
+	leal	1(%r13), %eax	# 14979	[c=4 l=4]  *leasi
+	movq	%r10, %rcx	# 16340	[c=4 l=3]  *movdi_internal/3
+	movb	%al, 28(%rdx)	# 3780	[c=4 l=3]  *movqi_internal/8
+	movq	1040(%rbx), %rdx	# 3781	[c=9 l=7]  *movdi_internal/3
+	movb	%ah, 29(%rdx)	# 16851	[c=4 l=3]  *extzvqi_mem_rex64
+	movl	(%rbx), %r15d	# 3784	[c=6 l=3]  *zero_extendsidi2/3
+	movq	%r15, %rdx	# 15370	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 3786	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 3788	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%r15), %eax	# 3789	[c=13 l=5]  *zero_extendqisi2/0
+	movq	(%r15), %r14	# 3792	[c=5 l=3]  *movdi_internal/3
+	addl	%edx, %eax	# 3790	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 16341	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 3791	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 16342	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 16343	[c=4 l=3]  *indirect_jump
+.L826:
+	movq	1040(%rbx), %rax	# 3798	[c=9 l=7]  *movdi_internal/3
+	movzbl	10(%r15), %r13d	# 3797	[c=9 l=5]  *movqi_internal/4
+	movzwl	30(%rax), %ecx	# 3799	[c=13 l=4]  *zero_extendhisi2/0
+	subl	$1, %ecx	# 3800	[c=4 l=3]  *addsi_1/0
+	movl	%ecx, %edx	# 13102	[c=4 l=2]  *movsi_internal/0
+	subl	5176(%rbx), %edx	# 3801	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %edx	# 3802	[c=13 l=6]  *cmpsi_1/1
+	jb	.L827	# 3803	[c=13 l=2]  *jcc
+	movl	%ecx, %esi	# 13104	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %esi	# 3805	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %esi	# 12711	[c=5 l=6]  *andsi_1_zext
+	cmpb	$0, 1080(%rbx,%rsi)	# 3808	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L828	# 3809	[c=13 l=6]  *jcc
+.L827:
+	movslq	%ecx, %rdx	# 3812	[c=4 l=3]  *extendsidi2_rex64/1
+	movzbl	(%rax,%rdx), %esi	# 3813	[c=13 l=4]  *zero_extendqisi2/0
+.L829:
+	movzbl	%r13b, %edx	# 3824	[c=4 l=4]  zero_extendqidi2/0
+	movb	%sil, (%rax,%rdx)	# 3826	[c=4 l=4]  *movqi_internal/8
+	movq	1040(%rbx), %rax	# 3827	[c=9 l=7]  *movdi_internal/3
+	movb	%cl, 30(%rax)	# 3828	[c=4 l=3]  *movqi_internal/8
+	movq	1040(%rbx), %rax	# 3829	[c=9 l=7]  *movdi_internal/3
+	movb	%ch, 31(%rax)	# 16850	[c=4 l=3]  *extzvqi_mem_rex64
+	movl	(%rbx), %r15d	# 3832	[c=6 l=3]  *zero_extendsidi2/3
+	movq	%r10, %rcx	# 16332	[c=4 l=3]  *movdi_internal/3
+	movq	%r15, %rdx	# 15371	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 3834	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 3836	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%r15), %eax	# 3837	[c=13 l=5]  *zero_extendqisi2/0
+	movq	(%r15), %r14	# 3840	[c=5 l=3]  *movdi_internal/3
+	addl	%edx, %eax	# 3838	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 16333	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 3839	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 16334	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 16335	[c=4 l=3]  *indirect_jump
+.L834:
+	movq	1040(%rbx), %rdx	# 3894	[c=9 l=7]  *movdi_internal/3
+	movl	992(%rbx), %eax	# 3895	[c=9 l=6]  *movsi_internal/0
+	movq	1056(%rbx), %rcx	# 3901	[c=9 l=7]  *movdi_internal/3
+	leal	1(%rax,%rax), %eax	# 3897	[c=8 l=4]  *leasi
+	andw	30(%rdx), %ax	# 3899	[c=13 l=4]  *andhi_1/1
+	movzwl	%ax, %eax	# 3900	[c=4 l=3]  zero_extendhidi2/0
+	movzbl	(%rcx,%rax), %eax	# 3902	[c=9 l=4]  *movqi_internal/4
+	movq	%r10, %rcx	# 16316	[c=4 l=3]  *movdi_internal/3
+	movb	%al, (%rdx)	# 3903	[c=4 l=2]  *movqi_internal/8
+	movl	(%rbx), %r15d	# 3904	[c=6 l=3]  *zero_extendsidi2/3
+	movq	%r15, %rdx	# 15374	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 3906	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 3908	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%r15), %eax	# 3909	[c=13 l=5]  *zero_extendqisi2/0
+	movq	(%r15), %r14	# 3912	[c=5 l=3]  *movdi_internal/3
+	addl	%edx, %eax	# 3910	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 16317	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 3911	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 16318	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 16319	[c=4 l=3]  *indirect_jump
+.L830:
+	movq	1040(%rbx), %rax	# 3846	[c=9 l=7]  *movdi_internal/3
+	movzbl	10(%r15), %r14d	# 3845	[c=9 l=5]  *movqi_internal/4
+	movzwl	30(%rax), %r13d	# 3847	[c=13 l=5]  zero_extendhidi2/0
+	movl	%r13d, %edx	# 13107	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rcx	# 15372	[c=4 l=3]  *movdi_internal/3
+	subl	5176(%rbx), %edx	# 3850	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %edx	# 3851	[c=13 l=6]  *cmpsi_1/1
+	jb	.L831	# 3852	[c=13 l=2]  *jcc
+	movl	%r13d, %edx	# 13109	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %edx	# 3854	[c=4 l=3]  *ashrsi3_1/0
+	movslq	%edx, %rdx	# 3855	[c=4 l=3]  *extendsidi2_rex64/1
+	cmpb	$0, 1080(%rbx,%rdx)	# 3856	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L832	# 3857	[c=13 l=6]  *jcc
+.L831:
+	movzbl	(%rax,%rcx), %ecx	# 3861	[c=13 l=4]  *zero_extendqisi2/0
+.L833:
+	movzbl	%r14b, %edx	# 3872	[c=4 l=4]  zero_extendqidi2/0
+	movb	%cl, (%rax,%rdx)	# 3874	[c=4 l=3]  *movqi_internal/8
+	movq	1040(%rbx), %rdx	# 3876	[c=9 l=7]  *movdi_internal/3
+	leal	1(%r13), %eax	# 14978	[c=4 l=4]  *leasi
+	movq	%r10, %rcx	# 16324	[c=4 l=3]  *movdi_internal/3
+	movb	%al, 30(%rdx)	# 3877	[c=4 l=3]  *movqi_internal/8
+	movq	1040(%rbx), %rdx	# 3878	[c=9 l=7]  *movdi_internal/3
+	movb	%ah, 31(%rdx)	# 16849	[c=4 l=3]  *extzvqi_mem_rex64
+	movl	(%rbx), %r15d	# 3881	[c=6 l=3]  *zero_extendsidi2/3
+	movq	%r15, %rdx	# 15373	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 3883	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 3885	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%r15), %eax	# 3886	[c=13 l=5]  *zero_extendqisi2/0
+	movq	(%r15), %r14	# 3889	[c=5 l=3]  *movdi_internal/3
+	addl	%edx, %eax	# 3887	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 16325	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 3888	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 16326	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 16327	[c=4 l=3]  *indirect_jump
+.L835:
+	movq	1040(%rbx), %rdx	# 3917	[c=9 l=7]  *movdi_internal/3
+	movl	992(%rbx), %eax	# 3918	[c=9 l=6]  *movsi_internal/0
+	movq	1056(%rbx), %rcx	# 3924	[c=9 l=7]  *movdi_internal/3
+	leal	1(%rax,%rax), %eax	# 3920	[c=8 l=4]  *leasi
+	andw	30(%rdx), %ax	# 3922	[c=13 l=4]  *andhi_1/1
+	movzwl	%ax, %eax	# 3923	[c=4 l=3]  zero_extendhidi2/0
+	movzbl	(%rcx,%rax), %ecx	# 3925	[c=9 l=4]  *movqi_internal/4
+	movzbl	10(%r15), %eax	# 3926	[c=13 l=5]  zero_extendqidi2/0
+	movb	%cl, (%rdx,%rax)	# 3927	[c=4 l=3]  *movqi_internal/8
+	movl	(%rbx), %r15d	# 3928	[c=6 l=3]  *zero_extendsidi2/3
+	movq	%r10, %rcx	# 16308	[c=4 l=3]  *movdi_internal/3
+	movq	%r15, %rdx	# 15375	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 3930	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 3932	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%r15), %eax	# 3933	[c=13 l=5]  *zero_extendqisi2/0
+	movq	(%r15), %r14	# 3936	[c=5 l=3]  *movdi_internal/3
+	addl	%edx, %eax	# 3934	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 16309	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 3935	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 16310	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 16311	[c=4 l=3]  *indirect_jump
+.L836:
+	movq	1040(%rbx), %rcx	# 3941	[c=9 l=7]  *movdi_internal/3
+	movl	992(%rbx), %edx	# 3943	[c=9 l=6]  *movsi_internal/0
+	movq	1056(%rbx), %rsi	# 3948	[c=9 l=7]  *movdi_internal/3
+	movzwl	30(%rcx), %eax	# 3942	[c=13 l=4]  *zero_extendhisi2/0
+	leal	1(%rdx,%rdx), %edx	# 3945	[c=8 l=4]  *leasi
+	andl	%eax, %edx	# 3946	[c=4 l=2]  *andsi_1/0
+	addl	$1, %eax	# 3952	[c=4 l=3]  *addsi_1/0
+	movslq	%edx, %rdx	# 3947	[c=4 l=3]  *extendsidi2_rex64/1
+	movzwl	%ax, %eax	# 3953	[c=4 l=3]  *zero_extendhisi2/0
+	movzbl	(%rsi,%rdx), %esi	# 3949	[c=9 l=4]  *movqi_internal/4
+	movzbl	10(%r15), %edx	# 3950	[c=13 l=5]  zero_extendqidi2/0
+	movb	%sil, (%rcx,%rdx)	# 3951	[c=4 l=4]  *movqi_internal/8
+	movq	1040(%rbx), %rdx	# 3954	[c=9 l=7]  *movdi_internal/3
+	movq	%r10, %rcx	# 16300	[c=4 l=3]  *movdi_internal/3
+	movb	%al, 30(%rdx)	# 3955	[c=4 l=3]  *movqi_internal/8
+	movq	1040(%rbx), %rdx	# 3956	[c=9 l=7]  *movdi_internal/3
+	movb	%ah, 31(%rdx)	# 16848	[c=4 l=3]  *extzvqi_mem_rex64
+	movl	(%rbx), %r15d	# 3959	[c=6 l=3]  *zero_extendsidi2/3
+	movq	%r15, %rdx	# 15376	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 3961	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 3963	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%r15), %eax	# 3964	[c=13 l=5]  *zero_extendqisi2/0
+	movq	(%r15), %r14	# 3967	[c=5 l=3]  *movdi_internal/3
+	addl	%edx, %eax	# 3965	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 16301	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 3966	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 16302	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 16303	[c=4 l=3]  *indirect_jump
+.L837:
+	movzbl	10(%r15), %edx	# 3972	[c=13 l=5]  zero_extendqidi2/0
+	addq	1040(%rbx), %rdx	# 3974	[c=13 l=7]  *adddi_1/1
+	movzbl	(%rdx), %ecx	# 3975	[c=9 l=3]  zero_extendqidi2/0
+	movl	%ecx, %esi	# 13113	[c=4 l=2]  *movsi_internal/0
+	movq	%rcx, %rax	# 15377	[c=4 l=3]  *movdi_internal/3
+	sarl	%esi	# 3977	[c=4 l=2]  *ashrsi3_1/0
+	movb	%sil, (%rdx)	# 3978	[c=4 l=3]  *movqi_internal/8
+	movzbl	100(%rbx), %edx	# 3979	[c=9 l=4]  *movqi_internal/4
+	movl	%edx, %esi	# 13115	[c=4 l=2]  *movsi_internal/0
+	andl	$224, %esi	# 3982	[c=4 l=6]  *andsi_2/0
+	jne	.L838	# 3983	[c=13 l=6]  *jcc
+	leaq	flag_update_table_ror8(%rip), %rdx	# 3986	[c=1 l=7]  *movdi_internal/4
+	addq	%rdx, %rax	# 3987	[c=4 l=3]  *adddi_1/0
+	movl	$31, %edx	# 21	[c=4 l=5]  *movqi_internal/3
+.L839:
+	movl	(%rbx), %r15d	# 4006	[c=6 l=3]  *zero_extendsidi2/3
+	movb	%dl, 100(%rbx)	# 4005	[c=4 l=3]  *movqi_internal/8
+	movq	%r10, %rcx	# 16292	[c=4 l=3]  *movdi_internal/3
+	movq	%rax, 104(%rbx)	# 4004	[c=4 l=4]  *movdi_internal/5
+	movq	%r15, %rdx	# 15378	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 4008	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 4010	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%r15), %eax	# 4011	[c=13 l=5]  *zero_extendqisi2/0
+	movq	(%r15), %r14	# 4014	[c=5 l=3]  *movdi_internal/3
+	addl	%edx, %eax	# 4012	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 16293	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 4013	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 16294	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 16295	[c=4 l=3]  *indirect_jump
+.L840:
+	movzwl	12(%r15), %edx	# 4020	[c=13 l=5]  zero_extendhidi2/0
+	movq	1040(%rbx), %rax	# 4019	[c=9 l=7]  *movdi_internal/3
+	movzbl	(%rax,%rdx), %ecx	# 4021	[c=9 l=4]  *movqi_internal/4
+	movzbl	10(%r15), %edx	# 4022	[c=13 l=5]  zero_extendqidi2/0
+	movb	%cl, (%rax,%rdx)	# 4023	[c=4 l=3]  *movqi_internal/8
+	movl	(%rbx), %r15d	# 4024	[c=6 l=3]  *zero_extendsidi2/3
+	movq	%r10, %rcx	# 16284	[c=4 l=3]  *movdi_internal/3
+	movq	%r15, %rdx	# 15379	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 4026	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 4028	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%r15), %eax	# 4029	[c=13 l=5]  *zero_extendqisi2/0
+	movq	(%r15), %r14	# 4032	[c=5 l=3]  *movdi_internal/3
+	addl	%edx, %eax	# 4030	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 16285	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 4031	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 16286	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 16287	[c=4 l=3]  *indirect_jump
+.L806:
+	movq	1040(%rbx), %rax	# 3561	[c=9 l=7]  *movdi_internal/3
+	movzbl	10(%r15), %r13d	# 3560	[c=9 l=5]  *movqi_internal/4
+	movzwl	26(%rax), %esi	# 3562	[c=13 l=4]  zero_extendhidi2/0
+	movl	%esi, %edx	# 13078	[c=4 l=2]  *movsi_internal/0
+	movq	%rsi, %rcx	# 15363	[c=4 l=3]  *movdi_internal/3
+	subl	5176(%rbx), %edx	# 3564	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %edx	# 3565	[c=13 l=6]  *cmpsi_1/1
+	jb	.L807	# 3566	[c=13 l=2]  *jcc
+	movl	%esi, %edx	# 13080	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %edx	# 3569	[c=4 l=3]  *ashrsi3_1/0
+	movslq	%edx, %rdx	# 3570	[c=4 l=3]  *extendsidi2_rex64/1
+	cmpb	$0, 1080(%rbx,%rdx)	# 3571	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L808	# 3572	[c=13 l=6]  *jcc
+.L807:
+	movzbl	(%rax,%rcx), %ecx	# 3576	[c=13 l=4]  *zero_extendqisi2/0
+.L809:
+	movzbl	%r13b, %edx	# 3587	[c=4 l=4]  zero_extendqidi2/0
+	movb	%cl, (%rax,%rdx)	# 3589	[c=4 l=3]  *movqi_internal/8
+	movl	(%rbx), %r15d	# 3590	[c=6 l=3]  *zero_extendsidi2/3
+	movq	%r10, %rcx	# 16372	[c=4 l=3]  *movdi_internal/3
+	movq	%r15, %rdx	# 15364	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 3592	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 3594	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%r15), %eax	# 3595	[c=13 l=5]  *zero_extendqisi2/0
+	movq	(%r15), %r14	# 3598	[c=5 l=3]  *movdi_internal/3
+	addl	%edx, %eax	# 3596	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 16373	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 3597	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 16374	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 16375	[c=4 l=3]  *indirect_jump
+.L810:
+	movq	1040(%rbx), %rax	# 3604	[c=9 l=7]  *movdi_internal/3
+	movzbl	10(%r15), %r13d	# 3603	[c=9 l=5]  *movqi_internal/4
+	movzwl	26(%rax), %ecx	# 3605	[c=13 l=4]  *zero_extendhisi2/0
+	subl	$1, %ecx	# 3606	[c=4 l=3]  *addsi_1/0
+	movl	%ecx, %edx	# 13082	[c=4 l=2]  *movsi_internal/0
+	subl	5176(%rbx), %edx	# 3607	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %edx	# 3608	[c=13 l=6]  *cmpsi_1/1
+	jb	.L811	# 3609	[c=13 l=2]  *jcc
+	movl	%ecx, %esi	# 13084	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %esi	# 3611	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %esi	# 12713	[c=5 l=6]  *andsi_1_zext
+	cmpb	$0, 1080(%rbx,%rsi)	# 3614	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L812	# 3615	[c=13 l=6]  *jcc
+.L811:
+	movslq	%ecx, %rdx	# 3618	[c=4 l=3]  *extendsidi2_rex64/1
+	movzbl	(%rax,%rdx), %esi	# 3619	[c=13 l=4]  *zero_extendqisi2/0
+.L813:
+	movzbl	%r13b, %edx	# 3630	[c=4 l=4]  zero_extendqidi2/0
+	movb	%sil, (%rax,%rdx)	# 3632	[c=4 l=4]  *movqi_internal/8
+	movq	1040(%rbx), %rax	# 3633	[c=9 l=7]  *movdi_internal/3
+	movb	%cl, 26(%rax)	# 3634	[c=4 l=3]  *movqi_internal/8
+	movq	1040(%rbx), %rax	# 3635	[c=9 l=7]  *movdi_internal/3
+	movb	%ch, 27(%rax)	# 16854	[c=4 l=3]  *extzvqi_mem_rex64
+	movl	(%rbx), %r15d	# 3638	[c=6 l=3]  *zero_extendsidi2/3
+	movq	%r10, %rcx	# 16364	[c=4 l=3]  *movdi_internal/3
+	movq	%r15, %rdx	# 15365	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 3640	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 3642	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%r15), %eax	# 3643	[c=13 l=5]  *zero_extendqisi2/0
+	movq	(%r15), %r14	# 3646	[c=5 l=3]  *movdi_internal/3
+	addl	%edx, %eax	# 3644	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 16365	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 3645	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 16366	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 16367	[c=4 l=3]  *indirect_jump
+.L814:
+	movq	1040(%rbx), %rax	# 3652	[c=9 l=7]  *movdi_internal/3
+	movzbl	10(%r15), %r14d	# 3651	[c=9 l=5]  *movqi_internal/4
+	movzwl	26(%rax), %r13d	# 3653	[c=13 l=5]  zero_extendhidi2/0
+	movl	%r13d, %edx	# 13087	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rcx	# 15366	[c=4 l=3]  *movdi_internal/3
+	subl	5176(%rbx), %edx	# 3656	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %edx	# 3657	[c=13 l=6]  *cmpsi_1/1
+	jb	.L815	# 3658	[c=13 l=2]  *jcc
+	movl	%r13d, %edx	# 13089	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %edx	# 3660	[c=4 l=3]  *ashrsi3_1/0
+	movslq	%edx, %rdx	# 3661	[c=4 l=3]  *extendsidi2_rex64/1
+	cmpb	$0, 1080(%rbx,%rdx)	# 3662	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L816	# 3663	[c=13 l=6]  *jcc
+.L815:
+	movzbl	(%rax,%rcx), %ecx	# 3667	[c=13 l=4]  *zero_extendqisi2/0
+.L817:
+	movzbl	%r14b, %edx	# 3678	[c=4 l=4]  zero_extendqidi2/0
+	movb	%cl, (%rax,%rdx)	# 3680	[c=4 l=3]  *movqi_internal/8
+	movq	1040(%rbx), %rdx	# 3682	[c=9 l=7]  *movdi_internal/3
+	leal	1(%r13), %eax	# 14980	[c=4 l=4]  *leasi
+	movq	%r10, %rcx	# 16356	[c=4 l=3]  *movdi_internal/3
+	movb	%al, 26(%rdx)	# 3683	[c=4 l=3]  *movqi_internal/8
+	movq	1040(%rbx), %rdx	# 3684	[c=9 l=7]  *movdi_internal/3
+	movb	%ah, 27(%rdx)	# 16853	[c=4 l=3]  *extzvqi_mem_rex64
+	movl	(%rbx), %r15d	# 3687	[c=6 l=3]  *zero_extendsidi2/3
+	movq	%r15, %rdx	# 15367	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 3689	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 3691	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%r15), %eax	# 3692	[c=13 l=5]  *zero_extendqisi2/0
+	movq	(%r15), %r14	# 3695	[c=5 l=3]  *movdi_internal/3
+	addl	%edx, %eax	# 3693	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 16357	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 3694	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 16358	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 16359	[c=4 l=3]  *indirect_jump
+.L818:
+	movq	1040(%rbx), %rax	# 3701	[c=9 l=7]  *movdi_internal/3
+	movzbl	10(%r15), %r13d	# 3700	[c=9 l=5]  *movqi_internal/4
+	movzwl	28(%rax), %ecx	# 3702	[c=13 l=4]  *zero_extendhisi2/0
+	subl	$1, %ecx	# 3703	[c=4 l=3]  *addsi_1/0
+	movl	%ecx, %edx	# 13092	[c=4 l=2]  *movsi_internal/0
+	subl	5176(%rbx), %edx	# 3704	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %edx	# 3705	[c=13 l=6]  *cmpsi_1/1
+	jb	.L819	# 3706	[c=13 l=2]  *jcc
+	movl	%ecx, %esi	# 13094	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %esi	# 3708	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %esi	# 12712	[c=5 l=6]  *andsi_1_zext
+	cmpb	$0, 1080(%rbx,%rsi)	# 3711	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L820	# 3712	[c=13 l=6]  *jcc
+.L819:
+	movslq	%ecx, %rdx	# 3715	[c=4 l=3]  *extendsidi2_rex64/1
+	movzbl	(%rax,%rdx), %esi	# 3716	[c=13 l=4]  *zero_extendqisi2/0
+.L821:
+	movzbl	%r13b, %edx	# 3727	[c=4 l=4]  zero_extendqidi2/0
+	movb	%sil, (%rax,%rdx)	# 3729	[c=4 l=4]  *movqi_internal/8
+	movq	1040(%rbx), %rax	# 3730	[c=9 l=7]  *movdi_internal/3
+	movb	%cl, 28(%rax)	# 3731	[c=4 l=3]  *movqi_internal/8
+	movq	1040(%rbx), %rax	# 3732	[c=9 l=7]  *movdi_internal/3
+	movb	%ch, 29(%rax)	# 16852	[c=4 l=3]  *extzvqi_mem_rex64
+	movl	(%rbx), %r15d	# 3735	[c=6 l=3]  *zero_extendsidi2/3
+	movq	%r10, %rcx	# 16348	[c=4 l=3]  *movdi_internal/3
+	movq	%r15, %rdx	# 15368	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 3737	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 3739	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%r15), %eax	# 3740	[c=13 l=5]  *zero_extendqisi2/0
+	movq	(%r15), %r14	# 3743	[c=5 l=3]  *movdi_internal/3
+	addl	%edx, %eax	# 3741	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 16349	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 3742	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 16350	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 16351	[c=4 l=3]  *indirect_jump
+.L786:
+	movl	$2, 96(%rbx)	# 3324	[c=4 l=7]  *movsi_internal/1
+	movzbl	10(%r15), %esi	# 3325	[c=13 l=5]  *zero_extendqisi2/0
+	movzwl	12(%r15), %eax	# 3327	[c=13 l=5]  *zero_extendhisi2/0
+	sall	$16, %esi	# 3326	[c=4 l=3]  *ashlsi3_1/0
+	orl	%eax, %esi	# 3328	[c=4 l=2]  *iorsi_1/0
+	movl	%esi, (%rbx)	# 3329	[c=4 l=2]  *movsi_internal/1
+	cmpl	%esi, 992(%rbx)	# 3330	[c=13 l=6]  *cmpsi_1/0
+	jb	.L1416	# 3331	[c=13 l=6]  *jcc
+	movq	(%rsp), %rax	# 13060	[c=5 l=4]  *movdi_internal/3
+	subq	$1, %rax	# 3339	[c=4 l=4]  *adddi_1/0
+	cmpq	%rbp, %rax	# 3340	[c=4 l=3]  *cmpdi_1/0
+	jb	.L620	# 3341	[c=13 l=6]  *jcc
+	movq	56(%rbx), %rax	# 13061	[c=9 l=4]  *movdi_internal/3
+	cmpq	%rax, 48(%rbx)	# 3344	[c=13 l=4]  *cmpdi_1/0
+	jnb	.L1596	# 3345	[c=13 l=6]  *jcc
+.L788:
+	movl	(%rbx), %r15d	# 3352	[c=6 l=3]  *zero_extendsidi2/3
+	movl	$1, 96(%rbx)	# 3357	[c=4 l=7]  *movsi_internal/1
+	movq	%r10, %rcx	# 16420	[c=4 l=3]  *movdi_internal/3
+	movq	%r15, %rdx	# 15355	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 3354	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 3356	[c=13 l=7]  *adddi_1/1
+	movzbl	11(%r15), %eax	# 3358	[c=13 l=5]  zero_extendqidi2/0
+	movq	(%r15), %r14	# 3366	[c=5 l=3]  *movdi_internal/3
+	addq	%rax, %rbp	# 3359	[c=4 l=3]  *adddi_1/0
+	movzwl	14(%r15), %eax	# 3361	[c=13 l=5]  zero_extendhidi2/0
+	addq	%rax, 48(%rbx)	# 3362	[c=13 l=4]  *adddi_1/0
+	movq	%rbp, 40(%rbx)	# 3360	[c=4 l=4]  *movdi_internal/5
+	movzbl	9(%r15), %eax	# 3363	[c=13 l=5]  *zero_extendqisi2/0
+	addl	%edx, %eax	# 3364	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 16421	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 3365	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 16422	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 16423	[c=4 l=3]  *indirect_jump
+.L783:
+	movzbl	10(%r15), %edx	# 3275	[c=13 l=5]  zero_extendqidi2/0
+	addq	1040(%rbx), %rdx	# 3277	[c=13 l=7]  *adddi_1/1
+	movzbl	(%rdx), %ecx	# 3278	[c=5 l=3]  *movqi_internal/4
+	leal	1(%rcx), %eax	# 14983	[c=4 l=3]  *leasi
+	addl	$1, %ecx	# 14984	[c=4 l=3]  *addsi_1/0
+	movb	%cl, (%rdx)	# 3283	[c=4 l=2]  *movqi_internal/8
+	movzbl	100(%rbx), %edx	# 3284	[c=9 l=4]  *movqi_internal/4
+	movzbl	%al, %eax	# 3281	[c=4 l=3]  zero_extendqidi2/0
+	movl	%edx, %ecx	# 13058	[c=4 l=2]  *movsi_internal/0
+	andl	$225, %ecx	# 3287	[c=4 l=6]  *andsi_2/0
+	jne	.L784	# 3288	[c=13 l=6]  *jcc
+	leaq	flag_update_table_inc(%rip), %rdx	# 3291	[c=1 l=7]  *movdi_internal/4
+	addq	%rdx, %rax	# 3292	[c=4 l=3]  *adddi_1/0
+	movl	$30, %edx	# 20	[c=4 l=5]  *movqi_internal/3
+.L785:
+	movl	(%rbx), %r15d	# 3311	[c=6 l=3]  *zero_extendsidi2/3
+	movb	%dl, 100(%rbx)	# 3310	[c=4 l=3]  *movqi_internal/8
+	movq	%r10, %rcx	# 16428	[c=4 l=3]  *movdi_internal/3
+	movq	%rax, 104(%rbx)	# 3309	[c=4 l=4]  *movdi_internal/5
+	movq	%r15, %rdx	# 15354	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 3313	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 3315	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%r15), %eax	# 3316	[c=13 l=5]  *zero_extendqisi2/0
+	movq	(%r15), %r14	# 3319	[c=5 l=3]  *movdi_internal/3
+	addl	%edx, %eax	# 3317	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 16429	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 3318	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 16430	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 16431	[c=4 l=3]  *indirect_jump
+.L946:
+	movzbl	10(%r15), %ecx	# 5388	[c=13 l=5]  zero_extendqidi2/0
+	movq	1040(%rbx), %rax	# 5387	[c=9 l=7]  *movdi_internal/3
+	movzwl	12(%r15), %esi	# 5391	[c=13 l=5]  zero_extendhidi2/0
+	movzbl	100(%rbx), %edi	# 5393	[c=9 l=4]  *movqi_internal/4
+	addq	%rax, %rcx	# 5389	[c=4 l=3]  *adddi_1/0
+	movzbl	(%rax,%rsi), %r9d	# 5392	[c=13 l=5]  *zero_extendqisi2/0
+	movzbl	(%rcx), %r8d	# 5390	[c=9 l=4]  *zero_extendqisi2/0
+	movzbl	95(%rax), %eax	# 5397	[c=13 l=4]  *zero_extendqisi2/0
+	movl	%r8d, %edx	# 15400	[c=4 l=3]  *movsi_internal/0
+	movl	%r9d, %esi	# 15401	[c=4 l=3]  *movsi_internal/0
+	subl	%r9d, %r8d	# 5396	[c=4 l=3]  *subsi_1/0
+	movzbl	%dil, %r9d	# 5398	[c=4 l=4]  *zero_extendqisi2/0
+	notl	%r9d	# 5399	[c=4 l=3]  *one_cmplsi2_1/0
+	andl	$136, %esi	# 5412	[c=4 l=6]  *andsi_1/0
+	andl	$136, %edx	# 5409	[c=4 l=6]  *andsi_1/0
+	andl	%r9d, %eax	# 5400	[c=4 l=3]  *andsi_1/0
+	movq	104(%rbx), %r9	# 5401	[c=9 l=4]  *movdi_internal/3
+	leal	(%rsi,%rdx,2), %edx	# 5413	[c=8 l=3]  *leasi
+	imull	$260, %edx, %edx	# 5429	[c=12 l=6]  *mulsi3_1/1
+	andb	(%r9), %dil	# 5402	[c=9 l=3]  *andqi_1/1
+	orl	%edi, %eax	# 5404	[c=4 l=2]  *iorsi_1/0
+	andl	$1, %eax	# 5405	[c=4 l=3]  *andsi_1/0
+	andl	$7680, %edx	# 5430	[c=4 l=6]  *andsi_1/0
+	subl	%eax, %r8d	# 5406	[c=4 l=3]  *subsi_1/0
+	movb	%r8b, (%rcx)	# 5407	[c=4 l=3]  *movqi_internal/8
+	movq	104(%rbx), %rcx	# 5416	[c=9 l=4]  *movdi_internal/3
+	andl	$511, %r8d	# 5431	[c=4 l=7]  *andsi_1/0
+	movzbl	100(%rbx), %r9d	# 5414	[c=13 l=5]  *zero_extendqisi2/0
+	movl	(%rbx), %r15d	# 5443	[c=6 l=3]  *zero_extendsidi2/3
+	orl	%r8d, %edx	# 5432	[c=5 l=3]  *iorsi_1_zext
+	movzbl	(%rcx), %edi	# 5417	[c=5 l=3]  *movqi_internal/4
+	movq	1040(%rbx), %rcx	# 5420	[c=9 l=7]  *movdi_internal/3
+	movl	%r9d, %eax	# 15402	[c=4 l=3]  *movsi_internal/0
+	movl	%r9d, %esi	# 13227	[c=4 l=3]  *movsi_internal/0
+	notl	%r9d	# 5422	[c=4 l=3]  *one_cmplsi2_1/0
+	movzbl	95(%rcx), %ecx	# 5421	[c=13 l=4]  *zero_extendqisi2/0
+	andl	%edi, %eax	# 14936	[c=4 l=2]  *andsi_1/0
+	andl	$192, %esi	# 5418	[c=4 l=6]  *andsi_1/0
+	andl	%esi, %edi	# 14937	[c=4 l=2]  *andsi_1/0
+	orl	$63, %esi	# 14939	[c=4 l=3]  *iorsi_1/0
+	andl	%r9d, %ecx	# 5423	[c=4 l=3]  *andsi_1/0
+	movb	%sil, 100(%rbx)	# 5440	[c=4 l=4]  *movqi_internal/8
+	orl	%eax, %ecx	# 5426	[c=4 l=2]  *iorsi_1/0
+	leaq	flag_update_table_sub8(%rip), %rax	# 5428	[c=1 l=7]  *movdi_internal/4
+	orl	$-3, %ecx	# 5427	[c=4 l=3]  *iorsi_1/0
+	andb	(%rax,%rdx), %cl	# 5435	[c=13 l=3]  *andqi_1/1
+	leaq	101(%rbx), %rdx	# 14940	[c=4 l=4]  *leadi
+	movq	%rdx, 104(%rbx)	# 5442	[c=4 l=4]  *movdi_internal/5
+	orl	%edi, %ecx	# 14938	[c=4 l=2]  *iorsi_1/0
+	movq	%r15, %rdx	# 15403	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 5445	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 5447	[c=13 l=7]  *adddi_1/1
+	movb	%cl, 101(%rbx)	# 5438	[c=4 l=3]  *movqi_internal/8
+	movq	%r10, %rcx	# 16148	[c=4 l=3]  *movdi_internal/3
+	movzbl	9(%r15), %eax	# 5448	[c=13 l=5]  *zero_extendqisi2/0
+	movq	(%r15), %r14	# 5451	[c=5 l=3]  *movdi_internal/3
+	addl	%edx, %eax	# 5449	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 16149	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 5450	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 16150	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 16151	[c=4 l=3]  *indirect_jump
+.L957:
+	movl	$2, 96(%rbx)	# 5600	[c=4 l=7]  *movsi_internal/1
+	movzbl	10(%r15), %esi	# 5602	[c=13 l=5]  zero_extendqidi2/0
+	movzwl	12(%r15), %r13d	# 5601	[c=13 l=5]  *zero_extendhisi2/0
+	movl	%esi, %edx	# 13239	[c=4 l=2]  *movsi_internal/0
+	movq	%rsi, %rax	# 15410	[c=4 l=3]  *movdi_internal/3
+	subl	5176(%rbx), %edx	# 5604	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %edx	# 5605	[c=13 l=6]  *cmpsi_1/1
+	jb	.L958	# 5606	[c=13 l=2]  *jcc
+	movl	%esi, %edx	# 13241	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %edx	# 5609	[c=4 l=3]  *ashrsi3_1/0
+	movslq	%edx, %rdx	# 5610	[c=4 l=3]  *extendsidi2_rex64/1
+	cmpb	$0, 1080(%rbx,%rdx)	# 5611	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L959	# 5612	[c=13 l=6]  *jcc
+.L958:
+	movq	1040(%rbx), %rdx	# 5616	[c=9 l=7]  *movdi_internal/3
+	movzbl	(%rdx,%rax), %eax	# 5617	[c=13 l=4]  *zero_extendqisi2/0
+.L960:
+	testl	%eax, %r13d	# 5629	[c=4 l=3]  *testsi_1/0
+	jne	.L961	# 5630	[c=13 l=2]  *jcc
+	movl	(%rbx), %eax	# 13243	[c=5 l=2]  *movsi_internal/0
+	addq	$1, 48(%rbx)	# 5638	[c=13 l=5]  *adddi_1/0
+	addl	$1, %eax	# 5633	[c=4 l=3]  *addsi_1/0
+	andl	992(%rbx), %eax	# 5636	[c=13 l=6]  *andsi_1/1
+	movl	%eax, (%rbx)	# 5637	[c=4 l=2]  *movsi_internal/1
+.L961:
+	movq	(%rsp), %rax	# 13244	[c=5 l=4]  *movdi_internal/3
+	subq	$1, %rax	# 5641	[c=4 l=4]  *adddi_1/0
+	cmpq	%rbp, %rax	# 5642	[c=4 l=3]  *cmpdi_1/0
+	jb	.L620	# 5643	[c=13 l=6]  *jcc
+	movq	56(%rbx), %rax	# 13245	[c=9 l=4]  *movdi_internal/3
+	cmpq	%rax, 48(%rbx)	# 5646	[c=13 l=4]  *cmpdi_1/0
+	jnb	.L1597	# 5647	[c=13 l=6]  *jcc
+.L962:
+	movl	(%rbx), %r15d	# 5654	[c=6 l=3]  *zero_extendsidi2/3
+	movl	$1, 96(%rbx)	# 5659	[c=4 l=7]  *movsi_internal/1
+	movq	%r10, %rcx	# 16124	[c=4 l=3]  *movdi_internal/3
+	movq	%r15, %rdx	# 15411	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 5656	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 5658	[c=13 l=7]  *adddi_1/1
+	movzbl	11(%r15), %eax	# 5660	[c=13 l=5]  zero_extendqidi2/0
+	movq	(%r15), %r14	# 5668	[c=5 l=3]  *movdi_internal/3
+	addq	%rax, %rbp	# 5661	[c=4 l=3]  *adddi_1/0
+	movzwl	14(%r15), %eax	# 5663	[c=13 l=5]  zero_extendhidi2/0
+	addq	%rax, 48(%rbx)	# 5664	[c=13 l=4]  *adddi_1/0
+	movq	%rbp, 40(%rbx)	# 5662	[c=4 l=4]  *movdi_internal/5
+	movzbl	9(%r15), %eax	# 5665	[c=13 l=5]  *zero_extendqisi2/0
+	addl	%edx, %eax	# 5666	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 16125	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 5667	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 16126	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 16127	[c=4 l=3]  *indirect_jump
+.L1078:
+.L1417:
+	movl	(%rbx), %eax	# 12976	[c=5 l=2]  *movsi_internal/0
+	movq	1056(%rbx), %rdx	# 2019	[c=9 l=7]  *movdi_internal/3
+	subl	$1, %eax	# 2014	[c=4 l=3]  *addsi_1/0
+	movl	%eax, (%rbx)	# 2015	[c=4 l=2]  *movsi_internal/1
+	addl	%eax, %eax	# 2017	[c=5 l=2]  *ashlsi3_1_zext/0
+	movzwl	(%rdx,%rax), %ecx	# 2020	[c=13 l=4]  *zero_extendhisi2/0
+.L1412:
+	movq	832(%rbx), %r8	# 2021	[c=9 l=7]  *movdi_internal/3
+	leaq	.LC44(%rip), %rdx	# 2023	[c=1 l=7]  *movdi_internal/4
+	movq	%rbx, %rdi	# 2026	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 16889	[c=4 l=2]  *movdi_xor
+	movl	$1, %esi	# 2025	[c=4 l=5]  *movsi_internal/0
+	call	leave	# 2028	[c=0 l=5]  *call
+.L1077:
+	jmp	.L1417	# 17025	[c=1 l=2]  jump
+.L558:
+	movl	(%rbx), %eax	# 7258	[c=6 l=2]  *zero_extendsidi2/3
+	leaq	opcodes(%rip), %rsi	# 12739	[c=1 l=7]  *movdi_internal/4
+	leaq	handler.2(%rip), %r14	# 7278	[c=1 l=7]  *movdi_internal/4
+	salq	$4, %rax	# 7259	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %rax	# 7261	[c=13 l=7]  *adddi_1/1
+	movzbl	11(%rax), %edx	# 7263	[c=13 l=4]  zero_extendqidi2/0
+	movzwl	14(%rax), %eax	# 7274	[c=13 l=4]  *zero_extendhisi2/0
+	leaq	1(%rbp,%rdx), %rbp	# 7265	[c=5 l=5]  *leadi
+	movq	%rbp, 40(%rbx)	# 7266	[c=4 l=4]  *movdi_internal/5
+	movzbl	8(%r15), %ecx	# 7269	[c=13 l=5]  zero_extendqidi2/0
+	movq	%rcx, %rdx	# 13376	[c=4 l=3]  *movdi_internal/3
+	movq	(%r14,%rcx,8), %r14	# 7280	[c=10 l=4]  *movdi_internal/3
+	movq	%r10, %rcx	# 15892	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 7270	[c=4 l=4]  *ashldi3_1/0
+	movswl	10(%rsi,%rdx), %edx	# 7273	[c=14 l=5]  extendhisi2/1
+	addl	%edx, %eax	# 7275	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 15893	[c=4 l=3]  *movdi_internal/3
+	cltq	# 7276	[c=4 l=2]  *extendsidi2_rex64/0
+	addq	%rax, 48(%rbx)	# 7277	[c=13 l=4]  *adddi_1/0
+	movq	%r11, %rax	# 15894	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 15895	[c=4 l=3]  *indirect_jump
+.L1083:
+	movzbl	10(%r15), %eax	# 7357	[c=13 l=5]  zero_extendqidi2/0
+	movq	1040(%rbx), %rdx	# 7358	[c=9 l=7]  *movdi_internal/3
+	movzwl	12(%r15), %esi	# 7356	[c=9 l=5]  *movhi_internal/2
+	movzbl	(%rdx,%rax), %eax	# 7359	[c=9 l=4]  *movqi_internal/4
+	jmp	.L1421	# 17027	[c=1 l=5]  jump
+.L1107:
+	movq	1040(%rbx), %r9	# 7882	[c=9 l=7]  *movdi_internal/3
+	movzwl	12(%r15), %edx	# 7885	[c=13 l=5]  zero_extendhidi2/0
+	movzbl	10(%r15), %eax	# 7883	[c=13 l=5]  zero_extendqidi2/0
+	movzbl	(%r9,%rdx), %esi	# 7886	[c=13 l=5]  *zero_extendqisi2/0
+	movzbl	(%r9,%rax), %eax	# 7884	[c=9 l=5]  *movqi_internal/4
+	movl	%esi, %edx	# 13472	[c=4 l=2]  *movsi_internal/0
+	movl	%eax, %ecx	# 13470	[c=4 l=2]  *movsi_internal/0
+	andl	$136, %edx	# 7891	[c=4 l=6]  *andsi_1/0
+	andl	$136, %ecx	# 7888	[c=4 l=6]  *andsi_1/0
+	leal	(%rdx,%rcx,2), %ecx	# 7892	[c=8 l=3]  *leasi
+	movzbl	%al, %edx	# 7893	[c=4 l=3]  *zero_extendqisi2/0
+	imull	$260, %ecx, %eax	# 7897	[c=12 l=6]  *mulsi3_1/1
+	subl	%esi, %edx	# 7895	[c=4 l=2]  *subsi_1/0
+	movzbl	100(%rbx), %esi	# 7900	[c=9 l=4]  *movqi_internal/4
+	andl	$511, %edx	# 7896	[c=4 l=6]  *andsi_1/0
+	andl	$7680, %eax	# 7898	[c=4 l=5]  *andsi_1/0
+	orl	%eax, %edx	# 7899	[c=5 l=2]  *iorsi_1_zext
+	movl	%esi, %eax	# 13474	[c=4 l=2]  *movsi_internal/0
+	andl	$192, %eax	# 7903	[c=4 l=5]  *andsi_2/0
+	jne	.L1108	# 7904	[c=13 l=6]  *jcc
+	leaq	flag_update_table_sub8(%rip), %rax	# 7907	[c=1 l=7]  *movdi_internal/4
+	movl	$63, %esi	# 45	[c=4 l=5]  *movqi_internal/3
+	leaq	(%rax,%rdx), %r14	# 14876	[c=4 l=4]  *leadi
+	leaq	101(%rbx), %rdx	# 11483	[c=4 l=4]  *leadi
+.L1109:
+	movl	(%rbx), %edi	# 7928	[c=6 l=2]  *zero_extendsidi2/3
+	movb	%sil, 100(%rbx)	# 7926	[c=4 l=4]  *movqi_internal/8
+	movq	%r14, 104(%rbx)	# 7925	[c=4 l=4]  *movdi_internal/5
+	movq	%rdi, %r8	# 15469	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdi	# 7930	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %rdi	# 7931	[c=13 l=7]  *adddi_1/1
+	leal	1(%r8), %ecx	# 14869	[c=4 l=4]  *leasi
+	movl	%ecx, (%rbx)	# 7933	[c=4 l=2]  *movsi_internal/1
+	movzbl	(%r14), %r15d	# 7939	[c=5 l=4]  *movqi_internal/4
+	movl	%ecx, 16(%rsp)	# 14453	[c=4 l=4]  *movsi_internal/1
+	movzbl	10(%rdi), %ecx	# 7934	[c=13 l=4]  zero_extendqidi2/0
+	movzwl	12(%rdi), %edi	# 7936	[c=13 l=4]  zero_extendhidi2/0
+	movzbl	95(%r9), %r14d	# 7940	[c=13 l=5]  *zero_extendqisi2/0
+	movzbl	(%r9,%rcx), %ecx	# 7935	[c=13 l=5]  *zero_extendqisi2/0
+	movzbl	(%r9,%rdi), %r13d	# 7937	[c=13 l=5]  *zero_extendqisi2/0
+	movzbl	%sil, %edi	# 7938	[c=4 l=4]  *zero_extendqisi2/0
+	andl	%r15d, %esi	# 14870	[c=4 l=3]  *andsi_1/0
+	movl	%edi, %r9d	# 13482	[c=4 l=3]  *movsi_internal/0
+	movzbl	%sil, %esi	# 7944	[c=4 l=4]  *zero_extendqisi2/0
+	andl	$-64, %edi	# 7952	[c=4 l=3]  *andsi_1/0
+	notl	%r9d	# 7941	[c=4 l=3]  *one_cmplsi2_1/0
+	andl	%r14d, %r9d	# 7942	[c=4 l=3]  *andsi_1/0
+	orl	%esi, %r9d	# 7945	[c=4 l=3]  *iorsi_1/0
+	movl	%r13d, %esi	# 13488	[c=4 l=3]  *movsi_internal/0
+	movl	%r9d, %r14d	# 13485	[c=4 l=3]  *movsi_internal/0
+	movl	%ecx, %r9d	# 13486	[c=4 l=3]  *movsi_internal/0
+	andl	$136, %esi	# 7950	[c=4 l=6]  *andsi_1/0
+	subl	%r13d, %ecx	# 7957	[c=4 l=3]  *subsi_1/0
+	andl	$136, %r9d	# 7947	[c=4 l=7]  *andsi_1/0
+	leal	(%rsi,%r9,2), %esi	# 7951	[c=8 l=4]  *leasi
+.L1399:
+	movl	%r14d, %r9d	# 13536	[c=4 l=3]  *movsi_internal/0
+	imull	$260, %esi, %esi	# 8164	[c=12 l=6]  *mulsi3_1/1
+	andl	%edi, %r15d	# 14855	[c=4 l=3]  *andsi_1/0
+	orl	$-3, %r14d	# 8169	[c=4 l=4]  *iorsi_1/0
+	andl	$1, %r9d	# 8161	[c=4 l=4]  *andsi_1/0
+	orl	$63, %edi	# 14857	[c=4 l=3]  *iorsi_1/0
+	addl	$2, %r8d	# 8181	[c=4 l=4]  *addsi_1/0
+	movq	%rdx, 104(%rbx)	# 8177	[c=4 l=4]  *movdi_internal/5
+	subl	%r9d, %ecx	# 8162	[c=4 l=3]  *subsi_1/0
+	movb	%dil, 100(%rbx)	# 8175	[c=4 l=4]  *movqi_internal/8
+	andl	$511, %ecx	# 8163	[c=4 l=6]  *andsi_1/0
+	andl	$7680, %esi	# 8165	[c=4 l=6]  *andsi_1/0
+	movl	%r8d, (%rbx)	# 8182	[c=4 l=3]  *movsi_internal/1
+	orl	%esi, %ecx	# 8166	[c=5 l=2]  *iorsi_1_zext
+	andb	(%rax,%rcx), %r14b	# 8170	[c=13 l=4]  *andqi_1/1
+	orl	%r15d, %r14d	# 14856	[c=4 l=3]  *iorsi_1/0
+	movl	16(%rsp), %r15d	# 8178	[c=10 l=5]  *zero_extendsidi2/3
+	movb	%r14b, 101(%rbx)	# 8173	[c=4 l=4]  *movqi_internal/8
+	salq	$4, %r15	# 8179	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 8180	[c=13 l=7]  *adddi_1/1
+	jmp	.L622	# 17029	[c=1 l=5]  jump
+.L1110:
+	movq	1040(%rbx), %r9	# 7984	[c=9 l=7]  *movdi_internal/3
+	movzwl	12(%r15), %edx	# 7987	[c=13 l=5]  zero_extendhidi2/0
+	movzbl	10(%r15), %eax	# 7985	[c=13 l=5]  zero_extendqidi2/0
+	movzbl	(%r9,%rdx), %esi	# 7988	[c=13 l=5]  *zero_extendqisi2/0
+	movzbl	(%r9,%rax), %eax	# 7986	[c=9 l=5]  *movqi_internal/4
+	movl	%esi, %edx	# 13495	[c=4 l=2]  *movsi_internal/0
+	movl	%eax, %ecx	# 13493	[c=4 l=2]  *movsi_internal/0
+	andl	$136, %edx	# 7993	[c=4 l=6]  *andsi_1/0
+	andl	$136, %ecx	# 7990	[c=4 l=6]  *andsi_1/0
+	leal	(%rdx,%rcx,2), %ecx	# 7994	[c=8 l=3]  *leasi
+	movzbl	%al, %edx	# 7995	[c=4 l=3]  *zero_extendqisi2/0
+	imull	$260, %ecx, %eax	# 7999	[c=12 l=6]  *mulsi3_1/1
+	subl	%esi, %edx	# 7997	[c=4 l=2]  *subsi_1/0
+	movzbl	100(%rbx), %esi	# 8002	[c=9 l=4]  *movqi_internal/4
+	andl	$511, %edx	# 7998	[c=4 l=6]  *andsi_1/0
+	andl	$7680, %eax	# 8000	[c=4 l=5]  *andsi_1/0
+	orl	%eax, %edx	# 8001	[c=5 l=2]  *iorsi_1_zext
+	movl	%esi, %eax	# 13497	[c=4 l=2]  *movsi_internal/0
+	andl	$192, %eax	# 8005	[c=4 l=5]  *andsi_2/0
+	jne	.L1111	# 8006	[c=13 l=6]  *jcc
+	leaq	flag_update_table_sub8(%rip), %rax	# 8009	[c=1 l=7]  *movdi_internal/4
+	movl	$63, %esi	# 46	[c=4 l=5]  *movqi_internal/3
+	leaq	(%rax,%rdx), %r14	# 14868	[c=4 l=4]  *leadi
+	leaq	101(%rbx), %rdx	# 11484	[c=4 l=4]  *leadi
+.L1112:
+	movl	(%rbx), %edi	# 8030	[c=6 l=2]  *zero_extendsidi2/3
+	movb	%sil, 100(%rbx)	# 8028	[c=4 l=4]  *movqi_internal/8
+	movq	%r14, 104(%rbx)	# 8027	[c=4 l=4]  *movdi_internal/5
+	movq	%rdi, %r8	# 15470	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdi	# 8032	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %rdi	# 8033	[c=13 l=7]  *adddi_1/1
+	leal	1(%r8), %ecx	# 14861	[c=4 l=4]  *leasi
+	movl	%ecx, (%rbx)	# 8035	[c=4 l=2]  *movsi_internal/1
+	movzbl	(%r14), %r15d	# 8041	[c=5 l=4]  *movqi_internal/4
+	movl	%ecx, 16(%rsp)	# 14455	[c=4 l=4]  *movsi_internal/1
+	movzbl	10(%rdi), %ecx	# 8036	[c=13 l=4]  zero_extendqidi2/0
+	movzwl	12(%rdi), %edi	# 8038	[c=13 l=4]  zero_extendhidi2/0
+	movzbl	95(%r9), %r14d	# 8042	[c=13 l=5]  *zero_extendqisi2/0
+	movzbl	(%r9,%rcx), %ecx	# 8037	[c=13 l=5]  *zero_extendqisi2/0
+	movzbl	(%r9,%rdi), %r13d	# 8039	[c=13 l=5]  *zero_extendqisi2/0
+	movzbl	%sil, %edi	# 8040	[c=4 l=4]  *zero_extendqisi2/0
+	andl	%r15d, %esi	# 14862	[c=4 l=3]  *andsi_1/0
+	movl	%edi, %r9d	# 13505	[c=4 l=3]  *movsi_internal/0
+	movzbl	%sil, %esi	# 8046	[c=4 l=4]  *zero_extendqisi2/0
+	andl	$-64, %edi	# 8054	[c=4 l=3]  *andsi_1/0
+	notl	%r9d	# 8043	[c=4 l=3]  *one_cmplsi2_1/0
+	andl	%r14d, %r9d	# 8044	[c=4 l=3]  *andsi_1/0
+	orl	%esi, %r9d	# 8047	[c=4 l=3]  *iorsi_1/0
+	movl	%r13d, %esi	# 13511	[c=4 l=3]  *movsi_internal/0
+	movl	%r9d, %r14d	# 13508	[c=4 l=3]  *movsi_internal/0
+	movl	%ecx, %r9d	# 13509	[c=4 l=3]  *movsi_internal/0
+	andl	$136, %esi	# 8052	[c=4 l=6]  *andsi_1/0
+	subl	%r13d, %ecx	# 8059	[c=4 l=3]  *subsi_1/0
+	andl	$136, %r9d	# 8049	[c=4 l=7]  *andsi_1/0
+	leal	(%rsi,%r9,2), %esi	# 8053	[c=8 l=4]  *leasi
+.L1403:
+	movl	%r14d, %r9d	# 13559	[c=4 l=3]  *movsi_internal/0
+	imull	$260, %esi, %esi	# 8265	[c=12 l=6]  *mulsi3_1/1
+	andl	%edi, %r15d	# 14847	[c=4 l=3]  *andsi_1/0
+	orl	$-3, %r14d	# 8270	[c=4 l=4]  *iorsi_1/0
+	andl	$1, %r9d	# 8262	[c=4 l=4]  *andsi_1/0
+	orl	$63, %edi	# 14849	[c=4 l=3]  *iorsi_1/0
+	addl	$2, %r8d	# 8282	[c=4 l=4]  *addsi_1/0
+	movq	%rdx, 104(%rbx)	# 8278	[c=4 l=4]  *movdi_internal/5
+	subl	%r9d, %ecx	# 8263	[c=4 l=3]  *subsi_1/0
+	movb	%dil, 100(%rbx)	# 8276	[c=4 l=4]  *movqi_internal/8
+	andl	$511, %ecx	# 8264	[c=4 l=6]  *andsi_1/0
+	andl	$7680, %esi	# 8266	[c=4 l=6]  *andsi_1/0
+	movl	%r8d, (%rbx)	# 8283	[c=4 l=3]  *movsi_internal/1
+	orl	%esi, %ecx	# 8267	[c=5 l=2]  *iorsi_1_zext
+	andb	(%rax,%rcx), %r14b	# 8271	[c=13 l=4]  *andqi_1/1
+	orl	%r15d, %r14d	# 14848	[c=4 l=3]  *iorsi_1/0
+	movl	16(%rsp), %r15d	# 8279	[c=10 l=5]  *zero_extendsidi2/3
+	movb	%r14b, 101(%rbx)	# 8274	[c=4 l=4]  *movqi_internal/8
+	salq	$4, %r15	# 8280	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 8281	[c=13 l=7]  *adddi_1/1
+	jmp	.L625	# 17031	[c=1 l=5]  jump
+.L1116:
+	movq	1040(%rbx), %r13	# 8188	[c=9 l=7]  *movdi_internal/3
+	movzbl	10(%r15), %eax	# 8189	[c=13 l=5]  zero_extendqidi2/0
+	movzwl	12(%r15), %esi	# 8187	[c=9 l=5]  *movhi_internal/2
+	movzbl	0(%r13,%rax), %eax	# 8190	[c=9 l=6]  *movqi_internal/4
+	movl	%esi, %edx	# 13541	[c=4 l=2]  *movsi_internal/0
+	movl	%eax, %ecx	# 13539	[c=4 l=2]  *movsi_internal/0
+	andl	$136, %edx	# 8195	[c=4 l=6]  *andsi_1/0
+	andl	$136, %ecx	# 8192	[c=4 l=6]  *andsi_1/0
+	leal	(%rdx,%rcx,2), %ecx	# 8196	[c=8 l=3]  *leasi
+	movzbl	%al, %edx	# 8197	[c=4 l=3]  *zero_extendqisi2/0
+	imull	$260, %ecx, %eax	# 8201	[c=12 l=6]  *mulsi3_1/1
+	subl	%esi, %edx	# 8199	[c=4 l=2]  *subsi_1/0
+	movzbl	100(%rbx), %esi	# 8204	[c=9 l=4]  *movqi_internal/4
+	andl	$511, %edx	# 8200	[c=4 l=6]  *andsi_1/0
+	andl	$7680, %eax	# 8202	[c=4 l=5]  *andsi_1/0
+	orl	%eax, %edx	# 8203	[c=5 l=2]  *iorsi_1_zext
+	movl	%esi, %eax	# 13543	[c=4 l=2]  *movsi_internal/0
+	andl	$192, %eax	# 8207	[c=4 l=5]  *andsi_2/0
+	jne	.L1117	# 8208	[c=13 l=6]  *jcc
+	leaq	flag_update_table_sub8(%rip), %rax	# 8211	[c=1 l=7]  *movdi_internal/4
+	movl	$63, %esi	# 48	[c=4 l=5]  *movqi_internal/3
+	leaq	(%rax,%rdx), %r14	# 14852	[c=4 l=4]  *leadi
+	leaq	101(%rbx), %rdx	# 11486	[c=4 l=4]  *leadi
+.L1118:
+	movl	(%rbx), %edi	# 8232	[c=6 l=2]  *zero_extendsidi2/3
+	movb	%sil, 100(%rbx)	# 8230	[c=4 l=4]  *movqi_internal/8
+	movq	%r14, 104(%rbx)	# 8229	[c=4 l=4]  *movdi_internal/5
+	movq	%rdi, %r8	# 15472	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdi	# 8234	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %rdi	# 8235	[c=13 l=7]  *adddi_1/1
+	leal	1(%r8), %ecx	# 14845	[c=4 l=4]  *leasi
+	movl	%ecx, (%rbx)	# 8237	[c=4 l=2]  *movsi_internal/1
+	movzbl	(%r14), %r15d	# 8243	[c=5 l=4]  *movqi_internal/4
+	movl	%ecx, 16(%rsp)	# 14459	[c=4 l=4]  *movsi_internal/1
+	movzbl	10(%rdi), %ecx	# 8238	[c=13 l=4]  zero_extendqidi2/0
+	movzwl	12(%rdi), %edi	# 8240	[c=13 l=4]  zero_extendhidi2/0
+	movzbl	95(%r13), %r14d	# 8244	[c=13 l=5]  *zero_extendqisi2/0
+	movzbl	0(%r13,%rcx), %ecx	# 8239	[c=13 l=6]  *zero_extendqisi2/0
+	movzbl	0(%r13,%rdi), %r9d	# 8241	[c=13 l=6]  *zero_extendqisi2/0
+	movzbl	%sil, %edi	# 8242	[c=4 l=4]  *zero_extendqisi2/0
+	andl	%r15d, %esi	# 14846	[c=4 l=3]  *andsi_1/0
+	movl	%edi, %r13d	# 13551	[c=4 l=3]  *movsi_internal/0
+	movzbl	%sil, %esi	# 8248	[c=4 l=4]  *zero_extendqisi2/0
+	andl	$-64, %edi	# 8256	[c=4 l=3]  *andsi_1/0
+	notl	%r13d	# 8245	[c=4 l=3]  *one_cmplsi2_1/0
+	andl	%r14d, %r13d	# 8246	[c=4 l=3]  *andsi_1/0
+	movl	%r13d, %r14d	# 13553	[c=4 l=3]  *movsi_internal/0
+	movl	%ecx, %r13d	# 13555	[c=4 l=3]  *movsi_internal/0
+	subl	%r9d, %ecx	# 8261	[c=4 l=3]  *subsi_1/0
+	orl	%esi, %r14d	# 8249	[c=4 l=3]  *iorsi_1/0
+	movl	%r9d, %esi	# 13557	[c=4 l=3]  *movsi_internal/0
+	andl	$136, %r13d	# 8251	[c=4 l=7]  *andsi_1/0
+	andl	$136, %esi	# 8254	[c=4 l=6]  *andsi_1/0
+	leal	(%rsi,%r13,2), %esi	# 8255	[c=8 l=4]  *leasi
+	jmp	.L1403	# 17033	[c=1 l=5]  jump
+.L1119:
+	movq	1040(%rbx), %r8	# 8288	[c=9 l=7]  *movdi_internal/3
+	movzwl	12(%r15), %edx	# 8291	[c=13 l=5]  zero_extendhidi2/0
+	movzbl	10(%r15), %eax	# 8289	[c=13 l=5]  zero_extendqidi2/0
+	movzbl	100(%rbx), %edi	# 8306	[c=9 l=4]  *movqi_internal/4
+	movzbl	(%r8,%rdx), %esi	# 8292	[c=13 l=5]  *zero_extendqisi2/0
+	movzbl	(%r8,%rax), %eax	# 8290	[c=9 l=5]  *movqi_internal/4
+	movl	%esi, %edx	# 13564	[c=4 l=2]  *movsi_internal/0
+	movl	%eax, %ecx	# 13562	[c=4 l=2]  *movsi_internal/0
+	andl	$136, %edx	# 8297	[c=4 l=6]  *andsi_1/0
+	andl	$136, %ecx	# 8294	[c=4 l=6]  *andsi_1/0
+	leal	(%rdx,%rcx,2), %ecx	# 8298	[c=8 l=3]  *leasi
+	movzbl	%al, %edx	# 8299	[c=4 l=3]  *zero_extendqisi2/0
+	imull	$260, %ecx, %eax	# 8303	[c=12 l=6]  *mulsi3_1/1
+	subl	%esi, %edx	# 8301	[c=4 l=2]  *subsi_1/0
+	andl	$511, %edx	# 8302	[c=4 l=6]  *andsi_1/0
+	andl	$7680, %eax	# 8304	[c=4 l=5]  *andsi_1/0
+	orl	%eax, %edx	# 8305	[c=5 l=2]  *iorsi_1_zext
+	movl	%edi, %eax	# 13566	[c=4 l=2]  *movsi_internal/0
+	andl	$192, %eax	# 8309	[c=4 l=5]  *andsi_2/0
+	jne	.L1120	# 8310	[c=13 l=6]  *jcc
+	leaq	flag_update_table_sub8(%rip), %rax	# 8313	[c=1 l=7]  *movdi_internal/4
+	movl	$63, %edi	# 49	[c=4 l=5]  *movqi_internal/3
+	leaq	(%rax,%rdx), %r13	# 14844	[c=4 l=4]  *leadi
+	leaq	101(%rbx), %rdx	# 11487	[c=4 l=4]  *leadi
+.L1121:
+	movl	(%rbx), %esi	# 8334	[c=6 l=2]  *zero_extendsidi2/3
+	movb	%dil, 100(%rbx)	# 8332	[c=4 l=4]  *movqi_internal/8
+	movq	%r13, 104(%rbx)	# 8331	[c=4 l=4]  *movdi_internal/5
+	movq	%rsi, %rcx	# 15473	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rsi	# 8336	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %rsi	# 8337	[c=13 l=7]  *adddi_1/1
+	leal	1(%rcx), %r9d	# 14832	[c=4 l=4]  *leasi
+	movl	%ecx, 16(%rsp)	# 14464	[c=4 l=4]  *movsi_internal/1
+	movl	%r9d, (%rbx)	# 8339	[c=4 l=3]  *movsi_internal/1
+	movzbl	10(%rsi), %ecx	# 8340	[c=13 l=4]  zero_extendqidi2/0
+	movzwl	12(%rsi), %esi	# 8342	[c=13 l=4]  zero_extendhidi2/0
+	movzbl	0(%r13), %r15d	# 8345	[c=5 l=5]  *movqi_internal/4
+	movl	%r9d, 24(%rsp)	# 14462	[c=4 l=5]  *movsi_internal/1
+	movzbl	95(%r8), %r14d	# 8346	[c=13 l=5]  *zero_extendqisi2/0
+	movzbl	(%r8,%rcx), %ecx	# 8341	[c=13 l=5]  *zero_extendqisi2/0
+	movzbl	(%r8,%rsi), %r9d	# 8343	[c=13 l=5]  *zero_extendqisi2/0
+	movzbl	%dil, %esi	# 8344	[c=4 l=4]  *zero_extendqisi2/0
+	andl	%r15d, %edi	# 14833	[c=4 l=3]  *andsi_1/0
+	movq	%rdx, 104(%rbx)	# 8381	[c=4 l=4]  *movdi_internal/5
+	movl	%esi, %r13d	# 13577	[c=4 l=3]  *movsi_internal/0
+	movzbl	%dil, %edi	# 8350	[c=4 l=4]  *zero_extendqisi2/0
+	andl	$-64, %esi	# 8358	[c=4 l=3]  *andsi_1/0
+	notl	%r13d	# 8347	[c=4 l=3]  *one_cmplsi2_1/0
+	andl	%esi, %r15d	# 14834	[c=4 l=3]  *andsi_1/0
+	orl	$63, %esi	# 14836	[c=4 l=3]  *iorsi_1/0
+	andl	%r14d, %r13d	# 8348	[c=4 l=3]  *andsi_1/0
+	movb	%sil, 100(%rbx)	# 8379	[c=4 l=4]  *movqi_internal/8
+	movl	%r13d, %r14d	# 13579	[c=4 l=3]  *movsi_internal/0
+	movl	%ecx, %r13d	# 13581	[c=4 l=3]  *movsi_internal/0
+	subl	%r9d, %ecx	# 8363	[c=4 l=3]  *subsi_1/0
+	orl	%edi, %r14d	# 8351	[c=4 l=3]  *iorsi_1/0
+	movl	%r9d, %edi	# 13583	[c=4 l=3]  *movsi_internal/0
+	andl	$136, %r13d	# 8353	[c=4 l=7]  *andsi_1/0
+	movzbl	%sil, %r9d	# 8391	[c=4 l=4]  *zero_extendqisi2/0
+	andl	$136, %edi	# 8356	[c=4 l=6]  *andsi_1/0
+	leal	(%rdi,%r13,2), %edi	# 8357	[c=8 l=4]  *leasi
+	movl	%r14d, %r13d	# 13585	[c=4 l=3]  *movsi_internal/0
+	orl	$-3, %r14d	# 8372	[c=4 l=4]  *iorsi_1/0
+	imull	$260, %edi, %edi	# 8367	[c=12 l=6]  *mulsi3_1/1
+	andl	$1, %r13d	# 8364	[c=4 l=4]  *andsi_1/0
+	subl	%r13d, %ecx	# 8365	[c=4 l=3]  *subsi_1/0
+	andl	$511, %ecx	# 8366	[c=4 l=6]  *andsi_1/0
+	andl	$7680, %edi	# 8368	[c=4 l=6]  *andsi_1/0
+	orl	%edi, %ecx	# 8369	[c=5 l=2]  *iorsi_1_zext
+	movl	24(%rsp), %edi	# 8382	[c=10 l=4]  *zero_extendsidi2/3
+	andb	(%rax,%rcx), %r14b	# 8373	[c=13 l=4]  *andqi_1/1
+	movl	16(%rsp), %ecx	# 13588	[c=9 l=4]  *movsi_internal/0
+	orl	%r14d, %r15d	# 14835	[c=4 l=3]  *iorsi_1/0
+	salq	$4, %rdi	# 8383	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %rdi	# 8384	[c=13 l=7]  *adddi_1/1
+	leal	2(%rcx), %r14d	# 14837	[c=5 l=4]  *leadi
+	movb	%r15b, 101(%rbx)	# 8376	[c=4 l=4]  *movqi_internal/8
+	andl	%r15d, %esi	# 14838	[c=4 l=3]  *andsi_1/0
+	movl	%r14d, (%rbx)	# 8386	[c=4 l=3]  *movsi_internal/1
+	movzbl	10(%rdi), %ecx	# 8387	[c=13 l=4]  zero_extendqidi2/0
+	movzbl	%sil, %esi	# 8396	[c=4 l=4]  *zero_extendqisi2/0
+	movzwl	12(%rdi), %edi	# 8389	[c=13 l=4]  zero_extendhidi2/0
+	movzbl	(%r8,%rcx), %ecx	# 8388	[c=13 l=5]  *zero_extendqisi2/0
+	movzbl	(%r8,%rdi), %r13d	# 8390	[c=13 l=5]  *zero_extendqisi2/0
+	movzbl	95(%r8), %r8d	# 8392	[c=13 l=5]  *zero_extendqisi2/0
+	movl	%r9d, %edi	# 13589	[c=4 l=3]  *movsi_internal/0
+	andl	$-64, %r9d	# 8404	[c=4 l=4]  *andsi_1/0
+	notl	%edi	# 8393	[c=4 l=2]  *one_cmplsi2_1/0
+	andl	%r8d, %edi	# 8394	[c=4 l=3]  *andsi_1/0
+	movl	%ecx, %r8d	# 13591	[c=4 l=3]  *movsi_internal/0
+	subl	%r13d, %ecx	# 8409	[c=4 l=3]  *subsi_1/0
+	orl	%edi, %esi	# 8397	[c=4 l=2]  *iorsi_1/0
+	movl	%r13d, %edi	# 13593	[c=4 l=3]  *movsi_internal/0
+	andl	$136, %r8d	# 8399	[c=4 l=7]  *andsi_1/0
+	andl	$136, %edi	# 8402	[c=4 l=6]  *andsi_1/0
+	leal	(%rdi,%r8,2), %edi	# 8403	[c=8 l=4]  *leasi
+	movl	%esi, %r8d	# 13595	[c=4 l=3]  *movsi_internal/0
+	andl	$1, %r8d	# 8410	[c=4 l=4]  *andsi_1/0
+	subl	%r8d, %ecx	# 8411	[c=4 l=3]  *subsi_1/0
+	andl	$511, %ecx	# 8412	[c=4 l=6]  *andsi_1/0
+	imull	$260, %edi, %edi	# 8413	[c=12 l=6]  *mulsi3_1/1
+	orl	$-3, %esi	# 8418	[c=4 l=3]  *iorsi_1/0
+	andl	%r9d, %r15d	# 14839	[c=4 l=3]  *andsi_1/0
+	salq	$4, %r14	# 8426	[c=4 l=4]  *ashldi3_1/0
+	orl	$63, %r9d	# 14841	[c=4 l=4]  *iorsi_1/0
+	addq	1064(%rbx), %r14	# 8427	[c=13 l=7]  *adddi_1/1
+	movb	%r9b, 100(%rbx)	# 8424	[c=4 l=4]  *movqi_internal/8
+	andl	$7680, %edi	# 8414	[c=4 l=6]  *andsi_1/0
+	orl	%edi, %ecx	# 8415	[c=5 l=2]  *iorsi_1_zext
+	andb	(%rax,%rcx), %sil	# 8419	[c=13 l=4]  *andqi_1/1
+	movl	16(%rsp), %ecx	# 13599	[c=9 l=4]  *movsi_internal/0
+	orl	%r15d, %esi	# 14840	[c=4 l=3]  *iorsi_1/0
+	movq	%r14, %r15	# 13598	[c=4 l=3]  *movdi_internal/3
+	addl	$3, %ecx	# 8428	[c=4 l=3]  *addsi_1/0
+	movb	%sil, 101(%rbx)	# 8422	[c=4 l=4]  *movqi_internal/8
+	movl	%ecx, (%rbx)	# 8429	[c=4 l=2]  *movsi_internal/1
+	jmp	.L666	# 17035	[c=1 l=5]  jump
+.L1128:
+	movq	1040(%rbx), %rax	# 8549	[c=9 l=7]  *movdi_internal/3
+	movzbl	10(%r15), %esi	# 8551	[c=13 l=5]  zero_extendqidi2/0
+	movzwl	12(%r15), %r9d	# 8548	[c=13 l=5]  *zero_extendhisi2/0
+	movzbl	100(%rbx), %edi	# 8550	[c=9 l=4]  *movqi_internal/4
+	addq	%rax, %rsi	# 8552	[c=4 l=3]  *adddi_1/0
+	movzbl	95(%rax), %eax	# 8557	[c=13 l=4]  *zero_extendqisi2/0
+	movzbl	(%rsi), %r8d	# 8553	[c=9 l=4]  *zero_extendqisi2/0
+	movl	%r9d, %edx	# 15481	[c=4 l=3]  *movsi_internal/0
+	andl	$136, %edx	# 8572	[c=4 l=6]  *andsi_1/0
+	movl	%r8d, %ecx	# 15480	[c=4 l=3]  *movsi_internal/0
+	subl	%r9d, %r8d	# 8556	[c=4 l=3]  *subsi_1/0
+	movzbl	%dil, %r9d	# 8558	[c=4 l=4]  *zero_extendqisi2/0
+	notl	%r9d	# 8559	[c=4 l=3]  *one_cmplsi2_1/0
+	andl	$136, %ecx	# 8569	[c=4 l=6]  *andsi_1/0
+	andl	%r9d, %eax	# 8560	[c=4 l=3]  *andsi_1/0
+	movq	104(%rbx), %r9	# 8561	[c=9 l=4]  *movdi_internal/3
+	leal	(%rdx,%rcx,2), %edx	# 8573	[c=8 l=3]  *leasi
+	imull	$260, %edx, %edx	# 8589	[c=12 l=6]  *mulsi3_1/1
+	andb	(%r9), %dil	# 8562	[c=9 l=3]  *andqi_1/1
+	orl	%edi, %eax	# 8564	[c=4 l=2]  *iorsi_1/0
+	andl	$1, %eax	# 8565	[c=4 l=3]  *andsi_1/0
+	andl	$7680, %edx	# 8590	[c=4 l=6]  *andsi_1/0
+	subl	%eax, %r8d	# 8566	[c=4 l=3]  *subsi_1/0
+	movb	%r8b, (%rsi)	# 8567	[c=4 l=3]  *movqi_internal/8
+	movq	104(%rbx), %rcx	# 8576	[c=9 l=4]  *movdi_internal/3
+	andl	$511, %r8d	# 8591	[c=4 l=7]  *andsi_1/0
+	movzbl	100(%rbx), %r9d	# 8574	[c=13 l=5]  *zero_extendqisi2/0
+	orl	%r8d, %edx	# 8592	[c=5 l=3]  *iorsi_1_zext
+	movzbl	(%rcx), %edi	# 8577	[c=5 l=3]  *movqi_internal/4
+	movq	1040(%rbx), %rcx	# 8580	[c=9 l=7]  *movdi_internal/3
+	movl	%r9d, %eax	# 15482	[c=4 l=3]  *movsi_internal/0
+	movl	%r9d, %esi	# 13614	[c=4 l=3]  *movsi_internal/0
+	notl	%r9d	# 8582	[c=4 l=3]  *one_cmplsi2_1/0
+	movzbl	95(%rcx), %ecx	# 8581	[c=13 l=4]  *zero_extendqisi2/0
+	andl	%edi, %eax	# 14822	[c=4 l=2]  *andsi_1/0
+	andl	$192, %esi	# 8578	[c=4 l=6]  *andsi_1/0
+	andl	%esi, %edi	# 14823	[c=4 l=2]  *andsi_1/0
+	andl	%r9d, %ecx	# 8583	[c=4 l=3]  *andsi_1/0
+	orl	%eax, %ecx	# 8586	[c=4 l=2]  *iorsi_1/0
+	leaq	flag_update_table_sub8(%rip), %rax	# 8588	[c=1 l=7]  *movdi_internal/4
+	orl	$-3, %ecx	# 8587	[c=4 l=3]  *iorsi_1/0
+	andb	(%rax,%rdx), %cl	# 8595	[c=13 l=3]  *andqi_1/1
+	orl	%edi, %ecx	# 14824	[c=4 l=2]  *iorsi_1/0
+	movb	%cl, 101(%rbx)	# 8598	[c=4 l=3]  *movqi_internal/8
+.L1398:
+	orl	$63, %esi	# 14893	[c=4 l=3]  *iorsi_1/0
+	movb	%sil, 100(%rbx)	# 7619	[c=4 l=4]  *movqi_internal/8
+.L1397:
+	leaq	101(%rbx), %rdx	# 14894	[c=4 l=4]  *leadi
+.L1396:
+	movq	%rdx, 104(%rbx)	# 7621	[c=4 l=4]  *movdi_internal/5
+	jmp	.L1395	# 17037	[c=1 l=5]  jump
+.L1131:
+	movzbl	10(%r15), %edi	# 8733	[c=13 l=5]  zero_extendqidi2/0
+	movq	1040(%rbx), %rax	# 8732	[c=9 l=7]  *movdi_internal/3
+	movzbl	1(%rax,%rdi), %edx	# 8736	[c=14 l=5]  *zero_extendqisi2/0
+	leaq	(%rax,%rdi), %rcx	# 14805	[c=4 l=4]  *leadi
+	movzbl	(%rcx), %eax	# 8738	[c=9 l=3]  *zero_extendqisi2/0
+	sall	$8, %edx	# 8737	[c=4 l=3]  *ashlsi3_1/0
+	orl	%eax, %edx	# 8739	[c=4 l=2]  *iorsi_1/0
+	movzwl	12(%r15), %eax	# 8740	[c=13 l=5]  *zero_extendhisi2/0
+	movl	%edx, %esi	# 13624	[c=4 l=2]  *movsi_internal/0
+	shrl	$5, %edx	# 8748	[c=4 l=3]  *lshrsi3_1/0
+	subl	%eax, %esi	# 8741	[c=4 l=2]  *subsi_1/0
+	andl	$1024, %edx	# 8749	[c=4 l=6]  *andsi_1/0
+	movb	%sil, (%rcx)	# 8742	[c=4 l=3]  *movqi_internal/8
+	movl	%esi, %ecx	# 13626	[c=4 l=2]  *movsi_internal/0
+	movq	1040(%rbx), %rax	# 8744	[c=9 l=7]  *movdi_internal/3
+	sarl	$8, %ecx	# 8743	[c=4 l=3]  *ashrsi3_1/0
+	movb	%cl, 1(%rax,%rdi)	# 8745	[c=4 l=4]  *movqi_internal/8
+	andl	$511, %ecx	# 8750	[c=4 l=6]  *andsi_1/0
+	leaq	flag_update_table_sub8(%rip), %rax	# 8746	[c=1 l=7]  *movdi_internal/4
+	orl	%ecx, %edx	# 8751	[c=4 l=2]  *iorsi_1/0
+	movq	104(%rbx), %rcx	# 8764	[c=9 l=4]  *movdi_internal/3
+	movslq	%edx, %rdx	# 8752	[c=4 l=3]  *extendsidi2_rex64/1
+	movzbl	(%rax,%rdx), %edx	# 8753	[c=13 l=4]  *zero_extendqisi2/0
+	xorl	%eax, %eax	# 16776	[c=4 l=2]  *movsi_xor
+	testw	%si, %si	# 16777	[c=4 l=3]  *cmphi_ccno_1/0
+	movzbl	(%rcx), %edi	# 16779	[c=5 l=3]  *movqi_internal/4
+	setne	%al	# 16778	[c=4 l=3]  *setcc_qi_slp
+	addl	%eax, %eax	# 8758	[c=4 l=2]  *ashlsi3_1/0
+	notl	%eax	# 8759	[c=4 l=2]  *one_cmplsi2_1/0
+	andl	%eax, %edx	# 8760	[c=4 l=2]  *andsi_1/0
+	movzbl	100(%rbx), %eax	# 8761	[c=13 l=4]  *zero_extendqisi2/0
+	andl	$-33, %edx	# 8766	[c=4 l=3]  *andsi_1/0
+	andl	$-32, %eax	# 8762	[c=4 l=3]  *andsi_1/0
+	andl	%eax, %edi	# 17536	[c=4 l=2]  *andsi_1/0
+	orl	$31, %eax	# 14809	[c=4 l=3]  *iorsi_1/0
+	movl	%edi, %ecx	# 13629	[c=4 l=2]  *movqi_internal/1
+	movb	%al, 100(%rbx)	# 8770	[c=4 l=3]  *movqi_internal/8
+	orl	%ecx, %edx	# 14808	[c=4 l=2]  *iorsi_1/0
+	movb	%dl, 101(%rbx)	# 8768	[c=4 l=3]  *movqi_internal/8
+	jmp	.L1401	# 17039	[c=1 l=5]  jump
+.L1130:
+	movzbl	10(%r15), %edi	# 8681	[c=13 l=5]  zero_extendqidi2/0
+	movq	1040(%rbx), %rax	# 8680	[c=9 l=7]  *movdi_internal/3
+	movzbl	1(%rax,%rdi), %edx	# 8684	[c=14 l=5]  *zero_extendqisi2/0
+	leaq	(%rax,%rdi), %rcx	# 14811	[c=4 l=4]  *leadi
+	movzbl	(%rcx), %eax	# 8686	[c=9 l=3]  *zero_extendqisi2/0
+	sall	$8, %edx	# 8685	[c=4 l=3]  *ashlsi3_1/0
+	orl	%eax, %edx	# 8687	[c=4 l=2]  *iorsi_1/0
+	movzwl	12(%r15), %eax	# 8688	[c=13 l=5]  *zero_extendhisi2/0
+	movl	%edx, %esi	# 13618	[c=4 l=2]  *movsi_internal/0
+	shrl	$5, %edx	# 8696	[c=4 l=3]  *lshrsi3_1/0
+	subl	%eax, %esi	# 8689	[c=4 l=2]  *subsi_1/0
+	andl	$1024, %edx	# 8697	[c=4 l=6]  *andsi_1/0
+	movb	%sil, (%rcx)	# 8690	[c=4 l=3]  *movqi_internal/8
+	movl	%esi, %ecx	# 13620	[c=4 l=2]  *movsi_internal/0
+	movq	1040(%rbx), %rax	# 8692	[c=9 l=7]  *movdi_internal/3
+	sarl	$8, %ecx	# 8691	[c=4 l=3]  *ashrsi3_1/0
+	movb	%cl, 1(%rax,%rdi)	# 8693	[c=4 l=4]  *movqi_internal/8
+	andl	$511, %ecx	# 8698	[c=4 l=6]  *andsi_1/0
+	leaq	flag_update_table_sub8(%rip), %rax	# 8694	[c=1 l=7]  *movdi_internal/4
+	orl	%ecx, %edx	# 8699	[c=4 l=2]  *iorsi_1/0
+	movq	104(%rbx), %rcx	# 8712	[c=9 l=4]  *movdi_internal/3
+	movslq	%edx, %rdx	# 8700	[c=4 l=3]  *extendsidi2_rex64/1
+	movzbl	(%rax,%rdx), %edx	# 8701	[c=13 l=4]  *zero_extendqisi2/0
+	xorl	%eax, %eax	# 16781	[c=4 l=2]  *movsi_xor
+	testw	%si, %si	# 16782	[c=4 l=3]  *cmphi_ccno_1/0
+	movzbl	(%rcx), %edi	# 16784	[c=5 l=3]  *movqi_internal/4
+	setne	%al	# 16783	[c=4 l=3]  *setcc_qi_slp
+	addl	%eax, %eax	# 8706	[c=4 l=2]  *ashlsi3_1/0
+	notl	%eax	# 8707	[c=4 l=2]  *one_cmplsi2_1/0
+	andl	%eax, %edx	# 8708	[c=4 l=2]  *andsi_1/0
+	movzbl	100(%rbx), %eax	# 8709	[c=13 l=4]  *zero_extendqisi2/0
+	andl	$-33, %edx	# 8714	[c=4 l=3]  *andsi_1/0
+	andl	$-32, %eax	# 8710	[c=4 l=3]  *andsi_1/0
+	andl	%eax, %edi	# 17535	[c=4 l=2]  *andsi_1/0
+	orl	$31, %eax	# 14815	[c=4 l=3]  *iorsi_1/0
+	movl	%edi, %ecx	# 13623	[c=4 l=2]  *movqi_internal/1
+	movb	%al, 100(%rbx)	# 8718	[c=4 l=3]  *movqi_internal/8
+	orl	%ecx, %edx	# 14814	[c=4 l=2]  *iorsi_1/0
+	movb	%dl, 101(%rbx)	# 8716	[c=4 l=3]  *movqi_internal/8
+	jmp	.L1397	# 17041	[c=1 l=5]  jump
+.L1132:
+	movzbl	10(%r15), %edx	# 8784	[c=13 l=5]  zero_extendqidi2/0
+	addq	1040(%rbx), %rdx	# 8786	[c=13 l=7]  *adddi_1/1
+	movzbl	(%rdx), %ecx	# 8787	[c=5 l=3]  *movqi_internal/4
+	leal	-1(%rcx), %eax	# 14803	[c=4 l=3]  *leasi
+	subl	$1, %ecx	# 14804	[c=4 l=3]  *addsi_1/0
+	movb	%cl, (%rdx)	# 8792	[c=4 l=2]  *movqi_internal/8
+	movzbl	100(%rbx), %edx	# 8793	[c=9 l=4]  *movqi_internal/4
+	movzbl	%al, %eax	# 8790	[c=4 l=3]  zero_extendqidi2/0
+	movl	%edx, %ecx	# 13630	[c=4 l=2]  *movsi_internal/0
+	andl	$225, %ecx	# 8796	[c=4 l=6]  *andsi_2/0
+	jne	.L1133	# 8797	[c=13 l=6]  *jcc
+	leaq	flag_update_table_dec(%rip), %rdx	# 8800	[c=1 l=7]  *movdi_internal/4
+	addq	%rdx, %rax	# 8801	[c=4 l=3]  *adddi_1/0
+	movl	$30, %edx	# 52	[c=4 l=5]  *movqi_internal/3
+.L1134:
+	movq	%rax, 104(%rbx)	# 8818	[c=4 l=4]  *movdi_internal/5
+	movb	%dl, 100(%rbx)	# 8819	[c=4 l=3]  *movqi_internal/8
+	jmp	.L1395	# 17043	[c=1 l=5]  jump
+.L1135:
+	movzbl	10(%r15), %esi	# 8832	[c=13 l=5]  zero_extendqidi2/0
+	addq	1040(%rbx), %rsi	# 8834	[c=13 l=7]  *adddi_1/1
+	movzbl	(%rsi), %eax	# 8835	[c=9 l=3]  *zero_extendqisi2/0
+	movzwl	12(%r15), %edi	# 8831	[c=13 l=5]  *zero_extendhisi2/0
+	movl	%eax, %ecx	# 15491	[c=4 l=2]  *movsi_internal/0
+	movl	%edi, %edx	# 15492	[c=4 l=2]  *movsi_internal/0
+	subl	%edi, %eax	# 8838	[c=4 l=2]  *subsi_1/0
+	andl	$136, %ecx	# 8841	[c=4 l=6]  *andsi_1/0
+	andl	$136, %edx	# 8844	[c=4 l=6]  *andsi_1/0
+	movb	%al, (%rsi)	# 8839	[c=4 l=2]  *movqi_internal/8
+	movzbl	100(%rbx), %esi	# 8850	[c=9 l=4]  *movqi_internal/4
+	leal	(%rdx,%rcx,2), %edx	# 8845	[c=8 l=3]  *leasi
+	andl	$511, %eax	# 8848	[c=4 l=5]  *andsi_1/0
+	imull	$260, %edx, %edx	# 8846	[c=12 l=6]  *mulsi3_1/1
+	andl	$7680, %edx	# 8847	[c=4 l=6]  *andsi_1/0
+	orl	%eax, %edx	# 8849	[c=5 l=2]  *iorsi_1_zext
+	movl	%esi, %eax	# 13632	[c=4 l=2]  *movsi_internal/0
+	andl	$192, %eax	# 8853	[c=4 l=5]  *andsi_2/0
+	jne	.L1136	# 8854	[c=13 l=6]  *jcc
+	leaq	flag_update_table_sub8(%rip), %rax	# 8857	[c=1 l=7]  *movdi_internal/4
+	movl	$63, %esi	# 53	[c=4 l=5]  *movqi_internal/3
+	leaq	(%rax,%rdx), %rcx	# 14800	[c=4 l=4]  *leadi
+	leaq	101(%rbx), %rdx	# 11489	[c=4 l=4]  *leadi
+.L1137:
+	movl	(%rbx), %edi	# 8877	[c=6 l=2]  *zero_extendsidi2/3
+	movb	%sil, 100(%rbx)	# 8876	[c=4 l=4]  *movqi_internal/8
+	movq	%rcx, 104(%rbx)	# 8875	[c=4 l=4]  *movdi_internal/5
+	movq	%rdi, %r8	# 15493	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdi	# 8879	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %rdi	# 8881	[c=13 l=7]  *adddi_1/1
+	addl	$1, %r8d	# 8882	[c=4 l=4]  *addsi_1/0
+	movzwl	12(%rdi), %r15d	# 8884	[c=13 l=5]  *zero_extendhisi2/0
+	movl	%r8d, (%rbx)	# 8883	[c=4 l=3]  *movsi_internal/1
+	movq	1040(%rbx), %r8	# 8885	[c=9 l=7]  *movdi_internal/3
+	movzbl	10(%rdi), %r14d	# 8886	[c=13 l=5]  zero_extendqidi2/0
+	movl	%r15d, %r9d	# 15495	[c=4 l=3]  *movsi_internal/0
+	andl	$136, %r9d	# 8906	[c=4 l=7]  *andsi_1/0
+	addq	%r8, %r14	# 8887	[c=4 l=3]  *adddi_1/0
+	movzbl	95(%r8), %r8d	# 8892	[c=13 l=5]  *zero_extendqisi2/0
+	movzbl	(%r14), %edi	# 8888	[c=9 l=4]  *zero_extendqisi2/0
+	movl	%edi, %r13d	# 15494	[c=4 l=3]  *movsi_internal/0
+	subl	%r15d, %edi	# 8891	[c=4 l=3]  *subsi_1/0
+	movzbl	%sil, %r15d	# 8893	[c=4 l=4]  *zero_extendqisi2/0
+	andb	(%rcx), %sil	# 8896	[c=9 l=3]  *andqi_1/1
+	notl	%r15d	# 8894	[c=4 l=3]  *one_cmplsi2_1/0
+	andl	$136, %r13d	# 8903	[c=4 l=7]  *andsi_1/0
+	andl	%r15d, %r8d	# 8895	[c=4 l=3]  *andsi_1/0
+	orl	%esi, %r8d	# 8898	[c=4 l=3]  *iorsi_1/0
+	leal	(%r9,%r13,2), %esi	# 8907	[c=8 l=4]  *leasi
+	andl	$1, %r8d	# 8899	[c=4 l=4]  *andsi_1/0
+	imull	$260, %esi, %esi	# 8923	[c=12 l=6]  *mulsi3_1/1
+	subl	%r8d, %edi	# 8900	[c=4 l=3]  *subsi_1/0
+	movb	%dil, (%r14)	# 8901	[c=4 l=3]  *movqi_internal/8
+	movq	104(%rbx), %r9	# 8910	[c=9 l=4]  *movdi_internal/3
+	andl	$511, %edi	# 8925	[c=4 l=6]  *andsi_1/0
+	movq	1040(%rbx), %r14	# 8914	[c=9 l=7]  *movdi_internal/3
+	movzbl	100(%rbx), %ecx	# 8908	[c=13 l=4]  *zero_extendqisi2/0
+	andl	$7680, %esi	# 8924	[c=4 l=6]  *andsi_1/0
+	movzbl	(%r9), %r13d	# 8911	[c=5 l=4]  *movqi_internal/4
+	orl	%esi, %edi	# 8926	[c=4 l=2]  *iorsi_1/0
+	movzbl	95(%r14), %r14d	# 8915	[c=13 l=5]  *zero_extendqisi2/0
+	movl	%ecx, %r8d	# 15496	[c=4 l=3]  *movsi_internal/0
+	movl	%ecx, %r9d	# 13638	[c=4 l=3]  *movsi_internal/0
+	notl	%ecx	# 8916	[c=4 l=2]  *one_cmplsi2_1/0
+	andl	%r13d, %r8d	# 14794	[c=4 l=3]  *andsi_1/0
+	andl	$192, %r9d	# 8912	[c=4 l=7]  *andsi_1/0
+	movl	%edi, %esi	# 8927	[c=1 l=2]  *zero_extendsidi2/3
+	andl	%r14d, %ecx	# 8917	[c=4 l=3]  *andsi_1/0
+	andl	%r9d, %r13d	# 14795	[c=4 l=3]  *andsi_1/0
+	orl	$63, %r9d	# 14797	[c=4 l=4]  *iorsi_1/0
+	orl	%r8d, %ecx	# 8920	[c=4 l=3]  *iorsi_1/0
+	movb	%r9b, 100(%rbx)	# 8934	[c=4 l=4]  *movqi_internal/8
+	orl	$-3, %ecx	# 8921	[c=4 l=3]  *iorsi_1/0
+	andb	(%rax,%rsi), %cl	# 8929	[c=13 l=3]  *andqi_1/1
+	orl	%r13d, %ecx	# 14796	[c=4 l=3]  *iorsi_1/0
+	movb	%cl, 101(%rbx)	# 8932	[c=4 l=3]  *movqi_internal/8
+	jmp	.L1396	# 17045	[c=1 l=5]  jump
+.L1141:
+	movq	1040(%rbx), %rcx	# 9006	[c=9 l=7]  *movdi_internal/3
+	movzbl	10(%r15), %eax	# 9007	[c=13 l=5]  zero_extendqidi2/0
+	movzwl	12(%r15), %esi	# 9010	[c=13 l=5]  zero_extendhidi2/0
+	addq	%rcx, %rax	# 9008	[c=4 l=3]  *adddi_1/0
+	movzbl	(%rax), %edx	# 9009	[c=9 l=3]  *zero_extendqisi2/0
+	movzbl	(%rcx,%rsi), %ecx	# 9011	[c=13 l=4]  *zero_extendqisi2/0
+	leal	(%rdx,%rcx), %esi	# 14790	[c=4 l=3]  *leasi
+	movb	%sil, (%rax)	# 9013	[c=4 l=3]  *movqi_internal/8
+	movl	%edx, %esi	# 13650	[c=4 l=2]  *movsi_internal/0
+	movl	%ecx, %eax	# 13652	[c=4 l=2]  *movsi_internal/0
+	movzbl	100(%rbx), %r9d	# 9026	[c=9 l=5]  *movqi_internal/4
+	andl	$136, %esi	# 9015	[c=4 l=6]  *andsi_1/0
+	andl	$136, %eax	# 9018	[c=4 l=5]  *andsi_1/0
+	addl	%ecx, %edx	# 9024	[c=4 l=2]  *addsi_1/0
+	leal	(%rax,%rsi,2), %eax	# 9019	[c=8 l=3]  *leasi
+	imull	$260, %eax, %eax	# 9020	[c=12 l=6]  *mulsi3_1/1
+	andl	$7680, %eax	# 9021	[c=4 l=5]  *andsi_1/0
+	orl	%edx, %eax	# 9025	[c=5 l=2]  *iorsi_1_zext
+	movl	%r9d, %edx	# 13654	[c=4 l=3]  *movsi_internal/0
+	andl	$192, %edx	# 9029	[c=4 l=6]  *andsi_2/0
+	jne	.L1142	# 9030	[c=13 l=6]  *jcc
+	leaq	flag_update_table_add8(%rip), %rcx	# 9033	[c=1 l=7]  *movdi_internal/4
+	movl	$63, %r9d	# 55	[c=4 l=6]  *movqi_internal/3
+	leaq	(%rcx,%rax), %rdx	# 14789	[c=4 l=4]  *leadi
+.L1150:
+	movl	(%rbx), %esi	# 9235	[c=6 l=2]  *zero_extendsidi2/3
+	movb	%r9b, 100(%rbx)	# 9234	[c=4 l=4]  *movqi_internal/8
+	movzbl	%r9b, %r13d	# 9249	[c=4 l=4]  *zero_extendqisi2/0
+	movq	%rdx, 104(%rbx)	# 9233	[c=4 l=4]  *movdi_internal/5
+	notl	%r13d	# 9250	[c=4 l=3]  *one_cmplsi2_1/0
+	movq	%rsi, %rax	# 15502	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rsi	# 9237	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %rsi	# 9239	[c=13 l=7]  *adddi_1/1
+	addl	$1, %eax	# 9240	[c=4 l=3]  *addsi_1/0
+	movl	%eax, (%rbx)	# 9241	[c=4 l=2]  *movsi_internal/1
+	movq	1040(%rbx), %rax	# 9242	[c=9 l=7]  *movdi_internal/3
+	movzbl	10(%rsi), %r8d	# 9243	[c=13 l=5]  zero_extendqidi2/0
+	movzwl	12(%rsi), %esi	# 9246	[c=13 l=4]  zero_extendhidi2/0
+	andb	(%rdx), %r9b	# 9252	[c=9 l=3]  *andqi_1/1
+	movzbl	(%rax,%rsi), %esi	# 9247	[c=9 l=4]  *movqi_internal/4
+	addq	%rax, %r8	# 9244	[c=4 l=3]  *adddi_1/0
+	movzbl	95(%rax), %eax	# 9248	[c=13 l=4]  *zero_extendqisi2/0
+	movzbl	(%r8), %edi	# 9245	[c=5 l=4]  *movqi_internal/4
+	andl	%r13d, %eax	# 9251	[c=4 l=3]  *andsi_1/0
+	orl	%r9d, %eax	# 9254	[c=4 l=3]  *iorsi_1/0
+	movzbl	%dil, %edx	# 9256	[c=4 l=4]  *zero_extendqisi2/0
+	movzbl	%sil, %r9d	# 9257	[c=4 l=4]  *zero_extendqisi2/0
+	andl	$136, %edi	# 9262	[c=4 l=6]  *andsi_1/0
+	andl	$1, %eax	# 9255	[c=4 l=3]  *andsi_1/0
+	andl	$136, %esi	# 9265	[c=4 l=6]  *andsi_1/0
+	addl	%r9d, %edx	# 9258	[c=4 l=3]  *addsi_1/0
+	addl	%eax, %edx	# 9259	[c=4 l=2]  *addsi_1/0
+	leal	(%rsi,%rdi,2), %eax	# 9266	[c=8 l=3]  *leasi
+	imull	$260, %eax, %eax	# 9267	[c=12 l=6]  *mulsi3_1/1
+	movb	%dl, (%r8)	# 9260	[c=4 l=3]  *movqi_internal/8
+	andl	$7680, %eax	# 9268	[c=4 l=5]  *andsi_1/0
+	orl	%edx, %eax	# 9269	[c=5 l=2]  *iorsi_1_zext
+	movzbl	100(%rbx), %edx	# 9270	[c=9 l=4]  *movqi_internal/4
+	movl	%edx, %esi	# 13666	[c=4 l=2]  *movsi_internal/0
+	andl	$192, %esi	# 9273	[c=4 l=6]  *andsi_2/0
+	jne	.L1151	# 9274	[c=13 l=6]  *jcc
+	addq	%rcx, %rax	# 9278	[c=4 l=3]  *adddi_1/0
+	movl	$63, %edx	# 59	[c=4 l=5]  *movqi_internal/3
+	jmp	.L1152	# 17047	[c=1 l=5]  jump
+.L1146:
+	movq	1040(%rbx), %rcx	# 9126	[c=9 l=7]  *movdi_internal/3
+	movzbl	10(%r15), %eax	# 9127	[c=13 l=5]  zero_extendqidi2/0
+	movzwl	12(%r15), %esi	# 9130	[c=13 l=5]  zero_extendhidi2/0
+	addq	%rcx, %rax	# 9128	[c=4 l=3]  *adddi_1/0
+	movzbl	(%rax), %edx	# 9129	[c=9 l=3]  *zero_extendqisi2/0
+	movzbl	(%rcx,%rsi), %ecx	# 9131	[c=13 l=4]  *zero_extendqisi2/0
+	leal	(%rdx,%rcx), %esi	# 14784	[c=4 l=3]  *leasi
+	movb	%sil, (%rax)	# 9133	[c=4 l=3]  *movqi_internal/8
+	movl	%edx, %esi	# 13658	[c=4 l=2]  *movsi_internal/0
+	movl	%ecx, %eax	# 13660	[c=4 l=2]  *movsi_internal/0
+	movzbl	100(%rbx), %r9d	# 9146	[c=9 l=5]  *movqi_internal/4
+	andl	$136, %esi	# 9135	[c=4 l=6]  *andsi_1/0
+	andl	$136, %eax	# 9138	[c=4 l=5]  *andsi_1/0
+	addl	%ecx, %edx	# 9144	[c=4 l=2]  *addsi_1/0
+	leal	(%rax,%rsi,2), %eax	# 9139	[c=8 l=3]  *leasi
+	imull	$260, %eax, %eax	# 9140	[c=12 l=6]  *mulsi3_1/1
+	andl	$7680, %eax	# 9141	[c=4 l=5]  *andsi_1/0
+	orl	%edx, %eax	# 9145	[c=5 l=2]  *iorsi_1_zext
+	movl	%r9d, %edx	# 13662	[c=4 l=3]  *movsi_internal/0
+	andl	$192, %edx	# 9149	[c=4 l=6]  *andsi_2/0
+	jne	.L1147	# 9150	[c=13 l=6]  *jcc
+	leaq	flag_update_table_add8(%rip), %rcx	# 9153	[c=1 l=7]  *movdi_internal/4
+	movl	$63, %r9d	# 57	[c=4 l=6]  *movqi_internal/3
+	leaq	(%rcx,%rax), %rdx	# 14783	[c=4 l=4]  *leadi
+.L1148:
+	movl	(%rbx), %esi	# 9173	[c=6 l=2]  *zero_extendsidi2/3
+	movb	%r9b, 100(%rbx)	# 9172	[c=4 l=4]  *movqi_internal/8
+	movzbl	%r9b, %r13d	# 9187	[c=4 l=4]  *zero_extendqisi2/0
+	movq	%rdx, 104(%rbx)	# 9171	[c=4 l=4]  *movdi_internal/5
+	notl	%r13d	# 9188	[c=4 l=3]  *one_cmplsi2_1/0
+	movq	%rsi, %rax	# 15501	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rsi	# 9175	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %rsi	# 9177	[c=13 l=7]  *adddi_1/1
+	addl	$1, %eax	# 9178	[c=4 l=3]  *addsi_1/0
+	movl	%eax, (%rbx)	# 9179	[c=4 l=2]  *movsi_internal/1
+	movq	1040(%rbx), %rax	# 9180	[c=9 l=7]  *movdi_internal/3
+	movzbl	10(%rsi), %r8d	# 9181	[c=13 l=5]  zero_extendqidi2/0
+	movzwl	12(%rsi), %esi	# 9184	[c=13 l=4]  zero_extendhidi2/0
+	andb	(%rdx), %r9b	# 9190	[c=9 l=3]  *andqi_1/1
+	movzbl	(%rax,%rsi), %esi	# 9185	[c=9 l=4]  *movqi_internal/4
+	addq	%rax, %r8	# 9182	[c=4 l=3]  *adddi_1/0
+	movzbl	95(%rax), %eax	# 9186	[c=13 l=4]  *zero_extendqisi2/0
+	movzbl	(%r8), %edi	# 9183	[c=5 l=4]  *movqi_internal/4
+	andl	%r13d, %eax	# 9189	[c=4 l=3]  *andsi_1/0
+	orl	%r9d, %eax	# 9192	[c=4 l=3]  *iorsi_1/0
+	movzbl	%dil, %edx	# 9194	[c=4 l=4]  *zero_extendqisi2/0
+	movzbl	%sil, %r9d	# 9195	[c=4 l=4]  *zero_extendqisi2/0
+	andl	$136, %edi	# 9200	[c=4 l=6]  *andsi_1/0
+	andl	$1, %eax	# 9193	[c=4 l=3]  *andsi_1/0
+	addl	%r9d, %edx	# 9196	[c=4 l=3]  *addsi_1/0
+	andl	$136, %esi	# 9203	[c=4 l=6]  *andsi_1/0
+	addl	%eax, %edx	# 9197	[c=4 l=2]  *addsi_1/0
+	leal	(%rsi,%rdi,2), %eax	# 9204	[c=8 l=3]  *leasi
+	imull	$260, %eax, %eax	# 9205	[c=12 l=6]  *mulsi3_1/1
+	movb	%dl, (%r8)	# 9198	[c=4 l=3]  *movqi_internal/8
+	movzbl	100(%rbx), %r9d	# 9208	[c=9 l=5]  *movqi_internal/4
+	andl	$7680, %eax	# 9206	[c=4 l=5]  *andsi_1/0
+	orl	%edx, %eax	# 9207	[c=5 l=2]  *iorsi_1_zext
+	movl	%r9d, %edx	# 13664	[c=4 l=3]  *movsi_internal/0
+	andl	$192, %edx	# 9211	[c=4 l=6]  *andsi_2/0
+	jne	.L1149	# 9212	[c=13 l=6]  *jcc
+	leaq	(%rcx,%rax), %rdx	# 14780	[c=4 l=4]  *leadi
+	movl	$63, %r9d	# 58	[c=4 l=6]  *movqi_internal/3
+	jmp	.L1150	# 17049	[c=1 l=5]  jump
+.L1093:
+	movq	1040(%rbx), %rcx	# 7578	[c=9 l=7]  *movdi_internal/3
+	movzbl	10(%r15), %eax	# 7579	[c=13 l=5]  zero_extendqidi2/0
+	movq	104(%rbx), %rdi	# 7585	[c=9 l=4]  *movdi_internal/3
+	movzbl	100(%rbx), %esi	# 7583	[c=13 l=4]  *zero_extendqisi2/0
+	movzbl	(%rcx,%rax), %edx	# 7580	[c=13 l=4]  *zero_extendqisi2/0
+	movzwl	12(%r15), %eax	# 7581	[c=13 l=5]  zero_extendhidi2/0
+	movzbl	(%rdi), %edi	# 7586	[c=5 l=3]  *movqi_internal/4
+	movl	%esi, %r8d	# 13430	[c=4 l=3]  *movsi_internal/0
+	movzbl	(%rcx,%rax), %r9d	# 7582	[c=13 l=5]  *zero_extendqisi2/0
+	movzbl	95(%rcx), %ecx	# 7587	[c=13 l=4]  *zero_extendqisi2/0
+	movl	%esi, %eax	# 15461	[c=4 l=2]  *movsi_internal/0
+	notl	%r8d	# 7588	[c=4 l=3]  *one_cmplsi2_1/0
+	andl	%edi, %eax	# 14890	[c=4 l=2]  *andsi_1/0
+	andl	$-64, %esi	# 7599	[c=4 l=3]  *andsi_1/0
+	andl	%r8d, %ecx	# 7589	[c=4 l=3]  *andsi_1/0
+	movzbl	%al, %eax	# 7591	[c=4 l=3]  *zero_extendqisi2/0
+	movl	%edx, %r8d	# 13432	[c=4 l=3]  *movsi_internal/0
+	subl	%r9d, %edx	# 7604	[c=4 l=3]  *subsi_1/0
+	orl	%eax, %ecx	# 7592	[c=4 l=2]  *iorsi_1/0
+	movl	%r9d, %eax	# 13434	[c=4 l=3]  *movsi_internal/0
+	andl	$136, %r8d	# 7594	[c=4 l=7]  *andsi_1/0
+	andl	%esi, %edi	# 14891	[c=4 l=2]  *andsi_1/0
+	andl	$136, %eax	# 7597	[c=4 l=5]  *andsi_1/0
+	movl	%ecx, %r9d	# 13436	[c=4 l=3]  *movsi_internal/0
+	orl	$-3, %ecx	# 7613	[c=4 l=3]  *iorsi_1/0
+	leal	(%rax,%r8,2), %r8d	# 7598	[c=8 l=4]  *leasi
+	andl	$1, %r9d	# 7605	[c=4 l=4]  *andsi_1/0
+	leaq	flag_update_table_sub8(%rip), %rax	# 7601	[c=1 l=7]  *movdi_internal/4
+	imull	$260, %r8d, %r8d	# 7608	[c=12 l=7]  *mulsi3_1/1
+	subl	%r9d, %edx	# 7606	[c=4 l=3]  *subsi_1/0
+	andl	$511, %edx	# 7607	[c=4 l=6]  *andsi_1/0
+	andl	$7680, %r8d	# 7609	[c=4 l=7]  *andsi_1/0
+	orl	%r8d, %edx	# 7610	[c=5 l=3]  *iorsi_1_zext
+	andb	(%rax,%rdx), %cl	# 7614	[c=13 l=3]  *andqi_1/1
+	orl	%ecx, %edi	# 14892	[c=4 l=2]  *iorsi_1/0
+	movb	%dil, 101(%rbx)	# 7617	[c=4 l=4]  *movqi_internal/8
+	jmp	.L1398	# 17051	[c=1 l=5]  jump
+.L1090:
+	movq	1040(%rbx), %rdx	# 7522	[c=9 l=7]  *movdi_internal/3
+	movzbl	10(%r15), %eax	# 7523	[c=13 l=5]  zero_extendqidi2/0
+	movzwl	12(%r15), %ecx	# 7525	[c=13 l=5]  zero_extendhidi2/0
+	movzbl	(%rdx,%rax), %eax	# 7524	[c=9 l=4]  *movqi_internal/4
+	movzbl	(%rdx,%rcx), %esi	# 7526	[c=13 l=4]  *zero_extendqisi2/0
+.L1426:
+	movl	%eax, %ecx	# 13456	[c=4 l=2]  *movsi_internal/0
+	movl	%esi, %edx	# 13458	[c=4 l=2]  *movsi_internal/0
+	andl	$136, %edx	# 7751	[c=4 l=6]  *andsi_1/0
+	andl	$136, %ecx	# 7748	[c=4 l=6]  *andsi_1/0
+	leal	(%rdx,%rcx,2), %ecx	# 7752	[c=8 l=3]  *leasi
+	movzbl	%al, %edx	# 7753	[c=4 l=3]  *zero_extendqisi2/0
+	imull	$260, %ecx, %eax	# 7757	[c=12 l=6]  *mulsi3_1/1
+	subl	%esi, %edx	# 7755	[c=4 l=2]  *subsi_1/0
+	movzbl	100(%rbx), %ecx	# 7760	[c=9 l=4]  *movqi_internal/4
+	andl	$511, %edx	# 7756	[c=4 l=6]  *andsi_1/0
+	andl	$7680, %eax	# 7758	[c=4 l=5]  *andsi_1/0
+	orl	%eax, %edx	# 7759	[c=5 l=2]  *iorsi_1_zext
+	movl	%ecx, %eax	# 13460	[c=4 l=2]  *movsi_internal/0
+	andl	$192, %eax	# 7763	[c=4 l=5]  *andsi_2/0
+	jne	.L1099	# 7764	[c=13 l=6]  *jcc
+	leaq	flag_update_table_sub8(%rip), %rax	# 7767	[c=1 l=7]  *movdi_internal/4
+	movl	$63, %ecx	# 42	[c=4 l=5]  *movqi_internal/3
+	addq	%rdx, %rax	# 7768	[c=4 l=3]  *adddi_1/0
+.L1100:
+	movq	%rax, 104(%rbx)	# 7785	[c=4 l=4]  *movdi_internal/5
+	movb	%cl, 100(%rbx)	# 7786	[c=4 l=3]  *movqi_internal/8
+	jmp	.L1400	# 17053	[c=1 l=5]  jump
+.L1094:
+	movq	1040(%rbx), %rcx	# 7633	[c=9 l=7]  *movdi_internal/3
+	movzbl	10(%r15), %eax	# 7634	[c=13 l=5]  zero_extendqidi2/0
+	movq	104(%rbx), %rdi	# 7640	[c=9 l=4]  *movdi_internal/3
+	movzbl	100(%rbx), %esi	# 7638	[c=13 l=4]  *zero_extendqisi2/0
+	movzbl	(%rcx,%rax), %edx	# 7635	[c=13 l=4]  *zero_extendqisi2/0
+	movzwl	12(%r15), %eax	# 7636	[c=13 l=5]  zero_extendhidi2/0
+	movzbl	(%rdi), %edi	# 7641	[c=5 l=3]  *movqi_internal/4
+	movl	%esi, %r8d	# 13438	[c=4 l=3]  *movsi_internal/0
+	movzbl	(%rcx,%rax), %r9d	# 7637	[c=13 l=5]  *zero_extendqisi2/0
+	movzbl	95(%rcx), %ecx	# 7642	[c=13 l=4]  *zero_extendqisi2/0
+	movl	%esi, %eax	# 15463	[c=4 l=2]  *movsi_internal/0
+	notl	%r8d	# 7643	[c=4 l=3]  *one_cmplsi2_1/0
+	andl	%edi, %eax	# 14885	[c=4 l=2]  *andsi_1/0
+	andl	$-64, %esi	# 7654	[c=4 l=3]  *andsi_1/0
+	andl	%r8d, %ecx	# 7644	[c=4 l=3]  *andsi_1/0
+	movzbl	%al, %eax	# 7646	[c=4 l=3]  *zero_extendqisi2/0
+	movl	%edx, %r8d	# 13440	[c=4 l=3]  *movsi_internal/0
+	subl	%r9d, %edx	# 7659	[c=4 l=3]  *subsi_1/0
+	orl	%eax, %ecx	# 7647	[c=4 l=2]  *iorsi_1/0
+	movl	%r9d, %eax	# 13442	[c=4 l=3]  *movsi_internal/0
+	andl	$136, %r8d	# 7649	[c=4 l=7]  *andsi_1/0
+	andl	%esi, %edi	# 14886	[c=4 l=2]  *andsi_1/0
+	andl	$136, %eax	# 7652	[c=4 l=5]  *andsi_1/0
+	movl	%ecx, %r9d	# 13444	[c=4 l=3]  *movsi_internal/0
+	orl	$-3, %ecx	# 7668	[c=4 l=3]  *iorsi_1/0
+	leal	(%rax,%r8,2), %r8d	# 7653	[c=8 l=4]  *leasi
+	andl	$1, %r9d	# 7660	[c=4 l=4]  *andsi_1/0
+	leaq	flag_update_table_sub8(%rip), %rax	# 7656	[c=1 l=7]  *movdi_internal/4
+	imull	$260, %r8d, %r8d	# 7663	[c=12 l=7]  *mulsi3_1/1
+	subl	%r9d, %edx	# 7661	[c=4 l=3]  *subsi_1/0
+	andl	$511, %edx	# 7662	[c=4 l=6]  *andsi_1/0
+	andl	$7680, %r8d	# 7664	[c=4 l=7]  *andsi_1/0
+	orl	%r8d, %edx	# 7665	[c=5 l=3]  *iorsi_1_zext
+	andb	(%rax,%rdx), %cl	# 7669	[c=13 l=3]  *andqi_1/1
+	orl	%ecx, %edi	# 14887	[c=4 l=2]  *iorsi_1/0
+	movb	%dil, 101(%rbx)	# 7672	[c=4 l=4]  *movqi_internal/8
+	jmp	.L1402	# 17055	[c=1 l=5]  jump
+.L1086:
+	movzbl	10(%r15), %eax	# 7412	[c=13 l=5]  zero_extendqidi2/0
+	movq	1040(%rbx), %rcx	# 7411	[c=9 l=7]  *movdi_internal/3
+	movq	104(%rbx), %rdi	# 7418	[c=9 l=4]  *movdi_internal/3
+	movzbl	100(%rbx), %esi	# 7416	[c=13 l=4]  *zero_extendqisi2/0
+	movzbl	(%rcx,%rax), %edx	# 7413	[c=13 l=4]  *zero_extendqisi2/0
+	movzwl	12(%r15), %eax	# 7414	[c=13 l=5]  zero_extendhidi2/0
+	movzbl	(%rdi), %edi	# 7419	[c=5 l=3]  *movqi_internal/4
+	movl	%esi, %r8d	# 13402	[c=4 l=3]  *movsi_internal/0
+	movzbl	(%rcx,%rax), %r9d	# 7415	[c=13 l=5]  *zero_extendqisi2/0
+	movzbl	95(%rcx), %ecx	# 7420	[c=13 l=4]  *zero_extendqisi2/0
+	movl	%esi, %eax	# 15457	[c=4 l=2]  *movsi_internal/0
+	notl	%r8d	# 7421	[c=4 l=3]  *one_cmplsi2_1/0
+	andl	%edi, %eax	# 14899	[c=4 l=2]  *andsi_1/0
+	andl	$-64, %esi	# 7432	[c=4 l=3]  *andsi_1/0
+	andl	%r8d, %ecx	# 7422	[c=4 l=3]  *andsi_1/0
+	movzbl	%al, %eax	# 7424	[c=4 l=3]  *zero_extendqisi2/0
+	movl	%edx, %r8d	# 13404	[c=4 l=3]  *movsi_internal/0
+	subl	%r9d, %edx	# 7437	[c=4 l=3]  *subsi_1/0
+	orl	%eax, %ecx	# 7425	[c=4 l=2]  *iorsi_1/0
+	movl	%r9d, %eax	# 13406	[c=4 l=3]  *movsi_internal/0
+	andl	$136, %r8d	# 7427	[c=4 l=7]  *andsi_1/0
+	andl	%esi, %edi	# 14900	[c=4 l=2]  *andsi_1/0
+	andl	$136, %eax	# 7430	[c=4 l=5]  *andsi_1/0
+	movl	%ecx, %r9d	# 13408	[c=4 l=3]  *movsi_internal/0
+	orl	$-3, %ecx	# 7446	[c=4 l=3]  *iorsi_1/0
+	orl	$63, %esi	# 14902	[c=4 l=3]  *iorsi_1/0
+	leal	(%rax,%r8,2), %r8d	# 7431	[c=8 l=4]  *leasi
+	andl	$1, %r9d	# 7438	[c=4 l=4]  *andsi_1/0
+	leaq	flag_update_table_sub8(%rip), %rax	# 7434	[c=1 l=7]  *movdi_internal/4
+	movb	%sil, 100(%rbx)	# 7452	[c=4 l=4]  *movqi_internal/8
+	imull	$260, %r8d, %r8d	# 7441	[c=12 l=7]  *mulsi3_1/1
+	subl	%r9d, %edx	# 7439	[c=4 l=3]  *subsi_1/0
+	andl	$511, %edx	# 7440	[c=4 l=6]  *andsi_1/0
+	andl	$7680, %r8d	# 7442	[c=4 l=7]  *andsi_1/0
+	orl	%r8d, %edx	# 7443	[c=5 l=3]  *iorsi_1_zext
+	andb	(%rax,%rdx), %cl	# 7447	[c=13 l=3]  *andqi_1/1
+	leaq	101(%rbx), %rdx	# 14903	[c=4 l=4]  *leadi
+	orl	%ecx, %edi	# 14901	[c=4 l=2]  *iorsi_1/0
+	movq	%rdx, 104(%rbx)	# 7454	[c=4 l=4]  *movdi_internal/5
+	movb	%dil, 101(%rbx)	# 7450	[c=4 l=4]  *movqi_internal/8
+	jmp	.L1404	# 17057	[c=1 l=5]  jump
+.L1087:
+	movq	1040(%rbx), %rdx	# 7466	[c=9 l=7]  *movdi_internal/3
+	movzbl	10(%r15), %eax	# 7467	[c=13 l=5]  zero_extendqidi2/0
+	movzwl	12(%r15), %ecx	# 7469	[c=13 l=5]  zero_extendhidi2/0
+	movzbl	(%rdx,%rax), %eax	# 7468	[c=9 l=4]  *movqi_internal/4
+	movzbl	(%rdx,%rcx), %esi	# 7470	[c=13 l=4]  *zero_extendqisi2/0
+.L1430:
+	movl	%eax, %ecx	# 13446	[c=4 l=2]  *movsi_internal/0
+	movl	%esi, %edx	# 13448	[c=4 l=2]  *movsi_internal/0
+	andl	$136, %edx	# 7696	[c=4 l=6]  *andsi_1/0
+	andl	$136, %ecx	# 7693	[c=4 l=6]  *andsi_1/0
+	leal	(%rdx,%rcx,2), %ecx	# 7697	[c=8 l=3]  *leasi
+	movzbl	%al, %edx	# 7698	[c=4 l=3]  *zero_extendqisi2/0
+	imull	$260, %ecx, %eax	# 7702	[c=12 l=6]  *mulsi3_1/1
+	subl	%esi, %edx	# 7700	[c=4 l=2]  *subsi_1/0
+	andl	$511, %edx	# 7701	[c=4 l=6]  *andsi_1/0
+	andl	$7680, %eax	# 7703	[c=4 l=5]  *andsi_1/0
+	jmp	.L1428	# 17059	[c=1 l=5]  jump
+.L1098:
+	movzbl	10(%r15), %eax	# 7744	[c=13 l=5]  zero_extendqidi2/0
+	movq	1040(%rbx), %rdx	# 7745	[c=9 l=7]  *movdi_internal/3
+	movzwl	12(%r15), %esi	# 7743	[c=9 l=5]  *movhi_internal/2
+	movzbl	(%rdx,%rax), %eax	# 7746	[c=9 l=4]  *movqi_internal/4
+	jmp	.L1426	# 17061	[c=1 l=5]  jump
+.L1101:
+	movq	1040(%rbx), %rdx	# 7799	[c=9 l=7]  *movdi_internal/3
+	movzbl	10(%r15), %eax	# 7798	[c=13 l=5]  zero_extendqidi2/0
+	movzbl	(%rdx,%rax), %eax	# 7800	[c=13 l=4]  zero_extendqidi2/0
+	movzbl	100(%rbx), %edx	# 7801	[c=9 l=4]  *movqi_internal/4
+	movl	%edx, %ecx	# 13466	[c=4 l=2]  *movsi_internal/0
+	andl	$225, %ecx	# 7804	[c=4 l=6]  *andsi_2/0
+	jne	.L1102	# 7805	[c=13 l=6]  *jcc
+	leaq	flag_update_table_logical(%rip), %rdx	# 7808	[c=1 l=7]  *movdi_internal/4
+	addq	%rdx, %rax	# 7809	[c=4 l=3]  *adddi_1/0
+	movl	$30, %edx	# 43	[c=4 l=5]  *movqi_internal/3
+	jmp	.L1134	# 17063	[c=1 l=5]  jump
+.L1113:
+	movq	1040(%rbx), %r13	# 8087	[c=9 l=7]  *movdi_internal/3
+	movzbl	10(%r15), %eax	# 8088	[c=13 l=5]  zero_extendqidi2/0
+	movzwl	12(%r15), %esi	# 8086	[c=9 l=5]  *movhi_internal/2
+	movzbl	0(%r13,%rax), %eax	# 8089	[c=9 l=6]  *movqi_internal/4
+	movl	%esi, %edx	# 13518	[c=4 l=2]  *movsi_internal/0
+	movl	%eax, %ecx	# 13516	[c=4 l=2]  *movsi_internal/0
+	andl	$136, %edx	# 8094	[c=4 l=6]  *andsi_1/0
+	andl	$136, %ecx	# 8091	[c=4 l=6]  *andsi_1/0
+	leal	(%rdx,%rcx,2), %ecx	# 8095	[c=8 l=3]  *leasi
+	movzbl	%al, %edx	# 8096	[c=4 l=3]  *zero_extendqisi2/0
+	imull	$260, %ecx, %eax	# 8100	[c=12 l=6]  *mulsi3_1/1
+	subl	%esi, %edx	# 8098	[c=4 l=2]  *subsi_1/0
+	movzbl	100(%rbx), %esi	# 8103	[c=9 l=4]  *movqi_internal/4
+	andl	$511, %edx	# 8099	[c=4 l=6]  *andsi_1/0
+	andl	$7680, %eax	# 8101	[c=4 l=5]  *andsi_1/0
+	orl	%eax, %edx	# 8102	[c=5 l=2]  *iorsi_1_zext
+	movl	%esi, %eax	# 13520	[c=4 l=2]  *movsi_internal/0
+	andl	$192, %eax	# 8106	[c=4 l=5]  *andsi_2/0
+	jne	.L1114	# 8107	[c=13 l=6]  *jcc
+	leaq	flag_update_table_sub8(%rip), %rax	# 8110	[c=1 l=7]  *movdi_internal/4
+	movl	$63, %esi	# 47	[c=4 l=5]  *movqi_internal/3
+	leaq	(%rax,%rdx), %r14	# 14860	[c=4 l=4]  *leadi
+	leaq	101(%rbx), %rdx	# 11485	[c=4 l=4]  *leadi
+.L1115:
+	movl	(%rbx), %edi	# 8131	[c=6 l=2]  *zero_extendsidi2/3
+	movb	%sil, 100(%rbx)	# 8129	[c=4 l=4]  *movqi_internal/8
+	movq	%r14, 104(%rbx)	# 8128	[c=4 l=4]  *movdi_internal/5
+	movq	%rdi, %r8	# 15471	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdi	# 8133	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %rdi	# 8134	[c=13 l=7]  *adddi_1/1
+	leal	1(%r8), %ecx	# 14853	[c=4 l=4]  *leasi
+	movl	%ecx, (%rbx)	# 8136	[c=4 l=2]  *movsi_internal/1
+	movzbl	(%r14), %r15d	# 8142	[c=5 l=4]  *movqi_internal/4
+	movl	%ecx, 16(%rsp)	# 14457	[c=4 l=4]  *movsi_internal/1
+	movzbl	10(%rdi), %ecx	# 8137	[c=13 l=4]  zero_extendqidi2/0
+	movzwl	12(%rdi), %edi	# 8139	[c=13 l=4]  zero_extendhidi2/0
+	movzbl	95(%r13), %r14d	# 8143	[c=13 l=5]  *zero_extendqisi2/0
+	movzbl	0(%r13,%rcx), %ecx	# 8138	[c=13 l=6]  *zero_extendqisi2/0
+	movzbl	0(%r13,%rdi), %r9d	# 8140	[c=13 l=6]  *zero_extendqisi2/0
+	movzbl	%sil, %edi	# 8141	[c=4 l=4]  *zero_extendqisi2/0
+	andl	%r15d, %esi	# 14854	[c=4 l=3]  *andsi_1/0
+	movl	%edi, %r13d	# 13528	[c=4 l=3]  *movsi_internal/0
+	movzbl	%sil, %esi	# 8147	[c=4 l=4]  *zero_extendqisi2/0
+	andl	$-64, %edi	# 8155	[c=4 l=3]  *andsi_1/0
+	notl	%r13d	# 8144	[c=4 l=3]  *one_cmplsi2_1/0
+	andl	%r14d, %r13d	# 8145	[c=4 l=3]  *andsi_1/0
+	movl	%r13d, %r14d	# 13530	[c=4 l=3]  *movsi_internal/0
+	movl	%ecx, %r13d	# 13532	[c=4 l=3]  *movsi_internal/0
+	subl	%r9d, %ecx	# 8160	[c=4 l=3]  *subsi_1/0
+	orl	%esi, %r14d	# 8148	[c=4 l=3]  *iorsi_1/0
+	movl	%r9d, %esi	# 13534	[c=4 l=3]  *movsi_internal/0
+	andl	$136, %r13d	# 8150	[c=4 l=7]  *andsi_1/0
+	andl	$136, %esi	# 8153	[c=4 l=6]  *andsi_1/0
+	leal	(%rsi,%r13,2), %esi	# 8154	[c=8 l=4]  *leasi
+	jmp	.L1399	# 17065	[c=1 l=5]  jump
+.L1104:
+	movq	1040(%rbx), %rdx	# 7841	[c=9 l=7]  *movdi_internal/3
+	movzbl	10(%r15), %eax	# 7840	[c=13 l=5]  zero_extendqidi2/0
+	movzbl	(%rdx,%rax), %eax	# 7842	[c=13 l=4]  zero_extendqidi2/0
+	movzbl	100(%rbx), %edx	# 7843	[c=9 l=4]  *movqi_internal/4
+	movl	%edx, %ecx	# 13468	[c=4 l=2]  *movsi_internal/0
+	andl	$225, %ecx	# 7846	[c=4 l=6]  *andsi_2/0
+	jne	.L1105	# 7847	[c=13 l=6]  *jcc
+	leaq	flag_update_table_logical(%rip), %rdx	# 7850	[c=1 l=7]  *movdi_internal/4
+	addq	%rdx, %rax	# 7851	[c=4 l=3]  *adddi_1/0
+	movl	$30, %edx	# 44	[c=4 l=5]  *movqi_internal/3
+.L1106:
+	movq	%rax, 104(%rbx)	# 7869	[c=4 l=4]  *movdi_internal/5
+	movb	%dl, 100(%rbx)	# 7870	[c=4 l=3]  *movqi_internal/8
+	jmp	.L1400	# 17067	[c=1 l=5]  jump
+.L1095:
+	movzbl	10(%r15), %eax	# 7689	[c=13 l=5]  zero_extendqidi2/0
+	movq	1040(%rbx), %rdx	# 7690	[c=9 l=7]  *movdi_internal/3
+	movzwl	12(%r15), %esi	# 7688	[c=9 l=5]  *movhi_internal/2
+	movzbl	(%rdx,%rax), %eax	# 7691	[c=9 l=4]  *movqi_internal/4
+	jmp	.L1430	# 17069	[c=1 l=5]  jump
+.L1020:
+	movzwl	12(%r15), %esi	# 6430	[c=13 l=5]  zero_extendhidi2/0
+	movzbl	10(%r15), %edx	# 6432	[c=13 l=5]  zero_extendqidi2/0
+	movq	1040(%rbx), %rcx	# 6431	[c=9 l=7]  *movdi_internal/3
+	movq	%rsi, %rax	# 15427	[c=4 l=3]  *movdi_internal/3
+	movzbl	(%rcx,%rdx), %edi	# 6433	[c=9 l=4]  *movqi_internal/4
+	movl	%esi, %edx	# 13294	[c=4 l=2]  *movsi_internal/0
+	subl	5176(%rbx), %edx	# 6435	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %edx	# 6436	[c=13 l=6]  *cmpsi_1/1
+	jb	.L1021	# 6437	[c=13 l=2]  *jcc
+	movl	%esi, %edx	# 13296	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %edx	# 6440	[c=4 l=3]  *ashrsi3_1/0
+	movslq	%edx, %rdx	# 6441	[c=4 l=3]  *extendsidi2_rex64/1
+	cmpb	$0, 1080(%rbx,%rdx)	# 6442	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L1022	# 6443	[c=13 l=6]  *jcc
+.L1021:
+	movb	%dil, (%rcx,%rax)	# 6447	[c=4 l=4]  *movqi_internal/8
+.L1023:
+	movl	(%rbx), %r15d	# 6459	[c=6 l=3]  *zero_extendsidi2/3
+	movq	%r10, %rcx	# 16028	[c=4 l=3]  *movdi_internal/3
+	movq	%r15, %rdx	# 15428	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 6461	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 6463	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%r15), %eax	# 6464	[c=13 l=5]  *zero_extendqisi2/0
+	movq	(%r15), %r14	# 6467	[c=5 l=3]  *movdi_internal/3
+	addl	%edx, %eax	# 6465	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 16029	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 6466	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 16030	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 16031	[c=4 l=3]  *indirect_jump
+.L1024:
+	movzwl	12(%r15), %esi	# 6472	[c=13 l=5]  zero_extendhidi2/0
+	movzbl	10(%r15), %edx	# 6474	[c=13 l=5]  zero_extendqidi2/0
+	movq	1040(%rbx), %rcx	# 6473	[c=9 l=7]  *movdi_internal/3
+	movq	%rsi, %rax	# 15429	[c=4 l=3]  *movdi_internal/3
+	movzbl	(%rcx,%rdx), %edi	# 6475	[c=9 l=4]  *movqi_internal/4
+	movl	%esi, %edx	# 13298	[c=4 l=2]  *movsi_internal/0
+	subl	5176(%rbx), %edx	# 6477	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %edx	# 6478	[c=13 l=6]  *cmpsi_1/1
+	jb	.L1025	# 6479	[c=13 l=2]  *jcc
+	movl	%esi, %edx	# 13300	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %edx	# 6482	[c=4 l=3]  *ashrsi3_1/0
+	movslq	%edx, %rdx	# 6483	[c=4 l=3]  *extendsidi2_rex64/1
+	cmpb	$0, 1080(%rbx,%rdx)	# 6484	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L1026	# 6485	[c=13 l=6]  *jcc
+.L1025:
+	movb	%dil, (%rcx,%rax)	# 6489	[c=4 l=4]  *movqi_internal/8
+.L1027:
+	movl	(%rbx), %r15d	# 6501	[c=6 l=3]  *zero_extendsidi2/3
+	movq	%r10, %rcx	# 16020	[c=4 l=3]  *movdi_internal/3
+	movq	%r15, %rdx	# 15430	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 6503	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 6505	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%r15), %eax	# 6506	[c=13 l=5]  *zero_extendqisi2/0
+	movq	(%r15), %r14	# 6509	[c=5 l=3]  *movdi_internal/3
+	addl	%edx, %eax	# 6507	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 16021	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 6508	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 16022	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 16023	[c=4 l=3]  *indirect_jump
+.L1056:
+	movq	1040(%rbx), %rcx	# 6841	[c=9 l=7]  *movdi_internal/3
+	movzbl	10(%r15), %edx	# 6842	[c=13 l=5]  zero_extendqidi2/0
+	movzwl	12(%r15), %esi	# 6845	[c=13 l=5]  zero_extendhidi2/0
+	addq	%rcx, %rdx	# 6843	[c=4 l=3]  *adddi_1/0
+	movzbl	(%rdx), %eax	# 6844	[c=5 l=3]  *movqi_internal/4
+	movzbl	(%rcx,%rsi), %esi	# 6846	[c=13 l=4]  *zero_extendqisi2/0
+	movl	%eax, %ecx	# 13336	[c=4 l=2]  *movqi_internal/0
+	subl	%esi, %ecx	# 14923	[c=4 l=2]  *subsi_1/0
+	movb	%cl, (%rdx)	# 6848	[c=4 l=2]  *movqi_internal/8
+	movl	%eax, %ecx	# 13338	[c=4 l=2]  *movsi_internal/0
+	movl	%esi, %edx	# 13340	[c=4 l=2]  *movsi_internal/0
+	andl	$136, %edx	# 6853	[c=4 l=6]  *andsi_1/0
+	andl	$136, %ecx	# 6850	[c=4 l=6]  *andsi_1/0
+	leal	(%rdx,%rcx,2), %ecx	# 6854	[c=8 l=3]  *leasi
+	movzbl	%al, %edx	# 6855	[c=4 l=3]  *zero_extendqisi2/0
+	imull	$260, %ecx, %eax	# 6859	[c=12 l=6]  *mulsi3_1/1
+	subl	%esi, %edx	# 6857	[c=4 l=2]  *subsi_1/0
+	movzbl	100(%rbx), %ecx	# 6862	[c=9 l=4]  *movqi_internal/4
+	andl	$511, %edx	# 6858	[c=4 l=6]  *andsi_1/0
+	andl	$7680, %eax	# 6860	[c=4 l=5]  *andsi_1/0
+	orl	%eax, %edx	# 6861	[c=5 l=2]  *iorsi_1_zext
+	movl	%ecx, %eax	# 13342	[c=4 l=2]  *movsi_internal/0
+	andl	$192, %eax	# 6865	[c=4 l=5]  *andsi_2/0
+	jne	.L1057	# 6866	[c=13 l=6]  *jcc
+	leaq	flag_update_table_sub8(%rip), %rax	# 6869	[c=1 l=7]  *movdi_internal/4
+	movl	$63, %ecx	# 30	[c=4 l=5]  *movqi_internal/3
+	addq	%rdx, %rax	# 6870	[c=4 l=3]  *adddi_1/0
+.L1058:
+	movl	(%rbx), %r15d	# 6889	[c=6 l=3]  *zero_extendsidi2/3
+	movb	%cl, 100(%rbx)	# 6888	[c=4 l=3]  *movqi_internal/8
+	movq	%r10, %rcx	# 15956	[c=4 l=3]  *movdi_internal/3
+	movq	%rax, 104(%rbx)	# 6887	[c=4 l=4]  *movdi_internal/5
+	movq	%r15, %rdx	# 15442	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 6891	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 6893	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%r15), %eax	# 6894	[c=13 l=5]  *zero_extendqisi2/0
+	movq	(%r15), %r14	# 6897	[c=5 l=3]  *movdi_internal/3
+	addl	%edx, %eax	# 6895	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 15957	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 6896	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 15958	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 15959	[c=4 l=3]  *indirect_jump
+.L1059:
+	movzbl	10(%r15), %esi	# 6903	[c=13 l=5]  zero_extendqidi2/0
+	addq	1040(%rbx), %rsi	# 6905	[c=13 l=7]  *adddi_1/1
+	movzwl	12(%r15), %edi	# 6902	[c=13 l=5]  *zero_extendhisi2/0
+	movzbl	(%rsi), %eax	# 6906	[c=9 l=3]  *zero_extendqisi2/0
+	movl	%edi, %edx	# 15444	[c=4 l=2]  *movsi_internal/0
+	movl	%eax, %ecx	# 15443	[c=4 l=2]  *movsi_internal/0
+	subl	%edi, %eax	# 6909	[c=4 l=2]  *subsi_1/0
+	andl	$136, %ecx	# 6912	[c=4 l=6]  *andsi_1/0
+	andl	$136, %edx	# 6915	[c=4 l=6]  *andsi_1/0
+	movb	%al, (%rsi)	# 6910	[c=4 l=2]  *movqi_internal/8
+	andl	$511, %eax	# 6919	[c=4 l=5]  *andsi_1/0
+	leal	(%rdx,%rcx,2), %edx	# 6916	[c=8 l=3]  *leasi
+	movzbl	100(%rbx), %ecx	# 6921	[c=9 l=4]  *movqi_internal/4
+	imull	$260, %edx, %edx	# 6917	[c=12 l=6]  *mulsi3_1/1
+	andl	$7680, %edx	# 6918	[c=4 l=6]  *andsi_1/0
+	orl	%eax, %edx	# 6920	[c=5 l=2]  *iorsi_1_zext
+	movl	%ecx, %eax	# 13348	[c=4 l=2]  *movsi_internal/0
+	andl	$192, %eax	# 6924	[c=4 l=5]  *andsi_2/0
+	jne	.L1060	# 6925	[c=13 l=6]  *jcc
+	leaq	flag_update_table_sub8(%rip), %rax	# 6928	[c=1 l=7]  *movdi_internal/4
+	movl	$63, %ecx	# 31	[c=4 l=5]  *movqi_internal/3
+	addq	%rdx, %rax	# 6929	[c=4 l=3]  *adddi_1/0
+.L1061:
+	movl	(%rbx), %r15d	# 6948	[c=6 l=3]  *zero_extendsidi2/3
+	movb	%cl, 100(%rbx)	# 6947	[c=4 l=3]  *movqi_internal/8
+	movq	%r10, %rcx	# 15948	[c=4 l=3]  *movdi_internal/3
+	movq	%rax, 104(%rbx)	# 6946	[c=4 l=4]  *movdi_internal/5
+	movq	%r15, %rdx	# 15445	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 6950	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 6952	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%r15), %eax	# 6953	[c=13 l=5]  *zero_extendqisi2/0
+	movq	(%r15), %r14	# 6956	[c=5 l=3]  *movdi_internal/3
+	addl	%edx, %eax	# 6954	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 15949	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 6955	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 15950	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 15951	[c=4 l=3]  *indirect_jump
+.L1062:
+	movzbl	10(%r15), %eax	# 6961	[c=13 l=5]  zero_extendqidi2/0
+	addq	1040(%rbx), %rax	# 6963	[c=13 l=7]  *adddi_1/1
+	movq	%r10, %rcx	# 15940	[c=4 l=3]  *movdi_internal/3
+	rolb	$4, (%rax)	# 6964	[c=9 l=3]  *rotlqi3_1
+	movl	(%rbx), %r15d	# 6965	[c=6 l=3]  *zero_extendsidi2/3
+	movq	%r15, %rdx	# 15446	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 6967	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 6969	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%r15), %eax	# 6970	[c=13 l=5]  *zero_extendqisi2/0
+	movq	(%r15), %r14	# 6973	[c=5 l=3]  *movdi_internal/3
+	addl	%edx, %eax	# 6971	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 15941	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 6972	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 15942	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 15943	[c=4 l=3]  *indirect_jump
+.L1063:
+	movl	(%rbx), %r15d	# 6978	[c=6 l=3]  *zero_extendsidi2/3
+	movq	%r10, %rcx	# 15932	[c=4 l=3]  *movdi_internal/3
+	movq	%r15, %rdx	# 15447	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 6980	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 6982	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%r15), %eax	# 6983	[c=13 l=5]  *zero_extendqisi2/0
+	movq	(%r15), %r14	# 6986	[c=5 l=3]  *movdi_internal/3
+	addl	%edx, %eax	# 6984	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 15933	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 6985	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 15934	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 15935	[c=4 l=3]  *indirect_jump
+.L1064:
+	movzbl	10(%r15), %eax	# 6991	[c=13 l=5]  zero_extendqidi2/0
+	movq	1040(%rbx), %rdx	# 6992	[c=9 l=7]  *movdi_internal/3
+	movl	$30, %ecx	# 33	[c=4 l=5]  *movqi_internal/3
+	leaq	flag_update_table_logical(%rip), %rsi	# 32	[c=1 l=7]  *movdi_internal/4
+	movb	$0, (%rdx,%rax)	# 6993	[c=4 l=4]  *movqi_internal/8
+	movzbl	100(%rbx), %eax	# 6994	[c=9 l=4]  *movqi_internal/4
+	movl	%eax, %edx	# 13354	[c=4 l=2]  *movsi_internal/0
+	andl	$225, %edx	# 6997	[c=4 l=6]  *andsi_2/0
+	je	.L1065	# 6998	[c=13 l=2]  *jcc
+	movq	104(%rbx), %rcx	# 7000	[c=9 l=4]  *movdi_internal/3
+	orl	$30, %eax	# 14917	[c=4 l=3]  *iorsi_1/0
+	leaq	101(%rbx), %rsi	# 14918	[c=4 l=4]  *leadi
+	andb	(%rcx), %dl	# 7001	[c=9 l=2]  *andqi_1/1
+	movl	%eax, %ecx	# 13357	[c=4 l=2]  *movqi_internal/0
+	orl	$2, %edx	# 14916	[c=4 l=3]  *iorsi_1/0
+	movb	%dl, 101(%rbx)	# 7003	[c=4 l=3]  *movqi_internal/8
+.L1065:
+	movl	(%rbx), %r15d	# 7010	[c=6 l=3]  *zero_extendsidi2/3
+	movb	%cl, 100(%rbx)	# 7009	[c=4 l=3]  *movqi_internal/8
+	movq	%r10, %rcx	# 15924	[c=4 l=3]  *movdi_internal/3
+	movq	%rsi, 104(%rbx)	# 7008	[c=4 l=4]  *movdi_internal/5
+	movq	%r15, %rdx	# 15448	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 7012	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 7014	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%r15), %eax	# 7015	[c=13 l=5]  *zero_extendqisi2/0
+	movq	(%r15), %r14	# 7018	[c=5 l=3]  *movdi_internal/3
+	addl	%edx, %eax	# 7016	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 15925	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 7017	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 15926	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 15927	[c=4 l=3]  *indirect_jump
+.L1066:
+	movzbl	10(%r15), %ecx	# 7023	[c=13 l=5]  zero_extendqidi2/0
+	addq	1040(%rbx), %rcx	# 7025	[c=13 l=7]  *adddi_1/1
+	movzbl	(%rcx), %edx	# 7026	[c=9 l=3]  *zero_extendqisi2/0
+	movl	%edx, %eax	# 15449	[c=4 l=2]  *movsi_internal/0
+	addl	%edx, %edx	# 7028	[c=4 l=2]  *ashlsi3_1/0
+	andl	$136, %eax	# 7031	[c=4 l=5]  *andsi_1/0
+	movb	%dl, (%rcx)	# 7029	[c=4 l=2]  *movqi_internal/8
+	imull	$780, %eax, %eax	# 7032	[c=12 l=6]  *mulsi3_1/1
+	andl	$7680, %eax	# 7033	[c=4 l=5]  *andsi_1/0
+	orl	%edx, %eax	# 7034	[c=5 l=2]  *iorsi_1_zext
+	movzbl	100(%rbx), %edx	# 7035	[c=9 l=4]  *movqi_internal/4
+	movl	%edx, %ecx	# 13358	[c=4 l=2]  *movsi_internal/0
+	andl	$192, %ecx	# 7038	[c=4 l=6]  *andsi_2/0
+	jne	.L1067	# 7039	[c=13 l=6]  *jcc
+	leaq	flag_update_table_add8(%rip), %rcx	# 7042	[c=1 l=7]  *movdi_internal/4
+	movl	$63, %edx	# 34	[c=4 l=5]  *movqi_internal/3
+	addq	%rcx, %rax	# 7043	[c=4 l=3]  *adddi_1/0
+.L1068:
+	movl	(%rbx), %r15d	# 7062	[c=6 l=3]  *zero_extendsidi2/3
+	movb	%dl, 100(%rbx)	# 7061	[c=4 l=3]  *movqi_internal/8
+	movq	%r10, %rcx	# 15916	[c=4 l=3]  *movdi_internal/3
+	movq	%rax, 104(%rbx)	# 7060	[c=4 l=4]  *movdi_internal/5
+	movq	%r15, %rdx	# 15450	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 7064	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 7066	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%r15), %eax	# 7067	[c=13 l=5]  *zero_extendqisi2/0
+	movq	(%r15), %r14	# 7070	[c=5 l=3]  *movdi_internal/3
+	addl	%edx, %eax	# 7068	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 15917	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 7069	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 15918	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 15919	[c=4 l=3]  *indirect_jump
+.L1069:
+	movq	1040(%rbx), %rdx	# 7075	[c=9 l=7]  *movdi_internal/3
+	movzbl	10(%r15), %esi	# 7077	[c=13 l=5]  zero_extendqidi2/0
+	movzbl	100(%rbx), %edi	# 7076	[c=13 l=4]  *zero_extendqisi2/0
+	addq	%rdx, %rsi	# 7078	[c=4 l=3]  *adddi_1/0
+	movzbl	95(%rdx), %edx	# 7080	[c=13 l=4]  *zero_extendqisi2/0
+	movl	%edi, %ecx	# 15451	[c=4 l=2]  *movsi_internal/0
+	notl	%edi	# 7082	[c=4 l=2]  *one_cmplsi2_1/0
+	movzbl	(%rsi), %eax	# 7079	[c=5 l=3]  *movqi_internal/4
+	andl	%edi, %edx	# 7083	[c=4 l=2]  *andsi_1/0
+	movq	104(%rbx), %rdi	# 7084	[c=9 l=4]  *movdi_internal/3
+	andb	(%rdi), %cl	# 7085	[c=9 l=2]  *andqi_1/1
+	orl	%ecx, %edx	# 7087	[c=4 l=2]  *iorsi_1/0
+	movzbl	%al, %ecx	# 7089	[c=4 l=3]  *zero_extendqisi2/0
+	andl	$136, %eax	# 7094	[c=4 l=5]  *andsi_1/0
+	imull	$780, %eax, %eax	# 7095	[c=12 l=6]  *mulsi3_1/1
+	andl	$1, %edx	# 7088	[c=4 l=3]  *andsi_1/0
+	leal	(%rdx,%rcx,2), %edx	# 7091	[c=8 l=3]  *leasi
+	movb	%dl, (%rsi)	# 7092	[c=4 l=2]  *movqi_internal/8
+	andl	$7680, %eax	# 7096	[c=4 l=5]  *andsi_1/0
+	orl	%edx, %eax	# 7097	[c=5 l=2]  *iorsi_1_zext
+	movzbl	100(%rbx), %edx	# 7098	[c=9 l=4]  *movqi_internal/4
+	movl	%edx, %ecx	# 13364	[c=4 l=2]  *movsi_internal/0
+	andl	$192, %ecx	# 7101	[c=4 l=6]  *andsi_2/0
+	jne	.L1070	# 7102	[c=13 l=6]  *jcc
+	leaq	flag_update_table_add8(%rip), %rcx	# 7105	[c=1 l=7]  *movdi_internal/4
+	movl	$63, %edx	# 35	[c=4 l=5]  *movqi_internal/3
+	addq	%rcx, %rax	# 7106	[c=4 l=3]  *adddi_1/0
+.L1071:
+	movl	(%rbx), %r15d	# 7125	[c=6 l=3]  *zero_extendsidi2/3
+	movb	%dl, 100(%rbx)	# 7124	[c=4 l=3]  *movqi_internal/8
+	movq	%r10, %rcx	# 15908	[c=4 l=3]  *movdi_internal/3
+	movq	%rax, 104(%rbx)	# 7123	[c=4 l=4]  *movdi_internal/5
+	movq	%r15, %rdx	# 15452	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 7127	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 7129	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%r15), %eax	# 7130	[c=13 l=5]  *zero_extendqisi2/0
+	movq	(%r15), %r14	# 7133	[c=5 l=3]  *movdi_internal/3
+	addl	%edx, %eax	# 7131	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 15909	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 7132	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 15910	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 15911	[c=4 l=3]  *indirect_jump
+.L1072:
+	movq	1040(%rbx), %rdx	# 7139	[c=9 l=7]  *movdi_internal/3
+	movzbl	10(%r15), %eax	# 7138	[c=13 l=5]  zero_extendqidi2/0
+	movzbl	(%rdx,%rax), %eax	# 7140	[c=13 l=4]  zero_extendqidi2/0
+	movzbl	100(%rbx), %edx	# 7141	[c=9 l=4]  *movqi_internal/4
+	movl	%edx, %ecx	# 13370	[c=4 l=2]  *movsi_internal/0
+	andl	$225, %ecx	# 7144	[c=4 l=6]  *andsi_2/0
+	jne	.L1073	# 7145	[c=13 l=6]  *jcc
+	leaq	flag_update_table_logical(%rip), %rdx	# 7148	[c=1 l=7]  *movdi_internal/4
+	addq	%rdx, %rax	# 7149	[c=4 l=3]  *adddi_1/0
+	movl	$30, %edx	# 36	[c=4 l=5]  *movqi_internal/3
+.L1074:
+	movl	(%rbx), %r15d	# 7169	[c=6 l=3]  *zero_extendsidi2/3
+	movb	%dl, 100(%rbx)	# 7168	[c=4 l=3]  *movqi_internal/8
+	movq	%r10, %rcx	# 15900	[c=4 l=3]  *movdi_internal/3
+	movq	%rax, 104(%rbx)	# 7167	[c=4 l=4]  *movdi_internal/5
+	movq	%r15, %rdx	# 15453	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 7171	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 7173	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%r15), %eax	# 7174	[c=13 l=5]  *zero_extendqisi2/0
+	movq	(%r15), %r14	# 7177	[c=5 l=3]  *movdi_internal/3
+	addl	%edx, %eax	# 7175	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 15901	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 7176	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 15902	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 15903	[c=4 l=3]  *indirect_jump
+.L1075:
+	jmp	.L1417	# 17071	[c=1 l=5]  jump
+.L1076:
+	jmp	.L1417	# 17073	[c=1 l=5]  jump
+.L1048:
+	movq	1040(%rbx), %rcx	# 6746	[c=9 l=7]  *movdi_internal/3
+	movzbl	10(%r15), %edx	# 6749	[c=13 l=5]  zero_extendqidi2/0
+	movzwl	30(%rcx), %eax	# 6747	[c=13 l=4]  *zero_extendhisi2/0
+	movzbl	(%rcx,%rdx), %esi	# 6750	[c=9 l=4]  *movqi_internal/4
+	subl	$1, %eax	# 6748	[c=4 l=3]  *addsi_1/0
+	movl	%eax, %edx	# 13326	[c=4 l=2]  *movsi_internal/0
+	subl	5176(%rbx), %edx	# 6751	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %edx	# 6752	[c=13 l=6]  *cmpsi_1/1
+	jb	.L1049	# 6753	[c=13 l=2]  *jcc
+	movl	%eax, %edx	# 13328	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %edx	# 6755	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %edx	# 12697	[c=5 l=6]  *andsi_1_zext
+	cmpb	$0, 1080(%rbx,%rdx)	# 6758	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L1050	# 6759	[c=13 l=6]  *jcc
+.L1049:
+	movslq	%eax, %rdx	# 6762	[c=4 l=3]  *extendsidi2_rex64/1
+	movb	%sil, (%rcx,%rdx)	# 6763	[c=4 l=4]  *movqi_internal/8
+.L1051:
+	movq	1040(%rbx), %rdx	# 6775	[c=9 l=7]  *movdi_internal/3
+	movq	%r10, %rcx	# 15972	[c=4 l=3]  *movdi_internal/3
+	movb	%al, 30(%rdx)	# 6776	[c=4 l=3]  *movqi_internal/8
+	movq	1040(%rbx), %rdx	# 6777	[c=9 l=7]  *movdi_internal/3
+	movb	%ah, 31(%rdx)	# 16791	[c=4 l=3]  *extzvqi_mem_rex64
+	movl	(%rbx), %r15d	# 6780	[c=6 l=3]  *zero_extendsidi2/3
+	movq	%r15, %rdx	# 15439	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 6782	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 6784	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%r15), %eax	# 6785	[c=13 l=5]  *zero_extendqisi2/0
+	movq	(%r15), %r14	# 6788	[c=5 l=3]  *movdi_internal/3
+	addl	%edx, %eax	# 6786	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 15973	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 6787	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 15974	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 15975	[c=4 l=3]  *indirect_jump
+.L1272:
+	movl	5176(%rbx), %edx	# 11034	[c=9 l=6]  *movsi_internal/0
+	movq	10976(%rbx), %rcx	# 11032	[c=9 l=7]  *movdi_internal/3
+	movl	$93, %eax	# 11036	[c=4 l=5]  *movsi_internal/0
+	movl	5180(%rbx), %r13d	# 11035	[c=9 l=7]  *movsi_internal/0
+	subl	%edx, %eax	# 11037	[c=4 l=2]  *subsi_1/0
+	movq	16(%rcx), %r14	# 11033	[c=9 l=4]  *movdi_internal/3
+	cmpl	%r13d, %eax	# 11038	[c=4 l=3]  *cmpsi_1/0
+	jb	.L1273	# 11039	[c=13 l=6]  *jcc
+	cmpb	$1, 1082(%rbx)	# 11043	[c=13 l=7]  *cmpqi_1/0
+	ja	.L1598	# 11044	[c=13 l=6]  *jcc
+	movq	1040(%rbx), %rax	# 11276	[c=9 l=7]  *movdi_internal/3
+	movzbl	93(%rax), %r8d	# 11277	[c=13 l=5]  *zero_extendqisi2/0
+.L1275:
+	movzbl	94(%rax), %eax	# 11081	[c=13 l=4]  *zero_extendqisi2/0
+.L1277:
+	sall	$8, %eax	# 11084	[c=4 l=3]  *ashlsi3_1/0
+	orl	%r8d, %eax	# 11085	[c=4 l=3]  *iorsi_1/0
+	cmpl	%eax, 24(%rcx)	# 11086	[c=13 l=3]  *cmpsi_1/0
+	je	.L1599	# 11087	[c=13 l=6]  *jcc
+.L575:
+	movq	%r10, %rcx	# 11804	[c=4 l=3]  *movdi_internal/3
+	movq	%r12, %rdx	# 11805	[c=4 l=3]  *movdi_internal/3
+	movq	%r11, %rax	# 11806	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 327	[c=4 l=3]  *indirect_jump
+.L603:
+	movq	1040(%rbx), %rdx	# 726	[c=9 l=7]  *movdi_internal/3
+	movzbl	10(%r15), %eax	# 727	[c=13 l=5]  zero_extendqidi2/0
+	movzwl	12(%r15), %esi	# 730	[c=13 l=5]  zero_extendhidi2/0
+	addq	%rdx, %rax	# 728	[c=4 l=3]  *adddi_1/0
+	movzbl	(%rax), %ecx	# 729	[c=9 l=3]  *zero_extendqisi2/0
+	movzbl	(%rdx,%rsi), %edx	# 731	[c=13 l=4]  *zero_extendqisi2/0
+	leal	(%rdx,%rcx), %esi	# 15061	[c=4 l=3]  *leasi
+	movb	%sil, (%rax)	# 733	[c=4 l=3]  *movqi_internal/8
+	movl	%ecx, %esi	# 12861	[c=4 l=2]  *movsi_internal/0
+	movl	%edx, %eax	# 12863	[c=4 l=2]  *movsi_internal/0
+	addl	%ecx, %edx	# 744	[c=4 l=2]  *addsi_1/0
+	andl	$136, %esi	# 735	[c=4 l=6]  *andsi_1/0
+	andl	$136, %eax	# 738	[c=4 l=5]  *andsi_1/0
+	leal	(%rax,%rsi,2), %eax	# 739	[c=8 l=3]  *leasi
+	imull	$260, %eax, %eax	# 740	[c=12 l=6]  *mulsi3_1/1
+	andl	$7680, %eax	# 741	[c=4 l=5]  *andsi_1/0
+	orl	%edx, %eax	# 745	[c=5 l=2]  *iorsi_1_zext
+	movzbl	100(%rbx), %edx	# 746	[c=9 l=4]  *movqi_internal/4
+	movl	%edx, %ecx	# 12865	[c=4 l=2]  *movsi_internal/0
+	andl	$192, %ecx	# 749	[c=4 l=6]  *andsi_2/0
+	jne	.L604	# 750	[c=13 l=6]  *jcc
+	leaq	flag_update_table_add8(%rip), %rcx	# 753	[c=1 l=7]  *movdi_internal/4
+	movl	$63, %edx	# 7	[c=4 l=5]  *movqi_internal/3
+	addq	%rcx, %rax	# 754	[c=4 l=3]  *adddi_1/0
+.L605:
+	movl	(%rbx), %r15d	# 773	[c=6 l=3]  *zero_extendsidi2/3
+	movb	%dl, 100(%rbx)	# 772	[c=4 l=3]  *movqi_internal/8
+	movq	%r10, %rcx	# 16708	[c=4 l=3]  *movdi_internal/3
+	movq	%rax, 104(%rbx)	# 771	[c=4 l=4]  *movdi_internal/5
+	movq	%r15, %rdx	# 15311	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 775	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 777	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%r15), %eax	# 778	[c=13 l=5]  *zero_extendqisi2/0
+	movq	(%r15), %r14	# 781	[c=5 l=3]  *movdi_internal/3
+	addl	%edx, %eax	# 779	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 16709	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 780	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 16710	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 16711	[c=4 l=3]  *indirect_jump
+.L608:
+	movq	1040(%rbx), %rax	# 893	[c=9 l=7]  *movdi_internal/3
+	movzbl	10(%r15), %edx	# 894	[c=13 l=5]  zero_extendqidi2/0
+	movzwl	12(%r15), %ecx	# 896	[c=13 l=5]  zero_extendhidi2/0
+	addq	%rax, %rdx	# 895	[c=4 l=3]  *adddi_1/0
+	movzbl	(%rax,%rcx), %eax	# 897	[c=9 l=4]  *movqi_internal/4
+	andb	(%rdx), %al	# 898	[c=9 l=2]  *andqi_1/1
+	movb	%al, (%rdx)	# 899	[c=4 l=2]  *movqi_internal/8
+	movzbl	100(%rbx), %edx	# 900	[c=9 l=4]  *movqi_internal/4
+	movl	%edx, %ecx	# 12881	[c=4 l=2]  *movsi_internal/0
+	andl	$225, %ecx	# 903	[c=4 l=6]  *andsi_2/0
+	jne	.L609	# 904	[c=13 l=6]  *jcc
+	leaq	flag_update_table_logical(%rip), %rdx	# 907	[c=1 l=7]  *movdi_internal/4
+	movzbl	%al, %eax	# 906	[c=4 l=3]  zero_extendqidi2/0
+	addq	%rdx, %rax	# 908	[c=4 l=3]  *adddi_1/0
+	movl	$30, %edx	# 8	[c=4 l=5]  *movqi_internal/3
+.L610:
+	movl	(%rbx), %r15d	# 928	[c=6 l=3]  *zero_extendsidi2/3
+	movb	%dl, 100(%rbx)	# 927	[c=4 l=3]  *movqi_internal/8
+	movq	%r10, %rcx	# 16684	[c=4 l=3]  *movdi_internal/3
+	movq	%rax, 104(%rbx)	# 926	[c=4 l=4]  *movdi_internal/5
+	movq	%r15, %rdx	# 15314	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 930	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 932	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%r15), %eax	# 933	[c=13 l=5]  *zero_extendqisi2/0
+	movq	(%r15), %r14	# 936	[c=5 l=3]  *movdi_internal/3
+	addl	%edx, %eax	# 934	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 16685	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 935	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 16686	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 16687	[c=4 l=3]  *indirect_jump
+.L981:
+	movl	$2, 96(%rbx)	# 5892	[c=4 l=7]  *movsi_internal/1
+	movq	1040(%rbx), %rdx	# 5894	[c=9 l=7]  *movdi_internal/3
+	movzbl	10(%r15), %eax	# 5893	[c=13 l=5]  zero_extendqidi2/0
+	movzbl	(%rdx,%rax), %edx	# 5895	[c=13 l=4]  *zero_extendqisi2/0
+	movzwl	12(%r15), %eax	# 5896	[c=13 l=5]  *zero_extendhisi2/0
+	testl	%eax, %edx	# 5898	[c=4 l=2]  *testsi_1/0
+	jne	.L982	# 5899	[c=13 l=2]  *jcc
+	movl	(%rbx), %eax	# 13267	[c=5 l=2]  *movsi_internal/0
+	addq	$1, 48(%rbx)	# 5907	[c=13 l=5]  *adddi_1/0
+	addl	$1, %eax	# 5902	[c=4 l=3]  *addsi_1/0
+	andl	992(%rbx), %eax	# 5905	[c=13 l=6]  *andsi_1/1
+	movl	%eax, (%rbx)	# 5906	[c=4 l=2]  *movsi_internal/1
+.L982:
+	movq	(%rsp), %rax	# 13268	[c=5 l=4]  *movdi_internal/3
+	subq	$1, %rax	# 5910	[c=4 l=4]  *adddi_1/0
+	cmpq	%rbp, %rax	# 5911	[c=4 l=3]  *cmpdi_1/0
+	jb	.L620	# 5912	[c=13 l=6]  *jcc
+	movq	56(%rbx), %rax	# 13269	[c=9 l=4]  *movdi_internal/3
+	cmpq	%rax, 48(%rbx)	# 5915	[c=13 l=4]  *cmpdi_1/0
+	jnb	.L1600	# 5916	[c=13 l=6]  *jcc
+.L983:
+	movl	(%rbx), %r15d	# 5923	[c=6 l=3]  *zero_extendsidi2/3
+	movl	$1, 96(%rbx)	# 5928	[c=4 l=7]  *movsi_internal/1
+	movq	%r10, %rcx	# 16092	[c=4 l=3]  *movdi_internal/3
+	movq	%r15, %rdx	# 15418	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 5925	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 5927	[c=13 l=7]  *adddi_1/1
+	movzbl	11(%r15), %eax	# 5929	[c=13 l=5]  zero_extendqidi2/0
+	movq	(%r15), %r14	# 5937	[c=5 l=3]  *movdi_internal/3
+	addq	%rax, %rbp	# 5930	[c=4 l=3]  *adddi_1/0
+	movzwl	14(%r15), %eax	# 5932	[c=13 l=5]  zero_extendhidi2/0
+	addq	%rax, 48(%rbx)	# 5933	[c=13 l=4]  *adddi_1/0
+	movq	%rbp, 40(%rbx)	# 5931	[c=4 l=4]  *movdi_internal/5
+	movzbl	9(%r15), %eax	# 5934	[c=13 l=5]  *zero_extendqisi2/0
+	addl	%edx, %eax	# 5935	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 16093	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 5936	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 16094	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 16095	[c=4 l=3]  *indirect_jump
+.L984:
+	movl	$2, 96(%rbx)	# 5942	[c=4 l=7]  *movsi_internal/1
+	movq	1040(%rbx), %rdx	# 5944	[c=9 l=7]  *movdi_internal/3
+	movzbl	10(%r15), %eax	# 5943	[c=13 l=5]  zero_extendqidi2/0
+	movzbl	(%rdx,%rax), %edx	# 5945	[c=13 l=4]  *zero_extendqisi2/0
+	movzwl	12(%r15), %eax	# 5946	[c=13 l=5]  *zero_extendhisi2/0
+	testl	%eax, %edx	# 5948	[c=4 l=2]  *testsi_1/0
+	jne	.L985	# 5949	[c=13 l=2]  *jcc
+	movl	(%rbx), %eax	# 13270	[c=5 l=2]  *movsi_internal/0
+	addq	$2, 48(%rbx)	# 5957	[c=13 l=5]  *adddi_1/0
+	addl	$2, %eax	# 5952	[c=4 l=3]  *addsi_1/0
+	andl	992(%rbx), %eax	# 5955	[c=13 l=6]  *andsi_1/1
+	movl	%eax, (%rbx)	# 5956	[c=4 l=2]  *movsi_internal/1
+.L985:
+	movq	(%rsp), %rax	# 13271	[c=5 l=4]  *movdi_internal/3
+	subq	$1, %rax	# 5960	[c=4 l=4]  *adddi_1/0
+	cmpq	%rbp, %rax	# 5961	[c=4 l=3]  *cmpdi_1/0
+	jb	.L620	# 5962	[c=13 l=6]  *jcc
+	movq	56(%rbx), %rax	# 13272	[c=9 l=4]  *movdi_internal/3
+	cmpq	%rax, 48(%rbx)	# 5965	[c=13 l=4]  *cmpdi_1/0
+	jnb	.L1601	# 5966	[c=13 l=6]  *jcc
+.L986:
+	movl	(%rbx), %r15d	# 5973	[c=6 l=3]  *zero_extendsidi2/3
+	movl	$1, 96(%rbx)	# 5978	[c=4 l=7]  *movsi_internal/1
+	movq	%r10, %rcx	# 16084	[c=4 l=3]  *movdi_internal/3
+	movq	%r15, %rdx	# 15419	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 5975	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 5977	[c=13 l=7]  *adddi_1/1
+	movzbl	11(%r15), %eax	# 5979	[c=13 l=5]  zero_extendqidi2/0
+	movq	(%r15), %r14	# 5987	[c=5 l=3]  *movdi_internal/3
+	addq	%rax, %rbp	# 5980	[c=4 l=3]  *adddi_1/0
+	movzwl	14(%r15), %eax	# 5982	[c=13 l=5]  zero_extendhidi2/0
+	addq	%rax, 48(%rbx)	# 5983	[c=13 l=4]  *adddi_1/0
+	movq	%rbp, 40(%rbx)	# 5981	[c=4 l=4]  *movdi_internal/5
+	movzbl	9(%r15), %eax	# 5984	[c=13 l=5]  *zero_extendqisi2/0
+	addl	%edx, %eax	# 5985	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 16085	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 5986	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 16086	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 16087	[c=4 l=3]  *indirect_jump
+.L987:
+	movl	$2, 96(%rbx)	# 5992	[c=4 l=7]  *movsi_internal/1
+	movq	1040(%rbx), %rdx	# 5994	[c=9 l=7]  *movdi_internal/3
+	movzbl	10(%r15), %eax	# 5993	[c=13 l=5]  zero_extendqidi2/0
+	movzbl	(%rdx,%rax), %edx	# 5995	[c=13 l=4]  *zero_extendqisi2/0
+	movzwl	12(%r15), %eax	# 5996	[c=13 l=5]  *zero_extendhisi2/0
+	testl	%eax, %edx	# 5998	[c=4 l=2]  *testsi_1/0
+	je	.L988	# 5999	[c=13 l=2]  *jcc
+	movl	(%rbx), %eax	# 13273	[c=5 l=2]  *movsi_internal/0
+	addq	$1, 48(%rbx)	# 6007	[c=13 l=5]  *adddi_1/0
+	addl	$1, %eax	# 6002	[c=4 l=3]  *addsi_1/0
+	andl	992(%rbx), %eax	# 6005	[c=13 l=6]  *andsi_1/1
+	movl	%eax, (%rbx)	# 6006	[c=4 l=2]  *movsi_internal/1
+.L988:
+	movq	(%rsp), %rax	# 13274	[c=5 l=4]  *movdi_internal/3
+	subq	$1, %rax	# 6010	[c=4 l=4]  *adddi_1/0
+	cmpq	%rbp, %rax	# 6011	[c=4 l=3]  *cmpdi_1/0
+	jb	.L620	# 6012	[c=13 l=6]  *jcc
+	movq	56(%rbx), %rax	# 13275	[c=9 l=4]  *movdi_internal/3
+	cmpq	%rax, 48(%rbx)	# 6015	[c=13 l=4]  *cmpdi_1/0
+	jnb	.L1602	# 6016	[c=13 l=6]  *jcc
+.L989:
+	movl	(%rbx), %r15d	# 6023	[c=6 l=3]  *zero_extendsidi2/3
+	movl	$1, 96(%rbx)	# 6028	[c=4 l=7]  *movsi_internal/1
+	movq	%r10, %rcx	# 16076	[c=4 l=3]  *movdi_internal/3
+	movq	%r15, %rdx	# 15420	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 6025	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 6027	[c=13 l=7]  *adddi_1/1
+	movzbl	11(%r15), %eax	# 6029	[c=13 l=5]  zero_extendqidi2/0
+	movq	(%r15), %r14	# 6037	[c=5 l=3]  *movdi_internal/3
+	addq	%rax, %rbp	# 6030	[c=4 l=3]  *adddi_1/0
+	movzwl	14(%r15), %eax	# 6032	[c=13 l=5]  zero_extendhidi2/0
+	addq	%rax, 48(%rbx)	# 6033	[c=13 l=4]  *adddi_1/0
+	movq	%rbp, 40(%rbx)	# 6031	[c=4 l=4]  *movdi_internal/5
+	movzbl	9(%r15), %eax	# 6034	[c=13 l=5]  *zero_extendqisi2/0
+	addl	%edx, %eax	# 6035	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 16077	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 6036	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 16078	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 16079	[c=4 l=3]  *indirect_jump
+.L993:
+	movslq	892(%rbx), %rcx	# 6096	[c=13 l=7]  *extendsidi2_rex64/1
+	leaq	se.0(%rip), %rdx	# 6095	[c=1 l=7]  *movdi_internal/4
+	movq	1040(%rbx), %rsi	# 6093	[c=9 l=7]  *movdi_internal/3
+	movl	$2, 96(%rbx)	# 6092	[c=4 l=7]  *movsi_internal/1
+	movzwl	(%rdx,%rcx,4), %eax	# 6097	[c=14 l=4]  zero_extendhidi2/0
+	movzbl	(%rsi,%rax), %eax	# 6100	[c=9 l=4]  *movqi_internal/4
+	andb	2(%rdx,%rcx,4), %al	# 6101	[c=14 l=4]  *andqi_2_maybe_si/1
+	je	.L994	# 6103	[c=13 l=2]  *jcc
+	movzbl	100(%rbx), %ecx	# 6106	[c=13 l=4]  *zero_extendqisi2/0
+	movzbl	95(%rsi), %eax	# 6107	[c=13 l=4]  *zero_extendqisi2/0
+	movq	48(%rbx), %r13	# 6105	[c=9 l=4]  *movdi_internal/3
+	movl	%ecx, %edx	# 15422	[c=4 l=2]  *movsi_internal/0
+	notl	%ecx	# 6109	[c=4 l=2]  *one_cmplsi2_1/0
+	andl	%ecx, %eax	# 6110	[c=4 l=2]  *andsi_1/0
+	movq	104(%rbx), %rcx	# 6111	[c=9 l=4]  *movdi_internal/3
+	andb	(%rcx), %dl	# 6112	[c=9 l=2]  *andqi_1/1
+	orl	%edx, %eax	# 6114	[c=4 l=2]  *iorsi_1/0
+	testb	$-128, %al	# 14931	[c=4 l=2]  *testqi_1_maybe_si/1
+	je	.L996	# 6117	[c=13 l=6]  *jcc
+	movq	%rbx, %rdi	# 6128	[c=4 l=3]  *movdi_internal/3
+	call	events_sleep@PLT	# 6129	[c=10 l=5]  *call_value
+	testb	%al, %al	# 6132	[c=4 l=2]  *cmpqi_ccno_1/0
+	je	.L996	# 6133	[c=13 l=6]  *jcc
+	movq	64(%rbx), %rax	# 6136	[c=9 l=4]  *movdi_internal/3
+	addq	48(%rbx), %rax	# 6137	[c=13 l=4]  *adddi_1/1
+	leaq	flag_update_table_sub8(%rip), %r11	# 14368	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 14366	[c=1 l=7]  *movdi_internal/4
+	subq	%r13, %rax	# 6138	[c=4 l=3]  *subdi_1/0
+	movq	%rax, 64(%rbx)	# 6139	[c=4 l=4]  *movdi_internal/5
+.L994:
+	movq	(%rsp), %rax	# 13279	[c=5 l=4]  *movdi_internal/3
+	subq	$1, %rax	# 6142	[c=4 l=4]  *adddi_1/0
+	cmpq	%rbp, %rax	# 6143	[c=4 l=3]  *cmpdi_1/0
+	jb	.L620	# 6144	[c=13 l=6]  *jcc
+	movq	56(%rbx), %rax	# 13280	[c=9 l=4]  *movdi_internal/3
+	cmpq	%rax, 48(%rbx)	# 6147	[c=13 l=4]  *cmpdi_1/0
+	jnb	.L1603	# 6148	[c=13 l=6]  *jcc
+.L997:
+	movl	(%rbx), %r15d	# 6155	[c=6 l=3]  *zero_extendsidi2/3
+	movl	$1, 96(%rbx)	# 6160	[c=4 l=7]  *movsi_internal/1
+	movq	%r10, %rcx	# 16060	[c=4 l=3]  *movdi_internal/3
+	movq	%r15, %rdx	# 15423	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 6157	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 6159	[c=13 l=7]  *adddi_1/1
+	movzbl	11(%r15), %eax	# 6161	[c=13 l=5]  zero_extendqidi2/0
+	movq	(%r15), %r14	# 6169	[c=5 l=3]  *movdi_internal/3
+	addq	%rax, %rbp	# 6162	[c=4 l=3]  *adddi_1/0
+	movzwl	14(%r15), %eax	# 6164	[c=13 l=5]  zero_extendhidi2/0
+	addq	%rax, 48(%rbx)	# 6165	[c=13 l=4]  *adddi_1/0
+	movq	%rbp, 40(%rbx)	# 6163	[c=4 l=4]  *movdi_internal/5
+	movzbl	9(%r15), %eax	# 6166	[c=13 l=5]  *zero_extendqisi2/0
+	addl	%edx, %eax	# 6167	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 16061	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 6168	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 16062	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 16063	[c=4 l=3]  *indirect_jump
+.L990:
+	movl	$2, 96(%rbx)	# 6042	[c=4 l=7]  *movsi_internal/1
+	movq	1040(%rbx), %rdx	# 6044	[c=9 l=7]  *movdi_internal/3
+	movzbl	10(%r15), %eax	# 6043	[c=13 l=5]  zero_extendqidi2/0
+	movzbl	(%rdx,%rax), %edx	# 6045	[c=13 l=4]  *zero_extendqisi2/0
+	movzwl	12(%r15), %eax	# 6046	[c=13 l=5]  *zero_extendhisi2/0
+	testl	%eax, %edx	# 6048	[c=4 l=2]  *testsi_1/0
+	je	.L991	# 6049	[c=13 l=2]  *jcc
+	movl	(%rbx), %eax	# 13276	[c=5 l=2]  *movsi_internal/0
+	addq	$2, 48(%rbx)	# 6057	[c=13 l=5]  *adddi_1/0
+	addl	$2, %eax	# 6052	[c=4 l=3]  *addsi_1/0
+	andl	992(%rbx), %eax	# 6055	[c=13 l=6]  *andsi_1/1
+	movl	%eax, (%rbx)	# 6056	[c=4 l=2]  *movsi_internal/1
+.L991:
+	movq	(%rsp), %rax	# 13277	[c=5 l=4]  *movdi_internal/3
+	subq	$1, %rax	# 6060	[c=4 l=4]  *adddi_1/0
+	cmpq	%rbp, %rax	# 6061	[c=4 l=3]  *cmpdi_1/0
+	jb	.L620	# 6062	[c=13 l=6]  *jcc
+	movq	56(%rbx), %rax	# 13278	[c=9 l=4]  *movdi_internal/3
+	cmpq	%rax, 48(%rbx)	# 6065	[c=13 l=4]  *cmpdi_1/0
+	jnb	.L1604	# 6066	[c=13 l=6]  *jcc
+.L992:
+	movl	(%rbx), %r15d	# 6073	[c=6 l=3]  *zero_extendsidi2/3
+	movl	$1, 96(%rbx)	# 6078	[c=4 l=7]  *movsi_internal/1
+	movq	%r10, %rcx	# 16068	[c=4 l=3]  *movdi_internal/3
+	movq	%r15, %rdx	# 15421	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 6075	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 6077	[c=13 l=7]  *adddi_1/1
+	movzbl	11(%r15), %eax	# 6079	[c=13 l=5]  zero_extendqidi2/0
+	movq	(%r15), %r14	# 6087	[c=5 l=3]  *movdi_internal/3
+	addq	%rax, %rbp	# 6080	[c=4 l=3]  *adddi_1/0
+	movzwl	14(%r15), %eax	# 6082	[c=13 l=5]  zero_extendhidi2/0
+	addq	%rax, 48(%rbx)	# 6083	[c=13 l=4]  *adddi_1/0
+	movq	%rbp, 40(%rbx)	# 6081	[c=4 l=4]  *movdi_internal/5
+	movzbl	9(%r15), %eax	# 6084	[c=13 l=5]  *zero_extendqisi2/0
+	addl	%edx, %eax	# 6085	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 16069	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 6086	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 16070	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 16071	[c=4 l=3]  *indirect_jump
+.L998:
+	movq	1040(%rbx), %rax	# 6175	[c=9 l=7]  *movdi_internal/3
+	movl	$2, 96(%rbx)	# 6174	[c=4 l=7]  *movsi_internal/1
+	cmpl	$65536, 880(%rbx)	# 6179	[c=13 l=10]  *cmpsi_1/0
+	movzwl	30(%rax), %r8d	# 6176	[c=13 l=5]  *zero_extendhisi2/0
+	jbe	.L999	# 6180	[c=13 l=2]  *jcc
+	movl	$91, %edx	# 6182	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%rbx), %edx	# 6183	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %edx	# 6184	[c=13 l=6]  *cmpsi_1/1
+	jb	.L1000	# 6185	[c=13 l=2]  *jcc
+	cmpb	$0, 1082(%rbx)	# 6187	[c=13 l=7]  *cmpqi_ccno_1/1
+	jne	.L1001	# 6188	[c=13 l=6]  *jcc
+.L1000:
+	movzbl	91(%rax), %eax	# 6191	[c=13 l=4]  *zero_extendqisi2/0
+.L1002:
+	sall	$16, %eax	# 6202	[c=4 l=3]  *ashlsi3_1/0
+	orl	%eax, %r8d	# 6203	[c=4 l=3]  *iorsi_1/0
+.L999:
+	movl	6044(%rbx), %r14d	# 6206	[c=9 l=7]  *movsi_internal/0
+	movl	992(%rbx), %eax	# 6208	[c=9 l=6]  *movsi_internal/0
+	movq	%rbx, %rdi	# 6218	[c=4 l=3]  *movdi_internal/3
+	movl	%r8d, 16(%rsp)	# 14379	[c=4 l=5]  *movsi_internal/1
+	leal	1(%rax,%rax), %r13d	# 6210	[c=8 l=5]  *leasi
+	movl	%r14d, %eax	# 13281	[c=4 l=3]  *movsi_internal/0
+	negl	%eax	# 6211	[c=4 l=2]  *negsi_1
+	andl	%eax, %r13d	# 6212	[c=4 l=3]  *andsi_1/0
+	leaq	6052(%rbx), %rax	# 14930	[c=4 l=7]  *leadi
+	andl	%r8d, %r13d	# 6213	[c=4 l=3]  *andsi_1/0
+	movq	%rax, 24(%rsp)	# 13283	[c=4 l=5]  *movdi_internal/5
+	movl	%r13d, %r15d	# 6214	[c=1 l=3]  *zero_extendsidi2/3
+	addq	1056(%rbx), %r15	# 6216	[c=13 l=7]  *adddi_1/1
+	call	spm_operation	# 6219	[c=10 l=5]  *call_value
+	movl	16(%rsp), %r8d	# 14380	[c=9 l=5]  *movsi_internal/0
+	movl	%r14d, %edx	# 11480	[c=1 l=3]  *zero_extendsidi2/3
+	leaq	flag_update_table_add8(%rip), %r10	# 14382	[c=1 l=7]  *movdi_internal/4
+	cmpl	$3, %eax	# 6221	[c=4 l=3]  *cmpsi_1/0
+	leaq	flag_update_table_sub8(%rip), %r11	# 14384	[c=1 l=7]  *movdi_internal/4
+	je	.L1003	# 6222	[c=13 l=6]  *jcc
+	jg	.L1004	# 6227	[c=13 l=6]  *jcc
+	cmpl	$1, %eax	# 6229	[c=4 l=3]  *cmpsi_1/0
+	je	.L1005	# 6230	[c=13 l=6]  *jcc
+	cmpl	$2, %eax	# 6232	[c=4 l=3]  *cmpsi_1/0
+	jne	.L1007	# 6233	[c=13 l=2]  *jcc
+	movl	%r14d, %edx	# 6262	[c=1 l=3]  *zero_extendsidi2/3
+	movl	$255, %esi	# 6264	[c=4 l=5]  *movsi_internal/0
+	movq	%r15, %rdi	# 6265	[c=4 l=3]  *movdi_internal/3
+	call	memset@PLT	# 6266	[c=10 l=5]  *call_value
+	leal	(%r14,%r13), %edx	# 14928	[c=4 l=4]  *leasi
+	movl	%r13d, %esi	# 6269	[c=4 l=3]  *movsi_internal/0
+	movq	%rbx, %rdi	# 6270	[c=4 l=3]  *movdi_internal/3
+	call	flash_changed	# 6271	[c=0 l=5]  *call
+	leaq	flag_update_table_add8(%rip), %r10	# 14386	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_sub8(%rip), %r11	# 14388	[c=1 l=7]  *movdi_internal/4
+.L1007:
+	movq	(%rsp), %rax	# 13284	[c=5 l=4]  *movdi_internal/3
+	subq	$1, %rax	# 6311	[c=4 l=4]  *adddi_1/0
+	cmpq	%rbp, %rax	# 6312	[c=4 l=3]  *cmpdi_1/0
+	jb	.L620	# 6313	[c=13 l=6]  *jcc
+	movq	56(%rbx), %rax	# 13285	[c=9 l=4]  *movdi_internal/3
+	cmpq	%rax, 48(%rbx)	# 6316	[c=13 l=4]  *cmpdi_1/0
+	jnb	.L1605	# 6317	[c=13 l=6]  *jcc
+.L1011:
+	cmpl	$0, 120(%rbx)	# 6324	[c=13 l=4]  *cmpsi_ccno_1/1
+	jne	.L553	# 6325	[c=13 l=6]  *jcc
+	movl	(%rbx), %r15d	# 6327	[c=6 l=3]  *zero_extendsidi2/3
+	movl	$1, 96(%rbx)	# 6332	[c=4 l=7]  *movsi_internal/1
+	movq	%r10, %rcx	# 16052	[c=4 l=3]  *movdi_internal/3
+	movq	%r15, %rdx	# 15424	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 6329	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 6331	[c=13 l=7]  *adddi_1/1
+	movzbl	11(%r15), %eax	# 6333	[c=13 l=5]  zero_extendqidi2/0
+	movq	(%r15), %r14	# 6341	[c=5 l=3]  *movdi_internal/3
+	addq	%rax, %rbp	# 6334	[c=4 l=3]  *adddi_1/0
+	movzwl	14(%r15), %eax	# 6336	[c=13 l=5]  zero_extendhidi2/0
+	addq	%rax, 48(%rbx)	# 6337	[c=13 l=4]  *adddi_1/0
+	movq	%rbp, 40(%rbx)	# 6335	[c=4 l=4]  *movdi_internal/5
+	movzbl	9(%r15), %eax	# 6338	[c=13 l=5]  *zero_extendqisi2/0
+	addl	%edx, %eax	# 6339	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 16053	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 6340	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 16054	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 16055	[c=4 l=3]  *indirect_jump
+.L1012:
+	movq	1040(%rbx), %rdx	# 6346	[c=9 l=7]  *movdi_internal/3
+	movzbl	10(%r15), %eax	# 6347	[c=13 l=5]  zero_extendqidi2/0
+	movzwl	12(%r15), %esi	# 6349	[c=13 l=5]  *zero_extendhisi2/0
+	movzbl	(%rdx,%rax), %ecx	# 6348	[c=9 l=4]  *movqi_internal/4
+	movzwl	28(%rdx), %eax	# 6350	[c=13 l=4]  *zero_extendhisi2/0
+	addl	%eax, %esi	# 6351	[c=4 l=2]  *addsi_1/0
+	movl	%esi, %eax	# 13286	[c=4 l=2]  *movsi_internal/0
+	subl	5176(%rbx), %eax	# 6352	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %eax	# 6353	[c=13 l=6]  *cmpsi_1/1
+	jb	.L1013	# 6354	[c=13 l=2]  *jcc
+	movl	%esi, %eax	# 13288	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %eax	# 6356	[c=4 l=3]  *ashrsi3_1/0
+	cltq	# 6357	[c=4 l=2]  *extendsidi2_rex64/0
+	cmpb	$0, 1080(%rbx,%rax)	# 6358	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L1014	# 6359	[c=13 l=6]  *jcc
+.L1013:
+	movslq	%esi, %rsi	# 6362	[c=4 l=3]  *extendsidi2_rex64/1
+	movb	%cl, (%rdx,%rsi)	# 6363	[c=4 l=3]  *movqi_internal/8
+.L1015:
+	movl	(%rbx), %r15d	# 6375	[c=6 l=3]  *zero_extendsidi2/3
+	movq	%r10, %rcx	# 16044	[c=4 l=3]  *movdi_internal/3
+	movq	%r15, %rdx	# 15425	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 6377	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 6379	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%r15), %eax	# 6380	[c=13 l=5]  *zero_extendqisi2/0
+	movq	(%r15), %r14	# 6383	[c=5 l=3]  *movdi_internal/3
+	addl	%edx, %eax	# 6381	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 16045	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 6382	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 16046	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 16047	[c=4 l=3]  *indirect_jump
+.L1016:
+	movq	1040(%rbx), %rdx	# 6388	[c=9 l=7]  *movdi_internal/3
+	movzbl	10(%r15), %eax	# 6389	[c=13 l=5]  zero_extendqidi2/0
+	movzwl	12(%r15), %esi	# 6391	[c=13 l=5]  *zero_extendhisi2/0
+	movzbl	(%rdx,%rax), %ecx	# 6390	[c=9 l=4]  *movqi_internal/4
+	movzwl	30(%rdx), %eax	# 6392	[c=13 l=4]  *zero_extendhisi2/0
+	addl	%eax, %esi	# 6393	[c=4 l=2]  *addsi_1/0
+	movl	%esi, %eax	# 13290	[c=4 l=2]  *movsi_internal/0
+	subl	5176(%rbx), %eax	# 6394	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %eax	# 6395	[c=13 l=6]  *cmpsi_1/1
+	jb	.L1017	# 6396	[c=13 l=2]  *jcc
+	movl	%esi, %eax	# 13292	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %eax	# 6398	[c=4 l=3]  *ashrsi3_1/0
+	cltq	# 6399	[c=4 l=2]  *extendsidi2_rex64/0
+	cmpb	$0, 1080(%rbx,%rax)	# 6400	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L1018	# 6401	[c=13 l=6]  *jcc
+.L1017:
+	movslq	%esi, %rsi	# 6404	[c=4 l=3]  *extendsidi2_rex64/1
+	movb	%cl, (%rdx,%rsi)	# 6405	[c=4 l=3]  *movqi_internal/8
+.L1019:
+	movl	(%rbx), %r15d	# 6417	[c=6 l=3]  *zero_extendsidi2/3
+	movq	%r10, %rcx	# 16036	[c=4 l=3]  *movdi_internal/3
+	movq	%r15, %rdx	# 15426	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 6419	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 6421	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%r15), %eax	# 6422	[c=13 l=5]  *zero_extendqisi2/0
+	movq	(%r15), %r14	# 6425	[c=5 l=3]  *movdi_internal/3
+	addl	%edx, %eax	# 6423	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 16037	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 6424	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 16038	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 16039	[c=4 l=3]  *indirect_jump
+.L573:
+	movq	%r15, %rsi	# 13775	[c=4 l=3]  *movdi_internal/3
+	subq	1064(%rbx), %rsi	# 10494	[c=13 l=7]  *subdi_1/1
+	movq	%rbx, %rdi	# 10498	[c=4 l=3]  *movdi_internal/3
+	sarq	$4, %rsi	# 10495	[c=4 l=4]  *ashrdi3_1/0
+	call	hle_routine@PLT	# 10499	[c=10 l=5]  *call_value
+	movq	1040(%rbx), %rdx	# 10501	[c=9 l=7]  *movdi_internal/3
+	movzbl	100(%rbx), %ecx	# 10505	[c=13 l=4]  *zero_extendqisi2/0
+	movq	%rbx, %xmm0	# 13778	[c=4 l=5]  *movdi_internal/20
+	movq	%rax, %r13	# 10500	[c=4 l=3]  *movdi_internal/3
+	leaq	flag_update_table_add8(%rip), %r10	# 14573	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_sub8(%rip), %r11	# 14575	[c=1 l=7]  *movdi_internal/4
+	movq	%rdx, 128(%rsp)	# 10504	[c=4 l=8]  *movdi_internal/5
+	movq	%rdx, %xmm2	# 13780	[c=4 l=5]  *movdi_internal/20
+	movl	%ecx, %eax	# 15529	[c=4 l=2]  *movsi_internal/0
+	movzbl	95(%rdx), %edx	# 10506	[c=13 l=4]  *zero_extendqisi2/0
+	notl	%ecx	# 10508	[c=4 l=2]  *one_cmplsi2_1/0
+	punpcklqdq	%xmm2, %xmm0	# 10502	[c=4 l=4]  vec_concatv2di/4
+	andl	%ecx, %edx	# 10509	[c=4 l=2]  *andsi_1/0
+	movq	104(%rbx), %rcx	# 10510	[c=9 l=4]  *movdi_internal/3
+	movaps	%xmm0, 112(%rsp)	# 10503	[c=4 l=5]  movv2di_internal/3
+	andb	(%rcx), %al	# 10511	[c=9 l=2]  *andqi_1/1
+	xorl	%ecx, %ecx	# 16751	[c=4 l=2]  *movdi_xor
+	movl	$-1, 152(%rsp)	# 10519	[c=4 l=11]  *movsi_internal/1
+	movzbl	%al, %eax	# 10512	[c=4 l=3]  *zero_extendqisi2/0
+	movq	%rcx, 140(%rsp)	# 16752	[c=4 l=8]  *movdi_internal/5
+	orl	%edx, %eax	# 10513	[c=4 l=2]  *iorsi_1/0
+	movb	%al, 136(%rsp)	# 10514	[c=4 l=7]  *movqi_internal/8
+	movq	%r15, %rax	# 13781	[c=4 l=3]  *movdi_internal/3
+	subq	1064(%rbx), %rax	# 10516	[c=13 l=7]  *subdi_1/1
+	sarq	$4, %rax	# 10517	[c=4 l=4]  *ashrdi3_1/0
+	movl	%eax, 148(%rsp)	# 10518	[c=4 l=7]  *movsi_internal/1
+	movq	10976(%rbx), %rax	# 10520	[c=9 l=7]  *movdi_internal/3
+	testq	%rax, %rax	# 10521	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L1233	# 10522	[c=13 l=6]  *jcc
+	cmpq	$0, (%rax)	# 10524	[c=9 l=4]  *cmpdi_ccno_1/1
+	je	.L1233	# 10525	[c=13 l=6]  *jcc
+.L1234:
+	movq	40(%r13), %r14	# 10527	[c=9 l=4]  *movdi_internal/3
+	movq	%r10, %rcx	# 15844	[c=4 l=3]  *movdi_internal/3
+	movq	%r12, %rdx	# 15845	[c=4 l=3]  *movdi_internal/3
+	movq	%r11, %rax	# 15846	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 15847	[c=4 l=3]  *indirect_jump
+.L576:
+	movl	$2, 96(%rbx)	# 331	[c=4 l=7]  *movsi_internal/1
+	movl	(%rbx), %esi	# 332	[c=5 l=2]  *movsi_internal/0
+	movq	%rbx, %rdi	# 333	[c=4 l=3]  *movdi_internal/3
+	call	bad_PC	# 334	[c=0 l=5]  *call
+.L582:
+	movzbl	100(%rbx), %edx	# 422	[c=9 l=4]  *movqi_internal/4
+	movl	$2, 96(%rbx)	# 420	[c=4 l=7]  *movsi_internal/1
+	movzbl	10(%r15), %eax	# 421	[c=9 l=5]  *movqi_internal/4
+	testb	%dl, %dl	# 423	[c=4 l=2]  *cmpqi_ccno_1/0
+	je	.L583	# 424	[c=13 l=2]  *jcc
+	movq	1040(%rbx), %rsi	# 426	[c=9 l=7]  *movdi_internal/3
+	movzbl	%dl, %ecx	# 427	[c=4 l=3]  *zero_extendqisi2/0
+	notl	%ecx	# 428	[c=4 l=2]  *one_cmplsi2_1/0
+	movzbl	95(%rsi), %edi	# 429	[c=13 l=4]  *zero_extendqisi2/0
+	andl	%edi, %ecx	# 430	[c=4 l=2]  *andsi_1/0
+	movq	104(%rbx), %rdi	# 431	[c=9 l=4]  *movdi_internal/3
+	andb	(%rdi), %dl	# 432	[c=9 l=2]  *andqi_1/1
+	movzbl	%dl, %edx	# 433	[c=4 l=3]  *zero_extendqisi2/0
+	orl	%ecx, %edx	# 434	[c=4 l=2]  *iorsi_1/0
+	movb	%dl, 95(%rsi)	# 435	[c=4 l=3]  *movqi_internal/8
+	movb	$0, 100(%rbx)	# 436	[c=4 l=4]  *movqi_internal/8
+.L583:
+	subl	$26, %eax	# 15066	[c=4 l=3]  *addsi_1/0
+	cmpb	$5, %al	# 442	[c=4 l=2]  *cmpqi_1/0
+	ja	.L584	# 443	[c=13 l=6]  *jcc
+	leaq	.L586(%rip), %rdx	# 445	[c=1 l=7]  *movdi_internal/4
+	movzbl	%al, %eax	# 444	[c=4 l=3]  zero_extendqidi2/0
+	movslq	(%rdx,%rax,4), %rax	# 447	[c=14 l=4]  *extendsidi2_rex64/1
+	addq	%rdx, %rax	# 449	[c=4 l=3]  *adddi_1/0
+	jmp	*%rax	# 450	[c=4 l=2]  *tablejump_1
+	.section	.rodata
+	.align 4
+	.align 4
+.L586:
+	.long	.L591-.L586
+	.long	.L590-.L586
+	.long	.L589-.L586
+	.long	.L588-.L586
+	.long	.L587-.L586
+	.long	.L585-.L586
+	.text
+.L581:
+	movl	$2, 96(%rbx)	# 399	[c=4 l=7]  *movsi_internal/1
+	movzwl	12(%r15), %ecx	# 400	[c=13 l=5]  *zero_extendhisi2/0
+	movl	$1, %esi	# 413	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 414	[c=4 l=3]  *movdi_internal/3
+	movzbl	10(%r15), %eax	# 405	[c=13 l=5]  zero_extendqidi2/0
+	leaq	opcodes(%rip), %rdx	# 12726	[c=1 l=7]  *movdi_internal/4
+	movl	%ecx, %r9d	# 12849	[c=4 l=3]  *movsi_internal/0
+	salq	$4, %rax	# 406	[c=4 l=4]  *ashldi3_1/0
+	sarl	$4, %r9d	# 401	[c=4 l=4]  *ashrsi3_1/0
+	movq	(%rdx,%rax), %r8	# 409	[c=9 l=4]  *movdi_internal/3
+	andl	$31, %r9d	# 408	[c=4 l=4]  *andsi_1/0
+	leaq	.LC47(%rip), %rdx	# 411	[c=1 l=7]  *movdi_internal/4
+	xorl	%eax, %eax	# 16936	[c=4 l=2]  *movdi_xor
+	call	leave	# 416	[c=0 l=5]  *call
+.L1032:
+	movq	1040(%rbx), %rcx	# 6556	[c=9 l=7]  *movdi_internal/3
+	movzbl	10(%r15), %edx	# 6559	[c=13 l=5]  zero_extendqidi2/0
+	movzwl	26(%rcx), %eax	# 6557	[c=13 l=4]  *zero_extendhisi2/0
+	movzbl	(%rcx,%rdx), %esi	# 6560	[c=9 l=4]  *movqi_internal/4
+	subl	$1, %eax	# 6558	[c=4 l=3]  *addsi_1/0
+	movl	%eax, %edx	# 13306	[c=4 l=2]  *movsi_internal/0
+	subl	5176(%rbx), %edx	# 6561	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %edx	# 6562	[c=13 l=6]  *cmpsi_1/1
+	jb	.L1033	# 6563	[c=13 l=2]  *jcc
+	movl	%eax, %edx	# 13308	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %edx	# 6565	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %edx	# 12699	[c=5 l=6]  *andsi_1_zext
+	cmpb	$0, 1080(%rbx,%rdx)	# 6568	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L1034	# 6569	[c=13 l=6]  *jcc
+.L1033:
+	movslq	%eax, %rdx	# 6572	[c=4 l=3]  *extendsidi2_rex64/1
+	movb	%sil, (%rcx,%rdx)	# 6573	[c=4 l=4]  *movqi_internal/8
+.L1035:
+	movq	1040(%rbx), %rdx	# 6585	[c=9 l=7]  *movdi_internal/3
+	movq	%r10, %rcx	# 16004	[c=4 l=3]  *movdi_internal/3
+	movb	%al, 26(%rdx)	# 6586	[c=4 l=3]  *movqi_internal/8
+	movq	1040(%rbx), %rdx	# 6587	[c=9 l=7]  *movdi_internal/3
+	movb	%ah, 27(%rdx)	# 16795	[c=4 l=3]  *extzvqi_mem_rex64
+	movl	(%rbx), %r15d	# 6590	[c=6 l=3]  *zero_extendsidi2/3
+	movq	%r15, %rdx	# 15433	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 6592	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 6594	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%r15), %eax	# 6595	[c=13 l=5]  *zero_extendqisi2/0
+	movq	(%r15), %r14	# 6598	[c=5 l=3]  *movdi_internal/3
+	addl	%edx, %eax	# 6596	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 16005	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 6597	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 16006	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 16007	[c=4 l=3]  *indirect_jump
+.L1028:
+	movq	1040(%rbx), %rcx	# 6514	[c=9 l=7]  *movdi_internal/3
+	movzbl	10(%r15), %edx	# 6516	[c=13 l=5]  zero_extendqidi2/0
+	movzwl	26(%rcx), %esi	# 6515	[c=13 l=4]  zero_extendhidi2/0
+	movzbl	(%rcx,%rdx), %edi	# 6517	[c=9 l=4]  *movqi_internal/4
+	movq	%rsi, %rax	# 15431	[c=4 l=3]  *movdi_internal/3
+	movl	%esi, %edx	# 13302	[c=4 l=2]  *movsi_internal/0
+	subl	5176(%rbx), %edx	# 6519	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %edx	# 6520	[c=13 l=6]  *cmpsi_1/1
+	jb	.L1029	# 6521	[c=13 l=2]  *jcc
+	movl	%esi, %edx	# 13304	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %edx	# 6524	[c=4 l=3]  *ashrsi3_1/0
+	movslq	%edx, %rdx	# 6525	[c=4 l=3]  *extendsidi2_rex64/1
+	cmpb	$0, 1080(%rbx,%rdx)	# 6526	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L1030	# 6527	[c=13 l=6]  *jcc
+.L1029:
+	movb	%dil, (%rcx,%rax)	# 6531	[c=4 l=4]  *movqi_internal/8
+.L1031:
+	movl	(%rbx), %r15d	# 6543	[c=6 l=3]  *zero_extendsidi2/3
+	movq	%r10, %rcx	# 16012	[c=4 l=3]  *movdi_internal/3
+	movq	%r15, %rdx	# 15432	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 6545	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 6547	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%r15), %eax	# 6548	[c=13 l=5]  *zero_extendqisi2/0
+	movq	(%r15), %r14	# 6551	[c=5 l=3]  *movdi_internal/3
+	addl	%edx, %eax	# 6549	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 16013	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 6550	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 16014	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 16015	[c=4 l=3]  *indirect_jump
+.L1178:
+	movq	1040(%rbx), %rax	# 9621	[c=9 l=7]  *movdi_internal/3
+	movzbl	10(%r15), %r14d	# 9620	[c=9 l=5]  *movqi_internal/4
+	movzwl	28(%rax), %r13d	# 9622	[c=13 l=5]  zero_extendhidi2/0
+	movl	%r13d, %edx	# 13684	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rcx	# 15514	[c=4 l=3]  *movdi_internal/3
+	subl	5176(%rbx), %edx	# 9625	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %edx	# 9626	[c=13 l=6]  *cmpsi_1/1
+	jb	.L1179	# 9627	[c=13 l=2]  *jcc
+	movl	%r13d, %edx	# 13686	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %edx	# 9629	[c=4 l=3]  *ashrsi3_1/0
+	movslq	%edx, %rdx	# 9630	[c=4 l=3]  *extendsidi2_rex64/1
+	cmpb	$0, 1080(%rbx,%rdx)	# 9631	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L1180	# 9632	[c=13 l=6]  *jcc
+.L1179:
+	movzbl	(%rax,%rcx), %ecx	# 9636	[c=13 l=4]  *zero_extendqisi2/0
+.L1181:
+	movzbl	%r14b, %edx	# 9647	[c=4 l=4]  zero_extendqidi2/0
+	movb	%cl, (%rax,%rdx)	# 9649	[c=4 l=3]  *movqi_internal/8
+	movq	1040(%rbx), %rdx	# 9651	[c=9 l=7]  *movdi_internal/3
+	leal	1(%r13), %eax	# 14772	[c=4 l=4]  *leasi
+	movb	%al, 28(%rdx)	# 9652	[c=4 l=3]  *movqi_internal/8
+	movq	1040(%rbx), %rdx	# 9653	[c=9 l=7]  *movdi_internal/3
+	movb	%ah, 29(%rdx)	# 16772	[c=4 l=3]  *extzvqi_mem_rex64
+	jmp	.L1407	# 17083	[c=1 l=5]  jump
+.L1186:
+	movq	1040(%rbx), %rcx	# 9714	[c=9 l=7]  *movdi_internal/3
+	movl	992(%rbx), %edx	# 9716	[c=9 l=6]  *movsi_internal/0
+	movq	1056(%rbx), %rsi	# 9721	[c=9 l=7]  *movdi_internal/3
+	movzwl	30(%rcx), %eax	# 9715	[c=13 l=4]  *zero_extendhisi2/0
+	leal	1(%rdx,%rdx), %edx	# 9718	[c=8 l=4]  *leasi
+	andl	%eax, %edx	# 9719	[c=4 l=2]  *andsi_1/0
+	addl	$1, %eax	# 9725	[c=4 l=3]  *addsi_1/0
+	movslq	%edx, %rdx	# 9720	[c=4 l=3]  *extendsidi2_rex64/1
+	movzwl	%ax, %eax	# 9726	[c=4 l=3]  *zero_extendhisi2/0
+	movzbl	(%rsi,%rdx), %esi	# 9722	[c=9 l=4]  *movqi_internal/4
+	movzbl	10(%r15), %edx	# 9723	[c=13 l=5]  zero_extendqidi2/0
+	movb	%sil, (%rcx,%rdx)	# 9724	[c=4 l=4]  *movqi_internal/8
+	jmp	.L1405	# 17085	[c=1 l=5]  jump
+.L1194:
+	movq	1040(%rbx), %rcx	# 9818	[c=9 l=7]  *movdi_internal/3
+	movl	992(%rbx), %edx	# 9820	[c=9 l=6]  *movsi_internal/0
+	movq	1056(%rbx), %rsi	# 9825	[c=9 l=7]  *movdi_internal/3
+	movzwl	30(%rcx), %eax	# 9819	[c=13 l=4]  *zero_extendhisi2/0
+	leal	1(%rdx,%rdx), %edx	# 9822	[c=8 l=4]  *leasi
+	andl	%eax, %edx	# 9823	[c=4 l=2]  *andsi_1/0
+	addl	$1, %eax	# 9829	[c=4 l=3]  *addsi_1/0
+	movslq	%edx, %rdx	# 9824	[c=4 l=3]  *extendsidi2_rex64/1
+	movzwl	%ax, %eax	# 9830	[c=4 l=3]  *zero_extendhisi2/0
+	movzbl	(%rsi,%rdx), %esi	# 9826	[c=9 l=4]  *movqi_internal/4
+	movzbl	10(%r15), %edx	# 9827	[c=13 l=5]  zero_extendqidi2/0
+	movb	%sil, (%rcx,%rdx)	# 9828	[c=4 l=4]  *movqi_internal/8
+	movq	1040(%rbx), %rdx	# 9831	[c=9 l=7]  *movdi_internal/3
+	movb	%al, 30(%rdx)	# 9832	[c=4 l=3]  *movqi_internal/8
+	movq	1040(%rbx), %rdx	# 9833	[c=9 l=7]  *movdi_internal/3
+	movb	%ah, 31(%rdx)	# 16768	[c=4 l=3]  *extzvqi_mem_rex64
+	movl	(%rbx), %edx	# 9836	[c=6 l=2]  *zero_extendsidi2/3
+	movq	1040(%rbx), %rsi	# 9843	[c=9 l=7]  *movdi_internal/3
+	movq	%rdx, %rax	# 15520	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 9838	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %rdx	# 9840	[c=13 l=7]  *adddi_1/1
+	addl	$1, %eax	# 9841	[c=4 l=3]  *addsi_1/0
+	movl	%eax, (%rbx)	# 9842	[c=4 l=2]  *movsi_internal/1
+	movzwl	26(%rsi), %r13d	# 9844	[c=13 l=5]  *zero_extendhisi2/0
+	movzbl	10(%rdx), %eax	# 9846	[c=13 l=4]  zero_extendqidi2/0
+	movl	%r13d, %ecx	# 15521	[c=4 l=3]  *movsi_internal/0
+	movzbl	(%rsi,%rax), %edi	# 9847	[c=9 l=4]  *movqi_internal/4
+	movl	%r13d, %eax	# 13697	[c=4 l=3]  *movsi_internal/0
+	subl	5176(%rbx), %eax	# 9849	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %eax	# 9850	[c=13 l=6]  *cmpsi_1/1
+	jb	.L1195	# 9851	[c=13 l=2]  *jcc
+	movl	%r13d, %eax	# 13699	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %eax	# 9853	[c=4 l=3]  *ashrsi3_1/0
+	cltq	# 9854	[c=4 l=2]  *extendsidi2_rex64/0
+	cmpb	$0, 1080(%rbx,%rax)	# 9855	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L1208	# 9856	[c=13 l=6]  *jcc
+.L1195:
+	movzwl	%cx, %edx	# 9859	[c=4 l=3]  zero_extendhidi2/0
+	movb	%dil, (%rsi,%rdx)	# 9860	[c=4 l=4]  *movqi_internal/8
+.L1209:
+	movq	1040(%rbx), %rdx	# 10039	[c=9 l=7]  *movdi_internal/3
+	leal	1(%r13), %eax	# 14764	[c=4 l=4]  *leasi
+	movb	%al, 26(%rdx)	# 10040	[c=4 l=3]  *movqi_internal/8
+	movq	1040(%rbx), %rdx	# 10041	[c=9 l=7]  *movdi_internal/3
+	movb	%ah, 27(%rdx)	# 16766	[c=4 l=3]  *extzvqi_mem_rex64
+	movl	(%rbx), %eax	# 10045	[c=6 l=2]  *zero_extendsidi2/3
+	movq	1064(%rbx), %r15	# 10044	[c=9 l=7]  *movdi_internal/3
+	movq	1040(%rbx), %rdx	# 10053	[c=9 l=7]  *movdi_internal/3
+	movq	%rax, %rsi	# 15525	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rax	# 10047	[c=4 l=4]  *ashldi3_1/0
+	addq	%r15, %rax	# 10048	[c=4 l=3]  *adddi_1/0
+	leal	1(%rsi), %ecx	# 14765	[c=5 l=3]  *leadi
+	movzwl	12(%rax), %edi	# 10051	[c=9 l=4]  *movhi_internal/2
+	movl	%ecx, (%rbx)	# 10050	[c=4 l=2]  *movsi_internal/1
+	movzbl	10(%rax), %eax	# 10052	[c=13 l=4]  zero_extendqidi2/0
+	movzbl	(%rdx,%rax), %eax	# 10054	[c=13 l=4]  *zero_extendqisi2/0
+	movl	%edi, %edx	# 13720	[c=4 l=2]  *movsi_internal/0
+	andl	$136, %edx	# 10059	[c=4 l=6]  *andsi_1/0
+	movl	%eax, %r8d	# 13718	[c=4 l=3]  *movsi_internal/0
+	subl	%edi, %eax	# 10063	[c=4 l=2]  *subsi_1/0
+	movzbl	100(%rbx), %edi	# 10068	[c=9 l=4]  *movqi_internal/4
+	andl	$136, %r8d	# 10056	[c=4 l=7]  *andsi_1/0
+	andl	$511, %eax	# 10064	[c=4 l=5]  *andsi_1/0
+	leal	(%rdx,%r8,2), %edx	# 10060	[c=8 l=4]  *leasi
+	imull	$260, %edx, %edx	# 10065	[c=12 l=6]  *mulsi3_1/1
+	andl	$7680, %edx	# 10066	[c=4 l=6]  *andsi_1/0
+	orl	%eax, %edx	# 10067	[c=5 l=2]  *iorsi_1_zext
+	movl	%edi, %eax	# 13722	[c=4 l=2]  *movsi_internal/0
+	andl	$192, %eax	# 10071	[c=4 l=5]  *andsi_2/0
+	jne	.L1210	# 10072	[c=13 l=6]  *jcc
+	leaq	flag_update_table_sub8(%rip), %rax	# 10075	[c=1 l=7]  *movdi_internal/4
+	movl	$63, %edi	# 61	[c=4 l=5]  *movqi_internal/3
+	leaq	(%rax,%rdx), %r8	# 14763	[c=4 l=4]  *leadi
+	leaq	101(%rbx), %rdx	# 11497	[c=4 l=4]  *leadi
+.L1211:
+	salq	$4, %rcx	# 10096	[c=4 l=4]  *ashldi3_1/0
+	addl	$2, %esi	# 10098	[c=4 l=3]  *addsi_1/0
+	movq	%r8, 104(%rbx)	# 10093	[c=4 l=4]  *movdi_internal/5
+	movb	%dil, 100(%rbx)	# 10094	[c=4 l=4]  *movqi_internal/8
+	addq	%rcx, %r15	# 10097	[c=4 l=3]  *adddi_1/0
+	movl	%esi, (%rbx)	# 10099	[c=4 l=2]  *movsi_internal/1
+	jmp	.L666	# 17087	[c=1 l=5]  jump
+.L1187:
+	movq	1040(%rbx), %rax	# 9744	[c=9 l=7]  *movdi_internal/3
+	movl	$91, %edx	# 9746	[c=4 l=5]  *movsi_internal/0
+	movzbl	10(%r15), %r13d	# 9743	[c=13 l=5]  zero_extendqidi2/0
+	subl	5176(%rbx), %edx	# 9747	[c=13 l=6]  *subsi_1/1
+	movzwl	30(%rax), %r14d	# 9745	[c=13 l=5]  *zero_extendhisi2/0
+	cmpl	5180(%rbx), %edx	# 9748	[c=13 l=6]  *cmpsi_1/1
+	jb	.L1188	# 9749	[c=13 l=2]  *jcc
+	cmpb	$0, 1082(%rbx)	# 9751	[c=13 l=7]  *cmpqi_ccno_1/1
+	jne	.L1189	# 9752	[c=13 l=6]  *jcc
+.L1188:
+	movzbl	91(%rax), %edx	# 9755	[c=13 l=4]  *zero_extendqisi2/0
+.L1190:
+	movl	992(%rbx), %ecx	# 9768	[c=9 l=6]  *movsi_internal/0
+	sall	$16, %edx	# 9766	[c=4 l=3]  *ashlsi3_1/0
+	movq	1056(%rbx), %rsi	# 9773	[c=9 l=7]  *movdi_internal/3
+	orl	%r14d, %edx	# 9767	[c=4 l=3]  *iorsi_1/0
+	leal	1(%rcx,%rcx), %ecx	# 9770	[c=8 l=4]  *leasi
+	andl	%edx, %ecx	# 9771	[c=4 l=2]  *andsi_1/0
+	addl	$1, %edx	# 9778	[c=4 l=3]  *addsi_1/0
+	movslq	%ecx, %rcx	# 9772	[c=4 l=3]  *extendsidi2_rex64/1
+	movzbl	(%rsi,%rcx), %ecx	# 9774	[c=9 l=4]  *movqi_internal/4
+	movb	%cl, (%rax,%r13)	# 9777	[c=4 l=4]  *movqi_internal/8
+	movq	1040(%rbx), %rcx	# 9780	[c=9 l=7]  *movdi_internal/3
+	movzwl	%dx, %eax	# 9779	[c=4 l=3]  *zero_extendhisi2/0
+	sarl	$16, %edx	# 9785	[c=4 l=3]  *ashrsi3_1/0
+	movb	%al, 30(%rcx)	# 9781	[c=4 l=3]  *movqi_internal/8
+	movq	1040(%rbx), %rcx	# 9782	[c=9 l=7]  *movdi_internal/3
+	movb	%ah, 31(%rcx)	# 16769	[c=4 l=3]  *extzvqi_mem_rex64
+	movl	$91, %eax	# 9786	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%rbx), %eax	# 9787	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %eax	# 9788	[c=13 l=6]  *cmpsi_1/1
+	jb	.L1191	# 9789	[c=13 l=2]  *jcc
+	cmpb	$0, 1082(%rbx)	# 9791	[c=13 l=7]  *cmpqi_ccno_1/1
+	jne	.L1192	# 9792	[c=13 l=6]  *jcc
+.L1191:
+	movq	1040(%rbx), %rax	# 9795	[c=9 l=7]  *movdi_internal/3
+	movb	%dl, 91(%rax)	# 9796	[c=4 l=3]  *movqi_internal/8
+	jmp	.L1406	# 17089	[c=1 l=5]  jump
+.L1200:
+	movq	1040(%rbx), %rax	# 9939	[c=9 l=7]  *movdi_internal/3
+	movl	$91, %edx	# 9941	[c=4 l=5]  *movsi_internal/0
+	movzbl	10(%r15), %r13d	# 9938	[c=13 l=5]  zero_extendqidi2/0
+	subl	5176(%rbx), %edx	# 9942	[c=13 l=6]  *subsi_1/1
+	movzwl	30(%rax), %r14d	# 9940	[c=13 l=5]  *zero_extendhisi2/0
+	cmpl	5180(%rbx), %edx	# 9943	[c=13 l=6]  *cmpsi_1/1
+	jb	.L1201	# 9944	[c=13 l=2]  *jcc
+	cmpb	$0, 1082(%rbx)	# 9946	[c=13 l=7]  *cmpqi_ccno_1/1
+	jne	.L1202	# 9947	[c=13 l=6]  *jcc
+.L1201:
+	movzbl	91(%rax), %edx	# 9950	[c=13 l=4]  *zero_extendqisi2/0
+.L1203:
+	movl	992(%rbx), %ecx	# 9963	[c=9 l=6]  *movsi_internal/0
+	sall	$16, %edx	# 9961	[c=4 l=3]  *ashlsi3_1/0
+	movq	1056(%rbx), %rsi	# 9968	[c=9 l=7]  *movdi_internal/3
+	orl	%r14d, %edx	# 9962	[c=4 l=3]  *iorsi_1/0
+	leal	1(%rcx,%rcx), %ecx	# 9965	[c=8 l=4]  *leasi
+	andl	%edx, %ecx	# 9966	[c=4 l=2]  *andsi_1/0
+	addl	$1, %edx	# 9973	[c=4 l=3]  *addsi_1/0
+	movslq	%ecx, %rcx	# 9967	[c=4 l=3]  *extendsidi2_rex64/1
+	movzbl	(%rsi,%rcx), %ecx	# 9969	[c=9 l=4]  *movqi_internal/4
+	movb	%cl, (%rax,%r13)	# 9972	[c=4 l=4]  *movqi_internal/8
+	movq	1040(%rbx), %rcx	# 9975	[c=9 l=7]  *movdi_internal/3
+	movzwl	%dx, %eax	# 9974	[c=4 l=3]  *zero_extendhisi2/0
+	sarl	$16, %edx	# 9980	[c=4 l=3]  *ashrsi3_1/0
+	movb	%al, 30(%rcx)	# 9976	[c=4 l=3]  *movqi_internal/8
+	movq	1040(%rbx), %rcx	# 9977	[c=9 l=7]  *movdi_internal/3
+	movb	%ah, 31(%rcx)	# 16767	[c=4 l=3]  *extzvqi_mem_rex64
+	movl	$91, %eax	# 9981	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%rbx), %eax	# 9982	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %eax	# 9983	[c=13 l=6]  *cmpsi_1/1
+	jb	.L1204	# 9984	[c=13 l=2]  *jcc
+	cmpb	$0, 1082(%rbx)	# 9986	[c=13 l=7]  *cmpqi_ccno_1/1
+	jne	.L1205	# 9987	[c=13 l=6]  *jcc
+.L1204:
+	movq	1040(%rbx), %rax	# 9990	[c=9 l=7]  *movdi_internal/3
+	movb	%dl, 91(%rax)	# 9991	[c=4 l=3]  *movqi_internal/8
+.L1206:
+	movl	(%rbx), %edx	# 10002	[c=6 l=2]  *zero_extendsidi2/3
+	movq	1040(%rbx), %rsi	# 10009	[c=9 l=7]  *movdi_internal/3
+	movq	%rdx, %rax	# 15523	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 10004	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %rdx	# 10006	[c=13 l=7]  *adddi_1/1
+	addl	$1, %eax	# 10007	[c=4 l=3]  *addsi_1/0
+	movl	%eax, (%rbx)	# 10008	[c=4 l=2]  *movsi_internal/1
+	movzwl	26(%rsi), %r13d	# 10010	[c=13 l=5]  *zero_extendhisi2/0
+	movzbl	10(%rdx), %edx	# 10012	[c=13 l=4]  zero_extendqidi2/0
+	movl	%r13d, %eax	# 15524	[c=4 l=3]  *movsi_internal/0
+	movzbl	(%rsi,%rdx), %edi	# 10013	[c=9 l=4]  *movqi_internal/4
+	movl	%r13d, %edx	# 13713	[c=4 l=3]  *movsi_internal/0
+	subl	5176(%rbx), %edx	# 10015	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %edx	# 10016	[c=13 l=6]  *cmpsi_1/1
+	jb	.L1207	# 10017	[c=13 l=2]  *jcc
+	movl	%r13d, %ecx	# 13715	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %ecx	# 10019	[c=4 l=3]  *ashrsi3_1/0
+	movslq	%ecx, %rcx	# 10020	[c=4 l=3]  *extendsidi2_rex64/1
+	cmpb	$0, 1080(%rbx,%rcx)	# 10021	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L1208	# 10022	[c=13 l=6]  *jcc
+.L1207:
+	movzwl	%ax, %edx	# 10025	[c=4 l=3]  zero_extendhidi2/0
+	movb	%dil, (%rsi,%rdx)	# 10026	[c=4 l=4]  *movqi_internal/8
+	jmp	.L1209	# 17091	[c=1 l=5]  jump
+.L1212:
+	movq	1040(%rbx), %rax	# 10104	[c=9 l=7]  *movdi_internal/3
+	movzbl	10(%r15), %ecx	# 10107	[c=13 l=5]  zero_extendqidi2/0
+	movzwl	26(%rax), %r13d	# 10105	[c=13 l=5]  zero_extendhidi2/0
+	movzbl	(%rax,%rcx), %esi	# 10108	[c=9 l=4]  *movqi_internal/4
+	movq	%r13, %rdx	# 15526	[c=4 l=3]  *movdi_internal/3
+	movl	%r13d, %ecx	# 13728	[c=4 l=3]  *movsi_internal/0
+	subl	5176(%rbx), %ecx	# 10110	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %ecx	# 10111	[c=13 l=6]  *cmpsi_1/1
+	jb	.L1213	# 10112	[c=13 l=2]  *jcc
+	movl	%r13d, %ecx	# 13730	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %ecx	# 10114	[c=4 l=3]  *ashrsi3_1/0
+	movslq	%ecx, %rcx	# 10115	[c=4 l=3]  *extendsidi2_rex64/1
+	cmpb	$0, 1080(%rbx,%rcx)	# 10116	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L1214	# 10117	[c=13 l=6]  *jcc
+.L1213:
+	movb	%sil, (%rax,%rdx)	# 10121	[c=4 l=4]  *movqi_internal/8
+.L1215:
+	movq	1040(%rbx), %rdx	# 10134	[c=9 l=7]  *movdi_internal/3
+	leal	1(%r13), %eax	# 14758	[c=4 l=4]  *leasi
+	movb	%al, 26(%rdx)	# 10135	[c=4 l=3]  *movqi_internal/8
+	movq	1040(%rbx), %rdx	# 10136	[c=9 l=7]  *movdi_internal/3
+	movb	%ah, 27(%rdx)	# 16765	[c=4 l=3]  *extzvqi_mem_rex64
+	movl	(%rbx), %eax	# 10140	[c=6 l=2]  *zero_extendsidi2/3
+	movq	1064(%rbx), %r15	# 10139	[c=9 l=7]  *movdi_internal/3
+	movq	1040(%rbx), %r14	# 10147	[c=9 l=7]  *movdi_internal/3
+	movq	%rax, %r9	# 15527	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rax	# 10142	[c=4 l=4]  *ashldi3_1/0
+	addq	%r15, %rax	# 10143	[c=4 l=3]  *adddi_1/0
+	leal	1(%r9), %esi	# 14759	[c=5 l=4]  *leadi
+	movzwl	12(%rax), %edx	# 10146	[c=9 l=4]  *movhi_internal/2
+	movl	%esi, (%rbx)	# 10145	[c=4 l=2]  *movsi_internal/1
+	movzbl	10(%rax), %eax	# 10148	[c=13 l=4]  zero_extendqidi2/0
+	movzbl	(%r14,%rax), %ecx	# 10149	[c=13 l=5]  *zero_extendqisi2/0
+	movl	%edx, %eax	# 13735	[c=4 l=2]  *movsi_internal/0
+	andl	$136, %eax	# 10154	[c=4 l=5]  *andsi_1/0
+	movl	%ecx, %edi	# 13733	[c=4 l=2]  *movsi_internal/0
+	subl	%edx, %ecx	# 10158	[c=4 l=2]  *subsi_1/0
+	leaq	101(%rbx), %rdx	# 14760	[c=4 l=4]  *leadi
+	andl	$136, %edi	# 10151	[c=4 l=6]  *andsi_1/0
+	andl	$511, %ecx	# 10159	[c=4 l=6]  *andsi_1/0
+	leal	(%rax,%rdi,2), %eax	# 10155	[c=8 l=3]  *leasi
+	movzbl	100(%rbx), %edi	# 10163	[c=9 l=4]  *movqi_internal/4
+	imull	$260, %eax, %eax	# 10160	[c=12 l=6]  *mulsi3_1/1
+	movl	%edi, %r8d	# 13737	[c=4 l=3]  *movsi_internal/0
+	andl	$7680, %eax	# 10161	[c=4 l=5]  *andsi_1/0
+	orl	%eax, %ecx	# 10162	[c=5 l=2]  *iorsi_1_zext
+	andl	$192, %r8d	# 10167	[c=4 l=7]  *andsi_2/0
+	jne	.L1216	# 10168	[c=13 l=6]  *jcc
+	leaq	flag_update_table_sub8(%rip), %rax	# 10171	[c=1 l=7]  *movdi_internal/4
+	movl	$63, %edi	# 63	[c=4 l=5]  *movqi_internal/3
+	addq	%rax, %rcx	# 10172	[c=4 l=3]  *adddi_1/0
+.L1217:
+	salq	$4, %rsi	# 10191	[c=4 l=4]  *ashldi3_1/0
+	movb	%dil, 100(%rbx)	# 10189	[c=4 l=4]  *movqi_internal/8
+	leaq	(%r15,%rsi), %r8	# 14751	[c=4 l=4]  *leadi
+	leal	2(%r9), %esi	# 14752	[c=4 l=4]  *leasi
+	movq	%rcx, 104(%rbx)	# 10188	[c=4 l=4]  *movdi_internal/5
+	addl	$3, %r9d	# 10238	[c=4 l=4]  *addsi_1/0
+	movl	%esi, (%rbx)	# 10194	[c=4 l=2]  *movsi_internal/1
+	movzbl	(%rcx), %ecx	# 10200	[c=5 l=3]  *movqi_internal/4
+	movl	%esi, 24(%rsp)	# 14547	[c=4 l=4]  *movsi_internal/1
+	movzbl	10(%r8), %esi	# 10195	[c=13 l=5]  zero_extendqidi2/0
+	movzwl	12(%r8), %r8d	# 10197	[c=13 l=5]  zero_extendhidi2/0
+	movb	%cl, 16(%rsp)	# 13741	[c=4 l=4]  *movqi_internal/8
+	movzbl	(%r14,%rsi), %esi	# 10196	[c=13 l=5]  *zero_extendqisi2/0
+	movzbl	(%r14,%r8), %r13d	# 10198	[c=13 l=5]  *zero_extendqisi2/0
+	movzbl	%dil, %r8d	# 10199	[c=4 l=4]  *zero_extendqisi2/0
+	movzbl	95(%r14), %r14d	# 10201	[c=13 l=5]  *zero_extendqisi2/0
+	movl	%r9d, (%rbx)	# 10239	[c=4 l=3]  *movsi_internal/1
+	movl	%r8d, %ecx	# 13742	[c=4 l=3]  *movsi_internal/0
+	andl	16(%rsp), %edi	# 14753	[c=13 l=4]  *andsi_1/1
+	andl	$-64, %r8d	# 10213	[c=4 l=4]  *andsi_1/0
+	movq	%rdx, 104(%rbx)	# 10234	[c=4 l=4]  *movdi_internal/5
+	notl	%ecx	# 10202	[c=4 l=2]  *one_cmplsi2_1/0
+	movzbl	%dil, %edi	# 10205	[c=4 l=4]  *zero_extendqisi2/0
+	andl	%r14d, %ecx	# 10203	[c=4 l=3]  *andsi_1/0
+	movl	%ecx, %r14d	# 13744	[c=4 l=3]  *movsi_internal/0
+	movl	%r13d, %ecx	# 13748	[c=4 l=3]  *movsi_internal/0
+	orl	%edi, %r14d	# 10206	[c=4 l=3]  *iorsi_1/0
+	movl	%esi, %edi	# 13746	[c=4 l=2]  *movsi_internal/0
+	andl	$136, %ecx	# 10211	[c=4 l=6]  *andsi_1/0
+	subl	%r13d, %esi	# 10218	[c=4 l=3]  *subsi_1/0
+	andl	$136, %edi	# 10208	[c=4 l=6]  *andsi_1/0
+	leal	(%rcx,%rdi,2), %ecx	# 10212	[c=8 l=3]  *leasi
+	movl	%r14d, %edi	# 13750	[c=4 l=3]  *movsi_internal/0
+	orl	$-3, %r14d	# 10227	[c=4 l=4]  *iorsi_1/0
+	imull	$260, %ecx, %ecx	# 10222	[c=12 l=6]  *mulsi3_1/1
+	andl	$1, %edi	# 10219	[c=4 l=3]  *andsi_1/0
+	subl	%edi, %esi	# 10220	[c=4 l=2]  *subsi_1/0
+	andl	$511, %esi	# 10221	[c=4 l=6]  *andsi_1/0
+	andl	$7680, %ecx	# 10223	[c=4 l=6]  *andsi_1/0
+	orl	%ecx, %esi	# 10224	[c=4 l=2]  *iorsi_1/0
+	movl	%esi, %ecx	# 10225	[c=1 l=2]  *zero_extendsidi2/3
+	andb	(%rax,%rcx), %r14b	# 10228	[c=13 l=4]  *andqi_1/1
+	movzbl	16(%rsp), %eax	# 13752	[c=9 l=5]  *movqi_internal/4
+	andl	%r8d, %eax	# 14754	[c=4 l=3]  *andsi_1/0
+	orl	$63, %r8d	# 14756	[c=4 l=4]  *iorsi_1/0
+	orl	%eax, %r14d	# 14755	[c=4 l=3]  *iorsi_1/0
+	movl	24(%rsp), %eax	# 10235	[c=10 l=4]  *zero_extendsidi2/3
+	movb	%r8b, 100(%rbx)	# 10233	[c=4 l=4]  *movqi_internal/8
+	movb	%r14b, 101(%rbx)	# 10231	[c=4 l=4]  *movqi_internal/8
+	salq	$4, %rax	# 10236	[c=4 l=4]  *ashldi3_1/0
+	addq	%rax, %r15	# 10237	[c=4 l=3]  *adddi_1/0
+	jmp	.L622	# 17093	[c=1 l=5]  jump
+.L565:
+	movq	10984(%rbx), %rdx	# 10247	[c=9 l=7]  *movdi_internal/3
+	movq	%r15, %rax	# 13755	[c=4 l=3]  *movdi_internal/3
+	subq	1064(%rbx), %rax	# 10244	[c=13 l=7]  *subdi_1/1
+	movq	%r10, %rcx	# 15884	[c=4 l=3]  *movdi_internal/3
+	sarq	$4, %rax	# 10245	[c=4 l=4]  *ashrdi3_1/0
+	leaq	handler.2(%rip), %r14	# 10250	[c=1 l=7]  *movdi_internal/4
+	addq	$1, (%rdx,%rax,8)	# 10249	[c=14 l=5]  *adddi_1/0
+	movzbl	8(%r15), %eax	# 10252	[c=13 l=5]  zero_extendqidi2/0
+	movq	%r12, %rdx	# 15885	[c=4 l=3]  *movdi_internal/3
+	movq	(%r14,%rax,8), %r14	# 10253	[c=10 l=4]  *movdi_internal/3
+	movq	%r11, %rax	# 15886	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 15887	[c=4 l=3]  *indirect_jump
+.L561:
+	leaq	92(%rsp), %rsi	# 14750	[c=4 l=5]  *leadi
+	movq	%r15, %rdi	# 10260	[c=4 l=3]  *movdi_internal/3
+	call	delay_loop	# 10261	[c=10 l=5]  *call_value
+	leaq	flag_update_table_add8(%rip), %r10	# 14550	[c=1 l=7]  *movdi_internal/4
+	movl	%eax, %esi	# 10262	[c=4 l=2]  *movsi_internal/0
+	subl	$1, %eax	# 10266	[c=4 l=3]  *addsi_2/0
+	js	.L1218	# 10267	[c=13 l=6]  *jcc
+	movslq	92(%rsp), %rdi	# 11498	[c=13 l=5]  *extendsidi2_rex64/1
+	cltq	# 10271	[c=4 l=2]  *extendsidi2_rex64/0
+	xorl	%ecx, %ecx	# 16764	[c=4 l=2]  *movdi_xor
+	addq	1040(%rbx), %rdi	# 10275	[c=13 l=7]  *adddi_1/1
+	.p2align 4,,10
+	.p2align 3
+.L1219:
+	movzbl	(%rdi,%rax), %edx	# 10276	[c=13 l=4]  zero_extendqidi2/0
+	salq	$8, %rcx	# 10273	[c=4 l=4]  *ashldi3_1/0
+	subq	$1, %rax	# 10278	[c=4 l=4]  *adddi_1/0
+	orq	%rdx, %rcx	# 10277	[c=4 l=3]  *iordi_1/0
+	testl	%eax, %eax	# 10282	[c=4 l=2]  *cmpsi_ccno_1/0
+	jns	.L1219	# 10283	[c=13 l=2]  *jcc
+	leaq	-1(%rcx), %rdi	# 14749	[c=4 l=4]  *leadi
+	testq	%rcx, %rcx	# 10285	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L1218	# 10286	[c=13 l=6]  *jcc
+.L1221:
+	movq	(%rsp), %rdx	# 14552	[c=5 l=4]  *movdi_internal/3
+	testq	%rdx, %rdx	# 10300	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L1222	# 10301	[c=13 l=2]  *jcc
+	xorl	%eax, %eax	# 16762	[c=4 l=2]  *movdi_xor
+	cmpq	%rdx, %rbp	# 10303	[c=4 l=3]  *cmpdi_1/0
+	jb	.L1606	# 10304	[c=13 l=6]  *jcc
+.L1223:
+	cmpq	%rax, %rdi	# 12694	[c=4 l=3]  *cmpdi_1/0
+	cmova	%rax, %rdi	# 12695	[c=8 l=4]  *movdicc_noc/1
+.L1222:
+	movq	56(%rbx), %rax	# 10317	[c=9 l=4]  *movdi_internal/3
+	movq	48(%rbx), %rdx	# 10316	[c=9 l=4]  *movdi_internal/3
+	cmpq	$-1, %rax	# 10318	[c=4 l=4]  *cmpdi_1/0
+	je	.L1224	# 10319	[c=13 l=2]  *jcc
+	leaq	1(%rdx), %r9	# 14744	[c=4 l=4]  *leadi
+	xorl	%r8d, %r8d	# 16760	[c=4 l=3]  *movdi_xor
+	cmpq	%rax, %r9	# 10322	[c=4 l=3]  *cmpdi_1/0
+	jb	.L1607	# 10323	[c=13 l=6]  *jcc
+.L1225:
+	cmpq	%r8, %rdi	# 12692	[c=4 l=3]  *cmpdi_1/0
+	cmova	%r8, %rdi	# 12693	[c=8 l=4]  *movdicc_noc/1
+.L1224:
+	subq	%rdi, %rcx	# 10337	[c=4 l=3]  *subdi_1/0
+	xorl	%eax, %eax	# 16758	[c=4 l=2]  *movdi_xor
+	movq	%rcx, %rdx	# 13763	[c=4 l=3]  *movdi_internal/3
+	testl	%esi, %esi	# 10340	[c=4 l=2]  *cmpsi_ccno_1/0
+	jle	.L1227	# 10341	[c=13 l=2]  *jcc
+	.p2align 4,,10
+	.p2align 3
+.L1226:
+	movl	92(%rsp), %r8d	# 16755	[c=9 l=5]  *movsi_internal/0
+	leal	0(,%rax,8), %ecx	# 14740	[c=12 l=7]  *leasi
+	movq	1040(%rbx), %r9	# 10363	[c=9 l=7]  *movdi_internal/3
+	movq	%rdx, %r14	# 13766	[c=4 l=3]  *movdi_internal/3
+	shrq	%cl, %r14	# 10365	[c=4 l=3]  *lshrdi3_1/0
+	addl	%eax, %r8d	# 16756	[c=4 l=3]  *addsi_1/0
+	addl	$1, %eax	# 10367	[c=4 l=3]  *addsi_1/0
+	movslq	%r8d, %r8	# 10362	[c=4 l=3]  *extendsidi2_rex64/1
+	movb	%r14b, (%r9,%r8)	# 10366	[c=4 l=4]  *movqi_internal/8
+	cmpl	%eax, %esi	# 10368	[c=4 l=2]  *cmpsi_1/0
+	jne	.L1226	# 10369	[c=13 l=2]  *jcc
+.L1227:
+	movzbl	11(%r15), %eax	# 10343	[c=13 l=5]  zero_extendqidi2/0
+	leaq	handler.2(%rip), %r14	# 10352	[c=1 l=7]  *movdi_internal/4
+	movq	%r10, %rcx	# 15876	[c=4 l=3]  *movdi_internal/3
+	movq	%r12, %rdx	# 15877	[c=4 l=3]  *movdi_internal/3
+	imulq	%rdi, %rax	# 10344	[c=16 l=4]  *muldi3_1/2
+	addq	%rax, %rbp	# 10345	[c=4 l=3]  *adddi_1/0
+	movzwl	14(%r15), %eax	# 10348	[c=13 l=5]  zero_extendhidi2/0
+	movq	%rbp, 40(%rbx)	# 10346	[c=4 l=4]  *movdi_internal/5
+	addq	$1, %rax	# 16757	[c=4 l=4]  *adddi_1/0
+	imulq	%rdi, %rax	# 10350	[c=16 l=4]  *muldi3_1/2
+	addq	%rax, 48(%rbx)	# 10351	[c=13 l=4]  *adddi_1/0
+	movzbl	8(%r15), %eax	# 10354	[c=13 l=5]  zero_extendqidi2/0
+	movq	(%r14,%rax,8), %r14	# 10355	[c=10 l=4]  *movdi_internal/3
+	movq	%r11, %rax	# 15878	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 15879	[c=4 l=3]  *indirect_jump
+.L563:
+	movq	%r15, %r13	# 13768	[c=4 l=3]  *movdi_internal/3
+	subq	1064(%rbx), %r13	# 10376	[c=13 l=7]  *subdi_1/1
+	movq	%rbx, %rdi	# 10381	[c=4 l=3]  *movdi_internal/3
+	sarq	$4, %r13	# 10377	[c=4 l=4]  *ashrdi3_1/0
+	movl	%r13d, %esi	# 10380	[c=4 l=3]  *movsi_internal/0
+	movl	%r13d, %r14d	# 10379	[c=4 l=3]  *movsi_internal/0
+	call	jit_hot@PLT	# 10382	[c=10 l=5]  *call_value
+	leaq	flag_update_table_add8(%rip), %r10	# 14554	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_sub8(%rip), %r11	# 14556	[c=1 l=7]  *movdi_internal/4
+	testb	%al, %al	# 10384	[c=4 l=2]  *cmpqi_ccno_1/0
+	jne	.L1228	# 10385	[c=13 l=6]  *jcc
+	movzbl	8(%r15), %eax	# 10389	[c=13 l=5]  zero_extendqidi2/0
+	leaq	handler.2(%rip), %r14	# 10387	[c=1 l=7]  *movdi_internal/4
+	movq	%r10, %rcx	# 15868	[c=4 l=3]  *movdi_internal/3
+	movq	%r12, %rdx	# 15869	[c=4 l=3]  *movdi_internal/3
+	movq	(%r14,%rax,8), %r14	# 10390	[c=10 l=4]  *movdi_internal/3
+	movq	%r11, %rax	# 15870	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 15871	[c=4 l=3]  *indirect_jump
+.L547:
+	movzbl	100(%rbx), %eax	# 10424	[c=9 l=4]  *movqi_internal/4
+	testb	%al, %al	# 10425	[c=4 l=2]  *cmpqi_ccno_1/0
+	je	.L1230	# 10426	[c=13 l=2]  *jcc
+	movq	1040(%rbx), %rsi	# 10428	[c=9 l=7]  *movdi_internal/3
+	movzbl	%al, %ecx	# 10430	[c=4 l=3]  *zero_extendqisi2/0
+	notl	%ecx	# 10431	[c=4 l=2]  *one_cmplsi2_1/0
+	movzbl	95(%rsi), %edx	# 10429	[c=13 l=4]  *zero_extendqisi2/0
+	andl	%ecx, %edx	# 10432	[c=4 l=2]  *andsi_1/0
+	movq	104(%rbx), %rcx	# 10433	[c=9 l=4]  *movdi_internal/3
+	andb	(%rcx), %al	# 10434	[c=9 l=2]  *andqi_1/1
+	movzbl	%al, %eax	# 10435	[c=4 l=3]  *zero_extendqisi2/0
+	orl	%edx, %eax	# 10436	[c=4 l=2]  *iorsi_1/0
+	movb	%al, 95(%rsi)	# 10437	[c=4 l=3]  *movqi_internal/8
+	movb	$0, 100(%rbx)	# 10438	[c=4 l=4]  *movqi_internal/8
+.L1230:
+	movq	10960(%rbx), %rax	# 10444	[c=9 l=7]  *movdi_internal/3
+	subq	1064(%rbx), %r15	# 10445	[c=13 l=7]  *subdi_1/1
+	leaq	8(%rbx), %rdx	# 14738	[c=4 l=4]  *leadi
+	movq	1040(%rbx), %rdi	# 10441	[c=9 l=7]  *movdi_internal/3
+	sarq	$4, %r15	# 10446	[c=4 l=4]  *ashrdi3_1/0
+	movq	8(%rax), %rax	# 10447	[c=9 l=4]  *movdi_internal/3
+	leaq	95(%rdi), %rsi	# 14739	[c=4 l=4]  *leadi
+	call	*(%rax,%r15,8)	# 10452	[c=19 l=4]  *call_value
+	movq	40(%rbx), %r13	# 10455	[c=9 l=4]  *movdi_internal/3
+	leaq	flag_update_table_add8(%rip), %r10	# 14565	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_sub8(%rip), %r11	# 14567	[c=1 l=7]  *movdi_internal/4
+	movl	%eax, (%rbx)	# 10454	[c=4 l=2]  *movsi_internal/1
+	movq	(%rsp), %rax	# 14563	[c=5 l=4]  *movdi_internal/3
+	testq	%rax, %rax	# 10458	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L1297	# 10459	[c=13 l=2]  *jcc
+	cmpq	%rax, %r13	# 10462	[c=4 l=3]  *cmpdi_1/0
+	jnb	.L620	# 10463	[c=13 l=6]  *jcc
+.L1297:
+	movq	56(%rbx), %rax	# 13774	[c=9 l=4]  *movdi_internal/3
+	cmpq	%rax, 48(%rbx)	# 10467	[c=13 l=4]  *cmpdi_1/0
+	jnb	.L1608	# 10468	[c=13 l=6]  *jcc
+.L1232:
+	movl	(%rbx), %r15d	# 10475	[c=6 l=3]  *zero_extendsidi2/3
+	movl	$1, 96(%rbx)	# 10480	[c=4 l=7]  *movsi_internal/1
+	movq	%r10, %rcx	# 15852	[c=4 l=3]  *movdi_internal/3
+	movq	%r15, %rdx	# 15528	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 10477	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 10479	[c=13 l=7]  *adddi_1/1
+	movzbl	11(%r15), %ebp	# 10481	[c=13 l=5]  zero_extendqidi2/0
+	movzwl	14(%r15), %eax	# 10484	[c=13 l=5]  zero_extendhidi2/0
+	addq	%rax, 48(%rbx)	# 10485	[c=13 l=4]  *adddi_1/0
+	movq	(%r15), %r14	# 10489	[c=5 l=3]  *movdi_internal/3
+	addq	%r13, %rbp	# 10482	[c=4 l=3]  *adddi_1/0
+	movq	%rbp, 40(%rbx)	# 10483	[c=4 l=4]  *movdi_internal/5
+	movzbl	9(%r15), %eax	# 10486	[c=13 l=5]  *zero_extendqisi2/0
+	addl	%edx, %eax	# 10487	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 15853	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 10488	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 15854	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 15855	[c=4 l=3]  *indirect_jump
+.L611:
+	movzbl	10(%r15), %edx	# 941	[c=13 l=5]  zero_extendqidi2/0
+	addq	1040(%rbx), %rdx	# 943	[c=13 l=7]  *adddi_1/1
+	movzbl	(%rdx), %ecx	# 945	[c=9 l=3]  *zero_extendqisi2/0
+	movzwl	12(%r15), %eax	# 944	[c=13 l=5]  *zero_extendhisi2/0
+	andl	%ecx, %eax	# 946	[c=4 l=2]  *andsi_1/0
+	movb	%al, (%rdx)	# 947	[c=4 l=2]  *movqi_internal/8
+	movzbl	100(%rbx), %edx	# 948	[c=9 l=4]  *movqi_internal/4
+	movl	%edx, %ecx	# 12883	[c=4 l=2]  *movsi_internal/0
+	andl	$225, %ecx	# 951	[c=4 l=6]  *andsi_2/0
+	jne	.L612	# 952	[c=13 l=6]  *jcc
+	leaq	flag_update_table_logical(%rip), %rdx	# 955	[c=1 l=7]  *movdi_internal/4
+	cltq	# 954	[c=4 l=2]  *extendsidi2_rex64/0
+	addq	%rdx, %rax	# 956	[c=4 l=3]  *adddi_1/0
+	movl	$30, %edx	# 9	[c=4 l=5]  *movqi_internal/3
+.L613:
+	movl	(%rbx), %r15d	# 975	[c=6 l=3]  *zero_extendsidi2/3
+	movb	%dl, 100(%rbx)	# 974	[c=4 l=3]  *movqi_internal/8
+	movq	%r10, %rcx	# 16676	[c=4 l=3]  *movdi_internal/3
+	movq	%rax, 104(%rbx)	# 973	[c=4 l=4]  *movdi_internal/5
+	movq	%r15, %rdx	# 15315	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 977	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 979	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%r15), %eax	# 980	[c=13 l=5]  *zero_extendqisi2/0
+	movq	(%r15), %r14	# 983	[c=5 l=3]  *movdi_internal/3
+	addl	%edx, %eax	# 981	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 16677	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 982	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 16678	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 16679	[c=4 l=3]  *indirect_jump
+.L614:
+	movzbl	10(%r15), %edx	# 988	[c=13 l=5]  zero_extendqidi2/0
+	addq	1040(%rbx), %rdx	# 990	[c=13 l=7]  *adddi_1/1
+	movsbl	(%rdx), %eax	# 991	[c=9 l=3]  extendqisi2
+	andl	$511, %eax	# 992	[c=4 l=5]  *andsi_1/0
+	movl	%eax, %ecx	# 12885	[c=4 l=2]  *movsi_internal/0
+	sarl	%ecx	# 993	[c=4 l=2]  *ashrsi3_1/0
+	movb	%cl, (%rdx)	# 994	[c=4 l=2]  *movqi_internal/8
+	movzbl	100(%rbx), %edx	# 995	[c=9 l=4]  *movqi_internal/4
+	movl	%edx, %ecx	# 12887	[c=4 l=2]  *movsi_internal/0
+	andl	$224, %ecx	# 998	[c=4 l=6]  *andsi_2/0
+	jne	.L615	# 999	[c=13 l=6]  *jcc
+	leaq	flag_update_table_ror8(%rip), %rdx	# 1002	[c=1 l=7]  *movdi_internal/4
+	cltq	# 1001	[c=4 l=2]  *extendsidi2_rex64/0
+	addq	%rdx, %rax	# 1003	[c=4 l=3]  *adddi_1/0
+	movl	$31, %edx	# 10	[c=4 l=5]  *movqi_internal/3
+.L616:
+	movl	(%rbx), %r15d	# 1022	[c=6 l=3]  *zero_extendsidi2/3
+	movb	%dl, 100(%rbx)	# 1021	[c=4 l=3]  *movqi_internal/8
+	movq	%r10, %rcx	# 16668	[c=4 l=3]  *movdi_internal/3
+	movq	%rax, 104(%rbx)	# 1020	[c=4 l=4]  *movdi_internal/5
+	movq	%r15, %rdx	# 15316	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 1024	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 1026	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%r15), %eax	# 1027	[c=13 l=5]  *zero_extendqisi2/0
+	movq	(%r15), %r14	# 1030	[c=5 l=3]  *movdi_internal/3
+	addl	%edx, %eax	# 1028	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 16669	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 1029	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 16670	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 16671	[c=4 l=3]  *indirect_jump
+.L617:
+	movzbl	10(%r15), %ecx	# 1035	[c=13 l=5]  *zero_extendqisi2/0
+	movzbl	100(%rbx), %edx	# 1036	[c=13 l=4]  *zero_extendqisi2/0
+	movl	(%rbx), %r15d	# 1050	[c=6 l=3]  *zero_extendsidi2/3
+	movl	%ecx, %eax	# 15317	[c=4 l=2]  *movsi_internal/0
+	notl	%ecx	# 1038	[c=4 l=2]  *one_cmplsi2_1/0
+	andl	%ecx, %edx	# 1039	[c=4 l=2]  *andsi_1/0
+	movq	104(%rbx), %rcx	# 1041	[c=9 l=4]  *movdi_internal/3
+	orl	%edx, %eax	# 15039	[c=4 l=2]  *iorsi_1/0
+	movzbl	(%rcx), %edi	# 16910	[c=5 l=3]  *movqi_internal/4
+	movb	%al, 100(%rbx)	# 1047	[c=4 l=3]  *movqi_internal/8
+	movq	%r10, %rcx	# 16660	[c=4 l=3]  *movdi_internal/3
+	andl	%edx, %edi	# 17534	[c=4 l=2]  *andsi_1/0
+	leaq	101(%rbx), %rdx	# 15040	[c=4 l=4]  *leadi
+	movq	%rdx, 104(%rbx)	# 1049	[c=4 l=4]  *movdi_internal/5
+	movq	%r15, %rdx	# 15318	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 1052	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 1054	[c=13 l=7]  *adddi_1/1
+	movb	%dil, 101(%rbx)	# 1045	[c=4 l=4]  *movqi_internal/8
+	movzbl	9(%r15), %eax	# 1055	[c=13 l=5]  *zero_extendqisi2/0
+	movq	(%r15), %r14	# 1058	[c=5 l=3]  *movdi_internal/3
+	addl	%edx, %eax	# 1056	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 16661	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 1057	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 16662	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 16663	[c=4 l=3]  *indirect_jump
+.L618:
+	movzbl	10(%r15), %edx	# 1065	[c=13 l=5]  zero_extendqidi2/0
+	movq	1040(%rbx), %r8	# 1064	[c=9 l=7]  *movdi_internal/3
+	movzbl	100(%rbx), %eax	# 1069	[c=13 l=4]  *zero_extendqisi2/0
+	movzwl	12(%r15), %ecx	# 1063	[c=13 l=5]  *zero_extendhisi2/0
+	addq	%r8, %rdx	# 1066	[c=4 l=3]  *adddi_1/0
+	movzbl	95(%r8), %r8d	# 1072	[c=13 l=5]  *zero_extendqisi2/0
+	movl	%eax, %edi	# 15319	[c=4 l=2]  *movsi_internal/0
+	notl	%eax	# 1071	[c=4 l=2]  *one_cmplsi2_1/0
+	movzbl	(%rdx), %esi	# 1067	[c=9 l=3]  *zero_extendqisi2/0
+	andl	%r8d, %eax	# 1073	[c=4 l=3]  *andsi_1/0
+	movq	104(%rbx), %r8	# 1074	[c=9 l=4]  *movdi_internal/3
+	orl	%ecx, %esi	# 1068	[c=4 l=2]  *iorsi_1/0
+	notl	%ecx	# 1081	[c=4 l=2]  *one_cmplsi2_1/0
+	andb	(%r8), %dil	# 1075	[c=9 l=3]  *andqi_1/1
+	orl	%edi, %eax	# 1077	[c=4 l=2]  *iorsi_1/0
+	sall	$25, %eax	# 1079	[c=4 l=3]  *ashlsi3_1/0
+	sarl	$31, %eax	# 1080	[c=4 l=3]  ashrsi3_cvt/1
+	orl	%ecx, %eax	# 1082	[c=4 l=2]  *iorsi_1/0
+	movq	%r10, %rcx	# 16652	[c=4 l=3]  *movdi_internal/3
+	andl	%esi, %eax	# 1083	[c=4 l=2]  *andsi_1/0
+	movb	%al, (%rdx)	# 1084	[c=4 l=2]  *movqi_internal/8
+	movl	(%rbx), %r15d	# 1085	[c=6 l=3]  *zero_extendsidi2/3
+	movq	%r15, %rdx	# 15320	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 1087	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 1089	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%r15), %eax	# 1090	[c=13 l=5]  *zero_extendqisi2/0
+	movq	(%r15), %r14	# 1093	[c=5 l=3]  *movdi_internal/3
+	addl	%edx, %eax	# 1091	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 16653	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 1092	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 16654	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 16655	[c=4 l=3]  *indirect_jump
+.L855:
+	movzwl	12(%r15), %esi	# 4352	[c=13 l=5]  zero_extendhidi2/0
+	movzbl	10(%r15), %edx	# 4354	[c=13 l=5]  zero_extendqidi2/0
+	movq	1040(%rbx), %rcx	# 4353	[c=9 l=7]  *movdi_internal/3
+	movq	%rsi, %rax	# 15390	[c=4 l=3]  *movdi_internal/3
+	movzbl	(%rcx,%rdx), %edi	# 4355	[c=9 l=4]  *movqi_internal/4
+	movl	%esi, %edx	# 13160	[c=4 l=2]  *movsi_internal/0
+	subl	5176(%rbx), %edx	# 4357	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %edx	# 4358	[c=13 l=6]  *cmpsi_1/1
+	jb	.L856	# 4359	[c=13 l=2]  *jcc
+	movl	%esi, %edx	# 13162	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %edx	# 4362	[c=4 l=3]  *ashrsi3_1/0
+	movslq	%edx, %rdx	# 4363	[c=4 l=3]  *extendsidi2_rex64/1
+	cmpb	$0, 1080(%rbx,%rdx)	# 4364	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L857	# 4365	[c=13 l=6]  *jcc
+.L856:
+	movb	%dil, (%rcx,%rax)	# 4369	[c=4 l=4]  *movqi_internal/8
+.L858:
+	movl	(%rbx), %r15d	# 4381	[c=6 l=3]  *zero_extendsidi2/3
+	movq	%r10, %rcx	# 16212	[c=4 l=3]  *movdi_internal/3
+	movq	%r15, %rdx	# 15391	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 4383	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 4385	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%r15), %eax	# 4386	[c=13 l=5]  *zero_extendqisi2/0
+	movq	(%r15), %r14	# 4389	[c=5 l=3]  *movdi_internal/3
+	addl	%edx, %eax	# 4387	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 16213	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 4388	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 16214	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 16215	[c=4 l=3]  *indirect_jump
+.L1040:
+	movq	1040(%rbx), %rcx	# 6651	[c=9 l=7]  *movdi_internal/3
+	movzbl	10(%r15), %edx	# 6654	[c=13 l=5]  zero_extendqidi2/0
+	movzwl	28(%rcx), %eax	# 6652	[c=13 l=4]  *zero_extendhisi2/0
+	movzbl	(%rcx,%rdx), %esi	# 6655	[c=9 l=4]  *movqi_internal/4
+	subl	$1, %eax	# 6653	[c=4 l=3]  *addsi_1/0
+	movl	%eax, %edx	# 13316	[c=4 l=2]  *movsi_internal/0
+	subl	5176(%rbx), %edx	# 6656	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %edx	# 6657	[c=13 l=6]  *cmpsi_1/1
+	jb	.L1041	# 6658	[c=13 l=2]  *jcc
+	movl	%eax, %edx	# 13318	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %edx	# 6660	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %edx	# 12698	[c=5 l=6]  *andsi_1_zext
+	cmpb	$0, 1080(%rbx,%rdx)	# 6663	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L1042	# 6664	[c=13 l=6]  *jcc
+.L1041:
+	movslq	%eax, %rdx	# 6667	[c=4 l=3]  *extendsidi2_rex64/1
+	movb	%sil, (%rcx,%rdx)	# 6668	[c=4 l=4]  *movqi_internal/8
+.L1043:
+	movq	1040(%rbx), %rdx	# 6680	[c=9 l=7]  *movdi_internal/3
+	movq	%r10, %rcx	# 15988	[c=4 l=3]  *movdi_internal/3
+	movb	%al, 28(%rdx)	# 6681	[c=4 l=3]  *movqi_internal/8
+	movq	1040(%rbx), %rdx	# 6682	[c=9 l=7]  *movdi_internal/3
+	movb	%ah, 29(%rdx)	# 16793	[c=4 l=3]  *extzvqi_mem_rex64
+	movl	(%rbx), %r15d	# 6685	[c=6 l=3]  *zero_extendsidi2/3
+	movq	%r15, %rdx	# 15436	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 6687	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 6689	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%r15), %eax	# 6690	[c=13 l=5]  *zero_extendqisi2/0
+	movq	(%r15), %r14	# 6693	[c=5 l=3]  *movdi_internal/3
+	addl	%edx, %eax	# 6691	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 15989	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 6692	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 15990	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 15991	[c=4 l=3]  *indirect_jump
+.L577:
+	movzwl	12(%r15), %ecx	# 340	[c=13 l=5]  *zero_extendhisi2/0
+	movl	(%rbx), %eax	# 12847	[c=5 l=2]  *movsi_internal/0
+	movl	$2, 96(%rbx)	# 338	[c=4 l=7]  *movsi_internal/1
+	movzbl	10(%r15), %edx	# 339	[c=9 l=5]  *movqi_internal/4
+	subl	%ecx, %eax	# 342	[c=4 l=2]  *subsi_1/0
+	movq	1056(%rbx), %rcx	# 346	[c=9 l=7]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 343	[c=4 l=2]  *movsi_internal/1
+	addl	%eax, %eax	# 344	[c=5 l=2]  *ashlsi3_1_zext/0
+	movzwl	(%rcx,%rax), %ecx	# 347	[c=13 l=4]  *zero_extendhisi2/0
+	cmpb	$1, %dl	# 348	[c=4 l=3]  *cmpqi_1/0
+	je	.L1412	# 349	[c=13 l=6]  *jcc
+	cmpb	$2, %dl	# 351	[c=4 l=3]  *cmpqi_1/0
+	je	.L1413	# 352	[c=13 l=6]  *jcc
+	testb	%dl, %dl	# 354	[c=4 l=2]  *cmpqi_ccno_1/0
+	je	.L1609	# 355	[c=13 l=6]  *jcc
+	leaq	.LC46(%rip), %rdx	# 390	[c=1 l=7]  *movdi_internal/4
+	movl	$8, %esi	# 392	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 393	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 16937	[c=4 l=2]  *movdi_xor
+	call	leave	# 395	[c=0 l=5]  *call
+.L628:
+	movzbl	10(%r15), %ecx	# 1251	[c=13 l=5]  *zero_extendqisi2/0
+	movzbl	100(%rbx), %edx	# 1252	[c=13 l=4]  *zero_extendqisi2/0
+	movl	(%rbx), %r15d	# 1266	[c=6 l=3]  *zero_extendsidi2/3
+	movl	%ecx, %eax	# 15326	[c=4 l=2]  *movsi_internal/0
+	notl	%ecx	# 1254	[c=4 l=2]  *one_cmplsi2_1/0
+	andl	%ecx, %edx	# 1255	[c=4 l=2]  *andsi_1/0
+	movq	104(%rbx), %rcx	# 1258	[c=9 l=4]  *movdi_internal/3
+	movzbl	(%rcx), %edi	# 16902	[c=5 l=3]  *movqi_internal/4
+	andl	%edx, %edi	# 17533	[c=4 l=2]  *andsi_1/0
+	movl	%edi, %ecx	# 12897	[c=4 l=2]  *movqi_internal/1
+	orl	%eax, %ecx	# 15036	[c=4 l=2]  *iorsi_1/0
+	orl	%edx, %eax	# 15037	[c=4 l=2]  *iorsi_1/0
+	leaq	101(%rbx), %rdx	# 15038	[c=4 l=4]  *leadi
+	movq	%rdx, 104(%rbx)	# 1265	[c=4 l=4]  *movdi_internal/5
+	movq	%r15, %rdx	# 15327	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 1268	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 1270	[c=13 l=7]  *adddi_1/1
+	movb	%cl, 101(%rbx)	# 1261	[c=4 l=3]  *movqi_internal/8
+	movq	%r10, %rcx	# 16620	[c=4 l=3]  *movdi_internal/3
+	movb	%al, 100(%rbx)	# 1263	[c=4 l=3]  *movqi_internal/8
+	movzbl	9(%r15), %eax	# 1271	[c=13 l=5]  *zero_extendqisi2/0
+	movq	(%r15), %r14	# 1274	[c=5 l=3]  *movdi_internal/3
+	addl	%edx, %eax	# 1272	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 16621	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 1273	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 16622	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 16623	[c=4 l=3]  *indirect_jump
+.L619:
+	movq	(%rsp), %rax	# 12891	[c=5 l=4]  *movdi_internal/3
+	subq	$1, %rax	# 1099	[c=4 l=4]  *adddi_1/0
+	cmpq	%rbp, %rax	# 1100	[c=4 l=3]  *cmpdi_1/0
+	jb	.L620	# 1101	[c=13 l=6]  *jcc
+	movq	56(%rbx), %rax	# 12892	[c=9 l=4]  *movdi_internal/3
+	cmpq	%rax, 48(%rbx)	# 1104	[c=13 l=4]  *cmpdi_1/0
+	jnb	.L1610	# 1105	[c=13 l=6]  *jcc
+.L621:
+	movl	(%rbx), %r15d	# 1112	[c=6 l=3]  *zero_extendsidi2/3
+	movl	$1, 96(%rbx)	# 1117	[c=4 l=7]  *movsi_internal/1
+	movq	%r10, %rcx	# 16644	[c=4 l=3]  *movdi_internal/3
+	movq	%r15, %rdx	# 15321	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 1114	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 1116	[c=13 l=7]  *adddi_1/1
+	movzbl	11(%r15), %eax	# 1118	[c=13 l=5]  zero_extendqidi2/0
+	movq	(%r15), %r14	# 1126	[c=5 l=3]  *movdi_internal/3
+	addq	%rax, %rbp	# 1119	[c=4 l=3]  *adddi_1/0
+	movzwl	14(%r15), %eax	# 1121	[c=13 l=5]  zero_extendhidi2/0
+	addq	%rax, 48(%rbx)	# 1122	[c=13 l=4]  *adddi_1/0
+	movq	%rbp, 40(%rbx)	# 1120	[c=4 l=4]  *movdi_internal/5
+	movzbl	9(%r15), %eax	# 1123	[c=13 l=5]  *zero_extendqisi2/0
+	addl	%edx, %eax	# 1124	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 16645	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 1125	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 16646	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 16647	[c=4 l=3]  *indirect_jump
+.L653:
+	movzbl	10(%r15), %r13d	# 1563	[c=13 l=5]  *zero_extendqisi2/0
+	movzwl	12(%r15), %edx	# 1562	[c=13 l=5]  *zero_extendhisi2/0
+	movl	%r13d, %eax	# 12919	[c=4 l=3]  *movsi_internal/0
+	movl	%r13d, %r14d	# 15330	[c=4 l=3]  *movsi_internal/0
+	subl	5176(%rbx), %eax	# 1566	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %eax	# 1567	[c=13 l=6]  *cmpsi_1/1
+	jb	.L654	# 1568	[c=13 l=2]  *jcc
+	movl	%r13d, %eax	# 12921	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %eax	# 1570	[c=4 l=3]  *ashrsi3_1/0
+	cltq	# 1571	[c=4 l=2]  *extendsidi2_rex64/0
+	cmpb	$0, 1080(%rbx,%rax)	# 1572	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L655	# 1573	[c=13 l=6]  *jcc
+.L654:
+	movq	1040(%rbx), %rcx	# 1577	[c=9 l=7]  *movdi_internal/3
+	movzbl	%r14b, %eax	# 1576	[c=4 l=4]  zero_extendqidi2/0
+	movzbl	(%rcx,%rax), %esi	# 1578	[c=13 l=4]  *zero_extendqisi2/0
+.L656:
+	cmpl	6564(%rbx), %r13d	# 1589	[c=13 l=7]  *cmpsi_1/1
+	jnb	.L657	# 1590	[c=13 l=2]  *jcc
+	movslq	%r13d, %rax	# 1592	[c=4 l=3]  *extendsidi2_rex64/1
+	xorl	%ecx, %ecx	# 16897	[c=4 l=2]  *movdi_xor
+	cmpb	$0, 6568(%rbx,%rax)	# 1595	[c=14 l=8]  *cmpqi_ccno_1/1
+	jns	.L657	# 1596	[c=13 l=2]  *jcc
+.L658:
+	movl	%r13d, %eax	# 12927	[c=4 l=3]  *movsi_internal/0
+	subl	5176(%rbx), %eax	# 1603	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %eax	# 1604	[c=13 l=6]  *cmpsi_1/1
+	jb	.L659	# 1605	[c=13 l=2]  *jcc
+	movl	%r13d, %eax	# 12929	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %eax	# 1607	[c=4 l=3]  *ashrsi3_1/0
+	cltq	# 1608	[c=4 l=2]  *extendsidi2_rex64/0
+	cmpb	$0, 1080(%rbx,%rax)	# 1609	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L660	# 1610	[c=13 l=6]  *jcc
+.L659:
+	movq	1040(%rbx), %rdx	# 1614	[c=9 l=7]  *movdi_internal/3
+	movzbl	%r14b, %eax	# 1613	[c=4 l=4]  zero_extendqidi2/0
+	movb	%cl, (%rdx,%rax)	# 1615	[c=4 l=3]  *movqi_internal/8
+.L661:
+	movl	(%rbx), %r15d	# 1626	[c=6 l=3]  *zero_extendsidi2/3
+	movq	%r10, %rcx	# 16596	[c=4 l=3]  *movdi_internal/3
+	movq	%r15, %rdx	# 15331	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 1628	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 1630	[c=13 l=7]  *adddi_1/1
+	movzbl	9(%r15), %eax	# 1631	[c=13 l=5]  *zero_extendqisi2/0
+	movq	(%r15), %r14	# 1634	[c=5 l=3]  *movdi_internal/3
+	addl	%edx, %eax	# 1632	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 16597	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 1633	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 16598	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 16599	[c=4 l=3]  *indirect_jump
+.L657:
+	movl	%edx, %eax	# 12923	[c=4 l=2]  *movsi_internal/0
+	notl	%eax	# 1599	[c=4 l=2]  *one_cmplsi2_1/0
+	andl	%esi, %eax	# 1600	[c=4 l=2]  *andsi_1/0
+	movl	%eax, %ecx	# 12926	[c=4 l=2]  *movsi_internal/0
+	jmp	.L658	# 17100	[c=1 l=2]  jump
+.L630:
+	movzwl	12(%r15), %r14d	# 1313	[c=13 l=5]  *zero_extendhisi2/0
+	movl	$2, 96(%rbx)	# 1312	[c=4 l=7]  *movsi_internal/1
+	movl	$93, %eax	# 1317	[c=4 l=5]  *movsi_internal/0
+	movzbl	10(%r15), %r13d	# 1314	[c=13 l=5]  *zero_extendqisi2/0
+	movl	5176(%rbx), %r15d	# 1315	[c=9 l=7]  *movsi_internal/0
+	movl	5180(%rbx), %edx	# 1316	[c=9 l=6]  *movsi_internal/0
+	subl	%r15d, %eax	# 1318	[c=4 l=3]  *subsi_1/0
+	cmpl	%edx, %eax	# 1319	[c=4 l=2]  *cmpsi_1/0
+	jb	.L631	# 1320	[c=13 l=6]  *jcc
+	cmpb	$1, 1082(%rbx)	# 1324	[c=13 l=7]  *cmpqi_1/0
+	ja	.L1611	# 1325	[c=13 l=6]  *jcc
+	movq	1040(%rbx), %rax	# 11218	[c=9 l=7]  *movdi_internal/3
+	movzbl	93(%rax), %ecx	# 11219	[c=13 l=4]  *zero_extendqisi2/0
+.L633:
+	movzbl	94(%rax), %eax	# 1362	[c=13 l=4]  *zero_extendqisi2/0
+.L635:
+	sall	$8, %eax	# 1365	[c=4 l=3]  *ashlsi3_1/0
+	movl	996(%rbx), %esi	# 1368	[c=9 l=6]  *movsi_internal/0
+	orl	%ecx, %eax	# 1366	[c=4 l=2]  *iorsi_1/0
+	movzbl	840(%rbx), %ecx	# 1370	[c=13 l=7]  *zero_extendqisi2/0
+	leal	1(%rsi,%rcx), %ecx	# 1371	[c=5 l=4]  *leasi
+	cmpl	%ecx, %eax	# 1372	[c=4 l=2]  *cmpsi_1/0
+	jb	.L1419	# 1373	[c=13 l=6]  *jcc
+	movl	%eax, %edi	# 12900	[c=4 l=2]  *movsi_internal/0
+	movl	(%rbx), %esi	# 1381	[c=5 l=2]  *movsi_internal/0
+	leal	-1(%rax), %ecx	# 15030	[c=4 l=3]  *leasi
+	subl	%r15d, %edi	# 1383	[c=4 l=3]  *subsi_1/0
+	cmpl	%edx, %edi	# 1384	[c=4 l=2]  *cmpsi_1/0
+	jb	.L637	# 1385	[c=13 l=2]  *jcc
+	movl	%eax, %edx	# 12902	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %edx	# 1387	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %edx	# 12722	[c=5 l=6]  *andsi_1_zext
+	cmpb	$0, 1080(%rbx,%rdx)	# 1390	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L638	# 1391	[c=13 l=6]  *jcc
+.L637:
+	movq	1040(%rbx), %rdi	# 1395	[c=9 l=7]  *movdi_internal/3
+	movslq	%eax, %rdx	# 1394	[c=4 l=3]  *extendsidi2_rex64/1
+	movb	%sil, (%rdi,%rdx)	# 1396	[c=4 l=4]  *movqi_internal/8
+.L639:
+	movl	(%rbx), %esi	# 12904	[c=5 l=2]  *movsi_internal/0
+	movl	%ecx, %edx	# 12906	[c=4 l=2]  *movsi_internal/0
+	leal	-2(%rax), %r15d	# 15029	[c=4 l=4]  *leasi
+	subl	5176(%rbx), %edx	# 1410	[c=13 l=6]  *subsi_1/1
+	shrl	$8, %esi	# 1408	[c=4 l=3]  *lshrsi3_1/0
+	cmpl	5180(%rbx), %edx	# 1411	[c=13 l=6]  *cmpsi_1/1
+	jb	.L640	# 1412	[c=13 l=2]  *jcc
+	movl	%ecx, %edx	# 12908	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %edx	# 1414	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %edx	# 12721	[c=5 l=6]  *andsi_1_zext
+	cmpb	$0, 1080(%rbx,%rdx)	# 1417	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L641	# 1418	[c=13 l=6]  *jcc
+.L640:
+	movq	1040(%rbx), %rdx	# 1422	[c=9 l=7]  *movdi_internal/3
+	movslq	%ecx, %rcx	# 1421	[c=4 l=3]  *extendsidi2_rex64/1
+	movb	%sil, (%rdx,%rcx)	# 1423	[c=4 l=4]  *movqi_internal/8
+.L642:
+	cmpb	$0, 840(%rbx)	# 1434	[c=13 l=7]  *cmpqi_ccno_1/1
+	je	.L643	# 1435	[c=13 l=2]  *jcc
+	movl	(%rbx), %edx	# 12910	[c=5 l=2]  *movsi_internal/0
+	movl	%r15d, %ecx	# 12912	[c=4 l=3]  *movsi_internal/0
+	subl	$3, %eax	# 1439	[c=4 l=3]  *addsi_1/0
+	subl	5176(%rbx), %ecx	# 1440	[c=13 l=6]  *subsi_1/1
+	shrl	$16, %edx	# 1438	[c=4 l=3]  *lshrsi3_1/0
+	cmpl	5180(%rbx), %ecx	# 1441	[c=13 l=6]  *cmpsi_1/1
+	jb	.L644	# 1442	[c=13 l=2]  *jcc
+	movl	%r15d, %ecx	# 12914	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %ecx	# 1444	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %ecx	# 12720	[c=5 l=6]  *andsi_1_zext
+	cmpb	$0, 1080(%rbx,%rcx)	# 1447	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L645	# 1448	[c=13 l=6]  *jcc
+.L644:
+	movq	1040(%rbx), %rcx	# 1452	[c=9 l=7]  *movdi_internal/3
+	movslq	%r15d, %r15	# 1451	[c=4 l=3]  *extendsidi2_rex64/1
+	movb	%dl, (%rcx,%r15)	# 1453	[c=4 l=4]  *movqi_internal/8
+.L646:
+	movl	%eax, %r15d	# 11	[c=4 l=3]  *movsi_internal/0
+.L643:
+	movl	$93, %eax	# 1468	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%rbx), %eax	# 1469	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %eax	# 1470	[c=13 l=6]  *cmpsi_1/1
+	jb	.L647	# 1471	[c=13 l=2]  *jcc
+	cmpb	$1, 1082(%rbx)	# 1475	[c=13 l=7]  *cmpqi_1/0
+	ja	.L1612	# 1476	[c=13 l=6]  *jcc
+.L647:
+	movq	1040(%rbx), %rax	# 1487	[c=9 l=7]  *movdi_internal/3
+	movb	%r15b, 93(%rax)	# 1488	[c=4 l=4]  *movqi_internal/8
+.L648:
+	movl	%r15d, %eax	# 12916	[c=4 l=3]  *movsi_internal/0
+	movl	$94, %edx	# 1492	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%rbx), %edx	# 1493	[c=13 l=6]  *subsi_1/1
+	sarl	$8, %eax	# 1491	[c=4 l=3]  *ashrsi3_1/0
+	cmpl	5180(%rbx), %edx	# 1494	[c=13 l=6]  *cmpsi_1/1
+	jb	.L649	# 1495	[c=13 l=2]  *jcc
+	cmpb	$1, 1082(%rbx)	# 1499	[c=13 l=7]  *cmpqi_1/0
+	ja	.L1613	# 1500	[c=13 l=6]  *jcc
+.L649:
+	movq	1040(%rbx), %rdx	# 1511	[c=9 l=7]  *movdi_internal/3
+	movb	%al, 94(%rdx)	# 1512	[c=4 l=3]  *movqi_internal/8
+.L650:
+	sall	$16, %r13d	# 1515	[c=4 l=4]  *ashlsi3_1/0
+	orl	%r14d, %r13d	# 1516	[c=4 l=3]  *iorsi_1/0
+	movl	%r13d, (%rbx)	# 1517	[c=4 l=3]  *movsi_internal/1
+	cmpl	%r13d, 992(%rbx)	# 1518	[c=13 l=7]  *cmpsi_1/0
+	jb	.L1614	# 1519	[c=13 l=6]  *jcc
+	movq	(%rsp), %rdi	# 12918	[c=5 l=4]  *movdi_internal/3
+	movzbl	840(%rbx), %eax	# 1527	[c=13 l=7]  zero_extendqidi2/0
+	addq	48(%rbx), %rax	# 1529	[c=13 l=4]  *adddi_1/1
+	leaq	-1(%rdi), %rdx	# 15028	[c=4 l=4]  *leadi
+	movq	%rax, 48(%rbx)	# 1530	[c=4 l=4]  *movdi_internal/5
+	cmpq	%rbp, %rdx	# 1532	[c=4 l=3]  *cmpdi_1/0
+	jb	.L620	# 1533	[c=13 l=6]  *jcc
+	cmpq	56(%rbx), %rax	# 1535	[c=13 l=4]  *cmpdi_1/1
+	jnb	.L1615	# 1536	[c=13 l=6]  *jcc
+.L652:
+	movl	(%rbx), %r15d	# 1543	[c=6 l=3]  *zero_extendsidi2/3
+	movl	$1, 96(%rbx)	# 1548	[c=4 l=7]  *movsi_internal/1
+	movq	%r10, %rcx	# 16604	[c=4 l=3]  *movdi_internal/3
+	movq	%r15, %rdx	# 15329	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 1545	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 1547	[c=13 l=7]  *adddi_1/1
+	movzbl	11(%r15), %eax	# 1549	[c=13 l=5]  zero_extendqidi2/0
+	movq	(%r15), %r14	# 1557	[c=5 l=3]  *movdi_internal/3
+	addq	%rax, %rbp	# 1550	[c=4 l=3]  *adddi_1/0
+	movzwl	14(%r15), %eax	# 1552	[c=13 l=5]  zero_extendhidi2/0
+	addq	%rax, 48(%rbx)	# 1553	[c=13 l=4]  *adddi_1/0
+	movq	%rbp, 40(%rbx)	# 1551	[c=4 l=4]  *movdi_internal/5
+	movzbl	9(%r15), %eax	# 1554	[c=13 l=5]  *zero_extendqisi2/0
+	addl	%edx, %eax	# 1555	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 16605	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 1556	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 16606	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 16607	[c=4 l=3]  *indirect_jump
+.L1564:
+	movl	$50651151, %eax	# 242	[c=4 l=5]  *movdi_internal/2
+	shrq	%cl, %rax	# 243	[c=4 l=3]  *lshrdi3_1/0
+	testb	$1, %al	# 15069	[c=4 l=2]  *testqi_1_maybe_si/1
+	je	.L568	# 246	[c=13 l=6]  *jcc
+	jmp	.L559	# 17108	[c=1 l=5]  jump
+.L601:
+	movq	104(%rbx), %rdi	# 699	[c=9 l=4]  *movdi_internal/3
+	orl	$63, %eax	# 15062	[c=4 l=3]  *iorsi_1/0
+	andb	(%rdi), %sil	# 700	[c=9 l=3]  *andqi_1/1
+	orb	(%rcx,%rdx), %sil	# 705	[c=13 l=4]  *iorqi_1/1
+	movl	%eax, %edx	# 12860	[c=4 l=2]  *movqi_internal/0
+	movb	%sil, 101(%rbx)	# 706	[c=4 l=4]  *movqi_internal/8
+	leaq	101(%rbx), %rax	# 15063	[c=4 l=4]  *leadi
+	jmp	.L602	# 17110	[c=1 l=5]  jump
+.L1126:
+	movq	104(%rbx), %rsi	# 8523	[c=9 l=4]  *movdi_internal/3
+	orl	$63, %ecx	# 14827	[c=4 l=3]  *iorsi_1/0
+	andb	(%rsi), %al	# 8524	[c=9 l=2]  *andqi_1/1
+	movl	%eax, %esi	# 13611	[c=4 l=2]  *movqi_internal/1
+	leaq	flag_update_table_sub8(%rip), %rax	# 8525	[c=1 l=7]  *movdi_internal/4
+	orb	(%rax,%rdx), %sil	# 8529	[c=13 l=4]  *iorqi_1/1
+	leaq	101(%rbx), %rax	# 14828	[c=4 l=4]  *leadi
+	movb	%sil, 101(%rbx)	# 8530	[c=4 l=4]  *movqi_internal/8
+	jmp	.L1127	# 17112	[c=1 l=5]  jump
+.L738:
+	cmpl	$4, %eax	# 2669	[c=4 l=3]  *cmpsi_1/0
+	jne	.L741	# 2670	[c=13 l=6]  *jcc
+	movl	%ecx, %edx	# 2707	[c=1 l=2]  *zero_extendsidi2/3
+	movl	$255, %esi	# 2709	[c=4 l=5]  *movsi_internal/0
+	movq	%r15, %rdi	# 2710	[c=4 l=3]  *movdi_internal/3
+	movl	%ecx, 32(%rsp)	# 14037	[c=4 l=4]  *movsi_internal/1
+	movq	%rdx, 16(%rsp)	# 14035	[c=4 l=5]  *movdi_internal/5
+	call	memset@PLT	# 2711	[c=10 l=5]  *call_value
+	movq	16(%rsp), %rdx	# 14036	[c=9 l=5]  *movdi_internal/3
+	movl	32(%rsp), %ecx	# 14038	[c=9 l=4]  *movsi_internal/0
+.L737:
+	xorl	%eax, %eax	# 16882	[c=4 l=2]  *movdi_xor
+	jmp	.L743	# 17114	[c=1 l=2]  jump
+.L744:
+	movzbl	6052(%rbx,%rax), %esi	# 2715	[c=10 l=8]  *movqi_internal/4
+	andb	%sil, (%r15,%rax)	# 2716	[c=13 l=4]  *andqi_1/0
+	addq	$1, %rax	# 2717	[c=4 l=4]  *adddi_1/0
+.L743:
+	cmpl	%ecx, %eax	# 2725	[c=4 l=2]  *cmpsi_1/0
+	jb	.L744	# 2726	[c=13 l=2]  *jcc
+	movq	24(%rsp), %rdi	# 2732	[c=9 l=5]  *movdi_internal/3
+	movl	$255, %esi	# 2731	[c=4 l=5]  *movsi_internal/0
+	movl	%ecx, 16(%rsp)	# 14043	[c=4 l=4]  *movsi_internal/1
+	call	memset@PLT	# 2733	[c=10 l=5]  *call_value
+	movl	16(%rsp), %ecx	# 14044	[c=9 l=4]  *movsi_internal/0
+	movl	%r13d, %esi	# 2736	[c=4 l=3]  *movsi_internal/0
+	movq	%rbx, %rdi	# 2737	[c=4 l=3]  *movdi_internal/3
+	leal	(%rcx,%r13), %edx	# 15004	[c=4 l=4]  *leasi
+	call	flash_changed	# 2738	[c=0 l=5]  *call
+	leaq	flag_update_table_sub8(%rip), %r11	# 14048	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 14046	[c=1 l=7]  *movdi_internal/4
+	jmp	.L741	# 17116	[c=1 l=5]  jump
+.L1004:
+	cmpl	$4, %eax	# 6239	[c=4 l=3]  *cmpsi_1/0
+	jne	.L1007	# 6240	[c=13 l=6]  *jcc
+	movl	%r14d, %edx	# 6277	[c=1 l=3]  *zero_extendsidi2/3
+	movl	$255, %esi	# 6279	[c=4 l=5]  *movsi_internal/0
+	movq	%r15, %rdi	# 6280	[c=4 l=3]  *movdi_internal/3
+	movq	%rdx, 16(%rsp)	# 14389	[c=4 l=5]  *movdi_internal/5
+	call	memset@PLT	# 6281	[c=10 l=5]  *call_value
+	movq	16(%rsp), %rdx	# 14390	[c=9 l=5]  *movdi_internal/3
+.L1003:
+	xorl	%eax, %eax	# 16798	[c=4 l=2]  *movdi_xor
+	jmp	.L1009	# 17118	[c=1 l=2]  jump
+.L1010:
+	movzbl	6052(%rbx,%rax), %ecx	# 6285	[c=10 l=8]  *movqi_internal/4
+	andb	%cl, (%r15,%rax)	# 6286	[c=13 l=4]  *andqi_1/0
+	addq	$1, %rax	# 6287	[c=4 l=4]  *adddi_1/0
+.L1009:
+	cmpl	%r14d, %eax	# 6295	[c=4 l=3]  *cmpsi_1/0
+	jb	.L1010	# 6296	[c=13 l=2]  *jcc
+	movq	24(%rsp), %rdi	# 6302	[c=9 l=5]  *movdi_internal/3
+	movl	$255, %esi	# 6301	[c=4 l=5]  *movsi_internal/0
+	call	memset@PLT	# 6303	[c=10 l=5]  *call_value
+	leal	(%r14,%r13), %edx	# 14927	[c=4 l=4]  *leasi
+	movl	%r13d, %esi	# 6306	[c=4 l=3]  *movsi_internal/0
+	movq	%rbx, %rdi	# 6307	[c=4 l=3]  *movdi_internal/3
+	call	flash_changed	# 6308	[c=0 l=5]  *call
+	leaq	flag_update_table_sub8(%rip), %r11	# 14398	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 14396	[c=1 l=7]  *movdi_internal/4
+	jmp	.L1007	# 17120	[c=1 l=5]  jump
+.L620:
+	xorl	%eax, %eax	# 16926	[c=4 l=2]  *movsi_xor
+	leaq	.LC51(%rip), %rdx	# 618	[c=1 l=7]  *movdi_internal/4
+	movl	$2, %esi	# 620	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 621	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, 96(%rbx)	# 16927	[c=4 l=3]  *movsi_internal/1
+	xorl	%eax, %eax	# 16928	[c=4 l=2]  *movdi_xor
+	call	leave	# 623	[c=0 l=5]  *call
+.L591:
+	movq	1040(%rbx), %rdx	# 456	[c=9 l=7]  *movdi_internal/3
+	movzbl	24(%rdx), %ecx	# 457	[c=13 l=4]  *zero_extendqisi2/0
+	movl	20(%rdx), %esi	# 459	[c=10 l=3]  *zero_extendsidi2/3
+	testb	%cl, %cl	# 462	[c=4 l=2]  *cmpqi_ccno_1/0
+	jle	.L592	# 463	[c=13 l=6]  *jcc
+	cmpl	$8193, 880(%rbx)	# 11781	[c=13 l=10]  *cmpsi_1/0
+	sbbl	%eax, %eax	# 11782	[c=8 l=2]  *x86_movsicc_0_m1
+	addl	$2, %eax	# 11783	[c=4 l=3]  *addsi_1/0
+	imull	%ecx, %eax	# 473	[c=12 l=3]  *mulsi3_1/2
+	cmpl	%eax, 992(%rbx)	# 474	[c=13 l=6]  *cmpsi_1/0
+	jb	.L592	# 475	[c=13 l=6]  *jcc
+	movq	irq_raise@GOTPCREL(%rip), %rdx	# 494	[c=5 l=7]  *movdi_internal/3
+	addq	48(%rbx), %rsi	# 490	[c=13 l=4]  *adddi_1/1
+	movq	%rbx, %rdi	# 496	[c=4 l=3]  *movdi_internal/3
+	call	event_schedule@PLT	# 497	[c=0 l=5]  *call
+	leaq	flag_update_table_add8(%rip), %r10	# 13860	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_sub8(%rip), %r11	# 13862	[c=1 l=7]  *movdi_internal/4
+.L584:
+	movq	(%rsp), %rax	# 12855	[c=5 l=4]  *movdi_internal/3
+	subq	$1, %rax	# 613	[c=4 l=4]  *adddi_1/0
+	cmpq	%rbp, %rax	# 614	[c=4 l=3]  *cmpdi_1/0
+	jb	.L620	# 615	[c=13 l=2]  *jcc
+	movq	56(%rbx), %rax	# 12856	[c=9 l=4]  *movdi_internal/3
+	cmpq	%rax, 48(%rbx)	# 628	[c=13 l=4]  *cmpdi_1/0
+	jnb	.L1616	# 629	[c=13 l=6]  *jcc
+.L598:
+	movl	(%rbx), %r15d	# 636	[c=6 l=3]  *zero_extendsidi2/3
+	movl	$1, 96(%rbx)	# 641	[c=4 l=7]  *movsi_internal/1
+	movq	%r10, %rcx	# 16724	[c=4 l=3]  *movdi_internal/3
+	movq	%r15, %rdx	# 15309	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 638	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 640	[c=13 l=7]  *adddi_1/1
+	movzbl	11(%r15), %eax	# 642	[c=13 l=5]  zero_extendqidi2/0
+	movq	(%r15), %r14	# 650	[c=5 l=3]  *movdi_internal/3
+	addq	%rax, %rbp	# 643	[c=4 l=3]  *adddi_1/0
+	movzwl	14(%r15), %eax	# 645	[c=13 l=5]  zero_extendhidi2/0
+	addq	%rax, 48(%rbx)	# 646	[c=13 l=4]  *adddi_1/0
+	movq	%rbp, 40(%rbx)	# 644	[c=4 l=4]  *movdi_internal/5
+	movzbl	9(%r15), %eax	# 647	[c=13 l=5]  *zero_extendqisi2/0
+	addl	%edx, %eax	# 648	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 16725	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 649	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 16726	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 16727	[c=4 l=3]  *indirect_jump
+.L1151:
+	movq	104(%rbx), %rdi	# 9283	[c=9 l=4]  *movdi_internal/3
+	orl	$63, %edx	# 14776	[c=4 l=3]  *iorsi_1/0
+	andb	(%rdi), %sil	# 9284	[c=9 l=3]  *andqi_1/1
+	orb	(%rcx,%rax), %sil	# 9289	[c=13 l=4]  *iorqi_1/1
+	leaq	101(%rbx), %rax	# 14777	[c=4 l=4]  *leadi
+	movb	%sil, 101(%rbx)	# 9290	[c=4 l=4]  *movqi_internal/8
+	jmp	.L1152	# 17123	[c=1 l=5]  jump
+.L1084:
+	movq	104(%rbx), %rsi	# 7386	[c=9 l=4]  *movdi_internal/3
+	andb	(%rsi), %al	# 7387	[c=9 l=2]  *andqi_1/1
+	movl	%eax, %esi	# 13397	[c=4 l=2]  *movqi_internal/1
+	leaq	flag_update_table_sub8(%rip), %rax	# 7388	[c=1 l=7]  *movdi_internal/4
+	orb	(%rax,%rdx), %sil	# 7392	[c=13 l=4]  *iorqi_1/1
+	leaq	101(%rbx), %rdx	# 14905	[c=4 l=4]  *leadi
+	movb	%sil, 101(%rbx)	# 7393	[c=4 l=4]  *movqi_internal/8
+	movl	%ecx, %esi	# 13400	[c=4 l=2]  *movqi_internal/1
+	movq	%rdx, %rcx	# 11664	[c=4 l=3]  *movdi_internal/3
+	orl	$63, %esi	# 14904	[c=4 l=3]  *iorsi_1/0
+	jmp	.L1085	# 17125	[c=1 l=5]  jump
+.L1099:
+	movq	104(%rbx), %rsi	# 7773	[c=9 l=4]  *movdi_internal/3
+	orl	$63, %ecx	# 14881	[c=4 l=3]  *iorsi_1/0
+	andb	(%rsi), %al	# 7774	[c=9 l=2]  *andqi_1/1
+	movl	%eax, %esi	# 13463	[c=4 l=2]  *movqi_internal/1
+	leaq	flag_update_table_sub8(%rip), %rax	# 7775	[c=1 l=7]  *movdi_internal/4
+	orb	(%rax,%rdx), %sil	# 7779	[c=13 l=4]  *iorqi_1/1
+	leaq	101(%rbx), %rax	# 14882	[c=4 l=4]  *leadi
+	movb	%sil, 101(%rbx)	# 7780	[c=4 l=4]  *movqi_internal/8
+	jmp	.L1100	# 17127	[c=1 l=5]  jump
+.L1210:
+	movq	104(%rbx), %r8	# 10081	[c=9 l=4]  *movdi_internal/3
+	orl	$63, %edi	# 14761	[c=4 l=3]  *iorsi_1/0
+	andb	(%r8), %al	# 10082	[c=9 l=3]  *andqi_1/1
+	movl	%eax, %r8d	# 13725	[c=4 l=3]  *movqi_internal/2
+	leaq	flag_update_table_sub8(%rip), %rax	# 10083	[c=1 l=7]  *movdi_internal/4
+	orb	(%rax,%rdx), %r8b	# 10087	[c=13 l=4]  *iorqi_1/1
+	leaq	101(%rbx), %rdx	# 14762	[c=4 l=4]  *leadi
+	movb	%r8b, 101(%rbx)	# 10088	[c=4 l=4]  *movqi_internal/8
+	movq	%rdx, %r8	# 11661	[c=4 l=3]  *movdi_internal/3
+	jmp	.L1211	# 17129	[c=1 l=5]  jump
+.L1558:
+	movzbl	%r8b, %edx	# 4512	[c=4 l=4]  *zero_extendqisi2/0
+	movl	$93, %esi	# 4514	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 4515	[c=4 l=3]  *movdi_internal/3
+	movl	%r8d, 16(%rsp)	# 14181	[c=4 l=5]  *movsi_internal/1
+	call	data_write_mapped	# 4516	[c=0 l=5]  *call
+	movl	16(%rsp), %r8d	# 14182	[c=9 l=5]  *movsi_internal/0
+	leaq	flag_update_table_add8(%rip), %r10	# 14184	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_sub8(%rip), %r11	# 14186	[c=1 l=7]  *movdi_internal/4
+	jmp	.L871	# 17131	[c=1 l=5]  jump
+.L1559:
+	movzbl	%al, %edx	# 4536	[c=4 l=3]  *zero_extendqisi2/0
+	movl	$94, %esi	# 4538	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 4539	[c=4 l=3]  *movdi_internal/3
+	call	data_write_mapped	# 4540	[c=0 l=5]  *call
+	leaq	flag_update_table_add8(%rip), %r10	# 14188	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_sub8(%rip), %r11	# 14190	[c=1 l=7]  *movdi_internal/4
+	jmp	.L873	# 17133	[c=1 l=5]  jump
+.L1233:
+	cmpb	$0, 48(%r13)	# 10533	[c=13 l=5]  *cmpqi_ccno_1/1
+	jne	.L1234	# 10534	[c=13 l=6]  *jcc
+	leaq	112(%rsp), %r14	# 14737	[c=4 l=5]  *leadi
+	movq	%r14, 24(%rsp)	# 14582	[c=4 l=5]  *movdi_internal/5
+	movq	%r14, %rdi	# 10538	[c=4 l=3]  *movdi_internal/3
+	call	*8(%r13)	# 10539	[c=18 l=4]  *call_value
+	leaq	flag_update_table_add8(%rip), %r10	# 14584	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_sub8(%rip), %r11	# 14586	[c=1 l=7]  *movdi_internal/4
+	testb	%al, %al	# 10541	[c=4 l=2]  *cmpqi_ccno_1/0
+	je	.L1234	# 10542	[c=13 l=6]  *jcc
+	cmpl	$0, 600(%rbx)	# 10544	[c=13 l=7]  *cmpsi_ccno_1/1
+	jne	.L1235	# 10545	[c=13 l=6]  *jcc
+	leaq	100(%rsp), %rcx	# 14735	[c=4 l=5]  *leadi
+	leaq	96(%rsp), %rdx	# 14736	[c=4 l=5]  *leadi
+	movq	%r14, %rsi	# 10552	[c=4 l=3]  *movdi_internal/3
+	movq	%r13, %rdi	# 10553	[c=4 l=3]  *movdi_internal/3
+	call	hle_cost@PLT	# 10554	[c=10 l=5]  *call_value
+	leaq	flag_update_table_add8(%rip), %r10	# 14578	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_sub8(%rip), %r11	# 14580	[c=1 l=7]  *movdi_internal/4
+	testb	%al, %al	# 10556	[c=4 l=2]  *cmpqi_ccno_1/0
+	je	.L1235	# 10557	[c=13 l=6]  *jcc
+	movq	(%rsp), %rdi	# 14576	[c=5 l=4]  *movdi_internal/3
+	testq	%rdi, %rdi	# 10559	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L1236	# 10560	[c=13 l=2]  *jcc
+	movl	96(%rsp), %eax	# 10562	[c=10 l=4]  *zero_extendsidi2/3
+	movzbl	11(%r15), %edx	# 10564	[c=13 l=5]  zero_extendqidi2/0
+	addq	%rbp, %rax	# 10563	[c=4 l=3]  *adddi_1/0
+	subq	%rdx, %rax	# 10565	[c=4 l=3]  *subdi_1/0
+	cmpq	%rdi, %rax	# 10566	[c=4 l=3]  *cmpdi_1/0
+	jnb	.L1235	# 10567	[c=13 l=6]  *jcc
+.L1236:
+	movzwl	14(%r15), %edx	# 10573	[c=13 l=5]  zero_extendhidi2/0
+	movl	100(%rsp), %eax	# 10570	[c=10 l=4]  *zero_extendsidi2/3
+	addq	48(%rbx), %rax	# 10572	[c=13 l=4]  *adddi_1/1
+	subq	%rdx, %rax	# 10574	[c=4 l=3]  *subdi_1/0
+	cmpq	56(%rbx), %rax	# 10575	[c=13 l=4]  *cmpdi_1/1
+	jnb	.L1235	# 10576	[c=13 l=6]  *jcc
+	movq	24(%rsp), %rdi	# 10580	[c=9 l=5]  *movdi_internal/3
+	call	*16(%r13)	# 10581	[c=0 l=4]  *call
+	movq	1040(%rbx), %rax	# 10583	[c=9 l=7]  *movdi_internal/3
+	addl	$1, 108(%r13)	# 10582	[c=13 l=5]  *addsi_1/0
+	leaq	flag_update_table_add8(%rip), %r10	# 14589	[c=1 l=7]  *movdi_internal/4
+	movzbl	136(%rsp), %edx	# 10584	[c=9 l=8]  *movqi_internal/4
+	movl	96(%rsp), %r13d	# 10587	[c=10 l=5]  *zero_extendsidi2/3
+	leaq	flag_update_table_sub8(%rip), %r11	# 14591	[c=1 l=7]  *movdi_internal/4
+	movb	%dl, 95(%rax)	# 10585	[c=4 l=3]  *movqi_internal/8
+	addq	%rbp, %r13	# 10588	[c=4 l=3]  *adddi_1/0
+	movl	152(%rsp), %ebp	# 10599	[c=9 l=7]  *movsi_internal/0
+	movb	$0, 100(%rbx)	# 10586	[c=4 l=4]  *movqi_internal/8
+	movzbl	11(%r15), %eax	# 10589	[c=13 l=5]  zero_extendqidi2/0
+	movzwl	14(%r15), %edx	# 10595	[c=13 l=5]  zero_extendhidi2/0
+	movl	$2, 96(%rbx)	# 10598	[c=4 l=7]  *movsi_internal/1
+	subq	%rax, %r13	# 10590	[c=4 l=3]  *subdi_1/0
+	movl	100(%rsp), %eax	# 10592	[c=10 l=4]  *zero_extendsidi2/3
+	movq	%r13, 16(%rsp)	# 14587	[c=4 l=5]  *movdi_internal/5
+	subq	%rdx, %rax	# 10596	[c=4 l=3]  *subdi_1/0
+	addq	%rax, 48(%rbx)	# 10597	[c=13 l=4]  *adddi_1/0
+	cmpl	$-1, %ebp	# 10600	[c=4 l=3]  *cmpsi_1/0
+	movq	%r13, 40(%rbx)	# 10591	[c=4 l=4]  *movdi_internal/5
+	je	.L1617	# 10601	[c=13 l=6]  *jcc
+.L1237:
+	movl	%ebp, (%rbx)	# 10795	[c=4 l=2]  *movsi_internal/1
+	movq	56(%rbx), %rax	# 13805	[c=9 l=4]  *movdi_internal/3
+	cmpq	%rax, 48(%rbx)	# 10797	[c=13 l=4]  *cmpdi_1/0
+	jnb	.L1618	# 10798	[c=13 l=6]  *jcc
+.L1258:
+	movl	(%rbx), %r15d	# 10805	[c=6 l=3]  *zero_extendsidi2/3
+	movl	$1, 96(%rbx)	# 10810	[c=4 l=7]  *movsi_internal/1
+	movq	%r10, %rcx	# 15836	[c=4 l=3]  *movdi_internal/3
+	movq	16(%rsp), %rax	# 13806	[c=9 l=5]  *movdi_internal/3
+	movq	%r15, %rdx	# 15530	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r15	# 10807	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %r15	# 10809	[c=13 l=7]  *adddi_1/1
+	movzbl	11(%r15), %ebp	# 10811	[c=13 l=5]  zero_extendqidi2/0
+	movq	(%r15), %r14	# 10819	[c=5 l=3]  *movdi_internal/3
+	addq	%rax, %rbp	# 10812	[c=4 l=3]  *adddi_1/0
+	movzwl	14(%r15), %eax	# 10814	[c=13 l=5]  zero_extendhidi2/0
+	addq	%rax, 48(%rbx)	# 10815	[c=13 l=4]  *adddi_1/0
+	movq	%rbp, 40(%rbx)	# 10813	[c=4 l=4]  *movdi_internal/5
+	movzbl	9(%r15), %eax	# 10816	[c=13 l=5]  *zero_extendqisi2/0
+	addl	%edx, %eax	# 10817	[c=4 l=2]  *addsi_1/0
+	movq	%r12, %rdx	# 15837	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%rbx)	# 10818	[c=4 l=2]  *movsi_internal/1
+	movq	%r11, %rax	# 15838	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 15839	[c=4 l=3]  *indirect_jump
+.L1218:
+	leal	0(,%rsi,8), %ecx	# 14748	[c=12 l=7]  *leasi
+	movl	$1, %edi	# 10290	[c=4 l=5]  *movdi_internal/2
+	salq	%cl, %rdi	# 10291	[c=4 l=3]  *ashldi3_1/0
+	xorl	%ecx, %ecx	# 16763	[c=4 l=2]  *movdi_xor
+	subq	$1, %rdi	# 10292	[c=4 l=4]  *adddi_1/0
+	jmp	.L1221	# 17137	[c=1 l=5]  jump
+.L1607:
+	subq	$2, %rax	# 10325	[c=4 l=4]  *adddi_1/0
+	subq	%rdx, %rax	# 10326	[c=4 l=3]  *subdi_1/0
+	movzwl	14(%r15), %edx	# 10328	[c=13 l=5]  zero_extendhidi2/0
+	leaq	1(%rdx), %r8	# 10329	[c=4 l=4]  *leadi
+	xorl	%edx, %edx	# 16759	[c=4 l=2]  *movdi_xor
+	divq	%r8	# 14742	[c=0 l=3]  *udivmoddi4_noext
+	leaq	1(%rax), %r8	# 14743	[c=4 l=4]  *leadi
+	jmp	.L1225	# 17139	[c=1 l=5]  jump
+.L1613:
+	movzbl	%al, %edx	# 1502	[c=4 l=3]  *zero_extendqisi2/0
+	movl	$94, %esi	# 1504	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 1505	[c=4 l=3]  *movdi_internal/3
+	call	data_write_mapped	# 1506	[c=0 l=5]  *call
+	leaq	flag_update_table_add8(%rip), %r10	# 13930	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_sub8(%rip), %r11	# 13932	[c=1 l=7]  *movdi_internal/4
+	jmp	.L650	# 17141	[c=1 l=5]  jump
+.L1612:
+	movzbl	%r15b, %edx	# 1478	[c=4 l=4]  *zero_extendqisi2/0
+	movl	$93, %esi	# 1480	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 1481	[c=4 l=3]  *movdi_internal/3
+	call	data_write_mapped	# 1482	[c=0 l=5]  *call
+	leaq	flag_update_table_add8(%rip), %r10	# 13926	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_sub8(%rip), %r11	# 13928	[c=1 l=7]  *movdi_internal/4
+	jmp	.L648	# 17143	[c=1 l=5]  jump
+.L1569:
+	movzbl	%al, %edx	# 2217	[c=4 l=3]  *zero_extendqisi2/0
+	movl	$94, %esi	# 2219	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 2220	[c=4 l=3]  *movdi_internal/3
+	call	data_write_mapped	# 2221	[c=0 l=5]  *call
+	leaq	flag_update_table_add8(%rip), %r10	# 13984	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_sub8(%rip), %r11	# 13986	[c=1 l=7]  *movdi_internal/4
+	jmp	.L701	# 17145	[c=1 l=5]  jump
+.L1568:
+	movzbl	%r13b, %edx	# 2193	[c=4 l=4]  *zero_extendqisi2/0
+	movl	$93, %esi	# 2195	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 2196	[c=4 l=3]  *movdi_internal/3
+	call	data_write_mapped	# 2197	[c=0 l=5]  *call
+	leaq	flag_update_table_add8(%rip), %r10	# 13980	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_sub8(%rip), %r11	# 13982	[c=1 l=7]  *movdi_internal/4
+	jmp	.L699	# 17147	[c=1 l=5]  jump
+.L1575:
+	movzbl	%al, %edx	# 3127	[c=4 l=3]  *zero_extendqisi2/0
+	movl	$94, %esi	# 3129	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 3130	[c=4 l=3]  *movdi_internal/3
+	call	data_write_mapped	# 3131	[c=0 l=5]  *call
+	leaq	flag_update_table_add8(%rip), %r10	# 14084	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_sub8(%rip), %r11	# 14086	[c=1 l=7]  *movdi_internal/4
+	jmp	.L773	# 17149	[c=1 l=5]  jump
+.L1574:
+	movzbl	%r13b, %edx	# 3103	[c=4 l=4]  *zero_extendqisi2/0
+	movl	$93, %esi	# 3105	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 3106	[c=4 l=3]  *movdi_internal/3
+	call	data_write_mapped	# 3107	[c=0 l=5]  *call
+	leaq	flag_update_table_add8(%rip), %r10	# 14080	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_sub8(%rip), %r11	# 14082	[c=1 l=7]  *movdi_internal/4
+	jmp	.L771	# 17151	[c=1 l=5]  jump
+.L1581:
+	movzbl	%al, %edx	# 4751	[c=4 l=3]  *zero_extendqisi2/0
+	movl	$94, %esi	# 4753	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 4754	[c=4 l=3]  *movdi_internal/3
+	call	data_write_mapped	# 4755	[c=0 l=5]  *call
+	leaq	flag_update_table_add8(%rip), %r10	# 14224	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_sub8(%rip), %r11	# 14226	[c=1 l=7]  *movdi_internal/4
+	jmp	.L894	# 17153	[c=1 l=5]  jump
+.L1580:
+	movzbl	%r14b, %edx	# 4727	[c=4 l=4]  *zero_extendqisi2/0
+	movl	$93, %esi	# 4729	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 4730	[c=4 l=3]  *movdi_internal/3
+	call	data_write_mapped	# 4731	[c=0 l=5]  *call
+	leaq	flag_update_table_add8(%rip), %r10	# 14220	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_sub8(%rip), %r11	# 14222	[c=1 l=7]  *movdi_internal/4
+	jmp	.L892	# 17155	[c=1 l=5]  jump
+.L1589:
+	movzbl	%r13b, %edx	# 5215	[c=4 l=4]  *zero_extendqisi2/0
+	movl	$94, %esi	# 5217	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 5218	[c=4 l=3]  *movdi_internal/3
+	call	data_write_mapped	# 5219	[c=0 l=5]  *call
+	leaq	flag_update_table_add8(%rip), %r10	# 14296	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_sub8(%rip), %r11	# 14298	[c=1 l=7]  *movdi_internal/4
+	jmp	.L938	# 17157	[c=1 l=5]  jump
+.L1588:
+	movzbl	%r13b, %edx	# 5191	[c=4 l=4]  *zero_extendqisi2/0
+	movl	$93, %esi	# 5193	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 5194	[c=4 l=3]  *movdi_internal/3
+	call	data_write_mapped	# 5195	[c=0 l=5]  *call
+	leaq	flag_update_table_add8(%rip), %r10	# 14292	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_sub8(%rip), %r11	# 14294	[c=1 l=7]  *movdi_internal/4
+	jmp	.L936	# 17159	[c=1 l=5]  jump
+.L1585:
+	movzbl	%r13b, %edx	# 4986	[c=4 l=4]  *zero_extendqisi2/0
+	movl	$94, %esi	# 4988	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 4989	[c=4 l=3]  *movdi_internal/3
+	call	data_write_mapped	# 4990	[c=0 l=5]  *call
+	leaq	flag_update_table_add8(%rip), %r10	# 14260	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_sub8(%rip), %r11	# 14262	[c=1 l=7]  *movdi_internal/4
+	jmp	.L916	# 17161	[c=1 l=5]  jump
+.L1584:
+	movzbl	%r13b, %edx	# 4962	[c=4 l=4]  *zero_extendqisi2/0
+	movl	$93, %esi	# 4964	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 4965	[c=4 l=3]  *movdi_internal/3
+	call	data_write_mapped	# 4966	[c=0 l=5]  *call
+	leaq	flag_update_table_add8(%rip), %r10	# 14256	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_sub8(%rip), %r11	# 14258	[c=1 l=7]  *movdi_internal/4
+	jmp	.L914	# 17163	[c=1 l=5]  jump
+.L1556:
+	movzbl	%al, %edx	# 9484	[c=4 l=3]  *zero_extendqisi2/0
+	movl	$94, %esi	# 9486	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 9487	[c=4 l=3]  *movdi_internal/3
+	call	data_write_mapped	# 9488	[c=0 l=5]  *call
+	leaq	flag_update_table_add8(%rip), %r10	# 14494	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_sub8(%rip), %r11	# 14496	[c=1 l=7]  *movdi_internal/4
+	jmp	.L1168	# 17165	[c=1 l=5]  jump
+.L1555:
+	movzbl	%al, %edx	# 9460	[c=4 l=3]  *zero_extendqisi2/0
+	movl	$93, %esi	# 9462	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 9463	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, 16(%rsp)	# 14487	[c=4 l=4]  *movsi_internal/1
+	call	data_write_mapped	# 9464	[c=0 l=5]  *call
+	movl	16(%rsp), %eax	# 14488	[c=9 l=4]  *movsi_internal/0
+	leaq	flag_update_table_add8(%rip), %r10	# 14490	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_sub8(%rip), %r11	# 14492	[c=1 l=7]  *movdi_internal/4
+	jmp	.L1166	# 17167	[c=1 l=5]  jump
+.L1606:
+	leaq	-1(%rdx), %rax	# 14745	[c=4 l=4]  *leadi
+	movzbl	11(%r15), %r8d	# 10308	[c=13 l=5]  zero_extendqidi2/0
+	xorl	%edx, %edx	# 16761	[c=4 l=2]  *movdi_xor
+	subq	%rbp, %rax	# 10307	[c=4 l=3]  *subdi_1/0
+	divq	%r8	# 14747	[c=0 l=3]  *udivmoddi4_noext
+	addq	$1, %rax	# 10310	[c=4 l=4]  *adddi_1/0
+	jmp	.L1223	# 17169	[c=1 l=5]  jump
+.L1208:
+	movzbl	%dil, %edx	# 10031	[c=4 l=4]  *zero_extendqisi2/0
+	movl	%r13d, %esi	# 10033	[c=4 l=3]  *movsi_internal/0
+	movq	%rbx, %rdi	# 10034	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 10035	[c=0 l=5]  *call
+	leaq	flag_update_table_sub8(%rip), %r11	# 14540	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 14538	[c=1 l=7]  *movdi_internal/4
+	jmp	.L1209	# 17171	[c=1 l=5]  jump
+.L1184:
+	movl	%r13d, %esi	# 9688	[c=4 l=3]  *movsi_internal/0
+	movq	%rbx, %rdi	# 9689	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 9690	[c=10 l=5]  *call_value
+	leaq	flag_update_table_sub8(%rip), %r11	# 14516	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 14514	[c=1 l=7]  *movdi_internal/4
+	movl	%eax, %ecx	# 9691	[c=4 l=2]  *movsi_internal/0
+	movq	1040(%rbx), %rax	# 11493	[c=9 l=7]  *movdi_internal/3
+	jmp	.L1185	# 17173	[c=1 l=5]  jump
+.L1180:
+	movl	%r13d, %esi	# 9641	[c=4 l=3]  *movsi_internal/0
+	movq	%rbx, %rdi	# 9642	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 9643	[c=10 l=5]  *call_value
+	leaq	flag_update_table_sub8(%rip), %r11	# 14512	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 14510	[c=1 l=7]  *movdi_internal/4
+	movl	%eax, %ecx	# 9644	[c=4 l=2]  *movsi_internal/0
+	movq	1040(%rbx), %rax	# 11492	[c=9 l=7]  *movdi_internal/3
+	jmp	.L1181	# 17175	[c=1 l=5]  jump
+.L1176:
+	movl	%r13d, %esi	# 9594	[c=4 l=3]  *movsi_internal/0
+	movq	%rbx, %rdi	# 9595	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 9596	[c=10 l=5]  *call_value
+	leaq	flag_update_table_sub8(%rip), %r11	# 14508	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 14506	[c=1 l=7]  *movdi_internal/4
+	movl	%eax, %ecx	# 9597	[c=4 l=2]  *movsi_internal/0
+	movq	1040(%rbx), %rax	# 11491	[c=9 l=7]  *movdi_internal/3
+	jmp	.L1177	# 17177	[c=1 l=5]  jump
+.L1172:
+	movl	%r13d, %esi	# 9547	[c=4 l=3]  *movsi_internal/0
+	movq	%rbx, %rdi	# 9548	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 9549	[c=10 l=5]  *call_value
+	leaq	flag_update_table_sub8(%rip), %r11	# 14504	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 14502	[c=1 l=7]  *movdi_internal/4
+	movl	%eax, %ecx	# 9550	[c=4 l=2]  *movsi_internal/0
+	movq	1040(%rbx), %rax	# 11490	[c=9 l=7]  *movdi_internal/3
+	jmp	.L1173	# 17179	[c=1 l=5]  jump
+.L1030:
+	movzbl	%dil, %edx	# 6536	[c=4 l=4]  *zero_extendqisi2/0
+	movq	%rbx, %rdi	# 6539	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 6540	[c=0 l=5]  *call
+	leaq	flag_update_table_sub8(%rip), %r11	# 14422	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 14420	[c=1 l=7]  *movdi_internal/4
+	jmp	.L1031	# 17181	[c=1 l=5]  jump
+.L1034:
+	movzbl	%sil, %edx	# 6578	[c=4 l=4]  *zero_extendqisi2/0
+	movq	%rbx, %rdi	# 6581	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, %esi	# 6580	[c=4 l=2]  *movsi_internal/0
+	movl	%eax, 16(%rsp)	# 14423	[c=4 l=4]  *movsi_internal/1
+	call	data_write_page	# 6582	[c=0 l=5]  *call
+	movl	16(%rsp), %eax	# 14424	[c=9 l=4]  *movsi_internal/0
+	leaq	flag_update_table_sub8(%rip), %r11	# 14428	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 14426	[c=1 l=7]  *movdi_internal/4
+	jmp	.L1035	# 17183	[c=1 l=5]  jump
+.L1163:
+	movzbl	%cl, %edx	# 9443	[c=4 l=3]  *zero_extendqisi2/0
+	movq	%rbx, %rdi	# 9446	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, 16(%rsp)	# 14481	[c=4 l=4]  *movsi_internal/1
+	call	data_write_page	# 9447	[c=0 l=5]  *call
+	movl	16(%rsp), %eax	# 14482	[c=9 l=4]  *movsi_internal/0
+	leaq	flag_update_table_sub8(%rip), %r11	# 14486	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 14484	[c=1 l=7]  *movdi_internal/4
+	jmp	.L1164	# 17185	[c=1 l=5]  jump
+.L1018:
+	movzbl	%cl, %edx	# 6410	[c=4 l=3]  *zero_extendqisi2/0
+	movq	%rbx, %rdi	# 6413	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 6414	[c=0 l=5]  *call
+	leaq	flag_update_table_sub8(%rip), %r11	# 14410	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 14408	[c=1 l=7]  *movdi_internal/4
+	jmp	.L1019	# 17187	[c=1 l=5]  jump
+.L703:
+	movl	$92, %esi	# 2246	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 2247	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 2248	[c=10 l=5]  *call_value
+	leaq	flag_update_table_sub8(%rip), %r11	# 13990	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 13988	[c=1 l=7]  *movdi_internal/4
+	movl	%eax, %esi	# 2249	[c=4 l=2]  *movsi_internal/0
+	jmp	.L704	# 17189	[c=1 l=5]  jump
+.L932:
+	movl	%r13d, %esi	# 5165	[c=4 l=3]  *movsi_internal/0
+	movq	%rbx, %rdi	# 5166	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 5167	[c=10 l=5]  *call_value
+	leaq	flag_update_table_sub8(%rip), %r11	# 14290	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 14288	[c=1 l=7]  *movdi_internal/4
+	movl	%eax, %r14d	# 5168	[c=4 l=3]  *movsi_internal/0
+	jmp	.L933	# 17191	[c=1 l=5]  jump
+.L929:
+	movq	%rbx, %rdi	# 5139	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 5140	[c=10 l=5]  *call_value
+	leaq	flag_update_table_sub8(%rip), %r11	# 14286	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 14284	[c=1 l=7]  *movdi_internal/4
+	jmp	.L930	# 17193	[c=1 l=5]  jump
+.L1014:
+	movzbl	%cl, %edx	# 6368	[c=4 l=3]  *zero_extendqisi2/0
+	movq	%rbx, %rdi	# 6371	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 6372	[c=0 l=5]  *call
+	leaq	flag_update_table_sub8(%rip), %r11	# 14406	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 14404	[c=1 l=7]  *movdi_internal/4
+	jmp	.L1015	# 17195	[c=1 l=5]  jump
+.L965:
+	movq	%rbx, %rdi	# 5696	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 5697	[c=10 l=5]  *call_value
+	leaq	flag_update_table_sub8(%rip), %r11	# 14328	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 14326	[c=1 l=7]  *movdi_internal/4
+	jmp	.L966	# 17197	[c=1 l=5]  jump
+.L955:
+	movl	%r13d, %esi	# 5582	[c=4 l=3]  *movsi_internal/0
+	movq	%rbx, %rdi	# 5583	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 5584	[c=0 l=5]  *call
+	leaq	flag_update_table_sub8(%rip), %r11	# 14316	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 14314	[c=1 l=7]  *movdi_internal/4
+	jmp	.L956	# 17199	[c=1 l=5]  jump
+.L950:
+	movl	%r13d, %esi	# 5545	[c=4 l=3]  *movsi_internal/0
+	movq	%rbx, %rdi	# 5546	[c=4 l=3]  *movdi_internal/3
+	movl	%edx, 16(%rsp)	# 14307	[c=4 l=4]  *movsi_internal/1
+	call	data_read_page	# 5547	[c=10 l=5]  *call_value
+	movl	16(%rsp), %edx	# 14308	[c=9 l=4]  *movsi_internal/0
+	leaq	flag_update_table_sub8(%rip), %r11	# 14312	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 14310	[c=1 l=7]  *movdi_internal/4
+	jmp	.L951	# 17201	[c=1 l=5]  jump
+.L1050:
+	movzbl	%sil, %edx	# 6768	[c=4 l=4]  *zero_extendqisi2/0
+	movq	%rbx, %rdi	# 6771	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, %esi	# 6770	[c=4 l=2]  *movsi_internal/0
+	movl	%eax, 16(%rsp)	# 14443	[c=4 l=4]  *movsi_internal/1
+	call	data_write_page	# 6772	[c=0 l=5]  *call
+	movl	16(%rsp), %eax	# 14444	[c=9 l=4]  *movsi_internal/0
+	leaq	flag_update_table_sub8(%rip), %r11	# 14448	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 14446	[c=1 l=7]  *movdi_internal/4
+	jmp	.L1051	# 17203	[c=1 l=5]  jump
+.L885:
+	movl	%esi, %edx	# 4677	[c=4 l=2]  *movsi_internal/0
+	movq	%rbx, %rdi	# 4679	[c=4 l=3]  *movdi_internal/3
+	movl	%ecx, %esi	# 4678	[c=4 l=2]  *movsi_internal/0
+	movl	%eax, 16(%rsp)	# 14209	[c=4 l=4]  *movsi_internal/1
+	call	data_write_page	# 4680	[c=0 l=5]  *call
+	movl	16(%rsp), %eax	# 14210	[c=9 l=4]  *movsi_internal/0
+	leaq	flag_update_table_sub8(%rip), %r11	# 14214	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 14212	[c=1 l=7]  *movdi_internal/4
+	jmp	.L886	# 17205	[c=1 l=5]  jump
+.L882:
+	movl	%esi, %edx	# 4650	[c=4 l=2]  *movsi_internal/0
+	movq	%rbx, %rdi	# 4652	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, %esi	# 4651	[c=4 l=2]  *movsi_internal/0
+	movl	%ecx, 24(%rsp)	# 14203	[c=4 l=4]  *movsi_internal/1
+	movl	%eax, 16(%rsp)	# 14201	[c=4 l=4]  *movsi_internal/1
+	call	data_write_page	# 4653	[c=0 l=5]  *call
+	movl	24(%rsp), %ecx	# 14204	[c=9 l=4]  *movsi_internal/0
+	movl	16(%rsp), %eax	# 14202	[c=9 l=4]  *movsi_internal/0
+	leaq	flag_update_table_sub8(%rip), %r11	# 14208	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 14206	[c=1 l=7]  *movdi_internal/4
+	jmp	.L883	# 17207	[c=1 l=5]  jump
+.L720:
+	movl	$91, %esi	# 2448	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 2449	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 2450	[c=10 l=5]  *call_value
+	leaq	flag_update_table_sub8(%rip), %r11	# 14010	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 14008	[c=1 l=7]  *movdi_internal/4
+	movl	%eax, %edx	# 2451	[c=4 l=2]  *movsi_internal/0
+	movq	1040(%rbx), %rax	# 11461	[c=9 l=7]  *movdi_internal/3
+	jmp	.L721	# 17209	[c=1 l=5]  jump
+.L727:
+	movl	$91, %esi	# 2538	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 2539	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 2540	[c=0 l=5]  *call
+	leaq	flag_update_table_sub8(%rip), %r11	# 14018	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 14016	[c=1 l=7]  *movdi_internal/4
+	jmp	.L728	# 17211	[c=1 l=5]  jump
+.L724:
+	movl	$91, %esi	# 2496	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 2497	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 2498	[c=10 l=5]  *call_value
+	leaq	flag_update_table_sub8(%rip), %r11	# 14014	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 14012	[c=1 l=7]  *movdi_internal/4
+	movl	%eax, %edx	# 2499	[c=4 l=2]  *movsi_internal/0
+	movq	1040(%rbx), %rax	# 11462	[c=9 l=7]  *movdi_internal/3
+	jmp	.L725	# 17213	[c=1 l=5]  jump
+.L716:
+	movl	$91, %esi	# 2401	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 2402	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 2403	[c=10 l=5]  *call_value
+	leaq	flag_update_table_sub8(%rip), %r11	# 14006	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 14004	[c=1 l=7]  *movdi_internal/4
+	movl	%eax, %edx	# 2404	[c=4 l=2]  *movsi_internal/0
+	movq	1040(%rbx), %rax	# 11460	[c=9 l=7]  *movdi_internal/3
+	jmp	.L717	# 17215	[c=1 l=5]  jump
+.L804:
+	movq	%rbx, %rdi	# 3539	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 3540	[c=10 l=5]  *call_value
+	leaq	flag_update_table_sub8(%rip), %r11	# 14118	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 14116	[c=1 l=7]  *movdi_internal/4
+	movl	%eax, %ecx	# 3541	[c=4 l=2]  *movsi_internal/0
+	movq	1040(%rbx), %rax	# 11469	[c=9 l=7]  *movdi_internal/3
+	jmp	.L805	# 17217	[c=1 l=5]  jump
+.L641:
+	movl	%esi, %edx	# 1428	[c=4 l=2]  *movsi_internal/0
+	movq	%rbx, %rdi	# 1430	[c=4 l=3]  *movdi_internal/3
+	movl	%ecx, %esi	# 1429	[c=4 l=2]  *movsi_internal/0
+	movl	%eax, 16(%rsp)	# 13913	[c=4 l=4]  *movsi_internal/1
+	call	data_write_page	# 1431	[c=0 l=5]  *call
+	movl	16(%rsp), %eax	# 13914	[c=9 l=4]  *movsi_internal/0
+	leaq	flag_update_table_sub8(%rip), %r11	# 13918	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 13916	[c=1 l=7]  *movdi_internal/4
+	jmp	.L642	# 17219	[c=1 l=5]  jump
+.L638:
+	movl	%esi, %edx	# 1401	[c=4 l=2]  *movsi_internal/0
+	movq	%rbx, %rdi	# 1403	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, %esi	# 1402	[c=4 l=2]  *movsi_internal/0
+	movl	%ecx, 24(%rsp)	# 13907	[c=4 l=4]  *movsi_internal/1
+	movl	%eax, 16(%rsp)	# 13905	[c=4 l=4]  *movsi_internal/1
+	call	data_write_page	# 1404	[c=0 l=5]  *call
+	movl	24(%rsp), %ecx	# 13908	[c=9 l=4]  *movsi_internal/0
+	movl	16(%rsp), %eax	# 13906	[c=9 l=4]  *movsi_internal/0
+	leaq	flag_update_table_sub8(%rip), %r11	# 13912	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 13910	[c=1 l=7]  *movdi_internal/4
+	jmp	.L639	# 17221	[c=1 l=5]  jump
+.L910:
+	movl	%r13d, %esi	# 4936	[c=4 l=3]  *movsi_internal/0
+	movq	%rbx, %rdi	# 4937	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 4938	[c=10 l=5]  *call_value
+	leaq	flag_update_table_sub8(%rip), %r11	# 14254	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 14252	[c=1 l=7]  *movdi_internal/4
+	movl	%eax, %r14d	# 4939	[c=4 l=3]  *movsi_internal/0
+	jmp	.L911	# 17223	[c=1 l=5]  jump
+.L907:
+	movq	%rbx, %rdi	# 4910	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 4911	[c=10 l=5]  *call_value
+	leaq	flag_update_table_sub8(%rip), %r11	# 14250	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 14248	[c=1 l=7]  *movdi_internal/4
+	jmp	.L908	# 17225	[c=1 l=5]  jump
+.L660:
+	movl	%ecx, %edx	# 1620	[c=4 l=2]  *movsi_internal/0
+	movl	%r13d, %esi	# 1621	[c=4 l=3]  *movsi_internal/0
+	movq	%rbx, %rdi	# 1622	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 1623	[c=0 l=5]  *call
+	leaq	flag_update_table_sub8(%rip), %r11	# 13946	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 13944	[c=1 l=7]  *movdi_internal/4
+	jmp	.L661	# 17227	[c=1 l=5]  jump
+.L655:
+	movl	%r13d, %esi	# 1583	[c=4 l=3]  *movsi_internal/0
+	movq	%rbx, %rdi	# 1584	[c=4 l=3]  *movdi_internal/3
+	movl	%edx, 16(%rsp)	# 13937	[c=4 l=4]  *movsi_internal/1
+	call	data_read_page	# 1585	[c=10 l=5]  *call_value
+	movl	16(%rsp), %edx	# 13938	[c=9 l=4]  *movsi_internal/0
+	leaq	flag_update_table_sub8(%rip), %r11	# 13942	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 13940	[c=1 l=7]  *movdi_internal/4
+	movl	%eax, %esi	# 1586	[c=4 l=2]  *movsi_internal/0
+	jmp	.L656	# 17229	[c=1 l=5]  jump
+.L1042:
+	movzbl	%sil, %edx	# 6673	[c=4 l=4]  *zero_extendqisi2/0
+	movq	%rbx, %rdi	# 6676	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, %esi	# 6675	[c=4 l=2]  *movsi_internal/0
+	movl	%eax, 16(%rsp)	# 14433	[c=4 l=4]  *movsi_internal/1
+	call	data_write_page	# 6677	[c=0 l=5]  *call
+	movl	16(%rsp), %eax	# 14434	[c=9 l=4]  *movsi_internal/0
+	leaq	flag_update_table_sub8(%rip), %r11	# 14438	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 14436	[c=1 l=7]  *movdi_internal/4
+	jmp	.L1043	# 17231	[c=1 l=5]  jump
+.L857:
+	movzbl	%dil, %edx	# 4374	[c=4 l=4]  *zero_extendqisi2/0
+	movq	%rbx, %rdi	# 4377	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 4378	[c=0 l=5]  *call
+	leaq	flag_update_table_sub8(%rip), %r11	# 14156	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 14154	[c=1 l=7]  *movdi_internal/4
+	jmp	.L858	# 17233	[c=1 l=5]  jump
+.L1205:
+	movl	$91, %esi	# 9997	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 9998	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 9999	[c=0 l=5]  *call
+	leaq	flag_update_table_sub8(%rip), %r11	# 14536	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 14534	[c=1 l=7]  *movdi_internal/4
+	jmp	.L1206	# 17235	[c=1 l=5]  jump
+.L1202:
+	movl	$91, %esi	# 9955	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 9956	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 9957	[c=10 l=5]  *call_value
+	leaq	flag_update_table_sub8(%rip), %r11	# 14532	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 14530	[c=1 l=7]  *movdi_internal/4
+	movl	%eax, %edx	# 9958	[c=4 l=2]  *movsi_internal/0
+	movq	1040(%rbx), %rax	# 11496	[c=9 l=7]  *movdi_internal/3
+	jmp	.L1203	# 17237	[c=1 l=5]  jump
+.L1192:
+	movl	$91, %esi	# 9802	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 9803	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 9804	[c=0 l=5]  *call
+	leaq	flag_update_table_sub8(%rip), %r11	# 14524	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 14522	[c=1 l=7]  *movdi_internal/4
+	jmp	.L1406	# 17239	[c=1 l=5]  jump
+.L1189:
+	movl	$91, %esi	# 9760	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 9761	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 9762	[c=10 l=5]  *call_value
+	leaq	flag_update_table_sub8(%rip), %r11	# 14520	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 14518	[c=1 l=7]  *movdi_internal/4
+	movl	%eax, %edx	# 9763	[c=4 l=2]  *movsi_internal/0
+	movq	1040(%rbx), %rax	# 11494	[c=9 l=7]  *movdi_internal/3
+	jmp	.L1190	# 17241	[c=1 l=5]  jump
+.L1214:
+	movzbl	%sil, %edx	# 10126	[c=4 l=4]  *zero_extendqisi2/0
+	movq	%rbx, %rdi	# 10129	[c=4 l=3]  *movdi_internal/3
+	movl	%r13d, %esi	# 10128	[c=4 l=3]  *movsi_internal/0
+	call	data_write_page	# 10130	[c=0 l=5]  *call
+	leaq	flag_update_table_sub8(%rip), %r11	# 14544	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 14542	[c=1 l=7]  *movdi_internal/4
+	jmp	.L1215	# 17243	[c=1 l=5]  jump
+.L959:
+	movq	%rbx, %rdi	# 5623	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 5624	[c=10 l=5]  *call_value
+	leaq	flag_update_table_sub8(%rip), %r11	# 14320	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 14318	[c=1 l=7]  *movdi_internal/4
+	jmp	.L960	# 17245	[c=1 l=5]  jump
+.L820:
+	movl	%ecx, %esi	# 3721	[c=4 l=2]  *movsi_internal/0
+	movq	%rbx, %rdi	# 3722	[c=4 l=3]  *movdi_internal/3
+	movl	%ecx, 16(%rsp)	# 14133	[c=4 l=4]  *movsi_internal/1
+	call	data_read_page	# 3723	[c=10 l=5]  *call_value
+	movl	16(%rsp), %ecx	# 14134	[c=9 l=4]  *movsi_internal/0
+	leaq	flag_update_table_sub8(%rip), %r11	# 14138	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 14136	[c=1 l=7]  *movdi_internal/4
+	movl	%eax, %esi	# 3724	[c=4 l=2]  *movsi_internal/0
+	movq	1040(%rbx), %rax	# 11473	[c=9 l=7]  *movdi_internal/3
+	jmp	.L821	# 17247	[c=1 l=5]  jump
+.L816:
+	movl	%r13d, %esi	# 3672	[c=4 l=3]  *movsi_internal/0
+	movq	%rbx, %rdi	# 3673	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 3674	[c=10 l=5]  *call_value
+	leaq	flag_update_table_sub8(%rip), %r11	# 14132	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 14130	[c=1 l=7]  *movdi_internal/4
+	movl	%eax, %ecx	# 3675	[c=4 l=2]  *movsi_internal/0
+	movq	1040(%rbx), %rax	# 11472	[c=9 l=7]  *movdi_internal/3
+	jmp	.L817	# 17249	[c=1 l=5]  jump
+.L812:
+	movl	%ecx, %esi	# 3624	[c=4 l=2]  *movsi_internal/0
+	movq	%rbx, %rdi	# 3625	[c=4 l=3]  *movdi_internal/3
+	movl	%ecx, 16(%rsp)	# 14123	[c=4 l=4]  *movsi_internal/1
+	call	data_read_page	# 3626	[c=10 l=5]  *call_value
+	movl	16(%rsp), %ecx	# 14124	[c=9 l=4]  *movsi_internal/0
+	leaq	flag_update_table_sub8(%rip), %r11	# 14128	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 14126	[c=1 l=7]  *movdi_internal/4
+	movl	%eax, %esi	# 3627	[c=4 l=2]  *movsi_internal/0
+	movq	1040(%rbx), %rax	# 11471	[c=9 l=7]  *movdi_internal/3
+	jmp	.L813	# 17251	[c=1 l=5]  jump
+.L808:
+	movq	%rbx, %rdi	# 3582	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 3583	[c=10 l=5]  *call_value
+	leaq	flag_update_table_sub8(%rip), %r11	# 14122	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 14120	[c=1 l=7]  *movdi_internal/4
+	movl	%eax, %ecx	# 3584	[c=4 l=2]  *movsi_internal/0
+	movq	1040(%rbx), %rax	# 11470	[c=9 l=7]  *movdi_internal/3
+	jmp	.L809	# 17253	[c=1 l=5]  jump
+.L832:
+	movl	%r13d, %esi	# 3866	[c=4 l=3]  *movsi_internal/0
+	movq	%rbx, %rdi	# 3867	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 3868	[c=10 l=5]  *call_value
+	leaq	flag_update_table_sub8(%rip), %r11	# 14152	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 14150	[c=1 l=7]  *movdi_internal/4
+	movl	%eax, %ecx	# 3869	[c=4 l=2]  *movsi_internal/0
+	movq	1040(%rbx), %rax	# 11476	[c=9 l=7]  *movdi_internal/3
+	jmp	.L833	# 17255	[c=1 l=5]  jump
+.L828:
+	movl	%ecx, %esi	# 3818	[c=4 l=2]  *movsi_internal/0
+	movq	%rbx, %rdi	# 3819	[c=4 l=3]  *movdi_internal/3
+	movl	%ecx, 16(%rsp)	# 14143	[c=4 l=4]  *movsi_internal/1
+	call	data_read_page	# 3820	[c=10 l=5]  *call_value
+	movl	16(%rsp), %ecx	# 14144	[c=9 l=4]  *movsi_internal/0
+	leaq	flag_update_table_sub8(%rip), %r11	# 14148	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 14146	[c=1 l=7]  *movdi_internal/4
+	movl	%eax, %esi	# 3821	[c=4 l=2]  *movsi_internal/0
+	movq	1040(%rbx), %rax	# 11475	[c=9 l=7]  *movdi_internal/3
+	jmp	.L829	# 17257	[c=1 l=5]  jump
+.L824:
+	movl	%r13d, %esi	# 3769	[c=4 l=3]  *movsi_internal/0
+	movq	%rbx, %rdi	# 3770	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 3771	[c=10 l=5]  *call_value
+	leaq	flag_update_table_sub8(%rip), %r11	# 14142	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 14140	[c=1 l=7]  *movdi_internal/4
+	movl	%eax, %ecx	# 3772	[c=4 l=2]  *movsi_internal/0
+	movq	1040(%rbx), %rax	# 11474	[c=9 l=7]  *movdi_internal/3
+	jmp	.L825	# 17259	[c=1 l=5]  jump
+.L977:
+	movq	%rbx, %rdi	# 5842	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 5843	[c=10 l=5]  *call_value
+	leaq	flag_update_table_sub8(%rip), %r11	# 14344	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 14342	[c=1 l=7]  *movdi_internal/4
+	jmp	.L978	# 17261	[c=1 l=5]  jump
+.L971:
+	movq	%rbx, %rdi	# 5769	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 5770	[c=10 l=5]  *call_value
+	leaq	flag_update_table_sub8(%rip), %r11	# 14336	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 14334	[c=1 l=7]  *movdi_internal/4
+	jmp	.L972	# 17263	[c=1 l=5]  jump
+.L710:
+	movl	$92, %esi	# 2335	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 2336	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 2337	[c=10 l=5]  *call_value
+	leaq	flag_update_table_sub8(%rip), %r11	# 13998	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 13996	[c=1 l=7]  *movdi_internal/4
+	movl	%eax, %esi	# 2338	[c=4 l=2]  *movsi_internal/0
+	jmp	.L711	# 17265	[c=1 l=5]  jump
+.L764:
+	movl	%ecx, %edx	# 3053	[c=4 l=2]  *movsi_internal/0
+	movl	%eax, %esi	# 3054	[c=4 l=2]  *movsi_internal/0
+	movq	%rbx, %rdi	# 3055	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 3056	[c=0 l=5]  *call
+	leaq	flag_update_table_sub8(%rip), %r11	# 14074	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 14072	[c=1 l=7]  *movdi_internal/4
+	jmp	.L765	# 17267	[c=1 l=5]  jump
+.L761:
+	movl	%ecx, %edx	# 3026	[c=4 l=2]  *movsi_internal/0
+	movl	%r15d, %esi	# 3027	[c=4 l=3]  *movsi_internal/0
+	movq	%rbx, %rdi	# 3028	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, 16(%rsp)	# 14065	[c=4 l=4]  *movsi_internal/1
+	call	data_write_page	# 3029	[c=0 l=5]  *call
+	movl	16(%rsp), %eax	# 14066	[c=9 l=4]  *movsi_internal/0
+	leaq	flag_update_table_sub8(%rip), %r11	# 14070	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 14068	[c=1 l=7]  *movdi_internal/4
+	jmp	.L762	# 17269	[c=1 l=5]  jump
+.L1026:
+	movzbl	%dil, %edx	# 6494	[c=4 l=4]  *zero_extendqisi2/0
+	movq	%rbx, %rdi	# 6497	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 6498	[c=0 l=5]  *call
+	leaq	flag_update_table_sub8(%rip), %r11	# 14418	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 14416	[c=1 l=7]  *movdi_internal/4
+	jmp	.L1027	# 17271	[c=1 l=5]  jump
+.L1022:
+	movzbl	%dil, %edx	# 6452	[c=4 l=4]  *zero_extendqisi2/0
+	movq	%rbx, %rdi	# 6455	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 6456	[c=0 l=5]  *call
+	leaq	flag_update_table_sub8(%rip), %r11	# 14414	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 14412	[c=1 l=7]  *movdi_internal/4
+	jmp	.L1023	# 17273	[c=1 l=5]  jump
+.L692:
+	movl	%ecx, %edx	# 2143	[c=4 l=2]  *movsi_internal/0
+	movl	%eax, %esi	# 2144	[c=4 l=2]  *movsi_internal/0
+	movq	%rbx, %rdi	# 2145	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 2146	[c=0 l=5]  *call
+	leaq	flag_update_table_sub8(%rip), %r11	# 13974	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 13972	[c=1 l=7]  *movdi_internal/4
+	jmp	.L693	# 17275	[c=1 l=5]  jump
+.L689:
+	movl	%ecx, %edx	# 2116	[c=4 l=2]  *movsi_internal/0
+	movl	%r15d, %esi	# 2117	[c=4 l=3]  *movsi_internal/0
+	movq	%rbx, %rdi	# 2118	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, 16(%rsp)	# 13965	[c=4 l=4]  *movsi_internal/1
+	call	data_write_page	# 2119	[c=0 l=5]  *call
+	movl	16(%rsp), %eax	# 13966	[c=9 l=4]  *movsi_internal/0
+	leaq	flag_update_table_sub8(%rip), %r11	# 13970	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 13968	[c=1 l=7]  *movdi_internal/4
+	jmp	.L690	# 17277	[c=1 l=5]  jump
+.L800:
+	movq	%rbx, %rdi	# 3496	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 3497	[c=10 l=5]  *call_value
+	leaq	flag_update_table_sub8(%rip), %r11	# 14114	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 14112	[c=1 l=7]  *movdi_internal/4
+	movl	%eax, %ecx	# 3498	[c=4 l=2]  *movsi_internal/0
+	movq	1040(%rbx), %rax	# 11468	[c=9 l=7]  *movdi_internal/3
+	jmp	.L801	# 17279	[c=1 l=5]  jump
+.L796:
+	movq	%rbx, %rdi	# 3453	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 3454	[c=10 l=5]  *call_value
+	leaq	flag_update_table_sub8(%rip), %r11	# 14110	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 14108	[c=1 l=7]  *movdi_internal/4
+	movl	%eax, %edx	# 3455	[c=4 l=2]  *movsi_internal/0
+	movq	1040(%rbx), %rax	# 11467	[c=9 l=7]  *movdi_internal/3
+	jmp	.L797	# 17281	[c=1 l=5]  jump
+.L792:
+	movq	%rbx, %rdi	# 3410	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 3411	[c=10 l=5]  *call_value
+	leaq	flag_update_table_sub8(%rip), %r11	# 14106	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 14104	[c=1 l=7]  *movdi_internal/4
+	movl	%eax, %edx	# 3412	[c=4 l=2]  *movsi_internal/0
+	movq	1040(%rbx), %rax	# 11466	[c=9 l=7]  *movdi_internal/3
+	jmp	.L793	# 17283	[c=1 l=5]  jump
+.L781:
+	movq	%rbx, %rdi	# 3254	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 3255	[c=10 l=5]  *call_value
+	leaq	flag_update_table_sub8(%rip), %r11	# 14098	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 14096	[c=1 l=7]  *movdi_internal/4
+	movl	%eax, %ecx	# 3256	[c=4 l=2]  *movsi_internal/0
+	movq	1040(%rbx), %rax	# 11465	[c=9 l=7]  *movdi_internal/3
+	jmp	.L782	# 17285	[c=1 l=5]  jump
+.L585:
+	leaq	.LC50(%rip), %rdx	# 604	[c=1 l=7]  *movdi_internal/4
+	movl	$1, %esi	# 606	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 607	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 16929	[c=4 l=2]  *movdi_xor
+	call	leave	# 609	[c=0 l=5]  *call
+.L588:
+	cmpl	$0, 264(%rbx)	# 578	[c=13 l=7]  *cmpsi_ccno_1/1
+	je	.L584	# 579	[c=13 l=6]  *jcc
+	movq	1040(%rbx), %rax	# 582	[c=9 l=7]  *movdi_internal/3
+	movq	904(%rbx), %rsi	# 581	[c=9 l=7]  *movdi_internal/3
+	movsbl	24(%rax), %edi	# 583	[c=13 l=4]  extendqisi2
+	call	putc@PLT	# 586	[c=10 l=5]  *call_value
+	leaq	flag_update_table_add8(%rip), %r10	# 13872	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_sub8(%rip), %r11	# 13874	[c=1 l=7]  *movdi_internal/4
+	jmp	.L584	# 17287	[c=1 l=5]  jump
+.L589:
+	cmpl	$0, 248(%rbx)	# 546	[c=13 l=7]  *cmpsi_ccno_1/1
+	je	.L584	# 547	[c=13 l=6]  *jcc
+	movq	40(%rbx), %rax	# 12853	[c=9 l=4]  *movdi_internal/3
+	cmpl	$1, 96(%rbx)	# 551	[c=13 l=4]  *cmpsi_1/0
+	leaq	-1(%rax), %rdx	# 15065	[c=4 l=4]  *leadi
+	je	.L1619	# 552	[c=13 l=6]  *jcc
+.L596:
+	leaq	host_getchar(%rip), %rcx	# 562	[c=1 l=7]  *movdi_internal/4
+	xorl	%esi, %esi	# 16933	[c=4 l=2]  *movdi_xor
+	movq	%rbx, %rdi	# 566	[c=4 l=3]  *movdi_internal/3
+	call	replay_input@PLT	# 567	[c=10 l=5]  *call_value
+.L1394:
+	movq	1040(%rbx), %rdx	# 569	[c=9 l=7]  *movdi_internal/3
+	leaq	flag_update_table_add8(%rip), %r10	# 13868	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_sub8(%rip), %r11	# 13870	[c=1 l=7]  *movdi_internal/4
+	movb	%al, 24(%rdx)	# 570	[c=4 l=3]  *movqi_internal/8
+	movq	1040(%rbx), %rdx	# 571	[c=9 l=7]  *movdi_internal/3
+	movb	%ah, 25(%rdx)	# 16932	[c=4 l=3]  *extzvqi_mem_rex64
+	jmp	.L584	# 17290	[c=1 l=5]  jump
+.L590:
+	cmpl	$0, 504(%rbx)	# 503	[c=13 l=7]  *cmpsi_ccno_1/1
+	movq	1040(%rbx), %rax	# 502	[c=9 l=7]  *movdi_internal/3
+	jne	.L595	# 504	[c=13 l=6]  *jcc
+	movb	$0, 20(%rax)	# 506	[c=4 l=4]  *movqi_internal/8
+	movq	1040(%rbx), %rax	# 507	[c=9 l=7]  *movdi_internal/3
+	movb	$0, 21(%rax)	# 508	[c=4 l=4]  *movqi_internal/8
+	movq	1040(%rbx), %rax	# 509	[c=9 l=7]  *movdi_internal/3
+	movb	$0, 22(%rax)	# 510	[c=4 l=4]  *movqi_internal/8
+	movq	1040(%rbx), %rax	# 511	[c=9 l=7]  *movdi_internal/3
+	movb	$0, 23(%rax)	# 512	[c=4 l=4]  *movqi_internal/8
+	movq	1040(%rbx), %rax	# 513	[c=9 l=7]  *movdi_internal/3
+	movb	$0, 24(%rax)	# 514	[c=4 l=4]  *movqi_internal/8
+	movq	1040(%rbx), %rax	# 515	[c=9 l=7]  *movdi_internal/3
+	movb	$0, 25(%rax)	# 516	[c=4 l=4]  *movqi_internal/8
+	jmp	.L584	# 17292	[c=1 l=5]  jump
+.L587:
+	movq	1040(%rbx), %rax	# 591	[c=9 l=7]  *movdi_internal/3
+	leaq	.LC49(%rip), %rdx	# 595	[c=1 l=7]  *movdi_internal/4
+	xorl	%esi, %esi	# 16930	[c=4 l=2]  *movdi_xor
+	movq	%rbx, %rdi	# 598	[c=4 l=3]  *movdi_internal/3
+	movswl	24(%rax), %ecx	# 592	[c=13 l=4]  extendhisi2/1
+	xorl	%eax, %eax	# 16931	[c=4 l=2]  *movdi_xor
+	movl	%ecx, 76(%rbx)	# 593	[c=4 l=3]  *movsi_internal/1
+	call	leave	# 600	[c=0 l=5]  *call
+.L868:
+	movzbl	%cl, %edx	# 4495	[c=4 l=3]  *zero_extendqisi2/0
+	movl	%eax, %esi	# 4497	[c=4 l=2]  *movsi_internal/0
+	movq	%rbx, %rdi	# 4498	[c=4 l=3]  *movdi_internal/3
+	movl	%r8d, 16(%rsp)	# 14175	[c=4 l=5]  *movsi_internal/1
+	call	data_write_page	# 4499	[c=0 l=5]  *call
+	movl	16(%rsp), %r8d	# 14176	[c=9 l=5]  *movsi_internal/0
+	leaq	flag_update_table_sub8(%rip), %r11	# 14180	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 14178	[c=1 l=7]  *movdi_internal/4
+	jmp	.L869	# 17294	[c=1 l=5]  jump
+.L1046:
+	movzbl	%cl, %edx	# 6720	[c=4 l=3]  *zero_extendqisi2/0
+	movl	%r13d, %esi	# 6722	[c=4 l=3]  *movsi_internal/0
+	movq	%rbx, %rdi	# 6723	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 6724	[c=0 l=5]  *call
+	leaq	flag_update_table_sub8(%rip), %r11	# 14442	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 14440	[c=1 l=7]  *movdi_internal/4
+	jmp	.L1047	# 17296	[c=1 l=5]  jump
+.L1549:
+	leaq	.LC13(%rip), %rcx	# 111	[c=1 l=7]  *movdi_internal/4
+	movl	$8, %edx	# 113	[c=4 l=5]  *movdi_internal/2
+	movl	%ebp, %esi	# 114	[c=4 l=2]  *movsi_internal/0
+	movq	%rbx, %rdi	# 115	[c=4 l=3]  *movdi_internal/3
+	call	get_mem	# 116	[c=10 l=5]  *call_value
+	movq	%rax, 10984(%rbx)	# 118	[c=4 l=7]  *movdi_internal/5
+	jmp	.L552	# 17298	[c=1 l=5]  jump
+.L1557:
+	movl	$93, %esi	# 4429	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 4430	[c=4 l=3]  *movdi_internal/3
+	movb	%cl, 16(%rsp)	# 14161	[c=4 l=4]  *movqi_internal/8
+	call	data_read_mapped	# 4431	[c=10 l=5]  *call_value
+	movzbl	16(%rsp), %ecx	# 14162	[c=9 l=5]  *movqi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 14164	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_sub8(%rip), %r11	# 14166	[c=1 l=7]  *movdi_internal/4
+	movl	%eax, %edx	# 4432	[c=4 l=2]  *movsi_internal/0
+	movl	$94, %eax	# 4433	[c=4 l=5]  *movsi_internal/0
+	subl	%r14d, %eax	# 4434	[c=4 l=3]  *subsi_1/0
+	cmpl	%r15d, %eax	# 4435	[c=4 l=3]  *cmpsi_1/0
+	jnb	.L864	# 4436	[c=13 l=6]  *jcc
+	jmp	.L863	# 17301	[c=1 l=5]  jump
+.L668:
+	movq	104(%rbx), %rsi	# 1817	[c=9 l=4]  *movdi_internal/3
+	orl	$63, %ecx	# 15016	[c=4 l=3]  *iorsi_1/0
+	andb	(%rsi), %al	# 1818	[c=9 l=2]  *andqi_1/1
+	movl	%eax, %esi	# 12962	[c=4 l=2]  *movqi_internal/1
+	leaq	flag_update_table_sub8(%rip), %rax	# 1819	[c=1 l=7]  *movdi_internal/4
+	orb	(%rax,%rdx), %sil	# 1823	[c=13 l=4]  *iorqi_1/1
+	leaq	101(%rbx), %rax	# 15017	[c=4 l=4]  *leadi
+	movb	%sil, 101(%rbx)	# 1824	[c=4 l=4]  *movqi_internal/8
+	jmp	.L669	# 17303	[c=1 l=5]  jump
+.L664:
+	movq	104(%rbx), %rsi	# 1703	[c=9 l=4]  *movdi_internal/3
+	orl	$63, %ecx	# 15022	[c=4 l=3]  *iorsi_1/0
+	andb	(%rsi), %al	# 1704	[c=9 l=2]  *andqi_1/1
+	movl	%eax, %esi	# 12944	[c=4 l=2]  *movqi_internal/1
+	leaq	flag_update_table_sub8(%rip), %rax	# 1705	[c=1 l=7]  *movdi_internal/4
+	orb	(%rax,%rdx), %sil	# 1709	[c=13 l=4]  *iorqi_1/1
+	leaq	101(%rbx), %rax	# 15023	[c=4 l=4]  *leadi
+	movb	%sil, 101(%rbx)	# 1710	[c=4 l=4]  *movqi_internal/8
+	jmp	.L665	# 17305	[c=1 l=5]  jump
+.L682:
+	movq	1040(%rbx), %rax	# 2057	[c=9 l=7]  *movdi_internal/3
+	movzbl	93(%rax), %r15d	# 2058	[c=13 l=5]  *zero_extendqisi2/0
+	cmpl	%r14d, %edx	# 2059	[c=4 l=3]  *cmpsi_1/0
+	jb	.L684	# 2060	[c=13 l=6]  *jcc
+	cmpb	$1, 1082(%rbx)	# 2064	[c=13 l=7]  *cmpqi_1/0
+	jbe	.L684	# 2065	[c=13 l=6]  *jcc
+.L685:
+	movl	$94, %esi	# 2068	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 2069	[c=4 l=3]  *movdi_internal/3
+	call	data_read_mapped	# 2070	[c=10 l=5]  *call_value
+	leaq	flag_update_table_add8(%rip), %r10	# 13962	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_sub8(%rip), %r11	# 13964	[c=1 l=7]  *movdi_internal/4
+	jmp	.L686	# 17307	[c=1 l=5]  jump
+.L677:
+	movq	104(%rbx), %rsi	# 1964	[c=9 l=4]  *movdi_internal/3
+	orl	$30, %edx	# 15012	[c=4 l=3]  *iorsi_1/0
+	andb	(%rsi), %cl	# 1965	[c=9 l=2]  *andqi_1/1
+	leaq	flag_update_table_dec(%rip), %rsi	# 12731	[c=1 l=7]  *movdi_internal/4
+	orb	(%rsi,%rax), %cl	# 1970	[c=13 l=3]  *iorqi_1/1
+	leaq	101(%rbx), %rax	# 15013	[c=4 l=4]  *leadi
+	movb	%cl, 101(%rbx)	# 1971	[c=4 l=3]  *movqi_internal/8
+	jmp	.L678	# 17309	[c=1 l=5]  jump
+.L754:
+	movq	1040(%rbx), %rax	# 2965	[c=9 l=7]  *movdi_internal/3
+	movl	$94, %edx	# 2967	[c=4 l=5]  *movsi_internal/0
+	subl	%r13d, %edx	# 2968	[c=4 l=3]  *subsi_1/0
+	movzbl	93(%rax), %r15d	# 2966	[c=13 l=5]  *zero_extendqisi2/0
+	cmpl	%r14d, %edx	# 2969	[c=4 l=3]  *cmpsi_1/0
+	jb	.L756	# 2970	[c=13 l=6]  *jcc
+	cmpb	$1, 1082(%rbx)	# 2974	[c=13 l=7]  *cmpqi_1/0
+	jbe	.L756	# 2975	[c=13 l=6]  *jcc
+.L757:
+	movl	$94, %esi	# 2978	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 2979	[c=4 l=3]  *movdi_internal/3
+	call	data_read_mapped	# 2980	[c=10 l=5]  *call_value
+	leaq	flag_update_table_add8(%rip), %r10	# 14062	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_sub8(%rip), %r11	# 14064	[c=1 l=7]  *movdi_internal/4
+	jmp	.L758	# 17311	[c=1 l=5]  jump
+.L1216:
+	movq	104(%rbx), %rax	# 10177	[c=9 l=4]  *movdi_internal/3
+	orl	$63, %edi	# 14757	[c=4 l=3]  *iorsi_1/0
+	andb	(%rax), %r8b	# 10178	[c=9 l=3]  *andqi_1/1
+	leaq	flag_update_table_sub8(%rip), %rax	# 10179	[c=1 l=7]  *movdi_internal/4
+	orb	(%rax,%rcx), %r8b	# 10183	[c=13 l=4]  *iorqi_1/1
+	movq	%rdx, %rcx	# 62	[c=4 l=3]  *movdi_internal/3
+	movb	%r8b, 101(%rbx)	# 10184	[c=4 l=4]  *movqi_internal/8
+	jmp	.L1217	# 17313	[c=1 l=5]  jump
+.L784:
+	movq	104(%rbx), %rsi	# 3297	[c=9 l=4]  *movdi_internal/3
+	orl	$30, %edx	# 14981	[c=4 l=3]  *iorsi_1/0
+	andb	(%rsi), %cl	# 3298	[c=9 l=2]  *andqi_1/1
+	leaq	flag_update_table_inc(%rip), %rsi	# 12733	[c=1 l=7]  *movdi_internal/4
+	orb	(%rsi,%rax), %cl	# 3303	[c=13 l=3]  *iorqi_1/1
+	leaq	101(%rbx), %rax	# 14982	[c=4 l=4]  *leadi
+	movb	%cl, 101(%rbx)	# 3304	[c=4 l=3]  *movqi_internal/8
+	jmp	.L785	# 17315	[c=1 l=5]  jump
+.L838:
+	movq	104(%rbx), %rax	# 3992	[c=9 l=4]  *movdi_internal/3
+	movslq	%ecx, %rcx	# 3995	[c=4 l=3]  *extendsidi2_rex64/1
+	orl	$31, %edx	# 14976	[c=4 l=3]  *iorsi_1/0
+	andb	(%rax), %sil	# 3993	[c=9 l=3]  *andqi_1/1
+	leaq	flag_update_table_ror8(%rip), %rax	# 12734	[c=1 l=7]  *movdi_internal/4
+	orb	(%rax,%rcx), %sil	# 3998	[c=13 l=4]  *iorqi_1/1
+	leaq	101(%rbx), %rax	# 14977	[c=4 l=4]  *leadi
+	movb	%sil, 101(%rbx)	# 3999	[c=4 l=4]  *movqi_internal/8
+	jmp	.L839	# 17317	[c=1 l=5]  jump
+.L1060:
+	movq	104(%rbx), %rsi	# 6934	[c=9 l=4]  *movdi_internal/3
+	orl	$63, %ecx	# 14919	[c=4 l=3]  *iorsi_1/0
+	andb	(%rsi), %al	# 6935	[c=9 l=2]  *andqi_1/1
+	movl	%eax, %esi	# 13351	[c=4 l=2]  *movqi_internal/1
+	leaq	flag_update_table_sub8(%rip), %rax	# 6936	[c=1 l=7]  *movdi_internal/4
+	orb	(%rax,%rdx), %sil	# 6940	[c=13 l=4]  *iorqi_1/1
+	leaq	101(%rbx), %rax	# 14920	[c=4 l=4]  *leadi
+	movb	%sil, 101(%rbx)	# 6941	[c=4 l=4]  *movqi_internal/8
+	jmp	.L1061	# 17319	[c=1 l=5]  jump
+.L1057:
+	movq	104(%rbx), %rsi	# 6875	[c=9 l=4]  *movdi_internal/3
+	orl	$63, %ecx	# 14921	[c=4 l=3]  *iorsi_1/0
+	andb	(%rsi), %al	# 6876	[c=9 l=2]  *andqi_1/1
+	movl	%eax, %esi	# 13345	[c=4 l=2]  *movqi_internal/1
+	leaq	flag_update_table_sub8(%rip), %rax	# 6877	[c=1 l=7]  *movdi_internal/4
+	orb	(%rax,%rdx), %sil	# 6881	[c=13 l=4]  *iorqi_1/1
+	leaq	101(%rbx), %rax	# 14922	[c=4 l=4]  *leadi
+	movb	%sil, 101(%rbx)	# 6882	[c=4 l=4]  *movqi_internal/8
+	jmp	.L1058	# 17321	[c=1 l=5]  jump
+.L1105:
+	movq	104(%rbx), %rsi	# 7856	[c=9 l=4]  *movdi_internal/3
+	orl	$30, %edx	# 14877	[c=4 l=3]  *iorsi_1/0
+	andb	(%rsi), %cl	# 7857	[c=9 l=2]  *andqi_1/1
+	leaq	flag_update_table_logical(%rip), %rsi	# 12741	[c=1 l=7]  *movdi_internal/4
+	orb	(%rsi,%rax), %cl	# 7863	[c=13 l=3]  *iorqi_1/1
+	leaq	101(%rbx), %rax	# 14878	[c=4 l=4]  *leadi
+	movb	%cl, 101(%rbx)	# 7864	[c=4 l=3]  *movqi_internal/8
+	jmp	.L1106	# 17323	[c=1 l=5]  jump
+.L1114:
+	movq	104(%rbx), %rcx	# 8116	[c=9 l=4]  *movdi_internal/3
+	orl	$63, %esi	# 14858	[c=4 l=3]  *iorsi_1/0
+	andb	(%rcx), %al	# 8117	[c=9 l=2]  *andqi_1/1
+	movl	%eax, %ecx	# 13523	[c=4 l=2]  *movqi_internal/0
+	leaq	flag_update_table_sub8(%rip), %rax	# 8118	[c=1 l=7]  *movdi_internal/4
+	orb	(%rax,%rdx), %cl	# 8122	[c=13 l=3]  *iorqi_1/1
+	leaq	101(%rbx), %rdx	# 14859	[c=4 l=4]  *leadi
+	movb	%cl, 101(%rbx)	# 8123	[c=4 l=3]  *movqi_internal/8
+	movq	%rdx, %r14	# 11657	[c=4 l=3]  *movdi_internal/3
+	jmp	.L1115	# 17325	[c=1 l=5]  jump
+.L1102:
+	movq	104(%rbx), %rsi	# 7814	[c=9 l=4]  *movdi_internal/3
+	orl	$30, %edx	# 14879	[c=4 l=3]  *iorsi_1/0
+	andb	(%rsi), %cl	# 7815	[c=9 l=2]  *andqi_1/1
+	leaq	flag_update_table_logical(%rip), %rsi	# 12740	[c=1 l=7]  *movdi_internal/4
+	orb	(%rsi,%rax), %cl	# 7821	[c=13 l=3]  *iorqi_1/1
+	leaq	101(%rbx), %rax	# 14880	[c=4 l=4]  *leadi
+	movb	%cl, 101(%rbx)	# 7822	[c=4 l=3]  *movqi_internal/8
+	jmp	.L1134	# 17327	[c=1 l=5]  jump
+.L1149:
+	movq	104(%rbx), %rsi	# 9221	[c=9 l=4]  *movdi_internal/3
+	orl	$63, %r9d	# 14778	[c=4 l=4]  *iorsi_1/0
+	andb	(%rsi), %dl	# 9222	[c=9 l=2]  *andqi_1/1
+	orb	(%rcx,%rax), %dl	# 9227	[c=13 l=3]  *iorqi_1/1
+	movb	%dl, 101(%rbx)	# 9228	[c=4 l=3]  *movqi_internal/8
+	leaq	101(%rbx), %rdx	# 14779	[c=4 l=4]  *leadi
+	jmp	.L1150	# 17329	[c=1 l=5]  jump
+.L1147:
+	movq	104(%rbx), %rcx	# 9159	[c=9 l=4]  *movdi_internal/3
+	orl	$63, %r9d	# 14781	[c=4 l=4]  *iorsi_1/0
+	andb	(%rcx), %dl	# 9160	[c=9 l=2]  *andqi_1/1
+	leaq	flag_update_table_add8(%rip), %rcx	# 9161	[c=1 l=7]  *movdi_internal/4
+	orb	(%rcx,%rax), %dl	# 9165	[c=13 l=3]  *iorqi_1/1
+	movb	%dl, 101(%rbx)	# 9166	[c=4 l=3]  *movqi_internal/8
+	leaq	101(%rbx), %rdx	# 14782	[c=4 l=4]  *leadi
+	jmp	.L1148	# 17331	[c=1 l=5]  jump
+.L1156:
+	movl	$94, %eax	# 9391	[c=4 l=5]  *movsi_internal/0
+	movzbl	93(%r13), %edx	# 9390	[c=13 l=5]  *zero_extendqisi2/0
+	subl	%r14d, %eax	# 9392	[c=4 l=3]  *subsi_1/0
+	cmpl	%r15d, %eax	# 9393	[c=4 l=3]  *cmpsi_1/0
+	jb	.L1158	# 9394	[c=13 l=6]  *jcc
+	cmpb	$1, 1082(%rbx)	# 9398	[c=13 l=7]  *cmpqi_1/0
+	jbe	.L1158	# 9399	[c=13 l=6]  *jcc
+.L1159:
+	movl	$94, %esi	# 9402	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 9403	[c=4 l=3]  *movdi_internal/3
+	movl	%edx, 24(%rsp)	# 14475	[c=4 l=4]  *movsi_internal/1
+	movb	%cl, 16(%rsp)	# 14473	[c=4 l=4]  *movqi_internal/8
+	call	data_read_mapped	# 9404	[c=10 l=5]  *call_value
+	movzbl	16(%rsp), %ecx	# 14474	[c=9 l=5]  *movqi_internal/4
+	movl	24(%rsp), %edx	# 14476	[c=9 l=4]  *movsi_internal/0
+	leaq	flag_update_table_add8(%rip), %r10	# 14478	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_sub8(%rip), %r11	# 14480	[c=1 l=7]  *movdi_internal/4
+	jmp	.L1160	# 17333	[c=1 l=5]  jump
+.L1142:
+	movq	104(%rbx), %rcx	# 9039	[c=9 l=4]  *movdi_internal/3
+	orl	$63, %r9d	# 14787	[c=4 l=4]  *iorsi_1/0
+	andb	(%rcx), %dl	# 9040	[c=9 l=2]  *andqi_1/1
+	leaq	flag_update_table_add8(%rip), %rcx	# 9041	[c=1 l=7]  *movdi_internal/4
+	orb	(%rcx,%rax), %dl	# 9045	[c=13 l=3]  *iorqi_1/1
+	movb	%dl, 101(%rbx)	# 9046	[c=4 l=3]  *movqi_internal/8
+	leaq	101(%rbx), %rdx	# 14788	[c=4 l=4]  *leadi
+	jmp	.L1150	# 17335	[c=1 l=5]  jump
+.L1139:
+	movq	104(%rbx), %rsi	# 8981	[c=9 l=4]  *movdi_internal/3
+	orl	$63, %edx	# 14791	[c=4 l=3]  *iorsi_1/0
+	movzbl	(%rsi), %edi	# 16774	[c=5 l=3]  *movqi_internal/4
+	andl	%ecx, %edi	# 17532	[c=4 l=2]  *andsi_1/0
+	leaq	flag_update_table_add8(%rip), %rcx	# 8983	[c=1 l=7]  *movdi_internal/4
+	movl	%edi, %esi	# 13647	[c=4 l=2]  *movqi_internal/1
+	orb	(%rcx,%rax), %sil	# 8987	[c=13 l=4]  *iorqi_1/1
+	leaq	101(%rbx), %rax	# 14792	[c=4 l=4]  *leadi
+	movb	%sil, 101(%rbx)	# 8988	[c=4 l=4]  *movqi_internal/8
+	jmp	.L1152	# 17337	[c=1 l=5]  jump
+.L1136:
+	movq	104(%rbx), %rcx	# 8863	[c=9 l=4]  *movdi_internal/3
+	orl	$63, %esi	# 14798	[c=4 l=3]  *iorsi_1/0
+	andb	(%rcx), %al	# 8864	[c=9 l=2]  *andqi_1/1
+	movl	%eax, %ecx	# 13635	[c=4 l=2]  *movqi_internal/0
+	leaq	flag_update_table_sub8(%rip), %rax	# 8865	[c=1 l=7]  *movdi_internal/4
+	orb	(%rax,%rdx), %cl	# 8869	[c=13 l=3]  *iorqi_1/1
+	leaq	101(%rbx), %rdx	# 14799	[c=4 l=4]  *leadi
+	movb	%cl, 101(%rbx)	# 8870	[c=4 l=3]  *movqi_internal/8
+	movq	%rdx, %rcx	# 11605	[c=4 l=3]  *movdi_internal/3
+	jmp	.L1137	# 17339	[c=1 l=5]  jump
+.L1133:
+	movq	104(%rbx), %rsi	# 8806	[c=9 l=4]  *movdi_internal/3
+	orl	$30, %edx	# 14801	[c=4 l=3]  *iorsi_1/0
+	andb	(%rsi), %cl	# 8807	[c=9 l=2]  *andqi_1/1
+	leaq	flag_update_table_dec(%rip), %rsi	# 12742	[c=1 l=7]  *movdi_internal/4
+	orb	(%rsi,%rax), %cl	# 8812	[c=13 l=3]  *iorqi_1/1
+	leaq	101(%rbx), %rax	# 14802	[c=4 l=4]  *leadi
+	movb	%cl, 101(%rbx)	# 8813	[c=4 l=3]  *movqi_internal/8
+	jmp	.L1134	# 17341	[c=1 l=5]  jump
+.L1123:
+	movq	104(%rbx), %rsi	# 8466	[c=9 l=4]  *movdi_internal/3
+	andb	(%rsi), %al	# 8467	[c=9 l=2]  *andqi_1/1
+	movl	%eax, %esi	# 13603	[c=4 l=2]  *movqi_internal/1
+	leaq	flag_update_table_sub8(%rip), %rax	# 8468	[c=1 l=7]  *movdi_internal/4
+	orb	(%rax,%rdx), %sil	# 8472	[c=13 l=4]  *iorqi_1/1
+	leaq	101(%rbx), %rdx	# 14830	[c=4 l=4]  *leadi
+	movb	%sil, 101(%rbx)	# 8473	[c=4 l=4]  *movqi_internal/8
+	movl	%ecx, %esi	# 13606	[c=4 l=2]  *movqi_internal/1
+	movq	%rdx, %rcx	# 11660	[c=4 l=3]  *movdi_internal/3
+	orl	$63, %esi	# 14829	[c=4 l=3]  *iorsi_1/0
+	jmp	.L1124	# 17343	[c=1 l=5]  jump
+.L1120:
+	movq	104(%rbx), %rcx	# 8319	[c=9 l=4]  *movdi_internal/3
+	orl	$63, %edi	# 14842	[c=4 l=3]  *iorsi_1/0
+	andb	(%rcx), %al	# 8320	[c=9 l=2]  *andqi_1/1
+	movl	%eax, %ecx	# 13569	[c=4 l=2]  *movqi_internal/0
+	leaq	flag_update_table_sub8(%rip), %rax	# 8321	[c=1 l=7]  *movdi_internal/4
+	orb	(%rax,%rdx), %cl	# 8325	[c=13 l=3]  *iorqi_1/1
+	leaq	101(%rbx), %rdx	# 14843	[c=4 l=4]  *leadi
+	movb	%cl, 101(%rbx)	# 8326	[c=4 l=3]  *movqi_internal/8
+	movq	%rdx, %r13	# 11655	[c=4 l=3]  *movdi_internal/3
+	jmp	.L1121	# 17345	[c=1 l=5]  jump
+.L1117:
+	movq	104(%rbx), %rcx	# 8217	[c=9 l=4]  *movdi_internal/3
+	orl	$63, %esi	# 14850	[c=4 l=3]  *iorsi_1/0
+	andb	(%rcx), %al	# 8218	[c=9 l=2]  *andqi_1/1
+	movl	%eax, %ecx	# 13546	[c=4 l=2]  *movqi_internal/0
+	leaq	flag_update_table_sub8(%rip), %rax	# 8219	[c=1 l=7]  *movdi_internal/4
+	orb	(%rax,%rdx), %cl	# 8223	[c=13 l=3]  *iorqi_1/1
+	leaq	101(%rbx), %rdx	# 14851	[c=4 l=4]  *leadi
+	movb	%cl, 101(%rbx)	# 8224	[c=4 l=3]  *movqi_internal/8
+	movq	%rdx, %r14	# 11656	[c=4 l=3]  *movdi_internal/3
+	jmp	.L1118	# 17347	[c=1 l=5]  jump
+.L1111:
+	movq	104(%rbx), %rcx	# 8015	[c=9 l=4]  *movdi_internal/3
+	orl	$63, %esi	# 14866	[c=4 l=3]  *iorsi_1/0
+	andb	(%rcx), %al	# 8016	[c=9 l=2]  *andqi_1/1
+	movl	%eax, %ecx	# 13500	[c=4 l=2]  *movqi_internal/0
+	leaq	flag_update_table_sub8(%rip), %rax	# 8017	[c=1 l=7]  *movdi_internal/4
+	orb	(%rax,%rdx), %cl	# 8021	[c=13 l=3]  *iorqi_1/1
+	leaq	101(%rbx), %rdx	# 14867	[c=4 l=4]  *leadi
+	movb	%cl, 101(%rbx)	# 8022	[c=4 l=3]  *movqi_internal/8
+	movq	%rdx, %r14	# 11658	[c=4 l=3]  *movdi_internal/3
+	jmp	.L1112	# 17349	[c=1 l=5]  jump
+.L1108:
+	movq	104(%rbx), %rcx	# 7913	[c=9 l=4]  *movdi_internal/3
+	orl	$63, %esi	# 14874	[c=4 l=3]  *iorsi_1/0
+	andb	(%rcx), %al	# 7914	[c=9 l=2]  *andqi_1/1
+	movl	%eax, %ecx	# 13477	[c=4 l=2]  *movqi_internal/0
+	leaq	flag_update_table_sub8(%rip), %rax	# 7915	[c=1 l=7]  *movdi_internal/4
+	orb	(%rax,%rdx), %cl	# 7919	[c=13 l=3]  *iorqi_1/1
+	leaq	101(%rbx), %rdx	# 14875	[c=4 l=4]  *leadi
+	movb	%cl, 101(%rbx)	# 7920	[c=4 l=3]  *movqi_internal/8
+	movq	%rdx, %r14	# 11659	[c=4 l=3]  *movdi_internal/3
+	jmp	.L1109	# 17351	[c=1 l=5]  jump
+.L631:
+	movq	1040(%rbx), %rax	# 1340	[c=9 l=7]  *movdi_internal/3
+	movl	$94, %esi	# 1342	[c=4 l=5]  *movsi_internal/0
+	subl	%r15d, %esi	# 1343	[c=4 l=3]  *subsi_1/0
+	movzbl	93(%rax), %ecx	# 1341	[c=13 l=4]  *zero_extendqisi2/0
+	cmpl	%edx, %esi	# 1344	[c=4 l=2]  *cmpsi_1/0
+	jb	.L633	# 1345	[c=13 l=6]  *jcc
+	cmpb	$1, 1082(%rbx)	# 1349	[c=13 l=7]  *cmpqi_1/0
+	jbe	.L633	# 1350	[c=13 l=6]  *jcc
+.L634:
+	movl	$94, %esi	# 1353	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 1354	[c=4 l=3]  *movdi_internal/3
+	movl	%ecx, 24(%rsp)	# 13899	[c=4 l=4]  *movsi_internal/1
+	movl	%edx, 16(%rsp)	# 13897	[c=4 l=4]  *movsi_internal/1
+	call	data_read_mapped	# 1355	[c=10 l=5]  *call_value
+	movl	16(%rsp), %edx	# 13898	[c=9 l=4]  *movsi_internal/0
+	movl	24(%rsp), %ecx	# 13900	[c=9 l=4]  *movsi_internal/0
+	leaq	flag_update_table_add8(%rip), %r10	# 13902	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_sub8(%rip), %r11	# 13904	[c=1 l=7]  *movdi_internal/4
+	jmp	.L635	# 17353	[c=1 l=5]  jump
+.L615:
+	movq	104(%rbx), %rsi	# 1008	[c=9 l=4]  *movdi_internal/3
+	cltq	# 1011	[c=4 l=2]  *extendsidi2_rex64/0
+	orl	$31, %edx	# 15041	[c=4 l=3]  *iorsi_1/0
+	andb	(%rsi), %cl	# 1009	[c=9 l=2]  *andqi_1/1
+	leaq	flag_update_table_ror8(%rip), %rsi	# 12729	[c=1 l=7]  *movdi_internal/4
+	orb	(%rsi,%rax), %cl	# 1014	[c=13 l=3]  *iorqi_1/1
+	leaq	101(%rbx), %rax	# 15042	[c=4 l=4]  *leadi
+	movb	%cl, 101(%rbx)	# 1015	[c=4 l=3]  *movqi_internal/8
+	jmp	.L616	# 17355	[c=1 l=5]  jump
+.L612:
+	movq	104(%rbx), %rsi	# 961	[c=9 l=4]  *movdi_internal/3
+	cltq	# 964	[c=4 l=2]  *extendsidi2_rex64/0
+	orl	$30, %edx	# 15043	[c=4 l=3]  *iorsi_1/0
+	andb	(%rsi), %cl	# 962	[c=9 l=2]  *andqi_1/1
+	leaq	flag_update_table_logical(%rip), %rsi	# 12728	[c=1 l=7]  *movdi_internal/4
+	orb	(%rsi,%rax), %cl	# 967	[c=13 l=3]  *iorqi_1/1
+	leaq	101(%rbx), %rax	# 15044	[c=4 l=4]  *leadi
+	movb	%cl, 101(%rbx)	# 968	[c=4 l=3]  *movqi_internal/8
+	jmp	.L613	# 17357	[c=1 l=5]  jump
+.L1228:
+	movq	10960(%rbx), %rax	# 10397	[c=9 l=7]  *movdi_internal/3
+	movl	%r13d, %r13d	# 10395	[c=1 l=3]  *zero_extendsidi2/3
+	movl	%r14d, %esi	# 10400	[c=4 l=3]  *movsi_internal/0
+	movq	%rbx, %rdi	# 10401	[c=4 l=3]  *movdi_internal/3
+	leaq	.L547(%rip), %r14	# 69	[c=1 l=7]  *movdi_internal/4
+	movq	8(%rax), %rax	# 10398	[c=9 l=4]  *movdi_internal/3
+	leaq	(%rax,%r13,8), %rdx	# 10399	[c=8 l=4]  *leadi
+	movq	%rdx, 16(%rsp)	# 14557	[c=4 l=5]  *movdi_internal/5
+	call	jit_compile@PLT	# 10402	[c=10 l=5]  *call_value
+	movq	16(%rsp), %rdx	# 14558	[c=9 l=5]  *movdi_internal/3
+	leaq	flag_update_table_add8(%rip), %r10	# 14560	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_sub8(%rip), %r11	# 14562	[c=1 l=7]  *movdi_internal/4
+	movq	%rax, (%rdx)	# 10404	[c=4 l=3]  *movdi_internal/5
+	movq	10960(%rbx), %rax	# 10405	[c=9 l=7]  *movdi_internal/3
+	movq	8(%rax), %rax	# 10406	[c=9 l=4]  *movdi_internal/3
+	cmpq	$0, (%rax,%r13,8)	# 10407	[c=14 l=5]  *cmpdi_ccno_1/1
+	je	.L1620	# 10408	[c=13 l=6]  *jcc
+.L1229:
+	movq	%r13, %rax	# 13770	[c=4 l=3]  *movdi_internal/3
+	movq	%r10, %rcx	# 15860	[c=4 l=3]  *movdi_internal/3
+	movq	%r12, %rdx	# 15861	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rax	# 10417	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %rax	# 10418	[c=13 l=7]  *adddi_1/1
+	movq	%r14, (%rax)	# 10419	[c=4 l=3]  *movdi_internal/5
+	movq	%r11, %rax	# 15862	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 15863	[c=4 l=3]  *indirect_jump
+.L875:
+	movq	1040(%rbx), %rax	# 4589	[c=9 l=7]  *movdi_internal/3
+	movl	$94, %ecx	# 4591	[c=4 l=5]  *movsi_internal/0
+	subl	%r14d, %ecx	# 4592	[c=4 l=3]  *subsi_1/0
+	movzbl	93(%rax), %edx	# 4590	[c=13 l=4]  *zero_extendqisi2/0
+	cmpl	%r15d, %ecx	# 4593	[c=4 l=3]  *cmpsi_1/0
+	jb	.L877	# 4594	[c=13 l=6]  *jcc
+	cmpb	$1, 1082(%rbx)	# 4598	[c=13 l=7]  *cmpqi_1/0
+	jbe	.L877	# 4599	[c=13 l=6]  *jcc
+.L878:
+	movl	$94, %esi	# 4602	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 4603	[c=4 l=3]  *movdi_internal/3
+	movl	%edx, 16(%rsp)	# 14195	[c=4 l=4]  *movsi_internal/1
+	call	data_read_mapped	# 4604	[c=10 l=5]  *call_value
+	movl	16(%rsp), %edx	# 14196	[c=9 l=4]  *movsi_internal/0
+	leaq	flag_update_table_add8(%rip), %r10	# 14198	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_sub8(%rip), %r11	# 14200	[c=1 l=7]  *movdi_internal/4
+	jmp	.L879	# 17360	[c=1 l=5]  jump
+.L1073:
+	movq	104(%rbx), %rsi	# 7154	[c=9 l=4]  *movdi_internal/3
+	orl	$30, %edx	# 14910	[c=4 l=3]  *iorsi_1/0
+	andb	(%rsi), %cl	# 7155	[c=9 l=2]  *andqi_1/1
+	leaq	flag_update_table_logical(%rip), %rsi	# 12738	[c=1 l=7]  *movdi_internal/4
+	orb	(%rsi,%rax), %cl	# 7161	[c=13 l=3]  *iorqi_1/1
+	leaq	101(%rbx), %rax	# 14911	[c=4 l=4]  *leadi
+	movb	%cl, 101(%rbx)	# 7162	[c=4 l=3]  *movqi_internal/8
+	jmp	.L1074	# 17362	[c=1 l=5]  jump
+.L730:
+	movq	104(%rbx), %rsi	# 2576	[c=9 l=4]  *movdi_internal/3
+	movzbl	%al, %eax	# 2580	[c=4 l=3]  zero_extendqidi2/0
+	orl	$30, %edx	# 15008	[c=4 l=3]  *iorsi_1/0
+	andb	(%rsi), %cl	# 2577	[c=9 l=2]  *andqi_1/1
+	leaq	flag_update_table_logical(%rip), %rsi	# 12732	[c=1 l=7]  *movdi_internal/4
+	orb	(%rsi,%rax), %cl	# 2583	[c=13 l=3]  *iorqi_1/1
+	leaq	101(%rbx), %rax	# 15009	[c=4 l=4]  *leadi
+	movb	%cl, 101(%rbx)	# 2584	[c=4 l=3]  *movqi_internal/8
+	jmp	.L731	# 17364	[c=1 l=5]  jump
+.L944:
+	movq	104(%rbx), %rsi	# 5360	[c=9 l=4]  *movdi_internal/3
+	cltq	# 5363	[c=4 l=2]  *extendsidi2_rex64/0
+	orl	$31, %edx	# 14941	[c=4 l=3]  *iorsi_1/0
+	andb	(%rsi), %cl	# 5361	[c=9 l=2]  *andqi_1/1
+	leaq	flag_update_table_ror8(%rip), %rsi	# 12737	[c=1 l=7]  *movdi_internal/4
+	orb	(%rsi,%rax), %cl	# 5366	[c=13 l=3]  *iorqi_1/1
+	leaq	101(%rbx), %rax	# 14942	[c=4 l=4]  *leadi
+	movb	%cl, 101(%rbx)	# 5367	[c=4 l=3]  *movqi_internal/8
+	jmp	.L945	# 17366	[c=1 l=5]  jump
+.L919:
+	movq	1040(%rbx), %rax	# 5061	[c=9 l=7]  *movdi_internal/3
+	movl	$94, %ecx	# 5063	[c=4 l=5]  *movsi_internal/0
+	subl	%r15d, %ecx	# 5064	[c=4 l=3]  *subsi_1/0
+	movzbl	93(%rax), %r14d	# 5062	[c=13 l=5]  *zero_extendqisi2/0
+	cmpl	%edx, %ecx	# 5065	[c=4 l=2]  *cmpsi_1/0
+	jb	.L921	# 5066	[c=13 l=6]  *jcc
+	cmpb	$1, 1082(%rbx)	# 5070	[c=13 l=7]  *cmpqi_1/0
+	jbe	.L921	# 5071	[c=13 l=6]  *jcc
+.L922:
+	movl	$94, %esi	# 5074	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 5075	[c=4 l=3]  *movdi_internal/3
+	movl	%edx, 16(%rsp)	# 14273	[c=4 l=4]  *movsi_internal/1
+	call	data_read_mapped	# 5076	[c=10 l=5]  *call_value
+	movl	16(%rsp), %edx	# 14274	[c=9 l=4]  *movsi_internal/0
+	leaq	flag_update_table_add8(%rip), %r10	# 14276	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_sub8(%rip), %r11	# 14278	[c=1 l=7]  *movdi_internal/4
+	movl	%eax, %r13d	# 5077	[c=4 l=3]  *movsi_internal/0
+	jmp	.L923	# 17368	[c=1 l=5]  jump
+.L850:
+	movq	104(%rbx), %rsi	# 4277	[c=9 l=4]  *movdi_internal/3
+	movzbl	%al, %eax	# 4281	[c=4 l=3]  zero_extendqidi2/0
+	orl	$30, %edx	# 14959	[c=4 l=3]  *iorsi_1/0
+	andb	(%rsi), %cl	# 4278	[c=9 l=2]  *andqi_1/1
+	leaq	flag_update_table_logical(%rip), %rsi	# 12735	[c=1 l=7]  *movdi_internal/4
+	orb	(%rsi,%rax), %cl	# 4284	[c=13 l=3]  *iorqi_1/1
+	leaq	101(%rbx), %rax	# 14960	[c=4 l=4]  *leadi
+	movb	%cl, 101(%rbx)	# 4285	[c=4 l=3]  *movqi_internal/8
+	jmp	.L851	# 17370	[c=1 l=5]  jump
+.L846:
+	movq	104(%rbx), %rsi	# 4217	[c=9 l=4]  *movdi_internal/3
+	orl	$63, %ecx	# 14961	[c=4 l=3]  *iorsi_1/0
+	andb	(%rsi), %al	# 4218	[c=9 l=2]  *andqi_1/1
+	movl	%eax, %esi	# 13153	[c=4 l=2]  *movqi_internal/1
+	leaq	flag_update_table_sub8(%rip), %rax	# 4219	[c=1 l=7]  *movdi_internal/4
+	orb	(%rax,%rdx), %sil	# 4223	[c=13 l=4]  *iorqi_1/1
+	leaq	101(%rbx), %rax	# 14962	[c=4 l=4]  *leadi
+	movb	%sil, 101(%rbx)	# 4224	[c=4 l=4]  *movqi_internal/8
+	jmp	.L847	# 17372	[c=1 l=5]  jump
+.L897:
+	movq	1040(%rbx), %rax	# 4832	[c=9 l=7]  *movdi_internal/3
+	movl	$94, %ecx	# 4834	[c=4 l=5]  *movsi_internal/0
+	subl	%r15d, %ecx	# 4835	[c=4 l=3]  *subsi_1/0
+	movzbl	93(%rax), %r14d	# 4833	[c=13 l=5]  *zero_extendqisi2/0
+	cmpl	%edx, %ecx	# 4836	[c=4 l=2]  *cmpsi_1/0
+	jb	.L899	# 4837	[c=13 l=6]  *jcc
+	cmpb	$1, 1082(%rbx)	# 4841	[c=13 l=7]  *cmpqi_1/0
+	jbe	.L899	# 4842	[c=13 l=6]  *jcc
+.L900:
+	movl	$94, %esi	# 4845	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 4846	[c=4 l=3]  *movdi_internal/3
+	movl	%edx, 16(%rsp)	# 14237	[c=4 l=4]  *movsi_internal/1
+	call	data_read_mapped	# 4847	[c=10 l=5]  *call_value
+	movl	16(%rsp), %edx	# 14238	[c=9 l=4]  *movsi_internal/0
+	leaq	flag_update_table_add8(%rip), %r10	# 14240	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_sub8(%rip), %r11	# 14242	[c=1 l=7]  *movdi_internal/4
+	movl	%eax, %r13d	# 4848	[c=4 l=3]  *movsi_internal/0
+	jmp	.L901	# 17374	[c=1 l=5]  jump
+.L853:
+	movq	104(%rbx), %rsi	# 4325	[c=9 l=4]  *movdi_internal/3
+	cltq	# 4328	[c=4 l=2]  *extendsidi2_rex64/0
+	orl	$30, %edx	# 14957	[c=4 l=3]  *iorsi_1/0
+	andb	(%rsi), %cl	# 4326	[c=9 l=2]  *andqi_1/1
+	leaq	flag_update_table_logical(%rip), %rsi	# 12736	[c=1 l=7]  *movdi_internal/4
+	orb	(%rsi,%rax), %cl	# 4331	[c=13 l=3]  *iorqi_1/1
+	leaq	101(%rbx), %rax	# 14958	[c=4 l=4]  *leadi
+	movb	%cl, 101(%rbx)	# 4332	[c=4 l=3]  *movqi_internal/8
+	jmp	.L854	# 17376	[c=1 l=5]  jump
+.L609:
+	movq	104(%rbx), %rsi	# 913	[c=9 l=4]  *movdi_internal/3
+	movzbl	%al, %eax	# 917	[c=4 l=3]  zero_extendqidi2/0
+	orl	$30, %edx	# 15045	[c=4 l=3]  *iorsi_1/0
+	andb	(%rsi), %cl	# 914	[c=9 l=2]  *andqi_1/1
+	leaq	flag_update_table_logical(%rip), %rsi	# 12727	[c=1 l=7]  *movdi_internal/4
+	orb	(%rsi,%rax), %cl	# 920	[c=13 l=3]  *iorqi_1/1
+	leaq	101(%rbx), %rax	# 15046	[c=4 l=4]  *leadi
+	movb	%cl, 101(%rbx)	# 921	[c=4 l=3]  *movqi_internal/8
+	jmp	.L610	# 17378	[c=1 l=5]  jump
+.L1070:
+	movq	104(%rbx), %rsi	# 7111	[c=9 l=4]  *movdi_internal/3
+	orl	$63, %edx	# 14912	[c=4 l=3]  *iorsi_1/0
+	movzbl	(%rsi), %edi	# 16786	[c=5 l=3]  *movqi_internal/4
+	andl	%ecx, %edi	# 17531	[c=4 l=2]  *andsi_1/0
+	leaq	flag_update_table_add8(%rip), %rcx	# 7113	[c=1 l=7]  *movdi_internal/4
+	movl	%edi, %esi	# 13367	[c=4 l=2]  *movqi_internal/1
+	orb	(%rcx,%rax), %sil	# 7117	[c=13 l=4]  *iorqi_1/1
+	leaq	101(%rbx), %rax	# 14913	[c=4 l=4]  *leadi
+	movb	%sil, 101(%rbx)	# 7118	[c=4 l=4]  *movqi_internal/8
+	jmp	.L1071	# 17380	[c=1 l=5]  jump
+.L1067:
+	movq	104(%rbx), %rsi	# 7048	[c=9 l=4]  *movdi_internal/3
+	orl	$63, %edx	# 14914	[c=4 l=3]  *iorsi_1/0
+	movzbl	(%rsi), %edi	# 16788	[c=5 l=3]  *movqi_internal/4
+	andl	%ecx, %edi	# 17530	[c=4 l=2]  *andsi_1/0
+	leaq	flag_update_table_add8(%rip), %rcx	# 7050	[c=1 l=7]  *movdi_internal/4
+	movl	%edi, %esi	# 13361	[c=4 l=2]  *movqi_internal/1
+	orb	(%rcx,%rax), %sil	# 7054	[c=13 l=4]  *iorqi_1/1
+	leaq	101(%rbx), %rax	# 14915	[c=4 l=4]  *leadi
+	movb	%sil, 101(%rbx)	# 7055	[c=4 l=4]  *movqi_internal/8
+	jmp	.L1068	# 17382	[c=1 l=5]  jump
+.L604:
+	movq	104(%rbx), %rsi	# 759	[c=9 l=4]  *movdi_internal/3
+	orl	$63, %edx	# 15059	[c=4 l=3]  *iorsi_1/0
+	movzbl	(%rsi), %edi	# 16922	[c=5 l=3]  *movqi_internal/4
+	andl	%ecx, %edi	# 17529	[c=4 l=2]  *andsi_1/0
+	leaq	flag_update_table_add8(%rip), %rcx	# 761	[c=1 l=7]  *movdi_internal/4
+	movl	%edi, %esi	# 12868	[c=4 l=2]  *movqi_internal/1
+	orb	(%rcx,%rax), %sil	# 765	[c=13 l=4]  *iorqi_1/1
+	leaq	101(%rbx), %rax	# 15060	[c=4 l=4]  *leadi
+	movb	%sil, 101(%rbx)	# 766	[c=4 l=4]  *movqi_internal/8
+	jmp	.L605	# 17384	[c=1 l=5]  jump
+.L1273:
+	movq	1040(%rbx), %rax	# 11059	[c=9 l=7]  *movdi_internal/3
+	movl	$94, %esi	# 11061	[c=4 l=5]  *movsi_internal/0
+	subl	%edx, %esi	# 11062	[c=4 l=2]  *subsi_1/0
+	movzbl	93(%rax), %r8d	# 11060	[c=13 l=5]  *zero_extendqisi2/0
+	cmpl	%r13d, %esi	# 11063	[c=4 l=3]  *cmpsi_1/0
+	jb	.L1275	# 11064	[c=13 l=6]  *jcc
+	cmpb	$1, 1082(%rbx)	# 11068	[c=13 l=7]  *cmpqi_1/0
+	jbe	.L1275	# 11069	[c=13 l=6]  *jcc
+.L1276:
+	movl	$94, %esi	# 11072	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 11073	[c=4 l=3]  *movdi_internal/3
+	movl	%r8d, 24(%rsp)	# 14670	[c=4 l=5]  *movsi_internal/1
+	movq	%rcx, 16(%rsp)	# 14668	[c=4 l=5]  *movdi_internal/5
+	call	data_read_mapped	# 11074	[c=10 l=5]  *call_value
+	movq	16(%rsp), %rcx	# 14669	[c=9 l=5]  *movdi_internal/3
+	movl	24(%rsp), %r8d	# 14671	[c=9 l=5]  *movsi_internal/0
+	leaq	flag_update_table_add8(%rip), %r10	# 14673	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_sub8(%rip), %r11	# 14675	[c=1 l=7]  *movdi_internal/4
+	jmp	.L1277	# 17386	[c=1 l=5]  jump
+.L1600:
+	xorl	%r13d, %r13d	# 16809	[c=4 l=3]  *movsi_xor
+	movq	%rbx, %rdi	# 5919	[c=4 l=3]  *movdi_internal/3
+	movl	%r13d, 96(%rbx)	# 16810	[c=4 l=4]  *movsi_internal/1
+	call	do_events	# 5920	[c=0 l=5]  *call
+	leaq	flag_update_table_sub8(%rip), %r11	# 14352	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 14350	[c=1 l=7]  *movdi_internal/4
+	jmp	.L983	# 17388	[c=1 l=5]  jump
+.L1602:
+	xorl	%r10d, %r10d	# 16805	[c=4 l=3]  *movsi_xor
+	movq	%rbx, %rdi	# 6019	[c=4 l=3]  *movdi_internal/3
+	movl	%r10d, 96(%rbx)	# 16806	[c=4 l=4]  *movsi_internal/1
+	call	do_events	# 6020	[c=0 l=5]  *call
+	leaq	flag_update_table_sub8(%rip), %r11	# 14360	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 14358	[c=1 l=7]  *movdi_internal/4
+	jmp	.L989	# 17390	[c=1 l=5]  jump
+.L1601:
+	xorl	%r11d, %r11d	# 16807	[c=4 l=3]  *movsi_xor
+	movq	%rbx, %rdi	# 5969	[c=4 l=3]  *movdi_internal/3
+	movl	%r11d, 96(%rbx)	# 16808	[c=4 l=4]  *movsi_internal/1
+	call	do_events	# 5970	[c=0 l=5]  *call
+	leaq	flag_update_table_sub8(%rip), %r11	# 14356	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 14354	[c=1 l=7]  *movdi_internal/4
+	jmp	.L986	# 17392	[c=1 l=5]  jump
+.L1604:
+	xorl	%r9d, %r9d	# 16803	[c=4 l=3]  *movsi_xor
+	movq	%rbx, %rdi	# 6069	[c=4 l=3]  *movdi_internal/3
+	movl	%r9d, 96(%rbx)	# 16804	[c=4 l=4]  *movsi_internal/1
+	call	do_events	# 6070	[c=0 l=5]  *call
+	leaq	flag_update_table_sub8(%rip), %r11	# 14364	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 14362	[c=1 l=7]  *movdi_internal/4
+	jmp	.L992	# 17394	[c=1 l=5]  jump
+.L1593:
+	xorl	%eax, %eax	# 16815	[c=4 l=2]  *movsi_xor
+	movq	%rbx, %rdi	# 5723	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, 96(%rbx)	# 16816	[c=4 l=3]  *movsi_internal/1
+	call	do_events	# 5724	[c=0 l=5]  *call
+	leaq	flag_update_table_sub8(%rip), %r11	# 14332	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 14330	[c=1 l=7]  *movdi_internal/4
+	jmp	.L968	# 17396	[c=1 l=5]  jump
+.L1592:
+	xorl	%eax, %eax	# 16819	[c=4 l=2]  *movsi_xor
+	movq	%rbx, %rdi	# 5306	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, 96(%rbx)	# 16820	[c=4 l=3]  *movsi_internal/1
+	call	do_events	# 5307	[c=0 l=5]  *call
+	leaq	flag_update_table_sub8(%rip), %r11	# 14306	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 14304	[c=1 l=7]  *movdi_internal/4
+	jmp	.L942	# 17398	[c=1 l=5]  jump
+.L1576:
+	xorl	%edi, %edi	# 16859	[c=4 l=2]  *movsi_xor
+	movl	%edi, 96(%rbx)	# 16860	[c=4 l=3]  *movsi_internal/1
+	movq	%rbx, %rdi	# 3164	[c=4 l=3]  *movdi_internal/3
+	call	do_events	# 3165	[c=0 l=5]  *call
+	leaq	flag_update_table_sub8(%rip), %r11	# 14090	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 14088	[c=1 l=7]  *movdi_internal/4
+	jmp	.L775	# 17400	[c=1 l=5]  jump
+.L1603:
+	xorl	%r8d, %r8d	# 16800	[c=4 l=3]  *movsi_xor
+	movq	%rbx, %rdi	# 6151	[c=4 l=3]  *movdi_internal/3
+	movl	%r8d, 96(%rbx)	# 16801	[c=4 l=4]  *movsi_internal/1
+	call	do_events	# 6152	[c=0 l=5]  *call
+	leaq	flag_update_table_sub8(%rip), %r11	# 14372	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 14370	[c=1 l=7]  *movdi_internal/4
+	jmp	.L997	# 17402	[c=1 l=5]  jump
+.L1608:
+	xorl	%esi, %esi	# 16753	[c=4 l=2]  *movsi_xor
+	movq	%rbx, %rdi	# 10471	[c=4 l=3]  *movdi_internal/3
+	movl	%esi, 96(%rbx)	# 16754	[c=4 l=3]  *movsi_internal/1
+	call	do_events	# 10472	[c=0 l=5]  *call
+	leaq	flag_update_table_sub8(%rip), %r11	# 14571	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 14569	[c=1 l=7]  *movdi_internal/4
+	jmp	.L1232	# 17404	[c=1 l=5]  jump
+.L1578:
+	xorl	%r8d, %r8d	# 16879	[c=4 l=3]  *movsi_xor
+	movq	%rbx, %rdi	# 2784	[c=4 l=3]  *movdi_internal/3
+	movl	%r8d, 96(%rbx)	# 16880	[c=4 l=4]  *movsi_internal/1
+	call	do_events	# 2785	[c=0 l=5]  *call
+	leaq	flag_update_table_sub8(%rip), %r11	# 14056	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 14054	[c=1 l=7]  *movdi_internal/4
+	jmp	.L748	# 17406	[c=1 l=5]  jump
+.L1590:
+	xorl	%eax, %eax	# 16823	[c=4 l=2]  *movsi_xor
+	movq	%rbx, %rdi	# 5253	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, 96(%rbx)	# 16824	[c=4 l=3]  *movsi_internal/1
+	call	do_events	# 5254	[c=0 l=5]  *call
+	leaq	flag_update_table_sub8(%rip), %r11	# 14302	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 14300	[c=1 l=7]  *movdi_internal/4
+	jmp	.L939	# 17408	[c=1 l=5]  jump
+.L1605:
+	xorl	%edi, %edi	# 16796	[c=4 l=2]  *movsi_xor
+	movl	%edi, 96(%rbx)	# 16797	[c=4 l=3]  *movsi_internal/1
+	movq	%rbx, %rdi	# 6320	[c=4 l=3]  *movdi_internal/3
+	call	do_events	# 6321	[c=0 l=5]  *call
+	leaq	flag_update_table_sub8(%rip), %r11	# 14402	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 14400	[c=1 l=7]  *movdi_internal/4
+	jmp	.L1011	# 17410	[c=1 l=5]  jump
+.L1572:
+	xorl	%esi, %esi	# 16857	[c=4 l=2]  *movsi_xor
+	movq	%rbx, %rdi	# 3209	[c=4 l=3]  *movdi_internal/3
+	movl	%esi, 96(%rbx)	# 16858	[c=4 l=3]  *movsi_internal/1
+	call	do_events	# 3210	[c=0 l=5]  *call
+	leaq	flag_update_table_sub8(%rip), %r11	# 14094	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 14092	[c=1 l=7]  *movdi_internal/4
+	jmp	.L778	# 17412	[c=1 l=5]  jump
+.L1571:
+	xorl	%r9d, %r9d	# 16885	[c=4 l=3]  *movsi_xor
+	movq	%rbx, %rdi	# 2362	[c=4 l=3]  *movdi_internal/3
+	movl	%r9d, 96(%rbx)	# 16886	[c=4 l=4]  *movsi_internal/1
+	call	do_events	# 2363	[c=0 l=5]  *call
+	leaq	flag_update_table_sub8(%rip), %r11	# 14002	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 14000	[c=1 l=7]  *movdi_internal/4
+	jmp	.L713	# 17414	[c=1 l=5]  jump
+.L1570:
+	xorl	%r10d, %r10d	# 16887	[c=4 l=3]  *movsi_xor
+	movq	%rbx, %rdi	# 2273	[c=4 l=3]  *movdi_internal/3
+	movl	%r10d, 96(%rbx)	# 16888	[c=4 l=4]  *movsi_internal/1
+	call	do_events	# 2274	[c=0 l=5]  *call
+	leaq	flag_update_table_sub8(%rip), %r11	# 13994	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 13992	[c=1 l=7]  *movdi_internal/4
+	jmp	.L706	# 17416	[c=1 l=5]  jump
+.L1566:
+	xorl	%r11d, %r11d	# 16891	[c=4 l=3]  *movsi_xor
+	movq	%rbx, %rdi	# 1919	[c=4 l=3]  *movdi_internal/3
+	movl	%r11d, 96(%rbx)	# 16892	[c=4 l=4]  *movsi_internal/1
+	call	do_events	# 1920	[c=0 l=5]  *call
+	leaq	flag_update_table_sub8(%rip), %r11	# 13954	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 13952	[c=1 l=7]  *movdi_internal/4
+	jmp	.L675	# 17418	[c=1 l=5]  jump
+.L1565:
+	xorl	%r13d, %r13d	# 16893	[c=4 l=3]  *movsi_xor
+	movq	%rbx, %rdi	# 1870	[c=4 l=3]  *movdi_internal/3
+	movl	%r13d, 96(%rbx)	# 16894	[c=4 l=4]  *movsi_internal/1
+	call	do_events	# 1871	[c=0 l=5]  *call
+	leaq	flag_update_table_sub8(%rip), %r11	# 13950	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 13948	[c=1 l=7]  *movdi_internal/4
+	jmp	.L672	# 17420	[c=1 l=5]  jump
+.L1594:
+	xorl	%r15d, %r15d	# 16813	[c=4 l=3]  *movsi_xor
+	movq	%rbx, %rdi	# 5796	[c=4 l=3]  *movdi_internal/3
+	movl	%r15d, 96(%rbx)	# 16814	[c=4 l=4]  *movsi_internal/1
+	call	do_events	# 5797	[c=0 l=5]  *call
+	leaq	flag_update_table_sub8(%rip), %r11	# 14340	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 14338	[c=1 l=7]  *movdi_internal/4
+	jmp	.L974	# 17422	[c=1 l=5]  jump
+.L1615:
+	xorl	%r14d, %r14d	# 16898	[c=4 l=3]  *movsi_xor
+	movq	%rbx, %rdi	# 1539	[c=4 l=3]  *movdi_internal/3
+	movl	%r14d, 96(%rbx)	# 16899	[c=4 l=4]  *movsi_internal/1
+	call	do_events	# 1540	[c=0 l=5]  *call
+	leaq	flag_update_table_sub8(%rip), %r11	# 13936	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 13934	[c=1 l=7]  *movdi_internal/4
+	jmp	.L652	# 17424	[c=1 l=5]  jump
+.L1610:
+	xorl	%eax, %eax	# 16908	[c=4 l=2]  *movsi_xor
+	movq	%rbx, %rdi	# 1108	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, 96(%rbx)	# 16909	[c=4 l=3]  *movsi_internal/1
+	call	do_events	# 1109	[c=0 l=5]  *call
+	leaq	flag_update_table_sub8(%rip), %r11	# 13882	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 13880	[c=1 l=7]  *movdi_internal/4
+	jmp	.L621	# 17426	[c=1 l=5]  jump
+.L1597:
+	xorl	%eax, %eax	# 16817	[c=4 l=2]  *movsi_xor
+	movq	%rbx, %rdi	# 5650	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, 96(%rbx)	# 16818	[c=4 l=3]  *movsi_internal/1
+	call	do_events	# 5651	[c=0 l=5]  *call
+	leaq	flag_update_table_sub8(%rip), %r11	# 14324	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 14322	[c=1 l=7]  *movdi_internal/4
+	jmp	.L962	# 17428	[c=1 l=5]  jump
+.L1596:
+	xorl	%ecx, %ecx	# 16855	[c=4 l=2]  *movsi_xor
+	movq	%rbx, %rdi	# 3348	[c=4 l=3]  *movdi_internal/3
+	movl	%ecx, 96(%rbx)	# 16856	[c=4 l=3]  *movsi_internal/1
+	call	do_events	# 3349	[c=0 l=5]  *call
+	leaq	flag_update_table_sub8(%rip), %r11	# 14102	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 14100	[c=1 l=7]  *movdi_internal/4
+	jmp	.L788	# 17430	[c=1 l=5]  jump
+.L1595:
+	xorl	%r14d, %r14d	# 16811	[c=4 l=3]  *movsi_xor
+	movq	%rbx, %rdi	# 5869	[c=4 l=3]  *movdi_internal/3
+	movl	%r14d, 96(%rbx)	# 16812	[c=4 l=4]  *movsi_internal/1
+	call	do_events	# 5870	[c=0 l=5]  *call
+	leaq	flag_update_table_sub8(%rip), %r11	# 14348	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 14346	[c=1 l=7]  *movdi_internal/4
+	jmp	.L980	# 17432	[c=1 l=5]  jump
+.L1582:
+	xorl	%edx, %edx	# 16831	[c=4 l=2]  *movsi_xor
+	movq	%rbx, %rdi	# 4783	[c=4 l=3]  *movdi_internal/3
+	movl	%edx, 96(%rbx)	# 16832	[c=4 l=3]  *movsi_internal/1
+	call	do_events	# 4784	[c=0 l=5]  *call
+	leaq	flag_update_table_sub8(%rip), %r11	# 14230	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 14228	[c=1 l=7]  *movdi_internal/4
+	jmp	.L895	# 17434	[c=1 l=5]  jump
+.L1586:
+	xorl	%eax, %eax	# 16828	[c=4 l=2]  *movsi_xor
+	movq	%rbx, %rdi	# 5012	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, 96(%rbx)	# 16829	[c=4 l=3]  *movsi_internal/1
+	call	do_events	# 5013	[c=0 l=5]  *call
+	leaq	flag_update_table_sub8(%rip), %r11	# 14266	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 14264	[c=1 l=7]  *movdi_internal/4
+	jmp	.L917	# 17436	[c=1 l=5]  jump
+.L1609:
+	leaq	.LC43(%rip), %rdx	# 358	[c=1 l=7]  *movdi_internal/4
+	movl	$1, %esi	# 360	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 361	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 16938	[c=4 l=2]  *movdi_xor
+	call	leave	# 363	[c=0 l=5]  *call
+.L1616:
+	xorl	%eax, %eax	# 16924	[c=4 l=2]  *movsi_xor
+	movq	%rbx, %rdi	# 632	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, 96(%rbx)	# 16925	[c=4 l=3]  *movsi_internal/1
+	call	do_events	# 633	[c=0 l=5]  *call
+	leaq	flag_update_table_sub8(%rip), %r11	# 13878	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 13876	[c=1 l=7]  *movdi_internal/4
+	jmp	.L598	# 17438	[c=1 l=5]  jump
+.L1599:
+	movl	8(%rcx), %eax	# 11089	[c=10 l=3]  *zero_extendsidi2/3
+	movq	(%rcx), %r13	# 11096	[c=5 l=3]  *movdi_internal/3
+	leaq	.LC38(%rip), %r8	# 73	[c=1 l=7]  *movdi_internal/4
+	movq	1040(%rbx), %rdx	# 11104	[c=9 l=7]  *movdi_internal/3
+	salq	$4, %rax	# 11091	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %rax	# 11092	[c=13 l=7]  *adddi_1/1
+	movq	%r14, (%rax)	# 11093	[c=4 l=3]  *movdi_internal/5
+	movzbl	11(%r15), %eax	# 11094	[c=9 l=5]  *movqi_internal/4
+	movb	%al, 16(%rsp)	# 13826	[c=4 l=4]  *movqi_internal/8
+	movzwl	14(%r15), %eax	# 11095	[c=9 l=5]  *movhi_internal/2
+	movw	%ax, 24(%rsp)	# 13827	[c=4 l=5]  *movhi_internal/3
+	movq	40(%rbx), %rax	# 11097	[c=9 l=4]  *movdi_internal/3
+	movq	%rax, 32(%rsp)	# 13828	[c=4 l=5]  *movdi_internal/5
+	movq	32(%rcx), %rax	# 11098	[c=9 l=4]  *movdi_internal/3
+	movq	%rax, 40(%rsp)	# 13829	[c=4 l=5]  *movdi_internal/5
+	movq	48(%rbx), %rax	# 11099	[c=9 l=4]  *movdi_internal/3
+	movq	%rax, 48(%rsp)	# 13830	[c=4 l=5]  *movdi_internal/5
+	movq	40(%rcx), %rax	# 11100	[c=9 l=4]  *movdi_internal/3
+	movq	%rax, 56(%rsp)	# 13831	[c=4 l=5]  *movdi_internal/5
+	xorl	%eax, %eax	# 16743	[c=4 l=2]  *movdi_xor
+	movq	%rax, (%rcx)	# 16744	[c=4 l=3]  *movdi_internal/5
+	movq	96(%rcx), %rax	# 11103	[c=9 l=4]  *movdi_internal/3
+	addl	$1, 112(%r13)	# 11102	[c=13 l=5]  *addsi_1/0
+	movzbl	95(%rdx), %edx	# 11105	[c=9 l=4]  *movqi_internal/4
+	movb	%dl, 95(%rax)	# 11106	[c=4 l=3]  *movqi_internal/8
+	movq	1040(%rbx), %rdi	# 11107	[c=9 l=7]  *movdi_internal/3
+	movzbl	100(%rbx), %esi	# 11108	[c=13 l=4]  *zero_extendqisi2/0
+	movzbl	95(%rdi), %edx	# 11109	[c=13 l=4]  *zero_extendqisi2/0
+	movl	%esi, %eax	# 15531	[c=4 l=2]  *movsi_internal/0
+	notl	%esi	# 11111	[c=4 l=2]  *one_cmplsi2_1/0
+	andl	%esi, %edx	# 11112	[c=4 l=2]  *andsi_1/0
+	movq	104(%rbx), %rsi	# 11113	[c=9 l=4]  *movdi_internal/3
+	andb	(%rsi), %al	# 11114	[c=9 l=2]  *andqi_1/1
+	movzbl	%al, %eax	# 11115	[c=4 l=3]  *zero_extendqisi2/0
+	orl	%edx, %eax	# 11116	[c=4 l=2]  *iorsi_1/0
+	movzbl	72(%rcx), %edx	# 11117	[c=13 l=4]  *zero_extendqisi2/0
+	cmpl	%edx, %eax	# 11118	[c=4 l=2]  *cmpsi_1/0
+	je	.L1621	# 11119	[c=13 l=6]  *jcc
+.L1278:
+	cmpl	$0, 600(%rbx)	# 11196	[c=13 l=7]  *cmpsi_ccno_1/1
+	movb	$1, 48(%r13)	# 11194	[c=4 l=5]  *movqi_internal/8
+	je	.L575	# 11197	[c=13 l=6]  *jcc
+	movq	0(%r13), %rdx	# 11199	[c=5 l=4]  *movdi_internal/3
+	movl	36(%r13), %ecx	# 11200	[c=9 l=4]  *movsi_internal/0
+	leaq	.LC55(%rip), %rsi	# 11207	[c=1 l=7]  *movdi_internal/4
+	xorl	%eax, %eax	# 16742	[c=4 l=2]  *movdi_xor
+	movq	904(%rbx), %rdi	# 11202	[c=9 l=7]  *movdi_internal/3
+	addl	%ecx, %ecx	# 11201	[c=4 l=2]  *ashlsi3_1/0
+	movq	%rdx, %r9	# 11203	[c=4 l=3]  *movdi_internal/3
+	call	fprintf@PLT	# 11211	[c=10 l=5]  *call_value
+	leaq	flag_update_table_add8(%rip), %r10	# 14705	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_sub8(%rip), %r11	# 14707	[c=1 l=7]  *movdi_internal/4
+	movq	%r12, %rdx	# 15811	[c=4 l=3]  *movdi_internal/3
+	movq	%r10, %rcx	# 15810	[c=4 l=3]  *movdi_internal/3
+	movq	%r11, %rax	# 15812	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 15813	[c=4 l=3]  *indirect_jump
+.L739:
+	movq	1040(%rbx), %rdx	# 2678	[c=9 l=7]  *movdi_internal/3
+	leal	-2(%rcx), %eax	# 15006	[c=4 l=3]  *leasi
+	andl	%r14d, %eax	# 2677	[c=4 l=3]  *andsi_1/0
+	movzbl	(%rdx), %ecx	# 2679	[c=5 l=3]  *movqi_internal/4
+	movl	%eax, %edx	# 2680	[c=1 l=2]  *zero_extendsidi2/3
+	addl	$1, %eax	# 16883	[c=5 l=3]  addsi_1_zext/0
+	movb	%cl, 6052(%rbx,%rdx)	# 2681	[c=4 l=7]  *movqi_internal/8
+	movq	1040(%rbx), %rdx	# 2682	[c=9 l=7]  *movdi_internal/3
+	movzbl	1(%rdx), %edx	# 2683	[c=9 l=4]  *movqi_internal/4
+	movb	%dl, 6052(%rbx,%rax)	# 2686	[c=4 l=7]  *movqi_internal/8
+	jmp	.L741	# 17441	[c=1 l=5]  jump
+.L1005:
+	movq	1040(%rbx), %rdx	# 6248	[c=9 l=7]  *movdi_internal/3
+	leal	-2(%r14), %eax	# 14929	[c=4 l=4]  *leasi
+	andl	%r8d, %eax	# 6247	[c=4 l=3]  *andsi_1/0
+	movzbl	(%rdx), %ecx	# 6249	[c=5 l=3]  *movqi_internal/4
+	movl	%eax, %edx	# 6250	[c=1 l=2]  *zero_extendsidi2/3
+	addl	$1, %eax	# 16799	[c=5 l=3]  addsi_1_zext/0
+	movb	%cl, 6052(%rbx,%rdx)	# 6251	[c=4 l=7]  *movqi_internal/8
+	movq	1040(%rbx), %rdx	# 6252	[c=9 l=7]  *movdi_internal/3
+	movzbl	1(%rdx), %edx	# 6253	[c=9 l=4]  *movqi_internal/4
+	movb	%dl, 6052(%rbx,%rax)	# 6256	[c=4 l=7]  *movqi_internal/8
+	jmp	.L1007	# 17443	[c=1 l=5]  jump
+.L1577:
+	movl	%ecx, %edx	# 11463	[c=1 l=2]  *zero_extendsidi2/3
+	jmp	.L737	# 17445	[c=1 l=5]  jump
+.L1583:
+	movl	$93, %esi	# 4819	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 4820	[c=4 l=3]  *movdi_internal/3
+	movl	%edx, 16(%rsp)	# 14231	[c=4 l=4]  *movsi_internal/1
+	call	data_read_mapped	# 4821	[c=10 l=5]  *call_value
+	movl	16(%rsp), %edx	# 14232	[c=9 l=4]  *movsi_internal/0
+	leaq	flag_update_table_add8(%rip), %r10	# 14234	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_sub8(%rip), %r11	# 14236	[c=1 l=7]  *movdi_internal/4
+	movl	%eax, %r14d	# 4822	[c=4 l=3]  *movsi_internal/0
+	movl	$94, %eax	# 4823	[c=4 l=5]  *movsi_internal/0
+	subl	%r15d, %eax	# 4824	[c=4 l=3]  *subsi_1/0
+	cmpl	%edx, %eax	# 4825	[c=4 l=2]  *cmpsi_1/0
+	jnb	.L900	# 4826	[c=13 l=6]  *jcc
+	movq	1040(%rbx), %rax	# 11478	[c=9 l=7]  *movdi_internal/3
+	jmp	.L899	# 17447	[c=1 l=5]  jump
+.L1553:
+	movl	$93, %esi	# 9377	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 9378	[c=4 l=3]  *movdi_internal/3
+	movb	%cl, 16(%rsp)	# 14467	[c=4 l=4]  *movqi_internal/8
+	call	data_read_mapped	# 9379	[c=10 l=5]  *call_value
+	movzbl	16(%rsp), %ecx	# 14468	[c=9 l=5]  *movqi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 14470	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_sub8(%rip), %r11	# 14472	[c=1 l=7]  *movdi_internal/4
+	movl	%eax, %edx	# 9380	[c=4 l=2]  *movsi_internal/0
+	movl	$94, %eax	# 9381	[c=4 l=5]  *movsi_internal/0
+	subl	%r14d, %eax	# 9382	[c=4 l=3]  *subsi_1/0
+	cmpl	%r15d, %eax	# 9383	[c=4 l=3]  *cmpsi_1/0
+	jnb	.L1159	# 9384	[c=13 l=6]  *jcc
+	jmp	.L1158	# 17450	[c=1 l=5]  jump
+.L1611:
+	movl	$93, %esi	# 1327	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 1328	[c=4 l=3]  *movdi_internal/3
+	movl	%edx, 16(%rsp)	# 13891	[c=4 l=4]  *movsi_internal/1
+	call	data_read_mapped	# 1329	[c=10 l=5]  *call_value
+	movl	16(%rsp), %edx	# 13892	[c=9 l=4]  *movsi_internal/0
+	leaq	flag_update_table_add8(%rip), %r10	# 13894	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_sub8(%rip), %r11	# 13896	[c=1 l=7]  *movdi_internal/4
+	movl	%eax, %ecx	# 1330	[c=4 l=2]  *movsi_internal/0
+	movl	$94, %eax	# 1331	[c=4 l=5]  *movsi_internal/0
+	subl	%r15d, %eax	# 1332	[c=4 l=3]  *subsi_1/0
+	cmpl	%edx, %eax	# 1333	[c=4 l=2]  *cmpsi_1/0
+	jnb	.L634	# 1334	[c=13 l=6]  *jcc
+	movq	1040(%rbx), %rax	# 11458	[c=9 l=7]  *movdi_internal/3
+	jmp	.L633	# 17452	[c=1 l=5]  jump
+.L1567:
+	movl	$93, %esi	# 2046	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 2047	[c=4 l=3]  *movdi_internal/3
+	movl	%edx, 16(%rsp)	# 13955	[c=4 l=4]  *movsi_internal/1
+	call	data_read_mapped	# 2048	[c=10 l=5]  *call_value
+	movl	16(%rsp), %edx	# 13956	[c=9 l=4]  *movsi_internal/0
+	leaq	flag_update_table_add8(%rip), %r10	# 13958	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_sub8(%rip), %r11	# 13960	[c=1 l=7]  *movdi_internal/4
+	movl	%eax, %r15d	# 2049	[c=4 l=3]  *movsi_internal/0
+	cmpl	%r14d, %edx	# 2050	[c=4 l=3]  *cmpsi_1/0
+	jnb	.L685	# 2051	[c=13 l=6]  *jcc
+	movq	1040(%rbx), %rax	# 11459	[c=9 l=7]  *movdi_internal/3
+	jmp	.L684	# 17454	[c=1 l=5]  jump
+.L1579:
+	movl	$93, %esi	# 4576	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 4577	[c=4 l=3]  *movdi_internal/3
+	call	data_read_mapped	# 4578	[c=10 l=5]  *call_value
+	leaq	flag_update_table_add8(%rip), %r10	# 14192	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_sub8(%rip), %r11	# 14194	[c=1 l=7]  *movdi_internal/4
+	movl	%eax, %edx	# 4579	[c=4 l=2]  *movsi_internal/0
+	movl	$94, %eax	# 4580	[c=4 l=5]  *movsi_internal/0
+	subl	%r14d, %eax	# 4581	[c=4 l=3]  *subsi_1/0
+	cmpl	%r15d, %eax	# 4582	[c=4 l=3]  *cmpsi_1/0
+	jnb	.L878	# 4583	[c=13 l=6]  *jcc
+	movq	1040(%rbx), %rax	# 11477	[c=9 l=7]  *movdi_internal/3
+	jmp	.L877	# 17456	[c=1 l=5]  jump
+.L1598:
+	movl	$93, %esi	# 11046	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 11047	[c=4 l=3]  *movdi_internal/3
+	movl	%edx, 24(%rsp)	# 14662	[c=4 l=4]  *movsi_internal/1
+	movq	%rcx, 16(%rsp)	# 14660	[c=4 l=5]  *movdi_internal/5
+	call	data_read_mapped	# 11048	[c=10 l=5]  *call_value
+	movl	24(%rsp), %edx	# 14663	[c=9 l=4]  *movsi_internal/0
+	movq	16(%rsp), %rcx	# 14661	[c=9 l=5]  *movdi_internal/3
+	leaq	flag_update_table_add8(%rip), %r10	# 14665	[c=1 l=7]  *movdi_internal/4
+	movl	%eax, %r8d	# 11049	[c=4 l=3]  *movsi_internal/0
+	movl	$94, %eax	# 11050	[c=4 l=5]  *movsi_internal/0
+	leaq	flag_update_table_sub8(%rip), %r11	# 14667	[c=1 l=7]  *movdi_internal/4
+	subl	%edx, %eax	# 11051	[c=4 l=2]  *subsi_1/0
+	cmpl	%r13d, %eax	# 11052	[c=4 l=3]  *cmpsi_1/0
+	jnb	.L1276	# 11053	[c=13 l=6]  *jcc
+	movq	1040(%rbx), %rax	# 11502	[c=9 l=7]  *movdi_internal/3
+	jmp	.L1275	# 17458	[c=1 l=5]  jump
+.L1587:
+	movl	$93, %esi	# 5048	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 5049	[c=4 l=3]  *movdi_internal/3
+	movl	%edx, 16(%rsp)	# 14267	[c=4 l=4]  *movsi_internal/1
+	call	data_read_mapped	# 5050	[c=10 l=5]  *call_value
+	movl	16(%rsp), %edx	# 14268	[c=9 l=4]  *movsi_internal/0
+	leaq	flag_update_table_add8(%rip), %r10	# 14270	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_sub8(%rip), %r11	# 14272	[c=1 l=7]  *movdi_internal/4
+	movl	%eax, %r14d	# 5051	[c=4 l=3]  *movsi_internal/0
+	movl	$94, %eax	# 5052	[c=4 l=5]  *movsi_internal/0
+	subl	%r15d, %eax	# 5053	[c=4 l=3]  *subsi_1/0
+	cmpl	%edx, %eax	# 5054	[c=4 l=2]  *cmpsi_1/0
+	jnb	.L922	# 5055	[c=13 l=6]  *jcc
+	movq	1040(%rbx), %rax	# 11479	[c=9 l=7]  *movdi_internal/3
+	jmp	.L921	# 17460	[c=1 l=5]  jump
+.L1573:
+	movl	$93, %esi	# 2952	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 2953	[c=4 l=3]  *movdi_internal/3
+	call	data_read_mapped	# 2954	[c=10 l=5]  *call_value
+	leaq	flag_update_table_add8(%rip), %r10	# 14058	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_sub8(%rip), %r11	# 14060	[c=1 l=7]  *movdi_internal/4
+	movl	%eax, %r15d	# 2955	[c=4 l=3]  *movsi_internal/0
+	movl	$94, %eax	# 2956	[c=4 l=5]  *movsi_internal/0
+	subl	%r13d, %eax	# 2957	[c=4 l=3]  *subsi_1/0
+	cmpl	%r14d, %eax	# 2958	[c=4 l=3]  *cmpsi_1/0
+	jnb	.L757	# 2959	[c=13 l=6]  *jcc
+	movq	1040(%rbx), %rax	# 11464	[c=9 l=7]  *movdi_internal/3
+	jmp	.L756	# 17462	[c=1 l=5]  jump
+.L747:
+	movl	%r8d, %edx	# 2769	[c=4 l=3]  *movsi_internal/0
+	movl	$91, %esi	# 2770	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 2771	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 2772	[c=0 l=5]  *call
+	leaq	flag_update_table_sub8(%rip), %r11	# 14052	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 14050	[c=1 l=7]  *movdi_internal/4
+	jmp	.L745	# 17464	[c=1 l=5]  jump
+.L735:
+	movl	$91, %esi	# 2626	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 2627	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 2628	[c=10 l=5]  *call_value
+	jmp	.L736	# 17466	[c=1 l=5]  jump
+.L768:
+	movl	%r13d, %esi	# 3085	[c=4 l=3]  *movsi_internal/0
+	movq	%rbx, %rdi	# 3086	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 3087	[c=0 l=5]  *call
+	leaq	flag_update_table_add8(%rip), %r10	# 14076	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_sub8(%rip), %r11	# 14078	[c=1 l=7]  *movdi_internal/4
+	jmp	.L769	# 17468	[c=1 l=5]  jump
+.L926:
+	movl	%r13d, %esi	# 5110	[c=4 l=3]  *movsi_internal/0
+	movq	%rbx, %rdi	# 5111	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 5112	[c=10 l=5]  *call_value
+	leaq	flag_update_table_sub8(%rip), %r11	# 14282	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 14280	[c=1 l=7]  *movdi_internal/4
+	movl	%eax, %r14d	# 5113	[c=4 l=3]  *movsi_internal/0
+	jmp	.L927	# 17470	[c=1 l=5]  jump
+.L889:
+	movl	%r14d, %esi	# 4709	[c=4 l=3]  *movsi_internal/0
+	movq	%rbx, %rdi	# 4710	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 4711	[c=0 l=5]  *call
+	leaq	flag_update_table_add8(%rip), %r10	# 14216	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_sub8(%rip), %r11	# 14218	[c=1 l=7]  *movdi_internal/4
+	jmp	.L890	# 17472	[c=1 l=5]  jump
+.L1001:
+	movl	$91, %esi	# 6196	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 6197	[c=4 l=3]  *movdi_internal/3
+	movl	%r8d, 16(%rsp)	# 14373	[c=4 l=5]  *movsi_internal/1
+	call	data_read_page	# 6198	[c=10 l=5]  *call_value
+	movl	16(%rsp), %r8d	# 14374	[c=9 l=5]  *movsi_internal/0
+	jmp	.L1002	# 17474	[c=1 l=5]  jump
+.L904:
+	movl	%r13d, %esi	# 4881	[c=4 l=3]  *movsi_internal/0
+	movq	%rbx, %rdi	# 4882	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 4883	[c=10 l=5]  *call_value
+	leaq	flag_update_table_sub8(%rip), %r11	# 14246	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 14244	[c=1 l=7]  *movdi_internal/4
+	movl	%eax, %r14d	# 4884	[c=4 l=3]  *movsi_internal/0
+	jmp	.L905	# 17476	[c=1 l=5]  jump
+.L696:
+	movl	%r13d, %esi	# 2175	[c=4 l=3]  *movsi_internal/0
+	movq	%rbx, %rdi	# 2176	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 2177	[c=0 l=5]  *call
+	leaq	flag_update_table_add8(%rip), %r10	# 13976	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_sub8(%rip), %r11	# 13978	[c=1 l=7]  *movdi_internal/4
+	jmp	.L697	# 17478	[c=1 l=5]  jump
+.L1235:
+	movl	5176(%rbx), %esi	# 10824	[c=9 l=6]  *movsi_internal/0
+	movl	$93, %eax	# 10828	[c=4 l=5]  *movsi_internal/0
+	movl	5180(%rbx), %ecx	# 10825	[c=9 l=6]  *movsi_internal/0
+	movl	$94, %edx	# 10826	[c=4 l=5]  *movsi_internal/0
+	subl	%esi, %eax	# 10829	[c=4 l=2]  *subsi_1/0
+	subl	%esi, %edx	# 10827	[c=4 l=2]  *subsi_1/0
+	cmpl	%ecx, %eax	# 10830	[c=4 l=2]  *cmpsi_1/0
+	jb	.L1259	# 10831	[c=13 l=6]  *jcc
+	cmpb	$1, 1082(%rbx)	# 10835	[c=13 l=7]  *cmpqi_1/0
+	ja	.L1622	# 10836	[c=13 l=6]  *jcc
+	movq	1040(%rbx), %rax	# 11270	[c=9 l=7]  *movdi_internal/3
+	movzbl	93(%rax), %r14d	# 11271	[c=13 l=5]  *zero_extendqisi2/0
+.L1261:
+	movzbl	94(%rax), %eax	# 10869	[c=13 l=4]  *zero_extendqisi2/0
+.L1263:
+	sall	$8, %eax	# 10872	[c=4 l=3]  *ashlsi3_1/0
+	movl	152(%rsp), %r8d	# 10876	[c=9 l=8]  *movsi_internal/0
+	orl	%r14d, %eax	# 10873	[c=4 l=3]  *iorsi_1/0
+	movl	%eax, %r9d	# 13808	[c=4 l=3]  *movsi_internal/0
+	movzbl	840(%rbx), %eax	# 10874	[c=13 l=7]  *zero_extendqisi2/0
+	addl	$2, %eax	# 10875	[c=4 l=3]  *addsi_1/0
+	movl	%eax, 16(%rsp)	# 13809	[c=4 l=4]  *movsi_internal/1
+	cmpl	$-1, %r8d	# 10877	[c=4 l=4]  *cmpsi_1/0
+	je	.L1623	# 10878	[c=13 l=6]  *jcc
+.L1264:
+	cmpq	$0, 10976(%rbx)	# 10900	[c=13 l=8]  *cmpdi_ccno_1/1
+	je	.L1624	# 10901	[c=13 l=6]  *jcc
+.L1267:
+	movq	10976(%rbx), %r14	# 10961	[c=9 l=7]  *movdi_internal/3
+	movl	1000(%rbx), %eax	# 10963	[c=9 l=6]  *movsi_internal/0
+	movl	%r9d, 40(%rsp)	# 14654	[c=4 l=5]  *movsi_internal/1
+	movq	1040(%rbx), %rsi	# 10966	[c=9 l=7]  *movdi_internal/3
+	movl	%r8d, 32(%rsp)	# 14652	[c=4 l=5]  *movsi_internal/1
+	movq	96(%r14), %rdi	# 10962	[c=9 l=4]  *movdi_internal/3
+	leal	1(%rax), %edx	# 10965	[c=5 l=3]  *leadi
+	call	memcpy@PLT	# 10973	[c=10 l=5]  *call_value
+	movq	1040(%rbx), %rax	# 10977	[c=9 l=7]  *movdi_internal/3
+	movq	96(%r14), %xmm0	# 13816	[c=9 l=6]  *movdi_internal/14
+	leaq	48(%r14), %rdi	# 14731	[c=4 l=4]  *leadi
+	movq	24(%rsp), %rsi	# 13814	[c=9 l=5]  *movdi_internal/3
+	movl	$12, %ecx	# 10984	[c=4 l=5]  *movdi_internal/2
+	movdqu	(%rax), %xmm3	# 10979	[c=9 l=4]  movv1ti_internal/2
+	punpcklqdq	%xmm0, %xmm0	# 10987	[c=4 l=4]  *vec_dupv2di/0
+	movups	%xmm3, 104(%r14)	# 13812	[c=4 l=5]  movv1ti_internal/3
+	movdqu	16(%rax), %xmm4	# 10980	[c=13 l=5]  movv1ti_internal/2
+	movups	%xmm4, 120(%r14)	# 13813	[c=4 l=5]  movv1ti_internal/3
+	rep movsl	# 10985	[c=0 l=2]  *rep_movsi
+	movups	%xmm0, 56(%r14)	# 10988	[c=4 l=5]  movv2di_internal/3
+	leaq	48(%r14), %rdi	# 14732	[c=4 l=4]  *leadi
+	call	*16(%r13)	# 10992	[c=0 l=4]  *call
+	movl	32(%rsp), %r8d	# 14653	[c=9 l=5]  *movsi_internal/0
+	movl	40(%rsp), %r9d	# 14655	[c=9 l=5]  *movsi_internal/0
+	leaq	flag_update_table_add8(%rip), %r10	# 14657	[c=1 l=7]  *movdi_internal/4
+	cmpl	$-1, 152(%rsp)	# 10993	[c=13 l=8]  *cmpsi_1/0
+	leaq	flag_update_table_sub8(%rip), %r11	# 14659	[c=1 l=7]  *movdi_internal/4
+	jne	.L1271	# 10994	[c=13 l=2]  *jcc
+	movl	16(%rsp), %eax	# 13818	[c=9 l=4]  *movsi_internal/0
+	addl	%eax, %r9d	# 10996	[c=4 l=3]  *addsi_1/0
+	movq	96(%r14), %rax	# 10997	[c=9 l=4]  *movdi_internal/3
+	movl	%r9d, %ecx	# 13820	[c=4 l=3]  *movsi_internal/0
+	movb	%r9b, 93(%rax)	# 10998	[c=4 l=4]  *movqi_internal/8
+	movq	96(%r14), %rax	# 10999	[c=9 l=4]  *movdi_internal/3
+	movb	%ch, 94(%rax)	# 16745	[c=4 l=3]  *extzvqi_mem_rex64
+.L1271:
+	movq	1064(%rbx), %rdx	# 11006	[c=9 l=7]  *movdi_internal/3
+	movl	%r8d, %eax	# 11007	[c=1 l=3]  *zero_extendsidi2/3
+	movq	%r13, (%r14)	# 11004	[c=4 l=3]  *movdi_internal/5
+	movq	%r10, %rcx	# 16733	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rax	# 11008	[c=4 l=4]  *ashldi3_1/0
+	movl	%r8d, 8(%r14)	# 11005	[c=4 l=4]  *movsi_internal/1
+	movdqu	40(%rbx), %xmm0	# 13823	[c=13 l=5]  movv2di_internal/2
+	leaq	.L1272(%rip), %rdi	# 11024	[c=1 l=7]  *movdi_internal/4
+	movq	(%rdx,%rax), %rax	# 11010	[c=9 l=4]  *movdi_internal/3
+	movl	%r9d, 24(%r14)	# 11012	[c=4 l=4]  *movsi_internal/1
+	movq	%rax, 16(%r14)	# 11011	[c=4 l=4]  *movdi_internal/5
+	movzbl	11(%r15), %eax	# 11014	[c=13 l=5]  zero_extendqidi2/0
+	movq	%rax, %xmm1	# 13821	[c=4 l=5]  *movdi_internal/20
+	movzwl	14(%r15), %eax	# 11015	[c=13 l=5]  zero_extendhidi2/0
+	movq	%rax, %xmm5	# 13822	[c=4 l=5]  *movdi_internal/20
+	movq	10976(%rbx), %rax	# 11019	[c=9 l=7]  *movdi_internal/3
+	punpcklqdq	%xmm5, %xmm1	# 11016	[c=4 l=4]  vec_concatv2di/4
+	movl	8(%rax), %eax	# 11020	[c=10 l=3]  *zero_extendsidi2/3
+	psubq	%xmm1, %xmm0	# 11017	[c=4 l=4]  *subv2di3/0
+	movups	%xmm0, 32(%r14)	# 11018	[c=4 l=5]  movv2di_internal/3
+	movq	40(%r13), %r14	# 16732	[c=9 l=4]  *movdi_internal/3
+	salq	$4, %rax	# 11021	[c=4 l=4]  *ashldi3_1/0
+	movq	%rdi, (%rdx,%rax)	# 13825	[c=4 l=4]  *movdi_internal/5
+	movq	%r12, %rdx	# 16734	[c=4 l=3]  *movdi_internal/3
+	movq	%r11, %rax	# 16735	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 16736	[c=4 l=3]  *indirect_jump
+.L645:
+	movl	%r15d, %esi	# 1460	[c=4 l=3]  *movsi_internal/0
+	movq	%rbx, %rdi	# 1461	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, 16(%rsp)	# 13919	[c=4 l=4]  *movsi_internal/1
+	call	data_write_page	# 1462	[c=0 l=5]  *call
+	movl	16(%rsp), %eax	# 13920	[c=9 l=4]  *movsi_internal/0
+	leaq	flag_update_table_add8(%rip), %r10	# 13922	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_sub8(%rip), %r11	# 13924	[c=1 l=7]  *movdi_internal/4
+	jmp	.L646	# 17483	[c=1 l=5]  jump
+.L1620:
+	movzbl	8(%r15), %eax	# 10412	[c=13 l=5]  zero_extendqidi2/0
+	leaq	handler.2(%rip), %r14	# 10410	[c=1 l=7]  *movdi_internal/4
+	movq	(%r14,%rax,8), %r14	# 10413	[c=10 l=4]  *movdi_internal/3
+	jmp	.L1229	# 17485	[c=1 l=5]  jump
+.L1621:
+	movq	56(%rcx), %rsi	# 11122	[c=9 l=4]  *movdi_internal/3
+	movl	$32, %edx	# 11123	[c=4 l=5]  *movdi_internal/2
+	movq	%rcx, 64(%rsp)	# 14684	[c=4 l=5]  *movdi_internal/5
+	movq	%rdi, 72(%rsp)	# 14682	[c=4 l=5]  *movdi_internal/5
+	call	memcmp@PLT	# 11126	[c=10 l=5]  *call_value
+	leaq	flag_update_table_add8(%rip), %r10	# 14687	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_sub8(%rip), %r11	# 14689	[c=1 l=7]  *movdi_internal/4
+	testl	%eax, %eax	# 11130	[c=4 l=2]  *cmpsi_ccno_1/0
+	jne	.L1295	# 11131	[c=13 l=6]  *jcc
+	movq	64(%rsp), %rcx	# 14685	[c=9 l=5]  *movdi_internal/3
+	movl	1000(%rbx), %eax	# 11137	[c=9 l=6]  *movsi_internal/0
+	movq	72(%rsp), %rdi	# 14683	[c=9 l=5]  *movdi_internal/3
+	movq	96(%rcx), %rsi	# 11140	[c=9 l=4]  *movdi_internal/3
+	leal	1(%rax), %edx	# 11139	[c=5 l=3]  *leadi
+	call	memcmp@PLT	# 11144	[c=10 l=5]  *call_value
+	movq	64(%rsp), %rcx	# 14677	[c=9 l=5]  *movdi_internal/3
+	leaq	.LC40(%rip), %r8	# 75	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 14679	[c=1 l=7]  *movdi_internal/4
+	testl	%eax, %eax	# 11148	[c=4 l=2]  *cmpsi_ccno_1/0
+	leaq	flag_update_table_sub8(%rip), %r11	# 14681	[c=1 l=7]  *movdi_internal/4
+	jne	.L1278	# 11149	[c=13 l=6]  *jcc
+	movl	32(%rsp), %r8d	# 13832	[c=9 l=5]  *movsi_internal/0
+	movl	40(%rsp), %eax	# 13834	[c=9 l=4]  *movsi_internal/0
+	leaq	48(%rcx), %rsi	# 14728	[c=4 l=4]  *leadi
+	movq	%r13, %rdi	# 11163	[c=4 l=3]  *movdi_internal/3
+	movl	48(%rsp), %r9d	# 13836	[c=9 l=5]  *movsi_internal/0
+	leaq	108(%rsp), %rcx	# 14729	[c=4 l=5]  *leadi
+	leaq	104(%rsp), %rdx	# 14730	[c=4 l=5]  *leadi
+	subl	%eax, %r8d	# 11151	[c=4 l=3]  *subsi_1/0
+	movzbl	16(%rsp), %eax	# 11152	[c=13 l=5]  *zero_extendqisi2/0
+	movq	%rsi, 16(%rsp)	# 14690	[c=4 l=5]  *movdi_internal/5
+	subl	%eax, %r8d	# 11153	[c=4 l=3]  *subsi_1/0
+	movl	56(%rsp), %eax	# 13838	[c=9 l=4]  *movsi_internal/0
+	movl	%r8d, 32(%rsp)	# 14694	[c=4 l=5]  *movsi_internal/1
+	subl	%eax, %r9d	# 11154	[c=4 l=3]  *subsi_1/0
+	movzwl	24(%rsp), %eax	# 11155	[c=13 l=5]  *zero_extendhisi2/0
+	subl	%eax, %r9d	# 11156	[c=4 l=3]  *subsi_1/0
+	movl	%r9d, 24(%rsp)	# 14692	[c=4 l=5]  *movsi_internal/1
+	call	hle_cost@PLT	# 11164	[c=10 l=5]  *call_value
+	movq	16(%rsp), %rsi	# 14691	[c=9 l=5]  *movdi_internal/3
+	movl	24(%rsp), %r9d	# 14693	[c=9 l=5]  *movsi_internal/0
+	leaq	flag_update_table_add8(%rip), %r10	# 14697	[c=1 l=7]  *movdi_internal/4
+	testb	%al, %al	# 11166	[c=4 l=2]  *cmpqi_ccno_1/0
+	movl	32(%rsp), %r8d	# 14695	[c=9 l=5]  *movsi_internal/0
+	leaq	flag_update_table_sub8(%rip), %r11	# 14699	[c=1 l=7]  *movdi_internal/4
+	je	.L1279	# 11167	[c=13 l=6]  *jcc
+	cmpl	104(%rsp), %r8d	# 11169	[c=13 l=5]  *cmpsi_1/1
+	je	.L1280	# 11170	[c=13 l=6]  *jcc
+.L1281:
+	leaq	.LC41(%rip), %r8	# 76	[c=1 l=7]  *movdi_internal/4
+	jmp	.L1278	# 17487	[c=1 l=5]  jump
+.L595:
+	movzwl	24(%rax), %r13d	# 521	[c=13 l=5]  *zero_extendhisi2/0
+	movq	%rbx, %rdi	# 523	[c=4 l=3]  *movdi_internal/3
+	movl	%r13d, %esi	# 522	[c=4 l=3]  *movsi_internal/0
+	call	put_argv@PLT	# 524	[c=0 l=5]  *call
+	movq	1040(%rbx), %rax	# 526	[c=9 l=7]  *movdi_internal/3
+	movl	%r13d, 824(%rbx)	# 525	[c=4 l=7]  *movsi_internal/1
+	movb	$0, 20(%rax)	# 527	[c=4 l=4]  *movqi_internal/8
+	movq	1040(%rbx), %rax	# 528	[c=9 l=7]  *movdi_internal/3
+	movb	$0, 21(%rax)	# 529	[c=4 l=4]  *movqi_internal/8
+	movl	820(%rbx), %eax	# 530	[c=9 l=6]  *movsi_internal/0
+	movq	1040(%rbx), %rdx	# 531	[c=9 l=7]  *movdi_internal/3
+	movb	%al, 22(%rdx)	# 532	[c=4 l=3]  *movqi_internal/8
+	movq	1040(%rbx), %rdx	# 533	[c=9 l=7]  *movdi_internal/3
+	movb	%ah, 23(%rdx)	# 16934	[c=4 l=3]  *extzvqi_mem_rex64
+	movl	816(%rbx), %eax	# 536	[c=9 l=6]  *movsi_internal/0
+	jmp	.L1394	# 17489	[c=1 l=5]  jump
+.L1623:
+	addl	%r9d, %eax	# 10880	[c=4 l=3]  *addsi_1/2
+	cmpl	%eax, 1000(%rbx)	# 10881	[c=13 l=6]  *cmpsi_1/0
+	jb	.L1265	# 10882	[c=13 l=2]  *jcc
+	movslq	%r9d, %rdx	# 11501	[c=4 l=3]  *extendsidi2_rex64/1
+	movl	$1, %eax	# 71	[c=4 l=5]  *movdi_internal/2
+	xorl	%r8d, %r8d	# 16747	[c=4 l=3]  *movdi_xor
+	addq	1040(%rbx), %rdx	# 10888	[c=13 l=7]  *adddi_1/1
+.L1266:
+	movzbl	(%rdx,%rax), %ecx	# 10889	[c=13 l=4]  *zero_extendqisi2/0
+	sall	$8, %r8d	# 10886	[c=4 l=4]  *ashlsi3_1/0
+	addq	$1, %rax	# 10891	[c=4 l=4]  *adddi_1/0
+	orl	%ecx, %r8d	# 10890	[c=4 l=3]  *iorsi_1/0
+	cmpl	%eax, 16(%rsp)	# 10893	[c=13 l=4]  *cmpsi_1/0
+	jge	.L1266	# 10894	[c=13 l=2]  *jcc
+	cmpl	%r8d, 992(%rbx)	# 10896	[c=13 l=7]  *cmpsi_1/0
+	jnb	.L1264	# 10897	[c=13 l=6]  *jcc
+.L1265:
+	movq	40(%r13), %r14	# 11027	[c=9 l=4]  *movdi_internal/3
+	movq	%r10, %rcx	# 15818	[c=4 l=3]  *movdi_internal/3
+	movq	%r12, %rdx	# 15819	[c=4 l=3]  *movdi_internal/3
+	movq	%r11, %rax	# 15820	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 15821	[c=4 l=3]  *indirect_jump
+.L1259:
+	movq	1040(%rbx), %rax	# 10849	[c=9 l=7]  *movdi_internal/3
+	movzbl	93(%rax), %r14d	# 10850	[c=13 l=5]  *zero_extendqisi2/0
+	cmpl	%ecx, %edx	# 10851	[c=4 l=2]  *cmpsi_1/0
+	jb	.L1261	# 10852	[c=13 l=6]  *jcc
+	cmpb	$1, 1082(%rbx)	# 10856	[c=13 l=7]  *cmpqi_1/0
+	jbe	.L1261	# 10857	[c=13 l=6]  *jcc
+.L1262:
+	movl	$94, %esi	# 10860	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 10861	[c=4 l=3]  *movdi_internal/3
+	call	data_read_mapped	# 10862	[c=10 l=5]  *call_value
+	leaq	flag_update_table_add8(%rip), %r10	# 14633	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_sub8(%rip), %r11	# 14635	[c=1 l=7]  *movdi_internal/4
+	jmp	.L1263	# 17491	[c=1 l=5]  jump
+.L1295:
+	leaq	.LC39(%rip), %r8	# 74	[c=1 l=7]  *movdi_internal/4
+	jmp	.L1278	# 17493	[c=1 l=5]  jump
+.L1622:
+	movl	$93, %esi	# 10838	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 10839	[c=4 l=3]  *movdi_internal/3
+	movl	%edx, 32(%rsp)	# 14626	[c=4 l=4]  *movsi_internal/1
+	movl	%ecx, 16(%rsp)	# 14624	[c=4 l=4]  *movsi_internal/1
+	call	data_read_mapped	# 10840	[c=10 l=5]  *call_value
+	movl	16(%rsp), %ecx	# 14625	[c=9 l=4]  *movsi_internal/0
+	movl	32(%rsp), %edx	# 14627	[c=9 l=4]  *movsi_internal/0
+	leaq	flag_update_table_add8(%rip), %r10	# 14629	[c=1 l=7]  *movdi_internal/4
+	movl	%eax, %r14d	# 10841	[c=4 l=3]  *movsi_internal/0
+	leaq	flag_update_table_sub8(%rip), %r11	# 14631	[c=1 l=7]  *movdi_internal/4
+	cmpl	%ecx, %edx	# 10842	[c=4 l=2]  *cmpsi_1/0
+	jnb	.L1262	# 10843	[c=13 l=2]  *jcc
+	movq	1040(%rbx), %rax	# 11500	[c=9 l=7]  *movdi_internal/3
+	jmp	.L1261	# 17495	[c=1 l=5]  jump
+.L1619:
+	movl	(%rbx), %eax	# 554	[c=6 l=2]  *zero_extendsidi2/3
+	salq	$4, %rax	# 556	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%rbx), %rax	# 557	[c=13 l=7]  *adddi_1/1
+	movzbl	11(%rax), %eax	# 558	[c=13 l=4]  zero_extendqidi2/0
+	subq	%rax, %rdx	# 559	[c=4 l=3]  *subdi_1/0
+	jmp	.L596	# 17497	[c=1 l=5]  jump
+.L1624:
+	movl	$168, %esi	# 10903	[c=4 l=5]  *movdi_internal/2
+	movl	$1, %edi	# 10904	[c=4 l=5]  *movdi_internal/2
+	movl	%r9d, 40(%rsp)	# 14638	[c=4 l=5]  *movsi_internal/1
+	movl	%r8d, 32(%rsp)	# 14636	[c=4 l=5]  *movsi_internal/1
+	call	calloc@PLT	# 10905	[c=10 l=5]  *call_value
+	movl	32(%rsp), %r8d	# 14637	[c=9 l=5]  *movsi_internal/0
+	movl	40(%rsp), %r9d	# 14639	[c=9 l=5]  *movsi_internal/0
+	testq	%rax, %rax	# 10908	[c=4 l=3]  *cmpdi_ccno_1/0
+	movq	%rax, %r14	# 10906	[c=4 l=3]  *movdi_internal/3
+	je	.L1625	# 10909	[c=13 l=2]  *jcc
+	movq	984(%rbx), %rax	# 10923	[c=9 l=7]  *movdi_internal/3
+	movq	%rax, (%r14)	# 10924	[c=4 l=3]  *movdi_internal/5
+	testq	%rax, %rax	# 10925	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L1269	# 10926	[c=13 l=2]  *jcc
+	movq	%r14, 8(%rax)	# 10928	[c=4 l=4]  *movdi_internal/5
+.L1269:
+	leaq	32(%r14), %rax	# 14733	[c=4 l=4]  *leadi
+	movl	$65568, %esi	# 10934	[c=4 l=5]  *movdi_internal/2
+	movl	$1, %edi	# 10935	[c=4 l=5]  *movdi_internal/2
+	movq	%r14, 984(%rbx)	# 10931	[c=4 l=7]  *movdi_internal/5
+	movq	%rax, 10976(%rbx)	# 10933	[c=4 l=7]  *movdi_internal/5
+	movl	%r9d, 40(%rsp)	# 14646	[c=4 l=5]  *movsi_internal/1
+	movl	%r8d, 32(%rsp)	# 14644	[c=4 l=5]  *movsi_internal/1
+	call	calloc@PLT	# 10936	[c=10 l=5]  *call_value
+	movl	32(%rsp), %r8d	# 14645	[c=9 l=5]  *movsi_internal/0
+	movl	40(%rsp), %r9d	# 14647	[c=9 l=5]  *movsi_internal/0
+	testq	%rax, %rax	# 10939	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L1626	# 10940	[c=13 l=2]  *jcc
+	movq	%r14, (%rax)	# 10954	[c=4 l=3]  *movdi_internal/5
+	movq	%rax, 8(%r14)	# 10955	[c=4 l=4]  *movdi_internal/5
+	movq	%rax, 984(%rbx)	# 10956	[c=4 l=7]  *movdi_internal/5
+	addq	$32, %rax	# 10957	[c=4 l=4]  *adddi_1/0
+	movq	%rax, 128(%r14)	# 10958	[c=4 l=7]  *movdi_internal/5
+	jmp	.L1267	# 17501	[c=1 l=5]  jump
+.L1625:
+	movl	$136, %r8d	# 10912	[c=4 l=6]  *movsi_internal/0
+	movl	$1, %ecx	# 10913	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 10917	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 16746	[c=4 l=2]  *movdi_xor
+	leaq	.LC54(%rip), %r9	# 10911	[c=1 l=7]  *movdi_internal/4
+	leaq	.LC4(%rip), %rdx	# 10914	[c=1 l=7]  *movdi_internal/4
+	movl	$6, %esi	# 10916	[c=4 l=5]  *movsi_internal/0
+	call	leave	# 10919	[c=0 l=5]  *call
+.L1419:
+	movl	%eax, %esi	# 4624	[c=4 l=2]  *movsi_internal/0
+	movq	%rbx, %rdi	# 4625	[c=4 l=3]  *movdi_internal/3
+	call	stack_overflow	# 4626	[c=0 l=5]  *call
+.L1626:
+	leaq	.LC54(%rip), %r9	# 10942	[c=1 l=7]  *movdi_internal/4
+	movl	$1, %r8d	# 10943	[c=4 l=6]  *movsi_internal/0
+	movq	%rbx, %rdi	# 10948	[c=4 l=3]  *movdi_internal/3
+	movl	$65536, %ecx	# 10944	[c=4 l=5]  *movsi_internal/0
+	leaq	.LC4(%rip), %rdx	# 10945	[c=1 l=7]  *movdi_internal/4
+	movl	$6, %esi	# 10947	[c=4 l=5]  *movsi_internal/0
+	call	leave	# 10950	[c=0 l=5]  *call
+.L1280:
+	cmpl	108(%rsp), %r9d	# 11177	[c=13 l=5]  *cmpsi_1/1
+	jne	.L1281	# 11178	[c=13 l=6]  *jcc
+.L1279:
+	movl	%r9d, %ecx	# 11181	[c=4 l=3]  *movsi_internal/0
+	movl	%r8d, %edx	# 11182	[c=4 l=3]  *movsi_internal/0
+	movq	%r13, %rdi	# 11184	[c=4 l=3]  *movdi_internal/3
+	call	hle_learn@PLT	# 11185	[c=10 l=5]  *call_value
+	leaq	flag_update_table_add8(%rip), %r10	# 14701	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_sub8(%rip), %r11	# 14703	[c=1 l=7]  *movdi_internal/4
+	testb	%al, %al	# 11187	[c=4 l=2]  *cmpqi_ccno_1/0
+	je	.L1281	# 11188	[c=13 l=6]  *jcc
+	movq	%r10, %rcx	# 15802	[c=4 l=3]  *movdi_internal/3
+	movq	%r12, %rdx	# 15803	[c=4 l=3]  *movdi_internal/3
+	movq	%r11, %rax	# 15804	[c=4 l=3]  *movdi_internal/3
+	jmp	*%r14	# 15805	[c=4 l=3]  *indirect_jump
+.L1591:
+	leaq	.LC52(%rip), %rdx	# 5281	[c=1 l=7]  *movdi_internal/4
+	xorl	%esi, %esi	# 16821	[c=4 l=2]  *movdi_xor
+	movq	%rbx, %rdi	# 5284	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 16822	[c=4 l=2]  *movdi_xor
+	call	leave	# 5286	[c=0 l=5]  *call
+.L1415:
+	movl	%r15d, %esi	# 3000	[c=4 l=3]  *movsi_internal/0
+	movq	%rbx, %rdi	# 3001	[c=4 l=3]  *movdi_internal/3
+	call	stack_overflow	# 3002	[c=0 l=5]  *call
+.L1618:
+	xorl	%edx, %edx	# 16748	[c=4 l=2]  *movsi_xor
+	movq	%rbx, %rdi	# 10801	[c=4 l=3]  *movdi_internal/3
+	movl	%edx, 96(%rbx)	# 16749	[c=4 l=3]  *movsi_internal/1
+	call	do_events	# 10802	[c=0 l=5]  *call
+	leaq	flag_update_table_sub8(%rip), %r11	# 14623	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 14621	[c=1 l=7]  *movdi_internal/4
+	jmp	.L1258	# 17503	[c=1 l=5]  jump
+.L1617:
+	movl	5176(%rbx), %r13d	# 10603	[c=9 l=7]  *movsi_internal/0
+	movl	$93, %eax	# 10607	[c=4 l=5]  *movsi_internal/0
+	movl	5180(%rbx), %ebp	# 10604	[c=9 l=6]  *movsi_internal/0
+	movl	$94, %r14d	# 10605	[c=4 l=6]  *movsi_internal/0
+	subl	%r13d, %eax	# 10608	[c=4 l=3]  *subsi_1/0
+	subl	%r13d, %r14d	# 10606	[c=4 l=3]  *subsi_1/0
+	cmpl	%ebp, %eax	# 10609	[c=4 l=2]  *cmpsi_1/0
+	jb	.L1238	# 10610	[c=13 l=6]  *jcc
+	cmpb	$1, 1082(%rbx)	# 10614	[c=13 l=7]  *cmpqi_1/0
+	ja	.L1627	# 10615	[c=13 l=6]  *jcc
+	movq	1040(%rbx), %rax	# 11264	[c=9 l=7]  *movdi_internal/3
+	movzbl	93(%rax), %r15d	# 11265	[c=13 l=5]  *zero_extendqisi2/0
+.L1240:
+	movzbl	94(%rax), %eax	# 10648	[c=13 l=4]  *zero_extendqisi2/0
+.L1242:
+	sall	$8, %eax	# 10651	[c=4 l=3]  *ashlsi3_1/0
+	orl	%r15d, %eax	# 10652	[c=4 l=3]  *iorsi_1/0
+	xorl	%r15d, %r15d	# 16750	[c=4 l=3]  *movdi_xor
+	cmpb	$0, 840(%rbx)	# 10653	[c=13 l=7]  *cmpqi_ccno_1/1
+	movl	%eax, %r14d	# 13790	[c=4 l=3]  *movsi_internal/0
+	je	.L1243	# 10654	[c=13 l=2]  *jcc
+	addl	$1, %r14d	# 10656	[c=4 l=4]  *addsi_1/0
+	movl	%r14d, %eax	# 13791	[c=4 l=3]  *movsi_internal/0
+	subl	%r13d, %eax	# 10657	[c=4 l=3]  *subsi_1/0
+	cmpl	%ebp, %eax	# 10658	[c=4 l=2]  *cmpsi_1/0
+	jb	.L1244	# 10659	[c=13 l=2]  *jcc
+	movl	%r14d, %eax	# 13793	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %eax	# 10661	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 12691	[c=5 l=5]  *andsi_1_zext
+	cmpb	$0, 1080(%rbx,%rax)	# 10664	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L1245	# 10665	[c=13 l=6]  *jcc
+.L1244:
+	movq	1040(%rbx), %rdx	# 10669	[c=9 l=7]  *movdi_internal/3
+	movslq	%r14d, %rax	# 10668	[c=4 l=3]  *extendsidi2_rex64/1
+	movzbl	(%rdx,%rax), %r15d	# 10670	[c=13 l=5]  *zero_extendqisi2/0
+.L1246:
+	sall	$16, %r15d	# 10681	[c=4 l=4]  *ashlsi3_1/0
+.L1243:
+	leal	1(%r14), %esi	# 14734	[c=4 l=4]  *leasi
+	movl	%esi, %eax	# 13795	[c=4 l=2]  *movsi_internal/0
+	subl	5176(%rbx), %eax	# 10685	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %eax	# 10686	[c=13 l=6]  *cmpsi_1/1
+	jb	.L1247	# 10687	[c=13 l=2]  *jcc
+	movl	%esi, %eax	# 13797	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %eax	# 10689	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 12690	[c=5 l=5]  *andsi_1_zext
+	cmpb	$0, 1080(%rbx,%rax)	# 10692	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L1248	# 10693	[c=13 l=6]  *jcc
+.L1247:
+	movq	1040(%rbx), %rax	# 10697	[c=9 l=7]  *movdi_internal/3
+	movslq	%esi, %rsi	# 10696	[c=4 l=3]  *extendsidi2_rex64/1
+	movzbl	(%rax,%rsi), %eax	# 10698	[c=13 l=4]  *zero_extendqisi2/0
+.L1249:
+	sall	$8, %eax	# 10709	[c=4 l=3]  *ashlsi3_1/0
+	addl	$2, %r14d	# 10711	[c=4 l=4]  *addsi_1/0
+	orl	%r15d, %eax	# 10710	[c=4 l=3]  *iorsi_1/0
+	movl	%eax, %ebp	# 13800	[c=4 l=2]  *movsi_internal/0
+	movl	%r14d, %eax	# 13801	[c=4 l=3]  *movsi_internal/0
+	subl	5176(%rbx), %eax	# 10712	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %eax	# 10713	[c=13 l=6]  *cmpsi_1/1
+	jb	.L1250	# 10714	[c=13 l=2]  *jcc
+	movl	%r14d, %eax	# 13803	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %eax	# 10716	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 12689	[c=5 l=5]  *andsi_1_zext
+	cmpb	$0, 1080(%rbx,%rax)	# 10719	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L1251	# 10720	[c=13 l=6]  *jcc
+.L1250:
+	movq	1040(%rbx), %rdx	# 10724	[c=9 l=7]  *movdi_internal/3
+	movslq	%r14d, %rax	# 10723	[c=4 l=3]  *extendsidi2_rex64/1
+	movzbl	(%rdx,%rax), %eax	# 10725	[c=13 l=4]  *zero_extendqisi2/0
+.L1252:
+	orl	%eax, %ebp	# 10736	[c=4 l=2]  *iorsi_1/0
+	cmpl	%ebp, 992(%rbx)	# 10737	[c=13 l=6]  *cmpsi_1/0
+	jb	.L1628	# 10738	[c=13 l=2]  *jcc
+	movl	$93, %eax	# 10746	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%rbx), %eax	# 10747	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %eax	# 10748	[c=13 l=6]  *cmpsi_1/1
+	jb	.L1254	# 10749	[c=13 l=2]  *jcc
+	cmpb	$1, 1082(%rbx)	# 10753	[c=13 l=7]  *cmpqi_1/0
+	ja	.L1629	# 10754	[c=13 l=6]  *jcc
+.L1254:
+	movq	1040(%rbx), %rax	# 10765	[c=9 l=7]  *movdi_internal/3
+	movb	%r14b, 93(%rax)	# 10766	[c=4 l=4]  *movqi_internal/8
+.L1255:
+	movl	$94, %eax	# 10770	[c=4 l=5]  *movsi_internal/0
+	sarl	$8, %r14d	# 10769	[c=4 l=4]  *ashrsi3_1/0
+	subl	5176(%rbx), %eax	# 10771	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %eax	# 10772	[c=13 l=6]  *cmpsi_1/1
+	jb	.L1256	# 10773	[c=13 l=2]  *jcc
+	cmpb	$1, 1082(%rbx)	# 10777	[c=13 l=7]  *cmpqi_1/0
+	ja	.L1630	# 10778	[c=13 l=2]  *jcc
+.L1256:
+	movq	1040(%rbx), %rax	# 10789	[c=9 l=7]  *movdi_internal/3
+	movb	%r14b, 94(%rax)	# 10790	[c=4 l=4]  *movqi_internal/8
+	jmp	.L1237	# 17509	[c=1 l=5]  jump
+.L1628:
+	movl	%ebp, %esi	# 10740	[c=4 l=2]  *movsi_internal/0
+.L1416:
+	movq	%rbx, %rdi	# 10741	[c=4 l=3]  *movdi_internal/3
+	call	bad_PC	# 10742	[c=0 l=5]  *call
+.L1630:
+	movzbl	%r14b, %edx	# 10780	[c=4 l=4]  *zero_extendqisi2/0
+	movl	$94, %esi	# 10782	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 10783	[c=4 l=3]  *movdi_internal/3
+	call	data_write_mapped	# 10784	[c=0 l=5]  *call
+	leaq	flag_update_table_add8(%rip), %r10	# 14617	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_sub8(%rip), %r11	# 14619	[c=1 l=7]  *movdi_internal/4
+	jmp	.L1237	# 17511	[c=1 l=5]  jump
+.L1614:
+	movl	%r13d, %esi	# 1521	[c=4 l=3]  *movsi_internal/0
+	movq	%rbx, %rdi	# 1522	[c=4 l=3]  *movdi_internal/3
+	call	bad_PC	# 1523	[c=0 l=5]  *call
+.L1627:
+	movl	$93, %esi	# 10617	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 10618	[c=4 l=3]  *movdi_internal/3
+	call	data_read_mapped	# 10619	[c=10 l=5]  *call_value
+	cmpl	%ebp, %r14d	# 10621	[c=4 l=3]  *cmpsi_1/0
+	leaq	flag_update_table_add8(%rip), %r10	# 14593	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_sub8(%rip), %r11	# 14595	[c=1 l=7]  *movdi_internal/4
+	movl	%eax, %r15d	# 10620	[c=4 l=3]  *movsi_internal/0
+	jb	.L1631	# 10622	[c=13 l=2]  *jcc
+.L1241:
+	movl	$94, %esi	# 10639	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 10640	[c=4 l=3]  *movdi_internal/3
+	call	data_read_mapped	# 10641	[c=10 l=5]  *call_value
+	leaq	flag_update_table_add8(%rip), %r10	# 14597	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_sub8(%rip), %r11	# 14599	[c=1 l=7]  *movdi_internal/4
+	jmp	.L1242	# 17514	[c=1 l=5]  jump
+.L1248:
+	movq	%rbx, %rdi	# 10704	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 10705	[c=10 l=5]  *call_value
+	leaq	flag_update_table_sub8(%rip), %r11	# 14607	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 14605	[c=1 l=7]  *movdi_internal/4
+	jmp	.L1249	# 17516	[c=1 l=5]  jump
+.L1631:
+	movq	1040(%rbx), %rax	# 11499	[c=9 l=7]  *movdi_internal/3
+	jmp	.L1240	# 17518	[c=1 l=5]  jump
+.L1251:
+	movl	%r14d, %esi	# 10730	[c=4 l=3]  *movsi_internal/0
+	movq	%rbx, %rdi	# 10731	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 10732	[c=10 l=5]  *call_value
+	leaq	flag_update_table_sub8(%rip), %r11	# 14611	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 14609	[c=1 l=7]  *movdi_internal/4
+	jmp	.L1252	# 17520	[c=1 l=5]  jump
+.L1629:
+	movzbl	%r14b, %edx	# 10756	[c=4 l=4]  *zero_extendqisi2/0
+	movl	$93, %esi	# 10758	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 10759	[c=4 l=3]  *movdi_internal/3
+	call	data_write_mapped	# 10760	[c=0 l=5]  *call
+	leaq	flag_update_table_add8(%rip), %r10	# 14613	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_sub8(%rip), %r11	# 14615	[c=1 l=7]  *movdi_internal/4
+	jmp	.L1255	# 17522	[c=1 l=5]  jump
+.L1238:
+	movq	1040(%rbx), %rax	# 10628	[c=9 l=7]  *movdi_internal/3
+	movzbl	93(%rax), %r15d	# 10629	[c=13 l=5]  *zero_extendqisi2/0
+	cmpl	%ebp, %r14d	# 10630	[c=4 l=3]  *cmpsi_1/0
+	jb	.L1240	# 10631	[c=13 l=6]  *jcc
+	cmpb	$1, 1082(%rbx)	# 10635	[c=13 l=7]  *cmpqi_1/0
+	jbe	.L1240	# 10636	[c=13 l=6]  *jcc
+	jmp	.L1241	# 17525	[c=1 l=5]  jump
+.L1245:
+	movl	%r14d, %esi	# 10675	[c=4 l=3]  *movsi_internal/0
+	movq	%rbx, %rdi	# 10676	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 10677	[c=10 l=5]  *call_value
+	leaq	flag_update_table_sub8(%rip), %r11	# 14603	[c=1 l=7]  *movdi_internal/4
+	leaq	flag_update_table_add8(%rip), %r10	# 14601	[c=1 l=7]  *movdi_internal/4
+	movl	%eax, %r15d	# 10678	[c=4 l=3]  *movsi_internal/0
+	jmp	.L1246	# 17527	[c=1 l=5]  jump
+.L1418:
+	movl	%r14d, %esi	# 5175	[c=4 l=3]  *movsi_internal/0
+	movq	%rbx, %rdi	# 5176	[c=4 l=3]  *movdi_internal/3
+	call	bad_PC	# 5177	[c=0 l=5]  *call
+.L592:
+	leaq	.LC48(%rip), %rdx	# 479	[c=1 l=7]  *movdi_internal/4
+	movl	$1, %esi	# 481	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 482	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 16935	[c=4 l=2]  *movdi_xor
+	call	leave	# 484	[c=0 l=5]  *call
+.L1554:
+	movq	%rbx, %rdi	# 9420	[c=4 l=3]  *movdi_internal/3
+	call	stack_overflow	# 9421	[c=0 l=5]  *call
+.L996:
+	leaq	.LC53(%rip), %rdx	# 6119	[c=1 l=7]  *movdi_internal/4
+	movl	$4, %esi	# 6121	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 6122	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 16802	[c=4 l=2]  *movdi_xor
+	call	leave	# 6124	[c=0 l=5]  *call
+	.cfi_endproc
+.LFE221:
+	.size	execute, .-execute
+	.section	.rodata.str1.1
+.LC56:
+	.string	"flash"
+.LC57:
+	.string	"EEPROM"
+.LC58:
+	.string	"decoded flash"
+.LC59:
+	.string	"atmega64"
+.LC60:
+	.string	"atmega128"
+	.section	.rodata.str1.8
+	.align 8
+.LC61:
+	.string	"entry point 0x%x is outside the flash of %s"
+	.text
+	.p2align 4
+	.type	run_context, @function
+run_context:
+.LFB226:
+	.cfi_startproc
+	pushq	%r13	# 760	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 16
+	.cfi_offset 13, -16
+	pushq	%r12	# 761	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 24
+	.cfi_offset 12, -24
+	pushq	%rbp	# 762	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 32
+	.cfi_offset 6, -32
+	pushq	%rbx	# 763	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 40
+	.cfi_offset 3, -40
+	subq	$248, %rsp	# 764	[c=4 l=7]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_def_cfa_offset 288
+	movq	%rdi, (%rsp)	# 2	[c=4 l=4]  *movdi_internal/5
+	leaq	32(%rsp), %rdi	# 22	[c=4 l=5]  *leadi
+	movl	%esi, 12(%rsp)	# 3	[c=4 l=4]  *movsi_internal/1
+	movq	%rdx, 16(%rsp)	# 4	[c=4 l=5]  *movdi_internal/5
+	call	_setjmp@PLT	# 24	[c=10 l=5]  *call_value
+	testl	%eax, %eax	# 31	[c=4 l=2]  *cmpsi_ccno_1/0
+	je	.L1687	# 32	[c=13 l=6]  *jcc
+	movq	(%rsp), %rbx	# 726	[c=5 l=4]  *movdi_internal/3
+	movq	$0, 128(%rbx)	# 445	[c=4 l=11]  *movdi_internal/5
+	movq	%rbx, %rdi	# 446	[c=4 l=3]  *movdi_internal/3
+	call	eeprom_finish@PLT	# 447	[c=0 l=5]  *call
+	movq	%rbx, %rdi	# 449	[c=4 l=3]  *movdi_internal/3
+	call	jit_free@PLT	# 450	[c=0 l=5]  *call
+	movq	984(%rbx), %rdi	# 452	[c=9 l=7]  *movdi_internal/3
+	testq	%rdi, %rdi	# 453	[c=4 l=3]  *cmpdi_ccno_1/0
+	jne	.L1665	# 454	[c=13 l=2]  *jcc
+	jmp	.L1671	# 812	[c=1 l=2]  jump
+	.p2align 4,,10
+	.p2align 3
+.L1688:
+	movq	%rax, (%rdx)	# 476	[c=4 l=3]  *movdi_internal/5
+.L1668:
+	testq	%rax, %rax	# 484	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L1669	# 485	[c=13 l=2]  *jcc
+	movq	%rdx, 8(%rax)	# 487	[c=4 l=4]  *movdi_internal/5
+.L1669:
+	call	free@PLT	# 500	[c=0 l=5]  *call
+	movq	(%rsp), %rax	# 694	[c=5 l=4]  *movdi_internal/3
+	movq	984(%rax), %rdi	# 501	[c=9 l=7]  *movdi_internal/3
+	testq	%rdi, %rdi	# 502	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L1671	# 503	[c=13 l=2]  *jcc
+.L1665:
+	movq	16(%rdi), %rax	# 461	[c=9 l=4]  *movdi_internal/3
+	testq	%rax, %rax	# 462	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L1666	# 463	[c=13 l=2]  *jcc
+	movq	%rax, %rdi	# 465	[c=4 l=3]  *movdi_internal/3
+	call	fclose@PLT	# 466	[c=10 l=5]  *call_value
+	movq	(%rsp), %rax	# 691	[c=5 l=4]  *movdi_internal/3
+	movq	984(%rax), %rdi	# 468	[c=9 l=7]  *movdi_internal/3
+.L1666:
+	movq	8(%rdi), %rdx	# 471	[c=9 l=4]  *movdi_internal/3
+	movq	(%rdi), %rax	# 472	[c=5 l=3]  *movdi_internal/3
+	testq	%rdx, %rdx	# 473	[c=4 l=3]  *cmpdi_ccno_1/0
+	jne	.L1688	# 474	[c=13 l=2]  *jcc
+	movq	(%rsp), %rcx	# 692	[c=5 l=4]  *movdi_internal/3
+	movq	%rax, 984(%rcx)	# 481	[c=4 l=7]  *movdi_internal/5
+	jmp	.L1668	# 815	[c=1 l=2]  jump
+	.p2align 4,,10
+	.p2align 3
+.L1671:
+	movq	(%rsp), %rax	# 690	[c=5 l=4]  *movdi_internal/3
+	movl	136(%rax), %eax	# 456	[c=9 l=6]  *movsi_internal/0
+	addq	$248, %rsp	# 767	[c=4 l=7]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	popq	%rbx	# 768	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 32
+	popq	%rbp	# 769	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 24
+	popq	%r12	# 770	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 16
+	popq	%r13	# 771	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 8
+	ret		# 772	[c=0 l=1]  simple_return_internal
+.L1687:
+	.cfi_restore_state
+	movq	(%rsp), %rbx	# 698	[c=5 l=4]  *movdi_internal/3
+	leaq	32(%rsp), %rax	# 34	[c=4 l=5]  *leadi
+	xorl	%esi, %esi	# 809	[c=4 l=2]  *movdi_xor
+	movl	$1, %r13d	# 6	[c=4 l=6]  *movsi_internal/0
+	movq	%rax, 128(%rbx)	# 35	[c=4 l=7]  *movdi_internal/5
+	leaq	920(%rbx), %rdi	# 751	[c=4 l=7]  *leadi
+	call	gettimeofday@PLT	# 39	[c=10 l=5]  *call_value
+	movq	16(%rsp), %rdx	# 40	[c=9 l=5]  *movdi_internal/3
+	movl	12(%rsp), %esi	# 41	[c=9 l=4]  *movsi_internal/0
+	movq	%rbx, %rdi	# 42	[c=4 l=3]  *movdi_internal/3
+	call	parse_args@PLT	# 43	[c=0 l=5]  *call
+	movq	%rbx, %rdi	# 45	[c=4 l=3]  *movdi_internal/3
+	call	replay_open@PLT	# 46	[c=0 l=5]  *call
+	movl	880(%rbx), %eax	# 48	[c=9 l=6]  *movsi_internal/0
+.L1635:
+	movl	%r13d, %r12d	# 50	[c=4 l=3]  *movsi_internal/0
+	addl	%r13d, %r13d	# 51	[c=4 l=3]  *ashlsi3_1/0
+	cmpl	%eax, %r13d	# 53	[c=4 l=3]  *cmpsi_1/0
+	jb	.L1635	# 54	[c=13 l=2]  *jcc
+	leal	-1(%r12), %eax	# 749	[c=4 l=5]  *leasi
+	movl	$1, %edi	# 66	[c=4 l=5]  *movdi_internal/2
+	movd	%eax, %xmm0	# 633	[c=4 l=4]  *movsi_internal/13
+	movq	(%rsp), %rax	# 701	[c=5 l=4]  *movdi_internal/3
+	movl	872(%rax), %esi	# 57	[c=9 l=6]  *movsi_internal/0
+	movl	876(%rax), %ecx	# 60	[c=9 l=6]  *movsi_internal/0
+	movd	%esi, %xmm1	# 636	[c=4 l=4]  *movsi_internal/13
+	movl	%ecx, 1000(%rax)	# 61	[c=4 l=6]  *movsi_internal/1
+	movl	%esi, 24(%rsp)	# 635	[c=4 l=4]  *movsi_internal/1
+	punpckldq	%xmm1, %xmm0	# 58	[c=4 l=4]  *vec_concatv2si/0
+	leal	1(%rcx), %esi	# 750	[c=5 l=3]  *leadi
+	movq	%xmm0, 992(%rax)	# 59	[c=4 l=9]  *movv2si_internal/14
+	movq	%rsi, %rbx	# 756	[c=4 l=3]  *movdi_internal/3
+	addq	$32, %rsi	# 64	[c=4 l=4]  *adddi_1/0
+	call	calloc@PLT	# 67	[c=10 l=5]  *call_value
+	movq	%rax, %rbp	# 68	[c=4 l=3]  *movdi_internal/3
+	testq	%rax, %rax	# 70	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L1689	# 71	[c=13 l=6]  *jcc
+	xorl	%esi, %esi	# 807	[c=4 l=2]  *movdi_xor
+	movq	%rsi, 8(%rax)	# 808	[c=4 l=4]  *movdi_internal/5
+	movq	(%rsp), %rax	# 640	[c=5 l=4]  *movdi_internal/3
+	movq	984(%rax), %rax	# 86	[c=9 l=7]  *movdi_internal/3
+	movq	%rax, 0(%rbp)	# 87	[c=4 l=4]  *movdi_internal/5
+	testq	%rax, %rax	# 88	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L1637	# 89	[c=13 l=2]  *jcc
+	movq	%rbp, 8(%rax)	# 91	[c=4 l=4]  *movdi_internal/5
+.L1637:
+	movq	(%rsp), %rsi	# 702	[c=5 l=4]  *movdi_internal/3
+	leaq	32(%rbp), %rax	# 748	[c=4 l=4]  *leadi
+	movl	$1, %edi	# 101	[c=4 l=5]  *movdi_internal/2
+	movq	%rbp, 984(%rsi)	# 94	[c=4 l=7]  *movdi_internal/5
+	movq	%rax, 1040(%rsi)	# 96	[c=4 l=7]  *movdi_internal/5
+	leal	2(%r13), %esi	# 845	[c=5 l=4]  *leadi
+	movq	%rsi, %r13	# 757	[c=4 l=3]  *movdi_internal/3
+	addq	$32, %rsi	# 99	[c=4 l=4]  *adddi_1/0
+	call	calloc@PLT	# 102	[c=10 l=5]  *call_value
+	movq	%rax, %rbx	# 103	[c=4 l=3]  *movdi_internal/3
+	testq	%rax, %rax	# 105	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L1690	# 106	[c=13 l=6]  *jcc
+	movq	(%rsp), %rsi	# 704	[c=5 l=4]  *movdi_internal/3
+	xorl	%ecx, %ecx	# 804	[c=4 l=2]  *movdi_xor
+	movq	%rbp, (%rax)	# 121	[c=4 l=3]  *movdi_internal/5
+	movl	$1, %edi	# 131	[c=4 l=5]  *movdi_internal/2
+	movq	%rcx, 8(%rax)	# 805	[c=4 l=4]  *movdi_internal/5
+	movl	884(%rsi), %ecx	# 126	[c=9 l=6]  *movsi_internal/0
+	movq	%rax, 8(%rbp)	# 122	[c=4 l=4]  *movdi_internal/5
+	movq	%rax, 984(%rsi)	# 123	[c=4 l=7]  *movdi_internal/5
+	leaq	32(%rax), %rax	# 747	[c=4 l=4]  *leadi
+	movq	%rax, 1056(%rsi)	# 125	[c=4 l=7]  *movdi_internal/5
+	testl	%ecx, %ecx	# 625	[c=4 l=2]  *cmpsi_ccno_1/0
+	movl	$1, %eax	# 628	[c=4 l=5]  *movsi_internal/0
+	cmovne	%ecx, %eax	# 626	[c=8 l=3]  *movsicc_noc/0
+	movl	%eax, %esi	# 647	[c=1 l=2]  *zero_extendsidi2/3
+	movq	%rsi, %r13	# 758	[c=4 l=3]  *movdi_internal/3
+	addq	$32, %rsi	# 129	[c=4 l=4]  *adddi_1/0
+	call	calloc@PLT	# 132	[c=10 l=5]  *call_value
+	leaq	.LC57(%rip), %r9	# 138	[c=1 l=7]  *movdi_internal/4
+	movq	%rax, %rbp	# 133	[c=4 l=3]  *movdi_internal/3
+	testq	%rax, %rax	# 135	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L1686	# 136	[c=13 l=6]  *jcc
+	movq	(%rsp), %rsi	# 705	[c=5 l=4]  *movdi_internal/3
+	xorl	%edx, %edx	# 802	[c=4 l=2]  *movdi_xor
+	movq	%rbx, (%rax)	# 151	[c=4 l=3]  *movdi_internal/5
+	movl	$1, %edi	# 160	[c=4 l=5]  *movdi_internal/2
+	movq	%rdx, 8(%rax)	# 803	[c=4 l=4]  *movdi_internal/5
+	movq	%rax, 8(%rbx)	# 152	[c=4 l=4]  *movdi_internal/5
+	movq	%rax, 984(%rsi)	# 153	[c=4 l=7]  *movdi_internal/5
+	leaq	32(%rax), %rax	# 746	[c=4 l=4]  *leadi
+	movq	%rax, 1048(%rsi)	# 155	[c=4 l=7]  *movdi_internal/5
+	movl	%r12d, %esi	# 156	[c=1 l=3]  *zero_extendsidi2/3
+	salq	$4, %rsi	# 157	[c=4 l=4]  *ashldi3_1/0
+	addq	$32, %rsi	# 158	[c=4 l=4]  *adddi_1/0
+	call	calloc@PLT	# 161	[c=10 l=5]  *call_value
+	movq	%rax, %rbx	# 162	[c=4 l=3]  *movdi_internal/3
+	testq	%rax, %rax	# 164	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L1691	# 165	[c=13 l=6]  *jcc
+	movq	(%rsp), %rsi	# 707	[c=5 l=4]  *movdi_internal/3
+	xorl	%eax, %eax	# 800	[c=4 l=2]  *movdi_xor
+	movq	%rbp, (%rbx)	# 180	[c=4 l=3]  *movdi_internal/5
+	movq	%rax, 8(%rbx)	# 801	[c=4 l=4]  *movdi_internal/5
+	leaq	32(%rbx), %rax	# 745	[c=4 l=4]  *leadi
+	cmpb	$0, 844(%rsi)	# 185	[c=13 l=7]  *cmpqi_ccno_1/1
+	movq	%rbx, 8(%rbp)	# 181	[c=4 l=4]  *movdi_internal/5
+	movq	%rbx, 984(%rsi)	# 182	[c=4 l=7]  *movdi_internal/5
+	movq	%rax, 1064(%rsi)	# 184	[c=4 l=7]  *movdi_internal/5
+	jne	.L1692	# 186	[c=13 l=6]  *jcc
+.L1641:
+	movq	(%rsp), %rbx	# 709	[c=5 l=4]  *movdi_internal/3
+	movq	%rbx, %rdi	# 215	[c=4 l=3]  *movdi_internal/3
+	call	periph_init@PLT	# 216	[c=0 l=5]  *call
+	leaq	1080(%rbx), %rdi	# 744	[c=4 l=7]  *leadi
+	xorl	%edx, %edx	# 799	[c=4 l=2]  *movdi_xor
+	movl	$31, %eax	# 8	[c=4 l=5]  *movsi_internal/0
+	movq	%rdi, %rcx	# 219	[c=4 l=3]  *movdi_internal/3
+.L1647:
+	movq	(%rsp), %rsi	# 656	[c=5 l=4]  *movdi_internal/3
+	movl	1000(%rsi), %r8d	# 221	[c=9 l=7]  *movsi_internal/0
+	xorl	%esi, %esi	# 798	[c=4 l=2]  *movdi_xor
+	cmpl	%eax, %r8d	# 222	[c=4 l=3]  *cmpsi_1/0
+	jnb	.L1643	# 223	[c=13 l=2]  *jcc
+	cmpl	%edx, %r8d	# 542	[c=4 l=3]  *cmpsi_1/0
+	sbbl	%esi, %esi	# 543	[c=8 l=2]  *x86_movsicc_0_m1
+	andl	$4, %esi	# 742	[c=4 l=3]  *andsi_1/0
+	addl	$1, %esi	# 743	[c=4 l=3]  *addsi_1/0
+.L1643:
+	movb	%sil, (%rcx)	# 231	[c=4 l=3]  *movqi_internal/8
+	movq	(%rsp), %rsi	# 710	[c=5 l=4]  *movdi_internal/3
+	cmpb	$0, 844(%rsi)	# 232	[c=13 l=7]  *cmpqi_ccno_1/1
+	je	.L1644	# 233	[c=13 l=2]  *jcc
+	cmpl	%edx, 1000(%rsi)	# 237	[c=13 l=6]  *cmpsi_1/0
+	jnb	.L1644	# 238	[c=13 l=2]  *jcc
+	cmpl	$65535, %eax	# 243	[c=4 l=5]  *cmpsi_1/0
+	ja	.L1644	# 244	[c=13 l=2]  *jcc
+	movb	$4, (%rcx)	# 246	[c=4 l=3]  *movqi_internal/8
+	addl	$32, %eax	# 247	[c=4 l=3]  *addsi_1/0
+	addl	$32, %edx	# 248	[c=4 l=3]  *addsi_1/0
+	addq	$1, %rcx	# 249	[c=4 l=4]  *adddi_1/0
+	jmp	.L1647	# 821	[c=1 l=2]  jump
+.L1644:
+	addl	$32, %eax	# 254	[c=4 l=3]  *addsi_1/0
+	addl	$32, %edx	# 255	[c=4 l=3]  *addsi_1/0
+	addq	$1, %rcx	# 256	[c=4 l=4]  *adddi_1/0
+	cmpl	$131103, %eax	# 257	[c=4 l=5]  *cmpsi_1/0
+	jne	.L1647	# 258	[c=13 l=2]  *jcc
+	movq	(%rsp), %rax	# 659	[c=5 l=4]  *movdi_internal/3
+	movb	$1, 1082(%rax)	# 266	[c=4 l=7]  *movqi_internal/8
+	xorl	%eax, %eax	# 797	[c=4 l=2]  *movdi_xor
+	jmp	.L1648	# 823	[c=1 l=2]  jump
+.L1650:
+	movq	(%rsp), %rsi	# 660	[c=5 l=4]  *movdi_internal/3
+	cmpb	$0, 6568(%rsi,%rax)	# 270	[c=14 l=8]  *cmpqi_ccno_1/1
+	je	.L1649	# 271	[c=13 l=2]  *jcc
+	shrl	$5, %edx	# 273	[c=5 l=3]  *lshrsi3_1_zext/0
+	movb	$1, (%rdi,%rdx)	# 275	[c=4 l=4]  *movqi_internal/8
+.L1649:
+	addq	$1, %rax	# 278	[c=4 l=4]  *adddi_1/0
+.L1648:
+	movq	(%rsp), %rsi	# 661	[c=5 l=4]  *movdi_internal/3
+	movl	%eax, %edx	# 281	[c=4 l=2]  *movsi_internal/0
+	cmpl	6564(%rsi), %eax	# 283	[c=13 l=6]  *cmpsi_1/1
+	jb	.L1650	# 284	[c=13 l=2]  *jcc
+	movl	1000(%rsi), %eax	# 286	[c=9 l=6]  *movsi_internal/0
+	movl	%eax, 28(%rsp)	# 663	[c=4 l=4]  *movsi_internal/1
+	addl	$1, %eax	# 287	[c=4 l=3]  *addsi_1/0
+	movl	%eax, %edx	# 665	[c=4 l=2]  *movsi_internal/0
+	shrl	$5, %edx	# 288	[c=4 l=3]  *lshrsi3_1/0
+	jmp	.L1652	# 825	[c=1 l=2]  jump
+.L1693:
+	leal	-1(%rdx), %esi	# 741	[c=5 l=3]  *leadi
+	cmpb	$0, (%rdi,%rsi)	# 296	[c=13 l=4]  *cmpqi_ccno_1/1
+	movq	%rsi, %rcx	# 759	[c=4 l=3]  *movdi_internal/3
+	jne	.L1651	# 297	[c=13 l=2]  *jcc
+	movl	%ecx, %edx	# 13	[c=4 l=2]  *movsi_internal/0
+.L1652:
+	testl	%edx, %edx	# 290	[c=4 l=2]  *cmpsi_ccno_1/0
+	jne	.L1693	# 291	[c=13 l=2]  *jcc
+.L1651:
+	movq	(%rsp), %rsi	# 712	[c=5 l=4]  *movdi_internal/3
+	sall	$5, %edx	# 300	[c=4 l=3]  *ashlsi3_1/0
+	andl	$-32, %eax	# 302	[c=4 l=3]  *andsi_1/0
+	subl	%edx, %eax	# 303	[c=4 l=2]  *subsi_1/0
+	movl	%edx, 5176(%rsi)	# 301	[c=4 l=6]  *movsi_internal/1
+	movl	880(%rsi), %edx	# 305	[c=9 l=6]  *movsi_internal/0
+	movl	%eax, 5180(%rsi)	# 304	[c=4 l=6]  *movsi_internal/1
+	movl	$64, %eax	# 14	[c=4 l=5]  *movsi_internal/0
+	cmpl	$8192, %edx	# 308	[c=4 l=6]  *cmpsi_1/0
+	jbe	.L1653	# 309	[c=13 l=2]  *jcc
+	cmpl	$32769, %edx	# 562	[c=4 l=6]  *cmpsi_1/0
+	sbbl	%eax, %eax	# 563	[c=8 l=2]  *x86_movsicc_0_m1
+	andl	$-128, %eax	# 564	[c=4 l=3]  *andsi_1/0
+	addl	$256, %eax	# 565	[c=4 l=5]  *addsi_1/0
+.L1653:
+	movq	(%rsp), %rsi	# 713	[c=5 l=4]  *movdi_internal/3
+	movl	%eax, 6044(%rsi)	# 318	[c=4 l=6]  *movsi_internal/1
+	movq	856(%rsi), %rbx	# 319	[c=9 l=7]  *movdi_internal/3
+	leaq	.LC59(%rip), %rsi	# 321	[c=1 l=7]  *movdi_internal/4
+	movq	%rbx, %rdi	# 323	[c=4 l=3]  *movdi_internal/3
+	call	strcmp@PLT	# 324	[c=10 l=5]  *call_value
+	movl	%eax, %edx	# 593	[c=4 l=2]  *movsi_internal/0
+	movl	$104, %eax	# 18	[c=4 l=5]  *movsi_internal/0
+	testl	%edx, %edx	# 326	[c=4 l=2]  *cmpsi_ccno_1/0
+	je	.L1654	# 327	[c=13 l=2]  *jcc
+	leaq	.LC60(%rip), %rsi	# 330	[c=1 l=7]  *movdi_internal/4
+	movq	%rbx, %rdi	# 332	[c=4 l=3]  *movdi_internal/3
+	call	strcmp@PLT	# 333	[c=10 l=5]  *call_value
+	cmpl	$1, %eax	# 576	[c=4 l=3]  *cmpsi_1/0
+	sbbl	%eax, %eax	# 577	[c=8 l=2]  *x86_movsicc_0_m1
+	andl	$17, %eax	# 578	[c=4 l=3]  *andsi_1/0
+	addl	$87, %eax	# 579	[c=4 l=3]  *addsi_1/0
+.L1654:
+	movq	(%rsp), %rsi	# 719	[c=5 l=4]  *movdi_internal/3
+	leaq	6060(%rsi), %rdi	# 740	[c=4 l=7]  *leadi
+	movl	%eax, 6048(%rsi)	# 340	[c=4 l=6]  *movsi_internal/1
+	movl	%esi, %eax	# 676	[c=4 l=2]  *movsi_internal/0
+	movq	$-1, 6052(%rsi)	# 346	[c=4 l=11]  *movdi_internal/5
+	andq	$-8, %rdi	# 352	[c=4 l=4]  *anddi_1/1
+	movq	$-1, 6556(%rsi)	# 350	[c=4 l=11]  *movdi_internal/5
+	subl	%edi, %eax	# 353	[c=4 l=2]  *subsi_1/0
+	leal	6564(%rax), %ecx	# 354	[c=4 l=6]  *leasi
+	orq	$-1, %rax	# 796	[c=4 l=4]  *movdi_or
+	shrl	$3, %ecx	# 356	[c=5 l=3]  *lshrsi3_1_zext/0
+	rep stosq	# 358	[c=0 l=3]  *rep_stosdi_rex64
+	movl	(%rsi), %eax	# 359	[c=5 l=2]  *movsi_internal/0
+	cmpl	%eax, 992(%rsi)	# 360	[c=13 l=6]  *cmpsi_1/0
+	jb	.L1694	# 361	[c=13 l=6]  *jcc
+	movq	(%rsp), %rax	# 680	[c=5 l=4]  *movdi_internal/3
+	cmpl	$0, 232(%rax)	# 375	[c=13 l=7]  *cmpsi_ccno_1/1
+	jne	.L1695	# 376	[c=13 l=6]  *jcc
+.L1656:
+	movq	(%rsp), %rbx	# 720	[c=5 l=4]  *movdi_internal/3
+	movq	%rbx, %rdi	# 384	[c=4 l=3]  *movdi_internal/3
+	call	checkpoint_open@PLT	# 385	[c=0 l=5]  *call
+	cmpl	$0, 424(%rbx)	# 387	[c=13 l=7]  *cmpsi_ccno_1/1
+	jne	.L1659	# 388	[c=13 l=2]  *jcc
+	movq	(%rsp), %rdi	# 396	[c=5 l=4]  *movdi_internal/3
+	call	load_to_flash@PLT	# 397	[c=0 l=5]  *call
+.L1659:
+	movq	(%rsp), %rbx	# 722	[c=5 l=4]  *movdi_internal/3
+	movq	%rbx, %rdi	# 390	[c=4 l=3]  *movdi_internal/3
+	call	eeprom_open@PLT	# 391	[c=0 l=5]  *call
+	movq	%rbx, %rdi	# 403	[c=4 l=3]  *movdi_internal/3
+	call	checkpoint_resume@PLT	# 404	[c=0 l=5]  *call
+	cmpl	$0, 232(%rbx)	# 406	[c=13 l=7]  *cmpsi_ccno_1/1
+	jne	.L1696	# 407	[c=13 l=2]  *jcc
+.L1660:
+	movq	(%rsp), %rax	# 685	[c=5 l=4]  *movdi_internal/3
+	cmpl	$0, 424(%rax)	# 415	[c=13 l=7]  *cmpsi_ccno_1/1
+	jne	.L1663	# 416	[c=13 l=2]  *jcc
+	movq	(%rsp), %rdi	# 424	[c=5 l=4]  *movdi_internal/3
+	call	decode_flash@PLT	# 425	[c=0 l=5]  *call
+.L1663:
+	movq	(%rsp), %rbx	# 723	[c=5 l=4]  *movdi_internal/3
+	movq	%rbx, %rdi	# 418	[c=4 l=3]  *movdi_internal/3
+	call	fork_server_open@PLT	# 419	[c=0 l=5]  *call
+	cmpl	$0, 232(%rbx)	# 431	[c=13 l=7]  *cmpsi_ccno_1/1
+	jne	.L1697	# 432	[c=13 l=6]  *jcc
+.L1664:
+	movq	(%rsp), %rdi	# 440	[c=5 l=4]  *movdi_internal/3
+	call	execute	# 441	[c=0 l=5]  *call
+.L1692:
+	movl	$32800, %esi	# 188	[c=4 l=5]  *movdi_internal/2
+	movl	$1, %edi	# 189	[c=4 l=5]  *movdi_internal/2
+	call	calloc@PLT	# 190	[c=10 l=5]  *call_value
+	testq	%rax, %rax	# 193	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L1698	# 194	[c=13 l=6]  *jcc
+	movq	(%rsp), %rsi	# 708	[c=5 l=4]  *movdi_internal/3
+	movq	%rbx, (%rax)	# 208	[c=4 l=3]  *movdi_internal/5
+	movq	%rax, 8(%rbx)	# 209	[c=4 l=4]  *movdi_internal/5
+	movq	%rax, 984(%rsi)	# 210	[c=4 l=7]  *movdi_internal/5
+	addq	$32, %rax	# 211	[c=4 l=4]  *adddi_1/0
+	movq	%rax, 1072(%rsi)	# 212	[c=4 l=7]  *movdi_internal/5
+	jmp	.L1641	# 833	[c=1 l=5]  jump
+.L1696:
+	movq	(%rsp), %rax	# 684	[c=5 l=4]  *movdi_internal/3
+	xorl	%esi, %esi	# 793	[c=4 l=2]  *movdi_xor
+	leaq	952(%rax), %rdi	# 737	[c=4 l=7]  *leadi
+	call	gettimeofday@PLT	# 412	[c=10 l=5]  *call_value
+	jmp	.L1660	# 835	[c=1 l=5]  jump
+.L1691:
+	leaq	.LC58(%rip), %r9	# 167	[c=1 l=7]  *movdi_internal/4
+	movl	$16, %r8d	# 168	[c=4 l=6]  *movsi_internal/0
+	movl	%r12d, %ecx	# 169	[c=4 l=3]  *movsi_internal/0
+.L1685:
+	movq	(%rsp), %rdi	# 114	[c=5 l=4]  *movdi_internal/3
+	leaq	.LC4(%rip), %rdx	# 111	[c=1 l=7]  *movdi_internal/4
+	movl	$6, %esi	# 113	[c=4 l=5]  *movsi_internal/0
+	xorl	%eax, %eax	# 806	[c=4 l=2]  *movdi_xor
+	call	leave	# 116	[c=0 l=5]  *call
+.L1690:
+	leaq	.LC56(%rip), %r9	# 108	[c=1 l=7]  *movdi_internal/4
+.L1686:
+	movl	$1, %r8d	# 109	[c=4 l=6]  *movsi_internal/0
+	movl	%r13d, %ecx	# 110	[c=4 l=3]  *movsi_internal/0
+	jmp	.L1685	# 837	[c=1 l=2]  jump
+.L1689:
+	leaq	.LC40(%rip), %r9	# 73	[c=1 l=7]  *movdi_internal/4
+	movl	$1, %r8d	# 74	[c=4 l=6]  *movsi_internal/0
+	movl	%ebx, %ecx	# 75	[c=4 l=2]  *movsi_internal/0
+	jmp	.L1685	# 839	[c=1 l=2]  jump
+.L1694:
+	movq	(%rsp), %rdi	# 369	[c=5 l=4]  *movdi_internal/3
+	leal	(%rax,%rax), %ecx	# 739	[c=12 l=3]  *leasi
+	movq	%rbx, %r8	# 364	[c=4 l=3]  *movdi_internal/3
+	movl	$5, %esi	# 368	[c=4 l=5]  *movsi_internal/0
+	leaq	.LC61(%rip), %rdx	# 366	[c=1 l=7]  *movdi_internal/4
+	xorl	%eax, %eax	# 795	[c=4 l=2]  *movdi_xor
+	call	leave	# 371	[c=0 l=5]  *call
+.L1698:
+	movq	(%rsp), %rdi	# 202	[c=5 l=4]  *movdi_internal/3
+	movl	$8, %r8d	# 197	[c=4 l=6]  *movsi_internal/0
+	leaq	.LC37(%rip), %r9	# 196	[c=1 l=7]  *movdi_internal/4
+	movl	$4096, %ecx	# 198	[c=4 l=5]  *movsi_internal/0
+	leaq	.LC4(%rip), %rdx	# 199	[c=1 l=7]  *movdi_internal/4
+	movl	$6, %esi	# 201	[c=4 l=5]  *movsi_internal/0
+	call	leave	# 204	[c=0 l=5]  *call
+.L1695:
+	leaq	936(%rax), %rdi	# 738	[c=4 l=7]  *leadi
+	xorl	%esi, %esi	# 794	[c=4 l=2]  *movdi_xor
+	call	gettimeofday@PLT	# 381	[c=10 l=5]  *call_value
+	jmp	.L1656	# 841	[c=1 l=5]  jump
+.L1697:
+	movq	(%rsp), %rax	# 687	[c=5 l=4]  *movdi_internal/3
+	xorl	%esi, %esi	# 792	[c=4 l=2]  *movdi_xor
+	leaq	968(%rax), %rdi	# 736	[c=4 l=7]  *leadi
+	call	gettimeofday@PLT	# 437	[c=10 l=5]  *call_value
+	jmp	.L1664	# 843	[c=1 l=5]  jump
+	.cfi_endproc
+.LFE226:
+	.size	run_context, .-run_context
+	.p2align 4
+	.globl	put_mem
+	.type	put_mem, @function
+put_mem:
+.LFB63:
+	.cfi_startproc
+	testq	%rsi, %rsi	# 7	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L1699	# 8	[c=13 l=2]  *jcc
+	movq	-24(%rsi), %rdx	# 11	[c=9 l=4]  *movdi_internal/3
+	movq	-32(%rsi), %rax	# 12	[c=9 l=4]  *movdi_internal/3
+	leaq	-32(%rsi), %rcx	# 48	[c=4 l=4]  *leadi
+	testq	%rdx, %rdx	# 13	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L1701	# 14	[c=13 l=2]  *jcc
+	movq	%rax, (%rdx)	# 16	[c=4 l=3]  *movdi_internal/5
+.L1702:
+	testq	%rax, %rax	# 24	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L1703	# 25	[c=13 l=2]  *jcc
+	movq	%rdx, 8(%rax)	# 27	[c=4 l=4]  *movdi_internal/5
+.L1703:
+	movq	%rcx, %rdi	# 30	[c=4 l=3]  *movdi_internal/3
+	jmp	free@PLT	# 31	[c=0 l=5]  *sibcall
+	.p2align 4,,10
+	.p2align 3
+.L1699:
+	ret		# 51	[c=0 l=1]  simple_return_internal
+	.p2align 4,,10
+	.p2align 3
+.L1701:
+	movq	%rax, 984(%rdi)	# 21	[c=4 l=7]  *movdi_internal/5
+	jmp	.L1702	# 53	[c=1 l=2]  jump
+	.cfi_endproc
+.LFE63:
+	.size	put_mem, .-put_mem
+	.section	.rodata.str1.1
+.LC62:
+	.string	"out of memory opening %s"
+	.text
+	.p2align 4
+	.globl	get_file
+	.type	get_file, @function
+get_file:
+.LFB64:
+	.cfi_startproc
+	pushq	%r12	# 73	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	movq	%rsi, %r12	# 3	[c=4 l=3]  *movdi_internal/3
+	movq	%rdx, %rsi	# 4	[c=4 l=3]  *movdi_internal/3
+	pushq	%rbp	# 74	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	movq	%rdi, %rbp	# 2	[c=4 l=3]  *movdi_internal/3
+	movq	%r12, %rdi	# 9	[c=4 l=3]  *movdi_internal/3
+	pushq	%rbx	# 75	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	call	fopen@PLT	# 10	[c=10 l=5]  *call_value
+	movq	%rax, %rbx	# 11	[c=4 l=3]  *movdi_internal/3
+	testq	%rax, %rax	# 13	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L1707	# 14	[c=13 l=2]  *jcc
+	movl	$32, %esi	# 16	[c=4 l=5]  *movdi_internal/2
+	movl	$1, %edi	# 17	[c=4 l=5]  *movdi_internal/2
+	call	calloc@PLT	# 18	[c=10 l=5]  *call_value
+	testq	%rax, %rax	# 21	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L1718	# 22	[c=13 l=2]  *jcc
+	movq	984(%rbp), %rdx	# 38	[c=9 l=7]  *movdi_internal/3
+	movq	%rbx, 16(%rax)	# 36	[c=4 l=4]  *movdi_internal/5
+	movq	$0, 8(%rax)	# 37	[c=4 l=8]  *movdi_internal/5
+	movq	%rdx, (%rax)	# 39	[c=4 l=3]  *movdi_internal/5
+	testq	%rdx, %rdx	# 40	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L1710	# 41	[c=13 l=2]  *jcc
+	movq	%rax, 8(%rdx)	# 43	[c=4 l=4]  *movdi_internal/5
+.L1710:
+	movq	%rax, 984(%rbp)	# 46	[c=4 l=7]  *movdi_internal/5
+.L1707:
+	movq	%rbx, %rax	# 52	[c=4 l=3]  *movdi_internal/3
+	popq	%rbx	# 78	[c=9 l=1]  *popdi1
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbp	# 79	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 16
+	popq	%r12	# 80	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 8
+	ret		# 81	[c=0 l=1]  simple_return_internal
+.L1718:
+	.cfi_restore_state
+	movq	%rbx, %rdi	# 24	[c=4 l=3]  *movdi_internal/3
+	call	fclose@PLT	# 25	[c=10 l=5]  *call_value
+	movq	%r12, %rcx	# 26	[c=4 l=3]  *movdi_internal/3
+	movl	$6, %esi	# 29	[c=4 l=5]  *movsi_internal/0
+	movq	%rbp, %rdi	# 30	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC62(%rip), %rdx	# 27	[c=1 l=7]  *movdi_internal/4
+	xorl	%eax, %eax	# 85	[c=4 l=2]  *movdi_xor
+	call	leave	# 32	[c=0 l=5]  *call
+	.cfi_endproc
+.LFE64:
+	.size	get_file, .-get_file
+	.p2align 4
+	.globl	put_file
+	.type	put_file, @function
+put_file:
+.LFB65:
+	.cfi_startproc
+	pushq	%rbx	# 79	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	movq	984(%rdi), %rax	# 7	[c=9 l=7]  *movdi_internal/3
+	movq	%rsi, %rbx	# 3	[c=4 l=3]  *movdi_internal/3
+	testq	%rax, %rax	# 8	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L1720	# 9	[c=13 l=2]  *jcc
+	movq	%rdi, %rcx	# 85	[c=4 l=3]  *movdi_internal/3
+	jmp	.L1725	# 90	[c=1 l=2]  jump
+	.p2align 4,,10
+	.p2align 3
+.L1721:
+	testq	%rax, %rax	# 42	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L1720	# 43	[c=13 l=2]  *jcc
+.L1725:
+	movq	16(%rax), %rdx	# 11	[c=9 l=4]  *movdi_internal/3
+	movq	%rax, %rdi	# 12	[c=4 l=3]  *movdi_internal/3
+	movq	(%rax), %rax	# 13	[c=5 l=3]  *movdi_internal/3
+	cmpq	%rbx, %rdx	# 14	[c=4 l=3]  *cmpdi_1/0
+	jne	.L1721	# 15	[c=13 l=2]  *jcc
+	movq	8(%rdi), %rdx	# 17	[c=9 l=4]  *movdi_internal/3
+	testq	%rdx, %rdx	# 18	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L1722	# 19	[c=13 l=2]  *jcc
+	movq	%rax, (%rdx)	# 21	[c=4 l=3]  *movdi_internal/5
+.L1723:
+	testq	%rax, %rax	# 29	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L1724	# 30	[c=13 l=2]  *jcc
+	movq	%rdx, 8(%rax)	# 32	[c=4 l=4]  *movdi_internal/5
+.L1724:
+	call	free@PLT	# 36	[c=0 l=5]  *call
+.L1720:
+	movq	%rbx, %rdi	# 46	[c=4 l=3]  *movdi_internal/3
+	popq	%rbx	# 88	[c=9 l=1]  *popdi1
+	.cfi_remember_state
+	.cfi_def_cfa_offset 8
+	jmp	fclose@PLT	# 47	[c=10 l=5]  *sibcall_value
+	.p2align 4,,10
+	.p2align 3
+.L1722:
+	.cfi_restore_state
+	movq	%rax, 984(%rcx)	# 26	[c=4 l=7]  *movdi_internal/5
+	jmp	.L1723	# 92	[c=1 l=2]  jump
+	.cfi_endproc
+.LFE65:
+	.size	put_file, .-put_file
+	.p2align 4
+	.globl	write_checkpoint
+	.type	write_checkpoint, @function
+write_checkpoint:
+.LFB213:
+	.cfi_startproc
+	pushq	%rbx	# 15	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	movq	%rdi, %rbx	# 2	[c=4 l=3]  *movdi_internal/3
+	call	checkpoint_begin@PLT	# 7	[c=0 l=5]  *call
+	movq	%rbx, %rdi	# 8	[c=4 l=3]  *movdi_internal/3
+	popq	%rbx	# 22	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 8
+	jmp	checkpoint_end@PLT	# 9	[c=0 l=5]  *sibcall
+	.cfi_endproc
+.LFE213:
+	.size	write_checkpoint, .-write_checkpoint
+	.section	.text.startup,"ax",@progbits
+	.p2align 4
+	.globl	main
+	.type	main, @function
+main:
+.LFB227:
+	.cfi_startproc
+	pushq	%r13	# 53	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 16
+	.cfi_offset 13, -16
+	movl	$11112, %edx	# 15	[c=4 l=5]  *movdi_internal/2
+	pushq	%r12	# 54	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 24
+	.cfi_offset 12, -24
+	movq	%rsi, %r12	# 3	[c=4 l=3]  *movdi_internal/3
+	xorl	%esi, %esi	# 74	[c=4 l=2]  *movdi_xor
+	pushq	%rbp	# 55	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 32
+	.cfi_offset 6, -32
+	movl	%edi, %ebp	# 2	[c=4 l=2]  *movsi_internal/0
+	pushq	%rbx	# 56	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 40
+	.cfi_offset 3, -40
+	leaq	cx.3(%rip), %rbx	# 12	[c=1 l=7]  *movdi_internal/4
+	movq	%rbx, %rdi	# 17	[c=4 l=3]  *movdi_internal/3
+	subq	$24, %rsp	# 57	[c=4 l=4]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_def_cfa_offset 64
+	movq	stderr(%rip), %r13	# 7	[c=6 l=7]  *movdi_internal/3
+	movq	stdin(%rip), %xmm0	# 48	[c=6 l=9]  *movdi_internal/14
+	movhps	stdout(%rip), %xmm0	# 10	[c=4 l=7]  vec_concatv2di/7
+	movaps	%xmm0, (%rsp)	# 51	[c=4 l=4]  movv2di_internal/3
+	call	memset@PLT	# 18	[c=10 l=5]  *call_value
+	movdqa	(%rsp), %xmm0	# 52	[c=9 l=5]  movv2di_internal/2
+	leaq	100(%rbx), %rax	# 23	[c=4 l=4]  *leadi
+	movq	%rbx, %rdi	# 31	[c=4 l=3]  *movdi_internal/3
+	movq	%r13, 912+cx.3(%rip)	# 29	[c=4 l=7]  *movdi_internal/5
+	movq	%rax, 104+cx.3(%rip)	# 50	[c=4 l=7]  *movdi_internal/5
+	movl	$-1, 10896+cx.3(%rip)	# 25	[c=4 l=10]  *movsi_internal/1
+	movaps	%xmm0, 896+cx.3(%rip)	# 27	[c=4 l=7]  movv2di_internal/3
+	call	events_init@PLT	# 32	[c=0 l=5]  *call
+	addq	$24, %rsp	# 68	[c=4 l=4]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_def_cfa_offset 40
+	movq	%r12, %rdx	# 33	[c=4 l=3]  *movdi_internal/3
+	movl	%ebp, %esi	# 34	[c=4 l=2]  *movsi_internal/0
+	movq	%rbx, %rdi	# 36	[c=4 l=3]  *movdi_internal/3
+	popq	%rbx	# 69	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 32
+	popq	%rbp	# 70	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 24
+	popq	%r12	# 71	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 16
+	popq	%r13	# 72	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 8
+	jmp	run_context	# 37	[c=10 l=5]  *sibcall_value
+	.cfi_endproc
+.LFE227:
+	.size	main, .-main
+	.section	.rodata.str1.1
+.LC63:
+	.string	"%s: out of memory\n"
+	.text
+	.p2align 4
+	.globl	job_main
+	.type	job_main, @function
+job_main:
+.LFB228:
+	.cfi_startproc
+	pushq	%r15	# 70	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	movq	%rdx, %r15	# 4	[c=4 l=3]  *movdi_internal/3
+	pushq	%r14	# 71	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	movq	%rcx, %r14	# 5	[c=4 l=3]  *movdi_internal/3
+	pushq	%r13	# 72	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	movq	%r9, %r13	# 7	[c=4 l=3]  *movdi_internal/3
+	pushq	%r12	# 73	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	movq	%r8, %r12	# 6	[c=4 l=3]  *movdi_internal/3
+	pushq	%rbp	# 74	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	movq	%rsi, %rbp	# 3	[c=4 l=3]  *movdi_internal/3
+	movl	$1, %esi	# 12	[c=4 l=5]  *movdi_internal/2
+	pushq	%rbx	# 75	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$24, %rsp	# 76	[c=4 l=4]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_def_cfa_offset 80
+	movl	%edi, 12(%rsp)	# 2	[c=4 l=4]  *movsi_internal/1
+	movl	$11112, %edi	# 13	[c=4 l=5]  *movdi_internal/2
+	call	calloc@PLT	# 14	[c=10 l=5]  *call_value
+	testq	%rax, %rax	# 17	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L1742	# 18	[c=13 l=2]  *jcc
+	movq	%rax, %rbx	# 87	[c=4 l=3]  *movdi_internal/3
+	leaq	100(%rax), %rax	# 69	[c=4 l=4]  *leadi
+	movl	$0, 0(%r13)	# 30	[c=4 l=8]  *movsi_internal/1
+	pxor	%xmm0, %xmm0	# 31	[c=4 l=4]  movv2di_internal/0
+	movq	%rax, 104(%rbx)	# 35	[c=4 l=4]  *movdi_internal/5
+	movq	%rbx, %rdi	# 40	[c=4 l=3]  *movdi_internal/3
+	movq	$0, 24(%r13)	# 33	[c=4 l=8]  *movdi_internal/5
+	movl	$-1, 10896(%rbx)	# 36	[c=4 l=10]  *movsi_internal/1
+	movq	%r15, 896(%rbx)	# 37	[c=4 l=7]  *movdi_internal/5
+	movq	%r14, 904(%rbx)	# 38	[c=4 l=7]  *movdi_internal/5
+	movq	%r12, 912(%rbx)	# 39	[c=4 l=7]  *movdi_internal/5
+	movups	%xmm0, 8(%r13)	# 32	[c=4 l=5]  movv2di_internal/3
+	call	events_init@PLT	# 41	[c=0 l=5]  *call
+	movl	12(%rsp), %esi	# 44	[c=9 l=4]  *movsi_internal/0
+	movq	%rbp, %rdx	# 43	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rdi	# 45	[c=4 l=3]  *movdi_internal/3
+	movq	%r13, 11016(%rbx)	# 42	[c=4 l=7]  *movdi_internal/5
+	call	run_context	# 46	[c=10 l=5]  *call_value
+	movq	%rbx, %rdi	# 48	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, %ebp	# 47	[c=4 l=2]  *movsi_internal/0
+	call	free@PLT	# 49	[c=0 l=5]  *call
+.L1738:
+	addq	$24, %rsp	# 79	[c=4 l=4]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	movl	%ebp, %eax	# 55	[c=4 l=2]  *movsi_internal/0
+	popq	%rbx	# 80	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 48
+	popq	%rbp	# 81	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 40
+	popq	%r12	# 82	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 32
+	popq	%r13	# 83	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 24
+	popq	%r14	# 84	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 16
+	popq	%r15	# 85	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 8
+	ret		# 86	[c=0 l=1]  simple_return_internal
+.L1742:
+	.cfi_restore_state
+	movq	0(%rbp), %rdx	# 20	[c=5 l=4]  *movdi_internal/3
+	leaq	.LC63(%rip), %rsi	# 21	[c=1 l=7]  *movdi_internal/4
+	movq	%r12, %rdi	# 23	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 91	[c=4 l=2]  *movdi_xor
+	movl	$20, %ebp	# 9	[c=4 l=5]  *movsi_internal/0
+	call	fprintf@PLT	# 25	[c=10 l=5]  *call_value
+	jmp	.L1738	# 93	[c=1 l=2]  jump
+	.cfi_endproc
+.LFE228:
+	.size	job_main, .-job_main
+	.section	.rodata
+	.align 16
+	.type	CSWTCH.175, @object
+	.size	CSWTCH.175, 20
+CSWTCH.175:
+	.long	1
+	.long	0
+	.long	2
+	.long	0
+	.long	3
+	.align 16
+	.type	se.0, @object
+	.size	se.0, 24
+se.0:
+	.value	83
+	.byte	1
+	.zero	1
+	.value	85
+	.byte	32
+	.zero	1
+	.value	85
+	.byte	64
+	.zero	1
+	.value	85
+	.byte	-128
+	.zero	1
+	.value	58
+	.byte	1
+	.zero	1
+	.value	72
+	.byte	1
+	.zero	1
+	.section	.data.rel.ro.local,"aw"
+	.align 32
+	.type	fused.1, @object
+	.size	fused.1, 328
+fused.1:
+	.quad	.L1079
+	.quad	.L1080
+	.quad	.L1083
+	.quad	.L1086
+	.quad	.L1087
+	.quad	.L1090
+	.quad	.L1093
+	.quad	.L1094
+	.quad	.L1095
+	.quad	.L1098
+	.quad	.L1101
+	.quad	.L1104
+	.quad	.L1107
+	.quad	.L1110
+	.quad	.L1113
+	.quad	.L1116
+	.quad	.L1119
+	.quad	.L1122
+	.quad	.L1125
+	.quad	.L1128
+	.quad	.L1129
+	.quad	.L1130
+	.quad	.L1131
+	.quad	.L1132
+	.quad	.L1135
+	.quad	.L1138
+	.quad	.L1141
+	.quad	.L1146
+	.quad	.L1153
+	.quad	.L1154
+	.quad	.L1155
+	.quad	.L1169
+	.quad	.L1170
+	.quad	.L1174
+	.quad	.L1178
+	.quad	.L1182
+	.quad	.L1186
+	.quad	.L1187
+	.quad	.L1194
+	.quad	.L1200
+	.quad	.L1212
+	.align 32
+	.type	handler.2, @object
+	.size	handler.2, 896
+handler.2:
+	.quad	.L576
+	.quad	.L577
+	.quad	.L581
+	.quad	.L582
+	.quad	.L600
+	.quad	.L603
+	.quad	.L606
+	.quad	.L607
+	.quad	.L608
+	.quad	.L611
+	.quad	.L614
+	.quad	.L617
+	.quad	.L618
+	.quad	.L619
+	.quad	.L622
+	.quad	.L625
+	.quad	.L628
+	.quad	.L629
+	.quad	.L630
+	.quad	.L653
+	.quad	.L662
+	.quad	.L663
+	.quad	.L666
+	.quad	.L667
+	.quad	.L670
+	.quad	.L673
+	.quad	.L676
+	.quad	.L679
+	.quad	.L680
+	.quad	.L707
+	.quad	.L714
+	.quad	.L718
+	.quad	.L722
+	.quad	.L729
+	.quad	.L732
+	.quad	.L750
+	.quad	.L751
+	.quad	.L752
+	.quad	.L753
+	.quad	.L776
+	.quad	.L779
+	.quad	.L783
+	.quad	.L786
+	.quad	.L789
+	.quad	.L790
+	.quad	.L794
+	.quad	.L798
+	.quad	.L802
+	.quad	.L806
+	.quad	.L810
+	.quad	.L814
+	.quad	.L818
+	.quad	.L822
+	.quad	.L826
+	.quad	.L830
+	.quad	.L834
+	.quad	.L835
+	.quad	.L836
+	.quad	.L837
+	.quad	.L840
+	.quad	.L841
+	.quad	.L842
+	.quad	.L843
+	.quad	.L844
+	.quad	.L845
+	.quad	.L848
+	.quad	.L849
+	.quad	.L852
+	.quad	.L855
+	.quad	.L859
+	.quad	.L860
+	.quad	.L874
+	.quad	.L896
+	.quad	.L918
+	.quad	.L940
+	.quad	.L943
+	.quad	.L946
+	.quad	.L947
+	.quad	.L948
+	.quad	.L957
+	.quad	.L963
+	.quad	.L969
+	.quad	.L975
+	.quad	.L981
+	.quad	.L984
+	.quad	.L987
+	.quad	.L990
+	.quad	.L993
+	.quad	.L998
+	.quad	.L1012
+	.quad	.L1016
+	.quad	.L1020
+	.quad	.L1024
+	.quad	.L1028
+	.quad	.L1032
+	.quad	.L1036
+	.quad	.L1040
+	.quad	.L1044
+	.quad	.L1048
+	.quad	.L1052
+	.quad	.L1056
+	.quad	.L1059
+	.quad	.L1062
+	.quad	.L1063
+	.quad	.L1064
+	.quad	.L1066
+	.quad	.L1069
+	.quad	.L1072
+	.quad	.L1075
+	.quad	.L1076
+	.quad	.L1077
+	.quad	.L1078
+	.local	cx.3
+	.comm	cx.3,11112,32
+	.globl	opcodes
+	.section	.rodata.str1.1
+.LC64:
+	.string	"bad PC"
+.LC65:
+	.string	"ILLEGAL"
+.LC66:
+	.string	""
+.LC67:
+	.string	"*** SYSCALL"
+.LC68:
+	.string	"ADC"
+.LC69:
+	.string	"ADD"
+.LC70:
+	.string	"ADIW"
+.LC71:
+	.string	"SBIW"
+.LC72:
+	.string	"AND"
+.LC73:
+	.string	"ANDI"
+.LC74:
+	.string	"ASR"
+.LC75:
+	.string	"CL*"
+.LC76:
+	.string	"BLD.*"
+.LC77:
+	.string	"BREAK"
+.LC78:
+	.string	"BR*C"
+.LC79:
+	.string	"BR*S"
+.LC80:
+	.string	"SE*"
+.LC81:
+	.string	"BST.*"
+.LC82:
+	.string	"CALL"
+.LC83:
+	.string	"CBI.*"
+.LC84:
+	.string	"COM"
+.LC85:
+	.string	"CP"
+.LC86:
+	.string	"CPC"
+.LC87:
+	.string	"CPI"
+.LC88:
+	.string	"CPSE"
+.LC89:
+	.string	"DEC"
+.LC90:
+	.string	"DES"
+.LC91:
+	.string	"EICALL"
+.LC92:
+	.string	"EIJMP"
+.LC93:
+	.string	"ELPM"
+.LC94:
+	.string	"ELPM Z"
+.LC95:
+	.string	"ELPM Z+"
+.LC96:
+	.string	"EOR"
+.LC97:
+	.string	"ESPM"
+.LC98:
+	.string	"FMUL"
+.LC99:
+	.string	"FMULS"
+.LC100:
+	.string	"FMULSU"
+.LC101:
+	.string	"ICALL"
+.LC102:
+	.string	"IJMP"
+.LC103:
+	.string	"IN"
+.LC104:
+	.string	"INC"
+.LC105:
+	.string	"JMP"
+.LC106:
+	.string	"LDI"
+.LC107:
+	.string	"LDD Y+q"
+.LC108:
+	.string	"LDD Z+q"
+.LC109:
+	.string	"LDS"
+.LC110:
+	.string	"LD X"
+.LC111:
+	.string	"LD -X"
+.LC112:
+	.string	"LD X+"
+.LC113:
+	.string	"LD -Y"
+.LC114:
+	.string	"LD Y+"
+.LC115:
+	.string	"LD -Z"
+.LC116:
+	.string	"LD Z+"
+.LC117:
+	.string	"LPM"
+.LC118:
+	.string	"LPM Z"
+.LC119:
+	.string	"LPM Z+"
+.LC120:
+	.string	"LSR"
+.LC121:
+	.string	"MOV"
+.LC122:
+	.string	"MOVW"
+.LC123:
+	.string	"MUL"
+.LC124:
+	.string	"MULS"
+.LC125:
+	.string	"MULSU"
+.LC126:
+	.string	"NEG"
+.LC127:
+	.string	"NOP"
+.LC128:
+	.string	"OR"
+.LC129:
+	.string	"ORI"
+.LC130:
+	.string	"OUT"
+.LC131:
+	.string	"POP"
+.LC132:
+	.string	"PUSH"
+.LC133:
+	.string	"RCALL"
+.LC134:
+	.string	"RET"
+.LC135:
+	.string	"RETI"
+.LC136:
+	.string	"RJMP"
+.LC137:
+	.string	"ROR"
+.LC138:
+	.string	"SBC"
+.LC139:
+	.string	"SBCI"
+.LC140:
+	.string	"SBI.*"
+.LC141:
+	.string	"SBIC.*"
+.LC142:
+	.string	"SBIS.*"
+.LC143:
+	.string	"SBRC.*"
+.LC144:
+	.string	"SBRS.*"
+.LC145:
+	.string	"SLEEP"
+.LC146:
+	.string	"SPM"
+.LC147:
+	.string	"STD Y+q"
+.LC148:
+	.string	"STD Z+q"
+.LC149:
+	.string	"STS"
+.LC150:
+	.string	"ST X"
+.LC151:
+	.string	"ST -X"
+.LC152:
+	.string	"ST X+"
+.LC153:
+	.string	"ST -Y"
+.LC154:
+	.string	"ST Y+"
+.LC155:
+	.string	"ST -Z"
+.LC156:
+	.string	"ST Z+"
+.LC157:
+	.string	"SUB"
+.LC158:
+	.string	"SUBI"
+.LC159:
+	.string	"SWAP"
+.LC160:
+	.string	"WDR"
+.LC161:
+	.string	"CLR"
+.LC162:
+	.string	"LSL"
+.LC163:
+	.string	"ROL"
+.LC164:
+	.string	"TST"
+.LC165:
+	.string	"XCH"
+.LC166:
+	.string	"LAS"
+.LC167:
+	.string	"LAC"
+.LC168:
+	.string	"LAT"
+	.section	.data.rel.ro.local
+	.align 32
+	.type	opcodes, @object
+	.size	opcodes, 1792
+opcodes:
+	.quad	.LC64
+	.value	0
+	.value	0
+	.zero	4
+	.quad	.LC65
+	.value	0
+	.value	0
+	.zero	4
+	.quad	.LC66
+	.value	0
+	.value	0
+	.zero	4
+	.quad	.LC67
+	.value	2
+	.value	0
+	.zero	4
+	.quad	.LC68
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC69
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC70
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC71
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC72
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC73
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC74
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC75
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC76
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC77
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC78
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC79
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC80
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC81
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC82
+	.value	2
+	.value	4
+	.zero	4
+	.quad	.LC83
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC84
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC85
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC86
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC87
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC88
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC88
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC89
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC90
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC91
+	.value	1
+	.value	4
+	.zero	4
+	.quad	.LC92
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC93
+	.value	1
+	.value	3
+	.zero	4
+	.quad	.LC94
+	.value	1
+	.value	3
+	.zero	4
+	.quad	.LC95
+	.value	1
+	.value	3
+	.zero	4
+	.quad	.LC96
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC97
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC98
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC99
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC100
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC101
+	.value	1
+	.value	3
+	.zero	4
+	.quad	.LC102
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC103
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC104
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC105
+	.value	2
+	.value	3
+	.zero	4
+	.quad	.LC106
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC107
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC108
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC109
+	.value	2
+	.value	2
+	.zero	4
+	.quad	.LC109
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC110
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC111
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC112
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC113
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC114
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC115
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC116
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC117
+	.value	1
+	.value	3
+	.zero	4
+	.quad	.LC118
+	.value	1
+	.value	3
+	.zero	4
+	.quad	.LC119
+	.value	1
+	.value	3
+	.zero	4
+	.quad	.LC120
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC121
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC122
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC123
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC124
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC125
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC126
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC127
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC128
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC129
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC130
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC131
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC132
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC133
+	.value	1
+	.value	3
+	.zero	4
+	.quad	.LC134
+	.value	1
+	.value	4
+	.zero	4
+	.quad	.LC135
+	.value	1
+	.value	4
+	.zero	4
+	.quad	.LC136
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC137
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC138
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC139
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC140
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC141
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC141
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC142
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC142
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC143
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC143
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC144
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC144
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC145
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC146
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC147
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC148
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC149
+	.value	2
+	.value	2
+	.zero	4
+	.quad	.LC149
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC150
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC151
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC152
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC153
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC154
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC155
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC156
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC157
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC158
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC159
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC160
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC161
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC162
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC163
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC164
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC165
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC166
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC167
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC168
+	.value	1
+	.value	1
+	.zero	4
+	.globl	named_sfr
+	.section	.rodata.str1.1
+.LC169:
+	.string	"SPL"
+.LC170:
+	.string	"SPH"
+.LC171:
+	.string	"RAMPZ"
+.LC172:
+	.string	"RAMPY"
+.LC173:
+	.string	"RAMPX"
+.LC174:
+	.string	"RAMPD"
+.LC175:
+	.string	"EIND"
+	.section	.data.rel.ro.local
+	.align 32
+	.type	named_sfr, @object
+	.size	named_sfr, 192
+named_sfr:
+	.long	93
+	.zero	4
+	.quad	.LC169
+	.long	0
+	.zero	4
+	.long	94
+	.zero	4
+	.quad	.LC170
+	.long	0
+	.zero	4
+	.long	91
+	.zero	4
+	.quad	.LC171
+	.long	0
+	.zero	4
+	.long	90
+	.zero	4
+	.quad	.LC172
+	.long	1
+	.zero	4
+	.long	89
+	.zero	4
+	.quad	.LC173
+	.long	1
+	.zero	4
+	.long	88
+	.zero	4
+	.quad	.LC174
+	.long	1
+	.zero	4
+	.long	92
+	.zero	4
+	.quad	.LC175
+	.long	2
+	.zero	4
+	.long	0
+	.zero	4
+	.quad	0
+	.long	0
+	.zero	4
+	.globl	addr_SPL
+	.section	.rodata
+	.align 4
+	.type	addr_SPL, @object
+	.size	addr_SPL, 4
+addr_SPL:
+	.long	93
+	.globl	addr_SREG
+	.align 4
+	.type	addr_SREG, @object
+	.size	addr_SREG, 4
+addr_SREG:
+	.long	95
+	.section	.rodata.str1.1
+.LC176:
+	.string	"EXIT"
+.LC177:
+	.string	"TIMEOUT"
+.LC178:
+	.string	"usage"
+.LC179:
+	.string	"memory"
+.LC180:
+	.string	"file i/o"
+.LC181:
+	.string	"FATAL ABORTED"
+.LC182:
+	.string	"fatal"
+	.section	.data.rel.ro.local
+	.align 32
+	.type	exit_status, @object
+	.size	exit_status, 216
+exit_status:
+	.quad	.LC176
+	.quad	0
+	.long	0
+	.long	-1
+	.quad	.LC0
+	.quad	0
+	.long	0
+	.long	1
+	.quad	.LC177
+	.quad	0
+	.long	0
+	.long	10
+	.quad	.LC0
+	.quad	0
+	.long	0
+	.long	11
+	.quad	.LC0
+	.quad	0
+	.long	0
+	.long	12
+	.quad	.LC0
+	.quad	.LC178
+	.long	1
+	.long	21
+	.quad	.LC0
+	.quad	.LC179
+	.long	1
+	.long	20
+	.quad	.LC0
+	.quad	.LC180
+	.long	1
+	.long	22
+	.quad	.LC181
+	.quad	.LC182
+	.long	1
+	.long	42
+	.section	.rodata.str1.1
+.LC183:
+	.string	"BAD_PC"
+.LC184:
+	.string	"UNDEF"
+.LC185:
+	.string	"SYSCALL"
+.LC186:
+	.string	"BCLR"
+.LC187:
+	.string	"BLD"
+.LC188:
+	.string	"BRBC"
+.LC189:
+	.string	"BRBS"
+.LC190:
+	.string	"BSET"
+.LC191:
+	.string	"BST"
+.LC192:
+	.string	"CBI"
+.LC193:
+	.string	"CPSE2"
+.LC194:
+	.string	"ELPM_Z"
+.LC195:
+	.string	"ELPM_Z_incr"
+.LC196:
+	.string	"LDD_Y"
+.LC197:
+	.string	"LDD_Z"
+.LC198:
+	.string	"LDS1"
+.LC199:
+	.string	"LD_X"
+.LC200:
+	.string	"LD_X_decr"
+.LC201:
+	.string	"LD_X_incr"
+.LC202:
+	.string	"LD_Y_decr"
+.LC203:
+	.string	"LD_Y_incr"
+.LC204:
+	.string	"LD_Z_decr"
+.LC205:
+	.string	"LD_Z_incr"
+.LC206:
+	.string	"LPM_Z"
+.LC207:
+	.string	"LPM_Z_incr"
+.LC208:
+	.string	"SBI"
+.LC209:
+	.string	"SBIC"
+.LC210:
+	.string	"SBIC2"
+.LC211:
+	.string	"SBIS"
+.LC212:
+	.string	"SBIS2"
+.LC213:
+	.string	"SBRC"
+.LC214:
+	.string	"SBRC2"
+.LC215:
+	.string	"SBRS"
+.LC216:
+	.string	"SBRS2"
+.LC217:
+	.string	"STD_Y"
+.LC218:
+	.string	"STD_Z"
+.LC219:
+	.string	"STS1"
+.LC220:
+	.string	"ST_X"
+.LC221:
+	.string	"ST_X_decr"
+.LC222:
+	.string	"ST_X_incr"
+.LC223:
+	.string	"ST_Y_decr"
+.LC224:
+	.string	"ST_Y_incr"
+.LC225:
+	.string	"ST_Z_decr"
+.LC226:
+	.string	"ST_Z_incr"
+	.section	.data.rel.ro.local
+	.align 32
+	.type	opcode_id, @object
+	.size	opcode_id, 896
+opcode_id:
+	.quad	.LC183
+	.quad	.LC65
+	.quad	.LC184
+	.quad	.LC185
+	.quad	.LC68
+	.quad	.LC69
+	.quad	.LC70
+	.quad	.LC71
+	.quad	.LC72
+	.quad	.LC73
+	.quad	.LC74
+	.quad	.LC186
+	.quad	.LC187
+	.quad	.LC77
+	.quad	.LC188
+	.quad	.LC189
+	.quad	.LC190
+	.quad	.LC191
+	.quad	.LC82
+	.quad	.LC192
+	.quad	.LC84
+	.quad	.LC85
+	.quad	.LC86
+	.quad	.LC87
+	.quad	.LC88
+	.quad	.LC193
+	.quad	.LC89
+	.quad	.LC90
+	.quad	.LC91
+	.quad	.LC92
+	.quad	.LC93
+	.quad	.LC194
+	.quad	.LC195
+	.quad	.LC96
+	.quad	.LC97
+	.quad	.LC98
+	.quad	.LC99
+	.quad	.LC100
+	.quad	.LC101
+	.quad	.LC102
+	.quad	.LC103
+	.quad	.LC104
+	.quad	.LC105
+	.quad	.LC106
+	.quad	.LC196
+	.quad	.LC197
+	.quad	.LC109
+	.quad	.LC198
+	.quad	.LC199
+	.quad	.LC200
+	.quad	.LC201
+	.quad	.LC202
+	.quad	.LC203
+	.quad	.LC204
+	.quad	.LC205
+	.quad	.LC117
+	.quad	.LC206
+	.quad	.LC207
+	.quad	.LC120
+	.quad	.LC121
+	.quad	.LC122
+	.quad	.LC123
+	.quad	.LC124
+	.quad	.LC125
+	.quad	.LC126
+	.quad	.LC127
+	.quad	.LC128
+	.quad	.LC129
+	.quad	.LC130
+	.quad	.LC131
+	.quad	.LC132
+	.quad	.LC133
+	.quad	.LC134
+	.quad	.LC135
+	.quad	.LC136
+	.quad	.LC137
+	.quad	.LC138
+	.quad	.LC139
+	.quad	.LC208
+	.quad	.LC209
+	.quad	.LC210
+	.quad	.LC211
+	.quad	.LC212
+	.quad	.LC213
+	.quad	.LC214
+	.quad	.LC215
+	.quad	.LC216
+	.quad	.LC145
+	.quad	.LC146
+	.quad	.LC217
+	.quad	.LC218
+	.quad	.LC149
+	.quad	.LC219
+	.quad	.LC220
+	.quad	.LC221
+	.quad	.LC222
+	.quad	.LC223
+	.quad	.LC224
+	.quad	.LC225
+	.quad	.LC226
+	.quad	.LC157
+	.quad	.LC158
+	.quad	.LC159
+	.quad	.LC160
+	.quad	.LC161
+	.quad	.LC162
+	.quad	.LC163
+	.quad	.LC164
+	.quad	.LC165
+	.quad	.LC166
+	.quad	.LC167
+	.quad	.LC168
+	.section	.rodata.str1.1
+.LC227:
+	.string	"LDI + LDI"
+.LC228:
+	.string	"CP + CPC"
+.LC229:
+	.string	"CPI + CPC"
+.LC230:
+	.string	"CPC + CPC"
+.LC231:
+	.string	"CP + BRBC"
+.LC232:
+	.string	"CP + BRBS"
+.LC233:
+	.string	"CPC + BRBC"
+.LC234:
+	.string	"CPC + BRBS"
+.LC235:
+	.string	"CPI + BRBC"
+.LC236:
+	.string	"CPI + BRBS"
+.LC237:
+	.string	"TST + BRBC"
+.LC238:
+	.string	"TST + BRBS"
+.LC239:
+	.string	"CP + CPC + BRBC"
+.LC240:
+	.string	"CP + CPC + BRBS"
+.LC241:
+	.string	"CPI + CPC + BRBC"
+.LC242:
+	.string	"CPI + CPC + BRBS"
+.LC243:
+	.string	"CP + CPC + CPC + CPC"
+.LC244:
+	.string	"SUBI + SBCI"
+.LC245:
+	.string	"SUBI + BRBC"
+.LC246:
+	.string	"SBCI + BRBC"
+.LC247:
+	.string	"SBCI + BRBS"
+.LC248:
+	.string	"SBIW + BRBC"
+.LC249:
+	.string	"SBIW + BRBS"
+.LC250:
+	.string	"DEC + BRBC"
+.LC251:
+	.string	"SUBI + SBCI + BRBC"
+.LC252:
+	.string	"ADD + ADC"
+.LC253:
+	.string	"ADD + ADC + ADC"
+.LC254:
+	.string	"ADD + ADC + ADC + ADC"
+.LC255:
+	.string	"MOVW + ADIW"
+.LC256:
+	.string	"MOVW + SBIW"
+.LC257:
+	.string	"PUSH + PUSH"
+.LC258:
+	.string	"POP + POP"
+.LC259:
+	.string	"LD_X_incr + ST_Z_incr"
+.LC260:
+	.string	"LD_Z_incr + ST_X_incr"
+.LC261:
+	.string	"LD_Y_incr + ST_Z_incr"
+.LC262:
+	.string	"LD_Z_incr + ST_Y_incr"
+.LC263:
+	.string	"LPM_Z_incr + ST_X_incr"
+.LC264:
+	.string	"ELPM_Z_incr + ST_X_incr"
+	.section	.rodata.str1.8
+	.align 8
+.LC265:
+	.string	"LPM_Z_incr + ST_X_incr + CPI + CPC"
+	.align 8
+.LC266:
+	.string	"ELPM_Z_incr + ST_X_incr + CPI + CPC"
+	.section	.rodata.str1.1
+.LC267:
+	.string	"ST_X_incr + CPI + CPC + BRBC"
+	.section	.data.rel.ro.local
+	.align 32
+	.type	fuse_seq, @object
+	.size	fuse_seq, 656
+fuse_seq:
+	.long	2
+	.string	"++"
+	.zero	1
+	.quad	.LC227
+	.long	2
+	.string	"\025\026"
+	.zero	1
+	.quad	.LC228
+	.long	2
+	.string	"\027\026"
+	.zero	1
+	.quad	.LC229
+	.long	2
+	.string	"\026\026"
+	.zero	1
+	.quad	.LC230
+	.long	2
+	.string	"\025\016"
+	.zero	1
+	.quad	.LC231
+	.long	2
+	.string	"\025\017"
+	.zero	1
+	.quad	.LC232
+	.long	2
+	.string	"\026\016"
+	.zero	1
+	.quad	.LC233
+	.long	2
+	.string	"\026\017"
+	.zero	1
+	.quad	.LC234
+	.long	2
+	.string	"\027\016"
+	.zero	1
+	.quad	.LC235
+	.long	2
+	.string	"\027\017"
+	.zero	1
+	.quad	.LC236
+	.long	2
+	.string	"k\016"
+	.zero	1
+	.quad	.LC237
+	.long	2
+	.string	"k\017"
+	.zero	1
+	.quad	.LC238
+	.long	3
+	.string	"\025\026\016"
+	.quad	.LC239
+	.long	3
+	.string	"\025\026\017"
+	.quad	.LC240
+	.long	3
+	.string	"\027\026\016"
+	.quad	.LC241
+	.long	3
+	.string	"\027\026\017"
+	.quad	.LC242
+	.long	4
+	.ascii	"\025\026\026\026"
+	.quad	.LC243
+	.long	2
+	.string	"eM"
+	.zero	1
+	.quad	.LC244
+	.long	2
+	.string	"e\016"
+	.zero	1
+	.quad	.LC245
+	.long	2
+	.string	"M\016"
+	.zero	1
+	.quad	.LC246
+	.long	2
+	.string	"M\017"
+	.zero	1
+	.quad	.LC247
+	.long	2
+	.string	"\007\016"
+	.zero	1
+	.quad	.LC248
+	.long	2
+	.string	"\007\017"
+	.zero	1
+	.quad	.LC249
+	.long	2
+	.string	"\032\016"
+	.zero	1
+	.quad	.LC250
+	.long	3
+	.string	"eM\016"
+	.quad	.LC251
+	.long	2
+	.string	"\005\004"
+	.zero	1
+	.quad	.LC252
+	.long	3
+	.string	"\005\004\004"
+	.quad	.LC253
+	.long	4
+	.ascii	"\005\004\004\004"
+	.quad	.LC254
+	.long	2
+	.string	"<\006"
+	.zero	1
+	.quad	.LC255
+	.long	2
+	.string	"<\007"
+	.zero	1
+	.quad	.LC256
+	.long	2
+	.string	"FF"
+	.zero	1
+	.quad	.LC257
+	.long	2
+	.string	"EE"
+	.zero	1
+	.quad	.LC258
+	.long	2
+	.string	"2c"
+	.zero	1
+	.quad	.LC259
+	.long	2
+	.string	"6_"
+	.zero	1
+	.quad	.LC260
+	.long	2
+	.string	"4c"
+	.zero	1
+	.quad	.LC261
+	.long	2
+	.string	"6a"
+	.zero	1
+	.quad	.LC262
+	.long	2
+	.string	"9_"
+	.zero	1
+	.quad	.LC263
+	.long	2
+	.string	" _"
+	.zero	1
+	.quad	.LC264
+	.long	4
+	.ascii	"9_\027\026"
+	.quad	.LC265
+	.long	4
+	.ascii	" _\027\026"
+	.quad	.LC266
+	.long	4
+	.ascii	"_\027\026\016"
+	.quad	.LC267
+	.globl	invalid_opcode
+	.section	.rodata
+	.align 4
+	.type	invalid_opcode, @object
+	.size	invalid_opcode, 4
+invalid_opcode:
+	.long	65535
+	.globl	io_base
+	.align 4
+	.type	io_base, @object
+	.size	io_base, 4
+io_base:
+	.long	32
+	.globl	is_avrtest_log
+	.type	is_avrtest_log, @object
+	.size	is_avrtest_log, 1
+is_avrtest_log:
+	.zero	1
+	.globl	is_tiny
+	.type	is_tiny, @object
+	.size	is_tiny, 1
+is_tiny:
+	.zero	1
+	.globl	is_xmega
+	.type	is_xmega, @object
+	.size	is_xmega, 1
+is_xmega:
+	.zero	1
+	.align 32
+	.type	flag_update_table_logical, @object
+	.size	flag_update_table_logical, 256
+flag_update_table_logical:
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.ascii	"\024\024\024\024\024\024\024\024\024\024\024\024\024\024\024"
+	.ascii	"\024\024\024\024\024\024\024\024\024\024\024\024\024\024\024"
+	.ascii	"\024\024\024\024\024\024\024\024\024\024\024\024\024\024\024"
+	.ascii	"\024\024\024\024\024\024\024\024\024\024\024\024\024\024\024"
+	.ascii	"\024\024\024\024\024\024\024\024\024\024\024\024\024\024\024"
+	.ascii	"\024\024\024\024\024\024\024\024\024\024\024\024\024\024\024"
+	.ascii	"\024\024\024\024\024\024\024\024\024\024\024\024\024\024\024"
+	.ascii	"\024\024\024\024\024\024\024\024\024\024\024\024\024\024\024"
+	.ascii	"\024\024\024\024\024\024\024\024"
+	.section	.rodata.cst8,"aM",@progbits,8
+	.align 8
+.LC11:
+	.long	0
+	.long	1079574528
+	.align 8
+.LC19:
+	.long	0
+	.long	1083129856
+	.align 8
+.LC20:
+	.long	-755914244
+	.long	1062232653
+	.align 8
+.LC21:
+	.long	1202590843
+	.long	1065646817
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
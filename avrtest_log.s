@@ -0,0 +1,14729 @@
+	.file	"avrtest.c"
+	.text
+	.p2align 4
+	.type	host_getchar, @function
+host_getchar:
+.LFB198:
+	.cfi_startproc
+	movq	896(%rdi), %rdi	# 6	[c=9 l=7]  *movdi_internal/3
+	jmp	getc@PLT	# 8	[c=10 l=5]  *sibcall_value
+	.cfi_endproc
+.LFE198:
+	.size	host_getchar, .-host_getchar
+	.p2align 4
+	.type	flash_changed, @function
+flash_changed:
+.LFB80:
+	.cfi_startproc
+	pushq	%rbp	# 64	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rdi, %rbp	# 2	[c=4 l=3]  *movdi_internal/3
+	pushq	%rbx	# 65	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	movl	%edx, %ebx	# 4	[c=4 l=2]  *movsi_internal/0
+	subq	$8, %rsp	# 66	[c=4 l=4]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_def_cfa_offset 32
+	call	redecode_flash@PLT	# 11	[c=10 l=5]  *call_value
+	movl	$510, %edx	# 56	[c=4 l=5]  *movsi_internal/0
+	movl	992(%rbp), %ecx	# 62	[c=9 l=6]  *movsi_internal/0
+	cmpl	%edx, %eax	# 57	[c=4 l=2]  *cmpsi_1/0
+	cmovb	%edx, %eax	# 58	[c=8 l=3]  *movsicc_noc/1
+	shrl	%ebx	# 17	[c=4 l=2]  *lshrsi3_1/0
+	leal	1(%rcx), %edx	# 63	[c=4 l=3]  *leasi
+	movl	120(%rbp), %ecx	# 20	[c=9 l=3]  *movsi_internal/0
+	addl	$2, %ebx	# 18	[c=4 l=3]  *addsi_1/0
+	subl	$510, %eax	# 14	[c=4 l=5]  *addsi_1/0
+	cmpl	%ebx, %edx	# 59	[c=4 l=2]  *cmpsi_1/0
+	cmova	%ebx, %edx	# 60	[c=8 l=3]  *movsicc_noc/1
+	testl	%ecx, %ecx	# 21	[c=4 l=2]  *cmpsi_ccno_1/0
+	je	.L4	# 22	[c=13 l=2]  *jcc
+	movl	116(%rbp), %esi	# 51	[c=9 l=3]  *movsi_internal/0
+	cmpl	%esi, %eax	# 52	[c=4 l=2]  *cmpsi_1/0
+	cmova	%esi, %eax	# 53	[c=8 l=3]  *movsicc_noc/1
+	cmpl	%ecx, %edx	# 54	[c=4 l=2]  *cmpsi_1/0
+	cmovb	%ecx, %edx	# 55	[c=8 l=3]  *movsicc_noc/1
+.L4:
+	movl	%eax, 116(%rbp)	# 29	[c=4 l=3]  *movsi_internal/1
+	movl	584(%rbp), %eax	# 80	[c=9 l=6]  *movsi_internal/0
+	movl	%edx, 120(%rbp)	# 28	[c=4 l=3]  *movsi_internal/1
+	testl	%eax, %eax	# 81	[c=4 l=2]  *cmpsi_ccno_1/0
+	jne	.L10	# 31	[c=13 l=2]  *jcc
+	addq	$8, %rsp	# 69	[c=4 l=4]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbx	# 70	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 16
+	popq	%rbp	# 71	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 8
+	ret		# 72	[c=0 l=1]  simple_return_internal
+	.p2align 4,,10
+	.p2align 3
+.L10:
+	.cfi_restore_state
+	addq	$8, %rsp	# 76	[c=4 l=4]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_def_cfa_offset 24
+	movq	%rbp, %rdi	# 33	[c=4 l=3]  *movdi_internal/3
+	popq	%rbx	# 77	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 16
+	popq	%rbp	# 78	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 8
+	jmp	hle_forget@PLT	# 34	[c=0 l=5]  *sibcall
+	.cfi_endproc
+.LFE80:
+	.size	flash_changed, .-flash_changed
+	.p2align 4
+	.globl	qprintf
+	.type	qprintf, @function
+qprintf:
+.LFB15:
+	.cfi_startproc
+	subq	$216, %rsp	# 50	[c=4 l=7]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_def_cfa_offset 224
+	movq	%rdx, 48(%rsp)	# 4	[c=4 l=5]  *movdi_internal/5
+	movq	%rcx, 56(%rsp)	# 5	[c=4 l=5]  *movdi_internal/5
+	movq	%r8, 64(%rsp)	# 6	[c=4 l=5]  *movdi_internal/5
+	movq	%r9, 72(%rsp)	# 7	[c=4 l=5]  *movdi_internal/5
+	testb	%al, %al	# 8	[c=4 l=2]  *cmpqi_ccno_1/0
+	je	.L14	# 9	[c=13 l=2]  *jcc
+	movaps	%xmm0, 80(%rsp)	# 10	[c=4 l=5]  movv4sf_internal/3
+	movaps	%xmm1, 96(%rsp)	# 11	[c=4 l=5]  movv4sf_internal/3
+	movaps	%xmm2, 112(%rsp)	# 12	[c=4 l=5]  movv4sf_internal/3
+	movaps	%xmm3, 128(%rsp)	# 13	[c=4 l=8]  movv4sf_internal/3
+	movaps	%xmm4, 144(%rsp)	# 14	[c=4 l=8]  movv4sf_internal/3
+	movaps	%xmm5, 160(%rsp)	# 15	[c=4 l=8]  movv4sf_internal/3
+	movaps	%xmm6, 176(%rsp)	# 16	[c=4 l=8]  movv4sf_internal/3
+	movaps	%xmm7, 192(%rsp)	# 17	[c=4 l=8]  movv4sf_internal/3
+.L14:
+	movl	216(%rdi), %eax	# 58	[c=9 l=6]  *movsi_internal/0
+	testl	%eax, %eax	# 59	[c=4 l=2]  *cmpsi_ccno_1/0
+	je	.L16	# 23	[c=13 l=2]  *jcc
+	addq	$216, %rsp	# 53	[c=4 l=7]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_remember_state
+	.cfi_def_cfa_offset 8
+	ret		# 54	[c=0 l=1]  simple_return_internal
+	.p2align 4,,10
+	.p2align 3
+.L16:
+	.cfi_restore_state
+	leaq	224(%rsp), %rax	# 47	[c=4 l=8]  *leadi
+	movq	904(%rdi), %rdi	# 31	[c=9 l=7]  *movdi_internal/3
+	leaq	8(%rsp), %rdx	# 49	[c=4 l=5]  *leadi
+	movl	$16, 8(%rsp)	# 26	[c=4 l=8]  *movsi_internal/1
+	movq	%rax, 16(%rsp)	# 28	[c=4 l=5]  *movdi_internal/5
+	leaq	32(%rsp), %rax	# 48	[c=4 l=5]  *leadi
+	movl	$48, 12(%rsp)	# 27	[c=4 l=8]  *movsi_internal/1
+	movq	%rax, 24(%rsp)	# 29	[c=4 l=5]  *movdi_internal/5
+	call	vfprintf@PLT	# 35	[c=10 l=5]  *call_value
+	addq	$216, %rsp	# 62	[c=4 l=7]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_def_cfa_offset 8
+	ret		# 63	[c=0 l=1]  simple_return_internal
+	.cfi_endproc
+.LFE15:
+	.size	qprintf, .-qprintf
+	.p2align 4
+	.globl	quit
+	.type	quit, @function
+quit:
+.LFB19:
+	.cfi_startproc
+	subq	$8, %rsp	# 18	[c=4 l=4]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_def_cfa_offset 16
+	movl	%esi, 136(%rdi)	# 7	[c=4 l=6]  *movsi_internal/1
+	movl	$1, %esi	# 9	[c=4 l=5]  *movsi_internal/0
+	movq	128(%rdi), %rdi	# 8	[c=9 l=7]  *movdi_internal/3
+	call	longjmp@PLT	# 11	[c=0 l=5]  *call
+	.cfi_endproc
+.LFE19:
+	.size	quit, .-quit
+	.section	.rodata.str1.1,"aMS",@progbits,1
+.LC0:
+	.string	"ABORTED"
+.LC1:
+	.string	"w"
+.LC2:
+	.string	"%s: cannot write -status=%s\n"
+.LC3:
+	.string	"%d %lu %lu %s\n"
+	.text
+	.p2align 4
+	.type	finish, @function
+finish:
+.LFB20:
+	.cfi_startproc
+	pushq	%r12	# 117	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	pushq	%rbp	# 118	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	movl	%esi, %ebp	# 3	[c=4 l=2]  *movsi_internal/0
+	pushq	%rbx	# 119	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	movl	440(%rdi), %esi	# 132	[c=9 l=6]  *movsi_internal/0
+	movq	%rdi, %rbx	# 2	[c=4 l=3]  *movdi_internal/3
+	testl	%esi, %esi	# 133	[c=4 l=2]  *cmpsi_ccno_1/0
+	jne	.L31	# 10	[c=13 l=2]  *jcc
+.L20:
+	movq	11016(%rbx), %rax	# 62	[c=9 l=7]  *movdi_internal/3
+	testq	%rax, %rax	# 63	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L23	# 64	[c=13 l=2]  *jcc
+	movdqu	40(%rbx), %xmm0	# 114	[c=13 l=5]  movv2di_internal/2
+	movl	76(%rbx), %ecx	# 128	[c=9 l=3]  *movsi_internal/0
+	movl	%ebp, (%rax)	# 66	[c=4 l=2]  *movsi_internal/1
+	leaq	.LC0(%rip), %rdx	# 6	[c=1 l=7]  *movdi_internal/4
+	shufpd	$1, %xmm0, %xmm0	# 70	[c=4 l=5]  sse2_shufpd_v2di/0
+	movups	%xmm0, 8(%rax)	# 71	[c=4 l=4]  movv2di_internal/3
+	testl	%ecx, %ecx	# 129	[c=4 l=2]  *cmpsi_ccno_1/0
+	je	.L32	# 73	[c=13 l=2]  *jcc
+.L24:
+	movq	%rdx, 24(%rax)	# 83	[c=4 l=4]  *movdi_internal/5
+.L23:
+	movl	%ebp, %esi	# 86	[c=4 l=2]  *movsi_internal/0
+	movq	%rbx, %rdi	# 87	[c=4 l=3]  *movdi_internal/3
+	call	quit	# 88	[c=0 l=5]  *call
+.L32:
+	movslq	72(%rbx), %rdx	# 77	[c=13 l=4]  *extendsidi2_rex64/1
+	leaq	exit_status(%rip), %rcx	# 112	[c=1 l=7]  *movdi_internal/4
+	imulq	$24, %rdx, %rdx	# 78	[c=16 l=4]  *muldi3_1/0
+	movq	(%rcx,%rdx), %rdx	# 80	[c=9 l=4]  *movdi_internal/3
+	jmp	.L24	# 136	[c=1 l=2]  jump
+.L31:
+	movq	448(%rdi), %rdi	# 12	[c=9 l=7]  *movdi_internal/3
+	leaq	.LC1(%rip), %rsi	# 13	[c=1 l=7]  *movdi_internal/4
+	call	fopen@PLT	# 16	[c=10 l=5]  *call_value
+	movq	%rax, %r12	# 17	[c=4 l=3]  *movdi_internal/3
+	testq	%rax, %rax	# 19	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L33	# 20	[c=13 l=2]  *jcc
+	cmpl	$0, 76(%rbx)	# 36	[c=13 l=4]  *cmpsi_ccno_1/1
+	leaq	.LC0(%rip), %r9	# 5	[c=1 l=7]  *movdi_internal/4
+	je	.L34	# 37	[c=13 l=2]  *jcc
+.L22:
+	movq	48(%rbx), %rcx	# 48	[c=9 l=4]  *movdi_internal/3
+	movq	40(%rbx), %r8	# 50	[c=9 l=4]  *movdi_internal/3
+	movq	%r12, %rdi	# 55	[c=4 l=3]  *movdi_internal/3
+	movl	%ebp, %edx	# 52	[c=4 l=2]  *movsi_internal/0
+	leaq	.LC3(%rip), %rsi	# 53	[c=1 l=7]  *movdi_internal/4
+	xorl	%eax, %eax	# 130	[c=4 l=2]  *movdi_xor
+	call	fprintf@PLT	# 57	[c=10 l=5]  *call_value
+	movq	%r12, %rdi	# 58	[c=4 l=3]  *movdi_internal/3
+	call	fclose@PLT	# 59	[c=10 l=5]  *call_value
+	jmp	.L20	# 140	[c=1 l=5]  jump
+.L34:
+	movslq	72(%rbx), %rax	# 41	[c=13 l=4]  *extendsidi2_rex64/1
+	leaq	exit_status(%rip), %rdx	# 111	[c=1 l=7]  *movdi_internal/4
+	imulq	$24, %rax, %rax	# 42	[c=16 l=4]  *muldi3_1/0
+	movq	(%rdx,%rax), %r9	# 44	[c=9 l=4]  *movdi_internal/3
+	jmp	.L22	# 142	[c=1 l=2]  jump
+.L33:
+	movq	448(%rbx), %rcx	# 22	[c=9 l=7]  *movdi_internal/3
+	movq	144(%rbx), %rdx	# 23	[c=9 l=7]  *movdi_internal/3
+	leaq	.LC2(%rip), %rsi	# 27	[c=1 l=7]  *movdi_internal/4
+	xorl	%eax, %eax	# 131	[c=4 l=2]  *movdi_xor
+	movq	912(%rbx), %rdi	# 24	[c=9 l=7]  *movdi_internal/3
+	call	fprintf@PLT	# 31	[c=10 l=5]  *call_value
+	jmp	.L20	# 144	[c=1 l=5]  jump
+	.cfi_endproc
+.LFE20:
+	.size	finish, .-finish
+	.section	.rodata.str1.1
+.LC5:
+	.string	"-not set-"
+.LC6:
+	.string	"\n"
+	.section	.rodata.str1.8,"aMS",@progbits,1
+	.align 8
+.LC11:
+	.string	"        load: %lu:%02lu.%06lu  = %3lu.%03lu sec  = %6.2f%%,  %10.3f        bytes/ms, 0x%05x = %u bytes\n"
+	.align 8
+.LC12:
+	.string	"      decode: %lu:%02lu.%06lu  = %3lu.%03lu sec  = %6.2f%%,  %10.3f        bytes/ms, 0x%05x = %u bytes\n"
+	.align 8
+.LC13:
+	.string	"     execute: %lu:%02lu.%06lu  = %3lu.%03lu sec  = %6.2f%%,  %10.3f instructions/ms\n"
+	.align 8
+.LC14:
+	.string	" avrtest run: %lu:%02lu.%06lu  = %3lu.%03lu sec  = %6.2f%%,  %10.3f instructions/ms\n"
+	.align 8
+.LC15:
+	.string	" exit status: %s\n      reason: "
+	.section	.rodata.str1.1
+.LC16:
+	.string	"\n     program: %s\n"
+.LC17:
+	.string	" entry point: %06x\n"
+	.section	.rodata.str1.8
+	.align 8
+.LC18:
+	.string	"exit address: %06x\ntotal cycles: %lu\n"
+	.section	.rodata.str1.1
+.LC19:
+	.string	"      asleep: %lu\n"
+.LC20:
+	.string	"total instr.: %lu\n\n"
+.LC21:
+	.string	"\n%s: %s error: "
+	.text
+	.p2align 4
+	.globl	leave
+	.type	leave, @function
+leave:
+.LFB21:
+	.cfi_startproc
+	pushq	%rbp	# 1208	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movq	%rsp, %rbp	# 1209	[c=4 l=3]  *movdi_internal/3
+	.cfi_def_cfa_register 6
+	pushq	%r15	# 1210	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_offset 15, -24
+	movq	%rdi, %r15	# 2	[c=4 l=3]  *movdi_internal/3
+	pushq	%r14	# 1211	[c=4 l=2]  *pushdi2_rex64/0
+	pushq	%r13	# 1212	[c=4 l=2]  *pushdi2_rex64/0
+	pushq	%r12	# 1213	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_offset 14, -32
+	.cfi_offset 13, -40
+	.cfi_offset 12, -48
+	movq	%rdx, %r12	# 4	[c=4 l=3]  *movdi_internal/3
+	pushq	%rbx	# 1214	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_offset 3, -56
+	movl	%esi, %ebx	# 3	[c=4 l=2]  *movsi_internal/0
+	subq	$328, %rsp	# 1215	[c=4 l=7]  pro_epilogue_adjust_stack_add_di/0
+	movq	%rcx, -200(%rbp)	# 5	[c=4 l=7]  *movdi_internal/5
+	movq	%r8, -192(%rbp)	# 6	[c=4 l=7]  *movdi_internal/5
+	movq	%r9, -184(%rbp)	# 7	[c=4 l=7]  *movdi_internal/5
+	testb	%al, %al	# 8	[c=4 l=2]  *cmpqi_ccno_1/0
+	je	.L103	# 9	[c=13 l=2]  *jcc
+	movaps	%xmm0, -176(%rbp)	# 10	[c=4 l=7]  movv4sf_internal/3
+	movaps	%xmm1, -160(%rbp)	# 11	[c=4 l=7]  movv4sf_internal/3
+	movaps	%xmm2, -144(%rbp)	# 12	[c=4 l=7]  movv4sf_internal/3
+	movaps	%xmm3, -128(%rbp)	# 13	[c=4 l=4]  movv4sf_internal/3
+	movaps	%xmm4, -112(%rbp)	# 14	[c=4 l=4]  movv4sf_internal/3
+	movaps	%xmm5, -96(%rbp)	# 15	[c=4 l=4]  movv4sf_internal/3
+	movaps	%xmm6, -80(%rbp)	# 16	[c=4 l=4]  movv4sf_internal/3
+	movaps	%xmm7, -64(%rbp)	# 17	[c=4 l=4]  movv4sf_internal/3
+.L103:
+	movl	96(%r15), %edx	# 31	[c=9 l=4]  *movsi_internal/0
+	movl	%ebx, 72(%r15)	# 30	[c=4 l=4]  *movsi_internal/1
+	testl	%edx, %edx	# 32	[c=4 l=2]  *cmpsi_ccno_1/0
+	je	.L38	# 33	[c=13 l=2]  *jcc
+	movq	40(%r15), %rax	# 994	[c=9 l=4]  *movdi_internal/3
+	subq	$1, %rax	# 40	[c=4 l=4]  *adddi_1/0
+	subl	$1, %edx	# 1276	[c=4 l=3]  *addsi_4
+	movq	%rax, 40(%r15)	# 41	[c=4 l=4]  *movdi_internal/5
+	je	.L124	# 44	[c=13 l=6]  *jcc
+.L38:
+	movq	%r15, %rdi	# 57	[c=4 l=3]  *movdi_internal/3
+	leaq	exit_status(%rip), %r14	# 61	[c=1 l=7]  *movdi_internal/4
+	call	periph_finish@PLT	# 58	[c=0 l=5]  *call
+	movq	%r15, %rdi	# 59	[c=4 l=3]  *movdi_internal/3
+	call	replay_finish@PLT	# 60	[c=0 l=5]  *call
+	movslq	%ebx, %rax	# 62	[c=4 l=3]  *extendsidi2_rex64/1
+	movq	%rax, -264(%rbp)	# 1121	[c=4 l=7]  *movdi_internal/5
+	leaq	(%rax,%rax,2), %rax	# 65	[c=8 l=4]  *leadi
+	movl	16(%r14,%rax,8), %r13d	# 70	[c=10 l=5]  *movsi_internal/0
+	testl	%r13d, %r13d	# 71	[c=4 l=3]  *cmpsi_ccno_1/0
+	je	.L40	# 72	[c=13 l=6]  *jcc
+	xorl	%eax, %eax	# 1273	[c=4 l=2]  *movdi_xor
+	leaq	.LC6(%rip), %rsi	# 74	[c=1 l=7]  *movdi_internal/4
+	movq	%r15, %rdi	# 76	[c=4 l=3]  *movdi_internal/3
+	call	qprintf	# 78	[c=0 l=5]  *call
+	movl	216(%r15), %r11d	# 1274	[c=9 l=7]  *movsi_internal/0
+	leaq	-256(%rbp), %rax	# 875	[c=4 l=7]  *leadi
+	movq	%rax, -272(%rbp)	# 997	[c=4 l=7]  *movdi_internal/5
+	testl	%r11d, %r11d	# 1275	[c=4 l=3]  *cmpsi_ccno_1/0
+	jne	.L125	# 80	[c=13 l=6]  *jcc
+.L41:
+	leaq	16(%rbp), %rax	# 1108	[c=4 l=4]  *leadi
+	cmpl	$0, 76(%r15)	# 606	[c=13 l=5]  *cmpsi_ccno_1/1
+	movl	$24, -256(%rbp)	# 602	[c=4 l=10]  *movsi_internal/1
+	leaq	.LC0(%rip), %rdx	# 26	[c=1 l=7]  *movdi_internal/4
+	movq	%rax, -248(%rbp)	# 604	[c=4 l=7]  *movdi_internal/5
+	leaq	-224(%rbp), %rax	# 1109	[c=4 l=7]  *leadi
+	movl	$48, -252(%rbp)	# 603	[c=4 l=10]  *movsi_internal/1
+	movq	%rax, -240(%rbp)	# 605	[c=4 l=7]  *movdi_internal/5
+	je	.L126	# 607	[c=13 l=6]  *jcc
+.L90:
+	movq	904(%r15), %rdi	# 616	[c=9 l=7]  *movdi_internal/3
+	leaq	.LC15(%rip), %rsi	# 618	[c=1 l=7]  *movdi_internal/4
+	xorl	%eax, %eax	# 1237	[c=4 l=2]  *movdi_xor
+	call	fprintf@PLT	# 622	[c=10 l=5]  *call_value
+	movq	-272(%rbp), %rdx	# 625	[c=9 l=7]  *movdi_internal/3
+	movq	904(%r15), %rdi	# 624	[c=9 l=7]  *movdi_internal/3
+	movq	%r12, %rsi	# 626	[c=4 l=3]  *movdi_internal/3
+	call	vfprintf@PLT	# 628	[c=10 l=5]  *call_value
+	movq	80(%r15), %rdx	# 629	[c=9 l=4]  *movdi_internal/3
+	testq	%rdx, %rdx	# 630	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L127	# 631	[c=13 l=6]  *jcc
+.L91:
+	movq	904(%r15), %rdi	# 635	[c=9 l=7]  *movdi_internal/3
+	xorl	%eax, %eax	# 1236	[c=4 l=2]  *movdi_xor
+	leaq	.LC16(%rip), %rsi	# 637	[c=1 l=7]  *movdi_internal/4
+	call	fprintf@PLT	# 641	[c=10 l=5]  *call_value
+	testl	%r13d, %r13d	# 642	[c=4 l=3]  *cmpsi_ccno_1/0
+	jne	.L92	# 643	[c=13 l=2]  *jcc
+	movl	8(%r15), %edx	# 645	[c=9 l=4]  *movsi_internal/0
+	testl	%edx, %edx	# 646	[c=4 l=2]  *cmpsi_ccno_1/0
+	jne	.L128	# 647	[c=13 l=6]  *jcc
+.L93:
+	movl	(%r15), %eax	# 1113	[c=5 l=3]  *movsi_internal/0
+	movq	48(%r15), %rcx	# 658	[c=9 l=4]  *movdi_internal/3
+	leaq	.LC18(%rip), %rsi	# 664	[c=1 l=7]  *movdi_internal/4
+	movq	904(%r15), %rdi	# 661	[c=9 l=7]  *movdi_internal/3
+	leal	(%rax,%rax), %edx	# 1180	[c=12 l=3]  *leasi
+	xorl	%eax, %eax	# 1234	[c=4 l=2]  *movdi_xor
+	call	fprintf@PLT	# 668	[c=10 l=5]  *call_value
+	movq	64(%r15), %rdx	# 669	[c=9 l=4]  *movdi_internal/3
+	testq	%rdx, %rdx	# 670	[c=4 l=3]  *cmpdi_ccno_1/0
+	jne	.L129	# 671	[c=13 l=6]  *jcc
+.L94:
+	movq	40(%r15), %rdx	# 682	[c=9 l=4]  *movdi_internal/3
+	movq	904(%r15), %rdi	# 683	[c=9 l=7]  *movdi_internal/3
+	leaq	.LC20(%rip), %rsi	# 685	[c=1 l=7]  *movdi_internal/4
+	xorl	%eax, %eax	# 1232	[c=4 l=2]  *movdi_xor
+	call	fprintf@PLT	# 689	[c=10 l=5]  *call_value
+.L92:
+	movq	904(%r15), %rdi	# 692	[c=9 l=7]  *movdi_internal/3
+	call	fflush@PLT	# 694	[c=10 l=5]  *call_value
+	movl	%r13d, %esi	# 695	[c=4 l=3]  *movsi_internal/0
+	movq	%r15, %rdi	# 696	[c=4 l=3]  *movdi_internal/3
+	call	finish	# 697	[c=0 l=5]  *call
+.L126:
+	imulq	$24, -264(%rbp), %rax	# 611	[c=25 l=8]  *muldi3_1/0
+	movq	(%r14,%rax), %rdx	# 613	[c=9 l=4]  *movdi_internal/3
+	jmp	.L90	# 1283	[c=1 l=5]  jump
+.L40:
+	xorl	%esi, %esi	# 1271	[c=4 l=2]  *movdi_xor
+	movq	%r15, %rdi	# 87	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 88	[c=0 l=5]  *call
+	xorl	%eax, %eax	# 1272	[c=4 l=2]  *movdi_xor
+	leaq	.LC6(%rip), %rsi	# 89	[c=1 l=7]  *movdi_internal/4
+	movq	%r15, %rdi	# 91	[c=4 l=3]  *movdi_internal/3
+	call	qprintf	# 93	[c=0 l=5]  *call
+	cmpl	$0, 232(%r15)	# 94	[c=13 l=8]  *cmpsi_ccno_1/1
+	je	.L43	# 95	[c=13 l=6]  *jcc
+	leaq	-256(%rbp), %rax	# 1207	[c=4 l=7]  *leadi
+	xorl	%esi, %esi	# 1270	[c=4 l=2]  *movdi_xor
+	movq	%rax, %rdi	# 99	[c=4 l=3]  *movdi_internal/3
+	movq	%rax, -272(%rbp)	# 1124	[c=4 l=7]  *movdi_internal/5
+	call	gettimeofday@PLT	# 100	[c=10 l=5]  *call_value
+	movq	-248(%rbp), %rax	# 103	[c=9 l=7]  *movdi_internal/3
+	movq	-256(%rbp), %rsi	# 101	[c=9 l=7]  *movdi_internal/3
+	movq	928(%r15), %rdx	# 102	[c=9 l=7]  *movdi_internal/3
+	movq	%rax, %rdi	# 1001	[c=4 l=3]  *movdi_internal/3
+	movq	%rsi, %rcx	# 999	[c=4 l=3]  *movdi_internal/3
+	subq	920(%r15), %rcx	# 104	[c=13 l=7]  *subdi_1/1
+	subq	%rdx, %rdi	# 105	[c=4 l=3]  *subdi_1/0
+	movq	%rcx, -280(%rbp)	# 1123	[c=4 l=7]  *movdi_internal/5
+	movq	%rdi, -288(%rbp)	# 1122	[c=4 l=7]  *movdi_internal/5
+	cmpq	%rdx, %rax	# 106	[c=4 l=3]  *cmpdi_1/0
+	jnb	.L44	# 107	[c=13 l=2]  *jcc
+	subq	$1, %rcx	# 109	[c=4 l=4]  *adddi_1/0
+	addq	$1000000, %rdi	# 110	[c=4 l=7]  *adddi_1/0
+	movq	%rcx, -280(%rbp)	# 1004	[c=4 l=7]  *movdi_internal/5
+	movq	%rdi, -288(%rbp)	# 1006	[c=4 l=7]  *movdi_internal/5
+.L44:
+	movq	-280(%rbp), %rcx	# 1125	[c=9 l=7]  *movdi_internal/3
+	testq	%rcx, %rcx	# 115	[c=4 l=3]  *cmpdi_ccno_1/0
+	js	.L45	# 116	[c=13 l=6]  *jcc
+	pxor	%xmm2, %xmm2	# 1375	[c=4 l=4]  movv2df_internal/0
+	cvtsi2sdq	%rcx, %xmm2	# 1376	[c=4 l=5]  sse2_cvtsi2sdq/0
+.L46:
+	movsd	.LC7(%rip), %xmm5	# 127	[c=6 l=8]  *movdf_internal/14
+	movq	-288(%rbp), %rcx	# 1127	[c=9 l=7]  *movdi_internal/3
+	mulsd	%xmm5, %xmm2	# 128	[c=20 l=4]  *fop_df_comm/1
+	testq	%rcx, %rcx	# 131	[c=4 l=3]  *cmpdi_ccno_1/0
+	js	.L47	# 132	[c=13 l=6]  *jcc
+	pxor	%xmm0, %xmm0	# 1373	[c=4 l=4]  movv2df_internal/0
+	cvtsi2sdq	%rcx, %xmm0	# 1374	[c=4 l=5]  sse2_cvtsi2sdq/0
+.L48:
+	movsd	.LC8(%rip), %xmm4	# 143	[c=6 l=8]  *movdf_internal/14
+	movq	968(%r15), %rcx	# 146	[c=9 l=7]  *movdi_internal/3
+	movq	%rax, %rdi	# 1019	[c=4 l=3]  *movdi_internal/3
+	movq	976(%r15), %rdx	# 147	[c=9 l=7]  *movdi_internal/3
+	mulsd	%xmm4, %xmm0	# 144	[c=20 l=4]  *fop_df_comm/1
+	subq	%rcx, %rsi	# 148	[c=4 l=3]  *subdi_1/0
+	subq	%rdx, %rdi	# 149	[c=4 l=3]  *subdi_1/0
+	movq	%rsi, -296(%rbp)	# 1130	[c=4 l=7]  *movdi_internal/5
+	movq	%rdi, -304(%rbp)	# 1129	[c=4 l=7]  *movdi_internal/5
+	addsd	%xmm0, %xmm2	# 145	[c=12 l=4]  *fop_df_comm/1
+	cmpq	%rdx, %rax	# 150	[c=4 l=3]  *cmpdi_1/0
+	jnb	.L49	# 151	[c=13 l=2]  *jcc
+	subq	$1, %rsi	# 153	[c=4 l=4]  *adddi_1/0
+	addq	$1000000, %rdi	# 154	[c=4 l=7]  *adddi_1/0
+	movq	%rsi, -296(%rbp)	# 1022	[c=4 l=7]  *movdi_internal/5
+	movq	%rdi, -304(%rbp)	# 1024	[c=4 l=7]  *movdi_internal/5
+.L49:
+	movq	-296(%rbp), %rax	# 1131	[c=9 l=7]  *movdi_internal/3
+	testq	%rax, %rax	# 159	[c=4 l=3]  *cmpdi_ccno_1/0
+	js	.L50	# 160	[c=13 l=6]  *jcc
+	pxor	%xmm1, %xmm1	# 1371	[c=4 l=4]  movv2df_internal/0
+	cvtsi2sdq	%rax, %xmm1	# 1372	[c=4 l=5]  sse2_cvtsi2sdq/0
+.L51:
+	movq	-304(%rbp), %rax	# 1133	[c=9 l=7]  *movdi_internal/3
+	mulsd	%xmm5, %xmm1	# 172	[c=20 l=4]  *fop_df_comm/1
+	testq	%rax, %rax	# 175	[c=4 l=3]  *cmpdi_ccno_1/0
+	js	.L52	# 176	[c=13 l=6]  *jcc
+	pxor	%xmm0, %xmm0	# 1369	[c=4 l=4]  movv2df_internal/0
+	cvtsi2sdq	%rax, %xmm0	# 1370	[c=4 l=5]  sse2_cvtsi2sdq/0
+.L53:
+	mulsd	%xmm4, %xmm0	# 188	[c=20 l=4]  *fop_df_comm/1
+	movq	952(%r15), %r9	# 190	[c=9 l=7]  *movdi_internal/3
+	movq	960(%r15), %rax	# 191	[c=9 l=7]  *movdi_internal/3
+	movq	%rdx, %r10	# 1039	[c=4 l=3]  *movdi_internal/3
+	subq	%r9, %rcx	# 192	[c=4 l=3]  *subdi_1/0
+	subq	%rax, %r10	# 193	[c=4 l=3]  *subdi_1/0
+	movq	%rcx, %r11	# 1038	[c=4 l=3]  *movdi_internal/3
+	addsd	%xmm0, %xmm1	# 189	[c=12 l=4]  *fop_df_comm/1
+	movsd	%xmm1, -312(%rbp)	# 1036	[c=4 l=8]  *movdf_internal/15
+	cmpq	%rax, %rdx	# 194	[c=4 l=3]  *cmpdi_1/0
+	jnb	.L54	# 195	[c=13 l=2]  *jcc
+	subq	$1, %r11	# 197	[c=4 l=4]  *adddi_1/0
+	addq	$1000000, %r10	# 198	[c=4 l=7]  *adddi_1/0
+.L54:
+	testq	%r11, %r11	# 203	[c=4 l=3]  *cmpdi_ccno_1/0
+	js	.L55	# 204	[c=13 l=6]  *jcc
+	pxor	%xmm3, %xmm3	# 1367	[c=4 l=4]  movv2df_internal/0
+	cvtsi2sdq	%r11, %xmm3	# 1368	[c=4 l=5]  sse2_cvtsi2sdq/0
+.L56:
+	mulsd	%xmm5, %xmm3	# 216	[c=20 l=4]  *fop_df_comm/1
+	testq	%r10, %r10	# 219	[c=4 l=3]  *cmpdi_ccno_1/0
+	js	.L57	# 220	[c=13 l=6]  *jcc
+	pxor	%xmm1, %xmm1	# 1365	[c=4 l=4]  movv2df_internal/0
+	cvtsi2sdq	%r10, %xmm1	# 1366	[c=4 l=5]  sse2_cvtsi2sdq/0
+.L58:
+	mulsd	%xmm4, %xmm1	# 232	[c=20 l=4]  *fop_df_comm/1
+	movq	944(%r15), %rdx	# 234	[c=9 l=7]  *movdi_internal/3
+	movq	%rax, %r8	# 1049	[c=4 l=3]  *movdi_internal/3
+	subq	936(%r15), %r9	# 235	[c=13 l=7]  *subdi_1/1
+	subq	%rdx, %r8	# 236	[c=4 l=3]  *subdi_1/0
+	addsd	%xmm1, %xmm3	# 233	[c=12 l=4]  *fop_df_comm/1
+	cmpq	%rdx, %rax	# 237	[c=4 l=3]  *cmpdi_1/0
+	jnb	.L59	# 238	[c=13 l=2]  *jcc
+	subq	$1, %r9	# 240	[c=4 l=4]  *adddi_1/0
+	addq	$1000000, %r8	# 241	[c=4 l=7]  *adddi_1/0
+.L59:
+	testq	%r9, %r9	# 246	[c=4 l=3]  *cmpdi_ccno_1/0
+	js	.L60	# 247	[c=13 l=6]  *jcc
+	pxor	%xmm0, %xmm0	# 1363	[c=4 l=4]  movv2df_internal/0
+	cvtsi2sdq	%r9, %xmm0	# 1364	[c=4 l=5]  sse2_cvtsi2sdq/0
+.L61:
+	mulsd	%xmm5, %xmm0	# 259	[c=20 l=4]  *fop_df_comm/1
+	testq	%r8, %r8	# 262	[c=4 l=3]  *cmpdi_ccno_1/0
+	js	.L62	# 263	[c=13 l=6]  *jcc
+	pxor	%xmm1, %xmm1	# 1361	[c=4 l=4]  movv2df_internal/0
+	cvtsi2sdq	%r8, %xmm1	# 1362	[c=4 l=5]  sse2_cvtsi2sdq/0
+.L63:
+	mulsd	%xmm4, %xmm1	# 275	[c=20 l=4]  *fop_df_comm/1
+	movl	16(%r15), %esi	# 277	[c=9 l=4]  *movsi_internal/0
+	addsd	%xmm1, %xmm0	# 276	[c=12 l=4]  *fop_df_comm/1
+	comisd	.LC9(%rip), %xmm0	# 279	[c=10 l=8]  *cmpidf/1
+	pxor	%xmm1, %xmm1	# 20	[c=4 l=4]  *movdf_internal/12
+	jbe	.L64	# 280	[c=13 l=2]  *jcc
+	movl	%esi, %eax	# 285	[c=1 l=2]  *zero_extendsidi2/3
+	pxor	%xmm1, %xmm1	# 1359	[c=4 l=4]  movv2df_internal/0
+	cvtsi2sdq	%rax, %xmm1	# 1360	[c=4 l=5]  sse2_cvtsi2sdq/0
+	divsd	%xmm0, %xmm1	# 300	[c=68 l=4]  *fop_df_1/2
+.L64:
+	movl	$1000, %ecx	# 304	[c=4 l=5]  *movdi_internal/2
+	xorl	%edx, %edx	# 1268	[c=4 l=2]  *movdi_xor
+	movq	%r8, %rax	# 1059	[c=4 l=3]  *movdi_internal/3
+	movq	904(%r15), %rdi	# 313	[c=9 l=7]  *movdi_internal/3
+	divq	%rcx	# 1204	[c=0 l=3]  *udivmoddi4_noext
+	movl	$60, %ecx	# 307	[c=4 l=5]  *movdi_internal/2
+	xorl	%edx, %edx	# 1269	[c=4 l=2]  *movdi_xor
+	movq	%rax, -328(%rbp)	# 1060	[c=4 l=7]  *movdi_internal/5
+	movq	%r9, %rax	# 1061	[c=4 l=3]  *movdi_internal/3
+	divq	%rcx	# 1206	[c=0 l=3]  *udivmoddi4_noext
+	comisd	.LC9(%rip), %xmm2	# 315	[c=10 l=8]  *cmpidf/1
+	movq	%rdx, %rcx	# 1063	[c=4 l=3]  *movdi_internal/3
+	jbe	.L117	# 316	[c=13 l=6]  *jcc
+	movsd	.LC10(%rip), %xmm6	# 321	[c=6 l=8]  *movdf_internal/14
+	movq	%r10, -352(%rbp)	# 1140	[c=4 l=7]  *movdi_internal/5
+	movq	%rax, %rdx	# 333	[c=4 l=3]  *movdi_internal/3
+	movl	$2, %eax	# 337	[c=4 l=5]  *movqi_internal/3
+	movq	%r11, -344(%rbp)	# 1138	[c=4 l=7]  *movdi_internal/5
+	mulsd	%xmm6, %xmm0	# 322	[c=20 l=4]  *fop_df_comm/1
+	movsd	%xmm3, -360(%rbp)	# 1142	[c=4 l=8]  *movdf_internal/15
+	movsd	%xmm2, -336(%rbp)	# 1135	[c=4 l=8]  *movdf_internal/15
+	movsd	%xmm6, -320(%rbp)	# 1137	[c=4 l=8]  *movdf_internal/15
+	pushq	%r10	# 1267	[c=4 l=2]  *pushdi2_rex64/0
+	pushq	%rsi	# 325	[c=4 l=1]  *pushsi2_rex64/0
+	divsd	%xmm2, %xmm0	# 323	[c=68 l=4]  *fop_df_1/2
+	pushq	%rsi	# 326	[c=4 l=1]  *pushsi2_rex64/0
+	leaq	.LC11(%rip), %rsi	# 334	[c=1 l=7]  *movdi_internal/4
+	pushq	-328(%rbp)	# 327	[c=9 l=6]  *pushdi2_rex64/0
+	call	fprintf@PLT	# 338	[c=10 l=5]  *call_value
+	movl	24(%r15), %eax	# 1066	[c=9 l=4]  *movsi_internal/0
+	movsd	-360(%rbp), %xmm3	# 1143	[c=9 l=8]  *movdf_internal/14
+	addq	$32, %rsp	# 342	[c=4 l=4]  *adddi_1/0
+	movsd	-336(%rbp), %xmm2	# 1136	[c=9 l=8]  *movdf_internal/14
+	movq	-344(%rbp), %r11	# 1139	[c=9 l=7]  *movdi_internal/3
+	leal	1(%rax), %r8d	# 1202	[c=4 l=4]  *leasi
+	subl	20(%r15), %r8d	# 341	[c=13 l=4]  *subsi_1/1
+	movq	-352(%rbp), %r10	# 1141	[c=9 l=7]  *movdi_internal/3
+	comisd	.LC9(%rip), %xmm3	# 344	[c=10 l=8]  *cmpidf/1
+	jbe	.L130	# 345	[c=13 l=6]  *jcc
+.L70:
+	movl	%r8d, %eax	# 379	[c=1 l=3]  *zero_extendsidi2/3
+	pxor	%xmm1, %xmm1	# 1357	[c=4 l=4]  movv2df_internal/0
+	cvtsi2sdq	%rax, %xmm1	# 1358	[c=4 l=5]  sse2_cvtsi2sdq/0
+	divsd	%xmm3, %xmm1	# 394	[c=68 l=4]  *fop_df_1/2
+.L72:
+	comisd	.LC9(%rip), %xmm2	# 399	[c=10 l=8]  *cmpidf/1
+	movq	904(%r15), %rdi	# 397	[c=9 l=7]  *movdi_internal/3
+	ja	.L71	# 400	[c=13 l=6]  *jcc
+	movl	$60, %ecx	# 460	[c=4 l=5]  *movdi_internal/2
+	movq	%r11, %rax	# 1082	[c=4 l=3]  *movdi_internal/3
+	xorl	%edx, %edx	# 1256	[c=4 l=2]  *movdi_xor
+	movq	%r11, %r9	# 474	[c=4 l=3]  *movdi_internal/3
+	divq	%rcx	# 1194	[c=0 l=3]  *udivmoddi4_noext
+	movsd	%xmm2, -328(%rbp)	# 1155	[c=4 l=8]  *movdf_internal/15
+	pxor	%xmm0, %xmm0	# 473	[c=4 l=4]  *movdf_internal/12
+	movq	%rax, %rsi	# 1083	[c=4 l=3]  *movdi_internal/3
+	movq	%rdx, %rcx	# 1084	[c=4 l=3]  *movdi_internal/3
+	xorl	%edx, %edx	# 1259	[c=4 l=2]  *movdi_xor
+	pushq	%rax	# 1258	[c=4 l=1]  *pushdi2_rex64/0
+	movq	%r10, %rax	# 1085	[c=4 l=3]  *movdi_internal/3
+	pushq	%r8	# 465	[c=4 l=2]  *pushsi2_rex64/0
+	pushq	%r8	# 466	[c=4 l=2]  *pushsi2_rex64/0
+	movl	$1000, %r8d	# 468	[c=4 l=6]  *movdi_internal/2
+	divq	%r8	# 1196	[c=0 l=3]  *udivmoddi4_noext
+	movq	%rsi, %rdx	# 477	[c=4 l=3]  *movdi_internal/3
+	movq	%r10, %r8	# 475	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC12(%rip), %rsi	# 478	[c=1 l=7]  *movdi_internal/4
+	pushq	%rax	# 470	[c=4 l=1]  *pushdi2_rex64/0
+	movl	$2, %eax	# 481	[c=4 l=5]  *movqi_internal/3
+	call	fprintf@PLT	# 482	[c=10 l=5]  *call_value
+	movsd	-312(%rbp), %xmm7	# 1087	[c=9 l=8]  *movdf_internal/14
+	addq	$32, %rsp	# 484	[c=4 l=4]  *adddi_1/0
+	comisd	.LC9(%rip), %xmm7	# 486	[c=10 l=8]  *cmpidf/1
+	movsd	-328(%rbp), %xmm2	# 1156	[c=9 l=8]  *movdf_internal/14
+	jbe	.L131	# 487	[c=13 l=6]  *jcc
+.L83:
+	movq	40(%r15), %rax	# 440	[c=9 l=4]  *movdi_internal/3
+	testq	%rax, %rax	# 443	[c=4 l=3]  *cmpdi_ccno_1/0
+	js	.L80	# 444	[c=13 l=6]  *jcc
+	pxor	%xmm1, %xmm1	# 1355	[c=4 l=4]  movv2df_internal/0
+	cvtsi2sdq	%rax, %xmm1	# 1356	[c=4 l=5]  sse2_cvtsi2sdq/0
+.L81:
+	divsd	-312(%rbp), %xmm1	# 455	[c=77 l=8]  *fop_df_1/2
+.L82:
+	comisd	.LC9(%rip), %xmm2	# 492	[c=10 l=8]  *cmpidf/1
+	movq	904(%r15), %rdi	# 490	[c=9 l=7]  *movdi_internal/3
+	ja	.L78	# 493	[c=13 l=6]  *jcc
+	movq	-296(%rbp), %rax	# 1098	[c=9 l=7]  *movdi_internal/3
+	movl	$60, %ecx	# 544	[c=4 l=5]  *movdi_internal/2
+	xorl	%edx, %edx	# 1244	[c=4 l=2]  *movdi_xor
+	pushq	%r8	# 1246	[c=4 l=2]  *pushdi2_rex64/0
+	movl	$1000, %r8d	# 550	[c=4 l=6]  *movdi_internal/2
+	movq	-296(%rbp), %r9	# 556	[c=9 l=7]  *movdi_internal/3
+	pxor	%xmm0, %xmm0	# 555	[c=4 l=4]  *movdf_internal/12
+	divq	%rcx	# 1186	[c=0 l=3]  *udivmoddi4_noext
+	movq	%rax, %rsi	# 1099	[c=4 l=3]  *movdi_internal/3
+	movq	-304(%rbp), %rax	# 1101	[c=9 l=7]  *movdi_internal/3
+	movq	%rdx, %rcx	# 1100	[c=4 l=3]  *movdi_internal/3
+	xorl	%edx, %edx	# 1247	[c=4 l=2]  *movdi_xor
+	divq	%r8	# 1188	[c=0 l=3]  *udivmoddi4_noext
+	movq	-304(%rbp), %r8	# 557	[c=9 l=7]  *movdi_internal/3
+	movq	%rsi, %rdx	# 559	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC13(%rip), %rsi	# 560	[c=1 l=7]  *movdi_internal/4
+	pushq	%rax	# 552	[c=4 l=1]  *pushdi2_rex64/0
+	movl	$2, %eax	# 563	[c=4 l=5]  *movqi_internal/3
+	call	fprintf@PLT	# 564	[c=10 l=5]  *call_value
+	popq	%r9	# 1248	[c=9 l=2]  *popdi1
+	pxor	%xmm1, %xmm1	# 25	[c=4 l=4]  *movdf_internal/12
+	popq	%r10	# 1249	[c=9 l=2]  *popdi1
+.L88:
+	movq	-280(%rbp), %rax	# 1103	[c=9 l=7]  *movdi_internal/3
+	movl	$60, %ecx	# 569	[c=4 l=5]  *movdi_internal/2
+	xorl	%edx, %edx	# 1238	[c=4 l=2]  *movdi_xor
+	movl	$1000, %r8d	# 576	[c=4 l=6]  *movdi_internal/2
+	movq	904(%r15), %rdi	# 573	[c=9 l=7]  *movdi_internal/3
+	divq	%rcx	# 1182	[c=0 l=3]  *udivmoddi4_noext
+	movq	%rax, %rsi	# 1104	[c=4 l=3]  *movdi_internal/3
+	pushq	%rax	# 1240	[c=4 l=1]  *pushdi2_rex64/0
+	movq	-288(%rbp), %rax	# 1106	[c=9 l=7]  *movdi_internal/3
+	movq	%rdx, %rcx	# 1105	[c=4 l=3]  *movdi_internal/3
+	xorl	%edx, %edx	# 1241	[c=4 l=2]  *movdi_xor
+	movsd	-320(%rbp), %xmm0	# 580	[c=9 l=8]  *movdf_internal/14
+	movq	-280(%rbp), %r9	# 581	[c=9 l=7]  *movdi_internal/3
+	divq	%r8	# 1184	[c=0 l=3]  *udivmoddi4_noext
+	movq	-288(%rbp), %r8	# 582	[c=9 l=7]  *movdi_internal/3
+	movq	%rsi, %rdx	# 584	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC14(%rip), %rsi	# 585	[c=1 l=7]  *movdi_internal/4
+	pushq	%rax	# 578	[c=4 l=1]  *pushdi2_rex64/0
+	movl	$2, %eax	# 588	[c=4 l=5]  *movqi_internal/3
+	call	fprintf@PLT	# 589	[c=10 l=5]  *call_value
+	cmpl	$0, 216(%r15)	# 591	[c=13 l=8]  *cmpsi_ccno_1/1
+	popq	%rdx	# 1242	[c=9 l=1]  *popdi1
+	popq	%rcx	# 1243	[c=9 l=1]  *popdi1
+	je	.L41	# 592	[c=13 l=6]  *jcc
+	jmp	.L122	# 1288	[c=1 l=2]  jump
+.L124:
+	movl	(%r15), %edx	# 46	[c=6 l=3]  *zero_extendsidi2/3
+	salq	$4, %rdx	# 47	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r15), %rdx	# 49	[c=13 l=7]  *adddi_1/1
+	movzbl	11(%rdx), %ecx	# 50	[c=13 l=4]  zero_extendqidi2/0
+	subq	%rcx, %rax	# 51	[c=4 l=3]  *subdi_1/0
+	movq	%rax, 40(%r15)	# 52	[c=4 l=4]  *movdi_internal/5
+	movzwl	14(%rdx), %eax	# 53	[c=13 l=4]  zero_extendhidi2/0
+	subq	%rax, 48(%r15)	# 54	[c=13 l=4]  *subdi_1/0
+	jmp	.L38	# 1290	[c=1 l=5]  jump
+.L43:
+	cmpl	$0, 216(%r15)	# 765	[c=13 l=8]  *cmpsi_ccno_1/1
+	je	.L132	# 766	[c=13 l=6]  *jcc
+.L122:
+	movq	904(%r15), %rdi	# 758	[c=9 l=7]  *movdi_internal/3
+	call	fflush@PLT	# 760	[c=10 l=5]  *call_value
+.L89:
+	testl	%ebx, %ebx	# 701	[c=4 l=2]  *cmpsi_ccno_1/0
+	jne	.L95	# 702	[c=13 l=2]  *jcc
+	movl	76(%r15), %esi	# 704	[c=9 l=4]  *movsi_internal/0
+.L96:
+	movq	%r15, %rdi	# 718	[c=4 l=3]  *movdi_internal/3
+	call	finish	# 719	[c=0 l=5]  *call
+.L127:
+	leaq	.LC5(%rip), %rdx	# 27	[c=1 l=7]  *movdi_internal/4
+	jmp	.L91	# 1293	[c=1 l=5]  jump
+.L129:
+	movq	904(%r15), %rdi	# 673	[c=9 l=7]  *movdi_internal/3
+	leaq	.LC19(%rip), %rsi	# 675	[c=1 l=7]  *movdi_internal/4
+	xorl	%eax, %eax	# 1233	[c=4 l=2]  *movdi_xor
+	call	fprintf@PLT	# 679	[c=10 l=5]  *call_value
+	jmp	.L94	# 1295	[c=1 l=5]  jump
+.L128:
+	movq	904(%r15), %rdi	# 649	[c=9 l=7]  *movdi_internal/3
+	leaq	.LC17(%rip), %rsi	# 651	[c=1 l=7]  *movdi_internal/4
+	xorl	%eax, %eax	# 1235	[c=4 l=2]  *movdi_xor
+	call	fprintf@PLT	# 655	[c=10 l=5]  *call_value
+	jmp	.L93	# 1297	[c=1 l=5]  jump
+.L95:
+	imulq	$24, -264(%rbp), %rax	# 711	[c=25 l=8]  *muldi3_1/0
+	movl	20(%r14,%rax), %esi	# 714	[c=10 l=5]  *movsi_internal/0
+	jmp	.L96	# 1299	[c=1 l=2]  jump
+.L125:
+	movq	904(%r15), %rdi	# 723	[c=9 l=7]  *movdi_internal/3
+	call	fflush@PLT	# 725	[c=10 l=5]  *call_value
+	leaq	16(%rbp), %rax	# 1117	[c=4 l=4]  *leadi
+	movq	912(%r15), %r13	# 726	[c=9 l=7]  *movdi_internal/3
+	movl	$24, -256(%rbp)	# 728	[c=4 l=10]  *movsi_internal/1
+	movq	%rax, -248(%rbp)	# 730	[c=4 l=7]  *movdi_internal/5
+	leaq	-224(%rbp), %rax	# 1118	[c=4 l=7]  *leadi
+	movq	144(%r15), %rdx	# 737	[c=9 l=7]  *movdi_internal/3
+	leaq	.LC21(%rip), %rsi	# 740	[c=1 l=7]  *movdi_internal/4
+	movq	%rax, -240(%rbp)	# 731	[c=4 l=7]  *movdi_internal/5
+	imulq	$24, -264(%rbp), %rax	# 734	[c=25 l=8]  *muldi3_1/0
+	movq	%r13, %rdi	# 742	[c=4 l=3]  *movdi_internal/3
+	movl	$48, -252(%rbp)	# 729	[c=4 l=10]  *movsi_internal/1
+	movq	8(%r14,%rax), %rcx	# 738	[c=10 l=5]  *movdi_internal/3
+	xorl	%eax, %eax	# 1231	[c=4 l=2]  *movdi_xor
+	call	fprintf@PLT	# 744	[c=10 l=5]  *call_value
+	movq	-272(%rbp), %rdx	# 746	[c=9 l=7]  *movdi_internal/3
+	movq	%r12, %rsi	# 747	[c=4 l=3]  *movdi_internal/3
+	movq	%r13, %rdi	# 748	[c=4 l=3]  *movdi_internal/3
+	call	vfprintf@PLT	# 749	[c=10 l=5]  *call_value
+	movq	%r13, %rsi	# 750	[c=4 l=3]  *movdi_internal/3
+	movl	$10, %edi	# 751	[c=4 l=5]  *movsi_internal/0
+	call	fputc@PLT	# 752	[c=10 l=5]  *call_value
+	movq	%r13, %rdi	# 753	[c=4 l=3]  *movdi_internal/3
+	call	fflush@PLT	# 754	[c=10 l=5]  *call_value
+	jmp	.L89	# 1301	[c=1 l=5]  jump
+.L130:
+	movq	904(%r15), %rdi	# 876	[c=9 l=7]  *movdi_internal/3
+	pxor	%xmm1, %xmm1	# 22	[c=4 l=4]  *movdf_internal/12
+.L71:
+	movl	$60, %ecx	# 409	[c=4 l=5]  *movdi_internal/2
+	movq	%r11, %rax	# 1073	[c=4 l=3]  *movdi_internal/3
+	xorl	%edx, %edx	# 1260	[c=4 l=2]  *movdi_xor
+	movq	%r11, %r9	# 423	[c=4 l=3]  *movdi_internal/3
+	divq	%rcx	# 1198	[c=0 l=3]  *udivmoddi4_noext
+	movsd	%xmm2, -328(%rbp)	# 1153	[c=4 l=8]  *movdf_internal/15
+	mulsd	-320(%rbp), %xmm3	# 407	[c=29 l=8]  *fop_df_comm/1
+	divsd	%xmm2, %xmm3	# 408	[c=68 l=4]  *fop_df_1/2
+	movq	%rax, %rsi	# 1074	[c=4 l=3]  *movdi_internal/3
+	movq	%rdx, %rcx	# 1075	[c=4 l=3]  *movdi_internal/3
+	xorl	%edx, %edx	# 1263	[c=4 l=2]  *movdi_xor
+	pushq	%rax	# 1262	[c=4 l=1]  *pushdi2_rex64/0
+	movq	%r10, %rax	# 1076	[c=4 l=3]  *movdi_internal/3
+	pushq	%r8	# 415	[c=4 l=2]  *pushsi2_rex64/0
+	pushq	%r8	# 416	[c=4 l=2]  *pushsi2_rex64/0
+	movl	$1000, %r8d	# 418	[c=4 l=6]  *movdi_internal/2
+	divq	%r8	# 1200	[c=0 l=3]  *udivmoddi4_noext
+	movq	%rsi, %rdx	# 426	[c=4 l=3]  *movdi_internal/3
+	movq	%r10, %r8	# 424	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC12(%rip), %rsi	# 427	[c=1 l=7]  *movdi_internal/4
+	movapd	%xmm3, %xmm0	# 1072	[c=4 l=4]  *movdf_internal/13
+	pushq	%rax	# 420	[c=4 l=1]  *pushdi2_rex64/0
+	movl	$2, %eax	# 430	[c=4 l=5]  *movqi_internal/3
+	call	fprintf@PLT	# 431	[c=10 l=5]  *call_value
+	movsd	-312(%rbp), %xmm7	# 1078	[c=9 l=8]  *movdf_internal/14
+	addq	$32, %rsp	# 432	[c=4 l=4]  *adddi_1/0
+	comisd	.LC9(%rip), %xmm7	# 434	[c=10 l=8]  *cmpidf/1
+	movsd	-328(%rbp), %xmm2	# 1154	[c=9 l=8]  *movdf_internal/14
+	ja	.L83	# 435	[c=13 l=6]  *jcc
+	movq	904(%r15), %rdi	# 879	[c=9 l=7]  *movdi_internal/3
+	pxor	%xmm1, %xmm1	# 24	[c=4 l=4]  *movdf_internal/12
+.L78:
+	movq	-296(%rbp), %rax	# 1091	[c=9 l=7]  *movdi_internal/3
+	movl	$60, %ecx	# 502	[c=4 l=5]  *movdi_internal/2
+	xorl	%edx, %edx	# 1252	[c=4 l=2]  *movdi_xor
+	movsd	-312(%rbp), %xmm0	# 1088	[c=9 l=8]  *movdf_internal/14
+	mulsd	-320(%rbp), %xmm0	# 500	[c=29 l=8]  *fop_df_comm/1
+	movsd	%xmm2, -312(%rbp)	# 1159	[c=4 l=8]  *movdf_internal/15
+	movl	$1000, %r8d	# 509	[c=4 l=6]  *movdi_internal/2
+	divq	%rcx	# 1190	[c=0 l=3]  *udivmoddi4_noext
+	divsd	%xmm2, %xmm0	# 501	[c=68 l=4]  *fop_df_1/2
+	movq	%rax, %rsi	# 1092	[c=4 l=3]  *movdi_internal/3
+	pushq	%rax	# 1254	[c=4 l=1]  *pushdi2_rex64/0
+	movq	-304(%rbp), %rax	# 1094	[c=9 l=7]  *movdi_internal/3
+	movq	%rdx, %rcx	# 1093	[c=4 l=3]  *movdi_internal/3
+	xorl	%edx, %edx	# 1255	[c=4 l=2]  *movdi_xor
+	movq	-296(%rbp), %r9	# 514	[c=9 l=7]  *movdi_internal/3
+	divq	%r8	# 1192	[c=0 l=3]  *udivmoddi4_noext
+	movq	-304(%rbp), %r8	# 515	[c=9 l=7]  *movdi_internal/3
+	movq	%rsi, %rdx	# 517	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC13(%rip), %rsi	# 518	[c=1 l=7]  *movdi_internal/4
+	pushq	%rax	# 511	[c=4 l=1]  *pushdi2_rex64/0
+	movl	$2, %eax	# 521	[c=4 l=5]  *movqi_internal/3
+	call	fprintf@PLT	# 522	[c=10 l=5]  *call_value
+	movq	40(%r15), %rax	# 523	[c=9 l=4]  *movdi_internal/3
+	movsd	-312(%rbp), %xmm2	# 1160	[c=9 l=8]  *movdf_internal/14
+	testq	%rax, %rax	# 526	[c=4 l=3]  *cmpdi_ccno_1/0
+	js	.L86	# 527	[c=13 l=6]  *jcc
+	pxor	%xmm1, %xmm1	# 1353	[c=4 l=4]  movv2df_internal/0
+	cvtsi2sdq	%rax, %xmm1	# 1354	[c=4 l=5]  sse2_cvtsi2sdq/0
+.L87:
+	divsd	%xmm2, %xmm1	# 538	[c=68 l=4]  *fop_df_1/2
+	popq	%r11	# 1250	[c=9 l=2]  *popdi1
+	popq	%rax	# 1251	[c=9 l=1]  *popdi1
+	jmp	.L88	# 1303	[c=1 l=5]  jump
+.L117:
+	movq	%r10, -344(%rbp)	# 1149	[c=4 l=7]  *movdi_internal/5
+	pxor	%xmm0, %xmm0	# 357	[c=4 l=4]  *movdf_internal/12
+	movq	%r11, -336(%rbp)	# 1147	[c=4 l=7]  *movdi_internal/5
+	movsd	%xmm3, -352(%rbp)	# 1151	[c=4 l=8]  *movdf_internal/15
+	movsd	%xmm2, -320(%rbp)	# 1145	[c=4 l=8]  *movdf_internal/15
+	pushq	%rdx	# 1265	[c=4 l=1]  *pushdi2_rex64/0
+	movq	%rax, %rdx	# 361	[c=4 l=3]  *movdi_internal/3
+	movl	$2, %eax	# 365	[c=4 l=5]  *movqi_internal/3
+	pushq	%rsi	# 352	[c=4 l=1]  *pushsi2_rex64/0
+	pushq	%rsi	# 353	[c=4 l=1]  *pushsi2_rex64/0
+	leaq	.LC11(%rip), %rsi	# 362	[c=1 l=7]  *movdi_internal/4
+	pushq	-328(%rbp)	# 354	[c=9 l=6]  *pushdi2_rex64/0
+	call	fprintf@PLT	# 366	[c=10 l=5]  *call_value
+	movl	24(%r15), %eax	# 1067	[c=9 l=4]  *movsi_internal/0
+	movsd	-352(%rbp), %xmm3	# 1152	[c=9 l=8]  *movdf_internal/14
+	addq	$32, %rsp	# 370	[c=4 l=4]  *adddi_1/0
+	movsd	-320(%rbp), %xmm2	# 1146	[c=9 l=8]  *movdf_internal/14
+	movq	-336(%rbp), %r11	# 1148	[c=9 l=7]  *movdi_internal/3
+	leal	1(%rax), %r8d	# 1201	[c=4 l=4]  *leasi
+	subl	20(%r15), %r8d	# 369	[c=13 l=4]  *subsi_1/1
+	movq	-344(%rbp), %r10	# 1150	[c=9 l=7]  *movdi_internal/3
+	comisd	.LC9(%rip), %xmm3	# 372	[c=10 l=8]  *cmpidf/1
+	jbe	.L118	# 373	[c=13 l=6]  *jcc
+	movsd	.LC10(%rip), %xmm7	# 877	[c=6 l=8]  *movdf_internal/14
+	movsd	%xmm7, -320(%rbp)	# 1068	[c=4 l=8]  *movdf_internal/15
+	jmp	.L70	# 1305	[c=1 l=5]  jump
+.L50:
+	movq	-296(%rbp), %rsi	# 1132	[c=9 l=7]  *movdi_internal/3
+	pxor	%xmm1, %xmm1	# 1351	[c=4 l=4]  movv2df_internal/0
+	movq	%rsi, %rax	# 1026	[c=4 l=3]  *movdi_internal/3
+	andl	$1, %esi	# 166	[c=4 l=3]  *anddi_1/0
+	shrq	%rax	# 165	[c=4 l=3]  *lshrdi3_1/0
+	orq	%rsi, %rax	# 167	[c=4 l=3]  *iordi_1/0
+	cvtsi2sdq	%rax, %xmm1	# 1352	[c=4 l=5]  sse2_cvtsi2sdq/0
+	addsd	%xmm1, %xmm1	# 169	[c=12 l=4]  *fop_df_comm/1
+	jmp	.L51	# 1307	[c=1 l=5]  jump
+.L47:
+	movq	-288(%rbp), %rcx	# 1128	[c=9 l=7]  *movdi_internal/3
+	pxor	%xmm0, %xmm0	# 1349	[c=4 l=4]  movv2df_internal/0
+	movq	%rcx, %rdx	# 1013	[c=4 l=3]  *movdi_internal/3
+	andl	$1, %ecx	# 138	[c=4 l=3]  *anddi_1/0
+	shrq	%rdx	# 137	[c=4 l=3]  *lshrdi3_1/0
+	orq	%rcx, %rdx	# 139	[c=4 l=3]  *iordi_1/0
+	cvtsi2sdq	%rdx, %xmm0	# 1350	[c=4 l=5]  sse2_cvtsi2sdq/0
+	addsd	%xmm0, %xmm0	# 141	[c=12 l=4]  *fop_df_comm/1
+	jmp	.L48	# 1309	[c=1 l=5]  jump
+.L45:
+	movq	-280(%rbp), %rcx	# 1126	[c=9 l=7]  *movdi_internal/3
+	pxor	%xmm2, %xmm2	# 1347	[c=4 l=4]  movv2df_internal/0
+	movq	%rcx, %rdx	# 1008	[c=4 l=3]  *movdi_internal/3
+	andl	$1, %ecx	# 122	[c=4 l=3]  *anddi_1/0
+	shrq	%rdx	# 121	[c=4 l=3]  *lshrdi3_1/0
+	orq	%rcx, %rdx	# 123	[c=4 l=3]  *iordi_1/0
+	cvtsi2sdq	%rdx, %xmm2	# 1348	[c=4 l=5]  sse2_cvtsi2sdq/0
+	addsd	%xmm2, %xmm2	# 125	[c=12 l=4]  *fop_df_comm/1
+	jmp	.L46	# 1311	[c=1 l=5]  jump
+.L62:
+	movq	%r8, %rax	# 1055	[c=4 l=3]  *movdi_internal/3
+	movq	%r8, %rdx	# 1057	[c=4 l=3]  *movdi_internal/3
+	pxor	%xmm1, %xmm1	# 1345	[c=4 l=4]  movv2df_internal/0
+	shrq	%rax	# 268	[c=4 l=3]  *lshrdi3_1/0
+	andl	$1, %edx	# 269	[c=4 l=3]  *anddi_1/0
+	orq	%rdx, %rax	# 270	[c=4 l=3]  *iordi_1/0
+	cvtsi2sdq	%rax, %xmm1	# 1346	[c=4 l=5]  sse2_cvtsi2sdq/0
+	addsd	%xmm1, %xmm1	# 272	[c=12 l=4]  *fop_df_comm/1
+	jmp	.L63	# 1313	[c=1 l=5]  jump
+.L60:
+	movq	%r9, %rax	# 1051	[c=4 l=3]  *movdi_internal/3
+	movq	%r9, %rdx	# 1053	[c=4 l=3]  *movdi_internal/3
+	pxor	%xmm0, %xmm0	# 1343	[c=4 l=4]  movv2df_internal/0
+	shrq	%rax	# 252	[c=4 l=3]  *lshrdi3_1/0
+	andl	$1, %edx	# 253	[c=4 l=3]  *anddi_1/0
+	orq	%rdx, %rax	# 254	[c=4 l=3]  *iordi_1/0
+	cvtsi2sdq	%rax, %xmm0	# 1344	[c=4 l=5]  sse2_cvtsi2sdq/0
+	addsd	%xmm0, %xmm0	# 256	[c=12 l=4]  *fop_df_comm/1
+	jmp	.L61	# 1315	[c=1 l=5]  jump
+.L57:
+	movq	%r10, %rdx	# 1045	[c=4 l=3]  *movdi_internal/3
+	movq	%r10, %rcx	# 1047	[c=4 l=3]  *movdi_internal/3
+	pxor	%xmm1, %xmm1	# 1341	[c=4 l=4]  movv2df_internal/0
+	shrq	%rdx	# 225	[c=4 l=3]  *lshrdi3_1/0
+	andl	$1, %ecx	# 226	[c=4 l=3]  *anddi_1/0
+	orq	%rcx, %rdx	# 227	[c=4 l=3]  *iordi_1/0
+	cvtsi2sdq	%rdx, %xmm1	# 1342	[c=4 l=5]  sse2_cvtsi2sdq/0
+	addsd	%xmm1, %xmm1	# 229	[c=12 l=4]  *fop_df_comm/1
+	jmp	.L58	# 1317	[c=1 l=5]  jump
+.L55:
+	movq	%r11, %rdx	# 1041	[c=4 l=3]  *movdi_internal/3
+	movq	%r11, %rcx	# 1043	[c=4 l=3]  *movdi_internal/3
+	pxor	%xmm3, %xmm3	# 1339	[c=4 l=4]  movv2df_internal/0
+	shrq	%rdx	# 209	[c=4 l=3]  *lshrdi3_1/0
+	andl	$1, %ecx	# 210	[c=4 l=3]  *anddi_1/0
+	orq	%rcx, %rdx	# 211	[c=4 l=3]  *iordi_1/0
+	cvtsi2sdq	%rdx, %xmm3	# 1340	[c=4 l=5]  sse2_cvtsi2sdq/0
+	addsd	%xmm3, %xmm3	# 213	[c=12 l=4]  *fop_df_comm/1
+	jmp	.L56	# 1319	[c=1 l=5]  jump
+.L52:
+	movq	-304(%rbp), %rsi	# 1134	[c=9 l=7]  *movdi_internal/3
+	pxor	%xmm0, %xmm0	# 1337	[c=4 l=4]  movv2df_internal/0
+	movq	%rsi, %rax	# 1031	[c=4 l=3]  *movdi_internal/3
+	andl	$1, %esi	# 182	[c=4 l=3]  *anddi_1/0
+	shrq	%rax	# 181	[c=4 l=3]  *lshrdi3_1/0
+	orq	%rsi, %rax	# 183	[c=4 l=3]  *iordi_1/0
+	cvtsi2sdq	%rax, %xmm0	# 1338	[c=4 l=5]  sse2_cvtsi2sdq/0
+	addsd	%xmm0, %xmm0	# 185	[c=12 l=4]  *fop_df_comm/1
+	jmp	.L53	# 1321	[c=1 l=5]  jump
+.L131:
+	pxor	%xmm1, %xmm1	# 23	[c=4 l=4]  *movdf_internal/12
+	jmp	.L82	# 1323	[c=1 l=5]  jump
+.L118:
+	movsd	.LC10(%rip), %xmm6	# 878	[c=6 l=8]  *movdf_internal/14
+	pxor	%xmm1, %xmm1	# 21	[c=4 l=4]  *movdf_internal/12
+	movsd	%xmm6, -320(%rbp)	# 1069	[c=4 l=8]  *movdf_internal/15
+	jmp	.L72	# 1325	[c=1 l=5]  jump
+.L80:
+	movq	%rax, %rdx	# 1079	[c=4 l=3]  *movdi_internal/3
+	andl	$1, %eax	# 450	[c=4 l=3]  *anddi_1/0
+	pxor	%xmm1, %xmm1	# 1335	[c=4 l=4]  movv2df_internal/0
+	shrq	%rdx	# 449	[c=4 l=3]  *lshrdi3_1/0
+	orq	%rax, %rdx	# 451	[c=4 l=3]  *iordi_1/0
+	cvtsi2sdq	%rdx, %xmm1	# 1336	[c=4 l=5]  sse2_cvtsi2sdq/0
+	addsd	%xmm1, %xmm1	# 453	[c=12 l=4]  *fop_df_comm/1
+	jmp	.L81	# 1327	[c=1 l=5]  jump
+.L86:
+	movq	%rax, %rdx	# 1096	[c=4 l=3]  *movdi_internal/3
+	andl	$1, %eax	# 533	[c=4 l=3]  *anddi_1/0
+	pxor	%xmm1, %xmm1	# 1333	[c=4 l=4]  movv2df_internal/0
+	shrq	%rdx	# 532	[c=4 l=3]  *lshrdi3_1/0
+	orq	%rax, %rdx	# 534	[c=4 l=3]  *iordi_1/0
+	cvtsi2sdq	%rdx, %xmm1	# 1334	[c=4 l=5]  sse2_cvtsi2sdq/0
+	addsd	%xmm1, %xmm1	# 536	[c=12 l=4]  *fop_df_comm/1
+	jmp	.L87	# 1329	[c=1 l=5]  jump
+.L132:
+	leaq	-256(%rbp), %rax	# 880	[c=4 l=7]  *leadi
+	movq	%rax, -272(%rbp)	# 1120	[c=4 l=7]  *movdi_internal/5
+	jmp	.L41	# 1331	[c=1 l=5]  jump
+	.cfi_endproc
+.LFE21:
+	.size	leave, .-leave
+	.section	.rodata.str1.8
+	.align 8
+.LC22:
+	.string	"program counter 0x%x out of bounds (0x%x--0x%x)"
+	.text
+	.p2align 4
+	.type	bad_PC, @function
+bad_PC:
+.LFB67:
+	.cfi_startproc
+	subq	$8, %rsp	# 27	[c=4 l=4]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_def_cfa_offset 16
+	movl	24(%rdi), %eax	# 7	[c=9 l=3]  *movsi_internal/0
+	movl	20(%rdi), %r8d	# 12	[c=9 l=4]  *movsi_internal/0
+	leal	(%rsi,%rsi), %ecx	# 26	[c=12 l=3]  *leasi
+	leaq	.LC22(%rip), %rdx	# 14	[c=1 l=7]  *movdi_internal/4
+	movl	$1, %esi	# 16	[c=4 l=5]  *movsi_internal/0
+	leal	-1(%rax), %r9d	# 11	[c=4 l=4]  *leasi
+	xorl	%eax, %eax	# 34	[c=4 l=2]  *movdi_xor
+	call	leave	# 19	[c=0 l=5]  *call
+	.cfi_endproc
+.LFE67:
+	.size	bad_PC, .-bad_PC
+	.section	.rodata.str1.8
+	.align 8
+.LC23:
+	.string	"access to unmapped RAM address 0x%x (RAMEND = 0x%04x)"
+	.text
+	.p2align 4
+	.type	bad_address, @function
+bad_address:
+.LFB22:
+	.cfi_startproc
+	subq	$8, %rsp	# 22	[c=4 l=4]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_def_cfa_offset 16
+	movl	1000(%rdi), %r8d	# 8	[c=9 l=7]  *movsi_internal/0
+	movl	%esi, %ecx	# 3	[c=4 l=2]  *movsi_internal/0
+	xorl	%eax, %eax	# 29	[c=4 l=2]  *movdi_xor
+	leaq	.LC23(%rip), %rdx	# 10	[c=1 l=7]  *movdi_internal/4
+	movl	$1, %esi	# 12	[c=4 l=5]  *movsi_internal/0
+	call	leave	# 15	[c=0 l=5]  *call
+	.cfi_endproc
+.LFE22:
+	.size	bad_address, .-bad_address
+	.p2align 4
+	.type	data_read_mapped, @function
+data_read_mapped:
+.LFB27:
+	.cfi_startproc
+	movl	%esi, %eax	# 87	[c=4 l=2]  *movsi_internal/0
+	subl	5176(%rdi), %eax	# 8	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rdi), %eax	# 9	[c=13 l=6]  *cmpsi_1/1
+	jb	.L138	# 10	[c=13 l=2]  *jcc
+	movl	%esi, %eax	# 89	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %eax	# 12	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 85	[c=5 l=5]  *andsi_1_zext
+	movzbl	1080(%rdi,%rax), %eax	# 15	[c=10 l=8]  *movqi_internal/4
+	cmpb	$3, %al	# 16	[c=4 l=2]  *cmpqi_1/0
+	je	.L139	# 17	[c=13 l=2]  *jcc
+	cmpb	$4, %al	# 19	[c=4 l=2]  *cmpqi_1/0
+	je	.L140	# 20	[c=13 l=2]  *jcc
+	cmpb	$2, %al	# 22	[c=4 l=2]  *cmpqi_1/0
+	je	.L146	# 23	[c=13 l=2]  *jcc
+.L138:
+	subq	$8, %rsp	# 93	[c=4 l=4]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_def_cfa_offset 16
+	call	bad_address	# 61	[c=0 l=5]  *call
+	.p2align 4,,10
+	.p2align 3
+.L146:
+	.cfi_def_cfa_offset 8
+	movl	992(%rdi), %eax	# 25	[c=9 l=6]  *movsi_internal/0
+	subl	$16384, %esi	# 28	[c=4 l=6]  *addsi_1/0
+	movq	1056(%rdi), %rdx	# 31	[c=9 l=7]  *movdi_internal/3
+	leal	1(%rax,%rax), %eax	# 27	[c=8 l=4]  *leasi
+	andl	%esi, %eax	# 29	[c=4 l=2]  *andsi_1/0
+	cltq	# 30	[c=4 l=2]  *extendsidi2_rex64/0
+	movzbl	(%rdx,%rax), %eax	# 32	[c=13 l=4]  *zero_extendqisi2/0
+	ret		# 77	[c=0 l=1]  simple_return_internal
+	.p2align 4,,10
+	.p2align 3
+.L140:
+	movl	%esi, %eax	# 91	[c=4 l=2]  *movsi_internal/0
+	movq	1072(%rdi), %rdx	# 47	[c=9 l=7]  *movdi_internal/3
+	sarl	$12, %eax	# 44	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 84	[c=5 l=5]  *andsi_1_zext
+	movq	(%rdx,%rax,8), %rdx	# 48	[c=10 l=4]  *movdi_internal/3
+	xorl	%eax, %eax	# 109	[c=4 l=2]  *movdi_xor
+	testq	%rdx, %rdx	# 49	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L137	# 50	[c=13 l=2]  *jcc
+	andl	$4095, %esi	# 83	[c=5 l=6]  *andsi_1_zext
+	movzbl	(%rdx,%rsi), %eax	# 54	[c=13 l=4]  *zero_extendqisi2/0
+	ret		# 81	[c=0 l=1]  simple_return_internal
+	.p2align 4,,10
+	.p2align 3
+.L139:
+	movq	1048(%rdi), %rax	# 38	[c=9 l=7]  *movdi_internal/3
+	movslq	%esi, %rsi	# 37	[c=4 l=3]  *extendsidi2_rex64/1
+	movzbl	-4096(%rax,%rsi), %eax	# 39	[c=14 l=8]  *zero_extendqisi2/0
+	ret		# 79	[c=0 l=1]  simple_return_internal
+	.p2align 4,,10
+	.p2align 3
+.L137:
+	ret		# 100	[c=0 l=1]  simple_return_internal
+	.cfi_endproc
+.LFE27:
+	.size	data_read_mapped, .-data_read_mapped
+	.section	.rodata.str1.1
+.LC24:
+	.string	"{F:%04x} "
+	.text
+	.p2align 4
+	.type	data_read_page, @function
+data_read_page:
+.LFB37:
+	.cfi_startproc
+	pushq	%rbx	# 107	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	movslq	%esi, %rbx	# 3	[c=4 l=3]  *extendsidi2_rex64/1
+	movl	%ebx, %eax	# 100	[c=4 l=2]  *movsi_internal/0
+	subq	$16, %rsp	# 108	[c=4 l=4]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_def_cfa_offset 32
+	subl	5176(%rdi), %eax	# 8	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rdi), %eax	# 9	[c=13 l=6]  *cmpsi_1/1
+	jb	.L148	# 10	[c=13 l=2]  *jcc
+	movl	%ebx, %eax	# 102	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %eax	# 12	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 98	[c=5 l=5]  *andsi_1_zext
+	movzbl	1080(%rdi,%rax), %eax	# 15	[c=10 l=8]  *movqi_internal/4
+	cmpb	$1, %al	# 16	[c=4 l=2]  *cmpqi_1/0
+	je	.L149	# 17	[c=13 l=2]  *jcc
+	cmpb	$2, %al	# 19	[c=4 l=2]  *cmpqi_1/0
+	je	.L150	# 20	[c=13 l=2]  *jcc
+.L148:
+	addq	$16, %rsp	# 117	[c=4 l=4]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_remember_state
+	.cfi_def_cfa_offset 16
+	movl	%ebx, %esi	# 73	[c=4 l=2]  *movsi_internal/0
+	popq	%rbx	# 118	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 8
+	jmp	data_read_mapped	# 75	[c=10 l=5]  *sibcall_value
+	.p2align 4,,10
+	.p2align 3
+.L150:
+	.cfi_restore_state
+	leal	-16384(%rbx), %edx	# 106	[c=4 l=6]  *leasi
+	leaq	.LC24(%rip), %rsi	# 65	[c=1 l=7]  *movdi_internal/4
+	xorl	%eax, %eax	# 123	[c=4 l=2]  *movdi_xor
+	movq	%rdi, 8(%rsp)	# 104	[c=4 l=5]  *movdi_internal/5
+	call	log_append@PLT	# 69	[c=0 l=5]  *call
+	movq	8(%rsp), %rdi	# 105	[c=9 l=5]  *movdi_internal/3
+	movl	%ebx, %esi	# 125	[c=4 l=2]  *movsi_internal/0
+	addq	$1, 48(%rdi)	# 70	[c=13 l=5]  *adddi_1/0
+	addq	$16, %rsp	# 127	[c=4 l=4]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_remember_state
+	.cfi_def_cfa_offset 16
+	popq	%rbx	# 128	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 8
+	jmp	data_read_mapped	# 129	[c=10 l=5]  *sibcall_value
+	.p2align 4,,10
+	.p2align 3
+.L149:
+	.cfi_restore_state
+	cmpl	6564(%rdi), %ebx	# 26	[c=13 l=6]  *cmpsi_1/1
+	jnb	.L151	# 27	[c=13 l=2]  *jcc
+	movslq	%ebx, %rax	# 29	[c=4 l=3]  *extendsidi2_rex64/1
+	cmpb	$0, 6568(%rdi,%rax)	# 30	[c=14 l=8]  *cmpqi_ccno_1/1
+	je	.L151	# 31	[c=13 l=2]  *jcc
+	movq	48(%rdi), %rdx	# 41	[c=9 l=4]  *movdi_internal/3
+	addq	$16, %rsp	# 120	[c=4 l=4]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_remember_state
+	.cfi_def_cfa_offset 16
+	movl	%ebx, %esi	# 43	[c=4 l=2]  *movsi_internal/0
+	popq	%rbx	# 121	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 8
+	jmp	periph_read@PLT	# 45	[c=10 l=5]  *sibcall_value
+	.p2align 4,,10
+	.p2align 3
+.L151:
+	.cfi_restore_state
+	cmpl	%ebx, 1000(%rdi)	# 34	[c=13 l=6]  *cmpsi_1/0
+	jb	.L159	# 35	[c=13 l=2]  *jcc
+	movq	1040(%rdi), %rax	# 57	[c=9 l=7]  *movdi_internal/3
+	movzbl	(%rax,%rbx), %eax	# 58	[c=13 l=4]  *zero_extendqisi2/0
+	addq	$16, %rsp	# 111	[c=4 l=4]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_remember_state
+	.cfi_def_cfa_offset 16
+	popq	%rbx	# 112	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 8
+	ret		# 113	[c=0 l=1]  simple_return_internal
+.L159:
+	.cfi_restore_state
+	movl	%ebx, %esi	# 50	[c=4 l=2]  *movsi_internal/0
+	call	bad_address	# 52	[c=0 l=5]  *call
+	.cfi_endproc
+.LFE37:
+	.size	data_read_page, .-data_read_page
+	.section	.rodata.str1.8
+	.align 8
+.LC25:
+	.string	"stack pointer overflow (SP = 0x%04x)"
+	.text
+	.p2align 4
+	.type	stack_overflow, @function
+stack_overflow:
+.LFB63:
+	.cfi_startproc
+	movl	%esi, %ecx	# 3	[c=4 l=2]  *movsi_internal/0
+	subq	$8, %rsp	# 20	[c=4 l=4]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_def_cfa_offset 16
+	leaq	.LC25(%rip), %rdx	# 8	[c=1 l=7]  *movdi_internal/4
+	xorl	%eax, %eax	# 27	[c=4 l=2]  *movdi_xor
+	movl	$1, %esi	# 10	[c=4 l=5]  *movsi_internal/0
+	call	leave	# 13	[c=0 l=5]  *call
+	.cfi_endproc
+.LFE63:
+	.size	stack_overflow, .-stack_overflow
+	.section	.rodata.str1.1
+.LC26:
+	.string	"external memory"
+	.section	.rodata.str1.8
+	.align 8
+.LC27:
+	.string	"out of memory allocating %u * %u bytes for %s"
+	.text
+	.p2align 4
+	.type	data_write_mapped, @function
+data_write_mapped:
+.LFB28:
+	.cfi_startproc
+	pushq	%r12	# 121	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	movl	%esi, %eax	# 112	[c=4 l=2]  *movsi_internal/0
+	pushq	%rbp	# 122	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	movq	%rdi, %rbp	# 2	[c=4 l=3]  *movdi_internal/3
+	pushq	%rbx	# 123	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	movl	%esi, %ebx	# 3	[c=4 l=2]  *movsi_internal/0
+	subq	$16, %rsp	# 124	[c=4 l=4]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_def_cfa_offset 48
+	subl	5176(%rdi), %eax	# 8	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rdi), %eax	# 9	[c=13 l=6]  *cmpsi_1/1
+	jb	.L163	# 10	[c=13 l=2]  *jcc
+	movl	%esi, %eax	# 114	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %eax	# 12	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 110	[c=5 l=5]  *andsi_1_zext
+	movzbl	1080(%rdi,%rax), %eax	# 15	[c=10 l=8]  *movqi_internal/4
+	cmpb	$3, %al	# 16	[c=4 l=2]  *cmpqi_1/0
+	je	.L164	# 17	[c=13 l=2]  *jcc
+	cmpb	$4, %al	# 19	[c=4 l=2]  *cmpqi_1/0
+	jne	.L163	# 20	[c=13 l=2]  *jcc
+	movl	%esi, %eax	# 116	[c=4 l=2]  *movsi_internal/0
+	movq	1072(%rdi), %rcx	# 38	[c=9 l=7]  *movdi_internal/3
+	sarl	$12, %eax	# 34	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 109	[c=5 l=5]  *andsi_1_zext
+	leaq	(%rcx,%rax,8), %r12	# 39	[c=8 l=4]  *leadi
+	movq	(%r12), %rax	# 40	[c=5 l=4]  *movdi_internal/3
+	testq	%rax, %rax	# 41	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L175	# 42	[c=13 l=2]  *jcc
+.L166:
+	andl	$4095, %ebx	# 108	[c=5 l=6]  *andsi_1_zext
+	movb	%dl, (%rax,%rbx)	# 79	[c=4 l=3]  *movqi_internal/8
+	addq	$16, %rsp	# 127	[c=4 l=4]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_remember_state
+	.cfi_def_cfa_offset 32
+	popq	%rbx	# 128	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 24
+	popq	%rbp	# 129	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 16
+	popq	%r12	# 130	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 8
+	ret		# 131	[c=0 l=1]  simple_return_internal
+	.p2align 4,,10
+	.p2align 3
+.L164:
+	.cfi_restore_state
+	addq	$16, %rsp	# 135	[c=4 l=4]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_remember_state
+	.cfi_def_cfa_offset 32
+	leal	-4096(%rsi), %esi	# 120	[c=4 l=6]  *leasi
+	popq	%rbx	# 136	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 24
+	popq	%rbp	# 137	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 16
+	popq	%r12	# 138	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 8
+	jmp	eeprom_write_mapped@PLT	# 30	[c=0 l=5]  *sibcall
+	.p2align 4,,10
+	.p2align 3
+.L163:
+	.cfi_restore_state
+	movl	%ebx, %esi	# 84	[c=4 l=2]  *movsi_internal/0
+	movq	%rbp, %rdi	# 85	[c=4 l=3]  *movdi_internal/3
+	call	bad_address	# 86	[c=0 l=5]  *call
+	.p2align 4,,10
+	.p2align 3
+.L175:
+	movl	$4128, %esi	# 44	[c=4 l=5]  *movdi_internal/2
+	movl	$1, %edi	# 45	[c=4 l=5]  *movdi_internal/2
+	movl	%edx, 12(%rsp)	# 118	[c=4 l=4]  *movsi_internal/1
+	call	calloc@PLT	# 46	[c=10 l=5]  *call_value
+	movl	12(%rsp), %edx	# 119	[c=9 l=4]  *movsi_internal/0
+	testq	%rax, %rax	# 49	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L176	# 50	[c=13 l=2]  *jcc
+	movq	984(%rbp), %rcx	# 64	[c=9 l=7]  *movdi_internal/3
+	movq	%rcx, (%rax)	# 65	[c=4 l=3]  *movdi_internal/5
+	testq	%rcx, %rcx	# 66	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L168	# 67	[c=13 l=2]  *jcc
+	movq	%rax, 8(%rcx)	# 69	[c=4 l=4]  *movdi_internal/5
+.L168:
+	movq	%rax, 984(%rbp)	# 72	[c=4 l=7]  *movdi_internal/5
+	addq	$32, %rax	# 73	[c=4 l=4]  *adddi_1/0
+	movq	%rax, (%r12)	# 74	[c=4 l=4]  *movdi_internal/5
+	jmp	.L166	# 142	[c=1 l=5]  jump
+.L176:
+	leaq	.LC26(%rip), %r9	# 52	[c=1 l=7]  *movdi_internal/4
+	movl	$1, %r8d	# 53	[c=4 l=6]  *movsi_internal/0
+	movq	%rbp, %rdi	# 58	[c=4 l=3]  *movdi_internal/3
+	movl	$4096, %ecx	# 54	[c=4 l=5]  *movsi_internal/0
+	leaq	.LC27(%rip), %rdx	# 55	[c=1 l=7]  *movdi_internal/4
+	movl	$6, %esi	# 57	[c=4 l=5]  *movsi_internal/0
+	call	leave	# 60	[c=0 l=5]  *call
+	.cfi_endproc
+.LFE28:
+	.size	data_write_mapped, .-data_write_mapped
+	.p2align 4
+	.type	data_write_page, @function
+data_write_page:
+.LFB38:
+	.cfi_startproc
+	movl	%esi, %eax	# 84	[c=4 l=2]  *movsi_internal/0
+	subl	5176(%rdi), %eax	# 9	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rdi), %eax	# 10	[c=13 l=6]  *cmpsi_1/1
+	jb	.L178	# 11	[c=13 l=2]  *jcc
+	movl	%esi, %eax	# 86	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %eax	# 13	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 82	[c=5 l=5]  *andsi_1_zext
+	cmpb	$1, 1080(%rdi,%rax)	# 16	[c=14 l=8]  *cmpqi_1/0
+	je	.L179	# 17	[c=13 l=2]  *jcc
+.L178:
+	jmp	data_write_mapped	# 23	[c=0 l=5]  *sibcall
+	.p2align 4,,10
+	.p2align 3
+.L179:
+	cmpl	$95, %esi	# 27	[c=4 l=3]  *cmpsi_1/0
+	je	.L190	# 28	[c=13 l=2]  *jcc
+	cmpl	6564(%rdi), %esi	# 36	[c=13 l=6]  *cmpsi_1/1
+	jnb	.L182	# 37	[c=13 l=2]  *jcc
+	movslq	%esi, %rax	# 39	[c=4 l=3]  *extendsidi2_rex64/1
+	cmpb	$0, 6568(%rdi,%rax)	# 40	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L183	# 41	[c=13 l=2]  *jcc
+.L182:
+	cmpl	%esi, 1000(%rdi)	# 44	[c=13 l=6]  *cmpsi_1/0
+	jb	.L191	# 45	[c=13 l=2]  *jcc
+	movq	1040(%rdi), %rax	# 67	[c=9 l=7]  *movdi_internal/3
+	movslq	%esi, %rsi	# 66	[c=4 l=3]  *extendsidi2_rex64/1
+	movb	%dl, (%rax,%rsi)	# 68	[c=4 l=3]  *movqi_internal/8
+	ret		# 95	[c=0 l=1]  simple_return_internal
+	.p2align 4,,10
+	.p2align 3
+.L190:
+	movq	1040(%rdi), %rax	# 30	[c=9 l=7]  *movdi_internal/3
+	movb	%dl, 95(%rax)	# 31	[c=4 l=3]  *movqi_internal/8
+	ret		# 76	[c=0 l=1]  simple_return_internal
+	.p2align 4,,10
+	.p2align 3
+.L183:
+	movq	48(%rdi), %rcx	# 51	[c=9 l=4]  *movdi_internal/3
+	jmp	periph_write@PLT	# 56	[c=0 l=5]  *sibcall
+.L191:
+	pushq	%rax	# 108	[c=4 l=1]  *pushdi2_prologue
+	.cfi_def_cfa_offset 16
+	call	bad_address	# 62	[c=0 l=5]  *call
+	.cfi_endproc
+.LFE38:
+	.size	data_write_page, .-data_write_page
+	.section	.rodata.str1.1
+.LC28:
+	.string	"(SREG)->'%s' "
+.LC29:
+	.string	"(%s)->%02x "
+.LC30:
+	.string	"(SREG)<-'%s' "
+.LC31:
+	.string	"(%s)<-%02x "
+	.text
+	.p2align 4
+	.type	spm_operation, @function
+spm_operation:
+.LFB79:
+	.cfi_startproc
+	pushq	%r13	# 150	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 16
+	.cfi_offset 13, -16
+	pushq	%r12	# 151	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 24
+	.cfi_offset 12, -24
+	pushq	%rbp	# 152	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 32
+	.cfi_offset 6, -32
+	pushq	%rbx	# 153	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 40
+	.cfi_offset 3, -40
+	movq	%rdi, %rbx	# 2	[c=4 l=3]  *movdi_internal/3
+	subq	$24, %rsp	# 154	[c=4 l=4]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_def_cfa_offset 64
+	movl	6048(%rdi), %edx	# 11	[c=9 l=6]  *movsi_internal/0
+	movl	%edx, %eax	# 136	[c=4 l=2]  *movsi_internal/0
+	subl	5176(%rdi), %eax	# 12	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rdi), %eax	# 13	[c=13 l=6]  *cmpsi_1/1
+	jb	.L193	# 14	[c=13 l=2]  *jcc
+	movl	%edx, %eax	# 138	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %eax	# 16	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 128	[c=5 l=5]  *andsi_1_zext
+	cmpb	$0, 1080(%rdi,%rax)	# 19	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L194	# 20	[c=13 l=6]  *jcc
+.L193:
+	movq	1040(%rbx), %rcx	# 24	[c=9 l=7]  *movdi_internal/3
+	movslq	%edx, %rax	# 23	[c=4 l=3]  *extendsidi2_rex64/1
+	movzbl	(%rcx,%rax), %ebp	# 25	[c=13 l=4]  *zero_extendqisi2/0
+.L195:
+	cmpl	$95, %edx	# 115	[c=4 l=3]  *cmpsi_1/0
+	leaq	.LC29(%rip), %rax	# 131	[c=1 l=7]  *movdi_internal/4
+	movl	%ebp, %ecx	# 41	[c=4 l=2]  *movsi_internal/0
+	movq	%rbx, %rdi	# 44	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC28(%rip), %rsi	# 130	[c=1 l=7]  *movdi_internal/4
+	movl	%ebp, %r13d	# 140	[c=4 l=3]  *movsi_internal/0
+	cmovne	%rax, %rsi	# 116	[c=8 l=4]  *movdicc_noc/1
+	andl	$-64, %r13d	# 46	[c=4 l=4]  *andsi_1/0
+	call	log_add_data_mov@PLT	# 45	[c=0 l=5]  *call
+	movslq	6048(%rbx), %r12	# 47	[c=13 l=7]  *extendsidi2_rex64/1
+	movl	%ebp, %ecx	# 142	[c=4 l=2]  *movsi_internal/0
+	leaq	.LC31(%rip), %rax	# 133	[c=1 l=7]  *movdi_internal/4
+	andl	$192, %ecx	# 48	[c=4 l=6]  *andsi_1/0
+	leaq	.LC30(%rip), %rsi	# 132	[c=1 l=7]  *movdi_internal/4
+	movq	%rbx, %rdi	# 57	[c=4 l=3]  *movdi_internal/3
+	cmpl	$95, %r12d	# 119	[c=4 l=4]  *cmpsi_1/0
+	movl	%r12d, %edx	# 55	[c=4 l=3]  *movsi_internal/0
+	cmovne	%rax, %rsi	# 120	[c=8 l=4]  *movdicc_noc/1
+	call	log_add_data_mov@PLT	# 58	[c=0 l=5]  *call
+	movl	%r12d, %eax	# 144	[c=4 l=3]  *movsi_internal/0
+	subl	5176(%rbx), %eax	# 59	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %eax	# 60	[c=13 l=6]  *cmpsi_1/1
+	jb	.L198	# 61	[c=13 l=2]  *jcc
+	movl	%r12d, %eax	# 146	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %eax	# 63	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 127	[c=5 l=5]  *andsi_1_zext
+	cmpb	$0, 1080(%rbx,%rax)	# 66	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L199	# 67	[c=13 l=2]  *jcc
+.L198:
+	movq	1040(%rbx), %rax	# 71	[c=9 l=7]  *movdi_internal/3
+	movb	%r13b, (%rax,%r12)	# 72	[c=4 l=4]  *movqi_internal/8
+.L200:
+	andl	$63, %ebp	# 83	[c=4 l=3]  *andsi_1/0
+	xorl	%eax, %eax	# 166	[c=4 l=2]  *movdi_xor
+	subl	$1, %ebp	# 84	[c=5 l=3]  addsi_1_zext/0
+	cmpl	$4, %ebp	# 87	[c=4 l=3]  *cmpsi_1/0
+	ja	.L192	# 88	[c=13 l=2]  *jcc
+	leaq	CSWTCH.147(%rip), %rax	# 129	[c=1 l=7]  *movdi_internal/4
+	movl	(%rax,%rbp,4), %eax	# 92	[c=10 l=3]  *movsi_internal/0
+.L192:
+	addq	$24, %rsp	# 157	[c=4 l=4]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	popq	%rbx	# 158	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 32
+	popq	%rbp	# 159	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 24
+	popq	%r12	# 160	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 16
+	popq	%r13	# 161	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 8
+	ret		# 162	[c=0 l=1]  simple_return_internal
+	.p2align 4,,10
+	.p2align 3
+.L199:
+	.cfi_restore_state
+	movl	%r13d, %edx	# 77	[c=4 l=3]  *movsi_internal/0
+	movl	%r12d, %esi	# 78	[c=4 l=3]  *movsi_internal/0
+	movq	%rbx, %rdi	# 79	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 80	[c=0 l=5]  *call
+	jmp	.L200	# 167	[c=1 l=2]  jump
+	.p2align 4,,10
+	.p2align 3
+.L194:
+	movl	%edx, %esi	# 30	[c=4 l=2]  *movsi_internal/0
+	movl	%edx, 12(%rsp)	# 148	[c=4 l=4]  *movsi_internal/1
+	call	data_read_page	# 32	[c=10 l=5]  *call_value
+	movl	12(%rsp), %edx	# 149	[c=9 l=4]  *movsi_internal/0
+	movl	%eax, %ebp	# 33	[c=4 l=2]  *movsi_internal/0
+	jmp	.L195	# 169	[c=1 l=5]  jump
+	.cfi_endproc
+.LFE79:
+	.size	spm_operation, .-spm_operation
+	.section	.rodata.str1.1
+.LC32:
+	.string	"(%s)->%04x "
+.LC33:
+	.string	"(%s)<-%04x "
+	.text
+	.p2align 4
+	.type	do_events, @function
+do_events:
+.LFB207:
+	.cfi_startproc
+	pushq	%r15	# 588	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14	# 589	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13	# 590	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12	# 591	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	pushq	%rbp	# 592	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx	# 593	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	movq	%rdi, %rbx	# 2	[c=4 l=3]  *movdi_internal/3
+	subq	$24, %rsp	# 594	[c=4 l=4]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_def_cfa_offset 80
+	cmpb	$0, 6040(%rdi)	# 12	[c=13 l=7]  *cmpqi_ccno_1/1
+	jne	.L254	# 13	[c=13 l=6]  *jcc
+.L208:
+	movq	%rbx, %rdi	# 42	[c=4 l=3]  *movdi_internal/3
+	call	events_run@PLT	# 43	[c=0 l=5]  *call
+	movq	1040(%rbx), %rax	# 44	[c=9 l=7]  *movdi_internal/3
+	cmpb	$0, 95(%rax)	# 47	[c=13 l=4]  *cmpqi_ccno_1/1
+	jns	.L253	# 48	[c=13 l=6]  *jcc
+	movq	6024(%rbx), %rax	# 55	[c=9 l=7]  *movdi_internal/3
+	cmpq	%rax, 48(%rbx)	# 56	[c=13 l=4]  *cmpdi_1/0
+	je	.L211	# 57	[c=13 l=6]  *jcc
+	movq	%rbx, %rdi	# 59	[c=4 l=3]  *movdi_internal/3
+	call	irq_take@PLT	# 60	[c=10 l=5]  *call_value
+	movl	%eax, %r12d	# 61	[c=4 l=3]  *movsi_internal/0
+	testl	%eax, %eax	# 64	[c=4 l=2]  *cmpsi_ccno_1/0
+	js	.L253	# 65	[c=13 l=6]  *jcc
+	movl	%eax, %esi	# 72	[c=4 l=2]  *movsi_internal/0
+	movq	%rbx, %rdi	# 73	[c=4 l=3]  *movdi_internal/3
+	call	periph_irq_taken@PLT	# 74	[c=0 l=5]  *call
+	movl	%r12d, %esi	# 75	[c=4 l=3]  *movsi_internal/0
+	movq	%rbx, %rdi	# 76	[c=4 l=3]  *movdi_internal/3
+	call	log_add_irq@PLT	# 77	[c=0 l=5]  *call
+	movl	$93, %eax	# 80	[c=4 l=5]  *movsi_internal/0
+	movl	5176(%rbx), %r13d	# 78	[c=9 l=7]  *movsi_internal/0
+	movl	5180(%rbx), %ebp	# 79	[c=9 l=6]  *movsi_internal/0
+	subl	%r13d, %eax	# 81	[c=4 l=3]  *subsi_1/0
+	cmpl	%ebp, %eax	# 82	[c=4 l=2]  *cmpsi_1/0
+	jb	.L213	# 83	[c=13 l=6]  *jcc
+	cmpb	$1, 1082(%rbx)	# 87	[c=13 l=7]  *cmpqi_1/0
+	ja	.L255	# 88	[c=13 l=6]  *jcc
+	movq	1040(%rbx), %rax	# 424	[c=9 l=7]  *movdi_internal/3
+	movzbl	93(%rax), %r14d	# 425	[c=13 l=5]  *zero_extendqisi2/0
+.L217:
+	movzbl	94(%rax), %ebp	# 127	[c=13 l=4]  *zero_extendqisi2/0
+.L218:
+	sall	$8, %ebp	# 130	[c=4 l=3]  *ashlsi3_1/0
+	movl	$93, %edx	# 133	[c=4 l=5]  *movsi_internal/0
+	leaq	.LC32(%rip), %rsi	# 134	[c=1 l=7]  *movdi_internal/4
+	movq	%rbx, %rdi	# 136	[c=4 l=3]  *movdi_internal/3
+	orl	%r14d, %ebp	# 131	[c=4 l=3]  *iorsi_1/0
+	movl	%ebp, %ecx	# 132	[c=4 l=2]  *movsi_internal/0
+	call	log_add_data_mov@PLT	# 137	[c=0 l=5]  *call
+	movl	996(%rbx), %edx	# 139	[c=9 l=6]  *movsi_internal/0
+	movzbl	840(%rbx), %eax	# 141	[c=13 l=7]  *zero_extendqisi2/0
+	leal	1(%rdx,%rax), %eax	# 142	[c=5 l=4]  *leasi
+	cmpl	%eax, %ebp	# 143	[c=4 l=2]  *cmpsi_1/0
+	jb	.L256	# 144	[c=13 l=6]  *jcc
+	cmpl	$95, %ebp	# 488	[c=4 l=3]  *cmpsi_1/0
+	movl	(%rbx), %r13d	# 152	[c=5 l=3]  *movsi_internal/0
+	leaq	.LC30(%rip), %r14	# 4	[c=1 l=7]  *movdi_internal/4
+	movl	%ebp, %edx	# 161	[c=4 l=2]  *movsi_internal/0
+	leaq	.LC31(%rip), %rsi	# 554	[c=1 l=7]  *movdi_internal/4
+	movq	%rbx, %rdi	# 163	[c=4 l=3]  *movdi_internal/3
+	leal	-1(%rbp), %r15d	# 585	[c=4 l=4]  *leasi
+	cmove	%r14, %rsi	# 489	[c=8 l=4]  *movdicc_noc/0
+	movzbl	%r13b, %ecx	# 154	[c=4 l=4]  *zero_extendqisi2/0
+	call	log_add_data_mov@PLT	# 164	[c=0 l=5]  *call
+	movl	%ebp, %edx	# 559	[c=4 l=2]  *movsi_internal/0
+	subl	5176(%rbx), %edx	# 165	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %edx	# 166	[c=13 l=6]  *cmpsi_1/1
+	jb	.L221	# 167	[c=13 l=2]  *jcc
+	movl	%ebp, %edx	# 561	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %edx	# 169	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %edx	# 549	[c=5 l=6]  *andsi_1_zext
+	cmpb	$0, 1080(%rbx,%rdx)	# 172	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L222	# 173	[c=13 l=6]  *jcc
+.L221:
+	movq	1040(%rbx), %rcx	# 177	[c=9 l=7]  *movdi_internal/3
+	movslq	%ebp, %rdx	# 176	[c=4 l=3]  *extendsidi2_rex64/1
+	movb	%r13b, (%rcx,%rdx)	# 178	[c=4 l=4]  *movqi_internal/8
+.L223:
+	movl	(%rbx), %ecx	# 189	[c=5 l=2]  *movsi_internal/0
+	leaq	.LC31(%rip), %rdx	# 551	[c=1 l=7]  *movdi_internal/4
+	movq	%rbx, %rdi	# 201	[c=4 l=3]  *movdi_internal/3
+	leal	-2(%rbp), %r13d	# 584	[c=4 l=4]  *leasi
+	leaq	.LC30(%rip), %rsi	# 550	[c=1 l=7]  *movdi_internal/4
+	movl	%ecx, %eax	# 563	[c=4 l=2]  *movsi_internal/0
+	movzbl	%ch, %ecx	# 192	[c=4 l=3]  *extzvsi
+	shrl	$8, %eax	# 190	[c=4 l=3]  *lshrsi3_1/0
+	cmpl	$95, %r15d	# 455	[c=4 l=4]  *cmpsi_1/0
+	cmovne	%rdx, %rsi	# 456	[c=8 l=4]  *movdicc_noc/1
+	movl	%r15d, %edx	# 199	[c=4 l=3]  *movsi_internal/0
+	movl	%eax, 12(%rsp)	# 564	[c=4 l=4]  *movsi_internal/1
+	call	log_add_data_mov@PLT	# 202	[c=0 l=5]  *call
+	movl	%r15d, %edx	# 565	[c=4 l=3]  *movsi_internal/0
+	subl	5176(%rbx), %edx	# 203	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %edx	# 204	[c=13 l=6]  *cmpsi_1/1
+	jb	.L225	# 205	[c=13 l=2]  *jcc
+	movl	%r15d, %edx	# 567	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %edx	# 207	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %edx	# 548	[c=5 l=6]  *andsi_1_zext
+	cmpb	$0, 1080(%rbx,%rdx)	# 210	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L226	# 211	[c=13 l=6]  *jcc
+.L225:
+	movq	1040(%rbx), %rdx	# 215	[c=9 l=7]  *movdi_internal/3
+	movzbl	12(%rsp), %ecx	# 569	[c=9 l=5]  *movqi_internal/4
+	movslq	%r15d, %rax	# 214	[c=4 l=3]  *extendsidi2_rex64/1
+	movb	%cl, (%rdx,%rax)	# 216	[c=4 l=3]  *movqi_internal/8
+.L227:
+	cmpb	$0, 840(%rbx)	# 227	[c=13 l=7]  *cmpqi_ccno_1/1
+	je	.L228	# 228	[c=13 l=2]  *jcc
+	movl	(%rbx), %r15d	# 570	[c=5 l=3]  *movsi_internal/0
+	leaq	.LC31(%rip), %rax	# 553	[c=1 l=7]  *movdi_internal/4
+	movl	%r13d, %edx	# 239	[c=4 l=3]  *movsi_internal/0
+	movq	%rbx, %rdi	# 241	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC30(%rip), %rsi	# 552	[c=1 l=7]  *movdi_internal/4
+	shrl	$16, %r15d	# 231	[c=4 l=4]  *lshrsi3_1/0
+	cmpl	$95, %r13d	# 459	[c=4 l=4]  *cmpsi_1/0
+	cmovne	%rax, %rsi	# 460	[c=8 l=4]  *movdicc_noc/1
+	movzbl	%r15b, %ecx	# 232	[c=4 l=4]  *zero_extendqisi2/0
+	call	log_add_data_mov@PLT	# 242	[c=0 l=5]  *call
+	movl	%r13d, %eax	# 572	[c=4 l=3]  *movsi_internal/0
+	subl	5176(%rbx), %eax	# 243	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %eax	# 244	[c=13 l=6]  *cmpsi_1/1
+	jb	.L230	# 245	[c=13 l=2]  *jcc
+	movl	%r13d, %eax	# 574	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %eax	# 247	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 547	[c=5 l=5]  *andsi_1_zext
+	cmpb	$0, 1080(%rbx,%rax)	# 250	[c=14 l=8]  *cmpqi_ccno_1/1
+	jne	.L231	# 251	[c=13 l=6]  *jcc
+.L230:
+	movq	1040(%rbx), %rax	# 255	[c=9 l=7]  *movdi_internal/3
+	movslq	%r13d, %r13	# 254	[c=4 l=3]  *extendsidi2_rex64/1
+	movb	%r15b, (%rax,%r13)	# 256	[c=4 l=4]  *movqi_internal/8
+.L232:
+	leal	-3(%rbp), %r13d	# 583	[c=4 l=4]  *leasi
+	.p2align 4,,10
+	.p2align 3
+.L228:
+	movzwl	%r13w, %ebp	# 270	[c=4 l=4]  *zero_extendhisi2/0
+	movl	$93, %edx	# 272	[c=4 l=5]  *movsi_internal/0
+	leaq	.LC33(%rip), %rsi	# 273	[c=1 l=7]  *movdi_internal/4
+	movq	%rbx, %rdi	# 275	[c=4 l=3]  *movdi_internal/3
+	movl	%ebp, %ecx	# 271	[c=4 l=2]  *movsi_internal/0
+	call	log_add_data_mov@PLT	# 276	[c=0 l=5]  *call
+	movl	$93, %eax	# 277	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%rbx), %eax	# 278	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %eax	# 279	[c=13 l=6]  *cmpsi_1/1
+	jb	.L233	# 280	[c=13 l=2]  *jcc
+	cmpb	$1, 1082(%rbx)	# 284	[c=13 l=7]  *cmpqi_1/0
+	ja	.L257	# 285	[c=13 l=6]  *jcc
+.L233:
+	movq	1040(%rbx), %rax	# 296	[c=9 l=7]  *movdi_internal/3
+	movb	%r13b, 93(%rax)	# 297	[c=4 l=4]  *movqi_internal/8
+.L234:
+	movl	$94, %eax	# 301	[c=4 l=5]  *movsi_internal/0
+	sarl	$8, %ebp	# 300	[c=4 l=3]  *ashrsi3_1/0
+	subl	5176(%rbx), %eax	# 302	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %eax	# 303	[c=13 l=6]  *cmpsi_1/1
+	jb	.L235	# 304	[c=13 l=2]  *jcc
+	cmpb	$1, 1082(%rbx)	# 308	[c=13 l=7]  *cmpqi_1/0
+	ja	.L258	# 309	[c=13 l=6]  *jcc
+.L235:
+	movq	1040(%rbx), %rax	# 319	[c=9 l=7]  *movdi_internal/3
+	movb	%bpl, 94(%rax)	# 320	[c=4 l=4]  *movqi_internal/8
+.L236:
+	movl	$95, %eax	# 323	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%rbx), %eax	# 324	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %eax	# 325	[c=13 l=6]  *cmpsi_1/1
+	jb	.L237	# 326	[c=13 l=2]  *jcc
+	cmpb	$0, 1082(%rbx)	# 328	[c=13 l=7]  *cmpqi_ccno_1/1
+	jne	.L238	# 329	[c=13 l=6]  *jcc
+.L237:
+	movq	1040(%rbx), %rax	# 332	[c=9 l=7]  *movdi_internal/3
+	movzbl	95(%rax), %ebp	# 333	[c=13 l=4]  *zero_extendqisi2/0
+.L239:
+	movl	%ebp, %ecx	# 344	[c=4 l=2]  *movsi_internal/0
+	movl	$95, %edx	# 345	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 348	[c=4 l=3]  *movdi_internal/3
+	movl	%ebp, %r13d	# 576	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC28(%rip), %rsi	# 346	[c=1 l=7]  *movdi_internal/4
+	andb	$127, %r13b	# 580	[c=4 l=4]  *andqi_1_slp/0
+	call	log_add_data_mov@PLT	# 349	[c=0 l=5]  *call
+	movl	%ebp, %ecx	# 578	[c=4 l=2]  *movsi_internal/0
+	movl	$95, %edx	# 353	[c=4 l=5]  *movsi_internal/0
+	movq	%r14, %rsi	# 355	[c=4 l=3]  *movdi_internal/3
+	andl	$127, %ecx	# 351	[c=4 l=3]  *andsi_1/0
+	movq	%rbx, %rdi	# 356	[c=4 l=3]  *movdi_internal/3
+	call	log_add_data_mov@PLT	# 357	[c=0 l=5]  *call
+	movl	$95, %eax	# 358	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%rbx), %eax	# 359	[c=13 l=6]  *subsi_1/1
+	cmpl	5180(%rbx), %eax	# 360	[c=13 l=6]  *cmpsi_1/1
+	jb	.L243	# 361	[c=13 l=2]  *jcc
+	movzbl	1082(%rbx), %eax	# 363	[c=9 l=7]  *movqi_internal/4
+	testb	%al, %al	# 364	[c=4 l=2]  *cmpqi_ccno_1/0
+	jne	.L241	# 365	[c=13 l=6]  *jcc
+.L243:
+	movq	1040(%rbx), %rax	# 385	[c=9 l=7]  *movdi_internal/3
+	movb	%r13b, 95(%rax)	# 386	[c=4 l=4]  *movqi_internal/8
+.L242:
+	cmpl	$8192, 880(%rbx)	# 391	[c=13 l=10]  *cmpsi_1/0
+	jbe	.L244	# 392	[c=13 l=2]  *jcc
+	addl	%r12d, %r12d	# 394	[c=4 l=3]  *ashlsi3_1/0
+.L244:
+	movzbl	840(%rbx), %eax	# 399	[c=13 l=7]  zero_extendqidi2/0
+	movl	%r12d, (%rbx)	# 397	[c=4 l=3]  *movsi_internal/1
+	movq	%rbx, %rdi	# 402	[c=4 l=3]  *movdi_internal/3
+	addq	$4, %rax	# 628	[c=4 l=4]  *adddi_1/0
+	addq	%rax, 48(%rbx)	# 401	[c=13 l=4]  *adddi_1/0
+	call	log_dump_irq@PLT	# 403	[c=0 l=5]  *call
+.L253:
+	movq	48(%rbx), %rax	# 404	[c=9 l=4]  *movdi_internal/3
+.L211:
+	cmpq	6032(%rbx), %rax	# 407	[c=13 l=7]  *cmpdi_1/1
+	jnb	.L259	# 408	[c=13 l=2]  *jcc
+	addq	$24, %rsp	# 597	[c=4 l=4]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	popq	%rbx	# 598	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 48
+	popq	%rbp	# 599	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 40
+	popq	%r12	# 600	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 32
+	popq	%r13	# 601	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 24
+	popq	%r14	# 602	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 16
+	popq	%r15	# 603	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 8
+	ret		# 604	[c=0 l=1]  simple_return_internal
+	.p2align 4,,10
+	.p2align 3
+.L254:
+	.cfi_restore_state
+	call	fork_server_poll@PLT	# 20	[c=10 l=5]  *call_value
+	testb	%al, %al	# 23	[c=4 l=2]  *cmpqi_ccno_1/0
+	je	.L208	# 24	[c=13 l=6]  *jcc
+	movq	1040(%rbx), %rax	# 26	[c=9 l=7]  *movdi_internal/3
+	movl	820(%rbx), %edx	# 27	[c=9 l=6]  *movsi_internal/0
+	movb	%dl, 22(%rax)	# 28	[c=4 l=3]  *movqi_internal/8
+	movq	1040(%rbx), %rax	# 29	[c=9 l=7]  *movdi_internal/3
+	movl	820(%rbx), %edx	# 30	[c=9 l=6]  *movsi_internal/0
+	movb	%dh, 23(%rax)	# 629	[c=4 l=3]  *extzvqi_mem_rex64
+	movq	1040(%rbx), %rax	# 33	[c=9 l=7]  *movdi_internal/3
+	movl	816(%rbx), %edx	# 34	[c=9 l=6]  *movsi_internal/0
+	movb	%dl, 24(%rax)	# 35	[c=4 l=3]  *movqi_internal/8
+	movq	1040(%rbx), %rax	# 36	[c=9 l=7]  *movdi_internal/3
+	movl	816(%rbx), %edx	# 37	[c=9 l=6]  *movsi_internal/0
+	movb	%dh, 25(%rax)	# 630	[c=4 l=3]  *extzvqi_mem_rex64
+	jmp	.L208	# 637	[c=1 l=5]  jump
+	.p2align 4,,10
+	.p2align 3
+.L259:
+	movq	%rbx, %rdi	# 410	[c=4 l=3]  *movdi_internal/3
+	call	checkpoint_begin@PLT	# 411	[c=0 l=5]  *call
+	movq	%rbx, %rdi	# 413	[c=4 l=3]  *movdi_internal/3
+	xorl	%esi, %esi	# 627	[c=4 l=2]  *movdi_xor
+	call	log_checkpoint@PLT	# 414	[c=0 l=5]  *call
+	addq	$24, %rsp	# 608	[c=4 l=4]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	movq	%rbx, %rdi	# 415	[c=4 l=3]  *movdi_internal/3
+	popq	%rbx	# 609	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 48
+	popq	%rbp	# 610	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 40
+	popq	%r12	# 611	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 32
+	popq	%r13	# 612	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 24
+	popq	%r14	# 613	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 16
+	popq	%r15	# 614	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 8
+	jmp	checkpoint_end@PLT	# 416	[c=0 l=5]  *sibcall
+	.p2align 4,,10
+	.p2align 3
+.L213:
+	.cfi_restore_state
+	movq	1040(%rbx), %rax	# 103	[c=9 l=7]  *movdi_internal/3
+	movl	$94, %edx	# 105	[c=4 l=5]  *movsi_internal/0
+	subl	%r13d, %edx	# 106	[c=4 l=3]  *subsi_1/0
+	movzbl	93(%rax), %r14d	# 104	[c=13 l=5]  *zero_extendqisi2/0
+	cmpl	%ebp, %edx	# 107	[c=4 l=2]  *cmpsi_1/0
+	jb	.L217	# 108	[c=13 l=6]  *jcc
+	cmpb	$1, 1082(%rbx)	# 112	[c=13 l=7]  *cmpqi_1/0
+	jbe	.L217	# 113	[c=13 l=6]  *jcc
+.L216:
+	movl	$94, %esi	# 116	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 117	[c=4 l=3]  *movdi_internal/3
+	call	data_read_mapped	# 118	[c=10 l=5]  *call_value
+	movl	%eax, %ebp	# 119	[c=4 l=2]  *movsi_internal/0
+	jmp	.L218	# 639	[c=1 l=5]  jump
+	.p2align 4,,10
+	.p2align 3
+.L257:
+	movzbl	%r13b, %edx	# 287	[c=4 l=4]  *zero_extendqisi2/0
+	movl	$93, %esi	# 289	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 290	[c=4 l=3]  *movdi_internal/3
+	call	data_write_mapped	# 291	[c=0 l=5]  *call
+	jmp	.L234	# 641	[c=1 l=5]  jump
+	.p2align 4,,10
+	.p2align 3
+.L258:
+	movl	%ebp, %edx	# 311	[c=4 l=2]  *movsi_internal/0
+	movl	$94, %esi	# 312	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 313	[c=4 l=3]  *movdi_internal/3
+	call	data_write_mapped	# 314	[c=0 l=5]  *call
+	jmp	.L236	# 643	[c=1 l=5]  jump
+	.p2align 4,,10
+	.p2align 3
+.L231:
+	movl	%r15d, %edx	# 261	[c=4 l=3]  *movsi_internal/0
+	movl	%r13d, %esi	# 262	[c=4 l=3]  *movsi_internal/0
+	movq	%rbx, %rdi	# 263	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 264	[c=0 l=5]  *call
+	jmp	.L232	# 645	[c=1 l=5]  jump
+	.p2align 4,,10
+	.p2align 3
+.L226:
+	movl	12(%rsp), %edx	# 221	[c=9 l=4]  *movsi_internal/0
+	movl	%r15d, %esi	# 222	[c=4 l=3]  *movsi_internal/0
+	movq	%rbx, %rdi	# 223	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 224	[c=0 l=5]  *call
+	jmp	.L227	# 647	[c=1 l=5]  jump
+	.p2align 4,,10
+	.p2align 3
+.L222:
+	movl	%r13d, %edx	# 183	[c=4 l=3]  *movsi_internal/0
+	movl	%ebp, %esi	# 184	[c=4 l=2]  *movsi_internal/0
+	movq	%rbx, %rdi	# 185	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 186	[c=0 l=5]  *call
+	jmp	.L223	# 649	[c=1 l=5]  jump
+	.p2align 4,,10
+	.p2align 3
+.L238:
+	movl	$95, %esi	# 338	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 339	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 340	[c=10 l=5]  *call_value
+	movl	%eax, %ebp	# 341	[c=4 l=2]  *movsi_internal/0
+	jmp	.L239	# 651	[c=1 l=5]  jump
+	.p2align 4,,10
+	.p2align 3
+.L255:
+	movl	$93, %esi	# 90	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 91	[c=4 l=3]  *movdi_internal/3
+	call	data_read_mapped	# 92	[c=10 l=5]  *call_value
+	movl	%eax, %r14d	# 93	[c=4 l=3]  *movsi_internal/0
+	movl	$94, %eax	# 94	[c=4 l=5]  *movsi_internal/0
+	subl	%r13d, %eax	# 95	[c=4 l=3]  *subsi_1/0
+	cmpl	%ebp, %eax	# 96	[c=4 l=2]  *cmpsi_1/0
+	jnb	.L216	# 97	[c=13 l=6]  *jcc
+	movq	1040(%rbx), %rax	# 124	[c=9 l=7]  *movdi_internal/3
+	jmp	.L217	# 653	[c=1 l=5]  jump
+	.p2align 4,,10
+	.p2align 3
+.L241:
+	cmpb	$1, %al	# 374	[c=4 l=2]  *cmpqi_1/0
+	je	.L243	# 375	[c=13 l=6]  *jcc
+	movl	%r13d, %edx	# 377	[c=4 l=3]  *movsi_internal/0
+	movl	$95, %esi	# 378	[c=4 l=5]  *movsi_internal/0
+	movq	%rbx, %rdi	# 379	[c=4 l=3]  *movdi_internal/3
+	call	data_write_mapped	# 380	[c=0 l=5]  *call
+	jmp	.L242	# 655	[c=1 l=5]  jump
+.L256:
+	movl	%ebp, %esi	# 146	[c=4 l=2]  *movsi_internal/0
+	movq	%rbx, %rdi	# 147	[c=4 l=3]  *movdi_internal/3
+	call	stack_overflow	# 148	[c=0 l=5]  *call
+	.cfi_endproc
+.LFE207:
+	.size	do_events, .-do_events
+	.section	.rodata.str1.1
+.LC34:
+	.string	".word 0x%04x"
+.LC35:
+	.string	"illegal opcode 0x%04x"
+.LC36:
+	.string	"opcode 0x%04x illegal on %s"
+	.section	.rodata.str1.8
+	.align 8
+.LC37:
+	.string	"opcode 0x%04x not yet supported"
+	.section	.rodata.str1.1
+.LC38:
+	.string	"in func_ILLEGAL"
+	.section	.rodata.str1.8
+	.align 8
+.LC39:
+	.string	"%-7s .word 0x%04x: undefined operand combination: %s overlaps R%d"
+	.align 8
+.LC40:
+	.string	"opcode 0x%04x has undefined result (%s overlaps R%d)"
+	.section	.rodata.str1.1
+.LC41:
+	.string	"#%d: "
+.LC42:
+	.string	"not implemented "
+.LC43:
+	.string	"(R%d)->%02x "
+.LC44:
+	.string	"(R%d)->%04x "
+.LC45:
+	.string	"IRQ %d in %u cycles"
+.LC46:
+	.string	"bad IRQ vector %d"
+.LC47:
+	.string	"-no-args "
+.LC48:
+	.string	"(R%d)<-%04x "
+.LC49:
+	.string	"-args ... "
+.LC50:
+	.string	"stdin "
+.LC51:
+	.string	"-no-stdin"
+.LC52:
+	.string	"stdout "
+.LC53:
+	.string	"-no-stdout"
+.LC54:
+	.string	"exit %d: "
+.LC55:
+	.string	"exit %d function called"
+.LC56:
+	.string	"abort"
+.LC57:
+	.string	"abort function called"
+	.section	.rodata.str1.8
+	.align 8
+.LC58:
+	.string	"instruction count limit reached"
+	.section	.rodata.str1.1
+.LC59:
+	.string	"(R%d)<-%02x "
+.LC60:
+	.string	"(###)->%02x "
+.LC61:
+	.string	"{erase %05x} "
+.LC62:
+	.string	"{write %05x} "
+	.section	.rodata.str1.8
+	.align 8
+.LC63:
+	.string	"infinite loop detected (normal exit)"
+	.align 8
+.LC64:
+	.string	"deadlock: sleeping with no wake source"
+	.section	.rodata.str1.1
+.LC65:
+	.string	"slept %lu cycles "
+	.text
+	.p2align 4
+	.type	execute, @function
+execute:
+.LFB211:
+	.cfi_startproc
+	pushq	%r15	# 17776	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	pushq	%r14	# 17777	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	pushq	%r13	# 17778	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	pushq	%r12	# 17779	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	movq	%rdi, %r12	# 2	[c=4 l=3]  *movdi_internal/3
+	pushq	%rbp	# 17780	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	pushq	%rbx	# 17781	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$40, %rsp	# 17782	[c=4 l=4]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_def_cfa_offset 96
+	movq	32(%rdi), %rax	# 121	[c=9 l=4]  *movdi_internal/3
+	movq	%rax, (%rsp)	# 15826	[c=4 l=4]  *movdi_internal/5
+	call	log_is_idle@PLT	# 123	[c=10 l=5]  *call_value
+	testb	%al, %al	# 125	[c=4 l=2]  *cmpqi_ccno_1/0
+	jne	.L1332	# 126	[c=13 l=2]  *jcc
+.L261:
+	movl	(%r12), %r8d	# 137	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r12, %rdi	# 142	[c=4 l=3]  *movdi_internal/3
+	leaq	opcodes(%rip), %rbx	# 147	[c=1 l=7]  *movdi_internal/4
+	salq	$4, %r8	# 138	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r12), %r8	# 140	[c=13 l=8]  *adddi_1/1
+	movq	%r8, %rbp	# 15828	[c=4 l=3]  *movdi_internal/3
+	movq	%r8, %rsi	# 141	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 143	[c=0 l=5]  *call
+	movzbl	9(%rbp), %eax	# 144	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, (%r12)	# 145	[c=9 l=4]  *addsi_1/0
+	leaq	handler.1(%rip), %rdi	# 15831	[c=1 l=7]  *movdi_internal/4
+	movzbl	8(%rbp), %eax	# 148	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 15829	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 149	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbx,%rdx), %rdx	# 152	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r12)	# 153	[c=13 l=5]  *adddi_1/0
+	jmp	*(%rdi,%rax,8)	# 18802	[c=10 l=3]  *indirect_jump
+.L1332:
+	movb	$1, 11032(%r12)	# 128	[c=4 l=9]  *movqi_internal/8
+	movq	%r12, %rdi	# 131	[c=4 l=3]  *movdi_internal/3
+	movzbl	11037(%r12), %esi	# 129	[c=13 l=9]  *zero_extendqisi2/0
+	call	execute_lean@PLT	# 132	[c=0 l=5]  *call
+	movq	%r12, %rdi	# 133	[c=4 l=3]  *movdi_internal/3
+	call	perf_lean_resume@PLT	# 134	[c=0 l=5]  *call
+	jmp	.L261	# 18804	[c=1 l=2]  jump
+.L1041:
+.L1220:
+	movl	(%r12), %eax	# 16095	[c=5 l=4]  *movsi_internal/0
+	movq	1056(%r12), %rdx	# 3596	[c=9 l=8]  *movdi_internal/3
+	leaq	.LC34(%rip), %rsi	# 3599	[c=1 l=7]  *movdi_internal/4
+	movq	%r12, %rdi	# 3601	[c=4 l=3]  *movdi_internal/3
+	subl	$1, %eax	# 3592	[c=4 l=3]  *addsi_1/0
+	movl	%eax, (%r12)	# 3593	[c=4 l=4]  *movsi_internal/1
+	addl	%eax, %eax	# 3594	[c=5 l=2]  *ashlsi3_1_zext/0
+	movzwl	(%rdx,%rax), %ebx	# 3597	[c=13 l=4]  *zero_extendhisi2/0
+	xorl	%eax, %eax	# 18683	[c=4 l=2]  *movdi_xor
+	movl	%ebx, %edx	# 3598	[c=4 l=2]  *movsi_internal/0
+	call	log_append@PLT	# 3603	[c=0 l=5]  *call
+	movq	832(%r12), %r8	# 3605	[c=9 l=8]  *movdi_internal/3
+	movl	%ebx, %ecx	# 3606	[c=4 l=2]  *movsi_internal/0
+.L1219:
+	leaq	.LC36(%rip), %rdx	# 3607	[c=1 l=7]  *movdi_internal/4
+	movl	$1, %esi	# 3609	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 3610	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 18682	[c=4 l=2]  *movdi_xor
+	call	leave	# 3612	[c=0 l=5]  *call
+.L263:
+	movl	(%r12), %esi	# 161	[c=5 l=4]  *movsi_internal/0
+	movq	%r12, %rdi	# 162	[c=4 l=3]  *movdi_internal/3
+	call	bad_PC	# 163	[c=0 l=5]  *call
+.L264:
+	movzwl	12(%rbp), %edx	# 173	[c=13 l=4]  *zero_extendhisi2/0
+	movl	(%r12), %eax	# 15832	[c=5 l=4]  *movsi_internal/0
+	movq	%r12, %rdi	# 184	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC34(%rip), %rsi	# 182	[c=1 l=7]  *movdi_internal/4
+	movzbl	10(%rbp), %ebx	# 172	[c=9 l=4]  *movqi_internal/4
+	subl	%edx, %eax	# 175	[c=4 l=2]  *subsi_1/0
+	movq	1056(%r12), %rdx	# 179	[c=9 l=8]  *movdi_internal/3
+	movl	%eax, (%r12)	# 176	[c=4 l=4]  *movsi_internal/1
+	addl	%eax, %eax	# 177	[c=5 l=2]  *ashlsi3_1_zext/0
+	movzwl	(%rdx,%rax), %ebp	# 180	[c=13 l=4]  *zero_extendhisi2/0
+	xorl	%eax, %eax	# 18801	[c=4 l=2]  *movdi_xor
+	movl	%ebp, %edx	# 181	[c=4 l=2]  *movsi_internal/0
+	call	log_append@PLT	# 186	[c=0 l=5]  *call
+	cmpb	$1, %bl	# 187	[c=4 l=3]  *cmpqi_1/0
+	je	.L265	# 188	[c=13 l=6]  *jcc
+	cmpb	$2, %bl	# 190	[c=4 l=3]  *cmpqi_1/0
+	je	.L266	# 191	[c=13 l=6]  *jcc
+	testb	%bl, %bl	# 193	[c=4 l=2]  *cmpqi_ccno_1/0
+	je	.L1333	# 194	[c=13 l=6]  *jcc
+	leaq	.LC38(%rip), %rdx	# 232	[c=1 l=7]  *movdi_internal/4
+	movl	$8, %esi	# 234	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 235	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 18798	[c=4 l=2]  *movdi_xor
+	call	leave	# 237	[c=0 l=5]  *call
+.L268:
+	movzwl	12(%rbp), %r13d	# 241	[c=13 l=5]  *zero_extendhisi2/0
+	movl	%r13d, %eax	# 15834	[c=4 l=3]  *movsi_internal/0
+	sarl	$4, %eax	# 242	[c=4 l=3]  *ashrsi3_1/0
+	andl	$31, %eax	# 243	[c=4 l=3]  *andsi_1/0
+	movl	%eax, %r14d	# 15837	[c=4 l=3]  *movsi_internal/0
+	movzbl	10(%rbp), %eax	# 246	[c=13 l=4]  zero_extendqidi2/0
+	salq	$4, %rax	# 247	[c=4 l=4]  *ashldi3_1/0
+	movq	(%rbx,%rax), %rbx	# 249	[c=9 l=4]  *movdi_internal/3
+	movq	%rbx, %rdi	# 250	[c=4 l=3]  *movdi_internal/3
+	call	strlen@PLT	# 251	[c=10 l=5]  *call_value
+	movl	%r14d, %r9d	# 257	[c=4 l=3]  *movsi_internal/0
+	movl	%r13d, %ecx	# 259	[c=4 l=3]  *movsi_internal/0
+	movq	%rbx, %rdx	# 260	[c=4 l=3]  *movdi_internal/3
+	leaq	-2(%rbx,%rax), %r8	# 258	[c=5 l=5]  *leadi
+	leaq	.LC39(%rip), %rsi	# 261	[c=1 l=7]  *movdi_internal/4
+	movq	%r12, %rdi	# 263	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 18796	[c=4 l=2]  *movdi_xor
+	call	log_append@PLT	# 265	[c=0 l=5]  *call
+	movl	%r14d, %r9d	# 266	[c=4 l=3]  *movsi_internal/0
+	movq	%rbx, %r8	# 267	[c=4 l=3]  *movdi_internal/3
+	movl	%r13d, %ecx	# 268	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC40(%rip), %rdx	# 269	[c=1 l=7]  *movdi_internal/4
+	movl	$1, %esi	# 271	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 272	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 18797	[c=4 l=2]  *movdi_xor
+	call	leave	# 274	[c=0 l=5]  *call
+.L269:
+	movzbl	10(%rbp), %r13d	# 278	[c=13 l=5]  zero_extendqidi2/0
+	xorl	%eax, %eax	# 18795	[c=4 l=2]  *movdi_xor
+	leaq	.LC41(%rip), %rsi	# 281	[c=1 l=7]  *movdi_internal/4
+	movq	%r12, %rdi	# 283	[c=4 l=3]  *movdi_internal/3
+	movl	%r13d, %edx	# 280	[c=4 l=3]  *movsi_internal/0
+	call	log_append@PLT	# 285	[c=0 l=5]  *call
+	cmpb	$31, %r13b	# 288	[c=4 l=4]  *cmpqi_1/0
+	ja	.L270	# 289	[c=13 l=6]  *jcc
+	leaq	.L272(%rip), %rdx	# 291	[c=1 l=7]  *movdi_internal/4
+	movslq	(%rdx,%r13,4), %rax	# 293	[c=14 l=4]  *extendsidi2_rex64/1
+	addq	%rdx, %rax	# 295	[c=4 l=3]  *adddi_1/0
+	jmp	*%rax	# 296	[c=4 l=2]  *tablejump_1
+	.section	.rodata
+	.align 4
+	.align 4
+.L272:
+	.long	.L278-.L272
+	.long	.L278-.L272
+	.long	.L278-.L272
+	.long	.L278-.L272
+	.long	.L278-.L272
+	.long	.L278-.L272
+	.long	.L278-.L272
+	.long	.L278-.L272
+	.long	.L270-.L272
+	.long	.L270-.L272
+	.long	.L270-.L272
+	.long	.L270-.L272
+	.long	.L270-.L272
+	.long	.L270-.L272
+	.long	.L270-.L272
+	.long	.L270-.L272
+	.long	.L270-.L272
+	.long	.L270-.L272
+	.long	.L270-.L272
+	.long	.L270-.L272
+	.long	.L270-.L272
+	.long	.L270-.L272
+	.long	.L270-.L272
+	.long	.L270-.L272
+	.long	.L270-.L272
+	.long	.L270-.L272
+	.long	.L277-.L272
+	.long	.L276-.L272
+	.long	.L275-.L272
+	.long	.L274-.L272
+	.long	.L273-.L272
+	.long	.L271-.L272
+	.text
+.L290:
+	movq	1040(%r12), %rax	# 698	[c=9 l=8]  *movdi_internal/3
+	movzbl	10(%rbp), %r9d	# 696	[c=13 l=5]  zero_extendqidi2/0
+	leaq	.LC43(%rip), %rsi	# 706	[c=1 l=7]  *movdi_internal/4
+	movzwl	12(%rbp), %r15d	# 695	[c=9 l=5]  *movhi_internal/2
+	movzbl	95(%rax), %edx	# 699	[c=9 l=4]  *movqi_internal/4
+	movzbl	(%rax,%r9), %ecx	# 703	[c=13 l=5]  *zero_extendqisi2/0
+	xorl	%eax, %eax	# 18756	[c=4 l=2]  *movdi_xor
+	movq	%r9, %r14	# 17647	[c=4 l=3]  *movdi_internal/3
+	movl	%r9d, 24(%rsp)	# 17056	[c=4 l=5]  *movsi_internal/1
+	movl	%edx, %edi	# 15852	[c=4 l=2]  *movsi_internal/0
+	movl	%r9d, %edx	# 705	[c=4 l=3]  *movsi_internal/0
+	andl	$1, %edi	# 701	[c=4 l=3]  *andsi_1/0
+	movl	%edi, 8(%rsp)	# 15853	[c=4 l=4]  *movsi_internal/1
+	movq	%r12, %rdi	# 708	[c=4 l=3]  *movdi_internal/3
+	call	log_append@PLT	# 710	[c=0 l=5]  *call
+	movzwl	%r15w, %r11d	# 713	[c=4 l=4]  zero_extendhidi2/0
+	movzwl	%r15w, %edx	# 715	[c=4 l=4]  *zero_extendhisi2/0
+	movq	%r12, %rdi	# 720	[c=4 l=3]  *movdi_internal/3
+	movq	1040(%r12), %rax	# 711	[c=9 l=8]  *movdi_internal/3
+	leaq	.LC43(%rip), %rsi	# 17055	[c=1 l=7]  *movdi_internal/4
+	movq	%r11, 16(%rsp)	# 17052	[c=4 l=5]  *movdi_internal/5
+	movzbl	(%rax,%r11), %ecx	# 714	[c=13 l=5]  *zero_extendqisi2/0
+	movzbl	(%rax,%r14), %r13d	# 712	[c=9 l=5]  *movqi_internal/4
+	xorl	%eax, %eax	# 18757	[c=4 l=2]  *movdi_xor
+	call	log_append@PLT	# 722	[c=0 l=5]  *call
+	movq	16(%rsp), %r11	# 17053	[c=9 l=5]  *movdi_internal/3
+	movl	8(%rsp), %edi	# 15854	[c=9 l=4]  *movsi_internal/0
+	leaq	.LC59(%rip), %rsi	# 732	[c=1 l=7]  *movdi_internal/4
+	movq	1040(%r12), %rax	# 723	[c=9 l=8]  *movdi_internal/3
+	movl	24(%rsp), %edx	# 18758	[c=9 l=4]  *movsi_internal/0
+	movzbl	(%rax,%r11), %r11d	# 724	[c=13 l=5]  *zero_extendqisi2/0
+	movzbl	%r13b, %eax	# 726	[c=4 l=4]  *zero_extendqisi2/0
+	andl	$136, %r13d	# 740	[c=4 l=7]  *andsi_1/0
+	movl	%r11d, %r15d	# 17648	[c=4 l=3]  *movsi_internal/0
+	addl	%eax, %r11d	# 727	[c=4 l=3]  *addsi_1/0
+	xorl	%eax, %eax	# 18759	[c=4 l=2]  *movdi_xor
+	andl	$136, %r15d	# 743	[c=4 l=7]  *andsi_1/0
+	addl	%edi, %r11d	# 728	[c=4 l=3]  *addsi_1/0
+	movq	%r12, %rdi	# 734	[c=4 l=3]  *movdi_internal/3
+	leal	(%r15,%r13,2), %r13d	# 744	[c=8 l=4]  *leasi
+	movzbl	%r11b, %ecx	# 729	[c=4 l=4]  *zero_extendqisi2/0
+	movl	%r11d, 8(%rsp)	# 17050	[c=4 l=5]  *movsi_internal/1
+	call	log_append@PLT	# 736	[c=0 l=5]  *call
+	imull	$260, %r13d, %r13d	# 745	[c=12 l=7]  *mulsi3_1/1
+	movl	8(%rsp), %r11d	# 17051	[c=9 l=5]  *movsi_internal/0
+	movq	1040(%r12), %rax	# 737	[c=9 l=8]  *movdi_internal/3
+	movb	%r11b, (%rax,%r14)	# 738	[c=4 l=4]  *movqi_internal/8
+	movl	$95, %eax	# 748	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r12), %eax	# 749	[c=13 l=8]  *subsi_1/1
+	andl	$7680, %r13d	# 746	[c=4 l=7]  *andsi_1/0
+	orl	%r11d, %r13d	# 747	[c=5 l=3]  *iorsi_1_zext
+	cmpl	5180(%r12), %eax	# 750	[c=13 l=8]  *cmpsi_1/1
+	jb	.L291	# 751	[c=13 l=2]  *jcc
+	cmpb	$0, 1082(%r12)	# 753	[c=13 l=9]  *cmpqi_ccno_1/1
+	jne	.L292	# 754	[c=13 l=6]  *jcc
+.L291:
+	movq	1040(%r12), %rax	# 757	[c=9 l=8]  *movdi_internal/3
+	movzbl	95(%rax), %r14d	# 758	[c=13 l=5]  *zero_extendqisi2/0
+.L293:
+	movl	%r14d, %ecx	# 769	[c=4 l=3]  *movsi_internal/0
+	movl	$95, %edx	# 770	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 773	[c=4 l=3]  *movdi_internal/3
+	andl	$-64, %r14d	# 775	[c=4 l=4]  *andsi_1/0
+	leaq	.LC28(%rip), %rsi	# 771	[c=1 l=7]  *movdi_internal/4
+	call	log_add_data_mov@PLT	# 774	[c=0 l=5]  *call
+	leaq	flag_update_table_add8(%rip), %rax	# 15671	[c=1 l=7]  *movdi_internal/4
+	movl	$95, %edx	# 782	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 785	[c=4 l=3]  *movdi_internal/3
+	movzbl	(%rax,%r13), %eax	# 778	[c=13 l=5]  *zero_extendqisi2/0
+	leaq	.LC30(%rip), %rsi	# 783	[c=1 l=7]  *movdi_internal/4
+	orl	%eax, %r14d	# 779	[c=4 l=3]  *iorsi_1/0
+	movzbl	%r14b, %ecx	# 780	[c=4 l=4]  *zero_extendqisi2/0
+	call	log_add_data_mov@PLT	# 786	[c=0 l=5]  *call
+	movl	$95, %eax	# 787	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r12), %eax	# 788	[c=13 l=8]  *subsi_1/1
+	cmpl	5180(%r12), %eax	# 789	[c=13 l=8]  *cmpsi_1/1
+	jb	.L294	# 790	[c=13 l=2]  *jcc
+	cmpb	$0, 1082(%r12)	# 792	[c=13 l=9]  *cmpqi_ccno_1/1
+	jne	.L295	# 793	[c=13 l=6]  *jcc
+.L294:
+	movq	1040(%r12), %rax	# 796	[c=9 l=8]  *movdi_internal/3
+	movb	%r14b, 95(%rax)	# 797	[c=4 l=4]  *movqi_internal/8
+.L296:
+	movq	%r12, %rdi	# 809	[c=4 l=3]  *movdi_internal/3
+	movq	%rbp, %rsi	# 808	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 810	[c=0 l=5]  *call
+	movq	40(%r12), %rax	# 15855	[c=9 l=5]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 15856	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 812	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 17432	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r12)	# 813	[c=4 l=5]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 816	[c=4 l=3]  *cmpdi_1/0
+	jb	.L297	# 817	[c=13 l=6]  *jcc
+	movl	(%r12), %r8d	# 819	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r12, %rdi	# 824	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r8	# 820	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r12), %r8	# 822	[c=13 l=8]  *adddi_1/1
+	movq	%r8, %rbp	# 15858	[c=4 l=3]  *movdi_internal/3
+	movq	%r8, %rsi	# 823	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 825	[c=0 l=5]  *call
+	movzbl	9(%rbp), %eax	# 826	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, (%r12)	# 827	[c=9 l=4]  *addsi_1/0
+	leaq	handler.1(%rip), %rdi	# 15861	[c=1 l=7]  *movdi_internal/4
+	movzbl	8(%rbp), %eax	# 830	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 15859	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 831	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbx,%rdx), %rdx	# 834	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r12)	# 835	[c=13 l=5]  *adddi_1/0
+	jmp	*(%rdi,%rax,8)	# 18755	[c=10 l=3]  *indirect_jump
+.L298:
+	movzbl	10(%rbp), %r11d	# 844	[c=13 l=5]  zero_extendqidi2/0
+	movzwl	12(%rbp), %r15d	# 843	[c=9 l=5]  *movhi_internal/2
+	movq	%r12, %rdi	# 853	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC43(%rip), %rsi	# 851	[c=1 l=7]  *movdi_internal/4
+	movq	1040(%r12), %rax	# 847	[c=9 l=8]  *movdi_internal/3
+	movl	%r11d, %edx	# 850	[c=4 l=3]  *movsi_internal/0
+	movq	%r11, %r14	# 17649	[c=4 l=3]  *movdi_internal/3
+	movl	%r11d, 16(%rsp)	# 17066	[c=4 l=5]  *movsi_internal/1
+	movzbl	(%rax,%r11), %ecx	# 848	[c=13 l=5]  *zero_extendqisi2/0
+	xorl	%eax, %eax	# 18751	[c=4 l=2]  *movdi_xor
+	call	log_append@PLT	# 855	[c=0 l=5]  *call
+	movzwl	%r15w, %r9d	# 858	[c=4 l=4]  zero_extendhidi2/0
+	movzwl	%r15w, %edx	# 860	[c=4 l=4]  *zero_extendhisi2/0
+	movq	%r12, %rdi	# 865	[c=4 l=3]  *movdi_internal/3
+	movq	1040(%r12), %rax	# 856	[c=9 l=8]  *movdi_internal/3
+	leaq	.LC43(%rip), %rsi	# 17065	[c=1 l=7]  *movdi_internal/4
+	movq	%r9, 8(%rsp)	# 17062	[c=4 l=5]  *movdi_internal/5
+	movzbl	(%rax,%r9), %ecx	# 859	[c=13 l=5]  *zero_extendqisi2/0
+	movzbl	(%rax,%r14), %r13d	# 857	[c=9 l=5]  *movqi_internal/4
+	xorl	%eax, %eax	# 18752	[c=4 l=2]  *movdi_xor
+	call	log_append@PLT	# 867	[c=0 l=5]  *call
+	movq	1040(%r12), %rax	# 868	[c=9 l=8]  *movdi_internal/3
+	movq	8(%rsp), %r9	# 17063	[c=9 l=5]  *movdi_internal/3
+	movq	%r12, %rdi	# 879	[c=4 l=3]  *movdi_internal/3
+	movl	16(%rsp), %edx	# 18753	[c=9 l=4]  *movsi_internal/0
+	leaq	.LC59(%rip), %rsi	# 877	[c=1 l=7]  *movdi_internal/4
+	movzbl	(%rax,%r9), %r9d	# 869	[c=13 l=5]  *zero_extendqisi2/0
+	movzbl	%r13b, %eax	# 871	[c=4 l=4]  *zero_extendqisi2/0
+	movl	%r9d, %r15d	# 17650	[c=4 l=3]  *movsi_internal/0
+	addl	%eax, %r9d	# 872	[c=4 l=3]  *addsi_1/0
+	xorl	%eax, %eax	# 18754	[c=4 l=2]  *movdi_xor
+	movzbl	%r9b, %ecx	# 874	[c=4 l=4]  *zero_extendqisi2/0
+	movl	%r9d, 8(%rsp)	# 17059	[c=4 l=5]  *movsi_internal/1
+	call	log_append@PLT	# 881	[c=0 l=5]  *call
+	leal	(%r15,%r13), %edi	# 17431	[c=4 l=4]  *leasi
+	movl	8(%rsp), %r9d	# 17060	[c=9 l=5]  *movsi_internal/0
+	movq	1040(%r12), %rax	# 882	[c=9 l=8]  *movdi_internal/3
+	andl	$136, %r13d	# 885	[c=4 l=7]  *andsi_1/0
+	andl	$136, %r15d	# 888	[c=4 l=7]  *andsi_1/0
+	movb	%dil, (%rax,%r14)	# 883	[c=4 l=4]  *movqi_internal/8
+	leal	(%r15,%r13,2), %eax	# 889	[c=8 l=4]  *leasi
+	imull	$260, %eax, %eax	# 890	[c=12 l=6]  *mulsi3_1/1
+	andl	$7680, %eax	# 891	[c=4 l=5]  *andsi_1/0
+	orl	%r9d, %eax	# 892	[c=4 l=3]  *iorsi_1/0
+	movl	%eax, %r13d	# 15865	[c=4 l=3]  *movsi_internal/0
+	movl	$95, %eax	# 893	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r12), %eax	# 894	[c=13 l=8]  *subsi_1/1
+	cmpl	5180(%r12), %eax	# 895	[c=13 l=8]  *cmpsi_1/1
+	jb	.L299	# 896	[c=13 l=2]  *jcc
+	cmpb	$0, 1082(%r12)	# 898	[c=13 l=9]  *cmpqi_ccno_1/1
+	jne	.L300	# 899	[c=13 l=6]  *jcc
+.L299:
+	movq	1040(%r12), %rax	# 902	[c=9 l=8]  *movdi_internal/3
+	movzbl	95(%rax), %r14d	# 903	[c=13 l=5]  *zero_extendqisi2/0
+.L301:
+	movl	%r14d, %ecx	# 914	[c=4 l=3]  *movsi_internal/0
+	movl	$95, %edx	# 915	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 918	[c=4 l=3]  *movdi_internal/3
+	andl	$-64, %r14d	# 923	[c=4 l=4]  *andsi_1/0
+	leaq	.LC28(%rip), %rsi	# 916	[c=1 l=7]  *movdi_internal/4
+	call	log_add_data_mov@PLT	# 919	[c=0 l=5]  *call
+	movl	%r13d, %eax	# 921	[c=1 l=3]  *zero_extendsidi2/3
+	leaq	flag_update_table_add8(%rip), %rdx	# 15672	[c=1 l=7]  *movdi_internal/4
+	movq	%r12, %rdi	# 930	[c=4 l=3]  *movdi_internal/3
+	movzbl	(%rdx,%rax), %r13d	# 922	[c=13 l=5]  *zero_extendqisi2/0
+	leaq	.LC30(%rip), %rsi	# 928	[c=1 l=7]  *movdi_internal/4
+	movl	$95, %edx	# 927	[c=4 l=5]  *movsi_internal/0
+	orl	%r14d, %r13d	# 924	[c=4 l=3]  *iorsi_1/0
+	movzbl	%r13b, %ecx	# 925	[c=4 l=4]  *zero_extendqisi2/0
+	call	log_add_data_mov@PLT	# 931	[c=0 l=5]  *call
+	movl	$95, %eax	# 932	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r12), %eax	# 933	[c=13 l=8]  *subsi_1/1
+	cmpl	5180(%r12), %eax	# 934	[c=13 l=8]  *cmpsi_1/1
+	jb	.L302	# 935	[c=13 l=2]  *jcc
+	cmpb	$0, 1082(%r12)	# 937	[c=13 l=9]  *cmpqi_ccno_1/1
+	jne	.L303	# 938	[c=13 l=6]  *jcc
+.L302:
+	movq	1040(%r12), %rax	# 941	[c=9 l=8]  *movdi_internal/3
+	movb	%r13b, 95(%rax)	# 942	[c=4 l=4]  *movqi_internal/8
+.L304:
+	movq	%r12, %rdi	# 954	[c=4 l=3]  *movdi_internal/3
+	movq	%rbp, %rsi	# 953	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 955	[c=0 l=5]  *call
+	movq	40(%r12), %rax	# 15866	[c=9 l=5]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 15867	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 957	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 17429	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r12)	# 958	[c=4 l=5]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 960	[c=4 l=3]  *cmpdi_1/0
+	jb	.L297	# 961	[c=13 l=6]  *jcc
+	movl	(%r12), %r8d	# 963	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r12, %rdi	# 968	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r8	# 964	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r12), %r8	# 966	[c=13 l=8]  *adddi_1/1
+	movq	%r8, %rbp	# 15869	[c=4 l=3]  *movdi_internal/3
+	movq	%r8, %rsi	# 967	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 969	[c=0 l=5]  *call
+	movzbl	9(%rbp), %eax	# 970	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, (%r12)	# 971	[c=9 l=4]  *addsi_1/0
+	leaq	handler.1(%rip), %rdi	# 15872	[c=1 l=7]  *movdi_internal/4
+	movzbl	8(%rbp), %eax	# 974	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 15870	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 975	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbx,%rdx), %rdx	# 978	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r12)	# 979	[c=13 l=5]  *adddi_1/0
+	jmp	*(%rdi,%rax,8)	# 18750	[c=10 l=3]  *indirect_jump
+.L305:
+	movzwl	12(%rbp), %r15d	# 987	[c=13 l=5]  *zero_extendhisi2/0
+	movzbl	10(%rbp), %r14d	# 988	[c=13 l=5]  *zero_extendqisi2/0
+	xorl	%eax, %eax	# 18744	[c=4 l=2]  *movdi_xor
+	movq	%r12, %rdi	# 993	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC60(%rip), %rsi	# 991	[c=1 l=7]  *movdi_internal/4
+	movl	%r15d, %edx	# 990	[c=4 l=3]  *movsi_internal/0
+	call	log_append@PLT	# 995	[c=0 l=5]  *call
+	movzbl	%r14b, %r9d	# 997	[c=4 l=4]  zero_extendqidi2/0
+	movl	%r14d, %edx	# 1004	[c=4 l=3]  *movsi_internal/0
+	movq	%r12, %rdi	# 1007	[c=4 l=3]  *movdi_internal/3
+	movq	1040(%r12), %rax	# 996	[c=9 l=8]  *movdi_internal/3
+	leaq	.LC44(%rip), %rsi	# 1005	[c=1 l=7]  *movdi_internal/4
+	movq	%r9, 16(%rsp)	# 17070	[c=4 l=5]  *movdi_internal/5
+	movzbl	1(%rax,%r9), %r13d	# 999	[c=14 l=6]  *zero_extendqisi2/0
+	movzbl	(%rax,%r9), %eax	# 1001	[c=13 l=5]  *zero_extendqisi2/0
+	sall	$8, %r13d	# 1000	[c=4 l=4]  *ashlsi3_1/0
+	orl	%eax, %r13d	# 1002	[c=4 l=3]  *iorsi_1/0
+	xorl	%eax, %eax	# 18745	[c=4 l=2]  *movdi_xor
+	movl	%r13d, %ecx	# 1003	[c=4 l=3]  *movsi_internal/0
+	call	log_append@PLT	# 1009	[c=0 l=5]  *call
+	leal	(%r15,%r13), %r11d	# 17426	[c=4 l=4]  *leasi
+	movl	%r14d, %edx	# 1013	[c=4 l=3]  *movsi_internal/0
+	xorl	%eax, %eax	# 18746	[c=4 l=2]  *movdi_xor
+	movzwl	%r11w, %r15d	# 1011	[c=4 l=4]  *zero_extendhisi2/0
+	leaq	.LC48(%rip), %rsi	# 1014	[c=1 l=7]  *movdi_internal/4
+	movq	%r12, %rdi	# 1016	[c=4 l=3]  *movdi_internal/3
+	movl	%r11d, 8(%rsp)	# 17068	[c=4 l=5]  *movsi_internal/1
+	movl	%r15d, %ecx	# 1012	[c=4 l=3]  *movsi_internal/0
+	call	log_append@PLT	# 1018	[c=0 l=5]  *call
+	movl	8(%rsp), %r11d	# 17069	[c=9 l=5]  *movsi_internal/0
+	movq	16(%rsp), %r9	# 17071	[c=9 l=5]  *movdi_internal/3
+	movq	1040(%r12), %rax	# 1019	[c=9 l=8]  *movdi_internal/3
+	movl	%r11d, %edx	# 15873	[c=4 l=3]  *movsi_internal/0
+	movb	%r11b, (%rax,%r9)	# 1020	[c=4 l=4]  *movqi_internal/8
+	movq	1040(%r12), %rax	# 1022	[c=9 l=8]  *movdi_internal/3
+	sarl	$8, %edx	# 1021	[c=4 l=3]  *ashrsi3_1/0
+	movb	%dl, 1(%rax,%r9)	# 1023	[c=4 l=5]  *movqi_internal/8
+	movl	%r13d, %eax	# 15875	[c=4 l=3]  *movsi_internal/0
+	shrl	$5, %eax	# 1026	[c=4 l=3]  *lshrsi3_1/0
+	andl	$1024, %eax	# 1027	[c=4 l=5]  *andsi_1/0
+	orl	%edx, %eax	# 1028	[c=4 l=2]  *iorsi_1/0
+	leaq	flag_update_table_add8(%rip), %rdx	# 15673	[c=1 l=7]  *movdi_internal/4
+	cltq	# 1029	[c=4 l=2]  *extendsidi2_rex64/0
+	movzbl	(%rdx,%rax), %r14d	# 1030	[c=13 l=5]  *zero_extendqisi2/0
+	xorl	%eax, %eax	# 18747	[c=4 l=2]  *movsi_xor
+	testl	%r15d, %r15d	# 18748	[c=4 l=3]  *cmpsi_ccno_1/0
+	setne	%al	# 18749	[c=4 l=3]  *setcc_qi_slp
+	addl	%eax, %eax	# 1034	[c=4 l=2]  *ashlsi3_1/0
+	notl	%eax	# 1035	[c=4 l=2]  *one_cmplsi2_1/0
+	andl	%eax, %r14d	# 1036	[c=4 l=3]  *andsi_1/0
+	movl	$95, %eax	# 1038	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r12), %eax	# 1039	[c=13 l=8]  *subsi_1/1
+	andl	$-33, %r14d	# 1037	[c=4 l=4]  *andsi_1/0
+	cmpl	5180(%r12), %eax	# 1040	[c=13 l=8]  *cmpsi_1/1
+	jb	.L306	# 1041	[c=13 l=2]  *jcc
+	cmpb	$0, 1082(%r12)	# 1043	[c=13 l=9]  *cmpqi_ccno_1/1
+	jne	.L307	# 1044	[c=13 l=6]  *jcc
+.L306:
+	movq	1040(%r12), %rax	# 1047	[c=9 l=8]  *movdi_internal/3
+	movzbl	95(%rax), %r13d	# 1048	[c=13 l=5]  *zero_extendqisi2/0
+.L308:
+	movl	%r13d, %ecx	# 1059	[c=4 l=3]  *movsi_internal/0
+	andl	$-32, %r13d	# 1065	[c=4 l=4]  *andsi_1/0
+	movl	$95, %edx	# 1060	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 1063	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC28(%rip), %rsi	# 1061	[c=1 l=7]  *movdi_internal/4
+	orl	%r14d, %r13d	# 1066	[c=4 l=3]  *iorsi_1/0
+	call	log_add_data_mov@PLT	# 1064	[c=0 l=5]  *call
+	movzbl	%r13b, %ecx	# 1067	[c=4 l=4]  *zero_extendqisi2/0
+	movl	$95, %edx	# 1069	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 1072	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC30(%rip), %rsi	# 1070	[c=1 l=7]  *movdi_internal/4
+	call	log_add_data_mov@PLT	# 1073	[c=0 l=5]  *call
+	movl	$95, %eax	# 1074	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r12), %eax	# 1075	[c=13 l=8]  *subsi_1/1
+	cmpl	5180(%r12), %eax	# 1076	[c=13 l=8]  *cmpsi_1/1
+	jb	.L309	# 1077	[c=13 l=2]  *jcc
+	cmpb	$0, 1082(%r12)	# 1079	[c=13 l=9]  *cmpqi_ccno_1/1
+	jne	.L310	# 1080	[c=13 l=6]  *jcc
+.L309:
+	movq	1040(%r12), %rax	# 1083	[c=9 l=8]  *movdi_internal/3
+	movb	%r13b, 95(%rax)	# 1084	[c=4 l=4]  *movqi_internal/8
+.L311:
+	movq	%r12, %rdi	# 1096	[c=4 l=3]  *movdi_internal/3
+	movq	%rbp, %rsi	# 1095	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 1097	[c=0 l=5]  *call
+	movq	40(%r12), %rax	# 15877	[c=9 l=5]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 15878	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 1099	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 17425	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r12)	# 1100	[c=4 l=5]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 1102	[c=4 l=3]  *cmpdi_1/0
+	jb	.L297	# 1103	[c=13 l=6]  *jcc
+	movl	(%r12), %r8d	# 1105	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r12, %rdi	# 1110	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r8	# 1106	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r12), %r8	# 1108	[c=13 l=8]  *adddi_1/1
+	movq	%r8, %rbp	# 15880	[c=4 l=3]  *movdi_internal/3
+	movq	%r8, %rsi	# 1109	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 1111	[c=0 l=5]  *call
+	movzbl	9(%rbp), %eax	# 1112	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, (%r12)	# 1113	[c=9 l=4]  *addsi_1/0
+	leaq	handler.1(%rip), %rdi	# 15883	[c=1 l=7]  *movdi_internal/4
+	movzbl	8(%rbp), %eax	# 1116	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 15881	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 1117	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbx,%rdx), %rdx	# 1120	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r12)	# 1121	[c=13 l=5]  *adddi_1/0
+	jmp	*(%rdi,%rax,8)	# 18743	[c=10 l=3]  *indirect_jump
+.L312:
+	movzwl	12(%rbp), %r15d	# 1129	[c=13 l=5]  *zero_extendhisi2/0
+	movzbl	10(%rbp), %r14d	# 1130	[c=13 l=5]  *zero_extendqisi2/0
+	xorl	%eax, %eax	# 18737	[c=4 l=2]  *movdi_xor
+	movq	%r12, %rdi	# 1135	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC60(%rip), %rsi	# 1133	[c=1 l=7]  *movdi_internal/4
+	movl	%r15d, %edx	# 1132	[c=4 l=3]  *movsi_internal/0
+	call	log_append@PLT	# 1137	[c=0 l=5]  *call
+	movzbl	%r14b, %r9d	# 1139	[c=4 l=4]  zero_extendqidi2/0
+	movl	%r14d, %edx	# 1146	[c=4 l=3]  *movsi_internal/0
+	movq	%r12, %rdi	# 1149	[c=4 l=3]  *movdi_internal/3
+	movq	1040(%r12), %rax	# 1138	[c=9 l=8]  *movdi_internal/3
+	leaq	.LC44(%rip), %rsi	# 1147	[c=1 l=7]  *movdi_internal/4
+	movq	%r9, 16(%rsp)	# 17074	[c=4 l=5]  *movdi_internal/5
+	movzbl	1(%rax,%r9), %r13d	# 1141	[c=14 l=6]  *zero_extendqisi2/0
+	movzbl	(%rax,%r9), %eax	# 1143	[c=13 l=5]  *zero_extendqisi2/0
+	sall	$8, %r13d	# 1142	[c=4 l=4]  *ashlsi3_1/0
+	orl	%eax, %r13d	# 1144	[c=4 l=3]  *iorsi_1/0
+	xorl	%eax, %eax	# 18738	[c=4 l=2]  *movdi_xor
+	movl	%r13d, %ecx	# 1145	[c=4 l=3]  *movsi_internal/0
+	call	log_append@PLT	# 1151	[c=0 l=5]  *call
+	movl	%r13d, %r11d	# 15884	[c=4 l=3]  *movsi_internal/0
+	movl	%r14d, %edx	# 1155	[c=4 l=3]  *movsi_internal/0
+	xorl	%eax, %eax	# 18739	[c=4 l=2]  *movdi_xor
+	subl	%r15d, %r11d	# 1152	[c=4 l=3]  *subsi_1/0
+	leaq	.LC48(%rip), %rsi	# 1156	[c=1 l=7]  *movdi_internal/4
+	movq	%r12, %rdi	# 1158	[c=4 l=3]  *movdi_internal/3
+	movzwl	%r11w, %r15d	# 1153	[c=4 l=4]  *zero_extendhisi2/0
+	movl	%r11d, 8(%rsp)	# 17072	[c=4 l=5]  *movsi_internal/1
+	movl	%r15d, %ecx	# 1154	[c=4 l=3]  *movsi_internal/0
+	call	log_append@PLT	# 1160	[c=0 l=5]  *call
+	movl	8(%rsp), %r11d	# 17073	[c=9 l=5]  *movsi_internal/0
+	movq	16(%rsp), %r9	# 17075	[c=9 l=5]  *movdi_internal/3
+	movq	1040(%r12), %rax	# 1161	[c=9 l=8]  *movdi_internal/3
+	movl	%r11d, %edx	# 15886	[c=4 l=3]  *movsi_internal/0
+	movb	%r11b, (%rax,%r9)	# 1162	[c=4 l=4]  *movqi_internal/8
+	movq	1040(%r12), %rax	# 1164	[c=9 l=8]  *movdi_internal/3
+	sarl	$8, %edx	# 1163	[c=4 l=3]  *ashrsi3_1/0
+	movb	%dl, 1(%rax,%r9)	# 1165	[c=4 l=5]  *movqi_internal/8
+	movl	%r13d, %eax	# 15888	[c=4 l=3]  *movsi_internal/0
+	andl	$511, %edx	# 1170	[c=4 l=6]  *andsi_1/0
+	shrl	$5, %eax	# 1168	[c=4 l=3]  *lshrsi3_1/0
+	andl	$1024, %eax	# 1169	[c=4 l=5]  *andsi_1/0
+	orl	%edx, %eax	# 1171	[c=4 l=2]  *iorsi_1/0
+	leaq	flag_update_table_sub8(%rip), %rdx	# 15674	[c=1 l=7]  *movdi_internal/4
+	cltq	# 1172	[c=4 l=2]  *extendsidi2_rex64/0
+	movzbl	(%rdx,%rax), %r14d	# 1173	[c=13 l=5]  *zero_extendqisi2/0
+	xorl	%eax, %eax	# 18740	[c=4 l=2]  *movsi_xor
+	testl	%r15d, %r15d	# 18741	[c=4 l=3]  *cmpsi_ccno_1/0
+	setne	%al	# 18742	[c=4 l=3]  *setcc_qi_slp
+	addl	%eax, %eax	# 1177	[c=4 l=2]  *ashlsi3_1/0
+	notl	%eax	# 1178	[c=4 l=2]  *one_cmplsi2_1/0
+	andl	%eax, %r14d	# 1179	[c=4 l=3]  *andsi_1/0
+	movl	$95, %eax	# 1181	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r12), %eax	# 1182	[c=13 l=8]  *subsi_1/1
+	andl	$-33, %r14d	# 1180	[c=4 l=4]  *andsi_1/0
+	cmpl	5180(%r12), %eax	# 1183	[c=13 l=8]  *cmpsi_1/1
+	jb	.L313	# 1184	[c=13 l=2]  *jcc
+	cmpb	$0, 1082(%r12)	# 1186	[c=13 l=9]  *cmpqi_ccno_1/1
+	jne	.L314	# 1187	[c=13 l=6]  *jcc
+.L313:
+	movq	1040(%r12), %rax	# 1190	[c=9 l=8]  *movdi_internal/3
+	movzbl	95(%rax), %r13d	# 1191	[c=13 l=5]  *zero_extendqisi2/0
+.L315:
+	movl	%r13d, %ecx	# 1202	[c=4 l=3]  *movsi_internal/0
+	andl	$-32, %r13d	# 1208	[c=4 l=4]  *andsi_1/0
+	movl	$95, %edx	# 1203	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 1206	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC28(%rip), %rsi	# 1204	[c=1 l=7]  *movdi_internal/4
+	orl	%r14d, %r13d	# 1209	[c=4 l=3]  *iorsi_1/0
+	call	log_add_data_mov@PLT	# 1207	[c=0 l=5]  *call
+	movzbl	%r13b, %ecx	# 1210	[c=4 l=4]  *zero_extendqisi2/0
+	movl	$95, %edx	# 1212	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 1215	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC30(%rip), %rsi	# 1213	[c=1 l=7]  *movdi_internal/4
+	call	log_add_data_mov@PLT	# 1216	[c=0 l=5]  *call
+	movl	$95, %eax	# 1217	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r12), %eax	# 1218	[c=13 l=8]  *subsi_1/1
+	cmpl	5180(%r12), %eax	# 1219	[c=13 l=8]  *cmpsi_1/1
+	jb	.L316	# 1220	[c=13 l=2]  *jcc
+	cmpb	$0, 1082(%r12)	# 1222	[c=13 l=9]  *cmpqi_ccno_1/1
+	jne	.L317	# 1223	[c=13 l=6]  *jcc
+.L316:
+	movq	1040(%r12), %rax	# 1226	[c=9 l=8]  *movdi_internal/3
+	movb	%r13b, 95(%rax)	# 1227	[c=4 l=4]  *movqi_internal/8
+.L318:
+	movq	%r12, %rdi	# 1239	[c=4 l=3]  *movdi_internal/3
+	movq	%rbp, %rsi	# 1238	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 1240	[c=0 l=5]  *call
+	movq	40(%r12), %rax	# 15890	[c=9 l=5]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 15891	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 1242	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 17422	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r12)	# 1243	[c=4 l=5]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 1245	[c=4 l=3]  *cmpdi_1/0
+	jb	.L297	# 1246	[c=13 l=6]  *jcc
+	movl	(%r12), %r8d	# 1248	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r12, %rdi	# 1253	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r8	# 1249	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r12), %r8	# 1251	[c=13 l=8]  *adddi_1/1
+	movq	%r8, %rbp	# 15893	[c=4 l=3]  *movdi_internal/3
+	movq	%r8, %rsi	# 1252	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 1254	[c=0 l=5]  *call
+	movzbl	9(%rbp), %eax	# 1255	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, (%r12)	# 1256	[c=9 l=4]  *addsi_1/0
+	leaq	handler.1(%rip), %rdi	# 15896	[c=1 l=7]  *movdi_internal/4
+	movzbl	8(%rbp), %eax	# 1259	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 15894	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 1260	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbx,%rdx), %rdx	# 1263	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r12)	# 1264	[c=13 l=5]  *adddi_1/0
+	jmp	*(%rdi,%rax,8)	# 18736	[c=10 l=3]  *indirect_jump
+.L319:
+	movzbl	10(%rbp), %r9d	# 1273	[c=13 l=5]  zero_extendqidi2/0
+	movzwl	12(%rbp), %r15d	# 1272	[c=9 l=5]  *movhi_internal/2
+	movq	%r12, %rdi	# 1282	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC43(%rip), %rsi	# 1280	[c=1 l=7]  *movdi_internal/4
+	movq	1040(%r12), %rax	# 1276	[c=9 l=8]  *movdi_internal/3
+	movl	%r9d, %edx	# 1279	[c=4 l=3]  *movsi_internal/0
+	movq	%r9, %r13	# 17653	[c=4 l=3]  *movdi_internal/3
+	movl	%r9d, 16(%rsp)	# 17080	[c=4 l=5]  *movsi_internal/1
+	movzbl	(%rax,%r9), %ecx	# 1277	[c=13 l=5]  *zero_extendqisi2/0
+	xorl	%eax, %eax	# 18732	[c=4 l=2]  *movdi_xor
+	call	log_append@PLT	# 1284	[c=0 l=5]  *call
+	movzwl	%r15w, %r11d	# 1287	[c=4 l=4]  zero_extendhidi2/0
+	movzwl	%r15w, %edx	# 1289	[c=4 l=4]  *zero_extendhisi2/0
+	movq	%r12, %rdi	# 1294	[c=4 l=3]  *movdi_internal/3
+	movq	1040(%r12), %rax	# 1285	[c=9 l=8]  *movdi_internal/3
+	leaq	.LC43(%rip), %rsi	# 17079	[c=1 l=7]  *movdi_internal/4
+	movq	%r11, 8(%rsp)	# 17076	[c=4 l=5]  *movdi_internal/5
+	movzbl	(%rax,%r11), %ecx	# 1288	[c=13 l=5]  *zero_extendqisi2/0
+	movzbl	(%rax,%r13), %r14d	# 1286	[c=9 l=5]  *movqi_internal/4
+	xorl	%eax, %eax	# 18733	[c=4 l=2]  *movdi_xor
+	call	log_append@PLT	# 1296	[c=0 l=5]  *call
+	movq	8(%rsp), %r11	# 17077	[c=9 l=5]  *movdi_internal/3
+	movl	%r14d, %r15d	# 15897	[c=4 l=3]  *movqi_internal/2
+	movq	%r12, %rdi	# 1304	[c=4 l=3]  *movdi_internal/3
+	movq	1040(%r12), %rax	# 1297	[c=9 l=8]  *movdi_internal/3
+	movl	16(%rsp), %edx	# 18734	[c=9 l=4]  *movsi_internal/0
+	leaq	.LC59(%rip), %rsi	# 1302	[c=1 l=7]  *movdi_internal/4
+	andb	(%rax,%r11), %r15b	# 1298	[c=13 l=4]  *andqi_1/1
+	xorl	%eax, %eax	# 18735	[c=4 l=2]  *movdi_xor
+	movzbl	%r15b, %r14d	# 1299	[c=4 l=4]  zero_extendqidi2/0
+	movl	%r14d, %ecx	# 1300	[c=4 l=3]  *movsi_internal/0
+	call	log_append@PLT	# 1306	[c=0 l=5]  *call
+	movq	1040(%r12), %rax	# 1307	[c=9 l=8]  *movdi_internal/3
+	movb	%r15b, (%rax,%r13)	# 1308	[c=4 l=4]  *movqi_internal/8
+	movl	$95, %eax	# 1309	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r12), %eax	# 1310	[c=13 l=8]  *subsi_1/1
+	cmpl	5180(%r12), %eax	# 1311	[c=13 l=8]  *cmpsi_1/1
+	jb	.L320	# 1312	[c=13 l=2]  *jcc
+	cmpb	$0, 1082(%r12)	# 1314	[c=13 l=9]  *cmpqi_ccno_1/1
+	jne	.L321	# 1315	[c=13 l=6]  *jcc
+.L320:
+	movq	1040(%r12), %rax	# 1318	[c=9 l=8]  *movdi_internal/3
+	movzbl	95(%rax), %r13d	# 1319	[c=13 l=5]  *zero_extendqisi2/0
+.L322:
+	movl	%r13d, %ecx	# 1330	[c=4 l=3]  *movsi_internal/0
+	movl	$95, %edx	# 1331	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 1334	[c=4 l=3]  *movdi_internal/3
+	andl	$-31, %r13d	# 1336	[c=4 l=4]  *andsi_1/0
+	leaq	.LC28(%rip), %rsi	# 1332	[c=1 l=7]  *movdi_internal/4
+	call	log_add_data_mov@PLT	# 1335	[c=0 l=5]  *call
+	leaq	flag_update_table_logical(%rip), %rax	# 15675	[c=1 l=7]  *movdi_internal/4
+	movl	$95, %edx	# 1343	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 1346	[c=4 l=3]  *movdi_internal/3
+	movzbl	(%rax,%r14), %eax	# 1339	[c=13 l=5]  *zero_extendqisi2/0
+	leaq	.LC30(%rip), %rsi	# 1344	[c=1 l=7]  *movdi_internal/4
+	orl	%eax, %r13d	# 1340	[c=4 l=3]  *iorsi_1/0
+	movzbl	%r13b, %ecx	# 1341	[c=4 l=4]  *zero_extendqisi2/0
+	call	log_add_data_mov@PLT	# 1347	[c=0 l=5]  *call
+	movl	$95, %eax	# 1348	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r12), %eax	# 1349	[c=13 l=8]  *subsi_1/1
+	cmpl	5180(%r12), %eax	# 1350	[c=13 l=8]  *cmpsi_1/1
+	jb	.L323	# 1351	[c=13 l=2]  *jcc
+	cmpb	$0, 1082(%r12)	# 1353	[c=13 l=9]  *cmpqi_ccno_1/1
+	jne	.L324	# 1354	[c=13 l=6]  *jcc
+.L323:
+	movq	1040(%r12), %rax	# 1357	[c=9 l=8]  *movdi_internal/3
+	movb	%r13b, 95(%rax)	# 1358	[c=4 l=4]  *movqi_internal/8
+.L325:
+	movq	%r12, %rdi	# 1370	[c=4 l=3]  *movdi_internal/3
+	movq	%rbp, %rsi	# 1369	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 1371	[c=0 l=5]  *call
+	movq	40(%r12), %rax	# 15899	[c=9 l=5]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 15900	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 1373	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 17421	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r12)	# 1374	[c=4 l=5]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 1376	[c=4 l=3]  *cmpdi_1/0
+	jb	.L297	# 1377	[c=13 l=6]  *jcc
+	movl	(%r12), %r8d	# 1379	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r12, %rdi	# 1384	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r8	# 1380	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r12), %r8	# 1382	[c=13 l=8]  *adddi_1/1
+	movq	%r8, %rbp	# 15902	[c=4 l=3]  *movdi_internal/3
+	movq	%r8, %rsi	# 1383	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 1385	[c=0 l=5]  *call
+	movzbl	9(%rbp), %eax	# 1386	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, (%r12)	# 1387	[c=9 l=4]  *addsi_1/0
+	leaq	handler.1(%rip), %rdi	# 15905	[c=1 l=7]  *movdi_internal/4
+	movzbl	8(%rbp), %eax	# 1390	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 15903	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 1391	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbx,%rdx), %rdx	# 1394	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r12)	# 1395	[c=13 l=5]  *adddi_1/0
+	jmp	*(%rdi,%rax,8)	# 18731	[c=10 l=3]  *indirect_jump
+.L326:
+	movzwl	12(%rbp), %r13d	# 1403	[c=13 l=5]  *zero_extendhisi2/0
+	movq	%r12, %rdi	# 1409	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 18728	[c=4 l=2]  *movdi_xor
+	movzbl	10(%rbp), %r14d	# 1404	[c=13 l=5]  zero_extendqidi2/0
+	leaq	.LC60(%rip), %rsi	# 1407	[c=1 l=7]  *movdi_internal/4
+	movl	%r13d, %edx	# 1406	[c=4 l=3]  *movsi_internal/0
+	call	log_append@PLT	# 1411	[c=0 l=5]  *call
+	movq	1040(%r12), %rax	# 1413	[c=9 l=8]  *movdi_internal/3
+	movl	%r14d, %edx	# 1416	[c=4 l=3]  *movsi_internal/0
+	movq	%r12, %rdi	# 1419	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC43(%rip), %rsi	# 1417	[c=1 l=7]  *movdi_internal/4
+	movzbl	(%rax,%r14), %ecx	# 1414	[c=13 l=5]  *zero_extendqisi2/0
+	xorl	%eax, %eax	# 18729	[c=4 l=2]  *movdi_xor
+	call	log_append@PLT	# 1421	[c=0 l=5]  *call
+	movq	1040(%r12), %rax	# 1422	[c=9 l=8]  *movdi_internal/3
+	movl	%r14d, %edx	# 1426	[c=4 l=3]  *movsi_internal/0
+	movq	%r12, %rdi	# 1429	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC59(%rip), %rsi	# 1427	[c=1 l=7]  *movdi_internal/4
+	movzbl	(%rax,%r14), %eax	# 1423	[c=13 l=5]  *zero_extendqisi2/0
+	andl	%eax, %r13d	# 1424	[c=4 l=3]  *andsi_1/0
+	xorl	%eax, %eax	# 18730	[c=4 l=2]  *movdi_xor
+	movl	%r13d, %ecx	# 1425	[c=4 l=3]  *movsi_internal/0
+	call	log_append@PLT	# 1431	[c=0 l=5]  *call
+	movq	1040(%r12), %rax	# 1432	[c=9 l=8]  *movdi_internal/3
+	movb	%r13b, (%rax,%r14)	# 1433	[c=4 l=4]  *movqi_internal/8
+	movl	$95, %eax	# 1434	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r12), %eax	# 1435	[c=13 l=8]  *subsi_1/1
+	cmpl	5180(%r12), %eax	# 1436	[c=13 l=8]  *cmpsi_1/1
+	jb	.L327	# 1437	[c=13 l=2]  *jcc
+	cmpb	$0, 1082(%r12)	# 1439	[c=13 l=9]  *cmpqi_ccno_1/1
+	jne	.L328	# 1440	[c=13 l=6]  *jcc
+.L327:
+	movq	1040(%r12), %rax	# 1443	[c=9 l=8]  *movdi_internal/3
+	movzbl	95(%rax), %r14d	# 1444	[c=13 l=5]  *zero_extendqisi2/0
+.L329:
+	movl	%r14d, %ecx	# 1455	[c=4 l=3]  *movsi_internal/0
+	movl	$95, %edx	# 1456	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 1459	[c=4 l=3]  *movdi_internal/3
+	movslq	%r13d, %r13	# 1463	[c=4 l=3]  *extendsidi2_rex64/1
+	leaq	.LC28(%rip), %rsi	# 1457	[c=1 l=7]  *movdi_internal/4
+	andl	$-31, %r14d	# 1461	[c=4 l=4]  *andsi_1/0
+	call	log_add_data_mov@PLT	# 1460	[c=0 l=5]  *call
+	leaq	flag_update_table_logical(%rip), %rax	# 15676	[c=1 l=7]  *movdi_internal/4
+	movl	$95, %edx	# 1468	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 1471	[c=4 l=3]  *movdi_internal/3
+	movzbl	(%rax,%r13), %eax	# 1464	[c=13 l=5]  *zero_extendqisi2/0
+	leaq	.LC30(%rip), %rsi	# 1469	[c=1 l=7]  *movdi_internal/4
+	orl	%eax, %r14d	# 1465	[c=4 l=3]  *iorsi_1/0
+	movzbl	%r14b, %ecx	# 1466	[c=4 l=4]  *zero_extendqisi2/0
+	call	log_add_data_mov@PLT	# 1472	[c=0 l=5]  *call
+	movl	$95, %eax	# 1473	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r12), %eax	# 1474	[c=13 l=8]  *subsi_1/1
+	cmpl	5180(%r12), %eax	# 1475	[c=13 l=8]  *cmpsi_1/1
+	jb	.L330	# 1476	[c=13 l=2]  *jcc
+	cmpb	$0, 1082(%r12)	# 1478	[c=13 l=9]  *cmpqi_ccno_1/1
+	jne	.L331	# 1479	[c=13 l=6]  *jcc
+.L330:
+	movq	1040(%r12), %rax	# 1482	[c=9 l=8]  *movdi_internal/3
+	movb	%r14b, 95(%rax)	# 1483	[c=4 l=4]  *movqi_internal/8
+.L332:
+	movq	%r12, %rdi	# 1495	[c=4 l=3]  *movdi_internal/3
+	movq	%rbp, %rsi	# 1494	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 1496	[c=0 l=5]  *call
+	movq	40(%r12), %rax	# 15906	[c=9 l=5]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 15907	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 1498	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 17420	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r12)	# 1499	[c=4 l=5]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 1501	[c=4 l=3]  *cmpdi_1/0
+	jb	.L297	# 1502	[c=13 l=6]  *jcc
+	movl	(%r12), %r8d	# 1504	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r12, %rdi	# 1509	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r8	# 1505	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r12), %r8	# 1507	[c=13 l=8]  *adddi_1/1
+	movq	%r8, %rbp	# 15909	[c=4 l=3]  *movdi_internal/3
+	movq	%r8, %rsi	# 1508	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 1510	[c=0 l=5]  *call
+	movzbl	9(%rbp), %eax	# 1511	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, (%r12)	# 1512	[c=9 l=4]  *addsi_1/0
+	leaq	handler.1(%rip), %rdi	# 15912	[c=1 l=7]  *movdi_internal/4
+	movzbl	8(%rbp), %eax	# 1515	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 15910	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 1516	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbx,%rdx), %rdx	# 1519	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r12)	# 1520	[c=13 l=5]  *adddi_1/0
+	jmp	*(%rdi,%rax,8)	# 18727	[c=10 l=3]  *indirect_jump
+.L333:
+	movzbl	10(%rbp), %edx	# 1528	[c=13 l=4]  zero_extendqidi2/0
+	movq	1040(%r12), %rax	# 1531	[c=9 l=8]  *movdi_internal/3
+	leaq	.LC43(%rip), %rsi	# 1535	[c=1 l=7]  *movdi_internal/4
+	movq	%r12, %rdi	# 1537	[c=4 l=3]  *movdi_internal/3
+	movzbl	(%rax,%rdx), %ecx	# 1532	[c=13 l=4]  *zero_extendqisi2/0
+	xorl	%eax, %eax	# 18725	[c=4 l=2]  *movdi_xor
+	movq	%rdx, %r13	# 17655	[c=4 l=3]  *movdi_internal/3
+	movl	%edx, 8(%rsp)	# 17082	[c=4 l=4]  *movsi_internal/1
+	call	log_append@PLT	# 1539	[c=0 l=5]  *call
+	movq	1040(%r12), %rax	# 1540	[c=9 l=8]  *movdi_internal/3
+	movl	8(%rsp), %edx	# 17083	[c=9 l=4]  *movsi_internal/0
+	movq	%r12, %rdi	# 1548	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC59(%rip), %rsi	# 1546	[c=1 l=7]  *movdi_internal/4
+	movsbl	(%rax,%r13), %r14d	# 1541	[c=13 l=5]  extendqisi2
+	xorl	%eax, %eax	# 18726	[c=4 l=2]  *movdi_xor
+	andl	$511, %r14d	# 1542	[c=4 l=7]  *andsi_1/0
+	movl	%r14d, %r15d	# 15913	[c=4 l=3]  *movsi_internal/0
+	sarl	%r15d	# 1543	[c=4 l=3]  *ashrsi3_1/0
+	movl	%r15d, %ecx	# 1544	[c=4 l=3]  *movsi_internal/0
+	call	log_append@PLT	# 1550	[c=0 l=5]  *call
+	movq	1040(%r12), %rax	# 1551	[c=9 l=8]  *movdi_internal/3
+	movb	%r15b, (%rax,%r13)	# 1552	[c=4 l=4]  *movqi_internal/8
+	movl	$95, %eax	# 1553	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r12), %eax	# 1554	[c=13 l=8]  *subsi_1/1
+	cmpl	5180(%r12), %eax	# 1555	[c=13 l=8]  *cmpsi_1/1
+	jb	.L334	# 1556	[c=13 l=2]  *jcc
+	cmpb	$0, 1082(%r12)	# 1558	[c=13 l=9]  *cmpqi_ccno_1/1
+	jne	.L335	# 1559	[c=13 l=6]  *jcc
+.L334:
+	movq	1040(%r12), %rax	# 1562	[c=9 l=8]  *movdi_internal/3
+	movzbl	95(%rax), %r13d	# 1563	[c=13 l=5]  *zero_extendqisi2/0
+.L336:
+	movl	%r13d, %ecx	# 1574	[c=4 l=3]  *movsi_internal/0
+	movl	$95, %edx	# 1575	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 1578	[c=4 l=3]  *movdi_internal/3
+	movslq	%r14d, %r14	# 1582	[c=4 l=3]  *extendsidi2_rex64/1
+	leaq	.LC28(%rip), %rsi	# 1576	[c=1 l=7]  *movdi_internal/4
+	andl	$-32, %r13d	# 1580	[c=4 l=4]  *andsi_1/0
+	call	log_add_data_mov@PLT	# 1579	[c=0 l=5]  *call
+	leaq	flag_update_table_ror8(%rip), %rax	# 15677	[c=1 l=7]  *movdi_internal/4
+	movl	$95, %edx	# 1587	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 1590	[c=4 l=3]  *movdi_internal/3
+	movzbl	(%rax,%r14), %eax	# 1583	[c=13 l=5]  *zero_extendqisi2/0
+	leaq	.LC30(%rip), %rsi	# 1588	[c=1 l=7]  *movdi_internal/4
+	orl	%eax, %r13d	# 1584	[c=4 l=3]  *iorsi_1/0
+	movzbl	%r13b, %ecx	# 1585	[c=4 l=4]  *zero_extendqisi2/0
+	call	log_add_data_mov@PLT	# 1591	[c=0 l=5]  *call
+	movl	$95, %eax	# 1592	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r12), %eax	# 1593	[c=13 l=8]  *subsi_1/1
+	cmpl	5180(%r12), %eax	# 1594	[c=13 l=8]  *cmpsi_1/1
+	jb	.L337	# 1595	[c=13 l=2]  *jcc
+	cmpb	$0, 1082(%r12)	# 1597	[c=13 l=9]  *cmpqi_ccno_1/1
+	jne	.L338	# 1598	[c=13 l=6]  *jcc
+.L337:
+	movq	1040(%r12), %rax	# 1601	[c=9 l=8]  *movdi_internal/3
+	movb	%r13b, 95(%rax)	# 1602	[c=4 l=4]  *movqi_internal/8
+.L339:
+	movq	%r12, %rdi	# 1614	[c=4 l=3]  *movdi_internal/3
+	movq	%rbp, %rsi	# 1613	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 1615	[c=0 l=5]  *call
+	movq	40(%r12), %rax	# 15915	[c=9 l=5]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 15916	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 1617	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 17419	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r12)	# 1618	[c=4 l=5]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 1620	[c=4 l=3]  *cmpdi_1/0
+	jb	.L297	# 1621	[c=13 l=6]  *jcc
+	movl	(%r12), %r8d	# 1623	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r12, %rdi	# 1628	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r8	# 1624	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r12), %r8	# 1626	[c=13 l=8]  *adddi_1/1
+	movq	%r8, %rbp	# 15918	[c=4 l=3]  *movdi_internal/3
+	movq	%r8, %rsi	# 1627	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 1629	[c=0 l=5]  *call
+	movzbl	9(%rbp), %eax	# 1630	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, (%r12)	# 1631	[c=9 l=4]  *addsi_1/0
+	leaq	handler.1(%rip), %rdi	# 15921	[c=1 l=7]  *movdi_internal/4
+	movzbl	8(%rbp), %eax	# 1634	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 15919	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 1635	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbx,%rdx), %rdx	# 1638	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r12)	# 1639	[c=13 l=5]  *adddi_1/0
+	jmp	*(%rdi,%rax,8)	# 18724	[c=10 l=3]  *indirect_jump
+.L340:
+	movl	$95, %eax	# 1648	[c=4 l=5]  *movsi_internal/0
+	movzbl	10(%rbp), %r13d	# 1647	[c=13 l=5]  *zero_extendqisi2/0
+	subl	5176(%r12), %eax	# 1649	[c=13 l=8]  *subsi_1/1
+	cmpl	5180(%r12), %eax	# 1650	[c=13 l=8]  *cmpsi_1/1
+	jb	.L341	# 1651	[c=13 l=2]  *jcc
+	cmpb	$0, 1082(%r12)	# 1653	[c=13 l=9]  *cmpqi_ccno_1/1
+	jne	.L342	# 1654	[c=13 l=6]  *jcc
+.L341:
+	movq	1040(%r12), %rax	# 1657	[c=9 l=8]  *movdi_internal/3
+	movzbl	95(%rax), %r14d	# 1658	[c=13 l=5]  *zero_extendqisi2/0
+.L343:
+	notl	%r13d	# 1675	[c=4 l=3]  *one_cmplsi2_1/0
+	movl	%r14d, %ecx	# 1669	[c=4 l=3]  *movsi_internal/0
+	movl	$95, %edx	# 1670	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 1673	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC28(%rip), %rsi	# 1671	[c=1 l=7]  *movdi_internal/4
+	andl	%r14d, %r13d	# 1676	[c=4 l=3]  *andsi_1/0
+	call	log_add_data_mov@PLT	# 1674	[c=0 l=5]  *call
+	movzbl	%r13b, %ecx	# 1677	[c=4 l=4]  *zero_extendqisi2/0
+	movl	$95, %edx	# 1679	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 1682	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC30(%rip), %rsi	# 1680	[c=1 l=7]  *movdi_internal/4
+	call	log_add_data_mov@PLT	# 1683	[c=0 l=5]  *call
+	movl	$95, %eax	# 1684	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r12), %eax	# 1685	[c=13 l=8]  *subsi_1/1
+	cmpl	5180(%r12), %eax	# 1686	[c=13 l=8]  *cmpsi_1/1
+	jb	.L344	# 1687	[c=13 l=2]  *jcc
+	cmpb	$0, 1082(%r12)	# 1689	[c=13 l=9]  *cmpqi_ccno_1/1
+	jne	.L345	# 1690	[c=13 l=6]  *jcc
+.L344:
+	movq	1040(%r12), %rax	# 1693	[c=9 l=8]  *movdi_internal/3
+	movb	%r13b, 95(%rax)	# 1694	[c=4 l=4]  *movqi_internal/8
+.L346:
+	movq	%r12, %rdi	# 1706	[c=4 l=3]  *movdi_internal/3
+	movq	%rbp, %rsi	# 1705	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 1707	[c=0 l=5]  *call
+	movq	40(%r12), %rax	# 15922	[c=9 l=5]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 15923	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 1709	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 17418	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r12)	# 1710	[c=4 l=5]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 1712	[c=4 l=3]  *cmpdi_1/0
+	jb	.L297	# 1713	[c=13 l=6]  *jcc
+	movl	(%r12), %r8d	# 1715	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r12, %rdi	# 1720	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r8	# 1716	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r12), %r8	# 1718	[c=13 l=8]  *adddi_1/1
+	movq	%r8, %rbp	# 15925	[c=4 l=3]  *movdi_internal/3
+	movq	%r8, %rsi	# 1719	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 1721	[c=0 l=5]  *call
+	movzbl	9(%rbp), %eax	# 1722	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, (%r12)	# 1723	[c=9 l=4]  *addsi_1/0
+	leaq	handler.1(%rip), %rdi	# 15928	[c=1 l=7]  *movdi_internal/4
+	movzbl	8(%rbp), %eax	# 1726	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 15926	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 1727	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbx,%rdx), %rdx	# 1730	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r12)	# 1731	[c=13 l=5]  *adddi_1/0
+	jmp	*(%rdi,%rax,8)	# 18723	[c=10 l=3]  *indirect_jump
+.L347:
+	movzbl	10(%rbp), %r15d	# 1740	[c=13 l=5]  zero_extendqidi2/0
+	movq	1040(%r12), %rax	# 1743	[c=9 l=8]  *movdi_internal/3
+	leaq	.LC43(%rip), %rsi	# 1747	[c=1 l=7]  *movdi_internal/4
+	movq	%r12, %rdi	# 1749	[c=4 l=3]  *movdi_internal/3
+	movzwl	12(%rbp), %r14d	# 1739	[c=13 l=5]  *zero_extendhisi2/0
+	movzbl	(%rax,%r15), %ecx	# 1744	[c=13 l=5]  *zero_extendqisi2/0
+	movl	%r15d, %edx	# 1746	[c=4 l=3]  *movsi_internal/0
+	xorl	%eax, %eax	# 18722	[c=4 l=2]  *movdi_xor
+	movq	%r15, %r13	# 17656	[c=4 l=3]  *movdi_internal/3
+	call	log_append@PLT	# 1751	[c=0 l=5]  *call
+	movq	1040(%r12), %rdx	# 1752	[c=9 l=8]  *movdi_internal/3
+	movzbl	(%rdx,%r15), %eax	# 1753	[c=13 l=5]  *zero_extendqisi2/0
+	orl	%r14d, %eax	# 1754	[c=4 l=3]  *iorsi_1/0
+	movl	%eax, 8(%rsp)	# 15930	[c=4 l=4]  *movsi_internal/1
+	movl	$95, %eax	# 1755	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r12), %eax	# 1756	[c=13 l=8]  *subsi_1/1
+	cmpl	5180(%r12), %eax	# 1757	[c=13 l=8]  *cmpsi_1/1
+	jb	.L348	# 1758	[c=13 l=2]  *jcc
+	cmpb	$0, 1082(%r12)	# 1760	[c=13 l=9]  *cmpqi_ccno_1/1
+	jne	.L349	# 1761	[c=13 l=6]  *jcc
+.L348:
+	movzbl	95(%rdx), %eax	# 1764	[c=13 l=4]  *zero_extendqisi2/0
+.L350:
+	movl	%eax, %ecx	# 1775	[c=4 l=2]  *movsi_internal/0
+	movl	$95, %edx	# 1776	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 1779	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, 16(%rsp)	# 17084	[c=4 l=4]  *movsi_internal/1
+	leaq	.LC28(%rip), %rsi	# 1777	[c=1 l=7]  *movdi_internal/4
+	notl	%r14d	# 1784	[c=4 l=3]  *one_cmplsi2_1/0
+	call	log_add_data_mov@PLT	# 1780	[c=0 l=5]  *call
+	movl	16(%rsp), %eax	# 17085	[c=9 l=4]  *movsi_internal/0
+	movl	%r15d, %edx	# 1789	[c=4 l=3]  *movsi_internal/0
+	movq	%r12, %rdi	# 1792	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC59(%rip), %rsi	# 1790	[c=1 l=7]  *movdi_internal/4
+	sall	$25, %eax	# 1782	[c=4 l=3]  *ashlsi3_1/0
+	sarl	$31, %eax	# 1783	[c=4 l=3]  ashrsi3_cvt/1
+	orl	%eax, %r14d	# 1785	[c=4 l=3]  *iorsi_1/0
+	movl	8(%rsp), %eax	# 15931	[c=9 l=4]  *movsi_internal/0
+	andl	%eax, %r14d	# 1786	[c=4 l=3]  *andsi_1/0
+	xorl	%eax, %eax	# 18721	[c=4 l=2]  *movdi_xor
+	movzbl	%r14b, %ecx	# 1787	[c=4 l=4]  *zero_extendqisi2/0
+	call	log_append@PLT	# 1794	[c=0 l=5]  *call
+	movq	1040(%r12), %rax	# 1795	[c=9 l=8]  *movdi_internal/3
+	movq	%r12, %rdi	# 1798	[c=4 l=3]  *movdi_internal/3
+	movq	%rbp, %rsi	# 1797	[c=4 l=3]  *movdi_internal/3
+	movb	%r14b, (%rax,%r13)	# 1796	[c=4 l=4]  *movqi_internal/8
+	call	log_dump_line@PLT	# 1799	[c=0 l=5]  *call
+	movq	40(%r12), %rax	# 15932	[c=9 l=5]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 15933	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 1801	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 17417	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r12)	# 1802	[c=4 l=5]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 1804	[c=4 l=3]  *cmpdi_1/0
+	jb	.L297	# 1805	[c=13 l=6]  *jcc
+	movl	(%r12), %r8d	# 1807	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r12, %rdi	# 1812	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r8	# 1808	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r12), %r8	# 1810	[c=13 l=8]  *adddi_1/1
+	movq	%r8, %rbp	# 15935	[c=4 l=3]  *movdi_internal/3
+	movq	%r8, %rsi	# 1811	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 1813	[c=0 l=5]  *call
+	movzbl	9(%rbp), %eax	# 1814	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, (%r12)	# 1815	[c=9 l=4]  *addsi_1/0
+	leaq	handler.1(%rip), %rdi	# 15938	[c=1 l=7]  *movdi_internal/4
+	movzbl	8(%rbp), %eax	# 1818	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 15936	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 1819	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbx,%rdx), %rdx	# 1822	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r12)	# 1823	[c=13 l=5]  *adddi_1/0
+	jmp	*(%rdi,%rax,8)	# 18720	[c=10 l=3]  *indirect_jump
+.L351:
+	movq	%r12, %rdi	# 1832	[c=4 l=3]  *movdi_internal/3
+	movq	%rbp, %rsi	# 1831	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 1833	[c=0 l=5]  *call
+	movq	40(%r12), %rax	# 15939	[c=9 l=5]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 15940	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 1835	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 17416	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r12)	# 1836	[c=4 l=5]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 1838	[c=4 l=3]  *cmpdi_1/0
+	jb	.L297	# 1839	[c=13 l=6]  *jcc
+	movq	56(%r12), %rax	# 15941	[c=9 l=5]  *movdi_internal/3
+	cmpq	%rax, 48(%r12)	# 1842	[c=13 l=5]  *cmpdi_1/0
+	jnb	.L1334	# 1843	[c=13 l=6]  *jcc
+.L352:
+	movq	%r12, %rdi	# 1849	[c=4 l=3]  *movdi_internal/3
+	call	log_is_idle@PLT	# 1850	[c=10 l=5]  *call_value
+	testb	%al, %al	# 1852	[c=4 l=2]  *cmpqi_ccno_1/0
+	jne	.L1335	# 1853	[c=13 l=6]  *jcc
+.L353:
+	movl	(%r12), %r8d	# 1864	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r12, %rdi	# 1869	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r8	# 1865	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r12), %r8	# 1867	[c=13 l=8]  *adddi_1/1
+	movq	%r8, %rbp	# 15943	[c=4 l=3]  *movdi_internal/3
+	movq	%r8, %rsi	# 1868	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 1870	[c=0 l=5]  *call
+	movzbl	9(%rbp), %eax	# 1871	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, (%r12)	# 1872	[c=9 l=4]  *addsi_1/0
+	leaq	handler.1(%rip), %rdi	# 15946	[c=1 l=7]  *movdi_internal/4
+	movzbl	8(%rbp), %eax	# 1875	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 15944	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 1876	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbx,%rdx), %rdx	# 1879	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r12)	# 1880	[c=13 l=5]  *adddi_1/0
+	jmp	*(%rdi,%rax,8)	# 18719	[c=10 l=3]  *indirect_jump
+.L354:
+	movl	$95, %eax	# 1890	[c=4 l=5]  *movsi_internal/0
+	movzwl	12(%rbp), %r15d	# 1888	[c=13 l=5]  *zero_extendhisi2/0
+	movzbl	10(%rbp), %r13d	# 1889	[c=9 l=5]  *movqi_internal/4
+	subl	5176(%r12), %eax	# 1891	[c=13 l=8]  *subsi_1/1
+	cmpl	5180(%r12), %eax	# 1892	[c=13 l=8]  *cmpsi_1/1
+	jb	.L355	# 1893	[c=13 l=2]  *jcc
+	cmpb	$0, 1082(%r12)	# 1895	[c=13 l=9]  *cmpqi_ccno_1/1
+	jne	.L356	# 1896	[c=13 l=6]  *jcc
+.L355:
+	movq	1040(%r12), %rax	# 1899	[c=9 l=8]  *movdi_internal/3
+	movzbl	95(%rax), %r14d	# 1900	[c=13 l=5]  *zero_extendqisi2/0
+.L357:
+	movl	%r14d, %ecx	# 1911	[c=4 l=3]  *movsi_internal/0
+	movl	$95, %edx	# 1912	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 1915	[c=4 l=3]  *movdi_internal/3
+	andl	%r15d, %r14d	# 1917	[c=4 l=3]  *andsi_1/0
+	leaq	.LC28(%rip), %rsi	# 1913	[c=1 l=7]  *movdi_internal/4
+	call	log_add_data_mov@PLT	# 1916	[c=0 l=5]  *call
+	movl	%r14d, %edx	# 1918	[c=4 l=3]  *movsi_internal/0
+	movl	%r15d, %esi	# 1919	[c=4 l=3]  *movsi_internal/0
+	movq	%r12, %rdi	# 1920	[c=4 l=3]  *movdi_internal/3
+	call	log_add_flag_read@PLT	# 1921	[c=0 l=5]  *call
+	testl	%r14d, %r14d	# 1922	[c=4 l=3]  *cmpsi_ccno_1/0
+	jne	.L358	# 1923	[c=13 l=2]  *jcc
+	movsbl	%r13b, %eax	# 1925	[c=4 l=4]  extendqisi2
+	addq	$1, 48(%r12)	# 1932	[c=13 l=6]  *adddi_1/0
+	addl	(%r12), %eax	# 1927	[c=9 l=4]  *addsi_1/1
+	andl	992(%r12), %eax	# 1930	[c=13 l=8]  *andsi_1/1
+	movl	%eax, (%r12)	# 1931	[c=4 l=4]  *movsi_internal/1
+.L358:
+	movq	%r12, %rdi	# 1936	[c=4 l=3]  *movdi_internal/3
+	movq	%rbp, %rsi	# 1935	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 1937	[c=0 l=5]  *call
+	movq	40(%r12), %rax	# 15947	[c=9 l=5]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 15948	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 1939	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 17415	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r12)	# 1940	[c=4 l=5]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 1942	[c=4 l=3]  *cmpdi_1/0
+	jb	.L297	# 1943	[c=13 l=6]  *jcc
+	movq	56(%r12), %rax	# 15949	[c=9 l=5]  *movdi_internal/3
+	cmpq	%rax, 48(%r12)	# 1946	[c=13 l=5]  *cmpdi_1/0
+	jnb	.L1336	# 1947	[c=13 l=6]  *jcc
+.L359:
+	movq	%r12, %rdi	# 1953	[c=4 l=3]  *movdi_internal/3
+	call	log_is_idle@PLT	# 1954	[c=10 l=5]  *call_value
+	testb	%al, %al	# 1956	[c=4 l=2]  *cmpqi_ccno_1/0
+	jne	.L1337	# 1957	[c=13 l=6]  *jcc
+.L360:
+	movl	(%r12), %r8d	# 1968	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r12, %rdi	# 1973	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r8	# 1969	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r12), %r8	# 1971	[c=13 l=8]  *adddi_1/1
+	movq	%r8, %rbp	# 15951	[c=4 l=3]  *movdi_internal/3
+	movq	%r8, %rsi	# 1972	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 1974	[c=0 l=5]  *call
+	movzbl	9(%rbp), %eax	# 1975	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, (%r12)	# 1976	[c=9 l=4]  *addsi_1/0
+	leaq	handler.1(%rip), %rdi	# 15954	[c=1 l=7]  *movdi_internal/4
+	movzbl	8(%rbp), %eax	# 1979	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 15952	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 1980	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbx,%rdx), %rdx	# 1983	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r12)	# 1984	[c=13 l=5]  *adddi_1/0
+	jmp	*(%rdi,%rax,8)	# 18718	[c=10 l=3]  *indirect_jump
+.L361:
+	movl	$95, %eax	# 1994	[c=4 l=5]  *movsi_internal/0
+	movzwl	12(%rbp), %r15d	# 1992	[c=13 l=5]  *zero_extendhisi2/0
+	movzbl	10(%rbp), %r13d	# 1993	[c=9 l=5]  *movqi_internal/4
+	subl	5176(%r12), %eax	# 1995	[c=13 l=8]  *subsi_1/1
+	cmpl	5180(%r12), %eax	# 1996	[c=13 l=8]  *cmpsi_1/1
+	jb	.L362	# 1997	[c=13 l=2]  *jcc
+	cmpb	$0, 1082(%r12)	# 1999	[c=13 l=9]  *cmpqi_ccno_1/1
+	jne	.L363	# 2000	[c=13 l=6]  *jcc
+.L362:
+	movq	1040(%r12), %rax	# 2003	[c=9 l=8]  *movdi_internal/3
+	movzbl	95(%rax), %r14d	# 2004	[c=13 l=5]  *zero_extendqisi2/0
+.L364:
+	movl	%r14d, %ecx	# 2015	[c=4 l=3]  *movsi_internal/0
+	movl	$95, %edx	# 2016	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 2019	[c=4 l=3]  *movdi_internal/3
+	andl	%r15d, %r14d	# 2021	[c=4 l=3]  *andsi_1/0
+	leaq	.LC28(%rip), %rsi	# 2017	[c=1 l=7]  *movdi_internal/4
+	call	log_add_data_mov@PLT	# 2020	[c=0 l=5]  *call
+	movl	%r14d, %edx	# 2022	[c=4 l=3]  *movsi_internal/0
+	movl	%r15d, %esi	# 2023	[c=4 l=3]  *movsi_internal/0
+	movq	%r12, %rdi	# 2024	[c=4 l=3]  *movdi_internal/3
+	call	log_add_flag_read@PLT	# 2025	[c=0 l=5]  *call
+	testl	%r14d, %r14d	# 2026	[c=4 l=3]  *cmpsi_ccno_1/0
+	je	.L365	# 2027	[c=13 l=2]  *jcc
+	movsbl	%r13b, %eax	# 2029	[c=4 l=4]  extendqisi2
+	addq	$1, 48(%r12)	# 2036	[c=13 l=6]  *adddi_1/0
+	addl	(%r12), %eax	# 2031	[c=9 l=4]  *addsi_1/1
+	andl	992(%r12), %eax	# 2034	[c=13 l=8]  *andsi_1/1
+	movl	%eax, (%r12)	# 2035	[c=4 l=4]  *movsi_internal/1
+.L365:
+	movq	%r12, %rdi	# 2040	[c=4 l=3]  *movdi_internal/3
+	movq	%rbp, %rsi	# 2039	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 2041	[c=0 l=5]  *call
+	movq	40(%r12), %rax	# 15955	[c=9 l=5]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 15956	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 2043	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 17414	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r12)	# 2044	[c=4 l=5]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 2046	[c=4 l=3]  *cmpdi_1/0
+	jb	.L297	# 2047	[c=13 l=6]  *jcc
+	movq	56(%r12), %rax	# 15957	[c=9 l=5]  *movdi_internal/3
+	cmpq	%rax, 48(%r12)	# 2050	[c=13 l=5]  *cmpdi_1/0
+	jnb	.L1338	# 2051	[c=13 l=6]  *jcc
+.L366:
+	movq	%r12, %rdi	# 2057	[c=4 l=3]  *movdi_internal/3
+	call	log_is_idle@PLT	# 2058	[c=10 l=5]  *call_value
+	testb	%al, %al	# 2060	[c=4 l=2]  *cmpqi_ccno_1/0
+	jne	.L1339	# 2061	[c=13 l=6]  *jcc
+.L367:
+	movl	(%r12), %r8d	# 2072	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r12, %rdi	# 2077	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r8	# 2073	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r12), %r8	# 2075	[c=13 l=8]  *adddi_1/1
+	movq	%r8, %rbp	# 15959	[c=4 l=3]  *movdi_internal/3
+	movq	%r8, %rsi	# 2076	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 2078	[c=0 l=5]  *call
+	movzbl	9(%rbp), %eax	# 2079	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, (%r12)	# 2080	[c=9 l=4]  *addsi_1/0
+	leaq	handler.1(%rip), %rdi	# 15962	[c=1 l=7]  *movdi_internal/4
+	movzbl	8(%rbp), %eax	# 2083	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 15960	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 2084	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbx,%rdx), %rdx	# 2087	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r12)	# 2088	[c=13 l=5]  *adddi_1/0
+	jmp	*(%rdi,%rax,8)	# 18717	[c=10 l=3]  *indirect_jump
+.L368:
+	movl	$95, %eax	# 2097	[c=4 l=5]  *movsi_internal/0
+	movzbl	10(%rbp), %r13d	# 2096	[c=13 l=5]  *zero_extendqisi2/0
+	subl	5176(%r12), %eax	# 2098	[c=13 l=8]  *subsi_1/1
+	cmpl	5180(%r12), %eax	# 2099	[c=13 l=8]  *cmpsi_1/1
+	jb	.L369	# 2100	[c=13 l=2]  *jcc
+	cmpb	$0, 1082(%r12)	# 2102	[c=13 l=9]  *cmpqi_ccno_1/1
+	jne	.L370	# 2103	[c=13 l=6]  *jcc
+.L369:
+	movq	1040(%r12), %rax	# 2106	[c=9 l=8]  *movdi_internal/3
+	movzbl	95(%rax), %r14d	# 2107	[c=13 l=5]  *zero_extendqisi2/0
+.L371:
+	movl	%r14d, %ecx	# 2118	[c=4 l=3]  *movsi_internal/0
+	movl	$95, %edx	# 2119	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 2122	[c=4 l=3]  *movdi_internal/3
+	orl	%r14d, %r13d	# 2124	[c=4 l=3]  *iorsi_1/0
+	leaq	.LC28(%rip), %rsi	# 2120	[c=1 l=7]  *movdi_internal/4
+	call	log_add_data_mov@PLT	# 2123	[c=0 l=5]  *call
+	movzbl	%r13b, %ecx	# 2125	[c=4 l=4]  *zero_extendqisi2/0
+	movl	$95, %edx	# 2127	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 2130	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC30(%rip), %rsi	# 2128	[c=1 l=7]  *movdi_internal/4
+	call	log_add_data_mov@PLT	# 2131	[c=0 l=5]  *call
+	movl	$95, %eax	# 2132	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r12), %eax	# 2133	[c=13 l=8]  *subsi_1/1
+	cmpl	5180(%r12), %eax	# 2134	[c=13 l=8]  *cmpsi_1/1
+	jb	.L372	# 2135	[c=13 l=2]  *jcc
+	cmpb	$0, 1082(%r12)	# 2137	[c=13 l=9]  *cmpqi_ccno_1/1
+	jne	.L373	# 2138	[c=13 l=6]  *jcc
+.L372:
+	movq	1040(%r12), %rax	# 2141	[c=9 l=8]  *movdi_internal/3
+	movb	%r13b, 95(%rax)	# 2142	[c=4 l=4]  *movqi_internal/8
+.L374:
+	movq	%r12, %rdi	# 2154	[c=4 l=3]  *movdi_internal/3
+	movq	%rbp, %rsi	# 2153	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 2155	[c=0 l=5]  *call
+	movq	40(%r12), %rax	# 15963	[c=9 l=5]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 15964	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 2157	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 17413	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r12)	# 2158	[c=4 l=5]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 2160	[c=4 l=3]  *cmpdi_1/0
+	jb	.L297	# 2161	[c=13 l=6]  *jcc
+	movl	(%r12), %r8d	# 2163	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r12, %rdi	# 2168	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r8	# 2164	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r12), %r8	# 2166	[c=13 l=8]  *adddi_1/1
+	movq	%r8, %rbp	# 15966	[c=4 l=3]  *movdi_internal/3
+	movq	%r8, %rsi	# 2167	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 2169	[c=0 l=5]  *call
+	movzbl	9(%rbp), %eax	# 2170	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, (%r12)	# 2171	[c=9 l=4]  *addsi_1/0
+	leaq	handler.1(%rip), %rdi	# 15969	[c=1 l=7]  *movdi_internal/4
+	movzbl	8(%rbp), %eax	# 2174	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 15967	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 2175	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbx,%rdx), %rdx	# 2178	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r12)	# 2179	[c=13 l=5]  *adddi_1/0
+	jmp	*(%rdi,%rax,8)	# 18716	[c=10 l=3]  *indirect_jump
+.L375:
+	movzbl	10(%rbp), %r14d	# 2188	[c=13 l=5]  zero_extendqidi2/0
+	xorl	%eax, %eax	# 18712	[c=4 l=2]  *movdi_xor
+	movq	%r12, %rdi	# 2197	[c=4 l=3]  *movdi_internal/3
+	movzwl	12(%rbp), %r13d	# 2187	[c=13 l=5]  *zero_extendhisi2/0
+	movq	1040(%r12), %rdx	# 2190	[c=9 l=8]  *movdi_internal/3
+	leaq	.LC43(%rip), %rsi	# 2195	[c=1 l=7]  *movdi_internal/4
+	movzbl	(%rdx,%r14), %ecx	# 2191	[c=13 l=5]  *zero_extendqisi2/0
+	movzbl	%r14b, %edx	# 2192	[c=4 l=4]  *zero_extendqisi2/0
+	call	log_append@PLT	# 2199	[c=0 l=5]  *call
+	movq	1040(%r12), %rdx	# 2200	[c=9 l=8]  *movdi_internal/3
+	movzbl	(%rdx,%r14), %eax	# 2201	[c=13 l=5]  *zero_extendqisi2/0
+	xorl	%r14d, %r14d	# 18713	[c=4 l=3]  *movsi_xor
+	testl	%r13d, %eax	# 18714	[c=4 l=3]  *testsi_1/0
+	movl	$95, %eax	# 2207	[c=4 l=5]  *movsi_internal/0
+	setne	%r14b	# 18715	[c=4 l=4]  *setcc_qi_slp
+	subl	5176(%r12), %eax	# 2208	[c=13 l=8]  *subsi_1/1
+	sall	$6, %r14d	# 2206	[c=4 l=4]  *ashlsi3_1/0
+	cmpl	5180(%r12), %eax	# 2209	[c=13 l=8]  *cmpsi_1/1
+	jb	.L376	# 2210	[c=13 l=2]  *jcc
+	cmpb	$0, 1082(%r12)	# 2212	[c=13 l=9]  *cmpqi_ccno_1/1
+	jne	.L377	# 2213	[c=13 l=6]  *jcc
+.L376:
+	movzbl	95(%rdx), %r13d	# 2216	[c=13 l=5]  *zero_extendqisi2/0
+.L378:
+	movl	%r13d, %ecx	# 2227	[c=4 l=3]  *movsi_internal/0
+	andl	$-65, %r13d	# 2233	[c=4 l=4]  *andsi_1/0
+	movl	$95, %edx	# 2228	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 2231	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC28(%rip), %rsi	# 2229	[c=1 l=7]  *movdi_internal/4
+	orl	%r14d, %r13d	# 2234	[c=4 l=3]  *iorsi_1/0
+	call	log_add_data_mov@PLT	# 2232	[c=0 l=5]  *call
+	movzbl	%r13b, %ecx	# 2235	[c=4 l=4]  *zero_extendqisi2/0
+	movl	$95, %edx	# 2237	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 2240	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC30(%rip), %rsi	# 2238	[c=1 l=7]  *movdi_internal/4
+	call	log_add_data_mov@PLT	# 2241	[c=0 l=5]  *call
+	movl	$95, %eax	# 2242	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r12), %eax	# 2243	[c=13 l=8]  *subsi_1/1
+	cmpl	5180(%r12), %eax	# 2244	[c=13 l=8]  *cmpsi_1/1
+	jb	.L379	# 2245	[c=13 l=2]  *jcc
+	cmpb	$0, 1082(%r12)	# 2247	[c=13 l=9]  *cmpqi_ccno_1/1
+	jne	.L380	# 2248	[c=13 l=6]  *jcc
+.L379:
+	movq	1040(%r12), %rax	# 2251	[c=9 l=8]  *movdi_internal/3
+	movb	%r13b, 95(%rax)	# 2252	[c=4 l=4]  *movqi_internal/8
+.L381:
+	movq	%r12, %rdi	# 2264	[c=4 l=3]  *movdi_internal/3
+	movq	%rbp, %rsi	# 2263	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 2265	[c=0 l=5]  *call
+	movq	40(%r12), %rax	# 15970	[c=9 l=5]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 15971	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 2267	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 17410	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r12)	# 2268	[c=4 l=5]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 2270	[c=4 l=3]  *cmpdi_1/0
+	jb	.L297	# 2271	[c=13 l=6]  *jcc
+	movl	(%r12), %r8d	# 2273	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r12, %rdi	# 2278	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r8	# 2274	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r12), %r8	# 2276	[c=13 l=8]  *adddi_1/1
+	movq	%r8, %rbp	# 15973	[c=4 l=3]  *movdi_internal/3
+	movq	%r8, %rsi	# 2277	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 2279	[c=0 l=5]  *call
+	movzbl	9(%rbp), %eax	# 2280	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, (%r12)	# 2281	[c=9 l=4]  *addsi_1/0
+	leaq	handler.1(%rip), %rdi	# 15976	[c=1 l=7]  *movdi_internal/4
+	movzbl	8(%rbp), %eax	# 2284	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 15974	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 2285	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbx,%rdx), %rdx	# 2288	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r12)	# 2289	[c=13 l=5]  *adddi_1/0
+	jmp	*(%rdi,%rax,8)	# 18711	[c=10 l=3]  *indirect_jump
+.L382:
+	movzwl	12(%rbp), %eax	# 2297	[c=13 l=4]  *zero_extendhisi2/0
+	movl	5176(%r12), %r15d	# 2299	[c=9 l=8]  *movsi_internal/0
+	movl	5180(%r12), %r13d	# 2300	[c=9 l=8]  *movsi_internal/0
+	movl	%eax, 8(%rsp)	# 15977	[c=4 l=4]  *movsi_internal/1
+	movzbl	10(%rbp), %eax	# 2298	[c=13 l=4]  *zero_extendqisi2/0
+	movl	%eax, 16(%rsp)	# 15978	[c=4 l=4]  *movsi_internal/1
+	movl	$93, %eax	# 2301	[c=4 l=5]  *movsi_internal/0
+	subl	%r15d, %eax	# 2302	[c=4 l=3]  *subsi_1/0
+	cmpl	%r13d, %eax	# 2303	[c=4 l=3]  *cmpsi_1/0
+	jb	.L383	# 2304	[c=13 l=6]  *jcc
+	cmpb	$1, 1082(%r12)	# 2308	[c=13 l=9]  *cmpqi_1/0
+	ja	.L1340	# 2309	[c=13 l=6]  *jcc
+	movq	1040(%r12), %rax	# 13493	[c=9 l=8]  *movdi_internal/3
+	movzbl	93(%rax), %r14d	# 13494	[c=13 l=5]  *zero_extendqisi2/0
+.L385:
+	movzbl	94(%rax), %eax	# 2346	[c=13 l=4]  *zero_extendqisi2/0
+.L387:
+	sall	$8, %eax	# 2349	[c=4 l=3]  *ashlsi3_1/0
+	movl	$93, %edx	# 2352	[c=4 l=5]  *movsi_internal/0
+	leaq	.LC32(%rip), %rsi	# 2353	[c=1 l=7]  *movdi_internal/4
+	movq	%r12, %rdi	# 2355	[c=4 l=3]  *movdi_internal/3
+	orl	%eax, %r14d	# 2350	[c=4 l=3]  *iorsi_1/0
+	movl	%r14d, %ecx	# 2351	[c=4 l=3]  *movsi_internal/0
+	call	log_add_data_mov@PLT	# 2356	[c=0 l=5]  *call
+	movl	996(%r12), %ecx	# 2358	[c=9 l=8]  *movsi_internal/0
+	movzbl	840(%r12), %edx	# 2360	[c=13 l=9]  *zero_extendqisi2/0
+	leal	1(%rcx,%rdx), %edx	# 2361	[c=5 l=4]  *leasi
+	cmpl	%edx, %r14d	# 2362	[c=4 l=3]  *cmpsi_1/0
+	jb	.L1341	# 2363	[c=13 l=6]  *jcc
+	cmpl	$95, %r14d	# 14222	[c=4 l=4]  *cmpsi_1/0
+	movl	(%r12), %r13d	# 2371	[c=5 l=4]  *movsi_internal/0
+	movq	%r12, %rdi	# 2382	[c=4 l=3]  *movdi_internal/3
+	leal	-1(%r14), %r15d	# 17409	[c=4 l=4]  *leasi
+	leaq	.LC31(%rip), %rdx	# 15698	[c=1 l=7]  *movdi_internal/4
+	leaq	.LC30(%rip), %rsi	# 15697	[c=1 l=7]  *movdi_internal/4
+	cmovne	%rdx, %rsi	# 14223	[c=8 l=4]  *movdicc_noc/1
+	movzbl	%r13b, %ecx	# 2373	[c=4 l=4]  *zero_extendqisi2/0
+	movl	%r14d, %edx	# 2380	[c=4 l=3]  *movsi_internal/0
+	call	log_add_data_mov@PLT	# 2383	[c=0 l=5]  *call
+	movl	%r14d, %edx	# 15979	[c=4 l=3]  *movsi_internal/0
+	subl	5176(%r12), %edx	# 2384	[c=13 l=8]  *subsi_1/1
+	cmpl	5180(%r12), %edx	# 2385	[c=13 l=8]  *cmpsi_1/1
+	jb	.L390	# 2386	[c=13 l=2]  *jcc
+	movl	%r14d, %edx	# 15981	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %edx	# 2388	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %edx	# 15670	[c=5 l=6]  *andsi_1_zext
+	cmpb	$0, 1080(%r12,%rdx)	# 2391	[c=14 l=9]  *cmpqi_ccno_1/1
+	jne	.L391	# 2392	[c=13 l=6]  *jcc
+.L390:
+	movq	1040(%r12), %rcx	# 2396	[c=9 l=8]  *movdi_internal/3
+	movslq	%r14d, %rdx	# 2395	[c=4 l=3]  *extendsidi2_rex64/1
+	movb	%r13b, (%rcx,%rdx)	# 2397	[c=4 l=4]  *movqi_internal/8
+.L392:
+	movl	(%r12), %ecx	# 2408	[c=5 l=4]  *movsi_internal/0
+	leaq	.LC31(%rip), %rdx	# 15700	[c=1 l=7]  *movdi_internal/4
+	movq	%r12, %rdi	# 2420	[c=4 l=3]  *movdi_internal/3
+	leal	-2(%r14), %r13d	# 17408	[c=4 l=4]  *leasi
+	leaq	.LC30(%rip), %rsi	# 15699	[c=1 l=7]  *movdi_internal/4
+	movl	%ecx, %eax	# 15983	[c=4 l=2]  *movsi_internal/0
+	movzbl	%ch, %ecx	# 2411	[c=4 l=3]  *extzvsi
+	shrl	$8, %eax	# 2409	[c=4 l=3]  *lshrsi3_1/0
+	cmpl	$95, %r15d	# 14234	[c=4 l=4]  *cmpsi_1/0
+	cmovne	%rdx, %rsi	# 14235	[c=8 l=4]  *movdicc_noc/1
+	movl	%r15d, %edx	# 2418	[c=4 l=3]  *movsi_internal/0
+	movl	%eax, 24(%rsp)	# 15984	[c=4 l=4]  *movsi_internal/1
+	call	log_add_data_mov@PLT	# 2421	[c=0 l=5]  *call
+	movl	%r15d, %edx	# 15985	[c=4 l=3]  *movsi_internal/0
+	subl	5176(%r12), %edx	# 2422	[c=13 l=8]  *subsi_1/1
+	cmpl	5180(%r12), %edx	# 2423	[c=13 l=8]  *cmpsi_1/1
+	jb	.L394	# 2424	[c=13 l=2]  *jcc
+	movl	%r15d, %edx	# 15987	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %edx	# 2426	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %edx	# 15669	[c=5 l=6]  *andsi_1_zext
+	cmpb	$0, 1080(%r12,%rdx)	# 2429	[c=14 l=9]  *cmpqi_ccno_1/1
+	jne	.L395	# 2430	[c=13 l=6]  *jcc
+.L394:
+	movq	1040(%r12), %rdx	# 2434	[c=9 l=8]  *movdi_internal/3
+	movzbl	24(%rsp), %eax	# 15989	[c=9 l=5]  *movqi_internal/4
+	movslq	%r15d, %r9	# 2433	[c=4 l=3]  *extendsidi2_rex64/1
+	movb	%al, (%rdx,%r9)	# 2435	[c=4 l=4]  *movqi_internal/8
+.L396:
+	cmpb	$0, 840(%r12)	# 2446	[c=13 l=9]  *cmpqi_ccno_1/1
+	je	.L397	# 2447	[c=13 l=2]  *jcc
+	movl	(%r12), %r9d	# 15990	[c=5 l=4]  *movsi_internal/0
+	subl	$3, %r14d	# 2451	[c=4 l=4]  *addsi_1/0
+	movl	%r13d, %edx	# 2459	[c=4 l=3]  *movsi_internal/0
+	movq	%r12, %rdi	# 2461	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC31(%rip), %rax	# 15702	[c=1 l=7]  *movdi_internal/4
+	leaq	.LC30(%rip), %rsi	# 15701	[c=1 l=7]  *movdi_internal/4
+	shrl	$16, %r9d	# 2450	[c=4 l=4]  *lshrsi3_1/0
+	cmpl	$95, %r13d	# 14246	[c=4 l=4]  *cmpsi_1/0
+	cmovne	%rax, %rsi	# 14247	[c=8 l=4]  *movdicc_noc/1
+	movzbl	%r9b, %ecx	# 2452	[c=4 l=4]  *zero_extendqisi2/0
+	movl	%r9d, 24(%rsp)	# 17086	[c=4 l=5]  *movsi_internal/1
+	call	log_add_data_mov@PLT	# 2462	[c=0 l=5]  *call
+	movl	%r13d, %eax	# 15992	[c=4 l=3]  *movsi_internal/0
+	subl	5176(%r12), %eax	# 2463	[c=13 l=8]  *subsi_1/1
+	cmpl	5180(%r12), %eax	# 2464	[c=13 l=8]  *cmpsi_1/1
+	movl	24(%rsp), %r9d	# 17087	[c=9 l=5]  *movsi_internal/0
+	jb	.L399	# 2465	[c=13 l=2]  *jcc
+	movl	%r13d, %eax	# 15994	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %eax	# 2467	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 15668	[c=5 l=5]  *andsi_1_zext
+	cmpb	$0, 1080(%r12,%rax)	# 2470	[c=14 l=9]  *cmpqi_ccno_1/1
+	jne	.L400	# 2471	[c=13 l=6]  *jcc
+.L399:
+	movq	1040(%r12), %rax	# 2475	[c=9 l=8]  *movdi_internal/3
+	movslq	%r13d, %r13	# 2474	[c=4 l=3]  *extendsidi2_rex64/1
+	movb	%r9b, (%rax,%r13)	# 2476	[c=4 l=4]  *movqi_internal/8
+.L401:
+	movl	%r14d, %r13d	# 12	[c=4 l=3]  *movsi_internal/0
+.L397:
+	movzwl	%r13w, %r14d	# 2491	[c=4 l=4]  *zero_extendhisi2/0
+	movl	$93, %edx	# 2493	[c=4 l=5]  *movsi_internal/0
+	leaq	.LC33(%rip), %rsi	# 2494	[c=1 l=7]  *movdi_internal/4
+	movq	%r12, %rdi	# 2496	[c=4 l=3]  *movdi_internal/3
+	movl	%r14d, %ecx	# 2492	[c=4 l=3]  *movsi_internal/0
+	call	log_add_data_mov@PLT	# 2497	[c=0 l=5]  *call
+	movl	$93, %edx	# 2498	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r12), %edx	# 2499	[c=13 l=8]  *subsi_1/1
+	cmpl	5180(%r12), %edx	# 2500	[c=13 l=8]  *cmpsi_1/1
+	jb	.L402	# 2501	[c=13 l=2]  *jcc
+	cmpb	$1, 1082(%r12)	# 2505	[c=13 l=9]  *cmpqi_1/0
+	ja	.L1342	# 2506	[c=13 l=6]  *jcc
+.L402:
+	movq	1040(%r12), %rdx	# 2517	[c=9 l=8]  *movdi_internal/3
+	movb	%r13b, 93(%rdx)	# 2518	[c=4 l=4]  *movqi_internal/8
+.L403:
+	movl	%r14d, %eax	# 15996	[c=4 l=3]  *movsi_internal/0
+	movl	$94, %edx	# 2522	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r12), %edx	# 2523	[c=13 l=8]  *subsi_1/1
+	sarl	$8, %eax	# 2521	[c=4 l=3]  *ashrsi3_1/0
+	cmpl	5180(%r12), %edx	# 2524	[c=13 l=8]  *cmpsi_1/1
+	jb	.L404	# 2525	[c=13 l=2]  *jcc
+	cmpb	$1, 1082(%r12)	# 2529	[c=13 l=9]  *cmpqi_1/0
+	ja	.L1343	# 2530	[c=13 l=6]  *jcc
+.L404:
+	movq	1040(%r12), %rdx	# 2540	[c=9 l=8]  *movdi_internal/3
+	movb	%al, 94(%rdx)	# 2541	[c=4 l=3]  *movqi_internal/8
+.L405:
+	movl	16(%rsp), %esi	# 15998	[c=9 l=4]  *movsi_internal/0
+	movl	8(%rsp), %eax	# 16000	[c=9 l=4]  *movsi_internal/0
+	sall	$16, %esi	# 2544	[c=4 l=3]  *ashlsi3_1/0
+	orl	%eax, %esi	# 2545	[c=4 l=2]  *iorsi_1/0
+	movl	%esi, (%r12)	# 2546	[c=4 l=4]  *movsi_internal/1
+	cmpl	%esi, 992(%r12)	# 2547	[c=13 l=8]  *cmpsi_1/0
+	jb	.L1225	# 2548	[c=13 l=6]  *jcc
+	movzbl	840(%r12), %eax	# 2556	[c=13 l=9]  zero_extendqidi2/0
+	movq	%r12, %rdi	# 2559	[c=4 l=3]  *movdi_internal/3
+	movq	%rbp, %rsi	# 2558	[c=4 l=3]  *movdi_internal/3
+	addq	%rax, 48(%r12)	# 2557	[c=13 l=5]  *adddi_1/0
+	call	log_dump_line@PLT	# 2560	[c=0 l=5]  *call
+	movq	40(%r12), %rax	# 16001	[c=9 l=5]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 16002	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 2562	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 17407	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r12)	# 2563	[c=4 l=5]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 2565	[c=4 l=3]  *cmpdi_1/0
+	jb	.L297	# 2566	[c=13 l=6]  *jcc
+	movq	56(%r12), %rax	# 16003	[c=9 l=5]  *movdi_internal/3
+	cmpq	%rax, 48(%r12)	# 2569	[c=13 l=5]  *cmpdi_1/0
+	jnb	.L1344	# 2570	[c=13 l=6]  *jcc
+.L407:
+	movq	%r12, %rdi	# 2576	[c=4 l=3]  *movdi_internal/3
+	call	log_is_idle@PLT	# 2577	[c=10 l=5]  *call_value
+	testb	%al, %al	# 2579	[c=4 l=2]  *cmpqi_ccno_1/0
+	jne	.L1345	# 2580	[c=13 l=6]  *jcc
+.L408:
+	movl	(%r12), %r8d	# 2591	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r12, %rdi	# 2596	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r8	# 2592	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r12), %r8	# 2594	[c=13 l=8]  *adddi_1/1
+	movq	%r8, %rbp	# 16005	[c=4 l=3]  *movdi_internal/3
+	movq	%r8, %rsi	# 2595	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 2597	[c=0 l=5]  *call
+	movzbl	9(%rbp), %eax	# 2598	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, (%r12)	# 2599	[c=9 l=4]  *addsi_1/0
+	leaq	handler.1(%rip), %rdi	# 16008	[c=1 l=7]  *movdi_internal/4
+	movzbl	8(%rbp), %eax	# 2602	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 16006	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 2603	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbx,%rdx), %rdx	# 2606	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r12)	# 2607	[c=13 l=5]  *adddi_1/0
+	jmp	*(%rdi,%rax,8)	# 18710	[c=10 l=3]  *indirect_jump
+.L409:
+	movzwl	12(%rbp), %eax	# 2615	[c=13 l=4]  *zero_extendhisi2/0
+	movzbl	10(%rbp), %r15d	# 2616	[c=13 l=5]  zero_extendqidi2/0
+	movl	%eax, 8(%rsp)	# 16009	[c=4 l=4]  *movsi_internal/1
+	movq	%r15, %r13	# 17658	[c=4 l=3]  *movdi_internal/3
+	movl	%r15d, %eax	# 16010	[c=4 l=3]  *movsi_internal/0
+	subl	5176(%r12), %eax	# 2619	[c=13 l=8]  *subsi_1/1
+	cmpl	5180(%r12), %eax	# 2620	[c=13 l=8]  *cmpsi_1/1
+	jb	.L410	# 2621	[c=13 l=2]  *jcc
+	movl	%r15d, %eax	# 16012	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %eax	# 2623	[c=4 l=3]  *ashrsi3_1/0
+	cltq	# 2624	[c=4 l=2]  *extendsidi2_rex64/0
+	cmpb	$0, 1080(%r12,%rax)	# 2625	[c=14 l=9]  *cmpqi_ccno_1/1
+	jne	.L411	# 2626	[c=13 l=6]  *jcc
+.L410:
+	movq	1040(%r12), %rdx	# 2630	[c=9 l=8]  *movdi_internal/3
+	movzbl	%r13b, %eax	# 2629	[c=4 l=4]  zero_extendqidi2/0
+	movzbl	(%rdx,%rax), %ecx	# 2631	[c=13 l=4]  *zero_extendqisi2/0
+.L412:
+	cmpl	$95, %r15d	# 14258	[c=4 l=4]  *cmpsi_1/0
+	movl	%r15d, %edx	# 2648	[c=4 l=3]  *movsi_internal/0
+	movq	%r12, %rdi	# 2650	[c=4 l=3]  *movdi_internal/3
+	movl	%ecx, 16(%rsp)	# 17088	[c=4 l=4]  *movsi_internal/1
+	leaq	.LC29(%rip), %rax	# 15704	[c=1 l=7]  *movdi_internal/4
+	leaq	.LC28(%rip), %rsi	# 15703	[c=1 l=7]  *movdi_internal/4
+	cmovne	%rax, %rsi	# 14259	[c=8 l=4]  *movdicc_noc/1
+	call	log_add_data_mov@PLT	# 2651	[c=0 l=5]  *call
+	cmpl	6564(%r12), %r15d	# 2652	[c=13 l=8]  *cmpsi_1/1
+	movl	16(%rsp), %ecx	# 17089	[c=9 l=4]  *movsi_internal/0
+	jnb	.L414	# 2653	[c=13 l=6]  *jcc
+	movslq	%r15d, %rdx	# 2655	[c=4 l=3]  *extendsidi2_rex64/1
+	xorl	%r14d, %r14d	# 18709	[c=4 l=3]  *movdi_xor
+	cmpb	$0, 6568(%r12,%rdx)	# 2658	[c=14 l=9]  *cmpqi_ccno_1/1
+	jns	.L414	# 2659	[c=13 l=6]  *jcc
+.L415:
+	cmpl	$95, %r15d	# 14270	[c=4 l=4]  *cmpsi_1/0
+	leaq	.LC31(%rip), %rdx	# 15706	[c=1 l=7]  *movdi_internal/4
+	movzbl	%r14b, %ecx	# 2666	[c=4 l=4]  *zero_extendqisi2/0
+	movq	%r12, %rdi	# 2675	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC30(%rip), %rsi	# 15705	[c=1 l=7]  *movdi_internal/4
+	cmovne	%rdx, %rsi	# 14271	[c=8 l=4]  *movdicc_noc/1
+	movl	%r15d, %edx	# 2673	[c=4 l=3]  *movsi_internal/0
+	call	log_add_data_mov@PLT	# 2676	[c=0 l=5]  *call
+	movl	%r15d, %edx	# 16016	[c=4 l=3]  *movsi_internal/0
+	subl	5176(%r12), %edx	# 2677	[c=13 l=8]  *subsi_1/1
+	cmpl	5180(%r12), %edx	# 2678	[c=13 l=8]  *cmpsi_1/1
+	jb	.L417	# 2679	[c=13 l=2]  *jcc
+	movl	%r15d, %edx	# 16018	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %edx	# 2681	[c=4 l=3]  *ashrsi3_1/0
+	movslq	%edx, %rdx	# 2682	[c=4 l=3]  *extendsidi2_rex64/1
+	cmpb	$0, 1080(%r12,%rdx)	# 2683	[c=14 l=9]  *cmpqi_ccno_1/1
+	jne	.L418	# 2684	[c=13 l=6]  *jcc
+.L417:
+	movq	1040(%r12), %rdx	# 2688	[c=9 l=8]  *movdi_internal/3
+	movb	%r14b, (%rdx,%r13)	# 2689	[c=4 l=4]  *movqi_internal/8
+.L419:
+	movq	%r12, %rdi	# 2701	[c=4 l=3]  *movdi_internal/3
+	movq	%rbp, %rsi	# 2700	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 2702	[c=0 l=5]  *call
+	movq	40(%r12), %rax	# 16020	[c=9 l=5]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 16021	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 2704	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 17406	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r12)	# 2705	[c=4 l=5]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 2707	[c=4 l=3]  *cmpdi_1/0
+	jb	.L297	# 2708	[c=13 l=6]  *jcc
+	movl	(%r12), %r8d	# 2710	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r12, %rdi	# 2715	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r8	# 2711	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r12), %r8	# 2713	[c=13 l=8]  *adddi_1/1
+	movq	%r8, %rbp	# 16023	[c=4 l=3]  *movdi_internal/3
+	movq	%r8, %rsi	# 2714	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 2716	[c=0 l=5]  *call
+	movzbl	9(%rbp), %eax	# 2717	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, (%r12)	# 2718	[c=9 l=4]  *addsi_1/0
+	leaq	handler.1(%rip), %rdi	# 16026	[c=1 l=7]  *movdi_internal/4
+	movzbl	8(%rbp), %eax	# 2721	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 16024	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 2722	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbx,%rdx), %rdx	# 2725	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r12)	# 2726	[c=13 l=5]  *adddi_1/0
+	jmp	*(%rdi,%rax,8)	# 18708	[c=10 l=3]  *indirect_jump
+.L414:
+	movl	8(%rsp), %r14d	# 16014	[c=9 l=5]  *movsi_internal/0
+	notl	%r14d	# 2662	[c=4 l=3]  *one_cmplsi2_1/0
+	andl	%ecx, %r14d	# 2663	[c=4 l=3]  *andsi_1/0
+	jmp	.L415	# 18819	[c=1 l=5]  jump
+.L427:
+	movzbl	10(%rbp), %r13d	# 2856	[c=13 l=5]  zero_extendqidi2/0
+	movq	%r12, %rdi	# 2865	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 18703	[c=4 l=2]  *movdi_xor
+	movzwl	12(%rbp), %r15d	# 2855	[c=13 l=5]  zero_extendhidi2/0
+	movq	1040(%r12), %rdx	# 2858	[c=9 l=8]  *movdi_internal/3
+	leaq	.LC43(%rip), %rsi	# 2863	[c=1 l=7]  *movdi_internal/4
+	movzbl	(%rdx,%r13), %ecx	# 2859	[c=13 l=5]  *zero_extendqisi2/0
+	movzbl	%r13b, %edx	# 2860	[c=4 l=4]  *zero_extendqisi2/0
+	call	log_append@PLT	# 2867	[c=0 l=5]  *call
+	movq	1040(%r12), %rax	# 2868	[c=9 l=8]  *movdi_internal/3
+	movzwl	%r15w, %edx	# 2872	[c=4 l=4]  *zero_extendhisi2/0
+	movq	%r12, %rdi	# 2877	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC43(%rip), %rsi	# 17093	[c=1 l=7]  *movdi_internal/4
+	movzbl	(%rax,%r15), %ecx	# 2871	[c=13 l=5]  *zero_extendqisi2/0
+	movzbl	(%rax,%r13), %r13d	# 2869	[c=13 l=5]  *zero_extendqisi2/0
+	xorl	%eax, %eax	# 18704	[c=4 l=2]  *movdi_xor
+	call	log_append@PLT	# 2879	[c=0 l=5]  *call
+	movq	1040(%r12), %rcx	# 2880	[c=9 l=8]  *movdi_internal/3
+	movl	%r13d, %esi	# 16034	[c=4 l=3]  *movsi_internal/0
+	andl	$136, %esi	# 2883	[c=4 l=6]  *andsi_1/0
+	movzbl	(%rcx,%r15), %edx	# 2881	[c=13 l=5]  *zero_extendqisi2/0
+	movl	%edx, %eax	# 16036	[c=4 l=2]  *movsi_internal/0
+	subl	%edx, %r13d	# 2890	[c=4 l=3]  *subsi_1/0
+	andl	$136, %eax	# 2886	[c=4 l=5]  *andsi_1/0
+	andl	$511, %r13d	# 2891	[c=4 l=7]  *andsi_1/0
+	leal	(%rax,%rsi,2), %eax	# 2887	[c=8 l=3]  *leasi
+	imull	$260, %eax, %eax	# 2892	[c=12 l=6]  *mulsi3_1/1
+	andl	$7680, %eax	# 2893	[c=4 l=5]  *andsi_1/0
+	orl	%eax, %r13d	# 2894	[c=5 l=3]  *iorsi_1_zext
+	movl	$95, %eax	# 2895	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r12), %eax	# 2896	[c=13 l=8]  *subsi_1/1
+	cmpl	5180(%r12), %eax	# 2897	[c=13 l=8]  *cmpsi_1/1
+	jb	.L428	# 2898	[c=13 l=2]  *jcc
+	cmpb	$0, 1082(%r12)	# 2900	[c=13 l=9]  *cmpqi_ccno_1/1
+	jne	.L429	# 2901	[c=13 l=6]  *jcc
+.L428:
+	movzbl	95(%rcx), %r14d	# 2904	[c=13 l=5]  *zero_extendqisi2/0
+.L430:
+	movl	%r14d, %ecx	# 2915	[c=4 l=3]  *movsi_internal/0
+	movl	$95, %edx	# 2916	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 2919	[c=4 l=3]  *movdi_internal/3
+	andl	$-64, %r14d	# 2921	[c=4 l=4]  *andsi_1/0
+	leaq	.LC28(%rip), %rsi	# 2917	[c=1 l=7]  *movdi_internal/4
+	call	log_add_data_mov@PLT	# 2920	[c=0 l=5]  *call
+	leaq	flag_update_table_sub8(%rip), %rax	# 15679	[c=1 l=7]  *movdi_internal/4
+	movl	$95, %edx	# 2928	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 2931	[c=4 l=3]  *movdi_internal/3
+	movzbl	(%rax,%r13), %eax	# 2924	[c=13 l=5]  *zero_extendqisi2/0
+	leaq	.LC30(%rip), %rsi	# 2929	[c=1 l=7]  *movdi_internal/4
+	orl	%eax, %r14d	# 2925	[c=4 l=3]  *iorsi_1/0
+	movzbl	%r14b, %ecx	# 2926	[c=4 l=4]  *zero_extendqisi2/0
+	call	log_add_data_mov@PLT	# 2932	[c=0 l=5]  *call
+	movl	$95, %eax	# 2933	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r12), %eax	# 2934	[c=13 l=8]  *subsi_1/1
+	cmpl	5180(%r12), %eax	# 2935	[c=13 l=8]  *cmpsi_1/1
+	jb	.L431	# 2936	[c=13 l=2]  *jcc
+	cmpb	$0, 1082(%r12)	# 2938	[c=13 l=9]  *cmpqi_ccno_1/1
+	jne	.L432	# 2939	[c=13 l=6]  *jcc
+.L431:
+	movq	1040(%r12), %rax	# 2942	[c=9 l=8]  *movdi_internal/3
+	movb	%r14b, 95(%rax)	# 2943	[c=4 l=4]  *movqi_internal/8
+.L433:
+	movq	%r12, %rdi	# 2955	[c=4 l=3]  *movdi_internal/3
+	movq	%rbp, %rsi	# 2954	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 2956	[c=0 l=5]  *call
+	movq	40(%r12), %rax	# 16038	[c=9 l=5]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 16039	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 2958	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 17402	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r12)	# 2959	[c=4 l=5]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 2961	[c=4 l=3]  *cmpdi_1/0
+	jb	.L297	# 2962	[c=13 l=6]  *jcc
+	movl	(%r12), %r8d	# 2964	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r12, %rdi	# 2969	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r8	# 2965	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r12), %r8	# 2967	[c=13 l=8]  *adddi_1/1
+	movq	%r8, %rbp	# 16041	[c=4 l=3]  *movdi_internal/3
+	movq	%r8, %rsi	# 2968	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 2970	[c=0 l=5]  *call
+	movzbl	9(%rbp), %eax	# 2971	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, (%r12)	# 2972	[c=9 l=4]  *addsi_1/0
+	leaq	handler.1(%rip), %rdi	# 16044	[c=1 l=7]  *movdi_internal/4
+	movzbl	8(%rbp), %eax	# 2975	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 16042	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 2976	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbx,%rdx), %rdx	# 2979	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r12)	# 2980	[c=13 l=5]  *adddi_1/0
+	jmp	*(%rdi,%rax,8)	# 18702	[c=10 l=3]  *indirect_jump
+.L434:
+	movzbl	10(%rbp), %r13d	# 2989	[c=13 l=5]  zero_extendqidi2/0
+	movq	%r12, %rdi	# 2998	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 18700	[c=4 l=2]  *movdi_xor
+	movzwl	12(%rbp), %r15d	# 2988	[c=13 l=5]  zero_extendhidi2/0
+	movq	1040(%r12), %rdx	# 2991	[c=9 l=8]  *movdi_internal/3
+	leaq	.LC43(%rip), %rsi	# 2996	[c=1 l=7]  *movdi_internal/4
+	movzbl	(%rdx,%r13), %ecx	# 2992	[c=13 l=5]  *zero_extendqisi2/0
+	movzbl	%r13b, %edx	# 2993	[c=4 l=4]  *zero_extendqisi2/0
+	call	log_append@PLT	# 3000	[c=0 l=5]  *call
+	movq	1040(%r12), %rax	# 3001	[c=9 l=8]  *movdi_internal/3
+	movzwl	%r15w, %edx	# 3005	[c=4 l=4]  *zero_extendhisi2/0
+	movq	%r12, %rdi	# 3010	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC43(%rip), %rsi	# 17095	[c=1 l=7]  *movdi_internal/4
+	movzbl	(%rax,%r15), %ecx	# 3004	[c=13 l=5]  *zero_extendqisi2/0
+	movzbl	(%rax,%r13), %r13d	# 3002	[c=9 l=5]  *movqi_internal/4
+	xorl	%eax, %eax	# 18701	[c=4 l=2]  *movdi_xor
+	call	log_append@PLT	# 3012	[c=0 l=5]  *call
+	movq	1040(%r12), %rax	# 3013	[c=9 l=8]  *movdi_internal/3
+	movl	%r13d, %ecx	# 16045	[c=4 l=3]  *movsi_internal/0
+	andl	$136, %ecx	# 3017	[c=4 l=6]  *andsi_1/0
+	movzbl	(%rax,%r15), %esi	# 3014	[c=13 l=5]  *zero_extendqisi2/0
+	movzbl	95(%rax), %r14d	# 3015	[c=13 l=5]  *zero_extendqisi2/0
+	movl	%esi, %eax	# 16047	[c=4 l=2]  *movsi_internal/0
+	movl	%r14d, %edx	# 17664	[c=4 l=3]  *movsi_internal/0
+	andl	$136, %eax	# 3020	[c=4 l=5]  *andsi_1/0
+	orl	$-3, %edx	# 3036	[c=4 l=3]  *iorsi_1/0
+	leal	(%rax,%rcx,2), %ecx	# 3021	[c=8 l=3]  *leasi
+	movzbl	%r13b, %eax	# 3024	[c=4 l=4]  *zero_extendqisi2/0
+	subl	%esi, %eax	# 3026	[c=4 l=2]  *subsi_1/0
+	imull	$260, %ecx, %ecx	# 3031	[c=12 l=6]  *mulsi3_1/1
+	movl	%r14d, %esi	# 16049	[c=4 l=3]  *movsi_internal/0
+	andl	$1, %esi	# 3028	[c=4 l=3]  *andsi_1/0
+	subl	%esi, %eax	# 3029	[c=4 l=2]  *subsi_1/0
+	andl	$7680, %ecx	# 3032	[c=4 l=6]  *andsi_1/0
+	andl	$511, %eax	# 3030	[c=4 l=5]  *andsi_1/0
+	orl	%ecx, %eax	# 3033	[c=5 l=2]  *iorsi_1_zext
+	leaq	flag_update_table_sub8(%rip), %rcx	# 15680	[c=1 l=7]  *movdi_internal/4
+	movzbl	(%rcx,%rax), %r13d	# 3035	[c=13 l=5]  *zero_extendqisi2/0
+	movl	$95, %eax	# 3038	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r12), %eax	# 3039	[c=13 l=8]  *subsi_1/1
+	andl	%edx, %r13d	# 3037	[c=4 l=3]  *andsi_1/0
+	cmpl	5180(%r12), %eax	# 3040	[c=13 l=8]  *cmpsi_1/1
+	jb	.L435	# 3041	[c=13 l=2]  *jcc
+	cmpb	$0, 1082(%r12)	# 3043	[c=13 l=9]  *cmpqi_ccno_1/1
+	jne	.L1346	# 3044	[c=13 l=6]  *jcc
+.L435:
+	movl	%r14d, %ecx	# 3052	[c=4 l=3]  *movsi_internal/0
+	andl	$-64, %r14d	# 3058	[c=4 l=4]  *andsi_1/0
+	movl	$95, %edx	# 3053	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 3056	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC28(%rip), %rsi	# 3054	[c=1 l=7]  *movdi_internal/4
+	orl	%r13d, %r14d	# 3059	[c=4 l=3]  *iorsi_1/0
+	call	log_add_data_mov@PLT	# 3057	[c=0 l=5]  *call
+	movzbl	%r14b, %ecx	# 3060	[c=4 l=4]  *zero_extendqisi2/0
+	movl	$95, %edx	# 3062	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 3065	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC30(%rip), %rsi	# 3063	[c=1 l=7]  *movdi_internal/4
+	call	log_add_data_mov@PLT	# 3066	[c=0 l=5]  *call
+	movl	$95, %eax	# 3067	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r12), %eax	# 3068	[c=13 l=8]  *subsi_1/1
+	cmpl	5180(%r12), %eax	# 3069	[c=13 l=8]  *cmpsi_1/1
+	jb	.L436	# 3070	[c=13 l=2]  *jcc
+	cmpb	$0, 1082(%r12)	# 3072	[c=13 l=9]  *cmpqi_ccno_1/1
+	jne	.L437	# 3073	[c=13 l=6]  *jcc
+.L436:
+	movq	1040(%r12), %rax	# 3076	[c=9 l=8]  *movdi_internal/3
+	movb	%r14b, 95(%rax)	# 3077	[c=4 l=4]  *movqi_internal/8
+.L438:
+	movq	%r12, %rdi	# 3089	[c=4 l=3]  *movdi_internal/3
+	movq	%rbp, %rsi	# 3088	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 3090	[c=0 l=5]  *call
+	movq	40(%r12), %rax	# 16051	[c=9 l=5]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 16052	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 3092	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 17401	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r12)	# 3093	[c=4 l=5]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 3095	[c=4 l=3]  *cmpdi_1/0
+	jb	.L297	# 3096	[c=13 l=6]  *jcc
+	movl	(%r12), %r8d	# 3098	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r12, %rdi	# 3103	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r8	# 3099	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r12), %r8	# 3101	[c=13 l=8]  *adddi_1/1
+	movq	%r8, %rbp	# 16054	[c=4 l=3]  *movdi_internal/3
+	movq	%r8, %rsi	# 3102	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 3104	[c=0 l=5]  *call
+	movzbl	9(%rbp), %eax	# 3105	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, (%r12)	# 3106	[c=9 l=4]  *addsi_1/0
+	leaq	handler.1(%rip), %rdi	# 16057	[c=1 l=7]  *movdi_internal/4
+	movzbl	8(%rbp), %eax	# 3109	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 16055	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 3110	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbx,%rdx), %rdx	# 3113	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r12)	# 3114	[c=13 l=5]  *adddi_1/0
+	jmp	*(%rdi,%rax,8)	# 18699	[c=10 l=3]  *indirect_jump
+.L420:
+	movzbl	10(%rbp), %edx	# 2734	[c=13 l=4]  zero_extendqidi2/0
+	movq	1040(%r12), %rax	# 2737	[c=9 l=8]  *movdi_internal/3
+	leaq	.LC43(%rip), %rsi	# 2741	[c=1 l=7]  *movdi_internal/4
+	movq	%r12, %rdi	# 2743	[c=4 l=3]  *movdi_internal/3
+	movzbl	(%rax,%rdx), %ecx	# 2738	[c=13 l=4]  *zero_extendqisi2/0
+	xorl	%eax, %eax	# 18706	[c=4 l=2]  *movdi_xor
+	movq	%rdx, %r13	# 17659	[c=4 l=3]  *movdi_internal/3
+	movl	%edx, 8(%rsp)	# 17090	[c=4 l=4]  *movsi_internal/1
+	call	log_append@PLT	# 2745	[c=0 l=5]  *call
+	movq	1040(%r12), %rax	# 2746	[c=9 l=8]  *movdi_internal/3
+	movl	8(%rsp), %edx	# 17091	[c=9 l=4]  *movsi_internal/0
+	movq	%r12, %rdi	# 2754	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC59(%rip), %rsi	# 2752	[c=1 l=7]  *movdi_internal/4
+	movzbl	(%rax,%r13), %r15d	# 2747	[c=9 l=5]  *movqi_internal/4
+	xorl	%eax, %eax	# 18707	[c=4 l=2]  *movdi_xor
+	notl	%r15d	# 17404	[c=4 l=3]  *one_cmplsi2_1/0
+	movzbl	%r15b, %r14d	# 2749	[c=4 l=4]  zero_extendqidi2/0
+	movl	%r14d, %ecx	# 2750	[c=4 l=3]  *movsi_internal/0
+	call	log_append@PLT	# 2756	[c=0 l=5]  *call
+	movq	1040(%r12), %rax	# 2757	[c=9 l=8]  *movdi_internal/3
+	movb	%r15b, (%rax,%r13)	# 2758	[c=4 l=4]  *movqi_internal/8
+	leaq	flag_update_table_logical(%rip), %rax	# 15678	[c=1 l=7]  *movdi_internal/4
+	movzbl	(%rax,%r14), %r14d	# 2761	[c=9 l=5]  *movqi_internal/4
+	movl	$95, %eax	# 2764	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r12), %eax	# 2765	[c=13 l=8]  *subsi_1/1
+	orl	$1, %r14d	# 17405	[c=4 l=4]  *iorsi_1/0
+	movzbl	%r14b, %r14d	# 2763	[c=4 l=4]  *zero_extendqisi2/0
+	cmpl	5180(%r12), %eax	# 2766	[c=13 l=8]  *cmpsi_1/1
+	jb	.L421	# 2767	[c=13 l=2]  *jcc
+	cmpb	$0, 1082(%r12)	# 2769	[c=13 l=9]  *cmpqi_ccno_1/1
+	jne	.L422	# 2770	[c=13 l=6]  *jcc
+.L421:
+	movq	1040(%r12), %rax	# 2773	[c=9 l=8]  *movdi_internal/3
+	movzbl	95(%rax), %r13d	# 2774	[c=13 l=5]  *zero_extendqisi2/0
+.L423:
+	movl	%r13d, %ecx	# 2785	[c=4 l=3]  *movsi_internal/0
+	andl	$-32, %r13d	# 2791	[c=4 l=4]  *andsi_1/0
+	movl	$95, %edx	# 2786	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 2789	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC28(%rip), %rsi	# 2787	[c=1 l=7]  *movdi_internal/4
+	orl	%r14d, %r13d	# 2792	[c=4 l=3]  *iorsi_1/0
+	call	log_add_data_mov@PLT	# 2790	[c=0 l=5]  *call
+	movzbl	%r13b, %ecx	# 2793	[c=4 l=4]  *zero_extendqisi2/0
+	movl	$95, %edx	# 2795	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 2798	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC30(%rip), %rsi	# 2796	[c=1 l=7]  *movdi_internal/4
+	call	log_add_data_mov@PLT	# 2799	[c=0 l=5]  *call
+	movl	$95, %eax	# 2800	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r12), %eax	# 2801	[c=13 l=8]  *subsi_1/1
+	cmpl	5180(%r12), %eax	# 2802	[c=13 l=8]  *cmpsi_1/1
+	jb	.L424	# 2803	[c=13 l=2]  *jcc
+	cmpb	$0, 1082(%r12)	# 2805	[c=13 l=9]  *cmpqi_ccno_1/1
+	jne	.L425	# 2806	[c=13 l=6]  *jcc
+.L424:
+	movq	1040(%r12), %rax	# 2809	[c=9 l=8]  *movdi_internal/3
+	movb	%r13b, 95(%rax)	# 2810	[c=4 l=4]  *movqi_internal/8
+.L426:
+	movq	%r12, %rdi	# 2822	[c=4 l=3]  *movdi_internal/3
+	movq	%rbp, %rsi	# 2821	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 2823	[c=0 l=5]  *call
+	movq	40(%r12), %rax	# 16027	[c=9 l=5]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 16028	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 2825	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 17403	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r12)	# 2826	[c=4 l=5]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 2828	[c=4 l=3]  *cmpdi_1/0
+	jb	.L297	# 2829	[c=13 l=6]  *jcc
+	movl	(%r12), %r8d	# 2831	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r12, %rdi	# 2836	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r8	# 2832	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r12), %r8	# 2834	[c=13 l=8]  *adddi_1/1
+	movq	%r8, %rbp	# 16030	[c=4 l=3]  *movdi_internal/3
+	movq	%r8, %rsi	# 2835	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 2837	[c=0 l=5]  *call
+	movzbl	9(%rbp), %eax	# 2838	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, (%r12)	# 2839	[c=9 l=4]  *addsi_1/0
+	leaq	handler.1(%rip), %rdi	# 16033	[c=1 l=7]  *movdi_internal/4
+	movzbl	8(%rbp), %eax	# 2842	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 16031	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 2843	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbx,%rdx), %rdx	# 2846	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r12)	# 2847	[c=13 l=5]  *adddi_1/0
+	jmp	*(%rdi,%rax,8)	# 18705	[c=10 l=3]  *indirect_jump
+.L439:
+	movzwl	12(%rbp), %r14d	# 3122	[c=13 l=5]  *zero_extendhisi2/0
+	movzbl	10(%rbp), %ecx	# 3124	[c=9 l=4]  *movqi_internal/4
+	movq	%r12, %rdi	# 3128	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 18697	[c=4 l=2]  *movdi_xor
+	leaq	.LC60(%rip), %rsi	# 3126	[c=1 l=7]  *movdi_internal/4
+	movl	%r14d, %edx	# 3125	[c=4 l=3]  *movsi_internal/0
+	movb	%cl, 8(%rsp)	# 17096	[c=4 l=4]  *movqi_internal/8
+	call	log_append@PLT	# 3130	[c=0 l=5]  *call
+	movzbl	8(%rsp), %r15d	# 17097	[c=13 l=6]  zero_extendqidi2/0
+	movq	1040(%r12), %rax	# 3132	[c=9 l=8]  *movdi_internal/3
+	movq	%r12, %rdi	# 3139	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC43(%rip), %rsi	# 3137	[c=1 l=7]  *movdi_internal/4
+	movzbl	(%rax,%r15), %eax	# 3133	[c=13 l=5]  *zero_extendqisi2/0
+	movzbl	%r15b, %edx	# 3134	[c=4 l=4]  *zero_extendqisi2/0
+	movl	%eax, %ecx	# 3135	[c=4 l=2]  *movsi_internal/0
+	xorl	%eax, %eax	# 18698	[c=4 l=2]  *movdi_xor
+	call	log_append@PLT	# 3141	[c=0 l=5]  *call
+	movq	1040(%r12), %rcx	# 3142	[c=9 l=8]  *movdi_internal/3
+	movl	%r14d, %edx	# 16060	[c=4 l=3]  *movsi_internal/0
+	andl	$136, %edx	# 3148	[c=4 l=6]  *andsi_1/0
+	movzbl	(%rcx,%r15), %eax	# 3143	[c=9 l=5]  *movqi_internal/4
+	movl	%eax, %esi	# 16058	[c=4 l=2]  *movsi_internal/0
+	movzbl	%al, %r13d	# 3150	[c=4 l=4]  *zero_extendqisi2/0
+	andl	$136, %esi	# 3145	[c=4 l=6]  *andsi_1/0
+	subl	%r14d, %r13d	# 3151	[c=4 l=3]  *subsi_1/0
+	leal	(%rdx,%rsi,2), %edx	# 3149	[c=8 l=3]  *leasi
+	andl	$511, %r13d	# 3152	[c=4 l=7]  *andsi_1/0
+	imull	$260, %edx, %eax	# 3153	[c=12 l=6]  *mulsi3_1/1
+	andl	$7680, %eax	# 3154	[c=4 l=5]  *andsi_1/0
+	orl	%eax, %r13d	# 3155	[c=5 l=3]  *iorsi_1_zext
+	movl	$95, %eax	# 3156	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r12), %eax	# 3157	[c=13 l=8]  *subsi_1/1
+	cmpl	5180(%r12), %eax	# 3158	[c=13 l=8]  *cmpsi_1/1
+	jb	.L440	# 3159	[c=13 l=2]  *jcc
+	cmpb	$0, 1082(%r12)	# 3161	[c=13 l=9]  *cmpqi_ccno_1/1
+	jne	.L441	# 3162	[c=13 l=6]  *jcc
+.L440:
+	movzbl	95(%rcx), %r14d	# 3165	[c=13 l=5]  *zero_extendqisi2/0
+.L442:
+	movl	%r14d, %ecx	# 3176	[c=4 l=3]  *movsi_internal/0
+	movl	$95, %edx	# 3177	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 3180	[c=4 l=3]  *movdi_internal/3
+	andl	$-64, %r14d	# 3182	[c=4 l=4]  *andsi_1/0
+	leaq	.LC28(%rip), %rsi	# 3178	[c=1 l=7]  *movdi_internal/4
+	call	log_add_data_mov@PLT	# 3181	[c=0 l=5]  *call
+	leaq	flag_update_table_sub8(%rip), %rax	# 15681	[c=1 l=7]  *movdi_internal/4
+	movl	$95, %edx	# 3189	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 3192	[c=4 l=3]  *movdi_internal/3
+	movzbl	(%rax,%r13), %eax	# 3185	[c=13 l=5]  *zero_extendqisi2/0
+	leaq	.LC30(%rip), %rsi	# 3190	[c=1 l=7]  *movdi_internal/4
+	orl	%eax, %r14d	# 3186	[c=4 l=3]  *iorsi_1/0
+	movzbl	%r14b, %ecx	# 3187	[c=4 l=4]  *zero_extendqisi2/0
+	call	log_add_data_mov@PLT	# 3193	[c=0 l=5]  *call
+	movl	$95, %eax	# 3194	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r12), %eax	# 3195	[c=13 l=8]  *subsi_1/1
+	cmpl	5180(%r12), %eax	# 3196	[c=13 l=8]  *cmpsi_1/1
+	jb	.L443	# 3197	[c=13 l=2]  *jcc
+	cmpb	$0, 1082(%r12)	# 3199	[c=13 l=9]  *cmpqi_ccno_1/1
+	jne	.L444	# 3200	[c=13 l=6]  *jcc
+.L443:
+	movq	1040(%r12), %rax	# 3203	[c=9 l=8]  *movdi_internal/3
+	movb	%r14b, 95(%rax)	# 3204	[c=4 l=4]  *movqi_internal/8
+.L445:
+	movq	%r12, %rdi	# 3216	[c=4 l=3]  *movdi_internal/3
+	movq	%rbp, %rsi	# 3215	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 3217	[c=0 l=5]  *call
+	movq	40(%r12), %rax	# 16062	[c=9 l=5]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 16063	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 3219	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 17400	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r12)	# 3220	[c=4 l=5]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 3222	[c=4 l=3]  *cmpdi_1/0
+	jb	.L297	# 3223	[c=13 l=6]  *jcc
+	movl	(%r12), %r8d	# 3225	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r12, %rdi	# 3230	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r8	# 3226	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r12), %r8	# 3228	[c=13 l=8]  *adddi_1/1
+	movq	%r8, %rbp	# 16065	[c=4 l=3]  *movdi_internal/3
+	movq	%r8, %rsi	# 3229	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 3231	[c=0 l=5]  *call
+	movzbl	9(%rbp), %eax	# 3232	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, (%r12)	# 3233	[c=9 l=4]  *addsi_1/0
+	leaq	handler.1(%rip), %rdi	# 16068	[c=1 l=7]  *movdi_internal/4
+	movzbl	8(%rbp), %eax	# 3236	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 16066	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 3237	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbx,%rdx), %rdx	# 3240	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r12)	# 3241	[c=13 l=5]  *adddi_1/0
+	jmp	*(%rdi,%rax,8)	# 18696	[c=10 l=3]  *indirect_jump
+.L446:
+	movzbl	10(%rbp), %r14d	# 3250	[c=13 l=5]  zero_extendqidi2/0
+	movq	%r12, %rdi	# 3259	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 18694	[c=4 l=2]  *movdi_xor
+	movzwl	12(%rbp), %r13d	# 3249	[c=9 l=5]  *movhi_internal/2
+	movq	1040(%r12), %rdx	# 3252	[c=9 l=8]  *movdi_internal/3
+	leaq	.LC43(%rip), %r15	# 3257	[c=1 l=7]  *movdi_internal/4
+	movq	%r15, %rsi	# 3258	[c=4 l=3]  *movdi_internal/3
+	movzbl	(%rdx,%r14), %ecx	# 3253	[c=13 l=5]  *zero_extendqisi2/0
+	movzbl	%r14b, %edx	# 3254	[c=4 l=4]  *zero_extendqisi2/0
+	call	log_append@PLT	# 3261	[c=0 l=5]  *call
+	movzwl	%r13w, %edx	# 3266	[c=4 l=4]  *zero_extendhisi2/0
+	movq	%r15, %rsi	# 3270	[c=4 l=3]  *movdi_internal/3
+	movq	%r12, %rdi	# 3271	[c=4 l=3]  *movdi_internal/3
+	movq	1040(%r12), %rax	# 3262	[c=9 l=8]  *movdi_internal/3
+	movzbl	(%rax,%r14), %r9d	# 3263	[c=9 l=5]  *movqi_internal/4
+	movzwl	%r13w, %r14d	# 3264	[c=4 l=4]  zero_extendhidi2/0
+	movzbl	(%rax,%r14), %ecx	# 3265	[c=13 l=5]  *zero_extendqisi2/0
+	xorl	%eax, %eax	# 18695	[c=4 l=2]  *movdi_xor
+	movb	%r9b, 8(%rsp)	# 17098	[c=4 l=5]  *movqi_internal/8
+	call	log_append@PLT	# 3273	[c=0 l=5]  *call
+	movq	1040(%r12), %rax	# 3274	[c=9 l=8]  *movdi_internal/3
+	movzbl	8(%rsp), %r9d	# 17099	[c=9 l=6]  *movqi_internal/4
+	cmpb	(%rax,%r14), %r9b	# 3275	[c=13 l=4]  *cmpqi_1/1
+	jne	.L447	# 3276	[c=13 l=2]  *jcc
+	movl	(%r12), %eax	# 16069	[c=5 l=4]  *movsi_internal/0
+	addq	$1, 48(%r12)	# 3284	[c=13 l=6]  *adddi_1/0
+	addl	$1, %eax	# 3279	[c=4 l=3]  *addsi_1/0
+	andl	992(%r12), %eax	# 3282	[c=13 l=8]  *andsi_1/1
+	movl	%eax, (%r12)	# 3283	[c=4 l=4]  *movsi_internal/1
+.L447:
+	movq	%r12, %rdi	# 3288	[c=4 l=3]  *movdi_internal/3
+	movq	%rbp, %rsi	# 3287	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 3289	[c=0 l=5]  *call
+	movq	40(%r12), %rax	# 16070	[c=9 l=5]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 16071	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 3291	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 17399	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r12)	# 3292	[c=4 l=5]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 3294	[c=4 l=3]  *cmpdi_1/0
+	jb	.L297	# 3295	[c=13 l=6]  *jcc
+	movq	56(%r12), %rax	# 16072	[c=9 l=5]  *movdi_internal/3
+	cmpq	%rax, 48(%r12)	# 3298	[c=13 l=5]  *cmpdi_1/0
+	jnb	.L1347	# 3299	[c=13 l=6]  *jcc
+.L448:
+	movq	%r12, %rdi	# 3305	[c=4 l=3]  *movdi_internal/3
+	call	log_is_idle@PLT	# 3306	[c=10 l=5]  *call_value
+	testb	%al, %al	# 3308	[c=4 l=2]  *cmpqi_ccno_1/0
+	jne	.L1348	# 3309	[c=13 l=6]  *jcc
+.L449:
+	movl	(%r12), %r8d	# 3320	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r12, %rdi	# 3325	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r8	# 3321	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r12), %r8	# 3323	[c=13 l=8]  *adddi_1/1
+	movq	%r8, %rbp	# 16074	[c=4 l=3]  *movdi_internal/3
+	movq	%r8, %rsi	# 3324	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 3326	[c=0 l=5]  *call
+	movzbl	9(%rbp), %eax	# 3327	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, (%r12)	# 3328	[c=9 l=4]  *addsi_1/0
+	leaq	handler.1(%rip), %rdi	# 16077	[c=1 l=7]  *movdi_internal/4
+	movzbl	8(%rbp), %eax	# 3331	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 16075	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 3332	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbx,%rdx), %rdx	# 3335	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r12)	# 3336	[c=13 l=5]  *adddi_1/0
+	jmp	*(%rdi,%rax,8)	# 18693	[c=10 l=3]  *indirect_jump
+.L450:
+	movzbl	10(%rbp), %r14d	# 3345	[c=13 l=5]  zero_extendqidi2/0
+	movq	%r12, %rdi	# 3354	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 18691	[c=4 l=2]  *movdi_xor
+	movzwl	12(%rbp), %r13d	# 3344	[c=9 l=5]  *movhi_internal/2
+	movq	1040(%r12), %rdx	# 3347	[c=9 l=8]  *movdi_internal/3
+	leaq	.LC43(%rip), %r15	# 3352	[c=1 l=7]  *movdi_internal/4
+	movq	%r15, %rsi	# 3353	[c=4 l=3]  *movdi_internal/3
+	movzbl	(%rdx,%r14), %ecx	# 3348	[c=13 l=5]  *zero_extendqisi2/0
+	movzbl	%r14b, %edx	# 3349	[c=4 l=4]  *zero_extendqisi2/0
+	call	log_append@PLT	# 3356	[c=0 l=5]  *call
+	movzwl	%r13w, %edx	# 3361	[c=4 l=4]  *zero_extendhisi2/0
+	movq	%r15, %rsi	# 3365	[c=4 l=3]  *movdi_internal/3
+	movq	%r12, %rdi	# 3366	[c=4 l=3]  *movdi_internal/3
+	movq	1040(%r12), %rax	# 3357	[c=9 l=8]  *movdi_internal/3
+	movzbl	(%rax,%r14), %r9d	# 3358	[c=9 l=5]  *movqi_internal/4
+	movzwl	%r13w, %r14d	# 3359	[c=4 l=4]  zero_extendhidi2/0
+	movzbl	(%rax,%r14), %ecx	# 3360	[c=13 l=5]  *zero_extendqisi2/0
+	xorl	%eax, %eax	# 18692	[c=4 l=2]  *movdi_xor
+	movb	%r9b, 8(%rsp)	# 17100	[c=4 l=5]  *movqi_internal/8
+	call	log_append@PLT	# 3368	[c=0 l=5]  *call
+	movq	1040(%r12), %rax	# 3369	[c=9 l=8]  *movdi_internal/3
+	movzbl	8(%rsp), %r9d	# 17101	[c=9 l=6]  *movqi_internal/4
+	cmpb	(%rax,%r14), %r9b	# 3370	[c=13 l=4]  *cmpqi_1/1
+	jne	.L451	# 3371	[c=13 l=2]  *jcc
+	movl	(%r12), %eax	# 16078	[c=5 l=4]  *movsi_internal/0
+	addq	$2, 48(%r12)	# 3379	[c=13 l=6]  *adddi_1/0
+	addl	$2, %eax	# 3374	[c=4 l=3]  *addsi_1/0
+	andl	992(%r12), %eax	# 3377	[c=13 l=8]  *andsi_1/1
+	movl	%eax, (%r12)	# 3378	[c=4 l=4]  *movsi_internal/1
+.L451:
+	movq	%r12, %rdi	# 3383	[c=4 l=3]  *movdi_internal/3
+	movq	%rbp, %rsi	# 3382	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 3384	[c=0 l=5]  *call
+	movq	40(%r12), %rax	# 16079	[c=9 l=5]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 16080	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 3386	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 17398	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r12)	# 3387	[c=4 l=5]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 3389	[c=4 l=3]  *cmpdi_1/0
+	jb	.L297	# 3390	[c=13 l=6]  *jcc
+	movq	56(%r12), %rax	# 16081	[c=9 l=5]  *movdi_internal/3
+	cmpq	%rax, 48(%r12)	# 3393	[c=13 l=5]  *cmpdi_1/0
+	jnb	.L1349	# 3394	[c=13 l=6]  *jcc
+.L452:
+	movq	%r12, %rdi	# 3400	[c=4 l=3]  *movdi_internal/3
+	call	log_is_idle@PLT	# 3401	[c=10 l=5]  *call_value
+	testb	%al, %al	# 3403	[c=4 l=2]  *cmpqi_ccno_1/0
+	jne	.L1350	# 3404	[c=13 l=6]  *jcc
+.L453:
+	movl	(%r12), %r8d	# 3415	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r12, %rdi	# 3420	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r8	# 3416	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r12), %r8	# 3418	[c=13 l=8]  *adddi_1/1
+	movq	%r8, %rbp	# 16083	[c=4 l=3]  *movdi_internal/3
+	movq	%r8, %rsi	# 3419	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 3421	[c=0 l=5]  *call
+	movzbl	9(%rbp), %eax	# 3422	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, (%r12)	# 3423	[c=9 l=4]  *addsi_1/0
+	leaq	handler.1(%rip), %rdi	# 16086	[c=1 l=7]  *movdi_internal/4
+	movzbl	8(%rbp), %eax	# 3426	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 16084	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 3427	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbx,%rdx), %rdx	# 3430	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r12)	# 3431	[c=13 l=5]  *adddi_1/0
+	jmp	*(%rdi,%rax,8)	# 18690	[c=10 l=3]  *indirect_jump
+.L454:
+	movzbl	10(%rbp), %edx	# 3439	[c=13 l=4]  zero_extendqidi2/0
+	movq	1040(%r12), %rax	# 3442	[c=9 l=8]  *movdi_internal/3
+	leaq	.LC43(%rip), %rsi	# 3446	[c=1 l=7]  *movdi_internal/4
+	movq	%r12, %rdi	# 3448	[c=4 l=3]  *movdi_internal/3
+	movzbl	(%rax,%rdx), %ecx	# 3443	[c=13 l=4]  *zero_extendqisi2/0
+	xorl	%eax, %eax	# 18688	[c=4 l=2]  *movdi_xor
+	movq	%rdx, %r13	# 17669	[c=4 l=3]  *movdi_internal/3
+	movl	%edx, 8(%rsp)	# 17102	[c=4 l=4]  *movsi_internal/1
+	call	log_append@PLT	# 3450	[c=0 l=5]  *call
+	movq	1040(%r12), %rax	# 3451	[c=9 l=8]  *movdi_internal/3
+	movl	8(%rsp), %edx	# 17103	[c=9 l=4]  *movsi_internal/0
+	movq	%r12, %rdi	# 3462	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC59(%rip), %rsi	# 3460	[c=1 l=7]  *movdi_internal/4
+	movzbl	(%rax,%r13), %eax	# 3452	[c=9 l=5]  *movqi_internal/4
+	leal	-1(%rax), %r14d	# 17396	[c=4 l=4]  *leasi
+	leal	-1(%rax), %r15d	# 17397	[c=4 l=4]  *leasi
+	xorl	%eax, %eax	# 18689	[c=4 l=2]  *movdi_xor
+	movzbl	%r14b, %r14d	# 3455	[c=4 l=4]  zero_extendqidi2/0
+	movl	%r14d, %ecx	# 3457	[c=4 l=3]  *movsi_internal/0
+	call	log_append@PLT	# 3464	[c=0 l=5]  *call
+	movq	1040(%r12), %rax	# 3465	[c=9 l=8]  *movdi_internal/3
+	movb	%r15b, (%rax,%r13)	# 3466	[c=4 l=4]  *movqi_internal/8
+	movl	$95, %eax	# 3467	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r12), %eax	# 3468	[c=13 l=8]  *subsi_1/1
+	cmpl	5180(%r12), %eax	# 3469	[c=13 l=8]  *cmpsi_1/1
+	jb	.L455	# 3470	[c=13 l=2]  *jcc
+	cmpb	$0, 1082(%r12)	# 3472	[c=13 l=9]  *cmpqi_ccno_1/1
+	jne	.L456	# 3473	[c=13 l=6]  *jcc
+.L455:
+	movq	1040(%r12), %rax	# 3476	[c=9 l=8]  *movdi_internal/3
+	movzbl	95(%rax), %r13d	# 3477	[c=13 l=5]  *zero_extendqisi2/0
+.L457:
+	movl	%r13d, %ecx	# 3488	[c=4 l=3]  *movsi_internal/0
+	movl	$95, %edx	# 3489	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 3492	[c=4 l=3]  *movdi_internal/3
+	andl	$-31, %r13d	# 3494	[c=4 l=4]  *andsi_1/0
+	leaq	.LC28(%rip), %rsi	# 3490	[c=1 l=7]  *movdi_internal/4
+	call	log_add_data_mov@PLT	# 3493	[c=0 l=5]  *call
+	leaq	flag_update_table_dec(%rip), %rax	# 15682	[c=1 l=7]  *movdi_internal/4
+	movl	$95, %edx	# 3501	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 3504	[c=4 l=3]  *movdi_internal/3
+	movzbl	(%rax,%r14), %eax	# 3497	[c=13 l=5]  *zero_extendqisi2/0
+	leaq	.LC30(%rip), %rsi	# 3502	[c=1 l=7]  *movdi_internal/4
+	orl	%eax, %r13d	# 3498	[c=4 l=3]  *iorsi_1/0
+	movzbl	%r13b, %ecx	# 3499	[c=4 l=4]  *zero_extendqisi2/0
+	call	log_add_data_mov@PLT	# 3505	[c=0 l=5]  *call
+	movl	$95, %eax	# 3506	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r12), %eax	# 3507	[c=13 l=8]  *subsi_1/1
+	cmpl	5180(%r12), %eax	# 3508	[c=13 l=8]  *cmpsi_1/1
+	jb	.L458	# 3509	[c=13 l=2]  *jcc
+	cmpb	$0, 1082(%r12)	# 3511	[c=13 l=9]  *cmpqi_ccno_1/1
+	jne	.L459	# 3512	[c=13 l=6]  *jcc
+.L458:
+	movq	1040(%r12), %rax	# 3515	[c=9 l=8]  *movdi_internal/3
+	movb	%r13b, 95(%rax)	# 3516	[c=4 l=4]  *movqi_internal/8
+.L460:
+	movq	%r12, %rdi	# 3528	[c=4 l=3]  *movdi_internal/3
+	movq	%rbp, %rsi	# 3527	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 3529	[c=0 l=5]  *call
+	movq	40(%r12), %rax	# 16087	[c=9 l=5]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 16088	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 3531	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 17395	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r12)	# 3532	[c=4 l=5]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 3534	[c=4 l=3]  *cmpdi_1/0
+	jb	.L297	# 3535	[c=13 l=6]  *jcc
+	movl	(%r12), %r8d	# 3537	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r12, %rdi	# 3542	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r8	# 3538	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r12), %r8	# 3540	[c=13 l=8]  *adddi_1/1
+	movq	%r8, %rbp	# 16090	[c=4 l=3]  *movdi_internal/3
+	movq	%r8, %rsi	# 3541	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 3543	[c=0 l=5]  *call
+	movzbl	9(%rbp), %eax	# 3544	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, (%r12)	# 3545	[c=9 l=4]  *addsi_1/0
+	leaq	handler.1(%rip), %rdi	# 16093	[c=1 l=7]  *movdi_internal/4
+	movzbl	8(%rbp), %eax	# 3548	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 16091	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 3549	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbx,%rdx), %rdx	# 3552	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r12)	# 3553	[c=13 l=5]  *adddi_1/0
+	jmp	*(%rdi,%rax,8)	# 18687	[c=10 l=3]  *indirect_jump
+.L461:
+	movl	(%r12), %eax	# 16094	[c=5 l=4]  *movsi_internal/0
+	movq	1056(%r12), %rdx	# 3566	[c=9 l=8]  *movdi_internal/3
+	leaq	.LC34(%rip), %rsi	# 3569	[c=1 l=7]  *movdi_internal/4
+	movq	%r12, %rdi	# 3571	[c=4 l=3]  *movdi_internal/3
+	subl	$1, %eax	# 3562	[c=4 l=3]  *addsi_1/0
+	movl	%eax, (%r12)	# 3563	[c=4 l=4]  *movsi_internal/1
+	addl	%eax, %eax	# 3564	[c=5 l=2]  *ashlsi3_1_zext/0
+	movzwl	(%rdx,%rax), %ebx	# 3567	[c=13 l=4]  *zero_extendhisi2/0
+	xorl	%eax, %eax	# 18685	[c=4 l=2]  *movdi_xor
+	movl	%ebx, %edx	# 3568	[c=4 l=2]  *movsi_internal/0
+	call	log_append@PLT	# 3573	[c=0 l=5]  *call
+	xorl	%esi, %esi	# 18686	[c=4 l=2]  *movdi_xor
+	movq	%r12, %rdi	# 3576	[c=4 l=3]  *movdi_internal/3
+	movl	$1, 72(%r12)	# 3574	[c=4 l=9]  *movsi_internal/1
+	call	log_dump_line@PLT	# 3577	[c=0 l=5]  *call
+	movl	%ebx, %ecx	# 3578	[c=4 l=2]  *movsi_internal/0
+.L1221:
+	leaq	.LC37(%rip), %rdx	# 3579	[c=1 l=7]  *movdi_internal/4
+	movl	$8, %esi	# 3581	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 3582	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 18684	[c=4 l=2]  *movdi_xor
+	call	leave	# 3584	[c=0 l=5]  *call
+.L462:
+	cmpb	$0, 841(%r12)	# 3588	[c=13 l=9]  *cmpqi_ccno_1/1
+	je	.L1220	# 3589	[c=13 l=6]  *jcc
+	movl	5176(%r12), %edx	# 3616	[c=9 l=8]  *movsi_internal/0
+	movl	$93, %eax	# 3620	[c=4 l=5]  *movsi_internal/0
+	movl	5180(%r12), %r14d	# 3617	[c=9 l=8]  *movsi_internal/0
+	movl	$94, %r13d	# 3618	[c=4 l=6]  *movsi_internal/0
+	subl	%edx, %eax	# 3621	[c=4 l=2]  *subsi_1/0
+	subl	%edx, %r13d	# 3619	[c=4 l=3]  *subsi_1/0
+	cmpl	%r14d, %eax	# 3622	[c=4 l=3]  *cmpsi_1/0
+	jb	.L464	# 3623	[c=13 l=6]  *jcc
+	cmpb	$1, 1082(%r12)	# 3627	[c=13 l=9]  *cmpqi_1/0
+	ja	.L1351	# 3628	[c=13 l=6]  *jcc
+	movq	1040(%r12), %rax	# 13499	[c=9 l=8]  *movdi_internal/3
+	movzbl	93(%rax), %edx	# 13500	[c=13 l=4]  *zero_extendqisi2/0
+.L466:
+	movzbl	94(%rax), %r15d	# 3661	[c=13 l=5]  *zero_extendqisi2/0
+.L468:
+	sall	$8, %r15d	# 3664	[c=4 l=4]  *ashlsi3_1/0
+	leaq	.LC32(%rip), %rsi	# 3668	[c=1 l=7]  *movdi_internal/4
+	movq	%r12, %rdi	# 3670	[c=4 l=3]  *movdi_internal/3
+	orl	%edx, %r15d	# 3665	[c=4 l=3]  *iorsi_1/0
+	movl	$93, %edx	# 3667	[c=4 l=5]  *movsi_internal/0
+	movl	%r15d, %ecx	# 3666	[c=4 l=3]  *movsi_internal/0
+	call	log_add_data_mov@PLT	# 3671	[c=0 l=5]  *call
+	movl	996(%r12), %edx	# 3673	[c=9 l=8]  *movsi_internal/0
+	movzbl	840(%r12), %eax	# 3675	[c=13 l=9]  *zero_extendqisi2/0
+	leal	1(%rdx,%rax), %eax	# 3676	[c=5 l=4]  *leasi
+	cmpl	%eax, %r15d	# 3677	[c=4 l=3]  *cmpsi_1/0
+	jb	.L1226	# 3678	[c=13 l=6]  *jcc
+	cmpl	$95, %r15d	# 14282	[c=4 l=4]  *cmpsi_1/0
+	movl	(%r12), %r13d	# 3686	[c=5 l=4]  *movsi_internal/0
+	movl	%r15d, %edx	# 3695	[c=4 l=3]  *movsi_internal/0
+	movq	%r12, %rdi	# 3697	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC31(%rip), %rax	# 15708	[c=1 l=7]  *movdi_internal/4
+	leaq	.LC30(%rip), %rsi	# 15707	[c=1 l=7]  *movdi_internal/4
+	cmovne	%rax, %rsi	# 14283	[c=8 l=4]  *movdicc_noc/1
+	movzbl	%r13b, %ecx	# 3688	[c=4 l=4]  *zero_extendqisi2/0
+	leal	-1(%r15), %r14d	# 17394	[c=4 l=4]  *leasi
+	call	log_add_data_mov@PLT	# 3698	[c=0 l=5]  *call
+	movl	%r15d, %eax	# 16096	[c=4 l=3]  *movsi_internal/0
+	subl	5176(%r12), %eax	# 3699	[c=13 l=8]  *subsi_1/1
+	cmpl	5180(%r12), %eax	# 3700	[c=13 l=8]  *cmpsi_1/1
+	jb	.L471	# 3701	[c=13 l=2]  *jcc
+	movl	%r15d, %eax	# 16098	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %eax	# 3703	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 15667	[c=5 l=5]  *andsi_1_zext
+	cmpb	$0, 1080(%r12,%rax)	# 3706	[c=14 l=9]  *cmpqi_ccno_1/1
+	jne	.L472	# 3707	[c=13 l=6]  *jcc
+.L471:
+	movq	1040(%r12), %rdx	# 3711	[c=9 l=8]  *movdi_internal/3
+	movslq	%r15d, %rax	# 3710	[c=4 l=3]  *extendsidi2_rex64/1
+	movb	%r13b, (%rdx,%rax)	# 3712	[c=4 l=4]  *movqi_internal/8
+.L473:
+	movl	(%r12), %ecx	# 3723	[c=5 l=4]  *movsi_internal/0
+	movl	%r14d, %edx	# 3733	[c=4 l=3]  *movsi_internal/0
+	movq	%r12, %rdi	# 3735	[c=4 l=3]  *movdi_internal/3
+	leal	-2(%r15), %r13d	# 17393	[c=4 l=4]  *leasi
+	leaq	.LC30(%rip), %rsi	# 15709	[c=1 l=7]  *movdi_internal/4
+	movl	%ecx, %eax	# 16100	[c=4 l=2]  *movsi_internal/0
+	movzbl	%ch, %ecx	# 3726	[c=4 l=3]  *extzvsi
+	shrl	$8, %eax	# 3724	[c=4 l=3]  *lshrsi3_1/0
+	cmpl	$95, %r14d	# 14294	[c=4 l=4]  *cmpsi_1/0
+	movl	%eax, 8(%rsp)	# 16101	[c=4 l=4]  *movsi_internal/1
+	leaq	.LC31(%rip), %rax	# 15710	[c=1 l=7]  *movdi_internal/4
+	cmovne	%rax, %rsi	# 14295	[c=8 l=4]  *movdicc_noc/1
+	call	log_add_data_mov@PLT	# 3736	[c=0 l=5]  *call
+	movl	%r14d, %eax	# 16102	[c=4 l=3]  *movsi_internal/0
+	subl	5176(%r12), %eax	# 3737	[c=13 l=8]  *subsi_1/1
+	cmpl	5180(%r12), %eax	# 3738	[c=13 l=8]  *cmpsi_1/1
+	jb	.L475	# 3739	[c=13 l=2]  *jcc
+	movl	%r14d, %eax	# 16104	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %eax	# 3741	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 15666	[c=5 l=5]  *andsi_1_zext
+	cmpb	$0, 1080(%r12,%rax)	# 3744	[c=14 l=9]  *cmpqi_ccno_1/1
+	jne	.L476	# 3745	[c=13 l=6]  *jcc
+.L475:
+	movq	1040(%r12), %rax	# 3749	[c=9 l=8]  *movdi_internal/3
+	movzbl	8(%rsp), %edi	# 16106	[c=9 l=5]  *movqi_internal/4
+	movslq	%r14d, %r9	# 3748	[c=4 l=3]  *extendsidi2_rex64/1
+	movb	%dil, (%rax,%r9)	# 3750	[c=4 l=4]  *movqi_internal/8
+.L477:
+	cmpb	$0, 840(%r12)	# 3761	[c=13 l=9]  *cmpqi_ccno_1/1
+	je	.L478	# 3762	[c=13 l=2]  *jcc
+	movl	(%r12), %r14d	# 16107	[c=5 l=4]  *movsi_internal/0
+	subl	$3, %r15d	# 3766	[c=4 l=4]  *addsi_1/0
+	movq	%r12, %rdi	# 3776	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC31(%rip), %rdx	# 15712	[c=1 l=7]  *movdi_internal/4
+	leaq	.LC30(%rip), %rsi	# 15711	[c=1 l=7]  *movdi_internal/4
+	shrl	$16, %r14d	# 3765	[c=4 l=4]  *lshrsi3_1/0
+	cmpl	$95, %r13d	# 14306	[c=4 l=4]  *cmpsi_1/0
+	cmovne	%rdx, %rsi	# 14307	[c=8 l=4]  *movdicc_noc/1
+	movzbl	%r14b, %ecx	# 3767	[c=4 l=4]  *zero_extendqisi2/0
+	movl	%r13d, %edx	# 3774	[c=4 l=3]  *movsi_internal/0
+	call	log_add_data_mov@PLT	# 3777	[c=0 l=5]  *call
+	movl	%r13d, %edx	# 16109	[c=4 l=3]  *movsi_internal/0
+	subl	5176(%r12), %edx	# 3778	[c=13 l=8]  *subsi_1/1
+	cmpl	5180(%r12), %edx	# 3779	[c=13 l=8]  *cmpsi_1/1
+	jb	.L480	# 3780	[c=13 l=2]  *jcc
+	movl	%r13d, %edx	# 16111	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %edx	# 3782	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %edx	# 15665	[c=5 l=6]  *andsi_1_zext
+	cmpb	$0, 1080(%r12,%rdx)	# 3785	[c=14 l=9]  *cmpqi_ccno_1/1
+	jne	.L481	# 3786	[c=13 l=6]  *jcc
+.L480:
+	movq	1040(%r12), %rdx	# 3790	[c=9 l=8]  *movdi_internal/3
+	movslq	%r13d, %r13	# 3789	[c=4 l=3]  *extendsidi2_rex64/1
+	movb	%r14b, (%rdx,%r13)	# 3791	[c=4 l=4]  *movqi_internal/8
+.L482:
+	movl	%r15d, %r13d	# 24	[c=4 l=3]  *movsi_internal/0
+.L478:
+	movzwl	%r13w, %r14d	# 3806	[c=4 l=4]  *zero_extendhisi2/0
+	movl	$93, %edx	# 3808	[c=4 l=5]  *movsi_internal/0
+	leaq	.LC33(%rip), %rsi	# 3809	[c=1 l=7]  *movdi_internal/4
+	movq	%r12, %rdi	# 3811	[c=4 l=3]  *movdi_internal/3
+	movl	%r14d, %ecx	# 3807	[c=4 l=3]  *movsi_internal/0
+	call	log_add_data_mov@PLT	# 3812	[c=0 l=5]  *call
+	movl	$93, %eax	# 3813	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r12), %eax	# 3814	[c=13 l=8]  *subsi_1/1
+	cmpl	5180(%r12), %eax	# 3815	[c=13 l=8]  *cmpsi_1/1
+	jb	.L483	# 3816	[c=13 l=2]  *jcc
+	cmpb	$1, 1082(%r12)	# 3820	[c=13 l=9]  *cmpqi_1/0
+	ja	.L1352	# 3821	[c=13 l=6]  *jcc
+.L483:
+	movq	1040(%r12), %rax	# 3832	[c=9 l=8]  *movdi_internal/3
+	movb	%r13b, 93(%rax)	# 3833	[c=4 l=4]  *movqi_internal/8
+.L484:
+	movl	$94, %eax	# 3837	[c=4 l=5]  *movsi_internal/0
+	sarl	$8, %r14d	# 3836	[c=4 l=4]  *ashrsi3_1/0
+	subl	5176(%r12), %eax	# 3838	[c=13 l=8]  *subsi_1/1
+	cmpl	5180(%r12), %eax	# 3839	[c=13 l=8]  *cmpsi_1/1
+	jb	.L485	# 3840	[c=13 l=2]  *jcc
+	cmpb	$1, 1082(%r12)	# 3844	[c=13 l=9]  *cmpqi_1/0
+	ja	.L1353	# 3845	[c=13 l=6]  *jcc
+.L485:
+	movq	1040(%r12), %rax	# 3855	[c=9 l=8]  *movdi_internal/3
+	movb	%r14b, 94(%rax)	# 3856	[c=4 l=4]  *movqi_internal/8
+.L486:
+	movq	1040(%r12), %rax	# 3859	[c=9 l=8]  *movdi_internal/3
+	movl	$30, %edx	# 3862	[c=4 l=5]  *movsi_internal/0
+	leaq	.LC44(%rip), %rsi	# 3863	[c=1 l=7]  *movdi_internal/4
+	movq	%r12, %rdi	# 3865	[c=4 l=3]  *movdi_internal/3
+	movzwl	30(%rax), %r13d	# 3860	[c=13 l=5]  *zero_extendhisi2/0
+	xorl	%eax, %eax	# 18681	[c=4 l=2]  *movdi_xor
+	movl	%r13d, %ecx	# 3861	[c=4 l=3]  *movsi_internal/0
+	call	log_append@PLT	# 3867	[c=0 l=5]  *call
+	movl	$92, %eax	# 3868	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r12), %eax	# 3869	[c=13 l=8]  *subsi_1/1
+	cmpl	5180(%r12), %eax	# 3870	[c=13 l=8]  *cmpsi_1/1
+	jb	.L487	# 3871	[c=13 l=2]  *jcc
+	cmpb	$0, 1082(%r12)	# 3873	[c=13 l=9]  *cmpqi_ccno_1/1
+	jne	.L488	# 3874	[c=13 l=6]  *jcc
+.L487:
+	movq	1040(%r12), %rax	# 3877	[c=9 l=8]  *movdi_internal/3
+	movzbl	92(%rax), %r14d	# 3878	[c=13 l=5]  *zero_extendqisi2/0
+.L489:
+	leaq	.LC29(%rip), %rsi	# 3891	[c=1 l=7]  *movdi_internal/4
+	movl	%r14d, %ecx	# 3889	[c=4 l=3]  *movsi_internal/0
+	movl	$92, %edx	# 3890	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 3893	[c=4 l=3]  *movdi_internal/3
+	call	log_add_data_mov@PLT	# 3894	[c=0 l=5]  *call
+	movl	%r14d, %esi	# 16113	[c=4 l=3]  *movsi_internal/0
+	sall	$16, %esi	# 3895	[c=4 l=3]  *ashlsi3_1/0
+	orl	%r13d, %esi	# 3896	[c=4 l=3]  *iorsi_1/0
+	movl	%esi, (%r12)	# 3897	[c=4 l=4]  *movsi_internal/1
+	cmpl	%esi, 992(%r12)	# 3898	[c=13 l=8]  *cmpsi_1/0
+	jb	.L1225	# 3899	[c=13 l=6]  *jcc
+	movq	%r12, %rdi	# 3908	[c=4 l=3]  *movdi_internal/3
+	movq	%rbp, %rsi	# 3907	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 3909	[c=0 l=5]  *call
+	movq	40(%r12), %rax	# 16115	[c=9 l=5]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 16116	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 3911	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 17392	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r12)	# 3912	[c=4 l=5]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 3914	[c=4 l=3]  *cmpdi_1/0
+	jb	.L297	# 3915	[c=13 l=6]  *jcc
+	movq	56(%r12), %rax	# 16117	[c=9 l=5]  *movdi_internal/3
+	cmpq	%rax, 48(%r12)	# 3918	[c=13 l=5]  *cmpdi_1/0
+	jnb	.L1354	# 3919	[c=13 l=6]  *jcc
+.L491:
+	movq	%r12, %rdi	# 3925	[c=4 l=3]  *movdi_internal/3
+	call	log_is_idle@PLT	# 3926	[c=10 l=5]  *call_value
+	testb	%al, %al	# 3928	[c=4 l=2]  *cmpqi_ccno_1/0
+	jne	.L1355	# 3929	[c=13 l=6]  *jcc
+.L492:
+	movl	(%r12), %r8d	# 3940	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r12, %rdi	# 3945	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r8	# 3941	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r12), %r8	# 3943	[c=13 l=8]  *adddi_1/1
+	movq	%r8, %rbp	# 16119	[c=4 l=3]  *movdi_internal/3
+	movq	%r8, %rsi	# 3944	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 3946	[c=0 l=5]  *call
+	movzbl	9(%rbp), %eax	# 3947	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, (%r12)	# 3948	[c=9 l=4]  *addsi_1/0
+	leaq	handler.1(%rip), %rdi	# 16122	[c=1 l=7]  *movdi_internal/4
+	movzbl	8(%rbp), %eax	# 3951	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 16120	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 3952	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbx,%rdx), %rdx	# 3955	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r12)	# 3956	[c=13 l=5]  *adddi_1/0
+	jmp	*(%rdi,%rax,8)	# 18680	[c=10 l=3]  *indirect_jump
+.L493:
+	cmpb	$0, 841(%r12)	# 3964	[c=13 l=9]  *cmpqi_ccno_1/1
+	je	.L1220	# 3965	[c=13 l=6]  *jcc
+	movq	1040(%r12), %rax	# 3992	[c=9 l=8]  *movdi_internal/3
+	movl	$30, %edx	# 3995	[c=4 l=5]  *movsi_internal/0
+	leaq	.LC44(%rip), %rsi	# 3996	[c=1 l=7]  *movdi_internal/4
+	movq	%r12, %rdi	# 3998	[c=4 l=3]  *movdi_internal/3
+	movzwl	30(%rax), %r13d	# 3993	[c=13 l=5]  *zero_extendhisi2/0
+	xorl	%eax, %eax	# 18679	[c=4 l=2]  *movdi_xor
+	movl	%r13d, %ecx	# 3994	[c=4 l=3]  *movsi_internal/0
+	call	log_append@PLT	# 4000	[c=0 l=5]  *call
+	movl	$92, %eax	# 4001	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r12), %eax	# 4002	[c=13 l=8]  *subsi_1/1
+	cmpl	5180(%r12), %eax	# 4003	[c=13 l=8]  *cmpsi_1/1
+	jb	.L495	# 4004	[c=13 l=2]  *jcc
+	cmpb	$0, 1082(%r12)	# 4006	[c=13 l=9]  *cmpqi_ccno_1/1
+	jne	.L496	# 4007	[c=13 l=6]  *jcc
+.L495:
+	movq	1040(%r12), %rax	# 4010	[c=9 l=8]  *movdi_internal/3
+	movzbl	92(%rax), %r14d	# 4011	[c=13 l=5]  *zero_extendqisi2/0
+.L497:
+	leaq	.LC29(%rip), %rsi	# 4024	[c=1 l=7]  *movdi_internal/4
+	movl	%r14d, %ecx	# 4022	[c=4 l=3]  *movsi_internal/0
+	movl	$92, %edx	# 4023	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 4026	[c=4 l=3]  *movdi_internal/3
+	call	log_add_data_mov@PLT	# 4027	[c=0 l=5]  *call
+	movl	%r14d, %esi	# 16124	[c=4 l=3]  *movsi_internal/0
+	sall	$16, %esi	# 4028	[c=4 l=3]  *ashlsi3_1/0
+	orl	%r13d, %esi	# 4029	[c=4 l=3]  *iorsi_1/0
+	movl	%esi, (%r12)	# 4030	[c=4 l=4]  *movsi_internal/1
+	cmpl	%esi, 992(%r12)	# 4031	[c=13 l=8]  *cmpsi_1/0
+	jb	.L1225	# 4032	[c=13 l=6]  *jcc
+	movq	%r12, %rdi	# 4041	[c=4 l=3]  *movdi_internal/3
+	movq	%rbp, %rsi	# 4040	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 4042	[c=0 l=5]  *call
+	movq	40(%r12), %rax	# 16126	[c=9 l=5]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 16127	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 4044	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 17391	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r12)	# 4045	[c=4 l=5]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 4047	[c=4 l=3]  *cmpdi_1/0
+	jb	.L297	# 4048	[c=13 l=6]  *jcc
+	movq	56(%r12), %rax	# 16128	[c=9 l=5]  *movdi_internal/3
+	cmpq	%rax, 48(%r12)	# 4051	[c=13 l=5]  *cmpdi_1/0
+	jnb	.L1356	# 4052	[c=13 l=6]  *jcc
+.L499:
+	movq	%r12, %rdi	# 4058	[c=4 l=3]  *movdi_internal/3
+	call	log_is_idle@PLT	# 4059	[c=10 l=5]  *call_value
+	testb	%al, %al	# 4061	[c=4 l=2]  *cmpqi_ccno_1/0
+	jne	.L1357	# 4062	[c=13 l=6]  *jcc
+.L500:
+	movl	(%r12), %r8d	# 4073	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r12, %rdi	# 4078	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r8	# 4074	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r12), %r8	# 4076	[c=13 l=8]  *adddi_1/1
+	movq	%r8, %rbp	# 16130	[c=4 l=3]  *movdi_internal/3
+	movq	%r8, %rsi	# 4077	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 4079	[c=0 l=5]  *call
+	movzbl	9(%rbp), %eax	# 4080	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, (%r12)	# 4081	[c=9 l=4]  *addsi_1/0
+	leaq	handler.1(%rip), %rdi	# 16133	[c=1 l=7]  *movdi_internal/4
+	movzbl	8(%rbp), %eax	# 4084	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 16131	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 4085	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbx,%rdx), %rdx	# 4088	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r12)	# 4089	[c=13 l=5]  *adddi_1/0
+	jmp	*(%rdi,%rax,8)	# 18678	[c=10 l=3]  *indirect_jump
+.L501:
+	movq	1040(%r12), %rax	# 4097	[c=9 l=8]  *movdi_internal/3
+	movl	$30, %edx	# 4100	[c=4 l=5]  *movsi_internal/0
+	leaq	.LC44(%rip), %rsi	# 4101	[c=1 l=7]  *movdi_internal/4
+	movq	%r12, %rdi	# 4103	[c=4 l=3]  *movdi_internal/3
+	movzwl	30(%rax), %r13d	# 4098	[c=13 l=5]  *zero_extendhisi2/0
+	xorl	%eax, %eax	# 18677	[c=4 l=2]  *movdi_xor
+	movl	%r13d, %ecx	# 4099	[c=4 l=3]  *movsi_internal/0
+	call	log_append@PLT	# 4105	[c=0 l=5]  *call
+	movl	$91, %eax	# 4106	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r12), %eax	# 4107	[c=13 l=8]  *subsi_1/1
+	cmpl	5180(%r12), %eax	# 4108	[c=13 l=8]  *cmpsi_1/1
+	jb	.L502	# 4109	[c=13 l=2]  *jcc
+	cmpb	$0, 1082(%r12)	# 4111	[c=13 l=9]  *cmpqi_ccno_1/1
+	jne	.L503	# 4112	[c=13 l=6]  *jcc
+.L502:
+	movq	1040(%r12), %rax	# 4115	[c=9 l=8]  *movdi_internal/3
+	movzbl	91(%rax), %r14d	# 4116	[c=13 l=5]  *zero_extendqisi2/0
+.L504:
+	movl	%r14d, %ecx	# 4127	[c=4 l=3]  *movsi_internal/0
+	movl	$91, %edx	# 4128	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 4131	[c=4 l=3]  *movdi_internal/3
+	sall	$16, %r14d	# 4136	[c=4 l=4]  *ashlsi3_1/0
+	leaq	.LC29(%rip), %rsi	# 4129	[c=1 l=7]  *movdi_internal/4
+	orl	%r13d, %r14d	# 4137	[c=4 l=3]  *iorsi_1/0
+	call	log_add_data_mov@PLT	# 4132	[c=0 l=5]  *call
+	movl	992(%r12), %eax	# 4133	[c=9 l=8]  *movsi_internal/0
+	movq	1056(%r12), %rdx	# 4140	[c=9 l=8]  *movdi_internal/3
+	movq	%r12, %rdi	# 4147	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC59(%rip), %rsi	# 4145	[c=1 l=7]  *movdi_internal/4
+	leal	1(%rax,%rax), %eax	# 4135	[c=8 l=4]  *leasi
+	andl	%r14d, %eax	# 4138	[c=4 l=3]  *andsi_1/0
+	cltq	# 4139	[c=4 l=2]  *extendsidi2_rex64/0
+	movzbl	(%rdx,%rax), %ecx	# 4141	[c=13 l=4]  *zero_extendqisi2/0
+	xorl	%edx, %edx	# 18675	[c=4 l=2]  *movdi_xor
+	xorl	%eax, %eax	# 18676	[c=4 l=2]  *movdi_xor
+	movl	%ecx, %r13d	# 17670	[c=4 l=3]  *movsi_internal/0
+	call	log_append@PLT	# 4149	[c=0 l=5]  *call
+	movq	1040(%r12), %rax	# 4150	[c=9 l=8]  *movdi_internal/3
+	movq	%r12, %rdi	# 4153	[c=4 l=3]  *movdi_internal/3
+	movq	%rbp, %rsi	# 4152	[c=4 l=3]  *movdi_internal/3
+	movb	%r13b, (%rax)	# 4151	[c=4 l=3]  *movqi_internal/8
+	call	log_dump_line@PLT	# 4154	[c=0 l=5]  *call
+	movq	40(%r12), %rax	# 16134	[c=9 l=5]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 16135	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 4156	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 17390	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r12)	# 4157	[c=4 l=5]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 4159	[c=4 l=3]  *cmpdi_1/0
+	jb	.L297	# 4160	[c=13 l=6]  *jcc
+	movl	(%r12), %r8d	# 4162	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r12, %rdi	# 4167	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r8	# 4163	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r12), %r8	# 4165	[c=13 l=8]  *adddi_1/1
+	movq	%r8, %rbp	# 16137	[c=4 l=3]  *movdi_internal/3
+	movq	%r8, %rsi	# 4166	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 4168	[c=0 l=5]  *call
+	movzbl	9(%rbp), %eax	# 4169	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, (%r12)	# 4170	[c=9 l=4]  *addsi_1/0
+	leaq	handler.1(%rip), %rdi	# 16140	[c=1 l=7]  *movdi_internal/4
+	movzbl	8(%rbp), %eax	# 4173	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 16138	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 4174	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbx,%rdx), %rdx	# 4177	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r12)	# 4178	[c=13 l=5]  *adddi_1/0
+	jmp	*(%rdi,%rax,8)	# 18674	[c=10 l=3]  *indirect_jump
+.L505:
+	movq	1040(%r12), %rax	# 4188	[c=9 l=8]  *movdi_internal/3
+	movzbl	10(%rbp), %r15d	# 4186	[c=13 l=5]  zero_extendqidi2/0
+	movl	$30, %edx	# 4191	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 4194	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC44(%rip), %rsi	# 4192	[c=1 l=7]  *movdi_internal/4
+	movzwl	30(%rax), %r14d	# 4189	[c=13 l=5]  *zero_extendhisi2/0
+	xorl	%eax, %eax	# 18673	[c=4 l=2]  *movdi_xor
+	movq	%r15, %r13	# 17671	[c=4 l=3]  *movdi_internal/3
+	movl	%r14d, %ecx	# 4190	[c=4 l=3]  *movsi_internal/0
+	call	log_append@PLT	# 4196	[c=0 l=5]  *call
+	movl	$91, %eax	# 4197	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r12), %eax	# 4198	[c=13 l=8]  *subsi_1/1
+	cmpl	5180(%r12), %eax	# 4199	[c=13 l=8]  *cmpsi_1/1
+	jb	.L506	# 4200	[c=13 l=2]  *jcc
+	cmpb	$0, 1082(%r12)	# 4202	[c=13 l=9]  *cmpqi_ccno_1/1
+	jne	.L507	# 4203	[c=13 l=6]  *jcc
+.L506:
+	movq	1040(%r12), %rax	# 4206	[c=9 l=8]  *movdi_internal/3
+	movzbl	91(%rax), %eax	# 4207	[c=13 l=4]  *zero_extendqisi2/0
+.L508:
+	movl	%eax, %ecx	# 4218	[c=4 l=2]  *movsi_internal/0
+	movl	$91, %edx	# 4219	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 4222	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, 8(%rsp)	# 17106	[c=4 l=4]  *movsi_internal/1
+	leaq	.LC29(%rip), %rsi	# 4220	[c=1 l=7]  *movdi_internal/4
+	call	log_add_data_mov@PLT	# 4223	[c=0 l=5]  *call
+	movl	8(%rsp), %eax	# 17107	[c=9 l=4]  *movsi_internal/0
+	movl	992(%r12), %edx	# 4224	[c=9 l=8]  *movsi_internal/0
+	movq	%r12, %rdi	# 4238	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC59(%rip), %rsi	# 4236	[c=1 l=7]  *movdi_internal/4
+	sall	$16, %eax	# 4227	[c=4 l=3]  *ashlsi3_1/0
+	leal	1(%rdx,%rdx), %edx	# 4226	[c=8 l=4]  *leasi
+	orl	%r14d, %eax	# 4228	[c=4 l=3]  *iorsi_1/0
+	andl	%edx, %eax	# 4229	[c=4 l=2]  *andsi_1/0
+	movq	1056(%r12), %rdx	# 4231	[c=9 l=8]  *movdi_internal/3
+	cltq	# 4230	[c=4 l=2]  *extendsidi2_rex64/0
+	movzbl	(%rdx,%rax), %ecx	# 4232	[c=13 l=4]  *zero_extendqisi2/0
+	movl	%r15d, %edx	# 4235	[c=4 l=3]  *movsi_internal/0
+	xorl	%eax, %eax	# 18672	[c=4 l=2]  *movdi_xor
+	movl	%ecx, %r14d	# 17672	[c=4 l=3]  *movsi_internal/0
+	call	log_append@PLT	# 4240	[c=0 l=5]  *call
+	movq	1040(%r12), %rax	# 4242	[c=9 l=8]  *movdi_internal/3
+	movq	%r12, %rdi	# 4245	[c=4 l=3]  *movdi_internal/3
+	movq	%rbp, %rsi	# 4244	[c=4 l=3]  *movdi_internal/3
+	movb	%r14b, (%rax,%r13)	# 4243	[c=4 l=4]  *movqi_internal/8
+	call	log_dump_line@PLT	# 4246	[c=0 l=5]  *call
+	movq	40(%r12), %rax	# 16141	[c=9 l=5]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 16142	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 4248	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 17389	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r12)	# 4249	[c=4 l=5]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 4251	[c=4 l=3]  *cmpdi_1/0
+	jb	.L297	# 4252	[c=13 l=6]  *jcc
+	movl	(%r12), %r8d	# 4254	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r12, %rdi	# 4259	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r8	# 4255	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r12), %r8	# 4257	[c=13 l=8]  *adddi_1/1
+	movq	%r8, %rbp	# 16144	[c=4 l=3]  *movdi_internal/3
+	movq	%r8, %rsi	# 4258	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 4260	[c=0 l=5]  *call
+	movzbl	9(%rbp), %eax	# 4261	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, (%r12)	# 4262	[c=9 l=4]  *addsi_1/0
+	leaq	handler.1(%rip), %rdi	# 16147	[c=1 l=7]  *movdi_internal/4
+	movzbl	8(%rbp), %eax	# 4265	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 16145	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 4266	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbx,%rdx), %rdx	# 4269	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r12)	# 4270	[c=13 l=5]  *adddi_1/0
+	jmp	*(%rdi,%rax,8)	# 18671	[c=10 l=3]  *indirect_jump
+.L509:
+	movzbl	10(%rbp), %eax	# 4278	[c=13 l=4]  zero_extendqidi2/0
+	movl	$30, %edx	# 4283	[c=4 l=5]  *movsi_internal/0
+	leaq	.LC44(%rip), %rsi	# 4284	[c=1 l=7]  *movdi_internal/4
+	movq	%r12, %rdi	# 4286	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, 8(%rsp)	# 16148	[c=4 l=4]  *movsi_internal/1
+	movq	%rax, %r13	# 17673	[c=4 l=3]  *movdi_internal/3
+	movq	1040(%r12), %rax	# 4280	[c=9 l=8]  *movdi_internal/3
+	movzwl	30(%rax), %r14d	# 4281	[c=13 l=5]  *zero_extendhisi2/0
+	xorl	%eax, %eax	# 18670	[c=4 l=2]  *movdi_xor
+	movl	%r14d, %ecx	# 4282	[c=4 l=3]  *movsi_internal/0
+	call	log_append@PLT	# 4288	[c=0 l=5]  *call
+	movl	$91, %eax	# 4289	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r12), %eax	# 4290	[c=13 l=8]  *subsi_1/1
+	cmpl	5180(%r12), %eax	# 4291	[c=13 l=8]  *cmpsi_1/1
+	jb	.L510	# 4292	[c=13 l=2]  *jcc
+	cmpb	$0, 1082(%r12)	# 4294	[c=13 l=9]  *cmpqi_ccno_1/1
+	jne	.L511	# 4295	[c=13 l=6]  *jcc
+.L510:
+	movq	1040(%r12), %rax	# 4298	[c=9 l=8]  *movdi_internal/3
+	movzbl	91(%rax), %r15d	# 4299	[c=13 l=5]  *zero_extendqisi2/0
+.L512:
+	movl	%r15d, %ecx	# 4310	[c=4 l=3]  *movsi_internal/0
+	movl	$91, %edx	# 4311	[c=4 l=5]  *movsi_internal/0
+	leaq	.LC29(%rip), %rsi	# 4312	[c=1 l=7]  *movdi_internal/4
+	movq	%r12, %rdi	# 4314	[c=4 l=3]  *movdi_internal/3
+	call	log_add_data_mov@PLT	# 4315	[c=0 l=5]  *call
+	movl	%r15d, %eax	# 16149	[c=4 l=3]  *movsi_internal/0
+	movq	1056(%r12), %rdx	# 4323	[c=9 l=8]  *movdi_internal/3
+	movq	%r12, %rdi	# 4330	[c=4 l=3]  *movdi_internal/3
+	sall	$16, %eax	# 4316	[c=4 l=3]  *ashlsi3_1/0
+	leaq	.LC59(%rip), %rsi	# 4328	[c=1 l=7]  *movdi_internal/4
+	orl	%eax, %r14d	# 4317	[c=4 l=3]  *iorsi_1/0
+	movl	992(%r12), %eax	# 4318	[c=9 l=8]  *movsi_internal/0
+	leal	1(%rax,%rax), %eax	# 4320	[c=8 l=4]  *leasi
+	andl	%r14d, %eax	# 4321	[c=4 l=3]  *andsi_1/0
+	cltq	# 4322	[c=4 l=2]  *extendsidi2_rex64/0
+	movzbl	(%rdx,%rax), %ecx	# 4324	[c=13 l=4]  *zero_extendqisi2/0
+	movzbl	%r13b, %edx	# 17255	[c=4 l=4]  *zero_extendqisi2/0
+	xorl	%eax, %eax	# 18667	[c=4 l=2]  *movdi_xor
+	movl	%ecx, %r15d	# 17674	[c=4 l=3]  *movsi_internal/0
+	call	log_append@PLT	# 4332	[c=0 l=5]  *call
+	movq	1040(%r12), %rax	# 4334	[c=9 l=8]  *movdi_internal/3
+	movl	$30, %edx	# 4339	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 4342	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC48(%rip), %rsi	# 4340	[c=1 l=7]  *movdi_internal/4
+	movb	%r15b, (%rax,%r13)	# 4335	[c=4 l=4]  *movqi_internal/8
+	leal	1(%r14), %r13d	# 17388	[c=4 l=4]  *leasi
+	xorl	%eax, %eax	# 18668	[c=4 l=2]  *movdi_xor
+	movzwl	%r13w, %r14d	# 4337	[c=4 l=4]  *zero_extendhisi2/0
+	sarl	$16, %r13d	# 4350	[c=4 l=4]  *ashrsi3_1/0
+	movl	%r14d, %ecx	# 4338	[c=4 l=3]  *movsi_internal/0
+	call	log_append@PLT	# 4344	[c=0 l=5]  *call
+	movl	%r14d, %ecx	# 16152	[c=4 l=3]  *movsi_internal/0
+	movl	$91, %edx	# 4353	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 4356	[c=4 l=3]  *movdi_internal/3
+	movq	1040(%r12), %rax	# 4345	[c=9 l=8]  *movdi_internal/3
+	leaq	.LC31(%rip), %rsi	# 4354	[c=1 l=7]  *movdi_internal/4
+	movb	%r14b, 30(%rax)	# 4346	[c=4 l=4]  *movqi_internal/8
+	movq	1040(%r12), %rax	# 4347	[c=9 l=8]  *movdi_internal/3
+	movb	%ch, 31(%rax)	# 18669	[c=4 l=3]  *extzvqi_mem_rex64
+	movzbl	%r13b, %ecx	# 4351	[c=4 l=4]  *zero_extendqisi2/0
+	call	log_add_data_mov@PLT	# 4357	[c=0 l=5]  *call
+	movl	$91, %eax	# 4358	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r12), %eax	# 4359	[c=13 l=8]  *subsi_1/1
+	cmpl	5180(%r12), %eax	# 4360	[c=13 l=8]  *cmpsi_1/1
+	jb	.L513	# 4361	[c=13 l=2]  *jcc
+	cmpb	$0, 1082(%r12)	# 4363	[c=13 l=9]  *cmpqi_ccno_1/1
+	jne	.L514	# 4364	[c=13 l=6]  *jcc
+.L513:
+	movq	1040(%r12), %rax	# 4367	[c=9 l=8]  *movdi_internal/3
+	movb	%r13b, 91(%rax)	# 4368	[c=4 l=4]  *movqi_internal/8
+.L515:
+	movq	%r12, %rdi	# 4380	[c=4 l=3]  *movdi_internal/3
+	movq	%rbp, %rsi	# 4379	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 4381	[c=0 l=5]  *call
+	movq	40(%r12), %rax	# 16153	[c=9 l=5]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 16154	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 4383	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 17387	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r12)	# 4384	[c=4 l=5]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 4386	[c=4 l=3]  *cmpdi_1/0
+	jb	.L297	# 4387	[c=13 l=6]  *jcc
+	movl	(%r12), %r8d	# 4389	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r12, %rdi	# 4394	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r8	# 4390	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r12), %r8	# 4392	[c=13 l=8]  *adddi_1/1
+	movq	%r8, %rbp	# 16156	[c=4 l=3]  *movdi_internal/3
+	movq	%r8, %rsi	# 4393	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 4395	[c=0 l=5]  *call
+	movzbl	9(%rbp), %eax	# 4396	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, (%r12)	# 4397	[c=9 l=4]  *addsi_1/0
+	leaq	handler.1(%rip), %rdi	# 16159	[c=1 l=7]  *movdi_internal/4
+	movzbl	8(%rbp), %eax	# 4400	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 16157	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 4401	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbx,%rdx), %rdx	# 4404	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r12)	# 4405	[c=13 l=5]  *adddi_1/0
+	jmp	*(%rdi,%rax,8)	# 18666	[c=10 l=3]  *indirect_jump
+.L516:
+	movzbl	10(%rbp), %r9d	# 4414	[c=13 l=5]  zero_extendqidi2/0
+	movzwl	12(%rbp), %r15d	# 4413	[c=9 l=5]  *movhi_internal/2
+	movq	%r12, %rdi	# 4423	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC43(%rip), %rsi	# 4421	[c=1 l=7]  *movdi_internal/4
+	movq	1040(%r12), %rax	# 4417	[c=9 l=8]  *movdi_internal/3
+	movl	%r9d, %edx	# 4420	[c=4 l=3]  *movsi_internal/0
+	movq	%r9, %r13	# 17675	[c=4 l=3]  *movdi_internal/3
+	movl	%r9d, 16(%rsp)	# 17112	[c=4 l=5]  *movsi_internal/1
+	movzbl	(%rax,%r9), %ecx	# 4418	[c=13 l=5]  *zero_extendqisi2/0
+	xorl	%eax, %eax	# 18662	[c=4 l=2]  *movdi_xor
+	call	log_append@PLT	# 4425	[c=0 l=5]  *call
+	movzwl	%r15w, %r11d	# 4428	[c=4 l=4]  zero_extendhidi2/0
+	movzwl	%r15w, %edx	# 4430	[c=4 l=4]  *zero_extendhisi2/0
+	movq	%r12, %rdi	# 4435	[c=4 l=3]  *movdi_internal/3
+	movq	1040(%r12), %rax	# 4426	[c=9 l=8]  *movdi_internal/3
+	leaq	.LC43(%rip), %rsi	# 17111	[c=1 l=7]  *movdi_internal/4
+	movq	%r11, 8(%rsp)	# 17108	[c=4 l=5]  *movdi_internal/5
+	movzbl	(%rax,%r11), %ecx	# 4429	[c=13 l=5]  *zero_extendqisi2/0
+	movzbl	(%rax,%r13), %r14d	# 4427	[c=9 l=5]  *movqi_internal/4
+	xorl	%eax, %eax	# 18663	[c=4 l=2]  *movdi_xor
+	call	log_append@PLT	# 4437	[c=0 l=5]  *call
+	movq	8(%rsp), %r11	# 17109	[c=9 l=5]  *movdi_internal/3
+	movl	%r14d, %r15d	# 16160	[c=4 l=3]  *movqi_internal/2
+	movq	%r12, %rdi	# 4445	[c=4 l=3]  *movdi_internal/3
+	movq	1040(%r12), %rax	# 4438	[c=9 l=8]  *movdi_internal/3
+	movl	16(%rsp), %edx	# 18664	[c=9 l=4]  *movsi_internal/0
+	leaq	.LC59(%rip), %rsi	# 4443	[c=1 l=7]  *movdi_internal/4
+	xorb	(%rax,%r11), %r15b	# 4439	[c=13 l=4]  *xorqi_1/1
+	xorl	%eax, %eax	# 18665	[c=4 l=2]  *movdi_xor
+	movzbl	%r15b, %r14d	# 4440	[c=4 l=4]  zero_extendqidi2/0
+	movl	%r14d, %ecx	# 4441	[c=4 l=3]  *movsi_internal/0
+	call	log_append@PLT	# 4447	[c=0 l=5]  *call
+	movq	1040(%r12), %rax	# 4448	[c=9 l=8]  *movdi_internal/3
+	movb	%r15b, (%rax,%r13)	# 4449	[c=4 l=4]  *movqi_internal/8
+	movl	$95, %eax	# 4450	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r12), %eax	# 4451	[c=13 l=8]  *subsi_1/1
+	cmpl	5180(%r12), %eax	# 4452	[c=13 l=8]  *cmpsi_1/1
+	jb	.L517	# 4453	[c=13 l=2]  *jcc
+	cmpb	$0, 1082(%r12)	# 4455	[c=13 l=9]  *cmpqi_ccno_1/1
+	jne	.L518	# 4456	[c=13 l=6]  *jcc
+.L517:
+	movq	1040(%r12), %rax	# 4459	[c=9 l=8]  *movdi_internal/3
+	movzbl	95(%rax), %r13d	# 4460	[c=13 l=5]  *zero_extendqisi2/0
+.L519:
+	movl	%r13d, %ecx	# 4471	[c=4 l=3]  *movsi_internal/0
+	movl	$95, %edx	# 4472	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 4475	[c=4 l=3]  *movdi_internal/3
+	andl	$-31, %r13d	# 4477	[c=4 l=4]  *andsi_1/0
+	leaq	.LC28(%rip), %rsi	# 4473	[c=1 l=7]  *movdi_internal/4
+	call	log_add_data_mov@PLT	# 4476	[c=0 l=5]  *call
+	leaq	flag_update_table_logical(%rip), %rax	# 15683	[c=1 l=7]  *movdi_internal/4
+	movl	$95, %edx	# 4484	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 4487	[c=4 l=3]  *movdi_internal/3
+	movzbl	(%rax,%r14), %eax	# 4480	[c=13 l=5]  *zero_extendqisi2/0
+	leaq	.LC30(%rip), %rsi	# 4485	[c=1 l=7]  *movdi_internal/4
+	orl	%eax, %r13d	# 4481	[c=4 l=3]  *iorsi_1/0
+	movzbl	%r13b, %ecx	# 4482	[c=4 l=4]  *zero_extendqisi2/0
+	call	log_add_data_mov@PLT	# 4488	[c=0 l=5]  *call
+	movl	$95, %eax	# 4489	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r12), %eax	# 4490	[c=13 l=8]  *subsi_1/1
+	cmpl	5180(%r12), %eax	# 4491	[c=13 l=8]  *cmpsi_1/1
+	jb	.L520	# 4492	[c=13 l=2]  *jcc
+	cmpb	$0, 1082(%r12)	# 4494	[c=13 l=9]  *cmpqi_ccno_1/1
+	jne	.L521	# 4495	[c=13 l=6]  *jcc
+.L520:
+	movq	1040(%r12), %rax	# 4498	[c=9 l=8]  *movdi_internal/3
+	movb	%r13b, 95(%rax)	# 4499	[c=4 l=4]  *movqi_internal/8
+.L522:
+	movq	%r12, %rdi	# 4511	[c=4 l=3]  *movdi_internal/3
+	movq	%rbp, %rsi	# 4510	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 4512	[c=0 l=5]  *call
+	movq	40(%r12), %rax	# 16162	[c=9 l=5]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 16163	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 4514	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 17386	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r12)	# 4515	[c=4 l=5]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 4517	[c=4 l=3]  *cmpdi_1/0
+	jb	.L297	# 4518	[c=13 l=6]  *jcc
+	movl	(%r12), %r8d	# 4520	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r12, %rdi	# 4525	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r8	# 4521	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r12), %r8	# 4523	[c=13 l=8]  *adddi_1/1
+	movq	%r8, %rbp	# 16165	[c=4 l=3]  *movdi_internal/3
+	movq	%r8, %rsi	# 4524	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 4526	[c=0 l=5]  *call
+	movzbl	9(%rbp), %eax	# 4527	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, (%r12)	# 4528	[c=9 l=4]  *addsi_1/0
+	leaq	handler.1(%rip), %rdi	# 16168	[c=1 l=7]  *movdi_internal/4
+	movzbl	8(%rbp), %eax	# 4531	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 16166	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 4532	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbx,%rdx), %rdx	# 4535	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r12)	# 4536	[c=13 l=5]  *adddi_1/0
+	jmp	*(%rdi,%rax,8)	# 18661	[c=10 l=3]  *indirect_jump
+.L523:
+	movq	1040(%r12), %rax	# 4544	[c=9 l=8]  *movdi_internal/3
+	movl	$30, %edx	# 4547	[c=4 l=5]  *movsi_internal/0
+	leaq	.LC44(%rip), %rsi	# 4548	[c=1 l=7]  *movdi_internal/4
+	movq	%r12, %rdi	# 4550	[c=4 l=3]  *movdi_internal/3
+	movzwl	30(%rax), %r13d	# 4545	[c=13 l=5]  *zero_extendhisi2/0
+	xorl	%eax, %eax	# 18660	[c=4 l=2]  *movdi_xor
+	movl	%r13d, %ecx	# 4546	[c=4 l=3]  *movsi_internal/0
+	call	log_append@PLT	# 4552	[c=0 l=5]  *call
+	cmpl	$65536, 880(%r12)	# 4555	[c=13 l=12]  *cmpsi_1/0
+	jbe	.L524	# 4556	[c=13 l=2]  *jcc
+	movl	$91, %eax	# 4558	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r12), %eax	# 4559	[c=13 l=8]  *subsi_1/1
+	cmpl	5180(%r12), %eax	# 4560	[c=13 l=8]  *cmpsi_1/1
+	jb	.L525	# 4561	[c=13 l=2]  *jcc
+	cmpb	$0, 1082(%r12)	# 4563	[c=13 l=9]  *cmpqi_ccno_1/1
+	jne	.L526	# 4564	[c=13 l=6]  *jcc
+.L525:
+	movq	1040(%r12), %rax	# 4567	[c=9 l=8]  *movdi_internal/3
+	movzbl	91(%rax), %r14d	# 4568	[c=13 l=5]  *zero_extendqisi2/0
+.L527:
+	movl	%r14d, %ecx	# 4579	[c=4 l=3]  *movsi_internal/0
+	movl	$91, %edx	# 4580	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 4583	[c=4 l=3]  *movdi_internal/3
+	sall	$16, %r14d	# 4585	[c=4 l=4]  *ashlsi3_1/0
+	leaq	.LC29(%rip), %rsi	# 4581	[c=1 l=7]  *movdi_internal/4
+	orl	%r14d, %r13d	# 4586	[c=4 l=3]  *iorsi_1/0
+	call	log_add_data_mov@PLT	# 4584	[c=0 l=5]  *call
+.L524:
+	movl	992(%r12), %eax	# 4591	[c=9 l=8]  *movsi_internal/0
+	movl	6044(%r12), %r15d	# 4589	[c=9 l=8]  *movsi_internal/0
+	movq	%r12, %rdi	# 4601	[c=4 l=3]  *movdi_internal/3
+	leal	1(%rax,%rax), %r14d	# 4593	[c=8 l=5]  *leasi
+	movl	%r15d, %eax	# 16169	[c=4 l=3]  *movsi_internal/0
+	negl	%eax	# 4594	[c=4 l=2]  *negsi_1
+	andl	%eax, %r14d	# 4595	[c=4 l=3]  *andsi_1/0
+	leaq	6052(%r12), %rax	# 17385	[c=4 l=8]  *leadi
+	andl	%r13d, %r14d	# 4596	[c=4 l=3]  *andsi_1/0
+	movq	%rax, 16(%rsp)	# 16171	[c=4 l=5]  *movdi_internal/5
+	movl	%r14d, %ecx	# 4597	[c=1 l=3]  *zero_extendsidi2/3
+	addq	1056(%r12), %rcx	# 4599	[c=13 l=8]  *adddi_1/1
+	movq	%rcx, 8(%rsp)	# 17114	[c=4 l=5]  *movdi_internal/5
+	call	spm_operation	# 4602	[c=10 l=5]  *call_value
+	movq	8(%rsp), %rcx	# 17115	[c=9 l=5]  *movdi_internal/3
+	cmpl	$3, %eax	# 4604	[c=4 l=3]  *cmpsi_1/0
+	je	.L1358	# 4605	[c=13 l=6]  *jcc
+	jg	.L529	# 4610	[c=13 l=6]  *jcc
+	cmpl	$1, %eax	# 4612	[c=4 l=3]  *cmpsi_1/0
+	je	.L530	# 4613	[c=13 l=6]  *jcc
+	cmpl	$2, %eax	# 4615	[c=4 l=3]  *cmpsi_1/0
+	jne	.L532	# 4616	[c=13 l=2]  *jcc
+	movl	%r14d, %edx	# 4664	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC61(%rip), %rsi	# 4665	[c=1 l=7]  *movdi_internal/4
+	movq	%r12, %rdi	# 4667	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 18655	[c=4 l=2]  *movdi_xor
+	movq	%rcx, 8(%rsp)	# 17119	[c=4 l=5]  *movdi_internal/5
+	call	log_append@PLT	# 4669	[c=0 l=5]  *call
+	movq	8(%rsp), %rdi	# 18656	[c=9 l=5]  *movdi_internal/3
+	movl	%r15d, %edx	# 4671	[c=1 l=3]  *zero_extendsidi2/3
+	movl	$255, %esi	# 4673	[c=4 l=5]  *movsi_internal/0
+.L1217:
+	call	memset@PLT	# 4716	[c=10 l=5]  *call_value
+	leal	(%r15,%r14), %edx	# 17380	[c=4 l=4]  *leasi
+	movl	%r14d, %esi	# 4719	[c=4 l=3]  *movsi_internal/0
+	movq	%r12, %rdi	# 4720	[c=4 l=3]  *movdi_internal/3
+	call	flash_changed	# 4721	[c=0 l=5]  *call
+.L532:
+	addl	$2, %r13d	# 4724	[c=4 l=4]  *addsi_1/0
+	xorl	%eax, %eax	# 18651	[c=4 l=2]  *movdi_xor
+	movl	$30, %edx	# 4727	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 4730	[c=4 l=3]  *movdi_internal/3
+	movzwl	%r13w, %r14d	# 4725	[c=4 l=4]  *zero_extendhisi2/0
+	leaq	.LC48(%rip), %rsi	# 4728	[c=1 l=7]  *movdi_internal/4
+	movl	%r14d, %ecx	# 4726	[c=4 l=3]  *movsi_internal/0
+	call	log_append@PLT	# 4732	[c=0 l=5]  *call
+	movq	1040(%r12), %rax	# 4733	[c=9 l=8]  *movdi_internal/3
+	movl	%r14d, %ecx	# 16177	[c=4 l=3]  *movsi_internal/0
+	movb	%r14b, 30(%rax)	# 4734	[c=4 l=4]  *movqi_internal/8
+	movq	1040(%r12), %rax	# 4735	[c=9 l=8]  *movdi_internal/3
+	movb	%ch, 31(%rax)	# 18652	[c=4 l=3]  *extzvqi_mem_rex64
+	cmpl	$65536, 880(%r12)	# 4740	[c=13 l=12]  *cmpsi_1/0
+	ja	.L1359	# 4741	[c=13 l=6]  *jcc
+.L536:
+	movq	%r12, %rdi	# 4773	[c=4 l=3]  *movdi_internal/3
+	movq	%rbp, %rsi	# 4772	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 4774	[c=0 l=5]  *call
+	movq	40(%r12), %rax	# 16178	[c=9 l=5]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 16179	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 4776	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 17379	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r12)	# 4777	[c=4 l=5]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 4779	[c=4 l=3]  *cmpdi_1/0
+	jb	.L297	# 4780	[c=13 l=6]  *jcc
+	movq	56(%r12), %rax	# 16180	[c=9 l=5]  *movdi_internal/3
+	cmpq	%rax, 48(%r12)	# 4783	[c=13 l=5]  *cmpdi_1/0
+	jnb	.L1360	# 4784	[c=13 l=6]  *jcc
+.L539:
+	movq	%r12, %rdi	# 4790	[c=4 l=3]  *movdi_internal/3
+	call	log_is_idle@PLT	# 4791	[c=10 l=5]  *call_value
+	testb	%al, %al	# 4793	[c=4 l=2]  *cmpqi_ccno_1/0
+	jne	.L1361	# 4794	[c=13 l=6]  *jcc
+.L540:
+	movl	(%r12), %r8d	# 4805	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r12, %rdi	# 4810	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r8	# 4806	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r12), %r8	# 4808	[c=13 l=8]  *adddi_1/1
+	movq	%r8, %rbp	# 16182	[c=4 l=3]  *movdi_internal/3
+	movq	%r8, %rsi	# 4809	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 4811	[c=0 l=5]  *call
+	movzbl	9(%rbp), %eax	# 4812	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, (%r12)	# 4813	[c=9 l=4]  *addsi_1/0
+	leaq	handler.1(%rip), %rdi	# 16185	[c=1 l=7]  *movdi_internal/4
+	movzbl	8(%rbp), %eax	# 4816	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 16183	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 4817	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbx,%rdx), %rdx	# 4820	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r12)	# 4821	[c=13 l=5]  *adddi_1/0
+	jmp	*(%rdi,%rax,8)	# 18650	[c=10 l=3]  *indirect_jump
+.L541:
+	movzbl	10(%rbp), %r14d	# 4830	[c=13 l=5]  zero_extendqidi2/0
+	xorl	%eax, %eax	# 18645	[c=4 l=2]  *movdi_xor
+	movq	%r12, %rdi	# 4839	[c=4 l=3]  *movdi_internal/3
+	movzwl	12(%rbp), %r15d	# 4829	[c=13 l=5]  zero_extendhidi2/0
+	movq	1040(%r12), %rdx	# 4832	[c=9 l=8]  *movdi_internal/3
+	leaq	.LC43(%rip), %rsi	# 4837	[c=1 l=7]  *movdi_internal/4
+	movzbl	(%rdx,%r14), %ecx	# 4833	[c=13 l=5]  *zero_extendqisi2/0
+	movzbl	%r14b, %edx	# 4834	[c=4 l=4]  *zero_extendqisi2/0
+	call	log_append@PLT	# 4841	[c=0 l=5]  *call
+	movq	1040(%r12), %rax	# 4842	[c=9 l=8]  *movdi_internal/3
+	movzwl	%r15w, %edx	# 4846	[c=4 l=4]  *zero_extendhisi2/0
+	movq	%r12, %rdi	# 4851	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC43(%rip), %rsi	# 17126	[c=1 l=7]  *movdi_internal/4
+	movzbl	(%rax,%r15), %ecx	# 4845	[c=13 l=5]  *zero_extendqisi2/0
+	movzbl	(%rax,%r14), %r14d	# 4843	[c=13 l=5]  *zero_extendqisi2/0
+	xorl	%eax, %eax	# 18646	[c=4 l=2]  *movdi_xor
+	call	log_append@PLT	# 4853	[c=0 l=5]  *call
+	movq	1040(%r12), %rcx	# 4854	[c=9 l=8]  *movdi_internal/3
+	xorl	%edx, %edx	# 18647	[c=4 l=2]  *movsi_xor
+	movzbl	(%rcx,%r15), %eax	# 4855	[c=13 l=5]  *zero_extendqisi2/0
+	imull	%r14d, %eax	# 4856	[c=12 l=4]  *mulsi3_1/2
+	movl	%eax, %r13d	# 16186	[c=4 l=3]  *movsi_internal/0
+	addl	%r13d, %r13d	# 18648	[c=4 l=3]  *ashlsi3_cmp
+	sete	%dl	# 18649	[c=4 l=3]  *setcc_qi_slp
+	sarl	$15, %eax	# 4863	[c=4 l=3]  *ashrsi3_1/0
+	addl	%edx, %edx	# 4862	[c=4 l=2]  *ashlsi3_1/0
+	orl	%eax, %edx	# 4864	[c=4 l=2]  *iorsi_1/0
+	movl	$95, %eax	# 4865	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r12), %eax	# 4866	[c=13 l=8]  *subsi_1/1
+	movl	%edx, %r14d	# 16189	[c=4 l=3]  *movsi_internal/0
+	cmpl	5180(%r12), %eax	# 4867	[c=13 l=8]  *cmpsi_1/1
+	jb	.L542	# 4868	[c=13 l=2]  *jcc
+	cmpb	$0, 1082(%r12)	# 4870	[c=13 l=9]  *cmpqi_ccno_1/1
+	jne	.L543	# 4871	[c=13 l=6]  *jcc
+.L542:
+	movzbl	95(%rcx), %r15d	# 4874	[c=13 l=5]  *zero_extendqisi2/0
+.L544:
+	movl	%r15d, %ecx	# 4885	[c=4 l=3]  *movsi_internal/0
+	andl	$-4, %r15d	# 4891	[c=4 l=4]  *andsi_1/0
+	movl	$95, %edx	# 4886	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 4889	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC28(%rip), %rsi	# 4887	[c=1 l=7]  *movdi_internal/4
+	orl	%r15d, %r14d	# 4892	[c=4 l=3]  *iorsi_1/0
+	call	log_add_data_mov@PLT	# 4890	[c=0 l=5]  *call
+	movzbl	%r14b, %ecx	# 4893	[c=4 l=4]  *zero_extendqisi2/0
+	movl	$95, %edx	# 4895	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 4898	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC30(%rip), %rsi	# 4896	[c=1 l=7]  *movdi_internal/4
+	call	log_add_data_mov@PLT	# 4899	[c=0 l=5]  *call
+	movl	$95, %eax	# 4900	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r12), %eax	# 4901	[c=13 l=8]  *subsi_1/1
+	cmpl	5180(%r12), %eax	# 4902	[c=13 l=8]  *cmpsi_1/1
+	jb	.L545	# 4903	[c=13 l=2]  *jcc
+	cmpb	$0, 1082(%r12)	# 4905	[c=13 l=9]  *cmpqi_ccno_1/1
+	jne	.L546	# 4906	[c=13 l=6]  *jcc
+.L545:
+	movq	1040(%r12), %rax	# 4909	[c=9 l=8]  *movdi_internal/3
+	movb	%r14b, 95(%rax)	# 4910	[c=4 l=4]  *movqi_internal/8
+.L547:
+	xorl	%edx, %edx	# 18642	[c=4 l=2]  *movdi_xor
+	movzwl	%r13w, %ecx	# 4921	[c=4 l=4]  *zero_extendhisi2/0
+	leaq	.LC48(%rip), %rsi	# 4924	[c=1 l=7]  *movdi_internal/4
+	movq	%r12, %rdi	# 4926	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 18643	[c=4 l=2]  *movdi_xor
+	call	log_append@PLT	# 4928	[c=0 l=5]  *call
+	movl	%r13d, %ecx	# 16191	[c=4 l=3]  *movsi_internal/0
+	movq	%r12, %rdi	# 4935	[c=4 l=3]  *movdi_internal/3
+	movq	%rbp, %rsi	# 4934	[c=4 l=3]  *movdi_internal/3
+	movq	1040(%r12), %rax	# 4929	[c=9 l=8]  *movdi_internal/3
+	movb	%r13b, (%rax)	# 4930	[c=4 l=3]  *movqi_internal/8
+	movq	1040(%r12), %rax	# 4931	[c=9 l=8]  *movdi_internal/3
+	movb	%ch, 1(%rax)	# 18644	[c=4 l=3]  *extzvqi_mem_rex64
+	call	log_dump_line@PLT	# 4936	[c=0 l=5]  *call
+	movq	40(%r12), %rax	# 16192	[c=9 l=5]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 16193	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 4938	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 17376	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r12)	# 4939	[c=4 l=5]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 4941	[c=4 l=3]  *cmpdi_1/0
+	jb	.L297	# 4942	[c=13 l=6]  *jcc
+	movl	(%r12), %r8d	# 4944	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r12, %rdi	# 4949	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r8	# 4945	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r12), %r8	# 4947	[c=13 l=8]  *adddi_1/1
+	movq	%r8, %rbp	# 16195	[c=4 l=3]  *movdi_internal/3
+	movq	%r8, %rsi	# 4948	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 4950	[c=0 l=5]  *call
+	movzbl	9(%rbp), %eax	# 4951	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, (%r12)	# 4952	[c=9 l=4]  *addsi_1/0
+	leaq	handler.1(%rip), %rdi	# 16198	[c=1 l=7]  *movdi_internal/4
+	movzbl	8(%rbp), %eax	# 4955	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 16196	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 4956	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbx,%rdx), %rdx	# 4959	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r12)	# 4960	[c=13 l=5]  *adddi_1/0
+	jmp	*(%rdi,%rax,8)	# 18641	[c=10 l=3]  *indirect_jump
+.L555:
+	movzbl	10(%rbp), %r14d	# 5109	[c=13 l=5]  zero_extendqidi2/0
+	xorl	%eax, %eax	# 18627	[c=4 l=2]  *movdi_xor
+	movq	%r12, %rdi	# 5118	[c=4 l=3]  *movdi_internal/3
+	movzwl	12(%rbp), %r15d	# 5108	[c=13 l=5]  zero_extendhidi2/0
+	movq	1040(%r12), %rdx	# 5111	[c=9 l=8]  *movdi_internal/3
+	leaq	.LC43(%rip), %rsi	# 5116	[c=1 l=7]  *movdi_internal/4
+	movzbl	(%rdx,%r14), %ecx	# 5112	[c=13 l=5]  *zero_extendqisi2/0
+	movzbl	%r14b, %edx	# 5113	[c=4 l=4]  *zero_extendqisi2/0
+	call	log_append@PLT	# 5120	[c=0 l=5]  *call
+	movq	1040(%r12), %rax	# 5121	[c=9 l=8]  *movdi_internal/3
+	movzwl	%r15w, %edx	# 5125	[c=4 l=4]  *zero_extendhisi2/0
+	movq	%r12, %rdi	# 5130	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC43(%rip), %rsi	# 17130	[c=1 l=7]  *movdi_internal/4
+	movzbl	(%rax,%r15), %ecx	# 5124	[c=13 l=5]  *zero_extendqisi2/0
+	movsbl	(%rax,%r14), %r14d	# 5122	[c=13 l=5]  extendqisi2
+	xorl	%eax, %eax	# 18628	[c=4 l=2]  *movdi_xor
+	call	log_append@PLT	# 5132	[c=0 l=5]  *call
+	movq	1040(%r12), %rcx	# 5133	[c=9 l=8]  *movdi_internal/3
+	xorl	%edx, %edx	# 18629	[c=4 l=2]  *movsi_xor
+	movzbl	(%rcx,%r15), %eax	# 5134	[c=13 l=5]  *zero_extendqisi2/0
+	imull	%r14d, %eax	# 5135	[c=12 l=4]  *mulsi3_1/2
+	movzwl	%ax, %eax	# 5136	[c=4 l=3]  *zero_extendhisi2/0
+	movl	%eax, %r13d	# 16212	[c=4 l=3]  *movsi_internal/0
+	addl	%r13d, %r13d	# 18630	[c=4 l=3]  *ashlsi3_cmp
+	sete	%dl	# 18631	[c=4 l=3]  *setcc_qi_slp
+	sarl	$15, %eax	# 5143	[c=4 l=3]  *ashrsi3_1/0
+	addl	%edx, %edx	# 5142	[c=4 l=2]  *ashlsi3_1/0
+	orl	%eax, %edx	# 5144	[c=4 l=2]  *iorsi_1/0
+	movl	$95, %eax	# 5145	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r12), %eax	# 5146	[c=13 l=8]  *subsi_1/1
+	movl	%edx, %r14d	# 16215	[c=4 l=3]  *movsi_internal/0
+	cmpl	5180(%r12), %eax	# 5147	[c=13 l=8]  *cmpsi_1/1
+	jb	.L556	# 5148	[c=13 l=2]  *jcc
+	cmpb	$0, 1082(%r12)	# 5150	[c=13 l=9]  *cmpqi_ccno_1/1
+	jne	.L557	# 5151	[c=13 l=6]  *jcc
+.L556:
+	movzbl	95(%rcx), %r15d	# 5154	[c=13 l=5]  *zero_extendqisi2/0
+.L558:
+	movl	%r15d, %ecx	# 5165	[c=4 l=3]  *movsi_internal/0
+	andl	$-4, %r15d	# 5171	[c=4 l=4]  *andsi_1/0
+	movl	$95, %edx	# 5166	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 5169	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC28(%rip), %rsi	# 5167	[c=1 l=7]  *movdi_internal/4
+	orl	%r15d, %r14d	# 5172	[c=4 l=3]  *iorsi_1/0
+	call	log_add_data_mov@PLT	# 5170	[c=0 l=5]  *call
+	movzbl	%r14b, %ecx	# 5173	[c=4 l=4]  *zero_extendqisi2/0
+	movl	$95, %edx	# 5175	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 5178	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC30(%rip), %rsi	# 5176	[c=1 l=7]  *movdi_internal/4
+	call	log_add_data_mov@PLT	# 5179	[c=0 l=5]  *call
+	movl	$95, %eax	# 5180	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r12), %eax	# 5181	[c=13 l=8]  *subsi_1/1
+	cmpl	5180(%r12), %eax	# 5182	[c=13 l=8]  *cmpsi_1/1
+	jb	.L559	# 5183	[c=13 l=2]  *jcc
+	cmpb	$0, 1082(%r12)	# 5185	[c=13 l=9]  *cmpqi_ccno_1/1
+	jne	.L560	# 5186	[c=13 l=6]  *jcc
+.L559:
+	movq	1040(%r12), %rax	# 5189	[c=9 l=8]  *movdi_internal/3
+	movb	%r14b, 95(%rax)	# 5190	[c=4 l=4]  *movqi_internal/8
+.L561:
+	xorl	%edx, %edx	# 18624	[c=4 l=2]  *movdi_xor
+	movzwl	%r13w, %ecx	# 5201	[c=4 l=4]  *zero_extendhisi2/0
+	leaq	.LC48(%rip), %rsi	# 5204	[c=1 l=7]  *movdi_internal/4
+	movq	%r12, %rdi	# 5206	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 18625	[c=4 l=2]  *movdi_xor
+	call	log_append@PLT	# 5208	[c=0 l=5]  *call
+	movl	%r13d, %ecx	# 16217	[c=4 l=3]  *movsi_internal/0
+	movq	%r12, %rdi	# 5215	[c=4 l=3]  *movdi_internal/3
+	movq	%rbp, %rsi	# 5214	[c=4 l=3]  *movdi_internal/3
+	movq	1040(%r12), %rax	# 5209	[c=9 l=8]  *movdi_internal/3
+	movb	%r13b, (%rax)	# 5210	[c=4 l=3]  *movqi_internal/8
+	movq	1040(%r12), %rax	# 5211	[c=9 l=8]  *movdi_internal/3
+	movb	%ch, 1(%rax)	# 18626	[c=4 l=3]  *extzvqi_mem_rex64
+	call	log_dump_line@PLT	# 5216	[c=0 l=5]  *call
+	movq	40(%r12), %rax	# 16218	[c=9 l=5]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 16219	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 5218	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 17370	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r12)	# 5219	[c=4 l=5]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 5221	[c=4 l=3]  *cmpdi_1/0
+	jb	.L297	# 5222	[c=13 l=6]  *jcc
+	movl	(%r12), %r8d	# 5224	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r12, %rdi	# 5229	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r8	# 5225	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r12), %r8	# 5227	[c=13 l=8]  *adddi_1/1
+	movq	%r8, %rbp	# 16221	[c=4 l=3]  *movdi_internal/3
+	movq	%r8, %rsi	# 5228	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 5230	[c=0 l=5]  *call
+	movzbl	9(%rbp), %eax	# 5231	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, (%r12)	# 5232	[c=9 l=4]  *addsi_1/0
+	leaq	handler.1(%rip), %rdi	# 16224	[c=1 l=7]  *movdi_internal/4
+	movzbl	8(%rbp), %eax	# 5235	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 16222	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 5236	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbx,%rdx), %rdx	# 5239	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r12)	# 5240	[c=13 l=5]  *adddi_1/0
+	jmp	*(%rdi,%rax,8)	# 18623	[c=10 l=3]  *indirect_jump
+.L562:
+	movl	5176(%r12), %r14d	# 5248	[c=9 l=8]  *movsi_internal/0
+	movl	$93, %eax	# 5250	[c=4 l=5]  *movsi_internal/0
+	movl	5180(%r12), %r13d	# 5249	[c=9 l=8]  *movsi_internal/0
+	subl	%r14d, %eax	# 5251	[c=4 l=3]  *subsi_1/0
+	cmpl	%r13d, %eax	# 5252	[c=4 l=3]  *cmpsi_1/0
+	jb	.L563	# 5253	[c=13 l=6]  *jcc
+	cmpb	$1, 1082(%r12)	# 5257	[c=13 l=9]  *cmpqi_1/0
+	ja	.L1362	# 5258	[c=13 l=6]  *jcc
+	movq	1040(%r12), %rax	# 13505	[c=9 l=8]  *movdi_internal/3
+	movzbl	93(%rax), %edx	# 13506	[c=13 l=4]  *zero_extendqisi2/0
+.L565:
+	movzbl	94(%rax), %r15d	# 5295	[c=13 l=5]  *zero_extendqisi2/0
+.L567:
+	sall	$8, %r15d	# 5298	[c=4 l=4]  *ashlsi3_1/0
+	leaq	.LC32(%rip), %rsi	# 5302	[c=1 l=7]  *movdi_internal/4
+	movq	%r12, %rdi	# 5304	[c=4 l=3]  *movdi_internal/3
+	orl	%edx, %r15d	# 5299	[c=4 l=3]  *iorsi_1/0
+	movl	$93, %edx	# 5301	[c=4 l=5]  *movsi_internal/0
+	movl	%r15d, %ecx	# 5300	[c=4 l=3]  *movsi_internal/0
+	call	log_add_data_mov@PLT	# 5305	[c=0 l=5]  *call
+	movl	996(%r12), %edx	# 5307	[c=9 l=8]  *movsi_internal/0
+	movzbl	840(%r12), %eax	# 5309	[c=13 l=9]  *zero_extendqisi2/0
+	leal	1(%rdx,%rax), %eax	# 5310	[c=5 l=4]  *leasi
+	cmpl	%eax, %r15d	# 5311	[c=4 l=3]  *cmpsi_1/0
+	jb	.L1226	# 5312	[c=13 l=6]  *jcc
+	cmpl	$95, %r15d	# 14318	[c=4 l=4]  *cmpsi_1/0
+	movl	(%r12), %r13d	# 5320	[c=5 l=4]  *movsi_internal/0
+	movl	%r15d, %edx	# 5329	[c=4 l=3]  *movsi_internal/0
+	movq	%r12, %rdi	# 5331	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC31(%rip), %rax	# 15714	[c=1 l=7]  *movdi_internal/4
+	leaq	.LC30(%rip), %rsi	# 15713	[c=1 l=7]  *movdi_internal/4
+	cmovne	%rax, %rsi	# 14319	[c=8 l=4]  *movdicc_noc/1
+	movzbl	%r13b, %ecx	# 5322	[c=4 l=4]  *zero_extendqisi2/0
+	leal	-1(%r15), %r14d	# 17369	[c=4 l=4]  *leasi
+	call	log_add_data_mov@PLT	# 5332	[c=0 l=5]  *call
+	movl	%r15d, %eax	# 16225	[c=4 l=3]  *movsi_internal/0
+	subl	5176(%r12), %eax	# 5333	[c=13 l=8]  *subsi_1/1
+	cmpl	5180(%r12), %eax	# 5334	[c=13 l=8]  *cmpsi_1/1
+	jb	.L570	# 5335	[c=13 l=2]  *jcc
+	movl	%r15d, %eax	# 16227	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %eax	# 5337	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 15664	[c=5 l=5]  *andsi_1_zext
+	cmpb	$0, 1080(%r12,%rax)	# 5340	[c=14 l=9]  *cmpqi_ccno_1/1
+	jne	.L571	# 5341	[c=13 l=6]  *jcc
+.L570:
+	movq	1040(%r12), %rdx	# 5345	[c=9 l=8]  *movdi_internal/3
+	movslq	%r15d, %rax	# 5344	[c=4 l=3]  *extendsidi2_rex64/1
+	movb	%r13b, (%rdx,%rax)	# 5346	[c=4 l=4]  *movqi_internal/8
+.L572:
+	movl	(%r12), %ecx	# 5357	[c=5 l=4]  *movsi_internal/0
+	movl	%r14d, %edx	# 5367	[c=4 l=3]  *movsi_internal/0
+	movq	%r12, %rdi	# 5369	[c=4 l=3]  *movdi_internal/3
+	leal	-2(%r15), %r13d	# 17368	[c=4 l=4]  *leasi
+	leaq	.LC30(%rip), %rsi	# 15715	[c=1 l=7]  *movdi_internal/4
+	movl	%ecx, %eax	# 16229	[c=4 l=2]  *movsi_internal/0
+	movzbl	%ch, %ecx	# 5360	[c=4 l=3]  *extzvsi
+	shrl	$8, %eax	# 5358	[c=4 l=3]  *lshrsi3_1/0
+	cmpl	$95, %r14d	# 14330	[c=4 l=4]  *cmpsi_1/0
+	movl	%eax, 8(%rsp)	# 16230	[c=4 l=4]  *movsi_internal/1
+	leaq	.LC31(%rip), %rax	# 15716	[c=1 l=7]  *movdi_internal/4
+	cmovne	%rax, %rsi	# 14331	[c=8 l=4]  *movdicc_noc/1
+	call	log_add_data_mov@PLT	# 5370	[c=0 l=5]  *call
+	movl	%r14d, %eax	# 16231	[c=4 l=3]  *movsi_internal/0
+	subl	5176(%r12), %eax	# 5371	[c=13 l=8]  *subsi_1/1
+	cmpl	5180(%r12), %eax	# 5372	[c=13 l=8]  *cmpsi_1/1
+	jb	.L574	# 5373	[c=13 l=2]  *jcc
+	movl	%r14d, %eax	# 16233	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %eax	# 5375	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 15663	[c=5 l=5]  *andsi_1_zext
+	cmpb	$0, 1080(%r12,%rax)	# 5378	[c=14 l=9]  *cmpqi_ccno_1/1
+	jne	.L575	# 5379	[c=13 l=6]  *jcc
+.L574:
+	movq	1040(%r12), %rax	# 5383	[c=9 l=8]  *movdi_internal/3
+	movzbl	8(%rsp), %edi	# 16235	[c=9 l=5]  *movqi_internal/4
+	movslq	%r14d, %r9	# 5382	[c=4 l=3]  *extendsidi2_rex64/1
+	movb	%dil, (%rax,%r9)	# 5384	[c=4 l=4]  *movqi_internal/8
+.L576:
+	cmpb	$0, 840(%r12)	# 5395	[c=13 l=9]  *cmpqi_ccno_1/1
+	je	.L577	# 5396	[c=13 l=2]  *jcc
+	movl	(%r12), %r14d	# 16236	[c=5 l=4]  *movsi_internal/0
+	subl	$3, %r15d	# 5400	[c=4 l=4]  *addsi_1/0
+	movq	%r12, %rdi	# 5410	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC31(%rip), %rdx	# 15718	[c=1 l=7]  *movdi_internal/4
+	leaq	.LC30(%rip), %rsi	# 15717	[c=1 l=7]  *movdi_internal/4
+	shrl	$16, %r14d	# 5399	[c=4 l=4]  *lshrsi3_1/0
+	cmpl	$95, %r13d	# 14342	[c=4 l=4]  *cmpsi_1/0
+	cmovne	%rdx, %rsi	# 14343	[c=8 l=4]  *movdicc_noc/1
+	movzbl	%r14b, %ecx	# 5401	[c=4 l=4]  *zero_extendqisi2/0
+	movl	%r13d, %edx	# 5408	[c=4 l=3]  *movsi_internal/0
+	call	log_add_data_mov@PLT	# 5411	[c=0 l=5]  *call
+	movl	%r13d, %edx	# 16238	[c=4 l=3]  *movsi_internal/0
+	subl	5176(%r12), %edx	# 5412	[c=13 l=8]  *subsi_1/1
+	cmpl	5180(%r12), %edx	# 5413	[c=13 l=8]  *cmpsi_1/1
+	jb	.L579	# 5414	[c=13 l=2]  *jcc
+	movl	%r13d, %edx	# 16240	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %edx	# 5416	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %edx	# 15662	[c=5 l=6]  *andsi_1_zext
+	cmpb	$0, 1080(%r12,%rdx)	# 5419	[c=14 l=9]  *cmpqi_ccno_1/1
+	jne	.L580	# 5420	[c=13 l=6]  *jcc
+.L579:
+	movq	1040(%r12), %rdx	# 5424	[c=9 l=8]  *movdi_internal/3
+	movslq	%r13d, %r13	# 5423	[c=4 l=3]  *extendsidi2_rex64/1
+	movb	%r14b, (%rdx,%r13)	# 5425	[c=4 l=4]  *movqi_internal/8
+.L581:
+	movl	%r15d, %r13d	# 32	[c=4 l=3]  *movsi_internal/0
+.L577:
+	movzwl	%r13w, %r14d	# 5440	[c=4 l=4]  *zero_extendhisi2/0
+	movl	$93, %edx	# 5442	[c=4 l=5]  *movsi_internal/0
+	leaq	.LC33(%rip), %rsi	# 5443	[c=1 l=7]  *movdi_internal/4
+	movq	%r12, %rdi	# 5445	[c=4 l=3]  *movdi_internal/3
+	movl	%r14d, %ecx	# 5441	[c=4 l=3]  *movsi_internal/0
+	call	log_add_data_mov@PLT	# 5446	[c=0 l=5]  *call
+	movl	$93, %eax	# 5447	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r12), %eax	# 5448	[c=13 l=8]  *subsi_1/1
+	cmpl	5180(%r12), %eax	# 5449	[c=13 l=8]  *cmpsi_1/1
+	jb	.L582	# 5450	[c=13 l=2]  *jcc
+	cmpb	$1, 1082(%r12)	# 5454	[c=13 l=9]  *cmpqi_1/0
+	ja	.L1363	# 5455	[c=13 l=6]  *jcc
+.L582:
+	movq	1040(%r12), %rax	# 5466	[c=9 l=8]  *movdi_internal/3
+	movb	%r13b, 93(%rax)	# 5467	[c=4 l=4]  *movqi_internal/8
+.L583:
+	movl	$94, %eax	# 5471	[c=4 l=5]  *movsi_internal/0
+	sarl	$8, %r14d	# 5470	[c=4 l=4]  *ashrsi3_1/0
+	subl	5176(%r12), %eax	# 5472	[c=13 l=8]  *subsi_1/1
+	cmpl	5180(%r12), %eax	# 5473	[c=13 l=8]  *cmpsi_1/1
+	jb	.L584	# 5474	[c=13 l=2]  *jcc
+	cmpb	$1, 1082(%r12)	# 5478	[c=13 l=9]  *cmpqi_1/0
+	ja	.L1364	# 5479	[c=13 l=6]  *jcc
+.L584:
+	movq	1040(%r12), %rax	# 5489	[c=9 l=8]  *movdi_internal/3
+	movb	%r14b, 94(%rax)	# 5490	[c=4 l=4]  *movqi_internal/8
+.L585:
+	movq	1040(%r12), %rax	# 5493	[c=9 l=8]  *movdi_internal/3
+	movl	$30, %edx	# 5497	[c=4 l=5]  *movsi_internal/0
+	leaq	.LC44(%rip), %rsi	# 5498	[c=1 l=7]  *movdi_internal/4
+	movq	%r12, %rdi	# 5500	[c=4 l=3]  *movdi_internal/3
+	movzwl	30(%rax), %r13d	# 5495	[c=13 l=5]  *zero_extendhisi2/0
+	xorl	%eax, %eax	# 18622	[c=4 l=2]  *movdi_xor
+	movl	%r13d, %ecx	# 5496	[c=4 l=3]  *movsi_internal/0
+	call	log_append@PLT	# 5502	[c=0 l=5]  *call
+	movl	%r13d, (%r12)	# 5504	[c=4 l=4]  *movsi_internal/1
+	cmpl	%r13d, 992(%r12)	# 5505	[c=13 l=8]  *cmpsi_1/0
+	jb	.L1224	# 5506	[c=13 l=6]  *jcc
+	movzbl	840(%r12), %eax	# 5514	[c=13 l=9]  zero_extendqidi2/0
+	movq	%r12, %rdi	# 5517	[c=4 l=3]  *movdi_internal/3
+	movq	%rbp, %rsi	# 5516	[c=4 l=3]  *movdi_internal/3
+	addq	%rax, 48(%r12)	# 5515	[c=13 l=5]  *adddi_1/0
+	call	log_dump_line@PLT	# 5518	[c=0 l=5]  *call
+	movq	40(%r12), %rax	# 16242	[c=9 l=5]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 16243	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 5520	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 17367	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r12)	# 5521	[c=4 l=5]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 5523	[c=4 l=3]  *cmpdi_1/0
+	jb	.L297	# 5524	[c=13 l=6]  *jcc
+	movq	56(%r12), %rax	# 16244	[c=9 l=5]  *movdi_internal/3
+	cmpq	%rax, 48(%r12)	# 5527	[c=13 l=5]  *cmpdi_1/0
+	jnb	.L1365	# 5528	[c=13 l=6]  *jcc
+.L587:
+	movq	%r12, %rdi	# 5534	[c=4 l=3]  *movdi_internal/3
+	call	log_is_idle@PLT	# 5535	[c=10 l=5]  *call_value
+	testb	%al, %al	# 5537	[c=4 l=2]  *cmpqi_ccno_1/0
+	jne	.L1366	# 5538	[c=13 l=6]  *jcc
+.L588:
+	movl	(%r12), %r8d	# 5549	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r12, %rdi	# 5554	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r8	# 5550	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r12), %r8	# 5552	[c=13 l=8]  *adddi_1/1
+	movq	%r8, %rbp	# 16246	[c=4 l=3]  *movdi_internal/3
+	movq	%r8, %rsi	# 5553	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 5555	[c=0 l=5]  *call
+	movzbl	9(%rbp), %eax	# 5556	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, (%r12)	# 5557	[c=9 l=4]  *addsi_1/0
+	leaq	handler.1(%rip), %rdi	# 16249	[c=1 l=7]  *movdi_internal/4
+	movzbl	8(%rbp), %eax	# 5560	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 16247	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 5561	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbx,%rdx), %rdx	# 5564	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r12)	# 5565	[c=13 l=5]  *adddi_1/0
+	jmp	*(%rdi,%rax,8)	# 18621	[c=10 l=3]  *indirect_jump
+.L548:
+	movzbl	10(%rbp), %r14d	# 4969	[c=13 l=5]  zero_extendqidi2/0
+	xorl	%eax, %eax	# 18636	[c=4 l=2]  *movdi_xor
+	movq	%r12, %rdi	# 4978	[c=4 l=3]  *movdi_internal/3
+	movzwl	12(%rbp), %r15d	# 4968	[c=13 l=5]  zero_extendhidi2/0
+	movq	1040(%r12), %rdx	# 4971	[c=9 l=8]  *movdi_internal/3
+	leaq	.LC43(%rip), %rsi	# 4976	[c=1 l=7]  *movdi_internal/4
+	movzbl	(%rdx,%r14), %ecx	# 4972	[c=13 l=5]  *zero_extendqisi2/0
+	movzbl	%r14b, %edx	# 4973	[c=4 l=4]  *zero_extendqisi2/0
+	call	log_append@PLT	# 4980	[c=0 l=5]  *call
+	movq	1040(%r12), %rax	# 4981	[c=9 l=8]  *movdi_internal/3
+	movzwl	%r15w, %edx	# 4985	[c=4 l=4]  *zero_extendhisi2/0
+	movq	%r12, %rdi	# 4990	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC43(%rip), %rsi	# 17128	[c=1 l=7]  *movdi_internal/4
+	movzbl	(%rax,%r15), %ecx	# 4984	[c=13 l=5]  *zero_extendqisi2/0
+	movsbl	(%rax,%r14), %r14d	# 4982	[c=13 l=5]  extendqisi2
+	xorl	%eax, %eax	# 18637	[c=4 l=2]  *movdi_xor
+	call	log_append@PLT	# 4992	[c=0 l=5]  *call
+	movq	1040(%r12), %rcx	# 4993	[c=9 l=8]  *movdi_internal/3
+	xorl	%edx, %edx	# 18638	[c=4 l=2]  *movsi_xor
+	movsbl	(%rcx,%r15), %eax	# 4994	[c=13 l=5]  extendqisi2
+	imull	%r14d, %eax	# 4995	[c=12 l=4]  *mulsi3_1/2
+	movzwl	%ax, %eax	# 4996	[c=4 l=3]  *zero_extendhisi2/0
+	movl	%eax, %r13d	# 16199	[c=4 l=3]  *movsi_internal/0
+	addl	%r13d, %r13d	# 18639	[c=4 l=3]  *ashlsi3_cmp
+	sete	%dl	# 18640	[c=4 l=3]  *setcc_qi_slp
+	sarl	$15, %eax	# 5003	[c=4 l=3]  *ashrsi3_1/0
+	addl	%edx, %edx	# 5002	[c=4 l=2]  *ashlsi3_1/0
+	orl	%eax, %edx	# 5004	[c=4 l=2]  *iorsi_1/0
+	movl	$95, %eax	# 5005	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r12), %eax	# 5006	[c=13 l=8]  *subsi_1/1
+	movl	%edx, %r14d	# 16202	[c=4 l=3]  *movsi_internal/0
+	cmpl	5180(%r12), %eax	# 5007	[c=13 l=8]  *cmpsi_1/1
+	jb	.L549	# 5008	[c=13 l=2]  *jcc
+	cmpb	$0, 1082(%r12)	# 5010	[c=13 l=9]  *cmpqi_ccno_1/1
+	jne	.L550	# 5011	[c=13 l=6]  *jcc
+.L549:
+	movzbl	95(%rcx), %r15d	# 5014	[c=13 l=5]  *zero_extendqisi2/0
+.L551:
+	movl	%r15d, %ecx	# 5025	[c=4 l=3]  *movsi_internal/0
+	andl	$-4, %r15d	# 5031	[c=4 l=4]  *andsi_1/0
+	movl	$95, %edx	# 5026	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 5029	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC28(%rip), %rsi	# 5027	[c=1 l=7]  *movdi_internal/4
+	orl	%r15d, %r14d	# 5032	[c=4 l=3]  *iorsi_1/0
+	call	log_add_data_mov@PLT	# 5030	[c=0 l=5]  *call
+	movzbl	%r14b, %ecx	# 5033	[c=4 l=4]  *zero_extendqisi2/0
+	movl	$95, %edx	# 5035	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 5038	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC30(%rip), %rsi	# 5036	[c=1 l=7]  *movdi_internal/4
+	call	log_add_data_mov@PLT	# 5039	[c=0 l=5]  *call
+	movl	$95, %eax	# 5040	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r12), %eax	# 5041	[c=13 l=8]  *subsi_1/1
+	cmpl	5180(%r12), %eax	# 5042	[c=13 l=8]  *cmpsi_1/1
+	jb	.L552	# 5043	[c=13 l=2]  *jcc
+	cmpb	$0, 1082(%r12)	# 5045	[c=13 l=9]  *cmpqi_ccno_1/1
+	jne	.L553	# 5046	[c=13 l=6]  *jcc
+.L552:
+	movq	1040(%r12), %rax	# 5049	[c=9 l=8]  *movdi_internal/3
+	movb	%r14b, 95(%rax)	# 5050	[c=4 l=4]  *movqi_internal/8
+.L554:
+	xorl	%edx, %edx	# 18633	[c=4 l=2]  *movdi_xor
+	movzwl	%r13w, %ecx	# 5061	[c=4 l=4]  *zero_extendhisi2/0
+	leaq	.LC48(%rip), %rsi	# 5064	[c=1 l=7]  *movdi_internal/4
+	movq	%r12, %rdi	# 5066	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 18634	[c=4 l=2]  *movdi_xor
+	call	log_append@PLT	# 5068	[c=0 l=5]  *call
+	movl	%r13d, %ecx	# 16204	[c=4 l=3]  *movsi_internal/0
+	movq	%r12, %rdi	# 5075	[c=4 l=3]  *movdi_internal/3
+	movq	%rbp, %rsi	# 5074	[c=4 l=3]  *movdi_internal/3
+	movq	1040(%r12), %rax	# 5069	[c=9 l=8]  *movdi_internal/3
+	movb	%r13b, (%rax)	# 5070	[c=4 l=3]  *movqi_internal/8
+	movq	1040(%r12), %rax	# 5071	[c=9 l=8]  *movdi_internal/3
+	movb	%ch, 1(%rax)	# 18635	[c=4 l=3]  *extzvqi_mem_rex64
+	call	log_dump_line@PLT	# 5076	[c=0 l=5]  *call
+	movq	40(%r12), %rax	# 16205	[c=9 l=5]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 16206	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 5078	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 17373	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r12)	# 5079	[c=4 l=5]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 5081	[c=4 l=3]  *cmpdi_1/0
+	jb	.L297	# 5082	[c=13 l=6]  *jcc
+	movl	(%r12), %r8d	# 5084	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r12, %rdi	# 5089	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r8	# 5085	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r12), %r8	# 5087	[c=13 l=8]  *adddi_1/1
+	movq	%r8, %rbp	# 16208	[c=4 l=3]  *movdi_internal/3
+	movq	%r8, %rsi	# 5088	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 5090	[c=0 l=5]  *call
+	movzbl	9(%rbp), %eax	# 5091	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, (%r12)	# 5092	[c=9 l=4]  *addsi_1/0
+	leaq	handler.1(%rip), %rdi	# 16211	[c=1 l=7]  *movdi_internal/4
+	movzbl	8(%rbp), %eax	# 5095	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 16209	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 5096	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbx,%rdx), %rdx	# 5099	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r12)	# 5100	[c=13 l=5]  *adddi_1/0
+	jmp	*(%rdi,%rax,8)	# 18632	[c=10 l=3]  *indirect_jump
+.L589:
+	movq	1040(%r12), %rax	# 5573	[c=9 l=8]  *movdi_internal/3
+	movl	$30, %edx	# 5577	[c=4 l=5]  *movsi_internal/0
+	leaq	.LC44(%rip), %rsi	# 5578	[c=1 l=7]  *movdi_internal/4
+	movq	%r12, %rdi	# 5580	[c=4 l=3]  *movdi_internal/3
+	movzwl	30(%rax), %r13d	# 5575	[c=13 l=5]  *zero_extendhisi2/0
+	xorl	%eax, %eax	# 18620	[c=4 l=2]  *movdi_xor
+	movl	%r13d, %ecx	# 5576	[c=4 l=3]  *movsi_internal/0
+	call	log_append@PLT	# 5582	[c=0 l=5]  *call
+	movl	%r13d, (%r12)	# 5584	[c=4 l=4]  *movsi_internal/1
+	cmpl	%r13d, 992(%r12)	# 5585	[c=13 l=8]  *cmpsi_1/0
+	jb	.L1224	# 5586	[c=13 l=6]  *jcc
+	movq	%r12, %rdi	# 5595	[c=4 l=3]  *movdi_internal/3
+	movq	%rbp, %rsi	# 5594	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 5596	[c=0 l=5]  *call
+	movq	40(%r12), %rax	# 16250	[c=9 l=5]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 16251	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 5598	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 17366	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r12)	# 5599	[c=4 l=5]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 5601	[c=4 l=3]  *cmpdi_1/0
+	jb	.L297	# 5602	[c=13 l=6]  *jcc
+	movq	56(%r12), %rax	# 16252	[c=9 l=5]  *movdi_internal/3
+	cmpq	%rax, 48(%r12)	# 5605	[c=13 l=5]  *cmpdi_1/0
+	jnb	.L1367	# 5606	[c=13 l=6]  *jcc
+.L591:
+	movq	%r12, %rdi	# 5612	[c=4 l=3]  *movdi_internal/3
+	call	log_is_idle@PLT	# 5613	[c=10 l=5]  *call_value
+	testb	%al, %al	# 5615	[c=4 l=2]  *cmpqi_ccno_1/0
+	jne	.L1368	# 5616	[c=13 l=6]  *jcc
+.L592:
+	movl	(%r12), %r8d	# 5627	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r12, %rdi	# 5632	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r8	# 5628	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r12), %r8	# 5630	[c=13 l=8]  *adddi_1/1
+	movq	%r8, %rbp	# 16254	[c=4 l=3]  *movdi_internal/3
+	movq	%r8, %rsi	# 5631	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 5633	[c=0 l=5]  *call
+	movzbl	9(%rbp), %eax	# 5634	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, (%r12)	# 5635	[c=9 l=4]  *addsi_1/0
+	leaq	handler.1(%rip), %rdi	# 16257	[c=1 l=7]  *movdi_internal/4
+	movzbl	8(%rbp), %eax	# 5638	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 16255	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 5639	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbx,%rdx), %rdx	# 5642	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r12)	# 5643	[c=13 l=5]  *adddi_1/0
+	jmp	*(%rdi,%rax,8)	# 18619	[c=10 l=3]  *indirect_jump
+.L593:
+	movzwl	12(%rbp), %edx	# 5651	[c=13 l=4]  zero_extendhidi2/0
+	movzbl	10(%rbp), %r14d	# 5653	[c=13 l=5]  *zero_extendqisi2/0
+	movl	%edx, %ecx	# 16258	[c=4 l=2]  *movsi_internal/0
+	movq	%rdx, %rax	# 17682	[c=4 l=3]  *movdi_internal/3
+	movl	%r14d, %r15d	# 17683	[c=4 l=3]  *movsi_internal/0
+	subl	5176(%r12), %ecx	# 5656	[c=13 l=8]  *subsi_1/1
+	cmpl	5180(%r12), %ecx	# 5657	[c=13 l=8]  *cmpsi_1/1
+	jb	.L594	# 5658	[c=13 l=2]  *jcc
+	movl	%edx, %ecx	# 16260	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %ecx	# 5660	[c=4 l=3]  *ashrsi3_1/0
+	movslq	%ecx, %rcx	# 5661	[c=4 l=3]  *extendsidi2_rex64/1
+	cmpb	$0, 1080(%r12,%rcx)	# 5662	[c=14 l=9]  *cmpqi_ccno_1/1
+	jne	.L595	# 5663	[c=13 l=6]  *jcc
+.L594:
+	movq	1040(%r12), %rcx	# 5667	[c=9 l=8]  *movdi_internal/3
+	movzbl	(%rcx,%rax), %r13d	# 5668	[c=13 l=5]  *zero_extendqisi2/0
+.L596:
+	cmpl	$95, %edx	# 14354	[c=4 l=3]  *cmpsi_1/0
+	leaq	.LC29(%rip), %rax	# 15720	[c=1 l=7]  *movdi_internal/4
+	movl	%r13d, %ecx	# 5684	[c=4 l=3]  *movsi_internal/0
+	movq	%r12, %rdi	# 5687	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC28(%rip), %rsi	# 15719	[c=1 l=7]  *movdi_internal/4
+	cmovne	%rax, %rsi	# 14355	[c=8 l=4]  *movdicc_noc/1
+	call	log_add_data_mov@PLT	# 5688	[c=0 l=5]  *call
+	movzbl	%r13b, %ecx	# 5689	[c=4 l=4]  *zero_extendqisi2/0
+	movl	%r14d, %edx	# 5691	[c=4 l=3]  *movsi_internal/0
+	movq	%r12, %rdi	# 5694	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC59(%rip), %rsi	# 5692	[c=1 l=7]  *movdi_internal/4
+	xorl	%eax, %eax	# 18618	[c=4 l=2]  *movdi_xor
+	call	log_append@PLT	# 5696	[c=0 l=5]  *call
+	movzbl	%r15b, %eax	# 5697	[c=4 l=4]  zero_extendqidi2/0
+	movq	%r12, %rdi	# 5701	[c=4 l=3]  *movdi_internal/3
+	movq	%rbp, %rsi	# 5700	[c=4 l=3]  *movdi_internal/3
+	movq	1040(%r12), %rdx	# 5698	[c=9 l=8]  *movdi_internal/3
+	movb	%r13b, (%rdx,%rax)	# 5699	[c=4 l=4]  *movqi_internal/8
+	call	log_dump_line@PLT	# 5702	[c=0 l=5]  *call
+	movq	40(%r12), %rax	# 16262	[c=9 l=5]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 16263	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 5704	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 17365	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r12)	# 5705	[c=4 l=5]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 5707	[c=4 l=3]  *cmpdi_1/0
+	jb	.L297	# 5708	[c=13 l=6]  *jcc
+	movl	(%r12), %r8d	# 5710	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r12, %rdi	# 5715	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r8	# 5711	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r12), %r8	# 5713	[c=13 l=8]  *adddi_1/1
+	movq	%r8, %rbp	# 16265	[c=4 l=3]  *movdi_internal/3
+	movq	%r8, %rsi	# 5714	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 5716	[c=0 l=5]  *call
+	movzbl	9(%rbp), %eax	# 5717	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, (%r12)	# 5718	[c=9 l=4]  *addsi_1/0
+	leaq	handler.1(%rip), %rdi	# 16268	[c=1 l=7]  *movdi_internal/4
+	movzbl	8(%rbp), %eax	# 5721	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 16266	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 5722	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbx,%rdx), %rdx	# 5725	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r12)	# 5726	[c=13 l=5]  *adddi_1/0
+	jmp	*(%rdi,%rax,8)	# 18617	[c=10 l=3]  *indirect_jump
+.L598:
+	movzbl	10(%rbp), %edx	# 5734	[c=13 l=4]  zero_extendqidi2/0
+	movq	1040(%r12), %rax	# 5737	[c=9 l=8]  *movdi_internal/3
+	leaq	.LC43(%rip), %rsi	# 5741	[c=1 l=7]  *movdi_internal/4
+	movq	%r12, %rdi	# 5743	[c=4 l=3]  *movdi_internal/3
+	movzbl	(%rax,%rdx), %ecx	# 5738	[c=13 l=4]  *zero_extendqisi2/0
+	xorl	%eax, %eax	# 18615	[c=4 l=2]  *movdi_xor
+	movq	%rdx, %r13	# 17684	[c=4 l=3]  *movdi_internal/3
+	movl	%edx, 8(%rsp)	# 17135	[c=4 l=4]  *movsi_internal/1
+	call	log_append@PLT	# 5745	[c=0 l=5]  *call
+	movq	1040(%r12), %rax	# 5746	[c=9 l=8]  *movdi_internal/3
+	movl	8(%rsp), %edx	# 17136	[c=9 l=4]  *movsi_internal/0
+	movq	%r12, %rdi	# 5755	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC59(%rip), %rsi	# 5753	[c=1 l=7]  *movdi_internal/4
+	movzbl	(%rax,%r13), %r15d	# 5747	[c=9 l=5]  *movqi_internal/4
+	xorl	%eax, %eax	# 18616	[c=4 l=2]  *movdi_xor
+	leal	1(%r15), %r14d	# 17363	[c=4 l=4]  *leasi
+	movzbl	%r14b, %r14d	# 5750	[c=4 l=4]  zero_extendqidi2/0
+	movl	%r14d, %ecx	# 5751	[c=4 l=3]  *movsi_internal/0
+	call	log_append@PLT	# 5757	[c=0 l=5]  *call
+	movq	1040(%r12), %rdx	# 5758	[c=9 l=8]  *movdi_internal/3
+	leal	1(%r15), %eax	# 17364	[c=4 l=4]  *leasi
+	movb	%al, (%rdx,%r13)	# 5760	[c=4 l=4]  *movqi_internal/8
+	movl	$95, %eax	# 5761	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r12), %eax	# 5762	[c=13 l=8]  *subsi_1/1
+	cmpl	5180(%r12), %eax	# 5763	[c=13 l=8]  *cmpsi_1/1
+	jb	.L599	# 5764	[c=13 l=2]  *jcc
+	cmpb	$0, 1082(%r12)	# 5766	[c=13 l=9]  *cmpqi_ccno_1/1
+	jne	.L600	# 5767	[c=13 l=6]  *jcc
+.L599:
+	movq	1040(%r12), %rax	# 5770	[c=9 l=8]  *movdi_internal/3
+	movzbl	95(%rax), %r13d	# 5771	[c=13 l=5]  *zero_extendqisi2/0
+.L601:
+	movl	%r13d, %ecx	# 5782	[c=4 l=3]  *movsi_internal/0
+	movl	$95, %edx	# 5783	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 5786	[c=4 l=3]  *movdi_internal/3
+	andl	$-31, %r13d	# 5788	[c=4 l=4]  *andsi_1/0
+	leaq	.LC28(%rip), %rsi	# 5784	[c=1 l=7]  *movdi_internal/4
+	call	log_add_data_mov@PLT	# 5787	[c=0 l=5]  *call
+	leaq	flag_update_table_inc(%rip), %rax	# 15684	[c=1 l=7]  *movdi_internal/4
+	movl	$95, %edx	# 5795	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 5798	[c=4 l=3]  *movdi_internal/3
+	movzbl	(%rax,%r14), %eax	# 5791	[c=13 l=5]  *zero_extendqisi2/0
+	leaq	.LC30(%rip), %rsi	# 5796	[c=1 l=7]  *movdi_internal/4
+	orl	%eax, %r13d	# 5792	[c=4 l=3]  *iorsi_1/0
+	movzbl	%r13b, %ecx	# 5793	[c=4 l=4]  *zero_extendqisi2/0
+	call	log_add_data_mov@PLT	# 5799	[c=0 l=5]  *call
+	movl	$95, %eax	# 5800	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r12), %eax	# 5801	[c=13 l=8]  *subsi_1/1
+	cmpl	5180(%r12), %eax	# 5802	[c=13 l=8]  *cmpsi_1/1
+	jb	.L602	# 5803	[c=13 l=2]  *jcc
+	cmpb	$0, 1082(%r12)	# 5805	[c=13 l=9]  *cmpqi_ccno_1/1
+	jne	.L603	# 5806	[c=13 l=6]  *jcc
+.L602:
+	movq	1040(%r12), %rax	# 5809	[c=9 l=8]  *movdi_internal/3
+	movb	%r13b, 95(%rax)	# 5810	[c=4 l=4]  *movqi_internal/8
+.L604:
+	movq	%r12, %rdi	# 5822	[c=4 l=3]  *movdi_internal/3
+	movq	%rbp, %rsi	# 5821	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 5823	[c=0 l=5]  *call
+	movq	40(%r12), %rax	# 16269	[c=9 l=5]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 16270	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 5825	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 17362	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r12)	# 5826	[c=4 l=5]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 5828	[c=4 l=3]  *cmpdi_1/0
+	jb	.L297	# 5829	[c=13 l=6]  *jcc
+	movl	(%r12), %r8d	# 5831	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r12, %rdi	# 5836	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r8	# 5832	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r12), %r8	# 5834	[c=13 l=8]  *adddi_1/1
+	movq	%r8, %rbp	# 16272	[c=4 l=3]  *movdi_internal/3
+	movq	%r8, %rsi	# 5835	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 5837	[c=0 l=5]  *call
+	movzbl	9(%rbp), %eax	# 5838	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, (%r12)	# 5839	[c=9 l=4]  *addsi_1/0
+	leaq	handler.1(%rip), %rdi	# 16275	[c=1 l=7]  *movdi_internal/4
+	movzbl	8(%rbp), %eax	# 5842	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 16273	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 5843	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbx,%rdx), %rdx	# 5846	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r12)	# 5847	[c=13 l=5]  *adddi_1/0
+	jmp	*(%rdi,%rax,8)	# 18614	[c=10 l=3]  *indirect_jump
+.L605:
+	movzbl	10(%rbp), %esi	# 5855	[c=13 l=4]  *zero_extendqisi2/0
+	movzwl	12(%rbp), %eax	# 5857	[c=13 l=4]  *zero_extendhisi2/0
+	sall	$16, %esi	# 5856	[c=4 l=3]  *ashlsi3_1/0
+	orl	%eax, %esi	# 5858	[c=4 l=2]  *iorsi_1/0
+	movl	%esi, (%r12)	# 5859	[c=4 l=4]  *movsi_internal/1
+	cmpl	%esi, 992(%r12)	# 5860	[c=13 l=8]  *cmpsi_1/0
+	jb	.L1225	# 5861	[c=13 l=6]  *jcc
+	movq	%r12, %rdi	# 5870	[c=4 l=3]  *movdi_internal/3
+	movq	%rbp, %rsi	# 5869	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 5871	[c=0 l=5]  *call
+	movq	40(%r12), %rax	# 16276	[c=9 l=5]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 16277	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 5873	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 17361	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r12)	# 5874	[c=4 l=5]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 5876	[c=4 l=3]  *cmpdi_1/0
+	jb	.L297	# 5877	[c=13 l=6]  *jcc
+	movq	56(%r12), %rax	# 16278	[c=9 l=5]  *movdi_internal/3
+	cmpq	%rax, 48(%r12)	# 5880	[c=13 l=5]  *cmpdi_1/0
+	jnb	.L1369	# 5881	[c=13 l=6]  *jcc
+.L607:
+	movq	%r12, %rdi	# 5887	[c=4 l=3]  *movdi_internal/3
+	call	log_is_idle@PLT	# 5888	[c=10 l=5]  *call_value
+	testb	%al, %al	# 5890	[c=4 l=2]  *cmpqi_ccno_1/0
+	jne	.L1370	# 5891	[c=13 l=6]  *jcc
+.L608:
+	movl	(%r12), %r8d	# 5902	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r12, %rdi	# 5907	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r8	# 5903	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r12), %r8	# 5905	[c=13 l=8]  *adddi_1/1
+	movq	%r8, %rbp	# 16280	[c=4 l=3]  *movdi_internal/3
+	movq	%r8, %rsi	# 5906	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 5908	[c=0 l=5]  *call
+	movzbl	9(%rbp), %eax	# 5909	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, (%r12)	# 5910	[c=9 l=4]  *addsi_1/0
+	leaq	handler.1(%rip), %rdi	# 16283	[c=1 l=7]  *movdi_internal/4
+	movzbl	8(%rbp), %eax	# 5913	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 16281	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 5914	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbx,%rdx), %rdx	# 5917	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r12)	# 5918	[c=13 l=5]  *adddi_1/0
+	jmp	*(%rdi,%rax,8)	# 18613	[c=10 l=3]  *indirect_jump
+.L609:
+	movzwl	12(%rbp), %r14d	# 5926	[c=9 l=5]  *movhi_internal/2
+	movzbl	10(%rbp), %edx	# 5927	[c=13 l=4]  zero_extendqidi2/0
+	movq	%r12, %rdi	# 5935	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 18612	[c=4 l=2]  *movdi_xor
+	leaq	.LC59(%rip), %rsi	# 5933	[c=1 l=7]  *movdi_internal/4
+	movzbl	%r14b, %ecx	# 5929	[c=4 l=4]  *zero_extendqisi2/0
+	movq	%rdx, %r13	# 17685	[c=4 l=3]  *movdi_internal/3
+	call	log_append@PLT	# 5937	[c=0 l=5]  *call
+	movq	1040(%r12), %rax	# 5939	[c=9 l=8]  *movdi_internal/3
+	movq	%r12, %rdi	# 5942	[c=4 l=3]  *movdi_internal/3
+	movq	%rbp, %rsi	# 5941	[c=4 l=3]  *movdi_internal/3
+	movb	%r14b, (%rax,%r13)	# 5940	[c=4 l=4]  *movqi_internal/8
+	call	log_dump_line@PLT	# 5943	[c=0 l=5]  *call
+	movq	40(%r12), %rax	# 16284	[c=9 l=5]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 16285	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 5945	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 17360	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r12)	# 5946	[c=4 l=5]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 5948	[c=4 l=3]  *cmpdi_1/0
+	jb	.L297	# 5949	[c=13 l=6]  *jcc
+	movl	(%r12), %r8d	# 5951	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r12, %rdi	# 5956	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r8	# 5952	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r12), %r8	# 5954	[c=13 l=8]  *adddi_1/1
+	movq	%r8, %rbp	# 16287	[c=4 l=3]  *movdi_internal/3
+	movq	%r8, %rsi	# 5955	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 5957	[c=0 l=5]  *call
+	movzbl	9(%rbp), %eax	# 5958	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, (%r12)	# 5959	[c=9 l=4]  *addsi_1/0
+	leaq	handler.1(%rip), %rdi	# 16290	[c=1 l=7]  *movdi_internal/4
+	movzbl	8(%rbp), %eax	# 5962	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 16288	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 5963	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbx,%rdx), %rdx	# 5966	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r12)	# 5967	[c=13 l=5]  *adddi_1/0
+	jmp	*(%rdi,%rax,8)	# 18611	[c=10 l=3]  *indirect_jump
+.L610:
+	movzbl	10(%rbp), %eax	# 5976	[c=13 l=4]  zero_extendqidi2/0
+	movzwl	12(%rbp), %r14d	# 5975	[c=13 l=5]  *zero_extendhisi2/0
+	movl	$28, %edx	# 5981	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 5984	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC44(%rip), %rsi	# 5982	[c=1 l=7]  *movdi_internal/4
+	movl	%eax, 8(%rsp)	# 16291	[c=4 l=4]  *movsi_internal/1
+	movq	%rax, %r13	# 17686	[c=4 l=3]  *movdi_internal/3
+	movq	1040(%r12), %rax	# 5978	[c=9 l=8]  *movdi_internal/3
+	movzwl	28(%rax), %r15d	# 5979	[c=13 l=5]  *zero_extendhisi2/0
+	xorl	%eax, %eax	# 18610	[c=4 l=2]  *movdi_xor
+	movl	%r15d, %ecx	# 5980	[c=4 l=3]  *movsi_internal/0
+	call	log_append@PLT	# 5986	[c=0 l=5]  *call
+	leal	(%r14,%r15), %edx	# 17359	[c=4 l=4]  *leasi
+	movl	%edx, %eax	# 16292	[c=4 l=2]  *movsi_internal/0
+	subl	5176(%r12), %eax	# 5988	[c=13 l=8]  *subsi_1/1
+	cmpl	5180(%r12), %eax	# 5989	[c=13 l=8]  *cmpsi_1/1
+	jb	.L611	# 5990	[c=13 l=2]  *jcc
+	movl	%edx, %eax	# 16294	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %eax	# 5992	[c=4 l=3]  *ashrsi3_1/0
+	cltq	# 5993	[c=4 l=2]  *extendsidi2_rex64/0
+	cmpb	$0, 1080(%r12,%rax)	# 5994	[c=14 l=9]  *cmpqi_ccno_1/1
+	jne	.L612	# 5995	[c=13 l=6]  *jcc
+.L611:
+	movq	1040(%r12), %rcx	# 5999	[c=9 l=8]  *movdi_internal/3
+	movslq	%edx, %rax	# 5998	[c=4 l=3]  *extendsidi2_rex64/1
+	movzbl	(%rcx,%rax), %r14d	# 6000	[c=13 l=5]  *zero_extendqisi2/0
+.L613:
+	cmpl	$95, %edx	# 14366	[c=4 l=3]  *cmpsi_1/0
+	leaq	.LC29(%rip), %rax	# 15722	[c=1 l=7]  *movdi_internal/4
+	movl	%r14d, %ecx	# 6016	[c=4 l=3]  *movsi_internal/0
+	movq	%r12, %rdi	# 6019	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC28(%rip), %rsi	# 15721	[c=1 l=7]  *movdi_internal/4
+	cmovne	%rax, %rsi	# 14367	[c=8 l=4]  *movdicc_noc/1
+	call	log_add_data_mov@PLT	# 6020	[c=0 l=5]  *call
+	movzbl	%r13b, %edx	# 17256	[c=4 l=4]  *zero_extendqisi2/0
+	movzbl	%r14b, %ecx	# 6021	[c=4 l=4]  *zero_extendqisi2/0
+	movq	%r12, %rdi	# 6026	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC59(%rip), %rsi	# 6024	[c=1 l=7]  *movdi_internal/4
+	xorl	%eax, %eax	# 18609	[c=4 l=2]  *movdi_xor
+	call	log_append@PLT	# 6028	[c=0 l=5]  *call
+	movq	1040(%r12), %rax	# 6030	[c=9 l=8]  *movdi_internal/3
+	movq	%r12, %rdi	# 6033	[c=4 l=3]  *movdi_internal/3
+	movq	%rbp, %rsi	# 6032	[c=4 l=3]  *movdi_internal/3
+	movb	%r14b, (%rax,%r13)	# 6031	[c=4 l=4]  *movqi_internal/8
+	call	log_dump_line@PLT	# 6034	[c=0 l=5]  *call
+	movq	40(%r12), %rax	# 16296	[c=9 l=5]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 16297	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 6036	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 17358	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r12)	# 6037	[c=4 l=5]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 6039	[c=4 l=3]  *cmpdi_1/0
+	jb	.L297	# 6040	[c=13 l=6]  *jcc
+	movl	(%r12), %r8d	# 6042	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r12, %rdi	# 6047	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r8	# 6043	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r12), %r8	# 6045	[c=13 l=8]  *adddi_1/1
+	movq	%r8, %rbp	# 16299	[c=4 l=3]  *movdi_internal/3
+	movq	%r8, %rsi	# 6046	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 6048	[c=0 l=5]  *call
+	movzbl	9(%rbp), %eax	# 6049	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, (%r12)	# 6050	[c=9 l=4]  *addsi_1/0
+	leaq	handler.1(%rip), %rdi	# 16302	[c=1 l=7]  *movdi_internal/4
+	movzbl	8(%rbp), %eax	# 6053	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 16300	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 6054	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbx,%rdx), %rdx	# 6057	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r12)	# 6058	[c=13 l=5]  *adddi_1/0
+	jmp	*(%rdi,%rax,8)	# 18608	[c=10 l=3]  *indirect_jump
+.L615:
+	movzbl	10(%rbp), %eax	# 6067	[c=13 l=4]  zero_extendqidi2/0
+	movzwl	12(%rbp), %r14d	# 6066	[c=13 l=5]  *zero_extendhisi2/0
+	movl	$30, %edx	# 6072	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 6075	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC44(%rip), %rsi	# 6073	[c=1 l=7]  *movdi_internal/4
+	movl	%eax, 8(%rsp)	# 16303	[c=4 l=4]  *movsi_internal/1
+	movq	%rax, %r13	# 17687	[c=4 l=3]  *movdi_internal/3
+	movq	1040(%r12), %rax	# 6069	[c=9 l=8]  *movdi_internal/3
+	movzwl	30(%rax), %r15d	# 6070	[c=13 l=5]  *zero_extendhisi2/0
+	xorl	%eax, %eax	# 18607	[c=4 l=2]  *movdi_xor
+	movl	%r15d, %ecx	# 6071	[c=4 l=3]  *movsi_internal/0
+	call	log_append@PLT	# 6077	[c=0 l=5]  *call
+	leal	(%r14,%r15), %edx	# 17357	[c=4 l=4]  *leasi
+	movl	%edx, %eax	# 16304	[c=4 l=2]  *movsi_internal/0
+	subl	5176(%r12), %eax	# 6079	[c=13 l=8]  *subsi_1/1
+	cmpl	5180(%r12), %eax	# 6080	[c=13 l=8]  *cmpsi_1/1
+	jb	.L616	# 6081	[c=13 l=2]  *jcc
+	movl	%edx, %eax	# 16306	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %eax	# 6083	[c=4 l=3]  *ashrsi3_1/0
+	cltq	# 6084	[c=4 l=2]  *extendsidi2_rex64/0
+	cmpb	$0, 1080(%r12,%rax)	# 6085	[c=14 l=9]  *cmpqi_ccno_1/1
+	jne	.L617	# 6086	[c=13 l=6]  *jcc
+.L616:
+	movq	1040(%r12), %rcx	# 6090	[c=9 l=8]  *movdi_internal/3
+	movslq	%edx, %rax	# 6089	[c=4 l=3]  *extendsidi2_rex64/1
+	movzbl	(%rcx,%rax), %r14d	# 6091	[c=13 l=5]  *zero_extendqisi2/0
+.L618:
+	cmpl	$95, %edx	# 14378	[c=4 l=3]  *cmpsi_1/0
+	leaq	.LC29(%rip), %rax	# 15724	[c=1 l=7]  *movdi_internal/4
+	movl	%r14d, %ecx	# 6107	[c=4 l=3]  *movsi_internal/0
+	movq	%r12, %rdi	# 6110	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC28(%rip), %rsi	# 15723	[c=1 l=7]  *movdi_internal/4
+	cmovne	%rax, %rsi	# 14379	[c=8 l=4]  *movdicc_noc/1
+	call	log_add_data_mov@PLT	# 6111	[c=0 l=5]  *call
+	movzbl	%r13b, %edx	# 17257	[c=4 l=4]  *zero_extendqisi2/0
+	movzbl	%r14b, %ecx	# 6112	[c=4 l=4]  *zero_extendqisi2/0
+	movq	%r12, %rdi	# 6117	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC59(%rip), %rsi	# 6115	[c=1 l=7]  *movdi_internal/4
+	xorl	%eax, %eax	# 18606	[c=4 l=2]  *movdi_xor
+	call	log_append@PLT	# 6119	[c=0 l=5]  *call
+	movq	1040(%r12), %rax	# 6121	[c=9 l=8]  *movdi_internal/3
+	movq	%r12, %rdi	# 6124	[c=4 l=3]  *movdi_internal/3
+	movq	%rbp, %rsi	# 6123	[c=4 l=3]  *movdi_internal/3
+	movb	%r14b, (%rax,%r13)	# 6122	[c=4 l=4]  *movqi_internal/8
+	call	log_dump_line@PLT	# 6125	[c=0 l=5]  *call
+	movq	40(%r12), %rax	# 16308	[c=9 l=5]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 16309	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 6127	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 17356	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r12)	# 6128	[c=4 l=5]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 6130	[c=4 l=3]  *cmpdi_1/0
+	jb	.L297	# 6131	[c=13 l=6]  *jcc
+	movl	(%r12), %r8d	# 6133	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r12, %rdi	# 6138	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r8	# 6134	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r12), %r8	# 6136	[c=13 l=8]  *adddi_1/1
+	movq	%r8, %rbp	# 16311	[c=4 l=3]  *movdi_internal/3
+	movq	%r8, %rsi	# 6137	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 6139	[c=0 l=5]  *call
+	movzbl	9(%rbp), %eax	# 6140	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, (%r12)	# 6141	[c=9 l=4]  *addsi_1/0
+	leaq	handler.1(%rip), %rdi	# 16314	[c=1 l=7]  *movdi_internal/4
+	movzbl	8(%rbp), %eax	# 6144	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 16312	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 6145	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbx,%rdx), %rdx	# 6148	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r12)	# 6149	[c=13 l=5]  *adddi_1/0
+	jmp	*(%rdi,%rax,8)	# 18605	[c=10 l=3]  *indirect_jump
+.L620:
+	movzwl	12(%rbp), %edx	# 6157	[c=13 l=4]  zero_extendhidi2/0
+	movzbl	10(%rbp), %r14d	# 6159	[c=13 l=5]  *zero_extendqisi2/0
+	movl	%edx, %ecx	# 16315	[c=4 l=2]  *movsi_internal/0
+	movq	%rdx, %rax	# 17688	[c=4 l=3]  *movdi_internal/3
+	movl	%r14d, %r15d	# 17689	[c=4 l=3]  *movsi_internal/0
+	subl	5176(%r12), %ecx	# 6162	[c=13 l=8]  *subsi_1/1
+	cmpl	5180(%r12), %ecx	# 6163	[c=13 l=8]  *cmpsi_1/1
+	jb	.L621	# 6164	[c=13 l=2]  *jcc
+	movl	%edx, %ecx	# 16317	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %ecx	# 6166	[c=4 l=3]  *ashrsi3_1/0
+	movslq	%ecx, %rcx	# 6167	[c=4 l=3]  *extendsidi2_rex64/1
+	cmpb	$0, 1080(%r12,%rcx)	# 6168	[c=14 l=9]  *cmpqi_ccno_1/1
+	jne	.L622	# 6169	[c=13 l=6]  *jcc
+.L621:
+	movq	1040(%r12), %rcx	# 6173	[c=9 l=8]  *movdi_internal/3
+	movzbl	(%rcx,%rax), %r13d	# 6174	[c=13 l=5]  *zero_extendqisi2/0
+.L623:
+	cmpl	$95, %edx	# 14390	[c=4 l=3]  *cmpsi_1/0
+	leaq	.LC29(%rip), %rax	# 15726	[c=1 l=7]  *movdi_internal/4
+	movl	%r13d, %ecx	# 6190	[c=4 l=3]  *movsi_internal/0
+	movq	%r12, %rdi	# 6193	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC28(%rip), %rsi	# 15725	[c=1 l=7]  *movdi_internal/4
+	cmovne	%rax, %rsi	# 14391	[c=8 l=4]  *movdicc_noc/1
+	call	log_add_data_mov@PLT	# 6194	[c=0 l=5]  *call
+	movzbl	%r13b, %ecx	# 6195	[c=4 l=4]  *zero_extendqisi2/0
+	movl	%r14d, %edx	# 6197	[c=4 l=3]  *movsi_internal/0
+	movq	%r12, %rdi	# 6200	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC59(%rip), %rsi	# 6198	[c=1 l=7]  *movdi_internal/4
+	xorl	%eax, %eax	# 18604	[c=4 l=2]  *movdi_xor
+	call	log_append@PLT	# 6202	[c=0 l=5]  *call
+	movzbl	%r15b, %eax	# 6203	[c=4 l=4]  zero_extendqidi2/0
+	movq	%r12, %rdi	# 6207	[c=4 l=3]  *movdi_internal/3
+	movq	%rbp, %rsi	# 6206	[c=4 l=3]  *movdi_internal/3
+	movq	1040(%r12), %rdx	# 6204	[c=9 l=8]  *movdi_internal/3
+	movb	%r13b, (%rdx,%rax)	# 6205	[c=4 l=4]  *movqi_internal/8
+	call	log_dump_line@PLT	# 6208	[c=0 l=5]  *call
+	movq	40(%r12), %rax	# 16319	[c=9 l=5]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 16320	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 6210	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 17355	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r12)	# 6211	[c=4 l=5]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 6213	[c=4 l=3]  *cmpdi_1/0
+	jb	.L297	# 6214	[c=13 l=6]  *jcc
+	movl	(%r12), %r8d	# 6216	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r12, %rdi	# 6221	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r8	# 6217	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r12), %r8	# 6219	[c=13 l=8]  *adddi_1/1
+	movq	%r8, %rbp	# 16322	[c=4 l=3]  *movdi_internal/3
+	movq	%r8, %rsi	# 6220	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 6222	[c=0 l=5]  *call
+	movzbl	9(%rbp), %eax	# 6223	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, (%r12)	# 6224	[c=9 l=4]  *addsi_1/0
+	leaq	handler.1(%rip), %rdi	# 16325	[c=1 l=7]  *movdi_internal/4
+	movzbl	8(%rbp), %eax	# 6227	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 16323	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 6228	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbx,%rdx), %rdx	# 6231	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r12)	# 6232	[c=13 l=5]  *adddi_1/0
+	jmp	*(%rdi,%rax,8)	# 18603	[c=10 l=3]  *indirect_jump
+.L625:
+	movzwl	12(%rbp), %edx	# 6240	[c=13 l=4]  zero_extendhidi2/0
+	movzbl	10(%rbp), %r14d	# 6242	[c=13 l=5]  *zero_extendqisi2/0
+	movl	%edx, %ecx	# 16326	[c=4 l=2]  *movsi_internal/0
+	movq	%rdx, %rax	# 17690	[c=4 l=3]  *movdi_internal/3
+	movl	%r14d, %r15d	# 17691	[c=4 l=3]  *movsi_internal/0
+	subl	5176(%r12), %ecx	# 6245	[c=13 l=8]  *subsi_1/1
+	cmpl	5180(%r12), %ecx	# 6246	[c=13 l=8]  *cmpsi_1/1
+	jb	.L626	# 6247	[c=13 l=2]  *jcc
+	movl	%edx, %ecx	# 16328	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %ecx	# 6249	[c=4 l=3]  *ashrsi3_1/0
+	movslq	%ecx, %rcx	# 6250	[c=4 l=3]  *extendsidi2_rex64/1
+	cmpb	$0, 1080(%r12,%rcx)	# 6251	[c=14 l=9]  *cmpqi_ccno_1/1
+	jne	.L627	# 6252	[c=13 l=6]  *jcc
+.L626:
+	movq	1040(%r12), %rcx	# 6256	[c=9 l=8]  *movdi_internal/3
+	movzbl	(%rcx,%rax), %r13d	# 6257	[c=13 l=5]  *zero_extendqisi2/0
+.L628:
+	cmpl	$95, %edx	# 14402	[c=4 l=3]  *cmpsi_1/0
+	leaq	.LC29(%rip), %rax	# 15728	[c=1 l=7]  *movdi_internal/4
+	movl	%r13d, %ecx	# 6273	[c=4 l=3]  *movsi_internal/0
+	movq	%r12, %rdi	# 6276	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC28(%rip), %rsi	# 15727	[c=1 l=7]  *movdi_internal/4
+	cmovne	%rax, %rsi	# 14403	[c=8 l=4]  *movdicc_noc/1
+	call	log_add_data_mov@PLT	# 6277	[c=0 l=5]  *call
+	movzbl	%r13b, %ecx	# 6278	[c=4 l=4]  *zero_extendqisi2/0
+	movl	%r14d, %edx	# 6280	[c=4 l=3]  *movsi_internal/0
+	movq	%r12, %rdi	# 6283	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC59(%rip), %rsi	# 6281	[c=1 l=7]  *movdi_internal/4
+	xorl	%eax, %eax	# 18602	[c=4 l=2]  *movdi_xor
+	call	log_append@PLT	# 6285	[c=0 l=5]  *call
+	movzbl	%r15b, %eax	# 6286	[c=4 l=4]  zero_extendqidi2/0
+	movq	%r12, %rdi	# 6290	[c=4 l=3]  *movdi_internal/3
+	movq	%rbp, %rsi	# 6289	[c=4 l=3]  *movdi_internal/3
+	movq	1040(%r12), %rdx	# 6287	[c=9 l=8]  *movdi_internal/3
+	movb	%r13b, (%rdx,%rax)	# 6288	[c=4 l=4]  *movqi_internal/8
+	call	log_dump_line@PLT	# 6291	[c=0 l=5]  *call
+	movq	40(%r12), %rax	# 16330	[c=9 l=5]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 16331	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 6293	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 17354	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r12)	# 6294	[c=4 l=5]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 6296	[c=4 l=3]  *cmpdi_1/0
+	jb	.L297	# 6297	[c=13 l=6]  *jcc
+	movl	(%r12), %r8d	# 6299	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r12, %rdi	# 6304	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r8	# 6300	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r12), %r8	# 6302	[c=13 l=8]  *adddi_1/1
+	movq	%r8, %rbp	# 16333	[c=4 l=3]  *movdi_internal/3
+	movq	%r8, %rsi	# 6303	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 6305	[c=0 l=5]  *call
+	movzbl	9(%rbp), %eax	# 6306	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, (%r12)	# 6307	[c=9 l=4]  *addsi_1/0
+	leaq	handler.1(%rip), %rdi	# 16336	[c=1 l=7]  *movdi_internal/4
+	movzbl	8(%rbp), %eax	# 6310	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 16334	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 6311	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbx,%rdx), %rdx	# 6314	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r12)	# 6315	[c=13 l=5]  *adddi_1/0
+	jmp	*(%rdi,%rax,8)	# 18601	[c=10 l=3]  *indirect_jump
+.L630:
+	movzbl	10(%rbp), %eax	# 6323	[c=13 l=4]  zero_extendqidi2/0
+	movl	$26, %edx	# 6329	[c=4 l=5]  *movsi_internal/0
+	leaq	.LC44(%rip), %rsi	# 6330	[c=1 l=7]  *movdi_internal/4
+	movq	%r12, %rdi	# 6332	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, 8(%rsp)	# 16337	[c=4 l=4]  *movsi_internal/1
+	movq	%rax, %r13	# 17692	[c=4 l=3]  *movdi_internal/3
+	movq	1040(%r12), %rax	# 6325	[c=9 l=8]  *movdi_internal/3
+	movzwl	26(%rax), %r15d	# 6326	[c=13 l=5]  *zero_extendhisi2/0
+	xorl	%eax, %eax	# 18600	[c=4 l=2]  *movdi_xor
+	movl	%r15d, %ecx	# 6328	[c=4 l=3]  *movsi_internal/0
+	movl	%r15d, %r14d	# 17693	[c=4 l=3]  *movsi_internal/0
+	call	log_append@PLT	# 6334	[c=0 l=5]  *call
+	movl	%r15d, %eax	# 16338	[c=4 l=3]  *movsi_internal/0
+	subl	5176(%r12), %eax	# 6336	[c=13 l=8]  *subsi_1/1
+	cmpl	5180(%r12), %eax	# 6337	[c=13 l=8]  *cmpsi_1/1
+	jb	.L631	# 6338	[c=13 l=2]  *jcc
+	movl	%r15d, %eax	# 16340	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %eax	# 6340	[c=4 l=3]  *ashrsi3_1/0
+	cltq	# 6341	[c=4 l=2]  *extendsidi2_rex64/0
+	cmpb	$0, 1080(%r12,%rax)	# 6342	[c=14 l=9]  *cmpqi_ccno_1/1
+	jne	.L632	# 6343	[c=13 l=6]  *jcc
+.L631:
+	movq	1040(%r12), %rdx	# 6347	[c=9 l=8]  *movdi_internal/3
+	movzwl	%r14w, %eax	# 6346	[c=4 l=4]  zero_extendhidi2/0
+	movzbl	(%rdx,%rax), %r14d	# 6348	[c=13 l=5]  *zero_extendqisi2/0
+.L633:
+	cmpl	$95, %r15d	# 14414	[c=4 l=4]  *cmpsi_1/0
+	movl	%r14d, %ecx	# 6364	[c=4 l=3]  *movsi_internal/0
+	movl	%r15d, %edx	# 6365	[c=4 l=3]  *movsi_internal/0
+	movq	%r12, %rdi	# 6367	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC29(%rip), %rax	# 15730	[c=1 l=7]  *movdi_internal/4
+	leaq	.LC28(%rip), %rsi	# 15729	[c=1 l=7]  *movdi_internal/4
+	cmovne	%rax, %rsi	# 14415	[c=8 l=4]  *movdicc_noc/1
+	call	log_add_data_mov@PLT	# 6368	[c=0 l=5]  *call
+	movzbl	%r13b, %edx	# 17258	[c=4 l=4]  *zero_extendqisi2/0
+	movzbl	%r14b, %ecx	# 6369	[c=4 l=4]  *zero_extendqisi2/0
+	movq	%r12, %rdi	# 6374	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC59(%rip), %rsi	# 6372	[c=1 l=7]  *movdi_internal/4
+	xorl	%eax, %eax	# 18599	[c=4 l=2]  *movdi_xor
+	call	log_append@PLT	# 6376	[c=0 l=5]  *call
+	movq	1040(%r12), %rax	# 6378	[c=9 l=8]  *movdi_internal/3
+	movq	%r12, %rdi	# 6381	[c=4 l=3]  *movdi_internal/3
+	movq	%rbp, %rsi	# 6380	[c=4 l=3]  *movdi_internal/3
+	movb	%r14b, (%rax,%r13)	# 6379	[c=4 l=4]  *movqi_internal/8
+	call	log_dump_line@PLT	# 6382	[c=0 l=5]  *call
+	movq	40(%r12), %rax	# 16342	[c=9 l=5]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 16343	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 6384	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 17353	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r12)	# 6385	[c=4 l=5]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 6387	[c=4 l=3]  *cmpdi_1/0
+	jb	.L297	# 6388	[c=13 l=6]  *jcc
+	movl	(%r12), %r8d	# 6390	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r12, %rdi	# 6395	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r8	# 6391	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r12), %r8	# 6393	[c=13 l=8]  *adddi_1/1
+	movq	%r8, %rbp	# 16345	[c=4 l=3]  *movdi_internal/3
+	movq	%r8, %rsi	# 6394	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 6396	[c=0 l=5]  *call
+	movzbl	9(%rbp), %eax	# 6397	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, (%r12)	# 6398	[c=9 l=4]  *addsi_1/0
+	leaq	handler.1(%rip), %rdi	# 16348	[c=1 l=7]  *movdi_internal/4
+	movzbl	8(%rbp), %eax	# 6401	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 16346	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 6402	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbx,%rdx), %rdx	# 6405	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r12)	# 6406	[c=13 l=5]  *adddi_1/0
+	jmp	*(%rdi,%rax,8)	# 18598	[c=10 l=3]  *indirect_jump
+.L635:
+	movzbl	10(%rbp), %eax	# 6414	[c=13 l=4]  zero_extendqidi2/0
+	movl	$26, %edx	# 6419	[c=4 l=5]  *movsi_internal/0
+	leaq	.LC44(%rip), %rsi	# 6420	[c=1 l=7]  *movdi_internal/4
+	movq	%r12, %rdi	# 6422	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, 8(%rsp)	# 16349	[c=4 l=4]  *movsi_internal/1
+	movq	%rax, %r13	# 17694	[c=4 l=3]  *movdi_internal/3
+	movq	1040(%r12), %rax	# 6416	[c=9 l=8]  *movdi_internal/3
+	movzwl	26(%rax), %r15d	# 6417	[c=13 l=5]  *zero_extendhisi2/0
+	xorl	%eax, %eax	# 18597	[c=4 l=2]  *movdi_xor
+	movl	%r15d, %ecx	# 6418	[c=4 l=3]  *movsi_internal/0
+	subl	$1, %r15d	# 6425	[c=4 l=4]  *addsi_1/0
+	call	log_append@PLT	# 6424	[c=0 l=5]  *call
+	movl	%r15d, %eax	# 16350	[c=4 l=3]  *movsi_internal/0
+	subl	5176(%r12), %eax	# 6426	[c=13 l=8]  *subsi_1/1
+	cmpl	5180(%r12), %eax	# 6427	[c=13 l=8]  *cmpsi_1/1
+	jb	.L636	# 6428	[c=13 l=2]  *jcc
+	movl	%r15d, %eax	# 16352	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %eax	# 6430	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 15661	[c=5 l=5]  *andsi_1_zext
+	cmpb	$0, 1080(%r12,%rax)	# 6433	[c=14 l=9]  *cmpqi_ccno_1/1
+	jne	.L637	# 6434	[c=13 l=6]  *jcc
+.L636:
+	movq	1040(%r12), %rdx	# 6438	[c=9 l=8]  *movdi_internal/3
+	movslq	%r15d, %rax	# 6437	[c=4 l=3]  *extendsidi2_rex64/1
+	movzbl	(%rdx,%rax), %r14d	# 6439	[c=13 l=5]  *zero_extendqisi2/0
+.L638:
+	cmpl	$95, %r15d	# 14426	[c=4 l=4]  *cmpsi_1/0
+	movl	%r14d, %ecx	# 6455	[c=4 l=3]  *movsi_internal/0
+	movl	%r15d, %edx	# 6456	[c=4 l=3]  *movsi_internal/0
+	movq	%r12, %rdi	# 6458	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC29(%rip), %rax	# 15732	[c=1 l=7]  *movdi_internal/4
+	leaq	.LC28(%rip), %rsi	# 15731	[c=1 l=7]  *movdi_internal/4
+	cmovne	%rax, %rsi	# 14427	[c=8 l=4]  *movdicc_noc/1
+	call	log_add_data_mov@PLT	# 6459	[c=0 l=5]  *call
+	movzbl	%r14b, %ecx	# 6460	[c=4 l=4]  *zero_extendqisi2/0
+	movzbl	%r13b, %edx	# 17259	[c=4 l=4]  *zero_extendqisi2/0
+	movq	%r12, %rdi	# 6465	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC59(%rip), %rsi	# 6463	[c=1 l=7]  *movdi_internal/4
+	xorl	%eax, %eax	# 18594	[c=4 l=2]  *movdi_xor
+	call	log_append@PLT	# 6467	[c=0 l=5]  *call
+	movq	1040(%r12), %rax	# 6469	[c=9 l=8]  *movdi_internal/3
+	movzwl	%r15w, %ecx	# 6471	[c=4 l=4]  *zero_extendhisi2/0
+	movl	$26, %edx	# 6473	[c=4 l=5]  *movsi_internal/0
+	leaq	.LC48(%rip), %rsi	# 6474	[c=1 l=7]  *movdi_internal/4
+	movq	%r12, %rdi	# 6476	[c=4 l=3]  *movdi_internal/3
+	movb	%r14b, (%rax,%r13)	# 6470	[c=4 l=4]  *movqi_internal/8
+	xorl	%eax, %eax	# 18595	[c=4 l=2]  *movdi_xor
+	call	log_append@PLT	# 6478	[c=0 l=5]  *call
+	movl	%r15d, %ecx	# 16355	[c=4 l=3]  *movsi_internal/0
+	movq	%r12, %rdi	# 6485	[c=4 l=3]  *movdi_internal/3
+	movq	%rbp, %rsi	# 6484	[c=4 l=3]  *movdi_internal/3
+	movq	1040(%r12), %rax	# 6479	[c=9 l=8]  *movdi_internal/3
+	movb	%r15b, 26(%rax)	# 6480	[c=4 l=4]  *movqi_internal/8
+	movq	1040(%r12), %rax	# 6481	[c=9 l=8]  *movdi_internal/3
+	movb	%ch, 27(%rax)	# 18596	[c=4 l=3]  *extzvqi_mem_rex64
+	call	log_dump_line@PLT	# 6486	[c=0 l=5]  *call
+	movq	40(%r12), %rax	# 16356	[c=9 l=5]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 16357	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 6488	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 17352	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r12)	# 6489	[c=4 l=5]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 6491	[c=4 l=3]  *cmpdi_1/0
+	jb	.L297	# 6492	[c=13 l=6]  *jcc
+	movl	(%r12), %r8d	# 6494	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r12, %rdi	# 6499	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r8	# 6495	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r12), %r8	# 6497	[c=13 l=8]  *adddi_1/1
+	movq	%r8, %rbp	# 16359	[c=4 l=3]  *movdi_internal/3
+	movq	%r8, %rsi	# 6498	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 6500	[c=0 l=5]  *call
+	movzbl	9(%rbp), %eax	# 6501	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, (%r12)	# 6502	[c=9 l=4]  *addsi_1/0
+	leaq	handler.1(%rip), %rdi	# 16362	[c=1 l=7]  *movdi_internal/4
+	movzbl	8(%rbp), %eax	# 6505	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 16360	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 6506	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbx,%rdx), %rdx	# 6509	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r12)	# 6510	[c=13 l=5]  *adddi_1/0
+	jmp	*(%rdi,%rax,8)	# 18593	[c=10 l=3]  *indirect_jump
+.L640:
+	movzbl	10(%rbp), %eax	# 6518	[c=13 l=4]  zero_extendqidi2/0
+	movl	$26, %edx	# 6524	[c=4 l=5]  *movsi_internal/0
+	leaq	.LC44(%rip), %rsi	# 6525	[c=1 l=7]  *movdi_internal/4
+	movq	%r12, %rdi	# 6527	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, 8(%rsp)	# 16363	[c=4 l=4]  *movsi_internal/1
+	movq	%rax, %r13	# 17695	[c=4 l=3]  *movdi_internal/3
+	movq	1040(%r12), %rax	# 6520	[c=9 l=8]  *movdi_internal/3
+	movzwl	26(%rax), %r15d	# 6521	[c=13 l=5]  *zero_extendhisi2/0
+	xorl	%eax, %eax	# 18592	[c=4 l=2]  *movdi_xor
+	movl	%r15d, %ecx	# 6523	[c=4 l=3]  *movsi_internal/0
+	movl	%r15d, %r14d	# 17696	[c=4 l=3]  *movsi_internal/0
+	call	log_append@PLT	# 6529	[c=0 l=5]  *call
+	movl	%r15d, %eax	# 16364	[c=4 l=3]  *movsi_internal/0
+	subl	5176(%r12), %eax	# 6531	[c=13 l=8]  *subsi_1/1
+	cmpl	5180(%r12), %eax	# 6532	[c=13 l=8]  *cmpsi_1/1
+	jb	.L641	# 6533	[c=13 l=2]  *jcc
+	movl	%r15d, %eax	# 16366	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %eax	# 6535	[c=4 l=3]  *ashrsi3_1/0
+	cltq	# 6536	[c=4 l=2]  *extendsidi2_rex64/0
+	cmpb	$0, 1080(%r12,%rax)	# 6537	[c=14 l=9]  *cmpqi_ccno_1/1
+	jne	.L642	# 6538	[c=13 l=6]  *jcc
+.L641:
+	movq	1040(%r12), %rdx	# 6542	[c=9 l=8]  *movdi_internal/3
+	movzwl	%r14w, %eax	# 6541	[c=4 l=4]  zero_extendhidi2/0
+	movzbl	(%rdx,%rax), %r14d	# 6543	[c=13 l=5]  *zero_extendqisi2/0
+.L643:
+	cmpl	$95, %r15d	# 14438	[c=4 l=4]  *cmpsi_1/0
+	movl	%r14d, %ecx	# 6559	[c=4 l=3]  *movsi_internal/0
+	movl	%r15d, %edx	# 6560	[c=4 l=3]  *movsi_internal/0
+	movq	%r12, %rdi	# 6562	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC29(%rip), %rax	# 15734	[c=1 l=7]  *movdi_internal/4
+	leaq	.LC28(%rip), %rsi	# 15733	[c=1 l=7]  *movdi_internal/4
+	cmovne	%rax, %rsi	# 14439	[c=8 l=4]  *movdicc_noc/1
+	call	log_add_data_mov@PLT	# 6563	[c=0 l=5]  *call
+	movzbl	%r13b, %edx	# 17260	[c=4 l=4]  *zero_extendqisi2/0
+	movzbl	%r14b, %ecx	# 6564	[c=4 l=4]  *zero_extendqisi2/0
+	movq	%r12, %rdi	# 6569	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC59(%rip), %rsi	# 6567	[c=1 l=7]  *movdi_internal/4
+	xorl	%eax, %eax	# 18589	[c=4 l=2]  *movdi_xor
+	call	log_append@PLT	# 6571	[c=0 l=5]  *call
+	movq	1040(%r12), %rax	# 6573	[c=9 l=8]  *movdi_internal/3
+	movl	$26, %edx	# 6578	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 6581	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC48(%rip), %rsi	# 6579	[c=1 l=7]  *movdi_internal/4
+	movb	%r14b, (%rax,%r13)	# 6574	[c=4 l=4]  *movqi_internal/8
+	leal	1(%r15), %r13d	# 17350	[c=4 l=4]  *leasi
+	xorl	%eax, %eax	# 18590	[c=4 l=2]  *movdi_xor
+	movzwl	%r13w, %ecx	# 6576	[c=4 l=4]  *zero_extendhisi2/0
+	call	log_append@PLT	# 6583	[c=0 l=5]  *call
+	movl	%r13d, %ecx	# 16369	[c=4 l=3]  *movsi_internal/0
+	movq	%r12, %rdi	# 6590	[c=4 l=3]  *movdi_internal/3
+	movq	%rbp, %rsi	# 6589	[c=4 l=3]  *movdi_internal/3
+	movq	1040(%r12), %rax	# 6584	[c=9 l=8]  *movdi_internal/3
+	movb	%r13b, 26(%rax)	# 6585	[c=4 l=4]  *movqi_internal/8
+	movq	1040(%r12), %rax	# 6586	[c=9 l=8]  *movdi_internal/3
+	movb	%ch, 27(%rax)	# 18591	[c=4 l=3]  *extzvqi_mem_rex64
+	call	log_dump_line@PLT	# 6591	[c=0 l=5]  *call
+	movq	40(%r12), %rax	# 16370	[c=9 l=5]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 16371	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 6593	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 17351	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r12)	# 6594	[c=4 l=5]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 6596	[c=4 l=3]  *cmpdi_1/0
+	jb	.L297	# 6597	[c=13 l=6]  *jcc
+	movl	(%r12), %r8d	# 6599	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r12, %rdi	# 6604	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r8	# 6600	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r12), %r8	# 6602	[c=13 l=8]  *adddi_1/1
+	movq	%r8, %rbp	# 16373	[c=4 l=3]  *movdi_internal/3
+	movq	%r8, %rsi	# 6603	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 6605	[c=0 l=5]  *call
+	movzbl	9(%rbp), %eax	# 6606	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, (%r12)	# 6607	[c=9 l=4]  *addsi_1/0
+	leaq	handler.1(%rip), %rdi	# 16376	[c=1 l=7]  *movdi_internal/4
+	movzbl	8(%rbp), %eax	# 6610	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 16374	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 6611	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbx,%rdx), %rdx	# 6614	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r12)	# 6615	[c=13 l=5]  *adddi_1/0
+	jmp	*(%rdi,%rax,8)	# 18588	[c=10 l=3]  *indirect_jump
+.L645:
+	movzbl	10(%rbp), %eax	# 6623	[c=13 l=4]  zero_extendqidi2/0
+	movl	$28, %edx	# 6628	[c=4 l=5]  *movsi_internal/0
+	leaq	.LC44(%rip), %rsi	# 6629	[c=1 l=7]  *movdi_internal/4
+	movq	%r12, %rdi	# 6631	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, 8(%rsp)	# 16377	[c=4 l=4]  *movsi_internal/1
+	movq	%rax, %r13	# 17697	[c=4 l=3]  *movdi_internal/3
+	movq	1040(%r12), %rax	# 6625	[c=9 l=8]  *movdi_internal/3
+	movzwl	28(%rax), %r15d	# 6626	[c=13 l=5]  *zero_extendhisi2/0
+	xorl	%eax, %eax	# 18587	[c=4 l=2]  *movdi_xor
+	movl	%r15d, %ecx	# 6627	[c=4 l=3]  *movsi_internal/0
+	subl	$1, %r15d	# 6634	[c=4 l=4]  *addsi_1/0
+	call	log_append@PLT	# 6633	[c=0 l=5]  *call
+	movl	%r15d, %eax	# 16378	[c=4 l=3]  *movsi_internal/0
+	subl	5176(%r12), %eax	# 6635	[c=13 l=8]  *subsi_1/1
+	cmpl	5180(%r12), %eax	# 6636	[c=13 l=8]  *cmpsi_1/1
+	jb	.L646	# 6637	[c=13 l=2]  *jcc
+	movl	%r15d, %eax	# 16380	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %eax	# 6639	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 15660	[c=5 l=5]  *andsi_1_zext
+	cmpb	$0, 1080(%r12,%rax)	# 6642	[c=14 l=9]  *cmpqi_ccno_1/1
+	jne	.L647	# 6643	[c=13 l=6]  *jcc
+.L646:
+	movq	1040(%r12), %rdx	# 6647	[c=9 l=8]  *movdi_internal/3
+	movslq	%r15d, %rax	# 6646	[c=4 l=3]  *extendsidi2_rex64/1
+	movzbl	(%rdx,%rax), %r14d	# 6648	[c=13 l=5]  *zero_extendqisi2/0
+.L648:
+	cmpl	$95, %r15d	# 14450	[c=4 l=4]  *cmpsi_1/0
+	movl	%r14d, %ecx	# 6664	[c=4 l=3]  *movsi_internal/0
+	movl	%r15d, %edx	# 6665	[c=4 l=3]  *movsi_internal/0
+	movq	%r12, %rdi	# 6667	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC29(%rip), %rax	# 15736	[c=1 l=7]  *movdi_internal/4
+	leaq	.LC28(%rip), %rsi	# 15735	[c=1 l=7]  *movdi_internal/4
+	cmovne	%rax, %rsi	# 14451	[c=8 l=4]  *movdicc_noc/1
+	call	log_add_data_mov@PLT	# 6668	[c=0 l=5]  *call
+	movzbl	%r14b, %ecx	# 6669	[c=4 l=4]  *zero_extendqisi2/0
+	movzbl	%r13b, %edx	# 17261	[c=4 l=4]  *zero_extendqisi2/0
+	movq	%r12, %rdi	# 6674	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC59(%rip), %rsi	# 6672	[c=1 l=7]  *movdi_internal/4
+	xorl	%eax, %eax	# 18584	[c=4 l=2]  *movdi_xor
+	call	log_append@PLT	# 6676	[c=0 l=5]  *call
+	movq	1040(%r12), %rax	# 6678	[c=9 l=8]  *movdi_internal/3
+	movzwl	%r15w, %ecx	# 6680	[c=4 l=4]  *zero_extendhisi2/0
+	movl	$28, %edx	# 6682	[c=4 l=5]  *movsi_internal/0
+	leaq	.LC48(%rip), %rsi	# 6683	[c=1 l=7]  *movdi_internal/4
+	movq	%r12, %rdi	# 6685	[c=4 l=3]  *movdi_internal/3
+	movb	%r14b, (%rax,%r13)	# 6679	[c=4 l=4]  *movqi_internal/8
+	xorl	%eax, %eax	# 18585	[c=4 l=2]  *movdi_xor
+	call	log_append@PLT	# 6687	[c=0 l=5]  *call
+	movl	%r15d, %ecx	# 16383	[c=4 l=3]  *movsi_internal/0
+	movq	%r12, %rdi	# 6694	[c=4 l=3]  *movdi_internal/3
+	movq	%rbp, %rsi	# 6693	[c=4 l=3]  *movdi_internal/3
+	movq	1040(%r12), %rax	# 6688	[c=9 l=8]  *movdi_internal/3
+	movb	%r15b, 28(%rax)	# 6689	[c=4 l=4]  *movqi_internal/8
+	movq	1040(%r12), %rax	# 6690	[c=9 l=8]  *movdi_internal/3
+	movb	%ch, 29(%rax)	# 18586	[c=4 l=3]  *extzvqi_mem_rex64
+	call	log_dump_line@PLT	# 6695	[c=0 l=5]  *call
+	movq	40(%r12), %rax	# 16384	[c=9 l=5]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 16385	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 6697	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 17349	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r12)	# 6698	[c=4 l=5]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 6700	[c=4 l=3]  *cmpdi_1/0
+	jb	.L297	# 6701	[c=13 l=6]  *jcc
+	movl	(%r12), %r8d	# 6703	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r12, %rdi	# 6708	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r8	# 6704	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r12), %r8	# 6706	[c=13 l=8]  *adddi_1/1
+	movq	%r8, %rbp	# 16387	[c=4 l=3]  *movdi_internal/3
+	movq	%r8, %rsi	# 6707	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 6709	[c=0 l=5]  *call
+	movzbl	9(%rbp), %eax	# 6710	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, (%r12)	# 6711	[c=9 l=4]  *addsi_1/0
+	leaq	handler.1(%rip), %rdi	# 16390	[c=1 l=7]  *movdi_internal/4
+	movzbl	8(%rbp), %eax	# 6714	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 16388	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 6715	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbx,%rdx), %rdx	# 6718	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r12)	# 6719	[c=13 l=5]  *adddi_1/0
+	jmp	*(%rdi,%rax,8)	# 18583	[c=10 l=3]  *indirect_jump
+.L650:
+	movzbl	10(%rbp), %eax	# 6727	[c=13 l=4]  zero_extendqidi2/0
+	movl	$28, %edx	# 6733	[c=4 l=5]  *movsi_internal/0
+	leaq	.LC44(%rip), %rsi	# 6734	[c=1 l=7]  *movdi_internal/4
+	movq	%r12, %rdi	# 6736	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, 8(%rsp)	# 16391	[c=4 l=4]  *movsi_internal/1
+	movq	%rax, %r13	# 17698	[c=4 l=3]  *movdi_internal/3
+	movq	1040(%r12), %rax	# 6729	[c=9 l=8]  *movdi_internal/3
+	movzwl	28(%rax), %r15d	# 6730	[c=13 l=5]  *zero_extendhisi2/0
+	xorl	%eax, %eax	# 18582	[c=4 l=2]  *movdi_xor
+	movl	%r15d, %ecx	# 6732	[c=4 l=3]  *movsi_internal/0
+	movl	%r15d, %r14d	# 17699	[c=4 l=3]  *movsi_internal/0
+	call	log_append@PLT	# 6738	[c=0 l=5]  *call
+	movl	%r15d, %eax	# 16392	[c=4 l=3]  *movsi_internal/0
+	subl	5176(%r12), %eax	# 6740	[c=13 l=8]  *subsi_1/1
+	cmpl	5180(%r12), %eax	# 6741	[c=13 l=8]  *cmpsi_1/1
+	jb	.L651	# 6742	[c=13 l=2]  *jcc
+	movl	%r15d, %eax	# 16394	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %eax	# 6744	[c=4 l=3]  *ashrsi3_1/0
+	cltq	# 6745	[c=4 l=2]  *extendsidi2_rex64/0
+	cmpb	$0, 1080(%r12,%rax)	# 6746	[c=14 l=9]  *cmpqi_ccno_1/1
+	jne	.L652	# 6747	[c=13 l=6]  *jcc
+.L651:
+	movq	1040(%r12), %rdx	# 6751	[c=9 l=8]  *movdi_internal/3
+	movzwl	%r14w, %eax	# 6750	[c=4 l=4]  zero_extendhidi2/0
+	movzbl	(%rdx,%rax), %r14d	# 6752	[c=13 l=5]  *zero_extendqisi2/0
+.L653:
+	cmpl	$95, %r15d	# 14462	[c=4 l=4]  *cmpsi_1/0
+	movl	%r14d, %ecx	# 6768	[c=4 l=3]  *movsi_internal/0
+	movl	%r15d, %edx	# 6769	[c=4 l=3]  *movsi_internal/0
+	movq	%r12, %rdi	# 6771	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC29(%rip), %rax	# 15738	[c=1 l=7]  *movdi_internal/4
+	leaq	.LC28(%rip), %rsi	# 15737	[c=1 l=7]  *movdi_internal/4
+	cmovne	%rax, %rsi	# 14463	[c=8 l=4]  *movdicc_noc/1
+	call	log_add_data_mov@PLT	# 6772	[c=0 l=5]  *call
+	movzbl	%r13b, %edx	# 17262	[c=4 l=4]  *zero_extendqisi2/0
+	movzbl	%r14b, %ecx	# 6773	[c=4 l=4]  *zero_extendqisi2/0
+	movq	%r12, %rdi	# 6778	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC59(%rip), %rsi	# 6776	[c=1 l=7]  *movdi_internal/4
+	xorl	%eax, %eax	# 18579	[c=4 l=2]  *movdi_xor
+	call	log_append@PLT	# 6780	[c=0 l=5]  *call
+	movq	1040(%r12), %rax	# 6782	[c=9 l=8]  *movdi_internal/3
+	movl	$28, %edx	# 6787	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 6790	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC48(%rip), %rsi	# 6788	[c=1 l=7]  *movdi_internal/4
+	movb	%r14b, (%rax,%r13)	# 6783	[c=4 l=4]  *movqi_internal/8
+	leal	1(%r15), %r13d	# 17347	[c=4 l=4]  *leasi
+	xorl	%eax, %eax	# 18580	[c=4 l=2]  *movdi_xor
+	movzwl	%r13w, %ecx	# 6785	[c=4 l=4]  *zero_extendhisi2/0
+	call	log_append@PLT	# 6792	[c=0 l=5]  *call
+	movl	%r13d, %ecx	# 16397	[c=4 l=3]  *movsi_internal/0
+	movq	%r12, %rdi	# 6799	[c=4 l=3]  *movdi_internal/3
+	movq	%rbp, %rsi	# 6798	[c=4 l=3]  *movdi_internal/3
+	movq	1040(%r12), %rax	# 6793	[c=9 l=8]  *movdi_internal/3
+	movb	%r13b, 28(%rax)	# 6794	[c=4 l=4]  *movqi_internal/8
+	movq	1040(%r12), %rax	# 6795	[c=9 l=8]  *movdi_internal/3
+	movb	%ch, 29(%rax)	# 18581	[c=4 l=3]  *extzvqi_mem_rex64
+	call	log_dump_line@PLT	# 6800	[c=0 l=5]  *call
+	movq	40(%r12), %rax	# 16398	[c=9 l=5]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 16399	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 6802	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 17348	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r12)	# 6803	[c=4 l=5]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 6805	[c=4 l=3]  *cmpdi_1/0
+	jb	.L297	# 6806	[c=13 l=6]  *jcc
+	movl	(%r12), %r8d	# 6808	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r12, %rdi	# 6813	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r8	# 6809	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r12), %r8	# 6811	[c=13 l=8]  *adddi_1/1
+	movq	%r8, %rbp	# 16401	[c=4 l=3]  *movdi_internal/3
+	movq	%r8, %rsi	# 6812	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 6814	[c=0 l=5]  *call
+	movzbl	9(%rbp), %eax	# 6815	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, (%r12)	# 6816	[c=9 l=4]  *addsi_1/0
+	leaq	handler.1(%rip), %rdi	# 16404	[c=1 l=7]  *movdi_internal/4
+	movzbl	8(%rbp), %eax	# 6819	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 16402	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 6820	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbx,%rdx), %rdx	# 6823	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r12)	# 6824	[c=13 l=5]  *adddi_1/0
+	jmp	*(%rdi,%rax,8)	# 18578	[c=10 l=3]  *indirect_jump
+.L655:
+	movzbl	10(%rbp), %eax	# 6832	[c=13 l=4]  zero_extendqidi2/0
+	movl	$30, %edx	# 6837	[c=4 l=5]  *movsi_internal/0
+	leaq	.LC44(%rip), %rsi	# 6838	[c=1 l=7]  *movdi_internal/4
+	movq	%r12, %rdi	# 6840	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, 8(%rsp)	# 16405	[c=4 l=4]  *movsi_internal/1
+	movq	%rax, %r13	# 17700	[c=4 l=3]  *movdi_internal/3
+	movq	1040(%r12), %rax	# 6834	[c=9 l=8]  *movdi_internal/3
+	movzwl	30(%rax), %r15d	# 6835	[c=13 l=5]  *zero_extendhisi2/0
+	xorl	%eax, %eax	# 18577	[c=4 l=2]  *movdi_xor
+	movl	%r15d, %ecx	# 6836	[c=4 l=3]  *movsi_internal/0
+	subl	$1, %r15d	# 6843	[c=4 l=4]  *addsi_1/0
+	call	log_append@PLT	# 6842	[c=0 l=5]  *call
+	movl	%r15d, %eax	# 16406	[c=4 l=3]  *movsi_internal/0
+	subl	5176(%r12), %eax	# 6844	[c=13 l=8]  *subsi_1/1
+	cmpl	5180(%r12), %eax	# 6845	[c=13 l=8]  *cmpsi_1/1
+	jb	.L656	# 6846	[c=13 l=2]  *jcc
+	movl	%r15d, %eax	# 16408	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %eax	# 6848	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 15659	[c=5 l=5]  *andsi_1_zext
+	cmpb	$0, 1080(%r12,%rax)	# 6851	[c=14 l=9]  *cmpqi_ccno_1/1
+	jne	.L657	# 6852	[c=13 l=6]  *jcc
+.L656:
+	movq	1040(%r12), %rdx	# 6856	[c=9 l=8]  *movdi_internal/3
+	movslq	%r15d, %rax	# 6855	[c=4 l=3]  *extendsidi2_rex64/1
+	movzbl	(%rdx,%rax), %r14d	# 6857	[c=13 l=5]  *zero_extendqisi2/0
+.L658:
+	cmpl	$95, %r15d	# 14474	[c=4 l=4]  *cmpsi_1/0
+	movl	%r14d, %ecx	# 6873	[c=4 l=3]  *movsi_internal/0
+	movl	%r15d, %edx	# 6874	[c=4 l=3]  *movsi_internal/0
+	movq	%r12, %rdi	# 6876	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC29(%rip), %rax	# 15740	[c=1 l=7]  *movdi_internal/4
+	leaq	.LC28(%rip), %rsi	# 15739	[c=1 l=7]  *movdi_internal/4
+	cmovne	%rax, %rsi	# 14475	[c=8 l=4]  *movdicc_noc/1
+	call	log_add_data_mov@PLT	# 6877	[c=0 l=5]  *call
+	movzbl	%r14b, %ecx	# 6878	[c=4 l=4]  *zero_extendqisi2/0
+	movzbl	%r13b, %edx	# 17263	[c=4 l=4]  *zero_extendqisi2/0
+	movq	%r12, %rdi	# 6883	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC59(%rip), %rsi	# 6881	[c=1 l=7]  *movdi_internal/4
+	xorl	%eax, %eax	# 18574	[c=4 l=2]  *movdi_xor
+	call	log_append@PLT	# 6885	[c=0 l=5]  *call
+	movq	1040(%r12), %rax	# 6887	[c=9 l=8]  *movdi_internal/3
+	movzwl	%r15w, %ecx	# 6889	[c=4 l=4]  *zero_extendhisi2/0
+	movl	$30, %edx	# 6891	[c=4 l=5]  *movsi_internal/0
+	leaq	.LC48(%rip), %rsi	# 6892	[c=1 l=7]  *movdi_internal/4
+	movq	%r12, %rdi	# 6894	[c=4 l=3]  *movdi_internal/3
+	movb	%r14b, (%rax,%r13)	# 6888	[c=4 l=4]  *movqi_internal/8
+	xorl	%eax, %eax	# 18575	[c=4 l=2]  *movdi_xor
+	call	log_append@PLT	# 6896	[c=0 l=5]  *call
+	movl	%r15d, %ecx	# 16411	[c=4 l=3]  *movsi_internal/0
+	movq	%r12, %rdi	# 6903	[c=4 l=3]  *movdi_internal/3
+	movq	%rbp, %rsi	# 6902	[c=4 l=3]  *movdi_internal/3
+	movq	1040(%r12), %rax	# 6897	[c=9 l=8]  *movdi_internal/3
+	movb	%r15b, 30(%rax)	# 6898	[c=4 l=4]  *movqi_internal/8
+	movq	1040(%r12), %rax	# 6899	[c=9 l=8]  *movdi_internal/3
+	movb	%ch, 31(%rax)	# 18576	[c=4 l=3]  *extzvqi_mem_rex64
+	call	log_dump_line@PLT	# 6904	[c=0 l=5]  *call
+	movq	40(%r12), %rax	# 16412	[c=9 l=5]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 16413	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 6906	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 17346	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r12)	# 6907	[c=4 l=5]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 6909	[c=4 l=3]  *cmpdi_1/0
+	jb	.L297	# 6910	[c=13 l=6]  *jcc
+	movl	(%r12), %r8d	# 6912	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r12, %rdi	# 6917	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r8	# 6913	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r12), %r8	# 6915	[c=13 l=8]  *adddi_1/1
+	movq	%r8, %rbp	# 16415	[c=4 l=3]  *movdi_internal/3
+	movq	%r8, %rsi	# 6916	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 6918	[c=0 l=5]  *call
+	movzbl	9(%rbp), %eax	# 6919	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, (%r12)	# 6920	[c=9 l=4]  *addsi_1/0
+	leaq	handler.1(%rip), %rdi	# 16418	[c=1 l=7]  *movdi_internal/4
+	movzbl	8(%rbp), %eax	# 6923	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 16416	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 6924	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbx,%rdx), %rdx	# 6927	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r12)	# 6928	[c=13 l=5]  *adddi_1/0
+	jmp	*(%rdi,%rax,8)	# 18573	[c=10 l=3]  *indirect_jump
+.L660:
+	movzbl	10(%rbp), %eax	# 6936	[c=13 l=4]  zero_extendqidi2/0
+	movl	$30, %edx	# 6942	[c=4 l=5]  *movsi_internal/0
+	leaq	.LC44(%rip), %rsi	# 6943	[c=1 l=7]  *movdi_internal/4
+	movq	%r12, %rdi	# 6945	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, 8(%rsp)	# 16419	[c=4 l=4]  *movsi_internal/1
+	movq	%rax, %r13	# 17701	[c=4 l=3]  *movdi_internal/3
+	movq	1040(%r12), %rax	# 6938	[c=9 l=8]  *movdi_internal/3
+	movzwl	30(%rax), %r15d	# 6939	[c=13 l=5]  *zero_extendhisi2/0
+	xorl	%eax, %eax	# 18572	[c=4 l=2]  *movdi_xor
+	movl	%r15d, %ecx	# 6941	[c=4 l=3]  *movsi_internal/0
+	movl	%r15d, %r14d	# 17702	[c=4 l=3]  *movsi_internal/0
+	call	log_append@PLT	# 6947	[c=0 l=5]  *call
+	movl	%r15d, %eax	# 16420	[c=4 l=3]  *movsi_internal/0
+	subl	5176(%r12), %eax	# 6949	[c=13 l=8]  *subsi_1/1
+	cmpl	5180(%r12), %eax	# 6950	[c=13 l=8]  *cmpsi_1/1
+	jb	.L661	# 6951	[c=13 l=2]  *jcc
+	movl	%r15d, %eax	# 16422	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %eax	# 6953	[c=4 l=3]  *ashrsi3_1/0
+	cltq	# 6954	[c=4 l=2]  *extendsidi2_rex64/0
+	cmpb	$0, 1080(%r12,%rax)	# 6955	[c=14 l=9]  *cmpqi_ccno_1/1
+	jne	.L662	# 6956	[c=13 l=6]  *jcc
+.L661:
+	movq	1040(%r12), %rdx	# 6960	[c=9 l=8]  *movdi_internal/3
+	movzwl	%r14w, %eax	# 6959	[c=4 l=4]  zero_extendhidi2/0
+	movzbl	(%rdx,%rax), %r14d	# 6961	[c=13 l=5]  *zero_extendqisi2/0
+.L663:
+	cmpl	$95, %r15d	# 14486	[c=4 l=4]  *cmpsi_1/0
+	movl	%r14d, %ecx	# 6977	[c=4 l=3]  *movsi_internal/0
+	movl	%r15d, %edx	# 6978	[c=4 l=3]  *movsi_internal/0
+	movq	%r12, %rdi	# 6980	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC29(%rip), %rax	# 15742	[c=1 l=7]  *movdi_internal/4
+	leaq	.LC28(%rip), %rsi	# 15741	[c=1 l=7]  *movdi_internal/4
+	cmovne	%rax, %rsi	# 14487	[c=8 l=4]  *movdicc_noc/1
+	call	log_add_data_mov@PLT	# 6981	[c=0 l=5]  *call
+	movzbl	%r13b, %edx	# 17264	[c=4 l=4]  *zero_extendqisi2/0
+	movzbl	%r14b, %ecx	# 6982	[c=4 l=4]  *zero_extendqisi2/0
+	movq	%r12, %rdi	# 6987	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC59(%rip), %rsi	# 6985	[c=1 l=7]  *movdi_internal/4
+	xorl	%eax, %eax	# 18569	[c=4 l=2]  *movdi_xor
+	call	log_append@PLT	# 6989	[c=0 l=5]  *call
+	movq	1040(%r12), %rax	# 6991	[c=9 l=8]  *movdi_internal/3
+	movl	$30, %edx	# 6996	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 6999	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC48(%rip), %rsi	# 6997	[c=1 l=7]  *movdi_internal/4
+	movb	%r14b, (%rax,%r13)	# 6992	[c=4 l=4]  *movqi_internal/8
+	leal	1(%r15), %r13d	# 17344	[c=4 l=4]  *leasi
+	xorl	%eax, %eax	# 18570	[c=4 l=2]  *movdi_xor
+	movzwl	%r13w, %ecx	# 6994	[c=4 l=4]  *zero_extendhisi2/0
+	call	log_append@PLT	# 7001	[c=0 l=5]  *call
+	movl	%r13d, %ecx	# 16425	[c=4 l=3]  *movsi_internal/0
+	movq	%r12, %rdi	# 7008	[c=4 l=3]  *movdi_internal/3
+	movq	%rbp, %rsi	# 7007	[c=4 l=3]  *movdi_internal/3
+	movq	1040(%r12), %rax	# 7002	[c=9 l=8]  *movdi_internal/3
+	movb	%r13b, 30(%rax)	# 7003	[c=4 l=4]  *movqi_internal/8
+	movq	1040(%r12), %rax	# 7004	[c=9 l=8]  *movdi_internal/3
+	movb	%ch, 31(%rax)	# 18571	[c=4 l=3]  *extzvqi_mem_rex64
+	call	log_dump_line@PLT	# 7009	[c=0 l=5]  *call
+	movq	40(%r12), %rax	# 16426	[c=9 l=5]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 16427	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 7011	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 17345	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r12)	# 7012	[c=4 l=5]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 7014	[c=4 l=3]  *cmpdi_1/0
+	jb	.L297	# 7015	[c=13 l=6]  *jcc
+	movl	(%r12), %r8d	# 7017	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r12, %rdi	# 7022	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r8	# 7018	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r12), %r8	# 7020	[c=13 l=8]  *adddi_1/1
+	movq	%r8, %rbp	# 16429	[c=4 l=3]  *movdi_internal/3
+	movq	%r8, %rsi	# 7021	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 7023	[c=0 l=5]  *call
+	movzbl	9(%rbp), %eax	# 7024	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, (%r12)	# 7025	[c=9 l=4]  *addsi_1/0
+	leaq	handler.1(%rip), %rdi	# 16432	[c=1 l=7]  *movdi_internal/4
+	movzbl	8(%rbp), %eax	# 7028	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 16430	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 7029	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbx,%rdx), %rdx	# 7032	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r12)	# 7033	[c=13 l=5]  *adddi_1/0
+	jmp	*(%rdi,%rax,8)	# 18568	[c=10 l=3]  *indirect_jump
+.L665:
+	movq	1040(%r12), %rax	# 7041	[c=9 l=8]  *movdi_internal/3
+	movl	$30, %edx	# 7044	[c=4 l=5]  *movsi_internal/0
+	leaq	.LC44(%rip), %rsi	# 7045	[c=1 l=7]  *movdi_internal/4
+	movq	%r12, %rdi	# 7047	[c=4 l=3]  *movdi_internal/3
+	movzwl	30(%rax), %r13d	# 7042	[c=13 l=5]  *zero_extendhisi2/0
+	xorl	%eax, %eax	# 18565	[c=4 l=2]  *movdi_xor
+	movl	%r13d, %ecx	# 7043	[c=4 l=3]  *movsi_internal/0
+	call	log_append@PLT	# 7049	[c=0 l=5]  *call
+	movl	992(%r12), %eax	# 7050	[c=9 l=8]  *movsi_internal/0
+	movq	1056(%r12), %rdx	# 7055	[c=9 l=8]  *movdi_internal/3
+	movq	%r12, %rdi	# 7062	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC59(%rip), %rsi	# 7060	[c=1 l=7]  *movdi_internal/4
+	leal	1(%rax,%rax), %eax	# 7052	[c=8 l=4]  *leasi
+	andl	%r13d, %eax	# 7053	[c=4 l=3]  *andsi_1/0
+	cltq	# 7054	[c=4 l=2]  *extendsidi2_rex64/0
+	movzbl	(%rdx,%rax), %ecx	# 7056	[c=13 l=4]  *zero_extendqisi2/0
+	xorl	%edx, %edx	# 18566	[c=4 l=2]  *movdi_xor
+	xorl	%eax, %eax	# 18567	[c=4 l=2]  *movdi_xor
+	movl	%ecx, %r13d	# 17703	[c=4 l=3]  *movsi_internal/0
+	call	log_append@PLT	# 7064	[c=0 l=5]  *call
+	movq	1040(%r12), %rax	# 7065	[c=9 l=8]  *movdi_internal/3
+	movq	%r12, %rdi	# 7068	[c=4 l=3]  *movdi_internal/3
+	movq	%rbp, %rsi	# 7067	[c=4 l=3]  *movdi_internal/3
+	movb	%r13b, (%rax)	# 7066	[c=4 l=3]  *movqi_internal/8
+	call	log_dump_line@PLT	# 7069	[c=0 l=5]  *call
+	movq	40(%r12), %rax	# 16433	[c=9 l=5]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 16434	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 7071	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 17343	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r12)	# 7072	[c=4 l=5]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 7074	[c=4 l=3]  *cmpdi_1/0
+	jb	.L297	# 7075	[c=13 l=6]  *jcc
+	movl	(%r12), %r8d	# 7077	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r12, %rdi	# 7082	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r8	# 7078	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r12), %r8	# 7080	[c=13 l=8]  *adddi_1/1
+	movq	%r8, %rbp	# 16436	[c=4 l=3]  *movdi_internal/3
+	movq	%r8, %rsi	# 7081	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 7083	[c=0 l=5]  *call
+	movzbl	9(%rbp), %eax	# 7084	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, (%r12)	# 7085	[c=9 l=4]  *addsi_1/0
+	leaq	handler.1(%rip), %rdi	# 16439	[c=1 l=7]  *movdi_internal/4
+	movzbl	8(%rbp), %eax	# 7088	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 16437	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 7089	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbx,%rdx), %rdx	# 7092	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r12)	# 7093	[c=13 l=5]  *adddi_1/0
+	jmp	*(%rdi,%rax,8)	# 18564	[c=10 l=3]  *indirect_jump
+.L666:
+	movq	1040(%r12), %rax	# 7102	[c=9 l=8]  *movdi_internal/3
+	movl	$30, %edx	# 7105	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 7108	[c=4 l=3]  *movdi_internal/3
+	movzbl	10(%rbp), %r13d	# 7101	[c=13 l=5]  zero_extendqidi2/0
+	leaq	.LC44(%rip), %rsi	# 7106	[c=1 l=7]  *movdi_internal/4
+	movzwl	30(%rax), %r14d	# 7103	[c=13 l=5]  *zero_extendhisi2/0
+	xorl	%eax, %eax	# 18562	[c=4 l=2]  *movdi_xor
+	movl	%r14d, %ecx	# 7104	[c=4 l=3]  *movsi_internal/0
+	call	log_append@PLT	# 7110	[c=0 l=5]  *call
+	movl	992(%r12), %eax	# 7111	[c=9 l=8]  *movsi_internal/0
+	movq	1056(%r12), %rdx	# 7116	[c=9 l=8]  *movdi_internal/3
+	movq	%r12, %rdi	# 7124	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC59(%rip), %rsi	# 7122	[c=1 l=7]  *movdi_internal/4
+	leal	1(%rax,%rax), %eax	# 7113	[c=8 l=4]  *leasi
+	andl	%r14d, %eax	# 7114	[c=4 l=3]  *andsi_1/0
+	cltq	# 7115	[c=4 l=2]  *extendsidi2_rex64/0
+	movzbl	(%rdx,%rax), %ecx	# 7117	[c=13 l=4]  *zero_extendqisi2/0
+	movzbl	%r13b, %edx	# 7119	[c=4 l=4]  *zero_extendqisi2/0
+	xorl	%eax, %eax	# 18563	[c=4 l=2]  *movdi_xor
+	movl	%ecx, %r14d	# 17704	[c=4 l=3]  *movsi_internal/0
+	call	log_append@PLT	# 7126	[c=0 l=5]  *call
+	movq	1040(%r12), %rax	# 7128	[c=9 l=8]  *movdi_internal/3
+	movq	%r12, %rdi	# 7131	[c=4 l=3]  *movdi_internal/3
+	movq	%rbp, %rsi	# 7130	[c=4 l=3]  *movdi_internal/3
+	movb	%r14b, (%rax,%r13)	# 7129	[c=4 l=4]  *movqi_internal/8
+	call	log_dump_line@PLT	# 7132	[c=0 l=5]  *call
+	movq	40(%r12), %rax	# 16440	[c=9 l=5]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 16441	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 7134	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 17342	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r12)	# 7135	[c=4 l=5]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 7137	[c=4 l=3]  *cmpdi_1/0
+	jb	.L297	# 7138	[c=13 l=6]  *jcc
+	movl	(%r12), %r8d	# 7140	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r12, %rdi	# 7145	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r8	# 7141	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r12), %r8	# 7143	[c=13 l=8]  *adddi_1/1
+	movq	%r8, %rbp	# 16443	[c=4 l=3]  *movdi_internal/3
+	movq	%r8, %rsi	# 7144	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 7146	[c=0 l=5]  *call
+	movzbl	9(%rbp), %eax	# 7147	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, (%r12)	# 7148	[c=9 l=4]  *addsi_1/0
+	leaq	handler.1(%rip), %rdi	# 16446	[c=1 l=7]  *movdi_internal/4
+	movzbl	8(%rbp), %eax	# 7151	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 16444	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 7152	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbx,%rdx), %rdx	# 7155	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r12)	# 7156	[c=13 l=5]  *adddi_1/0
+	jmp	*(%rdi,%rax,8)	# 18561	[c=10 l=3]  *indirect_jump
+.L667:
+	movq	1040(%r12), %rax	# 7165	[c=9 l=8]  *movdi_internal/3
+	movl	$30, %edx	# 7168	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 7171	[c=4 l=3]  *movdi_internal/3
+	movzbl	10(%rbp), %r14d	# 7164	[c=13 l=5]  zero_extendqidi2/0
+	leaq	.LC44(%rip), %rsi	# 7169	[c=1 l=7]  *movdi_internal/4
+	movzwl	30(%rax), %r13d	# 7166	[c=13 l=5]  *zero_extendhisi2/0
+	xorl	%eax, %eax	# 18557	[c=4 l=2]  *movdi_xor
+	movl	%r13d, %ecx	# 7167	[c=4 l=3]  *movsi_internal/0
+	call	log_append@PLT	# 7173	[c=0 l=5]  *call
+	movl	992(%r12), %eax	# 7174	[c=9 l=8]  *movsi_internal/0
+	movq	1056(%r12), %rdx	# 7179	[c=9 l=8]  *movdi_internal/3
+	movq	%r12, %rdi	# 7187	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC59(%rip), %rsi	# 7185	[c=1 l=7]  *movdi_internal/4
+	leal	1(%rax,%rax), %eax	# 7176	[c=8 l=4]  *leasi
+	andl	%r13d, %eax	# 7177	[c=4 l=3]  *andsi_1/0
+	addl	$1, %r13d	# 7193	[c=4 l=4]  *addsi_1/0
+	cltq	# 7178	[c=4 l=2]  *extendsidi2_rex64/0
+	movzwl	%r13w, %r13d	# 7194	[c=4 l=4]  *zero_extendhisi2/0
+	movzbl	(%rdx,%rax), %ecx	# 7180	[c=13 l=4]  *zero_extendqisi2/0
+	movzbl	%r14b, %edx	# 7182	[c=4 l=4]  *zero_extendqisi2/0
+	xorl	%eax, %eax	# 18558	[c=4 l=2]  *movdi_xor
+	movl	%ecx, %r15d	# 17705	[c=4 l=3]  *movsi_internal/0
+	call	log_append@PLT	# 7189	[c=0 l=5]  *call
+	movl	$30, %edx	# 7196	[c=4 l=5]  *movsi_internal/0
+	movl	%r13d, %ecx	# 7195	[c=4 l=3]  *movsi_internal/0
+	movq	%r12, %rdi	# 7199	[c=4 l=3]  *movdi_internal/3
+	movq	1040(%r12), %rax	# 7191	[c=9 l=8]  *movdi_internal/3
+	leaq	.LC48(%rip), %rsi	# 7197	[c=1 l=7]  *movdi_internal/4
+	movb	%r15b, (%rax,%r14)	# 7192	[c=4 l=4]  *movqi_internal/8
+	xorl	%eax, %eax	# 18559	[c=4 l=2]  *movdi_xor
+	call	log_append@PLT	# 7201	[c=0 l=5]  *call
+	movl	%r13d, %ecx	# 16448	[c=4 l=3]  *movsi_internal/0
+	movq	%r12, %rdi	# 7208	[c=4 l=3]  *movdi_internal/3
+	movq	%rbp, %rsi	# 7207	[c=4 l=3]  *movdi_internal/3
+	movq	1040(%r12), %rax	# 7202	[c=9 l=8]  *movdi_internal/3
+	movb	%r13b, 30(%rax)	# 7203	[c=4 l=4]  *movqi_internal/8
+	movq	1040(%r12), %rax	# 7204	[c=9 l=8]  *movdi_internal/3
+	movb	%ch, 31(%rax)	# 18560	[c=4 l=3]  *extzvqi_mem_rex64
+	call	log_dump_line@PLT	# 7209	[c=0 l=5]  *call
+	movq	40(%r12), %rax	# 16449	[c=9 l=5]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 16450	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 7211	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 17341	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r12)	# 7212	[c=4 l=5]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 7214	[c=4 l=3]  *cmpdi_1/0
+	jb	.L297	# 7215	[c=13 l=6]  *jcc
+	movl	(%r12), %r8d	# 7217	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r12, %rdi	# 7222	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r8	# 7218	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r12), %r8	# 7220	[c=13 l=8]  *adddi_1/1
+	movq	%r8, %rbp	# 16452	[c=4 l=3]  *movdi_internal/3
+	movq	%r8, %rsi	# 7221	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 7223	[c=0 l=5]  *call
+	movzbl	9(%rbp), %eax	# 7224	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, (%r12)	# 7225	[c=9 l=4]  *addsi_1/0
+	leaq	handler.1(%rip), %rdi	# 16455	[c=1 l=7]  *movdi_internal/4
+	movzbl	8(%rbp), %eax	# 7228	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 16453	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 7229	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbx,%rdx), %rdx	# 7232	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r12)	# 7233	[c=13 l=5]  *adddi_1/0
+	jmp	*(%rdi,%rax,8)	# 18556	[c=10 l=3]  *indirect_jump
+.L668:
+	movzbl	10(%rbp), %edx	# 7241	[c=13 l=4]  zero_extendqidi2/0
+	movq	1040(%r12), %rax	# 7244	[c=9 l=8]  *movdi_internal/3
+	leaq	.LC43(%rip), %rsi	# 7248	[c=1 l=7]  *movdi_internal/4
+	movq	%r12, %rdi	# 7250	[c=4 l=3]  *movdi_internal/3
+	movzbl	(%rax,%rdx), %ecx	# 7245	[c=13 l=4]  *zero_extendqisi2/0
+	xorl	%eax, %eax	# 18554	[c=4 l=2]  *movdi_xor
+	movq	%rdx, %r13	# 17706	[c=4 l=3]  *movdi_internal/3
+	movl	%edx, 8(%rsp)	# 17145	[c=4 l=4]  *movsi_internal/1
+	call	log_append@PLT	# 7252	[c=0 l=5]  *call
+	movq	1040(%r12), %rax	# 7253	[c=9 l=8]  *movdi_internal/3
+	movl	8(%rsp), %edx	# 17146	[c=9 l=4]  *movsi_internal/0
+	movq	%r12, %rdi	# 7260	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC59(%rip), %rsi	# 7258	[c=1 l=7]  *movdi_internal/4
+	movzbl	(%rax,%r13), %r14d	# 7254	[c=13 l=5]  zero_extendqidi2/0
+	xorl	%eax, %eax	# 18555	[c=4 l=2]  *movdi_xor
+	movl	%r14d, %r15d	# 16456	[c=4 l=3]  *movsi_internal/0
+	sarl	%r15d	# 7255	[c=4 l=3]  *ashrsi3_1/0
+	movl	%r15d, %ecx	# 7256	[c=4 l=3]  *movsi_internal/0
+	call	log_append@PLT	# 7262	[c=0 l=5]  *call
+	movq	1040(%r12), %rax	# 7263	[c=9 l=8]  *movdi_internal/3
+	movb	%r15b, (%rax,%r13)	# 7264	[c=4 l=4]  *movqi_internal/8
+	movl	$95, %eax	# 7265	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r12), %eax	# 7266	[c=13 l=8]  *subsi_1/1
+	cmpl	5180(%r12), %eax	# 7267	[c=13 l=8]  *cmpsi_1/1
+	jb	.L669	# 7268	[c=13 l=2]  *jcc
+	cmpb	$0, 1082(%r12)	# 7270	[c=13 l=9]  *cmpqi_ccno_1/1
+	jne	.L670	# 7271	[c=13 l=6]  *jcc
+.L669:
+	movq	1040(%r12), %rax	# 7274	[c=9 l=8]  *movdi_internal/3
+	movzbl	95(%rax), %r13d	# 7275	[c=13 l=5]  *zero_extendqisi2/0
+.L671:
+	movl	%r13d, %ecx	# 7286	[c=4 l=3]  *movsi_internal/0
+	movl	$95, %edx	# 7287	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 7290	[c=4 l=3]  *movdi_internal/3
+	andl	$-32, %r13d	# 7292	[c=4 l=4]  *andsi_1/0
+	leaq	.LC28(%rip), %rsi	# 7288	[c=1 l=7]  *movdi_internal/4
+	call	log_add_data_mov@PLT	# 7291	[c=0 l=5]  *call
+	leaq	flag_update_table_ror8(%rip), %rax	# 15685	[c=1 l=7]  *movdi_internal/4
+	movl	$95, %edx	# 7299	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 7302	[c=4 l=3]  *movdi_internal/3
+	movzbl	(%rax,%r14), %eax	# 7295	[c=13 l=5]  *zero_extendqisi2/0
+	leaq	.LC30(%rip), %rsi	# 7300	[c=1 l=7]  *movdi_internal/4
+	orl	%eax, %r13d	# 7296	[c=4 l=3]  *iorsi_1/0
+	movzbl	%r13b, %ecx	# 7297	[c=4 l=4]  *zero_extendqisi2/0
+	call	log_add_data_mov@PLT	# 7303	[c=0 l=5]  *call
+	movl	$95, %eax	# 7304	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r12), %eax	# 7305	[c=13 l=8]  *subsi_1/1
+	cmpl	5180(%r12), %eax	# 7306	[c=13 l=8]  *cmpsi_1/1
+	jb	.L672	# 7307	[c=13 l=2]  *jcc
+	cmpb	$0, 1082(%r12)	# 7309	[c=13 l=9]  *cmpqi_ccno_1/1
+	jne	.L673	# 7310	[c=13 l=6]  *jcc
+.L672:
+	movq	1040(%r12), %rax	# 7313	[c=9 l=8]  *movdi_internal/3
+	movb	%r13b, 95(%rax)	# 7314	[c=4 l=4]  *movqi_internal/8
+.L674:
+	movq	%r12, %rdi	# 7326	[c=4 l=3]  *movdi_internal/3
+	movq	%rbp, %rsi	# 7325	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 7327	[c=0 l=5]  *call
+	movq	40(%r12), %rax	# 16458	[c=9 l=5]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 16459	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 7329	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 17340	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r12)	# 7330	[c=4 l=5]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 7332	[c=4 l=3]  *cmpdi_1/0
+	jb	.L297	# 7333	[c=13 l=6]  *jcc
+	movl	(%r12), %r8d	# 7335	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r12, %rdi	# 7340	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r8	# 7336	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r12), %r8	# 7338	[c=13 l=8]  *adddi_1/1
+	movq	%r8, %rbp	# 16461	[c=4 l=3]  *movdi_internal/3
+	movq	%r8, %rsi	# 7339	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 7341	[c=0 l=5]  *call
+	movzbl	9(%rbp), %eax	# 7342	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, (%r12)	# 7343	[c=9 l=4]  *addsi_1/0
+	leaq	handler.1(%rip), %rdi	# 16464	[c=1 l=7]  *movdi_internal/4
+	movzbl	8(%rbp), %eax	# 7346	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 16462	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 7347	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbx,%rdx), %rdx	# 7350	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r12)	# 7351	[c=13 l=5]  *adddi_1/0
+	jmp	*(%rdi,%rax,8)	# 18553	[c=10 l=3]  *indirect_jump
+.L675:
+	movzwl	12(%rbp), %r14d	# 7359	[c=13 l=5]  zero_extendhidi2/0
+	movq	%r12, %rdi	# 7369	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 18551	[c=4 l=2]  *movdi_xor
+	movzbl	10(%rbp), %r13d	# 7360	[c=13 l=5]  zero_extendqidi2/0
+	movq	1040(%r12), %rdx	# 7362	[c=9 l=8]  *movdi_internal/3
+	leaq	.LC43(%rip), %rsi	# 7367	[c=1 l=7]  *movdi_internal/4
+	movzbl	(%rdx,%r14), %ecx	# 7363	[c=13 l=5]  *zero_extendqisi2/0
+	movzwl	%r14w, %edx	# 7364	[c=4 l=4]  *zero_extendhisi2/0
+	call	log_append@PLT	# 7371	[c=0 l=5]  *call
+	movq	1040(%r12), %rax	# 7372	[c=9 l=8]  *movdi_internal/3
+	movzbl	%r13b, %edx	# 7375	[c=4 l=4]  *zero_extendqisi2/0
+	movq	%r12, %rdi	# 7380	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC59(%rip), %rsi	# 7378	[c=1 l=7]  *movdi_internal/4
+	movzbl	(%rax,%r14), %ecx	# 7373	[c=13 l=5]  *zero_extendqisi2/0
+	xorl	%eax, %eax	# 18552	[c=4 l=2]  *movdi_xor
+	movl	%ecx, %r14d	# 17708	[c=4 l=3]  *movsi_internal/0
+	call	log_append@PLT	# 7382	[c=0 l=5]  *call
+	movq	1040(%r12), %rax	# 7384	[c=9 l=8]  *movdi_internal/3
+	movq	%r12, %rdi	# 7387	[c=4 l=3]  *movdi_internal/3
+	movq	%rbp, %rsi	# 7386	[c=4 l=3]  *movdi_internal/3
+	movb	%r14b, (%rax,%r13)	# 7385	[c=4 l=4]  *movqi_internal/8
+	call	log_dump_line@PLT	# 7388	[c=0 l=5]  *call
+	movq	40(%r12), %rax	# 16465	[c=9 l=5]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 16466	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 7390	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 17339	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r12)	# 7391	[c=4 l=5]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 7393	[c=4 l=3]  *cmpdi_1/0
+	jb	.L297	# 7394	[c=13 l=6]  *jcc
+	movl	(%r12), %r8d	# 7396	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r12, %rdi	# 7401	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r8	# 7397	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r12), %r8	# 7399	[c=13 l=8]  *adddi_1/1
+	movq	%r8, %rbp	# 16468	[c=4 l=3]  *movdi_internal/3
+	movq	%r8, %rsi	# 7400	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 7402	[c=0 l=5]  *call
+	movzbl	9(%rbp), %eax	# 7403	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, (%r12)	# 7404	[c=9 l=4]  *addsi_1/0
+	leaq	handler.1(%rip), %rdi	# 16471	[c=1 l=7]  *movdi_internal/4
+	movzbl	8(%rbp), %eax	# 7407	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 16469	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 7408	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbx,%rdx), %rdx	# 7411	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r12)	# 7412	[c=13 l=5]  *adddi_1/0
+	jmp	*(%rdi,%rax,8)	# 18550	[c=10 l=3]  *indirect_jump
+.L676:
+	movzwl	12(%rbp), %edx	# 7420	[c=13 l=4]  zero_extendhidi2/0
+	movzbl	10(%rbp), %r13d	# 7421	[c=13 l=5]  zero_extendqidi2/0
+	movq	%r12, %rdi	# 7433	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC44(%rip), %rsi	# 7431	[c=1 l=7]  *movdi_internal/4
+	movq	1040(%r12), %rcx	# 7422	[c=9 l=8]  *movdi_internal/3
+	movq	%rdx, %rax	# 17709	[c=4 l=3]  *movdi_internal/3
+	movzbl	1(%rcx,%rdx), %r14d	# 7424	[c=14 l=6]  *zero_extendqisi2/0
+	movzbl	(%rcx,%rdx), %edx	# 7426	[c=13 l=4]  *zero_extendqisi2/0
+	sall	$8, %r14d	# 7425	[c=4 l=4]  *ashlsi3_1/0
+	orl	%edx, %r14d	# 7427	[c=4 l=3]  *iorsi_1/0
+	movzwl	%ax, %edx	# 7428	[c=4 l=3]  *zero_extendhisi2/0
+	xorl	%eax, %eax	# 18548	[c=4 l=2]  *movdi_xor
+	movl	%r14d, %ecx	# 7429	[c=4 l=3]  *movsi_internal/0
+	call	log_append@PLT	# 7435	[c=0 l=5]  *call
+	movzbl	%r13b, %edx	# 7436	[c=4 l=4]  *zero_extendqisi2/0
+	movl	%r14d, %ecx	# 7437	[c=4 l=3]  *movsi_internal/0
+	movq	%r12, %rdi	# 7441	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC48(%rip), %rsi	# 7439	[c=1 l=7]  *movdi_internal/4
+	xorl	%eax, %eax	# 18549	[c=4 l=2]  *movdi_xor
+	call	log_append@PLT	# 7443	[c=0 l=5]  *call
+	movl	%r14d, %ecx	# 16473	[c=4 l=3]  *movsi_internal/0
+	movq	%r12, %rdi	# 7451	[c=4 l=3]  *movdi_internal/3
+	movq	%rbp, %rsi	# 7450	[c=4 l=3]  *movdi_internal/3
+	movq	1040(%r12), %rax	# 7445	[c=9 l=8]  *movdi_internal/3
+	movzbl	%ch, %ecx	# 7449	[c=4 l=3]  *extzvqi/0
+	movb	%r14b, (%rax,%r13)	# 7446	[c=4 l=4]  *movqi_internal/8
+	movq	1040(%r12), %rax	# 7447	[c=9 l=8]  *movdi_internal/3
+	movb	%cl, 1(%rax,%r13)	# 16472	[c=4 l=5]  *movqi_internal/8
+	call	log_dump_line@PLT	# 7452	[c=0 l=5]  *call
+	movq	40(%r12), %rax	# 16474	[c=9 l=5]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 16475	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 7454	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 17338	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r12)	# 7455	[c=4 l=5]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 7457	[c=4 l=3]  *cmpdi_1/0
+	jb	.L297	# 7458	[c=13 l=6]  *jcc
+	movl	(%r12), %r8d	# 7460	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r12, %rdi	# 7465	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r8	# 7461	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r12), %r8	# 7463	[c=13 l=8]  *adddi_1/1
+	movq	%r8, %rbp	# 16477	[c=4 l=3]  *movdi_internal/3
+	movq	%r8, %rsi	# 7464	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 7466	[c=0 l=5]  *call
+	movzbl	9(%rbp), %eax	# 7467	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, (%r12)	# 7468	[c=9 l=4]  *addsi_1/0
+	leaq	handler.1(%rip), %rdi	# 16480	[c=1 l=7]  *movdi_internal/4
+	movzbl	8(%rbp), %eax	# 7471	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 16478	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 7472	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbx,%rdx), %rdx	# 7475	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r12)	# 7476	[c=13 l=5]  *adddi_1/0
+	jmp	*(%rdi,%rax,8)	# 18547	[c=10 l=3]  *indirect_jump
+.L677:
+	movzbl	10(%rbp), %r14d	# 7485	[c=13 l=5]  zero_extendqidi2/0
+	xorl	%eax, %eax	# 18545	[c=4 l=2]  *movdi_xor
+	movq	%r12, %rdi	# 7494	[c=4 l=3]  *movdi_internal/3
+	movzwl	12(%rbp), %r13d	# 7484	[c=9 l=5]  *movhi_internal/2
+	movq	1040(%r12), %rdx	# 7487	[c=9 l=8]  *movdi_internal/3
+	leaq	.LC43(%rip), %r15	# 7492	[c=1 l=7]  *movdi_internal/4
+	movq	%r15, %rsi	# 7493	[c=4 l=3]  *movdi_internal/3
+	movzbl	(%rdx,%r14), %ecx	# 7488	[c=13 l=5]  *zero_extendqisi2/0
+	movzbl	%r14b, %edx	# 7489	[c=4 l=4]  *zero_extendqisi2/0
+	call	log_append@PLT	# 7496	[c=0 l=5]  *call
+	movzwl	%r13w, %edx	# 7501	[c=4 l=4]  *zero_extendhisi2/0
+	movq	%r15, %rsi	# 7505	[c=4 l=3]  *movdi_internal/3
+	movq	%r12, %rdi	# 7506	[c=4 l=3]  *movdi_internal/3
+	movq	1040(%r12), %rax	# 7497	[c=9 l=8]  *movdi_internal/3
+	movzbl	(%rax,%r14), %r9d	# 7498	[c=13 l=5]  *zero_extendqisi2/0
+	movzwl	%r13w, %r14d	# 7499	[c=4 l=4]  zero_extendhidi2/0
+	movzbl	(%rax,%r14), %ecx	# 7500	[c=13 l=5]  *zero_extendqisi2/0
+	xorl	%eax, %eax	# 18546	[c=4 l=2]  *movdi_xor
+	movl	%r9d, 8(%rsp)	# 17147	[c=4 l=5]  *movsi_internal/1
+	call	log_append@PLT	# 7508	[c=0 l=5]  *call
+	movq	1040(%r12), %rdx	# 7509	[c=9 l=8]  *movdi_internal/3
+	movl	8(%rsp), %r9d	# 17148	[c=9 l=5]  *movsi_internal/0
+	movzbl	(%rdx,%r14), %r15d	# 7510	[c=13 l=5]  *zero_extendqisi2/0
+	imull	%r9d, %r15d	# 7511	[c=12 l=4]  *mulsi3_1/2
+	cmpl	$1, %r15d	# 7514	[c=4 l=4]  *cmpsi_1/0
+	movl	%r15d, %eax	# 16481	[c=4 l=3]  *movsi_internal/0
+	sbbl	%r14d, %r14d	# 7515	[c=8 l=3]  *x86_movsicc_0_m1_neg
+	sarl	$15, %eax	# 7517	[c=4 l=3]  *ashrsi3_1/0
+	andl	$2, %r14d	# 7516	[c=4 l=4]  *andsi_1/0
+	orl	%eax, %r14d	# 7518	[c=4 l=3]  *iorsi_1/0
+	movl	$95, %eax	# 7519	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r12), %eax	# 7520	[c=13 l=8]  *subsi_1/1
+	cmpl	5180(%r12), %eax	# 7521	[c=13 l=8]  *cmpsi_1/1
+	jb	.L678	# 7522	[c=13 l=2]  *jcc
+	cmpb	$0, 1082(%r12)	# 7524	[c=13 l=9]  *cmpqi_ccno_1/1
+	jne	.L679	# 7525	[c=13 l=6]  *jcc
+.L678:
+	movzbl	95(%rdx), %r13d	# 7528	[c=13 l=5]  *zero_extendqisi2/0
+.L680:
+	movl	%r13d, %ecx	# 7539	[c=4 l=3]  *movsi_internal/0
+	andl	$-4, %r13d	# 7545	[c=4 l=4]  *andsi_1/0
+	movl	$95, %edx	# 7540	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 7543	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC28(%rip), %rsi	# 7541	[c=1 l=7]  *movdi_internal/4
+	orl	%r14d, %r13d	# 7546	[c=4 l=3]  *iorsi_1/0
+	call	log_add_data_mov@PLT	# 7544	[c=0 l=5]  *call
+	movzbl	%r13b, %ecx	# 7547	[c=4 l=4]  *zero_extendqisi2/0
+	movl	$95, %edx	# 7549	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 7552	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC30(%rip), %rsi	# 7550	[c=1 l=7]  *movdi_internal/4
+	call	log_add_data_mov@PLT	# 7553	[c=0 l=5]  *call
+	movl	$95, %eax	# 7554	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r12), %eax	# 7555	[c=13 l=8]  *subsi_1/1
+	cmpl	5180(%r12), %eax	# 7556	[c=13 l=8]  *cmpsi_1/1
+	jb	.L681	# 7557	[c=13 l=2]  *jcc
+	cmpb	$0, 1082(%r12)	# 7559	[c=13 l=9]  *cmpqi_ccno_1/1
+	jne	.L682	# 7560	[c=13 l=6]  *jcc
+.L681:
+	movq	1040(%r12), %rax	# 7563	[c=9 l=8]  *movdi_internal/3
+	movb	%r13b, 95(%rax)	# 7564	[c=4 l=4]  *movqi_internal/8
+.L683:
+	xorl	%edx, %edx	# 18542	[c=4 l=2]  *movdi_xor
+	movl	%r15d, %ecx	# 7575	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC48(%rip), %rsi	# 7577	[c=1 l=7]  *movdi_internal/4
+	movq	%r12, %rdi	# 7579	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 18543	[c=4 l=2]  *movdi_xor
+	call	log_append@PLT	# 7581	[c=0 l=5]  *call
+	movl	%r15d, %ecx	# 16484	[c=4 l=3]  *movsi_internal/0
+	movq	%r12, %rdi	# 7588	[c=4 l=3]  *movdi_internal/3
+	movq	%rbp, %rsi	# 7587	[c=4 l=3]  *movdi_internal/3
+	movq	1040(%r12), %rax	# 7582	[c=9 l=8]  *movdi_internal/3
+	movb	%r15b, (%rax)	# 7583	[c=4 l=3]  *movqi_internal/8
+	movq	1040(%r12), %rax	# 7584	[c=9 l=8]  *movdi_internal/3
+	movb	%ch, 1(%rax)	# 18544	[c=4 l=3]  *extzvqi_mem_rex64
+	call	log_dump_line@PLT	# 7589	[c=0 l=5]  *call
+	movq	40(%r12), %rax	# 16485	[c=9 l=5]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 16486	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 7591	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 17337	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r12)	# 7592	[c=4 l=5]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 7594	[c=4 l=3]  *cmpdi_1/0
+	jb	.L297	# 7595	[c=13 l=6]  *jcc
+	movl	(%r12), %r8d	# 7597	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r12, %rdi	# 7602	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r8	# 7598	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r12), %r8	# 7600	[c=13 l=8]  *adddi_1/1
+	movq	%r8, %rbp	# 16488	[c=4 l=3]  *movdi_internal/3
+	movq	%r8, %rsi	# 7601	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 7603	[c=0 l=5]  *call
+	movzbl	9(%rbp), %eax	# 7604	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, (%r12)	# 7605	[c=9 l=4]  *addsi_1/0
+	leaq	handler.1(%rip), %rdi	# 16491	[c=1 l=7]  *movdi_internal/4
+	movzbl	8(%rbp), %eax	# 7608	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 16489	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 7609	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbx,%rdx), %rdx	# 7612	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r12)	# 7613	[c=13 l=5]  *adddi_1/0
+	jmp	*(%rdi,%rax,8)	# 18541	[c=10 l=3]  *indirect_jump
+.L684:
+	movzbl	10(%rbp), %r14d	# 7622	[c=13 l=5]  zero_extendqidi2/0
+	xorl	%eax, %eax	# 18536	[c=4 l=2]  *movdi_xor
+	movq	%r12, %rdi	# 7631	[c=4 l=3]  *movdi_internal/3
+	movzwl	12(%rbp), %r15d	# 7621	[c=13 l=5]  zero_extendhidi2/0
+	movq	1040(%r12), %rdx	# 7624	[c=9 l=8]  *movdi_internal/3
+	leaq	.LC43(%rip), %rsi	# 7629	[c=1 l=7]  *movdi_internal/4
+	movzbl	(%rdx,%r14), %ecx	# 7625	[c=13 l=5]  *zero_extendqisi2/0
+	movzbl	%r14b, %edx	# 7626	[c=4 l=4]  *zero_extendqisi2/0
+	call	log_append@PLT	# 7633	[c=0 l=5]  *call
+	movq	1040(%r12), %rax	# 7634	[c=9 l=8]  *movdi_internal/3
+	movzwl	%r15w, %edx	# 7638	[c=4 l=4]  *zero_extendhisi2/0
+	movq	%r12, %rdi	# 7643	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC43(%rip), %rsi	# 17150	[c=1 l=7]  *movdi_internal/4
+	movzbl	(%rax,%r15), %ecx	# 7637	[c=13 l=5]  *zero_extendqisi2/0
+	movsbl	(%rax,%r14), %r14d	# 7635	[c=13 l=5]  extendqisi2
+	xorl	%eax, %eax	# 18537	[c=4 l=2]  *movdi_xor
+	call	log_append@PLT	# 7645	[c=0 l=5]  *call
+	movq	1040(%r12), %rdx	# 7646	[c=9 l=8]  *movdi_internal/3
+	xorl	%eax, %eax	# 18538	[c=4 l=2]  *movsi_xor
+	movsbl	(%rdx,%r15), %r13d	# 7647	[c=13 l=5]  extendqisi2
+	imull	%r14d, %r13d	# 7648	[c=12 l=4]  *mulsi3_1/2
+	andl	$65535, %r13d	# 18539	[c=4 l=7]  *andsi_2/0
+	sete	%al	# 18540	[c=4 l=3]  *setcc_qi_slp
+	movl	%r13d, %ecx	# 16492	[c=4 l=3]  *movsi_internal/0
+	addl	%eax, %eax	# 7654	[c=4 l=2]  *ashlsi3_1/0
+	sarl	$15, %ecx	# 7655	[c=4 l=3]  *ashrsi3_1/0
+	orl	%ecx, %eax	# 7656	[c=4 l=2]  *iorsi_1/0
+	movl	%eax, %r14d	# 16495	[c=4 l=3]  *movsi_internal/0
+	movl	$95, %eax	# 7657	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r12), %eax	# 7658	[c=13 l=8]  *subsi_1/1
+	cmpl	5180(%r12), %eax	# 7659	[c=13 l=8]  *cmpsi_1/1
+	jb	.L685	# 7660	[c=13 l=2]  *jcc
+	cmpb	$0, 1082(%r12)	# 7662	[c=13 l=9]  *cmpqi_ccno_1/1
+	jne	.L686	# 7663	[c=13 l=6]  *jcc
+.L685:
+	movzbl	95(%rdx), %r15d	# 7666	[c=13 l=5]  *zero_extendqisi2/0
+.L687:
+	movl	%r15d, %ecx	# 7677	[c=4 l=3]  *movsi_internal/0
+	andl	$-4, %r15d	# 7683	[c=4 l=4]  *andsi_1/0
+	movl	$95, %edx	# 7678	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 7681	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC28(%rip), %rsi	# 7679	[c=1 l=7]  *movdi_internal/4
+	orl	%r15d, %r14d	# 7684	[c=4 l=3]  *iorsi_1/0
+	call	log_add_data_mov@PLT	# 7682	[c=0 l=5]  *call
+	movzbl	%r14b, %ecx	# 7685	[c=4 l=4]  *zero_extendqisi2/0
+	movl	$95, %edx	# 7687	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 7690	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC30(%rip), %rsi	# 7688	[c=1 l=7]  *movdi_internal/4
+	call	log_add_data_mov@PLT	# 7691	[c=0 l=5]  *call
+	movl	$95, %eax	# 7692	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r12), %eax	# 7693	[c=13 l=8]  *subsi_1/1
+	cmpl	5180(%r12), %eax	# 7694	[c=13 l=8]  *cmpsi_1/1
+	jb	.L688	# 7695	[c=13 l=2]  *jcc
+	cmpb	$0, 1082(%r12)	# 7697	[c=13 l=9]  *cmpqi_ccno_1/1
+	jne	.L689	# 7698	[c=13 l=6]  *jcc
+.L688:
+	movq	1040(%r12), %rax	# 7701	[c=9 l=8]  *movdi_internal/3
+	movb	%r14b, 95(%rax)	# 7702	[c=4 l=4]  *movqi_internal/8
+.L690:
+	xorl	%edx, %edx	# 18533	[c=4 l=2]  *movdi_xor
+	movl	%r13d, %ecx	# 7713	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC48(%rip), %rsi	# 7715	[c=1 l=7]  *movdi_internal/4
+	movq	%r12, %rdi	# 7717	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 18534	[c=4 l=2]  *movdi_xor
+	call	log_append@PLT	# 7719	[c=0 l=5]  *call
+	movl	%r13d, %ecx	# 16497	[c=4 l=3]  *movsi_internal/0
+	movq	%r12, %rdi	# 7726	[c=4 l=3]  *movdi_internal/3
+	movq	%rbp, %rsi	# 7725	[c=4 l=3]  *movdi_internal/3
+	movq	1040(%r12), %rax	# 7720	[c=9 l=8]  *movdi_internal/3
+	movb	%r13b, (%rax)	# 7721	[c=4 l=3]  *movqi_internal/8
+	movq	1040(%r12), %rax	# 7722	[c=9 l=8]  *movdi_internal/3
+	movb	%ch, 1(%rax)	# 18535	[c=4 l=3]  *extzvqi_mem_rex64
+	call	log_dump_line@PLT	# 7727	[c=0 l=5]  *call
+	movq	40(%r12), %rax	# 16498	[c=9 l=5]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 16499	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 7729	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 17334	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r12)	# 7730	[c=4 l=5]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 7732	[c=4 l=3]  *cmpdi_1/0
+	jb	.L297	# 7733	[c=13 l=6]  *jcc
+	movl	(%r12), %r8d	# 7735	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r12, %rdi	# 7740	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r8	# 7736	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r12), %r8	# 7738	[c=13 l=8]  *adddi_1/1
+	movq	%r8, %rbp	# 16501	[c=4 l=3]  *movdi_internal/3
+	movq	%r8, %rsi	# 7739	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 7741	[c=0 l=5]  *call
+	movzbl	9(%rbp), %eax	# 7742	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, (%r12)	# 7743	[c=9 l=4]  *addsi_1/0
+	leaq	handler.1(%rip), %rdi	# 16504	[c=1 l=7]  *movdi_internal/4
+	movzbl	8(%rbp), %eax	# 7746	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 16502	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 7747	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbx,%rdx), %rdx	# 7750	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r12)	# 7751	[c=13 l=5]  *adddi_1/0
+	jmp	*(%rdi,%rax,8)	# 18532	[c=10 l=3]  *indirect_jump
+.L691:
+	movzbl	10(%rbp), %r14d	# 7760	[c=13 l=5]  zero_extendqidi2/0
+	xorl	%eax, %eax	# 18527	[c=4 l=2]  *movdi_xor
+	movq	%r12, %rdi	# 7769	[c=4 l=3]  *movdi_internal/3
+	movzwl	12(%rbp), %r15d	# 7759	[c=13 l=5]  zero_extendhidi2/0
+	movq	1040(%r12), %rdx	# 7762	[c=9 l=8]  *movdi_internal/3
+	leaq	.LC43(%rip), %rsi	# 7767	[c=1 l=7]  *movdi_internal/4
+	movzbl	(%rdx,%r14), %ecx	# 7763	[c=13 l=5]  *zero_extendqisi2/0
+	movzbl	%r14b, %edx	# 7764	[c=4 l=4]  *zero_extendqisi2/0
+	call	log_append@PLT	# 7771	[c=0 l=5]  *call
+	movq	1040(%r12), %rax	# 7772	[c=9 l=8]  *movdi_internal/3
+	movzwl	%r15w, %edx	# 7776	[c=4 l=4]  *zero_extendhisi2/0
+	movq	%r12, %rdi	# 7781	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC43(%rip), %rsi	# 17152	[c=1 l=7]  *movdi_internal/4
+	movzbl	(%rax,%r15), %ecx	# 7775	[c=13 l=5]  *zero_extendqisi2/0
+	movsbl	(%rax,%r14), %r14d	# 7773	[c=13 l=5]  extendqisi2
+	xorl	%eax, %eax	# 18528	[c=4 l=2]  *movdi_xor
+	call	log_append@PLT	# 7783	[c=0 l=5]  *call
+	movq	1040(%r12), %rdx	# 7784	[c=9 l=8]  *movdi_internal/3
+	xorl	%eax, %eax	# 18529	[c=4 l=2]  *movsi_xor
+	movzbl	(%rdx,%r15), %r13d	# 7785	[c=13 l=5]  *zero_extendqisi2/0
+	imull	%r14d, %r13d	# 7786	[c=12 l=4]  *mulsi3_1/2
+	andl	$65535, %r13d	# 18530	[c=4 l=7]  *andsi_2/0
+	sete	%al	# 18531	[c=4 l=3]  *setcc_qi_slp
+	movl	%r13d, %ecx	# 16505	[c=4 l=3]  *movsi_internal/0
+	addl	%eax, %eax	# 7792	[c=4 l=2]  *ashlsi3_1/0
+	sarl	$15, %ecx	# 7793	[c=4 l=3]  *ashrsi3_1/0
+	orl	%ecx, %eax	# 7794	[c=4 l=2]  *iorsi_1/0
+	movl	%eax, %r14d	# 16508	[c=4 l=3]  *movsi_internal/0
+	movl	$95, %eax	# 7795	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r12), %eax	# 7796	[c=13 l=8]  *subsi_1/1
+	cmpl	5180(%r12), %eax	# 7797	[c=13 l=8]  *cmpsi_1/1
+	jb	.L692	# 7798	[c=13 l=2]  *jcc
+	cmpb	$0, 1082(%r12)	# 7800	[c=13 l=9]  *cmpqi_ccno_1/1
+	jne	.L693	# 7801	[c=13 l=6]  *jcc
+.L692:
+	movzbl	95(%rdx), %r15d	# 7804	[c=13 l=5]  *zero_extendqisi2/0
+.L694:
+	movl	%r15d, %ecx	# 7815	[c=4 l=3]  *movsi_internal/0
+	andl	$-4, %r15d	# 7821	[c=4 l=4]  *andsi_1/0
+	movl	$95, %edx	# 7816	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 7819	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC28(%rip), %rsi	# 7817	[c=1 l=7]  *movdi_internal/4
+	orl	%r15d, %r14d	# 7822	[c=4 l=3]  *iorsi_1/0
+	call	log_add_data_mov@PLT	# 7820	[c=0 l=5]  *call
+	movzbl	%r14b, %ecx	# 7823	[c=4 l=4]  *zero_extendqisi2/0
+	movl	$95, %edx	# 7825	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 7828	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC30(%rip), %rsi	# 7826	[c=1 l=7]  *movdi_internal/4
+	call	log_add_data_mov@PLT	# 7829	[c=0 l=5]  *call
+	movl	$95, %eax	# 7830	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r12), %eax	# 7831	[c=13 l=8]  *subsi_1/1
+	cmpl	5180(%r12), %eax	# 7832	[c=13 l=8]  *cmpsi_1/1
+	jb	.L695	# 7833	[c=13 l=2]  *jcc
+	cmpb	$0, 1082(%r12)	# 7835	[c=13 l=9]  *cmpqi_ccno_1/1
+	jne	.L696	# 7836	[c=13 l=6]  *jcc
+.L695:
+	movq	1040(%r12), %rax	# 7839	[c=9 l=8]  *movdi_internal/3
+	movb	%r14b, 95(%rax)	# 7840	[c=4 l=4]  *movqi_internal/8
+.L697:
+	xorl	%edx, %edx	# 18524	[c=4 l=2]  *movdi_xor
+	movl	%r13d, %ecx	# 7851	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC48(%rip), %rsi	# 7853	[c=1 l=7]  *movdi_internal/4
+	movq	%r12, %rdi	# 7855	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 18525	[c=4 l=2]  *movdi_xor
+	call	log_append@PLT	# 7857	[c=0 l=5]  *call
+	movl	%r13d, %ecx	# 16510	[c=4 l=3]  *movsi_internal/0
+	movq	%r12, %rdi	# 7864	[c=4 l=3]  *movdi_internal/3
+	movq	%rbp, %rsi	# 7863	[c=4 l=3]  *movdi_internal/3
+	movq	1040(%r12), %rax	# 7858	[c=9 l=8]  *movdi_internal/3
+	movb	%r13b, (%rax)	# 7859	[c=4 l=3]  *movqi_internal/8
+	movq	1040(%r12), %rax	# 7860	[c=9 l=8]  *movdi_internal/3
+	movb	%ch, 1(%rax)	# 18526	[c=4 l=3]  *extzvqi_mem_rex64
+	call	log_dump_line@PLT	# 7865	[c=0 l=5]  *call
+	movq	40(%r12), %rax	# 16511	[c=9 l=5]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 16512	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 7867	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 17331	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r12)	# 7868	[c=4 l=5]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 7870	[c=4 l=3]  *cmpdi_1/0
+	jb	.L297	# 7871	[c=13 l=6]  *jcc
+	movl	(%r12), %r8d	# 7873	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r12, %rdi	# 7878	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r8	# 7874	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r12), %r8	# 7876	[c=13 l=8]  *adddi_1/1
+	movq	%r8, %rbp	# 16514	[c=4 l=3]  *movdi_internal/3
+	movq	%r8, %rsi	# 7877	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 7879	[c=0 l=5]  *call
+	movzbl	9(%rbp), %eax	# 7880	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, (%r12)	# 7881	[c=9 l=4]  *addsi_1/0
+	leaq	handler.1(%rip), %rdi	# 16517	[c=1 l=7]  *movdi_internal/4
+	movzbl	8(%rbp), %eax	# 7884	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 16515	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 7885	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbx,%rdx), %rdx	# 7888	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r12)	# 7889	[c=13 l=5]  *adddi_1/0
+	jmp	*(%rdi,%rax,8)	# 18523	[c=10 l=3]  *indirect_jump
+.L698:
+	movzbl	10(%rbp), %edx	# 7897	[c=13 l=4]  zero_extendqidi2/0
+	movq	1040(%r12), %rax	# 7900	[c=9 l=8]  *movdi_internal/3
+	leaq	.LC43(%rip), %rsi	# 7904	[c=1 l=7]  *movdi_internal/4
+	movq	%r12, %rdi	# 7906	[c=4 l=3]  *movdi_internal/3
+	movzbl	(%rax,%rdx), %ecx	# 7901	[c=13 l=4]  *zero_extendqisi2/0
+	xorl	%eax, %eax	# 18521	[c=4 l=2]  *movdi_xor
+	movq	%rdx, %r15	# 17715	[c=4 l=3]  *movdi_internal/3
+	movl	%edx, 8(%rsp)	# 17153	[c=4 l=4]  *movsi_internal/1
+	call	log_append@PLT	# 7908	[c=0 l=5]  *call
+	movq	1040(%r12), %rax	# 7909	[c=9 l=8]  *movdi_internal/3
+	movl	8(%rsp), %edx	# 17154	[c=9 l=4]  *movsi_internal/0
+	movq	%r12, %rdi	# 7918	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC59(%rip), %rsi	# 7916	[c=1 l=7]  *movdi_internal/4
+	movzbl	(%rax,%r15), %r14d	# 7910	[c=13 l=5]  *zero_extendqisi2/0
+	xorl	%eax, %eax	# 18522	[c=4 l=2]  *movdi_xor
+	movl	%r14d, %r13d	# 17716	[c=4 l=3]  *movsi_internal/0
+	negl	%r14d	# 7912	[c=4 l=3]  *negsi_1
+	movzbl	%r14b, %ecx	# 7913	[c=4 l=4]  *zero_extendqisi2/0
+	andl	$136, %r13d	# 7924	[c=4 l=7]  *andsi_1/0
+	call	log_append@PLT	# 7920	[c=0 l=5]  *call
+	movq	1040(%r12), %rax	# 7921	[c=9 l=8]  *movdi_internal/3
+	movl	%r14d, %edx	# 16518	[c=4 l=3]  *movsi_internal/0
+	andl	$511, %edx	# 7927	[c=4 l=6]  *andsi_1/0
+	movb	%r14b, (%rax,%r15)	# 7922	[c=4 l=4]  *movqi_internal/8
+	imull	$260, %r13d, %eax	# 7925	[c=12 l=7]  *mulsi3_1/1
+	andl	$7680, %eax	# 7926	[c=4 l=5]  *andsi_1/0
+	orl	%edx, %eax	# 7928	[c=4 l=2]  *iorsi_1/0
+	movl	%eax, %r13d	# 16521	[c=4 l=3]  *movsi_internal/0
+	movl	$95, %eax	# 7929	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r12), %eax	# 7930	[c=13 l=8]  *subsi_1/1
+	cmpl	5180(%r12), %eax	# 7931	[c=13 l=8]  *cmpsi_1/1
+	jb	.L699	# 7932	[c=13 l=2]  *jcc
+	cmpb	$0, 1082(%r12)	# 7934	[c=13 l=9]  *cmpqi_ccno_1/1
+	jne	.L700	# 7935	[c=13 l=6]  *jcc
+.L699:
+	movq	1040(%r12), %rax	# 7938	[c=9 l=8]  *movdi_internal/3
+	movzbl	95(%rax), %r14d	# 7939	[c=13 l=5]  *zero_extendqisi2/0
+.L701:
+	movl	%r14d, %ecx	# 7950	[c=4 l=3]  *movsi_internal/0
+	movl	$95, %edx	# 7951	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 7954	[c=4 l=3]  *movdi_internal/3
+	andl	$-64, %r14d	# 7956	[c=4 l=4]  *andsi_1/0
+	leaq	.LC28(%rip), %rsi	# 7952	[c=1 l=7]  *movdi_internal/4
+	call	log_add_data_mov@PLT	# 7955	[c=0 l=5]  *call
+	leaq	flag_update_table_sub8(%rip), %rdx	# 15686	[c=1 l=7]  *movdi_internal/4
+	movl	%r13d, %eax	# 7958	[c=1 l=3]  *zero_extendsidi2/3
+	movq	%r12, %rdi	# 7966	[c=4 l=3]  *movdi_internal/3
+	movzbl	(%rdx,%rax), %eax	# 7959	[c=13 l=4]  *zero_extendqisi2/0
+	leaq	.LC30(%rip), %rsi	# 7964	[c=1 l=7]  *movdi_internal/4
+	movl	$95, %edx	# 7963	[c=4 l=5]  *movsi_internal/0
+	orl	%eax, %r14d	# 7960	[c=4 l=3]  *iorsi_1/0
+	movzbl	%r14b, %ecx	# 7961	[c=4 l=4]  *zero_extendqisi2/0
+	call	log_add_data_mov@PLT	# 7967	[c=0 l=5]  *call
+	movl	$95, %eax	# 7968	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r12), %eax	# 7969	[c=13 l=8]  *subsi_1/1
+	cmpl	5180(%r12), %eax	# 7970	[c=13 l=8]  *cmpsi_1/1
+	jb	.L702	# 7971	[c=13 l=2]  *jcc
+	cmpb	$0, 1082(%r12)	# 7973	[c=13 l=9]  *cmpqi_ccno_1/1
+	jne	.L703	# 7974	[c=13 l=6]  *jcc
+.L702:
+	movq	1040(%r12), %rax	# 7977	[c=9 l=8]  *movdi_internal/3
+	movb	%r14b, 95(%rax)	# 7978	[c=4 l=4]  *movqi_internal/8
+.L704:
+	movq	%r12, %rdi	# 7990	[c=4 l=3]  *movdi_internal/3
+	movq	%rbp, %rsi	# 7989	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 7991	[c=0 l=5]  *call
+	movq	40(%r12), %rax	# 16522	[c=9 l=5]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 16523	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 7993	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 17330	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r12)	# 7994	[c=4 l=5]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 7996	[c=4 l=3]  *cmpdi_1/0
+	jb	.L297	# 7997	[c=13 l=6]  *jcc
+	movl	(%r12), %r8d	# 7999	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r12, %rdi	# 8004	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r8	# 8000	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r12), %r8	# 8002	[c=13 l=8]  *adddi_1/1
+	movq	%r8, %rbp	# 16525	[c=4 l=3]  *movdi_internal/3
+	movq	%r8, %rsi	# 8003	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 8005	[c=0 l=5]  *call
+	movzbl	9(%rbp), %eax	# 8006	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, (%r12)	# 8007	[c=9 l=4]  *addsi_1/0
+	leaq	handler.1(%rip), %rdi	# 16528	[c=1 l=7]  *movdi_internal/4
+	movzbl	8(%rbp), %eax	# 8010	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 16526	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 8011	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbx,%rdx), %rdx	# 8014	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r12)	# 8015	[c=13 l=5]  *adddi_1/0
+	jmp	*(%rdi,%rax,8)	# 18520	[c=10 l=3]  *indirect_jump
+.L705:
+	movq	%r12, %rdi	# 8024	[c=4 l=3]  *movdi_internal/3
+	movq	%rbp, %rsi	# 8023	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 8025	[c=0 l=5]  *call
+	movq	40(%r12), %rax	# 16529	[c=9 l=5]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 16530	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 8027	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 17329	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r12)	# 8028	[c=4 l=5]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 8030	[c=4 l=3]  *cmpdi_1/0
+	jb	.L297	# 8031	[c=13 l=6]  *jcc
+	movl	(%r12), %r8d	# 8033	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r12, %rdi	# 8038	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r8	# 8034	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r12), %r8	# 8036	[c=13 l=8]  *adddi_1/1
+	movq	%r8, %rbp	# 16532	[c=4 l=3]  *movdi_internal/3
+	movq	%r8, %rsi	# 8037	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 8039	[c=0 l=5]  *call
+	movzbl	9(%rbp), %eax	# 8040	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, (%r12)	# 8041	[c=9 l=4]  *addsi_1/0
+	leaq	handler.1(%rip), %rdi	# 16535	[c=1 l=7]  *movdi_internal/4
+	movzbl	8(%rbp), %eax	# 8044	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 16533	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 8045	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbx,%rdx), %rdx	# 8048	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r12)	# 8049	[c=13 l=5]  *adddi_1/0
+	jmp	*(%rdi,%rax,8)	# 18519	[c=10 l=3]  *indirect_jump
+.L706:
+	movzbl	10(%rbp), %r9d	# 8058	[c=13 l=5]  zero_extendqidi2/0
+	movzwl	12(%rbp), %r15d	# 8057	[c=9 l=5]  *movhi_internal/2
+	movq	%r12, %rdi	# 8067	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC43(%rip), %rsi	# 8065	[c=1 l=7]  *movdi_internal/4
+	movq	1040(%r12), %rax	# 8061	[c=9 l=8]  *movdi_internal/3
+	movl	%r9d, %edx	# 8064	[c=4 l=3]  *movsi_internal/0
+	movq	%r9, %r13	# 17717	[c=4 l=3]  *movdi_internal/3
+	movl	%r9d, 16(%rsp)	# 17159	[c=4 l=5]  *movsi_internal/1
+	movzbl	(%rax,%r9), %ecx	# 8062	[c=13 l=5]  *zero_extendqisi2/0
+	xorl	%eax, %eax	# 18515	[c=4 l=2]  *movdi_xor
+	call	log_append@PLT	# 8069	[c=0 l=5]  *call
+	movzwl	%r15w, %r11d	# 8072	[c=4 l=4]  zero_extendhidi2/0
+	movzwl	%r15w, %edx	# 8074	[c=4 l=4]  *zero_extendhisi2/0
+	movq	%r12, %rdi	# 8079	[c=4 l=3]  *movdi_internal/3
+	movq	1040(%r12), %rax	# 8070	[c=9 l=8]  *movdi_internal/3
+	leaq	.LC43(%rip), %rsi	# 17158	[c=1 l=7]  *movdi_internal/4
+	movq	%r11, 8(%rsp)	# 17155	[c=4 l=5]  *movdi_internal/5
+	movzbl	(%rax,%r11), %ecx	# 8073	[c=13 l=5]  *zero_extendqisi2/0
+	movzbl	(%rax,%r13), %r14d	# 8071	[c=9 l=5]  *movqi_internal/4
+	xorl	%eax, %eax	# 18516	[c=4 l=2]  *movdi_xor
+	call	log_append@PLT	# 8081	[c=0 l=5]  *call
+	movq	8(%rsp), %r11	# 17156	[c=9 l=5]  *movdi_internal/3
+	movl	%r14d, %r15d	# 16536	[c=4 l=3]  *movqi_internal/2
+	movq	%r12, %rdi	# 8089	[c=4 l=3]  *movdi_internal/3
+	movq	1040(%r12), %rax	# 8082	[c=9 l=8]  *movdi_internal/3
+	movl	16(%rsp), %edx	# 18517	[c=9 l=4]  *movsi_internal/0
+	leaq	.LC59(%rip), %rsi	# 8087	[c=1 l=7]  *movdi_internal/4
+	orb	(%rax,%r11), %r15b	# 8083	[c=13 l=4]  *iorqi_1/1
+	xorl	%eax, %eax	# 18518	[c=4 l=2]  *movdi_xor
+	movzbl	%r15b, %r14d	# 8084	[c=4 l=4]  zero_extendqidi2/0
+	movl	%r14d, %ecx	# 8085	[c=4 l=3]  *movsi_internal/0
+	call	log_append@PLT	# 8091	[c=0 l=5]  *call
+	movq	1040(%r12), %rax	# 8092	[c=9 l=8]  *movdi_internal/3
+	movb	%r15b, (%rax,%r13)	# 8093	[c=4 l=4]  *movqi_internal/8
+	movl	$95, %eax	# 8094	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r12), %eax	# 8095	[c=13 l=8]  *subsi_1/1
+	cmpl	5180(%r12), %eax	# 8096	[c=13 l=8]  *cmpsi_1/1
+	jb	.L707	# 8097	[c=13 l=2]  *jcc
+	cmpb	$0, 1082(%r12)	# 8099	[c=13 l=9]  *cmpqi_ccno_1/1
+	jne	.L708	# 8100	[c=13 l=6]  *jcc
+.L707:
+	movq	1040(%r12), %rax	# 8103	[c=9 l=8]  *movdi_internal/3
+	movzbl	95(%rax), %r13d	# 8104	[c=13 l=5]  *zero_extendqisi2/0
+.L709:
+	movl	%r13d, %ecx	# 8115	[c=4 l=3]  *movsi_internal/0
+	movl	$95, %edx	# 8116	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 8119	[c=4 l=3]  *movdi_internal/3
+	andl	$-31, %r13d	# 8121	[c=4 l=4]  *andsi_1/0
+	leaq	.LC28(%rip), %rsi	# 8117	[c=1 l=7]  *movdi_internal/4
+	call	log_add_data_mov@PLT	# 8120	[c=0 l=5]  *call
+	leaq	flag_update_table_logical(%rip), %rax	# 15687	[c=1 l=7]  *movdi_internal/4
+	movl	$95, %edx	# 8128	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 8131	[c=4 l=3]  *movdi_internal/3
+	movzbl	(%rax,%r14), %eax	# 8124	[c=13 l=5]  *zero_extendqisi2/0
+	leaq	.LC30(%rip), %rsi	# 8129	[c=1 l=7]  *movdi_internal/4
+	orl	%eax, %r13d	# 8125	[c=4 l=3]  *iorsi_1/0
+	movzbl	%r13b, %ecx	# 8126	[c=4 l=4]  *zero_extendqisi2/0
+	call	log_add_data_mov@PLT	# 8132	[c=0 l=5]  *call
+	movl	$95, %eax	# 8133	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r12), %eax	# 8134	[c=13 l=8]  *subsi_1/1
+	cmpl	5180(%r12), %eax	# 8135	[c=13 l=8]  *cmpsi_1/1
+	jb	.L710	# 8136	[c=13 l=2]  *jcc
+	cmpb	$0, 1082(%r12)	# 8138	[c=13 l=9]  *cmpqi_ccno_1/1
+	jne	.L711	# 8139	[c=13 l=6]  *jcc
+.L710:
+	movq	1040(%r12), %rax	# 8142	[c=9 l=8]  *movdi_internal/3
+	movb	%r13b, 95(%rax)	# 8143	[c=4 l=4]  *movqi_internal/8
+.L712:
+	movq	%r12, %rdi	# 8155	[c=4 l=3]  *movdi_internal/3
+	movq	%rbp, %rsi	# 8154	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 8156	[c=0 l=5]  *call
+	movq	40(%r12), %rax	# 16538	[c=9 l=5]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 16539	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 8158	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 17328	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r12)	# 8159	[c=4 l=5]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 8161	[c=4 l=3]  *cmpdi_1/0
+	jb	.L297	# 8162	[c=13 l=6]  *jcc
+	movl	(%r12), %r8d	# 8164	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r12, %rdi	# 8169	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r8	# 8165	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r12), %r8	# 8167	[c=13 l=8]  *adddi_1/1
+	movq	%r8, %rbp	# 16541	[c=4 l=3]  *movdi_internal/3
+	movq	%r8, %rsi	# 8168	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 8170	[c=0 l=5]  *call
+	movzbl	9(%rbp), %eax	# 8171	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, (%r12)	# 8172	[c=9 l=4]  *addsi_1/0
+	leaq	handler.1(%rip), %rdi	# 16544	[c=1 l=7]  *movdi_internal/4
+	movzbl	8(%rbp), %eax	# 8175	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 16542	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 8176	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbx,%rdx), %rdx	# 8179	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r12)	# 8180	[c=13 l=5]  *adddi_1/0
+	jmp	*(%rdi,%rax,8)	# 18514	[c=10 l=3]  *indirect_jump
+.L713:
+	movzwl	12(%rbp), %r13d	# 8188	[c=13 l=5]  *zero_extendhisi2/0
+	movq	%r12, %rdi	# 8194	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 18511	[c=4 l=2]  *movdi_xor
+	movzbl	10(%rbp), %r14d	# 8189	[c=13 l=5]  zero_extendqidi2/0
+	leaq	.LC60(%rip), %rsi	# 8192	[c=1 l=7]  *movdi_internal/4
+	movl	%r13d, %edx	# 8191	[c=4 l=3]  *movsi_internal/0
+	call	log_append@PLT	# 8196	[c=0 l=5]  *call
+	movq	1040(%r12), %rax	# 8198	[c=9 l=8]  *movdi_internal/3
+	movl	%r14d, %edx	# 8201	[c=4 l=3]  *movsi_internal/0
+	movq	%r12, %rdi	# 8204	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC43(%rip), %rsi	# 8202	[c=1 l=7]  *movdi_internal/4
+	movzbl	(%rax,%r14), %ecx	# 8199	[c=13 l=5]  *zero_extendqisi2/0
+	xorl	%eax, %eax	# 18512	[c=4 l=2]  *movdi_xor
+	call	log_append@PLT	# 8206	[c=0 l=5]  *call
+	movq	1040(%r12), %rax	# 8207	[c=9 l=8]  *movdi_internal/3
+	movl	%r14d, %edx	# 8212	[c=4 l=3]  *movsi_internal/0
+	movq	%r12, %rdi	# 8215	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC59(%rip), %rsi	# 8213	[c=1 l=7]  *movdi_internal/4
+	movzbl	(%rax,%r14), %eax	# 8208	[c=13 l=5]  *zero_extendqisi2/0
+	orl	%eax, %r13d	# 8209	[c=4 l=3]  *iorsi_1/0
+	xorl	%eax, %eax	# 18513	[c=4 l=2]  *movdi_xor
+	movzbl	%r13b, %ecx	# 8210	[c=4 l=4]  *zero_extendqisi2/0
+	call	log_append@PLT	# 8217	[c=0 l=5]  *call
+	movq	1040(%r12), %rax	# 8218	[c=9 l=8]  *movdi_internal/3
+	movb	%r13b, (%rax,%r14)	# 8219	[c=4 l=4]  *movqi_internal/8
+	movl	$95, %eax	# 8220	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r12), %eax	# 8221	[c=13 l=8]  *subsi_1/1
+	cmpl	5180(%r12), %eax	# 8222	[c=13 l=8]  *cmpsi_1/1
+	jb	.L714	# 8223	[c=13 l=2]  *jcc
+	cmpb	$0, 1082(%r12)	# 8225	[c=13 l=9]  *cmpqi_ccno_1/1
+	jne	.L715	# 8226	[c=13 l=6]  *jcc
+.L714:
+	movq	1040(%r12), %rax	# 8229	[c=9 l=8]  *movdi_internal/3
+	movzbl	95(%rax), %r14d	# 8230	[c=13 l=5]  *zero_extendqisi2/0
+.L716:
+	movl	%r14d, %ecx	# 8241	[c=4 l=3]  *movsi_internal/0
+	movl	$95, %edx	# 8242	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 8245	[c=4 l=3]  *movdi_internal/3
+	movslq	%r13d, %r13	# 8249	[c=4 l=3]  *extendsidi2_rex64/1
+	leaq	.LC28(%rip), %rsi	# 8243	[c=1 l=7]  *movdi_internal/4
+	andl	$-31, %r14d	# 8247	[c=4 l=4]  *andsi_1/0
+	call	log_add_data_mov@PLT	# 8246	[c=0 l=5]  *call
+	leaq	flag_update_table_logical(%rip), %rax	# 15688	[c=1 l=7]  *movdi_internal/4
+	movl	$95, %edx	# 8254	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 8257	[c=4 l=3]  *movdi_internal/3
+	movzbl	(%rax,%r13), %eax	# 8250	[c=13 l=5]  *zero_extendqisi2/0
+	leaq	.LC30(%rip), %rsi	# 8255	[c=1 l=7]  *movdi_internal/4
+	orl	%eax, %r14d	# 8251	[c=4 l=3]  *iorsi_1/0
+	movzbl	%r14b, %ecx	# 8252	[c=4 l=4]  *zero_extendqisi2/0
+	call	log_add_data_mov@PLT	# 8258	[c=0 l=5]  *call
+	movl	$95, %eax	# 8259	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r12), %eax	# 8260	[c=13 l=8]  *subsi_1/1
+	cmpl	5180(%r12), %eax	# 8261	[c=13 l=8]  *cmpsi_1/1
+	jb	.L717	# 8262	[c=13 l=2]  *jcc
+	cmpb	$0, 1082(%r12)	# 8264	[c=13 l=9]  *cmpqi_ccno_1/1
+	jne	.L718	# 8265	[c=13 l=6]  *jcc
+.L717:
+	movq	1040(%r12), %rax	# 8268	[c=9 l=8]  *movdi_internal/3
+	movb	%r14b, 95(%rax)	# 8269	[c=4 l=4]  *movqi_internal/8
+.L719:
+	movq	%r12, %rdi	# 8281	[c=4 l=3]  *movdi_internal/3
+	movq	%rbp, %rsi	# 8280	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 8282	[c=0 l=5]  *call
+	movq	40(%r12), %rax	# 16545	[c=9 l=5]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 16546	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 8284	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 17327	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r12)	# 8285	[c=4 l=5]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 8287	[c=4 l=3]  *cmpdi_1/0
+	jb	.L297	# 8288	[c=13 l=6]  *jcc
+	movl	(%r12), %r8d	# 8290	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r12, %rdi	# 8295	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r8	# 8291	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r12), %r8	# 8293	[c=13 l=8]  *adddi_1/1
+	movq	%r8, %rbp	# 16548	[c=4 l=3]  *movdi_internal/3
+	movq	%r8, %rsi	# 8294	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 8296	[c=0 l=5]  *call
+	movzbl	9(%rbp), %eax	# 8297	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, (%r12)	# 8298	[c=9 l=4]  *addsi_1/0
+	leaq	handler.1(%rip), %rdi	# 16551	[c=1 l=7]  *movdi_internal/4
+	movzbl	8(%rbp), %eax	# 8301	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 16549	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 8302	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbx,%rdx), %rdx	# 8305	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r12)	# 8306	[c=13 l=5]  *adddi_1/0
+	jmp	*(%rdi,%rax,8)	# 18510	[c=10 l=3]  *indirect_jump
+.L720:
+	movzbl	10(%rbp), %r13d	# 8316	[c=13 l=5]  zero_extendqidi2/0
+	xorl	%eax, %eax	# 18509	[c=4 l=2]  *movdi_xor
+	movq	%r12, %rdi	# 8325	[c=4 l=3]  *movdi_internal/3
+	movzwl	12(%rbp), %r14d	# 8314	[c=13 l=5]  *zero_extendhisi2/0
+	movq	1040(%r12), %rdx	# 8318	[c=9 l=8]  *movdi_internal/3
+	leaq	.LC43(%rip), %rsi	# 8323	[c=1 l=7]  *movdi_internal/4
+	movl	%r14d, %r15d	# 17719	[c=4 l=3]  *movsi_internal/0
+	movzbl	(%rdx,%r13), %ecx	# 8319	[c=13 l=5]  *zero_extendqisi2/0
+	movzbl	%r13b, %edx	# 8320	[c=4 l=4]  *zero_extendqisi2/0
+	call	log_append@PLT	# 8327	[c=0 l=5]  *call
+	cmpl	$95, %r14d	# 14498	[c=4 l=4]  *cmpsi_1/0
+	movl	%r14d, %edx	# 8337	[c=4 l=3]  *movsi_internal/0
+	movq	%r12, %rdi	# 8339	[c=4 l=3]  *movdi_internal/3
+	movq	1040(%r12), %rax	# 8328	[c=9 l=8]  *movdi_internal/3
+	leaq	.LC30(%rip), %rsi	# 15743	[c=1 l=7]  *movdi_internal/4
+	movzbl	(%rax,%r13), %ecx	# 8329	[c=13 l=5]  *zero_extendqisi2/0
+	leaq	.LC31(%rip), %rax	# 15744	[c=1 l=7]  *movdi_internal/4
+	cmovne	%rax, %rsi	# 14499	[c=8 l=4]  *movdicc_noc/1
+	movl	%ecx, 8(%rsp)	# 17161	[c=4 l=4]  *movsi_internal/1
+	movl	%ecx, %r13d	# 17721	[c=4 l=3]  *movsi_internal/0
+	call	log_add_data_mov@PLT	# 8340	[c=0 l=5]  *call
+	movl	%r14d, %eax	# 16553	[c=4 l=3]  *movsi_internal/0
+	subl	5176(%r12), %eax	# 8342	[c=13 l=8]  *subsi_1/1
+	cmpl	5180(%r12), %eax	# 8343	[c=13 l=8]  *cmpsi_1/1
+	jb	.L722	# 8344	[c=13 l=2]  *jcc
+	movl	%r14d, %eax	# 16555	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %eax	# 8346	[c=4 l=3]  *ashrsi3_1/0
+	cltq	# 8347	[c=4 l=2]  *extendsidi2_rex64/0
+	cmpb	$0, 1080(%r12,%rax)	# 8348	[c=14 l=9]  *cmpqi_ccno_1/1
+	jne	.L723	# 8349	[c=13 l=6]  *jcc
+.L722:
+	movq	1040(%r12), %rdx	# 8353	[c=9 l=8]  *movdi_internal/3
+	movzwl	%r15w, %eax	# 8352	[c=4 l=4]  zero_extendhidi2/0
+	movb	%r13b, (%rdx,%rax)	# 8354	[c=4 l=4]  *movqi_internal/8
+.L724:
+	movq	%r12, %rdi	# 8366	[c=4 l=3]  *movdi_internal/3
+	movq	%rbp, %rsi	# 8365	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 8367	[c=0 l=5]  *call
+	movq	40(%r12), %rax	# 16557	[c=9 l=5]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 16558	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 8369	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 17326	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r12)	# 8370	[c=4 l=5]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 8372	[c=4 l=3]  *cmpdi_1/0
+	jb	.L297	# 8373	[c=13 l=6]  *jcc
+	movl	(%r12), %r8d	# 8375	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r12, %rdi	# 8380	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r8	# 8376	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r12), %r8	# 8378	[c=13 l=8]  *adddi_1/1
+	movq	%r8, %rbp	# 16560	[c=4 l=3]  *movdi_internal/3
+	movq	%r8, %rsi	# 8379	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 8381	[c=0 l=5]  *call
+	movzbl	9(%rbp), %eax	# 8382	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, (%r12)	# 8383	[c=9 l=4]  *addsi_1/0
+	leaq	handler.1(%rip), %rdi	# 16563	[c=1 l=7]  *movdi_internal/4
+	movzbl	8(%rbp), %eax	# 8386	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 16561	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 8387	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbx,%rdx), %rdx	# 8390	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r12)	# 8391	[c=13 l=5]  *adddi_1/0
+	jmp	*(%rdi,%rax,8)	# 18508	[c=10 l=3]  *indirect_jump
+.L725:
+	movzbl	10(%rbp), %eax	# 8399	[c=13 l=4]  zero_extendqidi2/0
+	movl	5176(%r12), %ecx	# 8401	[c=9 l=8]  *movsi_internal/0
+	movl	5180(%r12), %r15d	# 8402	[c=9 l=8]  *movsi_internal/0
+	movl	%eax, 8(%rsp)	# 16564	[c=4 l=4]  *movsi_internal/1
+	movq	%rax, %r13	# 17722	[c=4 l=3]  *movdi_internal/3
+	movl	$93, %eax	# 8403	[c=4 l=5]  *movsi_internal/0
+	subl	%ecx, %eax	# 8404	[c=4 l=2]  *subsi_1/0
+	cmpl	%r15d, %eax	# 8405	[c=4 l=3]  *cmpsi_1/0
+	jb	.L726	# 8406	[c=13 l=6]  *jcc
+	cmpb	$1, 1082(%r12)	# 8410	[c=13 l=9]  *cmpqi_1/0
+	ja	.L1371	# 8411	[c=13 l=6]  *jcc
+	movq	1040(%r12), %rax	# 13511	[c=9 l=8]  *movdi_internal/3
+	movzbl	93(%rax), %r14d	# 13512	[c=13 l=5]  *zero_extendqisi2/0
+.L728:
+	movzbl	94(%rax), %r9d	# 8448	[c=13 l=5]  *zero_extendqisi2/0
+.L730:
+	sall	$8, %r9d	# 8451	[c=4 l=4]  *ashlsi3_1/0
+	movl	$93, %edx	# 8454	[c=4 l=5]  *movsi_internal/0
+	leaq	.LC32(%rip), %rsi	# 8455	[c=1 l=7]  *movdi_internal/4
+	movq	%r12, %rdi	# 8457	[c=4 l=3]  *movdi_internal/3
+	orl	%r9d, %r14d	# 8452	[c=4 l=3]  *iorsi_1/0
+	leal	1(%r14), %r15d	# 17325	[c=4 l=4]  *leasi
+	movl	%r14d, %ecx	# 8453	[c=4 l=3]  *movsi_internal/0
+	call	log_add_data_mov@PLT	# 8458	[c=0 l=5]  *call
+	movzwl	%r15w, %r14d	# 8460	[c=4 l=4]  *zero_extendhisi2/0
+	movl	$93, %edx	# 8462	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 8465	[c=4 l=3]  *movdi_internal/3
+	movl	%r14d, %ecx	# 8461	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC33(%rip), %rsi	# 8463	[c=1 l=7]  *movdi_internal/4
+	call	log_add_data_mov@PLT	# 8466	[c=0 l=5]  *call
+	movl	$93, %eax	# 8467	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r12), %eax	# 8468	[c=13 l=8]  *subsi_1/1
+	cmpl	5180(%r12), %eax	# 8469	[c=13 l=8]  *cmpsi_1/1
+	jb	.L731	# 8470	[c=13 l=2]  *jcc
+	cmpb	$1, 1082(%r12)	# 8474	[c=13 l=9]  *cmpqi_1/0
+	ja	.L1372	# 8475	[c=13 l=6]  *jcc
+.L731:
+	movq	1040(%r12), %rax	# 8486	[c=9 l=8]  *movdi_internal/3
+	movb	%r15b, 93(%rax)	# 8487	[c=4 l=4]  *movqi_internal/8
+.L732:
+	movl	$94, %eax	# 8491	[c=4 l=5]  *movsi_internal/0
+	sarl	$8, %r14d	# 8490	[c=4 l=4]  *ashrsi3_1/0
+	subl	5176(%r12), %eax	# 8492	[c=13 l=8]  *subsi_1/1
+	cmpl	5180(%r12), %eax	# 8493	[c=13 l=8]  *cmpsi_1/1
+	jb	.L733	# 8494	[c=13 l=2]  *jcc
+	cmpb	$1, 1082(%r12)	# 8498	[c=13 l=9]  *cmpqi_1/0
+	ja	.L1373	# 8499	[c=13 l=6]  *jcc
+.L733:
+	movq	1040(%r12), %rax	# 8509	[c=9 l=8]  *movdi_internal/3
+	movb	%r14b, 94(%rax)	# 8510	[c=4 l=4]  *movqi_internal/8
+.L734:
+	movl	%r15d, %eax	# 16565	[c=4 l=3]  *movsi_internal/0
+	subl	5176(%r12), %eax	# 8513	[c=13 l=8]  *subsi_1/1
+	cmpl	5180(%r12), %eax	# 8514	[c=13 l=8]  *cmpsi_1/1
+	jb	.L735	# 8515	[c=13 l=2]  *jcc
+	movl	%r15d, %eax	# 16567	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %eax	# 8517	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 15658	[c=5 l=5]  *andsi_1_zext
+	cmpb	$0, 1080(%r12,%rax)	# 8520	[c=14 l=9]  *cmpqi_ccno_1/1
+	jne	.L736	# 8521	[c=13 l=6]  *jcc
+.L735:
+	movq	1040(%r12), %rdx	# 8525	[c=9 l=8]  *movdi_internal/3
+	movslq	%r15d, %rax	# 8524	[c=4 l=3]  *extendsidi2_rex64/1
+	movzbl	(%rdx,%rax), %r14d	# 8526	[c=13 l=5]  *zero_extendqisi2/0
+.L737:
+	cmpl	$95, %r15d	# 14510	[c=4 l=4]  *cmpsi_1/0
+	movl	%r14d, %ecx	# 8542	[c=4 l=3]  *movsi_internal/0
+	movl	%r15d, %edx	# 8543	[c=4 l=3]  *movsi_internal/0
+	movq	%r12, %rdi	# 8545	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC29(%rip), %rax	# 15746	[c=1 l=7]  *movdi_internal/4
+	leaq	.LC28(%rip), %rsi	# 15745	[c=1 l=7]  *movdi_internal/4
+	cmovne	%rax, %rsi	# 14511	[c=8 l=4]  *movdicc_noc/1
+	call	log_add_data_mov@PLT	# 8546	[c=0 l=5]  *call
+	movzbl	%r13b, %edx	# 17265	[c=4 l=4]  *zero_extendqisi2/0
+	movzbl	%r14b, %ecx	# 8547	[c=4 l=4]  *zero_extendqisi2/0
+	movq	%r12, %rdi	# 8552	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC59(%rip), %rsi	# 8550	[c=1 l=7]  *movdi_internal/4
+	xorl	%eax, %eax	# 18507	[c=4 l=2]  *movdi_xor
+	call	log_append@PLT	# 8554	[c=0 l=5]  *call
+	movq	1040(%r12), %rax	# 8556	[c=9 l=8]  *movdi_internal/3
+	movq	%r12, %rdi	# 8559	[c=4 l=3]  *movdi_internal/3
+	movq	%rbp, %rsi	# 8558	[c=4 l=3]  *movdi_internal/3
+	movb	%r14b, (%rax,%r13)	# 8557	[c=4 l=4]  *movqi_internal/8
+	call	log_dump_line@PLT	# 8560	[c=0 l=5]  *call
+	movq	40(%r12), %rax	# 16569	[c=9 l=5]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 16570	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 8562	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 17324	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r12)	# 8563	[c=4 l=5]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 8565	[c=4 l=3]  *cmpdi_1/0
+	jb	.L297	# 8566	[c=13 l=6]  *jcc
+	movl	(%r12), %r8d	# 8568	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r12, %rdi	# 8573	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r8	# 8569	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r12), %r8	# 8571	[c=13 l=8]  *adddi_1/1
+	movq	%r8, %rbp	# 16572	[c=4 l=3]  *movdi_internal/3
+	movq	%r8, %rsi	# 8572	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 8574	[c=0 l=5]  *call
+	movzbl	9(%rbp), %eax	# 8575	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, (%r12)	# 8576	[c=9 l=4]  *addsi_1/0
+	leaq	handler.1(%rip), %rdi	# 16575	[c=1 l=7]  *movdi_internal/4
+	movzbl	8(%rbp), %eax	# 8579	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 16573	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 8580	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbx,%rdx), %rdx	# 8583	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r12)	# 8584	[c=13 l=5]  *adddi_1/0
+	jmp	*(%rdi,%rax,8)	# 18506	[c=10 l=3]  *indirect_jump
+.L739:
+	movzbl	10(%rbp), %r14d	# 8592	[c=13 l=5]  zero_extendqidi2/0
+	xorl	%eax, %eax	# 18505	[c=4 l=2]  *movdi_xor
+	movq	%r12, %rdi	# 8601	[c=4 l=3]  *movdi_internal/3
+	movq	1040(%r12), %rdx	# 8594	[c=9 l=8]  *movdi_internal/3
+	leaq	.LC43(%rip), %rsi	# 8599	[c=1 l=7]  *movdi_internal/4
+	movzbl	(%rdx,%r14), %ecx	# 8595	[c=13 l=5]  *zero_extendqisi2/0
+	movzbl	%r14b, %edx	# 8596	[c=4 l=4]  *zero_extendqisi2/0
+	call	log_append@PLT	# 8603	[c=0 l=5]  *call
+	movq	1040(%r12), %r13	# 8604	[c=9 l=8]  *movdi_internal/3
+	movl	5176(%r12), %r9d	# 8607	[c=9 l=8]  *movsi_internal/0
+	movl	5180(%r12), %ecx	# 8608	[c=9 l=8]  *movsi_internal/0
+	movzbl	0(%r13,%r14), %eax	# 8605	[c=13 l=6]  *zero_extendqisi2/0
+	movl	%eax, 8(%rsp)	# 16576	[c=4 l=4]  *movsi_internal/1
+	movl	%eax, %r14d	# 17724	[c=4 l=3]  *movsi_internal/0
+	movl	$93, %eax	# 8609	[c=4 l=5]  *movsi_internal/0
+	subl	%r9d, %eax	# 8610	[c=4 l=3]  *subsi_1/0
+	cmpl	%ecx, %eax	# 8611	[c=4 l=2]  *cmpsi_1/0
+	jb	.L740	# 8612	[c=13 l=6]  *jcc
+	cmpb	$1, 1082(%r12)	# 8616	[c=13 l=9]  *cmpqi_1/0
+	ja	.L1374	# 8617	[c=13 l=6]  *jcc
+	movzbl	93(%r13), %r15d	# 13517	[c=13 l=5]  *zero_extendqisi2/0
+.L742:
+	movzbl	94(%r13), %eax	# 8652	[c=13 l=5]  *zero_extendqisi2/0
+.L744:
+	sall	$8, %eax	# 8655	[c=4 l=3]  *ashlsi3_1/0
+	movl	$93, %edx	# 8658	[c=4 l=5]  *movsi_internal/0
+	leaq	.LC32(%rip), %rsi	# 8659	[c=1 l=7]  *movdi_internal/4
+	movq	%r12, %rdi	# 8661	[c=4 l=3]  *movdi_internal/3
+	orl	%eax, %r15d	# 8656	[c=4 l=3]  *iorsi_1/0
+	movl	%r15d, %ecx	# 8657	[c=4 l=3]  *movsi_internal/0
+	call	log_add_data_mov@PLT	# 8662	[c=0 l=5]  *call
+	cmpl	996(%r12), %r15d	# 8664	[c=13 l=8]  *cmpsi_1/1
+	jb	.L1226	# 8665	[c=13 l=6]  *jcc
+	cmpl	$95, %r15d	# 14522	[c=4 l=4]  *cmpsi_1/0
+	movzbl	%r14b, %ecx	# 17266	[c=4 l=4]  *zero_extendqisi2/0
+	leal	-1(%r15), %r13d	# 17323	[c=4 l=4]  *leasi
+	movq	%r12, %rdi	# 8682	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC31(%rip), %rdx	# 15748	[c=1 l=7]  *movdi_internal/4
+	leaq	.LC30(%rip), %rsi	# 15747	[c=1 l=7]  *movdi_internal/4
+	cmovne	%rdx, %rsi	# 14523	[c=8 l=4]  *movdicc_noc/1
+	movl	%r15d, %edx	# 8680	[c=4 l=3]  *movsi_internal/0
+	call	log_add_data_mov@PLT	# 8683	[c=0 l=5]  *call
+	movl	%r15d, %edx	# 16577	[c=4 l=3]  *movsi_internal/0
+	subl	5176(%r12), %edx	# 8684	[c=13 l=8]  *subsi_1/1
+	cmpl	5180(%r12), %edx	# 8685	[c=13 l=8]  *cmpsi_1/1
+	jb	.L747	# 8686	[c=13 l=2]  *jcc
+	movl	%r15d, %edx	# 16579	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %edx	# 8688	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %edx	# 15657	[c=5 l=6]  *andsi_1_zext
+	cmpb	$0, 1080(%r12,%rdx)	# 8691	[c=14 l=9]  *cmpqi_ccno_1/1
+	jne	.L748	# 8692	[c=13 l=6]  *jcc
+.L747:
+	movq	1040(%r12), %rdx	# 8696	[c=9 l=8]  *movdi_internal/3
+	movslq	%r15d, %rax	# 8695	[c=4 l=3]  *extendsidi2_rex64/1
+	movb	%r14b, (%rdx,%rax)	# 8697	[c=4 l=4]  *movqi_internal/8
+.L749:
+	movzwl	%r13w, %r14d	# 8708	[c=4 l=4]  *zero_extendhisi2/0
+	movl	$93, %edx	# 8710	[c=4 l=5]  *movsi_internal/0
+	leaq	.LC33(%rip), %rsi	# 8711	[c=1 l=7]  *movdi_internal/4
+	movq	%r12, %rdi	# 8713	[c=4 l=3]  *movdi_internal/3
+	movl	%r14d, %ecx	# 8709	[c=4 l=3]  *movsi_internal/0
+	call	log_add_data_mov@PLT	# 8714	[c=0 l=5]  *call
+	movl	$93, %eax	# 8715	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r12), %eax	# 8716	[c=13 l=8]  *subsi_1/1
+	cmpl	5180(%r12), %eax	# 8717	[c=13 l=8]  *cmpsi_1/1
+	jb	.L750	# 8718	[c=13 l=2]  *jcc
+	cmpb	$1, 1082(%r12)	# 8722	[c=13 l=9]  *cmpqi_1/0
+	ja	.L1375	# 8723	[c=13 l=6]  *jcc
+.L750:
+	movq	1040(%r12), %rax	# 8734	[c=9 l=8]  *movdi_internal/3
+	movb	%r13b, 93(%rax)	# 8735	[c=4 l=4]  *movqi_internal/8
+.L751:
+	movl	$94, %eax	# 8739	[c=4 l=5]  *movsi_internal/0
+	sarl	$8, %r14d	# 8738	[c=4 l=4]  *ashrsi3_1/0
+	subl	5176(%r12), %eax	# 8740	[c=13 l=8]  *subsi_1/1
+	cmpl	5180(%r12), %eax	# 8741	[c=13 l=8]  *cmpsi_1/1
+	jb	.L752	# 8742	[c=13 l=2]  *jcc
+	cmpb	$1, 1082(%r12)	# 8746	[c=13 l=9]  *cmpqi_1/0
+	ja	.L1376	# 8747	[c=13 l=6]  *jcc
+.L752:
+	movq	1040(%r12), %rax	# 8757	[c=9 l=8]  *movdi_internal/3
+	movb	%r14b, 94(%rax)	# 8758	[c=4 l=4]  *movqi_internal/8
+.L753:
+	movq	%rbp, %rsi	# 8761	[c=4 l=3]  *movdi_internal/3
+	movq	%r12, %rdi	# 8762	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 8763	[c=0 l=5]  *call
+	movq	40(%r12), %rax	# 16581	[c=9 l=5]  *movdi_internal/3
+	movq	(%rsp), %rcx	# 16582	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 8765	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rcx), %rdx	# 17322	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r12)	# 8766	[c=4 l=5]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 8768	[c=4 l=3]  *cmpdi_1/0
+	jb	.L297	# 8769	[c=13 l=6]  *jcc
+	movl	(%r12), %r8d	# 8771	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r12, %rdi	# 8776	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r8	# 8772	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r12), %r8	# 8774	[c=13 l=8]  *adddi_1/1
+	movq	%r8, %rbp	# 16584	[c=4 l=3]  *movdi_internal/3
+	movq	%r8, %rsi	# 8775	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 8777	[c=0 l=5]  *call
+	movzbl	9(%rbp), %eax	# 8778	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, (%r12)	# 8779	[c=9 l=4]  *addsi_1/0
+	leaq	handler.1(%rip), %rdi	# 16587	[c=1 l=7]  *movdi_internal/4
+	movzbl	8(%rbp), %eax	# 8782	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 16585	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 8783	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbx,%rdx), %rdx	# 8786	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r12)	# 8787	[c=13 l=5]  *adddi_1/0
+	jmp	*(%rdi,%rax,8)	# 18504	[c=10 l=3]  *indirect_jump
+.L754:
+	movzwl	12(%rbp), %eax	# 8795	[c=9 l=4]  *movhi_internal/2
+	movl	5176(%r12), %r14d	# 8796	[c=9 l=8]  *movsi_internal/0
+	movl	5180(%r12), %r13d	# 8797	[c=9 l=8]  *movsi_internal/0
+	movw	%ax, 8(%rsp)	# 16588	[c=4 l=5]  *movhi_internal/3
+	movl	$93, %eax	# 8798	[c=4 l=5]  *movsi_internal/0
+	subl	%r14d, %eax	# 8799	[c=4 l=3]  *subsi_1/0
+	cmpl	%r13d, %eax	# 8800	[c=4 l=3]  *cmpsi_1/0
+	jb	.L755	# 8801	[c=13 l=6]  *jcc
+	cmpb	$1, 1082(%r12)	# 8805	[c=13 l=9]  *cmpqi_1/0
+	ja	.L1377	# 8806	[c=13 l=6]  *jcc
+	movq	1040(%r12), %rax	# 13522	[c=9 l=8]  *movdi_internal/3
+	movzbl	93(%rax), %r15d	# 13523	[c=13 l=5]  *zero_extendqisi2/0
+.L757:
+	movzbl	94(%rax), %eax	# 8843	[c=13 l=4]  *zero_extendqisi2/0
+.L759:
+	sall	$8, %eax	# 8846	[c=4 l=3]  *ashlsi3_1/0
+	movl	$93, %edx	# 8849	[c=4 l=5]  *movsi_internal/0
+	leaq	.LC32(%rip), %rsi	# 8850	[c=1 l=7]  *movdi_internal/4
+	movq	%r12, %rdi	# 8852	[c=4 l=3]  *movdi_internal/3
+	orl	%eax, %r15d	# 8847	[c=4 l=3]  *iorsi_1/0
+	movl	%r15d, %ecx	# 8848	[c=4 l=3]  *movsi_internal/0
+	call	log_add_data_mov@PLT	# 8853	[c=0 l=5]  *call
+	movl	996(%r12), %ecx	# 8855	[c=9 l=8]  *movsi_internal/0
+	movzbl	840(%r12), %edx	# 8857	[c=13 l=9]  *zero_extendqisi2/0
+	leal	1(%rcx,%rdx), %edx	# 8858	[c=5 l=4]  *leasi
+	cmpl	%edx, %r15d	# 8859	[c=4 l=3]  *cmpsi_1/0
+	jb	.L1226	# 8860	[c=13 l=6]  *jcc
+	cmpl	$95, %r15d	# 14534	[c=4 l=4]  *cmpsi_1/0
+	movl	(%r12), %r13d	# 8868	[c=5 l=4]  *movsi_internal/0
+	movq	%r12, %rdi	# 8879	[c=4 l=3]  *movdi_internal/3
+	leal	-1(%r15), %r14d	# 17321	[c=4 l=4]  *leasi
+	leaq	.LC31(%rip), %rdx	# 15750	[c=1 l=7]  *movdi_internal/4
+	leaq	.LC30(%rip), %rsi	# 15749	[c=1 l=7]  *movdi_internal/4
+	cmovne	%rdx, %rsi	# 14535	[c=8 l=4]  *movdicc_noc/1
+	movzbl	%r13b, %ecx	# 8870	[c=4 l=4]  *zero_extendqisi2/0
+	movl	%r15d, %edx	# 8877	[c=4 l=3]  *movsi_internal/0
+	call	log_add_data_mov@PLT	# 8880	[c=0 l=5]  *call
+	movl	%r15d, %edx	# 16589	[c=4 l=3]  *movsi_internal/0
+	subl	5176(%r12), %edx	# 8881	[c=13 l=8]  *subsi_1/1
+	cmpl	5180(%r12), %edx	# 8882	[c=13 l=8]  *cmpsi_1/1
+	jb	.L762	# 8883	[c=13 l=2]  *jcc
+	movl	%r15d, %edx	# 16591	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %edx	# 8885	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %edx	# 15656	[c=5 l=6]  *andsi_1_zext
+	cmpb	$0, 1080(%r12,%rdx)	# 8888	[c=14 l=9]  *cmpqi_ccno_1/1
+	jne	.L763	# 8889	[c=13 l=6]  *jcc
+.L762:
+	movq	1040(%r12), %rcx	# 8893	[c=9 l=8]  *movdi_internal/3
+	movslq	%r15d, %rdx	# 8892	[c=4 l=3]  *extendsidi2_rex64/1
+	movb	%r13b, (%rcx,%rdx)	# 8894	[c=4 l=4]  *movqi_internal/8
+.L764:
+	movl	(%r12), %ecx	# 8905	[c=5 l=4]  *movsi_internal/0
+	leaq	.LC31(%rip), %rdx	# 15752	[c=1 l=7]  *movdi_internal/4
+	movq	%r12, %rdi	# 8917	[c=4 l=3]  *movdi_internal/3
+	leal	-2(%r15), %r13d	# 17320	[c=4 l=4]  *leasi
+	leaq	.LC30(%rip), %rsi	# 15751	[c=1 l=7]  *movdi_internal/4
+	movl	%ecx, %eax	# 16593	[c=4 l=2]  *movsi_internal/0
+	movzbl	%ch, %ecx	# 8908	[c=4 l=3]  *extzvsi
+	shrl	$8, %eax	# 8906	[c=4 l=3]  *lshrsi3_1/0
+	cmpl	$95, %r14d	# 14546	[c=4 l=4]  *cmpsi_1/0
+	cmovne	%rdx, %rsi	# 14547	[c=8 l=4]  *movdicc_noc/1
+	movl	%r14d, %edx	# 8915	[c=4 l=3]  *movsi_internal/0
+	movl	%eax, 16(%rsp)	# 16594	[c=4 l=4]  *movsi_internal/1
+	call	log_add_data_mov@PLT	# 8918	[c=0 l=5]  *call
+	movl	%r14d, %edx	# 16595	[c=4 l=3]  *movsi_internal/0
+	subl	5176(%r12), %edx	# 8919	[c=13 l=8]  *subsi_1/1
+	cmpl	5180(%r12), %edx	# 8920	[c=13 l=8]  *cmpsi_1/1
+	jb	.L766	# 8921	[c=13 l=2]  *jcc
+	movl	%r14d, %edx	# 16597	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %edx	# 8923	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %edx	# 15655	[c=5 l=6]  *andsi_1_zext
+	cmpb	$0, 1080(%r12,%rdx)	# 8926	[c=14 l=9]  *cmpqi_ccno_1/1
+	jne	.L767	# 8927	[c=13 l=6]  *jcc
+.L766:
+	movq	1040(%r12), %rdx	# 8931	[c=9 l=8]  *movdi_internal/3
+	movzbl	16(%rsp), %eax	# 16599	[c=9 l=5]  *movqi_internal/4
+	movslq	%r14d, %r9	# 8930	[c=4 l=3]  *extendsidi2_rex64/1
+	movb	%al, (%rdx,%r9)	# 8932	[c=4 l=4]  *movqi_internal/8
+.L768:
+	cmpb	$0, 840(%r12)	# 8943	[c=13 l=9]  *cmpqi_ccno_1/1
+	je	.L769	# 8944	[c=13 l=2]  *jcc
+	movl	(%r12), %r9d	# 16600	[c=5 l=4]  *movsi_internal/0
+	subl	$3, %r15d	# 8948	[c=4 l=4]  *addsi_1/0
+	movl	%r13d, %edx	# 8956	[c=4 l=3]  *movsi_internal/0
+	movq	%r12, %rdi	# 8958	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC31(%rip), %rax	# 15754	[c=1 l=7]  *movdi_internal/4
+	leaq	.LC30(%rip), %rsi	# 15753	[c=1 l=7]  *movdi_internal/4
+	shrl	$16, %r9d	# 8947	[c=4 l=4]  *lshrsi3_1/0
+	cmpl	$95, %r13d	# 14558	[c=4 l=4]  *cmpsi_1/0
+	cmovne	%rax, %rsi	# 14559	[c=8 l=4]  *movdicc_noc/1
+	movzbl	%r9b, %ecx	# 8949	[c=4 l=4]  *zero_extendqisi2/0
+	movl	%r9d, 16(%rsp)	# 17168	[c=4 l=5]  *movsi_internal/1
+	call	log_add_data_mov@PLT	# 8959	[c=0 l=5]  *call
+	movl	%r13d, %eax	# 16602	[c=4 l=3]  *movsi_internal/0
+	subl	5176(%r12), %eax	# 8960	[c=13 l=8]  *subsi_1/1
+	cmpl	5180(%r12), %eax	# 8961	[c=13 l=8]  *cmpsi_1/1
+	movl	16(%rsp), %r9d	# 17169	[c=9 l=5]  *movsi_internal/0
+	jb	.L771	# 8962	[c=13 l=2]  *jcc
+	movl	%r13d, %eax	# 16604	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %eax	# 8964	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 15654	[c=5 l=5]  *andsi_1_zext
+	cmpb	$0, 1080(%r12,%rax)	# 8967	[c=14 l=9]  *cmpqi_ccno_1/1
+	jne	.L772	# 8968	[c=13 l=6]  *jcc
+.L771:
+	movq	1040(%r12), %rax	# 8972	[c=9 l=8]  *movdi_internal/3
+	movslq	%r13d, %r13	# 8971	[c=4 l=3]  *extendsidi2_rex64/1
+	movb	%r9b, (%rax,%r13)	# 8973	[c=4 l=4]  *movqi_internal/8
+.L773:
+	movl	%r15d, %r13d	# 69	[c=4 l=3]  *movsi_internal/0
+.L769:
+	movzwl	%r13w, %r15d	# 8988	[c=4 l=4]  *zero_extendhisi2/0
+	movl	$93, %edx	# 8990	[c=4 l=5]  *movsi_internal/0
+	leaq	.LC33(%rip), %rsi	# 8991	[c=1 l=7]  *movdi_internal/4
+	movq	%r12, %rdi	# 8993	[c=4 l=3]  *movdi_internal/3
+	movl	%r15d, %ecx	# 8989	[c=4 l=3]  *movsi_internal/0
+	call	log_add_data_mov@PLT	# 8994	[c=0 l=5]  *call
+	movl	$93, %eax	# 8995	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r12), %eax	# 8996	[c=13 l=8]  *subsi_1/1
+	cmpl	5180(%r12), %eax	# 8997	[c=13 l=8]  *cmpsi_1/1
+	jb	.L774	# 8998	[c=13 l=2]  *jcc
+	cmpb	$1, 1082(%r12)	# 9002	[c=13 l=9]  *cmpqi_1/0
+	ja	.L1378	# 9003	[c=13 l=6]  *jcc
+.L774:
+	movq	1040(%r12), %rax	# 9014	[c=9 l=8]  *movdi_internal/3
+	movb	%r13b, 93(%rax)	# 9015	[c=4 l=4]  *movqi_internal/8
+.L775:
+	movl	$94, %eax	# 9019	[c=4 l=5]  *movsi_internal/0
+	sarl	$8, %r15d	# 9018	[c=4 l=4]  *ashrsi3_1/0
+	subl	5176(%r12), %eax	# 9020	[c=13 l=8]  *subsi_1/1
+	cmpl	5180(%r12), %eax	# 9021	[c=13 l=8]  *cmpsi_1/1
+	jb	.L776	# 9022	[c=13 l=2]  *jcc
+	cmpb	$1, 1082(%r12)	# 9026	[c=13 l=9]  *cmpqi_1/0
+	ja	.L1379	# 9027	[c=13 l=6]  *jcc
+.L776:
+	movq	1040(%r12), %rax	# 9037	[c=9 l=8]  *movdi_internal/3
+	movb	%r15b, 94(%rax)	# 9038	[c=4 l=4]  *movqi_internal/8
+.L777:
+	movswl	8(%rsp), %eax	# 9041	[c=13 l=5]  extendhisi2/1
+	addl	(%r12), %eax	# 9043	[c=9 l=4]  *addsi_1/1
+	movq	%rbp, %rsi	# 9050	[c=4 l=3]  *movdi_internal/3
+	movq	%r12, %rdi	# 9051	[c=4 l=3]  *movdi_internal/3
+	andl	992(%r12), %eax	# 9046	[c=13 l=8]  *andsi_1/1
+	movl	%eax, (%r12)	# 9047	[c=4 l=4]  *movsi_internal/1
+	movzbl	840(%r12), %eax	# 9048	[c=13 l=9]  zero_extendqidi2/0
+	addq	%rax, 48(%r12)	# 9049	[c=13 l=5]  *adddi_1/0
+	call	log_dump_line@PLT	# 9052	[c=0 l=5]  *call
+	movq	40(%r12), %rax	# 16607	[c=9 l=5]  *movdi_internal/3
+	movq	(%rsp), %rcx	# 16608	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 9054	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rcx), %rdx	# 17319	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r12)	# 9055	[c=4 l=5]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 9057	[c=4 l=3]  *cmpdi_1/0
+	jb	.L297	# 9058	[c=13 l=6]  *jcc
+	movq	56(%r12), %rax	# 16609	[c=9 l=5]  *movdi_internal/3
+	cmpq	%rax, 48(%r12)	# 9061	[c=13 l=5]  *cmpdi_1/0
+	jnb	.L1380	# 9062	[c=13 l=6]  *jcc
+.L778:
+	movq	%r12, %rdi	# 9068	[c=4 l=3]  *movdi_internal/3
+	call	log_is_idle@PLT	# 9069	[c=10 l=5]  *call_value
+	testb	%al, %al	# 9071	[c=4 l=2]  *cmpqi_ccno_1/0
+	jne	.L1381	# 9072	[c=13 l=6]  *jcc
+.L779:
+	movl	(%r12), %r8d	# 9083	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r12, %rdi	# 9088	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r8	# 9084	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r12), %r8	# 9086	[c=13 l=8]  *adddi_1/1
+	movq	%r8, %rbp	# 16611	[c=4 l=3]  *movdi_internal/3
+	movq	%r8, %rsi	# 9087	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 9089	[c=0 l=5]  *call
+	movzbl	9(%rbp), %eax	# 9090	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, (%r12)	# 9091	[c=9 l=4]  *addsi_1/0
+	leaq	handler.1(%rip), %rdi	# 16614	[c=1 l=7]  *movdi_internal/4
+	movzbl	8(%rbp), %eax	# 9094	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 16612	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 9095	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbx,%rdx), %rdx	# 9098	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r12)	# 9099	[c=13 l=5]  *adddi_1/0
+	jmp	*(%rdi,%rax,8)	# 18503	[c=10 l=3]  *indirect_jump
+.L780:
+	movl	5176(%r12), %r14d	# 9107	[c=9 l=8]  *movsi_internal/0
+	movl	$93, %eax	# 9109	[c=4 l=5]  *movsi_internal/0
+	movl	5180(%r12), %r13d	# 9108	[c=9 l=8]  *movsi_internal/0
+	subl	%r14d, %eax	# 9110	[c=4 l=3]  *subsi_1/0
+	cmpl	%r13d, %eax	# 9111	[c=4 l=3]  *cmpsi_1/0
+	jb	.L781	# 9112	[c=13 l=6]  *jcc
+	cmpb	$1, 1082(%r12)	# 9116	[c=13 l=9]  *cmpqi_1/0
+	ja	.L1382	# 9117	[c=13 l=6]  *jcc
+	movq	1040(%r12), %rax	# 13528	[c=9 l=8]  *movdi_internal/3
+	movzbl	93(%rax), %r15d	# 13529	[c=13 l=5]  *zero_extendqisi2/0
+.L783:
+	movzbl	94(%rax), %eax	# 9154	[c=13 l=4]  *zero_extendqisi2/0
+.L785:
+	sall	$8, %eax	# 9157	[c=4 l=3]  *ashlsi3_1/0
+	movl	$93, %edx	# 9160	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 9163	[c=4 l=3]  *movdi_internal/3
+	xorl	%r14d, %r14d	# 18502	[c=4 l=3]  *movdi_xor
+	orl	%eax, %r15d	# 9158	[c=4 l=3]  *iorsi_1/0
+	leaq	.LC32(%rip), %rsi	# 9161	[c=1 l=7]  *movdi_internal/4
+	movl	%r15d, %ecx	# 9159	[c=4 l=3]  *movsi_internal/0
+	call	log_add_data_mov@PLT	# 9164	[c=0 l=5]  *call
+	cmpb	$0, 840(%r12)	# 9165	[c=13 l=9]  *cmpqi_ccno_1/1
+	je	.L786	# 9166	[c=13 l=2]  *jcc
+	addl	$1, %r15d	# 9168	[c=4 l=4]  *addsi_1/0
+	movl	%r15d, %eax	# 16615	[c=4 l=3]  *movsi_internal/0
+	subl	5176(%r12), %eax	# 9169	[c=13 l=8]  *subsi_1/1
+	cmpl	5180(%r12), %eax	# 9170	[c=13 l=8]  *cmpsi_1/1
+	jb	.L787	# 9171	[c=13 l=2]  *jcc
+	movl	%r15d, %eax	# 16617	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %eax	# 9173	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 15653	[c=5 l=5]  *andsi_1_zext
+	cmpb	$0, 1080(%r12,%rax)	# 9176	[c=14 l=9]  *cmpqi_ccno_1/1
+	jne	.L788	# 9177	[c=13 l=6]  *jcc
+.L787:
+	movq	1040(%r12), %rdx	# 9181	[c=9 l=8]  *movdi_internal/3
+	movslq	%r15d, %rax	# 9180	[c=4 l=3]  *extendsidi2_rex64/1
+	movzbl	(%rdx,%rax), %r14d	# 9182	[c=13 l=5]  *zero_extendqisi2/0
+.L789:
+	cmpl	$95, %r15d	# 14570	[c=4 l=4]  *cmpsi_1/0
+	movl	%r14d, %ecx	# 9198	[c=4 l=3]  *movsi_internal/0
+	movl	%r15d, %edx	# 9199	[c=4 l=3]  *movsi_internal/0
+	movq	%r12, %rdi	# 9201	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC29(%rip), %rax	# 15756	[c=1 l=7]  *movdi_internal/4
+	leaq	.LC28(%rip), %rsi	# 15755	[c=1 l=7]  *movdi_internal/4
+	cmovne	%rax, %rsi	# 14571	[c=8 l=4]  *movdicc_noc/1
+	sall	$16, %r14d	# 9203	[c=4 l=4]  *ashlsi3_1/0
+	call	log_add_data_mov@PLT	# 9202	[c=0 l=5]  *call
+.L786:
+	leal	1(%r15), %edx	# 17318	[c=4 l=4]  *leasi
+	movl	%edx, %eax	# 16619	[c=4 l=2]  *movsi_internal/0
+	subl	5176(%r12), %eax	# 9207	[c=13 l=8]  *subsi_1/1
+	cmpl	5180(%r12), %eax	# 9208	[c=13 l=8]  *cmpsi_1/1
+	jb	.L791	# 9209	[c=13 l=2]  *jcc
+	movl	%edx, %eax	# 16621	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %eax	# 9211	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 15652	[c=5 l=5]  *andsi_1_zext
+	cmpb	$0, 1080(%r12,%rax)	# 9214	[c=14 l=9]  *cmpqi_ccno_1/1
+	jne	.L792	# 9215	[c=13 l=6]  *jcc
+.L791:
+	movq	1040(%r12), %rcx	# 9219	[c=9 l=8]  *movdi_internal/3
+	movslq	%edx, %rax	# 9218	[c=4 l=3]  *extendsidi2_rex64/1
+	movzbl	(%rcx,%rax), %r13d	# 9220	[c=13 l=5]  *zero_extendqisi2/0
+.L793:
+	cmpl	$95, %edx	# 14582	[c=4 l=3]  *cmpsi_1/0
+	leaq	.LC29(%rip), %rax	# 15758	[c=1 l=7]  *movdi_internal/4
+	movl	%r13d, %ecx	# 9236	[c=4 l=3]  *movsi_internal/0
+	movq	%r12, %rdi	# 9239	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC28(%rip), %rsi	# 15757	[c=1 l=7]  *movdi_internal/4
+	cmovne	%rax, %rsi	# 14583	[c=8 l=4]  *movdicc_noc/1
+	sall	$8, %r13d	# 9241	[c=4 l=4]  *ashlsi3_1/0
+	addl	$2, %r15d	# 9243	[c=4 l=4]  *addsi_1/0
+	orl	%r14d, %r13d	# 9242	[c=4 l=3]  *iorsi_1/0
+	call	log_add_data_mov@PLT	# 9240	[c=0 l=5]  *call
+	movl	%r15d, %eax	# 16623	[c=4 l=3]  *movsi_internal/0
+	subl	5176(%r12), %eax	# 9244	[c=13 l=8]  *subsi_1/1
+	cmpl	5180(%r12), %eax	# 9245	[c=13 l=8]  *cmpsi_1/1
+	jb	.L795	# 9246	[c=13 l=2]  *jcc
+	movl	%r15d, %eax	# 16625	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %eax	# 9248	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 15651	[c=5 l=5]  *andsi_1_zext
+	cmpb	$0, 1080(%r12,%rax)	# 9251	[c=14 l=9]  *cmpqi_ccno_1/1
+	jne	.L796	# 9252	[c=13 l=6]  *jcc
+.L795:
+	movq	1040(%r12), %rdx	# 9256	[c=9 l=8]  *movdi_internal/3
+	movslq	%r15d, %rax	# 9255	[c=4 l=3]  *extendsidi2_rex64/1
+	movzbl	(%rdx,%rax), %r14d	# 9257	[c=13 l=5]  *zero_extendqisi2/0
+.L797:
+	cmpl	$95, %r15d	# 14594	[c=4 l=4]  *cmpsi_1/0
+	movl	%r14d, %ecx	# 9273	[c=4 l=3]  *movsi_internal/0
+	movl	%r15d, %edx	# 9274	[c=4 l=3]  *movsi_internal/0
+	movq	%r12, %rdi	# 9276	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC29(%rip), %rax	# 15760	[c=1 l=7]  *movdi_internal/4
+	leaq	.LC28(%rip), %rsi	# 15759	[c=1 l=7]  *movdi_internal/4
+	cmovne	%rax, %rsi	# 14595	[c=8 l=4]  *movdicc_noc/1
+	orl	%r14d, %r13d	# 9278	[c=4 l=3]  *iorsi_1/0
+	call	log_add_data_mov@PLT	# 9277	[c=0 l=5]  *call
+	cmpl	%r13d, 992(%r12)	# 9279	[c=13 l=8]  *cmpsi_1/0
+	jb	.L1224	# 9280	[c=13 l=6]  *jcc
+	movzwl	%r15w, %r14d	# 9288	[c=4 l=4]  *zero_extendhisi2/0
+	movl	$93, %edx	# 9290	[c=4 l=5]  *movsi_internal/0
+	leaq	.LC33(%rip), %rsi	# 9291	[c=1 l=7]  *movdi_internal/4
+	movq	%r12, %rdi	# 9293	[c=4 l=3]  *movdi_internal/3
+	movl	%r14d, %ecx	# 9289	[c=4 l=3]  *movsi_internal/0
+	call	log_add_data_mov@PLT	# 9294	[c=0 l=5]  *call
+	movl	$93, %eax	# 9295	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r12), %eax	# 9296	[c=13 l=8]  *subsi_1/1
+	cmpl	5180(%r12), %eax	# 9297	[c=13 l=8]  *cmpsi_1/1
+	jb	.L800	# 9298	[c=13 l=2]  *jcc
+	cmpb	$1, 1082(%r12)	# 9302	[c=13 l=9]  *cmpqi_1/0
+	ja	.L1383	# 9303	[c=13 l=6]  *jcc
+.L800:
+	movq	1040(%r12), %rax	# 9314	[c=9 l=8]  *movdi_internal/3
+	movb	%r15b, 93(%rax)	# 9315	[c=4 l=4]  *movqi_internal/8
+.L801:
+	movl	$94, %eax	# 9319	[c=4 l=5]  *movsi_internal/0
+	sarl	$8, %r14d	# 9318	[c=4 l=4]  *ashrsi3_1/0
+	subl	5176(%r12), %eax	# 9320	[c=13 l=8]  *subsi_1/1
+	cmpl	5180(%r12), %eax	# 9321	[c=13 l=8]  *cmpsi_1/1
+	jb	.L802	# 9322	[c=13 l=2]  *jcc
+	cmpb	$1, 1082(%r12)	# 9326	[c=13 l=9]  *cmpqi_1/0
+	ja	.L1384	# 9327	[c=13 l=6]  *jcc
+.L802:
+	movq	1040(%r12), %rax	# 9337	[c=9 l=8]  *movdi_internal/3
+	movb	%r14b, 94(%rax)	# 9338	[c=4 l=4]  *movqi_internal/8
+.L803:
+	movzbl	840(%r12), %eax	# 9342	[c=13 l=9]  zero_extendqidi2/0
+	addq	%rax, 48(%r12)	# 9343	[c=13 l=5]  *adddi_1/0
+	movq	%rbp, %rsi	# 9344	[c=4 l=3]  *movdi_internal/3
+	movq	%r12, %rdi	# 9345	[c=4 l=3]  *movdi_internal/3
+	movl	%r13d, (%r12)	# 9341	[c=4 l=4]  *movsi_internal/1
+	call	log_dump_line@PLT	# 9346	[c=0 l=5]  *call
+	movq	40(%r12), %rax	# 16627	[c=9 l=5]  *movdi_internal/3
+	movq	(%rsp), %rcx	# 16628	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 9348	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rcx), %rdx	# 17317	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r12)	# 9349	[c=4 l=5]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 9351	[c=4 l=3]  *cmpdi_1/0
+	jb	.L297	# 9352	[c=13 l=6]  *jcc
+	movq	56(%r12), %rax	# 16629	[c=9 l=5]  *movdi_internal/3
+	cmpq	%rax, 48(%r12)	# 9355	[c=13 l=5]  *cmpdi_1/0
+	jnb	.L1385	# 9356	[c=13 l=6]  *jcc
+.L804:
+	movq	%r12, %rdi	# 9362	[c=4 l=3]  *movdi_internal/3
+	call	log_is_idle@PLT	# 9363	[c=10 l=5]  *call_value
+	testb	%al, %al	# 9365	[c=4 l=2]  *cmpqi_ccno_1/0
+	jne	.L1386	# 9366	[c=13 l=6]  *jcc
+.L805:
+	movl	(%r12), %r8d	# 9377	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r12, %rdi	# 9382	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r8	# 9378	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r12), %r8	# 9380	[c=13 l=8]  *adddi_1/1
+	movq	%r8, %rbp	# 16631	[c=4 l=3]  *movdi_internal/3
+	movq	%r8, %rsi	# 9381	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 9383	[c=0 l=5]  *call
+	movzbl	9(%rbp), %eax	# 9384	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, (%r12)	# 9385	[c=9 l=4]  *addsi_1/0
+	leaq	handler.1(%rip), %rdi	# 16634	[c=1 l=7]  *movdi_internal/4
+	movzbl	8(%rbp), %eax	# 9388	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 16632	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 9389	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbx,%rdx), %rdx	# 9392	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r12)	# 9393	[c=13 l=5]  *adddi_1/0
+	jmp	*(%rdi,%rax,8)	# 18501	[c=10 l=3]  *indirect_jump
+.L842:
+	movq	1040(%r12), %rcx	# 9834	[c=9 l=8]  *movdi_internal/3
+	movzbl	10(%rbp), %edx	# 9832	[c=13 l=4]  zero_extendqidi2/0
+	leaq	.LC43(%rip), %rsi	# 9843	[c=1 l=7]  *movdi_internal/4
+	movq	%r12, %rdi	# 9845	[c=4 l=3]  *movdi_internal/3
+	movzbl	95(%rcx), %eax	# 9835	[c=9 l=4]  *movqi_internal/4
+	movzbl	(%rcx,%rdx), %ecx	# 9840	[c=13 l=4]  *zero_extendqisi2/0
+	movq	%rdx, %r15	# 17725	[c=4 l=3]  *movdi_internal/3
+	movl	%edx, 8(%rsp)	# 17174	[c=4 l=4]  *movsi_internal/1
+	andl	$1, %eax	# 9837	[c=4 l=3]  *andsi_1/0
+	sall	$8, %eax	# 9838	[c=4 l=3]  *ashlsi3_1/0
+	movl	%eax, %r13d	# 16668	[c=4 l=3]  *movsi_internal/0
+	xorl	%eax, %eax	# 18494	[c=4 l=2]  *movdi_xor
+	call	log_append@PLT	# 9847	[c=0 l=5]  *call
+	movq	1040(%r12), %rax	# 9848	[c=9 l=8]  *movdi_internal/3
+	movl	8(%rsp), %edx	# 17175	[c=9 l=4]  *movsi_internal/0
+	movq	%r12, %rdi	# 9856	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC59(%rip), %rsi	# 9854	[c=1 l=7]  *movdi_internal/4
+	movzbl	(%rax,%r15), %r14d	# 9849	[c=13 l=5]  *zero_extendqisi2/0
+	xorl	%eax, %eax	# 18495	[c=4 l=2]  *movdi_xor
+	orl	%r13d, %r14d	# 9850	[c=4 l=3]  *iorsi_1/0
+	movl	%r14d, %r13d	# 16669	[c=4 l=3]  *movsi_internal/0
+	sarl	%r13d	# 9851	[c=4 l=3]  *ashrsi3_1/0
+	movl	%r13d, %ecx	# 9852	[c=4 l=3]  *movsi_internal/0
+	call	log_append@PLT	# 9858	[c=0 l=5]  *call
+	movq	1040(%r12), %rax	# 9859	[c=9 l=8]  *movdi_internal/3
+	movb	%r13b, (%rax,%r15)	# 9860	[c=4 l=4]  *movqi_internal/8
+	movl	$95, %eax	# 9861	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r12), %eax	# 9862	[c=13 l=8]  *subsi_1/1
+	cmpl	5180(%r12), %eax	# 9863	[c=13 l=8]  *cmpsi_1/1
+	jb	.L843	# 9864	[c=13 l=2]  *jcc
+	cmpb	$0, 1082(%r12)	# 9866	[c=13 l=9]  *cmpqi_ccno_1/1
+	jne	.L844	# 9867	[c=13 l=6]  *jcc
+.L843:
+	movq	1040(%r12), %rax	# 9870	[c=9 l=8]  *movdi_internal/3
+	movzbl	95(%rax), %r13d	# 9871	[c=13 l=5]  *zero_extendqisi2/0
+.L845:
+	movl	%r13d, %ecx	# 9882	[c=4 l=3]  *movsi_internal/0
+	movl	$95, %edx	# 9883	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 9886	[c=4 l=3]  *movdi_internal/3
+	movslq	%r14d, %r14	# 9890	[c=4 l=3]  *extendsidi2_rex64/1
+	leaq	.LC28(%rip), %rsi	# 9884	[c=1 l=7]  *movdi_internal/4
+	andl	$-32, %r13d	# 9888	[c=4 l=4]  *andsi_1/0
+	call	log_add_data_mov@PLT	# 9887	[c=0 l=5]  *call
+	leaq	flag_update_table_ror8(%rip), %rax	# 15689	[c=1 l=7]  *movdi_internal/4
+	movl	$95, %edx	# 9895	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 9898	[c=4 l=3]  *movdi_internal/3
+	movzbl	(%rax,%r14), %eax	# 9891	[c=13 l=5]  *zero_extendqisi2/0
+	leaq	.LC30(%rip), %rsi	# 9896	[c=1 l=7]  *movdi_internal/4
+	orl	%eax, %r13d	# 9892	[c=4 l=3]  *iorsi_1/0
+	movzbl	%r13b, %ecx	# 9893	[c=4 l=4]  *zero_extendqisi2/0
+	call	log_add_data_mov@PLT	# 9899	[c=0 l=5]  *call
+	movl	$95, %eax	# 9900	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r12), %eax	# 9901	[c=13 l=8]  *subsi_1/1
+	cmpl	5180(%r12), %eax	# 9902	[c=13 l=8]  *cmpsi_1/1
+	jb	.L846	# 9903	[c=13 l=2]  *jcc
+	cmpb	$0, 1082(%r12)	# 9905	[c=13 l=9]  *cmpqi_ccno_1/1
+	jne	.L847	# 9906	[c=13 l=6]  *jcc
+.L846:
+	movq	1040(%r12), %rax	# 9909	[c=9 l=8]  *movdi_internal/3
+	movb	%r13b, 95(%rax)	# 9910	[c=4 l=4]  *movqi_internal/8
+.L848:
+	movq	%rbp, %rsi	# 9921	[c=4 l=3]  *movdi_internal/3
+	movq	%r12, %rdi	# 9922	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 9923	[c=0 l=5]  *call
+	movq	40(%r12), %rax	# 16671	[c=9 l=5]  *movdi_internal/3
+	movq	(%rsp), %rcx	# 16672	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 9925	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rcx), %rdx	# 17307	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r12)	# 9926	[c=4 l=5]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 9928	[c=4 l=3]  *cmpdi_1/0
+	jb	.L297	# 9929	[c=13 l=6]  *jcc
+	movl	(%r12), %r8d	# 9931	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r12, %rdi	# 9936	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r8	# 9932	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r12), %r8	# 9934	[c=13 l=8]  *adddi_1/1
+	movq	%r8, %rbp	# 16674	[c=4 l=3]  *movdi_internal/3
+	movq	%r8, %rsi	# 9935	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 9937	[c=0 l=5]  *call
+	movzbl	9(%rbp), %eax	# 9938	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, (%r12)	# 9939	[c=9 l=4]  *addsi_1/0
+	leaq	handler.1(%rip), %rdi	# 16677	[c=1 l=7]  *movdi_internal/4
+	movzbl	8(%rbp), %eax	# 9942	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 16675	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 9943	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbx,%rdx), %rdx	# 9946	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r12)	# 9947	[c=13 l=5]  *adddi_1/0
+	jmp	*(%rdi,%rax,8)	# 18493	[c=10 l=3]  *indirect_jump
+.L806:
+	movl	5176(%r12), %r14d	# 9401	[c=9 l=8]  *movsi_internal/0
+	movl	$93, %eax	# 9403	[c=4 l=5]  *movsi_internal/0
+	movl	5180(%r12), %r13d	# 9402	[c=9 l=8]  *movsi_internal/0
+	subl	%r14d, %eax	# 9404	[c=4 l=3]  *subsi_1/0
+	cmpl	%r13d, %eax	# 9405	[c=4 l=3]  *cmpsi_1/0
+	jb	.L807	# 9406	[c=13 l=6]  *jcc
+	cmpb	$1, 1082(%r12)	# 9410	[c=13 l=9]  *cmpqi_1/0
+	ja	.L1387	# 9411	[c=13 l=6]  *jcc
+	movq	1040(%r12), %rax	# 13534	[c=9 l=8]  *movdi_internal/3
+	movzbl	93(%rax), %r15d	# 13535	[c=13 l=5]  *zero_extendqisi2/0
+.L809:
+	movzbl	94(%rax), %eax	# 9448	[c=13 l=4]  *zero_extendqisi2/0
+.L811:
+	sall	$8, %eax	# 9451	[c=4 l=3]  *ashlsi3_1/0
+	movl	$93, %edx	# 9454	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 9457	[c=4 l=3]  *movdi_internal/3
+	xorl	%r14d, %r14d	# 18500	[c=4 l=3]  *movdi_xor
+	orl	%eax, %r15d	# 9452	[c=4 l=3]  *iorsi_1/0
+	leaq	.LC32(%rip), %rsi	# 9455	[c=1 l=7]  *movdi_internal/4
+	movl	%r15d, %ecx	# 9453	[c=4 l=3]  *movsi_internal/0
+	call	log_add_data_mov@PLT	# 9458	[c=0 l=5]  *call
+	cmpb	$0, 840(%r12)	# 9459	[c=13 l=9]  *cmpqi_ccno_1/1
+	je	.L812	# 9460	[c=13 l=2]  *jcc
+	addl	$1, %r15d	# 9462	[c=4 l=4]  *addsi_1/0
+	movl	%r15d, %eax	# 16635	[c=4 l=3]  *movsi_internal/0
+	subl	5176(%r12), %eax	# 9463	[c=13 l=8]  *subsi_1/1
+	cmpl	5180(%r12), %eax	# 9464	[c=13 l=8]  *cmpsi_1/1
+	jb	.L813	# 9465	[c=13 l=2]  *jcc
+	movl	%r15d, %eax	# 16637	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %eax	# 9467	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 15650	[c=5 l=5]  *andsi_1_zext
+	cmpb	$0, 1080(%r12,%rax)	# 9470	[c=14 l=9]  *cmpqi_ccno_1/1
+	jne	.L814	# 9471	[c=13 l=6]  *jcc
+.L813:
+	movq	1040(%r12), %rdx	# 9475	[c=9 l=8]  *movdi_internal/3
+	movslq	%r15d, %rax	# 9474	[c=4 l=3]  *extendsidi2_rex64/1
+	movzbl	(%rdx,%rax), %r14d	# 9476	[c=13 l=5]  *zero_extendqisi2/0
+.L815:
+	cmpl	$95, %r15d	# 14606	[c=4 l=4]  *cmpsi_1/0
+	movl	%r14d, %ecx	# 9492	[c=4 l=3]  *movsi_internal/0
+	movl	%r15d, %edx	# 9493	[c=4 l=3]  *movsi_internal/0
+	movq	%r12, %rdi	# 9495	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC29(%rip), %rax	# 15762	[c=1 l=7]  *movdi_internal/4
+	leaq	.LC28(%rip), %rsi	# 15761	[c=1 l=7]  *movdi_internal/4
+	cmovne	%rax, %rsi	# 14607	[c=8 l=4]  *movdicc_noc/1
+	sall	$16, %r14d	# 9497	[c=4 l=4]  *ashlsi3_1/0
+	call	log_add_data_mov@PLT	# 9496	[c=0 l=5]  *call
+.L812:
+	leal	1(%r15), %edx	# 17316	[c=4 l=4]  *leasi
+	movl	%edx, %eax	# 16639	[c=4 l=2]  *movsi_internal/0
+	subl	5176(%r12), %eax	# 9501	[c=13 l=8]  *subsi_1/1
+	cmpl	5180(%r12), %eax	# 9502	[c=13 l=8]  *cmpsi_1/1
+	jb	.L817	# 9503	[c=13 l=2]  *jcc
+	movl	%edx, %eax	# 16641	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %eax	# 9505	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 15649	[c=5 l=5]  *andsi_1_zext
+	cmpb	$0, 1080(%r12,%rax)	# 9508	[c=14 l=9]  *cmpqi_ccno_1/1
+	jne	.L818	# 9509	[c=13 l=6]  *jcc
+.L817:
+	movq	1040(%r12), %rcx	# 9513	[c=9 l=8]  *movdi_internal/3
+	movslq	%edx, %rax	# 9512	[c=4 l=3]  *extendsidi2_rex64/1
+	movzbl	(%rcx,%rax), %r13d	# 9514	[c=13 l=5]  *zero_extendqisi2/0
+.L819:
+	cmpl	$95, %edx	# 14618	[c=4 l=3]  *cmpsi_1/0
+	leaq	.LC29(%rip), %rax	# 15764	[c=1 l=7]  *movdi_internal/4
+	movl	%r13d, %ecx	# 9530	[c=4 l=3]  *movsi_internal/0
+	movq	%r12, %rdi	# 9533	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC28(%rip), %rsi	# 15763	[c=1 l=7]  *movdi_internal/4
+	cmovne	%rax, %rsi	# 14619	[c=8 l=4]  *movdicc_noc/1
+	sall	$8, %r13d	# 9535	[c=4 l=4]  *ashlsi3_1/0
+	addl	$2, %r15d	# 9537	[c=4 l=4]  *addsi_1/0
+	orl	%r14d, %r13d	# 9536	[c=4 l=3]  *iorsi_1/0
+	call	log_add_data_mov@PLT	# 9534	[c=0 l=5]  *call
+	movl	%r15d, %eax	# 16643	[c=4 l=3]  *movsi_internal/0
+	subl	5176(%r12), %eax	# 9538	[c=13 l=8]  *subsi_1/1
+	cmpl	5180(%r12), %eax	# 9539	[c=13 l=8]  *cmpsi_1/1
+	jb	.L821	# 9540	[c=13 l=2]  *jcc
+	movl	%r15d, %eax	# 16645	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %eax	# 9542	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 15648	[c=5 l=5]  *andsi_1_zext
+	cmpb	$0, 1080(%r12,%rax)	# 9545	[c=14 l=9]  *cmpqi_ccno_1/1
+	jne	.L822	# 9546	[c=13 l=6]  *jcc
+.L821:
+	movq	1040(%r12), %rdx	# 9550	[c=9 l=8]  *movdi_internal/3
+	movslq	%r15d, %rax	# 9549	[c=4 l=3]  *extendsidi2_rex64/1
+	movzbl	(%rdx,%rax), %r14d	# 9551	[c=13 l=5]  *zero_extendqisi2/0
+.L823:
+	cmpl	$95, %r15d	# 14630	[c=4 l=4]  *cmpsi_1/0
+	movl	%r14d, %ecx	# 9567	[c=4 l=3]  *movsi_internal/0
+	movl	%r15d, %edx	# 9568	[c=4 l=3]  *movsi_internal/0
+	movq	%r12, %rdi	# 9570	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC29(%rip), %rax	# 15766	[c=1 l=7]  *movdi_internal/4
+	leaq	.LC28(%rip), %rsi	# 15765	[c=1 l=7]  *movdi_internal/4
+	cmovne	%rax, %rsi	# 14631	[c=8 l=4]  *movdicc_noc/1
+	orl	%r14d, %r13d	# 9572	[c=4 l=3]  *iorsi_1/0
+	call	log_add_data_mov@PLT	# 9571	[c=0 l=5]  *call
+	cmpl	%r13d, 992(%r12)	# 9573	[c=13 l=8]  *cmpsi_1/0
+	jb	.L1224	# 9574	[c=13 l=6]  *jcc
+	movzwl	%r15w, %r14d	# 9582	[c=4 l=4]  *zero_extendhisi2/0
+	movl	$93, %edx	# 9584	[c=4 l=5]  *movsi_internal/0
+	leaq	.LC33(%rip), %rsi	# 9585	[c=1 l=7]  *movdi_internal/4
+	movq	%r12, %rdi	# 9587	[c=4 l=3]  *movdi_internal/3
+	movl	%r14d, %ecx	# 9583	[c=4 l=3]  *movsi_internal/0
+	call	log_add_data_mov@PLT	# 9588	[c=0 l=5]  *call
+	movl	$93, %eax	# 9589	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r12), %eax	# 9590	[c=13 l=8]  *subsi_1/1
+	cmpl	5180(%r12), %eax	# 9591	[c=13 l=8]  *cmpsi_1/1
+	jb	.L826	# 9592	[c=13 l=2]  *jcc
+	cmpb	$1, 1082(%r12)	# 9596	[c=13 l=9]  *cmpqi_1/0
+	ja	.L1388	# 9597	[c=13 l=6]  *jcc
+.L826:
+	movq	1040(%r12), %rax	# 9608	[c=9 l=8]  *movdi_internal/3
+	movb	%r15b, 93(%rax)	# 9609	[c=4 l=4]  *movqi_internal/8
+.L827:
+	movl	$94, %eax	# 9613	[c=4 l=5]  *movsi_internal/0
+	sarl	$8, %r14d	# 9612	[c=4 l=4]  *ashrsi3_1/0
+	subl	5176(%r12), %eax	# 9614	[c=13 l=8]  *subsi_1/1
+	cmpl	5180(%r12), %eax	# 9615	[c=13 l=8]  *cmpsi_1/1
+	jb	.L828	# 9616	[c=13 l=2]  *jcc
+	cmpb	$1, 1082(%r12)	# 9620	[c=13 l=9]  *cmpqi_1/0
+	ja	.L1389	# 9621	[c=13 l=6]  *jcc
+.L828:
+	movq	1040(%r12), %rax	# 9631	[c=9 l=8]  *movdi_internal/3
+	movb	%r14b, 94(%rax)	# 9632	[c=4 l=4]  *movqi_internal/8
+.L829:
+	movzbl	840(%r12), %eax	# 9636	[c=13 l=9]  zero_extendqidi2/0
+	movl	%r13d, (%r12)	# 9635	[c=4 l=4]  *movsi_internal/1
+	addq	%rax, 48(%r12)	# 9637	[c=13 l=5]  *adddi_1/0
+	movl	$95, %eax	# 9638	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r12), %eax	# 9639	[c=13 l=8]  *subsi_1/1
+	cmpl	5180(%r12), %eax	# 9640	[c=13 l=8]  *cmpsi_1/1
+	jb	.L830	# 9641	[c=13 l=2]  *jcc
+	cmpb	$0, 1082(%r12)	# 9643	[c=13 l=9]  *cmpqi_ccno_1/1
+	jne	.L831	# 9644	[c=13 l=6]  *jcc
+.L830:
+	movq	1040(%r12), %rax	# 9647	[c=9 l=8]  *movdi_internal/3
+	movzbl	95(%rax), %r14d	# 9648	[c=13 l=5]  *zero_extendqisi2/0
+.L832:
+	movl	%r14d, %ecx	# 9659	[c=4 l=3]  *movsi_internal/0
+	movl	$95, %edx	# 9660	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 9663	[c=4 l=3]  *movdi_internal/3
+	movl	%r14d, %r13d	# 16647	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC28(%rip), %rsi	# 9661	[c=1 l=7]  *movdi_internal/4
+	orb	$-128, %r13b	# 17310	[c=4 l=4]  *iorqi_1_slp/0
+	call	log_add_data_mov@PLT	# 9664	[c=0 l=5]  *call
+	movl	%r14d, %ecx	# 16649	[c=4 l=3]  *movsi_internal/0
+	movl	$95, %edx	# 9670	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 9673	[c=4 l=3]  *movdi_internal/3
+	andl	$127, %ecx	# 9667	[c=4 l=3]  *andsi_1/0
+	leaq	.LC30(%rip), %rsi	# 9671	[c=1 l=7]  *movdi_internal/4
+	orb	$-128, %cl	# 17313	[c=4 l=3]  *iorqi_1_slp/0
+	call	log_add_data_mov@PLT	# 9674	[c=0 l=5]  *call
+	movl	$95, %eax	# 9675	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r12), %eax	# 9676	[c=13 l=8]  *subsi_1/1
+	cmpl	5180(%r12), %eax	# 9677	[c=13 l=8]  *cmpsi_1/1
+	jb	.L833	# 9678	[c=13 l=2]  *jcc
+	cmpb	$0, 1082(%r12)	# 9680	[c=13 l=9]  *cmpqi_ccno_1/1
+	jne	.L834	# 9681	[c=13 l=6]  *jcc
+.L833:
+	movq	1040(%r12), %rax	# 9684	[c=9 l=8]  *movdi_internal/3
+	movb	%r13b, 95(%rax)	# 9685	[c=4 l=4]  *movqi_internal/8
+.L835:
+	movq	48(%r12), %rax	# 9696	[c=9 l=5]  *movdi_internal/3
+	movq	%rbp, %rsi	# 9698	[c=4 l=3]  *movdi_internal/3
+	movq	%r12, %rdi	# 9699	[c=4 l=3]  *movdi_internal/3
+	movq	%rax, 6024(%r12)	# 9697	[c=4 l=8]  *movdi_internal/5
+	call	log_dump_line@PLT	# 9700	[c=0 l=5]  *call
+	movq	40(%r12), %rax	# 16651	[c=9 l=5]  *movdi_internal/3
+	movq	(%rsp), %rcx	# 16652	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 9702	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rcx), %rdx	# 17309	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r12)	# 9703	[c=4 l=5]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 9705	[c=4 l=3]  *cmpdi_1/0
+	jb	.L297	# 9706	[c=13 l=6]  *jcc
+	movq	56(%r12), %rax	# 16653	[c=9 l=5]  *movdi_internal/3
+	cmpq	%rax, 48(%r12)	# 9709	[c=13 l=5]  *cmpdi_1/0
+	jnb	.L1390	# 9710	[c=13 l=6]  *jcc
+.L836:
+	movq	%r12, %rdi	# 9716	[c=4 l=3]  *movdi_internal/3
+	call	log_is_idle@PLT	# 9717	[c=10 l=5]  *call_value
+	testb	%al, %al	# 9719	[c=4 l=2]  *cmpqi_ccno_1/0
+	jne	.L1391	# 9720	[c=13 l=6]  *jcc
+.L837:
+	movl	(%r12), %r8d	# 9731	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r12, %rdi	# 9736	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r8	# 9732	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r12), %r8	# 9734	[c=13 l=8]  *adddi_1/1
+	movq	%r8, %rbp	# 16655	[c=4 l=3]  *movdi_internal/3
+	movq	%r8, %rsi	# 9735	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 9737	[c=0 l=5]  *call
+	movzbl	9(%rbp), %eax	# 9738	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, (%r12)	# 9739	[c=9 l=4]  *addsi_1/0
+	leaq	handler.1(%rip), %rdi	# 16658	[c=1 l=7]  *movdi_internal/4
+	movzbl	8(%rbp), %eax	# 9742	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 16656	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 9743	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbx,%rdx), %rdx	# 9746	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r12)	# 9747	[c=13 l=5]  *adddi_1/0
+	jmp	*(%rdi,%rax,8)	# 18499	[c=10 l=3]  *indirect_jump
+.L838:
+	movswl	12(%rbp), %eax	# 9755	[c=13 l=4]  extendhisi2/1
+	cmpw	$-1, %ax	# 9756	[c=4 l=4]  *cmphi_1/0
+	je	.L1392	# 9757	[c=13 l=6]  *jcc
+	addl	(%r12), %eax	# 9770	[c=9 l=4]  *addsi_1/1
+	andl	992(%r12), %eax	# 9773	[c=13 l=8]  *andsi_1/1
+	movq	%rbp, %rsi	# 9775	[c=4 l=3]  *movdi_internal/3
+	movq	%r12, %rdi	# 9776	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, (%r12)	# 9774	[c=4 l=4]  *movsi_internal/1
+	call	log_dump_line@PLT	# 9777	[c=0 l=5]  *call
+	movq	40(%r12), %rax	# 16659	[c=9 l=5]  *movdi_internal/3
+	movq	(%rsp), %rcx	# 16660	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 9779	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rcx), %rdx	# 17308	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r12)	# 9780	[c=4 l=5]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 9782	[c=4 l=3]  *cmpdi_1/0
+	jb	.L297	# 9783	[c=13 l=6]  *jcc
+	movq	56(%r12), %rax	# 16661	[c=9 l=5]  *movdi_internal/3
+	cmpq	%rax, 48(%r12)	# 9786	[c=13 l=5]  *cmpdi_1/0
+	jnb	.L1393	# 9787	[c=13 l=6]  *jcc
+.L840:
+	movq	%r12, %rdi	# 9793	[c=4 l=3]  *movdi_internal/3
+	call	log_is_idle@PLT	# 9794	[c=10 l=5]  *call_value
+	testb	%al, %al	# 9796	[c=4 l=2]  *cmpqi_ccno_1/0
+	jne	.L1394	# 9797	[c=13 l=6]  *jcc
+.L841:
+	movl	(%r12), %r8d	# 9808	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r12, %rdi	# 9813	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r8	# 9809	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r12), %r8	# 9811	[c=13 l=8]  *adddi_1/1
+	movq	%r8, %rbp	# 16663	[c=4 l=3]  *movdi_internal/3
+	movq	%r8, %rsi	# 9812	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 9814	[c=0 l=5]  *call
+	movzbl	9(%rbp), %eax	# 9815	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, (%r12)	# 9816	[c=9 l=4]  *addsi_1/0
+	leaq	handler.1(%rip), %rdi	# 16666	[c=1 l=7]  *movdi_internal/4
+	movzbl	8(%rbp), %eax	# 9819	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 16664	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 9820	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbx,%rdx), %rdx	# 9823	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r12)	# 9824	[c=13 l=5]  *adddi_1/0
+	jmp	*(%rdi,%rax,8)	# 18496	[c=10 l=3]  *indirect_jump
+.L854:
+	movzwl	12(%rbp), %r14d	# 10100	[c=13 l=5]  *zero_extendhisi2/0
+	movq	%r12, %rdi	# 10107	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 18485	[c=4 l=2]  *movdi_xor
+	movzbl	10(%rbp), %r13d	# 10102	[c=13 l=5]  zero_extendqidi2/0
+	leaq	.LC60(%rip), %rsi	# 10105	[c=1 l=7]  *movdi_internal/4
+	movl	%r14d, %edx	# 10104	[c=4 l=3]  *movsi_internal/0
+	movl	%r14d, 24(%rsp)	# 17187	[c=4 l=5]  *movsi_internal/1
+	call	log_append@PLT	# 10109	[c=0 l=5]  *call
+	movq	1040(%r12), %rax	# 10110	[c=9 l=8]  *movdi_internal/3
+	leaq	.LC43(%rip), %rsi	# 10118	[c=1 l=7]  *movdi_internal/4
+	movzbl	95(%rax), %edx	# 10111	[c=9 l=4]  *movqi_internal/4
+	movzbl	(%rax,%r13), %ecx	# 10115	[c=13 l=5]  *zero_extendqisi2/0
+	xorl	%eax, %eax	# 18486	[c=4 l=2]  *movdi_xor
+	movl	%edx, %edi	# 16687	[c=4 l=2]  *movsi_internal/0
+	movl	%r13d, %edx	# 10117	[c=4 l=3]  *movsi_internal/0
+	andl	$1, %edi	# 10113	[c=4 l=3]  *andsi_1/0
+	movl	%edi, 8(%rsp)	# 16688	[c=4 l=4]  *movsi_internal/1
+	movq	%r12, %rdi	# 10120	[c=4 l=3]  *movdi_internal/3
+	call	log_append@PLT	# 10122	[c=0 l=5]  *call
+	movq	1040(%r12), %rax	# 10123	[c=9 l=8]  *movdi_internal/3
+	movl	8(%rsp), %edi	# 16691	[c=9 l=4]  *movsi_internal/0
+	movl	%r13d, %edx	# 10130	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC59(%rip), %rsi	# 10131	[c=1 l=7]  *movdi_internal/4
+	movzbl	(%rax,%r13), %eax	# 10124	[c=13 l=5]  *zero_extendqisi2/0
+	movb	%al, 16(%rsp)	# 17184	[c=4 l=4]  *movqi_internal/8
+	subl	%r14d, %eax	# 10126	[c=4 l=3]  *subsi_1/0
+	subl	%edi, %eax	# 10127	[c=4 l=2]  *subsi_1/0
+	movq	%r12, %rdi	# 10133	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, %r14d	# 16690	[c=4 l=3]  *movsi_internal/0
+	movzbl	%al, %ecx	# 10128	[c=4 l=3]  *zero_extendqisi2/0
+	xorl	%eax, %eax	# 18487	[c=4 l=2]  *movdi_xor
+	call	log_append@PLT	# 10135	[c=0 l=5]  *call
+	movzbl	16(%rsp), %r11d	# 17185	[c=9 l=6]  *movqi_internal/4
+	movl	24(%rsp), %r9d	# 17188	[c=9 l=5]  *movsi_internal/0
+	movq	1040(%r12), %rax	# 10136	[c=9 l=8]  *movdi_internal/3
+	andl	$136, %r11d	# 10139	[c=4 l=7]  *andsi_1/0
+	andl	$136, %r9d	# 10142	[c=4 l=7]  *andsi_1/0
+	movb	%r14b, (%rax,%r13)	# 10137	[c=4 l=4]  *movqi_internal/8
+	leal	(%r9,%r11,2), %eax	# 10143	[c=8 l=4]  *leasi
+	movq	1040(%r12), %rdx	# 10144	[c=9 l=8]  *movdi_internal/3
+	andl	$511, %r14d	# 10149	[c=4 l=7]  *andsi_1/0
+	imull	$260, %eax, %eax	# 10147	[c=12 l=6]  *mulsi3_1/1
+	movzbl	95(%rdx), %r15d	# 10145	[c=13 l=5]  *zero_extendqisi2/0
+	leaq	flag_update_table_sub8(%rip), %rdx	# 15691	[c=1 l=7]  *movdi_internal/4
+	andl	$7680, %eax	# 10148	[c=4 l=5]  *andsi_1/0
+	orl	%r14d, %eax	# 10150	[c=5 l=3]  *iorsi_1_zext
+	movzbl	(%rdx,%rax), %r13d	# 10152	[c=13 l=5]  *zero_extendqisi2/0
+	movl	%r15d, %eax	# 16692	[c=4 l=3]  *movsi_internal/0
+	orl	$-3, %eax	# 10153	[c=4 l=3]  *iorsi_1/0
+	andl	%eax, %r13d	# 10154	[c=4 l=3]  *andsi_1/0
+	movl	$95, %eax	# 10155	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r12), %eax	# 10156	[c=13 l=8]  *subsi_1/1
+	cmpl	5180(%r12), %eax	# 10157	[c=13 l=8]  *cmpsi_1/1
+	jb	.L855	# 10158	[c=13 l=2]  *jcc
+	cmpb	$0, 1082(%r12)	# 10160	[c=13 l=9]  *cmpqi_ccno_1/1
+	jne	.L1395	# 10161	[c=13 l=6]  *jcc
+.L855:
+	movl	%r15d, %ecx	# 10169	[c=4 l=3]  *movsi_internal/0
+	andl	$-64, %r15d	# 10175	[c=4 l=4]  *andsi_1/0
+	movl	$95, %edx	# 10170	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 10173	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC28(%rip), %rsi	# 10171	[c=1 l=7]  *movdi_internal/4
+	orl	%r13d, %r15d	# 10176	[c=4 l=3]  *iorsi_1/0
+	call	log_add_data_mov@PLT	# 10174	[c=0 l=5]  *call
+	movzbl	%r15b, %ecx	# 10177	[c=4 l=4]  *zero_extendqisi2/0
+	movl	$95, %edx	# 10179	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 10182	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC30(%rip), %rsi	# 10180	[c=1 l=7]  *movdi_internal/4
+	call	log_add_data_mov@PLT	# 10183	[c=0 l=5]  *call
+	movl	$95, %eax	# 10184	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r12), %eax	# 10185	[c=13 l=8]  *subsi_1/1
+	cmpl	5180(%r12), %eax	# 10186	[c=13 l=8]  *cmpsi_1/1
+	jb	.L856	# 10187	[c=13 l=2]  *jcc
+	cmpb	$0, 1082(%r12)	# 10189	[c=13 l=9]  *cmpqi_ccno_1/1
+	jne	.L857	# 10190	[c=13 l=6]  *jcc
+.L856:
+	movq	1040(%r12), %rax	# 10193	[c=9 l=8]  *movdi_internal/3
+	movb	%r15b, 95(%rax)	# 10194	[c=4 l=4]  *movqi_internal/8
+.L858:
+	movq	%rbp, %rsi	# 10205	[c=4 l=3]  *movdi_internal/3
+	movq	%r12, %rdi	# 10206	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 10207	[c=0 l=5]  *call
+	movq	40(%r12), %rax	# 16694	[c=9 l=5]  *movdi_internal/3
+	movq	(%rsp), %rcx	# 16695	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 10209	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rcx), %rdx	# 17305	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r12)	# 10210	[c=4 l=5]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 10212	[c=4 l=3]  *cmpdi_1/0
+	jb	.L297	# 10213	[c=13 l=6]  *jcc
+	movl	(%r12), %r8d	# 10215	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r12, %rdi	# 10220	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r8	# 10216	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r12), %r8	# 10218	[c=13 l=8]  *adddi_1/1
+	movq	%r8, %rbp	# 16697	[c=4 l=3]  *movdi_internal/3
+	movq	%r8, %rsi	# 10219	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 10221	[c=0 l=5]  *call
+	movzbl	9(%rbp), %eax	# 10222	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, (%r12)	# 10223	[c=9 l=4]  *addsi_1/0
+	leaq	handler.1(%rip), %rdi	# 16700	[c=1 l=7]  *movdi_internal/4
+	movzbl	8(%rbp), %eax	# 10226	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 16698	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 10227	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbx,%rdx), %rdx	# 10230	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r12)	# 10231	[c=13 l=5]  *adddi_1/0
+	jmp	*(%rdi,%rax,8)	# 18484	[c=10 l=3]  *indirect_jump
+.L859:
+	movzbl	10(%rbp), %r14d	# 10240	[c=13 l=5]  *zero_extendqisi2/0
+	movzwl	12(%rbp), %r15d	# 10239	[c=13 l=5]  *zero_extendhisi2/0
+	movl	%r14d, %eax	# 16701	[c=4 l=3]  *movsi_internal/0
+	movl	%r14d, %r13d	# 17731	[c=4 l=3]  *movsi_internal/0
+	subl	5176(%r12), %eax	# 10243	[c=13 l=8]  *subsi_1/1
+	cmpl	5180(%r12), %eax	# 10244	[c=13 l=8]  *cmpsi_1/1
+	jb	.L860	# 10245	[c=13 l=2]  *jcc
+	movl	%r14d, %eax	# 16703	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %eax	# 10247	[c=4 l=3]  *ashrsi3_1/0
+	cltq	# 10248	[c=4 l=2]  *extendsidi2_rex64/0
+	cmpb	$0, 1080(%r12,%rax)	# 10249	[c=14 l=9]  *cmpqi_ccno_1/1
+	jne	.L861	# 10250	[c=13 l=6]  *jcc
+.L860:
+	movq	1040(%r12), %rdx	# 10254	[c=9 l=8]  *movdi_internal/3
+	movzbl	%r13b, %eax	# 10253	[c=4 l=4]  zero_extendqidi2/0
+	movzbl	(%rdx,%rax), %eax	# 10255	[c=13 l=4]  *zero_extendqisi2/0
+.L862:
+	cmpl	$95, %r14d	# 14642	[c=4 l=4]  *cmpsi_1/0
+	leaq	.LC29(%rip), %rdx	# 15768	[c=1 l=7]  *movdi_internal/4
+	movl	%eax, %ecx	# 10271	[c=4 l=2]  *movsi_internal/0
+	movq	%r12, %rdi	# 10274	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC28(%rip), %rsi	# 15767	[c=1 l=7]  *movdi_internal/4
+	movl	%eax, 8(%rsp)	# 17189	[c=4 l=4]  *movsi_internal/1
+	cmovne	%rdx, %rsi	# 14643	[c=8 l=4]  *movdicc_noc/1
+	movl	%r14d, %edx	# 10272	[c=4 l=3]  *movsi_internal/0
+	call	log_add_data_mov@PLT	# 10275	[c=0 l=5]  *call
+	cmpl	6564(%r12), %r14d	# 10276	[c=13 l=8]  *cmpsi_1/1
+	movl	8(%rsp), %eax	# 17190	[c=9 l=4]  *movsi_internal/0
+	jnb	.L864	# 10277	[c=13 l=6]  *jcc
+	movslq	%r14d, %rdx	# 10279	[c=4 l=3]  *extendsidi2_rex64/1
+	cmpb	$0, 6568(%r12,%rdx)	# 10282	[c=14 l=9]  *cmpqi_ccno_1/1
+	jns	.L864	# 10283	[c=13 l=6]  *jcc
+.L865:
+	cmpl	$95, %r14d	# 14654	[c=4 l=4]  *cmpsi_1/0
+	movzbl	%r15b, %ecx	# 10289	[c=4 l=4]  *zero_extendqisi2/0
+	movl	%r14d, %edx	# 10296	[c=4 l=3]  *movsi_internal/0
+	movq	%r12, %rdi	# 10298	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC31(%rip), %rax	# 15770	[c=1 l=7]  *movdi_internal/4
+	leaq	.LC30(%rip), %rsi	# 15769	[c=1 l=7]  *movdi_internal/4
+	cmovne	%rax, %rsi	# 14655	[c=8 l=4]  *movdicc_noc/1
+	call	log_add_data_mov@PLT	# 10299	[c=0 l=5]  *call
+	movl	%r14d, %eax	# 16705	[c=4 l=3]  *movsi_internal/0
+	subl	5176(%r12), %eax	# 10300	[c=13 l=8]  *subsi_1/1
+	cmpl	5180(%r12), %eax	# 10301	[c=13 l=8]  *cmpsi_1/1
+	jb	.L867	# 10302	[c=13 l=2]  *jcc
+	movl	%r14d, %eax	# 16707	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %eax	# 10304	[c=4 l=3]  *ashrsi3_1/0
+	cltq	# 10305	[c=4 l=2]  *extendsidi2_rex64/0
+	cmpb	$0, 1080(%r12,%rax)	# 10306	[c=14 l=9]  *cmpqi_ccno_1/1
+	jne	.L868	# 10307	[c=13 l=6]  *jcc
+.L867:
+	movq	1040(%r12), %rdx	# 10311	[c=9 l=8]  *movdi_internal/3
+	movzbl	%r13b, %eax	# 10310	[c=4 l=4]  zero_extendqidi2/0
+	movb	%r15b, (%rdx,%rax)	# 10312	[c=4 l=4]  *movqi_internal/8
+.L869:
+	movq	%rbp, %rsi	# 10323	[c=4 l=3]  *movdi_internal/3
+	movq	%r12, %rdi	# 10324	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 10325	[c=0 l=5]  *call
+	movq	40(%r12), %rax	# 16709	[c=9 l=5]  *movdi_internal/3
+	movq	(%rsp), %rcx	# 16710	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 10327	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rcx), %rdx	# 17304	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r12)	# 10328	[c=4 l=5]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 10330	[c=4 l=3]  *cmpdi_1/0
+	jb	.L297	# 10331	[c=13 l=6]  *jcc
+	movl	(%r12), %r8d	# 10333	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r12, %rdi	# 10338	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r8	# 10334	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r12), %r8	# 10336	[c=13 l=8]  *adddi_1/1
+	movq	%r8, %rbp	# 16712	[c=4 l=3]  *movdi_internal/3
+	movq	%r8, %rsi	# 10337	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 10339	[c=0 l=5]  *call
+	movzbl	9(%rbp), %eax	# 10340	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, (%r12)	# 10341	[c=9 l=4]  *addsi_1/0
+	leaq	handler.1(%rip), %rdi	# 16715	[c=1 l=7]  *movdi_internal/4
+	movzbl	8(%rbp), %eax	# 10344	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 16713	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 10345	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbx,%rdx), %rdx	# 10348	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r12)	# 10349	[c=13 l=5]  *adddi_1/0
+	jmp	*(%rdi,%rax,8)	# 18483	[c=10 l=3]  *indirect_jump
+.L864:
+	orl	%eax, %r15d	# 10286	[c=4 l=3]  *iorsi_1/0
+	jmp	.L865	# 18871	[c=1 l=5]  jump
+.L849:
+	movzbl	10(%rbp), %r11d	# 9956	[c=13 l=5]  zero_extendqidi2/0
+	movzwl	12(%rbp), %r14d	# 9955	[c=9 l=5]  *movhi_internal/2
+	movq	%r12, %rdi	# 9965	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC43(%rip), %rsi	# 9963	[c=1 l=7]  *movdi_internal/4
+	movq	1040(%r12), %rax	# 9959	[c=9 l=8]  *movdi_internal/3
+	movl	%r11d, %edx	# 9962	[c=4 l=3]  *movsi_internal/0
+	movq	%r11, %r15	# 17726	[c=4 l=3]  *movdi_internal/3
+	movl	%r11d, 16(%rsp)	# 17182	[c=4 l=5]  *movsi_internal/1
+	movzbl	(%rax,%r11), %ecx	# 9960	[c=13 l=5]  *zero_extendqisi2/0
+	xorl	%eax, %eax	# 18489	[c=4 l=2]  *movdi_xor
+	call	log_append@PLT	# 9967	[c=0 l=5]  *call
+	movzwl	%r14w, %r9d	# 9970	[c=4 l=4]  zero_extendhidi2/0
+	movzwl	%r14w, %edx	# 9972	[c=4 l=4]  *zero_extendhisi2/0
+	movq	%r12, %rdi	# 9977	[c=4 l=3]  *movdi_internal/3
+	movq	1040(%r12), %rax	# 9968	[c=9 l=8]  *movdi_internal/3
+	leaq	.LC43(%rip), %rsi	# 17181	[c=1 l=7]  *movdi_internal/4
+	movq	%r9, 8(%rsp)	# 17178	[c=4 l=5]  *movdi_internal/5
+	movzbl	(%rax,%r9), %ecx	# 9971	[c=13 l=5]  *zero_extendqisi2/0
+	movzbl	(%rax,%r15), %r13d	# 9969	[c=9 l=5]  *movqi_internal/4
+	xorl	%eax, %eax	# 18490	[c=4 l=2]  *movdi_xor
+	call	log_append@PLT	# 9979	[c=0 l=5]  *call
+	movq	8(%rsp), %r9	# 17179	[c=9 l=5]  *movdi_internal/3
+	movzbl	%r13b, %r14d	# 9982	[c=4 l=4]  *zero_extendqisi2/0
+	movq	1040(%r12), %rax	# 9980	[c=9 l=8]  *movdi_internal/3
+	leaq	.LC59(%rip), %rsi	# 9992	[c=1 l=7]  *movdi_internal/4
+	movq	%r12, %rdi	# 9994	[c=4 l=3]  *movdi_internal/3
+	andl	$136, %r13d	# 10000	[c=4 l=7]  *andsi_1/0
+	movzbl	(%rax,%r9), %edx	# 9981	[c=13 l=5]  *zero_extendqisi2/0
+	movzbl	95(%rax), %eax	# 9985	[c=9 l=4]  *movqi_internal/4
+	subl	%edx, %r14d	# 9984	[c=4 l=3]  *subsi_1/0
+	andl	$1, %eax	# 9987	[c=4 l=3]  *andsi_1/0
+	movb	%dl, 8(%rsp)	# 17176	[c=4 l=4]  *movqi_internal/8
+	movl	16(%rsp), %edx	# 18491	[c=9 l=4]  *movsi_internal/0
+	subl	%eax, %r14d	# 9988	[c=4 l=3]  *subsi_1/0
+	xorl	%eax, %eax	# 18492	[c=4 l=2]  *movdi_xor
+	movzbl	%r14b, %ecx	# 9989	[c=4 l=4]  *zero_extendqisi2/0
+	call	log_append@PLT	# 9996	[c=0 l=5]  *call
+	movzbl	8(%rsp), %r9d	# 17177	[c=9 l=6]  *movqi_internal/4
+	movq	1040(%r12), %rax	# 9997	[c=9 l=8]  *movdi_internal/3
+	andl	$136, %r9d	# 10003	[c=4 l=7]  *andsi_1/0
+	movb	%r14b, (%rax,%r15)	# 9998	[c=4 l=4]  *movqi_internal/8
+	movq	1040(%r12), %rdx	# 10005	[c=9 l=8]  *movdi_internal/3
+	andl	$511, %r14d	# 10010	[c=4 l=7]  *andsi_1/0
+	leal	(%r9,%r13,2), %eax	# 10004	[c=8 l=4]  *leasi
+	imull	$260, %eax, %eax	# 10008	[c=12 l=6]  *mulsi3_1/1
+	movzbl	95(%rdx), %r15d	# 10006	[c=13 l=5]  *zero_extendqisi2/0
+	leaq	flag_update_table_sub8(%rip), %rdx	# 15690	[c=1 l=7]  *movdi_internal/4
+	andl	$7680, %eax	# 10009	[c=4 l=5]  *andsi_1/0
+	orl	%r14d, %eax	# 10011	[c=5 l=3]  *iorsi_1_zext
+	movzbl	(%rdx,%rax), %r13d	# 10013	[c=13 l=5]  *zero_extendqisi2/0
+	movl	%r15d, %eax	# 16678	[c=4 l=3]  *movsi_internal/0
+	orl	$-3, %eax	# 10014	[c=4 l=3]  *iorsi_1/0
+	andl	%eax, %r13d	# 10015	[c=4 l=3]  *andsi_1/0
+	movl	$95, %eax	# 10016	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r12), %eax	# 10017	[c=13 l=8]  *subsi_1/1
+	cmpl	5180(%r12), %eax	# 10018	[c=13 l=8]  *cmpsi_1/1
+	jb	.L850	# 10019	[c=13 l=2]  *jcc
+	cmpb	$0, 1082(%r12)	# 10021	[c=13 l=9]  *cmpqi_ccno_1/1
+	jne	.L1396	# 10022	[c=13 l=6]  *jcc
+.L850:
+	movl	%r15d, %ecx	# 10030	[c=4 l=3]  *movsi_internal/0
+	andl	$-64, %r15d	# 10036	[c=4 l=4]  *andsi_1/0
+	movl	$95, %edx	# 10031	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 10034	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC28(%rip), %rsi	# 10032	[c=1 l=7]  *movdi_internal/4
+	orl	%r13d, %r15d	# 10037	[c=4 l=3]  *iorsi_1/0
+	call	log_add_data_mov@PLT	# 10035	[c=0 l=5]  *call
+	movzbl	%r15b, %ecx	# 10038	[c=4 l=4]  *zero_extendqisi2/0
+	movl	$95, %edx	# 10040	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 10043	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC30(%rip), %rsi	# 10041	[c=1 l=7]  *movdi_internal/4
+	call	log_add_data_mov@PLT	# 10044	[c=0 l=5]  *call
+	movl	$95, %eax	# 10045	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r12), %eax	# 10046	[c=13 l=8]  *subsi_1/1
+	cmpl	5180(%r12), %eax	# 10047	[c=13 l=8]  *cmpsi_1/1
+	jb	.L851	# 10048	[c=13 l=2]  *jcc
+	cmpb	$0, 1082(%r12)	# 10050	[c=13 l=9]  *cmpqi_ccno_1/1
+	jne	.L852	# 10051	[c=13 l=6]  *jcc
+.L851:
+	movq	1040(%r12), %rax	# 10054	[c=9 l=8]  *movdi_internal/3
+	movb	%r15b, 95(%rax)	# 10055	[c=4 l=4]  *movqi_internal/8
+.L853:
+	movq	%rbp, %rsi	# 10066	[c=4 l=3]  *movdi_internal/3
+	movq	%r12, %rdi	# 10067	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 10068	[c=0 l=5]  *call
+	movq	40(%r12), %rax	# 16680	[c=9 l=5]  *movdi_internal/3
+	movq	(%rsp), %rcx	# 16681	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 10070	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rcx), %rdx	# 17306	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r12)	# 10071	[c=4 l=5]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 10073	[c=4 l=3]  *cmpdi_1/0
+	jb	.L297	# 10074	[c=13 l=6]  *jcc
+	movl	(%r12), %r8d	# 10076	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r12, %rdi	# 10081	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r8	# 10077	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r12), %r8	# 10079	[c=13 l=8]  *adddi_1/1
+	movq	%r8, %rbp	# 16683	[c=4 l=3]  *movdi_internal/3
+	movq	%r8, %rsi	# 10080	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 10082	[c=0 l=5]  *call
+	movzbl	9(%rbp), %eax	# 10083	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, (%r12)	# 10084	[c=9 l=4]  *addsi_1/0
+	leaq	handler.1(%rip), %rdi	# 16686	[c=1 l=7]  *movdi_internal/4
+	movzbl	8(%rbp), %eax	# 10087	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 16684	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 10088	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbx,%rdx), %rdx	# 10091	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r12)	# 10092	[c=13 l=5]  *adddi_1/0
+	jmp	*(%rdi,%rax,8)	# 18488	[c=10 l=3]  *indirect_jump
+.L870:
+	movzbl	10(%rbp), %edx	# 10358	[c=13 l=4]  zero_extendqidi2/0
+	movzwl	12(%rbp), %r13d	# 10357	[c=13 l=5]  *zero_extendhisi2/0
+	movl	%edx, %ecx	# 16716	[c=4 l=2]  *movsi_internal/0
+	movq	%rdx, %rax	# 17732	[c=4 l=3]  *movdi_internal/3
+	subl	5176(%r12), %ecx	# 10361	[c=13 l=8]  *subsi_1/1
+	cmpl	5180(%r12), %ecx	# 10362	[c=13 l=8]  *cmpsi_1/1
+	jb	.L871	# 10363	[c=13 l=2]  *jcc
+	movl	%edx, %ecx	# 16718	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %ecx	# 10365	[c=4 l=3]  *ashrsi3_1/0
+	movslq	%ecx, %rcx	# 10366	[c=4 l=3]  *extendsidi2_rex64/1
+	cmpb	$0, 1080(%r12,%rcx)	# 10367	[c=14 l=9]  *cmpqi_ccno_1/1
+	jne	.L872	# 10368	[c=13 l=6]  *jcc
+.L871:
+	movq	1040(%r12), %rcx	# 10372	[c=9 l=8]  *movdi_internal/3
+	movzbl	(%rcx,%rax), %r14d	# 10373	[c=13 l=5]  *zero_extendqisi2/0
+.L873:
+	cmpl	$95, %edx	# 14666	[c=4 l=3]  *cmpsi_1/0
+	leaq	.LC28(%rip), %rsi	# 15771	[c=1 l=7]  *movdi_internal/4
+	movl	%r14d, %ecx	# 10389	[c=4 l=3]  *movsi_internal/0
+	movq	%r12, %rdi	# 10392	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC29(%rip), %rax	# 15772	[c=1 l=7]  *movdi_internal/4
+	cmovne	%rax, %rsi	# 14667	[c=8 l=4]  *movdicc_noc/1
+	call	log_add_data_mov@PLT	# 10393	[c=0 l=5]  *call
+	testl	%r14d, %r13d	# 10395	[c=4 l=3]  *testsi_1/0
+	jne	.L875	# 10396	[c=13 l=2]  *jcc
+	movl	(%r12), %eax	# 16720	[c=5 l=4]  *movsi_internal/0
+	addq	$1, 48(%r12)	# 10404	[c=13 l=6]  *adddi_1/0
+	addl	$1, %eax	# 10399	[c=4 l=3]  *addsi_1/0
+	andl	992(%r12), %eax	# 10402	[c=13 l=8]  *andsi_1/1
+	movl	%eax, (%r12)	# 10403	[c=4 l=4]  *movsi_internal/1
+.L875:
+	movq	%rbp, %rsi	# 10407	[c=4 l=3]  *movdi_internal/3
+	movq	%r12, %rdi	# 10408	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 10409	[c=0 l=5]  *call
+	movq	40(%r12), %rax	# 16721	[c=9 l=5]  *movdi_internal/3
+	movq	(%rsp), %rcx	# 16722	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 10411	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rcx), %rdx	# 17303	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r12)	# 10412	[c=4 l=5]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 10414	[c=4 l=3]  *cmpdi_1/0
+	jb	.L297	# 10415	[c=13 l=6]  *jcc
+	movq	56(%r12), %rax	# 16723	[c=9 l=5]  *movdi_internal/3
+	cmpq	%rax, 48(%r12)	# 10418	[c=13 l=5]  *cmpdi_1/0
+	jnb	.L1397	# 10419	[c=13 l=6]  *jcc
+.L876:
+	movq	%r12, %rdi	# 10425	[c=4 l=3]  *movdi_internal/3
+	call	log_is_idle@PLT	# 10426	[c=10 l=5]  *call_value
+	testb	%al, %al	# 10428	[c=4 l=2]  *cmpqi_ccno_1/0
+	jne	.L1398	# 10429	[c=13 l=6]  *jcc
+.L877:
+	movl	(%r12), %r8d	# 10440	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r12, %rdi	# 10445	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r8	# 10441	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r12), %r8	# 10443	[c=13 l=8]  *adddi_1/1
+	movq	%r8, %rbp	# 16725	[c=4 l=3]  *movdi_internal/3
+	movq	%r8, %rsi	# 10444	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 10446	[c=0 l=5]  *call
+	movzbl	9(%rbp), %eax	# 10447	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, (%r12)	# 10448	[c=9 l=4]  *addsi_1/0
+	leaq	handler.1(%rip), %rdi	# 16728	[c=1 l=7]  *movdi_internal/4
+	movzbl	8(%rbp), %eax	# 10451	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 16726	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 10452	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbx,%rdx), %rdx	# 10455	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r12)	# 10456	[c=13 l=5]  *adddi_1/0
+	jmp	*(%rdi,%rax,8)	# 18482	[c=10 l=3]  *indirect_jump
+.L878:
+	movzbl	10(%rbp), %edx	# 10465	[c=13 l=4]  zero_extendqidi2/0
+	movzwl	12(%rbp), %r13d	# 10464	[c=13 l=5]  *zero_extendhisi2/0
+	movl	%edx, %ecx	# 16729	[c=4 l=2]  *movsi_internal/0
+	movq	%rdx, %rax	# 17733	[c=4 l=3]  *movdi_internal/3
+	subl	5176(%r12), %ecx	# 10468	[c=13 l=8]  *subsi_1/1
+	cmpl	5180(%r12), %ecx	# 10469	[c=13 l=8]  *cmpsi_1/1
+	jb	.L879	# 10470	[c=13 l=2]  *jcc
+	movl	%edx, %ecx	# 16731	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %ecx	# 10472	[c=4 l=3]  *ashrsi3_1/0
+	movslq	%ecx, %rcx	# 10473	[c=4 l=3]  *extendsidi2_rex64/1
+	cmpb	$0, 1080(%r12,%rcx)	# 10474	[c=14 l=9]  *cmpqi_ccno_1/1
+	jne	.L880	# 10475	[c=13 l=6]  *jcc
+.L879:
+	movq	1040(%r12), %rcx	# 10479	[c=9 l=8]  *movdi_internal/3
+	movzbl	(%rcx,%rax), %r14d	# 10480	[c=13 l=5]  *zero_extendqisi2/0
+.L881:
+	cmpl	$95, %edx	# 14678	[c=4 l=3]  *cmpsi_1/0
+	leaq	.LC28(%rip), %rsi	# 15773	[c=1 l=7]  *movdi_internal/4
+	movl	%r14d, %ecx	# 10496	[c=4 l=3]  *movsi_internal/0
+	movq	%r12, %rdi	# 10499	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC29(%rip), %rax	# 15774	[c=1 l=7]  *movdi_internal/4
+	cmovne	%rax, %rsi	# 14679	[c=8 l=4]  *movdicc_noc/1
+	call	log_add_data_mov@PLT	# 10500	[c=0 l=5]  *call
+	testl	%r14d, %r13d	# 10502	[c=4 l=3]  *testsi_1/0
+	jne	.L883	# 10503	[c=13 l=2]  *jcc
+	movl	(%r12), %eax	# 16733	[c=5 l=4]  *movsi_internal/0
+	addq	$2, 48(%r12)	# 10511	[c=13 l=6]  *adddi_1/0
+	addl	$2, %eax	# 10506	[c=4 l=3]  *addsi_1/0
+	andl	992(%r12), %eax	# 10509	[c=13 l=8]  *andsi_1/1
+	movl	%eax, (%r12)	# 10510	[c=4 l=4]  *movsi_internal/1
+.L883:
+	movq	%rbp, %rsi	# 10514	[c=4 l=3]  *movdi_internal/3
+	movq	%r12, %rdi	# 10515	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 10516	[c=0 l=5]  *call
+	movq	40(%r12), %rax	# 16734	[c=9 l=5]  *movdi_internal/3
+	movq	(%rsp), %rcx	# 16735	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 10518	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rcx), %rdx	# 17302	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r12)	# 10519	[c=4 l=5]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 10521	[c=4 l=3]  *cmpdi_1/0
+	jb	.L297	# 10522	[c=13 l=6]  *jcc
+	movq	56(%r12), %rax	# 16736	[c=9 l=5]  *movdi_internal/3
+	cmpq	%rax, 48(%r12)	# 10525	[c=13 l=5]  *cmpdi_1/0
+	jnb	.L1399	# 10526	[c=13 l=6]  *jcc
+.L884:
+	movq	%r12, %rdi	# 10532	[c=4 l=3]  *movdi_internal/3
+	call	log_is_idle@PLT	# 10533	[c=10 l=5]  *call_value
+	testb	%al, %al	# 10535	[c=4 l=2]  *cmpqi_ccno_1/0
+	jne	.L1400	# 10536	[c=13 l=6]  *jcc
+.L885:
+	movl	(%r12), %r8d	# 10547	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r12, %rdi	# 10552	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r8	# 10548	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r12), %r8	# 10550	[c=13 l=8]  *adddi_1/1
+	movq	%r8, %rbp	# 16738	[c=4 l=3]  *movdi_internal/3
+	movq	%r8, %rsi	# 10551	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 10553	[c=0 l=5]  *call
+	movzbl	9(%rbp), %eax	# 10554	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, (%r12)	# 10555	[c=9 l=4]  *addsi_1/0
+	leaq	handler.1(%rip), %rdi	# 16741	[c=1 l=7]  *movdi_internal/4
+	movzbl	8(%rbp), %eax	# 10558	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 16739	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 10559	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbx,%rdx), %rdx	# 10562	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r12)	# 10563	[c=13 l=5]  *adddi_1/0
+	jmp	*(%rdi,%rax,8)	# 18481	[c=10 l=3]  *indirect_jump
+.L886:
+	movzbl	10(%rbp), %edx	# 10572	[c=13 l=4]  zero_extendqidi2/0
+	movzwl	12(%rbp), %r13d	# 10571	[c=13 l=5]  *zero_extendhisi2/0
+	movl	%edx, %ecx	# 16742	[c=4 l=2]  *movsi_internal/0
+	movq	%rdx, %rax	# 17734	[c=4 l=3]  *movdi_internal/3
+	subl	5176(%r12), %ecx	# 10575	[c=13 l=8]  *subsi_1/1
+	cmpl	5180(%r12), %ecx	# 10576	[c=13 l=8]  *cmpsi_1/1
+	jb	.L887	# 10577	[c=13 l=2]  *jcc
+	movl	%edx, %ecx	# 16744	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %ecx	# 10579	[c=4 l=3]  *ashrsi3_1/0
+	movslq	%ecx, %rcx	# 10580	[c=4 l=3]  *extendsidi2_rex64/1
+	cmpb	$0, 1080(%r12,%rcx)	# 10581	[c=14 l=9]  *cmpqi_ccno_1/1
+	jne	.L888	# 10582	[c=13 l=6]  *jcc
+.L887:
+	movq	1040(%r12), %rcx	# 10586	[c=9 l=8]  *movdi_internal/3
+	movzbl	(%rcx,%rax), %r14d	# 10587	[c=13 l=5]  *zero_extendqisi2/0
+.L889:
+	cmpl	$95, %edx	# 14690	[c=4 l=3]  *cmpsi_1/0
+	leaq	.LC28(%rip), %rsi	# 15775	[c=1 l=7]  *movdi_internal/4
+	movl	%r14d, %ecx	# 10603	[c=4 l=3]  *movsi_internal/0
+	movq	%r12, %rdi	# 10606	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC29(%rip), %rax	# 15776	[c=1 l=7]  *movdi_internal/4
+	cmovne	%rax, %rsi	# 14691	[c=8 l=4]  *movdicc_noc/1
+	call	log_add_data_mov@PLT	# 10607	[c=0 l=5]  *call
+	testl	%r14d, %r13d	# 10609	[c=4 l=3]  *testsi_1/0
+	je	.L891	# 10610	[c=13 l=2]  *jcc
+	movl	(%r12), %eax	# 16746	[c=5 l=4]  *movsi_internal/0
+	addq	$1, 48(%r12)	# 10618	[c=13 l=6]  *adddi_1/0
+	addl	$1, %eax	# 10613	[c=4 l=3]  *addsi_1/0
+	andl	992(%r12), %eax	# 10616	[c=13 l=8]  *andsi_1/1
+	movl	%eax, (%r12)	# 10617	[c=4 l=4]  *movsi_internal/1
+.L891:
+	movq	%rbp, %rsi	# 10621	[c=4 l=3]  *movdi_internal/3
+	movq	%r12, %rdi	# 10622	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 10623	[c=0 l=5]  *call
+	movq	40(%r12), %rax	# 16747	[c=9 l=5]  *movdi_internal/3
+	movq	(%rsp), %rcx	# 16748	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 10625	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rcx), %rdx	# 17301	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r12)	# 10626	[c=4 l=5]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 10628	[c=4 l=3]  *cmpdi_1/0
+	jb	.L297	# 10629	[c=13 l=6]  *jcc
+	movq	56(%r12), %rax	# 16749	[c=9 l=5]  *movdi_internal/3
+	cmpq	%rax, 48(%r12)	# 10632	[c=13 l=5]  *cmpdi_1/0
+	jnb	.L1401	# 10633	[c=13 l=6]  *jcc
+.L892:
+	movq	%r12, %rdi	# 10639	[c=4 l=3]  *movdi_internal/3
+	call	log_is_idle@PLT	# 10640	[c=10 l=5]  *call_value
+	testb	%al, %al	# 10642	[c=4 l=2]  *cmpqi_ccno_1/0
+	jne	.L1402	# 10643	[c=13 l=6]  *jcc
+.L893:
+	movl	(%r12), %r8d	# 10654	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r12, %rdi	# 10659	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r8	# 10655	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r12), %r8	# 10657	[c=13 l=8]  *adddi_1/1
+	movq	%r8, %rbp	# 16751	[c=4 l=3]  *movdi_internal/3
+	movq	%r8, %rsi	# 10658	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 10660	[c=0 l=5]  *call
+	movzbl	9(%rbp), %eax	# 10661	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, (%r12)	# 10662	[c=9 l=4]  *addsi_1/0
+	leaq	handler.1(%rip), %rdi	# 16754	[c=1 l=7]  *movdi_internal/4
+	movzbl	8(%rbp), %eax	# 10665	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 16752	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 10666	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbx,%rdx), %rdx	# 10669	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r12)	# 10670	[c=13 l=5]  *adddi_1/0
+	jmp	*(%rdi,%rax,8)	# 18480	[c=10 l=3]  *indirect_jump
+.L894:
+	movzbl	10(%rbp), %edx	# 10679	[c=13 l=4]  zero_extendqidi2/0
+	movzwl	12(%rbp), %r13d	# 10678	[c=13 l=5]  *zero_extendhisi2/0
+	movl	%edx, %ecx	# 16755	[c=4 l=2]  *movsi_internal/0
+	movq	%rdx, %rax	# 17735	[c=4 l=3]  *movdi_internal/3
+	subl	5176(%r12), %ecx	# 10682	[c=13 l=8]  *subsi_1/1
+	cmpl	5180(%r12), %ecx	# 10683	[c=13 l=8]  *cmpsi_1/1
+	jb	.L895	# 10684	[c=13 l=2]  *jcc
+	movl	%edx, %ecx	# 16757	[c=4 l=2]  *movsi_internal/0
+	sarl	$5, %ecx	# 10686	[c=4 l=3]  *ashrsi3_1/0
+	movslq	%ecx, %rcx	# 10687	[c=4 l=3]  *extendsidi2_rex64/1
+	cmpb	$0, 1080(%r12,%rcx)	# 10688	[c=14 l=9]  *cmpqi_ccno_1/1
+	jne	.L896	# 10689	[c=13 l=6]  *jcc
+.L895:
+	movq	1040(%r12), %rcx	# 10693	[c=9 l=8]  *movdi_internal/3
+	movzbl	(%rcx,%rax), %r14d	# 10694	[c=13 l=5]  *zero_extendqisi2/0
+.L897:
+	cmpl	$95, %edx	# 14702	[c=4 l=3]  *cmpsi_1/0
+	leaq	.LC28(%rip), %rsi	# 15777	[c=1 l=7]  *movdi_internal/4
+	movl	%r14d, %ecx	# 10710	[c=4 l=3]  *movsi_internal/0
+	movq	%r12, %rdi	# 10713	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC29(%rip), %rax	# 15778	[c=1 l=7]  *movdi_internal/4
+	cmovne	%rax, %rsi	# 14703	[c=8 l=4]  *movdicc_noc/1
+	call	log_add_data_mov@PLT	# 10714	[c=0 l=5]  *call
+	testl	%r14d, %r13d	# 10716	[c=4 l=3]  *testsi_1/0
+	je	.L899	# 10717	[c=13 l=2]  *jcc
+	movl	(%r12), %eax	# 16759	[c=5 l=4]  *movsi_internal/0
+	addq	$2, 48(%r12)	# 10725	[c=13 l=6]  *adddi_1/0
+	addl	$2, %eax	# 10720	[c=4 l=3]  *addsi_1/0
+	andl	992(%r12), %eax	# 10723	[c=13 l=8]  *andsi_1/1
+	movl	%eax, (%r12)	# 10724	[c=4 l=4]  *movsi_internal/1
+.L899:
+	movq	%rbp, %rsi	# 10728	[c=4 l=3]  *movdi_internal/3
+	movq	%r12, %rdi	# 10729	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 10730	[c=0 l=5]  *call
+	movq	40(%r12), %rax	# 16760	[c=9 l=5]  *movdi_internal/3
+	movq	(%rsp), %rcx	# 16761	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 10732	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rcx), %rdx	# 17300	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r12)	# 10733	[c=4 l=5]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 10735	[c=4 l=3]  *cmpdi_1/0
+	jb	.L297	# 10736	[c=13 l=6]  *jcc
+	movq	56(%r12), %rax	# 16762	[c=9 l=5]  *movdi_internal/3
+	cmpq	%rax, 48(%r12)	# 10739	[c=13 l=5]  *cmpdi_1/0
+	jnb	.L1403	# 10740	[c=13 l=6]  *jcc
+.L900:
+	movq	%r12, %rdi	# 10746	[c=4 l=3]  *movdi_internal/3
+	call	log_is_idle@PLT	# 10747	[c=10 l=5]  *call_value
+	testb	%al, %al	# 10749	[c=4 l=2]  *cmpqi_ccno_1/0
+	jne	.L1404	# 10750	[c=13 l=6]  *jcc
+.L901:
+	movl	(%r12), %r8d	# 10761	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r12, %rdi	# 10766	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r8	# 10762	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r12), %r8	# 10764	[c=13 l=8]  *adddi_1/1
+	movq	%r8, %rbp	# 16764	[c=4 l=3]  *movdi_internal/3
+	movq	%r8, %rsi	# 10765	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 10767	[c=0 l=5]  *call
+	movzbl	9(%rbp), %eax	# 10768	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, (%r12)	# 10769	[c=9 l=4]  *addsi_1/0
+	leaq	handler.1(%rip), %rdi	# 16767	[c=1 l=7]  *movdi_internal/4
+	movzbl	8(%rbp), %eax	# 10772	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 16765	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 10773	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbx,%rdx), %rdx	# 10776	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r12)	# 10777	[c=13 l=5]  *adddi_1/0
+	jmp	*(%rdi,%rax,8)	# 18479	[c=10 l=3]  *indirect_jump
+.L902:
+	movzbl	10(%rbp), %r14d	# 10786	[c=13 l=5]  zero_extendqidi2/0
+	xorl	%eax, %eax	# 18478	[c=4 l=2]  *movdi_xor
+	movq	%r12, %rdi	# 10795	[c=4 l=3]  *movdi_internal/3
+	movzwl	12(%rbp), %r13d	# 10785	[c=13 l=5]  *zero_extendhisi2/0
+	movq	1040(%r12), %rdx	# 10788	[c=9 l=8]  *movdi_internal/3
+	leaq	.LC43(%rip), %rsi	# 10793	[c=1 l=7]  *movdi_internal/4
+	movzbl	(%rdx,%r14), %ecx	# 10789	[c=13 l=5]  *zero_extendqisi2/0
+	movzbl	%r14b, %edx	# 10790	[c=4 l=4]  *zero_extendqisi2/0
+	call	log_append@PLT	# 10797	[c=0 l=5]  *call
+	movq	1040(%r12), %rax	# 10798	[c=9 l=8]  *movdi_internal/3
+	movzbl	(%rax,%r14), %eax	# 10799	[c=13 l=5]  *zero_extendqisi2/0
+	testl	%r13d, %eax	# 10801	[c=4 l=3]  *testsi_1/0
+	jne	.L903	# 10802	[c=13 l=2]  *jcc
+	movl	(%r12), %eax	# 16768	[c=5 l=4]  *movsi_internal/0
+	addq	$1, 48(%r12)	# 10810	[c=13 l=6]  *adddi_1/0
+	addl	$1, %eax	# 10805	[c=4 l=3]  *addsi_1/0
+	andl	992(%r12), %eax	# 10808	[c=13 l=8]  *andsi_1/1
+	movl	%eax, (%r12)	# 10809	[c=4 l=4]  *movsi_internal/1
+.L903:
+	movq	%rbp, %rsi	# 10813	[c=4 l=3]  *movdi_internal/3
+	movq	%r12, %rdi	# 10814	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 10815	[c=0 l=5]  *call
+	movq	40(%r12), %rax	# 16769	[c=9 l=5]  *movdi_internal/3
+	movq	(%rsp), %rcx	# 16770	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 10817	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rcx), %rdx	# 17299	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r12)	# 10818	[c=4 l=5]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 10820	[c=4 l=3]  *cmpdi_1/0
+	jb	.L297	# 10821	[c=13 l=6]  *jcc
+	movq	56(%r12), %rax	# 16771	[c=9 l=5]  *movdi_internal/3
+	cmpq	%rax, 48(%r12)	# 10824	[c=13 l=5]  *cmpdi_1/0
+	jnb	.L1405	# 10825	[c=13 l=6]  *jcc
+.L904:
+	movq	%r12, %rdi	# 10831	[c=4 l=3]  *movdi_internal/3
+	call	log_is_idle@PLT	# 10832	[c=10 l=5]  *call_value
+	testb	%al, %al	# 10834	[c=4 l=2]  *cmpqi_ccno_1/0
+	jne	.L1406	# 10835	[c=13 l=6]  *jcc
+.L905:
+	movl	(%r12), %r8d	# 10846	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r12, %rdi	# 10851	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r8	# 10847	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r12), %r8	# 10849	[c=13 l=8]  *adddi_1/1
+	movq	%r8, %rbp	# 16773	[c=4 l=3]  *movdi_internal/3
+	movq	%r8, %rsi	# 10850	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 10852	[c=0 l=5]  *call
+	movzbl	9(%rbp), %eax	# 10853	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, (%r12)	# 10854	[c=9 l=4]  *addsi_1/0
+	leaq	handler.1(%rip), %rdi	# 16776	[c=1 l=7]  *movdi_internal/4
+	movzbl	8(%rbp), %eax	# 10857	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 16774	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 10858	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbx,%rdx), %rdx	# 10861	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r12)	# 10862	[c=13 l=5]  *adddi_1/0
+	jmp	*(%rdi,%rax,8)	# 18477	[c=10 l=3]  *indirect_jump
+.L906:
+	movzbl	10(%rbp), %r14d	# 10871	[c=13 l=5]  zero_extendqidi2/0
+	xorl	%eax, %eax	# 18476	[c=4 l=2]  *movdi_xor
+	movq	%r12, %rdi	# 10880	[c=4 l=3]  *movdi_internal/3
+	movzwl	12(%rbp), %r13d	# 10870	[c=13 l=5]  *zero_extendhisi2/0
+	movq	1040(%r12), %rdx	# 10873	[c=9 l=8]  *movdi_internal/3
+	leaq	.LC43(%rip), %rsi	# 10878	[c=1 l=7]  *movdi_internal/4
+	movzbl	(%rdx,%r14), %ecx	# 10874	[c=13 l=5]  *zero_extendqisi2/0
+	movzbl	%r14b, %edx	# 10875	[c=4 l=4]  *zero_extendqisi2/0
+	call	log_append@PLT	# 10882	[c=0 l=5]  *call
+	movq	1040(%r12), %rax	# 10883	[c=9 l=8]  *movdi_internal/3
+	movzbl	(%rax,%r14), %eax	# 10884	[c=13 l=5]  *zero_extendqisi2/0
+	testl	%r13d, %eax	# 10886	[c=4 l=3]  *testsi_1/0
+	jne	.L907	# 10887	[c=13 l=2]  *jcc
+	movl	(%r12), %eax	# 16777	[c=5 l=4]  *movsi_internal/0
+	addq	$2, 48(%r12)	# 10895	[c=13 l=6]  *adddi_1/0
+	addl	$2, %eax	# 10890	[c=4 l=3]  *addsi_1/0
+	andl	992(%r12), %eax	# 10893	[c=13 l=8]  *andsi_1/1
+	movl	%eax, (%r12)	# 10894	[c=4 l=4]  *movsi_internal/1
+.L907:
+	movq	%rbp, %rsi	# 10898	[c=4 l=3]  *movdi_internal/3
+	movq	%r12, %rdi	# 10899	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 10900	[c=0 l=5]  *call
+	movq	40(%r12), %rax	# 16778	[c=9 l=5]  *movdi_internal/3
+	movq	(%rsp), %rcx	# 16779	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 10902	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rcx), %rdx	# 17298	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r12)	# 10903	[c=4 l=5]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 10905	[c=4 l=3]  *cmpdi_1/0
+	jb	.L297	# 10906	[c=13 l=6]  *jcc
+	movq	56(%r12), %rax	# 16780	[c=9 l=5]  *movdi_internal/3
+	cmpq	%rax, 48(%r12)	# 10909	[c=13 l=5]  *cmpdi_1/0
+	jnb	.L1407	# 10910	[c=13 l=6]  *jcc
+.L908:
+	movq	%r12, %rdi	# 10916	[c=4 l=3]  *movdi_internal/3
+	call	log_is_idle@PLT	# 10917	[c=10 l=5]  *call_value
+	testb	%al, %al	# 10919	[c=4 l=2]  *cmpqi_ccno_1/0
+	jne	.L1408	# 10920	[c=13 l=6]  *jcc
+.L909:
+	movl	(%r12), %r8d	# 10931	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r12, %rdi	# 10936	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r8	# 10932	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r12), %r8	# 10934	[c=13 l=8]  *adddi_1/1
+	movq	%r8, %rbp	# 16782	[c=4 l=3]  *movdi_internal/3
+	movq	%r8, %rsi	# 10935	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 10937	[c=0 l=5]  *call
+	movzbl	9(%rbp), %eax	# 10938	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, (%r12)	# 10939	[c=9 l=4]  *addsi_1/0
+	leaq	handler.1(%rip), %rdi	# 16785	[c=1 l=7]  *movdi_internal/4
+	movzbl	8(%rbp), %eax	# 10942	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 16783	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 10943	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbx,%rdx), %rdx	# 10946	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r12)	# 10947	[c=13 l=5]  *adddi_1/0
+	jmp	*(%rdi,%rax,8)	# 18475	[c=10 l=3]  *indirect_jump
+.L910:
+	movzbl	10(%rbp), %r14d	# 10956	[c=13 l=5]  zero_extendqidi2/0
+	xorl	%eax, %eax	# 18474	[c=4 l=2]  *movdi_xor
+	movq	%r12, %rdi	# 10965	[c=4 l=3]  *movdi_internal/3
+	movzwl	12(%rbp), %r13d	# 10955	[c=13 l=5]  *zero_extendhisi2/0
+	movq	1040(%r12), %rdx	# 10958	[c=9 l=8]  *movdi_internal/3
+	leaq	.LC43(%rip), %rsi	# 10963	[c=1 l=7]  *movdi_internal/4
+	movzbl	(%rdx,%r14), %ecx	# 10959	[c=13 l=5]  *zero_extendqisi2/0
+	movzbl	%r14b, %edx	# 10960	[c=4 l=4]  *zero_extendqisi2/0
+	call	log_append@PLT	# 10967	[c=0 l=5]  *call
+	movq	1040(%r12), %rax	# 10968	[c=9 l=8]  *movdi_internal/3
+	movzbl	(%rax,%r14), %eax	# 10969	[c=13 l=5]  *zero_extendqisi2/0
+	testl	%r13d, %eax	# 10971	[c=4 l=3]  *testsi_1/0
+	je	.L911	# 10972	[c=13 l=2]  *jcc
+	movl	(%r12), %eax	# 16786	[c=5 l=4]  *movsi_internal/0
+	addq	$1, 48(%r12)	# 10980	[c=13 l=6]  *adddi_1/0
+	addl	$1, %eax	# 10975	[c=4 l=3]  *addsi_1/0
+	andl	992(%r12), %eax	# 10978	[c=13 l=8]  *andsi_1/1
+	movl	%eax, (%r12)	# 10979	[c=4 l=4]  *movsi_internal/1
+.L911:
+	movq	%rbp, %rsi	# 10983	[c=4 l=3]  *movdi_internal/3
+	movq	%r12, %rdi	# 10984	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 10985	[c=0 l=5]  *call
+	movq	40(%r12), %rax	# 16787	[c=9 l=5]  *movdi_internal/3
+	movq	(%rsp), %rcx	# 16788	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 10987	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rcx), %rdx	# 17297	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r12)	# 10988	[c=4 l=5]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 10990	[c=4 l=3]  *cmpdi_1/0
+	jb	.L297	# 10991	[c=13 l=6]  *jcc
+	movq	56(%r12), %rax	# 16789	[c=9 l=5]  *movdi_internal/3
+	cmpq	%rax, 48(%r12)	# 10994	[c=13 l=5]  *cmpdi_1/0
+	jnb	.L1409	# 10995	[c=13 l=6]  *jcc
+.L912:
+	movq	%r12, %rdi	# 11001	[c=4 l=3]  *movdi_internal/3
+	call	log_is_idle@PLT	# 11002	[c=10 l=5]  *call_value
+	testb	%al, %al	# 11004	[c=4 l=2]  *cmpqi_ccno_1/0
+	jne	.L1410	# 11005	[c=13 l=6]  *jcc
+.L913:
+	movl	(%r12), %r8d	# 11016	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r12, %rdi	# 11021	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r8	# 11017	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r12), %r8	# 11019	[c=13 l=8]  *adddi_1/1
+	movq	%r8, %rbp	# 16791	[c=4 l=3]  *movdi_internal/3
+	movq	%r8, %rsi	# 11020	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 11022	[c=0 l=5]  *call
+	movzbl	9(%rbp), %eax	# 11023	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, (%r12)	# 11024	[c=9 l=4]  *addsi_1/0
+	leaq	handler.1(%rip), %rdi	# 16794	[c=1 l=7]  *movdi_internal/4
+	movzbl	8(%rbp), %eax	# 11027	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 16792	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 11028	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbx,%rdx), %rdx	# 11031	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r12)	# 11032	[c=13 l=5]  *adddi_1/0
+	jmp	*(%rdi,%rax,8)	# 18473	[c=10 l=3]  *indirect_jump
+.L914:
+	movzbl	10(%rbp), %r14d	# 11041	[c=13 l=5]  zero_extendqidi2/0
+	xorl	%eax, %eax	# 18472	[c=4 l=2]  *movdi_xor
+	movq	%r12, %rdi	# 11050	[c=4 l=3]  *movdi_internal/3
+	movzwl	12(%rbp), %r13d	# 11040	[c=13 l=5]  *zero_extendhisi2/0
+	movq	1040(%r12), %rdx	# 11043	[c=9 l=8]  *movdi_internal/3
+	leaq	.LC43(%rip), %rsi	# 11048	[c=1 l=7]  *movdi_internal/4
+	movzbl	(%rdx,%r14), %ecx	# 11044	[c=13 l=5]  *zero_extendqisi2/0
+	movzbl	%r14b, %edx	# 11045	[c=4 l=4]  *zero_extendqisi2/0
+	call	log_append@PLT	# 11052	[c=0 l=5]  *call
+	movq	1040(%r12), %rax	# 11053	[c=9 l=8]  *movdi_internal/3
+	movzbl	(%rax,%r14), %eax	# 11054	[c=13 l=5]  *zero_extendqisi2/0
+	testl	%r13d, %eax	# 11056	[c=4 l=3]  *testsi_1/0
+	je	.L915	# 11057	[c=13 l=2]  *jcc
+	movl	(%r12), %eax	# 16795	[c=5 l=4]  *movsi_internal/0
+	addq	$2, 48(%r12)	# 11065	[c=13 l=6]  *adddi_1/0
+	addl	$2, %eax	# 11060	[c=4 l=3]  *addsi_1/0
+	andl	992(%r12), %eax	# 11063	[c=13 l=8]  *andsi_1/1
+	movl	%eax, (%r12)	# 11064	[c=4 l=4]  *movsi_internal/1
+.L915:
+	movq	%rbp, %rsi	# 11068	[c=4 l=3]  *movdi_internal/3
+	movq	%r12, %rdi	# 11069	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 11070	[c=0 l=5]  *call
+	movq	40(%r12), %rax	# 16796	[c=9 l=5]  *movdi_internal/3
+	movq	(%rsp), %rcx	# 16797	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 11072	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rcx), %rdx	# 17296	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r12)	# 11073	[c=4 l=5]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 11075	[c=4 l=3]  *cmpdi_1/0
+	jb	.L297	# 11076	[c=13 l=6]  *jcc
+	movq	56(%r12), %rax	# 16798	[c=9 l=5]  *movdi_internal/3
+	cmpq	%rax, 48(%r12)	# 11079	[c=13 l=5]  *cmpdi_1/0
+	jnb	.L1411	# 11080	[c=13 l=6]  *jcc
+.L916:
+	movq	%r12, %rdi	# 11086	[c=4 l=3]  *movdi_internal/3
+	call	log_is_idle@PLT	# 11087	[c=10 l=5]  *call_value
+	testb	%al, %al	# 11089	[c=4 l=2]  *cmpqi_ccno_1/0
+	jne	.L1412	# 11090	[c=13 l=6]  *jcc
+.L917:
+	movl	(%r12), %r8d	# 11101	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r12, %rdi	# 11106	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r8	# 11102	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r12), %r8	# 11104	[c=13 l=8]  *adddi_1/1
+	movq	%r8, %rbp	# 16800	[c=4 l=3]  *movdi_internal/3
+	movq	%r8, %rsi	# 11105	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 11107	[c=0 l=5]  *call
+	movzbl	9(%rbp), %eax	# 11108	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, (%r12)	# 11109	[c=9 l=4]  *addsi_1/0
+	leaq	handler.1(%rip), %rdi	# 16803	[c=1 l=7]  *movdi_internal/4
+	movzbl	8(%rbp), %eax	# 11112	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 16801	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 11113	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbx,%rdx), %rdx	# 11116	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r12)	# 11117	[c=13 l=5]  *adddi_1/0
+	jmp	*(%rdi,%rax,8)	# 18471	[c=10 l=3]  *indirect_jump
+.L918:
+	movslq	892(%r12), %rcx	# 11128	[c=13 l=8]  *extendsidi2_rex64/1
+	leaq	se.0(%rip), %rdx	# 11127	[c=1 l=7]  *movdi_internal/4
+	movq	1040(%r12), %rsi	# 11125	[c=9 l=8]  *movdi_internal/3
+	movzwl	(%rdx,%rcx,4), %eax	# 11129	[c=14 l=4]  zero_extendhidi2/0
+	movzbl	(%rsi,%rax), %eax	# 11132	[c=9 l=4]  *movqi_internal/4
+	andb	2(%rdx,%rcx,4), %al	# 11133	[c=14 l=4]  *andqi_2_maybe_si/1
+	je	.L919	# 11135	[c=13 l=2]  *jcc
+	cmpb	$0, 95(%rsi)	# 11140	[c=13 l=4]  *cmpqi_ccno_1/1
+	movq	48(%r12), %r13	# 11137	[c=9 l=5]  *movdi_internal/3
+	jns	.L921	# 11141	[c=13 l=6]  *jcc
+	movq	%r12, %rdi	# 11152	[c=4 l=3]  *movdi_internal/3
+	call	events_sleep@PLT	# 11153	[c=10 l=5]  *call_value
+	testb	%al, %al	# 11156	[c=4 l=2]  *cmpqi_ccno_1/0
+	je	.L921	# 11157	[c=13 l=6]  *jcc
+	movq	48(%r12), %rdx	# 16804	[c=9 l=5]  *movdi_internal/3
+	leaq	.LC65(%rip), %rsi	# 11163	[c=1 l=7]  *movdi_internal/4
+	movq	%r12, %rdi	# 11165	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 18469	[c=4 l=2]  *movdi_xor
+	subq	%r13, %rdx	# 11160	[c=4 l=3]  *subdi_1/0
+	addq	%rdx, 64(%r12)	# 11161	[c=13 l=5]  *adddi_1/0
+	call	log_append@PLT	# 11167	[c=0 l=5]  *call
+.L919:
+	movq	%rbp, %rsi	# 11170	[c=4 l=3]  *movdi_internal/3
+	movq	%r12, %rdi	# 11171	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 11172	[c=0 l=5]  *call
+	movq	40(%r12), %rax	# 16806	[c=9 l=5]  *movdi_internal/3
+	movq	(%rsp), %rcx	# 16807	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 11174	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rcx), %rdx	# 17295	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r12)	# 11175	[c=4 l=5]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 11177	[c=4 l=3]  *cmpdi_1/0
+	jb	.L297	# 11178	[c=13 l=6]  *jcc
+	movq	56(%r12), %rax	# 16808	[c=9 l=5]  *movdi_internal/3
+	cmpq	%rax, 48(%r12)	# 11181	[c=13 l=5]  *cmpdi_1/0
+	jnb	.L1413	# 11182	[c=13 l=6]  *jcc
+.L922:
+	movq	%r12, %rdi	# 11188	[c=4 l=3]  *movdi_internal/3
+	call	log_is_idle@PLT	# 11189	[c=10 l=5]  *call_value
+	testb	%al, %al	# 11191	[c=4 l=2]  *cmpqi_ccno_1/0
+	jne	.L1414	# 11192	[c=13 l=6]  *jcc
+.L923:
+	movl	(%r12), %r8d	# 11203	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r12, %rdi	# 11208	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r8	# 11204	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r12), %r8	# 11206	[c=13 l=8]  *adddi_1/1
+	movq	%r8, %rbp	# 16810	[c=4 l=3]  *movdi_internal/3
+	movq	%r8, %rsi	# 11207	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 11209	[c=0 l=5]  *call
+	movzbl	9(%rbp), %eax	# 11210	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, (%r12)	# 11211	[c=9 l=4]  *addsi_1/0
+	leaq	handler.1(%rip), %rdi	# 16813	[c=1 l=7]  *movdi_internal/4
+	movzbl	8(%rbp), %eax	# 11214	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 16811	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 11215	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbx,%rdx), %rdx	# 11218	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r12)	# 11219	[c=13 l=5]  *adddi_1/0
+	jmp	*(%rdi,%rax,8)	# 18468	[c=10 l=3]  *indirect_jump
+.L924:
+	movq	1040(%r12), %rax	# 11227	[c=9 l=8]  *movdi_internal/3
+	movl	$30, %edx	# 11230	[c=4 l=5]  *movsi_internal/0
+	leaq	.LC44(%rip), %rsi	# 11231	[c=1 l=7]  *movdi_internal/4
+	movq	%r12, %rdi	# 11233	[c=4 l=3]  *movdi_internal/3
+	movzwl	30(%rax), %r14d	# 11228	[c=13 l=5]  *zero_extendhisi2/0
+	xorl	%eax, %eax	# 18467	[c=4 l=2]  *movdi_xor
+	movl	%r14d, %ecx	# 11229	[c=4 l=3]  *movsi_internal/0
+	call	log_append@PLT	# 11235	[c=0 l=5]  *call
+	cmpl	$65536, 880(%r12)	# 11238	[c=13 l=12]  *cmpsi_1/0
+	jbe	.L925	# 11239	[c=13 l=2]  *jcc
+	movl	$91, %eax	# 11241	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r12), %eax	# 11242	[c=13 l=8]  *subsi_1/1
+	cmpl	5180(%r12), %eax	# 11243	[c=13 l=8]  *cmpsi_1/1
+	jb	.L926	# 11244	[c=13 l=2]  *jcc
+	cmpb	$0, 1082(%r12)	# 11246	[c=13 l=9]  *cmpqi_ccno_1/1
+	jne	.L927	# 11247	[c=13 l=6]  *jcc
+.L926:
+	movq	1040(%r12), %rax	# 11250	[c=9 l=8]  *movdi_internal/3
+	movzbl	91(%rax), %r13d	# 11251	[c=13 l=5]  *zero_extendqisi2/0
+.L928:
+	movl	%r13d, %ecx	# 11262	[c=4 l=3]  *movsi_internal/0
+	movl	$91, %edx	# 11263	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 11266	[c=4 l=3]  *movdi_internal/3
+	sall	$16, %r13d	# 11268	[c=4 l=4]  *ashlsi3_1/0
+	leaq	.LC29(%rip), %rsi	# 11264	[c=1 l=7]  *movdi_internal/4
+	orl	%r13d, %r14d	# 11269	[c=4 l=3]  *iorsi_1/0
+	call	log_add_data_mov@PLT	# 11267	[c=0 l=5]  *call
+.L925:
+	movl	992(%r12), %eax	# 11274	[c=9 l=8]  *movsi_internal/0
+	movl	6044(%r12), %r15d	# 11272	[c=9 l=8]  *movsi_internal/0
+	movq	%r12, %rdi	# 11284	[c=4 l=3]  *movdi_internal/3
+	leal	1(%rax,%rax), %r13d	# 11276	[c=8 l=5]  *leasi
+	movl	%r15d, %eax	# 16814	[c=4 l=3]  *movsi_internal/0
+	negl	%eax	# 11277	[c=4 l=2]  *negsi_1
+	andl	%eax, %r13d	# 11278	[c=4 l=3]  *andsi_1/0
+	leaq	6052(%r12), %rax	# 17294	[c=4 l=8]  *leadi
+	andl	%r14d, %r13d	# 11279	[c=4 l=3]  *andsi_1/0
+	movq	%rax, 16(%rsp)	# 16816	[c=4 l=5]  *movdi_internal/5
+	movl	%r13d, %ecx	# 11280	[c=1 l=3]  *zero_extendsidi2/3
+	addq	1056(%r12), %rcx	# 11282	[c=13 l=8]  *adddi_1/1
+	movq	%rcx, 8(%rsp)	# 17199	[c=4 l=5]  *movdi_internal/5
+	call	spm_operation	# 11285	[c=10 l=5]  *call_value
+	movq	8(%rsp), %rcx	# 17200	[c=9 l=5]  *movdi_internal/3
+	cmpl	$3, %eax	# 11287	[c=4 l=3]  *cmpsi_1/0
+	je	.L1415	# 11288	[c=13 l=6]  *jcc
+	jg	.L930	# 11293	[c=13 l=6]  *jcc
+	cmpl	$1, %eax	# 11295	[c=4 l=3]  *cmpsi_1/0
+	je	.L931	# 11296	[c=13 l=6]  *jcc
+	cmpl	$2, %eax	# 11298	[c=4 l=3]  *cmpsi_1/0
+	jne	.L933	# 11299	[c=13 l=2]  *jcc
+	movl	%r13d, %edx	# 11347	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC61(%rip), %rsi	# 11348	[c=1 l=7]  *movdi_internal/4
+	movq	%r12, %rdi	# 11350	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 18462	[c=4 l=2]  *movdi_xor
+	movq	%rcx, 8(%rsp)	# 17202	[c=4 l=5]  *movdi_internal/5
+	call	log_append@PLT	# 11352	[c=0 l=5]  *call
+	movq	8(%rsp), %rdi	# 18463	[c=9 l=5]  *movdi_internal/3
+	movl	%r15d, %edx	# 11354	[c=1 l=3]  *zero_extendsidi2/3
+	movl	$255, %esi	# 11356	[c=4 l=5]  *movsi_internal/0
+.L1218:
+	call	memset@PLT	# 11399	[c=10 l=5]  *call_value
+	leal	(%r15,%r13), %edx	# 17290	[c=4 l=4]  *leasi
+	movl	%r13d, %esi	# 11402	[c=4 l=3]  *movsi_internal/0
+	movq	%r12, %rdi	# 11403	[c=4 l=3]  *movdi_internal/3
+	call	flash_changed	# 11404	[c=0 l=5]  *call
+.L933:
+	movq	%rbp, %rsi	# 11407	[c=4 l=3]  *movdi_internal/3
+	movq	%r12, %rdi	# 11408	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 11409	[c=0 l=5]  *call
+	movq	40(%r12), %rax	# 16819	[c=9 l=5]  *movdi_internal/3
+	movq	(%rsp), %rcx	# 16820	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 11411	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rcx), %rdx	# 17289	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r12)	# 11412	[c=4 l=5]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 11414	[c=4 l=3]  *cmpdi_1/0
+	jb	.L297	# 11415	[c=13 l=6]  *jcc
+	movq	56(%r12), %rax	# 16821	[c=9 l=5]  *movdi_internal/3
+	cmpq	%rax, 48(%r12)	# 11418	[c=13 l=5]  *cmpdi_1/0
+	jnb	.L1416	# 11419	[c=13 l=6]  *jcc
+.L937:
+	movq	%r12, %rdi	# 11425	[c=4 l=3]  *movdi_internal/3
+	call	log_is_idle@PLT	# 11426	[c=10 l=5]  *call_value
+	testb	%al, %al	# 11428	[c=4 l=2]  *cmpqi_ccno_1/0
+	jne	.L1417	# 11429	[c=13 l=6]  *jcc
+.L938:
+	movl	(%r12), %r8d	# 11440	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r12, %rdi	# 11445	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r8	# 11441	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r12), %r8	# 11443	[c=13 l=8]  *adddi_1/1
+	movq	%r8, %rbp	# 16823	[c=4 l=3]  *movdi_internal/3
+	movq	%r8, %rsi	# 11444	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 11446	[c=0 l=5]  *call
+	movzbl	9(%rbp), %eax	# 11447	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, (%r12)	# 11448	[c=9 l=4]  *addsi_1/0
+	leaq	handler.1(%rip), %rdi	# 16826	[c=1 l=7]  *movdi_internal/4
+	movzbl	8(%rbp), %eax	# 11451	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 16824	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 11452	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbx,%rdx), %rdx	# 11455	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r12)	# 11456	[c=13 l=5]  *adddi_1/0
+	jmp	*(%rdi,%rax,8)	# 18459	[c=10 l=3]  *indirect_jump
+.L939:
+	movzwl	12(%rbp), %eax	# 11464	[c=13 l=4]  *zero_extendhisi2/0
+	movl	$28, %edx	# 11469	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 11472	[c=4 l=3]  *movdi_internal/3
+	movzbl	10(%rbp), %r13d	# 11465	[c=13 l=5]  zero_extendqidi2/0
+	leaq	.LC44(%rip), %rsi	# 11470	[c=1 l=7]  *movdi_internal/4
+	movl	%eax, 8(%rsp)	# 16827	[c=4 l=4]  *movsi_internal/1
+	movq	1040(%r12), %rax	# 11466	[c=9 l=8]  *movdi_internal/3
+	movzwl	28(%rax), %r15d	# 11467	[c=13 l=5]  *zero_extendhisi2/0
+	xorl	%eax, %eax	# 18457	[c=4 l=2]  *movdi_xor
+	movl	%r15d, %ecx	# 11468	[c=4 l=3]  *movsi_internal/0
+	call	log_append@PLT	# 11474	[c=0 l=5]  *call
+	movq	1040(%r12), %rax	# 11476	[c=9 l=8]  *movdi_internal/3
+	movzbl	%r13b, %edx	# 11478	[c=4 l=4]  *zero_extendqisi2/0
+	movq	%r12, %rdi	# 11483	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC43(%rip), %rsi	# 11481	[c=1 l=7]  *movdi_internal/4
+	movzbl	(%rax,%r13), %ecx	# 11477	[c=13 l=5]  *zero_extendqisi2/0
+	xorl	%eax, %eax	# 18458	[c=4 l=2]  *movdi_xor
+	call	log_append@PLT	# 11485	[c=0 l=5]  *call
+	movq	1040(%r12), %rax	# 11486	[c=9 l=8]  *movdi_internal/3
+	leaq	.LC31(%rip), %rdx	# 15780	[c=1 l=7]  *movdi_internal/4
+	movq	%r12, %rdi	# 11498	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC30(%rip), %rsi	# 15779	[c=1 l=7]  *movdi_internal/4
+	movzbl	(%rax,%r13), %ecx	# 11487	[c=13 l=5]  *zero_extendqisi2/0
+	movl	8(%rsp), %eax	# 16829	[c=9 l=4]  *movsi_internal/0
+	leal	(%rax,%r15), %r13d	# 17288	[c=4 l=4]  *leasi
+	movl	%ecx, 16(%rsp)	# 17207	[c=4 l=4]  *movsi_internal/1
+	movl	%ecx, %r14d	# 17741	[c=4 l=3]  *movsi_internal/0
+	cmpl	$95, %r13d	# 14714	[c=4 l=4]  *cmpsi_1/0
+	cmovne	%rdx, %rsi	# 14715	[c=8 l=4]  *movdicc_noc/1
+	movl	%r13d, %edx	# 11496	[c=4 l=3]  *movsi_internal/0
+	call	log_add_data_mov@PLT	# 11499	[c=0 l=5]  *call
+	movl	%r13d, %edx	# 16830	[c=4 l=3]  *movsi_internal/0
+	subl	5176(%r12), %edx	# 11500	[c=13 l=8]  *subsi_1/1
+	cmpl	5180(%r12), %edx	# 11501	[c=13 l=8]  *cmpsi_1/1
+	jb	.L941	# 11502	[c=13 l=2]  *jcc
+	movl	%r13d, %edx	# 16832	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %edx	# 11504	[c=4 l=3]  *ashrsi3_1/0
+	movslq	%edx, %rdx	# 11505	[c=4 l=3]  *extendsidi2_rex64/1
+	cmpb	$0, 1080(%r12,%rdx)	# 11506	[c=14 l=9]  *cmpqi_ccno_1/1
+	jne	.L942	# 11507	[c=13 l=6]  *jcc
+.L941:
+	movq	1040(%r12), %rdx	# 11511	[c=9 l=8]  *movdi_internal/3
+	movslq	%r13d, %r13	# 11510	[c=4 l=3]  *extendsidi2_rex64/1
+	movb	%r14b, (%rdx,%r13)	# 11512	[c=4 l=4]  *movqi_internal/8
+.L943:
+	movq	%rbp, %rsi	# 11523	[c=4 l=3]  *movdi_internal/3
+	movq	%r12, %rdi	# 11524	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 11525	[c=0 l=5]  *call
+	movq	40(%r12), %rax	# 16834	[c=9 l=5]  *movdi_internal/3
+	movq	(%rsp), %rcx	# 16835	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 11527	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rcx), %rdx	# 17287	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r12)	# 11528	[c=4 l=5]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 11530	[c=4 l=3]  *cmpdi_1/0
+	jb	.L297	# 11531	[c=13 l=6]  *jcc
+	movl	(%r12), %r8d	# 11533	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r12, %rdi	# 11538	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r8	# 11534	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r12), %r8	# 11536	[c=13 l=8]  *adddi_1/1
+	movq	%r8, %rbp	# 16837	[c=4 l=3]  *movdi_internal/3
+	movq	%r8, %rsi	# 11537	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 11539	[c=0 l=5]  *call
+	movzbl	9(%rbp), %eax	# 11540	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, (%r12)	# 11541	[c=9 l=4]  *addsi_1/0
+	leaq	handler.1(%rip), %rdi	# 16840	[c=1 l=7]  *movdi_internal/4
+	movzbl	8(%rbp), %eax	# 11544	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 16838	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 11545	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbx,%rdx), %rdx	# 11548	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r12)	# 11549	[c=13 l=5]  *adddi_1/0
+	jmp	*(%rdi,%rax,8)	# 18456	[c=10 l=3]  *indirect_jump
+.L944:
+	movzwl	12(%rbp), %eax	# 11557	[c=13 l=4]  *zero_extendhisi2/0
+	movl	$30, %edx	# 11562	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 11565	[c=4 l=3]  *movdi_internal/3
+	movzbl	10(%rbp), %r13d	# 11558	[c=13 l=5]  zero_extendqidi2/0
+	leaq	.LC44(%rip), %rsi	# 11563	[c=1 l=7]  *movdi_internal/4
+	movl	%eax, 8(%rsp)	# 16841	[c=4 l=4]  *movsi_internal/1
+	movq	1040(%r12), %rax	# 11559	[c=9 l=8]  *movdi_internal/3
+	movzwl	30(%rax), %r15d	# 11560	[c=13 l=5]  *zero_extendhisi2/0
+	xorl	%eax, %eax	# 18454	[c=4 l=2]  *movdi_xor
+	movl	%r15d, %ecx	# 11561	[c=4 l=3]  *movsi_internal/0
+	call	log_append@PLT	# 11567	[c=0 l=5]  *call
+	movq	1040(%r12), %rax	# 11569	[c=9 l=8]  *movdi_internal/3
+	movzbl	%r13b, %edx	# 11571	[c=4 l=4]  *zero_extendqisi2/0
+	movq	%r12, %rdi	# 11576	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC43(%rip), %rsi	# 11574	[c=1 l=7]  *movdi_internal/4
+	movzbl	(%rax,%r13), %ecx	# 11570	[c=13 l=5]  *zero_extendqisi2/0
+	xorl	%eax, %eax	# 18455	[c=4 l=2]  *movdi_xor
+	call	log_append@PLT	# 11578	[c=0 l=5]  *call
+	movq	1040(%r12), %rax	# 11579	[c=9 l=8]  *movdi_internal/3
+	leaq	.LC31(%rip), %rdx	# 15782	[c=1 l=7]  *movdi_internal/4
+	movq	%r12, %rdi	# 11591	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC30(%rip), %rsi	# 15781	[c=1 l=7]  *movdi_internal/4
+	movzbl	(%rax,%r13), %ecx	# 11580	[c=13 l=5]  *zero_extendqisi2/0
+	movl	8(%rsp), %eax	# 16843	[c=9 l=4]  *movsi_internal/0
+	leal	(%rax,%r15), %r13d	# 17286	[c=4 l=4]  *leasi
+	movl	%ecx, 16(%rsp)	# 17209	[c=4 l=4]  *movsi_internal/1
+	movl	%ecx, %r14d	# 17743	[c=4 l=3]  *movsi_internal/0
+	cmpl	$95, %r13d	# 14726	[c=4 l=4]  *cmpsi_1/0
+	cmovne	%rdx, %rsi	# 14727	[c=8 l=4]  *movdicc_noc/1
+	movl	%r13d, %edx	# 11589	[c=4 l=3]  *movsi_internal/0
+	call	log_add_data_mov@PLT	# 11592	[c=0 l=5]  *call
+	movl	%r13d, %edx	# 16844	[c=4 l=3]  *movsi_internal/0
+	subl	5176(%r12), %edx	# 11593	[c=13 l=8]  *subsi_1/1
+	cmpl	5180(%r12), %edx	# 11594	[c=13 l=8]  *cmpsi_1/1
+	jb	.L946	# 11595	[c=13 l=2]  *jcc
+	movl	%r13d, %edx	# 16846	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %edx	# 11597	[c=4 l=3]  *ashrsi3_1/0
+	movslq	%edx, %rdx	# 11598	[c=4 l=3]  *extendsidi2_rex64/1
+	cmpb	$0, 1080(%r12,%rdx)	# 11599	[c=14 l=9]  *cmpqi_ccno_1/1
+	jne	.L947	# 11600	[c=13 l=6]  *jcc
+.L946:
+	movq	1040(%r12), %rdx	# 11604	[c=9 l=8]  *movdi_internal/3
+	movslq	%r13d, %r13	# 11603	[c=4 l=3]  *extendsidi2_rex64/1
+	movb	%r14b, (%rdx,%r13)	# 11605	[c=4 l=4]  *movqi_internal/8
+.L948:
+	movq	%rbp, %rsi	# 11616	[c=4 l=3]  *movdi_internal/3
+	movq	%r12, %rdi	# 11617	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 11618	[c=0 l=5]  *call
+	movq	40(%r12), %rax	# 16848	[c=9 l=5]  *movdi_internal/3
+	movq	(%rsp), %rcx	# 16849	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 11620	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rcx), %rdx	# 17285	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r12)	# 11621	[c=4 l=5]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 11623	[c=4 l=3]  *cmpdi_1/0
+	jb	.L297	# 11624	[c=13 l=6]  *jcc
+	movl	(%r12), %r8d	# 11626	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r12, %rdi	# 11631	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r8	# 11627	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r12), %r8	# 11629	[c=13 l=8]  *adddi_1/1
+	movq	%r8, %rbp	# 16851	[c=4 l=3]  *movdi_internal/3
+	movq	%r8, %rsi	# 11630	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 11632	[c=0 l=5]  *call
+	movzbl	9(%rbp), %eax	# 11633	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, (%r12)	# 11634	[c=9 l=4]  *addsi_1/0
+	leaq	handler.1(%rip), %rdi	# 16854	[c=1 l=7]  *movdi_internal/4
+	movzbl	8(%rbp), %eax	# 11637	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 16852	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 11638	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbx,%rdx), %rdx	# 11641	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r12)	# 11642	[c=13 l=5]  *adddi_1/0
+	jmp	*(%rdi,%rax,8)	# 18453	[c=10 l=3]  *indirect_jump
+.L949:
+	movzbl	10(%rbp), %r13d	# 11652	[c=13 l=5]  zero_extendqidi2/0
+	xorl	%eax, %eax	# 18452	[c=4 l=2]  *movdi_xor
+	movq	%r12, %rdi	# 11661	[c=4 l=3]  *movdi_internal/3
+	movzwl	12(%rbp), %r14d	# 11650	[c=13 l=5]  *zero_extendhisi2/0
+	movq	1040(%r12), %rdx	# 11654	[c=9 l=8]  *movdi_internal/3
+	leaq	.LC43(%rip), %rsi	# 11659	[c=1 l=7]  *movdi_internal/4
+	movl	%r14d, %r15d	# 17744	[c=4 l=3]  *movsi_internal/0
+	movzbl	(%rdx,%r13), %ecx	# 11655	[c=13 l=5]  *zero_extendqisi2/0
+	movzbl	%r13b, %edx	# 11656	[c=4 l=4]  *zero_extendqisi2/0
+	call	log_append@PLT	# 11663	[c=0 l=5]  *call
+	cmpl	$95, %r14d	# 14738	[c=4 l=4]  *cmpsi_1/0
+	movl	%r14d, %edx	# 11673	[c=4 l=3]  *movsi_internal/0
+	movq	%r12, %rdi	# 11675	[c=4 l=3]  *movdi_internal/3
+	movq	1040(%r12), %rax	# 11664	[c=9 l=8]  *movdi_internal/3
+	leaq	.LC30(%rip), %rsi	# 15783	[c=1 l=7]  *movdi_internal/4
+	movzbl	(%rax,%r13), %ecx	# 11665	[c=13 l=5]  *zero_extendqisi2/0
+	leaq	.LC31(%rip), %rax	# 15784	[c=1 l=7]  *movdi_internal/4
+	cmovne	%rax, %rsi	# 14739	[c=8 l=4]  *movdicc_noc/1
+	movl	%ecx, 8(%rsp)	# 17211	[c=4 l=4]  *movsi_internal/1
+	movl	%ecx, %r13d	# 17746	[c=4 l=3]  *movsi_internal/0
+	call	log_add_data_mov@PLT	# 11676	[c=0 l=5]  *call
+	movl	%r14d, %eax	# 16856	[c=4 l=3]  *movsi_internal/0
+	subl	5176(%r12), %eax	# 11678	[c=13 l=8]  *subsi_1/1
+	cmpl	5180(%r12), %eax	# 11679	[c=13 l=8]  *cmpsi_1/1
+	jb	.L951	# 11680	[c=13 l=2]  *jcc
+	movl	%r14d, %eax	# 16858	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %eax	# 11682	[c=4 l=3]  *ashrsi3_1/0
+	cltq	# 11683	[c=4 l=2]  *extendsidi2_rex64/0
+	cmpb	$0, 1080(%r12,%rax)	# 11684	[c=14 l=9]  *cmpqi_ccno_1/1
+	jne	.L952	# 11685	[c=13 l=6]  *jcc
+.L951:
+	movq	1040(%r12), %rdx	# 11689	[c=9 l=8]  *movdi_internal/3
+	movzwl	%r15w, %eax	# 11688	[c=4 l=4]  zero_extendhidi2/0
+	movb	%r13b, (%rdx,%rax)	# 11690	[c=4 l=4]  *movqi_internal/8
+.L953:
+	movq	%rbp, %rsi	# 11701	[c=4 l=3]  *movdi_internal/3
+	movq	%r12, %rdi	# 11702	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 11703	[c=0 l=5]  *call
+	movq	40(%r12), %rax	# 16860	[c=9 l=5]  *movdi_internal/3
+	movq	(%rsp), %rcx	# 16861	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 11705	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rcx), %rdx	# 17284	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r12)	# 11706	[c=4 l=5]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 11708	[c=4 l=3]  *cmpdi_1/0
+	jb	.L297	# 11709	[c=13 l=6]  *jcc
+	movl	(%r12), %r8d	# 11711	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r12, %rdi	# 11716	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r8	# 11712	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r12), %r8	# 11714	[c=13 l=8]  *adddi_1/1
+	movq	%r8, %rbp	# 16863	[c=4 l=3]  *movdi_internal/3
+	movq	%r8, %rsi	# 11715	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 11717	[c=0 l=5]  *call
+	movzbl	9(%rbp), %eax	# 11718	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, (%r12)	# 11719	[c=9 l=4]  *addsi_1/0
+	leaq	handler.1(%rip), %rdi	# 16866	[c=1 l=7]  *movdi_internal/4
+	movzbl	8(%rbp), %eax	# 11722	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 16864	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 11723	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbx,%rdx), %rdx	# 11726	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r12)	# 11727	[c=13 l=5]  *adddi_1/0
+	jmp	*(%rdi,%rax,8)	# 18451	[c=10 l=3]  *indirect_jump
+.L954:
+	movzbl	10(%rbp), %r13d	# 11737	[c=13 l=5]  zero_extendqidi2/0
+	xorl	%eax, %eax	# 18450	[c=4 l=2]  *movdi_xor
+	movq	%r12, %rdi	# 11746	[c=4 l=3]  *movdi_internal/3
+	movzwl	12(%rbp), %r14d	# 11735	[c=13 l=5]  *zero_extendhisi2/0
+	movq	1040(%r12), %rdx	# 11739	[c=9 l=8]  *movdi_internal/3
+	leaq	.LC43(%rip), %rsi	# 11744	[c=1 l=7]  *movdi_internal/4
+	movl	%r14d, %r15d	# 17747	[c=4 l=3]  *movsi_internal/0
+	movzbl	(%rdx,%r13), %ecx	# 11740	[c=13 l=5]  *zero_extendqisi2/0
+	movzbl	%r13b, %edx	# 11741	[c=4 l=4]  *zero_extendqisi2/0
+	call	log_append@PLT	# 11748	[c=0 l=5]  *call
+	cmpl	$95, %r14d	# 14750	[c=4 l=4]  *cmpsi_1/0
+	movl	%r14d, %edx	# 11758	[c=4 l=3]  *movsi_internal/0
+	movq	%r12, %rdi	# 11760	[c=4 l=3]  *movdi_internal/3
+	movq	1040(%r12), %rax	# 11749	[c=9 l=8]  *movdi_internal/3
+	leaq	.LC30(%rip), %rsi	# 15785	[c=1 l=7]  *movdi_internal/4
+	movzbl	(%rax,%r13), %ecx	# 11750	[c=13 l=5]  *zero_extendqisi2/0
+	leaq	.LC31(%rip), %rax	# 15786	[c=1 l=7]  *movdi_internal/4
+	cmovne	%rax, %rsi	# 14751	[c=8 l=4]  *movdicc_noc/1
+	movl	%ecx, 8(%rsp)	# 17212	[c=4 l=4]  *movsi_internal/1
+	movl	%ecx, %r13d	# 17749	[c=4 l=3]  *movsi_internal/0
+	call	log_add_data_mov@PLT	# 11761	[c=0 l=5]  *call
+	movl	%r14d, %eax	# 16868	[c=4 l=3]  *movsi_internal/0
+	subl	5176(%r12), %eax	# 11763	[c=13 l=8]  *subsi_1/1
+	cmpl	5180(%r12), %eax	# 11764	[c=13 l=8]  *cmpsi_1/1
+	jb	.L956	# 11765	[c=13 l=2]  *jcc
+	movl	%r14d, %eax	# 16870	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %eax	# 11767	[c=4 l=3]  *ashrsi3_1/0
+	cltq	# 11768	[c=4 l=2]  *extendsidi2_rex64/0
+	cmpb	$0, 1080(%r12,%rax)	# 11769	[c=14 l=9]  *cmpqi_ccno_1/1
+	jne	.L957	# 11770	[c=13 l=6]  *jcc
+.L956:
+	movq	1040(%r12), %rdx	# 11774	[c=9 l=8]  *movdi_internal/3
+	movzwl	%r15w, %eax	# 11773	[c=4 l=4]  zero_extendhidi2/0
+	movb	%r13b, (%rdx,%rax)	# 11775	[c=4 l=4]  *movqi_internal/8
+.L958:
+	movq	%rbp, %rsi	# 11786	[c=4 l=3]  *movdi_internal/3
+	movq	%r12, %rdi	# 11787	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 11788	[c=0 l=5]  *call
+	movq	40(%r12), %rax	# 16872	[c=9 l=5]  *movdi_internal/3
+	movq	(%rsp), %rcx	# 16873	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 11790	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rcx), %rdx	# 17283	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r12)	# 11791	[c=4 l=5]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 11793	[c=4 l=3]  *cmpdi_1/0
+	jb	.L297	# 11794	[c=13 l=6]  *jcc
+	movl	(%r12), %r8d	# 11796	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r12, %rdi	# 11801	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r8	# 11797	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r12), %r8	# 11799	[c=13 l=8]  *adddi_1/1
+	movq	%r8, %rbp	# 16875	[c=4 l=3]  *movdi_internal/3
+	movq	%r8, %rsi	# 11800	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 11802	[c=0 l=5]  *call
+	movzbl	9(%rbp), %eax	# 11803	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, (%r12)	# 11804	[c=9 l=4]  *addsi_1/0
+	leaq	handler.1(%rip), %rdi	# 16878	[c=1 l=7]  *movdi_internal/4
+	movzbl	8(%rbp), %eax	# 11807	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 16876	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 11808	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbx,%rdx), %rdx	# 11811	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r12)	# 11812	[c=13 l=5]  *adddi_1/0
+	jmp	*(%rdi,%rax,8)	# 18449	[c=10 l=3]  *indirect_jump
+.L959:
+	movq	1040(%r12), %rax	# 11821	[c=9 l=8]  *movdi_internal/3
+	movzbl	10(%rbp), %r13d	# 11820	[c=9 l=5]  *movqi_internal/4
+	movl	$26, %edx	# 11825	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 11828	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC44(%rip), %rsi	# 11826	[c=1 l=7]  *movdi_internal/4
+	movzwl	26(%rax), %r14d	# 11822	[c=13 l=5]  *zero_extendhisi2/0
+	xorl	%eax, %eax	# 18447	[c=4 l=2]  *movdi_xor
+	movl	%r14d, %ecx	# 11824	[c=4 l=3]  *movsi_internal/0
+	movl	%r14d, %r15d	# 17750	[c=4 l=3]  *movsi_internal/0
+	call	log_append@PLT	# 11830	[c=0 l=5]  *call
+	movzbl	%r13b, %r9d	# 11831	[c=4 l=4]  zero_extendqidi2/0
+	movzbl	%r13b, %edx	# 11834	[c=4 l=4]  *zero_extendqisi2/0
+	movq	%r12, %rdi	# 11839	[c=4 l=3]  *movdi_internal/3
+	movq	1040(%r12), %rax	# 11832	[c=9 l=8]  *movdi_internal/3
+	leaq	.LC43(%rip), %rsi	# 11837	[c=1 l=7]  *movdi_internal/4
+	movq	%r9, 8(%rsp)	# 17214	[c=4 l=5]  *movdi_internal/5
+	movzbl	(%rax,%r9), %ecx	# 11833	[c=13 l=5]  *zero_extendqisi2/0
+	xorl	%eax, %eax	# 18448	[c=4 l=2]  *movdi_xor
+	call	log_append@PLT	# 11841	[c=0 l=5]  *call
+	movq	8(%rsp), %r9	# 17215	[c=9 l=5]  *movdi_internal/3
+	movl	%r14d, %edx	# 11851	[c=4 l=3]  *movsi_internal/0
+	movq	%r12, %rdi	# 11853	[c=4 l=3]  *movdi_internal/3
+	movq	1040(%r12), %rax	# 11842	[c=9 l=8]  *movdi_internal/3
+	cmpl	$95, %r14d	# 14762	[c=4 l=4]  *cmpsi_1/0
+	leaq	.LC30(%rip), %rsi	# 15787	[c=1 l=7]  *movdi_internal/4
+	movzbl	(%rax,%r9), %ecx	# 11843	[c=13 l=5]  *zero_extendqisi2/0
+	leaq	.LC31(%rip), %rax	# 15788	[c=1 l=7]  *movdi_internal/4
+	cmovne	%rax, %rsi	# 14763	[c=8 l=4]  *movdicc_noc/1
+	movl	%ecx, 8(%rsp)	# 17213	[c=4 l=4]  *movsi_internal/1
+	movl	%ecx, %r13d	# 17751	[c=4 l=3]  *movsi_internal/0
+	call	log_add_data_mov@PLT	# 11854	[c=0 l=5]  *call
+	movl	%r14d, %eax	# 16880	[c=4 l=3]  *movsi_internal/0
+	subl	5176(%r12), %eax	# 11856	[c=13 l=8]  *subsi_1/1
+	cmpl	5180(%r12), %eax	# 11857	[c=13 l=8]  *cmpsi_1/1
+	jb	.L961	# 11858	[c=13 l=2]  *jcc
+	movl	%r14d, %eax	# 16882	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %eax	# 11860	[c=4 l=3]  *ashrsi3_1/0
+	cltq	# 11861	[c=4 l=2]  *extendsidi2_rex64/0
+	cmpb	$0, 1080(%r12,%rax)	# 11862	[c=14 l=9]  *cmpqi_ccno_1/1
+	jne	.L962	# 11863	[c=13 l=6]  *jcc
+.L961:
+	movq	1040(%r12), %rdx	# 11867	[c=9 l=8]  *movdi_internal/3
+	movzwl	%r15w, %eax	# 11866	[c=4 l=4]  zero_extendhidi2/0
+	movb	%r13b, (%rdx,%rax)	# 11868	[c=4 l=4]  *movqi_internal/8
+.L963:
+	movq	%rbp, %rsi	# 11879	[c=4 l=3]  *movdi_internal/3
+	movq	%r12, %rdi	# 11880	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 11881	[c=0 l=5]  *call
+	movq	40(%r12), %rax	# 16884	[c=9 l=5]  *movdi_internal/3
+	movq	(%rsp), %rcx	# 16885	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 11883	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rcx), %rdx	# 17282	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r12)	# 11884	[c=4 l=5]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 11886	[c=4 l=3]  *cmpdi_1/0
+	jb	.L297	# 11887	[c=13 l=6]  *jcc
+	movl	(%r12), %r8d	# 11889	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r12, %rdi	# 11894	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r8	# 11890	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r12), %r8	# 11892	[c=13 l=8]  *adddi_1/1
+	movq	%r8, %rbp	# 16887	[c=4 l=3]  *movdi_internal/3
+	movq	%r8, %rsi	# 11893	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 11895	[c=0 l=5]  *call
+	movzbl	9(%rbp), %eax	# 11896	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, (%r12)	# 11897	[c=9 l=4]  *addsi_1/0
+	leaq	handler.1(%rip), %rdi	# 16890	[c=1 l=7]  *movdi_internal/4
+	movzbl	8(%rbp), %eax	# 11900	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 16888	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 11901	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbx,%rdx), %rdx	# 11904	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r12)	# 11905	[c=13 l=5]  *adddi_1/0
+	jmp	*(%rdi,%rax,8)	# 18446	[c=10 l=3]  *indirect_jump
+.L964:
+	movq	1040(%r12), %rax	# 11914	[c=9 l=8]  *movdi_internal/3
+	movl	$26, %edx	# 11917	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 11920	[c=4 l=3]  *movdi_internal/3
+	movzbl	10(%rbp), %r15d	# 11913	[c=13 l=5]  zero_extendqidi2/0
+	leaq	.LC44(%rip), %rsi	# 11918	[c=1 l=7]  *movdi_internal/4
+	movzwl	26(%rax), %r14d	# 11915	[c=13 l=5]  *zero_extendhisi2/0
+	xorl	%eax, %eax	# 18444	[c=4 l=2]  *movdi_xor
+	movl	%r14d, %ecx	# 11916	[c=4 l=3]  *movsi_internal/0
+	subl	$1, %r14d	# 11923	[c=4 l=4]  *addsi_1/0
+	call	log_append@PLT	# 11922	[c=0 l=5]  *call
+	movq	1040(%r12), %rax	# 11925	[c=9 l=8]  *movdi_internal/3
+	movzbl	%r15b, %edx	# 11927	[c=4 l=4]  *zero_extendqisi2/0
+	movq	%r12, %rdi	# 11932	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC43(%rip), %rsi	# 11930	[c=1 l=7]  *movdi_internal/4
+	movzbl	(%rax,%r15), %ecx	# 11926	[c=13 l=5]  *zero_extendqisi2/0
+	xorl	%eax, %eax	# 18445	[c=4 l=2]  *movdi_xor
+	call	log_append@PLT	# 11934	[c=0 l=5]  *call
+	cmpl	$95, %r14d	# 14774	[c=4 l=4]  *cmpsi_1/0
+	movl	%r14d, %edx	# 11944	[c=4 l=3]  *movsi_internal/0
+	movq	%r12, %rdi	# 11946	[c=4 l=3]  *movdi_internal/3
+	movq	1040(%r12), %rax	# 11935	[c=9 l=8]  *movdi_internal/3
+	leaq	.LC30(%rip), %rsi	# 15789	[c=1 l=7]  *movdi_internal/4
+	movzbl	(%rax,%r15), %r13d	# 11936	[c=13 l=5]  *zero_extendqisi2/0
+	leaq	.LC31(%rip), %rax	# 15790	[c=1 l=7]  *movdi_internal/4
+	cmovne	%rax, %rsi	# 14775	[c=8 l=4]  *movdicc_noc/1
+	movl	%r13d, %ecx	# 11943	[c=4 l=3]  *movsi_internal/0
+	movl	%r13d, %r15d	# 17753	[c=4 l=3]  *movsi_internal/0
+	call	log_add_data_mov@PLT	# 11947	[c=0 l=5]  *call
+	movl	%r14d, %eax	# 16891	[c=4 l=3]  *movsi_internal/0
+	subl	5176(%r12), %eax	# 11948	[c=13 l=8]  *subsi_1/1
+	cmpl	5180(%r12), %eax	# 11949	[c=13 l=8]  *cmpsi_1/1
+	jb	.L966	# 11950	[c=13 l=2]  *jcc
+	movl	%r14d, %eax	# 16893	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %eax	# 11952	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 15647	[c=5 l=5]  *andsi_1_zext
+	cmpb	$0, 1080(%r12,%rax)	# 11955	[c=14 l=9]  *cmpqi_ccno_1/1
+	jne	.L967	# 11956	[c=13 l=6]  *jcc
+.L966:
+	movq	1040(%r12), %rdx	# 11960	[c=9 l=8]  *movdi_internal/3
+	movslq	%r14d, %rax	# 11959	[c=4 l=3]  *extendsidi2_rex64/1
+	movb	%r15b, (%rdx,%rax)	# 11961	[c=4 l=4]  *movqi_internal/8
+.L968:
+	movl	$26, %edx	# 11974	[c=4 l=5]  *movsi_internal/0
+	movzwl	%r14w, %ecx	# 11972	[c=4 l=4]  *zero_extendhisi2/0
+	movq	%r12, %rdi	# 11977	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 18442	[c=4 l=2]  *movdi_xor
+	leaq	.LC48(%rip), %rsi	# 11975	[c=1 l=7]  *movdi_internal/4
+	call	log_append@PLT	# 11979	[c=0 l=5]  *call
+	movl	%r14d, %ecx	# 16896	[c=4 l=3]  *movsi_internal/0
+	movq	%rbp, %rsi	# 11985	[c=4 l=3]  *movdi_internal/3
+	movq	%r12, %rdi	# 11986	[c=4 l=3]  *movdi_internal/3
+	movq	1040(%r12), %rax	# 11980	[c=9 l=8]  *movdi_internal/3
+	movb	%r14b, 26(%rax)	# 11981	[c=4 l=4]  *movqi_internal/8
+	movq	1040(%r12), %rax	# 11982	[c=9 l=8]  *movdi_internal/3
+	movb	%ch, 27(%rax)	# 18443	[c=4 l=3]  *extzvqi_mem_rex64
+	call	log_dump_line@PLT	# 11987	[c=0 l=5]  *call
+	movq	40(%r12), %rax	# 16897	[c=9 l=5]  *movdi_internal/3
+	movq	(%rsp), %rcx	# 16898	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 11989	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rcx), %rdx	# 17281	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r12)	# 11990	[c=4 l=5]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 11992	[c=4 l=3]  *cmpdi_1/0
+	jb	.L297	# 11993	[c=13 l=6]  *jcc
+	movl	(%r12), %r8d	# 11995	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r12, %rdi	# 12000	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r8	# 11996	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r12), %r8	# 11998	[c=13 l=8]  *adddi_1/1
+	movq	%r8, %rbp	# 16900	[c=4 l=3]  *movdi_internal/3
+	movq	%r8, %rsi	# 11999	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 12001	[c=0 l=5]  *call
+	movzbl	9(%rbp), %eax	# 12002	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, (%r12)	# 12003	[c=9 l=4]  *addsi_1/0
+	leaq	handler.1(%rip), %rdi	# 16903	[c=1 l=7]  *movdi_internal/4
+	movzbl	8(%rbp), %eax	# 12006	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 16901	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 12007	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbx,%rdx), %rdx	# 12010	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r12)	# 12011	[c=13 l=5]  *adddi_1/0
+	jmp	*(%rdi,%rax,8)	# 18441	[c=10 l=3]  *indirect_jump
+.L969:
+	movq	1040(%r12), %rax	# 12020	[c=9 l=8]  *movdi_internal/3
+	movzbl	10(%rbp), %r14d	# 12019	[c=9 l=5]  *movqi_internal/4
+	movl	$26, %edx	# 12024	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 12027	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC44(%rip), %rsi	# 12025	[c=1 l=7]  *movdi_internal/4
+	movzwl	26(%rax), %r13d	# 12021	[c=13 l=5]  *zero_extendhisi2/0
+	xorl	%eax, %eax	# 18439	[c=4 l=2]  *movdi_xor
+	movl	%r13d, %ecx	# 12023	[c=4 l=3]  *movsi_internal/0
+	movl	%r13d, %r15d	# 17754	[c=4 l=3]  *movsi_internal/0
+	call	log_append@PLT	# 12029	[c=0 l=5]  *call
+	movzbl	%r14b, %r9d	# 12030	[c=4 l=4]  zero_extendqidi2/0
+	movzbl	%r14b, %edx	# 12033	[c=4 l=4]  *zero_extendqisi2/0
+	movq	%r12, %rdi	# 12038	[c=4 l=3]  *movdi_internal/3
+	movq	1040(%r12), %rax	# 12031	[c=9 l=8]  *movdi_internal/3
+	leaq	.LC43(%rip), %rsi	# 12036	[c=1 l=7]  *movdi_internal/4
+	movq	%r9, 8(%rsp)	# 17217	[c=4 l=5]  *movdi_internal/5
+	movzbl	(%rax,%r9), %ecx	# 12032	[c=13 l=5]  *zero_extendqisi2/0
+	xorl	%eax, %eax	# 18440	[c=4 l=2]  *movdi_xor
+	call	log_append@PLT	# 12040	[c=0 l=5]  *call
+	movq	8(%rsp), %r9	# 17218	[c=9 l=5]  *movdi_internal/3
+	movl	%r13d, %edx	# 12050	[c=4 l=3]  *movsi_internal/0
+	movq	%r12, %rdi	# 12052	[c=4 l=3]  *movdi_internal/3
+	movq	1040(%r12), %rax	# 12041	[c=9 l=8]  *movdi_internal/3
+	cmpl	$95, %r13d	# 14786	[c=4 l=4]  *cmpsi_1/0
+	leaq	.LC30(%rip), %rsi	# 15791	[c=1 l=7]  *movdi_internal/4
+	movzbl	(%rax,%r9), %ecx	# 12042	[c=13 l=5]  *zero_extendqisi2/0
+	leaq	.LC31(%rip), %rax	# 15792	[c=1 l=7]  *movdi_internal/4
+	cmovne	%rax, %rsi	# 14787	[c=8 l=4]  *movdicc_noc/1
+	movl	%ecx, 8(%rsp)	# 17216	[c=4 l=4]  *movsi_internal/1
+	movl	%ecx, %r14d	# 17755	[c=4 l=3]  *movsi_internal/0
+	call	log_add_data_mov@PLT	# 12053	[c=0 l=5]  *call
+	movl	%r13d, %eax	# 16905	[c=4 l=3]  *movsi_internal/0
+	subl	5176(%r12), %eax	# 12055	[c=13 l=8]  *subsi_1/1
+	cmpl	5180(%r12), %eax	# 12056	[c=13 l=8]  *cmpsi_1/1
+	jb	.L971	# 12057	[c=13 l=2]  *jcc
+	movl	%r13d, %eax	# 16907	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %eax	# 12059	[c=4 l=3]  *ashrsi3_1/0
+	cltq	# 12060	[c=4 l=2]  *extendsidi2_rex64/0
+	cmpb	$0, 1080(%r12,%rax)	# 12061	[c=14 l=9]  *cmpqi_ccno_1/1
+	jne	.L972	# 12062	[c=13 l=6]  *jcc
+.L971:
+	movq	1040(%r12), %rdx	# 12066	[c=9 l=8]  *movdi_internal/3
+	movzwl	%r15w, %eax	# 12065	[c=4 l=4]  zero_extendhidi2/0
+	movb	%r14b, (%rdx,%rax)	# 12067	[c=4 l=4]  *movqi_internal/8
+.L973:
+	addl	$1, %r13d	# 12078	[c=4 l=4]  *addsi_1/0
+	movl	$26, %edx	# 12081	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 12084	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 18437	[c=4 l=2]  *movdi_xor
+	movzwl	%r13w, %ecx	# 12079	[c=4 l=4]  *zero_extendhisi2/0
+	leaq	.LC48(%rip), %rsi	# 12082	[c=1 l=7]  *movdi_internal/4
+	call	log_append@PLT	# 12086	[c=0 l=5]  *call
+	movl	%r13d, %ecx	# 16910	[c=4 l=3]  *movsi_internal/0
+	movq	%rbp, %rsi	# 12092	[c=4 l=3]  *movdi_internal/3
+	movq	%r12, %rdi	# 12093	[c=4 l=3]  *movdi_internal/3
+	movq	1040(%r12), %rax	# 12087	[c=9 l=8]  *movdi_internal/3
+	movb	%r13b, 26(%rax)	# 12088	[c=4 l=4]  *movqi_internal/8
+	movq	1040(%r12), %rax	# 12089	[c=9 l=8]  *movdi_internal/3
+	movb	%ch, 27(%rax)	# 18438	[c=4 l=3]  *extzvqi_mem_rex64
+	call	log_dump_line@PLT	# 12094	[c=0 l=5]  *call
+	movq	40(%r12), %rax	# 16911	[c=9 l=5]  *movdi_internal/3
+	movq	(%rsp), %rcx	# 16912	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 12096	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rcx), %rdx	# 17280	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r12)	# 12097	[c=4 l=5]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 12099	[c=4 l=3]  *cmpdi_1/0
+	jb	.L297	# 12100	[c=13 l=6]  *jcc
+	movl	(%r12), %r8d	# 12102	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r12, %rdi	# 12107	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r8	# 12103	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r12), %r8	# 12105	[c=13 l=8]  *adddi_1/1
+	movq	%r8, %rbp	# 16914	[c=4 l=3]  *movdi_internal/3
+	movq	%r8, %rsi	# 12106	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 12108	[c=0 l=5]  *call
+	movzbl	9(%rbp), %eax	# 12109	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, (%r12)	# 12110	[c=9 l=4]  *addsi_1/0
+	leaq	handler.1(%rip), %rdi	# 16917	[c=1 l=7]  *movdi_internal/4
+	movzbl	8(%rbp), %eax	# 12113	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 16915	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 12114	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbx,%rdx), %rdx	# 12117	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r12)	# 12118	[c=13 l=5]  *adddi_1/0
+	jmp	*(%rdi,%rax,8)	# 18436	[c=10 l=3]  *indirect_jump
+.L974:
+	movq	1040(%r12), %rax	# 12127	[c=9 l=8]  *movdi_internal/3
+	movl	$28, %edx	# 12130	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 12133	[c=4 l=3]  *movdi_internal/3
+	movzbl	10(%rbp), %r15d	# 12126	[c=13 l=5]  zero_extendqidi2/0
+	leaq	.LC44(%rip), %rsi	# 12131	[c=1 l=7]  *movdi_internal/4
+	movzwl	28(%rax), %r14d	# 12128	[c=13 l=5]  *zero_extendhisi2/0
+	xorl	%eax, %eax	# 18434	[c=4 l=2]  *movdi_xor
+	movl	%r14d, %ecx	# 12129	[c=4 l=3]  *movsi_internal/0
+	subl	$1, %r14d	# 12136	[c=4 l=4]  *addsi_1/0
+	call	log_append@PLT	# 12135	[c=0 l=5]  *call
+	movq	1040(%r12), %rax	# 12138	[c=9 l=8]  *movdi_internal/3
+	movzbl	%r15b, %edx	# 12140	[c=4 l=4]  *zero_extendqisi2/0
+	movq	%r12, %rdi	# 12145	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC43(%rip), %rsi	# 12143	[c=1 l=7]  *movdi_internal/4
+	movzbl	(%rax,%r15), %ecx	# 12139	[c=13 l=5]  *zero_extendqisi2/0
+	xorl	%eax, %eax	# 18435	[c=4 l=2]  *movdi_xor
+	call	log_append@PLT	# 12147	[c=0 l=5]  *call
+	cmpl	$95, %r14d	# 14798	[c=4 l=4]  *cmpsi_1/0
+	movl	%r14d, %edx	# 12157	[c=4 l=3]  *movsi_internal/0
+	movq	%r12, %rdi	# 12159	[c=4 l=3]  *movdi_internal/3
+	movq	1040(%r12), %rax	# 12148	[c=9 l=8]  *movdi_internal/3
+	leaq	.LC30(%rip), %rsi	# 15793	[c=1 l=7]  *movdi_internal/4
+	movzbl	(%rax,%r15), %r13d	# 12149	[c=13 l=5]  *zero_extendqisi2/0
+	leaq	.LC31(%rip), %rax	# 15794	[c=1 l=7]  *movdi_internal/4
+	cmovne	%rax, %rsi	# 14799	[c=8 l=4]  *movdicc_noc/1
+	movl	%r13d, %ecx	# 12156	[c=4 l=3]  *movsi_internal/0
+	movl	%r13d, %r15d	# 17757	[c=4 l=3]  *movsi_internal/0
+	call	log_add_data_mov@PLT	# 12160	[c=0 l=5]  *call
+	movl	%r14d, %eax	# 16918	[c=4 l=3]  *movsi_internal/0
+	subl	5176(%r12), %eax	# 12161	[c=13 l=8]  *subsi_1/1
+	cmpl	5180(%r12), %eax	# 12162	[c=13 l=8]  *cmpsi_1/1
+	jb	.L976	# 12163	[c=13 l=2]  *jcc
+	movl	%r14d, %eax	# 16920	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %eax	# 12165	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 15646	[c=5 l=5]  *andsi_1_zext
+	cmpb	$0, 1080(%r12,%rax)	# 12168	[c=14 l=9]  *cmpqi_ccno_1/1
+	jne	.L977	# 12169	[c=13 l=6]  *jcc
+.L976:
+	movq	1040(%r12), %rdx	# 12173	[c=9 l=8]  *movdi_internal/3
+	movslq	%r14d, %rax	# 12172	[c=4 l=3]  *extendsidi2_rex64/1
+	movb	%r15b, (%rdx,%rax)	# 12174	[c=4 l=4]  *movqi_internal/8
+.L978:
+	movl	$28, %edx	# 12187	[c=4 l=5]  *movsi_internal/0
+	movzwl	%r14w, %ecx	# 12185	[c=4 l=4]  *zero_extendhisi2/0
+	movq	%r12, %rdi	# 12190	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 18432	[c=4 l=2]  *movdi_xor
+	leaq	.LC48(%rip), %rsi	# 12188	[c=1 l=7]  *movdi_internal/4
+	call	log_append@PLT	# 12192	[c=0 l=5]  *call
+	movl	%r14d, %ecx	# 16923	[c=4 l=3]  *movsi_internal/0
+	movq	%rbp, %rsi	# 12198	[c=4 l=3]  *movdi_internal/3
+	movq	%r12, %rdi	# 12199	[c=4 l=3]  *movdi_internal/3
+	movq	1040(%r12), %rax	# 12193	[c=9 l=8]  *movdi_internal/3
+	movb	%r14b, 28(%rax)	# 12194	[c=4 l=4]  *movqi_internal/8
+	movq	1040(%r12), %rax	# 12195	[c=9 l=8]  *movdi_internal/3
+	movb	%ch, 29(%rax)	# 18433	[c=4 l=3]  *extzvqi_mem_rex64
+	call	log_dump_line@PLT	# 12200	[c=0 l=5]  *call
+	movq	40(%r12), %rax	# 16924	[c=9 l=5]  *movdi_internal/3
+	movq	(%rsp), %rcx	# 16925	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 12202	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rcx), %rdx	# 17279	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r12)	# 12203	[c=4 l=5]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 12205	[c=4 l=3]  *cmpdi_1/0
+	jb	.L297	# 12206	[c=13 l=6]  *jcc
+	movl	(%r12), %r8d	# 12208	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r12, %rdi	# 12213	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r8	# 12209	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r12), %r8	# 12211	[c=13 l=8]  *adddi_1/1
+	movq	%r8, %rbp	# 16927	[c=4 l=3]  *movdi_internal/3
+	movq	%r8, %rsi	# 12212	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 12214	[c=0 l=5]  *call
+	movzbl	9(%rbp), %eax	# 12215	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, (%r12)	# 12216	[c=9 l=4]  *addsi_1/0
+	leaq	handler.1(%rip), %rdi	# 16930	[c=1 l=7]  *movdi_internal/4
+	movzbl	8(%rbp), %eax	# 12219	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 16928	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 12220	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbx,%rdx), %rdx	# 12223	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r12)	# 12224	[c=13 l=5]  *adddi_1/0
+	jmp	*(%rdi,%rax,8)	# 18431	[c=10 l=3]  *indirect_jump
+.L979:
+	movq	1040(%r12), %rax	# 12233	[c=9 l=8]  *movdi_internal/3
+	movzbl	10(%rbp), %r14d	# 12232	[c=9 l=5]  *movqi_internal/4
+	movl	$28, %edx	# 12237	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 12240	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC44(%rip), %rsi	# 12238	[c=1 l=7]  *movdi_internal/4
+	movzwl	28(%rax), %r13d	# 12234	[c=13 l=5]  *zero_extendhisi2/0
+	xorl	%eax, %eax	# 18429	[c=4 l=2]  *movdi_xor
+	movl	%r13d, %ecx	# 12236	[c=4 l=3]  *movsi_internal/0
+	movl	%r13d, %r15d	# 17758	[c=4 l=3]  *movsi_internal/0
+	call	log_append@PLT	# 12242	[c=0 l=5]  *call
+	movzbl	%r14b, %r9d	# 12243	[c=4 l=4]  zero_extendqidi2/0
+	movzbl	%r14b, %edx	# 12246	[c=4 l=4]  *zero_extendqisi2/0
+	movq	%r12, %rdi	# 12251	[c=4 l=3]  *movdi_internal/3
+	movq	1040(%r12), %rax	# 12244	[c=9 l=8]  *movdi_internal/3
+	leaq	.LC43(%rip), %rsi	# 12249	[c=1 l=7]  *movdi_internal/4
+	movq	%r9, 8(%rsp)	# 17220	[c=4 l=5]  *movdi_internal/5
+	movzbl	(%rax,%r9), %ecx	# 12245	[c=13 l=5]  *zero_extendqisi2/0
+	xorl	%eax, %eax	# 18430	[c=4 l=2]  *movdi_xor
+	call	log_append@PLT	# 12253	[c=0 l=5]  *call
+	movq	8(%rsp), %r9	# 17221	[c=9 l=5]  *movdi_internal/3
+	movl	%r13d, %edx	# 12263	[c=4 l=3]  *movsi_internal/0
+	movq	%r12, %rdi	# 12265	[c=4 l=3]  *movdi_internal/3
+	movq	1040(%r12), %rax	# 12254	[c=9 l=8]  *movdi_internal/3
+	cmpl	$95, %r13d	# 14810	[c=4 l=4]  *cmpsi_1/0
+	leaq	.LC30(%rip), %rsi	# 15795	[c=1 l=7]  *movdi_internal/4
+	movzbl	(%rax,%r9), %ecx	# 12255	[c=13 l=5]  *zero_extendqisi2/0
+	leaq	.LC31(%rip), %rax	# 15796	[c=1 l=7]  *movdi_internal/4
+	cmovne	%rax, %rsi	# 14811	[c=8 l=4]  *movdicc_noc/1
+	movl	%ecx, 8(%rsp)	# 17219	[c=4 l=4]  *movsi_internal/1
+	movl	%ecx, %r14d	# 17759	[c=4 l=3]  *movsi_internal/0
+	call	log_add_data_mov@PLT	# 12266	[c=0 l=5]  *call
+	movl	%r13d, %eax	# 16932	[c=4 l=3]  *movsi_internal/0
+	subl	5176(%r12), %eax	# 12268	[c=13 l=8]  *subsi_1/1
+	cmpl	5180(%r12), %eax	# 12269	[c=13 l=8]  *cmpsi_1/1
+	jb	.L981	# 12270	[c=13 l=2]  *jcc
+	movl	%r13d, %eax	# 16934	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %eax	# 12272	[c=4 l=3]  *ashrsi3_1/0
+	cltq	# 12273	[c=4 l=2]  *extendsidi2_rex64/0
+	cmpb	$0, 1080(%r12,%rax)	# 12274	[c=14 l=9]  *cmpqi_ccno_1/1
+	jne	.L982	# 12275	[c=13 l=6]  *jcc
+.L981:
+	movq	1040(%r12), %rdx	# 12279	[c=9 l=8]  *movdi_internal/3
+	movzwl	%r15w, %eax	# 12278	[c=4 l=4]  zero_extendhidi2/0
+	movb	%r14b, (%rdx,%rax)	# 12280	[c=4 l=4]  *movqi_internal/8
+.L983:
+	addl	$1, %r13d	# 12291	[c=4 l=4]  *addsi_1/0
+	movl	$28, %edx	# 12294	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 12297	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 18427	[c=4 l=2]  *movdi_xor
+	movzwl	%r13w, %ecx	# 12292	[c=4 l=4]  *zero_extendhisi2/0
+	leaq	.LC48(%rip), %rsi	# 12295	[c=1 l=7]  *movdi_internal/4
+	call	log_append@PLT	# 12299	[c=0 l=5]  *call
+	movl	%r13d, %ecx	# 16937	[c=4 l=3]  *movsi_internal/0
+	movq	%rbp, %rsi	# 12305	[c=4 l=3]  *movdi_internal/3
+	movq	%r12, %rdi	# 12306	[c=4 l=3]  *movdi_internal/3
+	movq	1040(%r12), %rax	# 12300	[c=9 l=8]  *movdi_internal/3
+	movb	%r13b, 28(%rax)	# 12301	[c=4 l=4]  *movqi_internal/8
+	movq	1040(%r12), %rax	# 12302	[c=9 l=8]  *movdi_internal/3
+	movb	%ch, 29(%rax)	# 18428	[c=4 l=3]  *extzvqi_mem_rex64
+	call	log_dump_line@PLT	# 12307	[c=0 l=5]  *call
+	movq	40(%r12), %rax	# 16938	[c=9 l=5]  *movdi_internal/3
+	movq	(%rsp), %rcx	# 16939	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 12309	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rcx), %rdx	# 17278	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r12)	# 12310	[c=4 l=5]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 12312	[c=4 l=3]  *cmpdi_1/0
+	jb	.L297	# 12313	[c=13 l=6]  *jcc
+	movl	(%r12), %r8d	# 12315	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r12, %rdi	# 12320	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r8	# 12316	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r12), %r8	# 12318	[c=13 l=8]  *adddi_1/1
+	movq	%r8, %rbp	# 16941	[c=4 l=3]  *movdi_internal/3
+	movq	%r8, %rsi	# 12319	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 12321	[c=0 l=5]  *call
+	movzbl	9(%rbp), %eax	# 12322	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, (%r12)	# 12323	[c=9 l=4]  *addsi_1/0
+	leaq	handler.1(%rip), %rdi	# 16944	[c=1 l=7]  *movdi_internal/4
+	movzbl	8(%rbp), %eax	# 12326	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 16942	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 12327	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbx,%rdx), %rdx	# 12330	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r12)	# 12331	[c=13 l=5]  *adddi_1/0
+	jmp	*(%rdi,%rax,8)	# 18426	[c=10 l=3]  *indirect_jump
+.L984:
+	movq	1040(%r12), %rax	# 12340	[c=9 l=8]  *movdi_internal/3
+	movl	$30, %edx	# 12343	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 12346	[c=4 l=3]  *movdi_internal/3
+	movzbl	10(%rbp), %r15d	# 12339	[c=13 l=5]  zero_extendqidi2/0
+	leaq	.LC44(%rip), %rsi	# 12344	[c=1 l=7]  *movdi_internal/4
+	movzwl	30(%rax), %r14d	# 12341	[c=13 l=5]  *zero_extendhisi2/0
+	xorl	%eax, %eax	# 18424	[c=4 l=2]  *movdi_xor
+	movl	%r14d, %ecx	# 12342	[c=4 l=3]  *movsi_internal/0
+	subl	$1, %r14d	# 12349	[c=4 l=4]  *addsi_1/0
+	call	log_append@PLT	# 12348	[c=0 l=5]  *call
+	movq	1040(%r12), %rax	# 12351	[c=9 l=8]  *movdi_internal/3
+	movzbl	%r15b, %edx	# 12353	[c=4 l=4]  *zero_extendqisi2/0
+	movq	%r12, %rdi	# 12358	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC43(%rip), %rsi	# 12356	[c=1 l=7]  *movdi_internal/4
+	movzbl	(%rax,%r15), %ecx	# 12352	[c=13 l=5]  *zero_extendqisi2/0
+	xorl	%eax, %eax	# 18425	[c=4 l=2]  *movdi_xor
+	call	log_append@PLT	# 12360	[c=0 l=5]  *call
+	cmpl	$95, %r14d	# 14822	[c=4 l=4]  *cmpsi_1/0
+	movl	%r14d, %edx	# 12370	[c=4 l=3]  *movsi_internal/0
+	movq	%r12, %rdi	# 12372	[c=4 l=3]  *movdi_internal/3
+	movq	1040(%r12), %rax	# 12361	[c=9 l=8]  *movdi_internal/3
+	leaq	.LC30(%rip), %rsi	# 15797	[c=1 l=7]  *movdi_internal/4
+	movzbl	(%rax,%r15), %r13d	# 12362	[c=13 l=5]  *zero_extendqisi2/0
+	leaq	.LC31(%rip), %rax	# 15798	[c=1 l=7]  *movdi_internal/4
+	cmovne	%rax, %rsi	# 14823	[c=8 l=4]  *movdicc_noc/1
+	movl	%r13d, %ecx	# 12369	[c=4 l=3]  *movsi_internal/0
+	movl	%r13d, %r15d	# 17761	[c=4 l=3]  *movsi_internal/0
+	call	log_add_data_mov@PLT	# 12373	[c=0 l=5]  *call
+	movl	%r14d, %eax	# 16945	[c=4 l=3]  *movsi_internal/0
+	subl	5176(%r12), %eax	# 12374	[c=13 l=8]  *subsi_1/1
+	cmpl	5180(%r12), %eax	# 12375	[c=13 l=8]  *cmpsi_1/1
+	jb	.L986	# 12376	[c=13 l=2]  *jcc
+	movl	%r14d, %eax	# 16947	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %eax	# 12378	[c=4 l=3]  *ashrsi3_1/0
+	andl	$4095, %eax	# 15645	[c=5 l=5]  *andsi_1_zext
+	cmpb	$0, 1080(%r12,%rax)	# 12381	[c=14 l=9]  *cmpqi_ccno_1/1
+	jne	.L987	# 12382	[c=13 l=6]  *jcc
+.L986:
+	movq	1040(%r12), %rdx	# 12386	[c=9 l=8]  *movdi_internal/3
+	movslq	%r14d, %rax	# 12385	[c=4 l=3]  *extendsidi2_rex64/1
+	movb	%r15b, (%rdx,%rax)	# 12387	[c=4 l=4]  *movqi_internal/8
+.L988:
+	movl	$30, %edx	# 12400	[c=4 l=5]  *movsi_internal/0
+	movzwl	%r14w, %ecx	# 12398	[c=4 l=4]  *zero_extendhisi2/0
+	movq	%r12, %rdi	# 12403	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 18422	[c=4 l=2]  *movdi_xor
+	leaq	.LC48(%rip), %rsi	# 12401	[c=1 l=7]  *movdi_internal/4
+	call	log_append@PLT	# 12405	[c=0 l=5]  *call
+	movl	%r14d, %ecx	# 16950	[c=4 l=3]  *movsi_internal/0
+	movq	%rbp, %rsi	# 12411	[c=4 l=3]  *movdi_internal/3
+	movq	%r12, %rdi	# 12412	[c=4 l=3]  *movdi_internal/3
+	movq	1040(%r12), %rax	# 12406	[c=9 l=8]  *movdi_internal/3
+	movb	%r14b, 30(%rax)	# 12407	[c=4 l=4]  *movqi_internal/8
+	movq	1040(%r12), %rax	# 12408	[c=9 l=8]  *movdi_internal/3
+	movb	%ch, 31(%rax)	# 18423	[c=4 l=3]  *extzvqi_mem_rex64
+	call	log_dump_line@PLT	# 12413	[c=0 l=5]  *call
+	movq	40(%r12), %rax	# 16951	[c=9 l=5]  *movdi_internal/3
+	movq	(%rsp), %rcx	# 16952	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 12415	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rcx), %rdx	# 17277	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r12)	# 12416	[c=4 l=5]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 12418	[c=4 l=3]  *cmpdi_1/0
+	jb	.L297	# 12419	[c=13 l=6]  *jcc
+	movl	(%r12), %r8d	# 12421	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r12, %rdi	# 12426	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r8	# 12422	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r12), %r8	# 12424	[c=13 l=8]  *adddi_1/1
+	movq	%r8, %rbp	# 16954	[c=4 l=3]  *movdi_internal/3
+	movq	%r8, %rsi	# 12425	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 12427	[c=0 l=5]  *call
+	movzbl	9(%rbp), %eax	# 12428	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, (%r12)	# 12429	[c=9 l=4]  *addsi_1/0
+	leaq	handler.1(%rip), %rdi	# 16957	[c=1 l=7]  *movdi_internal/4
+	movzbl	8(%rbp), %eax	# 12432	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 16955	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 12433	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbx,%rdx), %rdx	# 12436	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r12)	# 12437	[c=13 l=5]  *adddi_1/0
+	jmp	*(%rdi,%rax,8)	# 18421	[c=10 l=3]  *indirect_jump
+.L989:
+	movq	1040(%r12), %rax	# 12446	[c=9 l=8]  *movdi_internal/3
+	movzbl	10(%rbp), %r14d	# 12445	[c=9 l=5]  *movqi_internal/4
+	movl	$30, %edx	# 12450	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 12453	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC44(%rip), %rsi	# 12451	[c=1 l=7]  *movdi_internal/4
+	movzwl	30(%rax), %r13d	# 12447	[c=13 l=5]  *zero_extendhisi2/0
+	xorl	%eax, %eax	# 18419	[c=4 l=2]  *movdi_xor
+	movl	%r13d, %ecx	# 12449	[c=4 l=3]  *movsi_internal/0
+	movl	%r13d, %r15d	# 17762	[c=4 l=3]  *movsi_internal/0
+	call	log_append@PLT	# 12455	[c=0 l=5]  *call
+	movzbl	%r14b, %r9d	# 12456	[c=4 l=4]  zero_extendqidi2/0
+	movzbl	%r14b, %edx	# 12459	[c=4 l=4]  *zero_extendqisi2/0
+	movq	%r12, %rdi	# 12464	[c=4 l=3]  *movdi_internal/3
+	movq	1040(%r12), %rax	# 12457	[c=9 l=8]  *movdi_internal/3
+	leaq	.LC43(%rip), %rsi	# 12462	[c=1 l=7]  *movdi_internal/4
+	movq	%r9, 8(%rsp)	# 17223	[c=4 l=5]  *movdi_internal/5
+	movzbl	(%rax,%r9), %ecx	# 12458	[c=13 l=5]  *zero_extendqisi2/0
+	xorl	%eax, %eax	# 18420	[c=4 l=2]  *movdi_xor
+	call	log_append@PLT	# 12466	[c=0 l=5]  *call
+	movq	8(%rsp), %r9	# 17224	[c=9 l=5]  *movdi_internal/3
+	movl	%r13d, %edx	# 12476	[c=4 l=3]  *movsi_internal/0
+	movq	%r12, %rdi	# 12478	[c=4 l=3]  *movdi_internal/3
+	movq	1040(%r12), %rax	# 12467	[c=9 l=8]  *movdi_internal/3
+	cmpl	$95, %r13d	# 14834	[c=4 l=4]  *cmpsi_1/0
+	leaq	.LC30(%rip), %rsi	# 15799	[c=1 l=7]  *movdi_internal/4
+	movzbl	(%rax,%r9), %ecx	# 12468	[c=13 l=5]  *zero_extendqisi2/0
+	leaq	.LC31(%rip), %rax	# 15800	[c=1 l=7]  *movdi_internal/4
+	cmovne	%rax, %rsi	# 14835	[c=8 l=4]  *movdicc_noc/1
+	movl	%ecx, 8(%rsp)	# 17222	[c=4 l=4]  *movsi_internal/1
+	movl	%ecx, %r14d	# 17763	[c=4 l=3]  *movsi_internal/0
+	call	log_add_data_mov@PLT	# 12479	[c=0 l=5]  *call
+	movl	%r13d, %eax	# 16959	[c=4 l=3]  *movsi_internal/0
+	subl	5176(%r12), %eax	# 12481	[c=13 l=8]  *subsi_1/1
+	cmpl	5180(%r12), %eax	# 12482	[c=13 l=8]  *cmpsi_1/1
+	jb	.L991	# 12483	[c=13 l=2]  *jcc
+	movl	%r13d, %eax	# 16961	[c=4 l=3]  *movsi_internal/0
+	sarl	$5, %eax	# 12485	[c=4 l=3]  *ashrsi3_1/0
+	cltq	# 12486	[c=4 l=2]  *extendsidi2_rex64/0
+	cmpb	$0, 1080(%r12,%rax)	# 12487	[c=14 l=9]  *cmpqi_ccno_1/1
+	jne	.L992	# 12488	[c=13 l=6]  *jcc
+.L991:
+	movq	1040(%r12), %rdx	# 12492	[c=9 l=8]  *movdi_internal/3
+	movzwl	%r15w, %eax	# 12491	[c=4 l=4]  zero_extendhidi2/0
+	movb	%r14b, (%rdx,%rax)	# 12493	[c=4 l=4]  *movqi_internal/8
+.L993:
+	addl	$1, %r13d	# 12504	[c=4 l=4]  *addsi_1/0
+	movl	$30, %edx	# 12507	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 12510	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 18417	[c=4 l=2]  *movdi_xor
+	movzwl	%r13w, %ecx	# 12505	[c=4 l=4]  *zero_extendhisi2/0
+	leaq	.LC48(%rip), %rsi	# 12508	[c=1 l=7]  *movdi_internal/4
+	call	log_append@PLT	# 12512	[c=0 l=5]  *call
+	movl	%r13d, %ecx	# 16964	[c=4 l=3]  *movsi_internal/0
+	movq	%rbp, %rsi	# 12518	[c=4 l=3]  *movdi_internal/3
+	movq	%r12, %rdi	# 12519	[c=4 l=3]  *movdi_internal/3
+	movq	1040(%r12), %rax	# 12513	[c=9 l=8]  *movdi_internal/3
+	movb	%r13b, 30(%rax)	# 12514	[c=4 l=4]  *movqi_internal/8
+	movq	1040(%r12), %rax	# 12515	[c=9 l=8]  *movdi_internal/3
+	movb	%ch, 31(%rax)	# 18418	[c=4 l=3]  *extzvqi_mem_rex64
+	call	log_dump_line@PLT	# 12520	[c=0 l=5]  *call
+	movq	40(%r12), %rax	# 16965	[c=9 l=5]  *movdi_internal/3
+	movq	(%rsp), %rcx	# 16966	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 12522	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rcx), %rdx	# 17276	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r12)	# 12523	[c=4 l=5]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 12525	[c=4 l=3]  *cmpdi_1/0
+	jb	.L297	# 12526	[c=13 l=6]  *jcc
+	movl	(%r12), %r8d	# 12528	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r12, %rdi	# 12533	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r8	# 12529	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r12), %r8	# 12531	[c=13 l=8]  *adddi_1/1
+	movq	%r8, %rbp	# 16968	[c=4 l=3]  *movdi_internal/3
+	movq	%r8, %rsi	# 12532	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 12534	[c=0 l=5]  *call
+	movzbl	9(%rbp), %eax	# 12535	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, (%r12)	# 12536	[c=9 l=4]  *addsi_1/0
+	leaq	handler.1(%rip), %rdi	# 16971	[c=1 l=7]  *movdi_internal/4
+	movzbl	8(%rbp), %eax	# 12539	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 16969	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 12540	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbx,%rdx), %rdx	# 12543	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r12)	# 12544	[c=13 l=5]  *adddi_1/0
+	jmp	*(%rdi,%rax,8)	# 18416	[c=10 l=3]  *indirect_jump
+.L994:
+	movzbl	10(%rbp), %r11d	# 12553	[c=13 l=5]  zero_extendqidi2/0
+	movzwl	12(%rbp), %r14d	# 12552	[c=9 l=5]  *movhi_internal/2
+	movq	%r12, %rdi	# 12562	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC43(%rip), %rsi	# 12560	[c=1 l=7]  *movdi_internal/4
+	movq	1040(%r12), %rax	# 12556	[c=9 l=8]  *movdi_internal/3
+	movl	%r11d, %edx	# 12559	[c=4 l=3]  *movsi_internal/0
+	movq	%r11, %r15	# 17764	[c=4 l=3]  *movdi_internal/3
+	movl	%r11d, 24(%rsp)	# 17232	[c=4 l=5]  *movsi_internal/1
+	movzbl	(%rax,%r11), %ecx	# 12557	[c=13 l=5]  *zero_extendqisi2/0
+	xorl	%eax, %eax	# 18412	[c=4 l=2]  *movdi_xor
+	call	log_append@PLT	# 12564	[c=0 l=5]  *call
+	movzwl	%r14w, %r9d	# 12567	[c=4 l=4]  zero_extendhidi2/0
+	movzwl	%r14w, %edx	# 12569	[c=4 l=4]  *zero_extendhisi2/0
+	movq	%r12, %rdi	# 12574	[c=4 l=3]  *movdi_internal/3
+	movq	1040(%r12), %rax	# 12565	[c=9 l=8]  *movdi_internal/3
+	leaq	.LC43(%rip), %rsi	# 17231	[c=1 l=7]  *movdi_internal/4
+	movq	%r9, 8(%rsp)	# 17228	[c=4 l=5]  *movdi_internal/5
+	movzbl	(%rax,%r9), %ecx	# 12568	[c=13 l=5]  *zero_extendqisi2/0
+	movzbl	(%rax,%r15), %r13d	# 12566	[c=9 l=5]  *movqi_internal/4
+	xorl	%eax, %eax	# 18413	[c=4 l=2]  *movdi_xor
+	call	log_append@PLT	# 12576	[c=0 l=5]  *call
+	movzbl	%r13b, %r14d	# 12579	[c=4 l=4]  *zero_extendqisi2/0
+	movl	24(%rsp), %edx	# 18414	[c=9 l=4]  *movsi_internal/0
+	movq	%r12, %rdi	# 12588	[c=4 l=3]  *movdi_internal/3
+	movq	8(%rsp), %r9	# 17229	[c=9 l=5]  *movdi_internal/3
+	movq	1040(%r12), %rax	# 12577	[c=9 l=8]  *movdi_internal/3
+	leaq	.LC59(%rip), %rsi	# 12586	[c=1 l=7]  *movdi_internal/4
+	movzbl	(%rax,%r9), %eax	# 12578	[c=13 l=5]  *zero_extendqisi2/0
+	movl	%eax, %r9d	# 17765	[c=4 l=3]  *movsi_internal/0
+	subl	%eax, %r14d	# 12581	[c=4 l=3]  *subsi_1/0
+	movl	%r13d, %eax	# 16972	[c=4 l=3]  *movqi_internal/2
+	andl	$136, %r13d	# 12594	[c=4 l=7]  *andsi_1/0
+	subl	%r9d, %eax	# 17275	[c=4 l=3]  *subsi_1/0
+	movzbl	%r14b, %ecx	# 12583	[c=4 l=4]  *zero_extendqisi2/0
+	movb	%r9b, 16(%rsp)	# 17226	[c=4 l=5]  *movqi_internal/8
+	andl	$511, %r14d	# 12601	[c=4 l=7]  *andsi_1/0
+	movb	%al, 8(%rsp)	# 16973	[c=4 l=4]  *movqi_internal/8
+	xorl	%eax, %eax	# 18415	[c=4 l=2]  *movdi_xor
+	call	log_append@PLT	# 12590	[c=0 l=5]  *call
+	movzbl	16(%rsp), %r9d	# 17227	[c=9 l=6]  *movqi_internal/4
+	movzbl	8(%rsp), %edi	# 16974	[c=9 l=5]  *movqi_internal/4
+	movq	1040(%r12), %rax	# 12591	[c=9 l=8]  *movdi_internal/3
+	andl	$136, %r9d	# 12597	[c=4 l=7]  *andsi_1/0
+	movb	%dil, (%rax,%r15)	# 12592	[c=4 l=4]  *movqi_internal/8
+	leal	(%r9,%r13,2), %eax	# 12598	[c=8 l=4]  *leasi
+	imull	$260, %eax, %eax	# 12599	[c=12 l=6]  *mulsi3_1/1
+	andl	$7680, %eax	# 12600	[c=4 l=5]  *andsi_1/0
+	orl	%eax, %r14d	# 12602	[c=5 l=3]  *iorsi_1_zext
+	movl	$95, %eax	# 12603	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r12), %eax	# 12604	[c=13 l=8]  *subsi_1/1
+	cmpl	5180(%r12), %eax	# 12605	[c=13 l=8]  *cmpsi_1/1
+	jb	.L995	# 12606	[c=13 l=2]  *jcc
+	cmpb	$0, 1082(%r12)	# 12608	[c=13 l=9]  *cmpqi_ccno_1/1
+	jne	.L996	# 12609	[c=13 l=6]  *jcc
+.L995:
+	movq	1040(%r12), %rax	# 12612	[c=9 l=8]  *movdi_internal/3
+	movzbl	95(%rax), %r13d	# 12613	[c=13 l=5]  *zero_extendqisi2/0
+.L997:
+	movl	%r13d, %ecx	# 12624	[c=4 l=3]  *movsi_internal/0
+	movl	$95, %edx	# 12625	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 12628	[c=4 l=3]  *movdi_internal/3
+	andl	$-64, %r13d	# 12630	[c=4 l=4]  *andsi_1/0
+	leaq	.LC28(%rip), %rsi	# 12626	[c=1 l=7]  *movdi_internal/4
+	call	log_add_data_mov@PLT	# 12629	[c=0 l=5]  *call
+	leaq	flag_update_table_sub8(%rip), %rax	# 15692	[c=1 l=7]  *movdi_internal/4
+	movl	$95, %edx	# 12637	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 12640	[c=4 l=3]  *movdi_internal/3
+	movzbl	(%rax,%r14), %eax	# 12633	[c=13 l=5]  *zero_extendqisi2/0
+	leaq	.LC30(%rip), %rsi	# 12638	[c=1 l=7]  *movdi_internal/4
+	orl	%eax, %r13d	# 12634	[c=4 l=3]  *iorsi_1/0
+	movzbl	%r13b, %ecx	# 12635	[c=4 l=4]  *zero_extendqisi2/0
+	call	log_add_data_mov@PLT	# 12641	[c=0 l=5]  *call
+	movl	$95, %eax	# 12642	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r12), %eax	# 12643	[c=13 l=8]  *subsi_1/1
+	cmpl	5180(%r12), %eax	# 12644	[c=13 l=8]  *cmpsi_1/1
+	jb	.L998	# 12645	[c=13 l=2]  *jcc
+	cmpb	$0, 1082(%r12)	# 12647	[c=13 l=9]  *cmpqi_ccno_1/1
+	jne	.L999	# 12648	[c=13 l=6]  *jcc
+.L998:
+	movq	1040(%r12), %rax	# 12651	[c=9 l=8]  *movdi_internal/3
+	movb	%r13b, 95(%rax)	# 12652	[c=4 l=4]  *movqi_internal/8
+.L1000:
+	movq	%rbp, %rsi	# 12663	[c=4 l=3]  *movdi_internal/3
+	movq	%r12, %rdi	# 12664	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 12665	[c=0 l=5]  *call
+	movq	40(%r12), %rax	# 16975	[c=9 l=5]  *movdi_internal/3
+	movq	(%rsp), %rcx	# 16976	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 12667	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rcx), %rdx	# 17274	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r12)	# 12668	[c=4 l=5]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 12670	[c=4 l=3]  *cmpdi_1/0
+	jb	.L297	# 12671	[c=13 l=6]  *jcc
+	movl	(%r12), %r8d	# 12673	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r12, %rdi	# 12678	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r8	# 12674	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r12), %r8	# 12676	[c=13 l=8]  *adddi_1/1
+	movq	%r8, %rbp	# 16978	[c=4 l=3]  *movdi_internal/3
+	movq	%r8, %rsi	# 12677	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 12679	[c=0 l=5]  *call
+	movzbl	9(%rbp), %eax	# 12680	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, (%r12)	# 12681	[c=9 l=4]  *addsi_1/0
+	leaq	handler.1(%rip), %rdi	# 16981	[c=1 l=7]  *movdi_internal/4
+	movzbl	8(%rbp), %eax	# 12684	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 16979	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 12685	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbx,%rdx), %rdx	# 12688	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r12)	# 12689	[c=13 l=5]  *adddi_1/0
+	jmp	*(%rdi,%rax,8)	# 18411	[c=10 l=3]  *indirect_jump
+.L1001:
+	movzwl	12(%rbp), %r11d	# 12697	[c=13 l=5]  *zero_extendhisi2/0
+	movq	%r12, %rdi	# 12704	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 18408	[c=4 l=2]  *movdi_xor
+	movzbl	10(%rbp), %r13d	# 12699	[c=13 l=5]  zero_extendqidi2/0
+	leaq	.LC60(%rip), %rsi	# 12702	[c=1 l=7]  *movdi_internal/4
+	movl	%r11d, %edx	# 12701	[c=4 l=3]  *movsi_internal/0
+	movl	%r11d, %r15d	# 17766	[c=4 l=3]  *movsi_internal/0
+	movl	%r11d, 24(%rsp)	# 17237	[c=4 l=5]  *movsi_internal/1
+	movq	%r13, %r14	# 17767	[c=4 l=3]  *movdi_internal/3
+	call	log_append@PLT	# 12706	[c=0 l=5]  *call
+	movl	%r13d, %edx	# 12711	[c=4 l=3]  *movsi_internal/0
+	movq	%r12, %rdi	# 12714	[c=4 l=3]  *movdi_internal/3
+	movl	%r13d, 8(%rsp)	# 17236	[c=4 l=5]  *movsi_internal/1
+	movq	1040(%r12), %rax	# 12708	[c=9 l=8]  *movdi_internal/3
+	leaq	.LC43(%rip), %rsi	# 12712	[c=1 l=7]  *movdi_internal/4
+	andl	$136, %r15d	# 12735	[c=4 l=7]  *andsi_1/0
+	movzbl	(%rax,%r13), %ecx	# 12709	[c=13 l=5]  *zero_extendqisi2/0
+	xorl	%eax, %eax	# 18409	[c=4 l=2]  *movdi_xor
+	call	log_append@PLT	# 12716	[c=0 l=5]  *call
+	movq	1040(%r12), %rax	# 12717	[c=9 l=8]  *movdi_internal/3
+	movl	8(%rsp), %edx	# 12723	[c=9 l=4]  *movsi_internal/0
+	leaq	.LC59(%rip), %rsi	# 12724	[c=1 l=7]  *movdi_internal/4
+	movl	24(%rsp), %r11d	# 17238	[c=9 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 12726	[c=4 l=3]  *movdi_internal/3
+	movzbl	(%rax,%r13), %r13d	# 12718	[c=13 l=5]  *zero_extendqisi2/0
+	xorl	%eax, %eax	# 18410	[c=4 l=2]  *movdi_xor
+	movb	%r13b, 16(%rsp)	# 17234	[c=4 l=5]  *movqi_internal/8
+	subl	%r11d, %r13d	# 12720	[c=4 l=3]  *subsi_1/0
+	movzbl	%r13b, %ecx	# 12721	[c=4 l=4]  *zero_extendqisi2/0
+	call	log_append@PLT	# 12728	[c=0 l=5]  *call
+	movzbl	16(%rsp), %r9d	# 17235	[c=9 l=6]  *movqi_internal/4
+	movq	1040(%r12), %rax	# 12729	[c=9 l=8]  *movdi_internal/3
+	andl	$136, %r9d	# 12732	[c=4 l=7]  *andsi_1/0
+	movb	%r13b, (%rax,%r14)	# 12730	[c=4 l=4]  *movqi_internal/8
+	movl	%r13d, %eax	# 16983	[c=4 l=3]  *movsi_internal/0
+	leal	(%r15,%r9,2), %edx	# 12736	[c=8 l=4]  *leasi
+	andl	$511, %eax	# 12739	[c=4 l=5]  *andsi_1/0
+	imull	$260, %edx, %edx	# 12737	[c=12 l=6]  *mulsi3_1/1
+	andl	$7680, %edx	# 12738	[c=4 l=6]  *andsi_1/0
+	orl	%eax, %edx	# 12740	[c=4 l=2]  *iorsi_1/0
+	movl	$95, %eax	# 12741	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r12), %eax	# 12742	[c=13 l=8]  *subsi_1/1
+	movl	%edx, %r13d	# 16986	[c=1 l=3]  *zero_extendsidi2/3
+	cmpl	5180(%r12), %eax	# 12743	[c=13 l=8]  *cmpsi_1/1
+	jb	.L1002	# 12744	[c=13 l=2]  *jcc
+	cmpb	$0, 1082(%r12)	# 12746	[c=13 l=9]  *cmpqi_ccno_1/1
+	jne	.L1003	# 12747	[c=13 l=6]  *jcc
+.L1002:
+	movq	1040(%r12), %rax	# 12750	[c=9 l=8]  *movdi_internal/3
+	movzbl	95(%rax), %r14d	# 12751	[c=13 l=5]  *zero_extendqisi2/0
+.L1004:
+	movl	%r14d, %ecx	# 12762	[c=4 l=3]  *movsi_internal/0
+	movl	$95, %edx	# 12763	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 12766	[c=4 l=3]  *movdi_internal/3
+	andl	$-64, %r14d	# 12768	[c=4 l=4]  *andsi_1/0
+	leaq	.LC28(%rip), %rsi	# 12764	[c=1 l=7]  *movdi_internal/4
+	call	log_add_data_mov@PLT	# 12767	[c=0 l=5]  *call
+	leaq	flag_update_table_sub8(%rip), %rax	# 15693	[c=1 l=7]  *movdi_internal/4
+	movl	$95, %edx	# 12775	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 12778	[c=4 l=3]  *movdi_internal/3
+	movzbl	(%rax,%r13), %eax	# 12771	[c=13 l=5]  *zero_extendqisi2/0
+	leaq	.LC30(%rip), %rsi	# 12776	[c=1 l=7]  *movdi_internal/4
+	orl	%eax, %r14d	# 12772	[c=4 l=3]  *iorsi_1/0
+	movzbl	%r14b, %ecx	# 12773	[c=4 l=4]  *zero_extendqisi2/0
+	call	log_add_data_mov@PLT	# 12779	[c=0 l=5]  *call
+	movl	$95, %eax	# 12780	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r12), %eax	# 12781	[c=13 l=8]  *subsi_1/1
+	cmpl	5180(%r12), %eax	# 12782	[c=13 l=8]  *cmpsi_1/1
+	jb	.L1005	# 12783	[c=13 l=2]  *jcc
+	cmpb	$0, 1082(%r12)	# 12785	[c=13 l=9]  *cmpqi_ccno_1/1
+	jne	.L1006	# 12786	[c=13 l=6]  *jcc
+.L1005:
+	movq	1040(%r12), %rax	# 12789	[c=9 l=8]  *movdi_internal/3
+	movb	%r14b, 95(%rax)	# 12790	[c=4 l=4]  *movqi_internal/8
+.L1007:
+	movq	%rbp, %rsi	# 12801	[c=4 l=3]  *movdi_internal/3
+	movq	%r12, %rdi	# 12802	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 12803	[c=0 l=5]  *call
+	movq	40(%r12), %rax	# 16987	[c=9 l=5]  *movdi_internal/3
+	movq	(%rsp), %rcx	# 16988	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 12805	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rcx), %rdx	# 17273	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r12)	# 12806	[c=4 l=5]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 12808	[c=4 l=3]  *cmpdi_1/0
+	jb	.L297	# 12809	[c=13 l=6]  *jcc
+	movl	(%r12), %r8d	# 12811	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r12, %rdi	# 12816	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r8	# 12812	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r12), %r8	# 12814	[c=13 l=8]  *adddi_1/1
+	movq	%r8, %rbp	# 16990	[c=4 l=3]  *movdi_internal/3
+	movq	%r8, %rsi	# 12815	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 12817	[c=0 l=5]  *call
+	movzbl	9(%rbp), %eax	# 12818	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, (%r12)	# 12819	[c=9 l=4]  *addsi_1/0
+	leaq	handler.1(%rip), %rdi	# 16993	[c=1 l=7]  *movdi_internal/4
+	movzbl	8(%rbp), %eax	# 12822	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 16991	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 12823	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbx,%rdx), %rdx	# 12826	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r12)	# 12827	[c=13 l=5]  *adddi_1/0
+	jmp	*(%rdi,%rax,8)	# 18407	[c=10 l=3]  *indirect_jump
+.L1008:
+	movzbl	10(%rbp), %r15d	# 12835	[c=13 l=5]  zero_extendqidi2/0
+	movq	1040(%r12), %rax	# 12838	[c=9 l=8]  *movdi_internal/3
+	leaq	.LC43(%rip), %rsi	# 12842	[c=1 l=7]  *movdi_internal/4
+	movq	%r12, %rdi	# 12844	[c=4 l=3]  *movdi_internal/3
+	movzbl	(%rax,%r15), %ecx	# 12839	[c=13 l=5]  *zero_extendqisi2/0
+	movl	%r15d, %edx	# 12841	[c=4 l=3]  *movsi_internal/0
+	xorl	%eax, %eax	# 18405	[c=4 l=2]  *movdi_xor
+	call	log_append@PLT	# 12846	[c=0 l=5]  *call
+	movq	1040(%r12), %rax	# 12847	[c=9 l=8]  *movdi_internal/3
+	movl	%r15d, %edx	# 12852	[c=4 l=3]  *movsi_internal/0
+	movq	%r12, %rdi	# 12855	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC59(%rip), %rsi	# 12853	[c=1 l=7]  *movdi_internal/4
+	movzbl	(%rax,%r15), %r14d	# 12848	[c=9 l=5]  *movqi_internal/4
+	xorl	%eax, %eax	# 18406	[c=4 l=2]  *movdi_xor
+	rolb	$4, %r14b	# 12849	[c=4 l=4]  *rotlqi3_1
+	movzbl	%r14b, %ecx	# 12850	[c=4 l=4]  *zero_extendqisi2/0
+	call	log_append@PLT	# 12857	[c=0 l=5]  *call
+	movq	1040(%r12), %rax	# 12858	[c=9 l=8]  *movdi_internal/3
+	movq	%rbp, %rsi	# 12860	[c=4 l=3]  *movdi_internal/3
+	movq	%r12, %rdi	# 12861	[c=4 l=3]  *movdi_internal/3
+	movb	%r14b, (%rax,%r15)	# 12859	[c=4 l=4]  *movqi_internal/8
+	call	log_dump_line@PLT	# 12862	[c=0 l=5]  *call
+	movq	40(%r12), %rax	# 16994	[c=9 l=5]  *movdi_internal/3
+	movq	(%rsp), %rcx	# 16995	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 12864	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rcx), %rdx	# 17272	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r12)	# 12865	[c=4 l=5]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 12867	[c=4 l=3]  *cmpdi_1/0
+	jb	.L297	# 12868	[c=13 l=6]  *jcc
+	movl	(%r12), %r8d	# 12870	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r12, %rdi	# 12875	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r8	# 12871	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r12), %r8	# 12873	[c=13 l=8]  *adddi_1/1
+	movq	%r8, %rbp	# 16997	[c=4 l=3]  *movdi_internal/3
+	movq	%r8, %rsi	# 12874	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 12876	[c=0 l=5]  *call
+	movzbl	9(%rbp), %eax	# 12877	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, (%r12)	# 12878	[c=9 l=4]  *addsi_1/0
+	leaq	handler.1(%rip), %rdi	# 17000	[c=1 l=7]  *movdi_internal/4
+	movzbl	8(%rbp), %eax	# 12881	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 16998	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 12882	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbx,%rdx), %rdx	# 12885	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r12)	# 12886	[c=13 l=5]  *adddi_1/0
+	jmp	*(%rdi,%rax,8)	# 18404	[c=10 l=3]  *indirect_jump
+.L1009:
+	movq	%rbp, %rsi	# 12894	[c=4 l=3]  *movdi_internal/3
+	movq	%r12, %rdi	# 12895	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 12896	[c=0 l=5]  *call
+	movq	40(%r12), %rax	# 17001	[c=9 l=5]  *movdi_internal/3
+	movq	(%rsp), %rcx	# 17002	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 12898	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rcx), %rdx	# 17271	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r12)	# 12899	[c=4 l=5]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 12901	[c=4 l=3]  *cmpdi_1/0
+	jb	.L297	# 12902	[c=13 l=6]  *jcc
+	movl	(%r12), %r8d	# 12904	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r12, %rdi	# 12909	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r8	# 12905	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r12), %r8	# 12907	[c=13 l=8]  *adddi_1/1
+	movq	%r8, %rbp	# 17004	[c=4 l=3]  *movdi_internal/3
+	movq	%r8, %rsi	# 12908	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 12910	[c=0 l=5]  *call
+	movzbl	9(%rbp), %eax	# 12911	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, (%r12)	# 12912	[c=9 l=4]  *addsi_1/0
+	leaq	handler.1(%rip), %rdi	# 17007	[c=1 l=7]  *movdi_internal/4
+	movzbl	8(%rbp), %eax	# 12915	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 17005	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 12916	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbx,%rdx), %rdx	# 12919	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r12)	# 12920	[c=13 l=5]  *adddi_1/0
+	jmp	*(%rdi,%rax,8)	# 18403	[c=10 l=3]  *indirect_jump
+.L1010:
+	movzbl	10(%rbp), %edx	# 12928	[c=13 l=4]  zero_extendqidi2/0
+	xorl	%eax, %eax	# 18402	[c=4 l=2]  *movdi_xor
+	xorl	%ecx, %ecx	# 18401	[c=4 l=2]  *movdi_xor
+	leaq	.LC59(%rip), %rsi	# 12932	[c=1 l=7]  *movdi_internal/4
+	movq	%r12, %rdi	# 12934	[c=4 l=3]  *movdi_internal/3
+	movq	%rdx, %r13	# 17770	[c=4 l=3]  *movdi_internal/3
+	call	log_append@PLT	# 12936	[c=0 l=5]  *call
+	movq	1040(%r12), %rax	# 12938	[c=9 l=8]  *movdi_internal/3
+	movb	$0, (%rax,%r13)	# 12939	[c=4 l=5]  *movqi_internal/8
+	movl	$95, %eax	# 12940	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r12), %eax	# 12941	[c=13 l=8]  *subsi_1/1
+	cmpl	5180(%r12), %eax	# 12942	[c=13 l=8]  *cmpsi_1/1
+	jb	.L1011	# 12943	[c=13 l=2]  *jcc
+	cmpb	$0, 1082(%r12)	# 12945	[c=13 l=9]  *cmpqi_ccno_1/1
+	jne	.L1012	# 12946	[c=13 l=6]  *jcc
+.L1011:
+	movq	1040(%r12), %rax	# 12949	[c=9 l=8]  *movdi_internal/3
+	movzbl	95(%rax), %r14d	# 12950	[c=13 l=5]  *zero_extendqisi2/0
+.L1013:
+	movl	%r14d, %ecx	# 12961	[c=4 l=3]  *movsi_internal/0
+	movl	$95, %edx	# 12962	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 12965	[c=4 l=3]  *movdi_internal/3
+	movl	%r14d, %r13d	# 17008	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC28(%rip), %rsi	# 12963	[c=1 l=7]  *movdi_internal/4
+	andl	$-31, %r13d	# 12967	[c=4 l=4]  *andsi_1/0
+	call	log_add_data_mov@PLT	# 12966	[c=0 l=5]  *call
+	movl	%r14d, %ecx	# 17010	[c=4 l=3]  *movsi_internal/0
+	movl	$95, %edx	# 12972	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 12975	[c=4 l=3]  *movdi_internal/3
+	andl	$225, %ecx	# 12969	[c=4 l=6]  *andsi_1/0
+	leaq	.LC30(%rip), %rsi	# 12973	[c=1 l=7]  *movdi_internal/4
+	orl	$2, %r13d	# 12968	[c=4 l=4]  *iorsi_1/0
+	orl	$2, %ecx	# 12970	[c=4 l=3]  *iorsi_1/0
+	call	log_add_data_mov@PLT	# 12976	[c=0 l=5]  *call
+	movl	$95, %eax	# 12977	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r12), %eax	# 12978	[c=13 l=8]  *subsi_1/1
+	cmpl	5180(%r12), %eax	# 12979	[c=13 l=8]  *cmpsi_1/1
+	jb	.L1014	# 12980	[c=13 l=2]  *jcc
+	cmpb	$0, 1082(%r12)	# 12982	[c=13 l=9]  *cmpqi_ccno_1/1
+	jne	.L1015	# 12983	[c=13 l=6]  *jcc
+.L1014:
+	movq	1040(%r12), %rax	# 12986	[c=9 l=8]  *movdi_internal/3
+	movb	%r13b, 95(%rax)	# 12987	[c=4 l=4]  *movqi_internal/8
+.L1016:
+	movq	%rbp, %rsi	# 12998	[c=4 l=3]  *movdi_internal/3
+	movq	%r12, %rdi	# 12999	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 13000	[c=0 l=5]  *call
+	movq	40(%r12), %rax	# 17012	[c=9 l=5]  *movdi_internal/3
+	movq	(%rsp), %rcx	# 17013	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 13002	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rcx), %rdx	# 17270	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r12)	# 13003	[c=4 l=5]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 13005	[c=4 l=3]  *cmpdi_1/0
+	jb	.L297	# 13006	[c=13 l=6]  *jcc
+	movl	(%r12), %r8d	# 13008	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r12, %rdi	# 13013	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r8	# 13009	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r12), %r8	# 13011	[c=13 l=8]  *adddi_1/1
+	movq	%r8, %rbp	# 17015	[c=4 l=3]  *movdi_internal/3
+	movq	%r8, %rsi	# 13012	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 13014	[c=0 l=5]  *call
+	movzbl	9(%rbp), %eax	# 13015	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, (%r12)	# 13016	[c=9 l=4]  *addsi_1/0
+	leaq	handler.1(%rip), %rdi	# 17018	[c=1 l=7]  *movdi_internal/4
+	movzbl	8(%rbp), %eax	# 13019	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 17016	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 13020	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbx,%rdx), %rdx	# 13023	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r12)	# 13024	[c=13 l=5]  *adddi_1/0
+	jmp	*(%rdi,%rax,8)	# 18400	[c=10 l=3]  *indirect_jump
+.L1017:
+	movzbl	10(%rbp), %edx	# 13032	[c=13 l=4]  zero_extendqidi2/0
+	movq	1040(%r12), %rax	# 13035	[c=9 l=8]  *movdi_internal/3
+	leaq	.LC43(%rip), %rsi	# 13039	[c=1 l=7]  *movdi_internal/4
+	movq	%r12, %rdi	# 13041	[c=4 l=3]  *movdi_internal/3
+	movzbl	(%rax,%rdx), %ecx	# 13036	[c=13 l=4]  *zero_extendqisi2/0
+	xorl	%eax, %eax	# 18398	[c=4 l=2]  *movdi_xor
+	movq	%rdx, %r15	# 17771	[c=4 l=3]  *movdi_internal/3
+	movl	%edx, 8(%rsp)	# 17240	[c=4 l=4]  *movsi_internal/1
+	call	log_append@PLT	# 13043	[c=0 l=5]  *call
+	movq	1040(%r12), %rax	# 13044	[c=9 l=8]  *movdi_internal/3
+	movl	8(%rsp), %edx	# 17241	[c=9 l=4]  *movsi_internal/0
+	movq	%r12, %rdi	# 13053	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC59(%rip), %rsi	# 13051	[c=1 l=7]  *movdi_internal/4
+	movzbl	(%rax,%r15), %r14d	# 13045	[c=13 l=5]  *zero_extendqisi2/0
+	xorl	%eax, %eax	# 18399	[c=4 l=2]  *movdi_xor
+	movl	%r14d, %r13d	# 17772	[c=4 l=3]  *movsi_internal/0
+	addl	%r14d, %r14d	# 13047	[c=4 l=3]  *ashlsi3_1/0
+	movzbl	%r14b, %ecx	# 13048	[c=4 l=4]  *zero_extendqisi2/0
+	andl	$136, %r13d	# 13059	[c=4 l=7]  *andsi_1/0
+	call	log_append@PLT	# 13055	[c=0 l=5]  *call
+	movq	1040(%r12), %rax	# 13056	[c=9 l=8]  *movdi_internal/3
+	movb	%r14b, (%rax,%r15)	# 13057	[c=4 l=4]  *movqi_internal/8
+	imull	$780, %r13d, %eax	# 13060	[c=12 l=7]  *mulsi3_1/1
+	andl	$7680, %eax	# 13061	[c=4 l=5]  *andsi_1/0
+	orl	%r14d, %eax	# 13062	[c=4 l=3]  *iorsi_1/0
+	movl	%eax, %r13d	# 17020	[c=4 l=3]  *movsi_internal/0
+	movl	$95, %eax	# 13063	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r12), %eax	# 13064	[c=13 l=8]  *subsi_1/1
+	cmpl	5180(%r12), %eax	# 13065	[c=13 l=8]  *cmpsi_1/1
+	jb	.L1018	# 13066	[c=13 l=2]  *jcc
+	cmpb	$0, 1082(%r12)	# 13068	[c=13 l=9]  *cmpqi_ccno_1/1
+	jne	.L1019	# 13069	[c=13 l=6]  *jcc
+.L1018:
+	movq	1040(%r12), %rax	# 13072	[c=9 l=8]  *movdi_internal/3
+	movzbl	95(%rax), %r14d	# 13073	[c=13 l=5]  *zero_extendqisi2/0
+.L1020:
+	movl	%r14d, %ecx	# 13084	[c=4 l=3]  *movsi_internal/0
+	movl	$95, %edx	# 13085	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 13088	[c=4 l=3]  *movdi_internal/3
+	andl	$-64, %r14d	# 13090	[c=4 l=4]  *andsi_1/0
+	leaq	.LC28(%rip), %rsi	# 13086	[c=1 l=7]  *movdi_internal/4
+	call	log_add_data_mov@PLT	# 13089	[c=0 l=5]  *call
+	leaq	flag_update_table_add8(%rip), %rdx	# 15694	[c=1 l=7]  *movdi_internal/4
+	movl	%r13d, %eax	# 13092	[c=1 l=3]  *zero_extendsidi2/3
+	movq	%r12, %rdi	# 13100	[c=4 l=3]  *movdi_internal/3
+	movzbl	(%rdx,%rax), %eax	# 13093	[c=13 l=4]  *zero_extendqisi2/0
+	leaq	.LC30(%rip), %rsi	# 13098	[c=1 l=7]  *movdi_internal/4
+	movl	$95, %edx	# 13097	[c=4 l=5]  *movsi_internal/0
+	orl	%eax, %r14d	# 13094	[c=4 l=3]  *iorsi_1/0
+	movzbl	%r14b, %ecx	# 13095	[c=4 l=4]  *zero_extendqisi2/0
+	call	log_add_data_mov@PLT	# 13101	[c=0 l=5]  *call
+	movl	$95, %eax	# 13102	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r12), %eax	# 13103	[c=13 l=8]  *subsi_1/1
+	cmpl	5180(%r12), %eax	# 13104	[c=13 l=8]  *cmpsi_1/1
+	jb	.L1021	# 13105	[c=13 l=2]  *jcc
+	cmpb	$0, 1082(%r12)	# 13107	[c=13 l=9]  *cmpqi_ccno_1/1
+	jne	.L1022	# 13108	[c=13 l=6]  *jcc
+.L1021:
+	movq	1040(%r12), %rax	# 13111	[c=9 l=8]  *movdi_internal/3
+	movb	%r14b, 95(%rax)	# 13112	[c=4 l=4]  *movqi_internal/8
+.L1023:
+	movq	%rbp, %rsi	# 13123	[c=4 l=3]  *movdi_internal/3
+	movq	%r12, %rdi	# 13124	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 13125	[c=0 l=5]  *call
+	movq	40(%r12), %rax	# 17021	[c=9 l=5]  *movdi_internal/3
+	movq	(%rsp), %rcx	# 17022	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 13127	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rcx), %rdx	# 17269	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r12)	# 13128	[c=4 l=5]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 13130	[c=4 l=3]  *cmpdi_1/0
+	jb	.L297	# 13131	[c=13 l=6]  *jcc
+	movl	(%r12), %r8d	# 13133	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r12, %rdi	# 13138	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r8	# 13134	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r12), %r8	# 13136	[c=13 l=8]  *adddi_1/1
+	movq	%r8, %rbp	# 17024	[c=4 l=3]  *movdi_internal/3
+	movq	%r8, %rsi	# 13137	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 13139	[c=0 l=5]  *call
+	movzbl	9(%rbp), %eax	# 13140	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, (%r12)	# 13141	[c=9 l=4]  *addsi_1/0
+	leaq	handler.1(%rip), %rdi	# 17027	[c=1 l=7]  *movdi_internal/4
+	movzbl	8(%rbp), %eax	# 13144	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 17025	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 13145	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbx,%rdx), %rdx	# 13148	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r12)	# 13149	[c=13 l=5]  *adddi_1/0
+	jmp	*(%rdi,%rax,8)	# 18397	[c=10 l=3]  *indirect_jump
+.L1024:
+	movzbl	10(%rbp), %edx	# 13157	[c=13 l=4]  zero_extendqidi2/0
+	movq	1040(%r12), %rax	# 13159	[c=9 l=8]  *movdi_internal/3
+	leaq	.LC43(%rip), %rsi	# 13167	[c=1 l=7]  *movdi_internal/4
+	movq	%r12, %rdi	# 13169	[c=4 l=3]  *movdi_internal/3
+	movzbl	(%rax,%rdx), %ecx	# 13164	[c=13 l=4]  *zero_extendqisi2/0
+	movzbl	95(%rax), %r13d	# 13160	[c=9 l=5]  *movqi_internal/4
+	xorl	%eax, %eax	# 18395	[c=4 l=2]  *movdi_xor
+	movq	%rdx, %r15	# 17773	[c=4 l=3]  *movdi_internal/3
+	movl	%edx, 8(%rsp)	# 17242	[c=4 l=4]  *movsi_internal/1
+	call	log_append@PLT	# 13171	[c=0 l=5]  *call
+	andl	$1, %r13d	# 13162	[c=4 l=4]  *andsi_1/0
+	movl	8(%rsp), %edx	# 17243	[c=9 l=4]  *movsi_internal/0
+	movq	%r12, %rdi	# 13182	[c=4 l=3]  *movdi_internal/3
+	movq	1040(%r12), %rax	# 13172	[c=9 l=8]  *movdi_internal/3
+	leaq	.LC59(%rip), %rsi	# 13180	[c=1 l=7]  *movdi_internal/4
+	movzbl	(%rax,%r15), %eax	# 13173	[c=13 l=5]  *zero_extendqisi2/0
+	leal	0(%r13,%rax,2), %r13d	# 13176	[c=8 l=5]  *leasi
+	movl	%eax, %r14d	# 17774	[c=4 l=3]  *movsi_internal/0
+	xorl	%eax, %eax	# 18396	[c=4 l=2]  *movdi_xor
+	movzbl	%r13b, %ecx	# 13177	[c=4 l=4]  *zero_extendqisi2/0
+	andl	$136, %r14d	# 13188	[c=4 l=7]  *andsi_1/0
+	call	log_append@PLT	# 13184	[c=0 l=5]  *call
+	movq	1040(%r12), %rax	# 13185	[c=9 l=8]  *movdi_internal/3
+	movb	%r13b, (%rax,%r15)	# 13186	[c=4 l=4]  *movqi_internal/8
+	imull	$780, %r14d, %eax	# 13189	[c=12 l=7]  *mulsi3_1/1
+	andl	$7680, %eax	# 13190	[c=4 l=5]  *andsi_1/0
+	orl	%eax, %r13d	# 13191	[c=4 l=3]  *iorsi_1/0
+	movl	$95, %eax	# 13192	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r12), %eax	# 13193	[c=13 l=8]  *subsi_1/1
+	cmpl	5180(%r12), %eax	# 13194	[c=13 l=8]  *cmpsi_1/1
+	jb	.L1025	# 13195	[c=13 l=2]  *jcc
+	cmpb	$0, 1082(%r12)	# 13197	[c=13 l=9]  *cmpqi_ccno_1/1
+	jne	.L1026	# 13198	[c=13 l=6]  *jcc
+.L1025:
+	movq	1040(%r12), %rax	# 13201	[c=9 l=8]  *movdi_internal/3
+	movzbl	95(%rax), %r14d	# 13202	[c=13 l=5]  *zero_extendqisi2/0
+.L1027:
+	movl	%r14d, %ecx	# 13213	[c=4 l=3]  *movsi_internal/0
+	movl	$95, %edx	# 13214	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 13217	[c=4 l=3]  *movdi_internal/3
+	andl	$-64, %r14d	# 13219	[c=4 l=4]  *andsi_1/0
+	leaq	.LC28(%rip), %rsi	# 13215	[c=1 l=7]  *movdi_internal/4
+	call	log_add_data_mov@PLT	# 13218	[c=0 l=5]  *call
+	leaq	flag_update_table_add8(%rip), %rdx	# 15695	[c=1 l=7]  *movdi_internal/4
+	movl	%r13d, %eax	# 13221	[c=1 l=3]  *zero_extendsidi2/3
+	movq	%r12, %rdi	# 13229	[c=4 l=3]  *movdi_internal/3
+	movzbl	(%rdx,%rax), %eax	# 13222	[c=13 l=4]  *zero_extendqisi2/0
+	leaq	.LC30(%rip), %rsi	# 13227	[c=1 l=7]  *movdi_internal/4
+	movl	$95, %edx	# 13226	[c=4 l=5]  *movsi_internal/0
+	orl	%eax, %r14d	# 13223	[c=4 l=3]  *iorsi_1/0
+	movzbl	%r14b, %ecx	# 13224	[c=4 l=4]  *zero_extendqisi2/0
+	call	log_add_data_mov@PLT	# 13230	[c=0 l=5]  *call
+	movl	$95, %eax	# 13231	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r12), %eax	# 13232	[c=13 l=8]  *subsi_1/1
+	cmpl	5180(%r12), %eax	# 13233	[c=13 l=8]  *cmpsi_1/1
+	jb	.L1028	# 13234	[c=13 l=2]  *jcc
+	cmpb	$0, 1082(%r12)	# 13236	[c=13 l=9]  *cmpqi_ccno_1/1
+	jne	.L1029	# 13237	[c=13 l=6]  *jcc
+.L1028:
+	movq	1040(%r12), %rax	# 13240	[c=9 l=8]  *movdi_internal/3
+	movb	%r14b, 95(%rax)	# 13241	[c=4 l=4]  *movqi_internal/8
+.L1030:
+	movq	%rbp, %rsi	# 13252	[c=4 l=3]  *movdi_internal/3
+	movq	%r12, %rdi	# 13253	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 13254	[c=0 l=5]  *call
+	movq	40(%r12), %rax	# 17028	[c=9 l=5]  *movdi_internal/3
+	movq	(%rsp), %rcx	# 17029	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 13256	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rcx), %rdx	# 17268	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r12)	# 13257	[c=4 l=5]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 13259	[c=4 l=3]  *cmpdi_1/0
+	jb	.L297	# 13260	[c=13 l=6]  *jcc
+	movl	(%r12), %r8d	# 13262	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r12, %rdi	# 13267	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r8	# 13263	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r12), %r8	# 13265	[c=13 l=8]  *adddi_1/1
+	movq	%r8, %rbp	# 17031	[c=4 l=3]  *movdi_internal/3
+	movq	%r8, %rsi	# 13266	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 13268	[c=0 l=5]  *call
+	movzbl	9(%rbp), %eax	# 13269	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, (%r12)	# 13270	[c=9 l=4]  *addsi_1/0
+	leaq	handler.1(%rip), %rdi	# 17034	[c=1 l=7]  *movdi_internal/4
+	movzbl	8(%rbp), %eax	# 13273	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 17032	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 13274	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbx,%rdx), %rdx	# 13277	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r12)	# 13278	[c=13 l=5]  *adddi_1/0
+	jmp	*(%rdi,%rax,8)	# 18394	[c=10 l=3]  *indirect_jump
+.L1031:
+	movzbl	10(%rbp), %r13d	# 13286	[c=13 l=5]  zero_extendqidi2/0
+	xorl	%eax, %eax	# 18393	[c=4 l=2]  *movdi_xor
+	movq	%r12, %rdi	# 13295	[c=4 l=3]  *movdi_internal/3
+	movq	1040(%r12), %rdx	# 13288	[c=9 l=8]  *movdi_internal/3
+	leaq	.LC43(%rip), %rsi	# 13293	[c=1 l=7]  *movdi_internal/4
+	movzbl	(%rdx,%r13), %ecx	# 13289	[c=13 l=5]  *zero_extendqisi2/0
+	movzbl	%r13b, %edx	# 13290	[c=4 l=4]  *zero_extendqisi2/0
+	call	log_append@PLT	# 13297	[c=0 l=5]  *call
+	movq	1040(%r12), %rdx	# 13298	[c=9 l=8]  *movdi_internal/3
+	movl	$95, %eax	# 13300	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r12), %eax	# 13301	[c=13 l=8]  *subsi_1/1
+	movzbl	(%rdx,%r13), %r14d	# 13299	[c=13 l=5]  zero_extendqidi2/0
+	cmpl	5180(%r12), %eax	# 13302	[c=13 l=8]  *cmpsi_1/1
+	jb	.L1032	# 13303	[c=13 l=2]  *jcc
+	cmpb	$0, 1082(%r12)	# 13305	[c=13 l=9]  *cmpqi_ccno_1/1
+	jne	.L1033	# 13306	[c=13 l=6]  *jcc
+.L1032:
+	movzbl	95(%rdx), %r13d	# 13309	[c=13 l=5]  *zero_extendqisi2/0
+.L1034:
+	movl	%r13d, %ecx	# 13320	[c=4 l=3]  *movsi_internal/0
+	movl	$95, %edx	# 13321	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 13324	[c=4 l=3]  *movdi_internal/3
+	andl	$-31, %r13d	# 13326	[c=4 l=4]  *andsi_1/0
+	leaq	.LC28(%rip), %rsi	# 13322	[c=1 l=7]  *movdi_internal/4
+	call	log_add_data_mov@PLT	# 13325	[c=0 l=5]  *call
+	leaq	flag_update_table_logical(%rip), %rax	# 15696	[c=1 l=7]  *movdi_internal/4
+	movl	$95, %edx	# 13333	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 13336	[c=4 l=3]  *movdi_internal/3
+	movzbl	(%rax,%r14), %eax	# 13329	[c=13 l=5]  *zero_extendqisi2/0
+	leaq	.LC30(%rip), %rsi	# 13334	[c=1 l=7]  *movdi_internal/4
+	orl	%eax, %r13d	# 13330	[c=4 l=3]  *iorsi_1/0
+	movzbl	%r13b, %ecx	# 13331	[c=4 l=4]  *zero_extendqisi2/0
+	call	log_add_data_mov@PLT	# 13337	[c=0 l=5]  *call
+	movl	$95, %eax	# 13338	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r12), %eax	# 13339	[c=13 l=8]  *subsi_1/1
+	cmpl	5180(%r12), %eax	# 13340	[c=13 l=8]  *cmpsi_1/1
+	jb	.L1035	# 13341	[c=13 l=2]  *jcc
+	cmpb	$0, 1082(%r12)	# 13343	[c=13 l=9]  *cmpqi_ccno_1/1
+	jne	.L1036	# 13344	[c=13 l=6]  *jcc
+.L1035:
+	movq	1040(%r12), %rax	# 13347	[c=9 l=8]  *movdi_internal/3
+	movb	%r13b, 95(%rax)	# 13348	[c=4 l=4]  *movqi_internal/8
+.L1037:
+	movq	%rbp, %rsi	# 13359	[c=4 l=3]  *movdi_internal/3
+	movq	%r12, %rdi	# 13360	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 13361	[c=0 l=5]  *call
+	movq	40(%r12), %rax	# 17035	[c=9 l=5]  *movdi_internal/3
+	movq	(%rsp), %rcx	# 17036	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 13363	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rcx), %rdx	# 17267	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r12)	# 13364	[c=4 l=5]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 13366	[c=4 l=3]  *cmpdi_1/0
+	jb	.L297	# 13367	[c=13 l=2]  *jcc
+	movl	(%r12), %r8d	# 13369	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r12, %rdi	# 13374	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r8	# 13370	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r12), %r8	# 13372	[c=13 l=8]  *adddi_1/1
+	movq	%r8, %rbp	# 17038	[c=4 l=3]  *movdi_internal/3
+	movq	%r8, %rsi	# 13373	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 13375	[c=0 l=5]  *call
+	movzbl	9(%rbp), %eax	# 13376	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, (%r12)	# 13377	[c=9 l=4]  *addsi_1/0
+	leaq	handler.1(%rip), %rdi	# 17041	[c=1 l=7]  *movdi_internal/4
+	movzbl	8(%rbp), %eax	# 13380	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 17039	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 13381	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbx,%rdx), %rdx	# 13384	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r12)	# 13385	[c=13 l=5]  *adddi_1/0
+	jmp	*(%rdi,%rax,8)	# 18392	[c=10 l=3]  *indirect_jump
+.L1038:
+	jmp	.L1220	# 18895	[c=1 l=5]  jump
+.L1039:
+	jmp	.L1220	# 18897	[c=1 l=5]  jump
+.L1040:
+	jmp	.L1220	# 18899	[c=1 l=5]  jump
+.L297:
+	leaq	.LC58(%rip), %rdx	# 638	[c=1 l=7]  *movdi_internal/4
+	movl	$2, %esi	# 640	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 641	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 18761	[c=4 l=2]  *movdi_xor
+	call	leave	# 643	[c=0 l=5]  *call
+.L930:
+	cmpl	$4, %eax	# 11305	[c=4 l=3]  *cmpsi_1/0
+	jne	.L933	# 11306	[c=13 l=6]  *jcc
+	movl	%r15d, %r14d	# 11369	[c=1 l=3]  *zero_extendsidi2/3
+	movq	%rcx, %rdi	# 11372	[c=4 l=3]  *movdi_internal/3
+	movl	$255, %esi	# 11371	[c=4 l=5]  *movsi_internal/0
+	movq	%r14, %rdx	# 11370	[c=4 l=3]  *movdi_internal/3
+	call	memset@PLT	# 11373	[c=10 l=5]  *call_value
+	movq	%rax, %rcx	# 17204	[c=4 l=3]  *movdi_internal/3
+.L929:
+	xorl	%eax, %eax	# 18460	[c=4 l=2]  *movdi_xor
+	movl	%r13d, %edx	# 11376	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC62(%rip), %rsi	# 11377	[c=1 l=7]  *movdi_internal/4
+	movq	%r12, %rdi	# 11379	[c=4 l=3]  *movdi_internal/3
+	movq	%rcx, 8(%rsp)	# 17205	[c=4 l=5]  *movdi_internal/5
+	call	log_append@PLT	# 11381	[c=0 l=5]  *call
+	movq	8(%rsp), %rcx	# 17206	[c=9 l=5]  *movdi_internal/3
+	xorl	%eax, %eax	# 18461	[c=4 l=2]  *movdi_xor
+	jmp	.L935	# 18901	[c=1 l=2]  jump
+.L936:
+	movzbl	6052(%r12,%rax), %edx	# 11385	[c=10 l=9]  *movqi_internal/4
+	andb	%dl, (%rcx,%rax)	# 11386	[c=13 l=3]  *andqi_1/0
+	addq	$1, %rax	# 11387	[c=4 l=4]  *adddi_1/0
+.L935:
+	cmpl	%r15d, %eax	# 11391	[c=4 l=3]  *cmpsi_1/0
+	jb	.L936	# 11392	[c=13 l=2]  *jcc
+	movq	16(%rsp), %rdi	# 11398	[c=9 l=5]  *movdi_internal/3
+	movq	%r14, %rdx	# 11396	[c=4 l=3]  *movdi_internal/3
+	movl	$255, %esi	# 11397	[c=4 l=5]  *movsi_internal/0
+	jmp	.L1218	# 18903	[c=1 l=5]  jump
+.L529:
+	cmpl	$4, %eax	# 4622	[c=4 l=3]  *cmpsi_1/0
+	jne	.L532	# 4623	[c=13 l=6]  *jcc
+	movl	%r15d, %eax	# 4686	[c=1 l=3]  *zero_extendsidi2/3
+	movq	%rcx, %rdi	# 4689	[c=4 l=3]  *movdi_internal/3
+	movl	$255, %esi	# 4688	[c=4 l=5]  *movsi_internal/0
+	movq	%rax, %rdx	# 4687	[c=4 l=3]  *movdi_internal/3
+	movq	%rax, 24(%rsp)	# 17122	[c=4 l=5]  *movdi_internal/5
+	call	memset@PLT	# 4690	[c=10 l=5]  *call_value
+	movq	%rax, %rcx	# 17121	[c=4 l=3]  *movdi_internal/3
+.L528:
+	xorl	%eax, %eax	# 18653	[c=4 l=2]  *movdi_xor
+	movl	%r14d, %edx	# 4693	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC62(%rip), %rsi	# 4694	[c=1 l=7]  *movdi_internal/4
+	movq	%r12, %rdi	# 4696	[c=4 l=3]  *movdi_internal/3
+	movq	%rcx, 8(%rsp)	# 17123	[c=4 l=5]  *movdi_internal/5
+	call	log_append@PLT	# 4698	[c=0 l=5]  *call
+	movq	8(%rsp), %rcx	# 17124	[c=9 l=5]  *movdi_internal/3
+	xorl	%eax, %eax	# 18654	[c=4 l=2]  *movdi_xor
+	jmp	.L534	# 18905	[c=1 l=2]  jump
+.L535:
+	movzbl	6052(%r12,%rax), %edx	# 4702	[c=10 l=9]  *movqi_internal/4
+	andb	%dl, (%rcx,%rax)	# 4703	[c=13 l=3]  *andqi_1/0
+	addq	$1, %rax	# 4704	[c=4 l=4]  *adddi_1/0
+.L534:
+	cmpl	%r15d, %eax	# 4708	[c=4 l=3]  *cmpsi_1/0
+	jb	.L535	# 4709	[c=13 l=2]  *jcc
+	movq	24(%rsp), %rdx	# 4713	[c=9 l=5]  *movdi_internal/3
+	movq	16(%rsp), %rdi	# 4715	[c=9 l=5]  *movdi_internal/3
+	movl	$255, %esi	# 4714	[c=4 l=5]  *movsi_internal/0
+	jmp	.L1217	# 18907	[c=1 l=5]  jump
+.L270:
+	leaq	.LC42(%rip), %rsi	# 302	[c=1 l=7]  *movdi_internal/4
+	movq	%r12, %rdi	# 304	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 18794	[c=4 l=2]  *movdi_xor
+	call	log_append@PLT	# 306	[c=0 l=5]  *call
+.L279:
+	movq	%r12, %rdi	# 629	[c=4 l=3]  *movdi_internal/3
+	movq	%rbp, %rsi	# 628	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 630	[c=0 l=5]  *call
+	movq	40(%r12), %rax	# 15844	[c=9 l=5]  *movdi_internal/3
+	movq	(%rsp), %rdi	# 15845	[c=5 l=4]  *movdi_internal/3
+	addq	$1, %rax	# 632	[c=4 l=4]  *adddi_1/0
+	leaq	-1(%rdi), %rdx	# 17433	[c=4 l=4]  *leadi
+	movq	%rax, 40(%r12)	# 633	[c=4 l=5]  *movdi_internal/5
+	cmpq	%rax, %rdx	# 635	[c=4 l=3]  *cmpdi_1/0
+	jb	.L297	# 636	[c=13 l=6]  *jcc
+	movq	56(%r12), %rax	# 15846	[c=9 l=5]  *movdi_internal/3
+	cmpq	%rax, 48(%r12)	# 648	[c=13 l=5]  *cmpdi_1/0
+	jnb	.L1418	# 649	[c=13 l=6]  *jcc
+.L287:
+	movq	%r12, %rdi	# 655	[c=4 l=3]  *movdi_internal/3
+	call	log_is_idle@PLT	# 656	[c=10 l=5]  *call_value
+	testb	%al, %al	# 658	[c=4 l=2]  *cmpqi_ccno_1/0
+	jne	.L1419	# 659	[c=13 l=6]  *jcc
+.L288:
+	movl	(%r12), %r8d	# 670	[c=6 l=4]  *zero_extendsidi2/3
+	movq	%r12, %rdi	# 675	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %r8	# 671	[c=4 l=4]  *ashldi3_1/0
+	addq	1064(%r12), %r8	# 673	[c=13 l=8]  *adddi_1/1
+	movq	%r8, %rbp	# 15848	[c=4 l=3]  *movdi_internal/3
+	movq	%r8, %rsi	# 674	[c=4 l=3]  *movdi_internal/3
+	call	log_add_instr@PLT	# 676	[c=0 l=5]  *call
+	movzbl	9(%rbp), %eax	# 677	[c=13 l=4]  *zero_extendqisi2/0
+	addl	%eax, (%r12)	# 678	[c=9 l=4]  *addsi_1/0
+	leaq	handler.1(%rip), %rdi	# 15851	[c=1 l=7]  *movdi_internal/4
+	movzbl	8(%rbp), %eax	# 681	[c=13 l=4]  zero_extendqidi2/0
+	movq	%rax, %rdx	# 15849	[c=4 l=3]  *movdi_internal/3
+	salq	$4, %rdx	# 682	[c=4 l=4]  *ashldi3_1/0
+	movswq	10(%rbx,%rdx), %rdx	# 685	[c=14 l=6]  extendhidi2
+	addq	%rdx, 48(%r12)	# 686	[c=13 l=5]  *adddi_1/0
+	jmp	*(%rdi,%rax,8)	# 18760	[c=10 l=3]  *indirect_jump
+.L1376:
+	movl	%r14d, %edx	# 8749	[c=4 l=3]  *movsi_internal/0
+	movl	$94, %esi	# 8750	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 8751	[c=4 l=3]  *movdi_internal/3
+	call	data_write_mapped	# 8752	[c=0 l=5]  *call
+	jmp	.L753	# 18911	[c=1 l=5]  jump
+.L1375:
+	movzbl	%r13b, %edx	# 8725	[c=4 l=4]  *zero_extendqisi2/0
+	movl	$93, %esi	# 8727	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 8728	[c=4 l=3]  *movdi_internal/3
+	call	data_write_mapped	# 8729	[c=0 l=5]  *call
+	jmp	.L751	# 18913	[c=1 l=5]  jump
+.L1373:
+	movl	%r14d, %edx	# 8501	[c=4 l=3]  *movsi_internal/0
+	movl	$94, %esi	# 8502	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 8503	[c=4 l=3]  *movdi_internal/3
+	call	data_write_mapped	# 8504	[c=0 l=5]  *call
+	jmp	.L734	# 18915	[c=1 l=5]  jump
+.L1372:
+	movzbl	%r15b, %edx	# 8477	[c=4 l=4]  *zero_extendqisi2/0
+	movl	$93, %esi	# 8479	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 8480	[c=4 l=3]  *movdi_internal/3
+	call	data_write_mapped	# 8481	[c=0 l=5]  *call
+	jmp	.L732	# 18917	[c=1 l=5]  jump
+.L1379:
+	movl	%r15d, %edx	# 9029	[c=4 l=3]  *movsi_internal/0
+	movl	$94, %esi	# 9030	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 9031	[c=4 l=3]  *movdi_internal/3
+	call	data_write_mapped	# 9032	[c=0 l=5]  *call
+	jmp	.L777	# 18919	[c=1 l=5]  jump
+.L1378:
+	movzbl	%r13b, %edx	# 9005	[c=4 l=4]  *zero_extendqisi2/0
+	movl	$93, %esi	# 9007	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 9008	[c=4 l=3]  *movdi_internal/3
+	call	data_write_mapped	# 9009	[c=0 l=5]  *call
+	jmp	.L775	# 18921	[c=1 l=5]  jump
+.L1353:
+	movl	%r14d, %edx	# 3847	[c=4 l=3]  *movsi_internal/0
+	movl	$94, %esi	# 3848	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 3849	[c=4 l=3]  *movdi_internal/3
+	call	data_write_mapped	# 3850	[c=0 l=5]  *call
+	jmp	.L486	# 18923	[c=1 l=5]  jump
+.L1352:
+	movzbl	%r13b, %edx	# 3823	[c=4 l=4]  *zero_extendqisi2/0
+	movl	$93, %esi	# 3825	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 3826	[c=4 l=3]  *movdi_internal/3
+	call	data_write_mapped	# 3827	[c=0 l=5]  *call
+	jmp	.L484	# 18925	[c=1 l=5]  jump
+.L1384:
+	movl	%r14d, %edx	# 9329	[c=4 l=3]  *movsi_internal/0
+	movl	$94, %esi	# 9330	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 9331	[c=4 l=3]  *movdi_internal/3
+	call	data_write_mapped	# 9332	[c=0 l=5]  *call
+	jmp	.L803	# 18927	[c=1 l=5]  jump
+.L1383:
+	movzbl	%r15b, %edx	# 9305	[c=4 l=4]  *zero_extendqisi2/0
+	movl	$93, %esi	# 9307	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 9308	[c=4 l=3]  *movdi_internal/3
+	call	data_write_mapped	# 9309	[c=0 l=5]  *call
+	jmp	.L801	# 18929	[c=1 l=5]  jump
+.L1389:
+	movl	%r14d, %edx	# 9623	[c=4 l=3]  *movsi_internal/0
+	movl	$94, %esi	# 9624	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 9625	[c=4 l=3]  *movdi_internal/3
+	call	data_write_mapped	# 9626	[c=0 l=5]  *call
+	jmp	.L829	# 18931	[c=1 l=5]  jump
+.L1388:
+	movzbl	%r15b, %edx	# 9599	[c=4 l=4]  *zero_extendqisi2/0
+	movl	$93, %esi	# 9601	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 9602	[c=4 l=3]  *movdi_internal/3
+	call	data_write_mapped	# 9603	[c=0 l=5]  *call
+	jmp	.L827	# 18933	[c=1 l=5]  jump
+.L1364:
+	movl	%r14d, %edx	# 5481	[c=4 l=3]  *movsi_internal/0
+	movl	$94, %esi	# 5482	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 5483	[c=4 l=3]  *movdi_internal/3
+	call	data_write_mapped	# 5484	[c=0 l=5]  *call
+	jmp	.L585	# 18935	[c=1 l=5]  jump
+.L1363:
+	movzbl	%r13b, %edx	# 5457	[c=4 l=4]  *zero_extendqisi2/0
+	movl	$93, %esi	# 5459	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 5460	[c=4 l=3]  *movdi_internal/3
+	call	data_write_mapped	# 5461	[c=0 l=5]  *call
+	jmp	.L583	# 18937	[c=1 l=5]  jump
+.L1343:
+	movl	%eax, %edx	# 2532	[c=4 l=2]  *movsi_internal/0
+	movl	$94, %esi	# 2533	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 2534	[c=4 l=3]  *movdi_internal/3
+	call	data_write_mapped	# 2535	[c=0 l=5]  *call
+	jmp	.L405	# 18939	[c=1 l=5]  jump
+.L1342:
+	movzbl	%r13b, %edx	# 2508	[c=4 l=4]  *zero_extendqisi2/0
+	movl	$93, %esi	# 2510	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 2511	[c=4 l=3]  *movdi_internal/3
+	call	data_write_mapped	# 2512	[c=0 l=5]  *call
+	jmp	.L403	# 18941	[c=1 l=5]  jump
+.L278:
+	movq	1040(%r12), %rax	# 620	[c=9 l=8]  *movdi_internal/3
+	movl	%r13d, %esi	# 623	[c=4 l=3]  *movsi_internal/0
+	movq	%r12, %rdi	# 624	[c=4 l=3]  *movdi_internal/3
+	movzwl	24(%rax), %edx	# 621	[c=13 l=4]  *zero_extendhisi2/0
+	call	do_syscall@PLT	# 625	[c=0 l=5]  *call
+	jmp	.L279	# 18943	[c=1 l=5]  jump
+.L736:
+	movl	%r15d, %esi	# 8531	[c=4 l=3]  *movsi_internal/0
+	movq	%r12, %rdi	# 8532	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 8533	[c=10 l=5]  *call_value
+	movl	%eax, %r14d	# 8534	[c=4 l=3]  *movsi_internal/0
+	jmp	.L737	# 18945	[c=1 l=5]  jump
+.L723:
+	movl	8(%rsp), %edx	# 8359	[c=9 l=4]  *movsi_internal/0
+	movl	%r14d, %esi	# 8360	[c=4 l=3]  *movsi_internal/0
+	movq	%r12, %rdi	# 8361	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 8362	[c=0 l=5]  *call
+	jmp	.L724	# 18947	[c=1 l=5]  jump
+.L767:
+	movl	16(%rsp), %edx	# 8937	[c=9 l=4]  *movsi_internal/0
+	movl	%r14d, %esi	# 8938	[c=4 l=3]  *movsi_internal/0
+	movq	%r12, %rdi	# 8939	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 8940	[c=0 l=5]  *call
+	jmp	.L768	# 18949	[c=1 l=5]  jump
+.L896:
+	movl	%edx, %esi	# 10699	[c=4 l=2]  *movsi_internal/0
+	movq	%r12, %rdi	# 10700	[c=4 l=3]  *movdi_internal/3
+	movl	%edx, 8(%rsp)	# 17197	[c=4 l=4]  *movsi_internal/1
+	call	data_read_page	# 10701	[c=10 l=5]  *call_value
+	movl	8(%rsp), %edx	# 17198	[c=9 l=4]  *movsi_internal/0
+	movl	%eax, %r14d	# 10702	[c=4 l=3]  *movsi_internal/0
+	jmp	.L897	# 18951	[c=1 l=5]  jump
+.L888:
+	movl	%edx, %esi	# 10592	[c=4 l=2]  *movsi_internal/0
+	movq	%r12, %rdi	# 10593	[c=4 l=3]  *movdi_internal/3
+	movl	%edx, 8(%rsp)	# 17195	[c=4 l=4]  *movsi_internal/1
+	call	data_read_page	# 10594	[c=10 l=5]  *call_value
+	movl	8(%rsp), %edx	# 17196	[c=9 l=4]  *movsi_internal/0
+	movl	%eax, %r14d	# 10595	[c=4 l=3]  *movsi_internal/0
+	jmp	.L889	# 18953	[c=1 l=5]  jump
+.L880:
+	movl	%edx, %esi	# 10485	[c=4 l=2]  *movsi_internal/0
+	movq	%r12, %rdi	# 10486	[c=4 l=3]  *movdi_internal/3
+	movl	%edx, 8(%rsp)	# 17193	[c=4 l=4]  *movsi_internal/1
+	call	data_read_page	# 10487	[c=10 l=5]  *call_value
+	movl	8(%rsp), %edx	# 17194	[c=9 l=4]  *movsi_internal/0
+	movl	%eax, %r14d	# 10488	[c=4 l=3]  *movsi_internal/0
+	jmp	.L881	# 18955	[c=1 l=5]  jump
+.L872:
+	movl	%edx, %esi	# 10378	[c=4 l=2]  *movsi_internal/0
+	movq	%r12, %rdi	# 10379	[c=4 l=3]  *movdi_internal/3
+	movl	%edx, 8(%rsp)	# 17191	[c=4 l=4]  *movsi_internal/1
+	call	data_read_page	# 10380	[c=10 l=5]  *call_value
+	movl	8(%rsp), %edx	# 17192	[c=9 l=4]  *movsi_internal/0
+	movl	%eax, %r14d	# 10381	[c=4 l=3]  *movsi_internal/0
+	jmp	.L873	# 18957	[c=1 l=5]  jump
+.L852:
+	movl	%r15d, %edx	# 10060	[c=4 l=3]  *movsi_internal/0
+	movl	$95, %esi	# 10061	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 10062	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 10063	[c=0 l=5]  *call
+	jmp	.L853	# 18959	[c=1 l=5]  jump
+.L1396:
+	movl	$95, %esi	# 10024	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 10025	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 10026	[c=10 l=5]  *call_value
+	movl	%eax, %r15d	# 10027	[c=4 l=3]  *movsi_internal/0
+	jmp	.L850	# 18961	[c=1 l=5]  jump
+.L868:
+	movl	%r15d, %edx	# 10317	[c=4 l=3]  *movsi_internal/0
+	movl	%r14d, %esi	# 10318	[c=4 l=3]  *movsi_internal/0
+	movq	%r12, %rdi	# 10319	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 10320	[c=0 l=5]  *call
+	jmp	.L869	# 18963	[c=1 l=5]  jump
+.L861:
+	movl	%r14d, %esi	# 10260	[c=4 l=3]  *movsi_internal/0
+	movq	%r12, %rdi	# 10261	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 10262	[c=10 l=5]  *call_value
+	jmp	.L862	# 18965	[c=1 l=5]  jump
+.L763:
+	movl	%r13d, %edx	# 8899	[c=4 l=3]  *movsi_internal/0
+	movl	%r15d, %esi	# 8900	[c=4 l=3]  *movsi_internal/0
+	movq	%r12, %rdi	# 8901	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 8902	[c=0 l=5]  *call
+	jmp	.L764	# 18967	[c=1 l=5]  jump
+.L543:
+	movl	$95, %esi	# 4879	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 4880	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 4881	[c=10 l=5]  *call_value
+	movl	%eax, %r15d	# 4882	[c=4 l=3]  *movsi_internal/0
+	jmp	.L544	# 18969	[c=1 l=5]  jump
+.L476:
+	movl	8(%rsp), %edx	# 3755	[c=9 l=4]  *movsi_internal/0
+	movl	%r14d, %esi	# 3756	[c=4 l=3]  *movsi_internal/0
+	movq	%r12, %rdi	# 3757	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 3758	[c=0 l=5]  *call
+	jmp	.L477	# 18971	[c=1 l=5]  jump
+.L472:
+	movl	%r13d, %edx	# 3717	[c=4 l=3]  *movsi_internal/0
+	movl	%r15d, %esi	# 3718	[c=4 l=3]  *movsi_internal/0
+	movq	%r12, %rdi	# 3719	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 3720	[c=0 l=5]  *call
+	jmp	.L473	# 18973	[c=1 l=5]  jump
+.L518:
+	movl	$95, %esi	# 4465	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 4466	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 4467	[c=10 l=5]  *call_value
+	movl	%eax, %r13d	# 4468	[c=4 l=3]  *movsi_internal/0
+	jmp	.L519	# 18975	[c=1 l=5]  jump
+.L514:
+	movl	%r13d, %edx	# 4373	[c=4 l=3]  *movsi_internal/0
+	movl	$91, %esi	# 4374	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 4375	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 4376	[c=0 l=5]  *call
+	jmp	.L515	# 18977	[c=1 l=5]  jump
+.L511:
+	movl	$91, %esi	# 4304	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 4305	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 4306	[c=10 l=5]  *call_value
+	movl	%eax, %r15d	# 4307	[c=4 l=3]  *movsi_internal/0
+	jmp	.L512	# 18979	[c=1 l=5]  jump
+.L507:
+	movl	$91, %esi	# 4212	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 4213	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 4214	[c=10 l=5]  *call_value
+	jmp	.L508	# 18981	[c=1 l=5]  jump
+.L503:
+	movl	$91, %esi	# 4121	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 4122	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 4123	[c=10 l=5]  *call_value
+	movl	%eax, %r14d	# 4124	[c=4 l=3]  *movsi_internal/0
+	jmp	.L504	# 18983	[c=1 l=5]  jump
+.L550:
+	movl	$95, %esi	# 5019	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 5020	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 5021	[c=10 l=5]  *call_value
+	movl	%eax, %r15d	# 5022	[c=4 l=3]  *movsi_internal/0
+	jmp	.L551	# 18985	[c=1 l=5]  jump
+.L521:
+	movl	%r13d, %edx	# 4504	[c=4 l=3]  *movsi_internal/0
+	movl	$95, %esi	# 4505	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 4506	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 4507	[c=0 l=5]  *call
+	jmp	.L522	# 18987	[c=1 l=5]  jump
+.L560:
+	movl	%r14d, %edx	# 5195	[c=4 l=3]  *movsi_internal/0
+	movl	$95, %esi	# 5196	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 5197	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 5198	[c=0 l=5]  *call
+	jmp	.L561	# 18989	[c=1 l=5]  jump
+.L557:
+	movl	$95, %esi	# 5159	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 5160	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 5161	[c=10 l=5]  *call_value
+	movl	%eax, %r15d	# 5162	[c=4 l=3]  *movsi_internal/0
+	jmp	.L558	# 18991	[c=1 l=5]  jump
+.L546:
+	movl	%r14d, %edx	# 4915	[c=4 l=3]  *movsi_internal/0
+	movl	$95, %esi	# 4916	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 4917	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 4918	[c=0 l=5]  *call
+	jmp	.L547	# 18993	[c=1 l=5]  jump
+.L553:
+	movl	%r14d, %edx	# 5055	[c=4 l=3]  *movsi_internal/0
+	movl	$95, %esi	# 5056	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 5057	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 5058	[c=0 l=5]  *call
+	jmp	.L554	# 18995	[c=1 l=5]  jump
+.L575:
+	movl	8(%rsp), %edx	# 5389	[c=9 l=4]  *movsi_internal/0
+	movl	%r14d, %esi	# 5390	[c=4 l=3]  *movsi_internal/0
+	movq	%r12, %rdi	# 5391	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 5392	[c=0 l=5]  *call
+	jmp	.L576	# 18997	[c=1 l=5]  jump
+.L571:
+	movl	%r13d, %edx	# 5351	[c=4 l=3]  *movsi_internal/0
+	movl	%r15d, %esi	# 5352	[c=4 l=3]  *movsi_internal/0
+	movq	%r12, %rdi	# 5353	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 5354	[c=0 l=5]  *call
+	jmp	.L572	# 18999	[c=1 l=5]  jump
+.L718:
+	movl	%r14d, %edx	# 8274	[c=4 l=3]  *movsi_internal/0
+	movl	$95, %esi	# 8275	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 8276	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 8277	[c=0 l=5]  *call
+	jmp	.L719	# 19001	[c=1 l=5]  jump
+.L715:
+	movl	$95, %esi	# 8235	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 8236	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 8237	[c=10 l=5]  *call_value
+	movl	%eax, %r14d	# 8238	[c=4 l=3]  *movsi_internal/0
+	jmp	.L716	# 19003	[c=1 l=5]  jump
+.L711:
+	movl	%r13d, %edx	# 8148	[c=4 l=3]  *movsi_internal/0
+	movl	$95, %esi	# 8149	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 8150	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 8151	[c=0 l=5]  *call
+	jmp	.L712	# 19005	[c=1 l=5]  jump
+.L708:
+	movl	$95, %esi	# 8109	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 8110	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 8111	[c=10 l=5]  *call_value
+	movl	%eax, %r13d	# 8112	[c=4 l=3]  *movsi_internal/0
+	jmp	.L709	# 19007	[c=1 l=5]  jump
+.L703:
+	movl	%r14d, %edx	# 7983	[c=4 l=3]  *movsi_internal/0
+	movl	$95, %esi	# 7984	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 7985	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 7986	[c=0 l=5]  *call
+	jmp	.L704	# 19009	[c=1 l=5]  jump
+.L700:
+	movl	$95, %esi	# 7944	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 7945	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 7946	[c=10 l=5]  *call_value
+	movl	%eax, %r14d	# 7947	[c=4 l=3]  *movsi_internal/0
+	jmp	.L701	# 19011	[c=1 l=5]  jump
+.L696:
+	movl	%r14d, %edx	# 7845	[c=4 l=3]  *movsi_internal/0
+	movl	$95, %esi	# 7846	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 7847	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 7848	[c=0 l=5]  *call
+	jmp	.L697	# 19013	[c=1 l=5]  jump
+.L693:
+	movl	$95, %esi	# 7809	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 7810	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 7811	[c=10 l=5]  *call_value
+	movl	%eax, %r15d	# 7812	[c=4 l=3]  *movsi_internal/0
+	jmp	.L694	# 19015	[c=1 l=5]  jump
+.L689:
+	movl	%r14d, %edx	# 7707	[c=4 l=3]  *movsi_internal/0
+	movl	$95, %esi	# 7708	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 7709	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 7710	[c=0 l=5]  *call
+	jmp	.L690	# 19017	[c=1 l=5]  jump
+.L686:
+	movl	$95, %esi	# 7671	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 7672	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 7673	[c=10 l=5]  *call_value
+	movl	%eax, %r15d	# 7674	[c=4 l=3]  *movsi_internal/0
+	jmp	.L687	# 19019	[c=1 l=5]  jump
+.L682:
+	movl	%r13d, %edx	# 7569	[c=4 l=3]  *movsi_internal/0
+	movl	$95, %esi	# 7570	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 7571	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 7572	[c=0 l=5]  *call
+	jmp	.L683	# 19021	[c=1 l=5]  jump
+.L679:
+	movl	$95, %esi	# 7533	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 7534	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 7535	[c=10 l=5]  *call_value
+	movl	%eax, %r13d	# 7536	[c=4 l=3]  *movsi_internal/0
+	jmp	.L680	# 19023	[c=1 l=5]  jump
+.L673:
+	movl	%r13d, %edx	# 7319	[c=4 l=3]  *movsi_internal/0
+	movl	$95, %esi	# 7320	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 7321	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 7322	[c=0 l=5]  *call
+	jmp	.L674	# 19025	[c=1 l=5]  jump
+.L670:
+	movl	$95, %esi	# 7280	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 7281	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 7282	[c=10 l=5]  *call_value
+	movl	%eax, %r13d	# 7283	[c=4 l=3]  *movsi_internal/0
+	jmp	.L671	# 19027	[c=1 l=5]  jump
+.L662:
+	movl	%r15d, %esi	# 6966	[c=4 l=3]  *movsi_internal/0
+	movq	%r12, %rdi	# 6967	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 6968	[c=10 l=5]  *call_value
+	movl	%eax, %r14d	# 6969	[c=4 l=3]  *movsi_internal/0
+	jmp	.L663	# 19029	[c=1 l=5]  jump
+.L657:
+	movl	%r15d, %esi	# 6862	[c=4 l=3]  *movsi_internal/0
+	movq	%r12, %rdi	# 6863	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 6864	[c=10 l=5]  *call_value
+	movl	%eax, %r14d	# 6865	[c=4 l=3]  *movsi_internal/0
+	jmp	.L658	# 19031	[c=1 l=5]  jump
+.L652:
+	movl	%r15d, %esi	# 6757	[c=4 l=3]  *movsi_internal/0
+	movq	%r12, %rdi	# 6758	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 6759	[c=10 l=5]  *call_value
+	movl	%eax, %r14d	# 6760	[c=4 l=3]  *movsi_internal/0
+	jmp	.L653	# 19033	[c=1 l=5]  jump
+.L647:
+	movl	%r15d, %esi	# 6653	[c=4 l=3]  *movsi_internal/0
+	movq	%r12, %rdi	# 6654	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 6655	[c=10 l=5]  *call_value
+	movl	%eax, %r14d	# 6656	[c=4 l=3]  *movsi_internal/0
+	jmp	.L648	# 19035	[c=1 l=5]  jump
+.L642:
+	movl	%r15d, %esi	# 6548	[c=4 l=3]  *movsi_internal/0
+	movq	%r12, %rdi	# 6549	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 6550	[c=10 l=5]  *call_value
+	movl	%eax, %r14d	# 6551	[c=4 l=3]  *movsi_internal/0
+	jmp	.L643	# 19037	[c=1 l=5]  jump
+.L637:
+	movl	%r15d, %esi	# 6444	[c=4 l=3]  *movsi_internal/0
+	movq	%r12, %rdi	# 6445	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 6446	[c=10 l=5]  *call_value
+	movl	%eax, %r14d	# 6447	[c=4 l=3]  *movsi_internal/0
+	jmp	.L638	# 19039	[c=1 l=5]  jump
+.L632:
+	movl	%r15d, %esi	# 6353	[c=4 l=3]  *movsi_internal/0
+	movq	%r12, %rdi	# 6354	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 6355	[c=10 l=5]  *call_value
+	movl	%eax, %r14d	# 6356	[c=4 l=3]  *movsi_internal/0
+	jmp	.L633	# 19041	[c=1 l=5]  jump
+.L627:
+	movl	%edx, %esi	# 6262	[c=4 l=2]  *movsi_internal/0
+	movq	%r12, %rdi	# 6263	[c=4 l=3]  *movdi_internal/3
+	movl	%edx, 8(%rsp)	# 17143	[c=4 l=4]  *movsi_internal/1
+	call	data_read_page	# 6264	[c=10 l=5]  *call_value
+	movl	8(%rsp), %edx	# 17144	[c=9 l=4]  *movsi_internal/0
+	movl	%eax, %r13d	# 6265	[c=4 l=3]  *movsi_internal/0
+	jmp	.L628	# 19043	[c=1 l=5]  jump
+.L622:
+	movl	%edx, %esi	# 6179	[c=4 l=2]  *movsi_internal/0
+	movq	%r12, %rdi	# 6180	[c=4 l=3]  *movdi_internal/3
+	movl	%edx, 8(%rsp)	# 17141	[c=4 l=4]  *movsi_internal/1
+	call	data_read_page	# 6181	[c=10 l=5]  *call_value
+	movl	8(%rsp), %edx	# 17142	[c=9 l=4]  *movsi_internal/0
+	movl	%eax, %r13d	# 6182	[c=4 l=3]  *movsi_internal/0
+	jmp	.L623	# 19045	[c=1 l=5]  jump
+.L617:
+	movl	%edx, %esi	# 6096	[c=4 l=2]  *movsi_internal/0
+	movq	%r12, %rdi	# 6097	[c=4 l=3]  *movdi_internal/3
+	movl	%edx, 8(%rsp)	# 17139	[c=4 l=4]  *movsi_internal/1
+	call	data_read_page	# 6098	[c=10 l=5]  *call_value
+	movl	8(%rsp), %edx	# 17140	[c=9 l=4]  *movsi_internal/0
+	movl	%eax, %r14d	# 6099	[c=4 l=3]  *movsi_internal/0
+	jmp	.L618	# 19047	[c=1 l=5]  jump
+.L612:
+	movl	%edx, %esi	# 6005	[c=4 l=2]  *movsi_internal/0
+	movq	%r12, %rdi	# 6006	[c=4 l=3]  *movdi_internal/3
+	movl	%edx, 8(%rsp)	# 17137	[c=4 l=4]  *movsi_internal/1
+	call	data_read_page	# 6007	[c=10 l=5]  *call_value
+	movl	8(%rsp), %edx	# 17138	[c=9 l=4]  *movsi_internal/0
+	movl	%eax, %r14d	# 6008	[c=4 l=3]  *movsi_internal/0
+	jmp	.L613	# 19049	[c=1 l=5]  jump
+.L603:
+	movl	%r13d, %edx	# 5815	[c=4 l=3]  *movsi_internal/0
+	movl	$95, %esi	# 5816	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 5817	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 5818	[c=0 l=5]  *call
+	jmp	.L604	# 19051	[c=1 l=5]  jump
+.L600:
+	movl	$95, %esi	# 5776	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 5777	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 5778	[c=10 l=5]  *call_value
+	movl	%eax, %r13d	# 5779	[c=4 l=3]  *movsi_internal/0
+	jmp	.L601	# 19053	[c=1 l=5]  jump
+.L595:
+	movl	%edx, %esi	# 5673	[c=4 l=2]  *movsi_internal/0
+	movq	%r12, %rdi	# 5674	[c=4 l=3]  *movdi_internal/3
+	movl	%edx, 8(%rsp)	# 17133	[c=4 l=4]  *movsi_internal/1
+	call	data_read_page	# 5675	[c=10 l=5]  *call_value
+	movl	8(%rsp), %edx	# 17134	[c=9 l=4]  *movsi_internal/0
+	movl	%eax, %r13d	# 5676	[c=4 l=3]  *movsi_internal/0
+	jmp	.L596	# 19055	[c=1 l=5]  jump
+.L488:
+	movl	$92, %esi	# 3883	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 3884	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 3885	[c=10 l=5]  *call_value
+	movl	%eax, %r14d	# 3886	[c=4 l=3]  *movsi_internal/0
+	jmp	.L489	# 19057	[c=1 l=5]  jump
+.L748:
+	movl	8(%rsp), %edx	# 8702	[c=9 l=4]  *movsi_internal/0
+	movl	%r15d, %esi	# 8703	[c=4 l=3]  *movsi_internal/0
+	movq	%r12, %rdi	# 8704	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 8705	[c=0 l=5]  *call
+	jmp	.L749	# 19059	[c=1 l=5]  jump
+.L307:
+	movl	$95, %esi	# 1053	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 1054	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 1055	[c=10 l=5]  *call_value
+	movl	%eax, %r13d	# 1056	[c=4 l=3]  *movsi_internal/0
+	jmp	.L308	# 19061	[c=1 l=5]  jump
+.L303:
+	movl	%r13d, %edx	# 947	[c=4 l=3]  *movsi_internal/0
+	movl	$95, %esi	# 948	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 949	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 950	[c=0 l=5]  *call
+	jmp	.L304	# 19063	[c=1 l=5]  jump
+.L300:
+	movl	$95, %esi	# 908	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 909	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 910	[c=10 l=5]  *call_value
+	movl	%eax, %r14d	# 911	[c=4 l=3]  *movsi_internal/0
+	jmp	.L301	# 19065	[c=1 l=5]  jump
+.L295:
+	movl	%r14d, %edx	# 802	[c=4 l=3]  *movsi_internal/0
+	movl	$95, %esi	# 803	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 804	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 805	[c=0 l=5]  *call
+	jmp	.L296	# 19067	[c=1 l=5]  jump
+.L292:
+	movl	$95, %esi	# 763	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 764	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 765	[c=10 l=5]  *call_value
+	movl	%eax, %r14d	# 766	[c=4 l=3]  *movsi_internal/0
+	jmp	.L293	# 19069	[c=1 l=5]  jump
+.L356:
+	movl	$95, %esi	# 1905	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 1906	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 1907	[c=10 l=5]  *call_value
+	movl	%eax, %r14d	# 1908	[c=4 l=3]  *movsi_internal/0
+	jmp	.L357	# 19071	[c=1 l=5]  jump
+.L349:
+	movl	$95, %esi	# 1769	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 1770	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 1771	[c=10 l=5]  *call_value
+	jmp	.L350	# 19073	[c=1 l=5]  jump
+.L345:
+	movl	%r13d, %edx	# 1699	[c=4 l=3]  *movsi_internal/0
+	movl	$95, %esi	# 1700	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 1701	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 1702	[c=0 l=5]  *call
+	jmp	.L346	# 19075	[c=1 l=5]  jump
+.L342:
+	movl	$95, %esi	# 1663	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 1664	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 1665	[c=10 l=5]  *call_value
+	movl	%eax, %r14d	# 1666	[c=4 l=3]  *movsi_internal/0
+	jmp	.L343	# 19077	[c=1 l=5]  jump
+.L338:
+	movl	%r13d, %edx	# 1607	[c=4 l=3]  *movsi_internal/0
+	movl	$95, %esi	# 1608	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 1609	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 1610	[c=0 l=5]  *call
+	jmp	.L339	# 19079	[c=1 l=5]  jump
+.L335:
+	movl	$95, %esi	# 1568	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 1569	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 1570	[c=10 l=5]  *call_value
+	movl	%eax, %r13d	# 1571	[c=4 l=3]  *movsi_internal/0
+	jmp	.L336	# 19081	[c=1 l=5]  jump
+.L331:
+	movl	%r14d, %edx	# 1488	[c=4 l=3]  *movsi_internal/0
+	movl	$95, %esi	# 1489	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 1490	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 1491	[c=0 l=5]  *call
+	jmp	.L332	# 19083	[c=1 l=5]  jump
+.L328:
+	movl	$95, %esi	# 1449	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 1450	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 1451	[c=10 l=5]  *call_value
+	movl	%eax, %r14d	# 1452	[c=4 l=3]  *movsi_internal/0
+	jmp	.L329	# 19085	[c=1 l=5]  jump
+.L324:
+	movl	%r13d, %edx	# 1363	[c=4 l=3]  *movsi_internal/0
+	movl	$95, %esi	# 1364	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 1365	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 1366	[c=0 l=5]  *call
+	jmp	.L325	# 19087	[c=1 l=5]  jump
+.L321:
+	movl	$95, %esi	# 1324	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 1325	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 1326	[c=10 l=5]  *call_value
+	movl	%eax, %r13d	# 1327	[c=4 l=3]  *movsi_internal/0
+	jmp	.L322	# 19089	[c=1 l=5]  jump
+.L317:
+	movl	%r13d, %edx	# 1232	[c=4 l=3]  *movsi_internal/0
+	movl	$95, %esi	# 1233	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 1234	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 1235	[c=0 l=5]  *call
+	jmp	.L318	# 19091	[c=1 l=5]  jump
+.L314:
+	movl	$95, %esi	# 1196	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 1197	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 1198	[c=10 l=5]  *call_value
+	movl	%eax, %r13d	# 1199	[c=4 l=3]  *movsi_internal/0
+	jmp	.L315	# 19093	[c=1 l=5]  jump
+.L310:
+	movl	%r13d, %edx	# 1089	[c=4 l=3]  *movsi_internal/0
+	movl	$95, %esi	# 1090	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 1091	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 1092	[c=0 l=5]  *call
+	jmp	.L311	# 19095	[c=1 l=5]  jump
+.L496:
+	movl	$92, %esi	# 4016	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 4017	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 4018	[c=10 l=5]  *call_value
+	movl	%eax, %r14d	# 4019	[c=4 l=3]  *movsi_internal/0
+	jmp	.L497	# 19097	[c=1 l=5]  jump
+.L395:
+	movl	24(%rsp), %edx	# 2440	[c=9 l=4]  *movsi_internal/0
+	movl	%r15d, %esi	# 2441	[c=4 l=3]  *movsi_internal/0
+	movq	%r12, %rdi	# 2442	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 2443	[c=0 l=5]  *call
+	jmp	.L396	# 19099	[c=1 l=5]  jump
+.L391:
+	movl	%r13d, %edx	# 2402	[c=4 l=3]  *movsi_internal/0
+	movl	%r14d, %esi	# 2403	[c=4 l=3]  *movsi_internal/0
+	movq	%r12, %rdi	# 2404	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 2405	[c=0 l=5]  *call
+	jmp	.L392	# 19101	[c=1 l=5]  jump
+.L380:
+	movl	%r13d, %edx	# 2257	[c=4 l=3]  *movsi_internal/0
+	movl	$95, %esi	# 2258	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 2259	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 2260	[c=0 l=5]  *call
+	jmp	.L381	# 19103	[c=1 l=5]  jump
+.L377:
+	movl	$95, %esi	# 2221	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 2222	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 2223	[c=10 l=5]  *call_value
+	movl	%eax, %r13d	# 2224	[c=4 l=3]  *movsi_internal/0
+	jmp	.L378	# 19105	[c=1 l=5]  jump
+.L373:
+	movl	%r13d, %edx	# 2147	[c=4 l=3]  *movsi_internal/0
+	movl	$95, %esi	# 2148	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 2149	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 2150	[c=0 l=5]  *call
+	jmp	.L374	# 19107	[c=1 l=5]  jump
+.L370:
+	movl	$95, %esi	# 2112	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 2113	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 2114	[c=10 l=5]  *call_value
+	movl	%eax, %r14d	# 2115	[c=4 l=3]  *movsi_internal/0
+	jmp	.L371	# 19109	[c=1 l=5]  jump
+.L363:
+	movl	$95, %esi	# 2009	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 2010	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 2011	[c=10 l=5]  *call_value
+	movl	%eax, %r14d	# 2012	[c=4 l=3]  *movsi_internal/0
+	jmp	.L364	# 19111	[c=1 l=5]  jump
+.L459:
+	movl	%r13d, %edx	# 3521	[c=4 l=3]  *movsi_internal/0
+	movl	$95, %esi	# 3522	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 3523	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 3524	[c=0 l=5]  *call
+	jmp	.L460	# 19113	[c=1 l=5]  jump
+.L456:
+	movl	$95, %esi	# 3482	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 3483	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 3484	[c=10 l=5]  *call_value
+	movl	%eax, %r13d	# 3485	[c=4 l=3]  *movsi_internal/0
+	jmp	.L457	# 19115	[c=1 l=5]  jump
+.L444:
+	movl	%r14d, %edx	# 3209	[c=4 l=3]  *movsi_internal/0
+	movl	$95, %esi	# 3210	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 3211	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 3212	[c=0 l=5]  *call
+	jmp	.L445	# 19117	[c=1 l=5]  jump
+.L441:
+	movl	$95, %esi	# 3170	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 3171	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 3172	[c=10 l=5]  *call_value
+	movl	%eax, %r14d	# 3173	[c=4 l=3]  *movsi_internal/0
+	jmp	.L442	# 19119	[c=1 l=5]  jump
+.L425:
+	movl	%r13d, %edx	# 2815	[c=4 l=3]  *movsi_internal/0
+	movl	$95, %esi	# 2816	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 2817	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 2818	[c=0 l=5]  *call
+	jmp	.L426	# 19121	[c=1 l=5]  jump
+.L422:
+	movl	$95, %esi	# 2779	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 2780	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 2781	[c=10 l=5]  *call_value
+	movl	%eax, %r13d	# 2782	[c=4 l=3]  *movsi_internal/0
+	jmp	.L423	# 19123	[c=1 l=5]  jump
+.L437:
+	movl	%r14d, %edx	# 3082	[c=4 l=3]  *movsi_internal/0
+	movl	$95, %esi	# 3083	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 3084	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 3085	[c=0 l=5]  *call
+	jmp	.L438	# 19125	[c=1 l=5]  jump
+.L1346:
+	movl	$95, %esi	# 3046	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 3047	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 3048	[c=10 l=5]  *call_value
+	movl	%eax, %r14d	# 3049	[c=4 l=3]  *movsi_internal/0
+	jmp	.L435	# 19127	[c=1 l=5]  jump
+.L432:
+	movl	%r14d, %edx	# 2948	[c=4 l=3]  *movsi_internal/0
+	movl	$95, %esi	# 2949	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 2950	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 2951	[c=0 l=5]  *call
+	jmp	.L433	# 19129	[c=1 l=5]  jump
+.L429:
+	movl	$95, %esi	# 2909	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 2910	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 2911	[c=10 l=5]  *call_value
+	movl	%eax, %r14d	# 2912	[c=4 l=3]  *movsi_internal/0
+	jmp	.L430	# 19131	[c=1 l=5]  jump
+.L418:
+	movl	%r14d, %edx	# 2694	[c=4 l=3]  *movsi_internal/0
+	movl	%r15d, %esi	# 2695	[c=4 l=3]  *movsi_internal/0
+	movq	%r12, %rdi	# 2696	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 2697	[c=0 l=5]  *call
+	jmp	.L419	# 19133	[c=1 l=5]  jump
+.L411:
+	movl	%r15d, %esi	# 2636	[c=4 l=3]  *movsi_internal/0
+	movq	%r12, %rdi	# 2637	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 2638	[c=10 l=5]  *call_value
+	movl	%eax, %ecx	# 2639	[c=4 l=2]  *movsi_internal/0
+	jmp	.L412	# 19135	[c=1 l=5]  jump
+.L1036:
+	movl	%r13d, %edx	# 13353	[c=4 l=3]  *movsi_internal/0
+	movl	$95, %esi	# 13354	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 13355	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 13356	[c=0 l=5]  *call
+	jmp	.L1037	# 19137	[c=1 l=5]  jump
+.L1033:
+	movl	$95, %esi	# 13314	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 13315	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 13316	[c=10 l=5]  *call_value
+	movl	%eax, %r13d	# 13317	[c=4 l=3]  *movsi_internal/0
+	jmp	.L1034	# 19139	[c=1 l=5]  jump
+.L1029:
+	movl	%r14d, %edx	# 13246	[c=4 l=3]  *movsi_internal/0
+	movl	$95, %esi	# 13247	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 13248	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 13249	[c=0 l=5]  *call
+	jmp	.L1030	# 19141	[c=1 l=5]  jump
+.L1026:
+	movl	$95, %esi	# 13207	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 13208	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 13209	[c=10 l=5]  *call_value
+	movl	%eax, %r14d	# 13210	[c=4 l=3]  *movsi_internal/0
+	jmp	.L1027	# 19143	[c=1 l=5]  jump
+.L1022:
+	movl	%r14d, %edx	# 13117	[c=4 l=3]  *movsi_internal/0
+	movl	$95, %esi	# 13118	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 13119	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 13120	[c=0 l=5]  *call
+	jmp	.L1023	# 19145	[c=1 l=5]  jump
+.L1019:
+	movl	$95, %esi	# 13078	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 13079	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 13080	[c=10 l=5]  *call_value
+	movl	%eax, %r14d	# 13081	[c=4 l=3]  *movsi_internal/0
+	jmp	.L1020	# 19147	[c=1 l=5]  jump
+.L1015:
+	movl	%r13d, %edx	# 12992	[c=4 l=3]  *movsi_internal/0
+	movl	$95, %esi	# 12993	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 12994	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 12995	[c=0 l=5]  *call
+	jmp	.L1016	# 19149	[c=1 l=5]  jump
+.L1012:
+	movl	$95, %esi	# 12955	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 12956	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 12957	[c=10 l=5]  *call_value
+	movl	%eax, %r14d	# 12958	[c=4 l=3]  *movsi_internal/0
+	jmp	.L1013	# 19151	[c=1 l=5]  jump
+.L1006:
+	movl	%r14d, %edx	# 12795	[c=4 l=3]  *movsi_internal/0
+	movl	$95, %esi	# 12796	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 12797	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 12798	[c=0 l=5]  *call
+	jmp	.L1007	# 19153	[c=1 l=5]  jump
+.L1003:
+	movl	$95, %esi	# 12756	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 12757	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 12758	[c=10 l=5]  *call_value
+	movl	%eax, %r14d	# 12759	[c=4 l=3]  *movsi_internal/0
+	jmp	.L1004	# 19155	[c=1 l=5]  jump
+.L999:
+	movl	%r13d, %edx	# 12657	[c=4 l=3]  *movsi_internal/0
+	movl	$95, %esi	# 12658	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 12659	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 12660	[c=0 l=5]  *call
+	jmp	.L1000	# 19157	[c=1 l=5]  jump
+.L996:
+	movl	$95, %esi	# 12618	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 12619	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 12620	[c=10 l=5]  *call_value
+	movl	%eax, %r13d	# 12621	[c=4 l=3]  *movsi_internal/0
+	jmp	.L997	# 19159	[c=1 l=5]  jump
+.L992:
+	movl	8(%rsp), %edx	# 12498	[c=9 l=4]  *movsi_internal/0
+	movl	%r13d, %esi	# 12499	[c=4 l=3]  *movsi_internal/0
+	movq	%r12, %rdi	# 12500	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 12501	[c=0 l=5]  *call
+	jmp	.L993	# 19161	[c=1 l=5]  jump
+.L987:
+	movl	%r13d, %edx	# 12392	[c=4 l=3]  *movsi_internal/0
+	movl	%r14d, %esi	# 12393	[c=4 l=3]  *movsi_internal/0
+	movq	%r12, %rdi	# 12394	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 12395	[c=0 l=5]  *call
+	jmp	.L988	# 19163	[c=1 l=5]  jump
+.L982:
+	movl	8(%rsp), %edx	# 12285	[c=9 l=4]  *movsi_internal/0
+	movl	%r13d, %esi	# 12286	[c=4 l=3]  *movsi_internal/0
+	movq	%r12, %rdi	# 12287	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 12288	[c=0 l=5]  *call
+	jmp	.L983	# 19165	[c=1 l=5]  jump
+.L977:
+	movl	%r13d, %edx	# 12179	[c=4 l=3]  *movsi_internal/0
+	movl	%r14d, %esi	# 12180	[c=4 l=3]  *movsi_internal/0
+	movq	%r12, %rdi	# 12181	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 12182	[c=0 l=5]  *call
+	jmp	.L978	# 19167	[c=1 l=5]  jump
+.L972:
+	movl	8(%rsp), %edx	# 12072	[c=9 l=4]  *movsi_internal/0
+	movl	%r13d, %esi	# 12073	[c=4 l=3]  *movsi_internal/0
+	movq	%r12, %rdi	# 12074	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 12075	[c=0 l=5]  *call
+	jmp	.L973	# 19169	[c=1 l=5]  jump
+.L967:
+	movl	%r13d, %edx	# 11966	[c=4 l=3]  *movsi_internal/0
+	movl	%r14d, %esi	# 11967	[c=4 l=3]  *movsi_internal/0
+	movq	%r12, %rdi	# 11968	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 11969	[c=0 l=5]  *call
+	jmp	.L968	# 19171	[c=1 l=5]  jump
+.L962:
+	movl	8(%rsp), %edx	# 11873	[c=9 l=4]  *movsi_internal/0
+	movl	%r14d, %esi	# 11874	[c=4 l=3]  *movsi_internal/0
+	movq	%r12, %rdi	# 11875	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 11876	[c=0 l=5]  *call
+	jmp	.L963	# 19173	[c=1 l=5]  jump
+.L957:
+	movl	8(%rsp), %edx	# 11780	[c=9 l=4]  *movsi_internal/0
+	movl	%r14d, %esi	# 11781	[c=4 l=3]  *movsi_internal/0
+	movq	%r12, %rdi	# 11782	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 11783	[c=0 l=5]  *call
+	jmp	.L958	# 19175	[c=1 l=5]  jump
+.L952:
+	movl	8(%rsp), %edx	# 11695	[c=9 l=4]  *movsi_internal/0
+	movl	%r14d, %esi	# 11696	[c=4 l=3]  *movsi_internal/0
+	movq	%r12, %rdi	# 11697	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 11698	[c=0 l=5]  *call
+	jmp	.L953	# 19177	[c=1 l=5]  jump
+.L947:
+	movl	16(%rsp), %edx	# 11610	[c=9 l=4]  *movsi_internal/0
+	movl	%r13d, %esi	# 11611	[c=4 l=3]  *movsi_internal/0
+	movq	%r12, %rdi	# 11612	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 11613	[c=0 l=5]  *call
+	jmp	.L948	# 19179	[c=1 l=5]  jump
+.L942:
+	movl	16(%rsp), %edx	# 11517	[c=9 l=4]  *movsi_internal/0
+	movl	%r13d, %esi	# 11518	[c=4 l=3]  *movsi_internal/0
+	movq	%r12, %rdi	# 11519	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 11520	[c=0 l=5]  *call
+	jmp	.L943	# 19181	[c=1 l=5]  jump
+.L796:
+	movl	%r15d, %esi	# 9262	[c=4 l=3]  *movsi_internal/0
+	movq	%r12, %rdi	# 9263	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 9264	[c=10 l=5]  *call_value
+	movl	%eax, %r14d	# 9265	[c=4 l=3]  *movsi_internal/0
+	jmp	.L797	# 19183	[c=1 l=5]  jump
+.L792:
+	movl	%edx, %esi	# 9225	[c=4 l=2]  *movsi_internal/0
+	movq	%r12, %rdi	# 9226	[c=4 l=3]  *movdi_internal/3
+	movl	%edx, 8(%rsp)	# 17170	[c=4 l=4]  *movsi_internal/1
+	call	data_read_page	# 9227	[c=10 l=5]  *call_value
+	movl	8(%rsp), %edx	# 17171	[c=9 l=4]  *movsi_internal/0
+	movl	%eax, %r13d	# 9228	[c=4 l=3]  *movsi_internal/0
+	jmp	.L793	# 19185	[c=1 l=5]  jump
+.L834:
+	movl	%r13d, %edx	# 9690	[c=4 l=3]  *movsi_internal/0
+	movl	$95, %esi	# 9691	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 9692	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 9693	[c=0 l=5]  *call
+	jmp	.L835	# 19187	[c=1 l=5]  jump
+.L831:
+	movl	$95, %esi	# 9653	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 9654	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 9655	[c=10 l=5]  *call_value
+	movl	%eax, %r14d	# 9656	[c=4 l=3]  *movsi_internal/0
+	jmp	.L832	# 19189	[c=1 l=5]  jump
+.L822:
+	movl	%r15d, %esi	# 9556	[c=4 l=3]  *movsi_internal/0
+	movq	%r12, %rdi	# 9557	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 9558	[c=10 l=5]  *call_value
+	movl	%eax, %r14d	# 9559	[c=4 l=3]  *movsi_internal/0
+	jmp	.L823	# 19191	[c=1 l=5]  jump
+.L818:
+	movl	%edx, %esi	# 9519	[c=4 l=2]  *movsi_internal/0
+	movq	%r12, %rdi	# 9520	[c=4 l=3]  *movdi_internal/3
+	movl	%edx, 8(%rsp)	# 17172	[c=4 l=4]  *movsi_internal/1
+	call	data_read_page	# 9521	[c=10 l=5]  *call_value
+	movl	8(%rsp), %edx	# 17173	[c=9 l=4]  *movsi_internal/0
+	movl	%eax, %r13d	# 9522	[c=4 l=3]  *movsi_internal/0
+	jmp	.L819	# 19193	[c=1 l=5]  jump
+.L844:
+	movl	$95, %esi	# 9876	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 9877	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 9878	[c=10 l=5]  *call_value
+	movl	%eax, %r13d	# 9879	[c=4 l=3]  *movsi_internal/0
+	jmp	.L845	# 19195	[c=1 l=5]  jump
+.L847:
+	movl	%r13d, %edx	# 9915	[c=4 l=3]  *movsi_internal/0
+	movl	$95, %esi	# 9916	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 9917	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 9918	[c=0 l=5]  *call
+	jmp	.L848	# 19197	[c=1 l=5]  jump
+.L857:
+	movl	%r15d, %edx	# 10199	[c=4 l=3]  *movsi_internal/0
+	movl	$95, %esi	# 10200	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 10201	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 10202	[c=0 l=5]  *call
+	jmp	.L858	# 19199	[c=1 l=5]  jump
+.L1395:
+	movl	$95, %esi	# 10163	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 10164	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 10165	[c=10 l=5]  *call_value
+	movl	%eax, %r15d	# 10166	[c=4 l=3]  *movsi_internal/0
+	jmp	.L855	# 19201	[c=1 l=5]  jump
+.L271:
+	leaq	.LC56(%rip), %rsi	# 606	[c=1 l=7]  *movdi_internal/4
+	movq	%r12, %rdi	# 608	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 18762	[c=4 l=2]  *movdi_xor
+	call	log_append@PLT	# 610	[c=0 l=5]  *call
+	movl	$1, %esi	# 613	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 614	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 18763	[c=4 l=2]  *movdi_xor
+	leaq	.LC57(%rip), %rdx	# 611	[c=1 l=7]  *movdi_internal/4
+	call	leave	# 616	[c=0 l=5]  *call
+.L273:
+	movq	1040(%r12), %rax	# 578	[c=9 l=8]  *movdi_internal/3
+	leaq	.LC54(%rip), %rsi	# 581	[c=1 l=7]  *movdi_internal/4
+	movq	%r12, %rdi	# 583	[c=4 l=3]  *movdi_internal/3
+	movswl	24(%rax), %ebx	# 579	[c=13 l=4]  extendhisi2/1
+	xorl	%eax, %eax	# 18764	[c=4 l=2]  *movdi_xor
+	movl	%ebx, %edx	# 580	[c=4 l=2]  *movsi_internal/0
+	call	log_append@PLT	# 585	[c=0 l=5]  *call
+	movq	1040(%r12), %rax	# 586	[c=9 l=8]  *movdi_internal/3
+	movl	$24, %edx	# 589	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 592	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC44(%rip), %rsi	# 590	[c=1 l=7]  *movdi_internal/4
+	movzwl	24(%rax), %ecx	# 587	[c=13 l=4]  *zero_extendhisi2/0
+	xorl	%eax, %eax	# 18765	[c=4 l=2]  *movdi_xor
+	call	log_append@PLT	# 594	[c=0 l=5]  *call
+	movl	%ebx, 76(%r12)	# 595	[c=4 l=5]  *movsi_internal/1
+	movl	%ebx, %ecx	# 596	[c=4 l=2]  *movsi_internal/0
+	xorl	%esi, %esi	# 18766	[c=4 l=2]  *movdi_xor
+	leaq	.LC55(%rip), %rdx	# 597	[c=1 l=7]  *movdi_internal/4
+	movq	%r12, %rdi	# 600	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 18767	[c=4 l=2]  *movdi_xor
+	call	leave	# 602	[c=0 l=5]  *call
+.L274:
+	cmpl	$0, 264(%r12)	# 542	[c=13 l=9]  *cmpsi_ccno_1/1
+	je	.L285	# 543	[c=13 l=6]  *jcc
+	movq	%r12, %rdi	# 547	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 18769	[c=4 l=2]  *movdi_xor
+	leaq	.LC52(%rip), %rsi	# 545	[c=1 l=7]  *movdi_internal/4
+	call	log_append@PLT	# 549	[c=0 l=5]  *call
+	movq	1040(%r12), %rax	# 551	[c=9 l=8]  *movdi_internal/3
+	movq	%r12, %rdi	# 557	[c=4 l=3]  *movdi_internal/3
+	movl	$24, %edx	# 554	[c=4 l=5]  *movsi_internal/0
+	leaq	.LC43(%rip), %rsi	# 555	[c=1 l=7]  *movdi_internal/4
+	movq	904(%r12), %r13	# 550	[c=9 l=8]  *movdi_internal/3
+	movzbl	24(%rax), %ecx	# 552	[c=13 l=4]  *zero_extendqisi2/0
+	xorl	%eax, %eax	# 18770	[c=4 l=2]  *movdi_xor
+	call	log_append@PLT	# 559	[c=0 l=5]  *call
+	movq	1040(%r12), %rax	# 560	[c=9 l=8]  *movdi_internal/3
+	movq	%r13, %rsi	# 562	[c=4 l=3]  *movdi_internal/3
+	movsbl	24(%rax), %edi	# 561	[c=13 l=4]  extendqisi2
+	call	putc@PLT	# 564	[c=10 l=5]  *call_value
+	jmp	.L279	# 19203	[c=1 l=5]  jump
+.L275:
+	cmpl	$0, 248(%r12)	# 497	[c=13 l=9]  *cmpsi_ccno_1/1
+	je	.L284	# 498	[c=13 l=6]  *jcc
+	leaq	.LC50(%rip), %rsi	# 500	[c=1 l=7]  *movdi_internal/4
+	movq	%r12, %rdi	# 502	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 18772	[c=4 l=2]  *movdi_xor
+	call	log_append@PLT	# 504	[c=0 l=5]  *call
+	movq	904(%r12), %rdi	# 505	[c=9 l=8]  *movdi_internal/3
+	call	fflush@PLT	# 507	[c=10 l=5]  *call_value
+	movq	40(%r12), %rdx	# 508	[c=9 l=5]  *movdi_internal/3
+	xorl	%esi, %esi	# 18773	[c=4 l=2]  *movdi_xor
+	movq	%r12, %rdi	# 513	[c=4 l=3]  *movdi_internal/3
+	leaq	host_getchar(%rip), %rcx	# 509	[c=1 l=7]  *movdi_internal/4
+	call	replay_input@PLT	# 514	[c=10 l=5]  *call_value
+	movl	$24, %edx	# 518	[c=4 l=5]  *movsi_internal/0
+	leaq	.LC48(%rip), %rsi	# 519	[c=1 l=7]  *movdi_internal/4
+	movq	%r12, %rdi	# 521	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, %r13d	# 515	[c=4 l=3]  *movsi_internal/0
+	movzwl	%ax, %ecx	# 516	[c=4 l=3]  *zero_extendhisi2/0
+	xorl	%eax, %eax	# 18774	[c=4 l=2]  *movdi_xor
+	call	log_append@PLT	# 523	[c=0 l=5]  *call
+	movq	1040(%r12), %rax	# 524	[c=9 l=8]  *movdi_internal/3
+	movl	%r13d, %ecx	# 15843	[c=4 l=3]  *movsi_internal/0
+	movb	%r13b, 24(%rax)	# 525	[c=4 l=4]  *movqi_internal/8
+	movq	1040(%r12), %rax	# 526	[c=9 l=8]  *movdi_internal/3
+	movb	%ch, 25(%rax)	# 18775	[c=4 l=3]  *extzvqi_mem_rex64
+	jmp	.L279	# 19205	[c=1 l=5]  jump
+.L277:
+	movq	1040(%r12), %rax	# 311	[c=9 l=8]  *movdi_internal/3
+	movl	$24, %edx	# 314	[c=4 l=5]  *movsi_internal/0
+	leaq	.LC43(%rip), %rsi	# 315	[c=1 l=7]  *movdi_internal/4
+	movq	%r12, %rdi	# 317	[c=4 l=3]  *movdi_internal/3
+	movzbl	24(%rax), %ecx	# 312	[c=13 l=4]  *zero_extendqisi2/0
+	xorl	%eax, %eax	# 18790	[c=4 l=2]  *movdi_xor
+	call	log_append@PLT	# 319	[c=0 l=5]  *call
+	movq	1040(%r12), %rax	# 320	[c=9 l=8]  *movdi_internal/3
+	movl	$20, %edx	# 325	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 328	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC44(%rip), %rsi	# 326	[c=1 l=7]  *movdi_internal/4
+	movzwl	20(%rax), %r9d	# 323	[c=13 l=5]  *zero_extendhisi2/0
+	movzbl	24(%rax), %r14d	# 321	[c=13 l=5]  *zero_extendqisi2/0
+	xorl	%eax, %eax	# 18791	[c=4 l=2]  *movdi_xor
+	movl	%r9d, %ecx	# 324	[c=4 l=3]  *movsi_internal/0
+	movl	%r9d, 8(%rsp)	# 17048	[c=4 l=5]  *movsi_internal/1
+	call	log_append@PLT	# 330	[c=0 l=5]  *call
+	movq	1040(%r12), %rax	# 331	[c=9 l=8]  *movdi_internal/3
+	movl	$22, %edx	# 334	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 337	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC44(%rip), %rsi	# 17047	[c=1 l=7]  *movdi_internal/4
+	movzwl	22(%rax), %r13d	# 332	[c=13 l=5]  *zero_extendhisi2/0
+	xorl	%eax, %eax	# 18792	[c=4 l=2]  *movdi_xor
+	movl	%r13d, %ecx	# 333	[c=4 l=3]  *movsi_internal/0
+	sall	$16, %r13d	# 340	[c=4 l=4]  *ashlsi3_1/0
+	call	log_append@PLT	# 339	[c=0 l=5]  *call
+	movl	8(%rsp), %r9d	# 17049	[c=9 l=5]  *movsi_internal/0
+	xorl	%eax, %eax	# 18793	[c=4 l=2]  *movdi_xor
+	movl	%r14d, %edx	# 343	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC45(%rip), %rsi	# 344	[c=1 l=7]  *movdi_internal/4
+	movq	%r12, %rdi	# 346	[c=4 l=3]  *movdi_internal/3
+	orl	%r9d, %r13d	# 341	[c=4 l=3]  *iorsi_1/0
+	movl	%r13d, %ecx	# 342	[c=4 l=3]  *movsi_internal/0
+	call	log_append@PLT	# 348	[c=0 l=5]  *call
+	testb	%r14b, %r14b	# 351	[c=4 l=3]  *cmpqi_ccno_1/0
+	jle	.L280	# 352	[c=13 l=6]  *jcc
+	cmpl	$8193, 880(%r12)	# 14209	[c=13 l=12]  *cmpsi_1/0
+	sbbl	%eax, %eax	# 14210	[c=8 l=2]  *x86_movsicc_0_m1
+	addl	$2, %eax	# 14211	[c=4 l=3]  *addsi_1/0
+	imull	%r14d, %eax	# 362	[c=12 l=4]  *mulsi3_1/2
+	cmpl	%eax, 992(%r12)	# 363	[c=13 l=8]  *cmpsi_1/0
+	jb	.L280	# 364	[c=13 l=6]  *jcc
+	movq	irq_raise@GOTPCREL(%rip), %rdx	# 383	[c=5 l=7]  *movdi_internal/3
+	movl	%r13d, %esi	# 377	[c=1 l=3]  *zero_extendsidi2/3
+	movl	%r14d, %ecx	# 380	[c=4 l=3]  *movsi_internal/0
+	movq	%r12, %rdi	# 385	[c=4 l=3]  *movdi_internal/3
+	addq	48(%r12), %rsi	# 379	[c=13 l=5]  *adddi_1/1
+	call	event_schedule@PLT	# 386	[c=0 l=5]  *call
+	jmp	.L279	# 19207	[c=1 l=5]  jump
+.L276:
+	cmpl	$0, 504(%r12)	# 391	[c=13 l=9]  *cmpsi_ccno_1/1
+	jne	.L283	# 392	[c=13 l=6]  *jcc
+	leaq	.LC48(%rip), %r13	# 401	[c=1 l=7]  *movdi_internal/4
+	leaq	.LC47(%rip), %rsi	# 394	[c=1 l=7]  *movdi_internal/4
+	movq	%r12, %rdi	# 396	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 18783	[c=4 l=2]  *movdi_xor
+	call	log_append@PLT	# 398	[c=0 l=5]  *call
+	movl	$1, %ecx	# 399	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rsi	# 402	[c=4 l=3]  *movdi_internal/3
+	movq	%r12, %rdi	# 403	[c=4 l=3]  *movdi_internal/3
+	movl	$20, %edx	# 400	[c=4 l=5]  *movsi_internal/0
+	xorl	%eax, %eax	# 18784	[c=4 l=2]  *movdi_xor
+	call	log_append@PLT	# 405	[c=0 l=5]  *call
+	xorl	%ecx, %ecx	# 18785	[c=4 l=2]  *movdi_xor
+	movl	$22, %edx	# 411	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rsi	# 413	[c=4 l=3]  *movdi_internal/3
+	movq	1040(%r12), %rax	# 406	[c=9 l=8]  *movdi_internal/3
+	movq	%r12, %rdi	# 414	[c=4 l=3]  *movdi_internal/3
+	movb	$1, 20(%rax)	# 407	[c=4 l=4]  *movqi_internal/8
+	movq	1040(%r12), %rax	# 408	[c=9 l=8]  *movdi_internal/3
+	movb	$0, 21(%rax)	# 409	[c=4 l=4]  *movqi_internal/8
+	xorl	%eax, %eax	# 18786	[c=4 l=2]  *movdi_xor
+	call	log_append@PLT	# 416	[c=0 l=5]  *call
+	xorl	%ecx, %ecx	# 18787	[c=4 l=2]  *movdi_xor
+	movl	$24, %edx	# 422	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rsi	# 424	[c=4 l=3]  *movdi_internal/3
+	movq	1040(%r12), %rax	# 417	[c=9 l=8]  *movdi_internal/3
+	movq	%r12, %rdi	# 425	[c=4 l=3]  *movdi_internal/3
+	movb	$0, 22(%rax)	# 418	[c=4 l=4]  *movqi_internal/8
+	movq	1040(%r12), %rax	# 419	[c=9 l=8]  *movdi_internal/3
+	movb	$0, 23(%rax)	# 420	[c=4 l=4]  *movqi_internal/8
+	xorl	%eax, %eax	# 18788	[c=4 l=2]  *movdi_xor
+	call	log_append@PLT	# 427	[c=0 l=5]  *call
+	movq	1040(%r12), %rax	# 428	[c=9 l=8]  *movdi_internal/3
+	movb	$0, 24(%rax)	# 429	[c=4 l=4]  *movqi_internal/8
+	movq	1040(%r12), %rax	# 430	[c=9 l=8]  *movdi_internal/3
+	movb	$0, 25(%rax)	# 431	[c=4 l=4]  *movqi_internal/8
+	jmp	.L279	# 19209	[c=1 l=5]  jump
+.L755:
+	movq	1040(%r12), %rax	# 8821	[c=9 l=8]  *movdi_internal/3
+	movl	$94, %ecx	# 8823	[c=4 l=5]  *movsi_internal/0
+	subl	%r14d, %ecx	# 8824	[c=4 l=3]  *subsi_1/0
+	movzbl	93(%rax), %r15d	# 8822	[c=13 l=5]  *zero_extendqisi2/0
+	cmpl	%r13d, %ecx	# 8825	[c=4 l=3]  *cmpsi_1/0
+	jb	.L757	# 8826	[c=13 l=6]  *jcc
+	cmpb	$1, 1082(%r12)	# 8830	[c=13 l=9]  *cmpqi_1/0
+	jbe	.L757	# 8831	[c=13 l=6]  *jcc
+.L758:
+	movl	$94, %esi	# 8834	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 8835	[c=4 l=3]  *movdi_internal/3
+	call	data_read_mapped	# 8836	[c=10 l=5]  *call_value
+	jmp	.L759	# 19211	[c=1 l=5]  jump
+.L383:
+	movq	1040(%r12), %rax	# 2324	[c=9 l=8]  *movdi_internal/3
+	movl	$94, %esi	# 2326	[c=4 l=5]  *movsi_internal/0
+	subl	%r15d, %esi	# 2327	[c=4 l=3]  *subsi_1/0
+	movzbl	93(%rax), %r14d	# 2325	[c=13 l=5]  *zero_extendqisi2/0
+	cmpl	%r13d, %esi	# 2328	[c=4 l=3]  *cmpsi_1/0
+	jb	.L385	# 2329	[c=13 l=6]  *jcc
+	cmpb	$1, 1082(%r12)	# 2333	[c=13 l=9]  *cmpqi_1/0
+	jbe	.L385	# 2334	[c=13 l=6]  *jcc
+.L386:
+	movl	$94, %esi	# 2337	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 2338	[c=4 l=3]  *movdi_internal/3
+	call	data_read_mapped	# 2339	[c=10 l=5]  *call_value
+	jmp	.L387	# 19213	[c=1 l=5]  jump
+.L563:
+	movq	1040(%r12), %rax	# 5273	[c=9 l=8]  *movdi_internal/3
+	movl	$94, %ecx	# 5275	[c=4 l=5]  *movsi_internal/0
+	subl	%r14d, %ecx	# 5276	[c=4 l=3]  *subsi_1/0
+	movzbl	93(%rax), %edx	# 5274	[c=13 l=4]  *zero_extendqisi2/0
+	cmpl	%r13d, %ecx	# 5277	[c=4 l=3]  *cmpsi_1/0
+	jb	.L565	# 5278	[c=13 l=6]  *jcc
+	cmpb	$1, 1082(%r12)	# 5282	[c=13 l=9]  *cmpqi_1/0
+	jbe	.L565	# 5283	[c=13 l=6]  *jcc
+.L566:
+	movl	$94, %esi	# 5286	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 5287	[c=4 l=3]  *movdi_internal/3
+	movl	%edx, 8(%rsp)	# 17131	[c=4 l=4]  *movsi_internal/1
+	call	data_read_mapped	# 5288	[c=10 l=5]  *call_value
+	movl	8(%rsp), %edx	# 17132	[c=9 l=4]  *movsi_internal/0
+	movl	%eax, %r15d	# 5289	[c=4 l=3]  *movsi_internal/0
+	jmp	.L567	# 19215	[c=1 l=5]  jump
+.L781:
+	movq	1040(%r12), %rax	# 9132	[c=9 l=8]  *movdi_internal/3
+	movl	$94, %edx	# 9134	[c=4 l=5]  *movsi_internal/0
+	subl	%r14d, %edx	# 9135	[c=4 l=3]  *subsi_1/0
+	movzbl	93(%rax), %r15d	# 9133	[c=13 l=5]  *zero_extendqisi2/0
+	cmpl	%r13d, %edx	# 9136	[c=4 l=3]  *cmpsi_1/0
+	jb	.L783	# 9137	[c=13 l=6]  *jcc
+	cmpb	$1, 1082(%r12)	# 9141	[c=13 l=9]  *cmpqi_1/0
+	jbe	.L783	# 9142	[c=13 l=6]  *jcc
+.L784:
+	movl	$94, %esi	# 9145	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 9146	[c=4 l=3]  *movdi_internal/3
+	call	data_read_mapped	# 9147	[c=10 l=5]  *call_value
+	jmp	.L785	# 19217	[c=1 l=5]  jump
+.L807:
+	movq	1040(%r12), %rax	# 9426	[c=9 l=8]  *movdi_internal/3
+	movl	$94, %edx	# 9428	[c=4 l=5]  *movsi_internal/0
+	subl	%r14d, %edx	# 9429	[c=4 l=3]  *subsi_1/0
+	movzbl	93(%rax), %r15d	# 9427	[c=13 l=5]  *zero_extendqisi2/0
+	cmpl	%r13d, %edx	# 9430	[c=4 l=3]  *cmpsi_1/0
+	jb	.L809	# 9431	[c=13 l=6]  *jcc
+	cmpb	$1, 1082(%r12)	# 9435	[c=13 l=9]  *cmpqi_1/0
+	jbe	.L809	# 9436	[c=13 l=6]  *jcc
+.L810:
+	movl	$94, %esi	# 9439	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 9440	[c=4 l=3]  *movdi_internal/3
+	call	data_read_mapped	# 9441	[c=10 l=5]  *call_value
+	jmp	.L811	# 19219	[c=1 l=5]  jump
+.L726:
+	movq	1040(%r12), %rax	# 8426	[c=9 l=8]  *movdi_internal/3
+	movl	$94, %esi	# 8428	[c=4 l=5]  *movsi_internal/0
+	subl	%ecx, %esi	# 8429	[c=4 l=2]  *subsi_1/0
+	movzbl	93(%rax), %r14d	# 8427	[c=13 l=5]  *zero_extendqisi2/0
+	cmpl	%r15d, %esi	# 8430	[c=4 l=3]  *cmpsi_1/0
+	jb	.L728	# 8431	[c=13 l=6]  *jcc
+	cmpb	$1, 1082(%r12)	# 8435	[c=13 l=9]  *cmpqi_1/0
+	jbe	.L728	# 8436	[c=13 l=6]  *jcc
+.L729:
+	movl	$94, %esi	# 8439	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 8440	[c=4 l=3]  *movdi_internal/3
+	call	data_read_mapped	# 8441	[c=10 l=5]  *call_value
+	movl	%eax, %r9d	# 8442	[c=4 l=3]  *movsi_internal/0
+	jmp	.L730	# 19221	[c=1 l=5]  jump
+.L464:
+	movq	1040(%r12), %rax	# 3641	[c=9 l=8]  *movdi_internal/3
+	movzbl	93(%rax), %edx	# 3642	[c=13 l=4]  *zero_extendqisi2/0
+	cmpl	%r14d, %r13d	# 3643	[c=4 l=3]  *cmpsi_1/0
+	jb	.L466	# 3644	[c=13 l=6]  *jcc
+	cmpb	$1, 1082(%r12)	# 3648	[c=13 l=9]  *cmpqi_1/0
+	jbe	.L466	# 3649	[c=13 l=6]  *jcc
+.L467:
+	movl	$94, %esi	# 3652	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 3653	[c=4 l=3]  *movdi_internal/3
+	movl	%edx, 8(%rsp)	# 17104	[c=4 l=4]  *movsi_internal/1
+	call	data_read_mapped	# 3654	[c=10 l=5]  *call_value
+	movl	8(%rsp), %edx	# 17105	[c=9 l=4]  *movsi_internal/0
+	movl	%eax, %r15d	# 3655	[c=4 l=3]  *movsi_internal/0
+	jmp	.L468	# 19223	[c=1 l=5]  jump
+.L740:
+	movl	$94, %eax	# 8633	[c=4 l=5]  *movsi_internal/0
+	movzbl	93(%r13), %r15d	# 8632	[c=13 l=5]  *zero_extendqisi2/0
+	subl	%r9d, %eax	# 8634	[c=4 l=3]  *subsi_1/0
+	cmpl	%ecx, %eax	# 8635	[c=4 l=2]  *cmpsi_1/0
+	jb	.L742	# 8636	[c=13 l=6]  *jcc
+	cmpb	$1, 1082(%r12)	# 8640	[c=13 l=9]  *cmpqi_1/0
+	jbe	.L742	# 8641	[c=13 l=6]  *jcc
+.L743:
+	movl	$94, %esi	# 8644	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 8645	[c=4 l=3]  *movdi_internal/3
+	call	data_read_mapped	# 8646	[c=10 l=5]  *call_value
+	jmp	.L744	# 19225	[c=1 l=5]  jump
+.L1339:
+	movb	$1, 11032(%r12)	# 2063	[c=4 l=9]  *movqi_internal/8
+	movq	%r12, %rdi	# 2066	[c=4 l=3]  *movdi_internal/3
+	movzbl	11037(%r12), %esi	# 2064	[c=13 l=9]  *zero_extendqisi2/0
+	call	execute_lean@PLT	# 2067	[c=0 l=5]  *call
+	movq	%r12, %rdi	# 2068	[c=4 l=3]  *movdi_internal/3
+	call	perf_lean_resume@PLT	# 2069	[c=0 l=5]  *call
+	jmp	.L367	# 19227	[c=1 l=5]  jump
+.L1338:
+	movq	%r12, %rdi	# 2053	[c=4 l=3]  *movdi_internal/3
+	call	do_events	# 2054	[c=0 l=5]  *call
+	jmp	.L366	# 19229	[c=1 l=5]  jump
+.L1381:
+	movb	$1, 11032(%r12)	# 9074	[c=4 l=9]  *movqi_internal/8
+	movq	%r12, %rdi	# 9077	[c=4 l=3]  *movdi_internal/3
+	movzbl	11037(%r12), %esi	# 9075	[c=13 l=9]  *zero_extendqisi2/0
+	call	execute_lean@PLT	# 9078	[c=0 l=5]  *call
+	movq	%r12, %rdi	# 9079	[c=4 l=3]  *movdi_internal/3
+	call	perf_lean_resume@PLT	# 9080	[c=0 l=5]  *call
+	jmp	.L779	# 19231	[c=1 l=5]  jump
+.L1336:
+	movq	%r12, %rdi	# 1949	[c=4 l=3]  *movdi_internal/3
+	call	do_events	# 1950	[c=0 l=5]  *call
+	jmp	.L359	# 19233	[c=1 l=5]  jump
+.L1345:
+	movb	$1, 11032(%r12)	# 2582	[c=4 l=9]  *movqi_internal/8
+	movq	%r12, %rdi	# 2585	[c=4 l=3]  *movdi_internal/3
+	movzbl	11037(%r12), %esi	# 2583	[c=13 l=9]  *zero_extendqisi2/0
+	call	execute_lean@PLT	# 2586	[c=0 l=5]  *call
+	movq	%r12, %rdi	# 2587	[c=4 l=3]  *movdi_internal/3
+	call	perf_lean_resume@PLT	# 2588	[c=0 l=5]  *call
+	jmp	.L408	# 19235	[c=1 l=5]  jump
+.L1344:
+	movq	%r12, %rdi	# 2572	[c=4 l=3]  *movdi_internal/3
+	call	do_events	# 2573	[c=0 l=5]  *call
+	jmp	.L407	# 19237	[c=1 l=5]  jump
+.L1357:
+	movb	$1, 11032(%r12)	# 4064	[c=4 l=9]  *movqi_internal/8
+	movq	%r12, %rdi	# 4067	[c=4 l=3]  *movdi_internal/3
+	movzbl	11037(%r12), %esi	# 4065	[c=13 l=9]  *zero_extendqisi2/0
+	call	execute_lean@PLT	# 4068	[c=0 l=5]  *call
+	movq	%r12, %rdi	# 4069	[c=4 l=3]  *movdi_internal/3
+	call	perf_lean_resume@PLT	# 4070	[c=0 l=5]  *call
+	jmp	.L500	# 19239	[c=1 l=5]  jump
+.L1356:
+	movq	%r12, %rdi	# 4054	[c=4 l=3]  *movdi_internal/3
+	call	do_events	# 4055	[c=0 l=5]  *call
+	jmp	.L499	# 19241	[c=1 l=5]  jump
+.L1370:
+	movb	$1, 11032(%r12)	# 5893	[c=4 l=9]  *movqi_internal/8
+	movq	%r12, %rdi	# 5896	[c=4 l=3]  *movdi_internal/3
+	movzbl	11037(%r12), %esi	# 5894	[c=13 l=9]  *zero_extendqisi2/0
+	call	execute_lean@PLT	# 5897	[c=0 l=5]  *call
+	movq	%r12, %rdi	# 5898	[c=4 l=3]  *movdi_internal/3
+	call	perf_lean_resume@PLT	# 5899	[c=0 l=5]  *call
+	jmp	.L608	# 19243	[c=1 l=5]  jump
+.L1368:
+	movb	$1, 11032(%r12)	# 5618	[c=4 l=9]  *movqi_internal/8
+	movq	%r12, %rdi	# 5621	[c=4 l=3]  *movdi_internal/3
+	movzbl	11037(%r12), %esi	# 5619	[c=13 l=9]  *zero_extendqisi2/0
+	call	execute_lean@PLT	# 5622	[c=0 l=5]  *call
+	movq	%r12, %rdi	# 5623	[c=4 l=3]  *movdi_internal/3
+	call	perf_lean_resume@PLT	# 5624	[c=0 l=5]  *call
+	jmp	.L592	# 19245	[c=1 l=5]  jump
+.L1367:
+	movq	%r12, %rdi	# 5608	[c=4 l=3]  *movdi_internal/3
+	call	do_events	# 5609	[c=0 l=5]  *call
+	jmp	.L591	# 19247	[c=1 l=5]  jump
+.L1369:
+	movq	%r12, %rdi	# 5883	[c=4 l=3]  *movdi_internal/3
+	call	do_events	# 5884	[c=0 l=5]  *call
+	jmp	.L607	# 19249	[c=1 l=5]  jump
+.L1354:
+	movq	%r12, %rdi	# 3921	[c=4 l=3]  *movdi_internal/3
+	call	do_events	# 3922	[c=0 l=5]  *call
+	jmp	.L491	# 19251	[c=1 l=5]  jump
+.L1380:
+	movq	%r12, %rdi	# 9064	[c=4 l=3]  *movdi_internal/3
+	call	do_events	# 9065	[c=0 l=5]  *call
+	jmp	.L778	# 19253	[c=1 l=5]  jump
+.L1355:
+	movb	$1, 11032(%r12)	# 3931	[c=4 l=9]  *movqi_internal/8
+	movq	%r12, %rdi	# 3934	[c=4 l=3]  *movdi_internal/3
+	movzbl	11037(%r12), %esi	# 3932	[c=13 l=9]  *zero_extendqisi2/0
+	call	execute_lean@PLT	# 3935	[c=0 l=5]  *call
+	movq	%r12, %rdi	# 3936	[c=4 l=3]  *movdi_internal/3
+	call	perf_lean_resume@PLT	# 3937	[c=0 l=5]  *call
+	jmp	.L492	# 19255	[c=1 l=5]  jump
+.L1397:
+	movq	%r12, %rdi	# 10421	[c=4 l=3]  *movdi_internal/3
+	call	do_events	# 10422	[c=0 l=5]  *call
+	jmp	.L876	# 19257	[c=1 l=5]  jump
+.L1412:
+	movb	$1, 11032(%r12)	# 11092	[c=4 l=9]  *movqi_internal/8
+	movq	%r12, %rdi	# 11095	[c=4 l=3]  *movdi_internal/3
+	movzbl	11037(%r12), %esi	# 11093	[c=13 l=9]  *zero_extendqisi2/0
+	call	execute_lean@PLT	# 11096	[c=0 l=5]  *call
+	movq	%r12, %rdi	# 11097	[c=4 l=3]  *movdi_internal/3
+	call	perf_lean_resume@PLT	# 11098	[c=0 l=5]  *call
+	jmp	.L917	# 19259	[c=1 l=5]  jump
+.L1411:
+	movq	%r12, %rdi	# 11082	[c=4 l=3]  *movdi_internal/3
+	call	do_events	# 11083	[c=0 l=5]  *call
+	jmp	.L916	# 19261	[c=1 l=5]  jump
+.L1410:
+	movb	$1, 11032(%r12)	# 11007	[c=4 l=9]  *movqi_internal/8
+	movq	%r12, %rdi	# 11010	[c=4 l=3]  *movdi_internal/3
+	movzbl	11037(%r12), %esi	# 11008	[c=13 l=9]  *zero_extendqisi2/0
+	call	execute_lean@PLT	# 11011	[c=0 l=5]  *call
+	movq	%r12, %rdi	# 11012	[c=4 l=3]  *movdi_internal/3
+	call	perf_lean_resume@PLT	# 11013	[c=0 l=5]  *call
+	jmp	.L913	# 19263	[c=1 l=5]  jump
+.L1409:
+	movq	%r12, %rdi	# 10997	[c=4 l=3]  *movdi_internal/3
+	call	do_events	# 10998	[c=0 l=5]  *call
+	jmp	.L912	# 19265	[c=1 l=5]  jump
+.L1408:
+	movb	$1, 11032(%r12)	# 10922	[c=4 l=9]  *movqi_internal/8
+	movq	%r12, %rdi	# 10925	[c=4 l=3]  *movdi_internal/3
+	movzbl	11037(%r12), %esi	# 10923	[c=13 l=9]  *zero_extendqisi2/0
+	call	execute_lean@PLT	# 10926	[c=0 l=5]  *call
+	movq	%r12, %rdi	# 10927	[c=4 l=3]  *movdi_internal/3
+	call	perf_lean_resume@PLT	# 10928	[c=0 l=5]  *call
+	jmp	.L909	# 19267	[c=1 l=5]  jump
+.L1407:
+	movq	%r12, %rdi	# 10912	[c=4 l=3]  *movdi_internal/3
+	call	do_events	# 10913	[c=0 l=5]  *call
+	jmp	.L908	# 19269	[c=1 l=5]  jump
+.L1406:
+	movb	$1, 11032(%r12)	# 10837	[c=4 l=9]  *movqi_internal/8
+	movq	%r12, %rdi	# 10840	[c=4 l=3]  *movdi_internal/3
+	movzbl	11037(%r12), %esi	# 10838	[c=13 l=9]  *zero_extendqisi2/0
+	call	execute_lean@PLT	# 10841	[c=0 l=5]  *call
+	movq	%r12, %rdi	# 10842	[c=4 l=3]  *movdi_internal/3
+	call	perf_lean_resume@PLT	# 10843	[c=0 l=5]  *call
+	jmp	.L905	# 19271	[c=1 l=5]  jump
+.L1405:
+	movq	%r12, %rdi	# 10827	[c=4 l=3]  *movdi_internal/3
+	call	do_events	# 10828	[c=0 l=5]  *call
+	jmp	.L904	# 19273	[c=1 l=5]  jump
+.L1394:
+	movb	$1, 11032(%r12)	# 9799	[c=4 l=9]  *movqi_internal/8
+	movq	%r12, %rdi	# 9802	[c=4 l=3]  *movdi_internal/3
+	movzbl	11037(%r12), %esi	# 9800	[c=13 l=9]  *zero_extendqisi2/0
+	call	execute_lean@PLT	# 9803	[c=0 l=5]  *call
+	movq	%r12, %rdi	# 9804	[c=4 l=3]  *movdi_internal/3
+	call	perf_lean_resume@PLT	# 9805	[c=0 l=5]  *call
+	jmp	.L841	# 19275	[c=1 l=5]  jump
+.L1393:
+	movq	%r12, %rdi	# 9789	[c=4 l=3]  *movdi_internal/3
+	call	do_events	# 9790	[c=0 l=5]  *call
+	jmp	.L840	# 19277	[c=1 l=5]  jump
+.L1400:
+	movb	$1, 11032(%r12)	# 10538	[c=4 l=9]  *movqi_internal/8
+	movq	%r12, %rdi	# 10541	[c=4 l=3]  *movdi_internal/3
+	movzbl	11037(%r12), %esi	# 10539	[c=13 l=9]  *zero_extendqisi2/0
+	call	execute_lean@PLT	# 10542	[c=0 l=5]  *call
+	movq	%r12, %rdi	# 10543	[c=4 l=3]  *movdi_internal/3
+	call	perf_lean_resume@PLT	# 10544	[c=0 l=5]  *call
+	jmp	.L885	# 19279	[c=1 l=5]  jump
+.L1399:
+	movq	%r12, %rdi	# 10528	[c=4 l=3]  *movdi_internal/3
+	call	do_events	# 10529	[c=0 l=5]  *call
+	jmp	.L884	# 19281	[c=1 l=5]  jump
+.L1401:
+	movq	%r12, %rdi	# 10635	[c=4 l=3]  *movdi_internal/3
+	call	do_events	# 10636	[c=0 l=5]  *call
+	jmp	.L892	# 19283	[c=1 l=5]  jump
+.L1398:
+	movb	$1, 11032(%r12)	# 10431	[c=4 l=9]  *movqi_internal/8
+	movq	%r12, %rdi	# 10434	[c=4 l=3]  *movdi_internal/3
+	movzbl	11037(%r12), %esi	# 10432	[c=13 l=9]  *zero_extendqisi2/0
+	call	execute_lean@PLT	# 10435	[c=0 l=5]  *call
+	movq	%r12, %rdi	# 10436	[c=4 l=3]  *movdi_internal/3
+	call	perf_lean_resume@PLT	# 10437	[c=0 l=5]  *call
+	jmp	.L877	# 19285	[c=1 l=5]  jump
+.L1402:
+	movb	$1, 11032(%r12)	# 10645	[c=4 l=9]  *movqi_internal/8
+	movq	%r12, %rdi	# 10648	[c=4 l=3]  *movdi_internal/3
+	movzbl	11037(%r12), %esi	# 10646	[c=13 l=9]  *zero_extendqisi2/0
+	call	execute_lean@PLT	# 10649	[c=0 l=5]  *call
+	movq	%r12, %rdi	# 10650	[c=4 l=3]  *movdi_internal/3
+	call	perf_lean_resume@PLT	# 10651	[c=0 l=5]  *call
+	jmp	.L893	# 19287	[c=1 l=5]  jump
+.L1404:
+	movb	$1, 11032(%r12)	# 10752	[c=4 l=9]  *movqi_internal/8
+	movq	%r12, %rdi	# 10755	[c=4 l=3]  *movdi_internal/3
+	movzbl	11037(%r12), %esi	# 10753	[c=13 l=9]  *zero_extendqisi2/0
+	call	execute_lean@PLT	# 10756	[c=0 l=5]  *call
+	movq	%r12, %rdi	# 10757	[c=4 l=3]  *movdi_internal/3
+	call	perf_lean_resume@PLT	# 10758	[c=0 l=5]  *call
+	jmp	.L901	# 19289	[c=1 l=5]  jump
+.L1403:
+	movq	%r12, %rdi	# 10742	[c=4 l=3]  *movdi_internal/3
+	call	do_events	# 10743	[c=0 l=5]  *call
+	jmp	.L900	# 19291	[c=1 l=5]  jump
+.L1335:
+	movb	$1, 11032(%r12)	# 1855	[c=4 l=9]  *movqi_internal/8
+	movq	%r12, %rdi	# 1858	[c=4 l=3]  *movdi_internal/3
+	movzbl	11037(%r12), %esi	# 1856	[c=13 l=9]  *zero_extendqisi2/0
+	call	execute_lean@PLT	# 1859	[c=0 l=5]  *call
+	movq	%r12, %rdi	# 1860	[c=4 l=3]  *movdi_internal/3
+	call	perf_lean_resume@PLT	# 1861	[c=0 l=5]  *call
+	jmp	.L353	# 19293	[c=1 l=5]  jump
+.L1334:
+	movq	%r12, %rdi	# 1845	[c=4 l=3]  *movdi_internal/3
+	call	do_events	# 1846	[c=0 l=5]  *call
+	jmp	.L352	# 19295	[c=1 l=5]  jump
+.L1413:
+	movq	%r12, %rdi	# 11184	[c=4 l=3]  *movdi_internal/3
+	call	do_events	# 11185	[c=0 l=5]  *call
+	jmp	.L922	# 19297	[c=1 l=5]  jump
+.L1414:
+	movb	$1, 11032(%r12)	# 11194	[c=4 l=9]  *movqi_internal/8
+	movq	%r12, %rdi	# 11197	[c=4 l=3]  *movdi_internal/3
+	movzbl	11037(%r12), %esi	# 11195	[c=13 l=9]  *zero_extendqisi2/0
+	call	execute_lean@PLT	# 11198	[c=0 l=5]  *call
+	movq	%r12, %rdi	# 11199	[c=4 l=3]  *movdi_internal/3
+	call	perf_lean_resume@PLT	# 11200	[c=0 l=5]  *call
+	jmp	.L923	# 19299	[c=1 l=5]  jump
+.L1361:
+	movb	$1, 11032(%r12)	# 4796	[c=4 l=9]  *movqi_internal/8
+	movq	%r12, %rdi	# 4799	[c=4 l=3]  *movdi_internal/3
+	movzbl	11037(%r12), %esi	# 4797	[c=13 l=9]  *zero_extendqisi2/0
+	call	execute_lean@PLT	# 4800	[c=0 l=5]  *call
+	movq	%r12, %rdi	# 4801	[c=4 l=3]  *movdi_internal/3
+	call	perf_lean_resume@PLT	# 4802	[c=0 l=5]  *call
+	jmp	.L540	# 19301	[c=1 l=5]  jump
+.L1417:
+	movb	$1, 11032(%r12)	# 11431	[c=4 l=9]  *movqi_internal/8
+	movq	%r12, %rdi	# 11434	[c=4 l=3]  *movdi_internal/3
+	movzbl	11037(%r12), %esi	# 11432	[c=13 l=9]  *zero_extendqisi2/0
+	call	execute_lean@PLT	# 11435	[c=0 l=5]  *call
+	movq	%r12, %rdi	# 11436	[c=4 l=3]  *movdi_internal/3
+	call	perf_lean_resume@PLT	# 11437	[c=0 l=5]  *call
+	jmp	.L938	# 19303	[c=1 l=5]  jump
+.L1416:
+	movq	%r12, %rdi	# 11421	[c=4 l=3]  *movdi_internal/3
+	call	do_events	# 11422	[c=0 l=5]  *call
+	jmp	.L937	# 19305	[c=1 l=5]  jump
+.L1386:
+	movb	$1, 11032(%r12)	# 9368	[c=4 l=9]  *movqi_internal/8
+	movq	%r12, %rdi	# 9371	[c=4 l=3]  *movdi_internal/3
+	movzbl	11037(%r12), %esi	# 9369	[c=13 l=9]  *zero_extendqisi2/0
+	call	execute_lean@PLT	# 9372	[c=0 l=5]  *call
+	movq	%r12, %rdi	# 9373	[c=4 l=3]  *movdi_internal/3
+	call	perf_lean_resume@PLT	# 9374	[c=0 l=5]  *call
+	jmp	.L805	# 19307	[c=1 l=5]  jump
+.L1385:
+	movq	%r12, %rdi	# 9358	[c=4 l=3]  *movdi_internal/3
+	call	do_events	# 9359	[c=0 l=5]  *call
+	jmp	.L804	# 19309	[c=1 l=5]  jump
+.L1366:
+	movb	$1, 11032(%r12)	# 5540	[c=4 l=9]  *movqi_internal/8
+	movq	%r12, %rdi	# 5543	[c=4 l=3]  *movdi_internal/3
+	movzbl	11037(%r12), %esi	# 5541	[c=13 l=9]  *zero_extendqisi2/0
+	call	execute_lean@PLT	# 5544	[c=0 l=5]  *call
+	movq	%r12, %rdi	# 5545	[c=4 l=3]  *movdi_internal/3
+	call	perf_lean_resume@PLT	# 5546	[c=0 l=5]  *call
+	jmp	.L588	# 19311	[c=1 l=5]  jump
+.L1365:
+	movq	%r12, %rdi	# 5530	[c=4 l=3]  *movdi_internal/3
+	call	do_events	# 5531	[c=0 l=5]  *call
+	jmp	.L587	# 19313	[c=1 l=5]  jump
+.L1350:
+	movb	$1, 11032(%r12)	# 3406	[c=4 l=9]  *movqi_internal/8
+	movq	%r12, %rdi	# 3409	[c=4 l=3]  *movdi_internal/3
+	movzbl	11037(%r12), %esi	# 3407	[c=13 l=9]  *zero_extendqisi2/0
+	call	execute_lean@PLT	# 3410	[c=0 l=5]  *call
+	movq	%r12, %rdi	# 3411	[c=4 l=3]  *movdi_internal/3
+	call	perf_lean_resume@PLT	# 3412	[c=0 l=5]  *call
+	jmp	.L453	# 19315	[c=1 l=5]  jump
+.L1349:
+	movq	%r12, %rdi	# 3396	[c=4 l=3]  *movdi_internal/3
+	call	do_events	# 3397	[c=0 l=5]  *call
+	jmp	.L452	# 19317	[c=1 l=5]  jump
+.L1348:
+	movb	$1, 11032(%r12)	# 3311	[c=4 l=9]  *movqi_internal/8
+	movq	%r12, %rdi	# 3314	[c=4 l=3]  *movdi_internal/3
+	movzbl	11037(%r12), %esi	# 3312	[c=13 l=9]  *zero_extendqisi2/0
+	call	execute_lean@PLT	# 3315	[c=0 l=5]  *call
+	movq	%r12, %rdi	# 3316	[c=4 l=3]  *movdi_internal/3
+	call	perf_lean_resume@PLT	# 3317	[c=0 l=5]  *call
+	jmp	.L449	# 19319	[c=1 l=5]  jump
+.L1347:
+	movq	%r12, %rdi	# 3301	[c=4 l=3]  *movdi_internal/3
+	call	do_events	# 3302	[c=0 l=5]  *call
+	jmp	.L448	# 19321	[c=1 l=5]  jump
+.L1337:
+	movb	$1, 11032(%r12)	# 1959	[c=4 l=9]  *movqi_internal/8
+	movq	%r12, %rdi	# 1962	[c=4 l=3]  *movdi_internal/3
+	movzbl	11037(%r12), %esi	# 1960	[c=13 l=9]  *zero_extendqisi2/0
+	call	execute_lean@PLT	# 1963	[c=0 l=5]  *call
+	movq	%r12, %rdi	# 1964	[c=4 l=3]  *movdi_internal/3
+	call	perf_lean_resume@PLT	# 1965	[c=0 l=5]  *call
+	jmp	.L360	# 19323	[c=1 l=5]  jump
+.L1391:
+	movb	$1, 11032(%r12)	# 9722	[c=4 l=9]  *movqi_internal/8
+	movq	%r12, %rdi	# 9725	[c=4 l=3]  *movdi_internal/3
+	movzbl	11037(%r12), %esi	# 9723	[c=13 l=9]  *zero_extendqisi2/0
+	call	execute_lean@PLT	# 9726	[c=0 l=5]  *call
+	movq	%r12, %rdi	# 9727	[c=4 l=3]  *movdi_internal/3
+	call	perf_lean_resume@PLT	# 9728	[c=0 l=5]  *call
+	jmp	.L837	# 19325	[c=1 l=5]  jump
+.L1390:
+	movq	%r12, %rdi	# 9712	[c=4 l=3]  *movdi_internal/3
+	call	do_events	# 9713	[c=0 l=5]  *call
+	jmp	.L836	# 19327	[c=1 l=5]  jump
+.L1360:
+	movq	%r12, %rdi	# 4786	[c=4 l=3]  *movdi_internal/3
+	call	do_events	# 4787	[c=0 l=5]  *call
+	jmp	.L539	# 19329	[c=1 l=5]  jump
+.L1359:
+	sarl	$16, %r13d	# 4743	[c=4 l=4]  *ashrsi3_1/0
+	movl	$91, %edx	# 4746	[c=4 l=5]  *movsi_internal/0
+	leaq	.LC31(%rip), %rsi	# 4747	[c=1 l=7]  *movdi_internal/4
+	movq	%r12, %rdi	# 4749	[c=4 l=3]  *movdi_internal/3
+	movzbl	%r13b, %ecx	# 4744	[c=4 l=4]  *zero_extendqisi2/0
+	call	log_add_data_mov@PLT	# 4750	[c=0 l=5]  *call
+	movl	$91, %eax	# 4751	[c=4 l=5]  *movsi_internal/0
+	subl	5176(%r12), %eax	# 4752	[c=13 l=8]  *subsi_1/1
+	cmpl	5180(%r12), %eax	# 4753	[c=13 l=8]  *cmpsi_1/1
+	jb	.L537	# 4754	[c=13 l=2]  *jcc
+	cmpb	$0, 1082(%r12)	# 4756	[c=13 l=9]  *cmpqi_ccno_1/1
+	jne	.L538	# 4757	[c=13 l=6]  *jcc
+.L537:
+	movq	1040(%r12), %rax	# 4760	[c=9 l=8]  *movdi_internal/3
+	movb	%r13b, 91(%rax)	# 4761	[c=4 l=4]  *movqi_internal/8
+	jmp	.L536	# 19331	[c=1 l=5]  jump
+.L1333:
+	movl	%ebp, %ecx	# 196	[c=4 l=2]  *movsi_internal/0
+	leaq	.LC35(%rip), %rdx	# 197	[c=1 l=7]  *movdi_internal/4
+	movl	$1, %esi	# 199	[c=4 l=5]  *movsi_internal/0
+	xorl	%eax, %eax	# 18800	[c=4 l=2]  *movdi_xor
+	movq	%r12, %rdi	# 200	[c=4 l=3]  *movdi_internal/3
+	call	leave	# 202	[c=0 l=5]  *call
+.L266:
+	movl	$1, 72(%r12)	# 218	[c=4 l=9]  *movsi_internal/1
+	xorl	%esi, %esi	# 18799	[c=4 l=2]  *movdi_xor
+	movq	%r12, %rdi	# 220	[c=4 l=3]  *movdi_internal/3
+	call	log_dump_line@PLT	# 221	[c=0 l=5]  *call
+	movl	%ebp, %ecx	# 222	[c=4 l=2]  *movsi_internal/0
+	jmp	.L1221	# 19333	[c=1 l=5]  jump
+.L265:
+	movq	832(%r12), %r8	# 207	[c=9 l=8]  *movdi_internal/3
+	movl	%ebp, %ecx	# 208	[c=4 l=2]  *movsi_internal/0
+	jmp	.L1219	# 19335	[c=1 l=5]  jump
+.L1419:
+	movb	$1, 11032(%r12)	# 661	[c=4 l=9]  *movqi_internal/8
+	movq	%r12, %rdi	# 664	[c=4 l=3]  *movdi_internal/3
+	movzbl	11037(%r12), %esi	# 662	[c=13 l=9]  *zero_extendqisi2/0
+	call	execute_lean@PLT	# 665	[c=0 l=5]  *call
+	movq	%r12, %rdi	# 666	[c=4 l=3]  *movdi_internal/3
+	call	perf_lean_resume@PLT	# 667	[c=0 l=5]  *call
+	jmp	.L288	# 19337	[c=1 l=5]  jump
+.L1418:
+	movq	%r12, %rdi	# 651	[c=4 l=3]  *movdi_internal/3
+	call	do_events	# 652	[c=0 l=5]  *call
+	jmp	.L287	# 19339	[c=1 l=5]  jump
+.L530:
+	leal	-2(%r15), %r9d	# 17382	[c=4 l=4]  *leasi
+	movq	16(%rsp), %rdi	# 16173	[c=9 l=5]  *movdi_internal/3
+	leaq	.LC43(%rip), %r15	# 4637	[c=1 l=7]  *movdi_internal/4
+	xorl	%edx, %edx	# 18657	[c=4 l=2]  *movdi_xor
+	andl	%r13d, %r9d	# 4630	[c=4 l=3]  *andsi_1/0
+	movq	%r15, %rsi	# 4638	[c=4 l=3]  *movdi_internal/3
+	movl	%r9d, %eax	# 4631	[c=1 l=3]  *zero_extendsidi2/3
+	movl	%r9d, 8(%rsp)	# 17117	[c=4 l=5]  *movsi_internal/1
+	leaq	(%rdi,%rax), %r14	# 17383	[c=4 l=4]  *leadi
+	movq	1040(%r12), %rax	# 4633	[c=9 l=8]  *movdi_internal/3
+	movq	%r12, %rdi	# 4639	[c=4 l=3]  *movdi_internal/3
+	movzbl	(%rax), %ecx	# 4634	[c=9 l=3]  *zero_extendqisi2/0
+	xorl	%eax, %eax	# 18658	[c=4 l=2]  *movdi_xor
+	call	log_append@PLT	# 4641	[c=0 l=5]  *call
+	movq	1040(%r12), %rax	# 4642	[c=9 l=8]  *movdi_internal/3
+	movl	8(%rsp), %r9d	# 17118	[c=9 l=5]  *movsi_internal/0
+	movq	%r15, %rsi	# 4653	[c=4 l=3]  *movdi_internal/3
+	movq	16(%rsp), %rdi	# 16174	[c=9 l=5]  *movdi_internal/3
+	movl	$1, %edx	# 4651	[c=4 l=5]  *movsi_internal/0
+	movzbl	(%rax), %eax	# 4643	[c=5 l=3]  *movqi_internal/4
+	movb	%al, (%r14)	# 4644	[c=4 l=3]  *movqi_internal/8
+	leal	1(%r9), %eax	# 4646	[c=5 l=4]  *leadi
+	leaq	(%rdi,%rax), %r14	# 17384	[c=4 l=4]  *leadi
+	movq	1040(%r12), %rax	# 4648	[c=9 l=8]  *movdi_internal/3
+	movq	%r12, %rdi	# 4654	[c=4 l=3]  *movdi_internal/3
+	movzbl	1(%rax), %ecx	# 4649	[c=13 l=4]  *zero_extendqisi2/0
+	xorl	%eax, %eax	# 18659	[c=4 l=2]  *movdi_xor
+	call	log_append@PLT	# 4656	[c=0 l=5]  *call
+	movq	1040(%r12), %rax	# 4657	[c=9 l=8]  *movdi_internal/3
+	movzbl	1(%rax), %eax	# 4658	[c=9 l=4]  *movqi_internal/4
+	movb	%al, (%r14)	# 4659	[c=4 l=3]  *movqi_internal/8
+	jmp	.L532	# 19341	[c=1 l=5]  jump
+.L1358:
+	movl	%r15d, %eax	# 14067	[c=1 l=3]  *zero_extendsidi2/3
+	movq	%rax, 24(%rsp)	# 16172	[c=4 l=5]  *movdi_internal/5
+	jmp	.L528	# 19343	[c=1 l=5]  jump
+.L1415:
+	movl	%r15d, %r14d	# 14073	[c=1 l=3]  *zero_extendsidi2/3
+	jmp	.L929	# 19345	[c=1 l=5]  jump
+.L931:
+	leal	-2(%r15), %edx	# 17292	[c=4 l=4]  *leasi
+	movq	16(%rsp), %rdi	# 16817	[c=9 l=5]  *movdi_internal/3
+	leaq	.LC43(%rip), %r15	# 11320	[c=1 l=7]  *movdi_internal/4
+	andl	%edx, %r14d	# 11313	[c=4 l=3]  *andsi_1/0
+	movq	%r15, %rsi	# 11321	[c=4 l=3]  *movdi_internal/3
+	xorl	%edx, %edx	# 18464	[c=4 l=2]  *movdi_xor
+	movl	%r14d, %eax	# 11314	[c=1 l=3]  *zero_extendsidi2/3
+	leaq	(%rdi,%rax), %r13	# 17293	[c=4 l=4]  *leadi
+	movq	1040(%r12), %rax	# 11316	[c=9 l=8]  *movdi_internal/3
+	movq	%r12, %rdi	# 11322	[c=4 l=3]  *movdi_internal/3
+	movzbl	(%rax), %ecx	# 11317	[c=9 l=3]  *zero_extendqisi2/0
+	xorl	%eax, %eax	# 18465	[c=4 l=2]  *movdi_xor
+	call	log_append@PLT	# 11324	[c=0 l=5]  *call
+	movq	1040(%r12), %rax	# 11325	[c=9 l=8]  *movdi_internal/3
+	movq	16(%rsp), %rdi	# 16818	[c=9 l=5]  *movdi_internal/3
+	movq	%r15, %rsi	# 11336	[c=4 l=3]  *movdi_internal/3
+	movl	$1, %edx	# 11334	[c=4 l=5]  *movsi_internal/0
+	movzbl	(%rax), %eax	# 11326	[c=5 l=3]  *movqi_internal/4
+	movb	%al, 0(%r13)	# 11327	[c=4 l=4]  *movqi_internal/8
+	movq	1040(%r12), %rax	# 11331	[c=9 l=8]  *movdi_internal/3
+	leal	1(%r14), %r13d	# 11329	[c=5 l=4]  *leadi
+	addq	%rdi, %r13	# 11330	[c=4 l=3]  *adddi_1/0
+	movq	%r12, %rdi	# 11337	[c=4 l=3]  *movdi_internal/3
+	movzbl	1(%rax), %ecx	# 11332	[c=13 l=4]  *zero_extendqisi2/0
+	xorl	%eax, %eax	# 18466	[c=4 l=2]  *movdi_xor
+	call	log_append@PLT	# 11339	[c=0 l=5]  *call
+	movq	1040(%r12), %rax	# 11340	[c=9 l=8]  *movdi_internal/3
+	movzbl	1(%rax), %eax	# 11341	[c=9 l=4]  *movqi_internal/4
+	movb	%al, 0(%r13)	# 11342	[c=4 l=4]  *movqi_internal/8
+	jmp	.L933	# 19347	[c=1 l=5]  jump
+.L1382:
+	movl	$93, %esi	# 9119	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 9120	[c=4 l=3]  *movdi_internal/3
+	call	data_read_mapped	# 9121	[c=10 l=5]  *call_value
+	movl	%eax, %r15d	# 9122	[c=4 l=3]  *movsi_internal/0
+	movl	$94, %eax	# 9123	[c=4 l=5]  *movsi_internal/0
+	subl	%r14d, %eax	# 9124	[c=4 l=3]  *subsi_1/0
+	cmpl	%r13d, %eax	# 9125	[c=4 l=3]  *cmpsi_1/0
+	jnb	.L784	# 9126	[c=13 l=6]  *jcc
+	movq	1040(%r12), %rax	# 14071	[c=9 l=8]  *movdi_internal/3
+	jmp	.L783	# 19349	[c=1 l=5]  jump
+.L1387:
+	movl	$93, %esi	# 9413	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 9414	[c=4 l=3]  *movdi_internal/3
+	call	data_read_mapped	# 9415	[c=10 l=5]  *call_value
+	movl	%eax, %r15d	# 9416	[c=4 l=3]  *movsi_internal/0
+	movl	$94, %eax	# 9417	[c=4 l=5]  *movsi_internal/0
+	subl	%r14d, %eax	# 9418	[c=4 l=3]  *subsi_1/0
+	cmpl	%r13d, %eax	# 9419	[c=4 l=3]  *cmpsi_1/0
+	jnb	.L810	# 9420	[c=13 l=6]  *jcc
+	movq	1040(%r12), %rax	# 14072	[c=9 l=8]  *movdi_internal/3
+	jmp	.L809	# 19351	[c=1 l=5]  jump
+.L1340:
+	movl	$93, %esi	# 2311	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 2312	[c=4 l=3]  *movdi_internal/3
+	call	data_read_mapped	# 2313	[c=10 l=5]  *call_value
+	movl	%eax, %r14d	# 2314	[c=4 l=3]  *movsi_internal/0
+	movl	$94, %eax	# 2315	[c=4 l=5]  *movsi_internal/0
+	subl	%r15d, %eax	# 2316	[c=4 l=3]  *subsi_1/0
+	cmpl	%r13d, %eax	# 2317	[c=4 l=3]  *cmpsi_1/0
+	jnb	.L386	# 2318	[c=13 l=6]  *jcc
+	movq	1040(%r12), %rax	# 14065	[c=9 l=8]  *movdi_internal/3
+	jmp	.L385	# 19353	[c=1 l=5]  jump
+.L1362:
+	movl	$93, %esi	# 5260	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 5261	[c=4 l=3]  *movdi_internal/3
+	call	data_read_mapped	# 5262	[c=10 l=5]  *call_value
+	movl	%eax, %edx	# 5263	[c=4 l=2]  *movsi_internal/0
+	movl	$94, %eax	# 5264	[c=4 l=5]  *movsi_internal/0
+	subl	%r14d, %eax	# 5265	[c=4 l=3]  *subsi_1/0
+	cmpl	%r13d, %eax	# 5266	[c=4 l=3]  *cmpsi_1/0
+	jnb	.L566	# 5267	[c=13 l=6]  *jcc
+	movq	1040(%r12), %rax	# 14068	[c=9 l=8]  *movdi_internal/3
+	jmp	.L565	# 19355	[c=1 l=5]  jump
+.L1377:
+	movl	$93, %esi	# 8808	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 8809	[c=4 l=3]  *movdi_internal/3
+	call	data_read_mapped	# 8810	[c=10 l=5]  *call_value
+	movl	%eax, %r15d	# 8811	[c=4 l=3]  *movsi_internal/0
+	movl	$94, %eax	# 8812	[c=4 l=5]  *movsi_internal/0
+	subl	%r14d, %eax	# 8813	[c=4 l=3]  *subsi_1/0
+	cmpl	%r13d, %eax	# 8814	[c=4 l=3]  *cmpsi_1/0
+	jnb	.L758	# 8815	[c=13 l=6]  *jcc
+	movq	1040(%r12), %rax	# 14070	[c=9 l=8]  *movdi_internal/3
+	jmp	.L757	# 19357	[c=1 l=5]  jump
+.L1351:
+	movl	$93, %esi	# 3630	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 3631	[c=4 l=3]  *movdi_internal/3
+	call	data_read_mapped	# 3632	[c=10 l=5]  *call_value
+	movl	%eax, %edx	# 3633	[c=4 l=2]  *movsi_internal/0
+	cmpl	%r14d, %r13d	# 3634	[c=4 l=3]  *cmpsi_1/0
+	jnb	.L467	# 3635	[c=13 l=6]  *jcc
+	movq	1040(%r12), %rax	# 14066	[c=9 l=8]  *movdi_internal/3
+	jmp	.L466	# 19359	[c=1 l=5]  jump
+.L1374:
+	movl	$93, %esi	# 8619	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 8620	[c=4 l=3]  *movdi_internal/3
+	movl	%ecx, 24(%rsp)	# 17166	[c=4 l=4]  *movsi_internal/1
+	movl	%r9d, 16(%rsp)	# 17164	[c=4 l=5]  *movsi_internal/1
+	call	data_read_mapped	# 8621	[c=10 l=5]  *call_value
+	movl	16(%rsp), %r9d	# 17165	[c=9 l=5]  *movsi_internal/0
+	movl	24(%rsp), %ecx	# 17167	[c=9 l=4]  *movsi_internal/0
+	movl	%eax, %r15d	# 8622	[c=4 l=3]  *movsi_internal/0
+	movl	$94, %eax	# 8623	[c=4 l=5]  *movsi_internal/0
+	subl	%r9d, %eax	# 8624	[c=4 l=3]  *subsi_1/0
+	cmpl	%ecx, %eax	# 8625	[c=4 l=2]  *cmpsi_1/0
+	jnb	.L743	# 8626	[c=13 l=6]  *jcc
+	jmp	.L742	# 19362	[c=1 l=5]  jump
+.L1371:
+	movl	$93, %esi	# 8413	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 8414	[c=4 l=3]  *movdi_internal/3
+	movl	%ecx, 8(%rsp)	# 17162	[c=4 l=4]  *movsi_internal/1
+	call	data_read_mapped	# 8415	[c=10 l=5]  *call_value
+	movl	8(%rsp), %ecx	# 17163	[c=9 l=4]  *movsi_internal/0
+	movl	%eax, %r14d	# 8416	[c=4 l=3]  *movsi_internal/0
+	movl	$94, %eax	# 8417	[c=4 l=5]  *movsi_internal/0
+	subl	%ecx, %eax	# 8418	[c=4 l=2]  *subsi_1/0
+	cmpl	%r15d, %eax	# 8419	[c=4 l=3]  *cmpsi_1/0
+	jnb	.L729	# 8420	[c=13 l=6]  *jcc
+	movq	1040(%r12), %rax	# 14069	[c=9 l=8]  *movdi_internal/3
+	jmp	.L728	# 19364	[c=1 l=5]  jump
+.L927:
+	movl	$91, %esi	# 11256	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 11257	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 11258	[c=10 l=5]  *call_value
+	movl	%eax, %r13d	# 11259	[c=4 l=3]  *movsi_internal/0
+	jmp	.L928	# 19366	[c=1 l=5]  jump
+.L788:
+	movl	%r15d, %esi	# 9187	[c=4 l=3]  *movsi_internal/0
+	movq	%r12, %rdi	# 9188	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 9189	[c=10 l=5]  *call_value
+	movl	%eax, %r14d	# 9190	[c=4 l=3]  *movsi_internal/0
+	jmp	.L789	# 19368	[c=1 l=5]  jump
+.L400:
+	movl	%r9d, %edx	# 2482	[c=4 l=3]  *movsi_internal/0
+	movl	%r13d, %esi	# 2483	[c=4 l=3]  *movsi_internal/0
+	movq	%r12, %rdi	# 2484	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 2485	[c=0 l=5]  *call
+	jmp	.L401	# 19370	[c=1 l=5]  jump
+.L526:
+	movl	$91, %esi	# 4573	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 4574	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 4575	[c=10 l=5]  *call_value
+	movl	%eax, %r14d	# 4576	[c=4 l=3]  *movsi_internal/0
+	jmp	.L527	# 19372	[c=1 l=5]  jump
+.L814:
+	movl	%r15d, %esi	# 9481	[c=4 l=3]  *movsi_internal/0
+	movq	%r12, %rdi	# 9482	[c=4 l=3]  *movdi_internal/3
+	call	data_read_page	# 9483	[c=10 l=5]  *call_value
+	movl	%eax, %r14d	# 9484	[c=4 l=3]  *movsi_internal/0
+	jmp	.L815	# 19374	[c=1 l=5]  jump
+.L481:
+	movl	%r14d, %edx	# 3797	[c=4 l=3]  *movsi_internal/0
+	movl	%r13d, %esi	# 3798	[c=4 l=3]  *movsi_internal/0
+	movq	%r12, %rdi	# 3799	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 3800	[c=0 l=5]  *call
+	jmp	.L482	# 19376	[c=1 l=5]  jump
+.L580:
+	movl	%r14d, %edx	# 5431	[c=4 l=3]  *movsi_internal/0
+	movl	%r13d, %esi	# 5432	[c=4 l=3]  *movsi_internal/0
+	movq	%r12, %rdi	# 5433	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 5434	[c=0 l=5]  *call
+	jmp	.L581	# 19378	[c=1 l=5]  jump
+.L772:
+	movl	%r9d, %edx	# 8979	[c=4 l=3]  *movsi_internal/0
+	movl	%r13d, %esi	# 8980	[c=4 l=3]  *movsi_internal/0
+	movq	%r12, %rdi	# 8981	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 8982	[c=0 l=5]  *call
+	jmp	.L773	# 19380	[c=1 l=5]  jump
+.L283:
+	leaq	.LC49(%rip), %rsi	# 436	[c=1 l=7]  *movdi_internal/4
+	movq	%r12, %rdi	# 438	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 18776	[c=4 l=2]  *movdi_xor
+	call	log_append@PLT	# 440	[c=0 l=5]  *call
+	movq	1040(%r12), %rax	# 441	[c=9 l=8]  *movdi_internal/3
+	movl	$24, %edx	# 444	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 447	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC44(%rip), %rsi	# 445	[c=1 l=7]  *movdi_internal/4
+	movzwl	24(%rax), %r13d	# 442	[c=13 l=5]  *zero_extendhisi2/0
+	xorl	%eax, %eax	# 18777	[c=4 l=2]  *movdi_xor
+	movl	%r13d, %ecx	# 443	[c=4 l=3]  *movsi_internal/0
+	call	log_append@PLT	# 449	[c=0 l=5]  *call
+	movl	%r13d, %esi	# 450	[c=4 l=3]  *movsi_internal/0
+	movq	%r12, %rdi	# 451	[c=4 l=3]  *movdi_internal/3
+	call	put_argv@PLT	# 452	[c=0 l=5]  *call
+	movl	$1, %ecx	# 454	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 458	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 18778	[c=4 l=2]  *movdi_xor
+	movl	%r13d, 824(%r12)	# 453	[c=4 l=8]  *movsi_internal/1
+	leaq	.LC48(%rip), %r13	# 456	[c=1 l=7]  *movdi_internal/4
+	movl	$20, %edx	# 455	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rsi	# 457	[c=4 l=3]  *movdi_internal/3
+	call	log_append@PLT	# 460	[c=0 l=5]  *call
+	movl	$22, %edx	# 468	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rsi	# 470	[c=4 l=3]  *movdi_internal/3
+	movq	%r12, %rdi	# 471	[c=4 l=3]  *movdi_internal/3
+	movq	1040(%r12), %rax	# 461	[c=9 l=8]  *movdi_internal/3
+	movb	$1, 20(%rax)	# 462	[c=4 l=4]  *movqi_internal/8
+	movq	1040(%r12), %rax	# 463	[c=9 l=8]  *movdi_internal/3
+	movb	$0, 21(%rax)	# 464	[c=4 l=4]  *movqi_internal/8
+	movl	820(%r12), %r14d	# 465	[c=9 l=8]  *movsi_internal/0
+	xorl	%eax, %eax	# 18779	[c=4 l=2]  *movdi_xor
+	movzwl	%r14w, %ecx	# 466	[c=4 l=4]  *zero_extendhisi2/0
+	call	log_append@PLT	# 473	[c=0 l=5]  *call
+	movl	%r14d, %ecx	# 15839	[c=4 l=3]  *movsi_internal/0
+	movl	$24, %edx	# 482	[c=4 l=5]  *movsi_internal/0
+	movq	%r13, %rsi	# 484	[c=4 l=3]  *movdi_internal/3
+	movq	1040(%r12), %rax	# 474	[c=9 l=8]  *movdi_internal/3
+	movq	%r12, %rdi	# 485	[c=4 l=3]  *movdi_internal/3
+	movb	%r14b, 22(%rax)	# 475	[c=4 l=4]  *movqi_internal/8
+	movq	1040(%r12), %rax	# 476	[c=9 l=8]  *movdi_internal/3
+	movb	%ch, 23(%rax)	# 18780	[c=4 l=3]  *extzvqi_mem_rex64
+	movl	816(%r12), %r14d	# 479	[c=9 l=8]  *movsi_internal/0
+	xorl	%eax, %eax	# 18781	[c=4 l=2]  *movdi_xor
+	movzwl	%r14w, %ecx	# 480	[c=4 l=4]  *zero_extendhisi2/0
+	call	log_append@PLT	# 487	[c=0 l=5]  *call
+	movq	1040(%r12), %rax	# 488	[c=9 l=8]  *movdi_internal/3
+	movl	%r14d, %ecx	# 15841	[c=4 l=3]  *movsi_internal/0
+	movb	%r14b, 24(%rax)	# 489	[c=4 l=4]  *movqi_internal/8
+	movq	1040(%r12), %rax	# 490	[c=9 l=8]  *movdi_internal/3
+	movb	%ch, 25(%rax)	# 18782	[c=4 l=3]  *extzvqi_mem_rex64
+	jmp	.L279	# 19382	[c=1 l=5]  jump
+.L285:
+	leaq	.LC53(%rip), %rsi	# 569	[c=1 l=7]  *movdi_internal/4
+	movq	%r12, %rdi	# 571	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 18768	[c=4 l=2]  *movdi_xor
+	call	log_append@PLT	# 573	[c=0 l=5]  *call
+	jmp	.L279	# 19384	[c=1 l=5]  jump
+.L284:
+	leaq	.LC51(%rip), %rsi	# 533	[c=1 l=7]  *movdi_internal/4
+	movq	%r12, %rdi	# 535	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 18771	[c=4 l=2]  *movdi_xor
+	call	log_append@PLT	# 537	[c=0 l=5]  *call
+	jmp	.L279	# 19386	[c=1 l=5]  jump
+.L538:
+	movl	%r13d, %edx	# 4766	[c=4 l=3]  *movsi_internal/0
+	movl	$91, %esi	# 4767	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 4768	[c=4 l=3]  *movdi_internal/3
+	call	data_write_page	# 4769	[c=0 l=5]  *call
+	jmp	.L536	# 19388	[c=1 l=5]  jump
+.L280:
+	movl	%r14d, %ecx	# 367	[c=4 l=3]  *movsi_internal/0
+	leaq	.LC46(%rip), %rdx	# 368	[c=1 l=7]  *movdi_internal/4
+	movq	%r12, %rdi	# 371	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 18789	[c=4 l=2]  *movdi_xor
+	movl	$1, %esi	# 370	[c=4 l=5]  *movsi_internal/0
+	call	leave	# 373	[c=0 l=5]  *call
+.L1226:
+	movl	%r15d, %esi	# 8862	[c=4 l=3]  *movsi_internal/0
+	movq	%r12, %rdi	# 8863	[c=4 l=3]  *movdi_internal/3
+	call	stack_overflow	# 8864	[c=0 l=5]  *call
+.L1341:
+	movl	%r14d, %esi	# 2365	[c=4 l=3]  *movsi_internal/0
+	movq	%r12, %rdi	# 2366	[c=4 l=3]  *movdi_internal/3
+	call	stack_overflow	# 2367	[c=0 l=5]  *call
+.L1224:
+	movl	%r13d, %esi	# 9576	[c=4 l=3]  *movsi_internal/0
+.L1225:
+	movq	%r12, %rdi	# 9577	[c=4 l=3]  *movdi_internal/3
+	call	bad_PC	# 9578	[c=0 l=5]  *call
+.L1392:
+	leaq	.LC63(%rip), %rdx	# 9759	[c=1 l=7]  *movdi_internal/4
+	xorl	%esi, %esi	# 18497	[c=4 l=2]  *movdi_xor
+	movq	%r12, %rdi	# 9762	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 18498	[c=4 l=2]  *movdi_xor
+	call	leave	# 9764	[c=0 l=5]  *call
+.L921:
+	leaq	.LC64(%rip), %rdx	# 11143	[c=1 l=7]  *movdi_internal/4
+	movl	$4, %esi	# 11145	[c=4 l=5]  *movsi_internal/0
+	movq	%r12, %rdi	# 11146	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 18470	[c=4 l=2]  *movdi_xor
+	call	leave	# 11148	[c=0 l=5]  *call
+	.cfi_endproc
+.LFE211:
+	.size	execute, .-execute
+	.section	.rodata.str1.1
+.LC66:
+	.string	"RAM"
+.LC67:
+	.string	"flash"
+.LC68:
+	.string	"EEPROM"
+.LC69:
+	.string	"decoded flash"
+.LC70:
+	.string	"atmega64"
+.LC71:
+	.string	"atmega128"
+	.section	.rodata.str1.8
+	.align 8
+.LC72:
+	.string	"entry point 0x%x is outside the flash of %s"
+	.text
+	.p2align 4
+	.type	run_context, @function
+run_context:
+.LFB216:
+	.cfi_startproc
+	pushq	%r13	# 784	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 16
+	.cfi_offset 13, -16
+	pushq	%r12	# 785	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 24
+	.cfi_offset 12, -24
+	pushq	%rbp	# 786	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 32
+	.cfi_offset 6, -32
+	pushq	%rbx	# 787	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 40
+	.cfi_offset 3, -40
+	subq	$248, %rsp	# 788	[c=4 l=7]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_def_cfa_offset 288
+	movq	%rdi, (%rsp)	# 2	[c=4 l=4]  *movdi_internal/5
+	leaq	32(%rsp), %rdi	# 22	[c=4 l=5]  *leadi
+	movl	%esi, 12(%rsp)	# 3	[c=4 l=4]  *movsi_internal/1
+	movq	%rdx, 16(%rsp)	# 4	[c=4 l=5]  *movdi_internal/5
+	call	_setjmp@PLT	# 24	[c=10 l=5]  *call_value
+	testl	%eax, %eax	# 31	[c=4 l=2]  *cmpsi_ccno_1/0
+	je	.L1475	# 32	[c=13 l=6]  *jcc
+	movq	(%rsp), %rbx	# 750	[c=5 l=4]  *movdi_internal/3
+	movq	$0, 128(%rbx)	# 464	[c=4 l=11]  *movdi_internal/5
+	movq	%rbx, %rdi	# 465	[c=4 l=3]  *movdi_internal/3
+	call	eeprom_finish@PLT	# 466	[c=0 l=5]  *call
+	movq	984(%rbx), %rdi	# 468	[c=9 l=7]  *movdi_internal/3
+	testq	%rdi, %rdi	# 469	[c=4 l=3]  *cmpdi_ccno_1/0
+	jne	.L1453	# 470	[c=13 l=2]  *jcc
+	jmp	.L1459	# 836	[c=1 l=2]  jump
+	.p2align 4,,10
+	.p2align 3
+.L1476:
+	movq	%rax, (%rdx)	# 492	[c=4 l=3]  *movdi_internal/5
+.L1456:
+	testq	%rax, %rax	# 500	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L1457	# 501	[c=13 l=2]  *jcc
+	movq	%rdx, 8(%rax)	# 503	[c=4 l=4]  *movdi_internal/5
+.L1457:
+	call	free@PLT	# 516	[c=0 l=5]  *call
+	movq	(%rsp), %rax	# 713	[c=5 l=4]  *movdi_internal/3
+	movq	984(%rax), %rdi	# 517	[c=9 l=7]  *movdi_internal/3
+	testq	%rdi, %rdi	# 518	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L1459	# 519	[c=13 l=2]  *jcc
+.L1453:
+	movq	16(%rdi), %rax	# 477	[c=9 l=4]  *movdi_internal/3
+	testq	%rax, %rax	# 478	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L1454	# 479	[c=13 l=2]  *jcc
+	movq	%rax, %rdi	# 481	[c=4 l=3]  *movdi_internal/3
+	call	fclose@PLT	# 482	[c=10 l=5]  *call_value
+	movq	(%rsp), %rax	# 710	[c=5 l=4]  *movdi_internal/3
+	movq	984(%rax), %rdi	# 484	[c=9 l=7]  *movdi_internal/3
+.L1454:
+	movq	8(%rdi), %rdx	# 487	[c=9 l=4]  *movdi_internal/3
+	movq	(%rdi), %rax	# 488	[c=5 l=3]  *movdi_internal/3
+	testq	%rdx, %rdx	# 489	[c=4 l=3]  *cmpdi_ccno_1/0
+	jne	.L1476	# 490	[c=13 l=2]  *jcc
+	movq	(%rsp), %rbx	# 711	[c=5 l=4]  *movdi_internal/3
+	movq	%rax, 984(%rbx)	# 497	[c=4 l=7]  *movdi_internal/5
+	jmp	.L1456	# 839	[c=1 l=2]  jump
+	.p2align 4,,10
+	.p2align 3
+.L1459:
+	movq	(%rsp), %rax	# 709	[c=5 l=4]  *movdi_internal/3
+	movl	136(%rax), %eax	# 472	[c=9 l=6]  *movsi_internal/0
+	addq	$248, %rsp	# 791	[c=4 l=7]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	popq	%rbx	# 792	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 32
+	popq	%rbp	# 793	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 24
+	popq	%r12	# 794	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 16
+	popq	%r13	# 795	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 8
+	ret		# 796	[c=0 l=1]  simple_return_internal
+.L1475:
+	.cfi_restore_state
+	movq	(%rsp), %rbx	# 717	[c=5 l=4]  *movdi_internal/3
+	leaq	32(%rsp), %rax	# 34	[c=4 l=5]  *leadi
+	xorl	%esi, %esi	# 833	[c=4 l=2]  *movdi_xor
+	movl	$1, %r13d	# 6	[c=4 l=6]  *movsi_internal/0
+	movq	%rax, 128(%rbx)	# 35	[c=4 l=7]  *movdi_internal/5
+	leaq	920(%rbx), %rdi	# 775	[c=4 l=7]  *leadi
+	call	gettimeofday@PLT	# 39	[c=10 l=5]  *call_value
+	movq	16(%rsp), %rdx	# 40	[c=9 l=5]  *movdi_internal/3
+	movl	12(%rsp), %esi	# 41	[c=9 l=4]  *movsi_internal/0
+	movq	%rbx, %rdi	# 42	[c=4 l=3]  *movdi_internal/3
+	call	parse_args@PLT	# 43	[c=0 l=5]  *call
+	movq	%rbx, %rdi	# 45	[c=4 l=3]  *movdi_internal/3
+	call	replay_open@PLT	# 46	[c=0 l=5]  *call
+	movl	880(%rbx), %eax	# 48	[c=9 l=6]  *movsi_internal/0
+.L1423:
+	movl	%r13d, %r12d	# 50	[c=4 l=3]  *movsi_internal/0
+	addl	%r13d, %r13d	# 51	[c=4 l=3]  *ashlsi3_1/0
+	cmpl	%eax, %r13d	# 53	[c=4 l=3]  *cmpsi_1/0
+	jb	.L1423	# 54	[c=13 l=2]  *jcc
+	leal	-1(%r12), %eax	# 773	[c=4 l=5]  *leasi
+	movl	$1, %edi	# 66	[c=4 l=5]  *movdi_internal/2
+	movd	%eax, %xmm0	# 650	[c=4 l=4]  *movsi_internal/13
+	movq	(%rsp), %rax	# 720	[c=5 l=4]  *movdi_internal/3
+	movl	872(%rax), %ecx	# 57	[c=9 l=6]  *movsi_internal/0
+	movd	%ecx, %xmm1	# 653	[c=4 l=4]  *movsi_internal/13
+	movl	%ecx, 24(%rsp)	# 652	[c=4 l=4]  *movsi_internal/1
+	movl	876(%rax), %ecx	# 60	[c=9 l=6]  *movsi_internal/0
+	punpckldq	%xmm1, %xmm0	# 58	[c=4 l=4]  *vec_concatv2si/0
+	movl	%ecx, 1000(%rax)	# 61	[c=4 l=6]  *movsi_internal/1
+	leal	1(%rcx), %esi	# 774	[c=5 l=3]  *leadi
+	movq	%xmm0, 992(%rax)	# 59	[c=4 l=9]  *movv2si_internal/14
+	movq	%rsi, %rbx	# 780	[c=4 l=3]  *movdi_internal/3
+	addq	$32, %rsi	# 64	[c=4 l=4]  *adddi_1/0
+	call	calloc@PLT	# 67	[c=10 l=5]  *call_value
+	movq	%rax, %rbp	# 68	[c=4 l=3]  *movdi_internal/3
+	testq	%rax, %rax	# 70	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L1477	# 71	[c=13 l=6]  *jcc
+	xorl	%esi, %esi	# 831	[c=4 l=2]  *movdi_xor
+	movq	%rsi, 8(%rax)	# 832	[c=4 l=4]  *movdi_internal/5
+	movq	(%rsp), %rax	# 657	[c=5 l=4]  *movdi_internal/3
+	movq	984(%rax), %rax	# 86	[c=9 l=7]  *movdi_internal/3
+	movq	%rax, 0(%rbp)	# 87	[c=4 l=4]  *movdi_internal/5
+	testq	%rax, %rax	# 88	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L1425	# 89	[c=13 l=2]  *jcc
+	movq	%rbp, 8(%rax)	# 91	[c=4 l=4]  *movdi_internal/5
+.L1425:
+	movq	(%rsp), %rcx	# 721	[c=5 l=4]  *movdi_internal/3
+	leaq	32(%rbp), %rax	# 772	[c=4 l=4]  *leadi
+	leal	2(%r13), %esi	# 869	[c=5 l=4]  *leadi
+	movl	$1, %edi	# 101	[c=4 l=5]  *movdi_internal/2
+	movq	%rsi, %r13	# 781	[c=4 l=3]  *movdi_internal/3
+	addq	$32, %rsi	# 99	[c=4 l=4]  *adddi_1/0
+	movq	%rbp, 984(%rcx)	# 94	[c=4 l=7]  *movdi_internal/5
+	movq	%rax, 1040(%rcx)	# 96	[c=4 l=7]  *movdi_internal/5
+	call	calloc@PLT	# 102	[c=10 l=5]  *call_value
+	movq	%rax, %rbx	# 103	[c=4 l=3]  *movdi_internal/3
+	testq	%rax, %rax	# 105	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L1478	# 106	[c=13 l=6]  *jcc
+	xorl	%ecx, %ecx	# 828	[c=4 l=2]  *movdi_xor
+	movq	%rbp, (%rax)	# 121	[c=4 l=3]  *movdi_internal/5
+	movl	$1, %edi	# 131	[c=4 l=5]  *movdi_internal/2
+	movq	%rcx, 8(%rax)	# 829	[c=4 l=4]  *movdi_internal/5
+	movq	(%rsp), %rcx	# 723	[c=5 l=4]  *movdi_internal/3
+	movq	%rax, 8(%rbp)	# 122	[c=4 l=4]  *movdi_internal/5
+	movq	%rax, 984(%rcx)	# 123	[c=4 l=7]  *movdi_internal/5
+	leaq	32(%rax), %rax	# 771	[c=4 l=4]  *leadi
+	movq	%rax, 1056(%rcx)	# 125	[c=4 l=7]  *movdi_internal/5
+	movl	884(%rcx), %ecx	# 126	[c=9 l=6]  *movsi_internal/0
+	movl	$1, %eax	# 645	[c=4 l=5]  *movsi_internal/0
+	testl	%ecx, %ecx	# 642	[c=4 l=2]  *cmpsi_ccno_1/0
+	cmovne	%ecx, %eax	# 643	[c=8 l=3]  *movsicc_noc/0
+	movl	%eax, %esi	# 664	[c=1 l=2]  *zero_extendsidi2/3
+	movq	%rsi, %r13	# 782	[c=4 l=3]  *movdi_internal/3
+	addq	$32, %rsi	# 129	[c=4 l=4]  *adddi_1/0
+	call	calloc@PLT	# 132	[c=10 l=5]  *call_value
+	leaq	.LC68(%rip), %r9	# 138	[c=1 l=7]  *movdi_internal/4
+	movq	%rax, %rbp	# 133	[c=4 l=3]  *movdi_internal/3
+	testq	%rax, %rax	# 135	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L1474	# 136	[c=13 l=6]  *jcc
+	movq	(%rsp), %rcx	# 724	[c=5 l=4]  *movdi_internal/3
+	xorl	%edx, %edx	# 826	[c=4 l=2]  *movdi_xor
+	movq	%rbx, (%rax)	# 151	[c=4 l=3]  *movdi_internal/5
+	movl	%r12d, %esi	# 156	[c=1 l=3]  *zero_extendsidi2/3
+	movq	%rdx, 8(%rax)	# 827	[c=4 l=4]  *movdi_internal/5
+	salq	$4, %rsi	# 157	[c=4 l=4]  *ashldi3_1/0
+	movl	$1, %edi	# 160	[c=4 l=5]  *movdi_internal/2
+	movq	%rax, 8(%rbx)	# 152	[c=4 l=4]  *movdi_internal/5
+	addq	$32, %rsi	# 158	[c=4 l=4]  *adddi_1/0
+	movq	%rax, 984(%rcx)	# 153	[c=4 l=7]  *movdi_internal/5
+	leaq	32(%rax), %rax	# 770	[c=4 l=4]  *leadi
+	movq	%rax, 1048(%rcx)	# 155	[c=4 l=7]  *movdi_internal/5
+	call	calloc@PLT	# 161	[c=10 l=5]  *call_value
+	movq	%rax, %rbx	# 162	[c=4 l=3]  *movdi_internal/3
+	testq	%rax, %rax	# 164	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L1479	# 165	[c=13 l=6]  *jcc
+	movq	(%rsp), %rcx	# 726	[c=5 l=4]  *movdi_internal/3
+	xorl	%eax, %eax	# 824	[c=4 l=2]  *movdi_xor
+	movq	%rbp, (%rbx)	# 180	[c=4 l=3]  *movdi_internal/5
+	movq	%rax, 8(%rbx)	# 825	[c=4 l=4]  *movdi_internal/5
+	leaq	32(%rbx), %rax	# 769	[c=4 l=4]  *leadi
+	cmpb	$0, 844(%rcx)	# 185	[c=13 l=7]  *cmpqi_ccno_1/1
+	movq	%rbx, 8(%rbp)	# 181	[c=4 l=4]  *movdi_internal/5
+	movq	%rbx, 984(%rcx)	# 182	[c=4 l=7]  *movdi_internal/5
+	movq	%rax, 1064(%rcx)	# 184	[c=4 l=7]  *movdi_internal/5
+	jne	.L1480	# 186	[c=13 l=6]  *jcc
+.L1429:
+	movq	(%rsp), %rbx	# 728	[c=5 l=4]  *movdi_internal/3
+	movq	%rbx, %rdi	# 215	[c=4 l=3]  *movdi_internal/3
+	call	periph_init@PLT	# 216	[c=0 l=5]  *call
+	leaq	1080(%rbx), %rdi	# 768	[c=4 l=7]  *leadi
+	xorl	%edx, %edx	# 823	[c=4 l=2]  *movdi_xor
+	movl	$31, %eax	# 8	[c=4 l=5]  *movsi_internal/0
+	movq	%rdi, %rcx	# 219	[c=4 l=3]  *movdi_internal/3
+.L1435:
+	movq	(%rsp), %rsi	# 673	[c=5 l=4]  *movdi_internal/3
+	movl	1000(%rsi), %r8d	# 221	[c=9 l=7]  *movsi_internal/0
+	xorl	%esi, %esi	# 822	[c=4 l=2]  *movdi_xor
+	cmpl	%eax, %r8d	# 222	[c=4 l=3]  *cmpsi_1/0
+	jnb	.L1431	# 223	[c=13 l=2]  *jcc
+	cmpl	%edx, %r8d	# 558	[c=4 l=3]  *cmpsi_1/0
+	sbbl	%esi, %esi	# 559	[c=8 l=2]  *x86_movsicc_0_m1
+	andl	$4, %esi	# 766	[c=4 l=3]  *andsi_1/0
+	addl	$1, %esi	# 767	[c=4 l=3]  *addsi_1/0
+.L1431:
+	movb	%sil, (%rcx)	# 231	[c=4 l=3]  *movqi_internal/8
+	movq	(%rsp), %rsi	# 729	[c=5 l=4]  *movdi_internal/3
+	cmpb	$0, 844(%rsi)	# 232	[c=13 l=7]  *cmpqi_ccno_1/1
+	je	.L1432	# 233	[c=13 l=2]  *jcc
+	cmpl	%edx, 1000(%rsi)	# 237	[c=13 l=6]  *cmpsi_1/0
+	jnb	.L1432	# 238	[c=13 l=2]  *jcc
+	cmpl	$65535, %eax	# 243	[c=4 l=5]  *cmpsi_1/0
+	ja	.L1432	# 244	[c=13 l=2]  *jcc
+	movb	$4, (%rcx)	# 246	[c=4 l=3]  *movqi_internal/8
+	addl	$32, %eax	# 247	[c=4 l=3]  *addsi_1/0
+	addl	$32, %edx	# 248	[c=4 l=3]  *addsi_1/0
+	addq	$1, %rcx	# 249	[c=4 l=4]  *adddi_1/0
+	jmp	.L1435	# 845	[c=1 l=2]  jump
+.L1432:
+	addl	$32, %eax	# 254	[c=4 l=3]  *addsi_1/0
+	addl	$32, %edx	# 255	[c=4 l=3]  *addsi_1/0
+	addq	$1, %rcx	# 256	[c=4 l=4]  *adddi_1/0
+	cmpl	$131103, %eax	# 257	[c=4 l=5]  *cmpsi_1/0
+	jne	.L1435	# 258	[c=13 l=2]  *jcc
+	movq	(%rsp), %rax	# 676	[c=5 l=4]  *movdi_internal/3
+	movb	$1, 1082(%rax)	# 266	[c=4 l=7]  *movqi_internal/8
+	xorl	%eax, %eax	# 821	[c=4 l=2]  *movdi_xor
+	jmp	.L1436	# 847	[c=1 l=2]  jump
+.L1438:
+	movq	(%rsp), %rcx	# 677	[c=5 l=4]  *movdi_internal/3
+	cmpb	$0, 6568(%rcx,%rax)	# 270	[c=14 l=8]  *cmpqi_ccno_1/1
+	je	.L1437	# 271	[c=13 l=2]  *jcc
+	shrl	$5, %edx	# 273	[c=5 l=3]  *lshrsi3_1_zext/0
+	movb	$1, (%rdi,%rdx)	# 275	[c=4 l=4]  *movqi_internal/8
+.L1437:
+	addq	$1, %rax	# 278	[c=4 l=4]  *adddi_1/0
+.L1436:
+	movq	(%rsp), %rcx	# 678	[c=5 l=4]  *movdi_internal/3
+	movl	%eax, %edx	# 281	[c=4 l=2]  *movsi_internal/0
+	cmpl	6564(%rcx), %eax	# 283	[c=13 l=6]  *cmpsi_1/1
+	jb	.L1438	# 284	[c=13 l=2]  *jcc
+	movl	1000(%rcx), %eax	# 286	[c=9 l=6]  *movsi_internal/0
+	movl	%eax, 28(%rsp)	# 680	[c=4 l=4]  *movsi_internal/1
+	addl	$1, %eax	# 287	[c=4 l=3]  *addsi_1/0
+	movl	%eax, %edx	# 682	[c=4 l=2]  *movsi_internal/0
+	shrl	$5, %edx	# 288	[c=4 l=3]  *lshrsi3_1/0
+	jmp	.L1440	# 849	[c=1 l=2]  jump
+.L1481:
+	leal	-1(%rdx), %esi	# 765	[c=5 l=3]  *leadi
+	cmpb	$0, (%rdi,%rsi)	# 296	[c=13 l=4]  *cmpqi_ccno_1/1
+	movq	%rsi, %rcx	# 783	[c=4 l=3]  *movdi_internal/3
+	jne	.L1439	# 297	[c=13 l=2]  *jcc
+	movl	%ecx, %edx	# 13	[c=4 l=2]  *movsi_internal/0
+.L1440:
+	testl	%edx, %edx	# 290	[c=4 l=2]  *cmpsi_ccno_1/0
+	jne	.L1481	# 291	[c=13 l=2]  *jcc
+.L1439:
+	movq	(%rsp), %rcx	# 731	[c=5 l=4]  *movdi_internal/3
+	sall	$5, %edx	# 300	[c=4 l=3]  *ashlsi3_1/0
+	andl	$-32, %eax	# 302	[c=4 l=3]  *andsi_1/0
+	subl	%edx, %eax	# 303	[c=4 l=2]  *subsi_1/0
+	movl	%edx, 5176(%rcx)	# 301	[c=4 l=6]  *movsi_internal/1
+	movl	880(%rcx), %edx	# 305	[c=9 l=6]  *movsi_internal/0
+	movl	%eax, 5180(%rcx)	# 304	[c=4 l=6]  *movsi_internal/1
+	movl	$64, %eax	# 14	[c=4 l=5]  *movsi_internal/0
+	cmpl	$8192, %edx	# 308	[c=4 l=6]  *cmpsi_1/0
+	jbe	.L1441	# 309	[c=13 l=2]  *jcc
+	cmpl	$32769, %edx	# 578	[c=4 l=6]  *cmpsi_1/0
+	sbbl	%eax, %eax	# 579	[c=8 l=2]  *x86_movsicc_0_m1
+	andl	$-128, %eax	# 580	[c=4 l=3]  *andsi_1/0
+	addl	$256, %eax	# 581	[c=4 l=5]  *addsi_1/0
+.L1441:
+	movq	(%rsp), %rcx	# 732	[c=5 l=4]  *movdi_internal/3
+	leaq	.LC70(%rip), %rsi	# 321	[c=1 l=7]  *movdi_internal/4
+	movq	856(%rcx), %rbx	# 319	[c=9 l=7]  *movdi_internal/3
+	movl	%eax, 6044(%rcx)	# 318	[c=4 l=6]  *movsi_internal/1
+	movq	%rbx, %rdi	# 323	[c=4 l=3]  *movdi_internal/3
+	call	strcmp@PLT	# 324	[c=10 l=5]  *call_value
+	movl	%eax, %edx	# 609	[c=4 l=2]  *movsi_internal/0
+	movl	$104, %eax	# 18	[c=4 l=5]  *movsi_internal/0
+	testl	%edx, %edx	# 326	[c=4 l=2]  *cmpsi_ccno_1/0
+	je	.L1442	# 327	[c=13 l=2]  *jcc
+	leaq	.LC71(%rip), %rsi	# 330	[c=1 l=7]  *movdi_internal/4
+	movq	%rbx, %rdi	# 332	[c=4 l=3]  *movdi_internal/3
+	call	strcmp@PLT	# 333	[c=10 l=5]  *call_value
+	cmpl	$1, %eax	# 592	[c=4 l=3]  *cmpsi_1/0
+	sbbl	%eax, %eax	# 593	[c=8 l=2]  *x86_movsicc_0_m1
+	andl	$17, %eax	# 594	[c=4 l=3]  *andsi_1/0
+	addl	$87, %eax	# 595	[c=4 l=3]  *addsi_1/0
+.L1442:
+	movq	(%rsp), %rsi	# 738	[c=5 l=4]  *movdi_internal/3
+	leaq	6060(%rsi), %rdi	# 764	[c=4 l=7]  *leadi
+	movl	%eax, 6048(%rsi)	# 340	[c=4 l=6]  *movsi_internal/1
+	movl	%esi, %eax	# 693	[c=4 l=2]  *movsi_internal/0
+	movq	$-1, 6052(%rsi)	# 346	[c=4 l=11]  *movdi_internal/5
+	andq	$-8, %rdi	# 352	[c=4 l=4]  *anddi_1/1
+	movq	$-1, 6556(%rsi)	# 350	[c=4 l=11]  *movdi_internal/5
+	subl	%edi, %eax	# 353	[c=4 l=2]  *subsi_1/0
+	leal	6564(%rax), %ecx	# 354	[c=4 l=6]  *leasi
+	orq	$-1, %rax	# 820	[c=4 l=4]  *movdi_or
+	shrl	$3, %ecx	# 356	[c=5 l=3]  *lshrsi3_1_zext/0
+	rep stosq	# 358	[c=0 l=3]  *rep_stosdi_rex64
+	movl	(%rsi), %eax	# 359	[c=5 l=2]  *movsi_internal/0
+	cmpl	%eax, 992(%rsi)	# 360	[c=13 l=6]  *cmpsi_1/0
+	jb	.L1482	# 361	[c=13 l=6]  *jcc
+	movq	(%rsp), %rbx	# 739	[c=5 l=4]  *movdi_internal/3
+	movq	%rbx, %rdi	# 375	[c=4 l=3]  *movdi_internal/3
+	call	log_open@PLT	# 376	[c=0 l=5]  *call
+	cmpl	$0, 232(%rbx)	# 378	[c=13 l=7]  *cmpsi_ccno_1/1
+	jne	.L1483	# 379	[c=13 l=6]  *jcc
+.L1444:
+	movq	(%rsp), %rbx	# 740	[c=5 l=4]  *movdi_internal/3
+	movq	%rbx, %rdi	# 387	[c=4 l=3]  *movdi_internal/3
+	call	checkpoint_open@PLT	# 388	[c=0 l=5]  *call
+	cmpl	$0, 424(%rbx)	# 390	[c=13 l=7]  *cmpsi_ccno_1/1
+	jne	.L1447	# 391	[c=13 l=2]  *jcc
+	movq	(%rsp), %rdi	# 399	[c=5 l=4]  *movdi_internal/3
+	call	load_to_flash@PLT	# 400	[c=0 l=5]  *call
+.L1447:
+	movq	(%rsp), %rbx	# 742	[c=5 l=4]  *movdi_internal/3
+	movq	%rbx, %rdi	# 393	[c=4 l=3]  *movdi_internal/3
+	call	eeprom_open@PLT	# 394	[c=0 l=5]  *call
+	movq	%rbx, %rdi	# 406	[c=4 l=3]  *movdi_internal/3
+	call	checkpoint_resume@PLT	# 407	[c=0 l=5]  *call
+	cmpl	$0, 232(%rbx)	# 409	[c=13 l=7]  *cmpsi_ccno_1/1
+	jne	.L1484	# 410	[c=13 l=6]  *jcc
+.L1448:
+	movq	(%rsp), %rax	# 702	[c=5 l=4]  *movdi_internal/3
+	cmpl	$0, 424(%rax)	# 418	[c=13 l=7]  *cmpsi_ccno_1/1
+	jne	.L1451	# 419	[c=13 l=2]  *jcc
+	movq	(%rsp), %rdi	# 427	[c=5 l=4]  *movdi_internal/3
+	call	decode_flash@PLT	# 428	[c=0 l=5]  *call
+.L1451:
+	movq	(%rsp), %rbx	# 743	[c=5 l=4]  *movdi_internal/3
+	movq	%rbx, %rdi	# 421	[c=4 l=3]  *movdi_internal/3
+	call	fork_server_open@PLT	# 422	[c=0 l=5]  *call
+	cmpl	$0, 232(%rbx)	# 434	[c=13 l=7]  *cmpsi_ccno_1/1
+	jne	.L1485	# 435	[c=13 l=6]  *jcc
+.L1452:
+	movq	(%rsp), %rbx	# 748	[c=5 l=4]  *movdi_internal/3
+	movq	920(%rbx), %rsi	# 444	[c=9 l=7]  *movdi_internal/3
+	movq	%rbx, %rdi	# 447	[c=4 l=3]  *movdi_internal/3
+	addl	928(%rbx), %esi	# 445	[c=13 l=6]  *addsi_1/1
+	call	replay_seed@PLT	# 448	[c=10 l=5]  *call_value
+	movq	%rbx, %rdi	# 452	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, %esi	# 449	[c=4 l=2]  *movsi_internal/0
+	call	log_init@PLT	# 453	[c=0 l=5]  *call
+	movq	%rbx, %rdi	# 456	[c=4 l=3]  *movdi_internal/3
+	movl	$1, %esi	# 455	[c=4 l=5]  *movsi_internal/0
+	call	log_checkpoint@PLT	# 457	[c=0 l=5]  *call
+	movq	%rbx, %rdi	# 459	[c=4 l=3]  *movdi_internal/3
+	call	execute	# 460	[c=0 l=5]  *call
+.L1480:
+	movl	$32800, %esi	# 188	[c=4 l=5]  *movdi_internal/2
+	movl	$1, %edi	# 189	[c=4 l=5]  *movdi_internal/2
+	call	calloc@PLT	# 190	[c=10 l=5]  *call_value
+	testq	%rax, %rax	# 193	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L1486	# 194	[c=13 l=6]  *jcc
+	movq	(%rsp), %rcx	# 727	[c=5 l=4]  *movdi_internal/3
+	movq	%rbx, (%rax)	# 208	[c=4 l=3]  *movdi_internal/5
+	movq	%rax, 8(%rbx)	# 209	[c=4 l=4]  *movdi_internal/5
+	movq	%rax, 984(%rcx)	# 210	[c=4 l=7]  *movdi_internal/5
+	addq	$32, %rax	# 211	[c=4 l=4]  *adddi_1/0
+	movq	%rax, 1072(%rcx)	# 212	[c=4 l=7]  *movdi_internal/5
+	jmp	.L1429	# 857	[c=1 l=5]  jump
+.L1484:
+	movq	(%rsp), %rax	# 701	[c=5 l=4]  *movdi_internal/3
+	xorl	%esi, %esi	# 817	[c=4 l=2]  *movdi_xor
+	leaq	952(%rax), %rdi	# 761	[c=4 l=7]  *leadi
+	call	gettimeofday@PLT	# 415	[c=10 l=5]  *call_value
+	jmp	.L1448	# 859	[c=1 l=5]  jump
+.L1479:
+	leaq	.LC69(%rip), %r9	# 167	[c=1 l=7]  *movdi_internal/4
+	movl	$16, %r8d	# 168	[c=4 l=6]  *movsi_internal/0
+	movl	%r12d, %ecx	# 169	[c=4 l=3]  *movsi_internal/0
+.L1473:
+	movq	(%rsp), %rdi	# 114	[c=5 l=4]  *movdi_internal/3
+	leaq	.LC27(%rip), %rdx	# 111	[c=1 l=7]  *movdi_internal/4
+	movl	$6, %esi	# 113	[c=4 l=5]  *movsi_internal/0
+	xorl	%eax, %eax	# 830	[c=4 l=2]  *movdi_xor
+	call	leave	# 116	[c=0 l=5]  *call
+.L1478:
+	leaq	.LC67(%rip), %r9	# 108	[c=1 l=7]  *movdi_internal/4
+.L1474:
+	movl	$1, %r8d	# 109	[c=4 l=6]  *movsi_internal/0
+	movl	%r13d, %ecx	# 110	[c=4 l=3]  *movsi_internal/0
+	jmp	.L1473	# 861	[c=1 l=2]  jump
+.L1477:
+	leaq	.LC66(%rip), %r9	# 73	[c=1 l=7]  *movdi_internal/4
+	movl	$1, %r8d	# 74	[c=4 l=6]  *movsi_internal/0
+	movl	%ebx, %ecx	# 75	[c=4 l=2]  *movsi_internal/0
+	jmp	.L1473	# 863	[c=1 l=2]  jump
+.L1482:
+	movq	(%rsp), %rdi	# 369	[c=5 l=4]  *movdi_internal/3
+	leal	(%rax,%rax), %ecx	# 763	[c=12 l=3]  *leasi
+	movq	%rbx, %r8	# 364	[c=4 l=3]  *movdi_internal/3
+	movl	$5, %esi	# 368	[c=4 l=5]  *movsi_internal/0
+	leaq	.LC72(%rip), %rdx	# 366	[c=1 l=7]  *movdi_internal/4
+	xorl	%eax, %eax	# 819	[c=4 l=2]  *movdi_xor
+	call	leave	# 371	[c=0 l=5]  *call
+.L1486:
+	movq	(%rsp), %rdi	# 202	[c=5 l=4]  *movdi_internal/3
+	movl	$8, %r8d	# 197	[c=4 l=6]  *movsi_internal/0
+	leaq	.LC26(%rip), %r9	# 196	[c=1 l=7]  *movdi_internal/4
+	movl	$4096, %ecx	# 198	[c=4 l=5]  *movsi_internal/0
+	leaq	.LC27(%rip), %rdx	# 199	[c=1 l=7]  *movdi_internal/4
+	movl	$6, %esi	# 201	[c=4 l=5]  *movsi_internal/0
+	call	leave	# 204	[c=0 l=5]  *call
+.L1483:
+	movq	(%rsp), %rax	# 698	[c=5 l=4]  *movdi_internal/3
+	xorl	%esi, %esi	# 818	[c=4 l=2]  *movdi_xor
+	leaq	936(%rax), %rdi	# 762	[c=4 l=7]  *leadi
+	call	gettimeofday@PLT	# 384	[c=10 l=5]  *call_value
+	jmp	.L1444	# 865	[c=1 l=5]  jump
+.L1485:
+	movq	(%rsp), %rax	# 704	[c=5 l=4]  *movdi_internal/3
+	xorl	%esi, %esi	# 816	[c=4 l=2]  *movdi_xor
+	leaq	968(%rax), %rdi	# 760	[c=4 l=7]  *leadi
+	call	gettimeofday@PLT	# 440	[c=10 l=5]  *call_value
+	jmp	.L1452	# 867	[c=1 l=5]  jump
+	.cfi_endproc
+.LFE216:
+	.size	run_context, .-run_context
+	.section	.rodata.str1.1
+.LC73:
+	.string	"code must be unreachable"
+	.text
+	.p2align 4
+	.globl	log_cpu_address
+	.type	log_cpu_address, @function
+log_cpu_address:
+.LFB48:
+	.cfi_startproc
+	cmpl	$2, %edx	# 8	[c=4 l=3]  *cmpsi_1/0
+	je	.L1488	# 9	[c=13 l=2]  *jcc
+	jg	.L1489	# 14	[c=13 l=2]  *jcc
+	cmpl	$1, %edx	# 18	[c=4 l=3]  *cmpsi_1/0
+	ja	.L1490	# 19	[c=13 l=2]  *jcc
+	movq	1040(%rdi), %rax	# 113	[c=9 l=7]  *movdi_internal/3
+	movslq	%esi, %rsi	# 32	[c=4 l=3]  *extendsidi2_rex64/1
+	addq	%rsi, %rax	# 114	[c=4 l=3]  *adddi_1/0
+	ret		# 78	[c=0 l=1]  simple_return_internal
+	.p2align 4,,10
+	.p2align 3
+.L1489:
+	cmpl	$3, %edx	# 25	[c=4 l=3]  *cmpsi_1/0
+	jne	.L1490	# 26	[c=13 l=2]  *jcc
+	movq	1048(%rdi), %rax	# 109	[c=9 l=7]  *movdi_internal/3
+	movslq	%esi, %rsi	# 46	[c=4 l=3]  *extendsidi2_rex64/1
+	addq	%rsi, %rax	# 110	[c=4 l=3]  *adddi_1/0
+	ret		# 98	[c=0 l=1]  simple_return_internal
+	.p2align 4,,10
+	.p2align 3
+.L1488:
+	movq	1056(%rdi), %rax	# 111	[c=9 l=7]  *movdi_internal/3
+	movslq	%esi, %rsi	# 39	[c=4 l=3]  *extendsidi2_rex64/1
+	addq	%rsi, %rax	# 112	[c=4 l=3]  *adddi_1/0
+	ret		# 80	[c=0 l=1]  simple_return_internal
+.L1490:
+	pushq	%rax	# 107	[c=4 l=1]  *pushdi2_prologue
+	.cfi_def_cfa_offset 16
+	leaq	.LC73(%rip), %rdx	# 53	[c=1 l=7]  *movdi_internal/4
+	movl	$8, %esi	# 55	[c=4 l=5]  *movsi_internal/0
+	xorl	%eax, %eax	# 108	[c=4 l=2]  *movdi_xor
+	call	leave	# 58	[c=0 l=5]  *call
+	.cfi_endproc
+.LFE48:
+	.size	log_cpu_address, .-log_cpu_address
+	.p2align 4
+	.globl	set_elf_string_table
+	.type	set_elf_string_table, @function
+set_elf_string_table:
+.LFB49:
+	.cfi_startproc
+	pushq	%r13	# 29	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 16
+	.cfi_offset 13, -16
+	movl	%ecx, %r13d	# 5	[c=4 l=3]  *movsi_internal/0
+	pushq	%r12	# 30	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 24
+	.cfi_offset 12, -24
+	movq	%rdx, %r12	# 4	[c=4 l=3]  *movdi_internal/3
+	pushq	%rbp	# 31	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 32
+	.cfi_offset 6, -32
+	movq	%rsi, %rbp	# 3	[c=4 l=3]  *movdi_internal/3
+	pushq	%rbx	# 32	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 40
+	.cfi_offset 3, -40
+	movq	%rdi, %rbx	# 2	[c=4 l=3]  *movdi_internal/3
+	subq	$8, %rsp	# 33	[c=4 l=4]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_def_cfa_offset 48
+	movq	%rsi, 5216(%rdi)	# 9	[c=4 l=7]  *movdi_internal/5
+	movq	%rdx, 5224(%rdi)	# 10	[c=4 l=7]  *movdi_internal/5
+	call	checkpoint_string_table@PLT	# 15	[c=0 l=5]  *call
+	addq	$8, %rsp	# 44	[c=4 l=4]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_def_cfa_offset 40
+	movl	%r13d, %ecx	# 16	[c=4 l=3]  *movsi_internal/0
+	movq	%r12, %rdx	# 17	[c=4 l=3]  *movdi_internal/3
+	movq	%rbp, %rsi	# 18	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rdi	# 19	[c=4 l=3]  *movdi_internal/3
+	popq	%rbx	# 45	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 32
+	popq	%rbp	# 46	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 24
+	popq	%r12	# 47	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 16
+	popq	%r13	# 48	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 8
+	jmp	log_set_string_table@PLT	# 20	[c=0 l=5]  *sibcall
+	.cfi_endproc
+.LFE49:
+	.size	set_elf_string_table, .-set_elf_string_table
+	.p2align 4
+	.globl	finish_elf_string_table
+	.type	finish_elf_string_table, @function
+finish_elf_string_table:
+.LFB50:
+	.cfi_startproc
+	jmp	log_finish_string_table@PLT	# 7	[c=0 l=5]  *sibcall
+	.cfi_endproc
+.LFE50:
+	.size	finish_elf_string_table, .-finish_elf_string_table
+	.p2align 4
+	.globl	set_elf_function_symbol
+	.type	set_elf_function_symbol, @function
+set_elf_function_symbol:
+.LFB51:
+	.cfi_startproc
+	pushq	%r13	# 33	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 16
+	.cfi_offset 13, -16
+	movzbl	%cl, %r13d	# 10	[c=4 l=4]  *zero_extendqisi2/0
+	pushq	%r12	# 34	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 24
+	.cfi_offset 12, -24
+	movl	%r13d, %ecx	# 11	[c=4 l=3]  *movsi_internal/0
+	movq	%rdx, %r12	# 4	[c=4 l=3]  *movdi_internal/3
+	pushq	%rbp	# 35	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 32
+	.cfi_offset 6, -32
+	movl	%esi, %ebp	# 3	[c=4 l=2]  *movsi_internal/0
+	pushq	%rbx	# 36	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 40
+	.cfi_offset 3, -40
+	movq	%rdi, %rbx	# 2	[c=4 l=3]  *movdi_internal/3
+	subq	$8, %rsp	# 37	[c=4 l=4]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_def_cfa_offset 48
+	call	checkpoint_symbol@PLT	# 15	[c=0 l=5]  *call
+	movq	%r12, %rdx	# 17	[c=4 l=3]  *movdi_internal/3
+	movl	%ebp, %esi	# 18	[c=4 l=2]  *movsi_internal/0
+	movq	%rbx, %rdi	# 19	[c=4 l=3]  *movdi_internal/3
+	movl	%r13d, %ecx	# 16	[c=4 l=3]  *movsi_internal/0
+	call	log_set_func_symbol@PLT	# 20	[c=0 l=5]  *call
+	addq	$8, %rsp	# 48	[c=4 l=4]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_def_cfa_offset 40
+	movq	%r12, %rdx	# 21	[c=4 l=3]  *movdi_internal/3
+	movl	%ebp, %esi	# 22	[c=4 l=2]  *movsi_internal/0
+	movq	%rbx, %rdi	# 23	[c=4 l=3]  *movdi_internal/3
+	popq	%rbx	# 49	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 32
+	popq	%rbp	# 50	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 24
+	popq	%r12	# 51	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 16
+	popq	%r13	# 52	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 8
+	jmp	fork_server_set_function_symbol@PLT	# 24	[c=0 l=5]  *sibcall
+	.cfi_endproc
+.LFE51:
+	.size	set_elf_function_symbol, .-set_elf_function_symbol
+	.p2align 4
+	.globl	get_mem
+	.type	get_mem, @function
+get_mem:
+.LFB54:
+	.cfi_startproc
+	pushq	%r13	# 87	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 16
+	.cfi_offset 13, -16
+	movl	%esi, %esi	# 3	[c=1 l=2]  *zero_extendsidi2/3
+	movq	%rdx, %r13	# 4	[c=4 l=3]  *movdi_internal/3
+	pushq	%r12	# 88	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 24
+	.cfi_offset 12, -24
+	movq	%rdi, %r12	# 2	[c=4 l=3]  *movdi_internal/3
+	pushq	%rbp	# 89	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 32
+	.cfi_offset 6, -32
+	movq	%rcx, %rbp	# 5	[c=4 l=3]  *movdi_internal/3
+	pushq	%rbx	# 90	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 40
+	.cfi_offset 3, -40
+	movq	%rsi, %rbx	# 86	[c=4 l=3]  *movdi_internal/3
+	subq	$8, %rsp	# 91	[c=4 l=4]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_def_cfa_offset 48
+	testq	%rdx, %rdx	# 10	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L1503	# 11	[c=13 l=2]  *jcc
+	movq	$-33, %rax	# 13	[c=4 l=7]  *movdi_internal/3
+	xorl	%edx, %edx	# 104	[c=4 l=2]  *movdi_xor
+	divq	%r13	# 84	[c=0 l=3]  *udivmoddi4_noext
+	cmpq	%rsi, %rax	# 15	[c=4 l=3]  *cmpdi_1/0
+	jb	.L1504	# 16	[c=13 l=2]  *jcc
+.L1503:
+	imulq	%r13, %rsi	# 30	[c=16 l=4]  *muldi3_1/2
+	movl	$1, %edi	# 33	[c=4 l=5]  *movdi_internal/2
+	addq	$32, %rsi	# 31	[c=4 l=4]  *adddi_1/0
+	call	calloc@PLT	# 34	[c=10 l=5]  *call_value
+	testq	%rax, %rax	# 38	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L1504	# 39	[c=13 l=2]  *jcc
+	movq	984(%r12), %rdx	# 42	[c=9 l=8]  *movdi_internal/3
+	movq	$0, 8(%rax)	# 41	[c=4 l=8]  *movdi_internal/5
+	movq	%rdx, (%rax)	# 43	[c=4 l=3]  *movdi_internal/5
+	testq	%rdx, %rdx	# 44	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L1505	# 45	[c=13 l=2]  *jcc
+	movq	%rax, 8(%rdx)	# 47	[c=4 l=4]  *movdi_internal/5
+.L1505:
+	movq	%rax, 984(%r12)	# 50	[c=4 l=8]  *movdi_internal/5
+	addq	$8, %rsp	# 94	[c=4 l=4]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_remember_state
+	.cfi_def_cfa_offset 40
+	addq	$32, %rax	# 51	[c=4 l=4]  *adddi_1/0
+	popq	%rbx	# 95	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 32
+	popq	%rbp	# 96	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 24
+	popq	%r12	# 97	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 16
+	popq	%r13	# 98	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 8
+	ret		# 99	[c=0 l=1]  simple_return_internal
+.L1504:
+	.cfi_restore_state
+	movq	%rbp, %r9	# 18	[c=4 l=3]  *movdi_internal/3
+	movl	%r13d, %r8d	# 19	[c=4 l=3]  *movsi_internal/0
+	movl	%ebx, %ecx	# 20	[c=4 l=2]  *movsi_internal/0
+	movl	$6, %esi	# 23	[c=4 l=5]  *movsi_internal/0
+	leaq	.LC27(%rip), %rdx	# 21	[c=1 l=7]  *movdi_internal/4
+	movq	%r12, %rdi	# 24	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 103	[c=4 l=2]  *movdi_xor
+	call	leave	# 26	[c=0 l=5]  *call
+	.cfi_endproc
+.LFE54:
+	.size	get_mem, .-get_mem
+	.p2align 4
+	.globl	put_mem
+	.type	put_mem, @function
+put_mem:
+.LFB55:
+	.cfi_startproc
+	testq	%rsi, %rsi	# 7	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L1516	# 8	[c=13 l=2]  *jcc
+	movq	-24(%rsi), %rdx	# 11	[c=9 l=4]  *movdi_internal/3
+	movq	-32(%rsi), %rax	# 12	[c=9 l=4]  *movdi_internal/3
+	leaq	-32(%rsi), %rcx	# 48	[c=4 l=4]  *leadi
+	testq	%rdx, %rdx	# 13	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L1518	# 14	[c=13 l=2]  *jcc
+	movq	%rax, (%rdx)	# 16	[c=4 l=3]  *movdi_internal/5
+.L1519:
+	testq	%rax, %rax	# 24	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L1520	# 25	[c=13 l=2]  *jcc
+	movq	%rdx, 8(%rax)	# 27	[c=4 l=4]  *movdi_internal/5
+.L1520:
+	movq	%rcx, %rdi	# 30	[c=4 l=3]  *movdi_internal/3
+	jmp	free@PLT	# 31	[c=0 l=5]  *sibcall
+	.p2align 4,,10
+	.p2align 3
+.L1516:
+	ret		# 51	[c=0 l=1]  simple_return_internal
+	.p2align 4,,10
+	.p2align 3
+.L1518:
+	movq	%rax, 984(%rdi)	# 21	[c=4 l=7]  *movdi_internal/5
+	jmp	.L1519	# 53	[c=1 l=2]  jump
+	.cfi_endproc
+.LFE55:
+	.size	put_mem, .-put_mem
+	.section	.rodata.str1.1
+.LC74:
+	.string	"out of memory opening %s"
+	.text
+	.p2align 4
+	.globl	get_file
+	.type	get_file, @function
+get_file:
+.LFB56:
+	.cfi_startproc
+	pushq	%r12	# 73	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 16
+	.cfi_offset 12, -16
+	movq	%rsi, %r12	# 3	[c=4 l=3]  *movdi_internal/3
+	movq	%rdx, %rsi	# 4	[c=4 l=3]  *movdi_internal/3
+	pushq	%rbp	# 74	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 24
+	.cfi_offset 6, -24
+	movq	%rdi, %rbp	# 2	[c=4 l=3]  *movdi_internal/3
+	movq	%r12, %rdi	# 9	[c=4 l=3]  *movdi_internal/3
+	pushq	%rbx	# 75	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 32
+	.cfi_offset 3, -32
+	call	fopen@PLT	# 10	[c=10 l=5]  *call_value
+	movq	%rax, %rbx	# 11	[c=4 l=3]  *movdi_internal/3
+	testq	%rax, %rax	# 13	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L1524	# 14	[c=13 l=2]  *jcc
+	movl	$32, %esi	# 16	[c=4 l=5]  *movdi_internal/2
+	movl	$1, %edi	# 17	[c=4 l=5]  *movdi_internal/2
+	call	calloc@PLT	# 18	[c=10 l=5]  *call_value
+	testq	%rax, %rax	# 21	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L1535	# 22	[c=13 l=2]  *jcc
+	movq	984(%rbp), %rdx	# 38	[c=9 l=7]  *movdi_internal/3
+	movq	%rbx, 16(%rax)	# 36	[c=4 l=4]  *movdi_internal/5
+	movq	$0, 8(%rax)	# 37	[c=4 l=8]  *movdi_internal/5
+	movq	%rdx, (%rax)	# 39	[c=4 l=3]  *movdi_internal/5
+	testq	%rdx, %rdx	# 40	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L1527	# 41	[c=13 l=2]  *jcc
+	movq	%rax, 8(%rdx)	# 43	[c=4 l=4]  *movdi_internal/5
+.L1527:
+	movq	%rax, 984(%rbp)	# 46	[c=4 l=7]  *movdi_internal/5
+.L1524:
+	movq	%rbx, %rax	# 52	[c=4 l=3]  *movdi_internal/3
+	popq	%rbx	# 78	[c=9 l=1]  *popdi1
+	.cfi_remember_state
+	.cfi_def_cfa_offset 24
+	popq	%rbp	# 79	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 16
+	popq	%r12	# 80	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 8
+	ret		# 81	[c=0 l=1]  simple_return_internal
+.L1535:
+	.cfi_restore_state
+	movq	%rbx, %rdi	# 24	[c=4 l=3]  *movdi_internal/3
+	call	fclose@PLT	# 25	[c=10 l=5]  *call_value
+	movq	%r12, %rcx	# 26	[c=4 l=3]  *movdi_internal/3
+	movl	$6, %esi	# 29	[c=4 l=5]  *movsi_internal/0
+	movq	%rbp, %rdi	# 30	[c=4 l=3]  *movdi_internal/3
+	leaq	.LC74(%rip), %rdx	# 27	[c=1 l=7]  *movdi_internal/4
+	xorl	%eax, %eax	# 85	[c=4 l=2]  *movdi_xor
+	call	leave	# 32	[c=0 l=5]  *call
+	.cfi_endproc
+.LFE56:
+	.size	get_file, .-get_file
+	.p2align 4
+	.globl	put_file
+	.type	put_file, @function
+put_file:
+.LFB57:
+	.cfi_startproc
+	pushq	%rbx	# 79	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	movq	984(%rdi), %rax	# 7	[c=9 l=7]  *movdi_internal/3
+	movq	%rsi, %rbx	# 3	[c=4 l=3]  *movdi_internal/3
+	testq	%rax, %rax	# 8	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L1537	# 9	[c=13 l=2]  *jcc
+	movq	%rdi, %rcx	# 85	[c=4 l=3]  *movdi_internal/3
+	jmp	.L1542	# 90	[c=1 l=2]  jump
+	.p2align 4,,10
+	.p2align 3
+.L1538:
+	testq	%rax, %rax	# 42	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L1537	# 43	[c=13 l=2]  *jcc
+.L1542:
+	movq	16(%rax), %rdx	# 11	[c=9 l=4]  *movdi_internal/3
+	movq	%rax, %rdi	# 12	[c=4 l=3]  *movdi_internal/3
+	movq	(%rax), %rax	# 13	[c=5 l=3]  *movdi_internal/3
+	cmpq	%rbx, %rdx	# 14	[c=4 l=3]  *cmpdi_1/0
+	jne	.L1538	# 15	[c=13 l=2]  *jcc
+	movq	8(%rdi), %rdx	# 17	[c=9 l=4]  *movdi_internal/3
+	testq	%rdx, %rdx	# 18	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L1539	# 19	[c=13 l=2]  *jcc
+	movq	%rax, (%rdx)	# 21	[c=4 l=3]  *movdi_internal/5
+.L1540:
+	testq	%rax, %rax	# 29	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L1541	# 30	[c=13 l=2]  *jcc
+	movq	%rdx, 8(%rax)	# 32	[c=4 l=4]  *movdi_internal/5
+.L1541:
+	call	free@PLT	# 36	[c=0 l=5]  *call
+.L1537:
+	movq	%rbx, %rdi	# 46	[c=4 l=3]  *movdi_internal/3
+	popq	%rbx	# 88	[c=9 l=1]  *popdi1
+	.cfi_remember_state
+	.cfi_def_cfa_offset 8
+	jmp	fclose@PLT	# 47	[c=10 l=5]  *sibcall_value
+	.p2align 4,,10
+	.p2align 3
+.L1539:
+	.cfi_restore_state
+	movq	%rax, 984(%rcx)	# 26	[c=4 l=7]  *movdi_internal/5
+	jmp	.L1540	# 92	[c=1 l=2]  jump
+	.cfi_endproc
+.LFE57:
+	.size	put_file, .-put_file
+	.p2align 4
+	.globl	write_checkpoint
+	.type	write_checkpoint, @function
+write_checkpoint:
+.LFB205:
+	.cfi_startproc
+	pushq	%rbx	# 18	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 16
+	.cfi_offset 3, -16
+	movq	%rdi, %rbx	# 2	[c=4 l=3]  *movdi_internal/3
+	call	checkpoint_begin@PLT	# 7	[c=0 l=5]  *call
+	movq	%rbx, %rdi	# 9	[c=4 l=3]  *movdi_internal/3
+	xorl	%esi, %esi	# 27	[c=4 l=2]  *movdi_xor
+	call	log_checkpoint@PLT	# 10	[c=0 l=5]  *call
+	movq	%rbx, %rdi	# 11	[c=4 l=3]  *movdi_internal/3
+	popq	%rbx	# 25	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 8
+	jmp	checkpoint_end@PLT	# 12	[c=0 l=5]  *sibcall
+	.cfi_endproc
+.LFE205:
+	.size	write_checkpoint, .-write_checkpoint
+	.section	.text.startup,"ax",@progbits
+	.p2align 4
+	.globl	main
+	.type	main, @function
+main:
+.LFB217:
+	.cfi_startproc
+	pushq	%r13	# 53	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 16
+	.cfi_offset 13, -16
+	movl	$11112, %edx	# 15	[c=4 l=5]  *movdi_internal/2
+	pushq	%r12	# 54	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 24
+	.cfi_offset 12, -24
+	movq	%rsi, %r12	# 3	[c=4 l=3]  *movdi_internal/3
+	xorl	%esi, %esi	# 74	[c=4 l=2]  *movdi_xor
+	pushq	%rbp	# 55	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 32
+	.cfi_offset 6, -32
+	movl	%edi, %ebp	# 2	[c=4 l=2]  *movsi_internal/0
+	pushq	%rbx	# 56	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 40
+	.cfi_offset 3, -40
+	leaq	cx.2(%rip), %rbx	# 12	[c=1 l=7]  *movdi_internal/4
+	movq	%rbx, %rdi	# 17	[c=4 l=3]  *movdi_internal/3
+	subq	$24, %rsp	# 57	[c=4 l=4]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_def_cfa_offset 64
+	movq	stderr(%rip), %r13	# 7	[c=6 l=7]  *movdi_internal/3
+	movq	stdin(%rip), %xmm0	# 48	[c=6 l=9]  *movdi_internal/14
+	movhps	stdout(%rip), %xmm0	# 10	[c=4 l=7]  vec_concatv2di/7
+	movaps	%xmm0, (%rsp)	# 51	[c=4 l=4]  movv2di_internal/3
+	call	memset@PLT	# 18	[c=10 l=5]  *call_value
+	movdqa	(%rsp), %xmm0	# 52	[c=9 l=5]  movv2di_internal/2
+	leaq	100(%rbx), %rax	# 23	[c=4 l=4]  *leadi
+	movq	%rbx, %rdi	# 31	[c=4 l=3]  *movdi_internal/3
+	movq	%r13, 912+cx.2(%rip)	# 29	[c=4 l=7]  *movdi_internal/5
+	movq	%rax, 104+cx.2(%rip)	# 50	[c=4 l=7]  *movdi_internal/5
+	movl	$-1, 10896+cx.2(%rip)	# 25	[c=4 l=10]  *movsi_internal/1
+	movaps	%xmm0, 896+cx.2(%rip)	# 27	[c=4 l=7]  movv2di_internal/3
+	call	events_init@PLT	# 32	[c=0 l=5]  *call
+	addq	$24, %rsp	# 68	[c=4 l=4]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_def_cfa_offset 40
+	movq	%r12, %rdx	# 33	[c=4 l=3]  *movdi_internal/3
+	movl	%ebp, %esi	# 34	[c=4 l=2]  *movsi_internal/0
+	movq	%rbx, %rdi	# 36	[c=4 l=3]  *movdi_internal/3
+	popq	%rbx	# 69	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 32
+	popq	%rbp	# 70	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 24
+	popq	%r12	# 71	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 16
+	popq	%r13	# 72	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 8
+	jmp	run_context	# 37	[c=10 l=5]  *sibcall_value
+	.cfi_endproc
+.LFE217:
+	.size	main, .-main
+	.section	.rodata.str1.1
+.LC75:
+	.string	"%s: out of memory\n"
+	.text
+	.p2align 4
+	.globl	job_main
+	.type	job_main, @function
+job_main:
+.LFB218:
+	.cfi_startproc
+	pushq	%r15	# 70	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 16
+	.cfi_offset 15, -16
+	movq	%rdx, %r15	# 4	[c=4 l=3]  *movdi_internal/3
+	pushq	%r14	# 71	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 24
+	.cfi_offset 14, -24
+	movq	%rcx, %r14	# 5	[c=4 l=3]  *movdi_internal/3
+	pushq	%r13	# 72	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 32
+	.cfi_offset 13, -32
+	movq	%r9, %r13	# 7	[c=4 l=3]  *movdi_internal/3
+	pushq	%r12	# 73	[c=4 l=2]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 40
+	.cfi_offset 12, -40
+	movq	%r8, %r12	# 6	[c=4 l=3]  *movdi_internal/3
+	pushq	%rbp	# 74	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 48
+	.cfi_offset 6, -48
+	movq	%rsi, %rbp	# 3	[c=4 l=3]  *movdi_internal/3
+	movl	$1, %esi	# 12	[c=4 l=5]  *movdi_internal/2
+	pushq	%rbx	# 75	[c=4 l=1]  *pushdi2_rex64/0
+	.cfi_def_cfa_offset 56
+	.cfi_offset 3, -56
+	subq	$24, %rsp	# 76	[c=4 l=4]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_def_cfa_offset 80
+	movl	%edi, 12(%rsp)	# 2	[c=4 l=4]  *movsi_internal/1
+	movl	$11112, %edi	# 13	[c=4 l=5]  *movdi_internal/2
+	call	calloc@PLT	# 14	[c=10 l=5]  *call_value
+	testq	%rax, %rax	# 17	[c=4 l=3]  *cmpdi_ccno_1/0
+	je	.L1559	# 18	[c=13 l=2]  *jcc
+	movq	%rax, %rbx	# 87	[c=4 l=3]  *movdi_internal/3
+	leaq	100(%rax), %rax	# 69	[c=4 l=4]  *leadi
+	movl	$0, 0(%r13)	# 30	[c=4 l=8]  *movsi_internal/1
+	pxor	%xmm0, %xmm0	# 31	[c=4 l=4]  movv2di_internal/0
+	movq	%rax, 104(%rbx)	# 35	[c=4 l=4]  *movdi_internal/5
+	movq	%rbx, %rdi	# 40	[c=4 l=3]  *movdi_internal/3
+	movq	$0, 24(%r13)	# 33	[c=4 l=8]  *movdi_internal/5
+	movl	$-1, 10896(%rbx)	# 36	[c=4 l=10]  *movsi_internal/1
+	movq	%r15, 896(%rbx)	# 37	[c=4 l=7]  *movdi_internal/5
+	movq	%r14, 904(%rbx)	# 38	[c=4 l=7]  *movdi_internal/5
+	movq	%r12, 912(%rbx)	# 39	[c=4 l=7]  *movdi_internal/5
+	movups	%xmm0, 8(%r13)	# 32	[c=4 l=5]  movv2di_internal/3
+	call	events_init@PLT	# 41	[c=0 l=5]  *call
+	movl	12(%rsp), %esi	# 44	[c=9 l=4]  *movsi_internal/0
+	movq	%rbp, %rdx	# 43	[c=4 l=3]  *movdi_internal/3
+	movq	%rbx, %rdi	# 45	[c=4 l=3]  *movdi_internal/3
+	movq	%r13, 11016(%rbx)	# 42	[c=4 l=7]  *movdi_internal/5
+	call	run_context	# 46	[c=10 l=5]  *call_value
+	movq	%rbx, %rdi	# 48	[c=4 l=3]  *movdi_internal/3
+	movl	%eax, %ebp	# 47	[c=4 l=2]  *movsi_internal/0
+	call	free@PLT	# 49	[c=0 l=5]  *call
+.L1555:
+	addq	$24, %rsp	# 79	[c=4 l=4]  pro_epilogue_adjust_stack_add_di/0
+	.cfi_remember_state
+	.cfi_def_cfa_offset 56
+	movl	%ebp, %eax	# 55	[c=4 l=2]  *movsi_internal/0
+	popq	%rbx	# 80	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 48
+	popq	%rbp	# 81	[c=9 l=1]  *popdi1
+	.cfi_def_cfa_offset 40
+	popq	%r12	# 82	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 32
+	popq	%r13	# 83	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 24
+	popq	%r14	# 84	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 16
+	popq	%r15	# 85	[c=9 l=2]  *popdi1
+	.cfi_def_cfa_offset 8
+	ret		# 86	[c=0 l=1]  simple_return_internal
+.L1559:
+	.cfi_restore_state
+	movq	0(%rbp), %rdx	# 20	[c=5 l=4]  *movdi_internal/3
+	leaq	.LC75(%rip), %rsi	# 21	[c=1 l=7]  *movdi_internal/4
+	movq	%r12, %rdi	# 23	[c=4 l=3]  *movdi_internal/3
+	xorl	%eax, %eax	# 91	[c=4 l=2]  *movdi_xor
+	movl	$20, %ebp	# 9	[c=4 l=5]  *movsi_internal/0
+	call	fprintf@PLT	# 25	[c=10 l=5]  *call_value
+	jmp	.L1555	# 93	[c=1 l=2]  jump
+	.cfi_endproc
+.LFE218:
+	.size	job_main, .-job_main
+	.section	.rodata
+	.align 16
+	.type	CSWTCH.147, @object
+	.size	CSWTCH.147, 20
+CSWTCH.147:
+	.long	1
+	.long	0
+	.long	2
+	.long	0
+	.long	3
+	.align 16
+	.type	se.0, @object
+	.size	se.0, 24
+se.0:
+	.value	83
+	.byte	1
+	.zero	1
+	.value	85
+	.byte	32
+	.zero	1
+	.value	85
+	.byte	64
+	.zero	1
+	.value	85
+	.byte	-128
+	.zero	1
+	.value	58
+	.byte	1
+	.zero	1
+	.value	72
+	.byte	1
+	.zero	1
+	.section	.data.rel.ro.local,"aw"
+	.align 32
+	.type	handler.1, @object
+	.size	handler.1, 896
+handler.1:
+	.quad	.L263
+	.quad	.L264
+	.quad	.L268
+	.quad	.L269
+	.quad	.L290
+	.quad	.L298
+	.quad	.L305
+	.quad	.L312
+	.quad	.L319
+	.quad	.L326
+	.quad	.L333
+	.quad	.L340
+	.quad	.L347
+	.quad	.L351
+	.quad	.L354
+	.quad	.L361
+	.quad	.L368
+	.quad	.L375
+	.quad	.L382
+	.quad	.L409
+	.quad	.L420
+	.quad	.L427
+	.quad	.L434
+	.quad	.L439
+	.quad	.L446
+	.quad	.L450
+	.quad	.L454
+	.quad	.L461
+	.quad	.L462
+	.quad	.L493
+	.quad	.L501
+	.quad	.L505
+	.quad	.L509
+	.quad	.L516
+	.quad	.L523
+	.quad	.L541
+	.quad	.L548
+	.quad	.L555
+	.quad	.L562
+	.quad	.L589
+	.quad	.L593
+	.quad	.L598
+	.quad	.L605
+	.quad	.L609
+	.quad	.L610
+	.quad	.L615
+	.quad	.L620
+	.quad	.L625
+	.quad	.L630
+	.quad	.L635
+	.quad	.L640
+	.quad	.L645
+	.quad	.L650
+	.quad	.L655
+	.quad	.L660
+	.quad	.L665
+	.quad	.L666
+	.quad	.L667
+	.quad	.L668
+	.quad	.L675
+	.quad	.L676
+	.quad	.L677
+	.quad	.L684
+	.quad	.L691
+	.quad	.L698
+	.quad	.L705
+	.quad	.L706
+	.quad	.L713
+	.quad	.L720
+	.quad	.L725
+	.quad	.L739
+	.quad	.L754
+	.quad	.L780
+	.quad	.L806
+	.quad	.L838
+	.quad	.L842
+	.quad	.L849
+	.quad	.L854
+	.quad	.L859
+	.quad	.L870
+	.quad	.L878
+	.quad	.L886
+	.quad	.L894
+	.quad	.L902
+	.quad	.L906
+	.quad	.L910
+	.quad	.L914
+	.quad	.L918
+	.quad	.L924
+	.quad	.L939
+	.quad	.L944
+	.quad	.L949
+	.quad	.L954
+	.quad	.L959
+	.quad	.L964
+	.quad	.L969
+	.quad	.L974
+	.quad	.L979
+	.quad	.L984
+	.quad	.L989
+	.quad	.L994
+	.quad	.L1001
+	.quad	.L1008
+	.quad	.L1009
+	.quad	.L1010
+	.quad	.L1017
+	.quad	.L1024
+	.quad	.L1031
+	.quad	.L1038
+	.quad	.L1039
+	.quad	.L1040
+	.quad	.L1041
+	.local	cx.2
+	.comm	cx.2,11112,32
+	.globl	opcodes
+	.section	.rodata.str1.1
+.LC76:
+	.string	"bad PC"
+.LC77:
+	.string	"ILLEGAL"
+.LC78:
+	.string	""
+.LC79:
+	.string	"*** SYSCALL"
+.LC80:
+	.string	"ADC"
+.LC81:
+	.string	"ADD"
+.LC82:
+	.string	"ADIW"
+.LC83:
+	.string	"SBIW"
+.LC84:
+	.string	"AND"
+.LC85:
+	.string	"ANDI"
+.LC86:
+	.string	"ASR"
+.LC87:
+	.string	"CL*"
+.LC88:
+	.string	"BLD.*"
+.LC89:
+	.string	"BREAK"
+.LC90:
+	.string	"BR*C"
+.LC91:
+	.string	"BR*S"
+.LC92:
+	.string	"SE*"
+.LC93:
+	.string	"BST.*"
+.LC94:
+	.string	"CALL"
+.LC95:
+	.string	"CBI.*"
+.LC96:
+	.string	"COM"
+.LC97:
+	.string	"CP"
+.LC98:
+	.string	"CPC"
+.LC99:
+	.string	"CPI"
+.LC100:
+	.string	"CPSE"
+.LC101:
+	.string	"DEC"
+.LC102:
+	.string	"DES"
+.LC103:
+	.string	"EICALL"
+.LC104:
+	.string	"EIJMP"
+.LC105:
+	.string	"ELPM"
+.LC106:
+	.string	"ELPM Z"
+.LC107:
+	.string	"ELPM Z+"
+.LC108:
+	.string	"EOR"
+.LC109:
+	.string	"ESPM"
+.LC110:
+	.string	"FMUL"
+.LC111:
+	.string	"FMULS"
+.LC112:
+	.string	"FMULSU"
+.LC113:
+	.string	"ICALL"
+.LC114:
+	.string	"IJMP"
+.LC115:
+	.string	"IN"
+.LC116:
+	.string	"INC"
+.LC117:
+	.string	"JMP"
+.LC118:
+	.string	"LDI"
+.LC119:
+	.string	"LDD Y+q"
+.LC120:
+	.string	"LDD Z+q"
+.LC121:
+	.string	"LDS"
+.LC122:
+	.string	"LD X"
+.LC123:
+	.string	"LD -X"
+.LC124:
+	.string	"LD X+"
+.LC125:
+	.string	"LD -Y"
+.LC126:
+	.string	"LD Y+"
+.LC127:
+	.string	"LD -Z"
+.LC128:
+	.string	"LD Z+"
+.LC129:
+	.string	"LPM"
+.LC130:
+	.string	"LPM Z"
+.LC131:
+	.string	"LPM Z+"
+.LC132:
+	.string	"LSR"
+.LC133:
+	.string	"MOV"
+.LC134:
+	.string	"MOVW"
+.LC135:
+	.string	"MUL"
+.LC136:
+	.string	"MULS"
+.LC137:
+	.string	"MULSU"
+.LC138:
+	.string	"NEG"
+.LC139:
+	.string	"NOP"
+.LC140:
+	.string	"OR"
+.LC141:
+	.string	"ORI"
+.LC142:
+	.string	"OUT"
+.LC143:
+	.string	"POP"
+.LC144:
+	.string	"PUSH"
+.LC145:
+	.string	"RCALL"
+.LC146:
+	.string	"RET"
+.LC147:
+	.string	"RETI"
+.LC148:
+	.string	"RJMP"
+.LC149:
+	.string	"ROR"
+.LC150:
+	.string	"SBC"
+.LC151:
+	.string	"SBCI"
+.LC152:
+	.string	"SBI.*"
+.LC153:
+	.string	"SBIC.*"
+.LC154:
+	.string	"SBIS.*"
+.LC155:
+	.string	"SBRC.*"
+.LC156:
+	.string	"SBRS.*"
+.LC157:
+	.string	"SLEEP"
+.LC158:
+	.string	"SPM"
+.LC159:
+	.string	"STD Y+q"
+.LC160:
+	.string	"STD Z+q"
+.LC161:
+	.string	"STS"
+.LC162:
+	.string	"ST X"
+.LC163:
+	.string	"ST -X"
+.LC164:
+	.string	"ST X+"
+.LC165:
+	.string	"ST -Y"
+.LC166:
+	.string	"ST Y+"
+.LC167:
+	.string	"ST -Z"
+.LC168:
+	.string	"ST Z+"
+.LC169:
+	.string	"SUB"
+.LC170:
+	.string	"SUBI"
+.LC171:
+	.string	"SWAP"
+.LC172:
+	.string	"WDR"
+.LC173:
+	.string	"CLR"
+.LC174:
+	.string	"LSL"
+.LC175:
+	.string	"ROL"
+.LC176:
+	.string	"TST"
+.LC177:
+	.string	"XCH"
+.LC178:
+	.string	"LAS"
+.LC179:
+	.string	"LAC"
+.LC180:
+	.string	"LAT"
+	.section	.data.rel.ro.local
+	.align 32
+	.type	opcodes, @object
+	.size	opcodes, 1792
+opcodes:
+	.quad	.LC76
+	.value	0
+	.value	0
+	.zero	4
+	.quad	.LC77
+	.value	0
+	.value	0
+	.zero	4
+	.quad	.LC78
+	.value	0
+	.value	0
+	.zero	4
+	.quad	.LC79
+	.value	2
+	.value	0
+	.zero	4
+	.quad	.LC80
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC81
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC82
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC83
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC84
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC85
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC86
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC87
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC88
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC89
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC90
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC91
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC92
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC93
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC94
+	.value	2
+	.value	4
+	.zero	4
+	.quad	.LC95
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC96
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC97
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC98
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC99
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC100
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC100
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC101
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC102
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC103
+	.value	1
+	.value	4
+	.zero	4
+	.quad	.LC104
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC105
+	.value	1
+	.value	3
+	.zero	4
+	.quad	.LC106
+	.value	1
+	.value	3
+	.zero	4
+	.quad	.LC107
+	.value	1
+	.value	3
+	.zero	4
+	.quad	.LC108
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC109
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC110
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC111
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC112
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC113
+	.value	1
+	.value	3
+	.zero	4
+	.quad	.LC114
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC115
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC116
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC117
+	.value	2
+	.value	3
+	.zero	4
+	.quad	.LC118
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC119
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC120
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC121
+	.value	2
+	.value	2
+	.zero	4
+	.quad	.LC121
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC122
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC123
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC124
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC125
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC126
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC127
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC128
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC129
+	.value	1
+	.value	3
+	.zero	4
+	.quad	.LC130
+	.value	1
+	.value	3
+	.zero	4
+	.quad	.LC131
+	.value	1
+	.value	3
+	.zero	4
+	.quad	.LC132
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC133
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC134
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC135
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC136
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC137
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC138
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC139
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC140
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC141
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC142
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC143
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC144
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC145
+	.value	1
+	.value	3
+	.zero	4
+	.quad	.LC146
+	.value	1
+	.value	4
+	.zero	4
+	.quad	.LC147
+	.value	1
+	.value	4
+	.zero	4
+	.quad	.LC148
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC149
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC150
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC151
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC152
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC153
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC153
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC154
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC154
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC155
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC155
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC156
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC156
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC157
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC158
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC159
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC160
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC161
+	.value	2
+	.value	2
+	.zero	4
+	.quad	.LC161
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC162
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC163
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC164
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC165
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC166
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC167
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC168
+	.value	1
+	.value	2
+	.zero	4
+	.quad	.LC169
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC170
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC171
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC172
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC173
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC174
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC175
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC176
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC177
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC178
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC179
+	.value	1
+	.value	1
+	.zero	4
+	.quad	.LC180
+	.value	1
+	.value	1
+	.zero	4
+	.globl	named_sfr
+	.section	.rodata.str1.1
+.LC181:
+	.string	"SPL"
+.LC182:
+	.string	"SPH"
+.LC183:
+	.string	"RAMPZ"
+.LC184:
+	.string	"RAMPY"
+.LC185:
+	.string	"RAMPX"
+.LC186:
+	.string	"RAMPD"
+.LC187:
+	.string	"EIND"
+	.section	.data.rel.ro.local
+	.align 32
+	.type	named_sfr, @object
+	.size	named_sfr, 192
+named_sfr:
+	.long	93
+	.zero	4
+	.quad	.LC181
+	.long	0
+	.zero	4
+	.long	94
+	.zero	4
+	.quad	.LC182
+	.long	0
+	.zero	4
+	.long	91
+	.zero	4
+	.quad	.LC183
+	.long	0
+	.zero	4
+	.long	90
+	.zero	4
+	.quad	.LC184
+	.long	1
+	.zero	4
+	.long	89
+	.zero	4
+	.quad	.LC185
+	.long	1
+	.zero	4
+	.long	88
+	.zero	4
+	.quad	.LC186
+	.long	1
+	.zero	4
+	.long	92
+	.zero	4
+	.quad	.LC187
+	.long	2
+	.zero	4
+	.long	0
+	.zero	4
+	.quad	0
+	.long	0
+	.zero	4
+	.globl	addr_SPL
+	.section	.rodata
+	.align 4
+	.type	addr_SPL, @object
+	.size	addr_SPL, 4
+addr_SPL:
+	.long	93
+	.globl	addr_SREG
+	.align 4
+	.type	addr_SREG, @object
+	.size	addr_SREG, 4
+addr_SREG:
+	.long	95
+	.section	.rodata.str1.1
+.LC188:
+	.string	"EXIT"
+.LC189:
+	.string	"TIMEOUT"
+.LC190:
+	.string	"usage"
+.LC191:
+	.string	"memory"
+.LC192:
+	.string	"file i/o"
+.LC193:
+	.string	"FATAL ABORTED"
+.LC194:
+	.string	"fatal"
+	.section	.data.rel.ro.local
+	.align 32
+	.type	exit_status, @object
+	.size	exit_status, 216
+exit_status:
+	.quad	.LC188
+	.quad	0
+	.long	0
+	.long	-1
+	.quad	.LC0
+	.quad	0
+	.long	0
+	.long	1
+	.quad	.LC189
+	.quad	0
+	.long	0
+	.long	10
+	.quad	.LC0
+	.quad	0
+	.long	0
+	.long	11
+	.quad	.LC0
+	.quad	0
+	.long	0
+	.long	12
+	.quad	.LC0
+	.quad	.LC190
+	.long	1
+	.long	21
+	.quad	.LC0
+	.quad	.LC191
+	.long	1
+	.long	20
+	.quad	.LC0
+	.quad	.LC192
+	.long	1
+	.long	22
+	.quad	.LC193
+	.quad	.LC194
+	.long	1
+	.long	42
+	.globl	invalid_opcode
+	.section	.rodata
+	.align 4
+	.type	invalid_opcode, @object
+	.size	invalid_opcode, 4
+invalid_opcode:
+	.long	65535
+	.globl	io_base
+	.align 4
+	.type	io_base, @object
+	.size	io_base, 4
+io_base:
+	.long	32
+	.globl	is_avrtest_log
+	.type	is_avrtest_log, @object
+	.size	is_avrtest_log, 1
+is_avrtest_log:
+	.byte	1
+	.globl	is_tiny
+	.type	is_tiny, @object
+	.size	is_tiny, 1
+is_tiny:
+	.zero	1
+	.globl	is_xmega
+	.type	is_xmega, @object
+	.size	is_xmega, 1
+is_xmega:
+	.zero	1
+	.align 32
+	.type	flag_update_table_logical, @object
+	.size	flag_update_table_logical, 256
+flag_update_table_logical:
+	.string	"\002"
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.string	""
+	.ascii	"\024\024\024\024\024\024\024\024\024\024\024\024\024\024\024"
+	.ascii	"\024\024\024\024\024\024\024\024\024\024\024\024\024\024\024"
+	.ascii	"\024\024\024\024\024\024\024\024\024\024\024\024\024\024\024"
+	.ascii	"\024\024\024\024\024\024\024\024\024\024\024\024\024\024\024"
+	.ascii	"\024\024\024\024\024\024\024\024\024\024\024\024\024\024\024"
+	.ascii	"\024\024\024\024\024\024\024\024\024\024\024\024\024\024\024"
+	.ascii	"\024\024\024\024\024\024\024\024\024\024\024\024\024\024\024"
+	.ascii	"\024\024\024\024\024\024\024\024\024\024\024\024\024\024\024"
+	.ascii	"\024\024\024\024\024\024\024\024"
+	.section	.rodata.cst8,"aM",@progbits,8
+	.align 8
+.LC7:
+	.long	0
+	.long	1083129856
+	.align 8
+.LC8:
+	.long	-755914244
+	.long	1062232653
+	.align 8
+.LC9:
+	.long	1202590843
+	.long	1065646817
+	.align 8
+.LC10:
+	.long	0
+	.long	1079574528
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
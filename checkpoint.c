@@ -0,0 +1,721 @@
+/*
+  This file is part of avrtest -- A simple simulator for the
+  Atmel AVR family of microcontrollers designed to test the compiler.
+
+  Copyright (C) 2001, 2002, 2003   Theodore A. Roth, Klaus Rudolph
+  Copyright (C) 2007 Paulo Marques
+  Copyright (C) 2008-2026 Free Software Foundation, Inc.
+
+  avrtest is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 2 of the License, or
+  (at your option) any later version.
+
+  avrtest is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with avrtest; see the file COPYING.  If not, write to
+  the Free Software Foundation, 59 Temple Place - Suite 330,
+  Boston, MA 02111-1307, USA.  */
+
+/* Checkpoints.
+
+   -checkpoint-at=N and -checkpoint-every=N write the state of the
+   simulation to a file once the cycle counter reaches N resp. a multiple
+   of N, and -restore=FILE resumes from such a file.  Checkpoints are
+   taken in do_events() at the end of a basic block, where nothing is
+   in flight:  The next thing to happen is the instruction at cx->pc.
+
+   The file starts with CHECKPOINT_MAGIC and CHECKPOINT_VERSION, which
+   is incremented whenever the layout of a section changes.  Then follow
+   sections, each a tag, its size, and its contents packed by pack().
+   The sections hold the CPU and the program counters, the memories, the
+   events, and the peripherals.  avrtest_log adds its perf-meters by
+   log_checkpoint().  Sections that the reader does not know about are
+   ignored, hence a checkpoint of avrtest can be restored by avrtest_log
+   and vice versa.  The sections are raw images of the structs in
+   context_t, so a checkpoint is only good for hosts of the same kind.
+
+   The checkpoint also holds the flash, the decoded instructions, and
+   the symbols of the ELF file as used by -hle, -fork-server and
+   logging, together with a hash of the program file.  -restore=FILE
+   still needs the program, but only to check the hash:  When it
+   matches, neither the program is loaded nor the flash decoded, and the
+   symbols are handed to the modules just like the ELF loader does.
+   avrtest_log adds the call graph of -graph and -debug-tree.  */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <inttypes.h>
+
+#include "testavr.h"
+#include "options.h"
+#include "irq.h"
+#include "periph.h"
+#include "checkpoint.h"
+
+#define CHECKPOINT_MAGIC "avrtest-checkpoint"
+#define CHECKPOINT_VERSION 3
+
+#define MAX_TAG 16
+#define MAX_SECTIONS 64
+
+// The scalar state of a checkpoint.
+typedef struct
+{
+  char arch[MAX_TAG], device[32];
+  qword image;
+  unsigned pc, code_start, code_end;
+  unsigned size, n_bytes, entry_point;
+  qword n_insns, n_cycles, n_sleep_cycles, reti_cycles;
+  qword usart_received;
+  int n_events;
+  // The size of the ELF string table or 0 if there is none, and where
+  // PC was at when the symbols were read, cf. graph_finish_string_table().
+  unsigned strtab_size, entry;
+  int n_entries, n_symbols;
+} state_t;
+
+// An ELF symbol as of set_elf_function_symbol().
+typedef struct
+{
+  int addr;
+  unsigned offset;
+  int is_func;
+} saved_symbol_t;
+
+// A decoded_t without its handler, which execute() sets anew.
+typedef struct
+{
+  byte id, size, op1, block_insns;
+  word op2, block_cycles;
+} saved_insn_t;
+
+// An event of context_t with its function as index into event_fire[].
+typedef struct
+{
+  qword cycles;
+  int fire, arg;
+} saved_event_t;
+
+static void (*const event_fire[]) (context_t*, int) =
+  {
+    irq_raise, timer_event, usart_event, eeprom_event
+  };
+
+#define N_EVENT_FIRE (sizeof (event_fire) / sizeof (*event_fire))
+
+// The checkpoints of a context, allocated by checkpoint_open().
+struct checkpoint
+{
+  // The hash of the program file.
+  qword image;
+
+  // The ELF symbols for checkpoint_begin(), cf. checkpoint_symbol().
+  const char *strtab;
+  size_t strtab_size;
+  unsigned entry;
+  int n_entries, n_symbols;
+  saved_symbol_t *symbol;
+
+  // The file that checkpoint_begin() writes to.
+  const char *name;
+  FILE *out;
+
+  // The sections of the file from -restore=, cf. read_checkpoint().
+  struct
+  {
+    const char *tag;
+    size_t size, packed;
+    const byte *data;
+  } section[MAX_SECTIONS];
+  int n_sections;
+};
+
+
+// FNV-1a of the program file.
+
+static qword
+hash_file (context_t *cx, const char *name)
+{
+  FILE *f = get_file (cx, name, "rb");
+  if (!f)
+    leave (cx, LEAVE_IO, "can't find or read program file");
+
+  byte *buf = get_mem (cx, 1 << 16, 1, "checkpoint");
+  qword h = 0xcbf29ce484222325;
+  size_t n;
+  while ((n = fread (buf, 1, 1 << 16, f)) > 0)
+    for (size_t i = 0; i < n; i++)
+      h = (h ^ buf[i]) * 0x100000001b3;
+
+  if (ferror (f))
+    leave (cx, LEAVE_IO, "can't find or read program file");
+  put_mem (cx, buf);
+  put_file (cx, f);
+  return h;
+}
+
+static size_t
+flash_size (const context_t *cx)
+{
+  return 2 * (cx->pc_mask + 1);
+}
+
+// Whether checkpoints are to be written.
+
+static bool
+writes_checkpoints (const context_t *cx)
+{
+  return cx->options.do_checkpoint_at || cx->options.do_checkpoint_every;
+}
+
+// Compress N bytes from IN[] to OUT[] which must have room for
+// N + N / 128 + 1 bytes, and return the packed size.  Like PackBits, a
+// control byte C < 128 is followed by C + 1 literal bytes, and C >= 128
+// by one byte that is repeated C - 126 times.  Much of a memory image
+// is usually 0 or 0xff, hence this does well enough.
+
+static size_t
+pack (byte *out, const byte *in, size_t n)
+{
+  size_t o = 0;
+
+  for (size_t i = 0; i < n; )
+    {
+      size_t r = 1;
+      while (i + r < n && r < 129 && in[i + r] == in[i])
+        r++;
+      if (r >= 3)
+        {
+          out[o++] = 126 + r;
+          out[o++] = in[i];
+          i += r;
+          continue;
+        }
+
+      // Literals up to the next run of 3 equal bytes.
+      size_t l = 0;
+      while (i + l < n && l < 128
+             && ! (i + l + 2 < n
+                   && in[i + l] == in[i + l + 1]
+                   && in[i + l] == in[i + l + 2]))
+        l++;
+      out[o++] = l - 1;
+      memcpy (out + o, in + i, l);
+      o += l;
+      i += l;
+    }
+
+  return o;
+}
+
+// Expand LEN packed bytes from IN[] to exactly N bytes in OUT[].
+
+static bool
+unpack (byte *out, size_t n, const byte *in, size_t len)
+{
+  size_t o = 0;
+
+  for (size_t i = 0; i < len; )
+    {
+      int c = in[i++];
+      size_t r = c < 128 ? (size_t) c + 1 : (size_t) c - 126;
+      if (o + r > n
+          || i + (c < 128 ? r : 1) > len)
+        return false;
+      if (c < 128)
+        {
+          memcpy (out + o, in + i, r);
+          i += r;
+        }
+      else
+        memset (out + o, in[i++], r);
+      o += r;
+    }
+
+  return o == n;
+}
+
+static void
+put_u32 (FILE *out, dword x)
+{
+  byte b[4] = { x, x >> 8, x >> 16, x >> 24 };
+  fwrite (b, 1, sizeof (b), out);
+}
+
+static dword
+get_u32 (const byte *b)
+{
+  return b[0] | (b[1] << 8) | (b[2] << 16) | ((dword) b[3] << 24);
+}
+
+static void
+put_section (context_t *cx, const char *tag, const void *p, size_t n)
+{
+  const struct checkpoint *ck = cx->checkpoint;
+  byte *packed = get_mem (cx, n + n / 128 + 1, 1, "checkpoint");
+  size_t len = pack (packed, p, n);
+
+  fwrite (tag, 1, 1 + strlen (tag), ck->out);
+  put_u32 (ck->out, n);
+  put_u32 (ck->out, len);
+  fwrite (packed, 1, len, ck->out);
+  put_mem (cx, packed);
+}
+
+// Read the sections of the -restore= file.
+
+static void
+read_checkpoint (context_t *cx, const char *file)
+{
+  struct checkpoint *ck = cx->checkpoint;
+  FILE *f = get_file (cx, file, "rb");
+  long size;
+  if (!f
+      || fseek (f, 0, SEEK_END) < 0
+      || (size = ftell (f)) < 0
+      || fseek (f, 0, SEEK_SET) < 0)
+    leave (cx, LEAVE_IO, "cannot read -restore=%s", file);
+
+  byte *buf = get_mem (cx, size + 1, 1, "checkpoint");
+  if (fread (buf, 1, size, f) != (size_t) size)
+    leave (cx, LEAVE_IO, "cannot read -restore=%s", file);
+  put_file (cx, f);
+
+  const byte *p = buf, *end = buf + size;
+  size_t magic = sizeof (CHECKPOINT_MAGIC);
+
+  if (end - p < (long) magic + 4
+      || memcmp (p, CHECKPOINT_MAGIC, magic) != 0)
+    leave (cx, LEAVE_USAGE, "-restore=%s is no checkpoint", file);
+  p += magic;
+  if (get_u32 (p) != CHECKPOINT_VERSION)
+    leave (cx, LEAVE_USAGE, "-restore=%s has version %u, but avrtest needs %u",
+           file, get_u32 (p), CHECKPOINT_VERSION);
+  p += 4;
+
+  while (p < end && *p)
+    {
+      const byte *nul = memchr (p, '\0', end - p < MAX_TAG
+                                ? end - p : MAX_TAG);
+      if (!nul || end - nul < 9 || ck->n_sections == MAX_SECTIONS)
+        leave (cx, LEAVE_USAGE, "-restore=%s is corrupt", file);
+
+      __typeof__ (ck->section[0]) *s = & ck->section[ck->n_sections++];
+      s->tag = (const char*) p;
+      s->size = get_u32 (nul + 1);
+      s->packed = get_u32 (nul + 5);
+      s->data = nul + 9;
+      if ((size_t) (end - s->data) < s->packed)
+        leave (cx, LEAVE_USAGE, "-restore=%s is corrupt", file);
+      p = s->data + s->packed;
+    }
+
+  if (p == end)
+    leave (cx, LEAVE_USAGE, "-restore=%s is truncated", file);
+}
+
+// Transfer the N bytes at P to the checkpoint under TAG, or get them
+// back from the -restore= file if RESTORE.  Return false if the file
+// has no such section, in which case P[] is left alone.
+
+bool
+checkpoint_data (context_t *cx, bool restore, const char *tag, void *p,
+                 size_t n)
+{
+  const struct checkpoint *ck = cx->checkpoint;
+
+  if (!restore)
+    {
+      put_section (cx, tag, p, n);
+      return true;
+    }
+
+  for (int i = 0; i < ck->n_sections; i++)
+    if (str_eq (ck->section[i].tag, tag))
+      {
+        if (ck->section[i].size != n
+            || !unpack (p, n, ck->section[i].data, ck->section[i].packed))
+          leave (cx, LEAVE_USAGE, "-restore=%s: bad section %s",
+                 cx->options.s_restore, tag);
+        return true;
+      }
+
+  return false;
+}
+
+static void
+restore_data (context_t *cx, const char *tag, void *p, size_t n)
+{
+  if (!checkpoint_data (cx, true, tag, p, n))
+    leave (cx, LEAVE_USAGE, "-restore=%s has no section %s",
+           cx->options.s_restore, tag);
+}
+
+// Write the checkpoint to a temporary file first so that an interrupted
+// write does not destroy the previous checkpoint.
+
+void
+checkpoint_begin (context_t *cx)
+{
+  struct checkpoint *ck = cx->checkpoint;
+  char *tmp = get_mem (cx, strlen (ck->name) + 5, 1, "checkpoint");
+  sprintf (tmp, "%s.tmp", ck->name);
+  ck->out = get_file (cx, tmp, "wb");
+  if (!ck->out)
+    leave (cx, LEAVE_IO, "cannot write checkpoint %s", tmp);
+  put_mem (cx, tmp);
+
+  fwrite (CHECKPOINT_MAGIC, 1, sizeof (CHECKPOINT_MAGIC), ck->out);
+  put_u32 (ck->out, CHECKPOINT_VERSION);
+
+  const program_t *prog = & cx->program;
+  state_t st;
+  memset (&st, 0, sizeof (st));
+  strncpy (st.arch, cx->arch.name, sizeof (st.arch) - 1);
+  strncpy (st.device, cx->device.name, sizeof (st.device) - 1);
+  st.image = ck->image;
+  st.pc = cx->pc;
+  st.code_start = prog->code_start;
+  st.code_end = prog->code_end;
+  st.size = prog->size;
+  st.n_bytes = prog->n_bytes;
+  st.entry_point = prog->entry_point;
+  st.n_insns = prog->n_insns;
+  st.n_cycles = prog->n_cycles;
+  st.n_sleep_cycles = prog->n_sleep_cycles;
+  st.reti_cycles = cx->reti_cycles;
+  st.usart_received = usarts_received (cx);
+  st.strtab_size = ck->strtab ? ck->strtab_size : 0;
+  st.entry = ck->entry;
+  st.n_entries = ck->n_entries;
+  st.n_symbols = ck->n_symbols;
+
+  saved_event_t ev[MAX_EVENTS];
+  memset (ev, 0, sizeof (ev));
+  for (int i = 0; i < cx->n_events; i++)
+    {
+      const event_t *e = & cx->event[i];
+      unsigned f = 0;
+      while (f < N_EVENT_FIRE && event_fire[f] != e->fire)
+        f++;
+      if (f == N_EVENT_FIRE)
+        leave (cx, LEAVE_FATAL, "checkpoint: unknown event");
+      ev[st.n_events++] = (saved_event_t) { e->cycles, f, e->arg };
+    }
+
+  put_section (cx, "state", &st, sizeof (st));
+  put_section (cx, "events", ev, sizeof (ev));
+  put_section (cx, "irq", cx->irq_pending, sizeof (cx->irq_pending));
+  put_section (cx, "reg", cx->reg, sizeof (cx->reg));
+  put_section (cx, "data", cx->data, cx->ram_end + 1);
+  if (cx->device.eeprom_size)
+    put_section (cx, "eeprom", cx->eeprom, cx->device.eeprom_size);
+  put_section (cx, "flash", cx->flash, flash_size (cx));
+  put_section (cx, "spm", cx->spm_buffer, sizeof (cx->spm_buffer));
+  put_section (cx, "timer", cx->timer, sizeof (cx->timer));
+  put_section (cx, "usart", cx->usart, sizeof (cx->usart));
+  put_section (cx, "nvm", &cx->nvm, sizeof (cx->nvm));
+  put_section (cx, "syscalls", cx->have_syscall, sizeof (cx->have_syscall));
+
+  unsigned n_insns = cx->pc_mask + 1;
+  saved_insn_t *insn = get_mem (cx, n_insns, sizeof (saved_insn_t),
+                                "checkpoint");
+  for (unsigned i = 0; i < n_insns; i++)
+    {
+      const decoded_t *d = & cx->decoded[i];
+      insn[i] = (saved_insn_t) { d->id, d->size, d->op1, d->block_insns,
+                                 d->op2, d->block_cycles };
+    }
+  put_section (cx, "decoded", insn, n_insns * sizeof (saved_insn_t));
+  put_mem (cx, insn);
+
+  if (ck->strtab)
+    {
+      put_section (cx, "strtab", ck->strtab, ck->strtab_size);
+      put_section (cx, "symbols", ck->symbol,
+                   ck->n_symbols * sizeof (saved_symbol_t));
+    }
+
+  if (cx->far)
+    {
+      // A bitmap of the pages of external memory in use, and their
+      // contents in one go.
+      byte map[N_FAR_PAGES / 8];
+      unsigned n_pages = 0;
+      memset (map, 0, sizeof (map));
+      for (unsigned i = 0; i < N_FAR_PAGES; i++)
+        if (cx->far[i])
+          {
+            map[i / 8] |= 1 << (i % 8);
+            n_pages++;
+          }
+
+      byte *far = get_mem (cx, n_pages ? n_pages : 1, FAR_PAGE_SIZE,
+                           "checkpoint");
+      for (unsigned i = 0, k = 0; i < N_FAR_PAGES; i++)
+        if (cx->far[i])
+          memcpy (far + FAR_PAGE_SIZE * k++, cx->far[i], FAR_PAGE_SIZE);
+      put_section (cx, "far-map", map, sizeof (map));
+      put_section (cx, "far", far, n_pages * FAR_PAGE_SIZE);
+      put_mem (cx, far);
+    }
+}
+
+// Tell execute() when to write the next checkpoint.
+
+static void
+schedule (context_t *cx)
+{
+  qword now = cx->program.n_cycles;
+  qword at = (qword) -1;
+
+  if (cx->options.do_checkpoint_at && cx->options.checkpoint_at > now)
+    at = cx->options.checkpoint_at;
+
+  if (cx->options.do_checkpoint_every && cx->options.checkpoint_every)
+    {
+      qword every = cx->options.checkpoint_every;
+      qword next = (now / every + 1) * every;
+      at = next < at ? next : at;
+    }
+
+  event_checkpoint (cx, at);
+}
+
+// The sections of avrtest_log have been added:  Finish the file and
+// replace the previous checkpoint.
+
+void
+checkpoint_end (context_t *cx)
+{
+  struct checkpoint *ck = cx->checkpoint;
+  char *tmp = get_mem (cx, strlen (ck->name) + 5, 1, "checkpoint");
+  sprintf (tmp, "%s.tmp", ck->name);
+
+  fputc ('\0', ck->out);
+  bool bad = ferror (ck->out);
+  bad |= put_file (cx, ck->out) != 0;
+  ck->out = NULL;
+
+  if (bad || rename (tmp, ck->name) != 0)
+    leave (cx, LEAVE_IO, "cannot write checkpoint %s", ck->name);
+  put_mem (cx, tmp);
+
+  if (cx->options.do_verbose)
+    qprintf (cx, "checkpoint %s at cycle %" PRIu64 "\n", ck->name,
+             cx->program.n_cycles);
+
+  schedule (cx);
+}
+
+// Hand the ELF symbols of the checkpoint to the modules like
+// load_symbol_string_table() does.
+
+static void
+restore_symbols (context_t *cx, const state_t *st)
+{
+  if (!st->strtab_size)
+    {
+      // avrtest wrote the checkpoint for a program without symbols.
+      if (is_avrtest_log)
+        {
+          char *stab = get_mem (cx, 1, sizeof (char), "string table");
+          set_elf_string_table (cx, stab, 1, 0);
+          finish_elf_string_table (cx);
+        }
+      return;
+    }
+
+  if (st->n_symbols < 0 || st->n_symbols > st->n_entries)
+    leave (cx, LEAVE_USAGE, "-restore=%s: bad section symbols",
+           cx->options.s_restore);
+
+  char *strtab = get_mem (cx, st->strtab_size, sizeof (char),
+                          "ELF string table");
+  saved_symbol_t *sym = get_mem (cx, st->n_symbols, sizeof (saved_symbol_t),
+                                 "checkpoint");
+  restore_data (cx, "strtab", strtab, st->strtab_size);
+  restore_data (cx, "symbols", sym, st->n_symbols * sizeof (saved_symbol_t));
+
+  set_elf_string_table (cx, strtab, st->strtab_size, st->n_entries);
+  for (int i = 0; i < st->n_symbols; i++)
+    {
+      if (sym[i].offset >= st->strtab_size)
+        leave (cx, LEAVE_USAGE, "-restore=%s: bad section symbols",
+               cx->options.s_restore);
+      set_elf_function_symbol (cx, sym[i].addr, sym[i].offset,
+                               sym[i].is_func);
+    }
+  finish_elf_string_table (cx);
+  put_mem (cx, sym);
+}
+
+// Resume from the checkpoint in the -restore= file in place of loading
+// and decoding the program.
+
+static void
+restore (context_t *cx, const char *file)
+{
+  read_checkpoint (cx, file);
+
+  state_t st;
+  restore_data (cx, "state", &st, sizeof (st));
+  if (!str_eq (st.arch, cx->arch.name)
+      || !str_eq (st.device, cx->device.name))
+    leave (cx, LEAVE_USAGE, "-restore=%s is for -mmcu=%s, not for -mmcu=%s",
+           file, st.device, cx->device.name);
+  if (st.image != cx->checkpoint->image)
+    leave (cx, LEAVE_USAGE, "-restore=%s is for another program", file);
+
+  program_t *prog = & cx->program;
+  prog->code_start = st.code_start;
+  prog->code_end = st.code_end;
+  prog->size = st.size;
+  prog->n_bytes = st.n_bytes;
+  prog->entry_point = st.entry_point;
+
+  // The modules get the symbols with PC where the loader left it.
+  cx->pc = st.entry;
+  restore_symbols (cx, &st);
+
+  cx->pc = st.pc;
+  prog->n_insns = st.n_insns;
+  prog->n_cycles = st.n_cycles;
+  prog->n_sleep_cycles = st.n_sleep_cycles;
+
+  restore_data (cx, "reg", cx->reg, sizeof (cx->reg));
+  restore_data (cx, "data", cx->data, cx->ram_end + 1);
+  if (cx->device.eeprom_size)
+    restore_data (cx, "eeprom", cx->eeprom, cx->device.eeprom_size);
+  restore_data (cx, "flash", cx->flash, flash_size (cx));
+  restore_data (cx, "spm", cx->spm_buffer, sizeof (cx->spm_buffer));
+  restore_data (cx, "timer", cx->timer, sizeof (cx->timer));
+  restore_data (cx, "usart", cx->usart, sizeof (cx->usart));
+  restore_data (cx, "nvm", &cx->nvm, sizeof (cx->nvm));
+  restore_data (cx, "syscalls", cx->have_syscall,
+                sizeof (cx->have_syscall));
+
+  unsigned n_insns = cx->pc_mask + 1;
+  saved_insn_t *insn = get_mem (cx, n_insns, sizeof (saved_insn_t),
+                                "checkpoint");
+  restore_data (cx, "decoded", insn, n_insns * sizeof (saved_insn_t));
+  for (unsigned i = 0; i < n_insns; i++)
+    {
+      const saved_insn_t *si = &insn[i];
+      if (si->id >= N_OPCODES)
+        leave (cx, LEAVE_USAGE, "-restore=%s: bad section decoded", file);
+      cx->decoded[i] = (decoded_t) { NULL, si->id, si->size, si->op1,
+                                     si->block_insns, si->op2,
+                                     si->block_cycles };
+    }
+  put_mem (cx, insn);
+
+  if (cx->far)
+    {
+      byte map[N_FAR_PAGES / 8];
+      unsigned n_pages = 0;
+      restore_data (cx, "far-map", map, sizeof (map));
+      for (unsigned i = 0; i < N_FAR_PAGES; i++)
+        n_pages += (map[i / 8] >> (i % 8)) & 1;
+
+      byte *far = get_mem (cx, n_pages ? n_pages : 1, FAR_PAGE_SIZE,
+                           "checkpoint");
+      restore_data (cx, "far", far, n_pages * FAR_PAGE_SIZE);
+      for (unsigned i = 0, k = 0; i < N_FAR_PAGES; i++)
+        if ((map[i / 8] >> (i % 8)) & 1)
+          {
+            cx->far[i] = get_mem (cx, FAR_PAGE_SIZE, 1, "external memory");
+            memcpy (cx->far[i], far + FAR_PAGE_SIZE * k++, FAR_PAGE_SIZE);
+          }
+      put_mem (cx, far);
+    }
+
+  saved_event_t ev[MAX_EVENTS];
+  restore_data (cx, "events", ev, sizeof (ev));
+  if (st.n_events < 0 || st.n_events > MAX_EVENTS)
+    leave (cx, LEAVE_USAGE, "-restore=%s: bad section events", file);
+  events_init (cx);
+  for (int i = 0; i < st.n_events; i++)
+    {
+      if (ev[i].fire < 0 || ev[i].fire >= (int) N_EVENT_FIRE)
+        leave (cx, LEAVE_USAGE, "-restore=%s: bad section events", file);
+      event_schedule (cx, ev[i].cycles, event_fire[ev[i].fire], ev[i].arg);
+    }
+  restore_data (cx, "irq", cx->irq_pending, sizeof (cx->irq_pending));
+  cx->reti_cycles = st.reti_cycles;
+
+  usarts_skip (cx, st.usart_received);
+}
+
+// Before the program is loaded:  Hash the program file for -restore=
+// and for the checkpoints to write.
+
+void
+checkpoint_open (context_t *cx)
+{
+  struct checkpoint *ck = cx->checkpoint
+    = get_mem (cx, 1, sizeof (struct checkpoint), "checkpoint");
+
+  if (cx->options.do_checkpoint)
+    ck->name = cx->options.s_checkpoint;
+  else
+    {
+      char *s = get_mem (cx, strlen (cx->program.name) + 6, 1,
+                         "checkpoint");
+      sprintf (s, "%s.ckpt", cx->program.name);
+      ck->name = s;
+    }
+
+  if (cx->options.do_restore && cx->options.do_replay)
+    leave (cx, LEAVE_USAGE, "-restore= and -replay= exclude each other");
+
+  if (cx->options.do_restore || writes_checkpoints (cx))
+    ck->image = hash_file (cx, cx->program.name);
+}
+
+// The program has been loaded unless -restore= is on:  Resume from
+// -restore=FILE, and schedule the first checkpoint.
+
+void
+checkpoint_resume (context_t *cx)
+{
+  if (cx->options.do_restore)
+    restore (cx, cx->options.s_restore);
+
+  schedule (cx);
+}
+
+// The ELF loader has read the string table STAB of SIZE bytes with
+// N_ENTRIES symbols, cf. set_elf_string_table().  Keep it together with
+// the symbols from checkpoint_symbol() for checkpoint_begin().
+
+void
+checkpoint_string_table (context_t *cx, const char *stab, size_t size,
+                         int n_entries)
+{
+  struct checkpoint *ck = cx->checkpoint;
+  if (!writes_checkpoints (cx))
+    return;
+
+  ck->strtab = stab;
+  ck->strtab_size = size;
+  ck->entry = cx->pc;
+  ck->n_entries = n_entries;
+  ck->n_symbols = 0;
+  ck->symbol = get_mem (cx, n_entries, sizeof (saved_symbol_t),
+                        "checkpoint");
+}
+
+void
+checkpoint_symbol (context_t *cx, int addr, size_t offset, bool is_func)
+{
+  struct checkpoint *ck = cx->checkpoint;
+  if (ck->strtab && ck->n_symbols < ck->n_entries)
+    ck->symbol[ck->n_symbols++] = (saved_symbol_t) { addr, offset, is_func };
+}
@@ -0,0 +1,38 @@
+/*
+  This file is part of avrtest -- A simple simulator for the
+  Atmel AVR family of microcontrollers designed to test the compiler.
+
+  Copyright (C) 2001, 2002, 2003   Theodore A. Roth, Klaus Rudolph
+  Copyright (C) 2007 Paulo Marques
+  Copyright (C) 2008-2026 Free Software Foundation, Inc.
+
+  avrtest is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 2 of the License, or
+  (at your option) any later version.
+
+  avrtest is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with avrtest; see the file COPYING.  If not, write to
+  the Free Software Foundation, 59 Temple Place - Suite 330,
+  Boston, MA 02111-1307, USA.  */
+
+#ifndef CHECKPOINT_H
+#define CHECKPOINT_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+extern void checkpoint_open (context_t*);
+extern void checkpoint_resume (context_t*);
+extern void checkpoint_string_table (context_t*, const char*, size_t, int);
+extern void checkpoint_symbol (context_t*, int, size_t, bool);
+extern void checkpoint_begin (context_t*);
+extern void checkpoint_end (context_t*);
+extern bool checkpoint_data (context_t*, bool, const char*, void*, size_t);
+
+#endif // CHECKPOINT_H
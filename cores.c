@@ -0,0 +1,180 @@
+/*
+  This file is part of avrtest -- A simple simulator for the
+  Atmel AVR family of microcontrollers designed to test the compiler.
+
+  Copyright (C) 2001, 2002, 2003   Theodore A. Roth, Klaus Rudolph
+  Copyright (C) 2007 Paulo Marques
+  Copyright (C) 2008-2026 Free Software Foundation, Inc.
+
+  avrtest is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 2 of the License, or
+  (at your option) any later version.
+
+  avrtest is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with avrtest; see the file COPYING.  If not, write to
+  the Free Software Foundation, 59 Temple Place - Suite 330,
+  Boston, MA 02111-1307, USA.  */
+
+// The avrtest executable contains all six simulators:  avrtest.c is
+// compiled once per variant and linked with its objects into a core
+// which only exports its main and its job_main, see core_main and
+// core_job in Makefile.  The code below picks one of them before
+// anything else happens, hence the instruction set is still fixed at
+// compile time in each core.
+
+#include <stdbool.h>
+#include <string.h>
+
+#include "server.h"
+
+extern int avrtest_main (int, char*[]);
+extern int avrtest_log_main (int, char*[]);
+extern int avrtest_xmega_main (int, char*[]);
+extern int avrtest_xmega_log_main (int, char*[]);
+extern int avrtest_tiny_main (int, char*[]);
+extern int avrtest_tiny_log_main (int, char*[]);
+
+extern job_main_t avrtest_job, avrtest_log_job;
+extern job_main_t avrtest_xmega_job, avrtest_xmega_log_job;
+extern job_main_t avrtest_tiny_job, avrtest_tiny_log_job;
+
+enum
+  {
+    CORE_AVR, CORE_XMEGA, CORE_TINY
+  };
+
+static int (*const core_main[][2]) (int, char*[]) =
+  {
+    [CORE_AVR]   = { avrtest_main,       avrtest_log_main },
+    [CORE_XMEGA] = { avrtest_xmega_main, avrtest_xmega_log_main },
+    [CORE_TINY]  = { avrtest_tiny_main,  avrtest_tiny_log_main }
+  };
+
+static job_main_t *const core_job[][2] =
+  {
+    [CORE_AVR]   = { avrtest_job,       avrtest_log_job },
+    [CORE_XMEGA] = { avrtest_xmega_job, avrtest_xmega_log_job },
+    [CORE_TINY]  = { avrtest_tiny_job,  avrtest_tiny_log_job }
+  };
+
+// The cores that can run an ARCH from -mmcu=ARCH.  Keep in sync with
+// arch_desc[] in options.c.
+static const struct
+{
+  const char *name;
+  int core;
+} arch_core[] =
+  {
+    { "avr51",     CORE_AVR },
+    { "avr6",      CORE_AVR },
+    { "avrxmega6", CORE_XMEGA },
+    { "avrxmega7", CORE_XMEGA },
+    { "avrtiny",   CORE_TINY },
+    { NULL, 0 }
+  };
+
+// The devices from -mmcu=DEVICE and the ARCH they run as.
+static const struct
+{
+  const char *name;
+  const char *arch;
+} device_arch[] =
+  {
+#define AVR_DEVICE(NAME, ARCH, RAM_START, RAM_END, FLASH, EEPROM, LAYOUT, \
+                   SE)                                                  \
+    { #NAME, #ARCH },
+#include "avr-device.def"
+#undef AVR_DEVICE
+    { NULL, NULL }
+  };
+
+
+// Find the core as of -log, -mmcu= and the name avrtest was invoked by.
+// Set *LOG to whether it is a logging core.
+
+static int
+pick_core (int argc, char *argv[], bool *log)
+{
+  // The default core follows the name avrtest was invoked by, like
+  // avrtest-xmega_log or avrtest_log.exe.  So does whether to log, for
+  // backward compatibility:  Otherwise, -log selects a logging core.
+  const char *self = argv[0] ? argv[0] : "avrtest";
+  const char *p;
+  if ((p = strrchr (self, '/')))
+    self = p + 1;
+  if ((p = strrchr (self, '\\')))
+    self = p + 1;
+
+  *log = strstr (self, "_log") != NULL;
+  int core_default = strstr (self, "-xmega") ? CORE_XMEGA
+    : strstr (self, "-tiny") ? CORE_TINY
+    : CORE_AVR;
+  int core = core_default;
+
+  // -mmcu=ARCH or -mmcu=DEVICE overrides that, the last one wins just
+  // like in options.c.  An unknown MCU is diagnosed by the default core.
+  for (int i = 1; i < argc; i++)
+    if (strcmp (argv[i], "-args") == 0)
+      break;
+    else if (strcmp (argv[i], "-log") == 0)
+      *log = true;
+    else if (strncmp (argv[i], "-no-mmcu=", strlen ("-no-mmcu=")) == 0)
+      core = core_default;
+    else if (strncmp (argv[i], "-mmcu=", strlen ("-mmcu=")) == 0)
+      {
+        const char *mcu = argv[i] + strlen ("-mmcu=");
+        for (int d = 0; device_arch[d].name; d++)
+          if (strcmp (mcu, device_arch[d].name) == 0)
+            mcu = device_arch[d].arch;
+        for (int a = 0; arch_core[a].name; a++)
+          if (strcmp (mcu, arch_core[a].name) == 0)
+            core = arch_core[a].core;
+      }
+
+  return core;
+}
+
+
+// Run the core picked by pick_core().
+
+static int
+run_core (int argc, char *argv[])
+{
+  bool log;
+  int core = pick_core (argc, argv, &log);
+  return core_main[core][log] (argc, argv);
+}
+
+
+// -batch:  Run a job in the core picked by pick_core().
+
+static int
+run_job (int argc, char *argv[], FILE *in, FILE *out, FILE *err,
+         job_result_t *result)
+{
+  bool log;
+  int core = pick_core (argc, argv, &log);
+  return core_job[core][log] (argc, argv, in, out, err, result);
+}
+
+
+int
+main (int argc, char *argv[])
+{
+  // -server runs each job in a fork, and -batch in a thread, that
+  // picks its own core.
+  for (int i = 1; i < argc; i++)
+    if (strcmp (argv[i], "-args") == 0)
+      break;
+    else if (strcmp (argv[i], "-server") == 0
+             || strcmp (argv[i], "-batch") == 0)
+      return server_main (argc, argv, run_core, run_job);
+
+  return run_core (argc, argv);
+}
@@ -72,7 +72,9 @@ avrtest_init_argc_argv (void)
      -args ... from avrtest.  There's plenty of RAM in the simulator.
      The linker will never see that big address and hence won't complain.
 
-     If you prefer a more common address, e.g. just after static storage
+     The arguments must fit in the RAM of the simulated device, though.
+     This is the case with -mmcu=ARCH.  With -mmcu=DEVICE, or if you
+     prefer a more common address, e.g. just after static storage
      (after .data and .bss) you can change the address to __heap_start:
 
       extern void *__heap_start[];
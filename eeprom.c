@@ -0,0 +1,521 @@
+/*
+  This file is part of avrtest -- A simple simulator for the
+  Atmel AVR family of microcontrollers designed to test the compiler.
+
+  Copyright (C) 2001, 2002, 2003   Theodore A. Roth, Klaus Rudolph
+  Copyright (C) 2007 Paulo Marques
+  Copyright (C) 2008-2026 Free Software Foundation, Inc.
+
+  avrtest is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 2 of the License, or
+  (at your option) any later version.
+
+  avrtest is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with avrtest; see the file COPYING.  If not, write to
+  the Free Software Foundation, 59 Temple Place - Suite 330,
+  Boston, MA 02111-1307, USA.  */
+
+/* EEPROM model.
+
+   The EEPROM of megaAVR devices like ATmega328P as accessed by EEAR,
+   EEDR and EECR, and the EEPROM commands of the NVM controller of XMEGA
+   devices.  A write changes cx->eeprom[] right away, but EEPE resp.
+   NVMBUSY stay set for the write time, and the EEPROM can't be accessed
+   again until then.  Like the timers, the EEPROM is not ticked:  Only
+   when its interrupt is enabled, an event is scheduled for the end of
+   the write.
+
+   With -eeprom=FILE, cx->eeprom[] is a shared mapping of FILE so that
+   the EEPROM persists across runs.  It is synced to FILE when the
+   program leaves.
+
+   Not modelled:  Lock bits, CCP, EEPROM power reduction, and the
+   interrupt levels of XMEGA.  The write times of the datasheets are
+   converted to cycles at EEPROM_F_CPU.  */
+
+// For ftruncate with -std=c99.
+#define _DEFAULT_SOURCE
+
+#include <stdio.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#ifndef _WIN32
+#include <sys/mman.h>
+#endif
+
+#include "testavr.h"
+#include "options.h"
+#include "irq.h"
+#include "periph.h"
+#include "replay.h"
+
+#define EEPROM_F_CPU 16000000
+#define MS(X) ((qword) ((X) * EEPROM_F_CPU / 1000))
+
+// Bits of EECR.
+#define EERE   0x01
+#define EEPE   0x02
+#define EEMPE  0x04
+#define EERIE  0x08
+#define EEPM   0x30
+
+// XMEGA NVM controller:  Registers, bits and EEPROM commands.
+#define NVM_ADDR0   0x1c0
+#define NVM_DATA0   0x1c4
+#define NVM_CMD     0x1ca
+#define NVM_CTRLA   0x1cb
+#define NVM_INTCTRL 0x1cd
+#define NVM_STATUS  0x1cf
+
+#define NVM_CMDEX   0x01
+#define NVM_EELVL   0x03
+#define NVM_BUSY    0x80
+#define NVM_EELOAD  0x02
+
+enum
+  {
+    CMD_READ_EEPROM = 0x06,
+    CMD_ERASE_EEPROM = 0x30,
+    CMD_ERASE_EEPROM_PAGE = 0x32,
+    CMD_LOAD_EEPROM_BUFFER = 0x33,
+    CMD_WRITE_EEPROM_PAGE = 0x34,
+    CMD_ERASE_WRITE_EEPROM_PAGE = 0x35,
+    CMD_ERASE_EEPROM_BUFFER = 0x36
+  };
+
+// Where the registers of the EEPROM are.  For megaAVR, the data
+// addresses of EECR, EEDR and EEARL.  For XMEGA, the NVM_* above.
+
+typedef struct eeprom_desc
+{
+  bool xmega;
+  int eecr, eedr, eear;
+  // The vector of EE_READY resp. NVM_EE.
+  int vec;
+} eeprom_desc_t;
+
+#define EEPROM_MEGA(VEC) { false, 0x3f, 0x40, 0x41, VEC }
+
+static const eeprom_desc_t eeprom_mx8 = EEPROM_MEGA (22);
+static const eeprom_desc_t eeprom_m1284 = EEPROM_MEGA (25);
+static const eeprom_desc_t eeprom_m2560 = EEPROM_MEGA (30);
+static const eeprom_desc_t eeprom_xmega = { true, 0, 0, 0, 32 };
+
+
+static bool
+busy (const context_t *cx, qword now)
+{
+  return now < cx->nvm.busy_until;
+}
+
+static bool
+irq_enabled (const context_t *cx)
+{
+  return cx->eeprom_desc->xmega
+    ? cx->data[NVM_INTCTRL] & NVM_EELVL
+    : cx->data[cx->eeprom_desc->eecr] & EERIE;
+}
+
+static void eeprom_update (context_t*, qword);
+
+void
+eeprom_event (context_t *cx, int arg)
+{
+  cx->nvm.scheduled = false;
+  eeprom_update (cx, cx->program.n_cycles);
+}
+
+// EE_READY resp. NVM_EE is raised while the EEPROM is ready and its
+// interrupt is enabled.  If it is enabled but busy, schedule an event
+// for the end of the write.
+
+static void
+eeprom_update (context_t *cx, qword now)
+{
+  if (cx->nvm.scheduled)
+    {
+      event_cancel (cx, eeprom_event, 0);
+      cx->nvm.scheduled = false;
+    }
+
+  if (irq_enabled (cx) && !busy (cx, now))
+    irq_raise (cx, cx->eeprom_desc->vec);
+  else
+    irq_clear (cx, cx->eeprom_desc->vec);
+
+  if (irq_enabled (cx) && busy (cx, now))
+    {
+      event_schedule (cx, cx->nvm.busy_until, eeprom_event, 0);
+      cx->nvm.scheduled = true;
+    }
+}
+
+
+// megaAVR:  EEAR masked to the size of the EEPROM.
+
+static unsigned
+eear (const context_t *cx)
+{
+  const byte *ear = cx->data + cx->eeprom_desc->eear;
+  return (ear[0] | (ear[1] << 8)) & (cx->device.eeprom_size - 1);
+}
+
+// megaAVR:  Write VALUE to EECR at cycle NOW.  Setting EEPE within 4
+// cycles after EEMPE starts the write as of EEPM:  Erase and write in
+// 3.4 ms, or only erase resp. only write in 1.8 ms.  EERE reads EEDR
+// from the EEPROM.
+
+static void
+eecr_write (context_t *cx, int value, qword now)
+{
+  byte *data = cx->data;
+  byte *eecr = & data[cx->eeprom_desc->eecr];
+  avr_nvm_t *nvm = & cx->nvm;
+
+  if (busy (cx, now))
+    value = (value & ~(EEPM | EERE)) | (*eecr & EEPM);
+  *eecr = value & (EEPM | EERIE);
+
+  if ((value & EEPE)
+      && now < nvm->mpe_until
+      && !busy (cx, now))
+    {
+      byte *cell = & cx->eeprom[eear (cx)];
+      int mode = (*eecr & EEPM) >> 4;
+
+      *cell = mode == 1 ? 0xff
+        : mode == 2 ? *cell & data[cx->eeprom_desc->eedr]
+        : data[cx->eeprom_desc->eedr];
+      nvm->busy_until = now + (mode == 0 ? MS (3.4) : MS (1.8));
+      nvm->mpe_until = 0;
+      // The CPU is halted for 2 cycles.
+      cx->program.n_cycles += 2;
+    }
+  else if (value & EEMPE)
+    nvm->mpe_until = now + 4;
+
+  if (value & EERE)
+    {
+      data[cx->eeprom_desc->eedr] = cx->eeprom[eear (cx)];
+      // The CPU is halted for 4 cycles.
+      cx->program.n_cycles += 4;
+    }
+}
+
+
+// XMEGA:  The address from NVM.ADDR, and the page of the EEPROM that
+// holds it.
+
+static unsigned
+nvm_addr (const context_t *cx)
+{
+  const byte *data = cx->data;
+  return ((data[NVM_ADDR0] | (data[NVM_ADDR0 + 1] << 8))
+          & (cx->device.eeprom_size - 1));
+}
+
+static unsigned
+nvm_page (const context_t *cx)
+{
+  return nvm_addr (cx) & ~(MAX_EEPROM_PAGE - 1);
+}
+
+// XMEGA:  Load VALUE to the page buffer at offset ADDR.
+
+static void
+nvm_load (context_t *cx, unsigned addr, int value)
+{
+  int i = addr % MAX_EEPROM_PAGE;
+  cx->nvm.page[i] = value;
+  cx->nvm.loaded |= (dword) 1 << i;
+}
+
+// XMEGA:  Erase and / or write the loaded bytes of the page at PAGE.
+
+static void
+nvm_program (context_t *cx, unsigned page, bool erase, bool write)
+{
+  for (int i = 0; i < MAX_EEPROM_PAGE; i++)
+    if (cx->nvm.loaded & ((dword) 1 << i))
+      {
+        byte *cell = & cx->eeprom[page + i];
+        if (erase)
+          *cell = 0xff;
+        if (write)
+          *cell &= cx->nvm.page[i];
+      }
+}
+
+// XMEGA:  Execute NVM.CMD at cycle NOW as NVM.CTRLA.CMDEX is set.  The
+// commands for the flash are executed by SPM in avrtest.c.  A page is
+// erased or written in 4 ms, erased and written in 8 ms.
+
+static void
+nvm_execute (context_t *cx, qword now)
+{
+  avr_nvm_t *nvm = & cx->nvm;
+  int cmd = cx->data[NVM_CMD];
+
+  if (busy (cx, now))
+    return;
+
+  switch (cmd)
+    {
+    case CMD_READ_EEPROM:
+      cx->data[NVM_DATA0] = cx->eeprom[nvm_addr (cx)];
+      return;
+
+    case CMD_ERASE_EEPROM_BUFFER:
+      nvm->loaded = 0;
+      return;
+
+    case CMD_ERASE_EEPROM:
+      nvm->loaded = ~(dword) 0;
+      for (unsigned p = 0; p < cx->device.eeprom_size; p += MAX_EEPROM_PAGE)
+        nvm_program (cx, p, true, false);
+      break;
+
+    case CMD_ERASE_EEPROM_PAGE:
+    case CMD_WRITE_EEPROM_PAGE:
+    case CMD_ERASE_WRITE_EEPROM_PAGE:
+      nvm_program (cx, nvm_page (cx),
+                   cmd != CMD_WRITE_EEPROM_PAGE,
+                   cmd != CMD_ERASE_EEPROM_PAGE);
+      break;
+
+    default:
+      return;
+    }
+
+  nvm->loaded = 0;
+  nvm->busy_until = now + (cmd == CMD_ERASE_WRITE_EEPROM_PAGE
+                           ? MS (8) : MS (4));
+}
+
+
+// Read EEPROM register ADDR at cycle NOW.
+
+int
+eeprom_read (context_t *cx, int addr, qword now)
+{
+  byte *data = cx->data;
+
+  if (cx->eeprom_desc->xmega)
+    {
+      if (addr == NVM_STATUS)
+        data[addr] = (busy (cx, now) ? NVM_BUSY : 0)
+          | (cx->nvm.loaded ? NVM_EELOAD : 0);
+    }
+  else if (addr == cx->eeprom_desc->eecr)
+    {
+      data[addr] &= EEPM | EERIE;
+      if (busy (cx, now))
+        data[addr] |= EEPE;
+      if (now < cx->nvm.mpe_until)
+        data[addr] |= EEMPE;
+    }
+
+  return data[addr];
+}
+
+// Write VALUE to EEPROM register ADDR at cycle NOW.  While a write is
+// in progress, EEAR resp. NVM.ADDR can't be changed.
+
+void
+eeprom_write (context_t *cx, int addr, int value, qword now)
+{
+  byte *data = cx->data;
+
+  if (cx->eeprom_desc->xmega)
+    {
+      if (addr == NVM_STATUS)
+        return;
+      if (addr >= NVM_ADDR0 && addr < NVM_ADDR0 + 3 && busy (cx, now))
+        return;
+      data[addr] = value;
+      if (addr == NVM_DATA0
+          && data[NVM_CMD] == CMD_LOAD_EEPROM_BUFFER)
+        nvm_load (cx, nvm_addr (cx), value);
+      else if (addr == NVM_CTRLA && (value & NVM_CMDEX))
+        {
+          data[addr] &= ~NVM_CMDEX;
+          nvm_execute (cx, now);
+        }
+    }
+  else if (addr == cx->eeprom_desc->eecr)
+    eecr_write (cx, value, now);
+  else if (addr != cx->eeprom_desc->eedr && busy (cx, now))
+    return;
+  else
+    data[addr] = value;
+
+  eeprom_update (cx, now);
+}
+
+// XMEGA:  ST to the EEPROM mapped at 0x1000.  With LOAD_EEPROM_BUFFER in
+// NVM.CMD this loads the page buffer like on the device, otherwise the
+// EEPROM is written right away.
+
+void
+eeprom_write_mapped (context_t *cx, unsigned addr, int value)
+{
+  if (cx->eeprom_desc && cx->data[NVM_CMD] == CMD_LOAD_EEPROM_BUFFER)
+    nvm_load (cx, addr, value);
+  else
+    cx->eeprom[addr] = value;
+}
+
+
+// The core has vectored to VECTOR.  EE_READY is not cleared by its
+// vector, hence raise it again if the EEPROM is still ready.
+
+void
+eeprom_irq_taken (context_t *cx, int vector)
+{
+  if (cx->eeprom_desc && vector == cx->eeprom_desc->vec)
+    eeprom_update (cx, cx->program.n_cycles);
+}
+
+
+// Hook the registers of the EEPROM of LAYOUT from avr-device.def.
+
+void
+eeprom_map (context_t *cx, int layout)
+{
+  const eeprom_desc_t *eeprom = !cx->device.eeprom_size ? NULL
+    : layout == LAYOUT_MX8 ? & eeprom_mx8
+    : layout == LAYOUT_M1284 ? & eeprom_m1284
+    : layout == LAYOUT_M2560 ? & eeprom_m2560
+    : layout == LAYOUT_XMEGA ? & eeprom_xmega
+    : NULL;
+
+  cx->eeprom_desc = eeprom;
+  if (!eeprom)
+    return;
+
+  int h = PERIPH_EEPROM | 1;
+
+  if (eeprom->xmega)
+    {
+      for (int a = NVM_ADDR0; a < NVM_ADDR0 + 3; a++)
+        cx->periph_hook[a] = h;
+      cx->periph_hook[NVM_DATA0] = h;
+      cx->periph_hook[NVM_CTRLA] = h;
+      cx->periph_hook[NVM_INTCTRL] = h;
+      cx->periph_hook[NVM_STATUS] = h;
+    }
+  else
+    {
+      cx->periph_hook[eeprom->eecr] = h;
+      cx->periph_hook[eeprom->eedr] = h;
+      cx->periph_hook[eeprom->eear] = h;
+      cx->periph_hook[eeprom->eear + 1] = h;
+    }
+}
+
+// Reset the EEPROM controller of CX:  Ready, with an empty page buffer.
+
+void
+eeprom_init (context_t *cx)
+{
+  memset (& cx->nvm, 0, sizeof (cx->nvm));
+}
+
+
+// -eeprom=FILE:  Back the EEPROM of CX by FILE once the program has been
+// loaded.  An existing FILE must have the size of the EEPROM, and its
+// contents replace the .eeprom of the program.  A new FILE starts out
+// with the .eeprom of the program.
+
+void
+eeprom_open (context_t *cx)
+{
+  const options_t *options = & cx->options;
+  if (!options->do_eeprom)
+    return;
+
+  const char *name = options->s_eeprom;
+  unsigned size = cx->device.eeprom_size;
+
+  if (size == 0)
+    leave (cx, LEAVE_USAGE, "-eeprom=%s: %s has no EEPROM", name,
+           cx->device.name);
+
+  // With -replay=, the EEPROM comes from the recording and FILE is
+  // left alone.
+  if (options->do_replay)
+    {
+      replay_memory (cx, REPLAY_EEPROM, cx->eeprom, size);
+      return;
+    }
+
+  // Own FD right away so that eeprom_finish() closes it when we leave.
+  int fd = cx->eeprom_fd = open (name, O_RDWR | O_CREAT, 0666);
+  struct stat st;
+  if (fd < 0 || fstat (fd, &st) < 0)
+    leave (cx, LEAVE_IO, "cannot open -eeprom=%s", name);
+
+  bool fresh = st.st_size == 0;
+  if (!fresh && st.st_size != (off_t) size)
+    leave (cx, LEAVE_USAGE, "-eeprom=%s has %ld bytes but the EEPROM of %s "
+           "has %u", name, (long) st.st_size, cx->device.name, size);
+
+#ifdef _WIN32
+  // No mmap:  Read FILE now and write it back by eeprom_finish().
+  byte *host_map = get_mem (cx, size, sizeof (byte), "-eeprom");
+  if (fresh)
+    memcpy (host_map, cx->eeprom, size);
+  else if (read (fd, host_map, size) != (ssize_t) size)
+    leave (cx, LEAVE_IO, "cannot read -eeprom=%s", name);
+#else
+  if (fresh && ftruncate (fd, size) < 0)
+    leave (cx, LEAVE_IO, "cannot write -eeprom=%s", name);
+
+  byte *host_map = mmap (NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED,
+                         fd, 0);
+  if (host_map == MAP_FAILED)
+    leave (cx, LEAVE_IO, "cannot map -eeprom=%s", name);
+  if (fresh)
+    memcpy (host_map, cx->eeprom, size);
+#endif // _WIN32
+
+  put_mem (cx, cx->eeprom);
+  cx->eeprom = host_map;
+  cx->eeprom_mapped = true;
+  replay_memory (cx, REPLAY_EEPROM, cx->eeprom, size);
+}
+
+// The program is about to leave:  Write the EEPROM back to its FILE.
+
+void
+eeprom_finish (context_t *cx)
+{
+  unsigned size = cx->device.eeprom_size;
+
+  if (cx->eeprom_mapped)
+    {
+#ifdef _WIN32
+      if (lseek (cx->eeprom_fd, 0, SEEK_SET) != 0
+          || write (cx->eeprom_fd, cx->eeprom, size) != (ssize_t) size)
+        fprintf (cx->err, "avrtest: cannot write -eeprom=%s\n",
+                 cx->options.s_eeprom);
+#else
+      msync (cx->eeprom, size, MS_SYNC);
+      munmap (cx->eeprom, size);
+      cx->eeprom = NULL;
+#endif // _WIN32
+      cx->eeprom_mapped = false;
+    }
+
+  if (cx->eeprom_fd >= 0)
+    close (cx->eeprom_fd);
+  cx->eeprom_fd = -1;
+}
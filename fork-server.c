@@ -0,0 +1,238 @@
+/*
+  This file is part of avrtest -- A simple simulator for the
+  Atmel AVR family of microcontrollers designed to test the compiler.
+
+  Copyright (C) 2001, 2002, 2003   Theodore A. Roth, Klaus Rudolph
+  Copyright (C) 2007 Paulo Marques
+  Copyright (C) 2008-2026 Free Software Foundation, Inc.
+
+  avrtest is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 2 of the License, or
+  (at your option) any later version.
+
+  avrtest is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with avrtest; see the file COPYING.  If not, write to
+  the Free Software Foundation, 59 Temple Place - Suite 330,
+  Boston, MA 02111-1307, USA.  */
+
+/* Fork server.
+
+   Runs of the same program repeat loading, decoding and the startup
+   code up to main.  -fork-server[=SYMBOL] does all that once:  It runs
+   the program until it reaches main resp. SYMBOL and then reads runs
+   from stdin, one per line.  Each run is served by a fork of avrtest,
+   which continues the program from the snapshot that fork() took.  The
+   memories of the simulation are shared copy-on-write, so that a run
+   only pays for the pages it writes.
+
+   A line is a list of words separated by blanks.  If the first word is
+   -stdin=FILE, then avrtest_getchar reads FILE, otherwise it reads
+   nothing.  The other words are the arguments of the run that replace
+   the ones after -args.  After a run has finished, the server prints
+   one line "fork-server: run N exit CODE" where CODE is the value that
+   avrtest would have exited with.
+
+   The snapshot is found by polling the program counter after each basic
+   block, cf. event_poll(), which only costs time during startup.  */
+
+// For fork and waitpid with -std=c99.
+#define _DEFAULT_SOURCE
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#ifndef _WIN32
+#include <sys/wait.h>
+#endif
+
+#include "testavr.h"
+#include "options.h"
+#include "irq.h"
+#include "fork-server.h"
+
+struct fork_server
+{
+  // The word address of SYMBOL.
+  int pc;
+
+  // Whether the snapshot is at main, where the arguments are in R24 / R22.
+  bool at_main;
+};
+
+static const char*
+symbol (const context_t *cx)
+{
+  return cx->options.do_fork_symbol ? cx->options.s_fork_symbol : "main";
+}
+
+void
+fork_server_set_function_symbol (context_t *cx, int addr, size_t offset)
+{
+  if (cx->options.do_fork_server
+      && offset < cx->strtab_size
+      && addr % 2 == 0
+      && str_eq (symbol (cx), cx->strtab + offset))
+    {
+      if (!cx->fork_server)
+        cx->fork_server = get_mem (cx, 1, sizeof (struct fork_server),
+                                   "-fork-server");
+      cx->fork_server->pc = addr / 2;
+    }
+}
+
+// The program is loaded:  Have execute() look for the snapshot.
+
+void
+fork_server_open (context_t *cx)
+{
+  struct fork_server *fs = cx->fork_server;
+
+  if (!cx->options.do_fork_server)
+    return;
+
+#ifdef _WIN32
+  leave (cx, LEAVE_USAGE, "-fork-server is not available on this host");
+#endif
+
+  // A job of -batch is a thread of avrtest, which must not fork.
+  if (cx->job)
+    leave (cx, LEAVE_USAGE, "-fork-server is not available with -batch");
+
+  if (cx->options.do_record || cx->options.do_replay)
+    leave (cx, LEAVE_USAGE, "-fork-server excludes -record= and -replay=");
+
+  if (!fs || (unsigned) fs->pc > cx->pc_mask)
+    leave (cx, LEAVE_USAGE, "-fork-server: no function %s in the program",
+           symbol (cx));
+
+  fs->at_main = str_eq (symbol (cx), "main");
+  event_poll (cx, true);
+}
+
+// Read one line from stdin into *LINE.  The server reads by read() so
+// that no FILE buffer of stdin is shared with the runs.  Return false
+// at the end of the input.
+
+static bool
+read_line (context_t *cx, char **line, size_t *size)
+{
+  size_t n = 0;
+  ssize_t got;
+  char c;
+
+  while ((got = read (STDIN_FILENO, &c, 1)) == 1 && c != '\n')
+    {
+      if (n + 1 >= *size)
+        {
+          char *old = *line;
+          *size = *size ? 2 * *size : 256;
+          *line = get_mem (cx, *size, 1, "-fork-server runs");
+          if (old)
+            memcpy (*line, old, n);
+          put_mem (cx, old);
+        }
+      (*line)[n++] = c;
+    }
+
+  if (got != 1 && n == 0)
+    return false;
+  if (!*line)
+    *line = get_mem (cx, *size = 256, 1, "-fork-server");
+  (*line)[n] = '\0';
+  return true;
+}
+
+// In the fork:  Set up stdin and the arguments from LINE.  Return
+// whether the program gets new arguments.
+
+static bool
+start_run (context_t *cx, char *line)
+{
+  const char *in = "/dev/null";
+  // A line of N chars has no more than N / 2 + 1 words.
+  size_t n_words = strlen (line) / 2 + 1;
+  char *word = strtok (line, " \t\r");
+
+  if (word && str_prefix ("-stdin=", word))
+    {
+      in = word + strlen ("-stdin=");
+      word = strtok (NULL, " \t\r");
+    }
+
+  // Reopen the stream itself, so that the USARTs that read "-" get IN
+  // as well.
+  if (!freopen (in, "r", cx->in))
+    leave (cx, LEAVE_IO, "-fork-server: cannot read %s", in);
+
+  if (!word)
+    return false;
+
+  if (!cx->fork_server->at_main)
+    leave (cx, LEAVE_USAGE, "-fork-server=%s: arguments need the snapshot "
+           "at main", symbol (cx));
+  if (!cx->args.avr_args)
+    leave (cx, LEAVE_USAGE,
+           "-fork-server: the program did not ask for -args");
+
+  // args.argv[args.i] stands for the name of the program.
+  char **argv = get_mem (cx, 1 + n_words, sizeof (char*), "-fork-server");
+  int argc = 1;
+  for (; word; word = strtok (NULL, " \t\r"))
+    argv[argc++] = word;
+
+  cx->args.argv = argv;
+  cx->args.argc = argc;
+  cx->args.i = 0;
+  put_argv (cx, cx->args.avr_args);
+  return true;
+}
+
+// Called by do_events() after each basic block until the program counter
+// reaches the snapshot.  Then serve runs until the end of stdin and exit.
+// Return in the fork that serves a run, with true if the program gets
+// new arguments.
+
+bool
+fork_server_poll (context_t *cx)
+{
+  if (cx->pc != (unsigned) cx->fork_server->pc)
+    return false;
+
+  event_poll (cx, false);
+
+#ifndef _WIN32
+  char *line = NULL;
+  size_t size = 0;
+  unsigned n_runs = 0;
+
+  while (read_line (cx, &line, &size))
+    {
+      fflush (cx->out);
+      fflush (cx->err);
+
+      pid_t pid = fork ();
+      if (pid < 0)
+        leave (cx, LEAVE_FATAL, "-fork-server: cannot fork");
+      if (pid == 0)
+        return start_run (cx, line);
+
+      int status;
+      if (waitpid (pid, &status, 0) < 0)
+        leave (cx, LEAVE_FATAL, "-fork-server: lost run %u", 1 + n_runs);
+
+      fprintf (cx->out, "fork-server: run %u exit %d\n", ++n_runs,
+               WIFEXITED (status)
+               ? WEXITSTATUS (status) : 128 + WTERMSIG (status));
+      fflush (cx->out);
+    }
+#endif // _WIN32
+
+  quit (cx, EXIT_SUCCESS);
+}
@@ -0,0 +1,67 @@
+#!/bin/sh
+# Make the body of avr-fuse.def from the programs it is supposed to speed up.
+#
+# Usage:  gen-fuse-table.sh MANIFEST [N] > table
+#
+# MANIFEST lists the programs like for avrtest -batch, one command line
+# per line, for example the executables from a run of the GCC testsuite
+# or a benchmark compiled with avr-gcc:
+#
+#     -mmcu=avr51 -m 200000000 bigbench.elf
+#
+# All of them are run with -fuse-stats, and the sequences of instructions
+# that ran most often are summed up over the programs.  A sequence of K
+# instructions saves K - 1 indirect jumps each time it runs, and the N
+# sequences that save the most are printed as AVR_FUSE, AVR_FUSE3 or
+# AVR_FUSE4 lines, 40 by default.  Since -fuse-stats only reports the
+# most executed sequences of each program, a sequence that is rare in
+# every single program might be missing.
+#
+# $AVRTEST is the avrtest to use, ./avrtest by default.
+
+if [ $# -lt 1 ] || [ $# -gt 2 ]; then
+    echo "usage: $0 MANIFEST [N]" >&2
+    exit 1
+fi
+
+manifest=$1
+top=${2:-40}
+avrtest=${AVRTEST:-./avrtest}
+
+"$avrtest" -batch "$manifest" -q -no-stdout -fuse-stats \
+    | awk -v top="$top" -v manifest="$manifest" '
+/^most executed sequence/ { in_seq = 1; next }
+/^job [0-9]*:/ {
+    in_seq = 0
+    n_jobs++
+    if ($3 != "EXIT,")
+        printf ("gen-fuse-table.sh: %s\n", $0) > "/dev/stderr"
+    next
+}
+in_seq && NF == 0 { in_seq = 0 }
+in_seq {
+    # ID + ID ... SITES EXECUTED PERCENT
+    seq = ""
+    n = 0
+    for (i = 1; i <= NF - 3; i += 2) {
+        seq = seq (n ? ", " : "") $i
+        n++
+    }
+    runs[seq] += $(NF - 1)
+    len[seq] = n
+}
+END {
+    printf ("// Made by gen-fuse-table.sh from %d programs in %s.\n",
+            n_jobs, manifest)
+    for (k = 0; k < top; k++) {
+        best = ""
+        for (seq in runs)
+            if (best == "" \
+                || runs[seq] * (len[seq] - 1) > runs[best] * (len[best] - 1))
+                best = seq
+        if (best == "" || runs[best] == 0)
+            break
+        printf ("AVR_FUSE%s (%s)\n", len[best] == 2 ? "" : len[best], best)
+        delete runs[best]
+    }
+}'
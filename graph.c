@@ -23,14 +23,17 @@
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <stddef.h>
 #include <string.h>
 #include <stdint.h>
+#include <inttypes.h>
 #include <stdbool.h>
 #include <math.h>
 
 #include "testavr.h"
 #include "options.h"
 #include "graph.h"
+#include "checkpoint.h"
 
 #ifndef AVRTEST_LOG
 #error no function herein is needed without AVRTEST_LOG
@@ -74,6 +77,8 @@ enum
 
 typedef struct symbol
 {
+  // All symbols, newest first.
+  struct symbol *next;
   // string's address, somewhere in string_table.data[]
   const char *name;
   // unique id > 0
@@ -87,7 +92,7 @@ typedef struct symbol
 
   struct
   {
-    unsigned own, childs;
+    qword own, childs;
     bool done, account;
   } cycles;
   // whether this is STT_FUNC
@@ -123,7 +128,7 @@ typedef struct edge
   // number of proper calls
   int n_call;
   // total cycles accounted to this edge
-  unsigned n_cycles;
+  qword n_cycles;
   // apprearances in sub-trees (-graph-sub)
   unsigned n_sub;
   // appearances in sub-trees of leaf functions (-graph-leaf)
@@ -146,8 +151,11 @@ typedef struct list
 } list_t;
 
 
-typedef struct
+typedef struct graph
 {
+  // The context the graph belongs to.
+  context_t *cx;
+
   // ID of current instruction.
   int id, old_id;
 
@@ -155,7 +163,7 @@ typedef struct
   symbol_t *setjmp, *longjmp;
   symbol_t *main, *exit, *_exit, *abort;
   // sum of "own" cycles accounted to nodes
-  unsigned n_cycles;
+  qword n_cycles;
   edge_t *entry_edge;
   struct
   {
@@ -164,54 +172,65 @@ typedef struct
   } main_return;
   bool no_startup_cycles;
   bool entered;
-} graph_t;
 
+  // Number of edges and symbols so far, for their unique IDs.
+  int n_edges, n_symbols;
+  symbol_t *symbols;
+  // program.n_cycles when the call stack changed last, cf. account_cycles().
+  qword cycle;
 
-// Word address --> string_t that holds the symbol or NULL.
-static symbol_t *func_sym[MAX_FLASH_SIZE/2];
+  // __prologue_saves__ or __epilogue_restores__ while they are running,
+  // and how to log them, cf. graph_update_call_depth().
+  symbol_t *pro_ep;
+  char s_pe[50];
+  // The label of the edge from main when main returns.
+  char s_main_return[20];
 
-#define EPRIM 43
-static edge_t *ebucket[EPRIM];
+  list_t *ystack;
+  list_t *yend;
+  list_t *yfree;
+  list_t *lnores;
 
-static graph_t graph;
+  // -graph-leaf: Functions to be treated as leaf functions
+  char* const *s_leafs;
+  int n_leafs;
 
-static list_t *ystack = NULL;
-static list_t *yend = NULL;
-static list_t *yfree = NULL;
-static list_t *lnores;
+  // -graph-sub: Functions to be expanded completely
+  char* const *s_subs;
+  int n_subs;
 
-// -graph-leaf: Functions to be treated as leaf functions
-static char* const *s_leafs;
-static int n_leafs;
+  // -graph-skip: Functions to be ignored
+  char* const *s_skips;
+  int n_skips;
 
-// -graph-sub: Functions to be expanded completely
-static char* const *s_subs;
-static int n_subs;
+#define EPRIM 43
+  edge_t *ebucket[EPRIM];
+
+  // Word address --> string_t that holds the symbol or NULL.
+  symbol_t *func_sym[MAX_FLASH_SIZE/2];
+} graph_t;
 
-// -graph-skip: Functions to be ignored
-static char* const *s_skips;
-static int n_skips;
 
-#define DEBUG_TREE (options.do_debug_tree)
+#define DEBUG_TREE (cx->options.do_debug_tree)
 
 static edge_t*
-get_edge (symbol_t *from, symbol_t *to)
+get_edge (graph_t *g, symbol_t *from, symbol_t *to)
 {
-  static int n_edges;
+  context_t *cx = g->cx;
   unsigned hash = (unsigned) (from->id - to->id) % EPRIM;
 
-  for (edge_t *e = ebucket[hash]; e != NULL; e = e->next)
+  for (edge_t *e = g->ebucket[hash]; e != NULL; e = e->next)
     if (e->from->id == from->id
         && e->to->id == to->id)
       return e;
 
-  edge_t *e = get_mem (1, sizeof (edge_t), "edge");
+  edge_t *e = get_mem (cx, 1, sizeof (edge_t), "edge");
   memset (e, 0, sizeof (edge_t));
   e->from = from;
   e->to = to;
-  e->id = ++n_edges;
-  e->next = ebucket[hash];
-  ebucket[hash] = e;
+  e->id = ++g->n_edges;
+  e->next = g->ebucket[hash];
+  g->ebucket[hash] = e;
 
   return e;
 }
@@ -234,10 +253,10 @@ lmark_edges (list_t *from, list_t *to, unsigned mask)
 
 // Find deepest base or NULL
 static list_t*
-lfind_base (bool maybe_addr)
+lfind_base (const graph_t *g, bool maybe_addr)
 {
   list_t *l = NULL;
-  for (l = yend; l; l = l->prev)
+  for (l = g->yend; l; l = l->prev)
     if (l->sym->is_base)
       break;
 
@@ -250,9 +269,9 @@ lfind_base (bool maybe_addr)
 
 // Find deepest type or NULL
 static list_t*
-lfind_type (int type)
+lfind_type (const graph_t *g, int type)
 {
-  for (list_t *l = yend; l; l = l->prev)
+  for (list_t *l = g->yend; l; l = l->prev)
     if (l->edge->to->type == type)
       return l;
   return NULL;
@@ -260,14 +279,15 @@ lfind_type (int type)
 
 
 static void
-lpush (list_t **head, edge_t *e)
+lpush (graph_t *g, list_t **head, edge_t *e)
 {
-  list_t *l = yfree;
+  context_t *cx = g->cx;
+  list_t *l = g->yfree;
 
   if (l != NULL)
-    yfree = l->next;
+    g->yfree = l->next;
   else
-    l = get_mem (1, sizeof (list_t), "list");
+    l = get_mem (cx, 1, sizeof (list_t), "list");
 
   l->edge = e;
   if (e)
@@ -283,7 +303,7 @@ lpush (list_t **head, edge_t *e)
 /* Remove first elment of list *HEAD and add it to the free list `yfree'.  */
 
 static void
-lpop (list_t **head)
+lpop (graph_t *g, list_t **head)
 {
   list_t *l = *head;
 
@@ -294,8 +314,8 @@ lpop (list_t **head)
     l->next->prev = NULL;
   *head = l->next;
 
-  l->next = yfree;
-  yfree = l;
+  l->next = g->yfree;
+  g->yfree = l;
 }
 
 
@@ -311,14 +331,14 @@ bool is_func_prefix (const char *prefix, const char *fun)
 
 
 static bool
-have_elf_symbol (const char *name)
+have_elf_symbol (const context_t *cx, const char *name)
 {
-  for (size_t off = 1; off < string_table.size; )
-    if (string_table.have[off]
-        && str_eq (name, string_table.data + off))
+  for (size_t off = 1; off < cx->string_table.size; )
+    if (cx->string_table.have[off]
+        && str_eq (name, cx->string_table.data + off))
       return true;
     else
-      off += 1 + strlen (string_table.data + off);
+      off += 1 + strlen (cx->string_table.data + off);
 
   return false;
 }
@@ -348,73 +368,76 @@ typedef struct
 
 
 static void
-dump_node (const symbol_t *s)
+dump_node (const context_t *cx, const symbol_t *s)
 {
   if (s)
-    printf (" %s:%d:%d%s%s%s%s%s ", s->name,
-            s->is_reserved_caller, s->is_reserved,
-            s->is_leaf ? ":L" : "", s->is_sub ? ":S" : "",
-            s->cycles.account ? ":A":"", s->is_base ? ":B":"",
-            s->is_skip ? ":I":"");
+    fprintf (cx->out, " %s:%d:%d%s%s%s%s%s ", s->name,
+             s->is_reserved_caller, s->is_reserved,
+             s->is_leaf ? ":L" : "", s->is_sub ? ":S" : "",
+             s->cycles.account ? ":A":"", s->is_base ? ":B":"",
+             s->is_skip ? ":I":"");
   else
-    printf (" (Nnull) ");
+    fprintf (cx->out, " (Nnull) ");
 }
 
 
 static void
-dump_listel (const list_t *l)
+dump_listel (const context_t *cx, const list_t *l)
 {
   if (l)
-    printf (" [%d,%04x]  <--%s%s%s%s ", l->depth, l->sp,
-            l->edge->mark & EM_ACCOUNT ? "A":"",
-            l->is_leaf ? "L":"", l->is_sub ? "S":"",
-            l->edge->mark & EM_SHOW ? "!":"");
+    fprintf (cx->out, " [%d,%04x]  <--%s%s%s%s ", l->depth, l->sp,
+             l->edge->mark & EM_ACCOUNT ? "A":"",
+             l->is_leaf ? "L":"", l->is_sub ? "S":"",
+             l->edge->mark & EM_SHOW ? "!":"");
   else
-    printf (" (Lnull) ");
+    fprintf (cx->out, " (Lnull) ");
 }
 
 static void
-dump_ystack (void)
+dump_ystack (const graph_t *g)
 {
-  printf ("/// ");
-  for (const list_t *l = ystack; l; l = l->next)
+  const context_t *cx = g->cx;
+
+  fprintf (cx->out, "/// ");
+  for (const list_t *l = g->ystack; l; l = l->next)
     {
-      dump_node (l->sym);
-      dump_listel (l);
+      dump_node (cx, l->sym);
+      dump_listel (cx, l);
     }
-  printf ("\n");
+  fprintf (cx->out, "\n");
 }
 
 
 /* Classify symbol according to its name (main, exit, ...) depending
-   on some command options.  */
+   on some command cx->options.  */
 
 static void
-classify_symbol (symbol_t *s, bool is_func)
+classify_symbol (graph_t *g, symbol_t *s, bool is_func)
 {
+  const context_t *cx = g->cx;
   static const char *res_callers[] =
     { "__utoa_common", "__ultoa_common", NULL };
   const char *name = s->name;
 
-  s->is_reserved = (! options.do_graph_reserved
+  s->is_reserved = (! cx->options.do_graph_reserved
                     && str_prefix ("__", name)
                     // From ld --wrap
                     && ! str_prefix ("__wrap_", name));
 
-  s->is_reserved_caller = (! options.do_graph_reserved
+  s->is_reserved_caller = (! cx->options.do_graph_reserved
                            && str_in (name, res_callers));
   s->is_func = is_func;
 
-  static const spec_t special[] =
+  const spec_t special[] =
     {
-      { "main",                  T_MAIN,      & graph.main },
-      { "exit",                  T_EXIT,      & graph.exit },
-      { "_exit",                 T__EXIT,     & graph._exit },
-      { "abort",                 T_ABORT,     & graph.abort },
-      { "setjmp",                T_SETJMP,    & graph.setjmp },
-      { "longjmp",               T_LONGJMP,   & graph.longjmp },
-      { "__prologue_saves__",    T_PROLOGUE,  & graph.prologue_saves },
-      { "__epilogue_restores__", T_EPILOGUE,  & graph.epilogue_restores },
+      { "main",                  T_MAIN,      & g->main },
+      { "exit",                  T_EXIT,      & g->exit },
+      { "_exit",                 T__EXIT,     & g->_exit },
+      { "abort",                 T_ABORT,     & g->abort },
+      { "setjmp",                T_SETJMP,    & g->setjmp },
+      { "longjmp",               T_LONGJMP,   & g->longjmp },
+      { "__prologue_saves__",    T_PROLOGUE,  & g->prologue_saves },
+      { "__epilogue_restores__", T_EPILOGUE,  & g->epilogue_restores },
       { NULL, 0, NULL }
     };
 
@@ -423,19 +446,19 @@ classify_symbol (symbol_t *s, bool is_func)
       (* y->psym = s) -> type = y->type;
 
   (void)
-    (options.do_graph_base
-     && *options.s_graph_base != '\0'
-     && (s->is_base = is_func_prefix (options.s_graph_base, name))
-     && (graph.base = s));
+    (cx->options.do_graph_base
+     && *cx->options.s_graph_base != '\0'
+     && (s->is_base = is_func_prefix (cx->options.s_graph_base, name))
+     && (g->base = s));
 
-  for (int n = 0; n < n_subs && !s->is_sub; n++)
-    s->is_sub = is_func_prefix (s_subs[n], name);
+  for (int n = 0; n < g->n_subs && !s->is_sub; n++)
+    s->is_sub = is_func_prefix (g->s_subs[n], name);
 
-  for (int n = 0; n < n_leafs && !s->is_leaf; n++)
-    s->is_leaf = is_func_prefix (s_leafs[n], name);
+  for (int n = 0; n < g->n_leafs && !s->is_leaf; n++)
+    s->is_leaf = is_func_prefix (g->s_leafs[n], name);
 
-  for (int n = 0; n < n_skips && !s->is_skip; n++)
-    s->is_skip = is_func_prefix (s_skips[n], name);
+  for (int n = 0; n < g->n_skips && !s->is_skip; n++)
+    s->is_skip = is_func_prefix (g->s_skips[n], name);
 
   if (s->is_base || s->is_leaf || s->is_sub)
     s->is_reserved = s->is_reserved_caller = false;
@@ -443,31 +466,44 @@ classify_symbol (symbol_t *s, bool is_func)
 
 
 static symbol_t*
-graph_add_symbol (const char *name, unsigned pc, bool is_func)
+graph_add_symbol (graph_t *g, const char *name, unsigned pc, bool is_func)
 {
-  static int n_symbols;
-  symbol_t *s = get_mem (1, sizeof (symbol_t), "symbol_t");
+  context_t *cx = g->cx;
+  symbol_t *s = get_mem (cx, 1, sizeof (symbol_t), "symbol_t");
   memset (s, 0, sizeof (symbol_t));
   s->type = T_NONE;
-  s->id = ++ n_symbols;
+  s->id = ++ g->n_symbols;
   s->pc = pc;
+  s->next = g->symbols;
+  g->symbols = s;
 
   // No name available: use address as name
   if (!(s->name = name))
     {
       char *s_addr;
-      s_addr = get_mem (10, sizeof (char), "s_addr");
+      s_addr = get_mem (cx, 10, sizeof (char), "s_addr");
       sprintf (s_addr, "0x%x", 2 * pc);
       s->name = s_addr;
       s->type = T_ADDR;
     }
 
-  classify_symbol (s, is_func);
+  classify_symbol (g, s, is_func);
 
   return s;
 }
 
 
+/* Called by log_open() before the ELF reader sets in.  */
+
+void
+graph_open (context_t *cx)
+{
+  graph_t *g = get_mem (cx, 1, sizeof (graph_t), "graph_t");
+  g->cx = cx;
+  cx->graph = g;
+}
+
+
 /* Priority of some known symbols as a specific address might be featured
    with mode than one symbol.  */
 
@@ -488,16 +524,18 @@ rate_symbol (const char *s)
    type is STT_FUNC.  */
 
 void
-graph_elf_symbol (const char *name, size_t stoff, unsigned pc, bool is_func)
+graph_elf_symbol (context_t *cx, const char *name, size_t stoff, unsigned pc,
+                  bool is_func)
 {
-  symbol_t *sym = func_sym[pc];
-  string_table.have[stoff] = true;
+  graph_t *g = cx->graph;
+  symbol_t *sym = g->func_sym[pc];
+  cx->string_table.have[stoff] = true;
 
   if (sym
       && rate_symbol (name) <= rate_symbol (sym->name))
     return;
 
-  sym = graph_add_symbol (name, pc, is_func);
+  sym = graph_add_symbol (g, name, pc, is_func);
 
   // Collect names that might be remapped to their non-inline originator.
   // We must have all symbols available to decide on this because the
@@ -505,93 +543,101 @@ graph_elf_symbol (const char *name, size_t stoff, unsigned pc, bool is_func)
   for (const char* const *r = not_reserved; r[0]; r += 2)
     if (str_eq (name, r[0]))
       {
-        lpush (&lnores, NULL);
-        lnores->sym = sym;
-        lnores->res = r[1];
+        lpush (g, &g->lnores, NULL);
+        g->lnores->sym = sym;
+        g->lnores->res = r[1];
       }
 
-  func_sym[pc] = sym;
+  g->func_sym[pc] = sym;
 }
 
 
 /* Called from ELF reader as is comes across the symbol table.  */
 
 void
-graph_set_string_table (char *stab, size_t size, int n_entries)
+graph_set_string_table (context_t *cx, char *stab, size_t size, int n_entries)
 {
-  string_table.have = get_mem (size, sizeof (bool), "string_table.have");
+  graph_t *g = cx->graph;
+  const options_t *options = &cx->options;
+
+  cx->string_table.have = get_mem (cx, size, sizeof (bool),
+                                   "string_table.have");
 
-  if (options.do_graph_leaf)
-    s_leafs = comma_list_to_array (options.s_graph_leaf, &n_leafs);
+  if (options->do_graph_leaf)
+    g->s_leafs = comma_list_to_array (cx, options->s_graph_leaf,
+                                      &g->n_leafs);
 
-  if (options.do_graph_sub)
-    s_subs = comma_list_to_array (options.s_graph_sub, &n_subs);
+  if (options->do_graph_sub)
+    g->s_subs = comma_list_to_array (cx, options->s_graph_sub, &g->n_subs);
 
-  if (options.do_graph_skip)
-    s_skips = comma_list_to_array (options.s_graph_skip, &n_skips);
+  if (options->do_graph_skip)
+    g->s_skips = comma_list_to_array (cx, options->s_graph_skip,
+                                      &g->n_skips);
 }
 
 
 /* Called from ELF reader when it has finished traversing the symbol table. */
 
 void
-graph_finish_string_table (void)
+graph_finish_string_table (context_t *cx)
 {
+  graph_t *g = cx->graph;
+
   // remap inlined functions to their original
-  while (lnores)
+  while (g->lnores)
     {
-      if (!have_elf_symbol (lnores->res))
+      if (!have_elf_symbol (cx, g->lnores->res))
         {
-          lnores->sym->name = lnores->res;
-          lnores->sym->is_func = true;
-          lnores->sym->is_reserved = false;
+          g->lnores->sym->name = g->lnores->res;
+          g->lnores->sym->is_func = true;
+          g->lnores->sym->is_reserved = false;
         }
-      lpop (&lnores);
+      lpop (g, &g->lnores);
     }
 
   // Add artificial node and edge representing the program entry.
-  symbol_t *entry = func_sym[cpu_PC];
-  graph.entry_point = graph_add_symbol ("Entry Point", cpu_PC, false);
-  graph.entry_point->type = T_ENTRY;
+  symbol_t *entry = g->func_sym[cx->pc];
+  g->entry_point = graph_add_symbol (g, "Entry Point", cx->pc, false);
+  g->entry_point->type = T_ENTRY;
   if (!entry)
-    entry = graph_add_symbol (NULL, cpu_PC, false);
-  func_sym[cpu_PC] = entry;
+    entry = graph_add_symbol (g, NULL, cx->pc, false);
+  g->func_sym[cx->pc] = entry;
 
-  lpush (&ystack, graph.entry_edge = get_edge (graph.entry_point, entry));
-  yend = ystack;
+  lpush (g, &g->ystack, g->entry_edge = get_edge (g, g->entry_point, entry));
+  g->yend = g->ystack;
 
   // -graph-base=BASE is turned on but we did not yet see a BASE function.
   // Try special value "0" which stands for program entry and integer
   // values which stand for plain byte addresses.
-  if (options.do_graph_base
-      && !graph.base)
+  if (cx->options.do_graph_base
+      && !g->base)
     {
       char *end;
-      unsigned long pc = strtoul (options.s_graph_base, &end, 0) / 2;
+      unsigned long pc = strtoul (cx->options.s_graph_base, &end, 0) / 2;
 
-      if (str_eq ("0", options.s_graph_base))
-        graph.base = entry;
-      else if (*options.s_graph_base
+      if (str_eq ("0", cx->options.s_graph_base))
+        g->base = entry;
+      else if (*cx->options.s_graph_base
                && *end == '\0'
                && pc < MAX_FLASH_SIZE / 2)
         (void)
-          ((graph.base = func_sym[pc])
-           || (graph.base = func_sym[pc] = graph_add_symbol (NULL, pc, 0)));
+          ((g->base = g->func_sym[pc])
+           || (g->base = g->func_sym[pc] = graph_add_symbol (g, NULL, pc, 0)));
     }
 
   // Still no BASE:  Use main, and if there is no main, use program entry.
   (void)
-    (graph.base
-     || (graph.base = graph.main)
-     || (graph.base = entry));
+    (g->base
+     || (g->base = g->main)
+     || (g->base = entry));
 
-  graph.base->is_base = true;
-  graph.base->is_reserved = graph.base->is_reserved_caller = false;
+  g->base->is_base = true;
+  g->base->is_reserved = g->base->is_reserved_caller = false;
 
-  graph.entered = true;
+  g->entered = true;
 
   if (DEBUG_TREE)
-    printf ("BASE = %s\n", graph.base->name);
+    fprintf (cx->out, "BASE = %s\n", g->base->name);
 }
 
 
@@ -599,8 +645,9 @@ graph_finish_string_table (void)
    parents of L until BASE is reached.  */
 
 static void
-account (list_t *l, list_t *base, unsigned cycles)
+account (graph_t *g, list_t *l, list_t *base, qword cycles)
 {
+  const context_t *cx = g->cx;
   bool own = true;
 
   for (; l; l = l->next)
@@ -619,14 +666,15 @@ account (list_t *l, list_t *base, unsigned cycles)
         {
           sym->cycles.account = true;
           sym->cycles.own += cycles;
-          graph.n_cycles += cycles;
+          g->n_cycles += cycles;
         }
       else
         sym->cycles.childs += cycles;
 
       if (DEBUG_TREE)
-        printf ("A:%s %s +%d = %d\n", own ? "COST" : "CHLD", sym->name,
-                cycles, own ? sym->cycles.own : sym->cycles.childs);
+        fprintf (cx->out, "A:%s %s +%"PRIu64" = %"PRIu64"\n",
+                 own ? "COST" : "CHLD", sym->name,
+                 cycles, own ? sym->cycles.own : sym->cycles.childs);
 
       if (l == base)
         return;
@@ -643,33 +691,33 @@ account (list_t *l, list_t *base, unsigned cycles)
    update of the call stack to a node appropriate for it.  */
 
 static void
-account_cycles (void)
+account_cycles (graph_t *g)
 {
-  static unsigned cycle;
-  unsigned cycles = program.n_cycles - cycle;
-  cycle = program.n_cycles;
+  const context_t *cx = g->cx;
+  qword cycles = cx->program.n_cycles - g->cycle;
+  g->cycle = cx->program.n_cycles;
 
   // Find a "base" symbol from bottom of callstack as end point
-  list_t *l, *base = lfind_base (true);
+  list_t *l, *base = lfind_base (g, true);
 
   if (DEBUG_TREE)
     {
-      dump_ystack();
-      printf ("BASE = %s\n", base ? base->sym->name : "(Bnull)");
+      dump_ystack (g);
+      fprintf (cx->out, "BASE = %s\n", base ? base->sym->name : "(Bnull)");
     }
 
   if (!base)
     return;
 
-  if (ystack == base || ystack->sym == graph.main)
-    lmark_edges (ystack, NULL, EM_TRACE);
+  if (g->ystack == base || g->ystack->sym == g->main)
+    lmark_edges (g->ystack, NULL, EM_TRACE);
 
   // Set markers to not account cycles to a node more than once
-  for (l = ystack; l; l = l->next)
+  for (l = g->ystack; l; l = l->next)
     l->sym->cycles.done = false;
 
   // Climb up the call stack until we find a node to account the cycles
-  for (l = ystack; l && l != base; l = l->next)
+  for (l = g->ystack; l && l != base; l = l->next)
     if (l->is_leaf
         || l->sym->is_skip)
       continue;
@@ -682,14 +730,14 @@ account_cycles (void)
                 || l->edge->from->is_reserved_caller))
       break;
 
-  account (l, base, cycles);
+  account (g, l, base, cycles);
 }
 
 
 static edge_t*
-traverse_edge (symbol_t *from, symbol_t *to, int delta, bool back)
+traverse_edge (graph_t *g, symbol_t *from, symbol_t *to, int delta, bool back)
 {
-  edge_t *e = get_edge (from, to);
+  edge_t *e = get_edge (g, from, to);
   e->n++;
   if (delta)    e->n_call++;
   else          e->n_tail++;
@@ -701,17 +749,18 @@ traverse_edge (symbol_t *from, symbol_t *to, int delta, bool back)
 
 
 static void
-update_call_stack (symbol_t *sym, int delta, bool is_longjmp)
+update_call_stack (graph_t *g, symbol_t *sym, int delta, bool is_longjmp)
 {
+  context_t *cx = g->cx;
   list_t *l;
-  int sp = pSP[0] | (pSP[1] << 8);
+  int sp = cx->data[addr_SPL] | (cx->data[addr_SPL + 1] << 8);
 
-  account_cycles ();
+  account_cycles (g);
 
   // Fix change of call depth for (very) special functions
 
-  if ((is_longjmp |= T_LONGJMP == ystack->sym->type)
-      || T_SETJMP == ystack->sym->type)
+  if ((is_longjmp |= T_LONGJMP == g->ystack->sym->type)
+      || T_SETJMP == g->ystack->sym->type)
     delta = -1;
 
   if (sym
@@ -719,15 +768,15 @@ update_call_stack (symbol_t *sym, int delta, bool is_longjmp)
     delta = 0;
 
   if (delta == 0
-      && ystack && sym
-      && sym == ystack->sym
-      && sp == ystack->sp)
+      && g->ystack && sym
+      && sym == g->ystack->sym
+      && sp == g->ystack->sp)
     {
       // Skip nodes jumping to themselves without changing anything,
       // just add the respective edge.
-      traverse_edge (sym, sym, 0, false);
+      traverse_edge (g, sym, sym, 0, false);
     }
-  else if (ystack && delta >= 0)
+  else if (g->ystack && delta >= 0)
     {
       // If the call depth does not change, e.g. for tail calls, add the node
       // to the call stack rather than replacing the top of the call stack by
@@ -739,38 +788,39 @@ update_call_stack (symbol_t *sym, int delta, bool is_longjmp)
         {
           // Jumping to / calling a location that has no symbol:
           // Cook up a node that has the target address as label.
-          func_sym[cpu_PC] = sym = graph_add_symbol (NULL, cpu_PC, false);
+          g->func_sym[cx->pc] = sym
+            = graph_add_symbol (g, NULL, cx->pc, false);
           sym->is_reserved = true;
         }
 
-      edge_t *e = traverse_edge (ystack->edge->to, sym, delta, false);
+      edge_t *e = traverse_edge (g, g->ystack->edge->to, sym, delta, false);
 
-      int depth = ystack->depth + delta;
-      l = ystack;
-      lpush (&ystack, e);
-      ystack->depth = depth;
-      ystack->sp = sp;
+      int depth = g->ystack->depth + delta;
+      l = g->ystack;
+      lpush (g, &g->ystack, e);
+      g->ystack->depth = depth;
+      g->ystack->sp = sp;
 
       // Promote some "sticky" properties to callees.
-      ystack->is_leaf = (l != NULL
-                         && (l->is_leaf || l->sym->is_leaf)
-                         /*&& ! l->sym->is_sub*/);
-      ystack->is_sub  = (l != NULL
-                         && (l->is_sub || l->sym->is_sub)
-                         && ! l->sym->is_leaf);
-      ystack->edge->n_leaf += ystack->is_leaf;
-      ystack->edge->n_sub  += ystack->is_sub;
+      g->ystack->is_leaf = (l != NULL
+                            && (l->is_leaf || l->sym->is_leaf)
+                            /*&& ! l->sym->is_sub*/);
+      g->ystack->is_sub  = (l != NULL
+                            && (l->is_sub || l->sym->is_sub)
+                            && ! l->sym->is_leaf);
+      g->ystack->edge->n_leaf += g->ystack->is_leaf;
+      g->ystack->edge->n_sub  += g->ystack->is_sub;
     }
-  else if (ystack && delta < 0)
+  else if (g->ystack && delta < 0)
     {
       list_t *lj = NULL;
 
-      l = ystack;
+      l = g->ystack;
 
       if (is_longjmp)
         {
           if (DEBUG_TREE)
-            printf ("/// UNWIND lj=%d\n", l->sym->type == T_LONGJMP);
+            fprintf (cx->out, "/// UNWIND lj=%d\n", l->sym->type == T_LONGJMP);
 
           delta = 0;
 
@@ -785,37 +835,38 @@ update_call_stack (symbol_t *sym, int delta, bool is_longjmp)
             {
               // If a longjmp targets a symbol, in almost all cases this is
               // due to bad jmp_buf content and the program jumps to 0x0.
-              for (lj = ystack; lj; lj = lj->next)
+              for (lj = g->ystack; lj; lj = lj->next)
                 if (lj->sym == sym)
                   {
-                    lmark_edges (ystack, lj, EM_TRACE);
+                    lmark_edges (g->ystack, lj, EM_TRACE);
                     // If the call tree already contains the longjmp's target
                     // symbol, then unwind (at least) to that point.
-                    while (lj != ystack)
-                      lpop (&ystack);
+                    while (lj != g->ystack)
+                      lpop (g, &g->ystack);
                     break;
                   }
             }
           else
             {
               // Mark edges that we are going to unwind below.
-              for (lj = ystack; lj && lj->sp < sp; lj = lj->next)
+              for (lj = g->ystack; lj && lj->sp < sp; lj = lj->next)
                 ;
-              lmark_edges (ystack, lj ? lj->prev : NULL, EM_TRACE);
+              lmark_edges (g->ystack, lj ? lj->prev : NULL, EM_TRACE);
             }
 
           if (DEBUG_TREE)
-            dump_ystack();
+            dump_ystack (g);
         }
 
       // The normal case
-      while (ystack->next
+      while (g->ystack->next
              && (delta < 0
                  // this might yield better recovery from longjmp
-                 || ystack->sp < sp))
+                 || g->ystack->sp < sp))
         {
-          bool main_returns = delta < 0 && ystack && ystack->sym == graph.main;
-          lpop (&ystack);
+          bool main_returns = (delta < 0 && g->ystack
+                               && g->ystack->sym == g->main);
+          lpop (g, &g->ystack);
           delta += delta < 0;
           if (main_returns)
             break;
@@ -827,32 +878,32 @@ update_call_stack (symbol_t *sym, int delta, bool is_longjmp)
           if (T_LONGJMP != from->type)
             {
               // The case is tedious; presumably a __builtin_longjmp.
-              if (!(sym = func_sym[old_PC]))
+              if (!(sym = g->func_sym[cx->old_PC]))
                 {
                   // Cook up a hidden symbol so we can connect the
                   // incoming edge (code issues maybe longjmp) to the outgoing
                   // edge (maybe longjmp targets its maybe setjmp).
                   const char *s_longjmp = "longjmp?";
                   unsigned len = 3 + strlen (from->name) + strlen (s_longjmp);
-                  char *s_name = get_mem (len, sizeof (char), s_longjmp);
+                  char *s_name = get_mem (cx, len, sizeof (char), s_longjmp);
                   sprintf (s_name, "%s\\n%s", s_longjmp, from->name);
-                  sym = graph_add_symbol (s_name, old_PC, false);
+                  sym = graph_add_symbol (g, s_name, cx->old_PC, false);
                   sym->is_hidden = true;
-                  func_sym[old_PC] = sym;
+                  g->func_sym[cx->old_PC] = sym;
                 }
 
               // Incoming edge: longjmp is a proper function, hence there
               // is already an incoming edge and we only need the following
               // edge for non-longjmp jumps.
-              traverse_edge (from, sym, 0, true) -> mark |= EM_TRACE;
+              traverse_edge (g, from, sym, 0, true) -> mark |= EM_TRACE;
             }
           // The outgoing edge.
-          traverse_edge (sym, ystack->sym, 0, true) -> mark |= EM_TRACE;
+          traverse_edge (g, sym, g->ystack->sym, 0, true) -> mark |= EM_TRACE;
         } // is_longjmp
     } // delta < 0
 
   if (DEBUG_TREE)
-    dump_ystack();
+    dump_ystack (g);
 }
 
 
@@ -860,8 +911,10 @@ update_call_stack (symbol_t *sym, int delta, bool is_longjmp)
    convenient to track execution logs.  */
 
 static void
-log_transition (list_t *yold, list_t *ynew, int is_proep, const char *s_pe)
+log_transition (const graph_t *g, list_t *yold, list_t *ynew, int is_proep,
+                const char *s_pe)
 {
+  context_t *cx = g->cx;
   symbol_t *old = yold ? yold->sym : NULL;
   symbol_t *new = ynew ? ynew->sym : NULL;
   int d_old = yold ? yold->depth : 0;
@@ -870,35 +923,36 @@ log_transition (list_t *yold, list_t *ynew, int is_proep, const char *s_pe)
 
   if (is_proep)
     {
-      log_append ("%s+++[%d", d < 0 ? "\n" : "", d_new);
+      log_append (cx, "%s+++[%d", d < 0 ? "\n" : "", d_new);
       if (is_proep == 1)
-        log_append ("] %s -->", old->name);
+        log_append (cx, "] %s -->", old->name);
       else if (d < 0)
-        log_append ("<-%d] %s <-- %s <--", d_old, new->name, old->name);
+        log_append (cx, "<-%d] %s <-- %s <--", d_old, new->name, old->name);
       else
-        log_append ("] %s <--", new->name);
-      log_append (" %s \n", s_pe);
+        log_append (cx, "] %s <--", new->name);
+      log_append (cx, " %s \n", s_pe);
     }
   else if (old && new
-           && (old != new || old == func_sym[cpu_PC]))
+           && (old != new || old == g->func_sym[cx->pc]))
     {
-      const char *s_lj = func_sym[old_PC] && func_sym[old_PC]->is_hidden
+      const symbol_t *lj = g->func_sym[cx->old_PC];
+      const char *s_lj = lj && lj->is_hidden
         ? "longjmp? <-- " : "";
 
-      if (d == 0)  log_append ("\n+++[%d] ", d_old);
-      if (d < 0)   log_append ("\n+++[%d<-%d] ", d_new, d_old);
-      if (d > 0)   log_append ("\n+++[%d->%d] ", d_old, d_new);
+      if (d == 0)  log_append (cx, "\n+++[%d] ", d_old);
+      if (d < 0)   log_append (cx, "\n+++[%d<-%d] ", d_new, d_old);
+      if (d > 0)   log_append (cx, "\n+++[%d->%d] ", d_old, d_new);
 
       if (d < 0 || is_proep == 2)
-        log_append ("%s <-- %s%s \n", new->name, s_lj, old->name);
+        log_append (cx, "%s <-- %s%s \n", new->name, s_lj, old->name);
       else
-        log_append ("%s --> %s \n", old->name, new->name);
+        log_append (cx, "%s --> %s \n", old->name, new->name);
     }
   else if (old != new)
     {
       if (!old)
         old = new, d_old = d_new;
-      log_append ("\n+++[%d] %s \n", d_old, old->name);
+      log_append (cx, "\n+++[%d] %s \n", d_old, old->name);
     }
 }
 
@@ -907,14 +961,15 @@ log_transition (list_t *yold, list_t *ynew, int is_proep, const char *s_pe)
    during instruction logging as functions are entered / left.  */
 
 int
-graph_update_call_depth (const decoded_t *deco)
+graph_update_call_depth (context_t *cx, const decoded_t *deco)
 {
-  graph.old_id = graph.id;
-  int id = graph.id = deco->id;
+  graph_t *g = cx->graph;
+  g->old_id = g->id;
+  int id = g->id = deco->id;
   int call = 0;
 
-  if (! need.call_depth
-      || ! graph.entered)
+  if (! cx->need.call_depth
+      || ! g->entered)
     return 0;
 
   switch (id)
@@ -932,41 +987,39 @@ graph_update_call_depth (const decoded_t *deco)
     case ID_RET:
       // GCC might use push/push/ret for indirect jump,
       // don't account these for call depth
-      if (graph.old_id != ID_PUSH)
+      if (g->old_id != ID_PUSH)
         call = -1;
       break;
     }
 
-  bool maybe_longjmp = ID_RET == id && ID_PUSH == graph.old_id;
+  bool maybe_longjmp = ID_RET == id && ID_PUSH == g->old_id;
   bool jump_indirect = ID_IJMP == id || ID_EIJMP == id;
-  symbol_t *fun = func_sym[cpu_PC];
-  symbol_t *cur = ystack->sym;
+  symbol_t *fun = g->func_sym[cx->pc];
+  symbol_t *cur = g->ystack->sym;
 
   // Pretty-print __prologure_saves__ and __epilogue_restores__ when logging,
   // but don't show them in the call tree:  the tree might be cluttered up
   // because too many functions are using these helpers from libgcc.
-  static symbol_t *pro_ep = NULL;
-  static char s_pe[50];
   int is_proep = 0;
-  if (!pro_ep
+  if (!g->pro_ep
       && (id == ID_RJMP || id == ID_JMP))
     {
-      if (graph.prologue_saves
-          && (unsigned) (cpu_PC - graph.prologue_saves->pc) <= 18)
-        pro_ep = graph.prologue_saves;
+      if (g->prologue_saves
+          && (unsigned) (cx->pc - g->prologue_saves->pc) <= 18)
+        g->pro_ep = g->prologue_saves;
 
-      if (graph.epilogue_restores
-          && (unsigned) (cpu_PC - graph.epilogue_restores->pc) <= 18)
-        pro_ep = graph.epilogue_restores;
+      if (g->epilogue_restores
+          && (unsigned) (cx->pc - g->epilogue_restores->pc) <= 18)
+        g->pro_ep = g->epilogue_restores;
 
-      if ((is_proep = NULL != pro_ep))
+      if ((is_proep = NULL != g->pro_ep))
         {
-          int n_regs = cpu_PC - pro_ep->pc;
-          sprintf (s_pe, "%s + 0x%x (%d regs)", pro_ep->name,
+          int n_regs = cx->pc - g->pro_ep->pc;
+          sprintf (g->s_pe, "%s + 0x%x (%d regs)", g->pro_ep->name,
                    2 * n_regs, 18 - n_regs);
         }
     }
-  else if (pro_ep
+  else if (g->pro_ep
            && (jump_indirect || id == ID_RET))
     is_proep = 2;
 
@@ -979,73 +1032,90 @@ graph_update_call_depth (const decoded_t *deco)
     maybe_longjmp = jump_indirect;
   else if (maybe_longjmp || jump_indirect)
     {
-      int sp = pSP[0] | (pSP[1] << 8);
-      maybe_longjmp = ystack && sp > ystack->sp;
+      int sp = cx->data[addr_SPL] | (cx->data[addr_SPL + 1] << 8);
+      maybe_longjmp = g->ystack && sp > g->ystack->sp;
     }
 
   // Entering main.  main is somewhat special in C programs.
-  if (fun && fun == graph.main)
+  if (fun && fun == g->main)
     {
-      graph.main_return.n_call ++;
+      g->main_return.n_call ++;
       if (call == 1)
-        graph.main_return.pc = old_PC + opcodes[id].size;
-      graph.no_startup_cycles = !graph.n_cycles;
+        g->main_return.pc = cx->old_PC + opcodes[id].size;
+      g->no_startup_cycles = !g->n_cycles;
     }
 
   bool main_returns = false;
 
   if ((main_returns
-       = (fun && (fun == graph.exit || fun == graph._exit)
-          && graph.old_id == ID_RET
+       = (fun && (fun == g->exit || fun == g->_exit)
+          && g->old_id == ID_RET
           && (id == ID_JMP || id == ID_RJMP)
-          && graph.main_return.n_call == 1
-          && graph.main_return.pc == old_PC
-          && yfree && yfree->sym == graph.main
-          && ystack && ystack->sym == yfree->edge->from)))
+          && g->main_return.n_call == 1
+          && g->main_return.pc == cx->old_PC
+          && g->yfree && g->yfree->sym == g->main
+          && g->ystack && g->ystack->sym == g->yfree->edge->from)))
     {
       // Resurrect the call of main.
-      list_t *l = yfree;
-      yfree = l->next;
+      list_t *l = g->yfree;
+      g->yfree = l->next;
       l->prev = NULL;
-      l->next = ystack;
+      l->next = g->ystack;
       if (l->next)
         l->next->prev = l;
-      ystack = l;
-      lmark_edges (ystack, NULL, EM_TRACE);
+      g->ystack = l;
+      lmark_edges (g->ystack, NULL, EM_TRACE);
     }
 
-  list_t *yold = ystack;
+  list_t *yold = g->ystack;
 
   if (changed || maybe_longjmp)
-    update_call_stack (fun, call, maybe_longjmp);
+    update_call_stack (g, fun, call, maybe_longjmp);
 
   if (main_returns
-      && ystack
-      && (ystack->sym == graph.exit || ystack->sym == graph._exit))
+      && g->ystack
+      && (g->ystack->sym == g->exit || g->ystack->sym == g->_exit))
     {
       // main returns.  If immediately after return from main exit or _exit
       // are entered, show an edge from main to the respective function.
-      static char str[20];
-      byte *r24 = log_cpu_address (24, AR_REG);
+      byte *r24 = log_cpu_address (cx, 24, AR_REG);
       int16_t ret_val = r24[0] | (r24[1] << 8);
-      sprintf (str, "return %d", ret_val);
-      ystack->edge->s_label = str;
-      ystack->edge->mark |= EM_MAIN_RET | EM_DASHED;
+      sprintf (g->s_main_return, "return %d", ret_val);
+      g->ystack->edge->s_label = g->s_main_return;
+      g->ystack->edge->mark |= EM_MAIN_RET | EM_DASHED;
     }
 
-  if (!log_unused)
-    log_transition (yold, ystack, is_proep, s_pe);
+  if (!cx->log_unused)
+    log_transition (g, yold, g->ystack, is_proep, g->s_pe);
 
   if (is_proep == 2)
-    pro_ep = NULL;
+    g->pro_ep = NULL;
 
-  return ystack ? ystack->depth : 0;
+  return g->ystack ? g->ystack->depth : 0;
+}
+
+
+/* The lean loop of avrtest_log only reports the last instruction of each
+   basic block, which is where calls, returns and jumps are.  Whether a
+   RET follows a PUSH is taken from the flash instead.  */
+
+void
+graph_lean_call_depth (context_t *cx, const decoded_t *deco)
+{
+  graph_t *g = cx->graph;
+  unsigned pc = deco - cx->decoded;
+
+  cx->old_PC = pc;
+  g->id = pc ? cx->decoded[pc - 1].id : ID_NOP;
+  graph_update_call_depth (cx, deco);
 }
 
 
 static void
-write_dot_node (FILE *stream, symbol_t *n, const char *extra)
+write_dot_node (const graph_t *g, FILE *stream, symbol_t *n,
+                const char *extra)
 {
+  const context_t *cx = g->cx;
   if (n->dot_done)
     return;
   n->dot_done = true;
@@ -1062,11 +1132,12 @@ write_dot_node (FILE *stream, symbol_t *n, const char *extra)
     fprintf (stream, "\\n0x%x", 2 * n->pc);
 
   if (n->type == T_TERMINATE)
-    fprintf (stream, "\\ncycles:%u", program.n_cycles);
+    fprintf (stream, "\\ncycles:%"PRIu64, cx->program.n_cycles);
   else if (n->cycles.account && n->cycles.childs)
-    fprintf (stream, "\\nch:%u own:%u", n->cycles.childs, n->cycles.own);
+    fprintf (stream, "\\nch:%"PRIu64" own:%"PRIu64,
+             n->cycles.childs, n->cycles.own);
   else if (n->cycles.account)
-    fprintf (stream, "\\n    own:%u", n->cycles.own);
+    fprintf (stream, "\\n    own:%"PRIu64, n->cycles.own);
 
   fprintf (stream, "\"]"); // ] label
 
@@ -1075,7 +1146,7 @@ write_dot_node (FILE *stream, symbol_t *n, const char *extra)
            : n->is_base ? "box3d" : n->is_func ? "box"
            : "ellipse");
 
-  double per = graph.n_cycles ? (double) n->cycles.own / graph.n_cycles : 0.0;
+  double per = g->n_cycles ? (double) n->cycles.own / g->n_cycles : 0.0;
 
   if (n->type == T_ENTRY || n->type == T_TERMINATE)
     fprintf (stream, "[style=filled fillcolor=\"0.6 0.3 1\"]");
@@ -1089,8 +1160,10 @@ write_dot_node (FILE *stream, symbol_t *n, const char *extra)
 
 
 static void
-write_dot_edge (FILE *stream, edge_t *e, bool force, bool fat)
+write_dot_edge (const graph_t *g, FILE *stream, edge_t *e, bool force,
+                bool fat)
 {
+  const context_t *cx = g->cx;
   bool synthetic = e->from->type == T_ENTRY || e->to->type == T_TERMINATE;
   bool show = force || synthetic || (e->mark & (EM_SHOW | EM_ACCOUNT));
   bool back = e->mark & EM_BACK;
@@ -1102,9 +1175,9 @@ write_dot_edge (FILE *stream, edge_t *e, bool force, bool fat)
   e->mark |= EM_DOT_DONE;
 
   if (nfrom)
-    write_dot_node (stream, e->from, NULL);
+    write_dot_node (g, stream, e->from, NULL);
   if (nto)
-    write_dot_node (stream, e->to, NULL);
+    write_dot_node (g, stream, e->to, NULL);
 
   if (!show || !nfrom || !nto)
     return;
@@ -1147,7 +1220,7 @@ write_dot_edge (FILE *stream, edge_t *e, bool force, bool fat)
       fprintf (stream, "[label=\"%s", e->s_label ? e->s_label : "");
       fprintf (stream, "%s#%d%s", e->s_label ? "\\n" : "", e->n, s_dbg);
       if (e->n_cycles)
-        fprintf (stream, "\\n%u", e->n_cycles);
+        fprintf (stream, "\\n%"PRIu64, e->n_cycles);
       fprintf (stream, "\"]");
     }
 
@@ -1163,77 +1236,82 @@ write_dot_edge (FILE *stream, edge_t *e, bool force, bool fat)
 
 
 static const char*
-make_dot_filename (void)
+make_dot_filename (context_t *cx)
 {
-  if (options.do_graph_filename)
-    return (str_eq ("", options.s_graph_filename)
-            || str_eq ("-", options.s_graph_filename))
+  if (cx->options.do_graph_filename)
+    return (str_eq ("", cx->options.s_graph_filename)
+            || str_eq ("-", cx->options.s_graph_filename))
       ? NULL
-      : options.s_graph_filename;
+      : cx->options.s_graph_filename;
 
   const char *suffix = ".dot";
-  const char *p, *s = program.name;
+  const char *p, *s = cx->program.name;
   if ((p = strrchr (s, '/')))  s = p;
   if ((p = strrchr (s, '\\'))) s = p;
   size_t len = (p = strrchr (s, '.'))
-    ? (size_t) (p - program.name) - 1
-    : strlen (program.name);
+    ? (size_t) (p - cx->program.name) - 1
+    : strlen (cx->program.name);
 
-  char *fname = get_mem (len + 1 + strlen (suffix), sizeof (char), ".dot");
-  strncpy (fname, program.name, len);
+  char *fname = get_mem (cx, len + 1 + strlen (suffix), sizeof (char),
+                         ".dot");
+  strncpy (fname, cx->program.name, len);
   return strcat (fname, suffix);
 }
 
 
 void
-graph_write_dot (void)
+graph_write_dot (context_t *cx)
 {
-  if (!graph.entered)
+  graph_t *g = cx->graph;
+  const program_t *program = &cx->program;
+
+  if (!g->entered)
     return;
 
-  const char *fname = make_dot_filename ();
-  FILE *fdot = fname ? fopen (fname, "w") : stdout;
+  const char *fname = make_dot_filename (cx);
+  FILE *fdot = fname ? get_file (cx, fname, "w") : cx->out;
 
   if (!fdot)
-    leave (LEAVE_FATAL, "cannot open \"%s\" for writing", fname);
+    leave (cx, LEAVE_FATAL, "cannot open \"%s\" for writing", fname);
 
   char reason[20];
-  switch (program.leave_status)
+  switch (program->leave_status)
     {
-    case LEAVE_EXIT:  sprintf (reason, "exit %d", program.exit_value); break;
+    case LEAVE_EXIT:  sprintf (reason, "exit %d", program->exit_value); break;
     case LEAVE_ABORTED: strcpy (reason, "abort");   break;
     case LEAVE_TIMEOUT: strcpy (reason, "timeout"); break;
     default:            strcpy (reason, "unknown"); break;
     }
 
-  bool problem = (LEAVE_EXIT != program.leave_status
-                  || 0 != program.exit_value);
+  bool problem = (LEAVE_EXIT != program->leave_status
+                  || 0 != program->exit_value);
 
   // Add artificial node and edge representing program termination.
-  symbol_t *exit_point = graph_add_symbol ("Program Stop", old_PC, false);
+  symbol_t *exit_point = graph_add_symbol (g, "Program Stop", cx->old_PC,
+                                           false);
   exit_point->type = T_TERMINATE;
   exit_point->is_reserved = true;
-  update_call_stack (exit_point, 0, false);
+  update_call_stack (g, exit_point, 0, false);
 
   // Mark the way to the termination
-  lmark_edges (ystack, NULL, EM_TRACE);
+  lmark_edges (g->ystack, NULL, EM_TRACE);
 
-  fprintf (fdot, "digraph \"%s\"\n{\n", program.short_name);
+  fprintf (fdot, "digraph \"%s\"\n{\n", program->short_name);
 
-  write_dot_node (fdot, graph.entry_point, NULL);
-  write_dot_node (fdot, ystack->sym, reason);
-  write_dot_edge (fdot, graph.entry_edge, true, true);
-  write_dot_edge (fdot, ystack->edge, true, true);
+  write_dot_node (g, fdot, g->entry_point, NULL);
+  write_dot_node (g, fdot, g->ystack->sym, reason);
+  write_dot_edge (g, fdot, g->entry_edge, true, true);
+  write_dot_edge (g, fdot, g->ystack->edge, true, true);
 
   // Startup code before main is boring, use neat shortcut instead
   list_t *lmain;
-  if (!options.do_graph_all
-      && graph.no_startup_cycles
-      && yend && yend->edge == graph.entry_edge
-      && (lmain = lfind_type (T_MAIN)))
+  if (!cx->options.do_graph_all
+      && g->no_startup_cycles
+      && g->yend && g->yend->edge == g->entry_edge
+      && (lmain = lfind_type (g, T_MAIN)))
     {
       lmark_edges (lmain, NULL, EM_DOT_DONE);
-      edge_t *e = traverse_edge (yend->sym, graph.main, 0, false);
+      edge_t *e = traverse_edge (g, g->yend->sym, g->main, 0, false);
       e->n -= 0 != (e->mark & EM_DOT_DONE);
       e->mark |= EM_TRACE | EM_DASHED;
       e->mark &= ~EM_DOT_DONE;
@@ -1241,12 +1319,382 @@ graph_write_dot (void)
     }
 
   for (int i = 0; i < EPRIM; i++)
-    for (edge_t *e = ebucket[i]; e != NULL; e = e->next)
-      write_dot_edge (fdot, e, (e->mark & EM_TRACE) || options.do_graph_all,
+    for (edge_t *e = g->ebucket[i]; e != NULL; e = e->next)
+      write_dot_edge (g, fdot, e,
+                      (e->mark & EM_TRACE) || cx->options.do_graph_all,
                       (e->mark & EM_TRACE) && problem);
 
   fprintf (fdot, "}\n");
   fflush (fdot);
-  if (fdot != stdout)
-    fclose (fdot);
+  if (fdot != cx->out)
+    put_file (cx, fdot);
+}
+
+
+/* Checkpoints, cf. checkpoint.c:  The symbols, edges and lists are
+   saved as arrays, with IDs in place of the pointers between them.  */
+
+// The symbols that graph_t refers to.
+static const size_t special_symbol[] =
+  {
+    offsetof (graph_t, entry_point), offsetof (graph_t, base),
+    offsetof (graph_t, prologue_saves), offsetof (graph_t, epilogue_restores),
+    offsetof (graph_t, setjmp), offsetof (graph_t, longjmp),
+    offsetof (graph_t, main), offsetof (graph_t, exit),
+    offsetof (graph_t, _exit), offsetof (graph_t, abort),
+    offsetof (graph_t, pro_ep)
+  };
+
+#define N_SPECIAL (sizeof (special_symbol) / sizeof (*special_symbol))
+#define SPECIAL_SYMBOL(G, I) \
+  (* (symbol_t**) ((char*) (G) + special_symbol[I]))
+
+// The scalars of graph_t.
+typedef struct
+{
+  int id, old_id;
+  qword n_cycles, cycle;
+  int main_n_call;
+  unsigned main_pc;
+  bool no_startup_cycles, entered;
+  int n_edges, n_symbols;
+  char s_pe[50];
+  char s_main_return[20];
+  int entry_edge;
+  // IDs of the symbols from special_symbol[].
+  int special[N_SPECIAL];
+  // Lengths of the call stack, the free list and the func_sym[] map,
+  // and the bytes of all symbol names.
+  int n_ystack, n_yfree, n_map;
+  unsigned names_size;
+} saved_graph_t;
+
+typedef struct
+{
+  edge_t e;
+  int from, to;
+  // Whether e.s_label is s_main_return.
+  bool main_return;
+} saved_edge_t;
+
+typedef struct
+{
+  list_t l;
+  int edge, sym;
+} saved_list_t;
+
+typedef struct
+{
+  unsigned pc;
+  int sym;
+} saved_map_t;
+
+// The objects of a graph being restored by their IDs.
+typedef struct
+{
+  symbol_t *sym;
+  int n_symbols;
+  edge_t **edge;
+  int n_edges;
+} by_id_t;
+
+
+static void
+save_list (saved_list_t *sl, const list_t *l)
+{
+  for (; l; l = l->next, sl++)
+    {
+      sl->l = *l;
+      sl->l.next = sl->l.prev = NULL;
+      sl->l.sym = NULL;
+      sl->l.edge = NULL;
+      sl->l.res = NULL;
+      sl->edge = l->edge ? l->edge->id : 0;
+      sl->sym = l->sym ? l->sym->id : 0;
+    }
+}
+
+
+static void
+graph_save (context_t *cx)
+{
+  graph_t *g = cx->graph;
+  saved_graph_t st;
+  memset (&st, 0, sizeof (st));
+
+  st.id = g->id;
+  st.old_id = g->old_id;
+  st.n_cycles = g->n_cycles;
+  st.cycle = g->cycle;
+  st.main_n_call = g->main_return.n_call;
+  st.main_pc = g->main_return.pc;
+  st.no_startup_cycles = g->no_startup_cycles;
+  st.entered = g->entered;
+  st.n_edges = g->n_edges;
+  st.n_symbols = g->n_symbols;
+  memcpy (st.s_pe, g->s_pe, sizeof (st.s_pe));
+  memcpy (st.s_main_return, g->s_main_return, sizeof (st.s_main_return));
+  st.entry_edge = g->entry_edge ? g->entry_edge->id : 0;
+  for (size_t i = 0; i < N_SPECIAL; i++)
+    st.special[i] = SPECIAL_SYMBOL (g, i) ? SPECIAL_SYMBOL (g, i)->id : 0;
+
+  // The symbols in the order of their IDs, and their names in one go.
+  symbol_t *sym = get_mem (cx, g->n_symbols, sizeof (symbol_t),
+                           "checkpoint");
+  for (const symbol_t *s = g->symbols; s; s = s->next)
+    {
+      sym[s->id - 1] = *s;
+      st.names_size += 1 + strlen (s->name);
+    }
+
+  char *names = get_mem (cx, st.names_size, sizeof (char), "checkpoint");
+  for (int i = 0, pos = 0; i < g->n_symbols; i++)
+    {
+      strcpy (names + pos, sym[i].name);
+      pos += 1 + strlen (sym[i].name);
+      sym[i].name = NULL;
+      sym[i].next = NULL;
+    }
+
+  // The edges bucket by bucket, so that they are restored in order.
+  saved_edge_t *edge = get_mem (cx, g->n_edges, sizeof (saved_edge_t),
+                                "checkpoint");
+  saved_edge_t *se = edge;
+  for (int i = 0; i < EPRIM; i++)
+    for (const edge_t *e = g->ebucket[i]; e != NULL; e = e->next, se++)
+      {
+        se->e = *e;
+        se->e.next = NULL;
+        se->e.from = se->e.to = NULL;
+        se->e.s_tail = se->e.s_label = NULL;
+        se->from = e->from->id;
+        se->to = e->to->id;
+        se->main_return = e->s_label == g->s_main_return;
+      }
+
+  for (const list_t *l = g->ystack; l; l = l->next)
+    st.n_ystack++;
+  for (const list_t *l = g->yfree; l; l = l->next)
+    st.n_yfree++;
+  saved_list_t *list = get_mem (cx, st.n_ystack + st.n_yfree,
+                                sizeof (saved_list_t), "checkpoint");
+  save_list (list, g->ystack);
+  save_list (list + st.n_ystack, g->yfree);
+
+  for (unsigned pc = 0; pc < MAX_FLASH_SIZE / 2; pc++)
+    st.n_map += g->func_sym[pc] != NULL;
+  saved_map_t *map = get_mem (cx, st.n_map, sizeof (saved_map_t),
+                              "checkpoint");
+  for (unsigned pc = 0, k = 0; pc < MAX_FLASH_SIZE / 2; pc++)
+    if (g->func_sym[pc])
+      map[k++] = (saved_map_t) { pc, g->func_sym[pc]->id };
+
+  checkpoint_data (cx, false, "graph", &st, sizeof (st));
+  checkpoint_data (cx, false, "graph-symbols", sym,
+                   g->n_symbols * sizeof (symbol_t));
+  checkpoint_data (cx, false, "graph-names", names, st.names_size);
+  checkpoint_data (cx, false, "graph-edges", edge,
+                   g->n_edges * sizeof (saved_edge_t));
+  checkpoint_data (cx, false, "graph-lists", list,
+                   (st.n_ystack + st.n_yfree) * sizeof (saved_list_t));
+  checkpoint_data (cx, false, "graph-map", map,
+                   st.n_map * sizeof (saved_map_t));
+
+  put_mem (cx, map);
+  put_mem (cx, list);
+  put_mem (cx, edge);
+  put_mem (cx, names);
+  put_mem (cx, sym);
+}
+
+
+static void NORETURN
+bad_graph (context_t *cx, const char *tag)
+{
+  leave (cx, LEAVE_USAGE, "-restore=%s: bad section %s",
+         cx->options.s_restore, tag);
+}
+
+
+static void
+need_data (context_t *cx, const char *tag, void *p, size_t n)
+{
+  if (!checkpoint_data (cx, true, tag, p, n))
+    leave (cx, LEAVE_USAGE, "-restore=%s has no section %s",
+           cx->options.s_restore, tag);
+}
+
+
+static symbol_t*
+id_symbol (context_t *cx, const by_id_t *b, int id)
+{
+  if (id < 0 || id > b->n_symbols)
+    bad_graph (cx, "graph");
+  return id ? & b->sym[id - 1] : NULL;
+}
+
+
+static edge_t*
+id_edge (context_t *cx, const by_id_t *b, int id)
+{
+  if (id < 0 || id > b->n_edges || (id && !b->edge[id - 1]))
+    bad_graph (cx, "graph");
+  return id ? b->edge[id - 1] : NULL;
+}
+
+
+static list_t*
+restore_list (context_t *cx, const by_id_t *b, const saved_list_t *sl,
+              int n)
+{
+  list_t *head = NULL, *prev = NULL;
+
+  for (int i = 0; i < n; i++)
+    {
+      list_t *l = get_mem (cx, 1, sizeof (list_t), "list");
+      *l = sl[i].l;
+      l->edge = id_edge (cx, b, sl[i].edge);
+      l->sym = id_symbol (cx, b, sl[i].sym);
+      l->prev = prev;
+      if (prev)
+        prev->next = l;
+      else
+        head = l;
+      prev = l;
+    }
+
+  return head;
+}
+
+
+/* Replace the graph that the ELF symbols have set up by the one from the
+   checkpoint.  A checkpoint of avrtest has no graph:  Then the graph
+   starts at the point of the restore.  */
+
+static void
+graph_restore (context_t *cx)
+{
+  graph_t *g = cx->graph;
+  saved_graph_t st;
+
+  if (!checkpoint_data (cx, true, "graph", &st, sizeof (st)))
+    return;
+
+  if (st.n_symbols < 0 || st.n_edges < 0 || st.n_ystack < 1
+      || st.n_yfree < 0 || st.n_map < 0)
+    bad_graph (cx, "graph");
+
+  by_id_t b = { NULL, st.n_symbols, NULL, st.n_edges };
+
+  // The symbols, and their names which are NUL-terminated thanks to the
+  // extra byte from get_mem().
+  b.sym = get_mem (cx, st.n_symbols, sizeof (symbol_t), "symbol_t");
+  char *names = get_mem (cx, st.names_size + 1, sizeof (char), "names");
+  need_data (cx, "graph-symbols", b.sym, st.n_symbols * sizeof (symbol_t));
+  need_data (cx, "graph-names", names, st.names_size);
+
+  const char *name = names;
+  g->symbols = NULL;
+  for (int i = 0; i < st.n_symbols; i++)
+    {
+      symbol_t *s = & b.sym[i];
+      if (s->id != i + 1 || name >= names + st.names_size)
+        bad_graph (cx, "graph-symbols");
+      s->name = name;
+      name += 1 + strlen (name);
+      s->next = g->symbols;
+      g->symbols = s;
+    }
+
+  // The edges, appended to their buckets in the order they were saved.
+  saved_edge_t *se = get_mem (cx, st.n_edges, sizeof (saved_edge_t),
+                              "checkpoint");
+  need_data (cx, "graph-edges", se, st.n_edges * sizeof (saved_edge_t));
+
+  edge_t *edge = get_mem (cx, st.n_edges, sizeof (edge_t), "edge");
+  b.edge = get_mem (cx, st.n_edges, sizeof (edge_t*), "checkpoint");
+  edge_t **tail[EPRIM];
+  for (int i = 0; i < EPRIM; i++)
+    {
+      g->ebucket[i] = NULL;
+      tail[i] = & g->ebucket[i];
+    }
+
+  for (int i = 0; i < st.n_edges; i++)
+    {
+      edge_t *e = &edge[i];
+      *e = se[i].e;
+      e->from = id_symbol (cx, &b, se[i].from);
+      e->to = id_symbol (cx, &b, se[i].to);
+      if (e->id < 1 || e->id > st.n_edges || b.edge[e->id - 1]
+          || !e->from || !e->to)
+        bad_graph (cx, "graph-edges");
+      e->s_label = se[i].main_return ? g->s_main_return : NULL;
+      b.edge[e->id - 1] = e;
+
+      unsigned hash = (unsigned) (e->from->id - e->to->id) % EPRIM;
+      *tail[hash] = e;
+      tail[hash] = & e->next;
+    }
+
+  // The call stack and the free list.
+  saved_list_t *sl = get_mem (cx, st.n_ystack + st.n_yfree,
+                              sizeof (saved_list_t), "checkpoint");
+  need_data (cx, "graph-lists", sl,
+             (st.n_ystack + st.n_yfree) * sizeof (saved_list_t));
+
+  g->ystack = restore_list (cx, &b, sl, st.n_ystack);
+  g->yfree = restore_list (cx, &b, sl + st.n_ystack, st.n_yfree);
+  g->lnores = NULL;
+  for (g->yend = g->ystack; g->yend->next; g->yend = g->yend->next)
+    ;
+  for (const list_t *l = g->ystack; l; l = l->next)
+    if (!l->edge || !l->sym)
+      bad_graph (cx, "graph-lists");
+
+  saved_map_t *map = get_mem (cx, st.n_map, sizeof (saved_map_t),
+                              "checkpoint");
+  need_data (cx, "graph-map", map, st.n_map * sizeof (saved_map_t));
+  memset (g->func_sym, 0, sizeof (g->func_sym));
+  for (int i = 0; i < st.n_map; i++)
+    {
+      if (map[i].pc >= MAX_FLASH_SIZE / 2)
+        bad_graph (cx, "graph-map");
+      g->func_sym[map[i].pc] = id_symbol (cx, &b, map[i].sym);
+    }
+
+  g->id = st.id;
+  g->old_id = st.old_id;
+  g->n_cycles = st.n_cycles;
+  g->cycle = st.cycle;
+  g->main_return.n_call = st.main_n_call;
+  g->main_return.pc = st.main_pc;
+  g->no_startup_cycles = st.no_startup_cycles;
+  g->entered = st.entered;
+  g->n_edges = st.n_edges;
+  g->n_symbols = st.n_symbols;
+  memcpy (g->s_pe, st.s_pe, sizeof (st.s_pe));
+  memcpy (g->s_main_return, st.s_main_return, sizeof (st.s_main_return));
+  g->s_pe[sizeof (g->s_pe) - 1] = '\0';
+  g->s_main_return[sizeof (g->s_main_return) - 1] = '\0';
+  g->entry_edge = id_edge (cx, &b, st.entry_edge);
+  for (size_t i = 0; i < N_SPECIAL; i++)
+    SPECIAL_SYMBOL (g, i) = id_symbol (cx, &b, st.special[i]);
+
+  put_mem (cx, map);
+  put_mem (cx, sl);
+  put_mem (cx, b.edge);
+  put_mem (cx, se);
+}
+
+
+/* Add the call graph to a checkpoint, or get it back if RESTORE.  */
+
+void
+graph_checkpoint (context_t *cx, bool restore)
+{
+  if (restore)
+    graph_restore (cx);
+  else
+    graph_save (cx);
 }
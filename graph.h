@@ -26,10 +26,12 @@
 
 #include <stdbool.h>
 
-extern void graph_elf_symbol (const char*, size_t, unsigned, bool);
-extern void graph_set_string_table (char*, size_t, int);
-extern void graph_finish_string_table (void);
-extern int graph_update_call_depth (const decoded_t*);
-extern void graph_write_dot (void);
+extern void graph_open (context_t*);
+extern void graph_elf_symbol (context_t*, const char*, size_t, unsigned, bool);
+extern void graph_set_string_table (context_t*, char*, size_t, int);
+extern void graph_finish_string_table (context_t*);
+extern int graph_update_call_depth (context_t*, const decoded_t*);
+extern void graph_write_dot (context_t*);
+extern void graph_checkpoint (context_t*, bool);
 
 #endif // GRAPH_H
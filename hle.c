@@ -0,0 +1,781 @@
+/*
+  This file is part of avrtest -- A simple simulator for the
+  Atmel AVR family of microcontrollers designed to test the compiler.
+
+  Copyright (C) 2001, 2002, 2003   Theodore A. Roth, Klaus Rudolph
+  Copyright (C) 2007 Paulo Marques
+  Copyright (C) 2008-2026 Free Software Foundation, Inc.
+
+  avrtest is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 2 of the License, or
+  (at your option) any later version.
+
+  avrtest is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with avrtest; see the file COPYING.  If not, write to
+  the Free Software Foundation, 59 Temple Place - Suite 330,
+  Boston, MA 02111-1307, USA.  */
+
+/* High-level emulation (-hle) of routines from avr-libc and libgcc for
+   avrtest without logging:  The routines below are found by their ELF
+   symbols and run natively instead of instruction by instruction.
+
+   Each routine leaves the registers, SREG and memory exactly as the
+   implementation from avr-libc resp. libgcc does, including scratch
+   registers like X, Z and __tmp_reg__.  The costs in instructions and
+   cycles are not computed here but learned by execute() from runs of
+   the routine in the interpreter:  Per variant, i.e. the way the routine
+   returns, they are linear in the size of the input.  As long as the
+   line is not confirmed by HLE_SAMPLES runs, the routine runs in the
+   interpreter, and execute() compares its results to the ones of the
+   emulation.  If the program brings its own version of a routine, the
+   results or costs differ, and execute() won't emulate it.
+
+   __do_copy_data and __do_clear_bss from the startup code run only once,
+   hence they compute their costs from the decoded code instead.  They
+   are recognized by the shape of their code, which must be the one from
+   libgcc up to the registers and addresses.
+
+   Routines only cover inputs in plain RAM, i.e. no I/O and, for
+   avrtest-tiny, no flash as seen in the data address space.  For other
+   inputs, the routine runs in the interpreter.  */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "testavr.h"
+#include "options.h"
+#include "sreg.h"
+#include "flag-tables.h"
+#include "hle.h"
+
+// Number of interpreted runs that must agree on the costs of a variant
+// before the routine is emulated for that variant.
+#define HLE_SAMPLES 3
+
+#define TMP_REG   (is_tiny ? 16 : 0)
+#define ZERO_REG  (is_tiny ? 17 : 1)
+
+static INLINE unsigned
+get_word (const byte *reg, int regno)
+{
+  return reg[regno] | (reg[regno + 1] << 8);
+}
+
+static INLINE void
+put_word (byte *reg, int regno, unsigned value)
+{
+  reg[regno] = value;
+  reg[regno + 1] = value >> 8;
+}
+
+static INLINE uint32_t
+get_dword (const byte *reg, int regno)
+{
+  return get_word (reg, regno) | (uint32_t) get_word (reg, regno + 2) << 16;
+}
+
+static INLINE void
+put_dword (byte *reg, int regno, uint32_t value)
+{
+  put_word (reg, regno, value);
+  put_word (reg, regno + 2, value >> 16);
+}
+
+// Whether the N bytes starting at ADDR are plain RAM.
+
+static bool
+in_ram (const hle_state_t *s, unsigned addr, unsigned n)
+{
+  unsigned end = s->cx->ram_end + 1;
+  if (is_tiny && end > 0x4000)
+    end = 0x4000;
+  return addr >= s->cx->ram_start && addr <= end && n <= end - addr;
+}
+
+// SREG after RD - RR - CARRY as of SUB, SUBI, SBC and SBCI, the latter
+// two with STICKY_Z.  The flags are the ones from execute().
+
+static int
+sreg_sub (int sreg, int rd, int rr, int carry, bool sticky_z)
+{
+  int flags
+    = flag_update_table_sub8[FUT_ADD_SUB_INDEX (rd, rr, rd - rr - carry)];
+  if (sticky_z)
+    flags &= sreg | ~FLAG_Z;
+  return (sreg & (FLAG_I | FLAG_T)) | flags;
+}
+
+// SREG after RD + RR + CARRY as of ADD and ADC.
+
+static int
+sreg_add (int sreg, int rd, int rr, int carry)
+{
+  int flags
+    = flag_update_table_add8[FUT_ADD_SUB_INDEX (rd, rr, rd + rr + carry)];
+  return (sreg & (FLAG_I | FLAG_T)) | flags;
+}
+
+// SREG after the loop counter R21:R20 of memcpy and memset ran out,
+// i.e. after SUBI R20,1 and SBCI R21,0 with R21:R20 = 0.
+
+static int
+sreg_count_out (int sreg)
+{
+  sreg = sreg_sub (sreg, 0, 1, 0, false);
+  return sreg_sub (sreg, 0, 0, 1, true);
+}
+
+
+/* void* memcpy (void *R24, const void *R22, size_t R20) from avr-libc
+
+       movw  ZL, r22
+       movw  XL, r24
+       rjmp  2f
+   1:  ld    __tmp_reg__, Z+
+       st    X+, __tmp_reg__
+   2:  subi  r20, lo8(1)
+       sbci  r21, hi8(1)
+       brcc  1b
+       ret  */
+
+static bool
+scan_memcpy (hle_state_t *s)
+{
+  unsigned n = get_word (s->reg, 20);
+  s->variant = 0;
+  s->size = n;
+  return (in_ram (s, get_word (s->reg, 24), n)
+          && in_ram (s, get_word (s->reg, 22), n));
+}
+
+static void
+run_memcpy (hle_state_t *s)
+{
+  unsigned dst = get_word (s->reg, 24);
+  unsigned src = get_word (s->reg, 22);
+  unsigned n = get_word (s->reg, 20);
+
+  // Byte by byte like the original so that overlapping works the same.
+  for (unsigned i = 0; i < n; i++)
+    s->data[dst + i] = s->data[src + i];
+
+  if (n)
+    s->reg[TMP_REG] = s->data[dst + n - 1];
+  put_word (s->reg, REGX, dst + n);
+  put_word (s->reg, REGZ, src + n);
+  put_word (s->reg, 20, 0xffff);
+  s->sreg = sreg_count_out (s->sreg);
+}
+
+
+/* void* memset (void *R24, int R22, size_t R20) from avr-libc
+
+       movw  XL, r24
+       rjmp  2f
+   1:  st    X+, r22
+   2:  subi  r20, lo8(1)
+       sbci  r21, hi8(1)
+       brcc  1b
+       ret  */
+
+static bool
+scan_memset (hle_state_t *s)
+{
+  unsigned n = get_word (s->reg, 20);
+  s->variant = 0;
+  s->size = n;
+  return in_ram (s, get_word (s->reg, 24), n);
+}
+
+static void
+run_memset (hle_state_t *s)
+{
+  unsigned dst = get_word (s->reg, 24);
+  unsigned n = get_word (s->reg, 20);
+
+  memset (s->data + dst, s->reg[22], n);
+
+  put_word (s->reg, REGX, dst + n);
+  put_word (s->reg, 20, 0xffff);
+  s->sreg = sreg_count_out (s->sreg);
+}
+
+
+/* size_t strlen (const char *R24) from avr-libc
+
+       movw  ZL, r24
+   1:  ld    __tmp_reg__, Z+
+       tst   __tmp_reg__
+       brne  1b
+       com   r24
+       com   r25
+       add   r24, ZL
+       adc   r25, ZH
+       ret  */
+
+static bool
+scan_strlen (hle_state_t *s)
+{
+  unsigned str = get_word (s->reg, 24);
+
+  for (unsigned n = 0; in_ram (s, str, n + 1); n++)
+    if (s->data[str + n] == 0)
+      {
+        s->variant = 0;
+        s->size = n;
+        return true;
+      }
+
+  return false;
+}
+
+static void
+run_strlen (hle_state_t *s)
+{
+  unsigned str = get_word (s->reg, 24);
+  unsigned z = (str + s->size + 1) & 0xffff;
+  unsigned lo = (~str & 0xff) + (z & 0xff);
+
+  s->reg[TMP_REG] = 0;
+  put_word (s->reg, REGZ, z);
+  put_word (s->reg, 24, s->size);
+  s->sreg = sreg_add (s->sreg, ~str >> 8 & 0xff, z >> 8, lo >> 8);
+}
+
+
+/* int strcmp (const char *R24, const char *R22) from avr-libc
+
+       movw  ZL, r22
+       movw  XL, r24
+   1:  ld    r24, X+
+       ld    __tmp_reg__, Z+
+       sub   r24, __tmp_reg__
+       cpse  __tmp_reg__, __zero_reg__
+       breq  1b
+       sbc   r25, r25
+       ret
+
+   Variant 0 returns by CPSE skipping the BREQ, variant 1 by the BREQ
+   not being taken.  */
+
+static bool
+scan_strcmp (hle_state_t *s)
+{
+  unsigned s1 = get_word (s->reg, 24);
+  unsigned s2 = get_word (s->reg, 22);
+  int zero = s->reg[ZERO_REG];
+
+  for (unsigned n = 0; in_ram (s, s1, n + 1) && in_ram (s, s2, n + 1); n++)
+    {
+      int c1 = s->data[s1 + n];
+      int c2 = s->data[s2 + n];
+      if (c2 == zero || c1 != c2)
+        {
+          s->variant = c2 != zero;
+          s->size = n + 1;
+          return true;
+        }
+    }
+
+  return false;
+}
+
+static void
+run_strcmp (hle_state_t *s)
+{
+  unsigned s1 = get_word (s->reg, 24);
+  unsigned s2 = get_word (s->reg, 22);
+  unsigned n = s->size;
+  int c1 = s->data[s1 + n - 1];
+  int c2 = s->data[s2 + n - 1];
+  int hi = s->reg[25];
+
+  s->sreg = sreg_sub (s->sreg, c1, c2, 0, false);
+  int carry = (s->sreg & FLAG_C) != 0;
+  s->sreg = sreg_sub (s->sreg, hi, hi, carry, true);
+
+  s->reg[24] = c1 - c2;
+  s->reg[25] = -carry;
+  s->reg[TMP_REG] = c2;
+  put_word (s->reg, REGX, s1 + n);
+  put_word (s->reg, REGZ, s2 + n);
+}
+
+
+/* R18 = R22 / R18, R22 = R22 % R18 for 32-bit unsigned from libgcc.
+   The remainder is also returned in R27:R26 and R31:R30.
+
+       ldi   r26, 33
+       mov   __zero_reg__, r26
+       sub   r26, r26
+       sub   r27, r27
+       movw  r30, r26
+       rjmp  2f
+   1:  rol   r26  ...  rol r31     ; shift dividend into remainder
+       cp    r26, r18  ...  cpc r31, r21
+       brcs  2f
+       sub   r26, r18  ...  sbc r31, r21
+   2:  rol   r22  ...  rol r25     ; shift quotient bit into dividend
+       dec   __zero_reg__
+       brne  1b
+       com   r22  ...  com r25
+       movw  r18, r22
+       movw  r20, r24
+       movw  r22, r26
+       movw  r24, r30
+       ret
+
+   The size is the number of subtractions.  */
+
+static unsigned
+udivmodsi4 (const byte *reg, uint32_t *quot, uint32_t *rem, int *h)
+{
+  uint32_t a = get_dword (reg, 22);
+  uint32_t b = get_dword (reg, 18);
+  uint32_t r = 0;
+  unsigned carry = 0, n_subs = 0;
+
+  for (int i = 0; i <= 32; i++)
+    {
+      if (i > 0)
+        {
+          r = (r << 1) | carry;
+          carry = r < b;
+          if (!carry)
+            {
+              r -= b;
+              n_subs++;
+            }
+        }
+      // H as of ROL R25.
+      *h = (a >> 27) & 1;
+      unsigned out = a >> 31;
+      a = (a << 1) | carry;
+      carry = out;
+    }
+
+  *quot = ~a;
+  *rem = r;
+  return n_subs;
+}
+
+static bool
+scan_udivmodsi4 (hle_state_t *s)
+{
+  uint32_t quot, rem;
+  int h;
+  s->variant = 0;
+  s->size = udivmodsi4 (s->reg, &quot, &rem, &h);
+  return true;
+}
+
+static void
+run_udivmodsi4 (hle_state_t *s)
+{
+  uint32_t quot, rem;
+  int h;
+  udivmodsi4 (s->reg, &quot, &rem, &h);
+
+  // SREG as of COM R25.  H is from the last ROL R25.
+  s->sreg = ((s->sreg & (FLAG_I | FLAG_T))
+             | (h ? FLAG_H : 0)
+             | flag_update_table_logical[quot >> 24]
+             | FLAG_C);
+
+  put_dword (s->reg, 18, quot);
+  put_dword (s->reg, 22, rem);
+  put_word (s->reg, REGX, rem);
+  put_word (s->reg, REGZ, rem >> 16);
+  s->reg[ZERO_REG] = 0;
+}
+
+
+/* The loops from libgcc's startup code that initialize .data and .bss.
+   They run only once and don't return, but fall through to the next
+   init section.
+
+   __do_copy_data:                        __do_clear_bss:
+       ldi   r17, hi8(__data_end)             ldi   r17, hi8(__bss_end)
+       ldi   r26, lo8(__data_start)           ldi   r26, lo8(__bss_start)
+       ldi   r27, hi8(__data_start)           ldi   r27, hi8(__bss_start)
+       ldi   r30, lo8(__data_load_start)      rjmp  2f
+       ldi   r31, hi8(__data_load_start)  1:  st    X+, __zero_reg__
+      [ldi   r16, hh8(__data_load_start)  2:  cpi   r26, lo8(__bss_end)
+       out   __RAMPZ__, r16]                  cpc   r27, r17
+       rjmp  2f                               brne  1b
+   1:  lpm   r0, Z+
+       st    X+, r0
+   2:  cpi   r26, lo8(__data_end)
+       cpc   r27, r17
+       brne  1b
+
+   With RAMPZ, the load is ELPM.  AVR_TINY uses R18 and R19, and loads by
+   LD R19, Z+ from the flash as seen at 0x4000.  The size is the number
+   of bytes.  */
+
+typedef struct
+{
+  // The registers after the LDIs, and RAMPZ after the OUT, or -1.
+  byte reg[0x20];
+  int rampz;
+  // The first instruction of the routine, of the loop and of the
+  // comparison.
+  const decoded_t *entry, *loop, *cmp;
+  // The load of __do_copy_data or NULL, and the store.
+  const decoded_t *load, *store;
+  // Destination, its end and the number of bytes.  The source is a byte
+  // address in flash, including RAMPZ, resp. a data address for tiny.
+  unsigned x0, end, n, src;
+  unsigned next_pc;
+} init_loop_t;
+
+static bool
+init_loop (const hle_state_t *s, init_loop_t *l, bool copy)
+{
+  const decoded_t *code = s->cx->decoded;
+  const unsigned mask = s->cx->pc_mask;
+  const unsigned rampz = 0x3b + io_base;
+  unsigned pc = s->pc;
+
+  memcpy (l->reg, s->reg, sizeof (l->reg));
+  l->rampz = -1;
+  l->entry = & code[pc];
+
+  // LDIs and the OUT to RAMPZ up to the RJMP to the comparison.
+  for (;; pc++)
+    {
+      const decoded_t *d = & code[pc];
+      if (pc >= mask || pc - s->pc > 8)
+        return false;
+      else if (d->id == ID_LDI)
+        l->reg[d->op1] = d->op2;
+      else if (d->id == ID_OUT && d->op2 == rampz)
+        l->rampz = l->reg[d->op1];
+      else if (d->id == ID_RJMP)
+        break;
+      else
+        return false;
+    }
+
+  unsigned cmp = (pc + 1 + (int16_t) code[pc].op2) & mask;
+  if (l->entry->block_insns != pc + 1 - s->pc
+      || cmp + 3 > mask)
+    return false;
+
+  l->loop = & code[++pc];
+  l->load = copy ? & code[pc++] : NULL;
+  l->store = & code[pc++];
+  l->cmp = & code[cmp];
+
+  int load_id = is_tiny ? ID_LD_Z_incr
+    : l->rampz >= 0 ? ID_ELPM_Z_incr
+    : ID_LPM_Z_incr;
+  int rt = l->store->op1;
+  const decoded_t *cpi = l->cmp, *cpc = cpi + 1, *brne = cpi + 2;
+
+  if ((l->load && (l->load->id != load_id || l->load->op1 != rt))
+      || l->store->id != ID_ST_X_incr
+      || rt >= REGX
+      || cmp != pc
+      || cpi->id != ID_CPI || cpi->op1 != REGX
+      || cpc->id != ID_CPC || cpc->op1 != REGX + 1
+      || cpc->op2 >= REGX || (l->load && cpc->op2 == rt)
+      || brne->id != ID_BRBC || brne->op2 != FLAG_Z
+      || (int) (cmp + 3) + (int8_t) brne->op1 != l->loop - code
+      || l->loop->block_insns != cmp + 3 - (l->loop - code)
+      || cpi->block_insns != 3)
+    return false;
+
+  l->x0 = get_word (l->reg, REGX);
+  l->end = cpi->op2 | (l->reg[cpc->op2] << 8);
+  l->n = (l->end - l->x0) & 0xffff;
+  l->src = get_word (l->reg, REGZ) | (l->rampz >= 0 ? l->rampz << 16 : 0);
+  l->next_pc = cmp + 3;
+
+  if (!in_ram (s, l->x0, l->n))
+    return false;
+
+  // Reduced Tiny sees its flash at 0x4000.
+  return (!copy || !is_tiny || l->n == 0
+          || (l->src >= 0x4000 && l->src + l->n <= 0x8000));
+}
+
+// The byte that the copy loop L loads in round I.
+
+static int
+init_loop_load (const hle_state_t *s, const init_loop_t *l, unsigned i)
+{
+  const context_t *cx = s->cx;
+  unsigned addr = l->src + i;
+  if (is_tiny)
+    addr -= 0x4000;
+  else if (l->rampz < 0)
+    addr &= 0xffff;
+  return cx->flash[addr & (2 * cx->pc_mask + 1)];
+}
+
+static void
+run_init_loop (hle_state_t *s, const init_loop_t *l)
+{
+  unsigned n = l->n;
+  int lo = l->end & 0xff;
+  int hi = l->end >> 8;
+
+  for (unsigned i = 0; i < n; i++)
+    s->data[l->x0 + i] = l->load
+      ? init_loop_load (s, l, i)
+      : l->reg[l->store->op1];
+
+  memcpy (s->reg, l->reg, sizeof (l->reg));
+  if (l->load)
+    {
+      unsigned z = l->src + n;
+      if (n)
+        s->reg[l->store->op1] = init_loop_load (s, l, n - 1);
+      put_word (s->reg, REGZ, z);
+      if (l->rampz >= 0)
+        s->data[0x3b + io_base] = z >> 16;
+    }
+  put_word (s->reg, REGX, l->end);
+
+  // SREG as of CPI and CPC with X = END.
+  s->sreg = sreg_sub (s->sreg, lo, lo, 0, false);
+  s->sreg = sreg_sub (s->sreg, hi, hi, 0, true);
+}
+
+// Each round takes one more cycle for the BRNE.  On XMEGA and Reduced
+// Tiny, ST X+ takes one cycle less.  So does LD Z+ on Reduced Tiny, but
+// reading the flash takes that cycle back.
+
+static bool
+cost_init_loop (const hle_state_t *s, dword *insns, dword *cycles,
+                bool copy)
+{
+  init_loop_t l;
+  if (!init_loop (s, &l, copy))
+    return false;
+
+  int round = l.loop->block_cycles + 1 - (is_xmega || is_tiny);
+  *insns = l.entry->block_insns + l.cmp->block_insns
+    + l.n * l.loop->block_insns;
+  *cycles = l.entry->block_cycles + l.cmp->block_cycles + l.n * round;
+  return true;
+}
+
+static bool
+scan_init_loop (hle_state_t *s, bool copy)
+{
+  init_loop_t l;
+  if (!init_loop (s, &l, copy))
+    return false;
+
+  s->variant = 0;
+  s->size = l.n;
+  s->next_pc = l.next_pc;
+  return true;
+}
+
+static bool
+scan_do_copy_data (hle_state_t *s)
+{
+  return scan_init_loop (s, true);
+}
+
+static void
+run_do_copy_data (hle_state_t *s)
+{
+  init_loop_t l;
+  if (init_loop (s, &l, true))
+    run_init_loop (s, &l);
+}
+
+static bool
+cost_do_copy_data (const hle_state_t *s, dword *insns, dword *cycles)
+{
+  return cost_init_loop (s, insns, cycles, true);
+}
+
+static bool
+scan_do_clear_bss (hle_state_t *s)
+{
+  return scan_init_loop (s, false);
+}
+
+static void
+run_do_clear_bss (hle_state_t *s)
+{
+  init_loop_t l;
+  if (init_loop (s, &l, false))
+    run_init_loop (s, &l);
+}
+
+static bool
+cost_do_clear_bss (const hle_state_t *s, dword *insns, dword *cycles)
+{
+  return cost_init_loop (s, insns, cycles, false);
+}
+
+
+#define HLE_ROUTINE(NAME, FUNC, NO_TINY)                 \
+  { .name = NAME, .scan = scan_ ## FUNC, .run = run_ ## FUNC,   \
+    .no_tiny = NO_TINY, .pc = -1U }
+
+#define HLE_INIT_ROUTINE(NAME, FUNC)                            \
+  { .name = NAME, .scan = scan_ ## FUNC, .run = run_ ## FUNC,   \
+    .compute = cost_ ## FUNC, .pc = -1U }
+
+static const hle_routine_t routines[] =
+  {
+    HLE_ROUTINE ("memcpy", memcpy, false),
+    HLE_ROUTINE ("memset", memset, false),
+    HLE_ROUTINE ("strlen", strlen, false),
+    HLE_ROUTINE ("strcmp", strcmp, false),
+    // libgcc uses different registers for AVR_TINY.
+    HLE_ROUTINE ("__udivmodsi4", udivmodsi4, true),
+    HLE_INIT_ROUTINE ("__do_copy_data", do_copy_data),
+    HLE_INIT_ROUTINE ("__do_clear_bss", do_clear_bss),
+    { .name = NULL }
+  };
+
+#undef HLE_ROUTINE
+#undef HLE_INIT_ROUTINE
+
+
+// The ELF file has a symbol table:  With -hle, set up the routines of
+// CX from routines[].  They learn their addresses and costs as the
+// program runs, hence each context has its own copy.
+
+void
+hle_set_string_table (context_t *cx)
+{
+  if (!cx->options.do_hle || cx->hle_routines)
+    return;
+
+  cx->hle_routines = get_mem (cx, sizeof (routines) / sizeof (*routines),
+                              sizeof (hle_routine_t), "-hle");
+  memcpy (cx->hle_routines, routines, sizeof (routines));
+}
+
+void
+hle_set_function_symbol (context_t *cx, int addr, size_t offset)
+{
+  if (!cx->hle_routines
+      || !cx->strtab
+      || offset >= cx->strtab_size
+      || addr % 2 != 0
+      || (unsigned) addr >= 2 * (cx->pc_mask + 1))
+    return;
+
+  for (hle_routine_t *r = cx->hle_routines; r->name; r++)
+    if (str_eq (r->name, cx->strtab + offset)
+        && !(is_tiny && r->no_tiny))
+      r->pc = addr / 2;
+}
+
+// The routine that starts at word address PC, or NULL.
+
+hle_routine_t*
+hle_routine (context_t *cx, unsigned pc)
+{
+  if (cx->hle_routines)
+    for (hle_routine_t *r = cx->hle_routines; r->name; r++)
+      if (r->pc == pc)
+        return r;
+  return NULL;
+}
+
+// The costs of running R on S as learned by hle_learn() resp. computed,
+// or false if they are not known yet.
+
+bool
+hle_cost (const hle_routine_t *r, const hle_state_t *s,
+          dword *insns, dword *cycles)
+{
+  if (r->compute)
+    return r->compute (s, insns, cycles);
+
+  const hle_cost_t *c = & r->cost[s->variant];
+  int64_t dx = (int64_t) s->size - c->x0;
+
+  if (c->bad
+      || c->n_samples < HLE_SAMPLES
+      || (dx != 0 && !c->have_slope))
+    return false;
+
+  *insns = c->insns0 + dx * c->d_insns;
+  *cycles = c->cycles0 + dx * c->d_cycles;
+  return true;
+}
+
+// Add a run of R on S in the interpreter that took INSNS instructions
+// and CYCLES cycles to the cost model of R.  Return false if the costs
+// are not linear in the size.  Computed costs are not learned.
+
+bool
+hle_learn (hle_routine_t *r, const hle_state_t *s, dword insns, dword cycles)
+{
+  if (r->compute)
+    return true;
+
+  hle_cost_t *c = & r->cost[s->variant];
+  int64_t dx = (int64_t) s->size - c->x0;
+  int64_t di = (int64_t) insns - c->insns0;
+  int64_t dc = (int64_t) cycles - c->cycles0;
+
+  if (c->bad)
+    return false;
+
+  if (c->n_samples == 0)
+    {
+      c->x0 = s->size;
+      c->insns0 = insns;
+      c->cycles0 = cycles;
+    }
+  else if (dx == 0 || c->have_slope)
+    c->bad = di != dx * c->d_insns || dc != dx * c->d_cycles;
+  else if (di % dx != 0 || dc % dx != 0)
+    c->bad = true;
+  else
+    {
+      c->have_slope = true;
+      c->d_insns = di / dx;
+      c->d_cycles = dc / dx;
+    }
+
+  c->n_samples++;
+  return !c->bad;
+}
+
+// SPM changed the flash, so the routines may no longer be where the
+// symbols from the ELF file say.  Leave all of them to the interpreter.
+
+void
+hle_forget (context_t *cx)
+{
+  if (cx->hle_routines)
+    for (hle_routine_t *r = cx->hle_routines; r->name; r++)
+      r->off = true;
+}
+
+// -hle-verify, -hle -v:  Print which routines have been found and how
+// they ran.
+
+void
+hle_print_stats (context_t *cx)
+{
+  fprintf (cx->out, "\n emulated routines:\n");
+
+  if (cx->hle_routines)
+    for (const hle_routine_t *r = cx->hle_routines; r->name; r++)
+      if (r->pc != -1U)
+        fprintf (cx->out, "  %-14s  %06x  %10u native  %10u "
+                 "interpreted%s\n", r->name, 2 * r->pc, r->n_native,
+                 r->n_interpreted, r->off ? "  (off)" : "");
+}
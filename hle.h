@@ -0,0 +1,108 @@
+/*
+  This file is part of avrtest -- A simple simulator for the
+  Atmel AVR family of microcontrollers designed to test the compiler.
+
+  Copyright (C) 2001, 2002, 2003   Theodore A. Roth, Klaus Rudolph
+  Copyright (C) 2007 Paulo Marques
+  Copyright (C) 2008-2026 Free Software Foundation, Inc.
+
+  avrtest is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 2 of the License, or
+  (at your option) any later version.
+
+  avrtest is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with avrtest; see the file COPYING.  If not, write to
+  the Free Software Foundation, 59 Temple Place - Suite 330,
+  Boston, MA 02111-1307, USA.  */
+
+#ifndef HLE_H
+#define HLE_H
+
+#include <stdbool.h>
+
+// The machine state a routine works on.  REG is the register file and
+// DATA the data address space.  For avrtest without ISA_XMEGA and
+// ISA_TINY, REG is the start of DATA.
+typedef struct
+{
+  // The context the routine runs in.
+  const context_t *cx;
+  byte *reg;
+  byte *data;
+  byte sreg;
+
+  // Set by the routine's scan function:  The way the routine returns and
+  // the size of its input, e.g. the number of bytes to copy.  These are
+  // the inputs of the cost model.
+  int variant;
+  unsigned size;
+
+  // The word address of the routine.  Routines from the startup code
+  // don't return but fall through to the next init section:  Their scan
+  // function sets NEXT_PC to where the code goes on.  -1U for a RET.
+  unsigned pc, next_pc;
+} hle_state_t;
+
+#define HLE_VARIANTS 2
+
+// The costs of one variant of a routine as learned from interpreted runs:
+// A line through (X0, INSNS0, CYCLES0) with slopes D_INSNS and D_CYCLES
+// per unit of size.
+typedef struct
+{
+  int n_samples;
+  bool have_slope, bad;
+  unsigned x0;
+  dword insns0, cycles0;
+  int d_insns, d_cycles;
+} hle_cost_t;
+
+typedef struct hle_routine
+{
+  const char *name;
+
+  // Whether the inputs from the registers are in the range the routine
+  // covers.  If so, set variant and size.  Doesn't change the state.
+  bool (*scan) (hle_state_t*);
+
+  // Apply the effects of the routine as if it ran up to and including
+  // its RET, except for popping the return address, resp. up to NEXT_PC.
+  void (*run) (hle_state_t*);
+
+  // The costs of the routines from the startup code, which run only once
+  // and hence can't learn them, as computed from the code.  NULL for
+  // routines with learned costs.
+  bool (*compute) (const hle_state_t*, dword*, dword*);
+
+  // Not available for avrtest-tiny.
+  bool no_tiny;
+
+  // Word address of the routine as of the ELF symbol table, or -1U.
+  unsigned pc;
+
+  // The handler the routine's first instruction had without -hle.
+  const void *handler;
+
+  // Whether the routine's results or costs turned out not to match.
+  bool off;
+
+  hle_cost_t cost[HLE_VARIANTS];
+  dword n_native, n_interpreted;
+} hle_routine_t;
+
+extern void hle_set_string_table (context_t*);
+extern void hle_set_function_symbol (context_t*, int, size_t);
+extern hle_routine_t* hle_routine (context_t*, unsigned);
+extern bool hle_cost (const hle_routine_t*, const hle_state_t*,
+                      dword*, dword*);
+extern bool hle_learn (hle_routine_t*, const hle_state_t*, dword, dword);
+extern void hle_forget (context_t*);
+extern void hle_print_stats (context_t*);
+
+#endif // HLE_H
@@ -0,0 +1,228 @@
+/*
+  This file is part of avrtest -- A simple simulator for the
+  Atmel AVR family of microcontrollers designed to test the compiler.
+
+  Copyright (C) 2001, 2002, 2003   Theodore A. Roth, Klaus Rudolph
+  Copyright (C) 2007 Paulo Marques
+  Copyright (C) 2008-2026 Free Software Foundation, Inc.
+
+  avrtest is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 2 of the License, or
+  (at your option) any later version.
+
+  avrtest is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with avrtest; see the file COPYING.  If not, write to
+  the Free Software Foundation, 59 Temple Place - Suite 330,
+  Boston, MA 02111-1307, USA.  */
+
+/* Events and interrupts.
+
+   An event is a function that runs when the cycle counter reaches a
+   given value.  The events of a context are kept in a binary min-heap
+   ordered by their cycles so that the next one is always event[0].
+   execute() does not poll them per instruction.  It compares the cycle
+   counter against program.event_cycles at the end of each basic block,
+   and -1 there means there is nothing to do.  Hence a program without
+   events only pays one compare per block.
+
+   Events raise interrupts by their vector number.  While an interrupt
+   is pending, event_cycles is 0 so that execute() looks at it after
+   each block, and vectors to the pending interrupt with the lowest
+   number as soon as the I flag is set.  After RETI, at least one more
+   instruction of the interrupted code runs before the next interrupt is
+   served, hence interrupts that are always pending don't starve the
+   main program.
+
+   A due checkpoint, cf. checkpoint.c, is no event:  It must not keep a
+   sleeping program from running into a deadlock.  It only lowers
+   event_cycles to checkpoint_cycles.  Likewise, -fork-server polls the
+   program counter after each block by means of event_poll().  */
+
+#include <string.h>
+
+#include "testavr.h"
+#include "options.h"
+#include "irq.h"
+
+static bool
+irq_pending (const context_t *cx)
+{
+  for (int i = 0; i < MAX_IRQS / 32; i++)
+    if (cx->irq_pending[i])
+      return true;
+  return false;
+}
+
+// Tell execute() when it has to call events_run() or irq_take() next.
+
+static void
+set_event_cycles (context_t *cx)
+{
+  cx->program.event_cycles = irq_pending (cx) || cx->poll
+    ? 0
+    : cx->n_events && cx->event[0].cycles < cx->checkpoint_cycles
+    ? cx->event[0].cycles
+    : cx->checkpoint_cycles;
+}
+
+void
+events_init (context_t *cx)
+{
+  cx->n_events = 0;
+  memset (cx->irq_pending, 0, sizeof (cx->irq_pending));
+  cx->reti_cycles = (qword) -1;
+  cx->checkpoint_cycles = (qword) -1;
+  set_event_cycles (cx);
+}
+
+// Have execute() call do_events() once the cycle counter reaches CYCLES
+// so that it writes a checkpoint.  -1 means no checkpoint.
+
+void
+event_checkpoint (context_t *cx, qword cycles)
+{
+  cx->checkpoint_cycles = cycles;
+  set_event_cycles (cx);
+}
+
+// Have execute() call do_events() after each basic block while ON.
+
+void
+event_poll (context_t *cx, bool on)
+{
+  cx->poll = on;
+  set_event_cycles (cx);
+}
+
+// Run FIRE (CX, ARG) when the cycle counter reaches CYCLES.
+
+void
+event_schedule (context_t *cx, qword cycles,
+                void (*fire) (context_t*, int), int arg)
+{
+  if (cx->n_events == MAX_EVENTS)
+    leave (cx, LEAVE_ABORTED, "more than %d pending events", MAX_EVENTS);
+
+  // Sift up.
+  int i = cx->n_events++;
+  for (; i > 0 && cx->event[(i - 1) / 2].cycles > cycles; i = (i - 1) / 2)
+    cx->event[i] = cx->event[(i - 1) / 2];
+  cx->event[i] = (event_t) { cycles, fire, arg };
+
+  set_event_cycles (cx);
+}
+
+// Remove event[I] from the heap and return it.
+
+static event_t
+event_remove (context_t *cx, int i)
+{
+  event_t e = cx->event[i];
+  event_t last = cx->event[--cx->n_events];
+  if (i == cx->n_events)
+    return e;
+
+  // Sift up.
+  for (; i > 0 && cx->event[(i - 1) / 2].cycles > last.cycles; i = (i - 1) / 2)
+    cx->event[i] = cx->event[(i - 1) / 2];
+
+  // Sift down.
+  for (int c; (c = 2 * i + 1) < cx->n_events; i = c)
+    {
+      if (c + 1 < cx->n_events
+          && cx->event[c + 1].cycles < cx->event[c].cycles)
+        c++;
+      if (last.cycles <= cx->event[c].cycles)
+        break;
+      cx->event[i] = cx->event[c];
+    }
+  cx->event[i] = last;
+
+  return e;
+}
+
+// Remove the events that would run FIRE (CX, ARG).
+
+void
+event_cancel (context_t *cx, void (*fire) (context_t*, int), int arg)
+{
+  for (int i = cx->n_events - 1; i >= 0; i--)
+    if (cx->event[i].fire == fire
+        && cx->event[i].arg == arg)
+      event_remove (cx, i);
+
+  set_event_cycles (cx);
+}
+
+// Run all events that are due.  An event might schedule new ones.
+
+void
+events_run (context_t *cx)
+{
+  while (cx->n_events
+         && cx->event[0].cycles <= cx->program.n_cycles)
+    {
+      event_t e = event_remove (cx, 0);
+      e.fire (cx, e.arg);
+    }
+
+  set_event_cycles (cx);
+}
+
+// SLEEP:  Advance the cycle counter from event to event until one of
+// them raises an interrupt.  Return false if there is no event left that
+// could do that.
+
+bool
+events_sleep (context_t *cx)
+{
+  while (!irq_pending (cx))
+    {
+      if (cx->n_events == 0)
+        return false;
+      if (cx->program.n_cycles < cx->event[0].cycles)
+        cx->program.n_cycles = cx->event[0].cycles;
+      events_run (cx);
+    }
+
+  return true;
+}
+
+void
+irq_raise (context_t *cx, int vector)
+{
+  cx->irq_pending[vector / 32] |= (dword) 1 << (vector % 32);
+  set_event_cycles (cx);
+}
+
+void
+irq_clear (context_t *cx, int vector)
+{
+  cx->irq_pending[vector / 32] &= ~((dword) 1 << (vector % 32));
+  set_event_cycles (cx);
+}
+
+// Return the pending interrupt with the lowest vector number, which has
+// the highest priority, and clear it like the hardware does when it
+// vectors to it.  Return -1 if none is pending.
+
+int
+irq_take (context_t *cx)
+{
+  for (int i = 0; i < MAX_IRQS / 32; i++)
+    if (cx->irq_pending[i])
+      {
+        int bit = __builtin_ctz (cx->irq_pending[i]);
+        cx->irq_pending[i] &= ~((dword) 1 << bit);
+        set_event_cycles (cx);
+        return 32 * i + bit;
+      }
+
+  return -1;
+}
@@ -0,0 +1,41 @@
+/*
+  This file is part of avrtest -- A simple simulator for the
+  Atmel AVR family of microcontrollers designed to test the compiler.
+
+  Copyright (C) 2001, 2002, 2003   Theodore A. Roth, Klaus Rudolph
+  Copyright (C) 2007 Paulo Marques
+  Copyright (C) 2008-2026 Free Software Foundation, Inc.
+
+  avrtest is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 2 of the License, or
+  (at your option) any later version.
+
+  avrtest is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with avrtest; see the file COPYING.  If not, write to
+  the Free Software Foundation, 59 Temple Place - Suite 330,
+  Boston, MA 02111-1307, USA.  */
+
+#ifndef IRQ_H
+#define IRQ_H
+
+#include <stdbool.h>
+
+extern void events_init (context_t*);
+extern void event_schedule (context_t*, qword, void (*) (context_t*, int),
+                            int);
+extern void event_cancel (context_t*, void (*) (context_t*, int), int);
+extern void event_checkpoint (context_t*, qword);
+extern void event_poll (context_t*, bool);
+extern void events_run (context_t*);
+extern bool events_sleep (context_t*);
+extern void irq_raise (context_t*, int);
+extern void irq_clear (context_t*, int);
+extern int irq_take (context_t*);
+
+#endif // IRQ_H
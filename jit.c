@@ -0,0 +1,925 @@
+/*
+  This file is part of avrtest -- A simple simulator for the
+  Atmel AVR family of microcontrollers designed to test the compiler.
+
+  Copyright (C) 2001, 2002, 2003   Theodore A. Roth, Klaus Rudolph
+  Copyright (C) 2007 Paulo Marques
+  Copyright (C) 2008-2026 Free Software Foundation, Inc.
+   
+  avrtest is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 2 of the License, or
+  (at your option) any later version.
+  
+  avrtest is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with avrtest; see the file COPYING.  If not, write to
+  the Free Software Foundation, 59 Temple Place - Suite 330,
+  Boston, MA 02111-1307, USA.  */
+
+/* A JIT for avrtest without logging:  Hot regions of the decoded program are
+   translated to x86-64 code.  A region starts at an instruction that
+   starts a basic block, cf. jit_init(), and extends up to the end of
+   that block.  Only regions whose instructions operate on GPRs and SREG
+   alone are translated, and the block must end in a BRBS, BRBC or RJMP.
+   Anything else like SYSCALLs, I/O, RAM or stack accesses is left to
+   the interpreter.  When SPM changes the flash, the regions that look
+   into the changed words are dropped by jit_forget() and compiled anew
+   once they are hot again.
+
+   The native code keeps the address of the register file in RBX, SREG
+   in R12D, &program in R13, the address of SREG in R14, and the table
+   that maps x86 flags to SREG flags in R15.  The AVR registers stay in
+   memory.  x86 computes most flags of AVR's arithmetic the same way,
+   hence the native code takes them from EFLAGS.  Flags that are
+   overwritten in the region before they are read are not computed.
+
+   The static costs of a region have been accounted by execute() before
+   its native code runs.  The native code adds the extra cycle of a
+   taken branch.  When the region branches back to its start, the native
+   code loops and accounts the costs of the next iteration on its own.
+   It returns when -m MAXCOUNT has been reached so that execute() can
+   leave.  */
+
+// For MAP_ANONYMOUS with -std=c99.
+#define _DEFAULT_SOURCE
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stddef.h>
+#include <string.h>
+
+#include "testavr.h"
+#include "options.h"
+#include "flag-tables.h"
+#include "sreg.h"
+#include "jit.h"
+
+#if defined (__x86_64__) && (defined (__unix__) || defined (__APPLE__))
+
+#include <sys/mman.h>
+
+// Size of the buffer that holds the generated code.
+#define JIT_CODE_SIZE (16 << 20)
+
+// Number of times a region must run before it is compiled.
+#define JIT_HOT 50
+
+// The emit_* functions write to JIT->pos as jit_compile() runs.
+
+#define EMIT(...)                                               \
+  emit_bytes (jit, (const byte[]) { __VA_ARGS__ },              \
+              sizeof ((const byte[]) { __VA_ARGS__ }))
+
+static void
+emit_bytes (struct jit *jit, const byte *b, size_t n)
+{
+  memcpy (jit->pos, b, n);
+  jit->pos += n;
+}
+
+static void
+emit_dword (struct jit *jit, uint32_t x)
+{
+  memcpy (jit->pos, &x, sizeof (x));
+  jit->pos += sizeof (x);
+}
+
+static void
+emit_qword (struct jit *jit, uint64_t x)
+{
+  memcpy (jit->pos, &x, sizeof (x));
+  jit->pos += sizeof (x);
+}
+
+// Patch the rel32 at WHERE to jump to the current position.
+static void
+patch_rel32 (struct jit *jit, byte *where)
+{
+  uint32_t rel = (uint32_t) (jit->pos - (where + 4));
+  memcpy (where, &rel, sizeof (rel));
+}
+
+#define OFF_N_INSNS   ((byte) offsetof (program_t, n_insns))
+#define OFF_N_CYCLES  ((byte) offsetof (program_t, n_cycles))
+#define OFF_MAX_INSNS ((byte) offsetof (program_t, max_insns))
+#define OFF_EVENT_CYCLES ((byte) offsetof (program_t, event_cycles))
+
+// x86 opcodes "OP al, r/m8".  Add 2 to get "OP al, imm8".
+enum
+  {
+    X86_ADD = 0x02, X86_OR  = 0x0a, X86_ADC = 0x12, X86_SBB = 0x1a,
+    X86_AND = 0x22, X86_SUB = 0x2a, X86_XOR = 0x32
+  };
+
+#define FLAGS_ARITH (FLAG_H | FLAG_S | FLAG_V | FLAG_N | FLAG_Z | FLAG_C)
+#define FLAGS_LOGIC (FLAG_S | FLAG_V | FLAG_N | FLAG_Z)
+#define FLAGS_SHIFT (FLAG_S | FLAG_V | FLAG_N | FLAG_Z | FLAG_C)
+
+
+// Get the SREG flags that instruction D reads and writes.  Return false
+// if the JIT does not support D.
+
+static bool
+insn_flags (const decoded_t *d, int *reads, int *writes)
+{
+  // Number of operands that are registers.
+  int n_regs = 1;
+  int r = 0, w = 0;
+
+  switch (d->id)
+    {
+    default:
+      return false;
+
+    case ID_NOP:
+      n_regs = 0;
+      break;
+
+    case ID_ADD: case ID_SUB: case ID_CP:
+      w = FLAGS_ARITH; n_regs = 2; break;
+    case ID_ADC:
+      r = FLAG_C; w = FLAGS_ARITH; n_regs = 2; break;
+    case ID_SBC: case ID_CPC:
+      r = FLAG_C | FLAG_Z; w = FLAGS_ARITH; n_regs = 2; break;
+    case ID_AND: case ID_OR: case ID_EOR:
+      w = FLAGS_LOGIC; n_regs = 2; break;
+    case ID_MOV: case ID_MOVW:
+      n_regs = 2; break;
+    case ID_MUL: case ID_MULS: case ID_MULSU:
+      w = FLAG_Z | FLAG_C; n_regs = 2; break;
+
+    case ID_LSL: case ID_NEG: case ID_SUBI: case ID_CPI:
+      w = FLAGS_ARITH; break;
+    case ID_ROL:
+      r = FLAG_C; w = FLAGS_ARITH; break;
+    case ID_SBCI:
+      r = FLAG_C | FLAG_Z; w = FLAGS_ARITH; break;
+    case ID_CLR: case ID_TST: case ID_INC: case ID_DEC:
+    case ID_ANDI: case ID_ORI:
+      w = FLAGS_LOGIC; break;
+    case ID_COM: case ID_LSR: case ID_ASR: case ID_ADIW: case ID_SBIW:
+      w = FLAGS_SHIFT; break;
+    case ID_ROR:
+      r = FLAG_C; w = FLAGS_SHIFT; break;
+    case ID_LDI: case ID_SWAP:
+      break;
+    case ID_BST:
+      w = FLAG_T; break;
+    case ID_BLD:
+      r = FLAG_T; break;
+
+    case ID_BSET: case ID_BCLR:
+      // Changing I might trigger an IRQ.
+      if (d->op1 & FLAG_I)
+        return false;
+      w = d->op1; n_regs = 0; break;
+
+    case ID_BRBS: case ID_BRBC:
+      r = d->op2; n_regs = 0; break;
+    case ID_RJMP:
+      // RJMP .-2 leaves, cf. func_RJMP.
+      if ((int16_t) d->op2 == -1)
+        return false;
+      n_regs = 0; break;
+    }
+
+  // Let the interpreter complain about R0..R15 on AVR Tiny.
+  if (is_tiny
+      && ((n_regs >= 1 && d->op1 < 16)
+          || (n_regs >= 2 && d->op2 < 16)))
+    return false;
+
+  *reads = r;
+  *writes = w;
+  return true;
+}
+
+
+// Collect the instructions of the region that starts at word address PC
+// in INSN[].  Return their number, or 0 if the region cannot be compiled.
+
+static int
+get_region (const context_t *cx, unsigned pc, const decoded_t *insn[])
+{
+  int reads, writes;
+
+  for (int n = 0; n < MAX_BLOCK_INSNS && pc <= cx->pc_mask; n++)
+    {
+      const decoded_t *d = & cx->decoded[pc];
+
+      // Chunks of long blocks are accounted separately, cf. decode_flash().
+      if (d->block_insns == 0
+          || !insn_flags (d, &reads, &writes))
+        return 0;
+
+      insn[n] = d;
+      if (opcode_ends_block (d->id))
+        return n + 1;
+      pc += d->size;
+    }
+
+  return 0;
+}
+
+
+// EAX holds new values for SREG.  Copy the flags from NEED to SREG.
+// With STICKY_Z, Z is only ever cleared like with SBC.
+
+static void
+emit_sreg_update (struct jit *jit, int need, bool sticky_z)
+{
+  if (sticky_z && (need & FLAG_Z))
+    {
+      EMIT (0x89, 0xc1);                        // mov   ecx, eax
+      EMIT (0x83, 0xc9, (byte) ~FLAG_Z);        // or    ecx, ~FLAG_Z
+      EMIT (0x41, 0x21, 0xcc);                  // and   r12d, ecx
+      need &= ~FLAG_Z;
+    }
+
+  if (need)
+    {
+      EMIT (0x83, 0xe0, need);                  // and   eax, NEED
+      EMIT (0x41, 0x83, 0xe4, (byte) ~need);    // and   r12d, ~NEED
+      EMIT (0x41, 0x09, 0xc4);                  // or    r12d, eax
+    }
+}
+
+
+// EFLAGS hold the flags of an x86 instruction that computes the same
+// flags like the AVR instruction.  Copy the flags from NEED to SREG.
+
+static void
+emit_flags_from_x86 (struct jit *jit, int need, bool sticky_z)
+{
+  if (!need)
+    return;
+
+  // Index x86_to_sreg[] by the low byte of EFLAGS and OF.
+  EMIT (0x9f);                                  // lahf
+  EMIT (0x0f, 0x90, 0xc0);                      // seto  al
+  EMIT (0x0f, 0xb6, 0xcc);                      // movzx ecx, ah
+  EMIT (0x0f, 0xb6, 0xc0);                      // movzx eax, al
+  EMIT (0xc1, 0xe0, 0x08);                      // shl   eax, 8
+  EMIT (0x09, 0xc8);                            // or    eax, ecx
+  EMIT (0x41, 0x0f, 0xb6, 0x04, 0x07);          // movzx eax, [r15 + rax]
+  emit_sreg_update (jit, need, sticky_z);
+}
+
+
+// OP al, Rr  resp.  OP al, K  with AL = Rd.  Store the result to Rd
+// with STORE.  With USE_CARRY, CF is set to C before.
+
+static void
+emit_alu (struct jit *jit, int op, int rd, int rr, bool imm, bool use_carry,
+          bool store)
+{
+  if (use_carry)
+    EMIT (0x41, 0x0f, 0xba, 0xe4, FLAG_C_BIT);  // bt    r12d, FLAG_C_BIT
+  EMIT (0x0f, 0xb6, 0x43, rd);                  // movzx eax, [rbx + Rd]
+  if (imm)
+    EMIT (op + 2, rr);                          // OP    al, K
+  else
+    EMIT (op, 0x43, rr);                        // OP    al, [rbx + Rr]
+  if (store)
+    EMIT (0x88, 0x43, rd);                      // mov   [rbx + Rd], al
+}
+
+
+// H of a subtraction as of flag_update_table_sub8[]:  EDX holds the
+// minuend, EDI the subtrahend and ESI the difference.  This is not the
+// same like the H from x86.
+
+static void
+emit_sub_h (struct jit *jit)
+{
+  EMIT (0x89, 0xd0);                            // mov   eax, edx
+  EMIT (0x21, 0xf8);                            // and   eax, edi
+  EMIT (0x09, 0xfa);                            // or    edx, edi
+  EMIT (0xf7, 0xd6);                            // not   esi
+  EMIT (0x21, 0xf2);                            // and   edx, esi
+  EMIT (0x09, 0xd0);                            // or    eax, edx
+  EMIT (0xc1, 0xe0, FLAG_H_BIT - 3);            // shl   eax, FLAG_H_BIT - 3
+  emit_sreg_update (jit, FLAG_H, false);
+}
+
+
+// SUB, SBC, CP, CPC, SUBI, SBCI, CPI:  Like emit_alu() but also
+// compute the flags from NEED.
+
+static void
+emit_sub (struct jit *jit, int op, int rd, int rr, bool imm, bool use_carry,
+          bool store, int need)
+{
+  if (need & FLAG_H)
+    {
+      EMIT (0x0f, 0xb6, 0x53, rd);              // movzx edx, [rbx + Rd]
+      if (imm)
+        {
+          EMIT (0xbf); emit_dword (jit, rr);    // mov   edi, K
+        }
+      else
+        EMIT (0x0f, 0xb6, 0x7b, rr);            // movzx edi, [rbx + Rr]
+    }
+
+  emit_alu (jit, op, rd, rr, imm, use_carry, store);
+
+  if (need & FLAG_H)
+    EMIT (0x0f, 0xb6, 0xf0);                    // movzx esi, al
+  emit_flags_from_x86 (jit, need & ~FLAG_H, use_carry);
+  if (need & FLAG_H)
+    emit_sub_h (jit);
+}
+
+
+// Shift Rd right by 1 like rotate_right() in avrtest.c.
+
+static void
+emit_shift_right (struct jit *jit, int id, int rd, int need)
+{
+  if (id == ID_ASR)
+    {
+      EMIT (0x0f, 0xbe, 0x43, rd);              // movsx eax, [rbx + Rd]
+      EMIT (0x25, 0xff, 0x01, 0x00, 0x00);      // and   eax, 0x1ff
+    }
+  else
+    EMIT (0x0f, 0xb6, 0x43, rd);                // movzx eax, [rbx + Rd]
+
+  if (id == ID_ROR)
+    {
+      EMIT (0x44, 0x89, 0xe1);                  // mov   ecx, r12d
+      EMIT (0x83, 0xe1, FLAG_C);                // and   ecx, FLAG_C
+      EMIT (0xc1, 0xe1, 8 - FLAG_C_BIT);        // shl   ecx, 8
+      EMIT (0x09, 0xc8);                        // or    eax, ecx
+    }
+
+  EMIT (0x89, 0xc1);                            // mov   ecx, eax
+  EMIT (0xd1, 0xe9);                            // shr   ecx, 1
+  EMIT (0x88, 0x4b, rd);                        // mov   [rbx + Rd], cl
+
+  if (need)
+    {
+      EMIT (0x48, 0xb9);                        // mov   rcx, imm64
+      emit_qword (jit, (uintptr_t) flag_update_table_ror8);
+      EMIT (0x0f, 0xb6, 0x04, 0x01);            // movzx eax, [rcx + rax]
+      emit_sreg_update (jit, need, false);
+    }
+}
+
+
+// R1:R0 = Rd * Rr like do_multiply() in avrtest.c.
+
+static void
+emit_multiply (struct jit *jit, int rd, int rr, bool signed1, bool signed2,
+               int need)
+{
+  EMIT (0x0f, signed1 ? 0xbe : 0xb6, 0x43, rd); // movsx / movzx eax, Rd
+  EMIT (0x0f, signed2 ? 0xbe : 0xb6, 0x4b, rr); // movsx / movzx ecx, Rr
+  EMIT (0x0f, 0xaf, 0xc1);                      // imul  eax, ecx
+  EMIT (0x66, 0x89, 0x43, 0);                   // mov   [rbx + 0], ax
+
+  if (need)
+    {
+      EMIT (0x0f, 0xb7, 0xc0);                  // movzx eax, ax
+      EMIT (0x31, 0xc9);                        // xor   ecx, ecx
+      EMIT (0x85, 0xc0);                        // test  eax, eax
+      EMIT (0x0f, 0x94, 0xc1);                  // sete  cl
+      EMIT (0xc1, 0xe1, FLAG_Z_BIT);            // shl   ecx, FLAG_Z_BIT
+      EMIT (0xc1, 0xe8, 15 - FLAG_C_BIT);       // shr   eax, 15
+      EMIT (0x09, 0xc8);                        // or    eax, ecx
+      emit_sreg_update (jit, need, false);
+    }
+}
+
+
+// Emit code for instruction D that is not the last one of its region.
+// NEED are the flags written by D that might be read later on.
+
+static void
+emit_insn (struct jit *jit, const decoded_t *d, int need)
+{
+  int rd = d->op1;
+  int rr = d->op2;
+
+  switch (d->id)
+    {
+    case ID_NOP:
+      break;
+
+    case ID_LDI:
+      EMIT (0xc6, 0x43, rd, rr);                // mov   byte [rbx + Rd], K
+      break;
+
+    case ID_MOV:
+      EMIT (0x0f, 0xb6, 0x43, rr);              // movzx eax, [rbx + Rr]
+      EMIT (0x88, 0x43, rd);                    // mov   [rbx + Rd], al
+      break;
+
+    case ID_MOVW:
+      EMIT (0x0f, 0xb7, 0x43, rr);              // movzx eax, word [rbx + Rr]
+      EMIT (0x66, 0x89, 0x43, rd);              // mov   [rbx + Rd], ax
+      break;
+
+    case ID_SWAP:
+      EMIT (0xc0, 0x43, rd, 4);                 // rol   byte [rbx + Rd], 4
+      break;
+
+    case ID_ADD: case ID_LSL:
+      emit_alu (jit, X86_ADD, rd, rr, false, false, true);
+      emit_flags_from_x86 (jit, need, false);
+      break;
+
+    case ID_ADC: case ID_ROL:
+      emit_alu (jit, X86_ADC, rd, rr, false, true, true);
+      emit_flags_from_x86 (jit, need, false);
+      break;
+
+    case ID_SUB:
+      emit_sub (jit, X86_SUB, rd, rr, false, false, true, need);
+      break;
+
+    case ID_SBC:
+      emit_sub (jit, X86_SBB, rd, rr, false, true, true, need);
+      break;
+
+    case ID_CP:
+      emit_sub (jit, X86_SUB, rd, rr, false, false, false, need);
+      break;
+
+    case ID_CPC:
+      emit_sub (jit, X86_SBB, rd, rr, false, true, false, need);
+      break;
+
+    case ID_AND:
+      emit_alu (jit, X86_AND, rd, rr, false, false, true);
+      emit_flags_from_x86 (jit, need, false);
+      break;
+
+    case ID_TST:
+      emit_alu (jit, X86_AND, rd, rd, false, false, false);
+      emit_flags_from_x86 (jit, need, false);
+      break;
+
+    case ID_OR:
+      emit_alu (jit, X86_OR, rd, rr, false, false, true);
+      emit_flags_from_x86 (jit, need, false);
+      break;
+
+    case ID_EOR: case ID_CLR:
+      emit_alu (jit, X86_XOR, rd, rr, false, false, true);
+      emit_flags_from_x86 (jit, need, false);
+      break;
+
+    case ID_SUBI:
+      emit_sub (jit, X86_SUB, rd, rr, true, false, true, need);
+      break;
+
+    case ID_SBCI:
+      emit_sub (jit, X86_SBB, rd, rr, true, true, true, need);
+      break;
+
+    case ID_CPI:
+      emit_sub (jit, X86_SUB, rd, rr, true, false, false, need);
+      break;
+
+    case ID_ANDI:
+      emit_alu (jit, X86_AND, rd, rr, true, false, true);
+      emit_flags_from_x86 (jit, need, false);
+      break;
+
+    case ID_ORI:
+      emit_alu (jit, X86_OR, rd, rr, true, false, true);
+      emit_flags_from_x86 (jit, need, false);
+      break;
+
+    case ID_INC:
+      EMIT (0xfe, 0x43, rd);                    // inc   byte [rbx + Rd]
+      emit_flags_from_x86 (jit, need, false);
+      break;
+
+    case ID_DEC:
+      EMIT (0xfe, 0x4b, rd);                    // dec   byte [rbx + Rd]
+      emit_flags_from_x86 (jit, need, false);
+      break;
+
+    case ID_NEG:
+      if (need & FLAG_H)
+        {
+          EMIT (0x31, 0xd2);                    // xor   edx, edx
+          EMIT (0x0f, 0xb6, 0x7b, rd);          // movzx edi, [rbx + Rd]
+        }
+      EMIT (0xf6, 0x5b, rd);                    // neg   byte [rbx + Rd]
+      if (need & FLAG_H)
+        EMIT (0x0f, 0xb6, 0x73, rd);            // movzx esi, [rbx + Rd]
+      emit_flags_from_x86 (jit, need & ~FLAG_H, false);
+      if (need & FLAG_H)
+        emit_sub_h (jit);
+      break;
+
+    case ID_COM:
+      EMIT (0x0f, 0xb6, 0x43, rd);              // movzx eax, [rbx + Rd]
+      EMIT (0xf6, 0xd0);                        // not   al
+      EMIT (0x88, 0x43, rd);                    // mov   [rbx + Rd], al
+      if (need & ~FLAG_C)
+        {
+          EMIT (0x84, 0xc0);                    // test  al, al
+          emit_flags_from_x86 (jit, need & ~FLAG_C, false);
+        }
+      if (need & FLAG_C)
+        EMIT (0x41, 0x83, 0xcc, FLAG_C);        // or    r12d, FLAG_C
+      break;
+
+    case ID_ADIW:
+      EMIT (0x66, 0x83, 0x43, rd, rr);          // add   word [rbx + Rd], K
+      emit_flags_from_x86 (jit, need, false);
+      break;
+
+    case ID_SBIW:
+      EMIT (0x66, 0x83, 0x6b, rd, rr);          // sub   word [rbx + Rd], K
+      emit_flags_from_x86 (jit, need, false);
+      break;
+
+    case ID_LSR: case ID_ROR: case ID_ASR:
+      emit_shift_right (jit, d->id, rd, need);
+      break;
+
+    case ID_MUL:
+      emit_multiply (jit, rd, rr, false, false, need);
+      break;
+
+    case ID_MULS:
+      emit_multiply (jit, rd, rr, true, true, need);
+      break;
+
+    case ID_MULSU:
+      emit_multiply (jit, rd, rr, true, false, need);
+      break;
+
+    case ID_BST:
+      if (need)
+        {
+          EMIT (0x31, 0xc0);                    // xor   eax, eax
+          EMIT (0xf6, 0x43, rd, rr);            // test  byte [rbx + Rd], MASK
+          EMIT (0x0f, 0x95, 0xc0);              // setnz al
+          EMIT (0xc1, 0xe0, FLAG_T_BIT);        // shl   eax, FLAG_T_BIT
+          emit_sreg_update (jit, need, false);
+        }
+      break;
+
+    case ID_BLD:
+      EMIT (0x0f, 0xb6, 0x43, rd);              // movzx eax, [rbx + Rd]
+      EMIT (0x24, (byte) ~rr);                  // and   al, ~MASK
+      EMIT (0x44, 0x89, 0xe1);                  // mov   ecx, r12d
+      EMIT (0xc1, 0xe9, FLAG_T_BIT);            // shr   ecx, FLAG_T_BIT
+      EMIT (0x83, 0xe1, 1);                     // and   ecx, 1
+      EMIT (0xf7, 0xd9);                        // neg   ecx
+      EMIT (0x80, 0xe1, rr);                    // and   cl, MASK
+      EMIT (0x08, 0xc8);                        // or    al, cl
+      EMIT (0x88, 0x43, rd);                    // mov   [rbx + Rd], al
+      break;
+
+    case ID_BSET:
+      if (need)
+        EMIT (0x41, 0x83, 0xcc, need);          // or    r12d, FLAGS
+      break;
+
+    case ID_BCLR:
+      if (need)
+        EMIT (0x41, 0x83, 0xe4, (byte) ~need);  // and   r12d, ~FLAGS
+      break;
+
+    default:
+      leave (jit->cx, LEAVE_FATAL, "JIT: unexpected instruction %s",
+             opcodes[d->id].mnemonic);
+    }
+}
+
+
+// Continue with the instruction at word address TARGET.  If that is
+// the start PC of the region, loop unless -m MAXCOUNT is reached or an
+// event is due, cf. irq.c.
+
+static void
+emit_goto (struct jit *jit, unsigned target, unsigned pc, const decoded_t *d,
+           byte *loop)
+{
+  if (target == pc)
+    {
+      EMIT (0x49, 0x8b, 0x45, OFF_N_CYCLES);    // mov   rax, n_cycles
+      EMIT (0x49, 0x3b, 0x45, OFF_EVENT_CYCLES);// cmp   rax, event_cycles
+      EMIT (0x73, 18);                          // jae   2f
+      EMIT (0x49, 0x8b, 0x45, OFF_N_INSNS);     // mov   rax, n_insns
+      EMIT (0x49, 0x8b, 0x4d, OFF_MAX_INSNS);   // mov   rcx, max_insns
+      EMIT (0x48, 0x85, 0xc9);                  // test  rcx, rcx
+      EMIT (0x74, 15);                          // jz    1f
+      EMIT (0x48, 0x39, 0xc8);                  // cmp   rax, rcx
+      EMIT (0x72, 10);                          // jb    1f
+      // 2:  -m MAXCOUNT reached or event due.
+      EMIT (0xb8); emit_dword (jit, pc);        // mov   eax, PC
+      EMIT (0xe9);                              // jmp   exit
+      jit->to_exit[jit->n_to_exit++] = jit->pos;
+      emit_dword (jit, 0);
+      // 1:  Account the next iteration and loop.
+      EMIT (0x48, 0x05);                        // add   rax, BLOCK_INSNS
+      emit_dword (jit, d->block_insns);
+      EMIT (0x49, 0x89, 0x45, OFF_N_INSNS);     // mov   n_insns, rax
+      EMIT (0x49, 0x81, 0x45, OFF_N_CYCLES);    // add   n_cycles, BLOCK_CYCLES
+      emit_dword (jit, d->block_cycles);
+      EMIT (0xe9);                              // jmp   loop
+      emit_dword (jit, (uint32_t) (loop - (jit->pos + 4)));
+    }
+  else
+    {
+      EMIT (0xb8); emit_dword (jit, target);    // mov   eax, TARGET
+      EMIT (0xe9);                              // jmp   exit
+      jit->to_exit[jit->n_to_exit++] = jit->pos;
+      emit_dword (jit, 0);
+    }
+}
+
+
+// Compile the region that starts at word address PC.  Return NULL if
+// it cannot be compiled.
+
+jit_func_t
+jit_compile (context_t *cx, unsigned pc)
+{
+  const decoded_t *insn[MAX_BLOCK_INSNS];
+  int need[MAX_BLOCK_INSNS];
+  int n = get_region (cx, pc, insn);
+
+  struct jit *jit = cx->jit;
+  if (n == 0
+      // Rough upper bound for the size of the code.
+      || jit->pos + 100 * (n + 2) > jit->end)
+    return NULL;
+
+  // Which flags have to be computed:  All flags are live after the region.
+  int live = 0xff;
+  for (int i = n - 1; i >= 0; i--)
+    {
+      int reads = 0, writes = 0;
+      insn_flags (insn[i], &reads, &writes);
+      need[i] = writes & live;
+      live = (live & ~writes) | reads;
+    }
+
+  byte *code = jit->pos;
+  jit->n_to_exit = 0;
+
+  EMIT (0x53);                                  // push  rbx
+  EMIT (0x41, 0x54);                            // push  r12
+  EMIT (0x41, 0x55);                            // push  r13
+  EMIT (0x41, 0x56);                            // push  r14
+  EMIT (0x41, 0x57);                            // push  r15
+  EMIT (0x48, 0x89, 0xfb);                      // mov   rbx, rdi
+  EMIT (0x49, 0x89, 0xf6);                      // mov   r14, rsi
+  EMIT (0x49, 0x89, 0xd5);                      // mov   r13, rdx
+  EMIT (0x45, 0x0f, 0xb6, 0x26);                // movzx r12d, [r14]
+  EMIT (0x49, 0xbf);                            // mov   r15, imm64
+  emit_qword (jit, (uintptr_t) jit->x86_to_sreg);
+
+  byte *loop = jit->pos;
+  unsigned next = pc;
+  for (int i = 0; i < n - 1; i++)
+    {
+      emit_insn (jit, insn[i], need[i]);
+      next += insn[i]->size;
+    }
+
+  const decoded_t *t = insn[n - 1];
+  next += t->size;
+
+  if (t->id == ID_RJMP)
+    emit_goto (jit, (next + (int16_t) t->op2) & cx->pc_mask,
+               pc, insn[0], loop);
+  else
+    {
+      EMIT (0x41, 0xf6, 0xc4, t->op2);          // test  r12b, MASK
+      EMIT (0x0f, t->id == ID_BRBS              // jnz / jz  1f
+            ? 0x85 : 0x84);
+      byte *taken = jit->pos;
+      emit_dword (jit, 0);
+      emit_goto (jit, next, pc, insn[0], loop);
+      // 1:  Branch taken.
+      patch_rel32 (jit, taken);
+      EMIT (0x49, 0x83, 0x45, OFF_N_CYCLES, 1); // add   n_cycles, 1
+      emit_goto (jit, (next + (int8_t) t->op1) & cx->pc_mask,
+                 pc, insn[0], loop);
+    }
+
+  // exit:
+  for (int i = 0; i < jit->n_to_exit; i++)
+    patch_rel32 (jit, jit->to_exit[i]);
+  EMIT (0x45, 0x88, 0x26);                      // mov   [r14], r12b
+  EMIT (0x41, 0x5f);                            // pop   r15
+  EMIT (0x41, 0x5e);                            // pop   r14
+  EMIT (0x41, 0x5d);                            // pop   r13
+  EMIT (0x41, 0x5c);                            // pop   r12
+  EMIT (0x5b);                                  // pop   rbx
+  EMIT (0xc3);                                  // ret
+
+  if (cx->options.do_verbose)
+    fprintf (cx->out, ">>> JIT 0x%05x: %d instructions, %d bytes\n",
+             2 * pc, n, (int) (jit->pos - code));
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wpedantic"
+  return (jit_func_t) code;
+#pragma GCC diagnostic pop
+}
+
+
+// Count one execution of the region at word address PC.  Return true
+// when it is time to compile it.
+
+bool
+jit_hot (context_t *cx, unsigned pc)
+{
+  return ++cx->jit->hits[pc] == JIT_HOT;
+}
+
+
+// Whether the region that starts at word address PC is worth counting
+// its executions:  It must start a basic block so that each instruction
+// is compiled at most a few times, and it must be compilable.
+
+bool
+jit_candidate (const context_t *cx, unsigned pc)
+{
+  const decoded_t *insn[MAX_BLOCK_INSNS];
+
+  return cx->jit->is_head[pc] && get_region (cx, pc, insn) > 0;
+}
+
+
+// SPM changed the instructions the regions that start at word addresses
+// [LO, HI) are made of.  Drop their code and count their runs anew.  The
+// jump targets in the new code are not known, hence only the words after
+// instructions that end a block become heads like in jit_init().
+
+void
+jit_forget (context_t *cx, unsigned lo, unsigned hi)
+{
+  const decoded_t *decoded = cx->decoded;
+  struct jit *jit = cx->jit;
+
+  for (unsigned pc = lo; pc < hi; pc++)
+    {
+      jit->code[pc] = NULL;
+      jit->hits[pc] = 0;
+      if (pc > 0 && opcode_ends_block (decoded[pc - 1].id))
+        jit->is_head[pc] = true;
+    }
+}
+
+
+// Allocate memory for the JIT and find the instructions that start basic
+// blocks:  The ones after instructions that end a block, and the targets
+// of direct jumps, calls and branches.  Return false if the JIT is not
+// available.
+
+bool
+jit_init (context_t *cx)
+{
+  const decoded_t *decoded = cx->decoded;
+
+  // The buffer and tables are reused when more than one program is run.
+  if (!cx->jit)
+    {
+      byte *buf = mmap (NULL, JIT_CODE_SIZE,
+                        PROT_READ | PROT_WRITE | PROT_EXEC,
+                        MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+      if (buf == MAP_FAILED)
+        return false;
+      cx->jit = get_mem (cx, 1, sizeof (struct jit), "JIT");
+      cx->jit->cx = cx;
+      cx->jit->buf = buf;
+      cx->jit->end = buf + JIT_CODE_SIZE;
+    }
+
+  struct jit *jit = cx->jit;
+
+  if (jit->n_tab != cx->pc_mask + 1)
+    {
+      put_mem (cx, jit->code);
+      put_mem (cx, jit->hits);
+      put_mem (cx, jit->is_head);
+      jit->n_tab = cx->pc_mask + 1;
+      jit->code = get_mem (cx, jit->n_tab, sizeof (jit_func_t), "JIT");
+      jit->hits = get_mem (cx, jit->n_tab, sizeof (byte), "JIT");
+      jit->is_head = get_mem (cx, jit->n_tab, sizeof (bool), "JIT");
+    }
+  else
+    {
+      memset (jit->code, 0, jit->n_tab * sizeof (jit_func_t));
+      memset (jit->hits, 0, jit->n_tab * sizeof (byte));
+      memset (jit->is_head, 0, jit->n_tab * sizeof (bool));
+    }
+  jit->pos = jit->buf;
+
+  for (int i = 0; i < 0x200; i++)
+    {
+      // x86 EFLAGS:  CF = bit 0, AF = bit 4, ZF = bit 6, SF = bit 7.
+      // OF has been moved to bit 8 by emit_flags_from_x86().
+      int c = i & 1, h = (i >> 4) & 1, z = (i >> 6) & 1;
+      int n = (i >> 7) & 1, v = (i >> 8) & 1;
+      jit->x86_to_sreg[i] = ((c << FLAG_C_BIT) | (z << FLAG_Z_BIT)
+                             | (n << FLAG_N_BIT) | (v << FLAG_V_BIT)
+                             | ((n ^ v) << FLAG_S_BIT)
+                             | (h << FLAG_H_BIT));
+    }
+
+  jit->is_head[cx->pc] = true;
+  for (unsigned pc = cx->program.code_start / 2;
+       pc <= cx->program.code_end / 2; pc++)
+    {
+      const decoded_t *d = & decoded[pc];
+      unsigned next = (pc + d->size) & cx->pc_mask;
+      int target = -1;
+
+      if (!opcode_ends_block (d->id))
+        continue;
+
+      jit->is_head[next] = true;
+
+      switch (d->id)
+        {
+        case ID_BRBS: case ID_BRBC:
+          target = next + (int8_t) d->op1;
+          break;
+        case ID_RJMP: case ID_RCALL:
+          target = next + (int16_t) d->op2;
+          break;
+        case ID_JMP: case ID_CALL:
+          target = d->op2 | (d->op1 << 16);
+          break;
+        case ID_CPSE: case ID_SBIC: case ID_SBIS: case ID_SBRC: case ID_SBRS:
+          target = next + 1;
+          break;
+        case ID_CPSE2: case ID_SBIC2: case ID_SBIS2:
+        case ID_SBRC2: case ID_SBRS2:
+          target = next + 2;
+          break;
+        }
+
+      if (target >= 0)
+        jit->is_head[target & cx->pc_mask] = true;
+    }
+
+  return true;
+}
+
+
+// The run of CX is over:  Hand back the buffer of the generated code.
+// The tables go with the other memory of CX.
+
+void
+jit_free (context_t *cx)
+{
+  if (cx->jit)
+    munmap (cx->jit->buf, JIT_CODE_SIZE);
+  cx->jit = NULL;
+}
+
+#else // x86-64
+
+bool
+jit_init (context_t *cx)
+{
+  return false;
+}
+
+bool
+jit_candidate (const context_t *cx, unsigned pc)
+{
+  return false;
+}
+
+bool
+jit_hot (context_t *cx, unsigned pc)
+{
+  return false;
+}
+
+jit_func_t
+jit_compile (context_t *cx, unsigned pc)
+{
+  return NULL;
+}
+
+void
+jit_forget (context_t *cx, unsigned lo, unsigned hi)
+{
+}
+
+void
+jit_free (context_t *cx)
+{
+}
+
+#endif // x86-64
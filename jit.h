@@ -0,0 +1,63 @@
+/*
+  This file is part of avrtest -- A simple simulator for the
+  Atmel AVR family of microcontrollers designed to test the compiler.
+
+  Copyright (C) 2001, 2002, 2003   Theodore A. Roth, Klaus Rudolph
+  Copyright (C) 2007 Paulo Marques
+  Copyright (C) 2008-2026 Free Software Foundation, Inc.
+   
+  avrtest is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 2 of the License, or
+  (at your option) any later version.
+  
+  avrtest is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with avrtest; see the file COPYING.  If not, write to
+  the Free Software Foundation, 59 Temple Place - Suite 330,
+  Boston, MA 02111-1307, USA.  */
+
+#ifndef JIT_H
+#define JIT_H
+
+#include <stdbool.h>
+
+// Native code for a region of context_t.decoded[] as generated by jit.c.
+// Gets the register file, the address of SREG and &program.  Returns
+// the word address of the instruction to run next.
+typedef unsigned (*jit_func_t) (byte *reg, byte *sreg, program_t *prog);
+
+// The JIT of a context, allocated by jit_init().  The tables have N_TAB
+// entries, one per word of flash:  CODE[] holds the native code of the
+// regions that have been compiled, indexed by their start word address,
+// HITS[] counts how often the regions ran, and IS_HEAD[] tells whether
+// a word address starts a basic block.  The generated code goes to BUF
+// up to END, and POS is the current position there.  TO_EXIT[] are the
+// jumps to the epilogue that jit_compile() has to patch, and
+// X86_TO_SREG[] maps an x86 flags index as computed by
+// emit_flags_from_x86() to SREG.
+struct jit
+{
+  context_t *cx;
+  jit_func_t *code;
+  byte *hits;
+  bool *is_head;
+  unsigned n_tab;
+  byte *buf, *end, *pos;
+  byte *to_exit[2];
+  int n_to_exit;
+  byte x86_to_sreg[0x200];
+};
+
+extern bool jit_init (context_t*);
+extern bool jit_candidate (const context_t*, unsigned);
+extern bool jit_hot (context_t*, unsigned);
+extern jit_func_t jit_compile (context_t*, unsigned);
+extern void jit_forget (context_t*, unsigned, unsigned);
+extern void jit_free (context_t*);
+
+#endif // JIT_H
@@ -229,7 +229,7 @@ get_elf32_word (const Elf32_Word *v)
 }
 
 static bool
-load_symbol_string_table (FILE *f, const Elf32_Ehdr *ehdr)
+load_symbol_string_table (context_t *cx, FILE *f, const Elf32_Ehdr *ehdr)
 {
   bool have_strtab = false;
   char *strtab = NULL;
@@ -240,11 +240,11 @@ load_symbol_string_table (FILE *f, const Elf32_Ehdr *ehdr)
 
   // Read section headers
   if (e_shentsize != sizeof (Elf32_Shdr))
-    leave (LEAVE_FILE, "ELF section headers invalid");
-  shdr = get_mem (e_shnum, sizeof (Elf32_Shdr), "ELF section headers");
+    leave (cx, LEAVE_FILE, "ELF section headers invalid");
+  shdr = get_mem (cx, e_shnum, sizeof (Elf32_Shdr), "ELF section headers");
   if (fseek (f, e_shoff, SEEK_SET) != 0
       || fread (shdr, sizeof (Elf32_Shdr), e_shnum, f) != e_shnum)
-    leave (LEAVE_FILE, "ELF section headers truncated");
+    leave (cx, LEAVE_FILE, "ELF section headers truncated");
 
   for (int n = 0; n < e_shnum; n++)
     {
@@ -260,32 +260,32 @@ load_symbol_string_table (FILE *f, const Elf32_Ehdr *ehdr)
 
       if (sh_entsize != sizeof (Elf32_Sym)
           || sh_size % sh_entsize != 0)
-        leave (LEAVE_FILE, "ELF symbol section header invalid");
+        leave (cx, LEAVE_FILE, "ELF symbol section header invalid");
 
       // Read symbol table
       size_t n_syms = sh_size / sh_entsize;
-      Elf32_Sym *symtab = get_mem ((unsigned) n_syms, sizeof (Elf32_Sym),
+      Elf32_Sym *symtab = get_mem (cx, (unsigned) n_syms, sizeof (Elf32_Sym),
                                    "ELF symbol table");
       if (fseek (f, sh_offset, SEEK_SET) != 0
           || fread (symtab, sizeof (Elf32_Sym), n_syms, f) != n_syms)
-        leave (LEAVE_FILE, "ELF symbol table truncated");
+        leave (cx, LEAVE_FILE, "ELF symbol table truncated");
 
       // Read string table section header
       if (sh_link >= e_shnum)
-        leave (LEAVE_FILE, "ELF section header truncated");
+        leave (cx, LEAVE_FILE, "ELF section header truncated");
       sh_type = get_elf32_word (&shdr[sh_link].sh_type);
       if (sh_type != SHT_STRTAB)
-        leave (LEAVE_FILE, "ELF string table header invalid");
+        leave (cx, LEAVE_FILE, "ELF string table header invalid");
 
       // Read string table
       sh_offset = get_elf32_word (&shdr[sh_link].sh_offset);
       sh_size   = get_elf32_word (&shdr[sh_link].sh_size);
-      strtab = get_mem (sh_size, sizeof (char), "ELF string table");
+      strtab = get_mem (cx, sh_size, sizeof (char), "ELF string table");
       if (fseek (f, sh_offset, SEEK_SET) != 0
           || fread (strtab, sh_size, 1, f) != 1)
-        leave (LEAVE_FILE, "ELF string table truncated");
+        leave (cx, LEAVE_FILE, "ELF string table truncated");
 
-      set_elf_string_table (strtab, (size_t) sh_size, (unsigned) n_syms);
+      set_elf_string_table (cx, strtab, (size_t) sh_size, (unsigned) n_syms);
 
       // Iterate all symbols
       for (size_t n = 0; n < n_syms; n++)
@@ -295,13 +295,13 @@ load_symbol_string_table (FILE *f, const Elf32_Ehdr *ehdr)
           size_t name = (size_t) get_elf32_word (&sym->st_name);
           int shndx = get_elf32_half (&sym->st_shndx);
           if (name >= sh_size)
-            leave (LEAVE_FILE, "ELF string table too short");
+            leave (cx, LEAVE_FILE, "ELF string table too short");
 
           unsigned flags = 0;
           if (type == STT_NOTYPE && shndx < SHN_LORESERVE)
             {
               if (shndx >= e_shnum)
-                leave (LEAVE_FILE, "ELF section header truncated");
+                leave (cx, LEAVE_FILE, "ELF section header truncated");
               sh_type = get_elf32_word (&shdr[shndx].sh_type);
               if (sh_type == SHT_PROGBITS)
                 flags = get_elf32_word (&shdr[shndx].sh_flags);
@@ -309,15 +309,15 @@ load_symbol_string_table (FILE *f, const Elf32_Ehdr *ehdr)
           if (type == STT_FUNC || (flags & SHF_EXEC))
             {
               int value = get_elf32_word (&sym->st_value);
-              set_elf_function_symbol (value, name, type == STT_FUNC);
+              set_elf_function_symbol (cx, value, name, type == STT_FUNC);
             }
         }
 
       // Release data no more needed.  Retain strtab[].
-      free (symtab);
-      free (shdr);
+      put_mem (cx, symtab);
+      put_mem (cx, shdr);
 
-      finish_elf_string_table();
+      finish_elf_string_table (cx);
       have_strtab = true;
 
       // Currently ELF does not hold more than 1 symbol table
@@ -328,43 +328,45 @@ load_symbol_string_table (FILE *f, const Elf32_Ehdr *ehdr)
 }
 
 static bool
-load_elf (FILE *f, byte *flash, byte *ram, byte *eeprom)
+load_elf (context_t *cx, FILE *f)
 {
+  program_t *program = &cx->program;
+  byte *flash = cx->flash;
   Elf32_Ehdr ehdr;
   Elf32_Phdr phdr[16];
     
   rewind (f);
   if (fread (&ehdr, sizeof (ehdr), 1, f) != 1)
-    leave (LEAVE_FILE, "can't read ELF header");
+    leave (cx, LEAVE_FILE, "can't read ELF header");
   if (ehdr.e_ident[EI_CLASS] != ELFCLASS32
       || ehdr.e_ident[EI_DATA] != ELFDATA2LSB
       || ehdr.e_ident[EI_VERSION] != EV_CURRENT)
-    leave (LEAVE_FILE, "bad ELF header");
+    leave (cx, LEAVE_FILE, "bad ELF header");
   if (get_elf32_half (&ehdr.e_type) != ET_EXEC
       || get_elf32_half (&ehdr.e_machine) != EM_AVR
       || get_elf32_word (&ehdr.e_version) != EV_CURRENT
       || get_elf32_half (&ehdr.e_phentsize) != sizeof (Elf32_Phdr))
-    leave (LEAVE_FILE, "ELF file is not an AVR executable");
+    leave (cx, LEAVE_FILE, "ELF file is not an AVR executable");
 
-  if (!options.do_entry_point)
+  if (!cx->options.do_entry_point)
     {
-      unsigned pc = program.entry_point = get_elf32_word (&ehdr.e_entry);
-      cpu_PC = pc / 2;
-      if (pc >= MAX_FLASH_SIZE)
-        leave (LEAVE_FILE, "ELF entry-point 0x%x it too big", pc);
+      unsigned pc = program->entry_point = get_elf32_word (&ehdr.e_entry);
+      cx->pc = pc / 2;
+      if (pc >= cx->device.flash_size)
+        leave (cx, LEAVE_FILE, "ELF entry-point 0x%x it too big", pc);
       else if (pc % 2 != 0)
-        leave (LEAVE_FILE, "ELF entry-point 0x%x is odd", pc);
+        leave (cx, LEAVE_FILE, "ELF entry-point 0x%x is odd", pc);
     }
 
   int nbr_phdr = get_elf32_half (&ehdr.e_phnum);
   if ((unsigned) nbr_phdr > sizeof (phdr) / sizeof (*phdr))
-    leave (LEAVE_FILE, "ELF file contains too many PHDR");
+    leave (cx, LEAVE_FILE, "ELF file contains too many PHDR");
 
   if (fseek (f, get_elf32_word (&ehdr.e_phoff), SEEK_SET) != 0)
-    leave (LEAVE_FILE, "ELF file truncated");
+    leave (cx, LEAVE_FILE, "ELF file truncated");
   size_t res = fread (phdr, sizeof (Elf32_Phdr), nbr_phdr, f);
   if (res != (size_t)nbr_phdr)
-    leave (LEAVE_FILE, "can't read PHDRs of ELF file");
+    leave (cx, LEAVE_FILE, "can't read PHDRs of ELF file");
 
   for (int i = 0; i < nbr_phdr; i++)
     {
@@ -379,72 +381,85 @@ load_elf (FILE *f, byte *flash, byte *ram, byte *eeprom)
       if (filesz == 0)
         continue;
 
-      if (options.do_verbose)
-        printf (">>> Load PHDR 0x%06x -- 0x%06x (vaddr = 0x%06x) \"%s%s%s\"\n",
-                (unsigned) addr, (unsigned) (addr + memsz - 1),
-                (unsigned) vaddr, flags & PF_R ? "r" : "",
-                flags & PF_W ? "w" : "", flags & PF_X ? "x" : "");
+      if (cx->options.do_verbose)
+        fprintf (cx->out, ">>> Load PHDR 0x%06x -- 0x%06x (vaddr = 0x%06x) "
+                 "\"%s%s%s\"\n", (unsigned) addr,
+                 (unsigned) (addr + memsz - 1), (unsigned) vaddr,
+                 flags & PF_R ? "r" : "", flags & PF_W ? "w" : "",
+                 flags & PF_X ? "x" : "");
 
       // Skip special sections like .fuse, .lock, .signature etc.
       if (vaddr > EEPROM_VADDR_END)
         continue;
 
-      if (addr + memsz > MAX_FLASH_SIZE
+      if (addr + memsz > cx->device.flash_size
           && vaddr <= DATA_VADDR_END)
-        leave (LEAVE_FILE,
+        leave (cx, LEAVE_FILE,
                "program too big to fit in flash");
       if (fseek (f, get_elf32_word (&phdr[i].p_offset), SEEK_SET) != 0)
-        leave (LEAVE_FILE, "ELF file truncated");
+        leave (cx, LEAVE_FILE, "ELF file truncated");
 
-      program.n_bytes += filesz;
+      program->n_bytes += filesz;
 
       // Read to eeprom
       if (vaddr >= EEPROM_VADDR)
         {
           addr -= EEPROM_VADDR;
-          if (addr + filesz > MAX_EEPROM_SIZE)
-            leave (LEAVE_FILE, ".eeprom too big to fit in memory");
-          if (fread (eeprom + addr, filesz, 1, f) != 1)
-            leave (LEAVE_FILE, "ELF file truncated");
+          if (addr + filesz > cx->device.eeprom_size)
+            leave (cx, LEAVE_FILE, ".eeprom too big to fit in memory");
+          if (fread (cx->eeprom + addr, filesz, 1, f) != 1)
+            leave (cx, LEAVE_FILE, "ELF file truncated");
           continue;
         }
 
       // Read to Flash
       if (fread (flash + addr, filesz, 1, f) != 1)
-        leave (LEAVE_FILE, "ELF file truncated");
+        leave (cx, LEAVE_FILE, "ELF file truncated");
 
       // Also copy in SRAM
-      if (options.do_initialize_sram
+      if (cx->options.do_initialize_sram
           && vaddr >= DATA_VADDR
           && vaddr + filesz -1 <= DATA_VADDR_END)
-        memcpy (ram + vaddr - DATA_VADDR, flash + addr, filesz);
+        {
+          if (vaddr - DATA_VADDR + filesz > cx->ram_end + 1)
+            leave (cx, LEAVE_FILE, ".data too big to fit in RAM of %s",
+                   cx->device.name);
+          memcpy (cx->data + vaddr - DATA_VADDR, flash + addr, filesz);
+        }
 
-      if ((unsigned) (addr + memsz) > program.size)
-        program.size = addr + memsz;
+      if ((unsigned) (addr + memsz) > program->size)
+        program->size = addr + memsz;
 
       if (flags & PF_X)
         {
-          if ((unsigned) addr < program.code_start)
-            program.code_start = addr;
-          if ((unsigned) (addr + memsz - 1) > program.code_end)
-            program.code_end = addr + memsz - 1;
+          if ((unsigned) addr < program->code_start)
+            program->code_start = addr;
+          if ((unsigned) (addr + memsz - 1) > program->code_end)
+            program->code_end = addr + memsz - 1;
         }
     }
 
-  return is_avrtest_log ? load_symbol_string_table (f, &ehdr) : false;
+  // -hle finds the routines to emulate by their symbols, and
+  // -fork-server the function where it takes its snapshot.  Checkpoints
+  // keep them for -restore=.
+  return (is_avrtest_log || cx->options.do_hle || cx->options.do_fork_server
+          || cx->options.do_checkpoint_at || cx->options.do_checkpoint_every)
+    ? load_symbol_string_table (cx, f, &ehdr)
+    : false;
 }
 
 void
-load_to_flash (const char *filename, byte *flash, byte *ram, byte *eeprom)
+load_to_flash (context_t *cx)
 {
+  program_t *program = &cx->program;
   bool have_strtab = false;
   char buf[EI_NIDENT];
 
-  program.code_start = -1U;
+  program->code_start = -1U;
 
-  FILE *fp = fopen (filename, "rb");
+  FILE *fp = get_file (cx, program->name, "rb");
   if (!fp)
-    leave (LEAVE_IO, "can't find or read program file");
+    leave (cx, LEAVE_IO, "can't find or read program file");
 
   size_t len = fread (buf, 1, sizeof (buf), fp);
   if (len == sizeof (buf)
@@ -453,28 +468,31 @@ load_to_flash (const char *filename, byte *flash, byte *ram, byte *eeprom)
       && buf[2] == 'L'
       && buf[3] == 'F')
     {
-      have_strtab = load_elf (fp, flash, ram, eeprom);
+      have_strtab = load_elf (cx, fp);
     }
   else
     {
       rewind (fp);
-      program.size = program.n_bytes = fread (flash, 1, MAX_FLASH_SIZE, fp);
-      program.code_start = 0;
-      program.code_end = program.size - 1;
+      program->size = program->n_bytes
+        = fread (cx->flash, 1, 2 * (cx->pc_mask + 1), fp);
+      program->code_start = 0;
+      program->code_end = program->size - 1;
+      if (fgetc (fp) != EOF)
+        program->size++;
     }
-  fclose (fp);
+  put_file (cx, fp);
 
-  if (program.size & ~arch.flash_addr_mask)
+  if (program->size > cx->device.flash_size)
     {
-      leave (LEAVE_FILE, "program is too large (size: %"PRIu32
-             ", max: %u)", program.size, arch.flash_addr_mask + 1);
+      leave (cx, LEAVE_FILE, "program is too large (size: %"PRIu32
+             ", max: %u)", program->size, cx->device.flash_size);
     }
 
   if (is_avrtest_log && !have_strtab)
     {
-      static char stab[1];
-      set_elf_string_table (stab, 1, 0);
-      finish_elf_string_table();
+      char *stab = get_mem (cx, 1, sizeof (char), "string table");
+      set_elf_string_table (cx, stab, 1, 0);
+      finish_elf_string_table (cx);
     }
 }
 
@@ -560,7 +578,8 @@ static const byte avr_op_74_index[1 + 0x7ff] = {
     } while (0)
 
 static int
-decode_opcode (decoded_t *d, unsigned opcode1, unsigned opcode2)
+decode_opcode (context_t *cx, decoded_t *d, unsigned opcode1,
+               unsigned opcode2)
 {
   byte index = 0;
 
@@ -812,7 +831,7 @@ do_skip:;
       && d->op1 == d->op2 && opcode2 == invalid_opcode)
     {
       if (d->op1 < 32)
-        have_syscall[d->op1] = true;
+        cx->have_syscall[d->op1] = true;
 
       // Always skipping invalid opcode 0xffff represents a syscall
       return ID_SYSCALL;   //  0001 00xX XXXX xxxx | CPSE X X = SYSCALL X
@@ -855,18 +874,121 @@ tiny_opcode_maybe_illegal (decoded_t *d)
     }
 }
 
-void
-decode_flash (decoded_t d[], const byte flash[])
+// Decode the instruction at byte address I of the flash into DI.
+
+static void
+decode_at (context_t *cx, decoded_t *di, unsigned i)
 {
-  unsigned i = program.code_start;
+  const byte *flash = cx->flash;
   word opcode1 = flash[i] | (flash[i + 1] << 8);
-  
-  for (; i <= program.code_end; i += 2)
+  word opcode2 = flash[i + 2] | (flash[i + 3] << 8);
+  // Not all opcodes set both operands.
+  di->op1 = di->op2 = 0;
+  di->id = decode_opcode (cx, di, opcode1, opcode2);
+  if (is_tiny)
+    tiny_opcode_maybe_illegal (di);
+  di->size = opcodes[di->id].size;
+}
+
+// Set the costs of the basic block that starts at word address I from
+// the ones of the next instruction.  A block that would get too long
+// starts a new chunk at the next instruction.
+
+static void
+block_costs (const context_t *cx, decoded_t d[], unsigned i)
+{
+  decoded_t *di = &d[i];
+  unsigned next = i + di->size;
+
+  di->block_insns = 1;
+  di->block_cycles = opcodes[di->id].cycles;
+  if (opcode_ends_block (di->id)
+      || next > cx->pc_mask)
+    return;
+
+  decoded_t *dn = &d[next];
+
+  if (dn->block_insns == MAX_BLOCK_INSNS)
+    {
+      // Block too long:  Start a new chunk at the next instruction.
+      dn->block_insns = dn->block_cycles = 0;
+    }
+  else if (dn->block_insns)
     {
-      word opcode2 = flash[i + 2] | (flash[i + 3] << 8);
-      d[i / 2].id = decode_opcode (&d[i / 2], opcode1, opcode2);
-      if (is_tiny)
-        tiny_opcode_maybe_illegal (&d[i / 2]);
-      opcode1 = opcode2;
+      di->block_insns += dn->block_insns;
+      di->block_cycles += dn->block_cycles;
     }
 }
+
+void
+decode_flash (context_t *cx)
+{
+  program_t *program = &cx->program;
+  decoded_t *d = cx->decoded;
+
+  for (unsigned i = program->code_start; i <= program->code_end; i += 2)
+    decode_at (cx, &d[i / 2], i);
+
+  // Going backwards, accumulate the costs of the basic blocks so that
+  // execute() can account a block as a whole when entering it.  Do this
+  // for all of the flash so that entries outside the code range, which
+  // are ID_BAD_PC, are blocks of one instruction.
+
+  for (unsigned i = cx->pc_mask + 1; i-- > 0; )
+    block_costs (cx, d, i);
+}
+
+
+// SPM changed the flash bytes [LO, HI).  Decode them again, together
+// with the instruction before them which might be a 2-word one, and
+// redo the block costs from just after them downwards until they are
+// the same as before.  Return the lowest word address whose entry has
+// changed.  Entries from there up to HI / 2 + 1 may have changed.
+
+unsigned
+redecode_flash (context_t *cx, unsigned lo, unsigned hi)
+{
+  program_t *program = &cx->program;
+  decoded_t *d = cx->decoded;
+
+  if (lo < program->code_start)
+    program->code_start = lo;
+  if (hi - 1 > program->code_end)
+    program->code_end = hi - 1;
+
+  unsigned first = lo / 2;
+  if (first > 0
+      && d[first - 1].id != ID_BAD_PC)
+    first--;
+
+  for (unsigned i = 2 * first; i < hi; i += 2)
+    decode_at (cx, &d[i / 2], i);
+
+  // The entries above I are as before the change, or done.  Stop when
+  // the ones at I and I + 1 are the same as before since the entries
+  // below them only depend on these.
+
+  unsigned top = hi / 2 + 1;
+  if (top > cx->pc_mask)
+    top = cx->pc_mask;
+
+  decoded_t old, old_next = { 0 };
+  unsigned changed = first;
+
+  for (unsigned i = top + 1; i-- > 0; old_next = old)
+    {
+      old = d[i];
+      block_costs (cx, d, i);
+      if (i >= first)
+        continue;
+
+      if (d[i].block_insns == old.block_insns
+          && d[i].block_cycles == old.block_cycles
+          && d[i + 1].block_insns == old_next.block_insns
+          && d[i + 1].block_cycles == old_next.block_cycles)
+        break;
+      changed = i;
+    }
+
+  return changed;
+}
@@ -24,6 +24,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <stdint.h>
+#include <inttypes.h>
 #include <stdarg.h>
 #include <string.h>
 #include <stdbool.h>
@@ -35,6 +36,8 @@
 #include "graph.h"
 #include "perf.h"
 #include "logging.h"
+#include "replay.h"
+#include "checkpoint.h"
 
 // ports used for application <-> simulator interactions
 #define IN_AVRTEST
@@ -44,9 +47,21 @@
 #error no function herein is needed without AVRTEST_LOG
 #endif // AVRTEST_LOG
 
+#define LEN_LOG_STRING      500
+#define LEN_LOG_XFMT        500
+
 typedef struct
 {
-  // Buffer filled by log_append() and flushed to stdout after the
+  // Offset set by RESET.
+  qword n_insns;
+  qword n_cycles;
+  // Current value for PRAND mode
+  uint32_t pvalue;
+} ticks_port_t;
+
+typedef struct alog
+{
+  // Buffer filled by log_append() and flushed to the output after the
   // instruction has been executed (provided logging is on).
   char data[256];
   // Write position in .data[].
@@ -67,31 +82,31 @@ typedef struct
   // Whether this instruction has been logged
   // LOG_PERF: Just log when at least one perf-meter is on
   bool perf_only;
-} alog_t;
-
-const char s_SREG[] = "CZNVSHTI";
 
+  // LOG_SET_FMT etc.:  1 if xfmt[] applies to the next LOG_<data> only,
+  // -1 if it applies until LOG_UNSET_FMT, cf. sys_log_dump().
+  int fmt_once;
+  char xfmt[LEN_LOG_XFMT];
+  char string[LEN_LOG_STRING];
 
-#define LEN_LOG_STRING      500
-#define LEN_LOG_XFMT        500
+  ticks_port_t ticks_port;
 
-unsigned old_PC, old_old_PC;
-bool log_unused;
-need_t need;
-
-string_table_t string_table;
+  // The state of the generator behind TICKS_GET_RAND_CMD, cf. host_rand().
+  uint64_t rand_state;
+} alog_t;
 
-static alog_t alog;
+const char s_SREG[] = "CZNVSHTI";
 
 void
-log_append (const char *fmt, ...)
+log_append (context_t *cx, const char *fmt, ...)
 {
-  if (log_unused)
+  if (cx->log_unused)
     return;
 
+  alog_t *alog = cx->alog;
   va_list args;
   va_start (args, fmt);
-  alog.pos += vsprintf (alog.pos, fmt, args);
+  alog->pos += vsprintf (alog->pos, fmt, args);
   va_end (args);
 }
 
@@ -187,26 +202,26 @@ log_patch_mnemo (const decoded_t *d, char *buf)
 /* Add a symbol; called by ELF loader.
 
    ADDR  is the value of the symbol.
-   STOFF is the offset into the string table string_table.data[].
+   STOFF is the offset into the string table cx->string_table.data[].
    According to ELF, STOFF is non-null as the first char in
    the string table is always '\0'.
    IS_FUNC is 1 if the symbol table type is STT_FUNC,
    0 otherwise. */
 
 void
-log_set_func_symbol (int addr, size_t stoff, bool is_func)
+log_set_func_symbol (context_t *cx, int addr, size_t stoff, bool is_func)
 {
-  string_table_t *stab = & string_table;
+  string_table_t *stab = & cx->string_table;
 
   if (!stab->data)
-    leave (LEAVE_FATAL, "symbol table is NULL");
+    leave (cx, LEAVE_FATAL, "symbol table is NULL");
 
   const char *name = stab->data + stoff;
 
   if (is_func
       && (addr % 2 != 0
           || addr >= MAX_FLASH_SIZE))
-    leave (LEAVE_ABORTED, "'%s': bad symbol at 0x%x", name, addr);
+    leave (cx, LEAVE_ABORTED, "'%s': bad symbol at 0x%x", name, addr);
 
   if (addr % 2 != 0
       // Something weird, maybe orphan etc.
@@ -218,7 +233,7 @@ log_set_func_symbol (int addr, size_t stoff, bool is_func)
       return;
     }
 
-  graph_elf_symbol (name, stoff, addr / 2, is_func);
+  graph_elf_symbol (cx, name, stoff, addr / 2, is_func);
 
   stab->n_funcs += is_func;
   stab->n_vec += !is_func && str_prefix ("__vector_", name);
@@ -227,79 +242,81 @@ log_set_func_symbol (int addr, size_t stoff, bool is_func)
 
 
 void
-log_set_string_table (char *stab, size_t size, int n_entries)
+log_set_string_table (context_t *cx, char *stab, size_t size, int n_entries)
 {
-  string_table_t *s = & string_table;
+  string_table_t *s = & cx->string_table;
 
   s->data = stab;
   s->size = size;
   s->n_entries = n_entries;
 
-  graph_set_string_table (stab, size, n_entries);
+  graph_set_string_table (cx, stab, size, n_entries);
 }
 
 
 void
-log_finish_string_table (void)
+log_finish_string_table (context_t *cx)
 {
-  string_table_t *s = & string_table;
+  string_table_t *s = & cx->string_table;
 
-  if (options.do_verbose)
-    printf (">>> strtab[%u] %d entries, %d usable, %d functions, %d other, "
-            "%d bad, %d unused vectors\n", 0U + s->size, s->n_entries,
-            s->n_strings, s->n_funcs, s->n_strings - s->n_funcs, s->n_bad,
-            s->n_vec);
+  if (cx->options.do_verbose)
+    fprintf (cx->out, ">>> strtab[%u] %d entries, %d usable, %d functions, "
+             "%d other, %d bad, %d unused vectors\n", 0U + s->size,
+             s->n_entries, s->n_strings, s->n_funcs, s->n_strings - s->n_funcs,
+             s->n_bad, s->n_vec);
 
-  graph_finish_string_table ();
+  graph_finish_string_table (cx);
 }
 
 
 void
-log_add_instr (const decoded_t *d)
+log_add_instr (context_t *cx, const decoded_t *d)
 {
-  alog.id = d->id;
-  old_old_PC = old_PC;
-  old_PC = cpu_PC;
+  alog_t *alog = cx->alog;
+
+  alog->id = d->id;
+  cx->old_old_PC = cx->old_PC;
+  cx->old_PC = cx->pc;
 
   char mnemo_[16];
-  const char *fmt, *mnemo = opcodes[alog.id].mnemonic;
+  const char *fmt, *mnemo = opcodes[alog->id].mnemonic;
 
-  // SYSCALL 0..3 might turn on logging: always log them to alog.data[].
+  // SYSCALL 0..3 might turn on logging: always log them to alog->data[].
 
-  bool maybe_used = (alog.maybe_log
-                     || (alog.id == ID_SYSCALL && d->op1 <= 3));
+  bool maybe_used = (alog->maybe_log
+                     || (alog->id == ID_SYSCALL && d->op1 <= 3));
 
-  if ((log_unused = !maybe_used || !need.logging))
+  if ((cx->log_unused = !maybe_used || !cx->need.logging))
     return;
 
-  if (alog.id == ID_UNDEF)
+  if (alog->id == ID_UNDEF)
     {
-      log_append (arch.pc_3bytes ? "%06x: " : "%04x: ", cpu_PC * 2);
+      log_append (cx, cx->arch.pc_3bytes ? "%06x: " : "%04x: ", cx->pc * 2);
       return;
     }
   
   strcpy (mnemo_, mnemo);
   log_patch_mnemo (d, mnemo_ + strlen (mnemo));
-  fmt = arch.pc_3bytes ? "%06x: %-7s " : "%04x: %-7s ";
-  log_append (fmt, cpu_PC * 2, mnemo_);
+  fmt = cx->arch.pc_3bytes ? "%06x: %-7s " : "%04x: %-7s ";
+  log_append (cx, fmt, cx->pc * 2, mnemo_);
 }
 
 
 void
-log_add_flag_read (int mask, int value)
+log_add_flag_read (context_t *cx, int mask, int value)
 {
-  if (log_unused)
+  if (cx->log_unused)
     return;
 
   int bit = mask_to_bit (mask);
-  log_append (" %c->%c", s_SREG[bit], '0' + !!value);
+  log_append (cx, " %c->%c", s_SREG[bit], '0' + !!value);
 }
 
 
 void
-log_add_data_mov (const char *format, int addr, int value)
+log_add_data_mov (context_t *cx, const char *format, int addr, int value)
 {
-  if (log_unused)
+  if (cx->log_unused)
     return;
 
   char name[16];
@@ -312,14 +329,16 @@ log_add_data_mov (const char *format, int addr, int value)
         if (value & 1)
           *s++ = *f;
       *s++ = '\0';
-      log_append (format, s_name);
+      log_append (cx, format, s_name);
       return;
     }
 
   for (const sfr_t *sfr = named_sfr; ; sfr++)
     {
       if (addr == sfr->addr
-          && (sfr->pon == NULL || *sfr->pon))
+          && (sfr->when == SFR_ALWAYS
+              || (sfr->when == SFR_RAMPD && cx->arch.has_rampd)
+              || (sfr->when == SFR_EIND && cx->arch.has_eind)))
         s_name = sfr->name;
       else if (sfr->name == NULL)
         sprintf (name, addr < 256 ? "%02x" : "%04x", addr);
@@ -328,7 +347,7 @@ log_add_data_mov (const char *format, int addr, int value)
       break;
     }
 
-  log_append (format, s_name, value);
+  log_append (cx, format, s_name, value);
 }
 
 
@@ -392,11 +411,20 @@ decode_avr_float (unsigned val)
    LEN_MAX characters.  */
 
 char*
-read_string (char *p, unsigned addr, bool flash_p, size_t len_max)
+read_string (context_t *cx, char *p, unsigned addr, bool flash_p,
+             size_t len_max)
 {
   char c;
   size_t n = 0;
-  byte *p_avr = log_cpu_address (addr, flash_p ? AR_FLASH : AR_RAM);
+
+  // Don't read past the end of the memory of the device.
+  size_t size = flash_p ? 2 * (cx->pc_mask + 1) : cx->ram_end + 1;
+  if (addr >= size)
+    addr = size - 1, len_max = 1;
+  else if (len_max > size - addr + 1)
+    len_max = size - addr + 1;
+
+  byte *p_avr = log_cpu_address (cx, addr, flash_p ? AR_FLASH : AR_RAM);
 
   while (++n < len_max && (c = *p_avr++))
     if (c != '\r')
@@ -412,9 +440,9 @@ read_string (char *p, unsigned addr, bool flash_p, size_t len_max)
    signed will do the conversion.  */
 
 unsigned
-get_r20_value (const layout_t *lay)
+get_r20_value (context_t *cx, const layout_t *lay)
 {
-  byte *p = log_cpu_address (20, AR_REG);
+  byte *p = log_cpu_address (cx, 20, AR_REG);
   unsigned val = 0;
 
   if (lay->signed_p && (0x80 & p[lay->size - 1]))
@@ -427,21 +455,22 @@ get_r20_value (const layout_t *lay)
 }
 
 
-typedef struct
-{
-  // Offset set by RESET.
-  dword n_insns;
-  dword n_cycles;
-  // Current value for PRAND mode
-  uint32_t pvalue;
-} ticks_port_t;
+// A random number from the host, cf. TICKS_GET_RAND_CMD.  Each context
+// has a generator of its own, seeded by log_init().  It is the 64-bit
+// LCG from Knuth's MMIX, of which the high 32 bits are good enough.
 
+static int
+host_rand (context_t *cx)
+{
+  alog_t *alog = cx->alog;
+  alog->rand_state = (alog->rand_state * 6364136223846793005ULL
+                      + 1442695040888963407ULL);
+  return (int) (uint32_t) (alog->rand_state >> 32);
+}
 
 static void
-sys_ticks_cmd (int cfg)
+sys_ticks_cmd (context_t *cx, int cfg)
 {
-  static ticks_port_t ticks_port;
-
   // a prime m
   const uint32_t prand_m = 0xfffffffb;
   // phi (m)
@@ -450,41 +479,41 @@ sys_ticks_cmd (int cfg)
   const uint32_t prand_root = 0xcafebabe;
 
   cfg &= 0xff;
-  ticks_port_t *tp = &ticks_port;
+  ticks_port_t *tp = &cx->alog->ticks_port;
 
   if (cfg & TICKS_RESET_ALL_CMD)
     {
-      log_append ("ticks reset:");
+      log_append (cx, "ticks reset:");
       if (cfg & TICKS_RESET_CYCLES_CMD)
         {
-          log_append (" cycles");
-          tp->n_cycles = program.n_cycles;
+          log_append (cx, " cycles");
+          tp->n_cycles = cx->program.n_cycles;
         }
       if (cfg & TICKS_RESET_INSNS_CMD)
         {
-          log_append (" insns");
-          tp->n_insns = program.n_insns;
+          log_append (cx, " insns");
+          tp->n_insns = cx->program.n_insns;
         }
       if (cfg & TICKS_RESET_PRAND_CMD)
         {
-          log_append (" prand");
+          log_append (cx, " prand");
           tp->pvalue = 0;
         }
       return;
     }
 
   const char *what = "???";
-  uint32_t value = 0;
+  uint64_t value = 0;
 
-  switch (cfg)
+  switch (cfg & ~TICKS_GET_64_CMD)
     {
     case TICKS_GET_CYCLES_CMD:
       what = "cycles";
-      value = program.n_cycles - tp->n_cycles;
+      value = cx->program.n_cycles - tp->n_cycles;
       break;
     case TICKS_GET_INSNS_CMD:
       what = "insn";
-      value = program.n_insns - tp->n_insns;
+      value = cx->program.n_insns - tp->n_insns;
       break;
     case TICKS_GET_PRAND_CMD:
       what = "prand";
@@ -494,80 +523,88 @@ sys_ticks_cmd (int cfg)
       break;
     case TICKS_GET_RAND_CMD:
       what = "rand";
-      value = rand();
-      value ^= (unsigned) rand() << 11;
-      value ^= (unsigned) rand() << 22;
+      value = (unsigned) replay_input (cx, REPLAY_RAND, cx->program.n_insns,
+                                       host_rand);
       break;
     }
 
-  log_append ("ticks get %s: R22<-(%08x) = %u", what, value, value);
-  byte *p = log_cpu_address (22, AR_REG);
+  // The 64-bit variants return R18...R25, the others R22...R25.
+  if (cfg & TICKS_GET_64_CMD)
+    log_append (cx, "ticks get %s: R18<-(%016"PRIx64") = %"PRIu64,
+                what, value, value);
+  else
+    {
+      value = (uint32_t) value;
+      log_append (cx, "ticks get %s: R22<-(%08"PRIx64") = %"PRIu64,
+                  what, value, value);
+    }
 
-  *p++ = value;
-  *p++ = value >> 8;
-  *p++ = value >> 16;
-  *p++ = value >> 24;
+  int n_bytes = cfg & TICKS_GET_64_CMD ? 8 : 4;
+  byte *p = log_cpu_address (cx, 26 - n_bytes, AR_REG);
+
+  for (int i = 0; i < n_bytes; i++)
+    *p++ = value >> (8 * i);
 }
 
 
 static void
-sys_log_dump (int what)
+sys_log_dump (context_t *cx, int what)
 {
   what &= 0xff;
   if (what >= LOG_X_sentinel)
     {
-      log_append ("log: invalid cmd %d\n", what);
+      log_append (cx, "log: invalid cmd %d\n", what);
       return;
     }
 
-  static int fmt_once = 0;
-  static char xfmt[LEN_LOG_XFMT];
-  static char string[LEN_LOG_STRING];
+  alog_t *alog = cx->alog;
+  char *xfmt = alog->xfmt;
+  char *string = alog->string;
   const layout_t *lay = & layout[what];
-  unsigned val = get_r20_value (lay);
-  const char *fmt = fmt_once ? xfmt : lay->fmt;
+  unsigned val = get_r20_value (cx, lay);
+  const char *fmt = alog->fmt_once ? xfmt : lay->fmt;
 
-  if (fmt_once == 1)
-    fmt_once = 0;
+  if (alog->fmt_once == 1)
+    alog->fmt_once = 0;
 
   switch (what)
     {
     default:
-      log_append ("log %d-byte value", lay->size);
-      printf (fmt, val);
+      log_append (cx, "log %d-byte value", lay->size);
+      fprintf (cx->out, fmt, val);
       break;
 
     case LOG_SET_FMT_ONCE_CMD:
     case LOG_SET_PFMT_ONCE_CMD:
-      log_append ("log set format");
-      fmt_once = 1;
-      read_string (xfmt, val, lay->in_rom, sizeof (xfmt));
+      log_append (cx, "log set format");
+      alog->fmt_once = 1;
+      read_string (cx, xfmt, val, lay->in_rom, sizeof (alog->xfmt));
       break;
 
     case LOG_SET_FMT_CMD:
     case LOG_SET_PFMT_CMD:
-      log_append ("log set format");
-      fmt_once = -1;
-      read_string (xfmt, val, lay->in_rom, sizeof (xfmt));
+      log_append (cx, "log set format");
+      alog->fmt_once = -1;
+      read_string (cx, xfmt, val, lay->in_rom, sizeof (alog->xfmt));
       break;
 
     case LOG_UNSET_FMT_CMD:
-      log_append ("log unset format");
-      fmt_once = 0;
+      log_append (cx, "log unset format");
+      alog->fmt_once = 0;
       break;
 
     case LOG_PSTR_CMD:
     case LOG_STR_CMD:
-      log_append ("log string");
-      read_string (string, val, lay->in_rom, sizeof (string));
-      printf (fmt, string);
+      log_append (cx, "log string");
+      read_string (cx, string, val, lay->in_rom, sizeof (alog->string));
+      fprintf (cx->out, fmt, string);
       break;
 
     case LOG_FLOAT_CMD:
       {
-        log_append ("log float");
+        log_append (cx, "log float");
         avr_float_t af = decode_avr_float (val);
-        printf (fmt, af.x);
+        fprintf (cx->out, fmt, af.x);
       }
       break;
     }
@@ -583,30 +620,36 @@ enum
   };
 
 static void
-sys_log_config (int cmd, int val)
+sys_log_config (context_t *cx, int cmd, int val)
 {
+  alog_t *alog = cx->alog;
+
 #define SET_LOGGING(F, P, C)                                            \
-  do { options.do_log=(F); alog.perf_only=(P); alog.countdown=(C); } while(0)
+  do {                                                                  \
+    cx->options.do_log = (F);                                           \
+    alog->perf_only = (P);                                              \
+    alog->countdown = (C);                                              \
+  } while (0)
 
   // Turning logging on / off
   switch (cmd)
     {
     case LOG_ON_CMD:
-      log_append ("log On");
+      log_append (cx, "log On");
       SET_LOGGING (1, false, 0);
       break;
     case LOG_OFF_CMD:
-      log_append ("log Off");
+      log_append (cx, "log Off");
       SET_LOGGING (0, false, 0);
       break;
     case LOG_PERF_CMD:
-      log_append ("performance log");
+      log_append (cx, "performance log");
       SET_LOGGING (0, true, 0);
       break;
     case LOG_SET_CMD:
-      alog.count_val = val ? val : 0x10000;
-      log_append ("start log %u", alog.count_val);
-      SET_LOGGING (1, false, 1 + alog.count_val);
+      alog->count_val = val ? val : 0x10000;
+      log_append (cx, "start log %u", alog->count_val);
+      SET_LOGGING (1, false, 1 + alog->count_val);
       break;
     }
 
@@ -615,89 +658,194 @@ sys_log_config (int cmd, int val)
 
 
 void
-do_syscall (int sysno, int val)
+do_syscall (context_t *cx, int sysno, int val)
 {
   switch (sysno)
     {
     default:
-      log_append ("void ");
-      qprintf ("*** syscall %d: void\n", sysno);
+      log_append (cx, "void ");
+      qprintf (cx, "*** syscall %d: void\n", sysno);
       break;
 
-    case 0: sys_log_config (LOG_OFF_CMD, 0);    break;
-    case 1: sys_log_config (LOG_ON_CMD, 0);     break;
-    case 2: sys_log_config (LOG_PERF_CMD, 0);   break;
-    case 3: sys_log_config (LOG_SET_CMD, val);  break;
-    case 4: sys_ticks_cmd (val);    break;
-    case 5: sys_perf_cmd (val);     break;
-    case 6: sys_perf_tag_cmd (val); break;
-    case 7: sys_log_dump (val);     break;
+    case 0: sys_log_config (cx, LOG_OFF_CMD, 0);    break;
+    case 1: sys_log_config (cx, LOG_ON_CMD, 0);     break;
+    case 2: sys_log_config (cx, LOG_PERF_CMD, 0);   break;
+    case 3: sys_log_config (cx, LOG_SET_CMD, val);  break;
+    case 4: sys_ticks_cmd (cx, val);    break;
+    case 5: sys_perf_cmd (cx, val);     break;
+    case 6: sys_perf_tag_cmd (cx, val); break;
+    case 7: sys_log_dump (cx, val);     break;
     }
 }
 
 
+// Before the program is loaded:  Allocate the state of the logging, of
+// the call graph and of the perf-meters.
+
+void
+log_open (context_t *cx)
+{
+  alog_t *alog = get_mem (cx, 1, sizeof (alog_t), "alog_t");
+  alog->pos = alog->data;
+  cx->alog = alog;
+
+  graph_open (cx);
+  perf_open (cx);
+}
+
+
 void
-log_init (unsigned val)
+log_init (context_t *cx, unsigned val)
 {
-  perf_init();
+  alog_t *alog = cx->alog;
+  const bool *have_syscall = cx->have_syscall;
+  need_t *need = &cx->need;
 
-  alog.pos = alog.data;
-  alog.maybe_log = true;
-  srand (val);
+  perf_init (cx);
+
+  alog->pos = alog->data;
+  alog->maybe_log = true;
+  alog->rand_state = val;
 
   /**/
 
-  need.perf = have_syscall[5] || have_syscall[6];
+  need->perf = have_syscall[5] || have_syscall[6];
   
-  need.logging = (is_avrtest_log
-                  && (options.do_log
-                      || have_syscall[1]
-                      || (have_syscall[2] && need.perf)
-                      || have_syscall[3]));
+  need->logging = (is_avrtest_log
+                   && (cx->options.do_log
+                       || have_syscall[1]
+                       || (have_syscall[2] && need->perf)
+                       || have_syscall[3]));
+
+  need->graph_cost = cx->options.do_graph || cx->options.do_debug_tree;
+
+  need->call_depth = need->graph_cost || need->logging || need->perf;
+  need->graph = need->call_depth;
+}
+
+// Add the perf-meters, the call graph, the ticks port and whether
+// logging is on to a checkpoint, or get them back if RESTORE, cf.
+// checkpoint.c.
+
+void
+log_checkpoint (context_t *cx, bool restore)
+{
+  alog_t *alog = cx->alog;
+  struct
+  {
+    int on;
+    bool perf_only;
+    unsigned count_val, countdown;
+  } log_state =
+    {
+      cx->options.do_log, alog->perf_only, alog->count_val, alog->countdown
+    };
+
+  perf_checkpoint (cx, restore);
+  graph_checkpoint (cx, restore);
+  checkpoint_data (cx, restore, "ticks", &alog->ticks_port,
+                   sizeof (alog->ticks_port));
+  if (checkpoint_data (cx, restore, "log", &log_state, sizeof (log_state)))
+    {
+      cx->options.do_log = log_state.on;
+      alog->perf_only = log_state.perf_only;
+      alog->count_val = log_state.count_val;
+      alog->countdown = log_state.countdown;
+    }
+}
 
-  need.graph_cost = options.do_graph || options.do_debug_tree;
 
-  need.call_depth = need.graph_cost || need.logging || need.perf;
-  need.graph = need.call_depth;
+/* Whether log_add_instr() and log_dump_line() would have no effect on
+   the output right now, so that avrtest_log can run execute_lean() until
+   the next SYSCALL that might change this.  */
+
+bool
+log_is_idle (const context_t *cx)
+{
+  const alog_t *alog = cx->alog;
+  const perf_t *perf = cx->perf;
+
+  return (!cx->need.graph_cost
+          && !cx->options.do_log
+          && !alog->log_this
+          && !alog->maybe_log
+          && alog->pos == alog->data
+          && !perf->on
+          && !perf->will_be_on
+          && !perf->pmask);
 }
 
 
 void
-log_dump_line (const decoded_t *d)
+log_dump_line (context_t *cx, const decoded_t *d)
 {
-  if (d && alog.countdown && --alog.countdown == 0)
+  alog_t *alog = cx->alog;
+  const perf_t *perf = cx->perf;
+
+  // leave() might get here before log_open().
+  if (!alog)
+    return;
+
+  if (d && alog->countdown && --alog->countdown == 0)
     {
-      options.do_log = 0;
-      qprintf ("*** done log %u\n", alog.count_val);
+      cx->options.do_log = 0;
+      qprintf (cx, "*** done log %u\n", alog->count_val);
     }
 
-  bool log_this = (options.do_log
-                   || (alog.perf_only
-                       && (perf.on || perf.will_be_on)));
-  if (log_this || (log_this != alog.log_this))
+  bool log_this = (cx->options.do_log
+                   || (alog->perf_only
+                       && (perf->on || perf->will_be_on)));
+  if (log_this || (log_this != alog->log_this))
     {
-      alog.maybe_log = true;
-      puts (alog.data);
-      if (log_this && log_unused)
-        leave (LEAVE_FATAL, "problem in log_dump_line");
+      alog->maybe_log = true;
+      fprintf (cx->out, "%s\n", alog->data);
+      if (log_this && cx->log_unused)
+        leave (cx, LEAVE_FATAL, "problem in log_dump_line");
     }
   else
-    alog.maybe_log = false;
+    alog->maybe_log = false;
 
-  alog.log_this = log_this;
+  alog->log_this = log_this;
 
-  alog.pos = alog.data;
-  *alog.pos = '\0';
+  alog->pos = alog->data;
+  *alog->pos = '\0';
 
-  int call_depth = (d && need.call_depth
-                    ? graph_update_call_depth (d)
+  int call_depth = (d && cx->need.call_depth
+                    ? graph_update_call_depth (cx, d)
                     : 0);
 
-  if (!d && options.do_graph)
-    graph_write_dot();
+  if (!d && cx->options.do_graph)
+    graph_write_dot (cx);
+
+  if (cx->need.perf)
+    perf_instruction (cx, d ? d->id : 0, call_depth);
+}
+
+
+// The interrupt with number VECTOR is served at the current PC.  Log it
+// on a line of its own, together with the pushes from do_events().
+
+void
+log_add_irq (context_t *cx, int vector)
+{
+  const alog_t *alog = cx->alog;
+
+  cx->log_unused = !alog->maybe_log || !cx->need.logging;
+  log_append (cx, (cx->arch.pc_3bytes
+                   ? "%06x: IRQ #%-3d " : "%04x: IRQ #%-3d "),
+              cx->pc * 2, vector);
+}
+
+void
+log_dump_irq (context_t *cx)
+{
+  alog_t *alog = cx->alog;
+
+  if (alog->log_this)
+    fprintf (cx->out, "%s\n", alog->data);
 
-  if (need.perf)
-    perf_instruction (d ? d->id : 0, call_depth);
+  alog->pos = alog->data;
+  *alog->pos = '\0';
 }
 
 
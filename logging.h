@@ -59,8 +59,8 @@ enum
 
 extern const layout_t layout[];
 
-extern unsigned get_r20_value (const layout_t*);
+extern unsigned get_r20_value (context_t*, const layout_t*);
 extern avr_float_t decode_avr_float (unsigned);
-extern char* read_string (char*, unsigned, bool, size_t);
+extern char* read_string (context_t*, char*, unsigned, bool, size_t);
 
 #endif // LOGGING_H
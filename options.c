@@ -22,6 +22,8 @@
   Boston, MA 02111-1307, USA.  */
 
 #include <stdlib.h>
+#include <stddef.h>
+#include <limits.h>
 #include <stdio.h>
 #include <stdarg.h>
 #include <string.h>
@@ -34,8 +36,8 @@
 
 static const char USAGE[] =
   "  usage: avrtest [-d] [-e ENTRY] [-m MAXCOUNT] [-mmcu=ARCH] [-runtime]\n"
-  "                 [-no-log] [-no-stdin] [-no-stdout] [-q] [-graph[=FILE]]\n"
-  "                 program [-args [...]]\n"
+  "                 [-[no-]log] [-no-stdin] [-no-stdout] [-q]\n"
+  "                 [-graph[=FILE]] program [-args [...]]\n"
   "         avrtest --help\n"
   "Options:\n"
   "  -h            Show this help and exit.\n"
@@ -43,19 +45,81 @@ static const char USAGE[] =
   "  -d            Initialize SRAM from .data (for ELF program)\n"
   "  -e ENTRY      Byte address of program entry.  Default for ENTRY is\n"
   "                the entry point from the ELF program and 0 for non-ELF.\n"
-  "  -m MAXCOUNT   Execute at most MAXCOUNT instructions.\n"
+  "  -m MAXCOUNT   Execute at most MAXCOUNT instructions.  Except while\n"
+  "                avrtest*_log is logging, the limit is checked at the\n"
+  "                end of basic blocks and might be exceeded slightly.\n"
   "  -q            Quiet operation.  Only print messages explicitly\n"
   "                requested.  Pass exit status from the program.\n"
   "  -runtime      Print avrtest execution time.\n"
+  "  -no-fuse      Don't run frequent sequences of instructions as\n"
+  "                superinstructions.\n"
+  "  -fuse-stats   Print how often the superinstructions and the most\n"
+  "                frequent sequences ran.  Ignored by avrtest*_log.\n"
+  "  -no-skip-delays\n"
+  "                Simulate each round of delay loops like the ones from\n"
+  "                _delay_ms().\n"
+  "  -jit          Compile hot loops to native code.  Only available on\n"
+  "                x86-64 hosts.\n"
+  "  -hle          Run memcpy, memset, strlen, strcmp, __udivmodsi4,\n"
+  "                __do_copy_data and __do_clear_bss natively once their\n"
+  "                costs are known.  Needs an ELF program.  Ignored by\n"
+  "                avrtest*_log.\n"
+  "  -hle-verify   Like -hle, but always run these routines in the\n"
+  "                interpreter and report where the emulation differs.\n"
+  "  -log          Run with logging like avrtest_log.\n"
   "  -no-log       Disable logging in avrtest_log.  Useful when capturing\n"
   "                performance data.  Logging can still be controlled by\n"
   "                the running program, cf. README.\n"
   "  -no-stdin     Disable avrtest_getchar from avrtest.h.\n"
-  "  -no-stdout    Disable avrtest_putchar from avrtest.h.\n"
+  "  -no-stdout    Disable avrtest_putchar from avrtest.h.\n";
+
+// The rest of USAGE, split off because of the length limit of strings.
+static const char USAGE_MORE[] =
+  "  -usart-rx=FILE\n"
+  "                Receive FILE on the USART of -mmcu=DEVICE at its baud\n"
+  "                rate.  FILE may be a pipe, or - for stdin.\n"
+  "  -usart-tx=FILE\n"
+  "                Write what the USART of -mmcu=DEVICE transmits to\n"
+  "                FILE, or to stdout for -.\n"
+  "  -eeprom=FILE  Keep the EEPROM of -mmcu=DEVICE in FILE so that it\n"
+  "                persists across runs.  A new FILE starts out with the\n"
+  "                .eeprom of the program.\n"
+  "  -record=FILE  Write the inputs from the host like avrtest_getchar,\n"
+  "                random numbers, -args, -usart-rx= and -eeprom= to FILE.\n"
+  "  -replay=FILE  Take these inputs from FILE written by -record=FILE so\n"
+  "                that the run repeats the recorded one.\n"
+  "  -seed=N       Seed the random numbers of avrtest_log with N instead\n"
+  "                of the time of day.\n"
+  "  -checkpoint-at=N\n"
+  "                Write a checkpoint once N cycles have been simulated.\n"
+  "  -checkpoint-every=N\n"
+  "                Write a checkpoint every N cycles.\n"
+  "  -checkpoint=FILE\n"
+  "                Write checkpoints to FILE instead of PROGRAM.ckpt.\n"
+  "  -restore=FILE Resume the program from the checkpoint in FILE.\n"
+  "  -status=FILE  Write the exit value, the cycles, the instructions and\n"
+  "                the exit status to FILE as one line when the program\n"
+  "                leaves.\n"
+  "  -fork-server[=SYMBOL]\n"
+  "                Run the program up to main resp. SYMBOL, then read\n"
+  "                runs from stdin, one per line, and run each from there\n"
+  "                in a fork of avrtest.  Needs an ELF program.\n"
+  "  -server [-j N] [OPTION ...]\n"
+  "                Read jobs from stdin and run up to N of them at a time,\n"
+  "                each with the OPTIONs in front of its arguments.  See\n"
+  "                README for the format of jobs and results.\n"
+  "  -batch MANIFEST [-j N] [OPTION ...]\n"
+  "                Run the command line in each line of MANIFEST in a\n"
+  "                pool of N threads, the number of CPUs by default.\n"
+  "                Print a record per job and the totals at the end.\n"
   "  -graph[=FILE] Write a .dot FILE representing the dynamic call graph.\n"
   "                For the dot tool see  http://graphviz.org\n"
   "  -graph-help   Show more options to control graph generation and exit.\n"
-  "  -mmcu=ARCH    Select instruction set for ARCH\n"
+  "  -mmcu=ARCH    Select instruction set for ARCH.  This also selects the\n"
+  "                simulator core and overrides the default from the name\n"
+  "                avrtest has been invoked by, like avrtest-xmega.  For a\n"
+  "                device, also allocate and check memory as of the\n"
+  "                device's memory map.\n"
   "    ARCH is one of:\n";
 
 static const char GRAPH_USAGE[] =
@@ -102,17 +166,25 @@ static const char GRAPH_USAGE[] =
 
 static const arch_t arch_desc[] =
   {
-    { "avr51",     false, false, false, false, 0x01ffff }, // default
-    { "avrxmega6", true,  true,  true,  false, 0x03ffff }, // default if is_xmega = 1
-    { "avrtiny",   false, false, false, true,  0x01ffff }, // default if is_tiny  = 1
-    { "avr6",      true,  true,  false, false, 0x03ffff },
-    { NULL, false, false, false, false, 0}
+    { "avr51",     false, false, false, false, false, 0x01ffff }, // default
+    { "avrxmega6", true,  true,  true,  false, false, 0x03ffff }, // default if is_xmega = 1
+    { "avrtiny",   false, false, false, true,  false, 0x01ffff }, // default if is_tiny  = 1
+    { "avr6",      true,  true,  false, false, false, 0x03ffff },
+    { "avrxmega7", true,  true,  true,  false, true,  0x03ffff },
+    { NULL, false, false, false, false, false, 0}
   };
 
-arch_t arch;
+// List of supported devices with their memory maps.
 
-// args from -args ... to pass to the target program (*_log only)
-args_t args;
+static const device_t device_desc[] =
+  {
+#define AVR_DEVICE(NAME, ARCH, RAM_START, RAM_END, FLASH_SIZE, EEPROM_SIZE, \
+                   LAYOUT, SE)                                          \
+    { #NAME, #ARCH, RAM_START, RAM_END, FLASH_SIZE, EEPROM_SIZE, LAYOUT, SE },
+#include "avr-device.def"
+#undef AVR_DEVICE
+    { NULL, NULL, 0, 0, 0, 0, 0, 0 }
+  };
 
 typedef struct
 {
@@ -120,40 +192,50 @@ typedef struct
   int id;
   // name as known to the command line and prefixed "-no-"
   const char *name;
-  // address of target variable
-  int *pflag;
+  // offset of target variable in options_t
+  size_t flag;
   // default value
   //  int deflt;
-  // string after -foo=
-  const char **psuffix;
+  // offset of string after -foo= in options_t
+  size_t suffix;
 } option_t;
 
 
 static void
-usage (const char *fmt, ...)
+usage (context_t *cx, const char *fmt, ...)
 {
-  static char reason[300];
+  char reason[300];
 
   if (fmt == GRAPH_USAGE)
     {
-      options.do_quiet = 0;
-      qprintf ("%s\n", GRAPH_USAGE);
-      exit (EXIT_SUCCESS);
+      cx->options.do_quiet = 0;
+      qprintf (cx, "%s\n", GRAPH_USAGE);
+      quit (cx, EXIT_SUCCESS);
     }
 
   if (!fmt)
-    options.do_quiet = 0;
+    cx->options.do_quiet = 0;
 
-  qprintf ("%s", USAGE);
+  qprintf (cx, "%s%s", USAGE, USAGE_MORE);
   for (const arch_t *d = arch_desc; d->name; d++)
-    if (is_xmega == d->is_xmega
-        && is_tiny == d->is_tiny)
-      qprintf (" %s", d->name);
+    qprintf (cx, " %s", d->name);
+  qprintf (cx, "\n    or one of the devices:");
+  size_t col = 80;
+  for (const device_t *d = device_desc; d->name; d++)
+    {
+      if (col + 1 + strlen (d->name) > 72)
+        {
+          qprintf (cx, "\n   ");
+          col = 3;
+        }
+      qprintf (cx, " %s", d->name);
+      col += 1 + strlen (d->name);
+    }
 
   if (!fmt)
     {
-      qprintf ("\n");
-      exit (EXIT_SUCCESS);
+      qprintf (cx, "\n");
+      quit (cx, EXIT_SUCCESS);
     }
 
   va_list args;
@@ -161,21 +243,26 @@ usage (const char *fmt, ...)
   vsnprintf (reason, sizeof (reason)-1, fmt, args);
   va_end (args);
 
-  qprintf ("\n");
-  leave (LEAVE_USAGE, "%s%s", reason,
-         options.do_quiet ? ", use -h for help" : "");
+  qprintf (cx, "\n");
+  leave (cx, LEAVE_USAGE, "%s%s", reason,
+         cx->options.do_quiet ? ", use -h for help" : "");
 }
 
 static const option_t option_desc[] =
   {
 #define AVRTEST_OPT(NAME, DEFLT, VAR)                                   \
-    { OPT_##VAR, "-no-"#NAME, &options.do_##VAR, &options.s_##VAR },
+    { OPT_##VAR, "-no-"#NAME, offsetof (options_t, do_##VAR),           \
+      offsetof (options_t, s_##VAR) },
 #include "options.def"
 #undef AVRTEST_OPT
-    { OPT_unknown, NULL, NULL, NULL }
+    { OPT_unknown, NULL, 0, 0 }
   };
 
-options_t options =
+// The flag and the suffix of option O in OPTS.
+#define OPT_FLAG(OPTS, O) (*(int*) ((char*) (OPTS) + (O)->flag))
+#define OPT_SUFFIX(OPTS, O) (*(const char**) ((char*) (OPTS) + (O)->suffix))
+
+static const options_t default_options =
   {
     "",   // .self
 #define AVRTEST_OPT(NAME, DEFLT, VAR)   \
@@ -183,28 +270,82 @@ options_t options =
     "",
 #include "options.def"
 #undef AVRTEST_OPT
+    0,    // .seed
+    0, 0  // .checkpoint_at, .checkpoint_every
   };
 
 
-static unsigned long
-get_valid_number (const char *str, const char *opt)
+static unsigned long long
+get_valid_number (context_t *cx, const char *str, const char *opt)
 {
   char *end;
-  unsigned long val = strtoul (str, &end, 0);
+  unsigned long long val = strtoull (str, &end, 0);
   if (*end && opt)
-    usage ("invalid number %s in '%s'", str, opt);
+    usage (cx, "invalid number %s in '%s'", str, opt);
   if (*end)
-    usage ("invalid number %s", str);
+    usage (cx, "invalid number %s", str);
   return val;
 }
 
 
-// parse command line arguments
+// A device that covers all memory ARCH can address.  Its sleep enable
+// bit is where most devices of ARCH have it.
+
+static device_t
+arch_device (const arch_t *a)
+{
+  return (device_t) { a->name, a->name, 0x40 + io_base, 0xffff,
+                      a->flash_addr_mask + 1, MAX_EEPROM_SIZE, LAYOUT_NONE,
+                      a->is_xmega ? SE_XMEGA : a->is_tiny ? SE_TINY : SE_SMCR };
+}
+
+static void
+set_default_arch (context_t *cx)
+{
+  cx->arch = arch_desc[is_xmega + 2 * is_tiny];
+  cx->device = arch_device (&cx->arch);
+}
+
+// Set the arch and device of CX as of -mmcu=NAME where NAME is an ARCH
+// from arch_desc[] or a device from avr-device.def.
+
+static void
+set_mmcu (context_t *cx, const char *name)
+{
+  const device_t *dev = NULL;
+
+  for (const device_t *d = device_desc; d->name; d++)
+    if (str_eq (name, d->name))
+      {
+        dev = d;
+        break;
+      }
+
+  for (const arch_t *a = arch_desc; ; a++)
+    if (a->name == NULL)
+      usage (cx, "unknown ARCH '%s'", name);
+    else if (is_xmega == a->is_xmega
+             && is_tiny == a->is_tiny
+             && str_eq (dev ? dev->arch : name, a->name))
+      {
+        cx->arch = *a;
+        cx->device = dev ? *dev : arch_device (a);
+        break;
+      }
+}
+
+
+// parse command line arguments into CX
 void
-parse_args (int argc, char *argv[])
+parse_args (context_t *cx, int argc, char *argv[])
 {
-  options.self = argv[0];
-  arch = arch_desc[is_xmega + 2 * is_tiny];
+  program_t *program = &cx->program;
+  options_t *options = &cx->options;
+  args_t *args = &cx->args;
+
+  *options = default_options;
+  options->self = argv[0];
+  set_default_arch (cx);
 
   for (int i = 1; i < argc; i++)
     if (str_eq  (argv[i], "?")
@@ -213,11 +354,11 @@ parse_args (int argc, char *argv[])
         || str_eq (argv[i], "-h")
         || str_eq (argv[i], "-help")
         || str_eq (argv[i], "--help"))
-      usage (NULL);
+      usage (cx, NULL);
     else if (str_eq (argv[i], "-graph-help")
              || str_eq (argv[i], "-help-graph")
              || str_eq (argv[i], "--help=graph"))
-      usage (GRAPH_USAGE);
+      usage (cx, GRAPH_USAGE);
 
   //  Use naive but very portable method to decode arguments.
   for (int i = 1; i < argc; i++)
@@ -229,13 +370,14 @@ parse_args (int argc, char *argv[])
         {
           p = strchr (o->name, '=');
           if (p && str_prefix (o->name + strlen ("-no"), argv[i]))
-            * o->pflag = on = 1, * o->psuffix = 1 + strchr (argv[i], '=');
+            OPT_FLAG (options, o) = on = 1,
+              OPT_SUFFIX (options, o) = 1 + strchr (argv[i], '=');
           else if (p && str_prefix (o->name, argv[i]))
-            * o->pflag = 0, * o->psuffix = "";
+            OPT_FLAG (options, o) = 0, OPT_SUFFIX (options, o) = "";
           else if (str_eq (argv[i], o->name + strlen ("-no")))
-            * o->pflag = on = 1;
+            OPT_FLAG (options, o) = on = 1;
           else if (str_eq (argv[i], o->name))
-            * o->pflag = 0;
+            OPT_FLAG (options, o) = 0;
           else
             continue;
           break;
@@ -244,144 +386,195 @@ parse_args (int argc, char *argv[])
       switch (o->id)
         {
         case OPT_unknown:
-          if (program.name != NULL)
-            usage ("unknown option or duplicate program name '%s'", argv[i]);
+          if (program->name != NULL)
+            usage (cx, "unknown option or duplicate program name '%s'",
+                   argv[i]);
 
-          program.name = program.short_name = argv[i];
+          program->name = program->short_name = argv[i];
           // strip directories
-          if ((p = strrchr (program.short_name, '/')))  program.short_name = p;
-          if ((p = strrchr (program.short_name, '\\'))) program.short_name = p;
+          if ((p = strrchr (program->short_name, '/')))
+            program->short_name = p;
+          if ((p = strrchr (program->short_name, '\\')))
+            program->short_name = p;
           break;
 
         case OPT_mmcu:
           if (!on)
-            arch = arch_desc[is_xmega + 2 * is_tiny];
+            set_default_arch (cx);
           else
-            for (const arch_t *a = arch_desc; ; a++)
-              if (a->name == NULL)
-                usage ("unknown ARCH '%s'", options.s_mmcu);
-              else if ((is_xmega == a->is_xmega
-                        && is_tiny == a->is_tiny)
-                       && str_eq (options.s_mmcu, a->name))
-                {
-                  arch = *a;
-                  break;
-                }
+            set_mmcu (cx, options->s_mmcu);
           break; // -mmcu=
 
         case OPT_entry_point:
           if (++i >= argc)
-            usage ("missing program ENTRY point after '%s'", argv[i-1]);
+            usage (cx, "missing program ENTRY point after '%s'", argv[i-1]);
           if (on)
             {
-              cpu_PC = get_valid_number (argv[i], "-e ENTRY");
-              if (cpu_PC % 2 != 0)
-                usage ("odd byte address as ENTRY point in '-e %s'", argv[i]);
-              if (cpu_PC >= MAX_FLASH_SIZE)
-                usage ("ENTRY point is too big in '-e %s'", argv[i]);
+              cx->pc = get_valid_number (cx, argv[i], "-e ENTRY");
+              if (cx->pc % 2 != 0)
+                usage (cx, "odd byte address as ENTRY point in '-e %s'",
+                       argv[i]);
+              if (cx->pc >= MAX_FLASH_SIZE)
+                usage (cx, "ENTRY point is too big in '-e %s'", argv[i]);
             }
           else
-            cpu_PC = 0;
-          program.entry_point = cpu_PC;
-          cpu_PC /= 2;
+            cx->pc = 0;
+          program->entry_point = cx->pc;
+          cx->pc /= 2;
           break; // -e
 
         case OPT_args:
-          args.argc = on ? argc : i;
-          args.argv = argv;
-          args.i = i;
+          args->argc = on ? argc : i;
+          args->argv = argv;
+          args->i = i;
           i = argc;
           break; // -args
 
         case OPT_max_instr_count:
           if (++i >= argc)
-            usage ("missing MAXCOUNT after '%s'", argv[i-1]);
+            usage (cx, "missing MAXCOUNT after '%s'", argv[i-1]);
           if (on)
-            program.max_insns = get_valid_number (argv[i], "-m MAXCOUNT");
+            program->max_insns = get_valid_number (cx, argv[i],
+                                                   "-m MAXCOUNT");
           break; // -m
 
+        case OPT_seed:
+          if (on)
+            {
+              unsigned long long seed
+                = get_valid_number (cx, options->s_seed, "-seed=N");
+              if (seed > UINT_MAX)
+                usage (cx, "seed is too big in '-seed=%s'", options->s_seed);
+              options->seed = seed;
+            }
+          break; // -seed=
+
+        case OPT_checkpoint_at:
+          if (on)
+            options->checkpoint_at
+              = get_valid_number (cx, options->s_checkpoint_at,
+                                  "-checkpoint-at=N");
+          break; // -checkpoint-at=
+
+        case OPT_checkpoint_every:
+          if (on)
+            options->checkpoint_every
+              = get_valid_number (cx, options->s_checkpoint_every,
+                                  "-checkpoint-every=N");
+          break; // -checkpoint-every=
+
+        case OPT_fork_server:
+          options->do_fork_symbol &= on;
+          break;
+
+        case OPT_fork_symbol:
+          options->do_fork_server = on;
+          break;
+
         case OPT_graph:
-          options.do_graph_filename &= on;
+          options->do_graph_filename &= on;
           break;
 
         case OPT_graph_filename:
-          options.do_graph = on;
+          options->do_graph = on;
           break;
         }
     }
 
-  if (program.name == NULL)
-    usage ("missing program name");
+  if (program->name == NULL)
+    usage (cx, "missing program name");
+
+  options->do_hle |= options->do_hle_verify;
 }
 
 
 static void
-putchar_escaped (char c)
+putchar_escaped (const context_t *cx, char c)
 {
-  if (options.do_quiet)
+  FILE *out = cx->out;
+
+  if (cx->options.do_quiet)
     return;
 
   if (c == '\0') {}
-  else if (c == '\n')  { putchar ('\\'); putchar ('n'); }
-  else if (c == '\t')  { putchar ('\\'); putchar ('t'); }
-  else if (c == '\r')  { putchar ('\\'); putchar ('r'); }
-  else if (c == '\"')  { putchar ('\\'); putchar ('"'); }
-  else if (c == '\\')  { putchar ('\\'); putchar ('\\'); }
-  else putchar (c);
+  else if (c == '\n')  { putc ('\\', out); putc ('n', out); }
+  else if (c == '\t')  { putc ('\\', out); putc ('t', out); }
+  else if (c == '\r')  { putc ('\\', out); putc ('r', out); }
+  else if (c == '\"')  { putc ('\\', out); putc ('"', out); }
+  else if (c == '\\')  { putc ('\\', out); putc ('\\', out); }
+  else putc (c, out);
 }
 
 
 // set argc and argv[] from -args
 void
-put_argv (int args_addr, byte *b)
+put_argv (context_t *cx, int args_addr)
 {
-  // put strings to args_addr 
-  int argc = args.argc - args.i;
+  program_t *program = &cx->program;
+  args_t *args = &cx->args;
+  int argc = args->argc - args->i;
   int a = args_addr;
 
-  for (int i = args.i; i < args.argc; i++)
+  // The strings, argv[] and its NULL must fit in RAM.
+  int size = 2;
+  for (int i = args->i; i < args->argc; i++)
+    {
+      const char *arg = i == args->i ? program->short_name : args->argv[i];
+      size += 1 + strlen (arg) + 2;
+    }
+  if (args_addr < (int) cx->ram_start
+      || args_addr + size > (int) cx->ram_end + 1)
+    leave (cx, LEAVE_USAGE, "-args: %d bytes of arguments at 0x%04x don't fit "
+           "in RAM 0x%04x...0x%04x, use an address inside RAM like "
+           "__heap_start", size, args_addr, cx->ram_start,
+           cx->ram_end);
+
+  // put strings to args_addr
+  byte *b = cx->data + args_addr;
+
+  for (int i = args->i; i < args->argc; i++)
     {
-      const char *arg = i == args.i ? program.short_name : args.argv[i];
+      const char *arg = i == args->i ? program->short_name : args->argv[i];
       int len = 1 + strlen (arg);
       if (is_avrtest_log)
-        qprintf ("*** (%04x) <-- *argv[%d] = \"", a, i - args.i);
+        qprintf (cx, "*** (%04x) <-- *argv[%d] = \"", a, i - args->i);
       strcpy ((char*) b, arg);
       a += len;
       b += len;
       if (is_avrtest_log)
         {
           for (int j = 0; j < len; j++)
-            putchar_escaped (arg[j]);
-          qprintf ("\"\n");
+            putchar_escaped (cx, arg[j]);
+          qprintf (cx, "\"\n");
         }
     }
 
   // put their addresses to argv[]
   int argv = a;
   int aa = args_addr;
-  for (int i = args.i; i < args.argc; i++)
+  for (int i = args->i; i < args->argc; i++)
     {
-      const char *arg = i == args.i ? program.short_name : args.argv[i];
+      const char *arg = i == args->i ? program->short_name : args->argv[i];
       int len = 1 + strlen (arg);
       if (is_avrtest_log)
-        qprintf ("*** (%04x) <-- argv[%d] = %04x\n", a, i - args.i, aa);
+        qprintf (cx, "*** (%04x) <-- argv[%d] = %04x\n", a, i - args->i, aa);
       *b++ = aa;
       *b++ = aa >> 8;
       a += 2;
       aa += len;
     }
   if (is_avrtest_log)
-    qprintf ("*** (%04x) <-- argv[%d] = NULL\n", a, argc);
+    qprintf (cx, "*** (%04x) <-- argv[%d] = NULL\n", a, argc);
   *b++ = 0;
   *b++ = 0;
 
   // set argc, argc: picked up by exit.c:avrtest_init_argc_argv() in .init8
   if (is_avrtest_log)
-    qprintf ("*** -args: at=0x%04x, argc=R24=%d, argv=R22=0x%04x, "
+    qprintf (cx, "*** -args: at=0x%04x, argc=R24=%d, argv=R22=0x%04x, "
              "env=R20=%d\n", args_addr, argc, argv, is_avrtest_log);
 
-  args.avr_argv = argv;
-  args.avr_argc = argc;
+  args->avr_argv = argv;
+  args->avr_argc = argc;
 }
 
 
@@ -390,9 +583,9 @@ put_argv (int args_addr, byte *b)
    token strings.  Set *N to the number of strings.  */
 
 char**
-comma_list_to_array (const char *tokens, int *n)
+comma_list_to_array (context_t *cx, const char *tokens, int *n)
 {
-  char *t, *toks = get_mem (2 + strlen (tokens), sizeof (char), "tok");
+  char *t, *toks = get_mem (cx, 2 + strlen (tokens), sizeof (char), "tok");
 
   // Prepend one ',' for convenience.  We must copy the string anyway.
   sprintf (toks, ",%s", tokens);
@@ -400,7 +593,7 @@ comma_list_to_array (const char *tokens, int *n)
   // Count commas
   for (t = toks, *n = 0; *t; t++)
     *n += *t == ',';
-  char **array = get_mem (*n, sizeof (const char*), "tok[]");
+  char **array = get_mem (cx, *n, sizeof (const char*), "tok[]");
 
   // Find tokens from end to start of TOKS and replace each ',' by
   // a string terminating '\0'.
@@ -38,11 +38,46 @@ typedef struct
   bool is_xmega;
   // True if this is reduced TINY
   bool is_tiny;
+  // True if RAMPX, RAMPY, RAMPZ and RAMPD extend data addresses to 24 bits
+  bool has_rampd;
   // Mask to detect whether cpu_PC is out of bounds
   unsigned int flash_addr_mask;
 } arch_t;
 
-extern arch_t arch;
+// The memory map of the simulated device as of avr-device.def.  For
+// -mmcu=ARCH, or without -mmcu=, a device that covers all of the memory
+// that ARCH can address.
+typedef struct
+{
+  const char *name;
+  const char *arch;
+  unsigned ram_start, ram_end;
+  unsigned flash_size, eeprom_size;
+  int layout;
+  // Where the sleep enable bit is.
+  int se;
+} device_t;
+
+// Layouts of the peripherals as of avr-device.def, cf. periph.c.
+enum
+  {
+    LAYOUT_NONE,
+    LAYOUT_MX8,
+    LAYOUT_M1284,
+    LAYOUT_M2560,
+    LAYOUT_XMEGA
+  };
+
+// Locations of the sleep enable bit as of avr-device.def, cf. func_SLEEP.
+enum
+  {
+    SE_SMCR,
+    SE_MCUCR5,
+    SE_MCUCR6,
+    SE_MCUCR7,
+    SE_TINY,
+    SE_XMEGA
+  };
 
 enum
   {
@@ -64,6 +99,10 @@ typedef struct
 #include "options.def"
 #undef AVRTEST_OPT
 
+  // N from -seed=N
+  unsigned seed;
+  // N from -checkpoint-at=N and -checkpoint-every=N
+  unsigned long long checkpoint_at, checkpoint_every;
 } options_t;
 
 typedef struct
@@ -71,13 +110,14 @@ typedef struct
   int argc, i;
   char **argv;
   int avr_argc, avr_argv;
+  // Where the program asked for its arguments, or 0.
+  int avr_args;
 } args_t;
 
-extern void parse_args (int argc, char *argv[]);
-extern char** comma_list_to_array (const char *tokens, int *n);
+struct context;
 
-extern options_t options;
-extern args_t args;
-extern arch_t arch;
+extern void parse_args (struct context*, int argc, char *argv[]);
+extern char** comma_list_to_array (struct context*, const char *tokens,
+                                   int *n);
 
 #endif // OPTIONS_H
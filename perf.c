@@ -22,9 +22,11 @@
   Boston, MA 02111-1307, USA.  */
 
 #include <stdio.h>
+#include <stddef.h>
 #include <stdlib.h>
 #include <string.h>
 #include <stdbool.h>
+#include <inttypes.h>
 #include <limits.h>
 #include <math.h>
 
@@ -32,6 +34,7 @@
 #include "options.h"
 #include "logging.h"
 #include "perf.h"
+#include "checkpoint.h"
 
 #define IN_AVRTEST
 #include "avrtest.h"
@@ -65,15 +68,15 @@ typedef struct
 // Extremal values and where they occurred (code word address)
 typedef struct
 {
-  long min, min_at, at_start; perf_tag_t tag_min; double dmin; int r_min;
-  long max, max_at, at_end;   perf_tag_t tag_max; double dmax; int r_max;
+  int64_t min, min_at, at_start; perf_tag_t tag_min; double dmin; int r_min;
+  int64_t max, max_at, at_end;   perf_tag_t tag_max; double dmax; int r_max;
   double ev2;
 } minmax_t;
 
 
 // We have 7 perf-meters perfs[1] ... perfs[7]
 // Special index 0 stands for ALL
-typedef struct
+typedef struct perfs
 {
   // We are in / after the n-th START / STOP round resp. have n values
   // form PERF_STAT_xxx()
@@ -85,7 +88,7 @@ typedef struct
   // PERF_START but not directly after PERF_DUMP.
   int valid;
   // Cumulated Ticks and Instructions over all START / STOP rounds
-  unsigned ticks, insns;
+  qword ticks, insns;
   // Program counter from START of round 1 and STOP of last round
   unsigned pc_start, pc_end;
   // Sum over all PERF_STAT_X to compute expectation value
@@ -101,25 +104,22 @@ typedef struct
   {
     // Only instructions with SP smaller than this matter (PERF_START_CALL).
     int sp;
-    dword ticks, insns;
+    qword ticks, insns;
   } call_only;
   // PERF_LABEL
   char label[LEN_PERF_LABEL];
 } perfs_t;
 
 
-perf_t perf;
-static perfs_t perfs[NUM_PERFS];
-
-
 void
-sys_perf_cmd (int x)
+sys_perf_cmd (context_t *cx, int x)
 {
+  perf_t *perf = cx->perf;
   const char *s = "???";
   int n = PERF_N (x);
   int cmd = PERF_CMD(x);
 
-  if (!log_unused)
+  if (!cx->log_unused)
     {
       switch (cmd)
         {
@@ -132,25 +132,26 @@ sys_perf_cmd (int x)
         case PERF_START_CALL_CMD: s = "start on call"; break;
         }
 
-      if (n) log_append ("PERF %d %s", n, s);
-      else   log_append ("PERF all %s", s);
+      if (n) log_append (cx, "PERF %d %s", n, s);
+      else   log_append (cx, "PERF all %s", s);
     }
 
   // Do perf-meter stuff only in avrtest*_log in order
   // to avoid impact on execution speed.
-  perf.pmask = n ? 1 << n : PERF_ALL;
-  perf.will_be_on = cmd == PERF_START_CMD || cmd == PERF_START_CALL_CMD;
-  perf.cmd = cmd;
+  perf->pmask = n ? 1 << n : PERF_ALL;
+  perf->will_be_on = cmd == PERF_START_CMD || cmd == PERF_START_CALL_CMD;
+  perf->cmd = cmd;
 }
 
 
 void
-sys_perf_tag_cmd (int x)
+sys_perf_tag_cmd (context_t *cx, int x)
 {
+  perf_t *perf = cx->perf;
   // PERF_TAG_[P]FMT gets the format string, then
   // PERF_TAG_XXX uses that format on a specific perf-meter
 
-  perfs_t *p = & perfs[PERF_N (x)];
+  perfs_t *p = & perf->perfs[PERF_N (x)];
   int cmd = 0, tag_cmd = PERF_TAG_CMD (x);
   const char *s = "";
 
@@ -167,24 +168,24 @@ sys_perf_tag_cmd (int x)
     case PERF_TAG_FMT_CMD:   s = " fmt";       cmd = LOG_STR_CMD;   break;
     case PERF_TAG_PFMT_CMD:  s = " pfmt";      cmd = LOG_PSTR_CMD;  break;
     }
-  log_append ("PERF%s %d", s, PERF_N (x));
+  log_append (cx, "PERF%s %d", s, PERF_N (x));
 
   const layout_t *lay = & layout[cmd];
-  unsigned raw = get_r20_value (lay);
+  unsigned raw = get_r20_value (cx, lay);
 
   switch (tag_cmd)
     {
     case PERF_TAG_FMT_CMD:
     case PERF_TAG_PFMT_CMD:
-      perf.pending_LOG_TAG_FMT = true;
-      read_string (perfs[0].tag.fmt, raw, lay->in_rom,
-                   sizeof (perfs[0].tag.fmt));
+      perf->pending_LOG_TAG_FMT = true;
+      read_string (cx, perf->perfs[0].tag.fmt, raw, lay->in_rom,
+                   sizeof (perf->perfs[0].tag.fmt));
       return;
 
     case PERF_LABEL_CMD:
     case PERF_PLABEL_CMD:
       if (raw)
-        read_string (p->label, raw, lay->in_rom, sizeof (p->label));
+        read_string (cx, p->label, raw, lay->in_rom, sizeof (p->label));
       else
         * p->label = '\0';
       return;
@@ -196,76 +197,81 @@ sys_perf_tag_cmd (int x)
   t->val = raw;
 
   if (cmd == LOG_STR_CMD)
-    read_string (t->string, t->val, 0, sizeof (t->string));
+    read_string (cx, t->string, t->val, 0, sizeof (t->string));
   else if (cmd == LOG_FLOAT_CMD)
     t->dval = decode_avr_float (t->val).x;
 
-  if (perf.pending_LOG_TAG_FMT)
-    strcpy (t->fmt, perfs[0].tag.fmt);
+  if (perf->pending_LOG_TAG_FMT)
+    strcpy (t->fmt, perf->perfs[0].tag.fmt);
   else
     * t->fmt = '\0';
 
-  perf.pending_LOG_TAG_FMT = false;
+  perf->pending_LOG_TAG_FMT = false;
 }
 
 
 static int
-print_tag (const perf_tag_t *t, const char *no_tag, const char *tag_prefix)
+print_tag (const context_t *cx, const perf_tag_t *t, const char *no_tag,
+           const char *tag_prefix)
 {
   if (t->cmd < 0)
-    return printf ("%s", no_tag);
+    return fprintf (cx->out, "%s", no_tag);
 
-  printf ("%s", tag_prefix);
+  fprintf (cx->out, "%s", tag_prefix);
 
   const char *fmt = *t->fmt ? t->fmt : layout[t->cmd].fmt;
 
   if (t->cmd == LOG_STR_CMD)
-    return printf (fmt, t->string);
+    return fprintf (cx->out, fmt, t->string);
   else if (t->cmd == LOG_FLOAT_CMD)
-    return printf (fmt, t->dval);
+    return fprintf (cx->out, fmt, t->dval);
   else
-    return printf (fmt, t->val);
+    return fprintf (cx->out, fmt, t->val);
 }
 
 static int
-print_tags (const minmax_t *mm, const char *text)
+print_tags (const context_t *cx, const minmax_t *mm, const char *text)
 {
   int pos;
-  printf ("%s", text);
+  fprintf (cx->out, "%s", text);
   if (mm->r_min == mm->r_max)
-    return printf ("     -all-same-                          /\n");
+    return fprintf (cx->out, "     -all-same-                          /\n");
 
-  printf ("%9d %9d", mm->r_min, mm->r_max);
-  pos = print_tag (& mm->tag_min, "    -no-tag-         ", "    ");
-  printf ("%*s", pos >= 20 ? 0 : 20 - pos, " / ");
-  print_tag (& mm->tag_max, "  -no-tag-", "   ");
-  return printf ("\n");
+  fprintf (cx->out, "%9d %9d", mm->r_min, mm->r_max);
+  pos = print_tag (cx, & mm->tag_min, "    -no-tag-         ", "    ");
+  fprintf (cx->out, "%*s", pos >= 20 ? 0 : 20 - pos, " / ");
+  print_tag (cx, & mm->tag_max, "  -no-tag-", "   ");
+  return fprintf (cx->out, "\n");
 }
 
 
 static INLINE void
-minmax_update (minmax_t *mm, long x, const perfs_t *p)
+minmax_update (const context_t *cx, minmax_t *mm, int64_t x,
+               const perfs_t *p)
 {
+  unsigned at = cx->old_PC;
   if (x < mm->min && p->tag.cmd >= 0) mm->tag_min = p->tag;
   if (x > mm->max && p->tag.cmd >= 0) mm->tag_max = p->tag;
-  if (x < mm->min) { mm->min = x; mm->min_at = old_PC; mm->r_min = p->n; }
-  if (x > mm->max) { mm->max = x; mm->max_at = old_PC; mm->r_max = p->n; }
+  if (x < mm->min) { mm->min = x; mm->min_at = at; mm->r_min = p->n; }
+  if (x > mm->max) { mm->max = x; mm->max_at = at; mm->r_max = p->n; }
 }
 
 static INLINE void
-minmax_update_double (minmax_t *mm, double x, const perfs_t *p)
+minmax_update_double (const context_t *cx, minmax_t *mm, double x,
+                      const perfs_t *p)
 {
+  unsigned at = cx->old_PC;
   if (x < mm->dmin && p->tag.cmd >= 0) mm->tag_min = p->tag;
   if (x > mm->dmax && p->tag.cmd >= 0) mm->tag_max = p->tag;
-  if (x < mm->dmin) { mm->dmin = x; mm->min_at = old_PC; mm->r_min = p->n; }
-  if (x > mm->dmax) { mm->dmax = x; mm->max_at = old_PC; mm->r_max = p->n; }
+  if (x < mm->dmin) { mm->dmin = x; mm->min_at = at; mm->r_min = p->n; }
+  if (x > mm->dmax) { mm->dmax = x; mm->max_at = at; mm->r_max = p->n; }
 }
 
 static INLINE void
-minmax_init (minmax_t *mm, long at_start)
+minmax_init (minmax_t *mm, int64_t at_start)
 {
-  mm->min = LONG_MAX;
-  mm->max = LONG_MIN;
+  mm->min = INT64_MAX;
+  mm->max = INT64_MIN;
   mm->at_start = at_start;
   mm->tag_min.cmd = mm->tag_max.cmd = -1;
   mm->dmin = HUGE_VAL;
@@ -274,28 +280,28 @@ minmax_init (minmax_t *mm, long at_start)
 }
 
 static int
-perf_verbose_start (perfs_t *p, int i, int cmd)
+perf_verbose_start (const context_t *cx, perfs_t *p, int i, int cmd)
 {
-  qprintf ("\n--- ");
+  qprintf (cx, "\n--- ");
 
   if (!p->valid)
     {
       if (PERF_START_CMD == cmd)
-        qprintf ("Start T%d (round 1", i);
+        qprintf (cx, "Start T%d (round 1", i);
     }
   else if (PERF_START_CMD == cmd)
     {
       if (PERF_STAT_CMD == p->valid)
-        qprintf ("Start T%d ignored: T%d in Stat mode (%d values",
+        qprintf (cx, "Start T%d ignored: T%d in Stat mode (%d values",
                  i, i, p->n);
       else if (p->on)
-        qprintf ("Start T%d ignored: T%d already started (round %d",
+        qprintf (cx, "Start T%d ignored: T%d already started (round %d",
                  i, i, p->n);
       else
-        qprintf ("reStart T%d (round %d", i, 1 + p->n);
+        qprintf (cx, "reStart T%d (round %d", i, 1 + p->n);
     }
   else if (PERF_START_CMD == p->valid)
-    qprintf ("Stat T%d ignored: T%d is in Start/Stop mode (%s "
+    qprintf (cx, "Stat T%d ignored: T%d is in Start/Stop mode (%s "
              "round %d", i, i, p->on ? "in" : "after", p->n);
 
   // Finishing --- message is perf_stat() resp. perf_start()
@@ -309,7 +315,7 @@ perf_verbose_start (perfs_t *p, int i, int cmd)
 
 // PERF_STAT_XXX (i, x)
 static void
-perf_stat (perfs_t *p, int i, int cmd)
+perf_stat (context_t *cx, perfs_t *p, int i, int cmd)
 {
   if (p->tag_for_start.cmd >= 0)
     p->tag = p->tag_for_start;
@@ -328,7 +334,7 @@ perf_stat (perfs_t *p, int i, int cmd)
     }
 
   double dval;
-  signed sraw = get_r20_value (& layout[LOG_S32_CMD]);
+  signed sraw = get_r20_value (cx, & layout[LOG_S32_CMD]);
   unsigned uraw = (unsigned) sraw & 0xffffffff;
   if (PERF_STAT_U32_CMD == cmd)
     dval = (double) uraw;
@@ -338,22 +344,24 @@ perf_stat (perfs_t *p, int i, int cmd)
     dval = decode_avr_float (uraw).x;
 
   p->n++;
-  minmax_update_double (& p->val, dval, p);
+  minmax_update_double (cx, & p->val, dval, p);
   p->val.ev2 += dval * dval;
   p->val_ev += dval;
 
-  if (!options.do_quiet)
+  if (!cx->options.do_quiet)
     {
-      qprintf ("Stat T%d (value %d = %e", i, p->n, dval);
-      print_tag (& p->tag, "", ", ");
-      qprintf (")\n");
+      qprintf (cx, "Stat T%d (value %d = %e", i, p->n, dval);
+      print_tag (cx, & p->tag, "", ", ");
+      qprintf (cx, ")\n");
     }
 }
 
 // PERF_START (i)
 static void
-perf_start (perfs_t *p, int i, int call_depth)
+perf_start (context_t *cx, perfs_t *p, int i, int call_depth)
 {
+  const perf_t *perf = cx->perf;
+
   {
     if (p->tag_for_start.cmd >= 0)
       p->tag = p->tag_for_start;
@@ -368,11 +376,11 @@ perf_start (perfs_t *p, int i, int call_depth)
       p->valid = PERF_START_CMD;
       p->n = 0;
       p->insns = p->ticks = 0;
-      minmax_init (& p->insn,  program.n_insns);
-      minmax_init (& p->tick,  program.n_cycles);
+      minmax_init (& p->insn,  cx->program.n_insns);
+      minmax_init (& p->tick,  cx->program.n_cycles);
       minmax_init (& p->calls, call_depth);
-      minmax_init (& p->sp,    perf.sp);
-      minmax_init (& p->pc,    p->pc_start = cpu_PC);
+      minmax_init (& p->sp,    perf->sp);
+      minmax_init (& p->pc,    p->pc_start = cx->pc);
     }
 
   // (Re)start
@@ -382,31 +390,34 @@ perf_start (perfs_t *p, int i, int call_depth)
   p->call_only.insns = 0;
   p->call_only.ticks = 0;
   p->n++;
-  p->insn.at_start = program.n_insns;
-  p->tick.at_start = program.n_cycles;
+  p->insn.at_start = cx->program.n_insns;
+  p->tick.at_start = cx->program.n_cycles;
 
-  if (!options.do_quiet)
+  if (!cx->options.do_quiet)
     {
-      print_tag (& p->tag, "", ", ");
-      qprintf (")\n");
+      print_tag (cx, & p->tag, "", ", ");
+      qprintf (cx, ")\n");
     }
 }
 
 
 // PERF_STOP (i)
 static void
-perf_stop (perfs_t *p, int i, bool dump_all, int cmd, int call_depth, int sp)
+perf_stop (context_t *cx, perfs_t *p, int i, bool dump_all, int cmd,
+           int call_depth, int sp)
 {
+  const perf_t *perf = cx->perf;
+
   if (cmd != PERF_DUMP_CMD)
     {
       int ret = 1;
       if (!p->valid)
-        qprintf ("\n--- Stop T%d ignored: -unused-\n", i);
+        qprintf (cx, "\n--- Stop T%d ignored: -unused-\n", i);
       else if (p->valid == PERF_START_CMD && !p->on)
-        qprintf ("\n--- Stop T%d ignored: T%d already stopped (after "
+        qprintf (cx, "\n--- Stop T%d ignored: T%d already stopped (after "
                  "round %d)\n", i, i, p->n);
       else if (p->valid == PERF_STAT_CMD)
-        qprintf ("\n--- Stop T%d ignored: T%d used for Stat (%d Values)\n",
+        qprintf (cx, "\n--- Stop T%d ignored: T%d used for Stat (%d Values)\n",
                  i, i, p->n);
       else
         ret = 0;
@@ -417,12 +428,11 @@ perf_stop (perfs_t *p, int i, bool dump_all, int cmd, int call_depth, int sp)
 
   if (p->valid == PERF_START_CMD && p->on)
     {
-      long ticks;
-      int insns;
+      int64_t ticks, insns;
       p->on = false;
-      p->pc.at_end = p->pc_end = old_old_PC;
-      p->insn.at_end = program.n_insns -1;
-      p->tick.at_end = perf.tick;
+      p->pc.at_end = p->pc_end = cx->old_old_PC;
+      p->insn.at_end = cx->program.n_insns -1;
+      p->tick.at_end = perf->tick;
       p->calls.at_end = call_depth;
       p->sp.at_end = sp;
       if (p->call_only.sp == INT_MAX)
@@ -439,15 +449,15 @@ perf_stop (perfs_t *p, int i, bool dump_all, int cmd, int call_depth, int sp)
       p->insn.ev2 += (double) insns * insns;
       p->ticks += ticks;
       p->insns += insns;
-      minmax_update (& p->insn, insns, p);
-      minmax_update (& p->tick, ticks, p);
+      minmax_update (cx, & p->insn, insns, p);
+      minmax_update (cx, & p->tick, ticks, p);
 
-      qprintf ("%sStop T%d (round %d",
+      qprintf (cx, "%sStop T%d (round %d",
                dump_all ? "  " : "\n--- ", i, p->n);
-      if (!options.do_quiet)
-        print_tag (& p->tag, "", ", ");
+      if (!cx->options.do_quiet)
+        print_tag (cx, & p->tag, "", ", ");
 
-      qprintf (", %04lx--%04lx, %ld Ticks)\n",
+      qprintf (cx, ", %04"PRIx64"--%04"PRIx64", %"PRId64" Ticks)\n",
                2 * p->pc.at_start, 2 * p->pc.at_end, ticks);
     }
 }
@@ -455,26 +465,26 @@ perf_stop (perfs_t *p, int i, bool dump_all, int cmd, int call_depth, int sp)
 
 // PERF_DUMP (i)
 static void
-perf_dump (perfs_t *p, int i, bool dump_all)
+perf_dump (context_t *cx, perfs_t *p, int i, bool dump_all)
 {
   if (!p->valid)
     {
       if (!dump_all)
-        printf (" Timer T%d \"%s\": -unused-\n\n", i, p->label);
+        fprintf (cx->out, " Timer T%d \"%s\": -unused-\n\n", i, p->label);
       return;
     }
 
-  long c = p->calls.at_start;
-  long s = p->sp.at_start;
+  int64_t c = p->calls.at_start;
+  int64_t s = p->sp.at_start;
   if (p->valid == PERF_START_CMD)
-    printf (" Timer T%d \"%s\" (%d round%s):  %04x--%04x\n"
-            "              Instructions        Ticks\n"
-            "    Total:      %7u"  "         %7u\n",
-            i, p->label, p->n, p->n == 1 ? "" : "s",
-            2 * p->pc_start, 2 * p->pc_end, p->insns, p->ticks);
+    fprintf (cx->out, " Timer T%d \"%s\" (%d round%s):  %04x--%04x\n"
+             "              Instructions        Ticks\n"
+             "    Total:      %7"PRIu64"         %7"PRIu64"\n",
+             i, p->label, p->n, p->n == 1 ? "" : "s",
+             2 * p->pc_start, 2 * p->pc_end, p->insns, p->ticks);
   else
-    printf (" Stat  T%d \"%s\" (%d Value%s)\n",
-            i, p->label, p->n, p->n == 1 ? "" : "s");
+    fprintf (cx->out, " Stat  T%d \"%s\" (%d Value%s)\n",
+             i, p->label, p->n, p->n == 1 ? "" : "s");
 
   double e_x2, e_x;
 
@@ -488,30 +498,35 @@ perf_dump (perfs_t *p, int i, bool dump_all)
           e_x2 = p->insn.ev2 / p->n; e_x = (double) p->insns / p->n;
           double insn_sigma = sqrt (e_x2 - e_x*e_x);
 
-          printf ("    Mean:       %7d"  "         %7d\n"
-                  "    Stand.Dev:  %7.1f""         %7.1f\n"
-                  "    Min:        %7ld" "         %7ld\n"
-                  "    Max:        %7ld" "         %7ld\n",
-                  p->insns / p->n, p->ticks / p->n, insn_sigma, tick_sigma,
-                  p->insn.min, p->tick.min, p->insn.max, p->tick.max);
+          fprintf (cx->out, "    Mean:       %7"PRIu64"         %7"PRIu64"\n"
+                   "    Stand.Dev:  %7.1f""         %7.1f\n"
+                   "    Min:        %7"PRId64"         %7"PRId64"\n"
+                   "    Max:        %7"PRId64"         %7"PRId64"\n",
+                   p->insns / p->n, p->ticks / p->n, insn_sigma, tick_sigma,
+                   p->insn.min, p->tick.min, p->insn.max, p->tick.max);
         }
 
-      printf ("    Calls (abs) in [%4ld,%4ld] was:%4ld now:%4ld\n"
-              "    Calls (rel) in [%4ld,%4ld] was:%4ld now:%4ld\n"
-              "    Stack (abs) in [%04lx,%04lx] was:%04lx now:%04lx\n"
-              "    Stack (rel) in [%4ld,%4ld] was:%4ld now:%4ld\n",
-              p->calls.min,   p->calls.max,     c, p->calls.at_end,
-              p->calls.min-c, p->calls.max-c, c-c, p->calls.at_end-c,
-              p->sp.max,      p->sp.min,        s, p->sp.at_end,
-              s-p->sp.max,    s-p->sp.min,    s-s, s-p->sp.at_end);
+      fprintf (cx->out,
+               "    Calls (abs) in [%4"PRId64",%4"PRId64"] was:%4"PRId64
+               " now:%4"PRId64"\n"
+               "    Calls (rel) in [%4"PRId64",%4"PRId64"] was:%4"PRId64
+               " now:%4"PRId64"\n"
+               "    Stack (abs) in [%04"PRIx64",%04"PRIx64"] was:%04"PRIx64
+               " now:%04"PRIx64"\n"
+               "    Stack (rel) in [%4"PRId64",%4"PRId64"] was:%4"PRId64
+               " now:%4"PRId64"\n",
+               p->calls.min,   p->calls.max,     c, p->calls.at_end,
+               p->calls.min-c, p->calls.max-c, c-c, p->calls.at_end-c,
+               p->sp.max,      p->sp.min,        s, p->sp.at_end,
+               s-p->sp.max,    s-p->sp.min,    s-s, s-p->sp.at_end);
       if (p->n > 1)
         {
-          printf ("\n           Min round Max round    "
-                  "Min tag           /   Max tag\n");
-          print_tags (& p->calls, "    Calls  ");
-          print_tags (& p->sp,    "    Stack  ");
-          print_tags (& p->insn,  "    Instr. ");
-          print_tags (& p->tick,  "    Ticks  ");
+          fprintf (cx->out, "\n           Min round Max round    "
+                   "Min tag           /   Max tag\n");
+          print_tags (cx, & p->calls, "    Calls  ");
+          print_tags (cx, & p->sp,    "    Stack  ");
+          print_tags (cx, & p->insn,  "    Instr. ");
+          print_tags (cx, & p->tick,  "    Ticks  ");
         }
     }
   else /* PERF_STAT */
@@ -519,43 +534,58 @@ perf_dump (perfs_t *p, int i, bool dump_all)
       e_x2 = p->val.ev2 / p->n;
       e_x =  p->val_ev  / p->n;
       double val_sigma = sqrt (e_x2 - e_x*e_x);
-      printf ("    Mean:       %e     round    tag\n"
-              "    Stand.Dev:  %e\n", e_x, val_sigma);
-      printf ("    Min:        %e  %8d", p->val.dmin, p->val.r_min);
-      print_tag (& p->val.tag_min, " -no-tag-", "    ");
-      printf ("\n"
-              "    Max:        %e  %8d", p->val.dmax, p->val.r_max);
-      print_tag (& p->val.tag_max, " -no-tag-", "    ");
-      printf ("\n");
+      fprintf (cx->out, "    Mean:       %e     round    tag\n"
+               "    Stand.Dev:  %e\n", e_x, val_sigma);
+      fprintf (cx->out, "    Min:        %e  %8d", p->val.dmin, p->val.r_min);
+      print_tag (cx, & p->val.tag_min, " -no-tag-", "    ");
+      fprintf (cx->out, "\n"
+               "    Max:        %e  %8d", p->val.dmax, p->val.r_max);
+      print_tag (cx, & p->val.tag_max, " -no-tag-", "    ");
+      fprintf (cx->out, "\n");
     }
 
-  printf ("\n");
+  fprintf (cx->out, "\n");
 
   p->valid = 0;
   * p->label = '\0';
 }
 
 
+/* avrtest_log ran instructions in its lean loop where perf_instruction()
+   is not called.  Record what it would have recorded for the last one.  */
+
 void
-perf_instruction (int id, int call_depth)
+perf_lean_resume (context_t *cx)
 {
-  perf.will_be_on = false;
+  perf_t *perf = cx->perf;
+
+  perf->sp = cx->data[addr_SPL] | (cx->data[addr_SPL + 1] << 8);
+  perf->tick = cx->program.n_cycles;
+}
+
+
+void
+perf_instruction (context_t *cx, int id, int call_depth)
+{
+  perf_t *perf = cx->perf;
+
+  perf->will_be_on = false;
 
-  int sp = pSP[0] | (pSP[1] << 8);
+  int sp = cx->data[addr_SPL] | (cx->data[addr_SPL + 1] << 8);
 
   // actions requested by perf SYSCALLs 5..6
 
-  int pmask = perf.pmask;
+  int pmask = perf->pmask;
 
-  if (!perf.on && !pmask)
+  if (!perf->on && !pmask)
     goto done;
 
-  perf.pmask = 0;
-  perf.on = false;
+  perf->pmask = 0;
+  perf->on = false;
 
-  int cmd = perf.cmd;
+  int cmd = perf->cmd;
   if (cmd == PERF_DUMP_CMD)
-    printf ("\n--- Dump # %d:\n", ++perf.n_dumps);
+    fprintf (cx->out, "\n--- Dump # %d:\n", ++perf->n_dumps);
 
   bool dump_all = cmd == PERF_DUMP_CMD  &&  pmask == PERF_ALL;
 
@@ -576,54 +606,78 @@ perf_instruction (int id, int call_depth)
           case PERF_STAT_FLOAT_CMD: stat  = imask; break;
           }
 
-      perfs_t *p = &perfs[i];
+      perfs_t *p = &perf->perfs[i];
 
       if (p->on
           // PERF_START_CALL:  Only account costs (including CALL+RET)
           // if we have a call depth > 0 relative to the starting point.
           && p->call_only.sp < INT_MAX
-          && (sp < p->call_only.sp || perf.sp < p->call_only.sp))
+          && (sp < p->call_only.sp || perf->sp < p->call_only.sp))
         {
           p->call_only.insns += 1;
-          p->call_only.ticks += program.n_cycles - perf.tick;
+          p->call_only.ticks += cx->program.n_cycles - perf->tick;
         }
 
       if (stop || dump)
-        perf_stop (p, i, dump_all, cmd, call_depth, sp);
+        perf_stop (cx, p, i, dump_all, cmd, call_depth, sp);
 
       if (dump)
-        perf_dump (p, i, dump_all);
+        perf_dump (cx, p, i, dump_all);
 
       if (p->on)
         {
-          minmax_update (& p->sp, sp, p);
-          minmax_update (& p->calls, call_depth, p);
+          minmax_update (cx, & p->sp, sp, p);
+          minmax_update (cx, & p->calls, call_depth, p);
         }
 
-      if (start && perf_verbose_start (p, i, PERF_START_CMD))
+      if (start && perf_verbose_start (cx, p, i, PERF_START_CMD))
         {
-          perf_start (p, i, call_depth);
+          perf_start (cx, p, i, call_depth);
           if (cmd == PERF_START_CALL_CMD)
             p->call_only.sp = sp;
         }
-      else if (stat && perf_verbose_start (p, i, cmd))
-        perf_stat (p, i, cmd);
+      else if (stat && perf_verbose_start (cx, p, i, cmd))
+        perf_stat (cx, p, i, cmd);
 
-      perf.on |= p->on;
+      perf->on |= p->on;
     }
 
  done:;
   // Store for the next call of ours.  Needed because log_dump_line()
   // must run after the instruction has performed and we might need
   // the values from before the instruction.
-  perf.sp  = sp;
-  perf.tick = program.n_cycles;
+  perf->sp  = sp;
+  perf->tick = cx->program.n_cycles;
 }
 
 
 void
-perf_init (void)
+perf_open (context_t *cx)
 {
+  perf_t *perf = get_mem (cx, 1, sizeof (perf_t), "perf_t");
+  perf->perfs = get_mem (cx, NUM_PERFS, sizeof (perfs_t), "perfs_t");
+  cx->perf = perf;
+}
+
+
+void
+perf_init (context_t *cx)
+{
+  perf_t *perf = cx->perf;
+
   for (int i = 1; i < NUM_PERFS; i++)
-    perfs[i].tag_for_start.cmd = -1;
+    perf->perfs[i].tag_for_start.cmd = -1;
+}
+
+// Add the perf-meters to a checkpoint, or get them back if RESTORE.
+
+void
+perf_checkpoint (context_t *cx, bool restore)
+{
+  perf_t *perf = cx->perf;
+
+  // Everything but the pointer to perfs[].
+  checkpoint_data (cx, restore, "perf", perf, offsetof (perf_t, perfs));
+  checkpoint_data (cx, restore, "perfs", perf->perfs,
+                   NUM_PERFS * sizeof (perfs_t));
 }
@@ -26,7 +26,7 @@
 
 #include <stdbool.h>
 
-typedef struct
+typedef struct perf
 {
   // Whether any perf-meter is curremtly on;
   bool on;
@@ -34,7 +34,7 @@ typedef struct
   // However log_add_instr() must run before perf_instruction().
   bool will_be_on;
   // PC and SP and program_cycles before the current instruction executed.
-  dword tick;
+  qword tick;
   int sp;
   // Enumerates PERF_DUMP
   int n_dumps;
@@ -44,14 +44,16 @@ typedef struct
   // From PERF_STOP_XXX()
   double dval;
   bool pending_LOG_TAG_FMT;
+  // The perf-meters, cf. perf.c.  Index 0 stands for ALL.
+  struct perfs *perfs;
 } perf_t;
 
-extern void perf_init (void);
-extern void sys_perf_cmd (int x);
-extern void sys_perf_tag_cmd (int x);
-extern void perf_instruction (int id, int call_depth);
-
-extern perf_t perf;
+extern void perf_open (context_t*);
+extern void perf_init (context_t*);
+extern void sys_perf_cmd (context_t*, int x);
+extern void sys_perf_tag_cmd (context_t*, int x);
+extern void perf_instruction (context_t*, int id, int call_depth);
+extern void perf_checkpoint (context_t*, bool);
 
 #endif // PERF_H
 
@@ -0,0 +1,106 @@
+/*
+  This file is part of avrtest -- A simple simulator for the
+  Atmel AVR family of microcontrollers designed to test the compiler.
+
+  Copyright (C) 2001, 2002, 2003   Theodore A. Roth, Klaus Rudolph
+  Copyright (C) 2007 Paulo Marques
+  Copyright (C) 2008-2026 Free Software Foundation, Inc.
+
+  avrtest is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 2 of the License, or
+  (at your option) any later version.
+
+  avrtest is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with avrtest; see the file COPYING.  If not, write to
+  the Free Software Foundation, 59 Temple Place - Suite 330,
+  Boston, MA 02111-1307, USA.  */
+
+/* Peripherals.
+
+   The I/O registers of the modelled peripherals are hooked by address
+   so that the memory accessors of avrtest.c can hand them over.  The
+   pages of the data space that hold them are tagged as I/O, cf.
+   map_pages(), hence plain RAM accesses don't see them.  Devices without
+   peripherals, and -mmcu=ARCH, have periph_end = 0.  The peripherals
+   compute their state from the cycle count at the time of the access,
+   and use events from irq.c for what has to happen in between.  */
+
+#include <string.h>
+
+#include "testavr.h"
+#include "options.h"
+#include "periph.h"
+
+// Hook the peripherals of the device from -mmcu= and reset them.
+
+void
+periph_init (context_t *cx)
+{
+  memset (cx->periph_hook, 0, sizeof (cx->periph_hook));
+  timers_map (cx, cx->device.layout);
+  usarts_map (cx, cx->device.layout);
+  eeprom_map (cx, cx->device.layout);
+
+  cx->periph_end = 0;
+  for (unsigned a = 0; a < PERIPH_END_MAX; a++)
+    if (cx->periph_hook[a])
+      cx->periph_end = a + 1;
+
+  timers_init (cx);
+  usarts_init (cx);
+  eeprom_init (cx);
+}
+
+// Read I/O register ADDR at cycle NOW.
+
+int
+periph_read (context_t *cx, int addr, qword now)
+{
+  int h = cx->periph_hook[addr];
+
+  return h & PERIPH_USART
+    ? usart_read (cx, PERIPH_INDEX (h), addr, now)
+    : h & PERIPH_EEPROM
+    ? eeprom_read (cx, addr, now)
+    : timer_read (cx, PERIPH_INDEX (h), addr, now);
+}
+
+// Write VALUE to I/O register ADDR at cycle NOW.
+
+void
+periph_write (context_t *cx, int addr, int value, qword now)
+{
+  int h = cx->periph_hook[addr];
+
+  if (h & PERIPH_USART)
+    usart_write (cx, PERIPH_INDEX (h), addr, value & 0xff, now);
+  else if (h & PERIPH_EEPROM)
+    eeprom_write (cx, addr, value & 0xff, now);
+  else
+    timer_write (cx, PERIPH_INDEX (h), addr, value & 0xff, now);
+}
+
+// The core has vectored to VECTOR.  Clear the flag that raised it.
+
+void
+periph_irq_taken (context_t *cx, int vector)
+{
+  timer_irq_taken (cx, vector);
+  usart_irq_taken (cx, vector);
+  eeprom_irq_taken (cx, vector);
+}
+
+// The program is about to leave:  Hand over what is still buffered.
+
+void
+periph_finish (context_t *cx)
+{
+  usarts_finish (cx);
+  eeprom_finish (cx);
+}
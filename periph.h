@@ -0,0 +1,78 @@
+/*
+  This file is part of avrtest -- A simple simulator for the
+  Atmel AVR family of microcontrollers designed to test the compiler.
+
+  Copyright (C) 2001, 2002, 2003   Theodore A. Roth, Klaus Rudolph
+  Copyright (C) 2007 Paulo Marques
+  Copyright (C) 2008-2026 Free Software Foundation, Inc.
+
+  avrtest is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 2 of the License, or
+  (at your option) any later version.
+
+  avrtest is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with avrtest; see the file COPYING.  If not, write to
+  the Free Software Foundation, 59 Temple Place - Suite 330,
+  Boston, MA 02111-1307, USA.  */
+
+#ifndef PERIPH_H
+#define PERIPH_H
+
+#include <stdbool.h>
+
+// I/O addresses below cx->periph_end with cx->periph_hook[] != 0 belong
+// to a peripheral model and are accessed by periph_read() and
+// periph_write() instead of plain memory accesses.  periph_end is 0 if
+// the device from -mmcu= has no peripherals.  The low bits of a hook are
+// 1 + the number of the timer from timer.c, of the USART from usart.c if
+// PERIPH_USART is set, or 1 for the EEPROM from eeprom.c if
+// PERIPH_EEPROM is set.  PERIPH_W1C marks flag registers whose bits are
+// cleared by writing ones.
+#define PERIPH_EEPROM  0x20
+#define PERIPH_USART   0x40
+#define PERIPH_W1C     0x80
+#define PERIPH_INDEX(HOOK) (((HOOK) & 0x1f) - 1)
+
+extern void periph_init (context_t*);
+extern int periph_read (context_t*, int, qword);
+extern void periph_write (context_t*, int, int, qword);
+extern void periph_irq_taken (context_t*, int);
+extern void periph_finish (context_t*);
+
+// timer.c
+extern void timers_map (context_t*, int);
+extern void timers_init (context_t*);
+extern int timer_read (context_t*, int, int, qword);
+extern void timer_write (context_t*, int, int, int, qword);
+extern void timer_irq_taken (context_t*, int);
+extern void timer_event (context_t*, int);
+
+// usart.c
+extern void usarts_map (context_t*, int);
+extern void usarts_init (context_t*);
+extern int usart_read (context_t*, int, int, qword);
+extern void usart_write (context_t*, int, int, int, qword);
+extern void usart_irq_taken (context_t*, int);
+extern void usarts_finish (context_t*);
+extern void usart_event (context_t*, int);
+extern qword usarts_received (const context_t*);
+extern void usarts_skip (context_t*, qword);
+
+// eeprom.c
+extern void eeprom_map (context_t*, int);
+extern void eeprom_init (context_t*);
+extern int eeprom_read (context_t*, int, qword);
+extern void eeprom_write (context_t*, int, int, qword);
+extern void eeprom_write_mapped (context_t*, unsigned, int);
+extern void eeprom_irq_taken (context_t*, int);
+extern void eeprom_open (context_t*);
+extern void eeprom_finish (context_t*);
+extern void eeprom_event (context_t*, int);
+
+#endif // PERIPH_H
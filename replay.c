@@ -0,0 +1,349 @@
+/*
+  This file is part of avrtest -- A simple simulator for the
+  Atmel AVR family of microcontrollers designed to test the compiler.
+
+  Copyright (C) 2001, 2002, 2003   Theodore A. Roth, Klaus Rudolph
+  Copyright (C) 2007 Paulo Marques
+  Copyright (C) 2008-2026 Free Software Foundation, Inc.
+
+  avrtest is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 2 of the License, or
+  (at your option) any later version.
+
+  avrtest is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with avrtest; see the file COPYING.  If not, write to
+  the Free Software Foundation, 59 Temple Place - Suite 330,
+  Boston, MA 02111-1307, USA.  */
+
+/* Record and replay.
+
+   A run only depends on the program and the command line, except for
+   the inputs that come from the host:  The seed of the random numbers
+   of avrtest_log, which is the time of day unless -seed=N is given, the
+   arguments from -args, the characters read by avrtest_getchar, the
+   random numbers from the ticks syscall, the frames received from
+   -usart-rx=, and the EEPROM from -eeprom= as the program starts.
+
+   -record=FILE writes these inputs to FILE as they are consumed, and
+   -replay=FILE feeds them back instead of asking the host.  Hence a run
+   can be repeated bit by bit, also with avrtest_log for analysis.  FILE
+   has one input per line:
+
+       KIND INDEX VALUE
+
+   INDEX is the number of instructions executed before the one that read
+   the input, or the position of the input in its stream for USART
+   frames and EEPROM bytes.  VALUE is hex, or a hex encoded string for
+   the arguments.  Replay checks INDEX so that a run that goes astray is
+   stopped where it leaves the recording.  */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <inttypes.h>
+
+#include "testavr.h"
+#include "options.h"
+#include "replay.h"
+
+static const char *const kind_name[N_REPLAY] =
+  {
+    [REPLAY_GETCHAR] = "getchar",
+    [REPLAY_RAND]    = "rand",
+    [REPLAY_USART]   = "usart",
+    [REPLAY_EEPROM]  = "eeprom"
+  };
+
+typedef struct
+{
+  qword index;
+  dword value;
+} input_t;
+
+// The state of -record= and -replay= of a context, allocated by
+// replay_open() when needed.
+struct replay
+{
+  // -replay=:  The recorded inputs of each kind, and how many of them
+  // have been replayed.
+  struct
+  {
+    input_t *input;
+    size_t n, pos, size;
+  } stream[N_REPLAY];
+
+  bool have_seed;
+  unsigned seed;
+
+  // -record=
+  FILE *record;
+};
+
+
+static void
+add_input (context_t *cx, int kind, qword index, dword value)
+{
+  __typeof__ (cx->replay->stream[0]) *s = & cx->replay->stream[kind];
+
+  if (s->n == s->size)
+    {
+      size_t size = s->size ? 2 * s->size : 1024;
+      input_t *input = get_mem (cx, size, sizeof (input_t), "-replay");
+      if (s->n)
+        memcpy (input, s->input, s->n * sizeof (input_t));
+      put_mem (cx, s->input);
+      s->input = input;
+      s->size = size;
+    }
+  s->input[s->n++] = (input_t) { index, value };
+}
+
+// Read a hex encoded string up to the end of the line.
+
+static char*
+read_hex_string (context_t *cx, FILE *f)
+{
+  size_t n = 0, size = 16;
+  char *str = get_mem (cx, size, 1, "-replay");
+  int c, hi = -1;
+
+  while ((c = fgetc (f)) == ' ')
+    ;
+  for (; isxdigit (c); c = fgetc (f))
+    {
+      int nibble = isdigit (c) ? c - '0' : tolower (c) - 'a' + 10;
+      if (hi < 0)
+        {
+          hi = nibble;
+          continue;
+        }
+      if (n + 1 == size)
+        {
+          char *s = get_mem (cx, 2 * size, 1, "-replay");
+          memcpy (s, str, n);
+          put_mem (cx, str);
+          str = s;
+          size *= 2;
+        }
+      str[n++] = (hi << 4) | nibble;
+      hi = -1;
+    }
+  return str;
+}
+
+static void
+read_recording (context_t *cx, const char *name)
+{
+  struct replay *r = cx->replay;
+  FILE *f = get_file (cx, name, "r");
+  if (!f)
+    leave (cx, LEAVE_IO, "cannot read -replay=%s", name);
+
+  char kind[16];
+  unsigned long long index;
+  unsigned value;
+  char **argv = NULL;
+  int argc = 0, n;
+
+  while ((n = fscanf (f, "%15s %llx", kind, &index)) == 2)
+    {
+      if (str_eq (kind, "arg"))
+        {
+          if (index >= (unsigned) argc)
+            leave (cx, LEAVE_USAGE, "-replay=%s: bad arg %llx", name,
+                   index);
+          argv[index] = read_hex_string (cx, f);
+          continue;
+        }
+
+      if (fscanf (f, "%x", &value) != 1)
+        {
+          n = 0;
+          break;
+        }
+
+      if (str_eq (kind, "seed"))
+        {
+          r->have_seed = true;
+          r->seed = value;
+        }
+      else if (str_eq (kind, "args"))
+        {
+          argc = value;
+          argv = get_mem (cx, argc + 1, sizeof (char*), "-replay");
+        }
+      else
+        {
+          int k = 0;
+          while (k < N_REPLAY && !str_eq (kind, kind_name[k]))
+            k++;
+          if (k == N_REPLAY)
+            {
+              n = 0;
+              break;
+            }
+          add_input (cx, k, index, value);
+        }
+    }
+
+  if (n != EOF)
+    leave (cx, LEAVE_USAGE, "-replay=%s: bad recording", name);
+  put_file (cx, f);
+
+  // The program sees the recorded arguments, and argv[0] is the
+  // recorded name of the program.
+  cx->options.do_args = argc > 0;
+  if (argc > 0)
+    {
+      for (int i = 0; i < argc; i++)
+        if (!argv[i])
+          leave (cx, LEAVE_USAGE, "-replay=%s: arg %x is missing", name, i);
+      cx->args.argv = argv;
+      cx->args.argc = argc;
+      cx->args.i = 0;
+      cx->program.short_name = argv[0];
+    }
+}
+
+static void
+record_args (context_t *cx)
+{
+  const program_t *program = & cx->program;
+  const args_t *args = & cx->args;
+  FILE *record = cx->replay->record;
+  int argc = cx->options.do_args ? args->argc - args->i : 0;
+
+  fprintf (record, "args 0 %x\n", argc);
+  for (int i = 0; i < argc; i++)
+    {
+      const char *arg = i == 0 ? program->short_name : args->argv[args->i + i];
+      fprintf (record, "arg %x ", i);
+      for (; *arg; arg++)
+        fprintf (record, "%02x", (byte) *arg);
+      fprintf (record, "\n");
+    }
+}
+
+
+// Set up -record=FILE resp. -replay=FILE once the command line is known.
+
+void
+replay_open (context_t *cx)
+{
+  const options_t *options = & cx->options;
+
+  if (options->do_record && options->do_replay)
+    leave (cx, LEAVE_USAGE, "-record= and -replay= exclude each other");
+
+  if (options->do_record || options->do_replay)
+    cx->replay = get_mem (cx, 1, sizeof (struct replay), "-replay");
+
+  if (options->do_replay)
+    read_recording (cx, options->s_replay);
+
+  if (options->do_record)
+    {
+      FILE *record = get_file (cx, options->s_record, "w");
+      if (!record)
+        leave (cx, LEAVE_IO, "cannot write -record=%s", options->s_record);
+      setvbuf (record, NULL, _IOFBF, 1 << 16);
+      cx->replay->record = record;
+      record_args (cx);
+    }
+}
+
+// The seed for the random numbers:  The recorded one, the one from
+// -seed=N, or DEFLT.
+
+unsigned
+replay_seed (context_t *cx, unsigned deflt)
+{
+  const struct replay *r = cx->replay;
+  unsigned value = cx->options.do_replay && r->have_seed ? r->seed
+    : cx->options.do_seed ? cx->options.seed
+    : deflt;
+
+  if (r && r->record)
+    fprintf (r->record, "seed 0 %x\n", value);
+  return value;
+}
+
+// The program reads an input of KIND at INDEX:  Get it from the
+// recording with -replay=, or else from SOURCE.  Record it with -record=.
+
+int
+replay_input (context_t *cx, int kind, qword index,
+              int (*source) (context_t*))
+{
+  struct replay *r = cx->replay;
+  int value;
+
+  if (!r)
+    return source (cx);
+
+  if (cx->options.do_replay)
+    {
+      __typeof__ (r->stream[0]) *s = & r->stream[kind];
+      if (s->pos == s->n)
+        leave (cx, LEAVE_ABORTED, "-replay=%s: no more %s input at %"
+               PRIu64, cx->options.s_replay, kind_name[kind], index);
+      const input_t *in = & s->input[s->pos++];
+      if (in->index != index)
+        leave (cx, LEAVE_ABORTED, "-replay=%s: %s input at %" PRIu64
+               " was recorded at %" PRIu64, cx->options.s_replay,
+               kind_name[kind], index, in->index);
+      value = (int) in->value;
+    }
+  else
+    value = source (cx);
+
+  if (r->record)
+    fprintf (r->record, "%s %" PRIx64 " %x\n", kind_name[kind], index,
+             (unsigned) value);
+  return value;
+}
+
+// MEM[] of SIZE bytes is an input of KIND as a whole.  With -replay=,
+// set it to the recorded contents.  With -record=, record its bytes
+// other than 0.
+
+void
+replay_memory (context_t *cx, int kind, byte *mem, unsigned size)
+{
+  const struct replay *r = cx->replay;
+
+  if (cx->options.do_replay)
+    {
+      memset (mem, 0, size);
+      for (size_t i = 0; i < r->stream[kind].n; i++)
+        if (r->stream[kind].input[i].index < size)
+          mem[r->stream[kind].input[i].index]
+            = r->stream[kind].input[i].value;
+    }
+
+  if (r && r->record)
+    for (unsigned i = 0; i < size; i++)
+      if (mem[i])
+        fprintf (r->record, "%s %x %x\n", kind_name[kind], i, mem[i]);
+}
+
+// The program is about to leave.
+
+void
+replay_finish (context_t *cx)
+{
+  struct replay *r = cx->replay;
+
+  if (r && r->record)
+    {
+      put_file (cx, r->record);
+      r->record = NULL;
+    }
+}
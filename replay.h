@@ -0,0 +1,47 @@
+/*
+  This file is part of avrtest -- A simple simulator for the
+  Atmel AVR family of microcontrollers designed to test the compiler.
+
+  Copyright (C) 2001, 2002, 2003   Theodore A. Roth, Klaus Rudolph
+  Copyright (C) 2007 Paulo Marques
+  Copyright (C) 2008-2026 Free Software Foundation, Inc.
+
+  avrtest is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 2 of the License, or
+  (at your option) any later version.
+
+  avrtest is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with avrtest; see the file COPYING.  If not, write to
+  the Free Software Foundation, 59 Temple Place - Suite 330,
+  Boston, MA 02111-1307, USA.  */
+
+#ifndef REPLAY_H
+#define REPLAY_H
+
+// The inputs that -record= writes and -replay= reads back, cf. replay.c.
+enum
+  {
+    // A character from avrtest_getchar.
+    REPLAY_GETCHAR,
+    // A random number from avrtest_ticks of avrtest_log.
+    REPLAY_RAND,
+    // A frame received by the USART from -usart-rx=.
+    REPLAY_USART,
+    // A byte of the EEPROM from -eeprom= as the program starts.
+    REPLAY_EEPROM,
+    N_REPLAY
+  };
+
+extern void replay_open (context_t*);
+extern unsigned replay_seed (context_t*, unsigned);
+extern int replay_input (context_t*, int, qword, int (*) (context_t*));
+extern void replay_memory (context_t*, int, byte*, unsigned);
+extern void replay_finish (context_t*);
+
+#endif // REPLAY_H
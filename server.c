@@ -0,0 +1,609 @@
+/*
+  This file is part of avrtest -- A simple simulator for the
+  Atmel AVR family of microcontrollers designed to test the compiler.
+
+  Copyright (C) 2001, 2002, 2003   Theodore A. Roth, Klaus Rudolph
+  Copyright (C) 2007 Paulo Marques
+  Copyright (C) 2008-2026 Free Software Foundation, Inc.
+
+  avrtest is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 2 of the License, or
+  (at your option) any later version.
+
+  avrtest is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with avrtest; see the file COPYING.  If not, write to
+  the Free Software Foundation, 59 Temple Place - Suite 330,
+  Boston, MA 02111-1307, USA.  */
+
+/* Server mode.
+
+   avrtest -server [-j N] [OPTION ...] reads jobs from stdin and writes
+   their results to stdout, so that a test harness can run thousands of
+   programs without starting avrtest for each of them.  A job is
+
+       job ID N_ARGS N_STDIN
+       ARG                      (N_ARGS lines, one argument per line)
+       STDIN                    (N_STDIN bytes)
+
+   where the ARGs are a command line of avrtest like -mmcu=atmega128
+   -m 200000000 prog.elf -args 1 2, and STDIN is what avrtest_getchar
+   reads.  The OPTIONs from the command line of the server come before
+   the ARGs of each job.  Once a job has finished, the server writes
+
+       done ID CODE CYCLES INSNS N_OUTPUT STATUS
+       OUTPUT                   (N_OUTPUT bytes)
+
+   where CODE is the value that avrtest would have exited with, STATUS
+   is the exit status like EXIT or ABORTED, and OUTPUT is what the job
+   wrote to stdout and stderr.  If the job left without telling its
+   status, e.g. because it crashed, then STATUS is - and CODE is 128
+   plus the number of the signal.
+
+   This file is part of the avrtest executable, not of a core:  Each job
+   runs in a fork of the server that has not yet picked a core, hence
+   the job starts from scratch just like a new avrtest, only without
+   exec().  Up to N jobs run at the same time, and their results are
+   written as they finish.  The job learns about its status by means of
+   -status=/dev/fd/3, which is a pipe to the server.
+
+   avrtest -batch MANIFEST [-j N] [OPTION ...] takes the jobs from
+   MANIFEST, one command line per line, and runs them with no stdin in a
+   pool of N threads, the number of host CPUs by default.  A thread runs
+   a job by job_main() of its core, which keeps all state of the run in
+   a context of its own, and takes the next job once it is done.  The
+   job writes to a temporary file that is copied to stdout in one piece,
+   followed by a record with its status, cycles, instructions and time.
+   A summary with the totals comes at the end.  */
+
+// For fork, waitpid and poll with -std=c99.
+#define _DEFAULT_SOURCE
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdarg.h>
+#include <stdbool.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/time.h>
+#ifndef _WIN32
+#include <poll.h>
+#include <sys/wait.h>
+#include <pthread.h>
+#endif
+
+#include "server.h"
+
+#ifdef _WIN32
+
+int
+server_main (int argc, char *argv[], int (*run) (int, char*[]),
+             job_main_t *job)
+{
+  (void) argc;
+  (void) run;
+  (void) job;
+  fprintf (stderr, "%s: -server and -batch are not available on this "
+           "host\n", argv[0]);
+  return EXIT_FAILURE;
+}
+
+#else
+
+typedef struct
+{
+  pid_t pid;
+  char *id;
+  // The output of the job, and the read end of its -status= pipe.
+  FILE *out;
+  int status_fd;
+  char status[128];
+  size_t n_status;
+} job_t;
+
+static job_t *job;
+static int n_jobs, max_jobs;
+
+static const char *self;
+
+// The OPTIONs of the server that go in front of the ARGs of each job.
+static char **defaults;
+static int n_defaults;
+
+static int (*run_core) (int, char*[]);
+static job_main_t *run_job;
+
+// -batch:  The jobs from MANIFEST, the next one to run, and the totals.
+// The threads take jobs and add to the totals with BATCH_LOCK held.
+typedef struct
+{
+  // The line in MANIFEST, which names the job, and its words.
+  int line;
+  char **args;
+  int n_args;
+} batch_job_t;
+
+static char *manifest;
+static batch_job_t *batch;
+static int n_batch, next_batch;
+static pthread_mutex_t batch_lock = PTHREAD_MUTEX_INITIALIZER;
+
+static struct
+{
+  unsigned n_jobs, n_pass, n_fail, n_timeout;
+  unsigned long long cycles, insns;
+} total;
+
+static void __attribute__((__noreturn__, __format__(printf, 1, 2)))
+fatal (const char *fmt, ...)
+{
+  va_list args;
+  va_start (args, fmt);
+  fprintf (stderr, "%s: -server: ", self);
+  vfprintf (stderr, fmt, args);
+  fprintf (stderr, "\n");
+  va_end (args);
+  exit (EXIT_FAILURE);
+}
+
+static void*
+xmalloc (size_t n)
+{
+  void *p = malloc (n ? n : 1);
+  if (!p)
+    fatal ("out of memory");
+  return p;
+}
+
+// Jobs are read from stdin by read() so that no FILE buffer of stdin
+// ends up in the jobs, and so that poll() tells whether there is more.
+
+static char in_buf[1 << 16];
+static size_t in_pos, in_len;
+
+static int
+in_getc (void)
+{
+  if (in_pos == in_len)
+    {
+      ssize_t n = read (STDIN_FILENO, in_buf, sizeof (in_buf));
+      if (n <= 0)
+        return EOF;
+      in_pos = 0;
+      in_len = n;
+    }
+  return (unsigned char) in_buf[in_pos++];
+}
+
+// Read a line without its '\n', or return NULL at the end of stdin.
+
+static char*
+in_line (void)
+{
+  size_t n = 0, size = 64;
+  char *line = xmalloc (size);
+  int c;
+
+  while ((c = in_getc ()) != EOF && c != '\n')
+    {
+      if (n + 1 == size)
+        {
+          line = realloc (line, size *= 2);
+          if (!line)
+            fatal ("out of memory");
+        }
+      line[n++] = c;
+    }
+
+  if (c == EOF && n == 0)
+    {
+      free (line);
+      return NULL;
+    }
+  line[n] = '\0';
+  return line;
+}
+
+static double
+seconds_since (const struct timeval *t0)
+{
+  struct timeval t;
+  gettimeofday (&t, NULL);
+  return (t.tv_sec - t0->tv_sec) + 1e-6 * (t.tv_usec - t0->tv_usec);
+}
+
+// Copy the output of a job to stdout.  Return its last char, or '\n'
+// when there is no output.
+
+static int
+copy_output (FILE *out)
+{
+  char buf[4096];
+  int last = '\n';
+  rewind (out);
+  for (size_t n; (n = fread (buf, 1, sizeof (buf), out)) > 0; )
+    {
+      fwrite (buf, 1, n, stdout);
+      last = buf[n - 1];
+    }
+  return last;
+}
+
+// Write the result of job K to stdout and forget about the job.
+
+static void
+finish_job (int k)
+{
+  job_t *j = & job[k];
+  int code, wstatus;
+  unsigned long long cycles = 0, insns = 0;
+  char text[sizeof (j->status)] = "-";
+
+  while (waitpid (j->pid, &wstatus, 0) < 0)
+    ;
+
+  j->status[j->n_status] = '\0';
+  if (sscanf (j->status, "%d %llu %llu %127[^\n]", &code, &cycles, &insns,
+              text) != 4)
+    code = WIFEXITED (wstatus)
+      ? WEXITSTATUS (wstatus)
+      : 128 + WTERMSIG (wstatus);
+
+  fflush (j->out);
+  long size = ftell (j->out);
+
+  printf ("done %s %d %llu %llu %ld %s\n", j->id, code, cycles, insns,
+          size, text);
+  copy_output (j->out);
+  fflush (stdout);
+
+  fclose (j->out);
+  close (j->status_fd);
+  free (j->id);
+  *j = job[--n_jobs];
+}
+
+// Run the job with the N_ARGS ARGS and stdin IN in a fork.
+
+static void
+start_job (char *id, char **args, int n_args, FILE *in)
+{
+  int status_pipe[2];
+  FILE *out = tmpfile ();
+  if (!out || pipe (status_pipe) < 0)
+    fatal ("cannot set up job %s", id);
+
+  fflush (stdout);
+  fflush (stderr);
+
+  pid_t pid = fork ();
+  if (pid < 0)
+    fatal ("cannot fork job %s", id);
+
+  if (pid == 0)
+    {
+      if (dup2 (fileno (in), STDIN_FILENO) < 0
+          || dup2 (fileno (out), STDOUT_FILENO) < 0
+          || dup2 (fileno (out), STDERR_FILENO) < 0
+          || dup2 (status_pipe[1], 3) < 0)
+        _exit (EXIT_FAILURE);
+      close (status_pipe[0]);
+      if (status_pipe[1] != 3)
+        close (status_pipe[1]);
+
+      int argc = 0;
+      char **argv = xmalloc ((n_defaults + n_args + 3) * sizeof (char*));
+      argv[argc++] = (char*) self;
+      for (int i = 0; i < n_defaults; i++)
+        argv[argc++] = defaults[i];
+      argv[argc++] = "-status=/dev/fd/3";
+      for (int i = 0; i < n_args; i++)
+        argv[argc++] = args[i];
+      argv[argc] = NULL;
+
+      exit (run_core (argc, argv));
+    }
+
+  close (status_pipe[1]);
+
+  job_t *j = & job[n_jobs++];
+  j->pid = pid;
+  j->id = id;
+  j->out = out;
+  j->status_fd = status_pipe[0];
+  j->n_status = 0;
+}
+
+// Read the next job from stdin and start it.  Return false at the end.
+
+static bool
+read_job (void)
+{
+  char *line = in_line ();
+  if (!line)
+    return false;
+
+  char id[64];
+  int n_args;
+  long n_stdin;
+  if (sscanf (line, "job %63s %d %ld", id, &n_args, &n_stdin) != 3
+      || n_args < 0
+      || n_stdin < 0)
+    fatal ("bad job '%s'", line);
+  free (line);
+
+  char **args = xmalloc (n_args * sizeof (char*));
+  for (int i = 0; i < n_args; i++)
+    if (!(args[i] = in_line ()))
+      fatal ("job %s: missing argument", id);
+
+  FILE *in = tmpfile ();
+  if (!in)
+    fatal ("cannot set up job %s", id);
+  for (long i = 0; i < n_stdin; i++)
+    {
+      int c = in_getc ();
+      if (c == EOF)
+        fatal ("job %s: stdin is truncated", id);
+      putc (c, in);
+    }
+  fflush (in);
+  rewind (in);
+
+  start_job (strcpy (xmalloc (1 + strlen (id)), id), args, n_args, in);
+
+  fclose (in);
+  for (int i = 0; i < n_args; i++)
+    free (args[i]);
+  free (args);
+  return true;
+}
+
+// -batch:  Read MANIFEST and make a job of each line that is neither
+// empty nor a # comment.
+
+static void
+read_manifest (const char *name)
+{
+  FILE *f = fopen (name, "r");
+  if (!f)
+    fatal ("cannot read %s", name);
+
+  size_t size = 16, len = 0;
+  char *text = xmalloc (size);
+  for (int c; (c = getc (f)) != EOF; )
+    {
+      if (len + 1 == size)
+        {
+          text = realloc (text, size *= 2);
+          if (!text)
+            fatal ("out of memory");
+        }
+      text[len++] = c;
+    }
+  text[len] = '\0';
+  fclose (f);
+
+  manifest = text;
+  batch = xmalloc ((len + 1) * sizeof (batch_job_t));
+
+  int line_no = 0;
+  for (char *line = text; line; )
+    {
+      char *next = strchr (line, '\n');
+      if (next)
+        *next++ = '\0';
+      line_no++;
+
+      char **args = xmalloc ((strlen (line) / 2 + 1) * sizeof (char*));
+      int n_args = 0;
+      for (char *a = strtok (line, " \t\r"); a && *a != '#';
+           a = strtok (NULL, " \t\r"))
+        args[n_args++] = a;
+
+      if (n_args)
+        batch[n_batch++] = (batch_job_t) { line_no, args, n_args };
+      else
+        free (args);
+      line = next;
+    }
+}
+
+// -batch:  Run job B with no stdin in the calling thread.  Then print
+// its output and its record in one piece, and add it to the totals.
+
+static void
+run_batch_job (const batch_job_t *b)
+{
+  FILE *in = fopen ("/dev/null", "r");
+  FILE *out = tmpfile ();
+  if (!in || !out)
+    fatal ("cannot set up job %d", b->line);
+
+  int argc = 0;
+  char **argv = xmalloc ((n_defaults + b->n_args + 2) * sizeof (char*));
+  argv[argc++] = (char*) self;
+  for (int i = 0; i < n_defaults; i++)
+    argv[argc++] = defaults[i];
+  for (int i = 0; i < b->n_args; i++)
+    argv[argc++] = b->args[i];
+  argv[argc] = NULL;
+
+  struct timeval t_start;
+  gettimeofday (&t_start, NULL);
+
+  job_result_t result;
+  int code = run_job (argc, argv, in, out, out, &result);
+  double seconds = seconds_since (&t_start);
+  const char *text = result.status ? result.status : "-";
+
+  fflush (out);
+  free (argv);
+  fclose (in);
+
+  pthread_mutex_lock (&batch_lock);
+
+  // The record of the job starts a line of its own.
+  if (copy_output (out) != '\n')
+    putchar ('\n');
+  printf ("job %d: %s, code %d, %llu cycles, %llu instr., %.3f sec\n",
+          b->line, text, code, result.cycles, result.insns, seconds);
+  fflush (stdout);
+
+  total.n_jobs++;
+  total.cycles += result.cycles;
+  total.insns += result.insns;
+  if (strcmp (text, "EXIT") == 0)
+    total.n_pass++;
+  else if (strcmp (text, "TIMEOUT") == 0)
+    total.n_timeout++;
+  else
+    total.n_fail++;
+
+  pthread_mutex_unlock (&batch_lock);
+
+  fclose (out);
+}
+
+// -batch:  A thread of the pool.  Run the next job until there is none.
+
+static void*
+batch_thread (void *arg)
+{
+  (void) arg;
+
+  for (;;)
+    {
+      pthread_mutex_lock (&batch_lock);
+      int k = next_batch < n_batch ? next_batch++ : -1;
+      pthread_mutex_unlock (&batch_lock);
+
+      if (k < 0)
+        return NULL;
+      run_batch_job (& batch[k]);
+    }
+}
+
+// -batch:  Run all jobs in a pool of up to max_jobs threads and print
+// the totals.
+
+static int
+batch_main (void)
+{
+  int n_threads = max_jobs < n_batch ? max_jobs : n_batch;
+  pthread_t *thread = xmalloc (n_threads * sizeof (pthread_t));
+
+  struct timeval t_start;
+  gettimeofday (&t_start, NULL);
+
+  for (int i = 0; i < n_threads; i++)
+    if (pthread_create (& thread[i], NULL, batch_thread, NULL))
+      fatal ("cannot start thread %d of %d", i + 1, n_threads);
+
+  for (int i = 0; i < n_threads; i++)
+    pthread_join (thread[i], NULL);
+
+  double seconds = seconds_since (&t_start);
+  printf ("\nbatch: %u jobs: %u pass, %u fail, %u timeout\n"
+          "batch: %llu cycles, %llu instr. in %.3f sec = %.0f "
+          "instructions/sec\n", total.n_jobs, total.n_pass, total.n_fail,
+          total.n_timeout, total.cycles, total.insns, seconds,
+          seconds > 0 ? total.insns / seconds : 0.0);
+
+  return total.n_pass == total.n_jobs ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+
+int
+server_main (int argc, char *argv[], int (*run) (int, char*[]),
+             job_main_t *job_main)
+{
+  self = argv[0];
+  run_core = run;
+  run_job = job_main;
+  defaults = xmalloc (argc * sizeof (char*));
+
+  for (int i = 1; i < argc; i++)
+    if (strcmp (argv[i], "-server") == 0)
+      continue;
+    else if (strcmp (argv[i], "-batch") == 0)
+      {
+        if (++i == argc)
+          fatal ("-batch needs a MANIFEST");
+        read_manifest (argv[i]);
+      }
+    else if (strcmp (argv[i], "-j") == 0)
+      {
+        char *end;
+        if (++i == argc
+            || (max_jobs = (int) strtol (argv[i], &end, 10)) <= 0
+            || *end)
+          fatal ("-j N needs a number N > 0");
+      }
+    else
+      defaults[n_defaults++] = argv[i];
+
+  if (max_jobs == 0)
+    {
+      long n_cpus = manifest ? sysconf (_SC_NPROCESSORS_ONLN) : 1;
+      max_jobs = n_cpus > 1 ? (int) n_cpus : 1;
+    }
+
+  if (manifest)
+    return batch_main ();
+
+  job = xmalloc (max_jobs * sizeof (job_t));
+  struct pollfd *fds = xmalloc ((1 + max_jobs) * sizeof (struct pollfd));
+
+  bool more = true;
+
+  while (more || n_jobs)
+    {
+      bool take = more && n_jobs < max_jobs;
+
+      // There is no need to wait for stdin when read() got more already.
+      if (take && in_pos < in_len)
+        {
+          more = read_job ();
+          continue;
+        }
+
+      int n_fds = 0;
+      for (int k = 0; k < n_jobs; k++)
+        fds[n_fds++] = (struct pollfd) { job[k].status_fd, POLLIN, 0 };
+      if (take)
+        fds[n_fds++] = (struct pollfd) { STDIN_FILENO, POLLIN, 0 };
+
+      if (poll (fds, n_fds, -1) < 0)
+        continue;
+
+      // A job is done when its end of the -status= pipe is closed.
+      for (int k = n_jobs - 1; k >= 0; k--)
+        if (fds[k].revents)
+          {
+            job_t *j = & job[k];
+            size_t room = sizeof (j->status) - 1 - j->n_status;
+            char dummy[64];
+            ssize_t n = room
+              ? read (j->status_fd, j->status + j->n_status, room)
+              : read (j->status_fd, dummy, sizeof (dummy));
+            if (n > 0 && room)
+              j->n_status += n;
+            else if (n <= 0)
+              finish_job (k);
+          }
+
+      if (take && fds[n_fds - 1].revents)
+        more = read_job ();
+    }
+
+  return EXIT_SUCCESS;
+}
+
+#endif // _WIN32
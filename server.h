@@ -0,0 +1,45 @@
+/*
+  This file is part of avrtest -- A simple simulator for the
+  Atmel AVR family of microcontrollers designed to test the compiler.
+
+  Copyright (C) 2001, 2002, 2003   Theodore A. Roth, Klaus Rudolph
+  Copyright (C) 2007 Paulo Marques
+  Copyright (C) 2008-2026 Free Software Foundation, Inc.
+
+  avrtest is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 2 of the License, or
+  (at your option) any later version.
+
+  avrtest is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with avrtest; see the file COPYING.  If not, write to
+  the Free Software Foundation, 59 Temple Place - Suite 330,
+  Boston, MA 02111-1307, USA.  */
+
+#ifndef SERVER_H
+#define SERVER_H
+
+#include <stdio.h>
+
+// -batch:  How a job left, as reported by leave(), cf. job_main() in
+// avrtest.c.  STATUS is the exit status like EXIT, or NULL if the job
+// ended without one, e.g. after -help.
+typedef struct job_result
+{
+  int code;
+  unsigned long long cycles, insns;
+  const char *status;
+} job_result_t;
+
+// The entry point of a core for -batch:  Run the command line ARGC, ARGV
+// with the streams IN, OUT and ERR in the calling thread.
+typedef int job_main_t (int, char*[], FILE*, FILE*, FILE*, job_result_t*);
+
+extern int server_main (int, char*[], int (*) (int, char*[]), job_main_t*);
+
+#endif // SERVER_H
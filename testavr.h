@@ -27,33 +27,48 @@
 #include <stdint.h>
 #include <stdlib.h>
 #include <stdbool.h>
+#include <stdio.h>
+#include <setjmp.h>
+#include <sys/time.h>
+
+#include "options.h"
 
 // ---------------------------------------------------------------------------
 //     configuration values (in bytes).
 
 #define MAX_RAM_SIZE     (64 * 1024)
 #define MAX_FLASH_SIZE  (256 * 1024)  // Must be at least 128KB
-#define MAX_EEPROM_SIZE  (16 * 1024)  // .eeprom is read from ELF but unused
+#define MAX_EEPROM_SIZE  (16 * 1024)
 
 #define REGX    26
 #define REGY    28
 #define REGZ    30
 
-// PC is used as array index into decoded_flash[].
-// If PC has bits outside the following mask, something went really wrong,
-// e.g. in pop_PC.
-
-#define PC_VALID_MASK (MAX_FLASH_SIZE/2 - 1)
-
 typedef uint8_t byte;
 typedef uint16_t word;
 typedef uint32_t dword;
+typedef uint64_t qword;
 
 typedef struct
 {
+  // Address of the code in execute() that simulates this instruction.
+  // Set by execute() prior to running the program.
+  const void *handler;
+  // Index into opcodes[]
   byte id;
+  // Size in words as of opcodes[id].  Cached here so that the main
+  // loop does not have to consult opcodes[].
+  byte size;
   byte op1;
+  // Basic block costs as of decode_flash():  The number of instructions
+  // from this one up to the end of its basic block, and the sum of their
+  // static cycles.  Long blocks are split into chunks of at most
+  // MAX_BLOCK_INSNS instructions.  0 if this instruction starts such a
+  // chunk;  execute() then gets the costs from the following instructions.
+  // Keep this struct at 16 bytes.
+  byte block_insns;
   word op2;
+  word block_cycles;
 } decoded_t;
 
 typedef struct
@@ -74,13 +89,20 @@ typedef struct
 
   // Maximum number of instructions to be executed,
   // used as a timeout.  Can be set my -m CYCLES
-  dword max_insns;
+  qword max_insns;
 
   // Number of instructions simulated so far.
-  dword n_insns;
+  qword n_insns;
 
   // Cycles consumed by the program so far.
-  dword n_cycles;
+  qword n_cycles;
+
+  // The value of n_cycles at which the events and interrupts from irq.c
+  // have to be looked at, or -1 if there are none.
+  qword event_cycles;
+
+  // Cycles that SLEEP skipped while waiting for an interrupt.
+  qword n_sleep_cycles;
 
   //
   int leave_status, exit_value;
@@ -92,17 +114,275 @@ typedef struct
   const char *short_name;
 } program_t;
 
-extern program_t program;
+struct context;
+
+// An event from irq.c, due when program.n_cycles reaches CYCLES.
+typedef struct
+{
+  qword cycles;
+  void (*fire) (struct context*, int);
+  int arg;
+} event_t;
+
+#define MAX_EVENTS 32
+#define MAX_IRQS   128
+
+// The state of a timer/counter from timer.c.  Its count was CNT0 at
+// cycle T0, and it advances by one every PRESCALE cycles.
+typedef struct
+{
+  // 0 if the timer is stopped.
+  unsigned prescale;
+  qword t0;
+  unsigned cnt0;
+  // Whether a dual-slope PWM mode counts down.
+  bool down;
+  // Whether an event from timer.c is scheduled.
+  bool scheduled;
+  // The TEMP register for the 16-bit accesses.
+  byte temp;
+} avr_timer_t;
+
+#define MAX_TIMERS 6
+
+// The state of a USART from usart.c.
+typedef struct
+{
+  // When the frame that is being received is complete, or 0 if the
+  // receiver is off or has nothing more to receive.
+  qword rx_next;
+  // The receive buffer.
+  byte rx_fifo[2];
+  int n_rx;
+  // Whether the transmit shift register and the transmit buffer are
+  // occupied, and when the shift register is done with its frame.
+  bool tx_shift, tx_full;
+  qword tx_done;
+  // Whether an event from usart.c is scheduled.
+  bool scheduled;
+} avr_usart_t;
+
+#define MAX_USARTS 1
+
+// The largest EEPROM page of XMEGA devices, in bytes.
+#define MAX_EEPROM_PAGE 32
+
+// The state of the EEPROM controller from eeprom.c.
+typedef struct
+{
+  // Until when a write is in progress, and until when EEMPE is set.
+  qword busy_until, mpe_until;
+  // XMEGA:  The page buffer, and a bitmap of its loaded bytes.
+  byte page[MAX_EEPROM_PAGE];
+  dword loaded;
+  // Whether an event from eeprom.c is scheduled.
+  bool scheduled;
+} avr_nvm_t;
+
+// The largest flash page that SPM writes at once, in bytes.
+#define MAX_SPM_PAGE 512
+
+// avrxmega7:  The pages of external memory, cf. far_read().
+#define FAR_PAGE_SHIFT 12
+#define FAR_PAGE_SIZE (1 << FAR_PAGE_SHIFT)
+#define FAR_ADDR_MASK 0xffffff
+#define N_FAR_PAGES ((FAR_ADDR_MASK + 1) >> FAR_PAGE_SHIFT)
+
+// The I/O addresses that may belong to a peripheral, cf. periph.h.
+#define PERIPH_END_MAX 0x1000
+
+// The data space as seen by the accessors of avrtest.c, cf. data_page[]
+// there:  Pages of DATA_PAGE_SIZE bytes that span 17 bits.
+#define DATA_PAGE_SHIFT 5
+#define DATA_PAGE_SIZE (1 << DATA_PAGE_SHIFT)
+#define DATA_ADDR_MASK 0x1ffff
+#define N_DATA_PAGES ((DATA_ADDR_MASK + 1) >> DATA_PAGE_SHIFT)
+
+// avrtest_log:  What logging.c needs to do for the program at hand, as
+// found by log_init().
+typedef struct
+{
+  bool perf;
+  bool logging;
+  bool graph, graph_cost;
+  bool call_depth;
+} need_t;
+
+typedef struct
+{
+  // The ELF string table associated to the ELF symbol table
+  const char *data;
+  size_t size;
+  int n_entries;
+
+  // Number of ...
+  int n_strings;    // ... usable items and indices (inclusive) in strings[]
+  int n_funcs;      // ... that have STT_FUNC as symbol table type
+  int n_bad;        // ... that are of no use for us, e.g. orphans
+  int n_vec;        // ... unused vectors slots
+  bool *have;
+} string_table_t;
+
+// The state of one simulation.  execute() and the instruction handlers
+// get it by pointer, and so do all the other modules:  The options and
+// the device from the command line, the machine state including the
+// peripherals and their host files, the tables of -jit, -hle and
+// -fuse-stats, the logging, and the memory and files that belong to the
+// run all live here.  Hence more than one program can be simulated at
+// the same time, each in a context of its own, cf. run_context().
+// The layout does not depend on ISA_XMEGA, ISA_TINY or AVRTEST_LOG so
+// that all modules can use it.
+typedef struct context
+{
+  // Word address of current PC and offset into decoded[].
+  unsigned pc;
+
+  program_t program;
+
+  // Where execute() is with respect to basic blocks, and the flags of
+  // SREG that are evaluated lazily, cf. avrtest.c.  Only used by the
+  // loop without logging.
+  int in_block;
+  byte lazy_flags, lazy_copy;
+  const byte *lazy_value;
+
+  // Whether that loop has bound decoded[] to its handlers, and the
+  // entries it has to bind again since SPM changed them.
+  bool bound;
+  unsigned rebind_lo, rebind_hi;
+
+  // leave() returns to here, and sets exit_code to the value avrtest
+  // exits with, cf. run_context().
+  jmp_buf *on_leave;
+  int exit_code;
+
+  // The command line as parsed by parse_args():  The options, the
+  // arguments from -args, and the arch and device from -mmcu=.
+  options_t options;
+  args_t args;
+  arch_t arch;
+  device_t device;
+
+  // Where the output of the program and of avrtest goes, and where
+  // avrtest_getchar reads from.  ERR gets the errors from leave().
+  FILE *in, *out, *err;
+
+  // -runtime:  When the run started, and when loading, decoding and
+  // executing the program started.
+  struct timeval t_start, t_load, t_decode, t_execute;
+
+  // The memory from get_mem() and the files from get_file() that have
+  // not been handed back yet, cf. free_context().
+  struct held *held;
+
+  // The memory of the device, allocated by map_device() to fit it.
+  // PC is used as array index into decoded[] which has PC_MASK + 1
+  // entries, a power of 2.  Relative jumps wrap around like on the
+  // device, and other PCs outside are reported as out of bounds.  flash[]
+  // has twice the size of decoded[].  data[] ends at RAM_END, and the
+  // stack must not grow below RAM_START.
+  unsigned pc_mask;
+  unsigned ram_start, ram_end;
+
+  // Only used with ISA_XMEGA and ISA_TINY.  Otherwise, the registers
+  // live in data[] like the I/O registers and SRAM.
+  byte reg[0x20];
+  byte *data;
+  byte *eeprom;
+  byte *flash;
+  decoded_t *decoded;
+  // avrxmega7:  The pages of external memory in the 24-bit data space,
+  // allocated when they are written first, cf. far_read().
+  byte **far;
+
+  // What each page of the data space holds, cf. map_pages().  The
+  // PLAIN_SIZE bytes from PLAIN_START on are RAM pages in a row.
+  byte data_page[N_DATA_PAGES];
+  unsigned plain_start, plain_size;
+
+  // The SYSCALLs that occur in the program, cf. decode_opcode().
+  bool have_syscall[32];
+
+  // The ELF string table of the program, or NULL, cf. load-flash.c.
+  const char *strtab;
+  size_t strtab_size;
+
+  // The events as a binary min-heap ordered by cycles, and the pending
+  // interrupts as a bitmap indexed by vector number, cf. irq.c.
+  event_t event[MAX_EVENTS];
+  int n_events;
+  dword irq_pending[MAX_IRQS / 32];
+  // program.n_cycles right after the last RETI.  Like the hardware, the
+  // core runs at least one more instruction before it serves the next
+  // interrupt, cf. do_irq().
+  qword reti_cycles;
+
+  // When the next checkpoint is due, or -1, cf. checkpoint.c.
+  qword checkpoint_cycles;
+
+  // -fork-server:  Whether execute() calls do_events() after each basic
+  // block until the program reaches the snapshot, cf. fork-server.c.
+  bool poll;
+
+  // SPM:  The size of a flash page in bytes, the address of SPMCSR as
+  // set by map_device(), and the temporary page buffer.
+  unsigned spm_page;
+  int spm_csr;
+  byte spm_buffer[MAX_SPM_PAGE];
+
+  // The I/O registers that belong to peripherals, cf. periph.h.
+  unsigned periph_end;
+  byte periph_hook[PERIPH_END_MAX];
+
+  // The peripherals from -mmcu=DEVICE, cf. periph.c:  The descriptions
+  // of the ones the device has, their state, and the host side of the
+  // USARTs and of -eeprom=FILE.
+  const struct timer_desc *timer_desc;
+  int n_timers;
+  avr_timer_t timer[MAX_TIMERS];
+  const struct usart_desc *usart_desc;
+  int n_usarts;
+  avr_usart_t usart[MAX_USARTS];
+  struct usart_host *usart_host;
+  const struct eeprom_desc *eeprom_desc;
+  int eeprom_fd;
+  // Whether eeprom[] is the -eeprom=FILE, cf. eeprom_open().
+  bool eeprom_mapped;
+  avr_nvm_t nvm;
+
+  // -jit, -hle and -fuse-stats:  Their tables, allocated when needed.
+  struct jit *jit;
+  struct hle_routine *hle_routines;
+  struct hle_check *hle_check;
+  qword *fuse_runs;
+
+  // -record= and -replay=, -checkpoint-at= and friends, -fork-server:
+  // Their state, allocated when needed.
+  struct replay *replay;
+  struct checkpoint *checkpoint;
+  struct fork_server *fork_server;
+
+  // -batch:  Where finish() puts how the job left, or NULL if this run
+  // is not a job of -batch, cf. job_main().
+  struct job_result *job;
+
+  // avrtest_log:  What logging.c shares with graph.c and perf.c, and
+  // their own state, cf. log_open().
+  unsigned old_PC, old_old_PC;
+  bool log_unused;
+  need_t need;
+  string_table_t string_table;
+  struct alog *alog;
+  struct graph *graph;
+  struct perf *perf;
+} context_t;
 
-extern unsigned cpu_PC;
 extern const int io_base;
 extern const bool is_xmega;
 extern const bool is_tiny;
 extern const bool is_avrtest_log;
 extern const unsigned invalid_opcode;
 
-extern bool have_syscall[32];
-
 #define INLINE inline __attribute__((always_inline))
 #define NOINLINE __attribute__((noinline))
 #define NORETURN __attribute__((noreturn))
@@ -119,6 +399,7 @@ enum
     LEAVE_ABORTED,
     LEAVE_TIMEOUT,
     LEAVE_FILE,
+    LEAVE_DEADLOCK,
     // Something went badly wrong
     LEAVE_USAGE,
     LEAVE_MEMORY,
@@ -141,32 +422,43 @@ enum
     IL_TODO
   };
 
-extern void NOINLINE NORETURN leave (int status, const char *reason, ...);
-extern void qprintf (const char *fmt, ...);
-extern byte* log_cpu_address (int, int);
-extern void* get_mem (unsigned, size_t, const char*);
+extern void NOINLINE NORETURN leave (context_t*, int status,
+                                     const char *reason, ...);
+extern void NORETURN quit (context_t*, int);
+extern void qprintf (const context_t*, const char *fmt, ...);
+extern byte* log_cpu_address (context_t*, int, int);
+extern void* get_mem (context_t*, unsigned, size_t, const char*);
+extern void put_mem (context_t*, void*);
+extern FILE* get_file (context_t*, const char*, const char*);
+extern int put_file (context_t*, FILE*);
 
 extern const int addr_SREG;
-extern byte* const pSP;
+extern const int addr_SPL;
+
+// When an address of named_sfr[] is special:  Always, or only if the
+// arch has RAMPD resp. EIND.
+enum
+  {
+    SFR_ALWAYS,
+    SFR_RAMPD,
+    SFR_EIND
+  };
 
 typedef struct
 {
   int addr;
   const char *name;
-  // Points to a bool telling whether this address is special.
-  // NULL means "yes".
-  bool *pon;
+  int when;
 } sfr_t;
 
 extern const sfr_t named_sfr[];
 
-#define OP_FUNC_TYPE void FASTCALL
-
-typedef OP_FUNC_TYPE (*opcode_func)(int,int);
+// The func_<ID> handlers are only called from execute() which might
+// call them more than once, cf. avr-fuse.def.
+#define OP_FUNC_TYPE INLINE void FASTCALL
 
 typedef struct
 {
-  opcode_func func;
   const char *mnemonic;
   short size;
   short cycles;
@@ -177,69 +469,57 @@ typedef struct
 
 // empty placeholders to keep the rest of the code clean
 
+#define log_open(...)          (void) 0
 #define log_init(...)          (void) 0
 #define log_append(...)        (void) 0
 #define log_add_instr(...)     (void) 0
 #define log_add_data_mov(...)  (void) 0
 #define log_add_flag_read(...) (void) 0
 #define log_dump_line(...)     (void) 0
+#define log_add_irq(...)       (void) 0
+#define log_dump_irq(...)      (void) 0
 #define do_syscall(...)        (void) 0
 #define log_set_func_symbol(...)      (void) 0
 #define log_set_string_table(...)     (void) 0
 #define log_finish_string_table(...)  (void) 0
+#define log_checkpoint(...)    (void) 0
 
 #else
 
-extern unsigned old_PC, old_old_PC;
-extern bool log_unused;
-extern void log_init (unsigned);
-extern void log_append (const char *fmt, ...);
-extern void log_add_instr (const decoded_t *op);
-extern void log_add_data_mov (const char *format, int addr, int value);
-extern void log_add_flag_read (int mask, int value);
-extern void log_add_reg_mov (const char *format, int regno, int value);
-extern void log_dump_line (const decoded_t*);
-extern void do_syscall (int x, int val);
-extern void log_set_func_symbol (int, size_t, bool);
-extern void log_set_string_table (char*, size_t, int);
-extern void log_finish_string_table (void);
-
-typedef struct
-{
-  bool perf;
-  bool logging;
-  bool graph, graph_cost;
-  bool call_depth;
-} need_t;
-
-typedef struct
-{
-  // The ELF string table associated to the ELF symbol table
-  const char *data;
-  size_t size;
-  int n_entries;
-
-  // Number of ...
-  int n_strings;    // ... usable items and indices (inclusive) in strings[]
-  int n_funcs;      // ... that have STT_FUNC as symbol table type
-  int n_bad;        // ... that are of no use for us, e.g. orphans
-  int n_vec;        // ... unused vectors slots
-  bool *have;
-} string_table_t;
-
-// Some data shared by logging modules logging.c, perf.c, graph.c.
-// Objects hosted by logging.c.
-extern need_t need;
-extern string_table_t string_table;
+extern void log_open (context_t*);
+extern void log_init (context_t*, unsigned);
+extern void log_append (context_t*, const char *fmt, ...);
+extern void log_add_instr (context_t*, const decoded_t *op);
+extern void log_add_data_mov (context_t*, const char *format, int addr,
+                              int value);
+extern void log_add_flag_read (context_t*, int mask, int value);
+extern void log_dump_line (context_t*, const decoded_t*);
+extern void log_add_irq (context_t*, int);
+extern void log_dump_irq (context_t*);
+extern void do_syscall (context_t*, int x, int val);
+extern void log_set_func_symbol (context_t*, int, size_t, bool);
+extern void log_set_string_table (context_t*, char*, size_t, int);
+extern void log_finish_string_table (context_t*);
+extern void log_checkpoint (context_t*, bool);
 
 #endif  // AVRTEST_LOG
 
-extern void load_to_flash (const char*, byte[], byte[], byte[]);
-extern void decode_flash (decoded_t[], const byte[]);
-extern void set_elf_string_table (char*, size_t, int);
-extern void finish_elf_string_table (void);
-extern void set_elf_function_symbol (int, size_t, bool);
-extern void put_argv (int, byte*);
+// avrtest_log runs the loop without logging from the object compiled with
+// AVRTEST_LEAN while log_is_idle().  graph_lean_call_depth() keeps track
+// of calls and returns meanwhile, and perf_lean_resume() catches up
+// afterwards.
+extern void execute_lean (context_t*, bool);
+extern bool log_is_idle (const context_t*);
+extern void graph_lean_call_depth (context_t*, const decoded_t*);
+extern void perf_lean_resume (context_t*);
+
+extern void load_to_flash (context_t*);
+extern void decode_flash (context_t*);
+extern unsigned redecode_flash (context_t*, unsigned, unsigned);
+extern void set_elf_string_table (context_t*, char*, size_t, int);
+extern void finish_elf_string_table (context_t*);
+extern void set_elf_function_symbol (context_t*, int, size_t, bool);
+extern void put_argv (context_t*, int);
 
 #include <string.h>
 
@@ -276,6 +556,50 @@ enum
     ID_ ## ID,
 #include "avr-opcode.def"
 #undef AVR_OPCODE
+    // The number of entries of opcodes[].
+    N_OPCODES
   };
 
+// Index into flag_update_table_add8[] and flag_update_table_sub8[] for
+// V1 + V2 resp. V1 - V2 with result RES.
+
+static INLINE unsigned
+FUT_ADD_SUB_INDEX (unsigned v1, unsigned v2, unsigned res)
+{
+  /*   ((v1 & 0x08) << 9)
+     | ((v2 & 0x08) << 8)
+     | ((v1 & 0x80) << 3)
+     | ((v2 & 0x80) << 2)
+     | (res & 0x1FF) */
+  unsigned v = 2 * (v1 & 0x88) + (v2 & 0x88);
+  v *= 0x104;
+  return (res & 0x1ff) | (v & 0x1e00);
+}
+
+#define MAX_BLOCK_INSNS 0xff
+
+// Whether an instruction terminates a basic block:  It might change the
+// program flow, add cycles depending on the program's state, or interact
+// with the simulator like SYSCALLs which might read the cycle counter.
+
+static INLINE bool
+opcode_ends_block (int id)
+{
+  switch (id)
+    {
+    case ID_BAD_PC: case ID_ILLEGAL: case ID_UNDEF: case ID_SYSCALL:
+    case ID_BRBC:   case ID_BRBS:
+    case ID_CPSE:   case ID_CPSE2:
+    case ID_SBIC:   case ID_SBIC2:   case ID_SBIS:   case ID_SBIS2:
+    case ID_SBRC:   case ID_SBRC2:   case ID_SBRS:   case ID_SBRS2:
+    case ID_JMP:    case ID_RJMP:    case ID_IJMP:   case ID_EIJMP:
+    case ID_CALL:   case ID_RCALL:   case ID_ICALL:  case ID_EICALL:
+    case ID_RET:    case ID_RETI:
+    case ID_SLEEP:  case ID_BREAK:   case ID_SPM:    case ID_ESPM:
+      return true;
+    default:
+      return false;
+    }
+}
+
 #endif // TESTAVR_H
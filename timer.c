@@ -0,0 +1,564 @@
+/*
+  This file is part of avrtest -- A simple simulator for the
+  Atmel AVR family of microcontrollers designed to test the compiler.
+
+  Copyright (C) 2001, 2002, 2003   Theodore A. Roth, Klaus Rudolph
+  Copyright (C) 2007 Paulo Marques
+  Copyright (C) 2008-2026 Free Software Foundation, Inc.
+
+  avrtest is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 2 of the License, or
+  (at your option) any later version.
+
+  avrtest is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with avrtest; see the file COPYING.  If not, write to
+  the Free Software Foundation, 59 Temple Place - Suite 330,
+  Boston, MA 02111-1307, USA.  */
+
+/* Timer/counter models.
+
+   megaAVR devices like ATmega328P have Timer0 and Timer2 with 8 bits
+   and Timer1 with 16 bits, XMEGA devices have 16-bit TCs like TCC0.
+   The timers are not ticked:  A timer knows its count CNT0 at cycle T0,
+   and the count at a later cycle follows from the prescaler and the
+   mode.  timer_sync() brings a timer up to date when one of its registers
+   is accessed, and sets the flags of the compare matches and overflows
+   that happened since.  Only for the next flag whose interrupt is enabled,
+   an event is scheduled so that the interrupt is raised in time.  Hence a
+   timer that is polled or stopped costs nothing while it is not accessed.
+
+   Not modelled:  Output compare pins, input capture, external clock
+   sources, the asynchronous mode of Timer2, double buffering of the
+   compare registers in PWM modes, prescaler resets, event actions and
+   the interrupt levels of XMEGA.  A TC interrupt is enabled if its level
+   is not OFF.  */
+
+#include <string.h>
+
+#include "testavr.h"
+#include "options.h"
+#include "irq.h"
+#include "periph.h"
+
+// The flags of a timer, independent of where its flag register keeps
+// them:  F_OVF for an overflow (TOVn or OVFIF), F_TOP for reaching a TOP
+// from ICR1 (ICF1), and F_OC + I for a match of compare channel I
+// (OCFnA ... OCFnC or CCAIF ... CCDIF).
+
+enum
+  {
+    F_OVF, F_TOP, F_OC, N_FLAGS = F_OC + 4
+  };
+
+enum
+  {
+    TK_MEGA8, TK_MEGA16, TK_XMEGA
+  };
+
+// Where the registers of a timer are.  For megaAVR, the data addresses
+// of TIFRn, TIMSKn, TCCRnA, TCNTn, OCRnA and ICRn.  TCCRnB follows
+// TCCRnA, and OCRnB follows OCRnA.  For an XMEGA TC, the addresses of
+// INTFLAGS, INTCTRLA, CTRLA, CNT, CCA and PER in that order;  INTCTRLB
+// and CTRLB follow INTCTRLA and CTRLA.
+
+typedef struct timer_desc
+{
+  int kind;
+  // The number of compare channels.
+  int n_oc;
+  // Cycles per count as of the clock select bits.
+  const unsigned *prescale;
+  int tifr, timsk, tccr, tcnt, ocr, icr;
+  // The vectors of compare channel A and of the overflow.  The capture
+  // vector of Timer1 precedes COMPA.
+  int vec_oc, vec_ovf;
+} timer_desc_t;
+
+static const unsigned prescale_t01[16] = { 0, 1, 8, 64, 256, 1024 };
+static const unsigned prescale_t2[16] = { 0, 1, 8, 32, 64, 128, 256, 1024 };
+static const unsigned prescale_tc[16] = { 0, 1, 2, 4, 8, 64, 256, 1024 };
+
+#define TIMER0(COMPA, OVF)                                              \
+  { TK_MEGA8, 2, prescale_t01, 0x35, 0x6e, 0x44, 0x46, 0x47, 0, COMPA, OVF }
+#define TIMER1(N_OC, COMPA, OVF)                                        \
+  { TK_MEGA16, N_OC, prescale_t01, 0x36, 0x6f, 0x80, 0x84, 0x88, 0x86,  \
+      COMPA, OVF }
+#define TIMER2(COMPA, OVF)                                              \
+  { TK_MEGA8, 2, prescale_t2, 0x37, 0x70, 0xb0, 0xb2, 0xb3, 0, COMPA, OVF }
+#define TC(BASE, N_OC, OVF)                                             \
+  { TK_XMEGA, N_OC, prescale_tc, BASE + 0xc, BASE + 0x6, BASE,          \
+      BASE + 0x20, BASE + 0x28, BASE + 0x26, OVF + 2, OVF }
+
+static const timer_desc_t timers_mx8[] =
+  {
+    TIMER0 (14, 16), TIMER1 (2, 11, 13), TIMER2 (7, 9), { .prescale = NULL }
+  };
+
+static const timer_desc_t timers_m1284[] =
+  {
+    TIMER0 (16, 18), TIMER1 (2, 13, 15), TIMER2 (9, 11), { .prescale = NULL }
+  };
+
+static const timer_desc_t timers_m2560[] =
+  {
+    TIMER0 (21, 23), TIMER1 (3, 17, 20), TIMER2 (13, 15), { .prescale = NULL }
+  };
+
+static const timer_desc_t timers_xmega[] =
+  {
+    TC (0x800, 4, 14), TC (0x840, 2, 20),
+    TC (0x900, 4, 77), TC (0x940, 2, 83),
+    TC (0xa00, 4, 47), TC (0xa40, 2, 53),
+    { .prescale = NULL }
+  };
+
+// How a timer counts in its current mode:  From 0 up to TOP and then
+// back to 0, or down again to 0 if DUAL.  A count above TOP runs up to
+// MAX first.  MATCH[] are the counts at which a flag is set, or -1.
+
+typedef struct
+{
+  unsigned top, max;
+  bool dual;
+  int match[N_FLAGS][2];
+} counter_t;
+
+static int
+flag_mask (const timer_desc_t *td, int f)
+{
+  if (td->kind == TK_XMEGA)
+    return f == F_OVF ? 0x01 : f >= F_OC ? 0x10 << (f - F_OC) : 0;
+
+  return f == F_OVF ? 0x01
+    : f >= F_OC ? 0x02 << (f - F_OC)
+    : td->kind == TK_MEGA16 ? 0x20 : 0;
+}
+
+static int
+flag_vector (const timer_desc_t *td, int f)
+{
+  return f == F_OVF ? td->vec_ovf
+    : f >= F_OC ? td->vec_oc + f - F_OC
+    : td->kind == TK_MEGA16 ? td->vec_oc - 1 : -1;
+}
+
+static bool
+irq_enabled (const context_t *cx, const timer_desc_t *td, int f)
+{
+  const byte *data = cx->data;
+
+  if (td->kind != TK_XMEGA)
+    return data[td->timsk] & flag_mask (td, f);
+
+  return f == F_OVF ? data[td->timsk] & 3
+    : f >= F_OC ? (data[td->timsk + 1] >> (2 * (f - F_OC))) & 3
+    : false;
+}
+
+static unsigned
+get_reg (const context_t *cx, const timer_desc_t *td, int addr)
+{
+  return td->kind == TK_MEGA8
+    ? cx->data[addr]
+    : cx->data[addr] | (cx->data[addr + 1] << 8);
+}
+
+// Get how timer TD counts as of its control registers.
+
+static void
+get_counter (const context_t *cx, const timer_desc_t *td, counter_t *c)
+{
+  // The TOP of Timer1 per WGM:  -1 for OCR1A, -2 for ICR1.
+  static const int top16[16] =
+    {
+      0xffff, 0xff, 0x1ff, 0x3ff, -1, 0xff, 0x1ff, 0x3ff,
+      -2, -1, -2, -1, -2, 0xffff, -2, -1
+    };
+
+  int a = cx->data[td->tccr];
+  int b = cx->data[td->tccr + 1];
+  unsigned ocra = get_reg (cx, td, td->ocr);
+  int wgm, ovf_match = 0;
+  bool ovf = true;
+
+  memset (c->match, -1, sizeof (c->match));
+
+  switch (td->kind)
+    {
+    case TK_MEGA8:
+      wgm = (a & 3) | ((b >> 1) & 4);
+      c->max = 0xff;
+      c->top = wgm == 2 || wgm == 5 || wgm == 7 ? ocra : 0xff;
+      c->dual = wgm == 1 || wgm == 5;
+      // CTC mode overflows at MAX, which it only reaches with OCRA =
+      // MAX.  The other modes overflow at TOP resp. BOTTOM.
+      ovf = wgm != 2 || c->top == c->max;
+      break;
+
+    case TK_MEGA16:
+      wgm = (a & 3) | ((b >> 1) & 0xc);
+      c->max = 0xffff;
+      c->top = top16[wgm] == -1 ? ocra
+        : top16[wgm] == -2 ? get_reg (cx, td, td->icr)
+        : (unsigned) top16[wgm];
+      c->dual = (wgm >= 1 && wgm <= 3) || (wgm >= 8 && wgm <= 11);
+      ovf = !(wgm == 0 || wgm == 4 || wgm == 12 || wgm == 13)
+        || c->top == c->max;
+      if (top16[wgm] == -2)
+        c->match[F_TOP][0] = c->top;
+      break;
+
+    case TK_XMEGA:
+      // WGMODE 1 is FRQ with TOP = CCA, 5 ... 7 are the dual-slope modes
+      // with an overflow at TOP, at TOP and BOTTOM, and at BOTTOM.
+      wgm = b & 7;
+      c->max = 0xffff;
+      c->top = wgm == 1 ? ocra : get_reg (cx, td, td->icr);
+      c->dual = wgm >= 5;
+      if (wgm == 5 || wgm == 6)
+        {
+          ovf_match = c->top;
+          c->match[F_OVF][1] = wgm == 6 ? 0 : -1;
+        }
+      break;
+    }
+
+  if (c->dual && c->top == 0)
+    c->dual = false;
+
+  if (ovf)
+    c->match[F_OVF][0] = ovf_match;
+
+  int w = td->kind == TK_MEGA8 ? 1 : 2;
+  for (int i = 0; i < td->n_oc; i++)
+    c->match[F_OC + i][0] = get_reg (cx, td, td->ocr + w * i);
+}
+
+
+// The count K ticks after CNT, and whether it counts *DOWN then.
+
+static unsigned
+count_after (const counter_t *c, unsigned cnt, bool *down, qword k)
+{
+  if (c->dual)
+    {
+      qword period = 2 * c->top;
+      qword p = ((*down ? period - cnt : cnt) + k) % period;
+      *down = p >= c->top;
+      return p <= c->top ? p : period - p;
+    }
+
+  if (cnt > c->top)
+    {
+      if (k <= c->max - cnt)
+        return cnt + k;
+      k -= c->max - cnt + 1;
+      cnt = 0;
+    }
+
+  return (cnt + k) % (c->top + 1);
+}
+
+
+// The number of ticks after which the count next becomes N, or -1.
+
+static qword
+ticks_to (const counter_t *c, unsigned cnt, bool down, int n)
+{
+  if (n < 0)
+    return (qword) -1;
+
+  unsigned u = n;
+
+  if (c->dual)
+    {
+      if (u > c->top)
+        return (qword) -1;
+      qword period = 2 * c->top;
+      qword p = (down ? period - cnt : cnt) % period;
+      qword k1 = (u + 2 * period - p - 1) % period + 1;
+      qword k2 = (period - u + 2 * period - p - 1) % period + 1;
+      return k1 < k2 ? k1 : k2;
+    }
+
+  if (cnt > c->top)
+    return u > cnt && u <= c->max ? u - cnt
+      : u <= c->top ? c->max - cnt + 1 + u
+      : (qword) -1;
+
+  if (u > c->top)
+    return (qword) -1;
+
+  return (u + c->top - cnt) % (c->top + 1) + 1;
+}
+
+
+// Advance timer I to cycle NOW and set the flags that came due.
+
+static void
+timer_sync (context_t *cx, int i, qword now)
+{
+  avr_timer_t *t = & cx->timer[i];
+  const timer_desc_t *td = & cx->timer_desc[i];
+
+  if (t->prescale == 0
+      || now < t->t0 + t->prescale)
+    return;
+
+  qword k = (now - t->t0) / t->prescale;
+  counter_t c;
+  get_counter (cx, td, &c);
+
+  int flags = 0;
+  for (int f = 0; f < F_OC + td->n_oc; f++)
+    for (int m = 0; m < 2; m++)
+      if (ticks_to (&c, t->cnt0, t->down, c.match[f][m]) <= k)
+        flags |= flag_mask (td, f);
+
+  t->cnt0 = count_after (&c, t->cnt0, &t->down, k);
+  t->t0 += k * t->prescale;
+
+  cx->data[td->tifr] |= flags;
+  cx->data[td->tcnt] = t->cnt0;
+  if (td->kind != TK_MEGA8)
+    cx->data[td->tcnt + 1] = t->cnt0 >> 8;
+}
+
+static void timer_update (context_t*, int);
+
+void
+timer_event (context_t *cx, int i)
+{
+  cx->timer[i].scheduled = false;
+  timer_sync (cx, i, cx->program.n_cycles);
+  timer_update (cx, i);
+}
+
+// Timer I has been synced to the current cycle, and its registers might
+// have changed:  Raise or clear its interrupts as of its flags, and
+// schedule an event for the next flag whose interrupt is enabled.
+
+static void
+timer_update (context_t *cx, int i)
+{
+  avr_timer_t *t = & cx->timer[i];
+  const timer_desc_t *td = & cx->timer_desc[i];
+  qword k = (qword) -1;
+  counter_t c;
+
+  get_counter (cx, td, &c);
+
+  if (t->scheduled)
+    {
+      event_cancel (cx, timer_event, i);
+      t->scheduled = false;
+    }
+
+  for (int f = 0; f < F_OC + td->n_oc; f++)
+    {
+      int vector = flag_vector (td, f);
+      if (vector < 0)
+        continue;
+
+      bool flag = cx->data[td->tifr] & flag_mask (td, f);
+      bool enabled = irq_enabled (cx, td, f);
+
+      if (flag && enabled)
+        irq_raise (cx, vector);
+      else
+        irq_clear (cx, vector);
+
+      if (enabled && !flag && t->prescale)
+        for (int m = 0; m < 2; m++)
+          {
+            qword km = ticks_to (&c, t->cnt0, t->down, c.match[f][m]);
+            k = km < k ? km : k;
+          }
+    }
+
+  if (k != (qword) -1)
+    {
+      event_schedule (cx, t->t0 + k * t->prescale, timer_event, i);
+      t->scheduled = true;
+    }
+}
+
+
+// The address of the low byte of the 16-bit register that contains
+// ADDR, or -1.
+
+static int
+reg16 (const timer_desc_t *td, int addr)
+{
+  if (td->kind == TK_MEGA8)
+    return -1;
+
+  addr &= ~1;
+
+  return addr == td->tcnt || addr == td->icr
+    || (addr >= td->ocr && addr < td->ocr + 2 * td->n_oc)
+    ? addr
+    : -1;
+}
+
+// Read register ADDR of timer I at cycle NOW.  Reading the low byte of
+// a 16-bit register latches its high byte in TEMP, except for the
+// compare registers of megaAVR.
+
+int
+timer_read (context_t *cx, int i, int addr, qword now)
+{
+  avr_timer_t *t = & cx->timer[i];
+  const timer_desc_t *td = & cx->timer_desc[i];
+  int lo = reg16 (td, addr);
+
+  timer_sync (cx, i, now);
+
+  if (lo >= 0
+      && (td->kind == TK_XMEGA || lo == td->tcnt || lo == td->icr))
+    {
+      if (addr == lo)
+        t->temp = cx->data[lo + 1];
+      else
+        return t->temp;
+    }
+
+  return cx->data[addr];
+}
+
+// Write VALUE to register ADDR of timer I at cycle NOW.  A 16-bit
+// register is written as a whole with the byte that is written last:
+// The low byte on megaAVR and the high byte on XMEGA.  Until then, the
+// first byte waits in TEMP.
+
+void
+timer_write (context_t *cx, int i, int addr, int value, qword now)
+{
+  avr_timer_t *t = & cx->timer[i];
+  const timer_desc_t *td = & cx->timer_desc[i];
+  int lo = reg16 (td, addr);
+  byte *data = cx->data;
+
+  timer_sync (cx, i, now);
+
+  if (lo >= 0)
+    {
+      bool xmega = td->kind == TK_XMEGA;
+      if (xmega == (addr == lo))
+        {
+          t->temp = value;
+          return;
+        }
+      data[lo] = xmega ? t->temp : value;
+      data[lo + 1] = xmega ? value : t->temp;
+    }
+  else if (addr == td->tifr)
+    data[addr] &= ~value;
+  else
+    data[addr] = value;
+
+  if (addr == td->tcnt || lo == td->tcnt)
+    {
+      t->cnt0 = get_reg (cx, td, td->tcnt);
+      t->t0 = now;
+    }
+
+  // The prescaler or the mode might have changed.
+  unsigned prescale = td->prescale[td->kind == TK_XMEGA
+                                   ? data[td->tccr] & 0xf
+                                   : data[td->tccr + 1] & 7];
+  if (prescale != t->prescale)
+    {
+      t->prescale = prescale;
+      t->t0 = now;
+    }
+
+  counter_t c;
+  get_counter (cx, td, &c);
+  if (!c.dual)
+    t->down = false;
+  else if (t->cnt0 > c.top)
+    {
+      t->cnt0 = c.top;
+      t->down = true;
+    }
+
+  timer_update (cx, i);
+}
+
+
+// The core has vectored to VECTOR, which clears the flag that raised it.
+
+void
+timer_irq_taken (context_t *cx, int vector)
+{
+  for (int i = 0; i < cx->n_timers; i++)
+    {
+      const timer_desc_t *td = & cx->timer_desc[i];
+      for (int f = 0; f < F_OC + td->n_oc; f++)
+        if (flag_vector (td, f) == vector)
+          {
+            timer_sync (cx, i, cx->program.n_cycles);
+            cx->data[td->tifr] &= ~flag_mask (td, f);
+            timer_update (cx, i);
+            return;
+          }
+    }
+}
+
+static void
+hook (context_t *cx, int addr, int n_bytes, int h)
+{
+  for (int a = addr; a < addr + n_bytes; a++)
+    cx->periph_hook[a] = h;
+}
+
+// Hook the registers of the timers of LAYOUT from avr-device.def.
+
+void
+timers_map (context_t *cx, int layout)
+{
+  const timer_desc_t *timers = layout == LAYOUT_MX8 ? timers_mx8
+    : layout == LAYOUT_M1284 ? timers_m1284
+    : layout == LAYOUT_M2560 ? timers_m2560
+    : layout == LAYOUT_XMEGA ? timers_xmega
+    : NULL;
+
+  cx->timer_desc = timers;
+  for (cx->n_timers = 0; timers && timers[cx->n_timers].prescale;
+       cx->n_timers++)
+    {
+      const timer_desc_t *td = & timers[cx->n_timers];
+      int h = 1 + cx->n_timers;
+      int w = td->kind == TK_MEGA8 ? 1 : 2;
+
+      hook (cx, td->tifr, 1, h | PERIPH_W1C);
+      hook (cx, td->timsk, td->kind == TK_XMEGA ? 2 : 1, h);
+      hook (cx, td->tccr, 2, h);
+      hook (cx, td->tcnt, w, h);
+      hook (cx, td->ocr, w * td->n_oc, h);
+      if (td->icr)
+        hook (cx, td->icr, 2, h);
+    }
+}
+
+// Reset the timers of CX.  They are stopped, and PER of XMEGA is MAX.
+
+void
+timers_init (context_t *cx)
+{
+  memset (cx->timer, 0, sizeof (cx->timer));
+
+  for (int i = 0; i < cx->n_timers; i++)
+    if (cx->timer_desc[i].kind == TK_XMEGA)
+      {
+        int icr = cx->timer_desc[i].icr;
+        cx->data[icr] = cx->data[icr + 1] = 0xff;
+      }
+}
@@ -0,0 +1,505 @@
+/*
+  This file is part of avrtest -- A simple simulator for the
+  Atmel AVR family of microcontrollers designed to test the compiler.
+
+  Copyright (C) 2001, 2002, 2003   Theodore A. Roth, Klaus Rudolph
+  Copyright (C) 2007 Paulo Marques
+  Copyright (C) 2008-2026 Free Software Foundation, Inc.
+
+  avrtest is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 2 of the License, or
+  (at your option) any later version.
+
+  avrtest is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with avrtest; see the file COPYING.  If not, write to
+  the Free Software Foundation, 59 Temple Place - Suite 330,
+  Boston, MA 02111-1307, USA.  */
+
+/* USART model.
+
+   The USART0 of megaAVR devices like ATmega328P and the USARTC0 of XMEGA
+   devices in asynchronous mode.  What the USART transmits goes to the
+   host file from -usart-tx=, and what it receives comes from the host
+   file from -usart-rx=.  Both are buffered in bulk, and nothing is
+   flushed per byte.
+
+   Like the timers, the USART is not ticked.  The received frames follow
+   each other back to back at the baud rate, and usart_sync() computes
+   which of them arrived by the time the program accesses the USART.
+   Frames that arrive while the receive buffer is full are lost and set
+   DOR.  An event is only scheduled when an enabled interrupt is waiting
+   for a frame to be received or transmitted.
+
+   Not modelled:  Synchronous and SPI modes, multi-processor mode, the
+   9th data bit (RXB8 is 0 and TXB8 is ignored), frame and parity errors,
+   and the interrupt levels of XMEGA.  */
+
+// For fileno with -std=c99.
+#define _DEFAULT_SOURCE
+
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "testavr.h"
+#include "options.h"
+#include "irq.h"
+#include "periph.h"
+#include "replay.h"
+
+// Bits of UCSRnA resp. STATUS.
+#define ST_RXC  0x80
+#define ST_TXC  0x40
+#define ST_DRE  0x20
+#define ST_DOR  0x08
+#define ST_U2X  0x02
+
+// Bits of UCSRnB resp. CTRLB.
+#define CB_RXEN  0x10
+#define CB_TXEN  0x08
+
+// The interrupts of a USART in the order of their vectors.
+enum
+  {
+    IRQ_RXC, IRQ_DRE, IRQ_TXC, N_IRQ
+  };
+
+// Where the registers of a USART are.  For megaAVR, CTRLA and CTRLB are
+// both UCSRnB.  BAUD is UBRRnL resp. BAUDCTRLA, followed by the high part.
+
+typedef struct usart_desc
+{
+  bool xmega;
+  int data, status, ctrla, ctrlb, ctrlc, baud;
+  // The vector of RXC.  DRE and TXC follow.
+  int vec_rxc;
+} usart_desc_t;
+
+#define USART0(RXC)                                     \
+  { false, 0xc6, 0xc0, 0xc1, 0xc1, 0xc2, 0xc4, RXC }
+#define USART_X(BASE, RXC)                                              \
+  { true, BASE, BASE + 1, BASE + 3, BASE + 4, BASE + 5, BASE + 6, RXC }
+
+static const usart_desc_t usart_mx8 = USART0 (18);
+static const usart_desc_t usart_m1284 = USART0 (20);
+static const usart_desc_t usart_m2560 = USART0 (25);
+static const usart_desc_t usart_xmega = USART_X (0x8a0, 25);
+
+// The host side, allocated by host_open().
+
+typedef struct usart_host
+{
+  // -usart-rx=
+  FILE *file;
+  byte buf[1 << 16];
+  size_t pos, len;
+  // Whether there may be more to receive, and how many bytes have
+  // been received so far.
+  bool more;
+  qword n_received;
+  // -usart-tx=
+  FILE *tx;
+} usart_host_t;
+
+// The source for replay_input().
+
+static int
+host_read (context_t *cx)
+{
+  usart_host_t *rx = cx->usart_host;
+
+  if (rx->pos == rx->len)
+    {
+      ssize_t len = rx->file
+        ? read (fileno (rx->file), rx->buf, sizeof (rx->buf))
+        : 0;
+      if (len <= 0)
+        {
+          rx->file = NULL;
+          return -1;
+        }
+      rx->pos = 0;
+      rx->len = len;
+    }
+
+  return rx->buf[rx->pos++];
+}
+
+// The next byte to receive from the host resp. from -replay=.
+
+static int
+host_getc (context_t *cx)
+{
+  usart_host_t *rx = cx->usart_host;
+  int c = replay_input (cx, REPLAY_USART, rx->n_received++, host_read);
+  if (c < 0)
+    rx->more = false;
+  return c;
+}
+
+static void
+host_putc (context_t *cx, int c)
+{
+  if (cx->usart_host->tx)
+    putc (c, cx->usart_host->tx);
+}
+
+static void
+host_open (context_t *cx)
+{
+  if (cx->usart_host)
+    return;
+  usart_host_t *h = cx->usart_host
+    = get_mem (cx, 1, sizeof (usart_host_t), "USART");
+  const options_t *options = & cx->options;
+
+  // With -replay=, the frames come from the recording.
+  h->more = options->do_usart_rx;
+  if (options->do_usart_rx && !options->do_replay)
+    {
+      const char *name = options->s_usart_rx;
+      h->file = str_eq (name, "-") ? cx->in : get_file (cx, name, "rb");
+      if (!h->file)
+        leave (cx, LEAVE_IO, "cannot read -usart-rx=%s", name);
+    }
+
+  if (options->do_usart_tx)
+    {
+      const char *name = options->s_usart_tx;
+      h->tx = str_eq (name, "-") ? cx->out : get_file (cx, name, "wb");
+      if (!h->tx)
+        leave (cx, LEAVE_IO, "cannot write -usart-tx=%s", name);
+      if (h->tx != cx->out)
+        setvbuf (h->tx, NULL, _IOFBF, 1 << 16);
+    }
+}
+
+
+static bool
+irq_enabled (const context_t *cx, const usart_desc_t *ud, int irq)
+{
+  static const byte mask[N_IRQ] = { 0x80, 0x20, 0x40 };
+  static const byte mask_x[N_IRQ] = { 0x30, 0x03, 0x0c };
+
+  return cx->data[ud->ctrla] & (ud->xmega ? mask_x : mask)[irq];
+}
+
+// The cycles per frame as of the baud rate and the frame format.
+
+static qword
+frame_cycles (const context_t *cx, const usart_desc_t *ud)
+{
+  const byte *data = cx->data;
+  int c = data[ud->ctrlc];
+  int size = ud->xmega ? c & 7 : ((c >> 1) & 3) | (data[ud->ctrlb] & 4);
+  int n_bits = 1 + (size == 7 ? 9 : 5 + (size & 3))
+    + ((c & 0x30) ? 1 : 0) + ((c & 0x08) ? 2 : 1);
+  unsigned bsel = (data[ud->baud] | (data[ud->baud + 1] << 8)) & 0xfff;
+  unsigned per = (ud->xmega
+                  ? data[ud->ctrlb] & 0x04
+                  : data[ud->status] & ST_U2X) ? 8 : 16;
+
+  // XMEGA:  BSCALE in the high nibble of BAUDCTRLB is signed.
+  int scale = ud->xmega ? data[ud->baud + 1] >> 4 : 0;
+  if (scale >= 8)
+    scale -= 16;
+
+  if (scale >= 0)
+    return (qword) n_bits * (per << scale) * (bsel + 1);
+
+  scale = -scale;
+  return ((qword) n_bits * per * (bsel + (1u << scale))
+          + (1u << (scale - 1))) >> scale;
+}
+
+
+// Advance USART I to cycle NOW:  Receive the frames that arrived and
+// finish the frames that were transmitted.
+
+static void
+usart_sync (context_t *cx, int i, qword now)
+{
+  avr_usart_t *u = & cx->usart[i];
+  const usart_desc_t *ud = & cx->usart_desc[i];
+  byte *status = & cx->data[ud->status];
+
+  if ((u->rx_next && u->rx_next <= now)
+      || (u->tx_shift && u->tx_done <= now))
+    {
+      qword frame = frame_cycles (cx, ud);
+
+      while (u->rx_next && u->rx_next <= now)
+        {
+          int c = host_getc (cx);
+          if (c < 0)
+            u->rx_next = 0;
+          else
+            {
+              if (u->n_rx < 2)
+                u->rx_fifo[u->n_rx++] = c;
+              else
+                *status |= ST_DOR;
+              u->rx_next += frame;
+            }
+        }
+
+      while (u->tx_shift && u->tx_done <= now)
+        if (u->tx_full)
+          {
+            u->tx_full = false;
+            u->tx_done += frame;
+          }
+        else
+          {
+            u->tx_shift = false;
+            *status |= ST_TXC;
+          }
+    }
+
+  *status = (*status & ~(ST_RXC | ST_DRE))
+    | (u->n_rx ? ST_RXC : 0)
+    | (u->tx_full ? 0 : ST_DRE);
+}
+
+static void usart_update (context_t*, int);
+
+void
+usart_event (context_t *cx, int i)
+{
+  cx->usart[i].scheduled = false;
+  usart_sync (cx, i, cx->program.n_cycles);
+  usart_update (cx, i);
+}
+
+// USART I has been synced to the current cycle:  Raise or clear its
+// interrupts, and schedule an event for when an enabled interrupt that
+// is not pending yet will be raised.
+
+static void
+usart_update (context_t *cx, int i)
+{
+  avr_usart_t *u = & cx->usart[i];
+  const usart_desc_t *ud = & cx->usart_desc[i];
+  int status = cx->data[ud->status];
+  qword next = (qword) -1;
+
+  if (u->scheduled)
+    {
+      event_cancel (cx, usart_event, i);
+      u->scheduled = false;
+    }
+
+  static const byte flag[N_IRQ] = { ST_RXC, ST_DRE, ST_TXC };
+
+  for (int irq = 0; irq < N_IRQ; irq++)
+    {
+      bool enabled = irq_enabled (cx, ud, irq);
+
+      if (enabled && (status & flag[irq]))
+        irq_raise (cx, ud->vec_rxc + irq);
+      else
+        irq_clear (cx, ud->vec_rxc + irq);
+
+      if (!enabled || (status & flag[irq]))
+        continue;
+
+      qword when = irq == IRQ_RXC ? (u->rx_next ? u->rx_next : next)
+        : irq == IRQ_DRE ? (u->tx_full ? u->tx_done : next)
+        : u->tx_shift ? u->tx_done : next;
+      next = when < next ? when : next;
+    }
+
+  if (next != (qword) -1)
+    {
+      event_schedule (cx, next, usart_event, i);
+      u->scheduled = true;
+    }
+}
+
+
+// Read register ADDR of USART I at cycle NOW.  Reading the data register
+// takes a frame from the receive buffer.
+
+int
+usart_read (context_t *cx, int i, int addr, qword now)
+{
+  avr_usart_t *u = & cx->usart[i];
+  const usart_desc_t *ud = & cx->usart_desc[i];
+
+  usart_sync (cx, i, now);
+
+  if (addr == ud->data && u->n_rx)
+    {
+      cx->data[addr] = u->rx_fifo[0];
+      u->rx_fifo[0] = u->rx_fifo[1];
+      u->n_rx--;
+      cx->data[ud->status] &= ~ST_DOR;
+      usart_sync (cx, i, now);
+      usart_update (cx, i);
+    }
+
+  return cx->data[addr];
+}
+
+// Write VALUE to register ADDR of USART I at cycle NOW.  Writing the
+// data register transmits a frame.
+
+void
+usart_write (context_t *cx, int i, int addr, int value, qword now)
+{
+  avr_usart_t *u = & cx->usart[i];
+  const usart_desc_t *ud = & cx->usart_desc[i];
+  byte *data = cx->data;
+
+  usart_sync (cx, i, now);
+
+  if (addr == ud->data)
+    {
+      if (!(data[ud->ctrlb] & CB_TXEN)
+          || u->tx_full)
+        return;
+      host_putc (cx, value);
+      if (u->tx_shift)
+        u->tx_full = true;
+      else
+        {
+          u->tx_shift = true;
+          u->tx_done = now + frame_cycles (cx, ud);
+        }
+      usart_sync (cx, i, now);
+    }
+  else if (addr == ud->status)
+    {
+      // TXC is cleared by writing 1.  On megaAVR, U2X and MPCM are
+      // writable, too.
+      int keep = data[addr] & ~(value & ST_TXC);
+      data[addr] = ud->xmega ? keep : (keep & ~0x03) | (value & 0x03);
+    }
+  else
+    {
+      int rxen = data[ud->ctrlb] & CB_RXEN;
+      data[addr] = value;
+      if (addr == ud->ctrlb
+          && rxen != (value & CB_RXEN))
+        {
+          u->n_rx = 0;
+          u->rx_next = rxen || !cx->usart_host->more
+            ? 0 : now + frame_cycles (cx, ud);
+          usart_sync (cx, i, now);
+        }
+    }
+
+  usart_update (cx, i);
+}
+
+
+// The core has vectored to VECTOR.  TXC is cleared by its vector, the
+// other flags are only cleared by serving the USART, hence raise their
+// interrupts again if they are still pending.
+
+void
+usart_irq_taken (context_t *cx, int vector)
+{
+  for (int i = 0; i < cx->n_usarts; i++)
+    {
+      const usart_desc_t *ud = & cx->usart_desc[i];
+      if (vector >= ud->vec_rxc
+          && vector < ud->vec_rxc + N_IRQ)
+        {
+          usart_sync (cx, i, cx->program.n_cycles);
+          if (vector == ud->vec_rxc + IRQ_TXC)
+            cx->data[ud->status] &= ~ST_TXC;
+          usart_update (cx, i);
+        }
+    }
+}
+
+
+// Hook the registers of the USARTs of LAYOUT from avr-device.def, and
+// connect them to the host files from -usart-rx= and -usart-tx=.
+
+void
+usarts_map (context_t *cx, int layout)
+{
+  const usart_desc_t *usarts = layout == LAYOUT_MX8 ? & usart_mx8
+    : layout == LAYOUT_M1284 ? & usart_m1284
+    : layout == LAYOUT_M2560 ? & usart_m2560
+    : layout == LAYOUT_XMEGA ? & usart_xmega
+    : NULL;
+  cx->usart_desc = usarts;
+  cx->n_usarts = usarts ? 1 : 0;
+
+  if (cx->n_usarts == 0
+      && (cx->options.do_usart_rx || cx->options.do_usart_tx))
+    leave (cx, LEAVE_USAGE, "-usart-rx= and -usart-tx= need -mmcu=DEVICE "
+           "for a device with USART");
+
+  for (int i = 0; i < cx->n_usarts; i++)
+    {
+      const usart_desc_t *ud = & usarts[i];
+      int h = PERIPH_USART | (1 + i);
+
+      cx->periph_hook[ud->data] = h;
+      cx->periph_hook[ud->status] = h;
+      cx->periph_hook[ud->ctrla] = h;
+      cx->periph_hook[ud->ctrlb] = h;
+      cx->periph_hook[ud->ctrlc] = h;
+      cx->periph_hook[ud->baud] = h;
+      cx->periph_hook[ud->baud + 1] = h;
+    }
+
+  host_open (cx);
+}
+
+// Reset the USARTs of CX:  Off, with the transmit buffer empty and
+// frames of 8 data bits.
+
+void
+usarts_init (context_t *cx)
+{
+  memset (cx->usart, 0, sizeof (cx->usart));
+
+  for (int i = 0; i < cx->n_usarts; i++)
+    {
+      const usart_desc_t *ud = & cx->usart_desc[i];
+      cx->data[ud->status] = ST_DRE;
+      cx->data[ud->ctrlc] = ud->xmega ? 0x03 : 0x06;
+    }
+}
+
+void
+usarts_finish (context_t *cx)
+{
+  if (cx->usart_host && cx->usart_host->tx)
+    fflush (cx->usart_host->tx);
+}
+
+// How many bytes have been received from the host, cf. checkpoint.c.
+
+qword
+usarts_received (const context_t *cx)
+{
+  return cx->usart_host ? cx->usart_host->n_received : 0;
+}
+
+// The program resumes from a checkpoint:  Drop the N bytes of -usart-rx=
+// that it had received already.
+
+void
+usarts_skip (context_t *cx, qword n)
+{
+  host_open (cx);
+  usart_host_t *rx = cx->usart_host;
+  while (rx->n_received < n)
+    {
+      rx->n_received++;
+      if (host_read (cx) < 0)
+        rx->more = false;
+    }
+}